@@ -0,0 +1,64 @@
+# Google Benchmark integration for OCCT
+
+# Only proceed if benchmarks are enabled
+if (NOT BUILD_BENCHMARK)
+  set(GOOGLEBENCHMARK_FOUND FALSE)
+  return()
+endif()
+
+# Check if the user has specified whether to install benchmark executables
+if (NOT DEFINED INSTALL_BENCHMARK)
+  set(INSTALL_BENCHMARK OFF CACHE BOOL "Install benchmark executables")
+endif()
+
+# Google Benchmark configuration options
+option(BENCHMARK_USE_FETCHCONTENT "Use FetchContent to download and build Google Benchmark" ON)
+
+# Try to find existing Google Benchmark installation
+find_package(benchmark QUIET)
+
+if(benchmark_FOUND)
+  message(STATUS "Found Google Benchmark installation")
+  set(GOOGLEBENCHMARK_FOUND TRUE)
+  set(BENCHMARK_USE_FETCHCONTENT FALSE)
+else()
+  message(STATUS "Google Benchmark not found in system paths")
+  if(BENCHMARK_USE_FETCHCONTENT)
+    # FetchContent requires CMake 3.11 or higher
+    if(CMAKE_VERSION VERSION_LESS "3.11")
+      message(WARNING "FetchContent requires CMake 3.11 or higher (current version: ${CMAKE_VERSION}). "
+                      "Please either upgrade CMake, install Google Benchmark manually, or disable BUILD_BENCHMARK.")
+      set(GOOGLEBENCHMARK_FOUND FALSE)
+      return()
+    endif()
+    include(FetchContent)
+
+    # Build only the library, without its own tests and install rules
+    set(BENCHMARK_ENABLE_TESTING OFF CACHE BOOL "Enable testing of the benchmark library" FORCE)
+    set(BENCHMARK_ENABLE_GTEST_TESTS OFF CACHE BOOL "Enable building the unit tests which depend on gtest" FORCE)
+    set(BENCHMARK_ENABLE_INSTALL OFF CACHE BOOL "Enable installation of benchmark" FORCE)
+    set(BENCHMARK_ENABLE_WERROR OFF CACHE BOOL "Build Release candidates with -Werror" FORCE)
+
+    FetchContent_Declare(
+      googlebenchmark
+      URL https://github.com/google/benchmark/archive/refs/tags/v1.9.1.zip
+      DOWNLOAD_EXTRACT_TIMESTAMP true
+    )
+
+    FetchContent_MakeAvailable(googlebenchmark)
+
+    # Set proper grouping for the targets in solution explorer
+    if(TARGET benchmark)
+      set_target_properties(benchmark PROPERTIES FOLDER "ThirdParty/GoogleBenchmark")
+    endif()
+    if(TARGET benchmark_main)
+      set_target_properties(benchmark_main PROPERTIES FOLDER "ThirdParty/GoogleBenchmark")
+    endif()
+
+    # Set variables for consistent use throughout the build system
+    set(GOOGLEBENCHMARK_FOUND TRUE)
+  else()
+    message(STATUS "Google Benchmark not available. Benchmarks will be skipped.")
+    set(GOOGLEBENCHMARK_FOUND FALSE)
+  endif()
+endif()
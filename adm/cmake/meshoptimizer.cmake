@@ -0,0 +1,109 @@
+# meshoptimizer - a mesh optimization library, used for EXT_meshopt_compression extension to glTF format.
+# https://github.com/zeux/meshoptimizer
+
+macro (SEARCH_MESHOPTIMIZER_LIB)
+  if (3RDPARTY_MESHOPTIMIZER_DIR AND EXISTS "${3RDPARTY_MESHOPTIMIZER_DIR}")
+    if (NOT 3RDPARTY_MESHOPTIMIZER_LIBRARY OR NOT EXISTS "${3RDPARTY_MESHOPTIMIZER_LIBRARY}")
+      set (CMAKE_FIND_LIBRARY_SUFFIXES .lib .a)
+      set (3RDPARTY_MESHOPTIMIZER_LIBRARY "3RDPARTY_MESHOPTIMIZER_LIBRARY-NOTFOUND" CACHE FILEPATH "The path to meshoptimizer library" FORCE)
+  
+      find_library (3RDPARTY_MESHOPTIMIZER_LIBRARY NAMES ${CSF_Meshoptimizer}
+                                           PATHS "${3RDPARTY_MESHOPTIMIZER_DIR}"
+                                           PATH_SUFFIXES lib
+                                           CMAKE_FIND_ROOT_PATH_BOTH
+                                           NO_DEFAULT_PATH)
+      if (3RDPARTY_MESHOPTIMIZER_LIBRARY AND EXISTS "${3RDPARTY_MESHOPTIMIZER_LIBRARY}")
+        get_filename_component (3RDPARTY_MESHOPTIMIZER_LIBRARY_DIR "${3RDPARTY_MESHOPTIMIZER_LIBRARY}" PATH)
+        set (3RDPARTY_MESHOPTIMIZER_LIBRARY_DIR "${3RDPARTY_MESHOPTIMIZER_LIBRARY_DIR}" CACHE FILEPATH "The directory containing meshoptimizer library" FORCE)
+      endif()
+    endif()
+  
+    if (WIN32 AND (NOT 3RDPARTY_MESHOPTIMIZER_LIBRARY_DEBUG OR NOT EXISTS "${3RDPARTY_MESHOPTIMIZER_LIBRARY_DEBUG}"))
+      set (CMAKE_FIND_LIBRARY_SUFFIXES .lib .a)
+      set (3RDPARTY_MESHOPTIMIZER_LIBRARY_DEBUG "3RDPARTY_MESHOPTIMIZER_LIBRARY_DEBUG-NOTFOUND" CACHE FILEPATH "The path to debug meshoptimizer library" FORCE)
+  
+      find_library (3RDPARTY_MESHOPTIMIZER_LIBRARY_DEBUG NAMES ${CSF_Meshoptimizer}
+                                           PATHS "${3RDPARTY_MESHOPTIMIZER_DIR}"
+                                           PATH_SUFFIXES libd debug/lib
+                                           CMAKE_FIND_ROOT_PATH_BOTH
+                                           NO_DEFAULT_PATH)
+      if (3RDPARTY_MESHOPTIMIZER_LIBRARY_DEBUG AND EXISTS "${3RDPARTY_MESHOPTIMIZER_LIBRARY_DEBUG}")
+        get_filename_component (3RDPARTY_MESHOPTIMIZER_LIBRARY_DIR_DEBUG "${3RDPARTY_MESHOPTIMIZER_LIBRARY_DEBUG}" PATH)
+        set (3RDPARTY_MESHOPTIMIZER_LIBRARY_DIR_DEBUG "${3RDPARTY_MESHOPTIMIZER_LIBRARY_DIR_DEBUG}" CACHE FILEPATH "The directory containing debug meshoptimizer library" FORCE)
+      endif()
+    endif()
+  endif()
+endmacro()
+
+# vcpkg processing
+if (BUILD_USE_VCPKG)
+  find_package (meshoptimizer CONFIG REQUIRED)
+  set(CSF_Meshoptimizer meshoptimizer::meshoptimizer)
+  return()
+endif()
+
+OCCT_INCLUDE_CMAKE_FILE ("adm/cmake/occt_macros")
+
+if (NOT DEFINED 3RDPARTY_MESHOPTIMIZER_DIR)
+  set (3RDPARTY_MESHOPTIMIZER_DIR "" CACHE PATH "The directory containing meshoptimizer")
+endif()
+
+if (NOT DEFINED 3RDPARTY_MESHOPTIMIZER_INCLUDE_DIR)
+  set (3RDPARTY_MESHOPTIMIZER_INCLUDE_DIR  "" CACHE PATH "The directory containing headers of the meshoptimizer")
+endif()
+
+if (NOT DEFINED 3RDPARTY_MESHOPTIMIZER_LIBRARY)
+  set (3RDPARTY_MESHOPTIMIZER_LIBRARY "" CACHE FILEPATH "meshoptimizer library")
+endif()
+
+if (NOT DEFINED 3RDPARTY_MESHOPTIMIZER_LIBRARY_DIR)
+  set (3RDPARTY_MESHOPTIMIZER_LIBRARY_DIR "" CACHE PATH "The directory containing meshoptimizer library")
+endif()
+
+if (WIN32)
+  if (NOT DEFINED 3RDPARTY_MESHOPTIMIZER_LIBRARY_DEBUG)
+    set (3RDPARTY_MESHOPTIMIZER_LIBRARY_DEBUG "" CACHE FILEPATH "meshoptimizer debug library")
+  endif()
+  
+  if (NOT DEFINED 3RDPARTY_MESHOPTIMIZER_LIBRARY_DIR_DEBUG)
+    set (3RDPARTY_MESHOPTIMIZER_LIBRARY_DIR_DEBUG "" CACHE PATH "The directory containing meshoptimizer debug library")
+  endif()
+endif()
+
+if (3RDPARTY_DIR AND EXISTS "${3RDPARTY_DIR}")
+  if (NOT 3RDPARTY_MESHOPTIMIZER_DIR OR NOT EXISTS "${3RDPARTY_MESHOPTIMIZER_DIR}")
+    FIND_PRODUCT_DIR("${3RDPARTY_DIR}" meshoptimizer MESHOPTIMIZER_DIR_NAME)
+    if (MESHOPTIMIZER_DIR_NAME)
+      set (3RDPARTY_MESHOPTIMIZER_DIR "${3RDPARTY_DIR}/${MESHOPTIMIZER_DIR_NAME}" CACHE PATH "The directory containing meshoptimizer" FORCE)
+    endif()
+  endif()
+endif()
+
+# header
+if (NOT 3RDPARTY_MESHOPTIMIZER_INCLUDE_DIR OR NOT EXISTS "${3RDPARTY_MESHOPTIMIZER_INCLUDE_DIR}")
+  set (HEADER_NAMES meshoptimizer.h)
+
+  # set 3RDPARTY_MESHOPTIMIZER_INCLUDE_DIR as notfound, otherwise find_path can't assign a new value to 3RDPARTY_MESHOPTIMIZER_INCLUDE_DIR
+  set (3RDPARTY_MESHOPTIMIZER_INCLUDE_DIR "3RDPARTY_MESHOPTIMIZER_INCLUDE_DIR-NOTFOUND" CACHE FILEPATH "The directory containing headers of the meshoptimizer" FORCE)
+
+  if (3RDPARTY_MESHOPTIMIZER_DIR AND EXISTS "${3RDPARTY_MESHOPTIMIZER_DIR}")
+    find_path (3RDPARTY_MESHOPTIMIZER_INCLUDE_DIR NAMES ${HEADER_NAMES}
+                                                 PATHS ${3RDPARTY_MESHOPTIMIZER_DIR}
+                                                 PATH_SUFFIXES "include"
+                                                 CMAKE_FIND_ROOT_PATH_BOTH
+                                                 NO_DEFAULT_PATH)
+  else()
+    find_path (3RDPARTY_MESHOPTIMIZER_INCLUDE_DIR NAMES ${HEADER_NAMES}
+                                                 PATHS ${3RDPARTY_MESHOPTIMIZER_DIR}
+                                                 PATH_SUFFIXES "include"
+                                                 CMAKE_FIND_ROOT_PATH_BOTH)
+  endif()
+endif()
+
+if (3RDPARTY_MESHOPTIMIZER_INCLUDE_DIR AND EXISTS "${3RDPARTY_MESHOPTIMIZER_INCLUDE_DIR}")
+  list (APPEND 3RDPARTY_INCLUDE_DIRS "${3RDPARTY_MESHOPTIMIZER_INCLUDE_DIR}")
+else()
+  list (APPEND 3RDPARTY_NOT_INCLUDED 3RDPARTY_MESHOPTIMIZER_INCLUDE_DIR)
+endif()
+
+SEARCH_MESHOPTIMIZER_LIB()
@@ -0,0 +1,100 @@
+# Google Benchmark integration for OCCT toolkits
+
+set (BENCHMARK_PROJECT_NAME OpenCascadeBenchmark)
+
+# Directory for JSON results of benchmark runs
+if (NOT DEFINED BENCHMARK_RESULTS_DIR)
+  set (BENCHMARK_RESULTS_DIR "${CMAKE_BINARY_DIR}/benchmark_results" CACHE PATH "Directory for JSON results of benchmark runs")
+endif()
+
+# Initialize benchmark environment and create the target running all benchmarks
+function(OCCT_INIT_BENCHMARK)
+  if (NOT GOOGLEBENCHMARK_FOUND)
+    message(STATUS "Google Benchmark not available. Skipping benchmark project ${BENCHMARK_PROJECT_NAME}")
+    return()
+  endif()
+
+  # Running all benchmarks writes one JSON file per toolkit into BENCHMARK_RESULTS_DIR
+  add_custom_target(${BENCHMARK_PROJECT_NAME}_Run
+                    COMMENT "Running OCCT benchmarks, results are written to ${BENCHMARK_RESULTS_DIR}")
+  set_target_properties(${BENCHMARK_PROJECT_NAME}_Run PROPERTIES FOLDER "Benchmarks")
+endfunction()
+
+# Create the benchmark executable of a specific toolkit
+function(OCCT_ADD_TOOLKIT_BENCHMARKS TOOLKIT_NAME)
+  # Skip if Google Benchmark is not available
+  if (NOT GOOGLEBENCHMARK_FOUND OR NOT TARGET ${BENCHMARK_PROJECT_NAME}_Run)
+    return()
+  endif()
+
+  # Extract benchmark source files from FILES.cmake
+  set(FILES_CMAKE_PATH "${OCCT_${TOOLKIT_NAME}_FILES_LOCATION}/Benchmarks/FILES.cmake")
+  if(NOT EXISTS "${FILES_CMAKE_PATH}" OR NOT TARGET ${TOOLKIT_NAME})
+    return()
+  endif()
+
+  # Reset toolkit benchmark files list
+  set(OCCT_${TOOLKIT_NAME}_Benchmarks_FILES)
+
+  # Include the toolkit's FILES.cmake which sets OCCT_${TOOLKIT_NAME}_Benchmarks_FILES
+  include("${FILES_CMAKE_PATH}")
+  if(NOT OCCT_${TOOLKIT_NAME}_Benchmarks_FILES)
+    return()
+  endif()
+
+  set(BENCHMARK_SOURCE_FILES_ABS)
+  foreach(BENCHMARK_SOURCE_FILE ${OCCT_${TOOLKIT_NAME}_Benchmarks_FILES})
+    set(BENCHMARK_SOURCE_FILE_ABS "${OCCT_${TOOLKIT_NAME}_Benchmarks_FILES_LOCATION}/${BENCHMARK_SOURCE_FILE}")
+    list(APPEND BENCHMARK_SOURCE_FILES_ABS "${BENCHMARK_SOURCE_FILE_ABS}")
+    if ("${BENCHMARK_SOURCE_FILE}" MATCHES "[.]mm$")
+      set_source_files_properties("${BENCHMARK_SOURCE_FILE_ABS}" PROPERTIES COMPILE_FLAGS "-fobjc-arc")
+    endif()
+  endforeach()
+
+  set(BENCHMARK_TARGET "${BENCHMARK_PROJECT_NAME}_${TOOLKIT_NAME}")
+  add_executable(${BENCHMARK_TARGET} ${BENCHMARK_SOURCE_FILES_ABS})
+  set_target_properties(${BENCHMARK_TARGET} PROPERTIES FOLDER "Benchmarks")
+
+  # Link with Google Benchmark providing main()
+  target_link_libraries(${BENCHMARK_TARGET} PRIVATE benchmark::benchmark_main)
+
+  # Add pthreads if necessary (for Linux)
+  if (UNIX AND NOT APPLE)
+    target_link_libraries(${BENCHMARK_TARGET} PRIVATE pthread)
+  endif()
+
+  # Link with all active toolkits, so that benchmarks may prepare the input using other toolkits
+  foreach(TOOLKIT ${BUILD_TOOLKITS})
+    if(TARGET ${TOOLKIT})
+      get_target_property(TOOLKIT_TYPE ${TOOLKIT} TYPE)
+      if(TOOLKIT_TYPE STREQUAL "SHARED_LIBRARY" OR TOOLKIT_TYPE STREQUAL "STATIC_LIBRARY")
+        target_link_libraries(${BENCHMARK_TARGET} PRIVATE ${TOOLKIT})
+      endif()
+    endif()
+  endforeach()
+
+  # Run the benchmarks of the toolkit writing the results to JSON file
+  set(BENCHMARK_RESULT_FILE "${BENCHMARK_RESULTS_DIR}/${TOOLKIT_NAME}.json")
+  add_custom_target(${BENCHMARK_TARGET}_Run
+                    COMMAND ${CMAKE_COMMAND} -E make_directory "${BENCHMARK_RESULTS_DIR}"
+                    COMMAND ${CMAKE_COMMAND} -E env
+                            "CSF_OCCTDataPath=${OCCT_ROOT_DIR}/data"
+                            "CSF_OCCTResourcePath=${OCCT_ROOT_DIR}/resources"
+                            "CSF_STEPDefaults=${OCCT_ROOT_DIR}/resources/XSTEPResource"
+                            "CSF_XSMessage=${OCCT_ROOT_DIR}/resources/XSMessage"
+                            "CSF_SHMessage=${OCCT_ROOT_DIR}/resources/SHMessage"
+                            $<TARGET_FILE:${BENCHMARK_TARGET}>
+                            "--benchmark_out=${BENCHMARK_RESULT_FILE}"
+                            --benchmark_out_format=json
+                    DEPENDS ${BENCHMARK_TARGET}
+                    WORKING_DIRECTORY "${CMAKE_BINARY_DIR}"
+                    COMMENT "Running benchmarks of ${TOOLKIT_NAME}"
+                    USES_TERMINAL)
+  set_target_properties(${BENCHMARK_TARGET}_Run PROPERTIES FOLDER "Benchmarks")
+  add_dependencies(${BENCHMARK_PROJECT_NAME}_Run ${BENCHMARK_TARGET}_Run)
+
+  if (INSTALL_BENCHMARK)
+    install (TARGETS ${BENCHMARK_TARGET}
+             DESTINATION "${INSTALL_DIR_BIN}\${OCCT_INSTALL_BIN_LETTER}")
+  endif()
+endfunction()
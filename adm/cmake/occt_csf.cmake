@@ -82,6 +82,20 @@ else()
   set (CSF_Draco)
 endif()
 
+# meshoptimizer
+if (USE_MESHOPTIMIZER)
+  set (CSF_Meshoptimizer "meshoptimizer")
+else()
+  set (CSF_Meshoptimizer)
+endif()
+
+# Zstandard
+if (USE_ZSTD)
+  set (CSF_Zstd "zstd")
+else()
+  set (CSF_Zstd)
+endif()
+
 # VTK
 if (USE_VTK)
   # the variable must to be empty, but keep there the list of libs
@@ -0,0 +1,84 @@
+# Offline compilation of TKMetal shaders.
+#
+# Script is executed in CMake script mode (cmake -P) at build time.
+# It extracts shader sources embedded as raw string literals into TKMetal sources
+# and compiles each of them into a separate library named <source file name>_<variable name>.metallib,
+# which is loaded by Metal_Context::LoadShaderLibrary() instead of runtime compilation.
+#
+# Input variables:
+#   METAL_SOURCES - list of sources separated by '|'
+#   METAL_SDK     - SDK name passed to xcrun (macosx, iphoneos)
+#   METAL_FLAGS   - extra flags passed to metal compiler, separated by '|'
+#   XCRUN         - path to xcrun
+#   WORK_DIR      - folder for intermediate *.metal and *.air files
+#   OUTPUT_DIR    - folder for resulting *.metallib files
+#   STAMP_FILE    - file touched on success
+
+cmake_minimum_required (VERSION 3.10)
+
+string (REPLACE "|" ";" METAL_SOURCES "${METAL_SOURCES}")
+string (REPLACE "|" ";" METAL_FLAGS   "${METAL_FLAGS}")
+file (MAKE_DIRECTORY "${WORK_DIR}")
+file (MAKE_DIRECTORY "${OUTPUT_DIR}")
+
+set (NB_LIBRARIES 0)
+foreach (METAL_SOURCE ${METAL_SOURCES})
+  get_filename_component (SOURCE_STEM "${METAL_SOURCE}" NAME_WE)
+  file (READ "${METAL_SOURCE}" SOURCE_REST)
+  while (TRUE)
+    string (FIND "${SOURCE_REST}" "R\"(" LITERAL_BEGIN)
+    if (LITERAL_BEGIN EQUAL -1)
+      break()
+    endif()
+
+    # variable name preceding the literal: [static const char* | NSString*] NAME = [@]R"(
+    set (PREFIX_BEGIN 0)
+    if (LITERAL_BEGIN GREATER 256)
+      math (EXPR PREFIX_BEGIN "${LITERAL_BEGIN} - 256")
+    endif()
+    math (EXPR PREFIX_LENGTH "${LITERAL_BEGIN} - ${PREFIX_BEGIN}")
+    string (SUBSTRING "${SOURCE_REST}" ${PREFIX_BEGIN} ${PREFIX_LENGTH} LITERAL_PREFIX)
+    set (VARIABLE_NAME)
+    if ("${LITERAL_PREFIX}" MATCHES "([A-Za-z_0-9]+)[ \t]*(\\[\\])?[ \t]*=[ \t]*@?$")
+      set (VARIABLE_NAME "${CMAKE_MATCH_1}")
+    endif()
+
+    math (EXPR BODY_BEGIN "${LITERAL_BEGIN} + 3")
+    string (SUBSTRING "${SOURCE_REST}" ${BODY_BEGIN} -1 SOURCE_REST)
+    string (FIND "${SOURCE_REST}" ")\"" LITERAL_END)
+    if (LITERAL_END EQUAL -1)
+      message (FATAL_ERROR "Unterminated raw string literal in ${METAL_SOURCE}")
+    endif()
+    string (SUBSTRING "${SOURCE_REST}" 0 ${LITERAL_END} LITERAL_BODY)
+    math (EXPR BODY_END "${LITERAL_END} + 2")
+    string (SUBSTRING "${SOURCE_REST}" ${BODY_END} -1 SOURCE_REST)
+
+    if (NOT VARIABLE_NAME OR NOT "${LITERAL_BODY}" MATCHES "metal_stdlib")
+      continue()
+    endif()
+
+    set (LIBRARY_NAME "${SOURCE_STEM}_${VARIABLE_NAME}")
+    file (WRITE "${WORK_DIR}/${LIBRARY_NAME}.metal" "${LITERAL_BODY}")
+    execute_process (COMMAND "${XCRUN}" -sdk ${METAL_SDK} metal ${METAL_FLAGS}
+                             -c "${WORK_DIR}/${LIBRARY_NAME}.metal" -o "${WORK_DIR}/${LIBRARY_NAME}.air"
+                     RESULT_VARIABLE METAL_RESULT
+                     ERROR_VARIABLE  METAL_ERROR)
+    if (NOT METAL_RESULT EQUAL 0)
+      # runtime compilation of embedded source remains available
+      message (WARNING "Unable to precompile ${LIBRARY_NAME}:\n${METAL_ERROR}")
+      continue()
+    endif()
+    execute_process (COMMAND "${XCRUN}" -sdk ${METAL_SDK} metallib
+                             "${WORK_DIR}/${LIBRARY_NAME}.air" -o "${OUTPUT_DIR}/${LIBRARY_NAME}.metallib"
+                     RESULT_VARIABLE METAL_RESULT
+                     ERROR_VARIABLE  METAL_ERROR)
+    if (NOT METAL_RESULT EQUAL 0)
+      message (WARNING "Unable to link ${LIBRARY_NAME}.metallib:\n${METAL_ERROR}")
+      continue()
+    endif()
+    math (EXPR NB_LIBRARIES "${NB_LIBRARIES} + 1")
+  endwhile()
+endforeach()
+
+message (STATUS "Info: ${NB_LIBRARIES} Metal shader libraries have been precompiled into ${OUTPUT_DIR}")
+file (WRITE "${STAMP_FILE}" "${NB_LIBRARIES}\n")
@@ -49,6 +49,11 @@ set (BUILD_INCLUDE_SYMLINK_DESCR
 OFF - using a reference file with direct include to the origin,
 ON - symbolic link to the origin file are created")
 
+set (BUILD_BENCHMARK_DESCR
+"Build Google Benchmark executables of the toolkits having benchmark sources.
+Target OpenCascadeBenchmark_Run runs all of them and writes JSON results
+into BENCHMARK_RESULTS_DIR for continuous performance tracking.")
+
 # install variables
 set (INSTALL_DIR_DESCR
 "The place where built OCCT libraries, headers, test cases (INSTALL_TEST_CASES variable),
@@ -163,6 +168,14 @@ module for support of JSON-based formats like glTF")
 set (USE_DRACO_DESCR
 "Indicates whether Draco mesh decoding library should be used by glTF reader")
 
+set (USE_MESHOPTIMIZER_DESCR
+"Indicates whether meshoptimizer library should be used by glTF reader and writer
+for support of EXT_meshopt_compression extension")
+
+set (USE_ZSTD_DESCR
+"Indicates whether Zstandard compression library should be used for compression
+of shape sections in binary OCAF documents")
+
 set (USE_EGL_DESCR
 "Indicates whether EGL should be used in OCCT visualization
 module instead of conventional OpenGL context creation APIs")
@@ -0,0 +1,109 @@
+# Zstandard - a fast lossless compression library, used for compression of shape sections in binary OCAF documents.
+# https://github.com/facebook/zstd
+
+macro (SEARCH_ZSTD_LIB)
+  if (3RDPARTY_ZSTD_DIR AND EXISTS "${3RDPARTY_ZSTD_DIR}")
+    if (NOT 3RDPARTY_ZSTD_LIBRARY OR NOT EXISTS "${3RDPARTY_ZSTD_LIBRARY}")
+      set (CMAKE_FIND_LIBRARY_SUFFIXES .lib .a)
+      set (3RDPARTY_ZSTD_LIBRARY "3RDPARTY_ZSTD_LIBRARY-NOTFOUND" CACHE FILEPATH "The path to Zstd library" FORCE)
+  
+      find_library (3RDPARTY_ZSTD_LIBRARY NAMES ${CSF_Zstd}
+                                  PATHS "${3RDPARTY_ZSTD_DIR}"
+                                  PATH_SUFFIXES lib
+                                  CMAKE_FIND_ROOT_PATH_BOTH
+                                  NO_DEFAULT_PATH)
+      if (3RDPARTY_ZSTD_LIBRARY AND EXISTS "${3RDPARTY_ZSTD_LIBRARY}")
+        get_filename_component (3RDPARTY_ZSTD_LIBRARY_DIR "${3RDPARTY_ZSTD_LIBRARY}" PATH)
+        set (3RDPARTY_ZSTD_LIBRARY_DIR "${3RDPARTY_ZSTD_LIBRARY_DIR}" CACHE FILEPATH "The directory containing Zstd library" FORCE)
+      endif()
+    endif()
+  
+    if (WIN32 AND (NOT 3RDPARTY_ZSTD_LIBRARY_DEBUG OR NOT EXISTS "${3RDPARTY_ZSTD_LIBRARY_DEBUG}"))
+      set (CMAKE_FIND_LIBRARY_SUFFIXES .lib .a)
+      set (3RDPARTY_ZSTD_LIBRARY_DEBUG "3RDPARTY_ZSTD_LIBRARY_DEBUG-NOTFOUND" CACHE FILEPATH "The path to debug Zstd library" FORCE)
+  
+      find_library (3RDPARTY_ZSTD_LIBRARY_DEBUG NAMES ${CSF_Zstd}
+                                  PATHS "${3RDPARTY_ZSTD_DIR}"
+                                  PATH_SUFFIXES libd debug/lib
+                                  CMAKE_FIND_ROOT_PATH_BOTH
+                                  NO_DEFAULT_PATH)
+      if (3RDPARTY_ZSTD_LIBRARY_DEBUG AND EXISTS "${3RDPARTY_ZSTD_LIBRARY_DEBUG}")
+        get_filename_component (3RDPARTY_ZSTD_LIBRARY_DIR_DEBUG "${3RDPARTY_ZSTD_LIBRARY_DEBUG}" PATH)
+        set (3RDPARTY_ZSTD_LIBRARY_DIR_DEBUG "${3RDPARTY_ZSTD_LIBRARY_DIR_DEBUG}" CACHE FILEPATH "The directory containing debug Zstd library" FORCE)
+      endif()
+    endif()
+  endif()
+endmacro()
+
+# vcpkg processing
+if (BUILD_USE_VCPKG)
+  find_package (zstd CONFIG REQUIRED)
+  set(CSF_Zstd $<IF:$<TARGET_EXISTS:zstd::libzstd_shared>,zstd::libzstd_shared,zstd::libzstd_static>)
+  return()
+endif()
+
+OCCT_INCLUDE_CMAKE_FILE ("adm/cmake/occt_macros")
+
+if (NOT DEFINED 3RDPARTY_ZSTD_DIR)
+  set (3RDPARTY_ZSTD_DIR "" CACHE PATH "The directory containing Zstd")
+endif()
+
+if (NOT DEFINED 3RDPARTY_ZSTD_INCLUDE_DIR)
+  set (3RDPARTY_ZSTD_INCLUDE_DIR  "" CACHE PATH "The directory containing headers of Zstd")
+endif()
+
+if (NOT DEFINED 3RDPARTY_ZSTD_LIBRARY)
+  set (3RDPARTY_ZSTD_LIBRARY "" CACHE FILEPATH "Zstd library")
+endif()
+
+if (NOT DEFINED 3RDPARTY_ZSTD_LIBRARY_DIR)
+  set (3RDPARTY_ZSTD_LIBRARY_DIR "" CACHE PATH "The directory containing Zstd library")
+endif()
+
+if (WIN32)
+  if (NOT DEFINED 3RDPARTY_ZSTD_LIBRARY_DEBUG)
+    set (3RDPARTY_ZSTD_LIBRARY_DEBUG "" CACHE FILEPATH "Zstd debug library")
+  endif()
+  
+  if (NOT DEFINED 3RDPARTY_ZSTD_LIBRARY_DIR_DEBUG)
+    set (3RDPARTY_ZSTD_LIBRARY_DIR_DEBUG "" CACHE PATH "The directory containing Zstd debug library")
+  endif()
+endif()
+
+if (3RDPARTY_DIR AND EXISTS "${3RDPARTY_DIR}")
+  if (NOT 3RDPARTY_ZSTD_DIR OR NOT EXISTS "${3RDPARTY_ZSTD_DIR}")
+    FIND_PRODUCT_DIR("${3RDPARTY_DIR}" zstd ZSTD_DIR_NAME)
+    if (ZSTD_DIR_NAME)
+      set (3RDPARTY_ZSTD_DIR "${3RDPARTY_DIR}/${ZSTD_DIR_NAME}" CACHE PATH "The directory containing Zstd" FORCE)
+    endif()
+  endif()
+endif()
+
+# header
+if (NOT 3RDPARTY_ZSTD_INCLUDE_DIR OR NOT EXISTS "${3RDPARTY_ZSTD_INCLUDE_DIR}")
+  set (HEADER_NAMES zstd.h)
+
+  # set 3RDPARTY_ZSTD_INCLUDE_DIR as notfound, otherwise find_path can't assign a new value to 3RDPARTY_ZSTD_INCLUDE_DIR
+  set (3RDPARTY_ZSTD_INCLUDE_DIR "3RDPARTY_ZSTD_INCLUDE_DIR-NOTFOUND" CACHE FILEPATH "The directory containing headers of Zstd" FORCE)
+
+  if (3RDPARTY_ZSTD_DIR AND EXISTS "${3RDPARTY_ZSTD_DIR}")
+    find_path (3RDPARTY_ZSTD_INCLUDE_DIR NAMES ${HEADER_NAMES}
+                                        PATHS ${3RDPARTY_ZSTD_DIR}
+                                        PATH_SUFFIXES "include"
+                                        CMAKE_FIND_ROOT_PATH_BOTH
+                                        NO_DEFAULT_PATH)
+  else()
+    find_path (3RDPARTY_ZSTD_INCLUDE_DIR NAMES ${HEADER_NAMES}
+                                        PATHS ${3RDPARTY_ZSTD_DIR}
+                                        PATH_SUFFIXES "include"
+                                        CMAKE_FIND_ROOT_PATH_BOTH)
+  endif()
+endif()
+
+if (3RDPARTY_ZSTD_INCLUDE_DIR AND EXISTS "${3RDPARTY_ZSTD_INCLUDE_DIR}")
+  list (APPEND 3RDPARTY_INCLUDE_DIRS "${3RDPARTY_ZSTD_INCLUDE_DIR}")
+else()
+  list (APPEND 3RDPARTY_NOT_INCLUDED 3RDPARTY_ZSTD_INCLUDE_DIR)
+endif()
+
+SEARCH_ZSTD_LIB()
@@ -54,9 +54,12 @@ vcpkg_check_features(OUT_FEATURE_OPTIONS FEATURE_OPTIONS
         vtk         USE_VTK
         tcltk       USE_TK
         draco       USE_DRACO
+        meshoptimizer USE_MESHOPTIMIZER
+        zstd        USE_ZSTD
         ffmpeg      USE_FFMPEG
         openvr      USE_OPENVR
         gtest       BUILD_GTEST
+        benchmark   BUILD_BENCHMARK
         pch         BUILD_USE_PCH
         d3d         USE_D3D
         docs        BUILD_DOC_Overview
@@ -181,6 +181,13 @@ BinMNaming_NamedShapeDriver::BinMNaming_NamedShapeDriver(
 
 //=================================================================================================
 
+BinMNaming_NamedShapeDriver::~BinMNaming_NamedShapeDriver()
+{
+  Clear();
+}
+
+//=================================================================================================
+
 occ::handle<TDF_Attribute> BinMNaming_NamedShapeDriver::NewEmpty() const
 {
   return new TNaming_NamedShape();
@@ -337,7 +344,11 @@ void BinMNaming_NamedShapeDriver::WriteShapeSection(Standard_OStream&
 {
   myIsQuickPart = false;
   theOS << SHAPESET;
-  if (theDocVer >= TDocStd_FormatVersion_VERSION_11)
+  if (theDocVer >= TDocStd_FormatVersion_VERSION_13)
+  {
+    ShapeSet(false)->SetFormatNb(BinTools_FormatVersion_VERSION_7);
+  }
+  else if (theDocVer >= TDocStd_FormatVersion_VERSION_11)
   {
     ShapeSet(false)->SetFormatNb(BinTools_FormatVersion_VERSION_4);
   }
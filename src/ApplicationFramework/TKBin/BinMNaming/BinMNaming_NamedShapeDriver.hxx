@@ -39,8 +39,16 @@ public:
   Standard_EXPORT BinMNaming_NamedShapeDriver(
     const occ::handle<Message_Messenger>& theMessageDriver);
 
+  //! Destructor releasing the shape-set.
+  Standard_EXPORT ~BinMNaming_NamedShapeDriver() override;
+
   Standard_EXPORT occ::handle<TDF_Attribute> NewEmpty() const override;
 
+  //! Returns TRUE: the shapes are decoded on the first access to the attribute
+  //! in deferred loading mode. Note that TNaming_UsedShapes does not refer the shapes
+  //! of the attribute until it is loaded.
+  bool IsDeferrable() const override { return true; }
+
   Standard_EXPORT bool Paste(const BinObjMgt_Persistent&       Source,
                              const occ::handle<TDF_Attribute>& Target,
                              BinObjMgt_RRelocationTable&       RelocTable) const override;
@@ -0,0 +1,91 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BinLDrivers_DeferredLoader.hxx>
+
+#include <BinMDF_ADriverTable.hxx>
+#include <Message_Messenger.hxx>
+#include <Standard_ErrorHandler.hxx>
+#include <TCollection_ExtendedString.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(BinLDrivers_DeferredLoader, TDF_DeferredLoader)
+
+//=================================================================================================
+
+BinLDrivers_DeferredLoader::BinLDrivers_DeferredLoader(
+  const occ::handle<NCollection_Buffer>& theBuffer)
+    : myBuffer(theBuffer),
+      myStreamBuffer((const char*)theBuffer->Data(), theBuffer->Size()),
+      myStream(&myStreamBuffer)
+{
+  // shapes of quick part documents are read from the stream directly
+  myPAtt.SetIStream(myStream);
+}
+
+//=================================================================================================
+
+void BinLDrivers_DeferredLoader::Init(const occ::handle<BinMDF_ADriverTable>& theDrivers,
+                                      const occ::handle<Storage_HeaderData>&  theHeaderData,
+                                      const occ::handle<Message_Messenger>&   theMsgDriver)
+{
+  myDrivers = theDrivers;
+  myRelocTable.SetHeaderData(theHeaderData);
+  myMsgDriver = theMsgDriver;
+}
+
+//=================================================================================================
+
+bool BinLDrivers_DeferredLoader::Load(const occ::handle<TDF_Attribute>& theAttribute)
+{
+  uint64_t aPosition = 0;
+  if (!myPositions.Find(theAttribute, aPosition))
+  {
+    return false;
+  }
+  myPositions.UnBind(theAttribute);
+
+  const TCollection_ExtendedString aMethStr("BinLDrivers_DeferredLoader: ");
+  bool                             isLoaded = false;
+  try
+  {
+    OCC_CATCH_SIGNALS
+    myStream.clear();
+    myStream.seekg((std::streamoff)aPosition, std::ios_base::beg);
+    myStream >> myPAtt;
+    const occ::handle<BinMDF_ADriver> aDriver =
+      myStream && myPAtt.TypeId() > 0 ? myDrivers->GetDriver(myPAtt.TypeId()) : nullptr;
+    if (aDriver.IsNull())
+    {
+      myMsgDriver->Send(aMethStr + "error: unexpected data of deferred attribute", Message_Fail);
+    }
+    else
+    {
+      isLoaded = aDriver->Paste(myPAtt, theAttribute, myRelocTable);
+      if (!isLoaded)
+      {
+        myMsgDriver->Send(aMethStr + "warning: failure reading attribute " + aDriver->TypeName(),
+                          Message_Warning);
+      }
+    }
+  }
+  catch (Standard_Failure const& anException)
+  {
+    myMsgDriver->Send(aMethStr + "error: " + anException.GetMessageString(), Message_Fail);
+  }
+
+  if (myPositions.IsEmpty())
+  {
+    myPAtt.Destroy(); // free buffer
+  }
+  return isLoaded;
+}
@@ -0,0 +1,76 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BinLDrivers_DeferredLoader_HeaderFile
+#define _BinLDrivers_DeferredLoader_HeaderFile
+
+#include <BinObjMgt_Persistent.hxx>
+#include <BinObjMgt_RRelocationTable.hxx>
+#include <NCollection_Buffer.hxx>
+#include <NCollection_DataMap.hxx>
+#include <Standard_ArrayStreamBuffer.hxx>
+#include <TDF_Attribute.hxx>
+#include <TDF_DeferredLoader.hxx>
+
+class BinMDF_ADriverTable;
+class Message_Messenger;
+
+//! Loader of attributes which content has been deferred by BinLDrivers_DocumentRetrievalDriver.
+//!
+//! The loader keeps the document file mapped into memory and decodes the persistent record
+//! of an attribute on the first access to it, using the attribute drivers passed over
+//! by the retrieval driver after reading the label tree.
+class BinLDrivers_DeferredLoader : public TDF_DeferredLoader
+{
+  DEFINE_STANDARD_RTTIEXT(BinLDrivers_DeferredLoader, TDF_DeferredLoader)
+public:
+  //! Constructor.
+  //! @param[in] theBuffer  memory-mapped document file
+  Standard_EXPORT BinLDrivers_DeferredLoader(const occ::handle<NCollection_Buffer>& theBuffer);
+
+  //! Returns the stream reading the mapped document file.
+  Standard_IStream& Stream() { return myStream; }
+
+  //! Registers the attribute which persistent record starts at specified position of the file.
+  void Add(const occ::handle<TDF_Attribute>& theAttribute, const uint64_t thePosition)
+  {
+    myPositions.Bind(theAttribute, thePosition);
+  }
+
+  //! Sets the drivers decoding the deferred attributes.
+  //! The drivers should not be used by the retrieval driver anymore.
+  //! @param[in] theDrivers     attribute drivers with identifiers assigned from the file header
+  //! @param[in] theHeaderData  header data of the file
+  //! @param[in] theMsgDriver   messenger for reporting loading errors
+  Standard_EXPORT void Init(const occ::handle<BinMDF_ADriverTable>& theDrivers,
+                            const occ::handle<Storage_HeaderData>&  theHeaderData,
+                            const occ::handle<Message_Messenger>&   theMsgDriver);
+
+  //! Decodes content of the deferred attribute from the mapped file.
+  Standard_EXPORT bool Load(const occ::handle<TDF_Attribute>& theAttribute) override;
+
+  //! Returns the number of attributes which content has not been decoded yet.
+  int NbDeferred() const override { return myPositions.Extent(); }
+
+private:
+  occ::handle<NCollection_Buffer>                           myBuffer;
+  Standard_ArrayStreamBuffer                                myStreamBuffer;
+  std::istream                                              myStream;
+  occ::handle<BinMDF_ADriverTable>                          myDrivers;
+  BinObjMgt_RRelocationTable                                myRelocTable;
+  occ::handle<Message_Messenger>                            myMsgDriver;
+  BinObjMgt_Persistent                                      myPAtt;
+  NCollection_DataMap<occ::handle<TDF_Attribute>, uint64_t> myPositions;
+};
+
+#endif // _BinLDrivers_DeferredLoader_HeaderFile
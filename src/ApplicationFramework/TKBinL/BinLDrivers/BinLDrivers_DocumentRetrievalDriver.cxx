@@ -25,7 +25,9 @@
 #include <FSD_BinaryFile.hxx>
 #include <FSD_FileHeader.hxx>
 #include <OSD_FileSystem.hxx>
+#include <OSD_Parallel.hxx>
 #include <PCDM_ReadWriter.hxx>
+#include <Standard_ErrorHandler.hxx>
 #include <Standard_Macro.hxx>
 #include <iostream>
 #include <iomanip>
@@ -54,9 +56,24 @@ IMPLEMENT_STANDARD_RTTIEXT(BinLDrivers_DocumentRetrievalDriver, PCDM_RetrievalDr
 #define DATATYPE_MIGRATION
 
 // #define DATATYPE_MIGRATION_DEB
+
+namespace
+{
+//! Minimal length of attribute data to be pasted by parallel threads.
+static const int THE_PARALLEL_MIN_SIZE = 16384;
+//! Maximal number of attributes collected for pasting by parallel threads.
+static const int THE_PARALLEL_MAX_NB = 256;
+//! Maximal total length of data of attributes collected for pasting by parallel threads.
+static const int64_t THE_PARALLEL_MAX_SIZE = 64 * 1024 * 1024;
+} // namespace
+
 //=================================================================================================
 
 BinLDrivers_DocumentRetrievalDriver::BinLDrivers_DocumentRetrievalDriver()
+    : myPendingSize(0),
+      myDeferredMinSize(4096),
+      myToDeferLoading(false),
+      myIsParallelPaste(true)
 {
   myReaderStatus = PCDM_RS_OK;
 }
@@ -70,7 +87,28 @@ void BinLDrivers_DocumentRetrievalDriver::Read(const TCollection_ExtendedString&
                                                const Message_ProgressRange&          theRange)
 {
   const occ::handle<OSD_FileSystem>& aFileSystem = OSD_FileSystem::DefaultFileSystem();
-  std::shared_ptr<std::istream>      aFileStream =
+  if (myToDeferLoading && theFilter.IsNull())
+  {
+    // attributes content is decoded from the mapped file on demand
+    const occ::handle<NCollection_Buffer> aBuffer =
+      aFileSystem->OpenMappedBuffer(TCollection_AsciiString(theFileName));
+    if (!aBuffer.IsNull())
+    {
+      myDeferredLoader = new BinLDrivers_DeferredLoader(aBuffer);
+      Standard_IStream&         aStream = myDeferredLoader->Stream();
+      occ::handle<Storage_Data> dData;
+      PCDM_ReadWriter::FileFormat(aStream, dData);
+      Read(aStream, dData, theNewDocument, theApplication, theFilter, theRange);
+      myDeferredLoader.Nullify();
+      if (!theRange.More())
+      {
+        myReaderStatus = PCDM_RS_UserBreak;
+      }
+      return;
+    }
+  }
+
+  std::shared_ptr<std::istream> aFileStream =
     aFileSystem->OpenIStream(theFileName, std::ios::in | std::ios::binary);
 
   if (aFileStream.get() != nullptr && aFileStream->good())
@@ -156,14 +194,15 @@ void BinLDrivers_DocumentRetrievalDriver::Read(Standard_IStream&
   }
   TDocStd_FormatVersion aFileVer =
     static_cast<TDocStd_FormatVersion>(aHeaderData->StorageVersion().IntegerValue());
-  TDocStd_FormatVersion aCurrVer = TDocStd_Document::CurrentStorageFormatVersion();
+  // optional versions above the current one are readable as well
+  const int aMaxVer = TDocStd_FormatVersion_UPPER;
   // maintain one-way compatibility starting from version 2+
-  if (!CheckDocumentVersion(aFileVer, aCurrVer))
+  if (!CheckDocumentVersion(aFileVer, aMaxVer))
   {
     myReaderStatus = PCDM_RS_NoVersion;
     // file was written with another version
     myMsgDriver->Send(aMethStr + "error: wrong file version: " + aHeaderData->StorageVersion()
-                        + " while current is " + TDocStd_Document::CurrentStorageFormatVersion(),
+                        + " while maximal supported is " + aMaxVer,
                       Message_Fail);
     return;
   }
@@ -227,6 +266,8 @@ void BinLDrivers_DocumentRetrievalDriver::Read(Standard_IStream&
   myRelocTable.SetHeaderData(aHeaderData);
   mySections.Clear();
   myPAtt.Init();
+  myPendingAtts.Clear();
+  myPendingSize = 0;
   occ::handle<TDF_Data> aData =
     (!theFilter.IsNull() && theFilter->IsAppendMode()) ? aDoc->GetData() : new TDF_Data();
 
@@ -358,7 +399,16 @@ void BinLDrivers_DocumentRetrievalDriver::Read(Standard_IStream&
     myReaderStatus = PCDM_RS_UserBreak;
     return;
   }
+  pastePendingAttributes();
 
+  if (!myDeferredLoader.IsNull() && myDeferredLoader->NbDeferred() > 0)
+  {
+    // drivers are passed over to the loader together with their reading state
+    // (like shapes already read), so that the new ones are created for the next reading
+    myDeferredLoader->Init(myDrivers, aHeaderData, myMsgDriver);
+    aData->SetDeferredLoader(myDeferredLoader);
+    myDrivers = AttributeDrivers(myMsgDriver);
+  }
   Clear();
   if (!aPS.More())
   {
@@ -437,17 +487,33 @@ int BinLDrivers_DocumentRetrievalDriver::ReadSubTree(
     aSkipAttrs = true;
   }
   const auto anAttStartPosition = theIS.tellg();
+  // in deferred loading and parallel modes the header is read first to check how to read the data
+  const bool isParallel    = myIsParallelPaste && theFilter.IsNull();
+  const bool isHeaderFirst = isParallel || !myDeferredLoader.IsNull();
+  const auto readAttribute = [&]() -> Standard_IStream& {
+    return isHeaderFirst ? myPAtt.ReadHeader(theIS) : myPAtt.Read(theIS);
+  };
   // Read attributes:
-  for (theIS >> myPAtt; theIS && myPAtt.TypeId() > 0 && // not an end marker ?
+  for (readAttribute(); theIS && myPAtt.TypeId() > 0 && // not an end marker ?
                         myPAtt.Id() > 0 &&              // not a garbage ?
                         !theIS.eof();
-       theIS >> myPAtt)
+       readAttribute())
   {
     if (!aPS.More())
     {
       myReaderStatus = PCDM_RS_UserBreak;
       return -1;
     }
+    if ((!myDeferredLoader.IsNull() && deferAttribute(theIS, theLabel))
+        || (isParallel && pendAttribute(theIS, theLabel)))
+    {
+      nbRead++;
+      continue;
+    }
+    if (isHeaderFirst)
+    {
+      myPAtt.ReadData(theIS);
+    }
     if (myUnresolvedLinks.Remove(myPAtt.Id()) && aSkipAttrs)
     {
       aSkipAttrs = false;
@@ -604,6 +670,129 @@ int BinLDrivers_DocumentRetrievalDriver::ReadSubTree(
 
 //=================================================================================================
 
+bool BinLDrivers_DocumentRetrievalDriver::deferAttribute(Standard_IStream& theIS,
+                                                         const TDF_Label&  theLabel)
+{
+  const occ::handle<BinMDF_ADriver> aDriver = myDrivers->GetDriver(myPAtt.TypeId());
+  if (aDriver.IsNull() || !aDriver->IsDeferrable()
+      || (!myPAtt.IsDirect() && myPAtt.Length() < myDeferredMinSize)
+      || myRelocTable.IsBound(myPAtt.Id()))
+  {
+    return false;
+  }
+
+  const std::streampos       aDataPos = theIS.tellg();
+  occ::handle<TDF_Attribute> anAtt    = aDriver->NewEmpty();
+  if (!aDriver->ReadDeferredID(theIS, myPAtt.Length(), anAtt, myRelocTable)
+      || theLabel.IsAttribute(anAtt->ID()))
+  {
+    // let the attribute be read as usual to report the problem
+    theIS.clear();
+    theIS.seekg(aDataPos);
+    return false;
+  }
+  theLabel.AddAttribute(anAtt);
+
+  // skip the data
+  theIS.seekg(aDataPos + std::streamoff(myPAtt.Length()));
+  if (myPAtt.IsDirect()) // skip direct written stream
+  {
+    uint64_t aStreamSize = 0;
+    theIS.read((char*)&aStreamSize, sizeof(uint64_t));
+    aStreamSize -= sizeof(uint64_t); // size is already passed, so, reduce it by size
+    theIS.seekg(aStreamSize, std::ios_base::cur);
+  }
+
+  anAtt->SetDeferred(true);
+  myDeferredLoader->Add(anAtt, uint64_t(aDataPos) - BP_HEADSIZE);
+  myRelocTable.Bind(myPAtt.Id(), anAtt);
+  return true;
+}
+
+//=================================================================================================
+
+bool BinLDrivers_DocumentRetrievalDriver::pendAttribute(Standard_IStream& theIS,
+                                                        const TDF_Label&  theLabel)
+{
+  const occ::handle<BinMDF_ADriver> aDriver = myDrivers->GetDriver(myPAtt.TypeId());
+  if (aDriver.IsNull() || !aDriver->IsParallelPaste() || myPAtt.IsDirect()
+      || myPAtt.Length() < THE_PARALLEL_MIN_SIZE || myRelocTable.IsBound(myPAtt.Id()))
+  {
+    return false;
+  }
+
+  // re-read the whole record into its own persistent
+  PendingAttribute aPending;
+  aPending.Data = std::make_shared<BinObjMgt_Persistent>();
+  theIS.seekg(-std::streamoff(BP_HEADSIZE), std::ios_base::cur);
+  theIS >> *aPending.Data;
+  aPending.Driver    = aDriver;
+  aPending.Attribute = aDriver->NewEmpty();
+
+  // attribute of the same type with not yet pasted user defined GUID might be already attached;
+  // temporary GUID unique within the document is replaced by the actual one on pasting
+  if (theLabel.IsAttribute(aPending.Attribute->ID()))
+  {
+    aPending.Attribute->SetID(
+      Standard_GUID(myPAtt.Id(), 0x5a3c, 0x4b1e, 0x9d27, 0x8f, 0x41, 0x6e, 0x0b, 0xc2, 0x73));
+  }
+  theLabel.AddAttribute(aPending.Attribute);
+  myRelocTable.Bind(myPAtt.Id(), aPending.Attribute);
+  myPendingAtts.Append(aPending);
+  myPendingSize += myPAtt.Length();
+  if (myPendingAtts.Length() >= THE_PARALLEL_MAX_NB || myPendingSize >= THE_PARALLEL_MAX_SIZE)
+  {
+    pastePendingAttributes();
+  }
+  return true;
+}
+
+//=================================================================================================
+
+void BinLDrivers_DocumentRetrievalDriver::pastePendingAttributes()
+{
+  if (myPendingAtts.IsEmpty())
+  {
+    return;
+  }
+
+  OSD_Parallel::For(
+    0,
+    myPendingAtts.Length(),
+    [this](const int theIndex) {
+      PendingAttribute& aPending = myPendingAtts.ChangeValue(theIndex);
+      try
+      {
+        OCC_CATCH_SIGNALS
+        aPending.IsPasted =
+          aPending.Driver->Paste(*aPending.Data, aPending.Attribute, myRelocTable);
+      }
+      catch (Standard_Failure const&)
+      {
+        aPending.IsPasted = false;
+      }
+      aPending.Data.reset(); // free buffer
+    },
+    myPendingAtts.Length() < 2);
+
+  const TCollection_ExtendedString aMethStr("BinLDrivers_DocumentRetrievalDriver: ");
+  for (NCollection_Vector<PendingAttribute>::Iterator anIter(myPendingAtts); anIter.More();
+       anIter.Next())
+  {
+    if (!anIter.Value().IsPasted)
+    {
+      // error converting persistent to transient
+      myMsgDriver->Send(aMethStr + "warning: failure reading attribute "
+                          + anIter.Value().Driver->TypeName(),
+                        Message_Warning);
+    }
+  }
+  myPendingAtts.Clear();
+  myPendingSize = 0;
+}
+
+//=================================================================================================
+
 occ::handle<BinMDF_ADriverTable> BinLDrivers_DocumentRetrievalDriver::AttributeDrivers(
   const occ::handle<Message_Messenger>& theMessageDriver)
 {
@@ -662,6 +851,8 @@ void BinLDrivers_DocumentRetrievalDriver::CheckShapeSection(const Storage_Positi
 void BinLDrivers_DocumentRetrievalDriver::Clear()
 {
   myPAtt.Destroy(); // free buffer
+  myPendingAtts.Clear();
+  myPendingSize = 0;
   myRelocTable.Clear();
   myMapUnsupported.Clear();
 }
@@ -683,5 +874,7 @@ bool BinLDrivers_DocumentRetrievalDriver::CheckDocumentVersion(const int theFile
 
 bool BinLDrivers_DocumentRetrievalDriver::IsQuickPart(const int theFileVer)
 {
-  return theFileVer >= TDocStd_FormatVersion_VERSION_12;
+  // version 13 stores shapes within compressed shape section
+  return theFileVer >= TDocStd_FormatVersion_VERSION_12
+         && theFileVer != TDocStd_FormatVersion_VERSION_13;
 }
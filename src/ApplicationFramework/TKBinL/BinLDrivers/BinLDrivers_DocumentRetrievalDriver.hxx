@@ -18,6 +18,8 @@
 
 #include <Standard.hxx>
 
+#include <BinLDrivers_DeferredLoader.hxx>
+#include <BinMDF_ADriver.hxx>
 #include <BinObjMgt_Persistent.hxx>
 #include <BinObjMgt_RRelocationTable.hxx>
 #include <Standard_Integer.hxx>
@@ -29,6 +31,8 @@
 #include <Storage_Position.hxx>
 #include <Storage_Data.hxx>
 
+#include <memory>
+
 class BinMDF_ADriverTable;
 class Message_Messenger;
 class TCollection_ExtendedString;
@@ -63,6 +67,34 @@ public:
   Standard_EXPORT virtual occ::handle<BinMDF_ADriverTable> AttributeDrivers(
     const occ::handle<Message_Messenger>& theMsgDriver);
 
+  //! Returns TRUE if large attributes supported by drivers with BinMDF_ADriver::IsParallelPaste()
+  //! are decoded by parallel threads; TRUE by default.
+  bool IsParallelPaste() const { return myIsParallelPaste; }
+
+  //! Enables decoding of large attributes by parallel threads.
+  //! The attributes are collected while reading the label tree and pasted by portions,
+  //! other attributes (including ones referring other attributes) are pasted immediately.
+  //! Attributes are decoded sequentially when reader filter is used.
+  void SetParallelPaste(const bool theToParallel) { myIsParallelPaste = theToParallel; }
+
+  //! Returns TRUE if deferred loading of attributes content is enabled; FALSE by default.
+  bool IsDeferredLoading() const { return myToDeferLoading; }
+
+  //! Enables deferred loading of attributes content on reading the document from file.
+  //! The file is mapped into memory and the label tree is read immediately, while decoding
+  //! of large attributes supported by deferrable drivers (see BinMDF_ADriver::IsDeferrable())
+  //! is postponed until the first access to the attribute by TDF_Label::FindAttribute().
+  //! The document is read as usual when the file cannot be mapped or reader filter is used.
+  void SetDeferredLoading(const bool theToDefer) { myToDeferLoading = theToDefer; }
+
+  //! Returns minimal length of attribute data in bytes to defer its decoding; 4096 by default.
+  int DeferredMinSize() const { return myDeferredMinSize; }
+
+  //! Sets minimal length of attribute data in bytes to defer its decoding.
+  //! Attributes with data written directly to the stream (like shapes of the document
+  //! in quick part access format) are deferred regardless of their size.
+  void SetDeferredMinSize(const int theSize) { myDeferredMinSize = theSize; }
+
   DEFINE_STANDARD_RTTIEXT(BinLDrivers_DocumentRetrievalDriver, PCDM_RetrievalDriver)
 
 protected:
@@ -116,11 +148,42 @@ protected:
   BinObjMgt_RRelocationTable       myRelocTable;
   occ::handle<Message_Messenger>   myMsgDriver;
 
+private:
+  //! Attaches empty attribute to the label and registers it within deferred loader
+  //! if decoding of the attribute which header has been read to myPAtt may be deferred.
+  //! In this case the stream is moved to the end of the attribute data.
+  //! @return FALSE if the attribute should be read as usual
+  bool deferAttribute(Standard_IStream& theIS, const TDF_Label& theLabel);
+
+  //! Reads the data of the attribute which header has been read to myPAtt
+  //! and adds it to the attributes to be pasted by parallel threads if applicable.
+  //! @return FALSE if the attribute should be read as usual
+  bool pendAttribute(Standard_IStream& theIS, const TDF_Label& theLabel);
+
+  //! Pastes collected attributes by parallel threads.
+  void pastePendingAttributes();
+
+private:
+  //! Attribute which persistent data is pasted by parallel threads.
+  struct PendingAttribute
+  {
+    std::shared_ptr<BinObjMgt_Persistent> Data;      //!< persistent data of the attribute
+    occ::handle<BinMDF_ADriver>           Driver;    //!< attribute driver
+    occ::handle<TDF_Attribute>            Attribute; //!< transient attribute
+    bool                                  IsPasted = false; //!< result of pasting
+  };
+
 private:
   BinObjMgt_Persistent                            myPAtt;
   NCollection_Map<int>                            myMapUnsupported;
   NCollection_Vector<BinLDrivers_DocumentSection> mySections;
   NCollection_Map<int>                            myUnresolvedLinks;
+  occ::handle<BinLDrivers_DeferredLoader>         myDeferredLoader;
+  NCollection_Vector<PendingAttribute>            myPendingAtts;
+  int64_t                                         myPendingSize;
+  int                                             myDeferredMinSize;
+  bool                                            myToDeferLoading;
+  bool                                            myIsParallelPaste;
 };
 
 #endif // _BinLDrivers_DocumentRetrievalDriver_HeaderFile
@@ -42,6 +42,24 @@ IMPLEMENT_STANDARD_RTTIEXT(BinLDrivers_DocumentStorageDriver, PCDM_StorageDriver
 #define SHAPESECTION_POS (const char*)"SHAPE_SECTION_POS:"
 #define ENDSECTION_POS (const char*)":"
 
+namespace
+{
+//! Returns the version of format to store the document.
+//! The version with compressed shape section is replaced by the current one
+//! when OCCT is built without Zstandard.
+static TDocStd_FormatVersion storageVersion(const occ::handle<TDocStd_Document>& theDoc)
+{
+  const TDocStd_FormatVersion aVersion = theDoc->StorageFormatVersion();
+#ifndef HAVE_ZSTD
+  if (aVersion >= TDocStd_FormatVersion_VERSION_13)
+  {
+    return TDocStd_FormatVersion_CURRENT;
+  }
+#endif
+  return aVersion;
+}
+} // namespace
+
 //=================================================================================================
 
 BinLDrivers_DocumentStorageDriver::BinLDrivers_DocumentStorageDriver() = default;
@@ -57,6 +75,11 @@ void BinLDrivers_DocumentStorageDriver::Write(const occ::handle<CDM_Document>&
 
   myFileName = theFileName;
 
+  // deferred attributes might be loaded from the file to be overwritten
+  occ::handle<TDocStd_Document> aDoc = occ::down_cast<TDocStd_Document>(theDocument);
+  if (!aDoc.IsNull())
+    aDoc->GetData()->LoadDeferredAttributes();
+
   const occ::handle<OSD_FileSystem>& aFileSystem = OSD_FileSystem::DefaultFileSystem();
   std::shared_ptr<std::ostream>      aFileStream =
     aFileSystem->OpenOStream(theFileName, std::ios::out | std::ios::binary);
@@ -90,10 +113,19 @@ void BinLDrivers_DocumentStorageDriver::Write(const occ::handle<CDM_Document>& t
   }
   else
   {
+    if (storageVersion(aDoc) != aDoc->StorageFormatVersion())
+    {
+      myMsgDriver->Send("BinLDrivers_DocumentStorageDriver, compressed shape section requires "
+                        "Zstandard, the current version of format is used",
+                        Message_Warning);
+    }
+
     // First pass: collect empty labels, assign IDs to the types
     if (myDrivers.IsNull())
       myDrivers = AttributeDrivers(myMsgDriver);
     occ::handle<TDF_Data> aData = aDoc->GetData();
+    // attributes are enumerated by TDF_AttributeIterator not loading deferred content
+    aData->LoadDeferredAttributes();
     FirstPass(aData->Root());
     if (aDoc->EmptyLabelsSavingMode())
       myEmptyLabels.Clear(); //
@@ -109,7 +141,7 @@ void BinLDrivers_DocumentStorageDriver::Write(const occ::handle<CDM_Document>& t
     }
 
     //  2. Write the Table of Contents of Sections
-    const TDocStd_FormatVersion aDocVer = aDoc->StorageFormatVersion();
+    const TDocStd_FormatVersion aDocVer = storageVersion(aDoc);
     NCollection_Vector<BinLDrivers_DocumentSection>::Iterator anIterS(mySections);
     for (; anIterS.More(); anIterS.Next())
       anIterS.ChangeValue().WriteTOC(theOStream, aDocVer);
@@ -483,7 +515,7 @@ void BinLDrivers_DocumentStorageDriver::WriteInfoSection(const occ::handle<CDM_D
   theData->SetApplicationName(theDoc->Application()->Name());
 
   occ::handle<TDocStd_Document> aDoc    = occ::down_cast<TDocStd_Document>(theDoc);
-  const int                     aDocVer = aDoc->StorageFormatVersion();
+  const int                     aDocVer = storageVersion(aDoc);
   aHeader.einfo += FSD_BinaryFile::WriteInfo(theOStream,
                                              aObjNb,
                                              aDocVer,
@@ -568,7 +600,9 @@ void BinLDrivers_DocumentStorageDriver::WriteShapeSection(BinLDrivers_DocumentSe
 //=======================================================================
 bool BinLDrivers_DocumentStorageDriver::IsQuickPart(const int theVersion) const
 {
-  return theVersion >= TDocStd_FormatVersion_VERSION_12;
+  // version 13 stores shapes within compressed shape section
+  return theVersion >= TDocStd_FormatVersion_VERSION_12
+         && theVersion != TDocStd_FormatVersion_VERSION_13;
 }
 
 //=================================================================================================
@@ -4,6 +4,8 @@ set(OCCT_BinLDrivers_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
 set(OCCT_BinLDrivers_FILES
   BinLDrivers.cxx
   BinLDrivers.hxx
+  BinLDrivers_DeferredLoader.cxx
+  BinLDrivers_DeferredLoader.hxx
   BinLDrivers_DocumentRetrievalDriver.cxx
   BinLDrivers_DocumentRetrievalDriver.hxx
   BinLDrivers_DocumentSection.cxx
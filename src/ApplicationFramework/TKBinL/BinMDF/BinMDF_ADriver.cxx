@@ -33,3 +33,13 @@ const occ::handle<Standard_Type>& BinMDF_ADriver::SourceType() const
 {
   return NewEmpty()->DynamicType();
 }
+
+//=================================================================================================
+
+bool BinMDF_ADriver::ReadDeferredID(Standard_IStream&,
+                                    const int,
+                                    const occ::handle<TDF_Attribute>&,
+                                    BinObjMgt_RRelocationTable&) const
+{
+  return true;
+}
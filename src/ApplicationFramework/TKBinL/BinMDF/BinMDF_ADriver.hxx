@@ -21,6 +21,7 @@
 #include <Standard_Transient.hxx>
 #include <BinObjMgt_RRelocationTable.hxx>
 #include <NCollection_IndexedMap.hxx>
+#include <Standard_IStream.hxx>
 class Message_Messenger;
 class TDF_Attribute;
 class BinObjMgt_Persistent;
@@ -55,6 +56,33 @@ public:
     BinObjMgt_Persistent&                                    aTarget,
     NCollection_IndexedMap<occ::handle<Standard_Transient>>& aRelocTable) const = 0;
 
+  //! Returns TRUE if Paste() of persistent data into the transient attribute may be called
+  //! concurrently for different attributes during document retrieval.
+  //! Such driver should neither refer other attributes nor modify the relocation table,
+  //! and the target attribute might be not attached to the label yet.
+  //! The default implementation returns FALSE.
+  virtual bool IsParallelPaste() const { return false; }
+
+  //! Returns TRUE if decoding of the attribute content may be deferred until the first access
+  //! to the attribute (see BinLDrivers_DocumentRetrievalDriver::SetDeferredLoading()).
+  //! Such attribute should not be referred by other attributes within persistent data.
+  //! The default implementation returns FALSE.
+  virtual bool IsDeferrable() const { return false; }
+
+  //! Restores the identity (GUID) of the attribute which content decoding is deferred.
+  //! @param[in] theIS          stream positioned at the beginning of persistent data,
+  //!                           might be left at any position within the data
+  //! @param[in] theDataLength  length of persistent data in bytes
+  //! @param[in] theTarget      empty attribute attached to the label
+  //! @param[in] theRelocTable  relocation table
+  //! @return FALSE on reading error
+  //! The default implementation does nothing, which is suitable for attributes with fixed GUID.
+  Standard_EXPORT virtual bool ReadDeferredID(
+    Standard_IStream&                 theIS,
+    const int                         theDataLength,
+    const occ::handle<TDF_Attribute>& theTarget,
+    BinObjMgt_RRelocationTable&       theRelocTable) const;
+
   //! Returns the current message driver of this driver
   const occ::handle<Message_Messenger>& MessageDriver() const { return myMessageDriver; }
 
@@ -37,6 +37,7 @@
 #include <BinMDataStd_UAttributeDriver.hxx>
 #include <BinMDataStd_VariableDriver.hxx>
 #include <BinMDF_ADriverTable.hxx>
+#include <FSD_BinaryFile.hxx>
 #include <Message_Messenger.hxx>
 
 //=================================================================================================
@@ -67,3 +68,28 @@ void BinMDataStd::AddDrivers(const occ::handle<BinMDF_ADriverTable>& theDriverTa
   theDriverTable->AddDriver(new BinMDataStd_AsciiStringDriver(theMsgDriver));
   theDriverTable->AddDriver(new BinMDataStd_IntPackedMapDriver(theMsgDriver));
 }
+
+//=================================================================================================
+
+bool BinMDataStd::ReadArrayID(Standard_IStream& theIS,
+                              const int         theDataLength,
+                              const int         theItemSize,
+                              Standard_GUID&    theGuid)
+{
+  int aBounds[2] = {0, 0};
+  if (!theIS.read((char*)aBounds, sizeof(aBounds)))
+    return false;
+#ifdef DO_INVERSE
+  aBounds[0] = FSD_BinaryFile::InverseInt(aBounds[0]);
+  aBounds[1] = FSD_BinaryFile::InverseInt(aBounds[1]);
+#endif
+  // bounds, items and delta flag; GUID is aligned to 4 bytes and occupies 16 bytes
+  const int64_t aLengthNoGuid =
+    int64_t(sizeof(aBounds)) + (int64_t(aBounds[1]) - aBounds[0] + 1) * theItemSize + 1;
+  const int aGuidSize = 16;
+  if (theDataLength < aLengthNoGuid + aGuidSize)
+    return true;
+
+  theIS.seekg(theDataLength - int(sizeof(aBounds)) - aGuidSize, std::ios_base::cur);
+  return BinObjMgt_Persistent::ReadGUID(theIS, theGuid);
+}
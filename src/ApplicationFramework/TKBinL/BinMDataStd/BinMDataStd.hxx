@@ -61,6 +61,36 @@ public:
     else
       anAtt->SetID(T::GetID());
   }
+
+  //! Restores user defined GUID of the array attribute which content decoding is deferred
+  //! (see BinMDF_ADriver::ReadDeferredID()).
+  //! @param[in] theItemSize  size of the array item in bytes
+  template <class T>
+  static bool SetDeferredArrayID(Standard_IStream&     theIS,
+                                 const int             theDataLength,
+                                 const int             theItemSize,
+                                 const occ::handle<T>& anAtt,
+                                 const int             aDocFormatVersion)
+  {
+    Standard_GUID aGuid = T::GetID();
+    if (aDocFormatVersion >= TDocStd_FormatVersion_VERSION_10
+        && !ReadArrayID(theIS, theDataLength, theItemSize, aGuid))
+      return false;
+    anAtt->SetID(aGuid);
+    return true;
+  }
+
+  //! Reads user defined GUID stored after array bounds, items and delta flag
+  //! within persistent data of array attribute.
+  //! @param[in] theIS          stream positioned at the beginning of persistent data
+  //! @param[in] theDataLength  length of persistent data in bytes
+  //! @param[in] theItemSize    size of the array item in bytes
+  //! @param[in][out] theGuid   GUID to be replaced by user defined one if stored
+  //! @return FALSE on reading error
+  Standard_EXPORT static bool ReadArrayID(Standard_IStream& theIS,
+                                          const int         theDataLength,
+                                          const int         theItemSize,
+                                          Standard_GUID&    theGuid);
 };
 
 #endif // _BinMDataStd_HeaderFile
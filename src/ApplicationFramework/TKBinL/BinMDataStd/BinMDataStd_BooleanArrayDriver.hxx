@@ -44,6 +44,9 @@ public:
     BinObjMgt_Persistent&                                    Target,
     NCollection_IndexedMap<occ::handle<Standard_Transient>>& RelocTable) const override;
 
+  //! Returns TRUE: the array is decoded independently of other attributes.
+  bool IsParallelPaste() const override { return true; }
+
   DEFINE_STANDARD_RTTIEXT(BinMDataStd_BooleanArrayDriver, BinMDF_ADriver)
 };
 
@@ -114,3 +114,19 @@ void BinMDataStd_ByteArrayDriver::Paste(
   if (anAtt->ID() != TDataStd_ByteArray::GetID())
     theTarget << anAtt->ID();
 }
+
+//=================================================================================================
+
+bool BinMDataStd_ByteArrayDriver::ReadDeferredID(
+  Standard_IStream&                 theIS,
+  const int                         theDataLength,
+  const occ::handle<TDF_Attribute>& theTarget,
+  BinObjMgt_RRelocationTable&       theRelocTable) const
+{
+  return BinMDataStd::SetDeferredArrayID(
+    theIS,
+    theDataLength,
+    (int)sizeof(uint8_t),
+    occ::down_cast<TDataStd_ByteArray>(theTarget),
+    theRelocTable.GetHeaderData()->StorageVersion().IntegerValue());
+}
@@ -46,6 +46,9 @@ public:
     BinObjMgt_Persistent&                                    Target,
     NCollection_IndexedMap<occ::handle<Standard_Transient>>& RelocTable) const override;
 
+  //! Returns TRUE: the array is decoded independently of other attributes.
+  bool IsParallelPaste() const override { return true; }
+
   DEFINE_STANDARD_RTTIEXT(BinMDataStd_ExtStringArrayDriver, BinMDF_ADriver)
 };
 
@@ -48,6 +48,9 @@ public:
     BinObjMgt_Persistent&                                    Target,
     NCollection_IndexedMap<occ::handle<Standard_Transient>>& RelocTable) const override;
 
+  //! Returns TRUE: the map is decoded independently of other attributes.
+  bool IsParallelPaste() const override { return true; }
+
   DEFINE_STANDARD_RTTIEXT(BinMDataStd_IntPackedMapDriver, BinMDF_ADriver)
 };
 
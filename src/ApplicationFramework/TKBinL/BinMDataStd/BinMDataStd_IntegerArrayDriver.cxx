@@ -106,3 +106,19 @@ void BinMDataStd_IntegerArrayDriver::Paste(
   if (anAtt->ID() != TDataStd_IntegerArray::GetID())
     theTarget << anAtt->ID();
 }
+
+//=================================================================================================
+
+bool BinMDataStd_IntegerArrayDriver::ReadDeferredID(
+  Standard_IStream&                 theIS,
+  const int                         theDataLength,
+  const occ::handle<TDF_Attribute>& theTarget,
+  BinObjMgt_RRelocationTable&       theRelocTable) const
+{
+  return BinMDataStd::SetDeferredArrayID(
+    theIS,
+    theDataLength,
+    (int)sizeof(int),
+    occ::down_cast<TDataStd_IntegerArray>(theTarget),
+    theRelocTable.GetHeaderData()->StorageVersion().IntegerValue());
+}
@@ -46,6 +46,19 @@ public:
     BinObjMgt_Persistent&                                    Target,
     NCollection_IndexedMap<occ::handle<Standard_Transient>>& RelocTable) const override;
 
+  //! Returns TRUE: the array is decoded independently of other attributes.
+  bool IsParallelPaste() const override { return true; }
+
+  //! Returns TRUE: decoding of the array may be deferred until the first access.
+  bool IsDeferrable() const override { return true; }
+
+  //! Restores user defined GUID of the array which content decoding is deferred.
+  Standard_EXPORT bool ReadDeferredID(
+    Standard_IStream&                 theIS,
+    const int                         theDataLength,
+    const occ::handle<TDF_Attribute>& theTarget,
+    BinObjMgt_RRelocationTable&       theRelocTable) const override;
+
   DEFINE_STANDARD_RTTIEXT(BinMDataStd_IntegerArrayDriver, BinMDF_ADriver)
 };
 
@@ -101,3 +101,19 @@ void BinMDataStd_RealArrayDriver::Paste(
   if (anAtt->ID() != TDataStd_RealArray::GetID())
     theTarget << anAtt->ID();
 }
+
+//=================================================================================================
+
+bool BinMDataStd_RealArrayDriver::ReadDeferredID(
+  Standard_IStream&                 theIS,
+  const int                         theDataLength,
+  const occ::handle<TDF_Attribute>& theTarget,
+  BinObjMgt_RRelocationTable&       theRelocTable) const
+{
+  return BinMDataStd::SetDeferredArrayID(
+    theIS,
+    theDataLength,
+    (int)sizeof(double),
+    occ::down_cast<TDataStd_RealArray>(theTarget),
+    theRelocTable.GetHeaderData()->StorageVersion().IntegerValue());
+}
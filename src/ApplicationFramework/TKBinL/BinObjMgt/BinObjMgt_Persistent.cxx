@@ -39,6 +39,26 @@ typedef struct
   unsigned char  Data4[8]; // 8-bytes long on all OS
 } BinObjMgt_UUID;
 
+//! Converts persistent UUID into GUID.
+static Standard_GUID uuidToGUID(BinObjMgt_UUID& theUUID)
+{
+#ifdef DO_INVERSE
+  theUUID.Data1 = (unsigned int)InverseInt(theUUID.Data1);
+  theUUID.Data2 = (unsigned short)InverseExtChar(theUUID.Data2);
+  theUUID.Data3 = (unsigned short)InverseExtChar(theUUID.Data3);
+#endif
+  return Standard_GUID(theUUID.Data1,
+                       theUUID.Data2,
+                       theUUID.Data3,
+                       ((theUUID.Data4[0] << 8) | (theUUID.Data4[1])),
+                       theUUID.Data4[2],
+                       theUUID.Data4[3],
+                       theUUID.Data4[4],
+                       theUUID.Data4[5],
+                       theUUID.Data4[6],
+                       theUUID.Data4[7]);
+}
+
 //=================================================================================================
 
 BinObjMgt_Persistent::BinObjMgt_Persistent()
@@ -122,6 +142,14 @@ Standard_OStream& BinObjMgt_Persistent::Write(Standard_OStream& theOS, const boo
 //=======================================================================
 
 Standard_IStream& BinObjMgt_Persistent::Read(Standard_IStream& theIS)
+{
+  ReadHeader(theIS);
+  return ReadData(theIS);
+}
+
+//=================================================================================================
+
+Standard_IStream& BinObjMgt_Persistent::ReadHeader(Standard_IStream& theIS)
 {
   myIndex   = 1;
   myOffset  = BP_HEADSIZE;
@@ -150,37 +178,42 @@ Standard_IStream& BinObjMgt_Persistent::Read(Standard_IStream& theIS)
     if (myDirectWritingIsEnabled)
       aData[1] = -aData[1];
     if (theIS && aData[2] > 0)
-    {
       mySize += aData[2];
-      // read remaining data
-      int nbRead = BP_HEADSIZE;
-      for (int i = 1; theIS && nbRead < mySize; i++)
-      {
-        if (i > myData.Length())
-        {
-          // grow myData dynamically
-          void* aPiece = Standard::Allocate(BP_PIECESIZE);
-          myData.Append(aPiece);
-        }
-        int   nbToRead = std::min(mySize - nbRead, BP_PIECESIZE);
-        char* ptr      = (char*)myData(i);
-        if (i == 1)
-        {
-          // 1st piece: reduce the number of bytes by header size
-          ptr += BP_HEADSIZE;
-          if (nbToRead == BP_PIECESIZE)
-            nbToRead -= BP_HEADSIZE;
-        }
-        theIS.read(ptr, nbToRead);
-        nbRead += nbToRead;
-      }
-    }
     else
       aData[2] = 0;
   }
   return theIS;
 }
 
+//=================================================================================================
+
+Standard_IStream& BinObjMgt_Persistent::ReadData(Standard_IStream& theIS)
+{
+  // read remaining data
+  int nbRead = BP_HEADSIZE;
+  for (int i = 1; theIS && nbRead < mySize; i++)
+  {
+    if (i > myData.Length())
+    {
+      // grow myData dynamically
+      void* aPiece = Standard::Allocate(BP_PIECESIZE);
+      myData.Append(aPiece);
+    }
+    int   nbToRead = std::min(mySize - nbRead, BP_PIECESIZE);
+    char* ptr      = (char*)myData(i);
+    if (i == 1)
+    {
+      // 1st piece: reduce the number of bytes by header size
+      ptr += BP_HEADSIZE;
+      if (nbToRead == BP_PIECESIZE)
+        nbToRead -= BP_HEADSIZE;
+    }
+    theIS.read(ptr, nbToRead);
+    nbRead += nbToRead;
+  }
+  return theIS;
+}
+
 //=======================================================================
 // function : Destroy
 // purpose  : Frees the allocated memory
@@ -808,24 +841,23 @@ const BinObjMgt_Persistent& BinObjMgt_Persistent::GetGUID(Standard_GUID& theValu
     return *this;
   BinObjMgt_UUID anUUID;
   getArray(&anUUID, BP_UUIDSIZE);
-#ifdef DO_INVERSE
-  anUUID.Data1 = (unsigned int)InverseInt(anUUID.Data1);
-  anUUID.Data2 = (unsigned short)InverseExtChar(anUUID.Data2);
-  anUUID.Data3 = (unsigned short)InverseExtChar(anUUID.Data3);
-#endif
-  theValue = Standard_GUID(anUUID.Data1,
-                           anUUID.Data2,
-                           anUUID.Data3,
-                           ((anUUID.Data4[0] << 8) | (anUUID.Data4[1])),
-                           anUUID.Data4[2],
-                           anUUID.Data4[3],
-                           anUUID.Data4[4],
-                           anUUID.Data4[5],
-                           anUUID.Data4[6],
-                           anUUID.Data4[7]);
+  theValue = uuidToGUID(anUUID);
   return *this;
 }
 
+//=================================================================================================
+
+bool BinObjMgt_Persistent::ReadGUID(Standard_IStream& theIS, Standard_GUID& theValue)
+{
+  BinObjMgt_UUID anUUID;
+  if (!theIS.read((char*)&anUUID, BP_UUIDSIZE))
+  {
+    return false;
+  }
+  theValue = uuidToGUID(anUUID);
+  return true;
+}
+
 //=======================================================================
 // function : GetCharArray
 // purpose  : Get C array of char, theLength is the number of elements;
@@ -279,6 +279,18 @@ public:
   //! BinObjMgt_Persistent&) is also available
   Standard_EXPORT Standard_IStream& Read(Standard_IStream& theIS);
 
+  //! Retrieves only the header of <me> (type id, object id and data length) from the stream,
+  //! which is left at the beginning of the object data.
+  //! The data should be then retrieved by ReadData() or skipped by Length() bytes.
+  Standard_EXPORT Standard_IStream& ReadHeader(Standard_IStream& theIS);
+
+  //! Retrieves the data of <me> which header has been retrieved by ReadHeader().
+  Standard_EXPORT Standard_IStream& ReadData(Standard_IStream& theIS);
+
+  //! Reads GUID stored by PutGUID() directly from the stream.
+  //! @return FALSE on reading error
+  Standard_EXPORT static bool ReadGUID(Standard_IStream& theIS, Standard_GUID& theValue);
+
   //! Frees the allocated memory;
   //! This object can be reused after call to Init
   Standard_EXPORT void Destroy();
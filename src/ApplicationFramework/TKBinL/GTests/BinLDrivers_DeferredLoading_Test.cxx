@@ -0,0 +1,144 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BinLDrivers.hxx>
+#include <BinLDrivers_DocumentRetrievalDriver.hxx>
+#include <TDataStd_ByteArray.hxx>
+#include <TDataStd_IntegerArray.hxx>
+#include <TDataStd_RealArray.hxx>
+#include <TDF_AttributeIterator.hxx>
+#include <TDF_Data.hxx>
+#include <TDocStd_Application.hxx>
+#include <TDocStd_Document.hxx>
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+
+namespace
+{
+const int THE_NB_ITEMS = 10000;
+
+//! Creates application with Lite binary format.
+occ::handle<TDocStd_Application> createApplication(const bool theToDefer)
+{
+  occ::handle<TDocStd_Application> anApp = new TDocStd_Application();
+  BinLDrivers::DefineFormat(anApp);
+  occ::handle<BinLDrivers_DocumentRetrievalDriver> aDriver =
+    occ::down_cast<BinLDrivers_DocumentRetrievalDriver>(anApp->ReaderFromFormat("BinLOcaf"));
+  aDriver->SetDeferredLoading(theToDefer);
+  return anApp;
+}
+
+//! Returns the number of deferred attributes on the label.
+int nbDeferred(const TDF_Label& theLabel)
+{
+  int aNbDeferred = 0;
+  for (TDF_AttributeIterator anAttIter(theLabel); anAttIter.More(); anAttIter.Next())
+  {
+    aNbDeferred += anAttIter.Value()->IsDeferred() ? 1 : 0;
+  }
+  return aNbDeferred;
+}
+
+//! Checks content of the arrays stored by the test.
+void checkArrays(const TDF_Label& theMain, const Standard_GUID& theUserGuid)
+{
+  occ::handle<TDataStd_RealArray>    aReals;
+  occ::handle<TDataStd_IntegerArray> anInts, anUserInts;
+  occ::handle<TDataStd_ByteArray>    aBytes;
+  ASSERT_TRUE(theMain.FindChild(1).FindAttribute(TDataStd_RealArray::GetID(), aReals));
+  ASSERT_TRUE(theMain.FindChild(1).FindAttribute(TDataStd_IntegerArray::GetID(), anInts));
+  ASSERT_TRUE(theMain.FindChild(1).FindAttribute(theUserGuid, anUserInts));
+  ASSERT_TRUE(theMain.FindChild(2).FindAttribute(TDataStd_ByteArray::GetID(), aBytes));
+  ASSERT_EQ(THE_NB_ITEMS, aReals->Length());
+  ASSERT_EQ(THE_NB_ITEMS, anInts->Length());
+  ASSERT_EQ(THE_NB_ITEMS, anUserInts->Length());
+  ASSERT_EQ(THE_NB_ITEMS, aBytes->Length());
+  for (int anIter = 1; anIter <= THE_NB_ITEMS; ++anIter)
+  {
+    ASSERT_EQ(0.5 * anIter, aReals->Value(anIter));
+    ASSERT_EQ(anIter, anInts->Value(anIter));
+    ASSERT_EQ(-anIter, anUserInts->Value(anIter));
+    ASSERT_EQ(uint8_t(anIter), aBytes->Value(anIter));
+  }
+}
+} // namespace
+
+TEST(BinLDrivers_DeferredLoading_Test, LoadOnAccess)
+{
+  const TCollection_ExtendedString aFileName("BinLDrivers_DeferredLoading_Test.cbfl");
+  const Standard_GUID              aUserGuid("3a4e3f1c-2d3b-4c5a-9b8e-7f6d5c4b3a29");
+  {
+    occ::handle<TDocStd_Application> anApp = createApplication(false);
+    occ::handle<TDocStd_Document>    aDoc;
+    anApp->NewDocument("BinLOcaf", aDoc);
+    ASSERT_FALSE(aDoc.IsNull());
+    const TDF_Label                    aLab1  = aDoc->Main().FindChild(1);
+    occ::handle<TDataStd_RealArray>    aReals = TDataStd_RealArray::Set(aLab1, 1, THE_NB_ITEMS);
+    occ::handle<TDataStd_IntegerArray> anInts = TDataStd_IntegerArray::Set(aLab1, 1, THE_NB_ITEMS);
+    occ::handle<TDataStd_IntegerArray> anUserInts =
+      TDataStd_IntegerArray::Set(aLab1, aUserGuid, 1, THE_NB_ITEMS);
+    occ::handle<TDataStd_ByteArray> aBytes =
+      TDataStd_ByteArray::Set(aDoc->Main().FindChild(2), 1, THE_NB_ITEMS);
+    for (int anIter = 1; anIter <= THE_NB_ITEMS; ++anIter)
+    {
+      aReals->SetValue(anIter, 0.5 * anIter);
+      anInts->SetValue(anIter, anIter);
+      anUserInts->SetValue(anIter, -anIter);
+      aBytes->SetValue(anIter, uint8_t(anIter));
+    }
+    // small array is read immediately
+    TDataStd_RealArray::Set(aDoc->Main().FindChild(3), 1, 3)->SetValue(2, 2.0);
+    ASSERT_EQ(PCDM_SS_OK, anApp->SaveAs(aDoc, aFileName));
+    anApp->Close(aDoc);
+  }
+
+  occ::handle<TDocStd_Application> anApp = createApplication(true);
+  occ::handle<TDocStd_Document>    aDoc;
+  ASSERT_EQ(PCDM_RS_OK, anApp->Open(aFileName, aDoc));
+  const occ::handle<TDF_Data>& aData = aDoc->GetData();
+  ASSERT_FALSE(aData->DeferredLoader().IsNull());
+  EXPECT_EQ(4, aData->DeferredLoader()->NbDeferred());
+
+  const TDF_Label aLab1 = aDoc->Main().FindChild(1, false);
+  EXPECT_EQ(3, nbDeferred(aLab1));
+  EXPECT_EQ(1, nbDeferred(aDoc->Main().FindChild(2, false)));
+  EXPECT_EQ(0, nbDeferred(aDoc->Main().FindChild(3, false)));
+
+  // check of presence does not load the attribute
+  EXPECT_TRUE(aLab1.IsAttribute(aUserGuid));
+  EXPECT_EQ(4, aData->DeferredLoader()->NbDeferred());
+
+  occ::handle<TDataStd_IntegerArray> anUserInts;
+  ASSERT_TRUE(aLab1.FindAttribute(aUserGuid, anUserInts));
+  EXPECT_FALSE(anUserInts->IsDeferred());
+  EXPECT_EQ(THE_NB_ITEMS, anUserInts->Length());
+  EXPECT_EQ(-THE_NB_ITEMS, anUserInts->Value(THE_NB_ITEMS));
+  EXPECT_EQ(2, nbDeferred(aLab1));
+  EXPECT_EQ(3, aData->DeferredLoader()->NbDeferred());
+
+  // storage loads the remaining attributes and releases the mapped file before overwriting it
+  ASSERT_EQ(PCDM_SS_OK, anApp->SaveAs(aDoc, aFileName));
+  EXPECT_TRUE(aData->DeferredLoader().IsNull());
+  checkArrays(aDoc->Main(), aUserGuid);
+  anApp->Close(aDoc);
+
+  occ::handle<TDocStd_Application> anAppPlain = createApplication(false);
+  ASSERT_EQ(PCDM_RS_OK, anAppPlain->Open(aFileName, aDoc));
+  EXPECT_TRUE(aDoc->GetData()->DeferredLoader().IsNull());
+  checkArrays(aDoc->Main(), aUserGuid);
+  anAppPlain->Close(aDoc);
+
+  std::remove(TCollection_AsciiString(aFileName).ToCString());
+}
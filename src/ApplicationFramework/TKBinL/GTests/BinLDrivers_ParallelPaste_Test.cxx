@@ -0,0 +1,142 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BinLDrivers.hxx>
+#include <BinLDrivers_DocumentRetrievalDriver.hxx>
+#include <TDataStd_ExtStringArray.hxx>
+#include <TDataStd_IntegerList.hxx>
+#include <TDataStd_Name.hxx>
+#include <TDataStd_RealArray.hxx>
+#include <TDF_AttributeIterator.hxx>
+#include <TDF_ChildIterator.hxx>
+#include <TDocStd_Application.hxx>
+#include <TDocStd_Document.hxx>
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+
+namespace
+{
+//! Creates application with Lite binary format.
+occ::handle<TDocStd_Application> createApplication(const bool theToParallel)
+{
+  occ::handle<TDocStd_Application> anApp = new TDocStd_Application();
+  BinLDrivers::DefineFormat(anApp);
+  occ::handle<BinLDrivers_DocumentRetrievalDriver> aDriver =
+    occ::down_cast<BinLDrivers_DocumentRetrievalDriver>(anApp->ReaderFromFormat("BinLOcaf"));
+  aDriver->SetParallelPaste(theToParallel);
+  return anApp;
+}
+
+//! Compares attributes of two labels including their order.
+void checkSameAttributes(const TDF_Label& theRef, const TDF_Label& theRes)
+{
+  TDF_AttributeIterator aRefIter(theRef), aResIter(theRes);
+  for (; aRefIter.More() && aResIter.More(); aRefIter.Next(), aResIter.Next())
+  {
+    const occ::handle<TDF_Attribute>& aRef = aRefIter.Value();
+    const occ::handle<TDF_Attribute>& aRes = aResIter.Value();
+    ASSERT_EQ(aRef->DynamicType(), aRes->DynamicType());
+    EXPECT_EQ(aRef->ID(), aRes->ID());
+    occ::handle<TDataStd_RealArray> aRefReals = occ::down_cast<TDataStd_RealArray>(aRef);
+    if (!aRefReals.IsNull())
+    {
+      occ::handle<TDataStd_RealArray> aResReals = occ::down_cast<TDataStd_RealArray>(aRes);
+      ASSERT_EQ(aRefReals->Length(), aResReals->Length());
+      for (int anIter = aRefReals->Lower(); anIter <= aRefReals->Upper(); ++anIter)
+      {
+        ASSERT_EQ(aRefReals->Value(anIter), aResReals->Value(anIter));
+      }
+    }
+    occ::handle<TDataStd_IntegerList> aRefInts = occ::down_cast<TDataStd_IntegerList>(aRef);
+    if (!aRefInts.IsNull())
+    {
+      occ::handle<TDataStd_IntegerList> aResInts = occ::down_cast<TDataStd_IntegerList>(aRes);
+      ASSERT_EQ(aRefInts->Extent(), aResInts->Extent());
+      EXPECT_EQ(aRefInts->Last(), aResInts->Last());
+    }
+    occ::handle<TDataStd_ExtStringArray> aRefStrs =
+      occ::down_cast<TDataStd_ExtStringArray>(aRef);
+    if (!aRefStrs.IsNull())
+    {
+      occ::handle<TDataStd_ExtStringArray> aResStrs =
+        occ::down_cast<TDataStd_ExtStringArray>(aRes);
+      ASSERT_EQ(aRefStrs->Length(), aResStrs->Length());
+      EXPECT_TRUE(aRefStrs->Value(aRefStrs->Upper()).IsEqual(aResStrs->Value(aResStrs->Upper())));
+    }
+  }
+  EXPECT_FALSE(aRefIter.More());
+  EXPECT_FALSE(aResIter.More());
+}
+} // namespace
+
+TEST(BinLDrivers_ParallelPaste_Test, SameAsSequential)
+{
+  const TCollection_ExtendedString aFileName("BinLDrivers_ParallelPaste_Test.cbfl");
+  const int                        aNbLabels = 100;
+  const int                        aNbItems  = 5000;
+  {
+    occ::handle<TDocStd_Application> anApp = createApplication(false);
+    occ::handle<TDocStd_Document>    aDoc;
+    anApp->NewDocument("BinLOcaf", aDoc);
+    ASSERT_FALSE(aDoc.IsNull());
+    for (int aLabIter = 1; aLabIter <= aNbLabels; ++aLabIter)
+    {
+      const TDF_Label aLab = aDoc->Main().FindChild(aLabIter);
+      TDataStd_Name::Set(aLab, "Label");
+      // several arrays of the same type with default and user defined GUIDs
+      const Standard_GUID aGuids[2] = {Standard_GUID("c5c4a1b0-5e2f-4f0e-9a61-3e8f0d7b2a10"),
+                                       Standard_GUID("c5c4a1b0-5e2f-4f0e-9a61-3e8f0d7b2a11")};
+      for (int anArrIter = 0; anArrIter < 3; ++anArrIter)
+      {
+        occ::handle<TDataStd_RealArray> aReals =
+          anArrIter == 0 ? TDataStd_RealArray::Set(aLab, 1, aNbItems)
+                         : TDataStd_RealArray::Set(aLab, aGuids[anArrIter - 1], 1, aNbItems);
+        for (int anIter = 1; anIter <= aNbItems; ++anIter)
+        {
+          aReals->SetValue(anIter, aLabIter * 0.25 + anIter + anArrIter);
+        }
+      }
+      occ::handle<TDataStd_IntegerList> anInts = TDataStd_IntegerList::Set(aLab);
+      for (int anIter = 1; anIter <= aNbItems; ++anIter)
+      {
+        anInts->Append(aLabIter + anIter);
+      }
+      occ::handle<TDataStd_ExtStringArray> aStrs =
+        TDataStd_ExtStringArray::Set(aLab, 1, aLabIter % 2 == 0 ? 2000 : 2);
+      aStrs->SetValue(aStrs->Upper(), TCollection_ExtendedString(aLabIter));
+    }
+    ASSERT_EQ(PCDM_SS_OK, anApp->SaveAs(aDoc, aFileName));
+    anApp->Close(aDoc);
+  }
+
+  occ::handle<TDocStd_Application> aRefApp = createApplication(false);
+  occ::handle<TDocStd_Application> aResApp = createApplication(true);
+  occ::handle<TDocStd_Document>    aRefDoc, aResDoc;
+  ASSERT_EQ(PCDM_RS_OK, aRefApp->Open(aFileName, aRefDoc));
+  ASSERT_EQ(PCDM_RS_OK, aResApp->Open(aFileName, aResDoc));
+  int aNbChecked = 0;
+  for (TDF_ChildIterator aLabIter(aRefDoc->Main()); aLabIter.More(); aLabIter.Next())
+  {
+    const TDF_Label aResLab = aResDoc->Main().FindChild(aLabIter.Value().Tag(), false);
+    ASSERT_FALSE(aResLab.IsNull());
+    checkSameAttributes(aLabIter.Value(), aResLab);
+    ++aNbChecked;
+  }
+  EXPECT_EQ(aNbLabels, aNbChecked);
+
+  aRefApp->Close(aRefDoc);
+  aResApp->Close(aResDoc);
+  std::remove(TCollection_AsciiString(aFileName).ToCString());
+}
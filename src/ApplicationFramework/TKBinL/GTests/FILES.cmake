@@ -2,4 +2,6 @@
 set(OCCT_TKBinL_GTests_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
 
 set(OCCT_TKBinL_GTests_FILES
+  BinLDrivers_DeferredLoading_Test.cxx
+  BinLDrivers_ParallelPaste_Test.cxx
 )
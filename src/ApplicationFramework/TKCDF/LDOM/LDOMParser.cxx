@@ -24,6 +24,7 @@
 #include <LDOM_BasicText.hxx>
 #include <LDOM_CharReference.hxx>
 #include <TCollection_ExtendedString.hxx>
+#include <NCollection_Sequence.hxx>
 #include <OSD_FileSystem.hxx>
 
 #ifdef _MSC_VER
@@ -396,6 +397,182 @@ bool LDOMParser::ParseElement(Standard_IStream& theIStream, bool& theDocStart)
   return isError;
 }
 
+//=================================================================================================
+
+bool LDOMParser::parseStream(std::istream& anInput, const bool theWithoutRoot)
+{
+  myError.Clear();
+  myDocument.Nullify();
+  NewStreamDocument();
+
+  // Create the Reader instance
+  if (myReader)
+    delete myReader;
+  myReader = new LDOM_XmlReader(myDocument, myError);
+
+  // Parse
+  return ParseStream(anInput, theWithoutRoot);
+}
+
+//=======================================================================
+// function : NewStreamDocument
+// purpose  : create the document receiving the next sub-tree
+//=======================================================================
+
+void LDOMParser::NewStreamDocument()
+{
+  // small blocks - the document holds only one sub-tree
+  myDocument = new LDOM_MemManager(4096);
+  if (myReader)
+    myReader->SetDocument(myDocument);
+
+  // create fiction root element
+  LDOM_BasicElement& aRoot  = LDOM_BasicElement::Create("document", 8, myDocument);
+  myDocument->myRootElement = &aRoot;
+}
+
+//=======================================================================
+// function : ParseStream
+// purpose  : parse the document reading sub-trees one by one
+//=======================================================================
+
+bool LDOMParser::ParseStream(std::istream& theIStream, const bool theWithoutRoot)
+{
+  // names of the open elements not read as sub-trees
+  NCollection_Sequence<TCollection_AsciiString> anOpenElems;
+  bool                                          isError   = false;
+  bool                                          isElement = false;
+  bool                                          aDocStart = true;
+  if (theWithoutRoot)
+  {
+    isElement = true;
+    myReader->CreateElement("document", 8);
+    bool isSubtree = false;
+    if (startStreamElement(getCurrentElement(), isSubtree) || isSubtree)
+    {
+      myError = "User abort at startStreamElement()";
+      return true;
+    }
+    anOpenElems.Append("document");
+  }
+
+  for (;;)
+  {
+    const LDOM_XmlReader::RecordType aType =
+      ReadRecord(*myReader, theIStream, myCurrentData, aDocStart);
+    switch (aType)
+    {
+      case LDOM_XmlReader::XML_HEADER:
+      case LDOM_XmlReader::XML_DOCTYPE:
+        if (isElement)
+        {
+          myError = "Unexpected XML declaration";
+          isError = true;
+          break;
+        }
+        continue;
+      case LDOM_XmlReader::XML_COMMENT:
+        continue;
+      case LDOM_XmlReader::XML_TEXT:
+      case LDOM_XmlReader::XML_CDATA:
+        // text contents of the elements not read as sub-trees are skipped
+        if (!anOpenElems.IsEmpty())
+          continue;
+        myError = "Unexpected data beyond the Document Element";
+        isError = true;
+        break;
+      case LDOM_XmlReader::XML_FULL_ELEMENT:
+      case LDOM_XmlReader::XML_START_ELEMENT: {
+        if (isElement && anOpenElems.IsEmpty())
+        {
+          myError = "Expected comment or end-of-file";
+          isError = true;
+          break;
+        }
+        isElement                    = true;
+        const LDOM_Element anElem    = getCurrentElement();
+        bool               isSubtree = false;
+        if (startStreamElement(anElem, isSubtree))
+        {
+          myError = "User abort at startStreamElement()";
+          isError = true;
+          break;
+        }
+        if (!isSubtree)
+        {
+          if (aType == LDOM_XmlReader::XML_START_ELEMENT)
+          {
+            anOpenElems.Append(static_cast<const char*>(myReader->GetElement().GetTagName()));
+          }
+          else if (endStreamElement())
+          {
+            myError = "User abort at endStreamElement()";
+            isError = true;
+            break;
+          }
+          continue;
+        }
+
+        // the sub-tree becomes the only child of the root element of current document
+        const LDOM_BasicNode* aLastChild = nullptr;
+        myDocument->myRootElement->AppendChild(&myReader->GetElement(), aLastChild);
+        if (aType == LDOM_XmlReader::XML_START_ELEMENT)
+        {
+          isError = ParseElement(theIStream, aDocStart);
+          if (isError)
+            break;
+        }
+        if (readSubtree(anElem))
+        {
+          myError = "User abort at readSubtree()";
+          isError = true;
+          break;
+        }
+        NewStreamDocument();
+        continue;
+      }
+      case LDOM_XmlReader::XML_END_ELEMENT: {
+        if (anOpenElems.IsEmpty())
+        {
+          myError = "Unexpected end tag";
+          isError = true;
+          break;
+        }
+        char* aTextStr = (char*)myCurrentData.str();
+        if (!anOpenElems.Last().IsEqual(aTextStr))
+        {
+          myError = "Expected end tag \'";
+          myError += anOpenElems.Last();
+          myError += "\'";
+          isError = true;
+        }
+        else if (endStreamElement())
+        {
+          myError = "User abort at endStreamElement()";
+          isError = true;
+        }
+        delete[] aTextStr;
+        anOpenElems.Remove(anOpenElems.Length());
+        if (isError || anOpenElems.IsEmpty())
+          break;
+        continue;
+      }
+      case LDOM_XmlReader::XML_EOF:
+        if (!anOpenElems.IsEmpty())
+        {
+          myError = "Inexpected end of file";
+          isError = true;
+        }
+        break;
+      case LDOM_XmlReader::XML_UNKNOWN:
+      default:
+        isError = true;
+    }
+    break;
+  }
+  return isError;
+}
+
 //=======================================================================
 // function : startElement
 // purpose  : virtual hook on 'StartElement' event for descendant classes
@@ -416,6 +593,37 @@ bool LDOMParser::endElement()
   return false;
 }
 
+//=======================================================================
+// function : startStreamElement
+// purpose  : virtual hook on 'StartElement' event of parseStream()
+//=======================================================================
+
+bool LDOMParser::startStreamElement(const LDOM_Element&, bool& theIsSubtree)
+{
+  theIsSubtree = false;
+  return false;
+}
+
+//=======================================================================
+// function : endStreamElement
+// purpose  : virtual hook on 'EndElement' event of parseStream()
+//=======================================================================
+
+bool LDOMParser::endStreamElement()
+{
+  return false;
+}
+
+//=======================================================================
+// function : readSubtree
+// purpose  : virtual hook receiving the sub-tree read by parseStream()
+//=======================================================================
+
+bool LDOMParser::readSubtree(const LDOM_Element&)
+{
+  return false;
+}
+
 //=================================================================================================
 
 LDOM_Element LDOMParser::getCurrentElement() const
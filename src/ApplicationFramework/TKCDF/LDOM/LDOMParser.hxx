@@ -63,6 +63,15 @@ public:
   //                - if false - parse a document as usual (parse header, document tag and etc)
   // Returns True if error occurred, then GetError() can be called
 
+  Standard_EXPORT bool parseStream(std::istream& anInput, const bool theWithoutRoot = false);
+  // Parse a C++ stream element by element without building the whole document.
+  // Each element is reported by startStreamElement(); the element marked there
+  // as sub-tree is read completely into a separate small document (as the only
+  // child of its fictive "document" root element) and passed to readSubtree(),
+  // other elements are not kept in memory.
+  // theWithoutRoot - the same as for parse()
+  // Returns True if error occurred, then GetError() can be called
+
   Standard_EXPORT const TCollection_AsciiString& GetError(TCollection_AsciiString& aData) const;
   // Return text describing a parsing error, or Empty if no error occurred
 
@@ -78,6 +87,17 @@ protected:
   Standard_EXPORT virtual bool endElement();
   // virtual hook on 'EndElement' event for descendant classes
 
+  Standard_EXPORT virtual bool startStreamElement(const LDOM_Element& theElement,
+                                                  bool&               theIsSubtree);
+  // virtual hook on 'StartElement' event of parseStream();
+  // set theIsSubtree to True to read the whole element by readSubtree()
+
+  Standard_EXPORT virtual bool endStreamElement();
+  // virtual hook on 'EndElement' event of parseStream() (not called for sub-trees)
+
+  Standard_EXPORT virtual bool readSubtree(const LDOM_Element& theElement);
+  // virtual hook receiving the sub-tree completely read by parseStream()
+
   Standard_EXPORT LDOM_Element getCurrentElement() const;
   // to be called from startElement() and endElement()
 
@@ -87,6 +107,10 @@ private:
 
   bool ParseElement(Standard_IStream& theIStream, bool& theDocStart);
 
+  bool ParseStream(Standard_IStream& theIStream, const bool theWithoutRoot);
+
+  void NewStreamDocument();
+
   // ---------- PRIVATE (PROHIBITED) METHODS ----------
 
   LDOMParser(const LDOMParser& theOther) = delete;
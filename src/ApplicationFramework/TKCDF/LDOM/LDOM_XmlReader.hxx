@@ -64,6 +64,10 @@ public:
 
   void CreateElement(const char* theName, const int theLen);
 
+  void SetDocument(const occ::handle<LDOM_MemManager>& theDocument) { myDocument = theDocument; }
+
+  // set the document receiving the elements retrieved from the stream
+
   static bool getInteger(LDOMBasicString& theValue, const char* theStart, const char* theEnd);
 
   // try convert string theStart to LDOM_AsciiInteger, return False on success
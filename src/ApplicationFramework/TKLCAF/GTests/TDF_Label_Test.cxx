@@ -0,0 +1,95 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <TDF_ChildIterator.hxx>
+#include <TDF_Data.hxx>
+#include <TDF_Label.hxx>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+//! Checks that children of the label are sorted by tag and returns their number.
+int checkChildrenOrder(const TDF_Label& theLabel)
+{
+  int aNbChildren = 0;
+  int aPrevTag    = -1;
+  for (TDF_ChildIterator anIter(theLabel); anIter.More(); anIter.Next())
+  {
+    EXPECT_LT(aPrevTag, anIter.Value().Tag());
+    aPrevTag = anIter.Value().Tag();
+    ++aNbChildren;
+  }
+  return aNbChildren;
+}
+} // namespace
+
+TEST(TDF_Label_Test, ManyChildrenInRandomOrder)
+{
+  occ::handle<TDF_Data> aData = new TDF_Data();
+  const TDF_Label       aRoot = aData->Root();
+
+  // dense tags in shuffled order mixed with sparse tags
+  const int aNbDense = 1000;
+  int       aNbAdded = 0;
+  for (int anIter = 0; anIter < aNbDense; ++anIter)
+  {
+    const int aTag = 1 + (anIter * 389) % aNbDense;
+    EXPECT_FALSE(aRoot.FindChild(aTag, true).IsNull());
+    ++aNbAdded;
+    if (anIter % 100 == 0)
+    {
+      aRoot.FindChild(1000000 - anIter, true);
+      ++aNbAdded;
+    }
+  }
+  EXPECT_EQ(aNbAdded, aRoot.NbChildren());
+  EXPECT_EQ(aNbAdded, checkChildrenOrder(aRoot));
+
+  for (int aTag = 1; aTag <= aNbDense; ++aTag)
+  {
+    const TDF_Label aChild = aRoot.FindChild(aTag, false);
+    ASSERT_FALSE(aChild.IsNull());
+    EXPECT_EQ(aTag, aChild.Tag());
+    EXPECT_TRUE(aChild.Father() == aRoot);
+  }
+  EXPECT_EQ(999900, aRoot.FindChild(999900, false).Tag());
+  EXPECT_TRUE(aRoot.FindChild(aNbDense + 1, false).IsNull());
+  EXPECT_TRUE(aRoot.FindChild(500000, false).IsNull());
+
+  // existing child is returned instead of creation of new one
+  const TDF_Label aSame = aRoot.FindChild(500, true);
+  EXPECT_EQ(aNbAdded, aRoot.NbChildren());
+  EXPECT_TRUE(aSame == aRoot.FindChild(500, false));
+}
+
+TEST(TDF_Label_Test, DenseTagsAfterSparseTags)
+{
+  occ::handle<TDF_Data> aData = new TDF_Data();
+  const TDF_Label       aRoot = aData->Root();
+  for (int aTag = 1; aTag <= 100; ++aTag)
+  {
+    aRoot.FindChild(aTag * 1000, true);
+  }
+  const TDF_Label aLastChild = aRoot.FindChild(100001, true);
+  EXPECT_EQ(100001, aLastChild.Tag());
+
+  // fill the gaps between sparse tags
+  for (int aTag = 1; aTag <= 500; ++aTag)
+  {
+    aRoot.FindChild(aTag, true);
+  }
+  EXPECT_EQ(601, checkChildrenOrder(aRoot));
+  EXPECT_EQ(1000, aRoot.FindChild(1000, false).Tag());
+  EXPECT_EQ(250, aRoot.FindChild(250, false).Tag());
+}
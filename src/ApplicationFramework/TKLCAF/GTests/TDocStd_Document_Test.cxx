@@ -0,0 +1,86 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <TDataStd_IntegerArray.hxx>
+#include <TDocStd_Document.hxx>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+const int THE_ARRAY_LENGTH = 100000;
+const int THE_NB_COMMANDS  = 10;
+
+//! Creates a document with an integer array and performs commands modifying one its value.
+occ::handle<TDocStd_Document> createModifiedDocument(const bool   theIsDelta,
+                                                     const size_t theMemoryLimit)
+{
+  occ::handle<TDocStd_Document> aDoc = new TDocStd_Document("dummy");
+  aDoc->SetUndoLimit(THE_NB_COMMANDS);
+  aDoc->SetUndoMemoryLimit(theMemoryLimit);
+
+  aDoc->OpenCommand();
+  occ::handle<TDataStd_IntegerArray> anArray =
+    TDataStd_IntegerArray::Set(aDoc->Main(), 1, THE_ARRAY_LENGTH, theIsDelta);
+  aDoc->CommitCommand();
+  for (int aCmdIter = 1; aCmdIter < THE_NB_COMMANDS; ++aCmdIter)
+  {
+    aDoc->OpenCommand();
+    anArray->SetValue(aCmdIter, aCmdIter);
+    aDoc->CommitCommand();
+  }
+  return aDoc;
+}
+} // namespace
+
+TEST(TDocStd_Document_Test, UndoMemorySize)
+{
+  occ::handle<TDocStd_Document> aFullDoc = createModifiedDocument(false, 0);
+  EXPECT_EQ(THE_NB_COMMANDS, aFullDoc->GetAvailableUndos());
+  // each modification keeps the backup copy of whole array
+  const size_t anArraySize = THE_ARRAY_LENGTH * sizeof(int);
+  EXPECT_GT(aFullDoc->GetUndosMemorySize(), (THE_NB_COMMANDS - 1) * anArraySize);
+  EXPECT_EQ(0u, aFullDoc->GetRedosMemorySize());
+
+  ASSERT_TRUE(aFullDoc->Undo());
+  EXPECT_GT(aFullDoc->GetRedosMemorySize(), 0u);
+
+  // delta mode keeps only changed values
+  occ::handle<TDocStd_Document> aDeltaDoc = createModifiedDocument(true, 0);
+  EXPECT_EQ(THE_NB_COMMANDS, aDeltaDoc->GetAvailableUndos());
+  EXPECT_LT(aDeltaDoc->GetUndosMemorySize(), anArraySize);
+}
+
+TEST(TDocStd_Document_Test, UndoMemoryLimit)
+{
+  const size_t                  anArraySize = THE_ARRAY_LENGTH * sizeof(int);
+  const size_t                  aLimit      = 3 * anArraySize + anArraySize / 2;
+  occ::handle<TDocStd_Document> aDoc        = createModifiedDocument(false, aLimit);
+  EXPECT_EQ(3, aDoc->GetAvailableUndos());
+  EXPECT_LE(aDoc->GetUndosMemorySize(), aLimit);
+
+  // the latest modifications are undone
+  occ::handle<TDataStd_IntegerArray> anArray;
+  ASSERT_TRUE(aDoc->Main().FindAttribute(TDataStd_IntegerArray::GetID(), anArray));
+  ASSERT_TRUE(aDoc->Undo());
+  EXPECT_EQ(0, anArray->Value(THE_NB_COMMANDS - 1));
+  EXPECT_EQ(THE_NB_COMMANDS - 2, anArray->Value(THE_NB_COMMANDS - 2));
+
+  // the most recent undo is kept even if it exceeds the limit
+  aDoc->SetUndoMemoryLimit(1);
+  EXPECT_EQ(1, aDoc->GetAvailableUndos());
+
+  // delta mode keeps all undos within the same limit
+  occ::handle<TDocStd_Document> aDeltaDoc = createModifiedDocument(true, aLimit);
+  EXPECT_EQ(THE_NB_COMMANDS, aDeltaDoc->GetAvailableUndos());
+}
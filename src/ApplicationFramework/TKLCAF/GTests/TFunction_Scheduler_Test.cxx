@@ -0,0 +1,226 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <Standard_GUID.hxx>
+#include <TDataStd_Real.hxx>
+#include <TDF_Data.hxx>
+#include <TFunction_Driver.hxx>
+#include <TFunction_DriverTable.hxx>
+#include <TFunction_IFunction.hxx>
+#include <TFunction_Logbook.hxx>
+#include <TFunction_Scheduler.hxx>
+
+#include <gtest/gtest.h>
+
+#include <functional>
+
+namespace
+{
+const int THE_NB_SQUARES = 8;
+
+const Standard_GUID THE_SQUARE_GUID("5b3e3a52-6d1f-4c8e-a2b7-0f4c9d7e1a31");
+const Standard_GUID THE_SUM_GUID("5b3e3a52-6d1f-4c8e-a2b7-0f4c9d7e1a32");
+
+//! Returns the value of real attribute on the label or 0.
+double realValue(const TDF_Label& theLabel)
+{
+  occ::handle<TDataStd_Real> aReal;
+  return theLabel.FindAttribute(TDataStd_Real::GetID(), aReal) ? aReal->Get() : 0.0;
+}
+
+//! Data computed by the square driver.
+class SquareData : public Standard_Transient
+{
+public:
+  SquareData(const double theValue)
+      : Value(theValue)
+  {
+  }
+
+  double Value;
+};
+
+//! Concurrent driver computing square of the value on sub-label 1 into sub-label 2.
+class SquareDriver : public TFunction_Driver
+{
+public:
+  void Arguments(NCollection_List<TDF_Label>& theArgs) const override
+  {
+    theArgs.Append(Label().FindChild(1));
+  }
+
+  void Results(NCollection_List<TDF_Label>& theRes) const override
+  {
+    theRes.Append(Label().FindChild(2));
+  }
+
+  bool IsConcurrent() const override { return true; }
+
+  occ::handle<Standard_Transient> Compute(const TDF_Label& theFunction) const override
+  {
+    occ::handle<TDataStd_Real> anArg;
+    if (!theFunction.FindChild(1, false).FindAttribute(TDataStd_Real::GetID(), anArg))
+    {
+      return occ::handle<Standard_Transient>();
+    }
+    return new SquareData(anArg->Get() * anArg->Get());
+  }
+
+  int Store(const occ::handle<Standard_Transient>& theData,
+            occ::handle<TFunction_Logbook>&        theLog) const override
+  {
+    TDataStd_Real::Set(Label().FindChild(2), occ::down_cast<SquareData>(theData)->Value);
+    theLog->SetImpacted(Label().FindChild(2));
+    return 0;
+  }
+
+  int Execute(occ::handle<TFunction_Logbook>&) const override { return -1; }
+
+  bool HashArguments(size_t& theHash) const override
+  {
+    theHash = std::hash<double>{}(realValue(Label().FindChild(1)));
+    return true;
+  }
+};
+
+//! Sequential driver summing results of square functions.
+class SumDriver : public TFunction_Driver
+{
+public:
+  void Arguments(NCollection_List<TDF_Label>& theArgs) const override
+  {
+    for (int aTag = 1; aTag <= THE_NB_SQUARES; ++aTag)
+    {
+      theArgs.Append(Label().Father().FindChild(aTag).FindChild(2));
+    }
+  }
+
+  void Results(NCollection_List<TDF_Label>& theRes) const override
+  {
+    theRes.Append(Label().FindChild(2));
+  }
+
+  int Execute(occ::handle<TFunction_Logbook>& theLog) const override
+  {
+    double aSum = 0.0;
+    for (int aTag = 1; aTag <= THE_NB_SQUARES; ++aTag)
+    {
+      aSum += realValue(Label().Father().FindChild(aTag).FindChild(2));
+    }
+    TDataStd_Real::Set(Label().FindChild(2), aSum);
+    theLog->SetImpacted(Label().FindChild(2));
+    return 0;
+  }
+
+  bool HashArguments(size_t& theHash) const override
+  {
+    theHash = 0;
+    for (int aTag = 1; aTag <= THE_NB_SQUARES; ++aTag)
+    {
+      const double aValue = realValue(Label().Father().FindChild(aTag).FindChild(2));
+      theHash             = theHash * 31 + std::hash<double>{}(aValue);
+    }
+    return true;
+  }
+};
+} // namespace
+
+TEST(TFunction_Scheduler_Test, ParallelAndIncrementalExecution)
+{
+  occ::handle<TFunction_DriverTable> aTable = TFunction_DriverTable::Get();
+  aTable->AddDriver(THE_SQUARE_GUID, new SquareDriver());
+  aTable->AddDriver(THE_SUM_GUID, new SumDriver());
+
+  occ::handle<TDF_Data> aData = new TDF_Data();
+  const TDF_Label       aRoot = aData->Root();
+  for (int aTag = 1; aTag <= THE_NB_SQUARES; ++aTag)
+  {
+    const TDF_Label aFunction = aRoot.FindChild(aTag);
+    ASSERT_TRUE(TFunction_IFunction::NewFunction(aFunction, THE_SQUARE_GUID));
+    TDataStd_Real::Set(aFunction.FindChild(1), double(aTag));
+  }
+  const TDF_Label aSum = aRoot.FindChild(THE_NB_SQUARES + 1);
+  ASSERT_TRUE(TFunction_IFunction::NewFunction(aSum, THE_SUM_GUID));
+
+  double aRefSum = 0.0;
+  for (int aTag = 1; aTag <= THE_NB_SQUARES; ++aTag)
+  {
+    aRefSum += aTag * aTag;
+  }
+
+  TFunction_Scheduler aScheduler(aRoot);
+  EXPECT_TRUE(aScheduler.Perform());
+  EXPECT_EQ(THE_NB_SQUARES + 1, aScheduler.NbExecuted());
+  EXPECT_EQ(0, aScheduler.NbSkipped());
+  EXPECT_EQ(aRefSum, realValue(aSum.FindChild(2)));
+  EXPECT_EQ(TFunction_ES_Succeeded, TFunction_IFunction(aSum).GetStatus());
+
+  // nothing is changed
+  EXPECT_TRUE(aScheduler.Perform());
+  EXPECT_EQ(0, aScheduler.NbExecuted());
+  EXPECT_EQ(THE_NB_SQUARES + 1, aScheduler.NbSkipped());
+
+  // only the modified function and the dependent one are executed
+  TDataStd_Real::Set(aRoot.FindChild(3).FindChild(1), 10.0);
+  EXPECT_TRUE(aScheduler.Perform());
+  EXPECT_EQ(2, aScheduler.NbExecuted());
+  EXPECT_EQ(THE_NB_SQUARES - 1, aScheduler.NbSkipped());
+  aRefSum += 100.0 - 9.0;
+  EXPECT_EQ(aRefSum, realValue(aSum.FindChild(2)));
+
+  // sequential execution gives the same result
+  aScheduler.SetUseParallel(false);
+  aScheduler.ClearHashes();
+  EXPECT_TRUE(aScheduler.Perform());
+  EXPECT_EQ(THE_NB_SQUARES + 1, aScheduler.NbExecuted());
+  EXPECT_EQ(aRefSum, realValue(aSum.FindChild(2)));
+
+  aTable->RemoveDriver(THE_SQUARE_GUID);
+  aTable->RemoveDriver(THE_SUM_GUID);
+}
+
+TEST(TFunction_Scheduler_Test, FailedFunctionStopsDependents)
+{
+  occ::handle<TFunction_DriverTable> aTable = TFunction_DriverTable::Get();
+  aTable->AddDriver(THE_SQUARE_GUID, new SquareDriver());
+  aTable->AddDriver(THE_SUM_GUID, new SumDriver());
+
+  occ::handle<TDF_Data> aData = new TDF_Data();
+  const TDF_Label       aRoot = aData->Root();
+  for (int aTag = 1; aTag <= THE_NB_SQUARES; ++aTag)
+  {
+    TFunction_IFunction::NewFunction(aRoot.FindChild(aTag), THE_SQUARE_GUID);
+    TDataStd_Real::Set(aRoot.FindChild(aTag).FindChild(1), double(aTag));
+  }
+  const TDF_Label aSum = aRoot.FindChild(THE_NB_SQUARES + 1);
+  TFunction_IFunction::NewFunction(aSum, THE_SUM_GUID);
+
+  // the square function without argument fails
+  aRoot.FindChild(1).FindChild(1).ForgetAllAttributes();
+  TFunction_Scheduler aScheduler(aRoot);
+  EXPECT_FALSE(aScheduler.Perform());
+  EXPECT_EQ(THE_NB_SQUARES, aScheduler.NbExecuted());
+  EXPECT_EQ(1, aScheduler.NbFailed());
+  EXPECT_EQ(TFunction_ES_Failed, TFunction_IFunction(aRoot.FindChild(1)).GetStatus());
+  EXPECT_EQ(TFunction_ES_Succeeded, TFunction_IFunction(aRoot.FindChild(2)).GetStatus());
+  EXPECT_EQ(TFunction_ES_NotExecuted, TFunction_IFunction(aSum).GetStatus());
+
+  // the failed function is executed again after correction of its argument
+  TDataStd_Real::Set(aRoot.FindChild(1).FindChild(1), 1.0);
+  EXPECT_TRUE(aScheduler.Perform());
+  EXPECT_EQ(2, aScheduler.NbExecuted());
+  EXPECT_EQ(TFunction_ES_Succeeded, TFunction_IFunction(aSum).GetStatus());
+
+  aTable->RemoveDriver(THE_SQUARE_GUID);
+  aTable->RemoveDriver(THE_SUM_GUID);
+}
@@ -44,6 +44,8 @@ set(OCCT_TDF_FILES
   TDF_DefaultDeltaOnModification.hxx
   TDF_DefaultDeltaOnRemoval.cxx
   TDF_DefaultDeltaOnRemoval.hxx
+  TDF_DeferredLoader.cxx
+  TDF_DeferredLoader.hxx
   TDF_Delta.cxx
   TDF_Delta.hxx
   TDF_Delta.lxx
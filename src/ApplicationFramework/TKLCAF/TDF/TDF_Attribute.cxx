@@ -338,6 +338,13 @@ void TDF_Attribute::ExtendedDump(Standard_OStream& anOS,
 
 //=================================================================================================
 
+size_t TDF_Attribute::EstimatedDataSize() const
+{
+  return DynamicType()->Size();
+}
+
+//=================================================================================================
+
 void TDF_Attribute::DumpJson(Standard_OStream& theOStream, int) const
 {
   OCCT_DUMP_TRANSIENT_CLASS_BEGIN(theOStream)
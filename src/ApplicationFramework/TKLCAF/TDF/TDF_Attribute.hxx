@@ -163,6 +163,14 @@ public:
   //! Returns true if the attribute has no backup
   bool IsNew() const;
 
+  //! Returns true if decoding of the attribute content has been deferred by the retrieval
+  //! driver; such attribute is loaded on the first access by TDF_Label::FindAttribute()
+  //! (see TDF_DeferredLoader).
+  bool IsDeferred() const;
+
+  //! Sets the deferred status; to be used by retrieval drivers and TDF_DeferredLoader only.
+  void SetDeferred(const bool theIsDeferred);
+
   //! Returns true if the attribute forgotten status is
   //! set.
   //!
@@ -372,6 +380,12 @@ public:
   //! Dumps the content of me into the stream
   Standard_EXPORT virtual void DumpJson(Standard_OStream& theOStream, int theDepth = -1) const;
 
+  //! Returns estimated memory usage of the attribute in bytes, including its content.
+  //! Used to evaluate the memory held by backup copies in the undo stack.
+  //! Default implementation returns the size of the attribute object;
+  //! attributes keeping large data (arrays, lists) should redefine it.
+  Standard_EXPORT virtual size_t EstimatedDataSize() const;
+
   friend class TDF_Data;
   friend class TDF_Label;
   friend class TDF_LabelNode;
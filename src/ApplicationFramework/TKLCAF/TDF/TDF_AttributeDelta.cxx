@@ -72,6 +72,13 @@ Standard_OStream& TDF_AttributeDelta::Dump(Standard_OStream& OS) const
 
 //=================================================================================================
 
+size_t TDF_AttributeDelta::EstimatedDataSize() const
+{
+  return DynamicType()->Size();
+}
+
+//=================================================================================================
+
 void TDF_AttributeDelta::DumpJson(Standard_OStream& theOStream, int theDepth) const
 {
   OCCT_DUMP_TRANSIENT_CLASS_BEGIN(theOStream)
@@ -60,6 +60,11 @@ public:
   //! Dumps the content of me into the stream
   Standard_EXPORT virtual void DumpJson(Standard_OStream& theOStream, int theDepth = -1) const;
 
+  //! Returns estimated memory usage of the delta in bytes.
+  //! Default implementation returns the size of the delta object only,
+  //! as the referred attribute is the one kept in the data framework.
+  Standard_EXPORT virtual size_t EstimatedDataSize() const;
+
   DEFINE_STANDARD_RTTIEXT(TDF_AttributeDelta, Standard_Transient)
 
 protected:
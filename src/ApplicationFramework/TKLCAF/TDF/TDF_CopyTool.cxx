@@ -20,6 +20,7 @@
 
 #include <TDF_AttributeIterator.hxx>
 #include <TDF_ChildIterator.hxx>
+#include <TDF_Data.hxx>
 #include <TDF_CopyTool.hxx>
 #include <TDF_DataSet.hxx>
 #include <TDF_IDFilter.hxx>
@@ -172,6 +173,10 @@ void TDF_CopyTool::CopyAttributes(
     const occ::handle<TDF_Attribute> sAtt = attItr.Value();
     if (aSrcAttributeMap.Contains(sAtt))
     {
+      if (sAtt->IsDeferred())
+      {
+        aSLabel.Data()->LoadDeferredAttribute(sAtt);
+      }
       const Standard_GUID& id = sAtt->ID();
       if (!aTargetLabel.FindAttribute(id, tAtt))
       {
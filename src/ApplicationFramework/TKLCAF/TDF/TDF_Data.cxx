@@ -108,6 +108,7 @@ TDF_Data::TDF_Data()
 
 void TDF_Data::Destroy()
 {
+  myDeferredLoader.Nullify();
   AbortUntilTransaction(1);
   // Forget the Owner attribute from the root label to avoid referencing document before
   // desctuction of the framework (on custom attributes forget). Don't call ForgetAll because
@@ -476,6 +477,65 @@ void TDF_Data::RegisterLabel(const TDF_Label& aLabel)
 
 //=================================================================================================
 
+bool TDF_Data::LoadDeferredAttribute(const occ::handle<TDF_Attribute>& theAttribute)
+{
+  if (!theAttribute->IsDeferred())
+  {
+    return true;
+  }
+
+  theAttribute->SetDeferred(false);
+  if (myDeferredLoader.IsNull())
+  {
+    return false;
+  }
+
+  // the loader might be released by recursive loading of other attributes
+  const occ::handle<TDF_DeferredLoader> aLoader = myDeferredLoader;
+
+  // invalidated attribute is filled without backup, so that loading is not recorded
+  // as a modification within currently opened transaction
+  const bool isModificationAllowed = myAllowModification;
+  const bool isValid               = theAttribute->IsValid();
+  myAllowModification              = true;
+  theAttribute->Validate(false);
+  const bool isLoaded = aLoader->Load(theAttribute);
+  theAttribute->Validate(isValid);
+  myAllowModification = isModificationAllowed;
+
+  if (aLoader->NbDeferred() == 0 && myDeferredLoader == aLoader)
+  {
+    myDeferredLoader.Nullify();
+  }
+  return isLoaded;
+}
+
+//=================================================================================================
+
+void TDF_Data::LoadDeferredAttributes()
+{
+  if (myDeferredLoader.IsNull())
+  {
+    return;
+  }
+
+  const TDF_Label aRoot = Root();
+  for (TDF_AttributeIterator anAttIter(aRoot); anAttIter.More(); anAttIter.Next())
+  {
+    LoadDeferredAttribute(anAttIter.Value());
+  }
+  for (TDF_ChildIterator aLabIter(aRoot, true); aLabIter.More() && !myDeferredLoader.IsNull();
+       aLabIter.Next())
+  {
+    for (TDF_AttributeIterator anAttIter(aLabIter.Value()); anAttIter.More(); anAttIter.Next())
+    {
+      LoadDeferredAttribute(anAttIter.Value());
+    }
+  }
+}
+
+//=================================================================================================
+
 Standard_OStream& TDF_Data::Dump(Standard_OStream& anOS) const
 {
   anOS << "Dump of a TDF_Data." << std::endl;
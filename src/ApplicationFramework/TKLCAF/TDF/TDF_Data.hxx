@@ -27,6 +27,7 @@
 #include <TDF_Label.hxx>
 #include <Standard_OStream.hxx>
 #include <NCollection_DataMap.hxx>
+#include <TDF_DeferredLoader.hxx>
 class TDF_Delta;
 class TDF_Label;
 
@@ -109,6 +110,27 @@ public:
   //! It adds a new label into internal table for fast access to the labels by entry.
   Standard_EXPORT void RegisterLabel(const TDF_Label& aLabel);
 
+  //! Returns the loader of attributes with deferred content or NULL.
+  const occ::handle<TDF_DeferredLoader>& DeferredLoader() const { return myDeferredLoader; }
+
+  //! Sets the loader of attributes with deferred content (see TDF_Attribute::IsDeferred()).
+  //! The loader is released as soon as all deferred attributes are loaded.
+  void SetDeferredLoader(const occ::handle<TDF_DeferredLoader>& theLoader)
+  {
+    myDeferredLoader = theLoader;
+  }
+
+  //! Decodes content of the attribute if it has been deferred by the retrieval driver.
+  //! The content is loaded outside of transactions mechanism, so that the attribute is not
+  //! backed up and the loading cannot be undone.
+  //! @return FALSE if the attribute remains empty due to loading failure
+  Standard_EXPORT bool LoadDeferredAttribute(const occ::handle<TDF_Attribute>& theAttribute);
+
+  //! Decodes content of all deferred attributes within the data framework.
+  //! Should be called before operations iterating over attributes with TDF_AttributeIterator
+  //! and accessing their content (like copying or storing the document).
+  Standard_EXPORT void LoadDeferredAttributes();
+
   //! Returns TDF_HAllocator, which is an
   //! incremental allocator used by
   //! TDF_LabelNode.
@@ -205,6 +227,7 @@ private:
   bool                                                    myAllowModification;
   bool                                                    myAccessByEntries;
   NCollection_DataMap<TCollection_AsciiString, TDF_Label> myAccessByEntriesTable;
+  occ::handle<TDF_DeferredLoader>                         myDeferredLoader;
 };
 
 #include <TDF_Data.lxx>
@@ -0,0 +1,46 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _TDF_DeferredLoader_HeaderFile
+#define _TDF_DeferredLoader_HeaderFile
+
+#include <Standard_Handle.hxx>
+#include <Standard_Transient.hxx>
+#include <Standard_Type.hxx>
+
+class TDF_Attribute;
+
+//! Interface decoding content of attributes which loading has been deferred by a retrieval driver.
+//!
+//! The retrieval driver attaches empty attributes flagged by TDF_Attribute::SetDeferred()
+//! to the labels and registers the loader within TDF_Data (see TDF_Data::SetDeferredLoader()).
+//! The content of such attribute is decoded on the first access to it by TDF_Label::FindAttribute()
+//! or explicitly by TDF_Data::LoadDeferredAttribute().
+class TDF_DeferredLoader : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(TDF_DeferredLoader, Standard_Transient)
+public:
+  //! Decodes content of the deferred attribute.
+  //! Called by TDF_Data with deferred flag of the attribute already reset.
+  //! @return FALSE if the attribute is unknown to the loader or its content cannot be decoded
+  Standard_EXPORT virtual bool Load(const occ::handle<TDF_Attribute>& theAttribute) = 0;
+
+  //! Returns the number of attributes which content has not been decoded yet.
+  Standard_EXPORT virtual int NbDeferred() const = 0;
+
+protected:
+  //! Empty constructor.
+  Standard_EXPORT TDF_DeferredLoader();
+};
+
+#endif // _TDF_DeferredLoader_HeaderFile
@@ -219,6 +219,20 @@ void TDF_Delta::Dump(Standard_OStream& OS) const
 
 //=================================================================================================
 
+size_t TDF_Delta::EstimatedDataSize() const
+{
+  size_t aSize = DynamicType()->Size();
+  for (NCollection_List<occ::handle<TDF_AttributeDelta>>::Iterator anAttDeltaIt(myAttDeltaList);
+       anAttDeltaIt.More();
+       anAttDeltaIt.Next())
+  {
+    aSize += anAttDeltaIt.Value()->EstimatedDataSize();
+  }
+  return aSize;
+}
+
+//=================================================================================================
+
 void TDF_Delta::DumpJson(Standard_OStream& theOStream, int theDepth) const
 {
   OCCT_DUMP_TRANSIENT_CLASS_BEGIN(theOStream)
@@ -71,6 +71,10 @@ public:
   //! Dumps the content of me into the stream
   Standard_EXPORT void DumpJson(Standard_OStream& theOStream, int theDepth = -1) const;
 
+  //! Returns estimated memory usage of the delta in bytes,
+  //! i.e. the sum of estimated sizes of its attribute deltas.
+  Standard_EXPORT size_t EstimatedDataSize() const;
+
   friend class TDF_Data;
 
   DEFINE_STANDARD_RTTIEXT(TDF_Delta, Standard_Transient)
@@ -35,3 +35,12 @@ void TDF_DeltaOnModification::Apply()
 {
   Attribute()->DeltaOnModification(this);
 }
+
+//=================================================================================================
+
+size_t TDF_DeltaOnModification::EstimatedDataSize() const
+{
+  const occ::handle<TDF_Attribute> aBackup = Attribute();
+  return TDF_AttributeDelta::EstimatedDataSize()
+         + (!aBackup.IsNull() ? aBackup->EstimatedDataSize() : 0);
+}
@@ -33,6 +33,9 @@ public:
   //! Applies the delta to the attribute.
   Standard_EXPORT void Apply() override;
 
+  //! Returns estimated memory usage of the delta including the backup attribute.
+  Standard_EXPORT size_t EstimatedDataSize() const override;
+
   DEFINE_STANDARD_RTTIEXT(TDF_DeltaOnModification, TDF_AttributeDelta)
 
 protected:
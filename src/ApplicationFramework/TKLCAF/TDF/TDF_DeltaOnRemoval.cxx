@@ -28,3 +28,12 @@ TDF_DeltaOnRemoval::TDF_DeltaOnRemoval(const occ::handle<TDF_Attribute>& anAtt)
     : TDF_AttributeDelta(anAtt)
 {
 }
+
+//=================================================================================================
+
+size_t TDF_DeltaOnRemoval::EstimatedDataSize() const
+{
+  const occ::handle<TDF_Attribute> anAttribute = Attribute();
+  return TDF_AttributeDelta::EstimatedDataSize()
+         + (!anAttribute.IsNull() ? anAttribute->EstimatedDataSize() : 0);
+}
@@ -30,6 +30,9 @@ class TDF_DeltaOnRemoval : public TDF_AttributeDelta
 {
 
 public:
+  //! Returns estimated memory usage of the delta including the removed attribute.
+  Standard_EXPORT size_t EstimatedDataSize() const override;
+
   DEFINE_STANDARD_RTTIEXT(TDF_DeltaOnRemoval, TDF_AttributeDelta)
 
 protected:
@@ -58,6 +58,10 @@ bool TDF_Label::FindAttribute(const Standard_GUID&        anID,
     if (itr.PtrValue()->ID() == anID)
     {
       anAttribute = itr.PtrValue();
+      if (anAttribute->IsDeferred())
+      {
+        myLabelNode->Data()->LoadDeferredAttribute(anAttribute);
+      }
       return true;
     }
   }
@@ -190,8 +194,17 @@ TDF_Label TDF_Label::FindChild(const int aTag, const bool create) const
 
 bool TDF_Label::IsAttribute(const Standard_GUID& anID) const
 {
-  occ::handle<TDF_Attribute> att;
-  return FindAttribute(anID, att);
+  if (IsNull())
+    throw Standard_NullObject("A null Label has no attribute.");
+  // the content of deferred attribute is not needed here, so that it is not loaded
+  for (TDF_AttributeIterator itr(myLabelNode); itr.More(); itr.Next())
+  {
+    if (itr.PtrValue()->ID() == anID)
+    {
+      return true;
+    }
+  }
+  return false;
 }
 
 //=======================================================================
@@ -289,6 +302,20 @@ TDF_LabelNode* TDF_Label::FindOrAddChild(const int aTag, const bool create) cons
   TDF_LabelNode* lastFoundLnp   = myLabelNode->myLastFoundChild; // jfa 10.01.2003
   TDF_LabelNode* childLabelNode = nullptr;
 
+  // Labels with many children are accessed directly by tag.
+  if (myLabelNode->HasChildIndex())
+  {
+    childLabelNode = myLabelNode->IndexedChild(aTag);
+    if (childLabelNode != nullptr || !create)
+    {
+      return childLabelNode;
+    }
+    // Finds the place of the new child.
+    lastLnp      = myLabelNode->IndexedPrevious(aTag);
+    currentLnp   = (lastLnp != nullptr) ? lastLnp->Brother() : myLabelNode->FirstChild();
+    lastFoundLnp = nullptr;
+  }
+
   // Finds the right place.
 
   // jfa 10.01.2003
@@ -331,6 +358,7 @@ TDF_LabelNode* TDF_Label::FindOrAddChild(const int aTag, const bool create) cons
       myLabelNode->myFirstChild = childLabelNode;
     else // ... somewhere.
       lastLnp->myBrother = childLabelNode;
+    myLabelNode->ChildAdded(childLabelNode);
     // Update table for fast access to the labels.
     if (myLabelNode->Data()->IsAccessByEntries())
       myLabelNode->Data()->RegisterLabel(childLabelNode);
@@ -99,6 +99,7 @@ public:
   bool IsRoot() const;
 
   //! Returns true if <me> owns an attribute with <anID> as ID.
+  //! The content of deferred attribute is not loaded.
   Standard_EXPORT bool IsAttribute(const Standard_GUID& anID) const;
 
   //! Adds an Attribute to the current label. Raises if
@@ -135,6 +136,7 @@ public:
   //! The method returns True if found, False otherwise.
   //!
   //! A removed attribute cannot be found.
+  //! The content of deferred attribute (see TDF_Attribute::IsDeferred()) is loaded.
   Standard_EXPORT bool FindAttribute(const Standard_GUID&        anID,
                                      occ::handle<TDF_Attribute>& anAttribute) const;
 
@@ -18,6 +18,114 @@
 #include <TDF_Data.hxx>
 #include <TDF_Label.hxx>
 
+#include <NCollection_Array1.hxx>
+#include <NCollection_DataMap.hxx>
+
+#include <algorithm>
+
+namespace
+{
+// Number of children starting from which the node gets the index of children
+constexpr int THE_CHILD_INDEX_THRESHOLD = 32;
+// Minimal number of slots in the dense part of the index
+constexpr int THE_CHILD_INDEX_MIN_DENSE = 64;
+} // namespace
+
+//=======================================================================
+// struct  : ChildIndex
+// purpose : Direct access to children by tag. Tags in range [0, Upper]
+//           are stored in the dense array; the array grows only while it
+//           remains at least half filled, other tags are kept in the map.
+//           Allocated in the common heap to release the memory on growth.
+//=======================================================================
+
+struct TDF_LabelNode::ChildIndex
+{
+  DEFINE_STANDARD_ALLOC
+
+  ChildIndex()
+      : Dense(0, THE_CHILD_INDEX_MIN_DENSE - 1),
+        LastChild(nullptr),
+        NbChildren(0)
+  {
+    Dense.Init(nullptr);
+  }
+
+  TDF_LabelNode* Find(const int aTag) const
+  {
+    if (aTag >= 0 && aTag <= Dense.Upper())
+      return Dense(aTag);
+    TDF_LabelNode* const* aChild = Sparse.Seek(aTag);
+    return aChild != nullptr ? *aChild : nullptr;
+  }
+
+  // Returns the child with the greatest tag less than aTag.
+  TDF_LabelNode* Previous(const int aTag) const
+  {
+    if (LastChild == nullptr || LastChild->Tag() < aTag)
+      return LastChild;
+    TDF_LabelNode* aPrev = nullptr;
+    for (int aTagIter = std::min(aTag - 1, Dense.Upper()); aTagIter >= 0; --aTagIter)
+    {
+      if (Dense(aTagIter) != nullptr)
+      {
+        aPrev = Dense(aTagIter);
+        break;
+      }
+    }
+    for (NCollection_DataMap<int, TDF_LabelNode*>::Iterator anIter(Sparse); anIter.More();
+         anIter.Next())
+    {
+      const int aSparseTag = anIter.Key();
+      if (aSparseTag < aTag && (aPrev == nullptr || aSparseTag > aPrev->Tag()))
+        aPrev = anIter.Value();
+    }
+    return aPrev;
+  }
+
+  void Add(TDF_LabelNode* aChild)
+  {
+    const int aTag = aChild->Tag();
+    ++NbChildren;
+    if (LastChild == nullptr || LastChild->Tag() < aTag)
+      LastChild = aChild;
+
+    const int aMaxUpper = 2 * NbChildren + THE_CHILD_INDEX_MIN_DENSE;
+    if (aTag > Dense.Upper() && aTag < aMaxUpper)
+    {
+      // extend the dense part and move there the tags from the map
+      const int anOldUpper = Dense.Upper();
+      const int aNewUpper  = std::min(std::max(aTag, 2 * anOldUpper + 1), aMaxUpper);
+      Dense.Resize(0, aNewUpper, true);
+      for (int aTagIter = anOldUpper + 1; aTagIter <= aNewUpper; ++aTagIter)
+        Dense(aTagIter) = nullptr;
+      if (!Sparse.IsEmpty())
+      {
+        NCollection_DataMap<int, TDF_LabelNode*> aRemaining;
+        for (NCollection_DataMap<int, TDF_LabelNode*>::Iterator anIter(Sparse); anIter.More();
+             anIter.Next())
+        {
+          if (anIter.Key() > anOldUpper && anIter.Key() <= aNewUpper)
+            Dense(anIter.Key()) = anIter.Value();
+          else
+            aRemaining.Bind(anIter.Key(), anIter.Value());
+        }
+        Sparse.Exchange(aRemaining);
+      }
+    }
+
+    if (aTag >= 0 && aTag <= Dense.Upper())
+      Dense(aTag) = aChild;
+    else
+      Sparse.Bind(aTag, aChild);
+  }
+
+  NCollection_Array1<TDF_LabelNode*>       Dense;
+  NCollection_DataMap<int, TDF_LabelNode*> Sparse;
+  TDF_LabelNode*                           LastChild;
+  int                                      NbChildren;
+};
+
 //=======================================================================
 // function : TDF_LabelNode
 // purpose  : Constructor with TDF_Data*, only used for root node.
@@ -34,6 +142,7 @@ TDF_LabelNode::TDF_LabelNode(TDF_Data* aDataPtr)
       myLastFoundChild(nullptr), // jfa 10.01.2003
       myTag(0),                  // Always 0 for root.
       myFlags(0),
+      myChildIndex(nullptr),
 #ifdef KEEP_LOCAL_ROOT
       myData(aDataPtr)
 #endif
@@ -52,6 +161,7 @@ TDF_LabelNode::TDF_LabelNode(const int aTag, TDF_LabelNode* aFather)
       myLastFoundChild(nullptr), // jfa 10.01.2003
       myTag(aTag),
       myFlags(0),
+      myChildIndex(nullptr),
 #ifdef KEEP_LOCAL_ROOT
       myData(nullptr)
 #endif
@@ -82,6 +192,8 @@ void TDF_LabelNode::Destroy(const TDF_HAllocator& theAllocator)
     myFirstChild->Destroy(theAllocator);
     myFirstChild = aSecondChild;
   }
+  delete myChildIndex;
+  myChildIndex = nullptr;
   this->~TDF_LabelNode();
   myFather = myBrother = myFirstChild = myLastFoundChild = nullptr;
   myTag = myFlags = 0;
@@ -90,6 +202,51 @@ void TDF_LabelNode::Destroy(const TDF_HAllocator& theAllocator)
   theAllocator->Free(this);
 }
 
+//=================================================================================================
+
+TDF_LabelNode* TDF_LabelNode::IndexedChild(const int aTag) const
+{
+  return myChildIndex->Find(aTag);
+}
+
+//=================================================================================================
+
+TDF_LabelNode* TDF_LabelNode::IndexedPrevious(const int aTag) const
+{
+  return myChildIndex->Previous(aTag);
+}
+
+//=======================================================================
+// function : ChildAdded
+// purpose  : Registers the new child within the index of children.
+//            Without the index, children are counted only when the tag
+//            is large enough for the threshold to be reached.
+//=======================================================================
+
+void TDF_LabelNode::ChildAdded(TDF_LabelNode* aChild)
+{
+  if (myChildIndex != nullptr)
+  {
+    myChildIndex->Add(aChild);
+    return;
+  }
+  if (aChild->Tag() < THE_CHILD_INDEX_THRESHOLD - 1)
+    return;
+
+  int aNbChildren = 0;
+  for (TDF_LabelNode* aChildIter = myFirstChild;
+       aChildIter != nullptr && aNbChildren < THE_CHILD_INDEX_THRESHOLD;
+       aChildIter = aChildIter->Brother())
+    ++aNbChildren;
+  if (aNbChildren < THE_CHILD_INDEX_THRESHOLD)
+    return;
+
+  myChildIndex = new ChildIndex();
+  for (TDF_LabelNode* aChildIter = myFirstChild; aChildIter != nullptr;
+       aChildIter                = aChildIter->Brother())
+    myChildIndex->Add(aChildIter);
+}
+
 //=======================================================================
 // function : AddAttribute
 // purpose  : Adds an attribute at the first or the specified position.
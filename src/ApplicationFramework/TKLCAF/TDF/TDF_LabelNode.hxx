@@ -115,6 +115,16 @@ private:
   // Constructor
   TDF_LabelNode(const int Tag, TDF_LabelNode* Father);
 
+  // Child with the tag from the index of children (node should have an index)
+  TDF_LabelNode* IndexedChild(const int aTag) const;
+
+  // Child preceding the position of the tag from the index of children
+  TDF_LabelNode* IndexedPrevious(const int aTag) const;
+
+  // Registers the new child within the index of children;
+  // the index is created when the number of children becomes large
+  void ChildAdded(TDF_LabelNode* aChild);
+
   // Others
   void AddAttribute(const occ::handle<TDF_Attribute>& afterAtt,
                     const occ::handle<TDF_Attribute>& newAtt);
@@ -142,6 +152,12 @@ private:
 
   inline bool IsImported() const { return ((myFlags & TDF_LabelNodeImportMsk) != 0); }
 
+  // Index access
+  inline bool HasChildIndex() const { return myChildIndex != nullptr; }
+
+  // Index of children for direct access by tag, created for nodes with many children
+  struct ChildIndex;
+
   // Private Fields
   // --------------------------------------------------------------------------
 
@@ -152,6 +168,7 @@ private:
   int                           myTag;
   int                           myFlags; // Flags & Depth
   occ::handle<TDF_Attribute>    myFirstAttribute;
+  ChildIndex*                   myChildIndex;
 #ifdef KEEP_LOCAL_ROOT
   TDF_Data* myData;
 #endif
@@ -284,6 +284,18 @@ occ::handle<TDF_DeltaOnModification> TDataStd_ByteArray::DeltaOnModification(
 
 //=================================================================================================
 
+size_t TDataStd_ByteArray::EstimatedDataSize() const
+{
+  size_t aSize = DynamicType()->Size();
+  if (!myValue.IsNull())
+  {
+    aSize += sizeof(*myValue) + size_t(myValue->Length()) * sizeof(uint8_t);
+  }
+  return aSize;
+}
+
+//=================================================================================================
+
 void TDataStd_ByteArray::DumpJson(Standard_OStream& theOStream, int theDepth) const
 {
   OCCT_DUMP_TRANSIENT_CLASS_BEGIN(theOStream)
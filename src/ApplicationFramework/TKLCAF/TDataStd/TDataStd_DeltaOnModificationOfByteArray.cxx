@@ -194,3 +194,19 @@ void TDataStd_DeltaOnModificationOfByteArray::Apply()
   std::cout << std::endl;
 #endif
 }
+
+//=================================================================================================
+
+size_t TDataStd_DeltaOnModificationOfByteArray::EstimatedDataSize() const
+{
+  size_t aSize = TDF_DeltaOnModification::EstimatedDataSize();
+  if (!myIndxes.IsNull())
+  {
+    aSize += sizeof(*myIndxes) + size_t(myIndxes->Length()) * sizeof(int);
+  }
+  if (!myValues.IsNull())
+  {
+    aSize += sizeof(*myValues) + size_t(myValues->Length()) * sizeof(uint8_t);
+  }
+  return aSize;
+}
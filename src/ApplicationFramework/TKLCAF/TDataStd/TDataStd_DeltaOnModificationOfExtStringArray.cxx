@@ -197,3 +197,23 @@ void TDataStd_DeltaOnModificationOfExtStringArray::Apply()
   std::cout << std::endl;
 #endif
 }
+
+//=================================================================================================
+
+size_t TDataStd_DeltaOnModificationOfExtStringArray::EstimatedDataSize() const
+{
+  size_t aSize = TDF_DeltaOnModification::EstimatedDataSize();
+  if (!myIndxes.IsNull())
+  {
+    aSize += sizeof(*myIndxes) + size_t(myIndxes->Length()) * sizeof(int);
+  }
+  if (!myValues.IsNull())
+  {
+    aSize += sizeof(*myValues);
+    for (const TCollection_ExtendedString& aString : myValues->Array1())
+    {
+      aSize += sizeof(TCollection_ExtendedString) + size_t(aString.Length() + 1) * sizeof(char16_t);
+    }
+  }
+  return aSize;
+}
@@ -192,3 +192,19 @@ void TDataStd_DeltaOnModificationOfIntArray::Apply()
   std::cout << std::endl;
 #endif
 }
+
+//=================================================================================================
+
+size_t TDataStd_DeltaOnModificationOfIntArray::EstimatedDataSize() const
+{
+  size_t aSize = TDF_DeltaOnModification::EstimatedDataSize();
+  if (!myIndxes.IsNull())
+  {
+    aSize += sizeof(*myIndxes) + size_t(myIndxes->Length()) * sizeof(int);
+  }
+  if (!myValues.IsNull())
+  {
+    aSize += sizeof(*myValues) + size_t(myValues->Length()) * sizeof(int);
+  }
+  return aSize;
+}
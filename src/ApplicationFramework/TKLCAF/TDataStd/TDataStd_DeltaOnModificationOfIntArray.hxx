@@ -37,6 +37,9 @@ public:
   //! Applies the delta to the attribute.
   Standard_EXPORT void Apply() override;
 
+  //! Returns estimated memory usage of the delta including the changed values.
+  Standard_EXPORT size_t EstimatedDataSize() const override;
+
   DEFINE_STANDARD_RTTIEXT(TDataStd_DeltaOnModificationOfIntArray, TDF_DeltaOnModification)
 
 private:
@@ -190,3 +190,19 @@ void TDataStd_DeltaOnModificationOfRealArray::Apply()
   std::cout << std::endl;
 #endif
 }
+
+//=================================================================================================
+
+size_t TDataStd_DeltaOnModificationOfRealArray::EstimatedDataSize() const
+{
+  size_t aSize = TDF_DeltaOnModification::EstimatedDataSize();
+  if (!myIndxes.IsNull())
+  {
+    aSize += sizeof(*myIndxes) + size_t(myIndxes->Length()) * sizeof(int);
+  }
+  if (!myValues.IsNull())
+  {
+    aSize += sizeof(*myValues) + size_t(myValues->Length()) * sizeof(double);
+  }
+  return aSize;
+}
@@ -305,6 +305,22 @@ occ::handle<TDF_DeltaOnModification> TDataStd_ExtStringArray::DeltaOnModificatio
 
 //=================================================================================================
 
+size_t TDataStd_ExtStringArray::EstimatedDataSize() const
+{
+  size_t aSize = DynamicType()->Size();
+  if (!myValue.IsNull())
+  {
+    aSize += sizeof(*myValue);
+    for (const TCollection_ExtendedString& aString : myValue->Array1())
+    {
+      aSize += sizeof(TCollection_ExtendedString) + size_t(aString.Length() + 1) * sizeof(char16_t);
+    }
+  }
+  return aSize;
+}
+
+//=================================================================================================
+
 void TDataStd_ExtStringArray::DumpJson(Standard_OStream& theOStream, int theDepth) const
 {
   OCCT_DUMP_TRANSIENT_CLASS_BEGIN(theOStream)
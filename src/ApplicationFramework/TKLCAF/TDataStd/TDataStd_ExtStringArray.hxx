@@ -131,6 +131,9 @@ public:
   //! Dumps the content of me into the stream
   Standard_EXPORT void DumpJson(Standard_OStream& theOStream, int theDepth = -1) const override;
 
+  //! Returns estimated memory usage of the attribute including the array.
+  Standard_EXPORT size_t EstimatedDataSize() const override;
+
 private:
   void RemoveArray() { myValue.Nullify(); }
 
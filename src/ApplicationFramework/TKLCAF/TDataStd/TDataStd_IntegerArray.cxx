@@ -308,6 +308,18 @@ occ::handle<TDF_DeltaOnModification> TDataStd_IntegerArray::DeltaOnModification(
 
 //=================================================================================================
 
+size_t TDataStd_IntegerArray::EstimatedDataSize() const
+{
+  size_t aSize = DynamicType()->Size();
+  if (!myValue.IsNull())
+  {
+    aSize += sizeof(*myValue) + size_t(myValue->Length()) * sizeof(int);
+  }
+  return aSize;
+}
+
+//=================================================================================================
+
 void TDataStd_IntegerArray::DumpJson(Standard_OStream& theOStream, int theDepth) const
 {
   OCCT_DUMP_TRANSIENT_CLASS_BEGIN(theOStream)
@@ -301,6 +301,18 @@ occ::handle<TDF_DeltaOnModification> TDataStd_RealArray::DeltaOnModification(
 
 //=================================================================================================
 
+size_t TDataStd_RealArray::EstimatedDataSize() const
+{
+  size_t aSize = DynamicType()->Size();
+  if (!myValue.IsNull())
+  {
+    aSize += sizeof(*myValue) + size_t(myValue->Length()) * sizeof(double);
+  }
+  return aSize;
+}
+
+//=================================================================================================
+
 void TDataStd_RealArray::DumpJson(Standard_OStream& theOStream, int theDepth) const
 {
   OCCT_DUMP_TRANSIENT_CLASS_BEGIN(theOStream)
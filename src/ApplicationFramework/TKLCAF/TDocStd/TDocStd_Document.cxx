@@ -73,6 +73,7 @@ TDocStd_Document::TDocStd_Document(const TCollection_ExtendedString& aStorageFor
     : myStorageFormat(aStorageFormat),
       myData(new TDF_Data()),
       myUndoLimit(0),
+      myUndoMemoryLimit(0),
       myUndoTransaction("UNDO"),
       mySaveTime(0),
       myIsNestedTransactionMode(false),
@@ -270,6 +271,7 @@ bool TDocStd_Document::CommitTransaction()
       {
         myUndos.Append(D);
         myRedos.Clear(); // if we push an Undo we clear the redos
+        ApplyUndoMemoryLimit();
         isDone = true;
       }
     }
@@ -315,6 +317,7 @@ bool TDocStd_Document::CommitTransaction()
           }
 #endif
         }
+        ApplyUndoMemoryLimit();
       }
     }
 
@@ -438,6 +441,71 @@ void TDocStd_Document::SetUndoLimit(const int L)
 
 //=================================================================================================
 
+void TDocStd_Document::SetUndoMemoryLimit(const size_t theLimit)
+{
+  myUndoMemoryLimit = theLimit;
+  ApplyUndoMemoryLimit();
+}
+
+//=================================================================================================
+
+size_t TDocStd_Document::GetUndosMemorySize() const
+{
+  size_t aSize = 0;
+  for (NCollection_List<occ::handle<TDF_Delta>>::Iterator anIter(myUndos); anIter.More();
+       anIter.Next())
+  {
+    aSize += anIter.Value()->EstimatedDataSize();
+  }
+  return aSize;
+}
+
+//=================================================================================================
+
+size_t TDocStd_Document::GetRedosMemorySize() const
+{
+  size_t aSize = 0;
+  for (NCollection_List<occ::handle<TDF_Delta>>::Iterator anIter(myRedos); anIter.More();
+       anIter.Next())
+  {
+    aSize += anIter.Value()->EstimatedDataSize();
+  }
+  return aSize;
+}
+
+//=================================================================================================
+
+void TDocStd_Document::ApplyUndoMemoryLimit()
+{
+  if (myUndoMemoryLimit == 0 || myUndos.Extent() < 2)
+  {
+    return;
+  }
+
+  size_t aSize = GetUndosMemorySize();
+  while (aSize > myUndoMemoryLimit && myUndos.Extent() > 1)
+  {
+    const occ::handle<TDF_Delta> aDelta = myUndos.First();
+    aSize -= aDelta->EstimatedDataSize();
+    myUndos.RemoveFirst();
+#ifdef SRN_DELTA_COMPACT
+    if (myFromUndo == aDelta)
+    {
+      // The oldest Undo delta coincides with `from` delta
+      if (myUndos.Extent() == 1)
+      {
+        myFromUndo.Nullify();
+        myFromRedo.Nullify();
+      }
+      else
+        myFromUndo = myUndos.First();
+    }
+#endif
+  }
+}
+
+//=================================================================================================
+
 int TDocStd_Document::GetUndoLimit() const
 {
   return myUndoLimit;
@@ -882,6 +950,7 @@ void TDocStd_Document::DumpJson(Standard_OStream& theOStream, int theDepth) cons
 
   OCCT_DUMP_FIELD_VALUES_DUMPED(theOStream, theDepth, myData.get())
   OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, myUndoLimit)
+  OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, myUndoMemoryLimit)
   OCCT_DUMP_FIELD_VALUES_DUMPED(theOStream, theDepth, &myUndoTransaction)
   OCCT_DUMP_FIELD_VALUES_DUMPED(theOStream, theDepth, myFromUndo.get())
   OCCT_DUMP_FIELD_VALUES_DUMPED(theOStream, theDepth, myFromRedo.get())
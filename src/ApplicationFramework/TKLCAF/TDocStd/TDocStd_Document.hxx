@@ -144,6 +144,23 @@ public:
   //! NewCommand. Of course this limit is the same for Redo
   Standard_EXPORT void SetUndoLimit(const int L);
 
+  //! Returns the limit on the estimated memory (in bytes) of stored Undo deltas;
+  //! 0 means no limit.
+  size_t GetUndoMemoryLimit() const { return myUndoMemoryLimit; }
+
+  //! Sets the limit on the estimated memory (in bytes) of stored Undo deltas.
+  //! When the limit is exceeded on commit, the oldest Undos are removed first;
+  //! the most recent Undo is always kept. 0 (default) means no limit.
+  //! This limit is applied in addition to the limit on the number of Undos.
+  Standard_EXPORT void SetUndoMemoryLimit(const size_t theLimit);
+
+  //! Returns the estimated memory (in bytes) used by stored Undos,
+  //! see TDF_Delta::EstimatedDataSize().
+  Standard_EXPORT size_t GetUndosMemorySize() const;
+
+  //! Returns the estimated memory (in bytes) used by stored Redos.
+  Standard_EXPORT size_t GetRedosMemorySize() const;
+
   //! Remove all stored Undos and Redos
   Standard_EXPORT void ClearUndos();
 
@@ -278,8 +295,12 @@ private:
     const occ::handle<TDocStd_CompoundDelta>& theDelta1,
     const occ::handle<TDF_Delta>&             theDelta2);
 
+  //! Removes the oldest Undos while their estimated memory exceeds the limit.
+  Standard_EXPORT void ApplyUndoMemoryLimit();
+
   occ::handle<TDF_Data>                    myData;
   int                                      myUndoLimit;
+  size_t                                   myUndoMemoryLimit;
   TDF_Transaction                          myUndoTransaction;
   occ::handle<TDF_Delta>                   myFromUndo;
   occ::handle<TDF_Delta>                   myFromRedo;
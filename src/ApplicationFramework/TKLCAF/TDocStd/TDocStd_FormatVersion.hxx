@@ -79,6 +79,13 @@ enum TDocStd_FormatVersion
   TDocStd_FormatVersion_VERSION_12, //!< OCCT 7.6.0
                                     //!< * BIN: New binary format for fast reading of part of OCAF
                                     //!< document [#0031918]
+  TDocStd_FormatVersion_VERSION_13, //!< * BIN: Shape section with geometry and triangulations
+                                    //!< compressed by blocks (BinTools_FormatVersion_VERSION_7)
+                                    //!< instead of quick part format; requires OCCT built with
+                                    //!< Zstandard. Levels of detail of face triangulations are
+                                    //!< stored when the document is written with triangles.
+                                    //!< Optional version, should be requested
+                                    //!< explicitly by ChangeStorageFormatVersion()
 
   TDocStd_FormatVersion_CURRENT = TDocStd_FormatVersion_VERSION_12 //!< Current version
 };
@@ -86,7 +93,7 @@ enum TDocStd_FormatVersion
 enum
 {
   TDocStd_FormatVersion_LOWER = TDocStd_FormatVersion_VERSION_2,
-  TDocStd_FormatVersion_UPPER = TDocStd_FormatVersion_VERSION_12
+  TDocStd_FormatVersion_UPPER = TDocStd_FormatVersion_VERSION_13
 };
 
 #endif // _TDocStdFormatVersion_HeaderFile
@@ -21,6 +21,8 @@ set(OCCT_TFunction_FILES
   TFunction_Logbook.cxx
   TFunction_Logbook.hxx
   TFunction_Logbook.lxx
+  TFunction_Scheduler.cxx
+  TFunction_Scheduler.hxx
   TFunction_Scope.cxx
   TFunction_Scope.hxx
 )
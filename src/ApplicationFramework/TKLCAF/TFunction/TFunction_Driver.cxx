@@ -82,3 +82,32 @@ void TFunction_Driver::Arguments(NCollection_List<TDF_Label>&) const {}
 //=======================================================================
 
 void TFunction_Driver::Results(NCollection_List<TDF_Label>&) const {}
+
+//=================================================================================================
+
+bool TFunction_Driver::IsConcurrent() const
+{
+  return false;
+}
+
+//=================================================================================================
+
+occ::handle<Standard_Transient> TFunction_Driver::Compute(const TDF_Label&) const
+{
+  return occ::handle<Standard_Transient>();
+}
+
+//=================================================================================================
+
+int TFunction_Driver::Store(const occ::handle<Standard_Transient>&,
+                            occ::handle<TFunction_Logbook>& log) const
+{
+  return Execute(log);
+}
+
+//=================================================================================================
+
+bool TFunction_Driver::HashArguments(size_t&) const
+{
+  return false;
+}
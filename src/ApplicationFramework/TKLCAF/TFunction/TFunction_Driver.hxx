@@ -75,6 +75,35 @@ public:
   //! where the results of the function are located.
   Standard_EXPORT virtual void Results(NCollection_List<TDF_Label>& res) const;
 
+  //! concurrent execution of functions
+  //! ==================================
+
+  //! Returns true if the function can be executed by TFunction_Scheduler concurrently
+  //! with other functions in two phases: Compute() called from a working thread
+  //! followed by Store() called sequentially.
+  //! Default implementation returns false - the function is executed by Execute().
+  Standard_EXPORT virtual bool IsConcurrent() const;
+
+  //! Computes the function located at the label <theFunction> without modification
+  //! of the document. It may be called from several threads at the same time
+  //! using the same driver, so that the implementation should only read the document
+  //! and return the computed data to be passed to Store().
+  //! Returns NULL if computation has failed; default implementation returns NULL.
+  Standard_EXPORT virtual occ::handle<Standard_Transient> Compute(
+    const TDF_Label& theFunction) const;
+
+  //! Writes the data computed by Compute() into the document and puts
+  //! the impacted labels in the logbook <log>.
+  //! Called sequentially for the function this driver is initialized by.
+  //! Returns the execution status as Execute(); default implementation calls Execute().
+  Standard_EXPORT virtual int Store(const occ::handle<Standard_Transient>& theData,
+                                    occ::handle<TFunction_Logbook>&        log) const;
+
+  //! Computes the hash of the current values of function arguments.
+  //! TFunction_Scheduler skips execution of the function while the hash remains the same.
+  //! Default implementation returns false - the function is always executed.
+  Standard_EXPORT virtual bool HashArguments(size_t& theHash) const;
+
   DEFINE_STANDARD_RTTIEXT(TFunction_Driver, Standard_Transient)
 
 protected:
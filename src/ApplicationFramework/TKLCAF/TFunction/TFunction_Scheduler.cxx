@@ -0,0 +1,210 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <TFunction_Scheduler.hxx>
+
+#include <NCollection_Vector.hxx>
+#include <OSD_Parallel.hxx>
+#include <Standard_ErrorHandler.hxx>
+#include <Standard_Failure.hxx>
+#include <TFunction_Driver.hxx>
+#include <TFunction_GraphNode.hxx>
+#include <TFunction_IFunction.hxx>
+#include <TFunction_Logbook.hxx>
+#include <TFunction_Scope.hxx>
+
+#include <algorithm>
+
+namespace
+{
+//! Function of the current wave.
+struct WaveFunction
+{
+  TDF_Label                       Label;
+  occ::handle<TFunction_Driver>   Driver;
+  occ::handle<Standard_Transient> Data; //!< data computed by concurrent driver
+  size_t                          Hash;
+  bool                            HasHash;
+  bool                            IsConcurrent;
+};
+} // namespace
+
+//=================================================================================================
+
+TFunction_Scheduler::TFunction_Scheduler()
+    : myToUseParallel(true),
+      myNbExecuted(0),
+      myNbSkipped(0),
+      myNbFailed(0)
+{
+}
+
+//=================================================================================================
+
+TFunction_Scheduler::TFunction_Scheduler(const TDF_Label& theAccess)
+    : myToUseParallel(true),
+      myNbExecuted(0),
+      myNbSkipped(0),
+      myNbFailed(0)
+{
+  Init(theAccess);
+}
+
+//=================================================================================================
+
+void TFunction_Scheduler::Init(const TDF_Label& theAccess)
+{
+  myScope = TFunction_Scope::Set(theAccess);
+  TFunction_IFunction::UpdateDependencies(theAccess);
+}
+
+//=================================================================================================
+
+bool TFunction_Scheduler::Perform()
+{
+  myNbExecuted = myNbSkipped = myNbFailed = 0;
+  if (myScope.IsNull())
+  {
+    return false;
+  }
+
+  occ::handle<TFunction_Logbook> aLog = TFunction_Logbook::Set(myScope->Label());
+  const NCollection_DoubleMap<int, TDF_Label>& aFunctions = myScope->GetFunctions();
+
+  // Count previous functions of each function and find the roots
+  NCollection_DataMap<int, int> aNbPrevious;
+  NCollection_Vector<int>       aReady;
+  for (NCollection_DoubleMap<int, TDF_Label>::Iterator anIter(aFunctions); anIter.More();
+       anIter.Next())
+  {
+    TFunction_IFunction              anIFunction(anIter.Key2());
+    occ::handle<TFunction_GraphNode> aGraphNode = anIFunction.GetGraphNode();
+    aGraphNode->SetStatus(TFunction_ES_NotExecuted);
+    aNbPrevious.Bind(anIter.Key1(), aGraphNode->GetPrevious().Extent());
+    if (aGraphNode->GetPrevious().IsEmpty())
+    {
+      aReady.Append(anIter.Key1());
+    }
+  }
+
+  NCollection_Vector<WaveFunction> aWave;
+  NCollection_Vector<int>          aConcurrent;
+  while (!aReady.IsEmpty())
+  {
+    std::sort(aReady.begin(), aReady.end());
+
+    // Skip functions with unchanged arguments, collect the others
+    aWave.Clear();
+    aConcurrent.Clear();
+    NCollection_Vector<int> aSucceeded;
+    for (NCollection_Vector<int>::Iterator anIter(aReady); anIter.More(); anIter.Next())
+    {
+      WaveFunction aFunction;
+      aFunction.Label        = aFunctions.Find1(anIter.Value());
+      aFunction.Driver       = TFunction_IFunction(aFunction.Label).GetDriver();
+      aFunction.Hash         = 0;
+      aFunction.HasHash      = aFunction.Driver->HashArguments(aFunction.Hash);
+      aFunction.IsConcurrent = false;
+
+      const size_t* aRecordedHash = myHashes.Seek(aFunction.Label);
+      if (aFunction.HasHash && aRecordedHash != nullptr && *aRecordedHash == aFunction.Hash)
+      {
+        aFunction.Driver->Validate(aLog);
+        TFunction_IFunction(aFunction.Label).SetStatus(TFunction_ES_Succeeded);
+        aSucceeded.Append(anIter.Value());
+        ++myNbSkipped;
+        continue;
+      }
+
+      aFunction.IsConcurrent = aFunction.Driver->IsConcurrent();
+      if (aFunction.IsConcurrent)
+      {
+        aConcurrent.Append(aWave.Length());
+      }
+      aWave.Append(aFunction);
+    }
+
+    // Compute concurrent functions
+    OSD_Parallel::For(
+      0,
+      aConcurrent.Length(),
+      [&aWave, &aConcurrent](const int theIndex) {
+        WaveFunction& aFunction = aWave.ChangeValue(aConcurrent.Value(theIndex));
+        try
+        {
+          OCC_CATCH_SIGNALS
+          aFunction.Data = aFunction.Driver->Compute(aFunction.Label);
+        }
+        catch (Standard_Failure const&)
+        {
+          aFunction.Data.Nullify();
+        }
+      },
+      !myToUseParallel || aConcurrent.Length() < 2);
+
+    // Store results and execute the other functions sequentially
+    for (NCollection_Vector<WaveFunction>::Iterator anIter(aWave); anIter.More(); anIter.Next())
+    {
+      const WaveFunction& aFunction = anIter.Value();
+      TFunction_IFunction anIFunction(aFunction.Label);
+      int                 aStatus = -1;
+      if (!aFunction.IsConcurrent || !aFunction.Data.IsNull())
+      {
+        aFunction.Driver->Init(aFunction.Label);
+        try
+        {
+          OCC_CATCH_SIGNALS
+          aStatus = aFunction.IsConcurrent ? aFunction.Driver->Store(aFunction.Data, aLog)
+                                           : aFunction.Driver->Execute(aLog);
+        }
+        catch (Standard_Failure const&)
+        {
+          aStatus = -1;
+        }
+      }
+
+      ++myNbExecuted;
+      if (aStatus != 0)
+      {
+        anIFunction.SetStatus(TFunction_ES_Failed);
+        myHashes.UnBind(aFunction.Label);
+        ++myNbFailed;
+        continue;
+      }
+
+      anIFunction.SetStatus(TFunction_ES_Succeeded);
+      if (aFunction.HasHash)
+      {
+        myHashes.Bind(aFunction.Label, aFunction.Hash);
+      }
+      aSucceeded.Append(aFunctions.Find2(aFunction.Label));
+    }
+
+    // Next functions become ready when all their previous functions have succeeded
+    aReady.Clear();
+    for (NCollection_Vector<int>::Iterator anIter(aSucceeded); anIter.More(); anIter.Next())
+    {
+      const TDF_Label&            aLabel = aFunctions.Find1(anIter.Value());
+      const NCollection_Map<int>& aNext  = TFunction_IFunction(aLabel).GetGraphNode()->GetNext();
+      for (NCollection_Map<int>::Iterator aNextIter(aNext); aNextIter.More(); aNextIter.Next())
+      {
+        int* aNbPrev = aNbPrevious.ChangeSeek(aNextIter.Key());
+        if (aNbPrev != nullptr && --(*aNbPrev) == 0)
+        {
+          aReady.Append(aNextIter.Key());
+        }
+      }
+    }
+  }
+  return myNbFailed == 0;
+}
@@ -0,0 +1,87 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _TFunction_Scheduler_HeaderFile
+#define _TFunction_Scheduler_HeaderFile
+
+#include <Standard.hxx>
+#include <Standard_DefineAlloc.hxx>
+#include <Standard_Handle.hxx>
+
+#include <NCollection_DataMap.hxx>
+#include <TDF_Label.hxx>
+
+class TFunction_Scope;
+
+//! Executes functions of a scope following the graph of their dependencies.
+//!
+//! The functions which previous functions have succeeded are executed by waves.
+//! Within a wave, the functions which drivers support concurrent execution
+//! (see TFunction_Driver::IsConcurrent()) are computed in parallel threads
+//! by TFunction_Driver::Compute(), then their results are written into the document
+//! by TFunction_Driver::Store() sequentially, in the order of function IDs,
+//! together with execution of the other functions of the wave.
+//!
+//! A function is skipped while the hash of its arguments computed by
+//! TFunction_Driver::HashArguments() coincides with the hash recorded by
+//! the last successful execution by this scheduler.
+class TFunction_Scheduler
+{
+public:
+  DEFINE_STANDARD_ALLOC
+
+  //! An empty constructor.
+  Standard_EXPORT TFunction_Scheduler();
+
+  //! Initializes the scheduler by the scope of functions accessed by the label.
+  Standard_EXPORT TFunction_Scheduler(const TDF_Label& theAccess);
+
+  //! Initializes the scheduler by the scope of functions accessed by the label
+  //! and updates the graph of dependencies of the functions
+  //! (see TFunction_IFunction::UpdateDependencies()).
+  Standard_EXPORT void Init(const TDF_Label& theAccess);
+
+  //! Returns true if concurrent functions are computed in parallel threads; TRUE by default.
+  bool ToUseParallel() const { return myToUseParallel; }
+
+  //! Defines usage of parallel threads for computation of concurrent functions.
+  void SetUseParallel(const bool theToUseParallel) { myToUseParallel = theToUseParallel; }
+
+  //! Executes the functions of the scope.
+  //! The execution status of each function is updated in its graph node;
+  //! functions depending on a failed function remain "not executed".
+  //! Returns false if some function has failed.
+  Standard_EXPORT bool Perform();
+
+  //! Returns the number of functions executed by the last Perform().
+  int NbExecuted() const { return myNbExecuted; }
+
+  //! Returns the number of functions skipped by the last Perform() due to unchanged arguments.
+  int NbSkipped() const { return myNbSkipped; }
+
+  //! Returns the number of functions failed by the last Perform().
+  int NbFailed() const { return myNbFailed; }
+
+  //! Forgets the recorded hashes of arguments, so that the next Perform() executes all functions.
+  void ClearHashes() { myHashes.Clear(); }
+
+private:
+  occ::handle<TFunction_Scope>           myScope;
+  NCollection_DataMap<TDF_Label, size_t> myHashes;
+  bool                                   myToUseParallel;
+  int                                    myNbExecuted;
+  int                                    myNbSkipped;
+  int                                    myNbFailed;
+};
+
+#endif // _TFunction_Scheduler_HeaderFile
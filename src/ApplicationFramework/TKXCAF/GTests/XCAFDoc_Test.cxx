@@ -12,11 +12,13 @@
 // commercial license or contractual agreement.
 
 #include <BRepPrimAPI_MakeBox.hxx>
+#include <Quantity_Color.hxx>
 #include <Standard_GUID.hxx>
 #include <TDataStd_Name.hxx>
 #include <TDocStd_Application.hxx>
 #include <TDocStd_Document.hxx>
 #include <XCAFDoc.hxx>
+#include <XCAFDoc_ColorTool.hxx>
 #include <XCAFDoc_DocumentTool.hxx>
 #include <XCAFDoc_ShapeTool.hxx>
 
@@ -105,3 +107,56 @@ TEST(XCAFDoc_Test, OCC23595_AutoNaming)
 
   // AutoNaming state will be automatically restored by the RAII guard
 }
+
+TEST(XCAFDoc_Test, MergeDuplicates)
+{
+  occ::handle<TDocStd_Application> anApp = new TDocStd_Application();
+  occ::handle<TDocStd_Document>    aDoc;
+  anApp->NewDocument("XmlXCAF", aDoc);
+  ASSERT_FALSE(aDoc.IsNull());
+  occ::handle<XCAFDoc_ShapeTool> aShTool    = XCAFDoc_DocumentTool::ShapeTool(aDoc->Main());
+  occ::handle<XCAFDoc_ColorTool> aColorTool = XCAFDoc_DocumentTool::ColorTool(aDoc->Main());
+
+  // equal boxes defined as different parts, one of them with another color
+  const TDF_Label aParts[4] = {
+    aShTool->AddShape(BRepPrimAPI_MakeBox(10., 20., 30.).Shape(), false),
+    aShTool->AddShape(BRepPrimAPI_MakeBox(10., 20., 30.).Shape(), false),
+    aShTool->AddShape(BRepPrimAPI_MakeBox(10., 20., 30.).Shape(), false),
+    aShTool->AddShape(BRepPrimAPI_MakeBox(10., 20., 31.).Shape(), false)};
+  aColorTool->SetColor(aParts[2], Quantity_Color(Quantity_NOC_RED), XCAFDoc_ColorSurf);
+
+  const TDF_Label anAsm = aShTool->NewShape();
+  TDF_Label       aComps[4];
+  for (int aPartIter = 0; aPartIter < 4; ++aPartIter)
+  {
+    gp_Trsf aTrsf;
+    aTrsf.SetTranslation(gp_Vec(50.0 * aPartIter, 0.0, 0.0));
+    aComps[aPartIter] = aShTool->AddComponent(anAsm, aParts[aPartIter], aTrsf);
+  }
+  aShTool->UpdateAssemblies();
+
+  NCollection_DataMap<TDF_Label, TDF_Label> aMerged;
+  EXPECT_EQ(1, aShTool->MergeDuplicates(aMerged));
+  aShTool->UpdateAssemblies();
+  ASSERT_TRUE(aMerged.IsBound(aParts[1]));
+  EXPECT_EQ(aParts[0], aMerged.Find(aParts[1]));
+  EXPECT_FALSE(aShTool->IsShape(aParts[1]));
+
+  TDF_Label aReferred;
+  ASSERT_TRUE(XCAFDoc_ShapeTool::GetReferredShape(aComps[1], aReferred));
+  EXPECT_EQ(aParts[0], aReferred);
+  const TopoDS_Shape aComp1 = XCAFDoc_ShapeTool::GetShape(aComps[1]);
+  EXPECT_TRUE(aComp1.IsPartner(XCAFDoc_ShapeTool::GetShape(aParts[0])));
+  EXPECT_TRUE(aComp1.Location().Transformation().TranslationPart().IsEqual(gp_XYZ(50.0, 0.0, 0.0),
+                                                                           Precision::Confusion()));
+
+  // parts with another color or geometry are kept
+  ASSERT_TRUE(XCAFDoc_ShapeTool::GetReferredShape(aComps[2], aReferred));
+  EXPECT_EQ(aParts[2], aReferred);
+  ASSERT_TRUE(XCAFDoc_ShapeTool::GetReferredShape(aComps[3], aReferred));
+  EXPECT_EQ(aParts[3], aReferred);
+  EXPECT_EQ(4, XCAFDoc_ShapeTool::NbComponents(anAsm));
+
+  aMerged.Clear();
+  EXPECT_EQ(0, aShTool->MergeDuplicates(aMerged));
+}
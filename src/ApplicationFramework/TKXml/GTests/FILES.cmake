@@ -2,4 +2,5 @@
 set(OCCT_TKXml_GTests_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
 
 set(OCCT_TKXml_GTests_FILES
+  XmlDrivers_StreamReading_Test.cxx
 )
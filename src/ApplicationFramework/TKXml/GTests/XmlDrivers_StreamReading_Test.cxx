@@ -0,0 +1,76 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <TDocStd_Application.hxx>
+#include <TDocStd_Document.hxx>
+#include <TNaming_Builder.hxx>
+#include <TNaming_NamedShape.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <XmlDrivers.hxx>
+#include <XmlDrivers_DocumentRetrievalDriver.hxx>
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+TEST(XmlDrivers_StreamReading_Test, NamedShapesAfterShapeSection)
+{
+  const TopoDS_Shape aBox = BRepPrimAPI_MakeBox(10.0, 20.0, 30.0).Shape();
+  std::ostringstream aSavedStream;
+  {
+    occ::handle<TDocStd_Application> anApp = new TDocStd_Application();
+    XmlDrivers::DefineFormat(anApp);
+    occ::handle<TDocStd_Document> aDoc;
+    anApp->NewDocument("XmlOcaf", aDoc);
+    ASSERT_FALSE(aDoc.IsNull());
+    TNaming_Builder(aDoc->Main().FindChild(1)).Generated(aBox);
+    int aFaceIter = 1;
+    for (TopExp_Explorer anExp(aBox, TopAbs_FACE); anExp.More(); anExp.Next(), ++aFaceIter)
+    {
+      TNaming_Builder(aDoc->Main().FindChild(1).FindChild(aFaceIter)).Generated(anExp.Current());
+    }
+    ASSERT_EQ(PCDM_SS_OK, anApp->SaveAs(aDoc, aSavedStream));
+    anApp->Close(aDoc);
+  }
+
+  occ::handle<TDocStd_Application> anApp = new TDocStd_Application();
+  XmlDrivers::DefineFormat(anApp);
+  occ::handle<XmlDrivers_DocumentRetrievalDriver> aDriver =
+    occ::down_cast<XmlDrivers_DocumentRetrievalDriver>(anApp->ReaderFromFormat("XmlOcaf"));
+  ASSERT_FALSE(aDriver.IsNull());
+  aDriver->SetStreamReading(true);
+
+  std::istringstream            anIStream(aSavedStream.str());
+  occ::handle<TDocStd_Document> aDoc;
+  ASSERT_EQ(PCDM_RS_OK, anApp->Open(anIStream, aDoc));
+
+  occ::handle<TNaming_NamedShape> aBoxNS;
+  ASSERT_TRUE(aDoc->Main().FindChild(1).FindAttribute(TNaming_NamedShape::GetID(), aBoxNS));
+  const TopoDS_Shape aReadBox = aBoxNS->Get();
+  ASSERT_EQ(TopAbs_SOLID, aReadBox.ShapeType());
+
+  // faces of the read shape are shared with the shapes of sub-labels
+  int aFaceIter = 1;
+  for (TopExp_Explorer anExp(aReadBox, TopAbs_FACE); anExp.More(); anExp.Next(), ++aFaceIter)
+  {
+    occ::handle<TNaming_NamedShape> aFaceNS;
+    ASSERT_TRUE(aDoc->Main().FindChild(1).FindChild(aFaceIter).FindAttribute(
+      TNaming_NamedShape::GetID(),
+      aFaceNS));
+    EXPECT_TRUE(aFaceNS->Get().IsSame(anExp.Current()));
+  }
+  EXPECT_EQ(7, aFaceIter);
+  anApp->Close(aDoc);
+}
@@ -45,6 +45,9 @@ public:
                              XmlObjMgt_Persistent&             theTarget,
                              XmlObjMgt_SRelocationTable&       theRelocTable) const override;
 
+  //! Returns TRUE as the shapes are read from the shape section of the document.
+  bool IsShapeSectionDependent() const override { return true; }
+
   //! Input the shapes from DOM element
   Standard_EXPORT void ReadShapeSection(
     const XmlObjMgt_Element&     anElement,
@@ -2,4 +2,5 @@
 set(OCCT_TKXmlL_GTests_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
 
 set(OCCT_TKXmlL_GTests_FILES
+  XmlLDrivers_StreamReading_Test.cxx
 )
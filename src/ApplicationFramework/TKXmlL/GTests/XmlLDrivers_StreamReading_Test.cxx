@@ -0,0 +1,143 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <TDataStd_Integer.hxx>
+#include <TDataStd_Name.hxx>
+#include <TDataStd_RealArray.hxx>
+#include <TDF_Reference.hxx>
+#include <TDocStd_Application.hxx>
+#include <TDocStd_Document.hxx>
+#include <XmlLDrivers.hxx>
+#include <XmlLDrivers_DocumentRetrievalDriver.hxx>
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <sstream>
+
+namespace
+{
+const int THE_NB_LABELS = 100;
+
+//! Creates application with Lite XML format.
+occ::handle<TDocStd_Application> createApplication(const bool theToStream)
+{
+  occ::handle<TDocStd_Application> anApp = new TDocStd_Application();
+  XmlLDrivers::DefineFormat(anApp);
+  occ::handle<XmlLDrivers_DocumentRetrievalDriver> aDriver =
+    occ::down_cast<XmlLDrivers_DocumentRetrievalDriver>(anApp->ReaderFromFormat("XmlLOcaf"));
+  aDriver->SetStreamReading(theToStream);
+  return anApp;
+}
+
+//! Fills the document with attributes checked by checkDocument().
+void fillDocument(const occ::handle<TDocStd_Document>& theDoc, const Standard_GUID& theUserGuid)
+{
+  theDoc->AddComment("Stream reading test");
+  for (int aLabIter = 1; aLabIter <= THE_NB_LABELS; ++aLabIter)
+  {
+    const TDF_Label aLab = theDoc->Main().FindChild(aLabIter);
+    TDataStd_Integer::Set(aLab, aLabIter);
+    TDataStd_Integer::Set(aLab, theUserGuid, -aLabIter);
+    TDataStd_Name::Set(aLab.FindChild(2).FindChild(3), "Label");
+    occ::handle<TDataStd_RealArray> anArray = TDataStd_RealArray::Set(aLab, 1, 3);
+    anArray->SetValue(3, 0.5 * aLabIter);
+    // forward reference to the label stored later
+    TDF_Reference::Set(aLab.FindChild(1), theDoc->Main().FindChild(THE_NB_LABELS + 1 - aLabIter));
+  }
+}
+
+//! Checks the document filled by fillDocument().
+void checkDocument(const occ::handle<TDocStd_Document>& theDoc, const Standard_GUID& theUserGuid)
+{
+  ASSERT_FALSE(theDoc.IsNull());
+  NCollection_Sequence<TCollection_ExtendedString> aComments;
+  theDoc->Comments(aComments);
+  ASSERT_EQ(1, aComments.Length());
+  EXPECT_TRUE(aComments.First().IsEqual("Stream reading test"));
+  for (int aLabIter = 1; aLabIter <= THE_NB_LABELS; ++aLabIter)
+  {
+    const TDF_Label aLab = theDoc->Main().FindChild(aLabIter, false);
+    ASSERT_FALSE(aLab.IsNull());
+    occ::handle<TDataStd_Integer>   anInt, anUserInt;
+    occ::handle<TDataStd_Name>      aName;
+    occ::handle<TDataStd_RealArray> anArray;
+    occ::handle<TDF_Reference>      aRef;
+    ASSERT_TRUE(aLab.FindAttribute(TDataStd_Integer::GetID(), anInt));
+    ASSERT_TRUE(aLab.FindAttribute(theUserGuid, anUserInt));
+    ASSERT_TRUE(aLab.FindChild(2).FindChild(3).FindAttribute(TDataStd_Name::GetID(), aName));
+    ASSERT_TRUE(aLab.FindAttribute(TDataStd_RealArray::GetID(), anArray));
+    ASSERT_TRUE(aLab.FindChild(1).FindAttribute(TDF_Reference::GetID(), aRef));
+    EXPECT_EQ(aLabIter, anInt->Get());
+    EXPECT_EQ(-aLabIter, anUserInt->Get());
+    EXPECT_TRUE(aName->Get().IsEqual("Label"));
+    EXPECT_EQ(0.5 * aLabIter, anArray->Value(3));
+    EXPECT_EQ(theDoc->Main().FindChild(THE_NB_LABELS + 1 - aLabIter), aRef->Get());
+  }
+}
+} // namespace
+
+TEST(XmlLDrivers_StreamReading_Test, ReadFileAndStream)
+{
+  const TCollection_ExtendedString aFileName("XmlLDrivers_StreamReading_Test.xmll");
+  const Standard_GUID              aUserGuid("6f1c3b2a-0d4e-4a5b-8c7d-9e0f1a2b3c4d");
+  std::ostringstream               aSavedStream;
+  {
+    occ::handle<TDocStd_Application> anApp = createApplication(false);
+    occ::handle<TDocStd_Document>    aDoc;
+    anApp->NewDocument("XmlLOcaf", aDoc);
+    ASSERT_FALSE(aDoc.IsNull());
+    fillDocument(aDoc, aUserGuid);
+    ASSERT_EQ(PCDM_SS_OK, anApp->SaveAs(aDoc, aFileName));
+    ASSERT_EQ(PCDM_SS_OK, anApp->SaveAs(aDoc, aSavedStream));
+    anApp->Close(aDoc);
+  }
+
+  occ::handle<TDocStd_Application> anApp = createApplication(true);
+  {
+    std::istringstream            anIStream(aSavedStream.str());
+    occ::handle<TDocStd_Document> aDoc;
+    ASSERT_EQ(PCDM_RS_OK, anApp->Open(anIStream, aDoc));
+    checkDocument(aDoc, aUserGuid);
+    anApp->Close(aDoc);
+  }
+  {
+    occ::handle<TDocStd_Document> aDoc;
+    ASSERT_EQ(PCDM_RS_OK, anApp->Open(aFileName, aDoc));
+    checkDocument(aDoc, aUserGuid);
+    anApp->Close(aDoc);
+  }
+  std::remove(TCollection_AsciiString(aFileName).ToCString());
+}
+
+TEST(XmlLDrivers_StreamReading_Test, MalformedDocument)
+{
+  std::ostringstream aSavedStream;
+  {
+    occ::handle<TDocStd_Application> anApp = createApplication(false);
+    occ::handle<TDocStd_Document>    aDoc;
+    anApp->NewDocument("XmlLOcaf", aDoc);
+    ASSERT_FALSE(aDoc.IsNull());
+    fillDocument(aDoc, Standard_GUID("6f1c3b2a-0d4e-4a5b-8c7d-9e0f1a2b3c4d"));
+    ASSERT_EQ(PCDM_SS_OK, anApp->SaveAs(aDoc, aSavedStream));
+    anApp->Close(aDoc);
+  }
+
+  // cut the document in the middle of the label tree
+  const std::string aData = aSavedStream.str();
+  std::istringstream anIStream(aData.substr(0, aData.size() / 2));
+
+  occ::handle<TDocStd_Application> anApp = createApplication(true);
+  occ::handle<TDocStd_Document>    aDoc;
+  EXPECT_NE(PCDM_RS_OK, anApp->Open(anIStream, aDoc));
+}
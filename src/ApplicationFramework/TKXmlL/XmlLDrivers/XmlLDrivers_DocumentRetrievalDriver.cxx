@@ -17,6 +17,9 @@
 #include <Message_Messenger.hxx>
 #include <Message_ProgressScope.hxx>
 #include <CDM_MetaData.hxx>
+#include <LDOMParser.hxx>
+#include <NCollection_List.hxx>
+#include <NCollection_Sequence.hxx>
 #include <OSD_FileSystem.hxx>
 #include <OSD_Path.hxx>
 #include <PCDM_DOMHeaderParser.hxx>
@@ -44,6 +47,13 @@ IMPLEMENT_STANDARD_RTTIEXT(XmlLDrivers_DocumentRetrievalDriver, PCDM_RetrievalDr
 #include <Standard_Failure.hxx>
 #include <Standard_ErrorHandler.hxx>
 
+IMPLEMENT_DOMSTRING(DocumentString, "document")
+IMPLEMENT_DOMSTRING(InfoString, "info")
+IMPLEMENT_DOMSTRING(CommentsString, "comments")
+IMPLEMENT_DOMSTRING(ShapesString, "shapes")
+IMPLEMENT_DOMSTRING(LabelString, "label")
+IMPLEMENT_DOMSTRING(TagString, "tag")
+
 #define START_REF "START_REF"
 #define END_REF "END_REF"
 
@@ -154,6 +164,7 @@ static TCollection_AsciiString AbsolutePath(const TCollection_AsciiString& aDirP
 //=================================================================================================
 
 XmlLDrivers_DocumentRetrievalDriver::XmlLDrivers_DocumentRetrievalDriver()
+    : myIsStreamReading(false)
 {
   myReaderStatus = PCDM_RS_OK;
 }
@@ -200,13 +211,17 @@ void XmlLDrivers_DocumentRetrievalDriver::Read(Standard_IStream& theIStream,
   occ::handle<Message_Messenger> aMessageDriver = theApplication->MessageDriver();
   ::take_time(~0, " +++++ Start RETRIEVE procedures ++++++", aMessageDriver);
 
-  // 1. Read DOM_Document from file
-  LDOMParser aParser;
-
   // if myFileName is not empty, "document" tag is required to be read
   // from the received document
   bool aWithoutRoot = myFileName.IsEmpty();
+  if (myIsStreamReading)
+  {
+    ReadFromStream(theIStream, aWithoutRoot, theNewDocument, theApplication, theRange);
+    return;
+  }
 
+  // 1. Read DOM_Document from file
+  LDOMParser aParser;
   if (aParser.parse(theIStream, false, aWithoutRoot))
   {
     TCollection_AsciiString aData;
@@ -234,9 +249,337 @@ void XmlLDrivers_DocumentRetrievalDriver::ReadFromDomDocument(
   const Message_ProgressRange&        theRange)
 {
   const occ::handle<Message_Messenger> aMsgDriver = theApplication->MessageDriver();
-  // 1. Read info // to be done
-  TCollection_AsciiString anAbsoluteDirectory = GetDirFromFile(myFileName);
+  // 1. Read info
   int aCurDocVersion = TDocStd_FormatVersion_VERSION_2; // minimum supported version
+  if (!ReadInfoSection(theElement, theNewDocument, theApplication, aCurDocVersion))
+  {
+    return;
+  }
+
+  // 2. Read comments
+  ReadComments(theElement, theNewDocument);
+
+  Message_ProgressScope aPS(theRange, "Reading document", 2);
+  // 2. Read Shapes section
+  if (myDrivers.IsNull())
+    myDrivers = AttributeDrivers(aMsgDriver);
+  const occ::handle<XmlMDF_ADriver> aNSDriver =
+    ReadShapeSection(theElement, aMsgDriver, aPS.Next());
+  if (!aNSDriver.IsNull())
+    ::take_time(0, " +++++ Fin reading Shapes :    ", aMsgDriver);
+
+  if (!aPS.More())
+  {
+    myReaderStatus = PCDM_RS_UserBreak;
+    return;
+  }
+
+  // 2.1. Keep document format version in RT
+  occ::handle<Storage_HeaderData> aHeaderData = new Storage_HeaderData();
+  aHeaderData->SetStorageVersion(aCurDocVersion);
+  myRelocTable.Clear();
+  myRelocTable.SetHeaderData(aHeaderData);
+
+  // 5. Read document contents
+  try
+  {
+    OCC_CATCH_SIGNALS
+#ifdef OCCT_DEBUG
+    TCollection_ExtendedString aMessage("PasteDocument");
+    aMsgDriver->Send(aMessage.ToExtString(), Message_Trace);
+#endif
+    if (!MakeDocument(theElement, theNewDocument, aPS.Next()))
+      myReaderStatus = PCDM_RS_MakeFailure;
+    else
+      myReaderStatus = PCDM_RS_OK;
+  }
+  catch (Standard_Failure const& anException)
+  {
+    TCollection_ExtendedString anErrorString(anException.GetMessageString());
+    aMsgDriver->Send(anErrorString.ToExtString(), Message_Fail);
+  }
+  if (!aPS.More())
+  {
+    myReaderStatus = PCDM_RS_UserBreak;
+    return;
+  }
+
+  //    Wipe off the shapes written to the <shapes> section
+  ShapeSetCleaning(aNSDriver);
+
+  //    Clean the relocation table.
+  //    If the application needs to use myRelocTable to retrieve additional
+  //    data from LDOM, this method should be reimplemented avoiding this step
+  myRelocTable.Clear();
+  ::take_time(0, " +++++ Fin reading data OCAF : ", aMsgDriver);
+}
+
+//=================================================================================================
+
+//! Parser decoding the document element by element (see SetStreamReading()).
+//! Labels are not kept in memory; attributes and sections of the document are decoded
+//! as soon as their sub-trees are read, except attributes referring to the shape section
+//! which is stored at the end of document.
+class XmlLDrivers_DocumentRetrievalDriver::StreamParser : public LDOMParser
+{
+public:
+  //! Main constructor.
+  StreamParser(XmlLDrivers_DocumentRetrievalDriver& theDriver,
+               const occ::handle<CDM_Document>&     theNewDocument,
+               const occ::handle<CDM_Application>&  theApplication,
+               const occ::handle<TDF_Data>&         theData,
+               const Message_ProgressRange&         theRange)
+      : myDriver(theDriver),
+        myDocument(theNewDocument),
+        myApplication(theApplication),
+        myData(theData),
+        myHeaderData(new Storage_HeaderData()),
+        myPS(theRange, "Reading document", 100, true),
+        myStatus(PCDM_RS_OK),
+        myLevel(0),
+        myIsShapesRead(false)
+  {
+    // keep document format version in RT
+    myHeaderData->SetStorageVersion(TDocStd_FormatVersion_VERSION_2);
+    myDriver.myRelocTable.Clear();
+    myDriver.myRelocTable.SetHeaderData(myHeaderData);
+    myDriver.myDrivers->CreateDrvMap(myDriverMap);
+  }
+
+  //! Returns the status set by the element handlers aborting the parsing.
+  PCDM_ReaderStatus Status() const { return myStatus; }
+
+  //! Returns the driver of shape section.
+  const occ::handle<XmlMDF_ADriver>& ShapesDriver() const { return myNSDriver; }
+
+  //! Decodes the attributes postponed in case of document without shape section.
+  bool Finish()
+  {
+    return myIsShapesRead || readShapes(getDocument().getDocumentElement());
+  }
+
+protected:
+  bool startStreamElement(const LDOM_Element& theElement, bool& theIsSubtree) override
+  {
+    theIsSubtree = false;
+    if (!myPS.More())
+    {
+      myStatus = PCDM_RS_UserBreak;
+      return true;
+    }
+    if (myLevel > 0 && !theElement.getNodeName().equals(::LabelString()))
+    {
+      // attribute or section of document
+      theIsSubtree = true;
+      return false;
+    }
+
+    if (myLevel++ == 0)
+    {
+      // document element
+      if (!theElement.getNodeName().equals(::DocumentString()))
+      {
+        myApplication->MessageDriver()->Send("Error: unexpected document element", Message_Fail);
+        myStatus = PCDM_RS_FormatFailure;
+        return true;
+      }
+      return false;
+    }
+    if (myLabels.IsEmpty())
+    {
+      myLabels.Append(myData->Root());
+      return false;
+    }
+
+    int                 aTag = 0;
+    XmlObjMgt_DOMString aTagStr(theElement.getAttribute(::TagString()));
+    if (!aTagStr.GetInteger(aTag))
+    {
+      TCollection_ExtendedString anErrorMessage =
+        TCollection_ExtendedString("Wrong Tag value for OCAF Label: ") + aTagStr;
+      myApplication->MessageDriver()->Send(anErrorMessage, Message_Fail);
+      myStatus = PCDM_RS_MakeFailure;
+      return true;
+    }
+    myLabels.Append(myLabels.Last().FindChild(aTag, true));
+    myPS.Next();
+    return false;
+  }
+
+  bool endStreamElement() override
+  {
+    if (--myLevel > 0)
+    {
+      myLabels.Remove(myLabels.Length());
+    }
+    return false;
+  }
+
+  bool readSubtree(const LDOM_Element& theElement) override
+  {
+    // the sub-tree is the only child of the root element of its own document
+    const XmlObjMgt_Element aRoot = getDocument().getDocumentElement();
+    if (myLabels.IsEmpty())
+    {
+      const XmlObjMgt_DOMString aName = theElement.getNodeName();
+      if (aName.equals(::InfoString()))
+      {
+        int aDocVersion = TDocStd_FormatVersion_VERSION_2;
+        if (!myDriver.ReadInfoSection(aRoot, myDocument, myApplication, aDocVersion))
+        {
+          myStatus = myDriver.myReaderStatus;
+          return true;
+        }
+        myHeaderData->SetStorageVersion(aDocVersion);
+      }
+      else if (aName.equals(::CommentsString()))
+      {
+        myDriver.ReadComments(aRoot, myDocument);
+      }
+      else if (aName.equals(::ShapesString()) && !readShapes(aRoot))
+      {
+        myStatus = PCDM_RS_MakeFailure;
+        return true;
+      }
+      return false;
+    }
+
+    const occ::handle<XmlMDF_ADriver> aDriver = XmlMDF::FindDriver(theElement, myDriverMap);
+    if (aDriver.IsNull())
+    {
+      return false;
+    }
+    if (!myIsShapesRead && aDriver->IsShapeSectionDependent())
+    {
+      PostponedAttribute& anAttrib = myPostponed.Append(PostponedAttribute());
+      anAttrib.Element             = theElement;
+      anAttrib.Label               = myLabels.Last();
+      anAttrib.Driver              = aDriver;
+      return false;
+    }
+    if (!XmlMDF::ReadAttribute(theElement, aDriver, myLabels.Last(), myDriver.myRelocTable))
+    {
+      myStatus = PCDM_RS_MakeFailure;
+      return true;
+    }
+    return false;
+  }
+
+private:
+  //! Reads the shape section and decodes the postponed attributes.
+  bool readShapes(const XmlObjMgt_Element& theElement)
+  {
+    myIsShapesRead = true;
+    myNSDriver =
+      myDriver.ReadShapeSection(theElement, myApplication->MessageDriver(), myPS.Next());
+    for (NCollection_List<PostponedAttribute>::Iterator anIter(myPostponed); anIter.More();
+         anIter.Next())
+    {
+      const PostponedAttribute& anAttrib = anIter.Value();
+      if (!XmlMDF::ReadAttribute(anAttrib.Element,
+                                 anAttrib.Driver,
+                                 anAttrib.Label,
+                                 myDriver.myRelocTable))
+      {
+        return false;
+      }
+    }
+    myPostponed.Clear();
+    return true;
+  }
+
+private:
+  //! Attribute which decoding is postponed till reading the shape section.
+  struct PostponedAttribute
+  {
+    XmlObjMgt_Element           Element;
+    TDF_Label                   Label;
+    occ::handle<XmlMDF_ADriver> Driver;
+  };
+
+private:
+  XmlLDrivers_DocumentRetrievalDriver&                                      myDriver;
+  occ::handle<CDM_Document>                                                 myDocument;
+  occ::handle<CDM_Application>                                              myApplication;
+  occ::handle<TDF_Data>                                                     myData;
+  occ::handle<Storage_HeaderData>                                           myHeaderData;
+  NCollection_DataMap<TCollection_AsciiString, occ::handle<XmlMDF_ADriver>> myDriverMap;
+  NCollection_Sequence<TDF_Label>                                           myLabels;
+  NCollection_List<PostponedAttribute>                                      myPostponed;
+  occ::handle<XmlMDF_ADriver>                                               myNSDriver;
+  Message_ProgressScope                                                     myPS;
+  PCDM_ReaderStatus                                                         myStatus;
+  int                                                                       myLevel;
+  bool                                                                      myIsShapesRead;
+};
+
+//=================================================================================================
+
+void XmlLDrivers_DocumentRetrievalDriver::ReadFromStream(
+  Standard_IStream&                   theIStream,
+  const bool                          theWithoutRoot,
+  const occ::handle<CDM_Document>&    theNewDocument,
+  const occ::handle<CDM_Application>& theApplication,
+  const Message_ProgressRange&        theRange)
+{
+  const occ::handle<Message_Messenger> aMsgDriver = theApplication->MessageDriver();
+  occ::handle<TDocStd_Document>        aTDoc = occ::down_cast<TDocStd_Document>(theNewDocument);
+  if (aTDoc.IsNull())
+  {
+    myReaderStatus = PCDM_RS_MakeFailure;
+    return;
+  }
+  if (myDrivers.IsNull())
+    myDrivers = AttributeDrivers(aMsgDriver);
+
+  occ::handle<TDF_Data> aTDF = new TDF_Data();
+  StreamParser          aParser(*this, theNewDocument, theApplication, aTDF, theRange);
+  try
+  {
+    OCC_CATCH_SIGNALS
+    if (aParser.parseStream(theIStream, theWithoutRoot))
+    {
+      myReaderStatus = aParser.Status();
+      if (myReaderStatus == PCDM_RS_OK)
+      {
+        TCollection_AsciiString aData;
+        std::cout << aParser.GetError(aData) << ": " << aData << std::endl;
+        myReaderStatus = PCDM_RS_FormatFailure;
+      }
+    }
+    else if (!aParser.Finish())
+    {
+      myReaderStatus = PCDM_RS_MakeFailure;
+    }
+    else
+    {
+      aTDoc->SetData(aTDF);
+      TDocStd_Owner::SetDocument(aTDF, aTDoc);
+      myReaderStatus = PCDM_RS_OK;
+    }
+  }
+  catch (Standard_Failure const& anException)
+  {
+    TCollection_ExtendedString anErrorString(anException.GetMessageString());
+    aMsgDriver->Send(anErrorString.ToExtString(), Message_Fail);
+  }
+
+  //    Wipe off the shapes written to the <shapes> section
+  ShapeSetCleaning(aParser.ShapesDriver());
+  myRelocTable.Clear();
+  ::take_time(0, " +++++ Fin reading data OCAF : ", aMsgDriver);
+}
+
+//=================================================================================================
+
+bool XmlLDrivers_DocumentRetrievalDriver::ReadInfoSection(
+  const XmlObjMgt_Element&            theElement,
+  const occ::handle<CDM_Document>&    theNewDocument,
+  const occ::handle<CDM_Application>& theApplication,
+  int&                                theDocVersion)
+{
+  const occ::handle<Message_Messenger> aMsgDriver = theApplication->MessageDriver();
+  TCollection_AsciiString anAbsoluteDirectory = GetDirFromFile(myFileName);
   TCollection_ExtendedString anInfo;
   const XmlObjMgt_Element    anInfoElem = theElement.GetChildByTagName("info");
   if (anInfoElem != nullptr)
@@ -247,7 +590,7 @@ void XmlLDrivers_DocumentRetrievalDriver::ReadFromDomDocument(
       int anIntegerVersion = 0;
       if (aDocVerStr.GetInteger(anIntegerVersion))
       {
-        aCurDocVersion = anIntegerVersion;
+        theDocVersion = anIntegerVersion;
       }
       else
       {
@@ -264,7 +607,7 @@ void XmlLDrivers_DocumentRetrievalDriver::ReadFromDomDocument(
 
     // oan: OCC22305 - check a document version and if it's greater than
     // current version of storage driver set an error status and return
-    if (aCurDocVersion > TDocStd_Document::CurrentStorageFormatVersion())
+    if (theDocVersion > TDocStd_Document::CurrentStorageFormatVersion())
     {
       TCollection_ExtendedString aMsg = TCollection_ExtendedString("error: wrong file version: ")
                                         + aDocVerStr + " while current is "
@@ -272,7 +615,7 @@ void XmlLDrivers_DocumentRetrievalDriver::ReadFromDomDocument(
       myReaderStatus = PCDM_RS_NoVersion;
       if (!aMsgDriver.IsNull())
         aMsgDriver->Send(aMsg.ToExtString(), Message_Fail);
-      return;
+      return false;
     }
 
     bool isRef = false;
@@ -434,7 +777,15 @@ void XmlLDrivers_DocumentRetrievalDriver::ReadFromDomDocument(
     }
   }
 
-  // 2. Read comments
+  return true;
+}
+
+//=================================================================================================
+
+void XmlLDrivers_DocumentRetrievalDriver::ReadComments(
+  const XmlObjMgt_Element&         theElement,
+  const occ::handle<CDM_Document>& theNewDocument)
+{
   TCollection_ExtendedString aComment;
   const XmlObjMgt_Element    aCommentsElem = theElement.GetChildByTagName("comments");
   if (aCommentsElem != nullptr)
@@ -451,59 +802,6 @@ void XmlLDrivers_DocumentRetrievalDriver::ReadFromDomDocument(
       }
     }
   }
-  Message_ProgressScope aPS(theRange, "Reading document", 2);
-  // 2. Read Shapes section
-  if (myDrivers.IsNull())
-    myDrivers = AttributeDrivers(aMsgDriver);
-  const occ::handle<XmlMDF_ADriver> aNSDriver =
-    ReadShapeSection(theElement, aMsgDriver, aPS.Next());
-  if (!aNSDriver.IsNull())
-    ::take_time(0, " +++++ Fin reading Shapes :    ", aMsgDriver);
-
-  if (!aPS.More())
-  {
-    myReaderStatus = PCDM_RS_UserBreak;
-    return;
-  }
-
-  // 2.1. Keep document format version in RT
-  occ::handle<Storage_HeaderData> aHeaderData = new Storage_HeaderData();
-  aHeaderData->SetStorageVersion(aCurDocVersion);
-  myRelocTable.Clear();
-  myRelocTable.SetHeaderData(aHeaderData);
-
-  // 5. Read document contents
-  try
-  {
-    OCC_CATCH_SIGNALS
-#ifdef OCCT_DEBUG
-    TCollection_ExtendedString aMessage("PasteDocument");
-    aMsgDriver->Send(aMessage.ToExtString(), Message_Trace);
-#endif
-    if (!MakeDocument(theElement, theNewDocument, aPS.Next()))
-      myReaderStatus = PCDM_RS_MakeFailure;
-    else
-      myReaderStatus = PCDM_RS_OK;
-  }
-  catch (Standard_Failure const& anException)
-  {
-    TCollection_ExtendedString anErrorString(anException.GetMessageString());
-    aMsgDriver->Send(anErrorString.ToExtString(), Message_Fail);
-  }
-  if (!aPS.More())
-  {
-    myReaderStatus = PCDM_RS_UserBreak;
-    return;
-  }
-
-  //    Wipe off the shapes written to the <shapes> section
-  ShapeSetCleaning(aNSDriver);
-
-  //    Clean the relocation table.
-  //    If the application needs to use myRelocTable to retrieve additional
-  //    data from LDOM, this method should be reimplemented avoiding this step
-  myRelocTable.Clear();
-  ::take_time(0, " +++++ Fin reading data OCAF : ", aMsgDriver);
 }
 
 //=================================================================================================
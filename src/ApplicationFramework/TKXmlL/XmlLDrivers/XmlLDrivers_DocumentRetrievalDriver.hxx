@@ -55,6 +55,17 @@ public:
   Standard_EXPORT virtual occ::handle<XmlMDF_ADriverTable> AttributeDrivers(
     const occ::handle<Message_Messenger>& theMsgDriver);
 
+  //! Returns TRUE if the document is decoded element by element while reading the stream
+  //! instead of building the whole DOM tree first; FALSE by default.
+  bool IsStreamReading() const { return myIsStreamReading; }
+
+  //! Sets decoding of the document element by element while reading the stream.
+  //! Only the sub-tree of a single attribute (or info, comments and shapes sections)
+  //! is kept in memory at a time; attributes referring to the shape section
+  //! (see XmlMDF_ADriver::IsShapeSectionDependent()) are decoded after reading the shapes.
+  //! ReadFromDomDocument() and MakeDocument() are not called in this mode.
+  void SetStreamReading(const bool theToStream) { myIsStreamReading = theToStream; }
+
   DEFINE_STANDARD_RTTIEXT(XmlLDrivers_DocumentRetrievalDriver, PCDM_RetrievalDriver)
 
 protected:
@@ -64,6 +75,14 @@ protected:
     const occ::handle<CDM_Application>& theApplication,
     const Message_ProgressRange&        theRange = Message_ProgressRange());
 
+  //! Reads the document from the stream element by element (see SetStreamReading()).
+  Standard_EXPORT virtual void ReadFromStream(
+    Standard_IStream&                   theIStream,
+    const bool                          theWithoutRoot,
+    const occ::handle<CDM_Document>&    theNewDocument,
+    const occ::handle<CDM_Application>& theApplication,
+    const Message_ProgressRange&        theRange = Message_ProgressRange());
+
   Standard_EXPORT virtual bool MakeDocument(
     const XmlObjMgt_Element&         thePDoc,
     const occ::handle<CDM_Document>& theTDoc,
@@ -79,6 +98,23 @@ protected:
   occ::handle<XmlMDF_ADriverTable> myDrivers;
   XmlObjMgt_RRelocationTable       myRelocTable;
   TCollection_ExtendedString       myFileName;
+
+private:
+  //! Reads the document format version, counters and references from "info" section.
+  //! Returns FALSE if the version of document is not supported.
+  bool ReadInfoSection(const XmlObjMgt_Element&            theElement,
+                       const occ::handle<CDM_Document>&    theNewDocument,
+                       const occ::handle<CDM_Application>& theApplication,
+                       int&                                theDocVersion);
+
+  //! Reads the comments section.
+  void ReadComments(const XmlObjMgt_Element&         theElement,
+                    const occ::handle<CDM_Document>& theNewDocument);
+
+private:
+  class StreamParser;
+
+  bool myIsStreamReading;
 };
 
 #endif // _XmlLDrivers_DocumentRetrievalDriver_HeaderFile
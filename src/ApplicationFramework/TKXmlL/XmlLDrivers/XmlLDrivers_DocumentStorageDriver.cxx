@@ -29,6 +29,7 @@
 #include <TCollection_AsciiString.hxx>
 #include <TCollection_ExtendedString.hxx>
 #include <NCollection_Sequence.hxx>
+#include <TDF_Data.hxx>
 #include <TDocStd_Document.hxx>
 #include <XmlLDrivers.hxx>
 #include <XmlLDrivers_DocumentStorageDriver.hxx>
@@ -85,6 +86,11 @@ void XmlLDrivers_DocumentStorageDriver::Write(const occ::handle<CDM_Document>&
 {
   myFileName = theFileName;
 
+  // deferred attributes might be loaded from the file to be overwritten
+  occ::handle<TDocStd_Document> aDoc = occ::down_cast<TDocStd_Document>(theDocument);
+  if (!aDoc.IsNull())
+    aDoc->GetData()->LoadDeferredAttributes();
+
   const occ::handle<OSD_FileSystem>& aFileSystem = OSD_FileSystem::DefaultFileSystem();
   std::shared_ptr<std::ostream>      aFileStream =
     aFileSystem->OpenOStream(theFileName, std::ios::out | std::ios::binary);
@@ -380,6 +386,8 @@ int XmlLDrivers_DocumentStorageDriver::MakeDocument(const occ::handle<CDM_Docume
   {
     //    myRelocTable.SetDocument (theElement.getOwnerDocument());
     occ::handle<TDF_Data> aTDF = TDOC->GetData();
+    // attributes are enumerated by TDF_AttributeIterator not loading deferred content
+    aTDF->LoadDeferredAttributes();
 
     //      Find MessageDriver and pass it to AttributeDrivers()
     occ::handle<CDM_Application>   anApplication = theTDoc->Application();
@@ -224,83 +224,13 @@ int XmlMDF::ReadSubTree(
       else
       {
         // read attribute
-        XmlObjMgt_DOMString aName = anElem.getNodeName();
-
-#ifdef DATATYPE_MIGRATION
-        TCollection_AsciiString newName;
-        if (Storage_Schema::CheckTypeMigration(aName, newName))
-        {
-  #ifdef OCCT_DEBUG
-          std::cout << "CheckTypeMigration:OldType = " << aName.GetString()
-                    << " Len = " << strlen(aName.GetString()) << std::endl;
-          std::cout << "CheckTypeMigration:NewType = " << newName << " Len = " << newName.Length()
-                    << std::endl;
-  #endif
-          aName = newName.ToCString();
-        }
-#endif
-
-        if (theDriverMap.IsBound(aName))
+        const occ::handle<XmlMDF_ADriver> aDriver = FindDriver(anElem, theDriverMap);
+        if (!aDriver.IsNull())
         {
           count++;
-          const occ::handle<XmlMDF_ADriver>& driver = theDriverMap.Find(aName);
-          XmlObjMgt_Persistent               pAtt(anElem);
-          int                                anID = pAtt.Id();
-          if (anID <= 0)
-          { // check for ID validity
-            TCollection_ExtendedString anErrorMessage =
-              TCollection_ExtendedString("Wrong ID of OCAF attribute with type ") + aName;
-            driver->myMessageDriver->Send(anErrorMessage, Message_Fail);
+          if (!ReadAttribute(anElem, aDriver, theLabel, theRelocTable))
             return -1;
-          }
-          occ::handle<TDF_Attribute> tAtt;
-          bool                       isBound = theRelocTable.IsBound(anID);
-          if (isBound)
-            tAtt = occ::down_cast<TDF_Attribute>(theRelocTable.Find(anID));
-          else
-            tAtt = driver->NewEmpty();
-
-          if (tAtt->Label().IsNull())
-          {
-            try
-            {
-              theLabel.AddAttribute(tAtt);
-            }
-            catch (const Standard_DomainError&)
-            {
-              // For attributes that can have arbitrary GUID (e.g. TDataStd_Integer), exception
-              // will be raised in valid case if attribute of that type with default GUID is already
-              // present  on the same label; the reason is that actual GUID will be read later.
-              // To avoid this, set invalid (null) GUID to the newly added attribute (see #29669)
-              static const Standard_GUID fbidGuid;
-              tAtt->SetID(fbidGuid);
-              theLabel.AddAttribute(tAtt);
-            }
-          }
-          else
-            driver->myMessageDriver->Send(TCollection_ExtendedString("XmlDriver warning: ")
-                                            + "attempt to attach attribute " + aName
-                                            + " to a second label",
-                                          Message_Warning);
-
-          if (!driver->Paste(pAtt, tAtt, theRelocTable))
-          {
-            // error converting persistent to transient
-            driver->myMessageDriver->Send(TCollection_ExtendedString("XmlDriver warning: ")
-                                            + "failure reading attribute " + aName,
-                                          Message_Warning);
-          }
-          else if (isBound == false)
-            theRelocTable.Bind(anID, tAtt);
-        }
-#ifdef OCCT_DEBUG
-        else
-        {
-          const TCollection_AsciiString anAsciiName = aName;
-          std::cerr << "XmlDriver warning: "
-                    << "label contains object of unknown type " << anAsciiName << std::endl;
         }
-#endif
       }
     }
     // anElem = (const XmlObjMgt_Element &) anElem.getNextSibling();
@@ -321,6 +251,100 @@ int XmlMDF::ReadSubTree(
 
 //=================================================================================================
 
+occ::handle<XmlMDF_ADriver> XmlMDF::FindDriver(
+  const XmlObjMgt_Element&                                                         theElement,
+  const NCollection_DataMap<TCollection_AsciiString, occ::handle<XmlMDF_ADriver>>& theDriverMap)
+{
+  XmlObjMgt_DOMString aName = theElement.getNodeName();
+
+#ifdef DATATYPE_MIGRATION
+  TCollection_AsciiString newName;
+  if (Storage_Schema::CheckTypeMigration(aName, newName))
+  {
+  #ifdef OCCT_DEBUG
+    std::cout << "CheckTypeMigration:OldType = " << aName.GetString()
+              << " Len = " << strlen(aName.GetString()) << std::endl;
+    std::cout << "CheckTypeMigration:NewType = " << newName << " Len = " << newName.Length()
+              << std::endl;
+  #endif
+    aName = newName.ToCString();
+  }
+#endif
+
+  const occ::handle<XmlMDF_ADriver>* aDriver = theDriverMap.Seek(aName);
+  if (aDriver == nullptr)
+  {
+#ifdef OCCT_DEBUG
+    const TCollection_AsciiString anAsciiName = aName;
+    std::cerr << "XmlDriver warning: "
+              << "label contains object of unknown type " << anAsciiName << std::endl;
+#endif
+    return occ::handle<XmlMDF_ADriver>();
+  }
+  return *aDriver;
+}
+
+//=================================================================================================
+
+bool XmlMDF::ReadAttribute(const XmlObjMgt_Element&           theElement,
+                           const occ::handle<XmlMDF_ADriver>& theDriver,
+                           const TDF_Label&                   theLabel,
+                           XmlObjMgt_RRelocationTable&        theRelocTable)
+{
+  const TCollection_AsciiString& aName = theDriver->TypeName();
+  XmlObjMgt_Persistent           pAtt(theElement);
+  int                            anID = pAtt.Id();
+  if (anID <= 0)
+  { // check for ID validity
+    TCollection_ExtendedString anErrorMessage =
+      TCollection_ExtendedString("Wrong ID of OCAF attribute with type ") + aName;
+    theDriver->myMessageDriver->Send(anErrorMessage, Message_Fail);
+    return false;
+  }
+  occ::handle<TDF_Attribute> tAtt;
+  bool                       isBound = theRelocTable.IsBound(anID);
+  if (isBound)
+    tAtt = occ::down_cast<TDF_Attribute>(theRelocTable.Find(anID));
+  else
+    tAtt = theDriver->NewEmpty();
+
+  if (tAtt->Label().IsNull())
+  {
+    try
+    {
+      theLabel.AddAttribute(tAtt);
+    }
+    catch (const Standard_DomainError&)
+    {
+      // For attributes that can have arbitrary GUID (e.g. TDataStd_Integer), exception
+      // will be raised in valid case if attribute of that type with default GUID is already
+      // present  on the same label; the reason is that actual GUID will be read later.
+      // To avoid this, set invalid (null) GUID to the newly added attribute (see #29669)
+      static const Standard_GUID fbidGuid;
+      tAtt->SetID(fbidGuid);
+      theLabel.AddAttribute(tAtt);
+    }
+  }
+  else
+    theDriver->myMessageDriver->Send(TCollection_ExtendedString("XmlDriver warning: ")
+                                       + "attempt to attach attribute " + aName
+                                       + " to a second label",
+                                     Message_Warning);
+
+  if (!theDriver->Paste(pAtt, tAtt, theRelocTable))
+  {
+    // error converting persistent to transient
+    theDriver->myMessageDriver->Send(TCollection_ExtendedString("XmlDriver warning: ")
+                                       + "failure reading attribute " + aName,
+                                     Message_Warning);
+  }
+  else if (isBound == false)
+    theRelocTable.Bind(anID, tAtt);
+  return true;
+}
+
+//=================================================================================================
+
 void XmlMDF::AddDrivers(const occ::handle<XmlMDF_ADriverTable>& aDriverTable,
                         const occ::handle<Message_Messenger>&   aMessageDriver)
 {
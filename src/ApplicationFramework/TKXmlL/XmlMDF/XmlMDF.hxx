@@ -73,6 +73,20 @@ public:
     const occ::handle<XmlMDF_ADriverTable>& aDrivers,
     const Message_ProgressRange&            theRange = Message_ProgressRange());
 
+  //! Returns the driver of the attribute stored in the element
+  //! or NULL handle if the type of attribute is unknown.
+  Standard_EXPORT static occ::handle<XmlMDF_ADriver> FindDriver(
+    const XmlObjMgt_Element&                                                         theElement,
+    const NCollection_DataMap<TCollection_AsciiString, occ::handle<XmlMDF_ADriver>>& theDriverMap);
+
+  //! Reads the attribute stored in the element using the driver and attaches it to the label.
+  //! Used by retrieval drivers decoding the document element by element.
+  //! Returns False on error (failure of pasting the attribute content is reported as warning).
+  Standard_EXPORT static bool ReadAttribute(const XmlObjMgt_Element&           theElement,
+                                            const occ::handle<XmlMDF_ADriver>& theDriver,
+                                            const TDF_Label&                   theLabel,
+                                            XmlObjMgt_RRelocationTable&        theRelocTable);
+
   //! Adds the attribute storage drivers to <aDriverSeq>.
   Standard_EXPORT static void AddDrivers(const occ::handle<XmlMDF_ADriverTable>& aDriverTable,
                                          const occ::handle<Message_Messenger>&   theMessageDriver);
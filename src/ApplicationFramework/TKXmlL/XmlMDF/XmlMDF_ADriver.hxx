@@ -65,6 +65,10 @@ public:
                                      XmlObjMgt_Persistent&             aTarget,
                                      XmlObjMgt_SRelocationTable&       aRelocTable) const = 0;
 
+  //! Returns TRUE if the content of attribute refers to the shape section of the document,
+  //! so that streaming retrieval should postpone its pasting until the shapes are read.
+  virtual bool IsShapeSectionDependent() const { return false; }
+
   //! Returns the current message driver of this driver
   const occ::handle<Message_Messenger>& MessageDriver() const { return myMessageDriver; }
 
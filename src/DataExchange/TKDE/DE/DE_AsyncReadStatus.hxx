@@ -0,0 +1,28 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#ifndef _DE_AsyncReadStatus_HeaderFile
+#define _DE_AsyncReadStatus_HeaderFile
+
+//! Status of the reading performed by DE_AsyncReader.
+enum DE_AsyncReadStatus
+{
+  DE_AsyncReadStatus_Pending, //!< reading has not been started yet
+  DE_AsyncReadStatus_Running, //!< reading is performed by the background thread
+  DE_AsyncReadStatus_Done,    //!< file has been read successfully
+  DE_AsyncReadStatus_Failed,  //!< file cannot be read or reading has been interrupted by exception
+  DE_AsyncReadStatus_Aborted  //!< reading has been cancelled
+};
+
+#endif // _DE_AsyncReadStatus_HeaderFile
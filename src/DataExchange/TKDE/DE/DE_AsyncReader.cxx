@@ -0,0 +1,205 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <DE_AsyncReader.hxx>
+
+#include <Message_ProgressScope.hxx>
+#include <OSD.hxx>
+#include <Standard_ErrorHandler.hxx>
+#include <TDocStd_Document.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(DE_AsyncReader, Standard_Transient)
+
+//=================================================================================================
+
+void DE_AsyncReader::ProgressIndicator::Show(const Message_ProgressScope& theScope, const bool)
+{
+  TCollection_AsciiString aPhase;
+  for (const Message_ProgressScope* aScope = &theScope; aScope != nullptr;
+       aScope                              = aScope->Parent())
+  {
+    if (aScope->Name() != nullptr && *aScope->Name() != '\0')
+    {
+      aPhase = aPhase.IsEmpty() ? TCollection_AsciiString(aScope->Name())
+                                : TCollection_AsciiString(aScope->Name()) + " / " + aPhase;
+    }
+  }
+
+  std::lock_guard<std::mutex> aLock(myReader->myMutex);
+  myReader->myProgress.Phase      = aPhase;
+  myReader->myProgress.Position   = GetPosition();
+  myReader->myProgress.PhaseValue = theScope.Value();
+  myReader->myProgress.PhaseMax   = theScope.MaxValue();
+}
+
+//=================================================================================================
+
+DE_AsyncReader::DE_AsyncReader(const occ::handle<DE_Wrapper>& theWrapper)
+    : myWrapper(!theWrapper.IsNull() ? theWrapper : DE_Wrapper::GlobalWrapper()),
+      myDoneEvent(true),
+      myToCancel(false),
+      myStatus(DE_AsyncReadStatus_Pending),
+      myIsStarted(false),
+      myToCatchFpe(false)
+{
+  myThread.SetFunction(&DE_AsyncReader::runThread);
+}
+
+//=================================================================================================
+
+DE_AsyncReader::~DE_AsyncReader()
+{
+  Cancel();
+  Wait();
+}
+
+//=================================================================================================
+
+bool DE_AsyncReader::Start(const TCollection_AsciiString&       thePath,
+                           const occ::handle<TDocStd_Document>& theDocument)
+{
+  if (theDocument.IsNull())
+  {
+    return false;
+  }
+  return start(thePath, theDocument);
+}
+
+//=================================================================================================
+
+bool DE_AsyncReader::Start(const TCollection_AsciiString& thePath)
+{
+  return start(thePath, occ::handle<TDocStd_Document>());
+}
+
+//=================================================================================================
+
+bool DE_AsyncReader::start(const TCollection_AsciiString&       thePath,
+                           const occ::handle<TDocStd_Document>& theDocument)
+{
+  if (myStatus == DE_AsyncReadStatus_Running)
+  {
+    return false;
+  }
+  Wait();
+
+  myWorkWrapper = myWrapper->DeepCopy();
+  myPath        = thePath;
+  myDocument    = theDocument;
+  myShape.Nullify();
+  myMessage.Clear();
+  {
+    std::lock_guard<std::mutex> aLock(myMutex);
+    myProgress = ProgressState();
+  }
+  myToCancel = false;
+  myStatus   = DE_AsyncReadStatus_Running;
+  myDoneEvent.Reset();
+  myToCatchFpe = OSD::ToCatchFloatingSignals();
+  myIsStarted  = true;
+  if (!myThread.Run(this))
+  {
+    myIsStarted = false;
+    myStatus    = DE_AsyncReadStatus_Failed;
+    myMessage   = "Error: background thread cannot be started";
+    myDoneEvent.Set();
+    return false;
+  }
+  return true;
+}
+
+//=================================================================================================
+
+bool DE_AsyncReader::Wait(int theTimeMilliseconds)
+{
+  if (!myIsStarted)
+  {
+    return true;
+  }
+
+  if (theTimeMilliseconds < 0)
+  {
+    myDoneEvent.Wait();
+  }
+  else if (!myDoneEvent.Wait(theTimeMilliseconds))
+  {
+    return false;
+  }
+  myThread.Wait();
+  myIsStarted = false;
+  return true;
+}
+
+//=================================================================================================
+
+DE_AsyncReader::ProgressState DE_AsyncReader::Progress() const
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  return myProgress;
+}
+
+//=================================================================================================
+
+bool DE_AsyncReader::performRead(const occ::handle<DE_Wrapper>& theWrapper,
+                                 const Message_ProgressRange&   theProgress)
+{
+  return !myDocument.IsNull() ? theWrapper->Read(myPath, myDocument, theProgress)
+                              : theWrapper->Read(myPath, myShape, theProgress);
+}
+
+//=================================================================================================
+
+void DE_AsyncReader::performThread()
+{
+  OSD::SetThreadLocalSignal(OSD::SignalMode(), myToCatchFpe);
+  occ::handle<ProgressIndicator> aProgress = new ProgressIndicator(this);
+  DE_AsyncReadStatus             aStatus   = DE_AsyncReadStatus_Failed;
+  try
+  {
+    OCC_CATCH_SIGNALS
+    const bool isRead = performRead(myWorkWrapper, aProgress->Start());
+    if (myToCancel)
+    {
+      aStatus = DE_AsyncReadStatus_Aborted;
+    }
+    else if (isRead)
+    {
+      aStatus = DE_AsyncReadStatus_Done;
+    }
+    else
+    {
+      myMessage = TCollection_AsciiString("Error: file '") + myPath + "' cannot be read";
+    }
+  }
+  catch (const Standard_Failure& theFailure)
+  {
+    myMessage = TCollection_AsciiString("Error: exception ") + theFailure.DynamicType()->Name()
+                + " [" + theFailure.GetMessageString() + "]";
+  }
+  catch (const std::exception& theException)
+  {
+    myMessage = TCollection_AsciiString("Error: exception [") + theException.what() + "]";
+  }
+  myWorkWrapper.Nullify();
+  myStatus = aStatus;
+  myDoneEvent.Set();
+}
+
+//=================================================================================================
+
+void* DE_AsyncReader::runThread(void* theReader)
+{
+  static_cast<DE_AsyncReader*>(theReader)->performThread();
+  return nullptr;
+}
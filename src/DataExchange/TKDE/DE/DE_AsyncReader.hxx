@@ -0,0 +1,169 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#ifndef _DE_AsyncReader_HeaderFile
+#define _DE_AsyncReader_HeaderFile
+
+#include <DE_AsyncReadStatus.hxx>
+#include <DE_Wrapper.hxx>
+#include <Message_ProgressIndicator.hxx>
+#include <OSD_Thread.hxx>
+#include <Standard_Condition.hxx>
+#include <TopoDS_Shape.hxx>
+
+#include <atomic>
+#include <mutex>
+
+//! Tool reading a file by DE_Wrapper within a background thread.
+//!
+//! Reading is started by Start() and returns immediately; the calling (e.g. GUI) thread
+//! may poll the progress of the current phase with Progress(), request cancellation with Cancel()
+//! and wait for the result with Wait().
+//! Cancellation is delivered to the translator through Message_ProgressIndicator::UserBreak(),
+//! so that it is checked by parsing and transfer loops tracking Message_ProgressScope.
+//!
+//! The reading is performed with a deep copy of the wrapper (see DE_Wrapper::DeepCopy())
+//! made at Start(), so that the prototype wrapper may be used or modified meanwhile.
+//! The target document should not be accessed by other threads until reading is finished,
+//! as OCAF document is not thread-safe.
+class DE_AsyncReader : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(DE_AsyncReader, Standard_Transient)
+public:
+  //! Snapshot of the reading progress.
+  struct ProgressState
+  {
+    TCollection_AsciiString Phase;      //!< names of active progress scopes, outer to inner
+    double                  Position;   //!< overall position within [0, 1] range
+    double                  PhaseValue; //!< current value of the innermost progress scope
+    double                  PhaseMax;   //!< maximum value of the innermost progress scope
+
+    ProgressState()
+        : Position(0.0),
+          PhaseValue(0.0),
+          PhaseMax(0.0)
+    {
+    }
+  };
+
+public:
+  //! Main constructor.
+  //! @param[in] theWrapper prototype wrapper defining configuration of reading;
+  //!                       DE_Wrapper::GlobalWrapper() is used if NULL
+  Standard_EXPORT DE_AsyncReader(
+    const occ::handle<DE_Wrapper>& theWrapper = occ::handle<DE_Wrapper>());
+
+  //! Destructor, cancels the reading and waits for the background thread.
+  Standard_EXPORT ~DE_AsyncReader() override;
+
+  //! Return prototype wrapper.
+  const occ::handle<DE_Wrapper>& Wrapper() const { return myWrapper; }
+
+  //! Start reading the file into the document.
+  //! @param[in] thePath     path to the file to read
+  //! @param[in] theDocument document to fill
+  //! @return FALSE if reading is already running or document is NULL
+  Standard_EXPORT bool Start(const TCollection_AsciiString&       thePath,
+                             const occ::handle<TDocStd_Document>& theDocument);
+
+  //! Start reading the file into the shape (see Shape()).
+  //! @param[in] thePath path to the file to read
+  //! @return FALSE if reading is already running
+  Standard_EXPORT bool Start(const TCollection_AsciiString& thePath);
+
+  //! Request cancellation of the reading; returns immediately.
+  //! Use Wait() to wait for the translator to stop.
+  void Cancel() { myToCancel = true; }
+
+  //! Return TRUE if cancellation has been requested.
+  bool IsCancelled() const { return myToCancel; }
+
+  //! Wait for the reading to be finished.
+  //! @param[in] theTimeMilliseconds time to wait, negative for infinite
+  //! @return TRUE if reading is finished (or has not been started)
+  Standard_EXPORT bool Wait(int theTimeMilliseconds = -1);
+
+  //! Return reading status.
+  DE_AsyncReadStatus Status() const { return myStatus; }
+
+  //! Return TRUE if reading is finished (successfully or not).
+  bool IsFinished() const
+  {
+    const DE_AsyncReadStatus aStatus = myStatus;
+    return aStatus != DE_AsyncReadStatus_Pending && aStatus != DE_AsyncReadStatus_Running;
+  }
+
+  //! Return snapshot of the reading progress; can be called from any thread.
+  Standard_EXPORT ProgressState Progress() const;
+
+  //! Return the target document.
+  const occ::handle<TDocStd_Document>& Document() const { return myDocument; }
+
+  //! Return the read shape; should be called after reading is finished.
+  const TopoDS_Shape& Shape() const { return myShape; }
+
+  //! Return error message of failed reading.
+  const TCollection_AsciiString& ErrorMessage() const { return myMessage; }
+
+protected:
+  //! Launch the background thread.
+  Standard_EXPORT bool start(const TCollection_AsciiString&       thePath,
+                             const occ::handle<TDocStd_Document>& theDocument);
+
+  //! Perform reading; called from the background thread.
+  Standard_EXPORT virtual bool performRead(const occ::handle<DE_Wrapper>& theWrapper,
+                                           const Message_ProgressRange&   theProgress);
+
+private:
+  //! Progress indicator recording the progress state and delivering cancellation.
+  class ProgressIndicator : public Message_ProgressIndicator
+  {
+  public:
+    ProgressIndicator(DE_AsyncReader* theReader)
+        : myReader(theReader)
+    {
+    }
+
+    bool UserBreak() override { return myReader->myToCancel; }
+
+    void Show(const Message_ProgressScope& theScope, const bool isForce) override;
+
+  private:
+    DE_AsyncReader* myReader;
+  };
+
+  //! Thread function.
+  void performThread();
+
+  //! Thread creation callback.
+  static void* runThread(void* theReader);
+
+private:
+  occ::handle<DE_Wrapper>         myWrapper;     //!< prototype wrapper
+  occ::handle<DE_Wrapper>         myWorkWrapper; //!< copy of the wrapper used by the thread
+  TCollection_AsciiString         myPath;        //!< path to the file to read
+  occ::handle<TDocStd_Document>   myDocument;    //!< target document
+  TopoDS_Shape                    myShape;       //!< read shape
+  TCollection_AsciiString         myMessage;     //!< error message
+  OSD_Thread                      myThread;      //!< background thread
+  Standard_Condition              myDoneEvent;   //!< raises when reading is finished
+  mutable std::mutex              myMutex;       //!< mutex for myProgress
+  ProgressState                   myProgress;    //!< last recorded progress
+  std::atomic<bool>               myToCancel;    //!< cancellation flag
+  std::atomic<DE_AsyncReadStatus> myStatus;      //!< reading status
+  bool                            myIsStarted;   //!< flag indicating launched thread
+  bool                            myToCatchFpe;  //!< floating point signals mode of caller thread
+};
+
+#endif // _DE_AsyncReader_HeaderFile
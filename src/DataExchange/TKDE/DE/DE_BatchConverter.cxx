@@ -0,0 +1,293 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <DE_BatchConverter.hxx>
+
+#include <Message_ProgressScope.hxx>
+#include <OSD_File.hxx>
+#include <OSD_Path.hxx>
+#include <OSD_Timer.hxx>
+#include <Standard_ErrorHandler.hxx>
+#include <TopoDS_Shape.hxx>
+
+#include <algorithm>
+#include <condition_variable>
+#include <vector>
+
+namespace
+{
+//! Default factor applied to the input file size for estimating memory used by a job.
+static const double THE_DEFAULT_MEMORY_FACTOR = 10.0;
+
+//! Auxiliary class admitting jobs for execution according to their priority and memory budget.
+class BatchScheduler
+{
+public:
+  //! Main constructor.
+  //! @param[in] theJobs    jobs
+  //! @param[in] thePending indexes of jobs to perform sorted by priority
+  //! @param[in] theMemory  memory estimations of jobs
+  //! @param[in] theLimit   memory budget, 0 for unlimited
+  BatchScheduler(const NCollection_Array1<DE_BatchJob>& theJobs,
+                 const std::vector<int>&                thePending,
+                 const NCollection_Array1<size_t>&      theMemory,
+                 const size_t                           theLimit)
+      : myJobs(theJobs),
+        myMemory(theMemory),
+        myPending(thePending),
+        myLimit(theLimit),
+        myMemInUse(0),
+        myNbRunning(0)
+  {
+  }
+
+  //! Wait until the next job can be started.
+  //! @return index of the job or -1 if there are no more jobs
+  int Acquire()
+  {
+    std::unique_lock<std::mutex> aLock(myMutex);
+    for (;;)
+    {
+      if (myPending.empty())
+      {
+        return -1;
+      }
+
+      // only jobs of the top priority are considered, so that lower priority jobs
+      // do not overtake (and starve) a large job waiting for the memory to be released
+      const int aTopPriority = myJobs.Value(myPending.front()).Priority;
+      for (std::vector<int>::iterator aJobIter = myPending.begin();
+           aJobIter != myPending.end() && myJobs.Value(*aJobIter).Priority == aTopPriority;
+           ++aJobIter)
+      {
+        const int    aJobIndex = *aJobIter;
+        const size_t aMemory   = myMemory.Value(aJobIndex);
+        if (myNbRunning == 0 || myLimit == 0 || myMemInUse + aMemory <= myLimit)
+        {
+          myPending.erase(aJobIter);
+          myMemInUse += aMemory;
+          ++myNbRunning;
+          return aJobIndex;
+        }
+      }
+      myCondition.wait(aLock);
+    }
+  }
+
+  //! Release resources of the finished job.
+  void Release(const int theJobIndex)
+  {
+    {
+      std::lock_guard<std::mutex> aLock(myMutex);
+      myMemInUse -= myMemory.Value(theJobIndex);
+      --myNbRunning;
+    }
+    myCondition.notify_all();
+  }
+
+  //! Cancel all pending jobs.
+  void Abort()
+  {
+    {
+      std::lock_guard<std::mutex> aLock(myMutex);
+      myPending.clear();
+    }
+    myCondition.notify_all();
+  }
+
+private:
+  const NCollection_Array1<DE_BatchJob>& myJobs;
+  const NCollection_Array1<size_t>&      myMemory;
+  std::vector<int>                       myPending;
+  std::mutex                             myMutex;
+  std::condition_variable                myCondition;
+  size_t                                 myLimit;
+  size_t                                 myMemInUse;
+  int                                    myNbRunning;
+};
+} // namespace
+
+//=================================================================================================
+
+DE_BatchConverter::DE_BatchConverter(const occ::handle<DE_Wrapper>& theWrapper)
+    : myWrapper(!theWrapper.IsNull() ? theWrapper : DE_Wrapper::GlobalWrapper()),
+      myThreadPool(OSD_ThreadPool::DefaultPool()),
+      myNbThreads(-1),
+      myMemoryLimit(0),
+      myMemoryFactor(THE_DEFAULT_MEMORY_FACTOR)
+{
+}
+
+//=================================================================================================
+
+DE_BatchConverter::~DE_BatchConverter() {}
+
+//=================================================================================================
+
+bool DE_BatchConverter::Perform(NCollection_Array1<DE_BatchJob>& theJobs,
+                                const Message_ProgressRange&     theProgress)
+{
+  std::vector<int> aPending;
+  for (int aJobIter = theJobs.Lower(); aJobIter <= theJobs.Upper(); ++aJobIter)
+  {
+    if (theJobs.Value(aJobIter).Status == DE_BatchJobStatus_Pending)
+    {
+      aPending.push_back(aJobIter);
+    }
+  }
+  if (aPending.empty())
+  {
+    return true;
+  }
+  std::stable_sort(aPending.begin(),
+                   aPending.end(),
+                   [&theJobs](const int theJob1, const int theJob2) {
+                     return theJobs.Value(theJob1).Priority > theJobs.Value(theJob2).Priority;
+                   });
+
+  NCollection_Array1<size_t>                aMemory(theJobs.Lower(), theJobs.Upper());
+  NCollection_Array1<Message_ProgressRange> aRanges(theJobs.Lower(), theJobs.Upper());
+  Message_ProgressScope aPS(theProgress, "Batch conversion", (double)aPending.size());
+  for (std::vector<int>::const_iterator aJobIter = aPending.begin(); aJobIter != aPending.end();
+       ++aJobIter)
+  {
+    const DE_BatchJob& aJob    = theJobs.Value(*aJobIter);
+    size_t             aJobMem = aJob.EstimatedMemory;
+    if (aJobMem == 0)
+    {
+      OSD_File aFile(OSD_Path(aJob.InputPath));
+      if (aFile.Exists())
+      {
+        aJobMem = size_t(double(aFile.Size()) * myMemoryFactor);
+      }
+    }
+    aMemory.SetValue(*aJobIter, aJobMem);
+    aRanges.SetValue(*aJobIter, aPS.Next());
+  }
+
+  const occ::handle<OSD_ThreadPool>& aPool =
+    !myThreadPool.IsNull() ? myThreadPool : OSD_ThreadPool::DefaultPool();
+  OSD_ThreadPool::Launcher aLauncher(*aPool, myNbThreads);
+  const int aNbWorkers = std::min(aLauncher.NbThreads(), (int)aPending.size());
+
+  BatchScheduler aScheduler(theJobs, aPending, aMemory, myMemoryLimit);
+  std::mutex     aCopyMutex;
+  aLauncher.Perform(0, aNbWorkers, [&](int, int) {
+    for (;;)
+    {
+      if (aPS.UserBreak())
+      {
+        aScheduler.Abort();
+        return;
+      }
+      const int aJobIndex = aScheduler.Acquire();
+      if (aJobIndex < 0)
+      {
+        return;
+      }
+
+      DE_BatchJob&            aJob = theJobs.ChangeValue(aJobIndex);
+      occ::handle<DE_Wrapper> aWrapper;
+      {
+        std::lock_guard<std::mutex> aLock(aCopyMutex);
+        aWrapper = myWrapper->DeepCopy();
+      }
+
+      OSD_Timer aTimer;
+      aTimer.Start();
+      try
+      {
+        OCC_CATCH_SIGNALS
+        performJob(aJob, aWrapper, aRanges.Value(aJobIndex));
+      }
+      catch (const Standard_Failure& theFailure)
+      {
+        aJob.Status  = DE_BatchJobStatus_Failed;
+        aJob.Message = TCollection_AsciiString("Error: exception ")
+                       + theFailure.DynamicType()->Name() + " [" + theFailure.GetMessageString()
+                       + "]";
+      }
+      catch (const std::exception& theException)
+      {
+        aJob.Status  = DE_BatchJobStatus_Failed;
+        aJob.Message = TCollection_AsciiString("Error: exception [") + theException.what() + "]";
+      }
+      aTimer.Stop();
+      aJob.ElapsedTime = aTimer.ElapsedTime();
+      aScheduler.Release(aJobIndex);
+    }
+  });
+
+  bool isDone = true;
+  for (std::vector<int>::const_iterator aJobIter = aPending.begin(); aJobIter != aPending.end();
+       ++aJobIter)
+  {
+    DE_BatchJob& aJob = theJobs.ChangeValue(*aJobIter);
+    if (aJob.Status == DE_BatchJobStatus_Pending)
+    {
+      aJob.Status = DE_BatchJobStatus_Aborted;
+    }
+    isDone = isDone && aJob.Status == DE_BatchJobStatus_Done;
+  }
+  return isDone;
+}
+
+//=================================================================================================
+
+occ::handle<TDocStd_Document> DE_BatchConverter::createDocument(const DE_BatchJob&)
+{
+  return occ::handle<TDocStd_Document>();
+}
+
+//=================================================================================================
+
+void DE_BatchConverter::performJob(DE_BatchJob&                   theJob,
+                                   const occ::handle<DE_Wrapper>& theWrapper,
+                                   const Message_ProgressRange&   theProgress)
+{
+  Message_ProgressScope               aPS(theProgress, "Converting file", 2);
+  const occ::handle<TDocStd_Document> aDoc = createDocument(theJob);
+  TopoDS_Shape                        aShape;
+  const bool                          isRead =
+    !aDoc.IsNull() ? theWrapper->Read(theJob.InputPath, aDoc, aPS.Next())
+                   : theWrapper->Read(theJob.InputPath, aShape, aPS.Next());
+  if (aPS.UserBreak())
+  {
+    theJob.Status = DE_BatchJobStatus_Aborted;
+    return;
+  }
+  else if (!isRead)
+  {
+    theJob.Status  = DE_BatchJobStatus_ReadFailed;
+    theJob.Message =
+      TCollection_AsciiString("Error: file '") + theJob.InputPath + "' cannot be read";
+    return;
+  }
+
+  const bool isWritten =
+    !aDoc.IsNull() ? theWrapper->Write(theJob.OutputPath, aDoc, aPS.Next())
+                   : theWrapper->Write(theJob.OutputPath, aShape, aPS.Next());
+  if (aPS.UserBreak())
+  {
+    theJob.Status = DE_BatchJobStatus_Aborted;
+    return;
+  }
+  else if (!isWritten)
+  {
+    theJob.Status = DE_BatchJobStatus_WriteFailed;
+    theJob.Message =
+      TCollection_AsciiString("Error: file '") + theJob.OutputPath + "' cannot be written";
+    return;
+  }
+  theJob.Status = DE_BatchJobStatus_Done;
+}
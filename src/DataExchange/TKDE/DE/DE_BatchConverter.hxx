@@ -0,0 +1,111 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _DE_BatchConverter_HeaderFile
+#define _DE_BatchConverter_HeaderFile
+
+#include <DE_BatchJob.hxx>
+#include <DE_Wrapper.hxx>
+#include <NCollection_Array1.hxx>
+#include <OSD_ThreadPool.hxx>
+
+//! Tool performing many independent file conversions concurrently within one process.
+//!
+//! Each conversion (DE_BatchJob) reads the input file and writes the result into the output file
+//! using formats and vendors defined by the prototype DE_Wrapper.
+//! Every job works with its own deep copy of the prototype (see DE_Wrapper::DeepCopy()),
+//! so that configuration nodes, providers, work sessions and shape healing parameters
+//! are never shared between concurrent jobs.
+//!
+//! Jobs are executed by the threads of OSD_ThreadPool, highest priority first.
+//! Admission of a new job is limited by the memory budget (see SetMemoryLimit()):
+//! a job is started only when the sum of memory estimations of running jobs fits the budget,
+//! although a single job is always allowed to run.
+//! Lower priority jobs never overtake waiting jobs of higher priority.
+//!
+//! Note that threads of the pool are locked by the batch, so that translators
+//! launching parallel algorithms within a job will run them single-threaded.
+//! Providers relying on global (static) parameters should not be used concurrently.
+class DE_BatchConverter
+{
+public:
+  //! Main constructor.
+  //! @param[in] theWrapper prototype wrapper defining configuration of all conversions;
+  //!                       DE_Wrapper::GlobalWrapper() is used if NULL
+  Standard_EXPORT DE_BatchConverter(
+    const occ::handle<DE_Wrapper>& theWrapper = occ::handle<DE_Wrapper>());
+
+  //! Destructor.
+  Standard_EXPORT virtual ~DE_BatchConverter();
+
+  //! Return prototype wrapper.
+  const occ::handle<DE_Wrapper>& Wrapper() const { return myWrapper; }
+
+  //! Return thread pool; OSD_ThreadPool::DefaultPool() by default.
+  const occ::handle<OSD_ThreadPool>& ThreadPool() const { return myThreadPool; }
+
+  //! Set thread pool.
+  void SetThreadPool(const occ::handle<OSD_ThreadPool>& thePool) { myThreadPool = thePool; }
+
+  //! Return maximum number of concurrent jobs;
+  //! -1 by default meaning OSD_ThreadPool::NbDefaultThreadsToLaunch().
+  int NbThreads() const { return myNbThreads; }
+
+  //! Set maximum number of concurrent jobs.
+  void SetNbThreads(int theNbThreads) { myNbThreads = theNbThreads; }
+
+  //! Return memory budget in bytes for concurrent jobs; 0 by default meaning no limit.
+  size_t MemoryLimit() const { return myMemoryLimit; }
+
+  //! Set memory budget in bytes for concurrent jobs.
+  void SetMemoryLimit(size_t theLimit) { myMemoryLimit = theLimit; }
+
+  //! Return factor applied to the input file size for estimating memory used by a job
+  //! with undefined DE_BatchJob::EstimatedMemory; 10 by default.
+  double MemoryFactor() const { return myMemoryFactor; }
+
+  //! Set factor applied to the input file size for estimating memory used by a job.
+  void SetMemoryFactor(double theFactor) { myMemoryFactor = theFactor; }
+
+  //! Perform conversion of all jobs with DE_BatchJobStatus_Pending status.
+  //! @param[in,out] theJobs     jobs to perform
+  //! @param[in]     theProgress progress indicator
+  //! @return TRUE if all jobs have been converted successfully
+  Standard_EXPORT bool Perform(NCollection_Array1<DE_BatchJob>& theJobs,
+                               const Message_ProgressRange& theProgress = Message_ProgressRange());
+
+protected:
+  //! Create new document for the job.
+  //! Default implementation returns NULL, so that jobs are converted via TopoDS_Shape;
+  //! sub-class may create an XDE document to preserve names, colors and assembly structure.
+  //! This method is called from concurrent threads.
+  Standard_EXPORT virtual occ::handle<TDocStd_Document> createDocument(const DE_BatchJob& theJob);
+
+  //! Perform a single job with its own copy of the wrapper.
+  //! This method is called from concurrent threads.
+  //! @param[in,out] theJob      job to perform
+  //! @param[in]     theWrapper  wrapper exclusively used by this job
+  //! @param[in]     theProgress progress indicator
+  Standard_EXPORT virtual void performJob(DE_BatchJob&                   theJob,
+                                          const occ::handle<DE_Wrapper>& theWrapper,
+                                          const Message_ProgressRange&   theProgress);
+
+protected:
+  occ::handle<DE_Wrapper>     myWrapper;      //!< prototype wrapper
+  occ::handle<OSD_ThreadPool> myThreadPool;   //!< thread pool
+  int                         myNbThreads;    //!< maximum number of concurrent jobs
+  size_t                      myMemoryLimit;  //!< memory budget in bytes
+  double                      myMemoryFactor; //!< input file size factor for memory estimation
+};
+
+#endif // _DE_BatchConverter_HeaderFile
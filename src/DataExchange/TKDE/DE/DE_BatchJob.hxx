@@ -0,0 +1,60 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _DE_BatchJob_HeaderFile
+#define _DE_BatchJob_HeaderFile
+
+#include <DE_BatchJobStatus.hxx>
+#include <TCollection_AsciiString.hxx>
+
+//! Single file conversion processed by DE_BatchConverter.
+//! Input fields should be filled before DE_BatchConverter::Perform(),
+//! output fields are filled by the converter.
+struct DE_BatchJob
+{
+  // input fields
+  TCollection_AsciiString InputPath;       //!< path to the file to read
+  TCollection_AsciiString OutputPath;      //!< path to the file to write
+  int                     Priority;        //!< jobs with higher priority are started first
+  size_t                  EstimatedMemory; //!< memory estimation in bytes, 0 to deduce it
+                                           //!  from the input file size
+
+  // output fields
+  DE_BatchJobStatus       Status;      //!< conversion status
+  TCollection_AsciiString Message;     //!< error message
+  double                  ElapsedTime; //!< elapsed time of conversion in seconds
+
+  //! Empty constructor.
+  DE_BatchJob()
+      : Priority(0),
+        EstimatedMemory(0),
+        Status(DE_BatchJobStatus_Pending),
+        ElapsedTime(0.0)
+  {
+  }
+
+  //! Main constructor.
+  DE_BatchJob(const TCollection_AsciiString& theInputPath,
+              const TCollection_AsciiString& theOutputPath,
+              const int                      thePriority = 0)
+      : InputPath(theInputPath),
+        OutputPath(theOutputPath),
+        Priority(thePriority),
+        EstimatedMemory(0),
+        Status(DE_BatchJobStatus_Pending),
+        ElapsedTime(0.0)
+  {
+  }
+};
+
+#endif // _DE_BatchJob_HeaderFile
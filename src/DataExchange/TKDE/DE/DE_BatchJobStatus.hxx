@@ -0,0 +1,28 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _DE_BatchJobStatus_HeaderFile
+#define _DE_BatchJobStatus_HeaderFile
+
+//! Status of a single conversion within DE_BatchConverter.
+enum DE_BatchJobStatus
+{
+  DE_BatchJobStatus_Pending,     //!< conversion has not been started yet
+  DE_BatchJobStatus_Done,        //!< file has been converted successfully
+  DE_BatchJobStatus_ReadFailed,  //!< input file cannot be read
+  DE_BatchJobStatus_WriteFailed, //!< output file cannot be written
+  DE_BatchJobStatus_Failed,      //!< conversion has been interrupted by exception
+  DE_BatchJobStatus_Aborted      //!< conversion has been skipped due to user break
+};
+
+#endif // _DE_BatchJobStatus_HeaderFile
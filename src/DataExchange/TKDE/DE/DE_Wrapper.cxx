@@ -76,7 +76,7 @@ DE_Wrapper::DE_Wrapper(const occ::handle<DE_Wrapper>& theWrapper)
       Bind(aVendorIter.Value());
     }
   }
-  theWrapper->myKeepUpdates = myKeepUpdates;
+  myKeepUpdates = theWrapper->myKeepUpdates;
 }
 
 //=================================================================================================
@@ -540,6 +540,29 @@ occ::handle<DE_Wrapper> DE_Wrapper::Copy() const
 
 //=================================================================================================
 
+occ::handle<DE_Wrapper> DE_Wrapper::DeepCopy() const
+{
+  occ::handle<DE_Wrapper> aCopy = Copy();
+  for (NCollection_DataMap<TCollection_AsciiString,
+                           NCollection_IndexedDataMap<TCollection_AsciiString,
+                                                      occ::handle<DE_ConfigurationNode>>>::Iterator
+         aFormatIter(aCopy->myConfiguration);
+       aFormatIter.More();
+       aFormatIter.Next())
+  {
+    NCollection_IndexedDataMap<TCollection_AsciiString, occ::handle<DE_ConfigurationNode>>&
+      aVendorMap = aFormatIter.ChangeValue();
+    for (int aVendorIter = 1; aVendorIter <= aVendorMap.Extent(); ++aVendorIter)
+    {
+      occ::handle<DE_ConfigurationNode>& aNode = aVendorMap.ChangeFromIndex(aVendorIter);
+      aNode                                    = aNode->Copy();
+    }
+  }
+  return aCopy;
+}
+
+//=================================================================================================
+
 bool DE_Wrapper::FindProvider(const TCollection_AsciiString& thePath,
                               const bool                     theToImport,
                               occ::handle<DE_Provider>&      theProvider) const
@@ -368,6 +368,12 @@ public:
   //! @return new object with the same field values
   Standard_EXPORT virtual occ::handle<DE_Wrapper> Copy() const;
 
+  //! Copies values of all fields and makes copies of all configuration nodes.
+  //! Unlike Copy(), the result doesn't share nodes with this object
+  //! and can be used for transfer concurrently with it.
+  //! @return new object with the same field values
+  Standard_EXPORT occ::handle<DE_Wrapper> DeepCopy() const;
+
 protected:
   //! Sorts the vendors according to the priority to work
   //! Formats omitted from the resource are not modified
@@ -2,6 +2,13 @@
 set(OCCT_DE_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
 
 set(OCCT_DE_FILES
+  DE_AsyncReader.cxx
+  DE_AsyncReader.hxx
+  DE_AsyncReadStatus.hxx
+  DE_BatchConverter.cxx
+  DE_BatchConverter.hxx
+  DE_BatchJob.hxx
+  DE_BatchJobStatus.hxx
   DE_ConfigurationContext.cxx
   DE_ConfigurationContext.hxx
   DE_ConfigurationNode.cxx
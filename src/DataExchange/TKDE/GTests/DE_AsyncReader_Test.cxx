@@ -0,0 +1,153 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <DE_AsyncReader.hxx>
+#include <DE_ConfigurationNode.hxx>
+#include <DE_Provider.hxx>
+#include <Message_ProgressScope.hxx>
+#include <OSD.hxx>
+#include <OSD_File.hxx>
+#include <OSD_Path.hxx>
+#include <TopoDS_Builder.hxx>
+#include <TopoDS_Compound.hxx>
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+
+namespace
+{
+//! Provider imitating slow reading of files with extension "tst";
+//! the number of steps is defined by the file name.
+class TestProvider : public DE_Provider
+{
+public:
+  TestProvider(const occ::handle<DE_ConfigurationNode>& theNode)
+      : DE_Provider(theNode)
+  {
+  }
+
+  bool Read(const TCollection_AsciiString& thePath,
+            TopoDS_Shape&                  theShape,
+            const Message_ProgressRange&   theProgress) override
+  {
+    const int             aNbSteps = thePath.Search("long") != -1 ? 100000 : 10;
+    Message_ProgressScope aPS(theProgress, "Transfer", aNbSteps);
+    for (int aStepIter = 0; aStepIter < aNbSteps && aPS.More(); ++aStepIter, aPS.Next())
+    {
+      OSD::MilliSecSleep(1);
+    }
+    if (aPS.UserBreak())
+    {
+      return false;
+    }
+
+    TopoDS_Compound aComp;
+    TopoDS_Builder().MakeCompound(aComp);
+    theShape = aComp;
+    return true;
+  }
+
+  TCollection_AsciiString GetFormat() const override { return "TEST"; }
+
+  TCollection_AsciiString GetVendor() const override { return "OCC"; }
+};
+
+//! Configuration node of TestProvider.
+class TestConfigurationNode : public DE_ConfigurationNode
+{
+public:
+  bool Load(const occ::handle<DE_ConfigurationContext>&) override { return true; }
+
+  TCollection_AsciiString Save() const override { return TCollection_AsciiString(); }
+
+  occ::handle<DE_Provider> BuildProvider() override { return new TestProvider(this); }
+
+  occ::handle<DE_ConfigurationNode> Copy() const override { return new TestConfigurationNode(); }
+
+  bool IsImportSupported() const override { return true; }
+
+  TCollection_AsciiString GetFormat() const override { return "TEST"; }
+
+  TCollection_AsciiString GetVendor() const override { return "OCC"; }
+
+  NCollection_List<TCollection_AsciiString> GetExtensions() const override
+  {
+    NCollection_List<TCollection_AsciiString> anExt;
+    anExt.Append("tst");
+    return anExt;
+  }
+};
+
+//! Input files of the tests.
+static const char* THE_SHORT_FILE = "DE_AsyncReader_Test.tst";
+static const char* THE_LONG_FILE  = "DE_AsyncReader_Test_long.tst";
+
+//! Create wrapper with the test configuration node and input files.
+occ::handle<DE_Wrapper> createWrapper()
+{
+  std::ofstream(THE_SHORT_FILE) << "input\n";
+  std::ofstream(THE_LONG_FILE) << "input\n";
+
+  occ::handle<DE_Wrapper> aWrapper = new DE_Wrapper();
+  aWrapper->Bind(new TestConfigurationNode());
+  return aWrapper;
+}
+
+//! Remove input files.
+void removeFiles()
+{
+  OSD_File(OSD_Path(THE_SHORT_FILE)).Remove();
+  OSD_File(OSD_Path(THE_LONG_FILE)).Remove();
+}
+} // namespace
+
+TEST(DE_AsyncReader_Test, ReadShape)
+{
+  occ::handle<DE_AsyncReader> aReader = new DE_AsyncReader(createWrapper());
+  EXPECT_EQ(DE_AsyncReadStatus_Pending, aReader->Status());
+  ASSERT_TRUE(aReader->Start(THE_SHORT_FILE));
+  EXPECT_TRUE(aReader->Wait());
+  EXPECT_TRUE(aReader->IsFinished());
+  EXPECT_EQ(DE_AsyncReadStatus_Done, aReader->Status());
+  EXPECT_FALSE(aReader->Shape().IsNull());
+
+  const DE_AsyncReader::ProgressState aState = aReader->Progress();
+  EXPECT_NEAR(1.0, aState.Position, Precision::Confusion());
+  EXPECT_NE(-1, aState.Phase.Search("Transfer"));
+  removeFiles();
+}
+
+TEST(DE_AsyncReader_Test, Cancel)
+{
+  occ::handle<DE_AsyncReader> aReader = new DE_AsyncReader(createWrapper());
+  ASSERT_TRUE(aReader->Start(THE_LONG_FILE));
+  EXPECT_FALSE(aReader->Start(THE_SHORT_FILE));
+  EXPECT_FALSE(aReader->Wait(10));
+  while (aReader->Progress().PhaseValue < 1.0)
+  {
+    OSD::MilliSecSleep(1);
+  }
+
+  aReader->Cancel();
+  EXPECT_TRUE(aReader->Wait());
+  EXPECT_EQ(DE_AsyncReadStatus_Aborted, aReader->Status());
+  EXPECT_TRUE(aReader->Shape().IsNull());
+
+  // the reader can be reused after cancellation
+  ASSERT_TRUE(aReader->Start(THE_SHORT_FILE));
+  EXPECT_TRUE(aReader->Wait());
+  EXPECT_EQ(DE_AsyncReadStatus_Done, aReader->Status());
+  removeFiles();
+}
@@ -0,0 +1,212 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <DE_BatchConverter.hxx>
+#include <DE_ConfigurationNode.hxx>
+#include <DE_Provider.hxx>
+#include <OSD.hxx>
+#include <OSD_File.hxx>
+#include <OSD_Path.hxx>
+#include <TopoDS_Builder.hxx>
+#include <TopoDS_Compound.hxx>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <fstream>
+#include <vector>
+
+namespace
+{
+//! Statistics collected by the test provider.
+struct TestStats
+{
+  std::atomic<int>                     NbRunning{0};
+  std::atomic<int>                     MaxRunning{0};
+  std::mutex                           Mutex;
+  std::vector<TCollection_AsciiString> ReadOrder;
+
+  void Reset()
+  {
+    NbRunning  = 0;
+    MaxRunning = 0;
+    ReadOrder.clear();
+  }
+};
+
+static TestStats THE_STATS;
+
+//! Provider copying text files with extension "tst".
+class TestProvider : public DE_Provider
+{
+public:
+  TestProvider(const occ::handle<DE_ConfigurationNode>& theNode)
+      : DE_Provider(theNode)
+  {
+  }
+
+  bool Read(const TCollection_AsciiString& thePath,
+            TopoDS_Shape&                  theShape,
+            const Message_ProgressRange&) override
+  {
+    const int aNbRunning = ++THE_STATS.NbRunning;
+    int aMaxRunning = THE_STATS.MaxRunning;
+    while (aNbRunning > aMaxRunning
+           && !THE_STATS.MaxRunning.compare_exchange_weak(aMaxRunning, aNbRunning))
+    {
+    }
+    {
+      std::lock_guard<std::mutex> aLock(THE_STATS.Mutex);
+      THE_STATS.ReadOrder.push_back(thePath);
+    }
+    OSD::MilliSecSleep(20);
+
+    TopoDS_Compound aComp;
+    TopoDS_Builder().MakeCompound(aComp);
+    theShape = aComp;
+    --THE_STATS.NbRunning;
+    return true;
+  }
+
+  bool Write(const TCollection_AsciiString& thePath,
+             const TopoDS_Shape&            theShape,
+             const Message_ProgressRange&) override
+  {
+    std::ofstream aStream(thePath.ToCString());
+    aStream << (theShape.IsNull() ? "null" : "shape") << "\n";
+    return aStream.good();
+  }
+
+  TCollection_AsciiString GetFormat() const override { return "TEST"; }
+
+  TCollection_AsciiString GetVendor() const override { return "OCC"; }
+};
+
+//! Configuration node of TestProvider.
+class TestConfigurationNode : public DE_ConfigurationNode
+{
+public:
+  bool Load(const occ::handle<DE_ConfigurationContext>&) override { return true; }
+
+  TCollection_AsciiString Save() const override { return TCollection_AsciiString(); }
+
+  occ::handle<DE_Provider> BuildProvider() override { return new TestProvider(this); }
+
+  occ::handle<DE_ConfigurationNode> Copy() const override { return new TestConfigurationNode(); }
+
+  bool IsImportSupported() const override { return true; }
+
+  bool IsExportSupported() const override { return true; }
+
+  TCollection_AsciiString GetFormat() const override { return "TEST"; }
+
+  TCollection_AsciiString GetVendor() const override { return "OCC"; }
+
+  NCollection_List<TCollection_AsciiString> GetExtensions() const override
+  {
+    NCollection_List<TCollection_AsciiString> anExt;
+    anExt.Append("tst");
+    return anExt;
+  }
+};
+
+//! Create wrapper with the test configuration node and input files.
+occ::handle<DE_Wrapper> createWrapper(NCollection_Array1<DE_BatchJob>& theJobs)
+{
+  for (int aJobIter = theJobs.Lower(); aJobIter <= theJobs.Upper(); ++aJobIter)
+  {
+    const TCollection_AsciiString anIndex(aJobIter);
+    theJobs.ChangeValue(aJobIter) =
+      DE_BatchJob(TCollection_AsciiString("DE_BatchConverter_Test_in") + anIndex + ".tst",
+                  TCollection_AsciiString("DE_BatchConverter_Test_out") + anIndex + ".tst");
+    std::ofstream aStream(theJobs.Value(aJobIter).InputPath.ToCString());
+    aStream << "input\n";
+  }
+  THE_STATS.Reset();
+
+  occ::handle<DE_Wrapper> aWrapper = new DE_Wrapper();
+  aWrapper->Bind(new TestConfigurationNode());
+  return aWrapper;
+}
+
+//! Remove input and output files.
+void removeFiles(const NCollection_Array1<DE_BatchJob>& theJobs)
+{
+  for (NCollection_Array1<DE_BatchJob>::Iterator aJobIter(theJobs); aJobIter.More();
+       aJobIter.Next())
+  {
+    OSD_File(OSD_Path(aJobIter.Value().InputPath)).Remove();
+    OSD_File(OSD_Path(aJobIter.Value().OutputPath)).Remove();
+  }
+}
+} // namespace
+
+TEST(DE_BatchConverter_Test, ConvertAll)
+{
+  NCollection_Array1<DE_BatchJob> aJobs(1, 8);
+  DE_BatchConverter               aConverter(createWrapper(aJobs));
+  aConverter.SetThreadPool(new OSD_ThreadPool(4));
+  EXPECT_TRUE(aConverter.Perform(aJobs));
+  for (NCollection_Array1<DE_BatchJob>::Iterator aJobIter(aJobs); aJobIter.More();
+       aJobIter.Next())
+  {
+    EXPECT_EQ(DE_BatchJobStatus_Done, aJobIter.Value().Status);
+    EXPECT_TRUE(OSD_File(OSD_Path(aJobIter.Value().OutputPath)).Exists());
+  }
+  EXPECT_GT(THE_STATS.MaxRunning, 1);
+  EXPECT_LE(THE_STATS.MaxRunning, 4);
+  removeFiles(aJobs);
+}
+
+TEST(DE_BatchConverter_Test, ReadFailure)
+{
+  NCollection_Array1<DE_BatchJob> aJobs(1, 2);
+  DE_BatchConverter               aConverter(createWrapper(aJobs));
+  OSD_File(OSD_Path(aJobs.Value(2).InputPath)).Remove();
+  EXPECT_FALSE(aConverter.Perform(aJobs));
+  EXPECT_EQ(DE_BatchJobStatus_Done, aJobs.Value(1).Status);
+  EXPECT_EQ(DE_BatchJobStatus_ReadFailed, aJobs.Value(2).Status);
+  EXPECT_FALSE(aJobs.Value(2).Message.IsEmpty());
+  removeFiles(aJobs);
+}
+
+TEST(DE_BatchConverter_Test, MemoryLimit)
+{
+  NCollection_Array1<DE_BatchJob> aJobs(1, 6);
+  DE_BatchConverter               aConverter(createWrapper(aJobs));
+  aConverter.SetThreadPool(new OSD_ThreadPool(4));
+  aConverter.SetMemoryLimit(150);
+  for (int aJobIter = aJobs.Lower(); aJobIter <= aJobs.Upper(); ++aJobIter)
+  {
+    aJobs.ChangeValue(aJobIter).EstimatedMemory = 100;
+  }
+  EXPECT_TRUE(aConverter.Perform(aJobs));
+  EXPECT_EQ(1, THE_STATS.MaxRunning);
+  removeFiles(aJobs);
+}
+
+TEST(DE_BatchConverter_Test, Priority)
+{
+  NCollection_Array1<DE_BatchJob> aJobs(1, 4);
+  DE_BatchConverter               aConverter(createWrapper(aJobs));
+  aConverter.SetNbThreads(1);
+  aJobs.ChangeValue(3).Priority = 10;
+  aJobs.ChangeValue(2).Priority = 5;
+  EXPECT_TRUE(aConverter.Perform(aJobs));
+  ASSERT_EQ(4u, THE_STATS.ReadOrder.size());
+  EXPECT_EQ(aJobs.Value(3).InputPath, THE_STATS.ReadOrder[0]);
+  EXPECT_EQ(aJobs.Value(2).InputPath, THE_STATS.ReadOrder[1]);
+  EXPECT_EQ(aJobs.Value(1).InputPath, THE_STATS.ReadOrder[2]);
+  EXPECT_EQ(aJobs.Value(4).InputPath, THE_STATS.ReadOrder[3]);
+  removeFiles(aJobs);
+}
@@ -2,4 +2,6 @@
 set(OCCT_TKDE_GTests_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
 
 set(OCCT_TKDE_GTests_FILES
+  DE_AsyncReader_Test.cxx
+  DE_BatchConverter_Test.cxx
 )
@@ -0,0 +1,6 @@
+# Benchmark source files for TKDEGLTF
+set(OCCT_TKDEGLTF_Benchmarks_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
+
+set(OCCT_TKDEGLTF_Benchmarks_FILES
+  RWGltf_Benchmark.cxx
+)
@@ -0,0 +1,116 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <BRepPrimAPI_MakeSphere.hxx>
+#include <Message_ProgressRange.hxx>
+#include <OSD_File.hxx>
+#include <RWGltf_CafReader.hxx>
+#include <RWGltf_CafWriter.hxx>
+#include <TDocStd_Application.hxx>
+#include <TDocStd_Document.hxx>
+#include <XCAFDoc_DocumentTool.hxx>
+#include <XCAFDoc_ShapeTool.hxx>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+//! Temporary glTF file written by the benchmark.
+const char THE_GLB_FILE[] = "RWGltf_Benchmark.glb";
+
+//! Creates the new XCAF document.
+occ::handle<TDocStd_Document> newDocument()
+{
+  occ::handle<TDocStd_Application> anApp = new TDocStd_Application();
+  occ::handle<TDocStd_Document>    aDoc;
+  anApp->NewDocument("BinXCAF", aDoc);
+  return aDoc;
+}
+
+//! Makes the document with the grid of theNbShapes x theNbShapes meshed spheres.
+occ::handle<TDocStd_Document> makeDocument(const int theNbShapes)
+{
+  const occ::handle<TDocStd_Document> aDoc    = newDocument();
+  occ::handle<XCAFDoc_ShapeTool>      aShTool = XCAFDoc_DocumentTool::ShapeTool(aDoc->Main());
+  const TopoDS_Shape                  aSphere = BRepPrimAPI_MakeSphere(1.0).Shape();
+  BRepMesh_IncrementalMesh            aMesher(aSphere, 0.01);
+  const TDF_Label                     aProto = aShTool->AddShape(aSphere, false);
+  const TDF_Label                     anAssy = aShTool->NewShape();
+  for (int aRow = 0; aRow < theNbShapes; ++aRow)
+  {
+    for (int aCol = 0; aCol < theNbShapes; ++aCol)
+    {
+      gp_Trsf aTrsf;
+      aTrsf.SetTranslation(gp_Vec(3.0 * aRow, 3.0 * aCol, 0.0));
+      aShTool->AddComponent(anAssy, aProto, TopLoc_Location(aTrsf));
+    }
+  }
+  aShTool->UpdateAssemblies();
+  return aDoc;
+}
+
+//! Writes the binary glTF file of the document.
+bool writeGlb(const occ::handle<TDocStd_Document>& theDoc)
+{
+  RWGltf_CafWriter aWriter(THE_GLB_FILE, true);
+  const NCollection_IndexedDataMap<TCollection_AsciiString, TCollection_AsciiString> aFileInfo;
+  return aWriter.Perform(theDoc, aFileInfo, Message_ProgressRange());
+}
+} // namespace
+
+// Argument: number of spheres in each direction of the grid.
+
+static void RWGltf_CafWriter_Glb(benchmark::State& theState)
+{
+  const occ::handle<TDocStd_Document> aDoc = makeDocument(int(theState.range(0)));
+  for (auto _ : theState)
+  {
+    if (!writeGlb(aDoc))
+    {
+      theState.SkipWithError("Writing of glTF file has failed");
+      break;
+    }
+  }
+  OSD_File(OSD_Path(THE_GLB_FILE)).Remove();
+}
+BENCHMARK(RWGltf_CafWriter_Glb)->Arg(4)->Arg(16)->Unit(benchmark::kMillisecond);
+
+// Arguments: number of spheres in each direction of the grid, flag to read in parallel threads.
+
+static void RWGltf_CafReader_Glb(benchmark::State& theState)
+{
+  if (!writeGlb(makeDocument(int(theState.range(0)))))
+  {
+    theState.SkipWithError("Writing of glTF file has failed");
+    return;
+  }
+  const int64_t aFileSize = int64_t(OSD_File(OSD_Path(THE_GLB_FILE)).Size());
+  for (auto _ : theState)
+  {
+    RWGltf_CafReader aReader;
+    aReader.SetDocument(newDocument());
+    aReader.SetParallel(theState.range(1) != 0);
+    if (!aReader.Perform(THE_GLB_FILE, Message_ProgressRange()))
+    {
+      theState.SkipWithError("Reading of glTF file has failed");
+      break;
+    }
+  }
+  theState.SetBytesProcessed(theState.iterations() * aFileSize);
+  OSD_File(OSD_Path(THE_GLB_FILE)).Remove();
+}
+BENCHMARK(RWGltf_CafReader_Glb)
+  ->ArgsProduct({{4, 16}, {0, 1}})
+  ->Unit(benchmark::kMillisecond);
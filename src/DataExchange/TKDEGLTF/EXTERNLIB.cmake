@@ -13,4 +13,5 @@ set(OCCT_TKDEGLTF_EXTERNAL_LIBS
   TKRWMesh
   CSF_RapidJSON
   CSF_Draco
+  CSF_Meshoptimizer
 )
@@ -22,6 +22,8 @@ set(OCCT_RWGltf_FILES
   RWGltf_GltfLatePrimitiveArray.hxx
   RWGltf_GltfMaterialMap.cxx
   RWGltf_GltfMaterialMap.hxx
+  RWGltf_GltfMeshoptFilter.hxx
+  RWGltf_GltfMeshoptMode.hxx
   RWGltf_GltfOStreamWriter.hxx
   RWGltf_GltfPrimArrayData.hxx
   RWGltf_GltfPrimitiveMode.hxx
@@ -308,6 +308,7 @@ bool RWGltf_CafReader::performMesh(std::istream&                  theStream,
   }
   myShapeScaleMap = new NCollection_DataMap<TopoDS_Shape, gp_XYZ, TopTools_ShapeMapHasher>();
   aDoc.SetToApplyScale(myToApplyScale);
+  aDoc.SetParallel(myToParallel);
   aDoc.SetScaleMap(*myShapeScaleMap);
 
 #ifdef HAVE_RAPIDJSON
@@ -51,6 +51,13 @@
   #include <Standard_WarningsRestore.hxx>
 #endif
 
+#ifdef HAVE_MESHOPTIMIZER
+  #include <meshoptimizer.h>
+#endif
+
+#include <cstring>
+#include <sstream>
+
 IMPLEMENT_STANDARD_RTTIEXT(RWGltf_CafWriter, Standard_Transient)
 
 namespace
@@ -89,6 +96,79 @@ static void writeVertex(std::ostream& theStream, const T& theVertex)
   theStream.write(reinterpret_cast<const char*>(&theVertex), sizeof(T));
 }
 
+#ifdef HAVE_RAPIDJSON
+//! Write EXT_meshopt_compression extension of the buffer view.
+static void writeMeshoptExtension(RWGltf_GltfOStreamWriter&    theWriter,
+                                  const RWGltf_GltfBufferView& theView,
+                                  const int                    theBufferId)
+{
+  theWriter.Key("extensions");
+  theWriter.StartObject();
+  theWriter.Key("EXT_meshopt_compression");
+  theWriter.StartObject();
+  theWriter.Key("buffer");
+  theWriter.Int(theBufferId);
+  theWriter.Key("byteOffset");
+  theWriter.Int64(theView.MeshoptByteOffset);
+  theWriter.Key("byteLength");
+  theWriter.Int64(theView.MeshoptByteLength);
+  theWriter.Key("byteStride");
+  theWriter.Int64(theView.ByteStride);
+  theWriter.Key("count");
+  theWriter.Int64(theView.MeshoptCount);
+  theWriter.Key("mode");
+  theWriter.String(RWGltf_GltfMeshoptModeName(theView.MeshoptMode));
+  theWriter.EndObject();
+  theWriter.EndObject();
+}
+#endif
+
+#ifdef HAVE_MESHOPTIMIZER
+//! Encode buffer view data using meshoptimizer codec defined by view mode.
+//! @param[in]  theData   uncompressed buffer view data
+//! @param[in]  theView   buffer view definition with defined stride and mode
+//! @param[out] theResult compressed data
+//! @return FALSE on encoding failure
+static bool encodeMeshoptBufferView(const std::string&           theData,
+                                    const RWGltf_GltfBufferView& theView,
+                                    std::vector<unsigned char>&  theResult)
+{
+  const size_t aStride = (size_t)theView.ByteStride;
+  const size_t aCount  = (size_t)theView.MeshoptCount;
+  if (theView.MeshoptMode == RWGltf_GltfMeshoptMode_Attributes)
+  {
+    theResult.resize(meshopt_encodeVertexBufferBound(aCount, aStride));
+    theResult.resize(meshopt_encodeVertexBuffer(theResult.data(),
+                                                theResult.size(),
+                                                theData.data(),
+                                                aCount,
+                                                aStride));
+    return !theResult.empty();
+  }
+
+  std::vector<unsigned int> anIndices(aCount);
+  std::memcpy(anIndices.data(), theData.data(), aCount * sizeof(unsigned int));
+  size_t aNbVerts = 0;
+  for (const unsigned int anIndex : anIndices)
+  {
+    aNbVerts = std::max(aNbVerts, (size_t)anIndex + 1);
+  }
+  if (theView.MeshoptMode == RWGltf_GltfMeshoptMode_Triangles)
+  {
+    theResult.resize(meshopt_encodeIndexBufferBound(aCount, aNbVerts));
+    theResult.resize(
+      meshopt_encodeIndexBuffer(theResult.data(), theResult.size(), anIndices.data(), aCount));
+  }
+  else
+  {
+    theResult.resize(meshopt_encodeIndexSequenceBound(aCount, aNbVerts));
+    theResult.resize(
+      meshopt_encodeIndexSequence(theResult.data(), theResult.size(), anIndices.data(), aCount));
+  }
+  return !theResult.empty();
+}
+#endif
+
 #ifdef HAVE_DRACO
 //! Write nodes to Draco mesh
 static void writeNodesToDracoMesh(draco::Mesh&                                theMesh,
@@ -247,7 +327,9 @@ RWGltf_CafWriter::RWGltf_CafWriter(const TCollection_AsciiString& theFile, bool
       myToMergeFaces(false),
       myToSplitIndices16(false),
       myBinDataLen64(0),
-      myToParallel(false)
+      myToParallel(false),
+      myToUseMeshopt(false),
+      myMeshoptFallbackLen64(0)
 {
   myCSTrsf.SetOutputLengthUnit(1.0); // meters
   myCSTrsf.SetOutputCoordinateSystem(RWMesh_CoordinateSystem_glTF);
@@ -578,8 +660,9 @@ void RWGltf_CafWriter::saveIndices(RWGltf_GltfFace&
     theGltfFace.Indices.Id         = theAccessorNb++;
     theGltfFace.Indices.ByteOffset = (int64_t)theBinFile.tellp() - myBuffViewInd.ByteOffset;
     theGltfFace.Indices.Type       = RWGltf_GltfAccessorLayout_Scalar;
+    // meshopt index codecs expect the same index size within the whole buffer view
     theGltfFace.Indices.ComponentType =
-      theGltfFace.NodePos.Count > std::numeric_limits<uint16_t>::max()
+      myToUseMeshopt || theGltfFace.NodePos.Count > std::numeric_limits<uint16_t>::max()
         ? RWGltf_GltfAccessorCompType_UInt32
         : RWGltf_GltfAccessorCompType_UInt16;
   }
@@ -815,6 +898,18 @@ bool RWGltf_CafWriter::writeBinData(const occ::handle<TDocStd_Document>&
     return false;
   }
 #endif
+#ifndef HAVE_MESHOPTIMIZER
+  if (myToUseMeshopt)
+  {
+    Message::SendFail("Error: cannot use meshopt compression, meshoptimizer library missing.");
+    return false;
+  }
+#endif
+  if (myToUseMeshopt && myDracoParameters.DracoCompression)
+  {
+    Message::SendFail("Error: meshopt compression cannot be combined with Draco compression.");
+    return false;
+  }
 
   myBuffViewPos.Id         = RWGltf_GltfAccessor::INVALID_ID;
   myBuffViewPos.ByteOffset = 0;
@@ -837,17 +932,25 @@ bool RWGltf_CafWriter::writeBinData(const occ::handle<TDocStd_Document>&
   myBuffViewInd.Id         = RWGltf_GltfAccessor::INVALID_ID;
   myBuffViewInd.ByteOffset = 0;
   myBuffViewInd.ByteLength = 0;
+  myBuffViewInd.ByteStride = myToUseMeshopt ? 4 : 0;
   myBuffViewInd.Target     = RWGltf_GltfBufferViewTarget_ELEMENT_ARRAY_BUFFER;
 
   myBuffViewsDraco.clear();
 
   myBinDataMap.Clear();
-  myBinDataLen64 = 0;
+  myBinDataLen64         = 0;
+  myMeshoptFallbackLen64 = 0;
 
   Message_ProgressScope aScope(theProgress,
                                "Write binary data",
                                myDracoParameters.DracoCompression ? 2 : 1);
 
+#ifdef HAVE_MESHOPTIMIZER
+  // with meshopt compression, uncompressed buffer views are collected in memory for encoding
+  std::stringstream aMeshoptStreams[4];
+  bool              hasNonTriangles = false;
+#endif
+
   const occ::handle<OSD_FileSystem>& aFileSystem = OSD_FileSystem::DefaultFileSystem();
   std::shared_ptr<std::ostream>      aBinFile =
     aFileSystem->OpenOStream(myBinFileNameFull, std::ios::out | std::ios::binary);
@@ -921,7 +1024,12 @@ bool RWGltf_CafWriter::writeBinData(const occ::handle<TDocStd_Document>&
       default:
         break;
     }
-    aBuffView->ByteOffset = aBinFile->tellp();
+#ifdef HAVE_MESHOPTIMIZER
+    std::ostream& aViewFile = myToUseMeshopt ? aMeshoptStreams[aTypeIter] : *aBinFile;
+#else
+    std::ostream& aViewFile = *aBinFile;
+#endif
+    aBuffView->ByteOffset = aViewFile.tellp();
     aWrittenFaces.Clear(false);
     aWrittenPrimData.Clear(false);
 #ifdef HAVE_DRACO
@@ -1001,7 +1109,7 @@ bool RWGltf_CafWriter::writeBinData(const occ::handle<TDocStd_Document>&
           case TopAbs_EDGE: {
             RWMesh_EdgeIterator anIter(aGltfFace->Shape, aGltfFace->Style);
             if (!writeShapesToBin(*aGltfFace,
-                                  *aBinFile,
+                                  aViewFile,
                                   anIter,
                                   aNbAccessors,
                                   aMeshPtr,
@@ -1011,12 +1119,15 @@ bool RWGltf_CafWriter::writeBinData(const occ::handle<TDocStd_Document>&
               return false;
             }
             wasWrittenNonFace = true;
+#ifdef HAVE_MESHOPTIMIZER
+            hasNonTriangles = true;
+#endif
             break;
           }
           case TopAbs_VERTEX: {
             RWMesh_VertexIterator anIter(aGltfFace->Shape, aGltfFace->Style);
             if (!writeShapesToBin(*aGltfFace,
-                                  *aBinFile,
+                                  aViewFile,
                                   anIter,
                                   aNbAccessors,
                                   aMeshPtr,
@@ -1026,12 +1137,19 @@ bool RWGltf_CafWriter::writeBinData(const occ::handle<TDocStd_Document>&
               return false;
             }
             wasWrittenNonFace = true;
+#ifdef HAVE_MESHOPTIMIZER
+            hasNonTriangles = true;
+#endif
             break;
           }
           default: {
             RWMesh_FaceIterator anIter(aGltfFace->Shape, aGltfFace->Style);
+            if (myToParallel)
+            {
+              anIter.PrepareData(true);
+            }
             if (!writeShapesToBin(*aGltfFace,
-                                  *aBinFile,
+                                  aViewFile,
                                   anIter,
                                   aNbAccessors,
                                   aMeshPtr,
@@ -1048,10 +1166,10 @@ bool RWGltf_CafWriter::writeBinData(const occ::handle<TDocStd_Document>&
         if (!myDracoParameters.DracoCompression || wasWrittenNonFace)
         {
           isFacesOnly           = false;
-          int64_t aContentLen64 = (int64_t)aBinFile->tellp();
+          int64_t aContentLen64 = (int64_t)aViewFile.tellp();
           while (aContentLen64 % 4 != 0)
           {
-            aBinFile->write(" ", 1);
+            aViewFile.write(" ", 1);
             ++aContentLen64;
           }
         }
@@ -1060,7 +1178,7 @@ bool RWGltf_CafWriter::writeBinData(const occ::handle<TDocStd_Document>&
 
     if (!myDracoParameters.DracoCompression || !isFacesOnly)
     {
-      aBuffView->ByteLength = (int64_t)aBinFile->tellp() - aBuffView->ByteOffset;
+      aBuffView->ByteLength = (int64_t)aViewFile.tellp() - aBuffView->ByteOffset;
     }
     if (!aPSentryBin.More())
     {
@@ -1088,6 +1206,89 @@ bool RWGltf_CafWriter::writeBinData(const occ::handle<TDocStd_Document>&
     myBuffViewInd.Id = aBuffViewId++;
   }
 
+  if (myToUseMeshopt)
+  {
+#ifdef HAVE_MESHOPTIMIZER
+    OSD_Timer aMeshoptTimer;
+    aMeshoptTimer.Start();
+    RWGltf_GltfBufferView* aBuffViews[4] = {&myBuffViewPos,
+                                            &myBuffViewNorm,
+                                            &myBuffViewTextCoord,
+                                            &myBuffViewInd};
+    std::string            aViewData[4];
+    for (int aViewIter = 0; aViewIter < 4; ++aViewIter)
+    {
+      RWGltf_GltfBufferView& aBuffView = *aBuffViews[aViewIter];
+      aBuffView.MeshoptMode            = RWGltf_GltfMeshoptMode_Attributes;
+      if (aBuffView.Target == RWGltf_GltfBufferViewTarget_ELEMENT_ARRAY_BUFFER)
+      {
+        // triangle codec is applicable only to lists of triangles
+        aBuffView.MeshoptMode =
+          hasNonTriangles ? RWGltf_GltfMeshoptMode_Indices : RWGltf_GltfMeshoptMode_Triangles;
+      }
+      aBuffView.MeshoptCount = aBuffView.ByteLength / aBuffView.ByteStride;
+      aBuffView.ByteOffset   = myMeshoptFallbackLen64;
+      myMeshoptFallbackLen64 += aBuffView.ByteLength;
+
+      aViewData[aViewIter] = aMeshoptStreams[aViewIter].str();
+      aMeshoptStreams[aViewIter].str(std::string());
+    }
+
+    // formats defined by EXT_meshopt_compression specification
+    meshopt_encodeVertexVersion(0);
+    meshopt_encodeIndexVersion(1);
+    std::vector<unsigned char> anEncoded[4];
+    bool                       isEncoded[4] = {true, true, true, true};
+    OSD_Parallel::For(
+      0,
+      4,
+      [&](int theViewIndex) {
+        if (aBuffViews[theViewIndex]->ByteLength > 0)
+        {
+          isEncoded[theViewIndex] = encodeMeshoptBufferView(aViewData[theViewIndex],
+                                                            *aBuffViews[theViewIndex],
+                                                            anEncoded[theViewIndex]);
+        }
+      },
+      !myToParallel);
+
+    for (int aViewIter = 0; aViewIter < 4; ++aViewIter)
+    {
+      RWGltf_GltfBufferView& aBuffView = *aBuffViews[aViewIter];
+      if (!isEncoded[aViewIter])
+      {
+        Message::SendFail() << "Error: buffer view is not encoded by meshoptimizer.";
+        return false;
+      }
+      if (aBuffView.ByteLength <= 0)
+      {
+        continue;
+      }
+
+      aBuffView.MeshoptByteOffset = aBinFile->tellp();
+      aBinFile->write((const char*)anEncoded[aViewIter].data(),
+                      std::streamsize(anEncoded[aViewIter].size()));
+      if (!aBinFile->good())
+      {
+        Message::SendFail(TCollection_AsciiString("File '") + myBinFileNameFull
+                          + "' cannot be written");
+        return false;
+      }
+
+      int64_t aLength = (int64_t)aBinFile->tellp();
+      while (aLength % 4 != 0)
+      {
+        aBinFile->write(" ", 1);
+        ++aLength;
+      }
+      aBuffView.MeshoptByteLength = (int64_t)anEncoded[aViewIter].size();
+    }
+    aMeshoptTimer.Stop();
+    Message::SendInfo(TCollection_AsciiString("Meshopt compression time: ")
+                      + aMeshoptTimer.ElapsedTime() + " s");
+#endif
+  }
+
   if (myDracoParameters.DracoCompression)
   {
 #ifdef HAVE_DRACO
@@ -1781,6 +1982,9 @@ void RWGltf_CafWriter::writeBufferViews(const int theBinDataBufferId)
   Standard_ProgramError_Raise_if(myWriter.get() == nullptr,
                                  "Internal error: RWGltf_CafWriter::writeBufferViews()");
 
+  // uncompressed views refer to the fallback buffer following the main one
+  const int aViewBufferId = myToUseMeshopt ? theBinDataBufferId + 1 : theBinDataBufferId;
+
   int aBuffViewId = 0;
   myWriter->Key(RWGltf_GltfRootElementName(RWGltf_GltfRootElement_BufferViews));
   myWriter->StartArray();
@@ -1789,7 +1993,7 @@ void RWGltf_CafWriter::writeBufferViews(const int theBinDataBufferId)
     aBuffViewId++;
     myWriter->StartObject();
     myWriter->Key("buffer");
-    myWriter->Int(theBinDataBufferId);
+    myWriter->Int(aViewBufferId);
     myWriter->Key("byteLength");
     myWriter->Int64(myBuffViewPos.ByteLength);
     myWriter->Key("byteOffset");
@@ -1798,6 +2002,10 @@ void RWGltf_CafWriter::writeBufferViews(const int theBinDataBufferId)
     myWriter->Int64(myBuffViewPos.ByteStride);
     myWriter->Key("target");
     myWriter->Int(myBuffViewPos.Target);
+    if (myToUseMeshopt)
+    {
+      writeMeshoptExtension(*myWriter, myBuffViewPos, theBinDataBufferId);
+    }
     myWriter->EndObject();
   }
   if (myBuffViewNorm.Id != RWGltf_GltfAccessor::INVALID_ID)
@@ -1805,7 +2013,7 @@ void RWGltf_CafWriter::writeBufferViews(const int theBinDataBufferId)
     aBuffViewId++;
     myWriter->StartObject();
     myWriter->Key("buffer");
-    myWriter->Int(theBinDataBufferId);
+    myWriter->Int(aViewBufferId);
     myWriter->Key("byteLength");
     myWriter->Int64(myBuffViewNorm.ByteLength);
     myWriter->Key("byteOffset");
@@ -1814,6 +2022,10 @@ void RWGltf_CafWriter::writeBufferViews(const int theBinDataBufferId)
     myWriter->Int64(myBuffViewNorm.ByteStride);
     myWriter->Key("target");
     myWriter->Int(myBuffViewNorm.Target);
+    if (myToUseMeshopt)
+    {
+      writeMeshoptExtension(*myWriter, myBuffViewNorm, theBinDataBufferId);
+    }
     myWriter->EndObject();
   }
   if (myBuffViewTextCoord.Id != RWGltf_GltfAccessor::INVALID_ID)
@@ -1821,7 +2033,7 @@ void RWGltf_CafWriter::writeBufferViews(const int theBinDataBufferId)
     aBuffViewId++;
     myWriter->StartObject();
     myWriter->Key("buffer");
-    myWriter->Int(theBinDataBufferId);
+    myWriter->Int(aViewBufferId);
     myWriter->Key("byteLength");
     myWriter->Int64(myBuffViewTextCoord.ByteLength);
     myWriter->Key("byteOffset");
@@ -1830,6 +2042,10 @@ void RWGltf_CafWriter::writeBufferViews(const int theBinDataBufferId)
     myWriter->Int64(myBuffViewTextCoord.ByteStride);
     myWriter->Key("target");
     myWriter->Int(myBuffViewTextCoord.Target);
+    if (myToUseMeshopt)
+    {
+      writeMeshoptExtension(*myWriter, myBuffViewTextCoord, theBinDataBufferId);
+    }
     myWriter->EndObject();
   }
   if (myBuffViewInd.Id != RWGltf_GltfAccessor::INVALID_ID)
@@ -1837,13 +2053,17 @@ void RWGltf_CafWriter::writeBufferViews(const int theBinDataBufferId)
     aBuffViewId++;
     myWriter->StartObject();
     myWriter->Key("buffer");
-    myWriter->Int(theBinDataBufferId);
+    myWriter->Int(aViewBufferId);
     myWriter->Key("byteLength");
     myWriter->Int64(myBuffViewInd.ByteLength);
     myWriter->Key("byteOffset");
     myWriter->Int64(myBuffViewInd.ByteOffset);
     myWriter->Key("target");
     myWriter->Int(myBuffViewInd.Target);
+    if (myToUseMeshopt)
+    {
+      writeMeshoptExtension(*myWriter, myBuffViewInd, theBinDataBufferId);
+    }
     myWriter->EndObject();
   }
   if (myDracoParameters.DracoCompression)
@@ -1896,6 +2116,24 @@ void RWGltf_CafWriter::writeBuffers()
     }
     myWriter->EndObject();
   }
+  if (myToUseMeshopt)
+  {
+    // fallback buffer without data
+    myWriter->StartObject();
+    {
+      myWriter->Key("byteLength");
+      myWriter->Int64(myMeshoptFallbackLen64);
+      myWriter->Key("extensions");
+      myWriter->StartObject();
+      myWriter->Key("EXT_meshopt_compression");
+      myWriter->StartObject();
+      myWriter->Key("fallback");
+      myWriter->Bool(true);
+      myWriter->EndObject();
+      myWriter->EndObject();
+    }
+    myWriter->EndObject();
+  }
   myWriter->EndArray();
 #endif
 }
@@ -1908,13 +2146,15 @@ void RWGltf_CafWriter::writeExtensions()
   Standard_ProgramError_Raise_if(myWriter.get() == nullptr,
                                  "Internal error: RWGltf_CafWriter::writeExtensions()");
 
-  if (myDracoParameters.DracoCompression)
+  if (myDracoParameters.DracoCompression || myToUseMeshopt)
   {
+    const char* anExtName =
+      myToUseMeshopt ? "EXT_meshopt_compression" : "KHR_draco_mesh_compression";
     myWriter->Key(RWGltf_GltfRootElementName(RWGltf_GltfRootElement_ExtensionsUsed));
 
     myWriter->StartArray();
     {
-      myWriter->Key("KHR_draco_mesh_compression");
+      myWriter->Key(anExtName);
     }
     myWriter->EndArray();
 
@@ -1922,7 +2162,7 @@ void RWGltf_CafWriter::writeExtensions()
 
     myWriter->StartArray();
     {
-      myWriter->Key("KHR_draco_mesh_compression");
+      myWriter->Key(anExtName);
     }
     myWriter->EndArray();
   }
@@ -155,6 +155,15 @@ public:
     myDracoParameters = theDracoParameters;
   }
 
+  //! Return flag to compress buffer views using EXT_meshopt_compression extension;
+  //! FALSE by default.
+  bool ToUseMeshoptCompression() const { return myToUseMeshopt; }
+
+  //! Set flag to compress buffer views using EXT_meshopt_compression extension.
+  //! Requires meshoptimizer library and cannot be combined with Draco compression.
+  //! Triangle indexes are written as 32-bit integers within compressed buffer views.
+  void SetMeshoptCompression(bool theToUse) { myToUseMeshopt = theToUse; }
+
   //! Write glTF file and associated binary file.
   //! Triangulation data should be precomputed within shapes!
   //! @param[in] theDocument     input document
@@ -539,6 +548,8 @@ protected:
 
   std::vector<RWGltf_GltfBufferView>            myBuffViewsDraco;    //!< vector of buffers view with compression data
   bool                              myToParallel;        //!< flag to use multithreading; FALSE by default
+  bool                              myToUseMeshopt;      //!< flag to compress buffer views by EXT_meshopt_compression
+  int64_t                                       myMeshoptFallbackLen64; //!< length of uncompressed fallback buffer
                                             // clang-format on
   RWGltf_DracoParameters myDracoParameters; //!< Draco parameters
 };
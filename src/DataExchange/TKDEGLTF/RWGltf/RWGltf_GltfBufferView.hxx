@@ -16,6 +16,8 @@
 #define _RWGltf_GltfBufferView_HeaderFile
 
 #include <RWGltf_GltfBufferViewTarget.hxx>
+#include <RWGltf_GltfMeshoptFilter.hxx>
+#include <RWGltf_GltfMeshoptMode.hxx>
 #include <Standard_TypeDef.hxx>
 
 //! Low-level glTF data structure defining BufferView.
@@ -30,12 +32,24 @@ public:
   int32_t                     ByteStride; //!< [0, 255]
   RWGltf_GltfBufferViewTarget Target;
 
+  // EXT_meshopt_compression extension
+  RWGltf_GltfMeshoptMode   MeshoptMode;       //!< compression mode, UNKNOWN if not compressed
+  RWGltf_GltfMeshoptFilter MeshoptFilter;     //!< filter applied to decoded data
+  int64_t                  MeshoptCount;      //!< number of elements in decoded data
+  int64_t                  MeshoptByteOffset; //!< offset to the compressed data in buffer
+  int64_t                  MeshoptByteLength; //!< length of the compressed data
+
   RWGltf_GltfBufferView()
       : Id(INVALID_ID),
         ByteOffset(0),
         ByteLength(0),
         ByteStride(0),
-        Target(RWGltf_GltfBufferViewTarget_UNKNOWN)
+        Target(RWGltf_GltfBufferViewTarget_UNKNOWN),
+        MeshoptMode(RWGltf_GltfMeshoptMode_UNKNOWN),
+        MeshoptFilter(RWGltf_GltfMeshoptFilter_None),
+        MeshoptCount(0),
+        MeshoptByteOffset(0),
+        MeshoptByteLength(0)
   {
   }
 };
@@ -23,10 +23,12 @@
 #include <OSD_File.hxx>
 #include <OSD_FileSystem.hxx>
 #include <OSD_OpenFile.hxx>
+#include <OSD_Parallel.hxx>
 #include <OSD_Path.hxx>
 #include <OSD_ThreadPool.hxx>
 #include <Precision.hxx>
 #include <RWGltf_TriangulationReader.hxx>
+#include <Standard_ArrayStreamBuffer.hxx>
 #include <TDataStd_NamedData.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopoDS.hxx>
@@ -36,6 +38,10 @@
 
 #include <fstream>
 
+#ifdef HAVE_MESHOPTIMIZER
+  #include <meshoptimizer.h>
+#endif
+
 #ifdef HAVE_RAPIDJSON
 namespace
 {
@@ -49,6 +55,7 @@ namespace
 static const char THE_KHR_materials_common[]       = "KHR_materials_common";
 static const char THE_KHR_binary_glTF[]            = "KHR_binary_glTF";
 static const char THE_KHR_draco_mesh_compression[] = "KHR_draco_mesh_compression";
+static const char THE_EXT_meshopt_compression[]    = "EXT_meshopt_compression";
 
 //! Data buffer referring to a portion of another buffer.
 class RWGltf_SubBuffer : public NCollection_Buffer
@@ -668,7 +675,8 @@ RWGltf_GltfJsonParser::RWGltf_GltfJsonParser(NCollection_Sequence<TopoDS_Shape>&
       myUseMeshNameAsFallback(true),
       myToProbeHeader(false),
       myToReadAssetExtras(true),
-      myToApplyScale(true)
+      myToApplyScale(true),
+      myToParallel(false)
 {
   myCSTrsf.SetInputLengthUnit(1.0); // meters
   myCSTrsf.SetInputCoordinateSystem(RWMesh_CoordinateSystem_glTF);
@@ -1961,6 +1969,7 @@ bool RWGltf_GltfJsonParser::gltfParsePrimArray(TopoDS_Shape&                  th
     {
       Message::SendWarning("Deferred loading is available only for triangulations. Other elements "
                            "will be loaded immediately.");
+      decodeMeshoptBufferViews();
       fillMeshData(aMeshData);
     }
 
@@ -2251,6 +2260,20 @@ bool RWGltf_GltfJsonParser::gltfParseBufferView(
     return false;
   }
 
+  // the buffer referred by compressed view might define no data (fallback)
+  const RWGltf_JsonValue* anExtVal = findObjectMember(theBufferView, "extensions");
+  const RWGltf_JsonValue* aMeshoptVal =
+    anExtVal != nullptr ? findObjectMember(*anExtVal, THE_EXT_meshopt_compression) : nullptr;
+  if (aMeshoptVal != nullptr && aMeshoptVal->IsObject())
+  {
+    return gltfParseMeshoptBufferView(theMeshData,
+                                      theName,
+                                      *aMeshoptVal,
+                                      theAccessor,
+                                      aBuffView,
+                                      theType);
+  }
+
   const RWGltf_JsonValue* aBuffer =
     myGltfRoots[RWGltf_GltfRootElement_Buffers].FindChild(*aBufferName);
   if (aBuffer == nullptr || !aBuffer->IsObject())
@@ -2364,6 +2387,270 @@ bool RWGltf_GltfJsonParser::gltfParseBuffer(
   }
 }
 
+//=================================================================================================
+
+bool RWGltf_GltfJsonParser::gltfParseMeshoptBufferView(
+  const occ::handle<RWGltf_GltfLatePrimitiveArray>& theMeshData,
+  const TCollection_AsciiString&                    theName,
+  const RWGltf_JsonValue&                           theExtension,
+  const RWGltf_GltfAccessor&                        theAccessor,
+  const RWGltf_GltfBufferView&                      theView,
+  const RWGltf_GltfArrayType                        theType)
+{
+  occ::handle<NCollection_Buffer> aDecoded;
+  if (!myDecodedViews.Find(theName, aDecoded))
+  {
+    const RWGltf_JsonValue* aBufferName = findObjectMember(theExtension, "buffer");
+    const RWGltf_JsonValue* aByteOffset = findObjectMember(theExtension, "byteOffset");
+    const RWGltf_JsonValue* aByteLength = findObjectMember(theExtension, "byteLength");
+    const RWGltf_JsonValue* aByteStride = findObjectMember(theExtension, "byteStride");
+    const RWGltf_JsonValue* aCount      = findObjectMember(theExtension, "count");
+    const RWGltf_JsonValue* aMode       = findObjectMember(theExtension, "mode");
+    const RWGltf_JsonValue* aFilter     = findObjectMember(theExtension, "filter");
+    if (aBufferName == nullptr || aByteLength == nullptr || aByteStride == nullptr
+        || aCount == nullptr || aMode == nullptr)
+    {
+      reportGltfError("BufferView '" + theName
+                      + "' defines incomplete EXT_meshopt_compression extension.");
+      return false;
+    }
+
+    MeshoptBufferView aView;
+    aView.Name            = theName;
+    aView.View            = theView;
+    aView.View.ByteStride = aByteStride->IsInt() ? aByteStride->GetInt() : 0;
+    aView.View.MeshoptMode =
+      aMode->IsString() ? RWGltf_GltfParseMeshoptMode(aMode->GetString())
+                        : RWGltf_GltfMeshoptMode_UNKNOWN;
+    aView.View.MeshoptFilter =
+      aFilter == nullptr  ? RWGltf_GltfMeshoptFilter_None
+      : aFilter->IsString() ? RWGltf_GltfParseMeshoptFilter(aFilter->GetString())
+                            : RWGltf_GltfMeshoptFilter_UNKNOWN;
+    aView.View.MeshoptCount = aCount->IsNumber() ? (int64_t)aCount->GetDouble() : 0;
+    aView.View.MeshoptByteOffset =
+      aByteOffset != nullptr && aByteOffset->IsNumber() ? (int64_t)aByteOffset->GetDouble() : 0;
+    aView.View.MeshoptByteLength =
+      aByteLength->IsNumber() ? (int64_t)aByteLength->GetDouble() : 0;
+
+    // restrictions of the extension specification
+    const int32_t aStride = aView.View.ByteStride;
+    bool          isValid = aView.View.MeshoptCount > 0 && aView.View.MeshoptByteLength > 0
+                   && aView.View.MeshoptByteOffset >= 0 && aStride > 0;
+    switch (aView.View.MeshoptMode)
+    {
+      case RWGltf_GltfMeshoptMode_Attributes:
+        isValid = isValid && aStride % 4 == 0 && aStride <= 256;
+        break;
+      case RWGltf_GltfMeshoptMode_Triangles:
+        isValid = isValid && aView.View.MeshoptCount % 3 == 0 && (aStride == 2 || aStride == 4);
+        break;
+      case RWGltf_GltfMeshoptMode_Indices:
+        isValid = isValid && (aStride == 2 || aStride == 4);
+        break;
+      case RWGltf_GltfMeshoptMode_UNKNOWN:
+        isValid = false;
+        break;
+    }
+    const bool isAttributes = aView.View.MeshoptMode == RWGltf_GltfMeshoptMode_Attributes;
+    switch (aView.View.MeshoptFilter)
+    {
+      case RWGltf_GltfMeshoptFilter_None:
+        break;
+      case RWGltf_GltfMeshoptFilter_Octahedral:
+        isValid = isValid && isAttributes && (aStride == 4 || aStride == 8);
+        break;
+      case RWGltf_GltfMeshoptFilter_Quaternion:
+        isValid = isValid && isAttributes && aStride == 8;
+        break;
+      case RWGltf_GltfMeshoptFilter_Exponential:
+        isValid = isValid && isAttributes;
+        break;
+      case RWGltf_GltfMeshoptFilter_UNKNOWN:
+        isValid = false;
+        break;
+    }
+    if (!isValid)
+    {
+      reportGltfError("BufferView '" + theName
+                      + "' defines invalid EXT_meshopt_compression extension.");
+      return false;
+    }
+
+    const RWGltf_JsonValue* aBuffer =
+      myGltfRoots[RWGltf_GltfRootElement_Buffers].FindChild(*aBufferName);
+    if (aBuffer == nullptr || !aBuffer->IsObject())
+    {
+      reportGltfError("BufferView '" + theName + "' refers to non-existing buffer.");
+      return false;
+    }
+
+    const TCollection_AsciiString aBufferId = getKeyString(*aBufferName);
+    const RWGltf_JsonValue*       anUriVal  = findObjectMember(*aBuffer, "uri");
+    aView.SourceOffset                      = aView.View.MeshoptByteOffset;
+    if (myIsBinary && (IsEqual("binary_glTF", aBufferId) || anUriVal == nullptr))
+    {
+      aView.SourceUri = myFilePath;
+      aView.SourceOffset += myBinBodyOffset;
+    }
+    else if (anUriVal == nullptr || !anUriVal->IsString() || anUriVal->GetStringLength() == 0)
+    {
+      reportGltfError("Buffer '" + aBufferId + "' does not define uri.");
+      return false;
+    }
+    else if (::strncmp(anUriVal->GetString(), "data:application/octet-stream;base64,", 37) == 0)
+    {
+      if (!myDecodedBuffers.Find(aBufferId, aView.SourceData))
+      {
+        aView.SourceData =
+          FSD_Base64::Decode(anUriVal->GetString() + 37, anUriVal->GetStringLength() - 37);
+        if (aView.SourceData.IsNull())
+        {
+          Message::SendFail("Fail to allocate memory.");
+          return false;
+        }
+        myDecodedBuffers.Bind(aBufferId, aView.SourceData);
+      }
+    }
+    else
+    {
+      const TCollection_AsciiString anUri       = anUriVal->GetString();
+      const TCollection_AsciiString aPath       = myFolder + anUri;
+      bool                          isFileExist = false;
+      if (!myProbedFiles.Find(aPath, isFileExist))
+      {
+        isFileExist = OSD_File(aPath).Exists();
+        myProbedFiles.Bind(aPath, isFileExist);
+      }
+      if (!isFileExist)
+      {
+        reportGltfError("Buffer '" + aBufferId + "' refers to non-existing file '" + anUri + "'.");
+        return false;
+      }
+      aView.SourceUri = aPath;
+      if (myExternalFiles != nullptr)
+      {
+        myExternalFiles->Add(aPath);
+      }
+    }
+
+    // filled by decodeMeshoptBufferViews()
+    aDecoded      = new NCollection_Buffer(NCollection_BaseAllocator::CommonBaseAllocator());
+    aView.Decoded = aDecoded;
+    myMeshoptViews.Append(aView);
+    myDecodedViews.Bind(theName, aDecoded);
+  }
+
+  RWGltf_GltfPrimArrayData& aData = theMeshData->AddPrimArrayData(theType);
+  aData.Accessor                  = theAccessor;
+  aData.Accessor.ByteStride       = theView.ByteStride;
+  aData.StreamOffset              = theAccessor.ByteOffset;
+  aData.StreamLength              = 0;
+  aData.StreamData                = aDecoded;
+  return true;
+}
+
+//=================================================================================================
+
+void RWGltf_GltfJsonParser::decodeMeshoptBufferViews()
+{
+  if (myMeshoptViews.IsEmpty())
+  {
+    return;
+  }
+#ifdef HAVE_MESHOPTIMIZER
+  OSD_Parallel::For(
+    0,
+    myMeshoptViews.Length(),
+    [this](int theIndex) {
+      MeshoptBufferView&           aView = myMeshoptViews.ChangeValue(theIndex);
+      const RWGltf_GltfBufferView& aDef  = aView.View;
+      const size_t                 aLen  = (size_t)aDef.MeshoptByteLength;
+
+      // compressed data is mapped or read from file, if not kept in memory
+      occ::handle<NCollection_Buffer> aSource = aView.SourceData;
+      size_t                          anOffset = (size_t)aView.SourceOffset;
+      if (aSource.IsNull())
+      {
+        const occ::handle<OSD_FileSystem>& aFileSystem = OSD_FileSystem::DefaultFileSystem();
+        aSource  = aFileSystem->OpenMappedBuffer(aView.SourceUri, aView.SourceOffset, aLen);
+        anOffset = 0;
+        if (aSource.IsNull())
+        {
+          std::shared_ptr<std::istream> aStream =
+            aFileSystem->OpenIStream(aView.SourceUri,
+                                     std::ios::in | std::ios::binary,
+                                     aView.SourceOffset);
+          aSource = new NCollection_Buffer(NCollection_BaseAllocator::CommonBaseAllocator());
+          if (aStream.get() == nullptr || !aSource->Allocate(aLen)
+              || !aStream->read((char*)aSource->ChangeData(), (std::streamsize)aLen))
+          {
+            aSource.Nullify();
+          }
+        }
+      }
+      if (aSource.IsNull() || anOffset + aLen > aSource->Size())
+      {
+        reportGltfError("BufferView '" + aView.Name + "' refers to data that cannot be read.");
+        return;
+      }
+
+      const size_t aCount  = (size_t)aDef.MeshoptCount;
+      const size_t aStride = (size_t)aDef.ByteStride;
+      if (!aView.Decoded->Allocate(aCount * aStride))
+      {
+        Message::SendFail("Fail to allocate memory.");
+        return;
+      }
+
+      const unsigned char* aData    = aSource->Data() + anOffset;
+      uint8_t*             aDecoded = aView.Decoded->ChangeData();
+      int                  aResult  = -1;
+      switch (aDef.MeshoptMode)
+      {
+        case RWGltf_GltfMeshoptMode_Attributes:
+          aResult = meshopt_decodeVertexBuffer(aDecoded, aCount, aStride, aData, aLen);
+          break;
+        case RWGltf_GltfMeshoptMode_Triangles:
+          aResult = meshopt_decodeIndexBuffer(aDecoded, aCount, aStride, aData, aLen);
+          break;
+        case RWGltf_GltfMeshoptMode_Indices:
+          aResult = meshopt_decodeIndexSequence(aDecoded, aCount, aStride, aData, aLen);
+          break;
+        case RWGltf_GltfMeshoptMode_UNKNOWN:
+          break;
+      }
+      if (aResult != 0)
+      {
+        reportGltfError("BufferView '" + aView.Name + "' cannot be decoded by meshoptimizer.");
+        aView.Decoded->Free();
+        return;
+      }
+
+      switch (aDef.MeshoptFilter)
+      {
+        case RWGltf_GltfMeshoptFilter_Octahedral:
+          meshopt_decodeFilterOct(aDecoded, aCount, aStride);
+          break;
+        case RWGltf_GltfMeshoptFilter_Quaternion:
+          meshopt_decodeFilterQuat(aDecoded, aCount, aStride);
+          break;
+        case RWGltf_GltfMeshoptFilter_Exponential:
+          meshopt_decodeFilterExp(aDecoded, aCount, aStride);
+          break;
+        case RWGltf_GltfMeshoptFilter_None:
+        case RWGltf_GltfMeshoptFilter_UNKNOWN:
+          break;
+      }
+    },
+    !myToParallel);
+#else
+  Message::SendFail("Error: buffer views compressed by EXT_meshopt_compression cannot be decoded - "
+                    "OCCT has been built without meshoptimizer support [HAVE_MESHOPTIMIZER "
+                    "undefined]");
+#endif
+  myMeshoptViews.Clear();
+}
+
 //=================================================================================================
 void RWGltf_GltfJsonParser::bindNamedShape(TopoDS_Shape&                          theShape,
                                            ShapeMapGroup                          theGroup,
@@ -2517,6 +2804,20 @@ bool RWGltf_GltfJsonParser::fillMeshData(
 
     occ::handle<RWGltf_TriangulationReader> aReader = new RWGltf_TriangulationReader();
     aReader->SetCoordinateSystemConverter(myCSTrsf);
+    if (!aData.StreamData.IsNull())
+    {
+      // data decoded from base64 or EXT_meshopt_compression
+      Standard_ArrayStreamBuffer aStreamBuffer((const char*)aData.StreamData->Data(),
+                                               aData.StreamData->Size());
+      std::istream               aStream(&aStreamBuffer);
+      aStream.seekg((std::streamoff)aData.StreamOffset, std::ios_base::beg);
+      if (!aReader->ReadStream(theMeshData, theMeshData, aStream, aData.Accessor, aData.Type))
+      {
+        return false;
+      }
+      continue;
+    }
+
     std::shared_ptr<std::istream> aNewStream;
     if (myStream != nullptr)
     {
@@ -2565,6 +2866,10 @@ bool RWGltf_GltfJsonParser::Parse(const Message_ProgressRange& theProgress)
     {
       return false;
     }
+    if (!myToProbeHeader)
+    {
+      decodeMeshoptBufferViews();
+    }
   }
   if (!aPS.More())
   {
@@ -140,6 +140,10 @@ public:
   //! TRUE by default. In case of FALSE the average scale is applied to the transformation matrix.
   void SetToApplyScale(bool theToApplyScale) { myToApplyScale = theToApplyScale; }
 
+  //! Set flag to decode buffer views compressed by EXT_meshopt_compression extension
+  //! in parallel threads, FALSE by default.
+  void SetParallel(bool theToParallel) { myToParallel = theToParallel; }
+
   //! Parse glTF document.
   Standard_EXPORT bool Parse(const Message_ProgressRange& theProgress);
 
@@ -246,6 +250,23 @@ protected:
     const RWGltf_GltfBufferView&                      theView,
     const RWGltf_GltfArrayType                        theType);
 
+  //! Parse buffer view compressed by EXT_meshopt_compression extension.
+  //! The view is registered for decoding by decodeMeshoptBufferViews() and primitive array data
+  //! refers to the decoded buffer as to stream data.
+  //! @param theMeshData  source glTF triangulation
+  //! @param theName      buffer view name
+  //! @param theExtension EXT_meshopt_compression extension object of the buffer view
+  //! @param theAccessor  accessor referring to the buffer view
+  //! @param theView      buffer view with properties of decoded data
+  //! @param theType      array type
+  Standard_EXPORT bool gltfParseMeshoptBufferView(
+    const occ::handle<RWGltf_GltfLatePrimitiveArray>& theMeshData,
+    const TCollection_AsciiString&                    theName,
+    const RWGltf_JsonValue&                           theExtension,
+    const RWGltf_GltfAccessor&                        theAccessor,
+    const RWGltf_GltfBufferView&                      theView,
+    const RWGltf_GltfArrayType                        theType);
+
 protected:
   //! Read vec4 from specified item.
   static bool gltfReadVec4(NCollection_Vec4<double>& theVec4, const RWGltf_JsonValue* theVal)
@@ -467,6 +488,10 @@ private:
                                      bool&                          theHasScale,
                                      gp_XYZ&                        theScale) const;
 
+  //! Decode buffer views registered by gltfParseMeshoptBufferView().
+  //! Views failed to be decoded are reported and left empty.
+  Standard_EXPORT void decodeMeshoptBufferViews();
+
   //! Fill lines and points data not deferred.
   //! @param theMeshData source glTF triangulation
   Standard_EXPORT bool fillMeshData(
@@ -478,6 +503,18 @@ protected:
   void reportGltfSyntaxProblem(const TCollection_AsciiString& theMsg,
                                Message_Gravity                theGravity) const;
 
+protected:
+  //! Buffer view compressed by EXT_meshopt_compression extension.
+  struct MeshoptBufferView
+  {
+    RWGltf_GltfBufferView           View;         //!< view definition
+    TCollection_AsciiString         Name;         //!< view name
+    TCollection_AsciiString         SourceUri;    //!< file with compressed data
+    occ::handle<NCollection_Buffer> SourceData;   //!< buffer with compressed data, if not file
+    int64_t                         SourceOffset; //!< offset to compressed data in file or buffer
+    occ::handle<NCollection_Buffer> Decoded;      //!< buffer to be filled by decoded data
+  };
+
 protected:
   NCollection_Sequence<TopoDS_Shape>* myRootShapes; //!< sequence of result root shapes
   NCollection_DataMap<TopoDS_Shape, RWMesh_NodeAttributes, TopTools_ShapeMapHasher>*
@@ -503,6 +540,8 @@ protected:
 
   NCollection_DataMap<TCollection_AsciiString, bool>                            myProbedFiles;
   NCollection_DataMap<TCollection_AsciiString, occ::handle<NCollection_Buffer>> myDecodedBuffers;
+  NCollection_DataMap<TCollection_AsciiString, occ::handle<NCollection_Buffer>> myDecodedViews;
+  NCollection_Vector<MeshoptBufferView> myMeshoptViews; //!< views to be decoded
   NCollection_Vector<TopoDS_Face> myFaceList; //!< face list for loading triangulation
 
   TCollection_AsciiString myFilePath;         //!< file path
@@ -519,6 +558,7 @@ protected:
   bool                      myToProbeHeader;  //!< flag to probe header without full reading, FALSE by default
   bool                      myToReadAssetExtras; //!< flag to translate asset.extras into metadata, TRUE by default
   bool                      myToApplyScale;      //!< flag to apply non-uniform scaling
+  bool                      myToParallel;        //!< flag to decode compressed buffer views in parallel threads
   // clang-format on
 
 #ifdef HAVE_RAPIDJSON
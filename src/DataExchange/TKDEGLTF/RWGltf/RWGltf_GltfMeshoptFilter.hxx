@@ -0,0 +1,53 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#ifndef _RWGltf_GltfMeshoptFilter_HeaderFile
+#define _RWGltf_GltfMeshoptFilter_HeaderFile
+
+#include <Standard_CString.hxx>
+
+//! Low-level glTF enumeration defining filter applied to BufferView data
+//! compressed by EXT_meshopt_compression extension.
+enum RWGltf_GltfMeshoptFilter
+{
+  RWGltf_GltfMeshoptFilter_UNKNOWN,     //!< unknown or invalid filter
+  RWGltf_GltfMeshoptFilter_None,        //!< "NONE", no filter
+  RWGltf_GltfMeshoptFilter_Octahedral,  //!< "OCTAHEDRAL", octahedral encoding of unit vectors
+  RWGltf_GltfMeshoptFilter_Quaternion,  //!< "QUATERNION", encoding of unit quaternions
+  RWGltf_GltfMeshoptFilter_Exponential, //!< "EXPONENTIAL", exponential encoding of floats
+};
+
+//! Parse RWGltf_GltfMeshoptFilter from string.
+inline RWGltf_GltfMeshoptFilter RWGltf_GltfParseMeshoptFilter(const char* theFilter)
+{
+  if (IsEqual("NONE", theFilter))
+  {
+    return RWGltf_GltfMeshoptFilter_None;
+  }
+  else if (IsEqual("OCTAHEDRAL", theFilter))
+  {
+    return RWGltf_GltfMeshoptFilter_Octahedral;
+  }
+  else if (IsEqual("QUATERNION", theFilter))
+  {
+    return RWGltf_GltfMeshoptFilter_Quaternion;
+  }
+  else if (IsEqual("EXPONENTIAL", theFilter))
+  {
+    return RWGltf_GltfMeshoptFilter_Exponential;
+  }
+  return RWGltf_GltfMeshoptFilter_UNKNOWN;
+}
+
+#endif // _RWGltf_GltfMeshoptFilter_HeaderFile
@@ -0,0 +1,65 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#ifndef _RWGltf_GltfMeshoptMode_HeaderFile
+#define _RWGltf_GltfMeshoptMode_HeaderFile
+
+#include <Standard_CString.hxx>
+
+//! Low-level glTF enumeration defining compression mode of BufferView
+//! by EXT_meshopt_compression extension.
+enum RWGltf_GltfMeshoptMode
+{
+  RWGltf_GltfMeshoptMode_UNKNOWN,    //!< unknown or invalid mode (buffer view is not compressed)
+  RWGltf_GltfMeshoptMode_Attributes, //!< "ATTRIBUTES", vertex attributes
+  RWGltf_GltfMeshoptMode_Triangles,  //!< "TRIANGLES", triangle indices
+  RWGltf_GltfMeshoptMode_Indices,    //!< "INDICES", generic indices
+};
+
+//! Parse RWGltf_GltfMeshoptMode from string.
+inline RWGltf_GltfMeshoptMode RWGltf_GltfParseMeshoptMode(const char* theMode)
+{
+  if (IsEqual("ATTRIBUTES", theMode))
+  {
+    return RWGltf_GltfMeshoptMode_Attributes;
+  }
+  else if (IsEqual("TRIANGLES", theMode))
+  {
+    return RWGltf_GltfMeshoptMode_Triangles;
+  }
+  else if (IsEqual("INDICES", theMode))
+  {
+    return RWGltf_GltfMeshoptMode_Indices;
+  }
+  return RWGltf_GltfMeshoptMode_UNKNOWN;
+}
+
+//! Return string name of RWGltf_GltfMeshoptMode.
+inline const char* RWGltf_GltfMeshoptModeName(RWGltf_GltfMeshoptMode theMode)
+{
+  switch (theMode)
+  {
+    case RWGltf_GltfMeshoptMode_Attributes:
+      return "ATTRIBUTES";
+    case RWGltf_GltfMeshoptMode_Triangles:
+      return "TRIANGLES";
+    case RWGltf_GltfMeshoptMode_Indices:
+      return "INDICES";
+    case RWGltf_GltfMeshoptMode_UNKNOWN:
+      break;
+  }
+  return "";
+}
+
+#endif // _RWGltf_GltfMeshoptMode_HeaderFile
@@ -21,6 +21,8 @@
 #include <Standard_ArrayStreamBuffer.hxx>
 #include <Standard_ReadBuffer.hxx>
 
+#include <cstring>
+
 #ifdef HAVE_DRACO
   #include <Standard_WarningsDisable.hxx>
   #include <draco/compression/decode.h>
@@ -147,15 +149,20 @@ bool RWGltf_TriangulationReader::readStreamData(
   const RWGltf_GltfPrimArrayData&                   theGltfData,
   const occ::handle<Poly_Triangulation>&            theDestMesh) const
 {
-  Standard_ArrayStreamBuffer aStreamBuffer((const char*)theGltfData.StreamData->Data(),
-                                           theGltfData.StreamData->Size());
-  std::istream               aStream(&aStreamBuffer);
-  aStream.seekg((std::streamoff)theGltfData.StreamOffset, std::ios_base::beg);
-  if (!readBuffer(theSourceGltfMesh, theDestMesh, aStream, theGltfData.Accessor, theGltfData.Type))
+  const size_t aSize    = theGltfData.StreamData->Size();
+  const size_t anOffset = (size_t)theGltfData.StreamOffset;
+  if (theGltfData.StreamOffset < 0 || anOffset > aSize)
   {
+    reportError(TCollection_AsciiString("Buffer '") + theSourceGltfMesh->Id()
+                + "' defines invalid offset.");
     return false;
   }
-  return true;
+  return readMemoryBuffer(theSourceGltfMesh,
+                          theDestMesh,
+                          theGltfData.StreamData->Data() + anOffset,
+                          aSize - anOffset,
+                          theGltfData.Accessor,
+                          theGltfData.Type);
 }
 
 //=================================================================================================
@@ -168,6 +175,18 @@ bool RWGltf_TriangulationReader::readFileData(
 {
   const occ::handle<OSD_FileSystem>& aFileSystem =
     !theFileSystem.IsNull() ? theFileSystem : OSD_FileSystem::DefaultFileSystem();
+  const occ::handle<NCollection_Buffer> aMappedBuffer =
+    aFileSystem->OpenMappedBuffer(theGltfData.StreamUri, theGltfData.StreamOffset);
+  if (!aMappedBuffer.IsNull())
+  {
+    return readMemoryBuffer(theSourceGltfMesh,
+                            theDestMesh,
+                            aMappedBuffer->Data(),
+                            aMappedBuffer->Size(),
+                            theGltfData.Accessor,
+                            theGltfData.Type);
+  }
+
   std::shared_ptr<std::istream> aSharedStream =
     aFileSystem->OpenIStream(theGltfData.StreamUri,
                              std::ios::in | std::ios::binary,
@@ -569,6 +588,129 @@ bool RWGltf_TriangulationReader::readBuffer(
 
 //=================================================================================================
 
+bool RWGltf_TriangulationReader::readMemoryBuffer(
+  const occ::handle<RWGltf_GltfLatePrimitiveArray>& theSourceMesh,
+  const occ::handle<Poly_Triangulation>&            theDestMesh,
+  const uint8_t*                                    theData,
+  const size_t                                      theSize,
+  const RWGltf_GltfAccessor&                        theAccessor,
+  RWGltf_GltfArrayType                              theType) const
+{
+  const TCollection_AsciiString& aName     = theSourceMesh->Id();
+  const RWGltf_GltfPrimitiveMode aPrimMode = theSourceMesh->PrimitiveMode();
+  const bool                     isVec3    = theAccessor.Type == RWGltf_GltfAccessorLayout_Vec3;
+
+  const bool isSupportedMode = aPrimMode == RWGltf_GltfPrimitiveMode_Triangles
+                               || aPrimMode == RWGltf_GltfPrimitiveMode_Lines
+                               || aPrimMode == RWGltf_GltfPrimitiveMode_Points;
+  const bool isDecoded       =
+    isSupportedMode && theAccessor.ComponentType == RWGltf_GltfAccessorCompType_Float32
+    && ((theType == RWGltf_GltfArrayType_Position && isVec3)
+        || (theType == RWGltf_GltfArrayType_Normal && isVec3)
+        || (theType == RWGltf_GltfArrayType_TCoord0
+            && theAccessor.Type == RWGltf_GltfAccessorLayout_Vec2));
+  if (!isDecoded)
+  {
+    Standard_ArrayStreamBuffer aStreamBuffer((const char*)theData, theSize);
+    std::istream               aStream(&aStreamBuffer);
+    return readBuffer(theSourceMesh, theDestMesh, aStream, theAccessor, theType);
+  }
+  else if (theAccessor.Count > std::numeric_limits<int>::max())
+  {
+    reportError(TCollection_AsciiString("Buffer '") + aName + "' defines too big array.");
+    return false;
+  }
+
+  const size_t anElemSize =
+    isVec3 ? sizeof(NCollection_Vec3<float>) : sizeof(NCollection_Vec2<float>);
+
+  const size_t aStride  = theAccessor.ByteStride != 0 ? theAccessor.ByteStride : anElemSize;
+  const int    aNbNodes = (int)theAccessor.Count;
+  if (aNbNodes > 0 && (size_t)(aNbNodes - 1) * aStride + anElemSize > theSize)
+  {
+    reportError(TCollection_AsciiString("Buffer '") + aName + "' reading error.");
+    return false;
+  }
+
+  // elements are copied to local variables, as the data might be not aligned
+  switch (theType)
+  {
+    case RWGltf_GltfArrayType_Position: {
+      if (!setNbPositionNodes(theDestMesh, aNbNodes))
+      {
+        return false;
+      }
+      if (myCoordSysConverter.IsEmpty() && aStride == anElemSize)
+      {
+        // tightly packed array matching the node storage
+        setNodePositions(theDestMesh,
+                         THE_LOWER_NODE_INDEX,
+                         (const NCollection_Vec3<float>*)theData,
+                         aNbNodes);
+        break;
+      }
+
+      NCollection_Vec3<float> aVec3;
+      for (int aVertIter = 0; aVertIter < aNbNodes; ++aVertIter)
+      {
+        memcpy(aVec3.ChangeData(), theData + aVertIter * aStride, sizeof(aVec3));
+        gp_Pnt anXYZ(aVec3.x(), aVec3.y(), aVec3.z());
+        if (!myCoordSysConverter.IsEmpty())
+        {
+          myCoordSysConverter.TransformPosition(anXYZ.ChangeCoord());
+        }
+        setNodePosition(theDestMesh, THE_LOWER_NODE_INDEX + aVertIter, anXYZ);
+      }
+      break;
+    }
+    case RWGltf_GltfArrayType_Normal: {
+      if (!setNbNormalNodes(theDestMesh, aNbNodes))
+      {
+        return false;
+      }
+
+      NCollection_Vec3<float> aVec3;
+      for (int aVertIter = 0; aVertIter < aNbNodes; ++aVertIter)
+      {
+        memcpy(aVec3.ChangeData(), theData + aVertIter * aStride, sizeof(aVec3));
+        if (aVec3.SquareModulus() >= THE_NORMAL_PREC2)
+        {
+          if (!myCoordSysConverter.IsEmpty())
+          {
+            myCoordSysConverter.TransformNormal(aVec3);
+          }
+        }
+        else
+        {
+          aVec3.SetValues(0.0f, 0.0f, 1.0f);
+        }
+        setNodeNormal(theDestMesh, THE_LOWER_NODE_INDEX + aVertIter, aVec3);
+      }
+      break;
+    }
+    default: {
+      if (!setNbUVNodes(theDestMesh, aNbNodes))
+      {
+        return false;
+      }
+
+      NCollection_Vec2<float> aVec2;
+      for (int aVertIter = 0; aVertIter < aNbNodes; ++aVertIter)
+      {
+        memcpy(aVec2.ChangeData(), theData + aVertIter * aStride, sizeof(aVec2));
+        // Y should be flipped (relative to image layout used by OCCT)
+        setNodeUV(theDestMesh,
+                  THE_LOWER_NODE_INDEX + aVertIter,
+                  gp_Pnt2d(aVec2.x(), 1.0f - aVec2.y()));
+      }
+      break;
+    }
+  }
+  return true;
+}
+
+//=================================================================================================
+
 bool RWGltf_TriangulationReader::ReadStream(
   const occ::handle<RWGltf_GltfLatePrimitiveArray>& theSourceMesh,
   const occ::handle<Poly_Triangulation>&            theDestMesh,
@@ -89,6 +89,8 @@ protected:
     const occ::handle<Poly_Triangulation>&            theDestMesh) const;
 
   //! Reads primitive array from file data.
+  //! The file is mapped into memory by the file system when possible and read as a stream
+  //! otherwise.
   //! @param theSourceGltfMesh source glTF triangulation
   //! @param theGltfData       primitive array element (Uri of file stream should not be empty)
   //! @param theDestMesh       triangulation to be modified
@@ -113,6 +115,25 @@ protected:
     const RWGltf_GltfAccessor&                        theAccessor,
     RWGltf_GltfArrayType                              theType) const;
 
+  //! Fills triangulation data from the buffer in memory (e.g. file mapped by OSD_FileSystem).
+  //! Positions, normals and texture coordinates are decoded directly from memory,
+  //! positions being copied as a whole when their layout matches the node storage of
+  //! Poly_Triangulation; other arrays are passed to readBuffer() through a stream.
+  //! @param theSourceGltfMesh source glTF triangulation
+  //! @param theDestMesh       triangulation to be modified
+  //! @param theData           pointer to the first element of the array
+  //! @param theSize           number of bytes available at theData
+  //! @param theAccessor       buffer accessor
+  //! @param theType           array type
+  //! @return FALSE on error
+  Standard_EXPORT virtual bool readMemoryBuffer(
+    const occ::handle<RWGltf_GltfLatePrimitiveArray>& theSourceGltfMesh,
+    const occ::handle<Poly_Triangulation>&            theDestMesh,
+    const uint8_t*                                    theData,
+    const size_t                                      theSize,
+    const RWGltf_GltfAccessor&                        theAccessor,
+    RWGltf_GltfArrayType                              theType) const;
+
   //! Reads primitive array from file data compressed in Draco format.
   //! @param theSourceGltfMesh source glTF triangulation
   //! @param theGltfData       primitive array element (Uri of file stream should not be empty)
@@ -89,6 +89,10 @@ bool DEIGES_ConfigurationNode::Load(const occ::handle<DE_ConfigurationContext>&
     theResource->BooleanVal("read.fau_lty.entities", InternalParameters.ReadFaultyEntities, aScope);
   InternalParameters.ReadOnlyVisible =
     theResource->BooleanVal("read.onlyvisible", InternalParameters.ReadOnlyVisible, aScope);
+  InternalParameters.ReadParallelTransfer =
+    theResource->BooleanVal("read.parallel.transfer",
+                            InternalParameters.ReadParallelTransfer,
+                            aScope);
   InternalParameters.ReadColor =
     theResource->BooleanVal("read.color", InternalParameters.ReadColor, aScope);
   InternalParameters.ReadName =
@@ -243,6 +247,13 @@ TCollection_AsciiString DEIGES_ConfigurationNode::Save() const
   aResult += aScope + "read.onlyvisible :\t " + InternalParameters.ReadOnlyVisible + "\n";
   aResult += "!\n";
 
+  aResult += "!\n";
+  aResult += "!Translation of roots sharing no entity with other roots in parallel threads\n";
+  aResult += "!Default value: \"Off\"(0). Available values: \"Off\"(0), \"On\"(1)\n";
+  aResult +=
+    aScope + "read.parallel.transfer :\t " + InternalParameters.ReadParallelTransfer + "\n";
+  aResult += "!\n";
+
   aResult += "!\n";
   aResult += "!Setting up the ColorMode parameter which is used to indicate read Colors or not\n";
   aResult += "!Default value: 1. Available values: 0, 1\n";
@@ -29,12 +29,13 @@ void DEIGES_Parameters::InitFromStatic()
   ReadSurfaceCurveMode = (ReadMode_SurfaceCurve)Interface_Static::IVal("read.surfacecurve.mode");
   EncodeRegAngle       = Interface_Static::RVal("read.encoderegularity.angle");
 
-  ReadApproxd1       = Interface_Static::IVal("read.bspline.approxd1.mode") == 1;
-  ReadFaultyEntities = Interface_Static::IVal("read.fau_lty.entities") == 1;
-  ReadOnlyVisible    = Interface_Static::IVal("read.onlyvisible") == 1;
-  ReadColor          = Interface_Static::IVal("read.color") == 1;
-  ReadName           = Interface_Static::IVal("read.name") == 1;
-  ReadLayer          = Interface_Static::IVal("read.layer") == 1;
+  ReadApproxd1         = Interface_Static::IVal("read.bspline.approxd1.mode") == 1;
+  ReadFaultyEntities   = Interface_Static::IVal("read.fau_lty.entities") == 1;
+  ReadOnlyVisible      = Interface_Static::IVal("read.onlyvisible") == 1;
+  ReadParallelTransfer = Interface_Static::IVal("read.iges.parallel.transfer") == 1;
+  ReadColor            = Interface_Static::IVal("read.color") == 1;
+  ReadName             = Interface_Static::IVal("read.name") == 1;
+  ReadLayer            = Interface_Static::IVal("read.layer") == 1;
 
   WriteBRepMode = (WriteMode_BRep)Interface_Static::IVal("write.brep.mode");
   WriteConvertSurfaceMode =
@@ -105,6 +105,7 @@ public:
   bool ReadApproxd1 = false; //<! Flag to split bspline curves of degree 1
   bool ReadFaultyEntities = false; //<! Parameter for reading failed entities
   bool ReadOnlyVisible = false; //<! Parameter for reading invisible entities
+  bool ReadParallelTransfer = false; //<! Defines translation of independent roots in parallel threads
   bool ReadColor = true; //<! ColorMode is used to indicate read Colors or not
   bool ReadName = true; //<! NameMode is used to indicate read Name or not
   bool ReadLayer = true; //<! LayerMode is used to indicate read Layers or not
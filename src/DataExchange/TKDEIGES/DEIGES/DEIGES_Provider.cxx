@@ -44,6 +44,7 @@ void configureIGESCAFReader(IGESCAFControl_Reader&                       theRead
                             const occ::handle<DEIGES_ConfigurationNode>& theNode)
 {
   theReader.SetReadVisible(theNode->InternalParameters.ReadOnlyVisible);
+  theReader.SetParallelTransfer(theNode->InternalParameters.ReadParallelTransfer);
   theReader.SetColorMode(theNode->InternalParameters.ReadColor);
   theReader.SetNameMode(theNode->InternalParameters.ReadName);
   theReader.SetLayerMode(theNode->InternalParameters.ReadLayer);
@@ -55,6 +56,7 @@ void configureIGESControlReader(IGESControl_Reader&                          the
                                 const occ::handle<DEIGES_ConfigurationNode>& theNode)
 {
   theReader.SetReadVisible(theNode->InternalParameters.ReadOnlyVisible);
+  theReader.SetParallelTransfer(theNode->InternalParameters.ReadParallelTransfer);
   theReader.SetShapeFixParameters(theNode->ShapeFixParameters);
 }
 
@@ -198,9 +200,10 @@ void DEIGES_Provider::initStatic(const occ::handle<DE_ConfigurationNode>& theNod
     (DEIGES_Parameters::ReadMode_SurfaceCurve)Interface_Static::IVal("read.surfacecurve.mode");
   myOldValues.EncodeRegAngle = Interface_Static::RVal("read.encoderegularity.angle") * 180.0 / M_PI;
 
-  myOldValues.ReadApproxd1       = Interface_Static::IVal("read.iges.bspline.approxd1.mode") == 1;
-  myOldValues.ReadFaultyEntities = Interface_Static::IVal("read.iges.faulty.entities") == 1;
-  myOldValues.ReadOnlyVisible    = Interface_Static::IVal("read.iges.onlyvisible") == 1;
+  myOldValues.ReadApproxd1         = Interface_Static::IVal("read.iges.bspline.approxd1.mode") == 1;
+  myOldValues.ReadFaultyEntities   = Interface_Static::IVal("read.iges.faulty.entities") == 1;
+  myOldValues.ReadOnlyVisible      = Interface_Static::IVal("read.iges.onlyvisible") == 1;
+  myOldValues.ReadParallelTransfer = Interface_Static::IVal("read.iges.parallel.transfer") == 1;
 
   myOldValues.WriteBRepMode =
     (DEIGES_Parameters::WriteMode_BRep)Interface_Static::IVal("write.iges.brep.mode");
@@ -247,6 +250,7 @@ void DEIGES_Provider::setStatic(const DEIGES_Parameters& theParameter)
   Interface_Static::SetIVal("read.iges.bspline.approxd1.mode", theParameter.ReadApproxd1);
   Interface_Static::SetIVal("read.iges.faulty.entities", theParameter.ReadFaultyEntities);
   Interface_Static::SetIVal("read.iges.onlyvisible", theParameter.ReadOnlyVisible);
+  Interface_Static::SetIVal("read.iges.parallel.transfer", theParameter.ReadParallelTransfer);
 
   Interface_Static::SetIVal("write.iges.brep.mode", theParameter.WriteBRepMode);
   Interface_Static::SetIVal("write.convertsurface.mode", theParameter.WriteConvertSurfaceMode);
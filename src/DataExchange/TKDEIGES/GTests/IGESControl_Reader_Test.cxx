@@ -0,0 +1,85 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <BRepBndLib.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRep_Builder.hxx>
+#include <Bnd_Box.hxx>
+#include <IGESControl_Reader.hxx>
+#include <IGESControl_Writer.hxx>
+#include <OSD_File.hxx>
+#include <OSD_Path.hxx>
+#include <Precision.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS_Compound.hxx>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+//! Reads the file and translates its roots.
+TopoDS_Shape readIGES(const TCollection_AsciiString& theFile, const bool theIsParallel)
+{
+  IGESControl_Reader aReader;
+  aReader.SetParallelTransfer(theIsParallel);
+  EXPECT_EQ(IFSelect_RetDone, aReader.ReadFile(theFile.ToCString()));
+  EXPECT_EQ(aReader.NbRootsForTransfer(), aReader.TransferRoots());
+  return aReader.OneShape();
+}
+
+//! Returns the number of faces of the shape.
+int nbFaces(const TopoDS_Shape& theShape)
+{
+  int aNbFaces = 0;
+  for (TopExp_Explorer anExp(theShape, TopAbs_FACE); anExp.More(); anExp.Next())
+  {
+    ++aNbFaces;
+  }
+  return aNbFaces;
+}
+} // namespace
+
+// Check that translation of independent roots in parallel threads gives the same shapes.
+TEST(IGESControl_Reader_Test, ParallelTransfer)
+{
+  BRep_Builder    aBuilder;
+  TopoDS_Compound aCompound;
+  aBuilder.MakeCompound(aCompound);
+  aBuilder.Add(aCompound, BRepPrimAPI_MakeBox(gp_Pnt(0., 0., 0.), 1., 2., 3.).Shape());
+  aBuilder.Add(aCompound, BRepPrimAPI_MakeBox(gp_Pnt(5., 5., 5.), 3., 2., 1.).Shape());
+
+  // faces mode: each face is a separate root
+  const TCollection_AsciiString aFile = "IGESControl_Reader_Test_ParallelTransfer.igs";
+  IGESControl_Writer            aWriter("MM", 0);
+  ASSERT_TRUE(aWriter.AddShape(aCompound));
+  ASSERT_TRUE(aWriter.Write(aFile.ToCString()));
+
+  const TopoDS_Shape aSequential = readIGES(aFile, false);
+  const TopoDS_Shape aParallel   = readIGES(aFile, true);
+  OSD_File(OSD_Path(aFile)).Remove();
+
+  EXPECT_EQ(12, nbFaces(aSequential));
+  EXPECT_EQ(nbFaces(aSequential), nbFaces(aParallel));
+
+  TopExp_Explorer aSeqExp(aSequential, TopAbs_FACE);
+  TopExp_Explorer aParExp(aParallel, TopAbs_FACE);
+  for (; aSeqExp.More() && aParExp.More(); aSeqExp.Next(), aParExp.Next())
+  {
+    Bnd_Box aSeqBox, aParBox;
+    BRepBndLib::Add(aSeqExp.Current(), aSeqBox);
+    BRepBndLib::Add(aParExp.Current(), aParBox);
+    EXPECT_NEAR(0., aSeqBox.CornerMin().Distance(aParBox.CornerMin()), Precision::Confusion());
+    EXPECT_NEAR(0., aSeqBox.CornerMax().Distance(aParBox.CornerMax()), Precision::Confusion());
+  }
+}
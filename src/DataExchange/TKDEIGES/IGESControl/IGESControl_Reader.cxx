@@ -31,6 +31,7 @@
 #include <Interface_Static.hxx>
 #include <Message_Messenger.hxx>
 #include <Message_Msg.hxx>
+#include <Message_ProgressScope.hxx>
 #include <NCollection_DataMap.hxx>
 #include <OSD_Timer.hxx>
 #include <Transfer_ActorOfTransientProcess.hxx>
@@ -54,8 +55,9 @@ IGESControl_Reader::IGESControl_Reader()
   IGESControl_Controller::Init();
   SetWS(new XSControl_WorkSession);
   SetNorm("IGES");
-  int onlyvisible    = Interface_Static::IVal("read.iges.onlyvisible");
-  theReadOnlyVisible = (onlyvisible == 1);
+  int onlyvisible      = Interface_Static::IVal("read.iges.onlyvisible");
+  theReadOnlyVisible   = (onlyvisible == 1);
+  myIsParallelTransfer = Interface_Static::IVal("read.iges.parallel.transfer") == 1;
 }
 
 //=================================================================================================
@@ -66,8 +68,9 @@ IGESControl_Reader::IGESControl_Reader(const occ::handle<XSControl_WorkSession>&
   IGESControl_Controller::Init();
   SetWS(WS, scratch);
   SetNorm("IGES");
-  int onlyvisible    = Interface_Static::IVal("read.iges.onlyvisible");
-  theReadOnlyVisible = (onlyvisible == 1);
+  int onlyvisible      = Interface_Static::IVal("read.iges.onlyvisible");
+  theReadOnlyVisible   = (onlyvisible == 1);
+  myIsParallelTransfer = Interface_Static::IVal("read.iges.parallel.transfer") == 1;
 }
 
 //=================================================================================================
@@ -115,6 +118,36 @@ int IGESControl_Reader::NbRootsForTransfer()
   return theroots.Length();
 }
 
+//=================================================================================================
+
+int IGESControl_Reader::TransferRoots(const Message_ProgressRange& theProgress)
+{
+  occ::handle<IGESData_IGESModel> aModel = IGESModel();
+  if (!myIsParallelTransfer || aModel.IsNull())
+  {
+    return XSControl_Reader::TransferRoots(theProgress);
+  }
+
+  NbRootsForTransfer();
+  const occ::handle<XSControl_TransferReader>& aTR = WS()->TransferReader();
+  occ::handle<IGESToBRep_Actor>                anActor =
+    occ::down_cast<IGESToBRep_Actor>(WS()->NormAdaptor()->ActorRead(aModel));
+  if (anActor.IsNull() || !aTR->BeginTransfer())
+  {
+    return XSControl_Reader::TransferRoots(theProgress);
+  }
+  InitializeMissingParameters();
+
+  // results of the parallel stage are found by the sequential one in the transfer process
+  Message_ProgressScope aPS(theProgress, "Root", 2);
+  anActor->TransferInParallel(theroots, aTR->TransientProcess(), aPS.Next());
+  if (aPS.UserBreak())
+  {
+    return 0;
+  }
+  return XSControl_Reader::TransferRoots(aPS.Next());
+}
+
 //  ####    Remainder of methods to be reworked    ####
 
 //=======================================================================
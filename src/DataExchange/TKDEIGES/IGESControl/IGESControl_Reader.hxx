@@ -80,6 +80,13 @@ public:
 
   bool GetReadVisible() const;
 
+  //! Sets the translation of roots sharing no entity with other roots
+  //! in parallel threads by TransferRoots() (see IGESToBRep_Actor::TransferInParallel()).
+  void SetParallelTransfer(const bool theIsParallel);
+
+  //! Returns true if the independent roots are translated in parallel threads.
+  bool GetParallelTransfer() const;
+
   //! Returns the model as a IGESModel.
   //! It can then be consulted (header, product)
   Standard_EXPORT occ::handle<IGESData_IGESModel> IGESModel() const;
@@ -89,6 +96,12 @@ public:
   //! <theReadOnlyVisible> is taken into account to define roots
   Standard_EXPORT int NbRootsForTransfer() override;
 
+  //! Translates all translatable roots and returns the number of successful translations.
+  //! If parallel transfer is set, the independent roots are translated in parallel threads
+  //! beforehand, the remaining roots are translated sequentially.
+  Standard_EXPORT int TransferRoots(
+    const Message_ProgressRange& theProgress = Message_ProgressRange()) override;
+
   //! Prints Statistics and check list for Transfer
   Standard_EXPORT void PrintTransferInfo(const IFSelect_PrintFail  failwarn,
                                          const IFSelect_PrintCount mode) const;
@@ -104,6 +117,7 @@ protected:
 
 private:
   bool theReadOnlyVisible;
+  bool myIsParallelTransfer;
 };
 
 #include <IGESControl_Reader.lxx>
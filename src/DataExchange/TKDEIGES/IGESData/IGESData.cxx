@@ -163,6 +163,13 @@ void IGESData::Init()
   Interface_Static::Init("XSTEP", "read.iges.onlyvisible", '&', "eval On");
   Interface_Static::SetIVal("read.iges.onlyvisible", 0);
 
+  // Translation of independent roots in parallel threads
+  Interface_Static::Init("XSTEP", "read.iges.parallel.transfer", 'e', "");
+  Interface_Static::Init("XSTEP", "read.iges.parallel.transfer", '&', "ematch 0");
+  Interface_Static::Init("XSTEP", "read.iges.parallel.transfer", '&', "eval Off");
+  Interface_Static::Init("XSTEP", "read.iges.parallel.transfer", '&', "eval On");
+  Interface_Static::SetIVal("read.iges.parallel.transfer", 0);
+
   // gka added parameter for reading failed entities. 19.07
   Interface_Static::Init("XSTEP", "read.iges.faulty.entities", 'e', "");
   Interface_Static::Init("XSTEP", "read.iges.faulty.entities", '&', "ematch 0");
@@ -16,10 +16,16 @@
 #include <IGESToBRep.hxx>
 #include <IGESToBRep_Actor.hxx>
 #include <IGESToBRep_CurveAndSurface.hxx>
+#include <Interface_EntityIterator.hxx>
+#include <Interface_Graph.hxx>
+#include <Interface_HGraph.hxx>
 #include <Interface_InterfaceModel.hxx>
 #include <MoniTool_Macros.hxx>
 #include <Interface_Static.hxx>
 #include <Message_ProgressScope.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_ThreadPool.hxx>
 #include <ShapeExtend_Explorer.hxx>
 #include <ShapeFix_ShapeTolerance.hxx>
 #include <Standard_ErrorHandler.hxx>
@@ -147,71 +153,82 @@ occ::handle<Transfer_Binder> IGESToBRep_Actor::Transfer(
 
   if (Interface_Static::IVal("read.iges.faulty.entities") == 0 && mymodel->IsErrorEntity(anum))
     return NullResult();
-  TopoDS_Shape shape;
 
   // Call the transfer only if type is OK.
-  int    typnum = ent->TypeNumber();
-  int    fornum = ent->FormNumber();
+  if (!Recognize(ent))
+    return NullResult();
+
+  XSAlgo_ShapeProcessor::PrepareForTransfer();
+  const TopoDS_Shape shape = transferShape(ent, TP, theeps, theProgress);
+  occ::handle<TransferBRep_ShapeBinder> binder;
+  if (!shape.IsNull())
+    binder = new TransferBRep_ShapeBinder(shape);
+  return binder;
+}
+
+//=================================================================================================
+
+TopoDS_Shape IGESToBRep_Actor::transferShape(const occ::handle<IGESData_IGESEntity>&       theEnt,
+                                             const occ::handle<Transfer_TransientProcess>& theTP,
+                                             double&                      theTolerance,
+                                             const Message_ProgressRange& theProgress) const
+{
+  DeclareAndCast(IGESData_IGESModel, mymodel, themodel);
+  TopoDS_Shape shape;
+
+  // Start progress scope (no need to check if progress exists -- it is safe)
+  Message_ProgressScope aPS(theProgress, "Transfer stage", 2);
+
+  IGESToBRep_CurveAndSurface CAS;
+  CAS.SetModel(mymodel);
+  CAS.SetContinuity(thecontinuity);
+  CAS.SetTransferProcess(theTP);
   double eps;
-  if (IGESToBRep::IsCurveAndSurface(ent)
-      || (typnum == 402 && (fornum == 1 || fornum == 7 || fornum == 14 || fornum == 15))
-      || (typnum == 408) || (typnum == 308))
-  {
+  int    Ival = Interface_Static::IVal("read.precision.mode");
+  if (Ival == 0)
+    eps = mymodel->GlobalSection().Resolution();
+  else
+    eps = Interface_Static::RVal("read.precision.val"); //: 10 ABV 11 Nov 97
+  //: 10      eps = BRepAPI::Precision();
+  Ival = Interface_Static::IVal("read.iges.bspline.approxd1.mode");
+  CAS.SetModeApprox((Ival > 0));
+  Ival = Interface_Static::IVal("read.surfacecurve.mode");
+  CAS.SetSurfaceCurve(Ival);
 
-    // Start progress scope (no need to check if progress exists -- it is safe)
-    Message_ProgressScope aPS(theProgress, "Transfer stage", 2);
-
-    XSAlgo_ShapeProcessor::PrepareForTransfer();
-    IGESToBRep_CurveAndSurface CAS;
-    CAS.SetModel(mymodel);
-    CAS.SetContinuity(thecontinuity);
-    CAS.SetTransferProcess(TP);
-    int Ival = Interface_Static::IVal("read.precision.mode");
-    if (Ival == 0)
-      eps = mymodel->GlobalSection().Resolution();
-    else
-      eps = Interface_Static::RVal("read.precision.val"); //: 10 ABV 11 Nov 97
-    //: 10      eps = BRepAPI::Precision();
-    Ival = Interface_Static::IVal("read.iges.bspline.approxd1.mode");
-    CAS.SetModeApprox((Ival > 0));
-    Ival = Interface_Static::IVal("read.surfacecurve.mode");
-    CAS.SetSurfaceCurve(Ival);
-
-    if (eps > 1.E-08)
+  if (eps > 1.E-08)
+  {
+    CAS.SetEpsGeom(eps);
+    theTolerance = eps * CAS.GetUnitFactor();
+  }
+  int nbTPitems = theTP->NbMapped();
+  {
+    try
     {
-      CAS.SetEpsGeom(eps);
-      theeps = eps * CAS.GetUnitFactor();
+      OCC_CATCH_SIGNALS
+      shape = CAS.TransferGeometry(theEnt, aPS.Next());
     }
-    int nbTPitems = TP->NbMapped();
+    catch (Standard_Failure const&)
     {
-      try
-      {
-        OCC_CATCH_SIGNALS
-        shape = CAS.TransferGeometry(ent, aPS.Next());
-      }
-      catch (Standard_Failure const&)
-      {
-        shape.Nullify();
-      }
+      shape.Nullify();
     }
-
-    // fixing shape
-
-    // Set tolerances for shape processing.
-    // These parameters are calculated inside IGESToBRep_Actor::Transfer() and cannot be set from
-    // outside.
-    XSAlgo_ShapeProcessor::ParameterMap aParameters = GetShapeFixParameters();
-    XSAlgo_ShapeProcessor::SetParameter("FixShape.Tolerance3d", theeps, true, aParameters);
-    XSAlgo_ShapeProcessor::SetParameter("FixShape.MaxTolerance3d",
-                                        CAS.GetMaxTol(),
-                                        true,
-                                        aParameters);
-
-    XSAlgo_ShapeProcessor aShapeProcessor(aParameters);
-    shape = aShapeProcessor.ProcessShape(shape, GetProcessingFlags().first, aPS.Next());
-    aShapeProcessor.MergeTransferInfo(TP, nbTPitems);
   }
 
+  // fixing shape
+
+  // Set tolerances for shape processing.
+  // These parameters are calculated inside IGESToBRep_Actor::Transfer() and cannot be set from
+  // outside.
+  XSAlgo_ShapeProcessor::ParameterMap aParameters = GetShapeFixParameters();
+  XSAlgo_ShapeProcessor::SetParameter("FixShape.Tolerance3d", theTolerance, true, aParameters);
+  XSAlgo_ShapeProcessor::SetParameter("FixShape.MaxTolerance3d",
+                                      CAS.GetMaxTol(),
+                                      true,
+                                      aParameters);
+
+  XSAlgo_ShapeProcessor aShapeProcessor(aParameters);
+  shape = aShapeProcessor.ProcessShape(shape, GetProcessingFlags().first, aPS.Next());
+  aShapeProcessor.MergeTransferInfo(theTP, nbTPitems);
+
   ShapeExtend_Explorer SBE;
   if (SBE.ShapeType(shape, true) != TopAbs_SHAPE)
   {
@@ -219,14 +236,161 @@ occ::handle<Transfer_Binder> IGESToBRep_Actor::Transfer(
     {
       EncodeRegul(shape);
       // #74 rln 03.03.99 S4135
-      TrimTolerances(shape, UsedTolerance());
+      TrimTolerances(shape, theTolerance);
       //   Shapes().Append(shape);
     }
   }
-  occ::handle<TransferBRep_ShapeBinder> binder;
-  if (!shape.IsNull())
-    binder = new TransferBRep_ShapeBinder(shape);
-  return binder;
+  return shape;
+}
+
+//=================================================================================================
+
+int IGESToBRep_Actor::TransferInParallel(
+  const NCollection_Sequence<occ::handle<Standard_Transient>>& theRoots,
+  const occ::handle<Transfer_TransientProcess>&                theTP,
+  const Message_ProgressRange&                                 theProgress)
+{
+  DeclareAndCast(IGESData_IGESModel, aModel, themodel);
+  if (aModel.IsNull() || theTP.IsNull() || theRoots.Length() < 2)
+  {
+    return 0;
+  }
+
+  const occ::handle<Interface_HGraph> aHGraph =
+    theTP->HasGraph() ? theTP->HGraph() : new Interface_HGraph(aModel);
+  const Interface_Graph& aGraph = aHGraph->Graph();
+
+  // mark each entity by the root referring to it; a root meeting an entity
+  // already marked by another root depends on it, so both are left sequential
+  const int                aNbRoots = theRoots.Length();
+  NCollection_Array1<int>  anOwners(1, aModel->NbEntities());
+  NCollection_Array1<bool> anIsDependent(1, aNbRoots);
+  anOwners.Init(0);
+  anIsDependent.Init(false);
+  NCollection_Vector<int> aStack;
+  for (int aRootIter = 1; aRootIter <= aNbRoots; ++aRootIter)
+  {
+    const int aRootNum = aModel->Number(theRoots.Value(aRootIter));
+    if (aRootNum == 0)
+    {
+      anIsDependent(aRootIter) = true;
+      continue;
+    }
+    aStack.Append(aRootNum);
+    while (!aStack.IsEmpty())
+    {
+      const int aNum = aStack.Last();
+      aStack.EraseLast();
+      int& anOwner = anOwners(aNum);
+      if (anOwner == aRootIter)
+      {
+        continue;
+      }
+      if (anOwner != 0)
+      {
+        anIsDependent(anOwner)   = true;
+        anIsDependent(aRootIter) = true;
+        continue;
+      }
+      anOwner = aRootIter;
+      for (Interface_EntityIterator anIter = aGraph.Shareds(aModel->Value(aNum)); anIter.More();
+           anIter.Next())
+      {
+        const int aSharedNum = aGraph.EntityNumber(anIter.Value());
+        if (aSharedNum != 0)
+        {
+          aStack.Append(aSharedNum);
+        }
+      }
+    }
+  }
+
+  const bool isFaultyRead = Interface_Static::IVal("read.iges.faulty.entities") != 0;
+  NCollection_Vector<occ::handle<IGESData_IGESEntity>> aRoots;
+  for (int aRootIter = 1; aRootIter <= aNbRoots; ++aRootIter)
+  {
+    occ::handle<IGESData_IGESEntity> anEnt =
+      occ::down_cast<IGESData_IGESEntity>(theRoots.Value(aRootIter));
+    if (anIsDependent(aRootIter) || anEnt.IsNull() || theTP->IsBound(anEnt) || !Recognize(anEnt)
+        || (!isFaultyRead && aModel->IsErrorEntity(aModel->Number(anEnt))))
+    {
+      continue;
+    }
+    aRoots.Append(anEnt);
+  }
+  if (aRoots.Size() < 2)
+  {
+    return 0;
+  }
+
+  Message_ProgressScope                     aPS(theProgress, "Parallel transfer", aRoots.Size());
+  NCollection_Array1<Message_ProgressRange> aRanges(0, aRoots.Size() - 1);
+  for (int anIter = 0; anIter < aRoots.Size(); ++anIter)
+  {
+    aRanges(anIter) = aPS.Next();
+  }
+
+  XSAlgo_ShapeProcessor::PrepareForTransfer();
+  OSD_ThreadPool::Launcher aLauncher(*OSD_ThreadPool::DefaultPool());
+  NCollection_Array1<occ::handle<Transfer_TransientProcess>> aThreadTPs(
+    aLauncher.LowerThreadIndex(),
+    aLauncher.UpperThreadIndex());
+  for (int aThreadIter = aThreadTPs.Lower(); aThreadIter <= aThreadTPs.Upper(); ++aThreadIter)
+  {
+    aThreadTPs(aThreadIter) = new Transfer_TransientProcess(aModel->NbEntities());
+    aThreadTPs(aThreadIter)->SetGraph(aHGraph);
+  }
+
+  double aTolerance = theeps;
+  aLauncher.Perform(0, aRoots.Size(), [&](const int theThreadIndex, const int theIndex) {
+    const occ::handle<IGESData_IGESEntity>&       anEnt = aRoots.Value(theIndex);
+    const occ::handle<Transfer_TransientProcess>& aTP   = aThreadTPs(theThreadIndex);
+    double                                        aRootTolerance = theeps;
+    TopoDS_Shape                                  aShape;
+    try
+    {
+      OCC_CATCH_SIGNALS
+      aShape = transferShape(anEnt, aTP, aRootTolerance, aRanges(theIndex));
+    }
+    catch (Standard_Failure const&)
+    {
+      aShape.Nullify();
+    }
+    if (theIndex == 0)
+    {
+      aTolerance = aRootTolerance;
+    }
+    if (aShape.IsNull())
+    {
+      return;
+    }
+    // as in Transfer_ProcessForTransient::Transferring(), the result of the actor wins
+    occ::handle<Transfer_Binder> aBinder = new TransferBRep_ShapeBinder(aShape);
+    if (aTP->IsBound(anEnt))
+    {
+      aTP->Rebind(anEnt, aBinder);
+    }
+    else
+    {
+      aTP->Bind(anEnt, aBinder);
+    }
+  });
+  theeps = aTolerance;
+
+  // the closures of independent roots are disjoint, so each entity is bound by one thread only
+  for (int aThreadIter = aThreadTPs.Lower(); aThreadIter <= aThreadTPs.Upper(); ++aThreadIter)
+  {
+    const occ::handle<Transfer_TransientProcess>& aThreadTP = aThreadTPs(aThreadIter);
+    for (int anItemIter = 1; anItemIter <= aThreadTP->NbMapped(); ++anItemIter)
+    {
+      const occ::handle<Standard_Transient>& anItem = aThreadTP->Mapped(anItemIter);
+      if (!theTP->IsBound(anItem))
+      {
+        theTP->Bind(anItem, aThreadTP->MapItem(anItemIter));
+      }
+    }
+  }
+  return aRoots.Size();
 }
 
 //=============================================================================
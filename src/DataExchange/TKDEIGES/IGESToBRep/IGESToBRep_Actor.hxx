@@ -23,10 +23,13 @@
 #include <Standard_Integer.hxx>
 #include <Transfer_ActorOfTransientProcess.hxx>
 #include <Message_ProgressRange.hxx>
+#include <NCollection_Sequence.hxx>
 
 struct DE_ShapeFixParameters;
+class IGESData_IGESEntity;
 class Interface_InterfaceModel;
 class Standard_Transient;
+class TopoDS_Shape;
 class Transfer_Binder;
 class Transfer_TransientProcess;
 
@@ -57,12 +60,40 @@ public:
     const occ::handle<Transfer_TransientProcess>& TP,
     const Message_ProgressRange&                  theProgress = Message_ProgressRange()) override;
 
+  //! Translates the roots which share no entity with other roots in parallel threads
+  //! and binds the results in the transfer process, so that the following Transfer
+  //! of these roots through the transfer process just returns them.
+  //! Each thread uses its own transfer process and IGESToBRep_CurveAndSurface tool;
+  //! their bindings are merged into <theTP> sequentially after translation.
+  //! Roots depending on other roots, and roots already bound, are left untouched.
+  //! @param theRoots    roots to be transferred
+  //! @param theTP       transfer process to receive the results
+  //! @param theProgress progress indicator
+  //! @return number of roots translated in parallel
+  Standard_EXPORT int TransferInParallel(
+    const NCollection_Sequence<occ::handle<Standard_Transient>>& theRoots,
+    const occ::handle<Transfer_TransientProcess>&                theTP,
+    const Message_ProgressRange& theProgress = Message_ProgressRange());
+
   //! Returns the tolerance which was actually used, either from
   //! the file or from statics
   Standard_EXPORT double UsedTolerance() const;
 
   DEFINE_STANDARD_RTTIEXT(IGESToBRep_Actor, Transfer_ActorOfTransientProcess)
 
+private:
+  //! Translates the recognized entity into a shape and processes it.
+  //! Does not modify the actor, so may be called from several threads.
+  //! @param theEnt       entity to be translated
+  //! @param theTP        transfer process to receive bindings of sub-entities
+  //! @param theTolerance [in,out] tolerance of the translation, updated from the settings
+  //! @param theProgress  progress indicator
+  //! @return processed shape, null if translation failed
+  TopoDS_Shape transferShape(const occ::handle<IGESData_IGESEntity>&       theEnt,
+                             const occ::handle<Transfer_TransientProcess>& theTP,
+                             double&                                       theTolerance,
+                             const Message_ProgressRange&                  theProgress) const;
+
 private:
   occ::handle<Interface_InterfaceModel> themodel;
   int                                   thecontinuity;
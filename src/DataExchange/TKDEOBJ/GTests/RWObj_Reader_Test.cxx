@@ -0,0 +1,139 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <OSD_File.hxx>
+#include <OSD_OpenFile.hxx>
+#include <OSD_Path.hxx>
+#include <Poly_Triangulation.hxx>
+#include <RWObj_Tools.hxx>
+#include <RWObj_TriangulationReader.hxx>
+
+#include <cstring>
+#include <fstream>
+#include <gtest/gtest.h>
+
+namespace
+{
+//! Writes OBJ file with a regular grid, mixing groups, quads, negative indices and line breaks.
+void writeGrid(const char* theFile, const int theNbCells)
+{
+  std::ofstream aFile;
+  OSD_OpenStream(aFile, theFile, std::ios::out | std::ios::binary);
+  aFile << "# grid\n\n";
+  char aBuffer[256];
+  int  aNbNodes = 0;
+  for (int aRow = 0; aRow <= theNbCells; ++aRow)
+  {
+    if (aRow % 50 == 0)
+    {
+      aFile << "g row" << aRow << "\r\n";
+    }
+    for (int aCol = 0; aCol <= theNbCells; ++aCol)
+    {
+      Sprintf(aBuffer,
+              "v %.6f %.9g %g\nvt %.4f %.4f\nvn 0 0 1\n",
+              aCol * 0.1234567,
+              aRow * 1.000001,
+              1.0e-7 * ((aRow * aCol) % 13),
+              aCol / double(theNbCells),
+              aRow / double(theNbCells));
+      aFile << aBuffer;
+      ++aNbNodes;
+    }
+    if (aRow == 0)
+    {
+      continue;
+    }
+    for (int aCol = 0; aCol < theNbCells; ++aCol)
+    {
+      const int aNode1 = (aRow - 1) * (theNbCells + 1) + aCol + 1;
+      const int aNode2 = aNode1 + theNbCells + 1;
+      if (aCol % 2 == 0)
+      {
+        aFile << "f " << aNode1 << "/" << aNode1 << "/" << aNode1 << " " << aNode1 + 1 << "/"
+              << aNode1 + 1 << "/" << aNode1 + 1 << " " << aNode2 + 1 << "//" << aNode2 + 1 << " "
+              << aNode2 << "/" << aNode2 << "\n";
+      }
+      else
+      {
+        aFile << "f " << aNode1 << " " << (aNode1 + 1) - aNbNodes - 1 << " \\\n  " << aNode2
+              << "\r\n";
+      }
+    }
+  }
+}
+
+//! Reads the file into a single triangulation.
+occ::handle<Poly_Triangulation> readObj(const char* theFile, const bool theToParallel)
+{
+  RWObj_TriangulationReader aReader;
+  aReader.SetCreateShapes(false);
+  aReader.SetParallel(theToParallel);
+  EXPECT_TRUE(aReader.Read(theFile, Message_ProgressRange()));
+  EXPECT_TRUE(aReader.FileComments().IsEqual("grid"));
+  return aReader.GetTriangulation();
+}
+} // namespace
+
+TEST(RWObj_Reader_Test, ParallelRead)
+{
+  const char* aFile = "RWObj_Reader_Test_ParallelRead.obj";
+  writeGrid(aFile, 300);
+  const occ::handle<Poly_Triangulation> aSequential = readObj(aFile, false);
+  const occ::handle<Poly_Triangulation> aParallel   = readObj(aFile, true);
+  OSD_File(OSD_Path(aFile)).Remove();
+
+  ASSERT_FALSE(aSequential.IsNull());
+  ASSERT_FALSE(aParallel.IsNull());
+  EXPECT_EQ(300 * (150 * 2 + 150), aSequential->NbTriangles());
+  ASSERT_EQ(aSequential->NbNodes(), aParallel->NbNodes());
+  ASSERT_EQ(aSequential->NbTriangles(), aParallel->NbTriangles());
+  ASSERT_EQ(aSequential->HasUVNodes(), aParallel->HasUVNodes());
+  ASSERT_EQ(aSequential->HasNormals(), aParallel->HasNormals());
+  for (int aNodeIter = 1; aNodeIter <= aSequential->NbNodes(); ++aNodeIter)
+  {
+    EXPECT_TRUE(aSequential->Node(aNodeIter).IsEqual(aParallel->Node(aNodeIter), 0.0));
+    if (aSequential->HasUVNodes())
+    {
+      EXPECT_TRUE(aSequential->UVNode(aNodeIter).IsEqual(aParallel->UVNode(aNodeIter), 0.0));
+    }
+  }
+  for (int aTriIter = 1; aTriIter <= aSequential->NbTriangles(); ++aTriIter)
+  {
+    int aSeqNodes[3], aParNodes[3];
+    aSequential->Triangle(aTriIter).Get(aSeqNodes[0], aSeqNodes[1], aSeqNodes[2]);
+    aParallel->Triangle(aTriIter).Get(aParNodes[0], aParNodes[1], aParNodes[2]);
+    EXPECT_EQ(aSeqNodes[0], aParNodes[0]);
+    EXPECT_EQ(aSeqNodes[1], aParNodes[1]);
+    EXPECT_EQ(aSeqNodes[2], aParNodes[2]);
+  }
+}
+
+TEST(RWObj_Reader_Test, ReadDouble)
+{
+  const char* aValues[] = {"0.1", "-12.5e-3", "3.14159265358979", "1e300", "1.0000000000000000001",
+                           "7", ".25", "-0", "2.5E+2"};
+  for (const char* aValue : aValues)
+  {
+    const char*  aPos = aValue;
+    const double aRes = RWObj_Tools::ReadDouble(aPos, aValue + strlen(aValue));
+    EXPECT_EQ(Strtod(aValue, nullptr), aRes) << aValue;
+    EXPECT_EQ(aValue + strlen(aValue), aPos) << aValue;
+  }
+
+  // text is not required to be NULL-terminated
+  const char* aText = "1.5 2.75";
+  const char* aPos  = aText;
+  EXPECT_EQ(1.5, RWObj_Tools::ReadDouble(aPos, aText + 5));
+  EXPECT_EQ(2.0, RWObj_Tools::ReadDouble(aPos, aText + 5));
+}
@@ -31,6 +31,12 @@ public:
   //! Setup single/double precision flag for reading vertex data (coordinates).
   void SetSinglePrecision(bool theIsSinglePrecision) { myIsSinglePrecision = theIsSinglePrecision; }
 
+  //! Return TRUE if multithreaded parsing is allowed; FALSE by default.
+  bool ToParallel() const { return myToParallel; }
+
+  //! Setup multithreaded parsing (the file is mapped into memory and parsed in chunks).
+  void SetParallel(bool theToParallel) { myToParallel = theToParallel; }
+
 protected:
   //! Read the mesh from specified file.
   Standard_EXPORT bool performMesh(std::istream&                  theStream,
@@ -58,6 +64,7 @@ protected:
   // clang-format off
   bool myIsSinglePrecision; //!< flag for reading vertex data with single or double floating point precision
   // clang-format on
+  bool myToParallel; //!< flag to use multithreading; FALSE by default
 };
 
 #endif // _RWObj_CafReader_HeaderFile
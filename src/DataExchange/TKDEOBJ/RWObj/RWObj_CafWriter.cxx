@@ -58,7 +58,8 @@ static TCollection_AsciiString readNameAttribute(const TDF_Label& theRefLabel)
 //=================================================================================================
 
 RWObj_CafWriter::RWObj_CafWriter(const TCollection_AsciiString& theFile)
-    : myFile(theFile)
+    : myFile(theFile),
+      myToParallel(false)
 {
   // OBJ file format doesn't define length units;
   // Y-up coordinate system is most commonly used (but also undefined)
@@ -269,10 +270,13 @@ bool RWObj_CafWriter::writeShape(RWObj_ObjWriterContext&        theWriter,
                                  const XCAFPrs_Style&           theParentStyle,
                                  const TCollection_AsciiString& theName)
 {
-  bool toCreateGroup = true;
-  for (RWMesh_FaceIterator aFaceIter(theLabel, theParentTrsf, true, theParentStyle);
-       aFaceIter.More() && !thePSentry.IsAborted();
-       aFaceIter.Next())
+  bool                toCreateGroup = true;
+  RWMesh_FaceIterator aFaceIter(theLabel, theParentTrsf, true, theParentStyle);
+  if (myToParallel)
+  {
+    aFaceIter.PrepareData(true);
+  }
+  for (; aFaceIter.More() && !thePSentry.IsAborted(); aFaceIter.Next())
   {
     if (toSkipFaceMesh(aFaceIter))
     {
@@ -63,6 +63,14 @@ public:
   //! Set default material definition to be used for nodes with only color defined.
   void SetDefaultStyle(const XCAFPrs_Style& theStyle) { myDefaultStyle = theStyle; }
 
+  //! Return TRUE if transformed nodes and normals of faces should be computed
+  //! in parallel threads before writing; FALSE by default.
+  bool ToParallel() const { return myToParallel; }
+
+  //! Set if transformed nodes and normals of faces should be computed
+  //! in parallel threads before writing.
+  void SetParallel(bool theToParallel) { myToParallel = theToParallel; }
+
   //! Write OBJ file and associated MTL material file.
   //! Triangulation data should be precomputed within shapes!
   //! @param[in] theDocument     input document
@@ -166,6 +174,7 @@ protected:
   // clang-format off
   RWMesh_CoordinateSystemConverter myCSTrsf;       //!< transformation from OCCT to OBJ coordinate system
   XCAFPrs_Style                    myDefaultStyle; //!< default material definition to be used for nodes with only color defined
+  bool                             myToParallel;   //!< flag to prepare face data in parallel threads
   // clang-format on
 };
 
@@ -23,13 +23,16 @@
 #include <Message_Messenger.hxx>
 #include <Message_ProgressScope.hxx>
 #include <NCollection_IncAllocator.hxx>
+#include <OSD_FileSystem.hxx>
 #include <OSD_OpenFile.hxx>
+#include <OSD_Parallel.hxx>
 #include <OSD_Path.hxx>
 #include <OSD_Timer.hxx>
 #include <Standard_CLocaleSentry.hxx>
 #include <Standard_ReadLineBuffer.hxx>
 
 #include <algorithm>
+#include <cstring>
 #include <limits>
 
 #if defined(_WIN32)
@@ -47,6 +50,244 @@ namespace
 // The length of buffer to read (in bytes)
 static const size_t THE_BUFFER_SIZE = 4 * 1024;
 
+// The minimal size of text chunk (in bytes) to be parsed by a dedicated thread
+static const size_t THE_MIN_CHUNK_SIZE = 1024 * 1024;
+
+//! Element parsed from "f" line.
+struct ObjChunkFace
+{
+  int First;   //!< index of the first element node within ObjChunk::Indices
+  int NbNodes; //!< number of element nodes
+  int Line;    //!< line number within the chunk
+  int NbVerts; //!< number of positions defined by the chunk before this element
+  int NbUVs;   //!< number of UV parameters defined by the chunk before this element
+  int NbNorms; //!< number of normals defined by the chunk before this element
+};
+
+//! Type of command changing the active sub-mesh or loading materials.
+enum ObjChunkCommandType
+{
+  ObjChunkCommandType_Object,      //!< "o ObjectName"
+  ObjChunkCommandType_Group,       //!< "g GroupName"
+  ObjChunkCommandType_SmoothGroup, //!< "s SmoothGroupIndex"
+  ObjChunkCommandType_Material,    //!< "usemtl MaterialName"
+  ObjChunkCommandType_MaterialLib  //!< "mtllib FileName"
+};
+
+//! Command parsed from the chunk.
+struct ObjChunkCommand
+{
+  ObjChunkCommandType     Type;    //!< command type
+  int                     Line;    //!< line number within the chunk
+  int                     NbFaces; //!< number of elements defined by the chunk before this command
+  TCollection_AsciiString Value;   //!< command argument
+};
+
+//! Part of OBJ file content parsed by a single thread.
+//! Nodal data is stored as is, while element indices are resolved afterwards
+//! within the calling thread, as they depend on the content of previous chunks.
+struct ObjChunk
+{
+  const char*                                 Begin;    //!< chunk start
+  const char*                                 End;      //!< chunk end
+  int                                         NbLines;  //!< number of lines in the chunk
+  NCollection_Vector<gp_XYZ>                  Verts;    //!< vertex positions
+  NCollection_Vector<NCollection_Vec2<float>> UVs;      //!< UV parameters
+  NCollection_Vector<NCollection_Vec3<float>> Norms;    //!< normals
+  NCollection_Vector<NCollection_Vec3<int>>   Indices;  //!< zero-based indices of element nodes
+  NCollection_Vector<ObjChunkFace>            Faces;    //!< elements
+  NCollection_Vector<ObjChunkCommand>         Commands; //!< sub-mesh commands
+
+  ObjChunk()
+      : Begin(nullptr),
+        End(nullptr),
+        NbLines(0),
+        Verts(4096),
+        UVs(4096),
+        Norms(4096),
+        Indices(4096),
+        Faces(4096)
+  {
+  }
+};
+
+//! Read the next line from the buffer, joining lines with continuation character ('\\' at the end).
+//! @param[in]  thePos     line start
+//! @param[in]  theEnd     data end
+//! @param[out] theLine    line start (within data or theBuffer), without line break
+//! @param[out] theLineEnd line end
+//! @param[in]  theBuffer  temporary buffer for joined lines
+//! @return start of the next line
+static const char* readObjLine(const char*        thePos,
+                               const char*        theEnd,
+                               const char*&       theLine,
+                               const char*&       theLineEnd,
+                               std::vector<char>& theBuffer)
+{
+  bool isMultiline = false;
+  for (;;)
+  {
+    const char* aLineBreak = (const char*)::memchr(thePos, '\n', size_t(theEnd - thePos));
+    const char* aLineEnd   = aLineBreak != nullptr ? aLineBreak : theEnd;
+    const char* aNext      = aLineBreak != nullptr ? aLineBreak + 1 : theEnd;
+    const char* aCont      = aLineEnd;
+    if (aCont > thePos && aCont[-1] == '\r')
+    {
+      --aCont;
+    }
+    if (aLineBreak != nullptr && aCont > thePos && aCont[-1] == '\\' && aNext < theEnd)
+    {
+      // multi-line syntax
+      if (!isMultiline)
+      {
+        theBuffer.clear();
+        isMultiline = true;
+      }
+      theBuffer.insert(theBuffer.end(), thePos, aCont - 1);
+      theBuffer.push_back(' ');
+      thePos = aNext;
+      continue;
+    }
+
+    if (!isMultiline)
+    {
+      theLine    = thePos;
+      theLineEnd = aLineEnd;
+      return aNext;
+    }
+    theBuffer.insert(theBuffer.end(), thePos, aLineEnd);
+    theLine    = theBuffer.data();
+    theLineEnd = theBuffer.data() + theBuffer.size();
+    return aNext;
+  }
+}
+
+//! Parse the chunk of OBJ file content.
+static void parseObjChunk(ObjChunk& theChunk, const RWMesh_CoordinateSystemConverter& theCSTrsf)
+{
+  std::vector<char> aLineBuffer;
+  const char*       aLine    = nullptr;
+  const char*       aLineEnd = nullptr;
+  for (const char* aPos = theChunk.Begin; aPos < theChunk.End;)
+  {
+    aPos = readObjLine(aPos, theChunk.End, aLine, aLineEnd, aLineBuffer);
+    ++theChunk.NbLines;
+    const size_t aLen = size_t(aLineEnd - aLine);
+    if (aLen == 0 || *aLine == '#')
+    {
+      continue;
+    }
+
+    // the line break is considered as a part of the line for checking command syntax
+    const char aChar1 = aLen > 1 ? aLine[1] : '\n';
+    const char aChar2 = aLen > 2 ? aLine[2] : '\n';
+    if (aLine[0] == 'v' && RWObj_Tools::isSpaceChar(aChar1))
+    {
+      const char* aValPos = aLine + 2;
+      gp_XYZ      anXYZ;
+      anXYZ.SetX(RWObj_Tools::ReadDouble(aValPos, aLineEnd));
+      anXYZ.SetY(RWObj_Tools::ReadDouble(aValPos, aLineEnd));
+      anXYZ.SetZ(RWObj_Tools::ReadDouble(aValPos, aLineEnd));
+      theCSTrsf.TransformPosition(anXYZ);
+      theChunk.Verts.Append(anXYZ);
+    }
+    else if (aLine[0] == 'v' && aChar1 == 'n' && RWObj_Tools::isSpaceChar(aChar2))
+    {
+      const char*             aValPos = aLine + 3;
+      NCollection_Vec3<float> aNorm;
+      aNorm.x() = (float)RWObj_Tools::ReadDouble(aValPos, aLineEnd);
+      aNorm.y() = (float)RWObj_Tools::ReadDouble(aValPos, aLineEnd);
+      aNorm.z() = (float)RWObj_Tools::ReadDouble(aValPos, aLineEnd);
+      theCSTrsf.TransformNormal(aNorm);
+      theChunk.Norms.Append(aNorm);
+    }
+    else if (aLine[0] == 'v' && aChar1 == 't' && RWObj_Tools::isSpaceChar(aChar2))
+    {
+      const char*             aValPos = aLine + 3;
+      NCollection_Vec2<float> anUV;
+      anUV.x() = (float)RWObj_Tools::ReadDouble(aValPos, aLineEnd);
+      anUV.y() = (float)RWObj_Tools::ReadDouble(aValPos, aLineEnd);
+      theChunk.UVs.Append(anUV);
+    }
+    else if (aLine[0] == 'f' && RWObj_Tools::isSpaceChar(aChar1))
+    {
+      ObjChunkFace aFace;
+      aFace.First   = theChunk.Indices.Length();
+      aFace.NbNodes = 0;
+      aFace.Line    = theChunk.NbLines;
+      aFace.NbVerts = theChunk.Verts.Length();
+      aFace.NbUVs   = theChunk.UVs.Length();
+      aFace.NbNorms = theChunk.Norms.Length();
+
+      const char* anIndPos = aLine + 2;
+      int64_t     aValue   = 0;
+      while (RWObj_Tools::ReadInt(anIndPos, aLineEnd, aValue))
+      {
+        NCollection_Vec3<int> a3Indices(int(aValue - 1), -1, -1);
+        if (anIndPos < aLineEnd && *anIndPos == '/')
+        {
+          // parse UV index
+          ++anIndPos;
+          if (anIndPos < aLineEnd && *anIndPos != '/'
+              && RWObj_Tools::ReadInt(anIndPos, aLineEnd, aValue))
+          {
+            a3Indices[1] = int(aValue - 1);
+          }
+
+          // parse Normal index
+          if (anIndPos < aLineEnd && *anIndPos == '/')
+          {
+            ++anIndPos;
+            if (anIndPos < aLineEnd && !IsSpace(*anIndPos)
+                && RWObj_Tools::ReadInt(anIndPos, aLineEnd, aValue))
+            {
+              a3Indices[2] = int(aValue - 1);
+            }
+          }
+        }
+        theChunk.Indices.Append(a3Indices);
+        ++aFace.NbNodes;
+        if (anIndPos >= aLineEnd)
+        {
+          break;
+        }
+        if (*anIndPos != ' ')
+        {
+          ++anIndPos;
+        }
+      }
+      theChunk.Faces.Append(aFace);
+    }
+    else
+    {
+      ObjChunkCommand aCmd;
+      aCmd.Line               = theChunk.NbLines;
+      aCmd.NbFaces            = theChunk.Faces.Length();
+      const char* aValueStart = nullptr;
+      if ((aLine[0] == 'g' || aLine[0] == 's' || aLine[0] == 'o') && IsSpace(aChar1))
+      {
+        aCmd.Type   = aLine[0] == 'g'   ? ObjChunkCommandType_Group
+                      : aLine[0] == 's' ? ObjChunkCommandType_SmoothGroup
+                                        : ObjChunkCommandType_Object;
+        aValueStart = aLine + std::min(aLen, size_t(2));
+      }
+      else if (aLen >= 6
+               && (::strncmp(aLine, "mtllib", 6) == 0 || ::strncmp(aLine, "usemtl", 6) == 0))
+      {
+        aCmd.Type   = aLine[0] == 'm' ? ObjChunkCommandType_MaterialLib
+                                      : ObjChunkCommandType_Material;
+        aValueStart = aLen > 6 && IsSpace(aLine[6]) ? aLine + std::min(aLen, size_t(7)) : aLineEnd;
+      }
+      else
+      {
+        continue;
+      }
+      aCmd.Value = TCollection_AsciiString(aValueStart, int(aLineEnd - aValueStart));
+      theChunk.Commands.Append(aCmd);
+    }
+  }
+}
+
 //! Return TRUE if given polygon has clockwise node order.
 static bool isClockwisePolygon(const occ::handle<BRepMesh_DataStructureOfDelaun>& theMesh,
                                const IMeshData::VectorOfInteger&                  theIndexes)
@@ -73,37 +314,40 @@ RWObj_Reader::RWObj_Reader()
       myNbProbeNodes(0),
       myNbProbeElems(0),
       myNbElemsBig(0),
-      myToAbort(false)
+      myToAbort(false),
+      myToParallel(false)
 {
   //
 }
 
 //=================================================================================================
 
+bool RWObj_Reader::Read(const TCollection_AsciiString& theFile,
+                        const Message_ProgressRange&   theProgress)
+{
+  if (myToParallel)
+  {
+    // the whole file is needed in memory to parse it in parallel chunks
+    if (occ::handle<NCollection_Buffer> aMapped =
+          OSD_FileSystem::DefaultFileSystem()->OpenMappedBuffer(theFile))
+    {
+      return ReadBuffer((const char*)aMapped->Data(), aMapped->Size(), theFile, theProgress);
+    }
+  }
+
+  std::ifstream aStream;
+  OSD_OpenStream(aStream, theFile, std::ios_base::in | std::ios_base::binary);
+  return Read(aStream, theFile, theProgress);
+}
+
+//=================================================================================================
+
 bool RWObj_Reader::read(std::istream&                  theStream,
                         const TCollection_AsciiString& theFile,
                         const Message_ProgressRange&   theProgress,
                         const bool                     theToProbe)
 {
-  myMemEstim     = 0;
-  myNbLines      = 0;
-  myNbProbeNodes = 0;
-  myNbProbeElems = 0;
-  myNbElemsBig   = 0;
-  myToAbort      = false;
-  myObjVerts.Reset();
-  myObjVertsUV.Clear();
-  myObjNorms.Clear();
-  myPackedIndices.Clear();
-  myMaterials.Clear();
-  myFileComments.Clear();
-  myExternalFiles.Clear();
-  myActiveSubMesh = RWObj_SubMesh();
-
-  // determine file location to load associated files
-  TCollection_AsciiString aFileName;
-  OSD_Path::FolderAndFileFromPath(theFile, myFolder, aFileName);
-  myCurrElem.resize(1024, -1);
+  initReading(theFile);
 
   Standard_CLocaleSentry aLocaleSentry;
   if (!theStream.good())
@@ -246,6 +490,242 @@ bool RWObj_Reader::read(std::istream&                  theStream,
     }
   }
 
+  finishReading(theToProbe);
+  return true;
+}
+
+//=================================================================================================
+
+bool RWObj_Reader::ReadBuffer(const char*                    theData,
+                              const size_t                   theSize,
+                              const TCollection_AsciiString& theFile,
+                              const Message_ProgressRange&   theProgress)
+{
+  initReading(theFile);
+  if (theSize == 0)
+  {
+    Message::SendFail(TCollection_AsciiString("Error: file '") + theFile + "' is empty");
+    return false;
+  }
+
+  // collect header comments
+  const char*       aDataEnd = theData + theSize;
+  std::vector<char> aLineBuffer;
+  for (const char* aPos = theData; aPos < aDataEnd;)
+  {
+    const char* aLine    = nullptr;
+    const char* aLineEnd = nullptr;
+    aPos                 = readObjLine(aPos, aDataEnd, aLine, aLineEnd, aLineBuffer);
+    if (aLine == aLineEnd)
+    {
+      continue;
+    }
+    else if (*aLine != '#')
+    {
+      break;
+    }
+
+    TCollection_AsciiString aComment(aLine + 1, int(aLineEnd - aLine - 1));
+    aComment.LeftAdjust();
+    aComment.RightAdjust();
+    if (!aComment.IsEmpty())
+    {
+      if (!myFileComments.IsEmpty())
+      {
+        myFileComments += "\n";
+      }
+      myFileComments += aComment;
+    }
+  }
+
+  // split data into chunks at line boundaries
+  const int aNbChunks = myToParallel ? std::max(1,
+                                                std::min(OSD_Parallel::NbLogicalProcessors() * 4,
+                                                         int(theSize / THE_MIN_CHUNK_SIZE)))
+                                     : 1;
+  NCollection_Array1<ObjChunk> aChunks(0, aNbChunks - 1);
+  const char*                  aChunkStart = theData;
+  for (int aChunkIter = 0; aChunkIter < aNbChunks; ++aChunkIter)
+  {
+    ObjChunk& aChunk = aChunks.ChangeValue(aChunkIter);
+    aChunk.Begin     = aChunkStart;
+    aChunk.End       = aDataEnd;
+    if (aChunkIter + 1 < aNbChunks && aChunkStart < aDataEnd)
+    {
+      const char* aLine    = nullptr;
+      const char* aLineEnd = nullptr;
+      aChunk.End           = readObjLine(
+        std::max(aChunkStart, theData + int64_t(theSize) * (aChunkIter + 1) / aNbChunks),
+        aDataEnd,
+        aLine,
+        aLineEnd,
+        aLineBuffer);
+    }
+    aChunkStart = aChunk.End;
+  }
+
+  Message_ProgressScope aPS(theProgress, "Reading text OBJ file", 2);
+  {
+    Message_ProgressScope                     aChunksScope(aPS.Next(), nullptr, aNbChunks);
+    NCollection_Array1<Message_ProgressRange> aRanges(0, aNbChunks - 1);
+    for (int aChunkIter = 0; aChunkIter < aNbChunks; ++aChunkIter)
+    {
+      aRanges.SetValue(aChunkIter, aChunksScope.Next());
+    }
+    OSD_Parallel::For(
+      0,
+      aNbChunks,
+      [&](int theChunkIndex) {
+        Message_ProgressScope aChunkScope(aRanges.Value(theChunkIndex), nullptr, 1);
+        parseObjChunk(aChunks.ChangeValue(theChunkIndex), myCSTrsf);
+        aChunkScope.Next();
+      },
+      !myToParallel);
+  }
+  if (!aPS.More())
+  {
+    return false;
+  }
+
+  // pass parsed data to the interface methods in the file order
+  Message_ProgressScope aChunksScope(aPS.Next(), nullptr, aNbChunks);
+  int                   aLineBase = 0;
+  for (int aChunkIter = 0; aChunkIter < aNbChunks; ++aChunkIter, aChunksScope.Next())
+  {
+    if (!aChunksScope.More())
+    {
+      return false;
+    }
+
+    ObjChunk& aChunk   = aChunks.ChangeValue(aChunkIter);
+    int       aNbVerts = 0, aNbUVs = 0, aNbNorms = 0;
+    // append chunk nodal data up to specified number of elements
+    auto anAppendNodes = [&](const int theNbVerts, const int theNbUVs, const int theNbNorms) {
+      for (; aNbVerts < theNbVerts; ++aNbVerts, ++myNbProbeNodes)
+      {
+        myMemEstim +=
+          myObjVerts.IsSinglePrecision() ? sizeof(NCollection_Vec3<float>) : sizeof(gp_Pnt);
+        myObjVerts.Append(aChunk.Verts.Value(aNbVerts));
+      }
+      for (; aNbUVs < theNbUVs; ++aNbUVs)
+      {
+        myMemEstim += sizeof(NCollection_Vec2<float>);
+        myObjVertsUV.Append(aChunk.UVs.Value(aNbUVs));
+      }
+      for (; aNbNorms < theNbNorms; ++aNbNorms)
+      {
+        myMemEstim += sizeof(NCollection_Vec3<float>);
+        myObjNorms.Append(aChunk.Norms.Value(aNbNorms));
+      }
+    };
+
+    int aCmdIter = 0;
+    for (int aFaceIter = 0;; ++aFaceIter)
+    {
+      for (; aCmdIter < aChunk.Commands.Length()
+             && aChunk.Commands.Value(aCmdIter).NbFaces == aFaceIter;
+           ++aCmdIter)
+      {
+        const ObjChunkCommand& aCmd = aChunk.Commands.Value(aCmdIter);
+        myNbLines                   = aLineBase + aCmd.Line;
+        switch (aCmd.Type)
+        {
+          case ObjChunkCommandType_Object:
+            pushObject(aCmd.Value.ToCString());
+            break;
+          case ObjChunkCommandType_Group:
+            pushGroup(aCmd.Value.ToCString());
+            break;
+          case ObjChunkCommandType_SmoothGroup:
+            pushSmoothGroup(aCmd.Value.ToCString());
+            break;
+          case ObjChunkCommandType_Material:
+            pushMaterial(aCmd.Value.ToCString());
+            break;
+          case ObjChunkCommandType_MaterialLib:
+            readMaterialLib(aCmd.Value.ToCString());
+            break;
+        }
+      }
+      if (aFaceIter >= aChunk.Faces.Length())
+      {
+        break;
+      }
+
+      const ObjChunkFace& aFace = aChunk.Faces.Value(aFaceIter);
+      anAppendNodes(aFace.NbVerts, aFace.NbUVs, aFace.NbNorms);
+      myNbLines = aLineBase + aFace.Line;
+      ++myNbProbeElems;
+
+      int aNbElemNodes = 0;
+      for (; aNbElemNodes < aFace.NbNodes; ++aNbElemNodes)
+      {
+        const int anIndex = pushElementNode(aChunk.Indices.Value(aFace.First + aNbElemNodes));
+        if (anIndex < 0)
+        {
+          break;
+        }
+        if (myCurrElem.size() <= size_t(aNbElemNodes))
+        {
+          myCurrElem.resize(aNbElemNodes * 2, -1);
+        }
+        myCurrElem[aNbElemNodes] = anIndex;
+      }
+      if (aNbElemNodes == aFace.NbNodes)
+      {
+        pushElement(aNbElemNodes);
+      }
+
+      if (!checkMemory())
+      {
+        addMesh(myActiveSubMesh, RWObj_SubMeshReason_NewObject);
+        return false;
+      }
+    }
+
+    anAppendNodes(aChunk.Verts.Length(), aChunk.UVs.Length(), aChunk.Norms.Length());
+    if (!checkMemory())
+    {
+      addMesh(myActiveSubMesh, RWObj_SubMeshReason_NewObject);
+      return false;
+    }
+    aLineBase += aChunk.NbLines;
+    aChunk = ObjChunk(); // release memory
+  }
+
+  finishReading(false);
+  return true;
+}
+
+//=================================================================================================
+
+void RWObj_Reader::initReading(const TCollection_AsciiString& theFile)
+{
+  myMemEstim     = 0;
+  myNbLines      = 0;
+  myNbProbeNodes = 0;
+  myNbProbeElems = 0;
+  myNbElemsBig   = 0;
+  myToAbort      = false;
+  myObjVerts.Reset();
+  myObjVertsUV.Clear();
+  myObjNorms.Clear();
+  myPackedIndices.Clear();
+  myMaterials.Clear();
+  myFileComments.Clear();
+  myExternalFiles.Clear();
+  myActiveSubMesh = RWObj_SubMesh();
+
+  // determine file location to load associated files
+  TCollection_AsciiString aFileName;
+  OSD_Path::FolderAndFileFromPath(theFile, myFolder, aFileName);
+  myCurrElem.resize(1024, -1);
+}
+
+//=================================================================================================
+
+void RWObj_Reader::finishReading(const bool theToProbe)
+{
   // collect external references
   for (NCollection_DataMap<TCollection_AsciiString, RWObj_Material>::Iterator aMatIter(myMaterials);
        aMatIter.More();
@@ -276,8 +756,6 @@ bool RWObj_Reader::read(std::istream&                  theStream,
     Message::SendWarning(TCollection_AsciiString("Warning: OBJ reader, ") + myNbElemsBig
                          + " polygon(s) have been split into triangles");
   }
-
-  return true;
 }
 
 //=================================================================================================
@@ -319,121 +797,140 @@ void RWObj_Reader::pushIndices(const char* thePos)
       }
     }
 
-    // handle negative indices
-    if (a3Indices[0] < -1)
+    const int anIndex = pushElementNode(a3Indices);
+    if (anIndex < 0)
+    {
+      return;
+    }
+
+    if (myCurrElem.size() <= size_t(aNode))
     {
-      a3Indices[0] += myObjVerts.Upper() + 2;
+      myCurrElem.resize(aNode * 2, -1);
     }
-    if (a3Indices[1] < -1)
+    myCurrElem[aNode] = anIndex;
+    aNbElemNodes      = aNode + 1;
+
+    if (*thePos == '\n' || *thePos == '\0')
     {
-      a3Indices[1] += myObjVertsUV.Upper() + 2;
+      break;
     }
-    if (a3Indices[2] < -1)
+
+    if (*thePos != ' ')
     {
-      a3Indices[2] += myObjNorms.Upper() + 2;
+      ++thePos;
     }
+  }
+
+  pushElement(aNbElemNodes);
+}
+
+//=================================================================================================
 
-    int anIndex = -1;
-    if (!myPackedIndices.Find(a3Indices, anIndex))
+int RWObj_Reader::pushElementNode(NCollection_Vec3<int> theIndices)
+{
+  // handle negative indices
+  if (theIndices[0] < -1)
+  {
+    theIndices[0] += myObjVerts.Upper() + 2;
+  }
+  if (theIndices[1] < -1)
+  {
+    theIndices[1] += myObjVertsUV.Upper() + 2;
+  }
+  if (theIndices[2] < -1)
+  {
+    theIndices[2] += myObjNorms.Upper() + 2;
+  }
+
+  int anIndex = -1;
+  if (!myPackedIndices.Find(theIndices, anIndex))
+  {
+    if (theIndices[0] >= 0)
+    {
+      myMemEstim += sizeof(NCollection_Vec3<float>);
+    }
+    if (theIndices[1] >= 0)
+    {
+      myMemEstim += sizeof(NCollection_Vec2<float>);
+    }
+    if (theIndices[2] >= 0)
     {
-      if (a3Indices[0] >= 0)
+      myMemEstim += sizeof(NCollection_Vec3<float>);
+    }
+    myMemEstim += sizeof(NCollection_Vec4<int>) + sizeof(int); // naive map
+    if (theIndices[0] < myObjVerts.Lower() || theIndices[0] > myObjVerts.Upper())
+    {
+      myToAbort = true;
+      Message::SendFail(TCollection_AsciiString("Error: invalid OBJ syntax at line ") + myNbLines
+                        + ": vertex index is out of range");
+      return -1;
+    }
+
+    anIndex = addNode(myObjVerts.Value(theIndices[0]));
+    myPackedIndices.Bind(theIndices, anIndex);
+    if (theIndices[1] >= 0)
+    {
+      if (myObjVertsUV.IsEmpty())
       {
-        myMemEstim += sizeof(NCollection_Vec3<float>);
+        Message::SendWarning(TCollection_AsciiString("Warning: invalid OBJ syntax at line ")
+                             + myNbLines + ": UV index is specified but no UV nodes are defined");
       }
-      if (a3Indices[1] >= 0)
+      else if (theIndices[1] < myObjVertsUV.Lower() || theIndices[1] > myObjVertsUV.Upper())
       {
-        myMemEstim += sizeof(NCollection_Vec2<float>);
+        Message::SendWarning(TCollection_AsciiString("Warning: invalid OBJ syntax at line ")
+                             + myNbLines + ": UV index is out of range");
+        setNodeUV(anIndex, NCollection_Vec2<float>(0.0f, 0.0f));
       }
-      if (a3Indices[2] >= 0)
+      else
       {
-        myMemEstim += sizeof(NCollection_Vec3<float>);
+        setNodeUV(anIndex, myObjVertsUV.Value(theIndices[1]));
       }
-      myMemEstim += sizeof(NCollection_Vec4<int>) + sizeof(int); // naive map
-      if (a3Indices[0] < myObjVerts.Lower() || a3Indices[0] > myObjVerts.Upper())
+    }
+    if (theIndices[2] >= 0)
+    {
+      if (myObjNorms.IsEmpty())
       {
-        myToAbort = true;
-        Message::SendFail(TCollection_AsciiString("Error: invalid OBJ syntax at line ") + myNbLines
-                          + ": vertex index is out of range");
-        return;
+        Message::SendWarning(TCollection_AsciiString("Warning: invalid OBJ syntax at line ")
+                             + myNbLines
+                             + ": Normal index is specified but no Normals nodes are defined");
       }
-
-      anIndex = addNode(myObjVerts.Value(a3Indices[0]));
-      myPackedIndices.Bind(a3Indices, anIndex);
-      if (a3Indices[1] >= 0)
+      else if (theIndices[2] < myObjNorms.Lower() || theIndices[2] > myObjNorms.Upper())
       {
-        if (myObjVertsUV.IsEmpty())
-        {
-          Message::SendWarning(TCollection_AsciiString("Warning: invalid OBJ syntax at line ")
-                               + myNbLines + ": UV index is specified but no UV nodes are defined");
-        }
-        else if (a3Indices[1] < myObjVertsUV.Lower() || a3Indices[1] > myObjVertsUV.Upper())
-        {
-          Message::SendWarning(TCollection_AsciiString("Warning: invalid OBJ syntax at line ")
-                               + myNbLines + ": UV index is out of range");
-          setNodeUV(anIndex, NCollection_Vec2<float>(0.0f, 0.0f));
-        }
-        else
-        {
-          setNodeUV(anIndex, myObjVertsUV.Value(a3Indices[1]));
-        }
+        Message::SendWarning(TCollection_AsciiString("Warning: invalid OBJ syntax at line ")
+                             + myNbLines + ": Normal index is out of range");
+        setNodeNormal(anIndex, NCollection_Vec3<float>(0.0f, 0.0f, 1.0f));
       }
-      if (a3Indices[2] >= 0)
+      else
       {
-        if (myObjNorms.IsEmpty())
-        {
-          Message::SendWarning(TCollection_AsciiString("Warning: invalid OBJ syntax at line ")
-                               + myNbLines
-                               + ": Normal index is specified but no Normals nodes are defined");
-        }
-        else if (a3Indices[2] < myObjNorms.Lower() || a3Indices[2] > myObjNorms.Upper())
-        {
-          Message::SendWarning(TCollection_AsciiString("Warning: invalid OBJ syntax at line ")
-                               + myNbLines + ": Normal index is out of range");
-          setNodeNormal(anIndex, NCollection_Vec3<float>(0.0f, 0.0f, 1.0f));
-        }
-        else
-        {
-          setNodeNormal(anIndex, myObjNorms.Value(a3Indices[2]));
-        }
+        setNodeNormal(anIndex, myObjNorms.Value(theIndices[2]));
       }
     }
-
-    if (myCurrElem.size() < size_t(aNode))
-    {
-      myCurrElem.resize(aNode * 2, -1);
-    }
-    myCurrElem[aNode] = anIndex;
-    aNbElemNodes      = aNode + 1;
-
-    if (*thePos == '\n' || *thePos == '\0')
-    {
-      break;
-    }
-
-    if (*thePos != ' ')
-    {
-      ++thePos;
-    }
   }
+  return anIndex;
+}
+
+//=================================================================================================
 
-  if (myCurrElem[0] < 0 || myCurrElem[1] < 0 || myCurrElem[2] < 0 || aNbElemNodes < 3)
+void RWObj_Reader::pushElement(const int theNbElemNodes)
+{
+  if (myCurrElem[0] < 0 || myCurrElem[1] < 0 || myCurrElem[2] < 0 || theNbElemNodes < 3)
   {
     return;
   }
 
-  if (aNbElemNodes == 3)
+  if (theNbElemNodes == 3)
   {
     myMemEstim += sizeof(NCollection_Vec4<int>);
     addElement(myCurrElem[0], myCurrElem[1], myCurrElem[2], -1);
   }
-  else if (aNbElemNodes == 4)
+  else if (theNbElemNodes == 4)
   {
     myMemEstim += sizeof(NCollection_Vec4<int>);
     addElement(myCurrElem[0], myCurrElem[1], myCurrElem[2], myCurrElem[3]);
   }
   else
   {
-    const NCollection_Array1<int> aCurrElemArray1(myCurrElem[0], 1, aNbElemNodes);
+    const NCollection_Array1<int> aCurrElemArray1(myCurrElem[0], 1, theNbElemNodes);
     const int                     aNbAdded = triangulatePolygon(aCurrElemArray1);
     if (aNbAdded < 1)
     {
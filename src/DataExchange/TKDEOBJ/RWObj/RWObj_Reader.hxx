@@ -40,6 +40,9 @@
 //! To use it, create descendant class and implement interface methods.
 //!
 //! Call method Read() to read the file.
+//! When ToParallel() is set, the file is mapped into memory and parsed by ReadBuffer()
+//! in several threads; the interface methods are still called from the calling thread
+//! in the same order as for sequential reading.
 class RWObj_Reader : public Standard_Transient
 {
   DEFINE_STANDARD_RTTIEXT(RWObj_Reader, Standard_Transient)
@@ -48,13 +51,10 @@ public:
   Standard_EXPORT RWObj_Reader();
 
   //! Open stream and pass it to Read method
+  //! (or map the file into memory and pass it to ReadBuffer() when ToParallel() is set).
   //! Returns true if success, false on error.
-  bool Read(const TCollection_AsciiString& theFile, const Message_ProgressRange& theProgress)
-  {
-    std::ifstream aStream;
-    OSD_OpenStream(aStream, theFile, std::ios_base::in | std::ios_base::binary);
-    return Read(aStream, theFile, theProgress);
-  }
+  Standard_EXPORT bool Read(const TCollection_AsciiString& theFile,
+                            const Message_ProgressRange&   theProgress);
 
   //! Reads data from OBJ file.
   //! Unicode paths can be given in UTF-8 encoding.
@@ -66,6 +66,19 @@ public:
     return read(theStream, theFile, theProgress, false);
   }
 
+  //! Reads data from OBJ file content in memory.
+  //! The text is split into chunks at line boundaries and parsed in parallel threads
+  //! when ToParallel() is set.
+  //! @param theData     file content (not required to be NULL-terminated)
+  //! @param theSize     size of the content in bytes
+  //! @param theFile     path to the file for resolving associated files (materials)
+  //! @param theProgress progress indicator
+  //! @return TRUE if success, FALSE on error or user break.
+  Standard_EXPORT bool ReadBuffer(const char*                    theData,
+                                  const size_t                   theSize,
+                                  const TCollection_AsciiString& theFile,
+                                  const Message_ProgressRange&   theProgress);
+
   //! Open stream and pass it to Probe method.
   //! @param theFile     path to the file
   //! @param theProgress progress indicator
@@ -135,6 +148,12 @@ public:
     myObjVerts.SetSinglePrecision(theIsSinglePrecision);
   }
 
+  //! Return flag to parse file content in parallel threads; FALSE by default.
+  bool ToParallel() const { return myToParallel; }
+
+  //! Set flag to parse file content in parallel threads.
+  void SetParallel(bool theToParallel) { myToParallel = theToParallel; }
+
 protected:
   //! Reads data from OBJ file.
   //! Unicode paths can be given in UTF-8 encoding.
@@ -224,6 +243,20 @@ private:
   //! Handle "f indices".
   void pushIndices(const char* thePos);
 
+  //! Find or add the node for specified position/UV/normal indices of the element.
+  //! @param theIndices zero-based indices as written in the file (-1 if undefined)
+  //! @return node index, or -1 on syntax error (reading will be aborted)
+  int pushElementNode(NCollection_Vec3<int> theIndices);
+
+  //! Add element defined by the first nodes in myCurrElem.
+  void pushElement(const int theNbElemNodes);
+
+  //! Reset the reader state before reading new file.
+  void initReading(const TCollection_AsciiString& theFile);
+
+  //! Finalize reading - collect external references and flush the last group.
+  void finishReading(const bool theToProbe);
+
   //! Compute the center of planar polygon.
   //! @param theIndices polygon indices
   //! @return center of polygon
@@ -368,6 +401,7 @@ protected:
   int                   myNbProbeElems;  //!< number of probed elements
   int                   myNbElemsBig;    //!< number of big elements (polygons with 5+ nodes)
   bool                   myToAbort;       //!< flag indicating abort state (e.g. syntax error)
+  bool                   myToParallel;    //!< flag to parse file content in parallel threads
                                                     // clang-format on
 
   // Each node in the Element specifies independent indices of Vertex position, Texture coordinates
@@ -20,6 +20,8 @@
 #include <Standard_TypeDef.hxx>
 #include <TCollection_AsciiString.hxx>
 
+#include <cstdint>
+
 //! Auxiliary tools for OBJ format parser.
 namespace RWObj_Tools
 {
@@ -81,6 +83,127 @@ inline bool isSpaceChar(const char theChar)
   return theChar == ' ' || theChar == '\t';
   // return IsSpace (theChar);
 }
+
+//! Skip white spaces within [thePos, theEnd) range.
+inline void SkipSpaces(const char*& thePos, const char* theEnd)
+{
+  for (; thePos < theEnd && (isSpaceChar(*thePos) || *thePos == '\r'); ++thePos)
+  {
+  }
+}
+
+//! Read integer value within [thePos, theEnd) range (text is not required to be NULL-terminated).
+//! @param[in][out] thePos   text position, moved after the parsed value on success
+//! @param[in]      theEnd   end of the text
+//! @param[out]     theValue parsed value
+//! @return FALSE if text does not start with a number (thePos is left unchanged)
+inline bool ReadInt(const char*& thePos, const char* theEnd, int64_t& theValue)
+{
+  const char* aPos = thePos;
+  SkipSpaces(aPos, theEnd);
+  const bool isNegative = aPos < theEnd && *aPos == '-';
+  if (aPos < theEnd && (*aPos == '-' || *aPos == '+'))
+  {
+    ++aPos;
+  }
+  if (aPos >= theEnd || *aPos < '0' || *aPos > '9')
+  {
+    return false;
+  }
+
+  int64_t aValue = 0;
+  for (; aPos < theEnd && *aPos >= '0' && *aPos <= '9'; ++aPos)
+  {
+    aValue = aValue * 10 + (*aPos - '0');
+  }
+  theValue = isNegative ? -aValue : aValue;
+  thePos   = aPos;
+  return true;
+}
+
+//! Read floating point value within [thePos, theEnd) range
+//! (text is not required to be NULL-terminated).
+//! Decimal numbers with up to 15 significant digits and moderate exponent are converted
+//! directly, which gives exactly the same (correctly rounded) result as Strtod();
+//! other numbers (long mantissa, big exponent, inf/nan) are passed to Strtod().
+//! @param[in][out] thePos text position, moved after the parsed value
+//! @param[in]      theEnd end of the text
+//! @return parsed value or 0.0 if text does not start with a number (thePos is left unchanged)
+inline double ReadDouble(const char*& thePos, const char* theEnd)
+{
+  static const double THE_POW10[] = {1.0e0,  1.0e1,  1.0e2,  1.0e3,  1.0e4,  1.0e5,
+                                     1.0e6,  1.0e7,  1.0e8,  1.0e9,  1.0e10, 1.0e11,
+                                     1.0e12, 1.0e13, 1.0e14, 1.0e15, 1.0e16, 1.0e17,
+                                     1.0e18, 1.0e19, 1.0e20, 1.0e21, 1.0e22};
+  const char* aStart = thePos;
+  SkipSpaces(aStart, theEnd);
+  const char* aPos       = aStart;
+  const bool  isNegative = aPos < theEnd && *aPos == '-';
+  if (aPos < theEnd && (*aPos == '-' || *aPos == '+'))
+  {
+    ++aPos;
+  }
+
+  uint64_t aMantissa = 0;
+  int      aNbDigits = 0, aNbSignDigits = 0, anExp = 0;
+  for (; aPos < theEnd && *aPos >= '0' && *aPos <= '9'; ++aPos, ++aNbDigits)
+  {
+    if (aMantissa != 0 || *aPos != '0')
+    {
+      aMantissa = aMantissa * 10 + uint64_t(*aPos - '0');
+      ++aNbSignDigits;
+    }
+  }
+  if (aPos < theEnd && *aPos == '.')
+  {
+    for (++aPos; aPos < theEnd && *aPos >= '0' && *aPos <= '9'; ++aPos, ++aNbDigits)
+    {
+      if (aMantissa != 0 || *aPos != '0')
+      {
+        aMantissa = aMantissa * 10 + uint64_t(*aPos - '0');
+        ++aNbSignDigits;
+      }
+      --anExp;
+    }
+  }
+  if (aNbDigits != 0 && aPos < theEnd && (*aPos == 'e' || *aPos == 'E'))
+  {
+    const char* anExpPos   = aPos + 1;
+    int64_t     anExpValue = 0;
+    if (anExpPos < theEnd && (*anExpPos == '-' || *anExpPos == '+' || IsDigit(*anExpPos))
+        && ReadInt(anExpPos, theEnd, anExpValue) && anExpValue > -1000 && anExpValue < 1000)
+    {
+      anExp += int(anExpValue);
+      aPos = anExpPos;
+    }
+    else
+    {
+      aNbSignDigits = 100; // let Strtod() handle the exponent
+    }
+  }
+
+  if (aNbDigits != 0 && aNbSignDigits <= 15 && (aPos >= theEnd || *aPos != 'x')
+      && (aMantissa == 0 || (anExp >= -22 && anExp <= 22)))
+  {
+    thePos               = aPos;
+    const double aResult = anExp < 0 ? double(aMantissa) / THE_POW10[-anExp]
+                                     : double(aMantissa) * THE_POW10[anExp];
+    return isNegative ? -aResult : aResult;
+  }
+
+  // general case - copy the number into NULL-terminated string
+  const char* aTokenEnd = aStart;
+  for (; aTokenEnd < theEnd && !isSpaceChar(*aTokenEnd) && *aTokenEnd != '\r'
+         && *aTokenEnd != '\n' && *aTokenEnd != '/';
+       ++aTokenEnd)
+  {
+  }
+  const TCollection_AsciiString aToken(aStart, int(aTokenEnd - aStart));
+  char*                         aNext  = nullptr;
+  const double                  aValue = Strtod(aToken.ToCString(), &aNext);
+  thePos = aNext != aToken.ToCString() ? aStart + (aNext - aToken.ToCString()) : thePos;
+  return aValue;
+}
 } // namespace RWObj_Tools
 
 #endif // _RWObj_Tools_HeaderFile
@@ -0,0 +1,193 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <OSD_File.hxx>
+#include <OSD_Path.hxx>
+#include <RWPly_PlyReader.hxx>
+#include <RWPly_PlyWriterContext.hxx>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+//! Writes binary PLY file with a regular grid of (theNbCells + 1)^2 nodes.
+//! @param[in] theFile    file to write
+//! @param[in] theNbCells number of grid cells along each direction
+//! @param[in] theToQuads write quads instead of triangles
+//! @param[in] theToFaces write faces, otherwise the point cloud
+void writeGrid(const char* theFile,
+               const int   theNbCells,
+               const bool  theToQuads,
+               const bool  theToFaces)
+{
+  const int aNbNodes = (theNbCells + 1) * (theNbCells + 1);
+  const int aNbElems = !theToFaces ? 0 : theNbCells * theNbCells * (theToQuads ? 1 : 2);
+
+  RWPly_PlyWriterContext aPlyCtx;
+  aPlyCtx.SetBinary(true);
+  aPlyCtx.SetNormals(true);
+  aPlyCtx.SetTexCoords(true);
+  aPlyCtx.SetColors(!theToFaces);
+  aPlyCtx.SetSurfaceId(theToFaces);
+  ASSERT_TRUE(aPlyCtx.Open(theFile));
+  ASSERT_TRUE(aPlyCtx.WriteHeader(
+    aNbNodes,
+    aNbElems,
+    NCollection_IndexedDataMap<TCollection_AsciiString, TCollection_AsciiString>()));
+  for (int aRow = 0; aRow <= theNbCells; ++aRow)
+  {
+    for (int aCol = 0; aCol <= theNbCells; ++aCol)
+    {
+      ASSERT_TRUE(aPlyCtx.WriteVertex(
+        gp_Pnt(aCol * 0.5, aRow * 0.25, 0.01 * ((aRow * aCol) % 7)),
+        NCollection_Vec3<float>(0.0f, 0.0f, 1.0f),
+        NCollection_Vec2<float>(float(aCol) / theNbCells, float(aRow) / theNbCells),
+        NCollection_Vec4<uint8_t>(uint8_t(aCol % 256), uint8_t(aRow % 256), 128, 255)));
+    }
+  }
+  for (int aRow = 0; aRow < theNbCells && theToFaces; ++aRow)
+  {
+    aPlyCtx.SetSurfaceId(aRow);
+    for (int aCol = 0; aCol < theNbCells; ++aCol)
+    {
+      const int aNode1 = aRow * (theNbCells + 1) + aCol;
+      const int aNode2 = aNode1 + theNbCells + 1;
+      if (theToQuads)
+      {
+        ASSERT_TRUE(
+          aPlyCtx.WriteQuad(NCollection_Vec4<int>(aNode1, aNode1 + 1, aNode2 + 1, aNode2)));
+      }
+      else
+      {
+        ASSERT_TRUE(aPlyCtx.WriteTriangle(NCollection_Vec3<int>(aNode1, aNode1 + 1, aNode2 + 1)));
+        ASSERT_TRUE(aPlyCtx.WriteTriangle(NCollection_Vec3<int>(aNode1, aNode2 + 1, aNode2)));
+      }
+    }
+  }
+  ASSERT_TRUE(aPlyCtx.Close());
+}
+
+//! Reads the file sequentially and in parallel and compares the results with the grid.
+void checkGrid(const char* theFile, const int theNbCells)
+{
+  for (int aParIter = 0; aParIter < 2; ++aParIter)
+  {
+    RWPly_PlyReader aReader;
+    aReader.SetParallel(aParIter == 1);
+    ASSERT_TRUE(aReader.Read(theFile));
+    const occ::handle<Poly_Triangulation>& aMesh = aReader.Triangulation();
+    ASSERT_FALSE(aMesh.IsNull());
+    ASSERT_TRUE(aReader.Points().IsNull());
+    ASSERT_EQ((theNbCells + 1) * (theNbCells + 1), aMesh->NbNodes());
+    ASSERT_EQ(theNbCells * theNbCells * 2, aMesh->NbTriangles());
+    ASSERT_TRUE(aMesh->HasNormals());
+    ASSERT_TRUE(aMesh->HasUVNodes());
+    for (int aRow = 0; aRow <= theNbCells; ++aRow)
+    {
+      for (int aCol = 0; aCol <= theNbCells; ++aCol)
+      {
+        const int aNode = aRow * (theNbCells + 1) + aCol + 1;
+        EXPECT_NEAR(aCol * 0.5, aMesh->Node(aNode).X(), 1.0e-5);
+        EXPECT_NEAR(aRow * 0.25, aMesh->Node(aNode).Y(), 1.0e-5);
+        EXPECT_NEAR(0.01 * ((aRow * aCol) % 7), aMesh->Node(aNode).Z(), 1.0e-5);
+        EXPECT_NEAR(1.0, aMesh->Normal(aNode).Z(), 1.0e-5);
+        EXPECT_NEAR(double(aCol) / theNbCells, aMesh->UVNode(aNode).X(), 1.0e-5);
+      }
+    }
+    for (int aRow = 0, aTriIter = 1; aRow < theNbCells; ++aRow)
+    {
+      for (int aCol = 0; aCol < theNbCells; ++aCol, aTriIter += 2)
+      {
+        const int aNode1 = aRow * (theNbCells + 1) + aCol + 1;
+        const int aNode2 = aNode1 + theNbCells + 1;
+        int       aNodes[3];
+        aMesh->Triangle(aTriIter).Get(aNodes[0], aNodes[1], aNodes[2]);
+        EXPECT_EQ(aNode1, aNodes[0]);
+        EXPECT_EQ(aNode1 + 1, aNodes[1]);
+        EXPECT_EQ(aNode2 + 1, aNodes[2]);
+        aMesh->Triangle(aTriIter + 1).Get(aNodes[0], aNodes[1], aNodes[2]);
+        EXPECT_EQ(aNode1, aNodes[0]);
+        EXPECT_EQ(aNode2 + 1, aNodes[1]);
+        EXPECT_EQ(aNode2, aNodes[2]);
+      }
+    }
+  }
+}
+} // namespace
+
+TEST(RWPly_PlyReader_Test, BinaryTriangles)
+{
+  const char* aFile = "RWPly_PlyReader_Test_BinaryTriangles.ply";
+  writeGrid(aFile, 300, false, true);
+  checkGrid(aFile, 300);
+  OSD_File(OSD_Path(aFile)).Remove();
+}
+
+TEST(RWPly_PlyReader_Test, BinaryQuads)
+{
+  const char* aFile = "RWPly_PlyReader_Test_BinaryQuads.ply";
+  writeGrid(aFile, 300, true, true);
+  checkGrid(aFile, 300);
+  OSD_File(OSD_Path(aFile)).Remove();
+}
+
+TEST(RWPly_PlyReader_Test, BinaryPointCloud)
+{
+  const char* aFile = "RWPly_PlyReader_Test_BinaryPointCloud.ply";
+  writeGrid(aFile, 300, false, false);
+
+  RWPly_PlyReader aReader;
+  aReader.SetParallel(true);
+  ASSERT_TRUE(aReader.Read(aFile));
+  OSD_File(OSD_Path(aFile)).Remove();
+  ASSERT_TRUE(aReader.Triangulation().IsNull());
+  const occ::handle<Graphic3d_ArrayOfPoints>& aPoints = aReader.Points();
+  ASSERT_FALSE(aPoints.IsNull());
+  ASSERT_EQ(301 * 301, aPoints->VertexNumber());
+  ASSERT_TRUE(aPoints->HasVertexColors());
+  ASSERT_TRUE(aPoints->HasVertexNormals());
+  for (int aRow = 0; aRow <= 300; ++aRow)
+  {
+    for (int aCol = 0; aCol <= 300; ++aCol)
+    {
+      const int aNode = aRow * 301 + aCol + 1;
+      EXPECT_NEAR(aCol * 0.5, aPoints->Vertice(aNode).X(), 1.0e-5);
+      EXPECT_NEAR(aRow * 0.25, aPoints->Vertice(aNode).Y(), 1.0e-5);
+      NCollection_Vec4<uint8_t> aColor;
+      aPoints->VertexColor(aNode, aColor);
+      EXPECT_EQ(aCol % 256, aColor.r());
+      EXPECT_EQ(aRow % 256, aColor.g());
+      EXPECT_EQ(128, aColor.b());
+    }
+  }
+}
+
+TEST(RWPly_PlyReader_Test, AsciiNotSupported)
+{
+  const char*            aFile = "RWPly_PlyReader_Test_AsciiNotSupported.ply";
+  RWPly_PlyWriterContext aPlyCtx;
+  ASSERT_TRUE(aPlyCtx.Open(aFile));
+  ASSERT_TRUE(aPlyCtx.WriteHeader(
+    1,
+    0,
+    NCollection_IndexedDataMap<TCollection_AsciiString, TCollection_AsciiString>()));
+  ASSERT_TRUE(aPlyCtx.WriteVertex(gp_Pnt(1.0, 2.0, 3.0),
+                                  NCollection_Vec3<float>(),
+                                  NCollection_Vec2<float>(),
+                                  NCollection_Vec4<uint8_t>()));
+  ASSERT_TRUE(aPlyCtx.Close());
+
+  RWPly_PlyReader aReader;
+  EXPECT_FALSE(aReader.Read(aFile));
+  OSD_File(OSD_Path(aFile)).Remove();
+}
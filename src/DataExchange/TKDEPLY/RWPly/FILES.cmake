@@ -5,6 +5,8 @@ set(OCCT_RWPly_FILES
   RWPly_CafWriter.cxx
   RWPly_CafWriter.hxx
 
+  RWPly_PlyReader.cxx
+  RWPly_PlyReader.hxx
   RWPly_PlyWriterContext.cxx
   RWPly_PlyWriterContext.hxx
 
@@ -15,6 +15,7 @@
 
 #include <Message.hxx>
 #include <Message_LazyProgressScope.hxx>
+#include <OSD_Parallel.hxx>
 #include <OSD_Path.hxx>
 #include <RWMesh_FaceIterator.hxx>
 #include <RWMesh_MaterialMap.hxx>
@@ -26,12 +27,48 @@
 #include <XCAFDoc_ShapeTool.hxx>
 #include <XCAFPrs_DocumentExplorer.hxx>
 
+#include <algorithm>
+
 IMPLEMENT_STANDARD_RTTIEXT(RWPly_CafWriter, Standard_Transient)
 
+namespace
+{
+//! Maximum number of binary records encoded into a buffer before writing it into the file.
+static const int THE_NB_BLOCK_RECORDS = 256 * 1024;
+
+//! Number of binary records encoded by a single parallel task.
+static const int THE_NB_CHUNK_RECORDS = 4096;
+
+//! Fetch the node attributes to write.
+static void faceNode(const RWMesh_FaceIterator&              theFace,
+                     const RWMesh_CoordinateSystemConverter& theCSTrsf,
+                     const int                               theNodeIndex,
+                     gp_XYZ&                                 theNode,
+                     NCollection_Vec3<float>&                theNormVec,
+                     NCollection_Vec2<float>&                theTexVec)
+{
+  theNode = theFace.NodeTransformed(theNodeIndex).XYZ();
+  theCSTrsf.TransformPosition(theNode);
+  if (theFace.HasNormals())
+  {
+    gp_Dir aNorm = theFace.NormalTransformed(theNodeIndex);
+    theNormVec.SetValues((float)aNorm.X(), (float)aNorm.Y(), (float)aNorm.Z());
+    theCSTrsf.TransformNormal(theNormVec);
+  }
+  if (theFace.HasTexCoords())
+  {
+    const gp_Pnt2d aUV = theFace.NodeTexCoord(theNodeIndex);
+    theTexVec.SetValues((float)aUV.X(), (float)aUV.Y());
+  }
+}
+} // namespace
+
 //=================================================================================================
 
 RWPly_CafWriter::RWPly_CafWriter(const TCollection_AsciiString& theFile)
     : myFile(theFile),
+      myIsBinary(false),
+      myToParallel(false),
       myIsDoublePrec(false),
       myHasNormals(true),
       myHasColors(true),
@@ -129,6 +166,7 @@ bool RWPly_CafWriter::Perform(
 
   Standard_CLocaleSentry aLocaleSentry;
   RWPly_PlyWriterContext aPlyCtx;
+  aPlyCtx.SetBinary(myIsBinary);
   aPlyCtx.SetDoublePrecision(myIsDoublePrec);
   aPlyCtx.SetNormals(myHasNormals);
   aPlyCtx.SetColors(myHasColors);
@@ -176,6 +214,8 @@ bool RWPly_CafWriter::Perform(
     }
   }
 
+  myBlockBuffer.clear();
+  myBlockBuffer.shrink_to_fit();
   const bool isClosed = aPlyCtx.Close();
   if (isDone && !isClosed)
   {
@@ -204,9 +244,12 @@ bool RWPly_CafWriter::writeShape(RWPly_PlyWriterContext&    theWriter,
                                  const TopLoc_Location&     theParentTrsf,
                                  const XCAFPrs_Style&       theParentStyle)
 {
-  for (RWMesh_FaceIterator aFaceIter(theLabel, theParentTrsf, true, theParentStyle);
-       aFaceIter.More() && !thePSentry.IsAborted();
-       aFaceIter.Next())
+  RWMesh_FaceIterator aFaceIter(theLabel, theParentTrsf, true, theParentStyle);
+  if (theWriteStep == 0 && myToParallel)
+  {
+    aFaceIter.PrepareData(true);
+  }
+  for (; aFaceIter.More() && !thePSentry.IsAborted(); aFaceIter.Next())
   {
     if (toSkipFaceMesh(aFaceIter))
     {
@@ -245,23 +288,63 @@ bool RWPly_CafWriter::writeNodes(RWPly_PlyWriterContext&    theWriter,
                         (unsigned char)int(aColorF.b() * 255.0f),
                         (unsigned char)int(aColorF.a() * 255.0f));
   }
-  for (int aNodeIter = theFace.NodeLower(); aNodeIter <= aNodeUpper && thePSentry.More();
-       ++aNodeIter, thePSentry.Next())
+  if (theWriter.IsBinary())
   {
-    gp_XYZ aNode = theFace.NodeTransformed(aNodeIter).XYZ();
-    myCSTrsf.TransformPosition(aNode);
-    if (theFace.HasNormals())
+    // normals computed from the surface (not stored in triangulation) cannot be evaluated
+    // from concurrent threads, unless they have been prepared in advance
+    const bool   isSingleThread = !myToParallel
+                                || (theFace.HasNormals() && !theFace.Triangulation()->HasNormals()
+                                    && !theFace.IsPrepared());
+    const size_t aRecordSize    = theWriter.VertexRecordSize();
+    for (int aBlockLower = theFace.NodeLower(); aBlockLower <= aNodeUpper && thePSentry.More();
+         aBlockLower += THE_NB_BLOCK_RECORDS)
     {
-      gp_Dir aNorm = theFace.NormalTransformed(aNodeIter);
-      aNormVec.SetValues((float)aNorm.X(), (float)aNorm.Y(), (float)aNorm.Z());
-      myCSTrsf.TransformNormal(aNormVec);
-    }
-    if (theFace.HasTexCoords())
-    {
-      const gp_Pnt2d aUV = theFace.NodeTexCoord(aNodeIter);
-      aTexVec.SetValues((float)aUV.X(), (float)aUV.Y());
+      const int aNbBlockNodes = std::min(THE_NB_BLOCK_RECORDS, aNodeUpper - aBlockLower + 1);
+      const int aNbChunks     = (aNbBlockNodes + THE_NB_CHUNK_RECORDS - 1) / THE_NB_CHUNK_RECORDS;
+      myBlockBuffer.resize(aRecordSize * size_t(aNbBlockNodes));
+      uint8_t* aBlockData = myBlockBuffer.data();
+      OSD_Parallel::For(
+        0,
+        aNbChunks,
+        [&](int theChunkIndex) {
+          const int               aFrom = theChunkIndex * THE_NB_CHUNK_RECORDS;
+          const int               aTo = std::min(aFrom + THE_NB_CHUNK_RECORDS, aNbBlockNodes);
+          gp_XYZ                  aNode;
+          NCollection_Vec3<float> aNormVecChunk;
+          NCollection_Vec2<float> aTexVecChunk;
+          for (int aNodeIter = aFrom; aNodeIter < aTo; ++aNodeIter)
+          {
+            faceNode(theFace,
+                     myCSTrsf,
+                     aBlockLower + aNodeIter,
+                     aNode,
+                     aNormVecChunk,
+                     aTexVecChunk);
+            theWriter.EncodeVertex(aBlockData + aRecordSize * size_t(aNodeIter),
+                                   aNode,
+                                   aNormVecChunk,
+                                   aTexVecChunk,
+                                   aColorVec);
+          }
+        },
+        isSingleThread);
+      if (!theWriter.WriteVertexBlock(aBlockData, aNbBlockNodes))
+      {
+        return false;
+      }
+      for (int aNodeIter = 0; aNodeIter < aNbBlockNodes; ++aNodeIter)
+      {
+        thePSentry.Next();
+      }
     }
+    return true;
+  }
 
+  gp_XYZ aNode;
+  for (int aNodeIter = theFace.NodeLower(); aNodeIter <= aNodeUpper && thePSentry.More();
+       ++aNodeIter, thePSentry.Next())
+  {
+    faceNode(theFace, myCSTrsf, aNodeIter, aNode, aNormVec, aTexVec);
     if (!theWriter.WriteVertex(aNode, aNormVec, aTexVec, aColorVec))
     {
       return false;
@@ -283,6 +366,45 @@ bool RWPly_CafWriter::writeIndices(RWPly_PlyWriterContext&    theWriter,
 
   const int anElemLower = theFace.ElemLower();
   const int anElemUpper = theFace.ElemUpper();
+  if (theWriter.IsBinary())
+  {
+    const size_t aRecordSize = theWriter.TriangleRecordSize();
+    for (int aBlockLower = anElemLower; aBlockLower <= anElemUpper && thePSentry.More();
+         aBlockLower += THE_NB_BLOCK_RECORDS)
+    {
+      const int aNbBlockElems = std::min(THE_NB_BLOCK_RECORDS, anElemUpper - aBlockLower + 1);
+      const int aNbChunks     = (aNbBlockElems + THE_NB_CHUNK_RECORDS - 1) / THE_NB_CHUNK_RECORDS;
+      myBlockBuffer.resize(aRecordSize * size_t(aNbBlockElems));
+      uint8_t* aBlockData = myBlockBuffer.data();
+      OSD_Parallel::For(
+        0,
+        aNbChunks,
+        [&](int theChunkIndex) {
+          const int aFrom = theChunkIndex * THE_NB_CHUNK_RECORDS;
+          const int aTo   = std::min(aFrom + THE_NB_CHUNK_RECORDS, aNbBlockElems);
+          for (int anElemIter = aFrom; anElemIter < aTo; ++anElemIter)
+          {
+            const Poly_Triangle aTri = theFace.TriangleOriented(aBlockLower + anElemIter);
+            theWriter.EncodeTriangle(aBlockData + aRecordSize * size_t(anElemIter),
+                                     NCollection_Vec3<int>(aTri(1), aTri(2), aTri(3))
+                                       - NCollection_Vec3<int>(anElemLower));
+          }
+        },
+        !myToParallel);
+      if (!theWriter.WriteTriangleBlock(aBlockData, aNbBlockElems))
+      {
+        return false;
+      }
+      for (int anElemIter = 0; anElemIter < aNbBlockElems; ++anElemIter)
+      {
+        thePSentry.Next();
+      }
+    }
+
+    theWriter.SetVertexOffset(theWriter.VertexOffset() + theFace.NbNodes());
+    return true;
+  }
+
   for (int anElemIter = anElemLower; anElemIter <= anElemUpper && thePSentry.More();
        ++anElemIter, thePSentry.Next())
   {
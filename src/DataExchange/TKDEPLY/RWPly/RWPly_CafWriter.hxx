@@ -24,6 +24,7 @@
 #include <XCAFPrs_Style.hxx>
 
 #include <memory>
+#include <vector>
 
 class Message_ProgressRange;
 class RWMesh_FaceIterator;
@@ -63,6 +64,20 @@ public:
   void SetDefaultStyle(const XCAFPrs_Style& theStyle) { myDefaultStyle = theStyle; }
 
 public:
+  //! Return TRUE if file should be written in binary little-endian format; FALSE by default.
+  bool IsBinary() const { return myIsBinary; }
+
+  //! Set if file should be written in binary little-endian format.
+  void SetBinary(bool theIsBinary) { myIsBinary = theIsBinary; }
+
+  //! Return TRUE if binary vertex and element blocks should be encoded in parallel threads;
+  //! FALSE by default.
+  bool ToParallel() const { return myToParallel; }
+
+  //! Set if binary vertex and element blocks should be encoded in parallel threads.
+  //! Has no effect on ASCII output.
+  void SetParallel(bool theToParallel) { myToParallel = theToParallel; }
+
   //! Return TRUE if vertex position should be stored with double floating point precision; FALSE by
   //! default.
   bool IsDoublePrecision() const { return myIsDoublePrec; }
@@ -190,12 +205,15 @@ protected:
   RWMesh_CoordinateSystemConverter myCSTrsf;       //!< transformation from OCCT to PLY coordinate system
   XCAFPrs_Style                    myDefaultStyle; //!< default material definition to be used for nodes with only color defined
                                   // clang-format on
-  bool myIsDoublePrec;
-  bool myHasNormals;
-  bool myHasColors;
-  bool myHasTexCoords;
-  bool myHasPartId;
-  bool myHasFaceId;
+  std::vector<uint8_t> myBlockBuffer; //!< buffer for encoding binary blocks of records
+  bool                 myIsBinary;
+  bool                 myToParallel;
+  bool                 myIsDoublePrec;
+  bool                 myHasNormals;
+  bool                 myHasColors;
+  bool                 myHasTexCoords;
+  bool                 myHasPartId;
+  bool                 myHasFaceId;
 };
 
 #endif // _RWPly_CafWriter_HeaderFiler
@@ -0,0 +1,904 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <RWPly_PlyReader.hxx>
+
+#include <FSD_BinaryFile.hxx>
+#include <Message.hxx>
+#include <Message_ProgressScope.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_Buffer.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_FileSystem.hxx>
+#include <OSD_Parallel.hxx>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <limits>
+
+IMPLEMENT_STANDARD_RTTIEXT(RWPly_PlyReader, Standard_Transient)
+
+namespace
+{
+//! Number of records decoded by a single parallel task.
+static const int THE_NB_CHUNK_RECORDS = 65536;
+
+//! Type of PLY property value.
+enum PlyValueType
+{
+  PlyValueType_Unknown = 0,
+  PlyValueType_Int8,
+  PlyValueType_UInt8,
+  PlyValueType_Int16,
+  PlyValueType_UInt16,
+  PlyValueType_Int32,
+  PlyValueType_UInt32,
+  PlyValueType_Float32,
+  PlyValueType_Float64
+};
+
+//! PLY element property.
+struct PlyProperty
+{
+  TCollection_AsciiString Name;      //!< property name
+  PlyValueType            Type;      //!< value type (type of items for list property)
+  PlyValueType            CountType; //!< type of list length, unknown for scalar property
+  size_t                  Offset;    //!< offset within the record (valid until first list)
+
+  PlyProperty()
+      : Type(PlyValueType_Unknown),
+        CountType(PlyValueType_Unknown),
+        Offset(0)
+  {
+  }
+
+  //! Return TRUE for list property.
+  bool IsList() const { return CountType != PlyValueType_Unknown; }
+};
+
+//! PLY element definition.
+struct PlyElement
+{
+  TCollection_AsciiString         Name;       //!< element name
+  NCollection_Vector<PlyProperty> Properties; //!< element properties
+  int64_t                         Count;      //!< number of records
+  size_t                          Stride;     //!< record size or 0 if element defines lists
+
+  PlyElement()
+      : Count(0),
+        Stride(0)
+  {
+  }
+
+  //! Find property by one of the names.
+  const PlyProperty* FindProperty(const char* theName1,
+                                  const char* theName2 = nullptr,
+                                  const char* theName3 = nullptr) const
+  {
+    for (NCollection_Vector<PlyProperty>::Iterator aPropIter(Properties); aPropIter.More();
+         aPropIter.Next())
+    {
+      const PlyProperty& aProp = aPropIter.Value();
+      if (aProp.Name.IsEqual(theName1) || (theName2 != nullptr && aProp.Name.IsEqual(theName2))
+          || (theName3 != nullptr && aProp.Name.IsEqual(theName3)))
+      {
+        return &aProp;
+      }
+    }
+    return nullptr;
+  }
+};
+
+//! Parse value type name.
+static PlyValueType plyValueType(const TCollection_AsciiString& theName)
+{
+  if (theName == "char" || theName == "int8")
+  {
+    return PlyValueType_Int8;
+  }
+  else if (theName == "uchar" || theName == "uint8")
+  {
+    return PlyValueType_UInt8;
+  }
+  else if (theName == "short" || theName == "int16")
+  {
+    return PlyValueType_Int16;
+  }
+  else if (theName == "ushort" || theName == "uint16")
+  {
+    return PlyValueType_UInt16;
+  }
+  else if (theName == "int" || theName == "int32")
+  {
+    return PlyValueType_Int32;
+  }
+  else if (theName == "uint" || theName == "uint32")
+  {
+    return PlyValueType_UInt32;
+  }
+  else if (theName == "float" || theName == "float32")
+  {
+    return PlyValueType_Float32;
+  }
+  else if (theName == "double" || theName == "float64")
+  {
+    return PlyValueType_Float64;
+  }
+  return PlyValueType_Unknown;
+}
+
+//! Return size of the value type in bytes.
+static size_t plyValueSize(const PlyValueType theType)
+{
+  switch (theType)
+  {
+    case PlyValueType_Int8:
+    case PlyValueType_UInt8:
+      return 1;
+    case PlyValueType_Int16:
+    case PlyValueType_UInt16:
+      return 2;
+    case PlyValueType_Int32:
+    case PlyValueType_UInt32:
+    case PlyValueType_Float32:
+      return 4;
+    case PlyValueType_Float64:
+      return 8;
+    case PlyValueType_Unknown:
+      break;
+  }
+  return 0;
+}
+
+//! Read the value stored in little-endian byte order.
+template <typename Type>
+inline Type readPlyValue(const uint8_t* thePos)
+{
+  uint8_t aBytes[sizeof(Type)];
+  std::memcpy(aBytes, thePos, sizeof(Type));
+#if OCCT_BINARY_FILE_DO_INVERSE
+  std::reverse(aBytes, aBytes + sizeof(Type));
+#endif
+  Type aValue;
+  std::memcpy(&aValue, aBytes, sizeof(Type));
+  return aValue;
+}
+
+//! Read the value of specified type as floating point number.
+static double readPlyNumber(const uint8_t* thePos, const PlyValueType theType)
+{
+  switch (theType)
+  {
+    case PlyValueType_Int8:
+      return (double)readPlyValue<int8_t>(thePos);
+    case PlyValueType_UInt8:
+      return (double)readPlyValue<uint8_t>(thePos);
+    case PlyValueType_Int16:
+      return (double)readPlyValue<int16_t>(thePos);
+    case PlyValueType_UInt16:
+      return (double)readPlyValue<uint16_t>(thePos);
+    case PlyValueType_Int32:
+      return (double)readPlyValue<int32_t>(thePos);
+    case PlyValueType_UInt32:
+      return (double)readPlyValue<uint32_t>(thePos);
+    case PlyValueType_Float32:
+      return (double)readPlyValue<float>(thePos);
+    case PlyValueType_Float64:
+      return readPlyValue<double>(thePos);
+    case PlyValueType_Unknown:
+      break;
+  }
+  return 0.0;
+}
+
+//! Read the value of specified type as integer number.
+static int64_t readPlyInteger(const uint8_t* thePos, const PlyValueType theType)
+{
+  switch (theType)
+  {
+    case PlyValueType_Int8:
+      return readPlyValue<int8_t>(thePos);
+    case PlyValueType_UInt8:
+      return readPlyValue<uint8_t>(thePos);
+    case PlyValueType_Int16:
+      return readPlyValue<int16_t>(thePos);
+    case PlyValueType_UInt16:
+      return readPlyValue<uint16_t>(thePos);
+    case PlyValueType_Int32:
+      return readPlyValue<int32_t>(thePos);
+    case PlyValueType_UInt32:
+      return readPlyValue<uint32_t>(thePos);
+    case PlyValueType_Float32:
+      return (int64_t)readPlyValue<float>(thePos);
+    case PlyValueType_Float64:
+      return (int64_t)readPlyValue<double>(thePos);
+    case PlyValueType_Unknown:
+      break;
+  }
+  return 0;
+}
+
+//! Read color component; floating point values are expected within [0, 1] range.
+static uint8_t readPlyColor(const uint8_t* thePos, const PlyValueType theType)
+{
+  if (theType == PlyValueType_UInt8)
+  {
+    return *thePos;
+  }
+
+  double aValue = readPlyNumber(thePos, theType);
+  if (theType == PlyValueType_Float32 || theType == PlyValueType_Float64)
+  {
+    aValue *= 255.0;
+  }
+  return (uint8_t)std::max(0.0, std::min(aValue, 255.0));
+}
+
+//! Parse PLY header.
+//! @param[in] theData  file content
+//! @param[in] theSize  file content size
+//! @param[out] theDataOffset offset of the data following the header
+//! @param[out] theFormat     format name
+//! @param[out] theElements   element definitions
+//! @param[out] theComments   header comments
+//! @return error message or NULL on success
+static const char* parsePlyHeader(const uint8_t*                                 theData,
+                                  const size_t                                   theSize,
+                                  size_t&                                        theDataOffset,
+                                  TCollection_AsciiString&                       theFormat,
+                                  NCollection_Vector<PlyElement>&                theElements,
+                                  NCollection_Sequence<TCollection_AsciiString>& theComments)
+{
+  const char* aPos  = (const char*)theData;
+  const char* anEnd = aPos + theSize;
+  for (int aLineIter = 0;; ++aLineIter)
+  {
+    const char* anEol = (const char*)::memchr(aPos, '\n', size_t(anEnd - aPos));
+    if (anEol == nullptr)
+    {
+      return "unexpected end of header";
+    }
+
+    TCollection_AsciiString aLine(aPos, int(anEol - aPos));
+    aPos = anEol + 1;
+    aLine.LeftAdjust();
+    aLine.RightAdjust();
+    const TCollection_AsciiString aKey = aLine.Token(" \t", 1);
+    if (aLineIter == 0)
+    {
+      if (aKey != "ply")
+      {
+        return "file is not PLY";
+      }
+      continue;
+    }
+
+    if (aKey == "end_header")
+    {
+      break;
+    }
+    else if (aKey == "format")
+    {
+      theFormat = aLine.Token(" \t", 2);
+    }
+    else if (aKey == "comment")
+    {
+      theComments.Append(aLine.Length() > 8 ? aLine.SubString(9, aLine.Length())
+                                            : TCollection_AsciiString());
+    }
+    else if (aKey == "element")
+    {
+      const TCollection_AsciiString aCount = aLine.Token(" \t", 3);
+      if (!aCount.IsIntegerValue() && !aCount.IsRealValue())
+      {
+        return "invalid element definition";
+      }
+
+      PlyElement& anElem = theElements.Appended();
+      anElem.Name        = aLine.Token(" \t", 2);
+      anElem.Count       = (int64_t)Strtod(aCount.ToCString(), nullptr);
+      if (anElem.Count < 0)
+      {
+        return "invalid element definition";
+      }
+    }
+    else if (aKey == "property")
+    {
+      if (theElements.IsEmpty())
+      {
+        return "property is defined outside of element";
+      }
+
+      PlyElement&  anElem = theElements.ChangeLast();
+      PlyProperty& aProp  = anElem.Properties.Appended();
+      if (aLine.Token(" \t", 2) == "list")
+      {
+        aProp.CountType = plyValueType(aLine.Token(" \t", 3));
+        aProp.Type      = plyValueType(aLine.Token(" \t", 4));
+        aProp.Name      = aLine.Token(" \t", 5);
+        if (aProp.CountType == PlyValueType_Unknown)
+        {
+          return "unknown property type";
+        }
+      }
+      else
+      {
+        aProp.Type = plyValueType(aLine.Token(" \t", 2));
+        aProp.Name = aLine.Token(" \t", 3);
+      }
+      if (aProp.Type == PlyValueType_Unknown)
+      {
+        return "unknown property type";
+      }
+    }
+  }
+
+  theDataOffset = size_t(aPos - (const char*)theData);
+  for (NCollection_Vector<PlyElement>::Iterator anElemIter(theElements); anElemIter.More();
+       anElemIter.Next())
+  {
+    PlyElement& anElem   = anElemIter.ChangeValue();
+    size_t      anOffset = 0;
+    bool        hasLists = false;
+    for (NCollection_Vector<PlyProperty>::Iterator aPropIter(anElem.Properties); aPropIter.More();
+         aPropIter.Next())
+    {
+      PlyProperty& aProp = aPropIter.ChangeValue();
+      aProp.Offset       = anOffset;
+      hasLists           = hasLists || aProp.IsList();
+      anOffset += aProp.IsList() ? plyValueSize(aProp.CountType) : plyValueSize(aProp.Type);
+    }
+    anElem.Stride = hasLists ? 0 : anOffset;
+  }
+  return nullptr;
+}
+
+//! Compute the size of variable-size record.
+//! @param[in] theElem    element definition
+//! @param[in] theRecord  record data
+//! @param[in] theEnd     end of data
+//! @param[in] theList    list property to locate within the record or NULL
+//! @param[out] theListPos position of the list within the record
+//! @return record size or 0 if data is truncated
+static size_t plyRecordSize(const PlyElement&  theElem,
+                            const uint8_t*     theRecord,
+                            const uint8_t*     theEnd,
+                            const PlyProperty* theList,
+                            const uint8_t*&    theListPos)
+{
+  const uint8_t* aPos = theRecord;
+  for (NCollection_Vector<PlyProperty>::Iterator aPropIter(theElem.Properties); aPropIter.More();
+       aPropIter.Next())
+  {
+    const PlyProperty& aProp = aPropIter.Value();
+    if (&aProp == theList)
+    {
+      theListPos = aPos;
+    }
+    if (!aProp.IsList())
+    {
+      aPos += plyValueSize(aProp.Type);
+      if (aPos > theEnd)
+      {
+        return 0;
+      }
+      continue;
+    }
+
+    const size_t aCountSize = plyValueSize(aProp.CountType);
+    if (size_t(theEnd - aPos) < aCountSize)
+    {
+      return 0;
+    }
+
+    const int64_t aCount = readPlyInteger(aPos, aProp.CountType);
+    aPos += aCountSize;
+    if (aCount < 0 || uint64_t(aCount) > uint64_t(theEnd - aPos) / plyValueSize(aProp.Type))
+    {
+      return 0;
+    }
+    aPos += size_t(aCount) * plyValueSize(aProp.Type);
+  }
+  return size_t(aPos - theRecord);
+}
+
+//! Decode face of the list of node indices into triangle fan.
+//! @param[in] theList    position of the list within the record
+//! @param[in] theFaces   vertex indices list property
+//! @param[in] theFirstTri index of the first triangle to fill
+//! @param[in] theNbNodes number of nodes for validating indices
+//! @param[in] theMesh    triangulation to fill
+//! @return FALSE if face refers to invalid node
+static bool decodePlyFace(const uint8_t*                         theList,
+                          const PlyProperty&                     theFaces,
+                          const int                              theFirstTri,
+                          const int                              theNbNodes,
+                          const occ::handle<Poly_Triangulation>& theMesh)
+{
+  const size_t   anIndexSize = plyValueSize(theFaces.Type);
+  const int64_t  aNbCorners  = readPlyInteger(theList, theFaces.CountType);
+  const uint8_t* anIndices   = theList + plyValueSize(theFaces.CountType);
+  int            aFan[3]     = {0, 0, 0};
+  for (int64_t aCornerIter = 0; aCornerIter < aNbCorners; ++aCornerIter)
+  {
+    const int64_t anIndex = readPlyInteger(anIndices + anIndexSize * aCornerIter, theFaces.Type);
+    if (anIndex < 0 || anIndex >= theNbNodes)
+    {
+      return false;
+    }
+
+    aFan[aCornerIter < 2 ? aCornerIter : 2] = int(anIndex) + 1;
+    if (aCornerIter >= 2)
+    {
+      theMesh->SetTriangle(theFirstTri + int(aCornerIter) - 2,
+                           Poly_Triangle(aFan[0], aFan[1], aFan[2]));
+      aFan[1] = aFan[2];
+    }
+  }
+  return true;
+}
+} // namespace
+
+//=================================================================================================
+
+RWPly_PlyReader::RWPly_PlyReader()
+    : myToParallel(false)
+{
+  //
+}
+
+//=================================================================================================
+
+void RWPly_PlyReader::Clear()
+{
+  myComments.Clear();
+  myTriangulation.Nullify();
+  myPoints.Nullify();
+}
+
+//=================================================================================================
+
+bool RWPly_PlyReader::Read(const TCollection_AsciiString& theFile,
+                           const Message_ProgressRange&   theProgress)
+{
+  Clear();
+  const occ::handle<OSD_FileSystem>& aFileSystem = OSD_FileSystem::DefaultFileSystem();
+  occ::handle<NCollection_Buffer>    aBuffer     = aFileSystem->OpenMappedBuffer(theFile);
+  if (aBuffer.IsNull())
+  {
+    // file system does not support mapping - load the whole file into memory
+    std::shared_ptr<std::istream> aStream =
+      aFileSystem->OpenIStream(theFile, std::ios::in | std::ios::binary);
+    if (aStream.get() == nullptr)
+    {
+      Message::SendFail() << "Error: file '" << theFile << "' is not found";
+      return false;
+    }
+
+    aStream->seekg(0, std::ios::end);
+    const std::streamoff aSize = aStream->tellg();
+    aStream->seekg(0, std::ios::beg);
+    aBuffer = new NCollection_Buffer(NCollection_BaseAllocator::CommonBaseAllocator());
+    if (aSize <= 0 || !aBuffer->Allocate(size_t(aSize))
+        || !aStream->read((char*)aBuffer->ChangeData(), aSize))
+    {
+      Message::SendFail() << "Error: file '" << theFile << "' cannot be read";
+      return false;
+    }
+  }
+  return ReadBuffer(aBuffer->Data(), aBuffer->Size(), theFile, theProgress);
+}
+
+//=================================================================================================
+
+bool RWPly_PlyReader::ReadBuffer(const uint8_t*                 theData,
+                                 const size_t                   theSize,
+                                 const TCollection_AsciiString& theName,
+                                 const Message_ProgressRange&   theProgress)
+{
+  Clear();
+  size_t                         aDataOffset = 0;
+  TCollection_AsciiString        aFormat;
+  NCollection_Vector<PlyElement> anElements;
+  if (const char* anError =
+        parsePlyHeader(theData, theSize, aDataOffset, aFormat, anElements, myComments))
+  {
+    Message::SendFail() << "Error: " << anError << " in PLY file '" << theName << "'";
+    return false;
+  }
+  if (aFormat != "binary_little_endian")
+  {
+    Message::SendFail() << "Error: PLY format '" << aFormat
+                        << "' is not supported (only binary_little_endian) in file '" << theName
+                        << "'";
+    return false;
+  }
+
+  const uint8_t*     aDataEnd  = theData + theSize;
+  const PlyElement*  aVertElem = nullptr;
+  const PlyElement*  aFaceElem = nullptr;
+  const PlyProperty* aFaceList = nullptr;
+  const uint8_t*     aVertData = nullptr;
+  const uint8_t*     aFaceData = nullptr;
+
+  // fixed-size face records defining triangles with only list of node indices
+  size_t aTriStride = 0;
+
+  // positions of node index lists and first triangles of variable-size face records
+  NCollection_Array1<const uint8_t*> aFaceLists;
+  NCollection_Array1<int>            aFaceFirstTris;
+  int64_t                            aNbTris = 0;
+
+  // locate vertex and face data
+  const uint8_t* aPos = theData + aDataOffset;
+  for (NCollection_Vector<PlyElement>::Iterator anElemIter(anElements);
+       anElemIter.More() && (aVertData == nullptr || aFaceData == nullptr);
+       anElemIter.Next())
+  {
+    const PlyElement& anElem   = anElemIter.Value();
+    const bool        isVertex = anElem.Name == "vertex" && aVertData == nullptr;
+    const bool isFace = anElem.Name == "face" && aFaceData == nullptr && anElem.Count > 0;
+    if (isVertex)
+    {
+      aVertElem = &anElem;
+      aVertData = aPos;
+    }
+    else if (isFace)
+    {
+      aFaceElem = &anElem;
+      aFaceData = aPos;
+      aFaceList = anElem.FindProperty("vertex_indices", "vertex_index");
+      if (aFaceList == nullptr || !aFaceList->IsList())
+      {
+        Message::SendFail() << "Error: PLY file '" << theName
+                            << "' defines faces without node indices";
+        return false;
+      }
+
+      size_t aNbLists = 0;
+      for (NCollection_Vector<PlyProperty>::Iterator aPropIter(anElem.Properties);
+           aPropIter.More();
+           aPropIter.Next())
+      {
+        aNbLists += aPropIter.Value().IsList() ? 1 : 0;
+        aTriStride += aPropIter.Value().IsList()
+                        ? plyValueSize(aPropIter.Value().CountType)
+                            + plyValueSize(aPropIter.Value().Type) * 3
+                        : plyValueSize(aPropIter.Value().Type);
+      }
+      aTriStride = aNbLists == 1 ? aTriStride : 0;
+      if (aTriStride != 0 && uint64_t(anElem.Count) <= uint64_t(aDataEnd - aPos) / aTriStride)
+      {
+        // check if all faces are triangles to decode fixed-size records
+        const int64_t aNbChunks =
+          (anElem.Count + THE_NB_CHUNK_RECORDS - 1) / THE_NB_CHUNK_RECORDS;
+        std::atomic<bool> isFixed(true);
+        OSD_Parallel::For(
+          0,
+          int(aNbChunks),
+          [&](int theChunkIndex) {
+            const int64_t  aFrom = int64_t(theChunkIndex) * THE_NB_CHUNK_RECORDS;
+            const int64_t  aTo   = std::min(aFrom + THE_NB_CHUNK_RECORDS, anElem.Count);
+            const uint8_t* aList = aPos + aFaceList->Offset;
+            for (int64_t aFaceIter = aFrom; aFaceIter < aTo && isFixed; ++aFaceIter)
+            {
+              if (readPlyInteger(aList + aTriStride * aFaceIter, aFaceList->CountType) != 3)
+              {
+                isFixed = false;
+              }
+            }
+          },
+          !myToParallel);
+        aTriStride = isFixed ? aTriStride : 0;
+      }
+      if (aTriStride != 0)
+      {
+        aNbTris = anElem.Count;
+        aPos += aTriStride * size_t(anElem.Count);
+        continue;
+      }
+    }
+
+    if (anElem.Stride != 0)
+    {
+      if (uint64_t(anElem.Count) > uint64_t(aDataEnd - aPos) / anElem.Stride)
+      {
+        Message::SendFail() << "Error: unexpected end of PLY file '" << theName << "'";
+        return false;
+      }
+      aPos += anElem.Stride * size_t(anElem.Count);
+      continue;
+    }
+
+    if (isFace)
+    {
+      if (anElem.Count > std::numeric_limits<int>::max())
+      {
+        Message::SendFail() << "Error: PLY file '" << theName << "' defines too many faces";
+        return false;
+      }
+      aFaceLists.Resize(0, int(anElem.Count) - 1, false);
+      aFaceFirstTris.Resize(0, int(anElem.Count) - 1, false);
+    }
+    for (int64_t aRecIter = 0; aRecIter < anElem.Count; ++aRecIter)
+    {
+      const uint8_t* aList    = nullptr;
+      const size_t   aRecSize = plyRecordSize(anElem, aPos, aDataEnd, aFaceList, aList);
+      if (aRecSize == 0)
+      {
+        Message::SendFail() << "Error: unexpected end of PLY file '" << theName << "'";
+        return false;
+      }
+      if (isFace)
+      {
+        aFaceLists.SetValue(int(aRecIter), aList);
+        aFaceFirstTris.SetValue(int(aRecIter), int(aNbTris) + 1);
+        aNbTris += std::max(readPlyInteger(aList, aFaceList->CountType) - 2, int64_t(0));
+      }
+      aPos += aRecSize;
+    }
+  }
+
+  if (aVertElem == nullptr || aVertElem->Count == 0)
+  {
+    Message::SendFail() << "Error: PLY file '" << theName << "' defines no vertices";
+    return false;
+  }
+  else if (aVertElem->Stride == 0)
+  {
+    Message::SendFail() << "Error: PLY file '" << theName
+                        << "' defines vertex element with list properties";
+    return false;
+  }
+  else if (uint64_t(aVertElem->Count) > uint64_t(aDataEnd - aVertData) / aVertElem->Stride)
+  {
+    Message::SendFail() << "Error: unexpected end of PLY file '" << theName << "'";
+    return false;
+  }
+  else if (aVertElem->Count > std::numeric_limits<int>::max()
+           || aNbTris > std::numeric_limits<int>::max())
+  {
+    Message::SendFail() << "Error: PLY file '" << theName << "' defines too many elements";
+    return false;
+  }
+
+  const PlyProperty* aPosProps[3] = {aVertElem->FindProperty("x"),
+                                     aVertElem->FindProperty("y"),
+                                     aVertElem->FindProperty("z")};
+  const PlyProperty* aNormProps[3] = {aVertElem->FindProperty("nx"),
+                                      aVertElem->FindProperty("ny"),
+                                      aVertElem->FindProperty("nz")};
+  const PlyProperty* aUVProps[2]    = {aVertElem->FindProperty("s", "u", "texture_u"),
+                                      aVertElem->FindProperty("t", "v", "texture_v")};
+  const PlyProperty* aColorProps[4] = {aVertElem->FindProperty("red", "r"),
+                                       aVertElem->FindProperty("green", "g"),
+                                       aVertElem->FindProperty("blue", "b"),
+                                       aVertElem->FindProperty("alpha", "a")};
+  if (aPosProps[0] == nullptr || aPosProps[1] == nullptr || aPosProps[2] == nullptr)
+  {
+    Message::SendFail() << "Error: PLY file '" << theName << "' defines no vertex positions";
+    return false;
+  }
+
+  const bool hasNormals =
+    aNormProps[0] != nullptr && aNormProps[1] != nullptr && aNormProps[2] != nullptr;
+  const bool hasUV = aUVProps[0] != nullptr && aUVProps[1] != nullptr;
+  const bool hasColors =
+    aColorProps[0] != nullptr && aColorProps[1] != nullptr && aColorProps[2] != nullptr;
+  const int    aNbNodes    = int(aVertElem->Count);
+  const int    aNbChunks   = (aNbNodes + THE_NB_CHUNK_RECORDS - 1) / THE_NB_CHUNK_RECORDS;
+  const size_t aVertStride = aVertElem->Stride;
+
+  Message_ProgressScope aPS(theProgress, "Reading PLY file", 2);
+  if (aFaceElem == nullptr)
+  {
+    // point cloud
+    myPoints = new Graphic3d_ArrayOfPoints(
+      aNbNodes,
+      (hasNormals ? Graphic3d_ArrayFlags_VertexNormal : Graphic3d_ArrayFlags_None)
+        | (hasUV ? Graphic3d_ArrayFlags_VertexTexel : Graphic3d_ArrayFlags_None)
+        | (hasColors ? Graphic3d_ArrayFlags_VertexColor : Graphic3d_ArrayFlags_None));
+    const occ::handle<Graphic3d_Buffer>& anAttribs = myPoints->Attributes();
+    if (anAttribs.IsNull())
+    {
+      myPoints.Nullify();
+      Message::SendFail() << "Error: not enough memory for reading PLY file '" << theName << "'";
+      return false;
+    }
+
+    int      anAttribIndex = 0;
+    size_t   aPosStride = 0, aNormStride = 0, aTexStride = 0, aColStride = 0;
+    uint8_t* aPosData =
+      anAttribs->ChangeAttributeData(Graphic3d_TOA_POS, anAttribIndex, aPosStride);
+    uint8_t* aNormData =
+      anAttribs->ChangeAttributeData(Graphic3d_TOA_NORM, anAttribIndex, aNormStride);
+    uint8_t* aTexData = anAttribs->ChangeAttributeData(Graphic3d_TOA_UV, anAttribIndex, aTexStride);
+    uint8_t* aColData =
+      anAttribs->ChangeAttributeData(Graphic3d_TOA_COLOR, anAttribIndex, aColStride);
+    anAttribs->NbElements = aNbNodes;
+
+    Message_ProgressScope                     aChunksScope(aPS.Next(2), nullptr, aNbChunks);
+    NCollection_Array1<Message_ProgressRange> aRanges(0, aNbChunks - 1);
+    for (int aChunkIter = 0; aChunkIter < aNbChunks; ++aChunkIter)
+    {
+      aRanges.SetValue(aChunkIter, aChunksScope.Next());
+    }
+    OSD_Parallel::For(
+      0,
+      aNbChunks,
+      [&](int theChunkIndex) {
+        Message_ProgressScope aChunkScope(aRanges.Value(theChunkIndex), nullptr, 1);
+        const int             aFrom = theChunkIndex * THE_NB_CHUNK_RECORDS;
+        const int             aTo   = std::min(aFrom + THE_NB_CHUNK_RECORDS, aNbNodes);
+        for (int aNodeIter = aFrom; aNodeIter < aTo; ++aNodeIter)
+        {
+          const uint8_t*           aRec = aVertData + aVertStride * size_t(aNodeIter);
+          NCollection_Vec3<float>& aPnt =
+            *reinterpret_cast<NCollection_Vec3<float>*>(aPosData + aPosStride * size_t(aNodeIter));
+          for (int aCoordIter = 0; aCoordIter < 3; ++aCoordIter)
+          {
+            aPnt[aCoordIter] = (float)readPlyNumber(aRec + aPosProps[aCoordIter]->Offset,
+                                                    aPosProps[aCoordIter]->Type);
+          }
+          if (hasNormals)
+          {
+            NCollection_Vec3<float>& aNorm = *reinterpret_cast<NCollection_Vec3<float>*>(
+              aNormData + aNormStride * size_t(aNodeIter));
+            for (int aCoordIter = 0; aCoordIter < 3; ++aCoordIter)
+            {
+              aNorm[aCoordIter] = (float)readPlyNumber(aRec + aNormProps[aCoordIter]->Offset,
+                                                       aNormProps[aCoordIter]->Type);
+            }
+          }
+          if (hasUV)
+          {
+            NCollection_Vec2<float>& aUV = *reinterpret_cast<NCollection_Vec2<float>*>(
+              aTexData + aTexStride * size_t(aNodeIter));
+            aUV.x() = (float)readPlyNumber(aRec + aUVProps[0]->Offset, aUVProps[0]->Type);
+            aUV.y() = (float)readPlyNumber(aRec + aUVProps[1]->Offset, aUVProps[1]->Type);
+          }
+          if (hasColors)
+          {
+            NCollection_Vec4<uint8_t>& aColor = *reinterpret_cast<NCollection_Vec4<uint8_t>*>(
+              aColData + aColStride * size_t(aNodeIter));
+            for (int aCompIter = 0; aCompIter < 4; ++aCompIter)
+            {
+              aColor[aCompIter] = aColorProps[aCompIter] != nullptr
+                                    ? readPlyColor(aRec + aColorProps[aCompIter]->Offset,
+                                                   aColorProps[aCompIter]->Type)
+                                    : 255;
+            }
+          }
+        }
+        aChunkScope.Next();
+      },
+      !myToParallel);
+    if (!aPS.More())
+    {
+      myPoints.Nullify();
+      return false;
+    }
+    return true;
+  }
+
+  myTriangulation = new Poly_Triangulation();
+  myTriangulation->SetDoublePrecision(aPosProps[0]->Type == PlyValueType_Float64);
+  myTriangulation->ResizeNodes(aNbNodes, false);
+  myTriangulation->ResizeTriangles(int(aNbTris), false);
+  if (hasNormals)
+  {
+    myTriangulation->AddNormals();
+  }
+  if (hasUV)
+  {
+    myTriangulation->AddUVNodes();
+  }
+
+  {
+    Message_ProgressScope                     aChunksScope(aPS.Next(), nullptr, aNbChunks);
+    NCollection_Array1<Message_ProgressRange> aRanges(0, aNbChunks - 1);
+    for (int aChunkIter = 0; aChunkIter < aNbChunks; ++aChunkIter)
+    {
+      aRanges.SetValue(aChunkIter, aChunksScope.Next());
+    }
+    OSD_Parallel::For(
+      0,
+      aNbChunks,
+      [&](int theChunkIndex) {
+        Message_ProgressScope aChunkScope(aRanges.Value(theChunkIndex), nullptr, 1);
+        const int             aFrom = theChunkIndex * THE_NB_CHUNK_RECORDS;
+        const int             aTo   = std::min(aFrom + THE_NB_CHUNK_RECORDS, aNbNodes);
+        for (int aNodeIter = aFrom; aNodeIter < aTo; ++aNodeIter)
+        {
+          const uint8_t* aRec = aVertData + aVertStride * size_t(aNodeIter);
+          myTriangulation->SetNode(
+            aNodeIter + 1,
+            gp_Pnt(readPlyNumber(aRec + aPosProps[0]->Offset, aPosProps[0]->Type),
+                   readPlyNumber(aRec + aPosProps[1]->Offset, aPosProps[1]->Type),
+                   readPlyNumber(aRec + aPosProps[2]->Offset, aPosProps[2]->Type)));
+          if (hasNormals)
+          {
+            myTriangulation->SetNormal(
+              aNodeIter + 1,
+              NCollection_Vec3<float>(
+                (float)readPlyNumber(aRec + aNormProps[0]->Offset, aNormProps[0]->Type),
+                (float)readPlyNumber(aRec + aNormProps[1]->Offset, aNormProps[1]->Type),
+                (float)readPlyNumber(aRec + aNormProps[2]->Offset, aNormProps[2]->Type)));
+          }
+          if (hasUV)
+          {
+            myTriangulation->SetUVNode(
+              aNodeIter + 1,
+              gp_Pnt2d(readPlyNumber(aRec + aUVProps[0]->Offset, aUVProps[0]->Type),
+                       readPlyNumber(aRec + aUVProps[1]->Offset, aUVProps[1]->Type)));
+          }
+        }
+        aChunkScope.Next();
+      },
+      !myToParallel);
+  }
+
+  const int         aNbFaces      = int(aFaceElem->Count);
+  const int         aNbFaceChunks = (aNbFaces + THE_NB_CHUNK_RECORDS - 1) / THE_NB_CHUNK_RECORDS;
+  std::atomic<bool> isValid(true);
+  {
+    Message_ProgressScope                     aChunksScope(aPS.Next(), nullptr, aNbFaceChunks);
+    NCollection_Array1<Message_ProgressRange> aRanges(0, aNbFaceChunks - 1);
+    for (int aChunkIter = 0; aChunkIter < aNbFaceChunks; ++aChunkIter)
+    {
+      aRanges.SetValue(aChunkIter, aChunksScope.Next());
+    }
+    OSD_Parallel::For(
+      0,
+      aNbFaceChunks,
+      [&](int theChunkIndex) {
+        Message_ProgressScope aChunkScope(aRanges.Value(theChunkIndex), nullptr, 1);
+        const int             aFrom = theChunkIndex * THE_NB_CHUNK_RECORDS;
+        const int             aTo   = std::min(aFrom + THE_NB_CHUNK_RECORDS, aNbFaces);
+        for (int aFaceIter = aFrom; aFaceIter < aTo && isValid; ++aFaceIter)
+        {
+          const bool isDecoded =
+            aTriStride != 0
+              ? decodePlyFace(aFaceData + aTriStride * size_t(aFaceIter) + aFaceList->Offset,
+                              *aFaceList,
+                              aFaceIter + 1,
+                              aNbNodes,
+                              myTriangulation)
+              : decodePlyFace(aFaceLists.Value(aFaceIter),
+                              *aFaceList,
+                              aFaceFirstTris.Value(aFaceIter),
+                              aNbNodes,
+                              myTriangulation);
+          if (!isDecoded)
+          {
+            isValid = false;
+          }
+        }
+        aChunkScope.Next();
+      },
+      !myToParallel);
+  }
+  if (!isValid)
+  {
+    myTriangulation.Nullify();
+    Message::SendFail() << "Error: PLY file '" << theName << "' defines invalid node index";
+    return false;
+  }
+  if (!aPS.More())
+  {
+    myTriangulation.Nullify();
+    return false;
+  }
+  return true;
+}
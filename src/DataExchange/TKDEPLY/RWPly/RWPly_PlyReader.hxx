@@ -0,0 +1,83 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _RWPly_PlyReader_HeaderFile
+#define _RWPly_PlyReader_HeaderFile
+
+#include <Graphic3d_ArrayOfPoints.hxx>
+#include <Message_ProgressRange.hxx>
+#include <NCollection_Sequence.hxx>
+#include <Poly_Triangulation.hxx>
+#include <TCollection_AsciiString.hxx>
+
+//! Reader of binary little-endian PLY files.
+//!
+//! The file is mapped into memory and fixed-size vertex and face records are decoded
+//! by chunks in parallel threads (see SetParallel()).
+//! File defining faces is read into Poly_Triangulation (polygons are split into triangle fans),
+//! while file defining only vertices is read as a point cloud into Graphic3d_ArrayOfPoints.
+//!
+//! Recognized vertex properties are x/y/z positions, nx/ny/nz normals,
+//! s/t (u/v, texture_u/texture_v) texture coordinates and red/green/blue/alpha colors
+//! (colors are read only into point cloud); other properties and elements are skipped.
+class RWPly_PlyReader : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(RWPly_PlyReader, Standard_Transient)
+public:
+  //! Empty constructor.
+  Standard_EXPORT RWPly_PlyReader();
+
+  //! Return TRUE if data should be decoded in parallel threads; FALSE by default.
+  bool ToParallel() const { return myToParallel; }
+
+  //! Set if data should be decoded in parallel threads.
+  void SetParallel(bool theToParallel) { myToParallel = theToParallel; }
+
+  //! Read PLY file mapped into memory.
+  //! @param[in] theFile     path to the file
+  //! @param[in] theProgress progress indicator
+  //! @return FALSE on reading error
+  Standard_EXPORT bool Read(const TCollection_AsciiString& theFile,
+                            const Message_ProgressRange&   theProgress = Message_ProgressRange());
+
+  //! Read PLY data from memory buffer.
+  //! @param[in] theData     file content
+  //! @param[in] theSize     file content size in bytes
+  //! @param[in] theName     file name for error messages
+  //! @param[in] theProgress progress indicator
+  //! @return FALSE on reading error
+  Standard_EXPORT bool ReadBuffer(const uint8_t*                 theData,
+                                  const size_t                   theSize,
+                                  const TCollection_AsciiString& theName,
+                                  const Message_ProgressRange&   theProgress);
+
+  //! Return triangulation read from the file defining faces or NULL.
+  const occ::handle<Poly_Triangulation>& Triangulation() const { return myTriangulation; }
+
+  //! Return point cloud read from the file defining no faces or NULL.
+  const occ::handle<Graphic3d_ArrayOfPoints>& Points() const { return myPoints; }
+
+  //! Return comments from the file header.
+  const NCollection_Sequence<TCollection_AsciiString>& Comments() const { return myComments; }
+
+  //! Reset results of previous reading.
+  Standard_EXPORT void Clear();
+
+private:
+  NCollection_Sequence<TCollection_AsciiString> myComments;      //!< header comments
+  occ::handle<Poly_Triangulation>               myTriangulation; //!< mesh result
+  occ::handle<Graphic3d_ArrayOfPoints>          myPoints;        //!< point cloud result
+  bool                                          myToParallel;    //!< parallel decoding flag
+};
+
+#endif // _RWPly_PlyReader_HeaderFile
@@ -13,10 +13,31 @@
 
 #include <RWPly_PlyWriterContext.hxx>
 
+#include <FSD_BinaryFile.hxx>
 #include <Message.hxx>
 #include <NCollection_IndexedMap.hxx>
 #include <OSD_FileSystem.hxx>
 
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+//! Maximum size of binary vertex record: double position, float normal and UV, uchar color.
+static const size_t THE_MAX_VERTEX_RECORD_SIZE = 64;
+
+//! Store the value in little-endian byte order and return position after it.
+template <typename Type>
+inline uint8_t* writePlyValue(uint8_t* thePos, const Type theValue)
+{
+  std::memcpy(thePos, &theValue, sizeof(Type));
+#if OCCT_BINARY_FILE_DO_INVERSE
+  std::reverse(thePos, thePos + sizeof(Type));
+#endif
+  return thePos + sizeof(Type);
+}
+} // namespace
+
 //=================================================================================================
 
 static void splitLines(const TCollection_AsciiString&                   theString,
@@ -65,6 +86,7 @@ RWPly_PlyWriterContext::RWPly_PlyWriterContext()
       myNbElems(0),
       mySurfId(0),
       myVertOffset(0),
+      myIsBinary(false),
       myIsDoublePrec(false),
       myHasNormals(false),
       myHasColors(false),
@@ -153,8 +175,8 @@ bool RWPly_PlyWriterContext::WriteHeader(
   myNbHeaderVerts = theNbNodes;
   myNbHeaderElems = theNbElems;
   *myStream << "ply\n"
-               "format ascii 1.0\n"
-               "comment Exported by Open CASCADE Technology [dev.opencascade.org]\n";
+            << (myIsBinary ? "format binary_little_endian 1.0\n" : "format ascii 1.0\n")
+            << "comment Exported by Open CASCADE Technology [dev.opencascade.org]\n";
   for (NCollection_IndexedDataMap<TCollection_AsciiString, TCollection_AsciiString>::Iterator
          aKeyValueIter(theFileInfo);
        aKeyValueIter.More();
@@ -235,6 +257,13 @@ bool RWPly_PlyWriterContext::WriteVertex(const gp_Pnt&                    thePoi
     return false;
   }
 
+  if (myIsBinary)
+  {
+    uint8_t aRecord[THE_MAX_VERTEX_RECORD_SIZE];
+    EncodeVertex(aRecord, thePoint, theNorm, theUV, theColor);
+    return WriteVertexBlock(aRecord, 1);
+  }
+
   if (myIsDoublePrec)
   {
     *myStream << (double)thePoint.X() << " " << (double)thePoint.Y() << " " << (double)thePoint.Z();
@@ -274,6 +303,13 @@ bool RWPly_PlyWriterContext::WriteTriangle(const NCollection_Vec3<int>& theTri)
     return false;
   }
 
+  if (myIsBinary)
+  {
+    uint8_t aRecord[sizeof(uint8_t) + sizeof(uint32_t) * 4];
+    EncodeTriangle(aRecord, theTri);
+    return WriteTriangleBlock(aRecord, 1);
+  }
+
   const NCollection_Vec3<int> aTri = NCollection_Vec3<int>(myVertOffset) + theTri;
   *myStream << "3 " << aTri[0] << " " << aTri[1] << " " << aTri[2];
   if (myHasSurfId)
@@ -299,12 +335,29 @@ bool RWPly_PlyWriterContext::WriteQuad(const NCollection_Vec4<int>& theQuad)
   }
 
   const NCollection_Vec4<int> aQuad = NCollection_Vec4<int>(myVertOffset) + theQuad;
-  *myStream << "4 " << aQuad[0] << " " << aQuad[1] << " " << aQuad[2] << " " << aQuad[3];
-  if (myHasSurfId)
+  if (myIsBinary)
   {
-    *myStream << " " << mySurfId;
+    uint8_t  aRecord[sizeof(uint8_t) + sizeof(uint32_t) * 5];
+    uint8_t* aPos = writePlyValue<uint8_t>(aRecord, 4);
+    for (int aNodeIter = 0; aNodeIter < 4; ++aNodeIter)
+    {
+      aPos = writePlyValue<uint32_t>(aPos, (uint32_t)aQuad[aNodeIter]);
+    }
+    if (myHasSurfId)
+    {
+      aPos = writePlyValue<uint32_t>(aPos, (uint32_t)mySurfId);
+    }
+    myStream->write((const char*)aRecord, std::streamsize(aPos - aRecord));
+  }
+  else
+  {
+    *myStream << "4 " << aQuad[0] << " " << aQuad[1] << " " << aQuad[2] << " " << aQuad[3];
+    if (myHasSurfId)
+    {
+      *myStream << " " << mySurfId;
+    }
+    *myStream << "\n";
   }
-  *myStream << "\n";
   if (++myNbElems > myNbHeaderElems)
   {
     throw Standard_OutOfRange(
@@ -312,3 +365,105 @@ bool RWPly_PlyWriterContext::WriteQuad(const NCollection_Vec4<int>& theQuad)
   }
   return myStream->good();
 }
+
+//=================================================================================================
+
+size_t RWPly_PlyWriterContext::VertexRecordSize() const
+{
+  return (myIsDoublePrec ? sizeof(double) * 3 : sizeof(float) * 3)
+         + (myHasNormals ? sizeof(float) * 3 : 0) + (myHasTexCoords ? sizeof(float) * 2 : 0)
+         + (myHasColors ? sizeof(uint8_t) * 3 : 0);
+}
+
+//=================================================================================================
+
+void RWPly_PlyWriterContext::EncodeVertex(uint8_t*                         theRecord,
+                                          const gp_Pnt&                    thePoint,
+                                          const NCollection_Vec3<float>&   theNorm,
+                                          const NCollection_Vec2<float>&   theUV,
+                                          const NCollection_Vec4<uint8_t>& theColor) const
+{
+  uint8_t* aPos = theRecord;
+  for (int aCoordIter = 1; aCoordIter <= 3; ++aCoordIter)
+  {
+    aPos = myIsDoublePrec ? writePlyValue<double>(aPos, thePoint.Coord(aCoordIter))
+                          : writePlyValue<float>(aPos, (float)thePoint.Coord(aCoordIter));
+  }
+  if (myHasNormals)
+  {
+    aPos = writePlyValue<float>(aPos, theNorm.x());
+    aPos = writePlyValue<float>(aPos, theNorm.y());
+    aPos = writePlyValue<float>(aPos, theNorm.z());
+  }
+  if (myHasTexCoords)
+  {
+    aPos = writePlyValue<float>(aPos, theUV.x());
+    aPos = writePlyValue<float>(aPos, theUV.y());
+  }
+  if (myHasColors)
+  {
+    aPos[0] = theColor.r();
+    aPos[1] = theColor.g();
+    aPos[2] = theColor.b();
+  }
+}
+
+//=================================================================================================
+
+bool RWPly_PlyWriterContext::WriteVertexBlock(const uint8_t* theData, const int theNbVerts)
+{
+  if (myStream.get() == nullptr)
+  {
+    return false;
+  }
+
+  myStream->write((const char*)theData, std::streamsize(VertexRecordSize() * size_t(theNbVerts)));
+  myNbVerts += theNbVerts;
+  if (myNbVerts > myNbHeaderVerts)
+  {
+    throw Standard_OutOfRange(
+      "RWPly_PlyWriterContext::WriteVertexBlock() - number of vertices is greater than defined");
+  }
+  return myStream->good();
+}
+
+//=================================================================================================
+
+size_t RWPly_PlyWriterContext::TriangleRecordSize() const
+{
+  return sizeof(uint8_t) + sizeof(uint32_t) * 3 + (myHasSurfId ? sizeof(uint32_t) : 0);
+}
+
+//=================================================================================================
+
+void RWPly_PlyWriterContext::EncodeTriangle(uint8_t*                     theRecord,
+                                            const NCollection_Vec3<int>& theTri) const
+{
+  uint8_t* aPos = writePlyValue<uint8_t>(theRecord, 3);
+  aPos          = writePlyValue<uint32_t>(aPos, (uint32_t)(theTri[0] + myVertOffset));
+  aPos          = writePlyValue<uint32_t>(aPos, (uint32_t)(theTri[1] + myVertOffset));
+  aPos          = writePlyValue<uint32_t>(aPos, (uint32_t)(theTri[2] + myVertOffset));
+  if (myHasSurfId)
+  {
+    writePlyValue<uint32_t>(aPos, (uint32_t)mySurfId);
+  }
+}
+
+//=================================================================================================
+
+bool RWPly_PlyWriterContext::WriteTriangleBlock(const uint8_t* theData, const int theNbTris)
+{
+  if (myStream.get() == nullptr)
+  {
+    return false;
+  }
+
+  myStream->write((const char*)theData, std::streamsize(TriangleRecordSize() * size_t(theNbTris)));
+  myNbElems += theNbTris;
+  if (myNbElems > myNbHeaderElems)
+  {
+    throw Standard_OutOfRange(
+      "RWPly_PlyWriterContext::WriteTriangleBlock() - number of elements is greater than defined");
+  }
+  return myStream->good();
+}
@@ -39,6 +39,15 @@ public:
   //! Destructor, will emit error message if file was not closed.
   Standard_EXPORT ~RWPly_PlyWriterContext();
 
+public: //! @name file format parameters
+  //! Return TRUE if file should be written in binary little-endian format;
+  //! FALSE by default (ASCII format).
+  bool IsBinary() const { return myIsBinary; }
+
+  //! Set if file should be written in binary little-endian format.
+  //! Should be set before writing the header.
+  void SetBinary(bool theIsBinary) { myIsBinary = theIsBinary; }
+
 public: //! @name vertex attributes parameters
   //! Return TRUE if vertex position should be stored with double floating point precision; FALSE by
   //! default.
@@ -102,6 +111,28 @@ public: //! @name writing into file
                                    const NCollection_Vec2<float>&   theUV,
                                    const NCollection_Vec4<uint8_t>& theColor);
 
+  //! Return size in bytes of vertex record within binary file for current vertex attributes.
+  Standard_EXPORT size_t VertexRecordSize() const;
+
+  //! Encode single point with all attributes into binary vertex record.
+  //! This method does not modify the context and can be called from concurrent threads
+  //! to fill the buffer passed to WriteVertexBlock().
+  //! @param[out] theRecord buffer of VertexRecordSize() bytes to fill
+  //! @param[in] thePoint 3D point coordinates
+  //! @param[in] theNorm  surface normal direction at the point
+  //! @param[in] theUV    surface/texture UV coordinates
+  //! @param[in] theColor RGB color values
+  Standard_EXPORT void EncodeVertex(uint8_t*                         theRecord,
+                                    const gp_Pnt&                    thePoint,
+                                    const NCollection_Vec3<float>&   theNorm,
+                                    const NCollection_Vec2<float>&   theUV,
+                                    const NCollection_Vec4<uint8_t>& theColor) const;
+
+  //! Write block of binary vertex records encoded by EncodeVertex().
+  //! @param[in] theData    records data
+  //! @param[in] theNbVerts number of records
+  Standard_EXPORT bool WriteVertexBlock(const uint8_t* theData, const int theNbVerts);
+
   //! Return number of written vertices.
   int NbWrittenVertices() const { return myNbVerts; }
 
@@ -123,6 +154,22 @@ public: //! @name writing into file
   //! Writing a quad.
   Standard_EXPORT bool WriteQuad(const NCollection_Vec4<int>& theQuad);
 
+  //! Return size in bytes of triangle record within binary file for current element attributes.
+  Standard_EXPORT size_t TriangleRecordSize() const;
+
+  //! Encode triangle into binary element record, applying VertexOffset() and SurfaceId().
+  //! This method does not modify the context and can be called from concurrent threads
+  //! to fill the buffer passed to WriteTriangleBlock().
+  //! @param[out] theRecord buffer of TriangleRecordSize() bytes to fill
+  //! @param[in] theTri triangle nodes
+  Standard_EXPORT void EncodeTriangle(uint8_t*                     theRecord,
+                                      const NCollection_Vec3<int>& theTri) const;
+
+  //! Write block of binary triangle records encoded by EncodeTriangle().
+  //! @param[in] theData   records data
+  //! @param[in] theNbTris number of records
+  Standard_EXPORT bool WriteTriangleBlock(const uint8_t* theData, const int theNbTris);
+
   //! Return number of written elements.
   int NbWrittenElements() const { return myNbElems; }
 
@@ -139,6 +186,7 @@ private:
   int                           myNbElems;
   int                           mySurfId;
   int                           myVertOffset;
+  bool                          myIsBinary;
   bool                          myIsDoublePrec;
   bool                          myHasNormals;
   bool                          myHasColors;
@@ -0,0 +1,6 @@
+# Benchmark source files for TKDESTEP
+set(OCCT_TKDESTEP_Benchmarks_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
+
+set(OCCT_TKDESTEP_Benchmarks_FILES
+  STEPControl_Benchmark.cxx
+)
@@ -0,0 +1,81 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <OSD_Environment.hxx>
+#include <OSD_File.hxx>
+#include <STEPControl_Reader.hxx>
+#include <TCollection_AsciiString.hxx>
+#include <TopoDS_Shape.hxx>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+//! Reference files within $CSF_OCCTDataPath/step.
+const char* const THE_STEP_FILES[] = {"linkrods.step", "screw.step"};
+
+//! Returns the path to the reference file or an empty string if it is missing.
+TCollection_AsciiString findDataFile(const int theIndex)
+{
+  const TCollection_AsciiString aDataPath = OSD_Environment("CSF_OCCTDataPath").Value();
+  if (aDataPath.IsEmpty())
+  {
+    return TCollection_AsciiString();
+  }
+  const TCollection_AsciiString aPath = aDataPath + "/step/" + THE_STEP_FILES[theIndex];
+  return OSD_File(OSD_Path(aPath)).Exists() ? aPath : TCollection_AsciiString();
+}
+} // namespace
+
+// Argument: index of the reference file.
+
+static void STEPControl_Reader_ReadFile(benchmark::State& theState)
+{
+  const TCollection_AsciiString aPath = findDataFile(int(theState.range(0)));
+  if (aPath.IsEmpty())
+  {
+    theState.SkipWithError("Reference file is not found, set CSF_OCCTDataPath");
+    return;
+  }
+  theState.SetLabel(THE_STEP_FILES[theState.range(0)]);
+  for (auto _ : theState)
+  {
+    STEPControl_Reader aReader;
+    benchmark::DoNotOptimize(aReader.ReadFile(aPath.ToCString()));
+  }
+}
+BENCHMARK(STEPControl_Reader_ReadFile)->DenseRange(0, 1)->Unit(benchmark::kMillisecond);
+
+static void STEPControl_Reader_Transfer(benchmark::State& theState)
+{
+  const TCollection_AsciiString aPath = findDataFile(int(theState.range(0)));
+  if (aPath.IsEmpty())
+  {
+    theState.SkipWithError("Reference file is not found, set CSF_OCCTDataPath");
+    return;
+  }
+  theState.SetLabel(THE_STEP_FILES[theState.range(0)]);
+  for (auto _ : theState)
+  {
+    STEPControl_Reader aReader;
+    if (aReader.ReadFile(aPath.ToCString()) != IFSelect_RetDone)
+    {
+      theState.SkipWithError("Reading of the reference file has failed");
+      break;
+    }
+    aReader.TransferRoots();
+    benchmark::DoNotOptimize(aReader.OneShape());
+  }
+}
+BENCHMARK(STEPControl_Reader_Transfer)->DenseRange(0, 1)->Unit(benchmark::kMillisecond);
@@ -130,6 +130,10 @@ bool DESTEP_ConfigurationNode::Load(const occ::handle<DE_ConfigurationContext>&
     theResource->BooleanVal("read.root.transformation",
                             InternalParameters.ReadRootTransformation,
                             aScope);
+  InternalParameters.ReadParallelParse =
+    theResource->BooleanVal("read.parallel.parse", InternalParameters.ReadParallelParse, aScope);
+  InternalParameters.ReadDataGraph =
+    theResource->BooleanVal("read.data.graph", InternalParameters.ReadDataGraph, aScope);
   InternalParameters.ReadColor =
     theResource->BooleanVal("read.color", InternalParameters.ReadColor, aScope);
   InternalParameters.ReadName =
@@ -142,6 +146,8 @@ bool DESTEP_ConfigurationNode::Load(const occ::handle<DE_ConfigurationContext>&
     theResource->BooleanVal("read.metadata", InternalParameters.ReadMetadata, aScope);
   InternalParameters.ReadProductMetadata =
     theResource->BooleanVal("read.productmetadata", InternalParameters.ReadProductMetadata, aScope);
+  InternalParameters.ReadMergeDuplicates =
+    theResource->BooleanVal("read.mergeduplicates", InternalParameters.ReadMergeDuplicates, aScope);
 
   InternalParameters.WritePrecisionMode =
     (DESTEP_Parameters::WriteMode_PrecisionMode)theResource->IntegerVal(
@@ -415,6 +421,18 @@ TCollection_AsciiString DESTEP_ConfigurationNode::Save() const
     aScope + "read.root.transformation :\t " + InternalParameters.ReadRootTransformation + "\n";
   aResult += "!\n";
 
+  aResult += "!\n";
+  aResult += "!Parsing of DATA section of the memory-mapped file in parallel threads\n";
+  aResult += "!Default value: 0(\"OFF\"). Available values: 0(\"OFF\"), 1(\"ON\")\n";
+  aResult += aScope + "read.parallel.parse :\t " + InternalParameters.ReadParallelParse + "\n";
+  aResult += "!\n";
+
+  aResult += "!\n";
+  aResult += "!Building of the table of references between entities from the file data\n";
+  aResult += "!Default value: 0(\"OFF\"). Available values: 0(\"OFF\"), 1(\"ON\")\n";
+  aResult += aScope + "read.data.graph :\t " + InternalParameters.ReadDataGraph + "\n";
+  aResult += "!\n";
+
   aResult += "!\n";
   aResult += "!Setting up the read.colo parameter which is used to indicate read Colors or not\n";
   aResult += "!Default value: +. Available values: \"-\", \"+\"\n";
@@ -454,6 +472,13 @@ TCollection_AsciiString DESTEP_ConfigurationNode::Save() const
   aResult += aScope + "read.productmetadata :\t " + InternalParameters.ReadProductMetadata + "\n";
   aResult += "!\n";
 
+  aResult += "!\n";
+  aResult += "!Setting up the read.mergeduplicates parameter which is used to indicate whether to "
+             "replace parts with the same geometry by instances of one part or not\n";
+  aResult += "!Default value: 0(\"OFF\"). Available values: 0(\"OFF\"), 1(\"ON\")\n";
+  aResult += aScope + "read.mergeduplicates :\t " + InternalParameters.ReadMergeDuplicates + "\n";
+  aResult += "!\n";
+
   aResult += "!\n";
   aResult += "!Write Parameters:\n";
   aResult += "!\n";
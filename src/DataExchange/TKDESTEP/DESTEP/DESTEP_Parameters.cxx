@@ -55,6 +55,8 @@ void DESTEP_Parameters::InitFromStatic()
   ReadIdeas              = Interface_Static::IVal("read.step.ideas") == 1;
   ReadAllShapes          = Interface_Static::IVal("read.step.all.shapes") == 1;
   ReadRootTransformation = Interface_Static::IVal("read.step.root.transformation") == 1;
+  ReadParallelParse      = Interface_Static::IVal("read.step.parallel.parse") == 1;
+  ReadDataGraph          = Interface_Static::IVal("read.step.data.graph") == 1;
 
   WritePrecisionMode =
     (DESTEP_Parameters::WriteMode_PrecisionMode)Interface_Static::IVal("write.precision.mode");
@@ -176,12 +176,15 @@ public:
   bool ReadIdeas = false; //<! Defines !I-Deas-like STEP processing
   bool ReadAllShapes = false; //<! Parameter to read all top level solids and shells
   bool ReadRootTransformation = true; ///<!/ Mode to variate apply or not transformation placed in the root shape representation
+  bool ReadParallelParse = false; //<! Defines parsing of the memory-mapped file in parallel threads
+  bool ReadDataGraph = false; //<! Defines building of the entity graph from the file data
   bool ReadColor = true; //<! ColorMode is used to indicate read Colors or not
   bool ReadName = true; //<! NameMode is used to indicate read Name or not
   bool ReadLayer = true; //<! LayerMode is used to indicate read Layers or not
   bool ReadProps = true; //<! PropsMode is used to indicate read Validation properties or not
   bool ReadMetadata = true; //! Parameter for metadata reading
   bool ReadProductMetadata = false; //! Parameter for product metadata reading
+  bool ReadMergeDuplicates = false; //! Parameter for replacing duplicated parts by instances of one part
   
   // Write
   WriteMode_PrecisionMode WritePrecisionMode = WriteMode_PrecisionMode_Average; //<! Specifies the mode of writing the resolution value into the STEP file
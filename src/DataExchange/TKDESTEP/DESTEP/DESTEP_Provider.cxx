@@ -18,6 +18,7 @@
 #include <DESTEP_Parameters.hxx>
 #include <Interface_Static.hxx>
 #include <Message.hxx>
+#include <Message_ProgressScope.hxx>
 #include <STEPCAFControl_Controller.hxx>
 #include <STEPCAFControl_Reader.hxx>
 #include <STEPCAFControl_Writer.hxx>
@@ -67,6 +68,7 @@ void configureSTEPCAFReader(STEPCAFControl_Reader&               theReader,
   theReader.SetPropsMode(theParams.ReadProps);
   theReader.SetMetaMode(theParams.ReadMetadata);
   theReader.SetProductMetaMode(theParams.ReadProductMetadata);
+  theReader.SetMergeDuplicatesMode(theParams.ReadMergeDuplicates);
 
   theReader.SetShapeFixParameters(theShapeFixParams);
 
@@ -176,9 +178,13 @@ bool DESTEP_Provider::Read(const TCollection_AsciiString&       thePath,
                          aNode->GlobalParameters.LengthUnit,
                          aNode->ShapeFixParameters);
 
+  Message_ProgressScope aPS(theProgress, "Reading STEP file", 2);
   IFSelect_ReturnStatus aReadStat = IFSelect_RetVoid;
   DESTEP_Parameters     aParams   = aNode->InternalParameters;
-  aReadStat                       = aReader.ReadFile(thePath.ToCString(), aParams);
+  {
+    Message_ProgressScope aParsePS(aPS.Next(), "Parsing", 1);
+    aReadStat = aReader.ReadFile(thePath.ToCString(), aParams);
+  }
 
   if (aReadStat != IFSelect_RetDone)
   {
@@ -186,8 +192,12 @@ bool DESTEP_Provider::Read(const TCollection_AsciiString&       thePath,
                         << "\t: abandon";
     return false;
   }
+  if (aPS.UserBreak())
+  {
+    return false;
+  }
 
-  if (!aReader.Transfer(theDocument, theProgress))
+  if (!aReader.Transfer(theDocument, aPS.Next()))
   {
     Message::SendFail() << "Error in the DESTEP_Provider during reading the file " << thePath
                         << "\t: Cannot read any relevant data from the STEP file";
@@ -295,9 +305,13 @@ bool DESTEP_Provider::Read(const TCollection_AsciiString&      thePath,
   STEPControl_Reader aReader;
   aReader.SetWS(theWS);
   aReader.SetShapeFixParameters(aNode->ShapeFixParameters);
-  IFSelect_ReturnStatus aReadstat        = IFSelect_RetVoid;
-  DESTEP_Parameters     aParams          = aNode->InternalParameters;
-  aReadstat                              = aReader.ReadFile(thePath.ToCString(), aParams);
+  Message_ProgressScope aPS(theProgress, "Reading STEP file", 2);
+  IFSelect_ReturnStatus aReadstat = IFSelect_RetVoid;
+  DESTEP_Parameters     aParams   = aNode->InternalParameters;
+  {
+    Message_ProgressScope aParsePS(aPS.Next(), "Parsing", 1);
+    aReadstat = aReader.ReadFile(thePath.ToCString(), aParams);
+  }
   occ::handle<StepData_StepModel> aModel = aReader.StepModel();
   if (aReadstat != IFSelect_RetDone)
   {
@@ -305,8 +319,12 @@ bool DESTEP_Provider::Read(const TCollection_AsciiString&      thePath,
                         << "\t: abandon, no model loaded";
     return false;
   }
+  if (aPS.UserBreak())
+  {
+    return false;
+  }
   aModel->SetLocalLengthUnit(aNode->GlobalParameters.LengthUnit);
-  if (aReader.TransferRoots(theProgress) <= 0)
+  if (aReader.TransferRoots(aPS.Next()) <= 0)
   {
     Message::SendFail() << "Error in the DESTEP_Provider during reading the file " << thePath
                         << "\t:Cannot read any relevant data from the STEP file";
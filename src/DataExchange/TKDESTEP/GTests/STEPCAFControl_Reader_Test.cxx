@@ -0,0 +1,86 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <Bnd_Box.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <STEPCAFControl_Reader.hxx>
+#include <STEPControl_Writer.hxx>
+#include <TDocStd_Application.hxx>
+#include <TDocStd_Document.hxx>
+#include <TopExp_Explorer.hxx>
+#include <XCAFDoc_DocumentTool.hxx>
+#include <XCAFDoc_ShapeTool.hxx>
+
+#include <sstream>
+#include <gtest/gtest.h>
+
+namespace
+{
+//! Returns the number of faces of the shape.
+int nbFaces(const TopoDS_Shape& theShape)
+{
+  int aNbFaces = 0;
+  for (TopExp_Explorer anExp(theShape, TopAbs_FACE); anExp.More(); anExp.Next())
+  {
+    ++aNbFaces;
+  }
+  return aNbFaces;
+}
+} // namespace
+
+TEST(STEPCAFControl_Reader_Test, DeferredGeometry)
+{
+  std::stringstream  aStream;
+  STEPControl_Writer aWriter;
+  ASSERT_EQ(IFSelect_RetDone,
+            aWriter.Transfer(BRepPrimAPI_MakeBox(gp_Pnt(1., 2., 3.), 10., 20., 30.).Shape(),
+                             STEPControl_AsIs));
+  ASSERT_EQ(IFSelect_RetDone, aWriter.WriteStream(aStream));
+
+  occ::handle<TDocStd_Application> anApp = new TDocStd_Application();
+  occ::handle<TDocStd_Document>    aDoc;
+  anApp->NewDocument("BinXCAF", aDoc);
+
+  STEPCAFControl_Reader aReader;
+  aReader.SetDeferredGeometryMode(true);
+  ASSERT_EQ(IFSelect_RetDone, aReader.ReadStream("box.step", aStream));
+  ASSERT_TRUE(aReader.Transfer(aDoc));
+
+  occ::handle<XCAFDoc_ShapeTool>  aSTool = XCAFDoc_DocumentTool::ShapeTool(aDoc->Main());
+  NCollection_Sequence<TDF_Label> aFreeShapes;
+  aSTool->GetFreeShapes(aFreeShapes);
+  ASSERT_EQ(1, aFreeShapes.Length());
+  const TDF_Label aLabel = aFreeShapes.First();
+
+  // the structure is there, the geometry is not yet
+  EXPECT_TRUE(aReader.HasDeferredGeometry(aLabel));
+  EXPECT_EQ(0, nbFaces(XCAFDoc_ShapeTool::GetShape(aLabel)));
+
+  Bnd_Box aBox;
+  ASSERT_TRUE(aReader.DeferredGeometryBox(aLabel, aBox));
+  ASSERT_FALSE(aBox.IsVoid());
+  double aXmin = 0., aYmin = 0., aZmin = 0., aXmax = 0., aYmax = 0., aZmax = 0.;
+  aBox.Get(aXmin, aYmin, aZmin, aXmax, aYmax, aZmax);
+  const double aGap = aBox.GetGap() + 1.e-7;
+  EXPECT_NEAR(1., aXmin, aGap);
+  EXPECT_NEAR(2., aYmin, aGap);
+  EXPECT_NEAR(3., aZmin, aGap);
+  EXPECT_NEAR(11., aXmax, aGap);
+  EXPECT_NEAR(22., aYmax, aGap);
+  EXPECT_NEAR(33., aZmax, aGap);
+
+  // translation on demand
+  EXPECT_TRUE(aReader.TransferDeferredGeometry(aLabel));
+  EXPECT_FALSE(aReader.HasDeferredGeometry(aLabel));
+  EXPECT_EQ(6, nbFaces(XCAFDoc_ShapeTool::GetShape(aLabel)));
+}
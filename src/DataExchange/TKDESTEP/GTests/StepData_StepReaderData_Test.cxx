@@ -0,0 +1,293 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <Interface_Check.hxx>
+#include <STEPControl_Reader.hxx>
+#include <StepData_Protocol.hxx>
+#include <StepData_StepModel.hxx>
+#include <StepData_StepWriter.hxx>
+#include <StepVisual_ComplexTriangulatedFace.hxx>
+#include <StepVisual_CoordinatesList.hxx>
+#include <StepVisual_TriangulatedFace.hxx>
+
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+const char THE_STEP_HEADER[] = "ISO-10303-21;\n"
+                               "HEADER;\n"
+                               "FILE_DESCRIPTION(('d'),'2;1');\n"
+                               "FILE_NAME('a','b',(''),(''),'','','');\n"
+                               "FILE_SCHEMA(('AP242_MANAGED_MODEL_BASED_3D_ENGINEERING_MIM_LF'));\n"
+                               "ENDSEC;\n"
+                               "DATA;\n";
+
+const char THE_STEP_TAIL[] = "ENDSEC;\n"
+                             "END-ISO-10303-21;\n";
+
+//! Reads the whole STEP file content into the model.
+occ::handle<StepData_StepModel> readStep(const std::string& theContent)
+{
+  std::istringstream aStream(theContent);
+  STEPControl_Reader aReader;
+  if (aReader.ReadStream("test.stp", aStream) != IFSelect_RetDone)
+  {
+    return occ::handle<StepData_StepModel>();
+  }
+  return aReader.StepModel();
+}
+
+//! Reads the records of the data section into the model.
+occ::handle<StepData_StepModel> readData(const char* theData)
+{
+  return readStep(std::string(THE_STEP_HEADER) + theData + THE_STEP_TAIL);
+}
+
+//! Writes the model into the string.
+std::string writeStep(const occ::handle<StepData_StepModel>& theModel)
+{
+  std::ostringstream  aStream;
+  StepData_StepWriter aWriter(theModel);
+  aWriter.SendModel(occ::down_cast<StepData_Protocol>(theModel->Protocol()));
+  aWriter.Print(aStream);
+  return aStream.str();
+}
+
+//! Returns the first entity of the given type in the model.
+template <class TheEntityType>
+occ::handle<TheEntityType> findEntity(const occ::handle<StepData_StepModel>& theModel)
+{
+  for (int anIter = 1; anIter <= theModel->NbEntities(); ++anIter)
+  {
+    occ::handle<TheEntityType> anEnt = occ::down_cast<TheEntityType>(theModel->Value(anIter));
+    if (!anEnt.IsNull())
+    {
+      return anEnt;
+    }
+  }
+  return occ::handle<TheEntityType>();
+}
+
+//! Returns the check filled while reading the entity.
+const occ::handle<Interface_Check>& readCheck(const occ::handle<StepData_StepModel>& theModel,
+                                              const occ::handle<Standard_Transient>& theEnt)
+{
+  return theModel->Check(theModel->Number(theEnt), true);
+}
+
+//! Writes the model, reads it back and checks that it is written once more without changes.
+occ::handle<StepData_StepModel> rewrite(const occ::handle<StepData_StepModel>& theModel)
+{
+  const std::string               aText   = writeStep(theModel);
+  occ::handle<StepData_StepModel> aModel2 = readStep(aText);
+  if (!aModel2.IsNull())
+  {
+    EXPECT_EQ(aText, writeStep(aModel2));
+  }
+  return aModel2;
+}
+} // namespace
+
+// Test that triangulated face and its coordinates are read back as written
+TEST(StepData_StepReaderDataTest, TriangulatedFace_RoundTrip)
+{
+  occ::handle<StepData_StepModel> aModel = readData(
+    "#1=COORDINATES_LIST('',4,((0.,0.,0.),(1.5,0.,0.),(1.5,2.25,0.),(0.,2.25,-0.125)));\n"
+    "#2=TRIANGULATED_FACE('f',#1,4,((0.,0.,1.)),$,(1,2,3,4),((1,2,3),(1,3,4)));\n");
+  ASSERT_FALSE(aModel.IsNull());
+  occ::handle<StepVisual_TriangulatedFace> aFace1 = findEntity<StepVisual_TriangulatedFace>(aModel);
+  ASSERT_FALSE(aFace1.IsNull());
+  ASSERT_FALSE(aFace1->Coordinates().IsNull());
+  EXPECT_FALSE(readCheck(aModel, aFace1)->HasFailed());
+  EXPECT_FALSE(readCheck(aModel, aFace1->Coordinates())->HasFailed());
+
+  occ::handle<StepData_StepModel> aModel2 = rewrite(aModel);
+  ASSERT_FALSE(aModel2.IsNull());
+  occ::handle<StepVisual_TriangulatedFace> aFace2 =
+    findEntity<StepVisual_TriangulatedFace>(aModel2);
+  ASSERT_FALSE(aFace2.IsNull());
+  ASSERT_FALSE(aFace2->Coordinates().IsNull());
+  EXPECT_FALSE(readCheck(aModel2, aFace2)->HasFailed());
+
+  occ::handle<NCollection_HArray1<gp_XYZ>> aPoints1 = aFace1->Coordinates()->Points();
+  occ::handle<NCollection_HArray1<gp_XYZ>> aPoints2 = aFace2->Coordinates()->Points();
+  ASSERT_FALSE(aPoints1.IsNull());
+  ASSERT_FALSE(aPoints2.IsNull());
+  ASSERT_EQ(4, aPoints1->Length());
+  ASSERT_EQ(4, aPoints2->Length());
+  EXPECT_DOUBLE_EQ(1.5, aPoints1->Value(2).X());
+  EXPECT_DOUBLE_EQ(2.25, aPoints1->Value(3).Y());
+  EXPECT_DOUBLE_EQ(-0.125, aPoints1->Value(4).Z());
+  for (int aPntIter = 1; aPntIter <= 4; ++aPntIter)
+  {
+    EXPECT_TRUE(aPoints1->Value(aPntIter).IsEqual(aPoints2->Value(aPntIter), 0.0));
+  }
+
+  EXPECT_EQ(4, aFace2->Pnmax());
+  ASSERT_EQ(1, aFace2->NbNormals());
+  EXPECT_EQ(3, aFace2->Normals()->NbColumns());
+  EXPECT_DOUBLE_EQ(0.0, aFace2->Normals()->Value(1, 1));
+  EXPECT_DOUBLE_EQ(1.0, aFace2->Normals()->Value(1, 3));
+  ASSERT_EQ(4, aFace2->NbPnindex());
+  for (int anIndex = 1; anIndex <= 4; ++anIndex)
+  {
+    EXPECT_EQ(anIndex, aFace2->PnindexValue(anIndex));
+  }
+  ASSERT_EQ(2, aFace2->NbTriangles());
+  EXPECT_EQ(3, aFace2->Triangles()->NbColumns());
+  EXPECT_EQ(2, aFace2->Triangles()->Value(1, 2));
+  EXPECT_EQ(3, aFace2->Triangles()->Value(2, 2));
+  EXPECT_EQ(4, aFace2->Triangles()->Value(2, 3));
+}
+
+// Test that normals array with more rows than columns is written row by row
+TEST(StepData_StepReaderDataTest, ComplexTriangulatedFace_NonSquareNormals)
+{
+  occ::handle<StepData_StepModel> aModel = readData(
+    "#1=COORDINATES_LIST('',4,((0.,0.,0.),(1.,0.,0.),(1.,1.,0.),(0.,1.,0.)));\n"
+    "#2=COMPLEX_TRIANGULATED_FACE('',#1,4,"
+    "((0.,0.,1.),(0.,0.5,0.5),(0.5,0.,0.5),(0.,-1.,0.)),$,(),((1,2,4,3)),((1,2,3),()));\n");
+  ASSERT_FALSE(aModel.IsNull());
+  occ::handle<StepVisual_ComplexTriangulatedFace> aFace1 =
+    findEntity<StepVisual_ComplexTriangulatedFace>(aModel);
+  ASSERT_FALSE(aFace1.IsNull());
+  EXPECT_FALSE(readCheck(aModel, aFace1)->HasFailed());
+
+  occ::handle<StepData_StepModel> aModel2 = rewrite(aModel);
+  ASSERT_FALSE(aModel2.IsNull());
+  occ::handle<StepVisual_ComplexTriangulatedFace> aFace2 =
+    findEntity<StepVisual_ComplexTriangulatedFace>(aModel2);
+  ASSERT_FALSE(aFace2.IsNull());
+  EXPECT_FALSE(readCheck(aModel2, aFace2)->HasFailed());
+
+  ASSERT_EQ(4, aFace2->NbNormals());
+  ASSERT_EQ(3, aFace2->Normals()->NbColumns());
+  for (int aRow = 1; aRow <= 4; ++aRow)
+  {
+    for (int aCol = 1; aCol <= 3; ++aCol)
+    {
+      EXPECT_DOUBLE_EQ(aFace1->Normals()->Value(aRow, aCol), aFace2->Normals()->Value(aRow, aCol));
+    }
+  }
+  EXPECT_DOUBLE_EQ(0.5, aFace2->Normals()->Value(3, 1));
+  EXPECT_DOUBLE_EQ(-1.0, aFace2->Normals()->Value(4, 2));
+
+  EXPECT_EQ(0, aFace2->NbPnindex());
+  ASSERT_EQ(1, aFace2->NbTriangleStrips());
+  occ::handle<NCollection_HArray1<int>> aStrip =
+    occ::down_cast<NCollection_HArray1<int>>(aFace2->TriangleStrips()->Value(1));
+  ASSERT_FALSE(aStrip.IsNull());
+  ASSERT_EQ(4, aStrip->Length());
+  EXPECT_EQ(4, aStrip->Value(3));
+  ASSERT_EQ(2, aFace2->NbTriangleFans());
+  EXPECT_FALSE(aFace2->TriangleFans()->Value(1).IsNull());
+  EXPECT_TRUE(aFace2->TriangleFans()->Value(2).IsNull());
+}
+
+// Test that empty lists are read as Null arrays without messages and written back as empty lists
+TEST(StepData_StepReaderDataTest, EmptyLists)
+{
+  occ::handle<StepData_StepModel> aModel =
+    readData("#1=COORDINATES_LIST('',0,());\n"
+             "#2=TRIANGULATED_FACE('',#1,0,(),$,(),());\n");
+  ASSERT_FALSE(aModel.IsNull());
+  occ::handle<StepVisual_TriangulatedFace> aFace = findEntity<StepVisual_TriangulatedFace>(aModel);
+  ASSERT_FALSE(aFace.IsNull());
+  ASSERT_FALSE(aFace->Coordinates().IsNull());
+  EXPECT_EQ(0, readCheck(aModel, aFace)->NbFails());
+  EXPECT_EQ(0, readCheck(aModel, aFace)->NbWarnings());
+  EXPECT_EQ(0, readCheck(aModel, aFace->Coordinates())->NbFails());
+  EXPECT_TRUE(aFace->Coordinates()->Points().IsNull());
+  EXPECT_TRUE(aFace->Normals().IsNull());
+  EXPECT_TRUE(aFace->Pnindex().IsNull());
+  EXPECT_TRUE(aFace->Triangles().IsNull());
+  EXPECT_EQ(0, aFace->NbNormals());
+  EXPECT_EQ(0, aFace->NbPnindex());
+  EXPECT_EQ(0, aFace->NbTriangles());
+
+  const std::string aText = writeStep(aModel);
+  EXPECT_NE(std::string::npos, aText.find("COORDINATES_LIST('',0,())"));
+  EXPECT_NE(std::string::npos, aText.find("(),$,(),()"));
+}
+
+// Test that plain lists given instead of lists of sub-lists are rejected
+TEST(StepData_StepReaderDataTest, NonNestedLists_Fail)
+{
+  occ::handle<StepData_StepModel> aModel =
+    readData("#1=COORDINATES_LIST('',3,((0.,0.,0.),(1.,0.,0.),(0.,1.,0.)));\n"
+             "#2=TRIANGULATED_FACE('',#1,3,(0.,0.,1.),$,(),(1,2,3));\n");
+  ASSERT_FALSE(aModel.IsNull());
+  occ::handle<StepVisual_TriangulatedFace> aFace = findEntity<StepVisual_TriangulatedFace>(aModel);
+  ASSERT_FALSE(aFace.IsNull());
+  EXPECT_EQ(2, readCheck(aModel, aFace)->NbFails());
+  EXPECT_TRUE(aFace->Normals().IsNull());
+  EXPECT_TRUE(aFace->Triangles().IsNull());
+}
+
+// Test that Real values in lists of Integers are rounded and reported
+TEST(StepData_StepReaderDataTest, RealInIntegerList_Fail)
+{
+  occ::handle<StepData_StepModel> aModel =
+    readData("#1=COORDINATES_LIST('',4,((0.,0.,0.),(1.,0.,0.),(1.,1.,0.),(0.,1.,0.)));\n"
+             "#2=TRIANGULATED_FACE('',#1,4,(),$,(1,2.,3,4),((1,2,3.),(1,3,4)));\n");
+  ASSERT_FALSE(aModel.IsNull());
+  occ::handle<StepVisual_TriangulatedFace> aFace = findEntity<StepVisual_TriangulatedFace>(aModel);
+  ASSERT_FALSE(aFace.IsNull());
+  EXPECT_EQ(2, readCheck(aModel, aFace)->NbFails());
+  ASSERT_EQ(4, aFace->NbPnindex());
+  EXPECT_EQ(2, aFace->PnindexValue(2));
+  ASSERT_EQ(2, aFace->NbTriangles());
+  EXPECT_EQ(3, aFace->Triangles()->Value(1, 3));
+  EXPECT_EQ(4, aFace->Triangles()->Value(2, 3));
+}
+
+// Test that coordinates beyond the third one are ignored with a warning
+TEST(StepData_StepReaderDataTest, ExtraCoordinates_Warning)
+{
+  occ::handle<StepData_StepModel> aModel =
+    readData("#1=COORDINATES_LIST('',2,((0.,0.,0.,7.),(1.,2.,3.)));\n");
+  ASSERT_FALSE(aModel.IsNull());
+  occ::handle<StepVisual_CoordinatesList> aList = findEntity<StepVisual_CoordinatesList>(aModel);
+  ASSERT_FALSE(aList.IsNull());
+  EXPECT_EQ(0, readCheck(aModel, aList)->NbFails());
+  EXPECT_EQ(1, readCheck(aModel, aList)->NbWarnings());
+  ASSERT_FALSE(aList->Points().IsNull());
+  ASSERT_EQ(2, aList->Points()->Length());
+  EXPECT_TRUE(aList->Points()->Value(1).IsEqual(gp_XYZ(0.0, 0.0, 0.0), 0.0));
+  EXPECT_TRUE(aList->Points()->Value(2).IsEqual(gp_XYZ(1.0, 2.0, 3.0), 0.0));
+}
+
+// Test that extreme Integer values are written and read back exactly
+TEST(StepData_StepReaderDataTest, IntegerLimits_RoundTrip)
+{
+  occ::handle<StepData_StepModel> aModel =
+    readData("#1=COORDINATES_LIST('',1,((0.,0.,0.)));\n"
+             "#2=TRIANGULATED_FACE('',#1,2147483647,(),$,(2147483647,-2147483648,0,-1,10),());\n");
+  ASSERT_FALSE(aModel.IsNull());
+
+  occ::handle<StepData_StepModel> aModel2 = rewrite(aModel);
+  ASSERT_FALSE(aModel2.IsNull());
+  occ::handle<StepVisual_TriangulatedFace> aFace = findEntity<StepVisual_TriangulatedFace>(aModel2);
+  ASSERT_FALSE(aFace.IsNull());
+  EXPECT_EQ(0, readCheck(aModel2, aFace)->NbFails());
+  EXPECT_EQ(2147483647, aFace->Pnmax());
+  ASSERT_EQ(5, aFace->NbPnindex());
+  EXPECT_EQ(2147483647, aFace->PnindexValue(1));
+  EXPECT_EQ(-2147483647 - 1, aFace->PnindexValue(2));
+  EXPECT_EQ(0, aFace->PnindexValue(3));
+  EXPECT_EQ(-1, aFace->PnindexValue(4));
+  EXPECT_EQ(10, aFace->PnindexValue(5));
+}
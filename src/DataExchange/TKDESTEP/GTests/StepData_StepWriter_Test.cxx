@@ -11,9 +11,15 @@
 // Alternatively, this file may be used under the terms of Open CASCADE
 // commercial license or contractual agreement.
 
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <STEPControl_Writer.hxx>
+#include <StepData_Protocol.hxx>
+#include <StepData_StepModel.hxx>
 #include <StepData_StepWriter.hxx>
 #include <TCollection_AsciiString.hxx>
 
+#include <sstream>
+
 #include <gtest/gtest.h>
 
 // Test CleanTextForSend with basic character escaping
@@ -157,4 +163,31 @@ TEST(StepData_StepWriterTest, CleanTextForSend_HexSequenceDetection)
   TCollection_AsciiString anInput3("start \\X2\\03C0\\X0\\ end");
   TCollection_AsciiString aResult3 = StepData_StepWriter::CleanTextForSend(anInput3);
   EXPECT_STREQ(aResult3.ToCString(), "start \\X2\\03C0\\X0\\ end");
-}
\ No newline at end of file
+}
+
+// Test that lines sent to the stream as soon as completed give the same file
+TEST(StepData_StepWriterTest, StreamGivesSameResult)
+{
+  STEPControl_Writer aStepWriter;
+  ASSERT_EQ(IFSelect_RetDone,
+            aStepWriter.Transfer(BRepPrimAPI_MakeBox(10., 20., 30.).Shape(), STEPControl_AsIs));
+  occ::handle<StepData_StepModel> aModel    = aStepWriter.Model();
+  occ::handle<StepData_Protocol>  aProtocol = occ::down_cast<StepData_Protocol>(aModel->Protocol());
+  ASSERT_FALSE(aProtocol.IsNull());
+
+  std::ostringstream  aPrinted;
+  StepData_StepWriter aWriter1(aModel);
+  aWriter1.SendModel(aProtocol);
+  EXPECT_GT(aWriter1.NbLines(), 0);
+  EXPECT_TRUE(aWriter1.Print(aPrinted));
+
+  std::ostringstream  aStreamed;
+  StepData_StepWriter aWriter2(aModel);
+  aWriter2.SetStream(&aStreamed);
+  aWriter2.SendModel(aProtocol);
+  EXPECT_EQ(0, aWriter2.NbLines());
+  EXPECT_TRUE(aWriter2.Print(aStreamed));
+
+  EXPECT_FALSE(aStreamed.str().empty());
+  EXPECT_EQ(aPrinted.str(), aStreamed.str());
+}
@@ -0,0 +1,187 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <gtest/gtest.h>
+
+#include <StepFile_ParallelReader.hxx>
+
+#include <cstring>
+#include <string>
+
+namespace
+{
+const char THE_STEP_HEADER[] = "ISO-10303-21;\n"
+                               "HEADER;\n"
+                               "FILE_DESCRIPTION(('d'),'2;1');\n"
+                               "FILE_NAME('a','b',(''),(''),'','','');\n"
+                               "FILE_SCHEMA(('CONFIG_CONTROL_DESIGN'));\n"
+                               "ENDSEC;\n"
+                               "DATA;\n";
+
+const char THE_STEP_TAIL[] = "ENDSEC;\n"
+                             "END-ISO-10303-21;\n";
+
+//! Checks the identifier, the type and the number of parameters of the record.
+void checkRecord(const StepFile_ParallelReader& theReader,
+                 const int                      theNum,
+                 const char*                    theIdent,
+                 const char*                    theType,
+                 const int                      theNbParams)
+{
+  const StepFile_ParallelReader::Record& aRecord = theReader.RecordDescription(theNum);
+  EXPECT_STREQ(theIdent, aRecord.Ident) << "record " << theNum;
+  EXPECT_STREQ(theType, aRecord.Type) << "record " << theNum;
+  EXPECT_EQ(theNbParams, aRecord.NbParams) << "record " << theNum;
+}
+
+//! Checks the value and the type of the parameter.
+void checkParam(const StepFile_ParallelReader& theReader,
+                const int                      theNum,
+                const int                      theParam,
+                const char*                    theValue,
+                const Interface_ParamType      theType)
+{
+  const StepFile_ParallelReader::Parameter& aParam = theReader.ParamDescription(theNum, theParam);
+  EXPECT_STREQ(theValue, aParam.Value) << "record " << theNum << " param " << theParam;
+  EXPECT_EQ(theType, aParam.Type) << "record " << theNum << " param " << theParam;
+}
+} // namespace
+
+TEST(StepFile_ParallelReader_Test, RecordsAndParameters)
+{
+  const std::string aContent = std::string(THE_STEP_HEADER)
+                               + "#1=CARTESIAN_POINT('p;#5=X(1);',(0.,1.E-3,-2.));\n"
+                                 "/* comment */\n"
+                                 "#2=(A(1)B((2,3),$)C());\n"
+                                 "#3=X(*,.T.,\"0F\",MEASURE(1.5),#1);\n"
+                               + THE_STEP_TAIL;
+
+  StepFile_ParallelReader aReader;
+  aReader.LoadBuffer(aContent.c_str(), aContent.size());
+  ASSERT_TRUE(aReader.Perform());
+  EXPECT_EQ(7, aReader.NbHeaderRecords());
+  ASSERT_EQ(15, aReader.NbRecords());
+  EXPECT_EQ(30, aReader.NbParams());
+
+  // header with sub-lists
+  checkRecord(aReader, 1, "$1", "/* (SUB) */", 1);
+  checkRecord(aReader, 2, "#0", "FILE_DESCRIPTION", 2);
+  checkParam(aReader, 2, 1, "$1", Interface_ParamSub);
+  checkParam(aReader, 2, 2, "'2;1'", Interface_ParamText);
+
+  // string containing the entity boundary
+  checkRecord(aReader, 8, "$1", "/* (SUB) */", 3);
+  checkParam(aReader, 8, 2, "1.E-3", Interface_ParamReal);
+  checkRecord(aReader, 9, "#1", "CARTESIAN_POINT", 2);
+  checkParam(aReader, 9, 1, "'p;#5=X(1);'", Interface_ParamText);
+
+  // complex entity
+  checkRecord(aReader, 10, "#2", "A", 1);
+  checkRecord(aReader, 11, "$1", "/* (SUB) */", 2);
+  checkRecord(aReader, 12, "#0", "B", 2);
+  checkParam(aReader, 12, 2, "$", Interface_ParamVoid);
+  checkRecord(aReader, 13, "#0", "C", 0);
+
+  // typed parameter and other kinds of parameters
+  checkRecord(aReader, 14, "$1", "MEASURE", 1);
+  checkRecord(aReader, 15, "#3", "X", 5);
+  checkParam(aReader, 15, 1, "*", Interface_ParamMisc);
+  checkParam(aReader, 15, 2, ".T.", Interface_ParamEnum);
+  checkParam(aReader, 15, 3, "\"0F\"", Interface_ParamHexa);
+  checkParam(aReader, 15, 4, "$1", Interface_ParamSub);
+  checkParam(aReader, 15, 5, "#1", Interface_ParamIdent);
+}
+
+TEST(StepFile_ParallelReader_Test, ParallelGivesSameResult)
+{
+  // several megabytes of data to be split into chunks,
+  // with strings looking like entity boundaries
+  std::string aContent = THE_STEP_HEADER;
+  for (int anIter = 1; anIter <= 40000; ++anIter)
+  {
+    const std::string anId = std::to_string(anIter);
+    aContent += "#" + anId + "=CARTESIAN_POINT('name;\n#" + anId + "=FAKE(1);',(" + anId
+                + ".,0.5,-1.E-2));\n";
+    aContent += "#" + anId + "0=(LENGTH_UNIT()NAMED_UNIT(*)SI_UNIT(.MILLI.,.METRE.));\n";
+  }
+  aContent += THE_STEP_TAIL;
+
+  StepFile_ParallelReader aSequential;
+  aSequential.LoadBuffer(aContent.c_str(), aContent.size());
+  ASSERT_TRUE(aSequential.Perform(false));
+
+  StepFile_ParallelReader aParallel;
+  aParallel.LoadBuffer(aContent.c_str(), aContent.size());
+  ASSERT_TRUE(aParallel.Perform(true));
+  EXPECT_GT(aParallel.NbChunks(), 1);
+
+  ASSERT_EQ(aSequential.NbRecords(), aParallel.NbRecords());
+  ASSERT_EQ(aSequential.NbParams(), aParallel.NbParams());
+  EXPECT_EQ(7 + 40000 * 5, aParallel.NbRecords());
+  for (int aRecIter = 1; aRecIter <= aParallel.NbRecords(); ++aRecIter)
+  {
+    const StepFile_ParallelReader::Record& aRecord = aSequential.RecordDescription(aRecIter);
+    checkRecord(aParallel, aRecIter, aRecord.Ident, aRecord.Type, aRecord.NbParams);
+    for (int aParIter = 1; aParIter <= aRecord.NbParams; ++aParIter)
+    {
+      const StepFile_ParallelReader::Parameter& aParam =
+        aSequential.ParamDescription(aRecIter, aParIter);
+      checkParam(aParallel, aRecIter, aParIter, aParam.Value, aParam.Type);
+    }
+    if (::testing::Test::HasFailure())
+    {
+      break;
+    }
+  }
+}
+
+TEST(StepFile_ParallelReader_Test, UnsupportedContent)
+{
+  // scopes are left to the flex/bison parser
+  const std::string aScope = std::string(THE_STEP_HEADER) + "#1=A(1);\n"
+                             + "#2=B(#1)&SCOPE\n#3=C();\nENDSCOPE;\n" + THE_STEP_TAIL;
+  StepFile_ParallelReader aReader;
+  aReader.LoadBuffer(aScope.c_str(), aScope.size());
+  EXPECT_FALSE(aReader.Perform());
+
+  // syntax error: missing closing parenthesis
+  const std::string anError = std::string(THE_STEP_HEADER) + "#1=A(1;\n" + THE_STEP_TAIL;
+  aReader.LoadBuffer(anError.c_str(), anError.size());
+  EXPECT_FALSE(aReader.Perform());
+
+  // the content remains available for another parser
+  EXPECT_EQ(anError.c_str(), aReader.Data());
+  EXPECT_EQ(anError.size(), aReader.Size());
+}
+
+TEST(StepFile_ParallelReader_Test, CaseOfLiterals)
+{
+  // exponent, enumeration and hexadecimal value are accepted in upper case only, as by flex
+  StepFile_ParallelReader aReader;
+  const std::string       anUpper =
+    std::string(THE_STEP_HEADER) + "#1=X(1.5E-3,.T.,\"0F\",lower_type(1));\n" + THE_STEP_TAIL;
+  aReader.LoadBuffer(anUpper.c_str(), anUpper.size());
+  ASSERT_TRUE(aReader.Perform());
+  checkParam(aReader, 9, 1, "1.5E-3", Interface_ParamReal);
+  checkParam(aReader, 9, 2, ".T.", Interface_ParamEnum);
+  checkParam(aReader, 9, 3, "\"0F\"", Interface_ParamHexa);
+  checkRecord(aReader, 8, "$1", "lower_type", 1);
+
+  for (const char* aLiteral : {"1.5e-3", ".t.", "\"0f\""})
+  {
+    const std::string aLower =
+      std::string(THE_STEP_HEADER) + "#1=X(" + aLiteral + ");\n" + THE_STEP_TAIL;
+    aReader.LoadBuffer(aLower.c_str(), aLower.size());
+    EXPECT_FALSE(aReader.Perform()) << aLiteral;
+  }
+}
@@ -0,0 +1,125 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include "StepTidy_BaseTestFixture.pxx"
+
+#include <StepTidy_BSplineCurveWithKnotsReducer.pxx>
+
+#include <StepShape_EdgeCurve.hxx>
+#include <StepRepr_DefinitionalRepresentation.hxx>
+#include <StepRepr_RepresentationContext.hxx>
+
+class StepTidy_BSplineCurveWithKnotsReducerTest : public StepTidy_BaseTestFixture
+{
+protected:
+  //! Perform removal of duplicate entities.
+  NCollection_Map<occ::handle<Standard_Transient>> replaceDuplicateBSplineCurves()
+  {
+    StepTidy_BSplineCurveWithKnotsReducer aReducer(myWS);
+    for (int anIndex = 1; anIndex <= myWS->Model()->NbEntities(); ++anIndex)
+    {
+      aReducer.ProcessEntity(myWS->Model()->Value(anIndex));
+    }
+
+    NCollection_Map<occ::handle<Standard_Transient>> aRemovedEntities;
+    aReducer.Perform(aRemovedEntities);
+    return aRemovedEntities;
+  }
+
+  //! Add an edge curve containing the curve to the model.
+  void addEdgeCurve(const occ::handle<StepGeom_BSplineCurveWithKnots>& theCurve) const
+  {
+    occ::handle<StepShape_EdgeCurve> anEdgeCurve = new StepShape_EdgeCurve;
+    anEdgeCurve->Init(new TCollection_HAsciiString,
+                      new StepShape_Vertex,
+                      new StepShape_Vertex,
+                      theCurve,
+                      true);
+    addToModel(anEdgeCurve);
+  }
+};
+
+// Check that B-spline curves with the same control points and different names are not merged.
+TEST_F(StepTidy_BSplineCurveWithKnotsReducerTest, DifferentNames)
+{
+  addEdgeCurve(addBSplineCurveWithKnots("Curve1"));
+  addEdgeCurve(addBSplineCurveWithKnots("Curve2"));
+
+  // Performing removal of duplicate B-spline curves.
+  NCollection_Map<occ::handle<Standard_Transient>> aRemovedEntities =
+    replaceDuplicateBSplineCurves();
+
+  // Check that nothing was removed.
+  EXPECT_TRUE(aRemovedEntities.IsEmpty());
+}
+
+// Check that B-spline curves with different control points are not merged.
+TEST_F(StepTidy_BSplineCurveWithKnotsReducerTest, DifferentControlPoints)
+{
+  addEdgeCurve(addBSplineCurveWithKnots(nullptr, 0.));
+  addEdgeCurve(addBSplineCurveWithKnots(nullptr, 1.e-6));
+
+  // Performing removal of duplicate B-spline curves.
+  NCollection_Map<occ::handle<Standard_Transient>> aRemovedEntities =
+    replaceDuplicateBSplineCurves();
+
+  // Check that nothing was removed.
+  EXPECT_TRUE(aRemovedEntities.IsEmpty());
+}
+
+// Check that equal B-spline curves are merged for StepShape_EdgeCurve.
+TEST_F(StepTidy_BSplineCurveWithKnotsReducerTest, StepShape_EdgeCurve)
+{
+  // Creating B-spline curves.
+  occ::handle<StepGeom_BSplineCurveWithKnots> aCurve1 = addBSplineCurveWithKnots();
+  occ::handle<StepGeom_BSplineCurveWithKnots> aCurve2 = addBSplineCurveWithKnots();
+  addEdgeCurve(aCurve1);
+  addEdgeCurve(aCurve2);
+
+  // Performing removal of duplicate B-spline curves.
+  NCollection_Map<occ::handle<Standard_Transient>> aRemovedEntities =
+    replaceDuplicateBSplineCurves();
+
+  // Check that one B-spline curve was removed.
+  EXPECT_EQ(aRemovedEntities.Size(), 1);
+  EXPECT_TRUE(aRemovedEntities.Contains(aCurve1) || aRemovedEntities.Contains(aCurve2));
+}
+
+// Check that equal B-spline curves are merged for StepRepr_DefinitionalRepresentation.
+TEST_F(StepTidy_BSplineCurveWithKnotsReducerTest, StepRepr_DefinitionalRepresentation)
+{
+  // Creating B-spline curves.
+  occ::handle<StepGeom_BSplineCurveWithKnots> aCurve1 = addBSplineCurveWithKnots();
+  occ::handle<StepGeom_BSplineCurveWithKnots> aCurve2 = addBSplineCurveWithKnots();
+
+  // Creating DefinitionalRepresentation containing both B-spline curves.
+  occ::handle<NCollection_HArray1<occ::handle<StepRepr_RepresentationItem>>> anItems =
+    new NCollection_HArray1<occ::handle<StepRepr_RepresentationItem>>(1, 2);
+  anItems->SetValue(1, aCurve1);
+  anItems->SetValue(2, aCurve2);
+  occ::handle<StepRepr_DefinitionalRepresentation> aDefinitionalRepresentation =
+    new StepRepr_DefinitionalRepresentation;
+  aDefinitionalRepresentation->Init(new TCollection_HAsciiString,
+                                    anItems,
+                                    new StepRepr_RepresentationContext);
+  addToModel(aDefinitionalRepresentation);
+
+  // Performing removal of duplicate B-spline curves.
+  NCollection_Map<occ::handle<Standard_Transient>> aRemovedEntities =
+    replaceDuplicateBSplineCurves();
+
+  // Check that one B-spline curve was removed and both items refer to the remaining one.
+  EXPECT_EQ(aRemovedEntities.Size(), 1);
+  EXPECT_EQ(anItems->Value(1), anItems->Value(2));
+}
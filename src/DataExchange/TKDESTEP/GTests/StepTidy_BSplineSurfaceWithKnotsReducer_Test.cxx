@@ -0,0 +1,112 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include "StepTidy_BaseTestFixture.pxx"
+
+#include <StepTidy_BSplineSurfaceWithKnotsReducer.pxx>
+
+#include <StepShape_AdvancedFace.hxx>
+#include <StepGeom_Pcurve.hxx>
+#include <StepRepr_DefinitionalRepresentation.hxx>
+
+class StepTidy_BSplineSurfaceWithKnotsReducerTest : public StepTidy_BaseTestFixture
+{
+protected:
+  //! Perform removal of duplicate entities.
+  NCollection_Map<occ::handle<Standard_Transient>> replaceDuplicateBSplineSurfaces()
+  {
+    StepTidy_BSplineSurfaceWithKnotsReducer aReducer(myWS);
+    for (int anIndex = 1; anIndex <= myWS->Model()->NbEntities(); ++anIndex)
+    {
+      aReducer.ProcessEntity(myWS->Model()->Value(anIndex));
+    }
+
+    NCollection_Map<occ::handle<Standard_Transient>> aRemovedEntities;
+    aReducer.Perform(aRemovedEntities);
+    return aRemovedEntities;
+  }
+
+  //! Add an advanced face lying on the surface to the model.
+  void addAdvancedFace(const occ::handle<StepGeom_Surface>& theSurface) const
+  {
+    occ::handle<StepShape_AdvancedFace> anAdvancedFace = new StepShape_AdvancedFace;
+    anAdvancedFace->Init(new TCollection_HAsciiString,
+                         new NCollection_HArray1<occ::handle<StepShape_FaceBound>>,
+                         theSurface,
+                         true);
+    addToModel(anAdvancedFace);
+  }
+};
+
+// Check that B-spline surfaces with different control points are not merged.
+TEST_F(StepTidy_BSplineSurfaceWithKnotsReducerTest, DifferentControlPoints)
+{
+  addAdvancedFace(addBSplineSurfaceWithKnots(nullptr, 0.));
+  addAdvancedFace(addBSplineSurfaceWithKnots(nullptr, 1.));
+
+  // Performing removal of duplicate B-spline surfaces.
+  NCollection_Map<occ::handle<Standard_Transient>> aRemovedEntities =
+    replaceDuplicateBSplineSurfaces();
+
+  // Check that nothing was removed.
+  EXPECT_TRUE(aRemovedEntities.IsEmpty());
+}
+
+// Check that equal B-spline surfaces are merged for StepShape_AdvancedFace.
+TEST_F(StepTidy_BSplineSurfaceWithKnotsReducerTest, StepShape_AdvancedFace)
+{
+  // Creating B-spline surfaces.
+  occ::handle<StepGeom_BSplineSurfaceWithKnots> aSurface1 = addBSplineSurfaceWithKnots();
+  occ::handle<StepGeom_BSplineSurfaceWithKnots> aSurface2 = addBSplineSurfaceWithKnots();
+  addAdvancedFace(aSurface1);
+  addAdvancedFace(aSurface2);
+
+  // Performing removal of duplicate B-spline surfaces.
+  NCollection_Map<occ::handle<Standard_Transient>> aRemovedEntities =
+    replaceDuplicateBSplineSurfaces();
+
+  // Check that one B-spline surface was removed.
+  EXPECT_EQ(aRemovedEntities.Size(), 1);
+  EXPECT_TRUE(aRemovedEntities.Contains(aSurface1) || aRemovedEntities.Contains(aSurface2));
+}
+
+// Check that equal B-spline surfaces are merged for StepGeom_Pcurve.
+TEST_F(StepTidy_BSplineSurfaceWithKnotsReducerTest, StepGeom_Pcurve)
+{
+  // Creating B-spline surfaces.
+  occ::handle<StepGeom_BSplineSurfaceWithKnots> aSurface1 = addBSplineSurfaceWithKnots();
+  occ::handle<StepGeom_BSplineSurfaceWithKnots> aSurface2 = addBSplineSurfaceWithKnots();
+
+  // Creating StepGeom_Pcurve on the first B-spline surface.
+  occ::handle<StepGeom_Pcurve> aFirstPcurve = new StepGeom_Pcurve;
+  aFirstPcurve->Init(new TCollection_HAsciiString,
+                     aSurface1,
+                     new StepRepr_DefinitionalRepresentation);
+  addToModel(aFirstPcurve);
+
+  // Creating StepGeom_Pcurve on the second B-spline surface.
+  occ::handle<StepGeom_Pcurve> aSecondPcurve = new StepGeom_Pcurve;
+  aSecondPcurve->Init(new TCollection_HAsciiString,
+                      aSurface2,
+                      new StepRepr_DefinitionalRepresentation);
+  addToModel(aSecondPcurve);
+
+  // Performing removal of duplicate B-spline surfaces.
+  NCollection_Map<occ::handle<Standard_Transient>> aRemovedEntities =
+    replaceDuplicateBSplineSurfaces();
+
+  // Check that one B-spline surface was removed.
+  EXPECT_EQ(aRemovedEntities.Size(), 1);
+  EXPECT_EQ(aFirstPcurve->BasisSurface(), aSecondPcurve->BasisSurface());
+}
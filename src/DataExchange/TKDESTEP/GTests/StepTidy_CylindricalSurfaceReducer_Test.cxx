@@ -0,0 +1,80 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include "StepTidy_BaseTestFixture.pxx"
+
+#include <StepTidy_CylindricalSurfaceReducer.pxx>
+
+#include <StepShape_AdvancedFace.hxx>
+
+class StepTidy_CylindricalSurfaceReducerTest : public StepTidy_BaseTestFixture
+{
+protected:
+  //! Perform removal of duplicate entities.
+  NCollection_Map<occ::handle<Standard_Transient>> replaceDuplicateCylindricalSurfaces()
+  {
+    StepTidy_CylindricalSurfaceReducer aReducer(myWS);
+    for (int anIndex = 1; anIndex <= myWS->Model()->NbEntities(); ++anIndex)
+    {
+      aReducer.ProcessEntity(myWS->Model()->Value(anIndex));
+    }
+
+    NCollection_Map<occ::handle<Standard_Transient>> aRemovedEntities;
+    aReducer.Perform(aRemovedEntities);
+    return aRemovedEntities;
+  }
+
+  //! Add an advanced face lying on the surface to the model.
+  void addAdvancedFace(const occ::handle<StepGeom_Surface>& theSurface) const
+  {
+    occ::handle<StepShape_AdvancedFace> anAdvancedFace = new StepShape_AdvancedFace;
+    anAdvancedFace->Init(new TCollection_HAsciiString,
+                         new NCollection_HArray1<occ::handle<StepShape_FaceBound>>,
+                         theSurface,
+                         true);
+    addToModel(anAdvancedFace);
+  }
+};
+
+// Check that cylindrical surfaces with different radii are not merged.
+TEST_F(StepTidy_CylindricalSurfaceReducerTest, DifferentRadii)
+{
+  addAdvancedFace(addCylindricalSurface(nullptr, 1.));
+  addAdvancedFace(addCylindricalSurface(nullptr, 2.));
+
+  // Performing removal of duplicate cylindrical surfaces.
+  NCollection_Map<occ::handle<Standard_Transient>> aRemovedEntities =
+    replaceDuplicateCylindricalSurfaces();
+
+  // Check that nothing was removed.
+  EXPECT_TRUE(aRemovedEntities.IsEmpty());
+}
+
+// Check that equal cylindrical surfaces are merged for StepShape_AdvancedFace.
+TEST_F(StepTidy_CylindricalSurfaceReducerTest, StepShape_AdvancedFace)
+{
+  // Creating cylindrical surfaces.
+  occ::handle<StepGeom_CylindricalSurface> aSurface1 = addCylindricalSurface();
+  occ::handle<StepGeom_CylindricalSurface> aSurface2 = addCylindricalSurface();
+  addAdvancedFace(aSurface1);
+  addAdvancedFace(aSurface2);
+
+  // Performing removal of duplicate cylindrical surfaces.
+  NCollection_Map<occ::handle<Standard_Transient>> aRemovedEntities =
+    replaceDuplicateCylindricalSurfaces();
+
+  // Check that one cylindrical surface was removed.
+  EXPECT_EQ(aRemovedEntities.Size(), 1);
+  EXPECT_TRUE(aRemovedEntities.Contains(aSurface1) || aRemovedEntities.Contains(aSurface2));
+}
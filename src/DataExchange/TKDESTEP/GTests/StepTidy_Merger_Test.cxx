@@ -16,6 +16,7 @@
 #include <StepTidy_DuplicateCleaner.hxx>
 
 #include <StepGeom_Axis1Placement.hxx>
+#include <StepShape_EdgeCurve.hxx>
 
 class StepTidy_DuplicateCleanerTest : public StepTidy_BaseTestFixture
 {
@@ -37,10 +38,12 @@ protected:
   }
 
   //! Perform removal of duplicate entities points.
-  void performRemoval()
+  //! @return the number of removed duplicate entities.
+  int performRemoval()
   {
     StepTidy_DuplicateCleaner aMerger(myWS);
     aMerger.Perform();
+    return aMerger.NbRemovedEntities();
   }
 };
 
@@ -111,3 +114,35 @@ TEST_F(StepTidy_DuplicateCleanerTest, EqualEntities)
   EXPECT_EQ(aDirectionCountBefore, 2);
   EXPECT_EQ(aDirectionCountAfter, 1);
 }
+
+// Check that equal B-spline curves are merged together with their control points.
+TEST_F(StepTidy_DuplicateCleanerTest, EqualBSplineCurves)
+{
+  // Creating edge curves containing equal B-spline curves.
+  for (int anIndex = 0; anIndex < 2; ++anIndex)
+  {
+    occ::handle<StepShape_EdgeCurve> anEdgeCurve = new StepShape_EdgeCurve;
+    anEdgeCurve->Init(new TCollection_HAsciiString,
+                      new StepShape_Vertex,
+                      new StepShape_Vertex,
+                      addBSplineCurveWithKnots(),
+                      true);
+    addToModel(anEdgeCurve);
+  }
+
+  const int aCurveCountBefore = getEntitiesCount(STANDARD_TYPE(StepGeom_BSplineCurveWithKnots));
+  const int aPointCountBefore = getEntitiesCount(STANDARD_TYPE(StepGeom_CartesianPoint));
+
+  // Performing removal of duplicate entities.
+  const int aNbRemoved = performRemoval();
+
+  const int aCurveCountAfter = getEntitiesCount(STANDARD_TYPE(StepGeom_BSplineCurveWithKnots));
+  const int aPointCountAfter = getEntitiesCount(STANDARD_TYPE(StepGeom_CartesianPoint));
+
+  // Check that one curve and its four control points were removed.
+  EXPECT_EQ(aCurveCountBefore, 2);
+  EXPECT_EQ(aCurveCountAfter, 1);
+  EXPECT_EQ(aPointCountBefore, 8);
+  EXPECT_EQ(aPointCountAfter, 4);
+  EXPECT_EQ(aNbRemoved, 5);
+}
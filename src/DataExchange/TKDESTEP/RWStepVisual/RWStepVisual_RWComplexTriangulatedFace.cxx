@@ -67,27 +67,11 @@ void RWStepVisual_RWComplexTriangulatedFace::ReadStep(
   theData->ReadInteger(theNum, 3, "tessellated_face.pnmax", theCheck, aTessellatedFace_Pnmax);
 
   occ::handle<NCollection_HArray2<double>> aTessellatedFace_Normals;
-  int                                      sub4 = 0;
-  if (theData->ReadSubList(theNum, 4, "tessellated_face.normals", theCheck, sub4))
-  {
-    int nb0                  = theData->NbParams(sub4);
-    int nbj0                 = theData->NbParams(theData->ParamNumber(sub4, 1));
-    aTessellatedFace_Normals = new NCollection_HArray2<double>(1, nb0, 1, nbj0);
-    for (int i0 = 1; i0 <= nb0; i0++)
-    {
-      int subj4 = 0;
-      if (theData->ReadSubList(sub4, i0, "sub-part(tessellated_face.normals)", theCheck, subj4))
-      {
-        int num4 = subj4;
-        for (int j0 = 1; j0 <= nbj0; j0++)
-        {
-          double anIt0;
-          theData->ReadReal(num4, j0, "real", theCheck, anIt0);
-          aTessellatedFace_Normals->SetValue(i0, j0, anIt0);
-        }
-      }
-    }
-  }
+  theData->ReadRealArray2(theNum,
+                          4,
+                          "tessellated_face.normals",
+                          theCheck,
+                          aTessellatedFace_Normals);
 
   StepVisual_FaceOrSurface aTessellatedFace_GeometricLink;
   bool                     hasTessellatedFace_GeometricLink = true;
@@ -108,19 +92,7 @@ void RWStepVisual_RWComplexTriangulatedFace::ReadStep(
   // Own fields of ComplexTriangulatedFace
 
   occ::handle<NCollection_HArray1<int>> aPnindex;
-  int                                   sub6 = 0;
-  if (theData->ReadSubList(theNum, 6, "pnindex", theCheck, sub6))
-  {
-    int nb0  = theData->NbParams(sub6);
-    aPnindex = new NCollection_HArray1<int>(1, nb0);
-    int num2 = sub6;
-    for (int i0 = 1; i0 <= nb0; i0++)
-    {
-      int anIt0;
-      theData->ReadInteger(num2, i0, "integer", theCheck, anIt0);
-      aPnindex->SetValue(i0, anIt0);
-    }
-  }
+  theData->ReadIntegerArray(theNum, 6, "pnindex", theCheck, aPnindex);
 
   occ::handle<NCollection_HArray1<occ::handle<Standard_Transient>>> aTriangleStrips;
   int                                                               sub7 = 0;
@@ -130,21 +102,13 @@ void RWStepVisual_RWComplexTriangulatedFace::ReadStep(
     aTriangleStrips = new NCollection_HArray1<occ::handle<Standard_Transient>>(1, nb0);
     for (int i0 = 1; i0 <= nb0; i0++)
     {
-      int nbj0 = theData->NbParams(theData->ParamNumber(sub7, i0));
-      occ::handle<NCollection_HArray1<int>> aSingleTriangleStrip =
-        new NCollection_HArray1<int>(1, nbj0);
-      int subj7 = 0;
-      if (theData->ReadSubList(sub7, i0, "sub-part(triangle_strips)", theCheck, subj7))
-      {
-        int num4 = subj7;
-        for (int j0 = 1; j0 <= nbj0; j0++)
-        {
-          int anIt0;
-          theData->ReadInteger(num4, j0, "integer", theCheck, anIt0);
-          aSingleTriangleStrip->SetValue(j0, anIt0);
-        }
-        aTriangleStrips->SetValue(i0, aSingleTriangleStrip);
-      }
+      occ::handle<NCollection_HArray1<int>> aSingleTriangleStrip;
+      theData->ReadIntegerArray(sub7,
+                                i0,
+                                "sub-part(triangle_strips)",
+                                theCheck,
+                                aSingleTriangleStrip);
+      aTriangleStrips->SetValue(i0, aSingleTriangleStrip);
     }
   }
 
@@ -156,21 +120,9 @@ void RWStepVisual_RWComplexTriangulatedFace::ReadStep(
     aTriangleFans = new NCollection_HArray1<occ::handle<Standard_Transient>>(1, nb0);
     for (int i0 = 1; i0 <= nb0; i0++)
     {
-      int nbj0 = theData->NbParams(theData->ParamNumber(sub8, i0));
-      occ::handle<NCollection_HArray1<int>> aSingleTriangleFan =
-        new NCollection_HArray1<int>(1, nbj0);
-      int subj8 = 0;
-      if (theData->ReadSubList(sub8, i0, "sub-part(triangle_fans)", theCheck, subj8))
-      {
-        int num4 = subj8;
-        for (int j0 = 1; j0 <= nbj0; j0++)
-        {
-          int anIt0;
-          theData->ReadInteger(num4, j0, "integer", theCheck, anIt0);
-          aSingleTriangleFan->SetValue(j0, anIt0);
-        }
-        aTriangleFans->SetValue(i0, aSingleTriangleFan);
-      }
+      occ::handle<NCollection_HArray1<int>> aSingleTriangleFan;
+      theData->ReadIntegerArray(sub8, i0, "sub-part(triangle_fans)", theCheck, aSingleTriangleFan);
+      aTriangleFans->SetValue(i0, aSingleTriangleFan);
     }
   }
 
@@ -203,19 +155,7 @@ void RWStepVisual_RWComplexTriangulatedFace::WriteStep(
 
   theSW.Send(theEnt->Pnmax());
 
-  theSW.OpenSub();
-  for (int i3 = 1; i3 <= theEnt->Normals()->RowLength(); i3++)
-  {
-    theSW.NewLine(false);
-    theSW.OpenSub();
-    for (int j3 = 1; j3 <= theEnt->Normals()->ColLength(); j3++)
-    {
-      double Var0 = theEnt->Normals()->Value(i3, j3);
-      theSW.Send(Var0);
-    }
-    theSW.CloseSub();
-  }
-  theSW.CloseSub();
+  theSW.SendRealArray2(theEnt->Normals());
 
   if (theEnt->HasGeometricLink())
   {
@@ -228,27 +168,14 @@ void RWStepVisual_RWComplexTriangulatedFace::WriteStep(
 
   // Own fields of ComplexTriangulatedFace
 
-  theSW.OpenSub();
-  for (int i5 = 1; i5 <= theEnt->Pnindex()->Length(); i5++)
-  {
-    int Var0 = theEnt->Pnindex()->Value(i5);
-    theSW.Send(Var0);
-  }
-  theSW.CloseSub();
+  theSW.SendIntegerArray(theEnt->Pnindex());
 
   theSW.OpenSub();
   for (int i6 = 1; i6 <= theEnt->NbTriangleStrips(); i6++)
   {
     theSW.NewLine(false);
-    theSW.OpenSub();
-    occ::handle<NCollection_HArray1<int>> aTriangleStrip =
-      occ::down_cast<NCollection_HArray1<int>>(theEnt->TriangleStrips()->Value(i6));
-    for (int j6 = 1; j6 <= aTriangleStrip->Length(); j6++)
-    {
-      int Var0 = aTriangleStrip->Value(j6);
-      theSW.Send(Var0);
-    }
-    theSW.CloseSub();
+    theSW.SendIntegerArray(
+      occ::down_cast<NCollection_HArray1<int>>(theEnt->TriangleStrips()->Value(i6)));
   }
   theSW.CloseSub();
 
@@ -256,15 +183,8 @@ void RWStepVisual_RWComplexTriangulatedFace::WriteStep(
   for (int i7 = 1; i7 <= theEnt->NbTriangleFans(); i7++)
   {
     theSW.NewLine(false);
-    theSW.OpenSub();
-    occ::handle<NCollection_HArray1<int>> aTriangleFan =
-      occ::down_cast<NCollection_HArray1<int>>(theEnt->TriangleFans()->Value(i7));
-    for (int j7 = 1; j7 <= aTriangleFan->Length(); j7++)
-    {
-      int Var0 = aTriangleFan->Value(j7);
-      theSW.Send(Var0);
-    }
-    theSW.CloseSub();
+    theSW.SendIntegerArray(
+      occ::down_cast<NCollection_HArray1<int>>(theEnt->TriangleFans()->Value(i7)));
   }
   theSW.CloseSub();
 }
@@ -71,45 +71,16 @@ void RWStepVisual_RWComplexTriangulatedSurfaceSet::ReadStep(
                        aTessellatedSurfaceSet_Pnmax);
 
   occ::handle<NCollection_HArray2<double>> aTessellatedSurfaceSet_Normals;
-  int                                      sub4 = 0;
-  if (theData->ReadSubList(theNum, 4, "tessellated_surface_set.normals", theCheck, sub4))
-  {
-    int nb0                        = theData->NbParams(sub4);
-    int nbj0                       = theData->NbParams(theData->ParamNumber(sub4, 1));
-    aTessellatedSurfaceSet_Normals = new NCollection_HArray2<double>(1, nb0, 1, nbj0);
-    for (int i0 = 1; i0 <= nb0; i0++)
-    {
-      int subj4 = 0;
-      if (theData
-            ->ReadSubList(sub4, i0, "sub-part(tessellated_surface_set.normals)", theCheck, subj4))
-      {
-        int num4 = subj4;
-        for (int j0 = 1; j0 <= nbj0; j0++)
-        {
-          double anIt0;
-          theData->ReadReal(num4, j0, "real", theCheck, anIt0);
-          aTessellatedSurfaceSet_Normals->SetValue(i0, j0, anIt0);
-        }
-      }
-    }
-  }
+  theData->ReadRealArray2(theNum,
+                          4,
+                          "tessellated_surface_set.normals",
+                          theCheck,
+                          aTessellatedSurfaceSet_Normals);
 
   // Own fields of ComplexTriangulatedSurfaceSet
 
   occ::handle<NCollection_HArray1<int>> aPnindex;
-  int                                   sub5 = 0;
-  if (theData->ReadSubList(theNum, 5, "pnindex", theCheck, sub5))
-  {
-    int nb0  = theData->NbParams(sub5);
-    aPnindex = new NCollection_HArray1<int>(1, nb0);
-    int num2 = sub5;
-    for (int i0 = 1; i0 <= nb0; i0++)
-    {
-      int anIt0;
-      theData->ReadInteger(num2, i0, "integer", theCheck, anIt0);
-      aPnindex->SetValue(i0, anIt0);
-    }
-  }
+  theData->ReadIntegerArray(theNum, 5, "pnindex", theCheck, aPnindex);
 
   occ::handle<NCollection_HArray1<occ::handle<Standard_Transient>>> aTriangleStrips;
   int                                                               sub6 = 0;
@@ -119,21 +90,13 @@ void RWStepVisual_RWComplexTriangulatedSurfaceSet::ReadStep(
     aTriangleStrips = new NCollection_HArray1<occ::handle<Standard_Transient>>(1, nb0);
     for (int i0 = 1; i0 <= nb0; i0++)
     {
-      int nbj0 = theData->NbParams(theData->ParamNumber(sub6, i0));
-      occ::handle<NCollection_HArray1<int>> aSingleTriangleStrip =
-        new NCollection_HArray1<int>(1, nbj0);
-      int subj6 = 0;
-      if (theData->ReadSubList(sub6, i0, "sub-part(triangle_strips)", theCheck, subj6))
-      {
-        int num4 = subj6;
-        for (int j0 = 1; j0 <= nbj0; j0++)
-        {
-          int anIt0;
-          theData->ReadInteger(num4, j0, "integer", theCheck, anIt0);
-          aSingleTriangleStrip->SetValue(j0, anIt0);
-        }
-        aTriangleStrips->SetValue(i0, aSingleTriangleStrip);
-      }
+      occ::handle<NCollection_HArray1<int>> aSingleTriangleStrip;
+      theData->ReadIntegerArray(sub6,
+                                i0,
+                                "sub-part(triangle_strips)",
+                                theCheck,
+                                aSingleTriangleStrip);
+      aTriangleStrips->SetValue(i0, aSingleTriangleStrip);
     }
   }
 
@@ -145,21 +108,9 @@ void RWStepVisual_RWComplexTriangulatedSurfaceSet::ReadStep(
     aTriangleFans = new NCollection_HArray1<occ::handle<Standard_Transient>>(1, nb0);
     for (int i0 = 1; i0 <= nb0; i0++)
     {
-      int nbj0 = theData->NbParams(theData->ParamNumber(sub7, i0));
-      occ::handle<NCollection_HArray1<int>> aSingleTriangleFan =
-        new NCollection_HArray1<int>(1, nbj0);
-      int subj7 = 0;
-      if (theData->ReadSubList(sub7, i0, "sub-part(triangle_fans)", theCheck, subj7))
-      {
-        int num4 = subj7;
-        for (int j0 = 1; j0 <= nbj0; j0++)
-        {
-          int anIt0;
-          theData->ReadInteger(num4, j0, "integer", theCheck, anIt0);
-          aSingleTriangleFan->SetValue(j0, anIt0);
-        }
-        aTriangleFans->SetValue(i0, aSingleTriangleFan);
-      }
+      occ::handle<NCollection_HArray1<int>> aSingleTriangleFan;
+      theData->ReadIntegerArray(sub7, i0, "sub-part(triangle_fans)", theCheck, aSingleTriangleFan);
+      aTriangleFans->SetValue(i0, aSingleTriangleFan);
     }
   }
 
@@ -190,51 +141,23 @@ void RWStepVisual_RWComplexTriangulatedSurfaceSet::WriteStep(
 
   theSW.Send(theEnt->Pnmax());
 
-  theSW.OpenSub();
   // According to "Recommended Practices Recommended Practices for 3D Tessellated Geometry",
   // Release 1.1:
   // "...The size of the list of normals may be:
   //    0: no normals are defined..."
   // In OCC this situation is reflected by nullptr normals container.
-  if (theEnt->NbNormals() != 0)
-  {
-    for (int i3 = 1; i3 <= theEnt->Normals()->NbRows(); i3++)
-    {
-      theSW.NewLine(false);
-      theSW.OpenSub();
-      for (int j3 = 1; j3 <= theEnt->Normals()->NbColumns(); j3++)
-      {
-        double Var0 = theEnt->Normals()->Value(i3, j3);
-        theSW.Send(Var0);
-      }
-      theSW.CloseSub();
-    }
-  }
-  theSW.CloseSub();
+  theSW.SendRealArray2(theEnt->Normals());
 
   // Own fields of ComplexTriangulatedSurfaceSet
 
-  theSW.OpenSub();
-  for (int i4 = 1; i4 <= theEnt->Pnindex()->Length(); i4++)
-  {
-    int Var0 = theEnt->Pnindex()->Value(i4);
-    theSW.Send(Var0);
-  }
-  theSW.CloseSub();
+  theSW.SendIntegerArray(theEnt->Pnindex());
 
   theSW.OpenSub();
   for (int i5 = 1; i5 <= theEnt->NbTriangleStrips(); i5++)
   {
     theSW.NewLine(false);
-    theSW.OpenSub();
-    occ::handle<NCollection_HArray1<int>> aTriangleStrip =
-      occ::down_cast<NCollection_HArray1<int>>(theEnt->TriangleStrips()->Value(i5));
-    for (int j5 = 1; j5 <= aTriangleStrip->Length(); j5++)
-    {
-      int Var0 = aTriangleStrip->Value(j5);
-      theSW.Send(Var0);
-    }
-    theSW.CloseSub();
+    theSW.SendIntegerArray(
+      occ::down_cast<NCollection_HArray1<int>>(theEnt->TriangleStrips()->Value(i5)));
   }
   theSW.CloseSub();
 
@@ -242,15 +165,8 @@ void RWStepVisual_RWComplexTriangulatedSurfaceSet::WriteStep(
   for (int i6 = 1; i6 <= theEnt->NbTriangleFans(); i6++)
   {
     theSW.NewLine(false);
-    theSW.OpenSub();
-    occ::handle<NCollection_HArray1<int>> aTriangleFan =
-      occ::down_cast<NCollection_HArray1<int>>(theEnt->TriangleFans()->Value(i6));
-    for (int j6 = 1; j6 <= aTriangleFan->Length(); j6++)
-    {
-      int Var0 = aTriangleFan->Value(j6);
-      theSW.Send(Var0);
-    }
-    theSW.CloseSub();
+    theSW.SendIntegerArray(
+      occ::down_cast<NCollection_HArray1<int>>(theEnt->TriangleFans()->Value(i6)));
   }
   theSW.CloseSub();
 }
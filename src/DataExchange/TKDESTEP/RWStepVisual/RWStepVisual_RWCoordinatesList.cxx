@@ -45,38 +45,8 @@ void RWStepVisual_RWCoordinatesList::ReadStep(
   int nbP = 0;
   data->ReadInteger(num, 2, "number_points", ach, nbP);
 
-  occ::handle<NCollection_HArray1<gp_XYZ>> aPoints; // = new NCollection_HArray1<gp_XYZ>(1, nbP);
-  int                                      nsub2;
-  if (data->ReadSubList(num, 3, "items", ach, nsub2))
-  {
-    int nb2 = data->NbParams(nsub2);
-    if (!nb2)
-      return;
-    aPoints = new NCollection_HArray1<gp_XYZ>(1, nb2);
-    for (int i = 1; i <= nb2; i++)
-    {
-      gp_XYZ aXYZ(0., 0., 0.);
-      int    nsub3;
-      if (data->ReadSubList(nsub2, i, "coordinates", ach, nsub3))
-      {
-        int nb3 = data->NbParams(nsub3);
-        if (nb3 > 3)
-        {
-          ach->AddWarning("More than 3 coordinates, ignored");
-        }
-        int nbcoord = std::min(nb3, 3);
-        for (int j = 1; j <= nbcoord; j++)
-        {
-          double aVal = 0.;
-          if (data->ReadReal(nsub3, j, "coordinates", ach, aVal))
-          {
-            aXYZ.SetCoord(j, aVal);
-          }
-        }
-      }
-      aPoints->SetValue(i, aXYZ);
-    }
-  }
+  occ::handle<NCollection_HArray1<gp_XYZ>> aPoints;
+  data->ReadXYZArray(num, 3, "items", ach, aPoints);
 
   //--- Initialisation of the read entity ---
 
@@ -93,18 +63,9 @@ void RWStepVisual_RWCoordinatesList::WriteStep(
   SW.Send(ent->Name());
 
   // Own field : npoints
-  SW.Send(ent->Points()->Length());
+  const occ::handle<NCollection_HArray1<gp_XYZ>> aPoints = ent->Points();
+  SW.Send(aPoints.IsNull() ? 0 : aPoints->Length());
 
   // Own field : position_coords
-  SW.OpenSub();
-  for (int i = 1; i <= ent->Points()->Length(); i++)
-  {
-    SW.OpenSub();
-    gp_XYZ aPoint = ent->Points()->Value(i);
-    SW.Send(aPoint.X());
-    SW.Send(aPoint.Y());
-    SW.Send(aPoint.Z());
-    SW.CloseSub();
-  }
-  SW.CloseSub();
+  SW.SendXYZArray(aPoints);
 }
@@ -66,27 +66,11 @@ void RWStepVisual_RWTriangulatedFace::ReadStep(
   theData->ReadInteger(theNum, 3, "tessellated_face.pnmax", theCheck, aTessellatedFace_Pnmax);
 
   occ::handle<NCollection_HArray2<double>> aTessellatedFace_Normals;
-  int                                      sub4 = 0;
-  if (theData->ReadSubList(theNum, 4, "tessellated_face.normals", theCheck, sub4))
-  {
-    int nb0                  = theData->NbParams(sub4);
-    int nbj0                 = theData->NbParams(theData->ParamNumber(sub4, 1));
-    aTessellatedFace_Normals = new NCollection_HArray2<double>(1, nb0, 1, nbj0);
-    for (int i0 = 1; i0 <= nb0; i0++)
-    {
-      int subj4 = 0;
-      if (theData->ReadSubList(sub4, i0, "sub-part(tessellated_face.normals)", theCheck, subj4))
-      {
-        int num4 = subj4;
-        for (int j0 = 1; j0 <= nbj0; j0++)
-        {
-          double anIt0;
-          theData->ReadReal(num4, j0, "real", theCheck, anIt0);
-          aTessellatedFace_Normals->SetValue(i0, j0, anIt0);
-        }
-      }
-    }
-  }
+  theData->ReadRealArray2(theNum,
+                          4,
+                          "tessellated_face.normals",
+                          theCheck,
+                          aTessellatedFace_Normals);
 
   StepVisual_FaceOrSurface aTessellatedFace_GeometricLink;
   bool                     hasTessellatedFace_GeometricLink = true;
@@ -107,42 +91,10 @@ void RWStepVisual_RWTriangulatedFace::ReadStep(
   // Own fields of TriangulatedFace
 
   occ::handle<NCollection_HArray1<int>> aPnindex;
-  int                                   sub6 = 0;
-  if (theData->ReadSubList(theNum, 6, "pnindex", theCheck, sub6))
-  {
-    int nb0  = theData->NbParams(sub6);
-    aPnindex = new NCollection_HArray1<int>(1, nb0);
-    int num2 = sub6;
-    for (int i0 = 1; i0 <= nb0; i0++)
-    {
-      int anIt0;
-      theData->ReadInteger(num2, i0, "integer", theCheck, anIt0);
-      aPnindex->SetValue(i0, anIt0);
-    }
-  }
+  theData->ReadIntegerArray(theNum, 6, "pnindex", theCheck, aPnindex);
 
   occ::handle<NCollection_HArray2<int>> aTriangles;
-  int                                   sub7 = 0;
-  if (theData->ReadSubList(theNum, 7, "triangles", theCheck, sub7))
-  {
-    int nb0    = theData->NbParams(sub7);
-    int nbj0   = theData->NbParams(theData->ParamNumber(sub7, 1));
-    aTriangles = new NCollection_HArray2<int>(1, nb0, 1, nbj0);
-    for (int i0 = 1; i0 <= nb0; i0++)
-    {
-      int subj7 = 0;
-      if (theData->ReadSubList(sub7, i0, "sub-part(triangles)", theCheck, subj7))
-      {
-        int num4 = subj7;
-        for (int j0 = 1; j0 <= nbj0; j0++)
-        {
-          int anIt0;
-          theData->ReadInteger(num4, j0, "integer", theCheck, anIt0);
-          aTriangles->SetValue(i0, j0, anIt0);
-        }
-      }
-    }
-  }
+  theData->ReadIntegerArray2(theNum, 7, "triangles", theCheck, aTriangles);
 
   // Initialize entity
   theEnt->Init(aRepresentationItem_Name,
@@ -177,19 +129,7 @@ void RWStepVisual_RWTriangulatedFace::WriteStep(
 
   theSW.Send(theEnt->Pnmax());
 
-  theSW.OpenSub();
-  for (int i3 = 1; i3 <= theEnt->Normals()->NbRows(); i3++)
-  {
-    theSW.NewLine(false);
-    theSW.OpenSub();
-    for (int j3 = 1; j3 <= theEnt->Normals()->NbColumns(); j3++)
-    {
-      double Var0 = theEnt->Normals()->Value(i3, j3);
-      theSW.Send(Var0);
-    }
-    theSW.CloseSub();
-  }
-  theSW.CloseSub();
+  theSW.SendRealArray2(theEnt->Normals());
 
   if (theEnt->HasGeometricLink())
   {
@@ -202,27 +142,9 @@ void RWStepVisual_RWTriangulatedFace::WriteStep(
 
   // Own fields of TriangulatedFace
 
-  theSW.OpenSub();
-  for (int i5 = 1; i5 <= theEnt->Pnindex()->Length(); i5++)
-  {
-    int Var0 = theEnt->Pnindex()->Value(i5);
-    theSW.Send(Var0);
-  }
-  theSW.CloseSub();
+  theSW.SendIntegerArray(theEnt->Pnindex());
 
-  theSW.OpenSub();
-  for (int i6 = 1; i6 <= theEnt->Triangles()->NbRows(); i6++)
-  {
-    theSW.NewLine(false);
-    theSW.OpenSub();
-    for (int j6 = 1; j6 <= theEnt->Triangles()->NbColumns(); j6++)
-    {
-      int Var0 = theEnt->Triangles()->Value(i6, j6);
-      theSW.Send(Var0);
-    }
-    theSW.CloseSub();
-  }
-  theSW.CloseSub();
+  theSW.SendIntegerArray2(theEnt->Triangles());
 }
 
 //=================================================================================================
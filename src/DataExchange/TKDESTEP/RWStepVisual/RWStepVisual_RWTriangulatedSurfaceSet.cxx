@@ -65,70 +65,18 @@ void RWStepVisual_RWTriangulatedSurfaceSet::ReadStep(
                        aTessellatedSurfaceSet_Pnmax);
 
   occ::handle<NCollection_HArray2<double>> aTessellatedSurfaceSet_Normals;
-  int                                      aNormSub4 = 0;
-  if (theData->ReadSubList(theNum, 4, "tessellated_surface_set.normals", theCheck, aNormSub4))
-  {
-    const int aNormNb              = theData->NbParams(aNormSub4);
-    const int anAxesNb             = theData->NbParams(theData->ParamNumber(aNormSub4, 1));
-    aTessellatedSurfaceSet_Normals = new NCollection_HArray2<double>(1, aNormNb, 1, anAxesNb);
-    for (int aNormIndex = 1; aNormIndex <= aNormNb; aNormIndex++)
-    {
-      int anAxesSub4 = 0;
-      if (theData->ReadSubList(aNormSub4,
-                               aNormIndex,
-                               "sub-part(tessellated_surface_set.normals)",
-                               theCheck,
-                               anAxesSub4))
-      {
-        const int anAxisNum4 = anAxesSub4;
-        for (int anAxisIndex = 1; anAxisIndex <= anAxesNb; anAxisIndex++)
-        {
-          double aValue;
-          theData->ReadReal(anAxisNum4, anAxisIndex, "real", theCheck, aValue);
-          aTessellatedSurfaceSet_Normals->SetValue(aNormIndex, anAxisIndex, aValue);
-        }
-      }
-    }
-  }
+  theData->ReadRealArray2(theNum,
+                          4,
+                          "tessellated_surface_set.normals",
+                          theCheck,
+                          aTessellatedSurfaceSet_Normals);
 
   // Own fields of TriangulatedSurfaceSet
   occ::handle<NCollection_HArray1<int>> aPnindex;
-  int                                   aPnSub5 = 0;
-  if (theData->ReadSubList(theNum, 5, "pnindex", theCheck, aPnSub5))
-  {
-    const int aPnNb   = theData->NbParams(aPnSub5);
-    aPnindex          = new NCollection_HArray1<int>(1, aPnNb);
-    const int aPnNum2 = aPnSub5;
-    for (int aPnIndex = 1; aPnIndex <= aPnNb; aPnIndex++)
-    {
-      int aValue;
-      theData->ReadInteger(aPnNum2, aPnIndex, "integer", theCheck, aValue);
-      aPnindex->SetValue(aPnIndex, aValue);
-    }
-  }
+  theData->ReadIntegerArray(theNum, 5, "pnindex", theCheck, aPnindex);
 
   occ::handle<NCollection_HArray2<int>> aTriangles;
-  int                                   aTrSub6 = 0;
-  if (theData->ReadSubList(theNum, 6, "triangles", theCheck, aTrSub6))
-  {
-    const int aTriaNb  = theData->NbParams(aTrSub6);
-    const int anAxesNb = theData->NbParams(theData->ParamNumber(aTrSub6, 1));
-    aTriangles         = new NCollection_HArray2<int>(1, aTriaNb, 1, anAxesNb);
-    for (int aTriaIndex = 1; aTriaIndex <= aTriaNb; aTriaIndex++)
-    {
-      int anAxesSubj6 = 0;
-      if (theData->ReadSubList(aTrSub6, aTriaIndex, "sub-part(triangles)", theCheck, anAxesSubj6))
-      {
-        const int anAxisNum4 = anAxesSubj6;
-        for (int anAxisIndex = 1; anAxisIndex <= anAxesNb; anAxisIndex++)
-        {
-          int aValue;
-          theData->ReadInteger(anAxisNum4, anAxisIndex, "integer", theCheck, aValue);
-          aTriangles->SetValue(aTriaIndex, anAxisIndex, aValue);
-        }
-      }
-    }
-  }
+  theData->ReadIntegerArray2(theNum, 6, "triangles", theCheck, aTriangles);
 
   // Initialize entity
   theEnt->Init(aRepresentationItem_Name,
@@ -152,43 +100,12 @@ void RWStepVisual_RWTriangulatedSurfaceSet::WriteStep(
   theSW.Send(theEnt->Coordinates());
   theSW.Send(theEnt->Pnmax());
 
-  theSW.OpenSub();
-  for (int aNormIndex = 1; aNormIndex <= theEnt->Normals()->NbRows(); aNormIndex++)
-  {
-    theSW.NewLine(false);
-    theSW.OpenSub();
-    for (int anAxisIndex = 1; anAxisIndex <= theEnt->Normals()->NbColumns(); anAxisIndex++)
-    {
-      const double aValue = theEnt->Normals()->Value(aNormIndex, anAxisIndex);
-      theSW.Send(aValue);
-    }
-    theSW.CloseSub();
-  }
-  theSW.CloseSub();
+  theSW.SendRealArray2(theEnt->Normals());
 
   // Own fields of TriangulatedSurfaceSet
-  theSW.OpenSub();
-  NCollection_HArray1<int>::Iterator aPnIndexIt(theEnt->Pnindex()->Array1());
-  for (; aPnIndexIt.More(); aPnIndexIt.Next())
-  {
-    const int aValue = aPnIndexIt.Value();
-    theSW.Send(aValue);
-  }
-  theSW.CloseSub();
+  theSW.SendIntegerArray(theEnt->Pnindex());
 
-  theSW.OpenSub();
-  for (int aTriaIndex = 1; aTriaIndex <= theEnt->Triangles()->NbRows(); aTriaIndex++)
-  {
-    theSW.NewLine(false);
-    theSW.OpenSub();
-    for (int anAxisIndex = 1; anAxisIndex <= theEnt->Triangles()->NbColumns(); anAxisIndex++)
-    {
-      const int aValue = theEnt->Triangles()->Value(aTriaIndex, anAxisIndex);
-      theSW.Send(aValue);
-    }
-    theSW.CloseSub();
-  }
-  theSW.CloseSub();
+  theSW.SendIntegerArray2(theEnt->Triangles());
 }
 
 //=================================================================================================
@@ -240,6 +240,7 @@
 #include <BRepBuilderAPI_MakeEdge.hxx>
 #include <Transfer_ActorOfTransientProcess.hxx>
 #include <Bnd_Box.hxx>
+#include <BRepTools_ReShape.hxx>
 #include <BRepBndLib.hxx>
 
 namespace
@@ -285,7 +286,9 @@ STEPCAFControl_Reader::STEPCAFControl_Reader()
       mySHUOMode(false),
       myGDTMode(true),
       myMatMode(true),
-      myViewMode(true)
+      myViewMode(true),
+      myDeferredGeometryMode(false),
+      myMergeDuplicatesMode(false)
 {
   STEPCAFControl_Controller::Init();
   if (!myReader.WS().IsNull())
@@ -307,7 +310,9 @@ STEPCAFControl_Reader::STEPCAFControl_Reader(const occ::handle<XSControl_WorkSes
       mySHUOMode(false),
       myGDTMode(true),
       myMatMode(true),
-      myViewMode(true)
+      myViewMode(true),
+      myDeferredGeometryMode(false),
+      myMergeDuplicatesMode(false)
 {
   STEPCAFControl_Controller::Init();
   Init(WS, scratch);
@@ -328,6 +333,8 @@ void STEPCAFControl_Reader::Init(const occ::handle<XSControl_WorkSession>& WS, c
   myReader.SetWS(WS, scratch);
   myFiles.Clear();
   myMap.Clear();
+  myDeferredItems.Clear();
+  myDeferredResults.Clear();
 }
 
 //=================================================================================================
@@ -540,6 +547,19 @@ bool STEPCAFControl_Reader::Transfer(STEPControl_Reader&                  reader
 
   Message_ProgressScope aPSRoot(theProgress, nullptr, 2);
 
+  // geometry of the main file only can be deferred, as the reader keeps its work session
+  occ::handle<STEPControl_ActorRead> aDeferringActor;
+  if (myDeferredGeometryMode && &reader == &myReader)
+  {
+    aDeferringActor =
+      occ::down_cast<STEPControl_ActorRead>(reader.WS()->TransferReader()->Actor());
+  }
+  if (!aDeferringActor.IsNull())
+  {
+    aDeferringActor->ClearDeferredItems();
+    aDeferringActor->SetDeferredGeometryMode(true);
+  }
+
   if (nroot)
   {
     if (nroot > num)
@@ -552,6 +572,20 @@ bool STEPCAFControl_Reader::Transfer(STEPControl_Reader&                  reader
     for (i = 1; i <= num && aPS.More(); i++)
       reader.TransferOneRoot(i, aPS.Next());
   }
+
+  if (!aDeferringActor.IsNull())
+  {
+    aDeferringActor->SetDeferredGeometryMode(false);
+    const NCollection_IndexedDataMap<TopoDS_Shape,
+                                     STEPControl_ActorRead::DeferredItem,
+                                     TopTools_ShapeMapHasher>& anItems =
+      aDeferringActor->DeferredItems();
+    for (int anItemIter = 1; anItemIter <= anItems.Extent(); ++anItemIter)
+    {
+      myDeferredItems.Add(anItems.FindKey(anItemIter), anItems.FindFromIndex(anItemIter));
+    }
+    aDeferringActor->ClearDeferredItems();
+  }
   if (aPSRoot.UserBreak())
     return false;
 
@@ -778,6 +812,25 @@ bool STEPCAFControl_Reader::Transfer(STEPControl_Reader&                  reader
   // names) if requested
   ExpandSubShapes(STool, ShapePDMap);
 
+  // Replace duplicated parts by instances of one part
+  if (GetMergeDuplicatesMode())
+  {
+    NCollection_DataMap<TDF_Label, TDF_Label> aMergedParts;
+    if (STool->MergeDuplicates(aMergedParts) > 0)
+    {
+      for (NCollection_DataMap<TopoDS_Shape, TDF_Label, TopTools_ShapeMapHasher>::Iterator
+             aMapIter(myMap);
+           aMapIter.More();
+           aMapIter.Next())
+      {
+        if (const TDF_Label* aMainPart = aMergedParts.Seek(aMapIter.Value()))
+        {
+          aMapIter.ChangeValue() = *aMainPart;
+        }
+      }
+    }
+  }
+
   // Update assembly compounds
   STool->UpdateAssemblies();
   return true;
@@ -2158,6 +2211,10 @@ occ::handle<Poly_Triangulation> createMesh(
   {
     occ::handle<NCollection_HArray1<int>> aTriangleStrip =
       occ::down_cast<NCollection_HArray1<int>>(aTriaStrips->Value(i));
+    if (aTriangleStrip.IsNull())
+    {
+      continue;
+    }
     aNbTriaStrips += aTriangleStrip->Length() - 2;
   }
 
@@ -2169,6 +2226,10 @@ occ::handle<Poly_Triangulation> createMesh(
   {
     occ::handle<NCollection_HArray1<int>> aTriangleFan =
       occ::down_cast<NCollection_HArray1<int>>(aTriaFans->Value(i));
+    if (aTriangleFan.IsNull())
+    {
+      continue;
+    }
     aNbTriaFans += aTriangleFan->Length() - 2;
   }
 
@@ -2191,6 +2252,10 @@ occ::handle<Poly_Triangulation> createMesh(
   {
     occ::handle<NCollection_HArray1<int>> aTriangleStrip =
       occ::down_cast<NCollection_HArray1<int>>(aTriaStrips->Value(i));
+    if (aTriangleStrip.IsNull())
+    {
+      continue;
+    }
     for (int j = 3; j <= aTriangleStrip->Length(); j += 2)
     {
       if (aTriangleStrip->Value(j) != aTriangleStrip->Value(j - 2)
@@ -2220,6 +2285,10 @@ occ::handle<Poly_Triangulation> createMesh(
   {
     occ::handle<NCollection_HArray1<int>> aTriangleFan =
       occ::down_cast<NCollection_HArray1<int>>(aTriaFans->Value(i));
+    if (aTriangleFan.IsNull())
+    {
+      continue;
+    }
     for (int j = 3; j <= aTriangleFan->Length(); ++j)
     {
       aMesh->SetTriangle(
@@ -5823,6 +5892,222 @@ bool STEPCAFControl_Reader::GetViewMode() const
   return myViewMode;
 }
 
+//=================================================================================================
+
+void STEPCAFControl_Reader::SetDeferredGeometryMode(const bool theToDefer)
+{
+  myDeferredGeometryMode = theToDefer;
+}
+
+//=================================================================================================
+
+bool STEPCAFControl_Reader::GetDeferredGeometryMode() const
+{
+  return myDeferredGeometryMode;
+}
+
+//=================================================================================================
+
+void STEPCAFControl_Reader::SetMergeDuplicatesMode(const bool theToMerge)
+{
+  myMergeDuplicatesMode = theToMerge;
+}
+
+//=================================================================================================
+
+bool STEPCAFControl_Reader::GetMergeDuplicatesMode() const
+{
+  return myMergeDuplicatesMode;
+}
+
+//=================================================================================================
+
+void STEPCAFControl_Reader::collectPlaceholders(
+  const TopoDS_Shape&             theShape,
+  NCollection_List<TopoDS_Shape>& thePlaceholders) const
+{
+  if (theShape.IsNull() || theShape.ShapeType() != TopAbs_COMPOUND)
+  {
+    return;
+  }
+  const TopoDS_Shape aPlaceholder = theShape.Located(TopLoc_Location());
+  if (myDeferredItems.Contains(aPlaceholder) || myDeferredResults.IsBound(aPlaceholder))
+  {
+    thePlaceholders.Append(theShape);
+    return;
+  }
+  for (TopoDS_Iterator aSubIter(theShape); aSubIter.More(); aSubIter.Next())
+  {
+    collectPlaceholders(aSubIter.Value(), thePlaceholders);
+  }
+}
+
+//=================================================================================================
+
+bool STEPCAFControl_Reader::HasDeferredGeometry(const TDF_Label& theLabel) const
+{
+  if (myDeferredItems.IsEmpty())
+  {
+    return false;
+  }
+  NCollection_List<TopoDS_Shape> aPlaceholders;
+  collectPlaceholders(XCAFDoc_ShapeTool::GetShape(theLabel), aPlaceholders);
+  for (NCollection_List<TopoDS_Shape>::Iterator anIter(aPlaceholders); anIter.More(); anIter.Next())
+  {
+    if (myDeferredItems.Contains(anIter.Value().Located(TopLoc_Location())))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+//=================================================================================================
+
+bool STEPCAFControl_Reader::DeferredGeometryBox(const TDF_Label& theLabel, Bnd_Box& theBox) const
+{
+  NCollection_List<TopoDS_Shape> aPlaceholders;
+  collectPlaceholders(XCAFDoc_ShapeTool::GetShape(theLabel), aPlaceholders);
+  bool hasDeferred = false;
+  for (NCollection_List<TopoDS_Shape>::Iterator anIter(aPlaceholders); anIter.More(); anIter.Next())
+  {
+    const STEPControl_ActorRead::DeferredItem* anItem =
+      myDeferredItems.Seek(anIter.Value().Located(TopLoc_Location()));
+    if (anItem == nullptr)
+    {
+      continue;
+    }
+    hasDeferred = true;
+    if (!anItem->Box.IsVoid())
+    {
+      theBox.Add(anItem->Box.Transformed(anIter.Value().Location().Transformation()));
+    }
+  }
+  return hasDeferred;
+}
+
+//=================================================================================================
+
+bool STEPCAFControl_Reader::TransferDeferredGeometry(const TDF_Label&             theLabel,
+                                                     const Message_ProgressRange& theProgress)
+{
+  occ::handle<XCAFDoc_ShapeTool> aSTool = XCAFDoc_DocumentTool::ShapeTool(theLabel);
+  if (aSTool.IsNull() || myDeferredItems.IsEmpty())
+  {
+    return false;
+  }
+
+  // collect the labels of parts having deferred geometry
+  NCollection_Sequence<TDF_Label> aParts;
+  NCollection_Map<TDF_Label>      aVisited;
+  NCollection_Sequence<TDF_Label> aStack;
+  aStack.Append(theLabel);
+  while (!aStack.IsEmpty())
+  {
+    TDF_Label aLabel = aStack.Last();
+    aStack.Remove(aStack.Length());
+    TDF_Label aReferred;
+    if (XCAFDoc_ShapeTool::GetReferredShape(aLabel, aReferred))
+    {
+      aLabel = aReferred;
+    }
+    if (!aVisited.Add(aLabel))
+    {
+      continue;
+    }
+    NCollection_Sequence<TDF_Label> aComponents;
+    if (XCAFDoc_ShapeTool::GetComponents(aLabel, aComponents))
+    {
+      aStack.Append(aComponents);
+    }
+    else if (HasDeferredGeometry(aLabel))
+    {
+      aParts.Append(aLabel);
+    }
+  }
+  if (aParts.IsEmpty())
+  {
+    return false;
+  }
+
+  const occ::handle<Transfer_TransientProcess>& aTP =
+    myReader.WS()->TransferReader()->TransientProcess();
+  occ::handle<STEPControl_ActorRead> anActor =
+    occ::down_cast<STEPControl_ActorRead>(myReader.WS()->TransferReader()->Actor());
+  if (aTP.IsNull() || anActor.IsNull())
+  {
+    return false;
+  }
+
+  bool                  isDone = true;
+  Message_ProgressScope aPS(theProgress, "Deferred geometry", aParts.Length());
+  for (NCollection_Sequence<TDF_Label>::Iterator aPartIter(aParts); aPartIter.More();
+       aPartIter.Next())
+  {
+    const TopoDS_Shape             aShape = XCAFDoc_ShapeTool::GetShape(aPartIter.Value());
+    NCollection_List<TopoDS_Shape> aPlaceholders;
+    collectPlaceholders(aShape, aPlaceholders);
+    Message_ProgressScope aPartPS(aPS.Next(), nullptr, aPlaceholders.Extent());
+
+    occ::handle<BRepTools_ReShape> aReShape = new BRepTools_ReShape();
+    for (NCollection_List<TopoDS_Shape>::Iterator anIter(aPlaceholders);
+         anIter.More() && aPartPS.More();
+         anIter.Next())
+    {
+      Message_ProgressRange aRange       = aPartPS.Next();
+      const TopoDS_Shape    aPlaceholder = anIter.Value().Located(TopLoc_Location());
+      if (!myDeferredResults.IsBound(aPlaceholder))
+      {
+        const TopoDS_Shape aResult =
+          anActor->TransferDeferredItem(myDeferredItems.FindFromKey(aPlaceholder), aTP, aRange);
+        if (aResult.IsNull())
+        {
+          isDone = false;
+          continue;
+        }
+        myDeferredResults.Bind(aPlaceholder, aResult);
+        myDeferredItems.RemoveKey(aPlaceholder);
+      }
+      aReShape->Replace(aPlaceholder, myDeferredResults.Find(aPlaceholder));
+    }
+    aSTool->SetShape(aPartIter.Value(), aReShape->Apply(aShape));
+  }
+  aSTool->UpdateAssemblies();
+
+  // styles of the faces and other sub-shapes can be found now
+  occ::handle<TDocStd_Document> aDoc = TDocStd_Document::Get(theLabel);
+  if (GetColorMode() && !aDoc.IsNull())
+  {
+    occ::handle<StepData_StepModel> aModel = occ::down_cast<StepData_StepModel>(myReader.Model());
+    StepData_Factors                aLocalFactors;
+    prepareUnits(aModel, aDoc, aLocalFactors);
+    ReadColors(myReader.WS(), aDoc, aLocalFactors);
+  }
+  return isDone;
+}
+
+//=================================================================================================
+
+bool STEPCAFControl_Reader::TransferDeferredGeometry(const occ::handle<TDocStd_Document>& theDoc,
+                                                     const Message_ProgressRange& theProgress)
+{
+  occ::handle<XCAFDoc_ShapeTool> aSTool = XCAFDoc_DocumentTool::ShapeTool(theDoc->Main());
+  NCollection_Sequence<TDF_Label> aFreeShapes;
+  aSTool->GetFreeShapes(aFreeShapes);
+  bool                  isDone = true;
+  Message_ProgressScope aPS(theProgress, "Deferred geometry", aFreeShapes.Length());
+  for (NCollection_Sequence<TDF_Label>::Iterator anIter(aFreeShapes); anIter.More() && aPS.More();
+       anIter.Next())
+  {
+    Message_ProgressRange aRange = aPS.Next();
+    if (HasDeferredGeometry(anIter.Value()))
+    {
+      isDone = TransferDeferredGeometry(anIter.Value(), aRange) && isDone;
+    }
+  }
+  return isDone;
+}
+
 //=============================================================================
 
 void STEPCAFControl_Reader::SetShapeFixParameters(
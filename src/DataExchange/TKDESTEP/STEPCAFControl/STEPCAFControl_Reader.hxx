@@ -16,6 +16,7 @@
 #ifndef _STEPCAFControl_Reader_HeaderFile
 #define _STEPCAFControl_Reader_HeaderFile
 
+#include <STEPControl_ActorRead.hxx>
 #include <STEPControl_Reader.hxx>
 #include <StepData_Factors.hxx>
 #include <IFSelect_ReturnStatus.hxx>
@@ -49,6 +50,7 @@ class StepRepr_PropertyDefinition;
 class STEPConstruct_Tool;
 class StepDimTol_Datum;
 class Transfer_Binder;
+class Bnd_Box;
 
 //! Provides a tool to read STEP file and put it into
 //! DECAF document. Besides transfer of shapes (including
@@ -221,6 +223,47 @@ public:
   //! Get View mode
   Standard_EXPORT bool GetViewMode() const;
 
+  //! Set mode of merging duplicated parts (off by default).
+  //! In this mode Transfer() replaces parts having the same topology and geometry
+  //! (typically the same body defined by several products) by instances of one part,
+  //! see XCAFDoc_ShapeTool::MergeDuplicates(). Parts with deferred geometry are not merged.
+  Standard_EXPORT void SetMergeDuplicatesMode(const bool theToMerge);
+
+  Standard_EXPORT bool GetMergeDuplicatesMode() const;
+
+  //! Set mode of deferred translation of geometry (off by default).
+  //! In this mode Transfer() builds the product structure of the document with names, colors
+  //! and other attributes of products, while the BRep items of the parts are replaced by empty
+  //! compounds (placeholders) mapped to the STEP entities. The geometry is then translated
+  //! on demand by TransferDeferredGeometry(); DeferredGeometryBox() gives the box of the
+  //! geometry computed from the points of the STEP entities in the meantime.
+  //! The geometry of externally referenced files is translated immediately.
+  Standard_EXPORT void SetDeferredGeometryMode(const bool theToDefer);
+
+  Standard_EXPORT bool GetDeferredGeometryMode() const;
+
+  //! Returns true if the shape of the label contains geometry not translated yet.
+  Standard_EXPORT bool HasDeferredGeometry(const TDF_Label& theLabel) const;
+
+  //! Adds to the box the boxes of deferred geometry of the shape of the label
+  //! (placed by the locations of the assembly components).
+  //! @return false if the shape of the label has no deferred geometry
+  Standard_EXPORT bool DeferredGeometryBox(const TDF_Label& theLabel, Bnd_Box& theBox) const;
+
+  //! Translates the deferred geometry of the shape of the label (of all its components
+  //! in case of assembly), replaces the placeholders in the document by the translated shapes
+  //! and updates the assemblies. Colors are read again to reach the translated sub-shapes.
+  //! The reader should keep the work session used by Transfer().
+  //! @return false if the label has no deferred geometry or some items failed to be translated
+  Standard_EXPORT bool TransferDeferredGeometry(
+    const TDF_Label&             theLabel,
+    const Message_ProgressRange& theProgress = Message_ProgressRange());
+
+  //! Translates all deferred geometry of the document.
+  Standard_EXPORT bool TransferDeferredGeometry(
+    const occ::handle<TDocStd_Document>& theDoc,
+    const Message_ProgressRange&         theProgress = Message_ProgressRange());
+
   const NCollection_DataMap<TopoDS_Shape, TDF_Label, TopTools_ShapeMapHasher>& GetShapeLabelMap()
     const
   {
@@ -511,6 +554,11 @@ private:
                       const occ::handle<StepRepr_PropertyDefinition>& theSource,
                       NCollection_List<occ::handle<Transfer_Binder>>& theBinders) const;
 
+  //! Collects the occurrences of placeholders of deferred geometry (translated or not)
+  //! in the shape, with their locations.
+  void collectPlaceholders(const TopoDS_Shape&             theShape,
+                           NCollection_List<TopoDS_Shape>& thePlaceholders) const;
+
 private:
   STEPControl_Reader                                                                   myReader;
   NCollection_DataMap<TCollection_AsciiString, occ::handle<STEPCAFControl_ExternFile>> myFiles;
@@ -525,7 +573,16 @@ private:
   bool                                                            myGDTMode;
   bool                                                            myMatMode;
   bool                                                            myViewMode;
+  bool                                                            myDeferredGeometryMode;
+  bool                                                            myMergeDuplicatesMode;
   NCollection_DataMap<occ::handle<Standard_Transient>, TDF_Label> myGDTMap;
+
+  // placeholders of deferred geometry mapped to the STEP items and to the translated shapes
+  NCollection_IndexedDataMap<TopoDS_Shape,
+                             STEPControl_ActorRead::DeferredItem,
+                             TopTools_ShapeMapHasher>
+                                                                           myDeferredItems;
+  NCollection_DataMap<TopoDS_Shape, TopoDS_Shape, TopTools_ShapeMapHasher> myDeferredResults;
 };
 
 #endif // _STEPCAFControl_Reader_HeaderFile
@@ -16,6 +16,7 @@
 //    gka 05.04.99 S4136: eliminate parameter lastpreci
 // gka,abv 14.04.99 S4136: maintain unit context, precision and maxtolerance values
 
+#include <Bnd_Box.hxx>
 #include <BRep_Builder.hxx>
 #include <BRepCheck_Shell.hxx>
 #include <BRepCheck_Status.hxx>
@@ -46,6 +47,7 @@
 #include <StepDimTol_GeometricTolerance.hxx>
 #include <StepDimTol_GeoTolAndGeoTolWthDatRefAndModGeoTolAndPosTol.hxx>
 #include <StepGeom_Axis2Placement3d.hxx>
+#include <StepGeom_CartesianPoint.hxx>
 #include <StepGeom_CartesianTransformationOperator3d.hxx>
 #include <StepGeom_Direction.hxx>
 #include <StepGeom_GeometricRepresentationContextAndGlobalUnitAssignedContext.hxx>
@@ -115,6 +117,7 @@
 #include <NCollection_IndexedMap.hxx>
 #include <NCollection_List.hxx>
 #include <NCollection_Map.hxx>
+#include <NCollection_Vector.hxx>
 #include <Transfer_Binder.hxx>
 #include <Transfer_TransientProcess.hxx>
 #include <TransferBRep.hxx>
@@ -206,6 +209,53 @@ namespace
 // The better way is to pass this information via binder or via TopoDS_Shape itself, however,
 // this is very specific info to do so...
 bool NM_DETECTED = false;
+
+//! Returns true if the item is a BRep item which translation can be deferred.
+bool isDeferrableItem(const occ::handle<StepRepr_RepresentationItem>& theItem)
+{
+  return theItem->IsKind(STANDARD_TYPE(StepShape_ManifoldSolidBrep))
+         || theItem->IsKind(STANDARD_TYPE(StepShape_ShellBasedSurfaceModel))
+         || theItem->IsKind(STANDARD_TYPE(StepShape_FaceBasedSurfaceModel))
+         || theItem->IsKind(STANDARD_TYPE(StepShape_EdgeBasedWireframeModel))
+         || theItem->IsKind(STANDARD_TYPE(StepShape_GeometricSet));
+}
+
+//! Adds the cartesian points referenced (directly or not) by the item to the box.
+//! The points include the poles of B-splines, so the box may be larger than the shape one.
+void addItemPoints(const occ::handle<StepRepr_RepresentationItem>& theItem,
+                   const Interface_Graph&                          theGraph,
+                   const double                                    theLengthFactor,
+                   Bnd_Box&                                        theBox)
+{
+  NCollection_Map<occ::handle<Standard_Transient>>  aVisited;
+  NCollection_Vector<occ::handle<Standard_Transient>> aStack;
+  aStack.Append(theItem);
+  aVisited.Add(theItem);
+  while (!aStack.IsEmpty())
+  {
+    const occ::handle<Standard_Transient> anEntity = aStack.Last();
+    aStack.EraseLast();
+    occ::handle<StepGeom_CartesianPoint> aPoint = occ::down_cast<StepGeom_CartesianPoint>(anEntity);
+    if (!aPoint.IsNull())
+    {
+      if (aPoint->NbCoordinates() == 3)
+      {
+        theBox.Add(gp_Pnt(aPoint->CoordinatesValue(1) * theLengthFactor,
+                          aPoint->CoordinatesValue(2) * theLengthFactor,
+                          aPoint->CoordinatesValue(3) * theLengthFactor));
+      }
+      continue;
+    }
+    for (Interface_EntityIterator aShareds = theGraph.Shareds(anEntity); aShareds.More();
+         aShareds.Next())
+    {
+      if (aVisited.Add(aShareds.Value()))
+      {
+        aStack.Append(aShareds.Value());
+      }
+    }
+  }
+}
 } // namespace
 
 // ============================================================================
@@ -216,7 +266,8 @@ bool NM_DETECTED = false;
 STEPControl_ActorRead::STEPControl_ActorRead(const occ::handle<Interface_InterfaceModel>& theModel)
     : myPrecision(0.0),
       myMaxTol(0.0),
-      myModel(theModel)
+      myModel(theModel),
+      myToDeferGeometry(false)
 {
 }
 
@@ -980,7 +1031,14 @@ occ::handle<TransferBRep_ShapeBinder> STEPControl_ActorRead::TransferEntity(
     occ::handle<Transfer_Binder> binder;
     if (!TP->IsBound(anitem))
     {
-      binder = TransferShape(anitem, TP, aLocalFactors, isManifold, false, aRange);
+      if (myToDeferGeometry && isManifold && isDeferrableItem(anitem))
+      {
+        binder = deferItem(anitem, sr, TP, aLocalFactors);
+      }
+      else
+      {
+        binder = TransferShape(anitem, TP, aLocalFactors, isManifold, false, aRange);
+      }
     }
     else
     {
@@ -2422,3 +2480,48 @@ TopoDS_Shape STEPControl_ActorRead::TransferRelatedSRR(
   }
   return aResult;
 }
+
+//=================================================================================================
+
+occ::handle<Transfer_Binder> STEPControl_ActorRead::deferItem(
+  const occ::handle<StepRepr_RepresentationItem>&   theItem,
+  const occ::handle<StepShape_ShapeRepresentation>& theRep,
+  const occ::handle<Transfer_TransientProcess>&     theTP,
+  const StepData_Factors&                           theLocalFactors)
+{
+  TopoDS_Compound aPlaceholder;
+  BRep_Builder().MakeCompound(aPlaceholder);
+
+  DeferredItem aDeferred;
+  aDeferred.Item           = theItem;
+  aDeferred.Representation = theRep;
+  addItemPoints(theItem, theTP->Graph(), theLocalFactors.LengthFactor(), aDeferred.Box);
+  myDeferredItems.Add(aPlaceholder, aDeferred);
+
+  occ::handle<TransferBRep_ShapeBinder> aBinder = new TransferBRep_ShapeBinder(aPlaceholder);
+  theTP->Bind(theItem, aBinder);
+  return aBinder;
+}
+
+//=================================================================================================
+
+TopoDS_Shape STEPControl_ActorRead::TransferDeferredItem(
+  const DeferredItem&                           theItem,
+  const occ::handle<Transfer_TransientProcess>& theTP,
+  const Message_ProgressRange&                  theProgress)
+{
+  occ::handle<StepData_StepModel> aStepModel = occ::down_cast<StepData_StepModel>(theTP->Model());
+  StepData_Factors                aLocalFactors;
+  aLocalFactors.SetCascadeUnit(aStepModel->LocalLengthUnit());
+  occ::handle<StepRepr_Representation> anOldSRContext = mySRContext;
+  PrepareUnits(theItem.Representation, theTP, aLocalFactors);
+
+  const bool aToDefer = myToDeferGeometry;
+  myToDeferGeometry   = false;
+  theTP->Unbind(theItem.Item);
+  occ::handle<Transfer_Binder> aBinder =
+    TransferShape(theItem.Item, theTP, aLocalFactors, true, false, theProgress);
+  myToDeferGeometry = aToDefer;
+  mySRContext       = anOldSRContext;
+  return TransferBRep::ShapeResult(aBinder);
+}
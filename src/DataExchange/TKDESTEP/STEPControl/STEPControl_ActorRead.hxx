@@ -20,7 +20,10 @@
 #include <Standard.hxx>
 #include <Standard_Type.hxx>
 
+#include <Bnd_Box.hxx>
 #include <StepData_Factors.hxx>
+#include <StepRepr_RepresentationItem.hxx>
+#include <StepShape_ShapeRepresentation.hxx>
 #include <StepToTopoDS_NMTool.hxx>
 #include <Transfer_ActorOfTransientProcess.hxx>
 #include <Standard_Integer.hxx>
@@ -61,6 +64,16 @@ class StepData_StepModel;
 class STEPControl_ActorRead : public Transfer_ActorOfTransientProcess
 {
 
+public:
+  //! Shape item of a shape representation which translation is deferred
+  //! (see SetDeferredGeometryMode()).
+  struct DeferredItem
+  {
+    occ::handle<StepRepr_RepresentationItem>   Item;           //!< BRep item (solid, shells, etc.)
+    occ::handle<StepShape_ShapeRepresentation> Representation; //!< representation of the item
+    Bnd_Box                                    Box;            //!< box of the points of the item
+  };
+
 public:
   Standard_EXPORT STEPControl_ActorRead(const occ::handle<Interface_InterfaceModel>& theModel);
 
@@ -114,6 +127,34 @@ public:
                                     gp_Trsf&                                                Trsf,
                                     const StepData_Factors& theLocalFactors = StepData_Factors());
 
+  //! Defines whether the translation of BRep items (solids, shells, geometric sets, etc.)
+  //! of manifold shape representations is deferred. In this mode each such item is
+  //! translated into an empty compound (placeholder) bound to the item, and the item is
+  //! recorded in DeferredItems() to be translated later by TransferDeferredItem().
+  //! The product structure and the placements are translated as usual.
+  void SetDeferredGeometryMode(const bool theToDefer) { myToDeferGeometry = theToDefer; }
+
+  //! Returns true if the translation of BRep items is deferred.
+  bool DeferredGeometryMode() const { return myToDeferGeometry; }
+
+  //! Returns the deferred items mapped by their placeholders.
+  const NCollection_IndexedDataMap<TopoDS_Shape, DeferredItem, TopTools_ShapeMapHasher>&
+    DeferredItems() const
+  {
+    return myDeferredItems;
+  }
+
+  //! Forgets the deferred items.
+  void ClearDeferredItems() { myDeferredItems.Clear(); }
+
+  //! Translates the deferred item in the context of its representation.
+  //! The placeholder bound to the item is replaced by the result in the transient process.
+  //! @return translated shape or null shape in case of failure
+  Standard_EXPORT TopoDS_Shape
+    TransferDeferredItem(const DeferredItem&                           theItem,
+                         const occ::handle<Transfer_TransientProcess>& theTP,
+                         const Message_ProgressRange& theProgress = Message_ProgressRange());
+
   DEFINE_STANDARD_RTTIEXT(STEPControl_ActorRead, Transfer_ActorOfTransientProcess)
 
 protected:
@@ -223,12 +264,20 @@ private:
                        TopoDS_Compound&                                  theCund,
                        Message_ProgressScope&                            thePS);
 
+  //! Creates the placeholder of the deferred item and binds it to the item.
+  occ::handle<Transfer_Binder> deferItem(const occ::handle<StepRepr_RepresentationItem>&   theItem,
+                                         const occ::handle<StepShape_ShapeRepresentation>& theRep,
+                                         const occ::handle<Transfer_TransientProcess>&     theTP,
+                                         const StepData_Factors& theLocalFactors);
+
 private:
   StepToTopoDS_NMTool                   myNMTool;
   double                                myPrecision;
   double                                myMaxTol;
   occ::handle<StepRepr_Representation>  mySRContext;
   occ::handle<Interface_InterfaceModel> myModel;
+  bool                                  myToDeferGeometry;
+  NCollection_IndexedDataMap<TopoDS_Shape, DeferredItem, TopTools_ShapeMapHasher> myDeferredItems;
 };
 
 #endif // _STEPControl_ActorRead_HeaderFile
@@ -284,6 +284,20 @@ STEPControl_Controller::STEPControl_Controller()
     Interface_Static::Init("step", "read.step.root.transformation", '&', "eval ON");
     Interface_Static::SetCVal("read.step.root.transformation", "ON");
 
+    // Parsing of DATA section of memory-mapped file in parallel threads: Off by default
+    Interface_Static::Init("step", "read.step.parallel.parse", 'e', "");
+    Interface_Static::Init("step", "read.step.parallel.parse", '&', "enum 0");
+    Interface_Static::Init("step", "read.step.parallel.parse", '&', "eval Off");
+    Interface_Static::Init("step", "read.step.parallel.parse", '&', "eval On");
+    Interface_Static::SetIVal("read.step.parallel.parse", 0);
+
+    // Building of the entity graph from the file data: Off by default
+    Interface_Static::Init("step", "read.step.data.graph", 'e', "");
+    Interface_Static::Init("step", "read.step.data.graph", '&', "enum 0");
+    Interface_Static::Init("step", "read.step.data.graph", '&', "eval Off");
+    Interface_Static::Init("step", "read.step.data.graph", '&', "eval On");
+    Interface_Static::SetIVal("read.step.data.graph", 0);
+
     // STEP file encoding for names translation
     // Note: the numbers should be consistent with Resource_FormatType enumeration
     Interface_Static::Init("step", "read.step.codepage", 'e', "");
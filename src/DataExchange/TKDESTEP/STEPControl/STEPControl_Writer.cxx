@@ -184,6 +184,7 @@ IFSelect_ReturnStatus STEPControl_Writer::WriteStream(std::ostream& theOStream)
   }
 
   StepData_StepWriter aWriter(aModel);
+  aWriter.SetStream(&theOStream);
   aWriter.SendModel(aProtocol);
   APIHeaderSection_MakeHeader aHeaderMaker;
   aHeaderMaker.Apply(aModel);
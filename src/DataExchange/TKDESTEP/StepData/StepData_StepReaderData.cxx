@@ -16,6 +16,8 @@
 //    (if entity's items are not in alphabetical order)
 
 #include <Interface_Check.hxx>
+#include <Interface_EntityGraph.hxx>
+#include <Interface_InterfaceModel.hxx>
 #include <TCollection_HAsciiString.hxx>
 #include <NCollection_Array1.hxx>
 #include <NCollection_HArray1.hxx>
@@ -36,6 +38,7 @@
 #include <StepData_SelectType.hxx>
 #include <StepData_StepReaderData.hxx>
 #include <NCollection_IncAllocator.hxx>
+#include <OSD_MemInfo.hxx>
 #include <TCollection_AsciiString.hxx>
 #include <TCollection_ExtendedString.hxx>
 #include <NCollection_UtfIterator.hxx>
@@ -1420,6 +1423,243 @@ bool StepData_StepReaderData::ReadReal(const int                     num,
   return false;
 }
 
+//! Reads numeric parameter as Real; returns FALSE (and 0) if it is not a number.
+static bool readNumber(const Interface_FileParameter& theParam, double& theValue)
+{
+  if (theParam.ParamType() == Interface_ParamReal
+      || theParam.ParamType() == Interface_ParamInteger)
+  {
+    theValue = Interface_FileReaderData::Fastof(theParam.CValue());
+    return true;
+  }
+  theValue = 0.0;
+  return false;
+}
+
+//! Reads numeric parameter as Integer; returns FALSE if it is not an integer (Real is rounded).
+static bool readNumber(const Interface_FileParameter& theParam, int& theValue)
+{
+  if (theParam.ParamType() == Interface_ParamInteger)
+  {
+    theValue = atoi(theParam.CValue());
+    return true;
+  }
+  theValue = theParam.ParamType() == Interface_ParamReal
+               ? static_cast<int>(std::round(Interface_FileReaderData::Fastof(theParam.CValue())))
+               : 0;
+  return false;
+}
+
+//! Reads sub-list <theNumSub> of numbers into the row of array;
+//! missing or invalid items are set to 0.
+//! @return FALSE if sub-list has invalid items or its length differs from the row length
+template <typename TheItemType>
+static bool readArrayRow(const StepData_StepReaderData&   theData,
+                         const int                        theNumSub,
+                         const int                        theRow,
+                         NCollection_Array2<TheItemType>& theArray)
+{
+  const int aNbCols  = theArray.NbColumns();
+  const int aNbItems = theNumSub > 0 ? theData.NbParams(theNumSub) : 0;
+  bool      isOk     = theNumSub > 0 && aNbItems == aNbCols;
+  for (int aCol = 1; aCol <= aNbCols; ++aCol)
+  {
+    TheItemType& aValue = theArray.ChangeValue(theRow, aCol);
+    aValue              = TheItemType(0);
+    if (aCol <= aNbItems)
+    {
+      isOk = readNumber(theData.Param(theNumSub, aCol), aValue) && isOk;
+    }
+  }
+  return isOk;
+}
+
+//! Reads list of sub-lists of numbers into 2D array.
+template <typename TheItemType>
+static bool readArray2(const StepData_StepReaderData&                 theData,
+                       const int                                      theNumSub,
+                       occ::handle<NCollection_HArray2<TheItemType>>& theArray)
+{
+  const int aNbRows = theData.NbParams(theNumSub);
+  if (aNbRows == 0)
+  {
+    return true;
+  }
+
+  // the first item defines the row length; it must be a sub-list itself,
+  // otherwise NbParams(0) would return the number of parameters of the whole file
+  const int aNumFirst = theData.SubListNumber(theNumSub, 1, false);
+  if (aNumFirst == 0)
+  {
+    return false;
+  }
+
+  const int aNbCols = theData.NbParams(aNumFirst);
+  if (aNbCols == 0)
+  {
+    return false;
+  }
+
+  theArray  = new NCollection_HArray2<TheItemType>(1, aNbRows, 1, aNbCols);
+  bool isOk = true;
+  for (int aRow = 1; aRow <= aNbRows; ++aRow)
+  {
+    isOk = readArrayRow(theData,
+                        theData.SubListNumber(theNumSub, aRow, false),
+                        aRow,
+                        theArray->ChangeArray2())
+           && isOk;
+  }
+  return isOk;
+}
+
+//=================================================================================================
+
+bool StepData_StepReaderData::ReadXYZArray(const int                                 num,
+                                           const int                                 nump,
+                                           const char*                               mess,
+                                           occ::handle<Interface_Check>&             ach,
+                                           occ::handle<NCollection_HArray1<gp_XYZ>>& val) const
+{
+  val.Nullify();
+  int numsub = 0;
+  if (!ReadSubList(num, nump, mess, ach, numsub))
+  {
+    return false;
+  }
+
+  const int aNbPoints = NbParams(numsub);
+  if (aNbPoints == 0)
+  {
+    return true;
+  }
+
+  val            = new NCollection_HArray1<gp_XYZ>(1, aNbPoints);
+  bool isOk      = true;
+  bool hasExtras = false;
+  for (int aPntIter = 1; aPntIter <= aNbPoints; ++aPntIter)
+  {
+    const int aNumXYZ   = SubListNumber(numsub, aPntIter, false);
+    const int aNbCoords = aNumXYZ > 0 ? NbParams(aNumXYZ) : 0;
+    gp_XYZ&   aXYZ      = val->ChangeValue(aPntIter);
+    aXYZ.SetCoord(0.0, 0.0, 0.0);
+    isOk      = isOk && aNumXYZ > 0;
+    hasExtras = hasExtras || aNbCoords > 3;
+    for (int aCoord = 1; aCoord <= std::min(aNbCoords, 3); ++aCoord)
+    {
+      isOk = readNumber(Param(aNumXYZ, aCoord), aXYZ.ChangeCoord(aCoord)) && isOk;
+    }
+  }
+
+  char txtmes[200];
+  if (hasExtras)
+  {
+    const char* aWarnMess = "Parameter n0.%d (%s) : more than 3 coordinates, ignored";
+    Sprintf(txtmes, aWarnMess, nump, mess);
+    ach->AddWarning(txtmes, aWarnMess);
+  }
+  if (isOk)
+  {
+    return true;
+  }
+
+  const char* errmess = "Parameter n0.%d (%s) : some points are not lists of Reals";
+  Sprintf(txtmes, errmess, nump, mess);
+  ach->AddFail(txtmes, errmess);
+  return false;
+}
+
+//=================================================================================================
+
+bool StepData_StepReaderData::ReadRealArray2(const int                                 num,
+                                             const int                                 nump,
+                                             const char*                               mess,
+                                             occ::handle<Interface_Check>&             ach,
+                                             occ::handle<NCollection_HArray2<double>>& val) const
+{
+  val.Nullify();
+  int numsub = 0;
+  if (!ReadSubList(num, nump, mess, ach, numsub))
+  {
+    return false;
+  }
+  else if (readArray2(*this, numsub, val))
+  {
+    return true;
+  }
+
+  char        txtmes[200];
+  const char* errmess = "Parameter n0.%d (%s) : some items are not lists of Reals";
+  Sprintf(txtmes, errmess, nump, mess);
+  ach->AddFail(txtmes, errmess);
+  return false;
+}
+
+//=================================================================================================
+
+bool StepData_StepReaderData::ReadIntegerArray(const int                              num,
+                                               const int                              nump,
+                                               const char*                            mess,
+                                               occ::handle<Interface_Check>&          ach,
+                                               occ::handle<NCollection_HArray1<int>>& val) const
+{
+  val.Nullify();
+  int numsub = 0;
+  if (!ReadSubList(num, nump, mess, ach, numsub))
+  {
+    return false;
+  }
+
+  const int aNbValues = NbParams(numsub);
+  if (aNbValues == 0)
+  {
+    return true;
+  }
+
+  val       = new NCollection_HArray1<int>(1, aNbValues);
+  bool isOk = true;
+  for (int aValIter = 1; aValIter <= aNbValues; ++aValIter)
+  {
+    isOk = readNumber(Param(numsub, aValIter), val->ChangeValue(aValIter)) && isOk;
+  }
+  if (isOk)
+  {
+    return true;
+  }
+
+  char        txtmes[200];
+  const char* errmess = "Parameter n0.%d (%s) : some items are not Integers";
+  Sprintf(txtmes, errmess, nump, mess);
+  ach->AddFail(txtmes, errmess);
+  return false;
+}
+
+//=================================================================================================
+
+bool StepData_StepReaderData::ReadIntegerArray2(const int                              num,
+                                                const int                              nump,
+                                                const char*                            mess,
+                                                occ::handle<Interface_Check>&          ach,
+                                                occ::handle<NCollection_HArray2<int>>& val) const
+{
+  val.Nullify();
+  int numsub = 0;
+  if (!ReadSubList(num, nump, mess, ach, numsub))
+  {
+    return false;
+  }
+  else if (readArray2(*this, numsub, val))
+  {
+    return true;
+  }
+
+  char        txtmes[200];
+  const char* errmess = "Parameter n0.%d (%s) : some items are not lists of Integers";
+  Sprintf(txtmes, errmess, nump, mess);
+  ach->AddFail(txtmes, errmess);
+  return false;
+}
+
 //  ##  ##  ##  ##  ##  ##  ##  ##  ##  ##  ##  ##  ##  ##  ##  ##  ##  ##  ##
 
 //=================================================================================================
@@ -1962,6 +2202,7 @@ void StepData_StepReaderData::SetEntityNumbers(const bool withmap)
   int                                   nbdirec = NbRecords();
   occ::handle<NCollection_IncAllocator> anAlloc =
     new NCollection_IncAllocator(NCollection_IncAllocator::THE_MINIMUM_BLOCK_SIZE);
+  anAlloc->SetMemTag(OSD_MemInfo::MemTag_StepData);
   NCollection_Array1<int> subn(0, thelastn);
 
   bool                        pbmap = false; // at least one conflict
@@ -2500,3 +2741,102 @@ const occ::handle<Interface_Check> StepData_StepReaderData::GlobalCheck() const
 {
   return thecheck;
 }
+
+//=================================================================================================
+
+void StepData_StepReaderData::addSharedRecords(const int                      theRecord,
+                                               const int                      theEntity,
+                                               const NCollection_Array1<int>& theModelNums,
+                                               Interface_EntityGraph&         theGraph) const
+{
+  const int aNbParams = NbParams(theRecord);
+  for (int aParamIter = 1; aParamIter <= aNbParams; ++aParamIter)
+  {
+    const Interface_FileParameter& aParam  = Param(theRecord, aParamIter);
+    const int                      aRefNum = aParam.EntityNumber();
+    if (aRefNum <= 0)
+    {
+      continue;
+    }
+    if (aParam.ParamType() == Interface_ParamSub)
+    {
+      // sub-lists are always recorded before the record referring them
+      if (aRefNum < theRecord)
+      {
+        addSharedRecords(aRefNum, theEntity, theModelNums, theGraph);
+      }
+    }
+    else if (aParam.ParamType() == Interface_ParamIdent)
+    {
+      const int aShared = theModelNums.Value(aRefNum);
+      if (aShared > 0 && aShared != theEntity)
+      {
+        theGraph.AddShared(theEntity, aShared);
+      }
+      else if (aShared < 0)
+      {
+        theGraph.SetShareError(theEntity);
+      }
+    }
+  }
+}
+
+//=================================================================================================
+
+occ::handle<Interface_EntityGraph> StepData_StepReaderData::BuildEntityGraph(
+  const occ::handle<Interface_InterfaceModel>& theModel) const
+{
+  if (theModel.IsNull())
+  {
+    return occ::handle<Interface_EntityGraph>();
+  }
+
+  // number in the model of the entity bound to each record:
+  // 0 for records without entity, -1 for entities absent in the model
+  const int               aNbEntities = theModel->NbEntities();
+  NCollection_Array1<int> aModelNums(0, NbRecords());
+  aModelNums.Init(0);
+  int aNbMapped = 0, aLastNum = 0;
+  for (int aRecord = FindNextRecord(0); aRecord > 0; aRecord = FindNextRecord(aRecord))
+  {
+    const occ::handle<Standard_Transient>& anEnt = BoundEntity(aRecord);
+    if (anEnt.IsNull())
+    {
+      continue;
+    }
+    const int aNum = theModel->Number(anEnt);
+    if (aNum == 0)
+    {
+      aModelNums.SetValue(aRecord, -1);
+      continue;
+    }
+    if (aNum <= aLastNum)
+    {
+      // entities have been added to the model in another order than records
+      return occ::handle<Interface_EntityGraph>();
+    }
+    aModelNums.SetValue(aRecord, aNum);
+    aLastNum = aNum;
+    ++aNbMapped;
+  }
+  if (aNbMapped != aNbEntities)
+  {
+    return occ::handle<Interface_EntityGraph>();
+  }
+
+  occ::handle<Interface_EntityGraph> aGraph = new Interface_EntityGraph(aNbEntities);
+  for (int aRecord = FindNextRecord(0); aRecord > 0; aRecord = FindNextRecord(aRecord))
+  {
+    const int anEntity = aModelNums.Value(aRecord);
+    if (anEntity <= 0)
+    {
+      continue;
+    }
+    for (int aPart = aRecord; aPart > 0; aPart = NextForComplex(aPart))
+    {
+      addSharedRecords(aPart, anEntity, aModelNums, *aGraph);
+    }
+  }
+  aGraph->Build();
+  return aGraph;
+}
@@ -26,6 +26,9 @@
 #include <Standard_Integer.hxx>
 #include <NCollection_DataMap.hxx>
 #include <Interface_FileReaderData.hxx>
+#include <gp_XYZ.hxx>
+#include <NCollection_HArray1.hxx>
+#include <NCollection_HArray2.hxx>
 #include <Standard_CString.hxx>
 #include <Interface_ParamType.hxx>
 #include <NCollection_Sequence.hxx>
@@ -41,6 +44,8 @@ class StepData_FieldList;
 class StepData_SelectType;
 class TCollection_HAsciiString;
 class StepData_EnumTool;
+class Interface_EntityGraph;
+class Interface_InterfaceModel;
 
 //! Specific FileReaderData for Step
 //! Contains literal description of entities (for each one : type
@@ -289,6 +294,45 @@ public:
                                 occ::handle<Interface_Check>& ach,
                                 double&                       val) const;
 
+  //! Reads parameter <nump> of record <num> as a list of sub-lists of three Reals,
+  //! e.g. coordinates of tessellated geometry, directly into array of points.
+  //! Unlike reading item by item, the Check is fed by a single message for the whole list:
+  //! missing or non-numeric coordinates are read as 0, extra coordinates are ignored.
+  //! <val> remains Null if parameter is not a list or is an empty list.
+  Standard_EXPORT bool ReadXYZArray(const int                                 num,
+                                    const int                                 nump,
+                                    const char*                               mess,
+                                    occ::handle<Interface_Check>&             ach,
+                                    occ::handle<NCollection_HArray1<gp_XYZ>>& val) const;
+
+  //! Reads parameter <nump> of record <num> as a list of sub-lists of Reals of equal length
+  //! (defined by the first sub-list), e.g. normals of tessellated geometry.
+  //! Check is managed as by ReadXYZArray(); the list of plain Reals (not of sub-lists) fails.
+  //! <val> remains Null if parameter is not a list or is an empty list.
+  Standard_EXPORT bool ReadRealArray2(const int                                 num,
+                                      const int                                 nump,
+                                      const char*                               mess,
+                                      occ::handle<Interface_Check>&             ach,
+                                      occ::handle<NCollection_HArray2<double>>& val) const;
+
+  //! Reads parameter <nump> of record <num> as a list of Integers,
+  //! e.g. point indices of tessellated geometry. Check is managed as by ReadXYZArray().
+  //! <val> remains Null if parameter is not a list or is an empty list.
+  Standard_EXPORT bool ReadIntegerArray(const int                              num,
+                                        const int                              nump,
+                                        const char*                            mess,
+                                        occ::handle<Interface_Check>&          ach,
+                                        occ::handle<NCollection_HArray1<int>>& val) const;
+
+  //! Reads parameter <nump> of record <num> as a list of sub-lists of Integers of equal length
+  //! (defined by the first sub-list), e.g. triangles of tessellated geometry.
+  //! Check is managed as by ReadRealArray2().
+  Standard_EXPORT bool ReadIntegerArray2(const int                              num,
+                                         const int                              nump,
+                                         const char*                            mess,
+                                         occ::handle<Interface_Check>&          ach,
+                                         occ::handle<NCollection_HArray2<int>>& val) const;
+
   //! Reads parameter <nump> of record <num> as a single Entity.
   //! Return value and Check managed as by ReadReal (demands a
   //! reference to an Entity). In Addition, demands read Entity
@@ -445,6 +489,15 @@ public:
   //! Undefined References (detected by SetEntityNumbers)
   Standard_EXPORT const occ::handle<Interface_Check> GlobalCheck() const;
 
+  //! Builds the table of references between the entities of the model
+  //! straight from the parameters of the records, in one pass and without
+  //! calling the General modules; to be called once the entities are loaded.
+  //! References to entities absent in the model are registered as share errors.
+  //! @param[in] theModel model filled with the entities bound to the records
+  //! @return NULL if the entities of the model do not match the records
+  Standard_EXPORT occ::handle<Interface_EntityGraph> BuildEntityGraph(
+    const occ::handle<Interface_InterfaceModel>& theModel) const;
+
   DEFINE_STANDARD_RTTIEXT(StepData_StepReaderData, Interface_FileReaderData)
 
 private:
@@ -460,6 +513,13 @@ private:
   //! and handle the control directives.
   Standard_EXPORT void cleanText(const occ::handle<TCollection_HAsciiString>& theVal) const;
 
+  //! Adds to the table the entities referred by the record <theRecord> and its sub-lists
+  //! as shared by the entity <theEntity>. [Used by BuildEntityGraph]
+  void addSharedRecords(const int                      theRecord,
+                        const int                      theEntity,
+                        const NCollection_Array1<int>& theModelNums,
+                        Interface_EntityGraph&         theGraph) const;
+
 private:
   NCollection_Array1<int>                         theidents;
   NCollection_Array1<int>                         thetypes;
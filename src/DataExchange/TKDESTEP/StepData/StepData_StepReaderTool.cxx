@@ -12,6 +12,7 @@
 // commercial license or contractual agreement.
 
 #include <Interface_Check.hxx>
+#include <Interface_EntityGraph.hxx>
 #include <MoniTool_Macros.hxx>
 #include <Message.hxx>
 #include <Message_Messenger.hxx>
@@ -249,4 +250,8 @@ void StepData_StepReaderTool::EndRead(const occ::handle<Interface_InterfaceModel
   {
     stepmodel->SetIdentLabel(stepdat->BoundEntity(i), stepdat->RecordIdent(i));
   }
+  if (stepmodel->InternalParameters.ReadDataGraph)
+  {
+    stepmodel->SetEntityGraph(stepdat->BuildEntityGraph(stepmodel));
+  }
 }
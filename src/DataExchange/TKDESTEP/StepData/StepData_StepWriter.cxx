@@ -35,6 +35,7 @@
 #include <TCollection_AsciiString.hxx>
 #include <TCollection_HAsciiString.hxx>
 
+#include <charconv>
 #include <cstdio>
 #define StepLong 72
 // StepLong: maximum length of a Step file line
@@ -64,6 +65,7 @@ StepData_StepWriter::StepData_StepWriter(const occ::handle<StepData_StepModel>&
   themodel   = amodel;
   thelabmode = thetypmode = 0;
   thefile                 = new NCollection_HSequence<occ::handle<TCollection_HAsciiString>>();
+  thestream               = nullptr;
   thesect                 = false;
   thefirst                = true;
   themult                 = false;
@@ -153,7 +155,7 @@ void StepData_StepWriter::SendModel(const occ::handle<StepData_Protocol>& protoc
   StepData_WriterLib lib(protocol);
 
   if (!headeronly)
-    thefile->Append(new TCollection_HAsciiString("ISO-10303-21;"));
+    appendLine("ISO-10303-21;");
   SendHeader();
 
   //  ....                Header: sequence of entities without Ident                ....
@@ -247,7 +249,7 @@ void StepData_StepWriter::SendModel(const occ::handle<StepData_Protocol>& protoc
 void StepData_StepWriter::SendHeader()
 {
   NewLine(false);
-  thefile->Append(new TCollection_HAsciiString("HEADER;"));
+  appendLine("HEADER;");
   thesect = true;
 }
 
@@ -258,7 +260,7 @@ void StepData_StepWriter::SendData()
   if (thesect)
     throw Interface_InterfaceMismatch("StepWriter : Data section");
   NewLine(false);
-  thefile->Append(new TCollection_HAsciiString("DATA;"));
+  appendLine("DATA;");
   thesect = true;
 }
 
@@ -266,7 +268,7 @@ void StepData_StepWriter::SendData()
 
 void StepData_StepWriter::EndSec()
 {
-  thefile->Append(new TCollection_HAsciiString("ENDSEC;"));
+  appendLine("ENDSEC;");
   thesect = false;
 }
 
@@ -277,7 +279,7 @@ void StepData_StepWriter::EndFile()
   if (thesect)
     throw Interface_InterfaceMismatch("StepWriter : EndFile");
   NewLine(false);
-  thefile->Append(new TCollection_HAsciiString("END-ISO-10303-21;"));
+  appendLine("END-ISO-10303-21;");
   thesect = false;
 }
 
@@ -412,7 +414,7 @@ void StepData_StepWriter::NewLine(const bool evenempty)
 {
   if (evenempty || thecurr.Length() > 0)
   {
-    thefile->Append(thecurr.Moved());
+    flushLine();
   }
   int indst = thelevel * 2;
   if (theindent)
@@ -462,7 +464,7 @@ void StepData_StepWriter::SendScope()
 void StepData_StepWriter::SendEndscope()
 {
   NewLine(false);
-  thefile->Append(new TCollection_HAsciiString(textendscope));
+  appendLine(textendscope.ToCString());
 }
 
 //=================================================================================================
@@ -806,8 +808,8 @@ void StepData_StepWriter::Send(const int val)
 {
   char lval[12];
   AddParam();
-  Sprintf(lval, "%d", val);
-  AddString(lval, (int)strlen(lval));
+  const std::to_chars_result aRes = std::to_chars(lval, lval + sizeof(lval), val);
+  AddString(lval, (int)(aRes.ptr - lval));
 }
 
 //=================================================================================================
@@ -845,7 +847,7 @@ void StepData_StepWriter::Send(const TCollection_AsciiString& val)
   //: i2
   else
   {
-    thefile->Append(thecurr.Moved());
+    flushLine();
     int anIndst = thelevel * 2;
     if (theindent)
       anIndst += theindval;
@@ -883,7 +885,7 @@ void StepData_StepWriter::Send(const TCollection_AsciiString& val)
           }
         }
         TCollection_AsciiString aBval = aVal.Split(aStop);
-        thefile->Append(new TCollection_HAsciiString(aVal));
+        appendLine(aVal.ToCString());
         aVal = aBval;
         aNn -= aStop;
       }
@@ -1054,6 +1056,83 @@ void StepData_StepWriter::SendArrReal(const occ::handle<NCollection_HArray1<doub
 
 //=================================================================================================
 
+void StepData_StepWriter::SendIntegerArray(const occ::handle<NCollection_HArray1<int>>& theArray)
+{
+  OpenSub();
+  if (!theArray.IsNull())
+  {
+    for (int anIter = theArray->Lower(); anIter <= theArray->Upper(); ++anIter)
+    {
+      Send(theArray->Value(anIter));
+    }
+  }
+  CloseSub();
+}
+
+//=================================================================================================
+
+void StepData_StepWriter::SendIntegerArray2(const occ::handle<NCollection_HArray2<int>>& theArray)
+{
+  OpenSub();
+  if (!theArray.IsNull())
+  {
+    for (int aRow = theArray->LowerRow(); aRow <= theArray->UpperRow(); ++aRow)
+    {
+      NewLine(false);
+      OpenSub();
+      for (int aCol = theArray->LowerCol(); aCol <= theArray->UpperCol(); ++aCol)
+      {
+        Send(theArray->Value(aRow, aCol));
+      }
+      CloseSub();
+    }
+  }
+  CloseSub();
+}
+
+//=================================================================================================
+
+void StepData_StepWriter::SendRealArray2(const occ::handle<NCollection_HArray2<double>>& theArray)
+{
+  OpenSub();
+  if (!theArray.IsNull())
+  {
+    for (int aRow = theArray->LowerRow(); aRow <= theArray->UpperRow(); ++aRow)
+    {
+      NewLine(false);
+      OpenSub();
+      for (int aCol = theArray->LowerCol(); aCol <= theArray->UpperCol(); ++aCol)
+      {
+        Send(theArray->Value(aRow, aCol));
+      }
+      CloseSub();
+    }
+  }
+  CloseSub();
+}
+
+//=================================================================================================
+
+void StepData_StepWriter::SendXYZArray(const occ::handle<NCollection_HArray1<gp_XYZ>>& theArray)
+{
+  OpenSub();
+  if (!theArray.IsNull())
+  {
+    for (int anIter = theArray->Lower(); anIter <= theArray->Upper(); ++anIter)
+    {
+      const gp_XYZ& aPnt = theArray->Value(anIter);
+      OpenSub();
+      Send(aPnt.X());
+      Send(aPnt.Y());
+      Send(aPnt.Z());
+      CloseSub();
+    }
+  }
+  CloseSub();
+}
+
+//=================================================================================================
+
 void StepData_StepWriter::SendUndef()
 {
   AddParam();
@@ -1095,7 +1174,7 @@ void StepData_StepWriter::AddString(const TCollection_AsciiString& astr, const i
 {
   while (!thecurr.CanGet(astr.Length() + more))
   {
-    thefile->Append(thecurr.Moved());
+    flushLine();
     int indst = thelevel * 2;
     if (theindent)
       indst += theindval;
@@ -1110,7 +1189,7 @@ void StepData_StepWriter::AddString(const char* astr, const int lnstr, const int
 {
   while (!thecurr.CanGet(lnstr + more))
   {
-    thefile->Append(thecurr.Moved());
+    flushLine();
     int indst = thelevel * 2;
     if (theindent)
       indst += theindval;
@@ -1144,8 +1223,27 @@ occ::handle<TCollection_HAsciiString> StepData_StepWriter::Line(const int num) c
 
 //=================================================================================================
 
+void StepData_StepWriter::SetStream(Standard_OStream* theStream)
+{
+  thestream = theStream;
+  if (thestream == nullptr)
+  {
+    return;
+  }
+  // lines collected before are sent first to keep the order
+  for (int i = 1; i <= thefile->Length(); i++)
+    *thestream << thefile->Value(i)->ToCString() << "\n";
+  thefile->Clear();
+}
+
+//=================================================================================================
+
 bool StepData_StepWriter::Print(Standard_OStream& S)
 {
+  if (thestream != nullptr && thestream != &S)
+  {
+    thestream->flush();
+  }
   bool isGood = (S.good());
   int  nb     = thefile->Length();
   for (int i = 1; i <= nb && isGood; i++)
@@ -1159,6 +1257,31 @@ bool StepData_StepWriter::Print(Standard_OStream& S)
 
 //=================================================================================================
 
+void StepData_StepWriter::flushLine()
+{
+  if (thestream == nullptr)
+  {
+    thefile->Append(thecurr.Moved());
+    return;
+  }
+  thecurr.Move(thelinebuf);
+  *thestream << thelinebuf.ToCString() << "\n";
+}
+
+//=================================================================================================
+
+void StepData_StepWriter::appendLine(const char* theText)
+{
+  if (thestream == nullptr)
+  {
+    thefile->Append(new TCollection_HAsciiString(theText));
+    return;
+  }
+  *thestream << theText << "\n";
+}
+
+//=================================================================================================
+
 TCollection_AsciiString StepData_StepWriter::CleanTextForSend(
   const TCollection_AsciiString& theText)
 {
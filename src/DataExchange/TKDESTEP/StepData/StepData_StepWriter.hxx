@@ -30,6 +30,8 @@
 #include <Interface_CheckIterator.hxx>
 #include <NCollection_Array1.hxx>
 #include <NCollection_HArray1.hxx>
+#include <NCollection_HArray2.hxx>
+#include <gp_XYZ.hxx>
 #include <Standard_CString.hxx>
 #include <StepData_Logical.hxx>
 #include <Standard_OStream.hxx>
@@ -243,6 +245,23 @@ public:
   //! sends an array of real
   Standard_EXPORT void SendArrReal(const occ::handle<NCollection_HArray1<double>>& anArr);
 
+  //! sends a list of Integers, e.g. point indices of tessellated geometry;
+  //! a Null array is sent as an empty list
+  Standard_EXPORT void SendIntegerArray(const occ::handle<NCollection_HArray1<int>>& theArray);
+
+  //! sends rows of 2D array as a list of sub-lists of Integers, each one on a new line,
+  //! e.g. triangles of tessellated geometry; a Null array is sent as an empty list
+  Standard_EXPORT void SendIntegerArray2(const occ::handle<NCollection_HArray2<int>>& theArray);
+
+  //! sends rows of 2D array as a list of sub-lists of Reals, each one on a new line
+  //! (works with FloatWriter), e.g. normals of tessellated geometry;
+  //! a Null array is sent as an empty list
+  Standard_EXPORT void SendRealArray2(const occ::handle<NCollection_HArray2<double>>& theArray);
+
+  //! sends points as a list of sub-lists of three Reals (works with FloatWriter),
+  //! e.g. coordinates of tessellated geometry; a Null array is sent as an empty list
+  Standard_EXPORT void SendXYZArray(const occ::handle<NCollection_HArray1<gp_XYZ>>& theArray);
+
   //! sends an undefined (optional absent) parameter (by '$')
   Standard_EXPORT void SendUndef();
 
@@ -260,6 +279,16 @@ public:
   //! references
   Standard_EXPORT Interface_CheckIterator CheckList() const;
 
+  //! Sets the stream receiving each line as soon as it is completed.
+  //! Lines are not accumulated then, so the memory used by the writer does not grow
+  //! with the size of the file; NbLines() and Line() only concern the lines
+  //! produced while no stream is set. Lines already accumulated are sent first.
+  //! NULL stream (default) restores accumulation of lines.
+  Standard_EXPORT void SetStream(Standard_OStream* theStream);
+
+  //! Returns the stream set by SetStream(), NULL by default
+  Standard_OStream* Stream() const { return thestream; }
+
   //! Returns count of Lines
   Standard_EXPORT int NbLines() const;
 
@@ -268,6 +297,7 @@ public:
 
   //! writes result on an output defined as an OStream
   //! then clears it
+  //! (lines already sent to the stream set by SetStream() are only flushed)
   Standard_EXPORT bool Print(Standard_OStream& S);
 
   //! Static helper function to prepare text for STEP file output while preserving
@@ -310,8 +340,16 @@ private:
   //! Same as above, but the string is given by CString + Length
   Standard_EXPORT void AddString(const char* str, const int lnstr, const int more = 0);
 
+  //! Ends the current line: sends it to the stream or appends it to the lines
+  void flushLine();
+
+  //! Sends a complete line to the stream or appends it to the lines
+  void appendLine(const char* theText);
+
   occ::handle<StepData_StepModel>                                           themodel;
   occ::handle<NCollection_HSequence<occ::handle<TCollection_HAsciiString>>> thefile;
+  Standard_OStream*                                                         thestream;
+  TCollection_AsciiString                                                   thelinebuf;
   Interface_LineBuffer                                                      thecurr;
   bool                                                                      thesect;
   bool                                                                      thecomm;
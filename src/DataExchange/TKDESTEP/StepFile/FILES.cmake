@@ -5,6 +5,8 @@ set(OCCT_StepFile_FILES
   lex.step.cxx
   step.tab.cxx
   step.tab.hxx
+  StepFile_ParallelReader.cxx
+  StepFile_ParallelReader.hxx
   StepFile_ReadData.cxx
   StepFile_ReadData.hxx
   StepFile_Read.cxx
@@ -0,0 +1,1132 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <StepFile_ParallelReader.hxx>
+
+#include <OSD_FileSystem.hxx>
+#include <OSD_MemInfo.hxx>
+#include <OSD_Parallel.hxx>
+#include <StepData_StepReaderData.hxx>
+
+#ifdef _WIN32
+  #include <windows.h>
+  #include <TCollection_ExtendedString.hxx>
+#else
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+//! Minimal size of the part of DATA section parsed by one thread.
+constexpr size_t THE_MIN_CHUNK_SIZE = 1 << 20;
+
+//! Size of the block for reading of the stream of unknown size.
+constexpr size_t THE_READ_BLOCK_SIZE = 1 << 16;
+
+//! Maximal depth of nested lists.
+constexpr int THE_MAX_LIST_DEPTH = 256;
+
+// Constant texts of records and parameters, the same as used by StepFile_ReadData
+char THE_SUB_LIST_TYPE[]   = "/* (SUB) */";
+char THE_COMPLEX_IDENT[]   = "#0";
+char THE_VOID_VALUE[]      = "$";
+char THE_DERIVED_VALUE[]   = "*";
+char THE_SUB_IDENTS[10][3] = {"$0", "$1", "$2", "$3", "$4", "$5", "$6", "$7", "$8", "$9"};
+
+inline bool isDigit(const char theChar)
+{
+  return theChar >= '0' && theChar <= '9';
+}
+
+//! Returns true for the digit of hexadecimal value; flex rules are case-sensitive here.
+inline bool isHexDigit(const char theChar)
+{
+  return isDigit(theChar) || (theChar >= 'A' && theChar <= 'F');
+}
+
+//! Returns true for the character of enumeration; flex rules are case-sensitive here.
+inline bool isEnumChar(const char theChar)
+{
+  return isDigit(theChar) || (theChar >= 'A' && theChar <= 'Z') || theChar == '_';
+}
+
+inline bool isWordChar(const char theChar)
+{
+  return isDigit(theChar) || (theChar >= 'A' && theChar <= 'Z')
+         || (theChar >= 'a' && theChar <= 'z') || theChar == '_';
+}
+
+inline char toUpper(const char theChar)
+{
+  return (theChar >= 'a' && theChar <= 'z') ? char(theChar - 'a' + 'A') : theChar;
+}
+
+//! Checks case-insensitively that the text starts with the keyword given in upper case.
+inline bool hasKeyword(const char* thePos, const char* theEnd, const char* theKeyword)
+{
+  for (; *theKeyword != '\0'; ++thePos, ++theKeyword)
+  {
+    if (thePos >= theEnd || toUpper(*thePos) != *theKeyword)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+} // namespace
+
+//! Recursive descent parser of the records of a chunk.
+//! It reproduces the tokens of step.lex (longest match of flex rules)
+//! and the records created by StepFile_ReadData for step.yacc grammar.
+class StepFile_ParallelReader::ChunkParser
+{
+public:
+  ChunkParser(Chunk& theChunk, const char* theStart, const char* theEnd)
+      : myChunk(theChunk),
+        myPos(theStart),
+        myEnd(theEnd),
+        myNumSub(0)
+  {
+  }
+
+  //! Returns the current position.
+  const char* Position() const { return myPos; }
+
+  //! Parses the beginning of the file up to the start of DATA section.
+  bool ParseHeader()
+  {
+    if (!skipBlanks() || (!skipIsoKeyword("ISO") && !skipKeyword("STEP;")))
+    {
+      return false;
+    }
+    if (!skipBlanks() || !skipKeyword("HEADER;"))
+    {
+      return false;
+    }
+    for (;;)
+    {
+      if (!skipBlanks())
+      {
+        return false;
+      }
+      if (skipKeyword("ENDSEC;"))
+      {
+        break;
+      }
+      if (!parseTypedRecord(THE_COMPLEX_IDENT) || !skipChar(';'))
+      {
+        return false;
+      }
+    }
+    return skipBlanks() && skipKeyword("DATA;");
+  }
+
+  //! Parses the entities of DATA section up to the end of the chunk.
+  ChunkStatus ParseData()
+  {
+    for (;;)
+    {
+      if (!skipBlanks())
+      {
+        return ChunkStatus_Failed;
+      }
+      if (myChunk.End != nullptr)
+      {
+        if (myPos == myChunk.End)
+        {
+          return ChunkStatus_Done;
+        }
+        else if (myPos > myChunk.End)
+        {
+          return ChunkStatus_Overshoot;
+        }
+      }
+      if (myPos >= myEnd)
+      {
+        return ChunkStatus_Failed;
+      }
+      if (*myPos == '#')
+      {
+        if (!parseEntity())
+        {
+          return ChunkStatus_Failed;
+        }
+        continue;
+      }
+      if (skipKeyword("ENDSEC;"))
+      {
+        return ChunkStatus_Finished;
+      }
+      return ChunkStatus_Failed;
+    }
+  }
+
+  //! Parses the end of the file following DATA section.
+  bool ParseTail()
+  {
+    if (!skipBlanks())
+    {
+      return false;
+    }
+    if (skipIsoKeyword("END-ISO"))
+    {
+      // everything after the end of exchange structure is ignored
+      return true;
+    }
+    if (!skipKeyword("ENDSTEP;"))
+    {
+      return false;
+    }
+    while (myPos < myEnd && *myPos != '\n')
+    {
+      ++myPos;
+    }
+    return skipBlanks() && myPos == myEnd;
+  }
+
+private:
+  //! Skips blanks and comments.
+  //! @return false if the comment is not closed
+  bool skipBlanks()
+  {
+    while (myPos < myEnd)
+    {
+      const char aChar = *myPos;
+      if (aChar == ' ' || aChar == '\t' || aChar == '\n' || aChar == '\r' || aChar == '\0')
+      {
+        ++myPos;
+      }
+      else if (aChar == '/' && myPos + 1 < myEnd && myPos[1] == '*')
+      {
+        const char* aStar = myPos + 2;
+        for (;;)
+        {
+          aStar = static_cast<const char*>(memchr(aStar, '*', size_t(myEnd - aStar)));
+          if (aStar == nullptr)
+          {
+            return false;
+          }
+          if (aStar + 1 < myEnd && aStar[1] == '/')
+          {
+            myPos = aStar + 2;
+            break;
+          }
+          ++aStar;
+        }
+      }
+      else
+      {
+        break;
+      }
+    }
+    return true;
+  }
+
+  //! Skips blanks and the given character.
+  bool skipChar(const char theChar)
+  {
+    if (!skipBlanks() || myPos >= myEnd || *myPos != theChar)
+    {
+      return false;
+    }
+    ++myPos;
+    return true;
+  }
+
+  //! Skips the keyword (including ';') given in upper case.
+  bool skipKeyword(const char* theKeyword)
+  {
+    if (!hasKeyword(myPos, myEnd, theKeyword))
+    {
+      return false;
+    }
+    myPos += strlen(theKeyword);
+    return true;
+  }
+
+  //! Skips the keyword of form "ISO-10303-21;" with the given prefix.
+  bool skipIsoKeyword(const char* thePrefix)
+  {
+    if (!hasKeyword(myPos, myEnd, thePrefix))
+    {
+      return false;
+    }
+    const char* aPos = myPos + strlen(thePrefix);
+    while (aPos < myEnd && (isDigit(*aPos) || *aPos == '-'))
+    {
+      ++aPos;
+    }
+    if (aPos >= myEnd || *aPos != ';')
+    {
+      return false;
+    }
+    myPos = aPos + 1;
+    return true;
+  }
+
+  //! Copies the text into the storage of the chunk.
+  const char* copyText(const char* theText, const size_t theLength)
+  {
+    char* aText = static_cast<char*>(myChunk.Allocator->AllocateOptimal(theLength + 1));
+    memcpy(aText, theText, theLength);
+    aText[theLength] = '\0';
+    return aText;
+  }
+
+  //! Returns the identifier of the sub-list with the given number.
+  const char* subListIdent(const int theNum)
+  {
+    if (theNum < 10)
+    {
+      return THE_SUB_IDENTS[theNum];
+    }
+    char aBuffer[16];
+    const int aLength = Sprintf(aBuffer, "$%d", theNum);
+    return copyText(aBuffer, size_t(aLength));
+  }
+
+  //! Returns the length of the type name at the current position, or 0.
+  //! The name is rejected if flex would recognize a keyword or an enumeration here.
+  size_t typeLength() const
+  {
+    const char* aPos = myPos;
+    if (aPos < myEnd && *aPos == '!')
+    {
+      ++aPos;
+    }
+    if (aPos >= myEnd || !((*aPos >= 'A' && *aPos <= 'Z') || (*aPos >= 'a' && *aPos <= 'z')))
+    {
+      return 0;
+    }
+    while (aPos < myEnd && isWordChar(*aPos))
+    {
+      ++aPos;
+    }
+    const size_t aLength = size_t(aPos - myPos);
+    if ((aPos < myEnd && *aPos == '.' && std::all_of(myPos, aPos, isEnumChar))
+        || (aLength == 8 && hasKeyword(myPos, aPos, "ENDSCOPE")))
+    {
+      return 0;
+    }
+    return aLength;
+  }
+
+  //! Parses the entity "#id = TYPE(...);" or "#id = (TYPE1(...) TYPE2(...));".
+  bool parseEntity()
+  {
+    const char* aStart = myPos++;
+    while (myPos < myEnd && isDigit(*myPos))
+    {
+      ++myPos;
+    }
+    if (myPos == aStart + 1)
+    {
+      return false;
+    }
+    const char* anIdent = copyText(aStart, size_t(myPos - aStart));
+    while (myPos < myEnd && (*myPos == ' ' || *myPos == '\t'))
+    {
+      ++myPos;
+    }
+    if (myPos >= myEnd || *myPos != '=')
+    {
+      return false;
+    }
+    ++myPos;
+    if (!skipBlanks() || myPos >= myEnd)
+    {
+      return false;
+    }
+    if (*myPos == '(')
+    {
+      // complex entity: the parts following the first one are "#0" records
+      ++myPos;
+      const char* aPartIdent = anIdent;
+      for (;;)
+      {
+        if (!skipBlanks() || myPos >= myEnd)
+        {
+          return false;
+        }
+        if (*myPos == ')')
+        {
+          if (aPartIdent == anIdent)
+          {
+            return false;
+          }
+          ++myPos;
+          break;
+        }
+        if (!parseTypedRecord(aPartIdent))
+        {
+          return false;
+        }
+        aPartIdent = THE_COMPLEX_IDENT;
+      }
+    }
+    else if (!parseTypedRecord(anIdent))
+    {
+      return false;
+    }
+    return skipChar(';');
+  }
+
+  //! Parses "TYPE(...)" as the record with the given identifier.
+  bool parseTypedRecord(const char* theIdent)
+  {
+    const size_t aLength = typeLength();
+    if (aLength == 0)
+    {
+      return false;
+    }
+    const char* aType = copyText(myPos, aLength);
+    myPos += aLength;
+    if (!skipBlanks() || myPos >= myEnd || *myPos != '(')
+    {
+      return false;
+    }
+    myNumSub = 0;
+    return parseList(theIdent, aType, 0);
+  }
+
+  //! Parses the list of parameters starting at '(' and adds the record
+  //! after the records of its sub-lists.
+  bool parseList(const char* theIdent, const char* theType, const int theDepth)
+  {
+    if (theDepth >= THE_MAX_LIST_DEPTH)
+    {
+      return false;
+    }
+    ++myPos;
+    ++myNumSub;
+    if (int(myLevels.size()) <= theDepth)
+    {
+      myLevels.resize(theDepth + 1);
+    }
+    myLevels[theDepth].clear();
+    if (!skipBlanks() || myPos >= myEnd)
+    {
+      return false;
+    }
+    if (*myPos != ')')
+    {
+      for (;;)
+      {
+        if (!parseParam(theDepth) || !skipBlanks() || myPos >= myEnd)
+        {
+          return false;
+        }
+        if (*myPos == ')')
+        {
+          break;
+        }
+        if (*myPos != ',')
+        {
+          return false;
+        }
+        ++myPos;
+        if (!skipBlanks() || myPos >= myEnd)
+        {
+          return false;
+        }
+      }
+    }
+    ++myPos;
+
+    const std::vector<Parameter>& aParams = myLevels[theDepth];
+    Record                        aRecord;
+    aRecord.Ident      = theIdent;
+    aRecord.Type       = theType;
+    aRecord.FirstParam = myChunk.Params.Length();
+    aRecord.NbParams   = int(aParams.size());
+    for (const Parameter& aParam : aParams)
+    {
+      myChunk.Params.Append(aParam);
+    }
+    myChunk.Records.Append(aRecord);
+    return true;
+  }
+
+  //! Parses the parameter at the current position and adds it to the list of given depth.
+  bool parseParam(const int theDepth)
+  {
+    Parameter aParam;
+    switch (*myPos)
+    {
+      case '(': {
+        aParam.Value = subListIdent(myNumSub);
+        aParam.Type  = Interface_ParamSub;
+        if (!parseList(aParam.Value, THE_SUB_LIST_TYPE, theDepth + 1))
+        {
+          return false;
+        }
+        break;
+      }
+      case '#': {
+        const char* aStart = myPos++;
+        while (myPos < myEnd && isDigit(*myPos))
+        {
+          ++myPos;
+        }
+        const char* aNext = myPos;
+        while (aNext < myEnd && (*aNext == ' ' || *aNext == '\t'))
+        {
+          ++aNext;
+        }
+        if (myPos == aStart + 1 || (aNext < myEnd && *aNext == '='))
+        {
+          return false;
+        }
+        aParam.Value = copyText(aStart, size_t(myPos - aStart));
+        aParam.Type  = Interface_ParamIdent;
+        break;
+      }
+      case '\'': {
+        // the string ends by quote followed by ',' or ')', other quotes are kept in the text
+        const char* aStart = myPos++;
+        for (;;)
+        {
+          const char* aQuote =
+            static_cast<const char*>(memchr(myPos, '\'', size_t(myEnd - myPos)));
+          if (aQuote == nullptr)
+          {
+            return false;
+          }
+          myPos             = aQuote + 1;
+          const char* aNext = myPos;
+          while (aNext < myEnd && (*aNext == ' ' || *aNext == '\n' || *aNext == '\r'))
+          {
+            ++aNext;
+          }
+          if (aNext < myEnd && (*aNext == ',' || *aNext == ')'))
+          {
+            break;
+          }
+        }
+        aParam.Value = copyText(aStart, size_t(myPos - aStart));
+        aParam.Type  = Interface_ParamText;
+        break;
+      }
+      case '$': {
+        ++myPos;
+        aParam.Value = THE_VOID_VALUE;
+        aParam.Type  = Interface_ParamVoid;
+        break;
+      }
+      case '*': {
+        ++myPos;
+        aParam.Value = THE_DERIVED_VALUE;
+        aParam.Type  = Interface_ParamMisc;
+        break;
+      }
+      default: {
+        if (!parseLiteral(theDepth, aParam))
+        {
+          return false;
+        }
+        break;
+      }
+    }
+    myLevels[theDepth].push_back(aParam);
+    return true;
+  }
+
+  //! Parses number, enumeration, binary or typed list "TYPE(...)".
+  //! The token is selected as the longest match of lexer rules
+  //! (integer, real, hexadecimal, enumeration, type), the first rule wins on equal lengths.
+  bool parseLiteral(const int theDepth, Parameter& theParam)
+  {
+    const size_t anAvail = size_t(myEnd - myPos);
+    const auto   aCharAt = [&](const size_t theIndex) {
+      return theIndex < anAvail ? myPos[theIndex] : '\0';
+    };
+    const char aFirst = myPos[0];
+
+    // [-+0-9][0-9]*
+    size_t aLenInteger = 0;
+    if (aFirst == '-' || aFirst == '+' || isDigit(aFirst))
+    {
+      for (aLenInteger = 1; isDigit(aCharAt(aLenInteger)); ++aLenInteger)
+      {
+      }
+    }
+    // [-+\.0-9][\.0-9]+ with optional E[-+0-9][0-9]*
+    size_t aLenReal = 0;
+    if (aFirst == '-' || aFirst == '+' || aFirst == '.' || isDigit(aFirst))
+    {
+      size_t aLength = 1;
+      while (isDigit(aCharAt(aLength)) || aCharAt(aLength) == '.')
+      {
+        ++aLength;
+      }
+      if (aLength >= 2)
+      {
+        aLenReal          = aLength;
+        const char anExpo = aCharAt(aLength);
+        const char aSign  = aCharAt(aLength + 1);
+        if (anExpo == 'E' && (aSign == '-' || aSign == '+' || isDigit(aSign)))
+        {
+          for (aLength += 2; isDigit(aCharAt(aLength)); ++aLength)
+          {
+          }
+          aLenReal = aLength;
+        }
+      }
+    }
+    // ["][0-9A-F]+["]
+    size_t aLenHexa = 0;
+    if (aFirst == '"')
+    {
+      size_t aLength = 1;
+      while (isHexDigit(aCharAt(aLength)))
+      {
+        ++aLength;
+      }
+      if (aLength > 1 && aCharAt(aLength) == '"')
+      {
+        aLenHexa = aLength + 1;
+      }
+    }
+    // [.]*[A-Z0-9_]+[.]
+    size_t aLenEnum = 0;
+    {
+      size_t aLength = 0;
+      while (aCharAt(aLength) == '.')
+      {
+        ++aLength;
+      }
+      const size_t aWordStart = aLength;
+      while (isEnumChar(aCharAt(aLength)))
+      {
+        ++aLength;
+      }
+      if (aLength > aWordStart && aCharAt(aLength) == '.')
+      {
+        aLenEnum = aLength + 1;
+      }
+    }
+    // !?[a-zA-Z0-9_]+
+    size_t aLenType = 0;
+    {
+      size_t aLength = aFirst == '!' ? 1 : 0;
+      while (isWordChar(aCharAt(aLength)))
+      {
+        ++aLength;
+      }
+      if (aLength > (aFirst == '!' ? 1u : 0u))
+      {
+        aLenType = aLength;
+      }
+    }
+
+    const size_t aLength = std::max({aLenInteger, aLenReal, aLenHexa, aLenEnum, aLenType});
+    if (aLength == 0)
+    {
+      return false;
+    }
+    if (aLength == aLenInteger)
+    {
+      theParam.Type = Interface_ParamInteger;
+    }
+    else if (aLength == aLenReal)
+    {
+      theParam.Type = Interface_ParamReal;
+    }
+    else if (aLength == aLenHexa)
+    {
+      theParam.Type = Interface_ParamHexa;
+    }
+    else if (aLength == aLenEnum)
+    {
+      theParam.Type = Interface_ParamEnum;
+    }
+    else
+    {
+      // typed parameter: the list is a sub-list with the type name
+      if (aLength == 8 && hasKeyword(myPos, myEnd, "ENDSCOPE"))
+      {
+        return false;
+      }
+      const char* aType = copyText(myPos, aLength);
+      myPos += aLength;
+      if (!skipBlanks() || myPos >= myEnd || *myPos != '(')
+      {
+        return false;
+      }
+      theParam.Value = subListIdent(myNumSub);
+      theParam.Type  = Interface_ParamSub;
+      return parseList(theParam.Value, aType, theDepth + 1);
+    }
+    theParam.Value = copyText(myPos, aLength);
+    myPos += aLength;
+    return true;
+  }
+
+private:
+  Chunk&                              myChunk;  //!< chunk to fill
+  const char*                         myPos;    //!< current position
+  const char*                         myEnd;    //!< end of the content
+  int                                 myNumSub; //!< counter of lists of the current record
+  std::vector<std::vector<Parameter>> myLevels; //!< parameters of the open lists
+};
+
+//! Functor parsing the chunks of DATA section.
+class StepFile_ParallelReader::ChunkFunctor
+{
+public:
+  ChunkFunctor(NCollection_Array1<Chunk>& theChunks, const char* theEnd)
+      : myChunks(theChunks),
+        myEnd(theEnd)
+  {
+  }
+
+  void operator()(const int theIndex) const
+  {
+    Chunk&      aChunk = myChunks.ChangeValue(theIndex);
+    ChunkParser aParser(aChunk, aChunk.Begin, myEnd);
+    aChunk.Status = aParser.ParseData();
+    aChunk.Stop   = aParser.Position();
+  }
+
+private:
+  NCollection_Array1<Chunk>& myChunks;
+  const char*                myEnd;
+};
+
+//=================================================================================================
+
+StepFile_ParallelReader::StepFile_ParallelReader()
+    : myData(nullptr),
+      mySize(0),
+      myMappedData(nullptr),
+      myMappedSize(0),
+      myNbChunks(0),
+      myNbHeaderRecords(0),
+      myNbRecords(0),
+      myNbParams(0)
+{
+}
+
+//=================================================================================================
+
+StepFile_ParallelReader::~StepFile_ParallelReader()
+{
+  clear();
+}
+
+//=================================================================================================
+
+void StepFile_ParallelReader::clear()
+{
+  myChunks   = NCollection_Array1<Chunk>();
+  myNbChunks = 0;
+  myNbHeaderRecords = myNbRecords = myNbParams = 0;
+  if (myMappedData != nullptr)
+  {
+#ifdef _WIN32
+    UnmapViewOfFile(myMappedData);
+#else
+    munmap(myMappedData, myMappedSize);
+#endif
+    myMappedData = nullptr;
+    myMappedSize = 0;
+  }
+  myBuffer.Nullify();
+  myData = nullptr;
+  mySize = 0;
+}
+
+//=================================================================================================
+
+bool StepFile_ParallelReader::LoadFile(const char* theName)
+{
+  clear();
+#ifdef _WIN32
+  const TCollection_ExtendedString aName(theName, true);
+  HANDLE                           aFile = CreateFileW(aName.ToWideString(),
+                             GENERIC_READ,
+                             FILE_SHARE_READ,
+                             NULL,
+                             OPEN_EXISTING,
+                             FILE_ATTRIBUTE_NORMAL,
+                             NULL);
+  if (aFile != INVALID_HANDLE_VALUE)
+  {
+    LARGE_INTEGER aSize;
+    if (GetFileSizeEx(aFile, &aSize) && aSize.QuadPart > 0)
+    {
+      HANDLE aMapping = CreateFileMappingW(aFile, NULL, PAGE_READONLY, 0, 0, NULL);
+      if (aMapping != NULL)
+      {
+        myMappedData = MapViewOfFile(aMapping, FILE_MAP_READ, 0, 0, 0);
+        myMappedSize = myMappedData != nullptr ? size_t(aSize.QuadPart) : 0;
+        CloseHandle(aMapping);
+      }
+    }
+    CloseHandle(aFile);
+  }
+#else
+  const int aFile = open(theName, O_RDONLY);
+  if (aFile >= 0)
+  {
+    struct stat aStat;
+    if (fstat(aFile, &aStat) == 0 && S_ISREG(aStat.st_mode) && aStat.st_size > 0)
+    {
+      void* anAddress = mmap(nullptr, size_t(aStat.st_size), PROT_READ, MAP_PRIVATE, aFile, 0);
+      if (anAddress != MAP_FAILED)
+      {
+        myMappedData = anAddress;
+        myMappedSize = size_t(aStat.st_size);
+      }
+    }
+    close(aFile);
+  }
+#endif
+  if (myMappedData != nullptr)
+  {
+    myData = static_cast<const char*>(myMappedData);
+    mySize = myMappedSize;
+    return true;
+  }
+
+  // the file is not a regular local one (or empty), read it by the file system
+  const occ::handle<OSD_FileSystem>& aFileSystem = OSD_FileSystem::DefaultFileSystem();
+  std::shared_ptr<std::istream>      aStream =
+    aFileSystem->OpenIStream(theName, std::ios::in | std::ios::binary);
+  return aStream.get() != nullptr && !aStream->fail() && LoadStream(*aStream);
+}
+
+//=================================================================================================
+
+bool StepFile_ParallelReader::LoadStream(std::istream& theStream)
+{
+  clear();
+  if (theStream.fail())
+  {
+    return false;
+  }
+
+  // reserve the rest of the stream if its size is known
+  size_t               aCapacity = THE_READ_BLOCK_SIZE;
+  const std::streampos aStart    = theStream.tellg();
+  if (aStart != std::streampos(-1))
+  {
+    theStream.seekg(0, std::ios::end);
+    const std::streampos aFinal = theStream.tellg();
+    if (aFinal != std::streampos(-1) && aFinal > aStart)
+    {
+      aCapacity = size_t(aFinal - aStart) + 1;
+    }
+    theStream.clear();
+    theStream.seekg(aStart);
+  }
+
+  const occ::handle<NCollection_BaseAllocator>& anAlloc =
+    NCollection_BaseAllocator::CommonBaseAllocator();
+  myBuffer     = new NCollection_Buffer(anAlloc, aCapacity);
+  size_t aSize = 0;
+  for (;;)
+  {
+    if (aSize == myBuffer->Size())
+    {
+      occ::handle<NCollection_Buffer> aBuffer = new NCollection_Buffer(anAlloc, aSize * 2);
+      memcpy(aBuffer->ChangeData(), myBuffer->Data(), aSize);
+      myBuffer = aBuffer;
+    }
+    theStream.read(reinterpret_cast<char*>(myBuffer->ChangeData()) + aSize,
+                   std::streamsize(myBuffer->Size() - aSize));
+    aSize += size_t(theStream.gcount());
+    if (!theStream.good())
+    {
+      break;
+    }
+  }
+  if (theStream.bad())
+  {
+    myBuffer.Nullify();
+    return false;
+  }
+  myData = reinterpret_cast<const char*>(myBuffer->Data());
+  mySize = aSize;
+  return true;
+}
+
+//=================================================================================================
+
+void StepFile_ParallelReader::LoadBuffer(const char* theData, const size_t theSize)
+{
+  clear();
+  myData = theData;
+  mySize = theSize;
+}
+
+//=================================================================================================
+
+const char* StepFile_ParallelReader::findBoundary(const char* theFrom, const char* theLimit)
+{
+  for (const char* aPos = theFrom; aPos < theLimit; ++aPos)
+  {
+    aPos = static_cast<const char*>(memchr(aPos, ';', size_t(theLimit - aPos)));
+    if (aPos == nullptr)
+    {
+      return nullptr;
+    }
+    const char* aStart = aPos + 1;
+    while (aStart < theLimit
+           && (*aStart == ' ' || *aStart == '\t' || *aStart == '\n' || *aStart == '\r'))
+    {
+      ++aStart;
+    }
+    if (aStart >= theLimit || *aStart != '#')
+    {
+      continue;
+    }
+    const char* aNext = aStart + 1;
+    while (aNext < theLimit && isDigit(*aNext))
+    {
+      ++aNext;
+    }
+    if (aNext == aStart + 1)
+    {
+      continue;
+    }
+    while (aNext < theLimit && (*aNext == ' ' || *aNext == '\t'))
+    {
+      ++aNext;
+    }
+    if (aNext < theLimit && *aNext == '=')
+    {
+      return aStart;
+    }
+  }
+  return nullptr;
+}
+
+//=================================================================================================
+
+bool StepFile_ParallelReader::Perform(const bool theIsParallel)
+{
+  myChunks   = NCollection_Array1<Chunk>();
+  myNbChunks = 0;
+  myNbHeaderRecords = myNbRecords = myNbParams = 0;
+  if (myData == nullptr || mySize == 0)
+  {
+    return false;
+  }
+  const char* anEnd = myData + mySize;
+
+  int aNbDataChunks = 1;
+  if (theIsParallel)
+  {
+    const size_t aMaxNbChunks = 4 * size_t(OSD_Parallel::NbLogicalProcessors());
+    aNbDataChunks             = int(std::min(mySize / THE_MIN_CHUNK_SIZE + 1, aMaxNbChunks));
+  }
+  myChunks = NCollection_Array1<Chunk>(0, aNbDataChunks);
+
+  // HEADER section is parsed in the current thread
+  Chunk& aHeader    = myChunks.ChangeFirst();
+  aHeader.Begin     = myData;
+  aHeader.Allocator = new NCollection_IncAllocator();
+  aHeader.Allocator->SetMemTag(OSD_MemInfo::MemTag_StepData);
+  ChunkParser aHeaderParser(aHeader, myData, anEnd);
+  if (!aHeaderParser.ParseHeader())
+  {
+    return false;
+  }
+  aHeader.End    = aHeaderParser.Position();
+  aHeader.Stop   = aHeader.End;
+  aHeader.Status = ChunkStatus_Done;
+
+  // the split points are searched before the last ENDSEC, which should close DATA section
+  const char* aDataStart = aHeader.End;
+  const char* aDataLimit = anEnd;
+  for (size_t anOffset = 6; anOffset <= size_t(anEnd - aDataStart); ++anOffset)
+  {
+    if (hasKeyword(anEnd - anOffset, anEnd, "ENDSEC"))
+    {
+      aDataLimit = anEnd - anOffset;
+      break;
+    }
+  }
+
+  const size_t aStep   = size_t(aDataLimit - aDataStart) / size_t(aNbDataChunks);
+  const char*  aBegin  = aDataStart;
+  myNbChunks           = 1;
+  for (int aChunkIter = 1; aChunkIter <= aNbDataChunks; ++aChunkIter)
+  {
+    Chunk& aChunk    = myChunks.ChangeValue(aChunkIter);
+    aChunk.Begin     = aBegin;
+    aChunk.Allocator = new NCollection_IncAllocator();
+    aChunk.Allocator->SetMemTag(OSD_MemInfo::MemTag_StepData);
+    myNbChunks = aChunkIter + 1;
+    if (aChunkIter == aNbDataChunks)
+    {
+      break;
+    }
+    const char* aNext =
+      findBoundary(std::max(aDataStart + size_t(aChunkIter) * aStep, aBegin + 1), aDataLimit);
+    if (aNext == nullptr)
+    {
+      break;
+    }
+    aChunk.End = aNext;
+    aBegin     = aNext;
+  }
+
+  OSD_Parallel::For(1, myNbChunks, ChunkFunctor(myChunks, anEnd), myNbChunks < 3);
+
+  // The start of the chunk is reliable if the previous one has been parsed up to it.
+  // If the split point is inside an entity (e.g. in a string), the previous chunk
+  // parses the entity crossing it, and the next one is parsed again from its end.
+  const char* aValidStart = aDataStart;
+  int         aLastChunk  = 0;
+  for (int aChunkIter = 1; aChunkIter < myNbChunks && aLastChunk == 0; ++aChunkIter)
+  {
+    Chunk& aChunk = myChunks.ChangeValue(aChunkIter);
+    if (aChunk.Begin != aValidStart)
+    {
+      aChunk.Begin = aValidStart;
+      aChunk.Records.Clear();
+      aChunk.Params.Clear();
+      aChunk.Allocator->Reset(false);
+      if (aChunk.End != nullptr && aValidStart >= aChunk.End)
+      {
+        // the chunk has been entirely parsed by the previous ones
+        aChunk.Status = ChunkStatus_Overshoot;
+        aChunk.Stop   = aValidStart;
+      }
+      else
+      {
+        ChunkFunctor(myChunks, anEnd)(aChunkIter);
+      }
+    }
+
+    switch (aChunk.Status)
+    {
+      case ChunkStatus_Done:
+        aValidStart = aChunk.End;
+        break;
+      case ChunkStatus_Overshoot:
+        aValidStart = aChunk.Stop;
+        break;
+      case ChunkStatus_Finished:
+        aLastChunk = aChunkIter;
+        break;
+      default:
+        return false;
+    }
+  }
+  if (aLastChunk == 0)
+  {
+    return false;
+  }
+  for (int aChunkIter = aLastChunk + 1; aChunkIter < myNbChunks; ++aChunkIter)
+  {
+    myChunks.ChangeValue(aChunkIter) = Chunk();
+  }
+  myNbChunks = aLastChunk + 1;
+
+  const Chunk& aLast = myChunks.Value(myNbChunks - 1);
+  ChunkParser  aTailParser(myChunks.ChangeValue(myNbChunks - 1), aLast.Stop, anEnd);
+  if (!aTailParser.ParseTail())
+  {
+    return false;
+  }
+
+  int aNbRecords = 0;
+  for (int aChunkIter = 0; aChunkIter < myNbChunks; ++aChunkIter)
+  {
+    Chunk& aChunk      = myChunks.ChangeValue(aChunkIter);
+    aChunk.FirstRecord = aNbRecords + 1;
+    aNbRecords += aChunk.Records.Length();
+    myNbParams += aChunk.Params.Length();
+  }
+  myNbHeaderRecords = aHeader.Records.Length();
+  myNbRecords       = aNbRecords;
+  return true;
+}
+
+//=================================================================================================
+
+const StepFile_ParallelReader::Chunk& StepFile_ParallelReader::findChunk(const int theNum) const
+{
+  int aLower = 0;
+  int anUpper = myNbChunks - 1;
+  while (aLower < anUpper)
+  {
+    const int aMiddle = (aLower + anUpper + 1) / 2;
+    if (myChunks.Value(aMiddle).FirstRecord <= theNum)
+    {
+      aLower = aMiddle;
+    }
+    else
+    {
+      anUpper = aMiddle - 1;
+    }
+  }
+  return myChunks.Value(aLower);
+}
+
+//=================================================================================================
+
+const StepFile_ParallelReader::Record& StepFile_ParallelReader::RecordDescription(
+  const int theNum) const
+{
+  const Chunk& aChunk = findChunk(theNum);
+  return aChunk.Records.Value(theNum - aChunk.FirstRecord);
+}
+
+//=================================================================================================
+
+const StepFile_ParallelReader::Parameter& StepFile_ParallelReader::ParamDescription(
+  const int theNum,
+  const int theParam) const
+{
+  const Chunk&  aChunk  = findChunk(theNum);
+  const Record& aRecord = aChunk.Records.Value(theNum - aChunk.FirstRecord);
+  return aChunk.Params.Value(aRecord.FirstParam + theParam - 1);
+}
+
+//=================================================================================================
+
+occ::handle<StepData_StepReaderData> StepFile_ParallelReader::CreateReaderData(
+  const Resource_FormatType theSourceCodePage) const
+{
+  occ::handle<StepData_StepReaderData> aData =
+    new StepData_StepReaderData(myNbHeaderRecords, myNbRecords, myNbParams, theSourceCodePage);
+  int aNum = 0;
+  for (int aChunkIter = 0; aChunkIter < myNbChunks; ++aChunkIter)
+  {
+    const Chunk& aChunk = myChunks.Value(aChunkIter);
+    for (NCollection_Vector<Record>::Iterator aRecIter(aChunk.Records); aRecIter.More();
+         aRecIter.Next())
+    {
+      const Record& aRecord = aRecIter.Value();
+      aData->SetRecord(++aNum, aRecord.Ident, aRecord.Type, aRecord.NbParams);
+      for (int aParamIter = 0; aParamIter < aRecord.NbParams; ++aParamIter)
+      {
+        const Parameter& aParam = aChunk.Params.Value(aRecord.FirstParam + aParamIter);
+        aData->AddStepParam(aNum, aParam.Value, aParam.Type);
+      }
+      aData->InitParams(aNum);
+    }
+  }
+  return aData;
+}
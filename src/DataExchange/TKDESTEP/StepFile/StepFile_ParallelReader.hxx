@@ -0,0 +1,195 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _StepFile_ParallelReader_HeaderFile
+#define _StepFile_ParallelReader_HeaderFile
+
+#include <Interface_ParamType.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_Buffer.hxx>
+#include <NCollection_IncAllocator.hxx>
+#include <NCollection_Vector.hxx>
+#include <Resource_FormatType.hxx>
+#include <Standard_DefineAlloc.hxx>
+#include <Standard_Handle.hxx>
+
+#include <iostream>
+
+class StepData_StepReaderData;
+
+//! Reader of STEP file alternative to the flex/bison parser (StepFile_ReadData),
+//! designed for big files.
+//!
+//! The content of the file is mapped into memory (or read into a buffer, if it is given
+//! as a stream or cannot be mapped). The DATA section is split into chunks at entity
+//! boundaries ("...;#id=") and the chunks are tokenized and parsed in parallel threads.
+//! Each chunk stores the texts of its records and parameters in its own incremental
+//! allocator, so the reader should be kept alive while the StepData_StepReaderData
+//! filled by it is in use.
+//!
+//! The records produced are the same as the ones collected by StepFile_ReadData:
+//! sub-lists are stored as "$N" records preceding their owner, the parts of complex
+//! entities as "#0" records following the first one.
+//!
+//! The parser is strict: file containing scopes or syntax errors is rejected by Perform(),
+//! and should be read by the flex/bison parser which is able to recover and report errors.
+//! The loaded content remains available by Data() for that purpose.
+class StepFile_ParallelReader
+{
+public:
+  DEFINE_STANDARD_ALLOC
+
+  //! Description of a record (entity, part of complex entity or sub-list).
+  struct Record
+  {
+    const char* Ident;      //!< identifier: "#123", "#0" or "$1"
+    const char* Type;       //!< type name
+    int         FirstParam; //!< index of the first parameter in the chunk
+    int         NbParams;   //!< number of parameters
+  };
+
+  //! Description of a parameter of the record.
+  struct Parameter
+  {
+    const char*         Value; //!< text of the parameter
+    Interface_ParamType Type;  //!< type of the parameter
+  };
+
+public:
+  //! Creates an empty reader.
+  Standard_EXPORT StepFile_ParallelReader();
+
+  //! Releases the mapped memory.
+  Standard_EXPORT ~StepFile_ParallelReader();
+
+  //! Maps the file into memory. If mapping fails, reads the file
+  //! opened by OSD_FileSystem into the buffer.
+  //! @return false if the file cannot be opened
+  Standard_EXPORT bool LoadFile(const char* theName);
+
+  //! Reads the content of the stream into the buffer.
+  //! @return false if the stream fails
+  Standard_EXPORT bool LoadStream(std::istream& theStream);
+
+  //! Uses the given memory as the content of the file.
+  //! The memory is not copied and should be kept alive while the reader is in use.
+  Standard_EXPORT void LoadBuffer(const char* theData, const size_t theSize);
+
+  //! Returns the loaded content.
+  const char* Data() const { return myData; }
+
+  //! Returns the size of the loaded content.
+  size_t Size() const { return mySize; }
+
+  //! Parses the loaded content.
+  //! @param theIsParallel if true, the chunks of DATA section are parsed in parallel threads
+  //! @return false if the content cannot be parsed by this reader
+  Standard_EXPORT bool Perform(const bool theIsParallel = true);
+
+  //! Returns the number of chunks of DATA section parsed by the last Perform().
+  int NbChunks() const { return myNbChunks - 1; }
+
+  //! Returns the number of records in the HEADER section.
+  int NbHeaderRecords() const { return myNbHeaderRecords; }
+
+  //! Returns the total number of records.
+  int NbRecords() const { return myNbRecords; }
+
+  //! Returns the total number of parameters.
+  int NbParams() const { return myNbParams; }
+
+  //! Returns the record with the given index in the file order.
+  //! @param theNum index of the record in the range [1, NbRecords()]
+  Standard_EXPORT const Record& RecordDescription(const int theNum) const;
+
+  //! Returns the parameter of the record.
+  //! @param theNum   index of the record in the range [1, NbRecords()]
+  //! @param theParam index of the parameter in the range [1, RecordDescription().NbParams]
+  Standard_EXPORT const Parameter& ParamDescription(const int theNum, const int theParam) const;
+
+  //! Creates the reader data and fills it by the parsed records.
+  //! @param theSourceCodePage code page of the file
+  Standard_EXPORT occ::handle<StepData_StepReaderData> CreateReaderData(
+    const Resource_FormatType theSourceCodePage) const;
+
+private:
+  //! Status of chunk parsing.
+  enum ChunkStatus
+  {
+    ChunkStatus_None,      //!< not parsed yet
+    ChunkStatus_Done,      //!< parsed up to the start of the next chunk
+    ChunkStatus_Overshoot, //!< last entity crosses the start of the next chunk
+    ChunkStatus_Finished,  //!< parsed up to the end of DATA section
+    ChunkStatus_Failed     //!< syntax is not supported
+  };
+
+  //! Part of the file parsed by one thread.
+  //! The first chunk contains the HEADER section.
+  struct Chunk
+  {
+    const char*                           Begin;     //!< start of the chunk
+    const char*                           End;       //!< start of the next chunk, NULL for last
+    const char*                           Stop;      //!< position where parsing has stopped
+    occ::handle<NCollection_IncAllocator> Allocator; //!< storage of texts
+    NCollection_Vector<Record>            Records;   //!< records of the chunk
+    NCollection_Vector<Parameter>         Params;    //!< parameters of the records
+    int                                   FirstRecord; //!< index of the first record in file
+    ChunkStatus                           Status;      //!< parsing status
+
+    Chunk()
+        : Begin(nullptr),
+          End(nullptr),
+          Stop(nullptr),
+          Records(8192),
+          Params(16384),
+          FirstRecord(0),
+          Status(ChunkStatus_None)
+    {
+    }
+  };
+
+  //! Tokenizer and parser of a chunk.
+  class ChunkParser;
+
+  //! Functor parsing the chunks of DATA section.
+  class ChunkFunctor;
+
+private:
+  //! Releases the loaded content.
+  void clear();
+
+  //! Finds the start of the entity following the first ';' at or after the given position.
+  //! @return NULL if not found before theLimit
+  static const char* findBoundary(const char* theFrom, const char* theLimit);
+
+  //! Returns the chunk containing the record.
+  const Chunk& findChunk(const int theNum) const;
+
+  // copying is prohibited
+  StepFile_ParallelReader(const StepFile_ParallelReader&)            = delete;
+  StepFile_ParallelReader& operator=(const StepFile_ParallelReader&) = delete;
+
+private:
+  const char*                      myData;            //!< loaded content
+  size_t                           mySize;            //!< size of the loaded content
+  void*                            myMappedData;      //!< address of the mapped file
+  size_t                           myMappedSize;      //!< size of the mapped region
+  occ::handle<NCollection_Buffer>  myBuffer;          //!< buffer of content read from stream
+  NCollection_Array1<Chunk>        myChunks;          //!< header and data chunks
+  int                              myNbChunks;        //!< number of used chunks
+  int                              myNbHeaderRecords; //!< number of records of HEADER section
+  int                              myNbRecords;       //!< total number of records
+  int                              myNbParams;        //!< total number of parameters
+};
+
+#endif // _StepFile_ParallelReader_HeaderFile
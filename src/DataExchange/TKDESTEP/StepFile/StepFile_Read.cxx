@@ -16,6 +16,7 @@
 
 #include <StepFile_Read.hxx>
 
+#include <StepFile_ParallelReader.hxx>
 #include <StepFile_ReadData.hxx>
 
 #include <Interface_Check.hxx>
@@ -29,6 +30,7 @@
 #include <StepData_StepReaderData.hxx>
 #include <StepData_StepReaderTool.hxx>
 
+#include <Standard_ArrayStreamBuffer.hxx>
 #include <Standard_ErrorHandler.hxx>
 #include <Standard_Failure.hxx>
 
@@ -37,6 +39,7 @@
 
 #include <OSD_FileSystem.hxx>
 #include <OSD_Timer.hxx>
+#include <OSD_TraceZone.hxx>
 
 #include "step.tab.hxx"
 
@@ -72,16 +75,27 @@ static int StepFile_Read(const char*                                 theName,
                          const occ::handle<StepData_FileRecognizer>& theRecogHeader,
                          const occ::handle<StepData_FileRecognizer>& theRecogData)
 {
+  OSD_TRACE_ZONE_CATEGORY("StepFile_Read", "de");
+  // parallel parser works on the content loaded into memory (mapped file or read stream)
+  StepFile_ParallelReader aParallelReader;
+  const bool              isParallelParse = theStepModel->InternalParameters.ReadParallelParse;
+  if (isParallelParse
+      && !(theIStream != nullptr ? aParallelReader.LoadStream(*theIStream)
+                                 : aParallelReader.LoadFile(theName)))
+  {
+    return -1;
+  }
+
   // if stream is not provided, open file stream here
   std::istream*                 aStreamPtr = theIStream;
   std::shared_ptr<std::istream> aFileStream;
-  if (aStreamPtr == nullptr)
+  if (aStreamPtr == nullptr && !isParallelParse)
   {
     const occ::handle<OSD_FileSystem>& aFileSystem = OSD_FileSystem::DefaultFileSystem();
     aFileStream = aFileSystem->OpenIStream(theName, std::ios::in | std::ios::binary);
     aStreamPtr  = aFileStream.get();
   }
-  if (aStreamPtr == nullptr || aStreamPtr->fail())
+  if (!isParallelParse && (aStreamPtr == nullptr || aStreamPtr->fail()))
   {
     return -1;
   }
@@ -95,26 +109,59 @@ static int StepFile_Read(const char*                                 theName,
   Message_Messenger::StreamBuffer sout = Message::SendTrace();
   sout << "      ...    Step File Reading : '" << theName << "'";
 
-  StepFile_ReadData aFileDataModel;
-  try
+  bool isParsed = false;
+  if (isParallelParse)
   {
-    OCC_CATCH_SIGNALS
-    int           aLetat = 0;
-    step::scanner aScanner(&aFileDataModel, aStreamPtr);
-    aScanner.yyrestart(aStreamPtr);
-    step::parser aParser(&aScanner);
-    aLetat = aParser.parse();
-    if (aLetat != 0)
+    try
+    {
+      OCC_CATCH_SIGNALS
+      isParsed = aParallelReader.Perform(true);
+    }
+    catch (Standard_Failure const& anException)
     {
-      StepFile_Interrupt(aFileDataModel.GetLastError(), true);
+      Message::SendFail() << " ...  Exception Raised while reading Step File : '" << theName
+                          << "':\n"
+                          << anException << "    ...";
       return 1;
     }
+    if (!isParsed)
+    {
+      // scopes or syntax errors, the loaded content is parsed by flex/bison
+      sout << "      ...    Parallel parsing is not applicable, switched to sequential one\n";
+    }
   }
-  catch (Standard_Failure const& anException)
+
+  Standard_ArrayStreamBuffer aLoadedBuffer(aParallelReader.Data(), aParallelReader.Size());
+  std::istream               aLoadedStream(&aLoadedBuffer);
+  if (isParallelParse)
   {
-    Message::SendFail() << " ...  Exception Raised while reading Step File : '" << theName << "':\n"
-                        << anException << "    ...";
-    return 1;
+    aStreamPtr = &aLoadedStream;
+  }
+
+  StepFile_ReadData aFileDataModel;
+  if (!isParsed)
+  {
+    try
+    {
+      OCC_CATCH_SIGNALS
+      int           aLetat = 0;
+      step::scanner aScanner(&aFileDataModel, aStreamPtr);
+      aScanner.yyrestart(aStreamPtr);
+      step::parser aParser(&aScanner);
+      aLetat = aParser.parse();
+      if (aLetat != 0)
+      {
+        StepFile_Interrupt(aFileDataModel.GetLastError(), true);
+        return 1;
+      }
+    }
+    catch (Standard_Failure const& anException)
+    {
+      Message::SendFail() << " ...  Exception Raised while reading Step File : '" << theName
+                          << "':\n"
+                          << anException << "    ...";
+      return 1;
+    }
   }
 
 #ifdef CHRONOMESURE
@@ -125,31 +172,41 @@ static int StepFile_Read(const char*                                 theName,
 
   std::lock_guard<std::mutex> aLock(GetGlobalReadMutex());
 
-  int nbhead, nbrec, nbpar;
-  aFileDataModel.GetFileNbR(&nbhead, &nbrec, &nbpar); // renvoi par lex/yacc
-  occ::handle<StepData_StepReaderData> undirec =
-    // clang-format off
-    new StepData_StepReaderData(nbhead,nbrec,nbpar, theStepModel->SourceCodePage());  // creation tableau de records
-  // clang-format on
-  for (int nr = 1; nr <= nbrec; nr++)
+  int                                  nbpar = 0;
+  occ::handle<StepData_StepReaderData> undirec;
+  if (isParsed)
   {
-    int   nbarg;
-    char* ident;
-    char* typrec = nullptr;
-    aFileDataModel.GetRecordDescription(&ident, &typrec, &nbarg);
-    undirec->SetRecord(nr, ident, typrec, nbarg);
-
-    if (nbarg > 0)
+    nbpar   = aParallelReader.NbParams();
+    undirec = aParallelReader.CreateReaderData(theStepModel->SourceCodePage());
+  }
+  else
+  {
+    int nbhead, nbrec;
+    aFileDataModel.GetFileNbR(&nbhead, &nbrec, &nbpar); // renvoi par lex/yacc
+    undirec =
+      // clang-format off
+      new StepData_StepReaderData(nbhead,nbrec,nbpar, theStepModel->SourceCodePage());  // creation tableau de records
+    // clang-format on
+    for (int nr = 1; nr <= nbrec; nr++)
     {
-      Interface_ParamType typa;
-      char*               val;
-      while (aFileDataModel.GetArgDescription(&typa, &val) == 1)
+      int   nbarg;
+      char* ident;
+      char* typrec = nullptr;
+      aFileDataModel.GetRecordDescription(&ident, &typrec, &nbarg);
+      undirec->SetRecord(nr, ident, typrec, nbarg);
+
+      if (nbarg > 0)
       {
-        undirec->AddStepParam(nr, val, typa);
+        Interface_ParamType typa;
+        char*               val;
+        while (aFileDataModel.GetArgDescription(&typa, &val) == 1)
+        {
+          undirec->AddStepParam(nr, val, typa);
+        }
       }
+      undirec->InitParams(nr);
+      aFileDataModel.NextRecord();
     }
-    undirec->InitParams(nr);
-    aFileDataModel.NextRecord();
   }
 
   aFileDataModel.ErrorHandle(undirec->GlobalCheck());
@@ -115,7 +115,8 @@ bool StepSelect_WorkLibrary::WriteFile(IFSelect_ContextWrite& ctx) const
     //    sout << std::flush;
   }
 
-  //  Envoi
+  //  Envoi: lines are sent to the file as soon as they are completed
+  SW.SetStream(aStream.get());
   SW.SendModel(stepro);
   Interface_CheckIterator chl = SW.CheckList();
   for (chl.Start(); chl.More(); chl.Next())
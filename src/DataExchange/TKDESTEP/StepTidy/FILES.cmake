@@ -6,12 +6,21 @@ set(OCCT_StepTidy_FILES
   StepTidy_Axis2Placement3dHasher.pxx
   StepTidy_Axis2Placement3dReducer.cxx
   StepTidy_Axis2Placement3dReducer.pxx
+  StepTidy_BSplineCurveWithKnotsHasher.pxx
+  StepTidy_BSplineCurveWithKnotsReducer.cxx
+  StepTidy_BSplineCurveWithKnotsReducer.pxx
+  StepTidy_BSplineSurfaceWithKnotsHasher.pxx
+  StepTidy_BSplineSurfaceWithKnotsReducer.cxx
+  StepTidy_BSplineSurfaceWithKnotsReducer.pxx
   StepTidy_CartesianPointHasher.pxx
   StepTidy_CartesianPointReducer.cxx
   StepTidy_CartesianPointReducer.pxx
   StepTidy_CircleHasher.pxx
   StepTidy_CircleReducer.cxx
   StepTidy_CircleReducer.pxx
+  StepTidy_CylindricalSurfaceHasher.pxx
+  StepTidy_CylindricalSurfaceReducer.cxx
+  StepTidy_CylindricalSurfaceReducer.pxx
   StepTidy_DirectionHasher.pxx
   StepTidy_DirectionReducer.cxx
   StepTidy_DirectionReducer.pxx
@@ -0,0 +1,60 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <StepTidy_CylindricalSurfaceReducer.pxx>
+
+#include <StepGeom_Pcurve.hxx>
+#include <StepShape_AdvancedFace.hxx>
+
+//==================================================================================================
+
+StepTidy_CylindricalSurfaceReducer::StepTidy_CylindricalSurfaceReducer(
+  const occ::handle<XSControl_WorkSession>& theWS)
+    : StepTidy_EntityReducer<StepGeom_CylindricalSurface, StepTidy_CylindricalSurfaceHasher>(theWS)
+{
+  registerReplacer(STANDARD_TYPE(StepShape_AdvancedFace), replaceAdvancedFace);
+  registerReplacer(STANDARD_TYPE(StepGeom_Pcurve), replacePcurve);
+}
+
+//==================================================================================================
+
+bool StepTidy_CylindricalSurfaceReducer::replaceAdvancedFace(
+  const occ::handle<StepGeom_CylindricalSurface>& theOldEntity,
+  const occ::handle<StepGeom_CylindricalSurface>& theNewEntity,
+  const occ::handle<Standard_Transient>&          theSharing)
+{
+  occ::handle<StepShape_AdvancedFace> aSharing = occ::down_cast<StepShape_AdvancedFace>(theSharing);
+  if (aSharing->FaceGeometry() == theOldEntity)
+  {
+    aSharing->SetFaceGeometry(theNewEntity);
+    return true;
+  }
+  return false;
+}
+
+//==================================================================================================
+
+bool StepTidy_CylindricalSurfaceReducer::replacePcurve(
+  const occ::handle<StepGeom_CylindricalSurface>& theOldEntity,
+  const occ::handle<StepGeom_CylindricalSurface>& theNewEntity,
+  const occ::handle<Standard_Transient>&          theSharing)
+{
+  occ::handle<StepGeom_Pcurve> aSharing = occ::down_cast<StepGeom_Pcurve>(theSharing);
+  if (aSharing->BasisSurface() == theOldEntity)
+  {
+    aSharing->SetBasisSurface(theNewEntity);
+    return true;
+  }
+  return false;
+}
@@ -15,20 +15,27 @@
 
 #include <Interface_EntityIterator.hxx>
 #include <Interface_Graph.hxx>
+#include <OSD_Parallel.hxx>
 #include <StepTidy_Axis2Placement3dReducer.pxx>
+#include <StepTidy_BSplineCurveWithKnotsReducer.pxx>
+#include <StepTidy_BSplineSurfaceWithKnotsReducer.pxx>
 #include <StepTidy_CartesianPointReducer.pxx>
 #include <StepTidy_DirectionReducer.pxx>
 #include <StepTidy_LineReducer.pxx>
 #include <StepTidy_VectorReducer.pxx>
 #include <StepTidy_PlaneReducer.pxx>
 #include <StepTidy_CircleReducer.pxx>
+#include <StepTidy_CylindricalSurfaceReducer.pxx>
 #include <StepData_StepModel.hxx>
+
+#include <functional>
 #include <utility>
 
 //==================================================================================================
 
 StepTidy_DuplicateCleaner::StepTidy_DuplicateCleaner(occ::handle<XSControl_WorkSession> theWS)
-    : myWS(std::move(theWS))
+    : myWS(std::move(theWS)),
+      myNbRemovedEntities(0)
 {
 }
 
@@ -36,6 +43,7 @@ StepTidy_DuplicateCleaner::StepTidy_DuplicateCleaner(occ::handle<XSControl_WorkS
 
 void StepTidy_DuplicateCleaner::Perform()
 {
+  myNbRemovedEntities = 0;
   occ::handle<StepData_StepModel> aModel = occ::down_cast<StepData_StepModel>(myWS->Model());
   if (aModel.IsNull())
   {
@@ -43,28 +51,45 @@ void StepTidy_DuplicateCleaner::Perform()
   }
 
   //! Initialize Reducers.
-  StepTidy_CartesianPointReducer   aCartesianPointReducer(myWS);
-  StepTidy_DirectionReducer        aDirectionReducer(myWS);
-  StepTidy_Axis2Placement3dReducer aAxis2Placement3dReducer(myWS);
-  StepTidy_VectorReducer           aVectorReducer(myWS);
-  StepTidy_LineReducer             aLineReducer(myWS);
-  StepTidy_PlaneReducer            aPlaneReducer(myWS);
-  StepTidy_CircleReducer           aCircleReducer(myWS);
+  StepTidy_CartesianPointReducer          aCartesianPointReducer(myWS);
+  StepTidy_DirectionReducer               aDirectionReducer(myWS);
+  StepTidy_Axis2Placement3dReducer        aAxis2Placement3dReducer(myWS);
+  StepTidy_VectorReducer                  aVectorReducer(myWS);
+  StepTidy_LineReducer                    aLineReducer(myWS);
+  StepTidy_PlaneReducer                   aPlaneReducer(myWS);
+  StepTidy_CircleReducer                  aCircleReducer(myWS);
+  StepTidy_CylindricalSurfaceReducer      aCylindricalSurfaceReducer(myWS);
+  StepTidy_BSplineCurveWithKnotsReducer   aBSplineCurveReducer(myWS);
+  StepTidy_BSplineSurfaceWithKnotsReducer aBSplineSurfaceReducer(myWS);
 
   // Process all entities.
-  for (int anIndex = 1; anIndex <= aModel->NbEntities(); ++anIndex)
-  {
-    const occ::handle<Standard_Transient> anEntity = aModel->Value(anIndex);
-    aCartesianPointReducer.ProcessEntity(anEntity);
-    aDirectionReducer.ProcessEntity(anEntity);
-    aAxis2Placement3dReducer.ProcessEntity(anEntity);
-    aVectorReducer.ProcessEntity(anEntity);
-    aLineReducer.ProcessEntity(anEntity);
-    aPlaneReducer.ProcessEntity(anEntity);
-    aCircleReducer.ProcessEntity(anEntity);
-  }
+  // Each reducer keeps the entities of its own type, so the reducers are filled in parallel.
+  // The graph is computed in advance, it is only read by the reducers then.
+  myWS->Graph();
+  const auto aProcessAll = [&aModel](auto& theReducer) {
+    for (int anIndex = 1; anIndex <= aModel->NbEntities(); ++anIndex)
+    {
+      theReducer.ProcessEntity(aModel->Value(anIndex));
+    }
+  };
+  const std::function<void()> aProcessors[] = {
+    [&]() { aProcessAll(aCartesianPointReducer); },
+    [&]() { aProcessAll(aDirectionReducer); },
+    [&]() { aProcessAll(aAxis2Placement3dReducer); },
+    [&]() { aProcessAll(aVectorReducer); },
+    [&]() { aProcessAll(aLineReducer); },
+    [&]() { aProcessAll(aPlaneReducer); },
+    [&]() { aProcessAll(aCircleReducer); },
+    [&]() { aProcessAll(aCylindricalSurfaceReducer); },
+    [&]() { aProcessAll(aBSplineCurveReducer); },
+    [&]() { aProcessAll(aBSplineSurfaceReducer); }};
+  const int aNbProcessors = static_cast<int>(sizeof(aProcessors) / sizeof(aProcessors[0]));
+  OSD_Parallel::For(0, aNbProcessors, [&aProcessors](const int theIndex) {
+    aProcessors[theIndex]();
+  });
 
   // Perform replacement of duplicate entities.
+  // Sharing entities are modified here, so it is done sequentially.
   NCollection_Map<occ::handle<Standard_Transient>> aReplacedEntities;
   aCartesianPointReducer.Perform(aReplacedEntities);
   aDirectionReducer.Perform(aReplacedEntities);
@@ -73,6 +98,10 @@ void StepTidy_DuplicateCleaner::Perform()
   aLineReducer.Perform(aReplacedEntities);
   aPlaneReducer.Perform(aReplacedEntities);
   aCircleReducer.Perform(aReplacedEntities);
+  aCylindricalSurfaceReducer.Perform(aReplacedEntities);
+  aBSplineCurveReducer.Perform(aReplacedEntities);
+  aBSplineSurfaceReducer.Perform(aReplacedEntities);
+  myNbRemovedEntities = aReplacedEntities.Extent();
 
   // Remove duplicate entities.
   removeEntities(aReplacedEntities);
@@ -51,6 +51,9 @@ public:
   //! each other will be merged, and duplicates will be removed.
   Standard_EXPORT void Perform();
 
+  //! Returns the number of duplicate entities removed from the model by the last Perform().
+  int NbRemovedEntities() const { return myNbRemovedEntities; }
+
 private:
   //! Remove entities from the work session.
   //! @param theToRemove the entities to remove.
@@ -58,6 +61,8 @@ private:
 
 private:
   occ::handle<XSControl_WorkSession> myWS; //!< The work session containing the model with entities.
+
+  int myNbRemovedEntities; //!< The number of duplicate entities removed by the last Perform().
 };
 
 #endif // _StepTidy_DuplicateCleaner_HeaderFile
@@ -90,6 +90,7 @@
 #include <Transfer_ActorOfTransientProcess.hxx>
 #include <Transfer_TransientProcess.hxx>
 #include <TransferBRep.hxx>
+#include <OSD_TraceZone.hxx>
 
 #include <cstdio>
 
@@ -123,6 +124,7 @@ void StepToTopoDS_Builder::Init(const occ::handle<StepShape_ManifoldSolidBrep>&
                                 const StepData_Factors&                         theLocalFactors,
                                 const Message_ProgressRange&                    theProgress)
 {
+  OSD_TRACE_ZONE_CATEGORY("StepToTopoDS_Builder::Init", "de");
   Message_Messenger::StreamBuffer sout       = theTP->Messenger()->SendInfo();
   occ::handle<StepData_StepModel> aStepModel = occ::down_cast<StepData_StepModel>(theTP->Model());
   // Initialisation of the Tool
@@ -185,6 +187,7 @@ void StepToTopoDS_Builder::Init(const occ::handle<StepShape_BrepWithVoids>&   th
                                 const StepData_Factors&                       theLocalFactors,
                                 const Message_ProgressRange&                  theProgress)
 {
+  OSD_TRACE_ZONE_CATEGORY("StepToTopoDS_Builder::Init", "de");
   Message_Messenger::StreamBuffer sout = theTP->Messenger()->SendInfo();
   // Initialisation of the Tool
   StepToTopoDS_Tool                                                                       aTool;
@@ -280,6 +283,7 @@ void StepToTopoDS_Builder::Init(const occ::handle<StepShape_FacetedBrep>&     th
                                 const StepData_Factors&                       theLocalFactors,
                                 const Message_ProgressRange&                  theProgress)
 {
+  OSD_TRACE_ZONE_CATEGORY("StepToTopoDS_Builder::Init", "de");
   // Initialisation of the Tool
   StepToTopoDS_Tool                                                                       aTool;
   NCollection_DataMap<occ::handle<StepShape_TopologicalRepresentationItem>, TopoDS_Shape> aMap;
@@ -391,6 +395,7 @@ void StepToTopoDS_Builder::Init(const occ::handle<StepShape_ShellBasedSurfaceMod
                                 const StepData_Factors&      theLocalFactors,
                                 const Message_ProgressRange& theProgress)
 {
+  OSD_TRACE_ZONE_CATEGORY("StepToTopoDS_Builder::Init", "de");
   Message_Messenger::StreamBuffer sout = TP->Messenger()->SendInfo();
   // Initialisation of the Tool
 
@@ -565,6 +570,7 @@ void StepToTopoDS_Builder::Init(const occ::handle<StepShape_FaceBasedSurfaceMode
                                 const occ::handle<Transfer_TransientProcess>&       TP,
                                 const StepData_Factors&                             theLocalFactors)
 {
+  OSD_TRACE_ZONE_CATEGORY("StepToTopoDS_Builder::Init", "de");
   myResult.Nullify();
 
   occ::handle<NCollection_HArray1<occ::handle<StepShape_ConnectedFaceSet>>> boundary =
@@ -70,6 +70,8 @@ void StepToTopoDS_Tool::Init(
   myDataMap   = Map;
   myVertexMap = aVertexMap;
   myEdgeMap   = aEdgeMap;
+  mySurfaceMap.Clear();
+  myCurveMap.Clear();
   myTransProc = TP;
 
   myNbC0Surf = myNbC1Surf = myNbC2Surf = 0;
@@ -172,6 +174,45 @@ const TopoDS_Vertex& StepToTopoDS_Tool::FindVertex(const occ::handle<StepGeom_Ca
 
 //=================================================================================================
 
+void StepToTopoDS_Tool::BindSurface(const occ::handle<StepGeom_Surface>& theStepSurface,
+                                    const occ::handle<Geom_Surface>&     theSurface)
+{
+  mySurfaceMap.Bind(theStepSurface, theSurface);
+}
+
+//=================================================================================================
+
+occ::handle<Geom_Surface> StepToTopoDS_Tool::ExtractSurface(
+  const occ::handle<StepGeom_Surface>& theStepSurface)
+{
+  occ::handle<Geom_Surface> aSurface;
+  if (mySurfaceMap.Find(theStepSurface, aSurface))
+  {
+    mySurfaceMap.UnBind(theStepSurface);
+  }
+  return aSurface;
+}
+
+//=================================================================================================
+
+void StepToTopoDS_Tool::BindCurve(const occ::handle<StepGeom_Curve>& theStepCurve,
+                                  const occ::handle<Geom_Curve>&     theCurve)
+{
+  myCurveMap.Bind(theStepCurve, theCurve);
+}
+
+//=================================================================================================
+
+occ::handle<Geom_Curve> StepToTopoDS_Tool::FindCurve(
+  const occ::handle<StepGeom_Curve>& theStepCurve) const
+{
+  occ::handle<Geom_Curve> aCurve;
+  myCurveMap.Find(theStepCurve, aCurve);
+  return aCurve;
+}
+
+//=================================================================================================
+
 void StepToTopoDS_Tool::ComputePCurve(const bool B)
 {
   myComputePC = B;
@@ -29,6 +29,10 @@
 #include <StepToTopoDS_PointPair.hxx>
 #include <TopoDS_Edge.hxx>
 #include <Standard_Integer.hxx>
+#include <StepGeom_Curve.hxx>
+#include <StepGeom_Surface.hxx>
+#include <Geom_Curve.hxx>
+#include <Geom_Surface.hxx>
 class Transfer_TransientProcess;
 class StepShape_TopologicalRepresentationItem;
 class TopoDS_Shape;
@@ -36,8 +40,6 @@ class StepToTopoDS_PointPair;
 class TopoDS_Edge;
 class StepGeom_CartesianPoint;
 class TopoDS_Vertex;
-class Geom_Surface;
-class Geom_Curve;
 class Geom2d_Curve;
 
 //! This Tool Class provides Information to build
@@ -84,6 +86,24 @@ public:
 
   Standard_EXPORT const TopoDS_Vertex& FindVertex(const occ::handle<StepGeom_CartesianPoint>& P);
 
+  //! Binds the surface translated in advance (e.g. in parallel threads) to the STEP surface.
+  Standard_EXPORT void BindSurface(const occ::handle<StepGeom_Surface>& theStepSurface,
+                                   const occ::handle<Geom_Surface>&     theSurface);
+
+  //! Returns the surface translated in advance and forgets it, so that it is used by one face.
+  //! @return NULL if the surface has not been translated in advance
+  Standard_EXPORT occ::handle<Geom_Surface> ExtractSurface(
+    const occ::handle<StepGeom_Surface>& theStepSurface);
+
+  //! Binds the 3D curve translated in advance (e.g. in parallel threads) to the STEP curve.
+  Standard_EXPORT void BindCurve(const occ::handle<StepGeom_Curve>& theStepCurve,
+                                 const occ::handle<Geom_Curve>&     theCurve);
+
+  //! Returns the 3D curve translated in advance.
+  //! @return NULL if the curve has not been translated in advance
+  Standard_EXPORT occ::handle<Geom_Curve> FindCurve(
+    const occ::handle<StepGeom_Curve>& theStepCurve) const;
+
   Standard_EXPORT void ComputePCurve(const bool B);
 
   Standard_EXPORT bool ComputePCurve() const;
@@ -129,6 +149,9 @@ private:
   int                                                                      myNbC0Cur3;
   int                                                                      myNbC1Cur3;
   int                                                                      myNbC2Cur3;
+  // geometry translated in advance
+  NCollection_DataMap<occ::handle<StepGeom_Surface>, occ::handle<Geom_Surface>> mySurfaceMap;
+  NCollection_DataMap<occ::handle<StepGeom_Curve>, occ::handle<Geom_Curve>>     myCurveMap;
 };
 
 #endif // _StepToTopoDS_Tool_HeaderFile
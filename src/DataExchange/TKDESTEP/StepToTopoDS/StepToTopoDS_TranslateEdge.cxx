@@ -133,14 +133,17 @@ static void DecodeMakeEdgeError(
 
 //=================================================================================================
 
-static occ::handle<Geom_Curve> MakeCurve(const occ::handle<StepGeom_Curve>&            C1,
-                                         const occ::handle<Transfer_TransientProcess>& TP,
-                                         const StepData_Factors& theLocalFactors)
+static occ::handle<Geom_Curve> MakeCurve(const occ::handle<StepGeom_Curve>& C1,
+                                         StepToTopoDS_Tool&                 theTool,
+                                         const StepData_Factors&            theLocalFactors)
 {
+  occ::handle<Transfer_TransientProcess> TP = theTool.TransientProcess();
   occ::handle<Geom_Curve> C2 = occ::down_cast<Geom_Curve>(TP->FindTransient(C1));
   if (!C2.IsNull())
     return C2;
-  C2 = StepToGeom::MakeCurve(C1, theLocalFactors);
+  C2 = theTool.FindCurve(C1);
+  if (C2.IsNull())
+    C2 = StepToGeom::MakeCurve(C1, theLocalFactors);
   if (!C2.IsNull())
     TP->BindTransient(C1, C2);
   return C2;
@@ -399,7 +402,7 @@ void StepToTopoDS_TranslateEdge::MakeFromCurve3D(const occ::handle<StepGeom_Curv
                                                  const StepData_Factors& theLocalFactors)
 {
   occ::handle<Transfer_TransientProcess> TP = aTool.TransientProcess();
-  occ::handle<Geom_Curve>                C1 = MakeCurve(C3D, TP, theLocalFactors);
+  occ::handle<Geom_Curve>                C1 = MakeCurve(C3D, aTool, theLocalFactors);
   if (C1.IsNull())
   {
     TP->AddFail(C3D, " Make Geom_Curve (3D) failed");
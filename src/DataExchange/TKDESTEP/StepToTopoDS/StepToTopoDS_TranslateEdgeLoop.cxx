@@ -327,7 +327,9 @@ void StepToTopoDS_TranslateEdgeLoop::Init(const occ::handle<StepShape_FaceBound>
         C1 = occ::down_cast<Geom_Curve>(TP->FindTransient(C));
         if (C1.IsNull())
         {
-          C1 = StepToGeom::MakeCurve(C, theLocalFactors);
+          C1 = aTool.FindCurve(C);
+          if (C1.IsNull())
+            C1 = StepToGeom::MakeCurve(C, theLocalFactors);
           if (!C1.IsNull())
             TP->BindTransient(C, C1);
           else
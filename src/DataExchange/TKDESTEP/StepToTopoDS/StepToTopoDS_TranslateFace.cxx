@@ -184,6 +184,10 @@ static void SetTriangles(
     {
       occ::handle<NCollection_HArray1<int>> aTriangleStrip =
         occ::down_cast<NCollection_HArray1<int>>(theTrianStrips->Value(aTrianStripIndex));
+      if (aTriangleStrip.IsNull())
+      {
+        continue;
+      }
       for (int anIndex = 3; anIndex <= aTriangleStrip->Length(); anIndex += 2)
       {
         if (aTriangleStrip->Value(anIndex) != aTriangleStrip->Value(anIndex - 2)
@@ -211,6 +215,10 @@ static void SetTriangles(
     {
       occ::handle<NCollection_HArray1<int>> aTriangleFan =
         occ::down_cast<NCollection_HArray1<int>>(theTrianFans->Value(aTrianFanIndex));
+      if (aTriangleFan.IsNull())
+      {
+        continue;
+      }
       for (int anIndex = 3; anIndex <= aTriangleFan->Length(); ++anIndex)
       {
         if (aTriangleFan->Value(anIndex) != aTriangleFan->Value(anIndex - 2)
@@ -390,6 +398,10 @@ static occ::handle<Poly_Triangulation> CreatePolyTriangulation(
     {
       occ::handle<NCollection_HArray1<int>> aTriangleStrip =
         occ::down_cast<NCollection_HArray1<int>>(aTriaStrips->Value(aTrianStripIndex));
+      if (aTriangleStrip.IsNull())
+      {
+        continue;
+      }
       for (int anIndex = 3; anIndex <= aTriangleStrip->Length(); anIndex += 2)
       {
         if (aTriangleStrip->Value(anIndex) != aTriangleStrip->Value(anIndex - 2)
@@ -408,6 +420,10 @@ static occ::handle<Poly_Triangulation> CreatePolyTriangulation(
     {
       occ::handle<NCollection_HArray1<int>> aTriangleFan =
         occ::down_cast<NCollection_HArray1<int>>(aTriaFans->Value(aTrianFanIndex));
+      if (aTriangleFan.IsNull())
+      {
+        continue;
+      }
       aNbTriaFans += aTriangleFan->Length() - 2;
     }
 
@@ -549,8 +565,11 @@ void StepToTopoDS_TranslateFace::Init(const occ::handle<StepShape_FaceSurface>&
     aMessageHandler->AddWarning(aStepGeomSurface, " Type OffsetSurface is out of scope of AP 214");
   }
 
-  occ::handle<Geom_Surface> aGeomSurface =
-    StepToGeom::MakeSurface(aStepGeomSurface, theLocalFactors);
+  occ::handle<Geom_Surface> aGeomSurface = theTopoDSTool.ExtractSurface(aStepGeomSurface);
+  if (aGeomSurface.IsNull())
+  {
+    aGeomSurface = StepToGeom::MakeSurface(aStepGeomSurface, theLocalFactors);
+  }
   if (aGeomSurface.IsNull())
   {
     aMessageHandler->AddFail(aStepGeomSurface, " Surface has not been created");
@@ -17,11 +17,25 @@
 //:   gka 09.04.99: S4136: improving tolerance management
 
 #include <BRep_Builder.hxx>
+#include <Geom_Curve.hxx>
+#include <Geom_Surface.hxx>
 #include <Message_ProgressScope.hxx>
+#include <NCollection_IndexedDataMap.hxx>
+#include <NCollection_IndexedMap.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_Parallel.hxx>
+#include <Standard_ErrorHandler.hxx>
+#include <Standard_Failure.hxx>
 #include <StdFail_NotDone.hxx>
 #include <StepData_Factors.hxx>
+#include <StepGeom_SurfaceCurve.hxx>
 #include <StepShape_ConnectedFaceSet.hxx>
+#include <StepShape_EdgeCurve.hxx>
+#include <StepShape_EdgeLoop.hxx>
+#include <StepShape_FaceBound.hxx>
 #include <StepShape_FaceSurface.hxx>
+#include <StepShape_OrientedEdge.hxx>
+#include <StepToGeom.hxx>
 #include <StepToTopoDS_NMTool.hxx>
 #include <StepToTopoDS_Tool.hxx>
 #include <StepToTopoDS_TranslateFace.hxx>
@@ -35,6 +49,149 @@
 #include <Transfer_TransientProcess.hxx>
 #include <TransferBRep_ShapeBinder.hxx>
 
+#include <algorithm>
+
+namespace
+{
+//! Minimal number of geometries worth translating in parallel threads.
+constexpr int THE_MIN_NB_PARALLEL_GEOMETRIES = 16;
+
+//! Returns the 3D curve of the edge to be translated by StepToTopoDS_TranslateEdge.
+occ::handle<StepGeom_Curve> edgeCurve3d(const occ::handle<StepShape_OrientedEdge>& theEdge)
+{
+  occ::handle<StepShape_OrientedEdge> anEdge = theEdge;
+  if (!anEdge.IsNull() && anEdge->EdgeElement()->IsKind(STANDARD_TYPE(StepShape_OrientedEdge)))
+  {
+    anEdge = occ::down_cast<StepShape_OrientedEdge>(anEdge->EdgeElement());
+  }
+  occ::handle<StepShape_EdgeCurve> anEdgeCurve =
+    anEdge.IsNull() ? nullptr : occ::down_cast<StepShape_EdgeCurve>(anEdge->EdgeElement());
+  if (anEdgeCurve.IsNull())
+  {
+    return nullptr;
+  }
+  occ::handle<StepGeom_Curve> aCurve = anEdgeCurve->EdgeGeometry();
+  if (!aCurve.IsNull() && aCurve->IsKind(STANDARD_TYPE(StepGeom_SurfaceCurve)))
+  {
+    aCurve = occ::down_cast<StepGeom_SurfaceCurve>(aCurve)->Curve3d();
+  }
+  return aCurve;
+}
+
+//! Translates the surfaces and the 3D edge curves of the faces of the shell in parallel threads
+//! and binds them to the tool, to be picked up by the sequential translation of the topology.
+//! Translation of geometry by StepToGeom is independent for each item, while the topology
+//! (shared edges and vertices, messages, bindings of transient process) is built sequentially
+//! in the order of the file, so the result does not depend on the number of threads.
+//! The surfaces shared by several faces are left to the sequential translation
+//! to keep distinct surface objects for the faces.
+void translateGeometry(const occ::handle<StepShape_ConnectedFaceSet>& theCFS,
+                       StepToTopoDS_Tool&                             theTool,
+                       const StepData_Factors&                        theLocalFactors)
+{
+  occ::handle<Transfer_TransientProcess> aTP = theTool.TransientProcess();
+
+  NCollection_IndexedDataMap<occ::handle<StepGeom_Surface>, int> aSurfaceUses;
+  NCollection_IndexedMap<occ::handle<StepGeom_Curve>>            aCurves;
+  for (int aFaceIter = 1; aFaceIter <= theCFS->NbCfsFaces(); ++aFaceIter)
+  {
+    occ::handle<StepShape_FaceSurface> aFace =
+      occ::down_cast<StepShape_FaceSurface>(theCFS->CfsFacesValue(aFaceIter));
+    if (aFace.IsNull() || theTool.IsBound(aFace))
+    {
+      continue;
+    }
+    const occ::handle<StepGeom_Surface>& aSurface = aFace->FaceGeometry();
+    if (!aSurface.IsNull())
+    {
+      if (int* aNbUses = aSurfaceUses.ChangeSeek(aSurface))
+      {
+        ++(*aNbUses);
+      }
+      else
+      {
+        aSurfaceUses.Add(aSurface, 1);
+      }
+    }
+    for (int aBoundIter = 1; aBoundIter <= aFace->NbBounds(); ++aBoundIter)
+    {
+      const occ::handle<StepShape_FaceBound>& aBound = aFace->BoundsValue(aBoundIter);
+      occ::handle<StepShape_EdgeLoop>         aLoop =
+        aBound.IsNull() ? nullptr : occ::down_cast<StepShape_EdgeLoop>(aBound->Bound());
+      if (aLoop.IsNull())
+      {
+        continue;
+      }
+      for (int anEdgeIter = 1; anEdgeIter <= aLoop->NbEdgeList(); ++anEdgeIter)
+      {
+        occ::handle<StepGeom_Curve> aCurve = edgeCurve3d(aLoop->EdgeListValue(anEdgeIter));
+        if (!aCurve.IsNull() && aTP->FindTransient(aCurve).IsNull()
+            && theTool.FindCurve(aCurve).IsNull())
+        {
+          aCurves.Add(aCurve);
+        }
+      }
+    }
+  }
+
+  NCollection_Vector<occ::handle<StepGeom_Surface>> aSurfaces;
+  for (int aSurfIter = 1; aSurfIter <= aSurfaceUses.Extent(); ++aSurfIter)
+  {
+    if (aSurfaceUses.FindFromIndex(aSurfIter) == 1)
+    {
+      aSurfaces.Append(aSurfaceUses.FindKey(aSurfIter));
+    }
+  }
+
+  const int aNbSurfaces = aSurfaces.Length();
+  const int aNbItems    = aNbSurfaces + aCurves.Extent();
+  if (aNbItems < THE_MIN_NB_PARALLEL_GEOMETRIES)
+  {
+    return;
+  }
+
+  // failed translations are left NULL and repeated sequentially to report the problem
+  NCollection_Array1<occ::handle<Geom_Surface>> aGeomSurfaces(0, std::max(aNbSurfaces - 1, 0));
+  NCollection_Array1<occ::handle<Geom_Curve>>   aGeomCurves(0, std::max(aCurves.Extent() - 1, 0));
+  OSD_Parallel::For(0, aNbItems, [&](const int theIndex) {
+    try
+    {
+      OCC_CATCH_SIGNALS
+      if (theIndex < aNbSurfaces)
+      {
+        aGeomSurfaces.ChangeValue(theIndex) =
+          StepToGeom::MakeSurface(aSurfaces.Value(theIndex), theLocalFactors);
+      }
+      else
+      {
+        const int aCurveIndex = theIndex - aNbSurfaces;
+        aGeomCurves.ChangeValue(aCurveIndex) =
+          StepToGeom::MakeCurve(aCurves.FindKey(aCurveIndex + 1), theLocalFactors);
+      }
+    }
+    catch (Standard_Failure const&)
+    {
+      //
+    }
+  });
+
+  for (int aSurfIter = 0; aSurfIter < aNbSurfaces; ++aSurfIter)
+  {
+    if (!aGeomSurfaces.Value(aSurfIter).IsNull())
+    {
+      theTool.BindSurface(aSurfaces.Value(aSurfIter), aGeomSurfaces.Value(aSurfIter));
+    }
+  }
+  for (int aCurveIter = 1; aCurveIter <= aCurves.Extent(); ++aCurveIter)
+  {
+    if (!aGeomCurves.Value(aCurveIter - 1).IsNull())
+    {
+      theTool.BindCurve(aCurves.FindKey(aCurveIter), aGeomCurves.Value(aCurveIter - 1));
+    }
+  }
+}
+} // namespace
+
 //=================================================================================================
 
 StepToTopoDS_TranslateShell::StepToTopoDS_TranslateShell()
@@ -75,6 +232,8 @@ void StepToTopoDS_TranslateShell::Init(const occ::handle<StepShape_ConnectedFace
     myTranFace.SetPrecision(Precision()); // gka
     myTranFace.SetMaxTol(MaxTol());
 
+    translateGeometry(CFS, aTool, theLocalFactors);
+
     Message_ProgressScope PS(theProgress, "Face", NbFc);
     for (int i = 1; i <= NbFc && PS.More(); i++, PS.Next())
     {
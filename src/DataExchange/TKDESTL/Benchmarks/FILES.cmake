@@ -0,0 +1,6 @@
+# Benchmark source files for TKDESTL
+set(OCCT_TKDESTL_Benchmarks_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
+
+set(OCCT_TKDESTL_Benchmarks_FILES
+  RWStl_Benchmark.cxx
+)
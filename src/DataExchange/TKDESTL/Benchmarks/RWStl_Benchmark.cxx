@@ -0,0 +1,69 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <OSD_Environment.hxx>
+#include <OSD_File.hxx>
+#include <Poly_Triangulation.hxx>
+#include <RWStl.hxx>
+#include <TCollection_AsciiString.hxx>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+//! Reference files within $CSF_OCCTDataPath/stl: binary and ASCII ones.
+const char* const THE_STL_FILES[] = {"TR12J_OCC64K.stl", "head.stl", "bearing.stl", "motor.stl"};
+
+//! Returns the path to the reference file or an empty string if it is missing.
+TCollection_AsciiString findDataFile(const int theIndex)
+{
+  const TCollection_AsciiString aDataPath = OSD_Environment("CSF_OCCTDataPath").Value();
+  if (aDataPath.IsEmpty())
+  {
+    return TCollection_AsciiString();
+  }
+  const TCollection_AsciiString aPath = aDataPath + "/stl/" + THE_STL_FILES[theIndex];
+  return OSD_File(OSD_Path(aPath)).Exists() ? aPath : TCollection_AsciiString();
+}
+} // namespace
+
+// Arguments: index of the reference file, flag to read in parallel threads.
+
+static void RWStl_ReadFile(benchmark::State& theState)
+{
+  const TCollection_AsciiString aPath = findDataFile(int(theState.range(0)));
+  if (aPath.IsEmpty())
+  {
+    theState.SkipWithError("Reference file is not found, set CSF_OCCTDataPath");
+    return;
+  }
+  theState.SetLabel(THE_STL_FILES[theState.range(0)]);
+  const bool    isParallel = theState.range(1) != 0;
+  const int64_t aFileSize  = int64_t(OSD_File(OSD_Path(aPath)).Size());
+  int           aNbTris    = 0;
+  for (auto _ : theState)
+  {
+    const occ::handle<Poly_Triangulation> aMesh =
+      RWStl::ReadFile(aPath.ToCString(), M_PI / 2.0, Message_ProgressRange(), isParallel);
+    if (aMesh.IsNull())
+    {
+      theState.SkipWithError("Reading of the reference file has failed");
+      break;
+    }
+    aNbTris = aMesh->NbTriangles();
+  }
+  theState.SetBytesProcessed(theState.iterations() * aFileSize);
+  theState.SetItemsProcessed(theState.iterations() * aNbTris);
+}
+BENCHMARK(RWStl_ReadFile)->ArgsProduct({{0, 1, 2, 3}, {0, 1}})->Unit(benchmark::kMillisecond);
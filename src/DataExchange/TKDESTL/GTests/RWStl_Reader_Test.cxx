@@ -0,0 +1,96 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <OSD_File.hxx>
+#include <OSD_Path.hxx>
+#include <Poly_Triangulation.hxx>
+#include <RWStl.hxx>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+//! Creates a regular grid triangulation large enough to be split into several chunks.
+occ::handle<Poly_Triangulation> createGrid(const int theNbCells)
+{
+  const int                       aNbNodes = (theNbCells + 1) * (theNbCells + 1);
+  occ::handle<Poly_Triangulation> aMesh =
+    new Poly_Triangulation(aNbNodes, 2 * theNbCells * theNbCells, false);
+  for (int aRow = 0; aRow <= theNbCells; ++aRow)
+  {
+    for (int aCol = 0; aCol <= theNbCells; ++aCol)
+    {
+      aMesh->SetNode(aRow * (theNbCells + 1) + aCol + 1,
+                     gp_Pnt(aCol, aRow, 0.01 * ((aRow * aCol) % 7)));
+    }
+  }
+  int aTriIter = 1;
+  for (int aRow = 0; aRow < theNbCells; ++aRow)
+  {
+    for (int aCol = 0; aCol < theNbCells; ++aCol)
+    {
+      const int aNode1 = aRow * (theNbCells + 1) + aCol + 1;
+      const int aNode2 = aNode1 + theNbCells + 1;
+      aMesh->SetTriangle(aTriIter++, Poly_Triangle(aNode1, aNode1 + 1, aNode2 + 1));
+      aMesh->SetTriangle(aTriIter++, Poly_Triangle(aNode1, aNode2 + 1, aNode2));
+    }
+  }
+  return aMesh;
+}
+
+//! Reads the file sequentially and in parallel and compares the results.
+void checkParallelRead(const char* theFile, const occ::handle<Poly_Triangulation>& theMesh)
+{
+  const occ::handle<Poly_Triangulation> aSequential =
+    RWStl::ReadFile(theFile, M_PI / 2.0, Message_ProgressRange(), false);
+  const occ::handle<Poly_Triangulation> aParallel =
+    RWStl::ReadFile(theFile, M_PI / 2.0, Message_ProgressRange(), true);
+  ASSERT_FALSE(aSequential.IsNull());
+  ASSERT_FALSE(aParallel.IsNull());
+  EXPECT_EQ(theMesh->NbNodes(), aSequential->NbNodes());
+  EXPECT_EQ(theMesh->NbTriangles(), aSequential->NbTriangles());
+  ASSERT_EQ(aSequential->NbNodes(), aParallel->NbNodes());
+  ASSERT_EQ(aSequential->NbTriangles(), aParallel->NbTriangles());
+  for (int aNodeIter = 1; aNodeIter <= aSequential->NbNodes(); ++aNodeIter)
+  {
+    EXPECT_TRUE(aSequential->Node(aNodeIter).IsEqual(aParallel->Node(aNodeIter), 0.0));
+  }
+  for (int aTriIter = 1; aTriIter <= aSequential->NbTriangles(); ++aTriIter)
+  {
+    int aSeqNodes[3], aParNodes[3];
+    aSequential->Triangle(aTriIter).Get(aSeqNodes[0], aSeqNodes[1], aSeqNodes[2]);
+    aParallel->Triangle(aTriIter).Get(aParNodes[0], aParNodes[1], aParNodes[2]);
+    EXPECT_EQ(aSeqNodes[0], aParNodes[0]);
+    EXPECT_EQ(aSeqNodes[1], aParNodes[1]);
+    EXPECT_EQ(aSeqNodes[2], aParNodes[2]);
+  }
+}
+} // namespace
+
+TEST(RWStl_Reader_Test, ParallelBinary)
+{
+  const occ::handle<Poly_Triangulation> aMesh = createGrid(150);
+  const char*                           aFile = "RWStl_Reader_Test_ParallelBinary.stl";
+  ASSERT_TRUE(RWStl::WriteBinary(aMesh, OSD_Path(aFile)));
+  checkParallelRead(aFile, aMesh);
+  OSD_File(OSD_Path(aFile)).Remove();
+}
+
+TEST(RWStl_Reader_Test, ParallelAscii)
+{
+  const occ::handle<Poly_Triangulation> aMesh = createGrid(150);
+  const char*                           aFile = "RWStl_Reader_Test_ParallelAscii.stl";
+  ASSERT_TRUE(RWStl::WriteAscii(aMesh, OSD_Path(aFile)));
+  checkParallelRead(aFile, aMesh);
+  OSD_File(OSD_Path(aFile)).Remove();
+}
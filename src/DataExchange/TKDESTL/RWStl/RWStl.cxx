@@ -146,10 +146,12 @@ private:
 
 occ::handle<Poly_Triangulation> RWStl::ReadFile(const char*                  theFile,
                                                 const double                 theMergeAngle,
-                                                const Message_ProgressRange& theProgress)
+                                                const Message_ProgressRange& theProgress,
+                                                const bool                   theToParallel)
 {
   Reader aReader;
   aReader.SetMergeAngle(theMergeAngle);
+  aReader.SetParallel(theToParallel);
   aReader.Read(theFile, theProgress);
   // note that returned bool value is ignored intentionally -- even if something went wrong,
   // but some data have been read, we at least will return these data
@@ -161,10 +163,12 @@ occ::handle<Poly_Triangulation> RWStl::ReadFile(const char*                  the
 void RWStl::ReadFile(const char*                                            theFile,
                      const double                                           theMergeAngle,
                      NCollection_Sequence<occ::handle<Poly_Triangulation>>& theTriangList,
-                     const Message_ProgressRange&                           theProgress)
+                     const Message_ProgressRange&                           theProgress,
+                     const bool                                             theToParallel)
 {
   MultiDomainReader aReader;
   aReader.SetMergeAngle(theMergeAngle);
+  aReader.SetParallel(theToParallel);
   aReader.Read(theFile, theProgress);
   theTriangList.Clear();
   theTriangList.Append(aReader.ChangeTriangulationList());
@@ -74,11 +74,13 @@ public:
   //! @param[in] theMergeAngle maximum angle in radians between triangles to merge equal nodes;
   //! M_PI/2 means ignore angle
   //! @param[in] theProgress progress indicator
+  //! @param[in] theToParallel decode facets and merge nodes in parallel threads
   //! @return result triangulation or NULL in case of error
   Standard_EXPORT static occ::handle<Poly_Triangulation> ReadFile(
     const char*                  theFile,
     const double                 theMergeAngle,
-    const Message_ProgressRange& theProgress = Message_ProgressRange());
+    const Message_ProgressRange& theProgress   = Message_ProgressRange(),
+    const bool                   theToParallel = false);
 
   //! Read specified STL file and fills triangulation list for multi-domain case.
   //! @param[in] theFile file path to read
@@ -86,11 +88,13 @@ public:
   //! M_PI/2 means ignore angle
   //! @param[out] theTriangList triangulation list for multi-domain case
   //! @param[in] theProgress progress indicator
+  //! @param[in] theToParallel decode facets and merge nodes in parallel threads
   Standard_EXPORT static void ReadFile(
     const char*                                            theFile,
     const double                                           theMergeAngle,
     NCollection_Sequence<occ::handle<Poly_Triangulation>>& theTriangList,
-    const Message_ProgressRange&                           theProgress = Message_ProgressRange());
+    const Message_ProgressRange&                           theProgress   = Message_ProgressRange(),
+    const bool                                             theToParallel = false);
 
   //! Read triangulation from a binary STL file
   //! In case of error, returns Null handle.
@@ -22,11 +22,13 @@
 #include <NCollection_IncAllocator.hxx>
 #include <FSD_BinaryFile.hxx>
 #include <OSD_FileSystem.hxx>
+#include <OSD_Parallel.hxx>
 #include <OSD_Timer.hxx>
 #include <Poly_MergeNodesTool.hxx>
 #include <Standard_CLocaleSentry.hxx>
 
 #include <algorithm>
+#include <cstring>
 #include <limits>
 
 IMPLEMENT_STANDARD_RTTIEXT(RWStl_Reader, Standard_Transient)
@@ -41,6 +43,10 @@ static const size_t THE_STL_MIN_FILE_SIZE = THE_STL_HEADER_SIZE + THE_STL_SIZEOF
 // The length of buffer to read (in bytes)
 static const size_t THE_BUFFER_SIZE = 1024;
 
+// Minimal number of binary facets and Ascii data length worth a dedicated parallel task
+static const int    THE_MIN_CHUNK_NBFACETS = 16384;
+static const size_t THE_MIN_CHUNK_SIZE     = 1024 * 1024;
+
 //! Auxiliary tool for merging nodes during STL reading.
 class MergeNodeTool : public Poly_MergeNodesTool
 {
@@ -121,7 +127,8 @@ inline static gp_XYZ readStlFloatVec3(const char* theData)
 
 RWStl_Reader::RWStl_Reader()
     : myMergeAngle(M_PI / 2.0),
-      myMergeTolearance(0.0)
+      myMergeTolearance(0.0),
+      myToParallel(false)
 {
   //
 }
@@ -131,7 +138,16 @@ RWStl_Reader::RWStl_Reader()
 bool RWStl_Reader::Read(const char* theFile, const Message_ProgressRange& theProgress)
 {
   const occ::handle<OSD_FileSystem>& aFileSystem = OSD_FileSystem::DefaultFileSystem();
-  std::shared_ptr<std::istream>      aStream =
+  if (myToParallel)
+  {
+    // the whole file is needed in memory to decode it in parallel chunks
+    if (occ::handle<NCollection_Buffer> aMapped = aFileSystem->OpenMappedBuffer(theFile))
+    {
+      return ReadBuffer((const char*)aMapped->Data(), aMapped->Size(), theProgress);
+    }
+  }
+
+  std::shared_ptr<std::istream> aStream =
     aFileSystem->OpenIStream(theFile, std::ios::in | std::ios::binary);
   if (aStream.get() == nullptr)
   {
@@ -276,6 +292,217 @@ static bool ReadVertex(const char* theStr, double& theX, double& theY, double& t
   return aEnd != aStr;
 }
 
+//! Return the next line within the buffer.
+//! @param[in,out] thePos     current position, moved to the beginning of the next line
+//! @param[in]     theEnd     end of the buffer
+//! @param[out]    theLine    beginning of the line with leading spaces skipped
+//! @param[out]    theLineEnd end of the line with trailing spaces and EOL symbols skipped
+//! @return FALSE if end of buffer has been reached
+static bool readBufferLine(const char*& thePos,
+                           const char*  theEnd,
+                           const char*& theLine,
+                           const char*& theLineEnd)
+{
+  if (thePos >= theEnd)
+  {
+    return false;
+  }
+
+  const char* anEol = (const char*)::memchr(thePos, '\n', size_t(theEnd - thePos));
+  theLine           = thePos;
+  theLineEnd        = anEol != nullptr ? anEol : theEnd;
+  thePos            = anEol != nullptr ? anEol + 1 : theEnd;
+  while (theLine < theLineEnd && isspace((unsigned char)*theLine))
+  {
+    ++theLine;
+  }
+  while (theLineEnd > theLine && isspace((unsigned char)theLineEnd[-1]))
+  {
+    --theLineEnd;
+  }
+  return true;
+}
+
+//! Return TRUE if the line starts with specified word (case-insensitive).
+static bool lineStartsWith(const char* theLine,
+                           const char* theLineEnd,
+                           const char* theWord,
+                           const int   theN)
+{
+  return theLineEnd - theLine >= theN && !strncasecmp(theLine, theWord, theN);
+}
+
+namespace
+{
+//! Facets of Ascii STL data chunk read by a dedicated thread.
+struct AsciiChunk
+{
+  const char*                                         Begin;       //!< beginning of the chunk
+  const char*                                         End;         //!< end of the chunk
+  NCollection_Vector<occ::handle<Poly_Triangulation>> Segments;    //!< facets split by "endsolid"
+  const char*                                         ErrorPos;    //!< line with syntax error
+  const char*                                         ErrorMsg;    //!< syntax error message
+  bool                                                IsTruncated; //!< data ended within facet
+
+  AsciiChunk()
+      : Begin(nullptr),
+        End(nullptr),
+        ErrorPos(nullptr),
+        ErrorMsg(nullptr),
+        IsTruncated(false)
+  {
+  }
+};
+
+//! Create triangulation with unmerged nodes from the list of facet nodes.
+static occ::handle<Poly_Triangulation> createFacets(const NCollection_Vector<gp_XYZ>& theNodes,
+                                                     const int                         theFrom,
+                                                     const int                         theTo)
+{
+  if (theTo <= theFrom)
+  {
+    return occ::handle<Poly_Triangulation>();
+  }
+
+  occ::handle<Poly_Triangulation> aTris = new Poly_Triangulation();
+  aTris->ResizeNodes((theTo - theFrom) * 3, false);
+  aTris->ResizeTriangles(theTo - theFrom, false);
+  for (int aFacetIter = theFrom, aNodeIter = 1; aFacetIter < theTo; ++aFacetIter)
+  {
+    for (int aCornerIter = 0; aCornerIter < 3; ++aCornerIter, ++aNodeIter)
+    {
+      aTris->SetNode(aNodeIter, theNodes.Value(aFacetIter * 3 + aCornerIter));
+    }
+    aTris->SetTriangle(aNodeIter / 3, Poly_Triangle(aNodeIter - 3, aNodeIter - 2, aNodeIter - 1));
+  }
+  return aTris;
+}
+
+//! Parse facets of Ascii STL data chunk.
+static void readAsciiChunk(AsciiChunk& theChunk)
+{
+  NCollection_Vector<gp_XYZ> aNodes(1024 * 3);
+  int                        aSegmentStart = 0;
+  char                       aVertexLine[THE_BUFFER_SIZE];
+  const char*                aPos     = theChunk.Begin;
+  const char*                aLine    = nullptr;
+  const char*                aLineEnd = nullptr;
+  while (readBufferLine(aPos, theChunk.End, aLine, aLineEnd))
+  {
+    if (aLine == aLineEnd)
+    {
+      continue; // skip empty lines
+    }
+    else if (lineStartsWith(aLine, aLineEnd, "endsolid", 8))
+    {
+      theChunk.Segments.Append(createFacets(aNodes, aSegmentStart, aNodes.Length() / 3));
+      aSegmentStart = aNodes.Length() / 3;
+      continue;
+    }
+    else if (lineStartsWith(aLine, aLineEnd, "solid", 5))
+    {
+      continue; // header of the next domain
+    }
+    else if (!lineStartsWith(aLine, aLineEnd, "facet", 5))
+    {
+      theChunk.ErrorPos = aLine;
+      theChunk.ErrorMsg = "Error: unexpected format of facet at line ";
+      break;
+    }
+
+    const char* aFacetLine = aLine;
+    if (!readBufferLine(aPos, theChunk.End, aLine, aLineEnd)
+        || !lineStartsWith(aLine, aLineEnd, "outer", 5))
+    {
+      theChunk.ErrorPos = aFacetLine;
+      theChunk.ErrorMsg = "Error: unexpected format of facet at line ";
+      break;
+    }
+
+    gp_XYZ aVertex[3];
+    for (int aCornerIter = 0; aCornerIter < 3 && theChunk.ErrorPos == nullptr; ++aCornerIter)
+    {
+      if (!readBufferLine(aPos, theChunk.End, aLine, aLineEnd))
+      {
+        theChunk.IsTruncated = true;
+        break;
+      }
+
+      const size_t aLen = std::min(size_t(aLineEnd - aLine), THE_BUFFER_SIZE - 1);
+      std::memcpy(aVertexLine, aLine, aLen);
+      aVertexLine[aLen] = '\0';
+      if (!ReadVertex(aVertexLine,
+                      aVertex[aCornerIter].ChangeCoord(1),
+                      aVertex[aCornerIter].ChangeCoord(2),
+                      aVertex[aCornerIter].ChangeCoord(3)))
+      {
+        theChunk.ErrorPos = aLine;
+        theChunk.ErrorMsg = "Error: cannot read vertex coordinates at line ";
+      }
+    }
+    if (theChunk.IsTruncated || theChunk.ErrorPos != nullptr)
+    {
+      break;
+    }
+
+    aNodes.Append(aVertex[0]);
+    aNodes.Append(aVertex[1]);
+    aNodes.Append(aVertex[2]);
+    readBufferLine(aPos, theChunk.End, aLine, aLineEnd); // skip "endloop"
+    readBufferLine(aPos, theChunk.End, aLine, aLineEnd); // skip "endfacet"
+  }
+  theChunk.Segments.Append(createFacets(aNodes, aSegmentStart, aNodes.Length() / 3));
+}
+
+//! Merge nodes of facets and pass the result to the reader.
+//! @param[in] theReader   reader to fill
+//! @param[in] theParts    triangulations with unmerged facet nodes
+//! @param[in] theNbFacets overall number of facets
+static void addMergedFacets(
+  RWStl_Reader&                                                     theReader,
+  const NCollection_Array1<Poly_MergeNodesTool::TriangulationPart>& theParts,
+  const int                                                         theNbFacets)
+{
+  Poly_MergeNodesTool aMergeTool(theReader.MergeAngle(), 0.0, theNbFacets);
+  aMergeTool.SetMergeAngle(theReader.MergeAngle());
+  aMergeTool.SetMergeTolerance(theReader.MergeTolerance());
+  aMergeTool.AddTriangulations(theParts, theReader.ToParallel());
+
+  const occ::handle<Poly_Triangulation> aResult = aMergeTool.Result();
+  NCollection_Array1<int>               aNodeIds(1, std::max(1, aResult->NbNodes()));
+  for (int aNodeIter = 1; aNodeIter <= aResult->NbNodes(); ++aNodeIter)
+  {
+    aNodeIds.SetValue(aNodeIter, theReader.AddNode(aResult->Node(aNodeIter).XYZ()));
+  }
+  for (int aTriIter = 1; aTriIter <= aResult->NbTriangles(); ++aTriIter)
+  {
+    int aN1 = 0, aN2 = 0, aN3 = 0;
+    aResult->Triangle(aTriIter).Get(aN1, aN2, aN3);
+    theReader.AddTriangle(aNodeIds.Value(aN1), aNodeIds.Value(aN2), aNodeIds.Value(aN3));
+  }
+}
+
+//! Merge nodes of collected facets, pass them to the reader and clear the list.
+static void addMergedFacets(RWStl_Reader&                                               theReader,
+                            NCollection_Vector<Poly_MergeNodesTool::TriangulationPart>& theParts)
+{
+  if (theParts.IsEmpty())
+  {
+    return;
+  }
+
+  int                                                        aNbFacets = 0;
+  NCollection_Array1<Poly_MergeNodesTool::TriangulationPart> aParts(0, theParts.Length() - 1);
+  for (int aPartIter = 0; aPartIter < theParts.Length(); ++aPartIter)
+  {
+    aParts.SetValue(aPartIter, theParts.Value(aPartIter));
+    aNbFacets += theParts.Value(aPartIter).Triangulation->NbTriangles();
+  }
+  addMergedFacets(theReader, aParts, aNbFacets);
+  theParts.Clear();
+}
+} // namespace
+
 //=================================================================================================
 
 bool RWStl_Reader::ReadAscii(Standard_IStream&            theStream,
@@ -467,3 +694,235 @@ bool RWStl_Reader::ReadBinary(Standard_IStream& theStream, const Message_Progres
 
   return aPS.More();
 }
+
+//=================================================================================================
+
+bool RWStl_Reader::ReadBuffer(const char*                  theData,
+                              const size_t                 theSize,
+                              const Message_ProgressRange& theProgress)
+{
+  // same detection as by IsAscii(): files shorter than binary STL with one facet are Ascii,
+  // otherwise binary format is detected by presence of non-ascii symbols in first bytes
+  bool isAscii = true;
+  for (size_t aByteIter = 0; theSize >= THE_STL_MIN_FILE_SIZE && aByteIter < THE_STL_MIN_FILE_SIZE;
+       ++aByteIter)
+  {
+    if ((unsigned char)theData[aByteIter] > (unsigned char)'~')
+    {
+      isAscii = false;
+      break;
+    }
+  }
+
+  Message_ProgressScope aPS(theProgress, nullptr, 1, true);
+  if (isAscii)
+  {
+    return readAsciiBuffer(theData, theSize, aPS.Next(2));
+  }
+
+  for (size_t anOffset = 0; anOffset < theSize;)
+  {
+    if (!readBinaryBuffer(theData, theSize, anOffset, aPS.Next(2)))
+    {
+      return false;
+    }
+    // skip any white spaces
+    while (anOffset < theSize && isspace((unsigned char)theData[anOffset]))
+    {
+      ++anOffset;
+    }
+    AddSolid();
+  }
+  return true;
+}
+
+//=================================================================================================
+
+bool RWStl_Reader::readBinaryBuffer(const char*                  theData,
+                                    const size_t                 theSize,
+                                    size_t&                      theOffset,
+                                    const Message_ProgressRange& theProgress)
+{
+  if (theSize - theOffset < THE_STL_HEADER_SIZE)
+  {
+    Message::SendFail("Error: Corrupted binary STL file");
+    return false;
+  }
+
+  // number of facets is stored as 32-bit integer at position 80
+  int32_t aNbFacetsHeader = 0;
+  std::memcpy(&aNbFacetsHeader, theData + theOffset + 80, sizeof(aNbFacetsHeader));
+  theOffset += THE_STL_HEADER_SIZE;
+
+  // don't trust the number of triangles which is coded in the file
+  const int aNbAvailable = int(std::min((theSize - theOffset) / THE_STL_SIZEOF_FACET,
+                                        (size_t)std::numeric_limits<int>::max()));
+  const int aNbFacets    = std::max(0, std::min(aNbFacetsHeader, aNbAvailable));
+  const int aNbChunks    = myToParallel ? std::max(1,
+                                                 std::min(OSD_Parallel::NbLogicalProcessors() * 4,
+                                                          aNbFacets / THE_MIN_CHUNK_NBFACETS))
+                                          : 1;
+
+  Message_ProgressScope aPS(theProgress, "Reading binary STL file", 2);
+  NCollection_Array1<Poly_MergeNodesTool::TriangulationPart> aParts(0, aNbChunks - 1);
+  {
+    // decode facets into triangulations with unmerged nodes
+    const char*           aFacets = theData + theOffset;
+    Message_ProgressScope aChunksScope(aPS.Next(), nullptr, aNbChunks);
+    NCollection_Array1<Message_ProgressRange> aRanges(0, aNbChunks - 1);
+    for (int aChunkIter = 0; aChunkIter < aNbChunks; ++aChunkIter)
+    {
+      aRanges.SetValue(aChunkIter, aChunksScope.Next());
+    }
+    OSD_Parallel::For(
+      0,
+      aNbChunks,
+      [&](int theChunkIndex) {
+        Message_ProgressScope aChunkScope(aRanges.Value(theChunkIndex), nullptr, 1);
+        const int             aFrom = int(int64_t(aNbFacets) * theChunkIndex / aNbChunks);
+        const int             aTo   = int(int64_t(aNbFacets) * (theChunkIndex + 1) / aNbChunks);
+        if (aTo <= aFrom)
+        {
+          return;
+        }
+
+        // normal + 3 nodes + 2 extra bytes
+        const size_t                    aVec3Size = sizeof(float) * 3;
+        occ::handle<Poly_Triangulation> aTris     = new Poly_Triangulation();
+        aTris->SetDoublePrecision(false);
+        aTris->ResizeNodes((aTo - aFrom) * 3, false);
+        aTris->ResizeTriangles(aTo - aFrom, false);
+        for (int aFacetIter = aFrom, aNodeIter = 1; aFacetIter < aTo; ++aFacetIter, aNodeIter += 3)
+        {
+          const char* aFacet = aFacets + size_t(aFacetIter) * THE_STL_SIZEOF_FACET;
+          aTris->SetNode(aNodeIter, readStlFloatVec3(aFacet + aVec3Size));
+          aTris->SetNode(aNodeIter + 1, readStlFloatVec3(aFacet + aVec3Size * 2));
+          aTris->SetNode(aNodeIter + 2, readStlFloatVec3(aFacet + aVec3Size * 3));
+          aTris->SetTriangle(aFacetIter - aFrom + 1,
+                             Poly_Triangle(aNodeIter, aNodeIter + 1, aNodeIter + 2));
+        }
+        aParts.ChangeValue(theChunkIndex).Triangulation = aTris;
+        aChunkScope.Next();
+      },
+      !myToParallel);
+  }
+  if (!aPS.More())
+  {
+    return false;
+  }
+
+  addMergedFacets(*this, aParts, aNbFacets);
+  aPS.Next();
+  theOffset += size_t(aNbFacets) * THE_STL_SIZEOF_FACET;
+  if (aNbFacets < aNbFacetsHeader)
+  {
+    theOffset = theSize;
+    Message::SendFail("Error: binary STL read failed");
+    return false;
+  }
+  return aPS.More();
+}
+
+//=================================================================================================
+
+bool RWStl_Reader::readAsciiBuffer(const char*                  theData,
+                                   const size_t                 theSize,
+                                   const Message_ProgressRange& theProgress)
+{
+  const char* aDataEnd  = theData + theSize;
+  const int   aNbChunks = myToParallel ? std::max(1,
+                                                std::min(OSD_Parallel::NbLogicalProcessors() * 4,
+                                                         int(theSize / THE_MIN_CHUNK_SIZE)))
+                                       : 1;
+
+  // split data into chunks right after "endfacet" lines
+  NCollection_Array1<AsciiChunk> aChunks(0, aNbChunks - 1);
+  const char*                    aChunkStart = theData;
+  for (int aChunkIter = 0; aChunkIter < aNbChunks; ++aChunkIter)
+  {
+    AsciiChunk& aChunk = aChunks.ChangeValue(aChunkIter);
+    aChunk.Begin       = aChunkStart;
+    aChunk.End         = aDataEnd;
+    if (aChunkIter + 1 < aNbChunks)
+    {
+      const char* aPos =
+        std::max(aChunkStart, theData + int64_t(theSize) * (aChunkIter + 1) / aNbChunks);
+      const char* aLine    = nullptr;
+      const char* aLineEnd = nullptr;
+      readBufferLine(aPos, aDataEnd, aLine, aLineEnd); // skip incomplete line
+      while (readBufferLine(aPos, aDataEnd, aLine, aLineEnd)
+             && !lineStartsWith(aLine, aLineEnd, "endfacet", 8))
+      {
+        //
+      }
+      aChunk.End = aPos;
+    }
+    aChunkStart = aChunk.End;
+  }
+
+  Message_ProgressScope aPS(theProgress, "Reading text STL file", 2);
+  {
+    Message_ProgressScope                     aChunksScope(aPS.Next(), nullptr, aNbChunks);
+    NCollection_Array1<Message_ProgressRange> aRanges(0, aNbChunks - 1);
+    for (int aChunkIter = 0; aChunkIter < aNbChunks; ++aChunkIter)
+    {
+      aRanges.SetValue(aChunkIter, aChunksScope.Next());
+    }
+    OSD_Parallel::For(
+      0,
+      aNbChunks,
+      [&](int theChunkIndex) {
+        Message_ProgressScope aChunkScope(aRanges.Value(theChunkIndex), nullptr, 1);
+        readAsciiChunk(aChunks.ChangeValue(theChunkIndex));
+        aChunkScope.Next();
+      },
+      !myToParallel);
+  }
+  if (!aPS.More())
+  {
+    return false;
+  }
+
+  // merge nodes of each domain
+  NCollection_Vector<Poly_MergeNodesTool::TriangulationPart> aDomainParts;
+  for (int aChunkIter = 0; aChunkIter < aNbChunks; ++aChunkIter)
+  {
+    const AsciiChunk& aChunk = aChunks.Value(aChunkIter);
+    for (int aSegIter = 0; aSegIter < aChunk.Segments.Length(); ++aSegIter)
+    {
+      const occ::handle<Poly_Triangulation>& aSegment = aChunk.Segments.Value(aSegIter);
+      if (!aSegment.IsNull())
+      {
+        aDomainParts.Append(Poly_MergeNodesTool::TriangulationPart(aSegment, gp_Trsf(), false));
+      }
+      if (aSegIter + 1 < aChunk.Segments.Length())
+      {
+        // "endsolid" has been met
+        addMergedFacets(*this, aDomainParts);
+        AddSolid();
+      }
+    }
+
+    if (aChunk.ErrorPos != nullptr)
+    {
+      addMergedFacets(*this, aDomainParts);
+      const int aLineNb = 1 + (int)std::count(theData, aChunk.ErrorPos, '\n');
+      Message::SendFail(TCollection_AsciiString(aChunk.ErrorMsg) + aLineNb);
+      return false;
+    }
+  }
+
+  // note that well-formatted file never ends by the vertex line
+  if (!aDomainParts.IsEmpty())
+  {
+    addMergedFacets(*this, aDomainParts);
+    if (!aChunks.Last().IsTruncated)
+    {
+      Message::SendFail("Error: premature end of file");
+      return false;
+    }
+    AddSolid();
+  }
+  aPS.Next();
+  return true;
+}
@@ -32,6 +32,10 @@ class Message_ProgressRange;
 //! addNode() and addTriangle() to fill the mesh data structure.
 //!
 //! The nodes with equal coordinates are merged automatically on the fly.
+//!
+//! With ToParallel() option the file is mapped into memory and read by ReadBuffer(),
+//! so that facets are decoded in parallel chunks and nodes are merged in parallel threads
+//! before passing them to addNode() and addTriangle().
 class RWStl_Reader : public Standard_Transient
 {
   DEFINE_STANDARD_RTTIEXT(RWStl_Reader, Standard_Transient)
@@ -48,6 +52,17 @@ public:
   //! Returns true if success, false on error or user break.
   Standard_EXPORT bool Read(const char* theFile, const Message_ProgressRange& theProgress);
 
+  //! Reads STL data (either binary or Ascii) from memory buffer holding the whole file,
+  //! e.g. file mapped into memory.
+  //! Facets are decoded into intermediate arrays in parallel chunks (Ascii data is split at
+  //! "endfacet" lines) and nodes are merged by Poly_MergeNodesTool in parallel threads when
+  //! ToParallel() is set; AddNode() and AddTriangle() are then called with already merged data.
+  //! This function supports reading multi-domain STL files like Read().
+  //! Returns true if success, false on error or user break.
+  Standard_EXPORT bool ReadBuffer(const char*                  theData,
+                                  const size_t                 theSize,
+                                  const Message_ProgressRange& theProgress);
+
   //! Guess whether the stream is an Ascii STL file, by analysis of the first bytes (~200).
   //! If the stream does not support seekg() then the parameter isSeekgAvailable should
   //! be passed as 'false', in this case the function attempts to put back the read symbols
@@ -105,9 +120,36 @@ public:
   //! Set linear merge tolerance.
   void SetMergeTolerance(double theTolerance) { myMergeTolearance = theTolerance; }
 
+  //! Return TRUE if file should be read in parallel threads; FALSE by default.
+  bool ToParallel() const { return myToParallel; }
+
+  //! Set flag to read file in parallel threads.
+  //! Read() maps the file into memory and reads it by ReadBuffer() in this case.
+  void SetParallel(bool theToParallel) { myToParallel = theToParallel; }
+
+protected:
+  //! Reads binary STL domain from memory buffer.
+  //! @param[in]     theData     buffer with the whole file
+  //! @param[in]     theSize     buffer size
+  //! @param[in,out] theOffset   position of the domain header, moved to the end of the domain
+  //! @param[in]     theProgress progress indicator
+  Standard_EXPORT bool readBinaryBuffer(const char*                  theData,
+                                        const size_t                 theSize,
+                                        size_t&                      theOffset,
+                                        const Message_ProgressRange& theProgress);
+
+  //! Reads all domains of Ascii STL data from memory buffer.
+  //! @param[in] theData     buffer with the whole file
+  //! @param[in] theSize     buffer size
+  //! @param[in] theProgress progress indicator
+  Standard_EXPORT bool readAsciiBuffer(const char*                  theData,
+                                       const size_t                 theSize,
+                                       const Message_ProgressRange& theProgress);
+
 protected:
   double myMergeAngle;
   double myMergeTolearance;
+  bool   myToParallel;
 };
 
 #endif
@@ -72,6 +72,8 @@ bool DEVRML_ConfigurationNode::Load(const occ::handle<DE_ConfigurationContext>&
       "write.representation.type",
       InternalParameters.WriteRepresentationType,
       aScope);
+  InternalParameters.WriteParallel =
+    theResource->BooleanVal("write.parallel", InternalParameters.WriteParallel, aScope);
 
   return true;
 }
@@ -135,6 +137,12 @@ TCollection_AsciiString DEVRML_ConfigurationNode::Save() const
     aScope + "write.representation.type :\t " + InternalParameters.WriteRepresentationType + "\n";
   aResult += "!\n";
 
+  aResult += "!\n";
+  aResult += "!Formatting of coordinates and indices in parallel threads\n";
+  aResult += "!Default value: 0(\"OFF\"). Available values: 0(\"OFF\"), 1(\"ON\")\n";
+  aResult += aScope + "write.parallel :\t " + InternalParameters.WriteParallel + "\n";
+  aResult += "!\n";
+
   aResult += "!*****************************************************************************\n";
   return aResult;
 }
@@ -106,6 +106,7 @@ public:
     // Write
     WriteMode_WriterVersion WriterVersion = WriteMode_WriterVersion_2; //!< Setting up writer version (1/2)
     WriteMode_RepresentationType WriteRepresentationType = WriteMode_RepresentationType_Wireframe; //!< Setting up representation (shaded/wireframe/both)
+    bool WriteParallel = false; //!< Format coordinates and indices in parallel threads
     // clang-format on
 
   } InternalParameters;
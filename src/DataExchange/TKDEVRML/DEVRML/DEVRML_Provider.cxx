@@ -305,6 +305,7 @@ bool DEVRML_Provider::Write(const TCollection_AsciiString&       thePath,
   VrmlAPI_Writer aWriter;
   aWriter.SetRepresentation(
     static_cast<VrmlAPI_RepresentationOfShape>(aNode->InternalParameters.WriteRepresentationType));
+  aWriter.SetParallel(aNode->InternalParameters.WriteParallel);
 
   double aScaling = CalculateScalingFactor(theDocument, aNode, aContext);
   if (!aWriter.WriteDoc(theDocument, thePath.ToCString(), aScaling))
@@ -486,6 +487,7 @@ bool DEVRML_Provider::Write(WriteStreamList&                     theStreams,
   VrmlAPI_Writer aWriter;
   aWriter.SetRepresentation(
     static_cast<VrmlAPI_RepresentationOfShape>(aNode->InternalParameters.WriteRepresentationType));
+  aWriter.SetParallel(aNode->InternalParameters.WriteParallel);
 
   Standard_OStream& aStream = theStreams.First().Stream;
 
@@ -550,6 +552,7 @@ bool DEVRML_Provider::Write(WriteStreamList&             theStreams,
   VrmlAPI_Writer aWriter;
   aWriter.SetRepresentation(
     static_cast<VrmlAPI_RepresentationOfShape>(aNode->InternalParameters.WriteRepresentationType));
+  aWriter.SetParallel(aNode->InternalParameters.WriteParallel);
 
   Standard_OStream& aStream = theStreams.First().Stream;
 
@@ -0,0 +1,119 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <VrmlData_Coordinate.hxx>
+#include <VrmlData_IndexedFaceSet.hxx>
+#include <VrmlData_Normal.hxx>
+#include <VrmlData_Scene.hxx>
+#include <VrmlData_ShapeNode.hxx>
+
+#include <sstream>
+#include <gtest/gtest.h>
+
+namespace
+{
+//! Adds to the scene a shape node with a regular grid of (theNbCells + 1)^2 nodes.
+//! With theToPentagons flag every fifth cell is written as a pentagon
+//! to check polygons wrapped on several lines.
+occ::handle<VrmlData_IndexedFaceSet> addGrid(VrmlData_Scene& theScene,
+                                             const char*     theName,
+                                             const int       theNbCells,
+                                             const bool      theToPentagons)
+{
+  const occ::handle<NCollection_IncAllocator>& anAlloc  = theScene.Allocator();
+  const int                                    aNbNodes = (theNbCells + 1) * (theNbCells + 1);
+  const int                                    aNbPolys = theNbCells * theNbCells;
+  gp_XYZ* aNodes   = static_cast<gp_XYZ*>(anAlloc->Allocate(aNbNodes * sizeof(gp_XYZ)));
+  gp_XYZ* aNormals = static_cast<gp_XYZ*>(anAlloc->Allocate(aNbNodes * sizeof(gp_XYZ)));
+  for (int aRow = 0; aRow <= theNbCells; ++aRow)
+  {
+    for (int aCol = 0; aCol <= theNbCells; ++aCol)
+    {
+      const int aNode = aRow * (theNbCells + 1) + aCol;
+      aNodes[aNode]   = gp_XYZ(aCol * 0.1, aRow / 3.0, 1.0e-7 * aRow * aCol);
+      aNormals[aNode] = gp_XYZ(0.0, 0.6, 0.8);
+    }
+  }
+
+  const int** aPolys = static_cast<const int**>(anAlloc->Allocate(aNbPolys * sizeof(int*)));
+  for (int aRow = 0, aPolyIter = 0; aRow < theNbCells; ++aRow)
+  {
+    for (int aCol = 0; aCol < theNbCells; ++aCol, ++aPolyIter)
+    {
+      const int aNode1 = aRow * (theNbCells + 1) + aCol;
+      const int aNode2 = aNode1 + theNbCells + 1;
+      const int aNbVal = theToPentagons && aPolyIter % 5 == 0 ? 5 : 4;
+      int*      aPoly  = static_cast<int*>(anAlloc->Allocate((aNbVal + 1) * sizeof(int)));
+      aPoly[0]         = aNbVal;
+      aPoly[1]         = aNode1;
+      aPoly[2]         = aNode1 + 1;
+      aPoly[3]         = aNode2 + 1;
+      aPoly[4]         = aNode2;
+      if (aNbVal == 5)
+      {
+        aPoly[5] = aNode1;
+      }
+      aPolys[aPolyIter] = aPoly;
+    }
+  }
+
+  occ::handle<VrmlData_IndexedFaceSet> aFaceSet = new VrmlData_IndexedFaceSet(theScene, "");
+  aFaceSet->SetCoordinates(new VrmlData_Coordinate(theScene, "", aNbNodes, aNodes));
+  aFaceSet->SetNormals(new VrmlData_Normal(theScene, "", aNbNodes, aNormals));
+  aFaceSet->SetPolygons(aNbPolys, aPolys);
+
+  occ::handle<VrmlData_ShapeNode> aShapeNode = new VrmlData_ShapeNode(theScene, theName);
+  aShapeNode->SetGeometry(aFaceSet);
+  theScene.AddNode(aShapeNode);
+  return aFaceSet;
+}
+
+//! Fills the scene with several grids, one of them sharing the geometry of another.
+void fillScene(VrmlData_Scene& theScene)
+{
+  theScene.SetLinearScale(0.001);
+  addGrid(theScene, "Small", 3, true);
+  const occ::handle<VrmlData_IndexedFaceSet> aLarge = addGrid(theScene, "Large", 250, false);
+  addGrid(theScene, "Medium", 40, true);
+
+  occ::handle<VrmlData_ShapeNode> aCopy = new VrmlData_ShapeNode(theScene, "Copy");
+  aCopy->SetGeometry(aLarge);
+  theScene.AddNode(aCopy);
+}
+} // namespace
+
+TEST(VrmlData_Scene_Test, ParallelWriteIsIdentical)
+{
+  VrmlData_Scene aSerialScene;
+  fillScene(aSerialScene);
+  std::ostringstream aSerialStream;
+  aSerialStream << aSerialScene;
+
+  VrmlData_Scene aParallelScene;
+  fillScene(aParallelScene);
+  aParallelScene.SetParallelWrite(true);
+  EXPECT_TRUE(aParallelScene.ToParallelWrite());
+  std::ostringstream aParallelStream;
+  aParallelStream << aParallelScene;
+
+  const std::string aSerial   = aSerialStream.str();
+  const std::string aParallel = aParallelStream.str();
+  EXPECT_GT(aSerial.size(), size_t(1000000));
+  EXPECT_NE(std::string::npos, aSerial.find("USE "));
+  EXPECT_TRUE(aSerial == aParallel);
+
+  // the scene can be written again with the same result
+  std::ostringstream aParallelStream2;
+  aParallelStream2 << aParallelScene;
+  EXPECT_TRUE(aParallelStream2.str() == aParallel);
+}
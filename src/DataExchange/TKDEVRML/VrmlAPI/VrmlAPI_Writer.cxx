@@ -47,6 +47,7 @@ VrmlAPI_Writer::VrmlAPI_Writer()
 {
   myDrawer     = new VrmlConverter_Drawer;
   myDeflection = -1;
+  myToParallel = false;
   occ::handle<NCollection_HArray1<Quantity_Color>> Col1 =
     new NCollection_HArray1<Quantity_Color>(1, 1, Quantity_NOC_BLACK);
   occ::handle<NCollection_HArray1<double>> kik1 = new NCollection_HArray1<double>(1, 1, 0.0);
@@ -304,6 +305,7 @@ bool VrmlAPI_Writer::WriteDoc(const occ::handle<TDocStd_Document>& theDoc,
 {
   VrmlData_Scene        aScene;
   VrmlData_ShapeConvert aConv(aScene, theScale);
+  aScene.SetParallelWrite(myToParallel);
   aConv.ConvertDocument(theDoc);
 
   theOStream << aScene;
@@ -451,6 +453,7 @@ bool VrmlAPI_Writer::write_v2(const TopoDS_Shape& aShape, Standard_OStream& theO
 
   VrmlData_Scene        aScene;
   VrmlData_ShapeConvert aConv(aScene);
+  aScene.SetParallelWrite(myToParallel);
   aConv.AddShape(aShape);
   aConv.Convert(anExtFace, anExtEdge);
 
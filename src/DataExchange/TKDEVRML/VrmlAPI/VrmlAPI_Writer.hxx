@@ -58,6 +58,15 @@ public:
   //! size of the shaped.
   Standard_EXPORT void SetDeflection(const double aDef);
 
+  //! Returns TRUE if coordinates and indices of VRML 2.0 output
+  //! are formatted in parallel threads; FALSE by default.
+  bool ToParallel() const { return myToParallel; }
+
+  //! Sets if coordinates and indices of VRML 2.0 output should be formatted
+  //! in parallel threads. The output is identical to the sequential one,
+  //! but the formatted text of all arrays is kept in memory until it is written.
+  void SetParallel(const bool theToParallel) { myToParallel = theToParallel; }
+
   //! Sets the representation of the
   //! shape aRep which is written to the VRML file. The three options are :
   //! -      shaded
@@ -166,6 +175,7 @@ private:
   double                               YUp;
   double                               ZUp;
   double                               Focus;
+  bool                                 myToParallel;
 };
 
 #endif // _VrmlAPI_Writer_HeaderFile
@@ -632,13 +632,7 @@ VrmlData_ErrorStatus VrmlData_ArrayVec3d::WriteArray(const char* theName, const
   {
     aStatus = Scene().WriteLine(theName, "[", 2 * GlobalIndent());
     if (OK(aStatus))
-    {
-      for (size_t i = 0; i < myLength - 1; i++)
-        if (!OK(aStatus, Scene().WriteXYZ(myArray[i], isScale, ",")))
-          break;
-      if (OK(aStatus))
-        aStatus = Scene().WriteXYZ(myArray[myLength - 1], isScale);
-    }
+      aStatus = Scene().WriteArrXYZ(myArray, myLength, isScale);
     if (aStatus == VrmlData_StatusOK)
       aStatus = Scene().WriteLine("]", nullptr, -2 * GlobalIndent());
   }
@@ -33,6 +33,7 @@
 #include <VrmlData_UnknownNode.hxx>
 // #include <VrmlData_WorldInfo.hxx>
 #include <NCollection_Vector.hxx>
+#include <OSD_Parallel.hxx>
 #include <TopoDS.hxx>
 #include <TopExp_Explorer.hxx>
 #include <BRep_Builder.hxx>
@@ -48,6 +49,16 @@
 
 #define VRMLDATA_LCOMPARE_SKIP(aa, bb) (strncmp(aa, bb, sizeof(bb) - 1) == 0)
 
+namespace
+{
+//! Spaces for the indentation of output lines.
+static const char THE_SPACES[] = "                                        "
+                                 "                                        ";
+
+//! Number of array items formatted by a single thread on parallel export.
+static const size_t THE_ARRAY_CHUNK_SIZE = 16384;
+} // namespace
+
 static void dumpNode(Standard_OStream&                 theStream,
                      const occ::handle<VrmlData_Node>& theNode,
                      const TCollection_AsciiString&    theIndent);
@@ -67,6 +78,7 @@ VrmlData_Scene::VrmlData_Scene(const occ::handle<NCollection_IncAllocator>& theA
       myOutput(nullptr),
       myIndent(2),
       myCurrentIndent(0),
+      myToParallelWrite(false),
       myAutoNameCounter(0)
 {
   myWorldInfo        = new VrmlData_WorldInfo(*this);
@@ -116,6 +128,8 @@ Standard_OStream& operator<<(Standard_OStream& theOutput, const VrmlData_Scene&
   aScene.myNamedNodesOut.Clear();
   aScene.myUnnamedNodesOut.Clear();
   aScene.myAutoNameCounter = 0;
+  aScene.myArrayChunks.Clear();
+  aScene.myArrayChunkMap.Clear();
 
   // Dummy write
 
@@ -131,6 +145,14 @@ Standard_OStream& operator<<(Standard_OStream& theOutput, const VrmlData_Scene&
     }
   }
 
+  // Format the arrays registered by the dummy write
+  if (!aScene.myArrayChunks.IsEmpty())
+  {
+    OSD_Parallel::For(0, aScene.myArrayChunks.Length(), [&aScene](const int theIndex) {
+      aScene.formatArrayChunk(aScene.myArrayChunks.ChangeValue(theIndex));
+    });
+  }
+
   aScene.myOutput = &theOutput;
   aScene.myNamedNodesOut.Clear();
   theOutput << "#VRML V2.0 utf8\n\n";
@@ -151,6 +173,8 @@ Standard_OStream& operator<<(Standard_OStream& theOutput, const VrmlData_Scene&
   aScene.myOutput = nullptr;
   aScene.myNamedNodesOut.Clear();
   aScene.myUnnamedNodesOut.Clear();
+  aScene.myArrayChunks.Clear();
+  aScene.myArrayChunkMap.Clear();
   return theOutput;
 }
 
@@ -910,49 +934,56 @@ VrmlData_ErrorStatus VrmlData_Scene::WriteArrIndex(const char*  thePrefix,
                                                    const size_t theNbBlocks) const
 {
   VrmlData_ErrorStatus aStatus(VrmlData_StatusOK);
-  if (theNbBlocks && (IsDummyWrite() == false))
+  if (theNbBlocks && IsDummyWrite())
+    addArrayChunks(theArrIndex, theNbBlocks, true, false);
+  else if (theNbBlocks)
   {
     if (VrmlData_Node::OK(aStatus, WriteLine(thePrefix, "[", 1)))
     {
-      const size_t aLineLimit = (myCurrentIndent < 41) ? 36 : 100;
-      char         buf[256];
-      for (size_t iBlock = 0; iBlock < theNbBlocks; iBlock++)
+      if (writeArrayChunks(theArrIndex, theNbBlocks, true, false))
+        aStatus = myStatus;
+      else
       {
-        const int  nVal(*theArrIndex[iBlock]);
-        const int* arrVal = theArrIndex[iBlock] + 1;
-        switch (nVal)
+        const size_t aLineLimit = (myCurrentIndent < 41) ? 36 : 100;
+        char         buf[256];
+        for (size_t iBlock = 0; iBlock < theNbBlocks; iBlock++)
         {
-          case 1:
-            Sprintf(buf, "%d,", arrVal[0]);
-            break;
-          case 2:
-            Sprintf(buf, "%d,%d,", arrVal[0], arrVal[1]);
-            break;
-          case 3:
-            Sprintf(buf, "%d,%d,%d,", arrVal[0], arrVal[1], arrVal[2]);
-            break;
-          case 4:
-            Sprintf(buf, "%d,%d,%d,%d,", arrVal[0], arrVal[1], arrVal[2], arrVal[3]);
-            break;
-          default:
-            if (nVal > 0)
-            {
-              char* ptr = &buf[0];
-              for (int i = 0; i < nVal; i++)
+          const int  nVal(*theArrIndex[iBlock]);
+          const int* arrVal = theArrIndex[iBlock] + 1;
+          switch (nVal)
+          {
+            case 1:
+              Sprintf(buf, "%d,", arrVal[0]);
+              break;
+            case 2:
+              Sprintf(buf, "%d,%d,", arrVal[0], arrVal[1]);
+              break;
+            case 3:
+              Sprintf(buf, "%d,%d,%d,", arrVal[0], arrVal[1], arrVal[2]);
+              break;
+            case 4:
+              Sprintf(buf, "%d,%d,%d,%d,", arrVal[0], arrVal[1], arrVal[2], arrVal[3]);
+              break;
+            default:
+              if (nVal > 0)
               {
-                Sprintf(ptr, "%d,", arrVal[i]);
-                if (i == nVal - 1)
-                  break;
-                ptr = strchr(ptr, ',') + 1;
-                if ((ptr - &buf[0]) > (ptrdiff_t)aLineLimit)
+                char* ptr = &buf[0];
+                for (int i = 0; i < nVal; i++)
                 {
-                  WriteLine(buf);
-                  ptr = &buf[0];
+                  Sprintf(ptr, "%d,", arrVal[i]);
+                  if (i == nVal - 1)
+                    break;
+                  ptr = strchr(ptr, ',') + 1;
+                  if ((ptr - &buf[0]) > (ptrdiff_t)aLineLimit)
+                  {
+                    WriteLine(buf);
+                    ptr = &buf[0];
+                  }
                 }
               }
-            }
+          }
+          WriteLine(buf, iBlock < theNbBlocks - 1 ? "-1," : "-1");
         }
-        WriteLine(buf, iBlock < theNbBlocks - 1 ? "-1," : "-1");
       }
       if (aStatus == VrmlData_StatusOK)
         aStatus = WriteLine("]", nullptr, -1);
@@ -988,6 +1019,162 @@ VrmlData_ErrorStatus VrmlData_Scene::WriteXYZ(const gp_XYZ& theXYZ,
   return WriteLine(buf);
 }
 
+//=================================================================================================
+
+VrmlData_ErrorStatus VrmlData_Scene::WriteArrXYZ(const gp_XYZ* theArr,
+                                                 const size_t  theLength,
+                                                 const bool    isScale) const
+{
+  VrmlData_ErrorStatus aStatus(VrmlData_StatusOK);
+  if (IsDummyWrite())
+    addArrayChunks(theArr, theLength, false, isScale);
+  else if (writeArrayChunks(theArr, theLength, false, isScale))
+    aStatus = myStatus;
+  else if (theLength > 0)
+  {
+    for (size_t i = 0; i < theLength - 1; i++)
+      if (!VrmlData_Node::OK(aStatus, WriteXYZ(theArr[i], isScale, ",")))
+        break;
+    if (VrmlData_Node::OK(aStatus))
+      aStatus = WriteXYZ(theArr[theLength - 1], isScale);
+  }
+  return aStatus;
+}
+
+//=================================================================================================
+
+void VrmlData_Scene::addArrayChunks(const void*  theArray,
+                                    const size_t theLength,
+                                    const bool   isIndex,
+                                    const bool   isScale) const
+{
+  if (!myToParallelWrite || theLength == 0 || myArrayChunkMap.IsBound(theArray))
+    return;
+  if (isIndex)
+  {
+    // only blocks written on a single line are formatted in advance,
+    // longer ones are wrapped depending on the current indentation
+    const int* const* anArrIndex = static_cast<const int* const*>(theArray);
+    for (size_t iBlock = 0; iBlock < theLength; iBlock++)
+    {
+      const int nVal = *anArrIndex[iBlock];
+      if (nVal < 1 || nVal > 4)
+        return;
+    }
+  }
+
+  VrmlData_Scene& aScene = const_cast<VrmlData_Scene&>(*this);
+  aScene.myArrayChunkMap.Bind(theArray, myArrayChunks.Length());
+  for (size_t aFirst = 0; aFirst < theLength; aFirst += THE_ARRAY_CHUNK_SIZE)
+  {
+    ArrayChunk& aChunk = aScene.myArrayChunks.Appended();
+    aChunk.Array       = theArray;
+    aChunk.Length      = theLength;
+    aChunk.First       = aFirst;
+    aChunk.Last        = std::min(aFirst + THE_ARRAY_CHUNK_SIZE, theLength);
+    aChunk.IsIndex     = isIndex;
+    aChunk.IsScale     = isScale;
+  }
+}
+
+//=================================================================================================
+
+void VrmlData_Scene::formatArrayChunk(ArrayChunk& theChunk) const
+{
+  char buf[240];
+  if (theChunk.IsIndex)
+  {
+    const int* const* anArrIndex = static_cast<const int* const*>(theChunk.Array);
+    for (size_t iBlock = theChunk.First; iBlock < theChunk.Last; iBlock++)
+    {
+      const int  nVal(*anArrIndex[iBlock]);
+      const int* arrVal = anArrIndex[iBlock] + 1;
+      switch (nVal)
+      {
+        case 1:
+          Sprintf(buf, "%d,", arrVal[0]);
+          break;
+        case 2:
+          Sprintf(buf, "%d,%d,", arrVal[0], arrVal[1]);
+          break;
+        case 3:
+          Sprintf(buf, "%d,%d,%d,", arrVal[0], arrVal[1], arrVal[2]);
+          break;
+        default:
+          Sprintf(buf, "%d,%d,%d,%d,", arrVal[0], arrVal[1], arrVal[2], arrVal[3]);
+          break;
+      }
+      theChunk.Text += buf;
+      theChunk.Text += iBlock < theChunk.Length - 1 ? " -1,\n" : " -1\n";
+    }
+    return;
+  }
+
+  const gp_XYZ* anArrXYZ = static_cast<const gp_XYZ*>(theChunk.Array);
+  const double  aScale =
+    theChunk.IsScale && myLinearScale > Precision::Confusion() ? myLinearScale : 0.0;
+  for (size_t i = theChunk.First; i < theChunk.Last; i++)
+  {
+    const char* aPostfix = i < theChunk.Length - 1 ? ",\n" : "\n";
+    if (aScale > 0.0)
+      Sprintf(buf,
+              "%.12g %.12g %.12g%s",
+              anArrXYZ[i].X() / aScale,
+              anArrXYZ[i].Y() / aScale,
+              anArrXYZ[i].Z() / aScale,
+              aPostfix);
+    else
+      Sprintf(buf,
+              "%.12g %.12g %.12g%s",
+              anArrXYZ[i].X(),
+              anArrXYZ[i].Y(),
+              anArrXYZ[i].Z(),
+              aPostfix);
+    theChunk.Text += buf;
+  }
+}
+
+//=================================================================================================
+
+bool VrmlData_Scene::writeArrayChunks(const void*  theArray,
+                                      const size_t theLength,
+                                      const bool   isIndex,
+                                      const bool   isScale) const
+{
+  const int* aFirstChunk = myArrayChunkMap.Seek(theArray);
+  if (aFirstChunk == nullptr)
+    return false;
+  const ArrayChunk& aFirst = myArrayChunks.Value(*aFirstChunk);
+  if (aFirst.Length != theLength || aFirst.IsIndex != isIndex || aFirst.IsScale != isScale)
+    return false;
+
+  const int   nSpaces = std::min(myCurrentIndent, static_cast<int>(sizeof(THE_SPACES) - 1));
+  const char* anIndent = &THE_SPACES[sizeof(THE_SPACES) - 1 - nSpaces];
+  for (int iChunk = *aFirstChunk; iChunk < myArrayChunks.Length(); iChunk++)
+  {
+    const ArrayChunk& aChunk = myArrayChunks.Value(iChunk);
+    if (aChunk.Array != theArray)
+      break;
+    for (size_t aLineStart = 0; aLineStart < aChunk.Text.size();)
+    {
+      const size_t aLineEnd = aChunk.Text.find('\n', aLineStart) + 1;
+      myOutput->write(anIndent, nSpaces);
+      myOutput->write(aChunk.Text.data() + aLineStart, aLineEnd - aLineStart);
+      aLineStart = aLineEnd;
+    }
+  }
+
+  VrmlData_ErrorStatus& aStatus = const_cast<VrmlData_ErrorStatus&>(myStatus);
+  const int             stat    = myOutput->rdstate();
+  if (stat & std::ios::badbit)
+    aStatus = VrmlData_UnrecoverableError;
+  else if (stat & std::ios::failbit)
+    aStatus = VrmlData_GeneralError;
+  else
+    aStatus = VrmlData_StatusOK;
+  return true;
+}
+
 //=======================================================================
 // function : WriteLine
 // purpose  : write the given string prepending the current indentation
@@ -997,9 +1184,7 @@ VrmlData_ErrorStatus VrmlData_Scene::WriteLine(const char* theLin0,
                                                const char* theLin1,
                                                const int   theIndent) const
 {
-  static const char     spaces[] = "                                        "
-                                   "                                        ";
-  VrmlData_ErrorStatus& aStatus  = const_cast<VrmlData_ErrorStatus&>(myStatus);
+  VrmlData_ErrorStatus& aStatus = const_cast<VrmlData_ErrorStatus&>(myStatus);
   if (IsDummyWrite())
     aStatus = VrmlData_StatusOK;
   else
@@ -1013,8 +1198,8 @@ VrmlData_ErrorStatus VrmlData_Scene::WriteLine(const char* theLin0,
       (*myOutput) << "\n";
     else
     {
-      const int nSpaces = std::min(aCurrentIndent, static_cast<int>(sizeof(spaces) - 1));
-      (*myOutput) << &spaces[sizeof(spaces) - 1 - nSpaces];
+      const int nSpaces = std::min(aCurrentIndent, static_cast<int>(sizeof(THE_SPACES) - 1));
+      (*myOutput) << &THE_SPACES[sizeof(THE_SPACES) - 1 - nSpaces];
       if (theLin0)
       {
         (*myOutput) << theLin0;
@@ -27,10 +27,12 @@
 #include <TCollection_ExtendedString.hxx>
 #include <NCollection_IncAllocator.hxx>
 #include <NCollection_DataMap.hxx>
+#include <NCollection_Vector.hxx>
 #include <VrmlData_Appearance.hxx>
 #include <TopoDS_TShape.hxx>
 
 #include <mutex>
+#include <string>
 
 // resolve name collisions with X11 headers
 #ifdef Status
@@ -252,6 +254,20 @@ public:
    */
   inline void SetIndent(const int nSpc) { myIndent = nSpc; }
 
+  /**
+   * Query if the arrays of coordinates and indices are formatted in parallel
+   * threads on export. FALSE by default.
+   */
+  inline bool ToParallelWrite() const { return myToParallelWrite; }
+
+  /**
+   * Set if the arrays of coordinates and indices should be formatted in parallel
+   * threads on export. The arrays met during the dummy write are split into chunks
+   * formatted into memory buffers, which are then output in the order of the scene,
+   * so that the result is identical to the sequential export.
+   */
+  inline void SetParallelWrite(const bool theToParallel) { myToParallelWrite = theToParallel; }
+
   /**
    * Write a triplet of real values on a separate line.
    * @param theXYZ
@@ -264,6 +280,14 @@ public:
   Standard_EXPORT VrmlData_ErrorStatus WriteXYZ(const gp_XYZ& theXYZ,
                                                 const bool    isScale,
                                                 const char*   thePostfix = nullptr) const;
+  /**
+   * Write an array of triplets of real values, one per line, all but the last
+   * one followed by comma. Each triplet is written as by WriteXYZ().
+   */
+  Standard_EXPORT VrmlData_ErrorStatus WriteArrXYZ(const gp_XYZ* theArr,
+                                                   const size_t  theLength,
+                                                   const bool    isScale) const;
+
   /**
    * Write an array of integer indices, for IndexedFaceSet and IndexedLineSet.
    */
@@ -342,6 +366,44 @@ protected:
     const NCollection_List<occ::handle<VrmlData_Node>>&,
     NCollection_DataMap<occ::handle<TopoDS_TShape>, occ::handle<VrmlData_Appearance>>*);
 
+private:
+  /**
+   * Chunk of an array formatted in advance for parallel export.
+   */
+  struct ArrayChunk
+  {
+    const void* Array;   ///! array of gp_XYZ or of index blocks
+    size_t      Length;  ///! length of the whole array
+    size_t      First;   ///! first item of the chunk
+    size_t      Last;    ///! item following the last one of the chunk
+    bool        IsIndex; ///! array of index blocks
+    bool        IsScale; ///! linear scale is applied to the triplets
+    std::string Text;    ///! formatted lines without indentation
+  };
+
+  /**
+   * Register an array met during the dummy write to be formatted in advance.
+   */
+  void addArrayChunks(const void*  theArray,
+                      const size_t theLength,
+                      const bool   isIndex,
+                      const bool   isScale) const;
+
+  /**
+   * Format the lines of the chunk into its text buffer.
+   */
+  void formatArrayChunk(ArrayChunk& theChunk) const;
+
+  /**
+   * Output the chunks formatted in advance for the array with the current indentation.
+   * @return
+   *   False if the array has not been formatted in advance.
+   */
+  bool writeArrayChunks(const void*  theArray,
+                        const size_t theLength,
+                        const bool   isIndex,
+                        const bool   isScale) const;
+
 private:
   // ---------- PRIVATE FIELDS ----------
   double                                       myLinearScale;
@@ -361,6 +423,13 @@ private:
   Standard_OStream* myOutput;
   int               myIndent;
   int               myCurrentIndent;
+  bool              myToParallelWrite;
+  /**
+   * Chunks of the arrays formatted in advance for parallel export, and
+   * the map of the arrays to the index of their first chunk.
+   */
+  NCollection_Vector<ArrayChunk>        myArrayChunks;
+  NCollection_DataMap<const void*, int> myArrayChunkMap;
   /**
    * This map is used to avoid multiple storage of the same named node: each
    * named node is added here when it is written the first time.
@@ -2,4 +2,5 @@
 set(OCCT_TKRWMesh_GTests_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
 
 set(OCCT_TKRWMesh_GTests_FILES
+  RWMesh_FaceIterator_Test.cxx
 )
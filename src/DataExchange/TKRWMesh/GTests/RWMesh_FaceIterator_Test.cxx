@@ -0,0 +1,102 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRep_Builder.hxx>
+#include <Geom_CylindricalSurface.hxx>
+#include <RWMesh_FaceIterator.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Compound.hxx>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+//! Creates a cylindrical face with a grid triangulation of (theNbCells + 1)^2 nodes.
+//! @param[in] theToNormals  store normals within triangulation
+TopoDS_Face makeGridFace(const int theNbCells, const bool theToNormals)
+{
+  const occ::handle<Geom_CylindricalSurface> aSurf =
+    new Geom_CylindricalSurface(gp_Ax3(gp::XOY()), 2.0);
+  const int                       aNbNodes = (theNbCells + 1) * (theNbCells + 1);
+  occ::handle<Poly_Triangulation> aTris =
+    new Poly_Triangulation(aNbNodes, theNbCells * theNbCells * 2, true, theToNormals);
+  for (int aRow = 0; aRow <= theNbCells; ++aRow)
+  {
+    for (int aCol = 0; aCol <= theNbCells; ++aCol)
+    {
+      const int      aNode = aRow * (theNbCells + 1) + aCol + 1;
+      const gp_Pnt2d anUV(M_PI * aCol / theNbCells, 3.0 * aRow / theNbCells);
+      aTris->SetNode(aNode, aSurf->Value(anUV.X(), anUV.Y()));
+      aTris->SetUVNode(aNode, anUV);
+      if (theToNormals)
+      {
+        aTris->SetNormal(aNode, gp_Dir(1.0, 0.0, 0.0));
+      }
+    }
+  }
+  for (int aRow = 0, aTriIter = 1; aRow < theNbCells; ++aRow)
+  {
+    for (int aCol = 0; aCol < theNbCells; ++aCol, aTriIter += 2)
+    {
+      const int aNode1 = aRow * (theNbCells + 1) + aCol + 1;
+      const int aNode2 = aNode1 + theNbCells + 1;
+      aTris->SetTriangle(aTriIter, Poly_Triangle(aNode1, aNode1 + 1, aNode2 + 1));
+      aTris->SetTriangle(aTriIter + 1, Poly_Triangle(aNode1, aNode2 + 1, aNode2));
+    }
+  }
+
+  BRep_Builder aBuilder;
+  TopoDS_Face  aFace;
+  aBuilder.MakeFace(aFace, aSurf, Precision::Confusion());
+  aBuilder.UpdateFace(aFace, aTris);
+  return aFace;
+}
+} // namespace
+
+TEST(RWMesh_FaceIterator_Test, PreparedDataIsIdentical)
+{
+  gp_Trsf aTrsf;
+  aTrsf.SetRotation(gp::OX(), 0.5);
+  aTrsf.SetTranslationPart(gp_Vec(1.0, 2.0, 3.0));
+
+  BRep_Builder    aBuilder;
+  TopoDS_Compound aComp;
+  aBuilder.MakeCompound(aComp);
+  aBuilder.Add(aComp, makeGridFace(150, false));
+  aBuilder.Add(aComp, makeGridFace(3, true).Moved(TopLoc_Location(aTrsf)));
+  aBuilder.Add(aComp, makeGridFace(100, false).Reversed().Moved(TopLoc_Location(aTrsf)));
+
+  RWMesh_FaceIterator aRefIter(aComp, XCAFPrs_Style());
+  RWMesh_FaceIterator aPrepIter(aComp, XCAFPrs_Style());
+  EXPECT_FALSE(aPrepIter.IsPrepared());
+  aPrepIter.PrepareData(true);
+  int aNbFaces = 0;
+  for (; aRefIter.More(); aRefIter.Next(), aPrepIter.Next(), ++aNbFaces)
+  {
+    ASSERT_TRUE(aPrepIter.More());
+    ASSERT_TRUE(aPrepIter.IsPrepared());
+    EXPECT_TRUE(aRefIter.Face().IsEqual(aPrepIter.Face()));
+    EXPECT_EQ(aRefIter.HasNormals(), aPrepIter.HasNormals());
+    ASSERT_EQ(aRefIter.NbNodes(), aPrepIter.NbNodes());
+    for (int aNodeIter = aRefIter.NodeLower(); aNodeIter <= aRefIter.NodeUpper(); ++aNodeIter)
+    {
+      EXPECT_TRUE(aRefIter.NodeTransformed(aNodeIter)
+                    .IsEqual(aPrepIter.NodeTransformed(aNodeIter), Precision::Confusion()));
+      EXPECT_TRUE(aRefIter.NormalTransformed(aNodeIter)
+                    .IsEqual(aPrepIter.NormalTransformed(aNodeIter), Precision::Angular()));
+    }
+  }
+  EXPECT_EQ(3, aNbFaces);
+  EXPECT_FALSE(aPrepIter.More());
+  EXPECT_FALSE(aPrepIter.IsPrepared());
+}
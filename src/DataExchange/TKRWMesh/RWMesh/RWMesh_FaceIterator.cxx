@@ -15,11 +15,73 @@
 
 #include <BRepAdaptor_Surface.hxx>
 #include <BRep_Tool.hxx>
+#include <OSD_Parallel.hxx>
 #include <TopExp.hxx>
 #include <TopoDS.hxx>
 #include <XCAFDoc_ShapeTool.hxx>
 #include <XCAFPrs.hxx>
 
+namespace
+{
+//! Number of nodes prepared by a single task within RWMesh_FaceIterator::PrepareData().
+static const int THE_NB_PREPARE_NODES = 8192;
+
+//! Range of face nodes prepared by a single task.
+struct PrepareNodeRange
+{
+  int Face;  //!< index of the face within prepared faces
+  int Lower; //!< first node of the range
+  int Upper; //!< last node of the range
+};
+
+//! Initialize the tool for fetching normals from the surface of the face.
+//! @return FALSE if the face has no surface
+static bool initSurfaceNormals(const TopoDS_Face&   theFace,
+                               BRepAdaptor_Surface& theAdaptor,
+                               BRepLProp_SLProps&   theSLTool)
+{
+  TopoDS_Face aFaceFwd = TopoDS::Face(theFace.Oriented(TopAbs_FORWARD));
+  aFaceFwd.Location(TopLoc_Location());
+  TopLoc_Location aLoc;
+  if (BRep_Tool::Surface(aFaceFwd, aLoc).IsNull())
+  {
+    return false;
+  }
+
+  theAdaptor.Initialize(aFaceFwd, false);
+  theSLTool.SetSurface(theAdaptor);
+  return true;
+}
+
+//! Return the normal of triangulation node or the normal of the surface at node UV
+//! (when theSLTool is not NULL) without transformation applied.
+static gp_Dir faceNormal(const Poly_Triangulation& theTriangulation,
+                         BRepLProp_SLProps*        theSLTool,
+                         const int                 theNode)
+{
+  gp_Dir aNormal(gp::DZ());
+  if (theTriangulation.HasNormals())
+  {
+    NCollection_Vec3<float> aNormVec3;
+    theTriangulation.Normal(theNode, aNormVec3);
+    if (aNormVec3.Modulus() != 0.0f)
+    {
+      aNormal.SetCoord(aNormVec3.x(), aNormVec3.y(), aNormVec3.z());
+    }
+  }
+  else if (theSLTool != nullptr && theTriangulation.HasUVNodes())
+  {
+    const gp_XY anUV = theTriangulation.UVNode(theNode).XY();
+    theSLTool->SetParameters(anUV.X(), anUV.Y());
+    if (theSLTool->IsNormalDefined())
+    {
+      aNormal = theSLTool->Normal();
+    }
+  }
+  return aNormal;
+}
+} // namespace
+
 //=================================================================================================
 
 RWMesh_FaceIterator::RWMesh_FaceIterator(const TDF_Label&       theLabel,
@@ -34,7 +96,8 @@ RWMesh_FaceIterator::RWMesh_FaceIterator(const TDF_Label&       theLabel,
                            theStyle),
       mySLTool(1, 1e-12),
       myHasNormals(false),
-      myIsMirrored(false)
+      myIsMirrored(false),
+      myPreparedIndex(-1)
 {
   Next();
 }
@@ -46,7 +109,8 @@ RWMesh_FaceIterator::RWMesh_FaceIterator(const TopoDS_Shape&  theShape,
     : RWMesh_ShapeIterator(theShape, TopAbs_FACE, TopAbs_SHAPE, theStyle),
       mySLTool(1, 1e-12),
       myHasNormals(false),
-      myIsMirrored(false)
+      myIsMirrored(false),
+      myPreparedIndex(-1)
 {
   Next();
 }
@@ -55,32 +119,19 @@ RWMesh_FaceIterator::RWMesh_FaceIterator(const TopoDS_Shape&  theShape,
 
 gp_Dir RWMesh_FaceIterator::normal(int theNode) const
 {
-  gp_Dir aNormal(gp::DZ());
-  if (myPolyTriang->HasNormals())
-  {
-    NCollection_Vec3<float> aNormVec3;
-    myPolyTriang->Normal(theNode, aNormVec3);
-    if (aNormVec3.Modulus() != 0.0f)
-    {
-      aNormal.SetCoord(aNormVec3.x(), aNormVec3.y(), aNormVec3.z());
-    }
-  }
-  else if (myHasNormals && myPolyTriang->HasUVNodes())
-  {
-    const gp_XY anUV = myPolyTriang->UVNode(theNode).XY();
-    mySLTool.SetParameters(anUV.X(), anUV.Y());
-    if (mySLTool.IsNormalDefined())
-    {
-      aNormal = mySLTool.Normal();
-    }
-  }
-  return aNormal;
+  return faceNormal(*myPolyTriang, myHasNormals ? &mySLTool : nullptr, theNode);
 }
 
 //=================================================================================================
 
 void RWMesh_FaceIterator::Next()
 {
+  if (myPreparedIndex >= 0)
+  {
+    loadPreparedFace(myPreparedIndex + 1);
+    return;
+  }
+
   for (; myIter.More(); myIter.Next())
   {
     myFace       = TopoDS::Face(myIter.Current());
@@ -112,16 +163,114 @@ void RWMesh_FaceIterator::initFace()
   }
   if (myPolyTriang->HasUVNodes() && !myHasNormals)
   {
-    TopoDS_Face aFaceFwd = TopoDS::Face(myFace.Oriented(TopAbs_FORWARD));
-    aFaceFwd.Location(TopLoc_Location());
-    TopLoc_Location aLoc;
-    if (!BRep_Tool::Surface(aFaceFwd, aLoc).IsNull())
+    myHasNormals = initSurfaceNormals(myFace, myFaceAdaptor, mySLTool);
+  }
+
+  initShape();
+}
+
+//=================================================================================================
+
+void RWMesh_FaceIterator::PrepareData(const bool theToParallel)
+{
+  if (myPreparedIndex >= 0)
+  {
+    return;
+  }
+
+  // collect the current and remaining faces and split their nodes into ranges
+  NCollection_Vector<PrepareNodeRange> aRanges;
+  int                                  aNbNodes      = 0;
+  bool                                 hasAnyNormals = false;
+  for (; More(); Next())
+  {
+    PreparedFace& aFace = myPreparedFaces.Appended();
+    aFace.Face          = myFace;
+    aFace.Triangulation = myPolyTriang;
+    aFace.Location      = myLocation;
+    aFace.NodeOffset    = aNbNodes;
+    aFace.HasNormals    = myHasNormals;
+    hasAnyNormals       = hasAnyNormals || myHasNormals;
+
+    const int aNbFaceNodes = myPolyTriang->NbNodes();
+    for (int aLower = 1; aLower <= aNbFaceNodes; aLower += THE_NB_PREPARE_NODES)
     {
-      myFaceAdaptor.Initialize(aFaceFwd, false);
-      mySLTool.SetSurface(myFaceAdaptor);
-      myHasNormals = true;
+      PrepareNodeRange& aRange = aRanges.Appended();
+      aRange.Face              = myPreparedFaces.Upper();
+      aRange.Lower             = aLower;
+      aRange.Upper             = std::min(aLower + THE_NB_PREPARE_NODES - 1, aNbFaceNodes);
     }
+    aNbNodes += aNbFaceNodes;
   }
 
-  initShape();
+  if (aNbNodes > 0)
+  {
+    myPreparedNodes.Resize(0, aNbNodes - 1, false);
+    if (hasAnyNormals)
+    {
+      myPreparedNormals.Resize(0, aNbNodes - 1, false);
+    }
+  }
+
+  OSD_Parallel::For(
+    0,
+    aRanges.Length(),
+    [&](const int theRangeIndex) {
+      const PrepareNodeRange& aRange = aRanges.Value(theRangeIndex);
+      const PreparedFace&     aFace  = myPreparedFaces.Value(aRange.Face);
+      const gp_Trsf           aTrsf  = aFace.Location.Transformation();
+      for (int aNodeIter = aRange.Lower; aNodeIter <= aRange.Upper; ++aNodeIter)
+      {
+        gp_Pnt aNode = aFace.Triangulation->Node(aNodeIter);
+        aNode.Transform(aTrsf);
+        myPreparedNodes.ChangeValue(aFace.NodeOffset + aNodeIter - 1) = aNode;
+      }
+      if (myPreparedNormals.IsEmpty())
+      {
+        return;
+      }
+
+      // each task uses its own surface tool, as evaluation modifies its state
+      BRepAdaptor_Surface anAdaptor;
+      BRepLProp_SLProps   aSLTool(1, 1e-12);
+      const bool          hasSurface = aFace.HasNormals && !aFace.Triangulation->HasNormals()
+                              && initSurfaceNormals(aFace.Face, anAdaptor, aSLTool);
+      const bool          isReversed = aFace.Face.Orientation() == TopAbs_REVERSED;
+      for (int aNodeIter = aRange.Lower; aNodeIter <= aRange.Upper; ++aNodeIter)
+      {
+        gp_Dir aNorm = faceNormal(*aFace.Triangulation, hasSurface ? &aSLTool : nullptr, aNodeIter);
+        if (aTrsf.Form() != gp_Identity)
+        {
+          aNorm.Transform(aTrsf);
+        }
+        if (isReversed)
+        {
+          aNorm.Reverse();
+        }
+        myPreparedNormals.ChangeValue(aFace.NodeOffset + aNodeIter - 1) = aNorm;
+      }
+    },
+    !theToParallel);
+
+  loadPreparedFace(0);
+}
+
+//=================================================================================================
+
+void RWMesh_FaceIterator::loadPreparedFace(const int theIndex)
+{
+  myPreparedIndex = theIndex;
+  if (theIndex > myPreparedFaces.Upper())
+  {
+    resetFace();
+    return;
+  }
+
+  const PreparedFace& aFace = myPreparedFaces.Value(theIndex);
+  myFace                    = aFace.Face;
+  myPolyTriang              = aFace.Triangulation;
+  myLocation                = aFace.Location;
+  myTrsf                    = myLocation.Transformation();
+  initFace();
+  myPreparedOffset = aFace.NodeOffset;
 }
@@ -17,6 +17,7 @@
 #include <RWMesh_ShapeIterator.hxx>
 
 #include <BRepLProp_SLProps.hxx>
+#include <NCollection_Vector.hxx>
 #include <Poly_Triangulation.hxx>
 #include <TopoDS_Face.hxx>
 
@@ -73,6 +74,17 @@ public:
            || (myPolyTriang->NbNodes() < 1 && myPolyTriang->NbTriangles() < 1);
   }
 
+  //! Explore the current and all remaining faces and compute their transformed nodes
+  //! and normals in advance into contiguous buffers, in parallel threads if requested.
+  //! The iterator is then rewound to the current face; NodeTransformed() and NormalTransformed()
+  //! return prepared values and, unlike normals computed from the surface,
+  //! can be called from concurrent threads.
+  //! @param[in] theToParallel flag to compute data in parallel threads
+  Standard_EXPORT void PrepareData(const bool theToParallel);
+
+  //! Return true if data of the current face has been prepared by PrepareData().
+  bool IsPrepared() const { return myPreparedOffset >= 0; }
+
 public:
   //! Return face material.
   const XCAFPrs_Style& FaceStyle() const { return myStyle; }
@@ -115,6 +127,11 @@ public:
   //! applied.
   gp_Dir NormalTransformed(int theNode) const
   {
+    if (myPreparedOffset >= 0 && !myPreparedNormals.IsEmpty())
+    {
+      return myPreparedNormals.Value(myPreparedOffset + theNode - 1);
+    }
+
     gp_Dir aNorm = normal(theNode);
     if (myTrsf.Form() != gp_Identity)
     {
@@ -165,6 +182,20 @@ private:
   //! Initialize face properties.
   void initFace();
 
+  //! Make the face with specified index within prepared faces current.
+  void loadPreparedFace(const int theIndex);
+
+private:
+  //! Face explored by PrepareData().
+  struct PreparedFace
+  {
+    TopoDS_Face                     Face;          //!< face
+    occ::handle<Poly_Triangulation> Triangulation; //!< triangulation of the face
+    TopLoc_Location                 Location;      //!< location of the triangulation
+    int                             NodeOffset;    //!< offset of face nodes in prepared buffers
+    bool                            HasNormals;    //!< flag indicating that face has normals
+  };
+
 private:
   // clang-format off
   TopoDS_Face                myFace;        //!< current face
@@ -173,6 +204,9 @@ private:
   BRepAdaptor_Surface        myFaceAdaptor; //!< surface adaptor for fetching normals from surface
   bool           myHasNormals;  //!< flag indicating that current face has normals
   bool           myIsMirrored;  //!< flag indicating that face triangles should be mirrored
+  NCollection_Vector<PreparedFace> myPreparedFaces;   //!< faces explored by PrepareData()
+  NCollection_Array1<gp_Dir>       myPreparedNormals; //!< transformed normals prepared in advance
+  int                              myPreparedIndex;   //!< index of current prepared face or -1
   // clang-format on
 };
 
@@ -29,7 +29,8 @@ RWMesh_ShapeIterator::RWMesh_ShapeIterator(const TDF_Label&       theLabel,
     : myDefStyle(theStyle),
       myToMapColors(theToMapColors),
       myShapeType(theShapeTypeFind),
-      myHasColor(false)
+      myHasColor(false),
+      myPreparedOffset(-1)
 {
   TopoDS_Shape aShape;
   if (!XCAFDoc_ShapeTool::GetShape(theLabel, aShape) || aShape.IsNull())
@@ -56,7 +57,8 @@ RWMesh_ShapeIterator::RWMesh_ShapeIterator(const TopoDS_Shape&    theShape,
     : myDefStyle(theStyle),
       myToMapColors(true),
       myShapeType(theShapeTypeFind),
-      myHasColor(false)
+      myHasColor(false),
+      myPreparedOffset(-1)
 {
   if (theShape.IsNull())
   {
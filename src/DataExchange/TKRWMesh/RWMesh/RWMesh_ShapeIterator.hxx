@@ -15,6 +15,7 @@
 #define _RWMesh_ShapeIterator_HeaderFile
 
 #include <BRepLProp_SLProps.hxx>
+#include <NCollection_Array1.hxx>
 #include <NCollection_DataMap.hxx>
 #include <Poly_Triangulation.hxx>
 #include <TopExp_Explorer.hxx>
@@ -77,8 +78,14 @@ public:
   Standard_EXPORT virtual int NodeUpper() const = 0;
 
   //! Return the node with specified index with applied transformation.
+  //! The value computed in advance is returned if data of the shape has been prepared.
   gp_Pnt NodeTransformed(const int theNode) const
   {
+    if (myPreparedOffset >= 0)
+    {
+      return myPreparedNodes.Value(myPreparedOffset + theNode - 1);
+    }
+
     gp_Pnt aNode = node(theNode);
     aNode.Transform(myTrsf);
     return aNode;
@@ -110,9 +117,10 @@ protected:
   //! Reset information for current shape.
   void resetShape()
   {
-    myHasColor = false;
-    myColor    = Quantity_ColorRGBA();
-    myStyle    = XCAFPrs_Style();
+    myHasColor       = false;
+    myColor          = Quantity_ColorRGBA();
+    myStyle          = XCAFPrs_Style();
+    myPreparedOffset = -1;
   }
 
   //! Initialize shape properties.
@@ -131,6 +139,11 @@ protected:
   Quantity_ColorRGBA myColor;     //!< current shape color
   TopAbs_ShapeEnum   myShapeType; //!< type of shape
   bool               myHasColor;  //!< flag indicating that current shape has assigned color
+
+  // clang-format off
+  NCollection_Array1<gp_Pnt> myPreparedNodes;  //!< transformed nodes prepared in advance
+  int                        myPreparedOffset; //!< offset of current nodes in myPreparedNodes or -1
+  // clang-format on
 };
 
 #endif // _RWMesh_ShapeIterator_HeaderFile
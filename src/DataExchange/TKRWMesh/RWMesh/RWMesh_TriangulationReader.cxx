@@ -16,6 +16,8 @@
 #include <Message.hxx>
 #include <RWMesh_TriangulationSource.hxx>
 
+#include <cstring>
+
 IMPLEMENT_STANDARD_RTTIEXT(RWMesh_TriangulationReader, Standard_Transient)
 
 namespace
@@ -155,6 +157,32 @@ bool RWMesh_TriangulationReader::finalizeLoading(
 
 //=================================================================================================
 
+void RWMesh_TriangulationReader::setNodePositions(const occ::handle<Poly_Triangulation>& theMesh,
+                                                  int                                    theIndex,
+                                                  const NCollection_Vec3<float>*         theNodes,
+                                                  int theNbNodes) const
+{
+  if (theNbNodes <= 0)
+  {
+    return;
+  }
+  if (!theMesh->IsDoublePrecision() && theMesh->NodesOrigin().IsEqual(gp_XYZ(), 0.0))
+  {
+    Poly_ArrayOfNodes& aNodes = theMesh->InternalNodes();
+    memcpy(&aNodes.ChangeValue<NCollection_Vec3<float>>(theIndex - 1),
+           theNodes,
+           size_t(theNbNodes) * sizeof(NCollection_Vec3<float>));
+    return;
+  }
+  for (int aNodeIter = 0; aNodeIter < theNbNodes; ++aNodeIter)
+  {
+    const NCollection_Vec3<float>& aNode = theNodes[aNodeIter];
+    setNodePosition(theMesh, theIndex + aNodeIter, gp_Pnt(aNode.x(), aNode.y(), aNode.z()));
+  }
+}
+
+//=================================================================================================
+
 bool RWMesh_TriangulationReader::setNbEdges(const occ::handle<Poly_Triangulation>& theMesh,
                                             const int                              theNbTris,
                                             const bool theToCopyData) const
@@ -181,6 +181,19 @@ protected: //! @name interface for filling triangulation data
     theMesh->SetNode(theIndex, thePnt);
   }
 
+  //! Sets positions of consecutive nodes.
+  //! Default implementation copies the data directly into the nodes array of single precision
+  //! triangulation having no nodes origin, and calls setNodePosition() for each node otherwise.
+  //! Should be redefined together with setNodePosition().
+  //! @param[in] theMesh  triangulation to be modified
+  //! @param[in] theIndex  index of the first node starting from 1
+  //! @param[in] theNodes  node positions
+  //! @param[in] theNbNodes  number of nodes
+  Standard_EXPORT virtual void setNodePositions(const occ::handle<Poly_Triangulation>& theMesh,
+                                                int                                    theIndex,
+                                                const NCollection_Vec3<float>*         theNodes,
+                                                int theNbNodes) const;
+
   //! Resizes array of UV nodes to specified size.
   //! @param[in] theMesh  triangulation to be modified
   //! @param[in] theNbNodes  nodes number
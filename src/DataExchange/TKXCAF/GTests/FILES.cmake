@@ -2,4 +2,6 @@
 set(OCCT_TKXCAF_GTests_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
 
 set(OCCT_TKXCAF_GTests_FILES
+  XCAFDoc_ShapeTool_Test.cxx
+  XCAFPrs_StyleCache_Test.cxx
 )
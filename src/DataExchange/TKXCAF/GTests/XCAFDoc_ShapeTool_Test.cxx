@@ -0,0 +1,103 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <gp_Trsf.hxx>
+#include <TDocStd_Application.hxx>
+#include <TDocStd_Document.hxx>
+#include <TopExp_Explorer.hxx>
+#include <XCAFDoc_DocumentTool.hxx>
+#include <XCAFDoc_ShapeTool.hxx>
+
+#include <gtest/gtest.h>
+
+TEST(XCAFDoc_ShapeTool_Test, AddComponents)
+{
+  occ::handle<TDocStd_Application> anApp = new TDocStd_Application();
+  occ::handle<TDocStd_Document>    aDoc;
+  anApp->NewDocument("XmlXCAF", aDoc);
+  ASSERT_FALSE(aDoc.IsNull());
+  occ::handle<XCAFDoc_ShapeTool> aShapeTool = XCAFDoc_DocumentTool::ShapeTool(aDoc->Main());
+
+  const TopoDS_Shape aBox1 = BRepPrimAPI_MakeBox(10.0, 20.0, 30.0).Shape();
+  const TopoDS_Shape aBox2 = BRepPrimAPI_MakeBox(5.0, 5.0, 5.0).Shape();
+
+  const int                          aNbInstances = 1000;
+  NCollection_Sequence<TopoDS_Shape> aComponents;
+  for (int anIndex = 1; anIndex <= aNbInstances; ++anIndex)
+  {
+    gp_Trsf aTrsf;
+    aTrsf.SetTranslation(gp_Vec(anIndex * 50.0, 0.0, 0.0));
+    aComponents.Append((anIndex % 2 == 0 ? aBox1 : aBox2).Located(TopLoc_Location(aTrsf)));
+  }
+  aComponents.Append(TopoDS_Shape());
+
+  const TDF_Label                 anAsmLab = aShapeTool->NewShape();
+  NCollection_Sequence<TDF_Label> aLabels;
+  ASSERT_TRUE(aShapeTool->AddComponents(anAsmLab, aComponents, aLabels));
+  ASSERT_EQ(aNbInstances + 1, aLabels.Length());
+  EXPECT_TRUE(aLabels.Last().IsNull());
+  EXPECT_TRUE(XCAFDoc_ShapeTool::IsAssembly(anAsmLab));
+  EXPECT_EQ(aNbInstances, XCAFDoc_ShapeTool::NbComponents(anAsmLab));
+
+  // each part is added once and referred by all its instances
+  const TDF_Label aPart1 = aShapeTool->FindShape(aBox1);
+  const TDF_Label aPart2 = aShapeTool->FindShape(aBox2);
+  ASSERT_FALSE(aPart1.IsNull());
+  ASSERT_FALSE(aPart2.IsNull());
+  NCollection_Sequence<TDF_Label> aUsers;
+  EXPECT_EQ(aNbInstances / 2, XCAFDoc_ShapeTool::GetUsers(aPart1, aUsers));
+
+  for (int anIndex = 1; anIndex <= aNbInstances; ++anIndex)
+  {
+    TDF_Label aRefLab;
+    ASSERT_TRUE(XCAFDoc_ShapeTool::GetReferredShape(aLabels.Value(anIndex), aRefLab));
+    EXPECT_EQ(anIndex % 2 == 0 ? aPart1 : aPart2, aRefLab);
+    EXPECT_TRUE(
+      XCAFDoc_ShapeTool::GetShape(aLabels.Value(anIndex)).IsSame(aComponents.Value(anIndex)));
+  }
+
+  // a label without shape cannot hold components
+  NCollection_Sequence<TDF_Label> anEmptyLabels;
+  EXPECT_FALSE(aShapeTool->AddComponents(aDoc->Main().FindChild(100), aComponents, anEmptyLabels));
+  EXPECT_TRUE(anEmptyLabels.IsEmpty());
+
+  aShapeTool->UpdateAssemblies();
+  EXPECT_EQ(aNbInstances, XCAFDoc_ShapeTool::GetShape(anAsmLab).NbChildren());
+}
+
+TEST(XCAFDoc_ShapeTool_Test, FindSharedSubShape)
+{
+  occ::handle<TDocStd_Application> anApp = new TDocStd_Application();
+  occ::handle<TDocStd_Document>    aDoc;
+  anApp->NewDocument("XmlXCAF", aDoc);
+  ASSERT_FALSE(aDoc.IsNull());
+  occ::handle<XCAFDoc_ShapeTool> aShapeTool = XCAFDoc_DocumentTool::ShapeTool(aDoc->Main());
+
+  // two parts sharing the same face
+  const TopoDS_Shape aBox   = BRepPrimAPI_MakeBox(10.0, 20.0, 30.0).Shape();
+  const TopoDS_Shape aFace  = TopExp_Explorer(aBox, TopAbs_FACE).Current();
+  const TDF_Label    aPart1 = aShapeTool->AddShape(aBox, false);
+  const TDF_Label    aPart2 = aShapeTool->AddShape(aFace.Reversed(), false);
+  EXPECT_EQ(aPart1, aShapeTool->FindMainShape(aFace));
+
+  const TDF_Label aSub1 = aShapeTool->AddSubShape(aPart1, aFace);
+  ASSERT_FALSE(aSub1.IsNull());
+
+  // the same face is held by the sub-shape label and by the top-level part
+  TDF_Label aFound;
+  EXPECT_TRUE(aShapeTool->FindSubShape(aPart1, aFace, aFound));
+  EXPECT_EQ(aSub1, aFound);
+  EXPECT_TRUE(aShapeTool->FindShape(aFace, aFound, false));
+  EXPECT_EQ(aPart2, aFound);
+}
@@ -0,0 +1,107 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <TDocStd_Application.hxx>
+#include <TDocStd_Document.hxx>
+#include <TopExp_Explorer.hxx>
+#include <XCAFDoc_ColorTool.hxx>
+#include <XCAFDoc_DocumentTool.hxx>
+#include <XCAFDoc_ShapeTool.hxx>
+#include <XCAFPrs.hxx>
+#include <XCAFPrs_StyleCache.hxx>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+//! Compares two maps of styles including the order of keys.
+void checkSameSettings(
+  const NCollection_IndexedDataMap<TopoDS_Shape, XCAFPrs_Style, TopTools_ShapeMapHasher>& theRef,
+  const NCollection_IndexedDataMap<TopoDS_Shape, XCAFPrs_Style, TopTools_ShapeMapHasher>& theRes)
+{
+  ASSERT_EQ(theRef.Extent(), theRes.Extent());
+  for (int anIndex = 1; anIndex <= theRef.Extent(); ++anIndex)
+  {
+    EXPECT_TRUE(theRef.FindKey(anIndex).IsEqual(theRes.FindKey(anIndex)));
+    EXPECT_TRUE(theRef.FindFromIndex(anIndex).IsEqual(theRes.FindFromIndex(anIndex)));
+  }
+}
+} // namespace
+
+TEST(XCAFPrs_StyleCache_Test, CollectStyleSettings)
+{
+  occ::handle<TDocStd_Application> anApp = new TDocStd_Application();
+  occ::handle<TDocStd_Document>    aDoc;
+  anApp->NewDocument("XmlXCAF", aDoc);
+  ASSERT_FALSE(aDoc.IsNull());
+  occ::handle<XCAFDoc_ShapeTool> aShapeTool = XCAFDoc_DocumentTool::ShapeTool(aDoc->Main());
+  occ::handle<XCAFDoc_ColorTool> aColorTool = XCAFDoc_DocumentTool::ColorTool(aDoc->Main());
+
+  // part with colored shape and one colored face
+  const TopoDS_Shape aBox     = BRepPrimAPI_MakeBox(10.0, 20.0, 30.0).Shape();
+  const TDF_Label    aPartLab = aShapeTool->AddShape(aBox, false);
+  aColorTool->SetColor(aPartLab, Quantity_Color(Quantity_NOC_RED), XCAFDoc_ColorSurf);
+  const TopoDS_Shape aFace    = TopExp_Explorer(aBox, TopAbs_FACE).Current();
+  const TDF_Label    aFaceLab = aShapeTool->AddSubShape(aPartLab, aFace);
+  ASSERT_FALSE(aFaceLab.IsNull());
+  aColorTool->SetColor(aFaceLab, Quantity_Color(Quantity_NOC_GREEN), XCAFDoc_ColorSurf);
+
+  // sub-assembly with several instances of the part, one of them with own color
+  const TDF_Label aSubAsmLab = aShapeTool->NewShape();
+  for (int anInstIter = 0; anInstIter < 4; ++anInstIter)
+  {
+    gp_Trsf aTrsf;
+    aTrsf.SetTranslation(gp_Vec(50.0 * anInstIter, 0.0, 0.0));
+    const TDF_Label anInstLab = aShapeTool->AddComponent(aSubAsmLab, aPartLab, aTrsf);
+    if (anInstIter == 2)
+    {
+      aColorTool->SetColor(anInstLab, Quantity_Color(Quantity_NOC_BLUE1), XCAFDoc_ColorGen);
+    }
+  }
+
+  // root assembly with several instances of the sub-assembly
+  const TDF_Label anAsmLab = aShapeTool->NewShape();
+  for (int anInstIter = 0; anInstIter < 3; ++anInstIter)
+  {
+    gp_Trsf aTrsf;
+    aTrsf.SetTranslation(gp_Vec(0.0, 100.0 * anInstIter, 0.0));
+    aShapeTool->AddComponent(anAsmLab, aSubAsmLab, aTrsf);
+  }
+  aShapeTool->UpdateAssemblies();
+
+  NCollection_IndexedDataMap<TopoDS_Shape, XCAFPrs_Style, TopTools_ShapeMapHasher> aRefSettings;
+  XCAFPrs::CollectStyleSettings(anAsmLab, TopLoc_Location(), aRefSettings);
+  EXPECT_EQ(3 * 4 * 2, aRefSettings.Extent());
+
+  occ::handle<XCAFPrs_StyleCache> aCache = new XCAFPrs_StyleCache();
+  for (int aPassIter = 0; aPassIter < 2; ++aPassIter)
+  {
+    NCollection_IndexedDataMap<TopoDS_Shape, XCAFPrs_Style, TopTools_ShapeMapHasher> aSettings;
+    XCAFPrs::CollectStyleSettings(anAsmLab, TopLoc_Location(), aSettings, aCache);
+    checkSameSettings(aRefSettings, aSettings);
+    // root assembly, sub-assembly and part
+    EXPECT_EQ(3, aCache->NbLabels());
+  }
+
+  // styles of the part are collected with identity location
+  const NCollection_IndexedDataMap<TopoDS_Shape, XCAFPrs_Style, TopTools_ShapeMapHasher>*
+    aPartSettings = aCache->FindSettings(aPartLab, Quantity_ColorRGBA(Quantity_NOC_WHITE));
+  ASSERT_NE(nullptr, aPartSettings);
+  EXPECT_EQ(2, aPartSettings->Extent());
+  EXPECT_TRUE(aPartSettings->Contains(aFace));
+
+  aCache->Clear();
+  EXPECT_EQ(0, aCache->NbLabels());
+  EXPECT_EQ(nullptr, aCache->FindSettings(aPartLab, Quantity_ColorRGBA(Quantity_NOC_WHITE)));
+}
@@ -15,6 +15,7 @@
 
 #include <XCAFDoc_DocumentTool.hxx>
 
+#include <OSD_MemInfo.hxx>
 #include <Standard_Type.hxx>
 #include <TDataStd_Name.hxx>
 #include <TDataStd_TreeNode.hxx>
@@ -77,6 +78,11 @@ occ::handle<XCAFDoc_DocumentTool> XCAFDoc_DocumentTool::Set(const TDF_Label& L,
     A = new XCAFDoc_DocumentTool;
     aL.AddAttribute(A);
     A->Init();
+    // account label nodes of the document in XCAF memory
+    if (!aL.Data()->LabelNodeAllocator().IsNull())
+    {
+      aL.Data()->LabelNodeAllocator()->SetMemTag(OSD_MemInfo::MemTag_XCAF);
+    }
     // set ShapeTool, ColorTool and LayerTool attributes
     XCAFDoc_ShapeTool::Set(ShapesLabel(L));
     XCAFDoc_ColorTool::Set(ColorsLabel(L));
@@ -16,6 +16,11 @@
 #include <XCAFDoc_ShapeTool.hxx>
 
 #include <BRep_Builder.hxx>
+#include <BRep_Tool.hxx>
+#include <Geom_Curve.hxx>
+#include <Geom_Surface.hxx>
+#include <GeomHash_CurveHasher.hxx>
+#include <GeomHash_SurfaceHasher.hxx>
 #include <gp_Pnt.hxx>
 #include <gp_Trsf.hxx>
 #include <Standard_Type.hxx>
@@ -27,7 +32,6 @@
 #include <TDataStd_TreeNode.hxx>
 #include <TDataStd_UAttribute.hxx>
 #include <TDF_Attribute.hxx>
-#include <TDF_ChildIDIterator.hxx>
 #include <TDF_ChildIterator.hxx>
 #include <TDF_Label.hxx>
 #include <NCollection_Map.hxx>
@@ -35,9 +39,17 @@
 #include <TDF_Tool.hxx>
 #include <TDocStd_Document.hxx>
 #include <TNaming_Builder.hxx>
+#include <TNaming_SameShapeIterator.hxx>
 #include <TNaming_Tool.hxx>
 #include <TopLoc_Location.hxx>
+#include <NCollection_Array1.hxx>
 #include <NCollection_IndexedMap.hxx>
+#include <OSD_Parallel.hxx>
+#include <Standard_HashUtils.hxx>
+#include <TDF_AttributeIterator.hxx>
+#include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
 #include <TopoDS_Compound.hxx>
 #include <TopoDS_Iterator.hxx>
 #include <TopoDS_Shape.hxx>
@@ -246,6 +258,30 @@ bool XCAFDoc_ShapeTool::Search(const TopoDS_Shape& S,
 
 //=================================================================================================
 
+//! Searches a child of theFather holding the shape same as theShape.
+//! Only labels referring the shape in TNaming_UsedShapes are checked,
+//! so the shape should be known to TNaming_Tool::HasLabel().
+static bool findSameShapeLabel(const TopoDS_Shape& theShape,
+                               const TDF_Label&    theFather,
+                               TDF_Label&          theLabel)
+{
+  for (TNaming_SameShapeIterator anIter(theShape, theFather); anIter.More(); anIter.Next())
+  {
+    const TDF_Label                 aLabel = anIter.Label();
+    occ::handle<TNaming_NamedShape> aNS;
+    if (aLabel.Father() == theFather && aLabel.FindAttribute(TNaming_NamedShape::GetID(), aNS)
+        && theShape.IsSame(TNaming_Tool::GetShape(aNS)))
+    {
+      theLabel = aLabel;
+      return true;
+    }
+  }
+  theLabel = TDF_Label();
+  return false;
+}
+
+//=================================================================================================
+
 bool XCAFDoc_ShapeTool::FindShape(const TopoDS_Shape& S,
                                   TDF_Label&          L,
                                   const bool          findInstance) const
@@ -270,22 +306,8 @@ bool XCAFDoc_ShapeTool::FindShape(const TopoDS_Shape& S,
   if (IsTopLevel(L))
     return true;
 
-  // Try to find shape manually
-  TDF_ChildIDIterator it(Label(), TNaming_NamedShape::GetID());
-  for (; it.More(); it.Next())
-  {
-    TDF_Label                       aLabel = it.Value()->Label();
-    occ::handle<TNaming_NamedShape> NS;
-    if (aLabel.FindAttribute(TNaming_NamedShape::GetID(), NS)
-        && S0.IsSame(TNaming_Tool::GetShape(NS)))
-    {
-      L = aLabel;
-      return true;
-    }
-  }
-
-  L = TDF_Label();
-  return false;
+  // Try to find shape among all labels holding it
+  return findSameShapeLabel(S0, Label(), L);
 }
 
 //=================================================================================================
@@ -951,6 +973,52 @@ TDF_Label XCAFDoc_ShapeTool::AddComponent(const TDF_Label&    assembly,
 
 //=================================================================================================
 
+bool XCAFDoc_ShapeTool::AddComponents(const TDF_Label&                          theAssembly,
+                                      const NCollection_Sequence<TopoDS_Shape>& theComponents,
+                                      NCollection_Sequence<TDF_Label>&          theLabels,
+                                      const bool                                theToExpand)
+{
+  theLabels.Clear();
+  if (!IsAssembly(theAssembly))
+  {
+    if (!IsSimpleShape(theAssembly))
+      return false;
+    TDataStd_UAttribute::Set(theAssembly, XCAFDoc::AssemblyGUID());
+  }
+
+  NCollection_DataMap<TopoDS_Shape, TDF_Label, TopTools_ShapeMapHasher> aParts;
+  for (NCollection_Sequence<TopoDS_Shape>::Iterator anIter(theComponents); anIter.More();
+       anIter.Next())
+  {
+    const TopoDS_Shape& aComp = anIter.Value();
+    if (aComp.IsNull())
+    {
+      theLabels.Append(TDF_Label());
+      continue;
+    }
+
+    const TopoDS_Shape aPartShape = aComp.Located(TopLoc_Location());
+    TDF_Label*         aPart      = aParts.ChangeSeek(aPartShape);
+    if (aPart == nullptr)
+    {
+      aPart = aParts.Bound(aPartShape, AddShape(aPartShape, theToExpand));
+    }
+
+    const TDF_Label aCompL = TDF_TagSource::NewChild(theAssembly);
+    MakeReference(aCompL, *aPart, aComp.Location());
+    theLabels.Append(aCompL);
+
+    TopoDS_Shape aShape;
+    if (GetShape(aCompL, aShape) && !myShapeLabels.IsBound(aShape))
+    {
+      myShapeLabels.Bind(aShape, aCompL);
+    }
+  }
+  return true;
+}
+
+//=================================================================================================
+
 void XCAFDoc_ShapeTool::RemoveComponent(const TDF_Label& comp) const
 {
   if (IsComponent(comp))
@@ -968,7 +1036,7 @@ void XCAFDoc_ShapeTool::UpdateAssemblies()
   GetFreeShapes(aRootLabels);
 
   // Iterate over the free shapes
-  NCollection_Map<TDF_Label> anUpdated;
+  NCollection_Map<TDF_Label> anUpdated, aChecked;
   for (NCollection_Sequence<TDF_Label>::Iterator anIt(aRootLabels); anIt.More(); anIt.Next())
   {
     TDF_Label aRefLabel = anIt.Value();
@@ -978,7 +1046,7 @@ void XCAFDoc_ShapeTool::UpdateAssemblies()
     }
     const TDF_Label& aRootLab = aRefLabel;
     TopoDS_Shape     anAssemblyShape;
-    updateComponent(aRootLab, anAssemblyShape, anUpdated);
+    updateComponent(aRootLab, anAssemblyShape, anUpdated, aChecked);
   }
 }
 
@@ -1036,25 +1104,9 @@ bool XCAFDoc_ShapeTool::FindSubShape(const TDF_Label&    shapeL,
     return false;
   }
 
-  // if subshape was found wrong, try to do it manually
+  // if subshape was found wrong, check the other labels holding it
   // it can be possible if several part shapes has the same subshapes
-  L = TDF_Label();
-  TDF_ChildIterator aChldLabIt(shapeL);
-  for (; aChldLabIt.More(); aChldLabIt.Next())
-  {
-    TDF_Label                       aSubLabel = aChldLabIt.Value();
-    occ::handle<TNaming_NamedShape> NS;
-    if (!aSubLabel.FindAttribute(TNaming_NamedShape::GetID(), NS))
-      continue;
-    TopoDS_Shape aSubShape = TNaming_Tool::GetShape(NS);
-    if (!aSubShape.IsNull() && aSubShape.IsSame(sub))
-    {
-      L = aSubLabel;
-      return true;
-    }
-  }
-
-  return false;
+  return findSameShapeLabel(sub, shapeL, L);
 }
 
 //=================================================================================================
@@ -1133,6 +1185,14 @@ TDF_Label XCAFDoc_ShapeTool::FindMainShapeUsingMap(const TopoDS_Shape& sub) cons
 
 TDF_Label XCAFDoc_ShapeTool::FindMainShape(const TopoDS_Shape& sub) const
 {
+  // check the part registered for this subshape by addShape() first
+  const TDF_Label* aMapped = mySubShapes.Seek(sub);
+  if (aMapped != nullptr && !aMapped->IsNull() && IsTopLevel(*aMapped) && IsSimpleShape(*aMapped)
+      && IsSubShape(*aMapped, sub))
+  {
+    return *aMapped;
+  }
+
   TDF_ChildIterator it(Label());
   for (; it.More(); it.Next())
   {
@@ -1900,6 +1960,365 @@ bool XCAFDoc_ShapeTool::Expand(const TDF_Label& theShapeL)
   return false;
 }
 
+namespace
+{
+//! Topology and geometry of a part compared by XCAFDoc_ShapeTool::MergeDuplicates().
+struct PartGeometry
+{
+  std::size_t                                   Hash = 0;     //!< hash of all items
+  NCollection_Array1<int>                       NbShapes;     //!< numbers of sub-shapes by type
+  NCollection_Array1<TopAbs_Orientation>        Orientations; //!< orientations of faces
+  NCollection_Array1<occ::handle<Geom_Surface>> Surfaces;     //!< surfaces of faces
+  NCollection_Array1<occ::handle<Geom_Curve>>   Curves;       //!< 3D curves of edges
+  NCollection_Array1<gp_Pnt>                    Points;       //!< points of vertices
+};
+} // namespace
+
+//=================================================================================================
+
+template <typename T>
+static void combineHash(std::size_t& theHash, const T& theValue)
+{
+  theHash = opencascade::hash_combine(theValue, sizeof(T), theHash);
+}
+
+//=================================================================================================
+
+static void computePartGeometry(const TopoDS_Shape&   theShape,
+                                const double          theTolerance,
+                                PartGeometry& theGeom)
+{
+  const TopAbs_ShapeEnum aTypes[] = {TopAbs_SOLID, TopAbs_SHELL, TopAbs_FACE, TopAbs_WIRE};
+  theGeom.NbShapes.Resize(0, 3, false);
+  theGeom.Hash = opencascade::hash(static_cast<int>(theShape.ShapeType()));
+  for (int aTypeIter = 0; aTypeIter < 4; ++aTypeIter)
+  {
+    int aNbShapes = 0;
+    for (TopExp_Explorer anExp(theShape, aTypes[aTypeIter]); anExp.More(); anExp.Next())
+    {
+      ++aNbShapes;
+    }
+    theGeom.NbShapes.SetValue(aTypeIter, aNbShapes);
+    combineHash(theGeom.Hash, aNbShapes);
+  }
+
+  NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> aFaces, anEdges, aVertices;
+  TopExp::MapShapes(theShape, TopAbs_FACE, aFaces);
+  TopExp::MapShapes(theShape, TopAbs_EDGE, anEdges);
+  TopExp::MapShapes(theShape, TopAbs_VERTEX, aVertices);
+  if (aFaces.IsEmpty())
+  {
+    return;
+  }
+
+  const GeomHash_SurfaceHasher aSurfHasher;
+  theGeom.Orientations.Resize(1, aFaces.Extent(), false);
+  theGeom.Surfaces.Resize(1, aFaces.Extent(), false);
+  for (int aFaceIter = 1; aFaceIter <= aFaces.Extent(); ++aFaceIter)
+  {
+    const TopoDS_Face& aFace = TopoDS::Face(aFaces.FindKey(aFaceIter));
+    theGeom.Orientations.SetValue(aFaceIter, aFace.Orientation());
+    // surface is copied if face is located
+    theGeom.Surfaces.SetValue(aFaceIter, BRep_Tool::Surface(aFace));
+    combineHash(theGeom.Hash, aFace.Orientation());
+    combineHash(theGeom.Hash, aSurfHasher(theGeom.Surfaces.Value(aFaceIter)));
+  }
+
+  const GeomHash_CurveHasher aCurveHasher;
+  if (!anEdges.IsEmpty())
+  {
+    theGeom.Curves.Resize(1, anEdges.Extent(), false);
+  }
+  for (int anEdgeIter = 1; anEdgeIter <= anEdges.Extent(); ++anEdgeIter)
+  {
+    double aFirst = 0.0, aLast = 0.0;
+    theGeom.Curves.SetValue(anEdgeIter,
+                            BRep_Tool::Curve(TopoDS::Edge(anEdges.FindKey(anEdgeIter)),
+                                             aFirst,
+                                             aLast));
+    combineHash(theGeom.Hash, aCurveHasher(theGeom.Curves.Value(anEdgeIter)));
+  }
+
+  // vertices are quantized to find the same hash for points within tolerance,
+  // except the points near boundaries of quantization cells
+  if (!aVertices.IsEmpty())
+  {
+    theGeom.Points.Resize(1, aVertices.Extent(), false);
+  }
+  for (int aVertIter = 1; aVertIter <= aVertices.Extent(); ++aVertIter)
+  {
+    const gp_Pnt aPnt = BRep_Tool::Pnt(TopoDS::Vertex(aVertices.FindKey(aVertIter)));
+    theGeom.Points.SetValue(aVertIter, aPnt);
+    for (int aCoordIter = 1; aCoordIter <= 3; ++aCoordIter)
+    {
+      combineHash(theGeom.Hash,
+                  static_cast<int64_t>(std::floor(aPnt.Coord(aCoordIter) / theTolerance + 0.5)));
+    }
+  }
+}
+
+//=================================================================================================
+
+static bool isSameGeometry(const PartGeometry& theGeom1,
+                           const PartGeometry& theGeom2,
+                           const double                theTolerance)
+{
+  if (theGeom1.Hash != theGeom2.Hash || theGeom1.Surfaces.Size() != theGeom2.Surfaces.Size()
+      || theGeom1.Curves.Size() != theGeom2.Curves.Size()
+      || theGeom1.Points.Size() != theGeom2.Points.Size())
+  {
+    return false;
+  }
+  for (int aTypeIter = 0; aTypeIter < theGeom1.NbShapes.Size(); ++aTypeIter)
+  {
+    if (theGeom1.NbShapes.Value(aTypeIter) != theGeom2.NbShapes.Value(aTypeIter))
+    {
+      return false;
+    }
+  }
+
+  for (int anIndex = 1; anIndex <= theGeom1.Points.Size(); ++anIndex)
+  {
+    if (theGeom1.Points.Value(anIndex).SquareDistance(theGeom2.Points.Value(anIndex))
+        > theTolerance * theTolerance)
+    {
+      return false;
+    }
+  }
+  const GeomHash_SurfaceHasher aSurfHasher;
+  for (int anIndex = 1; anIndex <= theGeom1.Surfaces.Size(); ++anIndex)
+  {
+    if (theGeom1.Orientations.Value(anIndex) != theGeom2.Orientations.Value(anIndex)
+        || !aSurfHasher(theGeom1.Surfaces.Value(anIndex), theGeom2.Surfaces.Value(anIndex)))
+    {
+      return false;
+    }
+  }
+  const GeomHash_CurveHasher aCurveHasher;
+  for (int anIndex = 1; anIndex <= theGeom1.Curves.Size(); ++anIndex)
+  {
+    if (!aCurveHasher(theGeom1.Curves.Value(anIndex), theGeom2.Curves.Value(anIndex)))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+//=================================================================================================
+
+static bool isSameReference(const TDF_Label&     theLabel1,
+                            const TDF_Label&     theLabel2,
+                            const Standard_GUID& theRefGUID)
+{
+  occ::handle<TDataStd_TreeNode> aNode1, aNode2;
+  const bool hasRef1 = theLabel1.FindAttribute(theRefGUID, aNode1) && aNode1->HasFather();
+  const bool hasRef2 = theLabel2.FindAttribute(theRefGUID, aNode2) && aNode2->HasFather();
+  if (!hasRef1 || !hasRef2)
+  {
+    return hasRef1 == hasRef2;
+  }
+  return aNode1->Father()->Label() == aNode2->Father()->Label();
+}
+
+//=================================================================================================
+
+static bool isSameLayers(const TDF_Label& theLabel1, const TDF_Label& theLabel2)
+{
+  occ::handle<XCAFDoc_GraphNode> aNode1, aNode2;
+  const int aNbLayers1 =
+    theLabel1.FindAttribute(XCAFDoc::LayerRefGUID(), aNode1) ? aNode1->NbFathers() : 0;
+  const int aNbLayers2 =
+    theLabel2.FindAttribute(XCAFDoc::LayerRefGUID(), aNode2) ? aNode2->NbFathers() : 0;
+  if (aNbLayers1 != aNbLayers2)
+  {
+    return false;
+  }
+  for (int aLayerIter = 1; aLayerIter <= aNbLayers1; ++aLayerIter)
+  {
+    if (aNode1->GetFather(aLayerIter)->Label() != aNode2->GetFather(aLayerIter)->Label())
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+//=================================================================================================
+
+static bool isSameStyle(const TDF_Label& theLabel1, const TDF_Label& theLabel2)
+{
+  return isSameReference(theLabel1, theLabel2, XCAFDoc::ColorRefGUID(XCAFDoc_ColorGen))
+         && isSameReference(theLabel1, theLabel2, XCAFDoc::ColorRefGUID(XCAFDoc_ColorSurf))
+         && isSameReference(theLabel1, theLabel2, XCAFDoc::ColorRefGUID(XCAFDoc_ColorCurv))
+         && isSameReference(theLabel1, theLabel2, XCAFDoc::MaterialRefGUID())
+         && isSameReference(theLabel1, theLabel2, XCAFDoc::VisMaterialRefGUID())
+         && isSameLayers(theLabel1, theLabel2);
+}
+
+//=================================================================================================
+
+//! Returns TRUE if the part can be removed - it has no sub-shape labels
+//! and is not referred by graph nodes other than layers (GD&T, notes).
+static bool isRemovablePart(const TDF_Label& theLabel)
+{
+  if (theLabel.HasChild())
+  {
+    return false;
+  }
+  for (TDF_AttributeIterator anAttrIter(theLabel); anAttrIter.More(); anAttrIter.Next())
+  {
+    if (anAttrIter.Value()->IsKind(STANDARD_TYPE(XCAFDoc_GraphNode))
+        && anAttrIter.Value()->ID() != XCAFDoc::LayerRefGUID())
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+//=================================================================================================
+
+int XCAFDoc_ShapeTool::MergeDuplicates(NCollection_DataMap<TDF_Label, TDF_Label>& theMerged,
+                                       const double                               theTolerance)
+{
+  // parts used as components
+  NCollection_Sequence<TDF_Label> aShapes;
+  GetShapes(aShapes);
+  NCollection_Sequence<TDF_Label> aPartSeq;
+  for (NCollection_Sequence<TDF_Label>::Iterator aShapeIter(aShapes); aShapeIter.More();
+       aShapeIter.Next())
+  {
+    NCollection_Sequence<TDF_Label> aUsers;
+    const TDF_Label&                aLabel = aShapeIter.Value();
+    if (IsSimpleShape(aLabel) && !IsExternRef(aLabel) && GetUsers(aLabel, aUsers) > 0)
+    {
+      aPartSeq.Append(aLabel);
+    }
+  }
+  if (aPartSeq.Size() < 2)
+  {
+    return 0;
+  }
+
+  NCollection_Array1<TDF_Label>    aParts(1, aPartSeq.Size());
+  NCollection_Array1<TopoDS_Shape> aPartShapes(1, aPartSeq.Size());
+  int                              anIndex = 1;
+  for (NCollection_Sequence<TDF_Label>::Iterator aPartIter(aPartSeq); aPartIter.More();
+       aPartIter.Next(), ++anIndex)
+  {
+    aParts.SetValue(anIndex, aPartIter.Value());
+    aPartShapes.SetValue(anIndex, GetShape(aPartIter.Value()));
+  }
+
+  // geometry of parts is hashed independently
+  NCollection_Array1<PartGeometry> aGeoms(1, aParts.Size());
+  OSD_Parallel::For(1, aParts.Size() + 1, [&](const int theIndex) {
+    if (!aPartShapes.Value(theIndex).IsNull())
+    {
+      computePartGeometry(aPartShapes.Value(theIndex), theTolerance, aGeoms.ChangeValue(theIndex));
+    }
+  });
+
+  // parts with equal hashes, the first one in document order is kept for each group
+  NCollection_DataMap<std::size_t, NCollection_List<int>> aHashGroups;
+  int                                                     aNbMerged = 0;
+  for (int aPartIter = 1; aPartIter <= aParts.Size(); ++aPartIter)
+  {
+    const PartGeometry& aGeom = aGeoms.Value(aPartIter);
+    if (aGeom.Surfaces.IsEmpty())
+    {
+      continue;
+    }
+
+    NCollection_List<int>* aGroup = aHashGroups.ChangeSeek(aGeom.Hash);
+    if (aGroup == nullptr)
+    {
+      aGroup = aHashGroups.Bound(aGeom.Hash, NCollection_List<int>());
+    }
+
+    const TDF_Label& aPart      = aParts.Value(aPartIter);
+    int              aMainIndex = 0;
+    if (isRemovablePart(aPart))
+    {
+      for (NCollection_List<int>::Iterator aGroupIter(*aGroup); aGroupIter.More();
+           aGroupIter.Next())
+      {
+        if (isSameStyle(aParts.Value(aGroupIter.Value()), aPart)
+            && isSameGeometry(aGeoms.Value(aGroupIter.Value()), aGeom, theTolerance))
+        {
+          aMainIndex = aGroupIter.Value();
+          break;
+        }
+      }
+    }
+    if (aMainIndex == 0)
+    {
+      aGroup->Append(aPartIter);
+      continue;
+    }
+
+    // redirect components to the main part
+    const TDF_Label&                aMainPart = aParts.Value(aMainIndex);
+    NCollection_Sequence<TDF_Label> aUsers;
+    GetUsers(aPart, aUsers);
+    for (NCollection_Sequence<TDF_Label>::Iterator aUserIter(aUsers); aUserIter.More();
+         aUserIter.Next())
+    {
+      const TDF_Label&   aComp     = aUserIter.Value();
+      const TopoDS_Shape anOldShape = GetShape(aComp);
+      MakeReference(aComp, aMainPart, GetLocation(aComp));
+      const TDF_Label* aMappedLabel = myShapeLabels.Seek(anOldShape);
+      if (aMappedLabel != nullptr && *aMappedLabel == aComp)
+      {
+        myShapeLabels.UnBind(anOldShape);
+      }
+      const TopoDS_Shape aNewShape = GetShape(aComp);
+      if (!myShapeLabels.IsBound(aNewShape))
+      {
+        myShapeLabels.Bind(aNewShape, aComp);
+      }
+    }
+
+    // forget the removed part
+    const TopoDS_Shape& aPartShape   = aPartShapes.Value(aPartIter);
+    const TDF_Label*    aMappedLabel = myShapeLabels.Seek(aPartShape);
+    if (aMappedLabel != nullptr && *aMappedLabel == aPart)
+    {
+      myShapeLabels.UnBind(aPartShape);
+    }
+    aMappedLabel = mySimpleShapes.Seek(aPartShape);
+    if (aMappedLabel != nullptr && *aMappedLabel == aPart)
+    {
+      mySimpleShapes.UnBind(aPartShape);
+    }
+    RemoveShape(aPart, false);
+    theMerged.Bind(aPart, aMainPart);
+    ++aNbMerged;
+  }
+
+  if (aNbMerged > 0 && !mySubShapes.IsEmpty())
+  {
+    NCollection_List<TopoDS_Shape> aStaleSubShapes;
+    for (NCollection_DataMap<TopoDS_Shape, TDF_Label, TopTools_ShapeMapHasher>::Iterator
+           aSubShapeIter(mySubShapes);
+         aSubShapeIter.More();
+         aSubShapeIter.Next())
+    {
+      if (theMerged.IsBound(aSubShapeIter.Value()))
+      {
+        aStaleSubShapes.Append(aSubShapeIter.Key());
+      }
+    }
+    for (NCollection_List<TopoDS_Shape>::Iterator aStaleIter(aStaleSubShapes); aStaleIter.More();
+         aStaleIter.Next())
+    {
+      mySubShapes.UnBind(aStaleIter.Value());
+    }
+  }
+  return aNbMerged;
+}
+
 //=================================================================================================
 
 void XCAFDoc_ShapeTool::makeSubShape(const TDF_Label&       theMainShapeL,
@@ -1973,7 +2392,8 @@ void XCAFDoc_ShapeTool::makeSubShape(const TDF_Label&       theMainShapeL,
 
 bool XCAFDoc_ShapeTool::updateComponent(const TDF_Label&            theItemLabel,
                                         TopoDS_Shape&               theUpdatedShape,
-                                        NCollection_Map<TDF_Label>& theUpdated) const
+                                        NCollection_Map<TDF_Label>& theUpdated,
+                                        NCollection_Map<TDF_Label>& theChecked) const
 {
   if (!IsAssembly(theItemLabel))
     return false; // Do nothing for non-assemblies
@@ -1989,6 +2409,10 @@ bool XCAFDoc_ShapeTool::updateComponent(const TDF_Label&            theItemLabel
     return true;
   }
 
+  // The assembly instanced several times is checked only once
+  if (theChecked.Contains(theItemLabel))
+    return false;
+
   NCollection_Map<TopoDS_Shape> aCurrentRootShapeMap(aCurrentRootShape.NbChildren());
 
   // Get components of the assembly
@@ -2030,7 +2454,7 @@ bool XCAFDoc_ShapeTool::updateComponent(const TDF_Label&            theItemLabel
     if (IsAssembly(aComponentRefLab))
     {
       // Recursive call
-      if (updateComponent(aComponentRefLab, aComponentShape, theUpdated))
+      if (updateComponent(aComponentRefLab, aComponentShape, theUpdated, theChecked))
       {
         isModified = true;
         aComponentShape.Location(aComponentLoc, false); // Apply placement
@@ -2086,6 +2510,8 @@ bool XCAFDoc_ShapeTool::updateComponent(const TDF_Label&            theItemLabel
 
   if (isModified)
     theUpdated.Add(theItemLabel);
+  else
+    theChecked.Add(theItemLabel);
 
   return isModified;
 }
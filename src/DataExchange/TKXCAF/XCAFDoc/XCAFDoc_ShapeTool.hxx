@@ -26,6 +26,7 @@
 #include <TDataStd_GenericEmpty.hxx>
 #include <NCollection_Map.hxx>
 #include <NCollection_Sequence.hxx>
+#include <Precision.hxx>
 #include <Standard_Integer.hxx>
 #include <Standard_OStream.hxx>
 #include <TCollection_HAsciiString.hxx>
@@ -306,6 +307,18 @@ public:
                                          const TopoDS_Shape& comp,
                                          const bool          expand = false);
 
+  //! Adds located shapes as components to the assembly, the labels of the new
+  //! components are returned in theLabels in the same order (null label for null shape).
+  //! Each distinct shape without location is searched or added as top-level shape once,
+  //! so adding a large number of instances of the same parts takes linear time.
+  //! If theToExpand is True, compound parts are created as assemblies.
+  //! Note: assembly must be IsAssembly() or IsSimpleShape()
+  //! @return false if theAssembly cannot hold components
+  Standard_EXPORT bool AddComponents(const TDF_Label&                          theAssembly,
+                                     const NCollection_Sequence<TopoDS_Shape>& theComponents,
+                                     NCollection_Sequence<TDF_Label>&          theLabels,
+                                     const bool                                theToExpand = false);
+
   //! Removes a component from its assembly
   Standard_EXPORT void RemoveComponent(const TDF_Label& comp) const;
 
@@ -465,6 +478,23 @@ public:
   //! Convert Shape (compound/compsolid/shell/wire) to assembly
   Standard_EXPORT bool Expand(const TDF_Label& Shape);
 
+  //! Replaces parts having the same topology and geometry by instances of one part.
+  //! Parts (top-level simple shapes used as components of assemblies) are compared by hashes
+  //! of surfaces of faces and curves of edges (see GeomHash_SurfaceHasher and
+  //! GeomHash_CurveHasher) and of vertices quantized with the given tolerance; parts with
+  //! equal hashes are then compared item by item. Components referring to a duplicate are
+  //! redirected to the first equal part, and the duplicate is removed.
+  //! Parts are compared in their own coordinate systems, so copies differing by a placement
+  //! baked into the geometry are not merged. Parts having sub-shape labels, GD&T references,
+  //! or colors, materials or layers different from the first equal part are kept.
+  //! Names and other attributes of the removed parts are lost.
+  //! UpdateAssemblies() should be called afterwards.
+  //! @param[out] theMerged    map of the removed parts to the parts replacing them
+  //! @param[in] theTolerance  tolerance for comparing vertices
+  //! @return number of removed parts
+  Standard_EXPORT int MergeDuplicates(NCollection_DataMap<TDF_Label, TDF_Label>& theMerged,
+                                      const double theTolerance = Precision::Confusion());
+
   //! Method to get NamedData attribute assigned to the given shape label.
   //! @param[in] theLabel     the shape Label
   //! @param[in] theToCreate  create and assign attribute if it doesn't exist
@@ -489,10 +519,12 @@ public:
 private:
   //! Checks recursively if the given assembly item is modified. If so, its
   //! associated compound is updated. Returns true if the assembly item is
-  //! modified, false -- otherwise.
+  //! modified, false -- otherwise. Assemblies found unmodified are recorded
+  //! in theChecked and are not traversed again.
   Standard_EXPORT bool updateComponent(const TDF_Label&            theAssmLabel,
                                        TopoDS_Shape&               theUpdatedShape,
-                                       NCollection_Map<TDF_Label>& theUpdated) const;
+                                       NCollection_Map<TDF_Label>& theUpdated,
+                                       NCollection_Map<TDF_Label>& theChecked) const;
 
   //! Adds a new top-level (creates and returns a new label)
   //! For internal use. Used by public method AddShape.
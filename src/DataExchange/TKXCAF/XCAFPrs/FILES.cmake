@@ -15,6 +15,8 @@ set(OCCT_XCAFPrs_FILES
   XCAFPrs_Driver.hxx
   XCAFPrs_Style.cxx
   XCAFPrs_Style.hxx
+  XCAFPrs_StyleCache.cxx
+  XCAFPrs_StyleCache.hxx
   XCAFPrs_Texture.cxx
   XCAFPrs_Texture.hxx
 )
@@ -27,6 +27,7 @@
 #include <XCAFDoc_VisMaterialTool.hxx>
 #include <XCAFDoc_ShapeTool.hxx>
 #include <XCAFPrs_Style.hxx>
+#include <XCAFPrs_StyleCache.hxx>
 
 static bool viewnameMode = false;
 
@@ -101,6 +102,49 @@ static bool getShapesOfSHUO(NCollection_IndexedMap<TopLoc_Location>& theaPrevLoc
   return (theSHUOShapeSeq.Length() > 0);
 }
 
+static void collectStyleSettings(
+  const TDF_Label&                                                                  theLabel,
+  const TopLoc_Location&                                                            theLoc,
+  NCollection_IndexedDataMap<TopoDS_Shape, XCAFPrs_Style, TopTools_ShapeMapHasher>& theSettings,
+  const Quantity_ColorRGBA&                                                         theLayerColor,
+  XCAFPrs_StyleCache*                                                               theCache);
+
+//! Collect styles of the label using the cache: styles are collected once with identity location
+//! and then moved to the requested location.
+static void collectCachedStyleSettings(
+  const TDF_Label&                                                                  theLabel,
+  const TopLoc_Location&                                                            theLoc,
+  NCollection_IndexedDataMap<TopoDS_Shape, XCAFPrs_Style, TopTools_ShapeMapHasher>& theSettings,
+  const Quantity_ColorRGBA&                                                         theLayerColor,
+  XCAFPrs_StyleCache&                                                               theCache)
+{
+  const NCollection_IndexedDataMap<TopoDS_Shape, XCAFPrs_Style, TopTools_ShapeMapHasher>*
+    aCached = theCache.FindSettings(theLabel, theLayerColor);
+  if (aCached == nullptr)
+  {
+    NCollection_IndexedDataMap<TopoDS_Shape, XCAFPrs_Style, TopTools_ShapeMapHasher> aSettings;
+    collectStyleSettings(theLabel, TopLoc_Location(), aSettings, theLayerColor, &theCache);
+    aCached = &theCache.BindSettings(theLabel, theLayerColor, std::move(aSettings));
+  }
+
+  for (NCollection_IndexedDataMap<TopoDS_Shape, XCAFPrs_Style, TopTools_ShapeMapHasher>::Iterator
+         aStyledShapeIter(*aCached);
+       aStyledShapeIter.More();
+       aStyledShapeIter.Next())
+  {
+    TopoDS_Shape aSubshape = aStyledShapeIter.Key();
+    if (!theLoc.IsIdentity())
+    {
+      aSubshape.Move(theLoc, false);
+    }
+    XCAFPrs_Style* aMapStyle = theSettings.ChangeSeek(aSubshape);
+    if (aMapStyle == nullptr)
+      theSettings.Add(aSubshape, aStyledShapeIter.Value());
+    else
+      *aMapStyle = aStyledShapeIter.Value();
+  }
+}
+
 //=================================================================================================
 
 void XCAFPrs::CollectStyleSettings(
@@ -108,6 +152,36 @@ void XCAFPrs::CollectStyleSettings(
   const TopLoc_Location&                                                            theLoc,
   NCollection_IndexedDataMap<TopoDS_Shape, XCAFPrs_Style, TopTools_ShapeMapHasher>& theSettings,
   const Quantity_ColorRGBA&                                                         theLayerColor)
+{
+  collectStyleSettings(theLabel, theLoc, theSettings, theLayerColor, nullptr);
+}
+
+//=================================================================================================
+
+void XCAFPrs::CollectStyleSettings(
+  const TDF_Label&                                                                  theLabel,
+  const TopLoc_Location&                                                            theLoc,
+  NCollection_IndexedDataMap<TopoDS_Shape, XCAFPrs_Style, TopTools_ShapeMapHasher>& theSettings,
+  const occ::handle<XCAFPrs_StyleCache>&                                            theCache,
+  const Quantity_ColorRGBA&                                                         theLayerColor)
+{
+  if (theCache.IsNull())
+  {
+    collectStyleSettings(theLabel, theLoc, theSettings, theLayerColor, nullptr);
+    return;
+  }
+
+  collectCachedStyleSettings(theLabel, theLoc, theSettings, theLayerColor, *theCache);
+}
+
+//=================================================================================================
+
+static void collectStyleSettings(
+  const TDF_Label&                                                                  theLabel,
+  const TopLoc_Location&                                                            theLoc,
+  NCollection_IndexedDataMap<TopoDS_Shape, XCAFPrs_Style, TopTools_ShapeMapHasher>& theSettings,
+  const Quantity_ColorRGBA&                                                         theLayerColor,
+  XCAFPrs_StyleCache*                                                               theCache)
 {
   // for references, first collect colors of referred shape
   {
@@ -128,7 +202,15 @@ void XCAFPrs::CollectStyleSettings(
           aLayerColor = aColor;
       }
       TopLoc_Location aLocSub = theLoc.Multiplied(XCAFDoc_ShapeTool::GetLocation(theLabel));
-      CollectStyleSettings(aLabelRef, aLocSub, theSettings, aLayerColor);
+      if (theCache != nullptr)
+      {
+        // referred shape might be shared by many instances
+        collectCachedStyleSettings(aLabelRef, aLocSub, theSettings, aLayerColor, *theCache);
+      }
+      else
+      {
+        collectStyleSettings(aLabelRef, aLocSub, theSettings, aLayerColor, nullptr);
+      }
     }
   }
 
@@ -142,7 +224,7 @@ void XCAFPrs::CollectStyleSettings(
            aComponentIter.Next())
       {
         const TDF_Label& aComponentLab = aComponentIter.Value();
-        CollectStyleSettings(aComponentLab, theLoc, theSettings, theLayerColor);
+        collectStyleSettings(aComponentLab, theLoc, theSettings, theLayerColor, theCache);
       }
     }
   }
@@ -26,6 +26,7 @@
 #include <Standard_Boolean.hxx>
 class TDF_Label;
 class TopLoc_Location;
+class XCAFPrs_StyleCache;
 
 //! Presentation (visualiation, selection etc.) tools for
 //! DECAF documents
@@ -45,6 +46,21 @@ public:
     NCollection_IndexedDataMap<TopoDS_Shape, XCAFPrs_Style, TopTools_ShapeMapHasher>& settings,
     const Quantity_ColorRGBA& theLayerColor = Quantity_ColorRGBA(Quantity_NOC_WHITE));
 
+  //! Collect styles defined for shape on label L and its components and subshapes
+  //! reusing styles of referred shapes stored in the cache.
+  //! Styles of each referred shape are collected only once and then put into the map
+  //! with the location of each instance, so that collecting styles of large assemblies
+  //! with many instances of the same parts scales with the number of styled sub-shapes.
+  //! The location <loc> should be Null location for external call.
+  //! @param[in] theCache  cache to fill and reuse; when NULL, styles are collected
+  //!                      as by the method without cache
+  Standard_EXPORT static void CollectStyleSettings(
+    const TDF_Label&                                                                  L,
+    const TopLoc_Location&                                                            loc,
+    NCollection_IndexedDataMap<TopoDS_Shape, XCAFPrs_Style, TopTools_ShapeMapHasher>& settings,
+    const occ::handle<XCAFPrs_StyleCache>&                                            theCache,
+    const Quantity_ColorRGBA& theLayerColor = Quantity_ColorRGBA(Quantity_NOC_WHITE));
+
   //! Set ViewNameMode for indicate display names or not.
   Standard_EXPORT static void SetViewNameMode(const bool viewNameMode);
 
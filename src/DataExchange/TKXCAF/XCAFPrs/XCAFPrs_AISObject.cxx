@@ -128,11 +128,6 @@ void XCAFPrs_AISObject::DispatchStyles(const bool theToSyncStyles)
   }
   Set(aShape);
 
-  // Collecting information on colored subshapes
-  TopLoc_Location                                                                  aLoc;
-  NCollection_IndexedDataMap<TopoDS_Shape, XCAFPrs_Style, TopTools_ShapeMapHasher> aSettings;
-  XCAFPrs::CollectStyleSettings(myLabel, aLoc, aSettings);
-
   // Getting default colors
   XCAFPrs_Style aDefStyle;
   DefaultStyle(aDefStyle);
@@ -141,6 +136,20 @@ void XCAFPrs_AISObject::DispatchStyles(const bool theToSyncStyles)
                    aDefStyle,
                    myDrawer->ShadingAspect()->Aspect()->FrontMaterial());
 
+  // reuse sub-shapes grouped by style by another presentation of the same label
+  const NCollection_IndexedDataMap<XCAFPrs_Style, TopoDS_Compound>* aCachedGroups =
+    !myStyleCache.IsNull() ? myStyleCache->FindStyleGroups(myLabel) : nullptr;
+  if (aCachedGroups != nullptr)
+  {
+    assignStyleGroups(*aCachedGroups, aDefStyle);
+    return;
+  }
+
+  // Collecting information on colored subshapes
+  TopLoc_Location                                                                  aLoc;
+  NCollection_IndexedDataMap<TopoDS_Shape, XCAFPrs_Style, TopTools_ShapeMapHasher> aSettings;
+  XCAFPrs::CollectStyleSettings(myLabel, aLoc, aSettings, myStyleCache);
+
   // collect sub-shapes with the same style into compounds
   BRep_Builder                                               aBuilder;
   NCollection_IndexedDataMap<XCAFPrs_Style, TopoDS_Compound> aStyleGroups;
@@ -166,9 +175,22 @@ void XCAFPrs_AISObject::DispatchStyles(const bool theToSyncStyles)
   }
   aSettings.Clear();
 
-  // assign custom aspects
+  if (!myStyleCache.IsNull())
+  {
+    assignStyleGroups(myStyleCache->BindStyleGroups(myLabel, std::move(aStyleGroups)), aDefStyle);
+    return;
+  }
+  assignStyleGroups(aStyleGroups, aDefStyle);
+}
+
+//=================================================================================================
+
+void XCAFPrs_AISObject::assignStyleGroups(
+  const NCollection_IndexedDataMap<XCAFPrs_Style, TopoDS_Compound>& theStyleGroups,
+  const XCAFPrs_Style&                                              theDefStyle)
+{
   for (NCollection_IndexedDataMap<XCAFPrs_Style, TopoDS_Compound>::Iterator aStyleGroupIter(
-         aStyleGroups);
+         theStyleGroups);
        aStyleGroupIter.More();
        aStyleGroupIter.Next())
   {
@@ -195,10 +217,9 @@ void XCAFPrs_AISObject::DispatchStyles(const bool theToSyncStyles)
     }
     setStyleToDrawer(aDrawer,
                      aStyle,
-                     aDefStyle,
+                     theDefStyle,
                      myDrawer->ShadingAspect()->Aspect()->FrontMaterial());
   }
-  aStyleGroups.Clear();
 }
 
 //=================================================================================================
@@ -17,8 +17,7 @@
 #include <AIS_ColoredShape.hxx>
 
 #include <TDF_Label.hxx>
-
-class XCAFPrs_Style;
+#include <XCAFPrs_StyleCache.hxx>
 
 //! Implements AIS_InteractiveObject functionality for shape in DECAF document.
 class XCAFPrs_AISObject : public AIS_ColoredShape
@@ -41,6 +40,15 @@ public:
   //!                        on first compute or re-compute
   Standard_EXPORT virtual void DispatchStyles(const bool theToSyncStyles = false);
 
+  //! Return the cache of styles shared between presentations or NULL (by default).
+  const occ::handle<XCAFPrs_StyleCache>& StyleCache() const { return myStyleCache; }
+
+  //! Assign the cache of styles, which might be shared between presentations of the same document.
+  //! Styles of the label and of shapes referred by assembly instances are then collected only
+  //! once, and presentations of the same label reuse sub-shapes grouped by style.
+  //! The cache should be cleared by application after modification of styles in the document.
+  void SetStyleCache(const occ::handle<XCAFPrs_StyleCache>& theCache) { myStyleCache = theCache; }
+
   //! Sets the material aspect.
   //! This method assigns the new default material without overriding XDE styles.
   //! Re-computation of existing presentation is not required after calling this method.
@@ -58,6 +66,11 @@ protected:
   Standard_EXPORT virtual void DefaultStyle(XCAFPrs_Style& theStyle) const;
 
 protected:
+  //! Assign custom aspects to the groups of sub-shapes sharing the same style.
+  Standard_EXPORT void assignStyleGroups(
+    const NCollection_IndexedDataMap<XCAFPrs_Style, TopoDS_Compound>& theStyleGroups,
+    const XCAFPrs_Style&                                              theDefStyle);
+
   //! Assign style to drawer.
   static void setStyleToDrawer(const occ::handle<Prs3d_Drawer>& theDrawer,
                                const XCAFPrs_Style&             theStyle,
@@ -65,7 +78,8 @@ protected:
                                const Graphic3d_MaterialAspect&  theDefMaterial);
 
 protected:
-  TDF_Label myLabel; //!< label pointing onto the shape
+  TDF_Label                       myLabel;      //!< label pointing onto the shape
+  occ::handle<XCAFPrs_StyleCache> myStyleCache; //!< optional cache of styles
   // clang-format off
   bool myToSyncStyles; //!< flag indicating that shape and sub-shapes should be updates within Compute()
   // clang-format on
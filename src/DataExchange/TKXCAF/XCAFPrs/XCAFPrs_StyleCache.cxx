@@ -0,0 +1,79 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <XCAFPrs_StyleCache.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(XCAFPrs_StyleCache, Standard_Transient)
+
+//=================================================================================================
+
+XCAFPrs_StyleCache::XCAFPrs_StyleCache() {}
+
+//=================================================================================================
+
+const NCollection_IndexedDataMap<TopoDS_Shape, XCAFPrs_Style, TopTools_ShapeMapHasher>*
+  XCAFPrs_StyleCache::FindSettings(const TDF_Label&          theLabel,
+                                   const Quantity_ColorRGBA& theLayerColor) const
+{
+  const NCollection_List<LabelSettings>* aList = mySettings.Seek(theLabel);
+  if (aList == nullptr)
+  {
+    return nullptr;
+  }
+
+  for (NCollection_List<LabelSettings>::Iterator anIter(*aList); anIter.More(); anIter.Next())
+  {
+    if (anIter.Value().LayerColor == theLayerColor)
+    {
+      return &anIter.Value().Settings;
+    }
+  }
+  return nullptr;
+}
+
+//=================================================================================================
+
+const NCollection_IndexedDataMap<TopoDS_Shape, XCAFPrs_Style, TopTools_ShapeMapHasher>&
+  XCAFPrs_StyleCache::BindSettings(
+    const TDF_Label&                                                                  theLabel,
+    const Quantity_ColorRGBA&                                                         theLayerColor,
+    NCollection_IndexedDataMap<TopoDS_Shape, XCAFPrs_Style, TopTools_ShapeMapHasher>&& theSettings)
+{
+  NCollection_List<LabelSettings>* aList = mySettings.ChangeSeek(theLabel);
+  if (aList == nullptr)
+  {
+    aList = mySettings.Bound(theLabel, NCollection_List<LabelSettings>());
+  }
+
+  LabelSettings& aSettings = aList->Append(LabelSettings());
+  aSettings.LayerColor     = theLayerColor;
+  aSettings.Settings       = std::move(theSettings);
+  return aSettings.Settings;
+}
+
+//=================================================================================================
+
+const NCollection_IndexedDataMap<XCAFPrs_Style, TopoDS_Compound>& XCAFPrs_StyleCache::
+  BindStyleGroups(const TDF_Label&                                             theLabel,
+                  NCollection_IndexedDataMap<XCAFPrs_Style, TopoDS_Compound>&& theGroups)
+{
+  return *myStyleGroups.Bound(theLabel, std::move(theGroups));
+}
+
+//=================================================================================================
+
+void XCAFPrs_StyleCache::Clear()
+{
+  mySettings.Clear();
+  myStyleGroups.Clear();
+}
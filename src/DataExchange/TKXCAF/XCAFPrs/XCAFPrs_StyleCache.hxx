@@ -0,0 +1,91 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _XCAFPrs_StyleCache_HeaderFile
+#define _XCAFPrs_StyleCache_HeaderFile
+
+#include <NCollection_DataMap.hxx>
+#include <NCollection_IndexedDataMap.hxx>
+#include <NCollection_List.hxx>
+#include <TDF_Label.hxx>
+#include <TopoDS_Compound.hxx>
+#include <TopTools_ShapeMapHasher.hxx>
+#include <XCAFPrs_Style.hxx>
+
+//! Cache of styles collected from XDE document for shape labels.
+//!
+//! The cache stores sub-shape styles collected by XCAFPrs::CollectStyleSettings() for each
+//! referred shape label (with identity location) and groups of sub-shapes sharing the same style
+//! built by XCAFPrs_AISObject::DispatchStyles(), so that styles of a shape referred by many
+//! assembly instances or displayed by many presentations are collected only once.
+//!
+//! The cache is not synchronized with the document - application should call Clear()
+//! after modification of shapes, colors, materials or layers in the document.
+class XCAFPrs_StyleCache : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(XCAFPrs_StyleCache, Standard_Transient)
+public:
+  //! Empty constructor.
+  Standard_EXPORT XCAFPrs_StyleCache();
+
+  //! Return styles collected for the label with specified layer color or NULL if not cached.
+  Standard_EXPORT const NCollection_IndexedDataMap<TopoDS_Shape,
+                                                   XCAFPrs_Style,
+                                                   TopTools_ShapeMapHasher>*
+    FindSettings(const TDF_Label& theLabel, const Quantity_ColorRGBA& theLayerColor) const;
+
+  //! Store styles collected for the label with specified layer color and identity location.
+  //! @return the stored map
+  Standard_EXPORT const NCollection_IndexedDataMap<TopoDS_Shape,
+                                                   XCAFPrs_Style,
+                                                   TopTools_ShapeMapHasher>&
+    BindSettings(const TDF_Label&          theLabel,
+                 const Quantity_ColorRGBA& theLayerColor,
+                 NCollection_IndexedDataMap<TopoDS_Shape, XCAFPrs_Style, TopTools_ShapeMapHasher>&&
+                   theSettings);
+
+  //! Return groups of sub-shapes of the label sharing the same style or NULL if not cached.
+  const NCollection_IndexedDataMap<XCAFPrs_Style, TopoDS_Compound>* FindStyleGroups(
+    const TDF_Label& theLabel) const
+  {
+    return myStyleGroups.Seek(theLabel);
+  }
+
+  //! Store groups of sub-shapes of the label sharing the same style.
+  //! @return the stored map
+  Standard_EXPORT const NCollection_IndexedDataMap<XCAFPrs_Style, TopoDS_Compound>& BindStyleGroups(
+    const TDF_Label&                                             theLabel,
+    NCollection_IndexedDataMap<XCAFPrs_Style, TopoDS_Compound>&& theGroups);
+
+  //! Return number of labels with cached styles.
+  int NbLabels() const { return mySettings.Extent(); }
+
+  //! Reset the cache.
+  Standard_EXPORT void Clear();
+
+private:
+  //! Styles collected for the label with specific layer color.
+  struct LabelSettings
+  {
+    Quantity_ColorRGBA LayerColor; //!< layer color inherited from the referring instance
+    NCollection_IndexedDataMap<TopoDS_Shape, XCAFPrs_Style, TopTools_ShapeMapHasher>
+      Settings; //!< styles of sub-shapes with identity location
+  };
+
+private:
+  NCollection_DataMap<TDF_Label, NCollection_List<LabelSettings>> mySettings; //!< collected styles
+  NCollection_DataMap<TDF_Label, NCollection_IndexedDataMap<XCAFPrs_Style, TopoDS_Compound>>
+    myStyleGroups; //!< sub-shapes grouped by style
+};
+
+#endif // _XCAFPrs_StyleCache_HeaderFile
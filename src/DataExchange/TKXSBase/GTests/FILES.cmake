@@ -2,4 +2,6 @@
 set(OCCT_TKXSBase_GTests_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
 
 set(OCCT_TKXSBase_GTests_FILES
+  Interface_EntityGraph_Test.cxx
+  Transfer_TransientProcess_Test.cxx
 )
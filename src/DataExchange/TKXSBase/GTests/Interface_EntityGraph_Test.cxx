@@ -0,0 +1,103 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <Interface_EntityGraph.hxx>
+#include <Standard_OutOfRange.hxx>
+#include <Standard_ProgramError.hxx>
+
+#include <gtest/gtest.h>
+
+TEST(Interface_EntityGraph_Test, EmptyGraph)
+{
+  occ::handle<Interface_EntityGraph> aGraph = new Interface_EntityGraph(3);
+  EXPECT_FALSE(aGraph->IsBuilt());
+  aGraph->Build();
+  EXPECT_TRUE(aGraph->IsBuilt());
+  EXPECT_EQ(3, aGraph->NbEntities());
+  EXPECT_EQ(0, aGraph->NbReferences());
+  for (int anEntity = 1; anEntity <= 3; ++anEntity)
+  {
+    EXPECT_EQ(0, aGraph->NbShareds(anEntity));
+    EXPECT_EQ(0, aGraph->NbSharings(anEntity));
+    EXPECT_FALSE(aGraph->HasShareError(anEntity));
+  }
+
+  occ::handle<Interface_EntityGraph> aNullGraph = new Interface_EntityGraph(0);
+  aNullGraph->Build();
+  EXPECT_EQ(0, aNullGraph->NbReferences());
+}
+
+TEST(Interface_EntityGraph_Test, SharedAndSharings)
+{
+  // 1 -> 3, 4; 2 -> 4, 4, 1; 4 -> 3; 3 and 5 share nothing
+  occ::handle<Interface_EntityGraph> aGraph = new Interface_EntityGraph(5);
+  aGraph->AddShared(1, 3);
+  aGraph->AddShared(1, 4);
+  aGraph->AddShared(2, 4);
+  aGraph->AddShared(2, 4);
+  aGraph->AddShared(2, 1);
+  aGraph->AddShared(4, 3);
+  aGraph->Build();
+  EXPECT_EQ(6, aGraph->NbReferences());
+
+  ASSERT_EQ(2, aGraph->NbShareds(1));
+  EXPECT_EQ(3, aGraph->Shared(1, 1));
+  EXPECT_EQ(4, aGraph->Shared(1, 2));
+  ASSERT_EQ(3, aGraph->NbShareds(2));
+  EXPECT_EQ(4, aGraph->Shared(2, 1));
+  EXPECT_EQ(4, aGraph->Shared(2, 2));
+  EXPECT_EQ(1, aGraph->Shared(2, 3));
+  EXPECT_EQ(0, aGraph->NbShareds(3));
+  ASSERT_EQ(1, aGraph->NbShareds(4));
+  EXPECT_EQ(3, aGraph->Shared(4, 1));
+  EXPECT_EQ(0, aGraph->NbShareds(5));
+
+  // sharing entities are sorted and duplicated references are kept
+  ASSERT_EQ(1, aGraph->NbSharings(1));
+  EXPECT_EQ(2, aGraph->Sharing(1, 1));
+  EXPECT_EQ(0, aGraph->NbSharings(2));
+  ASSERT_EQ(2, aGraph->NbSharings(3));
+  EXPECT_EQ(1, aGraph->Sharing(3, 1));
+  EXPECT_EQ(4, aGraph->Sharing(3, 2));
+  ASSERT_EQ(3, aGraph->NbSharings(4));
+  EXPECT_EQ(1, aGraph->Sharing(4, 1));
+  EXPECT_EQ(2, aGraph->Sharing(4, 2));
+  EXPECT_EQ(2, aGraph->Sharing(4, 3));
+  EXPECT_EQ(0, aGraph->NbSharings(5));
+}
+
+TEST(Interface_EntityGraph_Test, ShareErrors)
+{
+  occ::handle<Interface_EntityGraph> aGraph = new Interface_EntityGraph(3);
+  aGraph->SetShareError(1);
+  aGraph->AddShared(2, 1);
+  aGraph->SetShareError(3);
+  aGraph->Build();
+  EXPECT_TRUE(aGraph->HasShareError(1));
+  EXPECT_FALSE(aGraph->HasShareError(2));
+  EXPECT_TRUE(aGraph->HasShareError(3));
+  EXPECT_EQ(2, aGraph->ShareErrors().Extent());
+  ASSERT_EQ(1, aGraph->NbSharings(1));
+  EXPECT_EQ(2, aGraph->Sharing(1, 1));
+}
+
+TEST(Interface_EntityGraph_Test, InvalidFilling)
+{
+  occ::handle<Interface_EntityGraph> aGraph = new Interface_EntityGraph(3);
+  EXPECT_THROW(aGraph->AddShared(0, 1), Standard_OutOfRange);
+  EXPECT_THROW(aGraph->AddShared(1, 4), Standard_OutOfRange);
+  aGraph->AddShared(2, 1);
+  EXPECT_THROW(aGraph->AddShared(1, 2), Standard_ProgramError);
+  aGraph->Build();
+  EXPECT_THROW(aGraph->AddShared(3, 1), Standard_ProgramError);
+}
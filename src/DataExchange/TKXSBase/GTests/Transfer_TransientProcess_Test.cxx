@@ -0,0 +1,73 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <Interface_Check.hxx>
+#include <TCollection_HAsciiString.hxx>
+#include <Transfer_TransientProcess.hxx>
+
+#include <gtest/gtest.h>
+
+TEST(Transfer_TransientProcess_Test, MergeSubProcesses)
+{
+  occ::handle<Standard_Transient> anEnts[4];
+  for (int anEntIter = 0; anEntIter < 4; ++anEntIter)
+  {
+    anEnts[anEntIter] = new Standard_Transient();
+  }
+
+  occ::handle<Transfer_TransientProcess> aMainTP = new Transfer_TransientProcess();
+  aMainTP->SetTraceLevel(0);
+  aMainTP->AddFail(anEnts[0], "Failed before");
+
+  // sub-processes are filled independently, as if by parallel threads
+  occ::handle<Transfer_TransientProcess> aSubTP1 = aMainTP->NewSubProcess();
+  occ::handle<Transfer_TransientProcess> aSubTP2 = aMainTP->NewSubProcess();
+  EXPECT_EQ(0, aSubTP1->NbMapped());
+  aSubTP1->BindTransient(anEnts[1], new TCollection_HAsciiString("Result1"));
+  aSubTP1->SetRoot(anEnts[1]);
+  aSubTP1->RootsForTransfer()->Append(anEnts[1]);
+  aSubTP2->BindTransient(anEnts[0], new TCollection_HAsciiString("Result0"));
+  aSubTP2->SetRoot(anEnts[0]);
+  aSubTP2->BindTransient(anEnts[1], new TCollection_HAsciiString("Result1Bis"));
+  aSubTP2->AddWarning(anEnts[1], "Bound twice");
+  aSubTP2->BindTransient(anEnts[2], new TCollection_HAsciiString("Result2"));
+  aSubTP2->SetRoot(anEnts[2]);
+
+  aMainTP->Merge(aSubTP1);
+  aMainTP->Merge(aSubTP2);
+
+  // bindings keep the order of the main process and then the order of merging
+  ASSERT_EQ(3, aMainTP->NbMapped());
+  EXPECT_EQ(anEnts[0], aMainTP->Mapped(1));
+  EXPECT_EQ(anEnts[1], aMainTP->Mapped(2));
+  EXPECT_EQ(anEnts[2], aMainTP->Mapped(3));
+  EXPECT_FALSE(aMainTP->IsBound(anEnts[3]));
+
+  // binder without result is replaced, keeping its check
+  EXPECT_TRUE(aMainTP->Find(anEnts[0])->HasResult());
+  EXPECT_TRUE(aMainTP->Check(anEnts[0])->HasFailed());
+
+  // binder with result is kept, taking only the check of another one
+  occ::handle<TCollection_HAsciiString> aResult1 =
+    occ::down_cast<TCollection_HAsciiString>(aMainTP->FindTransient(anEnts[1]));
+  ASSERT_FALSE(aResult1.IsNull());
+  EXPECT_STREQ("Result1", aResult1->ToCString());
+  EXPECT_TRUE(aMainTP->Check(anEnts[1])->HasWarnings());
+
+  ASSERT_EQ(3, aMainTP->NbRoots());
+  EXPECT_EQ(anEnts[1], aMainTP->Root(1));
+  EXPECT_EQ(anEnts[0], aMainTP->Root(2));
+  EXPECT_EQ(anEnts[2], aMainTP->Root(3));
+  EXPECT_EQ(1, aMainTP->RootsForTransfer()->Length());
+}
@@ -25,6 +25,8 @@ set(OCCT_Interface_FILES
   Interface_DataState.hxx
   Interface_EntityCluster.cxx
   Interface_EntityCluster.hxx
+  Interface_EntityGraph.cxx
+  Interface_EntityGraph.hxx
   Interface_EntityIterator.cxx
   Interface_EntityIterator.hxx
   Interface_EntityList.cxx
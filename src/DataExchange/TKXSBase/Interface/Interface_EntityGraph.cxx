@@ -0,0 +1,118 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <Interface_EntityGraph.hxx>
+
+#include <Standard_OutOfRange.hxx>
+#include <Standard_ProgramError.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(Interface_EntityGraph, Standard_Transient)
+
+namespace
+{
+//! Size of blocks of the vector of shared entities.
+static const int THE_SHAREDS_BLOCK_SIZE = 65536;
+} // namespace
+
+//=================================================================================================
+
+Interface_EntityGraph::Interface_EntityGraph(const int theNbEntities)
+    : mySharedOffsets(1, theNbEntities + 1),
+      myShareds(THE_SHAREDS_BLOCK_SIZE),
+      mySharingOffsets(1, theNbEntities + 1),
+      myNbEntities(theNbEntities),
+      myLastEntity(0),
+      myIsBuilt(false)
+{
+  mySharedOffsets.Init(0);
+}
+
+//=================================================================================================
+
+void Interface_EntityGraph::AddShared(const int theEntity, const int theShared)
+{
+  if (myIsBuilt || theEntity < myLastEntity)
+  {
+    throw Standard_ProgramError("Interface_EntityGraph::AddShared(), wrong order of entities");
+  }
+  if (theEntity < 1 || theEntity > myNbEntities || theShared < 1 || theShared > myNbEntities)
+  {
+    throw Standard_OutOfRange("Interface_EntityGraph::AddShared(), entity out of range");
+  }
+
+  // close lists of entities skipped since the last call
+  for (; myLastEntity < theEntity; ++myLastEntity)
+  {
+    mySharedOffsets.ChangeValue(myLastEntity + 1) = myShareds.Length();
+  }
+  myShareds.Append(theShared);
+}
+
+//=================================================================================================
+
+void Interface_EntityGraph::SetShareError(const int theEntity)
+{
+  myShareErrors.Add(theEntity);
+}
+
+//=================================================================================================
+
+void Interface_EntityGraph::Build()
+{
+  if (myIsBuilt)
+  {
+    return;
+  }
+  for (; myLastEntity < myNbEntities; ++myLastEntity)
+  {
+    mySharedOffsets.ChangeValue(myLastEntity + 1) = myShareds.Length();
+  }
+  mySharedOffsets.ChangeValue(myNbEntities + 1) = myShareds.Length();
+
+  // count references to each entity, then turn counters into offsets
+  mySharingOffsets.Init(0);
+  for (NCollection_Vector<int>::Iterator aSharedIter(myShareds); aSharedIter.More();
+       aSharedIter.Next())
+  {
+    ++mySharingOffsets.ChangeValue(aSharedIter.Value());
+  }
+  int anOffset = 0;
+  for (int anEntity = 1; anEntity <= myNbEntities + 1; ++anEntity)
+  {
+    const int aNbSharings                  = mySharingOffsets.Value(anEntity);
+    mySharingOffsets.ChangeValue(anEntity) = anOffset;
+    anOffset += aNbSharings;
+  }
+
+  // fill lists in order of sharing entities, shifting offsets by one list on the way
+  if (anOffset > 0)
+  {
+    mySharings.Resize(0, anOffset - 1, false);
+  }
+  for (int anEntity = 1; anEntity <= myNbEntities; ++anEntity)
+  {
+    for (int aRefIter = mySharedOffsets.Value(anEntity);
+         aRefIter < mySharedOffsets.Value(anEntity + 1);
+         ++aRefIter)
+    {
+      int& aSharingOffset = mySharingOffsets.ChangeValue(myShareds.Value(aRefIter));
+      mySharings.ChangeValue(aSharingOffset++) = anEntity;
+    }
+  }
+  for (int anEntity = myNbEntities; anEntity >= 1; --anEntity)
+  {
+    mySharingOffsets.ChangeValue(anEntity + 1) = mySharingOffsets.Value(anEntity);
+  }
+  mySharingOffsets.ChangeValue(1) = 0;
+  myIsBuilt                       = true;
+}
@@ -0,0 +1,115 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _Interface_EntityGraph_HeaderFile
+#define _Interface_EntityGraph_HeaderFile
+
+#include <NCollection_Array1.hxx>
+#include <NCollection_Map.hxx>
+#include <NCollection_Vector.hxx>
+#include <Standard_Transient.hxx>
+
+//! Compact table of references between entities of a model,
+//! entities being identified by their numbers in the model (from 1 to NbEntities()).
+//!
+//! Lists of entities shared by each entity and lists of entities sharing each entity
+//! are stored in compressed sparse row layout: all lists of the same kind are packed
+//! into a single array of entity numbers, addressed by an array of offsets per entity.
+//! This takes an integer per reference in each direction instead of a list node per reference.
+//!
+//! The table is filled entity by entity in increasing order of their numbers,
+//! and lists of sharing entities are computed in a single pass by Build():
+//! @code
+//!   occ::handle<Interface_EntityGraph> aGraph = new Interface_EntityGraph(aNbEntities);
+//!   for (int anEntity = 1; anEntity <= aNbEntities; ++anEntity)
+//!   {
+//!     aGraph->AddShared(anEntity, ...); // for each entity referenced by anEntity
+//!   }
+//!   aGraph->Build();
+//! @endcode
+//! Lists of sharing entities are sorted by increasing entity number
+//! and contain an entity as many times as it references the shared one.
+class Interface_EntityGraph : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(Interface_EntityGraph, Standard_Transient)
+public:
+  //! Creates an empty table for the given number of entities.
+  Standard_EXPORT Interface_EntityGraph(const int theNbEntities);
+
+  //! Returns the number of entities.
+  int NbEntities() const { return myNbEntities; }
+
+  //! Returns the total number of references.
+  int NbReferences() const { return myShareds.Length(); }
+
+  //! Returns TRUE if Build() has been called.
+  bool IsBuilt() const { return myIsBuilt; }
+
+  //! Appends an entity to the list of entities shared by another one.
+  //! Lists should be filled in non-decreasing order of sharing entities and before Build().
+  //! @param[in] theEntity number of the sharing entity
+  //! @param[in] theShared number of the shared entity
+  Standard_EXPORT void AddShared(const int theEntity, const int theShared);
+
+  //! Marks an entity as referencing entities unknown in the model.
+  Standard_EXPORT void SetShareError(const int theEntity);
+
+  //! Finalizes lists of shared entities and computes lists of sharing entities.
+  Standard_EXPORT void Build();
+
+  //! Returns the number of entities shared by an entity.
+  int NbShareds(const int theEntity) const
+  {
+    return mySharedOffsets.Value(theEntity + 1) - mySharedOffsets.Value(theEntity);
+  }
+
+  //! Returns an entity shared by another one.
+  //! @param[in] theEntity number of the sharing entity
+  //! @param[in] theIndex  index within the list, from 1 to NbShareds()
+  int Shared(const int theEntity, const int theIndex) const
+  {
+    return myShareds.Value(mySharedOffsets.Value(theEntity) + theIndex - 1);
+  }
+
+  //! Returns the number of entities sharing an entity; requires Build().
+  int NbSharings(const int theEntity) const
+  {
+    return mySharingOffsets.Value(theEntity + 1) - mySharingOffsets.Value(theEntity);
+  }
+
+  //! Returns an entity sharing another one; requires Build().
+  //! @param[in] theEntity number of the shared entity
+  //! @param[in] theIndex  index within the list, from 1 to NbSharings()
+  int Sharing(const int theEntity, const int theIndex) const
+  {
+    return mySharings.Value(mySharingOffsets.Value(theEntity) + theIndex - 1);
+  }
+
+  //! Returns TRUE if an entity references entities unknown in the model.
+  bool HasShareError(const int theEntity) const { return myShareErrors.Contains(theEntity); }
+
+  //! Returns numbers of entities referencing entities unknown in the model.
+  const NCollection_Map<int>& ShareErrors() const { return myShareErrors; }
+
+private:
+  NCollection_Array1<int> mySharedOffsets;  //!< offsets of lists of shared entities
+  NCollection_Vector<int> myShareds;        //!< packed lists of shared entities
+  NCollection_Array1<int> mySharingOffsets; //!< offsets of lists of sharing entities
+  NCollection_Array1<int> mySharings;       //!< packed lists of sharing entities
+  NCollection_Map<int>    myShareErrors;    //!< entities referencing unknown entities
+  int                     myNbEntities;     //!< number of entities
+  int                     myLastEntity;     //!< last entity filled by AddShared()
+  bool                    myIsBuilt;        //!< flag indicating that Build() has been called
+};
+
+#endif // _Interface_EntityGraph_HeaderFile
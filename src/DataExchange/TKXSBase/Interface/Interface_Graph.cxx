@@ -89,7 +89,7 @@ Interface_Graph::Interface_Graph(const Interface_Graph& agraph, const bool /*cop
     : themodel(agraph.Model()),
       thepresents("")
 {
-  thesharings = agraph.SharingTable();
+  theentgraph = agraph.EntityGraph();
   int nb      = agraph.NbStatuses();
   if (!nb)
     return;
@@ -104,7 +104,8 @@ Interface_Graph& Interface_Graph::operator=(const Interface_Graph& theOther)
 {
   themodel    = theOther.Model();
   thepresents = theOther.thepresents;
-  thesharings = theOther.SharingTable();
+  theentgraph = theOther.EntityGraph();
+  thesharings.Nullify();
   thestats.Nullify();
 
   const int nb = theOther.NbStatuses();
@@ -134,6 +135,18 @@ int Interface_Graph::NbStatuses() const
 
 const occ::handle<NCollection_HArray1<NCollection_List<int>>>& Interface_Graph::SharingTable() const
 {
+  if (thesharings.IsNull() && !theentgraph.IsNull())
+  {
+    thesharings = new NCollection_HArray1<NCollection_List<int>>(1, theentgraph->NbEntities());
+    for (int anEntity = 1; anEntity <= theentgraph->NbEntities(); ++anEntity)
+    {
+      NCollection_List<int>& aSharings = thesharings->ChangeValue(anEntity);
+      for (int aSharingIter = 1; aSharingIter <= theentgraph->NbSharings(anEntity); ++aSharingIter)
+      {
+        aSharings.Append(theentgraph->Sharing(anEntity, aSharingIter));
+      }
+    }
+  }
   return thesharings;
 }
 
@@ -141,29 +154,37 @@ void Interface_Graph::Evaluate()
 {
   // Evaluation is performed on all entities of the model
   const int anEntityNumber = Size();
-
-  // Global allocator stored as a field of the single container of the sharings
-  // and will be destructed with the container.
-  occ::handle<NCollection_IncAllocator> anAlloc =
-    new NCollection_IncAllocator(NCollection_IncAllocator::THE_DEFAULT_BLOCK_SIZE);
-  thesharings = new NCollection_HArray1<NCollection_List<int>>(1, anEntityNumber);
-  NCollection_Array1<NCollection_List<int>>& aSharingArrayOfLists = thesharings->ChangeArray1();
-  for (int i = 1; i <= anEntityNumber; i++)
+  thesharings.Nullify();
+  if (themodel->GTool().IsNull())
   {
-    aSharingArrayOfLists(i).Clear(anAlloc);
+    theentgraph = new Interface_EntityGraph(anEntityNumber);
+    theentgraph->Build();
+    return;
   }
 
-  if (themodel->GTool().IsNull())
+  // Table precomputed by the file reader for the current content of the model
+  const occ::handle<Interface_EntityGraph>& aModelGraph = themodel->EntityGraph();
+  if (!aModelGraph.IsNull() && aModelGraph->IsBuilt()
+      && aModelGraph->NbEntities() == anEntityNumber)
   {
+    theentgraph = aModelGraph;
+    if (!thestats.IsNull())
+    {
+      for (NCollection_Map<int>::Iterator anErrIter(theentgraph->ShareErrors()); anErrIter.More();
+           anErrIter.Next())
+      {
+        theflags.SetTrue(anErrIter.Key(), Graph_ShareError);
+      }
+    }
     return;
   }
 
-  // Fill the sharing table with the entities shared by each entity
-  // and the entities which share each entity.
+  // Fill the table with the entities shared by each entity,
+  // the entities which share each entity are deduced by Build().
   // The entities are iterated in the order of their numbers in the model.
-  // The entities which are not present in the model are ignored.
-  // The entities which are not shared by any other entity are ignored.
+  // The shared entities which are not present in the model are ignored.
   // Allocator is used to reuse memory for the lists of shared entities.
+  theentgraph = new Interface_EntityGraph(anEntityNumber);
   occ::handle<NCollection_IncAllocator> anAlloc2 =
     new NCollection_IncAllocator(NCollection_IncAllocator::THE_MINIMUM_BLOCK_SIZE);
   occ::handle<NCollection_HSequence<occ::handle<Standard_Transient>>> aListOfEntities =
@@ -203,15 +224,17 @@ void Interface_Graph::Evaluate()
 
       if (aShareNum == 0)
       {
+        theentgraph->SetShareError(i);
         if (!thestats.IsNull())
         {
           theflags.SetTrue(i, Graph_ShareError);
         }
         continue;
       }
-      aSharingArrayOfLists(aShareNum).Append(i);
+      theentgraph->AddShared(i, aShareNum);
     }
   }
+  theentgraph->Build();
 }
 
 //  ....                Construction from another Graph                ....
@@ -502,14 +525,13 @@ occ::handle<NCollection_HSequence<occ::handle<Standard_Transient>>> Interface_Gr
   int num = EntityNumber(ent);
   if (!num)
     return nullptr;
-  // return
-  // occ::down_cast<NCollection_HSequence<occ::handle<Standard_Transient>>>(thesharings->Value(num));
-  const NCollection_List<int>& alist = thesharings->Value(num);
   occ::handle<NCollection_HSequence<occ::handle<Standard_Transient>>> aSharings =
     new NCollection_HSequence<occ::handle<Standard_Transient>>;
-  NCollection_List<int>::Iterator aIt(alist);
-  for (; aIt.More(); aIt.Next())
-    aSharings->Append(Entity(aIt.Value()));
+  if (num > theentgraph->NbEntities())
+    return aSharings;
+  const int aNbSharings = theentgraph->NbSharings(num);
+  for (int aSharingIter = 1; aSharingIter <= aNbSharings; ++aSharingIter)
+    aSharings->Append(Entity(theentgraph->Sharing(num, aSharingIter)));
   return aSharings;
 }
 
@@ -556,10 +578,10 @@ Interface_EntityIterator Interface_Graph::TypedSharings(
 Interface_EntityIterator Interface_Graph::RootEntities() const
 {
   Interface_EntityIterator iter;
-  int                      nb = thesharings->Length();
+  int                      nb = theentgraph->NbEntities();
   for (int i = 1; i <= nb; i++)
   {
-    if (!thesharings->Value(i).IsEmpty())
+    if (theentgraph->NbSharings(i) != 0)
       continue;
     iter.AddItem(Entity(i));
   }
@@ -22,6 +22,7 @@
 #include <Standard_Handle.hxx>
 
 #include <Interface_BitMap.hxx>
+#include <Interface_EntityGraph.hxx>
 #include <Interface_InterfaceModel.hxx>
 
 #include <TCollection_HAsciiString.hxx>
@@ -57,7 +58,9 @@ class Interface_EntityIterator;
 //! Also, it is bound with two lists : a list of Shared
 //! Entities (in fact, their Numbers in the Model) which is
 //! filled by a ShareTool, and a list of Sharing Entities,
-//! computed by deduction from the Shared Lists
+//! computed by deduction from the Shared Lists.
+//! Both lists are stored in a compact Interface_EntityGraph,
+//! which may be precomputed by the file reader (see Interface_InterfaceModel::EntityGraph())
 //!
 //! Moreover, it is possible to redefine the list of Entities
 //! Shared by an Entity (instead of standard answer by general
@@ -250,8 +253,12 @@ public:
   Standard_EXPORT occ::handle<TCollection_HAsciiString> Name(
     const occ::handle<Standard_Transient>& ent) const;
 
-  //! Returns the Table of Sharing lists. Used to Create
-  //! another Graph from <me>
+  //! Returns the table of references between entities of the Model.
+  //! Used to Create another Graph from <me>
+  const occ::handle<Interface_EntityGraph>& EntityGraph() const { return theentgraph; }
+
+  //! Returns the Table of Sharing lists, computed on first call from EntityGraph().
+  Standard_DEPRECATED("Deprecated method, EntityGraph() should be used instead")
   Standard_EXPORT const occ::handle<NCollection_HArray1<NCollection_List<int>>>& SharingTable()
     const;
 
@@ -262,10 +269,11 @@ protected:
   //! Initialize statuses and flags
   Standard_EXPORT void InitStats();
 
-  occ::handle<Interface_InterfaceModel>                   themodel;
-  TCollection_AsciiString                                 thepresents;
-  occ::handle<NCollection_HArray1<int>>                   thestats;
-  occ::handle<NCollection_HArray1<NCollection_List<int>>> thesharings;
+  occ::handle<Interface_InterfaceModel>                           themodel;
+  TCollection_AsciiString                                         thepresents;
+  occ::handle<NCollection_HArray1<int>>                           thestats;
+  occ::handle<Interface_EntityGraph>                              theentgraph;
+  mutable occ::handle<NCollection_HArray1<NCollection_List<int>>> thesharings;
 
 private:
   //! Performs the Evaluation of the Graph, from an initial Library,
@@ -18,6 +18,7 @@
 
 #include <Interface_Check.hxx>
 #include <Interface_CheckIterator.hxx>
+#include <Interface_EntityGraph.hxx>
 #include <Interface_EntityIterator.hxx>
 #include <Interface_GeneralModule.hxx>
 #include <Interface_GTool.hxx>
@@ -108,6 +109,13 @@ occ::handle<Interface_GTool> Interface_InterfaceModel::GTool() const
 
 //=================================================================================================
 
+void Interface_InterfaceModel::SetEntityGraph(const occ::handle<Interface_EntityGraph>& theGraph)
+{
+  theentgraph = theGraph;
+}
+
+//=================================================================================================
+
 void Interface_InterfaceModel::Clear()
 {
   ClearEntities();
@@ -129,6 +137,7 @@ bool& Interface_InterfaceModel::DispatchStatus()
 
 void Interface_InterfaceModel::ClearEntities()
 {
+  theentgraph.Nullify();
   thereports.Clear();
   therepch.Clear();
   haschecksem = false;
@@ -332,6 +341,7 @@ bool Interface_InterfaceModel::IsRedefinedContent(const int num) const
 
 bool Interface_InterfaceModel::ClearReportEntity(const int num)
 {
+  theentgraph.Nullify();
   if (!thereports.IsBound(num))
     return false;
   thereports.UnBind(num);
@@ -343,6 +353,7 @@ bool Interface_InterfaceModel::ClearReportEntity(const int num)
 bool Interface_InterfaceModel::SetReportEntity(const int                                  num,
                                                const occ::handle<Interface_ReportEntity>& rep)
 {
+  theentgraph.Nullify();
   int                             nm = num;
   occ::handle<Standard_Transient> ent;
   if (num > 0)
@@ -381,6 +392,7 @@ bool Interface_InterfaceModel::SetReportEntity(const int
 bool Interface_InterfaceModel::AddReportEntity(const occ::handle<Interface_ReportEntity>& rep,
                                                const bool                                 semantic)
 {
+  theentgraph.Nullify();
   if (rep.IsNull())
     return false;
   occ::handle<Standard_Transient> ent = rep->Concerned();
@@ -493,6 +505,7 @@ void Interface_InterfaceModel::Reservate(const int nbent)
 
 void Interface_InterfaceModel::AddEntity(const occ::handle<Standard_Transient>& anentity)
 {
+  theentgraph.Nullify();
   // int newnum; svv #2
   if (!anentity->IsKind(typerep()))
     theentities.Add(anentity);
@@ -582,6 +595,7 @@ void Interface_InterfaceModel::AddWithRefs(const occ::handle<Standard_Transient>
 void Interface_InterfaceModel::ReplaceEntity(const int                              nument,
                                              const occ::handle<Standard_Transient>& anent)
 {
+  theentgraph.Nullify();
   theentities.Substitute(nument, anent);
 }
 
@@ -593,6 +607,7 @@ void Interface_InterfaceModel::ReplaceEntity(const int
 
 void Interface_InterfaceModel::ReverseOrders(const int after)
 {
+  theentgraph.Nullify();
   int nb = NbEntities(); // int num; svv #2
   if (nb < 2 || after >= nb)
     return;
@@ -635,6 +650,7 @@ void Interface_InterfaceModel::ChangeOrder(
   const int newnum,
   const int cnt) // szv#4:S4163:12Mar99 `count` hid one from this
 {
+  theentgraph.Nullify();
   int nb = NbEntities();
   int i; //, num; svv #2
   if (nb < 2 || newnum >= nb || cnt <= 0)
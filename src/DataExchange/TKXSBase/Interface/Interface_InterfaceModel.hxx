@@ -35,6 +35,7 @@ class Interface_ReportEntity;
 class Interface_CheckIterator;
 class Interface_GeneralLib;
 class Interface_EntityIterator;
+class Interface_EntityGraph;
 
 //! Defines an (Indexed) Set of data corresponding to a complete
 //! Transfer by a File Interface, i.e. File Header and Transient
@@ -412,6 +413,14 @@ public:
   Standard_EXPORT static occ::handle<NCollection_HSequence<occ::handle<TCollection_HAsciiString>>>
     ListTemplates();
 
+  //! Returns the table of references between entities precomputed for the current content
+  //! of the Model (e.g. by the file reader) to be used by Interface_Graph, or NULL.
+  //! The table is reset by any change of the list of entities or of their reports.
+  const occ::handle<Interface_EntityGraph>& EntityGraph() const { return theentgraph; }
+
+  //! Sets the table of references between entities precomputed for the current content.
+  Standard_EXPORT void SetEntityGraph(const occ::handle<Interface_EntityGraph>& theGraph);
+
   DEFINE_STANDARD_RTTIEXT(Interface_InterfaceModel, Standard_Transient)
 
 protected:
@@ -428,6 +437,7 @@ private:
   bool                                                      isdispatch;
   occ::handle<TCollection_HAsciiString>                     thecategory;
   occ::handle<Interface_GTool>                              thegtool;
+  occ::handle<Interface_EntityGraph>                        theentgraph;
 };
 
 #endif // _Interface_InterfaceModel_HeaderFile
@@ -69,6 +69,15 @@ public:
   //! determined). Acts only if <nb> is greater than actual NbMapped
   Standard_EXPORT void Resize(const int nb);
 
+  //! Merges bindings and roots recorded by another process into this one.
+  //! Intended to collect results of independent transfers performed in parallel threads,
+  //! each one by its own process, which are then merged in a fixed order
+  //! to get a reproducible result.
+  //! Objects not bound yet take the Binder of <theOther>; a Binder without result
+  //! (pre-binding or VoidBinder bringing a check) is replaced by a Binder with result,
+  //! otherwise only check messages are added. Roots of <theOther> are declared as roots.
+  Standard_EXPORT virtual void Merge(const occ::handle<Transfer_ProcessForTransient>& theOther);
+
   //! Defines an Actor, which is used for automatic Transfer
   //! If already defined, the new Actor is cumulated
   //! (see SetNext from Actor)
@@ -144,6 +144,62 @@ void Transfer_ProcessForTransient::Resize(const int nb)
 
 //=================================================================================================
 
+void Transfer_ProcessForTransient::Merge(const occ::handle<Transfer_ProcessForTransient>& theOther)
+{
+  if (theOther.IsNull() || theOther.get() == this)
+  {
+    return;
+  }
+
+  for (int anIndex = 1; anIndex <= theOther->themap.Extent(); ++anIndex)
+  {
+    const occ::handle<Transfer_Binder>& aBinder = theOther->themap.FindFromIndex(anIndex);
+    if (aBinder.IsNull())
+    {
+      continue;
+    }
+
+    const occ::handle<Standard_Transient>& aStart       = theOther->themap.FindKey(anIndex);
+    const int                              aFormerIndex = themap.FindIndex(aStart);
+    if (aFormerIndex == 0)
+    {
+      themap.Add(aStart, aBinder);
+      continue;
+    }
+
+    occ::handle<Transfer_Binder>& aFormer = themap.ChangeFromIndex(aFormerIndex);
+    if (aFormer.IsNull())
+    {
+      aFormer = aBinder;
+    }
+    else if (aFormer != aBinder)
+    {
+      if (!aFormer->HasResult() && aBinder->HasResult())
+      {
+        aBinder->Merge(aFormer);
+        aFormer = aBinder;
+      }
+      else
+      {
+        aFormer->CCheck()->GetMessages(aBinder->Check());
+      }
+    }
+  }
+
+  for (int aRootIter = 1; aRootIter <= theOther->theroots.Extent(); ++aRootIter)
+  {
+    const int anOtherIndex = theOther->theroots.FindKey(aRootIter);
+    theroots.Add(themap.FindIndex(theOther->themap.FindKey(anOtherIndex)));
+  }
+
+  // binders might have been replaced
+  thelastobj.Nullify();
+  thelastbnd.Nullify();
+  theindex = 0;
+}
+
+//=================================================================================================
+
 void Transfer_ProcessForTransient::SetActor(
   const occ::handle<Transfer_ActorOfProcessForTransient>& actor)
 {
@@ -16,10 +16,12 @@
 #include <Interface_HGraph.hxx>
 #include <Interface_InterfaceModel.hxx>
 #include <Interface_MSG.hxx>
+#include <Message_Messenger.hxx>
 #include <Standard_Transient.hxx>
 #include <Standard_Type.hxx>
 #include <NCollection_Sequence.hxx>
 #include <NCollection_HSequence.hxx>
+#include <Transfer_ActorOfProcessForTransient.hxx>
 #include <Transfer_TransientProcess.hxx>
 
 IMPLEMENT_STANDARD_RTTIEXT(Transfer_TransientProcess, Transfer_ProcessForTransient)
@@ -235,3 +237,39 @@ occ::handle<NCollection_HSequence<occ::handle<Standard_Transient>>> Transfer_Tra
 {
   return thetrroots;
 }
+
+//=================================================================================================
+
+occ::handle<Transfer_TransientProcess> Transfer_TransientProcess::NewSubProcess() const
+{
+  occ::handle<Transfer_TransientProcess> aSubProcess = new Transfer_TransientProcess();
+  aSubProcess->SetMessenger(Messenger());
+  aSubProcess->SetTraceLevel(TraceLevel());
+  aSubProcess->SetErrorHandle(ErrorHandle());
+  aSubProcess->SetActor(Actor());
+  aSubProcess->themodel = themodel;
+  aSubProcess->thegraph = thegraph;
+  aSubProcess->thectx   = thectx;
+  return aSubProcess;
+}
+
+//=================================================================================================
+
+void Transfer_TransientProcess::Merge(const occ::handle<Transfer_ProcessForTransient>& theOther)
+{
+  Transfer_ProcessForTransient::Merge(theOther);
+  occ::handle<Transfer_TransientProcess> anOther =
+    occ::down_cast<Transfer_TransientProcess>(theOther);
+  if (anOther.IsNull() || anOther.get() == this)
+  {
+    return;
+  }
+
+  for (NCollection_HSequence<occ::handle<Standard_Transient>>::Iterator aRootIter(
+         *anOther->thetrroots);
+       aRootIter.More();
+       aRootIter.Next())
+  {
+    thetrroots->Append(aRootIter.Value());
+  }
+}
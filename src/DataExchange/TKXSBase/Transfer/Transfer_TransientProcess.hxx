@@ -113,6 +113,18 @@ public:
   Standard_EXPORT occ::handle<NCollection_HSequence<occ::handle<Standard_Transient>>>
                   RootsForTransfer();
 
+  //! Creates a process for transfers performed within a separate thread.
+  //! The new process shares the model, graph, contexts, actor and message settings
+  //! of this one, but records bindings, checks and roots in its own map,
+  //! so that concurrent threads do not modify common data.
+  //! Results should be then collected by Merge() in a fixed order of sub-processes.
+  //! Note that the actor should support concurrent calls to be shared in this way.
+  Standard_EXPORT occ::handle<Transfer_TransientProcess> NewSubProcess() const;
+
+  //! Merges bindings and roots of another process (see Transfer_ProcessForTransient::Merge())
+  //! and, if <theOther> is a TransientProcess, its roots for transfer.
+  Standard_EXPORT void Merge(const occ::handle<Transfer_ProcessForTransient>& theOther) override;
+
   DEFINE_STANDARD_RTTIEXT(Transfer_TransientProcess, Transfer_ProcessForTransient)
 
 private:
@@ -195,7 +195,7 @@ public:
   //! Translates all translatable
   //! roots and returns the number of successful translations.
   //! Warning - This function clears existing output shapes first.
-  Standard_EXPORT int TransferRoots(
+  Standard_EXPORT virtual int TransferRoots(
     const Message_ProgressRange& theProgress = Message_ProgressRange());
 
   //! Clears the list of shapes that
@@ -348,11 +348,11 @@ private:
   //! @return the Actor for the Transfer of an Entity. May be nullptr.
   occ::handle<Transfer_ActorOfTransientProcess> GetActor() const;
 
+protected:
   //! If parameters haven't yet been provided, initializes them with default values
   //! provided by GetDefaultShapeFixParameters() method.
-  void InitializeMissingParameters();
+  Standard_EXPORT void InitializeMissingParameters();
 
-protected:
   bool                                                  therootsta;
   NCollection_Sequence<occ::handle<Standard_Transient>> theroots;
 
@@ -30,12 +30,14 @@
 #include <Standard_Transient.hxx>
 #include <Standard_Type.hxx>
 #include <TCollection_HAsciiString.hxx>
+#include <NCollection_Array1.hxx>
 #include <NCollection_Sequence.hxx>
 #include <NCollection_HSequence.hxx>
 #include <TopoDS_HShape.hxx>
 #include <TopoDS_Shape.hxx>
 #include <TopTools_ShapeMapHasher.hxx>
 #include <NCollection_Map.hxx>
+#include <OSD_Parallel.hxx>
 #include <Transfer_ActorOfTransientProcess.hxx>
 #include <Transfer_IteratorOfProcessForTransient.hxx>
 #include <Transfer_ResultFromModel.hxx>
@@ -148,17 +150,17 @@ void XSControl_TransferReader::Clear(const int mode)
 
 //=================================================================================================
 
-bool XSControl_TransferReader::RecordResult(const occ::handle<Standard_Transient>& ent)
+namespace
+{
+//! Makes the final result of transferring an entity, taken from the TransientProcess.
+//! Only reads the TransientProcess, so that it can be called from parallel threads.
+occ::handle<Transfer_ResultFromModel> makeResult(
+  const occ::handle<Transfer_TransientProcess>& theTP,
+  const occ::handle<Standard_Transient>&        theEnt,
+  const TCollection_AsciiString&                theFileName)
 {
-  if (myModel.IsNull() || myTP.IsNull())
-    return false;
-  int num = myModel->Number(ent);
-  if (num == 0)
-    return false;
-  occ::handle<TCollection_HAsciiString> lab = myModel->StringLabel(ent);
-
   occ::handle<Transfer_ResultFromModel> res = new Transfer_ResultFromModel;
-  res->Fill(myTP, ent);
+  res->Fill(theTP, theEnt);
 
   //   Case of Shape result : for main result, make HShape ...
   occ::handle<Transfer_Binder> binder = res->MainResult()->Binder();
@@ -171,13 +173,73 @@ bool XSControl_TransferReader::RecordResult(const occ::handle<Standard_Transient
     res->MainResult()->SetBinder(trb);
   }
 
-  res->SetFileName(myFileName.ToCString());
-  myResults.Bind(num, res);
+  res->SetFileName(theFileName.ToCString());
+  return res;
+}
+} // namespace
+
+//=================================================================================================
+
+bool XSControl_TransferReader::RecordResult(const occ::handle<Standard_Transient>& ent)
+{
+  if (myModel.IsNull() || myTP.IsNull())
+    return false;
+  int num = myModel->Number(ent);
+  if (num == 0)
+    return false;
+
+  myResults.Bind(num, makeResult(myTP, ent, myFileName));
   return true;
 }
 
 //=================================================================================================
 
+int XSControl_TransferReader::RecordResults(
+  const NCollection_Sequence<occ::handle<Standard_Transient>>& theEnts,
+  const bool                                                   theToParallel)
+{
+  if (myModel.IsNull() || myTP.IsNull() || theEnts.IsEmpty())
+    return 0;
+
+  // sequence is not suitable for concurrent access by index
+  NCollection_Array1<occ::handle<Standard_Transient>> anEnts(1, theEnts.Length());
+  int                                                 anEntIndex = 1;
+  for (NCollection_Sequence<occ::handle<Standard_Transient>>::Iterator anEntIter(theEnts);
+       anEntIter.More();
+       anEntIter.Next(), ++anEntIndex)
+  {
+    anEnts.SetValue(anEntIndex, anEntIter.Value());
+  }
+
+  NCollection_Array1<occ::handle<Transfer_ResultFromModel>> aResults(1, anEnts.Length());
+  OSD_Parallel::For(
+    1,
+    anEnts.Length() + 1,
+    [&](const int theIndex) {
+      const occ::handle<Standard_Transient>& anEnt = anEnts.Value(theIndex);
+      if (myModel->Number(anEnt) != 0)
+      {
+        aResults.ChangeValue(theIndex) = makeResult(myTP, anEnt, myFileName);
+      }
+    },
+    !theToParallel);
+
+  // results are recorded in a fixed order
+  int aNbRecorded = 0;
+  for (int anIndex = 1; anIndex <= anEnts.Length(); ++anIndex)
+  {
+    const occ::handle<Transfer_ResultFromModel>& aResult = aResults.Value(anIndex);
+    if (!aResult.IsNull())
+    {
+      myResults.Bind(myModel->Number(anEnts.Value(anIndex)), aResult);
+      ++aNbRecorded;
+    }
+  }
+  return aNbRecorded;
+}
+
+//=================================================================================================
+
 bool XSControl_TransferReader::IsRecorded(const occ::handle<Standard_Transient>& ent) const
 {
   if (myModel.IsNull())
@@ -951,7 +1013,8 @@ int XSControl_TransferReader::TransferRoots(const Interface_Graph&       G,
     return -1;
 
   //  The transferred entities are noted as "asmain"
-  int i, n = myTP->NbMapped();
+  NCollection_Sequence<occ::handle<Standard_Transient>> ents;
+  int                                                   i, n = myTP->NbMapped();
   for (i = 1; i <= n; i++)
   {
     occ::handle<Standard_Transient> ent = myTP->Mapped(i);
@@ -960,8 +1023,9 @@ int XSControl_TransferReader::TransferRoots(const Interface_Graph&       G,
       continue;
     if (!bnd->HasResult())
       continue;
-    RecordResult(ent);
+    ents.Append(ent);
   }
+  RecordResults(ents, myToParallel);
 
   //  Result ... we carefully note the Shapes
   myShapeResult = TransferBRep::Shapes(myTP, true);
@@ -138,6 +138,21 @@ public:
   //! Returns True if a result is available, False else
   Standard_EXPORT bool RecordResult(const occ::handle<Standard_Transient>& theEnt);
 
+  //! Records final results of transferring a list of entities, as RecordResult() does.
+  //! With <theToParallel>, results are prepared by parallel threads reading the
+  //! TransientProcess, and then recorded sequentially in the order of the list.
+  //! Returns the count of recorded results
+  Standard_EXPORT int RecordResults(
+    const NCollection_Sequence<occ::handle<Standard_Transient>>& theEnts,
+    const bool                                                   theToParallel);
+
+  //! Returns True if results of TransferRoots() are recorded by parallel threads;
+  //! FALSE by default.
+  bool ToParallel() const { return myToParallel; }
+
+  //! Sets if results of TransferRoots() should be recorded by parallel threads.
+  void SetParallel(const bool theToParallel) { myToParallel = theToParallel; }
+
   //! Returns True if a final result is recorded for an entity
   //! Remark that it can bring no effective result if transfer has
   //! completely failed (FinalResult brings only fail messages ...)
@@ -386,6 +401,8 @@ private:
   occ::handle<Transfer_TransientProcess>                                        myTP;
   NCollection_DataMap<int, occ::handle<Standard_Transient>>                     myResults;
   occ::handle<NCollection_HSequence<TopoDS_Shape>>                              myShapeResult;
+
+  bool myToParallel = false; //!< record results of TransferRoots() in parallel threads
 };
 
 #endif // _XSControl_TransferReader_HeaderFile
@@ -47,6 +47,9 @@ public:
                              XmlObjMgt_Persistent&             Target,
                              XmlObjMgt_SRelocationTable&       RelocTable) const override;
 
+  //! Returns TRUE as the shapes are read from the shape section of the document.
+  bool IsShapeSectionDependent() const override { return true; }
+
   //! Translate a non storable Location to a storable Location.
   Standard_EXPORT void Translate(const TopLoc_Location&      theLoc,
                                  XmlObjMgt_Element&          theParent,
@@ -29,6 +29,7 @@
 #include <OSD_Parallel.hxx>
 #include <OSD_PerfMeter.hxx>
 #include <OSD_ThreadPool.hxx>
+#include <OSD_Tracer.hxx>
 #include <Standard_Macro.hxx>
 #include <Standard_SStream.hxx>
 #include <iostream>
@@ -384,6 +385,16 @@ static int dversion(Draw_Interpretor& di, int, const char**)
 #else
   di << "Draco disabled\n";
 #endif
+#ifdef HAVE_MESHOPTIMIZER
+  di << "meshoptimizer enabled (HAVE_MESHOPTIMIZER)\n";
+#else
+  di << "meshoptimizer disabled\n";
+#endif
+#ifdef HAVE_ZSTD
+  di << "Zstd enabled (HAVE_ZSTD)\n";
+#else
+  di << "Zstd disabled\n";
+#endif
 #ifdef HAVE_VTK
   di << "VTK enabled (HAVE_VTK)\n";
 #else
@@ -721,11 +732,20 @@ static int dmeminfo(Draw_Interpretor& theDI, int theArgNb, const char** theArgVe
   }
 
   NCollection_Map<OSD_MemInfo::Counter> aCounters;
+  bool                                  toPrintTags = false, toResetPeaks = false;
   for (int anIter = 1; anIter < theArgNb; ++anIter)
   {
     TCollection_AsciiString anArg(theArgVec[anIter]);
     anArg.LowerCase();
-    if (anArg == "virt" || anArg == "v")
+    if (anArg == "tags" || anArg == "-tags")
+    {
+      toPrintTags = true;
+    }
+    else if (anArg == "-resetpeaks")
+    {
+      toResetPeaks = true;
+    }
+    else if (anArg == "virt" || anArg == "v")
     {
       aCounters.Add(OSD_MemInfo::MemVirtual);
     }
@@ -753,6 +773,14 @@ static int dmeminfo(Draw_Interpretor& theDI, int theArgNb, const char** theArgVe
     {
       aCounters.Add(OSD_MemInfo::MemPrivate);
     }
+    else if (anArg == "thread")
+    {
+      aCounters.Add(OSD_MemInfo::MemThreadUsage);
+    }
+    else if (anArg == "threadcache")
+    {
+      aCounters.Add(OSD_MemInfo::MemThreadCache);
+    }
     else
     {
       theDI << "Syntax error at '" << theArgVec[anIter] << "'!\n";
@@ -760,6 +788,19 @@ static int dmeminfo(Draw_Interpretor& theDI, int theArgNb, const char** theArgVe
     }
   }
 
+  if (toPrintTags)
+  {
+    theDI << OSD_MemInfo::PrintTaggedMemory();
+  }
+  if (toResetPeaks)
+  {
+    OSD_MemInfo::ResetTaggedMemoryPeaks();
+  }
+  if (aCounters.IsEmpty())
+  {
+    return 0;
+  }
+
   OSD_MemInfo aMemInfo(false);
   aMemInfo.SetActive(false);
   for (NCollection_Map<OSD_MemInfo::Counter>::Iterator aCountersIt(aCounters); aCountersIt.More();
@@ -861,6 +902,55 @@ static int dperf(Draw_Interpretor& theDI, int theArgNb, const char** theArgVec)
 
 //=================================================================================================
 
+static int dtrace(Draw_Interpretor& theDI, int theArgNb, const char** theArgVec)
+{
+  if (theArgNb <= 1)
+  {
+    theDI << "Enabled:    " << (OSD_Tracer::IsEnabled() ? 1 : 0) << "\n"
+          << "BufferSize: " << OSD_Tracer::BufferSize() << "\n"
+          << "NbZones:    " << OSD_Tracer::NbZones();
+    return 0;
+  }
+
+  for (int anIter = 1; anIter < theArgNb; ++anIter)
+  {
+    TCollection_AsciiString anArg(theArgVec[anIter]);
+    anArg.LowerCase();
+    if (anArg == "-enable" || anArg == "-on")
+    {
+      OSD_Tracer::SetEnabled(true);
+    }
+    else if (anArg == "-disable" || anArg == "-off")
+    {
+      OSD_Tracer::SetEnabled(false);
+    }
+    else if (anArg == "-clear" || anArg == "-reset")
+    {
+      OSD_Tracer::Clear();
+    }
+    else if (anIter + 1 < theArgNb && (anArg == "-buffersize" || anArg == "-buffer"))
+    {
+      OSD_Tracer::SetBufferSize(Draw::Atoi(theArgVec[++anIter]));
+    }
+    else if (anIter + 1 < theArgNb && anArg == "-dump")
+    {
+      if (!OSD_Tracer::DumpChromeTrace(TCollection_AsciiString(theArgVec[++anIter])))
+      {
+        Message::SendFail() << "Error: unable to write trace into '" << theArgVec[anIter] << "'";
+        return 1;
+      }
+    }
+    else
+    {
+      Message::SendFail() << "Syntax error: unknown argument '" << anArg << "'";
+      return 1;
+    }
+  }
+  return 0;
+}
+
+//=================================================================================================
+
 static int dsetsignal(Draw_Interpretor& theDI, int theArgNb, const char** theArgVec)
 {
   OSD_SignalMode aMode     = OSD_SignalMode_Set;
@@ -1200,7 +1290,11 @@ void Draw::BasicCommands(Draw_Interpretor& theCommands)
   theCommands.Add("dchrono", aChronoHelp, __FILE__, dchronom, g);
   theCommands.Add("meminfo",
                   "meminfo [virt|v] [heap|h] [wset|w] [wsetpeak] [swap] [swappeak] [private]"
-                  " : memory counters for this process",
+                  " [thread] [threadcache]"
+                  " : memory counters for this process"
+                  "\n\t\t: meminfo [-tags] [-resetPeaks]"
+                  "\n\t\t: memory accounted per subsystem (current and peak values);"
+                  "\n\t\t: -resetPeaks resets the peaks to the current values",
                   __FILE__,
                   dmeminfo,
                   g);
@@ -1209,6 +1303,17 @@ void Draw::BasicCommands(Draw_Interpretor& theCommands)
                   __FILE__,
                   dperf,
                   g);
+  theCommands.Add("dtrace",
+                  "dtrace [-enable|-disable] [-clear] [-bufferSize NbZones] [-dump File]"
+                  "\n\t\t: Manages collecting of traced zones of algorithms:"
+                  "\n\t\t:   -enable/-disable switch collecting on or off"
+                  "\n\t\t:   -clear           discard collected zones"
+                  "\n\t\t:   -bufferSize      number of zones kept per thread"
+                  "\n\t\t:   -dump            write zones into file in Chrome trace format"
+                  "\n\t\t:                    (chrome://tracing or https://ui.perfetto.dev)",
+                  __FILE__,
+                  dtrace,
+                  g);
   theCommands.Add("dsetsignal",
                   "dsetsignal [{asIs|set|unhandled|unset}=set] [{0|1|default=$CSF_FPE}]"
                   "\n\t\t:            [-strackTraceLength Length]"
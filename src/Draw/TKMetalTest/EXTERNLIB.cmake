@@ -0,0 +1,16 @@
+# External dependencies for TKMetalTest
+set(OCCT_TKMetalTest_EXTERNAL_LIBS
+  TKernel
+  TKMath
+  TKG2d
+  TKG3d
+  TKGeomBase
+  TKBRep
+  TKTopAlgo
+  TKDraw
+  TKMetal
+  TKService
+  TKV3d
+  TKViewerTest
+  CSF_objc
+)
@@ -0,0 +1,7 @@
+# Source files for TKMetalTest
+set(OCCT_TKMetalTest_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
+
+set(OCCT_TKMetalTest_FILES
+  EXTERNLIB
+  PACKAGES
+)
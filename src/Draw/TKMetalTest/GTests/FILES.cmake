@@ -0,0 +1,5 @@
+# Test source files for TKMetalTest
+set(OCCT_TKMetalTest_GTests_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
+
+set(OCCT_TKMetalTest_GTests_FILES
+)
@@ -0,0 +1,8 @@
+# Source files for MetalTest package
+set(OCCT_MetalTest_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
+
+set(OCCT_MetalTest_FILES
+  MetalTest.cxx
+  MetalTest.hxx
+  MetalTest_Commands.mm
+)
@@ -0,0 +1,1527 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#import <Metal/Metal.h>
+
+#include <MetalTest.hxx>
+
+#include <Draw.hxx>
+#include <Draw_Interpretor.hxx>
+
+#include <Metal_BSplineGridEval.hxx>
+#include <Metal_BSplineSurface.hxx>
+#include <Metal_BVHOverlap.hxx>
+#include <Metal_BufferAllocator.hxx>
+#include <Metal_Context.hxx>
+#include <Metal_FrameStats.hxx>
+#include <Metal_GraphicDriver.hxx>
+#include <Metal_GraphicDriverFactory.hxx>
+#include <Metal_Group.hxx>
+#include <Metal_HiddenLineAlgo.hxx>
+#include <Metal_ResidencyManager.hxx>
+#include <Metal_ShaderManager.hxx>
+#include <Metal_StagingRing.hxx>
+#include <Metal_TessellationController.hxx>
+#include <Metal_View.hxx>
+
+#include <AIS_InteractiveObject.hxx>
+#include <BRep_Tool.hxx>
+#include <BRepTools.hxx>
+#include <BRepTools_WireExplorer.hxx>
+#include <Bnd_Box.hxx>
+#include <BRepExtrema_OverlapBackend.hxx>
+#include <BRepExtrema_ShapeProximity.hxx>
+#include <DBRep.hxx>
+#include <Geom_BSplineSurface.hxx>
+#include <Geom_BezierSurface.hxx>
+#include <Geom_Plane.hxx>
+#include <Geom_RectangularTrimmedSurface.hxx>
+#include <Geom2d_Curve.hxx>
+#include <GeomGridEval_BSplineSurface.hxx>
+#include <GeomGridEval_BSplineSurfaceBackend.hxx>
+#include <GeomConvert.hxx>
+#include <Message.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_Sequence.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_Timer.hxx>
+#include <Prs3d_Presentation.hxx>
+#include <Prs3d_ShadingAspect.hxx>
+#include <Select3D_SensitiveBox.hxx>
+#include <SelectMgr_EntityOwner.hxx>
+#include <SelectMgr_Selection.hxx>
+#include <TCollection_AsciiString.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Face.hxx>
+#include <V3d_View.hxx>
+
+#include <ViewerTest.hxx>
+#include <ViewerTest_AutoUpdater.hxx>
+
+#include <algorithm>
+
+static occ::handle<Metal_Caps> getDefaultCaps()
+{
+  occ::handle<Metal_GraphicDriverFactory> aFactory = occ::down_cast<Metal_GraphicDriverFactory>(
+    Graphic3d_GraphicDriverFactory::DefaultDriverFactory());
+  if (aFactory.IsNull())
+  {
+    for (NCollection_List<occ::handle<Graphic3d_GraphicDriverFactory>>::Iterator aFactoryIter(
+           Graphic3d_GraphicDriverFactory::DriverFactories());
+         aFactoryIter.More();
+         aFactoryIter.Next())
+    {
+      aFactory = occ::down_cast<Metal_GraphicDriverFactory>(aFactoryIter.Value());
+      if (!aFactory.IsNull())
+      {
+        break;
+      }
+    }
+  }
+  if (aFactory.IsNull())
+  {
+    throw Standard_ProgramError("Error: no Metal_GraphicDriverFactory registered");
+  }
+  return aFactory->DefaultOptions();
+}
+
+namespace
+{
+  static const size_t THE_MIB = 1024 * 1024;
+
+  //! Return Metal driver of active viewer or NULL.
+  static occ::handle<Metal_GraphicDriver> activeDriver()
+  {
+    occ::handle<AIS_InteractiveContext> aContext = ViewerTest::GetAISContext();
+    if (aContext.IsNull())
+    {
+      return occ::handle<Metal_GraphicDriver>();
+    }
+    return occ::down_cast<Metal_GraphicDriver>(aContext->CurrentViewer()->Driver());
+  }
+
+  //! Format memory size in MiB.
+  static TCollection_AsciiString formatMiB(size_t theBytes)
+  {
+    char aBuffer[64];
+    snprintf(aBuffer, sizeof(aBuffer), "%.2f MiB", double(theBytes) / double(THE_MIB));
+    return TCollection_AsciiString(aBuffer);
+  }
+
+  //! Return percentile of sorted array of samples.
+  static double percentile(const NCollection_Array1<double>& theSorted, double thePercent)
+  {
+    if (theSorted.IsEmpty())
+    {
+      return 0.0;
+    }
+    const int anIndex = std::min(theSorted.Upper(),
+                                 theSorted.Lower() + int(thePercent * 0.01 * double(theSorted.Length() - 1) + 0.5));
+    return theSorted.Value(anIndex);
+  }
+
+  //! Parse size in MiB following the option.
+  static bool parseMiB(int theArgNb, const char** theArgVec, int& theArgIter, size_t& theValue)
+  {
+    if (theArgIter + 1 >= theArgNb)
+    {
+      return false;
+    }
+    const TCollection_AsciiString aStr(theArgVec[theArgIter + 1]);
+    if (!aStr.IsIntegerValue() || aStr.IntegerValue() < 0)
+    {
+      return false;
+    }
+    theValue = size_t(aStr.IntegerValue()) * THE_MIB;
+    ++theArgIter;
+    return true;
+  }
+
+  //! Parse non-negative integer following the option.
+  static bool parseInteger(int theArgNb, const char** theArgVec, int& theArgIter, int& theValue)
+  {
+    if (theArgIter + 1 >= theArgNb)
+    {
+      return false;
+    }
+    const TCollection_AsciiString aStr(theArgVec[theArgIter + 1]);
+    if (!aStr.IsIntegerValue() || aStr.IntegerValue() < 0)
+    {
+      return false;
+    }
+    theValue = aStr.IntegerValue();
+    ++theArgIter;
+    return true;
+  }
+}
+
+//=================================================================================================
+
+static int VMetalCaps(Draw_Interpretor& theDI, int theArgNb, const char** theArgVec)
+{
+  Metal_Caps*                      aCaps   = getDefaultCaps().get();
+  occ::handle<Metal_GraphicDriver> aDriver = activeDriver();
+  if (!aDriver.IsNull())
+  {
+    aCaps = &aDriver->ChangeOptions();
+  }
+
+  if (theArgNb < 2)
+  {
+    theDI << "FramesInFlight: " << aCaps->maxFramesInFlight << "\n";
+    theDI << "LowLatency: " << (aCaps->lowLatencyPacing ? "1" : "0") << "\n";
+    theDI << "ArgumentBuffers: " << (aCaps->useArgumentBuffers ? "1" : "0") << "\n";
+    theDI << "PrivateVertexBuffers: " << (aCaps->usePrivateVertexBuffers ? "1" : "0") << "\n";
+    theDI << "TransferQueue: " << (aCaps->useTransferQueue ? "1" : "0") << "\n";
+    theDI << "ZeroCopyArrays: " << (aCaps->useZeroCopyArrays ? "1" : "0") << "\n";
+    theDI << "QuantizedVertices: " << (aCaps->useQuantizedVertices ? "1" : "0") << "\n";
+    theDI << "Memoryless: " << (aCaps->useMemorylessAttachments ? "1" : "0") << "\n";
+    theDI << "IndirectCommands: " << (aCaps->useIndirectCommandBuffers ? "1" : "0") << "\n";
+    theDI << "MeshShaders: " << (aCaps->useMeshShaders ? "1" : "0") << "\n";
+    theDI << "GpuCulling: " << (aCaps->useGpuCulling ? "1" : "0") << "\n";
+    theDI << "ParallelEncoding: " << (aCaps->useParallelEncoding ? "1" : "0") << " (from "
+          << aCaps->parallelEncodingMinStructures << " structures)\n";
+    theDI << "SortedDrawList: " << (aCaps->useSortedDrawList ? "1" : "0") << "\n";
+    theDI << "AutoInstancing: " << (aCaps->useAutoInstancing ? "1" : "0") << "\n";
+    theDI << "AsyncPipelines: " << (aCaps->asyncPipelineCompilation ? "1" : "0") << "\n";
+    theDI << "HeapBlockSize: " << formatMiB(aCaps->bufferHeapBlockSize) << "\n";
+    theDI << "Residency: " << (aCaps->useResidencyManager ? "1" : "0") << "\n";
+    theDI << "MemoryBudget: "
+          << (aCaps->gpuMemoryBudget != 0 ? formatMiB(aCaps->gpuMemoryBudget) : TCollection_AsciiString("auto"))
+          << "\n";
+    theDI << "StreamedTextureMinSize: " << aCaps->streamedTextureMinSize << "\n";
+    theDI << "StreamedTextureBudget: " << formatMiB(aCaps->streamedTextureBudget) << "\n";
+    theDI << "PointCloudMinPoints: " << aCaps->pointCloudMinPoints << "\n";
+    theDI << "PointCloudBudget: " << formatMiB(aCaps->pointCloudBudget) << "\n";
+    theDI << "PointCloudError: " << aCaps->pointCloudPixelError << "\n";
+    theDI << "PointCloudCompute: " << (aCaps->usePointCloudCompute ? "1" : "0") << "\n";
+    return 0;
+  }
+
+  ViewerTest_AutoUpdater anUpdateTool(ViewerTest::GetAISContext(), ViewerTest::CurrentView());
+  for (int anArgIter = 1; anArgIter < theArgNb; ++anArgIter)
+  {
+    const char*             anArg = theArgVec[anArgIter];
+    TCollection_AsciiString anArgCase(anArg);
+    anArgCase.LowerCase();
+    if (anUpdateTool.parseRedrawMode(anArg))
+    {
+      continue;
+    }
+    else if (anArgCase == "-framesinflight")
+    {
+      int aNbFrames = 0;
+      if (!parseInteger(theArgNb, theArgVec, anArgIter, aNbFrames) || aNbFrames < 1)
+      {
+        Message::SendFail() << "Syntax error at '" << anArg << "'";
+        return 1;
+      }
+      aCaps->maxFramesInFlight = aNbFrames;
+    }
+    else if (anArgCase == "-lowlatency" || anArgCase == "-nolowlatency")
+    {
+      aCaps->lowLatencyPacing = Draw::ParseOnOffNoIterator(theArgNb, theArgVec, anArgIter);
+    }
+    else if (anArgCase == "-argumentbuffers" || anArgCase == "-noargumentbuffers")
+    {
+      aCaps->useArgumentBuffers = Draw::ParseOnOffNoIterator(theArgNb, theArgVec, anArgIter);
+    }
+    else if (anArgCase == "-privatebuffers" || anArgCase == "-noprivatebuffers")
+    {
+      aCaps->usePrivateVertexBuffers = Draw::ParseOnOffNoIterator(theArgNb, theArgVec, anArgIter);
+    }
+    else if (anArgCase == "-transferqueue" || anArgCase == "-notransferqueue")
+    {
+      aCaps->useTransferQueue = Draw::ParseOnOffNoIterator(theArgNb, theArgVec, anArgIter);
+    }
+    else if (anArgCase == "-zerocopy" || anArgCase == "-nozerocopy")
+    {
+      aCaps->useZeroCopyArrays = Draw::ParseOnOffNoIterator(theArgNb, theArgVec, anArgIter);
+    }
+    else if (anArgCase == "-quantized" || anArgCase == "-quantizedvertices")
+    {
+      aCaps->useQuantizedVertices = Draw::ParseOnOffNoIterator(theArgNb, theArgVec, anArgIter);
+    }
+    else if (anArgCase == "-memoryless" || anArgCase == "-nomemoryless")
+    {
+      aCaps->useMemorylessAttachments = Draw::ParseOnOffNoIterator(theArgNb, theArgVec, anArgIter);
+    }
+    else if (anArgCase == "-indirect" || anArgCase == "-noindirect")
+    {
+      aCaps->useIndirectCommandBuffers = Draw::ParseOnOffNoIterator(theArgNb, theArgVec, anArgIter);
+    }
+    else if (anArgCase == "-meshshaders" || anArgCase == "-nomeshshaders")
+    {
+      aCaps->useMeshShaders = Draw::ParseOnOffNoIterator(theArgNb, theArgVec, anArgIter);
+    }
+    else if (anArgCase == "-gpuculling" || anArgCase == "-nogpuculling")
+    {
+      aCaps->useGpuCulling = Draw::ParseOnOffNoIterator(theArgNb, theArgVec, anArgIter);
+    }
+    else if (anArgCase == "-parallel" || anArgCase == "-noparallel"
+          || anArgCase == "-parallelencoding" || anArgCase == "-noparallelencoding")
+    {
+      aCaps->useParallelEncoding = Draw::ParseOnOffNoIterator(theArgNb, theArgVec, anArgIter);
+    }
+    else if (anArgCase == "-parallelmin" || anArgCase == "-parallelminstructures")
+    {
+      if (!parseInteger(theArgNb, theArgVec, anArgIter, aCaps->parallelEncodingMinStructures))
+      {
+        Message::SendFail() << "Syntax error at '" << anArg << "'";
+        return 1;
+      }
+    }
+    else if (anArgCase == "-sorted" || anArgCase == "-nosorted"
+          || anArgCase == "-sorteddrawlist" || anArgCase == "-nosorteddrawlist")
+    {
+      aCaps->useSortedDrawList = Draw::ParseOnOffNoIterator(theArgNb, theArgVec, anArgIter);
+    }
+    else if (anArgCase == "-autoinstancing" || anArgCase == "-noautoinstancing")
+    {
+      aCaps->useAutoInstancing = Draw::ParseOnOffNoIterator(theArgNb, theArgVec, anArgIter);
+    }
+    else if (anArgCase == "-asyncpipelines" || anArgCase == "-noasyncpipelines")
+    {
+      aCaps->asyncPipelineCompilation = Draw::ParseOnOffNoIterator(theArgNb, theArgVec, anArgIter);
+    }
+    else if (anArgCase == "-heapblocksize")
+    {
+      if (!parseMiB(theArgNb, theArgVec, anArgIter, aCaps->bufferHeapBlockSize))
+      {
+        Message::SendFail() << "Syntax error at '" << anArg << "'";
+        return 1;
+      }
+    }
+    else if (anArgCase == "-residency" || anArgCase == "-noresidency")
+    {
+      aCaps->useResidencyManager = Draw::ParseOnOffNoIterator(theArgNb, theArgVec, anArgIter);
+    }
+    else if (anArgCase == "-memorybudget" || anArgCase == "-budget")
+    {
+      if (!parseMiB(theArgNb, theArgVec, anArgIter, aCaps->gpuMemoryBudget))
+      {
+        Message::SendFail() << "Syntax error at '" << anArg << "'";
+        return 1;
+      }
+      if (!aDriver.IsNull()
+       && !aDriver->GetSharedContext().IsNull()
+       && !aDriver->GetSharedContext()->ResidencyManager().IsNull()
+       && aCaps->gpuMemoryBudget != 0)
+      {
+        aDriver->GetSharedContext()->ResidencyManager()->SetBudget(aCaps->gpuMemoryBudget);
+      }
+    }
+    else if (anArgCase == "-streamedminsize" || anArgCase == "-streamedtextureminsize")
+    {
+      if (!parseInteger(theArgNb, theArgVec, anArgIter, aCaps->streamedTextureMinSize))
+      {
+        Message::SendFail() << "Syntax error at '" << anArg << "'";
+        return 1;
+      }
+    }
+    else if (anArgCase == "-streamedbudget" || anArgCase == "-streamedtexturebudget")
+    {
+      if (!parseMiB(theArgNb, theArgVec, anArgIter, aCaps->streamedTextureBudget))
+      {
+        Message::SendFail() << "Syntax error at '" << anArg << "'";
+        return 1;
+      }
+    }
+    else if (anArgCase == "-pointcloudminpoints" || anArgCase == "-pointcloudmin")
+    {
+      if (!parseInteger(theArgNb, theArgVec, anArgIter, aCaps->pointCloudMinPoints))
+      {
+        Message::SendFail() << "Syntax error at '" << anArg << "'";
+        return 1;
+      }
+    }
+    else if (anArgCase == "-pointcloudbudget")
+    {
+      if (!parseMiB(theArgNb, theArgVec, anArgIter, aCaps->pointCloudBudget))
+      {
+        Message::SendFail() << "Syntax error at '" << anArg << "'";
+        return 1;
+      }
+    }
+    else if (anArgCase == "-pointclouderror")
+    {
+      const TCollection_AsciiString aStr(anArgIter + 1 < theArgNb ? theArgVec[anArgIter + 1] : "");
+      if (!aStr.IsRealValue(true) || aStr.RealValue() <= 0.0)
+      {
+        Message::SendFail() << "Syntax error at '" << anArg << "'";
+        return 1;
+      }
+      aCaps->pointCloudPixelError = (float)aStr.RealValue();
+      ++anArgIter;
+    }
+    else if (anArgCase == "-pointcloudcompute" || anArgCase == "-nopointcloudcompute")
+    {
+      aCaps->usePointCloudCompute = Draw::ParseOnOffNoIterator(theArgNb, theArgVec, anArgIter);
+    }
+    else
+    {
+      Message::SendFail() << "Error: unknown argument '" << anArg << "'";
+      return 1;
+    }
+  }
+  if (aCaps != getDefaultCaps().get())
+  {
+    *getDefaultCaps() = *aCaps;
+  }
+  return 0;
+}
+
+//=================================================================================================
+
+static int VMetalStats(Draw_Interpretor& theDI, int theArgNb, const char** theArgVec)
+{
+  occ::handle<Metal_GraphicDriver> aDriver = activeDriver();
+  if (aDriver.IsNull() || aDriver->GetSharedContext().IsNull())
+  {
+    Message::SendFail() << "Error: no active Metal viewer";
+    return 1;
+  }
+
+  bool toReset = false;
+  for (int anArgIter = 1; anArgIter < theArgNb; ++anArgIter)
+  {
+    TCollection_AsciiString anArgCase(theArgVec[anArgIter]);
+    anArgCase.LowerCase();
+    if (anArgCase == "-reset")
+    {
+      toReset = true;
+    }
+    else
+    {
+      Message::SendFail() << "Error: unknown argument '" << theArgVec[anArgIter] << "'";
+      return 1;
+    }
+  }
+
+  const occ::handle<Metal_Context>& aCtx = aDriver->GetSharedContext();
+  Metal_ShaderManager*              aShaderMgr = aCtx->ShaderManager();
+  if (toReset)
+  {
+    if (aShaderMgr != nullptr)
+    {
+      aShaderMgr->ResetPipelineCacheStats();
+    }
+    return 0;
+  }
+
+  theDI << "Device: " << aCtx->DeviceName() << "\n";
+
+  // textures and render targets are not tracked individually,
+  // so that they are estimated as device allocation not covered by buffer heaps
+  const size_t aDeviceBytes = aCtx->Device() != nil ? size_t([aCtx->Device() currentAllocatedSize]) : 0;
+  size_t aBufferBytes = 0;
+  theDI << "Device memory: " << formatMiB(aDeviceBytes) << "\n";
+  if (!aCtx->BufferAllocator().IsNull())
+  {
+    const Metal_BufferAllocator::Statistics aStats = aCtx->BufferAllocator()->Stats();
+    aBufferBytes = aStats.AllocatedBytes;
+    theDI << "Buffer heaps: " << formatMiB(aStats.AllocatedBytes) << " (" << aStats.NbBlocks
+          << " blocks, " << aStats.NbDedicated << " dedicated)\n";
+    theDI << "  live: " << formatMiB(aStats.LiveBytes) << ", wasted: " << formatMiB(aStats.WastedBytes)
+          << ", free: " << formatMiB(aStats.FreeBytes) << "\n";
+    theDI << "  allocations: " << aStats.NbAllocations << ", zero-copy: " << aStats.NbAdopted
+          << " (" << formatMiB(aStats.AdoptedBytes) << ")\n";
+  }
+  theDI << "Textures and targets: "
+        << formatMiB(aDeviceBytes > aBufferBytes ? aDeviceBytes - aBufferBytes : 0) << "\n";
+  if (!aCtx->StagingRing().IsNull())
+  {
+    theDI << "Staging ring: " << formatMiB(aCtx->StagingRing()->UsedBytes()) << " in use\n";
+  }
+  if (!aCtx->ResidencyManager().IsNull())
+  {
+    const occ::handle<Metal_ResidencyManager>& aResMgr = aCtx->ResidencyManager();
+    theDI << "Residency: " << aResMgr->NbStructures() << " structures, budget "
+          << formatMiB(aResMgr->Budget()) << ", evicted " << aResMgr->NbEvicted() << " ("
+          << formatMiB(aResMgr->EvictedBytes()) << ")\n";
+  }
+
+  if (aShaderMgr != nullptr)
+  {
+    const size_t aNbHits   = aShaderMgr->NbPipelineCacheHits();
+    const size_t aNbMisses = aShaderMgr->NbPipelineCacheMisses();
+    const size_t aNbTotal  = aNbHits + aNbMisses;
+    char         aBuffer[128];
+    snprintf(aBuffer, sizeof(aBuffer), "%.1f%%",
+             aNbTotal != 0 ? 100.0 * double(aNbHits) / double(aNbTotal) : 100.0);
+    theDI << "Pipeline cache: " << int(aNbHits) << " hits, " << int(aNbMisses) << " misses ("
+          << int(aShaderMgr->NbPipelineArchiveHits()) << " from archive), hit rate " << aBuffer << "\n";
+  }
+
+  // GPU time of individual passes, measured only with counters sampling support
+  static const struct
+  {
+    Graphic3d_FrameStatsTimer Timer;
+    const char*               Name;
+  } THE_GPU_PASSES[] =
+  {
+    { Graphic3d_FrameStatsTimer_GpuFrame,        "Frame" },
+    { Graphic3d_FrameStatsTimer_GpuMainPass,     "Main pass" },
+    { Graphic3d_FrameStatsTimer_GpuShadowMap,    "Shadow maps" },
+    { Graphic3d_FrameStatsTimer_GpuOit,          "OIT" },
+    { Graphic3d_FrameStatsTimer_GpuDepthPeeling, "Depth peeling" },
+    { Graphic3d_FrameStatsTimer_GpuPostProcess,  "Post-process" },
+    { Graphic3d_FrameStatsTimer_GpuRayTracing,   "Ray tracing" },
+  };
+  const occ::handle<Metal_FrameStats>& aFrameStats = aCtx->FrameStats();
+  if (!aFrameStats.IsNull() && aFrameStats->GpuPassTime(Graphic3d_FrameStatsTimer_GpuFrame) > 0.0)
+  {
+    theDI << "GPU time:\n";
+    for (const auto& aPass : THE_GPU_PASSES)
+    {
+      const double aPassTime = aFrameStats->GpuPassTime(aPass.Timer);
+      if (aPassTime > 0.0)
+      {
+        char aBuffer[128];
+        snprintf(aBuffer, sizeof(aBuffer), "  %s: %.3f ms\n", aPass.Name, aPassTime * 1000.0);
+        theDI << aBuffer;
+      }
+    }
+  }
+  else
+  {
+    char aBuffer[128];
+    snprintf(aBuffer, sizeof(aBuffer), "GPU frame: %.3f ms (enable 'vrenderparams -perfCounters frameTime' for passes)\n",
+             aCtx->LastGpuFrameTime() * 1000.0);
+    theDI << aBuffer;
+  }
+  return 0;
+}
+
+//=================================================================================================
+
+static int VMetalCapture(Draw_Interpretor& theDI, int theArgNb, const char** theArgVec)
+{
+  occ::handle<Metal_GraphicDriver> aDriver = activeDriver();
+  if (aDriver.IsNull() || aDriver->GetSharedContext().IsNull())
+  {
+    Message::SendFail() << "Error: no active Metal viewer";
+    return 1;
+  }
+
+  const occ::handle<Metal_Context>& aCtx = aDriver->GetSharedContext();
+  if (theArgNb < 2)
+  {
+    theDI << "Capturing: " << (aCtx->IsCapturing() ? "1" : "0") << "\n";
+    return 0;
+  }
+
+  TCollection_AsciiString aFilePath;
+  int  aNbFrames = 1;
+  bool toStop    = false;
+  for (int anArgIter = 1; anArgIter < theArgNb; ++anArgIter)
+  {
+    TCollection_AsciiString anArgCase(theArgVec[anArgIter]);
+    anArgCase.LowerCase();
+    if (anArgCase == "-stop"
+     || anArgCase == "-end")
+    {
+      toStop = true;
+    }
+    else if (anArgCase == "-frames"
+          && anArgIter + 1 < theArgNb)
+    {
+      aNbFrames = Draw::Atoi(theArgVec[++anArgIter]);
+    }
+    else if (aFilePath.IsEmpty()
+          && anArgCase.Value(1) != '-')
+    {
+      aFilePath = theArgVec[anArgIter];
+    }
+    else
+    {
+      Message::SendFail() << "Syntax error at '" << theArgVec[anArgIter] << "'";
+      return 1;
+    }
+  }
+
+  if (toStop)
+  {
+    aCtx->EndCapture();
+    return 0;
+  }
+  if (aFilePath.IsEmpty() || aNbFrames < 0)
+  {
+    Message::SendFail() << "Syntax error: GPU trace file path is expected";
+    return 1;
+  }
+  if (!aCtx->BeginCapture(aFilePath, aNbFrames))
+  {
+    return 1;
+  }
+
+  // capture requested frames of the active view right away
+  const occ::handle<V3d_View>& aView = ViewerTest::CurrentView();
+  for (int aFrameIter = 0; aFrameIter < aNbFrames && !aView.IsNull() && aCtx->IsCapturing(); ++aFrameIter)
+  {
+    aView->Invalidate();
+    aView->Redraw();
+  }
+  return 0;
+}
+
+//=================================================================================================
+
+static int VMetalBench(Draw_Interpretor& theDI, int theArgNb, const char** theArgVec)
+{
+  occ::handle<Metal_GraphicDriver> aDriver = activeDriver();
+  const occ::handle<V3d_View>&     aView   = ViewerTest::CurrentView();
+  if (aDriver.IsNull() || aDriver->GetSharedContext().IsNull() || aView.IsNull())
+  {
+    Message::SendFail() << "Error: no active Metal viewer";
+    return 1;
+  }
+
+  int    aNbFrames = 100;
+  int    aNbWarmup = 10;
+  double anOrbit   = 360.0;
+  for (int anArgIter = 1; anArgIter < theArgNb; ++anArgIter)
+  {
+    TCollection_AsciiString anArgCase(theArgVec[anArgIter]);
+    anArgCase.LowerCase();
+    if ((anArgCase == "-frames" || anArgCase == "-nbframes") && anArgIter + 1 < theArgNb)
+    {
+      aNbFrames = Draw::Atoi(theArgVec[++anArgIter]);
+    }
+    else if (anArgCase == "-warmup" && anArgIter + 1 < theArgNb)
+    {
+      aNbWarmup = Draw::Atoi(theArgVec[++anArgIter]);
+    }
+    else if (anArgCase == "-orbit" && anArgIter + 1 < theArgNb)
+    {
+      anOrbit = Draw::Atof(theArgVec[++anArgIter]);
+    }
+    else
+    {
+      Message::SendFail() << "Syntax error at '" << theArgVec[anArgIter] << "'";
+      return 1;
+    }
+  }
+  if (aNbFrames < 1 || aNbWarmup < 0)
+  {
+    Message::SendFail() << "Syntax error: wrong number of frames";
+    return 1;
+  }
+
+  const occ::handle<Metal_Context>&     aCtx    = aDriver->GetSharedContext();
+  const occ::handle<Graphic3d_Camera>&  aCamera = aView->Camera();
+  const occ::handle<Graphic3d_Camera>   aCameraBack = new Graphic3d_Camera(aCamera);
+
+  // collect GPU time of passes without enabling frame statistics overlay
+  const Graphic3d_RenderingParams::PerfCounters aStatsBack = aView->RenderingParams().CollectedStats;
+  aView->ChangeRenderingParams().CollectedStats =
+    Graphic3d_RenderingParams::PerfCounters(aStatsBack | Graphic3d_RenderingParams::PerfCounters_FrameTime);
+  const int    aNbTotal = aNbWarmup + aNbFrames;
+  const double aStep    = anOrbit * M_PI / 180.0 / double(aNbTotal);
+
+  NCollection_Array1<double> aCpuTimes(0, aNbFrames - 1);
+  NCollection_Array1<double> aGpuTimes(0, aNbFrames - 1);
+  OSD_Timer aTotalTimer, aFrameTimer;
+  for (int aFrameIter = 0; aFrameIter < aNbTotal; ++aFrameIter)
+  {
+    gp_Trsf aRot;
+    aRot.SetRotation(gp_Ax1(aCamera->Center(), aCamera->Up()), aStep);
+    aCamera->Transform(aRot);
+    if (aFrameIter == aNbWarmup)
+    {
+      // let warm-up frames complete before measuring
+      aCtx->CommitAndWait();
+      aTotalTimer.Start();
+    }
+
+    aFrameTimer.Reset();
+    aFrameTimer.Start();
+    aView->Invalidate();
+    aView->Redraw();
+    aFrameTimer.Stop();
+    if (aFrameIter >= aNbWarmup)
+    {
+      // GPU time is reported by completed command buffers and may lag behind by frames in flight
+      aCpuTimes.ChangeValue(aFrameIter - aNbWarmup) = aFrameTimer.ElapsedTime();
+      aGpuTimes.ChangeValue(aFrameIter - aNbWarmup) = aCtx->LastGpuFrameTime();
+    }
+  }
+  aCtx->CommitAndWait();
+  aTotalTimer.Stop();
+
+  aCamera->Copy(aCameraBack);
+  aView->ChangeRenderingParams().CollectedStats = aStatsBack;
+  aView->Invalidate();
+  aView->Redraw();
+
+  std::sort(aCpuTimes.begin(), aCpuTimes.end());
+  std::sort(aGpuTimes.begin(), aGpuTimes.end());
+  const double aTotalTime = aTotalTimer.ElapsedTime();
+  char aBuffer[256];
+  snprintf(aBuffer, sizeof(aBuffer),
+           "Frames: %d in %.3f s\n"
+           "FPS: %.1f\n"
+           "CPU encode: p50 %.3f ms, p90 %.3f ms, p99 %.3f ms\n"
+           "GPU:        p50 %.3f ms, p90 %.3f ms, p99 %.3f ms\n",
+           aNbFrames, aTotalTime,
+           aTotalTime > 0.0 ? double(aNbFrames) / aTotalTime : 0.0,
+           percentile(aCpuTimes, 50.0) * 1000.0, percentile(aCpuTimes, 90.0) * 1000.0,
+           percentile(aCpuTimes, 99.0) * 1000.0,
+           percentile(aGpuTimes, 50.0) * 1000.0, percentile(aGpuTimes, 90.0) * 1000.0,
+           percentile(aGpuTimes, 99.0) * 1000.0);
+  theDI << aBuffer;
+  return 0;
+}
+
+namespace
+{
+  //! Presentation of shape faces drawn as B-spline surfaces tessellated on GPU (see Metal_BSplineSurface).
+  //! Selection is approximated by bounding box of control nets.
+  class MetalTest_BSplinePrs : public AIS_InteractiveObject
+  {
+    DEFINE_STANDARD_RTTI_INLINE(MetalTest_BSplinePrs, AIS_InteractiveObject)
+  public:
+    MetalTest_BSplinePrs(const NCollection_Sequence<occ::handle<Metal_BSplineSurface>>& theSurfaces)
+    : mySurfaces(theSurfaces)
+    {
+      //
+    }
+
+    bool AcceptDisplayMode(const int theMode) const override { return theMode == 0; }
+
+  private:
+    void Compute(const occ::handle<PrsMgr_PresentationManager>& ,
+                 const occ::handle<Prs3d_Presentation>&         thePrs,
+                 const int                                      theMode) override
+    {
+      if (theMode != 0)
+      {
+        return;
+      }
+
+      occ::handle<Metal_Group> aGroup = occ::down_cast<Metal_Group>(thePrs->NewGroup());
+      if (aGroup.IsNull())
+      {
+        Message::SendFail() << "Error: B-spline surfaces can be displayed only by Metal driver";
+        return;
+      }
+      aGroup->SetGroupPrimitivesAspect(myDrawer->ShadingAspect()->Aspect());
+      for (NCollection_Sequence<occ::handle<Metal_BSplineSurface>>::Iterator aSurfIter(mySurfaces);
+           aSurfIter.More(); aSurfIter.Next())
+      {
+        aGroup->AddBSplineSurface(aSurfIter.Value());
+      }
+    }
+
+    void ComputeSelection(const occ::handle<SelectMgr_Selection>& theSelection,
+                          const int theMode) override
+    {
+      if (theMode != 0)
+      {
+        return;
+      }
+
+      Bnd_Box aBox;
+      for (NCollection_Sequence<occ::handle<Metal_BSplineSurface>>::Iterator aSurfIter(mySurfaces);
+           aSurfIter.More(); aSurfIter.Next())
+      {
+        const Graphic3d_BndBox3d& aSurfBox = aSurfIter.Value()->BoundingBox();
+        aBox.Update(aSurfBox.CornerMin().x(), aSurfBox.CornerMin().y(), aSurfBox.CornerMin().z(),
+                    aSurfBox.CornerMax().x(), aSurfBox.CornerMax().y(), aSurfBox.CornerMax().z());
+      }
+      occ::handle<SelectMgr_EntityOwner> anOwner = new SelectMgr_EntityOwner(this);
+      theSelection->Add(new Select3D_SensitiveBox(anOwner, aBox));
+    }
+
+  private:
+    NCollection_Sequence<occ::handle<Metal_BSplineSurface>> mySurfaces;
+  };
+
+  //! Convert face into B-spline surface trimmed by polylines sampled on its pcurves.
+  //! Faces on other than B-spline, Bezier or planar surfaces are not converted,
+  //! as their B-spline representation has another parametrization than pcurves.
+  static occ::handle<Metal_BSplineSurface> convertFace(const TopoDS_Face& theFace, int theNbEdgeSamples)
+  {
+    TopLoc_Location aLoc;
+    occ::handle<Geom_Surface> aSurf = BRep_Tool::Surface(theFace, aLoc);
+    while (occ::handle<Geom_RectangularTrimmedSurface> aTrimmed = occ::down_cast<Geom_RectangularTrimmedSurface>(aSurf))
+    {
+      aSurf = aTrimmed->BasisSurface();
+    }
+    if (aSurf.IsNull())
+    {
+      return occ::handle<Metal_BSplineSurface>();
+    }
+
+    double aUMin = 0.0, aUMax = 0.0, aVMin = 0.0, aVMax = 0.0;
+    BRepTools::UVBounds(theFace, aUMin, aUMax, aVMin, aVMax);
+    occ::handle<Geom_BSplineSurface> aBSpline;
+    if (occ::handle<Geom_BSplineSurface> aSurfBSpline = occ::down_cast<Geom_BSplineSurface>(aSurf))
+    {
+      aBSpline = occ::down_cast<Geom_BSplineSurface>(aSurfBSpline->Copy());
+    }
+    else if (aSurf->IsKind(STANDARD_TYPE(Geom_BezierSurface))
+          || aSurf->IsKind(STANDARD_TYPE(Geom_Plane)))
+    {
+      aBSpline = GeomConvert::SurfaceToBSplineSurface(
+        new Geom_RectangularTrimmedSurface(aSurf, aUMin, aUMax, aVMin, aVMax));
+    }
+    if (aBSpline.IsNull())
+    {
+      return occ::handle<Metal_BSplineSurface>();
+    }
+
+    if (aBSpline->IsUPeriodic())
+    {
+      aBSpline->SetUNotPeriodic();
+    }
+    if (aBSpline->IsVPeriodic())
+    {
+      aBSpline->SetVNotPeriodic();
+    }
+    // keep only spans covered by the face
+    aBSpline->CheckAndSegment(aUMin, aUMax, aVMin, aVMax);
+    if (!aLoc.IsIdentity())
+    {
+      aBSpline->Transform(aLoc.Transformation());
+    }
+
+    occ::handle<Metal_BSplineSurface> aSurface =
+      new Metal_BSplineSurface(aBSpline->UDegree(), aBSpline->VDegree(),
+                               aBSpline->Poles(), aBSpline->Weights(),
+                               aBSpline->UKnotSequence(), aBSpline->VKnotSequence(),
+                               theFace.Orientation() == TopAbs_REVERSED);
+    if (!aSurface->IsValid())
+    {
+      return occ::handle<Metal_BSplineSurface>();
+    }
+
+    for (TopExp_Explorer aWireExp(theFace, TopAbs_WIRE); aWireExp.More(); aWireExp.Next())
+    {
+      NCollection_Vector<gp_Pnt2d> aLoop;
+      for (BRepTools_WireExplorer anEdgeExp(TopoDS::Wire(aWireExp.Current()), theFace); anEdgeExp.More(); anEdgeExp.Next())
+      {
+        const TopoDS_Edge& anEdge = anEdgeExp.Current();
+        double aFirst = 0.0, aLast = 0.0;
+        occ::handle<Geom2d_Curve> aPCurve = BRep_Tool::CurveOnSurface(anEdge, theFace, aFirst, aLast);
+        if (aPCurve.IsNull())
+        {
+          continue;
+        }
+
+        // the last point coincides with the first point of the next edge
+        const bool isReversed = anEdge.Orientation() == TopAbs_REVERSED;
+        for (int aSampleIter = 0; aSampleIter < theNbEdgeSamples; ++aSampleIter)
+        {
+          const double aT = double(aSampleIter) / double(theNbEdgeSamples);
+          aLoop.Append(aPCurve->Value(isReversed ? aLast - (aLast - aFirst) * aT
+                                                 : aFirst + (aLast - aFirst) * aT));
+        }
+      }
+      if (aLoop.Length() < 3)
+      {
+        continue;
+      }
+
+      NCollection_Array1<gp_Pnt2d> aLoopArray(0, aLoop.Length() - 1);
+      for (int aPntIter = 0; aPntIter < aLoop.Length(); ++aPntIter)
+      {
+        aLoopArray.ChangeValue(aPntIter) = aLoop.Value(aPntIter);
+      }
+      aSurface->AddTrimmingLoop(aLoopArray);
+    }
+    return aSurface;
+  }
+}
+
+//=================================================================================================
+
+static int VMetalHiddenLine(Draw_Interpretor& theDI, int theArgNb, const char** theArgVec)
+{
+  const occ::handle<V3d_View>& aView      = ViewerTest::CurrentView();
+  occ::handle<Metal_View>      aMetalView = !aView.IsNull() ? occ::down_cast<Metal_View>(aView->View())
+                                                            : occ::handle<Metal_View>();
+  if (aMetalView.IsNull())
+  {
+    Message::SendFail() << "Error: no active Metal view";
+    return 1;
+  }
+
+  const occ::handle<Metal_HiddenLineAlgo>& anAlgo = aMetalView->HiddenLineAlgo();
+  if (theArgNb < 2)
+  {
+    theDI << "HiddenLineMode: " << (aMetalView->IsHiddenLineMode() ? "1" : "0") << "\n";
+    theDI << "ShowHidden: " << (anAlgo->ToShowHidden() ? "1" : "0") << "\n";
+    theDI << "CreaseAngle: " << anAlgo->CreaseAngle() * 180.0 / M_PI << "\n";
+    theDI << "Dash: " << anAlgo->DashLength() << " " << anAlgo->GapLength() << "\n";
+    theDI << "DrawnEdges: " << anAlgo->NbDrawnEdges() << "\n";
+    return 0;
+  }
+
+  ViewerTest_AutoUpdater anUpdateTool(ViewerTest::GetAISContext(), aView);
+  for (int anArgIter = 1; anArgIter < theArgNb; ++anArgIter)
+  {
+    const char*             anArg = theArgVec[anArgIter];
+    TCollection_AsciiString anArgCase(anArg);
+    anArgCase.LowerCase();
+    bool toEnable = true;
+    if (anUpdateTool.parseRedrawMode(anArg))
+    {
+      continue;
+    }
+    else if (anArgIter == 1 && Draw::ParseOnOff(anArg, toEnable))
+    {
+      aMetalView->SetHiddenLineMode(toEnable);
+    }
+    else if (anArgCase == "-hidden" || anArgCase == "-nohidden")
+    {
+      anAlgo->SetShowHidden(Draw::ParseOnOffNoIterator(theArgNb, theArgVec, anArgIter));
+    }
+    else if (anArgCase == "-crease" && anArgIter + 1 < theArgNb)
+    {
+      const double anAngle = Draw::Atof(theArgVec[++anArgIter]);
+      if (anAngle < 0.0 || anAngle > 180.0)
+      {
+        Message::SendFail() << "Syntax error: crease angle should be within [0, 180] degrees";
+        return 1;
+      }
+      anAlgo->SetCreaseAngle(float(anAngle * M_PI / 180.0));
+    }
+    else if (anArgCase == "-dash" && anArgIter + 2 < theArgNb)
+    {
+      const double aDash = Draw::Atof(theArgVec[anArgIter + 1]);
+      const double aGap  = Draw::Atof(theArgVec[anArgIter + 2]);
+      if (aDash <= 0.0 || aGap < 0.0)
+      {
+        Message::SendFail() << "Syntax error at '" << anArg << "'";
+        return 1;
+      }
+      anAlgo->SetDashPattern(float(aDash), float(aGap));
+      anArgIter += 2;
+    }
+    else if (anArgCase == "-visiblecolor" || anArgCase == "-hiddencolor")
+    {
+      Quantity_ColorRGBA aColor;
+      const int aNbParsed = Draw::ParseColor(theArgNb - anArgIter - 1, theArgVec + anArgIter + 1, aColor);
+      if (aNbParsed == 0)
+      {
+        Message::SendFail() << "Syntax error at '" << anArg << "'";
+        return 1;
+      }
+      anArgIter += aNbParsed;
+      if (anArgCase == "-visiblecolor")
+      {
+        anAlgo->SetVisibleColor(aColor);
+      }
+      else
+      {
+        anAlgo->SetHiddenColor(aColor);
+      }
+    }
+    else
+    {
+      Message::SendFail() << "Syntax error at '" << anArg << "'";
+      return 1;
+    }
+  }
+  aView->Invalidate();
+  return 0;
+}
+
+//=================================================================================================
+
+static int VBSplineSurface(Draw_Interpretor& theDI, int theArgNb, const char** theArgVec)
+{
+  occ::handle<Metal_GraphicDriver> aDriver = activeDriver();
+  if (aDriver.IsNull() || aDriver->GetSharedContext().IsNull())
+  {
+    theDI << "Error: no active Metal viewer";
+    return 1;
+  }
+
+  TCollection_AsciiString aName;
+  TopoDS_Shape aShape;
+  int aNbEdgeSamples = 32;
+  int aTargetEdgeLength = -1;
+  for (int anArgIter = 1; anArgIter < theArgNb; ++anArgIter)
+  {
+    TCollection_AsciiString anArg(theArgVec[anArgIter]);
+    anArg.LowerCase();
+    if (anArg == "-edgesamples")
+    {
+      if (!parseInteger(theArgNb, theArgVec, anArgIter, aNbEdgeSamples)
+        || aNbEdgeSamples < 2)
+      {
+        theDI << "Syntax error at '" << theArgVec[anArgIter] << "'";
+        return 1;
+      }
+    }
+    else if (anArg == "-tessedge")
+    {
+      if (!parseInteger(theArgNb, theArgVec, anArgIter, aTargetEdgeLength)
+        || aTargetEdgeLength < 1)
+      {
+        theDI << "Syntax error at '" << theArgVec[anArgIter] << "'";
+        return 1;
+      }
+    }
+    else if (aName.IsEmpty())
+    {
+      aName = theArgVec[anArgIter];
+    }
+    else if (aShape.IsNull())
+    {
+      aShape = DBRep::Get(theArgVec[anArgIter]);
+      if (aShape.IsNull())
+      {
+        theDI << "Error: shape '" << theArgVec[anArgIter] << "' is not found";
+        return 1;
+      }
+    }
+    else
+    {
+      theDI << "Syntax error at '" << theArgVec[anArgIter] << "'";
+      return 1;
+    }
+  }
+  if (aShape.IsNull())
+  {
+    theDI << "Syntax error: wrong number of arguments";
+    return 1;
+  }
+
+  NCollection_Sequence<occ::handle<Metal_BSplineSurface>> aSurfaces;
+  int aNbSkipped = 0;
+  for (TopExp_Explorer aFaceExp(aShape, TopAbs_FACE); aFaceExp.More(); aFaceExp.Next())
+  {
+    occ::handle<Metal_BSplineSurface> aSurface = convertFace(TopoDS::Face(aFaceExp.Current()), aNbEdgeSamples);
+    if (aSurface.IsNull())
+    {
+      ++aNbSkipped;
+      continue;
+    }
+    aSurfaces.Append(aSurface);
+  }
+  if (aSurfaces.IsEmpty())
+  {
+    theDI << "Error: shape has no faces on B-spline, Bezier or planar surfaces of degree up to "
+          << Metal_BSplineSurface::MaxDegree;
+    return 1;
+  }
+
+  if (aTargetEdgeLength > 0)
+  {
+    const occ::handle<Metal_TessellationController>& aTessCtrl = aDriver->GetSharedContext()->TessellationController();
+    if (!aTessCtrl.IsNull())
+    {
+      aTessCtrl->SetTargetEdgeLength(float(aTargetEdgeLength));
+    }
+  }
+
+  ViewerTest::Display(aName, new MetalTest_BSplinePrs(aSurfaces));
+  theDI << aSurfaces.Length() << " faces tessellated on GPU";
+  if (aNbSkipped != 0)
+  {
+    theDI << ", " << aNbSkipped << " faces skipped";
+  }
+  theDI << "\n";
+  return 0;
+}
+
+namespace
+{
+  //! Overlap backend of BRepExtrema_ShapeProximity traversing BVH trees on GPU (see Metal_BVHOverlap).
+  class MetalTest_OverlapBackend : public BRepExtrema_OverlapBackend
+  {
+    DEFINE_STANDARD_RTTI_INLINE(MetalTest_OverlapBackend, BRepExtrema_OverlapBackend)
+  public:
+    MetalTest_OverlapBackend(const occ::handle<Metal_Context>& theCtx)
+    : myCtx(theCtx),
+      myOverlap(new Metal_BVHOverlap()),
+      myNbPairs(0)
+    {
+      //
+    }
+
+    //! Compile the kernel.
+    bool Init() { return myOverlap->Init(myCtx.get()); }
+
+    //! Return number of leaf pairs found by the last run.
+    int NbPairs() const { return myNbPairs; }
+
+    bool FindLeafPairs(const occ::handle<BVH_Tree<double, 3>>& theTree1,
+                       const occ::handle<BVH_Tree<double, 3>>& theTree2,
+                       const double theTolerance,
+                       NCollection_Vector<NCollection_Vec2<int>>& theLeafPairs) override
+    {
+      const bool isDone = myOverlap->Perform(myCtx.get(), theTree1, theTree2, theTolerance, theLeafPairs);
+      myNbPairs = isDone ? theLeafPairs.Length() : 0;
+      return isDone;
+    }
+
+  private:
+    occ::handle<Metal_Context>    myCtx;
+    occ::handle<Metal_BVHOverlap> myOverlap;
+    int myNbPairs;
+  };
+
+  //! Return TRUE if two maps of overlapped sub-shapes are equal.
+  static bool isSameOverlap(const NCollection_DataMap<int, TColStd_PackedMapOfInteger>& theMap1,
+                            const NCollection_DataMap<int, TColStd_PackedMapOfInteger>& theMap2)
+  {
+    if (theMap1.Extent() != theMap2.Extent())
+    {
+      return false;
+    }
+    for (NCollection_DataMap<int, TColStd_PackedMapOfInteger>::Iterator aMapIter(theMap1); aMapIter.More(); aMapIter.Next())
+    {
+      const TColStd_PackedMapOfInteger* aSubShapes = theMap2.Seek(aMapIter.Key());
+      if (aSubShapes == nullptr || !aSubShapes->IsEqual(aMapIter.Value()))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+}
+
+//=================================================================================================
+
+static int VMetalProximity(Draw_Interpretor& theDI, int theArgNb, const char** theArgVec)
+{
+  occ::handle<Metal_GraphicDriver> aDriver = activeDriver();
+  if (aDriver.IsNull() || aDriver->GetSharedContext().IsNull())
+  {
+    theDI << "Error: no active Metal viewer";
+    return 1;
+  }
+
+  TopoDS_Shape aShapes[2];
+  double aTolerance = 0.0;
+  for (int anArgIter = 1; anArgIter < theArgNb; ++anArgIter)
+  {
+    TCollection_AsciiString anArg(theArgVec[anArgIter]);
+    anArg.LowerCase();
+    if (anArg == "-tol" && anArgIter + 1 < theArgNb)
+    {
+      aTolerance = Draw::Atof(theArgVec[++anArgIter]);
+      if (aTolerance < 0.0)
+      {
+        theDI << "Syntax error: tolerance should not be negative";
+        return 1;
+      }
+    }
+    else if (aShapes[0].IsNull() || aShapes[1].IsNull())
+    {
+      TopoDS_Shape& aShape = aShapes[0].IsNull() ? aShapes[0] : aShapes[1];
+      aShape = DBRep::Get(theArgVec[anArgIter]);
+      if (aShape.IsNull())
+      {
+        theDI << "Error: shape '" << theArgVec[anArgIter] << "' is not found";
+        return 1;
+      }
+    }
+    else
+    {
+      theDI << "Syntax error at '" << theArgVec[anArgIter] << "'";
+      return 1;
+    }
+  }
+  if (aShapes[1].IsNull())
+  {
+    theDI << "Syntax error: wrong number of arguments";
+    return 1;
+  }
+
+  occ::handle<MetalTest_OverlapBackend> aBackend = new MetalTest_OverlapBackend(aDriver->GetSharedContext());
+  if (!aBackend->Init())
+  {
+    theDI << "Error: traversal kernel cannot be compiled";
+    return 1;
+  }
+
+  BRepExtrema_ShapeProximity aCpuTool(aShapes[0], aShapes[1], aTolerance);
+  BRepExtrema_ShapeProximity aGpuTool(aShapes[0], aShapes[1], aTolerance);
+  if (aCpuTool.ElementSet1()->Size() == 0 || aCpuTool.ElementSet2()->Size() == 0)
+  {
+    theDI << "Error: shapes should be triangulated";
+    return 1;
+  }
+  aGpuTool.SetOverlapBackend(aBackend);
+
+  // build BVH trees before measuring
+  aCpuTool.ElementSet1()->BVH();
+  aCpuTool.ElementSet2()->BVH();
+  aGpuTool.ElementSet1()->BVH();
+  aGpuTool.ElementSet2()->BVH();
+
+  OSD_Timer aCpuTimer, aGpuTimer;
+  aCpuTimer.Start();
+  aCpuTool.Perform();
+  aCpuTimer.Stop();
+  aGpuTimer.Start();
+  aGpuTool.Perform();
+  aGpuTimer.Stop();
+
+  const bool isSame = isSameOverlap(aCpuTool.OverlapSubShapes1(), aGpuTool.OverlapSubShapes1())
+                   && isSameOverlap(aCpuTool.OverlapSubShapes2(), aGpuTool.OverlapSubShapes2());
+  theDI << "Overlapped faces: " << aGpuTool.OverlapSubShapes1().Extent() << " "
+        << aGpuTool.OverlapSubShapes2().Extent() << "\n";
+  theDI << "Leaf pairs found on GPU: " << aBackend->NbPairs() << "\n";
+  theDI << "CPU time: " << aCpuTimer.ElapsedTime() * 1000.0 << " ms\n";
+  theDI << "GPU time: " << aGpuTimer.ElapsedTime() * 1000.0 << " ms\n";
+  theDI << "Results: " << (isSame ? "identical" : "DIFFERENT") << "\n";
+  return isSame ? 0 : 1;
+}
+
+namespace
+{
+  //! Grid evaluation backend of GeomGridEval_BSplineSurface computing on GPU (see Metal_BSplineGridEval).
+  //! The control net is uploaded again only when another surface is evaluated.
+  class MetalTest_GridEvalBackend : public GeomGridEval_BSplineSurfaceBackend
+  {
+    DEFINE_STANDARD_RTTI_INLINE(MetalTest_GridEvalBackend, GeomGridEval_BSplineSurfaceBackend)
+  public:
+    MetalTest_GridEvalBackend(const occ::handle<Metal_Context>& theCtx)
+    : myCtx(theCtx),
+      myGridEval(new Metal_BSplineGridEval())
+    {
+      //
+    }
+
+    //! Compile the kernel.
+    bool Init() { return myGridEval->Init(myCtx.get()); }
+
+    bool EvaluateGrid(const occ::handle<Geom_BSplineSurface>& theSurface,
+                      const NCollection_Array1<double>& theUParams,
+                      const NCollection_Array1<double>& theVParams,
+                      NCollection_Array2<gp_Pnt>& theGrid) override
+    {
+      return setSurface(theSurface)
+          && myGridEval->Perform(myCtx.get(), theUParams, theVParams, theGrid);
+    }
+
+    bool EvaluateGridD1(const occ::handle<Geom_BSplineSurface>& theSurface,
+                        const NCollection_Array1<double>& theUParams,
+                        const NCollection_Array1<double>& theVParams,
+                        NCollection_Array2<GeomGridEval::SurfD1>& theGrid) override
+    {
+      const int aNbU = theUParams.Length(), aNbV = theVParams.Length();
+      NCollection_Array2<gp_Pnt> aPoints(1, aNbU, 1, aNbV);
+      NCollection_Array2<gp_Vec> aD1U(1, aNbU, 1, aNbV), aD1V(1, aNbU, 1, aNbV);
+      if (!setSurface(theSurface)
+       || !myGridEval->Perform(myCtx.get(), theUParams, theVParams, aPoints, &aD1U, &aD1V))
+      {
+        return false;
+      }
+      for (int aUIter = 1; aUIter <= aNbU; ++aUIter)
+      {
+        for (int aVIter = 1; aVIter <= aNbV; ++aVIter)
+        {
+          theGrid.ChangeValue(aUIter, aVIter) = {aPoints.Value(aUIter, aVIter), aD1U.Value(aUIter, aVIter), aD1V.Value(aUIter, aVIter)};
+        }
+      }
+      return true;
+    }
+
+  private:
+    //! Upload control net of the surface if it differs from the last one; periodic surfaces are refused.
+    bool setSurface(const occ::handle<Geom_BSplineSurface>& theSurface)
+    {
+      if (theSurface.IsNull() || theSurface->IsUPeriodic() || theSurface->IsVPeriodic())
+      {
+        return false;
+      }
+      if (theSurface == mySurface && myGridEval->HasSurface())
+      {
+        return true;
+      }
+
+      mySurface.Nullify();
+      if (!myGridEval->SetSurface(myCtx.get(), theSurface->UDegree(), theSurface->VDegree(),
+                                  theSurface->Poles(), theSurface->Weights(),
+                                  theSurface->UKnotSequence(), theSurface->VKnotSequence()))
+      {
+        return false;
+      }
+      mySurface = theSurface;
+      return true;
+    }
+
+  private:
+    occ::handle<Metal_Context>         myCtx;
+    occ::handle<Metal_BSplineGridEval> myGridEval;
+    occ::handle<Geom_BSplineSurface>   mySurface;
+  };
+}
+
+//=================================================================================================
+
+static int VMetalGridEval(Draw_Interpretor& theDI, int theArgNb, const char** theArgVec)
+{
+  occ::handle<Metal_GraphicDriver> aDriver = activeDriver();
+  if (aDriver.IsNull() || aDriver->GetSharedContext().IsNull())
+  {
+    theDI << "Error: no active Metal viewer";
+    return 1;
+  }
+
+  TopoDS_Shape aShape;
+  int aNbU = 256, aNbV = 256;
+  bool toComputeD1 = false;
+  for (int anArgIter = 1; anArgIter < theArgNb; ++anArgIter)
+  {
+    TCollection_AsciiString anArg(theArgVec[anArgIter]);
+    anArg.LowerCase();
+    if ((anArg == "-nbu" || anArg == "-nbv") && anArgIter + 1 < theArgNb)
+    {
+      int& aNb = anArg == "-nbu" ? aNbU : aNbV;
+      aNb = Draw::Atoi(theArgVec[++anArgIter]);
+      if (aNb < 2)
+      {
+        theDI << "Syntax error: number of parameters should be at least 2";
+        return 1;
+      }
+    }
+    else if (anArg == "-d1")
+    {
+      toComputeD1 = true;
+    }
+    else if (aShape.IsNull())
+    {
+      aShape = DBRep::Get(theArgVec[anArgIter]);
+      if (aShape.IsNull())
+      {
+        theDI << "Error: shape '" << theArgVec[anArgIter] << "' is not found";
+        return 1;
+      }
+    }
+    else
+    {
+      theDI << "Syntax error at '" << theArgVec[anArgIter] << "'";
+      return 1;
+    }
+  }
+  if (aShape.IsNull())
+  {
+    theDI << "Syntax error: wrong number of arguments";
+    return 1;
+  }
+
+  occ::handle<MetalTest_GridEvalBackend> aBackend = new MetalTest_GridEvalBackend(aDriver->GetSharedContext());
+  if (!aBackend->Init())
+  {
+    theDI << "Error: grid evaluation kernel cannot be compiled";
+    return 1;
+  }
+
+  OSD_Timer aCpuTimer, aGpuTimer;
+  int aNbFaces = 0;
+  double aMaxPntDev = 0.0, aMaxD1Dev = 0.0;
+  for (TopExp_Explorer aFaceIter(aShape, TopAbs_FACE); aFaceIter.More(); aFaceIter.Next())
+  {
+    const TopoDS_Face& aFace = TopoDS::Face(aFaceIter.Current());
+    occ::handle<Geom_BSplineSurface> aSurf = occ::down_cast<Geom_BSplineSurface>(BRep_Tool::Surface(aFace));
+    if (aSurf.IsNull())
+    {
+      continue;
+    }
+
+    double aUMin = 0.0, aUMax = 0.0, aVMin = 0.0, aVMax = 0.0;
+    BRepTools::UVBounds(aFace, aUMin, aUMax, aVMin, aVMax);
+    NCollection_Array1<double> aUParams(1, aNbU), aVParams(1, aNbV);
+    for (int aUIter = 1; aUIter <= aNbU; ++aUIter)
+    {
+      aUParams.SetValue(aUIter, aUMin + (aUMax - aUMin) * (aUIter - 1) / (aNbU - 1));
+    }
+    for (int aVIter = 1; aVIter <= aNbV; ++aVIter)
+    {
+      aVParams.SetValue(aVIter, aVMin + (aVMax - aVMin) * (aVIter - 1) / (aNbV - 1));
+    }
+
+    GeomGridEval_BSplineSurface aCpuEval(aSurf);
+    GeomGridEval_BSplineSurface aGpuEval(aSurf);
+    aGpuEval.SetBackend(aBackend);
+    if (toComputeD1)
+    {
+      aCpuTimer.Start();
+      const NCollection_Array2<GeomGridEval::SurfD1> aCpuGrid = aCpuEval.EvaluateGridD1(aUParams, aVParams);
+      aCpuTimer.Stop();
+      aGpuTimer.Start();
+      const NCollection_Array2<GeomGridEval::SurfD1> aGpuGrid = aGpuEval.EvaluateGridD1(aUParams, aVParams);
+      aGpuTimer.Stop();
+      for (int aUIter = 1; aUIter <= aNbU; ++aUIter)
+      {
+        for (int aVIter = 1; aVIter <= aNbV; ++aVIter)
+        {
+          const GeomGridEval::SurfD1& aCpu = aCpuGrid.Value(aUIter, aVIter);
+          const GeomGridEval::SurfD1& aGpu = aGpuGrid.Value(aUIter, aVIter);
+          aMaxPntDev = std::max(aMaxPntDev, aCpu.Point.Distance(aGpu.Point));
+          aMaxD1Dev  = std::max(aMaxD1Dev, (aCpu.D1U - aGpu.D1U).Magnitude() / std::max(aCpu.D1U.Magnitude(), 1.0));
+          aMaxD1Dev  = std::max(aMaxD1Dev, (aCpu.D1V - aGpu.D1V).Magnitude() / std::max(aCpu.D1V.Magnitude(), 1.0));
+        }
+      }
+    }
+    else
+    {
+      aCpuTimer.Start();
+      const NCollection_Array2<gp_Pnt> aCpuGrid = aCpuEval.EvaluateGrid(aUParams, aVParams);
+      aCpuTimer.Stop();
+      aGpuTimer.Start();
+      const NCollection_Array2<gp_Pnt> aGpuGrid = aGpuEval.EvaluateGrid(aUParams, aVParams);
+      aGpuTimer.Stop();
+      for (int aUIter = 1; aUIter <= aNbU; ++aUIter)
+      {
+        for (int aVIter = 1; aVIter <= aNbV; ++aVIter)
+        {
+          aMaxPntDev = std::max(aMaxPntDev, aCpuGrid.Value(aUIter, aVIter).Distance(aGpuGrid.Value(aUIter, aVIter)));
+        }
+      }
+    }
+    ++aNbFaces;
+  }
+  if (aNbFaces == 0)
+  {
+    theDI << "Error: shape has no faces on B-spline surfaces";
+    return 1;
+  }
+
+  theDI << "Faces evaluated: " << aNbFaces << " (" << aNbU << "x" << aNbV << " grid each)\n";
+  theDI << "CPU time: " << aCpuTimer.ElapsedTime() * 1000.0 << " ms\n";
+  theDI << "GPU time: " << aGpuTimer.ElapsedTime() * 1000.0 << " ms\n";
+  theDI << "Max point deviation: " << aMaxPntDev << "\n";
+  if (toComputeD1)
+  {
+    theDI << "Max relative derivative deviation: " << aMaxD1Dev << "\n";
+  }
+  return 0;
+}
+
+//=================================================================================================
+
+void MetalTest::Commands(Draw_Interpretor& theCommands)
+{
+  const char* aGroup = "Commands for low-level TKMetal features";
+
+  theCommands.Add(
+    "vmetalcaps",
+    "vmetalcaps [-framesInFlight N] [-lowLatency {0|1}] [-argumentBuffers {0|1}]"
+    "\n\t\t:            [-privateBuffers {0|1}] [-zeroCopy {0|1}] [-memoryless {0|1}]"
+    "\n\t\t:            [-quantized {0|1}] [-transferQueue {0|1}]"
+    "\n\t\t:            [-indirect {0|1}] [-meshShaders {0|1}] [-gpuCulling {0|1}]"
+    "\n\t\t:            [-parallel {0|1}] [-parallelMin N] [-sorted {0|1}]"
+    "\n\t\t:            [-autoInstancing {0|1}] [-asyncPipelines {0|1}]"
+    "\n\t\t:            [-heapBlockSize MiB] [-residency {0|1}] [-memoryBudget MiB]"
+    "\n\t\t:            [-streamedMinSize Pixels] [-streamedBudget MiB]"
+    "\n\t\t:            [-pointCloudMinPoints N] [-pointCloudBudget MiB] [-pointCloudError Pixels]"
+    "\n\t\t:            [-pointCloudCompute {0|1}] [-noupdate|-update]"
+    "\n\t\t: Modify particular Metal driver options (prints current options without arguments):"
+    "\n\t\t:  framesInFlight  - number of frames encoded ahead of GPU"
+    "\n\t\t:  lowLatency      - keep a single frame in flight for interactive manipulation"
+    "\n\t\t:  argumentBuffers - bind resources through argument buffers"
+    "\n\t\t:  privateBuffers  - keep vertex data in GPU-private memory"
+    "\n\t\t:  zeroCopy        - wrap page-aligned application arrays without copying"
+    "\n\t\t:  quantized       - upload octahedral normals and half float texture coordinates"
+    "\n\t\t:  transferQueue   - upload new resources on a dedicated command queue"
+    "\n\t\t:  memoryless      - use memoryless MSAA and depth attachments"
+    "\n\t\t:  indirect        - record static layers into indirect command buffers"
+    "\n\t\t:  meshShaders     - draw large triangulations through meshlets"
+    "\n\t\t:  gpuCulling      - frustum culling by compute kernel"
+    "\n\t\t:  parallel        - encode structures from several threads (parallelMin structures at least)"
+    "\n\t\t:  sorted          - sort draw calls by pipeline state"
+    "\n\t\t:  autoInstancing  - merge structures sharing the same geometry into instanced draws"
+    "\n\t\t:  asyncPipelines  - compile pipelines in background"
+    "\n\t\t:  heapBlockSize   - size of buffer heap blocks"
+    "\n\t\t:  residency       - evict idle structures when over memory budget"
+    "\n\t\t:  memoryBudget    - GPU memory budget, 0 for recommended working set size"
+    "\n\t\t:  streamedMinSize - minimal background image size streamed through sparse textures"
+    "\n\t\t:  streamedBudget  - memory budget of streamed textures"
+    "\n\t\t:  pointCloudMinPoints - minimal number of points drawn with level of detail, 0 to disable"
+    "\n\t\t:  pointCloudBudget    - memory budget of streamed points of a single point cloud"
+    "\n\t\t:  pointCloudError     - maximal spacing of drawn points on screen"
+    "\n\t\t:  pointCloudCompute   - rasterize point clouds by compute kernel"
+    "\n\t\t: Most options affect only newly created views and displayed objects.",
+    __FILE__,
+    VMetalCaps,
+    aGroup);
+  theCommands.Add("vmetalstats",
+                  "vmetalstats [-reset]"
+                  "\n\t\t: Print Metal memory usage (device, buffer heaps, textures, staging ring),"
+                  "\n\t\t: residency state, pipeline cache hit rate and GPU time of render passes."
+                  "\n\t\t:  -reset resets pipeline cache counters",
+                  __FILE__,
+                  VMetalStats,
+                  aGroup);
+  theCommands.Add("vmetalcapture",
+                  "vmetalcapture [file.gputrace [-frames N=1]] [-stop]"
+                  "\n\t\t: Capture Metal commands of the next N redraws of active view into GPU trace document"
+                  "\n\t\t: to be inspected by Xcode; with -frames 0 capture continues until -stop."
+                  "\n\t\t: Requires MTL_CAPTURE_ENABLED=1 environment variable outside of Xcode."
+                  "\n\t\t: Phases of each frame (cull, sort, encode per layer, commit) are also marked"
+                  "\n\t\t: by signposts shown within Points of Interest of Instruments.",
+                  __FILE__,
+                  VMetalCapture,
+                  aGroup);
+  theCommands.Add("vmetalbench",
+                  "vmetalbench [-frames N=100] [-warmup N=10] [-orbit Degrees=360]"
+                  "\n\t\t: Redraw active view N times while orbiting camera around its center"
+                  "\n\t\t: and print FPS with percentiles of CPU encoding and GPU frame times."
+                  "\n\t\t: GPU timers of render passes are enabled while measuring (see vmetalstats)."
+                  "\n\t\t: Camera is restored afterwards.",
+                  __FILE__,
+                  VMetalBench,
+                  aGroup);
+  theCommands.Add("vmetalhiddenline",
+                  "vmetalhiddenline [on|off] [-hidden {0|1}] [-crease Degrees=20] [-dash Pixels=6 Gap=4]"
+                  "\n\t\t:                  [-visibleColor Color] [-hiddenColor Color] [-noupdate|-update]"
+                  "\n\t\t: Display shaded objects of active view as hidden line image computed on GPU"
+                  "\n\t\t: from their triangulations: boundary, crease and silhouette edges are drawn"
+                  "\n\t\t: over the background, hidden ones dashed. Prints current state without arguments."
+                  "\n\t\t: This is a viewing mode; use exact HLR (vhlr, HLRBRep) for drawings export."
+                  "\n\t\t:  -hidden draw hidden edges"
+                  "\n\t\t:  -crease minimal angle between adjacent triangles to draw their common edge"
+                  "\n\t\t:  -dash   dash and gap lengths of hidden edges, zero gap for solid lines",
+                  __FILE__,
+                  VMetalHiddenLine,
+                  aGroup);
+  theCommands.Add("vbsplinesurface",
+                  "vbsplinesurface name shape [-edgeSamples N=32] [-tessEdge Pixels=8]"
+                  "\n\t\t: Display faces of the shape as B-spline surfaces evaluated on GPU from their control nets"
+                  "\n\t\t: with screen-space adaptive tessellation, instead of triangulation."
+                  "\n\t\t: Only faces on B-spline, Bezier and planar surfaces are displayed."
+                  "\n\t\t:  -edgeSamples number of samples of each edge in trimming loops"
+                  "\n\t\t:  -tessEdge    target length of tessellated segments in pixels (applies to all surfaces)",
+                  __FILE__,
+                  VBSplineSurface,
+                  aGroup);
+  theCommands.Add("vmetalproximity",
+                  "vmetalproximity shape1 shape2 [-tol Value=0]"
+                  "\n\t\t: Find overlapped faces of two triangulated shapes by BRepExtrema_ShapeProximity"
+                  "\n\t\t: with BVH trees traversed on GPU, and compare results and time with the CPU traversal."
+                  "\n\t\t: Triangles of the found pairs of BVH leaves are tested on CPU, so results should be identical."
+                  "\n\t\t:  -tol maximum distance between overlapped faces",
+                  __FILE__,
+                  VMetalProximity,
+                  aGroup);
+  theCommands.Add("vmetalgrideval",
+                  "vmetalgrideval shape [-nbU N=256] [-nbV N=256] [-d1]"
+                  "\n\t\t: Evaluate faces of the shape on B-spline surfaces on grids of parameters by GeomGridEval"
+                  "\n\t\t: with GPU backend, and compare results and time with the CPU evaluation."
+                  "\n\t\t: GPU computes in single precision, so small deviations are expected (see Metal_BSplineGridEval)."
+                  "\n\t\t:  -nbU -nbV number of grid parameters along U and V"
+                  "\n\t\t:  -d1       evaluate first derivatives as well",
+                  __FILE__,
+                  VMetalGridEval,
+                  aGroup);
+}
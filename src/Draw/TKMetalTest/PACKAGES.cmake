@@ -0,0 +1,4 @@
+# Auto-generated list of packages for TKMetalTest toolkit
+set(OCCT_TKMetalTest_LIST_OF_PACKAGES
+  MetalTest
+)
@@ -558,6 +558,7 @@ static int VCaps(Draw_Interpretor& theDI, int theArgNb, const char** theArgVec)
     theDI << "FFP:     " << (aCaps->ffpEnable ? "1" : "0") << "\n";
     theDI << "PolygonMode: " << (aCaps->usePolygonMode ? "1" : "0") << "\n";
     theDI << "DepthZeroToOne: " << (aCaps->useZeroToOneDepth ? "1" : "0") << "\n";
+    theDI << "QuantizedVertices: " << (aCaps->useQuantizedVertices ? "1" : "0") << "\n";
     theDI << "VSync:   " << aCaps->swapInterval << "\n";
     theDI << "Compatible:" << (aCaps->contextCompatible ? "1" : "0") << "\n";
     theDI << "Stereo:  " << (aCaps->contextStereo ? "1" : "0") << "\n";
@@ -615,6 +616,10 @@ static int VCaps(Draw_Interpretor& theDI, int theArgNb, const char** theArgVec)
     {
       aCaps->useZeroToOneDepth = Draw::ParseOnOffIterator(theArgNb, theArgVec, anArgIter);
     }
+    else if (anArgCase == "-quantized" || anArgCase == "-quantizedvertices")
+    {
+      aCaps->useQuantizedVertices = Draw::ParseOnOffIterator(theArgNb, theArgVec, anArgIter);
+    }
     else if (anArgCase == "-softmode" || anArgCase == "-contextnoaccel")
     {
       aCaps->contextNoAccel = Draw::ParseOnOffIterator(theArgNb, theArgVec, anArgIter);
@@ -730,7 +735,7 @@ void OpenGlTest::Commands(Draw_Interpretor& theCommands)
     "\n\t\t:       [-vsync {0|1}] [-useWinBuffer {0|1}] [-opaqueAlpha {0|1}]"
     "\n\t\t:       [-deepColor {0|1}] [-quadBuffer {0|1}] [-stereo {0|1}]"
     "\n\t\t:       [-softMode {0|1}] [-noupdate|-update]"
-    "\n\t\t:       [-zeroToOneDepth {0|1}]"
+    "\n\t\t:       [-zeroToOneDepth {0|1}] [-quantizedVertices {0|1}]"
     "\n\t\t:       [-noExtensions {0|1}] [-maxVersion Major Minor]"
     "\n\t\t: Modify particular graphic driver options:"
     "\n\t\t:  sRGB     - enable/disable sRGB rendering"
@@ -746,6 +751,8 @@ void OpenGlTest::Commands(Draw_Interpretor& theCommands)
     "\n\t\t:  opaqueAlpha - disable writes in alpha component of color buffer"
     "\n\t\t:  winBuffer - allow using window buffer for rendering"
     "\n\t\t:  zeroToOneDepth - use [0,1] depth range instead of [-1,1] range"
+    "\n\t\t:  quantizedVertices - upload positions of static triangulations as 16-bit integers"
+    "\n\t\t:                      and texture coordinates as half floats"
     "\n\t\t: Window buffer creation options:"
     "\n\t\t:  quadbuffer  - QuadBuffer for stereoscopic displays"
     "\n\t\t:  deepColor   - window buffer with higher color precision (30bit instead of 24bit RGB)"
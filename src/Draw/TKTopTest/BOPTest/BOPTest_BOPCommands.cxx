@@ -103,7 +103,7 @@ void BOPTest::BOPCommands(Draw_Interpretor& theCommands)
                   bopcurves,
                   g);
   theCommands.Add("mkvolume",
-                  "make solids from set of shapes.\nmkvolume r b1 b2 ... [-c] [-ni] [-ai]",
+                  "make solids from set of shapes.\nmkvolume r b1 b2 ... [-c] [-ni] [-ai] [-cl]",
                   __FILE__,
                   mkvolume,
                   g);
@@ -750,19 +750,21 @@ int mkvolume(Draw_Interpretor& di, int n, const char** a)
 {
   if (n < 3)
   {
-    di << "Usage: mkvolume r b1 b2 ... [-c] [-ni] [-ai]\n";
+    di << "Usage: mkvolume r b1 b2 ... [-c] [-ni] [-ai] [-cl]\n";
     di << "Options:\n";
     di << " -c  - use this option if the arguments are compounds\n";
     di << "       containing shapes that should be interfered;\n";
     di << " -ni - use this option if the arguments should not be interfered;\n";
-    di << " -ai - use this option to avoid internal for solids shapes in the result.\n";
+    di << " -ai - use this option to avoid internal for solids shapes in the result;\n";
+    di << " -cl - use this option to process the clusters of interfering shapes independently\n";
+    di << "       to reduce the memory consumption.\n";
     return 1;
   }
   //
   const char* usage = "Type mkvolume without arguments for the usage of the command.\n";
   //
   bool                           bToIntersect, bRunParallel, bNonDestructive;
-  bool                           bCompounds, bAvoidInternal;
+  bool                           bCompounds, bAvoidInternal, bClusters;
   int                            i;
   double                         aTol;
   TopoDS_Shape                   aS;
@@ -776,6 +778,7 @@ int mkvolume(Draw_Interpretor& di, int n, const char** a)
   bToIntersect   = true;
   bCompounds     = false;
   bAvoidInternal = false;
+  bClusters      = false;
   //
   for (i = 2; i < n; ++i)
   {
@@ -798,6 +801,10 @@ int mkvolume(Draw_Interpretor& di, int n, const char** a)
       {
         bAvoidInternal = true;
       }
+      else if (!strcmp(a[i], "-cl"))
+      {
+        bClusters = true;
+      }
     }
   }
   //
@@ -837,6 +844,7 @@ int mkvolume(Draw_Interpretor& di, int n, const char** a)
   aMV.SetFuzzyValue(aTol);
   aMV.SetNonDestructive(bNonDestructive);
   aMV.SetAvoidInternalShapes(bAvoidInternal);
+  aMV.SetClusterMode(bClusters);
   aMV.SetGlue(aGlue);
   aMV.SetUseOBB(BOPTest_Objects::UseOBB());
   aMV.SetToFillHistory(BRepTest_Objects::IsHistoryNeeded());
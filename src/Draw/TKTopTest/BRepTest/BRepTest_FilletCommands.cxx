@@ -153,6 +153,12 @@ static int BLEND(Draw_Interpretor& di, int narg, const char** a)
     Rakk = nullptr;
   }
   printtolblend(di);
+  bool isParallel = false;
+  if (narg > 1 && !strcmp(a[narg - 1], "-parallel"))
+  {
+    isParallel = true;
+    narg--;
+  }
   if (narg < 5)
     return 1;
   TopoDS_Shape V = DBRep::Get(a[2]);
@@ -173,6 +179,7 @@ static int BLEND(Draw_Interpretor& di, int narg, const char** a)
   Rakk = new BRepFilletAPI_MakeFillet(V, FSh);
   Rakk->SetParams(ta, tesp, t2d, t3d, t2d, fl);
   Rakk->SetContinuity(blend_cont, tapp_angle);
+  Rakk->SetRunParallel(isParallel);
   double      Rad;
   TopoDS_Edge E;
   int         nbedge = 0;
@@ -791,7 +798,12 @@ void BRepTest::FilletCommands(Draw_Interpretor& theCommands)
 
   theCommands.Add("tolblend", "tolblend [ta t3d t2d fl]", __FILE__, tolblend, g);
 
-  theCommands.Add("blend", "blend result object rad1 ed1 rad2 ed2 ... [R/Q/P]", __FILE__, BLEND, g);
+  theCommands.Add("blend",
+                  "blend result object rad1 ed1 rad2 ed2 ... [R/Q/P] [-parallel]"
+                  "\n\t\t: -parallel computes the surfaces of the contours in parallel threads",
+                  __FILE__,
+                  BLEND,
+                  g);
 
   theCommands.Add("checkhist", "checkhist", __FILE__, CheckHist, g);
 
@@ -372,6 +372,7 @@ static int sewing(Draw_Interpretor& theDi, int theArgc, const char** theArgv)
   bool   aSameParameterMode = true;
   bool   aFloatingEdgesMode = false;
   bool   aFaceMode          = true;
+  bool   aRunParallel       = false;
   bool   aSetMinTol         = false;
   double aMinTol            = 0.;
   double aMaxTol            = Precision::Infinite();
@@ -430,6 +431,9 @@ static int sewing(Draw_Interpretor& theDi, int theArgc, const char** theArgv)
         case 'f':
           aFaceMode = aVal;
           break;
+        case 'r':
+          aRunParallel = aVal;
+          break;
       }
     }
     else
@@ -468,6 +472,7 @@ static int sewing(Draw_Interpretor& theDi, int theArgc, const char** theArgv)
     theDi << "  p - mode for same parameter processing for edges\n";
     theDi << "  e - mode for sewing floating edges\n";
     theDi << "  f - mode for sewing faces\n";
+    theDi << "  r - mode for parallel processing\n";
     return (1);
   }
 
@@ -494,6 +499,7 @@ static int sewing(Draw_Interpretor& theDi, int theArgc, const char** theArgv)
   aSewing.SetFaceMode(aFaceMode);
   aSewing.SetMinTolerance(aMinTol);
   aSewing.SetMaxTolerance(aMaxTol);
+  aSewing.SetRunParallel(aRunParallel);
 
   for (int i = 1; i <= aSeq.Length(); i++)
     aSewing.Add(aSeq.Value(i));
@@ -286,8 +286,20 @@ static int upda(Draw_Interpretor&, int, const char**)
 
 //=================================================================================================
 
-static int hide(Draw_Interpretor&, int, const char**)
+static int hide(Draw_Interpretor& di, int n, const char** a)
 {
+  bool isParallel = false;
+  for (int i = 1; i < n; i++)
+  {
+    if (strcmp(a[i], "-parallel") == 0)
+      isParallel = true;
+    else
+    {
+      di << "Syntax error at '" << a[i] << "'\n";
+      return 1;
+    }
+  }
+  hider->SetRunParallel(isParallel);
   hider->Hide();
   return 0;
 }
@@ -548,7 +560,12 @@ void HLRTest::Commands(Draw_Interpretor& theCommands)
   theCommands.Add("hremove", "hremove [name]", __FILE__, hrem, g);
   theCommands.Add("hsetprj", "hsetprj [name]", __FILE__, sprj, g);
   theCommands.Add("hupdate", "hupdate", __FILE__, upda, g);
-  theCommands.Add("hhide", "hhide", __FILE__, hide, g);
+  theCommands.Add("hhide",
+                  "hhide [-parallel]\n"
+                  "\t\t-parallel : hide the edges of each shape in parallel threads",
+                  __FILE__,
+                  hide,
+                  g);
   theCommands.Add("hshowall", "hshowall", __FILE__, show, g);
   theCommands.Add("hdebug", "hdebug", __FILE__, hdbg, g);
   theCommands.Add("hnullify", "hnullify", __FILE__, hnul, g);
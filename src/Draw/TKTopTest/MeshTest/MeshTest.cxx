@@ -26,7 +26,9 @@
 #include <BRepBuilderAPI_MakeVertex.hxx>
 #include <BRepLib.hxx>
 #include <BRepMesh_IncrementalMesh.hxx>
+#include <BRepMesh_TriangulationCache.hxx>
 #include <BRepTest.hxx>
+#include <BRepTest_DrawableHistory.hxx>
 #include <BRepTools.hxx>
 #include <CSLib.hxx>
 #include <DBRep.hxx>
@@ -75,6 +77,13 @@ OSD_Chronometer chAdd11, chAdd12, chAdd2, chUpdate, chPointValid;
 OSD_Chronometer chIsos, chPointsOnIsos;
 #endif
 
+//! Returns triangulation cache shared by incmesh calls within Draw session.
+static occ::handle<BRepMesh_TriangulationCache>& meshTriangulationCache()
+{
+  static occ::handle<BRepMesh_TriangulationCache> THE_CACHE = new BRepMesh_TriangulationCache();
+  return THE_CACHE;
+}
+
 //=================================================================================================
 
 static int incrementalmesh(Draw_Interpretor& theDI, int theNbArgs, const char** theArgVec)
@@ -88,6 +97,9 @@ static int incrementalmesh(Draw_Interpretor& theDI, int theNbArgs, const char**
   NCollection_List<TopoDS_Shape> aListOfShapes;
   IMeshTools_Parameters          aMeshParams;
   bool                           hasDefl = false, hasAngDefl = false, isPrsDefl = false;
+  bool                           toUseCache = false;
+  TopoDS_Shape                   anInitialShape;
+  occ::handle<BRepTools_History> aHistory;
 
   occ::handle<IMeshTools_Context> aContext = new BRepMesh_Context();
   for (int anArgIter = 1; anArgIter < theNbArgs; ++anArgIter)
@@ -129,6 +141,32 @@ static int incrementalmesh(Draw_Interpretor& theDI, int theNbArgs, const char**
       aMeshParams.AllowQualityDecrease =
         Draw::ParseOnOffNoIterator(theNbArgs, theArgVec, anArgIter);
     }
+    else if (aNameCase == "-vertex_cache")
+    {
+      aMeshParams.OptimizeVertexCache = Draw::ParseOnOffNoIterator(theNbArgs, theArgVec, anArgIter);
+    }
+    else if (aNameCase == "-compact")
+    {
+      aMeshParams.CompactTriangulation =
+        Draw::ParseOnOffNoIterator(theNbArgs, theArgVec, anArgIter);
+    }
+    else if (aNameCase == "-cache")
+    {
+      toUseCache = Draw::ParseOnOffNoIterator(theNbArgs, theArgVec, anArgIter);
+    }
+    else if (aNameCase == "-history" && anArgIter + 2 < theNbArgs)
+    {
+      occ::handle<BRepTest_DrawableHistory> aDrawHist =
+        occ::down_cast<BRepTest_DrawableHistory>(Draw::Get(theArgVec[++anArgIter]));
+      anInitialShape = DBRep::Get(theArgVec[++anArgIter]);
+      if (aDrawHist.IsNull() || anInitialShape.IsNull())
+      {
+        theDI << "Syntax error: invalid history '" << theArgVec[anArgIter - 1]
+              << "' or initial shape '" << theArgVec[anArgIter] << "'";
+        return 1;
+      }
+      aHistory = aDrawHist->History();
+    }
     else if (aNameCase == "-algo" && anArgIter + 1 < theNbArgs)
     {
       TCollection_AsciiString anAlgoStr(theArgVec[++anArgIter]);
@@ -268,6 +306,11 @@ static int incrementalmesh(Draw_Interpretor& theDI, int theNbArgs, const char**
   BRepMesh_IncrementalMesh            aMesher;
   aMesher.SetShape(aShape);
   aMesher.ChangeParameters() = aMeshParams;
+  if (toUseCache)
+  {
+    aMesher.SetTriangulationCache(meshTriangulationCache());
+  }
+  aMesher.SetHistory(anInitialShape, aHistory);
   aMesher.Perform(aContext, aProgress->Start());
 
   theDI << "Meshing statuses: ";
@@ -322,6 +365,68 @@ static int incrementalmesh(Draw_Interpretor& theDI, int theNbArgs, const char**
 
 //=================================================================================================
 
+static int meshcache(Draw_Interpretor& theDI, int theNbArgs, const char** theArgVec)
+{
+  const occ::handle<BRepMesh_TriangulationCache>& aCache = meshTriangulationCache();
+  bool                                            toPrintInfo = theNbArgs == 1;
+  for (int anArgIter = 1; anArgIter < theNbArgs; ++anArgIter)
+  {
+    TCollection_AsciiString anArg(theArgVec[anArgIter]);
+    anArg.LowerCase();
+    if (anArg == "-clear")
+    {
+      aCache->Clear();
+    }
+    else if (anArg == "-info")
+    {
+      toPrintInfo = true;
+    }
+    else if (anArg == "-maxmemory" && anArgIter + 1 < theNbArgs)
+    {
+      const double aMiBytes = Draw::Atof(theArgVec[++anArgIter]);
+      if (aMiBytes < 0.0)
+      {
+        theDI << "Syntax error: negative memory limit";
+        return 1;
+      }
+      aCache->SetMaxMemory(std::size_t(aMiBytes * 1024.0 * 1024.0));
+    }
+    else if (anArg == "-save" && anArgIter + 1 < theNbArgs)
+    {
+      if (!aCache->Save(theArgVec[++anArgIter]))
+      {
+        theDI << "Error: unable to save triangulation cache into '" << theArgVec[anArgIter] << "'";
+        return 1;
+      }
+    }
+    else if (anArg == "-load" && anArgIter + 1 < theNbArgs)
+    {
+      if (!aCache->Load(theArgVec[++anArgIter]))
+      {
+        theDI << "Error: unable to load triangulation cache from '" << theArgVec[anArgIter] << "'";
+        return 1;
+      }
+    }
+    else
+    {
+      theDI << "Syntax error at '" << theArgVec[anArgIter] << "'";
+      return 1;
+    }
+  }
+
+  if (toPrintInfo)
+  {
+    theDI << "Entries: " << aCache->NbEntries() << "\n"
+          << "Memory:  " << int(aCache->UsedMemory() / 1024) << " KiB / "
+          << int(aCache->MaxMemory() / 1024) << " KiB\n"
+          << "Hits:    " << int(aCache->NbHits()) << "\n"
+          << "Misses:  " << int(aCache->NbMisses()) << "\n";
+  }
+  return 0;
+}
+
+//=================================================================================================
+
 static int tessellate(Draw_Interpretor& /*di*/, int nbarg, const char** argv)
 {
   if (nbarg != 5)
@@ -1509,7 +1614,7 @@ static int TrMergeNodes(Draw_Interpretor& theDI, int theNbArgs, const char** the
   }
 
   double                  aMergeAngle = M_PI / 4.0, aMergeToler = 0.0;
-  bool                    toForce = false;
+  bool                    toForce = false, toParallel = true;
   TCollection_AsciiString aResFace;
   for (int anArgIter = 2; anArgIter < theNbArgs; ++anArgIter)
   {
@@ -1543,6 +1648,10 @@ static int TrMergeNodes(Draw_Interpretor& theDI, int theNbArgs, const char** the
     {
       toForce = Draw::ParseOnOffIterator(theNbArgs, theArgVec, anArgIter);
     }
+    else if (anArgCase == "-parallel")
+    {
+      toParallel = Draw::ParseOnOffIterator(theNbArgs, theArgVec, anArgIter);
+    }
     else if (anArgIter + 1 < theNbArgs && anArgCase == "-oneface")
     {
       aResFace = theArgVec[++anArgIter];
@@ -1558,8 +1667,8 @@ static int TrMergeNodes(Draw_Interpretor& theDI, int theNbArgs, const char** the
   int aNbNodesNew = 0, aNbTrisNew = 0;
   if (!aResFace.IsEmpty())
   {
-    TopLoc_Location     aFaceLoc;
-    Poly_MergeNodesTool aMergeTool(aMergeAngle, aMergeToler);
+    TopLoc_Location                                         aFaceLoc;
+    NCollection_Vector<Poly_MergeNodesTool::TriangulationPart> aParts;
     for (TopExp_Explorer aFaceIter(aShape, TopAbs_FACE); aFaceIter.More(); aFaceIter.Next())
     {
       const TopoDS_Face&              aFace = TopoDS::Face(aFaceIter.Value());
@@ -1571,8 +1680,18 @@ static int TrMergeNodes(Draw_Interpretor& theDI, int theNbArgs, const char** the
 
       aNbNodesOld += aTris->NbNodes();
       aNbTrisOld += aTris->NbTriangles();
-      aMergeTool.AddTriangulation(aTris, aFaceLoc, aFace.Orientation() == TopAbs_REVERSED);
+      aParts.Append(Poly_MergeNodesTool::TriangulationPart(aTris,
+                                                           aFaceLoc.Transformation(),
+                                                           aFace.Orientation() == TopAbs_REVERSED));
     }
+
+    NCollection_Array1<Poly_MergeNodesTool::TriangulationPart> aPartArray(0, aParts.Length() - 1);
+    for (int aPartIter = 0; aPartIter < aParts.Length(); ++aPartIter)
+    {
+      aPartArray.SetValue(aPartIter, aParts.Value(aPartIter));
+    }
+    Poly_MergeNodesTool aMergeTool(aMergeAngle, aMergeToler, aNbTrisOld);
+    aMergeTool.AddTriangulations(aPartArray, toParallel);
     occ::handle<Poly_Triangulation> aNewTris = aMergeTool.Result();
     if (aNewTris.IsNull())
     {
@@ -1665,7 +1784,8 @@ void MeshTest::Commands(Draw_Interpretor& theCommands)
     "\n\t\t:   [-algo {watson|delabella}]=watson"
     "\n\t\t:   [-di Value] [-ai Angle]=57.29"
     "\n\t\t:   [-int_vert_off {0|1}]=0 [-surf_def_off {0|1}]=0 [-adjust_min {0|1}]=0"
-    "\n\t\t:   [-force_face_def {0|1}]=0 [-decrease {0|1}]=0"
+    "\n\t\t:   [-force_face_def {0|1}]=0 [-decrease {0|1}]=0 [-vertex_cache {0|1}]=0"
+    "\n\t\t:   [-compact {0|1}]=0 [-cache {0|1}]=0 [-history History InitialShape]"
     "\n\t\t: Builds triangular mesh for the shape."
     "\n\t\t:  LinDefl         linear deflection to control mesh quality;"
     "\n\t\t:  -angular        angular deflection for edges in deg (~28.64 deg = 0.5 rad by "
@@ -1695,10 +1815,30 @@ void MeshTest::Commands(Draw_Interpretor& theCommands)
     "(FALSE by default);"
     "\n\t\t:  -decrease       enforces the meshing of the shape even if current mesh satisfies the "
     "new criteria"
-    "\n\t\t:                  (FALSE by default).",
+    "\n\t\t:                  (FALSE by default);"
+    "\n\t\t:  -vertex_cache    reorders triangles and nodes of mesh for GPU vertex cache "
+    "(FALSE by default);"
+    "\n\t\t:  -compact        stores mesh in compact form for display: single precision nodes,"
+    "\n\t\t:                  quantized normals and no UV nodes (FALSE by default);"
+    "\n\t\t:  -cache          reuses triangulations of identical faces from the session cache"
+    "\n\t\t:                  managed by meshcache command (FALSE by default);"
+    "\n\t\t:  -history        meshes only faces modified or generated from InitialShape"
+    "\n\t\t:                  according to History saved by savehistory command; untouched"
+    "\n\t\t:                  neighbor faces keep their triangulation.",
     __FILE__,
     incrementalmesh,
     g);
+  theCommands.Add("meshcache",
+                  "meshcache [-clear] [-info] [-maxMemory MiB] [-save File] [-load File]"
+                  "\n\t\t: Manages triangulation cache used by incmesh -cache."
+                  "\n\t\t:  -clear     releases cached triangulations and resets statistics;"
+                  "\n\t\t:  -info      prints number of entries, used memory, hits and misses;"
+                  "\n\t\t:  -maxMemory sets memory limit in MiB (256 by default);"
+                  "\n\t\t:  -save      saves cached triangulations into the file;"
+                  "\n\t\t:  -load      appends triangulations from the file to the cache.",
+                  __FILE__,
+                  meshcache,
+                  g);
   theCommands.Add("tessellate",
                   "Builds triangular mesh for the surface, run w/o args for help",
                   __FILE__,
@@ -1752,11 +1892,12 @@ void MeshTest::Commands(Draw_Interpretor& theCommands)
   theCommands.Add(
     "trmergenodes",
     "trmergenodes shapeName"
-    "\n\t\t:   [-angle Angle] [-tolerance Value] [-oneFace Result]"
+    "\n\t\t:   [-angle Angle] [-tolerance Value] [-oneFace Result] [-parallel {0|1}]=1"
     "\n\t\t: Merging nodes within triangulation data."
     "\n\t\t:   -angle     merge angle upper limit in degrees; 45 when unspecified"
     "\n\t\t:   -tolerance linear tolerance to merge nodes; 0.0 when unspecified"
-    "\n\t\t:   -oneFace   create a new single Face with specified name for the whole triangulation",
+    "\n\t\t:   -oneFace   create a new single Face with specified name for the whole triangulation"
+    "\n\t\t:   -parallel  merge nodes of the single Face in parallel threads",
     __FILE__,
     TrMergeNodes,
     g);
@@ -610,6 +610,11 @@ static int fixshape(Draw_Interpretor& di, int argc, const char** argv)
       sfs->FixWireTool()->SetMaxTailWidth(Draw::Atof(argv[i]));
       sfs->FixWireTool()->FixTailMode() = 1;
     }
+    else if (!strcmp(argv[i], "-parallel"))
+    {
+      sfs->SetRunParallel(true);
+      continue;
+    }
     else
     {
       switch (par)
@@ -639,7 +644,7 @@ static int fixshape(Draw_Interpretor& di, int argc, const char** argv)
   {
     di << "Use: " << argv[0]
        << " result shape [tolerance [max_tolerance]] [switches]\n"
-          "[-maxtaila <degrees>] [-maxtailw <width>]\n";
+          "[-maxtaila <degrees>] [-maxtailw <width>] [-parallel]\n";
     di << "Switches allow to tune parameters of ShapeFix\n";
     di << "The following syntax is used: <symbol><parameter>\n";
     di << "- symbol may be - to set parameter off, + to set on or * to set default\n";
@@ -653,6 +658,7 @@ static int fixshape(Draw_Interpretor& di, int argc, const char** argv)
     di << "  i - FixSelfIntersectionMode\n";
     di << "  n - FixNotchedEdgesMode\n";
     di << "For enhanced message output, use switch '+?'\n";
+    di << "Option -parallel enables parallel fixing of faces of shells\n";
     return 1;
   }
 
@@ -1045,7 +1051,7 @@ void SWDRAW_ShapeFix::InitCommands(Draw_Interpretor& theCommands)
   theCommands.Add("reface", "shape result : controle sens wire", __FILE__, reface, g);
   theCommands.Add("fixshape",
                   "res shape [preci [maxpreci]] [{switches}]\n"
-                  "  [-maxtaila <degrees>] [-maxtailw <width>]",
+                  "  [-maxtaila <degrees>] [-maxtailw <width>] [-parallel]",
                   __FILE__,
                   fixshape,
                   g);
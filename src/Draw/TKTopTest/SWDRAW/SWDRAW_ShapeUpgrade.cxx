@@ -1474,7 +1474,7 @@ static int unifysamedom(Draw_Interpretor& di, int n, const char** a)
   if (n < 3)
   {
     di << "Use unifysamedom result shape [s1 s2 ...] [-f] [-e] [-nosafe] [+b] [+i] [-t val] [-a "
-          "val]\n";
+          "val] [-parallel]\n";
     di << "options:\n";
     di << "s1 s2 ... to keep the given edges during unification of faces\n";
     di << "-f to switch off 'unify-faces' mode \n";
@@ -1484,6 +1484,7 @@ static int unifysamedom(Draw_Interpretor& di, int n, const char** a)
     di << "+i to switch on 'allow internal edges' mode\n";
     di << "-t val to set linear tolerance\n";
     di << "-a val to set angular tolerance (in degrees)\n";
+    di << "-parallel to switch on parallel mode\n";
     di << "'unify-faces' and 'unify-edges' modes are switched on by default";
     return 1;
   }
@@ -1498,6 +1499,7 @@ static int unifysamedom(Draw_Interpretor& di, int n, const char** a)
   bool                                                   anConBS         = false;
   bool                                                   isAllowInternal = false;
   bool                                                   isSafeInputMode = true;
+  bool                                                   isParallel      = false;
   double                                                 aLinTol         = Precision::Confusion();
   double                                                 aAngTol         = Precision::Angular();
   TopoDS_Shape                                           aKeepShape;
@@ -1523,6 +1525,8 @@ static int unifysamedom(Draw_Interpretor& di, int n, const char** a)
           anConBS = true;
         else if (!strcmp(a[i], "+i"))
           isAllowInternal = true;
+        else if (!strcmp(a[i], "-parallel"))
+          isParallel = true;
         else if (!strcmp(a[i], "-t") || !strcmp(a[i], "-a"))
         {
           if (++i < n)
@@ -1547,6 +1551,7 @@ static int unifysamedom(Draw_Interpretor& di, int n, const char** a)
   Unifier().AllowInternalEdges(isAllowInternal);
   Unifier().SetLinearTolerance(aLinTol);
   Unifier().SetAngularTolerance(aAngTol);
+  Unifier().SetRunParallel(isParallel);
   Unifier().Build();
   TopoDS_Shape Result = Unifier().Shape();
 
@@ -1816,7 +1821,8 @@ void SWDRAW_ShapeUpgrade::InitCommands(Draw_Interpretor& theCommands)
 
   theCommands.Add(
     "unifysamedom",
-    "unifysamedom result shape [s1 s2 ...] [-f] [-e] [-nosafe] [+b] [+i] [-t val] [-a val]",
+    "unifysamedom result shape [s1 s2 ...] [-f] [-e] [-nosafe] [+b] [+i] [-t val] [-a val]"
+    " [-parallel]",
     __FILE__,
     unifysamedom,
     g);
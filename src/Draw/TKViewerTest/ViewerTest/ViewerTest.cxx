@@ -4807,6 +4807,8 @@ static int VDisplay2(Draw_Interpretor& theDI, int theArgNb, const char** theArgV
   NCollection_Sequence<TCollection_AsciiString> aNamesOfDisplayIO;
   AIS_DisplayStatus                             aDispStatus     = AIS_DS_None;
   int                                           toDisplayInView = false;
+  bool                                          toParallel      = false;
+  bool                                          toAsync         = false;
   for (int anArgIter = 1; anArgIter < theArgNb; ++anArgIter)
   {
     const TCollection_AsciiString aName     = theArgVec[anArgIter];
@@ -5022,6 +5024,15 @@ static int VDisplay2(Draw_Interpretor& theDI, int theArgNb, const char** theArgV
     {
       toReDisplay = true;
     }
+    else if (aNameCase == "-parallel")
+    {
+      toParallel = true;
+    }
+    else if (aNameCase == "-async")
+    {
+      toParallel = true;
+      toAsync    = true;
+    }
     else if (aNameCase == "-autotr" || aNameCase == "-autotrian" || aNameCase == "-autotriang"
              || aNameCase == "-autotriangulation" || aNameCase == "-noautotr"
              || aNameCase == "-noautotrian" || aNameCase == "-noautotriang"
@@ -5050,6 +5061,8 @@ static int VDisplay2(Draw_Interpretor& theDI, int theArgNb, const char** theArgV
   }
 
   // Display interactive objects
+  NCollection_List<occ::handle<AIS_InteractiveObject>> aParallelShapes;
+  NCollection_List<occ::handle<AIS_InteractiveObject>> aParallelRedisplay;
   for (int anIter = 1; anIter <= aNamesOfDisplayIO.Length(); ++anIter)
   {
     const TCollection_AsciiString&     aName = aNamesOfDisplayIO.Value(anIter);
@@ -5116,6 +5129,13 @@ static int VDisplay2(Draw_Interpretor& theDI, int theArgNb, const char** theArgV
           aSelMode = aShape->GlobalSelectionMode();
         }
 
+        if (toParallel && isSelectable == -1 && aDispStatus == AIS_DS_None && !toDisplayInView)
+        {
+          // displayed at once by the end
+          aParallelShapes.Append(aShape);
+          continue;
+        }
+
         aCtx->Display(aShape, aDispMode, aSelMode, false, aDispStatus);
         if (toDisplayInView)
         {
@@ -5193,6 +5213,13 @@ static int VDisplay2(Draw_Interpretor& theDI, int theArgNb, const char** theArgV
       }
       if (toReDisplay)
       {
+        if (toParallel && isSelectable == -1 && aDispStatus == AIS_DS_None && !toDisplayInView
+            && anObjDispMode == -2 && aCtx->IsDisplayed(aShape))
+        {
+          // redisplayed at once by the end
+          aParallelRedisplay.Append(aShape);
+          continue;
+        }
         aCtx->Redisplay(aShape, false);
       }
 
@@ -5208,6 +5235,48 @@ static int VDisplay2(Draw_Interpretor& theDI, int theArgNb, const char** theArgV
     }
   }
 
+  if (!aParallelShapes.IsEmpty() || !aParallelRedisplay.IsEmpty())
+  {
+    const bool wasAsync = aCtx->MainPrsMgr()->ToComputeAsync();
+    aCtx->MainPrsMgr()->SetComputeAsync(toAsync);
+    aCtx->Redisplay(aParallelRedisplay, false);
+    aCtx->Display(aParallelShapes, false);
+    aCtx->MainPrsMgr()->SetComputeAsync(wasAsync);
+  }
+  return 0;
+}
+
+//=======================================================================
+// function : VPending
+// purpose  : Displays presentations computed in background
+//=======================================================================
+static int VPending(Draw_Interpretor& theDi, int theArgsNb, const char** theArgVec)
+{
+  const occ::handle<AIS_InteractiveContext>& aCtx = ViewerTest::GetAISContext();
+  if (aCtx.IsNull())
+  {
+    Message::SendFail("Error: no active viewer");
+    return 1;
+  }
+
+  bool toWait = false;
+  for (int anArgIter = 1; anArgIter < theArgsNb; ++anArgIter)
+  {
+    TCollection_AsciiString anArg(theArgVec[anArgIter]);
+    anArg.LowerCase();
+    if (anArg == "-wait")
+    {
+      toWait = true;
+    }
+    else
+    {
+      Message::SendFail() << "Syntax error at '" << theArgVec[anArgIter] << "'";
+      return 1;
+    }
+  }
+
+  aCtx->UpdatePendingPresentations(toWait, true);
+  theDi << aCtx->MainPrsMgr()->NbPendingPresentations();
   return 0;
 }
 
@@ -6605,7 +6674,7 @@ vdisplay [-noupdate|-update] [-mutable] [-neutral]
          [-dispMode mode] [-highMode mode]
          [-layer index] [-top|-topmost|-overlay|-underlay]
          [-redisplay] [-erased]
-         [-noecho] [-autoTriangulation {0|1}]
+         [-noecho] [-autoTriangulation {0|1}] [-parallel] [-async]
          name1 [name2] ... [name n]
 Displays named objects.
  -noupdate      Suppresses viewer redraw call.
@@ -6635,8 +6704,18 @@ Displays named objects.
  -redisplay     Recomputes presentation of objects.
  -noecho        Avoid printing of command results.
  -autoTriang    Enable/disable auto-triangulation for displayed shape.
+ -parallel      Computes presentations of new and redisplayed shapes in parallel threads.
+ -async         Computes presentations of new and redisplayed shapes in background threads,
+                displaying bounding boxes or outdated presentations meanwhile (see vpending).
 )" /* [vdisplay] */);
 
+  addCmd("vpending", VPending, /* [vpending] */ R"(
+vpending [-wait]
+Displays presentations computed in background since the previous call
+(see vdisplay -async) and returns the number of presentations still being computed.
+ -wait  waits for all presentations to be computed.
+)" /* [vpending] */);
+
   addCmd("vnbdisplayed", VNbDisplayed, /* [vnbdisplayed] */ R"(
 vnbdisplayed : Returns number of displayed objects
 )" /* [vnbdisplayed] */);
@@ -3085,6 +3085,7 @@ static int VComputeHLR(Draw_Interpretor&, int theArgNb, const char** theArgVec)
   bool                    hasViewDirArg = false;
   Prs3d_TypeOfHLR         anAlgoType    = Prs3d_TOH_PolyAlgo;
   bool                    toShowCNEdges = false, toShowHiddenEdges = false;
+  bool                    toRunParallel = false;
   int                     aNbIsolines = 0;
   if (occ::handle<V3d_Viewer> aViewer = ViewerTest::GetViewerFromContext())
   {
@@ -3150,6 +3151,14 @@ static int VComputeHLR(Draw_Interpretor&, int theArgNb, const char** theArgVec)
     {
       aNbIsolines = Draw::Atoi(theArgVec[++anArgIter]);
     }
+    else if (anArgCase == "-parallel")
+    {
+      toRunParallel = true;
+      if (anArgIter + 1 < theArgNb && Draw::ParseOnOff(theArgVec[anArgIter + 1], toRunParallel))
+      {
+        ++anArgIter;
+      }
+    }
     else if (aSh.IsNull())
     {
       aSh        = DBRep::Get(theArgVec[anArgIter]);
@@ -3210,6 +3219,7 @@ static int VComputeHLR(Draw_Interpretor&, int theArgNb, const char** theArgVec)
     occ::handle<HLRBRep_PolyAlgo> aPolyAlgo = new HLRBRep_PolyAlgo();
     aPolyAlgo->Projector(aProjector);
     aPolyAlgo->Load(aSh);
+    aPolyAlgo->SetRunParallel(toRunParallel);
     aPolyAlgo->Update();
 
     HLRBRep_PolyHLRToShape aHLRToShape;
@@ -3238,6 +3248,7 @@ static int VComputeHLR(Draw_Interpretor&, int theArgNb, const char** theArgVec)
     occ::handle<HLRBRep_Algo> aHlrAlgo = new HLRBRep_Algo();
     aHlrAlgo->Add(aSh, aNbIsolines);
     aHlrAlgo->Projector(aProjector);
+    aHlrAlgo->SetRunParallel(toRunParallel);
     aHlrAlgo->Update();
     aHlrAlgo->Hide();
 
@@ -6078,6 +6089,42 @@ static int VFont(Draw_Interpretor& theDI, int theArgNb, const char** theArgVec)
       }
       Font_FontMgr::ToUseUnicodeSubsetFallback() = toEnable;
     }
+    else if (anArgCase == "-glyphcache" || anArgCase == "-touseglyphcache")
+    {
+      bool toEnable = true;
+      if (anArgIter + 1 < theArgNb && Draw::ParseOnOff(theArgVec[anArgIter + 1], toEnable))
+      {
+        ++anArgIter;
+      }
+      Font_FontMgr::ToUseGlyphCache() = toEnable;
+    }
+    else if (anArgIter + 1 < theArgNb && anArgCase == "-glyphcachesave")
+    {
+      if (!Font_FontMgr::GlyphCache()->Save(theArgVec[++anArgIter]))
+      {
+        return 1;
+      }
+    }
+    else if (anArgIter + 1 < theArgNb && anArgCase == "-glyphcacheload")
+    {
+      if (!Font_FontMgr::GlyphCache()->Load(theArgVec[++anArgIter]))
+      {
+        return 1;
+      }
+    }
+    else if (anArgCase == "-glyphcacheclear")
+    {
+      Font_FontMgr::GlyphCache()->Clear();
+    }
+    else if (anArgCase == "-glyphcacheinfo")
+    {
+      const occ::handle<Font_GlyphCache>& aCache = Font_FontMgr::GlyphCache();
+      theDI << "Glyph cache: " << (Font_FontMgr::ToUseGlyphCache() ? "on" : "off") << "\n"
+            << "Glyphs: " << aCache->NbGlyphs() << "\n"
+            << "Memory: " << int(aCache->UsedMemory() / 1024) << " KiB\n"
+            << "Hits: " << int(aCache->NbHits()) << "\n"
+            << "Misses: " << int(aCache->NbMisses()) << "\n";
+    }
     else
     {
       Message::SendFail() << "Warning! Unknown argument '" << anArg << "'";
@@ -6957,6 +7004,7 @@ Command for testing object properties as parent in the hierarchy.
 vcomputehlr shapeInput hlrResult [-algoType {algo|polyAlgo}=polyAlgo]
     [eyeX eyeY eyeZ dirX dirY dirZ upX upY upZ]
     [-showTangentEdges {on|off}=off] [-nbIsolines N=0] [-showHiddenEdges {on|off}=off]
+    [-parallel {on|off}=off]
 Arguments:
   shapeInput - name of the initial shape
   hlrResult  - result HLR object from initial shape
@@ -6966,6 +7014,7 @@ Arguments:
  -showTangentEdges include tangent edges
  -nbIsolines include isolines
  -showHiddenEdges include hidden edges
+ -parallel hide the edges in parallel threads
 Use vtop to see projected HLR shape.
 )" /* [vcomputehlr] */);
 
@@ -7106,9 +7155,16 @@ vfont [-add pathToFont [fontName] [regular,bold,italic,boldItalic=undefined] [si
       [-clear] [-init] [-list] [-names]
       [-aliases [aliasName]] [-addAlias Alias FontName] [-removeAlias Alias FontName]
       [-clearAlias Alias] [-clearAliases]
+      [-glyphCache {on|off}] [-glyphCacheSave File] [-glyphCacheLoad File]
+      [-glyphCacheClear] [-glyphCacheInfo]
 Work with font registry - register font, list available fonts, find font.
  -findAll  is same as -find, but can print more than one font when mask is passed.
  -findInfo is same as -find, but prints complete font information instead of family name.
+ -glyphCache      share rasterized glyphs between all fonts, views and threads; off by default.
+ -glyphCacheSave  save rasterized glyphs into the file.
+ -glyphCacheLoad  load rasterized glyphs saved by -glyphCacheSave.
+ -glyphCacheClear release rasterized glyphs.
+ -glyphCacheInfo  print number of cached glyphs, used memory and hits statistics.
 )" /* [vfont] */);
 
   addCmd("vvertexmode", VVertexMode, /* [vvertexmode] */ R"(
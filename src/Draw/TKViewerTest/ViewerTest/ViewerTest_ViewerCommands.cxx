@@ -952,6 +952,11 @@ static int VDriver(Draw_Interpretor& theDi, int theArgsNb, const char** theArgVe
     {
       aNewActive = "tkd3dhost";
     }
+    else if (TCollection_AsciiString::IsSameString(aNewActive, "metal", false)
+             || TCollection_AsciiString::IsSameString(aNewActive, "tkmetal", false))
+    {
+      aNewActive = "metal";
+    }
 
     if (toLoad)
     {
@@ -967,6 +972,10 @@ static int VDriver(Draw_Interpretor& theDi, int theArgsNb, const char** theArgVe
       {
         Draw::GetInterpretor().Eval("pload D3DHOST");
       }
+      else if (aNewActive == "metal")
+      {
+        Draw::GetInterpretor().Eval("pload METAL");
+      }
       else
       {
         theDi << "Syntax error: unable to load plugin for unknown driver factory '" << aNameCopy
@@ -4499,6 +4508,7 @@ inline void printZLayerInfo(Draw_Interpretor& theDI, const Graphic3d_ZLayerSetti
         << theLayer.Origin().Z() << "\n";
   theDI << "  Culling distance: " << theLayer.CullingDistance() << "\n";
   theDI << "  Culling size: " << theLayer.CullingSize() << "\n";
+  theDI << "  LoD pixel error: " << theLayer.LodPixelError() << "\n";
   theDI << "  Depth test:   " << (theLayer.ToEnableDepthTest() ? "enabled" : "disabled") << "\n";
   theDI << "  Depth write:  " << (theLayer.ToEnableDepthWrite() ? "enabled" : "disabled") << "\n";
   theDI << "  Depth buffer clearing: " << (theLayer.ToClearDepth() ? "enabled" : "disabled")
@@ -4733,6 +4743,14 @@ static int VZLayer(Draw_Interpretor& theDI, int theArgNb, const char** theArgVec
       aSettings.SetCullingSize(aSize);
       aViewer->SetZLayerSettings(aLayerId, aSettings);
     }
+    else if (aLayerId != Graphic3d_ZLayerId_UNKNOWN && anArgIter + 1 < theArgNb
+             && (anArg == "-lodpixelerror" || anArg == "-lodtolerance"))
+    {
+      Graphic3d_ZLayerSettings aSettings = aViewer->ZLayerSettings(aLayerId);
+      const double             anError   = Draw::Atof(theArgVec[++anArgIter]);
+      aSettings.SetLodPixelError(anError);
+      aViewer->SetZLayerSettings(aLayerId, aSettings);
+    }
     else if (anArg == "-settings" || anArg == "settings")
     {
       if (aLayerId == Graphic3d_ZLayerId_UNKNOWN)
@@ -9512,6 +9530,11 @@ static int VDefaults(Draw_Interpretor& theDi, int theArgsNb, const char** theArg
     }
     theDi << "AngularDeflection:  " << (180.0 * aDefParams->DeviationAngle() / M_PI) << "\n";
     theDi << "AutoTriangulation:  " << (aDefParams->IsAutoTriangulation() ? "on" : "off") << "\n";
+    theDi << "InstancedTriang:    " << (aDefParams->IsInstancedTriangulation() ? "on" : "off")
+          << "\n";
+    theDi << "NbLods:             " << aDefParams->NbLods() << "\n";
+    theDi << "VertexCache:        " << (aDefParams->IsVertexCacheOptimization() ? "on" : "off")
+          << "\n";
     return 0;
   }
 
@@ -9561,6 +9584,37 @@ static int VDefaults(Draw_Interpretor& theDi, int theArgsNb, const char** theArg
       }
       aDefParams->SetAutoTriangulation(toTurnOn);
     }
+    else if (anArg == "-INSTANCEDTRIANG" || anArg == "-INSTANCEDTRIANGULATION")
+    {
+      ++anArgIter;
+      bool toTurnOn = true;
+      if (anArgIter >= theArgsNb || !Draw::ParseOnOff(theArgVec[anArgIter], toTurnOn))
+      {
+        Message::SendFail() << "Syntax error at '" << anArg << "'";
+        return 1;
+      }
+      aDefParams->SetInstancedTriangulation(toTurnOn);
+    }
+    else if (anArg == "-NBLODS" || anArg == "-LODS")
+    {
+      if (++anArgIter >= theArgsNb)
+      {
+        Message::SendFail() << "Syntax error at " << anArg;
+        return 1;
+      }
+      aDefParams->SetNbLods(Draw::Atoi(theArgVec[anArgIter]));
+    }
+    else if (anArg == "-VERTEXCACHE" || anArg == "-VERTEXCACHEOPTIMIZATION")
+    {
+      ++anArgIter;
+      bool toTurnOn = true;
+      if (anArgIter >= theArgsNb || !Draw::ParseOnOff(theArgVec[anArgIter], toTurnOn))
+      {
+        Message::SendFail() << "Syntax error at '" << anArg << "'";
+        return 1;
+      }
+      aDefParams->SetVertexCacheOptimization(toTurnOn);
+    }
     else
     {
       Message::SendFail() << "Syntax error: unknown argument '" << anArg << "'";
@@ -10558,6 +10612,7 @@ static int VRenderParams(Draw_Interpretor& theDI, int theArgNb, const char** the
     theDI << "blocked RNG:    " << (aParams.CoherentPathTracingMode ? "on" : "off") << "\n";
     theDI << "iss:            " << (aParams.AdaptiveScreenSampling ? "on" : "off") << "\n";
     theDI << "iss debug:      " << (aParams.ShowSamplingTiles ? "on" : "off") << "\n";
+    theDI << "denoise:        " << (aParams.ToDenoise ? "on" : "off") << "\n";
     theDI << "two-sided BSDF: " << (aParams.TwoSidedBsdfModels ? "on" : "off") << "\n";
     theDI << "max radiance:   " << aParams.RadianceClampingValue << "\n";
     theDI << "nb tiles (iss): " << aParams.NbRayTracingTiles << "\n";
@@ -11257,6 +11312,21 @@ static int VRenderParams(Draw_Interpretor& theDI, int theArgNb, const char** the
       }
       aParams.AdaptiveScreenSamplingAtomic = toEnable;
     }
+    else if (aFlag == "-denoise")
+    {
+      if (toPrint)
+      {
+        theDI << (aParams.ToDenoise ? "on" : "off") << " ";
+        continue;
+      }
+
+      bool toEnable = true;
+      if (++anArgIter < theArgNb && !Draw::ParseOnOff(theArgVec[anArgIter], toEnable))
+      {
+        --anArgIter;
+      }
+      aParams.ToDenoise = toEnable;
+    }
     else if (aFlag == "-issd")
     {
       if (toPrint)
@@ -12710,6 +12780,28 @@ static int VSelectionProperties(Draw_Interpretor& theDi, int theArgsNb, const ch
       }
       aCtx->MainSelector()->SetPickClosest(toPreferClosest);
     }
+    else if (anArg == "-lazybvh")
+    {
+      bool toLazyBvh = true;
+      if (anArgIter + 1 < theArgsNb && Draw::ParseOnOff(theArgVec[anArgIter + 1], toLazyBvh))
+      {
+        ++anArgIter;
+      }
+      aCtx->SelectionManager()->SetLazyBVH(toLazyBvh);
+    }
+    else if (anArg == "-paralleltraversal" || anArg == "-parallel")
+    {
+      bool toParallel = true;
+      if (anArgIter + 1 < theArgsNb && Draw::ParseOnOff(theArgVec[anArgIter + 1], toParallel))
+      {
+        ++anArgIter;
+      }
+      aCtx->MainSelector()->SetToTraverseParallel(toParallel);
+    }
+    else if ((anArg == "-compacttriangulation" || anArg == "-compact") && anArgIter + 1 < theArgsNb)
+    {
+      aCtx->DefaultDrawer()->SetSelectionCompactThreshold(Draw::Atoi(theArgVec[++anArgIter]));
+    }
     else if ((anArg == "-depthtol" || anArg == "-depthtolerance") && anArgIter + 1 < theArgsNb)
     {
       TCollection_AsciiString aTolType(theArgVec[++anArgIter]);
@@ -12878,6 +12970,12 @@ static int VSelectionProperties(Draw_Interpretor& theDi, int theArgsNb, const ch
     theDi << "Highlight selected             : " << (aCtx->ToHilightSelected() ? "On" : "Off")
           << "\n";
     theDi << "Selection pixel tolerance      : " << aCtx->MainSelector()->PixelTolerance() << "\n";
+    theDi << "Lazy BVH                       : "
+          << (aCtx->SelectionManager()->IsLazyBVH() ? "On" : "Off") << "\n";
+    theDi << "Parallel traversal             : "
+          << (aCtx->MainSelector()->ToTraverseParallel() ? "On" : "Off") << "\n";
+    theDi << "Compact triangulation          : "
+          << aCtx->DefaultDrawer()->SelectionCompactThreshold() << "\n";
     theDi << "Selection color                : "
           << Quantity_Color::StringName(aSelStyle->Color().Name()) << "\n";
     theDi << "Dynamic highlight color        : "
@@ -13935,7 +14033,7 @@ Setup view to draw a tile (a part of virtual bigger viewport).
   addCmd("vzlayer", VZLayer, /* [vzlayer] */ R"(
 vzlayer [layerId]
         [-add|-delete|-get|-settings] [-insertBefore AnotherLayer] [-insertAfter AnotherLayer]
-        [-origin X Y Z] [-cullDist Distance] [-cullSize Size]
+        [-origin X Y Z] [-cullDist Distance] [-cullSize Size] [-lodPixelError Value]
         [-enable|-disable {depthTest|depthWrite|depthClear|depthoffset}]
         [-enable|-disable {positiveOffset|negativeOffset|textureenv|rayTracing}]
 ZLayer list management
@@ -13947,6 +14045,7 @@ ZLayer list management
  -settings print status of z layer settings
  -disable  disables given setting
  -enable   enables  given setting
+ -lodPixelError maximal projected deflection in pixels of displayed level of detail
 )" /* [vzlayer] */);
 
   addCmd("vlayerline", VLayerLine, /* [vlayerline] */ R"(
@@ -14297,7 +14396,13 @@ Capping options:
 
   addCmd("vdefaults", VDefaults, /* [vdefaults] */ R"(
 vdefaults [-absDefl value] [-devCoeff value] [-angDefl value]
-          [-autoTriang {off/on | 0/1}]
+          [-autoTriang {off/on | 0/1}] [-instancedTriang {off/on | 0/1}] [-nbLods N]
+          [-vertexCache {off/on | 0/1}]
+ -instancedTriang share triangulation of sub-shapes repeated with different locations
+                  within shaded presentation (groups with own transformation).
+ -nbLods          number of levels of detail of shaded presentation (1 by default);
+                  coarser levels are meshed with larger deflection and chosen by projected deflection.
+ -vertexCache     reorder triangles of shaded presentation for GPU vertex cache and overdraw.
 )" /* [vdefaults] */);
 
   addCmd("vlight", VLight, /* [vlight] */ R"(
@@ -14437,7 +14542,7 @@ vrenderparams [-rayTrace] [-rayDepth {0..10}=3] [-reflections {on|off}=off]
               [-gi {on|off}=off] [-brng {on|off}=off]
               [-iss {on|off}=off] [-tileSize {1..4096}=32] [-nbTiles {64..1024}=256]
               [-ignoreNormalMap {on|off}=off] [-twoSide {on|off}=off]
-              [-maxRad {value>0}=30.0]
+              [-maxRad {value>0}=30.0] [-denoise {on|off}=off]
               [-aperture {value>=0}=0.0] [-focal {value>=0.0}=1.0]
               [-exposure value=0.0] [-whitePoint value=1.0] [-toneMapping {disabled|filmic}=disabled]
  -rayTrace     Enables  GPU ray-tracing.
@@ -14451,6 +14556,7 @@ vrenderparams [-rayTrace] [-rayDepth {0..10}=3] [-reflections {on|off}=off]
  -twoSide      Enables/disables two-sided BSDF models (PT mode).
  -iss          Enables/disables adaptive screen sampling (PT mode).
  -maxRad       Value used for clamping radiance estimation (PT mode).
+ -denoise      Enables/disables real-time denoising of accumulated image (PT mode).
  -tileSize     Specifies   size of screen tiles in ISS mode (32 by default).
  -nbTiles      Specifies number of screen tiles per Redraw in ISS mode (256 by default).
  -aperture     Aperture size  of perspective camera for depth-of-field effect (0 disables DOF).
@@ -14542,6 +14648,12 @@ Customizes selection and dynamic highlight parameters for the whole interactive
  -depthTol {uniform|uniformpx} value : sets tolerance for sorting results by depth
  -depthTol {sensfactor}  use sensitive factor for sorting results by depth
  -preferClosest {0|1}    sets if depth should take precedence over priority while sorting results
+ -lazyBvh {0|1}          builds BVH of heavyweight sensitive entities on first picking
+                         instead of selection activation
+ -parallelTraversal {0|1} traverses objects in parallel threads by rectangle and polyline selection
+ -compactTriangulation minNbTriangles : face triangulations with at least specified number
+                         of triangles get compact sensitive entities (0 to disable);
+                         applied to objects with selection computed afterwards
  -dispMode  dispMode     sets display mode for highlighting
  -layer     ZLayer       sets ZLayer for highlighting
  -color     {name|r g b} sets highlight color
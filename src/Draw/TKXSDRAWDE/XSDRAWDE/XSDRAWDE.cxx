@@ -16,6 +16,7 @@
 #include <DBRep.hxx>
 #include <DDocStd.hxx>
 #include <DDocStd_DrawDocument.hxx>
+#include <DE_BatchConverter.hxx>
 #include <DE_ConfigurationContext.hxx>
 #include <DE_Provider.hxx>
 #include <DE_Wrapper.hxx>
@@ -27,8 +28,10 @@
 #include <Draw_PluginMacro.hxx>
 #include <Draw_ProgressIndicator.hxx>
 #include <Message.hxx>
+#include <NCollection_Sequence.hxx>
 #include <TDataStd_Name.hxx>
 #include <TDocStd_Application.hxx>
+#include <TDocStd_Document.hxx>
 #include <TopoDS_Shape.hxx>
 #include <XSControl_WorkSession.hxx>
 #include <XSDRAW.hxx>
@@ -41,6 +44,23 @@ void DECascadeSingleton()
   static DE_MultiPluginHolder<DEBREP_ConfigurationNode, DEXCAF_ConfigurationNode> aHolder;
   (void)aHolder;
 }
+
+//! Batch converter transferring files through standalone XDE documents.
+class XSDRAWDE_XdeBatchConverter : public DE_BatchConverter
+{
+public:
+  XSDRAWDE_XdeBatchConverter(const occ::handle<DE_Wrapper>& theWrapper)
+      : DE_BatchConverter(theWrapper)
+  {
+  }
+
+protected:
+  //! Create document not registered in the application, which is not thread-safe.
+  occ::handle<TDocStd_Document> createDocument(const DE_BatchJob&) override
+  {
+    return new TDocStd_Document("BinXCAF");
+  }
+};
 } // namespace
 
 //=================================================================================================
@@ -362,6 +382,114 @@ static int WriteFile(Draw_Interpretor& theDI, int theNbArgs, const char** theArg
 
 //=================================================================================================
 
+static int ConvertFiles(Draw_Interpretor& theDI, int theNbArgs, const char** theArgVec)
+{
+  TCollection_AsciiString           aConfString;
+  NCollection_Sequence<DE_BatchJob> aJobSeq;
+  TCollection_AsciiString           anInputPath;
+  int                               aPriority  = 0;
+  int                               aNbThreads = -1;
+  double                            aMemLimit  = 0.0;
+  double                            aMemFactor = -1.0;
+  bool                              isNoDoc    = false;
+  for (int anArgIter = 1; anArgIter < theNbArgs; ++anArgIter)
+  {
+    TCollection_AsciiString anArg(theArgVec[anArgIter]);
+    anArg.LowerCase();
+    if (anArg == "-conf" && anArgIter + 1 < theNbArgs)
+    {
+      aConfString = theArgVec[++anArgIter];
+    }
+    else if ((anArg == "-nbthreads" || anArg == "-threads") && anArgIter + 1 < theNbArgs
+             && Draw::ParseInteger(theArgVec[anArgIter + 1], aNbThreads))
+    {
+      ++anArgIter;
+    }
+    else if ((anArg == "-memlimit" || anArg == "-memorylimit") && anArgIter + 1 < theNbArgs
+             && Draw::ParseReal(theArgVec[anArgIter + 1], aMemLimit) && aMemLimit >= 0.0)
+    {
+      ++anArgIter;
+    }
+    else if ((anArg == "-memfactor" || anArg == "-memoryfactor") && anArgIter + 1 < theNbArgs
+             && Draw::ParseReal(theArgVec[anArgIter + 1], aMemFactor) && aMemFactor >= 0.0)
+    {
+      ++anArgIter;
+    }
+    else if (anArg == "-priority" && anArgIter + 1 < theNbArgs
+             && Draw::ParseInteger(theArgVec[anArgIter + 1], aPriority))
+    {
+      ++anArgIter;
+    }
+    else if (anArg == "-nodoc" || anArg == "-shape")
+    {
+      isNoDoc = Draw::ParseOnOffIterator(theNbArgs, theArgVec, anArgIter);
+    }
+    else if (anInputPath.IsEmpty())
+    {
+      anInputPath = theArgVec[anArgIter];
+    }
+    else
+    {
+      aJobSeq.Append(DE_BatchJob(anInputPath, theArgVec[anArgIter], aPriority));
+      anInputPath.Clear();
+    }
+  }
+  if (aJobSeq.IsEmpty() || !anInputPath.IsEmpty())
+  {
+    theDI << "Syntax error: wrong number of arguments\n";
+    return 1;
+  }
+
+  occ::handle<DE_Wrapper> aConf = DE_Wrapper::GlobalWrapper()->Copy();
+  if (!aConfString.IsEmpty() && !aConf->Load(aConfString))
+  {
+    return 1;
+  }
+
+  XSDRAWDE_XdeBatchConverter aDocConverter(aConf);
+  DE_BatchConverter          aShapeConverter(aConf);
+  DE_BatchConverter&         aConverter = isNoDoc ? aShapeConverter : aDocConverter;
+  aConverter.SetNbThreads(aNbThreads);
+  aConverter.SetMemoryLimit(size_t(aMemLimit * 1024.0 * 1024.0));
+  if (aMemFactor >= 0.0)
+  {
+    aConverter.SetMemoryFactor(aMemFactor);
+  }
+
+  NCollection_Array1<DE_BatchJob> aJobs(1, aJobSeq.Length());
+  for (int aJobIter = 1; aJobIter <= aJobSeq.Length(); ++aJobIter)
+  {
+    aJobs.SetValue(aJobIter, aJobSeq.Value(aJobIter));
+  }
+
+  occ::handle<Draw_ProgressIndicator> aProgress = new Draw_ProgressIndicator(theDI, 1);
+  const bool                          isDone    = aConverter.Perform(aJobs, aProgress->Start());
+  for (NCollection_Array1<DE_BatchJob>::Iterator aJobIter(aJobs); aJobIter.More(); aJobIter.Next())
+  {
+    const DE_BatchJob& aJob = aJobIter.Value();
+    theDI << aJob.InputPath << " -> " << aJob.OutputPath << ": ";
+    switch (aJob.Status)
+    {
+      case DE_BatchJobStatus_Pending:
+      case DE_BatchJobStatus_Aborted:
+        theDI << "Aborted";
+        break;
+      case DE_BatchJobStatus_Done:
+        theDI << "Done";
+        break;
+      case DE_BatchJobStatus_ReadFailed:
+      case DE_BatchJobStatus_WriteFailed:
+      case DE_BatchJobStatus_Failed:
+        theDI << aJob.Message;
+        break;
+    }
+    theDI << " (" << aJob.ElapsedTime << " s)\n";
+  }
+  return isDone ? 0 : 1;
+}
+
+//=================================================================================================
+
 void XSDRAWDE::Factory(Draw_Interpretor& theDI)
 {
   static bool aIsActivated = false;
@@ -435,6 +563,26 @@ void XSDRAWDE::Factory(Draw_Interpretor& theDI)
             __FILE__,
             WriteFile,
             aGroup);
+  theDI.Add(
+    "ConvertFiles",
+    "ConvertFiles [-conf <value|path>] [-nbThreads N] [-memLimit MiB] [-memFactor F]"
+    "\n\t\t:              [-noDoc] [-priority P] input1 output1 [[-priority P] input2 output2 ...]"
+    "\n\t\t: Convert CAD files concurrently with registered format's providers."
+    "\n\t\t: Each file is read and written independently within its own session;"
+    "\n\t\t: use global configuration by default."
+    "\n\t\t:   -conf      configuration to apply to all conversions;"
+    "\n\t\t:   -nbThreads maximum number of concurrent conversions;"
+    "\n\t\t:              number of threads in the pool by default;"
+    "\n\t\t:   -memLimit  memory budget for concurrent conversions in MiB;"
+    "\n\t\t:              0 (unlimited) by default;"
+    "\n\t\t:   -memFactor factor applied to input file size to estimate memory of conversion;"
+    "\n\t\t:              10 by default;"
+    "\n\t\t:   -noDoc     transfer shapes instead of XDE documents;"
+    "\n\t\t:   -priority  priority of the following files; files with higher priority"
+    "\n\t\t:              are converted first; 0 by default.",
+    __FILE__,
+    ConvertFiles,
+    aGroup);
 
   // Load XSDRAW session for pilot activation
   XSDRAW::LoadDraw(theDI);
@@ -308,6 +308,7 @@ static int WriteGltf(Draw_Interpretor& theDI, int theNbArgs, const char** theArg
   bool                    toForceUVExport = false, toEmbedTexturesInGlb = true;
   bool                    toMergeFaces = false, toSplitIndices16 = false;
   bool                    isParallel      = false;
+  bool                    toUseMeshopt    = false;
   RWMesh_NameFormat       aNodeNameFormat = RWMesh_NameFormat_InstanceOrProduct;
   RWMesh_NameFormat       aMeshNameFormat = RWMesh_NameFormat_Product;
   RWGltf_DracoParameters  aDracoParameters;
@@ -433,6 +434,10 @@ static int WriteGltf(Draw_Interpretor& theDI, int theNbArgs, const char** theArg
     {
       aDracoParameters.DracoCompression = Draw::ParseOnOffIterator(theNbArgs, theArgVec, anArgIter);
     }
+    else if (anArgCase == "-meshopt")
+    {
+      toUseMeshopt = Draw::ParseOnOffIterator(theNbArgs, theArgVec, anArgIter);
+    }
     else if (anArgCase == "-compressionlevel" && (anArgIter + 1) < theNbArgs
              && Draw::ParseInteger(theArgVec[anArgIter + 1], aDracoParameters.CompressionLevel))
     {
@@ -501,6 +506,7 @@ static int WriteGltf(Draw_Interpretor& theDI, int theNbArgs, const char** theArg
   aWriter.SetSplitIndices16(toSplitIndices16);
   aWriter.SetParallel(isParallel);
   aWriter.SetCompressionParameters(aDracoParameters);
+  aWriter.SetMeshoptCompression(toUseMeshopt);
   aWriter.ChangeCoordinateSystemConverter().SetInputLengthUnit(aScaleFactorM);
   aWriter.ChangeCoordinateSystemConverter().SetInputCoordinateSystem(aSystemCoordSys);
   aWriter.Perform(aDoc, aFileInfo, aProgress->Start());
@@ -565,7 +571,7 @@ void XSDRAWGLTF::Factory(Draw_Interpretor& theDI)
     "[-quantizeNormalBits Value]=10"
     "\n\t\t:            [-quantizeTexcoordBits Value]=12 [-quantizeColorBits Value]=8 "
     "[-quantizeGenericBits Value]=12"
-    "\n\t\t:            [-unifiedQuantization]=0 [-parallel]=0"
+    "\n\t\t:            [-unifiedQuantization]=0 [-meshopt]=0 [-parallel]=0"
     "\n\t\t: Write XDE document into glTF file."
     "\n\t\t:   -trsfFormat       preferred transformation format"
     "\n\t\t:   -systemCoordSys   system coordinate system; Zup when not specified"
@@ -591,7 +597,8 @@ void XSDRAWGLTF::Factory(Draw_Interpretor& theDI)
     "\n                        and custom attributes when using Draco compression (by default 12)"
     "\n\t\t:   -unifiedQuantization  quantization is applied on each primitive separately if this "
     "option is false"
-    "\n\t\t:   -parallel             use multithreading for Draco compression",
+    "\n\t\t:   -meshopt              compress buffer views using EXT_meshopt_compression"
+    "\n\t\t:   -parallel             use multithreading for Draco and meshopt compression",
     __FILE__,
     WriteGltf,
     aGroup);
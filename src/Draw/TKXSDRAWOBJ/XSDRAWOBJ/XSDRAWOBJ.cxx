@@ -67,6 +67,7 @@ static int ReadObj(Draw_Interpretor& theDI, int theNbArgs, const char** theArgVe
   RWMesh_CoordinateSystem aResultCoordSys  = RWMesh_CoordinateSystem_Zup,
                           aFileCoordSys    = RWMesh_CoordinateSystem_Yup;
   bool toListExternalFiles = false, isSingleFace = false, isSinglePrecision = false;
+  bool isParallel = false;
   bool isNoDoc = (TCollection_AsciiString(theArgVec[0]) == "readobj");
   for (int anArgIter = 1; anArgIter < theNbArgs; ++anArgIter)
   {
@@ -115,6 +116,14 @@ static int ReadObj(Draw_Interpretor& theDI, int theNbArgs, const char** theArgVe
         ++anArgIter;
       }
     }
+    else if (anArgCase == "-parallel")
+    {
+      isParallel = true;
+      if (anArgIter + 1 < theNbArgs && Draw::ParseOnOff(theArgVec[anArgIter + 1], isParallel))
+      {
+        ++anArgIter;
+      }
+    }
     else if (isNoDoc && (anArgCase == "-singleface" || anArgCase == "-singletriangulation"))
     {
       isSingleFace = true;
@@ -179,6 +188,7 @@ static int ReadObj(Draw_Interpretor& theDI, int theNbArgs, const char** theArgVe
 
   RWObj_CafReader aReader;
   aReader.SetSinglePrecision(isSinglePrecision);
+  aReader.SetParallel(isParallel);
   aReader.SetSystemLengthUnit(aScaleFactorM);
   aReader.SetSystemCoordinateSystem(aResultCoordSys);
   aReader.SetFileLengthUnit(aFileUnitFactor);
@@ -188,6 +198,7 @@ static int ReadObj(Draw_Interpretor& theDI, int theNbArgs, const char** theArgVe
   {
     RWObj_TriangulationReader aSimpleReader;
     aSimpleReader.SetSinglePrecision(isSinglePrecision);
+    aSimpleReader.SetParallel(isParallel);
     aSimpleReader.SetCreateShapes(false);
     aSimpleReader.SetTransformation(aReader.CoordinateSystemConverter());
     aSimpleReader.Read(aFilePath.ToCString(), aProgress->Start());
@@ -361,7 +372,7 @@ void XSDRAWOBJ::Factory(Draw_Interpretor& theDI)
     "ReadObj",
     "ReadObj Doc file [-fileCoordSys {Zup|Yup}] [-fileUnit Unit]"
     "\n\t\t:                  [-resultCoordSys {Zup|Yup}] [-singlePrecision]"
-    "\n\t\t:                  [-listExternalFiles] [-noCreateDoc]"
+    "\n\t\t:                  [-listExternalFiles] [-noCreateDoc] [-parallel]"
     "\n\t\t: Read OBJ file into XDE document."
     "\n\t\t:   -fileUnit       length unit of OBJ file content;"
     "\n\t\t:   -fileCoordSys   coordinate system defined by OBJ file; Yup when not specified."
@@ -369,14 +380,15 @@ void XSDRAWOBJ::Factory(Draw_Interpretor& theDI)
     "\n\t\t:   -singlePrecision truncate vertex data to single precision during read; FALSE by "
     "default."
     "\n\t\t:   -listExternalFiles do not read mesh and only list external files."
-    "\n\t\t:   -noCreateDoc    read into existing XDE document.",
+    "\n\t\t:   -noCreateDoc    read into existing XDE document."
+    "\n\t\t:   -parallel       parse file in parallel threads; FALSE by default.",
     __FILE__,
     ReadObj,
     aGroup);
   theDI.Add("readobj",
             "readobj shape file [-fileCoordSys {Zup|Yup}] [-fileUnit Unit]"
             "\n\t\t:                    [-resultCoordSys {Zup|Yup}] [-singlePrecision]"
-            "\n\t\t:                    [-singleFace]"
+            "\n\t\t:                    [-singleFace] [-parallel]"
             "\n\t\t: Same as ReadObj but reads OBJ file into a shape instead of a document."
             "\n\t\t:   -singleFace merge OBJ content into a single triangulation Face.",
             __FILE__,
@@ -26,10 +26,12 @@
 #include <Draw_ProgressIndicator.hxx>
 #include <RWMesh_FaceIterator.hxx>
 #include <RWPly_CafWriter.hxx>
+#include <RWPly_PlyReader.hxx>
 #include <RWPly_PlyWriterContext.hxx>
 #include <TDataStd_Name.hxx>
 #include <TDocStd_Application.hxx>
 #include <TopoDS_Compound.hxx>
+#include <TopoDS_Face.hxx>
 #include <TopoDS_Shape.hxx>
 #include <UnitsAPI.hxx>
 #include <XCAFDoc_DocumentTool.hxx>
@@ -51,7 +53,7 @@ static int WritePly(Draw_Interpretor& theDI, int theNbArgs, const char** theArgV
   double aTol      = Precision::Confusion();
   bool   hasColors = true, hasNormals = true, hasTexCoords = false, hasPartId = true,
        hasFaceId = false;
-  bool isPntSet = false, isDensityPoints = false;
+  bool isPntSet = false, isDensityPoints = false, isBinary = false, isParallel = false;
   NCollection_IndexedDataMap<TCollection_AsciiString, TCollection_AsciiString> aFileInfo;
   for (int anArgIter = 1; anArgIter < theNbArgs; ++anArgIter)
   {
@@ -83,6 +85,15 @@ static int WritePly(Draw_Interpretor& theDI, int theNbArgs, const char** theArgV
       hasFaceId = Draw::ParseOnOffNoIterator(theNbArgs, theArgVec, anArgIter);
       hasPartId = hasPartId && !hasFaceId;
     }
+    else if (anArg == "-binary" || anArg == "-ascii")
+    {
+      isBinary = Draw::ParseOnOffIterator(theNbArgs, theArgVec, anArgIter);
+      isBinary = anArg == "-ascii" ? !isBinary : isBinary;
+    }
+    else if (anArg == "-parallel")
+    {
+      isParallel = Draw::ParseOnOffIterator(theNbArgs, theArgVec, anArgIter);
+    }
     else if (anArg == "-pntset" || anArg == "-pntcloud" || anArg == "-pointset"
              || anArg == "-pointcloud" || anArg == "-cloud" || anArg == "-points")
     {
@@ -216,6 +227,7 @@ static int WritePly(Draw_Interpretor& theDI, int theNbArgs, const char** theArgV
     };
 
     PointCloudPlyWriter aPlyCtx(aTol);
+    aPlyCtx.SetBinary(isBinary);
     aPlyCtx.SetNormals(hasNormals);
     aPlyCtx.SetColors(hasColors);
     aPlyCtx.SetTexCoords(hasTexCoords);
@@ -288,6 +300,8 @@ static int WritePly(Draw_Interpretor& theDI, int theNbArgs, const char** theArgV
   {
     occ::handle<Draw_ProgressIndicator> aProgress = new Draw_ProgressIndicator(theDI, 1);
     RWPly_CafWriter                     aPlyCtx(aFileName);
+    aPlyCtx.SetBinary(isBinary);
+    aPlyCtx.SetParallel(isParallel);
     aPlyCtx.SetNormals(hasNormals);
     aPlyCtx.SetColors(hasColors);
     aPlyCtx.SetTexCoords(hasTexCoords);
@@ -298,6 +312,63 @@ static int WritePly(Draw_Interpretor& theDI, int theNbArgs, const char** theArgV
   return 0;
 }
 
+//=================================================================================================
+
+static int ReadPly(Draw_Interpretor& theDI, int theNbArgs, const char** theArgVec)
+{
+  TCollection_AsciiString aShapeName, aFileName;
+  bool                    isParallel = false;
+  for (int anArgIter = 1; anArgIter < theNbArgs; ++anArgIter)
+  {
+    TCollection_AsciiString anArg(theArgVec[anArgIter]);
+    anArg.LowerCase();
+    if (anArg == "-parallel")
+    {
+      isParallel = Draw::ParseOnOffIterator(theNbArgs, theArgVec, anArgIter);
+    }
+    else if (aShapeName.IsEmpty())
+    {
+      aShapeName = theArgVec[anArgIter];
+    }
+    else if (aFileName.IsEmpty())
+    {
+      aFileName = theArgVec[anArgIter];
+    }
+    else
+    {
+      theDI << "Syntax error at '" << theArgVec[anArgIter] << "'";
+      return 1;
+    }
+  }
+  if (aFileName.IsEmpty())
+  {
+    theDI << "Syntax error: wrong number of arguments";
+    return 1;
+  }
+
+  occ::handle<Draw_ProgressIndicator> aProgress = new Draw_ProgressIndicator(theDI, 1);
+  occ::handle<RWPly_PlyReader>        aReader   = new RWPly_PlyReader();
+  aReader->SetParallel(isParallel);
+  if (!aReader->Read(aFileName, aProgress->Start()))
+  {
+    theDI << "Error: file '" << aFileName << "' cannot be read";
+    return 1;
+  }
+
+  if (!aReader->Triangulation().IsNull())
+  {
+    TopoDS_Face aFace;
+    BRep_Builder().MakeFace(aFace, aReader->Triangulation());
+    DBRep::Set(aShapeName.ToCString(), aFace);
+  }
+  else
+  {
+    theDI << "Point cloud of " << aReader->Points()->VertexNumber()
+          << " points has been read (no shape is created)";
+  }
+  return 0;
+}
+
 namespace
 {
 // Singleton to ensure DEPLY plugin is registered only once
@@ -327,6 +398,7 @@ void XSDRAWPLY::Factory(Draw_Interpretor& theDI)
   theDI.Add("WritePly",
             R"(
 WritePly Doc file [-normals {0|1}]=1 [-colors {0|1}]=1 [-uv {0|1}]=0 [-partId {0|1}]=1 [-faceId {0|1}]=0
+                  [-binary {0|1}]=0 [-parallel {0|1}]=0
                   [-pointCloud {0|1}]=0 [-distance Value]=0.0 [-density Value] [-tolerance Value]
 Write document or triangulated shape into PLY file.
  -normals write per-vertex normals
@@ -334,6 +406,8 @@ Write document or triangulated shape into PLY file.
  -uv      write per-vertex UV coordinates
  -partId  write per-element part index (alternative to -faceId)
  -faceId  write per-element face index (alternative to -partId)
+ -binary  write binary little-endian file instead of ASCII
+ -parallel encode binary vertex and element blocks in parallel threads
 
 Generate point cloud out of the shape and write it into PLY file.
  -pointCloud write point cloud instead without triangulation indices
@@ -345,6 +419,16 @@ Generate point cloud out of the shape and write it into PLY file.
             WritePly,
             aGroup);
   theDI.Add("writeply", "writeply shape file", __FILE__, WritePly, aGroup);
+  theDI.Add("readply",
+            R"(
+readply shape file [-parallel {0|1}]=0
+Read binary little-endian PLY file into triangulated face.
+Point cloud (file defining no faces) is only loaded and reported.
+ -parallel decode vertex and face data in parallel threads
+)",
+            __FILE__,
+            ReadPly,
+            aGroup);
 
   // Load XSDRAW session for pilot activation
   XSDRAW::LoadDraw(theDI);
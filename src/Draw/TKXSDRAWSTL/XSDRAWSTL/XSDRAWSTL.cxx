@@ -15,6 +15,7 @@
 
 #include <AIS_InteractiveContext.hxx>
 #include <BRep_Builder.hxx>
+#include <BRep_FacetedMesh.hxx>
 #include <DBRep.hxx>
 #include <DDocStd.hxx>
 #include <DDocStd_DrawDocument.hxx>
@@ -86,7 +87,9 @@ static int readstl(Draw_Interpretor& theDI, int theArgc, const char** theArgv)
 {
   TCollection_AsciiString aShapeName, aFilePath;
   bool                    toCreateCompOfTris = false;
+  bool                    isCompact          = false;
   bool                    anIsMulti          = false;
+  bool                    isParallel         = false;
   double                  aMergeAngle        = M_PI / 2.0;
   for (int anArgIter = 1; anArgIter < theArgc; ++anArgIter)
   {
@@ -108,6 +111,15 @@ static int readstl(Draw_Interpretor& theDI, int theArgc, const char** theArgv)
         ++anArgIter;
       }
     }
+    else if (anArg == "-compact")
+    {
+      isCompact = true;
+      if (anArgIter + 1 < theArgc && Draw::ParseOnOff(theArgv[anArgIter + 1], isCompact))
+      {
+        ++anArgIter;
+      }
+      toCreateCompOfTris = toCreateCompOfTris || isCompact;
+    }
     else if (anArg == "-multi")
     {
       anIsMulti = true;
@@ -116,6 +128,14 @@ static int readstl(Draw_Interpretor& theDI, int theArgc, const char** theArgv)
         ++anArgIter;
       }
     }
+    else if (anArg == "-parallel")
+    {
+      isParallel = true;
+      if (anArgIter + 1 < theArgc && Draw::ParseOnOff(theArgv[anArgIter + 1], isParallel))
+      {
+        ++anArgIter;
+      }
+    }
     else if (anArg == "-mergeangle" || anArg == "-smoothangle" || anArg == "-nomergeangle"
              || anArg == "-nosmoothangle")
     {
@@ -159,7 +179,11 @@ static int readstl(Draw_Interpretor& theDI, int theArgc, const char** theArgv)
     {
       NCollection_Sequence<occ::handle<Poly_Triangulation>> aTriangList;
       // Read STL file to the triangulation list.
-      RWStl::ReadFile(aFilePath.ToCString(), aMergeAngle, aTriangList, aProgress->Start());
+      RWStl::ReadFile(aFilePath.ToCString(),
+                      aMergeAngle,
+                      aTriangList,
+                      aProgress->Start(),
+                      isParallel);
       BRep_Builder aB;
       TopoDS_Face  aFace;
       if (aTriangList.Size() == 1)
@@ -187,7 +211,7 @@ static int readstl(Draw_Interpretor& theDI, int theArgc, const char** theArgv)
     {
       // Read STL file to the triangulation.
       occ::handle<Poly_Triangulation> aTriangulation =
-        RWStl::ReadFile(aFilePath.ToCString(), aMergeAngle, aProgress->Start());
+        RWStl::ReadFile(aFilePath.ToCString(), aMergeAngle, aProgress->Start(), isParallel);
 
       TopoDS_Face  aFace;
       BRep_Builder aB;
@@ -196,6 +220,10 @@ static int readstl(Draw_Interpretor& theDI, int theArgc, const char** theArgv)
       aShape = aFace;
     }
   }
+  else if (isCompact)
+  {
+    aShape = BRep_FacetedMesh::MakeCompound(RWStl::ReadFile(aFilePath.ToCString()));
+  }
   else
   {
     Standard_DISABLE_DEPRECATION_WARNINGS StlAPI::Read(aShape, aFilePath.ToCString());
@@ -654,6 +682,41 @@ static int showall(Draw_Interpretor& theDI, int theNbArgs, const char** theArgVe
 
 //=================================================================================================
 
+//! Compute color scale map values (0..1) of mesh nodes from coordinates along specified axis.
+static void computeNodalScaleMap(const occ::handle<MeshVS_Mesh>&   theMesh,
+                                 const int                         theAxis,
+                                 NCollection_DataMap<int, double>& theScaleMap)
+{
+  occ::handle<MeshVS_DataSource> aDataSource = theMesh->GetDataSource();
+  double                         aMin[3], aMax[3];
+
+  // get bounding box for calculations
+  aDataSource->GetBoundingBox().Get(aMin[0], aMin[1], aMin[2], aMax[0], aMax[1], aMax[2]);
+  const double aDelta = aMax[theAxis] - aMin[theAxis];
+
+  // assign color scale map values (0..1) to nodes
+  NCollection_Array1<double> aCoords(1, 3);
+  int                        aNbNodes;
+  MeshVS_EntityType          aType;
+
+  // iterate nodes
+  const TColStd_PackedMapOfInteger& anAllNodes = aDataSource->GetAllNodes();
+  for (TColStd_PackedMapOfInteger::Iterator anIter(anAllNodes); anIter.More(); anIter.Next())
+  {
+    // get node coordinates to aCoord variable
+    aDataSource->GetGeom(anIter.Key(), false, aCoords, aNbNodes, aType);
+
+    double aScaleValue = 0.0;
+    if (aDelta > Precision::Confusion())
+    {
+      aScaleValue = (aCoords.Value(1 + theAxis) - aMin[theAxis]) / aDelta;
+    }
+    theScaleMap.Bind(anIter.Key(), aScaleValue);
+  }
+}
+
+//=================================================================================================
+
 static int meshcolors(Draw_Interpretor& theDI, int theNbArgs, const char** theArgVec)
 {
   try
@@ -662,7 +725,7 @@ static int meshcolors(Draw_Interpretor& theDI, int theNbArgs, const char** theAr
     if (theNbArgs < 4)
     {
       theDI << "Wrong number of parameters\n";
-      theDI << "Use : meshcolors <mesh name> <mode> <isreflect>\n";
+      theDI << "Use : meshcolors <mesh name> <mode> <isreflect> [-mutable]\n";
       theDI << "mode : {elem1|elem2|nodal|nodaltex|none}\n";
       theDI << "       elem1 - different color for each element\n";
       theDI << "       elem2 - one color for one side\n";
@@ -670,6 +733,7 @@ static int meshcolors(Draw_Interpretor& theDI, int theNbArgs, const char** theAr
       theDI << "       nodaltex - different color for each node with texture interpolation\n";
       theDI << "       none  - clear\n";
       theDI << "isreflect : {0|1} \n";
+      theDI << "-mutable : allow updating nodaltex colors in place by meshscalars\n";
 
       return 0;
     }
@@ -771,44 +835,15 @@ static int meshcolors(Draw_Interpretor& theDI, int theNbArgs, const char** theAr
 
           // prepare scale map for mesh - it will be assigned to mesh as texture coordinates
           // make mesh color interpolated from minimum X coord to maximum X coord
-          occ::handle<MeshVS_DataSource> aDataSource = aMesh->GetDataSource();
-          double                         aMinX, aMinY, aMinZ, aMaxX, aMaxY, aMaxZ;
-
-          // get bounding box for calculations
-          aDataSource->GetBoundingBox().Get(aMinX, aMinY, aMinZ, aMaxX, aMaxY, aMaxZ);
-          double aDelta = aMaxX - aMinX;
-
-          // assign color scale map values (0..1) to nodes
           NCollection_DataMap<int, double> aScaleMap;
-          NCollection_Array1<double>       aCoords(1, 3);
-          int                              aNbNodes;
-          MeshVS_EntityType                aType;
-
-          // iterate nodes
-          const TColStd_PackedMapOfInteger& anAllNodes = aMesh->GetDataSource()->GetAllNodes();
-          for (TColStd_PackedMapOfInteger::Iterator anIter(anAllNodes); anIter.More();
-               anIter.Next())
-          {
-            // get node coordinates to aCoord variable
-            aDataSource->GetGeom(anIter.Key(), false, aCoords, aNbNodes, aType);
-
-            double aScaleValue;
-            if (aDelta > Precision::Confusion())
-            {
-              aScaleValue = (aCoords.Value(1) - aMinX) / aDelta;
-            }
-            else
-            {
-              aScaleValue = 0.0;
-            }
-
-            aScaleMap.Bind(anIter.Key(), aScaleValue);
-          }
+          computeNodalScaleMap(aMesh, 0, aScaleMap);
 
           // set color map for builder and a color for invalid scale value
           aBuilder->SetColorMap(aColorMap);
           aBuilder->SetInvalidColor(Quantity_NOC_BLACK);
           aBuilder->SetTextureCoords(aScaleMap);
+          aBuilder->SetMutableTextureCoords(theNbArgs > 4
+                                            && TCollection_AsciiString(theArgVec[4]) == "-mutable");
           aMesh->AddBuilder(aBuilder, true);
         }
 
@@ -833,6 +868,63 @@ static int meshcolors(Draw_Interpretor& theDI, int theNbArgs, const char** theAr
 
 //=================================================================================================
 
+static int meshscalars(Draw_Interpretor& theDI, int theNbArgs, const char** theArgVec)
+{
+  if (theNbArgs != 3)
+  {
+    theDI << "Syntax error: wrong number of arguments";
+    return 1;
+  }
+
+  occ::handle<MeshVS_Mesh> aMesh = getMesh(theArgVec[1], theDI);
+  if (aMesh.IsNull())
+  {
+    theDI << "Mesh not found\n";
+    return 1;
+  }
+
+  occ::handle<AIS_InteractiveContext> anIC = ViewerTest::GetAISContext();
+  if (anIC.IsNull())
+  {
+    theDI << "The context is null\n";
+    return 1;
+  }
+
+  TCollection_AsciiString anAxis(theArgVec[2]);
+  anAxis.LowerCase();
+  const int anAxisIndex = anAxis == "x" ? 0 : (anAxis == "y" ? 1 : (anAxis == "z" ? 2 : -1));
+  if (anAxisIndex == -1)
+  {
+    theDI << "Syntax error: unknown axis '" << theArgVec[2] << "'";
+    return 1;
+  }
+
+  occ::handle<MeshVS_NodalColorPrsBuilder> aBuilder = occ::down_cast<MeshVS_NodalColorPrsBuilder>(
+    aMesh->FindBuilder(STANDARD_TYPE(MeshVS_NodalColorPrsBuilder)));
+  if (aBuilder.IsNull() || !aBuilder->IsUseTexture())
+  {
+    theDI << "Error: mesh has no nodal texture presentation (see meshcolors nodaltex)";
+    return 1;
+  }
+
+  NCollection_DataMap<int, double> aScaleMap;
+  computeNodalScaleMap(aMesh, anAxisIndex, aScaleMap);
+  if (aBuilder->UpdateTextureCoords(aScaleMap))
+  {
+    // presentation is not recomputed, so that viewer should be redrawn explicitly
+    theDI << "updated in place";
+    anIC->CurrentViewer()->Redraw();
+  }
+  else
+  {
+    theDI << "recomputed";
+    anIC->Redisplay(aMesh, true);
+  }
+  return 0;
+}
+
+//=================================================================================================
+
 static int meshvectors(Draw_Interpretor& theDI, int theNbArgs, const char** theArgVec)
 {
   if (theNbArgs < 3)
@@ -1227,13 +1319,16 @@ void XSDRAWSTL::Factory(Draw_Interpretor& theDI)
             aGroup);
   theDI.Add(
     "readstl",
-    "readstl shape file [-brep] [-mergeAngle Angle] [-multi]"
+    "readstl shape file [-brep] [-compact] [-mergeAngle Angle] [-multi] [-parallel]"
     "\n\t\t: Reads STL file and creates a new shape with specified name."
     "\n\t\t: When -brep is specified, creates a Compound of per-triangle Faces."
+    "\n\t\t: -compact creates the same Compound in compact read-only form,"
+    "\n\t\t:          which creates the sub-shapes on demand; implies -brep."
     "\n\t\t: Single triangulation-only Face is created otherwise (default)."
     "\n\t\t: -mergeAngle specifies maximum angle in degrees between triangles to merge equal "
     "nodes; disabled by default."
-    "\n\t\t: -multi creates a face per solid in multi-domain files; ignored when -brep is set.",
+    "\n\t\t: -multi creates a face per solid in multi-domain files; ignored when -brep is set."
+    "\n\t\t: -parallel reads the file in parallel threads; ignored when -brep is set.",
     __FILE__,
     readstl,
     aGroup);
@@ -1256,6 +1351,13 @@ void XSDRAWSTL::Factory(Draw_Interpretor& theDI)
   theDI.Add("meshshowsel", "show only selected entities", __FILE__, showonly, aGroup);
   theDI.Add("meshshowall", "show all entities", __FILE__, showall, aGroup);
   theDI.Add("meshcolors", "display color presentation", __FILE__, meshcolors, aGroup);
+  theDI.Add("meshscalars",
+            "meshscalars meshname {x|y|z}"
+            "\n\t\t: Update nodal texture colors of the mesh from nodes coordinates along the axis;"
+            "\n\t\t: colors are updated in place when defined by 'meshcolors -mutable'.",
+            __FILE__,
+            meshscalars,
+            aGroup);
   theDI.Add("meshvectors", "display sample vectors", __FILE__, meshvectors, aGroup);
   theDI.Add("meshtext", "display text labels", __FILE__, meshtext, aGroup);
   theDI.Add("meshdeform", "display deformed mesh", __FILE__, meshdeform, aGroup);
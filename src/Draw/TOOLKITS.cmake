@@ -5,6 +5,7 @@ set(OCCT_Draw_LIST_OF_TOOLKITS
   TKOpenGlTest
   TKOpenGlesTest
   TKD3DHostTest
+  TKMetalTest
   TKViewerTest
   TKXSDRAW
   TKDCAF
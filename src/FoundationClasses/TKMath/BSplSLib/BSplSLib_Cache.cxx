@@ -20,6 +20,7 @@
 #include <NCollection_Array2.hxx>
 #include <NCollection_HArray2.hxx>
 
+#include <algorithm>
 #include <utility>
 
 IMPLEMENT_STANDARD_RTTIEXT(BSplSLib_Cache, Standard_Transient)
@@ -225,6 +226,78 @@ void EvaluatePolynomials(const occ::handle<NCollection_HArray2<double>>& thePole
     }
   }
 }
+
+//==================================================================================================
+
+//! Number of points evaluated simultaneously by the batch kernel.
+constexpr int THE_BATCH_WIDTH = 4;
+
+//! Maximal degree along the direction of minimal degree handled by the batch kernel.
+constexpr int THE_BATCH_MAX_DEGREE = 7;
+
+//! Evaluates the cached bivariate polynomial at THE_BATCH_WIDTH points at once.
+//! Uses the same Horner schemes as PLib::NoDerivativeEvalPolynomial() in D0Local(),
+//! with the innermost loops running over the points so that they map onto SIMD lanes.
+//! @tparam theDim number of coordinates of the cached poles (3, or 4 with weights)
+//! @param[in]  thePoles     cached coefficients, row by row along the variable of maximal degree
+//! @param[in]  theCacheCols number of coefficients in a row
+//! @param[in]  theMaxDegree maximal degree
+//! @param[in]  theMinDegree minimal degree, not greater than THE_BATCH_MAX_DEGREE
+//! @param[in]  theMaxParams local parameters along the variable of maximal degree
+//! @param[in]  theMinParams local parameters along the variable of minimal degree
+//! @param[out] theResult    coordinates of the points, coordinate by coordinate
+template <int theDim>
+void evalBatchD0(const double* thePoles,
+                 const int     theCacheCols,
+                 const int     theMaxDegree,
+                 const int     theMinDegree,
+                 const double* theMaxParams,
+                 const double* theMinParams,
+                 double        theResult[][THE_BATCH_WIDTH])
+{
+  double aCoeffs[(THE_BATCH_MAX_DEGREE + 1) * 4][THE_BATCH_WIDTH];
+
+  // Calculate intermediate values along variable with maximal degree
+  const double* aRow = thePoles + theMaxDegree * theCacheCols;
+  for (int aCol = 0; aCol < theCacheCols; ++aCol)
+  {
+    for (int aLane = 0; aLane < THE_BATCH_WIDTH; ++aLane)
+    {
+      aCoeffs[aCol][aLane] = aRow[aCol];
+    }
+  }
+  for (int aDeg = 0; aDeg < theMaxDegree; ++aDeg)
+  {
+    aRow -= theCacheCols;
+    for (int aCol = 0; aCol < theCacheCols; ++aCol)
+    {
+      for (int aLane = 0; aLane < THE_BATCH_WIDTH; ++aLane)
+      {
+        aCoeffs[aCol][aLane] = aCoeffs[aCol][aLane] * theMaxParams[aLane] + aRow[aCol];
+      }
+    }
+  }
+
+  // Calculate total values along variable with minimal degree
+  for (int aCoord = 0; aCoord < theDim; ++aCoord)
+  {
+    for (int aLane = 0; aLane < THE_BATCH_WIDTH; ++aLane)
+    {
+      theResult[aCoord][aLane] = aCoeffs[theMinDegree * theDim + aCoord][aLane];
+    }
+  }
+  for (int aDeg = theMinDegree - 1; aDeg >= 0; --aDeg)
+  {
+    for (int aCoord = 0; aCoord < theDim; ++aCoord)
+    {
+      for (int aLane = 0; aLane < THE_BATCH_WIDTH; ++aLane)
+      {
+        theResult[aCoord][aLane] =
+          theResult[aCoord][aLane] * theMinParams[aLane] + aCoeffs[aDeg * theDim + aCoord][aLane];
+      }
+    }
+  }
+}
 } // namespace
 
 //==================================================================================================
@@ -346,6 +419,76 @@ void BSplSLib_Cache::D0Local(double theLocalU, double theLocalV, gp_Pnt& thePoin
 
 //==================================================================================================
 
+void BSplSLib_Cache::D0LocalBatch(const double* theLocalU,
+                                  const double* theLocalV,
+                                  const int     theNbPoints,
+                                  gp_Pnt*       thePoints) const
+{
+  const auto [aMinDegree, aMaxDegree] = std::minmax(myParamsU.Degree, myParamsV.Degree);
+  if (aMinDegree > THE_BATCH_MAX_DEGREE)
+  {
+    for (int i = 0; i < theNbPoints; ++i)
+    {
+      D0Local(theLocalU[i], theLocalV[i], thePoints[i]);
+    }
+    return;
+  }
+
+  const double* aPolesArray = ConvertArray(myPolesWeights);
+  const int     aCacheCols  = myPolesWeights->RowLength();
+  const bool    isMaxU      = (myParamsU.Degree > myParamsV.Degree);
+  const double* aMaxParams  = isMaxU ? theLocalU : theLocalV;
+  const double* aMinParams  = isMaxU ? theLocalV : theLocalU;
+
+  for (int aFirst = 0; aFirst < theNbPoints; aFirst += THE_BATCH_WIDTH)
+  {
+    const int aNbLanes = std::min(THE_BATCH_WIDTH, theNbPoints - aFirst);
+
+    // Incomplete batch is padded with the last point
+    double aMaxBatch[THE_BATCH_WIDTH], aMinBatch[THE_BATCH_WIDTH];
+    for (int aLane = 0; aLane < THE_BATCH_WIDTH; ++aLane)
+    {
+      const int anIndex = aFirst + std::min(aLane, aNbLanes - 1);
+      aMaxBatch[aLane]  = aMaxParams[anIndex];
+      aMinBatch[aLane]  = aMinParams[anIndex];
+    }
+
+    double aResult[4][THE_BATCH_WIDTH];
+    if (myIsRational)
+    {
+      evalBatchD0<4>(aPolesArray,
+                     aCacheCols,
+                     aMaxDegree,
+                     aMinDegree,
+                     aMaxBatch,
+                     aMinBatch,
+                     aResult);
+    }
+    else
+    {
+      evalBatchD0<3>(aPolesArray,
+                     aCacheCols,
+                     aMaxDegree,
+                     aMinDegree,
+                     aMaxBatch,
+                     aMinBatch,
+                     aResult);
+    }
+
+    for (int aLane = 0; aLane < aNbLanes; ++aLane)
+    {
+      gp_Pnt& aPoint = thePoints[aFirst + aLane];
+      aPoint.SetCoord(aResult[0][aLane], aResult[1][aLane], aResult[2][aLane]);
+      if (myIsRational)
+      {
+        aPoint.ChangeCoord().Divide(aResult[3][aLane]);
+      }
+    }
+  }
+}
+
+//==================================================================================================
+
 void BSplSLib_Cache::D1Local(double  theLocalU,
                              double  theLocalV,
                              gp_Pnt& thePoint,
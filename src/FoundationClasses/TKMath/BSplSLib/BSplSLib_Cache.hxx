@@ -108,6 +108,18 @@ public:
   //! @param[out] thePoint  the result of calculation (the point on the surface)
   Standard_EXPORT void D0Local(double theLocalU, double theLocalV, gp_Pnt& thePoint) const;
 
+  //! Calculates the points for a batch of pre-computed local parameters in [-1, 1] range.
+  //! Several points are evaluated at once by lane-wise Horner schemes, which lets the compiler
+  //! vectorize the evaluation. Gives the same result as calling D0Local() for each point.
+  //! @param[in]  theLocalU   array of pre-computed local U parameters
+  //! @param[in]  theLocalV   array of pre-computed local V parameters
+  //! @param[in]  theNbPoints number of points to evaluate
+  //! @param[out] thePoints   array of at least theNbPoints resulting points
+  Standard_EXPORT void D0LocalBatch(const double* theLocalU,
+                                    const double* theLocalV,
+                                    const int     theNbPoints,
+                                    gp_Pnt*       thePoints) const;
+
   //! Calculates the point and first derivatives using pre-computed local parameters in [-1, 1]
   //! range. This bypasses periodic normalization and local parameter calculation.
   //! @param[in]  theLocalU   pre-computed local U parameter: (U - SpanMid) / SpanHalfLen
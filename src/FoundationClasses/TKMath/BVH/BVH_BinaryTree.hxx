@@ -17,9 +17,12 @@
 #define _BVH_BinaryTree_Header
 
 #include <BVH_QuadTree.hxx>
+#include <BVH_Set.hxx>
+#include <OSD_Parallel.hxx>
 
 #include <deque>
 #include <tuple>
+#include <vector>
 
 //! Specialization of binary BVH tree.
 template <class T, int N>
@@ -149,6 +152,20 @@ public: //! @name methods specific to binary BVH
   //! Collapses the tree into QBVH an returns it. As a result, each
   //! 2-nd level of current tree is kept and the rest are discarded.
   BVH_Tree<T, N, BVH_QuadTree>* CollapseToQuadTree() const;
+
+  //! Updates the bounding boxes of all nodes from the current boxes of the elements
+  //! of the set the tree has been built for (refit), keeping the tree topology.
+  //! Should be used after small changes of the element geometry only, as the tree
+  //! quality degrades with the distance the elements have been moved since the last build.
+  //! The nodes of the same level are processed in parallel from the leaves to the root.
+  //! Nodes without valid element boxes get empty boxes not passing any overlap test.
+  //! @param theSet        the set of elements (in the order after the tree building)
+  //! @param theIsParallel flag to process the nodes in parallel threads
+  void Refit(const BVH_Set<T, N>& theSet, const bool theIsParallel = false);
+
+protected:
+  //! Updates the bounding box of the node from its children or elements (see Refit()).
+  void refitNode(const BVH_Set<T, N>& theSet, const int theNode);
 };
 
 namespace BVH
@@ -282,7 +299,95 @@ BVH_Tree<T, N, BVH_QuadTree>* BVH_Tree<T, N, BVH_BinaryTree>::CollapseToQuadTree
     aQueue.pop_front(); // node processing completed
   }
 
+  aQBVH->UpdateChildBoxes();
   return aQBVH;
 }
 
+//=================================================================================================
+
+template <class T, int N>
+void BVH_Tree<T, N, BVH_BinaryTree>::Refit(const BVH_Set<T, N>& theSet, const bool theIsParallel)
+{
+  const int aNbNodes = this->Length();
+  if (aNbNodes == 0)
+  {
+    return;
+  }
+
+  // Step 1 -- Compute levels of the nodes
+  std::vector<int> aLevels(aNbNodes, 0);
+  std::vector<int> aStack(1, 0);
+  int              aMaxLevel = 0;
+  while (!aStack.empty())
+  {
+    const int aNode = aStack.back();
+    aStack.pop_back();
+    if (!this->IsOuter(aNode))
+    {
+      aLevels[Child<0>(aNode)] = aLevels[aNode] + 1;
+      aLevels[Child<1>(aNode)] = aLevels[aNode] + 1;
+      aMaxLevel                = (std::max)(aMaxLevel, aLevels[aNode] + 1);
+      aStack.push_back(Child<0>(aNode));
+      aStack.push_back(Child<1>(aNode));
+    }
+  }
+
+  // Step 2 -- Group the nodes by levels (counting sort)
+  std::vector<int> aLevelStarts(aMaxLevel + 2, 0);
+  for (int aNode = 0; aNode < aNbNodes; ++aNode)
+  {
+    ++aLevelStarts[aLevels[aNode] + 1];
+  }
+  for (int aLevel = 1; aLevel <= aMaxLevel + 1; ++aLevel)
+  {
+    aLevelStarts[aLevel] += aLevelStarts[aLevel - 1];
+  }
+  std::vector<int> aLevelNodes(aNbNodes);
+  std::vector<int> aLevelEnds(aLevelStarts.begin(), aLevelStarts.end() - 1);
+  for (int aNode = 0; aNode < aNbNodes; ++aNode)
+  {
+    aLevelNodes[aLevelEnds[aLevels[aNode]]++] = aNode;
+  }
+
+  // Step 3 -- Update the boxes level by level from the deepest one;
+  // nodes of the same level depend only on the nodes of deeper levels
+  for (int aLevel = aMaxLevel; aLevel >= 0; --aLevel)
+  {
+    const int aBeg  = aLevelStarts[aLevel];
+    const int anEnd = aLevelStarts[aLevel + 1];
+    OSD_Parallel::For(
+      aBeg,
+      anEnd,
+      [&](const int theIndex) { refitNode(theSet, aLevelNodes[theIndex]); },
+      !theIsParallel || anEnd - aBeg < 64);
+  }
+}
+
+//=================================================================================================
+
+template <class T, int N>
+void BVH_Tree<T, N, BVH_BinaryTree>::refitNode(const BVH_Set<T, N>& theSet, const int theNode)
+{
+  BVH_Box<T, N> aBox;
+  if (this->IsOuter(theNode))
+  {
+    for (int anElemIdx = this->BegPrimitive(theNode); anElemIdx <= this->EndPrimitive(theNode);
+         ++anElemIdx)
+    {
+      aBox.Combine(theSet.Box(anElemIdx));
+    }
+  }
+  else
+  {
+    const int aLftChild = Child<0>(theNode);
+    const int aRghChild = Child<1>(theNode);
+    aBox.Combine(BVH_Box<T, N>(this->MinPoint(aLftChild), this->MaxPoint(aLftChild)));
+    aBox.Combine(BVH_Box<T, N>(this->MinPoint(aRghChild), this->MaxPoint(aRghChild)));
+  }
+
+  // the box without valid element boxes remains empty (inverted) one
+  this->MinPoint(theNode) = aBox.CornerMin();
+  this->MaxPoint(theNode) = aBox.CornerMax();
+}
+
 #endif // _BVH_BinaryTree_Header
@@ -0,0 +1,594 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BVH_DynamicTree_Header
+#define _BVH_DynamicTree_Header
+
+#include <BVH_BinaryTree.hxx>
+#include <BVH_Constants.hxx>
+
+#include <algorithm>
+#include <vector>
+
+//! Binary BVH tree supporting incremental insertion and removal of the elements.
+//! Each leaf of the tree refers to exactly one element of the set, so that an element
+//! can be inserted, removed or moved with O(log n) operations instead of rebuilding
+//! the whole tree. The tree is kept balanced by rotations of the nodes along the
+//! modified path (heights of sibling subtrees differ at most by one, as in AVL tree);
+//! the sibling of the inserted leaf is chosen by surface area heuristic.
+//!
+//! The tree can be initially built by any builder of binary trees and then prepared
+//! for incremental updates by Init(). The root node is always stored at index 0,
+//! the nodes released by removal are reused by the following insertions and remain
+//! empty (inverted boxes) leaves unreachable from the root. Node levels are not
+//! maintained by incremental updates.
+//! \tparam T Numeric data type
+//! \tparam N Vector dimension
+template <class T, int N>
+class BVH_DynamicTree : public BVH_Tree<T, N, BVH_BinaryTree>
+{
+public:
+  typedef typename BVH_Tree<T, N, BVH_BinaryTree>::BVH_VecNt BVH_VecNt;
+
+public:
+  //! Creates new empty tree.
+  BVH_DynamicTree()
+      : myIsDynamic(true)
+  {
+  }
+
+  //! Returns true if the tree can be updated incrementally;
+  //! returns false if the tree became too deep for traversal and should be rebuilt.
+  bool IsDynamic() const { return myIsDynamic; }
+
+  //! Returns number of released nodes waiting for reuse.
+  int NbFreeNodes() const { return static_cast<int>(myFreeNodes.size()); }
+
+  //! Returns leaf node of the element or -1 if the element is not in the tree.
+  int ElementLeaf(const int theElement) const
+  {
+    return theElement < static_cast<int>(myElemLeaves.size()) ? myElemLeaves[theElement] : -1;
+  }
+
+  //! Removes all nodes from the tree.
+  void Clear()
+  {
+    BVH_Tree<T, N, BVH_BinaryTree>::Clear();
+    myParents.clear();
+    myHeights.clear();
+    myElemLeaves.clear();
+    myFreeNodes.clear();
+    myIsDynamic   = true;
+    this->myDepth = 0;
+  }
+
+  //! Prepares the tree built by a builder for incremental updates:
+  //! splits the leaves with several elements and computes node heights and parents.
+  //! Should be called after each rebuild of the tree by a builder.
+  //! @param[in] theSet  the set of elements the tree has been built for
+  //! @return FALSE if the tree is too deep for incremental updates (see IsDynamic())
+  bool Init(const BVH_Set<T, N>& theSet);
+
+  //! Inserts new leaf for the element of the set.
+  //! @param[in] theSet      the set of elements
+  //! @param[in] theElement  index of the element in the set (not yet in the tree)
+  void Insert(const BVH_Set<T, N>& theSet, const int theElement);
+
+  //! Removes the leaf of the element from the tree.
+  //! @param[in] theElement  index of the element in the tree
+  void Remove(const int theElement);
+
+  //! Re-inserts the leaf of the element after modification of its bounding box.
+  //! @param[in] theSet      the set of elements
+  //! @param[in] theElement  index of the element in the tree
+  void Update(const BVH_Set<T, N>& theSet, const int theElement)
+  {
+    Remove(theElement);
+    Insert(theSet, theElement);
+  }
+
+  //! Changes index of the element referred by its leaf,
+  //! e.g. after moving the last element of the set to the place of removed one.
+  //! @param[in] theOldIndex  current index of the element in the tree
+  //! @param[in] theNewIndex  new index of the element (not used in the tree)
+  void ChangeElementIndex(const int theOldIndex, const int theNewIndex);
+
+protected:
+  //! Returns the box of the node.
+  BVH_Box<T, N> nodeBox(const int theNode) const
+  {
+    return BVH_Box<T, N>(this->MinPoint(theNode), this->MaxPoint(theNode));
+  }
+
+  //! Returns an unused node (reused or appended one).
+  int allocateNode();
+
+  //! Marks the node as unused.
+  void releaseNode(const int theNode);
+
+  //! Makes the node the leaf of the element.
+  void setLeaf(const int theNode, const int theElement, const BVH_Box<T, N>& theBox);
+
+  //! Makes the node the parent of two nodes and updates its box and height.
+  void setInner(const int theNode, const int theLftChild, const int theRghChild);
+
+  //! Updates the box and height of the inner node from its children.
+  void updateNode(const int theNode);
+
+  //! Moves the node record to another (unused) node.
+  void relocateNode(const int theFrom, const int theTo);
+
+  //! Replaces the child of the inner node.
+  void replaceChild(const int theNode, const int theOldChild, const int theNewChild);
+
+  //! Searches the best sibling for the new leaf with the given box.
+  int findSibling(const BVH_Box<T, N>& theBox) const;
+
+  //! Rebalances the subtree of the node by rotations if necessary and updates the node.
+  void balance(const int theNode);
+
+  //! Rebalances and updates the nodes from the given one up to the root.
+  void updateAncestors(int theNode);
+
+  //! Splits the leaf with the range of elements into a balanced subtree.
+  void splitLeaf(const BVH_Set<T, N>& theSet,
+                 const int            theNode,
+                 const int            theBegElem,
+                 const int            theEndElem);
+
+  //! Updates depth of the tree and availability of incremental updates.
+  void updateDepth();
+
+protected:
+  std::vector<int> myParents;    //!< parents of the nodes (-1 for root and unused nodes)
+  std::vector<int> myHeights;    //!< heights of the subtrees (0 for leaves, -1 for unused nodes)
+  std::vector<int> myElemLeaves; //!< leaf nodes of the elements (-1 for missing elements)
+  std::vector<int> myFreeNodes;  //!< unused nodes to be reused
+  bool             myIsDynamic;  //!< flag indicating that the tree is not too deep
+};
+
+//=================================================================================================
+
+template <class T, int N>
+bool BVH_DynamicTree<T, N>::Init(const BVH_Set<T, N>& theSet)
+{
+  const int aNbNodes = this->Length();
+  myParents.assign(aNbNodes, -1);
+  myHeights.assign(aNbNodes, 0);
+  myElemLeaves.assign(theSet.Size(), -1);
+  myFreeNodes.clear();
+  myIsDynamic   = true;
+  this->myDepth = 0;
+  if (aNbNodes == 0)
+  {
+    return true;
+  }
+
+  // Step 1 -- compute parents and check the depth after splitting of leaves
+  std::vector<int>                 aLeaves;
+  std::vector<std::pair<int, int>> aStack(1, std::make_pair(0, 0));
+  int                              aMaxDepth = 0;
+  while (!aStack.empty())
+  {
+    const std::pair<int, int> aNode = aStack.back();
+    aStack.pop_back();
+    if (this->IsOuter(aNode.first))
+    {
+      int aDepth = aNode.second;
+      for (int aNbElems = this->NbPrimitives(aNode.first); aNbElems > 1;
+           aNbElems     = (aNbElems + 1) / 2)
+      {
+        ++aDepth;
+      }
+      aMaxDepth = (std::max)(aMaxDepth, aDepth);
+      aLeaves.push_back(aNode.first);
+      continue;
+    }
+
+    for (int aChildIter = 0; aChildIter < 2; ++aChildIter)
+    {
+      const int aChild = aChildIter == 0 ? this->template Child<0>(aNode.first)
+                                         : this->template Child<1>(aNode.first);
+      myParents[aChild] = aNode.first;
+      aStack.push_back(std::make_pair(aChild, aNode.second + 1));
+    }
+  }
+  if (aMaxDepth >= BVH_Constants_MaxTreeDepth - 1)
+  {
+    myIsDynamic   = false;
+    this->myDepth = aMaxDepth;
+    return false;
+  }
+
+  // Step 2 -- split the leaves so that each one refers to a single element
+  for (std::vector<int>::const_iterator aLeafIter = aLeaves.begin(); aLeafIter != aLeaves.end();
+       ++aLeafIter)
+  {
+    splitLeaf(theSet, *aLeafIter, this->BegPrimitive(*aLeafIter), this->EndPrimitive(*aLeafIter));
+  }
+
+  // Step 3 -- compute heights from the leaves to the root (children follow parents in the order)
+  std::vector<int> anOrder(1, 0);
+  for (size_t anOrderIter = 0; anOrderIter < anOrder.size(); ++anOrderIter)
+  {
+    const int aNode = anOrder[anOrderIter];
+    if (!this->IsOuter(aNode))
+    {
+      anOrder.push_back(this->template Child<0>(aNode));
+      anOrder.push_back(this->template Child<1>(aNode));
+    }
+  }
+  for (std::vector<int>::const_reverse_iterator aNodeIter = anOrder.rbegin();
+       aNodeIter != anOrder.rend();
+       ++aNodeIter)
+  {
+    if (!this->IsOuter(*aNodeIter))
+    {
+      myHeights[*aNodeIter] = 1
+                              + (std::max)(myHeights[this->template Child<0>(*aNodeIter)],
+                                           myHeights[this->template Child<1>(*aNodeIter)]);
+    }
+  }
+  updateDepth();
+  return myIsDynamic;
+}
+
+//=================================================================================================
+
+template <class T, int N>
+void BVH_DynamicTree<T, N>::Insert(const BVH_Set<T, N>& theSet, const int theElement)
+{
+  const BVH_Box<T, N> aBox = theSet.Box(theElement);
+  if (this->Length() == NbFreeNodes())
+  {
+    // the tree is empty
+    Clear();
+    setLeaf(allocateNode(), theElement, aBox);
+    updateDepth();
+    return;
+  }
+
+  const int aSibling = findSibling(aBox);
+  const int aLeaf    = allocateNode();
+  setLeaf(aLeaf, theElement, aBox);
+  const int aNewParent = allocateNode();
+  if (aSibling == 0)
+  {
+    // the root should stay at index 0 -- move the old root to the new node
+    relocateNode(0, aNewParent);
+    setInner(0, aNewParent, aLeaf);
+    balance(0);
+  }
+  else
+  {
+    const int aParent = myParents[aSibling];
+    replaceChild(aParent, aSibling, aNewParent);
+    myParents[aNewParent] = aParent;
+    setInner(aNewParent, aSibling, aLeaf);
+    updateAncestors(aParent);
+  }
+  updateDepth();
+}
+
+//=================================================================================================
+
+template <class T, int N>
+void BVH_DynamicTree<T, N>::Remove(const int theElement)
+{
+  const int aLeaf = ElementLeaf(theElement);
+  if (aLeaf < 0)
+  {
+    return;
+  }
+
+  if (aLeaf == 0)
+  {
+    // the last element
+    Clear();
+    return;
+  }
+
+  myElemLeaves[theElement] = -1;
+  while (!myElemLeaves.empty() && myElemLeaves.back() < 0)
+  {
+    myElemLeaves.pop_back();
+  }
+
+  const int aParent  = myParents[aLeaf];
+  const int aSibling = this->template Child<0>(aParent) == aLeaf
+                         ? this->template Child<1>(aParent)
+                         : this->template Child<0>(aParent);
+  releaseNode(aLeaf);
+  if (aParent == 0)
+  {
+    // the sibling becomes the root, which should stay at index 0
+    relocateNode(aSibling, 0);
+    myParents[0] = -1;
+    releaseNode(aSibling);
+  }
+  else
+  {
+    const int aGrandParent = myParents[aParent];
+    replaceChild(aGrandParent, aParent, aSibling);
+    myParents[aSibling] = aGrandParent;
+    releaseNode(aParent);
+    updateAncestors(aGrandParent);
+  }
+  updateDepth();
+}
+
+//=================================================================================================
+
+template <class T, int N>
+void BVH_DynamicTree<T, N>::ChangeElementIndex(const int theOldIndex, const int theNewIndex)
+{
+  const int aLeaf = ElementLeaf(theOldIndex);
+  if (aLeaf < 0 || theOldIndex == theNewIndex)
+  {
+    return;
+  }
+
+  this->BegPrimitive(aLeaf) = theNewIndex;
+  this->EndPrimitive(aLeaf) = theNewIndex;
+  if (theNewIndex >= static_cast<int>(myElemLeaves.size()))
+  {
+    myElemLeaves.resize(theNewIndex + 1, -1);
+  }
+  myElemLeaves[theNewIndex] = aLeaf;
+  myElemLeaves[theOldIndex] = -1;
+  while (!myElemLeaves.empty() && myElemLeaves.back() < 0)
+  {
+    myElemLeaves.pop_back();
+  }
+}
+
+//=================================================================================================
+
+template <class T, int N>
+int BVH_DynamicTree<T, N>::allocateNode()
+{
+  if (!myFreeNodes.empty())
+  {
+    const int aNode = myFreeNodes.back();
+    myFreeNodes.pop_back();
+    return aNode;
+  }
+
+  const BVH_Box<T, N> anEmptyBox;
+  myParents.push_back(-1);
+  myHeights.push_back(-1);
+  return this->AddLeafNode(anEmptyBox, 0, -1);
+}
+
+//=================================================================================================
+
+template <class T, int N>
+void BVH_DynamicTree<T, N>::releaseNode(const int theNode)
+{
+  const BVH_Box<T, N> anEmptyBox;
+  BVH::Array<int, 4>::ChangeValue(this->myNodeInfoBuffer, theNode) = BVH_Vec4i(1, 0, -1, 0);
+  this->MinPoint(theNode) = anEmptyBox.CornerMin();
+  this->MaxPoint(theNode) = anEmptyBox.CornerMax();
+  myParents[theNode]      = -1;
+  myHeights[theNode]      = -1;
+  myFreeNodes.push_back(theNode);
+}
+
+//=================================================================================================
+
+template <class T, int N>
+void BVH_DynamicTree<T, N>::setLeaf(const int            theNode,
+                                    const int            theElement,
+                                    const BVH_Box<T, N>& theBox)
+{
+  BVH::Array<int, 4>::ChangeValue(this->myNodeInfoBuffer, theNode) =
+    BVH_Vec4i(1, theElement, theElement, 0);
+  this->MinPoint(theNode) = theBox.CornerMin();
+  this->MaxPoint(theNode) = theBox.CornerMax();
+  myHeights[theNode]      = 0;
+  if (theElement >= static_cast<int>(myElemLeaves.size()))
+  {
+    myElemLeaves.resize(theElement + 1, -1);
+  }
+  myElemLeaves[theElement] = theNode;
+}
+
+//=================================================================================================
+
+template <class T, int N>
+void BVH_DynamicTree<T, N>::setInner(const int theNode,
+                                     const int theLftChild,
+                                     const int theRghChild)
+{
+  BVH::Array<int, 4>::ChangeValue(this->myNodeInfoBuffer, theNode) =
+    BVH_Vec4i(0, theLftChild, theRghChild, 0);
+  myParents[theLftChild] = theNode;
+  myParents[theRghChild] = theNode;
+  updateNode(theNode);
+}
+
+//=================================================================================================
+
+template <class T, int N>
+void BVH_DynamicTree<T, N>::updateNode(const int theNode)
+{
+  const int     aLftChild = this->template Child<0>(theNode);
+  const int     aRghChild = this->template Child<1>(theNode);
+  BVH_Box<T, N> aBox      = nodeBox(aLftChild);
+  aBox.Combine(nodeBox(aRghChild));
+
+  // the box without valid element boxes remains empty (inverted) one
+  this->MinPoint(theNode) = aBox.CornerMin();
+  this->MaxPoint(theNode) = aBox.CornerMax();
+  myHeights[theNode]      = 1 + (std::max)(myHeights[aLftChild], myHeights[aRghChild]);
+}
+
+//=================================================================================================
+
+template <class T, int N>
+void BVH_DynamicTree<T, N>::relocateNode(const int theFrom, const int theTo)
+{
+  BVH::Array<int, 4>::ChangeValue(this->myNodeInfoBuffer, theTo) =
+    BVH::Array<int, 4>::Value(this->myNodeInfoBuffer, theFrom);
+  this->MinPoint(theTo) = this->MinPoint(theFrom);
+  this->MaxPoint(theTo) = this->MaxPoint(theFrom);
+  myHeights[theTo]      = myHeights[theFrom];
+  myParents[theTo]      = myParents[theFrom];
+  if (this->IsOuter(theTo))
+  {
+    myElemLeaves[this->BegPrimitive(theTo)] = theTo;
+  }
+  else
+  {
+    myParents[this->template Child<0>(theTo)] = theTo;
+    myParents[this->template Child<1>(theTo)] = theTo;
+  }
+
+  const int aParent = myParents[theTo];
+  if (aParent >= 0 && aParent != theTo)
+  {
+    replaceChild(aParent, theFrom, theTo);
+  }
+}
+
+//=================================================================================================
+
+template <class T, int N>
+void BVH_DynamicTree<T, N>::replaceChild(const int theNode,
+                                         const int theOldChild,
+                                         const int theNewChild)
+{
+  if (this->template Child<0>(theNode) == theOldChild)
+  {
+    this->template ChangeChild<0>(theNode) = theNewChild;
+  }
+  else
+  {
+    this->template ChangeChild<1>(theNode) = theNewChild;
+  }
+}
+
+//=================================================================================================
+
+template <class T, int N>
+int BVH_DynamicTree<T, N>::findSibling(const BVH_Box<T, N>& theBox) const
+{
+  int aNode = 0;
+  while (!this->IsOuter(aNode))
+  {
+    BVH_Box<T, N> aCombined = nodeBox(aNode);
+    const T       anArea    = aCombined.Area();
+    aCombined.Combine(theBox);
+    const T aCombinedArea = aCombined.Area();
+
+    // cost of creating new parent for this node and the new leaf
+    const T aCost = static_cast<T>(2.0) * aCombinedArea;
+
+    // minimum cost of pushing the leaf further down the tree
+    const T anInheritanceCost = static_cast<T>(2.0) * (aCombinedArea - anArea);
+    T       aChildCosts[2];
+    for (int aChildIter = 0; aChildIter < 2; ++aChildIter)
+    {
+      const int     aChild = aChildIter == 0 ? this->template Child<0>(aNode)
+                                             : this->template Child<1>(aNode);
+      BVH_Box<T, N> aChildCombined = nodeBox(aChild);
+      const T       aChildArea     = aChildCombined.Area();
+      aChildCombined.Combine(theBox);
+      aChildCosts[aChildIter] =
+        anInheritanceCost + aChildCombined.Area() - (this->IsOuter(aChild) ? 0 : aChildArea);
+    }
+
+    if (aCost < aChildCosts[0] && aCost < aChildCosts[1])
+    {
+      break;
+    }
+
+    aNode = aChildCosts[0] < aChildCosts[1] ? this->template Child<0>(aNode)
+                                            : this->template Child<1>(aNode);
+  }
+  return aNode;
+}
+
+//=================================================================================================
+
+template <class T, int N>
+void BVH_DynamicTree<T, N>::balance(const int theNode)
+{
+  const int aLftChild = this->template Child<0>(theNode);
+  const int aRghChild = this->template Child<1>(theNode);
+  const int aBalance  = myHeights[aRghChild] - myHeights[aLftChild];
+  if (aBalance > 1 || aBalance < -1)
+  {
+    // swap the lower child with the higher grandchild from the other side,
+    // which is equivalent to the rotation of the higher child up
+    const bool isLftLower = aBalance > 1;
+    const int  aLower     = isLftLower ? aLftChild : aRghChild;
+    const int  aHigher    = isLftLower ? aRghChild : aLftChild;
+    const int  aGrandLft  = this->template Child<0>(aHigher);
+    const int  aGrandRgh  = this->template Child<1>(aHigher);
+    const int  aGrand = myHeights[aGrandLft] > myHeights[aGrandRgh] ? aGrandLft : aGrandRgh;
+    replaceChild(theNode, aLower, aGrand);
+    myParents[aGrand] = theNode;
+    replaceChild(aHigher, aGrand, aLower);
+    myParents[aLower] = aHigher;
+
+    // the lower child can still be much lower than its new sibling
+    // (e.g. a leaf added at the root), so the moved down node is rebalanced as well
+    balance(aHigher);
+  }
+  updateNode(theNode);
+}
+
+//=================================================================================================
+
+template <class T, int N>
+void BVH_DynamicTree<T, N>::updateAncestors(int theNode)
+{
+  for (; theNode >= 0; theNode = myParents[theNode])
+  {
+    balance(theNode);
+  }
+}
+
+//=================================================================================================
+
+template <class T, int N>
+void BVH_DynamicTree<T, N>::splitLeaf(const BVH_Set<T, N>& theSet,
+                                      const int            theNode,
+                                      const int            theBegElem,
+                                      const int            theEndElem)
+{
+  if (theBegElem == theEndElem)
+  {
+    setLeaf(theNode, theBegElem, theSet.Box(theBegElem));
+    return;
+  }
+
+  const int aMidElem  = (theBegElem + theEndElem) / 2;
+  const int aLftChild = allocateNode();
+  const int aRghChild = allocateNode();
+  splitLeaf(theSet, aLftChild, theBegElem, aMidElem);
+  splitLeaf(theSet, aRghChild, aMidElem + 1, theEndElem);
+  setInner(theNode, aLftChild, aRghChild);
+}
+
+//=================================================================================================
+
+template <class T, int N>
+void BVH_DynamicTree<T, N>::updateDepth()
+{
+  this->myDepth = this->Length() > NbFreeNodes() ? myHeights[0] : 0;
+  myIsDynamic   = this->myDepth < BVH_Constants_MaxTreeDepth - 1;
+}
+
+#endif // _BVH_DynamicTree_Header
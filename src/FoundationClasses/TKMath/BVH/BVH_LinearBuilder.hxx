@@ -20,6 +20,12 @@
 #include <NCollection_Vector.hxx>
 #include <Standard_Assert.hxx>
 
+namespace BVH
+{
+//! Minimum number of primitives to emit LBVH hierarchy by parallel tasks.
+constexpr int THE_MIN_PARALLEL_EMIT_SIZE = 8192;
+} // namespace BVH
+
 //! Performs fast BVH construction using LBVH building approach.
 //! Algorithm uses spatial Morton codes to reduce the BVH construction
 //! problem to a sorting problem (radix sort -- O(N) complexity). This
@@ -52,14 +58,40 @@ public:
 protected:
   typedef NCollection_Array1<BVH_EncodedLink>::iterator LinkIterator;
 
+  //! Subtree of the hierarchy deferred to be emitted by a separate (parallel) task.
+  struct EmitTask
+  {
+    int Node;  //!< index of the placeholder node to be replaced by the subtree root
+    int Digit; //!< Morton code bit used to split the range
+    int Shift; //!< index of the first primitive of the range in the set
+    int Start; //!< first element of the range of sorted links
+    int Final; //!< end (exclusive) of the range of sorted links
+  };
+
+  //! Subtrees deferred during emission of the hierarchy.
+  struct EmitTasks
+  {
+    NCollection_Vector<EmitTask> Tasks;    //!< deferred subtrees
+    int                          TaskSize; //!< max number of primitives in deferred subtree
+  };
+
 protected:
   //! Emits hierarchy from sorted Morton codes.
+  //! If theTasks is not NULL, the subtrees over ranges not exceeding theTasks->TaskSize
+  //! are not emitted but represented by placeholder nodes and appended to theTasks.
   int emitHierachy(BVH_Tree<T, N>*                            theBVH,
                    const NCollection_Array1<BVH_EncodedLink>& theEncodedLinks,
                    const int                                  theBit,
                    const int                                  theShift,
                    const int                                  theStart,
-                   const int                                  theFinal) const;
+                   const int                                  theFinal,
+                   EmitTasks*                                 theTasks = nullptr) const;
+
+  //! Emits hierarchy from sorted Morton codes by parallel tasks emitting independent subtrees,
+  //! which are then appended to the tree.
+  void emitHierachyParallel(BVH_Tree<T, N>*                            theBVH,
+                            const NCollection_Array1<BVH_EncodedLink>& theEncodedLinks,
+                            const int                                  theNbPrims) const;
 
   //! Returns index of the first element which does not compare less than the given one.
   int lowerBound(const NCollection_Array1<BVH_EncodedLink>& theEncodedLinks,
@@ -127,15 +159,30 @@ int BVH_LinearBuilder<T, N>::emitHierachy(
   const int                                  theDigit,
   const int                                  theShift,
   const int                                  theStart,
-  const int                                  theFinal) const
+  const int                                  theFinal,
+  EmitTasks*                                 theTasks) const
 {
   if (theFinal - theStart > BVH_Builder<T, N>::myLeafNodeSize)
   {
+    if (theTasks != nullptr && theFinal - theStart <= theTasks->TaskSize)
+    {
+      // Defer the subtree to the parallel task
+      const EmitTask aTask = {theBVH->AddInnerNode(0, 0), theDigit, theShift, theStart, theFinal};
+      theTasks->Tasks.Append(aTask);
+      return aTask.Node;
+    }
+
     const int aPosition = theDigit < 0 ? (theStart + theFinal) / 2
                                        : lowerBound(theEncodedLinks, theStart, theFinal, theDigit);
     if (aPosition == theStart || aPosition == theFinal)
     {
-      return emitHierachy(theBVH, theEncodedLinks, theDigit - 1, theShift, theStart, theFinal);
+      return emitHierachy(theBVH,
+                          theEncodedLinks,
+                          theDigit - 1,
+                          theShift,
+                          theStart,
+                          theFinal,
+                          theTasks);
     }
 
     // Build inner node
@@ -143,9 +190,9 @@ int BVH_LinearBuilder<T, N>::emitHierachy(
     const int aRghNode = theShift + aPosition - theStart;
 
     const int aLftChild =
-      emitHierachy(theBVH, theEncodedLinks, theDigit - 1, theShift, theStart, aPosition);
+      emitHierachy(theBVH, theEncodedLinks, theDigit - 1, theShift, theStart, aPosition, theTasks);
     const int aRghChild =
-      emitHierachy(theBVH, theEncodedLinks, theDigit - 1, aRghNode, aPosition, theFinal);
+      emitHierachy(theBVH, theEncodedLinks, theDigit - 1, aRghNode, aPosition, theFinal, theTasks);
 
     theBVH->NodeInfoBuffer()[aNode].y() = aLftChild;
     theBVH->NodeInfoBuffer()[aNode].z() = aRghChild;
@@ -158,6 +205,66 @@ int BVH_LinearBuilder<T, N>::emitHierachy(
   }
 }
 
+//=================================================================================================
+
+template <class T, int N>
+void BVH_LinearBuilder<T, N>::emitHierachyParallel(
+  BVH_Tree<T, N>*                            theBVH,
+  const NCollection_Array1<BVH_EncodedLink>& theEncodedLinks,
+  const int                                  theNbPrims) const
+{
+  // Step 1 -- Emit the top of the hierarchy deferring the subtrees of moderate size
+  EmitTasks aTasks;
+  aTasks.TaskSize = (std::max)(theNbPrims / 64, 4 * BVH_Builder<T, N>::myLeafNodeSize);
+  emitHierachy(theBVH, theEncodedLinks, 29, 0, 0, theNbPrims, &aTasks);
+  if (aTasks.Tasks.IsEmpty())
+  {
+    return;
+  }
+
+  // Step 2 -- Emit the deferred subtrees into separate trees in parallel
+  NCollection_Array1<BVH_Tree<T, N>> aSubTrees(0, aTasks.Tasks.Size() - 1);
+  OSD_Parallel::For(
+    0,
+    aTasks.Tasks.Size(),
+    [&](const int theTaskIdx) {
+      const EmitTask& aTask = aTasks.Tasks.Value(theTaskIdx);
+      emitHierachy(&aSubTrees.ChangeValue(theTaskIdx),
+                   theEncodedLinks,
+                   aTask.Digit,
+                   aTask.Shift,
+                   aTask.Start,
+                   aTask.Final);
+    },
+    false);
+
+  // Step 3 -- Append the subtrees to the tree, the root of subtree replaces the placeholder node
+  for (int aTaskIdx = 0; aTaskIdx < aTasks.Tasks.Size(); ++aTaskIdx)
+  {
+    const BVH_Array4i& aSubNodes = aSubTrees.Value(aTaskIdx).NodeInfoBuffer();
+    const int          aNode     = aTasks.Tasks.Value(aTaskIdx).Node;
+    const int          anOffset  = theBVH->Length() - 1; // local index 1 goes to the end of tree
+    for (int aSubNode = 0; aSubNode < static_cast<int>(aSubNodes.size()); ++aSubNode)
+    {
+      BVH_Vec4i aNodeInfo = aSubNodes[aSubNode];
+      if (aNodeInfo.x() == 0)
+      {
+        aNodeInfo.y() += anOffset;
+        aNodeInfo.z() += anOffset;
+      }
+
+      if (aSubNode == 0)
+      {
+        theBVH->NodeInfoBuffer()[aNode] = aNodeInfo;
+      }
+      else
+      {
+        BVH::Array<int, 4>::Append(theBVH->NodeInfoBuffer(), aNodeInfo);
+      }
+    }
+  }
+}
+
 namespace BVH
 {
 //! Calculates bounding boxes (AABBs) for the given BVH tree.
@@ -323,7 +430,14 @@ void BVH_LinearBuilder<T, N>::Build(BVH_Set<T, N>*       theSet,
   aRadixSorter.Perform(theSet);
 
   // Step 2 -- Emitting BVH hierarchy from sorted Morton codes
-  emitHierachy(theBVH, aRadixSorter.EncodedLinks(), 29, 0, 0, theSet->Size());
+  if (this->IsParallel() && aSetSize > BVH::THE_MIN_PARALLEL_EMIT_SIZE)
+  {
+    emitHierachyParallel(theBVH, aRadixSorter.EncodedLinks(), aSetSize);
+  }
+  else
+  {
+    emitHierachy(theBVH, aRadixSorter.EncodedLinks(), 29, 0, 0, aSetSize);
+  }
 
   // Step 3 -- Compute bounding boxes of BVH nodes
   theBVH->MinPointBuffer().resize(theBVH->NodeInfoBuffer().size());
@@ -84,6 +84,20 @@ public:
     return myBVH;
   }
 
+  //! Updates bounding boxes of the nodes of the built BVH tree from the current boxes
+  //! of the primitives without rebuilding the tree (see BVH_Tree::Refit());
+  //! does nothing if the tree should be rebuilt anyway.
+  virtual void Refit(const bool theIsParallel = false)
+  {
+    if (BVH_Object<T, N>::myIsDirty || myBVH->Length() == 0)
+    {
+      return;
+    }
+
+    myBVH->Refit(*this, theIsParallel);
+    myBox = BVH_Box<T, N>(myBVH->MinPoint(0), myBVH->MaxPoint(0));
+  }
+
   //! Returns the method (builder) used to construct BVH.
   virtual const opencascade::handle<BVH_Builder<T, N>>& Builder() const { return myBuilder; }
 
@@ -18,6 +18,50 @@
 
 #include <BVH_Tree.hxx>
 
+#include <cmath>
+#include <limits>
+#include <vector>
+
+//! Bounding boxes of the (up to four) children of inner node of quad BVH tree in SoA layout:
+//! the coordinates of the four boxes along the same axis are adjacent, so that the boxes
+//! are tested at once by a vectorized loop (see BVH_Tools::BoxQuadNodeOverlap()).
+//! The coordinates are stored in single precision rounded outward (the boxes can only grow);
+//! the lanes of missing children hold empty (inverted) boxes.
+template <int N>
+struct BVH_QuadNodeBoxes
+{
+  alignas(16) float MinPoint[N][4]; //!< minimum corners of the child boxes by axes
+  alignas(16) float MaxPoint[N][4]; //!< maximum corners of the child boxes by axes
+};
+
+namespace BVH
+{
+//! Rounds the value to the nearest single precision value not greater than the given one.
+template <class T>
+float RoundDownToFloat(const T theValue)
+{
+  if (theValue > static_cast<T>((std::numeric_limits<float>::max)()))
+  {
+    return (std::numeric_limits<float>::max)();
+  }
+  if (theValue < static_cast<T>(std::numeric_limits<float>::lowest()))
+  {
+    return -std::numeric_limits<float>::infinity();
+  }
+  const float aValue = static_cast<float>(theValue);
+  return static_cast<T>(aValue) > theValue
+           ? std::nextafter(aValue, -std::numeric_limits<float>::infinity())
+           : aValue;
+}
+
+//! Rounds the value to the nearest single precision value not less than the given one.
+template <class T>
+float RoundUpToFloat(const T theValue)
+{
+  return -RoundDownToFloat(-theValue);
+}
+} // namespace BVH
+
 //! Specialization of quad BVH (QBVH) tree.
 template <class T, int N>
 class BVH_Tree<T, N, BVH_QuadTree> : public BVH_TreeBase<T, N>
@@ -36,6 +80,71 @@ public: //! @name general methods
   {
     return BVH::Array<int, 4>::Value(this->myNodeInfoBuffer, theNodeIndex).y() + K;
   }
+
+  //! Returns number of children of the given inner node (from 1 to 4).
+  int NbChildren(const int theNodeIndex) const
+  {
+    return BVH::Array<int, 4>::Value(this->myNodeInfoBuffer, theNodeIndex).z() + 1;
+  }
+
+public: //! @name SoA boxes of node children
+  //! Returns TRUE if the SoA boxes of node children are available (see UpdateChildBoxes()).
+  bool HasChildBoxes() const
+  {
+    return !myChildBoxes.empty()
+           && static_cast<int>(myChildBoxes.size()) == this->Length();
+  }
+
+  //! Returns SoA boxes of the children of the given inner node.
+  const BVH_QuadNodeBoxes<N>& ChildBoxes(const int theNodeIndex) const
+  {
+    return myChildBoxes[theNodeIndex];
+  }
+
+  //! Fills SoA boxes of the children of inner nodes from the node bounding boxes.
+  //! Should be called after modification of the tree (done by CollapseToQuadTree()).
+  void UpdateChildBoxes();
+
+protected:
+  std::vector<BVH_QuadNodeBoxes<N>> myChildBoxes; //!< SoA boxes of node children
 };
 
+//=================================================================================================
+
+template <class T, int N>
+void BVH_Tree<T, N, BVH_QuadTree>::UpdateChildBoxes()
+{
+  const int aNbNodes = this->Length();
+  myChildBoxes.resize(aNbNodes);
+  for (int aNodeIdx = 0; aNodeIdx < aNbNodes; ++aNodeIdx)
+  {
+    if (this->IsOuter(aNodeIdx))
+    {
+      continue;
+    }
+
+    BVH_QuadNodeBoxes<N>& aBoxes      = myChildBoxes[aNodeIdx];
+    const int             aFirstChild = Child<0>(aNodeIdx);
+    const int             aNbChildren = NbChildren(aNodeIdx);
+    for (int aLane = 0; aLane < 4; ++aLane)
+    {
+      for (int anAxis = 0; anAxis < N; ++anAxis)
+      {
+        if (aLane < aNbChildren)
+        {
+          aBoxes.MinPoint[anAxis][aLane] =
+            BVH::RoundDownToFloat(this->MinPoint(aFirstChild + aLane)[anAxis]);
+          aBoxes.MaxPoint[anAxis][aLane] =
+            BVH::RoundUpToFloat(this->MaxPoint(aFirstChild + aLane)[anAxis]);
+        }
+        else
+        {
+          aBoxes.MinPoint[anAxis][aLane] = (std::numeric_limits<float>::max)();
+          aBoxes.MaxPoint[anAxis][aLane] = std::numeric_limits<float>::lowest();
+        }
+      }
+    }
+  }
+}
+
 #endif // _BVH_QuadTree_Header
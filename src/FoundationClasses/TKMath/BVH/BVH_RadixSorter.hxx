@@ -248,9 +248,8 @@ void BVH_RadixSorter<T, N>::Perform(BVH_Set<T, N>* theSet, const int theStart, c
   myEncodedLinks = new NCollection_Shared<NCollection_Array1<BVH_EncodedLink>>(theStart, theFinal);
 
   // Step 1 -- Assign Morton code to each primitive using LUT for faster encoding
-  for (int aPrimIdx = theStart; aPrimIdx <= theFinal; ++aPrimIdx)
-  {
-    const BVH_VecNt aCenter = theSet->Box(aPrimIdx).Center();
+  const auto anEncoder = [&](const int thePrimIdx) {
+    const BVH_VecNt aCenter = theSet->Box(thePrimIdx).Center();
     const BVH_VecNt aVoxelF = (aCenter - aSceneMin) * aReverseSize;
 
     // Compute voxel coordinates clamped to valid range
@@ -268,8 +267,9 @@ void BVH_RadixSorter<T, N>::Perform(BVH_Set<T, N>* theSet, const int theStart, c
                                                            static_cast<unsigned int>(aVoxelY),
                                                            static_cast<unsigned int>(aVoxelZ));
 
-    myEncodedLinks->ChangeValue(aPrimIdx) = BVH_EncodedLink(aMortonCode, aPrimIdx);
-  }
+    myEncodedLinks->ChangeValue(thePrimIdx) = BVH_EncodedLink(aMortonCode, thePrimIdx);
+  };
+  OSD_Parallel::For(theStart, theFinal + 1, anEncoder, !this->IsParallel());
 
   // Step 2 -- Sort primitives by their Morton codes using radix sort
   BVH::RadixSorter::Sort(myEncodedLinks->begin(), myEncodedLinks->end(), 29, this->IsParallel());
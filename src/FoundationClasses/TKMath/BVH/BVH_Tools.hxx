@@ -17,6 +17,7 @@
 #define _BVH_Tools_Header
 
 #include <BVH_Box.hxx>
+#include <BVH_QuadTree.hxx>
 #include <BVH_Ray.hxx>
 #include <BVH_Types.hxx>
 
@@ -422,6 +423,110 @@ public: //! @name Ray-Box Intersection
     theTimeLeave = aTimeLeave;
     return true;
   }
+
+public: //! @name Tests of the children of quad BVH node
+  //! Tests the four child boxes of quad BVH node for overlapping with the given box at once.
+  //! The loops over the lanes have no branches to be vectorized by the compiler.
+  //! @param theBoxes SoA child boxes of the node (see BVH_Tree::ChildBoxes())
+  //! @param theCMin  minimum corner of the box
+  //! @param theCMax  maximum corner of the box
+  //! @return bit mask of the overlapping children (bit K for the K-th child)
+  static int BoxQuadNodeOverlap(const BVH_QuadNodeBoxes<N>& theBoxes,
+                                const BVH_VecNt&            theCMin,
+                                const BVH_VecNt&            theCMax)
+  {
+    int anOverlap[4] = {1, 1, 1, 1};
+    for (int anAxis = 0; anAxis < N; ++anAxis)
+    {
+      // the query box is rounded outward as the child boxes are
+      const float aMin = BVH::RoundDownToFloat(theCMin[anAxis]);
+      const float aMax = BVH::RoundUpToFloat(theCMax[anAxis]);
+      for (int aLane = 0; aLane < 4; ++aLane)
+      {
+        anOverlap[aLane] &= static_cast<int>(theBoxes.MinPoint[anAxis][aLane] <= aMax)
+                            & static_cast<int>(theBoxes.MaxPoint[anAxis][aLane] >= aMin);
+      }
+    }
+    return anOverlap[0] | (anOverlap[1] << 1) | (anOverlap[2] << 2) | (anOverlap[3] << 3);
+  }
+
+  //! Computes square distances between the point and the four child boxes of quad BVH node
+  //! at once. The distances to the lanes of missing children are huge.
+  //! @param theBoxes   SoA child boxes of the node (see BVH_Tree::ChildBoxes())
+  //! @param thePoint   the point
+  //! @param theSqDists square distances to the child boxes
+  static void PointQuadNodeSquareDistance(const BVH_QuadNodeBoxes<N>& theBoxes,
+                                          const BVH_VecNt&            thePoint,
+                                          T                           theSqDists[4])
+  {
+    T aSqDists[4] = {T(0), T(0), T(0), T(0)};
+    for (int anAxis = 0; anAxis < N; ++anAxis)
+    {
+      const T aCoord = thePoint[anAxis];
+      for (int aLane = 0; aLane < 4; ++aLane)
+      {
+        const T aDist = (std::max)((std::max)(T(theBoxes.MinPoint[anAxis][aLane]) - aCoord,
+                                              aCoord - T(theBoxes.MaxPoint[anAxis][aLane])),
+                                   T(0));
+        aSqDists[aLane] += aDist * aDist;
+      }
+    }
+    for (int aLane = 0; aLane < 4; ++aLane)
+    {
+      theSqDists[aLane] = aSqDists[aLane];
+    }
+  }
+
+  //! Computes hit times of the ray with the four child boxes of quad BVH node at once.
+  //! Unlike RayBoxIntersection(), the hit time is clamped to zero for the ray
+  //! starting inside the box.
+  //! @param theRay        the ray
+  //! @param theBoxes      SoA child boxes of the node (see BVH_Tree::ChildBoxes())
+  //! @param theMaxTime    maximum hit time of interest
+  //! @param theTimeEnter  times of ray entering the child boxes (valid for hit children only)
+  //! @return bit mask of the hit children (bit K for the K-th child)
+  static int RayQuadNodeIntersection(const BVH_Ray<T, N>&        theRay,
+                                     const BVH_QuadNodeBoxes<N>& theBoxes,
+                                     const T                     theMaxTime,
+                                     T                           theTimeEnter[4])
+  {
+    T aTimeEnter[4] = {T(0), T(0), T(0), T(0)};
+    T aTimeLeave[4] = {theMaxTime, theMaxTime, theMaxTime, theMaxTime};
+    for (int anAxis = 0; anAxis < N; ++anAxis)
+    {
+      const T anOrigin = theRay.Origin[anAxis];
+      if (theRay.Direct[anAxis] == T(0))
+      {
+        // ray is parallel to the slabs - miss the ones not containing the origin
+        for (int aLane = 0; aLane < 4; ++aLane)
+        {
+          const bool isOut = anOrigin < T(theBoxes.MinPoint[anAxis][aLane])
+                             || anOrigin > T(theBoxes.MaxPoint[anAxis][aLane]);
+          aTimeLeave[aLane] = isOut ? T(-1) : aTimeLeave[aLane];
+        }
+        continue;
+      }
+
+      // selection of near/far planes by direction keeps the lanes of empty boxes missed
+      const T      anInvDir = theRay.InvDirect[anAxis];
+      const bool   isPosDir = anInvDir > T(0);
+      const float* aNear    = isPosDir ? theBoxes.MinPoint[anAxis] : theBoxes.MaxPoint[anAxis];
+      const float* aFar     = isPosDir ? theBoxes.MaxPoint[anAxis] : theBoxes.MinPoint[anAxis];
+      for (int aLane = 0; aLane < 4; ++aLane)
+      {
+        aTimeEnter[aLane] = (std::max)(aTimeEnter[aLane], (T(aNear[aLane]) - anOrigin) * anInvDir);
+        aTimeLeave[aLane] = (std::min)(aTimeLeave[aLane], (T(aFar[aLane]) - anOrigin) * anInvDir);
+      }
+    }
+
+    int aHitMask = 0;
+    for (int aLane = 0; aLane < 4; ++aLane)
+    {
+      theTimeEnter[aLane] = aTimeEnter[aLane];
+      aHitMask |= static_cast<int>(aTimeEnter[aLane] <= aTimeLeave[aLane]) << aLane;
+    }
+    return aHitMask;
+  }
 };
 
 #endif // _BVH_Tools_Header
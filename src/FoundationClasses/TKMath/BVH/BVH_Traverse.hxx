@@ -17,7 +17,7 @@
 #define _BVH_Traverse_Header
 
 #include <BVH_Box.hxx>
-#include <BVH_Tree.hxx>
+#include <BVH_QuadTree.hxx>
 
 //! The classes implement the traverse of the BVH tree.
 //!
@@ -61,6 +61,13 @@
 //!    method Select (const BVH_Tree<>&) which allows performing selection
 //!    on the arbitrary BVH tree.
 //!
+//! Both traverses also accept the quad BVH trees obtained by
+//! BVH_Tree<T, N, BVH_BinaryTree>::CollapseToQuadTree(), which are twice shallower.
+//! The single tree traverse tests the (up to four) children of the inner node
+//! of such tree at once by the method *RejectChildren*, which can be redefined
+//! to test their SoA boxes by vectorized methods of BVH_Tools
+//! (e.g. BVH_Tools::BoxQuadNodeOverlap()).
+//!
 //! Here is the example of usage of the traverse to find the point-triangulation
 //! minimal distance.
 //! ~~~~
@@ -238,6 +245,38 @@ public: //! @name Selection
   //! Returns the number of accepted elements.
   int Select(const opencascade::handle<BVH_Tree<NumType, Dimension>>& theBVH);
 
+  //! Performs selection of the elements from the quad BVH tree by the
+  //! rules defined in Accept/RejectChildren methods.
+  //! Returns the number of accepted elements.
+  int Select(const opencascade::handle<BVH_Tree<NumType, Dimension, BVH_QuadTree>>& theBVH);
+
+public: //! @name Rules for quad BVH tree
+  //! Rejection of the children of the inner node of quad BVH tree.
+  //! Metrics are computed to choose the best branches.
+  //! Default implementation calls RejectNode() for each child; it may be redefined
+  //! to test the SoA child boxes (BVH_Tree::ChildBoxes()) at once.
+  //! @param theBVH     quad BVH tree
+  //! @param theNode    index of the inner node
+  //! @param theMetrics metrics of the children (valid for not rejected children only)
+  //! @return bit mask of the rejected children (bit K for the K-th child)
+  virtual int RejectChildren(const BVH_Tree<NumType, Dimension, BVH_QuadTree>& theBVH,
+                             const int                                          theNode,
+                             MetricType                                         theMetrics[4]) const
+  {
+    const int aFirstChild = theBVH.template Child<0>(theNode);
+    int       aRejected   = 0;
+    for (int aChildIter = 0; aChildIter < theBVH.NbChildren(theNode); ++aChildIter)
+    {
+      if (RejectNode(theBVH.MinPoint(aFirstChild + aChildIter),
+                     theBVH.MaxPoint(aFirstChild + aChildIter),
+                     theMetrics[aChildIter]))
+      {
+        aRejected |= 1 << aChildIter;
+      }
+    }
+    return aRejected;
+  }
+
 protected: //! @name Internal structures
   //! Auxiliary structure for keeping the nodes to process
   struct BVH_NodeInStack
@@ -327,6 +366,12 @@ public: //! @name Selection
   int Select(const opencascade::handle<BVH_Tree<NumType, Dimension>>& theBVH1,
              const opencascade::handle<BVH_Tree<NumType, Dimension>>& theBVH2);
 
+  //! Performs selection of the elements from two quad BVH trees by the
+  //! rules defined in Accept/Reject methods.
+  //! Returns the number of accepted pairs of elements.
+  int Select(const opencascade::handle<BVH_Tree<NumType, Dimension, BVH_QuadTree>>& theBVH1,
+             const opencascade::handle<BVH_Tree<NumType, Dimension, BVH_QuadTree>>& theBVH2);
+
 protected: //! @name Internal structures
   //! Auxiliary structure for keeping the pair of nodes to process
   struct BVH_PairNodesInStack
@@ -13,6 +13,7 @@ set(OCCT_BVH_FILES
   BVH_BuildThread.cxx
   BVH_Constants.hxx
   BVH_Distance.hxx
+  BVH_DynamicTree.hxx
   BVH_DistanceField.hxx
   BVH_DistanceField.lxx
   BVH_Geometry.hxx
@@ -0,0 +1,175 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <BSplSLib.hxx>
+#include <BSplSLib_Cache.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_Array2.hxx>
+#include <gp_Pnt.hxx>
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+
+namespace
+{
+//! Bicubic B-spline surface with uniform knots on [0, theNbSpans] in both directions.
+struct BicubicSurface
+{
+  static constexpr int THE_DEGREE = 3;
+
+  NCollection_Array2<gp_Pnt> Poles;
+  NCollection_Array1<double> Knots;
+  NCollection_Array1<int>    Mults;
+  NCollection_Array1<double> FlatKnots;
+
+  BicubicSurface(const int theNbSpans)
+      : Poles(1, theNbSpans + THE_DEGREE, 1, theNbSpans + THE_DEGREE),
+        Knots(1, theNbSpans + 1),
+        Mults(1, theNbSpans + 1),
+        FlatKnots(1, theNbSpans + 2 * THE_DEGREE + 1)
+  {
+    for (int aRow = Poles.LowerRow(); aRow <= Poles.UpperRow(); ++aRow)
+    {
+      for (int aCol = Poles.LowerCol(); aCol <= Poles.UpperCol(); ++aCol)
+      {
+        Poles(aRow, aCol) = gp_Pnt(aRow, aCol, std::sin(aRow) * std::cos(aCol));
+      }
+    }
+    for (int anIndex = 1; anIndex <= theNbSpans + 1; ++anIndex)
+    {
+      Knots(anIndex) = anIndex - 1.0;
+      Mults(anIndex) = 1;
+    }
+    Mults(1)              = THE_DEGREE + 1;
+    Mults(theNbSpans + 1) = THE_DEGREE + 1;
+    BSplCLib::KnotSequence(Knots, Mults, FlatKnots);
+  }
+
+  double LastParameter() const { return Knots.Last(); }
+};
+
+//! Number of spans of the benchmarked surfaces.
+constexpr int THE_NB_SPANS = 8;
+} // namespace
+
+static void BSplSLib_D0_Grid(benchmark::State& theState)
+{
+  const BicubicSurface aSurf(THE_NB_SPANS);
+  const int            aNbSamples = int(theState.range(0));
+  const double         aStep      = aSurf.LastParameter() / (aNbSamples - 1);
+  for (auto _ : theState)
+  {
+    gp_Pnt aPnt;
+    double aSum = 0.0;
+    for (int anIndexU = 0; anIndexU < aNbSamples; ++anIndexU)
+    {
+      for (int anIndexV = 0; anIndexV < aNbSamples; ++anIndexV)
+      {
+        BSplSLib::D0(anIndexU * aStep,
+                     anIndexV * aStep,
+                     0,
+                     0,
+                     aSurf.Poles,
+                     nullptr,
+                     aSurf.Knots,
+                     aSurf.Knots,
+                     &aSurf.Mults,
+                     &aSurf.Mults,
+                     BicubicSurface::THE_DEGREE,
+                     BicubicSurface::THE_DEGREE,
+                     false,
+                     false,
+                     false,
+                     false,
+                     aPnt);
+        aSum += aPnt.Z();
+      }
+    }
+    benchmark::DoNotOptimize(aSum);
+  }
+  theState.SetItemsProcessed(theState.iterations() * aNbSamples * aNbSamples);
+}
+BENCHMARK(BSplSLib_D0_Grid)->Arg(32)->Arg(128)->Arg(512);
+
+static void BSplSLib_Cache_D0_Grid(benchmark::State& theState)
+{
+  const BicubicSurface aSurf(THE_NB_SPANS);
+  const int            aNbSamples = int(theState.range(0));
+  const double         aStep      = aSurf.LastParameter() / (aNbSamples - 1);
+  for (auto _ : theState)
+  {
+    BSplSLib_Cache aCache(BicubicSurface::THE_DEGREE,
+                          false,
+                          aSurf.FlatKnots,
+                          BicubicSurface::THE_DEGREE,
+                          false,
+                          aSurf.FlatKnots);
+    gp_Pnt         aPnt;
+    double         aSum = 0.0;
+    for (int anIndexU = 0; anIndexU < aNbSamples; ++anIndexU)
+    {
+      for (int anIndexV = 0; anIndexV < aNbSamples; ++anIndexV)
+      {
+        const double aU = anIndexU * aStep;
+        const double aV = anIndexV * aStep;
+        if (!aCache.IsCacheValid(aU, aV))
+        {
+          aCache.BuildCache(aU, aV, aSurf.FlatKnots, aSurf.FlatKnots, aSurf.Poles);
+        }
+        aCache.D0(aU, aV, aPnt);
+        aSum += aPnt.Z();
+      }
+    }
+    benchmark::DoNotOptimize(aSum);
+  }
+  theState.SetItemsProcessed(theState.iterations() * aNbSamples * aNbSamples);
+}
+BENCHMARK(BSplSLib_Cache_D0_Grid)->Arg(32)->Arg(128)->Arg(512);
+
+static void BSplSLib_Cache_D1_Grid(benchmark::State& theState)
+{
+  const BicubicSurface aSurf(THE_NB_SPANS);
+  const int            aNbSamples = int(theState.range(0));
+  const double         aStep      = aSurf.LastParameter() / (aNbSamples - 1);
+  for (auto _ : theState)
+  {
+    BSplSLib_Cache aCache(BicubicSurface::THE_DEGREE,
+                          false,
+                          aSurf.FlatKnots,
+                          BicubicSurface::THE_DEGREE,
+                          false,
+                          aSurf.FlatKnots);
+    gp_Pnt         aPnt;
+    gp_Vec         aDU, aDV;
+    double         aSum = 0.0;
+    for (int anIndexU = 0; anIndexU < aNbSamples; ++anIndexU)
+    {
+      for (int anIndexV = 0; anIndexV < aNbSamples; ++anIndexV)
+      {
+        const double aU = anIndexU * aStep;
+        const double aV = anIndexV * aStep;
+        if (!aCache.IsCacheValid(aU, aV))
+        {
+          aCache.BuildCache(aU, aV, aSurf.FlatKnots, aSurf.FlatKnots, aSurf.Poles);
+        }
+        aCache.D1(aU, aV, aPnt, aDU, aDV);
+        aSum += aPnt.Z() + aDU.Z() + aDV.Z();
+      }
+    }
+    benchmark::DoNotOptimize(aSum);
+  }
+  theState.SetItemsProcessed(theState.iterations() * aNbSamples * aNbSamples);
+}
+BENCHMARK(BSplSLib_Cache_D1_Grid)->Arg(32)->Arg(128)->Arg(512);
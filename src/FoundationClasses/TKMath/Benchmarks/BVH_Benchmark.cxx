@@ -0,0 +1,122 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <BVH_BinnedBuilder.hxx>
+#include <BVH_BoxSet.hxx>
+#include <BVH_LinearBuilder.hxx>
+#include <BVH_Traverse.hxx>
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+namespace
+{
+//! Returns pseudo-random boxes of size about 1 / cbrt(theNbBoxes) within the unit cube.
+std::vector<BVH_Box<double, 3>> randomBoxes(const int theNbBoxes, const unsigned theSeed)
+{
+  std::mt19937                           aGen(theSeed);
+  std::uniform_real_distribution<double> aDist(0.0, 1.0);
+  const double                           aSize = 1.0 / std::cbrt(double(theNbBoxes));
+  std::vector<BVH_Box<double, 3>>        aBoxes;
+  aBoxes.reserve(theNbBoxes);
+  for (int anIndex = 0; anIndex < theNbBoxes; ++anIndex)
+  {
+    const BVH_Vec3d aMin(aDist(aGen), aDist(aGen), aDist(aGen));
+    aBoxes.emplace_back(aMin, aMin + BVH_Vec3d(aSize, aSize, aSize) * aDist(aGen));
+  }
+  return aBoxes;
+}
+
+//! Fills the box set and builds its BVH.
+void buildBoxSet(BVH_BoxSet<double, 3>& theSet, const std::vector<BVH_Box<double, 3>>& theBoxes)
+{
+  for (size_t anIndex = 0; anIndex < theBoxes.size(); ++anIndex)
+  {
+    theSet.Add(int(anIndex), theBoxes[anIndex]);
+  }
+  theSet.Build();
+}
+
+//! Counts the elements overlapping the query box.
+class BoxOverlapCounter : public BVH_Traverse<double, 3, BVH_BoxSet<double, 3>, int>
+{
+public:
+  BoxOverlapCounter(const BVH_Box<double, 3>& theBox)
+      : myBox(theBox)
+  {
+  }
+
+  bool RejectNode(const BVH_Vec3d& theMin, const BVH_Vec3d& theMax, int&) const override
+  {
+    return myBox.IsOut(theMin, theMax);
+  }
+
+  bool Accept(const int theIndex, const int&) override
+  {
+    return !myBox.IsOut(myBVHSet->Box(theIndex));
+  }
+
+private:
+  BVH_Box<double, 3> myBox;
+};
+} // namespace
+
+static void BVH_BinnedBuilder_Build(benchmark::State& theState)
+{
+  const std::vector<BVH_Box<double, 3>> aBoxes = randomBoxes(int(theState.range(0)), 1);
+  for (auto _ : theState)
+  {
+    BVH_BoxSet<double, 3> aSet(new BVH_BinnedBuilder<double, 3>(BVH_Constants_LeafNodeSizeSmall));
+    buildBoxSet(aSet, aBoxes);
+    benchmark::DoNotOptimize(aSet.BVH()->Length());
+  }
+  theState.SetItemsProcessed(theState.iterations() * int64_t(aBoxes.size()));
+}
+BENCHMARK(BVH_BinnedBuilder_Build)->RangeMultiplier(8)->Range(1 << 10, 1 << 19);
+
+static void BVH_LinearBuilder_Build(benchmark::State& theState)
+{
+  const std::vector<BVH_Box<double, 3>> aBoxes = randomBoxes(int(theState.range(0)), 1);
+  for (auto _ : theState)
+  {
+    BVH_BoxSet<double, 3> aSet(new BVH_LinearBuilder<double, 3>(BVH_Constants_LeafNodeSizeSmall));
+    buildBoxSet(aSet, aBoxes);
+    benchmark::DoNotOptimize(aSet.BVH()->Length());
+  }
+  theState.SetItemsProcessed(theState.iterations() * int64_t(aBoxes.size()));
+}
+BENCHMARK(BVH_LinearBuilder_Build)->RangeMultiplier(8)->Range(1 << 10, 1 << 19);
+
+static void BVH_Traverse_BoxOverlap(benchmark::State& theState)
+{
+  const std::vector<BVH_Box<double, 3>> aBoxes   = randomBoxes(int(theState.range(0)), 1);
+  const std::vector<BVH_Box<double, 3>> aQueries = randomBoxes(1024, 2);
+  BVH_BoxSet<double, 3> aSet(new BVH_BinnedBuilder<double, 3>(BVH_Constants_LeafNodeSizeSmall));
+  buildBoxSet(aSet, aBoxes);
+  for (auto _ : theState)
+  {
+    int aNbOverlaps = 0;
+    for (const BVH_Box<double, 3>& aQuery : aQueries)
+    {
+      BoxOverlapCounter aCounter(aQuery);
+      aCounter.SetBVHSet(&aSet);
+      aNbOverlaps += aCounter.Select();
+    }
+    benchmark::DoNotOptimize(aNbOverlaps);
+  }
+  theState.SetItemsProcessed(theState.iterations() * int64_t(aQueries.size()));
+}
+BENCHMARK(BVH_Traverse_BoxOverlap)->RangeMultiplier(8)->Range(1 << 10, 1 << 19);
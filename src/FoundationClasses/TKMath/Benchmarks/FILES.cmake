@@ -0,0 +1,7 @@
+# Benchmark source files for TKMath
+set(OCCT_TKMath_Benchmarks_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
+
+set(OCCT_TKMath_Benchmarks_FILES
+  BSplSLib_Benchmark.cxx
+  BVH_Benchmark.cxx
+)
@@ -18,6 +18,7 @@
 #include <gp_Pnt2d.hxx>
 #include <Precision.hxx>
 
+#include <algorithm>
 #include <cmath>
 
 namespace
@@ -36,6 +37,12 @@ inline double transformToNormalized(const double theU, const double theUMin, con
   }
   return theU;
 }
+
+//! Minimal number of polygon vertices to build the band index.
+constexpr int THE_MIN_INDEXED_POINTS = 32;
+
+//! Average number of segments per band of the index.
+constexpr int THE_SEGMENTS_PER_BAND = 4;
 } // namespace
 
 //=================================================================================================
@@ -95,6 +102,96 @@ void CSLib_Class2d::init(const TCol_Containers2d& thePnts2d,
   {
     myTolV /= aDv;
   }
+
+  buildBands();
+}
+
+//=================================================================================================
+
+void CSLib_Class2d::buildBands()
+{
+  myNbBands = 0;
+  if (myPointsCount < THE_MIN_INDEXED_POINTS)
+  {
+    return;
+  }
+
+  // Segment i connects vertices i and i + 1; its Y range is extended by the tolerance
+  // (with a margin covering rounding errors), so that the ON detection finds it as well.
+  const double aMargin = 2.0 * myTolV + Precision::PConfusion();
+  myBandYMin = myPnts2dY.Value(0);
+  myBandYMax = myBandYMin;
+  for (int i = 1; i < myPointsCount; ++i)
+  {
+    myBandYMin = std::min(myBandYMin, myPnts2dY.Value(i));
+    myBandYMax = std::max(myBandYMax, myPnts2dY.Value(i));
+  }
+  myBandYMin -= aMargin;
+  myBandYMax += aMargin;
+  if (!(myBandYMax > myBandYMin))
+  {
+    return;
+  }
+
+  const int aNbBands = std::max(1, myPointsCount / THE_SEGMENTS_PER_BAND);
+  myBandScale        = double(aNbBands) / (myBandYMax - myBandYMin);
+
+  const auto aBandOf = [this, aNbBands](const double theY) {
+    return std::min(int((theY - myBandYMin) * myBandScale), aNbBands - 1);
+  };
+
+  // Count segments per band, then fill them in the second pass.
+  myBandStarts.Resize(0, aNbBands, false);
+  myBandStarts.Init(0);
+  for (int i = 0; i < myPointsCount; ++i)
+  {
+    const double aY0 = myPnts2dY.Value(i);
+    const double aY1 = myPnts2dY.Value(i + 1);
+    const int    aLo = aBandOf(std::min(aY0, aY1) - aMargin);
+    const int    aHi = aBandOf(std::max(aY0, aY1) + aMargin);
+    for (int aBand = aLo; aBand <= aHi; ++aBand)
+    {
+      ++myBandStarts.ChangeValue(aBand + 1);
+    }
+  }
+  for (int aBand = 0; aBand < aNbBands; ++aBand)
+  {
+    myBandStarts.ChangeValue(aBand + 1) += myBandStarts.Value(aBand);
+  }
+
+  myBandSegments.Resize(0, std::max(myBandStarts.Last() - 1, 0), false);
+  NCollection_Array1<int> aFill(0, aNbBands - 1);
+  for (int aBand = 0; aBand < aNbBands; ++aBand)
+  {
+    aFill.ChangeValue(aBand) = myBandStarts.Value(aBand);
+  }
+  for (int i = 0; i < myPointsCount; ++i)
+  {
+    const double aY0 = myPnts2dY.Value(i);
+    const double aY1 = myPnts2dY.Value(i + 1);
+    const int    aLo = aBandOf(std::min(aY0, aY1) - aMargin);
+    const int    aHi = aBandOf(std::max(aY0, aY1) + aMargin);
+    for (int aBand = aLo; aBand <= aHi; ++aBand)
+    {
+      myBandSegments.ChangeValue(aFill.ChangeValue(aBand)++) = i;
+    }
+  }
+  myNbBands = aNbBands;
+}
+
+//=================================================================================================
+
+bool CSLib_Class2d::bandSegments(const double theY, int& theFrom, int& theTo) const
+{
+  if (!(theY >= myBandYMin && theY <= myBandYMax))
+  {
+    return false;
+  }
+
+  const int aBand = std::min(int((theY - myBandYMin) * myBandScale), myNbBands - 1);
+  theFrom         = myBandStarts.Value(aBand);
+  theTo           = myBandStarts.Value(aBand + 1);
+  return theFrom < theTo;
 }
 
 //=================================================================================================
@@ -223,6 +320,42 @@ bool CSLib_Class2d::internalSiDans(const double thePx, const double thePy) const
   // Ray-casting algorithm: count edge crossings with a horizontal ray from (Px, Py) to +infinity.
   int aNbCrossings = 0;
 
+  if (myNbBands > 0)
+  {
+    // Each segment is tested independently, thus only the segments of the band are visited.
+    int aFrom = 0, aTo = 0;
+    if (!bandSegments(thePy, aFrom, aTo))
+    {
+      return false;
+    }
+    for (int aSegIter = aFrom; aSegIter < aTo; ++aSegIter)
+    {
+      const int    aPrevIdx = myBandSegments.Value(aSegIter);
+      const double aPrevDx  = myPnts2dX.Value(aPrevIdx) - thePx;
+      const double aPrevDy  = myPnts2dY.Value(aPrevIdx) - thePy;
+      const double aCurrDx  = myPnts2dX.Value(aPrevIdx + 1) - thePx;
+      const double aCurrDy  = myPnts2dY.Value(aPrevIdx + 1) - thePy;
+      if ((aCurrDy < 0.0) == (aPrevDy < 0.0))
+      {
+        continue;
+      }
+
+      if (aPrevDx > 0.0 && aCurrDx > 0.0)
+      {
+        ++aNbCrossings;
+      }
+      else if (aPrevDx > 0.0 || aCurrDx > 0.0)
+      {
+        const double aXIntersect = aPrevDx - aPrevDy * (aCurrDx - aPrevDx) / (aCurrDy - aPrevDy);
+        if (aXIntersect > 0.0)
+        {
+          ++aNbCrossings;
+        }
+      }
+    }
+    return (aNbCrossings & 1) != 0;
+  }
+
   double aPrevDx          = myPnts2dX.Value(0) - thePx;
   double aPrevDy          = myPnts2dY.Value(0) - thePy;
   bool   aPrevYIsNegative = (aPrevDy < 0.0);
@@ -269,6 +402,61 @@ CSLib_Class2d::Result CSLib_Class2d::internalSiDansOuOn(const double thePx,
   // Ray-casting algorithm with ON detection.
   int aNbCrossings = 0;
 
+  if (myNbBands > 0)
+  {
+    // The band keeps all segments within the V tolerance of the line,
+    // thus ON detection at vertices (the end of each segment) and on edges is complete.
+    int aFrom = 0, aTo = 0;
+    if (!bandSegments(thePy, aFrom, aTo))
+    {
+      return Result_Outside;
+    }
+    for (int aSegIter = aFrom; aSegIter < aTo; ++aSegIter)
+    {
+      const int    aPrevIdx = myBandSegments.Value(aSegIter);
+      const int    aNextIdx = aPrevIdx + 1;
+      const double aPrevDx  = myPnts2dX.Value(aPrevIdx) - thePx;
+      const double aPrevDy  = myPnts2dY.Value(aPrevIdx) - thePy;
+      const double aCurrDx  = myPnts2dX.Value(aNextIdx) - thePx;
+      const double aCurrDy  = myPnts2dY.Value(aNextIdx) - thePy;
+      if (aCurrDx < myTolU && aCurrDx > -myTolU && aCurrDy < myTolV && aCurrDy > -myTolV)
+      {
+        return Result_Uncertain;
+      }
+
+      const double aEdgeDx = myPnts2dX.Value(aNextIdx) - myPnts2dX.Value(aPrevIdx);
+      if (aPrevDx * aCurrDx < 0.0 && std::abs(aEdgeDx) > Precision::PConfusion())
+      {
+        const double aInterpY =
+          myPnts2dY.Value(aNextIdx)
+          - (myPnts2dY.Value(aNextIdx) - myPnts2dY.Value(aPrevIdx)) / aEdgeDx * aCurrDx;
+        const double aDeltaY = aInterpY - thePy;
+        if (aDeltaY >= -myTolV && aDeltaY <= myTolV)
+        {
+          return Result_Uncertain;
+        }
+      }
+
+      if ((aCurrDy < 0.0) == (aPrevDy < 0.0))
+      {
+        continue;
+      }
+      if (aPrevDx > 0.0 && aCurrDx > 0.0)
+      {
+        ++aNbCrossings;
+      }
+      else if (aPrevDx > 0.0 || aCurrDx > 0.0)
+      {
+        const double aXIntersect = aPrevDx - aPrevDy * (aCurrDx - aPrevDx) / (aCurrDy - aPrevDy);
+        if (aXIntersect > 0.0)
+        {
+          ++aNbCrossings;
+        }
+      }
+    }
+    return ((aNbCrossings & 1) != 0) ? Result_Inside : Result_Outside;
+  }
+
   double aPrevDx          = myPnts2dX.Value(0) - thePx;
   double aPrevDy          = myPnts2dY.Value(0) - thePy;
   bool   aPrevYIsNegative = (aPrevDy < 0.0);
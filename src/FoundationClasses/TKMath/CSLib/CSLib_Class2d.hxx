@@ -34,6 +34,11 @@ class gp_Pnt2d;
 //!
 //! The polygon is internally normalized to [0,1] x [0,1] domain for numerical stability.
 //!
+//! Polygons with many vertices are indexed by a uniform grid of horizontal bands,
+//! each band keeping the segments overlapping it (extended by the V tolerance),
+//! so that only the segments of a single band are tested for each point.
+//! The index is built once at construction and does not change the classification results.
+//!
 //! @note This class was moved from package BRepTopAdaptor.
 class CSLib_Class2d
 {
@@ -100,7 +105,13 @@ public:
         myUMin(theOther.myUMin),
         myVMin(theOther.myVMin),
         myUMax(theOther.myUMax),
-        myVMax(theOther.myVMax)
+        myVMax(theOther.myVMax),
+        myBandStarts(std::move(theOther.myBandStarts)),
+        myBandSegments(std::move(theOther.myBandSegments)),
+        myBandYMin(theOther.myBandYMin),
+        myBandYMax(theOther.myBandYMax),
+        myBandScale(theOther.myBandScale),
+        myNbBands(theOther.myNbBands)
   {
   }
 
@@ -118,6 +129,12 @@ public:
       myVMin        = theOther.myVMin;
       myUMax        = theOther.myUMax;
       myVMax        = theOther.myVMax;
+      myBandStarts   = std::move(theOther.myBandStarts);
+      myBandSegments = std::move(theOther.myBandSegments);
+      myBandYMin     = theOther.myBandYMin;
+      myBandYMax     = theOther.myBandYMax;
+      myBandScale    = theOther.myBandScale;
+      myNbBands      = theOther.myNbBands;
     }
     return *this;
   }
@@ -158,6 +175,14 @@ private:
   //! @return Classification result
   Result internalSiDansOuOn(double theX, double theY) const;
 
+  //! Builds the band index of segments for large polygons.
+  void buildBands();
+
+  //! Returns the range [theFrom, theTo) within myBandSegments of the segments
+  //! which might be crossed by the horizontal line at theY or lie within the tolerance of it.
+  //! @return false if no segment can be involved
+  bool bandSegments(double theY, int& theFrom, int& theTo) const;
+
   //! Initializes the classifier with polygon data.
   //! @tparam TCol_Containers2d Container type (Array1 or Sequence)
   template <class TCol_Containers2d>
@@ -185,6 +210,12 @@ private:
   double                     myVMin        = 0.0; //!< Original minimum V bound
   double                     myUMax        = 0.0; //!< Original maximum U bound
   double                     myVMax        = 0.0; //!< Original maximum V bound
+  NCollection_Array1<int>    myBandStarts;   //!< offsets of the bands within myBandSegments
+  NCollection_Array1<int>    myBandSegments; //!< indices of the segments of each band
+  double                     myBandYMin  = 0.0; //!< lower Y bound of the bands (normalized)
+  double                     myBandYMax  = 0.0; //!< upper Y bound of the bands (normalized)
+  double                     myBandScale = 0.0; //!< number of bands per unit of Y
+  int                        myNbBands   = 0;   //!< number of bands, 0 if not indexed
 };
 
 #endif // _CSLib_Class2d_HeaderFile
@@ -976,3 +976,64 @@ TEST_F(BSplSLib_CacheTest, D1_DifferentDegrees_VGreaterU)
     }
   }
 }
+
+//==================================================================================================
+// Batch evaluation tests
+//==================================================================================================
+
+TEST_F(BSplSLib_CacheTest, D0LocalBatch_RationalSurface_VGreaterU)
+{
+  // Create a rational surface with degree 2 in U, degree 5 in V
+  NCollection_Array2<gp_Pnt> aPoles(1, 3, 1, 6);
+  NCollection_Array2<double> aWeights(1, 3, 1, 6);
+  for (int i = 1; i <= 3; ++i)
+  {
+    for (int j = 1; j <= 6; ++j)
+    {
+      const double aZ = sin((i - 1) * 0.7) * cos((j - 1) * 0.3);
+      aPoles(i, j)    = gp_Pnt((i - 1) * 1.0, (j - 1) * 1.0, aZ);
+      aWeights(i, j)  = 1.0 + 0.1 * ((i + j) % 3);
+    }
+  }
+
+  NCollection_Array1<double> aKnots(1, 2);
+  aKnots(1) = 0.0;
+  aKnots(2) = 1.0;
+
+  NCollection_Array1<int> aMultsU(1, 2);
+  aMultsU(1) = 3;
+  aMultsU(2) = 3;
+
+  NCollection_Array1<int> aMultsV(1, 2);
+  aMultsV(1) = 6;
+  aMultsV(2) = 6;
+
+  NCollection_Array1<double> aFlatKnotsU(1, 6);
+  createFlatKnots(aKnots, aMultsU, aFlatKnotsU);
+
+  NCollection_Array1<double> aFlatKnotsV(1, 12);
+  createFlatKnots(aKnots, aMultsV, aFlatKnotsV);
+
+  occ::handle<BSplSLib_Cache> aCache =
+    new BSplSLib_Cache(2, false, aFlatKnotsU, 5, false, aFlatKnotsV, &aWeights);
+  aCache->BuildCache(0.5, 0.5, aFlatKnotsU, aFlatKnotsV, aPoles, &aWeights);
+
+  // Number of points is not a multiple of the batch width
+  constexpr int aNbPoints = 11;
+  double        aLocalU[aNbPoints], aLocalV[aNbPoints];
+  for (int i = 0; i < aNbPoints; ++i)
+  {
+    aLocalU[i] = -1.0 + 2.0 * i / (aNbPoints - 1);
+    aLocalV[i] = 1.0 - 1.5 * i / (aNbPoints - 1);
+  }
+
+  gp_Pnt aBatchPnts[aNbPoints];
+  aCache->D0LocalBatch(aLocalU, aLocalV, aNbPoints, aBatchPnts);
+
+  for (int i = 0; i < aNbPoints; ++i)
+  {
+    gp_Pnt aPnt;
+    aCache->D0Local(aLocalU[i], aLocalV[i], aPnt);
+    EXPECT_NEAR(aBatchPnts[i].Distance(aPnt), 0.0, THE_TOLERANCE) << "Batch D0 mismatch at " << i;
+  }
+}
@@ -0,0 +1,240 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <gtest/gtest.h>
+
+#include <BVH_BinnedBuilder.hxx>
+#include <BVH_DynamicTree.hxx>
+
+#include <cmath>
+#include <vector>
+
+namespace
+{
+//! Simple set of boxes with removal of elements by moving the last one.
+class BoxSet : public BVH_Set<double, 3>
+{
+public:
+  using BVH_Set<double, 3>::Box;
+
+  BVH_Box<double, 3> Box(const int theIndex) const override { return myBoxes[theIndex]; }
+
+  double Center(const int theIndex, const int theAxis) const override
+  {
+    return myBoxes[theIndex].Center(theAxis);
+  }
+
+  int Size() const override { return static_cast<int>(myBoxes.size()); }
+
+  void Swap(const int theIndex1, const int theIndex2) override
+  {
+    std::swap(myBoxes[theIndex1], myBoxes[theIndex2]);
+  }
+
+  std::vector<BVH_Box<double, 3>> myBoxes;
+};
+
+//! Returns box of unit size at the node of a 3D grid.
+BVH_Box<double, 3> gridBox(const int theIndex)
+{
+  const BVH_Vec3d aMin(2.0 * (theIndex % 17), 2.0 * ((theIndex / 17) % 13), 2.0 * (theIndex / 221));
+  return BVH_Box<double, 3>(aMin, aMin + BVH_Vec3d(1.0, 1.0, 1.0));
+}
+
+//! Checks the structure of the tree and returns the number of elements in it.
+int checkTree(const BVH_DynamicTree<double, 3>& theTree, const BoxSet& theSet)
+{
+  if (theTree.Length() == theTree.NbFreeNodes())
+  {
+    return 0;
+  }
+
+  int                              aNbElems  = 0;
+  int                              aMaxDepth = 0;
+  std::vector<std::pair<int, int>> aStack(1, std::make_pair(0, 0));
+  while (!aStack.empty())
+  {
+    const std::pair<int, int> aNode = aStack.back();
+    aStack.pop_back();
+    aMaxDepth = (std::max)(aMaxDepth, aNode.second);
+    const BVH_Box<double, 3> aBox(theTree.MinPoint(aNode.first), theTree.MaxPoint(aNode.first));
+    bool                     hasOverlap = false;
+    if (theTree.IsOuter(aNode.first))
+    {
+      EXPECT_EQ(theTree.BegPrimitive(aNode.first), theTree.EndPrimitive(aNode.first));
+      const int anElem = theTree.BegPrimitive(aNode.first);
+      EXPECT_EQ(aNode.first, theTree.ElementLeaf(anElem));
+      EXPECT_TRUE(aBox.Contains(theSet.Box(anElem), hasOverlap));
+      ++aNbElems;
+      continue;
+    }
+
+    const int aChildren[2] = {theTree.Child<0>(aNode.first), theTree.Child<1>(aNode.first)};
+    for (int aChildIter = 0; aChildIter < 2; ++aChildIter)
+    {
+      const int aChild = aChildren[aChildIter];
+      EXPECT_TRUE(aBox.Contains(theTree.MinPoint(aChild), theTree.MaxPoint(aChild), hasOverlap));
+      aStack.push_back(std::make_pair(aChild, aNode.second + 1));
+    }
+  }
+  EXPECT_EQ(aMaxDepth, theTree.Depth());
+  return aNbElems;
+}
+
+//! Counts the elements of the tree overlapping the box.
+int countOverlapping(const BVH_DynamicTree<double, 3>& theTree, const BVH_Box<double, 3>& theBox)
+{
+  int              aNbElems = 0;
+  std::vector<int> aStack(theTree.Length() > theTree.NbFreeNodes() ? 1 : 0, 0);
+  while (!aStack.empty())
+  {
+    const int aNode = aStack.back();
+    aStack.pop_back();
+    if (theBox.IsOut(theTree.MinPoint(aNode), theTree.MaxPoint(aNode)))
+    {
+      continue;
+    }
+
+    if (theTree.IsOuter(aNode))
+    {
+      ++aNbElems;
+    }
+    else
+    {
+      aStack.push_back(theTree.Child<0>(aNode));
+      aStack.push_back(theTree.Child<1>(aNode));
+    }
+  }
+  return aNbElems;
+}
+} // namespace
+
+TEST(BVH_DynamicTreeTest, IncrementalInsertion)
+{
+  BoxSet                     aSet;
+  BVH_DynamicTree<double, 3> aTree;
+  const int                  aNbElems = 2000;
+  for (int anElemIter = 0; anElemIter < aNbElems; ++anElemIter)
+  {
+    aSet.myBoxes.push_back(gridBox(anElemIter));
+    aTree.Insert(aSet, anElemIter);
+  }
+
+  EXPECT_TRUE(aTree.IsDynamic());
+  EXPECT_EQ(aNbElems, checkTree(aTree, aSet));
+  EXPECT_EQ(2 * aNbElems - 1, aTree.Length());
+
+  // balancing keeps the tree depth logarithmic even for ordered insertion
+  EXPECT_LE(aTree.Depth(), static_cast<int>(2.0 * std::log2(double(aNbElems))));
+
+  const BVH_Box<double, 3> aQuery(BVH_Vec3d(-0.5, -0.5, -0.5), BVH_Vec3d(4.5, 4.5, 4.5));
+  EXPECT_EQ(27, countOverlapping(aTree, aQuery));
+}
+
+TEST(BVH_DynamicTreeTest, InsertionAtRoot)
+{
+  // each new box is either growing to enclose all previous ones or is far away from them,
+  // so that the new leaf is always added at the root of the tree
+  const int aNbElems = 200;
+  for (int aCaseIter = 0; aCaseIter < 2; ++aCaseIter)
+  {
+    BoxSet                     aSet;
+    BVH_DynamicTree<double, 3> aTree;
+    double                     aSize = 1.0;
+    for (int anElemIter = 0; anElemIter < aNbElems; ++anElemIter)
+    {
+      const BVH_Vec3d aMin = aCaseIter == 0 ? BVH_Vec3d(-aSize, -aSize, -aSize)
+                                            : BVH_Vec3d(aSize, 0.0, 0.0);
+      const BVH_Vec3d aMax = aCaseIter == 0 ? BVH_Vec3d(aSize, aSize, aSize)
+                                            : BVH_Vec3d(aSize + 1.0, 1.0, 1.0);
+      aSet.myBoxes.push_back(BVH_Box<double, 3>(aMin, aMax));
+      aTree.Insert(aSet, anElemIter);
+      aSize *= 4.0;
+    }
+
+    EXPECT_TRUE(aTree.IsDynamic());
+    EXPECT_EQ(aNbElems, checkTree(aTree, aSet));
+    EXPECT_LE(aTree.Depth(), static_cast<int>(2.0 * std::log2(double(aNbElems))));
+  }
+}
+
+TEST(BVH_DynamicTreeTest, UpdatesAfterBuild)
+{
+  BoxSet aSet;
+  for (int anElemIter = 0; anElemIter < 1000; ++anElemIter)
+  {
+    aSet.myBoxes.push_back(gridBox(anElemIter));
+  }
+
+  // leaves with several elements are split by initialization
+  BVH_DynamicTree<double, 3>   aTree;
+  BVH_BinnedBuilder<double, 3> aBuilder(4, BVH_Constants_MaxTreeDepth);
+  aBuilder.Build(&aSet, &aTree, aSet.Box());
+  EXPECT_TRUE(aTree.Init(aSet));
+  EXPECT_EQ(1000, checkTree(aTree, aSet));
+  EXPECT_EQ(1999, aTree.Length());
+
+  // remove every second element moving the last one to its place
+  for (int anElemIter = aSet.Size() - 1; anElemIter >= 0; anElemIter -= 2)
+  {
+    const int aLast = aSet.Size() - 1;
+    aTree.Remove(anElemIter);
+    aTree.ChangeElementIndex(aLast, anElemIter);
+    aSet.Swap(anElemIter, aLast);
+    aSet.myBoxes.pop_back();
+  }
+  EXPECT_EQ(500, checkTree(aTree, aSet));
+  EXPECT_EQ(aTree.Length() - 999, aTree.NbFreeNodes());
+
+  // move elements far away
+  for (int anElemIter = 0; anElemIter < 100; ++anElemIter)
+  {
+    aSet.myBoxes[anElemIter] = gridBox(anElemIter + 5000);
+    aTree.Update(aSet, anElemIter);
+  }
+  EXPECT_EQ(500, checkTree(aTree, aSet));
+  EXPECT_EQ(aTree.Length() - 999, aTree.NbFreeNodes());
+
+  int                      aNbExpected = 0;
+  const BVH_Box<double, 3> aQuery(BVH_Vec3d(-0.5, -0.5, -0.5), BVH_Vec3d(20.5, 20.5, 20.5));
+  for (int anElemIter = 0; anElemIter < aSet.Size(); ++anElemIter)
+  {
+    aNbExpected += aQuery.IsOut(aSet.Box(anElemIter)) ? 0 : 1;
+  }
+  EXPECT_EQ(aNbExpected, countOverlapping(aTree, aQuery));
+}
+
+TEST(BVH_DynamicTreeTest, RemoveAll)
+{
+  BoxSet                     aSet;
+  BVH_DynamicTree<double, 3> aTree;
+  for (int anElemIter = 0; anElemIter < 100; ++anElemIter)
+  {
+    aSet.myBoxes.push_back(gridBox(anElemIter));
+    aTree.Insert(aSet, anElemIter);
+  }
+
+  for (int anElemIter = 0; anElemIter < 100; ++anElemIter)
+  {
+    aTree.Remove(anElemIter);
+    EXPECT_EQ(99 - anElemIter, checkTree(aTree, aSet));
+    EXPECT_EQ(-1, aTree.ElementLeaf(anElemIter));
+  }
+  EXPECT_EQ(0, aTree.Length());
+  EXPECT_EQ(0, aTree.Depth());
+
+  // the tree is reusable after removal of all elements
+  aTree.Insert(aSet, 42);
+  EXPECT_EQ(1, checkTree(aTree, aSet));
+  EXPECT_EQ(0, aTree.ElementLeaf(42));
+}
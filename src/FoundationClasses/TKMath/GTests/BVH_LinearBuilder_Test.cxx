@@ -328,3 +328,92 @@ TEST(BVH_LinearBuilderTest, NegativeCoordinates)
   const opencascade::handle<BVH_Tree<double, 3>>& aBVH = aBoxSet.BVH();
   EXPECT_GT(aBVH->Length(), 1);
 }
+
+namespace
+{
+//! Fills the box set with the boxes in pseudo-random positions.
+void fillRandomBoxes(BVH_BoxSet<double, 3>& theBoxSet, const int theNbBoxes)
+{
+  unsigned int aSeed = 12345U;
+  const auto   aRandom = [&aSeed]() {
+    aSeed = aSeed * 1103515245U + 12345U;
+    return static_cast<double>((aSeed >> 8) % 10000U) * 0.01;
+  };
+  for (int i = 0; i < theNbBoxes; ++i)
+  {
+    const BVH_Vec3d aMin(aRandom(), aRandom(), aRandom());
+    theBoxSet.Add(i, BVH_Box<double, 3>(aMin, aMin + BVH_Vec3d(0.5, 0.5, 0.5)));
+  }
+}
+
+//! Checks that every node is reachable once from the root, that the node boxes contain
+//! the boxes of children and elements, and returns the number of elements in the leaves.
+int checkTree(const BVH_Tree<double, 3>& theBVH, const BVH_BoxSet<double, 3>& theBoxSet)
+{
+  std::vector<int> aNbVisits(theBVH.Length(), 0);
+  std::vector<int> aStack(1, 0);
+  int              aNbElements = 0;
+  while (!aStack.empty())
+  {
+    const int aNode = aStack.back();
+    aStack.pop_back();
+    ++aNbVisits[aNode];
+
+    const BVH_Box<double, 3> aNodeBox(theBVH.MinPoint(aNode), theBVH.MaxPoint(aNode));
+    if (theBVH.IsOuter(aNode))
+    {
+      for (int anElem = theBVH.BegPrimitive(aNode); anElem <= theBVH.EndPrimitive(aNode); ++anElem)
+      {
+        EXPECT_FALSE(aNodeBox.IsOut(theBoxSet.Box(anElem).CornerMin()));
+        EXPECT_FALSE(aNodeBox.IsOut(theBoxSet.Box(anElem).CornerMax()));
+        ++aNbElements;
+      }
+      continue;
+    }
+
+    for (int aChildIdx = 0; aChildIdx < 2; ++aChildIdx)
+    {
+      const int aChild = aChildIdx == 0 ? theBVH.Child<0>(aNode) : theBVH.Child<1>(aNode);
+      EXPECT_GT(aChild, 0);
+      EXPECT_LT(aChild, theBVH.Length());
+      EXPECT_FALSE(aNodeBox.IsOut(theBVH.MinPoint(aChild)));
+      EXPECT_FALSE(aNodeBox.IsOut(theBVH.MaxPoint(aChild)));
+      aStack.push_back(aChild);
+    }
+  }
+
+  for (int aNode = 0; aNode < theBVH.Length(); ++aNode)
+  {
+    EXPECT_EQ(aNbVisits[aNode], 1);
+  }
+  return aNbElements;
+}
+} // namespace
+
+TEST(BVH_LinearBuilderTest, ParallelBuildMatchesSequential)
+{
+  const int aNbBoxes = 20000;
+
+  opencascade::handle<BVH_LinearBuilder<double, 3>> aSeqBuilder =
+    new BVH_LinearBuilder<double, 3>(4, 32);
+  BVH_BoxSet<double, 3> aSeqBoxSet(aSeqBuilder);
+  fillRandomBoxes(aSeqBoxSet, aNbBoxes);
+  aSeqBoxSet.Build();
+
+  opencascade::handle<BVH_LinearBuilder<double, 3>> aParBuilder =
+    new BVH_LinearBuilder<double, 3>(4, 32);
+  aParBuilder->SetParallel(true);
+  BVH_BoxSet<double, 3> aParBoxSet(aParBuilder);
+  fillRandomBoxes(aParBoxSet, aNbBoxes);
+  aParBoxSet.Build();
+
+  const opencascade::handle<BVH_Tree<double, 3>>& aSeqBVH = aSeqBoxSet.BVH();
+  const opencascade::handle<BVH_Tree<double, 3>>& aParBVH = aParBoxSet.BVH();
+
+  // the same hierarchy with nodes in the different order
+  EXPECT_EQ(aParBVH->Length(), aSeqBVH->Length());
+  EXPECT_EQ(aParBVH->Depth(), aSeqBVH->Depth());
+  EXPECT_NEAR(aParBVH->EstimateSAH(), aSeqBVH->EstimateSAH(), 1.e-6 * aSeqBVH->EstimateSAH());
+  EXPECT_EQ(checkTree(*aParBVH, aParBoxSet), aNbBoxes);
+  EXPECT_EQ(checkTree(*aSeqBVH, aSeqBoxSet), aNbBoxes);
+}
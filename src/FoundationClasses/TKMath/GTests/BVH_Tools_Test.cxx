@@ -774,3 +774,115 @@ TEST(BVH_ToolsTest, RayBoxIntersectionNegativeTime)
   EXPECT_TRUE(aHit2);
   EXPECT_TRUE(aTimeLeave >= 0.0);
 }
+
+namespace
+{
+//! Fills the lane of SoA boxes of quad BVH node by the given box.
+void setQuadNodeLane(BVH_QuadNodeBoxes<3>& theBoxes,
+                     const int             theLane,
+                     const BVH_Vec3d&      theMin,
+                     const BVH_Vec3d&      theMax)
+{
+  for (int anAxis = 0; anAxis < 3; ++anAxis)
+  {
+    theBoxes.MinPoint[anAxis][theLane] = static_cast<float>(theMin[anAxis]);
+    theBoxes.MaxPoint[anAxis][theLane] = static_cast<float>(theMax[anAxis]);
+  }
+}
+
+//! Creates SoA boxes of three unit cubes along X axis (0..1, 2..3, 4..5) and one empty lane.
+BVH_QuadNodeBoxes<3> createQuadNodeBoxes()
+{
+  BVH_QuadNodeBoxes<3> aBoxes;
+  for (int aLane = 0; aLane < 3; ++aLane)
+  {
+    const double aShift = 2.0 * aLane;
+    setQuadNodeLane(aBoxes,
+                    aLane,
+                    BVH_Vec3d(aShift, 0.0, 0.0),
+                    BVH_Vec3d(aShift + 1.0, 1.0, 1.0));
+  }
+  for (int anAxis = 0; anAxis < 3; ++anAxis)
+  {
+    aBoxes.MinPoint[anAxis][3] = std::numeric_limits<float>::max();
+    aBoxes.MaxPoint[anAxis][3] = std::numeric_limits<float>::lowest();
+  }
+  return aBoxes;
+}
+
+typedef BVH_Tools<double, 3> BVH_Tools3d;
+} // namespace
+
+TEST(BVH_ToolsTest, RoundToFloatOutward)
+{
+  const double aValue = 0.1;
+  EXPECT_LE(static_cast<double>(BVH::RoundDownToFloat(aValue)), aValue);
+  EXPECT_GE(static_cast<double>(BVH::RoundUpToFloat(aValue)), aValue);
+  EXPECT_EQ(BVH::RoundDownToFloat(1.0), 1.0f);
+  EXPECT_EQ(BVH::RoundUpToFloat(1.0), 1.0f);
+  EXPECT_EQ(BVH::RoundDownToFloat(1.e300), std::numeric_limits<float>::max());
+  EXPECT_TRUE(std::isinf(BVH::RoundUpToFloat(1.e300)));
+}
+
+TEST(BVH_ToolsTest, BoxQuadNodeOverlap)
+{
+  const BVH_QuadNodeBoxes<3> aBoxes = createQuadNodeBoxes();
+
+  EXPECT_EQ(
+    BVH_Tools3d::BoxQuadNodeOverlap(aBoxes, BVH_Vec3d(0.5, 0.5, 0.5), BVH_Vec3d(2.5, 0.7, 0.7)),
+    0x3);
+  EXPECT_EQ(BVH_Tools3d::BoxQuadNodeOverlap(aBoxes,
+                                            BVH_Vec3d(-10.0, -10.0, -10.0),
+                                            BVH_Vec3d(10.0, 10.0, 10.0)),
+            0x7);
+  EXPECT_EQ(
+    BVH_Tools3d::BoxQuadNodeOverlap(aBoxes, BVH_Vec3d(0.0, 2.0, 0.0), BVH_Vec3d(5.0, 3.0, 1.0)),
+    0x0);
+  // touching boxes overlap
+  EXPECT_EQ(
+    BVH_Tools3d::BoxQuadNodeOverlap(aBoxes, BVH_Vec3d(5.0, 1.0, 1.0), BVH_Vec3d(6.0, 2.0, 2.0)),
+    0x4);
+}
+
+TEST(BVH_ToolsTest, PointQuadNodeSquareDistance)
+{
+  const BVH_QuadNodeBoxes<3> aBoxes = createQuadNodeBoxes();
+
+  double aSqDists[4];
+  BVH_Tools3d::PointQuadNodeSquareDistance(aBoxes, BVH_Vec3d(2.5, 2.0, 0.5), aSqDists);
+  EXPECT_NEAR(aSqDists[0], 1.5 * 1.5 + 1.0, Precision::Confusion());
+  EXPECT_NEAR(aSqDists[1], 1.0, Precision::Confusion());
+  EXPECT_NEAR(aSqDists[2], 1.5 * 1.5 + 1.0, Precision::Confusion());
+  EXPECT_GT(aSqDists[3], 1.e30);
+}
+
+TEST(BVH_ToolsTest, RayQuadNodeIntersection)
+{
+  const BVH_QuadNodeBoxes<3> aBoxes = createQuadNodeBoxes();
+
+  double aTimeEnter[4];
+  // ray along X through all the boxes
+  const BVH_Ray<double, 3> aRayX(BVH_Vec3d(-1.0, 0.5, 0.5), BVH_Vec3d(1.0, 0.0, 0.0));
+  EXPECT_EQ(BVH_Tools3d::RayQuadNodeIntersection(aRayX, aBoxes, 100.0, aTimeEnter), 0x7);
+  EXPECT_NEAR(aTimeEnter[0], 1.0, Precision::Confusion());
+  EXPECT_NEAR(aTimeEnter[1], 3.0, Precision::Confusion());
+  EXPECT_NEAR(aTimeEnter[2], 5.0, Precision::Confusion());
+
+  // limited hit time
+  EXPECT_EQ(BVH_Tools3d::RayQuadNodeIntersection(aRayX, aBoxes, 3.5, aTimeEnter), 0x3);
+
+  // opposite ray from the inside of the second box
+  const BVH_Ray<double, 3> aRayBack(BVH_Vec3d(2.5, 0.5, 0.5), BVH_Vec3d(-1.0, 0.0, 0.0));
+  EXPECT_EQ(BVH_Tools3d::RayQuadNodeIntersection(aRayBack, aBoxes, 100.0, aTimeEnter), 0x3);
+  EXPECT_NEAR(aTimeEnter[0], 1.5, Precision::Confusion());
+  EXPECT_NEAR(aTimeEnter[1], 0.0, Precision::Confusion());
+
+  // vertical ray hitting only the third box
+  const BVH_Ray<double, 3> aRayZ(BVH_Vec3d(4.5, 0.5, -1.0), BVH_Vec3d(0.0, 0.0, 1.0));
+  EXPECT_EQ(BVH_Tools3d::RayQuadNodeIntersection(aRayZ, aBoxes, 100.0, aTimeEnter), 0x4);
+  EXPECT_NEAR(aTimeEnter[2], 1.0, Precision::Confusion());
+
+  // ray missing all the boxes
+  const BVH_Ray<double, 3> aRayMiss(BVH_Vec3d(-1.0, 2.0, 0.5), BVH_Vec3d(1.0, 0.0, 0.0));
+  EXPECT_EQ(BVH_Tools3d::RayQuadNodeIntersection(aRayMiss, aBoxes, 100.0, aTimeEnter), 0x0);
+}
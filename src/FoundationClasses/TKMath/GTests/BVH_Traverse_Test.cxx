@@ -14,6 +14,7 @@
 #include <gtest/gtest.h>
 
 #include <BVH_BinnedBuilder.hxx>
+#include <BVH_Tools.hxx>
 #include <BVH_Traverse.hxx>
 #include <BVH_Triangulation.hxx>
 
@@ -192,6 +193,36 @@ private:
   int myAcceptedCount;
 };
 
+//! Box selector testing the children of quad BVH node at once by their SoA boxes
+class BVH_QuadBoxSelector : public BVH_BoxSelector
+{
+public:
+  BVH_QuadBoxSelector(const BVH_Box<double, 3>& theBox)
+      : BVH_BoxSelector(theBox),
+        myCornerMin(theBox.CornerMin()),
+        myCornerMax(theBox.CornerMax())
+  {
+  }
+
+  int RejectChildren(const BVH_Tree<double, 3, BVH_QuadTree>& theBVH,
+                     const int                                theNode,
+                     double                                   theMetrics[4]) const override
+  {
+    for (int aLane = 0; aLane < 4; ++aLane)
+    {
+      theMetrics[aLane] = 0.0;
+    }
+    return ~BVH_Tools<double, 3>::BoxQuadNodeOverlap(theBVH.ChildBoxes(theNode),
+                                                     myCornerMin,
+                                                     myCornerMax)
+           & 0xF;
+  }
+
+private:
+  BVH_Vec3d myCornerMin;
+  BVH_Vec3d myCornerMax;
+};
+
 // =======================================================================================
 // Test implementations of BVH_PairTraverse
 // =======================================================================================
@@ -664,3 +695,103 @@ TEST(BVH_PairTraverseTest, LargeDataSets)
 
   EXPECT_EQ(aCount, 2500); // 50 x 50 pairs
 }
+
+// =======================================================================================
+// Tests for traverse of quad BVH trees
+// =======================================================================================
+
+TEST(BVH_QuadTraverseTest, ChildBoxesContainChildren)
+{
+  opencascade::handle<BVH_Tree<double, 3>> aBVH = CreateSimpleTriangulationBVH(100);
+  opencascade::handle<BVH_Tree<double, 3, BVH_QuadTree>> aQBVH = aBVH->CollapseToQuadTree();
+  ASSERT_TRUE(aQBVH->HasChildBoxes());
+
+  for (int aNodeIdx = 0; aNodeIdx < aQBVH->Length(); ++aNodeIdx)
+  {
+    if (aQBVH->IsOuter(aNodeIdx))
+    {
+      continue;
+    }
+    const BVH_QuadNodeBoxes<3>& aBoxes = aQBVH->ChildBoxes(aNodeIdx);
+    for (int aLane = 0; aLane < aQBVH->NbChildren(aNodeIdx); ++aLane)
+    {
+      const int aChild = aQBVH->Child<0>(aNodeIdx) + aLane;
+      for (int anAxis = 0; anAxis < 3; ++anAxis)
+      {
+        EXPECT_LE(aBoxes.MinPoint[anAxis][aLane], aQBVH->MinPoint(aChild)[anAxis]);
+        EXPECT_GE(aBoxes.MaxPoint[anAxis][aLane], aQBVH->MaxPoint(aChild)[anAxis]);
+      }
+    }
+  }
+}
+
+TEST(BVH_QuadTraverseTest, CountAllElements)
+{
+  opencascade::handle<BVH_Tree<double, 3>> aBVH = CreateSimpleTriangulationBVH(1000);
+
+  BVH_CountAllElements aSelector;
+  EXPECT_EQ(aSelector.Select(aBVH->CollapseToQuadTree()), 1000);
+}
+
+TEST(BVH_QuadTraverseTest, BoxSelectionMatchesBinary)
+{
+  opencascade::handle<BVH_Tree<double, 3>> aBVH = CreateSimpleTriangulationBVH(200);
+  opencascade::handle<BVH_Tree<double, 3, BVH_QuadTree>> aQBVH = aBVH->CollapseToQuadTree();
+
+  BVH_Box<double, 3> aBox(BVH_Vec3d(50.5, -1.0, -1.0), BVH_Vec3d(120.5, 2.0, 1.0));
+
+  BVH_BoxSelector aBinarySelector(aBox);
+  const int       aNbBinary = aBinarySelector.Select(aBVH);
+  EXPECT_GT(aNbBinary, 0);
+
+  BVH_BoxSelector aQuadSelector(aBox);
+  EXPECT_EQ(aQuadSelector.Select(aQBVH), aNbBinary);
+
+  BVH_QuadBoxSelector aSoASelector(aBox);
+  EXPECT_EQ(aSoASelector.Select(aQBVH), aNbBinary);
+}
+
+TEST(BVH_QuadTraverseTest, DistanceSelectionMatchesBinary)
+{
+  opencascade::handle<BVH_Tree<double, 3>> aBVH = CreateSimpleTriangulationBVH(100);
+
+  BVH_DistanceSelector aBinarySelector(BVH_Vec3d(77.0, 3.0, 0.0), 10.0);
+  aBinarySelector.Select(aBVH);
+
+  BVH_DistanceSelector aQuadSelector(BVH_Vec3d(77.0, 3.0, 0.0), 10.0);
+  aQuadSelector.Select(aBVH->CollapseToQuadTree());
+
+  EXPECT_EQ(aQuadSelector.ClosestIndex(), aBinarySelector.ClosestIndex());
+  EXPECT_NEAR(aQuadSelector.MinDistance(), aBinarySelector.MinDistance(), 1.e-12);
+}
+
+TEST(BVH_QuadTraverseTest, EarlyTermination)
+{
+  opencascade::handle<BVH_Tree<double, 3>> aBVH = CreateSimpleTriangulationBVH(100);
+
+  BVH_LimitedSelector aSelector(5);
+  EXPECT_EQ(aSelector.Select(aBVH->CollapseToQuadTree()), 5);
+}
+
+TEST(BVH_QuadPairTraverseTest, CountAllPairs)
+{
+  opencascade::handle<BVH_Tree<double, 3>> aBVH1 = CreateSimpleTriangulationBVH(3);
+  opencascade::handle<BVH_Tree<double, 3>> aBVH2 = CreateSimpleTriangulationBVH(70);
+
+  BVH_CountAllPairs aSelector;
+  EXPECT_EQ(aSelector.Select(aBVH1->CollapseToQuadTree(), aBVH2->CollapseToQuadTree()), 210);
+}
+
+TEST(BVH_QuadPairTraverseTest, OverlapDetectionMatchesBinary)
+{
+  opencascade::handle<BVH_Tree<double, 3>> aBVH1 = CreateSimpleTriangulationBVH(100);
+  opencascade::handle<BVH_Tree<double, 3>> aBVH2 = CreateSimpleTriangulationBVH(40);
+
+  BVH_OverlapDetector aBinarySelector;
+  const int           aNbBinary = aBinarySelector.Select(aBVH1, aBVH2);
+  EXPECT_GT(aNbBinary, 0);
+
+  BVH_OverlapDetector aQuadSelector;
+  EXPECT_EQ(aQuadSelector.Select(aBVH1->CollapseToQuadTree(), aBVH2->CollapseToQuadTree()),
+            aNbBinary);
+}
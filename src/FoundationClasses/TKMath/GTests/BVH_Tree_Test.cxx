@@ -15,6 +15,8 @@
 
 #include <BVH_BinaryTree.hxx>
 #include <BVH_Box.hxx>
+#include <BVH_BoxSet.hxx>
+#include <BVH_LinearBuilder.hxx>
 #include <Precision.hxx>
 
 TEST(BVH_TreeTest, DefaultConstructor)
@@ -397,3 +399,102 @@ TEST(BVH_TreeTest, MinMaxPointBuffers)
   EXPECT_EQ(aMinSize, 1);
   EXPECT_EQ(aMaxSize, 1);
 }
+
+namespace
+{
+//! Box set allowing to move its boxes.
+class BVH_MovableBoxSet : public BVH_BoxSet<double, 3>
+{
+public:
+  BVH_MovableBoxSet()
+      : BVH_BoxSet<double, 3>(new BVH_LinearBuilder<double, 3>(2, 32))
+  {
+  }
+
+  //! Moves the box with the given index.
+  void Translate(const int theIndex, const BVH_Vec3d& theShift)
+  {
+    myBoxes[theIndex] =
+      BVH_Box<double, 3>(myBoxes[theIndex].CornerMin() + theShift,
+                         myBoxes[theIndex].CornerMax() + theShift);
+  }
+};
+
+//! Checks that node boxes are exactly the unions of the boxes of their children or elements.
+void checkRefitted(const BVH_Tree<double, 3>& theBVH, const BVH_Set<double, 3>& theSet)
+{
+  for (int aNode = 0; aNode < theBVH.Length(); ++aNode)
+  {
+    BVH_Box<double, 3> aBox;
+    if (theBVH.IsOuter(aNode))
+    {
+      for (int anElem = theBVH.BegPrimitive(aNode); anElem <= theBVH.EndPrimitive(aNode); ++anElem)
+      {
+        aBox.Combine(theSet.Box(anElem));
+      }
+    }
+    else
+    {
+      aBox.Combine(BVH_Box<double, 3>(theBVH.MinPoint(theBVH.Child<0>(aNode)),
+                                      theBVH.MaxPoint(theBVH.Child<0>(aNode))));
+      aBox.Combine(BVH_Box<double, 3>(theBVH.MinPoint(theBVH.Child<1>(aNode)),
+                                      theBVH.MaxPoint(theBVH.Child<1>(aNode))));
+    }
+    for (int anAxis = 0; anAxis < 3; ++anAxis)
+    {
+      EXPECT_EQ(theBVH.MinPoint(aNode)[anAxis], aBox.CornerMin()[anAxis]);
+      EXPECT_EQ(theBVH.MaxPoint(aNode)[anAxis], aBox.CornerMax()[anAxis]);
+    }
+  }
+}
+} // namespace
+
+TEST(BVH_TreeTest, RefitAfterMove)
+{
+  for (int aParallelIter = 0; aParallelIter < 2; ++aParallelIter)
+  {
+    BVH_MovableBoxSet aBoxSet;
+    for (int i = 0; i < 500; ++i)
+    {
+      const BVH_Vec3d aMin(i % 10, (i / 10) % 10, i / 100);
+      aBoxSet.Add(i, BVH_Box<double, 3>(aMin, aMin + BVH_Vec3d(0.5, 0.5, 0.5)));
+    }
+    const opencascade::handle<BVH_Tree<double, 3>> aBVH    = aBoxSet.BVH();
+    const int                                      aLength = aBVH->Length();
+
+    for (int i = 0; i < aBoxSet.Size(); i += 7)
+    {
+      aBoxSet.Translate(i, BVH_Vec3d(0.3, -0.2, 10.0));
+    }
+    aBoxSet.Refit(aParallelIter == 1);
+
+    EXPECT_FALSE(aBoxSet.IsDirty());
+    EXPECT_EQ(aBoxSet.BVH().get(), aBVH.get());
+    EXPECT_EQ(aBVH->Length(), aLength);
+    checkRefitted(*aBVH, aBoxSet);
+    EXPECT_NEAR(aBoxSet.Box().CornerMax().z(), 14.5, Precision::Confusion());
+  }
+}
+
+TEST(BVH_TreeTest, RefitSkipsInvalidBoxes)
+{
+  BVH_Tree<double, 3>   aTree;
+  BVH_BoxSet<double, 3> aBoxSet;
+  aBoxSet.Add(0, BVH_Box<double, 3>(BVH_Vec3d(0.0, 0.0, 0.0), BVH_Vec3d(1.0, 1.0, 1.0)));
+  aBoxSet.Add(1, BVH_Box<double, 3>());
+
+  // root with two leaves, the second one containing invalid box only
+  aTree.AddInnerNode(1, 2);
+  aTree.AddLeafNode(0, 0);
+  aTree.AddLeafNode(1, 1);
+  aTree.MinPointBuffer().resize(3);
+  aTree.MaxPointBuffer().resize(3);
+  aTree.Refit(aBoxSet);
+
+  const BVH_Box<double, 3> aValidLeafBox(aTree.MinPoint(1), aTree.MaxPoint(1));
+  const BVH_Box<double, 3> anInvalidLeafBox(aTree.MinPoint(2), aTree.MaxPoint(2));
+  EXPECT_TRUE(aValidLeafBox.IsValid());
+  EXPECT_FALSE(anInvalidLeafBox.IsValid());
+  EXPECT_NEAR(aTree.MaxPoint(0).x(), 1.0, Precision::Confusion());
+  EXPECT_NEAR(aTree.MinPoint(0).x(), 0.0, Precision::Confusion());
+}
@@ -21,6 +21,7 @@
 
 #include <gp.hxx>
 #include <gp_Dir.hxx>
+#include <gp_Dir2d.hxx>
 #include <gp_Pnt2d.hxx>
 #include <gp_Vec.hxx>
 #include <Precision.hxx>
@@ -335,6 +336,46 @@ TEST_F(CSLibClass2dTest, DegeneratePolygon_InvalidBounds)
   EXPECT_EQ(aClassifier.SiDans(aPoint), 0);
 }
 
+// Test large polygon classified using the band index of segments
+TEST_F(CSLibClass2dTest, LargePolygon_Circle)
+{
+  const int                    aNbPnts = 2000;
+  NCollection_Array1<gp_Pnt2d> aPnts(1, aNbPnts);
+  for (int i = 1; i <= aNbPnts; ++i)
+  {
+    const double anAngle = 2.0 * M_PI * (i - 1) / aNbPnts;
+    aPnts(i)             = gp_Pnt2d(5.0 + 4.0 * std::cos(anAngle), 5.0 + 4.0 * std::sin(anAngle));
+  }
+
+  CSLib_Class2d aSource(aPnts, 1e-6, 1e-6, 0.0, 0.0, 10.0, 10.0);
+  CSLib_Class2d aClassifier(std::move(aSource));
+  for (int i = 0; i < 64; ++i)
+  {
+    const double anAngle = 2.0 * M_PI * (i + 0.5) / 64;
+    const gp_Dir2d aDir(std::cos(anAngle), std::sin(anAngle));
+    EXPECT_EQ(aClassifier.SiDans(gp_Pnt2d(5.0 + 3.9 * aDir.X(), 5.0 + 3.9 * aDir.Y())),
+              CSLib_Class2d::Result_Inside);
+    EXPECT_EQ(aClassifier.SiDans(gp_Pnt2d(5.0 + 4.1 * aDir.X(), 5.0 + 4.1 * aDir.Y())),
+              CSLib_Class2d::Result_Outside);
+    EXPECT_EQ(aClassifier.SiDans_OnMode(gp_Pnt2d(5.0 + 0.5 * aDir.X(), 5.0 + 0.5 * aDir.Y()), 0.1),
+              CSLib_Class2d::Result_Inside);
+  }
+
+  // vertices and points on the segments are detected as ON
+  for (int i = 1; i <= aNbPnts; i += 97)
+  {
+    const gp_Pnt2d& aP1 = aPnts(i);
+    const gp_Pnt2d& aP2 = aPnts(i % aNbPnts + 1);
+    EXPECT_EQ(aClassifier.SiDans(aP1), CSLib_Class2d::Result_Uncertain);
+    EXPECT_EQ(aClassifier.SiDans(gp_Pnt2d(0.5 * (aP1.XY() + aP2.XY()))),
+              CSLib_Class2d::Result_Uncertain);
+  }
+
+  // points far above or below the polygon
+  EXPECT_EQ(aClassifier.SiDans(gp_Pnt2d(5.0, 9.5)), CSLib_Class2d::Result_Outside);
+  EXPECT_EQ(aClassifier.SiDans(gp_Pnt2d(5.0, 0.5)), CSLib_Class2d::Result_Outside);
+}
+
 //=================================================================================================
 // CSLib_NormalPolyDef Tests
 //=================================================================================================
@@ -12,6 +12,7 @@ set(OCCT_TKMath_GTests_FILES
   BVH_BinnedBuilder_Test.cxx
   BVH_Box_Test.cxx
   BVH_BuildQueue_Test.cxx
+  BVH_DynamicTree_Test.cxx
   BVH_LinearBuilder_Test.cxx
   BVH_QuickSorter_Test.cxx
   BVH_RadixSorter_Test.cxx
@@ -90,4 +91,7 @@ set(OCCT_TKMath_GTests_FILES
   PLib_Test.cxx
   PLib_JacobiPolynomial_Test.cxx
   PLib_HermitJacobi_Test.cxx
+  Poly_MergeNodesTool_Test.cxx
+  Poly_Triangulation_Test.cxx
+  Poly_VertexCacheOptimizer_Test.cxx
 )
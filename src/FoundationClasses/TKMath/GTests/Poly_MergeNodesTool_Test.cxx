@@ -0,0 +1,125 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <gtest/gtest.h>
+
+#include <Poly_MergeNodesTool.hxx>
+#include <Poly_Triangulation.hxx>
+
+#include <cmath>
+
+namespace
+{
+//! Create wavy patch of NxN quads split into triangles with the origin at specified grid cell;
+//! neighbor patches have coincident nodes along common borders.
+occ::handle<Poly_Triangulation> createPatch(const int    theSize,
+                                            const int    theRow,
+                                            const int    theCol,
+                                            const double theShift)
+{
+  occ::handle<Poly_Triangulation> aTris =
+    new Poly_Triangulation((theSize + 1) * (theSize + 1), 2 * theSize * theSize, false);
+  for (int aRow = 0; aRow <= theSize; ++aRow)
+  {
+    for (int aCol = 0; aCol <= theSize; ++aCol)
+    {
+      const double aX = theRow * theSize + aRow, aY = theCol * theSize + aCol;
+      aTris->SetNode(1 + aRow * (theSize + 1) + aCol,
+                     gp_Pnt(aX - theShift, aY - theShift, 2.0 * std::sin(aX * 0.1) + theShift));
+    }
+  }
+
+  int aTriIndex = 0;
+  for (int aRow = 0; aRow < theSize; ++aRow)
+  {
+    for (int aCol = 0; aCol < theSize; ++aCol)
+    {
+      const int aNode00 = 1 + aRow * (theSize + 1) + aCol;
+      const int aNode10 = aNode00 + theSize + 1;
+      aTris->SetTriangle(++aTriIndex, Poly_Triangle(aNode00, aNode00 + 1, aNode10 + 1));
+      aTris->SetTriangle(++aTriIndex, Poly_Triangle(aNode00, aNode10 + 1, aNode10));
+    }
+  }
+  return aTris;
+}
+
+//! Create 2x2 patches, optionally slightly shifted from each other
+//! so that coincident nodes might be split by borders of slabs used for parallel merging.
+NCollection_Array1<Poly_MergeNodesTool::TriangulationPart> createParts(const int    theSize,
+                                                                       const double theShift)
+{
+  NCollection_Array1<Poly_MergeNodesTool::TriangulationPart> aParts(1, 4);
+  for (int aPartIter = 0; aPartIter < 4; ++aPartIter)
+  {
+    aParts.ChangeValue(aPartIter + 1).Triangulation =
+      createPatch(theSize, aPartIter / 2, aPartIter % 2, theShift * aPartIter);
+  }
+  return aParts;
+}
+} // namespace
+
+TEST(Poly_MergeNodesToolTest, ParallelMergeSameAsSequential)
+{
+  const int                                                        aSize  = 100;
+  const NCollection_Array1<Poly_MergeNodesTool::TriangulationPart> aParts = createParts(aSize, 0.0);
+
+  Poly_MergeNodesTool aSeqTool(M_PI / 4.0);
+  for (int aPartIter = aParts.Lower(); aPartIter <= aParts.Upper(); ++aPartIter)
+  {
+    aSeqTool.AddTriangulation(aParts.Value(aPartIter).Triangulation);
+  }
+  const occ::handle<Poly_Triangulation> aSeqTris = aSeqTool.Result();
+
+  Poly_MergeNodesTool aParTool(M_PI / 4.0);
+  aParTool.AddTriangulations(aParts);
+  const occ::handle<Poly_Triangulation> aParTris = aParTool.Result();
+
+  EXPECT_EQ((2 * aSize + 1) * (2 * aSize + 1), aSeqTris->NbNodes());
+  ASSERT_EQ(aSeqTris->NbNodes(), aParTris->NbNodes());
+  ASSERT_EQ(aSeqTris->NbTriangles(), aParTris->NbTriangles());
+  for (int aNodeIter = 1; aNodeIter <= aSeqTris->NbNodes(); ++aNodeIter)
+  {
+    ASSERT_TRUE(aSeqTris->Node(aNodeIter).IsEqual(aParTris->Node(aNodeIter), 0.0))
+      << "node " << aNodeIter;
+  }
+  for (int aTriIter = 1; aTriIter <= aSeqTris->NbTriangles(); ++aTriIter)
+  {
+    int aSeqNodes[3], aParNodes[3];
+    aSeqTris->Triangle(aTriIter).Get(aSeqNodes[0], aSeqNodes[1], aSeqNodes[2]);
+    aParTris->Triangle(aTriIter).Get(aParNodes[0], aParNodes[1], aParNodes[2]);
+    ASSERT_TRUE(aSeqNodes[0] == aParNodes[0] && aSeqNodes[1] == aParNodes[1]
+                && aSeqNodes[2] == aParNodes[2])
+      << "triangle " << aTriIter;
+  }
+}
+
+TEST(Poly_MergeNodesToolTest, ParallelMergeWithTolerance)
+{
+  const int                                                        aSize = 100;
+  const NCollection_Array1<Poly_MergeNodesTool::TriangulationPart> aParts =
+    createParts(aSize, 1.0e-6);
+
+  Poly_MergeNodesTool aTool(M_PI / 4.0, 1.0e-4);
+  aTool.AddTriangulations(aParts);
+  const occ::handle<Poly_Triangulation> aTris = aTool.Result();
+  EXPECT_EQ((2 * aSize + 1) * (2 * aSize + 1), aTris->NbNodes());
+  EXPECT_EQ(8 * aSize * aSize, aTris->NbTriangles());
+
+  // sequential merge of a single part is used for small meshes
+  Poly_MergeNodesTool aSmallTool(M_PI / 4.0, 1.0e-4, 2);
+  NCollection_Array1<Poly_MergeNodesTool::TriangulationPart> aSmallParts(1, 1);
+  aSmallParts.ChangeFirst().Triangulation = createPatch(1, 0, 0, 0.0);
+  aSmallTool.AddTriangulations(aSmallParts);
+  EXPECT_EQ(4, aSmallTool.NbNodes());
+  EXPECT_EQ(2, aSmallTool.NbElements());
+}
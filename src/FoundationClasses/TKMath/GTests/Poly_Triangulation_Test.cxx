@@ -0,0 +1,115 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <gtest/gtest.h>
+
+#include <Poly_Triangulation.hxx>
+
+namespace
+{
+//! Create sphere-like triangulation of a far located grid with UV nodes and normals.
+occ::handle<Poly_Triangulation> createSphereGrid(const int theSize, const gp_XYZ& theCenter)
+{
+  const int                       aNbNodes = (theSize + 1) * (theSize + 1);
+  occ::handle<Poly_Triangulation> aTris =
+    new Poly_Triangulation(aNbNodes, 2 * theSize * theSize, true, true);
+  for (int aRow = 0; aRow <= theSize; ++aRow)
+  {
+    for (int aCol = 0; aCol <= theSize; ++aCol)
+    {
+      const int    aNode = 1 + aRow * (theSize + 1) + aCol;
+      const double anU   = 2.0 * M_PI * aCol / theSize;
+      const double aV    = M_PI * aRow / theSize - M_PI_2;
+      const gp_Dir aNorm(std::cos(aV) * std::cos(anU),
+                         std::cos(aV) * std::sin(anU),
+                         std::sin(aV));
+      aTris->SetNode(aNode, gp_Pnt(theCenter + aNorm.XYZ() * 10.0));
+      aTris->SetUVNode(aNode, gp_Pnt2d(anU, aV));
+      aTris->SetNormal(aNode, aNorm);
+    }
+  }
+  int aTri = 1;
+  for (int aRow = 0; aRow < theSize; ++aRow)
+  {
+    for (int aCol = 0; aCol < theSize; ++aCol)
+    {
+      const int aNode = 1 + aRow * (theSize + 1) + aCol;
+      aTris->SetTriangle(aTri++, Poly_Triangle(aNode, aNode + 1, aNode + theSize + 2));
+      aTris->SetTriangle(aTri++, Poly_Triangle(aNode, aNode + theSize + 2, aNode + theSize + 1));
+    }
+  }
+  return aTris;
+}
+} // namespace
+
+TEST(Poly_TriangulationTest, CompactKeepsNodesAndNormals)
+{
+  const gp_XYZ                          aCenter(1.0e5, -2.0e5, 3.0e5);
+  const occ::handle<Poly_Triangulation> aRef  = createSphereGrid(32, aCenter);
+  const occ::handle<Poly_Triangulation> aTris = aRef->Copy();
+  aTris->Compact();
+
+  EXPECT_TRUE(aTris->IsCompact());
+  EXPECT_FALSE(aTris->IsDoublePrecision());
+  EXPECT_FALSE(aTris->HasUVNodes());
+  EXPECT_TRUE(aTris->HasNormals());
+  EXPECT_TRUE(aTris->HasQuantizedNormals());
+  EXPECT_TRUE(aTris->InternalNormals().IsEmpty());
+  EXPECT_TRUE(aTris->NodesOrigin().IsEqual(aCenter, 1.0e-6));
+  ASSERT_EQ(aRef->NbNodes(), aTris->NbNodes());
+  ASSERT_EQ(aRef->NbTriangles(), aTris->NbTriangles());
+
+  // single precision relative to origin keeps far located nodes accurate
+  for (int aNodeIter = 1; aNodeIter <= aRef->NbNodes(); ++aNodeIter)
+  {
+    EXPECT_NEAR(0.0, aRef->Node(aNodeIter).Distance(aTris->Node(aNodeIter)), 1.0e-5);
+    EXPECT_LT(aRef->Normal(aNodeIter).Angle(aTris->Normal(aNodeIter)), 1.0e-3);
+  }
+
+  // copy and modification of compact triangulation
+  const occ::handle<Poly_Triangulation> aCopy = aTris->Copy();
+  EXPECT_TRUE(aCopy->IsCompact());
+  EXPECT_TRUE(aCopy->Node(1).IsEqual(aTris->Node(1), 0.0));
+  aCopy->SetNode(1, gp_Pnt(aCenter + gp_XYZ(1.0, 2.0, 3.0)));
+  EXPECT_TRUE(aCopy->Node(1).IsEqual(gp_Pnt(aCenter + gp_XYZ(1.0, 2.0, 3.0)), 1.0e-5));
+  aCopy->SetNormal(1, gp_Dir(0.0, -1.0, 0.0));
+  EXPECT_LT(aCopy->Normal(1).Angle(gp_Dir(0.0, -1.0, 0.0)), 1.0e-3);
+
+  const occ::handle<NCollection_HArray1<gp_Pnt>> aNodes = aTris->MapNodeArray();
+  ASSERT_FALSE(aNodes.IsNull());
+  EXPECT_TRUE(aNodes->Value(aNodes->Lower()).IsEqual(aTris->Node(1), 0.0));
+
+  Bnd_Box aBox;
+  ASSERT_TRUE(aTris->MinMax(aBox, gp_Trsf(), true));
+  EXPECT_TRUE(aBox.CornerMin().IsEqual(gp_Pnt(aCenter - gp_XYZ(10.0, 10.0, 10.0)), 1.0e-3));
+}
+
+TEST(Poly_TriangulationTest, CompactWithoutQuantization)
+{
+  const occ::handle<Poly_Triangulation> aTris = createSphereGrid(8, gp_XYZ());
+  aTris->Compact(false);
+  EXPECT_TRUE(aTris->IsCompact());
+  EXPECT_TRUE(aTris->HasNormals());
+  EXPECT_FALSE(aTris->HasQuantizedNormals());
+
+  aTris->Compact(true);
+  EXPECT_TRUE(aTris->HasQuantizedNormals());
+  aTris->ComputeNormals();
+  EXPECT_TRUE(aTris->HasQuantizedNormals());
+
+  aTris->Clear();
+  EXPECT_FALSE(aTris->IsCompact());
+  EXPECT_FALSE(aTris->HasNormals());
+  EXPECT_TRUE(aTris->NodesOrigin().IsEqual(gp_XYZ(), 0.0));
+}
@@ -0,0 +1,161 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <gtest/gtest.h>
+
+#include <Poly_PolygonOnTriangulation.hxx>
+#include <Poly_Triangulation.hxx>
+#include <Poly_VertexCacheOptimizer.hxx>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace
+{
+//! Create regular grid of NxN quads split into triangles, listed in shuffled order.
+occ::handle<Poly_Triangulation> createShuffledGrid(const int theSize)
+{
+  occ::handle<Poly_Triangulation> aTris =
+    new Poly_Triangulation((theSize + 1) * (theSize + 1), 2 * theSize * theSize, true);
+  for (int aRow = 0; aRow <= theSize; ++aRow)
+  {
+    for (int aCol = 0; aCol <= theSize; ++aCol)
+    {
+      const int aNode = 1 + aRow * (theSize + 1) + aCol;
+      aTris->SetNode(aNode, gp_Pnt(aRow, aCol, 0.0));
+      aTris->SetUVNode(aNode, gp_Pnt2d(aRow, aCol));
+    }
+  }
+
+  std::vector<Poly_Triangle> aTriangles;
+  for (int aRow = 0; aRow < theSize; ++aRow)
+  {
+    for (int aCol = 0; aCol < theSize; ++aCol)
+    {
+      const int aNode00 = 1 + aRow * (theSize + 1) + aCol;
+      const int aNode10 = aNode00 + theSize + 1;
+      aTriangles.push_back(Poly_Triangle(aNode00, aNode00 + 1, aNode10 + 1));
+      aTriangles.push_back(Poly_Triangle(aNode00, aNode10 + 1, aNode10));
+    }
+  }
+  std::mt19937 aRandom(1);
+  std::shuffle(aTriangles.begin(), aTriangles.end(), aRandom);
+  for (size_t aTriIter = 0; aTriIter < aTriangles.size(); ++aTriIter)
+  {
+    aTris->SetTriangle(int(aTriIter + 1), aTriangles[aTriIter]);
+  }
+  return aTris;
+}
+
+//! Return sorted list of triangles defined by node coordinates.
+std::vector<std::vector<double>> triangleCoords(const Poly_Triangulation& theTris)
+{
+  std::vector<std::vector<double>> aResult;
+  for (int aTriIter = 1; aTriIter <= theTris.NbTriangles(); ++aTriIter)
+  {
+    int aNodes[3];
+    theTris.Triangle(aTriIter).Get(aNodes[0], aNodes[1], aNodes[2]);
+    // rotate to start from the smallest node to compare triangles keeping orientation
+    std::vector<std::vector<double>> aPnts;
+    for (int aNodeIter = 0; aNodeIter < 3; ++aNodeIter)
+    {
+      const gp_Pnt aPnt = theTris.Node(aNodes[aNodeIter]);
+      aPnts.push_back({aPnt.X(), aPnt.Y(), aPnt.Z()});
+    }
+    std::rotate(aPnts.begin(), std::min_element(aPnts.begin(), aPnts.end()), aPnts.end());
+    std::vector<double> aTri;
+    for (const std::vector<double>& aPnt : aPnts)
+    {
+      aTri.insert(aTri.end(), aPnt.begin(), aPnt.end());
+    }
+    aResult.push_back(aTri);
+  }
+  std::sort(aResult.begin(), aResult.end());
+  return aResult;
+}
+} // namespace
+
+TEST(Poly_VertexCacheOptimizerTest, EmptyTriangulation)
+{
+  occ::handle<Poly_Triangulation> aTris = new Poly_Triangulation();
+  Poly_VertexCacheOptimizer       anOptimizer;
+  EXPECT_FALSE(anOptimizer.Perform(*aTris));
+  EXPECT_FALSE(anOptimizer.Apply(aTris));
+  EXPECT_EQ(Poly_VertexCacheOptimizer::AverageCacheMissRatio(*aTris), 0.0);
+}
+
+TEST(Poly_VertexCacheOptimizerTest, ReducesCacheMisses)
+{
+  occ::handle<Poly_Triangulation> aTris   = createShuffledGrid(40);
+  const double                    anAcmr0 = Poly_VertexCacheOptimizer::AverageCacheMissRatio(*aTris);
+  EXPECT_GT(anAcmr0, 2.5);
+
+  Poly_VertexCacheOptimizer anOptimizer;
+  ASSERT_TRUE(anOptimizer.Perform(*aTris));
+  EXPECT_GE(anOptimizer.NbClusters(), 1);
+  ASSERT_TRUE(anOptimizer.Apply(aTris));
+
+  const double anAcmr1 = Poly_VertexCacheOptimizer::AverageCacheMissRatio(*aTris);
+  EXPECT_LT(anAcmr1, 0.8);
+}
+
+TEST(Poly_VertexCacheOptimizerTest, KeepsGeometry)
+{
+  occ::handle<Poly_Triangulation>        aTris     = createShuffledGrid(12);
+  const std::vector<std::vector<double>> aTrisOrig = triangleCoords(*aTris);
+  const gp_Pnt                           aNodeOrig = aTris->Node(7);
+
+  Poly_VertexCacheOptimizer anOptimizer(8, 1.5);
+  ASSERT_TRUE(anOptimizer.Perform(*aTris));
+  ASSERT_TRUE(anOptimizer.Apply(aTris));
+  EXPECT_EQ(triangleCoords(*aTris), aTrisOrig);
+
+  // node map and node order are inverse permutations
+  const int aNewNode = anOptimizer.NodeMap().Value(7);
+  EXPECT_EQ(anOptimizer.NodeOrder().Value(aNewNode), 7);
+  EXPECT_TRUE(aTris->Node(aNewNode).IsEqual(aNodeOrig, 0.0));
+  EXPECT_TRUE(aTris->UVNode(aNewNode).IsEqual(gp_Pnt2d(aNodeOrig.X(), aNodeOrig.Y()), 0.0));
+
+  // nodes are numbered by first use
+  int aFirstNodes[3];
+  aTris->Triangle(1).Get(aFirstNodes[0], aFirstNodes[1], aFirstNodes[2]);
+  EXPECT_EQ(aFirstNodes[0], 1);
+  EXPECT_EQ(aFirstNodes[1], 2);
+  EXPECT_EQ(aFirstNodes[2], 3);
+}
+
+TEST(Poly_VertexCacheOptimizerTest, RenumbersPolygonOnTriangulation)
+{
+  occ::handle<Poly_Triangulation> aTris = createShuffledGrid(4);
+  NCollection_Array1<int>         aPolyNodes(1, 5);
+  for (int aNodeIter = 1; aNodeIter <= 5; ++aNodeIter)
+  {
+    aPolyNodes.SetValue(aNodeIter, aNodeIter);
+  }
+  Poly_PolygonOnTriangulation aPolygon(aPolyNodes);
+
+  Poly_VertexCacheOptimizer anOptimizer;
+  ASSERT_TRUE(anOptimizer.Perform(*aTris));
+  NCollection_Array1<gp_Pnt> aPntsOrig(1, 5);
+  for (int aNodeIter = 1; aNodeIter <= 5; ++aNodeIter)
+  {
+    aPntsOrig.SetValue(aNodeIter, aTris->Node(aNodeIter));
+  }
+  ASSERT_TRUE(anOptimizer.Apply(aTris));
+  anOptimizer.Apply(aPolygon);
+  for (int aNodeIter = 1; aNodeIter <= 5; ++aNodeIter)
+  {
+    EXPECT_TRUE(aTris->Node(aPolygon.Node(aNodeIter)).IsEqual(aPntsOrig.Value(aNodeIter), 0.0));
+  }
+}
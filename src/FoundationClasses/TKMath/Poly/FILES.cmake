@@ -38,4 +38,6 @@ set(OCCT_Poly_FILES
   Poly_TriangulationParameters.cxx
   Poly_Triangulation.cxx
   Poly_Triangulation.hxx
+  Poly_VertexCacheOptimizer.cxx
+  Poly_VertexCacheOptimizer.hxx
 )
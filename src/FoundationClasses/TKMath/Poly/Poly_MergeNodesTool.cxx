@@ -14,6 +14,8 @@
 #include <Poly_MergeNodesTool.hxx>
 
 #include <NCollection_IncAllocator.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_Parallel.hxx>
 #include <Standard_CStringHasher.hxx>
 
 #include <algorithm>
@@ -27,6 +29,22 @@ static int initialNbBuckets(int theNbFacets)
            ? theNbFacets * 2 // consider ratio 1:2 (NbTriangles:MergedNodes) as expected
            : 995329;         // default initial value for mesh of unknown size
 }
+
+//! Computes normal of the triangle in the same way as Poly_MergeNodesTool::computeTriNormal().
+static NCollection_Vec3<float> elemNormal(const gp_XYZ* thePlaces)
+{
+  const gp_XYZ            aVec01 = thePlaces[1] - thePlaces[0];
+  const gp_XYZ            aVec02 = thePlaces[2] - thePlaces[0];
+  const gp_XYZ            aCross = aVec01 ^ aVec02;
+  NCollection_Vec3<float> aNorm((float)aCross.X(), (float)aCross.Y(), (float)aCross.Z());
+  return aNorm.Normalized();
+}
+
+//! Converts node position to the map key.
+static NCollection_Vec3<float> nodeKey(const gp_XYZ& thePlace)
+{
+  return NCollection_Vec3<float>((float)thePlace.X(), (float)thePlace.Y(), (float)thePlace.Z());
+}
 } // namespace
 
 IMPLEMENT_STANDARD_RTTIEXT(Poly_MergeNodesTool, Standard_Transient)
@@ -339,7 +357,13 @@ void Poly_MergeNodesTool::PushLastElement(int theNbNodes)
       pushNodeNoMerge(3);
     }
   }
+  pushElementIndices(theNbNodes);
+}
+
+//=================================================================================================
 
+void Poly_MergeNodesTool::pushElementIndices(const int theNbNodes)
+{
   if (myToDropDegenerative)
   {
     // warning - removing degenerate elements may produce unused nodes
@@ -429,6 +453,264 @@ void Poly_MergeNodesTool::AddTriangulation(const occ::handle<Poly_Triangulation>
 
 //=================================================================================================
 
+void Poly_MergeNodesTool::AddTriangulations(const NCollection_Array1<TriangulationPart>& theParts,
+                                            const bool theToParallel)
+{
+  // minimal number of elements per slab worth a dedicated task
+  constexpr int THE_MIN_SLAB_ELEMS = 4096;
+
+  int                             aNbTris = 0, aNbNodes = 0;
+  occ::handle<Poly_Triangulation> aFirstTris;
+  NCollection_Array1<int>         aTriOffsets(theParts.Lower(), theParts.Upper() + 1);
+  for (int aPartIter = theParts.Lower(); aPartIter <= theParts.Upper(); ++aPartIter)
+  {
+    aTriOffsets.SetValue(aPartIter, aNbTris);
+    const occ::handle<Poly_Triangulation>& aTris = theParts.Value(aPartIter).Triangulation;
+    if (!aTris.IsNull())
+    {
+      aFirstTris = aFirstTris.IsNull() ? aTris : aFirstTris;
+      aNbTris += aTris->NbTriangles();
+      aNbNodes += aTris->NbNodes();
+    }
+  }
+  aTriOffsets.SetValue(theParts.Upper() + 1, aNbTris);
+
+  int aNbSlabs = std::min(OSD_Parallel::NbLogicalProcessors() * 4, aNbTris / THE_MIN_SLAB_ELEMS);
+  if (!theToParallel || aNbSlabs < 2 || myPolyData.IsNull() || myNbNodes != 0
+      || (!myNodeIndexMap.HasMergeAngle() && !myNodeIndexMap.HasMergeTolerance()))
+  {
+    for (int aPartIter = theParts.Lower(); aPartIter <= theParts.Upper(); ++aPartIter)
+    {
+      const TriangulationPart& aPart = theParts.Value(aPartIter);
+      AddTriangulation(aPart.Triangulation, aPart.Trsf, aPart.ToReverse);
+    }
+    return;
+  }
+
+  if (myPolyData->NbNodes() == 0)
+  {
+    // preallocate optimistically
+    myPolyData->SetDoublePrecision(aFirstTris->IsDoublePrecision());
+    myPolyData->ResizeNodes(aNbNodes, false);
+    myPolyData->ResizeTriangles(aNbTris, false);
+  }
+
+  // fill in transformed element nodes and element normals
+  const bool                                  toComputeNormals = !myNodeIndexMap.ToMergeAnyAngle();
+  const int                                   aNbCorners       = aNbTris * 3;
+  NCollection_Array1<gp_XYZ>                  aPlaces(0, aNbCorners - 1);
+  NCollection_Array1<NCollection_Vec3<float>> aNormals(0, toComputeNormals ? aNbTris - 1 : 0);
+  NCollection_Array1<gp_XYZ>                  aPartMin(theParts.Lower(), theParts.Upper());
+  NCollection_Array1<gp_XYZ>                  aPartMax(theParts.Lower(), theParts.Upper());
+  OSD_Parallel::For(
+    theParts.Lower(),
+    theParts.Upper() + 1,
+    [&](int thePartIndex) {
+      const TriangulationPart& aPart = theParts.Value(thePartIndex);
+      gp_XYZ&                  aMin  = aPartMin.ChangeValue(thePartIndex);
+      gp_XYZ&                  aMax  = aPartMax.ChangeValue(thePartIndex);
+      aMin.SetCoord(RealLast(), RealLast(), RealLast());
+      aMax.SetCoord(RealFirst(), RealFirst(), RealFirst());
+      if (aPart.Triangulation.IsNull())
+      {
+        return;
+      }
+
+      const occ::handle<Poly_Triangulation>& aTris = aPart.Triangulation;
+      for (int anElemIter = 1, aTriIndex = aTriOffsets.Value(thePartIndex);
+           anElemIter <= aTris->NbTriangles();
+           ++anElemIter, ++aTriIndex)
+      {
+        Poly_Triangle anElem = aTris->Triangle(anElemIter);
+        if (aPart.ToReverse)
+        {
+          anElem = Poly_Triangle(anElem.Value(1), anElem.Value(3), anElem.Value(2));
+        }
+
+        gp_XYZ* aTriPlaces = &aPlaces.ChangeValue(aTriIndex * 3);
+        for (int aTriNodeIter = 0; aTriNodeIter < 3; ++aTriNodeIter)
+        {
+          const gp_Pnt aNode =
+            aTris->Node(anElem.Value(aTriNodeIter + 1)).Transformed(aPart.Trsf);
+          aTriPlaces[aTriNodeIter] = aNode.XYZ();
+          aMin.SetCoord(std::min(aMin.X(), aNode.X()),
+                        std::min(aMin.Y(), aNode.Y()),
+                        std::min(aMin.Z(), aNode.Z()));
+          aMax.SetCoord(std::max(aMax.X(), aNode.X()),
+                        std::max(aMax.Y(), aNode.Y()),
+                        std::max(aMax.Z(), aNode.Z()));
+        }
+        if (toComputeNormals)
+        {
+          aNormals.ChangeValue(aTriIndex) = elemNormal(aTriPlaces);
+        }
+      }
+    },
+    theParts.Length() < 2);
+
+  // split the largest dimension into slabs, which should be wide enough
+  // for each border node to be stitched with a single neighbor slab
+  gp_XYZ aMin(RealLast(), RealLast(), RealLast()), aMax(RealFirst(), RealFirst(), RealFirst());
+  for (int aPartIter = theParts.Lower(); aPartIter <= theParts.Upper(); ++aPartIter)
+  {
+    aMin.SetCoord(std::min(aMin.X(), aPartMin.Value(aPartIter).X()),
+                  std::min(aMin.Y(), aPartMin.Value(aPartIter).Y()),
+                  std::min(aMin.Z(), aPartMin.Value(aPartIter).Z()));
+    aMax.SetCoord(std::max(aMax.X(), aPartMax.Value(aPartIter).X()),
+                  std::max(aMax.Y(), aPartMax.Value(aPartIter).Y()),
+                  std::max(aMax.Z(), aPartMax.Value(aPartIter).Z()));
+  }
+  const gp_XYZ aSize  = aMax - aMin;
+  const int    anAxis = aSize.X() >= aSize.Y() ? (aSize.X() >= aSize.Z() ? 1 : 3)
+                                               : (aSize.Y() >= aSize.Z() ? 2 : 3);
+  const double aRangeMin  = aMin.Coord(anAxis);
+  const double aRange     = aSize.Coord(anAxis);
+  const double aBorderTol = 2.0 * myNodeIndexMap.MergeTolerance();
+  if (aBorderTol > 0.0)
+  {
+    aNbSlabs = (int)std::min((double)aNbSlabs, aRange / (4.0 * aBorderTol));
+  }
+  aNbSlabs                = aRange > 0.0 ? std::max(aNbSlabs, 1) : 1;
+  const double aSlabWidth = aRange / aNbSlabs;
+  const auto   aSlabCoord = [&](int theCorner) {
+    // use exactly the same coordinates as map keys to put equal nodes into the same slab
+    return (double)nodeKey(aPlaces.Value(theCorner))[anAxis - 1];
+  };
+
+  // sort element nodes by slabs preserving their order
+  NCollection_Array1<int> aSlabCorners(0, aNbCorners - 1);
+  NCollection_Array1<int> aSlabStarts(0, aNbSlabs);
+  aSlabStarts.Init(0);
+  {
+    NCollection_Array1<int> aCornerSlabs(0, aNbCorners - 1);
+    OSD_Parallel::For(0, aNbCorners, [&](int theCorner) {
+      const int aSlab =
+        aSlabWidth > 0.0 ? (int)((aSlabCoord(theCorner) - aRangeMin) / aSlabWidth) : 0;
+      aCornerSlabs.SetValue(theCorner, std::max(0, std::min(aSlab, aNbSlabs - 1)));
+    });
+    for (int aCornerIter = 0; aCornerIter < aNbCorners; ++aCornerIter)
+    {
+      ++aSlabStarts.ChangeValue(aCornerSlabs.Value(aCornerIter) + 1);
+    }
+    for (int aSlabIter = 1; aSlabIter <= aNbSlabs; ++aSlabIter)
+    {
+      aSlabStarts.ChangeValue(aSlabIter) += aSlabStarts.Value(aSlabIter - 1);
+    }
+    NCollection_Array1<int> aSlabEnds(0, aNbSlabs - 1);
+    for (int aSlabIter = 0; aSlabIter < aNbSlabs; ++aSlabIter)
+    {
+      aSlabEnds.SetValue(aSlabIter, aSlabStarts.Value(aSlabIter));
+    }
+    for (int aCornerIter = 0; aCornerIter < aNbCorners; ++aCornerIter)
+    {
+      aSlabCorners.SetValue(aSlabEnds.ChangeValue(aCornerSlabs.Value(aCornerIter))++, aCornerIter);
+    }
+  }
+
+  // merge nodes within each slab; each element node refers to the first merged one
+  const auto aNodeNormal = [&](int theCorner) -> const NCollection_Vec3<float>& {
+    return toComputeNormals ? aNormals.Value(theCorner / 3) : myTriNormal;
+  };
+  NCollection_Array1<int>                     aCornerNodes(0, aNbCorners - 1);
+  NCollection_Array1<NCollection_Vector<int>> aLowerBorder(0, aNbSlabs - 1);
+  NCollection_Array1<NCollection_Vector<int>> anUpperBorder(0, aNbSlabs - 1);
+  OSD_Parallel::For(
+    0,
+    aNbSlabs,
+    [&](int theSlab) {
+      const int      aFrom   = aSlabStarts.Value(theSlab);
+      const int      aTo     = aSlabStarts.Value(theSlab + 1);
+      const double   aLower  = aRangeMin + theSlab * aSlabWidth;
+      const double   anUpper = aLower + aSlabWidth;
+      MergedNodesMap aNodeMap(initialNbBuckets((aTo - aFrom) / 3));
+      aNodeMap.CopyParameters(myNodeIndexMap);
+      for (int aCornerIter = aFrom; aCornerIter < aTo; ++aCornerIter)
+      {
+        const int aCorner    = aSlabCorners.Value(aCornerIter);
+        int       aNode      = aCorner;
+        bool      isOpposite = false;
+        if (aNodeMap.Bind(aNode, isOpposite, nodeKey(aPlaces.Value(aCorner)), aNodeNormal(aCorner))
+            && aBorderTol > 0.0)
+        {
+          const double aCoord = aSlabCoord(aCorner);
+          if (theSlab > 0 && aCoord - aLower <= aBorderTol)
+          {
+            aLowerBorder.ChangeValue(theSlab).Append(aCorner);
+          }
+          if (theSlab + 1 < aNbSlabs && anUpper - aCoord <= aBorderTol)
+          {
+            anUpperBorder.ChangeValue(theSlab).Append(aCorner);
+          }
+        }
+        aCornerNodes.SetValue(aCorner, aNode);
+      }
+    },
+    aNbSlabs < 2);
+
+  // stitch nodes near borders of neighbor slabs
+  if (aBorderTol > 0.0)
+  {
+    OSD_Parallel::For(
+      0,
+      aNbSlabs - 1,
+      [&](int theSlab) {
+        const NCollection_Vector<int>& aBelow  = anUpperBorder.Value(theSlab);
+        const NCollection_Vector<int>& anAbove = aLowerBorder.Value(theSlab + 1);
+        if (aBelow.IsEmpty() || anAbove.IsEmpty())
+        {
+          return;
+        }
+
+        MergedNodesMap aNodeMap(initialNbBuckets(aBelow.Length()));
+        aNodeMap.CopyParameters(myNodeIndexMap);
+        bool isOpposite = false;
+        for (NCollection_Vector<int>::Iterator aNodeIter(aBelow); aNodeIter.More();
+             aNodeIter.Next())
+        {
+          int aNode = aNodeIter.Value();
+          aNodeMap.Bind(aNode, isOpposite, nodeKey(aPlaces.Value(aNode)), aNodeNormal(aNode));
+        }
+        for (NCollection_Vector<int>::Iterator aNodeIter(anAbove); aNodeIter.More();
+             aNodeIter.Next())
+        {
+          int aNode = aNodeIter.Value();
+          if (!aNodeMap.Bind(aNode, isOpposite, nodeKey(aPlaces.Value(aNode)), aNodeNormal(aNode)))
+          {
+            aCornerNodes.SetValue(aNodeIter.Value(), aNode);
+          }
+        }
+      },
+      aNbSlabs < 3);
+  }
+
+  // number merged nodes in order of their first appearance and push elements
+  NCollection_Array1<int>& aNodeIndices = aSlabCorners;
+  aNodeIndices.Init(-1);
+  for (int aTriIter = 0; aTriIter < aNbTris; ++aTriIter)
+  {
+    for (int aTriNodeIter = 0; aTriNodeIter < 3; ++aTriNodeIter)
+    {
+      // node stitched with neighbor slab refers to the node of that slab
+      const int aNode      = aCornerNodes.Value(aCornerNodes.Value(aTriIter * 3 + aTriNodeIter));
+      int&      aNodeIndex = aNodeIndices.ChangeValue(aNode);
+      if (aNodeIndex < 0)
+      {
+        aNodeIndex = myNbNodes++;
+        if (myPolyData->NbNodes() < myNbNodes)
+        {
+          myPolyData->ResizeNodes(myNbNodes * 2, true);
+        }
+        myPolyData->SetNode(myNbNodes, aPlaces.Value(aNode) * myUnitFactor);
+      }
+      myNodeInds[aTriNodeIter] = aNodeIndex;
+    }
+    myNodeInds[3] = -1;
+    pushElementIndices(3);
+  }
+}
+
+//=================================================================================================
+
 occ::handle<Poly_Triangulation> Poly_MergeNodesTool::Result()
 {
   if (myPolyData.IsNull())
@@ -14,6 +14,7 @@
 #ifndef _Poly_MergeNodesTool_HeaderFile
 #define _Poly_MergeNodesTool_HeaderFile
 
+#include <NCollection_Array1.hxx>
 #include <NCollection_Map.hxx>
 #include <Poly_Triangulation.hxx>
 #include <Standard_HashUtils.hxx>
@@ -105,6 +106,41 @@ public:
                                                 const gp_Trsf& theTrsf      = gp_Trsf(),
                                                 const bool     theToReverse = false);
 
+  //! Triangulation to be added by AddTriangulations().
+  struct TriangulationPart
+  {
+    occ::handle<Poly_Triangulation> Triangulation; //!< triangulation to add
+    gp_Trsf                         Trsf;          //!< transformation to apply
+    bool                            ToReverse;     //!< reverse triangle nodes order
+
+    TriangulationPart()
+        : ToReverse(false)
+    {
+    }
+
+    TriangulationPart(const occ::handle<Poly_Triangulation>& theTris,
+                      const gp_Trsf&                         theTrsf,
+                      const bool                             theToReverse)
+        : Triangulation(theTris),
+          Trsf(theTrsf),
+          ToReverse(theToReverse)
+    {
+    }
+  };
+
+  //! Add several triangulations at once merging their nodes in parallel threads.
+  //! Space is split into slabs along the largest dimension of the mesh, nodes within each slab are
+  //! merged independently and then nodes lying within merge tolerance from slab borders are
+  //! stitched. With zero merge tolerance the result is exactly the same as from sequential
+  //! AddTriangulation() calls, while with non-zero tolerance the choice of merged node
+  //! within ambiguous clusters near slab borders may differ.
+  //! Falls back to sequential AddTriangulation() calls for small meshes,
+  //! when the tool is not empty, output is not defined or nodes are not merged at all.
+  //! @param[in] theParts      triangulations to add
+  //! @param[in] theToParallel flag to use parallel threads
+  Standard_EXPORT void AddTriangulations(const NCollection_Array1<TriangulationPart>& theParts,
+                                         const bool theToParallel = true);
+
   //! Prepare and return result triangulation (temporary data will be truncated to result size).
   Standard_EXPORT occ::handle<Poly_Triangulation> Result();
 
@@ -177,6 +213,10 @@ private:
     myNodeInds[theTriNode] = aNodeIndex;
   }
 
+  //! Add element with node indexes defined by myNodeInds to the output,
+  //! discarding degenerate and equal elements.
+  void pushElementIndices(const int theNbNodes);
+
   //! Push triangle node without merging vertices.
   inline void pushNodeNoMerge(const int theTriNode)
   {
@@ -254,6 +294,16 @@ private:
     //! Return TRUE if merge tolerance is non-zero.
     bool HasMergeTolerance() const { return myTolerance > 0.0f; }
 
+    //! Copy merge parameters from another map.
+    void CopyParameters(const MergedNodesMap& theOther)
+    {
+      myTolerance       = theOther.myTolerance;
+      myInvTol          = theOther.myInvTol;
+      myAngle           = theOther.myAngle;
+      myAngleCos        = theOther.myAngleCos;
+      myToMergeOpposite = theOther.myToMergeOpposite;
+    }
+
     //! Bind node to the map or find existing one.
     //! @param theIndex [in,out] index of new key to add, or index of existing key, if already bound
     //! @param[out] theIsOpposite  flag indicating that existing (already bound) node has opposite
@@ -29,7 +29,8 @@ IMPLEMENT_STANDARD_RTTIEXT(Poly_Triangulation, Standard_Transient)
 Poly_Triangulation::Poly_Triangulation()
     : myCachedMinMax(nullptr),
       myDeflection(0),
-      myPurpose(Poly_MeshPurpose_NONE)
+      myPurpose(Poly_MeshPurpose_NONE),
+      myIsCompact(false)
 {
   //
 }
@@ -44,7 +45,8 @@ Poly_Triangulation::Poly_Triangulation(const int  theNbNodes,
       myDeflection(0),
       myNodes(theNbNodes),
       myTriangles(1, theNbTriangles),
-      myPurpose(Poly_MeshPurpose_NONE)
+      myPurpose(Poly_MeshPurpose_NONE),
+      myIsCompact(false)
 {
   if (theHasUVNodes)
   {
@@ -64,7 +66,8 @@ Poly_Triangulation::Poly_Triangulation(const NCollection_Array1<gp_Pnt>&
       myDeflection(0),
       myNodes(theNodes.Length()),
       myTriangles(1, theTriangles.Length()),
-      myPurpose(Poly_MeshPurpose_NONE)
+      myPurpose(Poly_MeshPurpose_NONE),
+      myIsCompact(false)
 {
   const Poly_ArrayOfNodes aNodeWrapper(theNodes.First(), theNodes.Length());
   myNodes     = aNodeWrapper;
@@ -81,7 +84,8 @@ Poly_Triangulation::Poly_Triangulation(const NCollection_Array1<gp_Pnt>&
       myNodes(theNodes.Length()),
       myTriangles(1, theTriangles.Length()),
       myUVNodes(theNodes.Length()),
-      myPurpose(Poly_MeshPurpose_NONE)
+      myPurpose(Poly_MeshPurpose_NONE),
+      myIsCompact(false)
 {
   const Poly_ArrayOfNodes aNodeWrapper(theNodes.First(), theNodes.Length());
   myNodes     = aNodeWrapper;
@@ -113,7 +117,10 @@ Poly_Triangulation::Poly_Triangulation(const occ::handle<Poly_Triangulation>& th
       myTriangles(theTriangulation->myTriangles),
       myUVNodes(theTriangulation->myUVNodes),
       myNormals(theTriangulation->myNormals),
-      myPurpose(theTriangulation->myPurpose)
+      myPackedNormals(theTriangulation->myPackedNormals),
+      myNodesOrigin(theTriangulation->myNodesOrigin),
+      myPurpose(theTriangulation->myPurpose),
+      myIsCompact(theTriangulation->myIsCompact)
 {
   SetCachedMinMax(theTriangulation->CachedMinMax());
 }
@@ -135,6 +142,8 @@ void Poly_Triangulation::Clear()
   }
   RemoveUVNodes();
   RemoveNormals();
+  myNodesOrigin = gp_XYZ();
+  myIsCompact   = false;
 }
 
 //=================================================================================================
@@ -158,6 +167,11 @@ void Poly_Triangulation::RemoveNormals()
     NCollection_Array1<NCollection_Vec3<float>> anEmpty;
     myNormals.Move(anEmpty);
   }
+  if (!myPackedNormals.IsEmpty())
+  {
+    NCollection_Array1<NCollection_Vec2<int16_t>> anEmpty;
+    myPackedNormals.Move(anEmpty);
+  }
 }
 
 //=================================================================================================
@@ -169,7 +183,7 @@ occ::handle<NCollection_HArray1<gp_Pnt>> Poly_Triangulation::MapNodeArray() cons
     return occ::handle<NCollection_HArray1<gp_Pnt>>();
   }
 
-  if (myNodes.IsDoublePrecision())
+  if (myNodes.IsDoublePrecision() && myNodesOrigin.IsEqual(gp_XYZ(), 0.0))
   {
     // wrap array
     const gp_Pnt*                            aPntArr  = &myNodes.First<gp_Pnt>();
@@ -183,8 +197,7 @@ occ::handle<NCollection_HArray1<gp_Pnt>> Poly_Triangulation::MapNodeArray() cons
   occ::handle<NCollection_HArray1<gp_Pnt>> anArray = new NCollection_HArray1<gp_Pnt>(1, NbNodes());
   for (int aNodeIter = 0; aNodeIter < NbNodes(); ++aNodeIter)
   {
-    const gp_Pnt aPnt = myNodes.Value(aNodeIter);
-    anArray->SetValue(aNodeIter + 1, aPnt);
+    anArray->SetValue(aNodeIter + 1, Node(aNodeIter + 1));
   }
   return anArray;
 }
@@ -239,11 +252,27 @@ occ::handle<NCollection_HArray1<gp_Pnt2d>> Poly_Triangulation::MapUVNodeArray()
 
 occ::handle<NCollection_HArray1<float>> Poly_Triangulation::MapNormalArray() const
 {
-  if (myNormals.IsEmpty())
+  if (!HasNormals())
   {
     return occ::handle<NCollection_HArray1<float>>();
   }
 
+  if (!myPackedNormals.IsEmpty())
+  {
+    // deep copy
+    occ::handle<NCollection_HArray1<float>> anArray =
+      new NCollection_HArray1<float>(1, 3 * NbNodes());
+    NCollection_Vec3<float> aNorm;
+    for (int aNodeIter = 1; aNodeIter <= NbNodes(); ++aNodeIter)
+    {
+      Normal(aNodeIter, aNorm);
+      anArray->SetValue(3 * aNodeIter - 2, aNorm.x());
+      anArray->SetValue(3 * aNodeIter - 1, aNorm.y());
+      anArray->SetValue(3 * aNodeIter, aNorm.z());
+    }
+    return anArray;
+  }
+
   occ::handle<NCollection_HArray1<float>> anHArray = new NCollection_HArray1<float>();
   NCollection_Array1<float>               anArray(*myNormals.First().GetData(), 1, 3 * NbNodes());
   anHArray->Move(anArray);
@@ -292,6 +321,10 @@ void Poly_Triangulation::ResizeNodes(int theNbNodes, bool theToCopyOld)
   {
     myNormals.Resize(0, theNbNodes - 1, theToCopyOld);
   }
+  if (!myPackedNormals.IsEmpty())
+  {
+    myPackedNormals.Resize(0, theNbNodes - 1, theToCopyOld);
+  }
 }
 
 //=================================================================================================
@@ -315,6 +348,14 @@ void Poly_Triangulation::AddUVNodes()
 
 void Poly_Triangulation::AddNormals()
 {
+  if (!myPackedNormals.IsEmpty())
+  {
+    if (myPackedNormals.Size() != myNodes.Size())
+    {
+      myPackedNormals.Resize(0, myNodes.Size() - 1, false);
+    }
+    return;
+  }
   if (myNormals.IsEmpty() || myNormals.Size() != myNodes.Size())
   {
     myNormals.Resize(0, myNodes.Size() - 1, false);
@@ -334,8 +375,11 @@ void Poly_Triangulation::DumpJson(Standard_OStream& theOStream, int) const
     OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, myUVNodes.Size())
   if (!myNormals.IsEmpty())
     OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, myNormals.Size())
+  if (!myPackedNormals.IsEmpty())
+    OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, myPackedNormals.Size())
   OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, myTriangles.Size())
   OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, myPurpose)
+  OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, myIsCompact)
 }
 
 //=================================================================================================
@@ -408,14 +452,14 @@ Bnd_Box Poly_Triangulation::computeBoundingBox(const gp_Trsf& theTrsf) const
   {
     for (int aNodeIdx = 0; aNodeIdx < NbNodes(); aNodeIdx++)
     {
-      aBox.Add(myNodes.Value(aNodeIdx));
+      aBox.Add(Node(aNodeIdx + 1));
     }
   }
   else
   {
     for (int aNodeIdx = 0; aNodeIdx < NbNodes(); aNodeIdx++)
     {
-      aBox.Add(myNodes.Value(aNodeIdx).Transformed(theTrsf));
+      aBox.Add(Node(aNodeIdx + 1).Transformed(theTrsf));
     }
   }
   return aBox;
@@ -425,6 +469,14 @@ Bnd_Box Poly_Triangulation::computeBoundingBox(const gp_Trsf& theTrsf) const
 
 void Poly_Triangulation::ComputeNormals()
 {
+  // normals are accumulated in single precision and quantized afterwards
+  const bool toQuantize = !myPackedNormals.IsEmpty();
+  if (toQuantize)
+  {
+    NCollection_Array1<NCollection_Vec2<int16_t>> anEmpty;
+    myPackedNormals.Move(anEmpty);
+  }
+
   // zero values
   AddNormals();
   myNormals.Init(NCollection_Vec3<float>(0.0f));
@@ -457,6 +509,54 @@ void Poly_Triangulation::ComputeNormals()
     const float              aMod    = aNorm3f.Modulus();
     aNorm3f = aMod == 0.0f ? NCollection_Vec3<float>(0.0f, 0.0f, 1.0f) : (aNorm3f / aMod);
   }
+
+  if (toQuantize)
+  {
+    quantizeNormals();
+  }
+}
+
+//=================================================================================================
+
+void Poly_Triangulation::quantizeNormals()
+{
+  NCollection_Array1<NCollection_Vec2<int16_t>> aPacked(0, myNormals.Size() - 1);
+  for (int aNodeIter = 0; aNodeIter < myNormals.Size(); ++aNodeIter)
+  {
+    aPacked.SetValue(aNodeIter, packNormal(myNormals.Value(aNodeIter)));
+  }
+
+  NCollection_Array1<NCollection_Vec3<float>> anEmpty;
+  myNormals.Move(anEmpty);
+  myPackedNormals.Move(aPacked);
+}
+
+//=================================================================================================
+
+void Poly_Triangulation::Compact(const bool theToQuantizeNormals)
+{
+  RemoveUVNodes();
+  if (!myNodes.IsEmpty() && !myIsCompact)
+  {
+    Bnd_Box aBox = computeBoundingBox(gp_Trsf());
+    aBox.SetGap(0.0);
+    const gp_XYZ anOrigin = (aBox.CornerMin().XYZ() + aBox.CornerMax().XYZ()) * 0.5;
+
+    Poly_ArrayOfNodes aNodes;
+    aNodes.SetDoublePrecision(false);
+    aNodes.Resize(myNodes.Size(), false);
+    for (int aNodeIter = 0; aNodeIter < myNodes.Size(); ++aNodeIter)
+    {
+      aNodes.SetValue(aNodeIter, gp_Pnt(Node(aNodeIter + 1).XYZ() - anOrigin));
+    }
+    myNodes.Move(aNodes);
+    myNodesOrigin = anOrigin;
+  }
+  if (theToQuantizeNormals && !myNormals.IsEmpty())
+  {
+    quantizeNormals();
+  }
+  myIsCompact = true;
 }
 
 //=================================================================================================
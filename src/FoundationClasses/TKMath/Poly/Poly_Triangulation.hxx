@@ -26,8 +26,12 @@
 #include <Poly_MeshPurpose.hxx>
 #include <gp_Pnt.hxx>
 #include <gp_Pnt2d.hxx>
+#include <NCollection_Vec2.hxx>
 #include <Standard_ShortReal.hxx>
 
+#include <cmath>
+#include <cstdint>
+
 class OSD_FileSystem;
 class Poly_Triangulation;
 class Poly_TriangulationParameters;
@@ -53,6 +57,10 @@ class Poly_TriangulationParameters;
 //! - An optional deflection, which maximizes the distance from a point on the surface to the
 //! corresponding point on its approximate triangulation.
 //!
+//! Triangulation used only for display can be converted into compact storage by Compact(),
+//! keeping nodes in single precision relative to the origin of the triangulation and quantized
+//! normals, and dropping UV nodes. Node() and Normal() hide the storage from the caller.
+//!
 //! In many cases, algorithms do not need to work with the exact representation of a surface.
 //! A triangular representation induces simpler and more robust adjusting, faster performances, and
 //! the results are as good.
@@ -134,17 +142,23 @@ public:
   bool HasUVNodes() const { return !myUVNodes.IsEmpty(); }
 
   //! Returns true if nodal normals are defined.
-  bool HasNormals() const { return !myNormals.IsEmpty(); }
+  bool HasNormals() const { return !myNormals.IsEmpty() || !myPackedNormals.IsEmpty(); }
 
   //! Returns a node at the given index.
   //! @param[in] theIndex node index within [1, NbNodes()] range
   //! @return 3D point coordinates
-  gp_Pnt Node(int theIndex) const { return myNodes.Value(theIndex - 1); }
+  gp_Pnt Node(int theIndex) const
+  {
+    return gp_Pnt(myNodes.Value(theIndex - 1).XYZ() + myNodesOrigin);
+  }
 
   //! Sets a node coordinates.
   //! @param[in] theIndex node index within [1, NbNodes()] range
   //! @param[in] thePnt   3D point coordinates
-  void SetNode(int theIndex, const gp_Pnt& thePnt) { myNodes.SetValue(theIndex - 1, thePnt); }
+  void SetNode(int theIndex, const gp_Pnt& thePnt)
+  {
+    myNodes.SetValue(theIndex - 1, gp_Pnt(thePnt.XYZ() - myNodesOrigin));
+  }
 
   //! Returns UV-node at the given index.
   //! @param[in] theIndex node index within [1, NbNodes()] range
@@ -175,7 +189,8 @@ public:
   //! @return normalized 3D vector defining a surface normal
   gp_Dir Normal(int theIndex) const
   {
-    const NCollection_Vec3<float>& aNorm = myNormals.Value(theIndex - 1);
+    NCollection_Vec3<float> aNorm;
+    Normal(theIndex, aNorm);
     return gp_Dir(aNorm.x(), aNorm.y(), aNorm.z());
   }
 
@@ -184,7 +199,8 @@ public:
   //! @param[out] theVec3  3D vector defining a surface normal
   void Normal(int theIndex, NCollection_Vec3<float>& theVec3) const
   {
-    theVec3 = myNormals.Value(theIndex - 1);
+    theVec3 = myPackedNormals.IsEmpty() ? myNormals.Value(theIndex - 1)
+                                        : unpackNormal(myPackedNormals.Value(theIndex - 1));
   }
 
   //! Changes normal at the given index.
@@ -192,7 +208,14 @@ public:
   //! @param[in] theVec3  normalized 3D vector defining a surface normal
   void SetNormal(const int theIndex, const NCollection_Vec3<float>& theNormal)
   {
-    myNormals.SetValue(theIndex - 1, theNormal);
+    if (myPackedNormals.IsEmpty())
+    {
+      myNormals.SetValue(theIndex - 1, theNormal);
+    }
+    else
+    {
+      myPackedNormals.SetValue(theIndex - 1, packNormal(theNormal));
+    }
   }
 
   //! Changes normal at the given index.
@@ -284,6 +307,25 @@ public:
   //! Compute smooth normals by averaging triangle normals.
   Standard_EXPORT void ComputeNormals();
 
+public: //! @name compact storage
+  //! Returns TRUE if triangulation has been converted into compact storage by Compact().
+  bool IsCompact() const { return myIsCompact; }
+
+  //! Returns origin of nodes; nodes are stored relative to it within compact storage.
+  const gp_XYZ& NodesOrigin() const { return myNodesOrigin; }
+
+  //! Returns TRUE if normals are stored quantized (two 16-bit components per normal).
+  bool HasQuantizedNormals() const { return !myPackedNormals.IsEmpty(); }
+
+  //! Converts triangulation into compact storage intended for display-only usage:
+  //! - nodes are stored in single precision relative to the center of their bounding box;
+  //! - normals, if defined, are quantized using octahedral encoding within 16-bit components;
+  //! - UV nodes are removed.
+  //! Memory per node is reduced from 52 to 16 bytes for triangulation with UV nodes and normals.
+  //! Nodes and normals remain accessible through Node()/SetNode() and Normal()/SetNormal().
+  //! @param[in] theToQuantizeNormals  quantize normals or keep them in single precision
+  Standard_EXPORT void Compact(const bool theToQuantizeNormals = true);
+
 public:
   //! Returns the table of 3D points for read-only access or NULL if nodes array is undefined.
   //! Poly_Triangulation::Node() should be used instead when possible.
@@ -310,7 +352,7 @@ public:
   //! Triangle()/SetTriangle() should be used instead in portable code.
   NCollection_Array1<Poly_Triangle>& InternalTriangles() { return myTriangles; }
 
-  //! Returns an internal array of nodes.
+  //! Returns an internal array of nodes defined relative to NodesOrigin().
   //! Node()/SetNode() should be used instead in portable code.
   Poly_ArrayOfNodes& InternalNodes() { return myNodes; }
 
@@ -318,7 +360,7 @@ public:
   //! UBNode()/SetUVNode() should be used instead in portable code.
   Poly_ArrayOfUVNodes& InternalUVNodes() { return myUVNodes; }
 
-  //! Return an internal array of normals.
+  //! Return an internal array of normals, empty if normals are quantized.
   //! Normal()/SetNormal() should be used instead in portable code.
   NCollection_Array1<NCollection_Vec3<float>>& InternalNormals() { return myNormals; }
 
@@ -385,14 +427,56 @@ protected:
   //! @param[in] theTrsf  optional transformation.
   Standard_EXPORT virtual Bnd_Box computeBoundingBox(const gp_Trsf& theTrsf) const;
 
+  //! Replaces single precision normals by quantized ones.
+  Standard_EXPORT void quantizeNormals();
+
+  //! Packs normalized vector into two 16-bit components using octahedral encoding.
+  static NCollection_Vec2<int16_t> packNormal(const NCollection_Vec3<float>& theNormal)
+  {
+    const float aSum = std::abs(theNormal.x()) + std::abs(theNormal.y()) + std::abs(theNormal.z());
+    if (aSum <= 0.0f)
+    {
+      return NCollection_Vec2<int16_t>(0, 0);
+    }
+
+    float anU = theNormal.x() / aSum;
+    float aV  = theNormal.y() / aSum;
+    if (theNormal.z() < 0.0f)
+    {
+      const float anOldU = anU;
+      anU                = (1.0f - std::abs(aV)) * (anOldU >= 0.0f ? 1.0f : -1.0f);
+      aV                 = (1.0f - std::abs(anOldU)) * (aV >= 0.0f ? 1.0f : -1.0f);
+    }
+    return NCollection_Vec2<int16_t>(int16_t(std::lround(anU * 32767.0f)),
+                                     int16_t(std::lround(aV * 32767.0f)));
+  }
+
+  //! Unpacks vector encoded by packNormal().
+  static NCollection_Vec3<float> unpackNormal(const NCollection_Vec2<int16_t>& thePacked)
+  {
+    float       anU = float(thePacked.x()) / 32767.0f;
+    float       aV  = float(thePacked.y()) / 32767.0f;
+    const float aZ  = 1.0f - std::abs(anU) - std::abs(aV);
+    if (aZ < 0.0f)
+    {
+      const float anOldU = anU;
+      anU                = (1.0f - std::abs(aV)) * (anOldU >= 0.0f ? 1.0f : -1.0f);
+      aV                 = (1.0f - std::abs(anOldU)) * (aV >= 0.0f ? 1.0f : -1.0f);
+    }
+    return NCollection_Vec3<float>(anU, aV, aZ).Normalized();
+  }
+
 protected:
-  Bnd_Box*                                    myCachedMinMax;
-  double                                      myDeflection;
-  Poly_ArrayOfNodes                           myNodes;
-  NCollection_Array1<Poly_Triangle>           myTriangles;
-  Poly_ArrayOfUVNodes                         myUVNodes;
-  NCollection_Array1<NCollection_Vec3<float>> myNormals;
-  Poly_MeshPurpose                            myPurpose;
+  Bnd_Box*                                      myCachedMinMax;
+  double                                        myDeflection;
+  Poly_ArrayOfNodes                             myNodes;
+  NCollection_Array1<Poly_Triangle>             myTriangles;
+  Poly_ArrayOfUVNodes                           myUVNodes;
+  NCollection_Array1<NCollection_Vec3<float>>   myNormals;
+  NCollection_Array1<NCollection_Vec2<int16_t>> myPackedNormals; //!< quantized normals
+  gp_XYZ                                        myNodesOrigin;   //!< origin of nodes
+  Poly_MeshPurpose                              myPurpose;
+  bool                                          myIsCompact;
 
   occ::handle<Poly_TriangulationParameters> myParams;
 };
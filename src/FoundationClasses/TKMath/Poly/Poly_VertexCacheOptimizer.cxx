@@ -0,0 +1,521 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <Poly_VertexCacheOptimizer.hxx>
+
+#include <gp_XYZ.hxx>
+#include <NCollection_Vec3.hxx>
+#include <Poly_PolygonOnTriangulation.hxx>
+#include <Poly_Triangulation.hxx>
+
+#include <algorithm>
+
+namespace
+{
+//! FIFO vertex cache simulated by timestamps of cache misses:
+//! node is within the cache if it has been missed not earlier than theCacheSize misses ago.
+class FifoCacheSimulator
+{
+public:
+  //! Constructor.
+  FifoCacheSimulator(const int theNbNodes, const int theCacheSize)
+      : myStamps(0, theNbNodes - 1),
+        myCacheSize(theCacheSize),
+        myTime(0),
+        myStartTime(0)
+  {
+    myStamps.Init(-1);
+  }
+
+  //! Flush the cache.
+  void Flush() { myStartTime = myTime; }
+
+  //! Fetch the node (from 0) and return TRUE on cache miss.
+  bool Fetch(const int theNode)
+  {
+    const int aStamp = myStamps.Value(theNode);
+    if (aStamp >= myStartTime && myTime - aStamp <= myCacheSize)
+    {
+      return false;
+    }
+    myStamps.SetValue(theNode, myTime++);
+    return true;
+  }
+
+private:
+  NCollection_Array1<int> myStamps;
+  int                     myCacheSize;
+  int                     myTime;
+  int                     myStartTime;
+};
+
+//! Cluster of triangles with its sort key.
+struct TriCluster
+{
+  int    First;  //!< first triangle within order
+  int    Last;   //!< last triangle within order (exclusive)
+  double SortKey; //!< projection of cluster centroid onto cluster normal
+
+  bool operator<(const TriCluster& theOther) const { return SortKey > theOther.SortKey; }
+};
+} // namespace
+
+//=================================================================================================
+
+double Poly_VertexCacheOptimizer::AverageCacheMissRatio(const Poly_Triangulation& theTris,
+                                                        const int                 theCacheSize)
+{
+  if (theTris.NbTriangles() < 1)
+  {
+    return 0.0;
+  }
+
+  FifoCacheSimulator aCache(theTris.NbNodes(), theCacheSize);
+  int                aNbMisses = 0;
+  for (int aTriIter = 1; aTriIter <= theTris.NbTriangles(); ++aTriIter)
+  {
+    int aNodes[3];
+    theTris.Triangle(aTriIter).Get(aNodes[0], aNodes[1], aNodes[2]);
+    for (int aNodeIter = 0; aNodeIter < 3; ++aNodeIter)
+    {
+      if (aNodes[aNodeIter] >= 1 && aNodes[aNodeIter] <= theTris.NbNodes()
+          && aCache.Fetch(aNodes[aNodeIter] - 1))
+      {
+        ++aNbMisses;
+      }
+    }
+  }
+  return double(aNbMisses) / double(theTris.NbTriangles());
+}
+
+//=================================================================================================
+
+Poly_VertexCacheOptimizer::Poly_VertexCacheOptimizer(const int    theCacheSize,
+                                                     const double theOverdrawThreshold)
+    : myNbClusters(0),
+      myCacheSize(theCacheSize > 3 ? theCacheSize : 3),
+      myOverdrawThreshold(theOverdrawThreshold)
+{
+}
+
+//=================================================================================================
+
+bool Poly_VertexCacheOptimizer::Perform(const Poly_Triangulation& theTris)
+{
+  myNbClusters       = 0;
+  const int aNbTris  = theTris.NbTriangles();
+  const int aNbNodes = theTris.NbNodes();
+  if (aNbTris < 1 || aNbNodes < 1)
+  {
+    myTriOrder  = NCollection_Array1<int>();
+    myNodeOrder = NCollection_Array1<int>();
+    myNodeMap   = NCollection_Array1<int>();
+    return false;
+  }
+
+  // triangle nodes numbered from 0
+  NCollection_Array1<int> anIndices(0, 3 * aNbTris - 1);
+  for (int aTriIter = 0; aTriIter < aNbTris; ++aTriIter)
+  {
+    int aNodes[3];
+    theTris.Triangle(aTriIter + 1).Get(aNodes[0], aNodes[1], aNodes[2]);
+    for (int aNodeIter = 0; aNodeIter < 3; ++aNodeIter)
+    {
+      if (aNodes[aNodeIter] < 1 || aNodes[aNodeIter] > aNbNodes)
+      {
+        return false;
+      }
+      anIndices.SetValue(3 * aTriIter + aNodeIter, aNodes[aNodeIter] - 1);
+    }
+  }
+
+  myTriOrder.Resize(1, aNbTris, false);
+  myNodeOrder.Resize(1, aNbNodes, false);
+  myNodeMap.Resize(1, aNbNodes, false);
+
+  NCollection_Array1<int> aClusters(0, aNbTris);
+  optimizeVertexCache(anIndices, aClusters);
+  optimizeOverdraw(theTris, anIndices, aClusters);
+  optimizeVertexFetch(anIndices);
+  return true;
+}
+
+//=================================================================================================
+
+void Poly_VertexCacheOptimizer::optimizeVertexCache(const NCollection_Array1<int>& theIndices,
+                                                    NCollection_Array1<int>&       theClusters)
+{
+  const int aNbIndices = theIndices.Length();
+  const int aNbTris    = aNbIndices / 3;
+  const int aNbNodes   = myNodeMap.Length();
+
+  // number of not yet emitted triangles of each node
+  NCollection_Array1<int> aLive(0, aNbNodes - 1);
+  aLive.Init(0);
+  for (int anIndexIter = 0; anIndexIter < aNbIndices; ++anIndexIter)
+  {
+    ++aLive.ChangeValue(theIndices.Value(anIndexIter));
+  }
+
+  // triangles adjacent to each node
+  NCollection_Array1<int> anAdjOffsets(0, aNbNodes);
+  anAdjOffsets.SetValue(0, 0);
+  for (int aNodeIter = 0; aNodeIter < aNbNodes; ++aNodeIter)
+  {
+    anAdjOffsets.SetValue(aNodeIter + 1, anAdjOffsets.Value(aNodeIter) + aLive.Value(aNodeIter));
+  }
+  NCollection_Array1<int> anAdjTris(0, aNbIndices - 1);
+  {
+    NCollection_Array1<int> anAdjCursors(0, aNbNodes - 1);
+    for (int aNodeIter = 0; aNodeIter < aNbNodes; ++aNodeIter)
+    {
+      anAdjCursors.SetValue(aNodeIter, anAdjOffsets.Value(aNodeIter));
+    }
+    for (int anIndexIter = 0; anIndexIter < aNbIndices; ++anIndexIter)
+    {
+      anAdjTris.SetValue(anAdjCursors.ChangeValue(theIndices.Value(anIndexIter))++,
+                         anIndexIter / 3);
+    }
+  }
+
+  NCollection_Array1<int>  aCacheTimes(0, aNbNodes - 1);
+  NCollection_Array1<bool> anEmitted(0, aNbTris - 1);
+  NCollection_Array1<int>  aDeadEnds(0, aNbIndices - 1);
+  NCollection_Array1<int>  aCandidates(0, aNbIndices - 1);
+  aCacheTimes.Init(0);
+  anEmitted.Init(false);
+
+  int aTime       = myCacheSize + 1;
+  int aNbDeadEnds = 0;
+  int aNbEmitted  = 0;
+  int aNodeCursor = 0;
+  int aFan        = -1;
+  for (; aNodeCursor < aNbNodes && aFan == -1; ++aNodeCursor)
+  {
+    if (aLive.Value(aNodeCursor) > 0)
+    {
+      aFan = aNodeCursor;
+    }
+  }
+
+  myNbClusters = 0;
+  theClusters.SetValue(myNbClusters++, 0);
+  while (aFan >= 0)
+  {
+    // emit all remaining triangles of the fan
+    int aNbCandidates = 0;
+    for (int anAdjIter = anAdjOffsets.Value(aFan); anAdjIter < anAdjOffsets.Value(aFan + 1);
+         ++anAdjIter)
+    {
+      const int aTri = anAdjTris.Value(anAdjIter);
+      if (anEmitted.Value(aTri))
+      {
+        continue;
+      }
+
+      anEmitted.SetValue(aTri, true);
+      myTriOrder.SetValue(++aNbEmitted, aTri + 1);
+      for (int aNodeIter = 0; aNodeIter < 3; ++aNodeIter)
+      {
+        const int aNode = theIndices.Value(3 * aTri + aNodeIter);
+        aDeadEnds.SetValue(aNbDeadEnds++, aNode);
+        aCandidates.SetValue(aNbCandidates++, aNode);
+        --aLive.ChangeValue(aNode);
+        if (aTime - aCacheTimes.Value(aNode) > myCacheSize)
+        {
+          aCacheTimes.SetValue(aNode, aTime++);
+        }
+      }
+    }
+
+    // next fan is the node which stays in cache after emitting its triangles, oldest first
+    int aNextFan   = -1;
+    int aBestScore = -1;
+    for (int aCandIter = 0; aCandIter < aNbCandidates; ++aCandIter)
+    {
+      const int aNode = aCandidates.Value(aCandIter);
+      if (aLive.Value(aNode) <= 0)
+      {
+        continue;
+      }
+
+      int aScore = 0;
+      if (aTime - aCacheTimes.Value(aNode) + 2 * aLive.Value(aNode) <= myCacheSize)
+      {
+        aScore = aTime - aCacheTimes.Value(aNode);
+      }
+      if (aScore > aBestScore)
+      {
+        aBestScore = aScore;
+        aNextFan   = aNode;
+      }
+    }
+    if (aNextFan != -1)
+    {
+      aFan = aNextFan;
+      continue;
+    }
+
+    // dead end - take the most recently referenced node with remaining triangles,
+    // or the next one in input order, starting a new cluster
+    while (aNbDeadEnds > 0 && aNextFan == -1)
+    {
+      const int aNode = aDeadEnds.Value(--aNbDeadEnds);
+      if (aLive.Value(aNode) > 0)
+      {
+        aNextFan = aNode;
+      }
+    }
+    for (; aNodeCursor < aNbNodes && aNextFan == -1; ++aNodeCursor)
+    {
+      if (aLive.Value(aNodeCursor) > 0)
+      {
+        aNextFan = aNodeCursor;
+      }
+    }
+    if (aNextFan != -1)
+    {
+      theClusters.SetValue(myNbClusters++, aNbEmitted);
+    }
+    aFan = aNextFan;
+  }
+  theClusters.SetValue(myNbClusters, aNbTris);
+}
+
+//=================================================================================================
+
+void Poly_VertexCacheOptimizer::optimizeOverdraw(const Poly_Triangulation&      theTris,
+                                                 const NCollection_Array1<int>& theIndices,
+                                                 NCollection_Array1<int>&       theClusters)
+{
+  const int aNbTris = myTriOrder.Length();
+  if (myOverdrawThreshold <= 0.0 || myNbClusters < 1)
+  {
+    return;
+  }
+
+  // ACMR of vertex cache order
+  int aNbMissesTotal = 0;
+  {
+    FifoCacheSimulator aCache(myNodeMap.Length(), myCacheSize);
+    for (int aTriIter = 1; aTriIter <= aNbTris; ++aTriIter)
+    {
+      const int aTri = myTriOrder.Value(aTriIter) - 1;
+      for (int aNodeIter = 0; aNodeIter < 3; ++aNodeIter)
+      {
+        aNbMissesTotal += aCache.Fetch(theIndices.Value(3 * aTri + aNodeIter)) ? 1 : 0;
+      }
+    }
+  }
+  const double aMaxAcmr = myOverdrawThreshold * double(aNbMissesTotal) / double(aNbTris);
+
+  // split clusters at positions where cache-cold cluster reaches the threshold
+  NCollection_Array1<TriCluster> aClusters(0, aNbTris - 1);
+  int                            aNbClusters = 0;
+  FifoCacheSimulator             aCache(myNodeMap.Length(), myCacheSize);
+  for (int aHardIter = 0; aHardIter < myNbClusters; ++aHardIter)
+  {
+    const int aLast = theClusters.Value(aHardIter + 1);
+    int       aFirst = theClusters.Value(aHardIter);
+    int       aNbMisses = 0;
+    aCache.Flush();
+    for (int aPos = aFirst; aPos < aLast; ++aPos)
+    {
+      const int aTri = myTriOrder.Value(aPos + 1) - 1;
+      for (int aNodeIter = 0; aNodeIter < 3; ++aNodeIter)
+      {
+        aNbMisses += aCache.Fetch(theIndices.Value(3 * aTri + aNodeIter)) ? 1 : 0;
+      }
+      if (aPos + 1 < aLast && double(aNbMisses) < aMaxAcmr * double(aPos + 1 - aFirst))
+      {
+        TriCluster& aCluster = aClusters.ChangeValue(aNbClusters++);
+        aCluster.First       = aFirst;
+        aCluster.Last        = aPos + 1;
+        aFirst               = aPos + 1;
+        aNbMisses            = 0;
+        aCache.Flush();
+      }
+    }
+    TriCluster& aCluster = aClusters.ChangeValue(aNbClusters++);
+    aCluster.First       = aFirst;
+    aCluster.Last        = aLast;
+  }
+  myNbClusters = aNbClusters;
+  if (aNbClusters < 2)
+  {
+    return;
+  }
+
+  // area-weighted centroids and normals of clusters
+  NCollection_Array1<gp_XYZ> aCentroids(0, aNbClusters - 1);
+  NCollection_Array1<gp_XYZ> aNormals(0, aNbClusters - 1);
+  gp_XYZ                     aMeshCentroid;
+  double                     aMeshArea = 0.0;
+  for (int aClusterIter = 0; aClusterIter < aNbClusters; ++aClusterIter)
+  {
+    const TriCluster& aCluster = aClusters.Value(aClusterIter);
+    gp_XYZ            aCentroid, aNormal;
+    double            anArea = 0.0;
+    for (int aPos = aCluster.First; aPos < aCluster.Last; ++aPos)
+    {
+      const int    aTri   = myTriOrder.Value(aPos + 1) - 1;
+      const gp_XYZ aNode0 = theTris.Node(theIndices.Value(3 * aTri + 0) + 1).XYZ();
+      const gp_XYZ aNode1 = theTris.Node(theIndices.Value(3 * aTri + 1) + 1).XYZ();
+      const gp_XYZ aNode2 = theTris.Node(theIndices.Value(3 * aTri + 2) + 1).XYZ();
+      const gp_XYZ aCross = (aNode1 - aNode0).Crossed(aNode2 - aNode0);
+      const double aTriArea = aCross.Modulus();
+      aCentroid += (aNode0 + aNode1 + aNode2) * (aTriArea / 3.0);
+      aNormal += aCross;
+      anArea += aTriArea;
+    }
+    aMeshCentroid += aCentroid;
+    aMeshArea += anArea;
+    aCentroids.SetValue(aClusterIter, anArea > 0.0 ? aCentroid / anArea : aCentroid);
+    aNormals.SetValue(aClusterIter, aNormal);
+  }
+  if (aMeshArea <= 0.0)
+  {
+    return;
+  }
+
+  // render outer clusters (facing away from mesh centroid) first
+  aMeshCentroid /= aMeshArea;
+  for (int aClusterIter = 0; aClusterIter < aNbClusters; ++aClusterIter)
+  {
+    const gp_XYZ& aNormal    = aNormals.Value(aClusterIter);
+    const double  aNormalLen = aNormal.Modulus();
+    aClusters.ChangeValue(aClusterIter).SortKey =
+      aNormalLen > 0.0
+        ? (aCentroids.Value(aClusterIter) - aMeshCentroid).Dot(aNormal) / aNormalLen
+        : 0.0;
+  }
+  std::stable_sort(&aClusters.ChangeFirst(), &aClusters.ChangeFirst() + aNbClusters);
+
+  const NCollection_Array1<int> aCacheOrder(myTriOrder);
+  int                           aNbEmitted = 0;
+  for (int aClusterIter = 0; aClusterIter < aNbClusters; ++aClusterIter)
+  {
+    const TriCluster& aCluster = aClusters.Value(aClusterIter);
+    for (int aPos = aCluster.First; aPos < aCluster.Last; ++aPos)
+    {
+      myTriOrder.SetValue(++aNbEmitted, aCacheOrder.Value(aPos + 1));
+    }
+  }
+}
+
+//=================================================================================================
+
+void Poly_VertexCacheOptimizer::optimizeVertexFetch(const NCollection_Array1<int>& theIndices)
+{
+  const int aNbNodes = myNodeMap.Length();
+  myNodeMap.Init(0);
+
+  int aNbUsed = 0;
+  for (int aTriIter = 1; aTriIter <= myTriOrder.Length(); ++aTriIter)
+  {
+    const int aTri = myTriOrder.Value(aTriIter) - 1;
+    for (int aNodeIter = 0; aNodeIter < 3; ++aNodeIter)
+    {
+      const int aNode = theIndices.Value(3 * aTri + aNodeIter) + 1;
+      if (myNodeMap.Value(aNode) == 0)
+      {
+        myNodeMap.SetValue(aNode, ++aNbUsed);
+        myNodeOrder.SetValue(aNbUsed, aNode);
+      }
+    }
+  }
+
+  // keep unused nodes at the end
+  for (int aNode = 1; aNode <= aNbNodes; ++aNode)
+  {
+    if (myNodeMap.Value(aNode) == 0)
+    {
+      myNodeMap.SetValue(aNode, ++aNbUsed);
+      myNodeOrder.SetValue(aNbUsed, aNode);
+    }
+  }
+}
+
+//=================================================================================================
+
+bool Poly_VertexCacheOptimizer::Apply(const occ::handle<Poly_Triangulation>& theTris) const
+{
+  if (theTris.IsNull() || myTriOrder.IsEmpty() || theTris->NbTriangles() != myTriOrder.Length()
+      || theTris->NbNodes() != myNodeOrder.Length())
+  {
+    return false;
+  }
+
+  const int aNbNodes = theTris->NbNodes();
+  {
+    NCollection_Array1<gp_Pnt> aNodes(1, aNbNodes);
+    for (int aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+    {
+      aNodes.SetValue(aNodeIter, theTris->Node(myNodeOrder.Value(aNodeIter)));
+    }
+    for (int aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+    {
+      theTris->SetNode(aNodeIter, aNodes.Value(aNodeIter));
+    }
+  }
+  if (theTris->HasUVNodes())
+  {
+    NCollection_Array1<gp_Pnt2d> aUVNodes(1, aNbNodes);
+    for (int aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+    {
+      aUVNodes.SetValue(aNodeIter, theTris->UVNode(myNodeOrder.Value(aNodeIter)));
+    }
+    for (int aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+    {
+      theTris->SetUVNode(aNodeIter, aUVNodes.Value(aNodeIter));
+    }
+  }
+  if (theTris->HasNormals())
+  {
+    NCollection_Array1<NCollection_Vec3<float>> aNormals(1, aNbNodes);
+    for (int aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+    {
+      theTris->Normal(myNodeOrder.Value(aNodeIter), aNormals.ChangeValue(aNodeIter));
+    }
+    for (int aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+    {
+      theTris->SetNormal(aNodeIter, aNormals.Value(aNodeIter));
+    }
+  }
+
+  const NCollection_Array1<Poly_Triangle> aTriangles(theTris->InternalTriangles());
+  for (int aTriIter = 1; aTriIter <= myTriOrder.Length(); ++aTriIter)
+  {
+    int aNodes[3];
+    aTriangles.Value(myTriOrder.Value(aTriIter)).Get(aNodes[0], aNodes[1], aNodes[2]);
+    theTris->SetTriangle(aTriIter,
+                         Poly_Triangle(myNodeMap.Value(aNodes[0]),
+                                       myNodeMap.Value(aNodes[1]),
+                                       myNodeMap.Value(aNodes[2])));
+  }
+  return true;
+}
+
+//=================================================================================================
+
+void Poly_VertexCacheOptimizer::Apply(Poly_PolygonOnTriangulation& thePolygon) const
+{
+  for (int aNodeIter = 1; aNodeIter <= thePolygon.NbNodes(); ++aNodeIter)
+  {
+    const int aNode = thePolygon.Node(aNodeIter);
+    if (aNode >= myNodeMap.Lower() && aNode <= myNodeMap.Upper())
+    {
+      thePolygon.SetNode(aNodeIter, myNodeMap.Value(aNode));
+    }
+  }
+}
@@ -0,0 +1,118 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _Poly_VertexCacheOptimizer_HeaderFile
+#define _Poly_VertexCacheOptimizer_HeaderFile
+
+#include <NCollection_Array1.hxx>
+#include <Standard_DefineAlloc.hxx>
+#include <Standard_Handle.hxx>
+
+class Poly_PolygonOnTriangulation;
+class Poly_Triangulation;
+
+//! Auxiliary tool reordering triangulation for rendering by GPU.
+//! Mesh generators (like Delaunay triangulation) output triangles in insertion order,
+//! which is poor for reuse of transformed vertices by post-transform vertex cache.
+//! The tool performs three passes:
+//! - triangles are reordered for vertex cache by Tipsify algorithm
+//!   (P. Sander, D. Nehab, J. Barczak "Fast Triangle Reordering for Vertex Locality and Reduced
+//!   Overdraw", 2007);
+//! - resulting clusters of triangles are sorted from outer to inner ones for early depth rejection;
+//! - nodes are renumbered in order of first use by triangles for locality of vertex fetch.
+//! The tool does not modify input triangulation until Apply() is called,
+//! so that computed order can be also used for filling external buffers.
+//! Note that renumbering of nodes invalidates polygons on triangulation referring to them,
+//! which should be also updated by Apply().
+class Poly_VertexCacheOptimizer
+{
+public:
+  DEFINE_STANDARD_ALLOC
+
+  //! Default size of simulated vertex cache.
+  static int DefaultCacheSize() { return 16; }
+
+  //! Compute average number of vertex cache misses per triangle (ACMR) of triangulation
+  //! rendered with FIFO vertex cache of specified size; ranges from 0.5 (ideal) to 3 (no reuse).
+  Standard_EXPORT static double AverageCacheMissRatio(const Poly_Triangulation& theTris,
+                                                      const int theCacheSize = DefaultCacheSize());
+
+public:
+  //! Constructor.
+  //! @param[in] theCacheSize size of simulated vertex cache
+  //! @param[in] theOverdrawThreshold ACMR threshold for splitting clusters within overdraw pass
+  //!                                 relative to ACMR of vertex cache order, or 0 to skip the pass
+  Standard_EXPORT Poly_VertexCacheOptimizer(const int    theCacheSize         = DefaultCacheSize(),
+                                            const double theOverdrawThreshold = 1.05);
+
+  //! Return size of simulated vertex cache.
+  int CacheSize() const { return myCacheSize; }
+
+  //! Set size of simulated vertex cache.
+  void SetCacheSize(const int theSize) { myCacheSize = theSize > 3 ? theSize : 3; }
+
+  //! Return ACMR threshold of clusters within overdraw pass (in 1..3 range), 0 if pass is disabled.
+  //! Greater value splits vertex cache order into more clusters, sorted more accurately for
+  //! overdraw, at the cost of extra vertex cache misses.
+  double OverdrawThreshold() const { return myOverdrawThreshold; }
+
+  //! Set ACMR threshold of clusters within overdraw pass.
+  void SetOverdrawThreshold(const double theThreshold) { myOverdrawThreshold = theThreshold; }
+
+  //! Compute new order of triangles and nodes of triangulation.
+  //! @param[in] theTris triangulation to analyze
+  //! @return FALSE if triangulation is empty
+  Standard_EXPORT bool Perform(const Poly_Triangulation& theTris);
+
+  //! Return new order of triangles (from 1): old indices of triangles at new positions.
+  const NCollection_Array1<int>& TriangleOrder() const { return myTriOrder; }
+
+  //! Return new order of nodes (from 1): old indices of nodes at new positions.
+  const NCollection_Array1<int>& NodeOrder() const { return myNodeOrder; }
+
+  //! Return new indices of nodes (from 1) at old positions.
+  const NCollection_Array1<int>& NodeMap() const { return myNodeMap; }
+
+  //! Return number of triangle clusters sorted by overdraw pass.
+  int NbClusters() const { return myNbClusters; }
+
+  //! Reorder triangles, nodes, UV nodes and normals of triangulation passed to Perform().
+  //! @return FALSE if triangulation does not match computed order
+  Standard_EXPORT bool Apply(const occ::handle<Poly_Triangulation>& theTris) const;
+
+  //! Renumber nodes of polygon on triangulation passed to Perform().
+  Standard_EXPORT void Apply(Poly_PolygonOnTriangulation& thePolygon) const;
+
+private:
+  //! Compute vertex cache order of triangles by Tipsify algorithm.
+  void optimizeVertexCache(const NCollection_Array1<int>& theIndices,
+                           NCollection_Array1<int>&       theClusters);
+
+  //! Sort clusters of triangles for reduced overdraw.
+  void optimizeOverdraw(const Poly_Triangulation&      theTris,
+                        const NCollection_Array1<int>& theIndices,
+                        NCollection_Array1<int>&       theClusters);
+
+  //! Compute order of nodes by first use.
+  void optimizeVertexFetch(const NCollection_Array1<int>& theIndices);
+
+private:
+  NCollection_Array1<int> myTriOrder;          //!< old indices of triangles at new positions
+  NCollection_Array1<int> myNodeOrder;         //!< old indices of nodes at new positions
+  NCollection_Array1<int> myNodeMap;           //!< new indices of nodes at old positions
+  int                     myNbClusters;        //!< number of clusters of overdraw pass
+  int                     myCacheSize;         //!< size of simulated vertex cache
+  double                  myOverdrawThreshold; //!< ACMR threshold of overdraw pass
+};
+
+#endif // _Poly_VertexCacheOptimizer_HeaderFile
@@ -47,6 +47,7 @@ public:
 
   friend class TopLoc_Location;
   friend class TopLoc_SListOfItemLocation;
+  friend class TopLoc_SListNodeOfItemLocation;
 
 private:
   occ::handle<TopLoc_Datum3D> myDatum;
@@ -34,11 +34,16 @@ public:
 
   TopLoc_ItemLocation& Value() const;
 
+  //! Returns the hash code of the list starting at this node,
+  //! computed once at construction from the hash code of the tail.
+  size_t HashCode() const { return myHash; }
+
   DEFINE_STANDARD_RTTIEXT(TopLoc_SListNodeOfItemLocation, Standard_Transient)
 
 private:
   TopLoc_SListOfItemLocation myTail;
   TopLoc_ItemLocation        myValue;
+  size_t                     myHash;
 };
 
 #include <TopLoc_SListNodeOfItemLocation.lxx>
@@ -14,6 +14,7 @@
 // Alternatively, this file may be used under the terms of Open CASCADE
 // commercial license or contractual agreement.
 
+#include <Standard_HashUtils.hxx>
 #include <Standard_NoSuchObject.hxx>
 #include <TopLoc_ItemLocation.hxx>
 #include <TopLoc_SListNodeOfItemLocation.hxx>
@@ -62,3 +63,10 @@ const TopLoc_SListOfItemLocation& TopLoc_SListOfItemLocation::Tail() const
   else
     return *this;
 }
+
+//=================================================================================================
+
+size_t TopLoc_SListOfItemLocation::HashCode() const
+{
+  return myNode.IsNull() ? opencascade::MurmurHash::optimalSeed<size_t>() : myNode->HashCode();
+}
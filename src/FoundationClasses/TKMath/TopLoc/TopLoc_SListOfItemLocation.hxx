@@ -115,6 +115,10 @@ public:
   //! If the iterator is empty it will stay empty. This is ToTail()
   void Next() { ToTail(); }
 
+  //! Returns the hash code of the list combining the data and powers of all its items.
+  //! The value is cached by the list nodes, so that the call does not iterate the list.
+  Standard_EXPORT size_t HashCode() const;
+
 private:
   occ::handle<TopLoc_SListNodeOfItemLocation> myNode;
 };
@@ -0,0 +1,8 @@
+# Benchmark source files for TKernel
+set(OCCT_TKernel_Benchmarks_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
+
+set(OCCT_TKernel_Benchmarks_FILES
+  NCollection_Benchmark.cxx
+  OSD_Tracer_Benchmark.cxx
+  Standard_MMgr_Benchmark.cxx
+)
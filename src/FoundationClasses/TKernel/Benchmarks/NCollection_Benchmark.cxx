@@ -0,0 +1,242 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <NCollection_DataMap.hxx>
+#include <NCollection_DynamicArray.hxx>
+#include <NCollection_FlatDataMap.hxx>
+#include <NCollection_FlatMap.hxx>
+#include <NCollection_IncAllocator.hxx>
+#include <NCollection_IndexedMap.hxx>
+#include <NCollection_Map.hxx>
+#include <NCollection_Sequence.hxx>
+#include <NCollection_Vector.hxx>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace
+{
+//! Returns the keys in pseudo-random order, the same for each run.
+std::vector<int> shuffledKeys(const int theNbKeys)
+{
+  std::vector<int> aKeys(theNbKeys);
+  for (int anIndex = 0; anIndex < theNbKeys; ++anIndex)
+  {
+    aKeys[anIndex] = anIndex * 7919;
+  }
+  std::shuffle(aKeys.begin(), aKeys.end(), std::mt19937(42));
+  return aKeys;
+}
+} // namespace
+
+static void NCollection_Vector_Append(benchmark::State& theState)
+{
+  const int aNbItems = int(theState.range(0));
+  for (auto _ : theState)
+  {
+    NCollection_Vector<double> aVector;
+    for (int anIndex = 0; anIndex < aNbItems; ++anIndex)
+    {
+      aVector.Append(anIndex);
+    }
+    benchmark::DoNotOptimize(aVector.Length());
+  }
+  theState.SetItemsProcessed(theState.iterations() * aNbItems);
+}
+BENCHMARK(NCollection_Vector_Append)->RangeMultiplier(8)->Range(1 << 10, 1 << 19);
+
+static void NCollection_DynamicArray_Append(benchmark::State& theState)
+{
+  const int aNbItems = int(theState.range(0));
+  for (auto _ : theState)
+  {
+    NCollection_DynamicArray<double> anArray;
+    for (int anIndex = 0; anIndex < aNbItems; ++anIndex)
+    {
+      anArray.Append(anIndex);
+    }
+    benchmark::DoNotOptimize(anArray.Length());
+  }
+  theState.SetItemsProcessed(theState.iterations() * aNbItems);
+}
+BENCHMARK(NCollection_DynamicArray_Append)->RangeMultiplier(8)->Range(1 << 10, 1 << 19);
+
+static void NCollection_Sequence_AppendIterate(benchmark::State& theState)
+{
+  const int aNbItems = int(theState.range(0));
+  for (auto _ : theState)
+  {
+    NCollection_Sequence<double> aSequence;
+    for (int anIndex = 0; anIndex < aNbItems; ++anIndex)
+    {
+      aSequence.Append(anIndex);
+    }
+    double aSum = 0.0;
+    for (NCollection_Sequence<double>::Iterator anIter(aSequence); anIter.More(); anIter.Next())
+    {
+      aSum += anIter.Value();
+    }
+    benchmark::DoNotOptimize(aSum);
+  }
+  theState.SetItemsProcessed(theState.iterations() * aNbItems);
+}
+BENCHMARK(NCollection_Sequence_AppendIterate)->RangeMultiplier(8)->Range(1 << 10, 1 << 19);
+
+static void NCollection_Map_Add(benchmark::State& theState)
+{
+  const std::vector<int> aKeys = shuffledKeys(int(theState.range(0)));
+  const bool             toUseIncAlloc = theState.range(1) != 0;
+  for (auto _ : theState)
+  {
+    occ::handle<NCollection_BaseAllocator> anAlloc;
+    if (toUseIncAlloc)
+    {
+      anAlloc = new NCollection_IncAllocator();
+    }
+    NCollection_Map<int> aMap(1, anAlloc);
+    for (const int aKey : aKeys)
+    {
+      aMap.Add(aKey);
+    }
+    benchmark::DoNotOptimize(aMap.Extent());
+  }
+  theState.SetItemsProcessed(theState.iterations() * int64_t(aKeys.size()));
+}
+BENCHMARK(NCollection_Map_Add)
+  ->ArgsProduct({benchmark::CreateRange(1 << 10, 1 << 19, 8), {0, 1}})
+  ->ArgNames({"keys", "inc_alloc"});
+
+static void NCollection_Map_Contains(benchmark::State& theState)
+{
+  const std::vector<int> aKeys = shuffledKeys(int(theState.range(0)));
+  NCollection_Map<int>   aMap;
+  for (size_t anIndex = 0; anIndex < aKeys.size(); anIndex += 2)
+  {
+    aMap.Add(aKeys[anIndex]);
+  }
+  for (auto _ : theState)
+  {
+    int aNbFound = 0;
+    for (const int aKey : aKeys)
+    {
+      aNbFound += aMap.Contains(aKey) ? 1 : 0;
+    }
+    benchmark::DoNotOptimize(aNbFound);
+  }
+  theState.SetItemsProcessed(theState.iterations() * int64_t(aKeys.size()));
+}
+BENCHMARK(NCollection_Map_Contains)->RangeMultiplier(8)->Range(1 << 10, 1 << 19);
+
+static void NCollection_FlatMap_Add(benchmark::State& theState)
+{
+  const std::vector<int> aKeys = shuffledKeys(int(theState.range(0)));
+  for (auto _ : theState)
+  {
+    NCollection_FlatMap<int> aMap;
+    for (const int aKey : aKeys)
+    {
+      aMap.Add(aKey);
+    }
+    benchmark::DoNotOptimize(aMap.Extent());
+  }
+  theState.SetItemsProcessed(theState.iterations() * int64_t(aKeys.size()));
+}
+BENCHMARK(NCollection_FlatMap_Add)->RangeMultiplier(8)->Range(1 << 10, 1 << 19);
+
+static void NCollection_FlatMap_Seek(benchmark::State& theState)
+{
+  const std::vector<int>   aKeys = shuffledKeys(int(theState.range(0)));
+  NCollection_FlatMap<int> aMap;
+  for (size_t anIndex = 0; anIndex < aKeys.size(); anIndex += 2)
+  {
+    aMap.Add(aKeys[anIndex]);
+  }
+  for (auto _ : theState)
+  {
+    int aNbFound = 0;
+    for (const int aKey : aKeys)
+    {
+      aNbFound += aMap.Seek(aKey) != nullptr ? 1 : 0;
+    }
+    benchmark::DoNotOptimize(aNbFound);
+  }
+  theState.SetItemsProcessed(theState.iterations() * int64_t(aKeys.size()));
+}
+BENCHMARK(NCollection_FlatMap_Seek)->RangeMultiplier(8)->Range(1 << 10, 1 << 19);
+
+static void NCollection_DataMap_BindFind(benchmark::State& theState)
+{
+  const std::vector<int> aKeys = shuffledKeys(int(theState.range(0)));
+  for (auto _ : theState)
+  {
+    NCollection_DataMap<int, double> aMap;
+    for (const int aKey : aKeys)
+    {
+      aMap.Bind(aKey, double(aKey));
+    }
+    double aSum = 0.0;
+    for (const int aKey : aKeys)
+    {
+      aSum += aMap.Find(aKey);
+    }
+    benchmark::DoNotOptimize(aSum);
+  }
+  theState.SetItemsProcessed(theState.iterations() * int64_t(aKeys.size()));
+}
+BENCHMARK(NCollection_DataMap_BindFind)->RangeMultiplier(8)->Range(1 << 10, 1 << 19);
+
+static void NCollection_FlatDataMap_BindFind(benchmark::State& theState)
+{
+  const std::vector<int> aKeys = shuffledKeys(int(theState.range(0)));
+  for (auto _ : theState)
+  {
+    NCollection_FlatDataMap<int, double> aMap;
+    for (const int aKey : aKeys)
+    {
+      aMap.Bind(aKey, double(aKey));
+    }
+    double aSum = 0.0;
+    for (const int aKey : aKeys)
+    {
+      aSum += aMap.Find(aKey);
+    }
+    benchmark::DoNotOptimize(aSum);
+  }
+  theState.SetItemsProcessed(theState.iterations() * int64_t(aKeys.size()));
+}
+BENCHMARK(NCollection_FlatDataMap_BindFind)->RangeMultiplier(8)->Range(1 << 10, 1 << 19);
+
+static void NCollection_IndexedMap_AddFindIndex(benchmark::State& theState)
+{
+  const std::vector<int> aKeys = shuffledKeys(int(theState.range(0)));
+  for (auto _ : theState)
+  {
+    NCollection_IndexedMap<int> aMap;
+    for (const int aKey : aKeys)
+    {
+      aMap.Add(aKey);
+    }
+    int aSum = 0;
+    for (const int aKey : aKeys)
+    {
+      aSum += aMap.FindIndex(aKey);
+    }
+    benchmark::DoNotOptimize(aSum);
+  }
+  theState.SetItemsProcessed(theState.iterations() * int64_t(aKeys.size()));
+}
+BENCHMARK(NCollection_IndexedMap_AddFindIndex)->RangeMultiplier(8)->Range(1 << 10, 1 << 19);
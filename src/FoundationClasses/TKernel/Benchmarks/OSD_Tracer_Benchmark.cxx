@@ -0,0 +1,32 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <OSD_TraceZone.hxx>
+
+#include <benchmark/benchmark.h>
+
+// Argument: 0 - tracing disabled, 1 - tracing enabled.
+static void OSD_Tracer_Zone(benchmark::State& theState)
+{
+  const bool wasEnabled = OSD_Tracer::IsEnabled();
+  OSD_Tracer::SetEnabled(theState.range(0) != 0);
+  for (auto _ : theState)
+  {
+    OSD_TRACE_ZONE("OSD_Tracer_Zone");
+  }
+  OSD_Tracer::SetEnabled(wasEnabled);
+  OSD_Tracer::Clear();
+  theState.SetItemsProcessed(theState.iterations());
+}
+
+BENCHMARK(OSD_Tracer_Zone)->Arg(0)->Arg(1);
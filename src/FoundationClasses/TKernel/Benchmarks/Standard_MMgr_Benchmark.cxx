@@ -0,0 +1,69 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <Standard_MMgrOpt.hxx>
+#include <Standard_MMgrThreadCache.hxx>
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+namespace
+{
+//! Frees and allocates blocks of various sizes, keeping a window of 64 blocks alive.
+void allocateAndFree(benchmark::State& theState, Standard_MMgrRoot& theMMgr)
+{
+  std::vector<void*> aBlocks(64, nullptr);
+  int                anIter = 0;
+  for (auto _ : theState)
+  {
+    void*& aBlock = aBlocks[anIter % 64];
+    theMMgr.Free(aBlock);
+    aBlock = theMMgr.Allocate(8 + (anIter * 7) % 200);
+    benchmark::DoNotOptimize(aBlock);
+    ++anIter;
+  }
+  for (void* aBlock : aBlocks)
+  {
+    theMMgr.Free(aBlock);
+  }
+  theState.SetItemsProcessed(theState.iterations());
+}
+
+//! Memory managers shared by the threads of one benchmark.
+Standard_MMgrOpt& optMMgr()
+{
+  static Standard_MMgrOpt aMMgr(false, false);
+  return aMMgr;
+}
+
+Standard_MMgrThreadCache& threadCacheMMgr()
+{
+  static Standard_MMgrThreadCache aMMgr(false);
+  return aMMgr;
+}
+} // namespace
+
+static void Standard_MMgrOpt_AllocateFree(benchmark::State& theState)
+{
+  allocateAndFree(theState, optMMgr());
+}
+
+BENCHMARK(Standard_MMgrOpt_AllocateFree)->ThreadRange(1, 8)->UseRealTime();
+
+static void Standard_MMgrThreadCache_AllocateFree(benchmark::State& theState)
+{
+  allocateAndFree(theState, threadCacheMMgr());
+}
+
+BENCHMARK(Standard_MMgrThreadCache_AllocateFree)->ThreadRange(1, 8)->UseRealTime();
@@ -5,11 +5,14 @@ set(OCCT_TKernel_GTests_FILES
   Handle_Advanced_Test.cxx
   Handle_Operations_Test.cxx
   Message_Messenger_Test.cxx
+  Message_ProgressIndicator_Test.cxx
   NCollection_Array1_Test.cxx
   NCollection_Array2_Test.cxx
   NCollection_BaseAllocator_Test.cxx
   NCollection_DataMap_Test.cxx
   NCollection_DoubleMap_Test.cxx
+  NCollection_FlatDataMap_Test.cxx
+  NCollection_FlatMap_Test.cxx
   NCollection_IndexedDataMap_Test.cxx
   NCollection_IndexedMap_Test.cxx
   NCollection_List_Test.cxx
@@ -20,8 +23,12 @@ set(OCCT_TKernel_GTests_FILES
   NCollection_SparseArray_Test.cxx
   NCollection_Vec4_Test.cxx
   NCollection_Vector_Test.cxx
+  OSD_FileSystem_Test.cxx
+  OSD_MemInfo_Test.cxx
   OSD_Path_Test.cxx
   OSD_PerfMeter_Test.cxx
+  OSD_TaskScheduler_Test.cxx
+  OSD_Tracer_Test.cxx
   Quantity_Color_Test.cxx
   Quantity_ColorRGBA_Test.cxx
   Quantity_Date_Test.cxx
@@ -33,6 +40,7 @@ set(OCCT_TKernel_GTests_FILES
   Standard_Failure_Test.cxx
   Standard_GUID_Test.cxx
   Standard_Handle_Test.cxx
+  Standard_MMgrThreadCache_Test.cxx
   TCollection_AsciiString_Test.cxx
   TCollection_ExtendedString_Test.cxx
   TopLoc_Location_Test.cxx
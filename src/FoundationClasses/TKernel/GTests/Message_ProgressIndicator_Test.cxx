@@ -0,0 +1,116 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <Message_ProgressIndicator.hxx>
+#include <Message_ProgressScope.hxx>
+#include <OSD_Parallel.hxx>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <vector>
+
+namespace
+{
+//! Progress indicator recording positions passed to Show().
+class TestProgressIndicator : public Message_ProgressIndicator
+{
+public:
+  TestProgressIndicator()
+      : myIsInShow(false),
+        myHasConcurrentShow(false)
+  {
+  }
+
+  const std::vector<double>& Positions() const { return myPositions; }
+
+  bool HasConcurrentShow() const { return myHasConcurrentShow; }
+
+protected:
+  void Show(const Message_ProgressScope&, const bool) override
+  {
+    if (myIsInShow.exchange(true))
+    {
+      myHasConcurrentShow = true;
+    }
+    myPositions.push_back(GetPosition());
+    myIsInShow = false;
+  }
+
+private:
+  std::vector<double> myPositions;
+  std::atomic<bool>   myIsInShow;
+  bool                myHasConcurrentShow;
+};
+} // namespace
+
+TEST(Message_ProgressIndicatorTest, CoarseStepsAreShown)
+{
+  occ::handle<TestProgressIndicator> aProgress = new TestProgressIndicator();
+  {
+    Message_ProgressScope aPS(aProgress->Start(), "Outer", 4);
+    for (int anIter = 0; anIter < 4; ++anIter)
+    {
+      aPS.Next();
+      EXPECT_NEAR(0.25 * (anIter + 1), aProgress->GetPosition(), 1.0e-12);
+    }
+  }
+  ASSERT_EQ(5u, aProgress->Positions().size());
+  EXPECT_EQ(0.0, aProgress->Positions().front());
+  EXPECT_NEAR(1.0, aProgress->Positions().back(), 1.0e-12);
+}
+
+TEST(Message_ProgressIndicatorTest, FineStepsAreThrottled)
+{
+  occ::handle<TestProgressIndicator> aProgress = new TestProgressIndicator();
+  const int                          aNbSteps  = 100000;
+  {
+    Message_ProgressScope aPS(aProgress->Start(), "Fine", aNbSteps);
+    for (int anIter = 0; anIter < aNbSteps; ++anIter)
+    {
+      aPS.Next();
+    }
+    // aggregated increments are taken into account by the position
+    EXPECT_NEAR(1.0, aProgress->GetPosition(), 1.0e-9);
+  }
+  EXPECT_LT(aProgress->Positions().size(), 5000u);
+  EXPECT_NEAR(1.0, aProgress->Positions().back(), 1.0e-9);
+}
+
+TEST(Message_ProgressIndicatorTest, ParallelIncrements)
+{
+  occ::handle<TestProgressIndicator> aProgress = new TestProgressIndicator();
+  const int                          aNbItems  = 30000;
+  {
+    Message_ProgressScope aPS(aProgress->Start(), "Parallel", aNbItems);
+    std::vector<Message_ProgressRange> aRanges;
+    aRanges.reserve(aNbItems);
+    for (int anIter = 0; anIter < aNbItems; ++anIter)
+    {
+      aRanges.push_back(aPS.Next());
+    }
+    OSD_Parallel::For(0, aNbItems, [&aRanges](const int theIndex) {
+      Message_ProgressScope anItemPS(aRanges[theIndex], nullptr, 2);
+      anItemPS.Next();
+      anItemPS.Next();
+    });
+    EXPECT_NEAR(1.0, aProgress->GetPosition(), 1.0e-9);
+  }
+  EXPECT_FALSE(aProgress->HasConcurrentShow());
+  ASSERT_FALSE(aProgress->Positions().empty());
+  EXPECT_NEAR(1.0, aProgress->Positions().back(), 1.0e-9);
+  for (size_t anIndex = 1; anIndex < aProgress->Positions().size(); ++anIndex)
+  {
+    EXPECT_LE(aProgress->Positions()[anIndex - 1], aProgress->Positions()[anIndex]);
+  }
+}
@@ -0,0 +1,141 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <NCollection_DataMap.hxx>
+#include <NCollection_FlatDataMap.hxx>
+#include <Standard_NoSuchObject.hxx>
+#include <TCollection_AsciiString.hxx>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace
+{
+//! Binds the keys in the map and returns the sum of values of found shifted keys.
+template <class MapType>
+double sumFoundValues(const std::vector<int>& theKeys)
+{
+  MapType aMap;
+  for (const int aKey : theKeys)
+  {
+    aMap.Bind(aKey, double(aKey));
+  }
+  double aSum = 0.0;
+  for (int aRound = 0; aRound < 4; ++aRound)
+  {
+    for (const int aKey : theKeys)
+    {
+      if (const double* aValue = aMap.Seek(aKey + aRound))
+      {
+        aSum += *aValue;
+      }
+    }
+  }
+  return aSum;
+}
+} // namespace
+
+TEST(NCollection_FlatDataMapTest, BindAndFind)
+{
+  NCollection_FlatDataMap<int, TCollection_AsciiString> aMap;
+  EXPECT_TRUE(aMap.Bind(1, "one"));
+  EXPECT_TRUE(aMap.Bind(2, "two"));
+  EXPECT_FALSE(aMap.Bind(1, "uno"));
+  EXPECT_EQ(2, aMap.Extent());
+  EXPECT_TRUE(aMap.IsBound(1));
+  EXPECT_FALSE(aMap.IsBound(3));
+  EXPECT_STREQ("uno", aMap.Find(1).ToCString());
+  EXPECT_STREQ("two", aMap(2).ToCString());
+  EXPECT_THROW(aMap.Find(3), Standard_NoSuchObject);
+  EXPECT_EQ(nullptr, aMap.Seek(3));
+
+  TCollection_AsciiString aValue;
+  EXPECT_TRUE(aMap.Find(2, aValue));
+  EXPECT_STREQ("two", aValue.ToCString());
+  EXPECT_FALSE(aMap.Find(3, aValue));
+
+  aMap.ChangeFind(2) = "deux";
+  EXPECT_STREQ("deux", aMap.Seek(2)->ToCString());
+  *aMap.ChangeSeek(2) += "!";
+  EXPECT_STREQ("deux!", aMap(2).ToCString());
+  *aMap.Bound(3, "three") += "!";
+  EXPECT_STREQ("three!", aMap(3).ToCString());
+
+  EXPECT_TRUE(aMap.UnBind(1));
+  EXPECT_FALSE(aMap.UnBind(1));
+  EXPECT_FALSE(aMap.IsBound(1));
+  EXPECT_EQ(2, aMap.Extent());
+}
+
+TEST(NCollection_FlatDataMapTest, Iterator)
+{
+  NCollection_FlatDataMap<int, int> aMap;
+  for (int aKey = 0; aKey < 1000; ++aKey)
+  {
+    aMap.Bind(aKey, 2 * aKey);
+  }
+
+  int aNbIterated = 0;
+  for (NCollection_FlatDataMap<int, int>::Iterator anIter(aMap); anIter.More(); anIter.Next())
+  {
+    EXPECT_EQ(2 * anIter.Key(), anIter.Value());
+    anIter.ChangeValue() = anIter.Key();
+    ++aNbIterated;
+  }
+  EXPECT_EQ(1000, aNbIterated);
+
+  int aSum = 0;
+  for (const int aValue : aMap)
+  {
+    aSum += aValue;
+  }
+  EXPECT_EQ(999 * 1000 / 2, aSum);
+}
+
+TEST(NCollection_FlatDataMapTest, CopyAndMove)
+{
+  NCollection_FlatDataMap<TCollection_AsciiString, int> aMap;
+  for (int aKey = 0; aKey < 100; ++aKey)
+  {
+    aMap.Bind(TCollection_AsciiString(aKey), aKey);
+  }
+
+  NCollection_FlatDataMap<TCollection_AsciiString, int> aCopy(aMap);
+  EXPECT_EQ(100, aCopy.Extent());
+  EXPECT_EQ(42, aCopy.Find(TCollection_AsciiString(42)));
+
+  NCollection_FlatDataMap<TCollection_AsciiString, int> aMoved;
+  aMoved = std::move(aCopy);
+  EXPECT_EQ(100, aMoved.Extent());
+  EXPECT_TRUE(aCopy.IsEmpty());
+
+  aMoved.Clear();
+  EXPECT_TRUE(aMoved.IsEmpty());
+  EXPECT_EQ(100, aMap.Extent());
+}
+
+TEST(NCollection_FlatDataMapTest, SameResultAsDataMap)
+{
+  std::vector<int> aKeys;
+  unsigned int     aSeed = 11;
+  for (int anIter = 0; anIter < 200000; ++anIter)
+  {
+    aSeed = aSeed * 1103515245u + 12345u;
+    aKeys.push_back(int(aSeed >> 1));
+  }
+
+  const double aSum     = sumFoundValues<NCollection_DataMap<int, double>>(aKeys);
+  const double aSumFlat = sumFoundValues<NCollection_FlatDataMap<int, double>>(aKeys);
+  EXPECT_EQ(aSum, aSumFlat);
+}
@@ -0,0 +1,186 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <NCollection_FlatMap.hxx>
+#include <NCollection_Map.hxx>
+#include <TCollection_AsciiString.hxx>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+//! Hasher returning the same hash code for all keys.
+struct CollidingHasher
+{
+  size_t operator()(const int) const noexcept { return 1; }
+
+  bool operator()(const int theK1, const int theK2) const noexcept { return theK1 == theK2; }
+};
+
+//! Adds the keys to the map and returns the number of found shifted keys.
+template <class MapType>
+int countFoundKeys(const std::vector<int>& theKeys)
+{
+  MapType aMap;
+  for (const int aKey : theKeys)
+  {
+    aMap.Add(aKey);
+  }
+  int aNbFound = 0;
+  for (int aRound = 0; aRound < 4; ++aRound)
+  {
+    for (const int aKey : theKeys)
+    {
+      aNbFound += aMap.Contains(aKey + aRound) ? 1 : 0;
+    }
+  }
+  return aNbFound;
+}
+} // namespace
+
+TEST(NCollection_FlatMapTest, DefaultConstructor)
+{
+  NCollection_FlatMap<int> aMap;
+  EXPECT_TRUE(aMap.IsEmpty());
+  EXPECT_EQ(0, aMap.Extent());
+  EXPECT_EQ(0, aMap.NbBuckets());
+  EXPECT_FALSE(aMap.Contains(1));
+  EXPECT_FALSE(aMap.Remove(1));
+  EXPECT_FALSE(NCollection_FlatMap<int>::Iterator(aMap).More());
+
+  // the map reserved for 100 keys is not enlarged while adding them
+  NCollection_FlatMap<int> aReserved(100);
+  const int                aNbBuckets = aReserved.NbBuckets();
+  EXPECT_GE(aNbBuckets, 100);
+  for (int aKey = 0; aKey < 100; ++aKey)
+  {
+    aReserved.Add(aKey);
+  }
+  EXPECT_EQ(aNbBuckets, aReserved.NbBuckets());
+}
+
+TEST(NCollection_FlatMapTest, AddContainsRemove)
+{
+  NCollection_FlatMap<int> aMap;
+  EXPECT_TRUE(aMap.Add(10));
+  EXPECT_TRUE(aMap.Add(20));
+  EXPECT_FALSE(aMap.Add(10));
+  EXPECT_EQ(2, aMap.Extent());
+  EXPECT_TRUE(aMap.Contains(10));
+  EXPECT_FALSE(aMap.Contains(30));
+  EXPECT_EQ(20, aMap.Added(20));
+  EXPECT_EQ(30, aMap.Added(30));
+  EXPECT_EQ(3, aMap.Extent());
+
+  EXPECT_TRUE(aMap.Remove(20));
+  EXPECT_FALSE(aMap.Remove(20));
+  EXPECT_FALSE(aMap.Contains(20));
+  EXPECT_EQ(2, aMap.Extent());
+  EXPECT_TRUE(aMap.Add(20));
+
+  aMap.Clear();
+  EXPECT_TRUE(aMap.IsEmpty());
+  EXPECT_FALSE(aMap.Contains(10));
+  EXPECT_TRUE(aMap.Add(10));
+  aMap.Clear(true);
+  EXPECT_EQ(0, aMap.NbBuckets());
+}
+
+TEST(NCollection_FlatMapTest, ManyKeys)
+{
+  // keys are added and removed many times, so that deleted slots are reused
+  NCollection_FlatMap<int> aMap;
+  NCollection_Map<int>     aRefMap;
+  unsigned int             aSeed = 1;
+  for (int anIter = 0; anIter < 200000; ++anIter)
+  {
+    aSeed            = aSeed * 1103515245u + 12345u;
+    const int  aKey  = int((aSeed >> 8) % 5000);
+    const bool toAdd = (aSeed >> 4) % 3 != 0;
+    ASSERT_EQ(toAdd ? aRefMap.Add(aKey) : aRefMap.Remove(aKey),
+              toAdd ? aMap.Add(aKey) : aMap.Remove(aKey));
+  }
+  EXPECT_EQ(aRefMap.Extent(), aMap.Extent());
+  EXPECT_LT(aMap.NbBuckets(), 4 * 5000);
+
+  int aNbIterated = 0;
+  for (NCollection_FlatMap<int>::Iterator anIter(aMap); anIter.More(); anIter.Next())
+  {
+    EXPECT_TRUE(aRefMap.Contains(anIter.Key()));
+    ++aNbIterated;
+  }
+  EXPECT_EQ(aMap.Extent(), aNbIterated);
+  EXPECT_EQ(aMap.Extent(), int(std::distance(aMap.cbegin(), aMap.cend())));
+}
+
+TEST(NCollection_FlatMapTest, CollidingHashCodes)
+{
+  NCollection_FlatMap<int, CollidingHasher> aMap;
+  for (int aKey = 0; aKey < 1000; ++aKey)
+  {
+    EXPECT_TRUE(aMap.Add(aKey));
+  }
+  for (int aKey = 0; aKey < 1000; aKey += 2)
+  {
+    EXPECT_TRUE(aMap.Remove(aKey));
+  }
+  EXPECT_EQ(500, aMap.Extent());
+  for (int aKey = 0; aKey < 1000; ++aKey)
+  {
+    EXPECT_EQ(aKey % 2 != 0, aMap.Contains(aKey));
+  }
+}
+
+TEST(NCollection_FlatMapTest, CopyAndMove)
+{
+  NCollection_FlatMap<TCollection_AsciiString> aMap;
+  for (int aKey = 0; aKey < 100; ++aKey)
+  {
+    aMap.Add(TCollection_AsciiString(aKey));
+  }
+
+  NCollection_FlatMap<TCollection_AsciiString> aCopy(aMap);
+  EXPECT_EQ(100, aCopy.Extent());
+  EXPECT_TRUE(aCopy.Contains(TCollection_AsciiString(42)));
+
+  NCollection_FlatMap<TCollection_AsciiString> aMoved(std::move(aCopy));
+  EXPECT_EQ(100, aMoved.Extent());
+  EXPECT_TRUE(aCopy.IsEmpty());
+
+  NCollection_FlatMap<TCollection_AsciiString> anAssigned;
+  anAssigned.Add("other");
+  anAssigned = aMoved;
+  EXPECT_EQ(100, anAssigned.Extent());
+  EXPECT_FALSE(anAssigned.Contains("other"));
+
+  anAssigned.Exchange(aCopy);
+  EXPECT_TRUE(anAssigned.IsEmpty());
+  EXPECT_EQ(100, aCopy.Extent());
+}
+
+TEST(NCollection_FlatMapTest, SameResultAsMap)
+{
+  std::vector<int> aKeys;
+  unsigned int     aSeed = 7;
+  for (int anIter = 0; anIter < 200000; ++anIter)
+  {
+    aSeed = aSeed * 1103515245u + 12345u;
+    aKeys.push_back(int(aSeed >> 1));
+  }
+
+  EXPECT_EQ(countFoundKeys<NCollection_Map<int>>(aKeys),
+            countFoundKeys<NCollection_FlatMap<int>>(aKeys));
+}
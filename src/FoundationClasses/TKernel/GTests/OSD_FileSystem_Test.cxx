@@ -0,0 +1,76 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <OSD_CachedFileSystem.hxx>
+#include <OSD_File.hxx>
+#include <OSD_LocalFileSystem.hxx>
+#include <OSD_Path.hxx>
+
+#include <cstring>
+#include <fstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+//! Writes the test content into the file.
+std::string writeTestFile(const TCollection_AsciiString& theFile)
+{
+  std::string aContent;
+  for (int anIter = 0; anIter < 20000; ++anIter)
+  {
+    aContent += std::to_string(anIter) + ";";
+  }
+  std::ofstream aStream(theFile.ToCString(), std::ios::out | std::ios::binary);
+  aStream.write(aContent.c_str(), (std::streamsize)aContent.size());
+  return aContent;
+}
+
+//! Checks that the mapped buffer contains the expected part of the content.
+void checkBuffer(const occ::handle<NCollection_Buffer>& theBuffer,
+                 const std::string&                     theContent,
+                 const size_t                           theOffset,
+                 const size_t                           theLength)
+{
+  ASSERT_FALSE(theBuffer.IsNull());
+  ASSERT_EQ(theLength, theBuffer->Size());
+  EXPECT_EQ(0, memcmp(theContent.c_str() + theOffset, theBuffer->Data(), theLength));
+}
+} // namespace
+
+TEST(OSD_FileSystem_Test, OpenMappedBuffer)
+{
+  const TCollection_AsciiString aFile    = "OSD_FileSystem_Test_OpenMappedBuffer.bin";
+  const std::string             aContent = writeTestFile(aFile);
+  const size_t                  aSize    = aContent.size();
+
+  // offsets not aligned to the page size
+  occ::handle<OSD_LocalFileSystem> aLocalFS = new OSD_LocalFileSystem();
+  checkBuffer(aLocalFS->OpenMappedBuffer(aFile), aContent, 0, aSize);
+  checkBuffer(aLocalFS->OpenMappedBuffer(aFile, 5000), aContent, 5000, aSize - 5000);
+  checkBuffer(aLocalFS->OpenMappedBuffer(aFile, 4099, 100), aContent, 4099, 100);
+  EXPECT_TRUE(aLocalFS->OpenMappedBuffer(aFile, 10, 0).IsNull());
+  EXPECT_TRUE(aLocalFS->OpenMappedBuffer(aFile, (int64_t)aSize + 1).IsNull());
+  EXPECT_TRUE(aLocalFS->OpenMappedBuffer("OSD_FileSystem_Test_Missing.bin").IsNull());
+
+  // views into the file mapped once
+  occ::handle<OSD_CachedFileSystem> aCachedFS = new OSD_CachedFileSystem(aLocalFS);
+  checkBuffer(aCachedFS->OpenMappedBuffer(aFile, 7, 1000), aContent, 7, 1000);
+  checkBuffer(aCachedFS->OpenMappedBuffer(aFile, 9000), aContent, 9000, aSize - 9000);
+  EXPECT_TRUE(aCachedFS->OpenMappedBuffer(aFile, 10, (int64_t)aSize).IsNull());
+
+  aCachedFS.Nullify();
+  OSD_File(OSD_Path(aFile)).Remove();
+}
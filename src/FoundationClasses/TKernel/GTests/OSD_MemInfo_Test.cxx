@@ -0,0 +1,106 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <NCollection_IncAllocator.hxx>
+#include <OSD_MemInfo.hxx>
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+TEST(OSD_MemInfoTest, RegisterMemTag)
+{
+  EXPECT_STREQ("Mesh", OSD_MemInfo::MemTagName(OSD_MemInfo::MemTag_Mesh).ToCString());
+  EXPECT_STREQ("GpuBuffers", OSD_MemInfo::MemTagName(OSD_MemInfo::MemTag_GpuBuffers).ToCString());
+  EXPECT_TRUE(OSD_MemInfo::MemTagName(OSD_MemInfo::THE_MAX_MEM_TAGS).IsEmpty());
+
+  const int aTag = OSD_MemInfo::RegisterMemTag("OSD_MemInfoTest::Custom");
+  EXPECT_GE(aTag, int(OSD_MemInfo::MemTag_NB));
+  EXPECT_EQ(aTag, OSD_MemInfo::RegisterMemTag("OSD_MemInfoTest::Custom"));
+  EXPECT_STREQ("OSD_MemInfoTest::Custom", OSD_MemInfo::MemTagName(aTag).ToCString());
+  EXPECT_GT(OSD_MemInfo::NbMemTags(), aTag);
+
+  // untagged memory is not accounted
+  OSD_MemInfo::AddTaggedMemory(OSD_MemInfo::MemTag_Untagged, 1000);
+  EXPECT_EQ(0u, OSD_MemInfo::TaggedMemory(OSD_MemInfo::MemTag_Untagged));
+}
+
+TEST(OSD_MemInfoTest, LiveAndPeakMemory)
+{
+  const int aTag = OSD_MemInfo::RegisterMemTag("OSD_MemInfoTest::LiveAndPeak");
+  ASSERT_NE(int(OSD_MemInfo::MemTag_Untagged), aTag);
+
+  std::vector<std::thread> aThreads;
+  for (int aThreadIter = 0; aThreadIter < 4; ++aThreadIter)
+  {
+    aThreads.emplace_back([aTag]() {
+      for (int anIter = 0; anIter < 1000; ++anIter)
+      {
+        OSD_MemInfo::AddTaggedMemory(aTag, 100);
+      }
+    });
+  }
+  for (std::thread& aThread : aThreads)
+  {
+    aThread.join();
+  }
+  EXPECT_EQ(400000u, OSD_MemInfo::TaggedMemory(aTag));
+  EXPECT_EQ(400000u, OSD_MemInfo::TaggedMemoryPeak(aTag));
+
+  OSD_MemInfo::AddTaggedMemory(aTag, -300000);
+  EXPECT_EQ(100000u, OSD_MemInfo::TaggedMemory(aTag));
+  EXPECT_EQ(400000u, OSD_MemInfo::TaggedMemoryPeak(aTag));
+  EXPECT_NE(-1, OSD_MemInfo::PrintTaggedMemory().Search("OSD_MemInfoTest::LiveAndPeak"));
+
+  OSD_MemInfo::ResetTaggedMemoryPeaks();
+  EXPECT_EQ(100000u, OSD_MemInfo::TaggedMemoryPeak(aTag));
+  OSD_MemInfo::AddTaggedMemory(aTag, -100000);
+}
+
+TEST(OSD_MemInfoTest, IncAllocatorMemTag)
+{
+  const int aTag1 = OSD_MemInfo::RegisterMemTag("OSD_MemInfoTest::IncAllocator1");
+  const int aTag2 = OSD_MemInfo::RegisterMemTag("OSD_MemInfoTest::IncAllocator2");
+  {
+    occ::handle<NCollection_IncAllocator> anAlloc = new NCollection_IncAllocator();
+    anAlloc->Allocate(100);
+    EXPECT_EQ(OSD_MemInfo::MemTag_Untagged, anAlloc->MemTag());
+
+    // blocks allocated before tagging are accounted too
+    anAlloc->SetMemTag(aTag1);
+    EXPECT_EQ(aTag1, anAlloc->MemTag());
+    const size_t aBlockSize = OSD_MemInfo::TaggedMemory(aTag1);
+    EXPECT_GE(aBlockSize, NCollection_IncAllocator::THE_DEFAULT_BLOCK_SIZE);
+
+    anAlloc->Allocate(NCollection_IncAllocator::THE_DEFAULT_BLOCK_SIZE * 4);
+    EXPECT_GT(OSD_MemInfo::TaggedMemory(aTag1), aBlockSize);
+
+    // memory is moved to the new tag
+    const size_t aTotalSize = OSD_MemInfo::TaggedMemory(aTag1);
+    anAlloc->SetMemTag(aTag2);
+    EXPECT_EQ(0u, OSD_MemInfo::TaggedMemory(aTag1));
+    EXPECT_EQ(aTotalSize, OSD_MemInfo::TaggedMemory(aTag2));
+
+    // memory is kept on reset without release
+    anAlloc->Reset(false);
+    EXPECT_EQ(aTotalSize, OSD_MemInfo::TaggedMemory(aTag2));
+    anAlloc->Reset(true);
+    EXPECT_EQ(0u, OSD_MemInfo::TaggedMemory(aTag2));
+
+    anAlloc->Allocate(100);
+    EXPECT_GT(OSD_MemInfo::TaggedMemory(aTag2), 0u);
+  }
+  EXPECT_EQ(0u, OSD_MemInfo::TaggedMemory(aTag2));
+  EXPECT_GT(OSD_MemInfo::TaggedMemoryPeak(aTag2), 0u);
+}
@@ -0,0 +1,133 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <OSD_Parallel.hxx>
+#include <OSD_TaskScheduler.hxx>
+#include <Standard_ProgramError.hxx>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+
+namespace
+{
+//! Computes Fibonacci number spawning nested task groups.
+int fibonacci(const occ::handle<OSD_TaskScheduler>& theScheduler, const int theNumber)
+{
+  if (theNumber < 2)
+  {
+    return theNumber;
+  }
+
+  int                     aLeft = 0, aRight = 0;
+  OSD_Parallel::TaskGroup aGroup(theScheduler);
+  aGroup.Run([&]() { aLeft = fibonacci(theScheduler, theNumber - 1); });
+  aGroup.Run([&]() { aRight = fibonacci(theScheduler, theNumber - 2); });
+  aGroup.Wait();
+  return aLeft + aRight;
+}
+} // namespace
+
+TEST(OSD_TaskScheduler_Test, TaskGroup)
+{
+  occ::handle<OSD_TaskScheduler> aScheduler = new OSD_TaskScheduler(4);
+  EXPECT_EQ(4, aScheduler->NbThreads());
+  EXPECT_FALSE(aScheduler->IsWorkerThread());
+
+  std::atomic<int>        aCounter(0);
+  OSD_Parallel::TaskGroup aGroup(aScheduler);
+  for (int anIter = 0; anIter < 1000; ++anIter)
+  {
+    aGroup.Run([&aCounter]() { ++aCounter; });
+  }
+  aGroup.Wait();
+  EXPECT_EQ(1000, aCounter);
+  EXPECT_EQ(0, aGroup.NbPendingTasks());
+
+  // the group can be reused
+  aGroup.Run([&aCounter]() { ++aCounter; });
+  aGroup.Wait();
+  EXPECT_EQ(1001, aCounter);
+}
+
+TEST(OSD_TaskScheduler_Test, NestedGroups)
+{
+  for (int aNbThreads = 1; aNbThreads <= 4; aNbThreads += 3)
+  {
+    occ::handle<OSD_TaskScheduler> aScheduler = new OSD_TaskScheduler(aNbThreads);
+    EXPECT_EQ(610, fibonacci(aScheduler, 15));
+  }
+}
+
+TEST(OSD_TaskScheduler_Test, NestedParallelFor)
+{
+  occ::handle<OSD_TaskScheduler> aScheduler = new OSD_TaskScheduler(4);
+  std::atomic<int>               aNbNested(0);
+  std::atomic<int>               aSum(0);
+  OSD_Parallel::TaskGroup        aGroup(aScheduler);
+  for (int anOuter = 0; anOuter < 8; ++anOuter)
+  {
+    aGroup.Run([&]() {
+      // the loop within a task is executed by the same scheduler
+      OSD_Parallel::For(0, 100, [&](const int theIndex) {
+        if (OSD_TaskScheduler::Current() == aScheduler.get())
+        {
+          ++aNbNested;
+        }
+        aSum += theIndex;
+      });
+    });
+  }
+  aGroup.Wait();
+  EXPECT_EQ(8 * 4950, aSum);
+  EXPECT_EQ(800, aNbNested);
+  EXPECT_EQ(nullptr, OSD_TaskScheduler::Current());
+}
+
+TEST(OSD_TaskScheduler_Test, Cancel)
+{
+  // with a single thread, tasks are executed in the order of spawning by the waiting thread
+  occ::handle<OSD_TaskScheduler> aScheduler = new OSD_TaskScheduler(1);
+  std::atomic<int>               aCounter(0);
+  OSD_Parallel::TaskGroup        aGroup(aScheduler);
+  aGroup.Run([&]() {
+    ++aCounter;
+    aGroup.Cancel();
+  });
+  for (int anIter = 0; anIter < 10; ++anIter)
+  {
+    aGroup.Run([&aCounter]() { ++aCounter; });
+  }
+  EXPECT_EQ(11, aGroup.NbPendingTasks());
+  aGroup.Wait();
+  EXPECT_EQ(1, aCounter);
+  EXPECT_FALSE(aGroup.IsCancelled());
+
+  aGroup.Run([&aCounter]() { ++aCounter; });
+  aGroup.Wait();
+  EXPECT_EQ(2, aCounter);
+}
+
+TEST(OSD_TaskScheduler_Test, Exceptions)
+{
+  occ::handle<OSD_TaskScheduler> aScheduler = new OSD_TaskScheduler(2);
+  OSD_Parallel::TaskGroup        aGroup(aScheduler);
+  aGroup.Run([]() { throw Standard_ProgramError("Task failure"); });
+  EXPECT_THROW(aGroup.Wait(), Standard_ProgramError);
+
+  // failures are not reported twice
+  std::atomic<int> aCounter(0);
+  aGroup.Run([&aCounter]() { ++aCounter; });
+  EXPECT_NO_THROW(aGroup.Wait());
+  EXPECT_EQ(1, aCounter);
+}
@@ -0,0 +1,126 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <OSD_TraceZone.hxx>
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace
+{
+//! Enables tracing for the life time of the object and restores the previous state.
+class TracerSentry
+{
+public:
+  TracerSentry()
+      : myWasEnabled(OSD_Tracer::IsEnabled())
+  {
+    OSD_Tracer::Clear();
+    OSD_Tracer::SetEnabled(true);
+  }
+
+  ~TracerSentry()
+  {
+    OSD_Tracer::SetEnabled(myWasEnabled);
+    OSD_Tracer::Clear();
+  }
+
+private:
+  bool myWasEnabled;
+};
+
+//! Returns the number of occurrences of the string.
+int countOccurrences(const std::string& theString, const std::string& theWhat)
+{
+  int aNb = 0;
+  for (size_t aPos = theString.find(theWhat); aPos != std::string::npos;
+       aPos        = theString.find(theWhat, aPos + 1))
+  {
+    ++aNb;
+  }
+  return aNb;
+}
+} // namespace
+
+TEST(OSD_TracerTest, DisabledTracing)
+{
+  const bool wasEnabled = OSD_Tracer::IsEnabled();
+  OSD_Tracer::SetEnabled(false);
+  OSD_Tracer::Clear();
+  {
+    OSD_TRACE_ZONE("OSD_TracerTest::Disabled");
+  }
+  EXPECT_EQ(0, OSD_Tracer::NbZones());
+  OSD_Tracer::SetEnabled(wasEnabled);
+}
+
+TEST(OSD_TracerTest, NestedZonesAndThreads)
+{
+  TracerSentry aSentry;
+  OSD_Tracer::SetThreadName("main \"thread\"");
+  {
+    OSD_TRACE_ZONE("OSD_TracerTest::Outer");
+    for (int anIter = 0; anIter < 3; ++anIter)
+    {
+      OSD_TRACE_ZONE_CATEGORY("OSD_TracerTest::Inner", "test");
+    }
+
+    std::vector<std::thread> aThreads;
+    for (int aThreadIter = 0; aThreadIter < 4; ++aThreadIter)
+    {
+      aThreads.emplace_back([]() {
+        OSD_Tracer::SetThreadName("worker");
+        OSD_TRACE_ZONE("OSD_TracerTest::Worker");
+      });
+    }
+    for (std::thread& aThread : aThreads)
+    {
+      aThread.join();
+    }
+  }
+  EXPECT_EQ(8, OSD_Tracer::NbZones());
+
+  std::ostringstream aStream;
+  OSD_Tracer::DumpChromeTrace(aStream);
+  const std::string aTrace = aStream.str();
+  EXPECT_EQ(0u, aTrace.find("{\"traceEvents\":["));
+  EXPECT_EQ(1, countOccurrences(aTrace, "\"OSD_TracerTest::Outer\""));
+  EXPECT_EQ(3, countOccurrences(aTrace, "\"OSD_TracerTest::Inner\",\"cat\":\"test\""));
+  EXPECT_EQ(4, countOccurrences(aTrace, "\"OSD_TracerTest::Worker\""));
+  EXPECT_EQ(8, countOccurrences(aTrace, "\"ph\":\"X\""));
+  EXPECT_EQ(1, countOccurrences(aTrace, "\"main \\\"thread\\\"\""));
+  EXPECT_EQ(4, countOccurrences(aTrace, "{\"name\":\"worker\"}"));
+
+  // all zones are discarded, including the ones of exited threads
+  OSD_Tracer::Clear();
+  EXPECT_EQ(0, OSD_Tracer::NbZones());
+}
+
+TEST(OSD_TracerTest, RingBuffer)
+{
+  TracerSentry aSentry;
+  const int    aBufferSize = OSD_Tracer::BufferSize();
+  OSD_Tracer::SetBufferSize(10);
+  std::thread aThread([]() {
+    for (int anIter = 0; anIter < 25; ++anIter)
+    {
+      OSD_TRACE_ZONE("OSD_TracerTest::RingBuffer");
+    }
+  });
+  aThread.join();
+  OSD_Tracer::SetBufferSize(aBufferSize);
+  EXPECT_EQ(10, OSD_Tracer::NbZones());
+}
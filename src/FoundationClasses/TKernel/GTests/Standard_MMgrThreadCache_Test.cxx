@@ -0,0 +1,209 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <Standard_MMgrThreadCache.hxx>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+TEST(Standard_MMgrThreadCacheTest, AllocateAndReallocate)
+{
+  Standard_MMgrThreadCache aMMgr(true, 256, 4, 4096);
+  std::vector<char*>       aBlocks;
+  for (int aSize = 1; aSize <= 2000; aSize += 13)
+  {
+    char* aBlock = static_cast<char*>(aMMgr.Allocate(aSize));
+    ASSERT_NE(nullptr, aBlock);
+    for (int anIndex = 0; anIndex < aSize; ++anIndex)
+    {
+      ASSERT_EQ(0, aBlock[anIndex]);
+    }
+    memset(aBlock, aSize % 127, aSize);
+    aBlocks.push_back(aBlock);
+  }
+  for (size_t anIndex = 0; anIndex < aBlocks.size(); ++anIndex)
+  {
+    const int aSize = 1 + 13 * int(anIndex);
+    EXPECT_EQ(aSize % 127, aBlocks[anIndex][aSize - 1]);
+    aMMgr.Free(aBlocks[anIndex]);
+  }
+
+  // small -> large -> small block keeps its content
+  char* aBlock = static_cast<char*>(aMMgr.Allocate(16));
+  strcpy(aBlock, "OCCT");
+  aBlock = static_cast<char*>(aMMgr.Reallocate(aBlock, 5000));
+  EXPECT_STREQ("OCCT", aBlock);
+  aBlock = static_cast<char*>(aMMgr.Reallocate(aBlock, 10000));
+  EXPECT_STREQ("OCCT", aBlock);
+  aBlock = static_cast<char*>(aMMgr.Reallocate(aBlock, 40));
+  EXPECT_STREQ("OCCT", aBlock);
+  aMMgr.Free(aBlock);
+  aMMgr.Free(nullptr);
+}
+
+TEST(Standard_MMgrThreadCacheTest, Statistics)
+{
+  Standard_MMgrThreadCache                   aMMgr(false, 256, 8);
+  Standard_MMgrThreadCache::ThreadStatistics aStats;
+  EXPECT_FALSE(aMMgr.CurrentThreadStatistics(aStats));
+
+  std::vector<void*> aBlocks;
+  for (int anIter = 0; anIter < 100; ++anIter)
+  {
+    aBlocks.push_back(aMMgr.Allocate(24));
+  }
+  ASSERT_TRUE(aMMgr.CurrentThreadStatistics(aStats));
+  EXPECT_EQ(100u, aStats.NbAllocations);
+  EXPECT_EQ(0u, aStats.NbFrees);
+  EXPECT_EQ(100u * 32u, aStats.AllocatedBytes);
+  EXPECT_GE(aStats.ArenaBytes, aStats.AllocatedBytes);
+  EXPECT_EQ(0u, aStats.NbFetches);
+
+  for (void* aBlock : aBlocks)
+  {
+    aMMgr.Free(aBlock);
+  }
+  ASSERT_TRUE(aMMgr.CurrentThreadStatistics(aStats));
+  EXPECT_EQ(100u, aStats.NbFrees);
+  EXPECT_EQ(aStats.AllocatedBytes, aStats.FreedBytes);
+  EXPECT_GT(aStats.CachedBytes, 0u);
+  EXPECT_LT(aStats.CachedBytes, 2u * 8u * 32u);
+  EXPECT_GT(aStats.NbReturns, 0u);
+
+  // blocks returned to the central pool are taken back in batches
+  aBlocks.clear();
+  for (int anIter = 0; anIter < 100; ++anIter)
+  {
+    aBlocks.push_back(aMMgr.Allocate(24));
+  }
+  ASSERT_TRUE(aMMgr.CurrentThreadStatistics(aStats));
+  EXPECT_GT(aStats.NbFetches, 0u);
+  for (void* aBlock : aBlocks)
+  {
+    aMMgr.Free(aBlock);
+  }
+
+  EXPECT_EQ(0, aMMgr.Purge(false));
+  ASSERT_TRUE(aMMgr.CurrentThreadStatistics(aStats));
+  EXPECT_EQ(0u, aStats.CachedBytes);
+  EXPECT_EQ(1, aMMgr.Statistics(&aStats, 1));
+}
+
+TEST(Standard_MMgrThreadCacheTest, CrossThreadFree)
+{
+  Standard_MMgrThreadCache aMMgr(false, 256, 4);
+  std::vector<void*>       aBlocks;
+  for (int anIter = 0; anIter < 1000; ++anIter)
+  {
+    aBlocks.push_back(aMMgr.Allocate(anIter % 300));
+  }
+
+  // blocks allocated by the main thread are freed by other threads
+  std::vector<std::thread> aThreads;
+  for (int aThreadIter = 0; aThreadIter < 4; ++aThreadIter)
+  {
+    aThreads.emplace_back([&aMMgr, &aBlocks, aThreadIter]() {
+      for (size_t anIndex = aThreadIter; anIndex < aBlocks.size(); anIndex += 4)
+      {
+        aMMgr.Free(aBlocks[anIndex]);
+        aMMgr.Free(aMMgr.Allocate(anIndex % 100));
+      }
+    });
+  }
+  for (std::thread& aThread : aThreads)
+  {
+    aThread.join();
+  }
+
+  // caches of exited threads are released
+  Standard_MMgrThreadCache::ThreadStatistics aStats[8];
+  EXPECT_EQ(1, aMMgr.Statistics(aStats, 8));
+  ASSERT_TRUE(aMMgr.CurrentThreadStatistics(aStats[0]));
+  EXPECT_EQ(1000u, aStats[0].NbAllocations);
+  EXPECT_EQ(0u, aStats[0].NbFrees);
+
+  std::thread aThread([&aMMgr]() {
+    void* aBlock = aMMgr.Allocate(100);
+    EXPECT_EQ(2, aMMgr.Statistics(nullptr, 0));
+    aMMgr.Free(aBlock);
+  });
+  aThread.join();
+}
+
+TEST(Standard_MMgrThreadCacheTest, ThreadExitAfterDestruction)
+{
+  std::atomic<int> aStage(0);
+  std::thread      aThread;
+  {
+    Standard_MMgrThreadCache aMMgr;
+    aThread = std::thread([&aMMgr, &aStage]() {
+      aMMgr.Free(aMMgr.Allocate(10));
+      aStage = 1;
+      while (aStage != 2)
+      {
+        std::this_thread::yield();
+      }
+    });
+    while (aStage != 1)
+    {
+      std::this_thread::yield();
+    }
+  }
+  aStage = 2;
+  aThread.join();
+
+  // a new memory manager does not reuse the caches of the destroyed one
+  Standard_MMgrThreadCache                   aMMgr;
+  Standard_MMgrThreadCache::ThreadStatistics aStats;
+  EXPECT_FALSE(aMMgr.CurrentThreadStatistics(aStats));
+  aMMgr.Free(aMMgr.Allocate(10));
+  EXPECT_TRUE(aMMgr.CurrentThreadStatistics(aStats));
+}
+
+TEST(Standard_MMgrThreadCacheTest, ConcurrentAllocateAndFree)
+{
+  Standard_MMgrThreadCache aMMgr(false);
+  std::vector<std::thread> aThreads;
+  std::atomic<int>         aNbFailures(0);
+  for (int aThreadIter = 0; aThreadIter < 4; ++aThreadIter)
+  {
+    aThreads.emplace_back([&aMMgr, &aNbFailures, aThreadIter]() {
+      std::vector<char*> aBlocks(64, nullptr);
+      for (int anIter = 0; anIter < 20000; ++anIter)
+      {
+        char*& aBlock = aBlocks[anIter % 64];
+        if (aBlock != nullptr && aBlock[0] != char(aThreadIter))
+        {
+          ++aNbFailures;
+        }
+        aMMgr.Free(aBlock);
+        aBlock    = static_cast<char*>(aMMgr.Allocate(8 + (anIter * 7) % 200));
+        aBlock[0] = char(aThreadIter);
+      }
+      for (char* aBlock : aBlocks)
+      {
+        aMMgr.Free(aBlock);
+      }
+    });
+  }
+  for (std::thread& aThread : aThreads)
+  {
+    aThread.join();
+  }
+  EXPECT_EQ(0, aNbFailures.load());
+  EXPECT_EQ(0, aMMgr.Statistics(nullptr, 0));
+}
@@ -22,6 +22,7 @@
 #include <gp_Vec.hxx>
 #include <gp_Pnt.hxx>
 #include <OSD_Parallel.hxx>
+#include <Precision.hxx>
 
 #include <gtest/gtest.h>
 
@@ -89,3 +90,34 @@ TEST(TopLoc_Location_Test, OCC25545_ConcurrentTransformationAccess)
   EXPECT_EQ(aFunc.myIsRaceDetected, 0)
     << "Data race detected in concurrent TopLoc_Location::Transformation() access";
 }
+
+TEST(TopLoc_Location_Test, CachedHashCode)
+{
+  gp_Trsf aTrsf1, aTrsf2;
+  aTrsf1.SetTranslation(gp_Vec(1, 2, 3));
+  aTrsf2.SetRotation(gp::OZ(), 0.5);
+  const TopLoc_Location aLoc1(aTrsf1);
+  const TopLoc_Location aLoc2(aTrsf2);
+  EXPECT_EQ(0u, TopLoc_Location().HashCode());
+
+  // equal locations built independently share the hash code
+  const TopLoc_Location aProd1 = aLoc1 * aLoc2 * aLoc1;
+  const TopLoc_Location aProd2 = aLoc1 * (aLoc2 * aLoc1);
+  ASSERT_TRUE(aProd1.IsEqual(aProd2));
+  EXPECT_EQ(aProd1.HashCode(), aProd2.HashCode());
+  EXPECT_NE(aProd1.HashCode(), (aLoc2 * aLoc1 * aLoc1).HashCode());
+  EXPECT_NE(aLoc1.HashCode(), aLoc1.Inverted().HashCode());
+  EXPECT_EQ(aProd1.HashCode(), std::hash<TopLoc_Location>{}(aProd1));
+  EXPECT_TRUE(aProd1.Transformation().TranslationPart().IsEqual(
+    (aTrsf1 * aTrsf2 * aTrsf1).TranslationPart(),
+    Precision::Confusion()));
+
+  // a long chain of locations is hashed and transformed without iterating it
+  TopLoc_Location aChain;
+  for (int anIter = 0; anIter < 1000; ++anIter)
+  {
+    aChain = aChain * aLoc1;
+  }
+  EXPECT_NE(aChain.HashCode(), aChain.NextLocation().HashCode());
+  EXPECT_NEAR(1000.0, aChain.Transformation().TranslationPart().X(), Precision::Confusion());
+}
@@ -15,10 +15,36 @@
 
 IMPLEMENT_STANDARD_RTTIEXT(Message_ProgressIndicator, Standard_Transient)
 
+namespace
+{
+//! Number of fixed-point units corresponding to the whole progress range.
+static constexpr uint64_t THE_FULL_UNITS = uint64_t(1) << 48;
+
+//! Position from which the end of the range is considered as reached,
+//! tolerating rounding of the steps to fixed-point units.
+static constexpr uint64_t THE_END_UNITS = THE_FULL_UNITS - (uint64_t(1) << 24);
+
+//! Increments aggregated by a slot are added to the total position
+//! when they reach this value (1/1024 of the range).
+static constexpr uint64_t THE_FLUSH_UNITS = THE_FULL_UNITS >> 10;
+
+//! Minimal advance of the position between two calls to Show() (about 0.1% of the range).
+static constexpr uint64_t THE_SHOW_UNITS = THE_FULL_UNITS >> 10;
+
+//! Returns the index of the slot aggregating increments of the calling thread.
+static int threadSlotIndex(const int theNbSlots)
+{
+  static std::atomic<int> THE_NB_THREADS(0);
+  static thread_local int THE_SLOT_INDEX = THE_NB_THREADS.fetch_add(1) % theNbSlots;
+  return THE_SLOT_INDEX;
+}
+} // namespace
+
 //=================================================================================================
 
 Message_ProgressIndicator::Message_ProgressIndicator()
-    : myPosition(0.),
+    : myPosition(0),
+      myShownPosition(0),
       myRootScope(nullptr)
 {
   myRootScope = new Message_ProgressScope(this);
@@ -38,7 +64,12 @@ Message_ProgressIndicator::~Message_ProgressIndicator()
 
 Message_ProgressRange Message_ProgressIndicator::Start()
 {
-  myPosition           = 0.;
+  myPosition.store(0);
+  for (int aSlotIter = 0; aSlotIter < THE_NB_SLOTS; ++aSlotIter)
+  {
+    mySlots[aSlotIter].Pending.store(0);
+  }
+  myShownPosition      = 0;
   myRootScope->myValue = 0.;
   Reset();
   Show(*myRootScope, false);
@@ -52,3 +83,67 @@ Message_ProgressRange Message_ProgressIndicator::Start(
 {
   return theProgress.IsNull() ? Message_ProgressRange() : theProgress->Start();
 }
+
+//=================================================================================================
+
+uint64_t Message_ProgressIndicator::positionUnits() const
+{
+  uint64_t aPosition = myPosition.load(std::memory_order_acquire);
+  for (int aSlotIter = 0; aSlotIter < THE_NB_SLOTS; ++aSlotIter)
+  {
+    aPosition += mySlots[aSlotIter].Pending.load(std::memory_order_acquire);
+  }
+  return aPosition;
+}
+
+//=================================================================================================
+
+double Message_ProgressIndicator::GetPosition() const
+{
+  const uint64_t aPosition = positionUnits();
+  return aPosition >= THE_FULL_UNITS ? 1.0 : double(aPosition) / double(THE_FULL_UNITS);
+}
+
+//=================================================================================================
+
+void Message_ProgressIndicator::Increment(const double                 theStep,
+                                          const Message_ProgressScope& theScope)
+{
+  const uint64_t aStep =
+    theStep > 0.0 ? uint64_t(std::min(theStep, 1.0) * double(THE_FULL_UNITS) + 0.5) : 0;
+
+  // small increments are kept in the slot of the calling thread, unless the end is close:
+  // in this case every increment is published to show the final position
+  Slot&          aSlot = mySlots[threadSlotIndex(THE_NB_SLOTS)];
+  const uint64_t aPending =
+    aSlot.Pending.fetch_add(aStep, std::memory_order_acq_rel) + aStep;
+  if (aPending < THE_FLUSH_UNITS
+      && myPosition.load(std::memory_order_relaxed) + THE_NB_SLOTS * THE_FLUSH_UNITS
+           < THE_END_UNITS)
+  {
+    return;
+  }
+  myPosition.fetch_add(aSlot.Pending.exchange(0, std::memory_order_acq_rel),
+                       std::memory_order_acq_rel);
+
+  // Show() is never called concurrently; other threads skip intermediate updates,
+  // while the update at the end of the range waits to be shown
+  const bool                   isEnd = positionUnits() >= THE_END_UNITS;
+  std::unique_lock<std::mutex> aLock(myMutex, std::defer_lock);
+  if (isEnd)
+  {
+    aLock.lock();
+  }
+  else if (!aLock.try_lock())
+  {
+    return;
+  }
+
+  const uint64_t aPosition = positionUnits();
+  if (aPosition < myShownPosition + THE_SHOW_UNITS && aPosition < THE_END_UNITS)
+  {
+    return;
+  }
+  myShownPosition = aPosition;
+  Show(theScope, false);
+}
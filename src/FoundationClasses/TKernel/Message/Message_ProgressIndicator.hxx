@@ -20,6 +20,8 @@
 #include <Standard_Transient.hxx>
 #include <Standard_Type.hxx>
 
+#include <atomic>
+#include <cstdint>
 #include <mutex>
 
 class Message_ProgressRange;
@@ -47,6 +49,9 @@ class Message_ProgressScope;
 //!
 //! The progress indicator supports concurrent processing and
 //! can be used in multithreaded applications.
+//! Increments of the progress do not lock any mutex: small increments are
+//! aggregated per thread and added to the total position by larger portions,
+//! and presentation is updated only when the position has noticeably advanced.
 //!
 //! The derived class should be created to connect this interface to
 //! actual implementation of progress indicator, to take care of visualization
@@ -90,9 +95,12 @@ protected:
   //! Virtual method to be defined by descendant.
   //! Should update presentation of the progress indicator.
   //!
-  //! It is called whenever progress position is changed.
+  //! It is called when progress position has advanced by at least 0.1%
+  //! since the previous call, and when the end of the range is reached.
   //! Calls to this method from progress indicator are protected by mutex so that
-  //! it is never called concurrently for the same progress indicator instance.
+  //! it is never called concurrently for the same progress indicator instance;
+  //! threads advancing the progress while Show() is running do not wait for it
+  //! and skip the update.
   //! Show() should return as soon as possible to reduce thread contention
   //! in multithreaded algorithms.
   //!
@@ -116,9 +124,8 @@ public:
   //!@name Auxiliary methods
 
   //! Returns total progress position ranged from 0 to 1.
-  //! Should not be called concurrently while the progress is advancing,
-  //! except from implementation of method Show().
-  double GetPosition() const { return myPosition; }
+  //! Can be called concurrently while the progress is advancing.
+  Standard_EXPORT double GetPosition() const;
 
   //! Destructor
   Standard_EXPORT ~Message_ProgressIndicator() override;
@@ -129,15 +136,37 @@ protected:
 
 private:
   //! Increment the progress value by the specified step,
-  //! then calls Show() to update presentation.
+  //! then calls Show() to update presentation if position has advanced enough.
   //! The parameter theScope is reference to the caller object;
   //! it is passed to Show() where can be used to track context of the process.
-  void Increment(const double theStep, const Message_ProgressScope& theScope);
+  Standard_EXPORT void Increment(const double theStep, const Message_ProgressScope& theScope);
+
+  //! Returns total position in fixed-point units, including increments aggregated by threads.
+  uint64_t positionUnits() const;
+
+private:
+  //! Number of slots aggregating increments of threads.
+  static constexpr int THE_NB_SLOTS = 16;
+
+  //! Increments aggregated by the threads mapped to the slot,
+  //! padded to avoid false sharing between slots.
+  struct Slot
+  {
+    std::atomic<uint64_t> Pending;
+    char                  Padding[64 - sizeof(std::atomic<uint64_t>)];
+
+    Slot()
+        : Pending(0)
+    {
+    }
+  };
 
 private:
-  double                 myPosition;  //!< Total progress position ranged from 0 to 1
-  std::mutex             myMutex;     //!< Protection of myPosition from concurrent increment
-  Message_ProgressScope* myRootScope; //!< The root progress scope
+  std::atomic<uint64_t>  myPosition;            //!< Total position, in fixed-point units
+  Slot                   mySlots[THE_NB_SLOTS]; //!< Increments not yet added to myPosition
+  uint64_t               myShownPosition;       //!< Position passed to the last Show() call
+  std::mutex             myMutex;               //!< Protection of Show() from concurrent calls
+  Message_ProgressScope* myRootScope;           //!< The root progress scope
 
 private:
   friend class Message_ProgressScope; //!< Friend: can call Increment()
@@ -146,20 +175,4 @@ private:
 
 #include <Message_ProgressScope.hxx>
 
-//=================================================================================================
-
-inline void Message_ProgressIndicator::Increment(const double                 theStep,
-                                                 const Message_ProgressScope& theScope)
-{
-  // protect incrementation by mutex to avoid problems in multithreaded scenarios
-  std::lock_guard<std::mutex> aLock(myMutex);
-
-  myPosition = (std::min)(myPosition + theStep, 1.);
-
-  // show progress indicator; note that this call is protected by
-  // the same mutex to avoid concurrency and ensure that this call
-  // to Show() will see the position exactly as it was just set above
-  Show(theScope, false);
-}
-
 #endif // _Message_ProgressIndicator_HeaderFile
@@ -36,6 +36,13 @@ void NCollection_BaseAllocator::Free(void* theAddress)
   Standard::Free(theAddress);
 }
 
+//=================================================================================================
+
+void NCollection_BaseAllocator::SetMemTag(const int theTag)
+{
+  myMemTag = theTag;
+}
+
 //=======================================================================
 // function : CommonBaseAllocator
 // purpose  : Creates the only one BaseAllocator
@@ -56,14 +56,29 @@ public:
   //! create more BaseAllocators, but it is injurious.
   Standard_EXPORT static const occ::handle<NCollection_BaseAllocator>& CommonBaseAllocator();
 
+  //! Returns the tag of memory accounting (OSD_MemInfo::MemTag or custom tag).
+  int MemTag() const { return myMemTag; }
+
+  //! Sets the tag of memory accounting (OSD_MemInfo::MemTag or custom tag).
+  //! Allocators owning memory blocks (like NCollection_IncAllocator) account
+  //! these blocks in OSD_MemInfo registry under this tag;
+  //! allocators forwarding requests to the memory manager (like CommonBaseAllocator()) ignore it.
+  Standard_EXPORT virtual void SetMemTag(const int theTag);
+
 protected:
   //! Constructor - prohibited
-  NCollection_BaseAllocator() noexcept {}
+  NCollection_BaseAllocator() noexcept
+      : myMemTag(0)
+  {
+  }
 
 private:
   //! Copy constructor - prohibited
   NCollection_BaseAllocator(const NCollection_BaseAllocator&) = delete;
 
+protected:
+  int myMemTag; //!< tag of memory accounting
+
 public:
   // ---------- CasCade RunTime Type Information
   DEFINE_STANDARD_RTTIEXT(NCollection_BaseAllocator, Standard_Transient)
@@ -0,0 +1,301 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef NCollection_FlatDataMap_HeaderFile
+#define NCollection_FlatDataMap_HeaderFile
+
+#include <NCollection_DefaultHasher.hxx>
+#include <NCollection_FlatHashTable.hxx>
+#include <NCollection_StlIterator.hxx>
+
+/**
+ * Purpose:     Map of keys and items with open addressing.
+ *
+ *              Has the same interface as NCollection_DataMap
+ *              (except for allocators) and uses the same hashers,
+ *              but keeps keys and items in a flat array (see
+ *              NCollection_FlatHashTable) instead of nodes, which
+ *              makes it faster and more compact for small keys
+ *              and items.
+ *
+ *              Unlike NCollection_DataMap, binding a key may move
+ *              the other keys and items, so that references to
+ *              them (including results of Seek() and Bound())
+ *              remain valid only until the next modification.
+ */
+template <class TheKeyType, class TheItemType, class Hasher = NCollection_DefaultHasher<TheKeyType>>
+class NCollection_FlatDataMap
+    : public NCollection_FlatHashTable<NCollection_FlatKeyItemSlot<TheKeyType, TheItemType>,
+                                       TheKeyType,
+                                       Hasher>
+{
+  typedef NCollection_FlatKeyItemSlot<TheKeyType, TheItemType> Slot;
+  typedef NCollection_FlatHashTable<Slot, TheKeyType, Hasher>  base_type;
+
+public:
+  //! STL-compliant typedef for value type
+  typedef TheItemType value_type;
+
+public:
+  //! Implementation of the Iterator interface.
+  class Iterator
+  {
+  public:
+    //! Empty constructor
+    Iterator() noexcept
+        : myMap(nullptr),
+          mySlot(0)
+    {
+    }
+
+    //! Constructor
+    Iterator(const NCollection_FlatDataMap& theMap) noexcept
+        : myMap(const_cast<NCollection_FlatDataMap*>(&theMap)),
+          mySlot(theMap.nextSlot(0))
+    {
+    }
+
+    //! Query if the end of collection is reached by iterator
+    bool More() const noexcept { return myMap != nullptr && mySlot < myMap->myCapacity; }
+
+    //! Make a step along the collection
+    void Next() noexcept { mySlot = myMap->nextSlot(mySlot + 1); }
+
+    //! Value inquiry
+    const TheItemType& Value() const
+    {
+      Standard_NoSuchObject_Raise_if(!More(), "NCollection_FlatDataMap::Iterator::Value");
+      return myMap->mySlots[mySlot].Item;
+    }
+
+    //! Value change access
+    TheItemType& ChangeValue() const
+    {
+      Standard_NoSuchObject_Raise_if(!More(), "NCollection_FlatDataMap::Iterator::ChangeValue");
+      return myMap->mySlots[mySlot].Item;
+    }
+
+    //! Key
+    const TheKeyType& Key() const
+    {
+      Standard_NoSuchObject_Raise_if(!More(), "NCollection_FlatDataMap::Iterator::Key");
+      return myMap->mySlots[mySlot].Key;
+    }
+
+    //! Performs comparison of two iterators.
+    bool IsEqual(const Iterator& theOther) const noexcept
+    {
+      return myMap == theOther.myMap && mySlot == theOther.mySlot;
+    }
+
+  private:
+    NCollection_FlatDataMap* myMap;
+    int                      mySlot;
+  };
+
+  //! Shorthand for a regular iterator type.
+  typedef NCollection_StlIterator<std::forward_iterator_tag, Iterator, TheItemType, false> iterator;
+
+  //! Shorthand for a constant iterator type.
+  typedef NCollection_StlIterator<std::forward_iterator_tag, Iterator, TheItemType, true>
+    const_iterator;
+
+  //! Returns an iterator pointing to the first element in the map.
+  iterator begin() const noexcept { return Iterator(*this); }
+
+  //! Returns an iterator referring to the past-the-end element in the map.
+  iterator end() const noexcept { return Iterator(); }
+
+  //! Returns a const iterator pointing to the first element in the map.
+  const_iterator cbegin() const noexcept { return Iterator(*this); }
+
+  //! Returns a const iterator referring to the past-the-end element in the map.
+  const_iterator cend() const noexcept { return Iterator(); }
+
+public:
+  //! Empty constructor.
+  NCollection_FlatDataMap() noexcept {}
+
+  //! Constructor preparing the map to hold the given number of keys.
+  explicit NCollection_FlatDataMap(const int theNbKeys) { this->ReSize(theNbKeys); }
+
+  //! Copy constructor
+  NCollection_FlatDataMap(const NCollection_FlatDataMap& theOther) { this->assign(theOther); }
+
+  //! Move constructor
+  NCollection_FlatDataMap(NCollection_FlatDataMap&& theOther) noexcept
+      : base_type(std::move(theOther))
+  {
+  }
+
+  //! Exchange the content of two maps without re-allocations.
+  void Exchange(NCollection_FlatDataMap& theOther) noexcept { base_type::Exchange(theOther); }
+
+  //! Assign.
+  NCollection_FlatDataMap& Assign(const NCollection_FlatDataMap& theOther)
+  {
+    if (this != &theOther)
+    {
+      this->assign(theOther);
+    }
+    return *this;
+  }
+
+  //! Assign operator
+  NCollection_FlatDataMap& operator=(const NCollection_FlatDataMap& theOther)
+  {
+    return Assign(theOther);
+  }
+
+  //! Move operator
+  NCollection_FlatDataMap& operator=(NCollection_FlatDataMap&& theOther) noexcept
+  {
+    if (this != &theOther)
+    {
+      this->Clear(true);
+      Exchange(theOther);
+    }
+    return *this;
+  }
+
+  //! Bind binds Item to Key in map.
+  //! @param theKey  key to add/update
+  //! @param theItem new item; overrides value previously bound to the key
+  //! @return true if Key was not bound already
+  bool Bind(const TheKeyType& theKey, const TheItemType& theItem)
+  {
+    bool      isNew = false;
+    const int aSlot = this->findOrReserveSlot(theKey, isNew);
+    if (isNew)
+    {
+      new (&this->mySlots[aSlot]) Slot{theKey, theItem};
+    }
+    else
+    {
+      this->mySlots[aSlot].Item = theItem;
+    }
+    return isNew;
+  }
+
+  //! Bind binds Item to Key in map.
+  //! @param theKey  key to add/update
+  //! @param theItem new item; overrides value previously bound to the key
+  //! @return true if Key was not bound already
+  bool Bind(TheKeyType&& theKey, TheItemType&& theItem)
+  {
+    bool      isNew = false;
+    const int aSlot = this->findOrReserveSlot(theKey, isNew);
+    if (isNew)
+    {
+      new (&this->mySlots[aSlot]) Slot{std::move(theKey), std::move(theItem)};
+    }
+    else
+    {
+      this->mySlots[aSlot].Item = std::move(theItem);
+    }
+    return isNew;
+  }
+
+  //! Bound binds Item to Key in map.
+  //! @param theKey  key to add/update
+  //! @param theItem new item; overrides value previously bound to the key
+  //! @return pointer to modifiable Item
+  TheItemType* Bound(const TheKeyType& theKey, const TheItemType& theItem)
+  {
+    bool      isNew = false;
+    const int aSlot = this->findOrReserveSlot(theKey, isNew);
+    if (isNew)
+    {
+      new (&this->mySlots[aSlot]) Slot{theKey, theItem};
+    }
+    else
+    {
+      this->mySlots[aSlot].Item = theItem;
+    }
+    return &this->mySlots[aSlot].Item;
+  }
+
+  //! IsBound
+  bool IsBound(const TheKeyType& theKey) const { return this->Contains(theKey); }
+
+  //! UnBind removes Item Key pair from map
+  bool UnBind(const TheKeyType& theKey)
+  {
+    const int aSlot = this->findSlot(theKey);
+    if (aSlot < 0)
+    {
+      return false;
+    }
+    this->eraseSlot(aSlot);
+    return true;
+  }
+
+  //! Seek returns pointer to Item by Key. Returns
+  //! NULL is Key was not bound.
+  const TheItemType* Seek(const TheKeyType& theKey) const
+  {
+    const int aSlot = this->findSlot(theKey);
+    return aSlot >= 0 ? &this->mySlots[aSlot].Item : nullptr;
+  }
+
+  //! Find returns the Item for Key. Raises if Key was not bound
+  const TheItemType& Find(const TheKeyType& theKey) const
+  {
+    const int aSlot = this->findSlot(theKey);
+    if (aSlot < 0)
+    {
+      throw Standard_NoSuchObject("NCollection_FlatDataMap::Find");
+    }
+    return this->mySlots[aSlot].Item;
+  }
+
+  //! Find Item for key with copying.
+  //! @return true if key was found
+  bool Find(const TheKeyType& theKey, TheItemType& theValue) const
+  {
+    const int aSlot = this->findSlot(theKey);
+    if (aSlot < 0)
+    {
+      return false;
+    }
+    theValue = this->mySlots[aSlot].Item;
+    return true;
+  }
+
+  //! operator ()
+  const TheItemType& operator()(const TheKeyType& theKey) const { return Find(theKey); }
+
+  //! ChangeSeek returns modifiable pointer to Item by Key. Returns
+  //! NULL is Key was not bound.
+  TheItemType* ChangeSeek(const TheKeyType& theKey)
+  {
+    const int aSlot = this->findSlot(theKey);
+    return aSlot >= 0 ? &this->mySlots[aSlot].Item : nullptr;
+  }
+
+  //! ChangeFind returns modifiable Item by Key. Raises if Key was not bound
+  TheItemType& ChangeFind(const TheKeyType& theKey)
+  {
+    const int aSlot = this->findSlot(theKey);
+    if (aSlot < 0)
+    {
+      throw Standard_NoSuchObject("NCollection_FlatDataMap::Find");
+    }
+    return this->mySlots[aSlot].Item;
+  }
+
+  //! operator ()
+  TheItemType& operator()(const TheKeyType& theKey) { return ChangeFind(theKey); }
+};
+
+#endif // NCollection_FlatDataMap_HeaderFile
@@ -0,0 +1,450 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef NCollection_FlatHashTable_HeaderFile
+#define NCollection_FlatHashTable_HeaderFile
+
+#include <Standard.hxx>
+#include <Standard_NoSuchObject.hxx>
+
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  #include <emmintrin.h>
+  #define NCollection_FlatHashTable_SSE2
+#endif
+#if defined(_MSC_VER)
+  #include <intrin.h>
+#endif
+
+//! Slot of NCollection_FlatMap.
+template <class TheKeyType>
+struct NCollection_FlatKeySlot
+{
+  TheKeyType Key;
+};
+
+//! Slot of NCollection_FlatDataMap.
+template <class TheKeyType, class TheItemType>
+struct NCollection_FlatKeyItemSlot
+{
+  TheKeyType  Key;
+  TheItemType Item;
+};
+
+/**
+ * Purpose:     Base class of hash tables with open addressing
+ *              (NCollection_FlatMap, NCollection_FlatDataMap).
+ *
+ *              Slots holding the keys (and items) are stored in
+ *              a single array, so that a lookup does not follow
+ *              pointers and adding a key does not allocate a node.
+ *              Each slot has a control byte, which is either empty,
+ *              deleted or keeps 7 bits of the hash code of the key.
+ *              Lookup compares control bytes of a group of 16 slots
+ *              at once (with SSE2 instructions when available),
+ *              and compares keys only within the slots which control
+ *              bytes match the hash code.
+ *
+ *              The number of slots is a power of 2; the table is
+ *              enlarged when it becomes filled by 7/8.
+ *
+ *              Adding or removing keys invalidates the references
+ *              to the keys and items of the table and its iterators.
+ *
+ *              TheSlotType should define the member Key.
+ */
+template <class TheSlotType, class TheKeyType, class Hasher>
+class NCollection_FlatHashTable
+{
+public:
+  //! STL-compliant typedef for key type
+  typedef TheKeyType key_type;
+  typedef Hasher     hasher;
+
+public:
+  //! Returns number of keys in the table.
+  int Extent() const noexcept { return mySize; }
+
+  //! Returns number of keys in the table.
+  int Size() const noexcept { return mySize; }
+
+  //! Returns TRUE if the table is empty.
+  bool IsEmpty() const noexcept { return mySize == 0; }
+
+  //! Returns number of slots in the table.
+  int NbBuckets() const noexcept { return myCapacity; }
+
+  //! Returns TRUE if the key is in the table.
+  bool Contains(const TheKeyType& theKey) const { return findSlot(theKey) >= 0; }
+
+  //! Prepares the table to hold the given number of keys without enlargement.
+  void ReSize(const int theNbKeys)
+  {
+    if (theNbKeys > mySize && capacityFor(theNbKeys) > myCapacity)
+    {
+      rehash(capacityFor(theNbKeys));
+    }
+  }
+
+  //! Removes all keys.
+  //! @param theToReleaseMemory if TRUE, the memory of slots is released as well
+  void Clear(const bool theToReleaseMemory = false)
+  {
+    destroySlots();
+    if (theToReleaseMemory)
+    {
+      release();
+    }
+    else if (myCapacity > 0)
+    {
+      std::memset(myCtrl, THE_CTRL_EMPTY, myCapacity + THE_GROUP_WIDTH);
+    }
+    mySize      = 0;
+    myNbDeleted = 0;
+  }
+
+  //! Exchanges the content of two tables without re-allocations.
+  void Exchange(NCollection_FlatHashTable& theOther) noexcept
+  {
+    std::swap(myCtrl, theOther.myCtrl);
+    std::swap(mySlots, theOther.mySlots);
+    std::swap(myCapacity, theOther.myCapacity);
+    std::swap(mySize, theOther.mySize);
+    std::swap(myNbDeleted, theOther.myNbDeleted);
+    std::swap(myHasher, theOther.myHasher);
+  }
+
+protected:
+  //! Number of control bytes compared at once.
+  static constexpr int THE_GROUP_WIDTH = 16;
+
+  //! Control byte of an empty slot.
+  static constexpr int8_t THE_CTRL_EMPTY = -128;
+
+  //! Control byte of a slot which key has been removed.
+  static constexpr int8_t THE_CTRL_DELETED = -2;
+
+  //! Group of control bytes starting from the given slot.
+  class Group
+  {
+  public:
+    //! Loads control bytes.
+    explicit Group(const int8_t* theCtrl) noexcept
+    {
+#ifdef NCollection_FlatHashTable_SSE2
+      myCtrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(theCtrl));
+#else
+      std::memcpy(myCtrl, theCtrl, THE_GROUP_WIDTH);
+#endif
+    }
+
+    //! Returns mask of slots with the control byte equal to the given one.
+    uint32_t Match(const int8_t theByte) const noexcept
+    {
+#ifdef NCollection_FlatHashTable_SSE2
+      return uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(theByte), myCtrl)));
+#else
+      uint32_t aMask = 0;
+      for (int aByteIter = 0; aByteIter < THE_GROUP_WIDTH; ++aByteIter)
+      {
+        aMask |= uint32_t(myCtrl[aByteIter] == theByte) << aByteIter;
+      }
+      return aMask;
+#endif
+    }
+
+    //! Returns mask of empty slots.
+    uint32_t MatchEmpty() const noexcept { return Match(THE_CTRL_EMPTY); }
+
+    //! Returns mask of empty or deleted slots (having negative control bytes).
+    uint32_t MatchFree() const noexcept
+    {
+#ifdef NCollection_FlatHashTable_SSE2
+      return uint32_t(_mm_movemask_epi8(myCtrl));
+#else
+      uint32_t aMask = 0;
+      for (int aByteIter = 0; aByteIter < THE_GROUP_WIDTH; ++aByteIter)
+      {
+        aMask |= uint32_t(myCtrl[aByteIter] < 0) << aByteIter;
+      }
+      return aMask;
+#endif
+    }
+
+  private:
+#ifdef NCollection_FlatHashTable_SSE2
+    __m128i myCtrl;
+#else
+    int8_t myCtrl[THE_GROUP_WIDTH];
+#endif
+  };
+
+  //! Returns index of the lowest set bit of non-zero mask.
+  static int lowestBit(const uint32_t theMask) noexcept
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctz(theMask);
+#elif defined(_MSC_VER)
+    unsigned long anIndex = 0;
+    _BitScanForward(&anIndex, theMask);
+    return int(anIndex);
+#else
+    int anIndex = 0;
+    for (uint32_t aMask = theMask; (aMask & 1u) == 0; aMask >>= 1)
+    {
+      ++anIndex;
+    }
+    return anIndex;
+#endif
+  }
+
+protected:
+  //! Empty constructor.
+  NCollection_FlatHashTable() noexcept
+      : myCtrl(nullptr),
+        mySlots(nullptr),
+        myCapacity(0),
+        mySize(0),
+        myNbDeleted(0)
+  {
+  }
+
+  //! Move constructor.
+  NCollection_FlatHashTable(NCollection_FlatHashTable&& theOther) noexcept
+      : NCollection_FlatHashTable()
+  {
+    Exchange(theOther);
+  }
+
+  //! Destructor.
+  ~NCollection_FlatHashTable()
+  {
+    destroySlots();
+    release();
+  }
+
+  //! Returns the hash code of the key spread over all bits.
+  size_t hashCode(const TheKeyType& theKey) const
+  {
+    // hashers often return pointers or small integers, so that the bits should be mixed
+    const uint64_t aHash = uint64_t(myHasher(theKey)) * 0x9E3779B97F4A7C15ull;
+    return size_t(aHash ^ (aHash >> 32));
+  }
+
+  //! Returns index of the slot holding the key, or -1.
+  int findSlot(const TheKeyType& theKey) const
+  {
+    return myCapacity > 0 ? findSlot(theKey, hashCode(theKey)) : -1;
+  }
+
+  //! Returns index of the slot holding the key with the given hash code, or -1.
+  int findSlot(const TheKeyType& theKey, const size_t theHash) const
+  {
+    const int8_t aByte = int8_t(theHash & 0x7F);
+    const size_t aMask = size_t(myCapacity - 1);
+    size_t       aPos  = (theHash >> 7) & aMask;
+    for (size_t aStep = THE_GROUP_WIDTH;; aStep += THE_GROUP_WIDTH)
+    {
+      const Group aGroup(myCtrl + aPos);
+      for (uint32_t aMatch = aGroup.Match(aByte); aMatch != 0; aMatch &= aMatch - 1)
+      {
+        const int aSlot = int((aPos + lowestBit(aMatch)) & aMask);
+        if (myHasher(mySlots[aSlot].Key, theKey))
+        {
+          return aSlot;
+        }
+      }
+      if (aGroup.MatchEmpty() != 0)
+      {
+        return -1;
+      }
+      aPos = (aPos + aStep) & aMask;
+    }
+  }
+
+  //! Finds the slot holding the key or reserves a free slot for it.
+  //! @param[in]  theKey    the key to find
+  //! @param[out] theIsNew  TRUE if the slot has been reserved and the key should be
+  //!                       constructed in it by the caller
+  //! @return index of the slot
+  int findOrReserveSlot(const TheKeyType& theKey, bool& theIsNew)
+  {
+    if (myCapacity == 0)
+    {
+      rehash(THE_GROUP_WIDTH);
+    }
+
+    const size_t aHash = hashCode(theKey);
+    const int    aSlot = findSlot(theKey, aHash);
+    if (aSlot >= 0)
+    {
+      theIsNew = false;
+      return aSlot;
+    }
+
+    const int aMaxLoad = myCapacity - myCapacity / 8;
+    if (mySize + myNbDeleted + 1 > aMaxLoad)
+    {
+      // enlarge the table, or just drop deleted slots if they take a lot of space
+      rehash(mySize + 1 > aMaxLoad / 2 ? 2 * myCapacity : myCapacity);
+    }
+
+    const int aFree = findFreeSlot(aHash);
+    if (myCtrl[aFree] == THE_CTRL_DELETED)
+    {
+      --myNbDeleted;
+    }
+    setCtrl(aFree, int8_t(aHash & 0x7F));
+    ++mySize;
+    theIsNew = true;
+    return aFree;
+  }
+
+  //! Destroys the content of the slot and marks it deleted.
+  void eraseSlot(const int theSlot)
+  {
+    mySlots[theSlot].~TheSlotType();
+    setCtrl(theSlot, THE_CTRL_DELETED);
+    --mySize;
+    ++myNbDeleted;
+  }
+
+  //! Returns index of the first slot with a key starting from the given one, or capacity.
+  int nextSlot(int theSlot) const noexcept
+  {
+    while (theSlot < myCapacity && myCtrl[theSlot] < 0)
+    {
+      ++theSlot;
+    }
+    return theSlot;
+  }
+
+  //! Copies the keys of another table.
+  void assign(const NCollection_FlatHashTable& theOther)
+  {
+    Clear();
+    ReSize(theOther.mySize);
+    for (int aSlot = theOther.nextSlot(0); aSlot < theOther.myCapacity;
+         aSlot     = theOther.nextSlot(aSlot + 1))
+    {
+      bool      isNew    = false;
+      const int aNewSlot = findOrReserveSlot(theOther.mySlots[aSlot].Key, isNew);
+      new (&mySlots[aNewSlot]) TheSlotType(theOther.mySlots[aSlot]);
+    }
+  }
+
+private:
+  //! Returns the number of slots to hold the given number of keys.
+  static int capacityFor(const int theNbKeys) noexcept
+  {
+    int aCapacity = THE_GROUP_WIDTH;
+    while (aCapacity - aCapacity / 8 < theNbKeys)
+    {
+      aCapacity *= 2;
+    }
+    return aCapacity;
+  }
+
+  //! Returns index of the first empty or deleted slot in the probe sequence of the hash code.
+  int findFreeSlot(const size_t theHash) const noexcept
+  {
+    const size_t aMask = size_t(myCapacity - 1);
+    size_t       aPos  = (theHash >> 7) & aMask;
+    for (size_t aStep = THE_GROUP_WIDTH;; aStep += THE_GROUP_WIDTH)
+    {
+      const uint32_t aFree = Group(myCtrl + aPos).MatchFree();
+      if (aFree != 0)
+      {
+        return int((aPos + lowestBit(aFree)) & aMask);
+      }
+      aPos = (aPos + aStep) & aMask;
+    }
+  }
+
+  //! Sets the control byte of the slot and its copy following the last slot.
+  void setCtrl(const int theSlot, const int8_t theByte) noexcept
+  {
+    myCtrl[theSlot] = theByte;
+    if (theSlot < THE_GROUP_WIDTH)
+    {
+      myCtrl[myCapacity + theSlot] = theByte;
+    }
+  }
+
+  //! Moves the keys to a new array of slots.
+  void rehash(const int theCapacity)
+  {
+    int8_t*      anOldCtrl     = myCtrl;
+    TheSlotType* anOldSlots    = mySlots;
+    const int    anOldCapacity = myCapacity;
+
+    // the control bytes of the first group are repeated after the last slot,
+    // so that a group starting at any slot can be loaded at once
+    myCtrl = static_cast<int8_t*>(Standard::Allocate(theCapacity + THE_GROUP_WIDTH));
+    mySlots =
+      static_cast<TheSlotType*>(Standard::AllocateOptimal(sizeof(TheSlotType) * theCapacity));
+    myCapacity  = theCapacity;
+    myNbDeleted = 0;
+    std::memset(myCtrl, THE_CTRL_EMPTY, theCapacity + THE_GROUP_WIDTH);
+    for (int aSlot = 0; aSlot < anOldCapacity; ++aSlot)
+    {
+      if (anOldCtrl[aSlot] >= 0)
+      {
+        const size_t aHash    = hashCode(anOldSlots[aSlot].Key);
+        const int    aNewSlot = findFreeSlot(aHash);
+        setCtrl(aNewSlot, int8_t(aHash & 0x7F));
+        new (&mySlots[aNewSlot]) TheSlotType(std::move(anOldSlots[aSlot]));
+        anOldSlots[aSlot].~TheSlotType();
+      }
+    }
+    Standard::Free(anOldCtrl);
+    Standard::Free(anOldSlots);
+  }
+
+  //! Destroys content of all slots.
+  void destroySlots()
+  {
+    for (int aSlot = nextSlot(0); aSlot < myCapacity; aSlot = nextSlot(aSlot + 1))
+    {
+      mySlots[aSlot].~TheSlotType();
+    }
+  }
+
+  //! Releases the memory.
+  void release()
+  {
+    Standard::Free(myCtrl);
+    Standard::Free(mySlots);
+    myCtrl     = nullptr;
+    mySlots    = nullptr;
+    myCapacity = 0;
+  }
+
+private:
+  NCollection_FlatHashTable(const NCollection_FlatHashTable&)            = delete;
+  NCollection_FlatHashTable& operator=(const NCollection_FlatHashTable&) = delete;
+
+protected:
+  int8_t*      myCtrl;      //!< control bytes of slots followed by copy of the first group
+  TheSlotType* mySlots;     //!< array of slots
+  int          myCapacity;  //!< number of slots (power of 2)
+  int          mySize;      //!< number of keys
+  int          myNbDeleted; //!< number of deleted slots
+  Hasher       myHasher;    //!< hasher
+};
+
+#endif // NCollection_FlatHashTable_HeaderFile
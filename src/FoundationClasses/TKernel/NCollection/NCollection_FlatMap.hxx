@@ -0,0 +1,205 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef NCollection_FlatMap_HeaderFile
+#define NCollection_FlatMap_HeaderFile
+
+#include <NCollection_DefaultHasher.hxx>
+#include <NCollection_FlatHashTable.hxx>
+#include <NCollection_StlIterator.hxx>
+
+/**
+ * Purpose:     Single hashed Map with open addressing.
+ *
+ *              Has the same interface as NCollection_Map (except
+ *              for allocators and set operations) and uses the
+ *              same hashers, but keeps the keys in a flat array
+ *              (see NCollection_FlatHashTable) instead of nodes,
+ *              which makes it faster and more compact for small
+ *              keys such as integers, pointers or shapes.
+ *
+ *              Unlike NCollection_Map, adding a key may move the
+ *              other keys, so that references to the keys remain
+ *              valid only until the next modification of the map.
+ */
+template <class TheKeyType, class Hasher = NCollection_DefaultHasher<TheKeyType>>
+class NCollection_FlatMap
+    : public NCollection_FlatHashTable<NCollection_FlatKeySlot<TheKeyType>, TheKeyType, Hasher>
+{
+  typedef NCollection_FlatKeySlot<TheKeyType>                 Slot;
+  typedef NCollection_FlatHashTable<Slot, TheKeyType, Hasher> base_type;
+
+public:
+  //! Implementation of the Iterator interface.
+  class Iterator
+  {
+  public:
+    //! Empty constructor
+    Iterator() noexcept
+        : myMap(nullptr),
+          mySlot(0)
+    {
+    }
+
+    //! Constructor
+    Iterator(const NCollection_FlatMap& theMap) noexcept
+        : myMap(&theMap),
+          mySlot(theMap.nextSlot(0))
+    {
+    }
+
+    //! Query if the end of collection is reached by iterator
+    bool More() const noexcept { return myMap != nullptr && mySlot < myMap->myCapacity; }
+
+    //! Make a step along the collection
+    void Next() noexcept { mySlot = myMap->nextSlot(mySlot + 1); }
+
+    //! Value inquiry
+    const TheKeyType& Value() const
+    {
+      Standard_NoSuchObject_Raise_if(!More(), "NCollection_FlatMap::Iterator::Value");
+      return myMap->mySlots[mySlot].Key;
+    }
+
+    //! Key
+    const TheKeyType& Key() const
+    {
+      Standard_NoSuchObject_Raise_if(!More(), "NCollection_FlatMap::Iterator::Key");
+      return myMap->mySlots[mySlot].Key;
+    }
+
+    //! Performs comparison of two iterators.
+    bool IsEqual(const Iterator& theOther) const noexcept
+    {
+      return myMap == theOther.myMap && mySlot == theOther.mySlot;
+    }
+
+  private:
+    const NCollection_FlatMap* myMap;
+    int                        mySlot;
+  };
+
+  //! Shorthand for a constant iterator type.
+  typedef NCollection_StlIterator<std::forward_iterator_tag, Iterator, TheKeyType, true>
+    const_iterator;
+
+  //! Returns a const iterator pointing to the first element in the map.
+  const_iterator cbegin() const noexcept { return Iterator(*this); }
+
+  //! Returns a const iterator referring to the past-the-end element in the map.
+  const_iterator cend() const noexcept { return Iterator(); }
+
+public:
+  //! Empty constructor.
+  NCollection_FlatMap() noexcept {}
+
+  //! Constructor preparing the map to hold the given number of keys.
+  explicit NCollection_FlatMap(const int theNbKeys) { this->ReSize(theNbKeys); }
+
+  //! Copy constructor
+  NCollection_FlatMap(const NCollection_FlatMap& theOther) { this->assign(theOther); }
+
+  //! Move constructor
+  NCollection_FlatMap(NCollection_FlatMap&& theOther) noexcept
+      : base_type(std::move(theOther))
+  {
+  }
+
+  //! Exchange the content of two maps without re-allocations.
+  void Exchange(NCollection_FlatMap& theOther) noexcept { base_type::Exchange(theOther); }
+
+  //! Assign.
+  NCollection_FlatMap& Assign(const NCollection_FlatMap& theOther)
+  {
+    if (this != &theOther)
+    {
+      this->assign(theOther);
+    }
+    return *this;
+  }
+
+  //! Assign operator
+  NCollection_FlatMap& operator=(const NCollection_FlatMap& theOther) { return Assign(theOther); }
+
+  //! Move operator
+  NCollection_FlatMap& operator=(NCollection_FlatMap&& theOther) noexcept
+  {
+    if (this != &theOther)
+    {
+      this->Clear(true);
+      Exchange(theOther);
+    }
+    return *this;
+  }
+
+  //! Add
+  //! @return true if the key was not in the map
+  bool Add(const TheKeyType& theKey)
+  {
+    bool      isNew = false;
+    const int aSlot = this->findOrReserveSlot(theKey, isNew);
+    if (isNew)
+    {
+      new (&this->mySlots[aSlot]) Slot{theKey};
+    }
+    return isNew;
+  }
+
+  //! Add
+  //! @return true if the key was not in the map
+  bool Add(TheKeyType&& theKey)
+  {
+    bool      isNew = false;
+    const int aSlot = this->findOrReserveSlot(theKey, isNew);
+    if (isNew)
+    {
+      new (&this->mySlots[aSlot]) Slot{std::move(theKey)};
+    }
+    return isNew;
+  }
+
+  //! Added: add a new key if not yet in the map, and return
+  //! reference to either newly added or previously existing object
+  const TheKeyType& Added(const TheKeyType& theKey)
+  {
+    bool      isNew = false;
+    const int aSlot = this->findOrReserveSlot(theKey, isNew);
+    if (isNew)
+    {
+      new (&this->mySlots[aSlot]) Slot{theKey};
+    }
+    return this->mySlots[aSlot].Key;
+  }
+
+  //! Remove
+  //! @return true if the key was in the map
+  bool Remove(const TheKeyType& theKey)
+  {
+    const int aSlot = this->findSlot(theKey);
+    if (aSlot < 0)
+    {
+      return false;
+    }
+    this->eraseSlot(aSlot);
+    return true;
+  }
+
+  //! Returns pointer to the key in the map, or NULL if the key is not in the map.
+  const TheKeyType* Seek(const TheKeyType& theKey) const
+  {
+    const int aSlot = this->findSlot(theKey);
+    return aSlot >= 0 ? &this->mySlots[aSlot].Key : nullptr;
+  }
+};
+
+#endif // NCollection_FlatMap_HeaderFile
@@ -13,6 +13,7 @@
 
 #include <NCollection_IncAllocator.hxx>
 
+#include <OSD_MemInfo.hxx>
 #include <Standard_OutOfMemory.hxx>
 
 #include <cmath>
@@ -82,6 +83,22 @@ void NCollection_IncAllocator::SetThreadSafe(const bool theIsThreadSafe)
 
 //=================================================================================================
 
+void NCollection_IncAllocator::SetMemTag(const int theTag)
+{
+  std::unique_lock<std::mutex> aLock =
+    myMutex ? std::unique_lock<std::mutex>(*myMutex) : std::unique_lock<std::mutex>();
+  if (theTag == myMemTag)
+  {
+    return;
+  }
+
+  OSD_MemInfo::AddTaggedMemory(myMemTag, -int64_t(myTotalSize));
+  OSD_MemInfo::AddTaggedMemory(theTag, int64_t(myTotalSize));
+  myMemTag = theTag;
+}
+
+//=================================================================================================
+
 NCollection_IncAllocator::~NCollection_IncAllocator()
 {
   clean();
@@ -111,6 +128,11 @@ void* NCollection_IncAllocator::AllocateOptimal(const size_t theSize)
       myBlockSize = static_cast<unsigned>(theSize);
     }
     void* aBufferBlock       = Standard::AllocateOptimal(myBlockSize + sizeof(IBlock));
+    myTotalSize += myBlockSize + sizeof(IBlock);
+    if (myMemTag != 0)
+    {
+      OSD_MemInfo::AddTaggedMemory(myMemTag, int64_t(myBlockSize + sizeof(IBlock)));
+    }
     aBlock                   = new (aBufferBlock) IBlock(aBufferBlock, myBlockSize);
     aBlock->NextBlock        = myAllocationHeap;
     aBlock->NextOrderedBlock = myOrderedBlocks;
@@ -171,9 +193,14 @@ void NCollection_IncAllocator::clean()
     aHeapIter    = aHeapIter->NextOrderedBlock;
     Standard::Free(aCur);
   }
+  if (myMemTag != 0)
+  {
+    OSD_MemInfo::AddTaggedMemory(myMemTag, -int64_t(myTotalSize));
+  }
   myOrderedBlocks  = nullptr;
   myAllocationHeap = nullptr;
   myUsedHeap       = nullptr;
+  myTotalSize      = 0;
   myBlockCount     = 0;
   myBlockSize      = THE_DEFAULT_BLOCK_SIZE;
 }
@@ -75,6 +75,10 @@ public:
     // Do nothing
   }
 
+  //! Sets the tag of memory accounting; the memory blocks already allocated
+  //! are moved from the previous tag to the new one.
+  Standard_EXPORT void SetMemTag(const int theTag) override;
+
   //! Destructor (calls Clean() internally)
   Standard_EXPORT ~NCollection_IncAllocator() override;
 
@@ -138,6 +142,7 @@ private:
   IBlock*                     myAllocationHeap = nullptr; //!< Sorted list for allocations
   IBlock*                     myUsedHeap       = nullptr; //!< Sorted list for store empty blocks
   IBlock* myOrderedBlocks = nullptr; //!< Ordered list for store growing size blocks
+  size_t  myTotalSize     = 0;       //!< Total size of allocated blocks
 
 public:
   // Declaration of CASCADE RTTI
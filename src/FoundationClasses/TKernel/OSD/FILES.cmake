@@ -85,6 +85,8 @@ set(OCCT_OSD_FILES
   OSD_SingleProtection.hxx
   OSD_StreamBuffer.hxx
   OSD_SysType.hxx
+  OSD_TaskScheduler.cxx
+  OSD_TaskScheduler.hxx
   OSD_Thread.cxx
   OSD_Thread.hxx
   OSD_ThreadPool.cxx
@@ -92,6 +94,9 @@ set(OCCT_OSD_FILES
   OSD_ThreadFunction.hxx
   OSD_Timer.cxx
   OSD_Timer.hxx
+  OSD_TraceZone.hxx
+  OSD_Tracer.cxx
+  OSD_Tracer.hxx
   OSD_WhoAmI.hxx
   OSD_WNT.cxx
   OSD_WNT.hxx
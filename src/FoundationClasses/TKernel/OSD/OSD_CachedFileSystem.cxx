@@ -16,6 +16,28 @@
 
 IMPLEMENT_STANDARD_RTTIEXT(OSD_CachedFileSystem, OSD_FileSystem)
 
+namespace
+{
+//! Buffer pointing to the part of another buffer, which is kept alive.
+class OSD_SubBuffer : public NCollection_Buffer
+{
+public:
+  //! Constructor.
+  OSD_SubBuffer(const occ::handle<NCollection_Buffer>& theParent,
+                const size_t                           theOffset,
+                const size_t                           theSize)
+      : NCollection_Buffer(occ::handle<NCollection_BaseAllocator>(),
+                           theSize,
+                           theParent->ChangeData() + theOffset),
+        myParent(theParent)
+  {
+  }
+
+private:
+  occ::handle<NCollection_Buffer> myParent; //!< buffer holding the data
+};
+} // namespace
+
 //=================================================================================================
 
 OSD_CachedFileSystem::OSD_CachedFileSystem(const occ::handle<OSD_FileSystem>& theLinkedFileSystem)
@@ -92,3 +114,30 @@ std::shared_ptr<std::streambuf> OSD_CachedFileSystem::OpenStreamBuffer(
   myStream.StreamBuf = myLinkedFS->OpenStreamBuffer(theUrl, theMode, theOffset, theOutBufSize);
   return myStream.StreamBuf;
 }
+
+//=================================================================================================
+
+occ::handle<NCollection_Buffer> OSD_CachedFileSystem::OpenMappedBuffer(
+  const TCollection_AsciiString& theUrl,
+  const int64_t                  theOffset,
+  const int64_t                  theLength)
+{
+  if (myMappedUrl != theUrl)
+  {
+    myMappedUrl  = theUrl;
+    myMappedFile = myLinkedFS->OpenMappedBuffer(theUrl);
+  }
+  if (myMappedFile.IsNull())
+  {
+    // the whole file cannot be mapped (e.g. lack of address space), try the region only
+    return myLinkedFS->OpenMappedBuffer(theUrl, theOffset, theLength);
+  }
+
+  const int64_t aFileSize = (int64_t)myMappedFile->Size();
+  const int64_t aLength   = theLength < 0 ? aFileSize - theOffset : theLength;
+  if (theOffset < 0 || aLength <= 0 || theOffset + aLength > aFileSize)
+  {
+    return occ::handle<NCollection_Buffer>();
+  }
+  return new OSD_SubBuffer(myMappedFile, size_t(theOffset), size_t(aLength));
+}
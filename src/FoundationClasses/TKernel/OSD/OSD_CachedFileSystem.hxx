@@ -69,6 +69,14 @@ public:
     const int64_t                  theOffset     = 0,
     int64_t*                       theOutBufSize = nullptr) override;
 
+  //! Maps the region of specified file URL into memory.
+  //! The whole file is mapped by linked file system and kept mapped for the last URL,
+  //! so that the returned buffers are views to this mapping.
+  Standard_EXPORT occ::handle<NCollection_Buffer> OpenMappedBuffer(
+    const TCollection_AsciiString& theUrl,
+    const int64_t                  theOffset = 0,
+    const int64_t                  theLength = -1) override;
+
 protected:
   // Auxiliary structure to save shared stream with path to it.
   struct OSD_CachedStream
@@ -85,8 +93,10 @@ protected:
   };
 
 protected:
-  OSD_CachedStream            myStream;   //!< active cached stream
-  occ::handle<OSD_FileSystem> myLinkedFS; //!< linked file system to open files
+  OSD_CachedStream                myStream;     //!< active cached stream
+  TCollection_AsciiString         myMappedUrl;  //!< URL of the mapped file
+  occ::handle<NCollection_Buffer> myMappedFile; //!< whole mapped file
+  occ::handle<OSD_FileSystem>     myLinkedFS;   //!< linked file system to open files
 };
 
 #endif // _OSD_CachedFileSystem_HeaderFile
@@ -122,3 +122,12 @@ std::shared_ptr<std::ostream> OSD_FileSystem::OpenOStream(const TCollection_Asci
   aNewStream.reset(new OSD_OStreamBuffer(theUrl.ToCString(), aFileBuf));
   return aNewStream;
 }
+
+//=================================================================================================
+
+occ::handle<NCollection_Buffer> OSD_FileSystem::OpenMappedBuffer(const TCollection_AsciiString&,
+                                                                 const int64_t,
+                                                                 const int64_t)
+{
+  return occ::handle<NCollection_Buffer>();
+}
@@ -16,6 +16,7 @@
 
 #include <OSD_StreamBuffer.hxx>
 #include <TCollection_AsciiString.hxx>
+#include <NCollection_Buffer.hxx>
 #include <NCollection_DefineAlloc.hxx>
 
 //! Base interface for a file stream provider.
@@ -95,6 +96,19 @@ public:
                                                            const int64_t theOffset = 0,
                                                            int64_t* theOutBufSize  = nullptr) = 0;
 
+  //! Maps the region of specified file URL into memory for reading operations.
+  //! Default implementation returns NULL (mapping is not supported by the protocol),
+  //! so that the file should be read through OpenIStream() instead.
+  //! @param[in] theUrl     path to open
+  //! @param[in] theOffset  offset of the region from the beginning of the file
+  //! @param[in] theLength  length of the region in bytes, -1 means up to the end of the file
+  //! @return buffer pointing to the mapped region (unmapped on buffer destruction)
+  //!         or NULL in case of failure
+  Standard_EXPORT virtual occ::handle<NCollection_Buffer> OpenMappedBuffer(
+    const TCollection_AsciiString& theUrl,
+    const int64_t                  theOffset = 0,
+    const int64_t                  theLength = -1);
+
   //! Constructor.
   Standard_EXPORT OSD_FileSystem();
 
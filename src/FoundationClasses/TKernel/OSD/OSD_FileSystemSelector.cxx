@@ -180,3 +180,28 @@ std::shared_ptr<std::streambuf> OSD_FileSystemSelector::OpenStreamBuffer(
   }
   return std::shared_ptr<std::streambuf>();
 }
+
+//=================================================================================================
+
+occ::handle<NCollection_Buffer> OSD_FileSystemSelector::OpenMappedBuffer(
+  const TCollection_AsciiString& theUrl,
+  const int64_t                  theOffset,
+  const int64_t                  theLength)
+{
+  for (NCollection_List<occ::handle<OSD_FileSystem>>::Iterator aProtIter(myProtocols);
+       aProtIter.More();
+       aProtIter.Next())
+  {
+    const occ::handle<OSD_FileSystem>& aFileSystem = aProtIter.Value();
+    if (aFileSystem->IsSupportedPath(theUrl))
+    {
+      occ::handle<NCollection_Buffer> aBuffer =
+        aFileSystem->OpenMappedBuffer(theUrl, theOffset, theLength);
+      if (!aBuffer.IsNull())
+      {
+        return aBuffer;
+      }
+    }
+  }
+  return occ::handle<NCollection_Buffer>();
+}
@@ -65,6 +65,12 @@ public:
     const int64_t                  theOffset     = 0,
     int64_t*                       theOutBufSize = nullptr) override;
 
+  //! Maps the file region using one of registered protocols.
+  Standard_EXPORT occ::handle<NCollection_Buffer> OpenMappedBuffer(
+    const TCollection_AsciiString& theUrl,
+    const int64_t                  theOffset = 0,
+    const int64_t                  theLength = -1) override;
+
 protected:
   NCollection_List<occ::handle<OSD_FileSystem>> myProtocols;
 };
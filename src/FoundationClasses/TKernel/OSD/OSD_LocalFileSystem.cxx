@@ -15,9 +15,57 @@
 #include <OSD_OpenFile.hxx>
 #include <OSD_Path.hxx>
 #include <Standard_Assert.hxx>
+#include <TCollection_ExtendedString.hxx>
+
+#ifdef _WIN32
+  #include <windows.h>
+#else
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
 
 IMPLEMENT_STANDARD_RTTIEXT(OSD_LocalFileSystem, OSD_FileSystem)
 
+namespace
+{
+//! Buffer pointing to the region of the file mapped into memory.
+//! The view is unmapped on destruction.
+class OSD_MappedFileBuffer : public NCollection_Buffer
+{
+public:
+  //! Constructor.
+  //! @param[in] theView      start of the mapped view
+  //! @param[in] theViewSize  size of the mapped view
+  //! @param[in] theShift     shift of the requested region within the view
+  //! @param[in] theSize      size of the requested region
+  OSD_MappedFileBuffer(void* theView, size_t theViewSize, size_t theShift, size_t theSize)
+      : NCollection_Buffer(occ::handle<NCollection_BaseAllocator>(),
+                           theSize,
+                           static_cast<uint8_t*>(theView) + theShift),
+        myView(theView),
+        myViewSize(theViewSize)
+  {
+  }
+
+  //! Destructor.
+  ~OSD_MappedFileBuffer() override
+  {
+#ifdef _WIN32
+    (void)myViewSize;
+    UnmapViewOfFile(myView);
+#else
+    munmap(myView, myViewSize);
+#endif
+  }
+
+private:
+  void*  myView;     //!< start of the mapped view
+  size_t myViewSize; //!< size of the mapped view
+};
+} // namespace
+
 //=================================================================================================
 
 bool OSD_LocalFileSystem::IsSupportedPath(const TCollection_AsciiString& theUrl) const
@@ -89,3 +137,94 @@ std::shared_ptr<std::streambuf> OSD_LocalFileSystem::OpenStreamBuffer(
   }
   return aNewBuf;
 }
+
+//=================================================================================================
+
+occ::handle<NCollection_Buffer> OSD_LocalFileSystem::OpenMappedBuffer(
+  const TCollection_AsciiString& theUrl,
+  const int64_t                  theOffset,
+  const int64_t                  theLength)
+{
+  if (theOffset < 0 || theLength == 0)
+  {
+    return occ::handle<NCollection_Buffer>();
+  }
+
+  // the view should start at the boundary defined by the system
+  int64_t aFileSize  = 0;
+  int64_t aViewStart = 0;
+  int64_t aViewSize  = 0;
+  void*   aView      = nullptr;
+#ifdef _WIN32
+  SYSTEM_INFO aSysInfo;
+  GetSystemInfo(&aSysInfo);
+  const int64_t                    aGranularity = (int64_t)aSysInfo.dwAllocationGranularity;
+  const TCollection_ExtendedString aPath(theUrl);
+  HANDLE                           aFile = CreateFileW(aPath.ToWideString(),
+                             GENERIC_READ,
+                             FILE_SHARE_READ,
+                             NULL,
+                             OPEN_EXISTING,
+                             FILE_ATTRIBUTE_NORMAL,
+                             NULL);
+  if (aFile == INVALID_HANDLE_VALUE)
+  {
+    return occ::handle<NCollection_Buffer>();
+  }
+  LARGE_INTEGER aSize;
+  if (GetFileSizeEx(aFile, &aSize))
+  {
+    aFileSize = (int64_t)aSize.QuadPart;
+  }
+  const int64_t anEnd = theLength < 0 ? aFileSize : theOffset + theLength;
+  if (theOffset < anEnd && anEnd <= aFileSize)
+  {
+    aViewStart = theOffset - theOffset % aGranularity;
+    aViewSize  = anEnd - aViewStart;
+
+    HANDLE aMapping = CreateFileMappingW(aFile, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (aMapping != NULL)
+    {
+      aView = MapViewOfFile(aMapping,
+                            FILE_MAP_READ,
+                            DWORD(uint64_t(aViewStart) >> 32),
+                            DWORD(uint64_t(aViewStart) & 0xFFFFFFFF),
+                            SIZE_T(aViewSize));
+      CloseHandle(aMapping);
+    }
+  }
+  CloseHandle(aFile);
+#else
+  const int64_t aGranularity = (int64_t)sysconf(_SC_PAGESIZE);
+  const int     aFile        = open(theUrl.ToCString(), O_RDONLY);
+  if (aFile < 0)
+  {
+    return occ::handle<NCollection_Buffer>();
+  }
+  struct stat aStat;
+  if (fstat(aFile, &aStat) == 0 && S_ISREG(aStat.st_mode))
+  {
+    aFileSize = (int64_t)aStat.st_size;
+  }
+  const int64_t anEnd = theLength < 0 ? aFileSize : theOffset + theLength;
+  if (theOffset < anEnd && anEnd <= aFileSize)
+  {
+    aViewStart = theOffset - theOffset % aGranularity;
+    aViewSize  = anEnd - aViewStart;
+    aView = mmap(nullptr, size_t(aViewSize), PROT_READ, MAP_PRIVATE, aFile, off_t(aViewStart));
+    if (aView == MAP_FAILED)
+    {
+      aView = nullptr;
+    }
+  }
+  close(aFile);
+#endif
+  if (aView == nullptr)
+  {
+    return occ::handle<NCollection_Buffer>();
+  }
+  return new OSD_MappedFileBuffer(aView,
+                                  size_t(aViewSize),
+                                  size_t(theOffset - aViewStart),
+                                  size_t(aViewSize - (theOffset - aViewStart)));
+}
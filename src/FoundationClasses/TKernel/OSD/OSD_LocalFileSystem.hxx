@@ -39,5 +39,11 @@ public:
     const std::ios_base::openmode  theMode,
     const int64_t                  theOffset     = 0,
     int64_t*                       theOutBufSize = nullptr) override;
+
+  //! Maps the region of specified file into memory (mmap() or MapViewOfFile()).
+  Standard_EXPORT occ::handle<NCollection_Buffer> OpenMappedBuffer(
+    const TCollection_AsciiString& theUrl,
+    const int64_t                  theOffset = 0,
+    const int64_t                  theLength = -1) override;
 };
 #endif // _OSD_LocalFileSystem_HeaderFile
@@ -32,6 +32,10 @@
 #endif
 
 #include <OSD_MemInfo.hxx>
+#include <Standard_MMgrThreadCache.hxx>
+
+#include <atomic>
+#include <mutex>
 
 #if defined(__EMSCRIPTEN__)
   #include <emscripten.h>
@@ -40,6 +44,48 @@
 EM_JS(double, OSD_MemInfo_getModuleHeapLength, (), { return Module.HEAP8.length; });
 #endif
 
+namespace
+{
+//! Global registry of memory accounted per tag.
+struct MemTagRegistry
+{
+  std::atomic<int64_t>    Live[OSD_MemInfo::THE_MAX_MEM_TAGS];
+  std::atomic<int64_t>    Peak[OSD_MemInfo::THE_MAX_MEM_TAGS];
+  TCollection_AsciiString Names[OSD_MemInfo::THE_MAX_MEM_TAGS];
+  std::atomic<int>        NbTags;
+  std::mutex              Mutex; //!< mutex protecting registration of tags
+
+  MemTagRegistry()
+      : NbTags(OSD_MemInfo::MemTag_NB)
+  {
+    for (int aTagIter = 0; aTagIter < OSD_MemInfo::THE_MAX_MEM_TAGS; ++aTagIter)
+    {
+      Live[aTagIter].store(0);
+      Peak[aTagIter].store(0);
+    }
+    Names[OSD_MemInfo::MemTag_Untagged]   = "Untagged";
+    Names[OSD_MemInfo::MemTag_Mesh]       = "Mesh";
+    Names[OSD_MemInfo::MemTag_BOPDS]      = "BOPDS";
+    Names[OSD_MemInfo::MemTag_StepData]   = "StepData";
+    Names[OSD_MemInfo::MemTag_XCAF]       = "XCAF";
+    Names[OSD_MemInfo::MemTag_Select3D]   = "Select3D";
+    Names[OSD_MemInfo::MemTag_GpuBuffers] = "GpuBuffers";
+  }
+
+  static MemTagRegistry& Get()
+  {
+    static MemTagRegistry THE_REGISTRY;
+    return THE_REGISTRY;
+  }
+};
+
+//! Returns true if the tag is registered and accounts memory.
+bool isValidMemTag(const MemTagRegistry& theRegistry, const int theTag)
+{
+  return theTag > OSD_MemInfo::MemTag_Untagged && theTag < theRegistry.NbTags.load();
+}
+} // namespace
+
 //=================================================================================================
 
 OSD_MemInfo::OSD_MemInfo(const bool theImmediateUpdate)
@@ -80,6 +126,19 @@ void OSD_MemInfo::Clear()
 void OSD_MemInfo::Update()
 {
   Clear();
+  if (IsActive(MemThreadUsage) || IsActive(MemThreadCache))
+  {
+    Standard_MMgrThreadCache::ThreadStatistics aStats;
+    const Standard_MMgrThreadCache* aMMgr = Standard_MMgrThreadCache::DefaultManager();
+    if (aMMgr != nullptr && aMMgr->CurrentThreadStatistics(aStats))
+    {
+      // blocks freed by other threads may make freed bytes greater than allocated ones
+      myCounters[MemThreadUsage] =
+        aStats.AllocatedBytes > aStats.FreedBytes ? aStats.AllocatedBytes - aStats.FreedBytes : 0;
+      myCounters[MemThreadCache] = aStats.CachedBytes;
+    }
+  }
+
 #ifndef OCCT_UWP
   #if defined(_WIN32)
     #if (_WIN32_WINNT >= 0x0500)
@@ -303,6 +362,16 @@ TCollection_AsciiString OSD_MemInfo::ToString() const
     anInfo +=
       TCollection_AsciiString("  Heap memory:     ") + int(ValueMiB(MemHeapUsage)) + " MiB\n";
   }
+  if (hasValue(MemThreadUsage))
+  {
+    anInfo +=
+      TCollection_AsciiString("  Thread memory:      ") + int(ValueMiB(MemThreadUsage)) + " MiB";
+    if (hasValue(MemThreadCache))
+    {
+      anInfo += TCollection_AsciiString(" (cached: ") + int(ValueMiB(MemThreadCache)) + " MiB)";
+    }
+    anInfo += "\n";
+  }
   return anInfo;
 }
 
@@ -349,3 +418,130 @@ TCollection_AsciiString OSD_MemInfo::PrintInfo()
   OSD_MemInfo anInfo;
   return anInfo.ToString();
 }
+
+//=================================================================================================
+
+int OSD_MemInfo::RegisterMemTag(const TCollection_AsciiString& theName)
+{
+  MemTagRegistry&             aRegistry = MemTagRegistry::Get();
+  std::lock_guard<std::mutex> aLock(aRegistry.Mutex);
+  const int                   aNbTags = aRegistry.NbTags.load();
+  for (int aTagIter = MemTag_Untagged + 1; aTagIter < aNbTags; ++aTagIter)
+  {
+    if (aRegistry.Names[aTagIter] == theName)
+    {
+      return aTagIter;
+    }
+  }
+  if (aNbTags >= THE_MAX_MEM_TAGS)
+  {
+    return MemTag_Untagged;
+  }
+
+  aRegistry.Names[aNbTags] = theName;
+  aRegistry.NbTags.store(aNbTags + 1);
+  return aNbTags;
+}
+
+//=================================================================================================
+
+int OSD_MemInfo::NbMemTags()
+{
+  return MemTagRegistry::Get().NbTags.load();
+}
+
+//=================================================================================================
+
+TCollection_AsciiString OSD_MemInfo::MemTagName(const int theTag)
+{
+  MemTagRegistry& aRegistry = MemTagRegistry::Get();
+  if (theTag < MemTag_Untagged || theTag >= aRegistry.NbTags.load())
+  {
+    return TCollection_AsciiString();
+  }
+  std::lock_guard<std::mutex> aLock(aRegistry.Mutex);
+  return aRegistry.Names[theTag];
+}
+
+//=================================================================================================
+
+void OSD_MemInfo::AddTaggedMemory(const int theTag, const int64_t theDelta)
+{
+  MemTagRegistry& aRegistry = MemTagRegistry::Get();
+  if (!isValidMemTag(aRegistry, theTag))
+  {
+    return;
+  }
+
+  const int64_t aLive = aRegistry.Live[theTag].fetch_add(theDelta, std::memory_order_relaxed)
+                        + theDelta;
+  for (int64_t aPeak = aRegistry.Peak[theTag].load(std::memory_order_relaxed); aLive > aPeak;)
+  {
+    if (aRegistry.Peak[theTag].compare_exchange_weak(aPeak, aLive, std::memory_order_relaxed))
+    {
+      break;
+    }
+  }
+}
+
+//=================================================================================================
+
+size_t OSD_MemInfo::TaggedMemory(const int theTag)
+{
+  MemTagRegistry& aRegistry = MemTagRegistry::Get();
+  if (!isValidMemTag(aRegistry, theTag))
+  {
+    return 0;
+  }
+  const int64_t aLive = aRegistry.Live[theTag].load(std::memory_order_relaxed);
+  return aLive > 0 ? size_t(aLive) : 0;
+}
+
+//=================================================================================================
+
+size_t OSD_MemInfo::TaggedMemoryPeak(const int theTag)
+{
+  MemTagRegistry& aRegistry = MemTagRegistry::Get();
+  if (!isValidMemTag(aRegistry, theTag))
+  {
+    return 0;
+  }
+  const int64_t aPeak = aRegistry.Peak[theTag].load(std::memory_order_relaxed);
+  return aPeak > 0 ? size_t(aPeak) : 0;
+}
+
+//=================================================================================================
+
+void OSD_MemInfo::ResetTaggedMemoryPeaks()
+{
+  MemTagRegistry& aRegistry = MemTagRegistry::Get();
+  for (int aTagIter = 0; aTagIter < THE_MAX_MEM_TAGS; ++aTagIter)
+  {
+    aRegistry.Peak[aTagIter].store(aRegistry.Live[aTagIter].load());
+  }
+}
+
+//=================================================================================================
+
+TCollection_AsciiString OSD_MemInfo::PrintTaggedMemory()
+{
+  TCollection_AsciiString anInfo;
+  const int               aNbTags = NbMemTags();
+  for (int aTagIter = MemTag_Untagged + 1; aTagIter < aNbTags; ++aTagIter)
+  {
+    const size_t aPeak = TaggedMemoryPeak(aTagIter);
+    if (aPeak == 0)
+    {
+      continue;
+    }
+
+    TCollection_AsciiString aName = MemTagName(aTagIter) + ":";
+    while (aName.Length() < 20)
+    {
+      aName += " ";
+    }
+    anInfo += TCollection_AsciiString("  ") + aName + int(TaggedMemory(aTagIter) / (1024 * 1024))
+              + " MiB (peak: " + int(aPeak / (1024 * 1024)) + " MiB)\n";
+  }
+  return anInfo;
+}
@@ -18,6 +18,8 @@
 
 #include <TCollection_AsciiString.hxx>
 
+#include <cstdint>
+
 //! This class provide information about memory utilized by current process.
 //! This information includes:
 //!  - Private Memory - synthetic value that tries to filter out the memory
@@ -36,6 +38,15 @@
 //!                     Those pages may or may not be in memory (RAM)
 //!                     thus this counter couldn't be used to estimate
 //!                     how many active pages doesn't present in RAM.
+//!  - Thread Usage   - memory allocated by the calling thread through
+//!                     Standard::Allocate() minus memory freed by it,
+//!                     and free blocks kept in the cache of this thread;
+//!                     available only with Standard_MMgrThreadCache (MMGT_OPT=4).
+//!
+//! In addition, the class keeps the global registry of memory accounted per subsystem
+//! (see AddTaggedMemory()): allocators carrying a tag (NCollection_BaseAllocator::SetMemTag())
+//! report there the memory they hold, so that the subsystems consuming most of the memory
+//! of the process can be identified.
 //!
 //! Notice that none of these counters can be used as absolute measure of
 //! application memory consumption!
@@ -59,9 +70,28 @@ public:
     MemSwapUsage,      //!< Space allocated for the pagefile
     MemSwapUsagePeak,  //!< Peak space allocated for the pagefile
     MemHeapUsage,      //!< Total space allocated from the heap
+    MemThreadUsage,    //!< Space allocated and not yet freed by the calling thread (MMGT_OPT=4)
+    MemThreadCache,    //!< Free blocks kept in the cache of the calling thread (MMGT_OPT=4)
     MemCounter_NB      //!< Indicates total counters number
   };
 
+  //! Predefined tags of memory accounted per subsystem;
+  //! custom tags can be added by RegisterMemTag().
+  enum MemTag
+  {
+    MemTag_Untagged = 0, //!< memory is not accounted
+    MemTag_Mesh,         //!< mesh generation (BRepMesh)
+    MemTag_BOPDS,        //!< data structures of Boolean operations
+    MemTag_StepData,     //!< STEP file reading
+    MemTag_XCAF,         //!< label nodes of XCAF documents
+    MemTag_Select3D,     //!< selection structures
+    MemTag_GpuBuffers,   //!< GPU buffers
+    MemTag_NB            //!< number of predefined tags
+  };
+
+  //! Maximum number of tags, including the predefined ones.
+  static constexpr int THE_MAX_MEM_TAGS = 64;
+
 public:
   //! Create and initialize. By default all countes are active
   Standard_EXPORT OSD_MemInfo(const bool theImmediateUpdate = true);
@@ -112,6 +142,36 @@ public:
   //! Return the string representation for all available counter.
   Standard_EXPORT static TCollection_AsciiString PrintInfo();
 
+public:
+  //! Registers the custom tag of memory accounting.
+  //! @param theName name of the tag
+  //! @return index of the tag, existing one if the tag with the same name is already registered,
+  //!         or MemTag_Untagged if the registry is full
+  Standard_EXPORT static int RegisterMemTag(const TCollection_AsciiString& theName);
+
+  //! Returns the number of registered tags, including MemTag_Untagged.
+  Standard_EXPORT static int NbMemTags();
+
+  //! Returns the name of the tag, or empty string for unknown tag.
+  Standard_EXPORT static TCollection_AsciiString MemTagName(const int theTag);
+
+  //! Accounts the memory allocated (positive delta) or released (negative delta) under the tag.
+  //! Does nothing for MemTag_Untagged; can be called concurrently from several threads.
+  Standard_EXPORT static void AddTaggedMemory(const int theTag, const int64_t theDelta);
+
+  //! Returns the memory currently accounted under the tag, in bytes.
+  Standard_EXPORT static size_t TaggedMemory(const int theTag);
+
+  //! Returns the peak of memory accounted under the tag, in bytes.
+  Standard_EXPORT static size_t TaggedMemoryPeak(const int theTag);
+
+  //! Resets the peaks of all tags to the currently accounted memory.
+  Standard_EXPORT static void ResetTaggedMemoryPeaks();
+
+  //! Returns the string representation of the memory accounted under tags,
+  //! skipping the tags that never accounted any memory.
+  Standard_EXPORT static TCollection_AsciiString PrintTaggedMemory();
+
 protected:
   //! Return true if the counter is active and the value is valid
   bool hasValue(const OSD_MemInfo::Counter theCounter) const
@@ -179,6 +179,8 @@ static bool OSD_Parallel_ToUseOcctThreads =
 #else
   true;
 #endif
+
+static std::atomic<bool> OSD_Parallel_ToUseTaskScheduler(false);
 } // namespace
 
 //=================================================================================================
@@ -199,6 +201,31 @@ void OSD_Parallel::SetUseOcctThreads(bool theToUseOcct)
 #endif
 }
 
+//=================================================================================================
+
+bool OSD_Parallel::ToUseTaskScheduler()
+{
+  return OSD_Parallel_ToUseTaskScheduler;
+}
+
+//=================================================================================================
+
+void OSD_Parallel::SetUseTaskScheduler(bool theToUseScheduler)
+{
+  OSD_Parallel_ToUseTaskScheduler = theToUseScheduler;
+}
+
+//=================================================================================================
+
+OSD_TaskScheduler* OSD_Parallel::taskScheduler()
+{
+  if (OSD_TaskScheduler* aCurrent = OSD_TaskScheduler::Current())
+  {
+    return aCurrent;
+  }
+  return OSD_Parallel_ToUseTaskScheduler ? OSD_TaskScheduler::DefaultScheduler().get() : nullptr;
+}
+
 //=======================================================================
 // function : NbLogicalProcessors
 // purpose  : Returns number of logical processors.
@@ -14,6 +14,7 @@
 #ifndef OSD_Parallel_HeaderFile
 #define OSD_Parallel_HeaderFile
 
+#include <OSD_TaskScheduler.hxx>
 #include <OSD_ThreadPool.hxx>
 #include <Standard_Type.hxx>
 #include <memory>
@@ -54,6 +55,11 @@
 //! Implementation uses TBB if OCCT is built with support of TBB; otherwise it
 //! uses ad-hoc parallelization tool. In general, if TBB is available, it is
 //! more efficient to use it directly instead of using OSD_Parallel.
+//!
+//! Loops by index (For) called within a task of OSD_TaskScheduler (including iterations
+//! of an outer loop executed by the scheduler) are split into tasks of the same scheduler,
+//! so that nested parallel algorithms share its threads with no regard to TBB usage.
+//! Arbitrary tasks can be executed by the scheduler using OSD_Parallel::TaskGroup.
 
 class OSD_Parallel
 {
@@ -261,6 +267,31 @@ private:
     const Functor& myFunctor;
   };
 
+  //! Splits the range into tasks of the scheduler and waits for their completion.
+  //! The remaining iterations are skipped when an iteration throws an exception.
+  template <typename Functor>
+  static void forTasks(OSD_TaskScheduler& theScheduler,
+                       const int          theBegin,
+                       const int          theEnd,
+                       const Functor&     theFunctor)
+  {
+    const int aRange    = theEnd - theBegin;
+    const int aNbChunks = std::min(aRange, 4 * theScheduler.NbThreads());
+    TaskGroup aGroup(&theScheduler);
+    for (int aChunkIter = 0; aChunkIter < aNbChunks; ++aChunkIter)
+    {
+      const int aLower  = theBegin + int(int64_t(aRange) * aChunkIter / aNbChunks);
+      const int anUpper = theBegin + int(int64_t(aRange) * (aChunkIter + 1) / aNbChunks);
+      aGroup.Run([&theFunctor, &aGroup, aLower, anUpper]() {
+        for (int anIter = aLower; anIter < anUpper && !aGroup.IsCancelled(); ++anIter)
+        {
+          theFunctor(anIter);
+        }
+      });
+    }
+    aGroup.Wait();
+  }
+
 private:
   //! Simple primitive for parallelization of "foreach" loops, e.g.:
   //! @code
@@ -284,7 +315,29 @@ private:
                                               const FunctorInterface& theFunctor,
                                               int                     theNbItems);
 
+  //! Returns the task scheduler to execute "for" loops, or NULL if the loops should be
+  //! executed by the thread pool or TBB.
+  Standard_EXPORT static OSD_TaskScheduler* taskScheduler();
+
 public: //! @name public methods
+  //! Group of tasks executed by the work-stealing task scheduler;
+  //! the default scheduler OSD_TaskScheduler::DefaultScheduler() is used unless specified.
+  //! @code
+  //!   OSD_Parallel::TaskGroup aGroup;
+  //!   aGroup.Run([&]() { aLeft.Perform(); });
+  //!   aGroup.Run([&]() { aRight.Perform(); });
+  //!   aGroup.Wait();
+  //! @endcode
+  typedef OSD_TaskScheduler::TaskGroup TaskGroup;
+
+  //! Returns TRUE if loops by index (For) are executed by the default task scheduler
+  //! OSD_TaskScheduler::DefaultScheduler() instead of the thread pool or TBB; FALSE by default.
+  //! Loops called within tasks of a scheduler are executed by that scheduler in any case.
+  Standard_EXPORT static bool ToUseTaskScheduler();
+
+  //! Sets if loops by index (For) should be executed by the default task scheduler.
+  Standard_EXPORT static void SetUseTaskScheduler(bool theToUseScheduler);
+
   //! Returns TRUE if OCCT threads should be used instead of auxiliary threads library;
   //! default value is FALSE if alternative library has been enabled while OCCT building and TRUE
   //! otherwise.
@@ -360,6 +413,10 @@ public: //! @name public methods
       for (int it(theBegin); it != theEnd; ++it)
         theFunctor(it);
     }
+    else if (OSD_TaskScheduler* aScheduler = taskScheduler())
+    {
+      forTasks(*aScheduler, theBegin, theEnd, theFunctor);
+    }
     else if (ToUseOcctThreads())
     {
       const occ::handle<OSD_ThreadPool>&   aThreadPool = OSD_ThreadPool::DefaultPool();
@@ -0,0 +1,366 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <OSD_TaskScheduler.hxx>
+
+#include <OSD.hxx>
+#include <OSD_Parallel.hxx>
+#include <Standard_ErrorHandler.hxx>
+#include <Standard_ProgramError.hxx>
+
+#include <chrono>
+#include <deque>
+
+IMPLEMENT_STANDARD_RTTIEXT(OSD_TaskScheduler, Standard_Transient)
+
+//! Worker thread and its queue of tasks.
+struct OSD_TaskScheduler::Worker
+{
+  OSD_TaskScheduler*                   Scheduler; //!< owning scheduler
+  OSD_Thread                           Thread;    //!< thread (not started for the shared queue)
+  std::deque<OSD_TaskScheduler::Task*> Queue;     //!< queued tasks
+  std::mutex                           Mutex;     //!< lock for the queue
+  int                                  Index;     //!< index of the worker
+};
+
+namespace
+{
+//! Scheduler owning the calling worker thread.
+thread_local OSD_TaskScheduler* THE_WORKER_SCHEDULER = nullptr;
+
+//! Index of the calling worker thread in its scheduler.
+thread_local int THE_WORKER_INDEX = -1;
+
+//! Scheduler executing a task in the calling thread.
+thread_local OSD_TaskScheduler* THE_TASK_SCHEDULER = nullptr;
+} // namespace
+
+//=================================================================================================
+
+const occ::handle<OSD_TaskScheduler>& OSD_TaskScheduler::DefaultScheduler(int theNbThreads)
+{
+  static const occ::handle<OSD_TaskScheduler> THE_GLOBAL_SCHEDULER =
+    new OSD_TaskScheduler(theNbThreads);
+  return THE_GLOBAL_SCHEDULER;
+}
+
+//=================================================================================================
+
+OSD_TaskScheduler* OSD_TaskScheduler::Current()
+{
+  return THE_TASK_SCHEDULER != nullptr ? THE_TASK_SCHEDULER : THE_WORKER_SCHEDULER;
+}
+
+//=================================================================================================
+
+OSD_TaskScheduler::OSD_TaskScheduler(int theNbThreads)
+    : myNbQueued(0),
+      myToShutDown(false)
+{
+  const int aNbThreads =
+    std::max(1, theNbThreads > 0 ? theNbThreads : OSD_Parallel::NbLogicalProcessors());
+  myWorkers.Resize(0, aNbThreads - 1, false);
+  for (int aWorkerIter = myWorkers.Lower(); aWorkerIter <= myWorkers.Upper(); ++aWorkerIter)
+  {
+    Worker* aWorker    = new Worker();
+    aWorker->Scheduler = this;
+    aWorker->Index     = aWorkerIter;
+    myWorkers.SetValue(aWorkerIter, aWorker);
+  }
+
+  // the last queue is shared by threads which are not workers
+  for (int aWorkerIter = myWorkers.Lower(); aWorkerIter < myWorkers.Upper(); ++aWorkerIter)
+  {
+    Worker* aWorker = myWorkers.Value(aWorkerIter);
+    aWorker->Thread.SetFunction(&OSD_TaskScheduler::runWorker);
+    aWorker->Thread.Run(aWorker);
+  }
+}
+
+//=================================================================================================
+
+OSD_TaskScheduler::~OSD_TaskScheduler()
+{
+  {
+    std::lock_guard<std::mutex> aLock(mySleepMutex);
+    myToShutDown = true;
+  }
+  myWakeCond.notify_all();
+  for (int aWorkerIter = myWorkers.Lower(); aWorkerIter < myWorkers.Upper(); ++aWorkerIter)
+  {
+    myWorkers.Value(aWorkerIter)->Thread.Wait();
+  }
+  for (NCollection_Array1<Worker*>::Iterator aWorkerIter(myWorkers); aWorkerIter.More();
+       aWorkerIter.Next())
+  {
+    delete aWorkerIter.Value();
+  }
+}
+
+//=================================================================================================
+
+bool OSD_TaskScheduler::IsWorkerThread() const
+{
+  return THE_WORKER_SCHEDULER == this;
+}
+
+//=================================================================================================
+
+void OSD_TaskScheduler::spawn(Task* theTask, TaskGroup& theGroup)
+{
+  theTask->myGroup      = &theGroup;
+  theTask->myToCatchFpe = OSD::ToCatchFloatingSignals();
+  ++theGroup.myNbPending;
+
+  Worker* aWorker = IsWorkerThread() ? myWorkers.Value(THE_WORKER_INDEX) : myWorkers.Last();
+  {
+    std::lock_guard<std::mutex> aLock(aWorker->Mutex);
+    aWorker->Queue.push_back(theTask);
+  }
+  ++myNbQueued;
+
+  // lock ensures that a worker going to sleep either sees the queued task or gets the signal
+  {
+    std::lock_guard<std::mutex> aLock(mySleepMutex);
+  }
+  myWakeCond.notify_one();
+}
+
+//=================================================================================================
+
+OSD_TaskScheduler::Task* OSD_TaskScheduler::takeTask(Worker* theWorker)
+{
+  if (myNbQueued <= 0)
+  {
+    return nullptr;
+  }
+
+  // the most recent task of the own queue keeps the data in cache
+  Task* aTask = nullptr;
+  if (theWorker != nullptr)
+  {
+    std::lock_guard<std::mutex> aLock(theWorker->Mutex);
+    if (!theWorker->Queue.empty())
+    {
+      aTask = theWorker->Queue.back();
+      theWorker->Queue.pop_back();
+    }
+  }
+
+  // steal the oldest task from the shared queue or another worker
+  const int aNbWorkers = myWorkers.Size();
+  const int aFirst     = theWorker != nullptr ? theWorker->Index + 1 : 0;
+  for (int anOffset = 0; aTask == nullptr && anOffset < aNbWorkers; ++anOffset)
+  {
+    Worker* aVictim = myWorkers.Value((aFirst + anOffset) % aNbWorkers);
+    if (aVictim == theWorker)
+    {
+      continue;
+    }
+
+    std::lock_guard<std::mutex> aLock(aVictim->Mutex);
+    if (!aVictim->Queue.empty())
+    {
+      aTask = aVictim->Queue.front();
+      aVictim->Queue.pop_front();
+    }
+  }
+
+  if (aTask != nullptr)
+  {
+    --myNbQueued;
+  }
+  return aTask;
+}
+
+//=================================================================================================
+
+void OSD_TaskScheduler::execute(Task* theTask)
+{
+  TaskGroup* aGroup = theTask->myGroup;
+  if (!aGroup->IsCancelled())
+  {
+    if (IsWorkerThread())
+    {
+      OSD::SetThreadLocalSignal(OSD::SignalMode(), theTask->myToCatchFpe);
+    }
+
+    OSD_TaskScheduler* aPrevScheduler = THE_TASK_SCHEDULER;
+    THE_TASK_SCHEDULER                = this;
+    try
+    {
+      OCC_CATCH_SIGNALS
+      theTask->Perform();
+    }
+    catch (Standard_Failure const& aFailure)
+    {
+      TCollection_AsciiString aMsg = TCollection_AsciiString(aFailure.DynamicType()->Name()) + ": "
+                                     + aFailure.GetMessageString();
+      aGroup->addFailure(aMsg,
+                         new Standard_ProgramError(aMsg.ToCString(), aFailure.GetStackString()));
+    }
+    catch (std::exception& anStdException)
+    {
+      TCollection_AsciiString aMsg =
+        TCollection_AsciiString(typeid(anStdException).name()) + ": " + anStdException.what();
+      aGroup->addFailure(aMsg, new Standard_ProgramError(aMsg.ToCString(), nullptr));
+    }
+    catch (...)
+    {
+      TCollection_AsciiString aMsg("Error: Unknown exception");
+      aGroup->addFailure(aMsg, new Standard_ProgramError(aMsg.ToCString(), nullptr));
+    }
+    THE_TASK_SCHEDULER = aPrevScheduler;
+  }
+
+  delete theTask;
+  aGroup->taskDone();
+}
+
+//=================================================================================================
+
+void OSD_TaskScheduler::performWorker(Worker* theWorker)
+{
+  OSD::SetThreadLocalSignal(OSD::SignalMode(), false);
+  THE_WORKER_SCHEDULER = this;
+  THE_WORKER_INDEX     = theWorker->Index;
+  for (;;)
+  {
+    if (Task* aTask = takeTask(theWorker))
+    {
+      execute(aTask);
+      continue;
+    }
+
+    std::unique_lock<std::mutex> aLock(mySleepMutex);
+    myWakeCond.wait(aLock, [this]() { return myToShutDown || myNbQueued > 0; });
+    if (myToShutDown)
+    {
+      return;
+    }
+  }
+}
+
+//=================================================================================================
+
+void* OSD_TaskScheduler::runWorker(void* theWorker)
+{
+  Worker* aWorker = static_cast<Worker*>(theWorker);
+  aWorker->Scheduler->performWorker(aWorker);
+  return nullptr;
+}
+
+//=================================================================================================
+
+OSD_TaskScheduler::TaskGroup::TaskGroup(const occ::handle<OSD_TaskScheduler>& theScheduler)
+    : myScheduler(!theScheduler.IsNull() ? theScheduler : OSD_TaskScheduler::DefaultScheduler()),
+      myNbPending(0),
+      myIsCancelled(false),
+      myNbFailures(0)
+{
+}
+
+//=================================================================================================
+
+OSD_TaskScheduler::TaskGroup::~TaskGroup()
+{
+  waitTasks();
+}
+
+//=================================================================================================
+
+void OSD_TaskScheduler::TaskGroup::waitTasks()
+{
+  Worker* aWorker =
+    myScheduler->IsWorkerThread() ? myScheduler->myWorkers.Value(THE_WORKER_INDEX) : nullptr;
+  while (myNbPending > 0)
+  {
+    // help executing queued tasks (of this or another group) instead of sleeping
+    if (Task* aTask = myScheduler->takeTask(aWorker))
+    {
+      myScheduler->execute(aTask);
+      continue;
+    }
+
+    // the remaining tasks are executed by other threads
+    std::unique_lock<std::mutex> aLock(myMutex);
+    myDoneCond.wait_for(aLock, std::chrono::milliseconds(1), [this]() {
+      return myNbPending == 0;
+    });
+  }
+
+  // make sure that the thread completing the last task has released the lock
+  std::lock_guard<std::mutex> aLock(myMutex);
+}
+
+//=================================================================================================
+
+void OSD_TaskScheduler::TaskGroup::Wait()
+{
+  waitTasks();
+
+  occ::handle<Standard_Failure> aFailure;
+  TCollection_AsciiString       aFailures;
+  int                           aNbFailures = 0;
+  {
+    std::lock_guard<std::mutex> aLock(myMutex);
+    aFailure    = myFailure;
+    aFailures   = myFailures;
+    aNbFailures = myNbFailures;
+    myFailure.Nullify();
+    myFailures.Clear();
+    myNbFailures = 0;
+  }
+  myIsCancelled = false;
+
+  if (aNbFailures == 1)
+  {
+    aFailure->Reraise();
+  }
+  else if (aNbFailures > 1)
+  {
+    aFailures = TCollection_AsciiString("Multiple exceptions:\n") + aFailures;
+    throw Standard_ProgramError(aFailures.ToCString(), nullptr);
+  }
+}
+
+//=================================================================================================
+
+void OSD_TaskScheduler::TaskGroup::addFailure(const TCollection_AsciiString&       theMessage,
+                                              const occ::handle<Standard_Failure>& theFailure)
+{
+  myIsCancelled = true;
+
+  std::lock_guard<std::mutex> aLock(myMutex);
+  if (myFailure.IsNull())
+  {
+    myFailure = theFailure;
+  }
+  if (!myFailures.IsEmpty())
+  {
+    myFailures += "\n";
+  }
+  myFailures += theMessage;
+  ++myNbFailures;
+}
+
+//=================================================================================================
+
+void OSD_TaskScheduler::TaskGroup::taskDone()
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  if (--myNbPending == 0)
+  {
+    myDoneCond.notify_all();
+  }
+}
@@ -0,0 +1,217 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _OSD_TaskScheduler_HeaderFile
+#define _OSD_TaskScheduler_HeaderFile
+
+#include <NCollection_Array1.hxx>
+#include <OSD_Thread.hxx>
+#include <Standard_Failure.hxx>
+#include <TCollection_AsciiString.hxx>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+//! Work-stealing scheduler executing tasks in a fixed set of worker threads.
+//!
+//! Tasks are submitted through OSD_TaskScheduler::TaskGroup.
+//! Each worker thread owns a double-ended queue of tasks:
+//! - a task spawned by a worker thread is pushed to the back of its own queue,
+//!   and the worker takes the most recently spawned task first;
+//! - an idle worker steals the oldest task from the front of the queue of another worker;
+//! - tasks spawned by other threads are put into a shared queue.
+//!
+//! A thread waiting for a task group (TaskGroup::Wait()) does not sleep
+//! while there are queued tasks but executes them, so that nested parallel algorithms
+//! (task groups created within tasks) use the same worker threads
+//! instead of being serialized or creating more threads than the pool has.
+//!
+//! Unlike OSD_ThreadPool::Launcher, the scheduler does not lock threads
+//! for an algorithm, and does not depend on the threads library used by OSD_Parallel,
+//! so that it behaves the same way with and without TBB.
+class OSD_TaskScheduler : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(OSD_TaskScheduler, Standard_Transient)
+public:
+  //! Return (or create) a default task scheduler.
+  //! Number of threads argument will be considered only when called first time.
+  Standard_EXPORT static const occ::handle<OSD_TaskScheduler>& DefaultScheduler(
+    int theNbThreads = -1);
+
+  //! Return the scheduler executing a task in the calling thread,
+  //! or NULL if the calling thread is neither a worker thread nor executes a task.
+  Standard_EXPORT static OSD_TaskScheduler* Current();
+
+public:
+  //! Main constructor.
+  //! @param theNbThreads number of threads executing the tasks including the waiting thread
+  //!                     (if -1 is specified then OSD_Parallel::NbLogicalProcessors() will be used)
+  Standard_EXPORT OSD_TaskScheduler(int theNbThreads = -1);
+
+  //! Destructor; tasks should not be queued at this point.
+  Standard_EXPORT ~OSD_TaskScheduler() override;
+
+  //! Return the number of threads executing the tasks; >= 1.
+  //! The thread waiting for a task group is counted as one of them.
+  int NbThreads() const { return myWorkers.Size(); }
+
+  //! Return TRUE if the calling thread is a worker thread of this scheduler.
+  Standard_EXPORT bool IsWorkerThread() const;
+
+public:
+  class TaskGroup;
+
+  //! Task interface.
+  class Task
+  {
+    friend class OSD_TaskScheduler;
+
+  public:
+    //! Main constructor.
+    Task()
+        : myGroup(nullptr),
+          myToCatchFpe(false)
+    {
+    }
+
+    //! Destructor.
+    virtual ~Task() = default;
+
+    //! Method is executed in the context of a thread of the scheduler.
+    virtual void Perform() = 0;
+
+  private:
+    TaskGroup* myGroup;
+    bool       myToCatchFpe;
+  };
+
+  //! Group of tasks which completion can be waited for.
+  //! Tasks of the group can be cancelled: the tasks not started yet are not executed,
+  //! and the running tasks may check TaskGroup::IsCancelled() to stop earlier.
+  //! A task group is cancelled automatically when one of its tasks throws an exception.
+  class TaskGroup
+  {
+    friend class OSD_TaskScheduler;
+
+  public:
+    //! Main constructor.
+    //! @param theScheduler scheduler to execute tasks; the default scheduler if NULL
+    Standard_EXPORT TaskGroup(const occ::handle<OSD_TaskScheduler>& theScheduler = nullptr);
+
+    //! Destructor; waits for completion of the spawned tasks (without throwing exceptions).
+    Standard_EXPORT ~TaskGroup();
+
+    //! Return the scheduler executing tasks of this group.
+    const occ::handle<OSD_TaskScheduler>& Scheduler() const { return myScheduler; }
+
+    //! Spawn a task calling a copy of the functor "void operator()() const".
+    template <typename Functor>
+    void Run(const Functor& theFunctor)
+    {
+      myScheduler->spawn(new FunctorTask<Functor>(theFunctor), *this);
+    }
+
+    //! Wait for completion of all spawned tasks, executing queued tasks meanwhile.
+    //! The group can be reused for spawning new tasks after that;
+    //! the cancellation flag is reset.
+    //! Exceptions thrown by the tasks are re-thrown in the waiting thread,
+    //! several exceptions are combined into Standard_ProgramError.
+    Standard_EXPORT void Wait();
+
+    //! Cancel the tasks of the group.
+    void Cancel() { myIsCancelled = true; }
+
+    //! Return TRUE if the group has been cancelled.
+    bool IsCancelled() const { return myIsCancelled; }
+
+    //! Return the number of spawned but not completed tasks.
+    int NbPendingTasks() const { return myNbPending; }
+
+  private:
+    //! Wrapper storing a copy of the functor.
+    template <typename Functor>
+    class FunctorTask : public Task
+    {
+    public:
+      FunctorTask(const Functor& theFunctor)
+          : myFunctor(theFunctor)
+      {
+      }
+
+      void Perform() override { myFunctor(); }
+
+    private:
+      Functor myFunctor;
+    };
+
+    //! Wait for completion of all spawned tasks.
+    void waitTasks();
+
+    //! Register a failure of the task; cancels the group.
+    void addFailure(const TCollection_AsciiString& theMessage,
+                    const occ::handle<Standard_Failure>& theFailure);
+
+    //! Mark a task as completed.
+    void taskDone();
+
+  private:
+    TaskGroup(const TaskGroup& theCopy)            = delete;
+    TaskGroup& operator=(const TaskGroup& theCopy) = delete;
+
+  private:
+    occ::handle<OSD_TaskScheduler> myScheduler;   //!< scheduler executing tasks
+    std::atomic<int>               myNbPending;   //!< number of not completed tasks
+    std::atomic<bool>              myIsCancelled; //!< cancellation flag
+    std::mutex                     myMutex;       //!< lock for completion and failures
+    std::condition_variable        myDoneCond;    //!< signaled when all tasks are completed
+    occ::handle<Standard_Failure>  myFailure;     //!< the first failure
+    TCollection_AsciiString        myFailures;    //!< messages of all failures
+    int                            myNbFailures;  //!< number of failed tasks
+  };
+
+private:
+  //! Worker thread and its queue of tasks (defined in implementation).
+  struct Worker;
+
+  //! Put the task into the queue.
+  Standard_EXPORT void spawn(Task* theTask, TaskGroup& theGroup);
+
+  //! Take a task: from the back of the own queue of the worker,
+  //! then from the shared queue, then from the front of the queues of other workers.
+  Task* takeTask(Worker* theWorker);
+
+  //! Execute the task and release it.
+  void execute(Task* theTask);
+
+  //! Worker thread loop.
+  void performWorker(Worker* theWorker);
+
+  //! Thread function.
+  static void* runWorker(void* theWorker);
+
+private:
+  OSD_TaskScheduler(const OSD_TaskScheduler& theCopy)            = delete;
+  OSD_TaskScheduler& operator=(const OSD_TaskScheduler& theCopy) = delete;
+
+private:
+  // clang-format off
+  NCollection_Array1<Worker*> myWorkers;     //!< worker threads; the last one is the shared queue
+  std::atomic<int>            myNbQueued;    //!< number of queued tasks
+  std::mutex                  mySleepMutex;  //!< lock for sleeping workers
+  std::condition_variable     myWakeCond;    //!< signaled when a task is queued
+  bool                        myToShutDown;  //!< flag to stop worker threads
+  // clang-format on
+};
+
+#endif // _OSD_TaskScheduler_HeaderFile
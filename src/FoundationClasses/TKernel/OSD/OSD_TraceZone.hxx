@@ -0,0 +1,78 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef OSD_TraceZone_HeaderFile
+#define OSD_TraceZone_HeaderFile
+
+#include <OSD_Tracer.hxx>
+
+//! Scoped zone of code execution recorded by OSD_Tracer:
+//! the zone starts at construction and ends at destruction of the object.
+//! When tracing is disabled, the object does nothing.
+//!
+//! Zones are usually declared by macro OSD_TRACE_ZONE:
+//! @code
+//!   void BRepMesh_Algo::Perform()
+//!   {
+//!     OSD_TRACE_ZONE("BRepMesh_Algo::Perform");
+//!     ...
+//!   }
+//! @endcode
+class OSD_TraceZone
+{
+public:
+  //! Starts the zone if tracing is enabled.
+  //! @param theName     name of the zone; should be a string literal, as only the pointer is kept
+  //! @param theCategory category of the zone; should be a string literal
+  OSD_TraceZone(const char* theName, const char* theCategory = "occt")
+      : myName(theName),
+        myCategory(theCategory),
+        myStart(OSD_Tracer::IsEnabled() ? OSD_Tracer::Now() : 0)
+  {
+  }
+
+  //! Ends the zone.
+  ~OSD_TraceZone()
+  {
+    if (myStart != 0)
+    {
+      OSD_Tracer::AddZone(myName, myCategory, myStart, OSD_Tracer::Now());
+    }
+  }
+
+private:
+  OSD_TraceZone(const OSD_TraceZone&)            = delete;
+  OSD_TraceZone& operator=(const OSD_TraceZone&) = delete;
+
+private:
+  const char* myName;
+  const char* myCategory;
+  uint64_t    myStart;
+};
+
+#define OSD_TRACE_ZONE_CONCAT2(theA, theB) theA##theB
+#define OSD_TRACE_ZONE_CONCAT(theA, theB) OSD_TRACE_ZONE_CONCAT2(theA, theB)
+
+//! Declares the zone lasting until the end of the current scope.
+//! Zones are compiled out when OCCT_NO_TRACE is defined.
+#ifdef OCCT_NO_TRACE
+  #define OSD_TRACE_ZONE(theName)
+  #define OSD_TRACE_ZONE_CATEGORY(theName, theCategory)
+#else
+  #define OSD_TRACE_ZONE(theName)                                                                  \
+    OSD_TraceZone OSD_TRACE_ZONE_CONCAT(anOsdTraceZone, __LINE__)(theName)
+  #define OSD_TRACE_ZONE_CATEGORY(theName, theCategory)                                            \
+    OSD_TraceZone OSD_TRACE_ZONE_CONCAT(anOsdTraceZone, __LINE__)(theName, theCategory)
+#endif
+
+#endif // OSD_TraceZone_HeaderFile
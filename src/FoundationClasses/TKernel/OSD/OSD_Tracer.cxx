@@ -0,0 +1,383 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <OSD_Tracer.hxx>
+
+#include <OSD_OpenFile.hxx>
+#include <OSD_Process.hxx>
+#include <OSD_Thread.hxx>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+//! Zone recorded by a thread.
+struct TraceZone
+{
+  const char* Name;
+  const char* Category;
+  uint64_t    Start;
+  uint64_t    End;
+};
+
+//! Ring buffer of zones recorded by a single thread.
+struct TraceBuffer
+{
+  std::unique_ptr<TraceZone[]> Zones;        //!< ring of zones
+  int                          Capacity;     //!< size of the ring
+  std::atomic<uint64_t>        NbZones;      //!< number of zones ever recorded
+  Standard_ThreadId            ThreadId;     //!< identifier of the thread
+  TCollection_AsciiString      ThreadName;   //!< name of the thread
+  bool                         IsThreadDone; //!< flag indicating that the thread has exited
+
+  TraceBuffer(const int theCapacity)
+      : Zones(new TraceZone[theCapacity]),
+        Capacity(theCapacity),
+        NbZones(0),
+        ThreadId(OSD_Thread::Current()),
+        IsThreadDone(false)
+  {
+  }
+};
+
+//! Global state of the tracer.
+struct TraceRegistry
+{
+  std::atomic<bool>         IsEnabled{false};
+  std::atomic<int>          BufferSize{16384};
+  std::atomic<uint64_t>     ClearTime{0}; //!< zones started before this time are ignored
+  std::mutex                Mutex;        //!< mutex protecting the list of buffers
+  std::vector<TraceBuffer*> Buffers;
+
+  ~TraceRegistry()
+  {
+    for (TraceBuffer* aBuffer : Buffers)
+    {
+      delete aBuffer;
+    }
+  }
+
+  static TraceRegistry& Get()
+  {
+    static TraceRegistry THE_REGISTRY;
+    return THE_REGISTRY;
+  }
+};
+
+//! Marks the buffer of the thread as released at thread exit.
+struct TraceBufferHolder
+{
+  TraceBuffer* Buffer = nullptr;
+
+  ~TraceBufferHolder()
+  {
+    if (Buffer != nullptr)
+    {
+      TraceRegistry&              aRegistry = TraceRegistry::Get();
+      std::lock_guard<std::mutex> aLock(aRegistry.Mutex);
+      Buffer->IsThreadDone = true;
+    }
+  }
+};
+
+thread_local TraceBufferHolder THE_BUFFER_HOLDER;
+
+//! Returns the buffer of the calling thread, creating it if needed.
+TraceBuffer* threadBuffer()
+{
+  TraceBuffer* aBuffer = THE_BUFFER_HOLDER.Buffer;
+  if (aBuffer == nullptr)
+  {
+    TraceRegistry& aRegistry = TraceRegistry::Get();
+    aBuffer                  = new TraceBuffer(aRegistry.BufferSize.load());
+    {
+      std::lock_guard<std::mutex> aLock(aRegistry.Mutex);
+      aRegistry.Buffers.push_back(aBuffer);
+    }
+    THE_BUFFER_HOLDER.Buffer = aBuffer;
+  }
+  return aBuffer;
+}
+
+//! Returns the index of the oldest zone kept by the buffer.
+uint64_t firstZone(const TraceBuffer& theBuffer, const uint64_t theNbZones)
+{
+  return theNbZones > uint64_t(theBuffer.Capacity) ? theNbZones - uint64_t(theBuffer.Capacity) : 0;
+}
+
+//! Copies the zone with the given index from the buffer, which may be written concurrently
+//! by its running thread (best effort, without locking the writer).
+//! @return false if the slot may have been overwritten during the copy or the zone is inconsistent
+bool readZone(const TraceBuffer& theBuffer, const uint64_t theIndex, TraceZone& theZone)
+{
+  theZone = theBuffer.Zones[theIndex % theBuffer.Capacity];
+  if (!theBuffer.IsThreadDone)
+  {
+    // the slot is reused for the zone theIndex + Capacity, which is written while
+    // the counter is equal to it, so that the copy is valid only if the counter is still lower
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (theBuffer.NbZones.load(std::memory_order_relaxed)
+        >= theIndex + uint64_t(theBuffer.Capacity))
+    {
+      return false;
+    }
+  }
+  return theZone.End >= theZone.Start;
+}
+
+//! Writes the string escaped for JSON.
+void writeJsonString(Standard_OStream& theStream, const char* theString)
+{
+  theStream << '"';
+  for (const char* aChar = theString; *aChar != '\0'; ++aChar)
+  {
+    if (*aChar == '"' || *aChar == '\\')
+    {
+      theStream << '\\' << *aChar;
+    }
+    else if (static_cast<unsigned char>(*aChar) >= 0x20)
+    {
+      theStream << *aChar;
+    }
+  }
+  theStream << '"';
+}
+
+//! Writes the time in nanoseconds as microseconds with three decimals.
+void writeMicroseconds(Standard_OStream& theStream, const uint64_t theTime)
+{
+  const unsigned int aFraction = static_cast<unsigned int>(theTime % 1000);
+  theStream << (theTime / 1000) << '.' << char('0' + aFraction / 100)
+            << char('0' + (aFraction / 10) % 10) << char('0' + aFraction % 10);
+}
+
+//! Enables tracing at startup and dumps the trace at exit if CSF_TraceFile is defined.
+struct TraceFileDumper
+{
+  TCollection_AsciiString FilePath;
+
+  TraceFileDumper()
+  {
+    // construct the registry before, so that it is destroyed after the dumper
+    TraceRegistry& aRegistry = TraceRegistry::Get();
+    const char*    aVar      = getenv("CSF_TraceFile");
+    if (aVar != nullptr && *aVar != '\0')
+    {
+      FilePath = aVar;
+      aRegistry.IsEnabled.store(true);
+    }
+  }
+
+  ~TraceFileDumper()
+  {
+    if (!FilePath.IsEmpty())
+    {
+      OSD_Tracer::DumpChromeTrace(FilePath);
+    }
+  }
+};
+
+static TraceFileDumper THE_TRACE_FILE_DUMPER;
+} // namespace
+
+//=================================================================================================
+
+bool OSD_Tracer::IsEnabled() noexcept
+{
+  return TraceRegistry::Get().IsEnabled.load(std::memory_order_relaxed);
+}
+
+//=================================================================================================
+
+void OSD_Tracer::SetEnabled(const bool theToEnable)
+{
+  TraceRegistry::Get().IsEnabled.store(theToEnable);
+}
+
+//=================================================================================================
+
+int OSD_Tracer::BufferSize()
+{
+  return TraceRegistry::Get().BufferSize.load();
+}
+
+//=================================================================================================
+
+void OSD_Tracer::SetBufferSize(const int theNbZones)
+{
+  TraceRegistry::Get().BufferSize.store(theNbZones > 0 ? theNbZones : 1);
+}
+
+//=================================================================================================
+
+void OSD_Tracer::SetThreadName(const TCollection_AsciiString& theName)
+{
+  TraceBuffer*                aBuffer = threadBuffer();
+  std::lock_guard<std::mutex> aLock(TraceRegistry::Get().Mutex);
+  aBuffer->ThreadName = theName;
+}
+
+//=================================================================================================
+
+void OSD_Tracer::Clear()
+{
+  TraceRegistry&              aRegistry = TraceRegistry::Get();
+  std::lock_guard<std::mutex> aLock(aRegistry.Mutex);
+  aRegistry.ClearTime.store(Now());
+
+  // buffers of running threads are kept, as they may be writing into them
+  std::vector<TraceBuffer*> aBuffers;
+  for (TraceBuffer* aBuffer : aRegistry.Buffers)
+  {
+    if (aBuffer->IsThreadDone)
+    {
+      delete aBuffer;
+    }
+    else
+    {
+      aBuffers.push_back(aBuffer);
+    }
+  }
+  aRegistry.Buffers.swap(aBuffers);
+}
+
+//=================================================================================================
+
+int OSD_Tracer::NbZones()
+{
+  TraceRegistry&              aRegistry  = TraceRegistry::Get();
+  const uint64_t              aClearTime = aRegistry.ClearTime.load();
+  std::lock_guard<std::mutex> aLock(aRegistry.Mutex);
+  int                         aNbZones = 0;
+  for (const TraceBuffer* aBuffer : aRegistry.Buffers)
+  {
+    const uint64_t aNbRecorded = aBuffer->NbZones.load(std::memory_order_acquire);
+    const uint64_t aFirst      = firstZone(*aBuffer, aNbRecorded);
+    TraceZone      aZone;
+    for (uint64_t anIndex = aFirst; anIndex < aNbRecorded; ++anIndex)
+    {
+      if (readZone(*aBuffer, anIndex, aZone) && aZone.Start >= aClearTime)
+      {
+        ++aNbZones;
+      }
+    }
+  }
+  return aNbZones;
+}
+
+//=================================================================================================
+
+void OSD_Tracer::DumpChromeTrace(Standard_OStream& theStream)
+{
+  TraceRegistry&              aRegistry  = TraceRegistry::Get();
+  const uint64_t              aClearTime = aRegistry.ClearTime.load();
+  const int                   aProcessId = OSD_Process().ProcessId();
+  std::lock_guard<std::mutex> aLock(aRegistry.Mutex);
+
+  // timestamps are written relative to the earliest zone
+  uint64_t anOrigin = uint64_t(-1);
+  for (const TraceBuffer* aBuffer : aRegistry.Buffers)
+  {
+    const uint64_t aNbRecorded = aBuffer->NbZones.load(std::memory_order_acquire);
+    const uint64_t aFirst      = firstZone(*aBuffer, aNbRecorded);
+    TraceZone      aZone;
+    for (uint64_t anIndex = aFirst; anIndex < aNbRecorded; ++anIndex)
+    {
+      if (readZone(*aBuffer, anIndex, aZone) && aZone.Start >= aClearTime
+          && aZone.Start < anOrigin)
+      {
+        anOrigin = aZone.Start;
+      }
+    }
+  }
+
+  theStream << "{\"traceEvents\":[";
+  bool isFirst = true;
+  for (const TraceBuffer* aBuffer : aRegistry.Buffers)
+  {
+    if (!aBuffer->ThreadName.IsEmpty())
+    {
+      theStream << (isFirst ? "\n" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":"
+                << aProcessId << ",\"tid\":" << aBuffer->ThreadId << ",\"args\":{\"name\":";
+      writeJsonString(theStream, aBuffer->ThreadName.ToCString());
+      theStream << "}}";
+      isFirst = false;
+    }
+
+    const uint64_t aNbRecorded = aBuffer->NbZones.load(std::memory_order_acquire);
+    const uint64_t aFirst      = firstZone(*aBuffer, aNbRecorded);
+    TraceZone      aZone;
+    for (uint64_t anIndex = aFirst; anIndex < aNbRecorded; ++anIndex)
+    {
+      if (!readZone(*aBuffer, anIndex, aZone) || aZone.Start < aClearTime || aZone.Start < anOrigin)
+      {
+        continue;
+      }
+
+      theStream << (isFirst ? "\n" : ",\n") << "{\"name\":";
+      writeJsonString(theStream, aZone.Name);
+      theStream << ",\"cat\":";
+      writeJsonString(theStream, aZone.Category);
+      theStream << ",\"ph\":\"X\",\"ts\":";
+      writeMicroseconds(theStream, aZone.Start - anOrigin);
+      theStream << ",\"dur\":";
+      writeMicroseconds(theStream, aZone.End - aZone.Start);
+      theStream << ",\"pid\":" << aProcessId << ",\"tid\":" << aBuffer->ThreadId << "}";
+      isFirst = false;
+    }
+  }
+  theStream << "\n],\"displayTimeUnit\":\"ns\"}\n";
+}
+
+//=================================================================================================
+
+bool OSD_Tracer::DumpChromeTrace(const TCollection_AsciiString& theFilePath)
+{
+  std::ofstream aFile;
+  OSD_OpenStream(aFile, theFilePath.ToCString(), std::ios::out | std::ios::trunc);
+  if (!aFile.is_open())
+  {
+    return false;
+  }
+  DumpChromeTrace(aFile);
+  aFile.close();
+  return !aFile.fail();
+}
+
+//=================================================================================================
+
+uint64_t OSD_Tracer::Now()
+{
+  return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                 std::chrono::steady_clock::now().time_since_epoch())
+                                 .count());
+}
+
+//=================================================================================================
+
+void OSD_Tracer::AddZone(const char*    theName,
+                         const char*    theCategory,
+                         const uint64_t theStart,
+                         const uint64_t theEnd)
+{
+  TraceBuffer*   aBuffer = threadBuffer();
+  const uint64_t anIndex = aBuffer->NbZones.load(std::memory_order_relaxed);
+  aBuffer->Zones[anIndex % aBuffer->Capacity] = TraceZone{theName, theCategory, theStart, theEnd};
+  aBuffer->NbZones.store(anIndex + 1, std::memory_order_release);
+}
@@ -0,0 +1,83 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef OSD_Tracer_HeaderFile
+#define OSD_Tracer_HeaderFile
+
+#include <Standard_OStream.hxx>
+#include <TCollection_AsciiString.hxx>
+
+#include <cstdint>
+
+//! Collector of timed zones of code execution marked by OSD_TraceZone.
+//!
+//! Each thread records its zones with nanosecond timestamps into its own ring
+//! buffer without any locking, so that the tracing can be used in parallel
+//! algorithms; when the buffer is full, the oldest zones are overwritten.
+//! Collected zones can be dumped into JSON format of Chrome trace viewer,
+//! which can be opened by chrome://tracing or https://ui.perfetto.dev.
+//!
+//! Tracing is disabled by default, so that each zone costs only a check of a flag.
+//! It is enabled either by SetEnabled() or by environment variable CSF_TraceFile:
+//! in the latter case, the collected zones are dumped into the specified file
+//! at exit of the process.
+class OSD_Tracer
+{
+public:
+  //! Returns true if tracing is enabled.
+  Standard_EXPORT static bool IsEnabled() noexcept;
+
+  //! Enables or disables tracing.
+  Standard_EXPORT static void SetEnabled(const bool theToEnable);
+
+  //! Returns the number of zones kept by the buffer of each thread.
+  Standard_EXPORT static int BufferSize();
+
+  //! Sets the number of zones kept by the buffer of each thread;
+  //! applies to the threads starting tracing after this call. Default is 16384.
+  Standard_EXPORT static void SetBufferSize(const int theNbZones);
+
+  //! Sets the name of the calling thread shown in the trace.
+  Standard_EXPORT static void SetThreadName(const TCollection_AsciiString& theName);
+
+  //! Discards all collected zones.
+  Standard_EXPORT static void Clear();
+
+  //! Returns the number of collected zones.
+  Standard_EXPORT static int NbZones();
+
+  //! Writes the collected zones into the stream in JSON format of Chrome trace viewer.
+  //! Dumping while other threads are tracing is best effort: the buffers of running threads
+  //! are read without locking them, so that the zones recorded concurrently may be missing,
+  //! and the zones overwritten during the dump are skipped.
+  Standard_EXPORT static void DumpChromeTrace(Standard_OStream& theStream);
+
+  //! Writes the collected zones into the file in JSON format of Chrome trace viewer.
+  //! @return false if the file cannot be written
+  Standard_EXPORT static bool DumpChromeTrace(const TCollection_AsciiString& theFilePath);
+
+  //! Returns the current timestamp in nanoseconds.
+  Standard_EXPORT static uint64_t Now();
+
+  //! Records the zone executed by the calling thread.
+  //! @param theName     name of the zone; should be a string literal, as only the pointer is kept
+  //! @param theCategory category of the zone; should be a string literal
+  //! @param theStart    timestamp of the zone start returned by Now()
+  //! @param theEnd      timestamp of the zone end returned by Now()
+  Standard_EXPORT static void AddZone(const char*    theName,
+                                      const char*    theCategory,
+                                      const uint64_t theStart,
+                                      const uint64_t theEnd);
+};
+
+#endif // OSD_Tracer_HeaderFile
@@ -14,6 +14,7 @@
 #include <Standard.hxx>
 
 #include <Standard_OutOfMemory.hxx>
+#include <Standard_MMgrThreadCache.hxx>
 
 #include <cstdlib>
 
@@ -295,6 +296,18 @@ Standard_MMgrFactory::Standard_MMgrFactory()
     case 2: // TBB memory allocator
       myFMMgr = new Standard_MMgrTBBalloc(toClear);
       break;
+    case 4: // OCCT memory allocator with thread caches
+    {
+      aVar               = getenv("MMGT_CELLSIZE");
+      int aCellSize      = (aVar ? atoi(aVar) : 256);
+      aVar               = getenv("MMGT_BATCHSIZE");
+      int aBatchSize     = (aVar ? atoi(aVar) : 32);
+      aVar               = getenv("MMGT_ARENASIZE");
+      size_t anArenaSize = size_t(aVar ? atoi(aVar) : 1024) * 1024;
+
+      myFMMgr = new Standard_MMgrThreadCache(toClear, aCellSize, aBatchSize, anArenaSize);
+      break;
+    }
     case 0:
     default: // system default memory allocator
       myFMMgr = new Standard_MMgrRaw(toClear);
@@ -368,6 +381,20 @@ Standard::AllocatorType Standard::GetAllocatorType()
 
 //=================================================================================================
 
+Standard_MMgrThreadCache* Standard_MMgrThreadCache::DefaultManager()
+{
+#ifdef OCCT_MMGT_OPT_FLEXIBLE
+  Standard_MMgrRoot* aMMgr = Standard_MMgrFactory::GetMMgr();
+  return allocatorTypeInstance() == Standard::AllocatorType::THREADCACHE
+           ? static_cast<Standard_MMgrThreadCache*>(aMMgr)
+           : nullptr;
+#else
+  return nullptr;
+#endif
+}
+
+//=================================================================================================
+
 void* Standard::Allocate(const size_t theSize)
 {
 #ifdef OCCT_MMGT_OPT_FLEXIBLE
@@ -31,10 +31,11 @@ public:
   //! Enumiration of possible allocator types
   enum class AllocatorType
   {
-    NATIVE   = 0,
-    OPT      = 1,
-    TBB      = 2,
-    JEMALLOC = 3
+    NATIVE      = 0,
+    OPT         = 1,
+    TBB         = 2,
+    JEMALLOC    = 3,
+    THREADCACHE = 4
   };
 
   //! Returns default allocator type
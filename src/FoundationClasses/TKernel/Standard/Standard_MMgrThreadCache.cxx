@@ -0,0 +1,618 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <Standard_MMgrThreadCache.hxx>
+#include <Standard_OutOfMemory.hxx>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+//! Maximal number of size classes of small blocks.
+constexpr size_t THE_MAX_NB_CLASSES = 64;
+
+//! Step of the sizes of blocks.
+constexpr size_t THE_ROUNDING = 16;
+
+//! Size of the header of a block holding its size.
+constexpr size_t THE_HEADER_SIZE = sizeof(size_t);
+
+//! Size of the header of an arena holding the link to the next arena.
+constexpr size_t THE_ARENA_HEADER_SIZE = THE_ROUNDING;
+
+//! Returns the size of the block including the header, rounded up to THE_ROUNDING.
+inline size_t roundSize(const size_t theSize)
+{
+  return (theSize + THE_HEADER_SIZE + THE_ROUNDING - 1) & ~(THE_ROUNDING - 1);
+}
+
+//! Returns the next block in a list of free blocks, linked through their headers.
+inline size_t* nextBlock(const size_t* theBlock)
+{
+  return reinterpret_cast<size_t*>(theBlock[0]);
+}
+
+//! Adds a value to a counter modified only by the owning thread.
+inline void addCounter(std::atomic<size_t>& theCounter, const size_t theValue)
+{
+  theCounter.store(theCounter.load(std::memory_order_relaxed) + theValue,
+                   std::memory_order_relaxed);
+}
+
+//! Cache of the calling thread used by the last call to a memory manager.
+thread_local void* THE_LAST_CACHE = nullptr;
+
+//! Set when the caches of the calling thread are released at thread exit.
+thread_local bool THE_IS_THREAD_EXITING = false;
+} // namespace
+
+//! Free lists of small blocks used by a single thread.
+struct Standard_MMgrThreadCache::ThreadCache
+{
+  //! List of free blocks of one size class.
+  struct FreeList
+  {
+    size_t* Head;
+    int     NbBlocks;
+  };
+
+  SharedState* Shared       = nullptr; //!< state of the owning memory manager
+  ThreadCache* NextInShared = nullptr; //!< next cache of the same memory manager
+  ThreadCache* NextInThread = nullptr; //!< next cache bound to the same thread
+  bool         IsBound      = false;   //!< flag indicating that the cache is used by a thread
+  char*        ArenaNext    = nullptr; //!< next free address in the active arena
+  char*        ArenaEnd     = nullptr; //!< end of the active arena
+  FreeList     Lists[THE_MAX_NB_CLASSES] = {};
+
+  std::atomic<size_t> NbAllocations{0};
+  std::atomic<size_t> NbFrees{0};
+  std::atomic<size_t> AllocatedBytes{0};
+  std::atomic<size_t> FreedBytes{0};
+  std::atomic<size_t> CachedBytes{0};
+  std::atomic<size_t> ArenaBytes{0};
+  std::atomic<size_t> NbFetches{0};
+  std::atomic<size_t> NbReturns{0};
+
+  //! Resets the counters of the cache.
+  void ResetStatistics()
+  {
+    NbAllocations.store(0, std::memory_order_relaxed);
+    NbFrees.store(0, std::memory_order_relaxed);
+    AllocatedBytes.store(0, std::memory_order_relaxed);
+    FreedBytes.store(0, std::memory_order_relaxed);
+    ArenaBytes.store(0, std::memory_order_relaxed);
+    NbFetches.store(0, std::memory_order_relaxed);
+    NbReturns.store(0, std::memory_order_relaxed);
+  }
+
+  //! Copies the counters of the cache.
+  void FillStatistics(ThreadStatistics& theStats) const
+  {
+    theStats.NbAllocations  = NbAllocations.load(std::memory_order_relaxed);
+    theStats.NbFrees        = NbFrees.load(std::memory_order_relaxed);
+    theStats.AllocatedBytes = AllocatedBytes.load(std::memory_order_relaxed);
+    theStats.FreedBytes     = FreedBytes.load(std::memory_order_relaxed);
+    theStats.CachedBytes    = CachedBytes.load(std::memory_order_relaxed);
+    theStats.ArenaBytes     = ArenaBytes.load(std::memory_order_relaxed);
+    theStats.NbFetches      = NbFetches.load(std::memory_order_relaxed);
+    theStats.NbReturns      = NbReturns.load(std::memory_order_relaxed);
+  }
+};
+
+//! State of the memory manager shared with the threads using it,
+//! which may exit after destruction of the memory manager.
+struct Standard_MMgrThreadCache::SharedState
+{
+  std::mutex                Mutex;             //!< mutex protecting the fields below
+  Standard_MMgrThreadCache* Manager = nullptr; //!< memory manager, NULL once destroyed
+  ThreadCache*              Caches  = nullptr; //!< list of all caches of the memory manager
+  int                       NbRefs  = 1;       //!< memory manager and bound caches
+};
+
+//! Central pool of free blocks of one size class, kept as a stack of batches;
+//! blocks of a batch are linked through their headers, and batches are linked
+//! through the word following the header of their first block.
+struct Standard_MMgrThreadCache::CentralList
+{
+  std::mutex Mutex;
+  size_t*    Batches = nullptr;
+};
+
+//! Caches bound to a thread; returns their blocks to the central pools at thread exit.
+struct Standard_MMgrThreadCache::ThreadCacheHolder
+{
+  ThreadCache* Caches = nullptr;
+
+  ~ThreadCacheHolder()
+  {
+    THE_IS_THREAD_EXITING = true;
+    THE_LAST_CACHE        = nullptr;
+    for (ThreadCache* aCache = Caches; aCache != nullptr;)
+    {
+      ThreadCache* aNext          = aCache->NextInThread;
+      SharedState* aShared        = aCache->Shared;
+      bool         toDeleteShared = false;
+      {
+        std::lock_guard<std::mutex> aLock(aShared->Mutex);
+        if (aShared->Manager != nullptr)
+        {
+          aShared->Manager->flushCache(aCache);
+          aCache->IsBound      = false;
+          aCache->NextInThread = nullptr;
+        }
+        else
+        {
+          delete aCache;
+        }
+        toDeleteShared = --aShared->NbRefs == 0;
+      }
+      if (toDeleteShared)
+      {
+        delete aShared;
+      }
+      aCache = aNext;
+    }
+  }
+};
+
+//=================================================================================================
+
+Standard_MMgrThreadCache::Standard_MMgrThreadCache(const bool   theToClear,
+                                                   const size_t theCellSize,
+                                                   const int    theBatchSize,
+                                                   const size_t theArenaSize)
+    : myClear(theToClear),
+      myCellSize(std::min(roundSize(theCellSize), THE_MAX_NB_CLASSES * THE_ROUNDING)),
+      myBatchSize(std::max(theBatchSize, 1)),
+      myArenaSize(theArenaSize),
+      myCentral(new CentralList[THE_MAX_NB_CLASSES]),
+      myShared(new SharedState()),
+      myExitCache(new ThreadCache()),
+      myArenas(nullptr)
+{
+  myShared->Manager = this;
+}
+
+//=================================================================================================
+
+Standard_MMgrThreadCache::~Standard_MMgrThreadCache()
+{
+  bool toDeleteShared = false;
+  {
+    // caches still bound to running threads are deleted at their exit
+    std::lock_guard<std::mutex> aLock(myShared->Mutex);
+    myShared->Manager = nullptr;
+    for (ThreadCache** aLink = &myShared->Caches; *aLink != nullptr;)
+    {
+      ThreadCache* aCache = *aLink;
+      if (aCache->IsBound)
+      {
+        aLink = &aCache->NextInShared;
+      }
+      else
+      {
+        *aLink = aCache->NextInShared;
+        delete aCache;
+      }
+    }
+    toDeleteShared = --myShared->NbRefs == 0;
+  }
+  if (toDeleteShared)
+  {
+    delete myShared;
+  }
+  delete myExitCache;
+  delete[] myCentral;
+
+  for (void* anArena = myArenas; anArena != nullptr;)
+  {
+    void* aNext = *static_cast<void**>(anArena);
+    free(anArena);
+    anArena = aNext;
+  }
+}
+
+//=================================================================================================
+
+Standard_MMgrThreadCache::ThreadCacheHolder* Standard_MMgrThreadCache::threadCacheHolder()
+{
+  if (THE_IS_THREAD_EXITING)
+  {
+    return nullptr;
+  }
+  static thread_local ThreadCacheHolder THE_HOLDER;
+  return &THE_HOLDER;
+}
+
+//=================================================================================================
+
+inline Standard_MMgrThreadCache::ThreadCache* Standard_MMgrThreadCache::threadCache()
+{
+  ThreadCache* aCache = static_cast<ThreadCache*>(THE_LAST_CACHE);
+  if (aCache != nullptr && aCache->Shared == myShared)
+  {
+    return aCache;
+  }
+  return bindThreadCache();
+}
+
+//=================================================================================================
+
+Standard_MMgrThreadCache::ThreadCache* Standard_MMgrThreadCache::bindThreadCache()
+{
+  ThreadCacheHolder* aHolder = threadCacheHolder();
+  if (aHolder == nullptr)
+  {
+    return nullptr;
+  }
+
+  for (ThreadCache* aCache = aHolder->Caches; aCache != nullptr; aCache = aCache->NextInThread)
+  {
+    if (aCache->Shared == myShared)
+    {
+      THE_LAST_CACHE = aCache;
+      return aCache;
+    }
+  }
+
+  ThreadCache* aCache = nullptr;
+  {
+    // reuse the cache released by an exited thread, keeping its free blocks and arena
+    std::lock_guard<std::mutex> aLock(myShared->Mutex);
+    for (aCache = myShared->Caches; aCache != nullptr && aCache->IsBound;
+         aCache = aCache->NextInShared)
+    {
+    }
+    if (aCache == nullptr)
+    {
+      aCache               = new ThreadCache();
+      aCache->Shared       = myShared;
+      aCache->NextInShared = myShared->Caches;
+      myShared->Caches     = aCache;
+    }
+    aCache->IsBound = true;
+    aCache->ResetStatistics();
+    ++myShared->NbRefs;
+  }
+  aCache->NextInThread = aHolder->Caches;
+  aHolder->Caches      = aCache;
+  THE_LAST_CACHE       = aCache;
+  return aCache;
+}
+
+//=================================================================================================
+
+void* Standard_MMgrThreadCache::Allocate(const size_t theSize)
+{
+  if (theSize > size_t(-1) - 2 * THE_ROUNDING)
+  {
+    throw Standard_OutOfMemory("Standard_MMgrThreadCache::Allocate(): size is too large");
+  }
+
+  const size_t aRoundSize = roundSize(theSize);
+  ThreadCache* aCache     = threadCache();
+  size_t*      aBlock     = nullptr;
+  if (aRoundSize > myCellSize)
+  {
+    aBlock = static_cast<size_t*>(myClear ? calloc(aRoundSize, sizeof(char)) : malloc(aRoundSize));
+    if (aBlock == nullptr)
+    {
+      throw Standard_OutOfMemory("Standard_MMgrThreadCache::Allocate(): malloc failed");
+    }
+    aBlock[0] = aRoundSize;
+  }
+  else
+  {
+    if (aCache != nullptr)
+    {
+      aBlock = allocateSmall(aCache, aRoundSize / THE_ROUNDING - 1);
+    }
+    else
+    {
+      std::lock_guard<std::mutex> aLock(myExitMutex);
+      aBlock = allocateSmall(myExitCache, aRoundSize / THE_ROUNDING - 1);
+    }
+    if (myClear)
+    {
+      memset(aBlock + 1, 0, aRoundSize - THE_HEADER_SIZE);
+    }
+  }
+
+  if (aCache != nullptr)
+  {
+    addCounter(aCache->NbAllocations, 1);
+    addCounter(aCache->AllocatedBytes, aRoundSize);
+  }
+  return aBlock + 1;
+}
+
+//=================================================================================================
+
+void Standard_MMgrThreadCache::Free(void* thePtr)
+{
+  if (thePtr == nullptr)
+  {
+    return;
+  }
+
+  size_t*      aBlock     = static_cast<size_t*>(thePtr) - 1;
+  const size_t aRoundSize = aBlock[0];
+  ThreadCache* aCache     = threadCache();
+  if (aCache != nullptr)
+  {
+    addCounter(aCache->NbFrees, 1);
+    addCounter(aCache->FreedBytes, aRoundSize);
+  }
+
+  if (aRoundSize > myCellSize)
+  {
+    free(aBlock);
+  }
+  else if (aCache != nullptr)
+  {
+    freeSmall(aCache, aRoundSize / THE_ROUNDING - 1, aBlock);
+  }
+  else
+  {
+    std::lock_guard<std::mutex> aLock(myExitMutex);
+    freeSmall(myExitCache, aRoundSize / THE_ROUNDING - 1, aBlock);
+  }
+}
+
+//=================================================================================================
+
+void* Standard_MMgrThreadCache::Reallocate(void* thePtr, const size_t theSize)
+{
+  if (thePtr == nullptr)
+  {
+    return Allocate(theSize);
+  }
+
+  size_t*      aBlock   = static_cast<size_t*>(thePtr) - 1;
+  const size_t anOldSize = aBlock[0];
+  const size_t aNewSize  = roundSize(theSize);
+  if (aNewSize == anOldSize)
+  {
+    return thePtr;
+  }
+
+  if (anOldSize > myCellSize && aNewSize > myCellSize)
+  {
+    size_t* aNewBlock = static_cast<size_t*>(realloc(aBlock, aNewSize));
+    if (aNewBlock == nullptr)
+    {
+      throw Standard_OutOfMemory("Standard_MMgrThreadCache::Reallocate(): realloc failed");
+    }
+    aNewBlock[0] = aNewSize;
+    if (ThreadCache* aCache = threadCache())
+    {
+      addCounter(aCache->AllocatedBytes, aNewSize);
+      addCounter(aCache->FreedBytes, anOldSize);
+    }
+    return aNewBlock + 1;
+  }
+
+  void* aNewPtr = Allocate(theSize);
+  memcpy(aNewPtr, thePtr, std::min(anOldSize, aNewSize) - THE_HEADER_SIZE);
+  Free(thePtr);
+  return aNewPtr;
+}
+
+//=================================================================================================
+
+int Standard_MMgrThreadCache::Purge(bool)
+{
+  if (ThreadCache* aCache = threadCache())
+  {
+    flushCache(aCache);
+  }
+  return 0;
+}
+
+//=================================================================================================
+
+size_t* Standard_MMgrThreadCache::allocateSmall(ThreadCache* theCache, const size_t theClass)
+{
+  ThreadCache::FreeList& aList = theCache->Lists[theClass];
+  if (aList.Head == nullptr)
+  {
+    refill(theCache, theClass);
+  }
+
+  const size_t aSize  = (theClass + 1) * THE_ROUNDING;
+  size_t*      aBlock = aList.Head;
+  aList.Head          = nextBlock(aBlock);
+  --aList.NbBlocks;
+  aBlock[0] = aSize;
+  addCounter(theCache->CachedBytes, size_t(0) - aSize);
+  return aBlock;
+}
+
+//=================================================================================================
+
+void Standard_MMgrThreadCache::freeSmall(ThreadCache* theCache,
+                                         const size_t theClass,
+                                         size_t*      theBlock)
+{
+  const size_t           aSize = (theClass + 1) * THE_ROUNDING;
+  ThreadCache::FreeList& aList = theCache->Lists[theClass];
+  theBlock[0]                  = reinterpret_cast<size_t>(aList.Head);
+  aList.Head                   = theBlock;
+  addCounter(theCache->CachedBytes, aSize);
+  if (++aList.NbBlocks < 2 * myBatchSize)
+  {
+    return;
+  }
+
+  // keep the recently freed blocks and return the older half of the list
+  size_t* aLast = aList.Head;
+  for (int anIndex = 1; anIndex < myBatchSize; ++anIndex)
+  {
+    aLast = nextBlock(aLast);
+  }
+  size_t* aBatch = nextBlock(aLast);
+  aLast[0]       = 0;
+  aList.NbBlocks = myBatchSize;
+
+  CentralList& aCentral = myCentral[theClass];
+  {
+    std::lock_guard<std::mutex> aLock(aCentral.Mutex);
+    aBatch[1]         = reinterpret_cast<size_t>(aCentral.Batches);
+    aCentral.Batches = aBatch;
+  }
+  addCounter(theCache->CachedBytes, size_t(0) - aSize * myBatchSize);
+  addCounter(theCache->NbReturns, 1);
+}
+
+//=================================================================================================
+
+void Standard_MMgrThreadCache::refill(ThreadCache* theCache, const size_t theClass)
+{
+  CentralList& aCentral = myCentral[theClass];
+  size_t*      aBatch   = nullptr;
+  {
+    std::lock_guard<std::mutex> aLock(aCentral.Mutex);
+    aBatch = aCentral.Batches;
+    if (aBatch != nullptr)
+    {
+      aCentral.Batches = reinterpret_cast<size_t*>(aBatch[1]);
+    }
+  }
+
+  const size_t aSize     = (theClass + 1) * THE_ROUNDING;
+  int          aNbBlocks = 0;
+  if (aBatch != nullptr)
+  {
+    for (const size_t* aBlock = aBatch; aBlock != nullptr; aBlock = nextBlock(aBlock))
+    {
+      ++aNbBlocks;
+    }
+    addCounter(theCache->NbFetches, 1);
+  }
+  else
+  {
+    // carve new blocks from the arena of the thread
+    char* aMemory = allocateArena(theCache, aSize * myBatchSize);
+    for (int anIndex = myBatchSize - 1; anIndex >= 0; --anIndex)
+    {
+      size_t* aBlock = reinterpret_cast<size_t*>(aMemory + anIndex * aSize);
+      aBlock[0]      = reinterpret_cast<size_t>(aBatch);
+      aBatch         = aBlock;
+    }
+    aNbBlocks = myBatchSize;
+  }
+
+  ThreadCache::FreeList& aList = theCache->Lists[theClass];
+  aList.Head                   = aBatch;
+  aList.NbBlocks               = aNbBlocks;
+  addCounter(theCache->CachedBytes, aSize * aNbBlocks);
+}
+
+//=================================================================================================
+
+void Standard_MMgrThreadCache::flushCache(ThreadCache* theCache)
+{
+  for (size_t aClass = 0; aClass < THE_MAX_NB_CLASSES; ++aClass)
+  {
+    ThreadCache::FreeList& aList = theCache->Lists[aClass];
+    if (aList.Head == nullptr)
+    {
+      continue;
+    }
+
+    CentralList& aCentral = myCentral[aClass];
+    {
+      std::lock_guard<std::mutex> aLock(aCentral.Mutex);
+      aList.Head[1]    = reinterpret_cast<size_t>(aCentral.Batches);
+      aCentral.Batches = aList.Head;
+    }
+    aList.Head     = nullptr;
+    aList.NbBlocks = 0;
+    addCounter(theCache->NbReturns, 1);
+  }
+  theCache->CachedBytes.store(0, std::memory_order_relaxed);
+}
+
+//=================================================================================================
+
+char* Standard_MMgrThreadCache::allocateArena(ThreadCache* theCache, const size_t theSize)
+{
+  if (size_t(theCache->ArenaEnd - theCache->ArenaNext) < theSize)
+  {
+    const size_t anArenaSize = std::max(myArenaSize, theSize + THE_ARENA_HEADER_SIZE);
+    char*        anArena     = static_cast<char*>(malloc(anArenaSize));
+    if (anArena == nullptr)
+    {
+      throw Standard_OutOfMemory("Standard_MMgrThreadCache::Allocate(): malloc failed");
+    }
+    {
+      std::lock_guard<std::mutex> aLock(myArenaMutex);
+      *reinterpret_cast<void**>(anArena) = myArenas;
+      myArenas                           = anArena;
+    }
+    theCache->ArenaNext = anArena + THE_ARENA_HEADER_SIZE;
+    theCache->ArenaEnd  = anArena + anArenaSize;
+    addCounter(theCache->ArenaBytes, anArenaSize);
+  }
+
+  char* aMemory = theCache->ArenaNext;
+  theCache->ArenaNext += theSize;
+  return aMemory;
+}
+
+//=================================================================================================
+
+bool Standard_MMgrThreadCache::CurrentThreadStatistics(ThreadStatistics& theStats) const
+{
+  ThreadCacheHolder* aHolder = threadCacheHolder();
+  if (aHolder == nullptr)
+  {
+    return false;
+  }
+
+  for (const ThreadCache* aCache = aHolder->Caches; aCache != nullptr;
+       aCache                    = aCache->NextInThread)
+  {
+    if (aCache->Shared == myShared)
+    {
+      aCache->FillStatistics(theStats);
+      return true;
+    }
+  }
+  return false;
+}
+
+//=================================================================================================
+
+int Standard_MMgrThreadCache::Statistics(ThreadStatistics* theStats, const int theNbStats) const
+{
+  std::lock_guard<std::mutex> aLock(myShared->Mutex);
+  int                         aNbThreads = 0;
+  for (const ThreadCache* aCache = myShared->Caches; aCache != nullptr;
+       aCache                    = aCache->NextInShared)
+  {
+    if (!aCache->IsBound)
+    {
+      continue;
+    }
+    if (aNbThreads < theNbStats)
+    {
+      aCache->FillStatistics(theStats[aNbThreads]);
+    }
+    ++aNbThreads;
+  }
+  return aNbThreads;
+}
@@ -0,0 +1,160 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _Standard_MMgrThreadCache_HeaderFile
+#define _Standard_MMgrThreadCache_HeaderFile
+
+#include <Standard_MMgrRoot.hxx>
+
+#include <mutex>
+
+/**
+ * @brief Open CASCADE memory manager with per-thread caches of small blocks.
+ *
+ * Unlike Standard_MMgrOpt, which protects its free lists by a single mutex,
+ * this memory manager lets each thread allocate and free small blocks
+ * without any locking:
+ *
+ * - Small blocks with size less than or equal to theCellSize (limited
+ *   to 1016 bytes) are distributed over size classes with a step of 16 bytes.
+ *   Each thread keeps its own free list for every size class.
+ *   A block freed by any thread is put into the cache of that thread.
+ *
+ * - When a cache list grows above 2 * theBatchSize blocks, a batch of
+ *   theBatchSize blocks is returned to the central pool of the size class
+ *   in one locked operation; an empty cache list takes a whole batch back
+ *   from the central pool, so that the central mutexes are rarely touched.
+ *
+ * - New small blocks are carved from arenas of theArenaSize bytes
+ *   allocated by the thread itself. Each arena is thus first written
+ *   by the thread using it, which places its pages on the NUMA node
+ *   of that thread with the default first-touch policy of the system.
+ *   Arenas are released to the system only by the destructor.
+ *
+ * - Large blocks are allocated and freed directly by malloc() and free().
+ *
+ * When a thread exits, the blocks of its cache are returned to the
+ * central pool and the cache is reused by the next new thread.
+ *
+ * As in Standard_MMgrOpt, 8 bytes are added at the beginning of each
+ * block to hold its size.
+ *
+ * The manager counts allocations and deallocations of each thread,
+ * see ThreadStatistics; the counters of the calling thread are also
+ * reported by OSD_MemInfo when this manager is used by Standard::Allocate().
+ */
+class Standard_MMgrThreadCache : public Standard_MMgrRoot
+{
+public:
+  //! Allocation statistics of a single thread.
+  struct ThreadStatistics
+  {
+    size_t NbAllocations;  //!< number of blocks allocated by the thread
+    size_t NbFrees;        //!< number of blocks freed by the thread
+    size_t AllocatedBytes; //!< total size of blocks allocated by the thread
+    size_t FreedBytes;     //!< total size of blocks freed by the thread
+    size_t CachedBytes;    //!< size of free blocks kept in the cache of the thread
+    size_t ArenaBytes;     //!< size of arenas allocated by the thread
+    size_t NbFetches;      //!< number of batches taken from the central pool
+    size_t NbReturns;      //!< number of batches returned to the central pool
+  };
+
+public:
+  //! Returns the memory manager used by Standard::Allocate() if it is
+  //! Standard_MMgrThreadCache (MMGT_OPT is 4), or NULL otherwise.
+  Standard_EXPORT static Standard_MMgrThreadCache* DefaultManager();
+
+public:
+  //! Constructor. If theToClear is True, the allocated memory will be
+  //! nullified. For description of other parameters, see description
+  //! of the class above.
+  Standard_EXPORT Standard_MMgrThreadCache(const bool   theToClear   = true,
+                                           const size_t theCellSize  = 256,
+                                           const int    theBatchSize = 32,
+                                           const size_t theArenaSize = 1024 * 1024);
+
+  //! Frees arenas allocated for small blocks
+  Standard_EXPORT ~Standard_MMgrThreadCache() override;
+
+  //! Allocate theSize bytes; see class description above
+  Standard_EXPORT void* Allocate(const size_t theSize) override;
+
+  //! Reallocate previously allocated thePtr to a new size; new address is returned.
+  //! In case that thePtr is null, the function behaves exactly as Allocate.
+  Standard_EXPORT void* Reallocate(void* thePtr, const size_t theSize) override;
+
+  //! Free previously allocated block; small blocks are kept in the cache of the calling thread.
+  Standard_EXPORT void Free(void* thePtr) override;
+
+  //! Return the blocks cached by the calling thread to the central pool.
+  //! Arenas are not released, so that the method always returns 0.
+  Standard_EXPORT int Purge(bool isDestroyed) override;
+
+  //! Fills the statistics of the calling thread.
+  //! @return false if the thread has not used this memory manager yet
+  Standard_EXPORT bool CurrentThreadStatistics(ThreadStatistics& theStats) const;
+
+  //! Fills the statistics of the threads currently using this memory manager.
+  //! @param theStats   array to fill
+  //! @param theNbStats size of the array
+  //! @return number of threads, which may be greater than theNbStats
+  Standard_EXPORT int Statistics(ThreadStatistics* theStats, const int theNbStats) const;
+
+private:
+  struct ThreadCache;
+  struct ThreadCacheHolder;
+  struct SharedState;
+  struct CentralList;
+
+  //! Returns the list of caches bound to the calling thread, or NULL if the thread is exiting.
+  static ThreadCacheHolder* threadCacheHolder();
+
+  //! Returns the cache of the calling thread, or NULL if the thread is exiting.
+  ThreadCache* threadCache();
+
+  //! Finds or creates the cache of the calling thread.
+  ThreadCache* bindThreadCache();
+
+  //! Takes a small block of the given size class from the cache.
+  size_t* allocateSmall(ThreadCache* theCache, const size_t theClass);
+
+  //! Puts a small block of the given size class into the cache.
+  void freeSmall(ThreadCache* theCache, const size_t theClass, size_t* theBlock);
+
+  //! Fills the empty cache list of the given size class.
+  void refill(ThreadCache* theCache, const size_t theClass);
+
+  //! Returns all blocks of the cache to the central pool.
+  void flushCache(ThreadCache* theCache);
+
+  //! Returns the unused arena memory of the cache, allocating a new arena if needed.
+  char* allocateArena(ThreadCache* theCache, const size_t theSize);
+
+private:
+  Standard_MMgrThreadCache(const Standard_MMgrThreadCache&)            = delete;
+  Standard_MMgrThreadCache& operator=(const Standard_MMgrThreadCache&) = delete;
+
+private:
+  bool         myClear;      //!< option to clear allocated memory
+  size_t       myCellSize;   //!< maximal rounded size of small blocks, including the header
+  int          myBatchSize;  //!< number of blocks moved from and to the central pool at once
+  size_t       myArenaSize;  //!< size of arenas for small blocks
+  CentralList* myCentral;    //!< central pools of free blocks per size class
+  SharedState* myShared;     //!< thread caches, shared with exiting threads
+  ThreadCache* myExitCache;  //!< cache used by threads after destruction of their caches
+  std::mutex   myExitMutex;  //!< mutex protecting myExitCache
+  void*        myArenas;     //!< list of allocated arenas
+  std::mutex   myArenaMutex; //!< mutex protecting the list of arenas
+};
+
+#endif
@@ -393,6 +393,7 @@ void BOPAlgo_BOP::Perform(const Message_ProgressRange& theRange)
   pPF->SetNonDestructive(myNonDestructive);
   pPF->SetGlue(myGlue);
   pPF->SetUseOBB(myUseOBB);
+  pPF->SetStatistics(myStatistics);
   //
   pPF->Perform(aPS.Next(9));
   //
@@ -25,6 +25,7 @@
 #include <BOPTools_AlgoTools.hxx>
 #include <BRep_Builder.hxx>
 #include <IntTools_Context.hxx>
+#include <IntTools_SharedCache.hxx>
 #include <Standard_ErrorHandler.hxx>
 #include <Standard_Failure.hxx>
 #include <TopExp.hxx>
@@ -36,6 +37,7 @@
 #include <NCollection_IndexedMap.hxx>
 #include <TopoDS_Shape.hxx>
 #include <NCollection_Map.hxx>
+#include <OSD_TraceZone.hxx>
 
 //=================================================================================================
 
@@ -192,6 +194,7 @@ void BOPAlgo_Builder::Perform(const Message_ProgressRange& theRange)
   pPF->SetNonDestructive(myNonDestructive);
   pPF->SetGlue(myGlue);
   pPF->SetUseOBB(myUseOBB);
+  pPF->SetStatistics(myStatistics);
   //
   pPF->Perform(aPS.Next(9));
   //
@@ -230,6 +233,12 @@ void BOPAlgo_Builder::PerformInternal(const BOPAlgo_PaveFiller&    theFiller,
   {
     AddError(new BOPAlgo_AlertBuilderFailed);
   }
+  //
+  if (!myStatistics.IsNull() && !myContext.IsNull() && !myContext->SharedCache().IsNull())
+  {
+    const occ::handle<IntTools_SharedCache>& aCache = myContext->SharedCache();
+    myStatistics->SetCache("IntTools_SharedCache", aCache->NbHits(), aCache->NbMisses());
+  }
 }
 
 //=================================================================================================
@@ -316,6 +325,7 @@ void BOPAlgo_Builder::fillPISteps(BOPAlgo_PISteps& theSteps) const
 void BOPAlgo_Builder::PerformInternal1(const BOPAlgo_PaveFiller&    theFiller,
                                        const Message_ProgressRange& theRange)
 {
+  OSD_TRACE_ZONE_CATEGORY("BOPAlgo_Builder::PerformInternal1", "bop");
   myPaveFiller     = (BOPAlgo_PaveFiller*)&theFiller;
   myDS             = myPaveFiller->PDS();
   myContext        = myPaveFiller->Context();
@@ -455,6 +465,8 @@ void BOPAlgo_Builder::PerformInternal1(const BOPAlgo_PaveFiller&    theFiller,
 
 void BOPAlgo_Builder::PostTreat(const Message_ProgressRange& theRange)
 {
+  const BOPAlgo_Statistics::Phase aPhase(myStatistics, "PostTreat");
+
   int                                                           i, aNbS;
   TopAbs_ShapeEnum                                              aType;
   NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> aMA;
@@ -33,6 +33,7 @@
 #include <NCollection_List.hxx>
 #include <TopTools_ShapeMapHasher.hxx>
 #include <NCollection_Map.hxx>
+#include <OSD_TraceZone.hxx>
 
 //=================================================================================================
 
@@ -67,6 +68,9 @@ void BOPAlgo_Builder::FillImagesVertices(const Message_ProgressRange& theRange)
 
 void BOPAlgo_Builder::FillImagesEdges(const Message_ProgressRange& theRange)
 {
+  OSD_TRACE_ZONE_CATEGORY("BOPAlgo_Builder::FillImagesEdges", "bop");
+  const BOPAlgo_Statistics::Phase aPhase(myStatistics, "FillImagesEdges");
+
   int                   i, aNbS = myDS->NbSourceShapes();
   Message_ProgressScope aPS(theRange, "Filling splits of edges", aNbS);
   for (i = 0; i < aNbS; ++i, aPS.Next())
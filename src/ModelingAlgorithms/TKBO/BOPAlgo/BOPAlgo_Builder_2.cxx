@@ -47,6 +47,7 @@
 #include <TopoDS_Face.hxx>
 #include <TopoDS_Shape.hxx>
 #include <TopoDS_Vertex.hxx>
+#include <OSD_TraceZone.hxx>
 
 #include <algorithm>
 //
@@ -213,6 +214,7 @@ typedef NCollection_Vector<BOPAlgo_VFI> BOPAlgo_VectorOfVFI;
 
 void BOPAlgo_Builder::FillImagesFaces(const Message_ProgressRange& theRange)
 {
+  OSD_TRACE_ZONE_CATEGORY("BOPAlgo_Builder::FillImagesFaces", "bop");
   Message_ProgressScope aPS(theRange, "Filling splits of faces", 10);
   BuildSplitFaces(aPS.Next(9));
   if (HasErrors())
@@ -231,6 +233,8 @@ void BOPAlgo_Builder::FillImagesFaces(const Message_ProgressRange& theRange)
 
 void BOPAlgo_Builder::BuildSplitFaces(const Message_ProgressRange& theRange)
 {
+  const BOPAlgo_Statistics::Phase aPhase(myStatistics, "BuildSplitFaces");
+
   bool                                     bHasFaceInfo, bIsClosed, bIsDegenerated, bToReverse;
   int                                      i, j, k, aNbS, aNbPBIn, aNbPBOn, aNbPBSc, aNbAV, nSp;
   TopoDS_Face                              aFF, aFSD;
@@ -570,6 +574,8 @@ static void AddEdgeSet(const TopoDS_Shape&                           theS,
 
 void BOPAlgo_Builder::FillSameDomainFaces(const Message_ProgressRange& theRange)
 {
+  const BOPAlgo_Statistics::Phase aPhase(myStatistics, "FillSameDomainFaces");
+
   // It is necessary to analyze all Face/Face intersections
   // and find all faces with equal sets of edges
   const NCollection_Vector<BOPDS_InterfFF>& aFFs   = myDS->InterfFF();
@@ -835,6 +841,8 @@ void BOPAlgo_Builder::FillSameDomainFaces(const Message_ProgressRange& theRange)
 
 void BOPAlgo_Builder::FillInternalVertices(const Message_ProgressRange& theRange)
 {
+  const BOPAlgo_Statistics::Phase aPhase(myStatistics, "FillInternalVertices");
+
   Message_ProgressScope aPSOuter(theRange, nullptr, 1);
 
   // Vector of pairs of Vertex/Face for classification of the vertices
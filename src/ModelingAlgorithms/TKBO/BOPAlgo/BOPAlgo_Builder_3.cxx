@@ -49,6 +49,7 @@
 #include <NCollection_IndexedMap.hxx>
 #include <NCollection_List.hxx>
 #include <NCollection_IndexedDataMap.hxx>
+#include <OSD_TraceZone.hxx>
 
 #include <algorithm>
 
@@ -59,6 +60,7 @@ static void OwnInternalShapes(const TopoDS_Shape&,
 
 void BOPAlgo_Builder::FillImagesSolids(const Message_ProgressRange& theRange)
 {
+  OSD_TRACE_ZONE_CATEGORY("BOPAlgo_Builder::FillImagesSolids", "bop");
   int i = 0, aNbS = myDS->NbSourceShapes();
   for (i = 0; i < aNbS; ++i)
   {
@@ -400,6 +402,8 @@ void BOPAlgo_Builder::BuildSplitSolids(
   NCollection_DataMap<TopoDS_Shape, TopoDS_Shape, TopTools_ShapeMapHasher>& theDraftSolids,
   const Message_ProgressRange&                                              theRange)
 {
+  const BOPAlgo_Statistics::Phase aPhase(myStatistics, "BuildSplitSolids");
+
   bool                                     bFlagSD;
   int                                      i, aNbS;
   TopExp_Explorer                          aExp;
@@ -601,6 +605,8 @@ void BOPAlgo_Builder::BuildSplitSolids(
 
 void BOPAlgo_Builder::FillInternalShapes(const Message_ProgressRange& theRange)
 {
+  const BOPAlgo_Statistics::Phase aPhase(myStatistics, "FillInternalShapes");
+
   int                                      i, j, aNbS, aNbSI, aNbSx;
   TopAbs_ShapeEnum                         aType;
   TopAbs_State                             aState;
@@ -141,6 +141,8 @@ const NCollection_List<TopoDS_Shape>* BOPAlgo_Builder::LocModified(const TopoDS_
 
 void BOPAlgo_Builder::PrepareHistory(const Message_ProgressRange& theRange)
 {
+  const BOPAlgo_Statistics::Phase aPhase(myStatistics, "PrepareHistory");
+
   if (!HasHistory())
     return;
 
@@ -158,11 +160,22 @@ void BOPAlgo_Builder::PrepareHistory(const Message_ProgressRange& theRange)
   //   the generated elements kept in the result shape as Generated from the shape;
   // - Shapes that have no trace in the result shape. Add them as Deleted
   //   during the operation.
-  int                   aNbS = myDS->NbSourceShapes();
+  // The Data Structure is absent if the arguments have been split
+  // by several independent operations, take the sub-shapes of the arguments then.
+  NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> aMArgShapes;
+  if (myDS == nullptr)
+  {
+    for (NCollection_List<TopoDS_Shape>::Iterator aItA(myArguments); aItA.More(); aItA.Next())
+    {
+      TopExp::MapShapes(aItA.Value(), aMArgShapes);
+    }
+  }
+
+  int                   aNbS = myDS != nullptr ? myDS->NbSourceShapes() : aMArgShapes.Extent();
   Message_ProgressScope aPS(theRange, "Preparing history information", aNbS);
   for (int i = 0; i < aNbS; ++i, aPS.Next())
   {
-    const TopoDS_Shape& aS = myDS->Shape(i);
+    const TopoDS_Shape& aS = myDS != nullptr ? myDS->Shape(i) : aMArgShapes(i + 1);
 
     // Check if History information is available for this kind of shape.
     if (!BRepTools_History::IsSupportedType(aS))
@@ -16,9 +16,12 @@
 
 #include <BOPAlgo_Alerts.hxx>
 #include <BOPAlgo_BuilderSolid.hxx>
+#include <BOPAlgo_PaveFiller.hxx>
+#include <BOPAlgo_Tools.hxx>
 #include <BOPDS_DS.hxx>
 #include <BOPTools_AlgoTools.hxx>
 #include <BRep_Builder.hxx>
+#include <IntTools_Context.hxx>
 #include <ShapeUpgrade_UnifySameDomain.hxx>
 #include <Standard_Integer.hxx>
 #include <NCollection_Map.hxx>
@@ -40,7 +43,8 @@ BOPAlgo_CellsBuilder::BOPAlgo_CellsBuilder()
     : myIndex(100, myAllocator),
       myMaterials(100, myAllocator),
       myShapeMaterial(100, myAllocator),
-      myMapModified(100, myAllocator)
+      myMapModified(100, myAllocator),
+      myClusterMode(false)
 {
 }
 
@@ -52,7 +56,8 @@ BOPAlgo_CellsBuilder::BOPAlgo_CellsBuilder(
       myIndex(100, myAllocator),
       myMaterials(100, myAllocator),
       myShapeMaterial(100, myAllocator),
-      myMapModified(100, myAllocator)
+      myMapModified(100, myAllocator),
+      myClusterMode(false)
 {
 }
 
@@ -72,6 +77,7 @@ void BOPAlgo_CellsBuilder::Clear()
   myMaterials.Clear();
   myShapeMaterial.Clear();
   myMapModified.Clear();
+  myClusterGenerated.Clear();
 }
 
 //=================================================================================================
@@ -83,6 +89,122 @@ const TopoDS_Shape& BOPAlgo_CellsBuilder::GetAllParts() const
 
 //=================================================================================================
 
+void BOPAlgo_CellsBuilder::Perform(const Message_ProgressRange& theRange)
+{
+  if (!myClusterMode || !PerformByClusters(theRange))
+  {
+    BOPAlgo_Builder::Perform(theRange);
+  }
+}
+
+//=================================================================================================
+
+bool BOPAlgo_CellsBuilder::PerformByClusters(const Message_ProgressRange& theRange)
+{
+  NCollection_List<NCollection_List<TopoDS_Shape>> aClusters;
+  BOPAlgo_Tools::ClusterArguments(myArguments, myFuzzyValue, aClusters);
+  if (aClusters.Extent() < 2)
+  {
+    return false;
+  }
+
+  GetReport()->Clear();
+  if (myEntryPoint == 1 && myPaveFiller)
+  {
+    delete myPaveFiller;
+  }
+  myPaveFiller = nullptr;
+  myEntryPoint = 0;
+  myDS         = nullptr;
+  myContext    = new IntTools_Context;
+  myImages.Clear();
+  myShapesSD.Clear();
+  myOrigins.Clear();
+  myInParts.Clear();
+  myIndex.Clear();
+  myMaterials.Clear();
+  myShapeMaterial.Clear();
+  myMapModified.Clear();
+  myClusterGenerated.Clear();
+
+  Message_ProgressScope aPS(theRange,
+                            "Performing MakeCells operation by clusters",
+                            aClusters.Size());
+  for (NCollection_List<NCollection_List<TopoDS_Shape>>::Iterator aItC(aClusters); aItC.More();
+       aItC.Next())
+  {
+    const Message_ProgressRange aRange = aPS.Next();
+    if (UserBreak(aPS))
+    {
+      return true;
+    }
+
+    const NCollection_List<TopoDS_Shape>& aLArgs = aItC.Value();
+    if (aLArgs.Extent() < 2)
+    {
+      // the parts of single argument are not split
+      continue;
+    }
+
+    // the intersection data of the cluster is released on leaving the scope
+    BOPAlgo_CellsBuilder aCB;
+    aCB.SetArguments(aLArgs);
+    aCB.SetRunParallel(myRunParallel);
+    aCB.SetFuzzyValue(myFuzzyValue);
+    aCB.SetNonDestructive(myNonDestructive);
+    aCB.SetGlue(myGlue);
+    aCB.SetUseOBB(myUseOBB);
+    aCB.SetCheckInverted(myCheckInverted);
+    aCB.SetStatistics(myStatistics);
+    aCB.SetToFillHistory(false);
+    aCB.Perform(aRange);
+    GetReport()->Merge(aCB.GetReport());
+    if (HasErrors())
+    {
+      return true;
+    }
+
+    for (NCollection_DataMap<TopoDS_Shape,
+                             NCollection_List<TopoDS_Shape>,
+                             TopTools_ShapeMapHasher>::Iterator aItIm(aCB.Images());
+         aItIm.More();
+         aItIm.Next())
+    {
+      myImages.Bind(aItIm.Key(), aItIm.Value());
+    }
+
+    if (HasHistory())
+    {
+      // keep the intersection shapes contained in the split parts for the history
+      aCB.myMapShape.Clear();
+      TopExp::MapShapes(aCB.GetAllParts(), aCB.myMapShape);
+      NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> aMS;
+      for (NCollection_List<TopoDS_Shape>::Iterator aItA(aLArgs); aItA.More(); aItA.Next())
+      {
+        TopExp::MapShapes(aItA.Value(), TopAbs_EDGE, aMS);
+        TopExp::MapShapes(aItA.Value(), TopAbs_FACE, aMS);
+      }
+      for (int i = 1; i <= aMS.Extent(); ++i)
+      {
+        const NCollection_List<TopoDS_Shape>& aLG = aCB.LocGenerated(aMS(i));
+        if (!aLG.IsEmpty())
+        {
+          myClusterGenerated.Bind(aMS(i), aLG);
+        }
+      }
+    }
+  }
+
+  // index all the parts to its origins
+  IndexParts();
+
+  // and nullify <myShape> for building the result;
+  RemoveAllFromResult();
+  return true;
+}
+
+//=================================================================================================
+
 void BOPAlgo_CellsBuilder::PerformInternal1(const BOPAlgo_PaveFiller&    theFiller,
                                             const Message_ProgressRange& theRange)
 {
@@ -1066,6 +1188,24 @@ const NCollection_List<TopoDS_Shape>* BOPAlgo_CellsBuilder::LocModified(const To
 
 //=================================================================================================
 
+const NCollection_List<TopoDS_Shape>& BOPAlgo_CellsBuilder::LocGenerated(const TopoDS_Shape& theS)
+{
+  if (myDS != nullptr)
+  {
+    return BOPAlgo_Builder::LocGenerated(theS);
+  }
+
+  // the arguments have been processed by clusters
+  if (const NCollection_List<TopoDS_Shape>* aLG = myClusterGenerated.Seek(theS))
+  {
+    return *aLG;
+  }
+  myHistShapes.Clear();
+  return myHistShapes;
+}
+
+//=================================================================================================
+
 void MakeTypedContainers(const TopoDS_Shape& theSC, TopoDS_Shape& theResult)
 {
   TopAbs_ShapeEnum aContainerType, aConnexityType, aPartType;
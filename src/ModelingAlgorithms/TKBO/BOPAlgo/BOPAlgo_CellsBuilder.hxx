@@ -80,6 +80,18 @@
 //! In DRAW Test Harness it is available through the same commands
 //! as for Boolean Operations (bmodified, bgenerated and bisdeleted).
 //!
+//! Cluster mode:
+//!
+//! For the huge number of arguments the memory needed to keep the Data Structure of the
+//! intersection of all arguments may be unaffordable. In the cluster mode (see SetClusterMode())
+//! the arguments are split into clusters of the shapes with interfering bounding boxes
+//! (see BOPAlgo_Tools::ClusterArguments()), which are intersected independently one by one.
+//! The intersection data of each cluster is released right after its processing,
+//! keeping only the split parts, so that the peak memory is defined by the largest cluster.
+//! As the clusters do not interfere, the split parts are the same as the ones obtained
+//! by processing of all arguments together. The Data Structure, the Origins and
+//! Same Domain shapes are not available in this mode.
+//!
 //! The algorithm can return the following Error Statuses:
 //! - Error status acquired in the General Fuse algorithm.
 //! The Error status can be checked with HasErrors() method.
@@ -179,6 +191,18 @@ public:
   //! Redefined method Clear - clears the contents.
   Standard_EXPORT void Clear() override;
 
+  //! Enables/Disables the independent processing of the clusters of the arguments.
+  //! The mode is used by Perform() only, as the prepared filler contains all intersection data.
+  void SetClusterMode(const bool theClusterMode) { myClusterMode = theClusterMode; }
+
+  //! Returns the cluster mode flag.
+  bool IsClusterMode() const { return myClusterMode; }
+
+  //! Performs the operation, intersecting the clusters of the arguments
+  //! independently in the cluster mode.
+  Standard_EXPORT void Perform(
+    const Message_ProgressRange& theRange = Message_ProgressRange()) override;
+
   //! Adding the parts to result.
   //! The parts are defined by two lists of shapes:
   //! <theLSToTake> defines the arguments which parts should be taken into result;
@@ -232,6 +256,15 @@ protected:
   Standard_EXPORT const NCollection_List<TopoDS_Shape>* LocModified(
     const TopoDS_Shape& theS) override;
 
+  //! Returns the shapes generated from the shape, taking into account
+  //! the independent processing of the clusters.
+  Standard_EXPORT const NCollection_List<TopoDS_Shape>& LocGenerated(
+    const TopoDS_Shape& theS) override;
+
+  //! Intersects the clusters of the arguments independently and collects their split parts.
+  //! Returns false if the arguments form a single cluster.
+  Standard_EXPORT bool PerformByClusters(const Message_ProgressRange& theRange);
+
   //! Redefined method PerformInternal1 - makes all split parts,
   //! nullifies the result <myShape>, and index all parts.
   Standard_EXPORT void PerformInternal1(const BOPAlgo_PaveFiller&    thePF,
@@ -260,7 +293,9 @@ protected:
   NCollection_DataMap<int, NCollection_List<TopoDS_Shape>> myMaterials;  //!< Map of assigned materials (material -> list of shape)
   NCollection_DataMap<TopoDS_Shape, int, TopTools_ShapeMapHasher> myShapeMaterial;    //!< Map of assigned materials (shape -> material)
   NCollection_DataMap<TopoDS_Shape, TopoDS_Shape, TopTools_ShapeMapHasher> myMapModified;        //!< Local modification map to track unification of the splits
+  NCollection_DataMap<TopoDS_Shape, NCollection_List<TopoDS_Shape>, TopTools_ShapeMapHasher> myClusterGenerated; //!< Shapes generated in the clusters
   // clang-format on
+  bool myClusterMode; //!< Defines whether to process the clusters of arguments independently
 };
 
 #endif //_BOPAlgo_CellsBuilder_HeaderFile
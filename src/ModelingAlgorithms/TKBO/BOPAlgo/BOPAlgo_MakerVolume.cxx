@@ -45,6 +45,11 @@ void BOPAlgo_MakerVolume::CheckData()
 
 void BOPAlgo_MakerVolume::Perform(const Message_ProgressRange& theRange)
 {
+  if (myClusterMode && PerformByClusters(theRange))
+  {
+    return;
+  }
+  //
   Message_ProgressScope aPS(theRange, "Performing MakeVolume operation", 10);
   double                anInterPart = myIntersect ? 9 : 0.5;
   double                aBuildPart  = 10. - anInterPart;
@@ -94,6 +99,7 @@ void BOPAlgo_MakerVolume::Perform(const Message_ProgressRange& theRange)
   pPF->SetNonDestructive(myNonDestructive);
   pPF->SetGlue(myGlue);
   pPF->SetUseOBB(myUseOBB);
+  pPF->SetStatistics(myStatistics);
   pPF->Perform(aPS.Next(anInterPart));
   //
   myEntryPoint = 1;
@@ -102,6 +108,91 @@ void BOPAlgo_MakerVolume::Perform(const Message_ProgressRange& theRange)
 
 //=================================================================================================
 
+bool BOPAlgo_MakerVolume::PerformByClusters(const Message_ProgressRange& theRange)
+{
+  NCollection_List<NCollection_List<TopoDS_Shape>> aClusters;
+  BOPAlgo_Tools::ClusterArguments(myArguments, myFuzzyValue, aClusters);
+  if (aClusters.Extent() < 2)
+  {
+    return false;
+  }
+
+  GetReport()->Clear();
+  if (myEntryPoint == 1 && myPaveFiller)
+  {
+    delete myPaveFiller;
+  }
+  myPaveFiller = nullptr;
+  myEntryPoint = 0;
+  myDS         = nullptr;
+  myContext.Nullify();
+  myImages.Clear();
+  myShapesSD.Clear();
+  myOrigins.Clear();
+  myInParts.Clear();
+  myBBox = Bnd_Box();
+  mySBox.Nullify();
+  myFaces.Clear();
+  myHistory.Nullify();
+  //
+  Prepare();
+
+  occ::handle<BRepTools_History> aHistory;
+  if (HasHistory())
+  {
+    aHistory = new BRepTools_History;
+  }
+
+  NCollection_List<TopoDS_Shape> aLSR;
+  Message_ProgressScope          aPS(theRange,
+                            "Performing MakeVolume operation by clusters",
+                            aClusters.Size());
+  for (NCollection_List<NCollection_List<TopoDS_Shape>>::Iterator aItC(aClusters); aItC.More();
+       aItC.Next())
+  {
+    const Message_ProgressRange aRange = aPS.Next();
+    if (UserBreak(aPS))
+    {
+      return true;
+    }
+
+    // the data of the cluster is released on leaving the scope
+    BOPAlgo_MakerVolume aMV;
+    aMV.SetArguments(aItC.Value());
+    aMV.SetIntersect(myIntersect);
+    aMV.SetAvoidInternalShapes(myAvoidInternalShapes);
+    aMV.SetRunParallel(myRunParallel);
+    aMV.SetFuzzyValue(myFuzzyValue);
+    aMV.SetNonDestructive(myNonDestructive);
+    aMV.SetGlue(myGlue);
+    aMV.SetUseOBB(myUseOBB);
+    aMV.SetCheckInverted(myCheckInverted);
+    aMV.SetStatistics(myStatistics);
+    aMV.SetToFillHistory(HasHistory());
+    aMV.Perform(aRange);
+    GetReport()->Merge(aMV.GetReport());
+    if (HasErrors())
+    {
+      return true;
+    }
+
+    for (TopExp_Explorer aExp(aMV.Shape(), TopAbs_SOLID); aExp.More(); aExp.Next())
+    {
+      aLSR.Append(aExp.Current());
+    }
+    if (!aHistory.IsNull())
+    {
+      aHistory->Merge(aMV.History());
+    }
+  }
+
+  BuildShape(aLSR);
+  myHistory = aHistory;
+  return true;
+}
+
+//=================================================================================================
+
 void BOPAlgo_MakerVolume::PerformInternal1(const BOPAlgo_PaveFiller&    theFiller,
                                            const Message_ProgressRange& theRange)
 {
@@ -54,6 +54,14 @@ class BOPAlgo_PaveFiller;
 //!
 //! 6. Prepare the history.
 //!
+//! In the cluster mode (see SetClusterMode()) the arguments are split into clusters of
+//! the shapes with interfering bounding boxes (see BOPAlgo_Tools::ClusterArguments())
+//! and the solids of each cluster are built by independent operation, releasing its data
+//! right after building. The peak memory is thus defined by the largest cluster instead of
+//! all arguments. The result and the history are the same as for the processing of all
+//! arguments together, while the Data Structure, the images, the box and the faces
+//! are not available in this mode.
+//!
 //! Fields:
 //! <myIntersect> - boolean flag. It defines whether intersect shapes
 //! from <myArguments> (if set to TRUE) or not (FALSE).
@@ -144,6 +152,13 @@ public:
   //! Returns the AvoidInternalShapes flag
   bool IsAvoidInternalShapes() const { return myAvoidInternalShapes; }
 
+  //! Enables/Disables the independent processing of the clusters of the arguments.
+  //! The mode is used by Perform() only, as the prepared filler contains all intersection data.
+  void SetClusterMode(const bool theClusterMode) { myClusterMode = theClusterMode; }
+
+  //! Returns the cluster mode flag.
+  bool IsClusterMode() const { return myClusterMode; }
+
   //! Performs the operation.
   Standard_EXPORT void Perform(
     const Message_ProgressRange& theRange = Message_ProgressRange()) override;
@@ -178,6 +193,10 @@ protected:
   //! Builds the result.
   Standard_EXPORT void BuildShape(const NCollection_List<TopoDS_Shape>& theLSR);
 
+  //! Builds the solids of the clusters of the arguments by independent operations.
+  //! Returns false if the arguments form a single cluster.
+  Standard_EXPORT bool PerformByClusters(const Message_ProgressRange& theRange);
+
 protected:
   //! List of operations to be supported by the Progress Indicator.
   //! Enumeration is going to contain some extra operations from base class,
@@ -202,6 +221,7 @@ protected:
   TopoDS_Solid                   mySBox;
   NCollection_List<TopoDS_Shape> myFaces;
   bool                           myAvoidInternalShapes;
+  bool                           myClusterMode;
 };
 
 #include <BOPAlgo_MakerVolume.lxx>
@@ -15,6 +15,7 @@
 #ifndef _BOPAlgo_Options_HeaderFile
 #define _BOPAlgo_Options_HeaderFile
 
+#include <BOPAlgo_Statistics.hxx>
 #include <Message_Report.hxx>
 #include <Standard_OStream.hxx>
 
@@ -32,6 +33,7 @@ class Message_ProgressScope;
 //!                       touching or coinciding cases;
 //! - *Using the Oriented Bounding Boxes* - Allows using the Oriented Bounding Boxes of the shapes
 //!                          for filtering the intersections.
+//! - *Statistics* - collection of timings and work counters of the phases of the operation.
 //!
 class BOPAlgo_Options
 {
@@ -134,6 +136,20 @@ public:
   //! Returns the flag defining usage of OBB
   bool UseOBB() const { return myUseOBB; }
 
+public:
+  //!@name Statistics of the operation
+
+  //! Sets the statistics to collect the timings and work counters of the operation into.
+  //! The same statistics may be shared by several algorithms (e.g. intersection and
+  //! building parts of Boolean operation). NULL (default) - no statistics are collected.
+  void SetStatistics(const occ::handle<BOPAlgo_Statistics>& theStatistics)
+  {
+    myStatistics = theStatistics;
+  }
+
+  //! Returns the statistics of the operation
+  const occ::handle<BOPAlgo_Statistics>& Statistics() const { return myStatistics; }
+
 protected:
   //! Adds error to the report if the break signal was caught. Returns true in this case, false
   //! otherwise.
@@ -145,6 +161,7 @@ protected:
   bool                                   myRunParallel;
   double                                 myFuzzyValue;
   bool                                   myUseOBB;
+  occ::handle<BOPAlgo_Statistics>        myStatistics;
 };
 
 #endif // _BOPAlgo_Options_HeaderFile
@@ -21,9 +21,12 @@
 #include <BOPDS_DS.hxx>
 #include <BOPDS_Iterator.hxx>
 #include <IntTools_Context.hxx>
+#include <IntTools_SharedCache.hxx>
 #include <NCollection_BaseAllocator.hxx>
 #include <Standard_ErrorHandler.hxx>
 #include <Standard_Failure.hxx>
+#include <OSD_MemInfo.hxx>
+#include <OSD_TraceZone.hxx>
 
 namespace
 {
@@ -197,16 +200,35 @@ void BOPAlgo_PaveFiller::Init(const Message_ProgressRange& theRange)
     }
   }
   //
+  BOPAlgo_Statistics::Phase aPhase(myStatistics, "Init");
+  //
   // 0 Clear
   Clear();
   //
   // 1.myDS
+  if (myAllocator != NCollection_BaseAllocator::CommonBaseAllocator()
+      && myAllocator->MemTag() == OSD_MemInfo::MemTag_Untagged)
+  {
+    myAllocator->SetMemTag(OSD_MemInfo::MemTag_BOPDS);
+  }
   myDS = new BOPDS_DS(myAllocator);
   myDS->SetArguments(myArguments);
   myDS->Init(myFuzzyValue);
   //
   // 2 myContext
-  myContext = new IntTools_Context;
+  if (!mySharedContext.IsNull())
+  {
+    myContext = mySharedContext;
+  }
+  else
+  {
+    myContext = new IntTools_Context;
+    if (myRunParallel)
+    {
+      // share the classifiers and boxes of the shapes between the threads
+      myContext->SetSharedCache(new IntTools_SharedCache());
+    }
+  }
   //
   // 3.myIterator
   myIterator = new BOPDS_Iterator(myAllocator);
@@ -222,6 +244,7 @@ void BOPAlgo_PaveFiller::Init(const Message_ProgressRange& theRange)
 
 void BOPAlgo_PaveFiller::Perform(const Message_ProgressRange& theRange)
 {
+  OSD_TRACE_ZONE_CATEGORY("BOPAlgo_PaveFiller::Perform", "bop");
   try
   {
     OCC_CATCH_SIGNALS
@@ -233,6 +256,12 @@ void BOPAlgo_PaveFiller::Perform(const Message_ProgressRange& theRange)
   {
     AddError(new BOPAlgo_AlertIntersectionFailed);
   }
+  //
+  if (!myStatistics.IsNull() && !myContext.IsNull() && !myContext->SharedCache().IsNull())
+  {
+    const occ::handle<IntTools_SharedCache>& aCache = myContext->SharedCache();
+    myStatistics->SetCache("IntTools_SharedCache", aCache->NbHits(), aCache->NbMisses());
+  }
 }
 
 //=================================================================================================
@@ -129,6 +129,15 @@ public:
 
   Standard_EXPORT const occ::handle<IntTools_Context>& Context();
 
+  //! Sets the context to be used by the next operations instead of creating the new one,
+  //! so that the cached classifiers and projectors of the shapes used as arguments
+  //! of several operations are reused. NULL (default) - the new context is created
+  //! for each operation.
+  void SetContext(const occ::handle<IntTools_Context>& theContext)
+  {
+    mySharedContext = theContext;
+  }
+
   Standard_EXPORT void SetSectionAttribute(const BOPAlgo_SectionAttribute& theSecAttr);
 
   //! Sets the flag that defines the mode of treatment.
@@ -635,6 +644,7 @@ protected: //! Fields
   BOPDS_PDS                      myDS;
   BOPDS_PIterator                myIterator;
   occ::handle<IntTools_Context>  myContext;
+  occ::handle<IntTools_Context>  mySharedContext;
   BOPAlgo_SectionAttribute       mySectionAttribute;
   bool                           myNonDestructive;
   bool                           myIsPrimary;
@@ -39,13 +39,16 @@
 #include <TopoDS_Compound.hxx>
 #include <TopoDS_Shape.hxx>
 #include <NCollection_List.hxx>
+#include <OSD_TraceZone.hxx>
 
 //=================================================================================================
 
 void BOPAlgo_PaveFiller::PerformVV(const Message_ProgressRange& theRange)
 {
+  OSD_TRACE_ZONE_CATEGORY("BOPAlgo_PaveFiller::PerformVV", "bop");
   int                                    n1, n2, iFlag, aSize;
   occ::handle<NCollection_BaseAllocator> aAllocator;
+  BOPAlgo_Statistics::Phase              aPhase(myStatistics, "PerformVV");
   //
   myIterator->Initialize(TopAbs_VERTEX, TopAbs_VERTEX);
   aSize = myIterator->ExpectedLength();
@@ -79,6 +82,7 @@ void BOPAlgo_PaveFiller::PerformVV(const Message_ProgressRange& theRange)
       BOPAlgo_Tools::FillMap(n1, n2, aMILI, aAllocator);
       continue;
     }
+    aPhase.AddPairs();
 
     // Check for SD vertices
     int n1SD = n1;
@@ -94,6 +98,7 @@ void BOPAlgo_PaveFiller::PerformVV(const Message_ProgressRange& theRange)
     if (!iFlag)
     {
       BOPAlgo_Tools::FillMap(n1, n2, aMILI, aAllocator);
+      aPhase.AddIntersected();
     }
   }
   //
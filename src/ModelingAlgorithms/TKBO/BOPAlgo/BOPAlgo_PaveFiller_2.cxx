@@ -34,6 +34,7 @@
 #include <TopoDS_Edge.hxx>
 #include <Standard_ErrorHandler.hxx>
 #include <TopoDS_Vertex.hxx>
+#include <OSD_TraceZone.hxx>
 
 //=================================================================================================
 
@@ -108,6 +109,7 @@ public:
     {
       return;
     }
+    const BOPAlgo_Statistics::PairTimer aTimer(myStatistics, "VE", myIV, myIE);
     try
     {
       OCC_CATCH_SIGNALS
@@ -140,6 +142,8 @@ typedef NCollection_Vector<BOPAlgo_VertexEdge> BOPAlgo_VectorOfVertexEdge;
 
 void BOPAlgo_PaveFiller::PerformVE(const Message_ProgressRange& theRange)
 {
+  OSD_TRACE_ZONE_CATEGORY("BOPAlgo_PaveFiller::PerformVE", "bop");
+  const BOPAlgo_Statistics::Phase aPhase(myStatistics, "PerformVE");
   FillShrunkData(TopAbs_VERTEX, TopAbs_EDGE);
   //
   myIterator->Initialize(TopAbs_VERTEX, TopAbs_EDGE);
@@ -217,6 +221,7 @@ void BOPAlgo_PaveFiller::IntersectVE(
   {
     return;
   }
+  BOPAlgo_Statistics::Phase aPhase(myStatistics, "IntersectVE");
   //
   NCollection_Vector<BOPDS_InterfVE>& aVEs = myDS->InterfVE();
   if (theAddInterfs)
@@ -288,12 +293,14 @@ void BOPAlgo_PaveFiller::IntersectVE(
   }
   //
   aNbVE = aVVE.Length();
+  aPhase.AddPairs(aNbVE);
 
   Message_ProgressScope aPS(aPSOuter.Next(9), "Performing Vertex-Edge intersection", aNbVE);
   for (i = 0; i < aNbVE; i++)
   {
     BOPAlgo_VertexEdge& aVESolver = aVVE.ChangeValue(i);
     aVESolver.SetProgressRange(aPS.Next());
+    aVESolver.SetStatistics(myStatistics);
   }
   // Perform intersection
   //=============================================================
@@ -324,6 +331,7 @@ void BOPAlgo_PaveFiller::IntersectVE(
       }
       continue;
     }
+    aPhase.AddIntersected();
     //
     int nV, nE;
     aVESolver.Indices(nV, nE);
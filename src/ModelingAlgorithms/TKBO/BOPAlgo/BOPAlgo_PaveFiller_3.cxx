@@ -46,6 +46,8 @@
 #include <TopoDS.hxx>
 #include <TopoDS_Edge.hxx>
 #include <TopoDS_Vertex.hxx>
+#include <OSD_MemInfo.hxx>
+#include <OSD_TraceZone.hxx>
 
 /////////////////////////////////////////////////////////////////////////
 //=================================================================================================
@@ -91,8 +93,12 @@ public:
     {
       return;
     }
-    TopoDS_Edge anE1 = myEdge1, anE2 = myEdge2;
-    bool        hasTrsf = false;
+    const BOPAlgo_Statistics::PairTimer aTimer(myStatistics,
+                                              "EE",
+                                              myPB1->OriginalEdge(),
+                                              myPB2->OriginalEdge());
+    TopoDS_Edge                         anE1 = myEdge1, anE2 = myEdge2;
+    bool                                hasTrsf = false;
     try
     {
       OCC_CATCH_SIGNALS
@@ -144,6 +150,8 @@ typedef NCollection_Vector<BOPAlgo_EdgeEdge> BOPAlgo_VectorOfEdgeEdge;
 
 void BOPAlgo_PaveFiller::PerformEE(const Message_ProgressRange& theRange)
 {
+  OSD_TRACE_ZONE_CATEGORY("BOPAlgo_PaveFiller::PerformEE", "bop");
+  BOPAlgo_Statistics::Phase aPhase(myStatistics, "PerformEE");
   FillShrunkData(TopAbs_EDGE, TopAbs_EDGE);
   //
   myIterator->Initialize(TopAbs_EDGE, TopAbs_EDGE);
@@ -267,12 +275,14 @@ void BOPAlgo_PaveFiller::PerformEE(const Message_ProgressRange& theRange)
   } // for (; myIterator->More(); myIterator->Next()) {
   //
   aNbEdgeEdge = aVEdgeEdge.Length();
+  aPhase.AddPairs(aNbEdgeEdge);
 
   Message_ProgressScope aPS(aPSOuter.Next(9), "Performing Edge-edge intersection", aNbEdgeEdge);
   for (k = 0; k < aNbEdgeEdge; k++)
   {
     BOPAlgo_EdgeEdge& anEdgeEdge = aVEdgeEdge.ChangeValue(k);
     anEdgeEdge.SetProgressRange(aPS.Next());
+    anEdgeEdge.SetStatistics(myStatistics);
   }
   //======================================================
   BOPTools_Parallel::Perform(myRunParallel, aVEdgeEdge);
@@ -306,6 +316,7 @@ void BOPAlgo_PaveFiller::PerformEE(const Message_ProgressRange& theRange)
     {
       continue;
     }
+    aPhase.AddIntersected();
     //--------------------------------------------
     occ::handle<BOPDS_PaveBlock>& aPB1 = anEdgeEdge.PaveBlock1();
     nE1                                = aPB1->OriginalEdge();
@@ -983,8 +994,10 @@ void BOPAlgo_PaveFiller::ForceInterfEE(const Message_ProgressRange& theRange)
   // are interested in common blocks only, thus we need to check only
   // those pairs of pave blocks with the same bounding vertices.
 
+  BOPAlgo_Statistics::Phase             aPhase(myStatistics, "ForceInterfEE");
   occ::handle<NCollection_IncAllocator> anAlloc = new NCollection_IncAllocator;
-  Message_ProgressScope                 aPSOuter(theRange, nullptr, 10);
+  anAlloc->SetMemTag(OSD_MemInfo::MemTag_BOPDS);
+  Message_ProgressScope aPSOuter(theRange, nullptr, 10);
   // Initialize pave blocks for all vertices which participated in intersections
   const int aNbS = myDS->NbSourceShapes();
   for (int i = 0; i < aNbS; ++i)
@@ -1180,6 +1193,7 @@ void BOPAlgo_PaveFiller::ForceInterfEE(const Message_ProgressRange& theRange)
   int aNbPairs = aVEdgeEdge.Length();
   if (!aNbPairs)
     return;
+  aPhase.AddPairs(aNbPairs);
 
   // close preparation step
   aPSOuter.Next(0.7);
@@ -1193,6 +1207,7 @@ void BOPAlgo_PaveFiller::ForceInterfEE(const Message_ProgressRange& theRange)
   {
     BOPAlgo_EdgeEdge& anEdgeEdge = aVEdgeEdge.ChangeValue(i);
     anEdgeEdge.SetProgressRange(aPS.Next());
+    anEdgeEdge.SetStatistics(myStatistics);
   }
 
   // Perform intersection of the found pairs
@@ -1234,6 +1249,7 @@ void BOPAlgo_PaveFiller::ForceInterfEE(const Message_ProgressRange& theRange)
     const IntTools_CommonPrt& aCP = aCParts(1);
     if (aCP.Type() != TopAbs_EDGE)
       continue;
+    aPhase.AddIntersected();
 
     occ::handle<BOPDS_PaveBlock> aPB[] = {anEdgeEdge.PaveBlock1(), anEdgeEdge.PaveBlock2()};
     const int                    nE1   = aPB[0]->OriginalEdge();
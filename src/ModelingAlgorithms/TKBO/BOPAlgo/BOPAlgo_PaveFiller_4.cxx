@@ -31,6 +31,7 @@
 #include <Standard_Integer.hxx>
 #include <TopoDS_Face.hxx>
 #include <TopoDS_Vertex.hxx>
+#include <OSD_TraceZone.hxx>
 
 //=================================================================================================
 
@@ -106,6 +107,7 @@ public:
     {
       return;
     }
+    const BOPAlgo_Statistics::PairTimer aTimer(myStatistics, "VF", myIV, myIF);
     try
     {
       OCC_CATCH_SIGNALS
@@ -138,6 +140,8 @@ typedef NCollection_Vector<BOPAlgo_VertexFace> BOPAlgo_VectorOfVertexFace;
 
 void BOPAlgo_PaveFiller::PerformVF(const Message_ProgressRange& theRange)
 {
+  OSD_TRACE_ZONE_CATEGORY("BOPAlgo_PaveFiller::PerformVF", "bop");
+  BOPAlgo_Statistics::Phase aPhase(myStatistics, "PerformVF");
   myIterator->Initialize(TopAbs_VERTEX, TopAbs_FACE);
   int iSize = myIterator->ExpectedLength();
   //
@@ -232,11 +236,13 @@ void BOPAlgo_PaveFiller::PerformVF(const Message_ProgressRange& theRange)
   } // for (; myIterator->More(); myIterator->Next()) {
   //
   aNbVF = aVVF.Length();
+  aPhase.AddPairs(aNbVF);
   Message_ProgressScope aPS(aPSOuter.Next(9), "Performing Vertex-Face intersection", aNbVF);
   for (k = 0; k < aNbVF; k++)
   {
     BOPAlgo_VertexFace& aVertexFace = aVVF.ChangeValue(k);
     aVertexFace.SetProgressRange(aPS.Next());
+    aVertexFace.SetStatistics(myStatistics);
   }
   //================================================================
   BOPTools_Parallel::Perform(myRunParallel, aVVF, myContext);
@@ -264,6 +270,7 @@ void BOPAlgo_PaveFiller::PerformVF(const Message_ProgressRange& theRange)
       }
       continue;
     }
+    aPhase.AddIntersected();
     //
     aVertexFace.Indices(nVx, nF);
     aVertexFace.Parameters(aT1, aT2);
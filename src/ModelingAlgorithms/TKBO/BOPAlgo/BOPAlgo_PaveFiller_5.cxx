@@ -49,6 +49,8 @@
 #include <TopoDS_Edge.hxx>
 #include <TopoDS_Face.hxx>
 #include <TopoDS_Vertex.hxx>
+#include <OSD_MemInfo.hxx>
+#include <OSD_TraceZone.hxx>
 
 //=================================================================================================
 
@@ -109,9 +111,10 @@ public:
     {
       return;
     }
-    TopoDS_Face aFace   = myFace;
-    TopoDS_Edge anEdge  = myEdge;
-    bool        hasTrsf = false;
+    const BOPAlgo_Statistics::PairTimer aTimer(myStatistics, "EF", myIE, myIF);
+    TopoDS_Face                         aFace   = myFace;
+    TopoDS_Edge                         anEdge  = myEdge;
+    bool                                hasTrsf = false;
     try
     {
       OCC_CATCH_SIGNALS
@@ -164,6 +167,8 @@ typedef NCollection_Vector<BOPAlgo_EdgeFace> BOPAlgo_VectorOfEdgeFace;
 
 void BOPAlgo_PaveFiller::PerformEF(const Message_ProgressRange& theRange)
 {
+  OSD_TRACE_ZONE_CATEGORY("BOPAlgo_PaveFiller::PerformEF", "bop");
+  BOPAlgo_Statistics::Phase aPhase(myStatistics, "PerformEF");
   FillShrunkData(TopAbs_EDGE, TopAbs_FACE);
   //
   myIterator->Initialize(TopAbs_EDGE, TopAbs_FACE);
@@ -305,11 +310,13 @@ void BOPAlgo_PaveFiller::PerformEF(const Message_ProgressRange& theRange)
   } // for (; myIterator->More(); myIterator->Next()) {
   //
   aNbEdgeFace = aVEdgeFace.Length();
+  aPhase.AddPairs(aNbEdgeFace);
   Message_ProgressScope aPS(aPSOuter.Next(9), "Performing Edge-Face intersection", aNbEdgeFace);
   for (int index = 0; index < aNbEdgeFace; index++)
   {
     BOPAlgo_EdgeFace& aEdgeFace = aVEdgeFace.ChangeValue(index);
     aEdgeFace.SetProgressRange(aPS.Next());
+    aEdgeFace.SetStatistics(myStatistics);
   }
   //=================================================================
   BOPTools_Parallel::Perform(myRunParallel, aVEdgeFace, myContext);
@@ -356,6 +363,7 @@ void BOPAlgo_PaveFiller::PerformEF(const Message_ProgressRange& theRange)
       }
       continue;
     }
+    aPhase.AddIntersected();
     //
     const IntTools_Range&         anewSR = aEdgeFace.NewSR();
     occ::handle<BOPDS_PaveBlock>& aPB    = aEdgeFace.PaveBlock();
@@ -825,10 +833,12 @@ void BOPAlgo_PaveFiller::ForceInterfEF(
   Message_ProgressScope aPSOuter(theRange, nullptr, 10);
   if (theMPB.IsEmpty())
     return;
+  BOPAlgo_Statistics::Phase aPhase(myStatistics, "ForceInterfEF");
   // Fill the tree with bounding boxes of the pave blocks
   BOPTools_BoxTree aBBTree;
 
-  occ::handle<NCollection_IncAllocator>                anAlloc = new NCollection_IncAllocator;
+  occ::handle<NCollection_IncAllocator> anAlloc = new NCollection_IncAllocator;
+  anAlloc->SetMemTag(OSD_MemInfo::MemTag_BOPDS);
   NCollection_IndexedMap<occ::handle<BOPDS_PaveBlock>> aPBMap(1, anAlloc);
 
   int aNbPB = theMPB.Extent();
@@ -1066,6 +1076,7 @@ void BOPAlgo_PaveFiller::ForceInterfEF(
   {
     return;
   }
+  aPhase.AddPairs(aNbEFs);
 
   // close preparation step
   aPSOuter.Next(0.7);
@@ -1078,6 +1089,7 @@ void BOPAlgo_PaveFiller::ForceInterfEF(
   {
     BOPAlgo_EdgeFace& aEdgeFace = aVEdgeFace.ChangeValue(i);
     aEdgeFace.SetProgressRange(aPS.Next());
+    aEdgeFace.SetStatistics(myStatistics);
   }
   // Perform intersection of the found pairs
   BOPTools_Parallel::Perform(myRunParallel, aVEdgeFace, myContext);
@@ -1117,6 +1129,7 @@ void BOPAlgo_PaveFiller::ForceInterfEF(
     const IntTools_CommonPrt& aCP = aCParts(1);
     if (aCP.Type() != TopAbs_EDGE)
       continue;
+    aPhase.AddIntersected();
 
     int nE, nF;
     anEdgeFace.Indices(nE, nF);
@@ -54,6 +54,7 @@
 #include <GeomAPI_ProjectPointOnCurve.hxx>
 #include <GeomAPI_ProjectPointOnSurf.hxx>
 #include <gp_Pnt.hxx>
+#include <IntPolyh_SamplingCache.hxx>
 #include <IntSurf_PntOn2S.hxx>
 #include <Standard_ErrorHandler.hxx>
 #include <IntTools.hxx>
@@ -75,6 +76,8 @@
 #include <TopoDS_Vertex.hxx>
 #include <TopoDS_Shape.hxx>
 #include <TopTools_ShapeMapHasher.hxx>
+#include <OSD_MemInfo.hxx>
+#include <OSD_TraceZone.hxx>
 
 static double ToleranceFF(const BRepAdaptor_Surface& aBAS1, const BRepAdaptor_Surface& aBAS2);
 
@@ -205,6 +208,7 @@ public:
     {
       return;
     }
+    const BOPAlgo_Statistics::PairTimer aTimer(myStatistics, "FF", myIF1, myIF2);
     try
     {
       OCC_CATCH_SIGNALS
@@ -281,8 +285,168 @@ typedef NCollection_Vector<BOPAlgo_FaceFace> BOPAlgo_VectorOfFaceFace;
 
 //=================================================================================================
 
+static void AddFullShapeMap(const BOPDS_PDS& theDS, const int nF, NCollection_Map<int>& aMI)
+{
+  NCollection_List<int>::Iterator aIt;
+  int                             nS;
+  //
+  const BOPDS_ShapeInfo&       aSI = theDS->ShapeInfo(nF);
+  const NCollection_List<int>& aLI = aSI.SubShapes();
+  //
+  aMI.Add(nF);
+  aIt.Initialize(aLI);
+  for (; aIt.More(); aIt.Next())
+  {
+    nS = aIt.Value();
+    aMI.Add(nS);
+  }
+}
+
+//=================================================================================================
+
+static void CollectStickVertices(const BOPDS_PDS&      theDS,
+                                 const int             nF1,
+                                 const int             nF2,
+                                 NCollection_Map<int>& aMVStick,
+                                 NCollection_Map<int>& aMVEF,
+                                 NCollection_Map<int>& aMI)
+{
+  int nS1, nS2, nVNew, aTypeInt, i;
+  //
+  NCollection_Vector<BOPDS_InterfVV>& aVVs = theDS->InterfVV();
+  NCollection_Vector<BOPDS_InterfVE>& aVEs = theDS->InterfVE();
+  NCollection_Vector<BOPDS_InterfEE>& aEEs = theDS->InterfEE();
+  NCollection_Vector<BOPDS_InterfVF>& aVFs = theDS->InterfVF();
+  NCollection_Vector<BOPDS_InterfEF>& aEFs = theDS->InterfEF();
+  //
+  int aNbLines[5] = {aVVs.Length(), aVEs.Length(), aEEs.Length(), aVFs.Length(), aEFs.Length()};
+  // collect indices of all shapes from nF1 and nF2.
+  aMI.Clear();
+  AddFullShapeMap(theDS, nF1, aMI);
+  AddFullShapeMap(theDS, nF2, aMI);
+  //
+  // collect VV, VE, EE, VF interferences
+  for (aTypeInt = 0; aTypeInt < 4; ++aTypeInt)
+  {
+    for (i = 0; i < aNbLines[aTypeInt]; ++i)
+    {
+      BOPDS_Interf* aInt = (aTypeInt == 0)
+                             ? (BOPDS_Interf*)(&aVVs(i))
+                             : ((aTypeInt == 1) ? (BOPDS_Interf*)(&aVEs(i))
+                                                : ((aTypeInt == 2) ? (BOPDS_Interf*)(&aEEs(i))
+                                                                   : (BOPDS_Interf*)(&aVFs(i))));
+      if (aInt->HasIndexNew())
+      {
+        aInt->Indices(nS1, nS2);
+        if (aMI.Contains(nS1) && aMI.Contains(nS2))
+        {
+          nVNew = aInt->IndexNew();
+          theDS->HasShapeSD(nVNew, nVNew);
+          aMVStick.Add(nVNew);
+        }
+      }
+    }
+  }
+  // collect EF interferences
+  for (i = 0; i < aNbLines[4]; ++i)
+  {
+    const BOPDS_InterfEF& aInt = aEFs(i);
+    if (aInt.HasIndexNew())
+    {
+      aInt.Indices(nS1, nS2);
+      if (aMI.Contains(nS1) && aMI.Contains(nS2))
+      {
+        nVNew = aInt.IndexNew();
+        theDS->HasShapeSD(nVNew, nVNew);
+        aMVStick.Add(nVNew);
+        aMVEF.Add(nVNew);
+      }
+    }
+  }
+}
+
+//=================================================================================================
+
+//! Collects the vertices created in the intersections of the sub-shapes of two faces
+//! (see BOPAlgo_PaveFiller::GetStickVertices()). The collection only reads the
+//! Data Structure, which allows performing it for all Face/Face interferences in parallel
+//! before processing them sequentially.
+class BOPAlgo_StickVertices
+{
+public:
+  BOPAlgo_StickVertices()
+      : myDS(nullptr),
+        myIF1(-1),
+        myIF2(-1)
+  {
+  }
+
+  //
+  void SetDS(const BOPDS_PDS& theDS) { myDS = theDS; }
+
+  //
+  void SetIndices(const int nF1, const int nF2)
+  {
+    myIF1 = nF1;
+    myIF2 = nF2;
+  }
+
+  //! Returns the vertices created in all intersections between the faces.
+  const NCollection_Map<int>& StickVertices() const { return myMVStick; }
+
+  //! Returns the vertices created in all intersections between the faces for modification.
+  NCollection_Map<int>& ChangeStickVertices() { return myMVStick; }
+
+  //! Returns the vertices created in Edge/Face intersections between the faces.
+  const NCollection_Map<int>& EFVertices() const { return myMVEF; }
+
+  //! Returns the indices of the faces and of all their sub-shapes.
+  const NCollection_Map<int>& SubShapes() const { return myMI; }
+
+  //
+  void Perform() { CollectStickVertices(myDS, myIF1, myIF2, myMVStick, myMVEF, myMI); }
+
+protected:
+  BOPDS_PDS            myDS;
+  int                  myIF1;
+  int                  myIF2;
+  NCollection_Map<int> myMVStick;
+  NCollection_Map<int> myMVEF;
+  NCollection_Map<int> myMI;
+};
+
+//=================================================================================================
+
+typedef NCollection_Vector<BOPAlgo_StickVertices> BOPAlgo_VectorOfStickVertices;
+
+//=================================================================================================
+
+//! Collects the stick vertices for all Face/Face interferences in parallel.
+static void CollectStickVertices(const BOPDS_PDS&               theDS,
+                                 const bool                     theRunParallel,
+                                 BOPAlgo_VectorOfStickVertices& theVSV)
+{
+  NCollection_Vector<BOPDS_InterfFF>& aFFs  = theDS->InterfFF();
+  const int                           aNbFF = aFFs.Length();
+  for (int i = 0; i < aNbFF; ++i)
+  {
+    int nF1, nF2;
+    aFFs(i).Indices(nF1, nF2);
+    BOPAlgo_StickVertices& aSV = theVSV.Appended();
+    aSV.SetDS(theDS);
+    aSV.SetIndices(nF1, nF2);
+  }
+  //======================================================
+  BOPTools_Parallel::Perform(theRunParallel, theVSV);
+  //======================================================
+}
+
+//=================================================================================================
+
 void BOPAlgo_PaveFiller::PerformFF(const Message_ProgressRange& theRange)
 {
+  OSD_TRACE_ZONE_CATEGORY("BOPAlgo_PaveFiller::PerformFF", "bop");
+  BOPAlgo_Statistics::Phase aPhase(myStatistics, "PerformFF");
   // Update face info for all Face/Face intersection pairs
   // and also for the rest of the faces with FaceInfo already initialized,
   // i.e. anyhow touched faces.
@@ -358,8 +522,10 @@ void BOPAlgo_PaveFiller::PerformFF(const Message_ProgressRange& theRange)
     }
   }
 
-  // Prepare the pairs of faces for intersection
-  BOPAlgo_VectorOfFaceFace aVFaceFace;
+  // Prepare the pairs of faces for intersection;
+  // samplings of the surfaces are shared by all pairs including the same face
+  BOPAlgo_VectorOfFaceFace            aVFaceFace;
+  occ::handle<IntPolyh_SamplingCache> aSamplingCache = new IntPolyh_SamplingCache();
   myIterator->Initialize(TopAbs_FACE, TopAbs_FACE);
   for (; myIterator->More(); myIterator->Next())
   {
@@ -504,6 +670,7 @@ void BOPAlgo_PaveFiller::PerformFF(const Message_ProgressRange& theRange)
       //
       aFaceFace.SetParameters(bApprox, bCompC2D1, bCompC2D2, anApproxTol);
       aFaceFace.SetFuzzyValue(myFuzzyValue);
+      aFaceFace.SetSamplingCache(aSamplingCache);
     }
     else
     {
@@ -516,12 +683,13 @@ void BOPAlgo_PaveFiller::PerformFF(const Message_ProgressRange& theRange)
   } // for (; myIterator->More(); myIterator->Next()) {
   //
   int k, aNbFaceFace = aVFaceFace.Length();
-  ;
+  aPhase.AddPairs(aNbFaceFace);
   Message_ProgressScope aPS(aPSOuter.Next(), "Performing Face-Face intersection", aNbFaceFace);
   for (k = 0; k < aNbFaceFace; k++)
   {
     BOPAlgo_FaceFace& aFaceFace = aVFaceFace.ChangeValue(k);
     aFaceFace.SetProgressRange(aPS.Next());
+    aFaceFace.SetStatistics(myStatistics);
   }
   //======================================================
   // Perform intersection
@@ -567,6 +735,7 @@ void BOPAlgo_PaveFiller::PerformFF(const Message_ProgressRange& theRange)
     if (aNbCurves || aNbPoints)
     {
       myDS->AddInterf(nF1, nF2);
+      aPhase.AddIntersected();
     }
     //
     BOPDS_InterfFF& aFF = aFFs.Appended();
@@ -645,7 +814,8 @@ static void UpdateSavedTolerance(const BOPDS_PDS&                  theDS,
 
 void BOPAlgo_PaveFiller::MakeBlocks(const Message_ProgressRange& theRange)
 {
-  Message_ProgressScope aPSOuter(theRange, nullptr, 4);
+  const BOPAlgo_Statistics::Phase aPhase(myStatistics, "MakeBlocks");
+  Message_ProgressScope           aPSOuter(theRange, nullptr, 4);
   if (myGlue != BOPAlgo_GlueOff)
   {
     return;
@@ -668,6 +838,8 @@ void BOPAlgo_PaveFiller::MakeBlocks(const Message_ProgressRange& theRange)
   // Using separate allocator allows to reclaim memory via Reset(false) at the start
   // of each iteration, preventing memory accumulation in the main loop.
   occ::handle<NCollection_IncAllocator> aTmpAllocator = new NCollection_IncAllocator;
+  aAllocator->SetMemTag(OSD_MemInfo::MemTag_BOPDS);
+  aTmpAllocator->SetMemTag(OSD_MemInfo::MemTag_BOPDS);
   NCollection_List<occ::handle<BOPDS_PaveBlock>>::Iterator aItLPB;
   TopoDS_Edge                                              aES;
   occ::handle<BOPDS_PaveBlock>                             aPBOut;
@@ -677,13 +849,12 @@ void BOPAlgo_PaveFiller::MakeBlocks(const Message_ProgressRange& theRange)
   // Per-iteration collections (use temporary allocator, reset each iteration)
   NCollection_List<int> aLSE(aTmpAllocator), aLBV(aTmpAllocator);
   NCollection_Map<int>  aMVOnIn(100, aTmpAllocator), aMVCommon(100, aTmpAllocator),
-    aMVStick(100, aTmpAllocator), aMVEF(100, aTmpAllocator), aMVBounds(100, aTmpAllocator);
+    aMVBounds(100, aTmpAllocator);
   NCollection_IndexedMap<occ::handle<BOPDS_PaveBlock>> aMPBOnIn(100, aTmpAllocator);
   NCollection_Map<occ::handle<BOPDS_PaveBlock>>        aMPBCommon;
   NCollection_DataMap<int, double>                     aMVTol(100, aTmpAllocator);
   NCollection_DataMap<int, NCollection_List<int>>      aDMBV(100, aTmpAllocator);
   // Cross-iteration collections (use main allocator, persist through entire loop)
-  NCollection_Map<int>                           aMI(100, aAllocator);
   NCollection_Map<occ::handle<BOPDS_PaveBlock>>  aMPBAdd(100, aAllocator);
   NCollection_List<occ::handle<BOPDS_PaveBlock>> aLPB(aAllocator);
   NCollection_IndexedDataMap<TopoDS_Shape, BOPDS_CoupleOfPaveBlocks, TopTools_ShapeMapHasher>
@@ -705,6 +876,11 @@ void BOPAlgo_PaveFiller::MakeBlocks(const Message_ProgressRange& theRange)
   // some of Face-Face intersections to avoid missing section edges
   // aNbFF will be increased to the number of potentially problematic Face-Face intersections
   const int aNbFFPrev = aNbFF;
+  //
+  // The vertices created in the intersections of sub-shapes of the faces are not
+  // changed while processing the interferences, so collect them for all pairs in parallel
+  BOPAlgo_VectorOfStickVertices aVSV;
+  CollectStickVertices(myDS, myRunParallel, aVSV);
   for (i = 0; i < aNbFF; ++i, aPS.Next())
   {
     if (UserBreak(aPS))
@@ -743,8 +919,6 @@ void BOPAlgo_PaveFiller::MakeBlocks(const Message_ProgressRange& theRange)
     aMVTol.Clear();
     aLSE.Clear();
     aLBV.Clear();
-    aMVStick.Clear();
-    aMVEF.Clear();
     aMVBounds.Clear();
     aTmpAllocator->Reset(false);
     //
@@ -772,7 +946,10 @@ void BOPAlgo_PaveFiller::MakeBlocks(const Message_ProgressRange& theRange)
     }
     //
     // 2. Treat Curves
-    GetStickVertices(nF1, nF2, aMVStick, aMVEF, aMI);
+    const BOPAlgo_StickVertices& aSV      = aVSV(aCurInd);
+    const NCollection_Map<int>&  aMVStick = aSV.StickVertices();
+    const NCollection_Map<int>&  aMVEF    = aSV.EFVertices();
+    const NCollection_Map<int>&  aMI      = aSV.SubShapes();
     //
     for (j = 0; j < aNbC; ++j)
     {
@@ -1105,12 +1282,10 @@ void BOPAlgo_PaveFiller::MakeBlocks(const Message_ProgressRange& theRange)
   PutSEInOtherFaces(aPSOuter.Next());
   //
   //-----------------------------------------------------scope t
-  aMVStick.Clear();
   aMPBOnIn.Clear();
   aMVOnIn.Clear();
   aMVCommon.Clear();
   aDMExEdges.Clear();
-  aMI.Clear();
   aDMNewSD.Clear();
 }
 
@@ -1181,14 +1356,14 @@ void BOPAlgo_PaveFiller::PostTreatFF(
   // Find unused vertices
   NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> VertsUnused;
   NCollection_Map<int>                                          IndMap;
+  BOPAlgo_VectorOfStickVertices                                 aVSV;
+  CollectStickVertices(myDS, myRunParallel, aVSV);
   for (int i = 0; i < aNbFF; i++)
   {
     BOPDS_InterfFF& aFF = aFFs(i);
-    int             nF1, nF2;
-    aFF.Indices(nF1, nF2);
 
-    NCollection_Map<int> aMV, aMVEF, aMI;
-    GetStickVertices(nF1, nF2, aMV, aMVEF, aMI);
+    // merge the vertices in the order of interferences to keep the result reproducible
+    NCollection_Map<int>&            aMV = aVSV(i).ChangeStickVertices();
     NCollection_Vector<BOPDS_Curve>& aVC = aFF.ChangeCurves();
     RemoveUsedVertices(aVC, aMV);
 
@@ -2753,77 +2928,14 @@ void BOPAlgo_PaveFiller::GetStickVertices(const int             nF1,
                                           NCollection_Map<int>& aMVEF,
                                           NCollection_Map<int>& aMI)
 {
-  int nS1, nS2, nVNew, aTypeInt, i;
-  //
-  NCollection_Vector<BOPDS_InterfVV>& aVVs = myDS->InterfVV();
-  NCollection_Vector<BOPDS_InterfVE>& aVEs = myDS->InterfVE();
-  NCollection_Vector<BOPDS_InterfEE>& aEEs = myDS->InterfEE();
-  NCollection_Vector<BOPDS_InterfVF>& aVFs = myDS->InterfVF();
-  NCollection_Vector<BOPDS_InterfEF>& aEFs = myDS->InterfEF();
-  //
-  int aNbLines[5] = {aVVs.Length(), aVEs.Length(), aEEs.Length(), aVFs.Length(), aEFs.Length()};
-  // collect indices of all shapes from nF1 and nF2.
-  aMI.Clear();
-  GetFullShapeMap(nF1, aMI);
-  GetFullShapeMap(nF2, aMI);
-  //
-  // collect VV, VE, EE, VF interferences
-  for (aTypeInt = 0; aTypeInt < 4; ++aTypeInt)
-  {
-    for (i = 0; i < aNbLines[aTypeInt]; ++i)
-    {
-      BOPDS_Interf* aInt = (aTypeInt == 0)
-                             ? (BOPDS_Interf*)(&aVVs(i))
-                             : ((aTypeInt == 1) ? (BOPDS_Interf*)(&aVEs(i))
-                                                : ((aTypeInt == 2) ? (BOPDS_Interf*)(&aEEs(i))
-                                                                   : (BOPDS_Interf*)(&aVFs(i))));
-      if (aInt->HasIndexNew())
-      {
-        aInt->Indices(nS1, nS2);
-        if (aMI.Contains(nS1) && aMI.Contains(nS2))
-        {
-          nVNew = aInt->IndexNew();
-          myDS->HasShapeSD(nVNew, nVNew);
-          aMVStick.Add(nVNew);
-        }
-      }
-    }
-  }
-  // collect EF interferences
-  for (i = 0; i < aNbLines[4]; ++i)
-  {
-    const BOPDS_InterfEF& aInt = aEFs(i);
-    if (aInt.HasIndexNew())
-    {
-      aInt.Indices(nS1, nS2);
-      if (aMI.Contains(nS1) && aMI.Contains(nS2))
-      {
-        nVNew = aInt.IndexNew();
-        myDS->HasShapeSD(nVNew, nVNew);
-        aMVStick.Add(nVNew);
-        aMVEF.Add(nVNew);
-      }
-    }
-  }
+  CollectStickVertices(myDS, nF1, nF2, aMVStick, aMVEF, aMI);
 }
 
 //=================================================================================================
 
 void BOPAlgo_PaveFiller::GetFullShapeMap(const int nF, NCollection_Map<int>& aMI)
 {
-  NCollection_List<int>::Iterator aIt;
-  int                             nS;
-  //
-  const BOPDS_ShapeInfo&       aSI = myDS->ShapeInfo(nF);
-  const NCollection_List<int>& aLI = aSI.SubShapes();
-  //
-  aMI.Add(nF);
-  aIt.Initialize(aLI);
-  for (; aIt.More(); aIt.Next())
-  {
-    nS = aIt.Value();
-    aMI.Add(nS);
-  }
+  AddFullShapeMap(myDS, nF, aMI);
 }
 
 //=================================================================================================
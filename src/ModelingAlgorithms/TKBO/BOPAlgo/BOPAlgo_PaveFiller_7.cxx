@@ -360,6 +360,7 @@ typedef NCollection_Vector<BOPAlgo_BPC> BOPAlgo_VectorOfBPC;
 
 void BOPAlgo_PaveFiller::MakeSplitEdges(const Message_ProgressRange& theRange)
 {
+  const BOPAlgo_Statistics::Phase aPhase(myStatistics, "MakeSplitEdges");
   NCollection_Vector<NCollection_List<occ::handle<BOPDS_PaveBlock>>>& aPBP =
     myDS->ChangePaveBlocksPool();
   int                   aNbPBP = aPBP.Length();
@@ -572,7 +573,8 @@ int BOPAlgo_PaveFiller::SplitEdge(const int    nE,
 
 void BOPAlgo_PaveFiller::MakePCurves(const Message_ProgressRange& theRange)
 {
-  Message_ProgressScope aPSOuter(theRange, nullptr, 1);
+  const BOPAlgo_Statistics::Phase aPhase(myStatistics, "MakePCurves");
+  Message_ProgressScope           aPSOuter(theRange, nullptr, 1);
   if (myAvoidBuildPCurve || (!mySectionAttribute.PCurveOnS1() && !mySectionAttribute.PCurveOnS2()))
     return;
   bool                                                     bHasPC;
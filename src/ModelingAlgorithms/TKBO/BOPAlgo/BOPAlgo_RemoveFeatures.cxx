@@ -347,6 +347,63 @@ void BOPAlgo_RemoveFeatures::PrepareFeatures(const Message_ProgressRange& theRan
 //=======================================================================
 // Adjacent faces extension block
 
+//=======================================================================
+// class: ExtendFace
+// purpose: Auxiliary class for extension of the single face adjacent
+//          to the feature, allowing extension of the faces in parallel
+//=======================================================================
+class ExtendFace
+{
+public: //! @name Constructors
+  //! Empty constructor
+  ExtendFace()
+      : myExtLength(0.0),
+        myIsDone(false)
+  {
+  }
+
+public: //! @name Setters/Getters
+  //! Sets the face to extend
+  void SetFace(const TopoDS_Face& theFace) { myFace = theFace; }
+
+  //! Returns the face to extend
+  const TopoDS_Face& Face() const { return myFace; }
+
+  //! Sets the extension length
+  void SetExtLength(const double theExtLength) { myExtLength = theExtLength; }
+
+  //! Returns the extended face
+  const TopoDS_Face& ExtendedFace() const { return myExtFace; }
+
+  //! Shows whether the face has been extended
+  bool IsDone() const { return myIsDone; }
+
+public: //! @name Perform the operation
+  //! Extends the face in all directions
+  void Perform()
+  {
+    OCC_CATCH_SIGNALS
+
+    try
+    {
+      BRepLib::ExtendFace(myFace, myExtLength, true, true, true, true, myExtFace);
+      myIsDone = !myExtFace.IsNull();
+    }
+    catch (Standard_Failure const&)
+    {
+      myIsDone = false;
+    }
+  }
+
+private: //! @name Fields
+  TopoDS_Face myFace;      //!< Face to extend
+  double      myExtLength; //!< Extension length
+  TopoDS_Face myExtFace;   //!< Extended face
+  bool        myIsDone;    //!< Status of the extension
+};
+
+typedef NCollection_Vector<ExtendFace> VectorOfExtendFace;
+
 //=======================================================================
 // class: FillGaps
 // purpose: Auxiliary class for creation of the faces for filling the gap
@@ -393,7 +450,7 @@ public: //! @name Setters/Getters
   void SetRunParallel(const bool bRunParallel) { myRunParallel = bRunParallel; }
 
   //! Gets the History object
-  const occ::handle<BRepTools_History>& History() { return myHistory; }
+  const occ::handle<BRepTools_History>& History() const { return myHistory; }
 
   void SetRange(const Message_ProgressRange& theRange) { myRange = theRange; }
 
@@ -411,21 +468,20 @@ public: //! @name Perform the operation
       myHistory = new BRepTools_History();
 
       // Find the faces adjacent to the faces of the feature
-      NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> aMFAdjacent;
-      FindAdjacentFaces(aMFAdjacent, aPS.Next());
+      FindAdjacentFaces(myAdjacentFacesMap, aPS.Next());
       if (!aPS.More())
       {
         return;
       }
 
-      myHasAdjacentFaces = (aMFAdjacent.Extent() > 0);
+      myHasAdjacentFaces = (myAdjacentFacesMap.Extent() > 0);
       if (!myHasAdjacentFaces)
         return;
 
       // Extend the adjacent faces keeping the connection to the original faces
       NCollection_IndexedDataMap<TopoDS_Shape, TopoDS_Shape, TopTools_ShapeMapHasher>
         aFaceExtFaceMap;
-      ExtendAdjacentFaces(aMFAdjacent, aFaceExtFaceMap, aPS.Next());
+      ExtendAdjacentFaces(myAdjacentFacesMap, aFaceExtFaceMap, aPS.Next());
       if (!aPS.More())
       {
         return;
@@ -467,6 +523,12 @@ public: //! @name Obtain the result
     return mySolids;
   }
 
+  //! Returns the faces adjacent to the feature
+  const NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher>& AdjacentFacesMap() const
+  {
+    return myAdjacentFacesMap;
+  }
+
 private: //! @name Private methods performing the operation
   //! Finds the faces adjacent to the feature and stores them into outgoing map.
   void FindAdjacentFaces(
@@ -560,16 +622,27 @@ private: //! @name Private methods performing the operation
 
     const double anExtLength = sqrt(aFeatureBox.SquareExtent());
 
-    const int             aNbFA = theMFAdjacent.Extent();
-    Message_ProgressScope aPS(theRange, "Extending adjacent faces", aNbFA);
-    for (int i = 1; i <= aNbFA && aPS.More(); ++i, aPS.Next())
+    // The faces are extended independently, thus in parallel
+    const int          aNbFA = theMFAdjacent.Extent();
+    VectorOfExtendFace aVExt;
+    for (int i = 1; i <= aNbFA; ++i)
+    {
+      ExtendFace& anExt = aVExt.Appended();
+      anExt.SetFace(TopoDS::Face(theMFAdjacent(i)));
+      anExt.SetExtLength(anExtLength);
+    }
+
+    Message_ProgressScope aPS(theRange, "Extending adjacent faces", 1);
+    BOPTools_Parallel::Perform(myRunParallel && aNbFA > 1, aVExt);
+    aPS.Next();
+
+    for (int i = 0; i < aNbFA; ++i)
     {
-      const TopoDS_Face& aF = TopoDS::Face(theMFAdjacent(i));
-      // Extend the face
-      TopoDS_Face aFExt;
-      BRepLib::ExtendFace(aF, anExtLength, true, true, true, true, aFExt);
-      theFaceExtFaceMap.Add(aF, aFExt);
-      myHistory->AddModified(aF, aFExt);
+      const ExtendFace& anExt = aVExt(i);
+      if (!anExt.IsDone())
+        throw Standard_Failure("BOPAlgo_RemoveFeatures: unable to extend the adjacent face");
+      theFaceExtFaceMap.Add(anExt.Face(), anExt.ExtendedFace());
+      myHistory->AddModified(anExt.Face(), anExt.ExtendedFace());
     }
   }
 
@@ -826,6 +899,7 @@ private: //! @name Fields
   NCollection_Map<TopoDS_Shape, TopTools_ShapeMapHasher> myFeatureFacesMap;              //!< Faces of the feature
   bool myHasAdjacentFaces;                //!< Flag to show whether the adjacent faces have been found or not
   NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> mySolids;                //!< Solids participating in the feature removal
+  NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> myAdjacentFacesMap;      //!< Faces adjacent to the feature
   NCollection_IndexedDataMap<TopoDS_Shape, NCollection_List<TopoDS_Shape>, TopTools_ShapeMapHasher> myFaces;  //!< Reconstructed adjacent faces
   occ::handle<BRepTools_History> myHistory;                //!< History of the adjacent faces reconstruction
   // clang-format on
@@ -853,13 +927,13 @@ void BOPAlgo_RemoveFeatures::RemoveFeatures(const Message_ProgressRange& theRang
   // shape to find faces adjacent to the feature
   NCollection_IndexedDataMap<TopoDS_Shape, NCollection_List<TopoDS_Shape>, TopTools_ShapeMapHasher>
     anEFMap;
-  TopExp::MapShapesAndAncestors(myInputShape, TopAbs_EDGE, TopAbs_FACE, anEFMap);
+  TopExp::MapShapesAndAncestors(myInputShape, TopAbs_EDGE, TopAbs_FACE, anEFMap, RunParallel());
 
   // Make Face-Solid connection map to find the solids
   // participating in the removal of each feature
   NCollection_IndexedDataMap<TopoDS_Shape, NCollection_List<TopoDS_Shape>, TopTools_ShapeMapHasher>
     anFSMap;
-  TopExp::MapShapesAndAncestors(myInputShape, TopAbs_FACE, TopAbs_SOLID, anFSMap);
+  TopExp::MapShapesAndAncestors(myInputShape, TopAbs_FACE, TopAbs_SOLID, anFSMap, RunParallel());
 
   // Tool for reconstruction of the faces adjacent to the feature
   // in parallel threads if necessary.
@@ -897,40 +971,158 @@ void BOPAlgo_RemoveFeatures::RemoveFeatures(const Message_ProgressRange& theRang
   if (myHistory.IsNull())
     myHistory = new BRepTools_History();
 
-  // Remove the features one by one.
+  // Gather the features into batches of the features not sharing neither
+  // the faces nor the adjacent faces, so that the solids are rebuilt once
+  // for the whole batch instead of once for each feature.
+  // The features with problems of reconstruction of the adjacent faces and
+  // the features without adjacent faces are treated separately.
+  NCollection_Vector<NCollection_List<int>>                                  aBatches;
+  NCollection_Vector<NCollection_Map<TopoDS_Shape, TopTools_ShapeMapHasher>> aBatchFaces;
+  for (int i = 0; i < aNbF; ++i)
+  {
+    const FillGap& aFG = aVFG(i);
+    if (!aFG.HasAdjacentFaces() || aFG.Faces().IsEmpty())
+    {
+      aBatches.Appended().Append(i);
+      aBatchFaces.Appended();
+      continue;
+    }
+
+    // Faces involved in the removal of the feature
+    NCollection_List<TopoDS_Shape> aFeatureFaces;
+    for (TopoDS_Iterator itF(aFG.Feature()); itF.More(); itF.Next())
+      aFeatureFaces.Append(itF.Value());
+    for (int j = 1; j <= aFG.AdjacentFacesMap().Extent(); ++j)
+      aFeatureFaces.Append(aFG.AdjacentFacesMap()(j));
+
+    // Find the first batch not involving these faces
+    int aBatchIndex = 0;
+    for (; aBatchIndex < aBatches.Length(); ++aBatchIndex)
+    {
+      const NCollection_Map<TopoDS_Shape, TopTools_ShapeMapHasher>& aMF =
+        aBatchFaces(aBatchIndex);
+      if (aMF.IsEmpty())
+        continue;
+
+      NCollection_List<TopoDS_Shape>::Iterator itLF(aFeatureFaces);
+      for (; itLF.More(); itLF.Next())
+      {
+        if (aMF.Contains(itLF.Value()))
+          break;
+      }
+      if (!itLF.More())
+        break;
+    }
+
+    if (aBatchIndex == aBatches.Length())
+    {
+      aBatches.Appended();
+      aBatchFaces.Appended();
+    }
+    aBatches.ChangeValue(aBatchIndex).Append(i);
+    NCollection_List<TopoDS_Shape>::Iterator itLF(aFeatureFaces);
+    for (; itLF.More(); itLF.Next())
+      aBatchFaces.ChangeValue(aBatchIndex).Add(itLF.Value());
+  }
+
+  // Remove the features batch by batch.
+  // If the removal of the batch fails, its features are removed one by one.
   // It will allow removing the features even if there were
   // some problems with removal of the previous features.
-  Message_ProgressScope aPSLoop(aPSOuter.Next(), "Removing features one by one", aNbF);
-  for (int i = 0; i < aNbF; ++i)
+  const int             aNbBatches = aBatches.Length();
+  Message_ProgressScope aPSLoop(aPSOuter.Next(), "Removing features", aNbF);
+  for (int iB = 0; iB < aNbBatches; ++iB)
   {
     if (UserBreak(aPSLoop))
     {
       return;
     }
-    FillGap& aFG = aVFG(i);
+    const NCollection_List<int>& aBatch  = aBatches(iB);
+    const int                    aNbInB  = aBatch.Extent();
+    const bool                   isLastB = (iB == aNbBatches - 1);
 
     // No need to fill the history for solids if the history is not
     // requested and the current feature is the last one.
-    bool isSolidsHistoryNeeded = HasHistory() || (i < (aNbF - 1));
-
-    // Perform removal of the single feature
-    RemoveFeature(aFG.Feature(),
-                  aFG.Solids(),
-                  aFG.FeatureFacesMap(),
-                  aFG.HasAdjacentFaces(),
-                  aFG.Faces(),
-                  aFG.History(),
-                  isSolidsHistoryNeeded,
-                  aPSLoop.Next());
+    const bool isSolidsHistoryNeeded = HasHistory() || !isLastB;
+
+    Message_ProgressScope aPSB(aPSLoop.Next(aNbInB), nullptr, aNbInB > 1 ? 2 * aNbInB : 1);
+    if (aNbInB == 1)
+    {
+      // Perform removal of the single feature
+      const FillGap& aFG = aVFG(aBatch.First());
+      if (!RemoveFeature(aFG.Solids(),
+                         aFG.FeatureFacesMap(),
+                         aFG.HasAdjacentFaces(),
+                         aFG.Faces(),
+                         aFG.History(),
+                         isSolidsHistoryNeeded,
+                         aPSB.Next()))
+      {
+        AddWarning(new BOPAlgo_AlertUnableToRemoveTheFeature(aFG.Feature()));
+      }
+      continue;
+    }
+
+    // Merge the data of the features of the batch
+    NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> aSolids;
+    NCollection_Map<TopoDS_Shape, TopTools_ShapeMapHasher>        aFeatureFacesMap;
+    NCollection_IndexedDataMap<TopoDS_Shape, NCollection_List<TopoDS_Shape>, TopTools_ShapeMapHasher>
+                                   anAdjFaces;
+    occ::handle<BRepTools_History> anAdjFacesHistory = new BRepTools_History();
+    for (NCollection_List<int>::Iterator itB(aBatch); itB.More(); itB.Next())
+    {
+      const FillGap& aFG = aVFG(itB.Value());
+      for (int j = 1; j <= aFG.Solids().Extent(); ++j)
+        aSolids.Add(aFG.Solids()(j));
+      for (NCollection_Map<TopoDS_Shape, TopTools_ShapeMapHasher>::Iterator itM(
+             aFG.FeatureFacesMap());
+           itM.More();
+           itM.Next())
+        aFeatureFacesMap.Add(itM.Value());
+      for (int j = 1; j <= aFG.Faces().Extent(); ++j)
+        anAdjFaces.Add(aFG.Faces().FindKey(j), aFG.Faces()(j));
+      anAdjFacesHistory->Merge(aFG.History());
+    }
+
+    // Perform removal of all features of the batch at once
+    if (RemoveFeature(aSolids,
+                      aFeatureFacesMap,
+                      true,
+                      anAdjFaces,
+                      anAdjFacesHistory,
+                      isSolidsHistoryNeeded,
+                      aPSB.Next(aNbInB)))
+    {
+      continue;
+    }
+
+    // Remove the features of the batch one by one
+    for (NCollection_List<int>::Iterator itB(aBatch); itB.More(); itB.Next())
+    {
+      if (UserBreak(aPSB))
+      {
+        return;
+      }
+      const FillGap& aFG = aVFG(itB.Value());
+      if (!RemoveFeature(aFG.Solids(),
+                         aFG.FeatureFacesMap(),
+                         aFG.HasAdjacentFaces(),
+                         aFG.Faces(),
+                         aFG.History(),
+                         HasHistory() || !isLastB || itB.Value() != aBatch.Last(),
+                         aPSB.Next()))
+      {
+        AddWarning(new BOPAlgo_AlertUnableToRemoveTheFeature(aFG.Feature()));
+      }
+    }
   }
 }
 
 //=======================================================================
 // function: RemoveFeature
-// purpose: Remove the single feature
+// purpose: Remove the single feature or the batch of features
 //=======================================================================
-void BOPAlgo_RemoveFeatures::RemoveFeature(
-  const TopoDS_Shape&                                                  theFeature,
+bool BOPAlgo_RemoveFeatures::RemoveFeature(
   const NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher>& theSolids,
   const NCollection_Map<TopoDS_Shape, TopTools_ShapeMapHasher>&        theFeatureFacesMap,
   const bool                                                           theHasAdjacentFaces,
@@ -949,9 +1141,7 @@ void BOPAlgo_RemoveFeatures::RemoveFeature(
     {
       // The adjacent faces have been found for the feature,
       // but something went wrong during their rebuilding.
-      // Add error
-      AddWarning(new BOPAlgo_AlertUnableToRemoveTheFeature(theFeature));
-      return;
+      return false;
     }
 
     // No adjacent faces have been found for the feature.
@@ -1054,9 +1244,7 @@ void BOPAlgo_RemoveFeatures::RemoveFeature(
   aMV.Perform(aPS.Next(90));
   if (aMV.HasErrors())
   {
-    // Add warning for the feature
-    AddWarning(new BOPAlgo_AlertUnableToRemoveTheFeature(theFeature));
-    return;
+    return false;
   }
 
   // Result of MV operation
@@ -1064,9 +1252,8 @@ void BOPAlgo_RemoveFeatures::RemoveFeature(
   TopExp_Explorer     anExpS(aSolids, TopAbs_SOLID);
   if (!anExpS.More())
   {
-    // No solids have been built - add warning for the feature
-    AddWarning(new BOPAlgo_AlertUnableToRemoveTheFeature(theFeature));
-    return;
+    // No solids have been built
+    return false;
   }
 
   // Now, it is necessary to:
@@ -1081,7 +1268,7 @@ void BOPAlgo_RemoveFeatures::RemoveFeature(
   {
     if (!aPS.More())
     {
-      return;
+      return false;
     }
     const TopoDS_Shape&                   aF    = theAdjFaces.FindKey(i);
     const NCollection_List<TopoDS_Shape>& aLFIm = myHistory->Modified(aF);
@@ -1106,7 +1293,7 @@ void BOPAlgo_RemoveFeatures::RemoveFeature(
       continue;
     if (!aPS.More())
     {
-      return;
+      return false;
     }
     TopExp_Explorer anExpF(aS, TopAbs_FACE);
     for (; anExpF.More(); anExpF.Next())
@@ -1120,9 +1307,7 @@ void BOPAlgo_RemoveFeatures::RemoveFeature(
 
   if (!bValid)
   {
-    // Add warning for the feature
-    AddWarning(new BOPAlgo_AlertUnableToRemoveTheFeature(theFeature));
-    return;
+    return false;
   }
 
   // It is possible that the result of MakerVolume operation contains
@@ -1140,9 +1325,7 @@ void BOPAlgo_RemoveFeatures::RemoveFeature(
 
   if (aLSRes.Extent() != theSolids.Extent())
   {
-    // Add warning for the feature
-    AddWarning(new BOPAlgo_AlertUnableToRemoveTheFeature(theFeature));
-    return;
+    return false;
   }
   aPS.Next(3);
   // Remove internal wires from the faces, possibly appeared after intersection
@@ -1191,6 +1374,7 @@ void BOPAlgo_RemoveFeatures::RemoveFeature(
 
   // Save the result
   myShape = aCRes;
+  return true;
 }
 
 //=======================================================================
@@ -49,6 +49,9 @@
 //! The features will be removed from the shape one by one.
 //! It will allow removing all possible features even if there
 //! were problems with the removal of some of them.
+//! To avoid rebuilding of the whole shape for each feature, the features
+//! not sharing the faces and the adjacent faces are removed together
+//! in one pass, falling back to the removal one by one if it fails.
 //!
 //! The removed feature is filled by the extension of the faces adjacent
 //! to the feature. In general, the algorithm of removing of the single
@@ -214,11 +217,11 @@ protected: //! @name Protected methods performing the removal
   Standard_EXPORT void PrepareFeatures(const Message_ProgressRange& theRange);
 
   //! Removes the features and fills the created gaps by extension of the adjacent faces.
-  //! Processes each feature separately.
+  //! The gaps are filled for each feature separately, while the solids are rebuilt
+  //! once for each batch of features not sharing the faces and the adjacent faces.
   Standard_EXPORT void RemoveFeatures(const Message_ProgressRange& theRange);
 
-  //! Remove the single feature from the shape.
-  //! @param[in] theFeature  The feature to remove;
+  //! Remove the single feature or the batch of independent features from the shape.
   //! @param[in] theSolids  The solids to be reconstructed after feature removal;
   //! @param[in] theFeatureFacesMap  The map of feature faces;
   //! @param[in] theHasAdjacentFaces  Shows whether the adjacent faces have been
@@ -227,8 +230,8 @@ protected: //! @name Protected methods performing the removal
   //! @param[in] theAdjFacesHistory  The history of the adjacent faces reconstruction;
   //! @param[in] theSolidsHistoryNeeded  Defines whether the history of solids
   //!                                    modifications should be tracked or not.
-  Standard_EXPORT void RemoveFeature(
-    const TopoDS_Shape&                                                  theFeature,
+  //! @return false if the feature cannot be removed; the result is not modified in this case.
+  Standard_EXPORT bool RemoveFeature(
     const NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher>& theSolids,
     const NCollection_Map<TopoDS_Shape, TopTools_ShapeMapHasher>&        theFeatureFacesMap,
     const bool                                                           theHasAdjacentFaces,
@@ -87,6 +87,7 @@ void BOPAlgo_Splitter::Perform(const Message_ProgressRange& theRange)
   pPF->SetNonDestructive(myNonDestructive);
   pPF->SetGlue(myGlue);
   pPF->SetUseOBB(myUseOBB);
+  pPF->SetStatistics(myStatistics);
   //
   Message_ProgressScope aPS(theRange, "Performing Split operation", 10);
   pPF->Perform(aPS.Next(9));
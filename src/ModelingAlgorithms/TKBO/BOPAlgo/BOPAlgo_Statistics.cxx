@@ -0,0 +1,243 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BOPAlgo_Statistics.hxx>
+
+#include <OSD_Chronometer.hxx>
+#include <OSD_Timer.hxx>
+
+#include <cstring>
+
+IMPLEMENT_STANDARD_RTTIEXT(BOPAlgo_Statistics, Standard_Transient)
+
+namespace
+{
+//! Returns CPU time of the process in seconds.
+static double processCPUTime()
+{
+  double aUserSec = 0.0, aSystemSec = 0.0;
+  OSD_Chronometer::GetProcessCPU(aUserSec, aSystemSec);
+  return aUserSec + aSystemSec;
+}
+} // namespace
+
+//=================================================================================================
+
+BOPAlgo_Statistics::Phase::Phase(const occ::handle<BOPAlgo_Statistics>& theStatistics,
+                                 const char*                            theName)
+    : myStatistics(theStatistics),
+      myStartWall(0.0),
+      myStartCPU(0.0)
+{
+  myInfo.Name          = theName;
+  myInfo.WallTime      = 0.0;
+  myInfo.CPUTime       = 0.0;
+  myInfo.NbRuns        = 1;
+  myInfo.NbPairs       = 0;
+  myInfo.NbIntersected = 0;
+  if (!myStatistics.IsNull())
+  {
+    myStartWall = OSD_Timer::GetWallClockTime();
+    myStartCPU  = processCPUTime();
+  }
+}
+
+//=================================================================================================
+
+BOPAlgo_Statistics::Phase::~Phase()
+{
+  if (!myStatistics.IsNull())
+  {
+    myInfo.WallTime = OSD_Timer::GetWallClockTime() - myStartWall;
+    myInfo.CPUTime  = processCPUTime() - myStartCPU;
+    myStatistics->AddPhase(myInfo);
+  }
+}
+
+//=================================================================================================
+
+BOPAlgo_Statistics::PairTimer::PairTimer(const occ::handle<BOPAlgo_Statistics>& theStatistics,
+                                         const char*                            thePhase,
+                                         const int                              theIndex1,
+                                         const int                              theIndex2)
+    : myStatistics(theStatistics),
+      myPhase(thePhase),
+      myIndex1(theIndex1),
+      myIndex2(theIndex2),
+      myStart(!theStatistics.IsNull() ? OSD_Timer::GetWallClockTime() : 0.0)
+{
+}
+
+//=================================================================================================
+
+BOPAlgo_Statistics::PairTimer::~PairTimer()
+{
+  if (!myStatistics.IsNull())
+  {
+    myStatistics->AddPair(myPhase, myIndex1, myIndex2, OSD_Timer::GetWallClockTime() - myStart);
+  }
+}
+
+//=================================================================================================
+
+BOPAlgo_Statistics::BOPAlgo_Statistics(const int theNbSlowestPairs)
+    : myNbSlowestPairs(std::max(theNbSlowestPairs, 0))
+{
+}
+
+//=================================================================================================
+
+void BOPAlgo_Statistics::AddPhase(const PhaseInfo& thePhase)
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  for (NCollection_Vector<PhaseInfo>::Iterator anIt(myPhases); anIt.More(); anIt.Next())
+  {
+    PhaseInfo& aPhase = anIt.ChangeValue();
+    if (std::strcmp(aPhase.Name, thePhase.Name) == 0)
+    {
+      aPhase.WallTime += thePhase.WallTime;
+      aPhase.CPUTime += thePhase.CPUTime;
+      aPhase.NbRuns += thePhase.NbRuns;
+      aPhase.NbPairs += thePhase.NbPairs;
+      aPhase.NbIntersected += thePhase.NbIntersected;
+      return;
+    }
+  }
+  myPhases.Append(thePhase);
+}
+
+//=================================================================================================
+
+void BOPAlgo_Statistics::AddPair(const char*  thePhase,
+                                 const int    theIndex1,
+                                 const int    theIndex2,
+                                 const double theTime)
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  if (myNbSlowestPairs == 0
+      || (myPairs.Length() == myNbSlowestPairs && myPairs.Last().Time >= theTime))
+  {
+    return;
+  }
+
+  // insert the pair keeping the order of decreasing time
+  if (myPairs.Length() < myNbSlowestPairs)
+  {
+    myPairs.Append(PairInfo());
+  }
+  int anIndex = myPairs.Upper();
+  for (; anIndex > 0 && myPairs(anIndex - 1).Time < theTime; --anIndex)
+  {
+    myPairs(anIndex) = myPairs(anIndex - 1);
+  }
+  PairInfo& aPair = myPairs(anIndex);
+  aPair.Phase     = thePhase;
+  aPair.Index1    = theIndex1;
+  aPair.Index2    = theIndex2;
+  aPair.Time      = theTime;
+}
+
+//=================================================================================================
+
+void BOPAlgo_Statistics::SetCache(const char*       theName,
+                                  const std::size_t theNbHits,
+                                  const std::size_t theNbMisses)
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  CacheInfo*                  aCache = nullptr;
+  for (NCollection_Vector<CacheInfo>::Iterator anIt(myCaches); anIt.More(); anIt.Next())
+  {
+    if (std::strcmp(anIt.Value().Name, theName) == 0)
+    {
+      aCache = &anIt.ChangeValue();
+      break;
+    }
+  }
+  if (aCache == nullptr)
+  {
+    aCache = &myCaches.Appended();
+  }
+  aCache->Name     = theName;
+  aCache->NbHits   = theNbHits;
+  aCache->NbMisses = theNbMisses;
+}
+
+//=================================================================================================
+
+NCollection_Vector<BOPAlgo_Statistics::PhaseInfo> BOPAlgo_Statistics::Phases() const
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  return myPhases;
+}
+
+//=================================================================================================
+
+NCollection_Vector<BOPAlgo_Statistics::PairInfo> BOPAlgo_Statistics::SlowestPairs() const
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  return myPairs;
+}
+
+//=================================================================================================
+
+NCollection_Vector<BOPAlgo_Statistics::CacheInfo> BOPAlgo_Statistics::Caches() const
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  return myCaches;
+}
+
+//=================================================================================================
+
+void BOPAlgo_Statistics::Clear()
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  myPhases.Clear();
+  myPairs.Clear();
+  myCaches.Clear();
+}
+
+//=================================================================================================
+
+void BOPAlgo_Statistics::Dump(Standard_OStream& theOS) const
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  theOS << "Phases (wall time, CPU time, runs, pairs tested, pairs intersected):\n";
+  for (NCollection_Vector<PhaseInfo>::Iterator anIt(myPhases); anIt.More(); anIt.Next())
+  {
+    const PhaseInfo& aPhase = anIt.Value();
+    theOS << "  " << aPhase.Name << ": " << aPhase.WallTime << " s, " << aPhase.CPUTime << " s, "
+          << aPhase.NbRuns << ", " << aPhase.NbPairs << ", " << aPhase.NbIntersected << "\n";
+  }
+  if (!myPairs.IsEmpty())
+  {
+    theOS << "Slowest pairs (phase, indices of shapes, wall time):\n";
+    for (NCollection_Vector<PairInfo>::Iterator anIt(myPairs); anIt.More(); anIt.Next())
+    {
+      const PairInfo& aPair = anIt.Value();
+      theOS << "  " << aPair.Phase << ": " << aPair.Index1 << " " << aPair.Index2 << ": "
+            << aPair.Time << " s\n";
+    }
+  }
+  if (!myCaches.IsEmpty())
+  {
+    theOS << "Caches (hits, misses, hit rate):\n";
+    for (NCollection_Vector<CacheInfo>::Iterator anIt(myCaches); anIt.More(); anIt.Next())
+    {
+      const CacheInfo&  aCache     = anIt.Value();
+      const std::size_t aNbRequest = aCache.NbHits + aCache.NbMisses;
+      theOS << "  " << aCache.Name << ": " << aCache.NbHits << ", " << aCache.NbMisses << ", "
+            << (aNbRequest > 0 ? 100.0 * double(aCache.NbHits) / double(aNbRequest) : 0.0)
+            << " %\n";
+    }
+  }
+}
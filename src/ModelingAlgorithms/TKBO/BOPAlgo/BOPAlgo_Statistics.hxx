@@ -0,0 +1,182 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BOPAlgo_Statistics_HeaderFile
+#define _BOPAlgo_Statistics_HeaderFile
+
+#include <Standard.hxx>
+#include <Standard_OStream.hxx>
+#include <Standard_Transient.hxx>
+#include <NCollection_Vector.hxx>
+
+#include <mutex>
+
+//! Statistics of the run of the algorithms of Boolean Component,
+//! intended to find the bottlenecks of the operations on the particular inputs.
+//!
+//! For each phase of the algorithm (intersection of shapes of certain types,
+//! splitting of edges, building of split faces etc.) the wall and CPU time,
+//! the number of pairs of shapes tested for intersection and the number
+//! of intersected pairs are collected. Additionally, the slowest individual
+//! pairs of intersected shapes are kept with indices of the shapes in the Data Structure.
+//!
+//! The phases are named after the methods of the algorithms and may be nested,
+//! e.g. the time of "IntersectVE" phase is also included in "PerformVE" one.
+//!
+//! The statistics are accumulated until Clear(), so that the same object can be shared
+//! between the intersection and building parts of the operation
+//! (see BOPAlgo_Options::SetStatistics()). The object is thread-safe.
+class BOPAlgo_Statistics : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(BOPAlgo_Statistics, Standard_Transient)
+public:
+  //! Statistics of the phase of the algorithm.
+  struct PhaseInfo
+  {
+    const char* Name;          //!< name of the phase
+    double      WallTime;      //!< elapsed wall time in seconds
+    double      CPUTime;       //!< elapsed CPU time of the process in seconds
+    int         NbRuns;        //!< number of runs of the phase
+    int         NbPairs;       //!< number of pairs tested for intersection
+    int         NbIntersected; //!< number of pairs with found interferences
+  };
+
+  //! Statistics of the intersection of pair of shapes.
+  struct PairInfo
+  {
+    const char* Phase;  //!< name of the phase
+    int         Index1; //!< index of the first shape in the Data Structure
+    int         Index2; //!< index of the second shape in the Data Structure
+    double      Time;   //!< wall time of the intersection in seconds
+  };
+
+  //! Usage of the cache of the algorithm.
+  struct CacheInfo
+  {
+    const char* Name;     //!< name of the cache
+    std::size_t NbHits;   //!< number of requests of the cached data
+    std::size_t NbMisses; //!< number of requests which have built the data
+  };
+
+  //! Scoped measuring of the phase, adding the phase to the statistics on destruction.
+  //! Does nothing if the statistics are NULL.
+  class Phase
+  {
+  public:
+    //! Starts measuring.
+    //! @param[in] theStatistics statistics to add the phase to (may be NULL)
+    //! @param[in] theName       name of the phase (static string)
+    Standard_EXPORT Phase(const occ::handle<BOPAlgo_Statistics>& theStatistics,
+                          const char*                            theName);
+
+    //! Stops measuring and adds the phase to the statistics.
+    Standard_EXPORT ~Phase();
+
+    //! Increases the number of pairs tested for intersection.
+    void AddPairs(const int theNbPairs = 1) { myInfo.NbPairs += theNbPairs; }
+
+    //! Increases the number of pairs with found interferences.
+    void AddIntersected(const int theNbPairs = 1) { myInfo.NbIntersected += theNbPairs; }
+
+    //! Returns true if the statistics are being collected.
+    bool IsActive() const { return !myStatistics.IsNull(); }
+
+  private:
+    Phase(const Phase&)            = delete;
+    Phase& operator=(const Phase&) = delete;
+
+  private:
+    occ::handle<BOPAlgo_Statistics> myStatistics;
+    PhaseInfo                       myInfo;
+    double                          myStartWall;
+    double                          myStartCPU;
+  };
+
+  //! Scoped measuring of the intersection of pair of shapes,
+  //! adding the pair to the statistics on destruction.
+  //! Does nothing if the statistics are NULL.
+  class PairTimer
+  {
+  public:
+    //! Starts measuring.
+    //! @param[in] theStatistics statistics to add the pair to (may be NULL)
+    //! @param[in] thePhase      name of the phase (static string)
+    //! @param[in] theIndex1     index of the first shape
+    //! @param[in] theIndex2     index of the second shape
+    Standard_EXPORT PairTimer(const occ::handle<BOPAlgo_Statistics>& theStatistics,
+                              const char*                            thePhase,
+                              const int                              theIndex1,
+                              const int                              theIndex2);
+
+    //! Stops measuring and adds the pair to the statistics.
+    Standard_EXPORT ~PairTimer();
+
+  private:
+    PairTimer(const PairTimer&)            = delete;
+    PairTimer& operator=(const PairTimer&) = delete;
+
+  private:
+    const occ::handle<BOPAlgo_Statistics>& myStatistics;
+    const char*                            myPhase;
+    int                                    myIndex1;
+    int                                    myIndex2;
+    double                                 myStart;
+  };
+
+public:
+  //! Constructor.
+  //! @param[in] theNbSlowestPairs number of the slowest pairs to keep
+  Standard_EXPORT BOPAlgo_Statistics(const int theNbSlowestPairs = 10);
+
+  //! Returns the number of the slowest pairs to keep.
+  int NbSlowestPairs() const { return myNbSlowestPairs; }
+
+  //! Adds the statistics of the phase; the data of the phases with the same name are summed up.
+  Standard_EXPORT void AddPhase(const PhaseInfo& thePhase);
+
+  //! Adds the intersection of the pair of shapes, keeping it only if it is
+  //! among the slowest ones.
+  Standard_EXPORT void AddPair(const char*  thePhase,
+                               const int    theIndex1,
+                               const int    theIndex2,
+                               const double theTime);
+
+  //! Sets the usage of the cache, replacing the one of the cache with the same name.
+  Standard_EXPORT void SetCache(const char*       theName,
+                                const std::size_t theNbHits,
+                                const std::size_t theNbMisses);
+
+  //! Returns the statistics of the phases in the order of their first run.
+  Standard_EXPORT NCollection_Vector<PhaseInfo> Phases() const;
+
+  //! Returns the slowest pairs sorted by decreasing time.
+  Standard_EXPORT NCollection_Vector<PairInfo> SlowestPairs() const;
+
+  //! Returns the usage of the caches.
+  Standard_EXPORT NCollection_Vector<CacheInfo> Caches() const;
+
+  //! Clears the collected statistics.
+  Standard_EXPORT void Clear();
+
+  //! Dumps the statistics into the stream in human readable form.
+  Standard_EXPORT void Dump(Standard_OStream& theOS) const;
+
+private:
+  NCollection_Vector<PhaseInfo> myPhases;
+  NCollection_Vector<PairInfo>  myPairs; //!< slowest pairs sorted by decreasing time
+  NCollection_Vector<CacheInfo> myCaches;
+  int                           myNbSlowestPairs;
+  mutable std::mutex            myMutex;
+};
+
+#endif // _BOPAlgo_Statistics_HeaderFile
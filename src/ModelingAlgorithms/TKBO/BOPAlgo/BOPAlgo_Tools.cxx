@@ -1181,6 +1181,131 @@ void BOPAlgo_Tools::IntersectVertices(
   }
 }
 
+//=================================================================================================
+
+void BOPAlgo_Tools::ClusterArguments(const NCollection_List<TopoDS_Shape>& theArguments,
+                                     const double                          theFuzzyValue,
+                                     NCollection_List<NCollection_List<TopoDS_Shape>>& theClusters)
+{
+  // Split the arguments on parts
+  NCollection_Vector<TopoDS_Shape> aParts;
+  NCollection_Vector<int>          anArgOfPart;
+  NCollection_Vector<TopoDS_Shape> anArgs;
+  for (NCollection_List<TopoDS_Shape>::Iterator itA(theArguments); itA.More(); itA.Next())
+  {
+    NCollection_List<TopoDS_Shape> aLP;
+    BOPTools_AlgoTools::TreatCompound(itA.Value(), aLP);
+    for (NCollection_List<TopoDS_Shape>::Iterator itP(aLP); itP.More(); itP.Next())
+    {
+      aParts.Append(itP.Value());
+      anArgOfPart.Append(anArgs.Length());
+    }
+    anArgs.Append(itA.Value());
+  }
+
+  const int aNbP = aParts.Length();
+  if (aNbP == 0)
+  {
+    return;
+  }
+
+  // Use BVH Tree for sorting the parts
+  const double     aTolAdd = theFuzzyValue / 2. + Precision::Confusion();
+  BOPTools_BoxTree aBBTree;
+  aBBTree.SetSize(aNbP);
+  for (int i = 0; i < aNbP; ++i)
+  {
+    Bnd_Box aBox;
+    BRepBndLib::Add(aParts(i), aBox);
+    if (!aBox.IsVoid())
+    {
+      aBox.Enlarge(aTolAdd);
+      aBBTree.Add(i, Bnd_Tools::Bnd2BVH(aBox));
+    }
+  }
+  aBBTree.Build();
+
+  // Perform selection of the interfering parts
+  BOPTools_BoxPairSelector aPairSelector;
+  aPairSelector.SetBVHSets(&aBBTree, &aBBTree);
+  aPairSelector.SetSame(true);
+  aPairSelector.Select();
+
+  occ::handle<NCollection_IncAllocator>                  anAlloc = new NCollection_IncAllocator;
+  NCollection_IndexedDataMap<int, NCollection_List<int>> aMILI(1, anAlloc);
+  const std::vector<BOPTools_BoxPairSelector::PairIDs>&  aPairs = aPairSelector.Pairs();
+  for (size_t iPair = 0; iPair < aPairs.size(); ++iPair)
+  {
+    BOPAlgo_Tools::FillMap(aPairs[iPair].ID1, aPairs[iPair].ID2, aMILI, anAlloc);
+  }
+
+  NCollection_List<NCollection_List<int>> aBlocks(anAlloc);
+  BOPAlgo_Tools::MakeBlocks(aMILI, aBlocks, anAlloc);
+
+  // Number the clusters, the not interfered parts make the clusters of their own
+  NCollection_Array1<int> aClusterOfPart(0, aNbP - 1);
+  aClusterOfPart.Init(-1);
+  int aNbC = 0;
+  for (NCollection_List<NCollection_List<int>>::Iterator itB(aBlocks); itB.More(); itB.Next())
+  {
+    for (NCollection_List<int>::Iterator itI(itB.Value()); itI.More(); itI.Next())
+    {
+      aClusterOfPart(itI.Value()) = aNbC;
+    }
+    ++aNbC;
+  }
+  for (int i = 0; i < aNbP; ++i)
+  {
+    if (aClusterOfPart(i) < 0)
+    {
+      aClusterOfPart(i) = aNbC++;
+    }
+  }
+
+  // Collect the arguments of the clusters in the order of the parts
+  NCollection_Array1<NCollection_List<TopoDS_Shape>*> aClusters(0, aNbC - 1);
+  aClusters.Init(nullptr);
+  for (int i = 0; i < aNbP;)
+  {
+    // distribute the parts of the argument among the clusters
+    const int                                                       iArg = anArgOfPart(i);
+    NCollection_IndexedDataMap<int, NCollection_List<TopoDS_Shape>> aMCParts;
+    for (; i < aNbP && anArgOfPart(i) == iArg; ++i)
+    {
+      NCollection_List<TopoDS_Shape>* pLP = aMCParts.ChangeSeek(aClusterOfPart(i));
+      if (!pLP)
+      {
+        pLP = &aMCParts(aMCParts.Add(aClusterOfPart(i), NCollection_List<TopoDS_Shape>()));
+      }
+      pLP->Append(aParts(i));
+    }
+
+    for (int iC = 1; iC <= aMCParts.Extent(); ++iC)
+    {
+      NCollection_List<TopoDS_Shape>*& pCluster = aClusters(aMCParts.FindKey(iC));
+      if (!pCluster)
+      {
+        pCluster = &theClusters.Append(NCollection_List<TopoDS_Shape>());
+      }
+
+      if (aMCParts.Extent() == 1)
+      {
+        pCluster->Append(anArgs(iArg));
+        continue;
+      }
+
+      TopoDS_Compound aC;
+      BRep_Builder    aBB;
+      aBB.MakeCompound(aC);
+      for (NCollection_List<TopoDS_Shape>::Iterator itP(aMCParts(iC)); itP.More(); itP.Next())
+      {
+        aBB.Add(aC, itP.Value());
+      }
+      pCluster->Append(aC);
+    }
+  }
+}
+
 //=======================================================================
 // Classification of the faces relatively solids
 //=======================================================================
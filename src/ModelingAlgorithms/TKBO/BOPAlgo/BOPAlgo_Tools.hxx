@@ -177,6 +177,21 @@ public:
     const double                                                                     theFuzzyValue,
     NCollection_List<NCollection_List<TopoDS_Shape>>&                                theChains);
 
+  //! Splits the arguments of the General Fuse operation into the clusters,
+  //! i.e. connected groups of the shapes with interfering bounding boxes,
+  //! so that the clusters can be processed independently of each other.
+  //! The compound arguments are split on their non-compound parts. The parts of the argument
+  //! falling into the same cluster are combined into the compound, so that they are not
+  //! intersected with each other, the argument falling entirely into one cluster is kept as is.
+  //! The clusters are ordered by the first argument contained in them.
+  //! @param[in]  theArguments  the arguments of the operation
+  //! @param[in]  theFuzzyValue additional tolerance of the operation
+  //! @param[out] theClusters   the arguments of the clusters
+  Standard_EXPORT static void ClusterArguments(
+    const NCollection_List<TopoDS_Shape>&             theArguments,
+    const double                                      theFuzzyValue,
+    NCollection_List<NCollection_List<TopoDS_Shape>>& theClusters);
+
   //! Classifies the faces <theFaces> relatively solids <theSolids>.
   //! The IN faces for solids are stored into output data map <theInParts>.
   //!
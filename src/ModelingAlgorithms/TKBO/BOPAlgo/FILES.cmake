@@ -67,6 +67,8 @@ set(OCCT_BOPAlgo_FILES
   BOPAlgo_SectionAttribute.hxx
   BOPAlgo_ShellSplitter.cxx
   BOPAlgo_ShellSplitter.hxx
+  BOPAlgo_Statistics.cxx
+  BOPAlgo_Statistics.hxx
   BOPAlgo_Tools.cxx
   BOPAlgo_Tools.hxx
   BOPAlgo_WireEdgeSet.hxx
@@ -50,7 +50,8 @@ class BOPTools_Parallel
     TypeSolverVector& mySolvers;
   };
 
-  //! Functor storing map of thread id -> algorithm context
+  //! Functor storing map of thread id -> algorithm context.
+  //! The contexts created for the threads use the shared cache of the main thread context.
   template <class TypeSolverVector, class TypeContext>
   class ContextFunctor
   {
@@ -65,6 +66,7 @@ class BOPTools_Parallel
     void SetContext(const opencascade::handle<TypeContext>& theContext)
     {
       myContextMap.Bind(OSD_Thread::Current(), theContext);
+      myMainContext = theContext;
     }
 
     //! Returns current thread context
@@ -82,6 +84,10 @@ class BOPTools_Parallel
       // Create new context
       opencascade::handle<TypeContext> aContext =
         new TypeContext(NCollection_BaseAllocator::CommonBaseAllocator());
+      if (!myMainContext.IsNull())
+      {
+        aContext->SetSharedCache(myMainContext->SharedCache());
+      }
 
       std::lock_guard<std::mutex> aLock(myMutex);
       myContextMap.Bind(aThreadID, aContext);
@@ -105,10 +111,12 @@ class BOPTools_Parallel
   private:
     TypeSolverVector&                                                                mySolverVector;
     mutable NCollection_DataMap<Standard_ThreadId, opencascade::handle<TypeContext>> myContextMap;
+    opencascade::handle<TypeContext>                                                 myMainContext;
     mutable std::mutex                                                               myMutex;
   };
 
-  //! Functor storing array of algorithm contexts per thread in pool
+  //! Functor storing array of algorithm contexts per thread in pool.
+  //! The contexts created for the threads use the shared cache of the main thread context.
   template <class TypeSolverVector, class TypeContext>
   class ContextFunctor2
   {
@@ -136,6 +144,11 @@ class BOPTools_Parallel
       if (aContext.IsNull())
       {
         aContext = new TypeContext(NCollection_BaseAllocator::CommonBaseAllocator());
+        const opencascade::handle<TypeContext>& aMainContext = myContextArray.Last();
+        if (!aMainContext.IsNull())
+        {
+          aContext->SetSharedCache(aMainContext->SharedCache());
+        }
       }
       typename TypeSolverVector::value_type& aSolver = mySolverVector[theIndex];
       aSolver.SetContext(aContext);
@@ -51,7 +51,9 @@ public:
   using BOPAlgo_Options::RunParallel;
   using BOPAlgo_Options::SetFuzzyValue;
   using BOPAlgo_Options::SetRunParallel;
+  using BOPAlgo_Options::SetStatistics;
   using BOPAlgo_Options::SetUseOBB;
+  using BOPAlgo_Options::Statistics;
 
 protected:
   //! Empty constructor
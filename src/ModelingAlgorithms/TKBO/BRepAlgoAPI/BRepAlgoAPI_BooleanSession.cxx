@@ -0,0 +1,224 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRepAlgoAPI_BooleanSession.hxx>
+
+#include <BOPAlgo_Alerts.hxx>
+#include <BOPAlgo_PaveFiller.hxx>
+#include <BRep_Builder.hxx>
+#include <BRepAlgoAPI_BooleanOperation.hxx>
+#include <BRepBndLib.hxx>
+#include <Message_ProgressScope.hxx>
+#include <Precision.hxx>
+#include <TopoDS_Compound.hxx>
+#include <TopoDS_Iterator.hxx>
+
+namespace
+{
+//! Adds the parts of the shape into the list, exploding the compounds.
+static void addParts(const TopoDS_Shape& theShape, NCollection_List<TopoDS_Shape>& theParts)
+{
+  if (theShape.ShapeType() != TopAbs_COMPOUND)
+  {
+    theParts.Append(theShape);
+    return;
+  }
+  for (TopoDS_Iterator anIt(theShape); anIt.More(); anIt.Next())
+  {
+    addParts(anIt.Value(), theParts);
+  }
+}
+} // namespace
+
+//=================================================================================================
+
+BRepAlgoAPI_BooleanSession::BRepAlgoAPI_BooleanSession()
+    : myContext(new IntTools_Context()),
+      myNbOperations(0),
+      myNbSkipped(0)
+{
+}
+
+//=================================================================================================
+
+BRepAlgoAPI_BooleanSession::BRepAlgoAPI_BooleanSession(const TopoDS_Shape& theShape)
+    : myNbOperations(0),
+      myNbSkipped(0)
+{
+  SetShape(theShape);
+}
+
+//=================================================================================================
+
+BRepAlgoAPI_BooleanSession::~BRepAlgoAPI_BooleanSession() = default;
+
+//=================================================================================================
+
+void BRepAlgoAPI_BooleanSession::SetShape(const TopoDS_Shape& theShape)
+{
+  Clear();
+  myParts.Clear();
+  myPartBoxes.Clear();
+  myHistory.Nullify();
+  myContext      = new IntTools_Context();
+  myNbOperations = 0;
+  myNbSkipped    = 0;
+
+  NCollection_List<TopoDS_Shape> aParts;
+  if (!theShape.IsNull())
+  {
+    addParts(theShape, aParts);
+  }
+  UpdateShape(aParts);
+}
+
+//=================================================================================================
+
+const Bnd_Box& BRepAlgoAPI_BooleanSession::PartBox(const TopoDS_Shape& thePart)
+{
+  if (const Bnd_Box* aBox = myPartBoxes.Seek(thePart))
+  {
+    return *aBox;
+  }
+  Bnd_Box aBox;
+  BRepBndLib::Add(thePart, aBox);
+  aBox.Enlarge(myFuzzyValue + Precision::Confusion());
+  return *myPartBoxes.Bound(thePart, aBox);
+}
+
+//=================================================================================================
+
+void BRepAlgoAPI_BooleanSession::UpdateShape(const NCollection_List<TopoDS_Shape>& theParts)
+{
+  // release the boxes of the parts removed from the stock
+  NCollection_DataMap<TopoDS_Shape, Bnd_Box, TopTools_ShapeMapHasher> aPartBoxes;
+  for (NCollection_List<TopoDS_Shape>::Iterator aPartIt(theParts); aPartIt.More(); aPartIt.Next())
+  {
+    if (const Bnd_Box* aBox = myPartBoxes.Seek(aPartIt.Value()))
+    {
+      aPartBoxes.Bind(aPartIt.Value(), *aBox);
+    }
+  }
+  myPartBoxes.Exchange(aPartBoxes);
+  myParts = theParts;
+
+  BRep_Builder    aBuilder;
+  TopoDS_Compound aStock;
+  aBuilder.MakeCompound(aStock);
+  for (NCollection_List<TopoDS_Shape>::Iterator aPartIt(myParts); aPartIt.More(); aPartIt.Next())
+  {
+    aBuilder.Add(aStock, aPartIt.Value());
+  }
+  myShape = aStock;
+
+  // keep the cached data of the sub-shapes shared with the new stock only
+  myContext->Retain(myShape);
+}
+
+//=================================================================================================
+
+void BRepAlgoAPI_BooleanSession::Perform(const TopoDS_Shape&          theTool,
+                                         const BOPAlgo_Operation      theOperation,
+                                         const Message_ProgressRange& theRange)
+{
+  Clear();
+  myHistory.Nullify();
+  if (theTool.IsNull()
+      || (theOperation != BOPAlgo_FUSE && theOperation != BOPAlgo_COMMON
+          && theOperation != BOPAlgo_CUT))
+  {
+    AddError(new BOPAlgo_AlertBOPNotAllowed());
+    return;
+  }
+
+  Message_ProgressScope aPS(theRange, "Performing Boolean operation", 10);
+
+  // select the parts of the stock in the neighbourhood of the tool
+  Bnd_Box aToolBox;
+  BRepBndLib::Add(theTool, aToolBox);
+  aToolBox.Enlarge(myFuzzyValue + Precision::Confusion());
+
+  NCollection_List<TopoDS_Shape> aTouched, anUntouched;
+  for (NCollection_List<TopoDS_Shape>::Iterator aPartIt(myParts); aPartIt.More(); aPartIt.Next())
+  {
+    const TopoDS_Shape& aPart = aPartIt.Value();
+    (PartBox(aPart).IsOut(aToolBox) ? anUntouched : aTouched).Append(aPart);
+  }
+
+  if (aTouched.IsEmpty())
+  {
+    // nothing to intersect, define the result directly
+    if (theOperation == BOPAlgo_CUT)
+    {
+      ++myNbSkipped;
+    }
+    else if (theOperation == BOPAlgo_FUSE)
+    {
+      anUntouched.Append(theTool);
+      UpdateShape(anUntouched);
+    }
+    else
+    {
+      UpdateShape(NCollection_List<TopoDS_Shape>());
+    }
+    ++myNbOperations;
+    return;
+  }
+
+  NCollection_List<TopoDS_Shape> aTools;
+  aTools.Append(theTool);
+
+  NCollection_List<TopoDS_Shape> anArgs = aTouched;
+  anArgs.Append(theTool);
+
+  // intersect the touched parts with the tool reusing the context of the stock
+  BOPAlgo_PaveFiller aPF;
+  aPF.SetArguments(anArgs);
+  aPF.SetRunParallel(myRunParallel);
+  aPF.SetFuzzyValue(myFuzzyValue);
+  aPF.SetUseOBB(myUseOBB);
+  aPF.SetStatistics(myStatistics);
+  aPF.SetNonDestructive(true);
+  aPF.SetContext(myContext);
+  aPF.Perform(aPS.Next(9));
+  if (aPF.HasErrors())
+  {
+    myReport->Merge(aPF.GetReport());
+    return;
+  }
+
+  BRepAlgoAPI_BooleanOperation aBOP(aPF);
+  aBOP.SetArguments(aTouched);
+  aBOP.SetTools(aTools);
+  aBOP.SetOperation(theOperation);
+  aBOP.SetRunParallel(myRunParallel);
+  aBOP.SetStatistics(myStatistics);
+  aBOP.SetNonDestructive(true);
+  aBOP.Build(aPS.Next(1));
+  myReport->Merge(aBOP.GetReport());
+  if (aBOP.HasErrors())
+  {
+    return;
+  }
+
+  NCollection_List<TopoDS_Shape> aParts;
+  if (theOperation != BOPAlgo_COMMON)
+  {
+    aParts.Append(anUntouched);
+  }
+  addParts(aBOP.Shape(), aParts);
+  UpdateShape(aParts);
+
+  myHistory = aBOP.History();
+  ++myNbOperations;
+}
@@ -0,0 +1,143 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BRepAlgoAPI_BooleanSession_HeaderFile
+#define _BRepAlgoAPI_BooleanSession_HeaderFile
+
+#include <Standard.hxx>
+#include <Standard_DefineAlloc.hxx>
+#include <Standard_Handle.hxx>
+
+#include <BOPAlgo_Operation.hxx>
+#include <BOPAlgo_Options.hxx>
+#include <Bnd_Box.hxx>
+#include <BRepTools_History.hxx>
+#include <IntTools_Context.hxx>
+#include <Message_ProgressRange.hxx>
+#include <NCollection_DataMap.hxx>
+#include <NCollection_List.hxx>
+#include <TopTools_ShapeMapHasher.hxx>
+#include <TopoDS_Shape.hxx>
+
+//! The class performs the sequence of Boolean operations of the single growing shape
+//! (*stock*) with many tools, e.g. subtraction of the tool sweeps in machining simulation.
+//!
+//! The stock is kept as a list of parts (the sub-shapes of the stock compound).
+//! Each operation involves only the parts which bounding boxes interfere with
+//! the bounding box of the tool, the other parts are passed into result as is.
+//! The intersection context (classifiers, projectors, bounding boxes of sub-shapes)
+//! and the bounding boxes of the parts are kept between operations, so that the data
+//! computed for the untouched parts and sub-shapes of the stock is reused.
+//! The operations are performed in non-destructive mode, thus the sub-shapes of the
+//! stock not modified by the tool are shared by the new stock together with their caches.
+//!
+//! The options of the base class are passed to each operation.
+//!
+//! <b>Example</b>
+//! ~~~~
+//! BRepAlgoAPI_BooleanSession aSession(aStock);
+//! for (NCollection_List<TopoDS_Shape>::Iterator aToolIt(aTools); aToolIt.More(); aToolIt.Next())
+//! {
+//!   aSession.Cut(aToolIt.Value());
+//!   if (aSession.HasErrors())
+//!   {
+//!     // the stock stays unchanged
+//!   }
+//! }
+//! const TopoDS_Shape& aResult = aSession.Shape();
+//! ~~~~
+class BRepAlgoAPI_BooleanSession : public BOPAlgo_Options
+{
+public:
+  DEFINE_STANDARD_ALLOC
+
+  //! Empty constructor
+  Standard_EXPORT BRepAlgoAPI_BooleanSession();
+
+  //! Constructor with the initial stock
+  Standard_EXPORT explicit BRepAlgoAPI_BooleanSession(const TopoDS_Shape& theShape);
+
+  //! Destructor
+  Standard_EXPORT ~BRepAlgoAPI_BooleanSession() override;
+
+public: //! @name Setting/getting the stock
+  //! Sets the initial stock, releasing all data of the previous operations.
+  Standard_EXPORT void SetShape(const TopoDS_Shape& theShape);
+
+  //! Returns the current stock (compound of parts).
+  const TopoDS_Shape& Shape() const { return myShape; }
+
+public: //! @name Performing operations
+  //! Performs the Boolean operation of the stock with the tool and updates the stock.
+  //! In case of failure the errors are reported and the stock is not changed.
+  //! @param[in] theTool      tool shape
+  //! @param[in] theOperation type of operation (FUSE, COMMON, CUT)
+  //! @param[in] theRange     progress range
+  Standard_EXPORT void Perform(const TopoDS_Shape&          theTool,
+                               const BOPAlgo_Operation      theOperation,
+                               const Message_ProgressRange& theRange = Message_ProgressRange());
+
+  //! Subtracts the tool from the stock.
+  void Cut(const TopoDS_Shape&          theTool,
+           const Message_ProgressRange& theRange = Message_ProgressRange())
+  {
+    Perform(theTool, BOPAlgo_CUT, theRange);
+  }
+
+  //! Fuses the tool with the stock.
+  void Fuse(const TopoDS_Shape&          theTool,
+            const Message_ProgressRange& theRange = Message_ProgressRange())
+  {
+    Perform(theTool, BOPAlgo_FUSE, theRange);
+  }
+
+  //! Keeps the common part of the stock and the tool.
+  void Common(const TopoDS_Shape&          theTool,
+              const Message_ProgressRange& theRange = Message_ProgressRange())
+  {
+    Perform(theTool, BOPAlgo_COMMON, theRange);
+  }
+
+public: //! @name Obtaining results
+  //! Returns the history of the last operation; NULL if the last operation
+  //! has not involved any part of the stock or has failed.
+  const occ::handle<BRepTools_History>& History() const { return myHistory; }
+
+  //! Returns the intersection context shared by the operations.
+  const occ::handle<IntTools_Context>& Context() const { return myContext; }
+
+  //! Returns the number of successfully performed operations.
+  int NbOperations() const { return myNbOperations; }
+
+  //! Returns the number of operations which have not involved any part of the stock.
+  int NbSkipped() const { return myNbSkipped; }
+
+protected:
+  //! Returns the bounding box of the stock part, computing it on first request.
+  Standard_EXPORT const Bnd_Box& PartBox(const TopoDS_Shape& thePart);
+
+  //! Rebuilds the stock compound from the given parts.
+  Standard_EXPORT void UpdateShape(const NCollection_List<TopoDS_Shape>& theParts);
+
+protected:
+  TopoDS_Shape                   myShape;   //!< Current stock
+  NCollection_List<TopoDS_Shape> myParts;   //!< Parts of the stock
+  occ::handle<IntTools_Context>  myContext; //!< Context shared by the operations
+  NCollection_DataMap<TopoDS_Shape, Bnd_Box, TopTools_ShapeMapHasher>
+                                 myPartBoxes;    //!< Bounding boxes of the parts
+  occ::handle<BRepTools_History> myHistory;      //!< History of the last operation
+  int                            myNbOperations; //!< Number of performed operations
+  int                            myNbSkipped;    //!< Number of skipped operations
+};
+
+#endif // _BRepAlgoAPI_BooleanSession_HeaderFile
@@ -121,6 +121,7 @@ void BRepAlgoAPI_BuilderAlgo::IntersectShapes(const NCollection_List<TopoDS_Shap
   myDSFiller->SetNonDestructive(myNonDestructive);
   myDSFiller->SetGlue(myGlue);
   myDSFiller->SetUseOBB(myUseOBB);
+  myDSFiller->SetStatistics(myStatistics);
   // Set Face/Face intersection options to the intersection algorithm
   SetAttributes();
   // Perform intersection
@@ -140,6 +141,7 @@ void BRepAlgoAPI_BuilderAlgo::BuildResult(const Message_ProgressRange& theRange)
 
   myBuilder->SetCheckInverted(myCheckInverted);
   myBuilder->SetToFillHistory(myFillHistory);
+  myBuilder->SetStatistics(myStatistics);
   // Perform building of the result with pre-calculated intersections
   myBuilder->PerformWithFiller(*myDSFiller, theRange);
   // Merge the warnings of the Building part
@@ -6,6 +6,8 @@ set(OCCT_BRepAlgoAPI_FILES
   BRepAlgoAPI_Algo.hxx
   BRepAlgoAPI_BooleanOperation.cxx
   BRepAlgoAPI_BooleanOperation.hxx
+  BRepAlgoAPI_BooleanSession.cxx
+  BRepAlgoAPI_BooleanSession.hxx
   BRepAlgoAPI_BuilderAlgo.cxx
   BRepAlgoAPI_BuilderAlgo.hxx
   BRepAlgoAPI_Check.cxx
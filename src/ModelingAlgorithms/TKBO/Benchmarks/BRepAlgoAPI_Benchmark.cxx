@@ -0,0 +1,98 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <BRepAlgoAPI_BooleanOperation.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <BRepPrimAPI_MakeSphere.hxx>
+#include <BRepPrimAPI_MakeTorus.hxx>
+#include <NCollection_List.hxx>
+#include <TopoDS_Shape.hxx>
+#include <gp_Ax2.hxx>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+//! Makes the reference pair of the given kind: the object and the tool.
+void makePair(const int theKind, TopoDS_Shape& theObject, TopoDS_Shape& theTool)
+{
+  switch (theKind)
+  {
+    case 0: {
+      theObject = BRepPrimAPI_MakeBox(gp_Pnt(-10.0, -10.0, -10.0), 20.0, 20.0, 20.0).Shape();
+      theTool   = BRepPrimAPI_MakeSphere(gp_Pnt(10.0, 10.0, 10.0), 8.0).Shape();
+      break;
+    }
+    case 1: {
+      theObject = BRepPrimAPI_MakeCylinder(gp_Ax2(gp_Pnt(0.0, 0.0, -20.0), gp::DZ()), 10.0, 40.0)
+                    .Shape();
+      theTool = BRepPrimAPI_MakeCylinder(gp_Ax2(gp_Pnt(-20.0, 0.0, 0.0), gp::DX()), 8.0, 40.0)
+                  .Shape();
+      break;
+    }
+    default: {
+      theObject = BRepPrimAPI_MakeTorus(20.0, 5.0).Shape();
+      theTool   = BRepPrimAPI_MakeSphere(gp_Pnt(20.0, 0.0, 0.0), 6.0).Shape();
+      break;
+    }
+  }
+}
+
+//! Runs the Boolean operation on the reference pair.
+void runBoolean(benchmark::State& theState, const BOPAlgo_Operation theOperation)
+{
+  TopoDS_Shape anObject, aTool;
+  makePair(int(theState.range(0)), anObject, aTool);
+  NCollection_List<TopoDS_Shape> anObjects, aTools;
+  anObjects.Append(anObject);
+  aTools.Append(aTool);
+  for (auto _ : theState)
+  {
+    BRepAlgoAPI_BooleanOperation anOperation;
+    anOperation.SetOperation(theOperation);
+    anOperation.SetArguments(anObjects);
+    anOperation.SetTools(aTools);
+    anOperation.SetRunParallel(theState.range(1) != 0);
+    anOperation.Build();
+    if (anOperation.HasErrors())
+    {
+      theState.SkipWithError("Boolean operation has failed");
+      break;
+    }
+    benchmark::DoNotOptimize(anOperation.Shape());
+  }
+}
+} // namespace
+
+// Arguments: reference pair (0 - box and sphere, 1 - crossing cylinders, 2 - torus and sphere),
+// flag to run in parallel threads.
+
+static void BRepAlgoAPI_Fuse_Pair(benchmark::State& theState)
+{
+  runBoolean(theState, BOPAlgo_FUSE);
+}
+BENCHMARK(BRepAlgoAPI_Fuse_Pair)->ArgsProduct({{0, 1, 2}, {0, 1}})->Unit(benchmark::kMillisecond);
+
+static void BRepAlgoAPI_Cut_Pair(benchmark::State& theState)
+{
+  runBoolean(theState, BOPAlgo_CUT);
+}
+BENCHMARK(BRepAlgoAPI_Cut_Pair)->ArgsProduct({{0, 1, 2}, {0, 1}})->Unit(benchmark::kMillisecond);
+
+static void BRepAlgoAPI_Common_Pair(benchmark::State& theState)
+{
+  runBoolean(theState, BOPAlgo_COMMON);
+}
+BENCHMARK(BRepAlgoAPI_Common_Pair)->ArgsProduct({{0, 1, 2}, {0, 1}})->Unit(benchmark::kMillisecond);
@@ -0,0 +1,6 @@
+# Benchmark source files for TKBO
+set(OCCT_TKBO_Benchmarks_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
+
+set(OCCT_TKBO_Benchmarks_FILES
+  BRepAlgoAPI_Benchmark.cxx
+)
@@ -0,0 +1,179 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include "BOPTest_Utilities.pxx"
+
+#include <BOPAlgo_CellsBuilder.hxx>
+#include <BOPAlgo_MakerVolume.hxx>
+#include <BOPAlgo_Tools.hxx>
+#include <BRep_Builder.hxx>
+#include <TopoDS_Compound.hxx>
+
+namespace
+{
+//! Creates the box with the size 10 at the given corner.
+TopoDS_Shape createBox(const double theX, const double theY, const double theZ)
+{
+  return BOPTest_Utilities::CreateBox(gp_Pnt(theX, theY, theZ), 10.0, 10.0, 10.0);
+}
+
+//! Returns the number of sub-shapes of given type.
+int nbShapes(const TopoDS_Shape& theShape, const TopAbs_ShapeEnum theType)
+{
+  int aNb = 0;
+  for (TopExp_Explorer anExp(theShape, theType); anExp.More(); anExp.Next())
+  {
+    ++aNb;
+  }
+  return aNb;
+}
+
+//! Creates two groups of overlapping boxes located far from each other.
+NCollection_List<TopoDS_Shape> createTwoGroups()
+{
+  NCollection_List<TopoDS_Shape> aShapes;
+  for (int aGroup = 0; aGroup < 2; ++aGroup)
+  {
+    const double aX = aGroup * 100.0;
+    aShapes.Append(createBox(aX, 0.0, 0.0));
+    aShapes.Append(createBox(aX + 5.0, 5.0, 5.0));
+  }
+  return aShapes;
+}
+} // namespace
+
+TEST(BOPAlgo_ClusterModeTest, ClusterArguments)
+{
+  const TopoDS_Shape aBox1 = createBox(0.0, 0.0, 0.0);
+  const TopoDS_Shape aBox2 = createBox(5.0, 5.0, 5.0);
+  const TopoDS_Shape aBox3 = createBox(100.0, 0.0, 0.0);
+  const TopoDS_Shape aBox4 = createBox(105.0, 5.0, 5.0);
+  const TopoDS_Shape aBox5 = createBox(200.0, 0.0, 0.0);
+
+  // the compound argument falls into two clusters
+  TopoDS_Compound aCompound;
+  BRep_Builder    aBB;
+  aBB.MakeCompound(aCompound);
+  aBB.Add(aCompound, aBox2);
+  aBB.Add(aCompound, aBox4);
+
+  NCollection_List<TopoDS_Shape> anArgs;
+  anArgs.Append(aBox1);
+  anArgs.Append(aCompound);
+  anArgs.Append(aBox3);
+  anArgs.Append(aBox5);
+
+  NCollection_List<NCollection_List<TopoDS_Shape>> aClusters;
+  BOPAlgo_Tools::ClusterArguments(anArgs, 0.0, aClusters);
+  ASSERT_EQ(3, aClusters.Extent());
+
+  NCollection_List<NCollection_List<TopoDS_Shape>>::Iterator anIt(aClusters);
+  const NCollection_List<TopoDS_Shape>&                      aCluster1 = anIt.Value();
+  ASSERT_EQ(2, aCluster1.Extent());
+  EXPECT_TRUE(aCluster1.First().IsSame(aBox1));
+  EXPECT_EQ(TopAbs_COMPOUND, aCluster1.Last().ShapeType());
+  EXPECT_EQ(1, nbShapes(aCluster1.Last(), TopAbs_SOLID));
+
+  anIt.Next();
+  const NCollection_List<TopoDS_Shape>& aCluster2 = anIt.Value();
+  ASSERT_EQ(2, aCluster2.Extent());
+  EXPECT_EQ(TopAbs_COMPOUND, aCluster2.First().ShapeType());
+  EXPECT_TRUE(aCluster2.Last().IsSame(aBox3));
+
+  anIt.Next();
+  ASSERT_EQ(1, anIt.Value().Extent());
+  EXPECT_TRUE(anIt.Value().First().IsSame(aBox5));
+}
+
+TEST(BOPAlgo_ClusterModeTest, MakerVolumeSameResult)
+{
+  const NCollection_List<TopoDS_Shape> anArgs = createTwoGroups();
+
+  BOPAlgo_MakerVolume aMVAll;
+  aMVAll.SetArguments(anArgs);
+  aMVAll.Perform();
+  ASSERT_FALSE(aMVAll.HasErrors());
+
+  BOPAlgo_MakerVolume aMVClusters;
+  aMVClusters.SetArguments(anArgs);
+  aMVClusters.SetClusterMode(true);
+  aMVClusters.Perform();
+  ASSERT_FALSE(aMVClusters.HasErrors());
+  EXPECT_TRUE(aMVClusters.PDS() == nullptr);
+
+  EXPECT_EQ(6, nbShapes(aMVClusters.Shape(), TopAbs_SOLID));
+  EXPECT_EQ(nbShapes(aMVAll.Shape(), TopAbs_SOLID), nbShapes(aMVClusters.Shape(), TopAbs_SOLID));
+  EXPECT_NEAR(BOPTest_Utilities::GetVolume(aMVAll.Shape()),
+              BOPTest_Utilities::GetVolume(aMVClusters.Shape()),
+              1.0e-6);
+
+  // the faces of the arguments are split in both groups
+  for (NCollection_List<TopoDS_Shape>::Iterator anIt(anArgs); anIt.More(); anIt.Next())
+  {
+    int aNbModified = 0;
+    for (TopExp_Explorer anExp(anIt.Value(), TopAbs_FACE); anExp.More(); anExp.Next())
+    {
+      aNbModified += aMVClusters.Modified(anExp.Current()).Extent();
+    }
+    EXPECT_GT(aNbModified, 0);
+  }
+}
+
+TEST(BOPAlgo_ClusterModeTest, CellsBuilderSameParts)
+{
+  const NCollection_List<TopoDS_Shape> anArgs = createTwoGroups();
+
+  BOPAlgo_CellsBuilder aCBAll;
+  aCBAll.SetArguments(anArgs);
+  aCBAll.Perform();
+  ASSERT_FALSE(aCBAll.HasErrors());
+
+  BOPAlgo_CellsBuilder aCBClusters;
+  aCBClusters.SetArguments(anArgs);
+  aCBClusters.SetClusterMode(true);
+  aCBClusters.Perform();
+  ASSERT_FALSE(aCBClusters.HasErrors());
+
+  EXPECT_EQ(6, nbShapes(aCBClusters.GetAllParts(), TopAbs_SOLID));
+  EXPECT_EQ(nbShapes(aCBAll.GetAllParts(), TopAbs_SOLID),
+            nbShapes(aCBClusters.GetAllParts(), TopAbs_SOLID));
+
+  // take the common parts of the boxes of each group
+  NCollection_List<TopoDS_Shape>::Iterator anIt(anArgs);
+  for (int aGroup = 0; aGroup < 2; ++aGroup)
+  {
+    NCollection_List<TopoDS_Shape> aLSToTake, aLSToAvoid;
+    aLSToTake.Append(anIt.Value());
+    anIt.Next();
+    aLSToTake.Append(anIt.Value());
+    anIt.Next();
+    aCBAll.AddToResult(aLSToTake, aLSToAvoid);
+    aCBClusters.AddToResult(aLSToTake, aLSToAvoid);
+  }
+  EXPECT_EQ(2, nbShapes(aCBClusters.Shape(), TopAbs_SOLID));
+  EXPECT_NEAR(250.0, BOPTest_Utilities::GetVolume(aCBClusters.Shape()), 1.0e-6);
+
+  // the history is the same as for the processing of all arguments
+  EXPECT_TRUE(aCBClusters.HasGenerated());
+  for (NCollection_List<TopoDS_Shape>::Iterator anArgIt(anArgs); anArgIt.More(); anArgIt.Next())
+  {
+    EXPECT_FALSE(aCBClusters.IsDeleted(anArgIt.Value()));
+    for (TopExp_Explorer anExp(anArgIt.Value(), TopAbs_FACE); anExp.More(); anExp.Next())
+    {
+      const TopoDS_Shape& aFace = anExp.Current();
+      EXPECT_EQ(aCBAll.Modified(aFace).Extent(), aCBClusters.Modified(aFace).Extent());
+      EXPECT_EQ(aCBAll.Generated(aFace).Extent(), aCBClusters.Generated(aFace).Extent());
+      EXPECT_EQ(aCBAll.IsDeleted(aFace), aCBClusters.IsDeleted(aFace));
+    }
+  }
+}
@@ -0,0 +1,81 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include "BOPTest_Utilities.pxx"
+
+#include <BRepAdaptor_Surface.hxx>
+#include <BRepAlgoAPI_Defeaturing.hxx>
+#include <BRepCheck_Analyzer.hxx>
+
+namespace
+{
+//! Creates the bar 100x20x20 with two vertical holes sharing the top and bottom faces
+//! and one horizontal hole passing through the front and back faces.
+TopoDS_Shape createBarWithHoles()
+{
+  TopoDS_Shape aBar = BOPTest_Utilities::CreateBox(gp_Pnt(0.0, 0.0, 0.0), 100.0, 20.0, 20.0);
+
+  const gp_Ax2 aHoles[3] = {gp_Ax2(gp_Pnt(20.0, 10.0, -5.0), gp::DZ()),
+                            gp_Ax2(gp_Pnt(50.0, -5.0, 10.0), gp::DY()),
+                            gp_Ax2(gp_Pnt(80.0, 10.0, -5.0), gp::DZ())};
+  for (const gp_Ax2& anAxes : aHoles)
+  {
+    aBar = BRepAlgoAPI_Cut(aBar, BRepPrimAPI_MakeCylinder(anAxes, 3.0, 30.0).Shape()).Shape();
+  }
+  return aBar;
+}
+
+//! Returns the cylindrical faces of the shape.
+NCollection_List<TopoDS_Shape> cylindricalFaces(const TopoDS_Shape& theShape)
+{
+  NCollection_List<TopoDS_Shape> aFaces;
+  for (TopExp_Explorer anExp(theShape, TopAbs_FACE); anExp.More(); anExp.Next())
+  {
+    if (BRepAdaptor_Surface(TopoDS::Face(anExp.Current())).GetType() == GeomAbs_Cylinder)
+    {
+      aFaces.Append(anExp.Current());
+    }
+  }
+  return aFaces;
+}
+} // namespace
+
+TEST(BOPAlgo_RemoveFeaturesTest, RemoveIndependentHoles)
+{
+  const TopoDS_Shape                   aBar   = createBarWithHoles();
+  const NCollection_List<TopoDS_Shape> aHoles = cylindricalFaces(aBar);
+  ASSERT_GE(aHoles.Extent(), 3);
+
+  for (const bool isParallel : {false, true})
+  {
+    BRepAlgoAPI_Defeaturing aDF;
+    aDF.SetShape(aBar);
+    aDF.AddFacesToRemove(aHoles);
+    aDF.SetRunParallel(isParallel);
+    aDF.Build();
+    ASSERT_TRUE(aDF.IsDone());
+    EXPECT_FALSE(aDF.HasWarnings());
+
+    const TopoDS_Shape& aResult = aDF.Shape();
+    EXPECT_TRUE(BRepCheck_Analyzer(aResult).IsValid());
+    EXPECT_TRUE(cylindricalFaces(aResult).IsEmpty());
+    EXPECT_NEAR(100.0 * 20.0 * 20.0, BOPTest_Utilities::GetVolume(aResult), 1.0e-6 * 40000.0);
+
+    // all holes are removed from the history point of view
+    for (NCollection_List<TopoDS_Shape>::Iterator itF(aHoles); itF.More(); itF.Next())
+    {
+      EXPECT_TRUE(aDF.IsDeleted(itF.Value()));
+    }
+  }
+}
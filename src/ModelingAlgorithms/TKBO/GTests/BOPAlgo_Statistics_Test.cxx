@@ -0,0 +1,131 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include "BOPTest_Utilities.pxx"
+
+#include <BOPAlgo_Statistics.hxx>
+
+#include <cstring>
+#include <sstream>
+
+namespace
+{
+//! Find the phase with given name, returns NULL if not found.
+const BOPAlgo_Statistics::PhaseInfo* findPhase(
+  const NCollection_Vector<BOPAlgo_Statistics::PhaseInfo>& thePhases,
+  const char*                                              theName)
+{
+  for (NCollection_Vector<BOPAlgo_Statistics::PhaseInfo>::Iterator anIt(thePhases); anIt.More();
+       anIt.Next())
+  {
+    if (std::strcmp(anIt.Value().Name, theName) == 0)
+    {
+      return &anIt.Value();
+    }
+  }
+  return nullptr;
+}
+} // namespace
+
+TEST(BOPAlgo_StatisticsTest, SlowestPairsSorted)
+{
+  occ::handle<BOPAlgo_Statistics> aStatistics = new BOPAlgo_Statistics(3);
+  const double                    aTimes[]    = {0.2, 0.5, 0.1, 0.4, 0.3};
+  for (int anIter = 0; anIter < 5; ++anIter)
+  {
+    aStatistics->AddPair("FF", anIter, anIter + 1, aTimes[anIter]);
+  }
+
+  const NCollection_Vector<BOPAlgo_Statistics::PairInfo> aPairs = aStatistics->SlowestPairs();
+  ASSERT_EQ(3, aPairs.Length());
+  EXPECT_EQ(1, aPairs(0).Index1);
+  EXPECT_EQ(3, aPairs(1).Index1);
+  EXPECT_EQ(4, aPairs(2).Index1);
+
+  aStatistics->Clear();
+  EXPECT_TRUE(aStatistics->SlowestPairs().IsEmpty());
+  EXPECT_TRUE(aStatistics->Phases().IsEmpty());
+}
+
+TEST(BOPAlgo_StatisticsTest, CollectedForCut)
+{
+  const TopoDS_Shape aBox = BOPTest_Utilities::CreateBox(gp_Pnt(0.0, 0.0, 0.0), 10.0, 10.0, 10.0);
+  const TopoDS_Shape aSphere = BOPTest_Utilities::CreateSphere(gp_Pnt(10.0, 10.0, 10.0), 5.0);
+
+  occ::handle<BOPAlgo_Statistics> aStatistics = new BOPAlgo_Statistics(5);
+  BRepAlgoAPI_Cut                 aCut;
+  NCollection_List<TopoDS_Shape>  anArgs, aTools;
+  anArgs.Append(aBox);
+  aTools.Append(aSphere);
+  aCut.SetArguments(anArgs);
+  aCut.SetTools(aTools);
+  aCut.SetStatistics(aStatistics);
+  aCut.Build();
+  ASSERT_TRUE(aCut.IsDone());
+  EXPECT_EQ(aStatistics, aCut.Statistics());
+
+  const NCollection_Vector<BOPAlgo_Statistics::PhaseInfo> aPhases = aStatistics->Phases();
+  const BOPAlgo_Statistics::PhaseInfo* aPhaseFF = findPhase(aPhases, "PerformFF");
+  ASSERT_NE(nullptr, aPhaseFF);
+  EXPECT_GT(aPhaseFF->NbPairs, 0);
+  EXPECT_GT(aPhaseFF->NbIntersected, 0);
+  EXPECT_LE(aPhaseFF->NbIntersected, aPhaseFF->NbPairs);
+  EXPECT_GE(aPhaseFF->WallTime, 0.0);
+  EXPECT_NE(nullptr, findPhase(aPhases, "BuildSplitFaces"));
+
+  const NCollection_Vector<BOPAlgo_Statistics::PairInfo> aPairs = aStatistics->SlowestPairs();
+  ASSERT_FALSE(aPairs.IsEmpty());
+  EXPECT_LE(aPairs.Length(), 5);
+  for (int anIndex = 1; anIndex < aPairs.Length(); ++anIndex)
+  {
+    EXPECT_GE(aPairs(anIndex - 1).Time, aPairs(anIndex).Time);
+  }
+
+  std::ostringstream aStream;
+  aStatistics->Dump(aStream);
+  EXPECT_NE(std::string::npos, aStream.str().find("PerformFF"));
+}
+
+TEST(BOPAlgo_StatisticsTest, SharedCacheForParallelCut)
+{
+  const TopoDS_Shape aBox = BOPTest_Utilities::CreateBox(gp_Pnt(0.0, 0.0, 0.0), 10.0, 10.0, 10.0);
+  const TopoDS_Shape aSphere = BOPTest_Utilities::CreateSphere(gp_Pnt(10.0, 10.0, 10.0), 5.0);
+  const TopoDS_Shape aSerialCut = BRepAlgoAPI_Cut(aBox, aSphere);
+
+  occ::handle<BOPAlgo_Statistics> aStatistics = new BOPAlgo_Statistics();
+  BRepAlgoAPI_Cut                 aCut;
+  NCollection_List<TopoDS_Shape>  anArgs, aTools;
+  anArgs.Append(aBox);
+  aTools.Append(aSphere);
+  aCut.SetArguments(anArgs);
+  aCut.SetTools(aTools);
+  aCut.SetRunParallel(true);
+  aCut.SetStatistics(aStatistics);
+  aCut.Build();
+  ASSERT_TRUE(aCut.IsDone());
+  EXPECT_NEAR(BOPTest_Utilities::GetVolume(aSerialCut),
+              BOPTest_Utilities::GetVolume(aCut.Shape()),
+              1.0e-6);
+
+  const NCollection_Vector<BOPAlgo_Statistics::CacheInfo> aCaches = aStatistics->Caches();
+  ASSERT_EQ(1, aCaches.Length());
+  EXPECT_STREQ("IntTools_SharedCache", aCaches(0).Name);
+  EXPECT_GT(aCaches(0).NbMisses, 0u);
+
+  std::ostringstream aStream;
+  aStatistics->Dump(aStream);
+  EXPECT_NE(std::string::npos, aStream.str().find("IntTools_SharedCache"));
+
+  aStatistics->Clear();
+  EXPECT_TRUE(aStatistics->Caches().IsEmpty());
+}
@@ -0,0 +1,119 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include "BOPTest_Utilities.pxx"
+
+#include <BRep_Builder.hxx>
+#include <BRepAlgoAPI_BooleanSession.hxx>
+#include <TopoDS_Compound.hxx>
+
+namespace
+{
+//! Create vertical drill at given position of XY plane.
+TopoDS_Shape createDrill(const double theX, const double theY)
+{
+  return BRepPrimAPI_MakeCylinder(gp_Ax2(gp_Pnt(theX, theY, -1.0), gp::DZ()), 0.5, 12.0).Shape();
+}
+
+//! Count solids of the shape.
+int nbSolids(const TopoDS_Shape& theShape)
+{
+  int aNbSolids = 0;
+  for (TopExp_Explorer anExp(theShape, TopAbs_SOLID); anExp.More(); anExp.Next())
+  {
+    ++aNbSolids;
+  }
+  return aNbSolids;
+}
+} // namespace
+
+TEST(BRepAlgoAPI_BooleanSessionTest, SequentialCutsSameAsCut)
+{
+  const TopoDS_Shape aStock = BOPTest_Utilities::CreateBox(gp_Pnt(0.0, 0.0, 0.0), 10.0, 10.0, 10.0);
+
+  BRepAlgoAPI_BooleanSession aSession(aStock);
+  TopoDS_Shape               aRefShape = aStock;
+  for (int aDrillIter = 0; aDrillIter < 4; ++aDrillIter)
+  {
+    const TopoDS_Shape aDrill = createDrill(2.0 + 2.0 * aDrillIter, 5.0);
+    aSession.Cut(aDrill);
+    ASSERT_FALSE(aSession.HasErrors()) << "cut " << aDrillIter;
+    EXPECT_FALSE(aSession.History().IsNull());
+
+    BRepAlgoAPI_Cut aRefCut(aRefShape, aDrill);
+    ASSERT_TRUE(aRefCut.IsDone());
+    aRefShape = aRefCut.Shape();
+  }
+
+  EXPECT_EQ(4, aSession.NbOperations());
+  EXPECT_EQ(0, aSession.NbSkipped());
+  EXPECT_EQ(1, nbSolids(aSession.Shape()));
+  EXPECT_NEAR(BOPTest_Utilities::GetVolume(aRefShape),
+              BOPTest_Utilities::GetVolume(aSession.Shape()),
+              1.0e-4);
+  EXPECT_NEAR(1000.0 - 4.0 * 10.0 * M_PI * 0.25,
+              BOPTest_Utilities::GetVolume(aSession.Shape()),
+              1.0e-4);
+}
+
+TEST(BRepAlgoAPI_BooleanSessionTest, DistantToolSkipped)
+{
+  const TopoDS_Shape aStock = BOPTest_Utilities::CreateBox(gp_Pnt(0.0, 0.0, 0.0), 10.0, 10.0, 10.0);
+
+  BRepAlgoAPI_BooleanSession aSession(aStock);
+  const TopoDS_Shape         anInitShape = aSession.Shape();
+  aSession.Cut(createDrill(50.0, 50.0));
+  EXPECT_FALSE(aSession.HasErrors());
+  EXPECT_EQ(1, aSession.NbSkipped());
+  EXPECT_TRUE(aSession.History().IsNull());
+  EXPECT_TRUE(anInitShape.IsSame(aSession.Shape())) << "stock should not be rebuilt";
+
+  aSession.Fuse(createDrill(50.0, 50.0));
+  EXPECT_FALSE(aSession.HasErrors());
+  EXPECT_EQ(2, nbSolids(aSession.Shape()));
+  EXPECT_EQ(2, aSession.NbOperations());
+}
+
+TEST(BRepAlgoAPI_BooleanSessionTest, UntouchedPartsKept)
+{
+  BRep_Builder    aBuilder;
+  TopoDS_Compound aStock;
+  aBuilder.MakeCompound(aStock);
+  const TopoDS_Shape aLeft = BOPTest_Utilities::CreateBox(gp_Pnt(0.0, 0.0, 0.0), 10.0, 10.0, 10.0);
+  const TopoDS_Shape aRight =
+    BOPTest_Utilities::CreateBox(gp_Pnt(20.0, 0.0, 0.0), 10.0, 10.0, 10.0);
+  aBuilder.Add(aStock, aLeft);
+  aBuilder.Add(aStock, aRight);
+
+  BRepAlgoAPI_BooleanSession aSession(aStock);
+  aSession.Cut(createDrill(25.0, 5.0));
+  ASSERT_FALSE(aSession.HasErrors());
+  EXPECT_EQ(2, nbSolids(aSession.Shape()));
+
+  bool isLeftKept = false;
+  for (TopExp_Explorer anExp(aSession.Shape(), TopAbs_SOLID); anExp.More(); anExp.Next())
+  {
+    isLeftKept |= anExp.Current().IsSame(aLeft);
+    EXPECT_FALSE(anExp.Current().IsSame(aRight)) << "cut part should be replaced";
+  }
+  EXPECT_TRUE(isLeftKept) << "untouched part should be passed as is";
+  EXPECT_NEAR(2000.0 - 10.0 * M_PI * 0.25,
+              BOPTest_Utilities::GetVolume(aSession.Shape()),
+              1.0e-4);
+
+  // common with the tool touching only one part drops the other
+  aSession.Common(BOPTest_Utilities::CreateBox(gp_Pnt(-1.0, -1.0, -1.0), 6.0, 12.0, 12.0));
+  ASSERT_FALSE(aSession.HasErrors());
+  EXPECT_EQ(1, nbSolids(aSession.Shape()));
+  EXPECT_NEAR(500.0, BOPTest_Utilities::GetVolume(aSession.Shape()), 1.0e-4);
+}
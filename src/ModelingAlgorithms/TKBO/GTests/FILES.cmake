@@ -2,11 +2,16 @@
 set(OCCT_TKBO_GTests_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
 
 set(OCCT_TKBO_GTests_FILES
+  BRepAlgoAPI_BooleanSession_Test.cxx
   BRepAlgoAPI_BuilderAlgo_Test.cxx
   BRepAlgoAPI_Cut_Test.cxx
   BRepAlgoAPI_Cut_Test_1.cxx
   BRepAlgoAPI_Fuse_Test.cxx
   BRepAlgoAPI_Common_Test.cxx
   BOPAlgo_BOP_Test.cxx
+  BOPAlgo_ClusterMode_Test.cxx
   BOPAlgo_PaveFiller_Test.cxx
+  BOPAlgo_RemoveFeatures_Test.cxx
+  BOPAlgo_Statistics_Test.cxx
+  IntTools_FClass2d_Test.cxx
 )
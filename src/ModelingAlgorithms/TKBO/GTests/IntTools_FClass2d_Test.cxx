@@ -0,0 +1,99 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <BRepBuilderAPI_MakeEdge.hxx>
+#include <BRepBuilderAPI_MakeFace.hxx>
+#include <BRepBuilderAPI_MakeWire.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <BRepTools.hxx>
+#include <gp_Ax2.hxx>
+#include <gp_Circ.hxx>
+#include <gp_Pln.hxx>
+#include <IntTools_FClass2d.hxx>
+#include <NCollection_Array1.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Face.hxx>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+//! Classifies the grid of points covering the UV bounds of the face (extended by a half)
+//! by the batch and single point methods and compares the results.
+void checkBatch(const TopoDS_Face& theFace, const bool theIsParallel)
+{
+  double aUMin = 0.0, aUMax = 0.0, aVMin = 0.0, aVMax = 0.0;
+  BRepTools::UVBounds(theFace, aUMin, aUMax, aVMin, aVMax);
+  const double aDU = aUMax - aUMin, aDV = aVMax - aVMin;
+
+  const int                    aNbSteps = 40;
+  NCollection_Array1<gp_Pnt2d> aPoints(1, aNbSteps * aNbSteps);
+  for (int i = 0; i < aNbSteps; ++i)
+  {
+    for (int j = 0; j < aNbSteps; ++j)
+    {
+      aPoints(i * aNbSteps + j + 1) = gp_Pnt2d(aUMin - 0.25 * aDU + 1.5 * aDU * i / (aNbSteps - 1),
+                                               aVMin - 0.25 * aDV + 1.5 * aDV * j / (aNbSteps - 1));
+    }
+  }
+
+  IntTools_FClass2d                aClassifier(theFace, 1e-7);
+  NCollection_Array1<TopAbs_State> aStates;
+  aClassifier.Perform(aPoints, aStates, true, theIsParallel);
+  ASSERT_EQ(aPoints.Lower(), aStates.Lower());
+  ASSERT_EQ(aPoints.Upper(), aStates.Upper());
+
+  int aNbIn = 0, aNbOut = 0;
+  for (int anIndex = aPoints.Lower(); anIndex <= aPoints.Upper(); ++anIndex)
+  {
+    EXPECT_EQ(aClassifier.Perform(aPoints(anIndex)), aStates(anIndex));
+    aNbIn += aStates(anIndex) == TopAbs_IN ? 1 : 0;
+    aNbOut += aStates(anIndex) == TopAbs_OUT ? 1 : 0;
+  }
+  EXPECT_GT(aNbIn, 0);
+  EXPECT_GT(aNbOut, 0);
+}
+} // namespace
+
+TEST(IntTools_FClass2dTest, BatchPlaneWithHole)
+{
+  const gp_Circ           aCircle(gp_Ax2(gp::Origin(), -gp::DZ()), 5.0);
+  BRepBuilderAPI_MakeFace aMakeFace(gp_Pln(), -10.0, 10.0, -10.0, 10.0);
+  aMakeFace.Add(BRepBuilderAPI_MakeWire(BRepBuilderAPI_MakeEdge(aCircle)).Wire());
+  ASSERT_TRUE(aMakeFace.IsDone());
+
+  checkBatch(aMakeFace.Face(), false);
+  checkBatch(aMakeFace.Face(), true);
+
+  IntTools_FClass2d                aClassifier(aMakeFace.Face(), 1e-7);
+  NCollection_Array1<gp_Pnt2d>     aPoints(0, 2);
+  NCollection_Array1<TopAbs_State> aStates(1, 1);
+  aPoints(0) = gp_Pnt2d(0.0, 0.0);
+  aPoints(1) = gp_Pnt2d(7.5, 7.5);
+  aPoints(2) = gp_Pnt2d(12.0, 0.0);
+  aClassifier.Perform(aPoints, aStates);
+  EXPECT_EQ(TopAbs_OUT, aStates(0));
+  EXPECT_EQ(TopAbs_IN, aStates(1));
+  EXPECT_EQ(TopAbs_OUT, aStates(2));
+}
+
+TEST(IntTools_FClass2dTest, BatchPeriodicFace)
+{
+  const TopoDS_Shape aCylinder = BRepPrimAPI_MakeCylinder(5.0, 10.0, M_PI).Shape();
+  for (TopExp_Explorer aFaceIter(aCylinder, TopAbs_FACE); aFaceIter.More(); aFaceIter.Next())
+  {
+    checkBatch(TopoDS::Face(aFaceIter.Current()), true);
+  }
+}
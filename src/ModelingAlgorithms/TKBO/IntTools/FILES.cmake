@@ -42,6 +42,8 @@ set(OCCT_IntTools_FILES
   IntTools_Root.cxx
   IntTools_Root.hxx
 
+  IntTools_SharedCache.cxx
+  IntTools_SharedCache.hxx
   IntTools_ShrunkRange.cxx
   IntTools_ShrunkRange.hxx
   IntTools_SurfaceRangeLocalizeData.cxx
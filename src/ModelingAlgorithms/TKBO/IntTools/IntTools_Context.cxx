@@ -31,11 +31,15 @@
 #include <gp_Pnt2d.hxx>
 #include <IntTools_Context.hxx>
 #include <IntTools_FClass2d.hxx>
+#include <IntTools_SharedCache.hxx>
 #include <IntTools_SurfaceRangeLocalizeData.hxx>
 #include <IntTools_Tools.hxx>
+#include <NCollection_IndexedMap.hxx>
+#include <NCollection_List.hxx>
 #include <Precision.hxx>
 #include <Standard_Type.hxx>
 #include <TopAbs_State.hxx>
+#include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopoDS.hxx>
 #include <TopoDS_Edge.hxx>
@@ -46,6 +50,40 @@
 
 IMPLEMENT_STANDARD_RTTIEXT(IntTools_Context, Standard_Transient)
 
+namespace
+{
+//! Destroys the cached objects of the shapes missing in <theShapes> and unbinds them.
+template <class TheObject>
+static void retainObjects(
+  NCollection_DataMap<TopoDS_Shape, TheObject*, TopTools_ShapeMapHasher>& theMap,
+  const NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher>&    theShapes,
+  const occ::handle<NCollection_BaseAllocator>&                           theAllocator,
+  const bool                                                              theIsOwner = true)
+{
+  NCollection_List<TopoDS_Shape> aRemoved;
+  for (typename NCollection_DataMap<TopoDS_Shape, TheObject*, TopTools_ShapeMapHasher>::Iterator
+         anIt(theMap);
+       anIt.More();
+       anIt.Next())
+  {
+    if (!theShapes.Contains(anIt.Key()))
+    {
+      if (theIsOwner)
+      {
+        TheObject* anObject = anIt.Value();
+        anObject->~TheObject();
+        theAllocator->Free(anObject);
+      }
+      aRemoved.Append(anIt.Key());
+    }
+  }
+  for (NCollection_List<TopoDS_Shape>::Iterator anIt(aRemoved); anIt.More(); anIt.Next())
+  {
+    theMap.UnBind(anIt.Value());
+  }
+}
+} // namespace
+
 //
 //=================================================================================================
 
@@ -89,17 +127,7 @@ IntTools_Context::IntTools_Context(const occ::handle<NCollection_BaseAllocator>&
 
 IntTools_Context::~IntTools_Context()
 {
-  for (NCollection_DataMap<TopoDS_Shape, IntTools_FClass2d*, TopTools_ShapeMapHasher>::Iterator
-         anIt(myFClass2dMap);
-       anIt.More();
-       anIt.Next())
-  {
-    IntTools_FClass2d* pFClass2d = anIt.Value();
-    ;
-    (*pFClass2d).~IntTools_FClass2d();
-    myAllocator->Free(pFClass2d);
-  }
-  myFClass2dMap.Clear();
+  clearSharedData();
 
   clearCachedPOnSProjectors();
   for (NCollection_DataMap<TopoDS_Shape, GeomAPI_ProjectPointOnCurve*, TopTools_ShapeMapHasher>::
@@ -158,17 +186,6 @@ IntTools_Context::~IntTools_Context()
   }
   myProjSDataMap.Clear();
 
-  for (NCollection_DataMap<TopoDS_Shape, Bnd_Box*, TopTools_ShapeMapHasher>::Iterator anIt(
-         myBndBoxDataMap);
-       anIt.More();
-       anIt.Next())
-  {
-    Bnd_Box* pBox = anIt.Value();
-    (*pBox).~Bnd_Box();
-    myAllocator->Free(pBox);
-  }
-  myBndBoxDataMap.Clear();
-
   for (NCollection_DataMap<TopoDS_Shape, BRepAdaptor_Surface*, TopTools_ShapeMapHasher>::Iterator
          anIt(mySurfAdaptorMap);
        anIt.More();
@@ -179,6 +196,55 @@ IntTools_Context::~IntTools_Context()
     myAllocator->Free(pSurfAdaptor);
   }
   mySurfAdaptorMap.Clear();
+}
+
+//=================================================================================================
+
+void IntTools_Context::SetSharedCache(const occ::handle<IntTools_SharedCache>& theCache)
+{
+  if (theCache == mySharedCache)
+  {
+    return;
+  }
+  clearSharedData();
+  mySharedCache = theCache;
+}
+
+//=================================================================================================
+
+void IntTools_Context::clearSharedData()
+{
+  if (!mySharedCache.IsNull())
+  {
+    // the data is owned by the shared cache
+    myFClass2dMap.Clear();
+    myBndBoxDataMap.Clear();
+    myOBBMap.Clear();
+    return;
+  }
+
+  for (NCollection_DataMap<TopoDS_Shape, IntTools_FClass2d*, TopTools_ShapeMapHasher>::Iterator
+         anIt(myFClass2dMap);
+       anIt.More();
+       anIt.Next())
+  {
+    IntTools_FClass2d* pFClass2d = anIt.Value();
+    ;
+    (*pFClass2d).~IntTools_FClass2d();
+    myAllocator->Free(pFClass2d);
+  }
+  myFClass2dMap.Clear();
+
+  for (NCollection_DataMap<TopoDS_Shape, Bnd_Box*, TopTools_ShapeMapHasher>::Iterator anIt(
+         myBndBoxDataMap);
+       anIt.More();
+       anIt.Next())
+  {
+    Bnd_Box* pBox = anIt.Value();
+    (*pBox).~Bnd_Box();
+    myAllocator->Free(pBox);
+  }
+  myBndBoxDataMap.Clear();
 
   for (NCollection_DataMap<TopoDS_Shape, Bnd_OBB*, TopTools_ShapeMapHasher>::Iterator anIt(
          myOBBMap);
@@ -199,6 +265,13 @@ Bnd_Box& IntTools_Context::BndBox(const TopoDS_Shape& aS)
   Bnd_Box* pBox = nullptr;
   if (!myBndBoxDataMap.Find(aS, pBox))
   {
+    if (!mySharedCache.IsNull())
+    {
+      // the shared data is not modified by the context, see the header
+      pBox = const_cast<Bnd_Box*>(&mySharedCache->BndBox(aS));
+      myBndBoxDataMap.Bind(aS, pBox);
+      return *pBox;
+    }
     //
     pBox = (Bnd_Box*)myAllocator->Allocate(sizeof(Bnd_Box));
     new (pBox) Bnd_Box();
@@ -227,6 +300,12 @@ IntTools_FClass2d& IntTools_Context::FClass2d(const TopoDS_Face& aF)
   IntTools_FClass2d* pFClass2d = nullptr;
   if (!myFClass2dMap.Find(aF, pFClass2d))
   {
+    if (!mySharedCache.IsNull())
+    {
+      pFClass2d = &mySharedCache->FClass2d(aF);
+      myFClass2dMap.Bind(aF, pFClass2d);
+      return *pFClass2d;
+    }
     double      aTolF;
     TopoDS_Face aFF;
     //
@@ -256,6 +335,11 @@ GeomAPI_ProjectPointOnSurf& IntTools_Context::ProjPS(const TopoDS_Face& aF)
     pProjPS =
       (GeomAPI_ProjectPointOnSurf*)myAllocator->Allocate(sizeof(GeomAPI_ProjectPointOnSurf));
     new (pProjPS) GeomAPI_ProjectPointOnSurf();
+    if (!mySharedCache.IsNull())
+    {
+      // the contexts of other threads project on the same faces
+      pProjPS->SetGridCache(mySharedCache->GridCache());
+    }
     pProjPS->Init(aS, Umin, Usup, Vmin, Vsup, myPOnSTolerance);
     pProjPS->SetExtremaFlag(Extrema_ExtFlag_MIN); ///
     //
@@ -401,6 +485,12 @@ Bnd_OBB& IntTools_Context::OBB(const TopoDS_Shape& aS, const double theGap)
   Bnd_OBB* pBox = nullptr;
   if (!myOBBMap.Find(aS, pBox))
   {
+    if (!mySharedCache.IsNull())
+    {
+      pBox = const_cast<Bnd_OBB*>(&mySharedCache->OBB(aS, theGap));
+      myOBBMap.Bind(aS, pBox);
+      return *pBox;
+    }
     pBox = (Bnd_OBB*)myAllocator->Allocate(sizeof(Bnd_OBB));
     new (pBox) Bnd_OBB();
     //
@@ -1023,6 +1113,39 @@ void IntTools_Context::clearCachedPOnSProjectors()
 
 //=================================================================================================
 
+void IntTools_Context::Retain(const TopoDS_Shape& theShape)
+{
+  NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> aShapes;
+  if (!theShape.IsNull())
+  {
+    TopExp::MapShapes(theShape, aShapes);
+  }
+
+  const bool isOwner = mySharedCache.IsNull();
+  retainObjects(myFClass2dMap, aShapes, myAllocator, isOwner);
+  retainObjects(myProjPSMap, aShapes, myAllocator);
+  retainObjects(myProjPCMap, aShapes, myAllocator);
+  retainObjects(mySClassMap, aShapes, myAllocator);
+  retainObjects(myHatcherMap, aShapes, myAllocator);
+  retainObjects(myProjSDataMap, aShapes, myAllocator);
+  retainObjects(myBndBoxDataMap, aShapes, myAllocator, isOwner);
+  retainObjects(mySurfAdaptorMap, aShapes, myAllocator);
+  retainObjects(myOBBMap, aShapes, myAllocator, isOwner);
+
+  for (NCollection_DataMap<occ::handle<Geom_Curve>, GeomAPI_ProjectPointOnCurve*>::Iterator anIt(
+         myProjPTMap);
+       anIt.More();
+       anIt.Next())
+  {
+    GeomAPI_ProjectPointOnCurve* pProjPT = anIt.Value();
+    (*pProjPT).~GeomAPI_ProjectPointOnCurve();
+    myAllocator->Free(pProjPT);
+  }
+  myProjPTMap.Clear();
+}
+
+//=================================================================================================
+
 void IntTools_Context::UVBounds(const TopoDS_Face& theFace,
                                 double&            UMin,
                                 double&            UMax,
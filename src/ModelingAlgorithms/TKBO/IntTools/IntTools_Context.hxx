@@ -26,6 +26,7 @@
 #include <Standard_Transient.hxx>
 #include <TopAbs_State.hxx>
 #include <BRepAdaptor_Surface.hxx>
+#include <IntTools_SharedCache.hxx>
 class IntTools_FClass2d;
 class TopoDS_Face;
 class GeomAPI_ProjectPointOnSurf;
@@ -236,6 +237,21 @@ public:
   //! correct value for all projectors
   Standard_EXPORT void SetPOnSProjectionTolerance(const double theValue);
 
+  //! Releases the cached algorithms of the shapes which are not sub-shapes of <theShape>,
+  //! so that the context can be reused by the operations on the evolving shape
+  //! without keeping the data of removed sub-shapes.
+  //! Projectors on the curves not bound to the shapes are released as well.
+  Standard_EXPORT void Retain(const TopoDS_Shape& theShape);
+
+  //! Sets the cache of the 2D classifiers of the faces and the bounding boxes of the shapes
+  //! shared with the contexts of other threads (may be NULL).
+  //! Once set, this data is taken from the shared cache instead of being built by the context,
+  //! and the returned boxes must not be modified. The data built by the context before is released.
+  Standard_EXPORT void SetSharedCache(const occ::handle<IntTools_SharedCache>& theCache);
+
+  //! Returns the shared cache (may be NULL).
+  const occ::handle<IntTools_SharedCache>& SharedCache() const { return mySharedCache; }
+
   DEFINE_STANDARD_RTTIEXT(IntTools_Context, Standard_Transient)
 
 protected:
@@ -256,12 +272,16 @@ protected:
   // clang-format off
   NCollection_DataMap<TopoDS_Shape, Bnd_OBB*, TopTools_ShapeMapHasher> myOBBMap; // Map of oriented bounding boxes
   // clang-format on
-  int    myCreateFlag;
-  double myPOnSTolerance;
+  int                               myCreateFlag;
+  double                            myPOnSTolerance;
+  occ::handle<IntTools_SharedCache> mySharedCache;
 
 private:
   //! Clears map of already cached projectors.
   Standard_EXPORT void clearCachedPOnSProjectors();
+
+  //! Clears the maps of the classifiers and boxes, releasing the data owned by the context.
+  Standard_EXPORT void clearSharedData();
 };
 
 #endif // _IntTools_Context_HeaderFile
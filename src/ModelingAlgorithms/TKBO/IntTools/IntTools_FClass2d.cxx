@@ -35,6 +35,7 @@
 #include <gp_Vec2d.hxx>
 #include <Standard_Integer.hxx>
 #include <NCollection_DataMap.hxx>
+#include <OSD_Parallel.hxx>
 #include <TopAbs_Orientation.hxx>
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
@@ -596,12 +597,63 @@ TopAbs_State IntTools_FClass2d::PerformInfinitePoint() const
 
 TopAbs_State IntTools_FClass2d::Perform(const gp_Pnt2d& _Puv, const bool RecadreOnPeriodic) const
 {
-  int nbtabclass = TabClass.Length();
-  if (nbtabclass == 0)
+  if (TabClass.IsEmpty())
   {
     return TopAbs_IN;
   }
 
+  BRepAdaptor_Surface aSurf(Face, false);
+  return perform(_Puv, RecadreOnPeriodic, aSurf);
+}
+
+//=================================================================================================
+
+void IntTools_FClass2d::Perform(const NCollection_Array1<gp_Pnt2d>& thePoints,
+                                NCollection_Array1<TopAbs_State>&   theStates,
+                                const bool                          RecadreOnPeriodic,
+                                const bool                          theIsParallel) const
+{
+  if (theStates.Lower() != thePoints.Lower() || theStates.Upper() != thePoints.Upper())
+  {
+    theStates.Resize(thePoints.Lower(), thePoints.Upper(), false);
+  }
+  if (thePoints.IsEmpty())
+  {
+    return;
+  }
+  if (TabClass.IsEmpty())
+  {
+    theStates.Init(TopAbs_IN);
+    return;
+  }
+
+  // the adaptor caches the evaluation data, thus each chunk of points uses its own one
+  constexpr int THE_CHUNK_SIZE = 256;
+  const int     aNbPoints      = thePoints.Length();
+  const int     aNbChunks      = (aNbPoints + THE_CHUNK_SIZE - 1) / THE_CHUNK_SIZE;
+  OSD_Parallel::For(
+    0,
+    aNbChunks,
+    [&](const int theChunk) {
+      BRepAdaptor_Surface aSurf(Face, false);
+      const int           aFirst = thePoints.Lower() + theChunk * THE_CHUNK_SIZE;
+      const int           aLast  = std::min(aFirst + THE_CHUNK_SIZE, thePoints.Upper() + 1);
+      for (int anIndex = aFirst; anIndex < aLast; ++anIndex)
+      {
+        theStates.ChangeValue(anIndex) = perform(thePoints(anIndex), RecadreOnPeriodic, aSurf);
+      }
+    },
+    !theIsParallel || aNbChunks < 2);
+}
+
+//=================================================================================================
+
+TopAbs_State IntTools_FClass2d::perform(const gp_Pnt2d&            _Puv,
+                                        const bool                 RecadreOnPeriodic,
+                                        const BRepAdaptor_Surface& surf) const
+{
+  int nbtabclass = TabClass.Length();
+
   //-- U1 is the First Param and U2 is in this case U1+Period
   double       u       = _Puv.X();
   double       v       = _Puv.Y();
@@ -609,13 +661,10 @@ TopAbs_State IntTools_FClass2d::Perform(const gp_Pnt2d& _Puv, const bool Recadre
   double       vv      = v;
   TopAbs_State aStatus = TopAbs_UNKNOWN;
 
-  occ::handle<BRepAdaptor_Surface> surf = new BRepAdaptor_Surface();
-  surf->Initialize(Face, false);
-
-  const bool   IsUPer  = surf->IsUPeriodic();
-  const bool   IsVPer  = surf->IsVPeriodic();
-  const double uperiod = IsUPer ? surf->UPeriod() : 0.0;
-  const double vperiod = IsVPer ? surf->VPeriod() : 0.0;
+  const bool   IsUPer  = surf.IsUPeriodic();
+  const bool   IsVPer  = surf.IsVPeriodic();
+  const double uperiod = IsUPer ? surf.UPeriod() : 0.0;
+  const double vperiod = IsVPer ? surf.VPeriod() : 0.0;
 
   bool urecadre, vrecadre, bUseClassifier;
   int  dedans = 1;
@@ -689,8 +738,8 @@ TopAbs_State IntTools_FClass2d::Perform(const gp_Pnt2d& _Puv, const bool Recadre
       double aURes, aVRes, aFCTol;
       bool   bUIn, bVIn;
       //
-      aURes = surf->UResolution(Toluv);
-      aVRes = surf->VResolution(Toluv);
+      aURes = surf.UResolution(Toluv);
+      aVRes = surf.VResolution(Toluv);
       //
       bUIn = (u >= Umin) && (u <= Umax);
       bVIn = (v >= Vmin) && (v <= Vmax);
@@ -705,6 +754,8 @@ TopAbs_State IntTools_FClass2d::Perform(const gp_Pnt2d& _Puv, const bool Recadre
       }
       //
 
+      // the explorer keeps the state of exploration, thus guard it for concurrent calls
+      std::lock_guard<std::mutex> aLock(myFExplorerMutex);
       if (myFExplorer.get() == nullptr)
         myFExplorer.reset(new BRepClass_FaceExplorer(Face));
 
@@ -846,6 +897,7 @@ TopAbs_State IntTools_FClass2d::TestOnRestriction(const gp_Pnt2d& _Puv,
     else
     { //-- TabOrien(1)=-1  Wrong  Wire
 
+      std::lock_guard<std::mutex> aLock(myFExplorerMutex);
       if (myFExplorer.get() == nullptr)
         myFExplorer.reset(new BRepClass_FaceExplorer(Face));
 
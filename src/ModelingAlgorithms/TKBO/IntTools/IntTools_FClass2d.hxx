@@ -23,17 +23,21 @@
 
 #include <BRepClass_FaceExplorer.hxx>
 #include <CSLib_Class2d.hxx>
+#include <NCollection_Array1.hxx>
 #include <NCollection_Sequence.hxx>
 #include <Standard_Integer.hxx>
 #include <TopoDS_Face.hxx>
 #include <TopAbs_State.hxx>
 
 #include <memory>
+#include <mutex>
 
+class BRepAdaptor_Surface;
 class gp_Pnt2d;
 
 //! Class provides an algorithm to classify a 2d Point
 //! in 2d space of face using boundaries of the face.
+//! The classification methods can be called concurrently for the initialized classifier.
 class IntTools_FClass2d
 {
 public:
@@ -60,6 +64,19 @@ public:
   Standard_EXPORT TopAbs_State Perform(const gp_Pnt2d& Puv,
                                        const bool      RecadreOnPeriodic = true) const;
 
+  //! Classifies the array of 2d points, storing their states into theStates
+  //! (resized to the bounds of thePoints if necessary).
+  //! Faster than calling Perform() for each point, as the surface adaptor
+  //! is initialized once per batch (or once per thread in parallel mode).
+  //! @param[in]  thePoints         points to classify
+  //! @param[out] theStates         states of the points
+  //! @param[in]  RecadreOnPeriodic flag to adjust the points to the period of the surface
+  //! @param[in]  theIsParallel     flag to classify the points in parallel threads
+  Standard_EXPORT void Perform(const NCollection_Array1<gp_Pnt2d>& thePoints,
+                               NCollection_Array1<TopAbs_State>&   theStates,
+                               const bool                          RecadreOnPeriodic = true,
+                               const bool                          theIsParallel = false) const;
+
   //! Destructor
   Standard_EXPORT ~IntTools_FClass2d();
 
@@ -72,6 +89,12 @@ public:
 
   Standard_EXPORT bool IsHole() const;
 
+private:
+  //! Classifies the 2d point using the given adaptor of the face surface.
+  TopAbs_State perform(const gp_Pnt2d&            Puv,
+                       const bool                 RecadreOnPeriodic,
+                       const BRepAdaptor_Surface& theSurf) const;
+
 private:
   NCollection_Sequence<CSLib_Class2d> TabClass;
   NCollection_Sequence<int>           TabOrien;
@@ -88,6 +111,7 @@ private:
   bool                                myIsHole;
 
   mutable std::unique_ptr<BRepClass_FaceExplorer> myFExplorer;
+  mutable std::mutex                              myFExplorerMutex;
 };
 
 #endif // _IntTools_FClass2d_HeaderFile
@@ -243,6 +243,13 @@ double IntTools_FaceFace::FuzzyValue() const
 
 //=================================================================================================
 
+void IntTools_FaceFace::SetSamplingCache(const occ::handle<IntPolyh_SamplingCache>& theCache)
+{
+  myIntersector.SetSamplingCache(theCache);
+}
+
+//=================================================================================================
+
 void IntTools_FaceFace::SetList(NCollection_List<IntSurf_PntOn2S>& aListOfPnts)
 {
   myListOfPnts = aListOfPnts;
@@ -86,6 +86,10 @@ public:
   //! Returns Fuzzy value
   Standard_EXPORT double FuzzyValue() const;
 
+  //! Sets the cache of surface samplings shared by intersections of the same faces
+  //! with different ones
+  Standard_EXPORT void SetSamplingCache(const occ::handle<IntPolyh_SamplingCache>& theCache);
+
   //! Gets the intersection context
   Standard_EXPORT const occ::handle<IntTools_Context>& Context() const;
 
@@ -0,0 +1,147 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <IntTools_SharedCache.hxx>
+
+#include <Bnd_Box.hxx>
+#include <Bnd_OBB.hxx>
+#include <BRep_Tool.hxx>
+#include <BRepBndLib.hxx>
+#include <IntTools_FClass2d.hxx>
+#include <TopoDS_Face.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(IntTools_SharedCache, Standard_Transient)
+
+namespace
+{
+template <class TheObject>
+static void clearObjects(
+  NCollection_DataMap<TopoDS_Shape, TheObject*, TopTools_ShapeMapHasher>& theMap)
+{
+  for (typename NCollection_DataMap<TopoDS_Shape, TheObject*, TopTools_ShapeMapHasher>::Iterator
+         anIt(theMap);
+       anIt.More();
+       anIt.Next())
+  {
+    delete anIt.Value();
+  }
+  theMap.Clear();
+}
+} // namespace
+
+//=================================================================================================
+
+IntTools_SharedCache::IntTools_SharedCache()
+    : myGridCache(new Extrema_GenExtPSCache()),
+      myNbHits(0),
+      myNbMisses(0)
+{
+}
+
+//=================================================================================================
+
+IntTools_SharedCache::~IntTools_SharedCache()
+{
+  clearObjects(myFClass2dMap);
+  clearObjects(myBndBoxMap);
+  clearObjects(myOBBMap);
+}
+
+//=================================================================================================
+
+template <class TheObject, class TheBuilder>
+TheObject& IntTools_SharedCache::find(
+  NCollection_DataMap<TopoDS_Shape, TheObject*, TopTools_ShapeMapHasher>& theMap,
+  const TopoDS_Shape&                                                      theShape,
+  const TheBuilder&                                                        theBuilder)
+{
+  {
+    std::lock_guard<std::mutex> aLock(myMutex);
+    if (TheObject* const* anObject = theMap.Seek(theShape))
+    {
+      ++myNbHits;
+      return **anObject;
+    }
+  }
+
+  // build the data without blocking other threads;
+  // the first stored data is shared if the same one has been built concurrently
+  TheObject*                  aNewObject = theBuilder();
+  std::lock_guard<std::mutex> aLock(myMutex);
+  ++myNbMisses;
+  if (TheObject* const* aStored = theMap.Seek(theShape))
+  {
+    delete aNewObject;
+    return **aStored;
+  }
+  theMap.Bind(theShape, aNewObject);
+  return *aNewObject;
+}
+
+//=================================================================================================
+
+IntTools_FClass2d& IntTools_SharedCache::FClass2d(const TopoDS_Face& theFace)
+{
+  return find(myFClass2dMap, theFace, [&theFace]() {
+    TopoDS_Face aFF = theFace;
+    aFF.Orientation(TopAbs_FORWARD);
+    return new IntTools_FClass2d(aFF, BRep_Tool::Tolerance(aFF));
+  });
+}
+
+//=================================================================================================
+
+const Bnd_Box& IntTools_SharedCache::BndBox(const TopoDS_Shape& theShape)
+{
+  return find(myBndBoxMap, theShape, [&theShape]() {
+    Bnd_Box* aBox = new Bnd_Box();
+    BRepBndLib::Add(theShape, *aBox);
+    return aBox;
+  });
+}
+
+//=================================================================================================
+
+const Bnd_OBB& IntTools_SharedCache::OBB(const TopoDS_Shape& theShape, const double theGap)
+{
+  return find(myOBBMap, theShape, [&theShape, theGap]() {
+    Bnd_OBB* aBox = new Bnd_OBB();
+    BRepBndLib::AddOBB(theShape, *aBox);
+    aBox->Enlarge(theGap);
+    return aBox;
+  });
+}
+
+//=================================================================================================
+
+int IntTools_SharedCache::NbEntries() const
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  return myFClass2dMap.Extent() + myBndBoxMap.Extent() + myOBBMap.Extent();
+}
+
+//=================================================================================================
+
+std::size_t IntTools_SharedCache::NbHits() const
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  return myNbHits;
+}
+
+//=================================================================================================
+
+std::size_t IntTools_SharedCache::NbMisses() const
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  return myNbMisses;
+}
@@ -0,0 +1,99 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _IntTools_SharedCache_HeaderFile
+#define _IntTools_SharedCache_HeaderFile
+
+#include <Extrema_GenExtPSCache.hxx>
+#include <Standard.hxx>
+#include <Standard_Transient.hxx>
+#include <NCollection_DataMap.hxx>
+#include <TopTools_ShapeMapHasher.hxx>
+#include <TopoDS_Shape.hxx>
+
+#include <mutex>
+
+class Bnd_Box;
+class Bnd_OBB;
+class IntTools_FClass2d;
+class TopoDS_Face;
+
+//! Thread-safe cache of the data of shapes which is not changed by its usage,
+//! intended to be shared by the contexts of the threads of a parallel algorithm
+//! (see IntTools_Context::SetSharedCache()), so that the data is built once per shape
+//! instead of once per thread.
+//!
+//! The cached data are the 2D classifiers of the faces and the bounding boxes of the shapes.
+//! The algorithms keeping the state of computation (projectors, solid classifiers,
+//! hatchers and surface adaptors) are not shared, but the projectors on surfaces
+//! share their sampling grids (see GridCache()).
+//!
+//! The data is built outside of the lock, so that building the data of different shapes
+//! does not block the other threads; the data stored first is kept if the same data has
+//! been built concurrently. The contexts keep the obtained data, thus the lock is taken
+//! only on the first request of the shape in each thread.
+class IntTools_SharedCache : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(IntTools_SharedCache, Standard_Transient)
+public:
+  //! Empty constructor.
+  Standard_EXPORT IntTools_SharedCache();
+
+  //! Destructor.
+  Standard_EXPORT ~IntTools_SharedCache() override;
+
+  //! Returns the 2D point classifier for the face, building it on first request.
+  //! Only the classification methods of the returned classifier may be used concurrently.
+  Standard_EXPORT IntTools_FClass2d& FClass2d(const TopoDS_Face& theFace);
+
+  //! Returns the bounding box of the shape, building it on first request.
+  Standard_EXPORT const Bnd_Box& BndBox(const TopoDS_Shape& theShape);
+
+  //! Returns the oriented bounding box of the shape enlarged by the gap,
+  //! building it on first request.
+  Standard_EXPORT const Bnd_OBB& OBB(const TopoDS_Shape& theShape, const double theGap);
+
+  //! Returns the cache of the sampling grids of the projectors on surfaces.
+  const occ::handle<Extrema_GenExtPSCache>& GridCache() const { return myGridCache; }
+
+  //! Returns the number of cached objects.
+  Standard_EXPORT int NbEntries() const;
+
+  //! Returns the number of requests of the cached data.
+  Standard_EXPORT std::size_t NbHits() const;
+
+  //! Returns the number of requests which have built the data.
+  Standard_EXPORT std::size_t NbMisses() const;
+
+private:
+  //! Returns the object bound to the shape, building it by the functor on first request.
+  template <class TheObject, class TheBuilder>
+  TheObject& find(NCollection_DataMap<TopoDS_Shape, TheObject*, TopTools_ShapeMapHasher>& theMap,
+                  const TopoDS_Shape&                                                      theShape,
+                  const TheBuilder& theBuilder);
+
+private:
+  IntTools_SharedCache(const IntTools_SharedCache&)            = delete;
+  IntTools_SharedCache& operator=(const IntTools_SharedCache&) = delete;
+
+private:
+  NCollection_DataMap<TopoDS_Shape, IntTools_FClass2d*, TopTools_ShapeMapHasher> myFClass2dMap;
+  NCollection_DataMap<TopoDS_Shape, Bnd_Box*, TopTools_ShapeMapHasher>           myBndBoxMap;
+  NCollection_DataMap<TopoDS_Shape, Bnd_OBB*, TopTools_ShapeMapHasher>           myOBBMap;
+  occ::handle<Extrema_GenExtPSCache>                                             myGridCache;
+  mutable std::mutex                                                             myMutex;
+  std::size_t                                                                    myNbHits;
+  std::size_t                                                                    myNbMisses;
+};
+
+#endif // _IntTools_SharedCache_HeaderFile
@@ -219,7 +219,8 @@ BRepFill_PipeShell::BRepFill_PipeShell(const TopoDS_Wire& Spine)
       myTrihedron(GeomFill_IsCorrectedFrenet),
       myTransition(BRepFill_Modified),
       myStatus(GeomFill_PipeOk),
-      myIsBuildHistory(true)
+      myIsBuildHistory(true),
+      myIsParallel(false)
 {
   myLocation.Nullify();
   mySection.Nullify();
@@ -732,6 +733,7 @@ bool BRepFill_PipeShell::Build()
   MkSw.SetTolerance(myTol3d, myBoundTol, 1.e-5, myTolAngular);
   MkSw.SetAngularControl(angmin, angmax);
   MkSw.SetForceApproxC1(myForceApproxC1);
+  MkSw.SetRunParallel(myIsParallel);
   MkSw.SetBounds(TopoDS::Wire(myFirst), TopoDS::Wire(myLast));
 
   GeomAbs_Shape theContinuity = GeomAbs_C2;
@@ -131,6 +131,13 @@ public:
   //! If True, the pipe shell stores the history of the sections and the spine.
   inline bool IsBuildHistory() const { return myIsBuildHistory; }
 
+  //! Sets the flag to compute the swept faces along the edges of the spine in parallel threads.
+  //! See BRepFill_Sweep::SetRunParallel() for the supported modes.
+  inline void SetRunParallel(const bool theIsParallel) { myIsParallel = theIsParallel; }
+
+  //! Returns the flag to compute the swept faces in parallel threads.
+  inline bool RunParallel() const { return myIsParallel; }
+
   //! Set an section. The correspondence with the spine, will be automatically performed.
   Standard_EXPORT void Add(const TopoDS_Shape& Profile,
                            const bool          WithContact    = false,
@@ -257,6 +264,7 @@ private:
   GeomFill_PipeError                             myStatus;
   double                                         myErrorOnSurf;
   bool                                           myIsBuildHistory;
+  bool                                           myIsParallel;
 };
 
 #endif // _BRepFill_PipeShell_HeaderFile
@@ -27,6 +27,7 @@
 #include <BRepAdaptor_Surface.hxx>
 #include <BRepBuilderAPI_MakeWire.hxx>
 #include <BRepCheck_Edge.hxx>
+#include <BRepFill_Edge3DLaw.hxx>
 #include <BRepFill_LocationLaw.hxx>
 #include <BRepFill_SectionLaw.hxx>
 #include <BRepFill_Sweep.hxx>
@@ -50,11 +51,13 @@
 #include <Geom_SurfaceOfRevolution.hxx>
 #include <GeomAdaptor_Curve.hxx>
 #include <GeomAdaptor_Surface.hxx>
+#include <GeomFill_EvolvedSection.hxx>
 #include <GeomFill_LocationLaw.hxx>
 #include <GeomFill_SectionLaw.hxx>
 #include <GeomFill_Sweep.hxx>
 #include <GeomLib.hxx>
 #include <GeomLib_IsPlanarSurface.hxx>
+#include <OSD_Parallel.hxx>
 #include <gp_Pnt2d.hxx>
 #include <gp_Vec2d.hxx>
 #include <Precision.hxx>
@@ -1905,6 +1908,7 @@ BRepFill_Sweep::BRepFill_Sweep(const occ::handle<BRepFill_SectionLaw>&  Section,
   myDegmax        = 11;
   mySegmax        = 30;
   myForceApproxC1 = false;
+  myIsParallel    = false;
 }
 
 //=======================================================================
@@ -2243,55 +2247,77 @@ bool BRepFill_Sweep::BuildShell(
   // (1.2) Calculate surfaces
   for (ipath = 1, IPath = IFirst; ipath <= NbPath; ipath++, IPath++)
   {
+    double Lf, Ll;
+    myLoc->CurvilinearBounds(IPath, Lf, Ll);
+    Vi(ipath + 1) = SecDeb + (Ll / Length) * SecDom;
+  }
 
-    GeomFill_Sweep Sweep(myLoc->Law(IPath), KPart);
-    Sweep.SetTolerance(myTol3d, myBoundTol, myTol2d, myTolAngular);
-    Sweep.SetForceApproxC1(myForceApproxC1);
+  // The surfaces along different paths are independent; they are computed
+  // concurrently only when the location laws along the edges of the spine
+  // do not share adaptors and the section laws are not modified by evaluation.
+  bool isParallel = myIsParallel && NbPath > 1 && myLoc->IsKind(STANDARD_TYPE(BRepFill_Edge3DLaw));
+  for (isec = 1; isec <= NbLaw && isParallel; isec++)
+  {
+    isParallel = !mySec->Law(isec)->IsKind(STANDARD_TYPE(GeomFill_EvolvedSection));
+  }
 
-    // Case of evolutionary section, definition of parametric correspondence
-    if (!constSection)
-    {
-      double lf, ll, Lf, Ll;
-      myLoc->Law(IPath)->GetDomain(lf, ll);
-      myLoc->CurvilinearBounds(IPath, Lf, Ll);
-      Vi(ipath + 1) = SecDeb + (Ll / Length) * SecDom;
-      Sweep.SetDomain(lf, ll, Vi(ipath), Vi(ipath + 1));
-    }
-    else // section is constant
-    {
-      double lf, ll, Lf, Ll;
-      myLoc->Law(IPath)->GetDomain(lf, ll);
-      myLoc->CurvilinearBounds(IPath, Lf, Ll);
-      Vi(ipath + 1) = SecDeb + (Ll / Length) * SecDom;
-    }
+  NCollection_Array1<bool> IsPathDone(1, NbPath);
+  IsPathDone.Init(false);
+  OSD_Parallel::For(
+    1,
+    NbPath + 1,
+    [&](const int thePath) {
+      const int      aPath = IFirst + thePath - 1;
+      GeomFill_Sweep Sweep(myLoc->Law(aPath), KPart);
+      Sweep.SetTolerance(myTol3d, myBoundTol, myTol2d, myTolAngular);
+      Sweep.SetForceApproxC1(myForceApproxC1);
 
-    for (isec = 1; isec <= NbLaw; isec++)
-    {
-      Sweep.Build(mySec->Law(isec), myApproxStyle, myContinuity, myDegmax, mySegmax);
-      if (!Sweep.IsDone())
-        return false;
-      TabS(isec, ipath)     = Sweep.Surface();
-      TabErr(isec, ipath)   = Sweep.ErrorOnSurface();
-      ExchUV(isec, ipath)   = Sweep.ExchangeUV();
-      UReverse(isec, ipath) = Sweep.UReversed();
-      if (Sweep.ErrorOnSurface() > Error)
-        Error = Sweep.ErrorOnSurface();
-
-      if ((ipath == 1) && (ExtendFirst > 0))
+      // Case of evolutionary section, definition of parametric correspondence
+      if (!constSection)
       {
-        occ::handle<Geom_BoundedSurface> BndS;
-        BndS = occ::down_cast<Geom_BoundedSurface>(TabS(isec, ipath));
-        GeomLib::ExtendSurfByLength(BndS, ExtendFirst, 1, Sweep.ExchangeUV(), false);
-        TabS(isec, ipath) = BndS;
+        double lf, ll;
+        myLoc->Law(aPath)->GetDomain(lf, ll);
+        Sweep.SetDomain(lf, ll, Vi(thePath), Vi(thePath + 1));
       }
-      if ((ipath == NbPath) && (ExtendLast > 0))
+
+      // the sections share the cached evaluations of the location law
+      for (int aSec = 1; aSec <= NbLaw; aSec++)
       {
-        occ::handle<Geom_BoundedSurface> BndS;
-        BndS = occ::down_cast<Geom_BoundedSurface>(TabS(isec, ipath));
-        GeomLib::ExtendSurfByLength(BndS, ExtendLast, 1, Sweep.ExchangeUV(), true);
-        TabS(isec, ipath) = BndS;
+        Sweep.Build(mySec->Law(aSec), myApproxStyle, myContinuity, myDegmax, mySegmax);
+        if (!Sweep.IsDone())
+          return;
+        TabS(aSec, thePath)     = Sweep.Surface();
+        TabErr(aSec, thePath)   = Sweep.ErrorOnSurface();
+        ExchUV(aSec, thePath)   = Sweep.ExchangeUV();
+        UReverse(aSec, thePath) = Sweep.UReversed();
+
+        if ((thePath == 1) && (ExtendFirst > 0))
+        {
+          occ::handle<Geom_BoundedSurface> BndS;
+          BndS = occ::down_cast<Geom_BoundedSurface>(TabS(aSec, thePath));
+          GeomLib::ExtendSurfByLength(BndS, ExtendFirst, 1, Sweep.ExchangeUV(), false);
+          TabS(aSec, thePath) = BndS;
+        }
+        if ((thePath == NbPath) && (ExtendLast > 0))
+        {
+          occ::handle<Geom_BoundedSurface> BndS;
+          BndS = occ::down_cast<Geom_BoundedSurface>(TabS(aSec, thePath));
+          GeomLib::ExtendSurfByLength(BndS, ExtendLast, 1, Sweep.ExchangeUV(), true);
+          TabS(aSec, thePath) = BndS;
+        }
       }
+      IsPathDone(thePath) = true;
+    },
+    !isParallel);
 
+  for (ipath = 1, IPath = IFirst; ipath <= NbPath; ipath++, IPath++)
+  {
+    if (!IsPathDone(ipath))
+      return false;
+    for (isec = 1; isec <= NbLaw; isec++)
+    {
+      if (TabErr(isec, ipath) > Error)
+        Error = TabErr(isec, ipath);
 #ifdef DRAW
       if (Affich)
       {
@@ -76,6 +76,14 @@ public:
   //! to be C0.
   Standard_EXPORT void SetForceApproxC1(const bool ForceApproxC1);
 
+  //! Sets the flag to compute the surfaces along the edges of the path in parallel threads.
+  //! Only the location laws along the edges of the spine (BRepFill_Edge3DLaw)
+  //! with sections not depending on an evolution law are processed in parallel.
+  void SetRunParallel(const bool theIsParallel) { myIsParallel = theIsParallel; }
+
+  //! Returns the flag to compute the surfaces in parallel threads.
+  bool RunParallel() const { return myIsParallel; }
+
   //! Build the Sweep Surface
   //! Transition define Transition strategy
   //! Approx define Approximation Strategy
@@ -174,6 +182,7 @@ private:
   int                                                                      myDegmax;
   int                                                                      mySegmax;
   bool                                                                     myForceApproxC1;
+  bool                                                                     myIsParallel;
   TopoDS_Shape                                                             myShape;
   occ::handle<BRepFill_LocationLaw>                                        myLoc;
   occ::handle<BRepFill_SectionLaw>                                         mySec;
@@ -264,6 +264,13 @@ public:
   Standard_EXPORT void Build(
     const Message_ProgressRange& theRange = Message_ProgressRange()) override;
 
+  //! Sets the flag of parallel computation of the surfaces of the contours
+  //! (see ChFi3d_Builder::SetRunParallel()). The result does not depend on the flag.
+  void SetRunParallel(const bool theIsParallel) { myBuilder.SetRunParallel(theIsParallel); }
+
+  //! Returns the flag of parallel computation of the contours.
+  bool RunParallel() const { return myBuilder.RunParallel(); }
+
   //! Reinitializes this algorithm, thus canceling the effects of the Build function.
   //! This function allows modifications to be made to the
   //! contours and chamfer parameters in order to rebuild the shape.
@@ -203,6 +203,13 @@ public:
   //! Returns the type of fillet shape built by this algorithm.
   Standard_EXPORT ChFi3d_FilletShape GetFilletShape() const;
 
+  //! Sets the flag of parallel computation of the surfaces of the contours
+  //! (see ChFi3d_Builder::SetRunParallel()). The result does not depend on the flag.
+  void SetRunParallel(const bool theIsParallel) { myBuilder.SetRunParallel(theIsParallel); }
+
+  //! Returns the flag of parallel computation of the contours.
+  bool RunParallel() const { return myBuilder.RunParallel(); }
+
   //! Returns the number of contours generated using the
   //! Add function in the internal data structure of this algorithm.
   Standard_EXPORT int NbContours() const override;
@@ -36,7 +36,10 @@
 #include <Standard_Failure.hxx>
 #include <Standard_NotImplemented.hxx>
 #include <Standard_Integer.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_DataMap.hxx>
 #include <NCollection_Map.hxx>
+#include <OSD_ThreadPool.hxx>
 #include <TopAbs_ShapeEnum.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopoDS.hxx>
@@ -52,6 +55,11 @@
 #include <TopOpeBRepDS_HDataStructure.hxx>
 #include <TopOpeBRepDS_Interference.hxx>
 #include <TopOpeBRepDS_PointIterator.hxx>
+#include <TopTools_ShapeMapHasher.hxx>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
 
 #ifdef OCCT_DEBUG
   #include <OSD_Chronometer.hxx>
@@ -137,10 +145,77 @@ static void CompleteDS(TopOpeBRepDS_DataStructure& DStr, const TopoDS_Shape& S)
 
 //=================================================================================================
 
+static int RenumberIndex(const NCollection_Array1<int>& theNewIndices, const int theIndex)
+{
+  return theIndex >= theNewIndices.Lower() && theIndex <= theNewIndices.Upper()
+           ? theNewIndices(theIndex)
+           : theIndex;
+}
+
+//=======================================================================
+// function : AppendStripeDS
+// purpose  : Adds the shapes, surfaces and curves of the data structure
+//           in which the stripe has been computed to DStr and renumbers
+//           their indices in the stripe. The new indices of the surfaces
+//           are returned in theSurfIndices.
+//=======================================================================
+static void AppendStripeDS(const TopOpeBRepDS_DataStructure& theStripeDS,
+                           const occ::handle<ChFiDS_Stripe>& theStripe,
+                           TopOpeBRepDS_DataStructure&       DStr,
+                           NCollection_Array1<int>&          theSurfIndices)
+{
+  NCollection_Array1<int> aShapeIndices(0, theStripeDS.NbShapes());
+  aShapeIndices(0) = 0;
+  for (int i = 1; i <= theStripeDS.NbShapes(); i++)
+  {
+    aShapeIndices(i) = DStr.AddShape(theStripeDS.Shape(i, false));
+  }
+  theSurfIndices.Resize(0, theStripeDS.NbSurfaces(), false);
+  theSurfIndices(0) = 0;
+  for (int i = 1; i <= theStripeDS.NbSurfaces(); i++)
+  {
+    theSurfIndices(i) = DStr.AddSurface(theStripeDS.Surface(i));
+  }
+  NCollection_Array1<int> aCurveIndices(0, theStripeDS.NbCurves());
+  aCurveIndices(0) = 0;
+  for (int i = 1; i <= theStripeDS.NbCurves(); i++)
+  {
+    aCurveIndices(i) = DStr.AddCurve(theStripeDS.Curve(i));
+  }
+
+  theStripe->SetSolidIndex(RenumberIndex(aShapeIndices, theStripe->SolidIndex()));
+  NCollection_Sequence<occ::handle<ChFiDS_SurfData>>& aSeqSurf =
+    theStripe->ChangeSetOfSurfData()->ChangeSequence();
+  for (int i = 1; i <= aSeqSurf.Length(); i++)
+  {
+    const occ::handle<ChFiDS_SurfData>& aSD = aSeqSurf(i);
+    aSD->ChangeIndexOfS1(RenumberIndex(aShapeIndices, aSD->IndexOfS1()));
+    aSD->ChangeIndexOfS2(RenumberIndex(aShapeIndices, aSD->IndexOfS2()));
+    if (aSD->IsOnCurve1())
+      aSD->SetIndexOfC1(RenumberIndex(aShapeIndices, aSD->IndexOfC1()));
+    if (aSD->IsOnCurve2())
+      aSD->SetIndexOfC2(RenumberIndex(aShapeIndices, aSD->IndexOfC2()));
+    aSD->ChangeSurf(RenumberIndex(theSurfIndices, aSD->Surf()));
+    ChFiDS_FaceInterference& anIntf1 = aSD->ChangeInterferenceOnS1();
+    anIntf1.SetLineIndex(RenumberIndex(aCurveIndices, anIntf1.LineIndex()));
+    ChFiDS_FaceInterference& anIntf2 = aSD->ChangeInterferenceOnS2();
+    anIntf2.SetLineIndex(RenumberIndex(aCurveIndices, anIntf2.LineIndex()));
+  }
+}
+
+//=================================================================================================
+
 ChFi3d_Builder::~ChFi3d_Builder() = default;
 
 //=================================================================================================
 
+ChFi3d_Builder* ChFi3d_Builder::CopyBuilder() const
+{
+  return nullptr;
+}
+
+//=================================================================================================
+
 void ChFi3d_Builder::ExtentAnalyse()
 {
   int nbedges, nbs;
@@ -250,28 +325,31 @@ void ChFi3d_Builder::Compute()
 #endif
 
   // Construction of the stripe of fillet on each stripe.
-  for (itel.Initialize(myListStripe); itel.More(); itel.Next())
+  if (!myRunParallel || !PerformSetOfSurfParallel())
   {
-    itel.Value()->Spine()->SetErrorStatus(ChFiDS_Ok);
-    try
-    {
-      OCC_CATCH_SIGNALS
-      PerformSetOfSurf(itel.ChangeValue());
-    }
-    catch (Standard_Failure const& anException)
+    for (itel.Initialize(myListStripe); itel.More(); itel.Next())
     {
+      itel.Value()->Spine()->SetErrorStatus(ChFiDS_Ok);
+      try
+      {
+        OCC_CATCH_SIGNALS
+        PerformSetOfSurf(itel.ChangeValue());
+      }
+      catch (Standard_Failure const& anException)
+      {
 #ifdef OCCT_DEBUG
-      std::cout << "EXCEPTION Stripe compute " << anException << std::endl;
+        std::cout << "EXCEPTION Stripe compute " << anException << std::endl;
 #endif
-      (void)anException;
-      badstripes.Append(itel.Value());
+        (void)anException;
+        badstripes.Append(itel.Value());
+        done = true;
+        if (itel.Value()->Spine()->ErrorStatus() == ChFiDS_Ok)
+          itel.Value()->Spine()->SetErrorStatus(ChFiDS_Error);
+      }
+      if (!done)
+        badstripes.Append(itel.Value());
       done = true;
-      if (itel.Value()->Spine()->ErrorStatus() == ChFiDS_Ok)
-        itel.Value()->Spine()->SetErrorStatus(ChFiDS_Error);
     }
-    if (!done)
-      badstripes.Append(itel.Value());
-    done = true;
   }
   done = (badstripes.IsEmpty());
 
@@ -622,6 +700,125 @@ void ChFi3d_Builder::Compute()
   }
 }
 
+//=================================================================================================
+
+bool ChFi3d_Builder::PerformSetOfSurfParallel()
+{
+  const int aNbStripes = myListStripe.Extent();
+  if (aNbStripes < 2)
+  {
+    return false;
+  }
+
+  const occ::handle<OSD_ThreadPool>& aThreadPool = OSD_ThreadPool::DefaultPool();
+  OSD_ThreadPool::Launcher           aLauncher(*aThreadPool,
+                                     std::min(aNbStripes, aThreadPool->NbDefaultThreadsToLaunch()));
+  if (!aLauncher.HasThreads())
+  {
+    return false;
+  }
+
+  // each thread computes its stripes with its own copy of the builder
+  std::vector<std::unique_ptr<ChFi3d_Builder>> aBuilders(aLauncher.NbThreads());
+  for (std::unique_ptr<ChFi3d_Builder>& aBuilder : aBuilders)
+  {
+    aBuilder.reset(CopyBuilder());
+    if (!aBuilder)
+    {
+      return false;
+    }
+  }
+
+  // each stripe is computed in its own data structure, so that its shapes and
+  // geometries get the same indices in myDS as in the sequential computation
+  using EVIMap = NCollection_DataMap<TopoDS_Shape, NCollection_List<int>, TopTools_ShapeMapHasher>;
+  NCollection_Array1<occ::handle<ChFiDS_Stripe>>               aStripes(1, aNbStripes);
+  NCollection_Array1<occ::handle<TopOpeBRepDS_HDataStructure>> aStripeDS(1, aNbStripes);
+  NCollection_Array1<EVIMap>                                   aStripeEVIMap(1, aNbStripes);
+  NCollection_Array1<bool>                                     isComputed(1, aNbStripes);
+  NCollection_Array1<bool>                                     isDone(1, aNbStripes);
+  int                                                          anIndex = 1;
+  for (NCollection_List<occ::handle<ChFiDS_Stripe>>::Iterator itel(myListStripe); itel.More();
+       itel.Next(), anIndex++)
+  {
+    aStripes(anIndex) = itel.Value();
+  }
+
+  aLauncher.Perform(1, aNbStripes + 1, [&](const int theThreadIndex, const int theIndex) {
+    ChFi3d_Builder&             aBuilder = *aBuilders[theThreadIndex];
+    occ::handle<ChFiDS_Stripe>& aStripe  = aStripes(theIndex);
+    aBuilder.myDS                        = new TopOpeBRepDS_HDataStructure();
+    aBuilder.myEVIMap.Clear();
+    aBuilder.done        = true;
+    isComputed(theIndex) = false;
+    aStripe->Spine()->SetErrorStatus(ChFiDS_Ok);
+    try
+    {
+      OCC_CATCH_SIGNALS
+      aBuilder.PerformStripeSurf(aStripe, false);
+      isComputed(theIndex) = true;
+    }
+    catch (Standard_Failure const& anException)
+    {
+#ifdef OCCT_DEBUG
+      std::cout << "EXCEPTION Stripe compute " << anException << std::endl;
+#endif
+      (void)anException;
+      if (aStripe->Spine()->ErrorStatus() == ChFiDS_Ok)
+        aStripe->Spine()->SetErrorStatus(ChFiDS_Error);
+    }
+    isDone(theIndex)    = aBuilder.done;
+    aStripeDS(theIndex) = aBuilder.myDS;
+    aStripeEVIMap(theIndex).Exchange(aBuilder.myEVIMap);
+  });
+
+  // the stripes are added to myDS in their order, their extremities are
+  // computed after that as they add curves and points to myDS
+  TopOpeBRepDS_DataStructure& DStr = myDS->ChangeDS();
+  NCollection_Array1<int>     aSurfIndices(0, 0);
+  for (int i = 1; i <= aNbStripes; i++)
+  {
+    occ::handle<ChFiDS_Stripe>& aStripe = aStripes(i);
+    AppendStripeDS(aStripeDS(i)->DS(), aStripe, DStr, aSurfIndices);
+    for (EVIMap::Iterator anIt(aStripeEVIMap(i)); anIt.More(); anIt.Next())
+    {
+      NCollection_List<int>* aSurfList = myEVIMap.ChangeSeek(anIt.Key());
+      if (aSurfList == nullptr)
+      {
+        aSurfList = myEVIMap.Bound(anIt.Key(), NCollection_List<int>());
+      }
+      for (NCollection_List<int>::Iterator aSurfIt(anIt.Value()); aSurfIt.More(); aSurfIt.Next())
+      {
+        aSurfList->Append(RenumberIndex(aSurfIndices, aSurfIt.Value()));
+      }
+    }
+
+    bool isOk = isComputed(i);
+    if (isOk)
+    {
+      try
+      {
+        OCC_CATCH_SIGNALS
+        PerformStripeExtremities(aStripe);
+      }
+      catch (Standard_Failure const& anException)
+      {
+#ifdef OCCT_DEBUG
+        std::cout << "EXCEPTION Stripe compute " << anException << std::endl;
+#endif
+        (void)anException;
+        isOk = false;
+        if (aStripe->Spine()->ErrorStatus() == ChFiDS_Ok)
+          aStripe->Spine()->SetErrorStatus(ChFiDS_Error);
+      }
+    }
+    if (!isOk || !isDone(i))
+      badstripes.Append(aStripe);
+  }
+  done = true;
+  return true;
+}
+
 //=======================================================================
 // function : PerformSingularCorner
 // purpose  : Load vertex and degenerated edges.
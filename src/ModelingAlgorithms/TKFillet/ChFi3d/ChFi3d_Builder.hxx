@@ -126,6 +126,15 @@ public:
   //! returns true if the contour of index IC is closed
   Standard_EXPORT bool Closed(const int IC) const;
 
+  //! Sets the flag of parallel computation of the surfaces of the contours
+  //! in Compute(). The corners and the topologic reconstruction are always
+  //! computed sequentially. The result does not depend on the flag.
+  //! By default the contours are computed sequentially.
+  void SetRunParallel(const bool theIsParallel) { myRunParallel = theIsParallel; }
+
+  //! Returns the flag of parallel computation of the contours.
+  bool RunParallel() const { return myRunParallel; }
+
   //! general calculation of geometry on all edges,
   //! topologic reconstruction.
   Standard_EXPORT void Compute();
@@ -198,6 +207,13 @@ public:
 protected:
   Standard_EXPORT ChFi3d_Builder(const TopoDS_Shape& S, const double Ta);
 
+  //! Returns a new copy of the builder used to compute the surfaces of
+  //! the contours in a separate thread, or NULL if the builder does not
+  //! support it (default); the caller takes the ownership of the copy.
+  //! The classes redefining the computation of the surfaces should
+  //! redefine this method as well.
+  Standard_EXPORT virtual ChFi3d_Builder* CopyBuilder() const;
+
   Standard_EXPORT virtual void SimulKPart(const occ::handle<ChFiDS_SurfData>& SD) const = 0;
 
   Standard_EXPORT virtual bool SimulSurf(occ::handle<ChFiDS_SurfData>&           Data,
@@ -773,6 +789,19 @@ private:
                                                  occ::handle<BRepTopAdaptor_TopolTool>& It2,
                                                  const bool Simul = false);
 
+  //! Computes the surfaces of the stripe, without the curves and points
+  //! of its free or periodic extremities.
+  Standard_EXPORT void PerformStripeSurf(occ::handle<ChFiDS_Stripe>& S, const bool Simul);
+
+  //! Computes the curves and points of the free or periodic extremities of the stripe.
+  Standard_EXPORT void PerformStripeExtremities(occ::handle<ChFiDS_Stripe>& S);
+
+  //! Computes the surfaces of the stripes in parallel threads, each stripe in
+  //! its own data structure, then adds them to myDS in the order of the stripes.
+  //! Returns false if nothing has been done, the stripes being then computed
+  //! sequentially.
+  Standard_EXPORT bool PerformSetOfSurfParallel();
+
   Standard_EXPORT void PerformFilletOnVertex(const int Index);
 
   Standard_EXPORT void PerformSingularCorner(const int Index);
@@ -843,6 +872,7 @@ private:
   NCollection_List<TopoDS_Shape> myGenerated;
   TopoDS_Shape                   myShapeResult;
   TopoDS_Shape                   badShape;
+  bool                           myRunParallel;
 };
 
 #endif // _ChFi3d_Builder_HeaderFile
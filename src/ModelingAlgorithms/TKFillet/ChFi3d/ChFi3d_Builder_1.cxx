@@ -313,7 +313,8 @@ static TopOpeBRepDS_BuildTool mkbuildtool()
 
 ChFi3d_Builder::ChFi3d_Builder(const TopoDS_Shape& S, const double Ta)
     : done(false),
-      myShape(S)
+      myShape(S),
+      myRunParallel(false)
 {
   myDS   = new TopOpeBRepDS_HDataStructure();
   myCoup = new TopOpeBRepBuild_HBuilder(mkbuildtool());
@@ -3627,6 +3627,16 @@ void ChFi3d_Builder::PerformSetOfKGen(occ::handle<ChFiDS_Stripe>& Stripe, const
 //=================================================================================================
 
 void ChFi3d_Builder::PerformSetOfSurf(occ::handle<ChFiDS_Stripe>& Stripe, const bool Simul)
+{
+  PerformStripeSurf(Stripe, Simul);
+
+  if (!Simul)
+    PerformStripeExtremities(Stripe);
+}
+
+//=================================================================================================
+
+void ChFi3d_Builder::PerformStripeSurf(occ::handle<ChFiDS_Stripe>& Stripe, const bool Simul)
 {
   TopOpeBRepDS_DataStructure& DStr = myDS->ChangeDS();
 
@@ -3637,7 +3647,11 @@ void ChFi3d_Builder::PerformSetOfSurf(occ::handle<ChFiDS_Stripe>& Stripe, const
     PerformSetOfKPart(Stripe, Simul);
 
   PerformSetOfKGen(Stripe, Simul);
+}
 
-  if (!Simul)
-    ChFi3d_MakeExtremities(Stripe, DStr, myEFMap, tolapp3d, tol2d);
+//=================================================================================================
+
+void ChFi3d_Builder::PerformStripeExtremities(occ::handle<ChFiDS_Stripe>& Stripe)
+{
+  ChFi3d_MakeExtremities(Stripe, myDS->ChangeDS(), myEFMap, tolapp3d, tol2d);
 }
@@ -184,6 +184,13 @@ ChFi3d_ChBuilder::ChFi3d_ChBuilder(const TopoDS_Shape& S, const double Ta)
   myMode = ChFiDS_ClassicChamfer;
 }
 
+//=================================================================================================
+
+ChFi3d_Builder* ChFi3d_ChBuilder::CopyBuilder() const
+{
+  return new ChFi3d_ChBuilder(*this);
+}
+
 //=======================================================================
 // function : Add
 // purpose  : create a new stripe with a spine containing the edge <E>
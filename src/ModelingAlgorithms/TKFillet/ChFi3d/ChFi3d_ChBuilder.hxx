@@ -400,6 +400,9 @@ protected:
   //! set the regularities
   Standard_EXPORT void SetRegul() override;
 
+  //! Returns a copy of the builder for the parallel computation of the contours.
+  Standard_EXPORT ChFi3d_Builder* CopyBuilder() const override;
+
 private:
   Standard_EXPORT void ConexFaces(const occ::handle<ChFiDS_Spine>& Sp,
                                   const int                        IEdge,
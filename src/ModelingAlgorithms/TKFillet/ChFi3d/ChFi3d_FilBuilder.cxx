@@ -146,6 +146,13 @@ ChFi3d_FilBuilder::ChFi3d_FilBuilder(const TopoDS_Shape&      S,
 
 //=================================================================================================
 
+ChFi3d_Builder* ChFi3d_FilBuilder::CopyBuilder() const
+{
+  return new ChFi3d_FilBuilder(*this);
+}
+
+//=================================================================================================
+
 void ChFi3d_FilBuilder::SetFilletShape(const ChFi3d_FilletShape FShape)
 {
   switch (FShape)
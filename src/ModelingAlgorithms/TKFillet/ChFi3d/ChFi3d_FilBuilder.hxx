@@ -373,6 +373,9 @@ protected:
 
   Standard_EXPORT void SetRegul() override;
 
+  //! Returns a copy of the builder for the parallel computation of the contours.
+  Standard_EXPORT ChFi3d_Builder* CopyBuilder() const override;
+
 private:
   BlendFunc_SectionShape myShape;
 };
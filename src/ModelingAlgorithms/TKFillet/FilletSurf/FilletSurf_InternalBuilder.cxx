@@ -163,6 +163,13 @@ FilletSurf_InternalBuilder::FilletSurf_InternalBuilder(const TopoDS_Shape&
   SetContinuity(GeomAbs_C2, Ta);
 }
 
+//=================================================================================================
+
+ChFi3d_Builder* FilletSurf_InternalBuilder::CopyBuilder() const
+{
+  return new FilletSurf_InternalBuilder(*this);
+}
+
 //=======================================================================
 // function : Add
 // purpose  : creation of spine on a set of edges
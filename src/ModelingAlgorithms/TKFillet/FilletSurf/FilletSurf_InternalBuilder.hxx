@@ -223,6 +223,9 @@ protected:
                                    const bool                                          RecP2,
                                    const bool                                          RecRst2,
                                    const math_Vector& Soldep) override;
+
+  //! Returns a copy of the builder for the parallel computation of the contours.
+  Standard_EXPORT ChFi3d_Builder* CopyBuilder() const override;
 };
 
 #endif // _FilletSurf_InternalBuilder_HeaderFile
@@ -0,0 +1,105 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <gtest/gtest.h>
+
+#include <BRepCheck_Analyzer.hxx>
+#include <BRepFilletAPI_MakeChamfer.hxx>
+#include <BRepFilletAPI_MakeFillet.hxx>
+#include <BRepGProp.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <GProp_GProps.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Shape.hxx>
+
+namespace
+{
+//! Returns the number of sub-shapes of the given type.
+int nbSubShapes(const TopoDS_Shape& theShape, const TopAbs_ShapeEnum theType)
+{
+  int aNb = 0;
+  for (TopExp_Explorer anExp(theShape, theType); anExp.More(); anExp.Next())
+  {
+    ++aNb;
+  }
+  return aNb;
+}
+
+//! Rounds all edges of the shape.
+TopoDS_Shape makeFillet(const TopoDS_Shape& theShape,
+                        const double        theRadius,
+                        const bool          theIsParallel)
+{
+  BRepFilletAPI_MakeFillet aFillet(theShape);
+  aFillet.SetRunParallel(theIsParallel);
+  for (TopExp_Explorer anExp(theShape, TopAbs_EDGE); anExp.More(); anExp.Next())
+  {
+    aFillet.Add(theRadius, TopoDS::Edge(anExp.Current()));
+  }
+  aFillet.Build();
+  return aFillet.IsDone() ? aFillet.Shape() : TopoDS_Shape();
+}
+
+//! Chamfers all edges of the shape.
+TopoDS_Shape makeChamfer(const TopoDS_Shape& theShape,
+                         const double        theDist,
+                         const bool          theIsParallel)
+{
+  BRepFilletAPI_MakeChamfer aChamfer(theShape);
+  aChamfer.SetRunParallel(theIsParallel);
+  for (TopExp_Explorer anExp(theShape, TopAbs_EDGE); anExp.More(); anExp.Next())
+  {
+    aChamfer.Add(theDist, TopoDS::Edge(anExp.Current()));
+  }
+  aChamfer.Build();
+  return aChamfer.IsDone() ? aChamfer.Shape() : TopoDS_Shape();
+}
+
+//! Checks that both shapes are valid and have the same volume and the same
+//! number of faces, edges and vertices.
+void checkSameResult(const TopoDS_Shape& theShape1, const TopoDS_Shape& theShape2)
+{
+  ASSERT_FALSE(theShape1.IsNull());
+  ASSERT_FALSE(theShape2.IsNull());
+  EXPECT_TRUE(BRepCheck_Analyzer(theShape1).IsValid());
+  EXPECT_TRUE(BRepCheck_Analyzer(theShape2).IsValid());
+
+  GProp_GProps aProps1, aProps2;
+  BRepGProp::VolumeProperties(theShape1, aProps1);
+  BRepGProp::VolumeProperties(theShape2, aProps2);
+  EXPECT_NEAR(aProps1.Mass(), aProps2.Mass(), 1.e-7);
+
+  EXPECT_EQ(nbSubShapes(theShape1, TopAbs_FACE), nbSubShapes(theShape2, TopAbs_FACE));
+  EXPECT_EQ(nbSubShapes(theShape1, TopAbs_EDGE), nbSubShapes(theShape2, TopAbs_EDGE));
+  EXPECT_EQ(nbSubShapes(theShape1, TopAbs_VERTEX), nbSubShapes(theShape2, TopAbs_VERTEX));
+}
+} // namespace
+
+TEST(BRepFilletAPI_MakeFillet_Test, ParallelContoursGiveSameResult)
+{
+  const TopoDS_Shape aBox = BRepPrimAPI_MakeBox(10., 20., 30.).Shape();
+
+  const TopoDS_Shape aSequential = makeFillet(aBox, 2., false);
+  const TopoDS_Shape aParallel   = makeFillet(aBox, 2., true);
+  checkSameResult(aSequential, aParallel);
+}
+
+TEST(BRepFilletAPI_MakeChamfer_Test, ParallelContoursGiveSameResult)
+{
+  const TopoDS_Shape aBox = BRepPrimAPI_MakeBox(10., 20., 30.).Shape();
+
+  const TopoDS_Shape aSequential = makeChamfer(aBox, 1.5, false);
+  const TopoDS_Shape aParallel   = makeChamfer(aBox, 1.5, true);
+  checkSameResult(aSequential, aParallel);
+}
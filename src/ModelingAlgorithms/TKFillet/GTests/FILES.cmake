@@ -2,4 +2,5 @@
 set(OCCT_TKFillet_GTests_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
 
 set(OCCT_TKFillet_GTests_FILES
+  BRepFilletAPI_MakeFillet_Test.cxx
 )
@@ -4,6 +4,8 @@ set(OCCT_TKGeomAlgo_GTests_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
 set(OCCT_TKGeomAlgo_GTests_FILES
   Geom2dAPI_InterCurveCurve_Test.cxx
   Geom2dGcc_Circ2d3Tan_Test.cxx
+  Geom2dHatch_Hatcher_Test.cxx
   GeomFill_CorrectedFrenet_Test.cxx
   GeomPlate_BuildPlateSurface_Test.cxx
+  IntPolyh_Intersection_Test.cxx
 )
\ No newline at end of file
@@ -0,0 +1,96 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <Geom2d_Line.hxx>
+#include <Geom2d_TrimmedCurve.hxx>
+#include <Geom2dAdaptor_Curve.hxx>
+#include <Geom2dHatch_Hatcher.hxx>
+#include <Geom2dHatch_Intersector.hxx>
+#include <HatchGen_Domain.hxx>
+#include <Precision.hxx>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+//! Returns the segment between two points.
+Geom2dAdaptor_Curve makeSegment(const gp_Pnt2d& theFirst, const gp_Pnt2d& theLast)
+{
+  occ::handle<Geom2d_Line> aLine = new Geom2d_Line(theFirst, gp_Dir2d(theLast.XY() - theFirst.XY()));
+  return Geom2dAdaptor_Curve(new Geom2d_TrimmedCurve(aLine, 0.0, theFirst.Distance(theLast)));
+}
+
+//! Adds the square contour with the given corners to the hatcher.
+void addSquare(Geom2dHatch_Hatcher& theHatcher,
+               const double         theMin,
+               const double         theMax,
+               const bool           theIsHole)
+{
+  gp_Pnt2d aCorners[4] = {gp_Pnt2d(theMin, theMin),
+                          gp_Pnt2d(theMax, theMin),
+                          gp_Pnt2d(theMax, theMax),
+                          gp_Pnt2d(theMin, theMax)};
+  for (int aCornerIter = 0; aCornerIter < 4; ++aCornerIter)
+  {
+    theHatcher.AddElement(makeSegment(aCorners[aCornerIter], aCorners[(aCornerIter + 1) % 4]),
+                          theIsHole ? TopAbs_REVERSED : TopAbs_FORWARD);
+  }
+}
+
+//! Adds the horizontal hatching from X = -1 to X = 11.
+int addHatching(Geom2dHatch_Hatcher& theHatcher, const double theY)
+{
+  return theHatcher.AddHatching(makeSegment(gp_Pnt2d(-1.0, theY), gp_Pnt2d(11.0, theY)));
+}
+} // namespace
+
+TEST(Geom2dHatch_HatcherTest, IncrementalHatchings)
+{
+  Geom2dHatch_Hatcher aHatcher(Geom2dHatch_Intersector(Precision::PConfusion(),
+                                                       Precision::PConfusion()),
+                               1.0e-8,
+                               1.0e-8,
+                               true,
+                               true);
+  addSquare(aHatcher, 0.0, 10.0, false);
+
+  const int aFirst = addHatching(aHatcher, 5.0);
+  aHatcher.Trim();
+  aHatcher.ComputeDomains();
+  ASSERT_TRUE(aHatcher.IsDone(aFirst));
+  ASSERT_EQ(1, aHatcher.NbDomains(aFirst));
+  EXPECT_NEAR(1.0, aHatcher.Domain(aFirst, 1).FirstPoint().Parameter(), 1.0e-7);
+  EXPECT_NEAR(11.0, aHatcher.Domain(aFirst, 1).SecondPoint().Parameter(), 1.0e-7);
+
+  // the added hatching is computed, the computed one is kept
+  const int aSecond = addHatching(aHatcher, 2.0);
+  EXPECT_FALSE(aHatcher.TrimDone(aSecond));
+  aHatcher.Trim();
+  EXPECT_TRUE(aHatcher.TrimDone(aFirst));
+  EXPECT_TRUE(aHatcher.IsDone(aFirst));
+  aHatcher.ComputeDomains();
+  ASSERT_TRUE(aHatcher.IsDone());
+  EXPECT_EQ(1, aHatcher.NbDomains(aFirst));
+  EXPECT_EQ(1, aHatcher.NbDomains(aSecond));
+
+  // new elements invalidate all hatchings
+  addSquare(aHatcher, 4.0, 6.0, true);
+  EXPECT_FALSE(aHatcher.TrimDone(aFirst));
+  EXPECT_FALSE(aHatcher.TrimDone(aSecond));
+  aHatcher.Trim();
+  aHatcher.ComputeDomains();
+  ASSERT_TRUE(aHatcher.IsDone());
+  EXPECT_EQ(2, aHatcher.NbDomains(aFirst));
+  EXPECT_EQ(1, aHatcher.NbDomains(aSecond));
+}
@@ -0,0 +1,119 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <GeomAdaptor_Surface.hxx>
+#include <Geom_CylindricalSurface.hxx>
+#include <Geom_SphericalSurface.hxx>
+#include <IntPolyh_Intersection.hxx>
+#include <IntPolyh_SamplingCache.hxx>
+#include <gp_Ax3.hxx>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+//! Create bounded cylinder along Z axis.
+occ::handle<GeomAdaptor_Surface> createCylinder()
+{
+  occ::handle<Geom_CylindricalSurface> aCylinder = new Geom_CylindricalSurface(gp_Ax3(), 10.0);
+  return new GeomAdaptor_Surface(aCylinder, 0.0, 2.0 * M_PI, -20.0, 20.0);
+}
+
+//! Create sphere crossing the cylinder.
+occ::handle<GeomAdaptor_Surface> createSphere()
+{
+  occ::handle<Geom_SphericalSurface> aSphere =
+    new Geom_SphericalSurface(gp_Ax3(gp_Pnt(10.0, 0.0, 0.0), gp::DZ()), 5.0);
+  return new GeomAdaptor_Surface(aSphere);
+}
+
+//! Get coordinates, parameters and incidence of the point in section line.
+void getLinePoint(const IntPolyh_Intersection& theInt,
+                  const int                    theLine,
+                  const int                    thePnt,
+                  double                       theData[8])
+{
+  theInt.GetLinePoint(theLine,
+                      thePnt,
+                      theData[0],
+                      theData[1],
+                      theData[2],
+                      theData[3],
+                      theData[4],
+                      theData[5],
+                      theData[6],
+                      theData[7]);
+}
+
+//! Check that intersections have the same section lines.
+void checkSameLines(const IntPolyh_Intersection& theInt1, const IntPolyh_Intersection& theInt2)
+{
+  ASSERT_TRUE(theInt1.IsDone());
+  ASSERT_TRUE(theInt2.IsDone());
+  ASSERT_EQ(theInt1.NbSectionLines(), theInt2.NbSectionLines());
+  ASSERT_EQ(theInt1.NbTangentZones(), theInt2.NbTangentZones());
+  for (int aLineIter = 1; aLineIter <= theInt1.NbSectionLines(); ++aLineIter)
+  {
+    ASSERT_EQ(theInt1.NbPointsInLine(aLineIter), theInt2.NbPointsInLine(aLineIter));
+    for (int aPntIter = 1; aPntIter <= theInt1.NbPointsInLine(aLineIter); ++aPntIter)
+    {
+      double aP1[8], aP2[8];
+      getLinePoint(theInt1, aLineIter, aPntIter, aP1);
+      getLinePoint(theInt2, aLineIter, aPntIter, aP2);
+      for (int aCoordIter = 0; aCoordIter < 8; ++aCoordIter)
+      {
+        EXPECT_EQ(aP1[aCoordIter], aP2[aCoordIter])
+          << "line " << aLineIter << ", point " << aPntIter;
+      }
+    }
+  }
+}
+} // namespace
+
+TEST(IntPolyh_IntersectionTest, SamplingCacheKeepsResult)
+{
+  const occ::handle<GeomAdaptor_Surface> aCylinder = createCylinder();
+  const occ::handle<GeomAdaptor_Surface> aSphere   = createSphere();
+
+  const IntPolyh_Intersection aRefInt(aCylinder, 40, 40, aSphere, 30, 30);
+  ASSERT_TRUE(aRefInt.IsDone());
+  EXPECT_GT(aRefInt.NbSectionLines(), 0);
+
+  occ::handle<IntPolyh_SamplingCache> aCache = new IntPolyh_SamplingCache();
+  const IntPolyh_Intersection         aCachedInt(aCylinder, 40, 40, aSphere, 30, 30, aCache);
+  EXPECT_EQ(size_t(0), aCache->NbHits());
+  EXPECT_EQ(size_t(2), aCache->NbMisses());
+  EXPECT_EQ(2, aCache->NbEntries());
+  checkSameLines(aRefInt, aCachedInt);
+
+  // the copy of the same geometry should reuse the sampling
+  const occ::handle<GeomAdaptor_Surface> aCylinderCopy =
+    new GeomAdaptor_Surface(occ::down_cast<Geom_Surface>(aCylinder->Surface()->Copy()),
+                            0.0,
+                            2.0 * M_PI,
+                            -20.0,
+                            20.0);
+  const IntPolyh_Intersection aCopyInt(aCylinderCopy, 40, 40, aSphere, 30, 30, aCache);
+  EXPECT_EQ(size_t(2), aCache->NbHits());
+  EXPECT_EQ(2, aCache->NbEntries());
+  checkSameLines(aRefInt, aCopyInt);
+
+  // another sampling should not match cached one
+  const IntPolyh_Intersection aDenseInt(aCylinder, 50, 50, aSphere, 30, 30, aCache);
+  EXPECT_EQ(size_t(3), aCache->NbHits());
+  EXPECT_EQ(3, aCache->NbEntries());
+
+  aCache->Clear();
+  EXPECT_EQ(0, aCache->NbEntries());
+  EXPECT_EQ(size_t(0), aCache->NbHits());
+}
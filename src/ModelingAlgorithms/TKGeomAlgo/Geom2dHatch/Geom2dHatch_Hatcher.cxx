@@ -206,7 +206,8 @@ void Geom2dHatch_Hatcher::RemElement(const int IndE)
         if (PntH.NbPoints() == 0)
           Hatching.RemPoint(IPntH);
       }
-      if (DomainsToClear)
+      // domain of hatching without intersections depends on classification by all elements
+      if (DomainsToClear || Hatching.NbPoints() == 0)
         Hatching.ClrDomains();
     }
   }
@@ -314,13 +315,14 @@ void Geom2dHatch_Hatcher::ClrHatchings()
 //=======================================================================
 // Function : Trim
 // Purpose  : Trims all the hatchings of the hatcher by all the elements
-//            of the hatcher.
+//            of the hatcher. The hatchings already trimmed by the
+//            current elements are kept.
 //=======================================================================
 
 void Geom2dHatch_Hatcher::Trim()
 {
   for (int IndH = 1; IndH <= myNbHatchings; IndH++)
-    if (myHatchings.IsBound(IndH))
+    if (myHatchings.IsBound(IndH) && !myHatchings.Find(IndH).TrimDone())
       Trim(IndH);
 }
 
@@ -1088,12 +1090,13 @@ bool Geom2dHatch_Hatcher::GlobalTransition(HatchGen_PointOnHatching& Point)
 //=======================================================================
 // Function : ComputeDomains
 // Purpose  : Computes the domains of all the hatchings.
+//            The domains which are already computed are kept.
 //=======================================================================
 
 void Geom2dHatch_Hatcher::ComputeDomains()
 {
   for (int IndH = 1; IndH <= myNbHatchings; IndH++)
-    if (myHatchings.IsBound(IndH))
+    if (myHatchings.IsBound(IndH) && !myHatchings.Find(IndH).IsDone())
       ComputeDomains(IndH);
 }
 
@@ -131,6 +131,10 @@ public:
 
   //! Trims all the hatchings of the hatcher by all the
   //! elements of the hatcher.
+  //! The hatchings already trimmed are not recomputed, unless the elements or
+  //! the parameters of the hatcher have been changed since, so that the hatcher
+  //! kept for the same elements (e.g. for the face of the section) recomputes
+  //! only the hatchings added after the previous call.
   Standard_EXPORT void Trim();
 
   //! Adds a hatching to the hatcher and trims it by
@@ -142,6 +146,7 @@ public:
   Standard_EXPORT void Trim(const int IndH);
 
   //! Computes the domains of all the hatchings.
+  //! The domains already computed are kept, see Trim().
   Standard_EXPORT void ComputeDomains();
 
   //! Computes the domains of the IndH-th hatching.
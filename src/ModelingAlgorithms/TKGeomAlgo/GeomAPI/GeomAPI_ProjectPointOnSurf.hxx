@@ -130,6 +130,14 @@ public:
   //! By default the Extrema is set to search the MinMax solutions.
   void SetExtremaFlag(const Extrema_ExtFlag theExtFlag) { myExtPS.SetFlag(theExtFlag); }
 
+  //! Sets the cache of the sampling grids shared with other projectors (may be NULL),
+  //! so that the projectors on the same surface and range sample it once.
+  //! Should be set before the Init() methods with a point, which perform the projection.
+  void SetGridCache(const occ::handle<Extrema_GenExtPSCache>& theCache)
+  {
+    myExtPS.SetGridCache(theCache);
+  }
+
   //! Performs the projection of a point on the current surface.
   Standard_EXPORT void Perform(const gp_Pnt& P);
 
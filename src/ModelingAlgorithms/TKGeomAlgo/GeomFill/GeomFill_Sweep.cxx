@@ -127,6 +127,7 @@ void GeomFill_Sweep::SetDomain(const double LocFirst,
   Last   = LocLast;
   SFirst = SectionFirst;
   SLast  = SectionLast;
+  myLocCache.Clear();
 }
 
 //=================================================================================================
@@ -249,6 +250,7 @@ bool GeomFill_Sweep::BuildAll(const GeomAbs_Shape Continuity, const int Degmax,
 
   occ::handle<GeomFill_SweepFunction> Func =
     new (GeomFill_SweepFunction)(mySec, myLoc, First, SFirst, (SLast - SFirst) / (Last - First));
+  Func->SetLocationCache(&myLocCache);
   Approx_SweepApproximation Approx(Func);
 
   Approx.Perform(First, Last, Tol3d, BoundTol, Tol2d, TolAngular, Continuity, Degmax, Segmax);
@@ -27,6 +27,7 @@
 #include <NCollection_Array2.hxx>
 #include <NCollection_HArray2.hxx>
 #include <GeomFill_ApproxStyle.hxx>
+#include <GeomFill_SweepFunction.hxx>
 #include <GeomAbs_Shape.hxx>
 #include <Standard_Integer.hxx>
 class GeomFill_LocationLaw;
@@ -35,6 +36,10 @@ class Geom_Surface;
 class Geom2d_Curve;
 
 //! Geometrical Sweep Algorithm
+//!
+//! The evaluations of the location law are cached between the calls of Build(),
+//! so that sweeping several sections along the same location law evaluates it
+//! once per parameter of the approximation.
 class GeomFill_Sweep
 {
 public:
@@ -156,6 +161,7 @@ private:
   double                                                      SError;
   bool                                                        myForceApproxC1;
   occ::handle<GeomFill_LocationLaw>                           myLoc;
+  GeomFill_SweepFunction::LocationCache                       myLocCache;
   occ::handle<GeomFill_SectionLaw>                            mySec;
   occ::handle<Geom_Surface>                                   mySurface;
   occ::handle<NCollection_HArray1<occ::handle<Geom2d_Curve>>> myCurve2d;
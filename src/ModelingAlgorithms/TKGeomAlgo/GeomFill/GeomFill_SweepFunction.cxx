@@ -38,6 +38,10 @@ GeomFill_SweepFunction::GeomFill_SweepFunction(const occ::handle<GeomFill_Sectio
                                                const double FirstParameter,
                                                const double FirstParameterOnS,
                                                const double RatioParameterOnS)
+    : myLocCache(nullptr),
+      myLocFirst(0.0),
+      myLocLast(0.0),
+      myHasLocInterval(false)
 {
   myLoc   = Location;
   mySec   = Section;
@@ -60,9 +64,13 @@ bool GeomFill_SweepFunction::D0(const double Param,
   double T = myfOnS + (Param - myf) * myRatio;
   L        = Poles.Length();
 
-  Ok = myLoc->D0(Param, M, V, Poles2d);
-  if (!Ok)
-    return Ok;
+  if (!findLocation(Param, 0))
+  {
+    Ok = myLoc->D0(Param, M, V, Poles2d);
+    if (!Ok)
+      return Ok;
+    storeLocation(Param, 0);
+  }
   Ok = mySec->D0(T, Poles, Weigths);
   if (!Ok)
     return Ok;
@@ -94,9 +102,13 @@ bool GeomFill_SweepFunction::D1(const double Param,
   gp_XYZ PPrim;
   L = Poles.Length();
 
-  Ok = myLoc->D1(Param, M, V, DM, DV, Poles2d, DPoles2d);
-  if (!Ok)
-    return Ok;
+  if (!findLocation(Param, 1))
+  {
+    Ok = myLoc->D1(Param, M, V, DM, DV, Poles2d, DPoles2d);
+    if (!Ok)
+      return Ok;
+    storeLocation(Param, 1);
+  }
   Ok = mySec->D1(T, Poles, DPoles, Weigths, DWeigths);
   if (!Ok)
     return Ok;
@@ -139,9 +151,13 @@ bool GeomFill_SweepFunction::D2(const double Param,
   double squareratio = myRatio * myRatio;
   L                  = Poles.Length();
 
-  Ok = myLoc->D2(Param, M, V, DM, DV, D2M, D2V, Poles2d, DPoles2d, D2Poles2d);
-  if (!Ok)
-    return Ok;
+  if (!findLocation(Param, 2))
+  {
+    Ok = myLoc->D2(Param, M, V, DM, DV, D2M, D2V, Poles2d, DPoles2d, D2Poles2d);
+    if (!Ok)
+      return Ok;
+    storeLocation(Param, 2);
+  }
   Ok = mySec->D2(T, Poles, DPoles, D2Poles, Weigths, DWeigths, D2Weigths);
   if (!Ok)
     return Ok;
@@ -291,6 +307,9 @@ void GeomFill_SweepFunction::SetInterval(const double First, const double Last)
 {
   double uf, ul;
   myLoc->SetInterval(First, Last);
+  myLocFirst       = First;
+  myLocLast        = Last;
+  myHasLocInterval = true;
   uf = myf + (First - myf) * myRatio;
   ul = myf + (Last - myf) * myRatio;
   mySec->SetInterval(uf, ul);
@@ -355,3 +374,77 @@ void GeomFill_SweepFunction::GetMinimalWeight(NCollection_Array1<double>& Weigth
 {
   mySec->GetMinimalWeight(Weigths);
 }
+
+//=================================================================================================
+
+void GeomFill_SweepFunction::SetLocationCache(LocationCache* theCache)
+{
+  myLocCache = (theCache != nullptr && myLoc->Nb2dCurves() == 0) ? theCache : nullptr;
+}
+
+//=================================================================================================
+
+bool GeomFill_SweepFunction::findLocation(const double theParam, const int theOrder)
+{
+  // derivatives at the bounds depend on the interval of the location law,
+  // so that the evaluations are reused only within the same interval
+  if (myLocCache == nullptr || !myHasLocInterval)
+  {
+    return false;
+  }
+
+  const LocationValue* aValue = myLocCache->Seek(theParam);
+  if (aValue == nullptr || aValue->Order < theOrder || aValue->First != myLocFirst
+      || aValue->Last != myLocLast)
+  {
+    return false;
+  }
+
+  M = aValue->M;
+  V = aValue->V;
+  if (theOrder >= 1)
+  {
+    DM = aValue->DM;
+    DV = aValue->DV;
+  }
+  if (theOrder >= 2)
+  {
+    D2M = aValue->D2M;
+    D2V = aValue->D2V;
+  }
+  return true;
+}
+
+//=================================================================================================
+
+void GeomFill_SweepFunction::storeLocation(const double theParam, const int theOrder)
+{
+  // the cache is bounded to keep the memory footprint of long sweeps moderate
+  constexpr int THE_MAX_CACHED = 1 << 16;
+  if (myLocCache == nullptr || !myHasLocInterval)
+  {
+    return;
+  }
+  if (myLocCache->Extent() >= THE_MAX_CACHED)
+  {
+    myLocCache->Clear();
+  }
+
+  LocationValue aValue;
+  aValue.M     = M;
+  aValue.V     = V;
+  aValue.First = myLocFirst;
+  aValue.Last  = myLocLast;
+  aValue.Order = theOrder;
+  if (theOrder >= 1)
+  {
+    aValue.DM = DM;
+    aValue.DV = DV;
+  }
+  if (theOrder >= 2)
+  {
+    aValue.D2M = D2M;
+    aValue.D2V = D2V;
+  }
+  myLocCache->Bind(theParam, aValue);
+}
@@ -25,6 +25,7 @@
 #include <Approx_SweepFunction.hxx>
 #include <gp_Pnt.hxx>
 #include <NCollection_Array1.hxx>
+#include <NCollection_DataMap.hxx>
 #include <gp_Pnt2d.hxx>
 #include <gp_Vec2d.hxx>
 #include <Standard_Integer.hxx>
@@ -38,6 +39,20 @@ class gp_Pnt;
 class GeomFill_SweepFunction : public Approx_SweepFunction
 {
 
+public:
+  //! Evaluation of the location law at some parameter.
+  struct LocationValue
+  {
+    gp_Mat M, DM, D2M;
+    gp_Vec V, DV, D2V;
+    double First; //!< first parameter of the interval of the location law
+    double Last;  //!< last  parameter of the interval of the location law
+    int    Order; //!< highest computed derivative
+  };
+
+  //! Map of parameters to the evaluations of the location law.
+  typedef NCollection_DataMap<double, LocationValue> LocationCache;
+
 public:
   Standard_EXPORT GeomFill_SweepFunction(const occ::handle<GeomFill_SectionLaw>&  Section,
                                          const occ::handle<GeomFill_LocationLaw>& Location,
@@ -153,8 +168,21 @@ public:
   //! Warning: Used only if <me> IsRational
   Standard_EXPORT void GetMinimalWeight(NCollection_Array1<double>& Weigths) const override;
 
+  //! Sets the cache of evaluations of the location law, which can be shared
+  //! by the functions sweeping several sections along the same location law
+  //! and should outlive the function. The cache is used only for location laws
+  //! without 2d curves; null pointer disables caching.
+  Standard_EXPORT void SetLocationCache(LocationCache* theCache);
+
   DEFINE_STANDARD_RTTIEXT(GeomFill_SweepFunction, Approx_SweepFunction)
 
+private:
+  //! Fetches M, V and their derivatives up to theOrder from the cache.
+  bool findLocation(const double theParam, const int theOrder);
+
+  //! Puts M, V and their derivatives up to theOrder into the cache.
+  void storeLocation(const double theParam, const int theOrder);
+
 private:
   occ::handle<GeomFill_LocationLaw> myLoc;
   occ::handle<GeomFill_SectionLaw>  mySec;
@@ -167,6 +195,10 @@ private:
   gp_Vec                            V;
   gp_Vec                            DV;
   gp_Vec                            D2V;
+  LocationCache*                    myLocCache;
+  double                            myLocFirst;
+  double                            myLocLast;
+  bool                              myHasLocInterval;
 };
 
 #endif // _GeomFill_SweepFunction_HeaderFile
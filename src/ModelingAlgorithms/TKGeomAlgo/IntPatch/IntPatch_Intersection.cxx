@@ -205,6 +205,7 @@ void IntPatch_Intersection::Perform(const occ::handle<Adaptor3d_Surface>&   S1,
       [[fallthrough]];
     default: {
       IntPatch_PrmPrmIntersection interpp;
+      interpp.SetSamplingCache(mySamplingCache);
       interpp.Perform(S1, D1, TolTang, TolArc, myFleche, myUVMaxStep);
       if (interpp.IsDone())
       {
@@ -1514,6 +1515,7 @@ void IntPatch_Intersection::ParamParamPerfom(const occ::handle<Adaptor3d_Surface
                                              const GeomAbs_SurfaceType               typs2)
 {
   IntPatch_PrmPrmIntersection interpp;
+  interpp.SetSamplingCache(mySamplingCache);
   //
   if (!theD1->DomainIsInfinite() && !theD2->DomainIsInfinite())
   {
@@ -1880,6 +1882,7 @@ void IntPatch_Intersection::Perform(const occ::handle<Adaptor3d_Surface>&   S1,
   else
   {
     IntPatch_PrmPrmIntersection interpp;
+    interpp.SetSamplingCache(mySamplingCache);
     interpp.Perform(S1, D1, S2, D2, U1, V1, U2, V2, TolTang, TolArc, myFleche, myUVMaxStep);
     if (interpp.IsDone())
     {
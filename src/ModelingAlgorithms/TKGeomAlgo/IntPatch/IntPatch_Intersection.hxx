@@ -21,6 +21,7 @@
 #include <IntPatch_Point.hxx>
 #include <NCollection_Sequence.hxx>
 #include <IntPatch_Line.hxx>
+#include <IntPolyh_SamplingCache.hxx>
 #include <IntSurf_PntOn2S.hxx>
 #include <NCollection_List.hxx>
 #include <GeomAbs_SurfaceType.hxx>
@@ -72,6 +73,16 @@ public:
                                      const double UVMaxStep,
                                      const double Fleche);
 
+  //! Sets the cache of surface samplings used by the Parametric - Parametric algorithm,
+  //! shared by intersections of the same surfaces with different ones; NULL by default.
+  void SetSamplingCache(const occ::handle<IntPolyh_SamplingCache>& theCache)
+  {
+    mySamplingCache = theCache;
+  }
+
+  //! Returns the cache of surface samplings.
+  const occ::handle<IntPolyh_SamplingCache>& SamplingCache() const { return mySamplingCache; }
+
   //! Flag theIsReqToKeepRLine has been entered only for
   //! compatibility with TopOpeBRep package. It shall be deleted
   //! after deleting TopOpeBRep.
@@ -252,6 +263,7 @@ private:
   double                                           myV1Start;
   double                                           myU2Start;
   double                                           myV2Start;
+  occ::handle<IntPolyh_SamplingCache>              mySamplingCache;
 };
 
 #include <IntPatch_Intersection.lxx>
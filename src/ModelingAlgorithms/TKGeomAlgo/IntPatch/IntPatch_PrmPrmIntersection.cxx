@@ -2374,11 +2374,18 @@ void IntPatch_PrmPrmIntersection::Perform(const occ::handle<Adaptor3d_Surface>&
 
     if (D1->IsUniformSampling() || D2->IsUniformSampling())
     {
-      pInterference = new IntPolyh_Intersection(Surf1, NbU1, NbV1, Surf2, NbU2, NbV2);
+      pInterference =
+        new IntPolyh_Intersection(Surf1, NbU1, NbV1, Surf2, NbU2, NbV2, mySamplingCache);
     }
     else
     {
-      pInterference = new IntPolyh_Intersection(Surf1, anUpars1, aVpars1, Surf2, anUpars2, aVpars2);
+      pInterference = new IntPolyh_Intersection(Surf1,
+                                                anUpars1,
+                                                aVpars1,
+                                                Surf2,
+                                                anUpars2,
+                                                aVpars2,
+                                                mySamplingCache);
     }
 
     if (!pInterference)
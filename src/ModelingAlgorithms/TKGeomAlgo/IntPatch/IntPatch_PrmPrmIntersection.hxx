@@ -20,6 +20,7 @@
 #include <Adaptor3d_Surface.hxx>
 #include <IntPatch_Line.hxx>
 #include <NCollection_Sequence.hxx>
+#include <IntPolyh_SamplingCache.hxx>
 #include <IntSurf_PntOn2S.hxx>
 #include <NCollection_List.hxx>
 
@@ -147,6 +148,16 @@ public:
                                const double                            Deflection,
                                const double                            Increment);
 
+  //! Sets the cache of surface samplings shared by intersections of the same surfaces
+  //! with different ones (e.g. within one Boolean operation); NULL by default.
+  void SetSamplingCache(const occ::handle<IntPolyh_SamplingCache>& theCache)
+  {
+    mySamplingCache = theCache;
+  }
+
+  //! Returns the cache of surface samplings.
+  const occ::handle<IntPolyh_SamplingCache>& SamplingCache() const { return mySamplingCache; }
+
   //! Returns true if the calculus was successful.
   bool IsDone() const;
 
@@ -233,6 +244,7 @@ private:
   bool                                             done;
   bool                                             empt;
   NCollection_Sequence<occ::handle<IntPatch_Line>> SLin;
+  occ::handle<IntPolyh_SamplingCache>              mySamplingCache;
 };
 
 #include <IntPatch_PrmPrmIntersection.lxx>
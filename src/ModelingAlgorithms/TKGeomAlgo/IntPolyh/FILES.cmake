@@ -21,6 +21,8 @@ set(OCCT_IntPolyh_FILES
   IntPolyh_PMaillageAffinage.hxx
   IntPolyh_Point.cxx
   IntPolyh_Point.hxx
+  IntPolyh_SamplingCache.cxx
+  IntPolyh_SamplingCache.hxx
   IntPolyh_SectionLine.cxx
   IntPolyh_SectionLine.hxx
 
@@ -49,15 +49,17 @@ IntPolyh_Intersection::IntPolyh_Intersection(const occ::handle<Adaptor3d_Surface
 
 //=================================================================================================
 
-IntPolyh_Intersection::IntPolyh_Intersection(const occ::handle<Adaptor3d_Surface>& theS1,
-                                             const int                             theNbSU1,
-                                             const int                             theNbSV1,
-                                             const occ::handle<Adaptor3d_Surface>& theS2,
-                                             const int                             theNbSU2,
-                                             const int                             theNbSV2)
+IntPolyh_Intersection::IntPolyh_Intersection(const occ::handle<Adaptor3d_Surface>&      theS1,
+                                             const int                                  theNbSU1,
+                                             const int                                  theNbSV1,
+                                             const occ::handle<Adaptor3d_Surface>&      theS2,
+                                             const int                                  theNbSU2,
+                                             const int                                  theNbSV2,
+                                             const occ::handle<IntPolyh_SamplingCache>& theCache)
 {
   mySurf1      = theS1;
   mySurf2      = theS2;
+  myCache      = theCache;
   myNbSU1      = theNbSU1;
   myNbSV1      = theNbSV1;
   myNbSU2      = theNbSU2;
@@ -71,15 +73,17 @@ IntPolyh_Intersection::IntPolyh_Intersection(const occ::handle<Adaptor3d_Surface
 
 //=================================================================================================
 
-IntPolyh_Intersection::IntPolyh_Intersection(const occ::handle<Adaptor3d_Surface>& theS1,
-                                             const NCollection_Array1<double>&     theUPars1,
-                                             const NCollection_Array1<double>&     theVPars1,
-                                             const occ::handle<Adaptor3d_Surface>& theS2,
-                                             const NCollection_Array1<double>&     theUPars2,
-                                             const NCollection_Array1<double>&     theVPars2)
+IntPolyh_Intersection::IntPolyh_Intersection(const occ::handle<Adaptor3d_Surface>&      theS1,
+                                             const NCollection_Array1<double>&          theUPars1,
+                                             const NCollection_Array1<double>&          theVPars1,
+                                             const occ::handle<Adaptor3d_Surface>&      theS2,
+                                             const NCollection_Array1<double>&          theUPars2,
+                                             const NCollection_Array1<double>&          theVPars2,
+                                             const occ::handle<IntPolyh_SamplingCache>& theCache)
 {
   mySurf1      = theS1;
   mySurf2      = theS2;
+  myCache      = theCache;
   myNbSU1      = theUPars1.Length();
   myNbSV1      = theVPars1.Length();
   myNbSU2      = theUPars2.Length();
@@ -160,9 +164,20 @@ void IntPolyh_Intersection::Perform(const NCollection_Array1<double>& theUPars1,
 {
   myIsDone = true;
 
+  // Take points and deflection of the given sampling from the cache
+  if (!myCache.IsNull())
+  {
+    mySampling1 = myCache->Find(mySurf1, theUPars1, theVPars1);
+    mySampling2 = myCache->Find(mySurf2, theUPars2, theVPars2);
+  }
+
   // Compute the deflection of the given sampling if it is not set
-  double aDeflTol1 = IntPolyh_Tools::ComputeDeflection(mySurf1, theUPars1, theVPars1);
-  double aDeflTol2 = IntPolyh_Tools::ComputeDeflection(mySurf2, theUPars2, theVPars2);
+  double aDeflTol1 = !mySampling1.IsNull()
+                       ? mySampling1->Deflection()
+                       : IntPolyh_Tools::ComputeDeflection(mySurf1, theUPars1, theVPars1);
+  double aDeflTol2 = !mySampling2.IsNull()
+                       ? mySampling2->Deflection()
+                       : IntPolyh_Tools::ComputeDeflection(mySurf2, theUPars2, theVPars2);
 
   // Perform standard intersection
   IntPolyh_PMaillageAffinage pMaillageStd = nullptr;
@@ -280,9 +295,19 @@ bool IntPolyh_Intersection::PerformAdv(const NCollection_Array1<double>& theUPar
                                        int&                              theNbCouples)
 {
   // Compute the points on the surface and normal directions in these points
-  IntPolyh_ArrayOfPointNormal aPoints1, aPoints2;
-  IntPolyh_Tools::FillArrayOfPointNormal(mySurf1, theUPars1, theVPars1, aPoints1);
-  IntPolyh_Tools::FillArrayOfPointNormal(mySurf2, theUPars2, theVPars2, aPoints2);
+  IntPolyh_ArrayOfPointNormal aLocalPoints1, aLocalPoints2;
+  if (mySampling1.IsNull())
+  {
+    IntPolyh_Tools::FillArrayOfPointNormal(mySurf1, theUPars1, theVPars1, aLocalPoints1);
+  }
+  if (mySampling2.IsNull())
+  {
+    IntPolyh_Tools::FillArrayOfPointNormal(mySurf2, theUPars2, theVPars2, aLocalPoints2);
+  }
+  const IntPolyh_ArrayOfPointNormal& aPoints1 =
+    !mySampling1.IsNull() ? mySampling1->PointNormals(mySurf1) : aLocalPoints1;
+  const IntPolyh_ArrayOfPointNormal& aPoints2 =
+    !mySampling2.IsNull() ? mySampling2->PointNormals(mySurf2) : aLocalPoints2;
 
   // Perform intersection with the different shifts of the triangles
   bool isDone = PerformMaillage(theUPars1,
@@ -366,8 +391,16 @@ bool IntPolyh_Intersection::PerformMaillage(const NCollection_Array1<double>& th
                                               theVPars2.Length(),
                                               0);
 
-  theMaillage->FillArrayOfPnt(1, theUPars1, theVPars1, &theDeflTol1);
-  theMaillage->FillArrayOfPnt(2, theUPars2, theVPars2, &theDeflTol2);
+  theMaillage->FillArrayOfPnt(1,
+                              theUPars1,
+                              theVPars1,
+                              &theDeflTol1,
+                              !mySampling1.IsNull() ? &mySampling1->Points() : nullptr);
+  theMaillage->FillArrayOfPnt(2,
+                              theUPars2,
+                              theVPars2,
+                              &theDeflTol2,
+                              !mySampling2.IsNull() ? &mySampling2->Points() : nullptr);
 
   int FinTTC = ComputeIntersection(theMaillage);
 
@@ -24,6 +24,7 @@
 #include <NCollection_List.hxx>
 #include <IntPolyh_Couple.hxx>
 #include <IntPolyh_PMaillageAffinage.hxx>
+#include <IntPolyh_SamplingCache.hxx>
 #include <NCollection_Array1.hxx>
 
 //! API algorithm for intersection of two surfaces by intersection
@@ -56,22 +57,28 @@ public: //! @name Constructors
   //! size of the sampling nets:
   //! - <theNbSU1> x <theNbSV1> - for the first surface <theS1>;
   //! - <theNbSU2> x <theNbSV2> - for the second surface <theS2>.
+  //! If given, the sampling points are taken from (and stored into) <theCache>.
   //! Performs intersection.
-  Standard_EXPORT IntPolyh_Intersection(const occ::handle<Adaptor3d_Surface>& theS1,
-                                        const int                             theNbSU1,
-                                        const int                             theNbSV1,
-                                        const occ::handle<Adaptor3d_Surface>& theS2,
-                                        const int                             theNbSU2,
-                                        const int                             theNbSV2);
+  Standard_EXPORT IntPolyh_Intersection(
+    const occ::handle<Adaptor3d_Surface>&      theS1,
+    const int                                  theNbSU1,
+    const int                                  theNbSV1,
+    const occ::handle<Adaptor3d_Surface>&      theS2,
+    const int                                  theNbSU2,
+    const int                                  theNbSV2,
+    const occ::handle<IntPolyh_SamplingCache>& theCache = occ::handle<IntPolyh_SamplingCache>());
 
   //! Constructor for intersection of two surfaces with the precomputed sampling.
+  //! If given, the sampling points are taken from (and stored into) <theCache>.
   //! Performs intersection.
-  Standard_EXPORT IntPolyh_Intersection(const occ::handle<Adaptor3d_Surface>& theS1,
-                                        const NCollection_Array1<double>&     theUPars1,
-                                        const NCollection_Array1<double>&     theVPars1,
-                                        const occ::handle<Adaptor3d_Surface>& theS2,
-                                        const NCollection_Array1<double>&     theUPars2,
-                                        const NCollection_Array1<double>&     theVPars2);
+  Standard_EXPORT IntPolyh_Intersection(
+    const occ::handle<Adaptor3d_Surface>&      theS1,
+    const NCollection_Array1<double>&          theUPars1,
+    const NCollection_Array1<double>&          theVPars1,
+    const occ::handle<Adaptor3d_Surface>&      theS2,
+    const NCollection_Array1<double>&          theUPars2,
+    const NCollection_Array1<double>&          theVPars2,
+    const occ::handle<IntPolyh_SamplingCache>& theCache = occ::handle<IntPolyh_SamplingCache>());
 
 public: //! @name Getting the results
   //! Returns state of the operation
@@ -185,8 +192,11 @@ private: //! @name Performing the intersection
 
 private: //! @name Fields
   // Inputs
-  occ::handle<Adaptor3d_Surface> mySurf1;      //!< First surface
-  occ::handle<Adaptor3d_Surface> mySurf2;      //!< Second surface
+  occ::handle<Adaptor3d_Surface>                mySurf1;     //!< First surface
+  occ::handle<Adaptor3d_Surface>                mySurf2;     //!< Second surface
+  occ::handle<IntPolyh_SamplingCache>           myCache;     //!< Cache of samplings
+  occ::handle<IntPolyh_SamplingCache::Sampling> mySampling1; //!< Sampling of first surface
+  occ::handle<IntPolyh_SamplingCache::Sampling> mySampling2; //!< Sampling of second surface
                                                // clang-format off
   int myNbSU1;                    //!< Number of samples in U direction for first surface
   int myNbSV1;                    //!< Number of samples in V direction for first surface
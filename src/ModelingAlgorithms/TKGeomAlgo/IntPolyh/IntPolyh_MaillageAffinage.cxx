@@ -42,12 +42,16 @@
 #include <Standard_Integer.hxx>
 #include <NCollection_Map.hxx>
 #include <NCollection_List.hxx>
+#include <OSD_Parallel.hxx>
 #include <algorithm>
 #include <NCollection_IndexedDataMap.hxx>
 
 typedef NCollection_IndexedDataMap<int, NCollection_List<int>>
   IntPolyh_IndexedDataMapOfIntegerListOfInteger;
 
+//! Minimal number of couples of triangles to check their contact in parallel
+static const int THE_MIN_NB_PAIRS_PARALLEL = 1024;
+
 static double MyTolerance                = 10.0e-7;
 static double MyConfusionPrecision       = 10.0e-12;
 static double SquareMyConfusionPrecision = 10.0e-24;
@@ -181,14 +185,15 @@ private:
 };
 
 //=======================================================================
-// function : GetInterferingTriangles
-// purpose  : Returns indices of the triangles with interfering bounding boxes
+// function : GetInterferingPairs
+// purpose  : Returns sorted pairs of indices of the triangles
+//           with interfering bounding boxes
 //=======================================================================
-static void GetInterferingTriangles(IntPolyh_ArrayOfTriangles&                     theTriangles1,
-                                    const IntPolyh_ArrayOfPoints&                  thePoints1,
-                                    IntPolyh_ArrayOfTriangles&                     theTriangles2,
-                                    const IntPolyh_ArrayOfPoints&                  thePoints2,
-                                    IntPolyh_IndexedDataMapOfIntegerListOfInteger& theCouples)
+static void GetInterferingPairs(IntPolyh_ArrayOfTriangles&                         theTriangles1,
+                                const IntPolyh_ArrayOfPoints&                      thePoints1,
+                                IntPolyh_ArrayOfTriangles&                         theTriangles2,
+                                const IntPolyh_ArrayOfPoints&                      thePoints2,
+                                std::vector<IntPolyh_BoxBndTreeSelector::PairIDs>& thePairs)
 {
   // Use linear builder for BVH construction
   opencascade::handle<BVH_LinearBuilder<double, 3>> aLBuilder =
@@ -228,9 +233,22 @@ static void GetInterferingTriangles(IntPolyh_ArrayOfTriangles&
   aSelector.SetBVHSets(&aBBTree1, &aBBTree2);
   aSelector.Select();
   aSelector.Sort();
+  thePairs = aSelector.Pairs();
+}
 
-  const std::vector<IntPolyh_BoxBndTreeSelector::PairIDs>& aPairs = aSelector.Pairs();
-  const int aNbPairs                                              = static_cast<int>(aPairs.size());
+//=======================================================================
+// function : GetInterferingTriangles
+// purpose  : Returns indices of the triangles with interfering bounding boxes
+//=======================================================================
+static void GetInterferingTriangles(IntPolyh_ArrayOfTriangles&                     theTriangles1,
+                                    const IntPolyh_ArrayOfPoints&                  thePoints1,
+                                    IntPolyh_ArrayOfTriangles&                     theTriangles2,
+                                    const IntPolyh_ArrayOfPoints&                  thePoints2,
+                                    IntPolyh_IndexedDataMapOfIntegerListOfInteger& theCouples)
+{
+  std::vector<IntPolyh_BoxBndTreeSelector::PairIDs> aPairs;
+  GetInterferingPairs(theTriangles1, thePoints1, theTriangles2, thePoints2, aPairs);
+  const int aNbPairs = static_cast<int>(aPairs.size());
 
   for (int i = 0; i < aNbPairs; ++i)
   {
@@ -340,7 +358,8 @@ void IntPolyh_MaillageAffinage::FillArrayOfPnt(const int SurfID, const bool isSh
 void IntPolyh_MaillageAffinage::FillArrayOfPnt(const int                         SurfID,
                                                const NCollection_Array1<double>& Upars,
                                                const NCollection_Array1<double>& Vpars,
-                                               const double*                     theDeflTol)
+                                               const double*                     theDeflTol,
+                                               const NCollection_Array1<gp_Pnt>* thePoints)
 {
   bool   bDegI, bDeg;
   int    aNbU, aNbV, iCnt, i, j;
@@ -373,7 +392,7 @@ void IntPolyh_MaillageAffinage::FillArrayOfPnt(const int
     for (j = 1; j <= aNbV; ++j)
     {
       aV = Vpars(j);
-      aP = aS->Value(aU, aV);
+      aP = thePoints ? thePoints->Value(thePoints->Lower() + iCnt) : aS->Value(aU, aV);
       aP.Coord(aX, aY, aZ);
       IntPolyh_Point& aIP = TPoints[iCnt];
       aIP.Set(aX, aY, aZ, aU, aV);
@@ -2824,44 +2843,56 @@ int IntPolyh_MaillageAffinage::TriangleEdgeContact(const int                TriS
 int IntPolyh_MaillageAffinage::TriangleCompare()
 {
   // Find couples with interfering bounding boxes
-  IntPolyh_IndexedDataMapOfIntegerListOfInteger aDMILI;
-  GetInterferingTriangles(TTriangles1, TPoints1, TTriangles2, TPoints2, aDMILI);
-  if (aDMILI.IsEmpty())
+  std::vector<IntPolyh_BoxBndTreeSelector::PairIDs> aPairs;
+  GetInterferingPairs(TTriangles1, TPoints1, TTriangles2, TPoints2, aPairs);
+  if (aPairs.empty())
   {
     return 0;
   }
   //
-  double CoupleAngle = -2.0;
+  // Intersection of the triangles is checked independently for each couple,
+  // angle is not modified for the couples with degenerated normals
+  const int           aNbPairs = static_cast<int>(aPairs.size());
+  std::vector<double> anAngles(aNbPairs, RealLast());
+  std::vector<char>   aContacts(aNbPairs, 0);
+  OSD_Parallel::For(
+    0,
+    aNbPairs,
+    [&](const int thePairIndex) {
+      const IntPolyh_BoxBndTreeSelector::PairIDs& aPair     = aPairs[thePairIndex];
+      const IntPolyh_Triangle&                    Triangle1 = TTriangles1[aPair.ID1];
+      const IntPolyh_Triangle&                    Triangle2 = TTriangles2[aPair.ID2];
+      const int aContact = TriContact(TPoints1[Triangle1.FirstPoint()],
+                                      TPoints1[Triangle1.SecondPoint()],
+                                      TPoints1[Triangle1.ThirdPoint()],
+                                      TPoints2[Triangle2.FirstPoint()],
+                                      TPoints2[Triangle2.SecondPoint()],
+                                      TPoints2[Triangle2.ThirdPoint()],
+                                      anAngles[thePairIndex]);
+      aContacts[thePairIndex] = static_cast<char>(aContact);
+    },
+    aNbPairs < THE_MIN_NB_PAIRS_PARALLEL);
   //
-  // Intersection of the triangles
-  int i, aNb = aDMILI.Extent();
-  for (i = 1; i <= aNb; ++i)
-  {
-    const int             i_S1      = aDMILI.FindKey(i);
-    IntPolyh_Triangle&    Triangle1 = TTriangles1[i_S1];
-    const IntPolyh_Point& P1        = TPoints1[Triangle1.FirstPoint()];
-    const IntPolyh_Point& P2        = TPoints1[Triangle1.SecondPoint()];
-    const IntPolyh_Point& P3        = TPoints1[Triangle1.ThirdPoint()];
-    //
-    const NCollection_List<int>&    aLI2 = aDMILI(i);
-    NCollection_List<int>::Iterator aItLI(aLI2);
-    for (; aItLI.More(); aItLI.Next())
-    {
-      const int             i_S2      = aItLI.Value();
-      IntPolyh_Triangle&    Triangle2 = TTriangles2[i_S2];
-      const IntPolyh_Point& Q1        = TPoints2[Triangle2.FirstPoint()];
-      const IntPolyh_Point& Q2        = TPoints2[Triangle2.SecondPoint()];
-      const IntPolyh_Point& Q3        = TPoints2[Triangle2.ThirdPoint()];
-      //
-      if (TriContact(P1, P2, P3, Q1, Q2, Q3, CoupleAngle))
-      {
-        IntPolyh_Couple aCouple(i_S1, i_S2, CoupleAngle);
-        TTrianglesContacts.Append(aCouple);
-        //
-        Triangle1.SetIntersection(true);
-        Triangle2.SetIntersection(true);
-      }
+  // Put couples in contact in the order of the pairs
+  double CoupleAngle = -2.0;
+  for (int i = 0; i < aNbPairs; ++i)
+  {
+    if (anAngles[i] != RealLast())
+    {
+      CoupleAngle = anAngles[i];
+    }
+    if (!aContacts[i])
+    {
+      continue;
     }
+    //
+    const int       i_S1 = aPairs[i].ID1;
+    const int       i_S2 = aPairs[i].ID2;
+    IntPolyh_Couple aCouple(i_S1, i_S2, CoupleAngle);
+    TTrianglesContacts.Append(aCouple);
+    //
+    TTriangles1[i_S1].SetIntersection(true);
+    TTriangles2[i_S2].SetIntersection(true);
   }
   return TTrianglesContacts.Extent();
 }
@@ -19,6 +19,7 @@
 
 #include <Adaptor3d_Surface.hxx>
 #include <Bnd_Box.hxx>
+#include <gp_Pnt.hxx>
 #include <IntPolyh_ArrayOfPoints.hxx>
 #include <IntPolyh_ArrayOfEdges.hxx>
 #include <IntPolyh_ArrayOfTriangles.hxx>
@@ -70,12 +71,14 @@ public:
   Standard_EXPORT void FillArrayOfPnt(const int SurfID, const bool isShiftFwd);
 
   //! Compute points on one surface and fill an array of points;
-  //! If given, <theDeflTol> is the deflection tolerance of the given sampling.
+  //! If given, <theDeflTol> is the deflection tolerance of the given sampling
+  //! and <thePoints> are the precomputed points of the sampling.
   //! standard (default) method
   Standard_EXPORT void FillArrayOfPnt(const int                         SurfID,
                                       const NCollection_Array1<double>& Upars,
                                       const NCollection_Array1<double>& Vpars,
-                                      const double*                     theDeflTol = nullptr);
+                                      const double*                     theDeflTol = nullptr,
+                                      const NCollection_Array1<gp_Pnt>* thePoints  = nullptr);
 
   //! isShiftFwd flag is added. The purpose is to define shift
   //! of points along normal to the surface in this point. The
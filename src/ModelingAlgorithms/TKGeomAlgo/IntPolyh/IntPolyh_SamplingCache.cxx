@@ -0,0 +1,172 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <IntPolyh_SamplingCache.hxx>
+
+#include <GeomAdaptor_Surface.hxx>
+#include <GeomHash_SurfaceHasher.hxx>
+#include <IntPolyh_Tools.hxx>
+#include <Standard_HashUtils.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(IntPolyh_SamplingCache, Standard_Transient)
+
+//=================================================================================================
+
+IntPolyh_SamplingCache::Sampling::Sampling(const occ::handle<Adaptor3d_Surface>& theSurf,
+                                           const NCollection_Array1<double>&     theUPars,
+                                           const NCollection_Array1<double>&     theVPars)
+    : myUPars(theUPars),
+      myVPars(theVPars),
+      myPoints(0, theUPars.Length() * theVPars.Length() - 1),
+      myDeflection(IntPolyh_Tools::ComputeDeflection(theSurf, theUPars, theVPars)),
+      myHasNormals(false)
+{
+  int aPntIndex = 0;
+  for (int i = theUPars.Lower(); i <= theUPars.Upper(); ++i)
+  {
+    for (int j = theVPars.Lower(); j <= theVPars.Upper(); ++j)
+    {
+      myPoints.ChangeValue(aPntIndex++) = theSurf->Value(theUPars(i), theVPars(j));
+    }
+  }
+}
+
+//=================================================================================================
+
+const IntPolyh_ArrayOfPointNormal& IntPolyh_SamplingCache::Sampling::PointNormals(
+  const occ::handle<Adaptor3d_Surface>& theSurf)
+{
+  std::lock_guard<std::mutex> aLock(myNormalsMutex);
+  if (!myHasNormals)
+  {
+    IntPolyh_Tools::FillArrayOfPointNormal(theSurf, myUPars, myVPars, myPointNormals);
+    myHasNormals = true;
+  }
+  return myPointNormals;
+}
+
+//=================================================================================================
+
+bool IntPolyh_SamplingCache::KeyHasher::operator()(const Key& theKey1,
+                                                   const Key& theKey2) const noexcept
+{
+  if (theKey1.Hash != theKey2.Hash || theKey1.Signature != theKey2.Signature)
+  {
+    return false;
+  }
+  return theKey1.Surface == theKey2.Surface
+         || GeomHash_SurfaceHasher()(theKey1.Surface, theKey2.Surface);
+}
+
+//=================================================================================================
+
+IntPolyh_SamplingCache::IntPolyh_SamplingCache()
+    : myNbHits(0),
+      myNbMisses(0)
+{
+}
+
+//=================================================================================================
+
+occ::handle<IntPolyh_SamplingCache::Sampling> IntPolyh_SamplingCache::Find(
+  const occ::handle<Adaptor3d_Surface>& theSurf,
+  const NCollection_Array1<double>&     theUPars,
+  const NCollection_Array1<double>&     theVPars)
+{
+  // other adaptors may define the geometry which is not identified by the surface
+  if (theSurf.IsNull() || theSurf->DynamicType() != STANDARD_TYPE(GeomAdaptor_Surface))
+  {
+    return occ::handle<Sampling>();
+  }
+  const occ::handle<Geom_Surface>& aSurface =
+    occ::down_cast<GeomAdaptor_Surface>(theSurf)->Surface();
+  if (aSurface.IsNull())
+  {
+    return occ::handle<Sampling>();
+  }
+
+  Key aKey;
+  aKey.Surface = aSurface;
+  aKey.Signature.reserve(6 + theUPars.Length() + theVPars.Length());
+  aKey.Signature.push_back(theSurf->FirstUParameter());
+  aKey.Signature.push_back(theSurf->LastUParameter());
+  aKey.Signature.push_back(theSurf->FirstVParameter());
+  aKey.Signature.push_back(theSurf->LastVParameter());
+  aKey.Signature.push_back(double(theUPars.Length()));
+  aKey.Signature.push_back(double(theVPars.Length()));
+  for (int i = theUPars.Lower(); i <= theUPars.Upper(); ++i)
+  {
+    aKey.Signature.push_back(theUPars(i));
+  }
+  for (int i = theVPars.Lower(); i <= theVPars.Upper(); ++i)
+  {
+    aKey.Signature.push_back(theVPars(i));
+  }
+  aKey.Hash = opencascade::hash_combine(*aKey.Signature.data(),
+                                        int(aKey.Signature.size() * sizeof(double)),
+                                        GeomHash_SurfaceHasher()(aSurface));
+  {
+    std::lock_guard<std::mutex> aLock(myMutex);
+    if (const occ::handle<Sampling>* aSampling = mySamplings.Seek(aKey))
+    {
+      ++myNbHits;
+      return *aSampling;
+    }
+  }
+
+  // evaluate the sampling without blocking other threads;
+  // the first stored sampling is shared if the same one has been evaluated concurrently
+  occ::handle<Sampling>       aSampling = new Sampling(theSurf, theUPars, theVPars);
+  std::lock_guard<std::mutex> aLock(myMutex);
+  ++myNbMisses;
+  if (const occ::handle<Sampling>* aStored = mySamplings.Seek(aKey))
+  {
+    return *aStored;
+  }
+  mySamplings.Bind(aKey, aSampling);
+  return aSampling;
+}
+
+//=================================================================================================
+
+int IntPolyh_SamplingCache::NbEntries() const
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  return mySamplings.Extent();
+}
+
+//=================================================================================================
+
+std::size_t IntPolyh_SamplingCache::NbHits() const
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  return myNbHits;
+}
+
+//=================================================================================================
+
+std::size_t IntPolyh_SamplingCache::NbMisses() const
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  return myNbMisses;
+}
+
+//=================================================================================================
+
+void IntPolyh_SamplingCache::Clear()
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  mySamplings.Clear();
+  myNbHits   = 0;
+  myNbMisses = 0;
+}
@@ -0,0 +1,120 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _IntPolyh_SamplingCache_HeaderFile
+#define _IntPolyh_SamplingCache_HeaderFile
+
+#include <Adaptor3d_Surface.hxx>
+#include <Geom_Surface.hxx>
+#include <IntPolyh_ArrayOfPointNormal.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_DataMap.hxx>
+
+#include <mutex>
+#include <vector>
+
+//! Thread-safe cache of surface samplings used by IntPolyh_Intersection,
+//! so that the same surface intersected with many others (e.g. a face interfering with
+//! several faces within one Boolean operation) is evaluated only once.
+//!
+//! Sampling is identified by the surface geometry (see GeomHash_SurfaceHasher),
+//! the parametric bounds of the adaptor and the parameters of the sampling points.
+//! Only surfaces given by GeomAdaptor_Surface are cached.
+class IntPolyh_SamplingCache : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(IntPolyh_SamplingCache, Standard_Transient)
+public:
+  //! Cached data of the surface sampling.
+  class Sampling : public Standard_Transient
+  {
+  public:
+    //! Evaluates the points and the deflection of the sampling on the surface.
+    Standard_EXPORT Sampling(const occ::handle<Adaptor3d_Surface>& theSurf,
+                             const NCollection_Array1<double>&     theUPars,
+                             const NCollection_Array1<double>&     theVPars);
+
+    //! Returns the deflection tolerance of the sampling.
+    double Deflection() const { return myDeflection; }
+
+    //! Returns the points of the sampling (U parameter varies first in outer loop).
+    const NCollection_Array1<gp_Pnt>& Points() const { return myPoints; }
+
+    //! Returns the points with normal directions of the surface,
+    //! computing them on first request.
+    //! @param[in] theSurf surface the sampling has been created for
+    Standard_EXPORT const IntPolyh_ArrayOfPointNormal& PointNormals(
+      const occ::handle<Adaptor3d_Surface>& theSurf);
+
+  private:
+    NCollection_Array1<double>  myUPars;        //!< U parameters of the sampling
+    NCollection_Array1<double>  myVPars;        //!< V parameters of the sampling
+    NCollection_Array1<gp_Pnt>  myPoints;       //!< points of the sampling
+    IntPolyh_ArrayOfPointNormal myPointNormals; //!< points with normals, computed on demand
+    double                      myDeflection;   //!< deflection tolerance
+    bool                        myHasNormals;   //!< flag indicating computed normals
+    std::mutex                  myNormalsMutex; //!< mutex guarding computation of normals
+  };
+
+public:
+  //! Empty constructor.
+  Standard_EXPORT IntPolyh_SamplingCache();
+
+  //! Returns the sampling of the surface, evaluating it on first request.
+  //! @param[in] theSurf  surface adaptor
+  //! @param[in] theUPars U parameters of the sampling points
+  //! @param[in] theVPars V parameters of the sampling points
+  //! @return NULL if the surface cannot be cached
+  Standard_EXPORT occ::handle<Sampling> Find(const occ::handle<Adaptor3d_Surface>& theSurf,
+                                             const NCollection_Array1<double>&     theUPars,
+                                             const NCollection_Array1<double>&     theVPars);
+
+  //! Returns number of cached samplings.
+  Standard_EXPORT int NbEntries() const;
+
+  //! Returns number of cache hits since creation or last Clear().
+  Standard_EXPORT std::size_t NbHits() const;
+
+  //! Returns number of cache misses since creation or last Clear().
+  Standard_EXPORT std::size_t NbMisses() const;
+
+  //! Releases all cached samplings.
+  Standard_EXPORT void Clear();
+
+private:
+  //! Sampling key.
+  struct Key
+  {
+    std::size_t               Hash;      //!< hash of geometry and signature
+    occ::handle<Geom_Surface> Surface;   //!< sampled surface
+    std::vector<double>       Signature; //!< bounds and parameters of the sampling
+  };
+
+  //! Hasher of sampling keys.
+  struct KeyHasher
+  {
+    std::size_t operator()(const Key& theKey) const noexcept { return theKey.Hash; }
+
+    bool operator()(const Key& theKey1, const Key& theKey2) const noexcept;
+  };
+
+  //! Map of cached samplings.
+  typedef NCollection_DataMap<Key, occ::handle<Sampling>, KeyHasher> SamplingMap;
+
+private:
+  SamplingMap        mySamplings; //!< cached samplings
+  mutable std::mutex myMutex;     //!< access mutex
+  std::size_t        myNbHits;    //!< number of cache hits
+  std::size_t        myNbMisses;  //!< number of cache misses
+};
+
+#endif // _IntPolyh_SamplingCache_HeaderFile
@@ -2,4 +2,6 @@
 set(OCCT_TKHLR_GTests_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
 
 set(OCCT_TKHLR_GTests_FILES
+  HLRBRep_Algo_Test.cxx
+  HLRBRep_PolyAlgo_Test.cxx
 )
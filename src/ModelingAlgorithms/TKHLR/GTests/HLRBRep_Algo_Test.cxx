@@ -0,0 +1,102 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <gtest/gtest.h>
+
+#include <BRepGProp.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <GProp_GProps.hxx>
+#include <gp_Ax2.hxx>
+#include <gp_Dir.hxx>
+#include <gp.hxx>
+#include <gp_Pnt.hxx>
+#include <HLRAlgo_Projector.hxx>
+#include <HLRBRep_Algo.hxx>
+#include <HLRBRep_HLRToShape.hxx>
+#include <NCollection_Sequence.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS_Shape.hxx>
+
+namespace
+{
+//! Computes the hidden lines of the shapes and returns the number
+//! and the total length of the visible and hidden sharp edges.
+void computeHLR(const NCollection_Sequence<TopoDS_Shape>& theShapes,
+                const bool                                theIsParallel,
+                int&                                      theNbVisible,
+                int&                                      theNbHidden,
+                double&                                   theVisibleLength,
+                double&                                   theHiddenLength)
+{
+  occ::handle<HLRBRep_Algo> anAlgo = new HLRBRep_Algo();
+  for (NCollection_Sequence<TopoDS_Shape>::Iterator anIt(theShapes); anIt.More(); anIt.Next())
+  {
+    anAlgo->Add(anIt.Value());
+  }
+  anAlgo->Projector(HLRAlgo_Projector(gp_Ax2(gp_Pnt(0., 0., 0.), gp_Dir(1., 1., 1.))));
+  anAlgo->SetRunParallel(theIsParallel);
+  anAlgo->Update();
+  anAlgo->Hide();
+
+  HLRBRep_HLRToShape aToShape(anAlgo);
+  const TopoDS_Shape aVisible = aToShape.VCompound();
+  const TopoDS_Shape aHidden  = aToShape.HCompound();
+
+  theNbVisible = 0;
+  theNbHidden  = 0;
+  for (TopExp_Explorer anExp(aVisible, TopAbs_EDGE); anExp.More(); anExp.Next())
+  {
+    ++theNbVisible;
+  }
+  for (TopExp_Explorer anExp(aHidden, TopAbs_EDGE); anExp.More(); anExp.Next())
+  {
+    ++theNbHidden;
+  }
+
+  GProp_GProps aVisibleProps, aHiddenProps;
+  BRepGProp::LinearProperties(aVisible, aVisibleProps);
+  BRepGProp::LinearProperties(aHidden, aHiddenProps);
+  theVisibleLength = aVisibleProps.Mass();
+  theHiddenLength  = aHiddenProps.Mass();
+}
+} // namespace
+
+TEST(HLRBRep_Algo_Test, ParallelHidingGivesSameResult)
+{
+  // a row of boxes and cylinders hiding each other along the view direction
+  NCollection_Sequence<TopoDS_Shape> aShapes;
+  for (int i = 0; i < 4; ++i)
+  {
+    const double aShift = 1.5 * i;
+    aShapes.Append(BRepPrimAPI_MakeBox(gp_Pnt(aShift, aShift, 0.), 2., 2., 2.).Shape());
+    aShapes.Append(
+      BRepPrimAPI_MakeCylinder(gp_Ax2(gp_Pnt(aShift + 1., aShift - 1., 0.), gp::DZ()), 0.7, 3.)
+        .Shape());
+  }
+
+  int    aNbVisible = 0, aNbHidden = 0;
+  double aVisibleLength = 0., aHiddenLength = 0.;
+  computeHLR(aShapes, false, aNbVisible, aNbHidden, aVisibleLength, aHiddenLength);
+  ASSERT_GT(aNbVisible, 0);
+  ASSERT_GT(aNbHidden, 0);
+
+  int    aParNbVisible = 0, aParNbHidden = 0;
+  double aParVisibleLength = 0., aParHiddenLength = 0.;
+  computeHLR(aShapes, true, aParNbVisible, aParNbHidden, aParVisibleLength, aParHiddenLength);
+
+  EXPECT_EQ(aNbVisible, aParNbVisible);
+  EXPECT_EQ(aNbHidden, aParNbHidden);
+  EXPECT_NEAR(aVisibleLength, aParVisibleLength, 1.e-7);
+  EXPECT_NEAR(aHiddenLength, aParHiddenLength, 1.e-7);
+}
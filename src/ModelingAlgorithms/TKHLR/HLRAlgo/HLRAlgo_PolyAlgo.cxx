@@ -21,10 +21,63 @@
 #include <NCollection_List.hxx>
 #include <HLRAlgo_PolyShellData.hxx>
 #include <HLRAlgo_PolyMask.hxx>
+#include <BVH_LinearBuilder.hxx>
+#include <BVH_Traverse.hxx>
 #include <Precision.hxx>
 
+#include <algorithm>
+
 IMPLEMENT_STANDARD_RTTIEXT(HLRAlgo_PolyAlgo, Standard_Transient)
 
+namespace
+{
+//! Selects the hiding triangles whose boxes overlap the box of a segment.
+class HLRAlgo_PolyAlgo_TriangleSelector
+    : public BVH_Traverse<double, 3, BVH_BoxSet<double, 3, int>, bool>
+{
+public:
+  HLRAlgo_PolyAlgo_TriangleSelector(const BVH_Box<double, 3>& theBox,
+                                    NCollection_Vector<int>&  theIndices)
+      : myBox(theBox),
+        myIndices(theIndices)
+  {
+  }
+
+  bool RejectNode(const BVH_Vec3d& theCMin,
+                  const BVH_Vec3d& theCMax,
+                  bool&            theIsInside) const override
+  {
+    bool hasOverlap;
+    theIsInside = myBox.Contains(theCMin, theCMax, hasOverlap);
+    return !hasOverlap;
+  }
+
+  bool AcceptMetric(const bool& theIsInside) const override { return theIsInside; }
+
+  bool Accept(const int theIndex, const bool& theIsInside) override
+  {
+    if (theIsInside || !myBox.IsOut(myBVHSet->Box(theIndex)))
+    {
+      myIndices.Append(myBVHSet->Element(theIndex));
+      return true;
+    }
+    return false;
+  }
+
+private:
+  BVH_Box<double, 3>       myBox;
+  NCollection_Vector<int>& myIndices;
+};
+
+//! Returns the box of the two points.
+BVH_Box<double, 3> pointsBox(const gp_XYZ& theP1, const gp_XYZ& theP2)
+{
+  BVH_Box<double, 3> aBox(BVH_Vec3d(theP1.X(), theP1.Y(), theP1.Z()));
+  aBox.Add(BVH_Vec3d(theP2.X(), theP2.Y(), theP2.Z()));
+  return aBox;
+}
+} // namespace
+
 //=================================================================================================
 
 HLRAlgo_PolyAlgo::HLRAlgo_PolyAlgo()
@@ -50,6 +103,8 @@ void HLRAlgo_PolyAlgo::Clear()
   NCollection_Array1<occ::handle<HLRAlgo_PolyShellData>> anEmpty;
   myHShell.Move(anEmpty);
   myNbrShell = 0;
+  myTriangleTree.Nullify();
+  myHidingTriangles.Clear();
 }
 
 //=================================================================================================
@@ -372,6 +427,47 @@ void HLRAlgo_PolyAlgo::Update()
       aShellIndices.Max = 0;
     }
   }
+
+  // BVH of the hiding triangles, in the order of the shells and of the faces.
+  // The boxes are enlarged by two cells of the integer min-max used in the
+  // exact rejection, so that the BVH never rejects an accepted triangle.
+  const BVH_Vec3d aMargin(2. / SurDX, 2. / SurDY, 2. / SurDZ);
+  myHidingTriangles.Clear();
+  myTriangleTree = new BVH_BoxSet<double, 3, int>(new BVH_LinearBuilder<double, 3>());
+  for (int aShellIter = myHShell.Lower(); aShellIter <= myHShell.Upper(); ++aShellIter)
+  {
+    const occ::handle<HLRAlgo_PolyShellData>& aPsd = myHShell.ChangeValue(aShellIter);
+    if (!aPsd->Hiding())
+    {
+      continue;
+    }
+
+    NCollection_Array1<occ::handle<HLRAlgo_PolyData>>& aFace = aPsd->HidingPolyData();
+    for (int f = aFace.Lower(); f <= aFace.Upper(); f++)
+    {
+      const occ::handle<HLRAlgo_PolyData>&        aPd   = aFace.Value(f);
+      NCollection_Array1<gp_XYZ>&                 Nodes = aPd->Nodes();
+      NCollection_Array1<HLRAlgo_TriangleData>&   TData = aPd->TData();
+      NCollection_Array1<HLRAlgo_PolyHidingData>& PHDat = aPd->PHDat();
+      for (int h = PHDat.Lower(); h <= PHDat.Upper(); h++)
+      {
+        const HLRAlgo_TriangleData& aTD = TData.Value(PHDat(h).Indices().Index);
+        const gp_XYZ&               P1  = Nodes.Value(aTD.Node1);
+        const gp_XYZ&               P2  = Nodes.Value(aTD.Node2);
+        const gp_XYZ&               P3  = Nodes.Value(aTD.Node3);
+        BVH_Box<double, 3>          aBox = pointsBox(P1, P2);
+        aBox.Add(BVH_Vec3d(P3.X(), P3.Y(), P3.Z()));
+        aBox.CornerMin() -= aMargin;
+        aBox.CornerMax() += aMargin;
+        myTriangleTree->Add(myHidingTriangles.Length(), aBox);
+        HidingTriangle& aTriangle = myHidingTriangles.Appended();
+        aTriangle.Face            = aPd;
+        aTriangle.Shell           = aShellIter;
+        aTriangle.Index           = h;
+      }
+    }
+  }
+  myTriangleTree->Build();
 }
 
 //=================================================================================================
@@ -415,42 +511,66 @@ HLRAlgo_BiPoint::PointsT& HLRAlgo_PolyAlgo::Hide(HLRAlgo_EdgeStatus& theStatus,
                                                  bool&               theOutl,
                                                  bool&               theIntl)
 {
-  HLRAlgo_BiPoint&           aBP       = mySegListIt.ChangeValue();
-  HLRAlgo_BiPoint::PointsT&  aPoints   = aBP.Points();
-  HLRAlgo_BiPoint::IndicesT& anIndices = aBP.Indices();
+  return Hide(mySegListIt.ChangeValue(),
+              myCurShell,
+              theStatus,
+              theIndex,
+              theReg1,
+              theRegn,
+              theOutl,
+              theIntl);
+}
+
+//=================================================================================================
+
+HLRAlgo_BiPoint::PointsT& HLRAlgo_PolyAlgo::Hide(HLRAlgo_BiPoint&    theBiPoint,
+                                                 const int           theShell,
+                                                 HLRAlgo_EdgeStatus& theStatus,
+                                                 int&                theIndex,
+                                                 bool&               theReg1,
+                                                 bool&               theRegn,
+                                                 bool&               theOutl,
+                                                 bool&               theIntl) const
+{
+  HLRAlgo_BiPoint::PointsT&  aPoints   = theBiPoint.Points();
+  HLRAlgo_BiPoint::IndicesT& anIndices = theBiPoint.Indices();
   theStatus = HLRAlgo_EdgeStatus(0.0, (float)myTriangle.TolParam, 1.0, (float)myTriangle.TolParam);
   theIndex  = anIndices.ShapeIndex;
-  theReg1   = aBP.Rg1Line();
-  theRegn   = aBP.RgNLine();
-  theOutl   = aBP.OutLine();
-  theIntl   = aBP.IntLine();
-  if (aBP.Hidden())
+  theReg1   = theBiPoint.Rg1Line();
+  theRegn   = theBiPoint.RgNLine();
+  theOutl   = theBiPoint.OutLine();
+  theIntl   = theBiPoint.IntLine();
+  if (theBiPoint.Hidden())
   {
     theStatus.HideAll();
     return aPoints;
   }
-
-  for (int s = 1; s <= myNbrShell; s++)
+  if (myTriangleTree.IsNull() || myHidingTriangles.IsEmpty())
   {
-    const occ::handle<HLRAlgo_PolyShellData>& aPsd = myHShell.ChangeValue(s);
-    if (!aPsd->Hiding())
-    {
-      continue;
-    }
+    return aPoints;
+  }
 
-    HLRAlgo_PolyShellData::ShellIndices& aShellIndices = aPsd->Indices();
-    if (((aShellIndices.Max - anIndices.MinSeg) & 0x80100200) == 0
-        && ((anIndices.MaxSeg - aShellIndices.Min) & 0x80100000) == 0)
-    {
-      const bool                                         isHidingShell = (s == myCurShell);
-      NCollection_Array1<occ::handle<HLRAlgo_PolyData>>& aFace         = aPsd->HidingPolyData();
-      const int                                          nbFace        = aFace.Upper();
-      for (int f = 1; f <= nbFace; f++)
-      {
-        const occ::handle<HLRAlgo_PolyData>& aPd = aFace.ChangeValue(f);
-        aPd->HideByPolyData(aPoints, myTriangle, anIndices, isHidingShell, theStatus);
-      }
-    }
+  // in depth, only the triangles below the segment are rejected, as in the
+  // integer min-max test; the selected triangles are processed in the order
+  // of the shells and of the faces to give the same status as before
+  BVH_Box<double, 3> aBox = pointsBox(aPoints.PntP1, aPoints.PntP2);
+  aBox.CornerMax().z()    = Precision::Infinite();
+  NCollection_Vector<int>           aSelected(64);
+  HLRAlgo_PolyAlgo_TriangleSelector aSelector(aBox, aSelected);
+  aSelector.SetBVHSet(myTriangleTree.get());
+  aSelector.Select();
+  std::sort(aSelected.begin(), aSelected.end());
+
+  HLRAlgo_PolyData::Triangle aTriangle = myTriangle;
+  for (NCollection_Vector<int>::Iterator anIt(aSelected); anIt.More(); anIt.Next())
+  {
+    const HidingTriangle& aHiding = myHidingTriangles.Value(anIt.Value());
+    aHiding.Face->HideByTriangle(aPoints,
+                                 aTriangle,
+                                 anIndices,
+                                 aHiding.Shell == theShell,
+                                 aHiding.Index,
+                                 theStatus);
   }
   return aPoints;
 }
@@ -19,7 +19,9 @@
 
 #include <HLRAlgo_PolyData.hxx>
 #include <HLRAlgo_BiPoint.hxx>
+#include <BVH_BoxSet.hxx>
 #include <NCollection_List.hxx>
+#include <NCollection_Vector.hxx>
 
 class HLRAlgo_EdgeStatus;
 class HLRAlgo_PolyShellData;
@@ -43,6 +45,7 @@ public:
   Standard_EXPORT void Clear();
 
   //! Prepare all the data to process the algo.
+  //! Builds the BVH of the boxes of the hiding triangles.
   Standard_EXPORT void Update();
 
   void InitHide()
@@ -63,6 +66,18 @@ public:
                                                  bool&               outl,
                                                  bool&               intl);
 
+  //! process hiding of the segment <theBiPoint> of the
+  //! shell <theShell>. The iteration is not used so it
+  //! can be called concurrently for different segments.
+  Standard_EXPORT HLRAlgo_BiPoint::PointsT& Hide(HLRAlgo_BiPoint&    theBiPoint,
+                                                 const int           theShell,
+                                                 HLRAlgo_EdgeStatus& status,
+                                                 int&                Index,
+                                                 bool&               reg1,
+                                                 bool&               regn,
+                                                 bool&               outl,
+                                                 bool&               intl) const;
+
   void InitShow()
   {
     myCurShell = 0;
@@ -82,8 +97,19 @@ public:
 
   DEFINE_STANDARD_RTTIEXT(HLRAlgo_PolyAlgo, Standard_Transient)
 
+private:
+  //! Hiding triangle referenced by the BVH.
+  struct HidingTriangle
+  {
+    occ::handle<HLRAlgo_PolyData> Face;  //!< hiding face
+    int                           Shell; //!< index of the shell of the face
+    int                           Index; //!< index in PHDat of the face
+  };
+
 private:
   NCollection_Array1<occ::handle<HLRAlgo_PolyShellData>> myHShell;
+  occ::handle<BVH_BoxSet<double, 3, int>>                myTriangleTree;
+  NCollection_Vector<HidingTriangle>                     myHidingTriangles;
   HLRAlgo_PolyData::Triangle                             myTriangle;
   NCollection_List<HLRAlgo_BiPoint>::Iterator            mySegListIt;
   int                                                    myNbrShell;
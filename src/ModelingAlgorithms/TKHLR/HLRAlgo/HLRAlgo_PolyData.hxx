@@ -86,6 +86,17 @@ public:
                                       const bool                      HidingShell,
                                       HLRAlgo_EdgeStatus&             status);
 
+  //! process hiding between <Pt1> and <Pt2> by the
+  //! hiding triangle of index <theHidingIndex> in PHDat.
+  //! Only <theTriangle> and <status> are modified, so
+  //! the triangles can be used concurrently.
+  Standard_EXPORT void HideByTriangle(const HLRAlgo_BiPoint::PointsT& thePoints,
+                                      Triangle&                       theTriangle,
+                                      HLRAlgo_BiPoint::IndicesT&      theIndices,
+                                      const bool                      HidingShell,
+                                      const int                       theHidingIndex,
+                                      HLRAlgo_EdgeStatus&             status);
+
   FaceIndices& Indices() { return myFaceIndices; }
 
   DEFINE_STANDARD_RTTIEXT(HLRAlgo_PolyData, Standard_Transient)
@@ -587,6 +587,63 @@ void HLRBRep_Data::Write(const occ::handle<HLRBRep_Data>& DS,
 
 //=================================================================================================
 
+occ::handle<HLRBRep_Data> HLRBRep_Data::Copy() const
+{
+  occ::handle<HLRBRep_Data> aCopy = new HLRBRep_Data(myNbVertices, myNbEdges, myNbFaces);
+  aCopy->myEMap      = myEMap;
+  aCopy->myFMap      = myFMap;
+  aCopy->myToler     = myToler;
+  aCopy->myProj      = myProj;
+  aCopy->myBigSize   = myBigSize;
+  aCopy->myHideCount = myHideCount;
+  for (int i = 0; i <= 15; i++)
+  {
+    aCopy->myDeca[i] = myDeca[i];
+    aCopy->mySurD[i] = mySurD[i];
+  }
+
+  // the adaptors are initialized again to not share the evaluation caches
+  for (int edge = 1; edge <= myNbEdges; edge++)
+  {
+    HLRBRep_EdgeData& ed = aCopy->myEData.ChangeValue(edge);
+    ed                   = myEData.Value(edge);
+    HLRBRep_Curve&    EC = ed.ChangeGeometry();
+    const TopoDS_Edge E  = EC.GetCurve().Edge();
+    EC.Curve(E);
+    EC.Projector(&aCopy->myProj);
+  }
+
+  for (int face = 1; face <= myNbFaces; face++)
+  {
+    HLRBRep_FaceData& fd = aCopy->myFData.ChangeValue(face);
+    fd                   = myFData.Value(face);
+    HLRBRep_Surface&  FS = fd.Geometry();
+    const TopoDS_Face F  = FS.Surface().Face();
+    FS.Surface(F);
+    FS.Projector(&aCopy->myProj);
+  }
+  return aCopy;
+}
+
+//=================================================================================================
+
+void HLRBRep_Data::CopyState(const occ::handle<HLRBRep_Data>& DS,
+                             const int                        e1,
+                             const int                        e2,
+                             const int                        f1,
+                             const int                        f2)
+{
+  for (int edge = e1; edge <= e2; edge++)
+    myEData.ChangeValue(edge).CopyState(DS->myEData.Value(edge));
+
+  for (int face = f1; face <= f2; face++)
+    myFData.ChangeValue(face).CopyState(DS->myFData.Value(face));
+
+  myHideCount = DS->myHideCount;
+}
+
+//=================================================================================================
+
 void HLRBRep_Data::Update(const HLRAlgo_Projector& P)
 {
   myProj           = P;
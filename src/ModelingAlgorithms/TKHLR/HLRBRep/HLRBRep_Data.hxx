@@ -67,6 +67,18 @@ public:
                              const int                        de,
                              const int                        df);
 
+  //! Returns a copy of me with its own curve and surface
+  //! adaptors, which can be hidden in another thread.
+  Standard_EXPORT occ::handle<HLRBRep_Data> Copy() const;
+
+  //! Copies from <DS> the hiding state of the edges
+  //! <e1>..<e2> and of the faces <f1>..<f2>.
+  Standard_EXPORT void CopyState(const occ::handle<HLRBRep_Data>& DS,
+                                 const int                        e1,
+                                 const int                        e2,
+                                 const int                        f1,
+                                 const int                        f2);
+
   NCollection_Array1<HLRBRep_EdgeData>& EDataArray();
 
   NCollection_Array1<HLRBRep_FaceData>& FDataArray();
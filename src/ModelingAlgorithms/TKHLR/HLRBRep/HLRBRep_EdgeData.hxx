@@ -129,6 +129,15 @@ public:
 
   HLRAlgo_EdgesBlock::MinMaxIndices& MinMax() { return myMinMax; }
 
+  //! Copies the flags, the hide count and the status
+  //! of <theOther>, the geometry is kept.
+  void CopyState(const HLRBRep_EdgeData& theOther)
+  {
+    myFlags     = theOther.myFlags;
+    myHideCount = theOther.myHideCount;
+    myStatus    = theOther.myStatus;
+  }
+
   HLRAlgo_EdgeStatus& Status();
 
   HLRBRep_Curve& ChangeGeometry();
@@ -123,6 +123,9 @@ public:
 
   float Tolerance() const;
 
+  //! Copies the flags of <theOther>, the geometry is kept.
+  void CopyState(const HLRBRep_FaceData& theOther) { myFlags = theOther.myFlags; }
+
 protected:
   enum EMaskFlags
   {
@@ -30,6 +30,7 @@
 #include <fstream>
 #include <Standard_Type.hxx>
 #include <NCollection_Array1.hxx>
+#include <OSD_Parallel.hxx>
 
 #include <cstdio>
 IMPLEMENT_STANDARD_RTTIEXT(HLRBRep_InternalAlgo, Standard_Transient)
@@ -48,7 +49,8 @@ static int HLRBRep_InternalAlgo_TRACE10 = true;
 //=================================================================================================
 
 HLRBRep_InternalAlgo::HLRBRep_InternalAlgo()
-    : myDebug(false)
+    : myDebug(false),
+      myRunParallel(false)
 {
 }
 
@@ -56,10 +58,11 @@ HLRBRep_InternalAlgo::HLRBRep_InternalAlgo()
 
 HLRBRep_InternalAlgo::HLRBRep_InternalAlgo(const occ::handle<HLRBRep_InternalAlgo>& A)
 {
-  myDS     = A->DataStructure();
-  myProj   = A->Projector();
-  myShapes = A->SeqOfShapeBounds();
-  myDebug  = A->Debug();
+  myDS          = A->DataStructure();
+  myProj        = A->Projector();
+  myShapes      = A->SeqOfShapeBounds();
+  myDebug       = A->Debug();
+  myRunParallel = A->RunParallel();
 }
 
 //=================================================================================================
@@ -142,6 +145,8 @@ void HLRBRep_InternalAlgo::Update()
     delete[] DS;
 
     myDS->Update(myProj);
+    myThreadDS.Clear();
+    myThreadMST.Clear();
 
     HLRAlgo_EdgesBlock::MinMaxIndices     ShapMin, ShapMax, MinMaxShap;
     HLRAlgo_EdgesBlock::MinMaxIndices     TheMin, TheMax;
@@ -188,6 +193,8 @@ void HLRBRep_InternalAlgo::Load(const occ::handle<HLRTopoBRep_OutLiner>& S,
 {
   myShapes.Append(HLRBRep_ShapeBounds(S, SData, nbIso, 0, 0, 0, 0, 0, 0));
   myDS.Nullify();
+  myThreadDS.Clear();
+  myThreadMST.Clear();
 }
 
 //=================================================================================================
@@ -196,6 +203,8 @@ void HLRBRep_InternalAlgo::Load(const occ::handle<HLRTopoBRep_OutLiner>& S, cons
 {
   myShapes.Append(HLRBRep_ShapeBounds(S, nbIso, 0, 0, 0, 0, 0, 0));
   myDS.Nullify();
+  myThreadDS.Clear();
+  myThreadMST.Clear();
 }
 
 //=================================================================================================
@@ -221,6 +230,8 @@ void HLRBRep_InternalAlgo::Remove(const int I)
 
   myMapOfShapeTool.Clear();
   myDS.Nullify();
+  myThreadDS.Clear();
+  myThreadMST.Clear();
 }
 
 //=================================================================================================
@@ -852,39 +863,55 @@ void HLRBRep_InternalAlgo::HideSelected(const int I, const bool SideFace)
       }
     }
 
-    j = 0;
-
-    QWE = 0;
-    for (f = 1; f <= nf; f++)
+    const int aNbThreads =
+      myRunParallel ? std::min(OSD_Parallel::NbLogicalProcessors(), e2 - e1 + 1) : 1;
+    if (aNbThreads > 1)
     {
-      int               fi = Index(f);
-      HLRBRep_FaceData& fd = aFDataArray.ChangeValue(fi);
-      if (fd.Selected())
+      NCollection_Vector<int> aHidingFaces;
+      for (f = 1; f <= nf; f++)
+      {
+        const HLRBRep_FaceData& fd = aFDataArray.Value(Index(f));
+        if (fd.Selected() && fd.Hiding())
+          aHidingFaces.Append(Index(f));
+      }
+      HideSelectedParallel(I, aHidingFaces, aNbThreads);
+    }
+    else
+    {
+      j = 0;
+
+      QWE = 0;
+      for (f = 1; f <= nf; f++)
       {
-        if (fd.Hiding())
+        int               fi = Index(f);
+        HLRBRep_FaceData& fd = aFDataArray.ChangeValue(fi);
+        if (fd.Selected())
         {
-          if (HLRBRep_InternalAlgo_TRACE10 && HLRBRep_InternalAlgo_TRACE == false)
+          if (fd.Hiding())
           {
-            if (++QWE > QWEQWE)
+            if (HLRBRep_InternalAlgo_TRACE10 && HLRBRep_InternalAlgo_TRACE == false)
             {
-              if (myDebug)
-                std::cout << ".";
-              QWE = 0;
+              if (++QWE > QWEQWE)
+              {
+                if (myDebug)
+                  std::cout << ".";
+                QWE = 0;
+              }
             }
-          }
-          else if (myDebug && HLRBRep_InternalAlgo_TRACE)
-          {
-            static int rty = 0;
-            j++;
-            printf("%6d", fi);
-            fflush(stdout);
-            if (++rty > 25)
+            else if (myDebug && HLRBRep_InternalAlgo_TRACE)
             {
-              rty = 0;
-              printf("\n");
+              static int rty = 0;
+              j++;
+              printf("%6d", fi);
+              fflush(stdout);
+              if (++rty > 25)
+              {
+                rty = 0;
+                printf("\n");
+              }
             }
+            Cache.Hide(fi, myMapOfShapeTool);
           }
-          Cache.Hide(fi, myMapOfShapeTool);
         }
       }
     }
@@ -924,6 +951,72 @@ void HLRBRep_InternalAlgo::HideSelected(const int I, const bool SideFace)
 
 //=================================================================================================
 
+void HLRBRep_InternalAlgo::HideSelectedParallel(const int                      I,
+                                                const NCollection_Vector<int>& theFaces,
+                                                const int                      theNbThreads)
+{
+  if (theFaces.IsEmpty())
+    return;
+
+  HLRBRep_ShapeBounds& SB = myShapes(I);
+  int                  v1, v2, e1, e2, f1, f2;
+  SB.Bounds(v1, v2, e1, e2, f1, f2);
+
+  // bounds of the hiding faces and of the edges of their shapes,
+  // the own hiding of these faces changes the state of their edges
+  int hf1 = theFaces.First(), hf2 = hf1;
+  for (NCollection_Vector<int>::Iterator anIt(theFaces); anIt.More(); anIt.Next())
+  {
+    hf1 = std::min(hf1, anIt.Value());
+    hf2 = std::max(hf2, anIt.Value());
+  }
+  int he1 = myDS->NbEdges() + 1, he2 = 0;
+  for (int i = 1; i <= myShapes.Length(); i++)
+  {
+    int sv1, sv2, se1, se2, sf1, sf2;
+    myShapes(i).Bounds(sv1, sv2, se1, se2, sf1, sf2);
+    if (sf1 <= hf2 && sf2 >= hf1)
+    {
+      he1 = std::min(he1, se1);
+      he2 = std::max(he2, se2);
+    }
+  }
+
+  while (myThreadDS.Length() < theNbThreads)
+  {
+    myThreadDS.Append(myDS->Copy());
+    myThreadMST.Append(
+      NCollection_DataMap<TopoDS_Shape, BRepTopAdaptor_Tool, TopTools_ShapeMapHasher>());
+  }
+
+  // each thread hides a range of the edges with its own copy of the
+  // DataStructure, the faces are processed in the same order as in
+  // the sequential hiding so the owned edges get the same state
+  const int aNbEdges = e2 - e1 + 1;
+  OSD_Parallel::For(0, theNbThreads, [&](const int theThread) {
+    const occ::handle<HLRBRep_Data>& aDS    = myThreadDS(theThread);
+    const int                        aFirst = e1 + aNbEdges * theThread / theNbThreads;
+    const int                        aLast  = e1 + aNbEdges * (theThread + 1) / theNbThreads - 1;
+    aDS->CopyState(myDS, aFirst, aLast, 1, 0);
+    aDS->CopyState(myDS, he1, he2, hf1, hf2);
+    aDS->InitBoundSort(SB.MinMax(), aFirst, aLast);
+    HLRBRep_Hider aHider(aDS);
+    for (NCollection_Vector<int>::Iterator anIt(theFaces); anIt.More(); anIt.Next())
+      aHider.Hide(anIt.Value(), myThreadMST(theThread));
+  });
+
+  // the own hiding of the faces is the same in all the copies
+  myDS->CopyState(myThreadDS(0), he1, he2, hf1, hf2);
+  for (int t = 0; t < theNbThreads; t++)
+  {
+    const int aFirst = e1 + aNbEdges * t / theNbThreads;
+    const int aLast  = e1 + aNbEdges * (t + 1) / theNbThreads - 1;
+    myDS->CopyState(myThreadDS(t), aFirst, aLast, 1, 0);
+  }
+}
+
+//=================================================================================================
+
 void HLRBRep_InternalAlgo::Debug(const bool deb)
 {
   myDebug = deb;
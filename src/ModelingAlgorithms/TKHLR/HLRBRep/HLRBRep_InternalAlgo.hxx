@@ -27,6 +27,7 @@
 #include <BRepTopAdaptor_Tool.hxx>
 #include <TopTools_ShapeMapHasher.hxx>
 #include <NCollection_DataMap.hxx>
+#include <NCollection_Vector.hxx>
 #include <Standard_Transient.hxx>
 #include <Standard_Integer.hxx>
 class HLRBRep_Data;
@@ -119,6 +120,15 @@ public:
 
   Standard_EXPORT bool Debug() const;
 
+  //! Sets the flag of parallel hiding. When set, the
+  //! edges of a shape are shared between threads, each
+  //! one hiding its edges with its own copy of the
+  //! DataStructure. The result does not depend on it.
+  void SetRunParallel(const bool theIsParallel) { myRunParallel = theIsParallel; }
+
+  //! Returns the flag of parallel hiding.
+  bool RunParallel() const { return myRunParallel; }
+
   Standard_EXPORT occ::handle<HLRBRep_Data> DataStructure() const;
 
   DEFINE_STANDARD_RTTIEXT(HLRBRep_InternalAlgo, Standard_Transient)
@@ -129,11 +139,22 @@ private:
   //! DataStructure.
   Standard_EXPORT void HideSelected(const int I, const bool SideFace);
 
+  //! hiding of the selected edges of the Shape <I> by
+  //! the faces <theFaces> in <theNbThreads> threads.
+  Standard_EXPORT void HideSelectedParallel(const int                      I,
+                                            const NCollection_Vector<int>& theFaces,
+                                            const int                      theNbThreads);
+
   occ::handle<HLRBRep_Data>                                                       myDS;
   HLRAlgo_Projector                                                               myProj;
   NCollection_Sequence<HLRBRep_ShapeBounds>                                       myShapes;
   NCollection_DataMap<TopoDS_Shape, BRepTopAdaptor_Tool, TopTools_ShapeMapHasher> myMapOfShapeTool;
   bool                                                                            myDebug;
+  bool                                                                            myRunParallel;
+  NCollection_Vector<occ::handle<HLRBRep_Data>>                                   myThreadDS;
+  NCollection_Vector<
+    NCollection_DataMap<TopoDS_Shape, BRepTopAdaptor_Tool, TopTools_ShapeMapHasher>>
+    myThreadMST;
 };
 
 #endif // _HLRBRep_InternalAlgo_HeaderFile
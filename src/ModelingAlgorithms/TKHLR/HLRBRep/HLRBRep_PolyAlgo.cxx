@@ -72,6 +72,7 @@ static int DoError = false;
 
 HLRBRep_PolyAlgo::HLRBRep_PolyAlgo()
     : myDebug(false),
+      myRunParallel(false),
       myTolSta(0.1),
       myTolEnd(0.9),
       myTolAngular(0.001)
@@ -83,12 +84,13 @@ HLRBRep_PolyAlgo::HLRBRep_PolyAlgo()
 
 HLRBRep_PolyAlgo::HLRBRep_PolyAlgo(const occ::handle<HLRBRep_PolyAlgo>& theOther)
 {
-  myDebug      = theOther->Debug();
-  myTolAngular = theOther->TolAngular();
-  myTolSta     = theOther->TolCoef();
-  myTolEnd     = 1.0 - myTolSta;
-  myAlgo       = theOther->Algo();
-  myProj       = theOther->Projector();
+  myDebug       = theOther->Debug();
+  myRunParallel = theOther->RunParallel();
+  myTolAngular  = theOther->TolAngular();
+  myTolSta      = theOther->TolCoef();
+  myTolEnd      = 1.0 - myTolSta;
+  myAlgo        = theOther->Algo();
+  myProj        = theOther->Projector();
 
   const int aNbShapes = theOther->NbShapes();
   for (int i = 1; i <= aNbShapes; ++i)
@@ -101,6 +103,7 @@ HLRBRep_PolyAlgo::HLRBRep_PolyAlgo(const occ::handle<HLRBRep_PolyAlgo>& theOther
 
 HLRBRep_PolyAlgo::HLRBRep_PolyAlgo(const TopoDS_Shape& theShape)
     : myDebug(false),
+      myRunParallel(false),
       myTolSta(0.1),
       myTolEnd(0.9),
       myTolAngular(0.001)
@@ -4383,6 +4386,24 @@ HLRAlgo_BiPoint::PointsT& HLRBRep_PolyAlgo::Hide(HLRAlgo_EdgeStatus& theStatus,
 
 //=================================================================================================
 
+HLRAlgo_BiPoint::PointsT& HLRBRep_PolyAlgo::Hide(HLRAlgo_BiPoint&    theBiPoint,
+                                                 const int           theShell,
+                                                 HLRAlgo_EdgeStatus& theStatus,
+                                                 TopoDS_Shape&       theShape,
+                                                 bool&               theReg1,
+                                                 bool&               theRegn,
+                                                 bool&               theOutl,
+                                                 bool&               theIntl) const
+{
+  int                       anIndex = 0;
+  HLRAlgo_BiPoint::PointsT& aPoints =
+    myAlgo->Hide(theBiPoint, theShell, theStatus, anIndex, theReg1, theRegn, theOutl, theIntl);
+  theShape = theIntl ? myFMap(anIndex) : myEMap(anIndex);
+  return aPoints;
+}
+
+//=================================================================================================
+
 HLRAlgo_BiPoint::PointsT& HLRBRep_PolyAlgo::Show(TopoDS_Shape& theShape,
                                                  bool&         theReg1,
                                                  bool&         theRegn,
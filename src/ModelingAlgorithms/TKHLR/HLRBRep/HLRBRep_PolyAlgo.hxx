@@ -160,6 +160,18 @@ public:
                                                  bool&               outl,
                                                  bool&               intl);
 
+  //! Hiding of the segment <theBiPoint> of the shell
+  //! <theShell>, which can be called concurrently for
+  //! different segments.
+  Standard_EXPORT HLRAlgo_BiPoint::PointsT& Hide(HLRAlgo_BiPoint&    theBiPoint,
+                                                 const int           theShell,
+                                                 HLRAlgo_EdgeStatus& status,
+                                                 TopoDS_Shape&       S,
+                                                 bool&               reg1,
+                                                 bool&               regn,
+                                                 bool&               outl,
+                                                 bool&               intl) const;
+
   void InitShow() { myAlgo->InitShow(); }
 
   bool MoreShow() const { return myAlgo->MoreShow(); }
@@ -180,6 +192,13 @@ public:
 
   void Debug(const bool theDebug) { myDebug = theDebug; }
 
+  //! Sets the flag of parallel hiding of the segments
+  //! by HLRBRep_PolyHLRToShape.
+  void SetRunParallel(const bool theIsParallel) { myRunParallel = theIsParallel; }
+
+  //! Returns the flag of parallel hiding.
+  bool RunParallel() const { return myRunParallel; }
+
   DEFINE_STANDARD_RTTIEXT(HLRBRep_PolyAlgo, Standard_Transient)
 
 private:
@@ -624,6 +643,7 @@ private:
   NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> myFMap;
   occ::handle<HLRAlgo_PolyAlgo>                                 myAlgo;
   bool                                                          myDebug;
+  bool                                                          myRunParallel;
   double                                                        myTolSta;
   double                                                        myTolEnd;
   double                                                        myTolAngular;
@@ -20,6 +20,7 @@
 #include <BRepLib_MakeEdge2d.hxx>
 #include <HLRAlgo_EdgeIterator.hxx>
 #include <HLRAlgo_EdgeStatus.hxx>
+#include <HLRAlgo_PolyShellData.hxx>
 #include <HLRBRep_PolyAlgo.hxx>
 #include <HLRBRep_PolyHLRToShape.hxx>
 #include <TopExp_Explorer.hxx>
@@ -27,6 +28,64 @@
 #include <TopoDS_Shape.hxx>
 #include <TopTools_ShapeMapHasher.hxx>
 #include <NCollection_Map.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_Parallel.hxx>
+
+#include <algorithm>
+
+namespace
+{
+//! Appends the visible and the hidden parts of the segment to the lists.
+void appendBiPoints(const HLRAlgo_BiPoint::PointsT&     thePoints,
+                    HLRAlgo_EdgeStatus&                 theStatus,
+                    const gp_Trsf&                      theTrsf,
+                    const TopoDS_Shape&                 theShape,
+                    const bool                          theReg1,
+                    const bool                          theRegn,
+                    const bool                          theOutl,
+                    const bool                          theIntl,
+                    NCollection_List<HLRBRep_BiPnt2D>& theVisible,
+                    NCollection_List<HLRBRep_BiPnt2D>& theHidden)
+{
+  double               sta, end;
+  float                tolsta, tolend;
+  HLRAlgo_EdgeIterator It;
+  gp_XYZ               aSta = thePoints.Pnt1;
+  gp_XYZ               aEnd = thePoints.Pnt2;
+  theTrsf.Transforms(aSta);
+  theTrsf.Transforms(aEnd);
+  const gp_XY aSta2D(aSta.X(), aSta.Y());
+  const gp_XY aEnd2D(aEnd.X(), aEnd.Y());
+  const gp_XY aD = aEnd2D - aSta2D;
+  if (aD.Modulus() > 1.e-10)
+  {
+
+    for (It.InitVisible(theStatus); It.MoreVisible(); It.NextVisible())
+    {
+      It.Visible(sta, tolsta, end, tolend);
+      theVisible.Append(HLRBRep_BiPnt2D(aSta2D + sta * aD,
+                                        aSta2D + end * aD,
+                                        theShape,
+                                        theReg1,
+                                        theRegn,
+                                        theOutl,
+                                        theIntl));
+    }
+
+    for (It.InitHidden(theStatus); It.MoreHidden(); It.NextHidden())
+    {
+      It.Hidden(sta, tolsta, end, tolend);
+      theHidden.Append(HLRBRep_BiPnt2D(aSta2D + sta * aD,
+                                       aSta2D + end * aD,
+                                       theShape,
+                                       theReg1,
+                                       theRegn,
+                                       theOutl,
+                                       theIntl));
+    }
+  }
+}
+} // namespace
 
 //=================================================================================================
 
@@ -38,9 +97,6 @@ void HLRBRep_PolyHLRToShape::Update(const occ::handle<HLRBRep_PolyAlgo>& A)
 {
   myAlgo     = A;
   myHideMode = true;
-  double               sta, end;
-  float                tolsta, tolend;
-  HLRAlgo_EdgeIterator It;
   myBiPntVis.Clear();
   myBiPntHid.Clear();
   TopoDS_Shape       S;
@@ -48,33 +104,75 @@ void HLRBRep_PolyHLRToShape::Update(const occ::handle<HLRBRep_PolyAlgo>& A)
   const gp_Trsf&     T = myAlgo->Projector().Transformation();
   HLRAlgo_EdgeStatus status;
 
-  for (myAlgo->InitHide(); myAlgo->MoreHide(); myAlgo->NextHide())
+  if (!myAlgo->RunParallel())
   {
-    HLRAlgo_BiPoint::PointsT& aPoints = myAlgo->Hide(status, S, reg1, regn, outl, intl);
-    gp_XYZ                    aSta    = aPoints.Pnt1;
-    gp_XYZ                    aEnd    = aPoints.Pnt2;
-    T.Transforms(aSta);
-    T.Transforms(aEnd);
-    const gp_XY aSta2D(aSta.X(), aSta.Y());
-    const gp_XY aEnd2D(aEnd.X(), aEnd.Y());
-    const gp_XY aD = aEnd2D - aSta2D;
-    if (aD.Modulus() > 1.e-10)
+    for (myAlgo->InitHide(); myAlgo->MoreHide(); myAlgo->NextHide())
     {
+      HLRAlgo_BiPoint::PointsT& aPoints = myAlgo->Hide(status, S, reg1, regn, outl, intl);
+      appendBiPoints(aPoints, status, T, S, reg1, regn, outl, intl, myBiPntVis, myBiPntHid);
+    }
+    return;
+  }
 
-      for (It.InitVisible(status); It.MoreVisible(); It.NextVisible())
-      {
-        It.Visible(sta, tolsta, end, tolend);
-        myBiPntVis.Append(
-          HLRBRep_BiPnt2D(aSta2D + sta * aD, aSta2D + end * aD, S, reg1, regn, outl, intl));
-      }
+  // segments of all the shells in the order of the sequential iteration
+  const NCollection_Array1<occ::handle<HLRAlgo_PolyShellData>>& aShells =
+    myAlgo->Algo()->PolyShell();
+  NCollection_Vector<HLRAlgo_BiPoint*> aSegments;
+  NCollection_Vector<int>              aSegmentShells;
+  for (int aShellIter = aShells.Lower(); aShellIter <= aShells.Upper(); ++aShellIter)
+  {
+    for (NCollection_List<HLRAlgo_BiPoint>::Iterator anIt(aShells(aShellIter)->Edges());
+         anIt.More();
+         anIt.Next())
+    {
+      aSegments.Append(&anIt.ChangeValue());
+      aSegmentShells.Append(aShellIter);
+    }
+  }
+  if (aSegments.IsEmpty())
+  {
+    return;
+  }
 
-      for (It.InitHidden(status); It.MoreHidden(); It.NextHidden())
-      {
-        It.Hidden(sta, tolsta, end, tolend);
-        myBiPntHid.Append(
-          HLRBRep_BiPnt2D(aSta2D + sta * aD, aSta2D + end * aD, S, reg1, regn, outl, intl));
-      }
+  // each chunk of segments fills its own lists, which are then
+  // concatenated in the order of the chunks
+  const int aNbSegments = aSegments.Length();
+  const int aNbChunks   = std::min(aNbSegments, 4 * OSD_Parallel::NbLogicalProcessors());
+  NCollection_Array1<NCollection_List<HLRBRep_BiPnt2D>> aVisible(0, aNbChunks - 1);
+  NCollection_Array1<NCollection_List<HLRBRep_BiPnt2D>> aHidden(0, aNbChunks - 1);
+  OSD_Parallel::For(0, aNbChunks, [&](const int theChunk) {
+    const int          aFirst = (int)((int64_t)aNbSegments * theChunk / aNbChunks);
+    const int          aLast  = (int)((int64_t)aNbSegments * (theChunk + 1) / aNbChunks);
+    TopoDS_Shape       aShape;
+    bool               isReg1, isRegn, isOutl, isIntl;
+    HLRAlgo_EdgeStatus aStatus;
+    for (int i = aFirst; i < aLast; i++)
+    {
+      HLRAlgo_BiPoint::PointsT& aPoints = myAlgo->Hide(*aSegments(i),
+                                                       aSegmentShells(i),
+                                                       aStatus,
+                                                       aShape,
+                                                       isReg1,
+                                                       isRegn,
+                                                       isOutl,
+                                                       isIntl);
+      appendBiPoints(aPoints,
+                     aStatus,
+                     T,
+                     aShape,
+                     isReg1,
+                     isRegn,
+                     isOutl,
+                     isIntl,
+                     aVisible(theChunk),
+                     aHidden(theChunk));
     }
+  });
+
+  for (int aChunk = 0; aChunk < aNbChunks; ++aChunk)
+  {
+    myBiPntVis.Append(aVisible(aChunk));
+    myBiPntHid.Append(aHidden(aChunk));
   }
 }
 
@@ -20,6 +20,7 @@
 #include <IMeshData_Curve.hxx>
 #include <BRepMesh_Delaun.hxx>
 #include <BRepMesh_ShapeTool.hxx>
+#include <BRepMesh_ThreadArena.hxx>
 #include <Standard_ErrorHandler.hxx>
 
 IMPLEMENT_STANDARD_RTTIEXT(BRepMesh_BaseMeshAlgo, IMeshTools_MeshAlgo)
@@ -38,23 +39,21 @@ void BRepMesh_BaseMeshAlgo::Perform(const IMeshData::IFaceHandle& theDFace,
                                     const IMeshTools_Parameters&  theParameters,
                                     const Message_ProgressRange&  theRange)
 {
+  // temporary structures are released before the arena, to let it be reused by the next face
+  BRepMesh_ThreadArena anArena;
   try
   {
     OCC_CATCH_SIGNALS
 
     myDFace      = theDFace;
     myParameters = theParameters;
-    myAllocator  = new NCollection_IncAllocator(IMeshData::MEMORY_BLOCK_SIZE_HUGE);
+    myAllocator  = anArena.Allocator();
     myStructure  = new BRepMesh_DataStructureOfDelaun(myAllocator);
     myNodesMap   = new VectorOfPnt(256, myAllocator);
     myUsedNodes  = new DMapOfIntegerInteger(1, myAllocator);
 
-    if (initDataStructure())
+    if (initDataStructure() && theRange.More())
     {
-      if (!theRange.More())
-      {
-        return;
-      }
       generateMesh(theRange);
       commitSurfaceTriangulation();
     }
@@ -21,7 +21,15 @@
 #include <gp_XY.hxx>
 #include <NCollection_CellFilter.hxx>
 
+#include <algorithm>
+#include <vector>
+
 //! Auxiliary class to find circles shot by the given point.
+//! Circles are stored as structure of arrays (centers and radii in separate compact arrays).
+//! Inspection only collects candidate circles of the cell, which are then tested in a batch
+//! by SelectShotCircles() with a branch-free loop over fixed-size blocks, that compilers are able
+//! to vectorize. The test itself is unchanged: point is considered inside of a circle when
+//! its squared distance to the center exceeds squared radius by not more than squared tolerance.
 class BRepMesh_CircleInspector : public NCollection_CellFilter_InspectorXY
 {
 public:
@@ -35,9 +43,11 @@ public:
                            const int                                    theReservedSize,
                            const occ::handle<NCollection_IncAllocator>& theAllocator)
       : mySqTolerance(theTolerance * theTolerance),
-        myResIndices(theAllocator),
-        myCircles(theReservedSize, theAllocator)
+        myResIndices(theAllocator)
   {
+    myCenterX.reserve(theReservedSize);
+    myCenterY.reserve(theReservedSize);
+    myRadius.reserve(theReservedSize);
   }
 
   //! Adds the circle to vector of circles at the given position.
@@ -45,43 +55,72 @@ public:
   //! @param theCircle circle to be added.
   void Bind(const int theIndex, const BRepMesh_Circle& theCircle)
   {
-    myCircles.SetValue(theIndex, theCircle);
+    if (size_t(theIndex) >= myRadius.size())
+    {
+      myCenterX.resize(theIndex + 1, 0.0);
+      myCenterY.resize(theIndex + 1, 0.0);
+      myRadius.resize(theIndex + 1, 0.0);
+    }
+    myCenterX[theIndex] = theCircle.Location().X();
+    myCenterY[theIndex] = theCircle.Location().Y();
+    myRadius[theIndex]  = theCircle.Radius();
   }
 
-  //! Resutns vector of registered circles.
-  const IMeshData::VectorOfCircle& Circles() const { return myCircles; }
+  //! Returns true if no circle has been registered.
+  bool IsEmpty() const { return myRadius.empty(); }
+
+  //! Returns number of registered circles (including deleted ones).
+  int NbCircles() const { return int(myRadius.size()); }
 
   //! Returns circle with the given index.
   //! @param theIndex index of circle.
   //! @return circle with the given index.
-  BRepMesh_Circle& Circle(const int theIndex) { return myCircles(theIndex); }
+  BRepMesh_Circle Circle(const int theIndex) const
+  {
+    return BRepMesh_Circle(gp_XY(myCenterX[theIndex], myCenterY[theIndex]), myRadius[theIndex]);
+  }
+
+  //! Marks circle with the given index as deleted;
+  //! it is purged from the cell filter on next inspection.
+  //! @param theIndex index of circle.
+  void Delete(const int theIndex)
+  {
+    if (myRadius[theIndex] > 0.)
+    {
+      myRadius[theIndex] = -1.;
+    }
+  }
 
   //! Set reference point to be checked.
   //! @param thePoint bullet point.
   void SetPoint(const gp_XY& thePoint)
   {
     myResIndices.Clear();
+    myCandidates.clear();
     myPoint = thePoint;
   }
 
   //! Returns list of circles shot by the reference point.
+  //! Should be called after SelectShotCircles().
   IMeshData::ListOfInteger& GetShotCircles() { return myResIndices; }
 
-  //! Performs inspection of a circle with the given index.
+  //! Performs inspection of a circle with the given index:
+  //! purges deleted circle or registers the circle as a candidate for SelectShotCircles().
   //! @param theTargetIndex index of a circle to be checked.
   //! @return status of the check.
   NCollection_CellFilter_Action Inspect(const int theTargetIndex)
   {
-    BRepMesh_Circle& aCircle = myCircles(theTargetIndex);
-    const double&    aRadius = aCircle.Radius();
-    if (aRadius < 0.)
+    if (myRadius[theTargetIndex] < 0.)
       return CellFilter_Purge;
 
-    gp_XY& aLoc = const_cast<gp_XY&>(aCircle.Location());
-
-    const double aDX = myPoint.ChangeCoord(1) - aLoc.ChangeCoord(1);
-    const double aDY = myPoint.ChangeCoord(2) - aLoc.ChangeCoord(2);
+    myCandidates.push_back(theTargetIndex);
+    return CellFilter_Keep;
+  }
 
+  //! Tests candidate circles collected by inspection against the reference point
+  //! and fills the list of shot circles keeping the order of inspection.
+  void SelectShotCircles()
+  {
     // This check is wrong. It is better to use
     //
     //   const double aR = aRadius + aToler;
@@ -98,11 +137,30 @@ public:
 
     // However, this change leads to hangs the test case "perf mesh bug27119".
     // So, this correction is better to be implemented in the future.
-
-    if ((aDX * aDX + aDY * aDY) - (aRadius * aRadius) <= mySqTolerance)
-      myResIndices.Append(theTargetIndex);
-
-    return CellFilter_Keep;
+    const int    aNbCandidates = int(myCandidates.size());
+    const int*   anIndices     = myCandidates.data();
+    const double aPntX         = myPoint.X();
+    const double aPntY         = myPoint.Y();
+    for (int aBlockStart = 0; aBlockStart < aNbCandidates; aBlockStart += THE_BLOCK_SIZE)
+    {
+      const int aBlockSize = (std::min)(THE_BLOCK_SIZE, aNbCandidates - aBlockStart);
+      bool      isShot[THE_BLOCK_SIZE];
+      for (int anIter = 0; anIter < aBlockSize; ++anIter)
+      {
+        const int    anIndex = anIndices[aBlockStart + anIter];
+        const double aDX     = aPntX - myCenterX[anIndex];
+        const double aDY     = aPntY - myCenterY[anIndex];
+        const double aRadius = myRadius[anIndex];
+        isShot[anIter]       = (aDX * aDX + aDY * aDY) - (aRadius * aRadius) <= mySqTolerance;
+      }
+      for (int anIter = 0; anIter < aBlockSize; ++anIter)
+      {
+        if (isShot[anIter])
+        {
+          myResIndices.Append(anIndices[aBlockStart + anIter]);
+        }
+      }
+    }
   }
 
   //! Checks indices for equality.
@@ -112,10 +170,18 @@ public:
   }
 
 private:
-  double                    mySqTolerance;
-  IMeshData::ListOfInteger  myResIndices;
-  IMeshData::VectorOfCircle myCircles;
-  gp_XY                     myPoint;
+  //! Number of circles tested at once.
+  static constexpr int THE_BLOCK_SIZE = 16;
+
+private:
+  double                   mySqTolerance;
+  IMeshData::ListOfInteger myResIndices;
+  // growing arrays are allocated from the heap instead of incremental allocator
+  std::vector<double>      myCenterX;    //!< X coordinates of circle centers
+  std::vector<double>      myCenterY;    //!< Y coordinates of circle centers
+  std::vector<double>      myRadius;     //!< circle radii, negative for deleted circles
+  std::vector<int>         myCandidates; //!< circles of inspected cell
+  gp_XY                    myPoint;
 };
 
 #endif
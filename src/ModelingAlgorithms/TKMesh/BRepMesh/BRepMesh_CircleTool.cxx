@@ -145,9 +145,7 @@ bool BRepMesh_CircleTool::Bind(const int    theIndex,
 
 void BRepMesh_CircleTool::Delete(const int theIndex)
 {
-  BRepMesh_Circle& aCircle = mySelector.Circle(theIndex);
-  if (aCircle.Radius() > 0.)
-    aCircle.SetRadius(-1);
+  mySelector.Delete(theIndex);
 }
 
 //=================================================================================================
@@ -156,6 +154,7 @@ IMeshData::ListOfInteger& BRepMesh_CircleTool::Select(const gp_XY& thePoint)
 {
   mySelector.SetPoint(thePoint);
   myCellFilter.Inspect(thePoint, mySelector);
+  mySelector.SelectShotCircles();
   return mySelector.GetShotCircles();
 }
 
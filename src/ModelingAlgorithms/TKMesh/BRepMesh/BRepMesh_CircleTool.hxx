@@ -72,7 +72,7 @@ public:
   }
 
   //! Returns true if cell filter contains no circle.
-  bool IsEmpty() const { return mySelector.Circles().IsEmpty(); }
+  bool IsEmpty() const { return mySelector.IsEmpty(); }
 
   //! Binds the circle to the tool.
   //! @param theIndex index a circle should be bound with.
@@ -31,6 +31,7 @@
 #include <BRepMesh_Triangle.hxx>
 
 #include <NCollection_Vector.hxx>
+#include <OSD_MemInfo.hxx>
 
 #include <algorithm>
 #include <stack>
@@ -149,7 +150,7 @@ BRepMesh_Delaun::BRepMesh_Delaun(const occ::handle<BRepMesh_DataStructureOfDelau
                                  const int                                          theCellsCountV,
                                  const bool                                         isFillCircles)
     : myMeshData(theOldMesh),
-      myCircles(new NCollection_IncAllocator(IMeshData::MEMORY_BLOCK_SIZE_HUGE)),
+      myCircles(myCirclesArena.Allocator()),
       mySupVert(3),
       myInitCircles(false)
 {
@@ -164,16 +165,16 @@ BRepMesh_Delaun::BRepMesh_Delaun(const occ::handle<BRepMesh_DataStructureOfDelau
 // purpose  : Creates the triangulation with an empty Mesh data structure
 //=======================================================================
 BRepMesh_Delaun::BRepMesh_Delaun(IMeshData::Array1OfVertexOfDelaun& theVertices)
-    : myCircles(theVertices.Length(),
-                new NCollection_IncAllocator(IMeshData::MEMORY_BLOCK_SIZE_HUGE)),
+    : myCircles(theVertices.Length(), myCirclesArena.Allocator()),
       mySupVert(3),
       myInitCircles(false)
 {
   if (theVertices.Length() > 2)
   {
-    myMeshData = new BRepMesh_DataStructureOfDelaun(
-      new NCollection_IncAllocator(IMeshData::MEMORY_BLOCK_SIZE_HUGE),
-      theVertices.Length());
+    occ::handle<NCollection_IncAllocator> anAllocator =
+      new NCollection_IncAllocator(IMeshData::MEMORY_BLOCK_SIZE_HUGE);
+    anAllocator->SetMemTag(OSD_MemInfo::MemTag_Mesh);
+    myMeshData = new BRepMesh_DataStructureOfDelaun(anAllocator, theVertices.Length());
     Init(theVertices);
   }
 }
@@ -185,8 +186,7 @@ BRepMesh_Delaun::BRepMesh_Delaun(IMeshData::Array1OfVertexOfDelaun& theVertices)
 BRepMesh_Delaun::BRepMesh_Delaun(const occ::handle<BRepMesh_DataStructureOfDelaun>& theOldMesh,
                                  IMeshData::Array1OfVertexOfDelaun&                 theVertices)
     : myMeshData(theOldMesh),
-      myCircles(theVertices.Length(),
-                new NCollection_IncAllocator(IMeshData::MEMORY_BLOCK_SIZE_HUGE)),
+      myCircles(theVertices.Length(), myCirclesArena.Allocator()),
       mySupVert(3),
       myInitCircles(false)
 {
@@ -203,8 +203,7 @@ BRepMesh_Delaun::BRepMesh_Delaun(const occ::handle<BRepMesh_DataStructureOfDelau
 BRepMesh_Delaun::BRepMesh_Delaun(const occ::handle<BRepMesh_DataStructureOfDelaun>& theOldMesh,
                                  IMeshData::VectorOfInteger& theVertexIndices)
     : myMeshData(theOldMesh),
-      myCircles(theVertexIndices.Length(),
-                new NCollection_IncAllocator(IMeshData::MEMORY_BLOCK_SIZE_HUGE)),
+      myCircles(theVertexIndices.Length(), myCirclesArena.Allocator()),
       mySupVert(3),
       myInitCircles(false)
 {
@@ -220,8 +219,7 @@ BRepMesh_Delaun::BRepMesh_Delaun(const occ::handle<BRepMesh_DataStructureOfDelau
                                  const int                   theCellsCountU,
                                  const int                   theCellsCountV)
     : myMeshData(theOldMesh),
-      myCircles(theVertexIndices.Length(),
-                new NCollection_IncAllocator(IMeshData::MEMORY_BLOCK_SIZE_HUGE)),
+      myCircles(theVertexIndices.Length(), myCirclesArena.Allocator()),
       mySupVert(3),
       myInitCircles(false)
 {
@@ -410,8 +408,8 @@ void BRepMesh_Delaun::deleteTriangle(const int                       theIndex,
 void BRepMesh_Delaun::compute(IMeshData::VectorOfInteger& theVertexIndexes)
 {
   // Insertion of edges of super triangles in the list of free edges:
-  occ::handle<NCollection_IncAllocator> aAllocator =
-    new NCollection_IncAllocator(IMeshData::MEMORY_BLOCK_SIZE_HUGE);
+  const BRepMesh_ThreadArena                   anArena;
+  const occ::handle<NCollection_IncAllocator>& aAllocator = anArena.Allocator();
 
   IMeshData::MapOfIntegerInteger aLoopEdges(10, aAllocator);
   const int (&e)[3] = mySupTrian.myEdges;
@@ -437,8 +435,8 @@ void BRepMesh_Delaun::compute(IMeshData::VectorOfInteger& theVertexIndexes)
 
 void BRepMesh_Delaun::RemoveAuxElements()
 {
-  occ::handle<NCollection_IncAllocator> aAllocator =
-    new NCollection_IncAllocator(IMeshData::MEMORY_BLOCK_SIZE_HUGE);
+  const BRepMesh_ThreadArena                   anArena;
+  const occ::handle<NCollection_IncAllocator>& aAllocator = anArena.Allocator();
 
   IMeshData::MapOfIntegerInteger aLoopEdges(10, aAllocator);
 
@@ -589,8 +587,8 @@ void BRepMesh_Delaun::createTriangles(const int                       theVertexI
 void BRepMesh_Delaun::createTrianglesOnNewVertices(IMeshData::VectorOfInteger&  theVertexIndexes,
                                                    const Message_ProgressRange& theRange)
 {
-  occ::handle<NCollection_IncAllocator> aAllocator =
-    new NCollection_IncAllocator(IMeshData::MEMORY_BLOCK_SIZE_HUGE);
+  const BRepMesh_ThreadArena                   anArena;
+  const occ::handle<NCollection_IncAllocator>& aAllocator = anArena.Allocator();
 
   double aTolU, aTolV;
   myMeshData->Data()->GetTolerance(aTolU, aTolV);
@@ -780,8 +778,8 @@ bool BRepMesh_Delaun::isBoundToFrontier(const int theRefNodeId, const int theRef
 //=======================================================================
 void BRepMesh_Delaun::cleanupMesh()
 {
-  occ::handle<NCollection_IncAllocator> aAllocator =
-    new NCollection_IncAllocator(IMeshData::MEMORY_BLOCK_SIZE_HUGE);
+  const BRepMesh_ThreadArena                   anArena;
+  const occ::handle<NCollection_IncAllocator>& aAllocator = anArena.Allocator();
 
   for (;;)
   {
@@ -897,8 +895,8 @@ void BRepMesh_Delaun::frontierAdjust()
 {
   Handle(IMeshData::MapOfInteger) aFrontier = Frontier();
 
-  occ::handle<NCollection_IncAllocator> aAllocator =
-    new NCollection_IncAllocator(IMeshData::MEMORY_BLOCK_SIZE_HUGE);
+  const BRepMesh_ThreadArena                   anArena;
+  const occ::handle<NCollection_IncAllocator>& aAllocator = anArena.Allocator();
 
   IMeshData::VectorOfInteger      aFailedFrontiers(256, aAllocator);
   IMeshData::MapOfIntegerInteger  aLoopEdges(10, aAllocator);
@@ -1324,8 +1322,8 @@ void BRepMesh_Delaun::cleanupPolygon(const IMeshData::SequenceOfInteger& thePoly
   if (aPolyLen < 3)
     return;
 
-  occ::handle<NCollection_IncAllocator> aAllocator =
-    new NCollection_IncAllocator(IMeshData::MEMORY_BLOCK_SIZE_HUGE);
+  const BRepMesh_ThreadArena                   anArena;
+  const occ::handle<NCollection_IncAllocator>& aAllocator = anArena.Allocator();
 
   IMeshData::MapOfIntegerInteger aLoopEdges(10, aAllocator);
   IMeshData::MapOfInteger        anIgnoredEdges;
@@ -19,6 +19,7 @@
 #include <Standard_Macro.hxx>
 
 #include <BRepMesh_CircleTool.hxx>
+#include <BRepMesh_ThreadArena.hxx>
 #include <BRepMesh_Triangle.hxx>
 #include <BRepMesh_Edge.hxx>
 #include <IMeshData_Types.hxx>
@@ -345,6 +346,7 @@ private:
 
 private:
   occ::handle<BRepMesh_DataStructureOfDelaun> myMeshData;
+  BRepMesh_ThreadArena                        myCirclesArena;
   BRepMesh_CircleTool                         myCircles;
   IMeshData::VectorOfInteger                  mySupVert;
   bool                                        myInitCircles;
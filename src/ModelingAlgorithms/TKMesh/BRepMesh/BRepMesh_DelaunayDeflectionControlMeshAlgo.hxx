@@ -18,7 +18,10 @@
 
 #include <BRepMesh_DelaunayNodeInsertionMeshAlgo.hxx>
 #include <BRepMesh_GeomTool.hxx>
+#include <BRepMesh_ThreadArena.hxx>
+#include <GeomGridEval_Surface.hxx>
 #include <GeomLib.hxx>
+#include <NCollection_Vector.hxx>
 
 //! Extends node insertion Delaunay meshing algo in order to control
 //! deflection of generated triangles. Splits triangles failing the check.
@@ -72,8 +75,8 @@ protected:
   //! Inserts additional nodes in case of huge deviation.
   virtual void optimizeMesh(BRepMesh_Delaun& theMesher, const Message_ProgressRange& theRange)
   {
-    occ::handle<NCollection_IncAllocator> aTmpAlloc =
-      new NCollection_IncAllocator(IMeshData::MEMORY_BLOCK_SIZE_HUGE);
+    const BRepMesh_ThreadArena                   anArena;
+    const occ::handle<NCollection_IncAllocator>& aTmpAlloc = anArena.Allocator();
 
     mySqMinSize = this->getParameters().MinSize * this->getParameters().MinSize;
     myCouplesMap =
@@ -82,6 +85,12 @@ protected:
     myControlNodes = new IMeshData::ListOfPnt2d(aTmpAlloc);
     myCircles      = &theMesher.Circles();
 
+    // Points of each pass are evaluated on the surface at once
+    GeomGridEval_Surface aSurfaceEval;
+    aSurfaceEval.Initialize(*this->getDFace()->GetSurface());
+
+    NCollection_Vector<ControlPoint> aControlPoints(256, aTmpAlloc);
+
     const int             aIterationsNb = 11;
     bool                  isInserted    = true;
     Message_ProgressScope aPS(theRange, "Iteration", aIterationsNb);
@@ -95,19 +104,21 @@ protected:
       myMaxSqDeflection  = -1.;
       myIsAllDegenerated = true;
       myControlNodes->Clear();
+      aControlPoints.Clear();
 
       if (this->getStructure()->ElementsOfDomain().Extent() < 1)
       {
         break;
       }
-      // Iterate on current triangles
+      // Iterate on current triangles collecting points to be checked
       IMeshData::IteratorOfMapOfInteger aTriangleIt(this->getStructure()->ElementsOfDomain());
       for (; aTriangleIt.More(); aTriangleIt.Next())
       {
         const BRepMesh_Triangle& aTriangle = this->getStructure()->GetElement(aTriangleIt.Key());
-        splitTriangleGeometry(aTriangle);
+        splitTriangleGeometry(aTriangle, aControlPoints);
       }
 
+      checkControlPoints(aSurfaceEval, aControlPoints);
       isInserted = this->insertNodes(myControlNodes, theMesher, aPS.Next());
     }
 
@@ -134,6 +145,16 @@ private:
     bool   isFrontierLink;
   };
 
+  //! Point of a triangle to be checked against the surface:
+  //! either center of the triangle or middle point of its link.
+  struct ControlPoint
+  {
+    gp_XY            Point2d;        //!< parameters of the point on the surface
+    gp_Vec           Normal;         //!< normal of the triangle, used by center point
+    TriangleNodeInfo Nodes[2];       //!< first node of triangle or ends of the link
+    bool             IsLinkMidPoint; //!< true for middle point of a link
+  };
+
   //! Functor computing deflection of a point from surface.
   class NormalDeviation
   {
@@ -201,9 +222,9 @@ private:
     }
   }
 
-  // Check geometry of the given triangle. If triangle does not suit specified deflection, inserts
-  // new point.
-  void splitTriangleGeometry(const BRepMesh_Triangle& theTriangle)
+  // Collects points of the given triangle to be checked for deflection.
+  void splitTriangleGeometry(const BRepMesh_Triangle&          theTriangle,
+                             NCollection_Vector<ControlPoint>& theControlPoints)
   {
     if (theTriangle.Movability() != BRepMesh_Deleted)
     {
@@ -222,8 +243,12 @@ private:
         const gp_XY aCenter2d =
           (aNodesInfo[0].Point2d + aNodesInfo[1].Point2d + aNodesInfo[2].Point2d) / 3.;
 
-        usePoint(aCenter2d, NormalDeviation(aNodesInfo[0].Point, aNormal));
-        splitLinks(aNodesInfo, aNodexIndices);
+        ControlPoint& aCenter  = theControlPoints.Appended();
+        aCenter.Point2d        = aCenter2d;
+        aCenter.Normal         = aNormal;
+        aCenter.Nodes[0]       = aNodesInfo[0];
+        aCenter.IsLinkMidPoint = false;
+        splitLinks(aNodesInfo, aNodexIndices, theControlPoints);
       }
     }
   }
@@ -291,9 +316,10 @@ private:
     return false;
   }
 
-  //! Computes deflection of midpoints of triangles links.
-  //! @return True if point fits specified deflection.
-  void splitLinks(const TriangleNodeInfo (&theNodesInfo)[3], const int (&theNodesIndices)[3])
+  //! Collects midpoints of triangles links not processed yet.
+  void splitLinks(const TriangleNodeInfo (&theNodesInfo)[3],
+                  const int (&theNodesIndices)[3],
+                  NCollection_Vector<ControlPoint>& theControlPoints)
   {
     // Check deflection at triangle links
     for (int i = 0; i < 3; ++i)
@@ -319,16 +345,59 @@ private:
 
       if (myCouplesMap->Add(BRepMesh_OrientedEdge(aFirstVertex, aLastVertex)))
       {
-        const gp_XY aMidPnt2d = (theNodesInfo[i].Point2d + theNodesInfo[j].Point2d) / 2.;
+        ControlPoint& aMidPnt  = theControlPoints.Appended();
+        aMidPnt.Point2d        = (theNodesInfo[i].Point2d + theNodesInfo[j].Point2d) / 2.;
+        aMidPnt.Nodes[0]       = theNodesInfo[i];
+        aMidPnt.Nodes[1]       = theNodesInfo[j];
+        aMidPnt.IsLinkMidPoint = true;
+      }
+    }
+  }
+
+  //! Evaluates collected points on the surface at once and checks their deflection
+  //! in the order of collection. Points failing the check are cached for insertion.
+  void checkControlPoints(const GeomGridEval_Surface&             theSurfaceEval,
+                          const NCollection_Vector<ControlPoint>& theControlPoints)
+  {
+    if (theControlPoints.IsEmpty())
+    {
+      return;
+    }
 
-        if (!usePoint(aMidPnt2d, LineDeviation(theNodesInfo[i].Point, theNodesInfo[j].Point)))
+    NCollection_Array1<gp_Pnt> aPoints3d;
+    if (theSurfaceEval.IsInitialized())
+    {
+      NCollection_Array1<gp_Pnt2d> aPoints2d(1, theControlPoints.Length());
+      for (int aPntIt = 0; aPntIt < theControlPoints.Length(); ++aPntIt)
+      {
+        aPoints2d.SetValue(aPntIt + 1, gp_Pnt2d(theControlPoints(aPntIt).Point2d));
+      }
+      aPoints3d = theSurfaceEval.EvaluatePoints(aPoints2d);
+    }
+    const bool isEvaluated = (aPoints3d.Length() == theControlPoints.Length());
+
+    for (int aPntIt = 0; aPntIt < theControlPoints.Length(); ++aPntIt)
+    {
+      const ControlPoint& aControlPnt = theControlPoints(aPntIt);
+      const gp_Pnt aPnt = isEvaluated ? aPoints3d(aPntIt + 1) : getPoint3d(aControlPnt.Point2d);
+
+      const TriangleNodeInfo& aNode1 = aControlPnt.Nodes[0];
+      const TriangleNodeInfo& aNode2 = aControlPnt.Nodes[1];
+      const gp_Pnt            aPnt1(aNode1.Point);
+      if (!aControlPnt.IsLinkMidPoint)
+      {
+        usePoint(aControlPnt.Point2d, aPnt, NormalDeviation(aPnt1, aControlPnt.Normal));
+        continue;
+      }
+
+      const gp_Pnt aPnt2(aNode2.Point);
+      if (!usePoint(aControlPnt.Point2d, aPnt, LineDeviation(aPnt1, aPnt2)))
+      {
+        if (!rejectSplitLinksForMinSize(aNode1, aNode2, aPnt))
         {
-          if (!rejectSplitLinksForMinSize(theNodesInfo[i], theNodesInfo[j], aMidPnt2d))
+          if (!checkLinkEndsForAngularDeviation(aNode1, aNode2, aControlPnt.Point2d))
           {
-            if (!checkLinkEndsForAngularDeviation(theNodesInfo[i], theNodesInfo[j], aMidPnt2d))
-            {
-              myControlNodes->Append(aMidPnt2d);
-            }
+            myControlNodes->Append(aControlPnt.Point2d);
           }
         }
       }
@@ -337,13 +406,13 @@ private:
 
   //! Checks that two links produced as the result of a split of
   //! the given link by the middle point fit MinSize requirement.
+  //! @param[in] theMidPnt3d middle point evaluated on the surface
   bool rejectSplitLinksForMinSize(const TriangleNodeInfo& theNodeInfo1,
                                   const TriangleNodeInfo& theNodeInfo2,
-                                  const gp_XY&            theMidPoint)
+                                  const gp_Pnt&           theMidPnt3d)
   {
-    const gp_Pnt aPnt = getPoint3d(theMidPoint);
-    return ((theNodeInfo1.Point - aPnt.XYZ()).SquareModulus() < mySqMinSize
-            || (theNodeInfo2.Point - aPnt.XYZ()).SquareModulus() < mySqMinSize);
+    return ((theNodeInfo1.Point - theMidPnt3d.XYZ()).SquareModulus() < mySqMinSize
+            || (theNodeInfo2.Point - theMidPnt3d.XYZ()).SquareModulus() < mySqMinSize);
   }
 
   //! Checks the given point (located between the given nodes)
@@ -390,12 +459,13 @@ private:
   //! insertion in case if it overflows deflection.
   //! @return True if point has been cached for insertion.
   template <class DeflectionFunctor>
-  bool usePoint(const gp_XY& thePnt2d, const DeflectionFunctor& theDeflectionFunctor)
+  bool usePoint(const gp_XY&             thePnt2d,
+                const gp_Pnt&            thePnt3d,
+                const DeflectionFunctor& theDeflectionFunctor)
   {
-    const gp_Pnt aPnt = getPoint3d(thePnt2d);
     if (!checkDeflectionOfPointAndUpdateCache(thePnt2d,
-                                              aPnt,
-                                              theDeflectionFunctor.SquareDeviation(aPnt)))
+                                              thePnt3d,
+                                              theDeflectionFunctor.SquareDeviation(thePnt3d)))
     {
       myControlNodes->Append(thePnt2d);
       return true;
@@ -18,8 +18,12 @@
 #include <IMeshData_Wire.hxx>
 #include <IMeshData_Edge.hxx>
 #include <IMeshTools_MeshAlgo.hxx>
+#include <IMeshData_Curve.hxx>
+#include <BRep_Tool.hxx>
 #include <OSD_Parallel.hxx>
 
+#include <algorithm>
+
 IMPLEMENT_STANDARD_RTTIEXT(BRepMesh_FaceDiscret, IMeshTools_ModelAlgo)
 
 //=================================================================================================
@@ -55,8 +59,14 @@ public:
     {
       return;
     }
-    Message_ProgressScope aFaceScope(myRanges[theFaceIndex], nullptr, 1);
-    myAlgo->process(theFaceIndex, aFaceScope.Next());
+    const int aFaceIndex =
+      !myAlgo->myFaceOrder.empty() ? myAlgo->myFaceOrder[theFaceIndex] : theFaceIndex;
+    Message_ProgressScope aFaceScope(myRanges[aFaceIndex], nullptr, 1);
+    myAlgo->process(aFaceIndex, aFaceScope.Next());
+    if (!myAlgo->myTriangulationListener.IsNull())
+    {
+      myAlgo->notify(aFaceIndex);
+    }
   }
 
 private:
@@ -78,11 +88,28 @@ bool BRepMesh_FaceDiscret::performInternal(const occ::handle<IMeshData_Model>& t
     return false;
   }
 
+  const bool isParallel = myParameters.InParallel && myModel->FacesNb() > 1;
+  myFaceOrder.clear();
+  if (isParallel)
+  {
+    // start with the most expensive faces to balance load of threads at the end of the loop
+    std::vector<double> aCosts(myModel->FacesNb());
+    myFaceOrder.resize(myModel->FacesNb());
+    for (int aFaceIter = 0; aFaceIter < myModel->FacesNb(); ++aFaceIter)
+    {
+      aCosts[aFaceIter]      = estimateCost(myModel->GetFace(aFaceIter));
+      myFaceOrder[aFaceIter] = aFaceIter;
+    }
+    std::stable_sort(myFaceOrder.begin(),
+                     myFaceOrder.end(),
+                     [&aCosts](const int theLeft, const int theRight) {
+                       return aCosts[theLeft] > aCosts[theRight];
+                     });
+  }
+
   FaceListFunctor aFunctor(this, theRange);
-  OSD_Parallel::For(0,
-                    myModel->FacesNb(),
-                    aFunctor,
-                    !(myParameters.InParallel && myModel->FacesNb() > 1));
+  OSD_Parallel::For(0, myModel->FacesNb(), aFunctor, !isParallel);
+  myFaceOrder.clear();
   if (!theRange.More())
   {
     return false;
@@ -121,10 +148,88 @@ void BRepMesh_FaceDiscret::process(const int                    theFaceIndex,
       aDFace->SetStatus(IMeshData_UserBreak);
       return;
     }
+
+    BRepMesh_TriangulationCache::Key aCacheKey;
+    const bool                       toCache =
+      !myTriangulationCache.IsNull()
+      && BRepMesh_TriangulationCache::ComputeKey(aDFace, myParameters, aCacheKey);
+    if (toCache && myTriangulationCache->Restore(aCacheKey, aDFace))
+    {
+      return;
+    }
+
     aMeshingAlgo->Perform(aDFace, myParameters, theRange);
+    if (toCache && theRange.More())
+    {
+      myTriangulationCache->Store(aCacheKey, aDFace);
+    }
   }
   catch (Standard_Failure const&)
   {
     aDFace->SetStatus(IMeshData_Failure);
   }
 }
+
+//=================================================================================================
+
+void BRepMesh_FaceDiscret::notify(const int theFaceIndex) const
+{
+  const IMeshData::IFaceHandle& aDFace = myModel->GetFace(theFaceIndex);
+  if (aDFace->IsSet(IMeshData_Failure) || aDFace->IsSet(IMeshData_UserBreak))
+  {
+    return;
+  }
+
+  TopLoc_Location                        aLoc;
+  const occ::handle<Poly_Triangulation>& aTriangulation =
+    BRep_Tool::Triangulation(aDFace->GetFace(), aLoc);
+  if (!aTriangulation.IsNull())
+  {
+    myTriangulationListener->OnFaceMeshed(aDFace->GetFace(), aTriangulation);
+  }
+}
+
+//=================================================================================================
+
+double BRepMesh_FaceDiscret::estimateCost(const IMeshData::IFaceHandle& theDFace)
+{
+  if (theDFace->IsSet(IMeshData_Failure) || theDFace->IsSet(IMeshData_Reused))
+  {
+    return 0.0;
+  }
+
+  // boundary is already discretized with respect to deflection,
+  // so that number of its nodes reflects both size of the face and required precision
+  double aNbBndNodes = 0.0;
+  for (int aWireIter = 0; aWireIter < theDFace->WiresNb(); ++aWireIter)
+  {
+    const IMeshData::IWireHandle& aDWire = theDFace->GetWire(aWireIter);
+    for (int anEdgeIter = 0; anEdgeIter < aDWire->EdgesNb(); ++anEdgeIter)
+    {
+      const IMeshData::IEdgePtr& aDEdge = aDWire->GetEdge(anEdgeIter);
+      aNbBndNodes += double(aDEdge->GetCurve()->ParametersNb());
+    }
+  }
+
+  // planar faces get no interior nodes, while the number of interior nodes of curved faces
+  // grows roughly quadratically with the number of boundary nodes
+  const occ::handle<BRepAdaptor_Surface>& aSurface = theDFace->GetSurface();
+  switch (aSurface->GetType())
+  {
+    case GeomAbs_Plane:
+      return aNbBndNodes;
+    case GeomAbs_Cylinder:
+    case GeomAbs_Cone:
+    case GeomAbs_Sphere:
+    case GeomAbs_Torus:
+      return aNbBndNodes * aNbBndNodes;
+    case GeomAbs_BezierSurface:
+    case GeomAbs_BSplineSurface: {
+      // deflection control evaluates the surface for each inserted node
+      const double aNbPoles = double(aSurface->NbUPoles()) * double(aSurface->NbVPoles());
+      return aNbBndNodes * aNbBndNodes * (2.0 + std::sqrt(aNbPoles));
+    }
+    default:
+      return aNbBndNodes * aNbBndNodes * 4.0;
+  }
+}
@@ -19,11 +19,19 @@
 #include <IMeshTools_ModelAlgo.hxx>
 #include <IMeshTools_Parameters.hxx>
 #include <IMeshTools_MeshAlgoFactory.hxx>
+#include <BRepMesh_TriangulationCache.hxx>
+#include <BRepMesh_TriangulationListener.hxx>
+
+#include <vector>
 
 //! Class implements functionality starting triangulation of model's faces.
 //! Each face is processed separately and can be executed in parallel mode.
 //! Uses mesh algo factory passed as initializer to create instance of triangulation
 //! algorithm according to type of surface of target face.
+//! In parallel mode faces are processed in order of decreasing estimated cost,
+//! so that a few heavy faces do not remain at the end of the run on a single thread.
+//! Optional triangulation cache allows reusing triangulations of identical faces.
+//! Optional listener receives triangulation of each face as soon as it is finished.
 class BRepMesh_FaceDiscret : public IMeshTools_ModelAlgo
 {
 public:
@@ -36,6 +44,30 @@ public:
 
   DEFINE_STANDARD_RTTIEXT(BRepMesh_FaceDiscret, IMeshTools_ModelAlgo)
 
+  //! Returns cache of face triangulations; NULL by default.
+  const occ::handle<BRepMesh_TriangulationCache>& TriangulationCache() const
+  {
+    return myTriangulationCache;
+  }
+
+  //! Sets cache of face triangulations.
+  void SetTriangulationCache(const occ::handle<BRepMesh_TriangulationCache>& theCache)
+  {
+    myTriangulationCache = theCache;
+  }
+
+  //! Returns listener receiving triangulations of meshed faces; NULL by default.
+  const occ::handle<BRepMesh_TriangulationListener>& TriangulationListener() const
+  {
+    return myTriangulationListener;
+  }
+
+  //! Sets listener receiving triangulations of meshed faces.
+  void SetTriangulationListener(const occ::handle<BRepMesh_TriangulationListener>& theListener)
+  {
+    myTriangulationListener = theListener;
+  }
+
 protected:
   //! Performs processing of faces of the given model.
   Standard_EXPORT bool performInternal(const occ::handle<IMeshData_Model>& theModel,
@@ -46,13 +78,23 @@ private:
   //! Checks existing discretization of the face and updates data model.
   void process(const int theFaceIndex, const Message_ProgressRange& theRange) const;
 
+  //! Reports triangulation of the face to the listener.
+  void notify(const int theFaceIndex) const;
+
+  //! Returns estimated relative cost of triangulation of the face
+  //! basing on type of its surface and number of discretization points of its boundary.
+  static double estimateCost(const IMeshData::IFaceHandle& theDFace);
+
 private:
   class FaceListFunctor;
 
 private:
-  occ::handle<IMeshTools_MeshAlgoFactory> myAlgoFactory;
-  occ::handle<IMeshData_Model>            myModel;
-  IMeshTools_Parameters                   myParameters;
+  occ::handle<IMeshTools_MeshAlgoFactory>     myAlgoFactory;
+  occ::handle<IMeshData_Model>                myModel;
+  IMeshTools_Parameters                       myParameters;
+  std::vector<int>                            myFaceOrder;             //!< order of processing
+  occ::handle<BRepMesh_TriangulationCache>    myTriangulationCache;    //!< cache of results
+  occ::handle<BRepMesh_TriangulationListener> myTriangulationListener; //!< receiver of results
 };
 
 #endif
@@ -16,10 +16,21 @@
 
 #include <BRepMesh_IncrementalMesh.hxx>
 #include <BRepMesh_Context.hxx>
+#include <BRepMesh_FaceDiscret.hxx>
+#include <BRepMesh_ModelPostProcessor.hxx>
 #include <BRepMesh_PluginMacro.hxx>
+#include <BRepMesh_ShapeTool.hxx>
+#include <BRep_Builder.hxx>
+#include <BRep_Tool.hxx>
+#include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Compound.hxx>
+#include <TopoDS_Edge.hxx>
 #include <IMeshData_Face.hxx>
 #include <IMeshData_Wire.hxx>
 #include <IMeshTools_MeshBuilder.hxx>
+#include <OSD_TraceZone.hxx>
 
 IMPLEMENT_STANDARD_RTTIEXT(BRepMesh_IncrementalMesh, BRepMesh_DiscretRoot)
 
@@ -28,6 +39,31 @@ namespace
 //! Default flag to control parallelization for BRepMesh_IncrementalMesh
 //! tool returned for Mesh Factory
 static bool IS_IN_PARALLEL = false;
+
+//! Notifies listener about the end of meshing on leaving the scope.
+class ListenerSentry
+{
+public:
+  ListenerSentry(const occ::handle<BRepMesh_TriangulationListener>& theListener)
+      : myListener(theListener)
+  {
+  }
+
+  ~ListenerSentry()
+  {
+    if (!myListener.IsNull())
+    {
+      myListener->OnMeshingDone();
+    }
+  }
+
+private:
+  ListenerSentry(const ListenerSentry&)            = delete;
+  ListenerSentry& operator=(const ListenerSentry&) = delete;
+
+private:
+  occ::handle<BRepMesh_TriangulationListener> myListener;
+};
 } // namespace
 
 //=================================================================================================
@@ -85,11 +121,46 @@ void BRepMesh_IncrementalMesh::Perform(const Message_ProgressRange& theRange)
 void BRepMesh_IncrementalMesh::Perform(const occ::handle<IMeshTools_Context>& theContext,
                                        const Message_ProgressRange&           theRange)
 {
+  OSD_TRACE_ZONE_CATEGORY("BRepMesh_IncrementalMesh::Perform", "mesh");
+  const ListenerSentry aListenerSentry(myTriangulationListener);
   initParameters();
 
-  theContext->SetShape(Shape());
+  const TopoDS_Shape aShape = myHistory.IsNull() ? Shape() : changedFaces();
+  if (aShape.IsNull())
+  {
+    // nothing has been changed
+    myStatus = IMeshData_NoError;
+    setDone();
+    return;
+  }
+
+  theContext->SetShape(aShape);
   theContext->ChangeParameters()            = myParameters;
   theContext->ChangeParameters().CleanModel = false;
+  if (!myTriangulationCache.IsNull())
+  {
+    if (occ::handle<BRepMesh_FaceDiscret> aFaceDiscret =
+          occ::down_cast<BRepMesh_FaceDiscret>(theContext->GetFaceDiscret()))
+    {
+      aFaceDiscret->SetTriangulationCache(myTriangulationCache);
+    }
+  }
+  if (!myTriangulationListener.IsNull())
+  {
+    // post-processing may modify triangulations, so that they are reported only afterwards
+    const bool toModify = myParameters.OptimizeVertexCache || myParameters.CompactTriangulation;
+    const occ::handle<BRepMesh_TriangulationListener> aNoListener;
+    if (occ::handle<BRepMesh_FaceDiscret> aFaceDiscret =
+          occ::down_cast<BRepMesh_FaceDiscret>(theContext->GetFaceDiscret()))
+    {
+      aFaceDiscret->SetTriangulationListener(toModify ? aNoListener : myTriangulationListener);
+    }
+    if (occ::handle<BRepMesh_ModelPostProcessor> aPostProcessor =
+          occ::down_cast<BRepMesh_ModelPostProcessor>(theContext->GetPostProcessor()))
+    {
+      aPostProcessor->SetTriangulationListener(toModify ? myTriangulationListener : aNoListener);
+    }
+  }
 
   Message_ProgressScope  aPS(theRange, "Perform incmesh", 10);
   IMeshTools_MeshBuilder aIncMesh(theContext);
@@ -121,6 +192,93 @@ void BRepMesh_IncrementalMesh::Perform(const occ::handle<IMeshTools_Context>& th
 
 //=================================================================================================
 
+TopoDS_Shape BRepMesh_IncrementalMesh::changedFaces() const
+{
+  NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> aResultFaces;
+  TopExp::MapShapes(Shape(), TopAbs_FACE, aResultFaces);
+
+  // collect faces of the result modified or generated from sub-shapes of initial shape
+  NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> aChangedFaces;
+  const TopAbs_ShapeEnum aTypes[3] = {TopAbs_VERTEX, TopAbs_EDGE, TopAbs_FACE};
+  for (const TopAbs_ShapeEnum aType : aTypes)
+  {
+    NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> anInitShapes;
+    TopExp::MapShapes(myInitialShape, aType, anInitShapes);
+    for (int aShapeIter = 1; aShapeIter <= anInitShapes.Extent(); ++aShapeIter)
+    {
+      const TopoDS_Shape&                   anInitShape = anInitShapes(aShapeIter);
+      const NCollection_List<TopoDS_Shape>* aLists[2]   = {&myHistory->Modified(anInitShape),
+                                                           &myHistory->Generated(anInitShape)};
+      for (const NCollection_List<TopoDS_Shape>* aList : aLists)
+      {
+        for (NCollection_List<TopoDS_Shape>::Iterator aNewIter(*aList); aNewIter.More();
+             aNewIter.Next())
+        {
+          const int aFaceIndex = aNewIter.Value().ShapeType() == TopAbs_FACE
+                                   ? aResultFaces.FindIndex(aNewIter.Value())
+                                   : 0;
+          if (aFaceIndex != 0)
+          {
+            aChangedFaces.Add(aResultFaces(aFaceIndex));
+          }
+        }
+      }
+    }
+  }
+  if (aChangedFaces.IsEmpty())
+  {
+    return TopoDS_Shape();
+  }
+
+  NCollection_IndexedDataMap<TopoDS_Shape, NCollection_List<TopoDS_Shape>, TopTools_ShapeMapHasher>
+    anEdgeFaces;
+  TopExp::MapShapesAndAncestors(Shape(), TopAbs_EDGE, TopAbs_FACE, anEdgeFaces);
+
+  BRep_Builder    aBuilder;
+  TopoDS_Compound aCompound;
+  aBuilder.MakeCompound(aCompound);
+  NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> aNeighbors;
+  for (int aFaceIter = 1; aFaceIter <= aChangedFaces.Extent(); ++aFaceIter)
+  {
+    const TopoDS_Face& aFace = TopoDS::Face(aChangedFaces(aFaceIter));
+    aBuilder.Add(aCompound, aFace);
+
+    TopLoc_Location                       aLoc;
+    const occ::handle<Poly_Triangulation> aTriangulation = BRep_Tool::Triangulation(aFace, aLoc);
+    for (TopExp_Explorer anEdgeIter(aFace, TopAbs_EDGE); anEdgeIter.More(); anEdgeIter.Next())
+    {
+      const TopoDS_Edge& anEdge = TopoDS::Edge(anEdgeIter.Current());
+      if (!aTriangulation.IsNull())
+      {
+        BRepMesh_ShapeTool::NullifyEdge(anEdge, aTriangulation, aLoc);
+      }
+
+      // untouched neighbors provide discretization of common edges
+      for (NCollection_List<TopoDS_Shape>::Iterator aNeighborIter(
+             anEdgeFaces.FindFromKey(anEdge));
+           aNeighborIter.More();
+           aNeighborIter.Next())
+      {
+        const TopoDS_Face& aNeighbor = TopoDS::Face(aNeighborIter.Value());
+        TopLoc_Location    aNeighborLoc;
+        if (!aChangedFaces.Contains(aNeighbor) && !aNeighbors.Contains(aNeighbor)
+            && !BRep_Tool::Triangulation(aNeighbor, aNeighborLoc).IsNull())
+        {
+          aNeighbors.Add(aNeighbor);
+          aBuilder.Add(aCompound, aNeighbor);
+        }
+      }
+    }
+    if (!aTriangulation.IsNull())
+    {
+      BRepMesh_ShapeTool::NullifyFace(aFace);
+    }
+  }
+  return aCompound;
+}
+
+//=================================================================================================
+
 int BRepMesh_IncrementalMesh::Discret(const TopoDS_Shape&    theShape,
                                       const double           theDeflection,
                                       const double           theAngle,
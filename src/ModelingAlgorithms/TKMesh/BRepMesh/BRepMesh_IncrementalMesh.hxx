@@ -15,6 +15,9 @@
 #define _BRepMesh_IncrementalMesh_HeaderFile
 
 #include <BRepMesh_DiscretRoot.hxx>
+#include <BRepMesh_TriangulationCache.hxx>
+#include <BRepMesh_TriangulationListener.hxx>
+#include <BRepTools_History.hxx>
 #include <IMeshTools_Context.hxx>
 #include <Standard_NumericError.hxx>
 
@@ -74,6 +77,60 @@ public: //! @name accessing to parameters.
   //! Returns accumulated status flags faced during meshing.
   int GetStatusFlags() const { return myStatus; }
 
+  //! Returns cache of face triangulations; NULL by default.
+  const occ::handle<BRepMesh_TriangulationCache>& TriangulationCache() const
+  {
+    return myTriangulationCache;
+  }
+
+  //! Sets cache of face triangulations to be used by next Perform() call,
+  //! so that identical faces are meshed only once.
+  //! The cache is ignored by custom contexts not based on BRepMesh_FaceDiscret.
+  void SetTriangulationCache(const occ::handle<BRepMesh_TriangulationCache>& theCache)
+  {
+    myTriangulationCache = theCache;
+  }
+
+  //! Returns listener receiving triangulations of faces as soon as they are finished; NULL by
+  //! default.
+  const occ::handle<BRepMesh_TriangulationListener>& TriangulationListener() const
+  {
+    return myTriangulationListener;
+  }
+
+  //! Sets listener receiving triangulations of faces from next Perform() calls.
+  //! Faces are reported right after meshing, or after post-processing when triangulations are
+  //! modified by it (OptimizeVertexCache and CompactTriangulation parameters).
+  //! BRepMesh_TriangulationListener::OnMeshingDone() is called at the end of Perform().
+  //! The listener is ignored by custom contexts not based on BRepMesh_FaceDiscret and
+  //! BRepMesh_ModelPostProcessor.
+  void SetTriangulationListener(const occ::handle<BRepMesh_TriangulationListener>& theListener)
+  {
+    myTriangulationListener = theListener;
+  }
+
+  //! Returns history of modeling operation restricting meshing to changed faces; NULL by default.
+  const occ::handle<BRepTools_History>& History() const { return myHistory; }
+
+  //! Restricts next Perform() calls to the faces of the shape which have been modified or
+  //! generated from the initial shape by a local modeling operation (fillet, boolean, etc.).
+  //! Untouched faces are expected to keep triangulations of the initial shape; only those adjacent
+  //! to changed faces are passed to the mesher, so that discretization of their common edges is
+  //! taken from existing polygons on triangulation and the mesh remains connected.
+  //! Changed faces are always re-meshed, even if they have a triangulation fitting parameters.
+  //! @param[in] theInitial shape before modification
+  //! @param[in] theHistory history of modification; NULL to mesh the whole shape
+  void SetHistory(const TopoDS_Shape& theInitial, const occ::handle<BRepTools_History>& theHistory)
+  {
+    myInitialShape = theInitial;
+    myHistory      = theHistory;
+  }
+
+private:
+  //! Returns compound of faces to be meshed according to history: changed faces and their
+  //! triangulated neighbors. Removes existing triangulations of changed faces.
+  TopoDS_Shape changedFaces() const;
+
 private:
   //! Initializes specific parameters
   void initParameters()
@@ -130,9 +187,13 @@ public: //! @name plugin API
   DEFINE_STANDARD_RTTIEXT(BRepMesh_IncrementalMesh, BRepMesh_DiscretRoot)
 
 protected:
-  IMeshTools_Parameters myParameters;
-  bool                  myModified;
-  int                   myStatus;
+  IMeshTools_Parameters                       myParameters;
+  bool                                        myModified;
+  int                                         myStatus;
+  occ::handle<BRepMesh_TriangulationCache>    myTriangulationCache;
+  occ::handle<BRepMesh_TriangulationListener> myTriangulationListener;
+  TopoDS_Shape                                myInitialShape;
+  occ::handle<BRepTools_History>              myHistory;
 };
 
 #endif
@@ -20,9 +20,15 @@
 #include <IMeshData_Edge.hxx>
 #include <IMeshData_PCurve.hxx>
 #include <IMeshTools_Parameters.hxx>
+#include <NCollection_Map.hxx>
 #include <OSD_Parallel.hxx>
 #include <BRepLib.hxx>
+#include <BRep_CurveRepresentation.hxx>
+#include <BRep_TEdge.hxx>
 #include <Poly_TriangulationParameters.hxx>
+#include <Poly_VertexCacheOptimizer.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
 
 IMPLEMENT_STANDARD_RTTIEXT(BRepMesh_ModelPostProcessor, IMeshTools_ModelAlgo)
 
@@ -198,6 +204,101 @@ private:
   occ::handle<IMeshData_Model>              myModel;
   occ::handle<Poly_TriangulationParameters> myParams;
 };
+
+//! Reorders triangulations of faces for rendering and renumbers polygons on them.
+class VertexCacheOptimizer
+{
+public:
+  //! Constructor
+  VertexCacheOptimizer(const occ::handle<IMeshData_Model>& theModel)
+      : myModel(theModel)
+  {
+  }
+
+  //! Main functor.
+  void operator()(const int theFaceIndex) const
+  {
+    const IMeshData::IFaceHandle& aDFace = myModel->GetFace(theFaceIndex);
+    if (aDFace->IsSet(IMeshData_Failure) || aDFace->IsSet(IMeshData_Reused))
+    {
+      return;
+    }
+
+    TopLoc_Location                        aLoc;
+    const TopoDS_Face&                     aFace          = aDFace->GetFace();
+    const occ::handle<Poly_Triangulation>& aTriangulation = BRep_Tool::Triangulation(aFace, aLoc);
+    Poly_VertexCacheOptimizer              anOptimizer;
+    if (aTriangulation.IsNull() || !anOptimizer.Perform(*aTriangulation)
+        || !anOptimizer.Apply(aTriangulation))
+    {
+      return;
+    }
+
+    // polygons on triangulation are shared by both orientations of seam edge
+    NCollection_Map<occ::handle<Poly_PolygonOnTriangulation>> aPolygons;
+    for (TopExp_Explorer anEdgeIter(aFace, TopAbs_EDGE); anEdgeIter.More(); anEdgeIter.Next())
+    {
+      const TopoDS_Edge&      anEdge = TopoDS::Edge(anEdgeIter.Current());
+      const TopLoc_Location   aPolyLoc = aLoc.Predivided(anEdge.Location());
+      const BRep_TEdge*       aTEdge   = static_cast<const BRep_TEdge*>(anEdge.TShape().get());
+      for (NCollection_List<occ::handle<BRep_CurveRepresentation>>::Iterator aCurveIter(
+             aTEdge->Curves());
+           aCurveIter.More();
+           aCurveIter.Next())
+      {
+        const occ::handle<BRep_CurveRepresentation>& aCurve = aCurveIter.Value();
+        if (!aCurve->IsPolygonOnTriangulation(aTriangulation, aPolyLoc))
+        {
+          continue;
+        }
+
+        if (aPolygons.Add(aCurve->PolygonOnTriangulation()))
+        {
+          anOptimizer.Apply(*aCurve->PolygonOnTriangulation());
+        }
+        if (aCurve->IsPolygonOnClosedTriangulation() && aPolygons.Add(aCurve->PolygonOnTriangulation2()))
+        {
+          anOptimizer.Apply(*aCurve->PolygonOnTriangulation2());
+        }
+      }
+    }
+  }
+
+private:
+  occ::handle<IMeshData_Model> myModel;
+};
+
+//! Converts triangulations of faces into compact storage.
+class TriangulationCompactor
+{
+public:
+  //! Constructor
+  TriangulationCompactor(const occ::handle<IMeshData_Model>& theModel)
+      : myModel(theModel)
+  {
+  }
+
+  //! Main functor.
+  void operator()(const int theFaceIndex) const
+  {
+    const IMeshData::IFaceHandle& aDFace = myModel->GetFace(theFaceIndex);
+    if (aDFace->IsSet(IMeshData_Failure) || aDFace->IsSet(IMeshData_Reused))
+    {
+      return;
+    }
+
+    TopLoc_Location                        aLoc;
+    const occ::handle<Poly_Triangulation>& aTriangulation =
+      BRep_Tool::Triangulation(aDFace->GetFace(), aLoc);
+    if (!aTriangulation.IsNull())
+    {
+      aTriangulation->Compact();
+    }
+  }
+
+private:
+  occ::handle<IMeshData_Model> myModel;
+};
 } // namespace
 
 //=================================================================================================
@@ -232,5 +333,41 @@ bool BRepMesh_ModelPostProcessor::performInternal(const occ::handle<IMeshData_Mo
                     theModel->FacesNb(),
                     DeflectionEstimator(theModel, theParameters),
                     !theParameters.InParallel);
+
+  if (theParameters.OptimizeVertexCache)
+  {
+    OSD_Parallel::For(0,
+                      theModel->FacesNb(),
+                      VertexCacheOptimizer(theModel),
+                      !theParameters.InParallel);
+  }
+
+  if (theParameters.CompactTriangulation)
+  {
+    OSD_Parallel::For(0,
+                      theModel->FacesNb(),
+                      TriangulationCompactor(theModel),
+                      !theParameters.InParallel);
+  }
+
+  if (!myTriangulationListener.IsNull())
+  {
+    for (int aFaceIter = 0; aFaceIter < theModel->FacesNb(); ++aFaceIter)
+    {
+      const IMeshData::IFaceHandle& aDFace = theModel->GetFace(aFaceIter);
+      if (aDFace->IsSet(IMeshData_Failure) || aDFace->IsSet(IMeshData_UserBreak))
+      {
+        continue;
+      }
+
+      TopLoc_Location                        aLoc;
+      const occ::handle<Poly_Triangulation>& aTriangulation =
+        BRep_Tool::Triangulation(aDFace->GetFace(), aLoc);
+      if (!aTriangulation.IsNull())
+      {
+        myTriangulationListener->OnFaceMeshed(aDFace->GetFace(), aTriangulation);
+      }
+    }
+  }
   return true;
 }
@@ -18,9 +18,11 @@
 
 #include <IMeshTools_ModelAlgo.hxx>
 #include <IMeshData_Types.hxx>
+#include <BRepMesh_TriangulationListener.hxx>
 
 //! Class implements functionality of model post-processing tool.
 //! Stores polygons on triangulations to TopoDS_Edge.
+//! Optional listener receives final triangulations of faces.
 class BRepMesh_ModelPostProcessor : public IMeshTools_ModelAlgo
 {
 public:
@@ -32,11 +34,26 @@ public:
 
   DEFINE_STANDARD_RTTIEXT(BRepMesh_ModelPostProcessor, IMeshTools_ModelAlgo)
 
+  //! Returns listener receiving triangulations of faces after post-processing; NULL by default.
+  const occ::handle<BRepMesh_TriangulationListener>& TriangulationListener() const
+  {
+    return myTriangulationListener;
+  }
+
+  //! Sets listener receiving triangulations of faces after post-processing.
+  void SetTriangulationListener(const occ::handle<BRepMesh_TriangulationListener>& theListener)
+  {
+    myTriangulationListener = theListener;
+  }
+
 protected:
   //! Performs processing of edges of the given model.
   Standard_EXPORT bool performInternal(const occ::handle<IMeshData_Model>& theModel,
                                        const IMeshTools_Parameters&        theParameters,
                                        const Message_ProgressRange&        theRange) override;
+
+private:
+  occ::handle<BRepMesh_TriangulationListener> myTriangulationListener;
 };
 
 #endif
@@ -27,6 +27,7 @@
 #include <IMeshData_Status.hxx>
 #include <IMeshTools_Context.hxx>
 #include <BRepTools.hxx>
+#include <OSD_MemInfo.hxx>
 
 IMPLEMENT_STANDARD_RTTIEXT(BRepMesh_ShapeVisitor, IMeshTools_ShapeVisitor)
 
@@ -36,6 +37,7 @@ BRepMesh_ShapeVisitor::BRepMesh_ShapeVisitor(const occ::handle<IMeshData_Model>&
     : myModel(theModel),
       myDEdgeMap(1, new NCollection_IncAllocator(IMeshData::MEMORY_BLOCK_SIZE_HUGE))
 {
+  myDEdgeMap.Allocator()->SetMemTag(OSD_MemInfo::MemTag_Mesh);
 }
 
 //=================================================================================================
@@ -0,0 +1,61 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRepMesh_ThreadArena.hxx>
+
+#include <IMeshData_Types.hxx>
+#include <OSD_MemInfo.hxx>
+
+#include <vector>
+
+namespace
+{
+//! Maximum number of free allocators kept by a thread.
+static const size_t THE_MAX_POOL_SIZE = 8;
+
+//! Returns pool of free allocators of the calling thread.
+static std::vector<occ::handle<NCollection_IncAllocator>>& threadPool()
+{
+  static thread_local std::vector<occ::handle<NCollection_IncAllocator>> THE_POOL;
+  return THE_POOL;
+}
+} // namespace
+
+//=================================================================================================
+
+BRepMesh_ThreadArena::BRepMesh_ThreadArena()
+{
+  std::vector<occ::handle<NCollection_IncAllocator>>& aPool = threadPool();
+  if (aPool.empty())
+  {
+    myAllocator = new NCollection_IncAllocator(IMeshData::MEMORY_BLOCK_SIZE_HUGE);
+    myAllocator->SetMemTag(OSD_MemInfo::MemTag_Mesh);
+    return;
+  }
+
+  myAllocator = aPool.back();
+  aPool.pop_back();
+}
+
+//=================================================================================================
+
+BRepMesh_ThreadArena::~BRepMesh_ThreadArena()
+{
+  // the allocator can be reset only when no data structure refers to it anymore
+  std::vector<occ::handle<NCollection_IncAllocator>>& aPool = threadPool();
+  if (myAllocator->GetRefCount() == 1 && aPool.size() < THE_MAX_POOL_SIZE)
+  {
+    myAllocator->Reset(false);
+    aPool.push_back(myAllocator);
+  }
+}
@@ -0,0 +1,50 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BRepMesh_ThreadArena_HeaderFile
+#define _BRepMesh_ThreadArena_HeaderFile
+
+#include <NCollection_IncAllocator.hxx>
+#include <Standard_Macro.hxx>
+
+//! Lease of an arena allocator for temporary data structures built while meshing a single face.
+//! Each thread keeps a small pool of NCollection_IncAllocator instances: the lease takes one from
+//! the pool of the calling thread (or creates a new one) and, on destruction, resets it preserving
+//! allocated memory blocks and puts it back. Thus faces meshed by the same thread reuse memory
+//! blocks instead of requesting them from the global memory manager, which otherwise becomes
+//! a point of contention in parallel meshing.
+//!
+//! All data structures using the allocator should be released before the lease;
+//! otherwise the allocator is not returned to the pool and is freed by the last reference.
+//! Nested leases within the same thread receive distinct allocators.
+class BRepMesh_ThreadArena
+{
+public:
+  //! Takes an allocator from the pool of the calling thread.
+  Standard_EXPORT BRepMesh_ThreadArena();
+
+  //! Resets the allocator and returns it into the pool of the calling thread.
+  Standard_EXPORT ~BRepMesh_ThreadArena();
+
+  //! Returns the leased allocator.
+  const occ::handle<NCollection_IncAllocator>& Allocator() const { return myAllocator; }
+
+private:
+  BRepMesh_ThreadArena(const BRepMesh_ThreadArena&)            = delete;
+  BRepMesh_ThreadArena& operator=(const BRepMesh_ThreadArena&) = delete;
+
+private:
+  occ::handle<NCollection_IncAllocator> myAllocator;
+};
+
+#endif // _BRepMesh_ThreadArena_HeaderFile
@@ -0,0 +1,584 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRepMesh_TriangulationCache.hxx>
+
+#include <BRep_Builder.hxx>
+#include <BRep_Tool.hxx>
+#include <Geom2dHash_CurveHasher.hxx>
+#include <GeomHash_SurfaceHasher.hxx>
+#include <IMeshData_Curve.hxx>
+#include <IMeshData_Edge.hxx>
+#include <IMeshData_Face.hxx>
+#include <IMeshData_PCurve.hxx>
+#include <IMeshData_Wire.hxx>
+#include <Message.hxx>
+#include <OSD_FileSystem.hxx>
+#include <Standard_HashUtils.hxx>
+#include <TopExp_Explorer.hxx>
+
+#include <algorithm>
+
+IMPLEMENT_STANDARD_RTTIEXT(BRepMesh_TriangulationCache, Standard_Transient)
+
+namespace
+{
+//! File signature.
+static const char THE_TRIANGULATION_CACHE_MAGIC[8] = {'O', 'C', 'C', 'T', 'R', 'I', 'A', 'C'};
+
+//! File format version.
+static const uint32_t THE_TRIANGULATION_CACHE_VERSION = 1;
+
+//! Fraction of memory limit to keep after eviction, so that eviction is not repeated per entry.
+static const double THE_EVICTION_RATIO = 0.9;
+
+//! Write value into the stream.
+template <typename T>
+static void writeValue(std::ostream& theStream, const T& theValue)
+{
+  theStream.write(reinterpret_cast<const char*>(&theValue), sizeof(T));
+}
+
+//! Read value from the stream.
+template <typename T>
+static bool readValue(std::istream& theStream, T& theValue)
+{
+  theStream.read(reinterpret_cast<char*>(&theValue), sizeof(T));
+  return theStream.good();
+}
+
+//! Returns total number of pcurve points of the face boundary.
+static int nbBoundaryPoints(const IMeshData::IFaceHandle& theDFace)
+{
+  int aNbPoints = 0;
+  for (int aWireIt = 0; aWireIt < theDFace->WiresNb(); ++aWireIt)
+  {
+    const IMeshData::IWireHandle& aDWire = theDFace->GetWire(aWireIt);
+    for (int anEdgeIt = 0; anEdgeIt < aDWire->EdgesNb(); ++anEdgeIt)
+    {
+      const IMeshData::IEdgePtr&      aDEdge   = aDWire->GetEdge(anEdgeIt);
+      const IMeshData::ListOfInteger& aPCurves = aDEdge->GetPCurves(theDFace.get());
+      for (IMeshData::ListOfInteger::Iterator aPCurveIt(aPCurves); aPCurveIt.More();
+           aPCurveIt.Next())
+      {
+        aNbPoints += aDEdge->GetPCurve(aPCurveIt.Value())->ParametersNb();
+      }
+    }
+  }
+  return aNbPoints;
+}
+} // namespace
+
+//=================================================================================================
+
+bool BRepMesh_TriangulationCache::ComputeKey(const IMeshData::IFaceHandle& theDFace,
+                                             const IMeshTools_Parameters&  theParams,
+                                             Key&                          theKey)
+{
+  const TopoDS_Face& aFace = theDFace->GetFace();
+  if (theParams.InternalVerticesMode)
+  {
+    // internal vertices are inserted into mesh, but are not a part of the key
+    TopExp_Explorer aVertexIt(aFace, TopAbs_VERTEX, TopAbs_EDGE);
+    if (aVertexIt.More())
+    {
+      return false;
+    }
+  }
+
+  TopLoc_Location                  aSurfLoc;
+  const occ::handle<Geom_Surface>& aSurface = BRep_Tool::Surface(aFace, aSurfLoc);
+  if (aSurface.IsNull())
+  {
+    return false;
+  }
+
+  std::vector<double>& aSig = theKey.Signature;
+  aSig.clear();
+  aSig.reserve(64 + 6 * nbBoundaryPoints(theDFace));
+
+  // parameters affecting face triangulation
+  aSig.push_back(double(theParams.MeshAlgo));
+  aSig.push_back(theParams.Angle);
+  aSig.push_back(theParams.Deflection);
+  aSig.push_back(theParams.AngleInterior);
+  aSig.push_back(theParams.DeflectionInterior);
+  aSig.push_back(theParams.MinSize);
+  aSig.push_back(theParams.Relative ? 1.0 : 0.0);
+  aSig.push_back(theParams.InternalVerticesMode ? 1.0 : 0.0);
+  aSig.push_back(theParams.ControlSurfaceDeflection ? 1.0 : 0.0);
+  aSig.push_back(theParams.EnableControlSurfaceDeflectionAllSurfaces ? 1.0 : 0.0);
+  aSig.push_back(theParams.AdjustMinSize ? 1.0 : 0.0);
+  aSig.push_back(theParams.ForceFaceDeflection ? 1.0 : 0.0);
+
+  // face properties; triangulation is stored in local coordinate system of the face
+  const gp_Trsf aToLocal = aFace.Location().Transformation().Inverted();
+  aSig.push_back(double(aFace.Orientation()));
+  aSig.push_back(BRep_Tool::Tolerance(aFace));
+  aSig.push_back(theDFace->GetDeflection());
+  aSig.push_back(aToLocal.ScaleFactor());
+
+  std::size_t aHash = GeomHash_SurfaceHasher()(aSurface);
+  for (int aWireIt = 0; aWireIt < theDFace->WiresNb(); ++aWireIt)
+  {
+    const IMeshData::IWireHandle& aDWire = theDFace->GetWire(aWireIt);
+    if (aDWire->IsSet(IMeshData_SelfIntersectingWire))
+    {
+      // boundary nodes of such wire are not consistent with adjacent faces
+      return false;
+    }
+
+    aSig.push_back(double(aDWire->EdgesNb()));
+    for (int anEdgeIt = 0; anEdgeIt < aDWire->EdgesNb(); ++anEdgeIt)
+    {
+      const IMeshData::IEdgePtr& aDEdge = aDWire->GetEdge(anEdgeIt);
+      const TopoDS_Edge&         anEdge = aDEdge->GetEdge();
+      aSig.push_back(double(aDWire->GetEdgeOrientation(anEdgeIt)));
+      aSig.push_back(aDEdge->GetDegenerated() ? 1.0 : 0.0);
+      aSig.push_back(BRep_Tool::Tolerance(anEdge));
+
+      double                           aFirst = 0.0, aLast = 0.0;
+      const occ::handle<Geom2d_Curve>& aPCurve2d =
+        BRep_Tool::CurveOnSurface(anEdge, aFace, aFirst, aLast);
+      if (!aPCurve2d.IsNull())
+      {
+        const std::size_t aPCurveHash = Geom2dHash_CurveHasher()(aPCurve2d);
+        aHash = opencascade::hash_combine(aPCurveHash, int(sizeof(aPCurveHash)), aHash);
+      }
+      aSig.push_back(aFirst);
+      aSig.push_back(aLast);
+
+      const IMeshData::ICurveHandle&  aCurve   = aDEdge->GetCurve();
+      const IMeshData::ListOfInteger& aPCurves = aDEdge->GetPCurves(theDFace.get());
+      aSig.push_back(double(aPCurves.Size()));
+      for (IMeshData::ListOfInteger::Iterator aPCurveIt(aPCurves); aPCurveIt.More();
+           aPCurveIt.Next())
+      {
+        const IMeshData::IPCurveHandle& aPCurve = aDEdge->GetPCurve(aPCurveIt.Value());
+        aSig.push_back(double(aPCurve->GetOrientation()));
+        aSig.push_back(double(aPCurve->ParametersNb()));
+        for (int aPointIt = 0; aPointIt < aPCurve->ParametersNb(); ++aPointIt)
+        {
+          const gp_Pnt2d& aUV    = aPCurve->GetPoint(aPointIt);
+          const gp_Pnt    aPnt3d = aCurve->GetPoint(aPointIt).Transformed(aToLocal);
+          aSig.push_back(aUV.X());
+          aSig.push_back(aUV.Y());
+          aSig.push_back(aPCurve->GetParameter(aPointIt));
+          aSig.push_back(aPnt3d.X());
+          aSig.push_back(aPnt3d.Y());
+          aSig.push_back(aPnt3d.Z());
+        }
+      }
+    }
+  }
+
+  theKey.Hash =
+    opencascade::hash_combine(*aSig.data(), int(aSig.size() * sizeof(double)), aHash);
+  return true;
+}
+
+//=================================================================================================
+
+BRepMesh_TriangulationCache::BRepMesh_TriangulationCache()
+    : myMaxMemory(256 * 1024 * 1024),
+      myUsedMemory(0),
+      myUseStamp(0),
+      myNbHits(0),
+      myNbMisses(0)
+{
+}
+
+//=================================================================================================
+
+void BRepMesh_TriangulationCache::SetMaxMemory(std::size_t theNbBytes)
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  myMaxMemory = theNbBytes;
+  evict();
+}
+
+//=================================================================================================
+
+std::size_t BRepMesh_TriangulationCache::UsedMemory() const
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  return myUsedMemory;
+}
+
+//=================================================================================================
+
+int BRepMesh_TriangulationCache::NbEntries() const
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  return myEntries.Extent();
+}
+
+//=================================================================================================
+
+std::size_t BRepMesh_TriangulationCache::NbHits() const
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  return myNbHits;
+}
+
+//=================================================================================================
+
+std::size_t BRepMesh_TriangulationCache::NbMisses() const
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  return myNbMisses;
+}
+
+//=================================================================================================
+
+bool BRepMesh_TriangulationCache::Restore(const Key& theKey, const IMeshData::IFaceHandle& theDFace)
+{
+  Entry anEntry;
+  {
+    std::lock_guard<std::mutex> aLock(myMutex);
+    Entry*                      aFound = myEntries.ChangeSeek(theKey);
+    if (aFound == nullptr)
+    {
+      ++myNbMisses;
+      return false;
+    }
+
+    ++myNbHits;
+    aFound->LastUse = ++myUseStamp;
+    anEntry         = *aFound;
+  }
+
+  const NCollection_Array1<int>& aBndNodes = anEntry.BoundaryNodes->Array1();
+  if (aBndNodes.Length() != nbBoundaryPoints(theDFace))
+  {
+    return false;
+  }
+
+  int aBndIndex = aBndNodes.Lower();
+  for (int aWireIt = 0; aWireIt < theDFace->WiresNb(); ++aWireIt)
+  {
+    const IMeshData::IWireHandle& aDWire = theDFace->GetWire(aWireIt);
+    for (int anEdgeIt = 0; anEdgeIt < aDWire->EdgesNb(); ++anEdgeIt)
+    {
+      const IMeshData::IEdgePtr&      aDEdge   = aDWire->GetEdge(anEdgeIt);
+      const IMeshData::ListOfInteger& aPCurves = aDEdge->GetPCurves(theDFace.get());
+      for (IMeshData::ListOfInteger::Iterator aPCurveIt(aPCurves); aPCurveIt.More();
+           aPCurveIt.Next())
+      {
+        const IMeshData::IPCurveHandle& aPCurve = aDEdge->GetPCurve(aPCurveIt.Value());
+        for (int aPointIt = 0; aPointIt < aPCurve->ParametersNb(); ++aPointIt, ++aBndIndex)
+        {
+          aPCurve->GetIndex(aPointIt) = aBndNodes.Value(aBndIndex);
+        }
+      }
+    }
+  }
+
+  // the copy might be modified by post-processing or by application
+  BRep_Builder().UpdateFace(theDFace->GetFace(), anEntry.Triangulation->Copy());
+  return true;
+}
+
+//=================================================================================================
+
+void BRepMesh_TriangulationCache::Store(const Key& theKey, const IMeshData::IFaceHandle& theDFace)
+{
+  TopLoc_Location                        aLoc;
+  const occ::handle<Poly_Triangulation>& aTriangulation =
+    BRep_Tool::Triangulation(theDFace->GetFace(), aLoc);
+  if (aTriangulation.IsNull() || theDFace->IsSet(IMeshData_Failure))
+  {
+    return;
+  }
+
+  Entry anEntry;
+  const int aNbBndPoints = nbBoundaryPoints(theDFace);
+  if (aNbBndPoints == 0)
+  {
+    return;
+  }
+
+  anEntry.BoundaryNodes = new NCollection_HArray1<int>(1, aNbBndPoints);
+  int aBndIndex         = 1;
+  for (int aWireIt = 0; aWireIt < theDFace->WiresNb(); ++aWireIt)
+  {
+    const IMeshData::IWireHandle& aDWire = theDFace->GetWire(aWireIt);
+    for (int anEdgeIt = 0; anEdgeIt < aDWire->EdgesNb(); ++anEdgeIt)
+    {
+      const IMeshData::IEdgePtr&      aDEdge   = aDWire->GetEdge(anEdgeIt);
+      const IMeshData::ListOfInteger& aPCurves = aDEdge->GetPCurves(theDFace.get());
+      for (IMeshData::ListOfInteger::Iterator aPCurveIt(aPCurves); aPCurveIt.More();
+           aPCurveIt.Next())
+      {
+        const IMeshData::IPCurveHandle& aPCurve = aDEdge->GetPCurve(aPCurveIt.Value());
+        for (int aPointIt = 0; aPointIt < aPCurve->ParametersNb(); ++aPointIt, ++aBndIndex)
+        {
+          anEntry.BoundaryNodes->SetValue(aBndIndex, aPCurve->GetIndex(aPointIt));
+        }
+      }
+    }
+  }
+  anEntry.Triangulation = aTriangulation->Copy();
+
+  std::lock_guard<std::mutex> aLock(myMutex);
+  addEntry(theKey, anEntry);
+}
+
+//=================================================================================================
+
+std::size_t BRepMesh_TriangulationCache::entrySize(const Key& theKey, const Entry& theEntry)
+{
+  const Poly_Triangulation& aTris      = *theEntry.Triangulation;
+  const std::size_t         aNodeBytes =
+    sizeof(gp_Pnt) + (aTris.HasUVNodes() ? sizeof(gp_Pnt2d) : 0);
+  return sizeof(Entry) + theKey.Signature.size() * sizeof(double)
+         + std::size_t(aTris.NbNodes()) * aNodeBytes
+         + std::size_t(aTris.NbTriangles()) * sizeof(Poly_Triangle)
+         + std::size_t(theEntry.BoundaryNodes->Length()) * sizeof(int);
+}
+
+//=================================================================================================
+
+void BRepMesh_TriangulationCache::addEntry(const Key& theKey, Entry& theEntry)
+{
+  if (myEntries.IsBound(theKey))
+  {
+    // the same face might be meshed concurrently by another thread
+    return;
+  }
+
+  const std::size_t aSize = entrySize(theKey, theEntry);
+  if (aSize > myMaxMemory)
+  {
+    return;
+  }
+
+  theEntry.LastUse = ++myUseStamp;
+  myEntries.Bind(theKey, theEntry);
+  myUsedMemory += aSize;
+  evict();
+}
+
+//=================================================================================================
+
+void BRepMesh_TriangulationCache::evict()
+{
+  if (myUsedMemory <= myMaxMemory)
+  {
+    return;
+  }
+
+  // release least recently used entries down to a fraction of the limit at once
+  std::vector<std::pair<std::size_t, const Key*>> anEntries;
+  anEntries.reserve(myEntries.Extent());
+  for (EntryMap::Iterator anEntryIt(myEntries); anEntryIt.More(); anEntryIt.Next())
+  {
+    anEntries.emplace_back(anEntryIt.Value().LastUse, &anEntryIt.Key());
+  }
+  std::sort(anEntries.begin(), anEntries.end());
+
+  const std::size_t aTarget = std::size_t(double(myMaxMemory) * THE_EVICTION_RATIO);
+  std::vector<Key>  anEvicted;
+  for (const std::pair<std::size_t, const Key*>& anEntry : anEntries)
+  {
+    if (myUsedMemory <= aTarget)
+    {
+      break;
+    }
+    myUsedMemory -= entrySize(*anEntry.second, myEntries.Find(*anEntry.second));
+    anEvicted.push_back(*anEntry.second);
+  }
+  for (const Key& aKey : anEvicted)
+  {
+    myEntries.UnBind(aKey);
+  }
+}
+
+//=================================================================================================
+
+void BRepMesh_TriangulationCache::Clear()
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  myEntries.Clear();
+  myUsedMemory = 0;
+  myNbHits     = 0;
+  myNbMisses   = 0;
+}
+
+//=================================================================================================
+
+bool BRepMesh_TriangulationCache::Save(const TCollection_AsciiString& theFile) const
+{
+  const occ::handle<OSD_FileSystem>& aFileSystem = OSD_FileSystem::DefaultFileSystem();
+  std::shared_ptr<std::ostream>      aFileOut =
+    aFileSystem->OpenOStream(theFile, std::ios::out | std::ios::binary | std::ios::trunc);
+  if (aFileOut.get() == nullptr)
+  {
+    Message::SendFail(TCollection_AsciiString("Error: Unable to create file '") + theFile + "'");
+    return false;
+  }
+
+  {
+    std::lock_guard<std::mutex> aLock(myMutex);
+    aFileOut->write(THE_TRIANGULATION_CACHE_MAGIC, sizeof(THE_TRIANGULATION_CACHE_MAGIC));
+    writeValue(*aFileOut, THE_TRIANGULATION_CACHE_VERSION);
+    writeValue(*aFileOut, uint32_t(myEntries.Extent()));
+    for (EntryMap::Iterator anEntryIt(myEntries); anEntryIt.More(); anEntryIt.Next())
+    {
+      const Key&                aKey    = anEntryIt.Key();
+      const Entry&              anEntry = anEntryIt.Value();
+      const Poly_Triangulation& aTris   = *anEntry.Triangulation;
+      writeValue(*aFileOut, uint64_t(aKey.Hash));
+      writeValue(*aFileOut, uint32_t(aKey.Signature.size()));
+      aFileOut->write(reinterpret_cast<const char*>(aKey.Signature.data()),
+                      std::streamsize(aKey.Signature.size() * sizeof(double)));
+
+      writeValue(*aFileOut, uint32_t(aTris.NbNodes()));
+      writeValue(*aFileOut, uint32_t(aTris.NbTriangles()));
+      writeValue(*aFileOut, uint32_t(aTris.HasUVNodes() ? 1 : 0));
+      writeValue(*aFileOut, aTris.Deflection());
+      for (int aNodeIt = 1; aNodeIt <= aTris.NbNodes(); ++aNodeIt)
+      {
+        const gp_Pnt aNode = aTris.Node(aNodeIt);
+        writeValue(*aFileOut, aNode.X());
+        writeValue(*aFileOut, aNode.Y());
+        writeValue(*aFileOut, aNode.Z());
+        if (aTris.HasUVNodes())
+        {
+          const gp_Pnt2d aUV = aTris.UVNode(aNodeIt);
+          writeValue(*aFileOut, aUV.X());
+          writeValue(*aFileOut, aUV.Y());
+        }
+      }
+      for (int aTriIt = 1; aTriIt <= aTris.NbTriangles(); ++aTriIt)
+      {
+        int aNodes[3] = {0, 0, 0};
+        aTris.Triangle(aTriIt).Get(aNodes[0], aNodes[1], aNodes[2]);
+        aFileOut->write(reinterpret_cast<const char*>(aNodes), sizeof(aNodes));
+      }
+
+      const NCollection_Array1<int>& aBndNodes = anEntry.BoundaryNodes->Array1();
+      writeValue(*aFileOut, uint32_t(aBndNodes.Length()));
+      aFileOut->write(reinterpret_cast<const char*>(&aBndNodes.First()),
+                      std::streamsize(aBndNodes.Length() * sizeof(int)));
+    }
+  }
+
+  aFileOut->flush();
+  if (!aFileOut->good())
+  {
+    Message::SendFail(TCollection_AsciiString("Error: Unable to write file '") + theFile + "'");
+    return false;
+  }
+  aFileOut.reset();
+  return true;
+}
+
+//=================================================================================================
+
+bool BRepMesh_TriangulationCache::Load(const TCollection_AsciiString& theFile)
+{
+  const occ::handle<OSD_FileSystem>& aFileSystem = OSD_FileSystem::DefaultFileSystem();
+  std::shared_ptr<std::istream>      aFile =
+    aFileSystem->OpenIStream(theFile, std::ios::in | std::ios::binary);
+  if (aFile.get() == nullptr || !aFile->good())
+  {
+    Message::SendFail(TCollection_AsciiString("Error: Unable to open file '") + theFile + "'");
+    return false;
+  }
+
+  char     aMagic[8] = {};
+  uint32_t aVersion = 0, aNbEntries = 0;
+  aFile->read(aMagic, sizeof(aMagic));
+  if (!aFile->good() || ::memcmp(aMagic, THE_TRIANGULATION_CACHE_MAGIC, sizeof(aMagic)) != 0
+      || !readValue(*aFile, aVersion) || aVersion != THE_TRIANGULATION_CACHE_VERSION
+      || !readValue(*aFile, aNbEntries))
+  {
+    Message::SendFail(TCollection_AsciiString("Error: file '") + theFile
+                      + "' is not a triangulation cache of supported version");
+    return false;
+  }
+
+  std::lock_guard<std::mutex> aLock(myMutex);
+  for (uint32_t anEntryIt = 0; anEntryIt < aNbEntries; ++anEntryIt)
+  {
+    Key      aKey;
+    uint64_t aHash = 0;
+    uint32_t aSigLen = 0, aNbNodes = 0, aNbTris = 0, aHasUV = 0, aNbBndNodes = 0;
+    double   aDeflection = 0.0;
+    if (!readValue(*aFile, aHash) || !readValue(*aFile, aSigLen) || aSigLen > (1u << 28))
+    {
+      Message::SendFail(TCollection_AsciiString("Error: file '") + theFile + "' is corrupted");
+      return false;
+    }
+
+    aKey.Hash = std::size_t(aHash);
+    aKey.Signature.resize(aSigLen);
+    aFile->read(reinterpret_cast<char*>(aKey.Signature.data()),
+                std::streamsize(aSigLen * sizeof(double)));
+    if (!readValue(*aFile, aNbNodes) || !readValue(*aFile, aNbTris) || !readValue(*aFile, aHasUV)
+        || !readValue(*aFile, aDeflection) || aNbNodes == 0 || aNbNodes > (1u << 28)
+        || aNbTris > (1u << 28))
+    {
+      Message::SendFail(TCollection_AsciiString("Error: file '") + theFile + "' is corrupted");
+      return false;
+    }
+
+    Entry anEntry;
+    anEntry.Triangulation = new Poly_Triangulation(int(aNbNodes), int(aNbTris), aHasUV != 0);
+    anEntry.Triangulation->Deflection(aDeflection);
+    for (int aNodeIt = 1; aNodeIt <= int(aNbNodes); ++aNodeIt)
+    {
+      double aXYZ[3] = {0.0, 0.0, 0.0};
+      aFile->read(reinterpret_cast<char*>(aXYZ), sizeof(aXYZ));
+      anEntry.Triangulation->SetNode(aNodeIt, gp_Pnt(aXYZ[0], aXYZ[1], aXYZ[2]));
+      if (aHasUV != 0)
+      {
+        double aUV[2] = {0.0, 0.0};
+        aFile->read(reinterpret_cast<char*>(aUV), sizeof(aUV));
+        anEntry.Triangulation->SetUVNode(aNodeIt, gp_Pnt2d(aUV[0], aUV[1]));
+      }
+    }
+    for (int aTriIt = 1; aTriIt <= int(aNbTris); ++aTriIt)
+    {
+      int aNodes[3] = {0, 0, 0};
+      aFile->read(reinterpret_cast<char*>(aNodes), sizeof(aNodes));
+      for (int aNodeIt = 0; aNodeIt < 3; ++aNodeIt)
+      {
+        if (aNodes[aNodeIt] < 1 || aNodes[aNodeIt] > int(aNbNodes))
+        {
+          Message::SendFail(TCollection_AsciiString("Error: file '") + theFile
+                            + "' is corrupted");
+          return false;
+        }
+      }
+      anEntry.Triangulation->SetTriangle(aTriIt, Poly_Triangle(aNodes[0], aNodes[1], aNodes[2]));
+    }
+
+    if (!readValue(*aFile, aNbBndNodes) || aNbBndNodes == 0 || aNbBndNodes > (1u << 28))
+    {
+      Message::SendFail(TCollection_AsciiString("Error: file '") + theFile + "' is corrupted");
+      return false;
+    }
+    anEntry.BoundaryNodes = new NCollection_HArray1<int>(1, int(aNbBndNodes));
+    aFile->read(reinterpret_cast<char*>(&anEntry.BoundaryNodes->ChangeFirst()),
+                std::streamsize(aNbBndNodes * sizeof(int)));
+    if (!aFile->good())
+    {
+      Message::SendFail(TCollection_AsciiString("Error: file '") + theFile + "' is corrupted");
+      return false;
+    }
+    addEntry(aKey, anEntry);
+  }
+  return true;
+}
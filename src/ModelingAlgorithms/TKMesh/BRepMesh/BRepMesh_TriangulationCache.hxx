@@ -0,0 +1,164 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BRepMesh_TriangulationCache_HeaderFile
+#define _BRepMesh_TriangulationCache_HeaderFile
+
+#include <IMeshData_Types.hxx>
+#include <IMeshTools_Parameters.hxx>
+#include <NCollection_DataMap.hxx>
+#include <NCollection_HArray1.hxx>
+#include <Poly_Triangulation.hxx>
+#include <TCollection_AsciiString.hxx>
+
+#include <mutex>
+#include <vector>
+
+//! Thread-safe cache of face triangulations with LRU eviction, used by BRepMesh_FaceDiscret
+//! to mesh identical faces only once - within a model, across instances of the same part
+//! placed with different locations, or across sessions when the cache is saved into a file.
+//!
+//! Face is identified by the hashes of its surface and pcurves (see GeomHash_SurfaceHasher and
+//! Geom2dHash_CurveHasher) and by a signature including meshing parameters, face and edge
+//! tolerances and the discretization of face boundary expressed in the local coordinate system
+//! of the face. As the boundary is a part of the key, restored triangulation always shares
+//! boundary nodes with neighbor faces meshed within the same run.
+class BRepMesh_TriangulationCache : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(BRepMesh_TriangulationCache, Standard_Transient)
+public:
+  //! Face key.
+  struct Key
+  {
+    std::size_t         Hash;      //!< hash of geometry and signature
+    std::vector<double> Signature; //!< parameters and boundary discretization
+
+    Key()
+        : Hash(0)
+    {
+    }
+
+    bool operator==(const Key& theOther) const
+    {
+      return Hash == theOther.Hash && Signature == theOther.Signature;
+    }
+  };
+
+  //! Hasher of face keys.
+  struct KeyHasher
+  {
+    std::size_t operator()(const Key& theKey) const noexcept { return theKey.Hash; }
+
+    bool operator()(const Key& theKey1, const Key& theKey2) const noexcept
+    {
+      return theKey1 == theKey2;
+    }
+  };
+
+  //! Cached face triangulation.
+  struct Entry
+  {
+    occ::handle<Poly_Triangulation>       Triangulation; //!< triangulation in face coordinates
+    occ::handle<NCollection_HArray1<int>> BoundaryNodes; //!< triangulation nodes of pcurve points
+    std::size_t                           LastUse;       //!< stamp of last access
+
+    Entry()
+        : LastUse(0)
+    {
+    }
+  };
+
+public:
+  //! Computes key of the face with discretized boundary.
+  //! @param[in] theDFace  face with discretized edges
+  //! @param[in] theParams meshing parameters
+  //! @param[out] theKey   computed key
+  //! @return FALSE if face cannot be cached (e.g. has internal vertices to be inserted)
+  Standard_EXPORT static bool ComputeKey(const IMeshData::IFaceHandle& theDFace,
+                                         const IMeshTools_Parameters&  theParams,
+                                         Key&                          theKey);
+
+public:
+  //! Empty constructor.
+  Standard_EXPORT BRepMesh_TriangulationCache();
+
+  //! Returns maximum size of cached data in bytes; 256 MiB by default.
+  //! Least recently used triangulations are evicted after reaching the limit.
+  std::size_t MaxMemory() const { return myMaxMemory; }
+
+  //! Sets maximum size of cached data in bytes.
+  Standard_EXPORT void SetMaxMemory(std::size_t theNbBytes);
+
+  //! Returns size of cached data in bytes.
+  Standard_EXPORT std::size_t UsedMemory() const;
+
+  //! Returns number of cached triangulations.
+  Standard_EXPORT int NbEntries() const;
+
+  //! Returns number of cache hits since creation or last Clear().
+  Standard_EXPORT std::size_t NbHits() const;
+
+  //! Returns number of cache misses since creation or last Clear().
+  Standard_EXPORT std::size_t NbMisses() const;
+
+  //! Restores cached triangulation of the face: attaches a copy of triangulation to the face
+  //! and assigns triangulation nodes to pcurve points of face boundary.
+  //! @param[in] theKey   face key computed by ComputeKey()
+  //! @param[in] theDFace face to restore triangulation
+  //! @return TRUE if triangulation has been found
+  Standard_EXPORT bool Restore(const Key& theKey, const IMeshData::IFaceHandle& theDFace);
+
+  //! Stores a copy of triangulation of the meshed face.
+  //! @param[in] theKey   face key computed by ComputeKey() before meshing
+  //! @param[in] theDFace meshed face
+  Standard_EXPORT void Store(const Key& theKey, const IMeshData::IFaceHandle& theDFace);
+
+  //! Releases all cached triangulations.
+  Standard_EXPORT void Clear();
+
+  //! Saves cached triangulations into the file.
+  //! @param[in] theFile file path
+  //! @return FALSE on writing error
+  Standard_EXPORT bool Save(const TCollection_AsciiString& theFile) const;
+
+  //! Loads triangulations from the file saved by Save() and appends them to the cache;
+  //! triangulations already present in the cache are kept.
+  //! @param[in] theFile file path
+  //! @return FALSE if file cannot be read or has unexpected format
+  Standard_EXPORT bool Load(const TCollection_AsciiString& theFile);
+
+private:
+  //! Map of cached entries.
+  typedef NCollection_DataMap<Key, Entry, KeyHasher> EntryMap;
+
+  //! Returns size of the entry in bytes.
+  static std::size_t entrySize(const Key& theKey, const Entry& theEntry);
+
+  //! Adds entry and evicts least recently used ones beyond memory limit,
+  //! assuming the mutex is locked.
+  void addEntry(const Key& theKey, Entry& theEntry);
+
+  //! Evicts least recently used entries beyond memory limit, assuming the mutex is locked.
+  void evict();
+
+private:
+  EntryMap           myEntries;    //!< cached triangulations
+  mutable std::mutex myMutex;      //!< access mutex
+  std::size_t        myMaxMemory;  //!< memory limit
+  std::size_t        myUsedMemory; //!< size of cached data
+  std::size_t        myUseStamp;   //!< counter of accesses
+  std::size_t        myNbHits;     //!< number of cache hits
+  std::size_t        myNbMisses;   //!< number of cache misses
+};
+
+#endif // _BRepMesh_TriangulationCache_HeaderFile
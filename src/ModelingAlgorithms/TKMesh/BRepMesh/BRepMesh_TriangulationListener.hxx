@@ -0,0 +1,41 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BRepMesh_TriangulationListener_HeaderFile
+#define _BRepMesh_TriangulationListener_HeaderFile
+
+#include <Poly_Triangulation.hxx>
+#include <TopoDS_Face.hxx>
+
+//! Interface receiving triangulations of faces from BRepMesh_IncrementalMesh as soon as
+//! they are finished, so that export or transfer of the mesh can overlap meshing.
+//! In parallel mode methods are called from working threads and should be thread-safe.
+//! See BRepMesh_TriangulationQueue for implementation with back-pressure.
+class BRepMesh_TriangulationListener : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(BRepMesh_TriangulationListener, Standard_Transient)
+public:
+  //! Called when triangulation of the face is finished; faces keeping their existing
+  //! triangulation are also reported. Nodes are defined in the local coordinate system of
+  //! the face, i.e. should be transformed by its location. Polygons on triangulation of edges
+  //! are attached to the shape after all faces are meshed.
+  //! @param[in] theFace          meshed face
+  //! @param[in] theTriangulation triangulation of the face
+  virtual void OnFaceMeshed(const TopoDS_Face&                     theFace,
+                            const occ::handle<Poly_Triangulation>& theTriangulation) = 0;
+
+  //! Called once when meshing is finished or aborted; does nothing by default.
+  virtual void OnMeshingDone() {}
+};
+
+#endif // _BRepMesh_TriangulationListener_HeaderFile
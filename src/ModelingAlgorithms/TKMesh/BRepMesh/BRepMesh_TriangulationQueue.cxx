@@ -0,0 +1,127 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRepMesh_TriangulationQueue.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(BRepMesh_TriangulationQueue, BRepMesh_TriangulationListener)
+
+//=================================================================================================
+
+BRepMesh_TriangulationQueue::BRepMesh_TriangulationQueue(const int theCapacity)
+    : myCapacity(theCapacity > 0 ? theCapacity : 0),
+      myIsClosed(false)
+{
+}
+
+//=================================================================================================
+
+int BRepMesh_TriangulationQueue::Size() const
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  return static_cast<int>(myItems.size());
+}
+
+//=================================================================================================
+
+bool BRepMesh_TriangulationQueue::IsClosed() const
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  return myIsClosed;
+}
+
+//=================================================================================================
+
+bool BRepMesh_TriangulationQueue::Pop(TopoDS_Face&                     theFace,
+                                      occ::handle<Poly_Triangulation>& theTriangulation)
+{
+  std::unique_lock<std::mutex> aLock(myMutex);
+  myNotEmpty.wait(aLock, [this]() { return !myItems.empty() || myIsClosed; });
+  if (myItems.empty())
+  {
+    return false;
+  }
+
+  theFace          = myItems.front().first;
+  theTriangulation = myItems.front().second;
+  myItems.pop_front();
+  aLock.unlock();
+  myNotFull.notify_one();
+  return true;
+}
+
+//=================================================================================================
+
+bool BRepMesh_TriangulationQueue::TryPop(TopoDS_Face&                     theFace,
+                                         occ::handle<Poly_Triangulation>& theTriangulation)
+{
+  std::unique_lock<std::mutex> aLock(myMutex);
+  if (myItems.empty())
+  {
+    return false;
+  }
+
+  theFace          = myItems.front().first;
+  theTriangulation = myItems.front().second;
+  myItems.pop_front();
+  aLock.unlock();
+  myNotFull.notify_one();
+  return true;
+}
+
+//=================================================================================================
+
+void BRepMesh_TriangulationQueue::Close()
+{
+  {
+    std::lock_guard<std::mutex> aLock(myMutex);
+    myIsClosed = true;
+  }
+  myNotEmpty.notify_all();
+  myNotFull.notify_all();
+}
+
+//=================================================================================================
+
+void BRepMesh_TriangulationQueue::Reset()
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  myItems.clear();
+  myIsClosed = false;
+}
+
+//=================================================================================================
+
+void BRepMesh_TriangulationQueue::OnFaceMeshed(
+  const TopoDS_Face&                     theFace,
+  const occ::handle<Poly_Triangulation>& theTriangulation)
+{
+  {
+    std::unique_lock<std::mutex> aLock(myMutex);
+    myNotFull.wait(aLock, [this]() {
+      return myIsClosed || myCapacity == 0 || static_cast<int>(myItems.size()) < myCapacity;
+    });
+    if (myIsClosed)
+    {
+      return;
+    }
+    myItems.emplace_back(theFace, theTriangulation);
+  }
+  myNotEmpty.notify_one();
+}
+
+//=================================================================================================
+
+void BRepMesh_TriangulationQueue::OnMeshingDone()
+{
+  Close();
+}
@@ -0,0 +1,95 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BRepMesh_TriangulationQueue_HeaderFile
+#define _BRepMesh_TriangulationQueue_HeaderFile
+
+#include <BRepMesh_TriangulationListener.hxx>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <utility>
+
+//! Bounded queue of face triangulations filled by BRepMesh_IncrementalMesh and consumed by
+//! another thread, e.g. exporting triangulations into a file or sending them to a viewer.
+//! Meshing threads are blocked while the queue is full, which limits amount of data
+//! waiting for the consumer. Meshing should be run in a thread other than the consumer one:
+//! @code
+//!   occ::handle<BRepMesh_TriangulationQueue> aQueue = new BRepMesh_TriangulationQueue(64);
+//!   BRepMesh_IncrementalMesh aMesher;
+//!   aMesher.SetShape(aShape);
+//!   aMesher.SetTriangulationListener(aQueue);
+//!   std::thread aThread([&aMesher]() { aMesher.Perform(); });
+//!   TopoDS_Face aFace;
+//!   occ::handle<Poly_Triangulation> aTris;
+//!   while (aQueue->Pop(aFace, aTris))
+//!   {
+//!     // export triangulation of the face
+//!   }
+//!   aThread.join();
+//! @endcode
+class BRepMesh_TriangulationQueue : public BRepMesh_TriangulationListener
+{
+  DEFINE_STANDARD_RTTIEXT(BRepMesh_TriangulationQueue, BRepMesh_TriangulationListener)
+public:
+  //! Constructor.
+  //! @param[in] theCapacity maximum number of queued triangulations; 0 means unlimited
+  Standard_EXPORT BRepMesh_TriangulationQueue(const int theCapacity = 0);
+
+  //! Returns maximum number of queued triangulations.
+  int Capacity() const { return myCapacity; }
+
+  //! Returns number of queued triangulations.
+  Standard_EXPORT int Size() const;
+
+  //! Returns TRUE if Close() has been called.
+  Standard_EXPORT bool IsClosed() const;
+
+  //! Retrieves the first queued triangulation, waiting for it if the queue is empty.
+  //! @param[out] theFace          meshed face
+  //! @param[out] theTriangulation triangulation of the face
+  //! @return FALSE if the queue is empty and closed
+  Standard_EXPORT bool Pop(TopoDS_Face& theFace, occ::handle<Poly_Triangulation>& theTriangulation);
+
+  //! Retrieves the first queued triangulation without waiting.
+  //! @return FALSE if the queue is empty
+  Standard_EXPORT bool TryPop(TopoDS_Face&                     theFace,
+                              occ::handle<Poly_Triangulation>& theTriangulation);
+
+  //! Closes the queue and wakes up waiting threads. Queued triangulations can still be
+  //! retrieved, while triangulations reported after closing are dropped.
+  Standard_EXPORT void Close();
+
+  //! Reopens the closed queue and removes queued triangulations.
+  Standard_EXPORT void Reset();
+
+public:
+  //! Adds triangulation into the queue, waiting while the queue is full.
+  Standard_EXPORT void OnFaceMeshed(
+    const TopoDS_Face&                     theFace,
+    const occ::handle<Poly_Triangulation>& theTriangulation) override;
+
+  //! Closes the queue.
+  Standard_EXPORT void OnMeshingDone() override;
+
+private:
+  std::deque<std::pair<TopoDS_Face, occ::handle<Poly_Triangulation>>> myItems;
+  mutable std::mutex                                                   myMutex;
+  std::condition_variable                                              myNotEmpty;
+  std::condition_variable                                              myNotFull;
+  int                                                                  myCapacity;
+  bool                                                                 myIsClosed;
+};
+
+#endif // _BRepMesh_TriangulationQueue_HeaderFile
@@ -83,9 +83,17 @@ set(OCCT_BRepMesh_FILES
   BRepMesh_ShapeVisitor.hxx
   BRepMesh_SphereRangeSplitter.cxx
   BRepMesh_SphereRangeSplitter.hxx
+  BRepMesh_ThreadArena.cxx
+  BRepMesh_ThreadArena.hxx
   BRepMesh_TorusRangeSplitter.cxx
   BRepMesh_TorusRangeSplitter.hxx
   BRepMesh_Triangle.hxx
+  BRepMesh_TriangulationCache.cxx
+  BRepMesh_TriangulationCache.hxx
+  BRepMesh_TriangulationListener.cxx
+  BRepMesh_TriangulationListener.hxx
+  BRepMesh_TriangulationQueue.cxx
+  BRepMesh_TriangulationQueue.hxx
   BRepMesh_UndefinedRangeSplitter.cxx
   BRepMesh_UndefinedRangeSplitter.hxx
   BRepMesh_UVParamRangeSplitter.hxx
@@ -18,6 +18,7 @@
 #include <BRepMeshData_Face.hxx>
 #include <BRepMeshData_Edge.hxx>
 #include <NCollection_IncAllocator.hxx>
+#include <OSD_MemInfo.hxx>
 
 IMPLEMENT_STANDARD_RTTIEXT(BRepMeshData_Model, IMeshData_Model)
 
@@ -31,6 +32,7 @@ BRepMeshData_Model::BRepMeshData_Model(const TopoDS_Shape& theShape)
       myDEdges(256, myAllocator)
 {
   myAllocator->SetThreadSafe(true);
+  myAllocator->SetMemTag(OSD_MemInfo::MemTag_Mesh);
 }
 
 //=================================================================================================
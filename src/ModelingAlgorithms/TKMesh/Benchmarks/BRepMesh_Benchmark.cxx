@@ -0,0 +1,75 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <BRepPrimAPI_MakeSphere.hxx>
+#include <BRepPrimAPI_MakeTorus.hxx>
+#include <BRepTools.hxx>
+#include <TopoDS_Shape.hxx>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+//! Makes the reference shape of the given kind.
+TopoDS_Shape makeShape(const int theKind)
+{
+  switch (theKind)
+  {
+    case 0:
+      return BRepPrimAPI_MakeBox(10.0, 20.0, 30.0).Shape();
+    case 1:
+      return BRepPrimAPI_MakeSphere(10.0).Shape();
+    case 2:
+      return BRepPrimAPI_MakeCylinder(5.0, 20.0).Shape();
+    default:
+      return BRepPrimAPI_MakeTorus(20.0, 5.0).Shape();
+  }
+}
+} // namespace
+
+// Arguments: shape kind (0 - box, 1 - sphere, 2 - cylinder, 3 - torus),
+// linear deflection in hundredths of the model units.
+
+static void BRepMesh_IncrementalMesh_Shape(benchmark::State& theState)
+{
+  const TopoDS_Shape aShape      = makeShape(int(theState.range(0)));
+  const double       aDeflection = 0.01 * double(theState.range(1));
+  for (auto _ : theState)
+  {
+    BRepTools::Clean(aShape);
+    BRepMesh_IncrementalMesh aMesher(aShape, aDeflection, false, 0.5, false);
+    benchmark::DoNotOptimize(aMesher.IsDone());
+  }
+}
+BENCHMARK(BRepMesh_IncrementalMesh_Shape)
+  ->ArgsProduct({{0, 1, 2, 3}, {1, 10}})
+  ->Unit(benchmark::kMillisecond);
+
+static void BRepMesh_IncrementalMesh_Parallel(benchmark::State& theState)
+{
+  const TopoDS_Shape aShape      = makeShape(int(theState.range(0)));
+  const double       aDeflection = 0.01 * double(theState.range(1));
+  for (auto _ : theState)
+  {
+    BRepTools::Clean(aShape);
+    BRepMesh_IncrementalMesh aMesher(aShape, aDeflection, false, 0.5, true);
+    benchmark::DoNotOptimize(aMesher.IsDone());
+  }
+}
+BENCHMARK(BRepMesh_IncrementalMesh_Parallel)
+  ->ArgsProduct({{1, 3}, {1}})
+  ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,6 @@
+# Benchmark source files for TKMesh
+set(OCCT_TKMesh_Benchmarks_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
+
+set(OCCT_TKMesh_Benchmarks_FILES
+  BRepMesh_Benchmark.cxx
+)
@@ -0,0 +1,74 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRepMesh_CircleTool.hxx>
+#include <NCollection_IncAllocator.hxx>
+#include <gp_Circ2d.hxx>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace
+{
+//! Return indices of circles shot by the point.
+static std::vector<int> selectCircles(BRepMesh_CircleTool& theTool, const gp_XY& thePoint)
+{
+  std::vector<int> anIndices;
+  for (IMeshData::ListOfInteger::Iterator anIter(theTool.Select(thePoint)); anIter.More();
+       anIter.Next())
+  {
+    anIndices.push_back(anIter.Value());
+  }
+  return anIndices;
+}
+} // namespace
+
+TEST(BRepMesh_CircleToolTest, SelectShotCircles)
+{
+  BRepMesh_CircleTool aTool(new NCollection_IncAllocator());
+  EXPECT_TRUE(aTool.IsEmpty());
+  aTool.SetMinMaxSize(gp_XY(-100.0, -100.0), gp_XY(100.0, 100.0));
+  aTool.SetCellSize(200.0);
+
+  // many concentric circles to exceed block size of batch test
+  const int aNbCircles = 50;
+  for (int aCircleIter = 0; aCircleIter < aNbCircles; ++aCircleIter)
+  {
+    aTool.Bind(aCircleIter, gp_Circ2d(gp_Ax2d(gp::Origin2d(), gp::DX2d()), 1.0 + aCircleIter));
+  }
+  EXPECT_FALSE(aTool.IsEmpty());
+
+  std::vector<int> aShot = selectCircles(aTool, gp_XY(10.5, 0.0));
+  ASSERT_EQ(size_t(aNbCircles - 10), aShot.size());
+  for (size_t anIter = 0; anIter < aShot.size(); ++anIter)
+  {
+    EXPECT_GE(aShot[anIter], 10) << "point lies outside of circle " << aShot[anIter];
+  }
+
+  aTool.Delete(20);
+  aTool.Delete(49);
+  aShot = selectCircles(aTool, gp_XY(10.5, 0.0));
+  EXPECT_EQ(size_t(aNbCircles - 12), aShot.size());
+  for (size_t anIter = 0; anIter < aShot.size(); ++anIter)
+  {
+    EXPECT_TRUE(aShot[anIter] != 20 && aShot[anIter] != 49) << "deleted circle is selected";
+  }
+
+  // point on the circle is considered inside within tolerance
+  aShot = selectCircles(aTool, gp_XY(0.0, 3.0));
+  EXPECT_EQ(size_t(aNbCircles - 4), aShot.size());
+
+  // collinear points do not define a circle
+  EXPECT_FALSE(aTool.Bind(aNbCircles, gp_XY(0.0, 0.0), gp_XY(1.0, 0.0), gp_XY(2.0, 0.0)));
+}
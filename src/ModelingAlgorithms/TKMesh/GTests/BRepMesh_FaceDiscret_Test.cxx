@@ -0,0 +1,87 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRep_Builder.hxx>
+#include <BRep_Tool.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <BRepPrimAPI_MakeSphere.hxx>
+#include <BRepPrimAPI_MakeTorus.hxx>
+#include <Poly_Triangulation.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Compound.hxx>
+#include <gp_Ax2.hxx>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace
+{
+//! Create compound mixing many cheap planar faces with a few expensive curved faces.
+static TopoDS_Compound createMixedCompound()
+{
+  BRep_Builder    aBuilder;
+  TopoDS_Compound aCompound;
+  aBuilder.MakeCompound(aCompound);
+  for (int aBoxIter = 0; aBoxIter < 20; ++aBoxIter)
+  {
+    aBuilder.Add(aCompound, BRepPrimAPI_MakeBox(gp_Pnt(aBoxIter * 20.0, 0.0, 0.0), 10.0, 5.0, 2.0));
+  }
+  aBuilder.Add(aCompound, BRepPrimAPI_MakeSphere(gp_Pnt(0.0, 100.0, 0.0), 30.0).Shape());
+  aBuilder.Add(aCompound,
+               BRepPrimAPI_MakeTorus(gp_Ax2(gp_Pnt(100.0, 100.0, 0.0), gp::DZ()), 30.0, 10.0)
+                 .Shape());
+  aBuilder.Add(aCompound,
+               BRepPrimAPI_MakeCylinder(gp_Ax2(gp_Pnt(200.0, 100.0, 0.0), gp::DZ()), 20.0, 50.0)
+                 .Shape());
+  return aCompound;
+}
+
+//! Return number of triangles of each face of the shape.
+static std::vector<int> countTriangles(const TopoDS_Shape& theShape)
+{
+  std::vector<int> aNbTris;
+  for (TopExp_Explorer aFaceIter(theShape, TopAbs_FACE); aFaceIter.More(); aFaceIter.Next())
+  {
+    TopLoc_Location                       aLoc;
+    const occ::handle<Poly_Triangulation> aTris =
+      BRep_Tool::Triangulation(TopoDS::Face(aFaceIter.Current()), aLoc);
+    aNbTris.push_back(aTris.IsNull() ? 0 : aTris->NbTriangles());
+  }
+  return aNbTris;
+}
+} // namespace
+
+TEST(BRepMesh_FaceDiscretTest, ParallelMatchesSequential)
+{
+  const TopoDS_Compound aSeqShape = createMixedCompound();
+  const TopoDS_Compound aParShape = createMixedCompound();
+
+  BRepMesh_IncrementalMesh aSeqMesher(aSeqShape, 0.01, false, 0.5, false);
+  BRepMesh_IncrementalMesh aParMesher(aParShape, 0.01, false, 0.5, true);
+  EXPECT_TRUE(aSeqMesher.IsDone());
+  EXPECT_TRUE(aParMesher.IsDone());
+
+  const std::vector<int> aSeqTris = countTriangles(aSeqShape);
+  const std::vector<int> aParTris = countTriangles(aParShape);
+  ASSERT_EQ(aSeqTris.size(), aParTris.size());
+  for (size_t aFaceIter = 0; aFaceIter < aSeqTris.size(); ++aFaceIter)
+  {
+    EXPECT_GT(aSeqTris[aFaceIter], 0) << "face " << aFaceIter << " is not triangulated";
+    EXPECT_EQ(aSeqTris[aFaceIter], aParTris[aFaceIter])
+      << "order of processing should not affect triangulation of face " << aFaceIter;
+  }
+}
@@ -0,0 +1,211 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRep_Builder.hxx>
+#include <BRep_Tool.hxx>
+#include <BRepAlgoAPI_Cut.hxx>
+#include <BRepTools.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <BRepMesh_TriangulationQueue.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <Poly_PolygonOnTriangulation.hxx>
+#include <Poly_Triangulation.hxx>
+#include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Compound.hxx>
+#include <gp_Ax2.hxx>
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+namespace
+{
+//! Return triangulation of the face.
+static occ::handle<Poly_Triangulation> triangulation(const TopoDS_Shape& theFace)
+{
+  TopLoc_Location aLoc;
+  return BRep_Tool::Triangulation(TopoDS::Face(theFace), aLoc);
+}
+
+//! Meshed box with a hole drilled through top and bottom faces.
+struct DrilledBox
+{
+  TopoDS_Shape    Box;
+  TopoDS_Compound Initial; //!< compound of arguments and tools of Boolean operation
+  BRepAlgoAPI_Cut Cut;
+
+  DrilledBox()
+  {
+    Box = BRepPrimAPI_MakeBox(100.0, 100.0, 10.0).Shape();
+    BRepMesh_IncrementalMesh(Box, 0.1);
+
+    const TopoDS_Shape aTool =
+      BRepPrimAPI_MakeCylinder(gp_Ax2(gp_Pnt(50.0, 50.0, -5.0), gp::DZ()), 10.0, 20.0).Shape();
+    BRep_Builder aBuilder;
+    aBuilder.MakeCompound(Initial);
+    aBuilder.Add(Initial, Box);
+    aBuilder.Add(Initial, aTool);
+
+    NCollection_List<TopoDS_Shape> anArgs, aTools;
+    anArgs.Append(Box);
+    aTools.Append(aTool);
+    Cut.SetArguments(anArgs);
+    Cut.SetTools(aTools);
+    Cut.Build();
+  }
+};
+} // namespace
+
+TEST(BRepMesh_IncrementalMeshTest, RemeshChangedFacesByHistory)
+{
+  DrilledBox aModel;
+  ASSERT_TRUE(aModel.Cut.IsDone());
+  const TopoDS_Shape& aResult = aModel.Cut.Shape();
+
+  NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> anInitFaces;
+  TopExp::MapShapes(aModel.Box, TopAbs_FACE, anInitFaces);
+
+  NCollection_DataMap<TopoDS_Shape, occ::handle<Poly_Triangulation>, TopTools_ShapeMapHasher>
+    anUntouched;
+  int aNbChanged = 0;
+  for (TopExp_Explorer aFaceIter(aResult, TopAbs_FACE); aFaceIter.More(); aFaceIter.Next())
+  {
+    if (anInitFaces.Contains(aFaceIter.Current()))
+    {
+      ASSERT_FALSE(triangulation(aFaceIter.Current()).IsNull());
+      anUntouched.Bind(aFaceIter.Current(), triangulation(aFaceIter.Current()));
+    }
+    else
+    {
+      EXPECT_TRUE(triangulation(aFaceIter.Current()).IsNull());
+      ++aNbChanged;
+    }
+  }
+  ASSERT_EQ(4, anUntouched.Extent());
+  ASSERT_EQ(3, aNbChanged);
+
+  BRepMesh_IncrementalMesh aMesher;
+  aMesher.SetShape(aResult);
+  aMesher.ChangeParameters().Deflection = 0.1;
+  aMesher.ChangeParameters().Angle      = 0.5;
+  aMesher.SetHistory(aModel.Initial, aModel.Cut.History());
+  aMesher.Perform();
+  EXPECT_TRUE(aMesher.IsDone());
+
+  for (TopExp_Explorer aFaceIter(aResult, TopAbs_FACE); aFaceIter.More(); aFaceIter.Next())
+  {
+    const occ::handle<Poly_Triangulation> aTris = triangulation(aFaceIter.Current());
+    ASSERT_FALSE(aTris.IsNull()) << "changed face is not triangulated";
+    if (anUntouched.IsBound(aFaceIter.Current()))
+    {
+      EXPECT_EQ(anUntouched.Find(aFaceIter.Current()), aTris)
+        << "triangulation of untouched face should be kept";
+    }
+  }
+
+  // all edges should have polygons on triangulations of all adjacent faces with the same nodes
+  NCollection_IndexedDataMap<TopoDS_Shape, NCollection_List<TopoDS_Shape>, TopTools_ShapeMapHasher>
+    anEdgeFaces;
+  TopExp::MapShapesAndAncestors(aResult, TopAbs_EDGE, TopAbs_FACE, anEdgeFaces);
+  for (int anEdgeIter = 1; anEdgeIter <= anEdgeFaces.Extent(); ++anEdgeIter)
+  {
+    const TopoDS_Edge& anEdge = TopoDS::Edge(anEdgeFaces.FindKey(anEdgeIter));
+    int                aNbNodes = -1;
+    for (NCollection_List<TopoDS_Shape>::Iterator aFaceIter(anEdgeFaces(anEdgeIter));
+         aFaceIter.More();
+         aFaceIter.Next())
+    {
+      TopLoc_Location                                aLoc;
+      const occ::handle<Poly_Triangulation>          aTris = triangulation(aFaceIter.Value());
+      const occ::handle<Poly_PolygonOnTriangulation> aPoly =
+        BRep_Tool::PolygonOnTriangulation(anEdge, aTris, aLoc);
+      ASSERT_FALSE(aPoly.IsNull()) << "edge " << anEdgeIter << " has no polygon on triangulation";
+      if (aNbNodes == -1)
+      {
+        aNbNodes = aPoly->NbNodes();
+      }
+      EXPECT_EQ(aNbNodes, aPoly->NbNodes()) << "edge " << anEdgeIter << " has a crack";
+    }
+  }
+}
+
+TEST(BRepMesh_IncrementalMeshTest, EmptyHistoryKeepsShape)
+{
+  DrilledBox aModel;
+  ASSERT_TRUE(aModel.Cut.IsDone());
+
+  BRepMesh_IncrementalMesh aMesher;
+  aMesher.SetShape(aModel.Cut.Shape());
+  aMesher.ChangeParameters().Deflection = 0.1;
+  aMesher.SetHistory(aModel.Initial, new BRepTools_History());
+  aMesher.Perform();
+  EXPECT_TRUE(aMesher.IsDone());
+  EXPECT_EQ(0, aMesher.GetStatusFlags());
+
+  int aNbMeshed = 0;
+  for (TopExp_Explorer aFaceIter(aModel.Cut.Shape(), TopAbs_FACE); aFaceIter.More();
+       aFaceIter.Next())
+  {
+    aNbMeshed += triangulation(aFaceIter.Current()).IsNull() ? 0 : 1;
+  }
+  EXPECT_EQ(4, aNbMeshed) << "faces not referred by history should not be meshed";
+}
+
+TEST(BRepMesh_IncrementalMeshTest, StreamTriangulationsThroughQueue)
+{
+  const TopoDS_Shape aShape =
+    BRepPrimAPI_MakeCylinder(gp_Ax2(gp_Pnt(0.0, 0.0, 0.0), gp::DZ()), 10.0, 20.0).Shape();
+  NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> aFaces;
+  TopExp::MapShapes(aShape, TopAbs_FACE, aFaces);
+
+  for (int aPass = 0; aPass < 2; ++aPass)
+  {
+    const bool isCompact = aPass == 1;
+    BRepTools::Clean(aShape);
+
+    // capacity of a single item makes meshing threads wait for the consumer
+    occ::handle<BRepMesh_TriangulationQueue> aQueue = new BRepMesh_TriangulationQueue(1);
+    BRepMesh_IncrementalMesh                 aMesher;
+    aMesher.SetShape(aShape);
+    aMesher.ChangeParameters().Deflection           = 0.01;
+    aMesher.ChangeParameters().InParallel           = true;
+    aMesher.ChangeParameters().CompactTriangulation = isCompact;
+    aMesher.SetTriangulationListener(aQueue);
+    std::thread aThread([&aMesher]() { aMesher.Perform(); });
+
+    NCollection_Map<TopoDS_Shape, TopTools_ShapeMapHasher> aReported;
+    TopoDS_Face                                            aFace;
+    occ::handle<Poly_Triangulation>                        aTris;
+    while (aQueue->Pop(aFace, aTris))
+    {
+      EXPECT_LE(aQueue->Size(), aQueue->Capacity());
+      EXPECT_TRUE(aFaces.Contains(aFace));
+      EXPECT_TRUE(aReported.Add(aFace)) << "face reported twice";
+      ASSERT_FALSE(aTris.IsNull());
+      EXPECT_GT(aTris->NbTriangles(), 0);
+      EXPECT_EQ(isCompact, aTris->IsCompact());
+    }
+    aThread.join();
+
+    EXPECT_TRUE(aMesher.IsDone());
+    EXPECT_TRUE(aQueue->IsClosed());
+    EXPECT_EQ(aFaces.Extent(), aReported.Extent());
+    for (int aFaceIter = 1; aFaceIter <= aFaces.Extent(); ++aFaceIter)
+    {
+      EXPECT_FALSE(triangulation(aFaces(aFaceIter)).IsNull());
+    }
+  }
+}
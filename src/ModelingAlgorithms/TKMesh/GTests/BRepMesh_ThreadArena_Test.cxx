@@ -0,0 +1,67 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRepMesh_ThreadArena.hxx>
+#include <IMeshData_Types.hxx>
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+TEST(BRepMesh_ThreadArenaTest, ReuseWithinThread)
+{
+  NCollection_IncAllocator* anAlloc = nullptr;
+  {
+    BRepMesh_ThreadArena           anArena;
+    IMeshData::MapOfIntegerInteger aMap(1, anArena.Allocator());
+    IMeshData::VectorOfInteger     aVec(16, anArena.Allocator());
+    for (int anIter = 0; anIter < 1000; ++anIter)
+    {
+      aMap.Bind(anIter, true);
+      aVec.Append(anIter);
+    }
+    anAlloc = anArena.Allocator().get();
+  }
+  {
+    BRepMesh_ThreadArena anArena;
+    EXPECT_EQ(anAlloc, anArena.Allocator().get()) << "released allocator should be reused";
+
+    BRepMesh_ThreadArena aNested;
+    EXPECT_NE(anArena.Allocator(), aNested.Allocator())
+      << "nested lease should receive another allocator";
+  }
+
+  // allocator from another thread should not be shared
+  NCollection_IncAllocator* anOtherAlloc = nullptr;
+  std::thread               aThread([&anOtherAlloc]() {
+    BRepMesh_ThreadArena anArena;
+    anOtherAlloc = anArena.Allocator().get();
+  });
+  aThread.join();
+  EXPECT_NE(anAlloc, anOtherAlloc);
+}
+
+TEST(BRepMesh_ThreadArenaTest, KeepReferencedAllocator)
+{
+  occ::handle<NCollection_IncAllocator> aKept;
+  {
+    BRepMesh_ThreadArena anArena;
+    aKept = anArena.Allocator();
+    void* aData = aKept->Allocate(64);
+    memset(aData, 1, 64);
+  }
+
+  BRepMesh_ThreadArena anArena;
+  EXPECT_NE(aKept, anArena.Allocator())
+    << "allocator referenced after release of lease should not be reused";
+}
@@ -0,0 +1,185 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRep_Tool.hxx>
+#include <BRepBuilderAPI_Copy.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <BRepMesh_TriangulationCache.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <OSD_File.hxx>
+#include <OSD_Path.hxx>
+#include <Poly_Triangulation.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <gp_Ax2.hxx>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace
+{
+//! Create the cylinder used by all tests.
+static TopoDS_Shape createCylinder()
+{
+  return BRepPrimAPI_MakeCylinder(gp_Ax2(gp_Pnt(10.0, 0.0, 0.0), gp::DZ()), 20.0, 50.0).Shape();
+}
+
+//! Mesh the shape using the cache.
+static void meshShape(const TopoDS_Shape&                             theShape,
+                      const occ::handle<BRepMesh_TriangulationCache>& theCache)
+{
+  BRepMesh_IncrementalMesh aMesher;
+  aMesher.SetShape(theShape);
+  aMesher.ChangeParameters().Deflection = 0.01;
+  aMesher.ChangeParameters().Angle      = 0.5;
+  aMesher.SetTriangulationCache(theCache);
+  aMesher.Perform();
+  EXPECT_TRUE(aMesher.IsDone());
+}
+
+//! Return triangulations of faces of the shape with their locations.
+static std::vector<occ::handle<Poly_Triangulation>> triangulations(
+  const TopoDS_Shape&           theShape,
+  std::vector<TopLoc_Location>& theLocs)
+{
+  std::vector<occ::handle<Poly_Triangulation>> aTris;
+  for (TopExp_Explorer aFaceIter(theShape, TopAbs_FACE); aFaceIter.More(); aFaceIter.Next())
+  {
+    TopLoc_Location aLoc;
+    aTris.push_back(BRep_Tool::Triangulation(TopoDS::Face(aFaceIter.Current()), aLoc));
+    theLocs.push_back(aLoc);
+  }
+  return aTris;
+}
+} // namespace
+
+TEST(BRepMesh_TriangulationCacheTest, ReuseIdenticalFaces)
+{
+  occ::handle<BRepMesh_TriangulationCache> aCache = new BRepMesh_TriangulationCache();
+
+  const TopoDS_Shape aShape1 = createCylinder();
+  meshShape(aShape1, aCache);
+  EXPECT_EQ(size_t(0), aCache->NbHits());
+  EXPECT_EQ(size_t(3), aCache->NbMisses());
+  EXPECT_EQ(3, aCache->NbEntries());
+  EXPECT_GT(aCache->UsedMemory(), size_t(0));
+
+  // the same geometry placed with another location should reuse triangulations
+  gp_Trsf aTrsf;
+  aTrsf.SetTranslation(gp_Vec(100.0, 50.0, 0.0));
+  const TopoDS_Shape aShape2 =
+    BRepBuilderAPI_Copy(aShape1.Moved(TopLoc_Location(aTrsf)), true, false).Shape();
+  meshShape(aShape2, aCache);
+  EXPECT_EQ(size_t(3), aCache->NbHits());
+  EXPECT_EQ(3, aCache->NbEntries());
+
+  std::vector<TopLoc_Location>                       aLocs1, aLocs2;
+  const std::vector<occ::handle<Poly_Triangulation>> aTris1 = triangulations(aShape1, aLocs1);
+  const std::vector<occ::handle<Poly_Triangulation>> aTris2 = triangulations(aShape2, aLocs2);
+  ASSERT_EQ(aTris1.size(), aTris2.size());
+  for (size_t aFaceIter = 0; aFaceIter < aTris1.size(); ++aFaceIter)
+  {
+    ASSERT_FALSE(aTris2[aFaceIter].IsNull()) << "face " << aFaceIter << " is not triangulated";
+    EXPECT_NE(aTris1[aFaceIter], aTris2[aFaceIter]) << "triangulation should be copied";
+    ASSERT_EQ(aTris1[aFaceIter]->NbNodes(), aTris2[aFaceIter]->NbNodes());
+    EXPECT_EQ(aTris1[aFaceIter]->NbTriangles(), aTris2[aFaceIter]->NbTriangles());
+    for (int aNodeIter = 1; aNodeIter <= aTris1[aFaceIter]->NbNodes(); ++aNodeIter)
+    {
+      const gp_Pnt aPnt1 =
+        aTris1[aFaceIter]->Node(aNodeIter).Transformed(aLocs1[aFaceIter].Transformation());
+      const gp_Pnt aPnt2 =
+        aTris2[aFaceIter]->Node(aNodeIter).Transformed(aLocs2[aFaceIter].Transformation());
+      EXPECT_NEAR(0.0, aPnt1.Translated(gp_Vec(100.0, 50.0, 0.0)).Distance(aPnt2), 1.0e-9);
+    }
+  }
+
+  // another deflection should not match cached triangulations
+  const TopoDS_Shape       aShape3 = createCylinder();
+  BRepMesh_IncrementalMesh aMesher;
+  aMesher.SetShape(aShape3);
+  aMesher.ChangeParameters().Deflection = 0.1;
+  aMesher.SetTriangulationCache(aCache);
+  aMesher.Perform();
+  EXPECT_EQ(size_t(3), aCache->NbHits());
+  EXPECT_EQ(6, aCache->NbEntries());
+
+  aCache->Clear();
+  EXPECT_EQ(0, aCache->NbEntries());
+  EXPECT_EQ(size_t(0), aCache->UsedMemory());
+  EXPECT_EQ(size_t(0), aCache->NbHits());
+}
+
+TEST(BRepMesh_TriangulationCacheTest, EvictLeastRecentlyUsed)
+{
+  occ::handle<BRepMesh_TriangulationCache> aCache = new BRepMesh_TriangulationCache();
+  meshShape(createCylinder(), aCache);
+  ASSERT_EQ(3, aCache->NbEntries());
+  const size_t aUsedMemory = aCache->UsedMemory();
+
+  aCache->SetMaxMemory(aUsedMemory / 2);
+  EXPECT_LT(aCache->NbEntries(), 3);
+  EXPECT_LE(aCache->UsedMemory(), aCache->MaxMemory());
+
+  aCache->SetMaxMemory(0);
+  EXPECT_EQ(0, aCache->NbEntries());
+  EXPECT_EQ(size_t(0), aCache->UsedMemory());
+
+  meshShape(createCylinder(), aCache);
+  EXPECT_EQ(0, aCache->NbEntries()) << "entries beyond memory limit should not be kept";
+}
+
+TEST(BRepMesh_TriangulationCacheTest, SaveAndLoad)
+{
+  const TCollection_AsciiString aFile = "BRepMesh_TriangulationCacheTest_SaveAndLoad.bin";
+
+  occ::handle<BRepMesh_TriangulationCache> aCache = new BRepMesh_TriangulationCache();
+  const TopoDS_Shape                       aShape1 = createCylinder();
+  meshShape(aShape1, aCache);
+  ASSERT_TRUE(aCache->Save(aFile));
+
+  occ::handle<BRepMesh_TriangulationCache> aLoaded = new BRepMesh_TriangulationCache();
+  ASSERT_TRUE(aLoaded->Load(aFile));
+  OSD_File(OSD_Path(aFile)).Remove();
+  EXPECT_EQ(aCache->NbEntries(), aLoaded->NbEntries());
+  EXPECT_EQ(aCache->UsedMemory(), aLoaded->UsedMemory());
+
+  const TopoDS_Shape aShape2 = createCylinder();
+  meshShape(aShape2, aLoaded);
+  EXPECT_EQ(size_t(3), aLoaded->NbHits());
+
+  std::vector<TopLoc_Location>                       aLocs1, aLocs2;
+  const std::vector<occ::handle<Poly_Triangulation>> aTris1 = triangulations(aShape1, aLocs1);
+  const std::vector<occ::handle<Poly_Triangulation>> aTris2 = triangulations(aShape2, aLocs2);
+  ASSERT_EQ(aTris1.size(), aTris2.size());
+  for (size_t aFaceIter = 0; aFaceIter < aTris1.size(); ++aFaceIter)
+  {
+    ASSERT_FALSE(aTris2[aFaceIter].IsNull());
+    ASSERT_EQ(aTris1[aFaceIter]->NbNodes(), aTris2[aFaceIter]->NbNodes());
+    ASSERT_EQ(aTris1[aFaceIter]->NbTriangles(), aTris2[aFaceIter]->NbTriangles());
+    for (int aNodeIter = 1; aNodeIter <= aTris1[aFaceIter]->NbNodes(); ++aNodeIter)
+    {
+      EXPECT_TRUE(aTris1[aFaceIter]->Node(aNodeIter).IsEqual(aTris2[aFaceIter]->Node(aNodeIter),
+                                                             0.0));
+    }
+    for (int aTriIter = 1; aTriIter <= aTris1[aFaceIter]->NbTriangles(); ++aTriIter)
+    {
+      int aN1[3], aN2[3];
+      aTris1[aFaceIter]->Triangle(aTriIter).Get(aN1[0], aN1[1], aN1[2]);
+      aTris2[aFaceIter]->Triangle(aTriIter).Get(aN2[0], aN2[1], aN2[2]);
+      EXPECT_TRUE(aN1[0] == aN2[0] && aN1[1] == aN2[1] && aN1[2] == aN2[2]);
+    }
+  }
+
+  EXPECT_FALSE(aLoaded->Load("BRepMesh_TriangulationCacheTest_Missing.bin"));
+}
@@ -2,6 +2,11 @@
 set(OCCT_TKMesh_GTests_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
 
 set(OCCT_TKMesh_GTests_FILES
+  BRepMesh_CircleTool_Test.cxx
   BRepMesh_Delaun_Test.cxx
+  BRepMesh_FaceDiscret_Test.cxx
   BRepMesh_GeomTool_Test.cxx
+  BRepMesh_IncrementalMesh_Test.cxx
+  BRepMesh_ThreadArena_Test.cxx
+  BRepMesh_TriangulationCache_Test.cxx
 )
@@ -22,6 +22,7 @@
 #include <IMeshTools_Parameters.hxx>
 #include <IMeshTools_ModelAlgo.hxx>
 #include <Message_ProgressRange.hxx>
+#include <OSD_TraceZone.hxx>
 
 //! Interface class representing context of BRepMesh algorithm.
 //! Intended to cache discrete model and instances of tools for
@@ -39,6 +40,7 @@ public:
   //! @return True on success, False elsewhere.
   virtual bool BuildModel()
   {
+    OSD_TRACE_ZONE_CATEGORY("IMeshTools_Context::BuildModel", "mesh");
     if (myModelBuilder.IsNull())
     {
       return false;
@@ -53,6 +55,7 @@ public:
   //! @return True on success, False elsewhere.
   virtual bool DiscretizeEdges()
   {
+    OSD_TRACE_ZONE_CATEGORY("IMeshTools_Context::DiscretizeEdges", "mesh");
     if (myModel.IsNull() || myEdgeDiscret.IsNull())
     {
       return false;
@@ -67,6 +70,7 @@ public:
   //! @return True on success, False elsewhere.
   virtual bool HealModel()
   {
+    OSD_TRACE_ZONE_CATEGORY("IMeshTools_Context::HealModel", "mesh");
     if (myModel.IsNull())
     {
       return false;
@@ -82,6 +86,7 @@ public:
   //! @return True on success, False elsewhere.
   virtual bool PreProcessModel()
   {
+    OSD_TRACE_ZONE_CATEGORY("IMeshTools_Context::PreProcessModel", "mesh");
     if (myModel.IsNull())
     {
       return false;
@@ -96,6 +101,7 @@ public:
   //! @return True on success, False elsewhere.
   virtual bool DiscretizeFaces(const Message_ProgressRange& theRange)
   {
+    OSD_TRACE_ZONE_CATEGORY("IMeshTools_Context::DiscretizeFaces", "mesh");
     if (myModel.IsNull() || myFaceDiscret.IsNull())
     {
       return false;
@@ -109,6 +115,7 @@ public:
   //! @return True on success, False elsewhere.
   virtual bool PostProcessModel()
   {
+    OSD_TRACE_ZONE_CATEGORY("IMeshTools_Context::PostProcessModel", "mesh");
     if (myModel.IsNull())
     {
       return false;
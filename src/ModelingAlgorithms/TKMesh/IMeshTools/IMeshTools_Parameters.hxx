@@ -39,7 +39,9 @@ struct IMeshTools_Parameters
         CleanModel(true),
         AdjustMinSize(false),
         ForceFaceDeflection(false),
-        AllowQualityDecrease(false)
+        AllowQualityDecrease(false),
+        OptimizeVertexCache(false),
+        CompactTriangulation(false)
   {
   }
 
@@ -101,6 +103,16 @@ struct IMeshTools_Parameters
   //! Allows/forbids the decrease of the quality of the generated mesh
   //! over the existing one.
   bool AllowQualityDecrease;
+
+  //! Reorders triangles and nodes of generated triangulations for rendering by GPU
+  //! (see Poly_VertexCacheOptimizer); polygons on triangulation of edges are renumbered accordingly.
+  //! Disabled by default.
+  bool OptimizeVertexCache;
+
+  //! Converts generated triangulations into compact storage for display-only usage
+  //! (see Poly_Triangulation::Compact()): single precision nodes, quantized normals, no UV nodes.
+  //! Disabled by default.
+  bool CompactTriangulation;
 };
 
 #endif
@@ -46,6 +46,136 @@
 #include <BOPTools_BoxTree.hxx>
 //
 #include <BOPTools_AlgoTools.hxx>
+#include <OSD_Parallel.hxx>
+
+//=================================================================================================
+
+//! Intersection of the pair of faces, used for the parallel intersection of the pairs.
+class BRepOffset_FaceInterJob
+{
+public:
+  DEFINE_STANDARD_ALLOC
+
+  BRepOffset_FaceInterJob()
+      : Side(TopAbs_UNKNOWN),
+        IsPipes(false)
+  {
+  }
+
+  void Perform()
+  {
+    Message_ProgressScope aPS(Range, nullptr, 1);
+    if (!aPS.More())
+    {
+      return;
+    }
+    if (IsPipes)
+    {
+      BRepOffset_Tool::PipeInter(Face1, Face2, LInt1, LInt2, Side);
+    }
+    else
+    {
+      BRepOffset_Tool::Inter3D(Face1, Face2, LInt1, LInt2, Side, RefEdge, RefFace1, RefFace2);
+    }
+  }
+
+public:
+  TopoDS_Face                    Face1;
+  TopoDS_Face                    Face2;
+  TopoDS_Edge                    RefEdge;
+  TopoDS_Face                    RefFace1;
+  TopoDS_Face                    RefFace2;
+  TopAbs_State                   Side;
+  bool                           IsPipes;
+  Message_ProgressRange          Range;
+  NCollection_List<TopoDS_Shape> LInt1;
+  NCollection_List<TopoDS_Shape> LInt2;
+};
+
+//=======================================================================
+// function : PerformJobs
+// purpose  : Performs the intersections of the pairs of faces.
+//            The intersection of faces updates their sub-shapes (3D curves
+//            of edges, tolerances), thus the pairs sharing sub-shapes are
+//            intersected in the order of jobs. For that the jobs are
+//            distributed by waves, so that the jobs of the same wave do not
+//            share sub-shapes; the waves are treated one after another,
+//            the jobs of each wave are treated in parallel.
+//            Returns false in case of user break.
+//=======================================================================
+static bool PerformJobs(NCollection_Vector<BRepOffset_FaceInterJob>& theJobs,
+                        const bool                                   theRunParallel,
+                        const Message_ProgressScope&                 thePS)
+{
+  const int aNbJobs = theJobs.Length();
+  if (!theRunParallel || aNbJobs < 2)
+  {
+    for (int i = 0; i < aNbJobs; ++i)
+    {
+      if (!thePS.More())
+      {
+        return false;
+      }
+      theJobs(i).Perform();
+    }
+    return thePS.More();
+  }
+  //
+  // the last wave using the sub-shape (with location stripped, as the
+  // located instances share the same TShape)
+  NCollection_DataMap<TopoDS_Shape, int, TopTools_ShapeMapHasher> aMSWave;
+  NCollection_Vector<NCollection_Vector<int>>                     aWaves;
+  for (int i = 0; i < aNbJobs; ++i)
+  {
+    const BRepOffset_FaceInterJob& aJob = theJobs(i);
+    //
+    NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> aMS;
+    for (int j = 0; j < 2; ++j)
+    {
+      NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> aMSF;
+      TopExp::MapShapes(!j ? aJob.Face1 : aJob.Face2, aMSF);
+      for (int k = 1; k <= aMSF.Extent(); ++k)
+      {
+        aMS.Add(aMSF(k).Located(TopLoc_Location()));
+      }
+    }
+    //
+    int aWave = 0;
+    for (int k = 1; k <= aMS.Extent(); ++k)
+    {
+      if (const int* pWave = aMSWave.Seek(aMS(k)))
+      {
+        aWave = std::max(aWave, *pWave + 1);
+      }
+    }
+    for (int k = 1; k <= aMS.Extent(); ++k)
+    {
+      aMSWave.Bind(aMS(k), aWave);
+    }
+    //
+    while (aWaves.Length() <= aWave)
+    {
+      aWaves.Appended();
+    }
+    aWaves.ChangeValue(aWave).Append(i);
+  }
+  //
+  for (NCollection_Vector<NCollection_Vector<int>>::Iterator aItW(aWaves); aItW.More();
+       aItW.Next())
+  {
+    if (!thePS.More())
+    {
+      return false;
+    }
+    const NCollection_Vector<int>& aWave = aItW.Value();
+    OSD_Parallel::For(
+      0,
+      aWave.Length(),
+      [&](const int theIndex) { theJobs.ChangeValue(aWave(theIndex)).Perform(); },
+      aWave.Length() < 2);
+  }
+  return thePS.More();
+}
 
 //=================================================================================================
 
@@ -54,7 +184,8 @@ BRepOffset_Inter3d::BRepOffset_Inter3d(const occ::handle<BRepAlgo_AsDes>& AsDes,
                                        const double                       Tol)
     : myAsDes(AsDes),
       mySide(Side),
-      myTol(Tol)
+      myTol(Tol),
+      myRunParallel(false)
 {
 }
 
@@ -127,23 +258,70 @@ void BRepOffset_Inter3d::CompletInt(const NCollection_List<TopoDS_Shape>& SetOfF
   aSelector.Select();
   aSelector.Sort();
 
-  // Treat the selected pairs
+  // Define the selected pairs to treat
   const std::vector<BOPTools_BoxPairSelector::PairIDs>& aPairs   = aSelector.Pairs();
   const int                                             aNbPairs = static_cast<int>(aPairs.size());
   Message_ProgressScope aPS(theRange, "Complete intersection", aNbPairs);
-  for (int iPair = 0; iPair < aNbPairs; ++iPair, aPS.Next())
+  //
+  NCollection_Vector<BRepOffset_FaceInterJob> aVJobs;
+  // treated pairs with indices of their jobs (-1 if faces are not to be intersected)
+  NCollection_Vector<std::pair<int, int>> aVPairs;
+  for (int iPair = 0; iPair < aNbPairs; ++iPair)
   {
-    if (!aPS.More())
-    {
-      return;
-    }
     const BOPTools_BoxPairSelector::PairIDs& aPair = aPairs[iPair];
 
     const TopoDS_Face& aF1 = TopoDS::Face(aMFaces.FindKey(std::min(aPair.ID1, aPair.ID2)));
     const TopoDS_Face& aF2 = TopoDS::Face(aMFaces.FindKey(std::max(aPair.ID1, aPair.ID2)));
 
-    // intersect faces
-    FaceInter(aF1, aF2, InitOffsetFace);
+    bool bToIntersect = false, bIsPipes = false;
+    if (!FaceInterType(aF1, aF2, InitOffsetFace, bToIntersect, bIsPipes))
+    {
+      aPS.Next();
+      continue;
+    }
+    //
+    int iJob = -1;
+    if (bToIntersect)
+    {
+      BRepOffset_FaceInterJob& aJob = aVJobs.Appended();
+      aJob.Face1                    = aF1;
+      aJob.Face2                    = aF2;
+      aJob.Side                     = mySide;
+      aJob.IsPipes                  = bIsPipes;
+      aJob.Range                    = aPS.Next();
+      iJob                          = aVJobs.Length() - 1;
+    }
+    else
+    {
+      aPS.Next();
+    }
+    aVPairs.Append(std::make_pair(iPair, iJob));
+  }
+  //
+  // intersect faces
+  if (!PerformJobs(aVJobs, myRunParallel, aPS))
+  {
+    return;
+  }
+  //
+  // store the results in the order of pairs
+  const NCollection_List<TopoDS_Shape> anEmptyList;
+  for (NCollection_Vector<std::pair<int, int>>::Iterator aItP(aVPairs); aItP.More(); aItP.Next())
+  {
+    const BOPTools_BoxPairSelector::PairIDs& aPair = aPairs[aItP.Value().first];
+
+    const TopoDS_Face& aF1  = TopoDS::Face(aMFaces.FindKey(std::min(aPair.ID1, aPair.ID2)));
+    const TopoDS_Face& aF2  = TopoDS::Face(aMFaces.FindKey(std::max(aPair.ID1, aPair.ID2)));
+    const int          iJob = aItP.Value().second;
+    if (iJob < 0)
+    {
+      Store(aF1, aF2, anEmptyList, anEmptyList);
+    }
+    else
+    {
+      const BRepOffset_FaceInterJob& aJob = aVJobs(iJob);
+      Store(aF1, aF2, aJob.LInt1, aJob.LInt2);
+    }
   }
 }
 
@@ -156,25 +334,51 @@ void BRepOffset_Inter3d::FaceInter(const TopoDS_Face&    F1,
                                    const TopoDS_Face&    F2,
                                    const BRepAlgo_Image& InitOffsetFace)
 {
+  bool bToIntersect = false, bIsPipes = false;
+  if (!FaceInterType(F1, F2, InitOffsetFace, bToIntersect, bIsPipes))
+    return;
+
   NCollection_List<TopoDS_Shape> LInt1, LInt2;
-  TopoDS_Edge                    NullEdge;
-  TopoDS_Face                    NullFace;
+  if (bToIntersect)
+  {
+    if (bIsPipes)
+    {
+      BRepOffset_Tool::PipeInter(F1, F2, LInt1, LInt2, mySide);
+    }
+    else
+    {
+      TopoDS_Edge NullEdge;
+      TopoDS_Face NullFace;
+      BRepOffset_Tool::Inter3D(F1, F2, LInt1, LInt2, mySide, NullEdge, NullFace, NullFace);
+    }
+  }
+  Store(F1, F2, LInt1, LInt2);
+}
+
+//=================================================================================================
+
+bool BRepOffset_Inter3d::FaceInterType(const TopoDS_Face&    F1,
+                                       const TopoDS_Face&    F2,
+                                       const BRepAlgo_Image& InitOffsetFace,
+                                       bool&                 theToIntersect,
+                                       bool&                 theIsPipes) const
+{
+  theToIntersect = false;
+  theIsPipes     = false;
 
   if (F1.IsSame(F2))
-    return;
+    return false;
   if (IsDone(F1, F2))
-    return;
+    return false;
 
   const TopoDS_Shape& InitF1 = InitOffsetFace.ImageFrom(F1);
   const TopoDS_Shape& InitF2 = InitOffsetFace.ImageFrom(F2);
   if (InitF1.IsSame(InitF2))
-    return;
+    return false;
 
   bool InterPipes = (InitF2.ShapeType() == TopAbs_EDGE && InitF1.ShapeType() == TopAbs_EDGE);
   bool InterFaces = (InitF1.ShapeType() == TopAbs_FACE && InitF2.ShapeType() == TopAbs_FACE);
   NCollection_List<TopoDS_Shape> LE, LV;
-  LInt1.Clear();
-  LInt2.Clear();
   if (BRepOffset_Tool::FindCommonShapes(F1, F2, LE, LV) || myAsDes->HasCommonDescendant(F1, F2, LE))
   {
     //-------------------------------------------------
@@ -205,7 +409,8 @@ void BRepOffset_Inter3d::FaceInter(const TopoDS_Face&    F1,
         }
         if (!InitOffsetFace.HasImage(V))
         { // no sphere
-          BRepOffset_Tool::PipeInter(F1, F2, LInt1, LInt2, mySide);
+          theToIntersect = true;
+          theIsPipes     = true;
         }
       }
       else
@@ -220,14 +425,11 @@ void BRepOffset_Inter3d::FaceInter(const TopoDS_Face&    F1,
         {
           if (BRepOffset_Tool::FindCommonShapes(TopoDS::Face(InitF1), TopoDS::Face(InitF2), LE, LV))
           {
-            if (!LE.IsEmpty())
-            {
-              BRepOffset_Tool::Inter3D(F1, F2, LInt1, LInt2, mySide, NullEdge, NullFace, NullFace);
-            }
+            theToIntersect = !LE.IsEmpty();
           }
           else
           {
-            BRepOffset_Tool::Inter3D(F1, F2, LInt1, LInt2, mySide, NullEdge, NullFace, NullFace);
+            theToIntersect = true;
           }
         }
       }
@@ -235,16 +437,10 @@ void BRepOffset_Inter3d::FaceInter(const TopoDS_Face&    F1,
   }
   else
   {
-    if (InterPipes)
-    {
-      BRepOffset_Tool::PipeInter(F1, F2, LInt1, LInt2, mySide);
-    }
-    else
-    {
-      BRepOffset_Tool::Inter3D(F1, F2, LInt1, LInt2, mySide, NullEdge, NullFace, NullFace);
-    }
+    theToIntersect = true;
+    theIsPipes     = InterPipes;
   }
-  Store(F1, F2, LInt1, LInt2);
+  return true;
 }
 
 //=================================================================================================
@@ -269,7 +465,8 @@ void BRepOffset_Inter3d::ConnexIntByArc(const NCollection_List<TopoDS_Shape>& /*
   // etape 1 : Intersection of faces // corresponding to the initial faces
   //           separated by a concave edge if offset > 0, otherwise convex.
   //---------------------------------------------------------------------
-  for (; Exp.More(); Exp.Next(), aPSIntF.Next())
+  NCollection_Vector<BRepOffset_FaceInterJob> aVJobs;
+  for (; Exp.More(); Exp.Next())
   {
     if (!aPSIntF.More())
     {
@@ -292,11 +489,31 @@ void BRepOffset_Inter3d::ConnexIntByArc(const NCollection_List<TopoDS_Shape>& /*
         F2                        = TopoDS::Face(InitOffsetFace.Image(InitF2).First());
         if (!IsDone(F1, F2))
         {
-          BRepOffset_Tool::Inter3D(F1, F2, LInt1, LInt2, mySide, E, InitF1, InitF2);
-          Store(F1, F2, LInt1, LInt2);
+          // the pair is intersected later, with other pairs
+          SetDone(F1, F2);
+          BRepOffset_FaceInterJob& aJob = aVJobs.Appended();
+          aJob.Face1                    = F1;
+          aJob.Face2                    = F2;
+          aJob.RefEdge                  = E;
+          aJob.RefFace1                 = InitF1;
+          aJob.RefFace2                 = InitF2;
+          aJob.Side                     = mySide;
+          aJob.Range                    = aPSIntF.Next();
+          continue;
         }
       }
     }
+    aPSIntF.Next();
+  }
+  //
+  if (!PerformJobs(aVJobs, myRunParallel, aPSIntF))
+  {
+    return;
+  }
+  for (NCollection_Vector<BRepOffset_FaceInterJob>::Iterator aItJ(aVJobs); aItJ.More(); aItJ.Next())
+  {
+    const BRepOffset_FaceInterJob& aJob = aItJ.Value();
+    Store(aJob.Face1, aJob.Face2, aJob.LInt1, aJob.LInt2);
   }
   //---------------------------------------------------------------------
   // etape 2 : Intersections of tubes sharing a vertex without sphere with:
@@ -611,11 +828,23 @@ void BRepOffset_Inter3d::ConnexIntByInt(
     }
   }
   //
+  // pair of faces to be treated for the shape
+  struct InterStep
+  {
+    TopoDS_Shape Shape;    // shape connecting the faces
+    TopoDS_Face  Face1;    // first initial face
+    TopoDS_Face  Face2;    // second initial face
+    TopoDS_Face  NewFace1; // first extended offset face
+    TopoDS_Face  NewFace2; // second extended offset face
+    int          Job;      // index of intersection job, -1 for already intersected faces
+  };
+  NCollection_Vector<InterStep>               aVSteps;
+  NCollection_Vector<BRepOffset_FaceInterJob> aVJobs;
+  //
   aNb = VEmap.Extent();
-  Message_ProgressScope aPSInter(aPSOuter.Next(8), "Intersecting offset faces", aNb);
-  for (i = 1; i <= aNb; ++i, aPSInter.Next())
+  for (i = 1; i <= aNb; ++i)
   {
-    if (!aPSInter.More())
+    if (!aPSOuter.More())
     {
       return;
     }
@@ -709,103 +938,146 @@ void BRepOffset_Inter3d::ConnexIntByInt(
         NF2 = TopoDS::Face(MES(OF2));
       }
       //
+      InterStep& aStep = aVSteps.Appended();
+      aStep.Shape      = aS;
+      aStep.Face1      = F1;
+      aStep.Face2      = F2;
+      aStep.NewFace1   = NF1;
+      aStep.NewFace2   = NF2;
+      aStep.Job        = -1;
+      //
       if (!IsDone(NF1, NF2))
       {
-        NCollection_List<TopoDS_Shape> LInt1, LInt2;
-        BRepOffset_Tool::Inter3D(NF1, NF2, LInt1, LInt2, CurSide, E, F1, F2);
         SetDone(NF1, NF2);
-        if (!LInt1.IsEmpty())
+        BRepOffset_FaceInterJob& aJob = aVJobs.Appended();
+        aJob.Face1                    = NF1;
+        aJob.Face2                    = NF2;
+        aJob.RefEdge                  = E;
+        aJob.RefFace1                 = F1;
+        aJob.RefFace2                 = F2;
+        aJob.Side                     = CurSide;
+        aStep.Job                     = aVJobs.Length() - 1;
+      }
+    }
+  }
+  //
+  // intersect the pairs of extended offset faces
+  Message_ProgressScope aPSInter(aPSOuter.Next(8), "Intersecting offset faces", aVJobs.Length());
+  for (NCollection_Vector<BRepOffset_FaceInterJob>::Iterator aItJ(aVJobs); aItJ.More(); aItJ.Next())
+  {
+    aItJ.ChangeValue().Range = aPSInter.Next();
+  }
+  if (!PerformJobs(aVJobs, myRunParallel, aPSInter))
+  {
+    return;
+  }
+  //
+  // treat the results of intersection in the order of shapes
+  for (NCollection_Vector<InterStep>::Iterator aItS(aVSteps); aItS.More(); aItS.Next())
+  {
+    const InterStep&    aStep = aItS.Value();
+    const TopoDS_Shape& aS    = aStep.Shape;
+    F1                        = aStep.Face1;
+    F2                        = aStep.Face2;
+    NF1                       = aStep.NewFace1;
+    NF2                       = aStep.NewFace2;
+    //
+    if (aStep.Job >= 0)
+    {
+      const BRepOffset_FaceInterJob&        aJob  = aVJobs(aStep.Job);
+      const NCollection_List<TopoDS_Shape>& LInt1 = aJob.LInt1;
+      const NCollection_List<TopoDS_Shape>& LInt2 = aJob.LInt2;
+      if (!LInt1.IsEmpty())
+      {
+        Store(NF1, NF2, LInt1, LInt2);
+        //
+        TopoDS_Compound C;
+        B.MakeCompound(C);
+        //
+        if (Build.IsBound(aS))
         {
-          Store(NF1, NF2, LInt1, LInt2);
-          //
-          TopoDS_Compound C;
-          B.MakeCompound(C);
-          //
-          if (Build.IsBound(aS))
-          {
-            const TopoDS_Shape& aSE = Build(aS);
-            TopExp_Explorer     aExp(aSE, TopAbs_EDGE);
-            for (; aExp.More(); aExp.Next())
-            {
-              const TopoDS_Shape& aNE = aExp.Current();
-              B.Add(C, aNE);
-            }
-          }
-          //
-          it.Initialize(LInt1);
-          for (; it.More(); it.Next())
+          const TopoDS_Shape& aSE = Build(aS);
+          TopExp_Explorer     aExp(aSE, TopAbs_EDGE);
+          for (; aExp.More(); aExp.Next())
           {
-            const TopoDS_Shape& aNE = it.Value();
+            const TopoDS_Shape& aNE = aExp.Current();
             B.Add(C, aNE);
-            //
-            // keep connection from new edge to shape from which it was created
-            NCollection_List<TopoDS_Shape>* pLS =
-              &aDMIntE(aDMIntE.Add(aNE, NCollection_List<TopoDS_Shape>()));
-            pLS->Append(aS);
-            // keep connection to faces created the edge as well
-            NCollection_List<TopoDS_Shape>* pLFF =
-              aDMIntFF.Bound(aNE, NCollection_List<TopoDS_Shape>());
-            pLFF->Append(F1);
-            pLFF->Append(F2);
           }
-          //
-          Build.Bind(aS, C);
         }
-        else
+        //
+        it.Initialize(LInt1);
+        for (; it.More(); it.Next())
         {
-          Failed.Append(aS);
+          const TopoDS_Shape& aNE = it.Value();
+          B.Add(C, aNE);
+          //
+          // keep connection from new edge to shape from which it was created
+          NCollection_List<TopoDS_Shape>* pLS =
+            &aDMIntE(aDMIntE.Add(aNE, NCollection_List<TopoDS_Shape>()));
+          pLS->Append(aS);
+          // keep connection to faces created the edge as well
+          NCollection_List<TopoDS_Shape>* pLFF =
+            aDMIntFF.Bound(aNE, NCollection_List<TopoDS_Shape>());
+          pLFF->Append(F1);
+          pLFF->Append(F2);
         }
+        //
+        Build.Bind(aS, C);
       }
       else
-      { // IsDone(NF1,NF2)
-        //  Modified by skv - Fri Dec 26 12:20:13 2003 OCC4455 Begin
-        const NCollection_List<TopoDS_Shape>& aLInt1 = myAsDes->Descendant(NF1);
-        const NCollection_List<TopoDS_Shape>& aLInt2 = myAsDes->Descendant(NF2);
+      {
+        Failed.Append(aS);
+      }
+    }
+    else
+    { // IsDone(NF1,NF2)
+      //  Modified by skv - Fri Dec 26 12:20:13 2003 OCC4455 Begin
+      const NCollection_List<TopoDS_Shape>& aLInt1 = myAsDes->Descendant(NF1);
+      const NCollection_List<TopoDS_Shape>& aLInt2 = myAsDes->Descendant(NF2);
 
-        if (!aLInt1.IsEmpty())
+      if (!aLInt1.IsEmpty())
+      {
+        TopoDS_Compound C;
+        B.MakeCompound(C);
+        //
+        if (Build.IsBound(aS))
         {
-          TopoDS_Compound C;
-          B.MakeCompound(C);
-          //
-          if (Build.IsBound(aS))
+          const TopoDS_Shape& aSE = Build(aS);
+          TopExp_Explorer     aExp(aSE, TopAbs_EDGE);
+          for (; aExp.More(); aExp.Next())
           {
-            const TopoDS_Shape& aSE = Build(aS);
-            TopExp_Explorer     aExp(aSE, TopAbs_EDGE);
-            for (; aExp.More(); aExp.Next())
-            {
-              const TopoDS_Shape& aNE = aExp.Current();
-              B.Add(C, aNE);
-            }
+            const TopoDS_Shape& aNE = aExp.Current();
+            B.Add(C, aNE);
           }
+        }
+        //
+        for (it.Initialize(aLInt1); it.More(); it.Next())
+        {
+          const TopoDS_Shape& anE1 = it.Value();
           //
-          for (it.Initialize(aLInt1); it.More(); it.Next())
+          for (it1.Initialize(aLInt2); it1.More(); it1.Next())
           {
-            const TopoDS_Shape& anE1 = it.Value();
-            //
-            for (it1.Initialize(aLInt2); it1.More(); it1.Next())
+            const TopoDS_Shape& anE2 = it1.Value();
+            if (anE1.IsSame(anE2))
             {
-              const TopoDS_Shape& anE2 = it1.Value();
-              if (anE1.IsSame(anE2))
+              B.Add(C, anE1);
+              //
+              NCollection_List<TopoDS_Shape>* pLS = aDMIntE.ChangeSeek(anE1);
+              if (pLS)
               {
-                B.Add(C, anE1);
-                //
-                NCollection_List<TopoDS_Shape>* pLS = aDMIntE.ChangeSeek(anE1);
-                if (pLS)
-                {
-                  pLS->Append(aS);
-                }
+                pLS->Append(aS);
               }
             }
           }
-          Build.Bind(aS, C);
-        }
-        else
-        {
-          Failed.Append(aS);
         }
+        Build.Bind(aS, C);
+      }
+      else
+      {
+        Failed.Append(aS);
       }
+      //  Modified by skv - Fri Dec 26 12:20:14 2003 OCC4455 End
     }
-    //  Modified by skv - Fri Dec 26 12:20:14 2003 OCC4455 End
   }
   //
   // create unique intersection for each localized shared part
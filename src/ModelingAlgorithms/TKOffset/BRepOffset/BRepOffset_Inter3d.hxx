@@ -117,7 +117,28 @@ public:
   //! Returns new edges
   NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher>& NewEdges() { return myNewEdges; }
 
+  //! Sets the flag of parallel intersection of the pairs of faces in CompletInt(),
+  //! ConnexIntByArc() and ConnexIntByInt(). The pairs of faces sharing sub-shapes
+  //! are intersected in the order of sequential treatment, and the results are
+  //! stored in that order, so that the result does not depend on the flag.
+  void SetRunParallel(const bool theIsParallel) { myRunParallel = theIsParallel; }
+
+  //! Returns the flag of parallel processing.
+  bool RunParallel() const { return myRunParallel; }
+
 private:
+  //! Defines the intersection of the pair of faces to be performed by FaceInter().
+  //! Returns false if the pair is not to be treated at all, otherwise
+  //! <theToIntersect> defines if the faces have to be intersected, and
+  //! <theIsPipes> defines if the faces are the tubes to be intersected by
+  //! BRepOffset_Tool::PipeInter().
+  Standard_EXPORT bool FaceInterType(const TopoDS_Face&    F1,
+                                     const TopoDS_Face&    F2,
+                                     const BRepAlgo_Image& InitOffsetFace,
+                                     bool&                 theToIntersect,
+                                     bool&                 theIsPipes) const;
+
+
   //! Stores the intersection results into AsDes
   Standard_EXPORT void Store(const TopoDS_Face&                    F1,
                              const TopoDS_Face&                    F2,
@@ -131,5 +152,6 @@ private:
   NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> myNewEdges;
   TopAbs_State                                                  mySide;
   double                                                        myTol;
+  bool                                                          myRunParallel;
 };
 #endif // _BRepOffset_Inter3d_HeaderFile
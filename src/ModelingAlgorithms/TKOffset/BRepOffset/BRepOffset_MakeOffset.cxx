@@ -95,7 +95,9 @@
 #include <NCollection_IncAllocator.hxx>
 //
 #include <BOPAlgo_MakerVolume.hxx>
+#include <BOPAlgo_Options.hxx>
 #include <BOPTools_AlgoTools.hxx>
+#include <BOPTools_Parallel.hxx>
 
 #include <cstdio>
 // POP for NT
@@ -615,6 +617,7 @@ static void FillContours(
 //=================================================================================================
 
 BRepOffset_MakeOffset::BRepOffset_MakeOffset()
+    : myRunParallel(BOPAlgo_Options::GetParallelMode())
 {
   myAsDes = new BRepAlgo_AsDes();
 }
@@ -641,6 +644,7 @@ BRepOffset_MakeOffset::BRepOffset_MakeOffset(const TopoDS_Shape&          S,
       myJoin(Join),
       myThickening(Thickening),
       myRemoveIntEdges(RemoveIntEdges),
+      myRunParallel(BOPAlgo_Options::GetParallelMode()),
       myDone(false)
 {
   myAsDes                  = new BRepAlgo_AsDes();
@@ -946,6 +950,7 @@ void BRepOffset_MakeOffset::MakeOffsetShape(const Message_ProgressRange& theRang
                                            : "Connect offset faces by intersection");
 
   BRepOffset_Inter3d Inter(myAsDes, Side, myTol);
+  Inter.SetRunParallel(myRunParallel);
   Intersection3D(Inter, aPSInter.Next(90));
   if (myError != BRepOffset_NoError)
   {
@@ -1203,6 +1208,72 @@ const TopoDS_Shape& BRepOffset_MakeOffset::Shape() const
 
 //=================================================================================================
 
+//! Construction of the offset face not sharing the offset shapes with other
+//! offset faces, used for the parallel treatment of the faces.
+class BRepOffset_OffsetFaceJob
+{
+public:
+  DEFINE_STANDARD_ALLOC
+
+  BRepOffset_OffsetFaceJob()
+      : Offset(0.0),
+        OffsetOutside(true),
+        JoinType(GeomAbs_Arc)
+  {
+  }
+
+  void Perform()
+  {
+    Message_ProgressScope aPS(Range, nullptr, 1);
+    if (!aPS.More())
+    {
+      return;
+    }
+    Result.Init(Face, Offset, OffsetOutside, JoinType);
+  }
+
+public:
+  TopoDS_Face           Face;
+  double                Offset;
+  bool                  OffsetOutside;
+  GeomAbs_JoinType      JoinType;
+  Message_ProgressRange Range;
+  BRepOffset_Offset     Result;
+};
+
+//=======================================================================
+// function : HasTangentialConnection
+// purpose  : Checks if the face contains the tangential edges or the vertices
+//            of tangential edges, the offset shapes of which are shared
+//            between the offset faces
+//=======================================================================
+static bool HasTangentialConnection(const TopoDS_Face&        theFace,
+                                    const BRepOffset_Analyse& theAnalyse)
+{
+  NCollection_List<TopoDS_Shape> aLE;
+  theAnalyse.Edges(theFace, ChFiDS_Tangential, aLE);
+  if (!aLE.IsEmpty())
+  {
+    return true;
+  }
+  for (TopExp_Explorer aExpV(theFace, TopAbs_VERTEX); aExpV.More(); aExpV.Next())
+  {
+    const TopoDS_Vertex& aV = TopoDS::Vertex(aExpV.Current());
+    if (!theAnalyse.HasAncestor(aV))
+    {
+      continue;
+    }
+    theAnalyse.Edges(aV, ChFiDS_Tangential, aLE);
+    if (!aLE.IsEmpty())
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+//=================================================================================================
+
 void BRepOffset_MakeOffset::MakeOffsetFaces(
   NCollection_DataMap<TopoDS_Shape, BRepOffset_Offset, TopTools_ShapeMapHasher>& theMapSF,
   const Message_ProgressRange&                                                   theRange)
@@ -1217,8 +1288,30 @@ void BRepOffset_MakeOffset::MakeOffsetFaces(
   BRepLib::SortFaces(myFaceComp, aLF);
   //
   Message_ProgressScope aPS(theRange, "Making offset faces", aLF.Size());
-  aItLF.Initialize(aLF);
-  for (; aItLF.More(); aItLF.Next(), aPS.Next())
+  //
+  // The faces not connected to the others by tangential edges neither use nor
+  // share the offset shapes of other faces, thus they are offset independently
+  NCollection_Vector<BRepOffset_OffsetFaceJob>                    aVJobs;
+  NCollection_DataMap<TopoDS_Shape, int, TopTools_ShapeMapHasher> aMFJob;
+  for (aItLF.Initialize(aLF); aItLF.More(); aItLF.Next())
+  {
+    const TopoDS_Face& aF = TopoDS::Face(aItLF.Value());
+    if (HasTangentialConnection(aF, myAnalyse))
+    {
+      continue;
+    }
+    BRepOffset_OffsetFaceJob& aJob = aVJobs.Appended();
+    aJob.Face                      = aF;
+    aJob.Offset                    = myFaceOffset.IsBound(aF) ? myFaceOffset(aF) : myOffset;
+    aJob.OffsetOutside             = OffsetOutside;
+    aJob.JoinType                  = myJoin;
+    aJob.Range                     = aPS.Next();
+    aMFJob.Bind(aF, aVJobs.Length() - 1);
+  }
+  BOPTools_Parallel::Perform(myRunParallel, aVJobs);
+  //
+  // Keep the order of faces of the sequential treatment
+  for (aItLF.Initialize(aLF); aItLF.More(); aItLF.Next())
   {
     if (!aPS.More())
     {
@@ -1226,7 +1319,12 @@ void BRepOffset_MakeOffset::MakeOffsetFaces(
       return;
     }
     const TopoDS_Face& aF = TopoDS::Face(aItLF.Value());
-    aCurOffset            = myFaceOffset.IsBound(aF) ? myFaceOffset(aF) : myOffset;
+    if (const int* aJobIndex = aMFJob.Seek(aF))
+    {
+      theMapSF.Bind(aF, aVJobs(*aJobIndex).Result);
+      continue;
+    }
+    aCurOffset = myFaceOffset.IsBound(aF) ? myFaceOffset(aF) : myOffset;
     BRepOffset_Offset              OF(aF, aCurOffset, ShapeTgt, OffsetOutside, myJoin);
     NCollection_List<TopoDS_Shape> Let;
     myAnalyse.Edges(aF, ChFiDS_Tangential, Let);
@@ -1261,6 +1359,7 @@ void BRepOffset_MakeOffset::MakeOffsetFaces(
       }
     }
     theMapSF.Bind(aF, OF);
+    aPS.Next();
   }
   //
   const NCollection_List<TopoDS_Shape>& aNewFaces = myAnalyse.NewFaces();
@@ -1356,6 +1455,7 @@ void BRepOffset_MakeOffset::BuildOffsetByInter(const Message_ProgressRange& theR
     ExtentContext = true;
 
   BRepOffset_Inter3d Inter3(AsDes, Side, myTol);
+  Inter3.SetRunParallel(myRunParallel);
   // Intersection between parallel faces
   Inter3.ConnexIntByInt(myFaceComp,
                         MapSF,
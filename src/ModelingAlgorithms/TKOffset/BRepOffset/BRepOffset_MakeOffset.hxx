@@ -76,6 +76,15 @@ public:
   //! Changes the flag allowing the linearization
   Standard_EXPORT void AllowLinearization(const bool theIsAllowed);
 
+  //! Sets the flag of parallel construction of the offset faces and of parallel
+  //! intersection of their pairs. The result does not depend on the flag.
+  //! By default the global parallel mode of Boolean Component is used
+  //! (see BOPAlgo_Options::GetParallelMode()).
+  void SetRunParallel(const bool theIsParallel) { myRunParallel = theIsParallel; }
+
+  //! Returns the flag of parallel processing.
+  bool RunParallel() const { return myRunParallel; }
+
   //! Add Closing Faces, <F> has to be in the initial
   //! shape S.
   Standard_EXPORT void AddFace(const TopoDS_Face& F);
@@ -258,6 +267,7 @@ private:
   GeomAbs_JoinType                                                   myJoin;
   bool                                                               myThickening;
   bool                                                               myRemoveIntEdges;
+  bool                                                               myRunParallel;
   NCollection_DataMap<TopoDS_Shape, double, TopTools_ShapeMapHasher> myFaceOffset;
   NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher>      myFaces;
   NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher>      myOriginalFaces;
@@ -114,6 +114,13 @@ public:
     const bool                   RemoveIntEdges = false,
     const Message_ProgressRange& theRange       = Message_ProgressRange());
 
+  //! Sets the flag of parallel processing of the offset faces and of their intersections
+  //! for the PerformByJoin() algorithm (see BRepOffset_MakeOffset::SetRunParallel()).
+  void SetRunParallel(const bool theIsParallel) { myOffsetShape.SetRunParallel(theIsParallel); }
+
+  //! Returns the flag of parallel processing.
+  bool RunParallel() const { return myOffsetShape.RunParallel(); }
+
   //! Returns instance of the underlying intersection / arc algorithm.
   Standard_EXPORT virtual const BRepOffset_MakeOffset& MakeOffset() const;
 
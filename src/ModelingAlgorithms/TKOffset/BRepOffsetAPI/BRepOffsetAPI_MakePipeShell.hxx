@@ -285,6 +285,13 @@ public:
   //! If True, the pipe shell stores the history of the sections and the spine.
   inline bool IsBuildHistory() const { return myPipe->IsBuildHistory(); }
 
+  //! Sets the flag to compute the swept faces along the edges of the spine in parallel threads.
+  //! Has effect for the modes without auxiliary spine and without evolution law.
+  inline void SetRunParallel(const bool theIsParallel) { myPipe->SetRunParallel(theIsParallel); }
+
+  //! Returns the flag to compute the swept faces in parallel threads.
+  inline bool RunParallel() const { return myPipe->RunParallel(); }
+
   //! Returns the list of original profiles
   void Profiles(NCollection_List<TopoDS_Shape>& theProfiles) { myPipe->Profiles(theProfiles); }
 
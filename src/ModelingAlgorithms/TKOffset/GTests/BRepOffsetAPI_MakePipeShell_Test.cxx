@@ -0,0 +1,108 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <gtest/gtest.h>
+
+#include <BRepBuilderAPI_MakeEdge.hxx>
+#include <BRepBuilderAPI_MakeWire.hxx>
+#include <BRepCheck_Analyzer.hxx>
+#include <BRepGProp.hxx>
+#include <BRepOffsetAPI_MakePipeShell.hxx>
+#include <Geom_BSplineCurve.hxx>
+#include <GeomAPI_PointsToBSpline.hxx>
+#include <GProp_GProps.hxx>
+#include <gp_Ax2.hxx>
+#include <gp_Circ.hxx>
+#include <NCollection_Array1.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS_Wire.hxx>
+
+#include <cmath>
+
+namespace
+{
+//! Makes the spine of several B-spline edges along a winding 3D curve.
+TopoDS_Wire makeSpine(const int theNbEdges, occ::handle<Geom_BSplineCurve>& theCurve)
+{
+  NCollection_Array1<gp_Pnt> aPnts(1, 4 * theNbEdges + 1);
+  for (int anIndex = aPnts.Lower(); anIndex <= aPnts.Upper(); ++anIndex)
+  {
+    const double aT = 0.5 * (anIndex - 1);
+    aPnts(anIndex)  = gp_Pnt(10.0 * aT, 5.0 * std::sin(aT), 3.0 * std::cos(0.7 * aT));
+  }
+  theCurve = GeomAPI_PointsToBSpline(aPnts).Curve();
+
+  BRepBuilderAPI_MakeWire aWireMaker;
+  const double            aFirst = theCurve->FirstParameter();
+  const double            aStep  = (theCurve->LastParameter() - aFirst) / theNbEdges;
+  for (int anEdge = 0; anEdge < theNbEdges; ++anEdge)
+  {
+    aWireMaker.Add(
+      BRepBuilderAPI_MakeEdge(theCurve, aFirst + anEdge * aStep, aFirst + (anEdge + 1) * aStep)
+        .Edge());
+  }
+  return aWireMaker.Wire();
+}
+
+//! Sweeps the circle of the given radius along the spine.
+TopoDS_Shape makePipe(const TopoDS_Wire&                    theSpine,
+                      const occ::handle<Geom_BSplineCurve>& theCurve,
+                      const bool                            theIsParallel)
+{
+  gp_Pnt aStart;
+  gp_Vec aTangent;
+  theCurve->D1(theCurve->FirstParameter(), aStart, aTangent);
+  const TopoDS_Wire aProfile =
+    BRepBuilderAPI_MakeWire(BRepBuilderAPI_MakeEdge(gp_Circ(gp_Ax2(aStart, aTangent), 1.0)).Edge())
+      .Wire();
+
+  BRepOffsetAPI_MakePipeShell aPipe(theSpine);
+  aPipe.SetRunParallel(theIsParallel);
+  EXPECT_EQ(theIsParallel, aPipe.RunParallel());
+  aPipe.Add(aProfile);
+  aPipe.Build();
+  EXPECT_TRUE(aPipe.IsDone());
+  return aPipe.IsDone() ? aPipe.Shape() : TopoDS_Shape();
+}
+} // namespace
+
+TEST(BRepOffsetAPI_MakePipeShellTest, ParallelSweepMatchesSequential)
+{
+  occ::handle<Geom_BSplineCurve> aCurve;
+  const TopoDS_Wire              aSpine = makeSpine(6, aCurve);
+
+  const TopoDS_Shape aSeqPipe = makePipe(aSpine, aCurve, false);
+  const TopoDS_Shape aParPipe = makePipe(aSpine, aCurve, true);
+  ASSERT_FALSE(aSeqPipe.IsNull());
+  ASSERT_FALSE(aParPipe.IsNull());
+  EXPECT_TRUE(BRepCheck_Analyzer(aParPipe).IsValid());
+
+  int aNbSeqFaces = 0, aNbParFaces = 0;
+  for (TopExp_Explorer anExp(aSeqPipe, TopAbs_FACE); anExp.More(); anExp.Next())
+  {
+    ++aNbSeqFaces;
+  }
+  for (TopExp_Explorer anExp(aParPipe, TopAbs_FACE); anExp.More(); anExp.Next())
+  {
+    ++aNbParFaces;
+  }
+  EXPECT_EQ(6, aNbSeqFaces);
+  EXPECT_EQ(aNbSeqFaces, aNbParFaces);
+
+  GProp_GProps aSeqProps, aParProps;
+  BRepGProp::SurfaceProperties(aSeqPipe, aSeqProps);
+  BRepGProp::SurfaceProperties(aParPipe, aParProps);
+  EXPECT_GT(aSeqProps.Mass(), 0.0);
+  EXPECT_NEAR(aSeqProps.Mass(), aParProps.Mass(), 1.0e-9 * aSeqProps.Mass());
+}
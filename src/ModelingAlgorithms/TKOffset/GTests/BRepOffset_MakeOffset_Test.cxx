@@ -13,6 +13,7 @@
 
 #include <gtest/gtest.h>
 
+#include <BRepOffsetAPI_MakeOffsetShape.hxx>
 #include <BRepOffsetAPI_MakeThickSolid.hxx>
 #include <BRepOffsetAPI_ThruSections.hxx>
 #include <BRepOffset_MakeOffset.hxx>
@@ -24,6 +25,7 @@
 #include <BRepPrimAPI_MakeCylinder.hxx>
 #include <BRepPrimAPI_MakeSphere.hxx>
 #include <BRepCheck_Analyzer.hxx>
+#include <BRepGProp.hxx>
 #include <BRepAlgoAPI_Fuse.hxx>
 #include <Geom_Circle.hxx>
 #include <Geom_Ellipse.hxx>
@@ -34,10 +36,12 @@
 #include <gp_Circ.hxx>
 #include <gp_Elips.hxx>
 #include <gp_Pnt.hxx>
+#include <GProp_GProps.hxx>
 #include <NCollection_Array1.hxx>
 #include <TopoDS.hxx>
 #include <TopoDS_Shape.hxx>
 #include <TopoDS_Wire.hxx>
+#include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
 #include <NCollection_List.hxx>
 
@@ -1027,3 +1031,118 @@ TEST(BRepOffset_MakeOffsetTest, ThickSolid_CircleToOctagonLoft)
   // Octagon is closer to a circle, corners are less sharp
   EXPECT_TRUE(aThickMaker.IsDone()) << "ThickSolid on circle-to-octagon loft failed.";
 }
+
+//==================================================================================================
+// Helper function to check that the parallel and sequential offset results are identical
+//==================================================================================================
+
+static void CompareOffsetResults(const TopoDS_Shape& theSerial, const TopoDS_Shape& theParallel)
+{
+  ASSERT_FALSE(theSerial.IsNull());
+  ASSERT_FALSE(theParallel.IsNull());
+  for (TopAbs_ShapeEnum aType : {TopAbs_FACE, TopAbs_EDGE, TopAbs_VERTEX})
+  {
+    NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> aMSerial, aMParallel;
+    TopExp::MapShapes(theSerial, aType, aMSerial);
+    TopExp::MapShapes(theParallel, aType, aMParallel);
+    EXPECT_EQ(aMSerial.Extent(), aMParallel.Extent()) << "Different number of shapes of type "
+                                                      << aType;
+  }
+
+  GProp_GProps aPropsSerial, aPropsParallel;
+  BRepGProp::VolumeProperties(theSerial, aPropsSerial);
+  BRepGProp::VolumeProperties(theParallel, aPropsParallel);
+  EXPECT_NEAR(aPropsSerial.Mass(), aPropsParallel.Mass(), 1.0e-9 * std::abs(aPropsSerial.Mass()));
+}
+
+//==================================================================================================
+// Test: Parallel offset of the box with arc joints gives the same result as sequential one
+//==================================================================================================
+
+TEST(BRepOffset_MakeOffsetTest, OffsetShape_Box_Arc_ParallelMatchesSerial)
+{
+  TopoDS_Shape aBox = BRepPrimAPI_MakeBox(10.0, 20.0, 30.0).Shape();
+
+  TopoDS_Shape aResults[2];
+  for (int i = 0; i < 2; ++i)
+  {
+    BRepOffsetAPI_MakeOffsetShape anOffsetMaker;
+    anOffsetMaker.SetRunParallel(i == 1);
+    EXPECT_EQ(i == 1, anOffsetMaker.RunParallel());
+    anOffsetMaker.PerformByJoin(aBox, 2.0, 1.0e-7, BRepOffset_Skin, false, false, GeomAbs_Arc);
+    ASSERT_TRUE(anOffsetMaker.IsDone()) << "Offset failed, parallel mode: " << i;
+    aResults[i] = anOffsetMaker.Shape();
+  }
+  CompareOffsetResults(aResults[0], aResults[1]);
+
+  // 6 offset faces, 12 tubes and 8 spheres
+  NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> aMF;
+  TopExp::MapShapes(aResults[1], TopAbs_FACE, aMF);
+  EXPECT_EQ(26, aMF.Extent());
+}
+
+//==================================================================================================
+// Test: Parallel offset with complete intersection gives the same result as sequential one
+//==================================================================================================
+
+TEST(BRepOffset_MakeOffsetTest, OffsetShape_Box_CompleteInter_ParallelMatchesSerial)
+{
+  TopoDS_Shape aBox = BRepPrimAPI_MakeBox(10.0, 20.0, 30.0).Shape();
+
+  TopoDS_Shape aResults[2];
+  for (int i = 0; i < 2; ++i)
+  {
+    BRepOffsetAPI_MakeOffsetShape anOffsetMaker;
+    anOffsetMaker.SetRunParallel(i == 1);
+    anOffsetMaker.PerformByJoin(aBox, 2.0, 1.0e-7, BRepOffset_Skin, true, false, GeomAbs_Arc);
+    ASSERT_TRUE(anOffsetMaker.IsDone()) << "Offset failed, parallel mode: " << i;
+    aResults[i] = anOffsetMaker.Shape();
+  }
+  CompareOffsetResults(aResults[0], aResults[1]);
+}
+
+//==================================================================================================
+// Test: Parallel thick solid with intersection joints gives the same result as sequential one
+//==================================================================================================
+
+TEST(BRepOffset_MakeOffsetTest, ThickSolid_FusedBoxCylinder_ParallelMatchesSerial)
+{
+  TopoDS_Shape aBox      = BRepPrimAPI_MakeBox(gp_Pnt(-20, -20, 0), 40.0, 40.0, 20.0).Shape();
+  TopoDS_Shape aCylinder = BRepPrimAPI_MakeCylinder(gp_Ax2(gp_Pnt(0, 0, 20), gp::DZ()), 10.0, 30.0);
+  BRepAlgoAPI_Fuse aFuse(aBox, aCylinder);
+  ASSERT_TRUE(aFuse.IsDone());
+
+  // remove the top face of the cylinder
+  NCollection_List<TopoDS_Shape> aFacesToRemove;
+  for (TopExp_Explorer anExp(aFuse.Shape(), TopAbs_FACE); anExp.More(); anExp.Next())
+  {
+    GProp_GProps aProps;
+    BRepGProp::SurfaceProperties(anExp.Current(), aProps);
+    if (std::abs(aProps.CentreOfMass().Z() - 50.0) < 1.0e-7)
+    {
+      aFacesToRemove.Append(anExp.Current());
+    }
+  }
+  ASSERT_EQ(1, aFacesToRemove.Extent());
+
+  TopoDS_Shape aResults[2];
+  for (int i = 0; i < 2; ++i)
+  {
+    BRepOffsetAPI_MakeThickSolid aThickMaker;
+    aThickMaker.SetRunParallel(i == 1);
+    aThickMaker.MakeThickSolidByJoin(aFuse.Shape(),
+                                     aFacesToRemove,
+                                     -1.0,
+                                     1.0e-3,
+                                     BRepOffset_Skin,
+                                     false,
+                                     false,
+                                     GeomAbs_Intersection);
+    ASSERT_TRUE(aThickMaker.IsDone()) << "ThickSolid failed, parallel mode: " << i;
+    aResults[i] = aThickMaker.Shape();
+  }
+  CompareOffsetResults(aResults[0], aResults[1]);
+
+  BRepCheck_Analyzer aChecker(aResults[1]);
+  EXPECT_TRUE(aChecker.IsValid());
+}
@@ -2,5 +2,6 @@
 set(OCCT_TKOffset_GTests_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
 
 set(OCCT_TKOffset_GTests_FILES
+  BRepOffsetAPI_MakePipeShell_Test.cxx
   BRepOffset_MakeOffset_Test.cxx
 )
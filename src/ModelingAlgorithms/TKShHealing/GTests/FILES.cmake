@@ -4,5 +4,6 @@ set(OCCT_TKShHealing_GTests_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
 set(OCCT_TKShHealing_GTests_FILES
   ShapeAnalysis_CanonicalRecognition_Test.cxx
   ShapeConstruct_ProjectCurveOnSurface_Test.cxx
+  ShapeFix_Shell_Test.cxx
   ShapeUpgrade_UnifySameDomain_Test.cxx
 )
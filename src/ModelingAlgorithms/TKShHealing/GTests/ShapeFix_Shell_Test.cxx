@@ -0,0 +1,133 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <gtest/gtest.h>
+
+#include <BRep_Builder.hxx>
+#include <BRepBuilderAPI_MakeEdge.hxx>
+#include <BRepBuilderAPI_MakeVertex.hxx>
+#include <BRepCheck_Analyzer.hxx>
+#include <Geom_Plane.hxx>
+#include <gp_Pln.hxx>
+#include <gp_Pnt.hxx>
+#include <NCollection_Array2.hxx>
+#include <NCollection_IndexedMap.hxx>
+#include <Precision.hxx>
+#include <ShapeFix_Shell.hxx>
+#include <TopExp.hxx>
+#include <TopTools_ShapeMapHasher.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Edge.hxx>
+#include <TopoDS_Face.hxx>
+#include <TopoDS_Shell.hxx>
+#include <TopoDS_Vertex.hxx>
+#include <TopoDS_Wire.hxx>
+
+namespace
+{
+//! Builds the shell of theNb x theNb unit square faces lying in XOY plane and sharing
+//! the edges and vertices. The wires of the faces are added with wrong orientation,
+//! so that each face requires fixing.
+TopoDS_Shell makeGridWithReversedWires(const int theNb)
+{
+  BRep_Builder                      aB;
+  occ::handle<Geom_Plane>           aPlane = new Geom_Plane(gp_Pln());
+  NCollection_Array2<TopoDS_Vertex> aVerts(0, theNb, 0, theNb);
+  for (int i = 0; i <= theNb; ++i)
+  {
+    for (int j = 0; j <= theNb; ++j)
+    {
+      aVerts(i, j) = BRepBuilderAPI_MakeVertex(gp_Pnt(i, j, 0.)).Vertex();
+    }
+  }
+
+  // Horizontal edges go along X, vertical ones along Y
+  NCollection_Array2<TopoDS_Edge> aHor(0, theNb - 1, 0, theNb);
+  NCollection_Array2<TopoDS_Edge> aVer(0, theNb, 0, theNb - 1);
+  for (int i = 0; i <= theNb; ++i)
+  {
+    for (int j = 0; j <= theNb; ++j)
+    {
+      if (i < theNb)
+      {
+        aHor(i, j) = BRepBuilderAPI_MakeEdge(aVerts(i, j), aVerts(i + 1, j)).Edge();
+      }
+      if (j < theNb)
+      {
+        aVer(i, j) = BRepBuilderAPI_MakeEdge(aVerts(i, j), aVerts(i, j + 1)).Edge();
+      }
+    }
+  }
+
+  TopoDS_Shell aShell;
+  aB.MakeShell(aShell);
+  for (int i = 0; i < theNb; ++i)
+  {
+    for (int j = 0; j < theNb; ++j)
+    {
+      TopoDS_Wire aWire;
+      aB.MakeWire(aWire);
+      aB.Add(aWire, aHor(i, j));
+      aB.Add(aWire, aVer(i + 1, j));
+      aB.Add(aWire, aHor(i, j + 1).Reversed());
+      aB.Add(aWire, aVer(i, j).Reversed());
+      aWire.Closed(true);
+
+      TopoDS_Face aFace;
+      aB.MakeFace(aFace, aPlane, Precision::Confusion());
+      aB.Add(aFace, aWire.Reversed());
+      aB.Add(aShell, aFace);
+    }
+  }
+  return aShell;
+}
+
+//! Fixes the shell in the requested mode and returns the result.
+TopoDS_Shape fixShell(const TopoDS_Shell& theShell, const bool theToRunParallel, bool& theIsDone)
+{
+  occ::handle<ShapeFix_Shell> aFix = new ShapeFix_Shell(theShell);
+  aFix->SetRunParallel(theToRunParallel);
+  aFix->FixOrientationMode() = false;
+  theIsDone                  = aFix->Perform();
+  return aFix->Shape();
+}
+} // namespace
+
+TEST(ShapeFix_ShellTest, ParallelFixOfFacesMatchesSequential)
+{
+  const int          aNb    = 6;
+  const TopoDS_Shell aShell = makeGridWithReversedWires(aNb);
+
+  bool               isDoneSeq = false, isDonePar = false;
+  const TopoDS_Shape aResSeq = fixShell(aShell, false, isDoneSeq);
+  // Rebuild the input, since fixing modifies the shared edges in place
+  const TopoDS_Shape aResPar = fixShell(makeGridWithReversedWires(aNb), true, isDonePar);
+
+  EXPECT_TRUE(isDoneSeq);
+  EXPECT_TRUE(isDonePar);
+  ASSERT_FALSE(aResPar.IsNull());
+  EXPECT_TRUE(BRepCheck_Analyzer(aResSeq).IsValid());
+  EXPECT_TRUE(BRepCheck_Analyzer(aResPar).IsValid());
+
+  NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> aFacesSeq, aFacesPar;
+  NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> aEdgesSeq, aEdgesPar;
+  TopExp::MapShapes(aResSeq, TopAbs_FACE, aFacesSeq);
+  TopExp::MapShapes(aResPar, TopAbs_FACE, aFacesPar);
+  TopExp::MapShapes(aResSeq, TopAbs_EDGE, aEdgesSeq);
+  TopExp::MapShapes(aResPar, TopAbs_EDGE, aEdgesPar);
+  EXPECT_EQ(aFacesPar.Extent(), aNb * aNb);
+  EXPECT_EQ(aFacesPar.Extent(), aFacesSeq.Extent());
+  // The faces must still share their edges
+  EXPECT_EQ(aEdgesPar.Extent(), 2 * aNb * (aNb + 1));
+  EXPECT_EQ(aEdgesPar.Extent(), aEdgesSeq.Extent());
+}
@@ -21,6 +21,7 @@
 #include <BRepBuilderAPI_Sewing.hxx>
 #include <BRepPrimAPI_MakeBox.hxx>
 #include <Geom_Plane.hxx>
+#include <gp.hxx>
 #include <gp_Pln.hxx>
 #include <gp_Pnt.hxx>
 #include <ShapeUpgrade_UnifySameDomain.hxx>
@@ -306,3 +307,58 @@ TEST(ShapeUpgrade_UnifySameDomainTest, BasicBoxUnification)
   }
   EXPECT_EQ(aFaceCount, 6) << "Box should have 6 faces";
 }
+
+// Test unification of a grid of coplanar faces lying on separately created planes
+// in parallel mode. The result should be the same as in sequential mode:
+// one face bounded by four edges.
+TEST(ShapeUpgrade_UnifySameDomainTest, ParallelGridOfCoplanarFaces)
+{
+  const int             aNb = 4;
+  BRepBuilderAPI_Sewing aSewer(1e-6);
+  for (int i = 0; i < aNb; ++i)
+  {
+    for (int j = 0; j < aNb; ++j)
+    {
+      const gp_Pnt aP1(i, j, 0), aP2(i + 1, j, 0), aP3(i + 1, j + 1, 0), aP4(i, j + 1, 0);
+
+      BRepBuilderAPI_MakeWire aMW;
+      aMW.Add(BRepBuilderAPI_MakeEdge(aP1, aP2).Edge());
+      aMW.Add(BRepBuilderAPI_MakeEdge(aP2, aP3).Edge());
+      aMW.Add(BRepBuilderAPI_MakeEdge(aP3, aP4).Edge());
+      aMW.Add(BRepBuilderAPI_MakeEdge(aP4, aP1).Edge());
+      ASSERT_TRUE(aMW.IsDone());
+
+      // each face gets its own plane with own origin
+      BRepBuilderAPI_MakeFace aMF(gp_Pln(aP1, gp::DZ()), aMW.Wire());
+      ASSERT_TRUE(aMF.IsDone());
+      aSewer.Add(aMF.Face());
+    }
+  }
+  aSewer.Perform();
+  const TopoDS_Shape aSewedShape = aSewer.SewedShape();
+  ASSERT_FALSE(aSewedShape.IsNull()) << "Sewing failed";
+
+  for (const bool isParallel : {false, true})
+  {
+    ShapeUpgrade_UnifySameDomain aUnifier(aSewedShape);
+    aUnifier.SetRunParallel(isParallel);
+    aUnifier.Build();
+
+    const TopoDS_Shape& aResult = aUnifier.Shape();
+    ASSERT_FALSE(aResult.IsNull());
+
+    int aFaceCount = 0, anEdgeCount = 0;
+    for (TopExp_Explorer anExp(aResult, TopAbs_FACE); anExp.More(); anExp.Next())
+      aFaceCount++;
+    for (TopExp_Explorer anExp(aResult, TopAbs_EDGE); anExp.More(); anExp.Next())
+      anEdgeCount++;
+
+    EXPECT_EQ(aFaceCount, 1) << "Parallel mode: " << isParallel;
+    EXPECT_EQ(anEdgeCount, 4) << "Parallel mode: " << isParallel;
+
+    // all original faces are merged into the result face
+    const TopoDS_Shape aFirstFace = TopExp_Explorer(aSewedShape, TopAbs_FACE).Current();
+    EXPECT_FALSE(aUnifier.History()->IsRemoved(aFirstFace));
+    EXPECT_EQ(aUnifier.History()->Modified(aFirstFace).Extent(), 1);
+  }
+}
@@ -68,6 +68,16 @@ ShapeFix_Edge::ShapeFix_Edge()
 
 //=================================================================================================
 
+occ::handle<ShapeFix_Edge> ShapeFix_Edge::Copy() const
+{
+  occ::handle<ShapeFix_Edge> aCopy          = new ShapeFix_Edge;
+  aCopy->myContext                          = myContext;
+  aCopy->myProjector->AdjustOverDegenMode() = myProjector->AdjustOverDegenMode();
+  return aCopy;
+}
+
+//=================================================================================================
+
 occ::handle<ShapeConstruct_ProjectCurveOnSurface> ShapeFix_Edge::Projector()
 {
   return myProjector;
@@ -50,6 +50,11 @@ public:
   //! Empty constructor
   Standard_EXPORT ShapeFix_Edge();
 
+  //! Returns the new tool with the same context and mode of the projector,
+  //! not sharing the data with this one.
+  //! Allows to use the copies of the tool concurrently.
+  Standard_EXPORT occ::handle<ShapeFix_Edge> Copy() const;
+
   //! Returns the projector used for recomputing missing pcurves
   //! Can be used for adjusting parameters of projector
   Standard_EXPORT occ::handle<ShapeConstruct_ProjectCurveOnSurface> Projector();
@@ -129,6 +129,19 @@ ShapeFix_Face::ShapeFix_Face(const TopoDS_Face& face)
 
 //=================================================================================================
 
+occ::handle<ShapeFix_Face> ShapeFix_Face::Copy() const
+{
+  occ::handle<ShapeFix_Face> aCopy = new ShapeFix_Face(*this);
+  aCopy->myFixWire                 = myFixWire->Copy();
+  aCopy->mySurf.Nullify();
+  aCopy->myFace.Nullify();
+  aCopy->myResult.Nullify();
+  aCopy->myStatus = 0;
+  return aCopy;
+}
+
+//=================================================================================================
+
 void ShapeFix_Face::ClearModes()
 {
   myFixWireMode              = -1;
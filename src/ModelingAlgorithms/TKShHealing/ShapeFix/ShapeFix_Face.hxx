@@ -58,6 +58,12 @@ public:
   //! Creates a tool and loads a face
   Standard_EXPORT ShapeFix_Face(const TopoDS_Face& face);
 
+  //! Returns the new tool with the same modes, precision, tolerances,
+  //! context and message registrator, with own tools for fixing wires and edges.
+  //! The copy has no loaded face.
+  //! Allows to use the copies of the tool concurrently.
+  Standard_EXPORT occ::handle<ShapeFix_Face> Copy() const;
+
   //! Sets all modes to default
   Standard_EXPORT virtual void ClearModes();
 
@@ -31,6 +31,7 @@
 #include <TopoDS_Iterator.hxx>
 #include <TopoDS_Shape.hxx>
 #include <TopoDS_Wire.hxx>
+#include <OSD_TraceZone.hxx>
 
 IMPLEMENT_STANDARD_RTTIEXT(ShapeFix_Shape, ShapeFix_Root)
 
@@ -82,6 +83,7 @@ void ShapeFix_Shape::Init(const TopoDS_Shape& shape)
 
 bool ShapeFix_Shape::Perform(const Message_ProgressRange& theProgress)
 {
+  OSD_TRACE_ZONE_CATEGORY("ShapeFix_Shape::Perform", "healing");
   int                        savFixSmallAreaWireMode = 0;
   int                        savFixVertexTolMode     = myFixVertexTolMode;
   occ::handle<ShapeFix_Face> fft                     = FixFaceTool();
@@ -126,6 +126,13 @@ public:
   //! after performing all fixes
   int& FixVertexTolMode();
 
+  //! Sets the flag of parallel fixing of faces of shells (see ShapeFix_Shell::SetRunParallel()).
+  //! Default value is false.
+  void SetRunParallel(const bool theIsParallel);
+
+  //! Returns the flag of parallel fixing of faces of shells.
+  bool RunParallel() const;
+
   DEFINE_STANDARD_RTTIEXT(ShapeFix_Shape, ShapeFix_Root)
 
 protected:
@@ -26,8 +26,11 @@
 #include <NCollection_DataMap.hxx>
 #include <NCollection_IncAllocator.hxx>
 #include <NCollection_IndexedMap.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_Parallel.hxx>
 #include <ShapeAnalysis_Shell.hxx>
 #include <ShapeBuild_ReShape.hxx>
+#include <ShapeExtend_BasicMsgRegistrator.hxx>
 #include <ShapeFix_Face.hxx>
 #include <ShapeFix_Shell.hxx>
 #include <Standard_Type.hxx>
@@ -68,6 +71,175 @@ using EdgeFacesMap = std::unordered_map<TopoDS_Edge,
 
 // Default increment for dynamic array of faces per edge
 constexpr int DEFAULT_EDGE_FACES_INCREMENT = 5;
+
+//! Message registrator keeping the messages sent by the tool fixing a face
+//! in a separate thread, to pass them to the actual registrator afterwards.
+class ShapeFix_Shell_MsgRecorder : public ShapeExtend_BasicMsgRegistrator
+{
+public:
+  using ShapeExtend_BasicMsgRegistrator::Send;
+
+  void Send(const occ::handle<Standard_Transient>& theObject,
+            const Message_Msg&                     theMessage,
+            const Message_Gravity                  theGravity) override
+  {
+    myMessages.Append(Record{theObject, TopoDS_Shape(), theMessage, theGravity});
+  }
+
+  void Send(const TopoDS_Shape&   theShape,
+            const Message_Msg&    theMessage,
+            const Message_Gravity theGravity) override
+  {
+    myMessages.Append(Record{nullptr, theShape, theMessage, theGravity});
+  }
+
+  //! Sends the recorded messages to the given registrator in the order of recording.
+  void Replay(const occ::handle<ShapeExtend_BasicMsgRegistrator>& theMsgReg) const
+  {
+    for (NCollection_Sequence<Record>::Iterator anIt(myMessages); anIt.More(); anIt.Next())
+    {
+      const Record& aRec = anIt.Value();
+      if (!aRec.Shape.IsNull())
+        theMsgReg->Send(aRec.Shape, aRec.Message, aRec.Gravity);
+      else
+        theMsgReg->Send(aRec.Object, aRec.Message, aRec.Gravity);
+    }
+  }
+
+private:
+  struct Record
+  {
+    occ::handle<Standard_Transient> Object;
+    TopoDS_Shape                    Shape;
+    Message_Msg                     Message;
+    Message_Gravity                 Gravity;
+  };
+
+  NCollection_Sequence<Record> myMessages;
+};
+
+//! Face to be fixed in a separate thread with its own tool and context.
+struct ShapeFix_Shell_FaceJob
+{
+  int                                     Index = 0;
+  TopoDS_Face                             Face;
+  occ::handle<ShapeFix_Face>              Tool;
+  occ::handle<ShapeBuild_ReShape>         Context;
+  occ::handle<ShapeFix_Shell_MsgRecorder> Messages;
+  Message_ProgressRange                   Range;
+  bool                                    IsDone = false;
+};
+
+//! Collects the sub-shapes of the face which may be modified in place
+//! while fixing it, i.e. the face itself, its edges and vertices.
+//! Locations are dropped, so that the shared TShapes are always detected.
+void collectFaceKeys(const TopoDS_Shape& theFace, NCollection_List<TopoDS_Shape>& theKeys)
+{
+  theKeys.Append(theFace.Located(TopLoc_Location()));
+  for (TopExp_Explorer anExp(theFace, TopAbs_EDGE); anExp.More(); anExp.Next())
+  {
+    theKeys.Append(anExp.Current().Located(TopLoc_Location()));
+  }
+  for (TopExp_Explorer anExp(theFace, TopAbs_VERTEX); anExp.More(); anExp.Next())
+  {
+    theKeys.Append(anExp.Current().Located(TopLoc_Location()));
+  }
+}
+
+//! Fixes the faces of the shell concurrently.
+//! The faces are processed in waves: a wave takes the faces in their order in the shell,
+//! skipping the faces sharing edges or vertices with any preceding face not yet fixed.
+//! Each face of the wave is fixed with a copy of the tool and its own context,
+//! then the recorded modifications and messages are passed to the common context
+//! and registrator in the order of faces, so that the result does not depend
+//! on the scheduling of the threads.
+//! Returns true if at least one face has been fixed.
+bool fixFacesParallel(const TopoDS_Shape&                                 theShell,
+                      const occ::handle<ShapeFix_Face>&                   theFixFace,
+                      const occ::handle<ShapeBuild_ReShape>&              theContext,
+                      const occ::handle<ShapeExtend_BasicMsgRegistrator>& theMsgReg,
+                      Message_ProgressScope&                              thePS)
+{
+  NCollection_Sequence<TopoDS_Shape>          aFaces;
+  NCollection_Sequence<Message_ProgressRange> aRanges;
+  for (TopoDS_Iterator anIter(theShell); anIter.More(); anIter.Next())
+  {
+    aFaces.Append(anIter.Value());
+    aRanges.Append(thePS.Next());
+  }
+
+  NCollection_Array1<bool> aIsFixed(1, aFaces.Length());
+  aIsFixed.Init(false);
+
+  bool isDone  = false;
+  int  aNbLeft = aFaces.Length();
+  while (aNbLeft > 0 && thePS.More())
+  {
+    // Select the faces which can be fixed independently
+    NCollection_Vector<ShapeFix_Shell_FaceJob>             aWave;
+    NCollection_Map<TopoDS_Shape, TopTools_ShapeMapHasher> aBusy;
+    for (int anInd = 1; anInd <= aFaces.Length(); ++anInd)
+    {
+      if (aIsFixed(anInd))
+        continue;
+
+      // Take the face with the modifications made by the previous waves
+      TopoDS_Shape aFace = theContext->Apply(aFaces(anInd));
+      if (aFace.IsNull() || aFace.ShapeType() != TopAbs_FACE)
+        aFace = aFaces(anInd);
+
+      NCollection_List<TopoDS_Shape> aKeys;
+      collectFaceKeys(aFace, aKeys);
+      bool isFree = true;
+      for (NCollection_List<TopoDS_Shape>::Iterator aKIt(aKeys); aKIt.More(); aKIt.Next())
+      {
+        if (!aBusy.Add(aKIt.Value()))
+          isFree = false;
+      }
+      if (!isFree)
+        continue;
+
+      ShapeFix_Shell_FaceJob& aJob         = aWave.Appended();
+      aJob.Index                           = anInd;
+      aJob.Face                            = TopoDS::Face(aFace);
+      aJob.Range                           = aRanges(anInd);
+      aJob.Tool                            = theFixFace->Copy();
+      aJob.Context                         = new ShapeBuild_ReShape;
+      aJob.Context->ModeConsiderLocation() = theContext->ModeConsiderLocation();
+      aJob.Tool->SetContext(aJob.Context);
+      if (!theMsgReg.IsNull())
+      {
+        aJob.Messages = new ShapeFix_Shell_MsgRecorder;
+        aJob.Tool->SetMsgRegistrator(aJob.Messages);
+      }
+    }
+
+    OSD_Parallel::For(
+      0,
+      aWave.Length(),
+      [&aWave](const int theIndex) {
+        ShapeFix_Shell_FaceJob& aJob = aWave.ChangeValue(theIndex);
+        Message_ProgressScope   aPS(aJob.Range, nullptr, 1);
+        aJob.Tool->Init(aJob.Face);
+        aJob.IsDone = aJob.Tool->Perform();
+      },
+      aWave.Length() < 2);
+
+    // Merge the results in the order of faces
+    for (NCollection_Vector<ShapeFix_Shell_FaceJob>::Iterator aJIt(aWave); aJIt.More();
+         aJIt.Next())
+    {
+      const ShapeFix_Shell_FaceJob& aJob = aJIt.Value();
+      theContext->AddRequests(*aJob.Context);
+      if (!aJob.Messages.IsNull())
+        aJob.Messages->Replay(theMsgReg);
+      isDone               = isDone || aJob.IsDone;
+      aIsFixed(aJob.Index) = true;
+      --aNbLeft;
+    }
+  }
+  return isDone;
+}
 } // namespace
 
 //=================================================================================================
@@ -80,6 +252,7 @@ ShapeFix_Shell::ShapeFix_Shell()
   myFixFace            = new ShapeFix_Face;
   myNbShells           = 0;
   myNonManifold        = false;
+  myRunParallel        = false;
 }
 
 //=================================================================================================
@@ -92,6 +265,7 @@ ShapeFix_Shell::ShapeFix_Shell(const TopoDS_Shell& shape)
   myFixFace            = new ShapeFix_Face;
   Init(shape);
   myNonManifold = false;
+  myRunParallel = false;
 }
 
 //=================================================================================================
@@ -122,17 +296,28 @@ bool ShapeFix_Shell::Perform(const Message_ProgressRange& theProgress)
     // Start progress scope (no need to check if progress exists -- it is safe)
     Message_ProgressScope aPS(theProgress, "Fixing face", aNbFaces);
 
-    for (TopoDS_Iterator iter(S); iter.More() && aPS.More(); iter.Next(), aPS.Next())
+    if (myRunParallel && aNbFaces > 1)
     {
-      TopoDS_Shape sh      = iter.Value();
-      TopoDS_Face  tmpFace = TopoDS::Face(sh);
-      myFixFace->Init(tmpFace);
-      if (myFixFace->Perform())
+      if (fixFacesParallel(S, myFixFace, Context(), MsgRegistrator(), aPS))
       {
         status = true;
         myStatus |= ShapeExtend::EncodeStatus(ShapeExtend_DONE1);
       }
     }
+    else
+    {
+      for (TopoDS_Iterator iter(S); iter.More() && aPS.More(); iter.Next(), aPS.Next())
+      {
+        TopoDS_Shape sh      = iter.Value();
+        TopoDS_Face  tmpFace = TopoDS::Face(sh);
+        myFixFace->Init(tmpFace);
+        if (myFixFace->Perform())
+        {
+          status = true;
+          myStatus |= ShapeExtend::EncodeStatus(ShapeExtend_DONE1);
+        }
+      }
+    }
 
     // Halt algorithm in case of user's abort
     if (!aPS.More())
@@ -115,6 +115,17 @@ public:
   //! Sets NonManifold flag
   Standard_EXPORT virtual void SetNonManifoldFlag(const bool isNonManifold);
 
+  //! Sets the flag of parallel fixing of faces.
+  //! In parallel mode the faces not sharing edges and vertices are fixed
+  //! concurrently with the copies of the FixFaceTool, the modifications
+  //! are then merged into the context in the order of faces.
+  //! Fixing of orientation is always performed sequentially.
+  //! Default value is false.
+  void SetRunParallel(const bool theIsParallel);
+
+  //! Returns the flag of parallel fixing of faces.
+  bool RunParallel() const;
+
   DEFINE_STANDARD_RTTIEXT(ShapeFix_Shell, ShapeFix_Root)
 
 protected:
@@ -126,6 +137,7 @@ protected:
   int                        myFixOrientationMode;
   int                        myNbShells;
   bool                       myNonManifold;
+  bool                       myRunParallel;
 };
 
 #include <ShapeFix_Shell.lxx>
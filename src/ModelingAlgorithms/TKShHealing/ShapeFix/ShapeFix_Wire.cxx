@@ -141,6 +141,18 @@ ShapeFix_Wire::ShapeFix_Wire(const TopoDS_Wire& wire, const TopoDS_Face& face, c
 
 //=================================================================================================
 
+occ::handle<ShapeFix_Wire> ShapeFix_Wire::Copy() const
+{
+  occ::handle<ShapeFix_Wire> aCopy = new ShapeFix_Wire(*this);
+  aCopy->myFixEdge                 = myFixEdge->Copy();
+  aCopy->myAnalyzer                = new ShapeAnalysis_Wire;
+  aCopy->myAnalyzer->SetPrecision(myAnalyzer->Precision());
+  aCopy->ClearStatuses();
+  return aCopy;
+}
+
+//=================================================================================================
+
 void ShapeFix_Wire::SetPrecision(const double prec)
 {
   ShapeFix_Root::SetPrecision(prec);
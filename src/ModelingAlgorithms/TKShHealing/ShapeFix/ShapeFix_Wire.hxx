@@ -96,6 +96,12 @@ public:
                                 const TopoDS_Face& face,
                                 const double       prec);
 
+  //! Returns the new tool with the same modes, precision, tolerances
+  //! and context, with own tools for analysis of wires and fixing of edges.
+  //! The copy has no loaded wire and clear statuses.
+  //! Allows to use the copies of the tool concurrently.
+  Standard_EXPORT occ::handle<ShapeFix_Wire> Copy() const;
+
   //! Sets all modes to default
   Standard_EXPORT void ClearModes();
 
@@ -43,11 +43,13 @@
 #include <GeomConvert.hxx>
 #include <GeomConvert_ApproxSurface.hxx>
 #include <GeomConvert_CompCurveToBSplineCurve.hxx>
+#include <GeomHash_SurfaceHasher.hxx>
 #include <GeomLib_IsPlanarSurface.hxx>
 #include <gp_Cylinder.hxx>
 #include <gp_Dir.hxx>
 #include <gp_Lin.hxx>
 #include <IntPatch_ImpImpIntersection.hxx>
+#include <OSD_Parallel.hxx>
 #include <ShapeAnalysis_Edge.hxx>
 #include <ShapeAnalysis_WireOrder.hxx>
 #include <ShapeAnalysis_Surface.hxx>
@@ -61,6 +63,7 @@
 #include <Geom2d_BSplineCurve.hxx>
 #include <NCollection_Array1.hxx>
 #include <NCollection_HArray1.hxx>
+#include <NCollection_Vector.hxx>
 #include <Geom2d_BoundedCurve.hxx>
 #include <NCollection_Sequence.hxx>
 #include <Geom2d_Curve.hxx>
@@ -1430,11 +1433,36 @@ static bool GetNormalToSurface(const TopoDS_Face& theFace,
 
 //=================================================================================================
 
-static bool IsSameDomain(const TopoDS_Face&                                aFace,
-                         const TopoDS_Face&                                aCheckedFace,
-                         const double                                      theLinTol,
-                         const double                                      theAngTol,
-                         ShapeUpgrade_UnifySameDomain::DataMapOfFacePlane& theFacePlaneMap)
+//=======================================================================
+// function : ComputeFaceSurfaceInfo
+// purpose  : Computes the data on the surface of the face used by IsSameDomain,
+//            except the index of the group of coincident surfaces
+//=======================================================================
+
+static void ComputeFaceSurfaceInfo(const TopoDS_Face&                             theFace,
+                                   const double                                   theLinTol,
+                                   ShapeUpgrade_UnifySameDomain::FaceSurfaceInfo& theInfo)
+{
+  theInfo.Surface = ClearRts(BRep_Tool::Surface(theFace));
+  if (theInfo.Surface.IsNull())
+    return;
+
+  // all kinds of surfaces checked, including b-spline and bezier
+  GeomLib_IsPlanarSurface aPlanarityChecker(theInfo.Surface, theLinTol);
+  theInfo.IsPlanar = aPlanarityChecker.IsPlanar();
+  if (theInfo.IsPlanar)
+    theInfo.Plane = aPlanarityChecker.Plan();
+}
+
+//=================================================================================================
+
+static bool IsSameDomain(
+  const TopoDS_Face&                                            aFace,
+  const TopoDS_Face&                                            aCheckedFace,
+  const double                                                  theLinTol,
+  const double                                                  theAngTol,
+  const ShapeUpgrade_UnifySameDomain::DataMapOfFaceSurfaceInfo& theFaceSurfInfo,
+  ShapeUpgrade_UnifySameDomain::DataMapOfFacePlane&             theFacePlaneMap)
 {
   // checking the same handles
   TopLoc_Location           L1, L2;
@@ -1446,11 +1474,24 @@ static bool IsSameDomain(const TopoDS_Face&                                aFace
   if (S1 == S2 && L1 == L2)
     return true;
 
-  S1 = BRep_Tool::Surface(aFace);
-  S2 = BRep_Tool::Surface(aCheckedFace);
+  // take the data computed in advance, if any
+  typedef ShapeUpgrade_UnifySameDomain::FaceSurfaceInfo FaceSurfaceInfo;
+  FaceSurfaceInfo                                       aLocInfo[2];
+  const FaceSurfaceInfo* anInfo1 = theFaceSurfInfo.Seek(aFace);
+  const FaceSurfaceInfo* anInfo2 = theFaceSurfInfo.Seek(aCheckedFace);
+  if (anInfo1 == nullptr)
+  {
+    ComputeFaceSurfaceInfo(aFace, theLinTol, aLocInfo[0]);
+    anInfo1 = &aLocInfo[0];
+  }
+  if (anInfo2 == nullptr)
+  {
+    ComputeFaceSurfaceInfo(aCheckedFace, theLinTol, aLocInfo[1]);
+    anInfo2 = &aLocInfo[1];
+  }
 
-  S1 = ClearRts(S1);
-  S2 = ClearRts(S2);
+  S1 = anInfo1->Surface;
+  S2 = anInfo2->Surface;
 
   // occ::handle<Geom_OffsetSurface> aGOFS1, aGOFS2;
   // aGOFS1 = occ::down_cast<Geom_OffsetSurface>(S1);
@@ -1458,36 +1499,37 @@ static bool IsSameDomain(const TopoDS_Face&                                aFace
   // if (!aGOFS1.IsNull()) S1 = aGOFS1->BasisSurface();
   // if (!aGOFS2.IsNull()) S2 = aGOFS2->BasisSurface();
 
-  // case of two planar surfaces:
-  // all kinds of surfaces checked, including b-spline and bezier
-  GeomLib_IsPlanarSurface aPlanarityChecker1(S1, theLinTol);
-  if (aPlanarityChecker1.IsPlanar())
+  // case of two planar surfaces
+  if (anInfo1->IsPlanar && anInfo2->IsPlanar)
   {
-    GeomLib_IsPlanarSurface aPlanarityChecker2(S2, theLinTol);
-    if (aPlanarityChecker2.IsPlanar())
-    {
-      gp_Pln aPln1 = aPlanarityChecker1.Plan();
-      gp_Pln aPln2 = aPlanarityChecker2.Plan();
+    const gp_Pln& aPln1 = anInfo1->Plane;
+    const gp_Pln& aPln2 = anInfo2->Plane;
 
-      if (aPln1.Position().Direction().IsParallel(aPln2.Position().Direction(), theAngTol)
-          && aPln1.Distance(aPln2) < theLinTol)
-      {
-        occ::handle<Geom_Plane> aPlaneOfFaces;
-        if (theFacePlaneMap.IsBound(aFace))
-          aPlaneOfFaces = theFacePlaneMap(aFace);
-        else if (theFacePlaneMap.IsBound(aCheckedFace))
-          aPlaneOfFaces = theFacePlaneMap(aCheckedFace);
-        else
-          aPlaneOfFaces = new Geom_Plane(aPln1);
+    if (aPln1.Position().Direction().IsParallel(aPln2.Position().Direction(), theAngTol)
+        && aPln1.Distance(aPln2) < theLinTol)
+    {
+      occ::handle<Geom_Plane> aPlaneOfFaces;
+      if (theFacePlaneMap.IsBound(aFace))
+        aPlaneOfFaces = theFacePlaneMap(aFace);
+      else if (theFacePlaneMap.IsBound(aCheckedFace))
+        aPlaneOfFaces = theFacePlaneMap(aCheckedFace);
+      else
+        aPlaneOfFaces = new Geom_Plane(aPln1);
 
-        theFacePlaneMap.Bind(aFace, aPlaneOfFaces);
-        theFacePlaneMap.Bind(aCheckedFace, aPlaneOfFaces);
+      theFacePlaneMap.Bind(aFace, aPlaneOfFaces);
+      theFacePlaneMap.Bind(aCheckedFace, aPlaneOfFaces);
 
-        return true;
-      }
+      return true;
     }
   }
 
+  if (S1.IsNull() || S2.IsNull())
+    return false;
+
+  // case of coincident surfaces of any kind
+  if (anInfo1->SurfaceId > 0 && anInfo1->SurfaceId == anInfo2->SurfaceId)
+    return true;
+
   // case of two elementary surfaces: use OCCT tool
   // elementary surfaces: ConicalSurface, CylindricalSurface,
   //                      Plane, SphericalSurface and ToroidalSurface
@@ -2696,6 +2738,10 @@ bool ShapeUpgrade_UnifySameDomain::MergeEdges(
   // do loop while there are unused edges
   NCollection_Map<TopoDS_Shape, TopTools_ShapeMapHasher> aUsedEdges;
 
+  // chains of connected edges and their closure flags
+  NCollection_Vector<NCollection_Sequence<TopoDS_Shape>> aChains;
+  NCollection_Vector<bool>                               aChainsClosed;
+
   for (int iE = 1; iE <= aNbE; ++iE)
   {
     TopoDS_Edge edge = TopoDS::Edge(SeqEdges(iE));
@@ -2745,16 +2791,33 @@ bool ShapeUpgrade_UnifySameDomain::MergeEdges(
     if (aChain.Length() < 2)
       continue;
 
-    bool IsClosed = false;
-    if (V[0].IsSame(V[1]))
-      IsClosed = true;
-
-    // split chain by vertices at which merging is not possible
-    NCollection_Sequence<SubSequenceOfEdges> aOneSeq;
-    generateSubSeq(aChain, aOneSeq, IsClosed, myAngTol, myLinTol, VerticesToAvoid, theVFmap);
+    aChains.Appended().Append(aChain);
+    aChainsClosed.Append(V[0].IsSame(V[1]));
+  }
 
-    // put sub-chains in the result
-    SeqOfSubSeqOfEdges.Append(aOneSeq);
+  // split chains by vertices at which merging is not possible;
+  // the chains are independent and only analyzed, thus can be processed concurrently
+  const int aNbChains = aChains.Length();
+  if (aNbChains > 0)
+  {
+    NCollection_Array1<NCollection_Sequence<SubSequenceOfEdges>> aSubSeqs(0, aNbChains - 1);
+    OSD_Parallel::For(
+      0,
+      aNbChains,
+      [&](const int theIndex) {
+        generateSubSeq(aChains(theIndex),
+                       aSubSeqs(theIndex),
+                       aChainsClosed(theIndex),
+                       myAngTol,
+                       myLinTol,
+                       VerticesToAvoid,
+                       theVFmap);
+      },
+      !myRunParallel || aNbChains < 2);
+
+    // put sub-chains in the result in the order of chains
+    for (int iC = 0; iC < aNbChains; ++iC)
+      SeqOfSubSeqOfEdges.Append(aSubSeqs(iC));
   }
 
   for (int i = 1; i <= SeqOfSubSeqOfEdges.Length(); i++)
@@ -2841,6 +2904,7 @@ ShapeUpgrade_UnifySameDomain::ShapeUpgrade_UnifySameDomain()
       myConcatBSplines(false),
       myAllowInternal(false),
       mySafeInputMode(true),
+      myRunParallel(false),
       myHistory(new BRepTools_History)
 {
   myContext = new ShapeBuild_ReShape;
@@ -2860,6 +2924,7 @@ ShapeUpgrade_UnifySameDomain::ShapeUpgrade_UnifySameDomain(const TopoDS_Shape& a
       myConcatBSplines(ConcatBSplines),
       myAllowInternal(false),
       mySafeInputMode(true),
+      myRunParallel(false),
       myShape(aShape),
       myHistory(new BRepTools_History)
 {
@@ -2882,6 +2947,7 @@ void ShapeUpgrade_UnifySameDomain::Initialize(const TopoDS_Shape& aShape,
   myContext->Clear();
   myKeepShapes.Clear();
   myFacePlaneMap.Clear();
+  myFaceSurfInfo.Clear();
   myEFmap.Clear();
   myFaceNewFace.Clear();
   myHistory->Clear();
@@ -2935,6 +3001,10 @@ void ShapeUpgrade_UnifySameDomain::UnifyFaces()
   for (int i = 1; i <= aFaceMap.Extent(); i++)
     TopExp::MapShapesAndAncestors(aFaceMap(i), TopAbs_EDGE, TopAbs_FACE, aGMapEdgeFaces);
 
+  // analyze the surfaces of all faces at once to avoid repeated analysis
+  // of the same surface while comparing it with the surfaces of neighbours
+  FillFaceSurfaceInfo(aFaceMap);
+
   // creating map of face shells for the whole shape to avoid
   // unification of faces belonging to the different shells
   DataMapOfShapeMapOfShape aGMapFaceShells;
@@ -2996,12 +3066,45 @@ void ShapeUpgrade_UnifySameDomain::UnifyFaces()
     // No connection to shells, thus no need to pass the face-shell map
     IntUnifyFaces(aCmp, aGMapEdgeFaces, DataMapOfShapeMapOfShape(), aFreeBoundMap);
   }
+  myFaceSurfInfo.Clear();
 
   myShape = myContext->Apply(myShape);
 }
 
 //=================================================================================================
 
+void ShapeUpgrade_UnifySameDomain::FillFaceSurfaceInfo(
+  const NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher>& theFaces)
+{
+  myFaceSurfInfo.Clear();
+  const int aNbF = theFaces.Extent();
+  if (aNbF == 0)
+    return;
+
+  NCollection_Array1<FaceSurfaceInfo> anInfos(1, aNbF);
+  const double                        aLinTol = myLinTol;
+  OSD_Parallel::For(
+    1,
+    aNbF + 1,
+    [&](const int theIndex) {
+      ComputeFaceSurfaceInfo(TopoDS::Face(theFaces(theIndex)), aLinTol, anInfos(theIndex));
+    },
+    !myRunParallel || aNbF < 2);
+
+  // group the faces by geometrically coincident surfaces in one pass
+  NCollection_IndexedMap<occ::handle<Geom_Surface>, GeomHash_SurfaceHasher> aSurfaces;
+  myFaceSurfInfo.ReSize(aNbF);
+  for (int i = 1; i <= aNbF; ++i)
+  {
+    FaceSurfaceInfo& anInfo = anInfos(i);
+    if (!anInfo.Surface.IsNull())
+      anInfo.SurfaceId = aSurfaces.Add(anInfo.Surface);
+    myFaceSurfInfo.Bind(theFaces(i), anInfo);
+  }
+}
+
+//=================================================================================================
+
 static void SetFixWireModes(ShapeFix_Face& theSff)
 {
   occ::handle<ShapeFix_Wire> aFixWire             = theSff.FixWireTool();
@@ -3197,7 +3300,7 @@ void ShapeUpgrade_UnifySameDomain::IntUnifyFaces(
           }
         }
         //
-        if (IsSameDomain(aFace, aCheckedFace, myLinTol, myAngTol, myFacePlaneMap))
+        if (IsSameDomain(aFace, aCheckedFace, myLinTol, myAngTol, myFaceSurfInfo, myFacePlaneMap))
         {
 
           if (AddOrdinaryEdges(edges, aCheckedFace, dummy, RemovedEdges))
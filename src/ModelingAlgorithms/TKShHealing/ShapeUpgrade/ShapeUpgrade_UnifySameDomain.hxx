@@ -28,9 +28,11 @@
 #include <NCollection_DataMap.hxx>
 #include <NCollection_List.hxx>
 #include <NCollection_IndexedDataMap.hxx>
+#include <NCollection_IndexedMap.hxx>
 #include <NCollection_Map.hxx>
 #include <NCollection_Sequence.hxx>
 #include <Geom_Plane.hxx>
+#include <gp_Pln.hxx>
 #include <Precision.hxx>
 class ShapeBuild_ReShape;
 
@@ -73,6 +75,19 @@ public:
                               TopTools_ShapeMapHasher>
     DataMapOfShapeMapOfShape;
 
+  //! Data on the surface of a face, computed once for all faces before unification
+  //! and used for comparison of the surfaces of neighbouring faces.
+  struct FaceSurfaceInfo
+  {
+    occ::handle<Geom_Surface> Surface;           //!< basis surface with location of the face
+    gp_Pln                    Plane;             //!< plane of the surface if it is planar
+    int                       SurfaceId = 0;     //!< index of the group of coincident surfaces
+    bool                      IsPlanar  = false; //!< flag indicating that the surface is planar
+  };
+
+  typedef NCollection_DataMap<TopoDS_Shape, FaceSurfaceInfo, TopTools_ShapeMapHasher>
+    DataMapOfFaceSurfaceInfo;
+
   //! Empty constructor
   Standard_EXPORT ShapeUpgrade_UnifySameDomain();
 
@@ -128,6 +143,16 @@ public:
     myAngTol = (theValue < Precision::Angular() ? Precision::Angular() : theValue);
   }
 
+  //! Sets the flag of parallel processing.
+  //! In parallel mode the analysis of surfaces of faces and the checks of
+  //! the possibility of merging of the chains of edges are performed concurrently.
+  //! Modification of topology is always performed sequentially.
+  //! Default value is false.
+  void SetRunParallel(const bool theIsParallel) { myRunParallel = theIsParallel; }
+
+  //! Returns the flag of parallel processing.
+  bool RunParallel() const { return myRunParallel; }
+
   //! Performs unification and builds the resulting shape.
   Standard_EXPORT void Build();
 
@@ -150,6 +175,11 @@ protected:
   //! group of faces lying on coincident surfaces
   Standard_EXPORT void UnifyFaces();
 
+  //! Computes the data on surfaces of the given faces, grouping the faces
+  //! lying on coincident surfaces (see FaceSurfaceInfo).
+  void FillFaceSurfaceInfo(
+    const NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher>& theFaces);
+
   //! This method makes if possible a common edge from each
   //! group of smothly connected edges, which are common for the same couple of faces
   Standard_EXPORT void UnifyEdges();
@@ -213,10 +243,12 @@ private:
   bool                                                   myConcatBSplines;
   bool                                                   myAllowInternal;
   bool                                                   mySafeInputMode;
+  bool                                                   myRunParallel;
   TopoDS_Shape                                           myShape;
   occ::handle<ShapeBuild_ReShape>                        myContext;
   NCollection_Map<TopoDS_Shape, TopTools_ShapeMapHasher> myKeepShapes;
   DataMapOfFacePlane                                     myFacePlaneMap;
+  DataMapOfFaceSurfaceInfo                               myFaceSurfInfo;
   NCollection_IndexedDataMap<TopoDS_Shape, NCollection_List<TopoDS_Shape>, TopTools_ShapeMapHasher>
                                                                            myEFmap;
   NCollection_DataMap<TopoDS_Shape, TopoDS_Shape, TopTools_ShapeMapHasher> myFaceNewFace;
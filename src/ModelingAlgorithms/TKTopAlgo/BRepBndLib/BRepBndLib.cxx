@@ -44,6 +44,8 @@
 #include <Geom_Plane.hxx>
 #include <Extrema_ExtSS.hxx>
 #include <GeomAdaptor_Surface.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_Parallel.hxx>
 //
 static bool CanUseEdges(const Adaptor3d_Surface& BS);
 //
@@ -244,6 +246,90 @@ void BRepBndLib::AddClose(const TopoDS_Shape& S, Bnd_Box& B)
   }
 }
 
+//=======================================================================
+// function : addFaceOptimal
+// purpose  : Computes the precise bounding box of the face
+//=======================================================================
+static void addFaceOptimal(const TopoDS_Face& F,
+                           const bool         useTriangulation,
+                           const bool         useShapeTolerance,
+                           Bnd_Box&           aLocBox)
+{
+  TopLoc_Location                        l;
+  const occ::handle<Poly_Triangulation>& T = BRep_Tool::Triangulation(F, l);
+  if (useTriangulation && !T.IsNull() && T->MinMax(aLocBox, l))
+  {
+    //       B.Enlarge(T->Deflection());
+    aLocBox.Enlarge(T->Deflection() + BRep_Tool::Tolerance(F));
+    return;
+  }
+
+  const occ::handle<Geom_Surface>& GS = BRep_Tool::Surface(F, l);
+  if (GS.IsNull())
+  {
+    return;
+  }
+
+  BRepAdaptor_Surface BS(F, false);
+  BRepAdaptor_Curve   BC;
+  if (CanUseEdges(BS))
+  {
+    TopExp_Explorer ex2(F, TopAbs_EDGE);
+    if (!ex2.More())
+    {
+      BS.Initialize(F);
+      double Tol = useShapeTolerance ? BRep_Tool::Tolerance(F) : 0.;
+      BndLib_AddSurface::AddOptimal(BS, Tol, aLocBox);
+    }
+    else
+    {
+      double Tol;
+      for (; ex2.More(); ex2.Next())
+      {
+        Bnd_Box            anEBox;
+        const TopoDS_Edge& anE = TopoDS::Edge(ex2.Current());
+        if (BRep_Tool::Degenerated(anE) || !BRep_Tool::IsGeometric(anE))
+        {
+          continue;
+        }
+        BC.Initialize(anE);
+        Tol = useShapeTolerance ? BRep_Tool::Tolerance(anE) : 0.;
+        BndLib_Add3dCurve::AddOptimal(BC, Tol, anEBox);
+        aLocBox.Add(anEBox);
+      }
+    }
+  }
+  else
+  {
+    double umin, umax, vmin, vmax;
+    bool   isNaturalRestriction = false;
+    double Tol                  = useShapeTolerance ? BRep_Tool::Tolerance(F) : 0.;
+    FindExactUVBounds(F, umin, umax, vmin, vmax, Tol, isNaturalRestriction);
+    BndLib_AddSurface::AddOptimal(BS, umin, umax, vmin, vmax, Tol, aLocBox);
+    //
+    if (!isNaturalRestriction)
+    {
+      TopExp_Explorer ex2(F, TopAbs_EDGE);
+      Bnd_Box         EBox;
+      for (; ex2.More(); ex2.Next())
+      {
+        Bnd_Box            anEBox;
+        const TopoDS_Edge& anE = TopoDS::Edge(ex2.Current());
+        if (BRep_Tool::Degenerated(anE) || !BRep_Tool::IsGeometric(anE))
+        {
+          continue;
+        }
+        BC.Initialize(anE);
+        Tol = useShapeTolerance ? BRep_Tool::Tolerance(anE) : 0.;
+        BndLib_Add3dCurve::AddOptimal(BC, Tol, anEBox);
+        EBox.Add(anEBox);
+      }
+      Tol = useShapeTolerance ? BRep_Tool::Tolerance(F) : 0.;
+      AdjustFaceBox(BS, umin, umax, vmin, vmax, aLocBox, EBox, Tol);
+    }
+  }
+}
+
 //=======================================================================
 // function : AddOptimal
 // purpose  : Add a shape bounding to a box
@@ -251,99 +337,42 @@ void BRepBndLib::AddClose(const TopoDS_Shape& S, Bnd_Box& B)
 void BRepBndLib::AddOptimal(const TopoDS_Shape& S,
                             Bnd_Box&            B,
                             const bool          useTriangulation,
-                            const bool          useShapeTolerance)
+                            const bool          useShapeTolerance,
+                            const bool          theIsParallel)
 {
   TopExp_Explorer ex;
 
   // Add the faces
-  BRepAdaptor_Surface             BS;
   occ::handle<Poly_Triangulation> T;
   TopLoc_Location                 l;
   int                             i, nbNodes;
   BRepAdaptor_Curve               BC;
 
+  NCollection_Vector<TopoDS_Face> aFaces;
   for (ex.Init(S, TopAbs_FACE); ex.More(); ex.Next())
   {
-    const TopoDS_Face& F = TopoDS::Face(ex.Current());
-    T                    = BRep_Tool::Triangulation(F, l);
-    Bnd_Box aLocBox;
-    if (useTriangulation && !T.IsNull() && T->MinMax(aLocBox, l))
-    {
-      //       B.Enlarge(T->Deflection());
-      aLocBox.Enlarge(T->Deflection() + BRep_Tool::Tolerance(F));
-      double xmin, ymin, zmin, xmax, ymax, zmax;
-      aLocBox.Get(xmin, ymin, zmin, xmax, ymax, zmax);
-      B.Update(xmin, ymin, zmin, xmax, ymax, zmax);
-    }
-    else
+    aFaces.Append(TopoDS::Face(ex.Current()));
+  }
+  if (!aFaces.IsEmpty())
+  {
+    NCollection_Array1<Bnd_Box> aFaceBoxes(0, aFaces.Length() - 1);
+    OSD_Parallel::For(
+      0,
+      aFaces.Length(),
+      [&](const int theIndex) {
+        addFaceOptimal(aFaces(theIndex), useTriangulation, useShapeTolerance, aFaceBoxes(theIndex));
+      },
+      !theIsParallel || aFaces.Length() < 2);
+
+    for (NCollection_Array1<Bnd_Box>::Iterator aBoxIter(aFaceBoxes); aBoxIter.More();
+         aBoxIter.Next())
     {
-      const occ::handle<Geom_Surface>& GS = BRep_Tool::Surface(F, l);
-      if (!GS.IsNull())
+      const Bnd_Box& aLocBox = aBoxIter.Value();
+      if (!aLocBox.IsVoid())
       {
-        BS.Initialize(F, false);
-        if (CanUseEdges(BS))
-        {
-          TopExp_Explorer ex2(F, TopAbs_EDGE);
-          if (!ex2.More())
-          {
-            BS.Initialize(F);
-            double Tol = useShapeTolerance ? BRep_Tool::Tolerance(F) : 0.;
-            BndLib_AddSurface::AddOptimal(BS, Tol, aLocBox);
-          }
-          else
-          {
-            double Tol;
-            for (; ex2.More(); ex2.Next())
-            {
-              Bnd_Box            anEBox;
-              const TopoDS_Edge& anE = TopoDS::Edge(ex2.Current());
-              if (BRep_Tool::Degenerated(anE) || !BRep_Tool::IsGeometric(anE))
-              {
-                continue;
-              }
-              BC.Initialize(anE);
-              Tol = useShapeTolerance ? BRep_Tool::Tolerance(anE) : 0.;
-              BndLib_Add3dCurve::AddOptimal(BC, Tol, anEBox);
-              aLocBox.Add(anEBox);
-            }
-          }
-        }
-        else
-        {
-          double umin, umax, vmin, vmax;
-          bool   isNaturalRestriction = false;
-          double Tol                  = useShapeTolerance ? BRep_Tool::Tolerance(F) : 0.;
-          FindExactUVBounds(F, umin, umax, vmin, vmax, Tol, isNaturalRestriction);
-          BndLib_AddSurface::AddOptimal(BS, umin, umax, vmin, vmax, Tol, aLocBox);
-          //
-          if (!isNaturalRestriction)
-          {
-            TopExp_Explorer ex2(F, TopAbs_EDGE);
-            Bnd_Box         EBox;
-            for (; ex2.More(); ex2.Next())
-            {
-              Bnd_Box            anEBox;
-              const TopoDS_Edge& anE = TopoDS::Edge(ex2.Current());
-              if (BRep_Tool::Degenerated(anE) || !BRep_Tool::IsGeometric(anE))
-              {
-                continue;
-              }
-              BC.Initialize(anE);
-              Tol = useShapeTolerance ? BRep_Tool::Tolerance(anE) : 0.;
-              BndLib_Add3dCurve::AddOptimal(BC, Tol, anEBox);
-              EBox.Add(anEBox);
-            }
-            Tol = useShapeTolerance ? BRep_Tool::Tolerance(F) : 0.;
-            AdjustFaceBox(BS, umin, umax, vmin, vmax, aLocBox, EBox, Tol);
-          }
-        }
-
-        if (!aLocBox.IsVoid())
-        {
-          double xmin, ymin, zmin, xmax, ymax, zmax;
-          aLocBox.Get(xmin, ymin, zmin, xmax, ymax, zmax);
-          B.Update(xmin, ymin, zmin, xmax, ymax, zmax);
-        }
+        double xmin, ymin, zmin, xmax, ymax, zmax;
+        aLocBox.Get(xmin, ymin, zmin, xmax, ymax, zmax);
+        B.Update(xmin, ymin, zmin, xmax, ymax, zmax);
       }
     }
   }
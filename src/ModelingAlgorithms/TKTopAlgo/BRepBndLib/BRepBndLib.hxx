@@ -75,10 +75,12 @@ public:
   //! these tolerances are used for numerical methods of bounding box size calculations,
   //! otherwise bounding box is built according to sizes of uderlined geometrical entities,
   //! numerical calculation use tolerance Precision::Confusion().
+  //! If theIsParallel = True, the boxes of faces are computed in parallel threads.
   Standard_EXPORT static void AddOptimal(const TopoDS_Shape& S,
                                          Bnd_Box&            B,
                                          const bool          useTriangulation  = true,
-                                         const bool          useShapeTolerance = false);
+                                         const bool          useShapeTolerance = false,
+                                         const bool          theIsParallel     = false);
 
   //! Computes the Oriented Bounding box for the shape <theS>.
   //! Two independent methods of computation are implemented:
@@ -92,11 +94,14 @@ public:
   //! extended on the tolerance of the shape.
   //! theIsOptimal flag defines whether to look for the more tight
   //! OBB for the cost of performance or not.
+  //! If theIsParallel == TRUE then the properties and the boxes
+  //! of faces are computed in parallel threads.
   Standard_EXPORT static void AddOBB(const TopoDS_Shape& theS,
                                      Bnd_OBB&            theOBB,
                                      const bool          theIsTriangulationUsed  = true,
                                      const bool          theIsOptimal            = false,
-                                     const bool          theIsShapeToleranceUsed = true);
+                                     const bool          theIsShapeToleranceUsed = true,
+                                     const bool          theIsParallel           = false);
 };
 
 #endif // _BRepBndLib_HeaderFile
@@ -325,13 +325,15 @@ static bool CheckPoints(const TopoDS_Shape& theS,
 // Function : ComputeProperties
 // purpose : Computes properties of theS.
 //=======================================================================
-static void ComputeProperties(const TopoDS_Shape& theS, GProp_GProps& theGCommon)
+static void ComputeProperties(const TopoDS_Shape& theS,
+                              GProp_GProps&       theGCommon,
+                              const bool          theIsParallel)
 {
   TopExp_Explorer anExp;
   for (anExp.Init(theS, TopAbs_SOLID); anExp.More(); anExp.Next())
   {
     GProp_GProps aG;
-    BRepGProp::VolumeProperties(anExp.Current(), aG, true);
+    BRepGProp::VolumeProperties(anExp.Current(), aG, true, false, false, theIsParallel);
     theGCommon.Add(aG);
   }
 
@@ -364,11 +366,12 @@ static void ComputePCA(const TopoDS_Shape& theS,
                        Bnd_OBB&            theOBB,
                        const bool          theIsTriangulationUsed,
                        const bool          theIsOptimal,
-                       const bool          theIsShapeToleranceUsed)
+                       const bool          theIsShapeToleranceUsed,
+                       const bool          theIsParallel)
 {
   // Compute the transformation matrix to obtain more tight bounding box
   GProp_GProps aGCommon;
-  ComputeProperties(theS, aGCommon);
+  ComputeProperties(theS, aGCommon, theIsParallel);
 
   // Transform the shape to the local coordinate system
   gp_Trsf aTrsf;
@@ -392,7 +395,11 @@ static void ComputePCA(const TopoDS_Shape& theS,
   Bnd_Box aShapeBox;
   if (theIsOptimal)
   {
-    BRepBndLib::AddOptimal(aST, aShapeBox, theIsTriangulationUsed, theIsShapeToleranceUsed);
+    BRepBndLib::AddOptimal(aST,
+                           aShapeBox,
+                           theIsTriangulationUsed,
+                           theIsShapeToleranceUsed,
+                           theIsParallel);
   }
   else
   {
@@ -476,10 +483,16 @@ void BRepBndLib::AddOBB(const TopoDS_Shape& theS,
                         Bnd_OBB&            theOBB,
                         const bool          theIsTriangulationUsed,
                         const bool          theIsOptimal,
-                        const bool          theIsShapeToleranceUsed)
+                        const bool          theIsShapeToleranceUsed,
+                        const bool          theIsParallel)
 {
   if (CheckPoints(theS, theIsTriangulationUsed, theIsOptimal, theIsShapeToleranceUsed, theOBB))
     return;
 
-  ComputePCA(theS, theOBB, theIsTriangulationUsed, theIsOptimal, theIsShapeToleranceUsed);
+  ComputePCA(theS,
+             theOBB,
+             theIsTriangulationUsed,
+             theIsOptimal,
+             theIsShapeToleranceUsed,
+             theIsParallel);
 }
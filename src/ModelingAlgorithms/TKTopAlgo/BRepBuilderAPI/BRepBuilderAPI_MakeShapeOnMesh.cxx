@@ -16,6 +16,7 @@
 #include <BRepBuilderAPI_MakeShapeOnMesh.hxx>
 
 #include <BRep_Builder.hxx>
+#include <BRep_FacetedMesh.hxx>
 #include <BRepAdaptor_Curve.hxx>
 #include <BRepBuilderAPI_MakeEdge.hxx>
 #include <BRepBuilderAPI_MakeFace.hxx>
@@ -87,6 +88,14 @@ void BRepBuilderAPI_MakeShapeOnMesh::Build(const Message_ProgressRange& theRange
   if (myMesh.IsNull() || myMesh->NbNodes() == 0 || myMesh->NbTriangles() == 0)
     return;
 
+  if (myIsCompact)
+  {
+    myShape = BRep_FacetedMesh::MakeCompound(myMesh);
+    if (!myShape.IsNull())
+      this->Done();
+    return;
+  }
+
   const int aNbNodes     = myMesh->NbNodes();
   const int aNbTriangles = myMesh->NbTriangles();
 
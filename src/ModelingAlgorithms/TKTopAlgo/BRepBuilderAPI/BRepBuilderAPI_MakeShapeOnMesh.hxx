@@ -30,16 +30,26 @@ public:
   //! Ctor. Sets mesh to process.
   //! @param[in] theMesh  - Mesh to construct shape for.
   BRepBuilderAPI_MakeShapeOnMesh(const occ::handle<Poly_Triangulation>& theMesh)
-      : myMesh(theMesh)
+      : myMesh(theMesh),
+        myIsCompact(false)
   {
   }
 
+  //! Returns true if the compact representation of the shape is built.
+  bool IsCompact() const { return myIsCompact; }
+
+  //! Sets the flag to build the compact read-only representation of the shape
+  //! (see BRep_FacetedMesh), which creates the sub-shapes on demand only.
+  //! Default is false.
+  void SetCompact(const bool theIsCompact) { myIsCompact = theIsCompact; }
+
   //! Builds shape on mesh.
   Standard_EXPORT void Build(
     const Message_ProgressRange& theRange = Message_ProgressRange()) override;
 
 private:
   occ::handle<Poly_Triangulation> myMesh;
+  bool                            myIsCompact;
 };
 
 #endif // _BRepBuilderAPI_MakeShapeOnMesh_HeaderFile
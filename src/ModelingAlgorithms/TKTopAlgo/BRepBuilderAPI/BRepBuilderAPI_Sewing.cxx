@@ -41,6 +41,7 @@
 #define TEST 1
 
 #include <Bnd_Box2d.hxx>
+#include <Bnd_Tools.hxx>
 #include <BndLib_Add2dCurve.hxx>
 #include <BndLib_Add3dCurve.hxx>
 #include <BRep_Builder.hxx>
@@ -50,13 +51,15 @@
 #include <BRep_Tool.hxx>
 #include <BRep_TEdge.hxx>
 #include <BRep_TVertex.hxx>
-#include <BRepBuilderAPI_BndBoxTreeSelector.hxx>
 #include <BRepBuilderAPI_VertexInspector.hxx>
 #include <BRepBuilderAPI_Sewing.hxx>
 #include <BRepLib.hxx>
 #include <BRepTools.hxx>
 #include <BRepTools_Quilt.hxx>
 #include <BRepTools_ReShape.hxx>
+#include <BVH_BinnedBuilder.hxx>
+#include <BVH_BoxSet.hxx>
+#include <BVH_Traverse.hxx>
 #include <Extrema_ExtPC.hxx>
 #include <GCPnts_AbscissaPoint.hxx>
 #include <GCPnts_UniformAbscissa.hxx>
@@ -73,7 +76,7 @@
 #include <gp_Pnt.hxx>
 #include <gp_Vec.hxx>
 #include <Message_ProgressScope.hxx>
-#include <NCollection_UBTreeFiller.hxx>
+#include <OSD_Parallel.hxx>
 #include <Precision.hxx>
 #include <Standard_Failure.hxx>
 #include <Standard_NoSuchObject.hxx>
@@ -1865,7 +1868,8 @@ BRepBuilderAPI_Sewing::BRepBuilderAPI_Sewing(const double tolerance,
                                              const bool   optionCutting,
                                              const bool   optionNonmanifold)
 {
-  myReShape = new BRepTools_ReShape;
+  myReShape     = new BRepTools_ReShape;
+  myRunParallel = false;
   Init(tolerance, optionSewing, optionAnalysis, optionCutting, optionNonmanifold);
 }
 
@@ -2325,6 +2329,39 @@ void BRepBuilderAPI_Sewing::Dump() const
   std::cout << " " << std::endl;
 }
 
+//=======================================================================
+// function : IsSmallEdge
+// purpose  : Checks if the 3D curve of the edge is compact enough
+//            to make the edge degenerated
+//=======================================================================
+
+static bool IsSmallEdge(const TopoDS_Edge& theEdge, const double theMinTol)
+{
+  if (BRep_Tool::Degenerated(theEdge))
+    return false;
+  double                  first, last;
+  occ::handle<Geom_Curve> c3d = BRep_Tool::Curve(theEdge, first, last);
+  if (c3d.IsNull())
+  {
+#ifdef OCCT_DEBUG
+    std::cout << "Warning: Possibly small edge can be sewed: No 3D curve" << std::endl;
+#endif
+    return false;
+  }
+  // Evaluate curve compactness
+  const int npt = 5;
+  gp_Pnt    cp((c3d->Value(first).XYZ() + c3d->Value(last).XYZ()) * 0.5);
+  double    dist, maxdist = 0.0;
+  double    delta = (last - first) / (npt - 1);
+  for (int idx = 0; idx < npt; idx++)
+  {
+    dist = cp.Distance(c3d->Value(first + idx * delta));
+    if (maxdist < dist)
+      maxdist = dist;
+  }
+  return (2. * maxdist <= theMinTol);
+}
+
 //=======================================================================
 // function : FaceAnalysis
 // purpose  : Remove
@@ -2349,8 +2386,29 @@ void BRepBuilderAPI_Sewing::FaceAnalysis(const Message_ProgressRange& theProgres
   NCollection_IndexedDataMap<TopoDS_Shape, NCollection_List<TopoDS_Shape>, TopTools_ShapeMapHasher>
                         GluedVertices;
   int                   i = 1;
-  Message_ProgressScope aPS(theProgress, "Shape analysis", myOldShapes.Extent());
-  for (i = 1; i <= myOldShapes.Extent() && aPS.More(); i++, aPS.Next())
+  Message_ProgressScope aPS(theProgress, "Shape analysis", 2);
+
+  // Check the edges for smallness in advance: the check depends on the edge only
+  NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> anEdges;
+  for (i = 1; i <= myOldShapes.Extent(); i++)
+    TopExp::MapShapes(myOldShapes(i), TopAbs_EDGE, anEdges);
+  NCollection_Array1<bool> aSmallEdgeFlags(1, anEdges.Extent());
+  {
+    Message_ProgressScope aPSSmall(aPS.Next(), "Check of small edges", 1);
+    const double          aMinTol = MinTolerance();
+    OSD_Parallel::For(
+      1,
+      anEdges.Extent() + 1,
+      [&](const int theIndex) {
+        aSmallEdgeFlags(theIndex) = IsSmallEdge(TopoDS::Edge(anEdges(theIndex)), aMinTol);
+      },
+      !myRunParallel);
+  }
+  if (!aPS.More())
+    return;
+
+  Message_ProgressScope aPSFaces(aPS.Next(), "Analysis of faces", myOldShapes.Extent());
+  for (i = 1; i <= myOldShapes.Extent() && aPSFaces.More(); i++, aPSFaces.Next())
   {
     for (TopExp_Explorer fexp(myOldShapes(i), TopAbs_FACE); fexp.More(); fexp.Next())
     {
@@ -2401,43 +2459,7 @@ void BRepBuilderAPI_Sewing::FaceAnalysis(const Message_ProgressRange& theProgres
           bool isSmall = SmallEdges.Contains(edge);
           if (!isSmall)
           {
-
-            // Check for small edge
-            double                  first, last;
-            occ::handle<Geom_Curve> c3d = BRep_Tool::Curve(edge, first, last);
-            if (c3d.IsNull())
-            {
-#ifdef OCCT_DEBUG
-              std::cout << "Warning: Possibly small edge can be sewed: No 3D curve" << std::endl;
-#endif
-            }
-            else
-            {
-              // Evaluate curve compactness
-              const int npt = 5;
-              gp_Pnt    cp((c3d->Value(first).XYZ() + c3d->Value(last).XYZ()) * 0.5);
-              double    dist, maxdist = 0.0;
-              double    delta = (last - first) / (npt - 1);
-              for (int idx = 0; idx < npt; idx++)
-              {
-                dist = cp.Distance(c3d->Value(first + idx * delta));
-                if (maxdist < dist)
-                  maxdist = dist;
-              }
-              isSmall = (2. * maxdist <= MinTolerance());
-              /*try {
-            GeomAdaptor_Curve cAdapt(c3d);
-            double length = GCPnts_AbscissaPoint::Length(cAdapt,first,last);
-            isSmall = (length <= MinTolerance());
-              }
-              catch (Standard_Failure) {
-    #ifdef OCCT_DEBUG
-            std::cout << "Warning: Possibly small edge can be sewed: ";
-            Standard_Failure::Caught()->Print(std::cout); std::cout << std::endl;
-    #endif
-              }*/
-            }
-
+            isSmall = aSmallEdgeFlags(anEdges.FindIndex(edge));
             if (isSmall)
             {
 
@@ -3984,6 +4006,53 @@ bool BRepBuilderAPI_Sewing::MergedNearestEdges(const TopoDS_Shape&
   return success;
 }
 
+//! Free bound with its 3D curve and the vertices to be projected on it,
+//! used for the parallel search of the cutting nodes.
+struct BRepBuilderAPI_SewingCutBound
+{
+  occ::handle<Geom_Curve> Curve;
+  double                  First = 0.0;
+  double                  Last  = 0.0;
+  Bnd_Box                 Box;
+  //! Indices of the vertices (in myVertexNode) located in the box of the bound
+  NCollection_List<int> Vertices;
+  //! Vertices to project on the bound and the results of the projection
+  NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> Candidates;
+  NCollection_Array1<double>                                    Dist;
+  NCollection_Array1<double>                                    Para;
+  NCollection_Array1<gp_Pnt>                                    Proj;
+};
+
+//! Selector of the bounds with the boxes intersecting the box of the vertex.
+class BRepBuilderAPI_SewingBoundSelector
+    : public BVH_Traverse<double, 3, BVH_BoxSet<double, 3, int>, bool>
+{
+public:
+  BRepBuilderAPI_SewingBoundSelector(const BVH_Box<double, 3>& theBox,
+                                     NCollection_List<int>&    theBounds)
+      : myBox(theBox),
+        myBounds(theBounds)
+  {
+  }
+
+  bool RejectNode(const BVH_Vec3d& theCMin, const BVH_Vec3d& theCMax, bool&) const override
+  {
+    return myBox.IsOut(theCMin, theCMax);
+  }
+
+  bool Accept(const int theIndex, const bool&) override
+  {
+    if (myBox.IsOut(myBVHSet->Box(theIndex)))
+      return false;
+    myBounds.Append(myBVHSet->Element(theIndex));
+    return true;
+  }
+
+private:
+  BVH_Box<double, 3>     myBox;
+  NCollection_List<int>& myBounds;
+};
+
 //=======================================================================
 // function : Cutting
 // purpose  : Modifies :
@@ -3997,99 +4066,155 @@ void BRepBuilderAPI_Sewing::Cutting(const Message_ProgressRange& theProgress)
   int i, nbVertices = myVertexNode.Extent();
   if (!nbVertices)
     return;
-  // Create a box tree with vertices
-  double                                 eps = myTolerance * 0.5;
-  NCollection_UBTree<int, Bnd_Box>       aTree;
-  NCollection_UBTreeFiller<int, Bnd_Box> aTreeFiller(aTree);
-  BRepBuilderAPI_BndBoxTreeSelector      aSelector;
-  for (i = 1; i <= nbVertices; i++)
+  int                   nbBounds = myBoundFaces.Extent();
+  Message_ProgressScope aPS(theProgress, "Cutting bounds", 10);
+
+  // Obtain bound curves and their bounding boxes
+  NCollection_Array1<BRepBuilderAPI_SewingCutBound> aBounds(1, nbBounds);
   {
-    gp_Pnt  pt = BRep_Tool::Pnt(TopoDS::Vertex(myVertexNode.FindKey(i)));
-    Bnd_Box aBox;
-    aBox.Set(pt);
-    aBox.Enlarge(eps);
-    aTreeFiller.Add(i, aBox);
+    Message_ProgressScope aPSBox(aPS.Next(2), "Bounding boxes of bounds", 1);
+    OSD_Parallel::For(
+      1,
+      nbBounds + 1,
+      [&](const int theIndex) {
+        // Do not cut floating edges
+        if (!myBoundFaces(theIndex).Extent())
+          return;
+        BRepBuilderAPI_SewingCutBound& aBound = aBounds(theIndex);
+        const TopoDS_Edge&             bound  = TopoDS::Edge(myBoundFaces.FindKey(theIndex));
+        TopLoc_Location                loc;
+        occ::handle<Geom_Curve> c3d = BRep_Tool::Curve(bound, loc, aBound.First, aBound.Last);
+        if (c3d.IsNull())
+          return;
+        if (!loc.IsIdentity())
+        {
+          c3d = occ::down_cast<Geom_Curve>(c3d->Copy());
+          c3d->Transform(loc.Transformation());
+        }
+        aBound.Curve = c3d;
+        // Create bounding box around curve
+        GeomAdaptor_Curve adptC(c3d, aBound.First, aBound.Last);
+        BndLib_Add3dCurve::Add(adptC, myTolerance, aBound.Box);
+      },
+      !myRunParallel);
   }
-  aTreeFiller.Fill();
+  if (!aPS.More())
+    return;
 
-  occ::handle<Geom_Curve> c3d;
-  TopLoc_Location         loc;
-  double                  first, last;
-  // Iterate on all boundaries
-  int                   nbBounds = myBoundFaces.Extent();
-  Message_ProgressScope aPS(theProgress, "Cutting bounds", nbBounds);
-  NCollection_IndexedDataMap<TopoDS_Shape,
-                             NCollection_List<TopoDS_Shape>,
-                             TopTools_ShapeMapHasher>::Iterator anIterB(myBoundFaces);
-  for (; anIterB.More() && aPS.More(); anIterB.Next(), aPS.Next())
+  // Find the nodes located in the bounding boxes of bounds
   {
-    const TopoDS_Edge& bound = TopoDS::Edge(anIterB.Key());
-    // Do not cut floating edges
-    if (!anIterB.Value().Extent())
-      continue;
-    // Obtain bound curve
-    c3d = BRep_Tool::Curve(bound, loc, first, last);
-    if (c3d.IsNull())
-      continue;
-    if (!loc.IsIdentity())
-    {
-      c3d = occ::down_cast<Geom_Curve>(c3d->Copy());
-      c3d->Transform(loc.Transformation());
+    Message_ProgressScope aPSSel(aPS.Next(2), "Search of nodes near bounds", 1);
+    // Create a box tree with bounds
+    occ::handle<BVH_BoxSet<double, 3, int>> aBoundSet =
+      new BVH_BoxSet<double, 3, int>(new BVH_BinnedBuilder<double, 3>());
+    aBoundSet->SetSize(nbBounds);
+    for (i = 1; i <= nbBounds; i++)
+    {
+      if (!aBounds(i).Box.IsVoid())
+        aBoundSet->Add(i, Bnd_Tools::Bnd2BVH(aBounds(i).Box));
+    }
+    aBoundSet->Build();
+
+    double                                    eps = myTolerance * 0.5;
+    NCollection_Array1<NCollection_List<int>> aNodeBounds(1, nbVertices);
+    OSD_Parallel::For(
+      1,
+      nbVertices + 1,
+      [&](const int theIndex) {
+        gp_Pnt  pt = BRep_Tool::Pnt(TopoDS::Vertex(myVertexNode.FindKey(theIndex)));
+        Bnd_Box aBox;
+        aBox.Set(pt);
+        aBox.Enlarge(eps);
+        BRepBuilderAPI_SewingBoundSelector aSelector(Bnd_Tools::Bnd2BVH(aBox),
+                                                     aNodeBounds(theIndex));
+        aSelector.SetBVHSet(aBoundSet.get());
+        aSelector.Select();
+      },
+      !myRunParallel);
+
+    // Store the vertices for bounds in the order of vertices,
+    // thus the result does not depend on the order of the search
+    for (i = 1; i <= nbVertices; i++)
+    {
+      for (NCollection_List<int>::Iterator itl(aNodeBounds(i)); itl.More(); itl.Next())
+        aBounds(itl.Value()).Vertices.Append(i);
     }
-    // Create cutting sections
-    NCollection_List<TopoDS_Shape> listSections;
-    { // szv: Use brackets to destroy local variables
-      // Obtain candidate vertices
-      TopoDS_Vertex                                                 V1, V2;
-      NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> CandidateVertices;
-      { // szv: Use brackets to destroy local variables
-        // Create bounding box around curve
-        Bnd_Box           aGlobalBox;
-        GeomAdaptor_Curve adptC(c3d, first, last);
-        BndLib_Add3dCurve::Add(adptC, myTolerance, aGlobalBox);
-        // Sort vertices to find candidates
-        aSelector.SetCurrent(aGlobalBox);
-        aTree.Select(aSelector);
-        // Skip bound if no node is in the boundind box
-        if (!aSelector.ResInd().Extent())
-          continue;
+  }
+  if (!aPS.More())
+    return;
+
+  // Project the candidate vertices on bounds
+  {
+    Message_ProgressScope aPSProj(aPS.Next(3), "Projection of nodes on bounds", 1);
+    OSD_Parallel::For(
+      1,
+      nbBounds + 1,
+      [&](const int theIndex) {
+        BRepBuilderAPI_SewingCutBound& aBound = aBounds(theIndex);
+        // Skip bound if no node is in the bounding box
+        if (aBound.Vertices.IsEmpty())
+          return;
         // Retrieve bound nodes
-        TopExp::Vertices(bound, V1, V2);
+        TopoDS_Vertex V1, V2;
+        TopExp::Vertices(TopoDS::Edge(myBoundFaces.FindKey(theIndex)), V1, V2);
         const TopoDS_Shape& Node1 = myVertexNode.FindFromKey(V1);
         const TopoDS_Shape& Node2 = myVertexNode.FindFromKey(V2);
         // Fill map of candidate vertices
-        NCollection_List<int>::Iterator itl(aSelector.ResInd());
+        NCollection_List<int>::Iterator itl(aBound.Vertices);
         for (; itl.More(); itl.Next())
         {
           const int           index = itl.Value();
           const TopoDS_Shape& Node  = myVertexNode.FindFromIndex(index);
           if (!Node.IsSame(Node1) && !Node.IsSame(Node2))
-          {
-            TopoDS_Shape vertex = myVertexNode.FindKey(index);
-            CandidateVertices.Add(vertex);
-          }
+            aBound.Candidates.Add(myVertexNode.FindKey(index));
         }
-        aSelector.ClearResList();
-      }
-      int nbCandidates = CandidateVertices.Extent();
-      if (!nbCandidates)
-        continue;
-      // Project vertices on curve
-      NCollection_Array1<double> arrPara(1, nbCandidates), arrDist(1, nbCandidates);
-      NCollection_Array1<gp_Pnt> arrPnt(1, nbCandidates), arrProj(1, nbCandidates);
-      for (int j = 1; j <= nbCandidates; j++)
-        arrPnt(j) = BRep_Tool::Pnt(TopoDS::Vertex(CandidateVertices(j)));
-      ProjectPointsOnCurve(arrPnt, c3d, first, last, arrDist, arrPara, arrProj, true);
+        int nbCandidates = aBound.Candidates.Extent();
+        if (!nbCandidates)
+          return;
+        // Project vertices on curve
+        aBound.Dist.Resize(1, nbCandidates, false);
+        aBound.Para.Resize(1, nbCandidates, false);
+        aBound.Proj.Resize(1, nbCandidates, false);
+        NCollection_Array1<gp_Pnt> arrPnt(1, nbCandidates);
+        for (int j = 1; j <= nbCandidates; j++)
+          arrPnt(j) = BRep_Tool::Pnt(TopoDS::Vertex(aBound.Candidates(j)));
+        ProjectPointsOnCurve(arrPnt,
+                             aBound.Curve,
+                             aBound.First,
+                             aBound.Last,
+                             aBound.Dist,
+                             aBound.Para,
+                             aBound.Proj,
+                             true);
+      },
+      !myRunParallel);
+  }
+  if (!aPS.More())
+    return;
+
+  // Iterate on all boundaries
+  Message_ProgressScope aPSCut(aPS.Next(3), "Cutting of bounds", nbBounds);
+  for (i = 1; i <= nbBounds && aPSCut.More(); i++, aPSCut.Next())
+  {
+    const BRepBuilderAPI_SewingCutBound& aBound = aBounds(i);
+    if (aBound.Candidates.IsEmpty())
+      continue;
+    const TopoDS_Edge& bound = TopoDS::Edge(myBoundFaces.FindKey(i));
+    // Create cutting sections
+    NCollection_List<TopoDS_Shape> listSections;
+    { // szv: Use brackets to destroy local variables
+      TopoDS_Vertex V1, V2;
+      TopExp::Vertices(bound, V1, V2);
       // Create cutting nodes
       NCollection_Sequence<TopoDS_Shape> seqNode;
       NCollection_Sequence<double>       seqPara;
-      CreateCuttingNodes(CandidateVertices,
+      CreateCuttingNodes(aBound.Candidates,
                          bound,
                          V1,
                          V2,
-                         arrDist,
-                         arrPara,
-                         arrProj,
+                         aBound.Dist,
+                         aBound.Para,
+                         aBound.Proj,
                          seqNode,
                          seqPara);
       if (!seqPara.Length())
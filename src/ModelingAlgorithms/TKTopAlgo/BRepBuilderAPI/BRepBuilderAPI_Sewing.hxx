@@ -221,6 +221,14 @@ public:
   //! in this case WorkTolerance = myTolerance + tolEdge1+ tolEdg2;
   void SetLocalTolerancesMode(const bool theLocalTolerancesMode);
 
+  //! Sets the flag of parallel processing of the analysis of faces
+  //! and of the search of cutting nodes on free bounds.
+  //! The result does not depend on the flag. By default - false.
+  void SetRunParallel(const bool theIsParallel);
+
+  //! Returns the flag of parallel processing.
+  bool RunParallel() const;
+
   //! Sets mode for non-manifold sewing.
   void SetNonManifoldMode(const bool theNonManifoldMode);
 
@@ -414,6 +422,7 @@ private:
   bool                                                   myFloatingEdgesMode;
   bool                                                   mySameParameterMode;
   bool                                                   myLocalToleranceMode;
+  bool                                                   myRunParallel;
   double                                                 myMinTolerance;
   double                                                 myMaxTolerance;
   NCollection_Map<TopoDS_Shape, TopTools_ShapeMapHasher> myMergedEdges;
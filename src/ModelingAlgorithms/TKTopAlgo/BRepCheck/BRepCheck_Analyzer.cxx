@@ -355,8 +355,13 @@ void BRepCheck_Analyzer::Init(const TopoDS_Shape& theShape, const bool B)
 
   myShape = theShape;
   myMap.Clear();
+  // transformed surfaces of faces are shared by the checks of their edges
+  mySurfaceCache = new BRepCheck_SurfaceCache();
   Put(theShape, B);
   Perform();
+  // the cache is still referenced by the results of edges, so release the surfaces explicitly
+  mySurfaceCache->Clear();
+  mySurfaceCache.Nullify();
 }
 
 //=================================================================================================
@@ -378,6 +383,7 @@ void BRepCheck_Analyzer::Put(const TopoDS_Shape& theShape, const bool B)
       HR = new BRepCheck_Edge(TopoDS::Edge(theShape));
       occ::down_cast<BRepCheck_Edge>(HR)->GeometricControls(B);
       occ::down_cast<BRepCheck_Edge>(HR)->SetExactMethod(myIsExact);
+      occ::down_cast<BRepCheck_Edge>(HR)->SetSurfaceCache(mySurfaceCache);
       break;
     case TopAbs_WIRE:
       HR = new BRepCheck_Wire(TopoDS::Wire(theShape));
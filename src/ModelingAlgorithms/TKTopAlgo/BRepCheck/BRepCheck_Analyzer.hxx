@@ -23,6 +23,7 @@
 
 #include <TopoDS_Shape.hxx>
 #include <BRepCheck_Result.hxx>
+#include <BRepCheck_SurfaceCache.hxx>
 #include <NCollection_IndexedDataMap.hxx>
 #include <TopAbs_ShapeEnum.hxx>
 class BRepCheck_Result;
@@ -161,6 +162,7 @@ private:
 private:
   TopoDS_Shape                                                            myShape;
   NCollection_IndexedDataMap<TopoDS_Shape, occ::handle<BRepCheck_Result>> myMap;
+  occ::handle<BRepCheck_SurfaceCache>                                     mySurfaceCache;
   bool                                                                    myIsParallel;
   bool                                                                    myIsExact;
 };
@@ -392,10 +392,14 @@ void BRepCheck_Edge::InContext(const TopoDS_Shape& S)
 
             if (myGctrl)
             {
-              occ::handle<Geom_Surface> Sb = cr->Surface();
-              Sb                           = Handle(Geom_Surface)::DownCast
-                //	      (Su->Transformed(L.Transformation()));
-                (Su->Transformed(/*L*/ (Floc * TFloc).Transformation()));
+              occ::handle<Geom_Surface> Sb =
+                !mySurfaceCache.IsNull() ? mySurfaceCache->Surface(S) : occ::handle<Geom_Surface>();
+              if (Sb.IsNull())
+              {
+                Sb = Handle(Geom_Surface)::DownCast
+                  //	      (Su->Transformed(L.Transformation()));
+                  (Su->Transformed(/*L*/ (Floc * TFloc).Transformation()));
+              }
               occ::handle<Geom2d_Curve>             PC   = cr->PCurve();
               occ::handle<GeomAdaptor_Surface>      GAHS = new GeomAdaptor_Surface(Sb);
               occ::handle<Geom2dAdaptor_Curve>      GHPC = new Geom2dAdaptor_Curve(PC, f, l);
@@ -20,6 +20,7 @@
 #include <Adaptor3d_Curve.hxx>
 #include <BRepCheck_Result.hxx>
 #include <BRepCheck_Status.hxx>
+#include <BRepCheck_SurfaceCache.hxx>
 
 class BRep_CurveRepresentation;
 class TopoDS_Edge;
@@ -56,6 +57,16 @@ public:
   //! Returns true if exact method selected
   bool IsExactMethod() { return myIsExactMethod; }
 
+  //! Sets the cache of transformed surfaces of faces shared by the checks of edges
+  //! (e.g. by BRepCheck_Analyzer); without the cache, the surface is copied by each check.
+  void SetSurfaceCache(const occ::handle<BRepCheck_SurfaceCache>& theCache)
+  {
+    mySurfaceCache = theCache;
+  }
+
+  //! Returns the cache of transformed surfaces of faces.
+  const occ::handle<BRepCheck_SurfaceCache>& SurfaceCache() const { return mySurfaceCache; }
+
   //! Checks, if polygon on triangulation of heEdge
   //! is out of 3D-curve of this edge.
   Standard_EXPORT BRepCheck_Status CheckPolygonOnTriangulation(const TopoDS_Edge& theEdge);
@@ -67,6 +78,7 @@ private:
   occ::handle<Adaptor3d_Curve>          myHCurve;
   bool                                  myGctrl;
   bool                                  myIsExactMethod;
+  occ::handle<BRepCheck_SurfaceCache>   mySurfaceCache;
 };
 
 #endif // _BRepCheck_Edge_HeaderFile
@@ -0,0 +1,69 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRepCheck_SurfaceCache.hxx>
+
+#include <BRep_TFace.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(BRepCheck_SurfaceCache, Standard_Transient)
+
+//=================================================================================================
+
+BRepCheck_SurfaceCache::BRepCheck_SurfaceCache() {}
+
+//=================================================================================================
+
+occ::handle<Geom_Surface> BRepCheck_SurfaceCache::Surface(const TopoDS_Shape& theFace)
+{
+  {
+    std::lock_guard<std::mutex> aLock(myMutex);
+    if (const occ::handle<Geom_Surface>* aSurface = mySurfaces.Seek(theFace))
+    {
+      return *aSurface;
+    }
+  }
+
+  // the surface is copied out of the lock, so that the faces are processed concurrently
+  const occ::handle<BRep_TFace> aTFace = occ::down_cast<BRep_TFace>(theFace.TShape());
+  if (aTFace.IsNull() || aTFace->Surface().IsNull())
+  {
+    return occ::handle<Geom_Surface>();
+  }
+  const occ::handle<Geom_Surface> aSurface = occ::down_cast<Geom_Surface>(
+    aTFace->Surface()->Transformed((theFace.Location() * aTFace->Location()).Transformation()));
+
+  // keep the surface computed by the first thread
+  std::lock_guard<std::mutex> aLock(myMutex);
+  if (const occ::handle<Geom_Surface>* aSurfaceFound = mySurfaces.Seek(theFace))
+  {
+    return *aSurfaceFound;
+  }
+  mySurfaces.Bind(theFace, aSurface);
+  return aSurface;
+}
+
+//=================================================================================================
+
+int BRepCheck_SurfaceCache::Size() const
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  return mySurfaces.Extent();
+}
+
+//=================================================================================================
+
+void BRepCheck_SurfaceCache::Clear()
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  mySurfaces.Clear();
+}
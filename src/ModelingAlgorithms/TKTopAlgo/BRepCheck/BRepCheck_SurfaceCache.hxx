@@ -0,0 +1,55 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BRepCheck_SurfaceCache_HeaderFile
+#define _BRepCheck_SurfaceCache_HeaderFile
+
+#include <Geom_Surface.hxx>
+#include <NCollection_DataMap.hxx>
+#include <TopTools_ShapeMapHasher.hxx>
+#include <TopoDS_Shape.hxx>
+
+#include <mutex>
+
+class TopoDS_Face;
+
+//! Thread-safe cache of surfaces of faces transformed by the location of the face,
+//! shared by the checks of curves on surfaces of the edges (see BRepCheck_Edge::InContext()),
+//! so that the surface is copied once for the face rather than once for each of its edges.
+//! Cached surfaces are not modified and can be evaluated by several threads,
+//! while the adaptors holding evaluation caches should be created by each check.
+class BRepCheck_SurfaceCache : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(BRepCheck_SurfaceCache, Standard_Transient)
+public:
+  //! Creates an empty cache.
+  Standard_EXPORT BRepCheck_SurfaceCache();
+
+  //! Returns the surface of the face transformed by the location of the face,
+  //! computing it on the first request; the location of the edge is not taken into account.
+  //! @param theFace face with surface
+  //! @return transformed surface or null handle for the face without surface
+  Standard_EXPORT occ::handle<Geom_Surface> Surface(const TopoDS_Shape& theFace);
+
+  //! Returns the number of cached surfaces.
+  Standard_EXPORT int Size() const;
+
+  //! Removes all cached surfaces.
+  Standard_EXPORT void Clear();
+
+private:
+  NCollection_DataMap<TopoDS_Shape, occ::handle<Geom_Surface>, TopTools_ShapeMapHasher> mySurfaces;
+  mutable std::mutex                                                                    myMutex;
+};
+
+#endif // _BRepCheck_SurfaceCache_HeaderFile
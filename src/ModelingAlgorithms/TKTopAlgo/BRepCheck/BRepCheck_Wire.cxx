@@ -23,6 +23,7 @@
 //  Modified by skv - Wed Jul 23 12:22:20 2003 OCC1764
 
 #include <Bnd_Box2d.hxx>
+#include <Bnd_Tools.hxx>
 #include <NCollection_Array1.hxx>
 #include <BndLib_Add2dCurve.hxx>
 #include <BRep_Tool.hxx>
@@ -34,6 +35,9 @@
 #include <NCollection_Shared.hxx>
 #include <BRepCheck_Wire.hxx>
 #include <BRepTools_WireExplorer.hxx>
+#include <BVH_BoxSet.hxx>
+#include <BVH_LinearBuilder.hxx>
+#include <BVH_Traverse.hxx>
 #include <ElCLib.hxx>
 #include <Geom2d_Curve.hxx>
 #include <Geom2dAdaptor_Curve.hxx>
@@ -64,10 +68,22 @@
 #include <NCollection_IndexedDataMap.hxx>
 #include <NCollection_IndexedMap.hxx>
 #include <NCollection_Map.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_Parallel.hxx>
 
+#include <algorithm>
+#include <atomic>
 #include <cstdio>
+#include <vector>
 IMPLEMENT_STANDARD_RTTIEXT(BRepCheck_Wire, BRepCheck_Result)
 
+namespace
+{
+//! Default minimal number of edges of the wire to select pairs of edges with interfering boxes
+//! by BVH.
+constexpr int THE_MIN_EDGES_FOR_BVH = 32;
+} // namespace
+
 static void Propagate(const NCollection_IndexedDataMap<TopoDS_Shape,
                                                        NCollection_List<TopoDS_Shape>,
                                                        TopTools_ShapeMapHasher>&,
@@ -120,7 +136,8 @@ static bool GetPnt2d(const TopoDS_Vertex& theVertex,
 BRepCheck_Wire::BRepCheck_Wire(const TopoDS_Wire& W)
     : myCdone(false),
       myCstat(BRepCheck_NoError),
-      myGctrl(false)
+      myGctrl(false),
+      myMinEdgesForBVH(THE_MIN_EDGES_FOR_BVH)
 {
   Init(W);
 }
@@ -1060,665 +1077,817 @@ BRepCheck_Status BRepCheck_Wire::Orientation(const TopoDS_Face& F, const bool Up
   return theOstat;
 }
 
-//=================================================================================================
+namespace
+{
+//! Minimal number of intersection checks to be performed in parallel threads.
+constexpr int THE_MIN_CHECKS_FOR_PARALLEL = 16;
 
-BRepCheck_Status BRepCheck_Wire::SelfIntersect(const TopoDS_Face& F,
-                                               TopoDS_Edge&       retE1,
-                                               TopoDS_Edge&       retE2,
-                                               const bool         Update)
+//! Parametric curve of the edge on the face prepared for intersection.
+struct BRepCheck_EdgeOnFace
 {
-  occ::handle<NCollection_Shared<NCollection_List<BRepCheck_Status>>> aHList;
+  occ::handle<Geom2d_Curve> Curve;
+  IntRes2d_Domain           Domain;
+  Bnd_Box2d                 Box;
+};
+
+typedef BVH_BoxSet<double, 2, int> BRepCheck_BoxSet;
+
+//! Selector of pairs of edges with interfering boxes of parametric curves.
+class BRepCheck_PairSelector : public BVH_PairTraverse<double, 2, BRepCheck_BoxSet>
+{
+public:
+  typedef BVH_Box<double, 2>::BVH_VecNt BVH_Vec2d;
+
+public:
+  //! Constructor.
+  BRepCheck_PairSelector(const NCollection_Array1<BRepCheck_EdgeOnFace>& theCurves)
+      : myCurves(theCurves)
   {
-    std::unique_lock<std::mutex> aLock =
-      myMutex ? std::unique_lock<std::mutex>(*myMutex) : std::unique_lock<std::mutex>();
-    aHList = myMap(myShape);
   }
-  NCollection_List<BRepCheck_Status>& aStatusList = *aHList;
 
-  int                                  i, j, Nbedges;
-  double                               first1, last1, first2, last2, tolint;
-  gp_Pnt2d                             pfirst1, plast1, pfirst2, plast2;
-  gp_Pnt                               P3d, P3d2;
-  occ::handle<BRepAdaptor_Surface>     HS;
-  Geom2dAdaptor_Curve                  C1, C2;
-  Geom2dInt_GInter                     Inter;
-  IntRes2d_Domain                      myDomain1;
-  NCollection_IndexedMap<TopoDS_Shape> EMap;
-  NCollection_Map<TopoDS_Shape>        auxmape;
-  //
-  //-- check with proper tolerances if there is no
-  //-- point in the tolerance of a vertex.
-  tolint = 1.e-10;
-  HS     = new BRepAdaptor_Surface();
-  HS->Initialize(F, false);
-  //
-  for (TopoDS_Iterator Iter1(myShape); Iter1.More(); Iter1.Next())
+  //! Rejects the pair of nodes with separated boxes.
+  bool RejectNode(const BVH_Vec2d& theCMin1,
+                  const BVH_Vec2d& theCMax1,
+                  const BVH_Vec2d& theCMin2,
+                  const BVH_Vec2d& theCMax2,
+                  double&) const override
   {
-    if (Iter1.Value().ShapeType() == TopAbs_EDGE)
+    return BVH_Box<double, 2>(theCMin1, theCMax1).IsOut(theCMin2, theCMax2);
+  }
+
+  //! Accepts the pair of different edges with interfering boxes.
+  bool Accept(const int theID1, const int theID2) override
+  {
+    const int anEdge1 = myBVHSet1->Element(theID1);
+    const int anEdge2 = myBVHSet2->Element(theID2);
+    if (anEdge1 < anEdge2 && !myCurves(anEdge1).Box.IsOut(myCurves(anEdge2).Box))
     {
-      EMap.Add(Iter1.Value());
+      myPairs.push_back(std::make_pair(anEdge1, anEdge2));
+      return true;
     }
+    return false;
   }
-  //
-  Nbedges = EMap.Extent();
-  if (!Nbedges)
+
+  //! Returns the pairs of edges sorted by indices.
+  std::vector<std::pair<int, int>>& Pairs() { return myPairs; }
+
+private:
+  const NCollection_Array1<BRepCheck_EdgeOnFace>& myCurves;
+  std::vector<std::pair<int, int>>                myPairs;
+};
+
+//! Surface of the face evaluated by intersection checks, initialized on first use
+//! as the adaptor cannot be shared by threads.
+class BRepCheck_FaceEvaluator
+{
+public:
+  BRepCheck_FaceEvaluator(const TopoDS_Face& theFace)
+      : myFace(theFace)
   {
-    if (Update)
+  }
+
+  gp_Pnt Value(const gp_Pnt2d& theUV)
+  {
+    if (mySurface.IsNull())
     {
-      BRepCheck::Add(aStatusList, BRepCheck_EmptyWire);
+      mySurface = new BRepAdaptor_Surface();
+      mySurface->Initialize(myFace, false);
     }
-    return (BRepCheck_EmptyWire);
+    return mySurface->Value(theUV.X(), theUV.Y());
   }
+
+private:
+  const TopoDS_Face&               myFace;
+  occ::handle<BRepAdaptor_Surface> mySurface;
+};
+} // namespace
+
+//=======================================================================
+// function : IsSelfIntersected
+// purpose  : Returns true if the edge intersects itself
+//            out of the tolerance of its vertices
+//=======================================================================
+static bool IsSelfIntersected(const TopoDS_Edge&          E1,
+                              const BRepCheck_EdgeOnFace& theCurve,
+                              BRepCheck_FaceEvaluator&    theSurf)
+{
+  constexpr double    tolint = 1.e-10;
+  gp_Pnt              P3d;
+  Geom2dAdaptor_Curve C1(theCurve.Curve);
+  Geom2dInt_GInter    Inter;
+  Inter.Perform(C1, theCurve.Domain, tolint, tolint);
   //
-  IntRes2d_Domain*                              tabDom = new IntRes2d_Domain[Nbedges];
-  NCollection_Array1<occ::handle<Geom2d_Curve>> tabCur(1, Nbedges);
-  NCollection_Array1<Bnd_Box2d>                 boxes(1, Nbedges);
-  //
-  for (i = 1; i <= Nbedges; i++)
+  if (Inter.IsDone())
   {
-    const TopoDS_Edge& E1 = TopoDS::Edge(EMap.FindKey(i));
-    if (i == 1)
+    int nbp = Inter.NbPoints();
+    // int nbs = Inter.NbSegments();
+    //
+    for (int p = 1; p <= nbp; p++)
     {
-      occ::handle<Geom2d_Curve> pcu = BRep_Tool::CurveOnSurface(E1, F, first1, last1);
-      if (pcu.IsNull())
+      const IntRes2d_IntersectionPoint& IP  = Inter.Point(p);
+      const IntRes2d_Transition&        Tr1 = IP.TransitionOfFirst();
+      const IntRes2d_Transition&        Tr2 = IP.TransitionOfSecond();
+      if (Tr1.PositionOnCurve() == IntRes2d_Middle || Tr2.PositionOnCurve() == IntRes2d_Middle)
       {
-        retE1 = E1;
-        if (Update)
+        //-- Checking of points with true tolerances (ie Tol in 3d)
+        //-- If the point of intersection is within the tolerance of a vertex
+        //-- this intersection is considered correct (no error)
+        bool                          localok = false;
+        double                        f, l;
+        TopLoc_Location               L;
+        const occ::handle<Geom_Curve> ConS = BRep_Tool::Curve(E1, L, f, l);
+        if (!ConS.IsNull())
         {
-          BRepCheck::Add(aStatusList, BRepCheck_SelfIntersectingWire);
+          //-- try to test in 3d. (ParamOnSecond gives the same result)
+          P3d = ConS->Value(IP.ParamOnFirst());
+          P3d.Transform(L.Transformation());
+          //  Modified by Sergey KHROMOV - Mon Apr 15 12:34:22 2002 Begin
         }
-        delete[] tabDom;
-        return (BRepCheck_SelfIntersectingWire);
-      }
-      //
-      C1.Load(pcu);
-      // To avoid exception in Segment if C1 is BSpline - IFV
-      if (!C1.IsPeriodic())
-      {
-        if (C1.FirstParameter() > first1)
+        else
         {
-          first1 = C1.FirstParameter();
+          gp_Pnt2d aP2d = C1.Value(IP.ParamOnFirst());
+          P3d           = theSurf.Value(aP2d);
         }
-        if (C1.LastParameter() < last1)
+        //  Modified by Sergey KHROMOV - Mon Apr 15 12:34:22 2002 End
+        TopExp_Explorer ExplVtx;
+        for (ExplVtx.Init(E1, TopAbs_VERTEX); localok == false && ExplVtx.More(); ExplVtx.Next())
         {
-          last1 = C1.LastParameter();
+          gp_Pnt p3dvtt;
+          double tolvtt, p3dvttDistanceP3d;
+          //
+          const TopoDS_Vertex& vtt = TopoDS::Vertex(ExplVtx.Current());
+          p3dvtt                   = BRep_Tool::Pnt(vtt);
+          tolvtt                   = BRep_Tool::Tolerance(vtt);
+          tolvtt                   = tolvtt * tolvtt;
+          p3dvttDistanceP3d        = p3dvtt.SquareDistance(P3d);
+          if (p3dvttDistanceP3d <= tolvtt)
+          {
+            localok = true;
+          }
+        }
+        if (localok == false)
+        {
+#ifdef OCCT_DEBUG
+          std::cout << "point p " << P3d.X() << " " << P3d.Y() << " " << P3d.Z() << std::endl;
+          std::cout.flush();
+#endif
+          return true;
         }
       }
-      //
-      BRep_Tool::UVPoints(E1, F, pfirst1, plast1);
-      myDomain1.SetValues(pfirst1, first1, tolint, plast1, last1, tolint);
-      //
-      BndLib_Add2dCurve::Add(C1, first1, last1, Precision::PConfusion(), boxes(i));
-    } // if (i == 1) {
-    else
-    {
-      C1.Load(tabCur(i));
-      myDomain1 = tabDom[i - 1];
     }
+  }
+  return false;
+}
+
+//=======================================================================
+// function : AreIntersected
+// purpose  : Returns true if the edges intersect each other
+//            out of the tolerance of their common vertices
+//=======================================================================
+static bool AreIntersected(const TopoDS_Edge&          E1,
+                           const BRepCheck_EdgeOnFace& theCurve1,
+                           const TopoDS_Edge&          E2,
+                           const BRepCheck_EdgeOnFace& theCurve2,
+                           BRepCheck_FaceEvaluator&    theSurf)
+{
+  constexpr double    tolint = 1.e-10;
+  gp_Pnt              P3d, P3d2;
+  Geom2dAdaptor_Curve C1(theCurve1.Curve), C2(theCurve2.Curve);
+  Geom2dInt_GInter    Inter;
+  Inter.Perform(C1, theCurve1.Domain, C2, theCurve2.Domain, tolint, tolint);
+  //
+  if (Inter.IsDone())
+  {
+    int                                                    nbp, nbs;
+    double                                                 IP_ParamOnFirst, IP_ParamOnSecond;
+    IntRes2d_Transition                                    Tr1, Tr2;
+    NCollection_List<TopoDS_Shape>                         CommonVertices;
+    NCollection_List<TopoDS_Shape>::Iterator               itl;
+    NCollection_Map<TopoDS_Shape, TopTools_ShapeMapHasher> Vmap;
     //
-    // Self intersect of C1
-    Inter.Perform(C1, myDomain1, tolint, tolint);
+    TopoDS_Iterator it(E1);
+    for (; it.More(); it.Next())
+    {
+      Vmap.Add(it.Value());
+    }
     //
-    if (Inter.IsDone())
+    it.Initialize(E2);
+    for (; it.More(); it.Next())
     {
-      int nbp = Inter.NbPoints();
-      // int nbs = Inter.NbSegments();
-      //
-      for (int p = 1; p <= nbp; p++)
+      const TopoDS_Shape& V = it.Value();
+      if (Vmap.Contains(V))
       {
-        const IntRes2d_IntersectionPoint& IP  = Inter.Point(p);
-        const IntRes2d_Transition&        Tr1 = IP.TransitionOfFirst();
-        const IntRes2d_Transition&        Tr2 = IP.TransitionOfSecond();
-        if (Tr1.PositionOnCurve() == IntRes2d_Middle || Tr2.PositionOnCurve() == IntRes2d_Middle)
-        {
-          //-- Checking of points with true tolerances (ie Tol in 3d)
-          //-- If the point of intersection is within the tolerance of a vertex
-          //-- this intersection is considered correct (no error)
-          bool                          localok = false;
-          double                        f, l;
-          TopLoc_Location               L;
-          const occ::handle<Geom_Curve> ConS = BRep_Tool::Curve(E1, L, f, l);
-          if (!ConS.IsNull())
-          {
-            //-- try to test in 3d. (ParamOnSecond gives the same result)
-            P3d = ConS->Value(IP.ParamOnFirst());
-            P3d.Transform(L.Transformation());
-            //  Modified by Sergey KHROMOV - Mon Apr 15 12:34:22 2002 Begin
-          }
-          else
-          {
-            gp_Pnt2d aP2d = C1.Value(IP.ParamOnFirst());
-            P3d           = HS->Value(aP2d.X(), aP2d.Y());
-          }
-          //  Modified by Sergey KHROMOV - Mon Apr 15 12:34:22 2002 End
-          TopExp_Explorer ExplVtx;
-          for (ExplVtx.Init(E1, TopAbs_VERTEX); localok == false && ExplVtx.More(); ExplVtx.Next())
-          {
-            gp_Pnt p3dvtt;
-            double tolvtt, p3dvttDistanceP3d;
-            //
-            const TopoDS_Vertex& vtt = TopoDS::Vertex(ExplVtx.Current());
-            p3dvtt                   = BRep_Tool::Pnt(vtt);
-            tolvtt                   = BRep_Tool::Tolerance(vtt);
-            tolvtt                   = tolvtt * tolvtt;
-            p3dvttDistanceP3d        = p3dvtt.SquareDistance(P3d);
-            if (p3dvttDistanceP3d <= tolvtt)
-            {
-              localok = true;
-            }
-          }
-          if (localok == false)
-          {
-            retE1 = E1;
-            if (Update)
-            {
-              BRepCheck::Add(aStatusList, BRepCheck_SelfIntersectingWire);
-            }
-            delete[] tabDom;
-#ifdef OCCT_DEBUG
-            static int numpoint = 0;
-            std::cout << "point p" << ++numpoint << " " << P3d.X() << " " << P3d.Y() << " "
-                      << P3d.Z() << std::endl;
-            std::cout.flush();
-#endif
-            return (BRepCheck_SelfIntersectingWire);
-          }
-        }
+        CommonVertices.Append(V);
       }
-    } // if(Inter.IsDone()) {
+    }
+    //
+    nbp              = Inter.NbPoints();
+    nbs              = Inter.NbSegments();
+    IP_ParamOnFirst  = 0.;
+    IP_ParamOnSecond = 0.;
     //
-    for (j = i + 1; j <= Nbedges; j++)
+    //// **** Points of intersection **** ////
+    for (int p = 1; p <= nbp; p++)
     {
-      const TopoDS_Edge& E2 = TopoDS::Edge(EMap.FindKey(j));
-      if (i == 1)
+      const IntRes2d_IntersectionPoint& IP = Inter.Point(p);
+      IP_ParamOnFirst                      = IP.ParamOnFirst();
+      IP_ParamOnSecond                     = IP.ParamOnSecond();
+      Tr1                                  = IP.TransitionOfFirst();
+      Tr2                                  = IP.TransitionOfSecond();
+      if (Tr1.PositionOnCurve() == IntRes2d_Middle || Tr2.PositionOnCurve() == IntRes2d_Middle)
       {
-        tabCur(j) = BRep_Tool::CurveOnSurface(E2, F, first2, last2);
-        if (!tabCur(j).IsNull() && last2 > first2)
+        //-- Checking of points with true tolerances (ie Tol in 3d)
+        //-- If the point of intersection is within the tolerance of a vertex
+        //-- this intersection is considered correct (no error)
+        bool            localok = false;
+        double          f1, l1, f2, l2;
+        TopLoc_Location L, L2;
+        //
+        const occ::handle<Geom_Curve> ConS  = BRep_Tool::Curve(E1, L, f1, l1);
+        const occ::handle<Geom_Curve> ConS2 = BRep_Tool::Curve(E2, L2, f2, l2);
+        // gka protect against working out of edge range
+        if (f1 - IP_ParamOnFirst > ::Precision::PConfusion()
+            || IP_ParamOnFirst - l1 > ::Precision::PConfusion()
+            || f2 - IP_ParamOnSecond > ::Precision::PConfusion()
+            || IP_ParamOnSecond - l2 > ::Precision::PConfusion())
+          continue;
+        double tolvtt = 0.;
+        //  Modified by Sergey KHROMOV - Mon Apr 15 12:34:22 2002 Begin
+        if (!ConS.IsNull())
         {
-          C2.Load(tabCur(j));
-          // To avoid exception in Segment if C2 is BSpline - IFV
-          if (!C2.IsPeriodic())
-          {
-            if (C2.FirstParameter() > first2)
-            {
-              first2 = C2.FirstParameter();
-            }
-            if (C2.LastParameter() < last2)
-            {
-              last2 = C2.LastParameter();
-            }
-          }
-          //
-          BRep_Tool::UVPoints(E2, F, pfirst2, plast2);
-          tabDom[j - 1].SetValues(pfirst2, first2, tolint, plast2, last2, tolint);
-
-          BndLib_Add2dCurve::Add(C2, first2, last2, Precision::PConfusion(), boxes(j));
+          P3d = ConS->Value(IP_ParamOnFirst);
+          P3d.Transform(L.Transformation());
         }
         else
         {
-          delete[] tabDom;
-#ifdef OCCT_DEBUG
-          std::cout << "BRepCheck_NoCurveOnSurface or BRepCheck_InvalidRange" << std::endl;
-          std::cout.flush();
-#endif
-          if (tabCur(j).IsNull())
-          {
-            return (BRepCheck_NoCurveOnSurface);
-          }
-          return (BRepCheck_InvalidRange);
+          gp_Pnt2d aP2d = C1.Value(IP_ParamOnFirst);
+          P3d           = theSurf.Value(aP2d);
         }
-      } // if (i == 1) {
-      else
-      {
-        C2.Load(tabCur(j));
-      }
-      //
-      if (boxes(i).IsOut(boxes(j)))
-      {
-        continue;
-      }
-      // modified by NIZNHY-PKV Fri Oct 29 10:09:01 2010f
-      if (E1.IsSame(E2))
-      {
-        continue;
-      }
-      // modified by NIZNHY-PKV Fri Oct 29 10:09:02 2010t
-      //
-      //-- ************************************************************
-      //-- ******* I n t e r s e c t i o n   C 1   and   C 2   ********
-      //-- ************************************************************
-      Inter.Perform(C1, myDomain1, C2, tabDom[j - 1], tolint, tolint);
-      //
-      if (Inter.IsDone())
-      {
-        int                                                    nbp, nbs;
-        double                                                 IP_ParamOnFirst, IP_ParamOnSecond;
-        IntRes2d_Transition                                    Tr1, Tr2;
-        NCollection_List<TopoDS_Shape>                         CommonVertices;
-        NCollection_List<TopoDS_Shape>::Iterator               itl;
-        NCollection_Map<TopoDS_Shape, TopTools_ShapeMapHasher> Vmap;
         //
-        TopoDS_Iterator it(E1);
-        for (; it.More(); it.Next())
+        if (!ConS2.IsNull())
         {
-          Vmap.Add(it.Value());
+          P3d2 = ConS2->Value(IP_ParamOnSecond);
+          P3d2.Transform(L2.Transformation());
         }
-        //
-        it.Initialize(E2);
-        for (; it.More(); it.Next())
+        else
+        {
+          gp_Pnt2d aP2d = C2.Value(IP_ParamOnSecond);
+          P3d2          = theSurf.Value(aP2d);
+        }
+        //  Modified by Sergey KHROMOV - Mon Apr 15 12:34:22 2002 End
+        itl.Initialize(CommonVertices);
+        for (; itl.More(); itl.Next())
         {
-          const TopoDS_Shape& V = it.Value();
-          if (Vmap.Contains(V))
+          double p3dvttDistanceP3d, p3dvttDistanceP3d2;
+          gp_Pnt p3dvtt;
+          //
+          const TopoDS_Vertex& vtt = TopoDS::Vertex(itl.Value());
+          p3dvtt                   = BRep_Tool::Pnt(vtt);
+          tolvtt                   = BRep_Tool::Tolerance(vtt);
+          tolvtt                   = 1.1 * tolvtt;
+          tolvtt                   = tolvtt * tolvtt;
+          p3dvttDistanceP3d        = p3dvtt.SquareDistance(P3d);
+          p3dvttDistanceP3d2       = p3dvtt.SquareDistance(P3d2);
+          //
+          if (p3dvttDistanceP3d <= tolvtt && p3dvttDistanceP3d2 <= tolvtt)
           {
-            CommonVertices.Append(V);
+            localok = true;
+            break;
           }
         }
-        //
-        nbp              = Inter.NbPoints();
-        nbs              = Inter.NbSegments();
-        IP_ParamOnFirst  = 0.;
-        IP_ParamOnSecond = 0.;
-        //
-        //// **** Points of intersection **** ////
-        for (int p = 1; p <= nbp; p++)
+
+        //-- --------------------------------------------------------
+        //-- Check maximum yawn between 2 edges
+        //--
+        //-- Check distance from edges to the curve joining
+        //-- the point of intersection with vertex (if exists)
+        if (localok == false && !CommonVertices.IsEmpty())
         {
-          const IntRes2d_IntersectionPoint& IP = Inter.Point(p);
-          IP_ParamOnFirst                      = IP.ParamOnFirst();
-          IP_ParamOnSecond                     = IP.ParamOnSecond();
-          Tr1                                  = IP.TransitionOfFirst();
-          Tr2                                  = IP.TransitionOfSecond();
-          if (Tr1.PositionOnCurve() == IntRes2d_Middle || Tr2.PositionOnCurve() == IntRes2d_Middle)
+#ifdef OCCT_DEBUG
+          std::cout << "\n------------------------------------------------------\n"
+                    << std::endl;
+          std::cout << "\n--- BRepCheck Wire: AutoIntersection Phase1 -> Erreur \n"
+                    << std::endl;
+
+#endif
+          double distauvtxleplusproche, VParaOnEdge1, VParaOnEdge2;
+          gp_Pnt VertexLePlusProche;
+          //
+          VParaOnEdge1          = 0.;
+          VParaOnEdge2          = 0.;
+          distauvtxleplusproche = RealLast();
+          // Find the nearest common vertex
+          itl.Initialize(CommonVertices);
+          for (; itl.More(); itl.Next())
           {
-            //-- Checking of points with true tolerances (ie Tol in 3d)
-            //-- If the point of intersection is within the tolerance of a vertex
-            //-- this intersection is considered correct (no error)
-            bool            localok = false;
-            double          f1, l1, f2, l2;
-            TopLoc_Location L, L2;
-            //
-            const occ::handle<Geom_Curve> ConS  = BRep_Tool::Curve(E1, L, f1, l1);
-            const occ::handle<Geom_Curve> ConS2 = BRep_Tool::Curve(E2, L2, f2, l2);
-            // gka protect against working out of edge range
-            if (f1 - IP_ParamOnFirst > ::Precision::PConfusion()
-                || IP_ParamOnFirst - l1 > ::Precision::PConfusion()
-                || f2 - IP_ParamOnSecond > ::Precision::PConfusion()
-                || IP_ParamOnSecond - l2 > ::Precision::PConfusion())
-              continue;
-            double tolvtt = 0.;
-            //  Modified by Sergey KHROMOV - Mon Apr 15 12:34:22 2002 Begin
-            if (!ConS.IsNull())
-            {
-              P3d = ConS->Value(IP_ParamOnFirst);
-              P3d.Transform(L.Transformation());
-            }
-            else
-            {
-              gp_Pnt2d aP2d = C1.Value(IP_ParamOnFirst);
-              P3d           = HS->Value(aP2d.X(), aP2d.Y());
-            }
+            double disptvtx;
+            gp_Pnt p3dvtt;
             //
-            if (!ConS2.IsNull())
-            {
-              P3d2 = ConS2->Value(IP_ParamOnSecond);
-              P3d2.Transform(L2.Transformation());
-            }
-            else
+            const TopoDS_Vertex& vtt = TopoDS::Vertex(itl.Value());
+            p3dvtt                   = BRep_Tool::Pnt(vtt);
+            disptvtx                 = P3d.Distance(p3dvtt);
+            if (disptvtx < distauvtxleplusproche)
             {
-              gp_Pnt2d aP2d = C2.Value(IP_ParamOnSecond);
-              P3d2          = HS->Value(aP2d.X(), aP2d.Y());
+              VertexLePlusProche    = p3dvtt;
+              distauvtxleplusproche = disptvtx;
+              VParaOnEdge1          = BRep_Tool::Parameter(vtt, E1);
+              VParaOnEdge2          = BRep_Tool::Parameter(vtt, E2);
             }
-            //  Modified by Sergey KHROMOV - Mon Apr 15 12:34:22 2002 End
-            itl.Initialize(CommonVertices);
-            for (; itl.More(); itl.Next())
+            // eap: case of closed edge
+            else if (IsEqual(distauvtxleplusproche, disptvtx))
             {
-              double p3dvttDistanceP3d, p3dvttDistanceP3d2;
-              gp_Pnt p3dvtt;
-              //
-              const TopoDS_Vertex& vtt = TopoDS::Vertex(itl.Value());
-              p3dvtt                   = BRep_Tool::Pnt(vtt);
-              tolvtt                   = BRep_Tool::Tolerance(vtt);
-              tolvtt                   = 1.1 * tolvtt;
-              tolvtt                   = tolvtt * tolvtt;
-              p3dvttDistanceP3d        = p3dvtt.SquareDistance(P3d);
-              p3dvttDistanceP3d2       = p3dvtt.SquareDistance(P3d2);
-              //
-              if (p3dvttDistanceP3d <= tolvtt && p3dvttDistanceP3d2 <= tolvtt)
+              double newVParaOnEdge1 = BRep_Tool::Parameter(vtt, E1);
+              double newVParaOnEdge2 = BRep_Tool::Parameter(vtt, E2);
+              if (std::abs(IP_ParamOnFirst - VParaOnEdge1)
+                    + std::abs(IP_ParamOnSecond - VParaOnEdge2)
+                  > std::abs(IP_ParamOnFirst - newVParaOnEdge1)
+                      + std::abs(IP_ParamOnSecond - newVParaOnEdge2))
               {
-                localok = true;
-                break;
+                VertexLePlusProche = p3dvtt;
+                VParaOnEdge1       = newVParaOnEdge1;
+                VParaOnEdge2       = newVParaOnEdge2;
               }
             }
-
-            //-- --------------------------------------------------------
-            //-- Check maximum yawn between 2 edges
-            //--
-            //-- Check distance from edges to the curve joining
-            //-- the point of intersection with vertex (if exists)
-            if (localok == false && !CommonVertices.IsEmpty())
+          }
+          // Patch: extraordinar situation (e.g. tolerance(v) == 0.)
+          //   Modified by skv - Wed Jul 23 12:28:11 2003 OCC1764 Begin
+          //  if (VertexLePlusProche.Distance( P3d ) <= gp::Resolution())
+          if (VertexLePlusProche.Distance(P3d) <= gp::Resolution()
+              || VertexLePlusProche.Distance(P3d2) <= gp::Resolution())
+          {
+            //  Modified by skv - Wed Jul 23 12:28:12 2003 OCC1764 End
+            localok = true;
+          }
+          else
+          {
+            gp_Lin Lig(VertexLePlusProche, gp_Vec(VertexLePlusProche, P3d));
+            double du1   = 0.1 * (IP_ParamOnFirst - VParaOnEdge1);
+            double du2   = 0.1 * (IP_ParamOnSecond - VParaOnEdge2);
+            double maxd1 = 0., maxd2 = 0.;
+            int    k;
+
+            localok      = true;
+            double tole1 = BRep_Tool::Tolerance(E1);
+            for (k = 2; localok && k < 9; k++)
             {
-#ifdef OCCT_DEBUG
-              std::cout << "\n------------------------------------------------------\n"
-                        << std::endl;
-              std::cout << "\n--- BRepCheck Wire: AutoIntersection Phase1 -> Erreur \n"
-                        << std::endl;
-
-#endif
-              double distauvtxleplusproche, VParaOnEdge1, VParaOnEdge2;
-              gp_Pnt VertexLePlusProche;
-              //
-              VParaOnEdge1          = 0.;
-              VParaOnEdge2          = 0.;
-              distauvtxleplusproche = RealLast();
-              // Find the nearest common vertex
-              itl.Initialize(CommonVertices);
-              for (; itl.More(); itl.Next())
-              {
-                double disptvtx;
-                gp_Pnt p3dvtt;
-                //
-                const TopoDS_Vertex& vtt = TopoDS::Vertex(itl.Value());
-                p3dvtt                   = BRep_Tool::Pnt(vtt);
-                disptvtx                 = P3d.Distance(p3dvtt);
-                if (disptvtx < distauvtxleplusproche)
-                {
-                  VertexLePlusProche    = p3dvtt;
-                  distauvtxleplusproche = disptvtx;
-                  VParaOnEdge1          = BRep_Tool::Parameter(vtt, E1);
-                  VParaOnEdge2          = BRep_Tool::Parameter(vtt, E2);
-                }
-                // eap: case of closed edge
-                else if (IsEqual(distauvtxleplusproche, disptvtx))
-                {
-                  double newVParaOnEdge1 = BRep_Tool::Parameter(vtt, E1);
-                  double newVParaOnEdge2 = BRep_Tool::Parameter(vtt, E2);
-                  if (std::abs(IP_ParamOnFirst - VParaOnEdge1)
-                        + std::abs(IP_ParamOnSecond - VParaOnEdge2)
-                      > std::abs(IP_ParamOnFirst - newVParaOnEdge1)
-                          + std::abs(IP_ParamOnSecond - newVParaOnEdge2))
-                  {
-                    VertexLePlusProche = p3dvtt;
-                    VParaOnEdge1       = newVParaOnEdge1;
-                    VParaOnEdge2       = newVParaOnEdge2;
-                  }
-                }
-              }
-              // Patch: extraordinar situation (e.g. tolerance(v) == 0.)
-              //   Modified by skv - Wed Jul 23 12:28:11 2003 OCC1764 Begin
-              //  if (VertexLePlusProche.Distance( P3d ) <= gp::Resolution())
-              if (VertexLePlusProche.Distance(P3d) <= gp::Resolution()
-                  || VertexLePlusProche.Distance(P3d2) <= gp::Resolution())
+              double u = VParaOnEdge1 + k * du1; // check if it works
+              gp_Pnt P1;
+              //  Modified by Sergey KHROMOV - Mon Apr 15 12:34:22 2002 Begin
+              if (!ConS.IsNull())
               {
-                //  Modified by skv - Wed Jul 23 12:28:12 2003 OCC1764 End
-                localok = true;
+                P1 = ConS->Value(u);
+                P1.Transform(L.Transformation());
               }
               else
               {
-                gp_Lin Lig(VertexLePlusProche, gp_Vec(VertexLePlusProche, P3d));
-                double du1   = 0.1 * (IP_ParamOnFirst - VParaOnEdge1);
-                double du2   = 0.1 * (IP_ParamOnSecond - VParaOnEdge2);
-                double maxd1 = 0., maxd2 = 0.;
-                int    k;
-
-                localok      = true;
-                double tole1 = BRep_Tool::Tolerance(E1);
-                for (k = 2; localok && k < 9; k++)
-                {
-                  double u = VParaOnEdge1 + k * du1; // check if it works
-                  gp_Pnt P1;
-                  //  Modified by Sergey KHROMOV - Mon Apr 15 12:34:22 2002 Begin
-                  if (!ConS.IsNull())
-                  {
-                    P1 = ConS->Value(u);
-                    P1.Transform(L.Transformation());
-                  }
-                  else
-                  {
-                    gp_Pnt2d aP2d = C1.Value(u);
-                    P1            = HS->Value(aP2d.X(), aP2d.Y());
-                  }
-                  //  Modified by Sergey KHROMOV - Mon Apr 15 12:34:22 2002 End
-                  double d1 = Lig.Distance(P1);
-                  if (d1 > maxd1)
-                  {
-                    maxd1 = d1;
-                  }
-                  if (d1 > tole1 * 2.0)
-                  {
-                    localok = false;
-                  }
-                }
-                //-- same for edge2
-                //  Modified by skv - Wed Jul 23 12:22:20 2003 OCC1764 Begin
-                gp_Dir aTmpDir(P3d2.XYZ().Subtracted(VertexLePlusProche.XYZ()));
-
-                Lig.SetDirection(aTmpDir);
-                //  Modified by skv - Wed Jul 23 12:22:23 2003 OCC1764 End
-                double tole2 = BRep_Tool::Tolerance(E2);
-                for (k = 2; localok && k < 9; k++)
-                {
-                  double u = VParaOnEdge2 + k * du2; // check if it works
-                  gp_Pnt P2;
-                  //  Modified by Sergey KHROMOV - Mon Apr 15 12:34:22 2002 Begin
-                  if (!ConS2.IsNull())
-                  {
-                    P2 = ConS2->Value(u);
-                    P2.Transform(L2.Transformation());
-                  }
-                  else
-                  {
-                    gp_Pnt2d aP2d = C2.Value(u);
-                    P2            = HS->Value(aP2d.X(), aP2d.Y());
-                  }
-                  //  Modified by Sergey KHROMOV - Mon Apr 15 12:34:22 2002 End
-                  double d2 = Lig.Distance(P2);
-                  if (d2 > maxd2)
-                  {
-                    maxd2 = d2;
-                  }
-                  if (d2 > tole2 * 2.0)
-                  {
-                    localok = false;
-                  }
-                }
-#ifdef OCCT_DEBUG
-                if (localok)
-                {
-                  printf("--- BRepCheck Wire: AutoIntersection Phase2 -> Bon \n");
-                  printf("--- distance Point Vertex : %10.7g (tol %10.7g)\n",
-                         distauvtxleplusproche,
-                         tolvtt);
-                  printf("--- Erreur Max sur E1 : %10.7g  Tol_Edge:%10.7g\n", maxd1, tole1);
-                  printf("--- Erreur Max sur E2 : %10.7g  Tol_Edge:%10.7g\n", maxd2, tole2);
-                  fflush(stdout);
-                }
-                else
-                {
-                  printf("--- BRepCheck Wire: AutoIntersection Phase2 -> Erreur \n");
-                  printf("--- distance Point Vertex : %10.7g (tol %10.7g)\n",
-                         distauvtxleplusproche,
-                         tolvtt);
-                  printf("--- Erreur Max sur E1 : %10.7g  Tol_Edge:%10.7g\n", maxd1, tole1);
-                  printf("--- Erreur Max sur E2 : %10.7g  Tol_Edge:%10.7g\n", maxd2, tole2);
-                  fflush(stdout);
-                }
-#endif
-              } // end of else (construction of the line Lig)
-            } // end of if (localok == false && !CommonVertices.IsEmpty())
-            //
-            if (localok == false)
-            {
-              retE1 = E1;
-              retE2 = E2;
-              if (Update)
-              {
-                BRepCheck::Add(aStatusList, BRepCheck_SelfIntersectingWire);
-              }
-#ifdef OCCT_DEBUG
-              static int numpoint1 = 0;
-              std::cout << "point p" << ++numpoint1 << " " << P3d.X() << " " << P3d.Y() << " "
-                        << P3d.Z() << std::endl;
-              std::cout.flush();
-#endif
-              delete[] tabDom;
-              return (BRepCheck_SelfIntersectingWire);
-            } //-- localok == False
-          } // end of if(Tr1.PositionOnCurve() == IntRes2d_Middle || Tr2.PositionOnCurve() ==
-            // IntRes2d_Middle)
-        } // end of for (int p=1; p <= nbp; p++)
-        ////
-        //// **** Segments of intersection **** ////
-        for (int s = 1; s <= nbs; ++s)
-        {
-          const IntRes2d_IntersectionSegment& Seg = Inter.Segment(s);
-          if (Seg.HasFirstPoint() && Seg.HasLastPoint())
-          {
-            bool                       localok;
-            int                        k;
-            IntRes2d_IntersectionPoint PSeg[2];
-            IntRes2d_Position          aPCR1, aPCR2;
-            //
-            localok = false;
-            PSeg[0] = Seg.FirstPoint();
-            PSeg[1] = Seg.LastPoint();
-            // At least one of extremities of the segment must be inside
-            // the tolerance of a common vertex
-            for (k = 0; k < 2; ++k)
-            {
-              IP_ParamOnFirst  = PSeg[k].ParamOnFirst();
-              IP_ParamOnSecond = PSeg[k].ParamOnSecond();
-              Tr1              = PSeg[k].TransitionOfFirst();
-              Tr2              = PSeg[k].TransitionOfSecond();
-              aPCR1            = Tr1.PositionOnCurve();
-              aPCR2            = Tr2.PositionOnCurve();
-              //
-              if (aPCR1 != IntRes2d_Middle && aPCR2 != IntRes2d_Middle)
-              {
-                GeomAbs_CurveType aCT1, aCT2;
-                // ZZ
-                aCT1 = C1.GetType();
-                aCT2 = C2.GetType();
-                if (aCT1 == GeomAbs_Line && aCT2 == GeomAbs_Line)
-                {
-                  // check for the two lines coincidence
-                  double   aPAR_T, aT11, aT12, aT21, aT22, aT1m, aT2m;
-                  double   aD2, aTolE1, aTolE2, aTol2;
-                  gp_Lin2d aL1, aL2;
-                  gp_Pnt2d aP1m;
-                  //
-                  aPAR_T = 0.43213918;
-                  //
-                  aTolE1 = BRep_Tool::Tolerance(E1);
-                  aTolE2 = BRep_Tool::Tolerance(E2);
-                  aTol2  = aTolE1 + aTolE2;
-                  aTol2  = aTol2 * aTol2;
-                  //
-                  aL1 = C1.Line();
-                  aL2 = C2.Line();
-                  //
-                  aT11 = PSeg[0].ParamOnFirst();
-                  aT12 = PSeg[1].ParamOnFirst();
-                  aT21 = PSeg[0].ParamOnSecond();
-                  aT22 = PSeg[1].ParamOnSecond();
-                  //
-                  aT1m = (1. - aPAR_T) * aT11 + aPAR_T * aT12;
-                  aP1m = C1.Value(aT1m);
-                  //
-                  aD2 = aL2.SquareDistance(aP1m);
-                  if (aD2 < aTol2)
-                  {
-                    aT2m = ElCLib::Parameter(aL2, aP1m);
-                    if (aT2m > aT21 && aT2m < aT22)
-                    {
-                      const gp_Dir2d& aDir1 = aL1.Direction();
-                      const gp_Dir2d& aDir2 = aL2.Direction();
-                      if (aDir1.IsParallel(aDir2, Precision::Angular()))
-                      {
-                        localok = false;
-                        break; // from for (k = 0; k < 2; ++k){...
-                      }
-                    } // if (aT2m>aT21 && aT2m<aT22) {
-                  } // if (aD2<aTol2) {
-                } // if (aCT1==GeomAbs_Line && aCT2==GeomAbs_Line) {
-                // ZZ
-                localok = true;
-                break;
+                gp_Pnt2d aP2d = C1.Value(u);
+                P1            = theSurf.Value(aP2d);
               }
-              //
-              double                         f, l, tolvtt;
-              TopLoc_Location                L, L2;
-              const occ::handle<Geom_Curve>& ConS  = BRep_Tool::Curve(E1, L, f, l);
-              const occ::handle<Geom_Curve>& ConS2 = BRep_Tool::Curve(E2, L2, f, l);
-              //  Modified by Sergey KHROMOV - Mon Apr 15 12:34:22 2002 Begin
-              if (!ConS.IsNull())
+              //  Modified by Sergey KHROMOV - Mon Apr 15 12:34:22 2002 End
+              double d1 = Lig.Distance(P1);
+              if (d1 > maxd1)
               {
-                P3d = ConS->Value(IP_ParamOnFirst);
-                P3d.Transform(L.Transformation());
+                maxd1 = d1;
               }
-              else
+              if (d1 > tole1 * 2.0)
               {
-                gp_Pnt2d aP2d = C1.Value(IP_ParamOnFirst);
-                P3d           = HS->Value(aP2d.X(), aP2d.Y());
+                localok = false;
               }
+            }
+            //-- same for edge2
+            //  Modified by skv - Wed Jul 23 12:22:20 2003 OCC1764 Begin
+            gp_Dir aTmpDir(P3d2.XYZ().Subtracted(VertexLePlusProche.XYZ()));
+
+            Lig.SetDirection(aTmpDir);
+            //  Modified by skv - Wed Jul 23 12:22:23 2003 OCC1764 End
+            double tole2 = BRep_Tool::Tolerance(E2);
+            for (k = 2; localok && k < 9; k++)
+            {
+              double u = VParaOnEdge2 + k * du2; // check if it works
+              gp_Pnt P2;
+              //  Modified by Sergey KHROMOV - Mon Apr 15 12:34:22 2002 Begin
               if (!ConS2.IsNull())
               {
-                P3d2 = ConS2->Value(IP_ParamOnSecond);
-                P3d2.Transform(L2.Transformation());
+                P2 = ConS2->Value(u);
+                P2.Transform(L2.Transformation());
               }
               else
               {
-                gp_Pnt2d aP2d = C2.Value(IP_ParamOnSecond);
-                P3d2          = HS->Value(aP2d.X(), aP2d.Y());
+                gp_Pnt2d aP2d = C2.Value(u);
+                P2            = theSurf.Value(aP2d);
               }
               //  Modified by Sergey KHROMOV - Mon Apr 15 12:34:22 2002 End
-              itl.Initialize(CommonVertices);
-              for (; itl.More(); itl.Next())
+              double d2 = Lig.Distance(P2);
+              if (d2 > maxd2)
               {
-                double p3dvttDistanceP3d, p3dvttDistanceP3d2;
-                gp_Pnt p3dvtt;
-                //
-                const TopoDS_Vertex& vtt = TopoDS::Vertex(itl.Value());
-                p3dvtt                   = BRep_Tool::Pnt(vtt);
-                tolvtt                   = BRep_Tool::Tolerance(vtt);
-                tolvtt                   = 1.1 * tolvtt;
-                tolvtt                   = tolvtt * tolvtt;
-                p3dvttDistanceP3d        = p3dvtt.SquareDistance(P3d);
-                p3dvttDistanceP3d2       = p3dvtt.SquareDistance(P3d2);
-                if (p3dvttDistanceP3d <= tolvtt && p3dvttDistanceP3d2 <= tolvtt)
-                {
-                  localok = true;
-                  break;
-                }
+                maxd2 = d2;
               }
-              if (localok == true)
+              if (d2 > tole2 * 2.0)
               {
-                break;
+                localok = false;
               }
-            } // end of for (k = 0; k < 2; k++)
-            //
-            if (localok == false)
+            }
+#ifdef OCCT_DEBUG
+            if (localok)
+            {
+              printf("--- BRepCheck Wire: AutoIntersection Phase2 -> Bon \n");
+              printf("--- distance Point Vertex : %10.7g (tol %10.7g)\n",
+                     distauvtxleplusproche,
+                     tolvtt);
+              printf("--- Erreur Max sur E1 : %10.7g  Tol_Edge:%10.7g\n", maxd1, tole1);
+              printf("--- Erreur Max sur E2 : %10.7g  Tol_Edge:%10.7g\n", maxd2, tole2);
+              fflush(stdout);
+            }
+            else
             {
-              retE1 = E1;
-              retE2 = E2;
-              if (Update)
+              printf("--- BRepCheck Wire: AutoIntersection Phase2 -> Erreur \n");
+              printf("--- distance Point Vertex : %10.7g (tol %10.7g)\n",
+                     distauvtxleplusproche,
+                     tolvtt);
+              printf("--- Erreur Max sur E1 : %10.7g  Tol_Edge:%10.7g\n", maxd1, tole1);
+              printf("--- Erreur Max sur E2 : %10.7g  Tol_Edge:%10.7g\n", maxd2, tole2);
+              fflush(stdout);
+            }
+#endif
+          } // end of else (construction of the line Lig)
+        } // end of if (localok == false && !CommonVertices.IsEmpty())
+        //
+        if (localok == false)
+        {
+#ifdef OCCT_DEBUG
+          std::cout << "point p " << P3d.X() << " " << P3d.Y() << " " << P3d.Z() << std::endl;
+          std::cout.flush();
+#endif
+          return true;
+        } //-- localok == False
+      } // end of if(Tr1.PositionOnCurve() == IntRes2d_Middle || Tr2.PositionOnCurve() ==
+        // IntRes2d_Middle)
+    } // end of for (int p=1; p <= nbp; p++)
+    ////
+    //// **** Segments of intersection **** ////
+    for (int s = 1; s <= nbs; ++s)
+    {
+      const IntRes2d_IntersectionSegment& Seg = Inter.Segment(s);
+      if (Seg.HasFirstPoint() && Seg.HasLastPoint())
+      {
+        bool                       localok;
+        int                        k;
+        IntRes2d_IntersectionPoint PSeg[2];
+        IntRes2d_Position          aPCR1, aPCR2;
+        //
+        localok = false;
+        PSeg[0] = Seg.FirstPoint();
+        PSeg[1] = Seg.LastPoint();
+        // At least one of extremities of the segment must be inside
+        // the tolerance of a common vertex
+        for (k = 0; k < 2; ++k)
+        {
+          IP_ParamOnFirst  = PSeg[k].ParamOnFirst();
+          IP_ParamOnSecond = PSeg[k].ParamOnSecond();
+          Tr1              = PSeg[k].TransitionOfFirst();
+          Tr2              = PSeg[k].TransitionOfSecond();
+          aPCR1            = Tr1.PositionOnCurve();
+          aPCR2            = Tr2.PositionOnCurve();
+          //
+          if (aPCR1 != IntRes2d_Middle && aPCR2 != IntRes2d_Middle)
+          {
+            GeomAbs_CurveType aCT1, aCT2;
+            // ZZ
+            aCT1 = C1.GetType();
+            aCT2 = C2.GetType();
+            if (aCT1 == GeomAbs_Line && aCT2 == GeomAbs_Line)
+            {
+              // check for the two lines coincidence
+              double   aPAR_T, aT11, aT12, aT21, aT22, aT1m, aT2m;
+              double   aD2, aTolE1, aTolE2, aTol2;
+              gp_Lin2d aL1, aL2;
+              gp_Pnt2d aP1m;
+              //
+              aPAR_T = 0.43213918;
+              //
+              aTolE1 = BRep_Tool::Tolerance(E1);
+              aTolE2 = BRep_Tool::Tolerance(E2);
+              aTol2  = aTolE1 + aTolE2;
+              aTol2  = aTol2 * aTol2;
+              //
+              aL1 = C1.Line();
+              aL2 = C2.Line();
+              //
+              aT11 = PSeg[0].ParamOnFirst();
+              aT12 = PSeg[1].ParamOnFirst();
+              aT21 = PSeg[0].ParamOnSecond();
+              aT22 = PSeg[1].ParamOnSecond();
+              //
+              aT1m = (1. - aPAR_T) * aT11 + aPAR_T * aT12;
+              aP1m = C1.Value(aT1m);
+              //
+              aD2 = aL2.SquareDistance(aP1m);
+              if (aD2 < aTol2)
               {
-                BRepCheck::Add(aStatusList, BRepCheck_SelfIntersectingWire);
-              }
+                aT2m = ElCLib::Parameter(aL2, aP1m);
+                if (aT2m > aT21 && aT2m < aT22)
+                {
+                  const gp_Dir2d& aDir1 = aL1.Direction();
+                  const gp_Dir2d& aDir2 = aL2.Direction();
+                  if (aDir1.IsParallel(aDir2, Precision::Angular()))
+                  {
+                    localok = false;
+                    break; // from for (k = 0; k < 2; ++k){...
+                  }
+                } // if (aT2m>aT21 && aT2m<aT22) {
+              } // if (aD2<aTol2) {
+            } // if (aCT1==GeomAbs_Line && aCT2==GeomAbs_Line) {
+            // ZZ
+            localok = true;
+            break;
+          }
+          //
+          double                         f, l, tolvtt;
+          TopLoc_Location                L, L2;
+          const occ::handle<Geom_Curve>& ConS  = BRep_Tool::Curve(E1, L, f, l);
+          const occ::handle<Geom_Curve>& ConS2 = BRep_Tool::Curve(E2, L2, f, l);
+          //  Modified by Sergey KHROMOV - Mon Apr 15 12:34:22 2002 Begin
+          if (!ConS.IsNull())
+          {
+            P3d = ConS->Value(IP_ParamOnFirst);
+            P3d.Transform(L.Transformation());
+          }
+          else
+          {
+            gp_Pnt2d aP2d = C1.Value(IP_ParamOnFirst);
+            P3d           = theSurf.Value(aP2d);
+          }
+          if (!ConS2.IsNull())
+          {
+            P3d2 = ConS2->Value(IP_ParamOnSecond);
+            P3d2.Transform(L2.Transformation());
+          }
+          else
+          {
+            gp_Pnt2d aP2d = C2.Value(IP_ParamOnSecond);
+            P3d2          = theSurf.Value(aP2d);
+          }
+          //  Modified by Sergey KHROMOV - Mon Apr 15 12:34:22 2002 End
+          itl.Initialize(CommonVertices);
+          for (; itl.More(); itl.Next())
+          {
+            double p3dvttDistanceP3d, p3dvttDistanceP3d2;
+            gp_Pnt p3dvtt;
+            //
+            const TopoDS_Vertex& vtt = TopoDS::Vertex(itl.Value());
+            p3dvtt                   = BRep_Tool::Pnt(vtt);
+            tolvtt                   = BRep_Tool::Tolerance(vtt);
+            tolvtt                   = 1.1 * tolvtt;
+            tolvtt                   = tolvtt * tolvtt;
+            p3dvttDistanceP3d        = p3dvtt.SquareDistance(P3d);
+            p3dvttDistanceP3d2       = p3dvtt.SquareDistance(P3d2);
+            if (p3dvttDistanceP3d <= tolvtt && p3dvttDistanceP3d2 <= tolvtt)
+            {
+              localok = true;
+              break;
+            }
+          }
+          if (localok == true)
+          {
+            break;
+          }
+        } // end of for (k = 0; k < 2; k++)
+        //
+        if (localok == false)
+        {
+#ifdef OCCT_DEBUG
+          std::cout << "point p " << P3d.X() << " " << P3d.Y() << " " << P3d.Z() << std::endl;
+          std::cout.flush();
+#endif
+          return true;
+        } //-- localok == False
+      } // end of if(Seg.HasFirstPoint() && Seg.HasLastPoint())
+    } // end of for (int s = 1; s <= nbs; p++)
+  }
+  return false;
+}
+
+//=================================================================================================
+
+BRepCheck_Status BRepCheck_Wire::SelfIntersect(const TopoDS_Face& F,
+                                               TopoDS_Edge&       retE1,
+                                               TopoDS_Edge&       retE2,
+                                               const bool         Update)
+{
+  occ::handle<NCollection_Shared<NCollection_List<BRepCheck_Status>>> aHList;
+  {
+    std::unique_lock<std::mutex> aLock =
+      myMutex ? std::unique_lock<std::mutex>(*myMutex) : std::unique_lock<std::mutex>();
+    aHList = myMap(myShape);
+  }
+  NCollection_List<BRepCheck_Status>& aStatusList = *aHList;
+
+  int                                  i, Nbedges;
+  double                               first1, last1;
+  gp_Pnt2d                             pfirst1, plast1;
+  Geom2dAdaptor_Curve                  C1;
+  NCollection_IndexedMap<TopoDS_Shape> EMap;
+  //
+  //-- check with proper tolerances if there is no
+  //-- point in the tolerance of a vertex.
+  constexpr double tolint = 1.e-10;
+  //
+  for (TopoDS_Iterator Iter1(myShape); Iter1.More(); Iter1.Next())
+  {
+    if (Iter1.Value().ShapeType() == TopAbs_EDGE)
+    {
+      EMap.Add(Iter1.Value());
+    }
+  }
+  //
+  Nbedges = EMap.Extent();
+  if (!Nbedges)
+  {
+    if (Update)
+    {
+      BRepCheck::Add(aStatusList, BRepCheck_EmptyWire);
+    }
+    return (BRepCheck_EmptyWire);
+  }
+  //
+  // Prepare parametric curves, domains and boxes of all edges;
+  // the first edge without pcurve is reported as self-intersecting,
+  // any other one stops the checks of pairs of the first edge with the next ones
+  NCollection_Array1<BRepCheck_EdgeOnFace> aCurves(1, Nbedges);
+  int              aBadEdge   = 0;
+  BRepCheck_Status aBadStatus = BRepCheck_NoError;
+  for (i = 1; i <= Nbedges; i++)
+  {
+    const TopoDS_Edge&    E1     = TopoDS::Edge(EMap.FindKey(i));
+    BRepCheck_EdgeOnFace& aCurve = aCurves(i);
+    aCurve.Curve                 = BRep_Tool::CurveOnSurface(E1, F, first1, last1);
+    if (aCurve.Curve.IsNull())
+    {
+      if (i == 1)
+      {
+        retE1 = E1;
+        if (Update)
+        {
+          BRepCheck::Add(aStatusList, BRepCheck_SelfIntersectingWire);
+        }
+        return (BRepCheck_SelfIntersectingWire);
+      }
+      aBadEdge   = i;
+      aBadStatus = BRepCheck_NoCurveOnSurface;
+      break;
+    }
+    // the range of the edge is checked before its clamping by the curve bounds
+    if (i > 1 && last1 <= first1)
+    {
+      aBadEdge   = i;
+      aBadStatus = BRepCheck_InvalidRange;
+      break;
+    }
+    //
+    C1.Load(aCurve.Curve);
+    // To avoid exception in Segment if C1 is BSpline - IFV
+    if (!C1.IsPeriodic())
+    {
+      if (C1.FirstParameter() > first1)
+      {
+        first1 = C1.FirstParameter();
+      }
+      if (C1.LastParameter() < last1)
+      {
+        last1 = C1.LastParameter();
+      }
+    }
+    //
+    BRep_Tool::UVPoints(E1, F, pfirst1, plast1);
+    aCurve.Domain.SetValues(pfirst1, first1, tolint, plast1, last1, tolint);
+    //
+    BndLib_Add2dCurve::Add(C1, first1, last1, Precision::PConfusion(), aCurve.Box);
+  }
+  //
+  // Select pairs of edges with interfering boxes
+  std::vector<std::pair<int, int>> aPairs;
+  const int                        aNbPrepared = aBadEdge != 0 ? aBadEdge - 1 : Nbedges;
+  if (aNbPrepared >= myMinEdgesForBVH)
+  {
+    BRepCheck_BoxSet aBoxSet(new BVH_LinearBuilder<double, 2>(BVH_Constants_LeafNodeSizeSingle));
+    aBoxSet.SetSize(aNbPrepared);
+    for (i = 1; i <= aNbPrepared; i++)
+    {
+      if (!aCurves(i).Box.IsVoid())
+      {
+        aBoxSet.Add(i, Bnd_Tools::Bnd2BVH(aCurves(i).Box));
+      }
+    }
+    aBoxSet.Build();
+
+    BRepCheck_PairSelector aSelector(aCurves);
+    aSelector.SetBVHSets(&aBoxSet, &aBoxSet);
+    aSelector.Select();
+    aPairs.swap(aSelector.Pairs());
+    std::sort(aPairs.begin(), aPairs.end());
+  }
+  else
+  {
+    for (i = 1; i <= aNbPrepared; i++)
+    {
+      for (int j = i + 1; j <= aNbPrepared; j++)
+      {
+        if (!aCurves(i).Box.IsOut(aCurves(j).Box))
+        {
+          aPairs.push_back(std::make_pair(i, j));
+        }
+      }
+    }
+  }
+  //
+  // List the checks in the order of sequential algorithm:
+  // self-intersection of each edge followed by its intersections with the next edges;
+  // with bad edge, only the pairs of the first edge with the previous edges are checked
+  NCollection_Vector<std::pair<int, int>> aChecks;
+  size_t                                  aPairIter = 0;
+  for (i = 1; i <= aNbPrepared; i++)
+  {
+    aChecks.Append(std::make_pair(i, 0));
+    for (; aPairIter < aPairs.size() && aPairs[aPairIter].first == i; ++aPairIter)
+    {
+      const std::pair<int, int>& aPair = aPairs[aPairIter];
+      // modified by NIZNHY-PKV Fri Oct 29 10:09:01 2010f
+      if (!EMap.FindKey(aPair.first).IsSame(EMap.FindKey(aPair.second)))
+      {
+        aChecks.Append(aPair);
+      }
+    }
+    if (aBadEdge != 0)
+    {
+      break;
+    }
+  }
+  //
+  const auto isCheckFailed = [&](const int theIndex) -> bool {
+    const std::pair<int, int>& aCheck = aChecks.Value(theIndex);
+    BRepCheck_FaceEvaluator    aSurf(F);
+    if (aCheck.second == 0)
+    {
+      return IsSelfIntersected(TopoDS::Edge(EMap.FindKey(aCheck.first)),
+                               aCurves(aCheck.first),
+                               aSurf);
+    }
+    return AreIntersected(TopoDS::Edge(EMap.FindKey(aCheck.first)),
+                          aCurves(aCheck.first),
+                          TopoDS::Edge(EMap.FindKey(aCheck.second)),
+                          aCurves(aCheck.second),
+                          aSurf);
+  };
+
+  int aFailedCheck = -1;
+  if (myMutex && aChecks.Size() >= THE_MIN_CHECKS_FOR_PARALLEL)
+  {
+    // the first failed check in sequential order is reported;
+    // checks following an already failed one are skipped
+    std::atomic<int> aFirstFailed(aChecks.Size());
+    OSD_Parallel::For(0, aChecks.Size(), [&](const int theIndex) {
+      if (theIndex > aFirstFailed.load() || !isCheckFailed(theIndex))
+      {
+        return;
+      }
+      for (int aPrev = aFirstFailed.load();
+           theIndex < aPrev && !aFirstFailed.compare_exchange_weak(aPrev, theIndex);)
+      {
+      }
+    });
+    aFailedCheck = aFirstFailed < aChecks.Size() ? aFirstFailed.load() : -1;
+  }
+  else
+  {
+    for (int aCheckIter = 0; aCheckIter < aChecks.Size() && aFailedCheck < 0; ++aCheckIter)
+    {
+      aFailedCheck = isCheckFailed(aCheckIter) ? aCheckIter : -1;
+    }
+  }
+  //
+  if (aFailedCheck >= 0)
+  {
+    const std::pair<int, int>& aCheck = aChecks.Value(aFailedCheck);
+    retE1                             = TopoDS::Edge(EMap.FindKey(aCheck.first));
+    if (aCheck.second != 0)
+    {
+      retE2 = TopoDS::Edge(EMap.FindKey(aCheck.second));
+    }
+    if (Update)
+    {
+      BRepCheck::Add(aStatusList, BRepCheck_SelfIntersectingWire);
+    }
+    return (BRepCheck_SelfIntersectingWire);
+  }
+  if (aBadEdge != 0)
+  {
 #ifdef OCCT_DEBUG
-              static int numpoint1 = 0;
-              std::cout << "point p" << ++numpoint1 << " " << P3d.X() << " " << P3d.Y() << " "
-                        << P3d.Z() << std::endl;
-              std::cout.flush();
+    std::cout << "BRepCheck_NoCurveOnSurface or BRepCheck_InvalidRange" << std::endl;
+    std::cout.flush();
 #endif
-              delete[] tabDom;
-              return (BRepCheck_SelfIntersectingWire);
-            } //-- localok == False
-          } // end of if(Seg.HasFirstPoint() && Seg.HasLastPoint())
-        } // end of for (int s = 1; s <= nbs; p++)
-      } //-- Inter.IsDone()
-    } // end of for( j = i+1; j<=Nbedges; j++)
-  } // end of for(i = 1; i <= Nbedges; i++)
+    return aBadStatus;
+  }
   //
-  delete[] tabDom;
   if (Update)
   {
     BRepCheck::Add(aStatusList, BRepCheck_NoError);
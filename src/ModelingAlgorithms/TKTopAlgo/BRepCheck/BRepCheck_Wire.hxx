@@ -106,6 +106,14 @@ public:
   //! set SelfIntersect() to be checked
   Standard_EXPORT void GeometricControls(const bool B);
 
+  //! Sets the minimal number of edges of the wire for which SelfIntersect() selects
+  //! the pairs of edges to intersect by BVH of their boxes (32 by default);
+  //! the pairs of edges of smaller wires are selected by brute force with the same result.
+  void SetMinEdgesForBVH(const int theNbEdges) { myMinEdgesForBVH = theNbEdges; }
+
+  //! Returns the minimal number of edges of the wire to select pairs of edges by BVH.
+  int MinEdgesForBVH() const { return myMinEdgesForBVH; }
+
   //! Sets status of Wire;
   Standard_EXPORT void SetStatus(const BRepCheck_Status theStatus);
 
@@ -117,6 +125,7 @@ private:
   NCollection_IndexedDataMap<TopoDS_Shape, NCollection_List<TopoDS_Shape>, TopTools_ShapeMapHasher>
        myMapVE;
   bool myGctrl;
+  int  myMinEdgesForBVH;
 };
 
 #endif // _BRepCheck_Wire_HeaderFile
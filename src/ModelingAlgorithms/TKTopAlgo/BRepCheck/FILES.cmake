@@ -19,6 +19,8 @@ set(OCCT_BRepCheck_FILES
   BRepCheck_Solid.cxx
   BRepCheck_Solid.hxx
   BRepCheck_Status.hxx
+  BRepCheck_SurfaceCache.cxx
+  BRepCheck_SurfaceCache.hxx
   BRepCheck_Vertex.cxx
   BRepCheck_Vertex.hxx
   BRepCheck_Wire.cxx
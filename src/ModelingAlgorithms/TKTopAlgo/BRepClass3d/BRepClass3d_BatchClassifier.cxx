@@ -0,0 +1,486 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <BRepClass3d_BatchClassifier.hxx>
+
+#include <BRep_Tool.hxx>
+#include <BRepClass3d_SolidClassifier.hxx>
+#include <BVH_Ray.hxx>
+#include <BVH_Tools.hxx>
+#include <Geom_Plane.hxx>
+#include <NCollection_IndexedDataMap.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_Parallel.hxx>
+#include <OSD_ThreadPool.hxx>
+#include <Poly_Triangulation.hxx>
+#include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopTools_ShapeMapHasher.hxx>
+
+#include <cmath>
+
+namespace
+{
+//! Directions of the rays, chosen not to be parallel to the coordinate axes and planes.
+static const BVH_Vec3d THE_RAY_DIRECTIONS[] = {BVH_Vec3d(0.5773, 0.6372, 0.5105),
+                                               BVH_Vec3d(-0.4467, 0.3381, 0.8284),
+                                               BVH_Vec3d(0.7153, -0.6011, 0.3565)};
+
+//! Relative tolerance of the barycentric coordinates of the intersection point of the ray
+//! with the triangle, rejecting the rays passing close to the edges and vertices of triangles.
+static const double THE_BARYCENTRIC_TOL = 1.e-7;
+
+//! Tolerance of the cosine of the angle between the ray and the normal of the triangle,
+//! rejecting the rays tangent to triangles.
+static const double THE_ANGULAR_TOL = 1.e-7;
+
+//! Returns true if the shape is suitable for the classification by the parity of
+//! the intersections with its triangulation; computes the maximal deflection
+//! of the triangulation of the faces.
+static bool checkShape(
+  const TopoDS_Shape&                                                  theShape,
+  const NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher>& theFaces,
+  double&                                                              theDeflection)
+{
+  theDeflection = 0.0;
+  for (TopExp_Explorer anExp(theShape, TopAbs_FACE); anExp.More(); anExp.Next())
+  {
+    const TopAbs_Orientation anOri = anExp.Current().Orientation();
+    if (anOri == TopAbs_INTERNAL || anOri == TopAbs_EXTERNAL)
+    {
+      return false;
+    }
+  }
+
+  for (int aFaceIndex = 1; aFaceIndex <= theFaces.Extent(); ++aFaceIndex)
+  {
+    const TopoDS_Face&                     aFace = TopoDS::Face(theFaces(aFaceIndex));
+    TopLoc_Location                        aLoc;
+    const occ::handle<Poly_Triangulation>& aTriangulation = BRep_Tool::Triangulation(aFace, aLoc);
+    if (aTriangulation.IsNull() || aTriangulation->NbTriangles() == 0)
+    {
+      return false;
+    }
+    const double aDeflection = aTriangulation->Deflection();
+    if (aDeflection <= 0.0)
+    {
+      // the distance of the triangulation from the curved surface is unknown
+      const occ::handle<Geom_Surface>& aSurface = BRep_Tool::Surface(aFace, aLoc);
+      if (!aSurface.IsNull() && !aSurface->IsKind(STANDARD_TYPE(Geom_Plane)))
+      {
+        return false;
+      }
+    }
+    theDeflection = std::max(theDeflection, aDeflection);
+  }
+
+  // the faces should not be shared by the solids
+  NCollection_IndexedDataMap<TopoDS_Shape, NCollection_List<TopoDS_Shape>, TopTools_ShapeMapHasher>
+    aFaceSolids;
+  TopExp::MapShapesAndUniqueAncestors(theShape, TopAbs_FACE, TopAbs_SOLID, aFaceSolids);
+  for (int aFaceIndex = 1; aFaceIndex <= aFaceSolids.Extent(); ++aFaceIndex)
+  {
+    if (aFaceSolids(aFaceIndex).Extent() > 1)
+    {
+      return false;
+    }
+  }
+
+  // the shells should be closed, i.e. each edge should be used by even number of faces
+  NCollection_IndexedDataMap<TopoDS_Shape, NCollection_List<TopoDS_Shape>, TopTools_ShapeMapHasher>
+    anEdgeFaces;
+  TopExp::MapShapesAndAncestors(theShape, TopAbs_EDGE, TopAbs_FACE, anEdgeFaces);
+  for (int anEdgeIndex = 1; anEdgeIndex <= anEdgeFaces.Extent(); ++anEdgeIndex)
+  {
+    if (BRep_Tool::Degenerated(TopoDS::Edge(anEdgeFaces.FindKey(anEdgeIndex))))
+    {
+      continue;
+    }
+    const int aNbFaces = anEdgeFaces(anEdgeIndex).Extent();
+    if (aNbFaces == 0 || aNbFaces % 2 != 0)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+//! Functor classifying the points using the triangulation.
+class TriangulationFunctor
+{
+public:
+  TriangulationFunctor(const BRepClass3d_BatchClassifier& theClassifier,
+                       const NCollection_Array1<gp_Pnt>&  thePoints,
+                       const double                       theTol,
+                       NCollection_Array1<TopAbs_State>&  theStates)
+      : myClassifier(theClassifier),
+        myPoints(thePoints),
+        myTol(theTol),
+        myStates(theStates)
+  {
+  }
+
+  void operator()(const int theIndex) const
+  {
+    const int anIndex = myPoints.Lower() + theIndex;
+    myStates(anIndex) = myClassifier.ClassifyByTriangulation(myPoints(anIndex), myTol);
+  }
+
+private:
+  const BRepClass3d_BatchClassifier& myClassifier;
+  const NCollection_Array1<gp_Pnt>&  myPoints;
+  const double                       myTol;
+  NCollection_Array1<TopAbs_State>&  myStates;
+};
+
+//! Functor classifying the bands of the points exactly,
+//! using own solid classifier for each band.
+class ExactFunctor
+{
+public:
+  ExactFunctor(const TopoDS_Shape&               theShape,
+               const NCollection_Array1<gp_Pnt>& thePoints,
+               const NCollection_Vector<int>&    theIndices,
+               const int                         theBandSize,
+               const double                      theTol,
+               NCollection_Array1<TopAbs_State>& theStates)
+      : myShape(theShape),
+        myPoints(thePoints),
+        myIndices(theIndices),
+        myBandSize(theBandSize),
+        myTol(theTol),
+        myStates(theStates)
+  {
+  }
+
+  void operator()(const int theBand) const
+  {
+    const int aFirst = theBand * myBandSize;
+    const int aLast  = std::min(aFirst + myBandSize, myIndices.Length());
+    BRepClass3d_SolidClassifier aClassifier(myShape);
+    for (int anI = aFirst; anI < aLast; ++anI)
+    {
+      const int anIndex = myIndices(anI);
+      aClassifier.Perform(myPoints(anIndex), myTol);
+      myStates(anIndex) = aClassifier.State();
+    }
+  }
+
+private:
+  const TopoDS_Shape&               myShape;
+  const NCollection_Array1<gp_Pnt>& myPoints;
+  const NCollection_Vector<int>&    myIndices;
+  const int                         myBandSize;
+  const double                      myTol;
+  NCollection_Array1<TopAbs_State>& myStates;
+};
+} // namespace
+
+//=================================================================================================
+
+BRepClass3d_BatchClassifier::BRepClass3d_BatchClassifier()
+    : myBand(0.0),
+      myRunParallel(false),
+      myNbExact(0)
+{
+}
+
+//=================================================================================================
+
+BRepClass3d_BatchClassifier::BRepClass3d_BatchClassifier(const TopoDS_Shape& theShape)
+    : myBand(0.0),
+      myRunParallel(false),
+      myNbExact(0)
+{
+  Load(theShape);
+}
+
+//=================================================================================================
+
+BRepClass3d_BatchClassifier::~BRepClass3d_BatchClassifier() = default;
+
+//=================================================================================================
+
+void BRepClass3d_BatchClassifier::Load(const TopoDS_Shape& theShape)
+{
+  myShape = theShape;
+  myTriangles.Nullify();
+  myTree.Nullify();
+  myBand    = 0.0;
+  myNbExact = 0;
+  if (theShape.IsNull())
+  {
+    return;
+  }
+
+  NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> aFaces;
+  TopExp::MapShapes(theShape, TopAbs_FACE, aFaces);
+  double aDeflection = 0.0;
+  if (aFaces.IsEmpty() || !checkShape(theShape, aFaces, aDeflection))
+  {
+    return;
+  }
+
+  NCollection_Vector<TopoDS_Shape> aFaceVec;
+  for (int aFaceIndex = 1; aFaceIndex <= aFaces.Extent(); ++aFaceIndex)
+  {
+    aFaceVec.Append(aFaces(aFaceIndex));
+  }
+  myTriangles = new BRepExtrema_TriangleSet(aFaceVec);
+  if (myTriangles->Size() == 0)
+  {
+    myTriangles.Nullify();
+    return;
+  }
+
+  // build the hierarchy once, so that it is only read by the threads
+  myTree = myTriangles->BVH();
+
+  double aTolerance = 0.0;
+  for (TopAbs_ShapeEnum aType : {TopAbs_VERTEX, TopAbs_EDGE, TopAbs_FACE})
+  {
+    if (TopExp_Explorer(theShape, aType).More())
+    {
+      aTolerance = std::max(aTolerance, BRep_Tool::MaxTolerance(theShape, aType));
+    }
+  }
+  myBand = aDeflection + aTolerance;
+}
+
+//=================================================================================================
+
+void BRepClass3d_BatchClassifier::Perform(const NCollection_Array1<gp_Pnt>& thePoints,
+                                          const double                      theTol,
+                                          NCollection_Array1<TopAbs_State>& theStates)
+{
+  myNbExact = 0;
+  if (thePoints.IsEmpty())
+  {
+    theStates = NCollection_Array1<TopAbs_State>();
+    return;
+  }
+  theStates = NCollection_Array1<TopAbs_State>(thePoints.Lower(), thePoints.Upper());
+  theStates.Init(TopAbs_UNKNOWN);
+  if (myShape.IsNull())
+  {
+    return;
+  }
+
+  if (IsAccelerated())
+  {
+    TriangulationFunctor aFunctor(*this, thePoints, theTol, theStates);
+    OSD_Parallel::For(0, thePoints.Length(), aFunctor, !myRunParallel);
+  }
+
+  // classify exactly the points which have not been classified using the triangulation
+  NCollection_Vector<int> anIndices;
+  for (int anIndex = thePoints.Lower(); anIndex <= thePoints.Upper(); ++anIndex)
+  {
+    if (theStates(anIndex) == TopAbs_UNKNOWN)
+    {
+      anIndices.Append(anIndex);
+    }
+  }
+  myNbExact = anIndices.Length();
+  if (anIndices.IsEmpty())
+  {
+    return;
+  }
+
+  // the points are distributed by bands to load the solid into the classifier once per band
+  const int aNbThreads =
+    myRunParallel ? std::max(OSD_ThreadPool::DefaultPool()->NbThreads(), 1) : 1;
+  const int    aNbBands  = std::min(aNbThreads, anIndices.Length());
+  const int    aBandSize = (anIndices.Length() + aNbBands - 1) / aNbBands;
+  ExactFunctor aFunctor(myShape, thePoints, anIndices, aBandSize, theTol, theStates);
+  OSD_Parallel::For(0, aNbBands, aFunctor, !myRunParallel);
+}
+
+//=================================================================================================
+
+TopAbs_State BRepClass3d_BatchClassifier::ClassifyByTriangulation(const gp_Pnt& thePoint,
+                                                                  const double  theTol) const
+{
+  if (!IsAccelerated())
+  {
+    return TopAbs_UNKNOWN;
+  }
+
+  const double    aBand = myBand + theTol;
+  const BVH_Vec3d aPoint(thePoint.X(), thePoint.Y(), thePoint.Z());
+  const BVH_Vec3d aBandVec(aBand, aBand, aBand);
+  const BVH_Vec3d aMin = myTree->MinPoint(0) - aBandVec;
+  const BVH_Vec3d aMax = myTree->MaxPoint(0) + aBandVec;
+  for (int anAxis = 0; anAxis < 3; ++anAxis)
+  {
+    if (aPoint[anAxis] < aMin[anAxis] || aPoint[anAxis] > aMax[anAxis])
+    {
+      return TopAbs_OUT;
+    }
+  }
+
+  if (isNear(aPoint, aBand))
+  {
+    // the state of the point may differ for the triangulation and for the solid
+    return TopAbs_UNKNOWN;
+  }
+
+  int aParity = -1;
+  for (const BVH_Vec3d& aDirection : THE_RAY_DIRECTIONS)
+  {
+    const int aRayParity = rayParity(aPoint, aDirection.Normalized());
+    if (aRayParity < 0)
+    {
+      continue;
+    }
+    if (aParity < 0)
+    {
+      aParity = aRayParity;
+      continue;
+    }
+    if (aParity != aRayParity)
+    {
+      return TopAbs_UNKNOWN;
+    }
+    return aParity == 1 ? TopAbs_IN : TopAbs_OUT;
+  }
+  return TopAbs_UNKNOWN;
+}
+
+//=================================================================================================
+
+bool BRepClass3d_BatchClassifier::isNear(const BVH_Vec3d& thePoint, const double theDistance) const
+{
+  const double aSqDistance = theDistance * theDistance;
+
+  int aStack[BVH_Constants_MaxTreeDepth * 2];
+  int aHead = 0;
+  aStack[0] = 0;
+  while (aHead >= 0)
+  {
+    const int aNode = aStack[aHead--];
+    if (BVH_Tools<double, 3>::PointBoxSquareDistance(thePoint,
+                                                     myTree->MinPoint(aNode),
+                                                     myTree->MaxPoint(aNode))
+        > aSqDistance)
+    {
+      continue;
+    }
+    if (!myTree->IsOuter(aNode))
+    {
+      aStack[++aHead] = myTree->Child<0>(aNode);
+      aStack[++aHead] = myTree->Child<1>(aNode);
+      continue;
+    }
+    for (int aTri = myTree->BegPrimitive(aNode); aTri <= myTree->EndPrimitive(aNode); ++aTri)
+    {
+      BVH_Vec3d aNode0, aNode1, aNode2;
+      myTriangles->GetVertices(aTri, aNode0, aNode1, aNode2);
+      if (BVH_Tools<double, 3>::PointTriangleSquareDistance(thePoint, aNode0, aNode1, aNode2)
+          <= aSqDistance)
+      {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+//=================================================================================================
+
+int BRepClass3d_BatchClassifier::rayParity(const BVH_Vec3d& theOrigin,
+                                           const BVH_Vec3d& theDirection) const
+{
+  const BVH_Ray<double, 3> aRay(theOrigin, theDirection);
+
+  int aNbHits = 0;
+  int aStack[BVH_Constants_MaxTreeDepth * 2];
+  int aHead = 0;
+  aStack[0] = 0;
+  while (aHead >= 0)
+  {
+    const int aNode      = aStack[aHead--];
+    double    aTimeEnter = 0.0, aTimeLeave = 0.0;
+    if (!BVH_Tools<double, 3>::RayBoxIntersection(aRay,
+                                                  myTree->MinPoint(aNode),
+                                                  myTree->MaxPoint(aNode),
+                                                  aTimeEnter,
+                                                  aTimeLeave))
+    {
+      continue;
+    }
+    if (!myTree->IsOuter(aNode))
+    {
+      aStack[++aHead] = myTree->Child<0>(aNode);
+      aStack[++aHead] = myTree->Child<1>(aNode);
+      continue;
+    }
+    for (int aTri = myTree->BegPrimitive(aNode); aTri <= myTree->EndPrimitive(aNode); ++aTri)
+    {
+      BVH_Vec3d aNode0, aNode1, aNode2;
+      myTriangles->GetVertices(aTri, aNode0, aNode1, aNode2);
+
+      // Moller-Trumbore intersection of the ray with the triangle
+      const BVH_Vec3d anEdge1  = aNode1 - aNode0;
+      const BVH_Vec3d anEdge2  = aNode2 - aNode0;
+      const BVH_Vec3d aNormal  = BVH_Vec3d::Cross(anEdge1, anEdge2);
+      const double    aNormLen = aNormal.Modulus();
+      if (aNormLen == 0.0)
+      {
+        // degenerated triangle
+        continue;
+      }
+
+      const BVH_Vec3d aPVec = BVH_Vec3d::Cross(theDirection, anEdge2);
+      const double    aDet  = anEdge1.Dot(aPVec);
+      const BVH_Vec3d aTVec = theOrigin - aNode0;
+      if (std::abs(aDet) <= THE_ANGULAR_TOL * aNormLen)
+      {
+        // the ray is parallel to the triangle, it is not reliable if it lies in its plane
+        if (std::abs(aTVec.Dot(aNormal)) <= THE_ANGULAR_TOL * aNormLen * aTimeLeave)
+        {
+          return -1;
+        }
+        continue;
+      }
+
+      const double anInvDet = 1.0 / aDet;
+      const double aU       = aTVec.Dot(aPVec) * anInvDet;
+      if (aU < -THE_BARYCENTRIC_TOL || aU > 1.0 + THE_BARYCENTRIC_TOL)
+      {
+        continue;
+      }
+      const BVH_Vec3d aQVec = BVH_Vec3d::Cross(aTVec, anEdge1);
+      const double    aV    = theDirection.Dot(aQVec) * anInvDet;
+      const double    aW    = 1.0 - aU - aV;
+      if (aV < -THE_BARYCENTRIC_TOL || aW < -THE_BARYCENTRIC_TOL)
+      {
+        continue;
+      }
+      if (anEdge2.Dot(aQVec) * anInvDet <= 0.0)
+      {
+        // intersection behind the origin of the ray
+        continue;
+      }
+      if (aU <= THE_BARYCENTRIC_TOL || aV <= THE_BARYCENTRIC_TOL || aW <= THE_BARYCENTRIC_TOL)
+      {
+        // the ray passes through an edge or a vertex of the triangle
+        return -1;
+      }
+      ++aNbHits;
+    }
+  }
+  return aNbHits % 2;
+}
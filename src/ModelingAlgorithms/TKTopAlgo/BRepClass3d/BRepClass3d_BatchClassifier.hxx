@@ -0,0 +1,113 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#ifndef _BRepClass3d_BatchClassifier_HeaderFile
+#define _BRepClass3d_BatchClassifier_HeaderFile
+
+#include <BRepExtrema_TriangleSet.hxx>
+#include <NCollection_Array1.hxx>
+#include <Standard.hxx>
+#include <Standard_DefineAlloc.hxx>
+#include <TopAbs_State.hxx>
+#include <TopoDS_Shape.hxx>
+#include <gp_Pnt.hxx>
+
+//! Classifies large sets of points against a solid.
+//!
+//! The classifier builds the bounding volume hierarchy of the triangulation
+//! of the faces of the solid once on loading and classifies the points in parallel
+//! by the parity of the number of intersections of rays cast from the points with
+//! the triangulation. The ray is rejected if it passes too close to an edge or a vertex
+//! of a triangle or touches the triangle tangentially, and the state of the point is
+//! accepted only if two valid rays agree.
+//!
+//! The points lying closer to the triangulation than its deflection plus the tolerances
+//! of the shape and of the classification, and the points for which no reliable rays
+//! have been found, are classified exactly by BRepClass3d_SolidClassifier.
+//! The same is done for all points if the acceleration structure cannot be built:
+//! the faces have no triangulation (the solid should be meshed in advance, e.g. by
+//! BRepMesh_IncrementalMesh), the triangulation of a curved face has unknown deflection,
+//! the shells are not closed, or the shape contains internal or external faces,
+//! or faces shared by several solids.
+class BRepClass3d_BatchClassifier
+{
+public:
+  DEFINE_STANDARD_ALLOC
+
+  //! Empty constructor.
+  Standard_EXPORT BRepClass3d_BatchClassifier();
+
+  //! Constructor loading the solid.
+  Standard_EXPORT BRepClass3d_BatchClassifier(const TopoDS_Shape& theShape);
+
+  //! Destructor.
+  Standard_EXPORT ~BRepClass3d_BatchClassifier();
+
+  //! Loads the solid and builds the acceleration structure for its triangulation.
+  Standard_EXPORT void Load(const TopoDS_Shape& theShape);
+
+  //! Returns the loaded shape.
+  const TopoDS_Shape& Shape() const { return myShape; }
+
+  //! Returns true if the points are classified using the triangulation,
+  //! false if all points are classified exactly.
+  bool IsAccelerated() const { return !myTree.IsNull(); }
+
+  //! Sets the flag of parallel classification of the points.
+  void SetRunParallel(const bool theIsParallel) { myRunParallel = theIsParallel; }
+
+  //! Returns the flag of parallel classification of the points.
+  bool RunParallel() const { return myRunParallel; }
+
+  //! Classifies the points with the tolerance.
+  //! @param[in]  thePoints the points to classify
+  //! @param[in]  theTol    tolerance of the classification
+  //! @param[out] theStates states of the points with the same indices as the points
+  Standard_EXPORT void Perform(const NCollection_Array1<gp_Pnt>& thePoints,
+                               const double                      theTol,
+                               NCollection_Array1<TopAbs_State>& theStates);
+
+  //! Returns the number of points of the last classification
+  //! classified exactly by BRepClass3d_SolidClassifier.
+  int NbExactlyClassified() const { return myNbExact; }
+
+  //! Classifies the point using the triangulation only.
+  //! Returns TopAbs_UNKNOWN if the point should be classified exactly,
+  //! i.e. if it is close to the boundary or no reliable rays have been found.
+  //! The method may be called concurrently.
+  Standard_EXPORT TopAbs_State ClassifyByTriangulation(const gp_Pnt& thePoint,
+                                                       const double  theTol) const;
+
+private:
+  //! Returns true if a triangle is closer to the point than the distance.
+  bool isNear(const BVH_Vec3d& thePoint, const double theDistance) const;
+
+  //! Returns the parity of the number of intersections of the ray with triangles,
+  //! or -1 if the ray is not reliable.
+  int rayParity(const BVH_Vec3d& theOrigin, const BVH_Vec3d& theDirection) const;
+
+private:
+  BRepClass3d_BatchClassifier(const BRepClass3d_BatchClassifier&)            = delete;
+  BRepClass3d_BatchClassifier& operator=(const BRepClass3d_BatchClassifier&) = delete;
+
+private:
+  TopoDS_Shape                         myShape;
+  occ::handle<BRepExtrema_TriangleSet> myTriangles; //!< triangulation of the faces
+  occ::handle<BVH_Tree<double, 3>>     myTree;      //!< hierarchy of the triangles
+  double myBand; //!< deflection of the triangulation and tolerance of the shape
+  bool   myRunParallel;
+  int    myNbExact;
+};
+
+#endif // _BRepClass3d_BatchClassifier_HeaderFile
@@ -0,0 +1,49 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#ifndef _BRepExtrema_OverlapBackend_HeaderFile
+#define _BRepExtrema_OverlapBackend_HeaderFile
+
+#include <BVH_Tree.hxx>
+#include <NCollection_Vec2.hxx>
+#include <NCollection_Vector.hxx>
+#include <Standard_Transient.hxx>
+
+//! Interface of the external (e.g. GPU) implementation of the broad phase of the overlap test
+//! of two BVH trees of triangles (see BRepExtrema_OverlapTool::SetBackend()).
+//!
+//! The backend only finds the pairs of leaves of the trees whose boxes may overlap;
+//! the boxes of the found pairs are checked again and the triangles of the leaves are
+//! intersected by BRepExtrema_OverlapTool itself in double precision, so that the results
+//! do not depend on the numerical precision of the backend.
+class BRepExtrema_OverlapBackend : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(BRepExtrema_OverlapBackend, Standard_Transient)
+public:
+  //! Finds the pairs of leaves of the trees with overlapping boxes.
+  //! The result should contain all pairs of leaves (index of node in the 1st tree,
+  //! index of node in the 2nd tree) whose boxes are within the tolerance from each other;
+  //! extra pairs are allowed and are rejected by the caller.
+  //! @param[in]  theTree1     BVH tree of the 1st triangle set
+  //! @param[in]  theTree2     BVH tree of the 2nd triangle set
+  //! @param[in]  theTolerance maximum distance between the boxes
+  //! @param[out] theLeafPairs found pairs of leaves
+  //! @return FALSE if the backend failed, so that the test should be performed on CPU
+  virtual bool FindLeafPairs(const occ::handle<BVH_Tree<double, 3>>&   theTree1,
+                             const occ::handle<BVH_Tree<double, 3>>&   theTree2,
+                             const double                              theTolerance,
+                             NCollection_Vector<NCollection_Vec2<int>>& theLeafPairs) = 0;
+};
+
+#endif // _BRepExtrema_OverlapBackend_HeaderFile
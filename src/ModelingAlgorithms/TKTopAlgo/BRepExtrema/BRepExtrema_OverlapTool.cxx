@@ -649,11 +649,82 @@ void BRepExtrema_OverlapTool::Perform(const double theTolerance)
 {
   myTolerance = theTolerance;
 
+  if (!myBackend.IsNull() && performWithBackend())
+  {
+    return;
+  }
+
   myIsDone = (this->Select(mySet1->BVH(), mySet2->BVH()) > 0);
 }
 
 //=================================================================================================
 
+bool BRepExtrema_OverlapTool::performWithBackend()
+{
+  const occ::handle<BVH_Tree<double, 3>>& aBVH1 = mySet1->BVH();
+  const occ::handle<BVH_Tree<double, 3>>& aBVH2 = mySet2->BVH();
+  if (aBVH1.IsNull() || aBVH2.IsNull() || aBVH1->Length() == 0 || aBVH2->Length() == 0)
+  {
+    myIsDone = false;
+    return true;
+  }
+
+  NCollection_Vector<NCollection_Vec2<int>> aLeafPairs;
+  if (!myBackend->FindLeafPairs(aBVH1, aBVH2, myTolerance, aLeafPairs))
+  {
+    return false;
+  }
+
+  // validate the output of the backend before using it
+  for (NCollection_Vector<NCollection_Vec2<int>>::Iterator aPairIt(aLeafPairs); aPairIt.More();
+       aPairIt.Next())
+  {
+    const NCollection_Vec2<int>& aPair = aPairIt.Value();
+    if (aPair.x() < 0 || aPair.x() >= aBVH1->Length() || aPair.y() < 0
+        || aPair.y() >= aBVH2->Length() || !aBVH1->IsOuter(aPair.x())
+        || !aBVH2->IsOuter(aPair.y()))
+    {
+      return false;
+    }
+  }
+
+  // re-check the boxes in double precision and test the triangles as the traversal does
+  int aNbAccepted = 0;
+  for (NCollection_Vector<NCollection_Vec2<int>>::Iterator aPairIt(aLeafPairs); aPairIt.More();
+       aPairIt.Next())
+  {
+    const int aNode1 = aPairIt.Value().x();
+    const int aNode2 = aPairIt.Value().y();
+    double    aMetric;
+    if (RejectNode(aBVH1->MinPoint(aNode1),
+                   aBVH1->MaxPoint(aNode1),
+                   aBVH2->MinPoint(aNode2),
+                   aBVH2->MaxPoint(aNode2),
+                   aMetric))
+    {
+      continue;
+    }
+
+    for (int aTrgIdx1 = aBVH1->BegPrimitive(aNode1); aTrgIdx1 <= aBVH1->EndPrimitive(aNode1);
+         ++aTrgIdx1)
+    {
+      for (int aTrgIdx2 = aBVH2->BegPrimitive(aNode2); aTrgIdx2 <= aBVH2->EndPrimitive(aNode2);
+           ++aTrgIdx2)
+      {
+        if (Accept(aTrgIdx1, aTrgIdx2))
+        {
+          ++aNbAccepted;
+        }
+      }
+    }
+  }
+
+  myIsDone = aNbAccepted > 0;
+  return true;
+}
+
+//=================================================================================================
+
 bool BRepExtrema_OverlapTool::RejectNode(const BVH_Vec3d& theCornerMin1,
                                          const BVH_Vec3d& theCornerMax1,
                                          const BVH_Vec3d& theCornerMin2,
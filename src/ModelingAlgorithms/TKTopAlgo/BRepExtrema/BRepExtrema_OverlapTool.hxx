@@ -18,6 +18,7 @@
 
 #include <BRepExtrema_TriangleSet.hxx>
 #include <BRepExtrema_ElementFilter.hxx>
+#include <BRepExtrema_OverlapBackend.hxx>
 #include <NCollection_DataMap.hxx>
 #include <TColStd_PackedMapOfInteger.hxx>
 #include <BVH_Traverse.hxx>
@@ -83,6 +84,17 @@ public:
   //! Sets filtering tool for preliminary checking pairs of mesh elements.
   void SetElementFilter(BRepExtrema_ElementFilter* theFilter) { myFilter = theFilter; }
 
+  //! Returns the backend used for the search of overlapped BVH leaves (NULL by default).
+  const occ::handle<BRepExtrema_OverlapBackend>& Backend() const { return myBackend; }
+
+  //! Sets the backend (e.g. GPU one) used for the search of overlapped BVH leaves.
+  //! The triangles of the found leaves are tested on CPU, thus the results are the same
+  //! as without backend. NULL backend or its failure means traversal of the trees on CPU.
+  void SetBackend(const occ::handle<BRepExtrema_OverlapBackend>& theBackend)
+  {
+    myBackend = theBackend;
+  }
+
 public: //! @name Reject/Accept implementations
   //! Defines the rules for node rejection by bounding box
   Standard_EXPORT bool RejectNode(const BVH_Vec3d& theCornerMin1,
@@ -100,6 +112,10 @@ protected:
   //! Performs narrow-phase of overlap test (intersection with non-zero tolerance).
   void intersectTrianglesToler(const int theTrgIdx1, const int theTrgIdx2, const double theToler);
 
+  //! Tests the triangles of the leaves found by the backend.
+  //! Returns FALSE if the backend has failed.
+  bool performWithBackend();
+
 private:
   //! Set of all mesh elements (triangles) of the 1st shape.
   occ::handle<BRepExtrema_TriangleSet> mySet1;
@@ -109,6 +125,9 @@ private:
   //! Filter for preliminary checking pairs of mesh elements.
   BRepExtrema_ElementFilter* myFilter;
 
+  //! Backend for the search of overlapped BVH leaves.
+  occ::handle<BRepExtrema_OverlapBackend> myBackend;
+
   //! Resulted set of overlapped sub-shapes of 1st shape (only faces).
   NCollection_DataMap<int, TColStd_PackedMapOfInteger> myOverlapSubShapes1;
   //! Resulted set of overlapped sub-shapes of 2nd shape (only faces).
@@ -50,6 +50,13 @@ public:
   //! Sets tolerance value used for self-intersection test.
   void SetTolerance(const double theTolerance) { myTolerance = theTolerance; }
 
+  //! Sets the backend (e.g. GPU one) used for the search of overlapped BVH leaves
+  //! of the triangle sets; the results do not depend on the backend.
+  void SetOverlapBackend(const occ::handle<BRepExtrema_OverlapBackend>& theBackend)
+  {
+    myOverlapTool.SetBackend(theBackend);
+  }
+
   //! Loads shape for detection of self-intersections.
   Standard_EXPORT bool LoadShape(const TopoDS_Shape& theShape);
 
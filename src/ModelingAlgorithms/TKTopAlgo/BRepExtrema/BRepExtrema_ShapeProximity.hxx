@@ -81,6 +81,13 @@ public:
   //! In case of 0, all triangulation nodes will be used.
   void SetNbSamples2(const int theNbSamples) { myNbSamples2 = theNbSamples; }
 
+  //! Sets the backend (e.g. GPU one) used for the search of overlapped BVH leaves
+  //! of the triangle sets; the results do not depend on the backend.
+  void SetOverlapBackend(const occ::handle<BRepExtrema_OverlapBackend>& theBackend)
+  {
+    myOverlapTool.SetBackend(theBackend);
+  }
+
   //! Performs search of overlapped faces.
   Standard_EXPORT void Perform();
 
@@ -0,0 +1,359 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <BRepExtrema_ShapeSetDistance.hxx>
+
+#include <Bnd_Box.hxx>
+#include <Bnd_Tools.hxx>
+#include <BRepBndLib.hxx>
+#include <BRepExtrema_DistShapeShape.hxx>
+#include <BVH_LinearBuilder.hxx>
+#include <BVH_Tools.hxx>
+#include <BVH_Traverse.hxx>
+#include <Message_ProgressScope.hxx>
+#include <NCollection_Array1.hxx>
+#include <OSD_Parallel.hxx>
+#include <OSD_ThreadPool.hxx>
+
+#include <algorithm>
+
+namespace
+{
+//! Shape of the set selected for computation of the distance.
+struct Candidate
+{
+  int    Index;        //!< index of the shape in the set
+  double LowerBound;   //!< distance between the bounding boxes
+  double Distance;     //!< computed distance
+  gp_Pnt PointOnShape; //!< point of the distance on the given shape
+  gp_Pnt PointOnSet;   //!< point of the distance on the shape of the set
+  bool   IsDone;       //!< true if the distance has been computed
+
+  bool operator<(const Candidate& theOther) const { return LowerBound < theOther.LowerBound; }
+};
+
+//! Returns the square of the maximal distance between the points of the boxes,
+//! i.e. the upper bound of the distance between the shapes contained in the boxes.
+static double boxBoxSquareMaxDistance(const BVH_Box<double, 3>& theBox1,
+                                      const BVH_Box<double, 3>& theBox2)
+{
+  double aSqDist = 0.0;
+  for (int anAxis = 0; anAxis < 3; ++anAxis)
+  {
+    const double aDist = std::max(theBox1.CornerMax()[anAxis] - theBox2.CornerMin()[anAxis],
+                                  theBox2.CornerMax()[anAxis] - theBox1.CornerMin()[anAxis]);
+    aSqDist += aDist * aDist;
+  }
+  return aSqDist;
+}
+
+//! Selector of the boxes of the set located closer to the box of the shape than the bound.
+//! In the mode of search of the nearest shape the bound is decreased by the upper bounds
+//! of the distances to the selected boxes.
+class CandidateSelector : public BVH_Traverse<double, 3, BVH_BoxSet<double, 3, int>, double>
+{
+public:
+  CandidateSelector(const BVH_Box<double, 3>&      theBox,
+                    const double                   theSqBound,
+                    const bool                     theToUpdateBound,
+                    NCollection_Vector<Candidate>& theCandidates)
+      : myBox(theBox),
+        mySqBound(theSqBound),
+        myToUpdateBound(theToUpdateBound),
+        myCandidates(theCandidates)
+  {
+  }
+
+  //! Returns the square of the bound of the distance.
+  double SquareBound() const { return mySqBound; }
+
+  bool RejectNode(const BVH_Vec3d& theCMin,
+                  const BVH_Vec3d& theCMax,
+                  double&          theMetric) const override
+  {
+    theMetric = BVH_Tools<double, 3>::BoxBoxSquareDistance(myBox.CornerMin(),
+                                                           myBox.CornerMax(),
+                                                           theCMin,
+                                                           theCMax);
+    return RejectMetric(theMetric);
+  }
+
+  bool RejectMetric(const double& theMetric) const override { return theMetric > mySqBound; }
+
+  bool IsMetricBetter(const double& theLeft, const double& theRight) const override
+  {
+    return theLeft < theRight;
+  }
+
+  bool Accept(const int theIndex, const double&) override
+  {
+    const BVH_Box<double, 3> aBox    = myBVHSet->Box(theIndex);
+    const double             aSqDist = BVH_Tools<double, 3>::BoxBoxSquareDistance(myBox, aBox);
+    if (aSqDist > mySqBound)
+    {
+      return false;
+    }
+
+    Candidate aCandidate;
+    aCandidate.Index      = myBVHSet->Element(theIndex);
+    aCandidate.LowerBound = std::sqrt(aSqDist);
+    aCandidate.Distance   = Precision::Infinite();
+    aCandidate.IsDone     = false;
+    myCandidates.Append(aCandidate);
+    if (myToUpdateBound)
+    {
+      mySqBound = std::min(mySqBound, boxBoxSquareMaxDistance(myBox, aBox));
+    }
+    return true;
+  }
+
+private:
+  BVH_Box<double, 3>             myBox;
+  double                         mySqBound;
+  bool                           myToUpdateBound;
+  NCollection_Vector<Candidate>& myCandidates;
+};
+
+//! Functor computing the distances between the shape and the candidates.
+class DistanceFunctor
+{
+public:
+  DistanceFunctor(const TopoDS_Shape&                     theShape,
+                  const NCollection_Vector<TopoDS_Shape>& theShapes,
+                  const double                            theEps,
+                  const int                               theFirst,
+                  NCollection_Array1<Candidate>&          theCandidates)
+      : myShape(theShape),
+        myShapes(theShapes),
+        myEps(theEps),
+        myFirst(theFirst),
+        myCandidates(theCandidates)
+  {
+  }
+
+  void operator()(const int theIndex) const
+  {
+    Candidate&                 aCandidate = myCandidates(myFirst + theIndex);
+    BRepExtrema_DistShapeShape aDistTool;
+    aDistTool.SetDeflection(myEps);
+    aDistTool.LoadS1(myShape);
+    aDistTool.LoadS2(myShapes(aCandidate.Index));
+    if (!aDistTool.Perform() || aDistTool.NbSolution() == 0)
+    {
+      return;
+    }
+    aCandidate.Distance     = aDistTool.Value();
+    aCandidate.PointOnShape = aDistTool.PointOnShape1(1);
+    aCandidate.PointOnSet   = aDistTool.PointOnShape2(1);
+    aCandidate.IsDone       = true;
+  }
+
+private:
+  const TopoDS_Shape&                     myShape;
+  const NCollection_Vector<TopoDS_Shape>& myShapes;
+  const double                            myEps;
+  const int                               myFirst;
+  NCollection_Array1<Candidate>&          myCandidates;
+};
+} // namespace
+
+//=================================================================================================
+
+BRepExtrema_ShapeSetDistance::BRepExtrema_ShapeSetDistance()
+    : myEps(Precision::Confusion()),
+      myIsMultiThread(false),
+      myIsDone(false),
+      myValue(Precision::Infinite()),
+      myNearest(-1),
+      myNbComputed(0)
+{
+}
+
+//=================================================================================================
+
+BRepExtrema_ShapeSetDistance::BRepExtrema_ShapeSetDistance(
+  const NCollection_Vector<TopoDS_Shape>& theShapes)
+    : myEps(Precision::Confusion()),
+      myIsMultiThread(false),
+      myIsDone(false),
+      myValue(Precision::Infinite()),
+      myNearest(-1),
+      myNbComputed(0)
+{
+  Load(theShapes);
+}
+
+//=================================================================================================
+
+void BRepExtrema_ShapeSetDistance::Load(const NCollection_Vector<TopoDS_Shape>& theShapes)
+{
+  myShapes = theShapes;
+  myBoxSet = new BVH_BoxSet<double, 3, int>(new BVH_LinearBuilder<double, 3>());
+  myBoxSet->SetSize(theShapes.Length());
+  for (int anIndex = 0; anIndex < theShapes.Length(); ++anIndex)
+  {
+    const TopoDS_Shape& aShape = theShapes(anIndex);
+    if (aShape.IsNull())
+    {
+      continue;
+    }
+    Bnd_Box aBox;
+    BRepBndLib::Add(aShape, aBox);
+    if (!aBox.IsVoid())
+    {
+      myBoxSet->Add(anIndex, Bnd_Tools::Bnd2BVH(aBox));
+    }
+  }
+  myBoxSet->Build();
+  myIsDone = false;
+}
+
+//=================================================================================================
+
+bool BRepExtrema_ShapeSetDistance::Perform(const TopoDS_Shape&          theShape,
+                                           const Message_ProgressRange& theRange)
+{
+  return perform(theShape, Precision::Infinite(), false, theRange);
+}
+
+//=================================================================================================
+
+bool BRepExtrema_ShapeSetDistance::PerformClearance(const TopoDS_Shape&          theShape,
+                                                    const double                 theClearance,
+                                                    const bool                   theToStopAtFirst,
+                                                    const Message_ProgressRange& theRange)
+{
+  return perform(theShape, std::max(theClearance, 0.0), theToStopAtFirst, theRange);
+}
+
+//=================================================================================================
+
+bool BRepExtrema_ShapeSetDistance::perform(const TopoDS_Shape&          theShape,
+                                           const double                 theClearance,
+                                           const bool                   theToStopAtFirst,
+                                           const Message_ProgressRange& theRange)
+{
+  myIsDone     = false;
+  myValue      = Precision::Infinite();
+  myNearest    = -1;
+  myNbComputed = 0;
+  myCloseShapes.Clear();
+  if (theShape.IsNull() || myBoxSet.IsNull())
+  {
+    return false;
+  }
+
+  Bnd_Box aBox;
+  BRepBndLib::Add(theShape, aBox);
+  if (aBox.IsVoid())
+  {
+    return false;
+  }
+
+  // select the candidates by the distance between the bounding boxes
+  const bool   isNearest = Precision::IsInfinite(theClearance);
+  const double aSqBound  = isNearest ? Precision::Infinite() : theClearance * theClearance;
+  NCollection_Vector<Candidate> aSelected;
+  CandidateSelector aSelector(Bnd_Tools::Bnd2BVH(aBox), aSqBound, isNearest, aSelected);
+  aSelector.SetBVHSet(myBoxSet.get());
+  aSelector.Select();
+
+  // the final upper bound allows rejecting the candidates selected before it has decreased
+  int aNbCandidates = 0;
+  for (NCollection_Vector<Candidate>::Iterator anIt(aSelected); anIt.More(); anIt.Next())
+  {
+    if (anIt.Value().LowerBound * anIt.Value().LowerBound <= aSelector.SquareBound())
+    {
+      ++aNbCandidates;
+    }
+  }
+
+  Message_ProgressScope aPS(theRange, "Computing distances", std::max(aNbCandidates, 1));
+  if (aNbCandidates == 0)
+  {
+    myIsDone = true;
+    return myIsDone;
+  }
+
+  NCollection_Array1<Candidate> aCandidates(0, aNbCandidates - 1);
+  int                           aNbAdded = 0;
+  for (NCollection_Vector<Candidate>::Iterator anIt(aSelected); anIt.More(); anIt.Next())
+  {
+    if (anIt.Value().LowerBound * anIt.Value().LowerBound <= aSelector.SquareBound())
+    {
+      aCandidates(aNbAdded++) = anIt.Value();
+    }
+  }
+  std::stable_sort(aCandidates.begin(), aCandidates.end());
+
+  // compute the distances to the candidates in the order of increasing lower bounds
+  // by the groups processed in parallel, stopping as soon as the result is defined
+  const int aNbThreads =
+    myIsMultiThread ? std::max(OSD_ThreadPool::DefaultPool()->NbThreads(), 1) : 1;
+  const int aGroupSize = (isNearest || theToStopAtFirst) ? aNbThreads : aNbCandidates;
+  for (int aFirst = 0; aFirst < aNbCandidates;)
+  {
+    int aLast = std::min(aFirst + aGroupSize, aNbCandidates);
+    if (isNearest)
+    {
+      while (aLast > aFirst && aCandidates(aLast - 1).LowerBound >= myValue)
+      {
+        --aLast;
+      }
+      if (aLast == aFirst)
+      {
+        break;
+      }
+    }
+
+    DistanceFunctor aFunctor(theShape, myShapes, myEps, aFirst, aCandidates);
+    OSD_Parallel::For(0, aLast - aFirst, aFunctor, !myIsMultiThread);
+
+    for (int anIndex = aFirst; anIndex < aLast; ++anIndex)
+    {
+      const Candidate& aCandidate = aCandidates(anIndex);
+      if (!aCandidate.IsDone)
+      {
+        continue;
+      }
+      ++myNbComputed;
+      if (aCandidate.Distance < myValue)
+      {
+        myValue        = aCandidate.Distance;
+        myNearest      = aCandidate.Index;
+        myPointOnShape = aCandidate.PointOnShape;
+        myPointOnSet   = aCandidate.PointOnSet;
+      }
+      if (!isNearest && aCandidate.Distance < theClearance)
+      {
+        myCloseShapes.Append(aCandidate.Index);
+      }
+    }
+
+    aPS.Next(aLast - aFirst);
+    if (!aPS.More())
+    {
+      return false;
+    }
+    aFirst = aLast;
+    if (theToStopAtFirst && !myCloseShapes.IsEmpty())
+    {
+      break;
+    }
+  }
+
+  std::sort(myCloseShapes.begin(), myCloseShapes.end());
+  myIsDone = true;
+  return myIsDone;
+}
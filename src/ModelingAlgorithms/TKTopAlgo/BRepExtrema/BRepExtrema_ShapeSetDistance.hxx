@@ -0,0 +1,137 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#ifndef _BRepExtrema_ShapeSetDistance_HeaderFile
+#define _BRepExtrema_ShapeSetDistance_HeaderFile
+
+#include <BVH_BoxSet.hxx>
+#include <Message_ProgressRange.hxx>
+#include <NCollection_Vector.hxx>
+#include <Precision.hxx>
+#include <Standard_DefineAlloc.hxx>
+#include <TopoDS_Shape.hxx>
+#include <gp_Pnt.hxx>
+
+//! @brief Tool class for computation of the minimal distance between a shape
+//! and a set of shapes (one versus many), e.g. for clearance checks of a moving part
+//! against a large number of static parts.
+//!
+//! The bounding boxes of the shapes of the set are organized into the bounding volume
+//! hierarchy once on loading. For the given shape the candidates are selected by the
+//! lower bound of the distance given by the distance between the bounding boxes,
+//! and the exact distances to the candidates are computed by BRepExtrema_DistShapeShape
+//! in the order of increasing lower bound, optionally in parallel.
+//!
+//! Two modes of the computation are available:
+//! - search of the nearest shape of the set, stopping as soon as the lower bounds
+//!   of the remaining candidates exceed the found minimal distance;
+//! - clearance check, i.e. search of the shapes of the set located closer than the given
+//!   distance; the search may be stopped at the first found shape if only the fact of
+//!   the violation of the clearance is needed.
+class BRepExtrema_ShapeSetDistance
+{
+public:
+  DEFINE_STANDARD_ALLOC
+
+  //! Creates empty tool.
+  Standard_EXPORT BRepExtrema_ShapeSetDistance();
+
+  //! Creates the tool for the given set of shapes.
+  Standard_EXPORT BRepExtrema_ShapeSetDistance(const NCollection_Vector<TopoDS_Shape>& theShapes);
+
+  //! Loads the set of shapes and builds the hierarchy of their bounding boxes.
+  Standard_EXPORT void Load(const NCollection_Vector<TopoDS_Shape>& theShapes);
+
+  //! Returns the number of shapes of the set.
+  int NbShapes() const { return myShapes.Length(); }
+
+  //! Returns the shape of the set with the given index (started from 0).
+  const TopoDS_Shape& Shape(const int theIndex) const { return myShapes.Value(theIndex); }
+
+  //! Sets deflection of computation of the distances (see BRepExtrema_DistShapeShape).
+  void SetDeflection(const double theDeflection) { myEps = theDeflection; }
+
+  //! Returns deflection of computation of the distances.
+  double Deflection() const { return myEps; }
+
+  //! Sets the flag of parallel computation of the distances to the candidates.
+  void SetMultiThread(const bool theIsMultiThread) { myIsMultiThread = theIsMultiThread; }
+
+  //! Returns the flag of parallel computation of the distances to the candidates.
+  bool IsMultiThread() const { return myIsMultiThread; }
+
+  //! Computes the minimal distance between the shape and the shapes of the set.
+  //! Returns IsDone status.
+  Standard_EXPORT bool Perform(const TopoDS_Shape&          theShape,
+                               const Message_ProgressRange& theRange = Message_ProgressRange());
+
+  //! Searches the shapes of the set located closer to the shape than the clearance.
+  //! Returns IsDone status.
+  //! @param[in] theShape         the shape to check
+  //! @param[in] theClearance     the minimal allowed distance
+  //! @param[in] theToStopAtFirst if true, the search is stopped as soon as a shape
+  //!                             closer than the clearance is found
+  //! @param[in] theRange         the progress indicator of algorithm
+  Standard_EXPORT bool PerformClearance(
+    const TopoDS_Shape&          theShape,
+    const double                 theClearance,
+    const bool                   theToStopAtFirst = true,
+    const Message_ProgressRange& theRange         = Message_ProgressRange());
+
+  //! True if the computation is completed.
+  bool IsDone() const { return myIsDone; }
+
+  //! Returns the minimal of the computed distances, or Precision::Infinite()
+  //! if no distance has been computed.
+  //! In clearance mode it is not necessarily the distance to the nearest shape of the set.
+  double Value() const { return myValue; }
+
+  //! Returns the index of the shape of the set at the distance Value(), or -1.
+  int NearestIndex() const { return myNearest; }
+
+  //! Returns the point on the given shape at the distance Value() from the set.
+  const gp_Pnt& PointOnShape() const { return myPointOnShape; }
+
+  //! Returns the point on the shape of the set at the distance Value() from the given shape.
+  const gp_Pnt& PointOnSet() const { return myPointOnSet; }
+
+  //! Returns the sorted indices of the shapes of the set located closer than the clearance
+  //! found by the last clearance check.
+  const NCollection_Vector<int>& CloseShapes() const { return myCloseShapes; }
+
+  //! Returns the number of exact distance computations performed by the last run.
+  int NbComputed() const { return myNbComputed; }
+
+private:
+  //! Selects the candidates and computes the distances to them.
+  bool perform(const TopoDS_Shape&          theShape,
+               const double                 theClearance,
+               const bool                   theToStopAtFirst,
+               const Message_ProgressRange& theRange);
+
+private:
+  NCollection_Vector<TopoDS_Shape>        myShapes;
+  occ::handle<BVH_BoxSet<double, 3, int>> myBoxSet; //!< boxes of the shapes of the set
+  double                                  myEps;
+  bool                                    myIsMultiThread;
+  bool                                    myIsDone;
+  double                                  myValue;
+  int                                     myNearest;
+  gp_Pnt                                  myPointOnShape;
+  gp_Pnt                                  myPointOnSet;
+  NCollection_Vector<int>                 myCloseShapes;
+  int                                     myNbComputed;
+};
+
+#endif // _BRepExtrema_ShapeSetDistance_HeaderFile
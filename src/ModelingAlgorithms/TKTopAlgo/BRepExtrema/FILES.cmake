@@ -18,6 +18,8 @@ set(OCCT_BRepExtrema_FILES
   BRepExtrema_ExtPF.cxx
   BRepExtrema_ExtPF.hxx
 
+  BRepExtrema_OverlapBackend.cxx
+  BRepExtrema_OverlapBackend.hxx
   BRepExtrema_OverlapTool.cxx
   BRepExtrema_OverlapTool.hxx
   BRepExtrema_Poly.cxx
@@ -31,6 +33,8 @@ set(OCCT_BRepExtrema_FILES
 
   BRepExtrema_ShapeProximity.cxx
   BRepExtrema_ShapeProximity.hxx
+  BRepExtrema_ShapeSetDistance.cxx
+  BRepExtrema_ShapeSetDistance.hxx
   BRepExtrema_SolutionElem.hxx
   BRepExtrema_SupportType.hxx
   BRepExtrema_TriangleSet.cxx
@@ -28,7 +28,11 @@
 #include <TopoDS_Shape.hxx>
 #include <TopTools_ShapeMapHasher.hxx>
 #include <NCollection_Map.hxx>
+#include <NCollection_Vector.hxx>
 #include <BRepCheck_Shell.hxx>
+#include <OSD_Parallel.hxx>
+
+#include <type_traits>
 
 #ifdef OCCT_DEBUG
 static int AffichEps = 0;
@@ -115,123 +119,223 @@ void BRepGProp::LinearProperties(const TopoDS_Shape& S,
   }
 }
 
-static double surfaceProperties(const TopoDS_Shape& S,
-                                GProp_GProps&       Props,
-                                const double        Eps,
-                                const bool          SkipShared,
-                                const bool          UseTriangulation)
+namespace
 {
-  int i;
-#ifdef OCCT_DEBUG
-  int iErrorMax = 0;
-#endif
-  double           ErrorMax = 0.0, Error;
-  TopExp_Explorer  ex;
-  gp_Pnt           P(roughBaryCenter(S));
-  BRepGProp_Sinert G;
-  G.SetLocation(P);
-  BRepGProp_MeshProps MG(BRepGProp_MeshProps::Sinert);
-  MG.SetLocation(P);
-
-  BRepGProp_Face                                         BF;
-  BRepGProp_Domain                                       BD;
-  NCollection_Map<TopoDS_Shape, TopTools_ShapeMapHasher> aFMap;
-  TopLoc_Location                                        aLocDummy;
+//! Defines the faces for which the triangulation is used instead of the surface.
+enum MeshUsage
+{
+  MeshUsage_NoSurface,  //!< faces without surface only
+  MeshUsage_Always,     //!< all faces having triangulation
+  MeshUsage_IfAccurate, //!< faces having triangulation with estimated error within tolerance
+};
 
-  for (ex.Init(S, TopAbs_FACE), i = 1; ex.More(); ex.Next(), i++)
+//! Properties of a single face.
+struct FaceProps
+{
+  GProp_GProps Props;
+  double       Error      = 0.0;
+  bool         IsComputed = false;
+};
+
+//! Computes the surface (InertType = BRepGProp_Sinert) or volume (InertType = BRepGProp_Vinert)
+//! properties of the face relatively the point theLoc.
+//! Adaptive integration is used for theEps < 1.0 only.
+template <class InertType>
+void faceProperties(const TopoDS_Face& theFace,
+                    const gp_Pnt&      theLoc,
+                    const double       theEps,
+                    const MeshUsage    theMeshUsage,
+                    FaceProps&         theResult)
+{
+  TopLoc_Location                        aLoc;
+  const bool                             hasSurf = !BRep_Tool::Surface(theFace, aLoc).IsNull();
+  const occ::handle<Poly_Triangulation>& aTri    = BRep_Tool::Triangulation(theFace, aLoc);
+  const bool hasTri = !aTri.IsNull() && aTri->NbNodes() > 0 && aTri->NbTriangles() > 0;
+  if (hasTri && (!hasSurf || theMeshUsage != MeshUsage_NoSurface))
   {
-    const TopoDS_Face& F = TopoDS::Face(ex.Current());
-    if (SkipShared && !aFMap.Add(F))
+    BRepGProp_MeshProps aMeshProps(std::is_same<InertType, BRepGProp_Vinert>::value
+                                     ? BRepGProp_MeshProps::Vinert
+                                     : BRepGProp_MeshProps::Sinert);
+    aMeshProps.SetLocation(theLoc);
+    aMeshProps.Perform(aTri, aLoc, theFace.Orientation());
+    if (!hasSurf || theMeshUsage == MeshUsage_Always)
     {
-      continue;
+      theResult.Props      = aMeshProps;
+      theResult.IsComputed = true;
+      return;
     }
-
-    bool NoSurf = false, NoTri = false;
+    if (aTri->Deflection() > 0.0 && aMeshProps.GetEpsilon() <= theEps)
     {
-      const occ::handle<Geom_Surface>& aSurf = BRep_Tool::Surface(F, aLocDummy);
-      if (aSurf.IsNull())
-      {
-        NoSurf = true;
-      }
-      const occ::handle<Poly_Triangulation>& aTri = BRep_Tool::Triangulation(F, aLocDummy);
-      if (aTri.IsNull() || aTri->NbNodes() == 0 || aTri->NbTriangles() == 0)
-      {
-        NoTri = true;
-      }
-      if (NoTri && NoSurf)
-      {
-        continue;
-      }
+      theResult.Props      = aMeshProps;
+      theResult.Error      = aMeshProps.GetEpsilon();
+      theResult.IsComputed = true;
+      return;
     }
+  }
+  if (!hasSurf)
+  {
+    return;
+  }
+
+  BRepGProp_Face aPropFace;
+  aPropFace.Load(theFace);
+  BRepGProp_Domain aPropDomain;
+  const bool       isNatRestr = (theFace.NbChildren() == 0);
+  if (!isNatRestr)
+  {
+    aPropDomain.Init(theFace);
+  }
 
-    if ((UseTriangulation && !NoTri) || (NoSurf && !NoTri))
+  InertType anInert;
+  anInert.SetLocation(theLoc);
+  if (theEps < 1.0)
+  {
+    if (isNatRestr)
+      anInert.Perform(aPropFace, theEps);
+    else
+      anInert.Perform(aPropFace, aPropDomain, theEps);
+    theResult.Error = anInert.GetEpsilon();
+  }
+  else
+  {
+    if (isNatRestr)
+      anInert.Perform(aPropFace);
+    else
+      anInert.Perform(aPropFace, aPropDomain);
+  }
+  theResult.Props      = anInert;
+  theResult.IsComputed = true;
+}
+
+//! Computes the properties of the faces relatively the point theLoc, probably in parallel,
+//! and adds them to theProps in the order of the faces.
+//! Returns the maximal error of the faces.
+template <class InertType>
+double facesProperties(const NCollection_Vector<TopoDS_Face>& theFaces,
+                       const gp_Pnt&                          theLoc,
+                       GProp_GProps&                          theProps,
+                       const double                           theEps,
+                       const MeshUsage                        theMeshUsage,
+                       const bool                             theIsParallel)
+{
+  if (theFaces.IsEmpty())
+  {
+    return 0.0;
+  }
+
+  NCollection_Array1<FaceProps> aFaceProps(0, theFaces.Length() - 1);
+  OSD_Parallel::For(
+    0,
+    theFaces.Length(),
+    [&](const int theIndex) {
+      faceProperties<InertType>(theFaces(theIndex),
+                                theLoc,
+                                theEps,
+                                theMeshUsage,
+                                aFaceProps(theIndex));
+    },
+    !theIsParallel || theFaces.Length() < 2);
+
+#ifdef OCCT_DEBUG
+  int iErrorMax = 0;
+#endif
+  double anErrorMax = 0.0;
+  for (int aFaceIter = 0; aFaceIter < theFaces.Length(); ++aFaceIter)
+  {
+    const FaceProps& aProps = aFaceProps(aFaceIter);
+    if (!aProps.IsComputed)
     {
-      TopAbs_Orientation                     anOri = F.Orientation();
-      const occ::handle<Poly_Triangulation>& aTri  = BRep_Tool::Triangulation(F, aLocDummy);
-      MG.Perform(aTri, aLocDummy, anOri);
-      Props.Add(MG);
+      continue;
     }
-    else
+    theProps.Add(aProps.Props);
+    if (anErrorMax < aProps.Error)
     {
-      BF.Load(F);
-      bool IsNatRestr = (F.NbChildren() == 0);
-      if (!IsNatRestr)
-        BD.Init(F);
-      if (Eps < 1.0)
-      {
-        G.Perform(BF, BD, Eps);
-        Error = G.GetEpsilon();
-        if (ErrorMax < Error)
-        {
-          ErrorMax = Error;
+      anErrorMax = aProps.Error;
 #ifdef OCCT_DEBUG
-          iErrorMax = i;
+      iErrorMax = aFaceIter + 1;
 #endif
-        }
-      }
-      else
-      {
-        if (IsNatRestr)
-          G.Perform(BF);
-        else
-          G.Perform(BF, BD);
-      }
-      Props.Add(G);
+    }
 #ifdef OCCT_DEBUG
-      if (AffichEps)
-        std::cout << "\n" << i << ":\tEpsArea = " << G.GetEpsilon();
+    if (AffichEps)
+      std::cout << "\n" << aFaceIter + 1 << ":\tEps = " << aProps.Error;
 #endif
-    }
   }
 #ifdef OCCT_DEBUG
   if (AffichEps)
-    std::cout << "\n-----------------\n" << iErrorMax << ":\tMaxError = " << ErrorMax << "\n";
+    std::cout << "\n-----------------\n" << iErrorMax << ":\tMaxError = " << anErrorMax << "\n";
 #endif
-  return ErrorMax;
+  return anErrorMax;
+}
+} // namespace
+
+//=================================================================================================
+
+static double surfaceProperties(const TopoDS_Shape& S,
+                                GProp_GProps&       Props,
+                                const double        Eps,
+                                const bool          SkipShared,
+                                const MeshUsage     theMeshUsage,
+                                const bool          theIsParallel)
+{
+  NCollection_Vector<TopoDS_Face>                        aFaces;
+  NCollection_Map<TopoDS_Shape, TopTools_ShapeMapHasher> aFMap;
+  for (TopExp_Explorer ex(S, TopAbs_FACE); ex.More(); ex.Next())
+  {
+    const TopoDS_Face& F = TopoDS::Face(ex.Current());
+    if (SkipShared && !aFMap.Add(F))
+    {
+      continue;
+    }
+    aFaces.Append(F);
+  }
+
+  return facesProperties<BRepGProp_Sinert>(aFaces,
+                                           roughBaryCenter(S),
+                                           Props,
+                                           Eps,
+                                           theMeshUsage,
+                                           theIsParallel);
 }
 
+//=================================================================================================
+
 void BRepGProp::SurfaceProperties(const TopoDS_Shape& S,
                                   GProp_GProps&       Props,
                                   const bool          SkipShared,
-                                  const bool          UseTriangulation)
+                                  const bool          UseTriangulation,
+                                  const bool          theIsParallel)
 {
   // find the origin
   gp_Pnt P(0, 0, 0);
   P.Transform(S.Location());
   Props = GProp_GProps(P);
-  surfaceProperties(S, Props, 1.0, SkipShared, UseTriangulation);
+  surfaceProperties(S,
+                    Props,
+                    1.0,
+                    SkipShared,
+                    UseTriangulation ? MeshUsage_Always : MeshUsage_NoSurface,
+                    theIsParallel);
 }
 
+//=================================================================================================
+
 double BRepGProp::SurfaceProperties(const TopoDS_Shape& S,
                                     GProp_GProps&       Props,
                                     const double        Eps,
-                                    const bool          SkipShared)
+                                    const bool          SkipShared,
+                                    const bool          UseTriangulation,
+                                    const bool          theIsParallel)
 {
   // find the origin
   gp_Pnt P(0, 0, 0);
   P.Transform(S.Location());
   Props           = GProp_GProps(P);
-  double ErrorMax = surfaceProperties(S, Props, Eps, SkipShared, false);
+  double ErrorMax = surfaceProperties(S,
+                                      Props,
+                                      Eps,
+                                      SkipShared,
+                                      UseTriangulation ? MeshUsage_IfAccurate : MeshUsage_NoSurface,
+                                      theIsParallel);
   return ErrorMax;
 }
 
@@ -241,27 +345,13 @@ static double volumeProperties(const TopoDS_Shape& S,
                                GProp_GProps&       Props,
                                const double        Eps,
                                const bool          SkipShared,
-                               const bool          UseTriangulation)
+                               const MeshUsage     theMeshUsage,
+                               const bool          theIsParallel)
 {
-  int i;
-#ifdef OCCT_DEBUG
-  int iErrorMax = 0;
-#endif
-  double           ErrorMax = 0.0, Error = 0.0;
-  TopExp_Explorer  ex;
-  gp_Pnt           P(roughBaryCenter(S));
-  BRepGProp_Vinert G;
-  G.SetLocation(P);
-  BRepGProp_MeshProps MG(BRepGProp_MeshProps::Vinert);
-  MG.SetLocation(P);
-
-  BRepGProp_Face                                         BF;
-  BRepGProp_Domain                                       BD;
+  NCollection_Vector<TopoDS_Face>                        aFaces;
   NCollection_Map<TopoDS_Shape, TopTools_ShapeMapHasher> aFwdFMap;
   NCollection_Map<TopoDS_Shape, TopTools_ShapeMapHasher> aRvsFMap;
-  TopLoc_Location                                        aLocDummy;
-
-  for (ex.Init(S, TopAbs_FACE), i = 1; ex.More(); ex.Next(), i++)
+  for (TopExp_Explorer ex(S, TopAbs_FACE); ex.More(); ex.Next())
   {
     const TopoDS_Face& F     = TopoDS::Face(ex.Current());
     TopAbs_Orientation anOri = F.Orientation();
@@ -278,82 +368,34 @@ static double volumeProperties(const TopoDS_Shape& S,
         continue;
       }
     }
-    bool NoSurf = false, NoTri = false;
-    {
-      const occ::handle<Geom_Surface>& aSurf = BRep_Tool::Surface(F, aLocDummy);
-      if (aSurf.IsNull())
-      {
-        NoSurf = true;
-      }
-      const occ::handle<Poly_Triangulation>& aTri = BRep_Tool::Triangulation(F, aLocDummy);
-      if (aTri.IsNull() || aTri->NbNodes() == 0 || aTri->NbTriangles() == 0)
-      {
-        NoTri = true;
-      }
-      if (NoTri && NoSurf)
-      {
-        continue;
-      }
-    }
-
     if (isFwd || isRvs)
     {
-      if ((UseTriangulation && !NoTri) || (NoSurf && !NoTri))
-      {
-        const occ::handle<Poly_Triangulation>& aTri = BRep_Tool::Triangulation(F, aLocDummy);
-        MG.Perform(aTri, aLocDummy, anOri);
-        Props.Add(MG);
-      }
-      else
-      {
-        BF.Load(F);
-        bool IsNatRestr = (F.NbChildren() == 0);
-        if (!IsNatRestr)
-          BD.Init(F);
-        if (Eps < 1.0)
-        {
-          G.Perform(BF, BD, Eps);
-          Error = G.GetEpsilon();
-          if (ErrorMax < Error)
-          {
-            ErrorMax = Error;
-#ifdef OCCT_DEBUG
-            iErrorMax = i;
-#endif
-          }
-        }
-        else
-        {
-          if (IsNatRestr)
-            G.Perform(BF);
-          else
-            G.Perform(BF, BD);
-        }
-        Props.Add(G);
-#ifdef OCCT_DEBUG
-        if (AffichEps)
-          std::cout << "\n" << i << ":\tEpsVolume = " << G.GetEpsilon();
-#endif
-      }
+      aFaces.Append(F);
     }
   }
-#ifdef OCCT_DEBUG
-  if (AffichEps)
-    std::cout << "\n-----------------\n" << iErrorMax << ":\tMaxError = " << ErrorMax << "\n";
-#endif
-  return ErrorMax;
+
+  return facesProperties<BRepGProp_Vinert>(aFaces,
+                                           roughBaryCenter(S),
+                                           Props,
+                                           Eps,
+                                           theMeshUsage,
+                                           theIsParallel);
 }
 
+//=================================================================================================
+
 void BRepGProp::VolumeProperties(const TopoDS_Shape& S,
                                  GProp_GProps&       Props,
                                  const bool          OnlyClosed,
                                  const bool          SkipShared,
-                                 const bool          UseTriangulation)
+                                 const bool          UseTriangulation,
+                                 const bool          theIsParallel)
 {
   // find the origin
   gp_Pnt P(0, 0, 0);
   P.Transform(S.Location());
-  Props = GProp_GProps(P);
+  Props                      = GProp_GProps(P);
+  const MeshUsage aMeshUsage = UseTriangulation ? MeshUsage_Always : MeshUsage_NoSurface;
   if (OnlyClosed)
   {
     NCollection_Map<TopoDS_Shape, TopTools_ShapeMapHasher> aShMap;
@@ -366,11 +408,11 @@ void BRepGProp::VolumeProperties(const TopoDS_Shape& S,
         continue;
       }
       if (BRep_Tool::IsClosed(Sh))
-        volumeProperties(Sh, Props, 1.0, SkipShared, UseTriangulation);
+        volumeProperties(Sh, Props, 1.0, SkipShared, aMeshUsage, theIsParallel);
     }
   }
   else
-    volumeProperties(S, Props, 1.0, SkipShared, UseTriangulation);
+    volumeProperties(S, Props, 1.0, SkipShared, aMeshUsage, theIsParallel);
 }
 
 //=================================================================================================
@@ -379,7 +421,9 @@ double BRepGProp::VolumeProperties(const TopoDS_Shape& S,
                                    GProp_GProps&       Props,
                                    const double        Eps,
                                    const bool          OnlyClosed,
-                                   const bool          SkipShared)
+                                   const bool          SkipShared,
+                                   const bool          UseTriangulation,
+                                   const bool          theIsParallel)
 {
   // find the origin
   gp_Pnt P(0, 0, 0);
@@ -389,7 +433,8 @@ double BRepGProp::VolumeProperties(const TopoDS_Shape& S,
 #ifdef OCCT_DEBUG
   int iErrorMax = 0;
 #endif
-  double ErrorMax = 0.0, Error = 0.0;
+  double          ErrorMax   = 0.0, Error = 0.0;
+  const MeshUsage aMeshUsage = UseTriangulation ? MeshUsage_IfAccurate : MeshUsage_NoSurface;
   if (OnlyClosed)
   {
     NCollection_Map<TopoDS_Shape, TopTools_ShapeMapHasher> aShMap;
@@ -403,7 +448,7 @@ double BRepGProp::VolumeProperties(const TopoDS_Shape& S,
       }
       if (BRep_Tool::IsClosed(Sh))
       {
-        Error = volumeProperties(Sh, Props, Eps, SkipShared, false);
+        Error = volumeProperties(Sh, Props, Eps, SkipShared, aMeshUsage, theIsParallel);
         if (ErrorMax < Error)
         {
           ErrorMax = Error;
@@ -415,7 +460,7 @@ double BRepGProp::VolumeProperties(const TopoDS_Shape& S,
     }
   }
   else
-    ErrorMax = volumeProperties(S, Props, Eps, SkipShared, false);
+    ErrorMax = volumeProperties(S, Props, Eps, SkipShared, aMeshUsage, theIsParallel);
 #ifdef OCCT_DEBUG
   if (AffichEps)
     std::cout << "\n\n===================" << iErrorMax << ":\tMaxEpsVolume = " << ErrorMax << "\n";
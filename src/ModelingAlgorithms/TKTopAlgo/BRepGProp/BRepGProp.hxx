@@ -130,10 +130,14 @@ public:
   //! source of geometry data. If UseTriangulation = false,
   //! exact geometry objects (surfaces) are used,
   //! otherwise face triangulations are used first.
+  //! theIsParallel is a flag to compute the properties of the faces in parallel threads;
+  //! the properties of the faces are summed up in the order of exploration,
+  //! so that the result does not depend on this flag.
   Standard_EXPORT static void SurfaceProperties(const TopoDS_Shape& S,
                                                 GProp_GProps&       SProps,
                                                 const bool          SkipShared       = false,
-                                                const bool          UseTriangulation = false);
+                                                const bool          UseTriangulation = false,
+                                                const bool          theIsParallel    = false);
 
   //! Updates <SProps> with the shape <S>, that contains its principal properties.
   //! The surface properties of all the faces in <S> are computed.
@@ -147,10 +151,20 @@ public:
   //! shared topological entities or not
   //! For ex., if SkipShared = True, faces, shared by two or more shells,
   //! are taken into calculation only once.
+  //! UseTriangulation is a special flag, which allows using the triangulation
+  //! of a face instead of its surface if the estimated relative error of the
+  //! triangulation with its deflection does not exceed Eps
+  //! (see BRepGProp_MeshProps::GetEpsilon()); the estimated error is then
+  //! taken into account in the returned value.
+  //! theIsParallel is a flag to compute the properties of the faces in parallel threads;
+  //! the properties of the faces are summed up in the order of exploration,
+  //! so that the result does not depend on this flag.
   Standard_EXPORT static double SurfaceProperties(const TopoDS_Shape& S,
                                                   GProp_GProps&       SProps,
                                                   const double        Eps,
-                                                  const bool          SkipShared = false);
+                                                  const bool          SkipShared       = false,
+                                                  const bool          UseTriangulation = false,
+                                                  const bool          theIsParallel    = false);
   //!
   //! Computes the global volume properties of the solid
   //! S, and brings them together with the global
@@ -193,11 +207,15 @@ public:
   //! source of geometry data. If UseTriangulation = false,
   //! exact geometry objects (surfaces) are used,
   //! otherwise face triangulations are used first.
+  //! theIsParallel is a flag to compute the properties of the faces in parallel threads;
+  //! the properties of the faces are summed up in the order of exploration,
+  //! so that the result does not depend on this flag.
   Standard_EXPORT static void VolumeProperties(const TopoDS_Shape& S,
                                                GProp_GProps&       VProps,
                                                const bool          OnlyClosed       = false,
                                                const bool          SkipShared       = false,
-                                               const bool          UseTriangulation = false);
+                                               const bool          UseTriangulation = false,
+                                               const bool          theIsParallel    = false);
 
   //! Updates <VProps> with the shape <S>, that contains its principal properties.
   //! The volume properties of all the FORWARD and REVERSED faces in <S> are computed.
@@ -213,11 +231,21 @@ public:
   //! For ex., if SkipShared = True, the volumes formed by the equal
   //! (the same TShape, location and orientation)
   //! faces are taken into calculation only once.
+  //! UseTriangulation is a special flag, which allows using the triangulation
+  //! of a face instead of its surface if the estimated relative error of the
+  //! triangulation with its deflection does not exceed Eps
+  //! (see BRepGProp_MeshProps::GetEpsilon()); the estimated error is then
+  //! taken into account in the returned value.
+  //! theIsParallel is a flag to compute the properties of the faces in parallel threads;
+  //! the properties of the faces are summed up in the order of exploration,
+  //! so that the result does not depend on this flag.
   Standard_EXPORT static double VolumeProperties(const TopoDS_Shape& S,
                                                  GProp_GProps&       VProps,
                                                  const double        Eps,
-                                                 const bool          OnlyClosed = false,
-                                                 const bool          SkipShared = false);
+                                                 const bool          OnlyClosed       = false,
+                                                 const bool          SkipShared       = false,
+                                                 const bool          UseTriangulation = false,
+                                                 const bool          theIsParallel    = false);
 
   //! Updates <VProps> with the shape <S>, that contains its principal properties.
   //! The volume properties of all the FORWARD and REVERSED faces in <S> are computed.
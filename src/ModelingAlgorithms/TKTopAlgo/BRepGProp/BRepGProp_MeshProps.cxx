@@ -187,6 +187,7 @@ void BRepGProp_MeshProps::Perform(const occ::handle<Poly_Triangulation>& theMesh
     {
       occ::handle<Poly_Triangulation> aCopy =
         new Poly_Triangulation(theMesh->NbNodes(), theMesh->NbTriangles(), false);
+      aCopy->Deflection(theMesh->Deflection() * std::abs(aTr.ScaleFactor()));
       NCollection_Array1<gp_Pnt> aNodes(1, theMesh->NbNodes());
       for (int i = 1; i <= theMesh->NbNodes(); ++i)
       {
@@ -239,6 +240,7 @@ void BRepGProp_MeshProps::Perform(const occ::handle<Poly_Triangulation>& theMesh
 void BRepGProp_MeshProps::Perform(const occ::handle<Poly_Triangulation>& theMesh,
                                   const TopAbs_Orientation               theOri)
 {
+  myEpsilon = 0.0;
   if (theMesh.IsNull() || theMesh->NbNodes() == 0 || theMesh->NbTriangles() == 0)
   {
     return;
@@ -268,6 +270,11 @@ void BRepGProp_MeshProps::Perform(const occ::handle<Poly_Triangulation>& theMesh
 
   bool isVolume = myType == Vinert;
   int  n1, n2, n3; // node indices
+
+  // Sums for the error estimation
+  const double aDeflection = theMesh->Deflection();
+  double       anArea      = 0.0;
+  double       anAreaError = 0.0;
   for (int i = 1; i <= theMesh->NbTriangles(); ++i)
   {
     const Poly_Triangle aTri = theMesh->Triangle(i);
@@ -281,6 +288,24 @@ void BRepGProp_MeshProps::Perform(const occ::handle<Poly_Triangulation>& theMesh
     const gp_Pnt p2 = theMesh->Node(n2);
     const gp_Pnt p3 = theMesh->Node(n3);
     CalculateProps(p1, p2, p3, loc, isVolume, aGProps, aNbGaussPoints, GPtsWg);
+
+    if (aDeflection > 0.0)
+    {
+      const gp_XYZ aD12     = p2.XYZ() - p1.XYZ();
+      const gp_XYZ aD13     = p3.XYZ() - p1.XYZ();
+      const gp_XYZ aD23     = p3.XYZ() - p2.XYZ();
+      const double aTriArea = 0.5 * aD12.Crossed(aD13).Modulus();
+      const double aSqEdge =
+        std::max(aD12.SquareModulus(), std::max(aD13.SquareModulus(), aD23.SquareModulus()));
+      anArea += aTriArea;
+      // the surface deviating by the deflection d from the chord of length h
+      // is inclined to the triangle by the angle up to 4 d / h,
+      // which stretches the area by the half of its square at most
+      if (aSqEdge > 0.0)
+      {
+        anAreaError += aTriArea * std::min(1.0, 8.0 * aDeflection * aDeflection / aSqEdge);
+      }
+    }
   }
 
   dim = aGProps[0];
@@ -305,4 +330,10 @@ void BRepGProp_MeshProps::Perform(const occ::handle<Poly_Triangulation>& theMesh
   inertia(3, 1) = -aGProps[8];
   inertia(3, 2) = -aGProps[9];
   inertia(3, 3) = aGProps[6];
+
+  if (anArea > 0.0)
+  {
+    myEpsilon = isVolume ? aDeflection * anArea / std::max(std::abs(dim), 1.e-20)
+                         : anAreaError / anArea;
+  }
 }
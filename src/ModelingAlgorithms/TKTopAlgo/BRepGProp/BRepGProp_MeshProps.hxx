@@ -41,7 +41,8 @@ public:
 
   //! Constructor takes the type of object.
   BRepGProp_MeshProps(const BRepGProp_MeshObjType theType)
-      : myType(theType)
+      : myType(theType),
+        myEpsilon(0.0)
   {
   }
 
@@ -53,6 +54,8 @@ public:
   //! over triangle surfaces using Gauss cubature formulas.
   //! Depending on the mesh object type used in constructor this method can
   //! calculate the surface or volume properties of the mesh.
+  //! If the deflection of the mesh is defined, the relative error of the properties
+  //! of the approximated surface is estimated, see GetEpsilon().
   Standard_EXPORT void Perform(const occ::handle<Poly_Triangulation>& theMesh,
                                const TopLoc_Location&                 theLoc,
                                const TopAbs_Orientation               theOri);
@@ -76,8 +79,17 @@ public:
   //! Get type of mesh object
   BRepGProp_MeshObjType GetMeshObjType() const { return myType; }
 
-private:                        //! @name private fields
-  BRepGProp_MeshObjType myType; //!< Type of geometric object
+  //! Returns the estimation of the relative error of the mass computed by the last Perform()
+  //! with respect to the surface approximated by the mesh with its deflection,
+  //! or 0 if the deflection of the mesh is not defined.
+  //! The volume error is bounded by the area of the mesh multiplied by the deflection;
+  //! the area error is estimated from the inclination of the surface to the triangles
+  //! deviating from it by the deflection.
+  double GetEpsilon() const { return myEpsilon; }
+
+private:                           //! @name private fields
+  BRepGProp_MeshObjType myType;    //!< Type of geometric object
+  double                myEpsilon; //!< Estimated relative error of the mass
 };
 
 #endif // _BRepGProp_MeshProps_HeaderFile
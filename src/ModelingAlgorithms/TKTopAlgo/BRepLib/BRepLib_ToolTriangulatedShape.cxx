@@ -15,6 +15,8 @@
 
 #include <BRep_Tool.hxx>
 #include <GeomLib.hxx>
+#include <NCollection_Map.hxx>
+#include <OSD_Parallel.hxx>
 #include <Poly.hxx>
 #include <Poly_Connect.hxx>
 #include <Precision.hxx>
@@ -22,6 +24,37 @@
 #include <TopoDS.hxx>
 #include <TopoDS_Face.hxx>
 
+namespace
+{
+//! Functor computing normals of a single face triangulation.
+class FaceNormalsFunctor
+{
+public:
+  FaceNormalsFunctor(const NCollection_Vector<TopoDS_Face>&                     theFaces,
+                     const NCollection_Vector<occ::handle<Poly_Triangulation>>& theTris,
+                     const NCollection_Vector<int>&                             theIndices)
+      : myFaces(theFaces),
+        myTris(theTris),
+        myIndices(theIndices)
+  {
+  }
+
+  void operator()(const int theIndex) const
+  {
+    const int    aFaceIndex = myIndices.Value(theIndex);
+    Poly_Connect aPolyConnect;
+    BRepLib_ToolTriangulatedShape::ComputeNormals(myFaces.Value(aFaceIndex),
+                                                  myTris.Value(aFaceIndex),
+                                                  aPolyConnect);
+  }
+
+private:
+  const NCollection_Vector<TopoDS_Face>&                     myFaces;
+  const NCollection_Vector<occ::handle<Poly_Triangulation>>& myTris;
+  const NCollection_Vector<int>&                             myIndices;
+};
+} // namespace
+
 //=================================================================================================
 
 void BRepLib_ToolTriangulatedShape::ComputeNormals(const TopoDS_Face&                     theFace,
@@ -78,3 +111,27 @@ void BRepLib_ToolTriangulatedShape::ComputeNormals(const TopoDS_Face&
     theTris->SetNormal(aNodeIter, aNorm);
   }
 }
+
+//=================================================================================================
+
+void BRepLib_ToolTriangulatedShape::ComputeNormals(
+  const NCollection_Vector<TopoDS_Face>&                     theFaces,
+  const NCollection_Vector<occ::handle<Poly_Triangulation>>& theTris,
+  const bool                                                 theToParallel)
+{
+  // the same triangulation cannot be modified by several threads at once
+  NCollection_Map<occ::handle<Poly_Triangulation>> aProcessed;
+  NCollection_Vector<int>                          anIndices;
+  for (int aFaceIter = 0; aFaceIter < theFaces.Length() && aFaceIter < theTris.Length();
+       ++aFaceIter)
+  {
+    const occ::handle<Poly_Triangulation>& aTris = theTris.Value(aFaceIter);
+    if (!aTris.IsNull() && !aTris->HasNormals() && aProcessed.Add(aTris))
+    {
+      anIndices.Append(aFaceIter);
+    }
+  }
+
+  FaceNormalsFunctor aFunctor(theFaces, theTris, anIndices);
+  OSD_Parallel::For(0, anIndices.Length(), aFunctor, !theToParallel || anIndices.Length() < 2);
+}
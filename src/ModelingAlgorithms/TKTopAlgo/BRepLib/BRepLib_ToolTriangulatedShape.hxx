@@ -14,6 +14,7 @@
 #ifndef _BrepLib_ToolTriangulatedShape_HeaderFile
 #define _BrepLib_ToolTriangulatedShape_HeaderFile
 
+#include <NCollection_Vector.hxx>
 #include <Poly_Connect.hxx>
 #include <Poly_Triangulation.hxx>
 
@@ -43,6 +44,17 @@ public:
   Standard_EXPORT static void ComputeNormals(const TopoDS_Face&                     theFace,
                                              const occ::handle<Poly_Triangulation>& theTris,
                                              Poly_Connect&                          thePolyConnect);
+
+  //! Computes nodal normals for triangulations of several faces, optionally in parallel threads.
+  //! Triangulations shared by several faces are processed only once,
+  //! triangulations already defining normals are skipped.
+  //! @param[in] theFaces      faces
+  //! @param[in] theTris       triangulations of faces with the same indices
+  //! @param[in] theToParallel flag to process faces in parallel threads
+  Standard_EXPORT static void ComputeNormals(
+    const NCollection_Vector<TopoDS_Face>&                     theFaces,
+    const NCollection_Vector<occ::handle<Poly_Triangulation>>& theTris,
+    const bool                                                 theToParallel = true);
 };
 
 #endif
@@ -0,0 +1,52 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <Bnd_Box.hxx>
+#include <Bnd_OBB.hxx>
+#include <BRep_Builder.hxx>
+#include <BRepBndLib.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <BRepPrimAPI_MakeSphere.hxx>
+#include <TopoDS_Compound.hxx>
+
+#include <gtest/gtest.h>
+
+TEST(BRepBndLib_Test, ParallelAddOptimal)
+{
+  TopoDS_Compound aCompound;
+  BRep_Builder    aBuilder;
+  aBuilder.MakeCompound(aCompound);
+  aBuilder.Add(aCompound, BRepPrimAPI_MakeBox(10.0, 20.0, 30.0).Shape());
+  aBuilder.Add(aCompound, BRepPrimAPI_MakeSphere(gp_Pnt(50.0, 0.0, 0.0), 10.0).Shape());
+  aBuilder.Add(aCompound, BRepPrimAPI_MakeCylinder(5.0, 20.0).Shape());
+
+  Bnd_Box aSeqBox, aParBox;
+  BRepBndLib::AddOptimal(aCompound, aSeqBox, false, false);
+  BRepBndLib::AddOptimal(aCompound, aParBox, false, false, true);
+  ASSERT_FALSE(aSeqBox.IsVoid());
+  EXPECT_TRUE(aSeqBox.CornerMin().IsEqual(aParBox.CornerMin(), 0.0));
+  EXPECT_TRUE(aSeqBox.CornerMax().IsEqual(aParBox.CornerMax(), 0.0));
+  EXPECT_TRUE(aSeqBox.CornerMin().IsEqual(gp_Pnt(-5.0, -10.0, -10.0), 1.e-5));
+  EXPECT_TRUE(aSeqBox.CornerMax().IsEqual(gp_Pnt(60.0, 20.0, 30.0), 1.e-5));
+
+  Bnd_OBB aSeqOBB, aParOBB;
+  BRepBndLib::AddOBB(aCompound, aSeqOBB, false, true, false);
+  BRepBndLib::AddOBB(aCompound, aParOBB, false, true, false, true);
+  ASSERT_FALSE(aSeqOBB.IsVoid());
+  EXPECT_TRUE(aSeqOBB.Center().IsEqual(aParOBB.Center(), 0.0));
+  EXPECT_EQ(aSeqOBB.XHSize(), aParOBB.XHSize());
+  EXPECT_EQ(aSeqOBB.YHSize(), aParOBB.YHSize());
+  EXPECT_EQ(aSeqOBB.ZHSize(), aParOBB.ZHSize());
+}
@@ -0,0 +1,100 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRepBuilderAPI_Copy.hxx>
+#include <BRepBuilderAPI_MakeFace.hxx>
+#include <BRepBuilderAPI_MakePolygon.hxx>
+#include <BRepBuilderAPI_Sewing.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <TopAbs_ShapeEnum.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS_Face.hxx>
+#include <TopoDS_Shape.hxx>
+#include <gp_Pnt.hxx>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+//! Returns the planar quadrangle face.
+TopoDS_Face makeQuad(const gp_Pnt& theP1,
+                     const gp_Pnt& theP2,
+                     const gp_Pnt& theP3,
+                     const gp_Pnt& theP4)
+{
+  BRepBuilderAPI_MakePolygon aPolygon(theP1, theP2, theP3, theP4, true);
+  return BRepBuilderAPI_MakeFace(aPolygon.Wire(), true).Face();
+}
+
+//! Sews the separate faces of the grid of boxes and returns the sewing tool.
+occ::handle<BRepBuilderAPI_Sewing> sewBoxGrid(const int theNbSteps, const bool theIsParallel)
+{
+  occ::handle<BRepBuilderAPI_Sewing> aSewing = new BRepBuilderAPI_Sewing(1.0e-6);
+  aSewing->SetRunParallel(theIsParallel);
+  for (int anI = 0; anI < theNbSteps; ++anI)
+  {
+    for (int aJ = 0; aJ < theNbSteps; ++aJ)
+    {
+      const TopoDS_Shape aBox =
+        BRepPrimAPI_MakeBox(gp_Pnt(2.0 * anI, 2.0 * aJ, 0.0), 1.0, 1.0, 1.0).Shape();
+      for (TopExp_Explorer anExp(aBox, TopAbs_FACE); anExp.More(); anExp.Next())
+      {
+        // Copy the face separately to obtain the faces without shared edges
+        aSewing->Add(BRepBuilderAPI_Copy(anExp.Current()).Shape());
+      }
+    }
+  }
+  aSewing->Perform();
+  return aSewing;
+}
+} // namespace
+
+TEST(BRepBuilderAPI_Sewing_Test, CuttingOfBound)
+{
+  // The bottom edge of the big face is cut by the vertex shared by two small faces
+  const gp_Pnt      aP1(0.0, 0.0, 0.0), aP2(1.0, 0.0, 0.0), aP3(2.0, 0.0, 0.0);
+  const gp_Pnt      aP4(0.0, -1.0, 0.0), aP5(1.0, -1.0, 0.0), aP6(2.0, -1.0, 0.0);
+  const TopoDS_Face aBig   = makeQuad(aP1, aP3, gp_Pnt(2.0, 1.0, 0.0), gp_Pnt(0.0, 1.0, 0.0));
+  const TopoDS_Face aLeft  = makeQuad(aP1, aP4, aP5, aP2);
+  const TopoDS_Face aRight = makeQuad(aP2, aP5, aP6, aP3);
+  for (const bool isParallel : {false, true})
+  {
+    BRepBuilderAPI_Sewing aSewing(1.0e-6);
+    aSewing.SetRunParallel(isParallel);
+    aSewing.Add(aBig);
+    aSewing.Add(aLeft);
+    aSewing.Add(aRight);
+    aSewing.Perform();
+
+    const TopoDS_Shape& aResult = aSewing.SewedShape();
+    ASSERT_FALSE(aResult.IsNull());
+    EXPECT_EQ(TopAbs_SHELL, aResult.ShapeType());
+    EXPECT_EQ(3, aSewing.NbContigousEdges());
+    EXPECT_EQ(7, aSewing.NbFreeEdges());
+    EXPECT_EQ(0, aSewing.NbMultipleEdges());
+  }
+}
+
+TEST(BRepBuilderAPI_Sewing_Test, ParallelSameAsSequential)
+{
+  const occ::handle<BRepBuilderAPI_Sewing> aSeq = sewBoxGrid(4, false);
+  const occ::handle<BRepBuilderAPI_Sewing> aPar = sewBoxGrid(4, true);
+  EXPECT_TRUE(aPar->RunParallel());
+  ASSERT_FALSE(aSeq->SewedShape().IsNull());
+  ASSERT_FALSE(aPar->SewedShape().IsNull());
+  EXPECT_EQ(aSeq->NbContigousEdges(), aPar->NbContigousEdges());
+  EXPECT_EQ(aSeq->NbFreeEdges(), aPar->NbFreeEdges());
+  EXPECT_EQ(aSeq->NbMultipleEdges(), aPar->NbMultipleEdges());
+  EXPECT_EQ(0, aPar->NbFreeEdges());
+  EXPECT_EQ(16 * 12, aPar->NbContigousEdges());
+}
@@ -0,0 +1,162 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRep_Builder.hxx>
+#include <BRep_Tool.hxx>
+#include <BRepBuilderAPI_MakeFace.hxx>
+#include <BRepBuilderAPI_MakePolygon.hxx>
+#include <BRepCheck_Analyzer.hxx>
+#include <BRepCheck_Result.hxx>
+#include <BRepCheck_SurfaceCache.hxx>
+#include <BRepCheck_Wire.hxx>
+#include <BRepTools.hxx>
+#include <gp_Pln.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Edge.hxx>
+#include <TopoDS_Face.hxx>
+#include <TopoDS_Iterator.hxx>
+#include <TopoDS_Wire.hxx>
+
+#include <gtest/gtest.h>
+
+#include <climits>
+#include <cmath>
+
+namespace
+{
+//! Makes the planar face on the closed polygon with the vertices on the circle,
+//! passing theStep vertices on each edge; the polygon is self-intersecting for theStep > 1.
+TopoDS_Face makePolygonFace(const int theNbVertices, const int theStep)
+{
+  BRepBuilderAPI_MakePolygon aPolygon;
+  for (int aVertIter = 0; aVertIter < theNbVertices; ++aVertIter)
+  {
+    const double anAngle = 2.0 * M_PI * ((aVertIter * theStep) % theNbVertices) / theNbVertices;
+    aPolygon.Add(gp_Pnt(10.0 * std::cos(anAngle), 10.0 * std::sin(anAngle), 0.0));
+  }
+  aPolygon.Close();
+  BRepBuilderAPI_MakeFace aFace(gp_Pln(), aPolygon.Wire());
+  return aFace.Face();
+}
+
+//! Returns true if the status of the wire of the face contains the given one.
+bool hasWireStatus(const BRepCheck_Analyzer& theAnalyzer,
+                   const TopoDS_Face&        theFace,
+                   const BRepCheck_Status    theStatus)
+{
+  for (TopExp_Explorer anExp(theFace, TopAbs_WIRE); anExp.More(); anExp.Next())
+  {
+    const occ::handle<BRepCheck_Result>& aResult = theAnalyzer.Result(anExp.Current());
+    if (aResult.IsNull() || !aResult->IsStatusOnShape(theFace))
+    {
+      continue;
+    }
+    for (NCollection_List<BRepCheck_Status>::Iterator aStatIter(aResult->StatusOnShape(theFace));
+         aStatIter.More();
+         aStatIter.Next())
+    {
+      if (aStatIter.Value() == theStatus)
+      {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+//! Checks that selection of pairs of edges by BVH and by brute force
+//! gives the same status and the same intersecting edges of the wire of the face.
+void checkSelfIntersectPaths(const TopoDS_Face& theFace, const BRepCheck_Status theStatus)
+{
+  const TopoDS_Wire aWire = BRepTools::OuterWire(theFace);
+
+  occ::handle<BRepCheck_Wire> aBVHCheck = new BRepCheck_Wire(aWire);
+  aBVHCheck->SetMinEdgesForBVH(1);
+  TopoDS_Edge            aBVHEdge1, aBVHEdge2;
+  const BRepCheck_Status aBVHStatus = aBVHCheck->SelfIntersect(theFace, aBVHEdge1, aBVHEdge2);
+
+  occ::handle<BRepCheck_Wire> aBruteCheck = new BRepCheck_Wire(aWire);
+  aBruteCheck->SetMinEdgesForBVH(INT_MAX);
+  TopoDS_Edge            aBruteEdge1, aBruteEdge2;
+  const BRepCheck_Status aBruteStatus =
+    aBruteCheck->SelfIntersect(theFace, aBruteEdge1, aBruteEdge2);
+
+  EXPECT_EQ(theStatus, aBruteStatus);
+  EXPECT_EQ(aBruteStatus, aBVHStatus);
+  EXPECT_TRUE(aBVHEdge1.IsSame(aBruteEdge1));
+  EXPECT_TRUE(aBVHEdge2.IsSame(aBruteEdge2));
+  EXPECT_EQ(theStatus == BRepCheck_SelfIntersectingWire, !aBVHEdge1.IsNull());
+}
+} // namespace
+
+TEST(BRepCheck_AnalyzerTest, ParallelSelfIntersectionOfLargeWire)
+{
+  // regular polygon, checked with BVH of edges
+  const TopoDS_Face aValidFace = makePolygonFace(101, 1);
+  for (const bool isParallel : {false, true})
+  {
+    BRepCheck_Analyzer anAnalyzer(aValidFace, true, isParallel);
+    EXPECT_TRUE(anAnalyzer.IsValid());
+  }
+
+  // star polygon with crossing edges
+  const TopoDS_Face aStarFace = makePolygonFace(101, 50);
+  for (const bool isParallel : {false, true})
+  {
+    BRepCheck_Analyzer anAnalyzer(aStarFace, true, isParallel);
+    EXPECT_FALSE(anAnalyzer.IsValid());
+    EXPECT_TRUE(hasWireStatus(anAnalyzer, aStarFace, BRepCheck_SelfIntersectingWire));
+  }
+
+  // small polygons are checked without BVH
+  const TopoDS_Face aSmallStar = makePolygonFace(5, 2);
+  BRepCheck_Analyzer anAnalyzer(aSmallStar, true, true);
+  EXPECT_TRUE(hasWireStatus(anAnalyzer, aSmallStar, BRepCheck_SelfIntersectingWire));
+}
+
+TEST(BRepCheck_AnalyzerTest, SurfaceCache)
+{
+  const TopoDS_Face aFace = makePolygonFace(4, 1);
+
+  occ::handle<BRepCheck_SurfaceCache> aCache = new BRepCheck_SurfaceCache();
+  const occ::handle<Geom_Surface>     aSurf  = aCache->Surface(aFace);
+  ASSERT_FALSE(aSurf.IsNull());
+  EXPECT_NE(aSurf, BRep_Tool::Surface(aFace));
+  EXPECT_EQ(aSurf, aCache->Surface(aFace));
+  EXPECT_EQ(aSurf, aCache->Surface(aFace.Reversed()));
+  EXPECT_EQ(1, aCache->Size());
+
+  aCache->Clear();
+  EXPECT_EQ(0, aCache->Size());
+}
+
+TEST(BRepCheck_AnalyzerTest, SelfIntersectByBVHAndBruteForce)
+{
+  checkSelfIntersectPaths(makePolygonFace(40, 1), BRepCheck_NoError);
+  checkSelfIntersectPaths(makePolygonFace(41, 20), BRepCheck_SelfIntersectingWire);
+  checkSelfIntersectPaths(makePolygonFace(8, 3), BRepCheck_SelfIntersectingWire);
+
+  // edge with empty range in the middle of the wire
+  const TopoDS_Face aFace = makePolygonFace(40, 1);
+  TopoDS_Iterator   anEdgeIter(BRepTools::OuterWire(aFace));
+  for (int anEdgeIndex = 1; anEdgeIndex < 10; ++anEdgeIndex)
+  {
+    anEdgeIter.Next();
+  }
+  const TopoDS_Edge& anEdge = TopoDS::Edge(anEdgeIter.Value());
+  double             aFirst = 0.0, aLast = 0.0;
+  BRep_Tool::Range(anEdge, aFirst, aLast);
+  BRep_Builder().Range(anEdge, aLast, aLast);
+  checkSelfIntersectPaths(aFace, BRepCheck_InvalidRange);
+}
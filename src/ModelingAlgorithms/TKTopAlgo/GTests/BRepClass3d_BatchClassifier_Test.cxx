@@ -0,0 +1,128 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <BRepClass3d_BatchClassifier.hxx>
+#include <BRepClass3d_SolidClassifier.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeSphere.hxx>
+#include <NCollection_Array1.hxx>
+#include <TopoDS_Shape.hxx>
+#include <gp_Pnt.hxx>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+//! Returns the points of the regular grid in the cube [-theSize, theSize].
+NCollection_Array1<gp_Pnt> makeGrid(const double theSize, const int theNbSteps)
+{
+  NCollection_Array1<gp_Pnt> aPoints(1, theNbSteps * theNbSteps * theNbSteps);
+  const double               aStep  = 2.0 * theSize / (theNbSteps - 1);
+  int                        anIndex = aPoints.Lower();
+  for (int anI = 0; anI < theNbSteps; ++anI)
+  {
+    for (int aJ = 0; aJ < theNbSteps; ++aJ)
+    {
+      for (int aK = 0; aK < theNbSteps; ++aK)
+      {
+        aPoints(anIndex++) =
+          gp_Pnt(-theSize + anI * aStep, -theSize + aJ * aStep, -theSize + aK * aStep);
+      }
+    }
+  }
+  return aPoints;
+}
+
+//! Checks the states of the points against the per-point classifier.
+void checkStates(const TopoDS_Shape&                     theShape,
+                 const NCollection_Array1<gp_Pnt>&       thePoints,
+                 const NCollection_Array1<TopAbs_State>& theStates,
+                 const double                            theTol)
+{
+  ASSERT_EQ(thePoints.Lower(), theStates.Lower());
+  ASSERT_EQ(thePoints.Upper(), theStates.Upper());
+  BRepClass3d_SolidClassifier aClassifier(theShape);
+  for (int anIndex = thePoints.Lower(); anIndex <= thePoints.Upper(); ++anIndex)
+  {
+    aClassifier.Perform(thePoints(anIndex), theTol);
+    EXPECT_EQ(aClassifier.State(), theStates(anIndex)) << "point " << anIndex;
+  }
+}
+} // namespace
+
+TEST(BRepClass3d_BatchClassifier_Test, MeshedSphere)
+{
+  const TopoDS_Shape aSphere = BRepPrimAPI_MakeSphere(10.0).Shape();
+  BRepMesh_IncrementalMesh(aSphere, 0.1);
+
+  BRepClass3d_BatchClassifier aClassifier(aSphere);
+  EXPECT_TRUE(aClassifier.IsAccelerated());
+
+  const NCollection_Array1<gp_Pnt> aPoints = makeGrid(12.0, 15);
+  NCollection_Array1<TopAbs_State> aStates;
+  aClassifier.Perform(aPoints, 1.e-7, aStates);
+  checkStates(aSphere, aPoints, aStates, 1.e-7);
+
+  // only the points close to the boundary are classified exactly
+  EXPECT_LT(aClassifier.NbExactlyClassified(), aPoints.Length() / 4);
+
+  // the point on the boundary is classified exactly
+  EXPECT_EQ(TopAbs_UNKNOWN, aClassifier.ClassifyByTriangulation(gp_Pnt(10.0, 0.0, 0.0), 1.e-7));
+  EXPECT_EQ(TopAbs_IN, aClassifier.ClassifyByTriangulation(gp_Pnt(1.0, 2.0, 3.0), 1.e-7));
+  EXPECT_EQ(TopAbs_OUT, aClassifier.ClassifyByTriangulation(gp_Pnt(9.0, 9.0, 0.0), 1.e-7));
+}
+
+TEST(BRepClass3d_BatchClassifier_Test, ParallelBox)
+{
+  const TopoDS_Shape aBox = BRepPrimAPI_MakeBox(gp_Pnt(-5.0, -5.0, -5.0), 10.0, 8.0, 6.0).Shape();
+  BRepMesh_IncrementalMesh(aBox, 0.1);
+
+  // the grid contains points on the faces, edges and vertices of the box
+  const NCollection_Array1<gp_Pnt> aPoints = makeGrid(7.0, 15);
+
+  BRepClass3d_BatchClassifier aClassifier(aBox);
+  EXPECT_TRUE(aClassifier.IsAccelerated());
+  NCollection_Array1<TopAbs_State> aSeqStates;
+  aClassifier.Perform(aPoints, 1.e-7, aSeqStates);
+  checkStates(aBox, aPoints, aSeqStates, 1.e-7);
+
+  aClassifier.SetRunParallel(true);
+  NCollection_Array1<TopAbs_State> aParStates;
+  aClassifier.Perform(aPoints, 1.e-7, aParStates);
+  for (int anIndex = aPoints.Lower(); anIndex <= aPoints.Upper(); ++anIndex)
+  {
+    EXPECT_EQ(aSeqStates(anIndex), aParStates(anIndex));
+  }
+}
+
+TEST(BRepClass3d_BatchClassifier_Test, NotMeshed)
+{
+  const TopoDS_Shape aBox = BRepPrimAPI_MakeBox(10.0, 10.0, 10.0).Shape();
+
+  // without triangulation all points are classified exactly
+  BRepClass3d_BatchClassifier aClassifier(aBox);
+  EXPECT_FALSE(aClassifier.IsAccelerated());
+
+  NCollection_Array1<gp_Pnt> aPoints(0, 2);
+  aPoints(0) = gp_Pnt(5.0, 5.0, 5.0);
+  aPoints(1) = gp_Pnt(15.0, 5.0, 5.0);
+  aPoints(2) = gp_Pnt(10.0, 5.0, 5.0);
+  NCollection_Array1<TopAbs_State> aStates;
+  aClassifier.Perform(aPoints, 1.e-7, aStates);
+  EXPECT_EQ(3, aClassifier.NbExactlyClassified());
+  EXPECT_EQ(TopAbs_IN, aStates(0));
+  EXPECT_EQ(TopAbs_OUT, aStates(1));
+  EXPECT_EQ(TopAbs_ON, aStates(2));
+}
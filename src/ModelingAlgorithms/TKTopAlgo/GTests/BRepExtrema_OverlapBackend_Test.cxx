@@ -0,0 +1,123 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <BRepExtrema_OverlapBackend.hxx>
+#include <BRepExtrema_ShapeProximity.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeSphere.hxx>
+#include <TopoDS_Shape.hxx>
+#include <gp_Pnt.hxx>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+//! Backend returning all pairs of leaves of the trees (a superset of the overlapped ones).
+class AllLeavesBackend : public BRepExtrema_OverlapBackend
+{
+public:
+  AllLeavesBackend(const bool theToFail)
+      : myToFail(theToFail),
+        myNbCalls(0)
+  {
+  }
+
+  bool FindLeafPairs(const occ::handle<BVH_Tree<double, 3>>&   theTree1,
+                     const occ::handle<BVH_Tree<double, 3>>&   theTree2,
+                     const double,
+                     NCollection_Vector<NCollection_Vec2<int>>& theLeafPairs) override
+  {
+    ++myNbCalls;
+    if (myToFail)
+    {
+      return false;
+    }
+    for (int aNode1 = 0; aNode1 < theTree1->Length(); ++aNode1)
+    {
+      for (int aNode2 = 0; aNode2 < theTree2->Length(); ++aNode2)
+      {
+        if (theTree1->IsOuter(aNode1) && theTree2->IsOuter(aNode2))
+        {
+          theLeafPairs.Append(NCollection_Vec2<int>(aNode1, aNode2));
+        }
+      }
+    }
+    return true;
+  }
+
+  int NbCalls() const { return myNbCalls; }
+
+private:
+  bool myToFail;
+  int  myNbCalls;
+};
+
+//! Checks that the maps of overlapped sub-shapes are equal.
+void checkEqual(const NCollection_DataMap<int, TColStd_PackedMapOfInteger>& theMap1,
+                const NCollection_DataMap<int, TColStd_PackedMapOfInteger>& theMap2)
+{
+  ASSERT_EQ(theMap1.Extent(), theMap2.Extent());
+  for (NCollection_DataMap<int, TColStd_PackedMapOfInteger>::Iterator anIt(theMap1); anIt.More();
+       anIt.Next())
+  {
+    const TColStd_PackedMapOfInteger* aMap = theMap2.Seek(anIt.Key());
+    ASSERT_NE(aMap, nullptr);
+    EXPECT_TRUE(aMap->IsEqual(anIt.Value()));
+  }
+}
+
+//! Checks that the proximity computed with the backend is the same as without it.
+void checkBackend(const TopoDS_Shape& theShape1,
+                  const TopoDS_Shape& theShape2,
+                  const double        theTolerance,
+                  const bool          theToFail)
+{
+  BRepExtrema_ShapeProximity aReference(theShape1, theShape2, theTolerance);
+  aReference.Perform();
+  ASSERT_TRUE(aReference.IsDone());
+  EXPECT_FALSE(aReference.OverlapSubShapes1().IsEmpty());
+
+  occ::handle<AllLeavesBackend> aBackend = new AllLeavesBackend(theToFail);
+  BRepExtrema_ShapeProximity    aTool(theShape1, theShape2, theTolerance);
+  aTool.SetOverlapBackend(aBackend);
+  aTool.Perform();
+  ASSERT_TRUE(aTool.IsDone());
+  EXPECT_EQ(aBackend->NbCalls(), 1);
+
+  checkEqual(aReference.OverlapSubShapes1(), aTool.OverlapSubShapes1());
+  checkEqual(aReference.OverlapSubShapes2(), aTool.OverlapSubShapes2());
+}
+} // namespace
+
+TEST(BRepExtrema_OverlapBackend_Test, SameAsTraversal)
+{
+  const TopoDS_Shape aSphere = BRepPrimAPI_MakeSphere(gp_Pnt(0.0, 0.0, 0.0), 1.0).Shape();
+  const TopoDS_Shape aBox = BRepPrimAPI_MakeBox(gp_Pnt(0.5, -2.0, -2.0), 4.0, 4.0, 4.0).Shape();
+  BRepMesh_IncrementalMesh(aSphere, 0.01);
+  BRepMesh_IncrementalMesh(aBox, 0.01);
+
+  checkBackend(aSphere, aBox, 0.0, false);
+  checkBackend(aSphere, aBox, 0.1, false);
+}
+
+TEST(BRepExtrema_OverlapBackend_Test, FallbackOnFailure)
+{
+  const TopoDS_Shape aSphere = BRepPrimAPI_MakeSphere(gp_Pnt(0.0, 0.0, 0.0), 1.0).Shape();
+  const TopoDS_Shape aBox = BRepPrimAPI_MakeBox(gp_Pnt(0.5, -2.0, -2.0), 4.0, 4.0, 4.0).Shape();
+  BRepMesh_IncrementalMesh(aSphere, 0.01);
+  BRepMesh_IncrementalMesh(aBox, 0.01);
+
+  checkBackend(aSphere, aBox, 0.1, true);
+}
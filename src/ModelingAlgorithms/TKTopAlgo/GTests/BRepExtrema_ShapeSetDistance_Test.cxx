@@ -0,0 +1,108 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <BRepExtrema_DistShapeShape.hxx>
+#include <BRepExtrema_ShapeSetDistance.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeSphere.hxx>
+#include <NCollection_Vector.hxx>
+#include <TopoDS_Shape.hxx>
+#include <gp_Pnt.hxx>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+//! Returns the grid of boxes of size 1 with the step 3.
+NCollection_Vector<TopoDS_Shape> makeBoxGrid(const int theNbSteps)
+{
+  NCollection_Vector<TopoDS_Shape> aBoxes;
+  for (int anI = 0; anI < theNbSteps; ++anI)
+  {
+    for (int aJ = 0; aJ < theNbSteps; ++aJ)
+    {
+      aBoxes.Append(BRepPrimAPI_MakeBox(gp_Pnt(3.0 * anI, 3.0 * aJ, 0.0), 1.0, 1.0, 1.0).Shape());
+    }
+  }
+  return aBoxes;
+}
+
+//! Returns the minimal distance between the shape and the shapes computed one by one.
+double bruteForceDistance(const TopoDS_Shape&                     theShape,
+                          const NCollection_Vector<TopoDS_Shape>& theShapes)
+{
+  double aMinDist = Precision::Infinite();
+  for (NCollection_Vector<TopoDS_Shape>::Iterator anIt(theShapes); anIt.More(); anIt.Next())
+  {
+    BRepExtrema_DistShapeShape aDist(theShape, anIt.Value());
+    aMinDist = std::min(aMinDist, aDist.Value());
+  }
+  return aMinDist;
+}
+} // namespace
+
+TEST(BRepExtrema_ShapeSetDistance_Test, Nearest)
+{
+  const NCollection_Vector<TopoDS_Shape> aBoxes = makeBoxGrid(10);
+  const TopoDS_Shape aSphere = BRepPrimAPI_MakeSphere(gp_Pnt(12.5, 12.5, 4.0), 1.0).Shape();
+
+  BRepExtrema_ShapeSetDistance aTool(aBoxes);
+  ASSERT_EQ(100, aTool.NbShapes());
+  ASSERT_TRUE(aTool.Perform(aSphere));
+  EXPECT_NEAR(bruteForceDistance(aSphere, aBoxes), aTool.Value(), 1.e-7);
+  EXPECT_NEAR(2.0, aTool.Value(), 1.e-7);
+
+  // the box under the sphere is the nearest one
+  ASSERT_EQ(44, aTool.NearestIndex());
+  EXPECT_NEAR(0.0, aTool.PointOnShape().Distance(gp_Pnt(12.5, 12.5, 3.0)), 1.e-7);
+  EXPECT_NEAR(2.0, aTool.PointOnShape().Distance(aTool.PointOnSet()), 1.e-7);
+
+  // the far boxes are rejected by the distance between the bounding boxes
+  EXPECT_LT(aTool.NbComputed(), 10);
+
+  aTool.SetMultiThread(true);
+  ASSERT_TRUE(aTool.Perform(aSphere));
+  EXPECT_NEAR(2.0, aTool.Value(), 1.e-7);
+  EXPECT_EQ(44, aTool.NearestIndex());
+}
+
+TEST(BRepExtrema_ShapeSetDistance_Test, Clearance)
+{
+  const NCollection_Vector<TopoDS_Shape> aBoxes = makeBoxGrid(10);
+
+  // the box intersects four boxes of the grid
+  const TopoDS_Shape aMoving = BRepPrimAPI_MakeBox(gp_Pnt(0.5, 0.5, 0.0), 3.0, 3.0, 1.0).Shape();
+
+  BRepExtrema_ShapeSetDistance aTool(aBoxes);
+  aTool.SetMultiThread(true);
+  ASSERT_TRUE(aTool.PerformClearance(aMoving, 0.1, false));
+  const NCollection_Vector<int>& aClose = aTool.CloseShapes();
+  ASSERT_EQ(4, aClose.Length());
+  EXPECT_EQ(0, aClose(0));
+  EXPECT_EQ(1, aClose(1));
+  EXPECT_EQ(10, aClose(2));
+  EXPECT_EQ(11, aClose(3));
+  EXPECT_NEAR(0.0, aTool.Value(), 1.e-7);
+
+  // the search is stopped at the first group of candidates with violated clearance
+  ASSERT_TRUE(aTool.PerformClearance(aMoving, 0.1, true));
+  EXPECT_FALSE(aTool.CloseShapes().IsEmpty());
+  EXPECT_LE(aTool.NbComputed(), 4);
+
+  // no violation for the large gaps
+  const TopoDS_Shape aFar = BRepPrimAPI_MakeBox(gp_Pnt(0.0, 0.0, 5.0), 30.0, 30.0, 1.0).Shape();
+  ASSERT_TRUE(aTool.PerformClearance(aFar, 3.0, true));
+  EXPECT_TRUE(aTool.CloseShapes().IsEmpty());
+  EXPECT_EQ(0, aTool.NbComputed());
+}
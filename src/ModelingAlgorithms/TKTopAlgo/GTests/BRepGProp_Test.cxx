@@ -0,0 +1,110 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <BRep_Builder.hxx>
+#include <BRepGProp.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <BRepPrimAPI_MakeSphere.hxx>
+#include <GProp_GProps.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Compound.hxx>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+//! Makes the compound of a box, a sphere and a cylinder.
+TopoDS_Compound makeSolids()
+{
+  TopoDS_Compound aCompound;
+  BRep_Builder    aBuilder;
+  aBuilder.MakeCompound(aCompound);
+  aBuilder.Add(aCompound, BRepPrimAPI_MakeBox(10.0, 20.0, 30.0).Shape());
+  aBuilder.Add(aCompound, BRepPrimAPI_MakeSphere(gp_Pnt(50.0, 0.0, 0.0), 10.0).Shape());
+  aBuilder.Add(aCompound, BRepPrimAPI_MakeCylinder(5.0, 20.0).Shape());
+  return aCompound;
+}
+
+//! Checks that the properties are equal exactly.
+void checkEqual(const GProp_GProps& theProps1, const GProp_GProps& theProps2)
+{
+  EXPECT_EQ(theProps1.Mass(), theProps2.Mass());
+  EXPECT_EQ(theProps1.CentreOfMass().X(), theProps2.CentreOfMass().X());
+  EXPECT_EQ(theProps1.CentreOfMass().Y(), theProps2.CentreOfMass().Y());
+  EXPECT_EQ(theProps1.CentreOfMass().Z(), theProps2.CentreOfMass().Z());
+  for (int aRow = 1; aRow <= 3; ++aRow)
+  {
+    for (int aCol = 1; aCol <= 3; ++aCol)
+    {
+      EXPECT_EQ(theProps1.MatrixOfInertia()(aRow, aCol), theProps2.MatrixOfInertia()(aRow, aCol));
+    }
+  }
+}
+} // namespace
+
+TEST(BRepGProp_Test, ParallelFaceIntegration)
+{
+  const TopoDS_Compound aSolids = makeSolids();
+  const double          aVolume = 6000.0 + 4.0 / 3.0 * M_PI * 1000.0 + M_PI * 25.0 * 20.0;
+
+  GProp_GProps aSeqProps, aParProps;
+  BRepGProp::VolumeProperties(aSolids, aSeqProps);
+  BRepGProp::VolumeProperties(aSolids, aParProps, false, false, false, true);
+  EXPECT_NEAR(aVolume, aSeqProps.Mass(), aVolume * 1.e-6);
+  checkEqual(aSeqProps, aParProps);
+
+  // faces are summed up in the same order, so that the results are identical
+  const double aSeqError = BRepGProp::VolumeProperties(aSolids, aSeqProps, 1.e-6);
+  const double aParError =
+    BRepGProp::VolumeProperties(aSolids, aParProps, 1.e-6, false, false, false, true);
+  EXPECT_EQ(aSeqError, aParError);
+  checkEqual(aSeqProps, aParProps);
+
+  BRepGProp::SurfaceProperties(aSolids, aSeqProps, 1.e-6);
+  BRepGProp::SurfaceProperties(aSolids, aParProps, 1.e-6, false, false, true);
+  checkEqual(aSeqProps, aParProps);
+}
+
+TEST(BRepGProp_Test, TriangulationFastPath)
+{
+  const double       aRadius = 10.0;
+  const double       aVolume = 4.0 / 3.0 * M_PI * aRadius * aRadius * aRadius;
+  const double       anArea  = 4.0 * M_PI * aRadius * aRadius;
+  const TopoDS_Shape aSphere = BRepPrimAPI_MakeSphere(aRadius).Shape();
+  BRepMesh_IncrementalMesh(aSphere, 0.01);
+
+  // the triangulation is not accurate enough, the surface is integrated
+  GProp_GProps aProps;
+  double       anError = BRepGProp::VolumeProperties(aSphere, aProps, 1.e-6, false, false, true);
+  EXPECT_NEAR(aVolume, aProps.Mass(), aVolume * 1.e-6);
+
+  // the triangulation is used with its estimated error
+  anError = BRepGProp::VolumeProperties(aSphere, aProps, 1.e-2, false, false, true);
+  EXPECT_GT(anError, 1.e-6);
+  EXPECT_LE(anError, 1.e-2);
+  EXPECT_GT(std::abs(aProps.Mass() - aVolume) / aVolume, 1.e-6);
+  EXPECT_LE(std::abs(aProps.Mass() - aVolume) / aVolume, anError);
+
+  anError = BRepGProp::SurfaceProperties(aSphere, aProps, 1.e-2, false, true);
+  EXPECT_GT(anError, 1.e-6);
+  EXPECT_LE(anError, 1.e-2);
+  const double aMeshError = std::abs(aProps.Mass() - anArea) / anArea;
+  EXPECT_LE(aMeshError, anError);
+
+  // the triangulation is ignored without the flag
+  BRepGProp::SurfaceProperties(aSphere, aProps, 1.e-2);
+  EXPECT_LT(std::abs(aProps.Mass() - anArea) / anArea, aMeshError);
+}
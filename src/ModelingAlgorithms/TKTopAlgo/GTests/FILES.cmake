@@ -2,7 +2,14 @@
 set(OCCT_TKTopAlgo_GTests_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
 
 set(OCCT_TKTopAlgo_GTests_FILES
+  BRepBndLib_Test.cxx
   BRepBuilderAPI_MakeWire_Test.cxx
+  BRepBuilderAPI_Sewing_Test.cxx
+  BRepCheck_Analyzer_Test.cxx
+  BRepClass3d_BatchClassifier_Test.cxx
+  BRepExtrema_OverlapBackend_Test.cxx
+  BRepExtrema_ShapeSetDistance_Test.cxx
+  BRepGProp_Test.cxx
   BRepLib_MakeWire_Test.cxx
   BRepOffsetAPI_ThruSections_Test.cxx
 )
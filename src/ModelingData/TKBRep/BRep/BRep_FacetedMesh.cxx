@@ -0,0 +1,368 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRep_FacetedMesh.hxx>
+
+#include <BRep_Builder.hxx>
+#include <BRep_TFace.hxx>
+#include <Geom_Line.hxx>
+#include <Geom_Plane.hxx>
+#include <NCollection_FlatDataMap.hxx>
+#include <NCollection_Vector.hxx>
+#include <TopoDS_Face.hxx>
+#include <TopoDS_TCompound.hxx>
+#include <TopoDS_TWire.hxx>
+#include <TopoDS_Wire.hxx>
+#include <gp_Pln.hxx>
+
+#include <atomic>
+
+IMPLEMENT_STANDARD_RTTIEXT(BRep_FacetedMesh, Standard_Transient)
+
+namespace
+{
+//! Creates the sub-shapes of a deferred TShape once, under the lock of the mesh.
+template <typename TheFunctor>
+void materializeOnce(BRep_FacetedMesh&  theMesh,
+                     std::atomic<bool>& theIsDone,
+                     const TheFunctor&  theFunctor)
+{
+  if (theIsDone.load(std::memory_order_acquire))
+  {
+    return;
+  }
+
+  std::lock_guard<std::mutex> aLock(theMesh.Mutex());
+  if (!theIsDone.load(std::memory_order_relaxed))
+  {
+    theFunctor();
+    theIsDone.store(true, std::memory_order_release);
+  }
+}
+
+//! Compound of the faces of the mesh.
+class BRep_TFacetedCompound : public TopoDS_TCompound
+{
+public:
+  BRep_TFacetedCompound(const occ::handle<BRep_FacetedMesh>& theMesh)
+      : myMesh(theMesh),
+        myIsMaterialized(false)
+  {
+    setDeferred();
+  }
+
+  const occ::handle<BRep_FacetedMesh>& Mesh() const { return myMesh; }
+
+  DEFINE_STANDARD_RTTI_INLINE(BRep_TFacetedCompound, TopoDS_TCompound)
+
+protected:
+  void materializeChildren() override
+  {
+    materializeOnce(*myMesh, myIsMaterialized, [this]() {
+      for (int aFace = 0; aFace < myMesh->NbFaces(); ++aFace)
+      {
+        appendChild(myMesh->MakeFace(aFace));
+      }
+    });
+  }
+
+private:
+  occ::handle<BRep_FacetedMesh> myMesh;
+  std::atomic<bool>             myIsMaterialized;
+};
+
+//! Planar face on the triangle of the mesh.
+class BRep_TFacetedFace : public BRep_TFace
+{
+public:
+  BRep_TFacetedFace(const occ::handle<BRep_FacetedMesh>& theMesh, const int theFace)
+      : myMesh(theMesh),
+        myFace(theFace),
+        myIsMaterialized(false)
+  {
+    setDeferred();
+  }
+
+  const occ::handle<BRep_FacetedMesh>& Mesh() const { return myMesh; }
+
+  DEFINE_STANDARD_RTTI_INLINE(BRep_TFacetedFace, BRep_TFace)
+
+protected:
+  void materializeChildren() override
+  {
+    materializeOnce(*myMesh, myIsMaterialized, [this]() {
+      appendChild(myMesh->MakeWire(myFace));
+    });
+  }
+
+private:
+  occ::handle<BRep_FacetedMesh> myMesh;
+  int                           myFace;
+  std::atomic<bool>             myIsMaterialized;
+};
+
+//! Wire of three edges bounding the triangle of the mesh.
+class BRep_TFacetedWire : public TopoDS_TWire
+{
+public:
+  BRep_TFacetedWire(const occ::handle<BRep_FacetedMesh>& theMesh, const int theEdges[3])
+      : myMesh(theMesh),
+        myEdges{theEdges[0], theEdges[1], theEdges[2]},
+        myIsMaterialized(false)
+  {
+    setDeferred();
+    Closed(true);
+  }
+
+  const occ::handle<BRep_FacetedMesh>& Mesh() const { return myMesh; }
+
+  DEFINE_STANDARD_RTTI_INLINE(BRep_TFacetedWire, TopoDS_TWire)
+
+protected:
+  void materializeChildren() override
+  {
+    materializeOnce(*myMesh, myIsMaterialized, [this]() {
+      for (int aSide = 0; aSide < 3; ++aSide)
+      {
+        // edges are numbered from 1, negative number means reversed edge
+        TopoDS_Edge anEdge = myMesh->Edge(std::abs(myEdges[aSide]) - 1);
+        if (myEdges[aSide] < 0)
+        {
+          anEdge.Reverse();
+        }
+        appendChild(anEdge);
+      }
+    });
+  }
+
+private:
+  occ::handle<BRep_FacetedMesh> myMesh;
+  int                           myEdges[3];
+  std::atomic<bool>             myIsMaterialized;
+};
+
+//! Returns true if the triangle has distinct nodes and non-zero area.
+bool isValidTriangle(const Poly_Triangulation& theMesh, const int theNodes[3])
+{
+  if (theNodes[0] == theNodes[1] || theNodes[0] == theNodes[2] || theNodes[1] == theNodes[2])
+  {
+    return false;
+  }
+
+  const gp_Pnt aP1 = theMesh.Node(theNodes[0]);
+  const gp_Pnt aP2 = theMesh.Node(theNodes[1]);
+  const gp_Pnt aP3 = theMesh.Node(theNodes[2]);
+  if (aP1.SquareDistance(aP2) < gp::Resolution() || aP1.SquareDistance(aP3) < gp::Resolution()
+      || aP2.SquareDistance(aP3) < gp::Resolution())
+  {
+    return false;
+  }
+  const gp_XYZ aNorm = (aP2.XYZ() - aP1.XYZ()).Crossed(aP3.XYZ() - aP1.XYZ());
+  return aNorm.Modulus() > gp::Resolution();
+}
+} // namespace
+
+//=================================================================================================
+
+BRep_FacetedMesh::BRep_FacetedMesh(const occ::handle<Poly_Triangulation>& theMesh,
+                                   const double                           theTolerance)
+    : myMesh(theMesh),
+      myTolerance(theTolerance),
+      myNbEdges(0),
+      myNbVertices(0)
+{
+  if (myMesh.IsNull())
+  {
+    return;
+  }
+
+  NCollection_Vector<int> aTriangles;
+  for (int aTriIter = 1; aTriIter <= myMesh->NbTriangles(); ++aTriIter)
+  {
+    int aNodes[3];
+    myMesh->Triangle(aTriIter).Get(aNodes[0], aNodes[1], aNodes[2]);
+    if (isValidTriangle(*myMesh, aNodes))
+    {
+      aTriangles.Append(aTriIter);
+    }
+  }
+  if (aTriangles.IsEmpty())
+  {
+    return;
+  }
+
+  // unique edges are identified by the pair of nodes
+  const int aNbFaces = aTriangles.Length();
+  myFaceTriangles.Resize(0, aNbFaces - 1, false);
+  myFaceEdges.Resize(0, 3 * aNbFaces - 1, false);
+  NCollection_FlatDataMap<uint64_t, int> anEdgeMap(3 * aNbFaces / 2);
+  NCollection_Vector<int>                anEdgeNodes;
+  for (int aFace = 0; aFace < aNbFaces; ++aFace)
+  {
+    int aNodes[3];
+    myFaceTriangles.SetValue(aFace, aTriangles.Value(aFace));
+    myMesh->Triangle(aTriangles.Value(aFace)).Get(aNodes[0], aNodes[1], aNodes[2]);
+    for (int aSide = 0; aSide < 3; ++aSide)
+    {
+      const int      aNode1 = aNodes[aSide];
+      const int      aNode2 = aNodes[(aSide + 1) % 3];
+      const int      aMin   = std::min(aNode1, aNode2);
+      const int      aMax   = std::max(aNode1, aNode2);
+      const uint64_t aKey   = (uint64_t(aMin) << 32) | uint64_t(aMax);
+      int            anEdge = 0;
+      if (const int* anExisting = anEdgeMap.Seek(aKey))
+      {
+        anEdge = *anExisting;
+      }
+      else
+      {
+        anEdge = anEdgeNodes.Length() / 2 + 1;
+        anEdgeMap.Bind(aKey, anEdge);
+        anEdgeNodes.Append(aMin);
+        anEdgeNodes.Append(aMax);
+      }
+      myFaceEdges.SetValue(3 * aFace + aSide, aNode1 < aNode2 ? anEdge : -anEdge);
+    }
+  }
+
+  myEdgeNodes.Resize(0, anEdgeNodes.Length() - 1, false);
+  for (int anIndex = 0; anIndex < anEdgeNodes.Length(); ++anIndex)
+  {
+    myEdgeNodes.SetValue(anIndex, anEdgeNodes.Value(anIndex));
+  }
+  myEdges.Resize(0, NbEdges() - 1, false);
+  myVertices.Resize(1, myMesh->NbNodes(), false);
+}
+
+//=================================================================================================
+
+TopoDS_Compound BRep_FacetedMesh::MakeCompound(const occ::handle<Poly_Triangulation>& theMesh,
+                                               const double theTolerance)
+{
+  occ::handle<BRep_FacetedMesh> aMesh = new BRep_FacetedMesh(theMesh, theTolerance);
+  TopoDS_Compound               aCompound;
+  if (aMesh->NbFaces() == 0)
+  {
+    return aCompound;
+  }
+
+  aCompound.TShape(new BRep_TFacetedCompound(aMesh));
+  aCompound.Orientation(TopAbs_FORWARD);
+  return aCompound;
+}
+
+//=================================================================================================
+
+occ::handle<BRep_FacetedMesh> BRep_FacetedMesh::Find(const TopoDS_Shape& theShape)
+{
+  if (theShape.IsNull())
+  {
+    return occ::handle<BRep_FacetedMesh>();
+  }
+  if (const BRep_TFacetedCompound* aCompound =
+        dynamic_cast<const BRep_TFacetedCompound*>(theShape.TShape().get()))
+  {
+    return aCompound->Mesh();
+  }
+  if (const BRep_TFacetedFace* aFace =
+        dynamic_cast<const BRep_TFacetedFace*>(theShape.TShape().get()))
+  {
+    return aFace->Mesh();
+  }
+  if (const BRep_TFacetedWire* aWire =
+        dynamic_cast<const BRep_TFacetedWire*>(theShape.TShape().get()))
+  {
+    return aWire->Mesh();
+  }
+  return occ::handle<BRep_FacetedMesh>();
+}
+
+//=================================================================================================
+
+TopoDS_Face BRep_FacetedMesh::MakeFace(const int theFace)
+{
+  int aNodes[3];
+  myMesh->Triangle(myFaceTriangles.Value(theFace)).Get(aNodes[0], aNodes[1], aNodes[2]);
+  const gp_Pnt aP1 = myMesh->Node(aNodes[0]);
+  const gp_XYZ aNorm =
+    (myMesh->Node(aNodes[1]).XYZ() - aP1.XYZ()).Crossed(myMesh->Node(aNodes[2]).XYZ() - aP1.XYZ());
+
+  // the wire goes counterclockwise around the normal of the plane
+  occ::handle<BRep_TFacetedFace> aTFace = new BRep_TFacetedFace(this, theFace);
+  aTFace->Surface(new Geom_Plane(gp_Pln(aP1, gp_Dir(aNorm))));
+  aTFace->Tolerance(myTolerance);
+
+  TopoDS_Face aFace;
+  aFace.TShape(aTFace);
+  aFace.Orientation(TopAbs_FORWARD);
+  return aFace;
+}
+
+//=================================================================================================
+
+TopoDS_Wire BRep_FacetedMesh::MakeWire(const int theFace)
+{
+  TopoDS_Wire aWire;
+  aWire.TShape(new BRep_TFacetedWire(this, &myFaceEdges.Value(3 * theFace)));
+  aWire.Orientation(TopAbs_FORWARD);
+  return aWire;
+}
+
+//=================================================================================================
+
+TopoDS_Edge BRep_FacetedMesh::Edge(const int theEdge)
+{
+  occ::handle<TopoDS_TShape>& aTEdge = myEdges.ChangeValue(theEdge);
+  if (aTEdge.IsNull())
+  {
+    const int    aNode1 = myEdgeNodes.Value(2 * theEdge);
+    const int    aNode2 = myEdgeNodes.Value(2 * theEdge + 1);
+    const gp_Pnt aP1    = myMesh->Node(aNode1);
+    const gp_Vec aVec(aP1, myMesh->Node(aNode2));
+
+    BRep_Builder aBuilder;
+    TopoDS_Edge  anEdge;
+    aBuilder.MakeEdge(anEdge, new Geom_Line(aP1, gp_Dir(aVec)), myTolerance);
+    aBuilder.Range(anEdge, 0.0, aVec.Magnitude());
+    aBuilder.Add(anEdge, Vertex(aNode1).Oriented(TopAbs_FORWARD));
+    aBuilder.Add(anEdge, Vertex(aNode2).Oriented(TopAbs_REVERSED));
+    anEdge.Free(false);
+    aTEdge = anEdge.TShape();
+    ++myNbEdges;
+  }
+
+  TopoDS_Edge anEdge;
+  anEdge.TShape(aTEdge);
+  anEdge.Orientation(TopAbs_FORWARD);
+  return anEdge;
+}
+
+//=================================================================================================
+
+TopoDS_Vertex BRep_FacetedMesh::Vertex(const int theNode)
+{
+  occ::handle<TopoDS_TShape>& aTVertex = myVertices.ChangeValue(theNode);
+  if (aTVertex.IsNull())
+  {
+    BRep_Builder  aBuilder;
+    TopoDS_Vertex aVertex;
+    aBuilder.MakeVertex(aVertex, myMesh->Node(theNode), myTolerance);
+    aTVertex = aVertex.TShape();
+    ++myNbVertices;
+  }
+
+  TopoDS_Vertex aVertex;
+  aVertex.TShape(aTVertex);
+  aVertex.Orientation(TopAbs_FORWARD);
+  return aVertex;
+}
@@ -0,0 +1,118 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BRep_FacetedMesh_HeaderFile
+#define _BRep_FacetedMesh_HeaderFile
+
+#include <NCollection_Array1.hxx>
+#include <Poly_Triangulation.hxx>
+#include <Precision.hxx>
+#include <TopoDS_Compound.hxx>
+#include <TopoDS_Edge.hxx>
+#include <TopoDS_TShape.hxx>
+#include <TopoDS_Vertex.hxx>
+
+#include <mutex>
+
+class TopoDS_Face;
+class TopoDS_Wire;
+
+//! Compact read-only topology of a triangulation with one planar face per triangle,
+//! as produced by conversion of STL or other mesh formats into BRep.
+//!
+//! The faceted topology is kept in flat arrays (nodes and triangles of the triangulation
+//! and the table of unique edges), while the TShapes are created on demand,
+//! when the sub-shapes of the enclosing shape are explored:
+//! - the faces are created when the compound is explored,
+//! - the wire of the face is created when the face is explored,
+//! - the edges and their vertices are created when the wire is explored.
+//! Faces are planar BRep_TFace, edges are BRep_TEdge with a line segment,
+//! so that the shape is compatible with TopExp_Explorer, BRep_Tool and BRepMesh;
+//! the shared edges and vertices are created once and kept by the mesh.
+//! Created TShapes are frozen, though they can be copied by EmptyCopy() as usual.
+//!
+//! Materialization is thread-safe, so that the shape can be explored by several threads.
+//! Degenerated triangles (with coincident nodes or zero area) are skipped.
+class BRep_FacetedMesh : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(BRep_FacetedMesh, Standard_Transient)
+public:
+  //! Makes the compound of faces built on demand on the triangles of the mesh.
+  //! @param theMesh      triangulation to convert
+  //! @param theTolerance tolerance of the created faces, edges and vertices
+  //! @return compound of faces or null shape for empty triangulation
+  Standard_EXPORT static TopoDS_Compound MakeCompound(
+    const occ::handle<Poly_Triangulation>& theMesh,
+    const double                           theTolerance = Precision::Confusion());
+
+  //! Returns the mesh of the compound or the face created by MakeCompound()
+  //! or null handle for other shapes.
+  Standard_EXPORT static occ::handle<BRep_FacetedMesh> Find(const TopoDS_Shape& theShape);
+
+public:
+  //! Builds the table of edges of the triangulation.
+  Standard_EXPORT BRep_FacetedMesh(const occ::handle<Poly_Triangulation>& theMesh,
+                                   const double                           theTolerance);
+
+  //! Returns the triangulation.
+  const occ::handle<Poly_Triangulation>& Triangulation() const { return myMesh; }
+
+  //! Returns the tolerance of the created shapes.
+  double Tolerance() const { return myTolerance; }
+
+  //! Returns the number of faces, i.e. of non-degenerated triangles.
+  int NbFaces() const { return myFaceTriangles.Length(); }
+
+  //! Returns the number of unique edges.
+  int NbEdges() const { return myEdgeNodes.Length() / 2; }
+
+  //! Returns the number of created edges.
+  int NbMaterializedEdges() const { return myNbEdges; }
+
+  //! Returns the number of created vertices.
+  int NbMaterializedVertices() const { return myNbVertices; }
+
+public:
+  //! Creates the face for the given index within [0, NbFaces()).
+  //! The face is not shared: each call creates a new one.
+  Standard_EXPORT TopoDS_Face MakeFace(const int theFace);
+
+  //! Creates the wire of the face; the wire is not shared.
+  Standard_EXPORT TopoDS_Wire MakeWire(const int theFace);
+
+  //! Returns the edge for the given index within [0, NbEdges()), creating it on first call.
+  //! The edge is oriented from the node with the lower index to the one with the higher index.
+  //! Should be called with the lock of Mutex().
+  Standard_EXPORT TopoDS_Edge Edge(const int theEdge);
+
+  //! Returns the vertex for the given node of the triangulation, creating it on first call.
+  //! Should be called with the lock of Mutex().
+  Standard_EXPORT TopoDS_Vertex Vertex(const int theNode);
+
+  //! Returns the mutex protecting the creation of the shapes.
+  std::mutex& Mutex() { return myMutex; }
+
+private:
+  occ::handle<Poly_Triangulation>                myMesh;
+  double                                         myTolerance;
+  NCollection_Array1<int>                        myFaceTriangles; //!< triangle of each face
+  NCollection_Array1<int>                        myFaceEdges;     //!< 3 signed edges of each face
+  NCollection_Array1<int>                        myEdgeNodes;     //!< 2 nodes of each edge
+  NCollection_Array1<occ::handle<TopoDS_TShape>> myEdges;         //!< created edges
+  NCollection_Array1<occ::handle<TopoDS_TShape>> myVertices;      //!< created vertices of nodes
+  int                                            myNbEdges;
+  int                                            myNbVertices;
+  std::mutex                                     myMutex;
+};
+
+#endif // _BRep_FacetedMesh_HeaderFile
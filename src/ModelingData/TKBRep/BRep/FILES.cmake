@@ -18,6 +18,8 @@ set(OCCT_BRep_FILES
   BRep_CurveRepresentation.cxx
   BRep_CurveRepresentation.hxx
   BRep_CurveRepresentation.lxx
+  BRep_FacetedMesh.cxx
+  BRep_FacetedMesh.hxx
   BRep_GCurve.cxx
   BRep_GCurve.hxx
   BRep_GCurve.lxx
@@ -375,6 +375,45 @@ void BRepAdaptor_Curve::D1(const double U, gp_Pnt& P, gp_Vec& V) const
 
 //=================================================================================================
 
+void BRepAdaptor_Curve::EvaluateD0(const NCollection_Array1<double>& theParams,
+                                   NCollection_Array1<gp_Pnt>&       thePoints) const
+{
+  if (myConSurf.IsNull())
+    myCurve.EvaluateD0(theParams, thePoints);
+  else
+    myConSurf->EvaluateD0(theParams, thePoints);
+  if (myTrsf.Form() == gp_Identity)
+    return;
+  for (gp_Pnt& aPnt : thePoints)
+  {
+    aPnt.Transform(myTrsf);
+  }
+}
+
+//=================================================================================================
+
+void BRepAdaptor_Curve::EvaluateD1(const NCollection_Array1<double>& theParams,
+                                   NCollection_Array1<gp_Pnt>&       thePoints,
+                                   NCollection_Array1<gp_Vec>&       theD1) const
+{
+  if (myConSurf.IsNull())
+    myCurve.EvaluateD1(theParams, thePoints, theD1);
+  else
+    myConSurf->EvaluateD1(theParams, thePoints, theD1);
+  if (myTrsf.Form() == gp_Identity)
+    return;
+  for (gp_Pnt& aPnt : thePoints)
+  {
+    aPnt.Transform(myTrsf);
+  }
+  for (gp_Vec& aVec : theD1)
+  {
+    aVec.Transform(myTrsf);
+  }
+}
+
+//=================================================================================================
+
 void BRepAdaptor_Curve::D2(const double U, gp_Pnt& P, gp_Vec& V1, gp_Vec& V2) const
 {
   if (myConSurf.IsNull())
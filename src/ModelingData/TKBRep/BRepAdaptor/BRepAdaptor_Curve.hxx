@@ -154,6 +154,15 @@ public:
   //! is not C1.
   Standard_EXPORT void D1(const double U, gp_Pnt& P, gp_Vec& V) const override;
 
+  //! Computes the points of the given parameters on the curve.
+  Standard_EXPORT void EvaluateD0(const NCollection_Array1<double>& theParams,
+                                  NCollection_Array1<gp_Pnt>&       thePoints) const override;
+
+  //! Computes the points and the first derivatives of the given parameters on the curve.
+  Standard_EXPORT void EvaluateD1(const NCollection_Array1<double>& theParams,
+                                  NCollection_Array1<gp_Pnt>&       thePoints,
+                                  NCollection_Array1<gp_Vec>&       theD1) const override;
+
   //! Returns the point P of parameter U, the first and second
   //! derivatives V1 and V2.
   //! Raised if the continuity of the current interval
@@ -41,6 +41,7 @@
 #include <iomanip>
 #include <fstream>
 #include <Standard_Transient.hxx>
+#include <NCollection_FlatMap.hxx>
 #include <NCollection_Map.hxx>
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
@@ -708,8 +709,8 @@ void BRepTools::Clean(const TopoDS_Shape& theShape, const bool theForce)
   occ::handle<Poly_Triangulation>          aNullTriangulation;
   occ::handle<Poly_PolygonOnTriangulation> aNullPoly;
 
-  NCollection_Map<TopoDS_Shape, TopTools_ShapeMapHasher> aShapeMap;
-  const TopLoc_Location                                  anEmptyLoc;
+  NCollection_FlatMap<TopoDS_Shape, TopTools_ShapeMapHasher> aShapeMap;
+  const TopLoc_Location                                      anEmptyLoc;
 
   TopExp_Explorer aFaceIt(theShape, TopAbs_FACE);
   for (; aFaceIt.More(); aFaceIt.Next())
@@ -140,6 +140,22 @@ void BRepTools_ReShape::Clear()
 
 //=================================================================================================
 
+void BRepTools_ReShape::AddRequests(const BRepTools_ReShape& theOther)
+{
+  for (TShapeToReplacement::Iterator aRIt(theOther.myShapeToReplacement); aRIt.More(); aRIt.Next())
+  {
+    myShapeToReplacement.Bind(aRIt.Key(), aRIt.Value());
+  }
+  for (NCollection_Map<TopoDS_Shape, TopTools_ShapeMapHasher>::Iterator aNIt(theOther.myNewShapes);
+       aNIt.More();
+       aNIt.Next())
+  {
+    myNewShapes.Add(aNIt.Key());
+  }
+}
+
+//=================================================================================================
+
 void BRepTools_ReShape::Remove(const TopoDS_Shape& shape)
 {
   TopoDS_Shape nulshape;
@@ -89,6 +89,14 @@ public:
     }
   }
 
+  //! Adds the requests recorded in the other reshape to this one.
+  //! The requests recorded for the same shapes are overridden, as if
+  //! the requests of the other reshape were given after the own ones.
+  //! Both reshapes are expected to have the same mode of consideration of locations.
+  //! Allows to merge the results of independent modifications performed
+  //! with separate reshapes, e.g. in parallel threads.
+  Standard_EXPORT void AddRequests(const BRepTools_ReShape& theOther);
+
   //! Tells if a shape is recorded for Replace/Remove
   Standard_EXPORT virtual bool IsRecorded(const TopoDS_Shape& shape) const;
 
@@ -53,6 +53,9 @@ public:
   //! Returns the index of <L>.
   Standard_EXPORT int Index(const occ::handle<Geom2d_Curve>& C) const;
 
+  //! Returns number of 2D curves in the set.
+  int NbCurves2d() const { return myMap.Extent(); }
+
   //! Dumps the content of me on the stream <OS>.
   Standard_EXPORT void Dump(Standard_OStream& OS) const;
 
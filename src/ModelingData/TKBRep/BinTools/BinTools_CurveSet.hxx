@@ -53,6 +53,9 @@ public:
   //! Returns the index of <L>.
   Standard_EXPORT int Index(const occ::handle<Geom_Curve>& C) const;
 
+  //! Returns number of curves in the set.
+  int NbCurves() const { return myMap.Extent(); }
+
   //! Writes the content of me on the stream <OS> in a
   //! format that can be read back by Read.
   Standard_EXPORT void Write(Standard_OStream&            OS,
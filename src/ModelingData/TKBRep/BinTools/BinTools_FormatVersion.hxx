@@ -27,13 +27,20 @@ enum BinTools_FormatVersion
   BinTools_FormatVersion_VERSION_4 = 4, //!< Stores per-vertex normal information in case
                                         //!  of triangulation-only Faces, because
                                         //!  no analytical geometry to restore normals
+  BinTools_FormatVersion_VERSION_5 = 5, //!< Splits sections of curves, surfaces and triangulations
+                                        //!  into independent blocks written and read
+                                        //!  by parallel threads
+  BinTools_FormatVersion_VERSION_6 = 6, //!< Same as VERSION_5 with blocks compressed by Zstandard;
+                                        //!  requires OCCT built with Zstandard (HAVE_ZSTD)
+  BinTools_FormatVersion_VERSION_7 = 7, //!< Same as VERSION_6 with all triangulations of faces
+                                        //!  (levels of detail) and the active one
   BinTools_FormatVersion_CURRENT = BinTools_FormatVersion_VERSION_4 //!< Current version
 };
 
 enum
 {
   BinTools_FormatVersion_LOWER = BinTools_FormatVersion_VERSION_1,
-  BinTools_FormatVersion_UPPER = BinTools_FormatVersion_VERSION_4
+  BinTools_FormatVersion_UPPER = BinTools_FormatVersion_VERSION_7
 };
 
 #endif
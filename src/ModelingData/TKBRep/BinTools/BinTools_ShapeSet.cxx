@@ -45,8 +45,463 @@
 #include <TopoDS_Shape.hxx>
 #include <TopoDS_Vertex.hxx>
 #include <Message_ProgressRange.hxx>
+#include <Message_ProgressScope.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_Parallel.hxx>
+#include <Standard_ArrayStreamBuffer.hxx>
+#include <Storage_StreamTypeMismatchError.hxx>
+
+#ifdef HAVE_ZSTD
+  #include <zstd.h>
+#endif
 
+#include <algorithm>
 #include <cstring>
+#include <sstream>
+
+namespace
+{
+//! Estimated size of a block of the geometry section (BinTools_FormatVersion_VERSION_5).
+static const size_t THE_BLOCK_WEIGHT = 65536;
+
+//! Estimated size of a curve or surface within the block.
+static const size_t THE_GEOMETRY_WEIGHT = 64;
+
+//! Maximum size in bytes of blocks loaded into memory at once for decoding.
+static const uint64_t THE_READ_CHUNK_SIZE = uint64_t(256) * 1024 * 1024;
+
+//! Zstandard compression level of blocks (BinTools_FormatVersion_VERSION_6);
+//! low levels are preferred as the gain of higher ones is small for binary geometry data.
+static const int THE_COMPRESSION_LEVEL = 1;
+
+//! Writes 64-bit size as two integers.
+static void putSize(Standard_OStream& theStream, const uint64_t theSize)
+{
+  BinTools::PutInteger(theStream, int(theSize & 0xFFFFFFFF));
+  BinTools::PutInteger(theStream, int(theSize >> 32));
+}
+
+//! Reads 64-bit size written by putSize().
+static uint64_t getSize(Standard_IStream& theStream)
+{
+  int aLow = 0, aHigh = 0;
+  BinTools::GetInteger(theStream, aLow);
+  BinTools::GetInteger(theStream, aHigh);
+  return uint64_t(uint32_t(aLow)) | (uint64_t(uint32_t(aHigh)) << 32);
+}
+
+//! Compresses the block (BinTools_FormatVersion_VERSION_6).
+static std::string compressBlock(const std::string& theBlock)
+{
+#ifdef HAVE_ZSTD
+  std::string aResult;
+  aResult.resize(ZSTD_compressBound(theBlock.size()));
+  const size_t aSize = ZSTD_compress(&aResult[0],
+                                     aResult.size(),
+                                     theBlock.data(),
+                                     theBlock.size(),
+                                     THE_COMPRESSION_LEVEL);
+  if (ZSTD_isError(aSize))
+  {
+    throw Standard_Failure(
+      (TCollection_AsciiString("BinTools_ShapeSet::Write: block compression failed: ")
+       + ZSTD_getErrorName(aSize))
+        .ToCString());
+  }
+  aResult.resize(aSize);
+  return aResult;
+#else
+  (void)theBlock;
+  throw Standard_Failure(
+    "BinTools_ShapeSet::Write: compression is unavailable (OCCT built without Zstandard)");
+#endif
+}
+
+//! Decompresses the block compressed by compressBlock().
+static std::string decompressBlock(const std::string& theBlock, const uint64_t theSize)
+{
+#ifdef HAVE_ZSTD
+  std::string aResult;
+  aResult.resize(size_t(theSize));
+  const size_t aSize =
+    ZSTD_decompress(&aResult[0], aResult.size(), theBlock.data(), theBlock.size());
+  if (ZSTD_isError(aSize) || aSize != aResult.size())
+  {
+    throw Standard_Failure("BinTools_ShapeSet::Read: Corrupted compressed block");
+  }
+  return aResult;
+#else
+  (void)theBlock;
+  (void)theSize;
+  throw Standard_Failure(
+    "BinTools_ShapeSet::Read: compressed geometry section cannot be read "
+    "(OCCT built without Zstandard)");
+#endif
+}
+
+//! Writes items of the section split into independent blocks (BinTools_FormatVersion_VERSION_5).
+//! The number of blocks is followed by blocks, each one defined by the number of items,
+//! size in bytes and data, so that reader may load several blocks and decode them concurrently.
+//! Compressed blocks (BinTools_FormatVersion_VERSION_6) define also the size of uncompressed data.
+//! Blocks are encoded and compressed by parallel threads.
+//! @param[in] theStream     output stream
+//! @param[in] theNbItems    number of items in the section
+//! @param[in] theWeight     functor returning estimated size of the item with specified index
+//! @param[in] theWriter     functor writing the item with specified index into the stream
+//! @param[in] theToCompress flag to compress blocks
+//! @param[in] theRange      progress indicator
+template <typename Weight_t, typename Writer_t>
+static void writeBlocks(Standard_OStream&            theStream,
+                        const int                    theNbItems,
+                        const Weight_t&              theWeight,
+                        const Writer_t&              theWriter,
+                        const bool                   theToCompress,
+                        const Message_ProgressRange& theRange)
+{
+  // first item of each block followed by the upper bound
+  NCollection_Vector<int> aBlockLowers;
+  size_t                  aWeight = THE_BLOCK_WEIGHT;
+  for (int anItemIter = 1; anItemIter <= theNbItems; ++anItemIter)
+  {
+    if (aWeight >= THE_BLOCK_WEIGHT)
+    {
+      aBlockLowers.Append(anItemIter);
+      aWeight = 0;
+    }
+    aWeight += theWeight(anItemIter);
+  }
+  const int aNbBlocks = aBlockLowers.Length();
+  aBlockLowers.Append(theNbItems + 1);
+  BinTools::PutInteger(theStream, aNbBlocks);
+
+  Message_ProgressScope aPS(theRange, nullptr, theNbItems);
+  const int             aChunkSize = 2 * OSD_Parallel::NbLogicalProcessors();
+  for (int aChunkLower = 0; aChunkLower < aNbBlocks && aPS.More(); aChunkLower += aChunkSize)
+  {
+    const int aChunkUpper = std::min(aChunkLower + aChunkSize, aNbBlocks) - 1;
+    NCollection_Array1<std::string>           aBlocks(aChunkLower, aChunkUpper);
+    NCollection_Array1<uint64_t>              aRawSizes(aChunkLower, aChunkUpper);
+    NCollection_Array1<Message_ProgressRange> aRanges(aChunkLower, aChunkUpper);
+    for (int aBlockIter = aChunkLower; aBlockIter <= aChunkUpper; ++aBlockIter)
+    {
+      aRanges.ChangeValue(aBlockIter) =
+        aPS.Next(aBlockLowers.Value(aBlockIter + 1) - aBlockLowers.Value(aBlockIter));
+    }
+    OSD_Parallel::For(
+      aChunkLower,
+      aChunkUpper + 1,
+      [&](const int theBlockIndex) {
+        const int             aLower = aBlockLowers.Value(theBlockIndex);
+        const int             aUpper = aBlockLowers.Value(theBlockIndex + 1);
+        Message_ProgressScope aBlockPS(aRanges.Value(theBlockIndex), nullptr, aUpper - aLower);
+        std::ostringstream    aBlockStream(std::ios::out | std::ios::binary);
+        for (int anItemIter = aLower; anItemIter < aUpper && aBlockPS.More();
+             ++anItemIter, aBlockPS.Next())
+        {
+          theWriter(anItemIter, aBlockStream);
+        }
+        aBlocks.ChangeValue(theBlockIndex) = aBlockStream.str();
+        if (theToCompress && aBlockPS.More())
+        {
+          aRawSizes.SetValue(theBlockIndex, aBlocks.Value(theBlockIndex).size());
+          aBlocks.ChangeValue(theBlockIndex) = compressBlock(aBlocks.Value(theBlockIndex));
+        }
+      },
+      aChunkLower == aChunkUpper);
+    if (!aPS.More())
+    {
+      return;
+    }
+
+    for (int aBlockIter = aChunkLower; aBlockIter <= aChunkUpper; ++aBlockIter)
+    {
+      const std::string& aBlock = aBlocks.Value(aBlockIter);
+      BinTools::PutInteger(theStream,
+                           aBlockLowers.Value(aBlockIter + 1) - aBlockLowers.Value(aBlockIter));
+      putSize(theStream, aBlock.size());
+      if (theToCompress)
+      {
+        putSize(theStream, aRawSizes.Value(aBlockIter));
+      }
+      theStream.write(aBlock.data(), std::streamsize(aBlock.size()));
+    }
+  }
+}
+
+//! Reads items of the section written by writeBlocks().
+//! Blocks are loaded into memory by portions, decompressed and decoded by parallel threads.
+//! @param[in] theStream       input stream
+//! @param[in] theNbItems      number of items in the section
+//! @param[in] theReader       functor reading the item with specified index from the stream;
+//!                            called concurrently for items of different blocks
+//! @param[in] theIsCompressed flag indicating compressed blocks
+//! @param[in] theRange        progress indicator
+template <typename Reader_t>
+static void readBlocks(Standard_IStream&            theStream,
+                       const int                    theNbItems,
+                       const Reader_t&              theReader,
+                       const bool                   theIsCompressed,
+                       const Message_ProgressRange& theRange)
+{
+  int aNbBlocks = 0;
+  BinTools::GetInteger(theStream, aNbBlocks);
+
+  Message_ProgressScope                     aPS(theRange, nullptr, theNbItems);
+  const int                                 aChunkSize = 2 * OSD_Parallel::NbLogicalProcessors();
+  NCollection_Array1<std::string>           aBlocks(0, aChunkSize - 1);
+  NCollection_Array1<uint64_t>              aRawSizes(0, aChunkSize - 1);
+  NCollection_Array1<Message_ProgressRange> aRanges(0, aChunkSize - 1);
+  NCollection_Array1<int>                   aBlockLowers(0, aChunkSize);
+  int                                       anItemLower = 1;
+  for (int aBlockIter = 0; aBlockIter < aNbBlocks && aPS.More();)
+  {
+    int      aNbChunkBlocks = 0;
+    uint64_t aChunkBytes    = 0;
+    for (; aBlockIter < aNbBlocks && aNbChunkBlocks < aChunkSize
+           && aChunkBytes < THE_READ_CHUNK_SIZE;
+         ++aBlockIter, ++aNbChunkBlocks)
+    {
+      int aNbBlockItems = 0;
+      BinTools::GetInteger(theStream, aNbBlockItems);
+      const uint64_t aBlockSize = getSize(theStream);
+      const uint64_t aRawSize   = theIsCompressed ? getSize(theStream) : aBlockSize;
+      if (aNbBlockItems <= 0 || aNbBlockItems > theNbItems - anItemLower + 1)
+      {
+        throw Standard_Failure("BinTools_ShapeSet::Read: Invalid block of geometry section");
+      }
+
+      std::string& aBlock = aBlocks.ChangeValue(aNbChunkBlocks);
+      aBlock.resize(size_t(aBlockSize));
+      if (!theStream.read(&aBlock[0], std::streamsize(aBlockSize)))
+      {
+        throw Storage_StreamTypeMismatchError();
+      }
+      aRawSizes.SetValue(aNbChunkBlocks, aRawSize);
+      aBlockLowers.SetValue(aNbChunkBlocks, anItemLower);
+      aRanges.ChangeValue(aNbChunkBlocks) = aPS.Next(aNbBlockItems);
+      anItemLower += aNbBlockItems;
+      aChunkBytes += aBlockSize + aRawSize;
+    }
+    aBlockLowers.SetValue(aNbChunkBlocks, anItemLower);
+
+    OSD_Parallel::For(
+      0,
+      aNbChunkBlocks,
+      [&](const int theBlockIndex) {
+        const int   aLower = aBlockLowers.Value(theBlockIndex);
+        const int   aUpper = aBlockLowers.Value(theBlockIndex + 1);
+        std::string aDecompressed;
+        if (theIsCompressed)
+        {
+          aDecompressed = decompressBlock(aBlocks.Value(theBlockIndex),
+                                          aRawSizes.Value(theBlockIndex));
+        }
+        const std::string& aBlock = theIsCompressed ? aDecompressed : aBlocks.Value(theBlockIndex);
+        Standard_ArrayStreamBuffer aBuffer(aBlock.data(), aBlock.size());
+        std::istream               aBlockStream(&aBuffer);
+        Message_ProgressScope aBlockPS(aRanges.Value(theBlockIndex), nullptr, aUpper - aLower);
+        for (int anItemIter = aLower; anItemIter < aUpper && aBlockPS.More();
+             ++anItemIter, aBlockPS.Next())
+        {
+          theReader(anItemIter, aBlockStream);
+        }
+      },
+      aNbChunkBlocks < 2);
+  }
+  if (aPS.More() && anItemLower != theNbItems + 1)
+  {
+    throw Standard_Failure("BinTools_ShapeSet::Read: Incomplete geometry section");
+  }
+}
+
+//! Reads the header of geometry section and returns the number of items.
+static int readSectionHeader(Standard_IStream& theStream, const char* theName)
+{
+  char aBuffer[255];
+  theStream >> aBuffer;
+  if (theStream.fail() || strcmp(aBuffer, theName))
+  {
+    throw Standard_Failure(
+      (TCollection_AsciiString("BinTools_ShapeSet::Read: Not a ") + theName + " table")
+        .ToCString());
+  }
+  int aNbItems = 0;
+  theStream >> aNbItems;
+  theStream.get(); // remove <lf>
+  return aNbItems;
+}
+
+//! Writes the triangulation into the stream.
+static void writeTriangulation(Standard_OStream&                      OS,
+                               const occ::handle<Poly_Triangulation>& theTriangulation,
+                               const bool                             theNeedToWriteNormals,
+                               const int                              theFormatNb)
+{
+  const int aNbNodes     = theTriangulation->NbNodes();
+  const int aNbTriangles = theTriangulation->NbTriangles();
+  BinTools::PutInteger(OS, aNbNodes);
+  BinTools::PutInteger(OS, aNbTriangles);
+  BinTools::PutBool(OS, theTriangulation->HasUVNodes() ? true : false);
+  if (theFormatNb >= BinTools_FormatVersion_VERSION_4)
+  {
+    BinTools::PutBool(OS,
+                      (theTriangulation->HasNormals() && theNeedToWriteNormals) ? true : false);
+  }
+  BinTools::PutReal(OS, theTriangulation->Deflection());
+
+  // write the 3d nodes
+  for (int aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+  {
+    const gp_Pnt aPnt = theTriangulation->Node(aNodeIter);
+    BinTools::PutReal(OS, aPnt.X());
+    BinTools::PutReal(OS, aPnt.Y());
+    BinTools::PutReal(OS, aPnt.Z());
+  }
+
+  if (theTriangulation->HasUVNodes())
+  {
+    for (int aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+    {
+      const gp_Pnt2d aUV = theTriangulation->UVNode(aNodeIter);
+      BinTools::PutReal(OS, aUV.X());
+      BinTools::PutReal(OS, aUV.Y());
+    }
+  }
+
+  for (int aTriIter = 1; aTriIter <= aNbTriangles; ++aTriIter)
+  {
+    const Poly_Triangle aTri = theTriangulation->Triangle(aTriIter);
+    BinTools::PutInteger(OS, aTri.Value(1));
+    BinTools::PutInteger(OS, aTri.Value(2));
+    BinTools::PutInteger(OS, aTri.Value(3));
+  }
+
+  // write the normals
+  if (theFormatNb >= BinTools_FormatVersion_VERSION_4)
+  {
+    if (theTriangulation->HasNormals() && theNeedToWriteNormals)
+    {
+      NCollection_Vec3<float> aNormal;
+      for (int aNormalIter = 1; aNormalIter <= aNbNodes; ++aNormalIter)
+      {
+        theTriangulation->Normal(aNormalIter, aNormal);
+        BinTools::PutShortReal(OS, aNormal.x());
+        BinTools::PutShortReal(OS, aNormal.y());
+        BinTools::PutShortReal(OS, aNormal.z());
+      }
+    }
+  }
+}
+
+//! Reads values from the stream directly into the memory of array
+//! when the file and the memory layouts are the same.
+//! @return FALSE if values should be read one by one
+static bool readArray(Standard_IStream& IS, void* theData, const size_t theNbBytes)
+{
+#ifdef DO_INVERSE
+  (void)IS;
+  (void)theData;
+  (void)theNbBytes;
+  return false;
+#else
+  if (theNbBytes != 0 && !IS.read(static_cast<char*>(theData), std::streamsize(theNbBytes)))
+  {
+    throw Storage_StreamTypeMismatchError();
+  }
+  return true;
+#endif
+}
+
+//! Reads the triangulation from the stream.
+//! Nodes, triangles and normals are bulk-read into arrays of triangulation when possible.
+static occ::handle<Poly_Triangulation> readTriangulation(Standard_IStream& IS,
+                                                         const int         theFormatNb,
+                                                         bool&             theHasNormals)
+{
+  int    aNbNodes = 0, aNbTriangles = 0;
+  bool   hasUV      = false;
+  bool   hasNormals = false;
+  double aDefl      = 0.0;
+  BinTools::GetInteger(IS, aNbNodes);
+  BinTools::GetInteger(IS, aNbTriangles);
+  BinTools::GetBool(IS, hasUV);
+  if (theFormatNb >= BinTools_FormatVersion_VERSION_4)
+  {
+    BinTools::GetBool(IS, hasNormals);
+  }
+  BinTools::GetReal(IS, aDefl); // deflection
+  occ::handle<Poly_Triangulation> aTriangulation =
+    new Poly_Triangulation(aNbNodes, aNbTriangles, hasUV, hasNormals);
+  aTriangulation->Deflection(aDefl);
+  theHasNormals = hasNormals;
+
+  Poly_ArrayOfNodes& aNodes = aTriangulation->InternalNodes();
+  if (aNbNodes == 0 || !aNodes.IsDoublePrecision()
+      || !readArray(IS, aNodes.changeValue(0), aNodes.SizeBytes()))
+  {
+    gp_Pnt aNode;
+    for (int aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+    {
+      BinTools::GetReal(IS, aNode.ChangeCoord().ChangeCoord(1));
+      BinTools::GetReal(IS, aNode.ChangeCoord().ChangeCoord(2));
+      BinTools::GetReal(IS, aNode.ChangeCoord().ChangeCoord(3));
+      aTriangulation->SetNode(aNodeIter, aNode);
+    }
+  }
+
+  if (hasUV)
+  {
+    Poly_ArrayOfUVNodes& aUVNodes = aTriangulation->InternalUVNodes();
+    if (aNbNodes == 0 || !aUVNodes.IsDoublePrecision()
+        || !readArray(IS, aUVNodes.changeValue(0), aUVNodes.SizeBytes()))
+    {
+      gp_Pnt2d aNode2d;
+      for (int aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
+      {
+        BinTools::GetReal(IS, aNode2d.ChangeCoord().ChangeCoord(1));
+        BinTools::GetReal(IS, aNode2d.ChangeCoord().ChangeCoord(2));
+        aTriangulation->SetUVNode(aNodeIter, aNode2d);
+      }
+    }
+  }
+
+  // read the triangles
+  NCollection_Array1<Poly_Triangle>& aTriangles = aTriangulation->InternalTriangles();
+  if (aNbTriangles == 0 || sizeof(Poly_Triangle) != 3 * sizeof(int)
+      || !readArray(IS, &aTriangles.ChangeFirst(), aTriangles.Size() * sizeof(Poly_Triangle)))
+  {
+    int aTriNodes[3] = {};
+    for (int aTriIter = 1; aTriIter <= aNbTriangles; ++aTriIter)
+    {
+      BinTools::GetInteger(IS, aTriNodes[0]);
+      BinTools::GetInteger(IS, aTriNodes[1]);
+      BinTools::GetInteger(IS, aTriNodes[2]);
+      aTriangulation->SetTriangle(aTriIter,
+                                  Poly_Triangle(aTriNodes[0], aTriNodes[1], aTriNodes[2]));
+    }
+  }
+
+  if (hasNormals)
+  {
+    NCollection_Array1<NCollection_Vec3<float>>& aNormals = aTriangulation->InternalNormals();
+    if (aNbNodes == 0 || aNormals.Size() != aNbNodes
+        || !readArray(IS,
+                      &aNormals.ChangeFirst(),
+                      aNormals.Size() * sizeof(NCollection_Vec3<float>)))
+    {
+      NCollection_Vec3<float> aNormal;
+      for (int aNormalIter = 1; aNormalIter <= aNbNodes; ++aNormalIter)
+      {
+        BinTools::GetShortReal(IS, aNormal.x());
+        BinTools::GetShortReal(IS, aNormal.y());
+        BinTools::GetShortReal(IS, aNormal.z());
+        aTriangulation->SetNormal(aNormalIter, aNormal);
+      }
+    }
+  }
+  return aTriangulation;
+}
+} // namespace
 
 //=================================================================================================
 
@@ -258,10 +713,46 @@ void BinTools_ShapeSet::WriteGeometry(Standard_OStream&            OS,
                                       const Message_ProgressRange& theRange) const
 {
   Message_ProgressScope aPS(theRange, "Writing geometry", 6);
-  myCurves2d.Write(OS, aPS.Next());
+  if (FormatNb() >= BinTools_FormatVersion_VERSION_5)
+  {
+    const int aNbCurves2d = myCurves2d.NbCurves2d();
+    OS << "Curve2ds " << aNbCurves2d << "\n";
+    writeBlocks(
+      OS,
+      aNbCurves2d,
+      [](int) { return THE_GEOMETRY_WEIGHT; },
+      [this](int theIndex, Standard_OStream& theStream) {
+        BinTools_OStream aStream(theStream);
+        BinTools_Curve2dSet::WriteCurve2d(myCurves2d.Curve2d(theIndex), aStream);
+      },
+      FormatNb() >= BinTools_FormatVersion_VERSION_6,
+      aPS.Next());
+  }
+  else
+  {
+    myCurves2d.Write(OS, aPS.Next());
+  }
   if (!aPS.More())
     return;
-  myCurves.Write(OS, aPS.Next());
+  if (FormatNb() >= BinTools_FormatVersion_VERSION_5)
+  {
+    const int aNbCurves = myCurves.NbCurves();
+    OS << "Curves " << aNbCurves << "\n";
+    writeBlocks(
+      OS,
+      aNbCurves,
+      [](int) { return THE_GEOMETRY_WEIGHT; },
+      [this](int theIndex, Standard_OStream& theStream) {
+        BinTools_OStream aStream(theStream);
+        BinTools_CurveSet::WriteCurve(myCurves.Curve(theIndex), aStream);
+      },
+      FormatNb() >= BinTools_FormatVersion_VERSION_6,
+      aPS.Next());
+  }
+  else
+  {
+    myCurves.Write(OS, aPS.Next());
+  }
   if (!aPS.More())
     return;
   WritePolygon3D(OS, aPS.Next());
@@ -270,7 +761,25 @@ void BinTools_ShapeSet::WriteGeometry(Standard_OStream&            OS,
   WritePolygonOnTriangulation(OS, aPS.Next());
   if (!aPS.More())
     return;
-  mySurfaces.Write(OS, aPS.Next());
+  if (FormatNb() >= BinTools_FormatVersion_VERSION_5)
+  {
+    const int aNbSurfaces = mySurfaces.NbSurfaces();
+    OS << "Surfaces " << aNbSurfaces << "\n";
+    writeBlocks(
+      OS,
+      aNbSurfaces,
+      [](int) { return THE_GEOMETRY_WEIGHT; },
+      [this](int theIndex, Standard_OStream& theStream) {
+        BinTools_OStream aStream(theStream);
+        BinTools_SurfaceSet::WriteSurface(mySurfaces.Surface(theIndex), aStream);
+      },
+      FormatNb() >= BinTools_FormatVersion_VERSION_6,
+      aPS.Next());
+  }
+  else
+  {
+    mySurfaces.Write(OS, aPS.Next());
+  }
   if (!aPS.More())
     return;
   WriteTriangulation(OS, aPS.Next());
@@ -295,6 +804,32 @@ void BinTools_ShapeSet::Write(Standard_OStream& OS, const Message_ProgressRange&
 
   Message_ProgressScope aPS(theRange, "Writing geometry", 2);
 
+  // register levels of detail of faces, which are written only by newer format
+  if (FormatNb() >= BinTools_FormatVersion_VERSION_7)
+  {
+    for (int aShapeIter = 1; aShapeIter <= myShapes.Extent(); ++aShapeIter)
+    {
+      const TopoDS_Shape& aShape = myShapes(aShapeIter);
+      if (aShape.ShapeType() != TopAbs_FACE)
+      {
+        continue;
+      }
+
+      occ::handle<BRep_TFace> aTF = occ::down_cast<BRep_TFace>(aShape.TShape());
+      if (aTF->NbTriangulations() > 1 && (IsWithTriangles() || aTF->Surface().IsNull()))
+      {
+        const bool aNeedNormals = IsWithNormals() || aTF->Surface().IsNull();
+        for (NCollection_List<occ::handle<Poly_Triangulation>>::Iterator aTriIter(
+               aTF->Triangulations());
+             aTriIter.More();
+             aTriIter.Next())
+        {
+          myTriangulations.Add(aTriIter.Value(), aNeedNormals);
+        }
+      }
+    }
+  }
+
   WriteGeometry(OS, aPS.Next());
   if (!aPS.More())
     return;
@@ -513,11 +1048,51 @@ void BinTools_ShapeSet::ReadGeometry(Standard_IStream& IS, const Message_Progres
 {
 
   Message_ProgressScope aPS(theRange, "Reading geometry", 6);
-  myCurves2d.Read(IS, aPS.Next());
+  if (FormatNb() >= BinTools_FormatVersion_VERSION_5)
+  {
+    const int                                     aNbCurves2d = readSectionHeader(IS, "Curve2ds");
+    NCollection_Array1<occ::handle<Geom2d_Curve>> aCurves2d(1, aNbCurves2d);
+    readBlocks(
+      IS,
+      aNbCurves2d,
+      [&aCurves2d](int theIndex, Standard_IStream& theStream) {
+        BinTools_Curve2dSet::ReadCurve2d(theStream, aCurves2d.ChangeValue(theIndex));
+      },
+      FormatNb() >= BinTools_FormatVersion_VERSION_6,
+      aPS.Next());
+    for (int aCurveIter = 1; aCurveIter <= aNbCurves2d && aPS.More(); ++aCurveIter)
+    {
+      myCurves2d.Add(aCurves2d.Value(aCurveIter));
+    }
+  }
+  else
+  {
+    myCurves2d.Read(IS, aPS.Next());
+  }
   if (!aPS.More())
     return;
 
-  myCurves.Read(IS, aPS.Next());
+  if (FormatNb() >= BinTools_FormatVersion_VERSION_5)
+  {
+    const int                                   aNbCurves = readSectionHeader(IS, "Curves");
+    NCollection_Array1<occ::handle<Geom_Curve>> aCurves(1, aNbCurves);
+    readBlocks(
+      IS,
+      aNbCurves,
+      [&aCurves](int theIndex, Standard_IStream& theStream) {
+        BinTools_CurveSet::ReadCurve(theStream, aCurves.ChangeValue(theIndex));
+      },
+      FormatNb() >= BinTools_FormatVersion_VERSION_6,
+      aPS.Next());
+    for (int aCurveIter = 1; aCurveIter <= aNbCurves && aPS.More(); ++aCurveIter)
+    {
+      myCurves.Add(aCurves.Value(aCurveIter));
+    }
+  }
+  else
+  {
+    myCurves.Read(IS, aPS.Next());
+  }
   if (!aPS.More())
     return;
 
@@ -529,7 +1104,27 @@ void BinTools_ShapeSet::ReadGeometry(Standard_IStream& IS, const Message_Progres
   if (!aPS.More())
     return;
 
-  mySurfaces.Read(IS, aPS.Next());
+  if (FormatNb() >= BinTools_FormatVersion_VERSION_5)
+  {
+    const int                                     aNbSurfaces = readSectionHeader(IS, "Surfaces");
+    NCollection_Array1<occ::handle<Geom_Surface>> aSurfaces(1, aNbSurfaces);
+    readBlocks(
+      IS,
+      aNbSurfaces,
+      [&aSurfaces](int theIndex, Standard_IStream& theStream) {
+        BinTools_SurfaceSet::ReadSurface(theStream, aSurfaces.ChangeValue(theIndex));
+      },
+      FormatNb() >= BinTools_FormatVersion_VERSION_6,
+      aPS.Next());
+    for (int aSurfIter = 1; aSurfIter <= aNbSurfaces && aPS.More(); ++aSurfIter)
+    {
+      mySurfaces.Add(aSurfaces.Value(aSurfIter));
+    }
+  }
+  else
+  {
+    mySurfaces.Read(IS, aPS.Next());
+  }
   if (!aPS.More())
     return;
 
@@ -746,7 +1341,23 @@ void BinTools_ShapeSet::WriteShape(const TopoDS_Shape& S, Standard_OStream& OS)
       {
         if (!(TF->Triangulation()).IsNull())
         {
-          OS << (uint8_t)2;
+          if (FormatNb() >= BinTools_FormatVersion_VERSION_7 && TF->NbTriangulations() > 1)
+          {
+            // Write all triangulations (levels of detail) followed by the active one
+            OS << (uint8_t)3;
+            BinTools::PutInteger(OS, TF->NbTriangulations());
+            for (NCollection_List<occ::handle<Poly_Triangulation>>::Iterator aTriIter(
+                   TF->Triangulations());
+                 aTriIter.More();
+                 aTriIter.Next())
+            {
+              BinTools::PutInteger(OS, myTriangulations.FindIndex(aTriIter.Value()));
+            }
+          }
+          else
+          {
+            OS << (uint8_t)2;
+          }
           // Write the triangulation
           BinTools::PutInteger(OS, myTriangulations.FindIndex(TF->Triangulation()));
         }
@@ -1128,6 +1739,22 @@ void BinTools_ShapeSet::ReadShape(const TopAbs_ShapeEnum T, Standard_IStream& IS
           BinTools::GetInteger(IS, s);
           myBuilder.UpdateFace(TopoDS::Face(S), myTriangulations.FindKey(s));
         }
+        // levels of detail case (BinTools_FormatVersion_VERSION_7)
+        else if (aByte == 3)
+        {
+          int aNbTriangulations = 0;
+          BinTools::GetInteger(IS, aNbTriangulations);
+          NCollection_List<occ::handle<Poly_Triangulation>> aTriangulations;
+          for (int aTriIter = 1; aTriIter <= aNbTriangulations; ++aTriIter)
+          {
+            BinTools::GetInteger(IS, s);
+            aTriangulations.Append(myTriangulations.FindKey(s));
+          }
+          BinTools::GetInteger(IS, s);
+          myBuilder.UpdateFace(F, myTriangulations.FindKey(s));
+          occ::down_cast<BRep_TFace>(F.TShape())
+            ->Triangulations(aTriangulations, myTriangulations.FindKey(s));
+        }
       }
       break;
 
@@ -1417,66 +2044,35 @@ void BinTools_ShapeSet::WriteTriangulation(Standard_OStream&            OS,
   try
   {
     OCC_CATCH_SIGNALS
+    if (FormatNb() >= BinTools_FormatVersion_VERSION_5)
+    {
+      writeBlocks(
+        OS,
+        aNbTriangulations,
+        [this](int theIndex) {
+          const occ::handle<Poly_Triangulation>& aTriangulation =
+            myTriangulations.FindKey(theIndex);
+          return size_t(aTriangulation->NbNodes()) + size_t(aTriangulation->NbTriangles()) + 1;
+        },
+        [this](int theIndex, Standard_OStream& theStream) {
+          writeTriangulation(theStream,
+                             myTriangulations.FindKey(theIndex),
+                             myTriangulations.FindFromIndex(theIndex),
+                             FormatNb());
+        },
+        FormatNb() >= BinTools_FormatVersion_VERSION_6,
+        theRange);
+      return;
+    }
+
     Message_ProgressScope aPS(theRange, "Writing triangulation", aNbTriangulations);
     for (int aTriangulationIter = 1; aTriangulationIter <= aNbTriangulations && aPS.More();
          ++aTriangulationIter, aPS.Next())
     {
-      const occ::handle<Poly_Triangulation>& aTriangulation =
-        myTriangulations.FindKey(aTriangulationIter);
-      bool      NeedToWriteNormals = myTriangulations.FindFromIndex(aTriangulationIter);
-      const int aNbNodes           = aTriangulation->NbNodes();
-      const int aNbTriangles       = aTriangulation->NbTriangles();
-      BinTools::PutInteger(OS, aNbNodes);
-      BinTools::PutInteger(OS, aNbTriangles);
-      BinTools::PutBool(OS, aTriangulation->HasUVNodes() ? true : false);
-      if (FormatNb() >= BinTools_FormatVersion_VERSION_4)
-      {
-        BinTools::PutBool(OS, (aTriangulation->HasNormals() && NeedToWriteNormals) ? true : false);
-      }
-      BinTools::PutReal(OS, aTriangulation->Deflection());
-
-      // write the 3d nodes
-      for (int aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
-      {
-        const gp_Pnt aPnt = aTriangulation->Node(aNodeIter);
-        BinTools::PutReal(OS, aPnt.X());
-        BinTools::PutReal(OS, aPnt.Y());
-        BinTools::PutReal(OS, aPnt.Z());
-      }
-
-      if (aTriangulation->HasUVNodes())
-      {
-        for (int aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
-        {
-          const gp_Pnt2d aUV = aTriangulation->UVNode(aNodeIter);
-          BinTools::PutReal(OS, aUV.X());
-          BinTools::PutReal(OS, aUV.Y());
-        }
-      }
-
-      for (int aTriIter = 1; aTriIter <= aNbTriangles; ++aTriIter)
-      {
-        const Poly_Triangle aTri = aTriangulation->Triangle(aTriIter);
-        BinTools::PutInteger(OS, aTri.Value(1));
-        BinTools::PutInteger(OS, aTri.Value(2));
-        BinTools::PutInteger(OS, aTri.Value(3));
-      }
-
-      // write the normals
-      if (FormatNb() >= BinTools_FormatVersion_VERSION_4)
-      {
-        if (aTriangulation->HasNormals() && NeedToWriteNormals)
-        {
-          NCollection_Vec3<float> aNormal;
-          for (int aNormalIter = 1; aNormalIter <= aNbNodes; ++aNormalIter)
-          {
-            aTriangulation->Normal(aNormalIter, aNormal);
-            BinTools::PutShortReal(OS, aNormal.x());
-            BinTools::PutShortReal(OS, aNormal.y());
-            BinTools::PutShortReal(OS, aNormal.z());
-          }
-        }
-      }
+      writeTriangulation(OS,
+                         myTriangulations.FindKey(aTriangulationIter),
+                         myTriangulations.FindFromIndex(aTriangulationIter),
+                         FormatNb());
     }
   }
   catch (Standard_Failure const& anException)
@@ -1506,71 +2102,36 @@ void BinTools_ShapeSet::ReadTriangulation(Standard_IStream&            IS,
   try
   {
     OCC_CATCH_SIGNALS
-    Message_ProgressScope aPS(theRange, "Reading triangulation", aNbTriangulations);
-    for (int aTriangulationIter = 1; aTriangulationIter <= aNbTriangulations && aPS.More();
-         ++aTriangulationIter, aPS.Next())
+    if (FormatNb() >= BinTools_FormatVersion_VERSION_5)
     {
-      int    aNbNodes = 0, aNbTriangles = 0;
-      bool   hasUV      = false;
-      bool   hasNormals = false;
-      double aDefl      = 0.0;
-      BinTools::GetInteger(IS, aNbNodes);
-      BinTools::GetInteger(IS, aNbTriangles);
-      BinTools::GetBool(IS, hasUV);
-      if (FormatNb() >= BinTools_FormatVersion_VERSION_4)
-      {
-        BinTools::GetBool(IS, hasNormals);
-      }
-      BinTools::GetReal(IS, aDefl); // deflection
-      occ::handle<Poly_Triangulation> aTriangulation =
-        new Poly_Triangulation(aNbNodes, aNbTriangles, hasUV, hasNormals);
-      aTriangulation->Deflection(aDefl);
-
-      gp_Pnt aNode;
-      for (int aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
-      {
-        BinTools::GetReal(IS, aNode.ChangeCoord().ChangeCoord(1));
-        BinTools::GetReal(IS, aNode.ChangeCoord().ChangeCoord(2));
-        BinTools::GetReal(IS, aNode.ChangeCoord().ChangeCoord(3));
-        aTriangulation->SetNode(aNodeIter, aNode);
-      }
-
-      if (hasUV)
-      {
-        gp_Pnt2d aNode2d;
-        for (int aNodeIter = 1; aNodeIter <= aNbNodes; ++aNodeIter)
-        {
-          BinTools::GetReal(IS, aNode2d.ChangeCoord().ChangeCoord(1));
-          BinTools::GetReal(IS, aNode2d.ChangeCoord().ChangeCoord(2));
-          aTriangulation->SetUVNode(aNodeIter, aNode2d);
-        }
-      }
-
-      // read the triangles
-      int aTriNodes[3] = {};
-      for (int aTriIter = 1; aTriIter <= aNbTriangles; ++aTriIter)
+      NCollection_Array1<occ::handle<Poly_Triangulation>> aTriangulations(1, aNbTriangulations);
+      NCollection_Array1<bool>                            aHasNormals(1, aNbTriangulations);
+      Message_ProgressScope                               aPS(theRange, "Reading triangulation", 1);
+      readBlocks(
+        IS,
+        aNbTriangulations,
+        [&](int theIndex, Standard_IStream& theStream) {
+          aTriangulations.ChangeValue(theIndex) =
+            readTriangulation(theStream, FormatNb(), aHasNormals.ChangeValue(theIndex));
+        },
+        FormatNb() >= BinTools_FormatVersion_VERSION_6,
+        aPS.Next());
+      for (int aTriangulationIter = 1; aTriangulationIter <= aNbTriangulations && aPS.More();
+           ++aTriangulationIter)
       {
-        BinTools::GetInteger(IS, aTriNodes[0]);
-        BinTools::GetInteger(IS, aTriNodes[1]);
-        BinTools::GetInteger(IS, aTriNodes[2]);
-        aTriangulation->SetTriangle(aTriIter,
-                                    Poly_Triangle(aTriNodes[0], aTriNodes[1], aTriNodes[2]));
-      }
-      // IS.ignore(sizeof(double) * (hasUV ? 5 : 3) * aNbNodes + sizeof(int) * 3
-      // * aNbTriangles);
-
-      if (hasNormals)
-      {
-        NCollection_Vec3<float> aNormal;
-        for (int aNormalIter = 1; aNormalIter <= aNbNodes; ++aNormalIter)
-        {
-          BinTools::GetShortReal(IS, aNormal.x());
-          BinTools::GetShortReal(IS, aNormal.y());
-          BinTools::GetShortReal(IS, aNormal.z());
-          aTriangulation->SetNormal(aNormalIter, aNormal);
-        }
+        myTriangulations.Add(aTriangulations.Value(aTriangulationIter),
+                             aHasNormals.Value(aTriangulationIter));
       }
+      return;
+    }
 
+    Message_ProgressScope aPS(theRange, "Reading triangulation", aNbTriangulations);
+    for (int aTriangulationIter = 1; aTriangulationIter <= aNbTriangulations && aPS.More();
+         ++aTriangulationIter, aPS.Next())
+    {
+      bool                                  hasNormals = false;
+      const occ::handle<Poly_Triangulation> aTriangulation =
+        readTriangulation(IS, FormatNb(), hasNormals);
       myTriangulations.Add(aTriangulation, hasNormals);
     }
   }
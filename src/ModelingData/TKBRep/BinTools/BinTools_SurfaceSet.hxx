@@ -53,6 +53,9 @@ public:
   //! Returns the index of <L>.
   Standard_EXPORT int Index(const occ::handle<Geom_Surface>& S) const;
 
+  //! Returns number of surfaces in the set.
+  int NbSurfaces() const { return myMap.Extent(); }
+
   //! Writes the content of me on the stream <OS> in
   //! binary format that can be read back by Read.
   Standard_EXPORT void Write(Standard_OStream&            OS,
@@ -5,4 +5,5 @@ set(OCCT_TKBRep_EXTERNAL_LIBS
   TKG2d
   TKG3d
   TKGeomBase
+  CSF_Zstd
 )
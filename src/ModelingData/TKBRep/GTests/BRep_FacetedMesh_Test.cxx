@@ -0,0 +1,167 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRep_Builder.hxx>
+#include <BRep_FacetedMesh.hxx>
+#include <BRep_Tool.hxx>
+#include <Geom_Plane.hxx>
+#include <OSD_Parallel.hxx>
+#include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Face.hxx>
+#include <TopoDS_FrozenShape.hxx>
+#include <TopoDS_Iterator.hxx>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace
+{
+//! Makes the triangulation of a square grid of theNbCells x theNbCells cells
+//! with two triangles per cell and one additional degenerated triangle.
+occ::handle<Poly_Triangulation> makeGrid(const int theNbCells)
+{
+  const int                       aNbNodes = (theNbCells + 1) * (theNbCells + 1);
+  occ::handle<Poly_Triangulation> aMesh =
+    new Poly_Triangulation(aNbNodes, 2 * theNbCells * theNbCells + 1, false);
+  for (int aRow = 0; aRow <= theNbCells; ++aRow)
+  {
+    for (int aCol = 0; aCol <= theNbCells; ++aCol)
+    {
+      aMesh->SetNode(aRow * (theNbCells + 1) + aCol + 1, gp_Pnt(aCol, aRow, 0.0));
+    }
+  }
+
+  int aTriangle = 0;
+  for (int aRow = 0; aRow < theNbCells; ++aRow)
+  {
+    for (int aCol = 0; aCol < theNbCells; ++aCol)
+    {
+      const int aNode = aRow * (theNbCells + 1) + aCol + 1;
+      aMesh->SetTriangle(++aTriangle, Poly_Triangle(aNode, aNode + 1, aNode + theNbCells + 2));
+      aMesh->SetTriangle(++aTriangle,
+                         Poly_Triangle(aNode, aNode + theNbCells + 2, aNode + theNbCells + 1));
+    }
+  }
+  aMesh->SetTriangle(++aTriangle, Poly_Triangle(1, 2, 2));
+  return aMesh;
+}
+} // namespace
+
+TEST(BRep_FacetedMeshTest, OnDemandMaterialization)
+{
+  const TopoDS_Compound aCompound = BRep_FacetedMesh::MakeCompound(makeGrid(10));
+  ASSERT_FALSE(aCompound.IsNull());
+  const occ::handle<BRep_FacetedMesh> aMesh = BRep_FacetedMesh::Find(aCompound);
+  ASSERT_FALSE(aMesh.IsNull());
+  EXPECT_TRUE(aCompound.TShape()->IsDeferred());
+  EXPECT_FALSE(aCompound.Free());
+  EXPECT_EQ(200, aMesh->NbFaces());
+  EXPECT_EQ(10 * 11 * 2 + 100, aMesh->NbEdges());
+
+  // exploring faces does not create edges and vertices
+  NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> aFaces;
+  TopExp::MapShapes(aCompound, TopAbs_FACE, aFaces);
+  EXPECT_EQ(200, aFaces.Extent());
+  EXPECT_EQ(200, aCompound.NbChildren());
+  EXPECT_EQ(0, aMesh->NbMaterializedEdges());
+  EXPECT_EQ(0, aMesh->NbMaterializedVertices());
+  EXPECT_EQ(aMesh, BRep_FacetedMesh::Find(aFaces(1)));
+
+  // faces are planes with the normal of the triangles
+  const TopoDS_Face&              aFace  = TopoDS::Face(aFaces(1));
+  const occ::handle<Geom_Plane>   aPlane = occ::down_cast<Geom_Plane>(BRep_Tool::Surface(aFace));
+  ASSERT_FALSE(aPlane.IsNull());
+  EXPECT_TRUE(aPlane->Axis().Direction().IsEqual(gp::DZ(), Precision::Angular()));
+  EXPECT_EQ(1, aFace.NbChildren());
+
+  // shared edges and vertices are created once
+  NCollection_IndexedDataMap<TopoDS_Shape, NCollection_List<TopoDS_Shape>, TopTools_ShapeMapHasher>
+    anEdgeFaces;
+  TopExp::MapShapesAndAncestors(aCompound, TopAbs_EDGE, TopAbs_FACE, anEdgeFaces);
+  EXPECT_EQ(aMesh->NbEdges(), anEdgeFaces.Extent());
+  EXPECT_EQ(aMesh->NbEdges(), aMesh->NbMaterializedEdges());
+  EXPECT_EQ(121, aMesh->NbMaterializedVertices());
+  int aNbFreeEdges = 0;
+  for (int anEdgeIter = 1; anEdgeIter <= anEdgeFaces.Extent(); ++anEdgeIter)
+  {
+    aNbFreeEdges += anEdgeFaces(anEdgeIter).Extent() == 1 ? 1 : 0;
+    EXPECT_LE(anEdgeFaces(anEdgeIter).Extent(), 2);
+  }
+  EXPECT_EQ(40, aNbFreeEdges);
+
+  // edges are line segments between the vertices
+  for (TopExp_Explorer anExp(aFace, TopAbs_EDGE); anExp.More(); anExp.Next())
+  {
+    const TopoDS_Edge& anEdge = TopoDS::Edge(anExp.Current());
+    TopoDS_Vertex      aFirst, aLast;
+    TopExp::Vertices(anEdge, aFirst, aLast, true);
+    double                         aParams[2] = {0.0, 0.0};
+    const occ::handle<Geom_Curve>& aCurve     = BRep_Tool::Curve(anEdge, aParams[0], aParams[1]);
+    ASSERT_FALSE(aCurve.IsNull());
+    EXPECT_TRUE(aCurve->Value(BRep_Tool::Parameter(aFirst, anEdge))
+                  .IsEqual(BRep_Tool::Pnt(aFirst), Precision::Confusion()));
+    EXPECT_TRUE(aCurve->Value(BRep_Tool::Parameter(aLast, anEdge))
+                  .IsEqual(BRep_Tool::Pnt(aLast), Precision::Confusion()));
+  }
+  EXPECT_EQ(aMesh->NbEdges(), aMesh->NbMaterializedEdges());
+}
+
+TEST(BRep_FacetedMeshTest, ReadOnlyAndCopy)
+{
+  TopoDS_Compound aCompound = BRep_FacetedMesh::MakeCompound(makeGrid(2));
+  TopoDS_Face     aFace;
+  BRep_Builder    aBuilder;
+  aBuilder.MakeFace(aFace);
+  EXPECT_THROW(aBuilder.Add(aCompound, aFace), TopoDS_FrozenShape);
+
+  // the copy of the TShape is an ordinary editable shape
+  TopoDS_Iterator aFaceIter(aCompound);
+  ASSERT_TRUE(aFaceIter.More());
+  TopoDS_Shape aCopy = aFaceIter.Value().EmptyCopied();
+  EXPECT_TRUE(aCopy.Free());
+  EXPECT_FALSE(aCopy.TShape()->IsDeferred());
+  EXPECT_EQ(0, aCopy.NbChildren());
+  EXPECT_TRUE(BRep_FacetedMesh::Find(aCopy).IsNull());
+  EXPECT_FALSE(BRep_Tool::Surface(TopoDS::Face(aCopy)).IsNull());
+
+  EXPECT_TRUE(BRep_FacetedMesh::MakeCompound(new Poly_Triangulation(3, 0, false)).IsNull());
+}
+
+TEST(BRep_FacetedMeshTest, ParallelExploration)
+{
+  const TopoDS_Compound aCompound = BRep_FacetedMesh::MakeCompound(makeGrid(50));
+  std::vector<TopoDS_Shape> aFaces;
+  for (TopoDS_Iterator aFaceIter(aCompound); aFaceIter.More(); aFaceIter.Next())
+  {
+    aFaces.push_back(aFaceIter.Value());
+  }
+
+  // faces sharing edges are explored concurrently
+  std::vector<TopoDS_Shape> aFirstEdges(aFaces.size());
+  OSD_Parallel::For(0, int(aFaces.size()), [&](const int theIndex) {
+    TopExp_Explorer anExp(aFaces[theIndex], TopAbs_EDGE);
+    aFirstEdges[theIndex] = anExp.Current();
+  });
+
+  const occ::handle<BRep_FacetedMesh> aMesh = BRep_FacetedMesh::Find(aCompound);
+  EXPECT_EQ(aMesh->NbEdges(), aMesh->NbMaterializedEdges());
+  EXPECT_EQ(51 * 51, aMesh->NbMaterializedVertices());
+  for (size_t anIndex = 0; anIndex < aFaces.size(); ++anIndex)
+  {
+    TopExp_Explorer anExp(aFaces[anIndex], TopAbs_EDGE);
+    EXPECT_TRUE(anExp.Current().IsEqual(aFirstEdges[anIndex]));
+  }
+}
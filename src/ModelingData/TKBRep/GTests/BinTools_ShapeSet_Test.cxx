@@ -0,0 +1,196 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <BinTools.hxx>
+#include <BRep_Builder.hxx>
+#include <BRep_TFace.hxx>
+#include <Geom_Circle.hxx>
+#include <Geom_Plane.hxx>
+#include <Geom2d_Circle.hxx>
+#include <Poly_Triangulation.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Compound.hxx>
+#include <TopoDS_Edge.hxx>
+#include <TopoDS_Face.hxx>
+#include <TopoDS_Vertex.hxx>
+#include <TopoDS_Wire.hxx>
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+namespace
+{
+//! Creates a triangulated grid of (theNbCells + 1)^2 nodes.
+occ::handle<Poly_Triangulation> makeGrid(const int theNbCells, const bool theToNormals)
+{
+  const int                       aNbNodes = (theNbCells + 1) * (theNbCells + 1);
+  occ::handle<Poly_Triangulation> aTris =
+    new Poly_Triangulation(aNbNodes, theNbCells * theNbCells * 2, true, theToNormals);
+  for (int aRow = 0; aRow <= theNbCells; ++aRow)
+  {
+    for (int aCol = 0; aCol <= theNbCells; ++aCol)
+    {
+      const int aNode = aRow * (theNbCells + 1) + aCol + 1;
+      aTris->SetNode(aNode, gp_Pnt(aCol * 0.1, aRow / 3.0, 0.0));
+      aTris->SetUVNode(aNode, gp_Pnt2d(aCol * 0.1, aRow / 3.0));
+      if (theToNormals)
+      {
+        aTris->SetNormal(aNode, gp_Dir(0.0, 0.6, 0.8));
+      }
+    }
+  }
+  for (int aRow = 0, aTriIter = 1; aRow < theNbCells; ++aRow)
+  {
+    for (int aCol = 0; aCol < theNbCells; ++aCol, aTriIter += 2)
+    {
+      const int aNode1 = aRow * (theNbCells + 1) + aCol + 1;
+      const int aNode2 = aNode1 + theNbCells + 1;
+      aTris->SetTriangle(aTriIter, Poly_Triangle(aNode1, aNode1 + 1, aNode2 + 1));
+      aTris->SetTriangle(aTriIter + 1, Poly_Triangle(aNode1, aNode2 + 1, aNode2));
+    }
+  }
+  return aTris;
+}
+
+//! Creates a compound of planar faces bounded by circles,
+//! so that the shape has many curves, 2D curves, surfaces and triangulations.
+TopoDS_Shape makeShape(const int theNbFaces)
+{
+  BRep_Builder    aBuilder;
+  TopoDS_Compound aComp;
+  aBuilder.MakeCompound(aComp);
+  for (int aFaceIter = 0; aFaceIter < theNbFaces; ++aFaceIter)
+  {
+    const gp_Ax2 anAx(gp_Pnt(0.0, 0.0, aFaceIter * 0.5), gp::DZ());
+    TopoDS_Face  aFace;
+    aBuilder.MakeFace(aFace, new Geom_Plane(gp_Ax3(anAx)), 1.0e-7);
+
+    const double             aRadius = 1.0 + aFaceIter % 7;
+    occ::handle<Geom_Circle> aCircle = new Geom_Circle(anAx, aRadius);
+    TopoDS_Vertex            aVertex;
+    aBuilder.MakeVertex(aVertex, aCircle->Value(0.0), 1.0e-7);
+    TopoDS_Edge anEdge;
+    aBuilder.MakeEdge(anEdge, aCircle, 1.0e-7);
+    aBuilder.Add(anEdge, aVertex.Oriented(TopAbs_FORWARD));
+    aBuilder.Add(anEdge, aVertex.Oriented(TopAbs_REVERSED));
+    aBuilder.UpdateEdge(anEdge, new Geom2d_Circle(gp_Ax2d(), aRadius), aFace, 1.0e-7);
+
+    TopoDS_Wire aWire;
+    aBuilder.MakeWire(aWire);
+    aBuilder.Add(aWire, anEdge);
+    aBuilder.Add(aFace, aWire);
+    aBuilder.UpdateFace(aFace, makeGrid(1 + aFaceIter % 20, aFaceIter % 3 == 0));
+    aBuilder.Add(aComp, aFace);
+  }
+  return aComp;
+}
+} // namespace
+
+TEST(BinTools_ShapeSet_Test, BlocksFormatIsEquivalent)
+{
+  const TopoDS_Shape aShape = makeShape(3000);
+  std::ostringstream aStream4, aStream5;
+  BinTools::Write(aShape, aStream4, true, true, BinTools_FormatVersion_VERSION_4);
+  BinTools::Write(aShape, aStream5, true, true, BinTools_FormatVersion_VERSION_5);
+  EXPECT_NE(aStream4.str(), aStream5.str());
+
+  // the shape read from blocks is written into the same data as the original shape
+  TopoDS_Shape       aShape5;
+  std::istringstream anIStream5(aStream5.str());
+  BinTools::Read(aShape5, anIStream5);
+  ASSERT_FALSE(aShape5.IsNull());
+  std::ostringstream aStream45;
+  BinTools::Write(aShape5, aStream45, true, true, BinTools_FormatVersion_VERSION_4);
+  EXPECT_TRUE(aStream4.str() == aStream45.str());
+
+  // blocks are written deterministically
+  std::ostringstream aStream55;
+  BinTools::Write(aShape5, aStream55, true, true, BinTools_FormatVersion_VERSION_5);
+  EXPECT_TRUE(aStream5.str() == aStream55.str());
+}
+
+TEST(BinTools_ShapeSet_Test, CompressedBlocksFormat)
+{
+  const TopoDS_Shape aShape = makeShape(3000);
+  std::ostringstream aStream4, aStream6;
+  BinTools::Write(aShape, aStream4, true, true, BinTools_FormatVersion_VERSION_4);
+#ifdef HAVE_ZSTD
+  BinTools::Write(aShape, aStream6, true, true, BinTools_FormatVersion_VERSION_6);
+  EXPECT_LT(aStream6.str().size(), aStream4.str().size() / 2);
+
+  TopoDS_Shape       aShape6;
+  std::istringstream anIStream6(aStream6.str());
+  BinTools::Read(aShape6, anIStream6);
+  ASSERT_FALSE(aShape6.IsNull());
+  std::ostringstream aStream46;
+  BinTools::Write(aShape6, aStream46, true, true, BinTools_FormatVersion_VERSION_4);
+  EXPECT_TRUE(aStream4.str() == aStream46.str());
+#else
+  EXPECT_THROW(BinTools::Write(aShape, aStream6, true, true, BinTools_FormatVersion_VERSION_6),
+               Standard_Failure);
+#endif
+}
+
+TEST(BinTools_ShapeSet_Test, LevelsOfDetail)
+{
+  // add a coarser level of detail after the active triangulation of each face
+  const TopoDS_Shape aShape = makeShape(10);
+  for (TopExp_Explorer aFaceIter(aShape, TopAbs_FACE); aFaceIter.More(); aFaceIter.Next())
+  {
+    occ::handle<BRep_TFace> aTFace = occ::down_cast<BRep_TFace>(aFaceIter.Current().TShape());
+    NCollection_List<occ::handle<Poly_Triangulation>> aLods;
+    aLods.Append(aTFace->Triangulation());
+    aLods.Append(makeGrid(1, false));
+    aTFace->Triangulations(aLods, aLods.First());
+  }
+
+  // older format keeps only the active triangulation
+  std::ostringstream aStream5;
+  BinTools::Write(aShape, aStream5, true, false, BinTools_FormatVersion_VERSION_5);
+  TopoDS_Shape       aShape5;
+  std::istringstream anIStream5(aStream5.str());
+  BinTools::Read(aShape5, anIStream5);
+  ASSERT_FALSE(aShape5.IsNull());
+  for (TopExp_Explorer aFaceIter(aShape5, TopAbs_FACE); aFaceIter.More(); aFaceIter.Next())
+  {
+    EXPECT_EQ(1, occ::down_cast<BRep_TFace>(aFaceIter.Current().TShape())->NbTriangulations());
+  }
+
+  std::ostringstream aStream7;
+#ifdef HAVE_ZSTD
+  BinTools::Write(aShape, aStream7, true, false, BinTools_FormatVersion_VERSION_7);
+  TopoDS_Shape       aShape7;
+  std::istringstream anIStream7(aStream7.str());
+  BinTools::Read(aShape7, anIStream7);
+  ASSERT_FALSE(aShape7.IsNull());
+  TopExp_Explorer aFaceIter7(aShape7, TopAbs_FACE);
+  for (TopExp_Explorer aFaceIter(aShape, TopAbs_FACE); aFaceIter.More();
+       aFaceIter.Next(), aFaceIter7.Next())
+  {
+    ASSERT_TRUE(aFaceIter7.More());
+    occ::handle<BRep_TFace> aTFace  = occ::down_cast<BRep_TFace>(aFaceIter.Current().TShape());
+    occ::handle<BRep_TFace> aTFace7 = occ::down_cast<BRep_TFace>(aFaceIter7.Current().TShape());
+    ASSERT_EQ(2, aTFace7->NbTriangulations());
+    EXPECT_EQ(aTFace7->Triangulations().First(), aTFace7->ActiveTriangulation());
+    EXPECT_EQ(aTFace->Triangulations().First()->NbTriangles(),
+              aTFace7->Triangulations().First()->NbTriangles());
+    EXPECT_EQ(2, aTFace7->Triangulations().Last()->NbTriangles());
+  }
+#else
+  EXPECT_THROW(BinTools::Write(aShape, aStream7, true, false, BinTools_FormatVersion_VERSION_7),
+               Standard_Failure);
+#endif
+}
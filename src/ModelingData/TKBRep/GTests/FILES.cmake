@@ -2,7 +2,10 @@
 set(OCCT_TKBRep_GTests_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
 
 set(OCCT_TKBRep_GTests_FILES
+  BinTools_ShapeSet_Test.cxx
+  BRep_FacetedMesh_Test.cxx
   BRepAdaptor_CompCurve_Test.cxx
+  TopExp_Test.cxx
   TopoDS_Edge_Test.cxx
   TopoDS_Iterator_Test.cxx
 )
@@ -0,0 +1,200 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRep_Builder.hxx>
+#include <gp_Trsf.hxx>
+#include <TopExp.hxx>
+#include <TopExp_AncestorsCache.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Compound.hxx>
+#include <TopoDS_Edge.hxx>
+#include <TopoDS_Vertex.hxx>
+#include <TopoDS_Wire.hxx>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+//! Makes a compound of two instances of a closed wire of three edges.
+TopoDS_Shape makeCompound()
+{
+  BRep_Builder  aBuilder;
+  TopoDS_Vertex aVertices[3];
+  for (int anIndex = 0; anIndex < 3; ++anIndex)
+  {
+    aBuilder.MakeVertex(aVertices[anIndex], gp_Pnt(anIndex, anIndex * anIndex, 0.0), 1.0e-7);
+  }
+
+  TopoDS_Wire aWire;
+  aBuilder.MakeWire(aWire);
+  for (int anIndex = 0; anIndex < 3; ++anIndex)
+  {
+    TopoDS_Edge anEdge;
+    aBuilder.MakeEdge(anEdge);
+    aBuilder.Add(anEdge, aVertices[anIndex].Oriented(TopAbs_FORWARD));
+    aBuilder.Add(anEdge, aVertices[(anIndex + 1) % 3].Oriented(TopAbs_REVERSED));
+    aBuilder.Add(aWire, anEdge);
+  }
+
+  gp_Trsf aTrsf;
+  aTrsf.SetTranslation(gp_Vec(0.0, 0.0, 10.0));
+  TopoDS_Compound aCompound;
+  aBuilder.MakeCompound(aCompound);
+  aBuilder.Add(aCompound, aWire);
+  aBuilder.Add(aCompound, aWire.Reversed());
+  aBuilder.Add(aCompound, aWire.Moved(TopLoc_Location(aTrsf)));
+  return aCompound;
+}
+
+//! Makes a compound of wires of a polyline, each wire sharing the end vertex with the next one;
+//! the last wire is also added translated and reversed.
+TopoDS_Shape makePolylineCompound(const int theNbWires, const int theNbEdgesPerWire)
+{
+  BRep_Builder    aBuilder;
+  TopoDS_Compound aCompound;
+  aBuilder.MakeCompound(aCompound);
+  TopoDS_Vertex aFirstVertex;
+  aBuilder.MakeVertex(aFirstVertex, gp_Pnt(0.0, 0.0, 0.0), 1.0e-7);
+  TopoDS_Wire aWire;
+  for (int aWireIter = 0; aWireIter < theNbWires; ++aWireIter)
+  {
+    aBuilder.MakeWire(aWire);
+    for (int anEdgeIter = 1; anEdgeIter <= theNbEdgesPerWire; ++anEdgeIter)
+    {
+      TopoDS_Vertex aLastVertex;
+      aBuilder.MakeVertex(aLastVertex,
+                          gp_Pnt(aWireIter * theNbEdgesPerWire + anEdgeIter, 0.0, 0.0),
+                          1.0e-7);
+      TopoDS_Edge anEdge;
+      aBuilder.MakeEdge(anEdge);
+      aBuilder.Add(anEdge, aFirstVertex.Oriented(TopAbs_FORWARD));
+      aBuilder.Add(anEdge, aLastVertex.Oriented(TopAbs_REVERSED));
+      aBuilder.Add(aWire, anEdge);
+      aFirstVertex = aLastVertex;
+    }
+    aBuilder.Add(aCompound, aWire);
+  }
+
+  gp_Trsf aTrsf;
+  aTrsf.SetTranslation(gp_Vec(0.0, 1.0, 0.0));
+  aBuilder.Add(aCompound, aWire.Moved(TopLoc_Location(aTrsf)));
+  aBuilder.Add(aCompound, aWire.Reversed());
+  return aCompound;
+}
+} // namespace
+
+TEST(TopExp_Test, MapShapesToFlatMap)
+{
+  const TopoDS_Shape aCompound = makeCompound();
+
+  NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> anIndexedMap;
+  NCollection_FlatMap<TopoDS_Shape, TopTools_ShapeMapHasher>    aFlatMap;
+  TopExp::MapShapes(aCompound, TopAbs_VERTEX, anIndexedMap);
+  TopExp::MapShapes(aCompound, TopAbs_VERTEX, aFlatMap);
+  EXPECT_EQ(6, aFlatMap.Extent());
+  EXPECT_EQ(anIndexedMap.Extent(), aFlatMap.Extent());
+
+  // all sub-shapes: compound, 2 wires, 6 edges and 6 vertices
+  anIndexedMap.Clear();
+  aFlatMap.Clear();
+  TopExp::MapShapes(aCompound, anIndexedMap);
+  TopExp::MapShapes(aCompound, aFlatMap);
+  EXPECT_EQ(15, aFlatMap.Extent());
+  EXPECT_EQ(anIndexedMap.Extent(), aFlatMap.Extent());
+  for (int anIndex = 1; anIndex <= anIndexedMap.Extent(); ++anIndex)
+  {
+    EXPECT_TRUE(aFlatMap.Contains(anIndexedMap(anIndex)));
+  }
+}
+
+TEST(TopExp_Test, MapShapesParallel)
+{
+  const TopoDS_Shape aCompound = makePolylineCompound(100, 10);
+
+  NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> aSeqMap, aParMap;
+  TopExp::MapShapes(aCompound, TopAbs_VERTEX, aSeqMap);
+  TopExp::MapShapes(aCompound, TopAbs_VERTEX, aParMap, true);
+  EXPECT_EQ(1001 + 11, aSeqMap.Extent());
+  ASSERT_EQ(aSeqMap.Extent(), aParMap.Extent());
+  for (int anIndex = 1; anIndex <= aSeqMap.Extent(); ++anIndex)
+  {
+    EXPECT_TRUE(aSeqMap(anIndex).IsEqual(aParMap(anIndex)));
+  }
+
+  // the map is not cleared at first
+  aSeqMap.Clear();
+  aParMap.Clear();
+  TopExp::MapShapes(aCompound, TopAbs_WIRE, aSeqMap);
+  TopExp::MapShapes(aCompound, TopAbs_WIRE, aParMap);
+  TopExp::MapShapes(aCompound, TopAbs_EDGE, aSeqMap);
+  TopExp::MapShapes(aCompound, TopAbs_EDGE, aParMap, true);
+  EXPECT_EQ(101 + 1010, aSeqMap.Extent());
+  ASSERT_EQ(aSeqMap.Extent(), aParMap.Extent());
+  for (int anIndex = 1; anIndex <= aSeqMap.Extent(); ++anIndex)
+  {
+    EXPECT_TRUE(aSeqMap(anIndex).IsEqual(aParMap(anIndex)));
+  }
+}
+
+TEST(TopExp_Test, MapShapesAndAncestorsParallel)
+{
+  const TopoDS_Shape aCompound = makePolylineCompound(100, 10);
+  for (int aTypeIter = 0; aTypeIter < 2; ++aTypeIter)
+  {
+    const TopAbs_ShapeEnum anAncType = aTypeIter == 0 ? TopAbs_EDGE : TopAbs_WIRE;
+    NCollection_IndexedDataMap<TopoDS_Shape,
+                               NCollection_List<TopoDS_Shape>,
+                               TopTools_ShapeMapHasher>
+      aSeqMap, aParMap;
+    TopExp::MapShapesAndAncestors(aCompound, TopAbs_VERTEX, anAncType, aSeqMap);
+    TopExp::MapShapesAndAncestors(aCompound, TopAbs_VERTEX, anAncType, aParMap, true);
+    ASSERT_EQ(aSeqMap.Extent(), aParMap.Extent());
+    for (int anIndex = 1; anIndex <= aSeqMap.Extent(); ++anIndex)
+    {
+      EXPECT_TRUE(aSeqMap.FindKey(anIndex).IsEqual(aParMap.FindKey(anIndex)));
+      const NCollection_List<TopoDS_Shape>& aSeqList = aSeqMap(anIndex);
+      const NCollection_List<TopoDS_Shape>& aParList = aParMap(anIndex);
+      ASSERT_EQ(aSeqList.Extent(), aParList.Extent());
+      NCollection_List<TopoDS_Shape>::Iterator aParIter(aParList);
+      for (NCollection_List<TopoDS_Shape>::Iterator aSeqIter(aSeqList); aSeqIter.More();
+           aSeqIter.Next(), aParIter.Next())
+      {
+        EXPECT_TRUE(aSeqIter.Value().IsEqual(aParIter.Value()));
+      }
+    }
+  }
+}
+
+TEST(TopExp_Test, AncestorsCache)
+{
+  const TopoDS_Shape    aCompound = makePolylineCompound(10, 3);
+  TopExp_AncestorsCache aCache(aCompound, true);
+  EXPECT_FALSE(aCache.IsComputed(TopAbs_VERTEX, TopAbs_EDGE));
+
+  const TopExp_AncestorsCache::AncestorsMap& aMap = aCache.Ancestors(TopAbs_VERTEX, TopAbs_EDGE);
+  EXPECT_TRUE(aCache.IsComputed(TopAbs_VERTEX, TopAbs_EDGE));
+  EXPECT_FALSE(aCache.IsComputed(TopAbs_EDGE, TopAbs_EDGE));
+  EXPECT_EQ(&aMap, &aCache.Ancestors(TopAbs_VERTEX, TopAbs_EDGE));
+  EXPECT_EQ(31 + 4, aMap.Extent());
+
+  // the vertex shared by two wires has two edges
+  const TopoDS_Shape& aVertex = aMap.FindKey(4);
+  EXPECT_EQ(2, aCache.FindAncestors(aVertex, TopAbs_EDGE).Extent());
+  EXPECT_EQ(2, aCache.FindAncestors(aVertex, TopAbs_WIRE).Extent());
+  EXPECT_TRUE(aCache.IsComputed(TopAbs_VERTEX, TopAbs_WIRE));
+  EXPECT_TRUE(aCache.FindAncestors(TopoDS_Shape(), TopAbs_EDGE).IsEmpty());
+
+  aCache.SetShape(TopoDS_Shape());
+  EXPECT_FALSE(aCache.IsComputed(TopAbs_VERTEX, TopAbs_EDGE));
+  EXPECT_TRUE(aCache.Ancestors(TopAbs_VERTEX, TopAbs_EDGE).IsEmpty());
+}
@@ -4,6 +4,8 @@ set(OCCT_TopExp_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
 set(OCCT_TopExp_FILES
   TopExp.cxx
   TopExp.hxx
+  TopExp_AncestorsCache.cxx
+  TopExp_AncestorsCache.hxx
   TopExp_Explorer.cxx
   TopExp_Explorer.hxx
 )
@@ -28,14 +28,193 @@
 #include <TopoDS_Wire.hxx>
 #include <NCollection_List.hxx>
 #include <TopTools_ShapeMapHasher.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_DataMap.hxx>
 #include <NCollection_Map.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_Parallel.hxx>
+
+#include <algorithm>
+#include <mutex>
+
+namespace
+{
+//! Number of independently locked parts of ShapePositionSet.
+constexpr int THE_NB_SHARDS = 64;
+
+//! Concurrent set of shapes keeping for each shape the smallest position it was added with.
+//! Shapes are distributed among shards by hash code, each shard being locked separately.
+class ShapePositionSet
+{
+public:
+  //! Adds the shape found at the given position; thread-safe.
+  void Add(const TopoDS_Shape& theShape, const int thePosition)
+  {
+    Shard&                      aShard = myShards[shardIndex(theShape)];
+    std::lock_guard<std::mutex> aLock(aShard.Mutex);
+    if (int* aFirst = aShard.Map.ChangeSeek(theShape))
+    {
+      *aFirst = std::min(*aFirst, thePosition);
+    }
+    else
+    {
+      aShard.Map.Bind(theShape, thePosition);
+    }
+  }
+
+  //! Returns the smallest position of the added shape;
+  //! should not be called concurrently with Add().
+  int FirstPosition(const TopoDS_Shape& theShape) const
+  {
+    return myShards[shardIndex(theShape)].Map.Find(theShape);
+  }
+
+private:
+  static size_t shardIndex(const TopoDS_Shape& theShape)
+  {
+    return (TopTools_ShapeMapHasher{}(theShape) >> 8) % THE_NB_SHARDS;
+  }
+
+  struct Shard
+  {
+    std::mutex                                                       Mutex;
+    NCollection_DataMap<TopoDS_Shape, int, TopTools_ShapeMapHasher> Map;
+  };
+
+  Shard myShards[THE_NB_SHARDS];
+};
+
+//! Sub-shapes of the given type found in each of the units in exploration order.
+//! The positions of sub-shapes are numbered across all units;
+//! for each position the position of the first occurrence of the same sub-shape is kept.
+struct GatheredShapes
+{
+  NCollection_Array1<NCollection_Vector<TopoDS_Shape>> Shapes;   //!< sub-shapes of each unit
+  NCollection_Array1<int>                              Offsets;  //!< first position of each unit
+  NCollection_Array1<int>                              Firsts;   //!< first occurrence of position
+  int                                                  NbUnique; //!< number of distinct sub-shapes
+
+  //! Explores the units in parallel threads.
+  GatheredShapes(const NCollection_Vector<TopoDS_Shape>& theUnits, const TopAbs_ShapeEnum theType)
+      : Shapes(0, theUnits.Length() - 1),
+        Offsets(0, theUnits.Length()),
+        NbUnique(0)
+  {
+    const int aNbUnits = theUnits.Length();
+    OSD_Parallel::For(0, aNbUnits, [&](const int theUnit) {
+      for (TopExp_Explorer anExp(theUnits.Value(theUnit), theType); anExp.More(); anExp.Next())
+      {
+        Shapes.ChangeValue(theUnit).Append(anExp.Current());
+      }
+    });
+
+    Offsets.SetValue(0, 0);
+    for (int aUnit = 0; aUnit < aNbUnits; ++aUnit)
+    {
+      Offsets.SetValue(aUnit + 1, Offsets.Value(aUnit) + Shapes.Value(aUnit).Length());
+    }
+    if (Offsets.Last() == 0)
+    {
+      return;
+    }
+
+    ShapePositionSet aSet;
+    OSD_Parallel::For(0, aNbUnits, [&](const int theUnit) {
+      const NCollection_Vector<TopoDS_Shape>& aShapes = Shapes.Value(theUnit);
+      for (int anIndex = 0; anIndex < aShapes.Length(); ++anIndex)
+      {
+        aSet.Add(aShapes.Value(anIndex), Offsets.Value(theUnit) + anIndex);
+      }
+    });
+
+    Firsts.Resize(0, Offsets.Last() - 1, false);
+    OSD_Parallel::For(0, aNbUnits, [&](const int theUnit) {
+      const NCollection_Vector<TopoDS_Shape>& aShapes = Shapes.Value(theUnit);
+      for (int anIndex = 0; anIndex < aShapes.Length(); ++anIndex)
+      {
+        Firsts.SetValue(Offsets.Value(theUnit) + anIndex,
+                        aSet.FirstPosition(aShapes.Value(anIndex)));
+      }
+    });
+    for (int aPosition = 0; aPosition < Offsets.Last(); ++aPosition)
+    {
+      NbUnique += IsFirst(aPosition) ? 1 : 0;
+    }
+  }
+
+  //! Returns true if the sub-shape at the given position occurs there for the first time.
+  bool IsFirst(const int thePosition) const { return Firsts.Value(thePosition) == thePosition; }
+};
+
+//! Splits the shape into units, such that the exploration of each unit for sub-shapes
+//! of the given type gives in sequence the same result as the exploration of the whole shape.
+//! The shape is split level by level until there are enough units for parallel processing.
+void splitShape(const TopoDS_Shape&               theShape,
+                const TopAbs_ShapeEnum            theType,
+                NCollection_Vector<TopoDS_Shape>& theUnits)
+{
+  const int aMinNbUnits = 4 * OSD_Parallel::NbLogicalProcessors();
+  theUnits.Append(theShape);
+  for (bool isSplit = true; isSplit && theUnits.Length() < aMinNbUnits;)
+  {
+    isSplit = false;
+    NCollection_Vector<TopoDS_Shape> aNextUnits;
+    for (NCollection_Vector<TopoDS_Shape>::Iterator aUnitIter(theUnits); aUnitIter.More();
+         aUnitIter.Next())
+    {
+      const TopoDS_Shape& aUnit = aUnitIter.Value();
+      if (aUnit.ShapeType() >= theType)
+      {
+        aNextUnits.Append(aUnit);
+        continue;
+      }
+
+      // the explorer descends only into the sub-shapes of the given or more complex type
+      isSplit = true;
+      for (TopoDS_Iterator aSubIter(aUnit); aSubIter.More(); aSubIter.Next())
+      {
+        if (aSubIter.Value().ShapeType() <= theType)
+        {
+          aNextUnits.Append(aSubIter.Value());
+        }
+      }
+    }
+    theUnits = aNextUnits;
+  }
+}
+} // namespace
 
 //=================================================================================================
 
-void TopExp::MapShapes(const TopoDS_Shape&                                            S,
-                       const TopAbs_ShapeEnum                                         T,
-                       NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher>& M)
+void TopExp::MapShapes(
+  const TopoDS_Shape&                                            S,
+  const TopAbs_ShapeEnum                                         T,
+  NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher>& M,
+  const bool                                                     theIsParallel)
 {
+  if (theIsParallel)
+  {
+    NCollection_Vector<TopoDS_Shape> aUnits;
+    splitShape(S, T, aUnits);
+    if (aUnits.Length() > 1)
+    {
+      const GatheredShapes aGathered(aUnits, T);
+      M.ReSize(M.Extent() + aGathered.NbUnique);
+      for (int aUnit = 0; aUnit < aUnits.Length(); ++aUnit)
+      {
+        const NCollection_Vector<TopoDS_Shape>& aShapes = aGathered.Shapes.Value(aUnit);
+        for (int anIndex = 0; anIndex < aShapes.Length(); ++anIndex)
+        {
+          if (aGathered.IsFirst(aGathered.Offsets.Value(aUnit) + anIndex))
+          {
+            M.Add(aShapes.Value(anIndex));
+          }
+        }
+      }
+      return;
+    }
+  }
+
   TopExp_Explorer Ex(S, T);
   while (Ex.More())
   {
@@ -75,17 +254,80 @@ void TopExp::MapShapes(const TopoDS_Shape&                                     S
 
 //=================================================================================================
 
+void TopExp::MapShapes(const TopoDS_Shape&                                         S,
+                       const TopAbs_ShapeEnum                                      T,
+                       NCollection_FlatMap<TopoDS_Shape, TopTools_ShapeMapHasher>& M)
+{
+  for (TopExp_Explorer Ex(S, T); Ex.More(); Ex.Next())
+    M.Add(Ex.Current());
+}
+
+//=================================================================================================
+
+void TopExp::MapShapes(const TopoDS_Shape&                                         S,
+                       NCollection_FlatMap<TopoDS_Shape, TopTools_ShapeMapHasher>& M,
+                       const bool                                                  cumOri,
+                       const bool                                                  cumLoc)
+{
+  // sub-shapes shared by already mapped shapes are not explored again
+  if (!M.Add(S))
+    return;
+  TopoDS_Iterator It(S, cumOri, cumLoc);
+  for (; It.More(); It.Next())
+    MapShapes(It.Value(), M, cumOri, cumLoc);
+}
+
+//=================================================================================================
+
 void TopExp::MapShapesAndAncestors(
   const TopoDS_Shape&    S,
   const TopAbs_ShapeEnum TS,
   const TopAbs_ShapeEnum TA,
   NCollection_IndexedDataMap<TopoDS_Shape, NCollection_List<TopoDS_Shape>, TopTools_ShapeMapHasher>&
-    M)
+             M,
+  const bool theIsParallel)
 {
   NCollection_List<TopoDS_Shape> empty;
 
   // visit ancestors
   TopExp_Explorer exa(S, TA);
+  if (theIsParallel)
+  {
+    NCollection_Vector<TopoDS_Shape> anAncestors;
+    for (; exa.More(); exa.Next())
+    {
+      anAncestors.Append(exa.Current());
+    }
+
+    // positions of the first occurrences are mapped to the indices in the map
+    const GatheredShapes    aGathered(anAncestors, TS);
+    const bool              isEmptyMap = M.IsEmpty();
+    NCollection_Array1<int> anIndices(0, std::max(aGathered.Offsets.Last(), 1) - 1);
+    M.ReSize(M.Extent() + aGathered.NbUnique);
+    for (int anAnc = 0; anAnc < anAncestors.Length(); ++anAnc)
+    {
+      const TopoDS_Shape&                     anc     = anAncestors.Value(anAnc);
+      const NCollection_Vector<TopoDS_Shape>& aShapes = aGathered.Shapes.Value(anAnc);
+      for (int anIndex = 0; anIndex < aShapes.Length(); ++anIndex)
+      {
+        const int aPosition = aGathered.Offsets.Value(anAnc) + anIndex;
+        int       index     = 0;
+        if (aGathered.IsFirst(aPosition))
+        {
+          index = isEmptyMap ? 0 : M.FindIndex(aShapes.Value(anIndex));
+          if (index == 0)
+            index = M.Add(aShapes.Value(anIndex), empty);
+        }
+        else
+        {
+          index = anIndices.Value(aGathered.Firsts.Value(aPosition));
+        }
+        anIndices.SetValue(aPosition, index);
+        M(index).Append(anc);
+      }
+    }
+  }
+
   while (exa.More())
   {
     // visit shapes
@@ -27,6 +27,7 @@
 #include <NCollection_List.hxx>
 #include <NCollection_IndexedDataMap.hxx>
 #include <NCollection_Map.hxx>
+#include <NCollection_FlatMap.hxx>
 #include <TopoDS_Vertex.hxx>
 #include <Standard_Boolean.hxx>
 
@@ -52,12 +53,15 @@ public:
   //! Tool to explore a topological data structure.
   //! Stores in the map <M> all the sub-shapes of <S>
   //! of type <T>.
+  //! - If theIsParallel is true, the sub-shapes are gathered and deduplicated
+  //! in parallel threads; the map is filled in the same order as in sequential mode.
   //!
   //! Warning: The map is not cleared at first.
   Standard_EXPORT static void MapShapes(
     const TopoDS_Shape&                                            S,
     const TopAbs_ShapeEnum                                         T,
-    NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher>& M);
+    NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher>& M,
+    const bool                                                     theIsParallel = false);
 
   //! Stores in the map <M> all the sub-shapes of <S>.
   //! - If cumOri is true, the function composes all
@@ -82,10 +86,35 @@ public:
                                         const bool cumOri = true,
                                         const bool cumLoc = true);
 
+  //! Stores in the flat map <M> all the sub-shapes of <S> of type <T>.
+  //! Faster alternative to the indexed map when indices of sub-shapes are not needed.
+  //! Warning: The map is not cleared at first.
+  Standard_EXPORT static void MapShapes(
+    const TopoDS_Shape&                                         S,
+    const TopAbs_ShapeEnum                                      T,
+    NCollection_FlatMap<TopoDS_Shape, TopTools_ShapeMapHasher>& M);
+
+  //! Stores in the flat map <M> all the sub-shapes of <S>.
+  //! - If cumOri is true, the function composes all
+  //! sub-shapes with the orientation of S.
+  //! - If cumLoc is true, the function multiplies all
+  //! sub-shapes by the location of S, i.e. it applies to
+  //! each sub-shape the transformation that is associated with S.
+  //! Warning: The map is not cleared at first;
+  //! sub-shapes of the shapes which are already in the map are not explored.
+  Standard_EXPORT static void MapShapes(
+    const TopoDS_Shape&                                         S,
+    NCollection_FlatMap<TopoDS_Shape, TopTools_ShapeMapHasher>& M,
+    const bool                                                  cumOri = true,
+    const bool                                                  cumLoc = true);
+
   //! Stores in the map <M> all the subshape of <S> of
   //! type <TS> for each one append to the list all
   //! the ancestors of type <TA>. For example map all
   //! the edges and bind the list of faces.
+  //! - If theIsParallel is true, the sub-shapes of the ancestors are gathered
+  //! and deduplicated in parallel threads; the map and the lists of ancestors
+  //! are filled in the same order as in sequential mode.
   //! Warning: The map is not cleared at first.
   Standard_EXPORT static void MapShapesAndAncestors(
     const TopoDS_Shape&                                  S,
@@ -93,7 +122,8 @@ public:
     const TopAbs_ShapeEnum                               TA,
     NCollection_IndexedDataMap<TopoDS_Shape,
                                NCollection_List<TopoDS_Shape>,
-                               TopTools_ShapeMapHasher>& M);
+                               TopTools_ShapeMapHasher>& M,
+    const bool                                           theIsParallel = false);
 
   //! Stores in the map <M> all the subshape of <S> of
   //! type <TS> for each one append to the list all
@@ -0,0 +1,70 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <TopExp_AncestorsCache.hxx>
+
+#include <TopExp.hxx>
+
+//=================================================================================================
+
+TopExp_AncestorsCache::TopExp_AncestorsCache(const TopoDS_Shape& theShape,
+                                             const bool          theIsParallel)
+    : myShape(theShape),
+      myIsParallel(theIsParallel)
+{
+}
+
+//=================================================================================================
+
+void TopExp_AncestorsCache::SetShape(const TopoDS_Shape& theShape)
+{
+  myShape = theShape;
+  myMaps.Clear();
+}
+
+//=================================================================================================
+
+const TopExp_AncestorsCache::AncestorsMap& TopExp_AncestorsCache::Ancestors(
+  const TopAbs_ShapeEnum theSubType,
+  const TopAbs_ShapeEnum theAncType)
+{
+  const int aKey = mapKey(theSubType, theAncType);
+  if (const AncestorsMap* aMap = myMaps.Seek(aKey))
+  {
+    return *aMap;
+  }
+
+  AncestorsMap* aMap = myMaps.Bound(aKey, AncestorsMap());
+  if (!myShape.IsNull())
+  {
+    TopExp::MapShapesAndAncestors(myShape, theSubType, theAncType, *aMap, myIsParallel);
+  }
+  return *aMap;
+}
+
+//=================================================================================================
+
+const NCollection_List<TopoDS_Shape>& TopExp_AncestorsCache::FindAncestors(
+  const TopoDS_Shape&    theSubShape,
+  const TopAbs_ShapeEnum theAncType)
+{
+  static const NCollection_List<TopoDS_Shape> THE_EMPTY_LIST;
+  if (theSubShape.IsNull())
+  {
+    return THE_EMPTY_LIST;
+  }
+
+  const NCollection_List<TopoDS_Shape>* aList =
+    Ancestors(theSubShape.ShapeType(), theAncType).Seek(theSubShape);
+  return aList != nullptr ? *aList : THE_EMPTY_LIST;
+}
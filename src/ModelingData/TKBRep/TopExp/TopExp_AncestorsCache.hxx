@@ -0,0 +1,95 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _TopExp_AncestorsCache_HeaderFile
+#define _TopExp_AncestorsCache_HeaderFile
+
+#include <NCollection_DataMap.hxx>
+#include <NCollection_IndexedDataMap.hxx>
+#include <NCollection_List.hxx>
+#include <TopAbs_ShapeEnum.hxx>
+#include <TopTools_ShapeMapHasher.hxx>
+#include <TopoDS_Shape.hxx>
+
+//! Cache of the maps of sub-shapes and their ancestors of a shape,
+//! which can be shared by several algorithms querying the same shape.
+//! The map for each pair of sub-shape and ancestor types is computed
+//! by TopExp::MapShapesAndAncestors() on the first request only.
+//!
+//! The cache is not thread-safe: the maps should be requested
+//! before sharing the cache between threads.
+class TopExp_AncestorsCache
+{
+public:
+  DEFINE_STANDARD_ALLOC
+
+  //! Map of sub-shapes to the lists of their ancestors.
+  typedef NCollection_IndexedDataMap<TopoDS_Shape,
+                                     NCollection_List<TopoDS_Shape>,
+                                     TopTools_ShapeMapHasher>
+    AncestorsMap;
+
+public:
+  //! Creates the cache for the shape.
+  //! @param theShape      shape to explore
+  //! @param theIsParallel flag to compute the maps in parallel threads
+  Standard_EXPORT TopExp_AncestorsCache(const TopoDS_Shape& theShape      = TopoDS_Shape(),
+                                        const bool          theIsParallel = false);
+
+  //! Returns the explored shape.
+  const TopoDS_Shape& Shape() const { return myShape; }
+
+  //! Sets the shape to explore and discards the maps computed for the previous one.
+  Standard_EXPORT void SetShape(const TopoDS_Shape& theShape);
+
+  //! Returns the flag to compute the maps in parallel threads.
+  bool IsParallel() const { return myIsParallel; }
+
+  //! Sets the flag to compute the maps in parallel threads.
+  void SetParallel(const bool theIsParallel) { myIsParallel = theIsParallel; }
+
+  //! Discards all computed maps.
+  void Clear() { myMaps.Clear(); }
+
+  //! Returns true if the map for the given types is already computed.
+  bool IsComputed(const TopAbs_ShapeEnum theSubType, const TopAbs_ShapeEnum theAncType) const
+  {
+    return myMaps.IsBound(mapKey(theSubType, theAncType));
+  }
+
+  //! Returns the map of all sub-shapes of type theSubType of the shape
+  //! to the lists of their ancestors of type theAncType, computing it if necessary.
+  //! The returned reference remains valid until the cache is cleared.
+  Standard_EXPORT const AncestorsMap& Ancestors(const TopAbs_ShapeEnum theSubType,
+                                                const TopAbs_ShapeEnum theAncType);
+
+  //! Returns the list of ancestors of type theAncType of the given sub-shape
+  //! or an empty list if the sub-shape is not a part of the shape.
+  Standard_EXPORT const NCollection_List<TopoDS_Shape>& FindAncestors(
+    const TopoDS_Shape&    theSubShape,
+    const TopAbs_ShapeEnum theAncType);
+
+private:
+  //! Returns the key of the map for the given types.
+  static int mapKey(const TopAbs_ShapeEnum theSubType, const TopAbs_ShapeEnum theAncType)
+  {
+    return int(theSubType) * (int(TopAbs_SHAPE) + 1) + int(theAncType);
+  }
+
+private:
+  TopoDS_Shape                           myShape;
+  NCollection_DataMap<int, AncestorsMap> myMaps;
+  bool                                   myIsParallel;
+};
+
+#endif // _TopExp_AncestorsCache_HeaderFile
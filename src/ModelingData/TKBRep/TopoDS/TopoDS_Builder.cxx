@@ -76,6 +76,7 @@ void TopoDS_Builder::Add(TopoDS_Shape& aShape, const TopoDS_Shape& aComponent) c
     //
     if ((aTb[iC] & (1 << iS)) != 0)
     {
+      aShape.TShape()->ensureChildren();
       NCollection_List<TopoDS_Shape>& L = aShape.TShape()->myShapes;
       L.Append(aComponent);
       TopoDS_Shape& S = L.Last();
@@ -119,6 +120,7 @@ void TopoDS_Builder::Remove(TopoDS_Shape& aShape, const TopoDS_Shape& aComponent
     S.Reverse();
   S.Location(S.Location().Predivided(aShape.Location()), false);
 
+  aShape.TShape()->ensureChildren();
   NCollection_List<TopoDS_Shape>&          L = aShape.TShape()->myShapes;
   NCollection_List<TopoDS_Shape>::Iterator It(L);
   while (It.More())
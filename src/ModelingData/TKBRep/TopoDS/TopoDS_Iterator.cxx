@@ -34,7 +34,10 @@ void TopoDS_Iterator::Initialize(const TopoDS_Shape& S, const bool cumOri, const
   if (S.IsNull())
     myShapes = NCollection_List<TopoDS_Shape>::Iterator();
   else
+  {
+    S.TShape()->ensureChildren();
     myShapes.Initialize(S.TShape()->myShapes);
+  }
 
   if (More())
   {
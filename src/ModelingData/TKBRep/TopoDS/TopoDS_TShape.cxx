@@ -23,6 +23,13 @@ IMPLEMENT_STANDARD_RTTIEXT(TopoDS_TShape, Standard_Transient)
 
 //=================================================================================================
 
+void TopoDS_TShape::materializeChildren()
+{
+  // sub-shapes of ordinary TShapes are added explicitly by TopoDS_Builder
+}
+
+//=================================================================================================
+
 void TopoDS_TShape::DumpJson(Standard_OStream& theOStream, int) const
 {
   OCCT_DUMP_TRANSIENT_CLASS_BEGIN(theOStream)
@@ -48,6 +48,10 @@
 //! - Infinite   : Is infinite.
 //! - Convex     : Is convex.
 //!
+//! A TShape may also create its components on demand (see setDeferred()),
+//! which allows compact representations of large shapes materializing
+//! only the explored parts.
+//!
 //! Users have no direct access to the classes derived
 //! from TShape. They handle them with the classes
 //! derived from Shape.
@@ -124,7 +128,14 @@ public:
 
   //! Returns the number of direct sub-shapes (children).
   //! @sa TopoDS_Iterator for accessing sub-shapes
-  int NbChildren() const { return myShapes.Size(); }
+  int NbChildren() const
+  {
+    ensureChildren();
+    return myShapes.Size();
+  }
+
+  //! Returns true if the sub-shapes of this TShape are created on demand.
+  bool IsDeferred() const { return ((myFlags & TopoDS_TShape_Flags_Deferred) != 0); }
 
   //! Dumps the content of me into the stream
   Standard_EXPORT virtual void DumpJson(Standard_OStream& theOStream, int theDepth = -1) const;
@@ -149,6 +160,34 @@ protected:
   {
   }
 
+  //! Marks the TShape as creating its sub-shapes on demand by materializeChildren().
+  //! Such TShape is frozen, as its sub-shapes are not expected to be edited.
+  void setDeferred()
+  {
+    setFlag(TopoDS_TShape_Flags_Deferred, true);
+    setFlag(TopoDS_TShape_Flags_Free, false);
+  }
+
+  //! Creates the sub-shapes of the deferred TShape with appendChild().
+  //! Called before each access to the sub-shapes, so that it should return
+  //! immediately once the sub-shapes are created; should be thread-safe,
+  //! as the shape may be explored by several threads concurrently.
+  Standard_EXPORT virtual void materializeChildren();
+
+  //! Appends the sub-shape; to be used within materializeChildren().
+  void appendChild(const TopoDS_Shape& theShape) { myShapes.Append(theShape); }
+
+private:
+  //! Creates the sub-shapes of the deferred TShape.
+  void ensureChildren() const
+  {
+    if ((myFlags & TopoDS_TShape_Flags_Deferred) != 0)
+    {
+      // the list of sub-shapes is logically a part of the constant TShape
+      const_cast<TopoDS_TShape*>(this)->materializeChildren();
+    }
+  }
+
 private:
   // Defined mask values
   enum TopoDS_TShape_Flags
@@ -160,7 +199,8 @@ private:
     TopoDS_TShape_Flags_Closed     = 0x010,
     TopoDS_TShape_Flags_Infinite   = 0x020,
     TopoDS_TShape_Flags_Convex     = 0x040,
-    TopoDS_TShape_Flags_Locked     = 0x080
+    TopoDS_TShape_Flags_Locked     = 0x080,
+    TopoDS_TShape_Flags_Deferred   = 0x100
   };
 
   //! Set bit flag.
@@ -26,6 +26,7 @@
 #include <gp_Parab.hxx>
 #include <gp_Pnt.hxx>
 #include <gp_Vec.hxx>
+#include <Standard_DimensionMismatch.hxx>
 #include <Standard_NotImplemented.hxx>
 
 IMPLEMENT_STANDARD_RTTIEXT(Adaptor3d_Curve, Standard_Transient)
@@ -132,6 +133,40 @@ void Adaptor3d_Curve::D1(const double, gp_Pnt&, gp_Vec&) const
 
 //=================================================================================================
 
+void Adaptor3d_Curve::EvaluateD0(const NCollection_Array1<double>& theParams,
+                                 NCollection_Array1<gp_Pnt>&       thePoints) const
+{
+  if (theParams.Length() != thePoints.Length())
+  {
+    throw Standard_DimensionMismatch("Adaptor3d_Curve::EvaluateD0");
+  }
+  const int aShift = thePoints.Lower() - theParams.Lower();
+  for (int anIndex = theParams.Lower(); anIndex <= theParams.Upper(); ++anIndex)
+  {
+    D0(theParams(anIndex), thePoints(anIndex + aShift));
+  }
+}
+
+//=================================================================================================
+
+void Adaptor3d_Curve::EvaluateD1(const NCollection_Array1<double>& theParams,
+                                 NCollection_Array1<gp_Pnt>&       thePoints,
+                                 NCollection_Array1<gp_Vec>&       theD1) const
+{
+  if (theParams.Length() != thePoints.Length() || theParams.Length() != theD1.Length())
+  {
+    throw Standard_DimensionMismatch("Adaptor3d_Curve::EvaluateD1");
+  }
+  const int aShiftP = thePoints.Lower() - theParams.Lower();
+  const int aShiftV = theD1.Lower() - theParams.Lower();
+  for (int anIndex = theParams.Lower(); anIndex <= theParams.Upper(); ++anIndex)
+  {
+    D1(theParams(anIndex), thePoints(anIndex + aShiftP), theD1(anIndex + aShiftV));
+  }
+}
+
+//=================================================================================================
+
 // void Adaptor3d_Curve::D2(const double U, gp_Pnt& P, gp_Vec& V1, gp_Vec& V2) const
 void Adaptor3d_Curve::D2(const double, gp_Pnt&, gp_Vec&, gp_Vec&) const
 {
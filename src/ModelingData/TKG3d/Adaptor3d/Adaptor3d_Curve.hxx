@@ -98,6 +98,25 @@ public:
   //! is not C1.
   Standard_EXPORT virtual void D1(const double U, gp_Pnt& P, gp_Vec& V) const;
 
+  //! Computes the points of the given parameters on the curve.
+  //! The default implementation calls D0() for each parameter,
+  //! descendants may override it to evaluate the whole batch in a tight loop.
+  //! @param[in]  theParams array of parameters
+  //! @param[out] thePoints array of points of the same length as theParams
+  //! Raises Standard_DimensionMismatch if the lengths of the arrays differ.
+  Standard_EXPORT virtual void EvaluateD0(const NCollection_Array1<double>& theParams,
+                                          NCollection_Array1<gp_Pnt>&       thePoints) const;
+
+  //! Computes the points and the first derivatives of the given parameters on the curve.
+  //! The default implementation calls D1() for each parameter.
+  //! @param[in]  theParams array of parameters
+  //! @param[out] thePoints array of points of the same length as theParams
+  //! @param[out] theD1     array of first derivatives of the same length as theParams
+  //! Raises Standard_DimensionMismatch if the lengths of the arrays differ.
+  Standard_EXPORT virtual void EvaluateD1(const NCollection_Array1<double>& theParams,
+                                          NCollection_Array1<gp_Pnt>&       thePoints,
+                                          NCollection_Array1<gp_Vec>&       theD1) const;
+
   //! Returns the point P of parameter U, the first and second
   //! derivatives V1 and V2.
   //! Raised if the continuity of the current interval
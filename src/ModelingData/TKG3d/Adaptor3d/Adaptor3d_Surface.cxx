@@ -28,6 +28,7 @@
 #include <gp_Sphere.hxx>
 #include <gp_Torus.hxx>
 #include <gp_Vec.hxx>
+#include <Standard_DimensionMismatch.hxx>
 #include <Standard_NotImplemented.hxx>
 
 IMPLEMENT_STANDARD_RTTIEXT(Adaptor3d_Surface, Standard_Transient)
@@ -208,6 +209,49 @@ void Adaptor3d_Surface::D1(const double, const double, gp_Pnt&, gp_Vec&, gp_Vec&
 
 //=================================================================================================
 
+void Adaptor3d_Surface::EvaluateD0(const NCollection_Array1<gp_Pnt2d>& theUVs,
+                                   NCollection_Array1<gp_Pnt>&         thePoints) const
+{
+  if (theUVs.Length() != thePoints.Length())
+  {
+    throw Standard_DimensionMismatch("Adaptor3d_Surface::EvaluateD0");
+  }
+  const int aShift = thePoints.Lower() - theUVs.Lower();
+  for (int anIndex = theUVs.Lower(); anIndex <= theUVs.Upper(); ++anIndex)
+  {
+    const gp_Pnt2d& aUV = theUVs(anIndex);
+    D0(aUV.X(), aUV.Y(), thePoints(anIndex + aShift));
+  }
+}
+
+//=================================================================================================
+
+void Adaptor3d_Surface::EvaluateD1(const NCollection_Array1<gp_Pnt2d>& theUVs,
+                                   NCollection_Array1<gp_Pnt>&         thePoints,
+                                   NCollection_Array1<gp_Vec>&         theD1U,
+                                   NCollection_Array1<gp_Vec>&         theD1V) const
+{
+  if (theUVs.Length() != thePoints.Length() || theUVs.Length() != theD1U.Length()
+      || theUVs.Length() != theD1V.Length())
+  {
+    throw Standard_DimensionMismatch("Adaptor3d_Surface::EvaluateD1");
+  }
+  const int aShiftP = thePoints.Lower() - theUVs.Lower();
+  const int aShiftU = theD1U.Lower() - theUVs.Lower();
+  const int aShiftV = theD1V.Lower() - theUVs.Lower();
+  for (int anIndex = theUVs.Lower(); anIndex <= theUVs.Upper(); ++anIndex)
+  {
+    const gp_Pnt2d& aUV = theUVs(anIndex);
+    D1(aUV.X(),
+       aUV.Y(),
+       thePoints(anIndex + aShiftP),
+       theD1U(anIndex + aShiftU),
+       theD1V(anIndex + aShiftV));
+  }
+}
+
+//=================================================================================================
+
 // void Adaptor3d_Surface::D2(const double U, const double V, gp_Pnt& P, gp_Vec& D1U,
 // gp_Vec& D1V, gp_Vec& D2U, gp_Vec& D2V, gp_Vec& D2UV) const
 void Adaptor3d_Surface::D2(const double,
@@ -21,6 +21,7 @@
 #include <GeomAbs_Shape.hxx>
 #include <GeomAbs_SurfaceType.hxx>
 #include <gp_Ax1.hxx>
+#include <gp_Pnt2d.hxx>
 #include <gp_Cylinder.hxx>
 #include <gp_Cone.hxx>
 #include <gp_Pln.hxx>
@@ -136,6 +137,27 @@ public:
                                   gp_Vec&      D1U,
                                   gp_Vec&      D1V) const;
 
+  //! Computes the points of the given (U, V) parameters on the surface.
+  //! The default implementation calls D0() for each pair of parameters,
+  //! descendants may override it to evaluate the whole batch in a tight loop.
+  //! @param[in]  theUVs    array of parameters
+  //! @param[out] thePoints array of points of the same length as theUVs
+  //! Raises Standard_DimensionMismatch if the lengths of the arrays differ.
+  Standard_EXPORT virtual void EvaluateD0(const NCollection_Array1<gp_Pnt2d>& theUVs,
+                                          NCollection_Array1<gp_Pnt>&         thePoints) const;
+
+  //! Computes the points and the first derivatives of the given (U, V) parameters
+  //! on the surface. The default implementation calls D1() for each pair of parameters.
+  //! @param[in]  theUVs    array of parameters
+  //! @param[out] thePoints array of points of the same length as theUVs
+  //! @param[out] theD1U    array of derivatives in U of the same length as theUVs
+  //! @param[out] theD1V    array of derivatives in V of the same length as theUVs
+  //! Raises Standard_DimensionMismatch if the lengths of the arrays differ.
+  Standard_EXPORT virtual void EvaluateD1(const NCollection_Array1<gp_Pnt2d>& theUVs,
+                                          NCollection_Array1<gp_Pnt>&         thePoints,
+                                          NCollection_Array1<gp_Vec>&         theD1U,
+                                          NCollection_Array1<gp_Vec>&         theD1V) const;
+
   //! Computes the point, the first and second
   //! derivatives on the surface.
   //! Raised if the continuity of the current
@@ -0,0 +1,6 @@
+# Benchmark source files for TKG3d
+set(OCCT_TKG3d_Benchmarks_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
+
+set(OCCT_TKG3d_Benchmarks_FILES
+  GeomGridEval_Benchmark.cxx
+)
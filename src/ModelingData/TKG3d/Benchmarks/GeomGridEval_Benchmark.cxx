@@ -0,0 +1,202 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <GeomAdaptor_Surface.hxx>
+#include <GeomGridEval_Surface.hxx>
+#include <Geom_BSplineSurface.hxx>
+#include <Geom_SphericalSurface.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_Array2.hxx>
+#include <gp_Ax3.hxx>
+#include <gp_Pnt2d.hxx>
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+
+namespace
+{
+//! Makes the bicubic B-spline surface with theNbSpans x theNbSpans uniform spans.
+occ::handle<Geom_Surface> makeBSplineSurface(const int theNbSpans)
+{
+  const int                  aNbPoles = theNbSpans + 3;
+  NCollection_Array2<gp_Pnt> aPoles(1, aNbPoles, 1, aNbPoles);
+  for (int aRow = 1; aRow <= aNbPoles; ++aRow)
+  {
+    for (int aCol = 1; aCol <= aNbPoles; ++aCol)
+    {
+      aPoles(aRow, aCol) = gp_Pnt(aRow, aCol, std::sin(aRow) * std::cos(aCol));
+    }
+  }
+  NCollection_Array1<double> aKnots(1, theNbSpans + 1);
+  NCollection_Array1<int>    aMults(1, theNbSpans + 1);
+  for (int anIndex = 1; anIndex <= theNbSpans + 1; ++anIndex)
+  {
+    aKnots(anIndex) = anIndex - 1.0;
+    aMults(anIndex) = 1;
+  }
+  aMults.ChangeFirst() = 4;
+  aMults.ChangeLast()  = 4;
+  return new Geom_BSplineSurface(aPoles, aKnots, aKnots, aMults, aMults, 3, 3);
+}
+
+//! Makes the rational B-spline surface of degree 5x3 with theNbSpans x theNbSpans uniform spans.
+occ::handle<Geom_Surface> makeRationalBSplineSurface(const int theNbSpans)
+{
+  const int                  aNbUPoles = theNbSpans + 5;
+  const int                  aNbVPoles = theNbSpans + 3;
+  NCollection_Array2<gp_Pnt> aPoles(1, aNbUPoles, 1, aNbVPoles);
+  NCollection_Array2<double> aWeights(1, aNbUPoles, 1, aNbVPoles);
+  for (int aRow = 1; aRow <= aNbUPoles; ++aRow)
+  {
+    for (int aCol = 1; aCol <= aNbVPoles; ++aCol)
+    {
+      aPoles(aRow, aCol)   = gp_Pnt(aRow, aCol, std::sin(aRow) * std::cos(aCol));
+      aWeights(aRow, aCol) = 1.0 + 0.25 * ((aRow * aCol) % 3);
+    }
+  }
+  NCollection_Array1<double> aKnots(1, theNbSpans + 1);
+  NCollection_Array1<int>    aUMults(1, theNbSpans + 1);
+  NCollection_Array1<int>    aVMults(1, theNbSpans + 1);
+  for (int anIndex = 1; anIndex <= theNbSpans + 1; ++anIndex)
+  {
+    aKnots(anIndex)  = anIndex - 1.0;
+    aUMults(anIndex) = 1;
+    aVMults(anIndex) = 1;
+  }
+  aUMults.ChangeFirst() = 6;
+  aUMults.ChangeLast()  = 6;
+  aVMults.ChangeFirst() = 4;
+  aVMults.ChangeLast()  = 4;
+  return new Geom_BSplineSurface(aPoles, aWeights, aKnots, aKnots, aUMults, aVMults, 5, 3);
+}
+
+//! Returns the surface used by the benchmark of the given kind.
+occ::handle<Geom_Surface> makeSurface(const int theKind)
+{
+  if (theKind == 0)
+  {
+    return makeBSplineSurface(8);
+  }
+  else if (theKind == 2)
+  {
+    return makeRationalBSplineSurface(4);
+  }
+  return new Geom_SphericalSurface(gp_Ax3(), 10.0);
+}
+
+//! Fills the uniform parameters of the surface domain in the given direction.
+NCollection_Array1<double> makeParams(const GeomAdaptor_Surface& theSurf,
+                                      const bool                 theIsU,
+                                      const int                  theNbSamples)
+{
+  const double aFirst = theIsU ? theSurf.FirstUParameter() : theSurf.FirstVParameter();
+  const double aLast  = theIsU ? theSurf.LastUParameter() : theSurf.LastVParameter();
+  NCollection_Array1<double> aParams(1, theNbSamples);
+  for (int anIndex = 1; anIndex <= theNbSamples; ++anIndex)
+  {
+    aParams(anIndex) = aFirst + (aLast - aFirst) * (anIndex - 1) / (theNbSamples - 1);
+  }
+  return aParams;
+}
+} // namespace
+
+// Arguments: surface kind (0 - B-spline, 1 - sphere, 2 - rational B-spline of degree 5x3),
+// number of samples in each direction.
+
+static void GeomAdaptor_Surface_D0_Grid(benchmark::State& theState)
+{
+  const GeomAdaptor_Surface        aSurf(makeSurface(int(theState.range(0))));
+  const int                        aNbSamples = int(theState.range(1));
+  const NCollection_Array1<double> aUParams   = makeParams(aSurf, true, aNbSamples);
+  const NCollection_Array1<double> aVParams   = makeParams(aSurf, false, aNbSamples);
+  for (auto _ : theState)
+  {
+    gp_Pnt aPnt;
+    double aSum = 0.0;
+    for (const double aU : aUParams)
+    {
+      for (const double aV : aVParams)
+      {
+        aSurf.D0(aU, aV, aPnt);
+        aSum += aPnt.Z();
+      }
+    }
+    benchmark::DoNotOptimize(aSum);
+  }
+  theState.SetItemsProcessed(theState.iterations() * aNbSamples * aNbSamples);
+}
+BENCHMARK(GeomAdaptor_Surface_D0_Grid)->ArgsProduct({{0, 1, 2}, {32, 256}});
+
+static void GeomAdaptor_Surface_EvaluateD0_Grid(benchmark::State& theState)
+{
+  const GeomAdaptor_Surface        aSurf(makeSurface(int(theState.range(0))));
+  const int                        aNbSamples = int(theState.range(1));
+  const NCollection_Array1<double> aUParams   = makeParams(aSurf, true, aNbSamples);
+  const NCollection_Array1<double> aVParams   = makeParams(aSurf, false, aNbSamples);
+  NCollection_Array1<gp_Pnt2d>     aUVs(1, aNbSamples * aNbSamples);
+  int                              aPntIndex = 0;
+  for (const double aU : aUParams)
+  {
+    for (const double aV : aVParams)
+    {
+      aUVs(++aPntIndex) = gp_Pnt2d(aU, aV);
+    }
+  }
+  NCollection_Array1<gp_Pnt> aPoints(1, aUVs.Length());
+  for (auto _ : theState)
+  {
+    aSurf.EvaluateD0(aUVs, aPoints);
+    benchmark::DoNotOptimize(aPoints.First());
+  }
+  theState.SetItemsProcessed(theState.iterations() * aNbSamples * aNbSamples);
+}
+BENCHMARK(GeomAdaptor_Surface_EvaluateD0_Grid)->ArgsProduct({{0, 1, 2}, {32, 256}});
+
+static void GeomGridEval_Surface_EvaluateGrid(benchmark::State& theState)
+{
+  const occ::handle<Geom_Surface>  aGeomSurf = makeSurface(int(theState.range(0)));
+  const GeomAdaptor_Surface        aSurf(aGeomSurf);
+  const int                        aNbSamples = int(theState.range(1));
+  const NCollection_Array1<double> aUParams   = makeParams(aSurf, true, aNbSamples);
+  const NCollection_Array1<double> aVParams   = makeParams(aSurf, false, aNbSamples);
+  GeomGridEval_Surface             anEval;
+  anEval.Initialize(aGeomSurf);
+  for (auto _ : theState)
+  {
+    const NCollection_Array2<gp_Pnt> aGrid = anEval.EvaluateGrid(aUParams, aVParams);
+    benchmark::DoNotOptimize(aGrid.Value(1, 1));
+  }
+  theState.SetItemsProcessed(theState.iterations() * aNbSamples * aNbSamples);
+}
+BENCHMARK(GeomGridEval_Surface_EvaluateGrid)->ArgsProduct({{0, 1, 2}, {32, 256}});
+
+static void GeomGridEval_Surface_EvaluateGridD1(benchmark::State& theState)
+{
+  const occ::handle<Geom_Surface>  aGeomSurf = makeSurface(int(theState.range(0)));
+  const GeomAdaptor_Surface        aSurf(aGeomSurf);
+  const int                        aNbSamples = int(theState.range(1));
+  const NCollection_Array1<double> aUParams   = makeParams(aSurf, true, aNbSamples);
+  const NCollection_Array1<double> aVParams   = makeParams(aSurf, false, aNbSamples);
+  GeomGridEval_Surface             anEval;
+  anEval.Initialize(aGeomSurf);
+  for (auto _ : theState)
+  {
+    const NCollection_Array2<GeomGridEval::SurfD1> aGrid =
+      anEval.EvaluateGridD1(aUParams, aVParams);
+    benchmark::DoNotOptimize(aGrid.Value(1, 1));
+  }
+  theState.SetItemsProcessed(theState.iterations() * aNbSamples * aNbSamples);
+}
+BENCHMARK(GeomGridEval_Surface_EvaluateGridD1)->ArgsProduct({{0, 1, 2}, {32, 256}});
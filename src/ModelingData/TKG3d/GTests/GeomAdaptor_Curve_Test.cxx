@@ -14,6 +14,7 @@
 #include <gtest/gtest.h>
 
 #include <GeomAdaptor_Curve.hxx>
+#include <Geom_BSplineCurve.hxx>
 #include <Geom_Circle.hxx>
 #include <Geom_Line.hxx>
 #include <Geom_TrimmedCurve.hxx>
@@ -22,6 +23,7 @@
 #include <gp_Pnt.hxx>
 #include <Precision.hxx>
 #include <Standard_ConstructionError.hxx>
+#include <Standard_DimensionMismatch.hxx>
 
 //==================================================================================================
 // Test fixture for GeomAdaptor_Curve degenerated curve handling
@@ -286,3 +288,73 @@ TEST_F(GeomAdaptor_Curve_Test, Constructor_WithValidRange_Success)
   EXPECT_DOUBLE_EQ(anAdaptor.LastParameter(), aLast);
   EXPECT_EQ(anAdaptor.GetType(), GeomAbs_Circle);
 }
+
+//==================================================================================================
+
+TEST_F(GeomAdaptor_Curve_Test, EvaluateD1_BSplineWithC0Knot_MatchesPointwise)
+{
+  // Quadratic B-spline with C0 knot at 2.0, trimmed at this knot
+  NCollection_Array1<gp_Pnt> aPoles(1, 6);
+  aPoles(1) = gp_Pnt(0.0, 0.0, 0.0);
+  aPoles(2) = gp_Pnt(1.0, 2.0, 0.0);
+  aPoles(3) = gp_Pnt(2.0, 0.0, 1.0);
+  aPoles(4) = gp_Pnt(3.0, 1.0, 0.0);
+  aPoles(5) = gp_Pnt(4.0, 3.0, 2.0);
+  aPoles(6) = gp_Pnt(5.0, 0.0, 0.0);
+  NCollection_Array1<double> aKnots(1, 4);
+  NCollection_Array1<int>    aMults(1, 4);
+  for (int anIndex = 1; anIndex <= 4; ++anIndex)
+  {
+    aKnots(anIndex) = anIndex - 1.0;
+  }
+  aMults(1) = 3;
+  aMults(2) = 1;
+  aMults(3) = 2;
+  aMults(4) = 3;
+  occ::handle<Geom_BSplineCurve> aBSpline = new Geom_BSplineCurve(aPoles, aKnots, aMults, 2);
+  GeomAdaptor_Curve              anAdaptor(aBSpline, 0.5, 2.0);
+
+  NCollection_Array1<double> aParams(0, 20);
+  for (int anIndex = 0; anIndex <= 20; ++anIndex)
+  {
+    aParams(anIndex) = 0.5 + 1.5 * anIndex / 20.0;
+  }
+  aParams(20) = anAdaptor.LastParameter();
+  NCollection_Array1<gp_Pnt> aPoints(1, 21), aPoints1(1, 21);
+  NCollection_Array1<gp_Vec> aD1(1, 21);
+  anAdaptor.EvaluateD0(aParams, aPoints);
+  anAdaptor.EvaluateD1(aParams, aPoints1, aD1);
+
+  // the derivative at the trimmed end is computed on the left span as by D1()
+  for (int anIndex = 0; anIndex <= 20; ++anIndex)
+  {
+    gp_Pnt aPnt;
+    gp_Vec aVec;
+    anAdaptor.D1(aParams(anIndex), aPnt, aVec);
+    EXPECT_TRUE(aPnt.IsEqual(aPoints(anIndex + 1), Precision::Confusion()));
+    EXPECT_TRUE(aPnt.IsEqual(aPoints1(anIndex + 1), Precision::Confusion()));
+    EXPECT_TRUE(aVec.IsEqual(aD1(anIndex + 1), Precision::Confusion(), Precision::Angular()));
+  }
+}
+
+//==================================================================================================
+
+TEST_F(GeomAdaptor_Curve_Test, EvaluateD0_Circle_MatchesPointwise)
+{
+  GeomAdaptor_Curve          anAdaptor(myCircle);
+  NCollection_Array1<double> aParams(1, 8);
+  for (int anIndex = 1; anIndex <= 8; ++anIndex)
+  {
+    aParams(anIndex) = anIndex * 0.7;
+  }
+  NCollection_Array1<gp_Pnt> aPoints(1, 8);
+  anAdaptor.EvaluateD0(aParams, aPoints);
+  for (int anIndex = 1; anIndex <= 8; ++anIndex)
+  {
+    const gp_Pnt aPnt = myCircle->Value(aParams(anIndex));
+    EXPECT_TRUE(aPoints(anIndex).IsEqual(aPnt, Precision::Confusion()));
+  }
+
+  NCollection_Array1<gp_Pnt> aShortPoints(1, 7);
+  EXPECT_THROW(anAdaptor.EvaluateD0(aParams, aShortPoints), Standard_DimensionMismatch);
+}
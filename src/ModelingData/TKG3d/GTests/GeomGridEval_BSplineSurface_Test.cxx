@@ -876,3 +876,199 @@ TEST(GeomGridEval_BSplineSurfaceTest, UVPairs_SinglePoint)
   aSurf->D0(0.5, 0.5, aExpected);
   EXPECT_NEAR(aPoints.Value(1).Distance(aExpected), 0.0, THE_TOLERANCE);
 }
+
+//==================================================================================================
+// Large Grid Tests (batch and parallel evaluation)
+//==================================================================================================
+
+namespace
+{
+//! Creates a rational surface of degree 5x3 with 4x3 spans.
+occ::handle<Geom_BSplineSurface> CreateLargeRationalBSplineSurface()
+{
+  NCollection_Array2<gp_Pnt> aPoles(1, 8, 1, 5);
+  NCollection_Array2<double> aWeights(1, 8, 1, 5);
+  for (int i = 1; i <= 8; ++i)
+  {
+    for (int j = 1; j <= 5; ++j)
+    {
+      const double aZ = std::sin((i - 1) * M_PI / 5.0) * std::cos((j - 1) * M_PI / 3.0);
+      aPoles.SetValue(i, j, gp_Pnt((i - 1) * 1.0, (j - 1) * 1.0, aZ));
+      aWeights.SetValue(i, j, 1.0 + 0.25 * ((i * j) % 3));
+    }
+  }
+
+  NCollection_Array1<double> aUKnots(1, 5);
+  NCollection_Array1<int>    aUMults(1, 5);
+  for (int i = 1; i <= 5; ++i)
+  {
+    aUKnots.SetValue(i, (i - 1) * 0.25);
+    aUMults.SetValue(i, (i == 1 || i == 5) ? 6 : 1);
+  }
+
+  NCollection_Array1<double> aVKnots(1, 3);
+  NCollection_Array1<int>    aVMults(1, 3);
+  aVKnots.SetValue(1, 0.0);
+  aVKnots.SetValue(2, 0.5);
+  aVKnots.SetValue(3, 1.0);
+  aVMults.SetValue(1, 4);
+  aVMults.SetValue(2, 1);
+  aVMults.SetValue(3, 4);
+
+  return new Geom_BSplineSurface(aPoles, aWeights, aUKnots, aVKnots, aUMults, aVMults, 5, 3);
+}
+} // namespace
+
+TEST(GeomGridEval_BSplineSurfaceTest, LargeGrid_CompareToGeomD0)
+{
+  occ::handle<Geom_BSplineSurface> aSurf = CreateLargeRationalBSplineSurface();
+  GeomGridEval_BSplineSurface      anEval(aSurf);
+
+  // Large enough to be split between threads
+  const int                  aNbU     = 301;
+  const int                  aNbV     = 203;
+  NCollection_Array1<double> aUParams = CreateUniformParams(0.0, 1.0, aNbU);
+  NCollection_Array1<double> aVParams = CreateUniformParams(0.0, 1.0, aNbV);
+
+  NCollection_Array2<gp_Pnt> aGrid = anEval.EvaluateGrid(aUParams, aVParams);
+  ASSERT_EQ(aGrid.NbRows(), aNbU);
+  ASSERT_EQ(aGrid.NbColumns(), aNbV);
+
+  for (int iU = 1; iU <= aNbU; ++iU)
+  {
+    for (int iV = 1; iV <= aNbV; ++iV)
+    {
+      const gp_Pnt aExpected = aSurf->Value(aUParams.Value(iU), aVParams.Value(iV));
+      EXPECT_NEAR(aGrid.Value(iU, iV).Distance(aExpected), 0.0, THE_TOLERANCE);
+    }
+  }
+}
+
+TEST(GeomGridEval_BSplineSurfaceTest, LargeGrid_DerivativeD1)
+{
+  occ::handle<Geom_BSplineSurface> aSurf = CreateLargeRationalBSplineSurface();
+  GeomGridEval_BSplineSurface      anEval(aSurf);
+
+  NCollection_Array1<double> aUParams = CreateUniformParams(0.0, 1.0, 150);
+  NCollection_Array1<double> aVParams = CreateUniformParams(0.0, 1.0, 100);
+
+  NCollection_Array2<GeomGridEval::SurfD1> aGrid = anEval.EvaluateGridD1(aUParams, aVParams);
+
+  for (int iU = 1; iU <= aUParams.Size(); ++iU)
+  {
+    for (int iV = 1; iV <= aVParams.Size(); ++iV)
+    {
+      gp_Pnt aPnt;
+      gp_Vec aD1U, aD1V;
+      aSurf->D1(aUParams.Value(iU), aVParams.Value(iV), aPnt, aD1U, aD1V);
+      const GeomGridEval::SurfD1& aRes = aGrid.Value(iU, iV);
+      EXPECT_NEAR(aRes.Point.Distance(aPnt), 0.0, THE_TOLERANCE);
+      EXPECT_NEAR((aRes.D1U - aD1U).Magnitude(), 0.0, 1e-8);
+      EXPECT_NEAR((aRes.D1V - aD1V).Magnitude(), 0.0, 1e-8);
+    }
+  }
+}
+
+//==================================================================================================
+// Backend Tests
+//==================================================================================================
+
+namespace
+{
+//! Test backend shifting CPU results to detect its use, or refusing the evaluation.
+class TestGridEvalBackend : public GeomGridEval_BSplineSurfaceBackend
+{
+public:
+  TestGridEvalBackend(const bool theToRefuse)
+      : myToRefuse(theToRefuse),
+        myNbCalls(0)
+  {
+  }
+
+  int NbCalls() const { return myNbCalls; }
+
+  bool EvaluateGrid(const occ::handle<Geom_BSplineSurface>& theSurface,
+                    const NCollection_Array1<double>&       theUParams,
+                    const NCollection_Array1<double>&       theVParams,
+                    NCollection_Array2<gp_Pnt>&             theGrid) override
+  {
+    ++myNbCalls;
+    if (myToRefuse)
+    {
+      return false;
+    }
+    for (int iU = 1; iU <= theUParams.Size(); ++iU)
+    {
+      for (int iV = 1; iV <= theVParams.Size(); ++iV)
+      {
+        theGrid.ChangeValue(iU, iV) =
+          theSurface->Value(theUParams.Value(iU), theVParams.Value(iV)).Translated(gp_Vec(0, 0, 1));
+      }
+    }
+    return true;
+  }
+
+  bool EvaluateGridD1(const occ::handle<Geom_BSplineSurface>&,
+                      const NCollection_Array1<double>&,
+                      const NCollection_Array1<double>&,
+                      NCollection_Array2<GeomGridEval::SurfD1>&) override
+  {
+    ++myNbCalls;
+    return false;
+  }
+
+private:
+  bool myToRefuse;
+  int  myNbCalls;
+};
+} // namespace
+
+TEST(GeomGridEval_BSplineSurfaceTest, Backend_UsedForGrid)
+{
+  occ::handle<Geom_BSplineSurface> aSurf = CreateSimpleBSplineSurface();
+  occ::handle<TestGridEvalBackend> aBackend = new TestGridEvalBackend(false);
+  GeomGridEval_BSplineSurface      anEval(aSurf);
+  anEval.SetBackend(aBackend);
+
+  NCollection_Array1<double> aUParams = CreateUniformParams(0.0, 1.0, 5);
+  NCollection_Array1<double> aVParams = CreateUniformParams(0.0, 1.0, 4);
+  NCollection_Array2<gp_Pnt> aGrid    = anEval.EvaluateGrid(aUParams, aVParams);
+
+  EXPECT_EQ(aBackend->NbCalls(), 1);
+  for (int iU = 1; iU <= 5; ++iU)
+  {
+    for (int iV = 1; iV <= 4; ++iV)
+    {
+      gp_Pnt aExpected = aSurf->Value(aUParams.Value(iU), aVParams.Value(iV));
+      EXPECT_NEAR(aGrid.Value(iU, iV).Distance(aExpected), 1.0, THE_TOLERANCE);
+    }
+  }
+}
+
+TEST(GeomGridEval_BSplineSurfaceTest, Backend_RefusalFallsBackToCPU)
+{
+  occ::handle<Geom_BSplineSurface> aSurf = CreateRationalBSplineSurface();
+  occ::handle<TestGridEvalBackend> aBackend = new TestGridEvalBackend(true);
+  GeomGridEval_BSplineSurface      anEval(aSurf);
+  anEval.SetBackend(aBackend);
+
+  NCollection_Array1<double> aUParams = CreateUniformParams(0.0, 1.0, 5);
+  NCollection_Array1<double> aVParams = CreateUniformParams(0.0, 1.0, 4);
+  NCollection_Array2<gp_Pnt> aGrid    = anEval.EvaluateGrid(aUParams, aVParams);
+  NCollection_Array2<GeomGridEval::SurfD1> aGridD1 = anEval.EvaluateGridD1(aUParams, aVParams);
+
+  EXPECT_EQ(aBackend->NbCalls(), 2);
+  for (int iU = 1; iU <= 5; ++iU)
+  {
+    for (int iV = 1; iV <= 4; ++iV)
+    {
+      gp_Pnt aPnt;
+      gp_Vec aD1U, aD1V;
+      aSurf->D1(aUParams.Value(iU), aVParams.Value(iV), aPnt, aD1U, aD1V);
+      EXPECT_NEAR(aGrid.Value(iU, iV).Distance(aPnt), 0.0, THE_TOLERANCE);
+      EXPECT_NEAR(aGridD1.Value(iU, iV).Point.Distance(aPnt), 0.0, THE_TOLERANCE);
+      EXPECT_NEAR((aGridD1.Value(iU, iV).D1U - aD1U).Magnitude(), 0.0, 1e-8);
+      EXPECT_NEAR((aGridD1.Value(iU, iV).D1V - aD1V).Magnitude(), 0.0, 1e-8);
+    }
+  }
+}
@@ -45,6 +45,7 @@
 #include <gp_Pnt.hxx>
 #include <gp_Vec.hxx>
 #include <Precision.hxx>
+#include <Standard_DimensionMismatch.hxx>
 #include <Standard_DomainError.hxx>
 #include <Standard_NoSuchObject.hxx>
 #include <Standard_NotImplemented.hxx>
@@ -706,6 +707,89 @@ void GeomAdaptor_Curve::D1(const double U, gp_Pnt& P, gp_Vec& V) const
 
 //=================================================================================================
 
+void GeomAdaptor_Curve::EvaluateD0(const NCollection_Array1<double>& theParams,
+                                   NCollection_Array1<gp_Pnt>&       thePoints) const
+{
+  if (theParams.Length() != thePoints.Length())
+  {
+    throw Standard_DimensionMismatch("GeomAdaptor_Curve::EvaluateD0");
+  }
+  const int aShift = thePoints.Lower() - theParams.Lower();
+  if (myTypeCurve != GeomAbs_BSplineCurve)
+  {
+    for (int anIndex = theParams.Lower(); anIndex <= theParams.Upper(); ++anIndex)
+    {
+      GeomAdaptor_Curve::D0(theParams(anIndex), thePoints(anIndex + aShift));
+    }
+    return;
+  }
+
+  auto& aBSplData = std::get<BSplineData>(myCurveData);
+  for (int anIndex = theParams.Lower(); anIndex <= theParams.Upper(); ++anIndex)
+  {
+    const double aU      = theParams(anIndex);
+    gp_Pnt&      aPnt    = thePoints(anIndex + aShift);
+    int          aStart  = 0;
+    int          aFinish = 0;
+    if (IsBoundary(aU, aStart, aFinish))
+    {
+      aBSplData.Curve->LocalD0(aU, aStart, aFinish, aPnt);
+      continue;
+    }
+    if (aBSplData.Cache.IsNull() || !aBSplData.Cache->IsCacheValid(aU))
+    {
+      RebuildCache(aU);
+    }
+    aBSplData.Cache->D0(aU, aPnt);
+  }
+}
+
+//=================================================================================================
+
+void GeomAdaptor_Curve::EvaluateD1(const NCollection_Array1<double>& theParams,
+                                   NCollection_Array1<gp_Pnt>&       thePoints,
+                                   NCollection_Array1<gp_Vec>&       theD1) const
+{
+  if (theParams.Length() != thePoints.Length() || theParams.Length() != theD1.Length())
+  {
+    throw Standard_DimensionMismatch("GeomAdaptor_Curve::EvaluateD1");
+  }
+  const int aShiftP = thePoints.Lower() - theParams.Lower();
+  const int aShiftV = theD1.Lower() - theParams.Lower();
+  if (myTypeCurve != GeomAbs_BSplineCurve)
+  {
+    for (int anIndex = theParams.Lower(); anIndex <= theParams.Upper(); ++anIndex)
+    {
+      GeomAdaptor_Curve::D1(theParams(anIndex),
+                            thePoints(anIndex + aShiftP),
+                            theD1(anIndex + aShiftV));
+    }
+    return;
+  }
+
+  auto& aBSplData = std::get<BSplineData>(myCurveData);
+  for (int anIndex = theParams.Lower(); anIndex <= theParams.Upper(); ++anIndex)
+  {
+    const double aU      = theParams(anIndex);
+    gp_Pnt&      aPnt    = thePoints(anIndex + aShiftP);
+    gp_Vec&      aVec    = theD1(anIndex + aShiftV);
+    int          aStart  = 0;
+    int          aFinish = 0;
+    if (IsBoundary(aU, aStart, aFinish))
+    {
+      aBSplData.Curve->LocalD1(aU, aStart, aFinish, aPnt, aVec);
+      continue;
+    }
+    if (aBSplData.Cache.IsNull() || !aBSplData.Cache->IsCacheValid(aU))
+    {
+      RebuildCache(aU);
+    }
+    aBSplData.Cache->D1(aU, aPnt, aVec);
+  }
+}
+
+//=================================================================================================
+
 void GeomAdaptor_Curve::D2(const double U, gp_Pnt& P, gp_Vec& V1, gp_Vec& V2) const
 {
   switch (myTypeCurve)
@@ -163,6 +163,19 @@ public:
   //! else the derivatives are computed on the basis curve.
   Standard_EXPORT void D1(const double U, gp_Pnt& P, gp_Vec& V) const final;
 
+  //! Computes the points of the given parameters.
+  //! For B-spline curves the cache of the current span is evaluated in a tight loop
+  //! and rebuilt only when a parameter leaves the span, so that sorted parameters
+  //! rebuild the cache once per span.
+  Standard_EXPORT void EvaluateD0(const NCollection_Array1<double>& theParams,
+                                  NCollection_Array1<gp_Pnt>&       thePoints) const override;
+
+  //! Computes the points and the first derivatives of the given parameters.
+  //! The results are the same as of D1() called for each parameter.
+  Standard_EXPORT void EvaluateD1(const NCollection_Array1<double>& theParams,
+                                  NCollection_Array1<gp_Pnt>&       thePoints,
+                                  NCollection_Array1<gp_Vec>&       theD1) const override;
+
   //! Returns the point P of parameter U, the first and second
   //! derivatives V1 and V2.
   //!
@@ -59,6 +59,7 @@
 #include <gp_Trsf.hxx>
 #include <gp_Vec.hxx>
 #include <Precision.hxx>
+#include <Standard_DimensionMismatch.hxx>
 #include <Standard_DomainError.hxx>
 #include <Standard_NoSuchObject.hxx>
 #include <Standard_NullObject.hxx>
@@ -1078,6 +1079,74 @@ void GeomAdaptor_Surface::D1(const double U,
 
 //=================================================================================================
 
+void GeomAdaptor_Surface::EvaluateD0(const NCollection_Array1<gp_Pnt2d>& theUVs,
+                                     NCollection_Array1<gp_Pnt>&         thePoints) const
+{
+  if (theUVs.Length() != thePoints.Length())
+  {
+    throw Standard_DimensionMismatch("GeomAdaptor_Surface::EvaluateD0");
+  }
+  const int                    aShift = thePoints.Lower() - theUVs.Lower();
+  occ::handle<BSplSLib_Cache>* aCache = nullptr;
+  if (mySurfaceType == GeomAbs_BezierSurface)
+  {
+    aCache = &std::get<BezierData>(mySurfaceData).Cache;
+  }
+  else if (mySurfaceType == GeomAbs_BSplineSurface)
+  {
+    aCache = &std::get<BSplineData>(mySurfaceData).Cache;
+  }
+  if (aCache == nullptr)
+  {
+    for (int anIndex = theUVs.Lower(); anIndex <= theUVs.Upper(); ++anIndex)
+    {
+      const gp_Pnt2d& aUV = theUVs(anIndex);
+      GeomAdaptor_Surface::D0(aUV.X(), aUV.Y(), thePoints(anIndex + aShift));
+    }
+    return;
+  }
+
+  for (int anIndex = theUVs.Lower(); anIndex <= theUVs.Upper(); ++anIndex)
+  {
+    const gp_Pnt2d& aUV = theUVs(anIndex);
+    if (aCache->IsNull() || !(*aCache)->IsCacheValid(aUV.X(), aUV.Y()))
+    {
+      RebuildCache(aUV.X(), aUV.Y());
+    }
+    (*aCache)->D0(aUV.X(), aUV.Y(), thePoints(anIndex + aShift));
+  }
+}
+
+//=================================================================================================
+
+void GeomAdaptor_Surface::EvaluateD1(const NCollection_Array1<gp_Pnt2d>& theUVs,
+                                     NCollection_Array1<gp_Pnt>&         thePoints,
+                                     NCollection_Array1<gp_Vec>&         theD1U,
+                                     NCollection_Array1<gp_Vec>&         theD1V) const
+{
+  if (theUVs.Length() != thePoints.Length() || theUVs.Length() != theD1U.Length()
+      || theUVs.Length() != theD1V.Length())
+  {
+    throw Standard_DimensionMismatch("GeomAdaptor_Surface::EvaluateD1");
+  }
+  // D1() handles the boundaries of B-spline patches specially,
+  // so the batch only saves the virtual dispatch
+  const int aShiftP = thePoints.Lower() - theUVs.Lower();
+  const int aShiftU = theD1U.Lower() - theUVs.Lower();
+  const int aShiftV = theD1V.Lower() - theUVs.Lower();
+  for (int anIndex = theUVs.Lower(); anIndex <= theUVs.Upper(); ++anIndex)
+  {
+    const gp_Pnt2d& aUV = theUVs(anIndex);
+    GeomAdaptor_Surface::D1(aUV.X(),
+                            aUV.Y(),
+                            thePoints(anIndex + aShiftP),
+                            theD1U(anIndex + aShiftU),
+                            theD1V(anIndex + aShiftV));
+  }
+}
+
+//=================================================================================================
+
 void GeomAdaptor_Surface::D2(const double U,
                              const double V,
                              gp_Pnt&      P,
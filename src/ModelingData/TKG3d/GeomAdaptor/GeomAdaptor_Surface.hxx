@@ -247,6 +247,19 @@ public:
                           gp_Vec&      D1U,
                           gp_Vec&      D1V) const final;
 
+  //! Computes the points of the given (U, V) parameters.
+  //! For B-spline and Bezier surfaces the cache of the current patch is evaluated
+  //! in a tight loop and rebuilt only when the parameters leave the patch.
+  Standard_EXPORT void EvaluateD0(const NCollection_Array1<gp_Pnt2d>& theUVs,
+                                  NCollection_Array1<gp_Pnt>&         thePoints) const override;
+
+  //! Computes the points and the first derivatives of the given (U, V) parameters.
+  //! The results are the same as of D1() called for each pair of parameters.
+  Standard_EXPORT void EvaluateD1(const NCollection_Array1<gp_Pnt2d>& theUVs,
+                                  NCollection_Array1<gp_Pnt>&         thePoints,
+                                  NCollection_Array1<gp_Vec>&         theD1U,
+                                  NCollection_Array1<gp_Vec>&         theD1V) const override;
+
   //! Computes the point, the first and second derivatives
   //! on the surface.
   //!
@@ -131,6 +131,48 @@ void GeomAdaptor_TransformedSurface::D1(const double theU,
 
 //==================================================================================================
 
+void GeomAdaptor_TransformedSurface::EvaluateD0(const NCollection_Array1<gp_Pnt2d>& theUVs,
+                                                NCollection_Array1<gp_Pnt>&         thePoints) const
+{
+  mySurf.EvaluateD0(theUVs, thePoints);
+  if (myTrsf.Form() == gp_Identity)
+  {
+    return;
+  }
+  for (gp_Pnt& aPnt : thePoints)
+  {
+    aPnt.Transform(myTrsf);
+  }
+}
+
+//==================================================================================================
+
+void GeomAdaptor_TransformedSurface::EvaluateD1(const NCollection_Array1<gp_Pnt2d>& theUVs,
+                                                NCollection_Array1<gp_Pnt>&         thePoints,
+                                                NCollection_Array1<gp_Vec>&         theD1U,
+                                                NCollection_Array1<gp_Vec>&         theD1V) const
+{
+  mySurf.EvaluateD1(theUVs, thePoints, theD1U, theD1V);
+  if (myTrsf.Form() == gp_Identity)
+  {
+    return;
+  }
+  for (gp_Pnt& aPnt : thePoints)
+  {
+    aPnt.Transform(myTrsf);
+  }
+  for (gp_Vec& aVec : theD1U)
+  {
+    aVec.Transform(myTrsf);
+  }
+  for (gp_Vec& aVec : theD1V)
+  {
+    aVec.Transform(myTrsf);
+  }
+}
+
+//==================================================================================================
+
 void GeomAdaptor_TransformedSurface::D2(const double theU,
                                         const double theV,
                                         gp_Pnt&      theP,
@@ -159,6 +159,18 @@ public:
                           gp_Vec&      theD1U,
                           gp_Vec&      theD1V) const final;
 
+  //! Computes the points of the given (U, V) parameters on the surface.
+  //! Applies transformation after evaluation.
+  Standard_EXPORT void EvaluateD0(const NCollection_Array1<gp_Pnt2d>& theUVs,
+                                  NCollection_Array1<gp_Pnt>&         thePoints) const override;
+
+  //! Computes the points and the first derivatives of the given (U, V) parameters.
+  //! Applies transformation after evaluation.
+  Standard_EXPORT void EvaluateD1(const NCollection_Array1<gp_Pnt2d>& theUVs,
+                                  NCollection_Array1<gp_Pnt>&         thePoints,
+                                  NCollection_Array1<gp_Vec>&         theD1U,
+                                  NCollection_Array1<gp_Vec>&         theD1V) const override;
+
   //! Computes the point, the first and second derivatives on the surface.
   //! Applies transformation after evaluation.
   Standard_EXPORT void D2(const double theU,
@@ -39,6 +39,8 @@ set(OCCT_GeomGridEval_FILES
   GeomGridEval_OffsetSurface.cxx
   GeomGridEval_BSplineSurface.hxx
   GeomGridEval_BSplineSurface.cxx
+  GeomGridEval_BSplineSurfaceBackend.hxx
+  GeomGridEval_BSplineSurfaceBackend.cxx
   GeomGridEval_OtherSurface.hxx
   GeomGridEval_OtherSurface.cxx
   GeomGridEval_SurfaceOfRevolution.hxx
@@ -21,6 +21,9 @@
 #include <NCollection_HArray2.hxx>
 #include <NCollection_Array1.hxx>
 #include <NCollection_HArray1.hxx>
+#include <OSD_Parallel.hxx>
+
+#include <cstdint>
 
 namespace
 {
@@ -28,6 +31,51 @@ namespace
 //! For small spans (few points), direct BSplSLib evaluation is faster than building cache.
 constexpr int THE_CACHE_THRESHOLD = 4;
 
+//! Minimal number of points for which the evaluation is split between threads.
+constexpr int THE_PARALLEL_THRESHOLD = 4096;
+
+//! Minimal number of points in a range evaluated by one thread.
+constexpr int THE_MIN_RANGE_SIZE = 1024;
+
+//! Number of points gathered for one batch evaluation of the span cache.
+constexpr int THE_BATCH_SIZE = 64;
+
+//! @brief Iterates over groups of sorted UV points lying in the same span.
+//!
+//! @tparam GroupFunc Functor type for group processing: void(int theBegin, int theEnd)
+//!
+//! @param theUVPoints  Sorted UV points with span info
+//! @param theFrom      Index of the first point to process
+//! @param theTo        Index following the last point to process
+//! @param theGroupFunc Functor called for each group [theBegin, theEnd)
+template <typename GroupFunc>
+void iterateSpanGroups(const NCollection_Array1<GeomGridEval::UVPointWithSpan>& theUVPoints,
+                       const int                                                theFrom,
+                       const int                                                theTo,
+                       GroupFunc&&                                              theGroupFunc)
+{
+  int i = theFrom;
+  while (i < theTo)
+  {
+    const GeomGridEval::UVPointWithSpan& aFirstPt = theUVPoints.Value(i);
+
+    // Count points in this span group
+    int aGroupEnd = i + 1;
+    while (aGroupEnd < theTo)
+    {
+      const GeomGridEval::UVPointWithSpan& aPt = theUVPoints.Value(aGroupEnd);
+      if (aPt.USpanIdx != aFirstPt.USpanIdx || aPt.VSpanIdx != aFirstPt.VSpanIdx)
+      {
+        break;
+      }
+      ++aGroupEnd;
+    }
+
+    theGroupFunc(i, aGroupEnd);
+    i = aGroupEnd;
+  }
+}
+
 //! @brief Iterates over sorted UV points with cache-optimal span grouping.
 //!
 //! This helper processes UV points that have been sorted by (USpanIdx, VSpanIdx, U).
@@ -39,46 +87,26 @@ constexpr int THE_CACHE_THRESHOLD = 4;
 //! @tparam DirectEvalFunc Functor type for direct evaluation: void(const UVPointWithSpan& pt)
 //!
 //! @param theUVPoints    Sorted UV points with span info
+//! @param theFrom        Index of the first point to process
+//! @param theTo          Index following the last point to process
 //! @param theBuildCache  Functor to rebuild cache for a span
 //! @param theCacheEval   Functor called for cache-based evaluation (large spans)
 //! @param theDirectEval  Functor called for direct evaluation (small spans)
 template <typename BuildCacheFunc, typename CacheEvalFunc, typename DirectEvalFunc>
 void iterateSortedUVPoints(const NCollection_Array1<GeomGridEval::UVPointWithSpan>& theUVPoints,
+                           const int                                                theFrom,
+                           const int                                                theTo,
                            BuildCacheFunc&&                                         theBuildCache,
                            CacheEvalFunc&&                                          theCacheEval,
                            DirectEvalFunc&&                                         theDirectEval)
 {
-  const int aNbPoints = theUVPoints.Size();
-  if (aNbPoints == 0)
-  {
-    return;
-  }
-
-  int i = 0;
-  while (i < aNbPoints)
-  {
-    const GeomGridEval::UVPointWithSpan& aFirstPt = theUVPoints.Value(i);
-    const int                            aUSpan   = aFirstPt.USpanIdx;
-    const int                            aVSpan   = aFirstPt.VSpanIdx;
-
-    // Count points in this span group
-    int aGroupEnd = i + 1;
-    while (aGroupEnd < aNbPoints)
-    {
-      const GeomGridEval::UVPointWithSpan& aPt = theUVPoints.Value(aGroupEnd);
-      if (aPt.USpanIdx != aUSpan || aPt.VSpanIdx != aVSpan)
-      {
-        break;
-      }
-      ++aGroupEnd;
-    }
-    const int aGroupSize = aGroupEnd - i;
-
-    if (aGroupSize >= THE_CACHE_THRESHOLD)
+  iterateSpanGroups(theUVPoints, theFrom, theTo, [&](int theBegin, int theEnd) {
+    if (theEnd - theBegin >= THE_CACHE_THRESHOLD)
     {
       // Large group: use cache-based evaluation
+      const GeomGridEval::UVPointWithSpan& aFirstPt = theUVPoints.Value(theBegin);
       theBuildCache(aFirstPt.U, aFirstPt.V);
-      for (int j = i; j < aGroupEnd; ++j)
+      for (int j = theBegin; j < theEnd; ++j)
       {
         theCacheEval(theUVPoints.Value(j));
       }
@@ -86,13 +114,72 @@ void iterateSortedUVPoints(const NCollection_Array1<GeomGridEval::UVPointWithSpa
     else
     {
       // Small group: use direct evaluation (skip cache building)
-      for (int j = i; j < aGroupEnd; ++j)
+      for (int j = theBegin; j < theEnd; ++j)
       {
         theDirectEval(theUVPoints.Value(j));
       }
     }
+  });
+}
 
-    i = aGroupEnd;
+//! @brief Evaluates sorted UV points by ranges, in parallel threads for large sets.
+//!
+//! Small sets are evaluated as a single range in the calling thread.
+//! A span group split between two ranges just gets its cache built in both of them.
+//!
+//! @tparam RangeFunc Functor type for range evaluation: void(int theFrom, int theTo)
+//!
+//! @param theUVPoints  Sorted UV points with span info
+//! @param theEvalRange Functor evaluating the points [theFrom, theTo) with its own cache
+template <typename RangeFunc>
+void evaluateByRanges(const NCollection_Array1<GeomGridEval::UVPointWithSpan>& theUVPoints,
+                      RangeFunc&&                                              theEvalRange)
+{
+  const int aNbPoints  = theUVPoints.Size();
+  const int aNbThreads = OSD_Parallel::NbLogicalProcessors();
+  if (aNbPoints < THE_PARALLEL_THRESHOLD || aNbThreads < 2)
+  {
+    theEvalRange(0, aNbPoints);
+    return;
+  }
+
+  const int aNbRanges = std::min(4 * aNbThreads, aNbPoints / THE_MIN_RANGE_SIZE);
+  OSD_Parallel::For(0, aNbRanges, [&](int theRange) {
+    const int aFrom = static_cast<int>(static_cast<int64_t>(aNbPoints) * theRange / aNbRanges);
+    const int aTo = static_cast<int>(static_cast<int64_t>(aNbPoints) * (theRange + 1) / aNbRanges);
+    theEvalRange(aFrom, aTo);
+  });
+}
+
+//! Evaluates a group of sorted UV points lying in the span of the built cache.
+//! Local parameters are gathered by batches for the vectorized cache evaluation.
+//! @param theCache    Cache built for the span of the group
+//! @param theUVPoints Sorted UV points with span info
+//! @param theBegin    Index of the first point of the group
+//! @param theEnd      Index following the last point of the group
+//! @param theResult   Result array indexed by OutputIdx + 1
+void evaluateGroupD0(const BSplSLib_Cache&                                    theCache,
+                     const NCollection_Array1<GeomGridEval::UVPointWithSpan>& theUVPoints,
+                     const int                                                theBegin,
+                     const int                                                theEnd,
+                     NCollection_Array1<gp_Pnt>&                              theResult)
+{
+  double aLocalU[THE_BATCH_SIZE], aLocalV[THE_BATCH_SIZE];
+  gp_Pnt aPoints[THE_BATCH_SIZE];
+  for (int aFirst = theBegin; aFirst < theEnd; aFirst += THE_BATCH_SIZE)
+  {
+    const int aNbPoints = std::min(THE_BATCH_SIZE, theEnd - aFirst);
+    for (int k = 0; k < aNbPoints; ++k)
+    {
+      const GeomGridEval::UVPointWithSpan& aPt = theUVPoints.Value(aFirst + k);
+      aLocalU[k]                               = aPt.LocalU;
+      aLocalV[k]                               = aPt.LocalV;
+    }
+    theCache.D0LocalBatch(aLocalU, aLocalV, aNbPoints, aPoints);
+    for (int k = 0; k < aNbPoints; ++k)
+    {
+      theResult.SetValue(theUVPoints.Value(aFirst + k).OutputIdx + 1, aPoints[k]);
+    }
   }
 }
 
@@ -252,6 +339,15 @@ NCollection_Array2<gp_Pnt> GeomGridEval_BSplineSurface::EvaluateGrid(
   const int aNbU = theUParams.Size();
   const int aNbV = theVParams.Size();
 
+  if (!myBackend.IsNull())
+  {
+    NCollection_Array2<gp_Pnt> aGrid(1, aNbU, 1, aNbV);
+    if (myBackend->EvaluateGrid(myGeom, theUParams, theVParams, aGrid))
+    {
+      return aGrid;
+    }
+  }
+
   // Prepare UV points and sort by span
   NCollection_Array1<GeomGridEval::UVPointWithSpan> aUVPoints;
   prepareGridPoints(theUParams, theVParams, aUVPoints);
@@ -288,47 +384,58 @@ NCollection_Array2<gp_Pnt> GeomGridEval_BSplineSurface::EvaluateGrid(
   const int                  aNbPoints = aNbU * aNbV;
   NCollection_Array1<gp_Pnt> aLinearResult(1, aNbPoints);
 
-  // Create local cache for cache-based evaluation (only used for large span groups)
-  occ::handle<BSplSLib_Cache> aCache = new BSplSLib_Cache(aUDegree,
-                                                          isUPeriodic,
-                                                          aUFlatKnots,
-                                                          aVDegree,
-                                                          isVPeriodic,
-                                                          aVFlatKnots,
-                                                          aWeights);
-
-  // Evaluate using sorted UV points
-  iterateSortedUVPoints(
-    aUVPoints,
-    [&](double theU, double theV) {
-      aCache->BuildCache(theU, theV, aUFlatKnots, aVFlatKnots, aPoles, aWeights);
-    },
-    [&](const GeomGridEval::UVPointWithSpan& thePt) {
-      gp_Pnt aPnt;
-      aCache->D0Local(thePt.LocalU, thePt.LocalV, aPnt);
-      aLinearResult.SetValue(thePt.OutputIdx + 1, aPnt);
-    },
-    [&](const GeomGridEval::UVPointWithSpan& thePt) {
-      gp_Pnt aPnt;
-      BSplSLib::D0(thePt.U,
-                   thePt.V,
-                   thePt.USpanIdx,
-                   thePt.VSpanIdx,
-                   aPoles,
-                   aWeights,
-                   aUFlatKnots,
-                   aVFlatKnots,
-                   nullptr,
-                   nullptr,
-                   aUDegree,
-                   aVDegree,
-                   isURational,
-                   isVRational,
-                   isUPeriodic,
-                   isVPeriodic,
-                   aPnt);
-      aLinearResult.SetValue(thePt.OutputIdx + 1, aPnt);
+  // Evaluate ranges of sorted UV points, each range with its own cache
+  evaluateByRanges(aUVPoints, [&](int theFrom, int theTo) {
+    // Local cache for cache-based evaluation (only used for large span groups)
+    occ::handle<BSplSLib_Cache> aCache = new BSplSLib_Cache(aUDegree,
+                                                            isUPeriodic,
+                                                            aUFlatKnots,
+                                                            aVDegree,
+                                                            isVPeriodic,
+                                                            aVFlatKnots,
+                                                            aWeights);
+
+    iterateSpanGroups(aUVPoints, theFrom, theTo, [&](int theBegin, int theEnd) {
+      if (theEnd - theBegin >= THE_CACHE_THRESHOLD)
+      {
+        // Large group: evaluate the span cache by batches of points
+        const GeomGridEval::UVPointWithSpan& aFirstPt = aUVPoints.Value(theBegin);
+        aCache->BuildCache(aFirstPt.U,
+                           aFirstPt.V,
+                           aUFlatKnots,
+                           aVFlatKnots,
+                           aPoles,
+                           aWeights);
+        evaluateGroupD0(*aCache, aUVPoints, theBegin, theEnd, aLinearResult);
+        return;
+      }
+
+      // Small group: use direct evaluation (skip cache building)
+      for (int i = theBegin; i < theEnd; ++i)
+      {
+        const GeomGridEval::UVPointWithSpan& aPt = aUVPoints.Value(i);
+        gp_Pnt                               aPnt;
+        BSplSLib::D0(aPt.U,
+                     aPt.V,
+                     aPt.USpanIdx,
+                     aPt.VSpanIdx,
+                     aPoles,
+                     aWeights,
+                     aUFlatKnots,
+                     aVFlatKnots,
+                     nullptr,
+                     nullptr,
+                     aUDegree,
+                     aVDegree,
+                     isURational,
+                     isVRational,
+                     isUPeriodic,
+                     isVPeriodic,
+                     aPnt);
+        aLinearResult.SetValue(aPt.OutputIdx + 1, aPnt);
+      }
     });
+  });
 
   // Reshape linear buffer to 2D grid
   NCollection_Array2<gp_Pnt> aGrid(1, aNbU, 1, aNbV);
@@ -389,47 +496,58 @@ NCollection_Array1<gp_Pnt> GeomGridEval_BSplineSurface::EvaluatePoints(
   // Allocate result buffer (1-based indexing)
   NCollection_Array1<gp_Pnt> aPoints(1, aNbPoints);
 
-  // Create local cache for cache-based evaluation (only used for large span groups)
-  occ::handle<BSplSLib_Cache> aCache = new BSplSLib_Cache(aUDegree,
-                                                          isUPeriodic,
-                                                          aUFlatKnots,
-                                                          aVDegree,
-                                                          isVPeriodic,
-                                                          aVFlatKnots,
-                                                          aWeights);
-
-  // Evaluate using sorted UV points
-  iterateSortedUVPoints(
-    aUVPoints,
-    [&](double theU, double theV) {
-      aCache->BuildCache(theU, theV, aUFlatKnots, aVFlatKnots, aPoles, aWeights);
-    },
-    [&](const GeomGridEval::UVPointWithSpan& thePt) {
-      gp_Pnt aPnt;
-      aCache->D0Local(thePt.LocalU, thePt.LocalV, aPnt);
-      aPoints.SetValue(thePt.OutputIdx + 1, aPnt);
-    },
-    [&](const GeomGridEval::UVPointWithSpan& thePt) {
-      gp_Pnt aPnt;
-      BSplSLib::D0(thePt.U,
-                   thePt.V,
-                   thePt.USpanIdx,
-                   thePt.VSpanIdx,
-                   aPoles,
-                   aWeights,
-                   aUFlatKnots,
-                   aVFlatKnots,
-                   nullptr,
-                   nullptr,
-                   aUDegree,
-                   aVDegree,
-                   isURational,
-                   isVRational,
-                   isUPeriodic,
-                   isVPeriodic,
-                   aPnt);
-      aPoints.SetValue(thePt.OutputIdx + 1, aPnt);
+  // Evaluate ranges of sorted UV points, each range with its own cache
+  evaluateByRanges(aUVPoints, [&](int theFrom, int theTo) {
+    // Local cache for cache-based evaluation (only used for large span groups)
+    occ::handle<BSplSLib_Cache> aCache = new BSplSLib_Cache(aUDegree,
+                                                            isUPeriodic,
+                                                            aUFlatKnots,
+                                                            aVDegree,
+                                                            isVPeriodic,
+                                                            aVFlatKnots,
+                                                            aWeights);
+
+    iterateSpanGroups(aUVPoints, theFrom, theTo, [&](int theBegin, int theEnd) {
+      if (theEnd - theBegin >= THE_CACHE_THRESHOLD)
+      {
+        // Large group: evaluate the span cache by batches of points
+        const GeomGridEval::UVPointWithSpan& aFirstPt = aUVPoints.Value(theBegin);
+        aCache->BuildCache(aFirstPt.U,
+                           aFirstPt.V,
+                           aUFlatKnots,
+                           aVFlatKnots,
+                           aPoles,
+                           aWeights);
+        evaluateGroupD0(*aCache, aUVPoints, theBegin, theEnd, aPoints);
+        return;
+      }
+
+      // Small group: use direct evaluation (skip cache building)
+      for (int i = theBegin; i < theEnd; ++i)
+      {
+        const GeomGridEval::UVPointWithSpan& aPt = aUVPoints.Value(i);
+        gp_Pnt                               aPnt;
+        BSplSLib::D0(aPt.U,
+                     aPt.V,
+                     aPt.USpanIdx,
+                     aPt.VSpanIdx,
+                     aPoles,
+                     aWeights,
+                     aUFlatKnots,
+                     aVFlatKnots,
+                     nullptr,
+                     nullptr,
+                     aUDegree,
+                     aVDegree,
+                     isURational,
+                     isVRational,
+                     isUPeriodic,
+                     isVPeriodic,
+                     aPnt);
+        aPoints.SetValue(aPt.OutputIdx + 1, aPnt);
+      }
     });
+  });
 
   return aPoints;
 }
@@ -448,6 +566,15 @@ NCollection_Array2<GeomGridEval::SurfD1> GeomGridEval_BSplineSurface::EvaluateGr
   const int aNbU = theUParams.Size();
   const int aNbV = theVParams.Size();
 
+  if (!myBackend.IsNull())
+  {
+    NCollection_Array2<GeomGridEval::SurfD1> aGrid(1, aNbU, 1, aNbV);
+    if (myBackend->EvaluateGridD1(myGeom, theUParams, theVParams, aGrid))
+    {
+      return aGrid;
+    }
+  }
+
   NCollection_Array1<GeomGridEval::SurfD1> aLinearResult = EvaluatePointsD1(theUParams, theVParams);
   if (aLinearResult.IsEmpty())
   {
@@ -511,50 +638,55 @@ NCollection_Array1<GeomGridEval::SurfD1> GeomGridEval_BSplineSurface::EvaluatePo
 
   NCollection_Array1<GeomGridEval::SurfD1> aResults(1, aNbPoints);
 
-  // Create local cache for cache-based evaluation (only used for large span groups)
-  occ::handle<BSplSLib_Cache> aCache = new BSplSLib_Cache(aUDegree,
-                                                          isUPeriodic,
-                                                          aUFlatKnots,
-                                                          aVDegree,
-                                                          isVPeriodic,
-                                                          aVFlatKnots,
-                                                          aWeights);
-
-  iterateSortedUVPoints(
-    aUVPoints,
-    [&](double theU, double theV) {
-      aCache->BuildCache(theU, theV, aUFlatKnots, aVFlatKnots, aPoles, aWeights);
-    },
-    [&](const GeomGridEval::UVPointWithSpan& thePt) {
-      gp_Pnt aPoint;
-      gp_Vec aD1U, aD1V;
-      aCache->D1Local(thePt.LocalU, thePt.LocalV, aPoint, aD1U, aD1V);
-      aResults.SetValue(thePt.OutputIdx + 1, GeomGridEval::SurfD1{aPoint, aD1U, aD1V});
-    },
-    [&](const GeomGridEval::UVPointWithSpan& thePt) {
-      gp_Pnt aPoint;
-      gp_Vec aD1U, aD1V;
-      BSplSLib::D1(thePt.U,
-                   thePt.V,
-                   thePt.USpanIdx,
-                   thePt.VSpanIdx,
-                   aPoles,
-                   aWeights,
-                   aUFlatKnots,
-                   aVFlatKnots,
-                   nullptr,
-                   nullptr,
-                   aUDegree,
-                   aVDegree,
-                   isURational,
-                   isVRational,
-                   isUPeriodic,
-                   isVPeriodic,
-                   aPoint,
-                   aD1U,
-                   aD1V);
-      aResults.SetValue(thePt.OutputIdx + 1, GeomGridEval::SurfD1{aPoint, aD1U, aD1V});
-    });
+  // Evaluate ranges of sorted UV points, each range with its own cache
+  evaluateByRanges(aUVPoints, [&](int theFrom, int theTo) {
+    // Local cache for cache-based evaluation (only used for large span groups)
+    occ::handle<BSplSLib_Cache> aCache = new BSplSLib_Cache(aUDegree,
+                                                            isUPeriodic,
+                                                            aUFlatKnots,
+                                                            aVDegree,
+                                                            isVPeriodic,
+                                                            aVFlatKnots,
+                                                            aWeights);
+
+    iterateSortedUVPoints(
+      aUVPoints,
+      theFrom,
+      theTo,
+      [&](double theU, double theV) {
+        aCache->BuildCache(theU, theV, aUFlatKnots, aVFlatKnots, aPoles, aWeights);
+      },
+      [&](const GeomGridEval::UVPointWithSpan& thePt) {
+        gp_Pnt aPoint;
+        gp_Vec aD1U, aD1V;
+        aCache->D1Local(thePt.LocalU, thePt.LocalV, aPoint, aD1U, aD1V);
+        aResults.SetValue(thePt.OutputIdx + 1, GeomGridEval::SurfD1{aPoint, aD1U, aD1V});
+      },
+      [&](const GeomGridEval::UVPointWithSpan& thePt) {
+        gp_Pnt aPoint;
+        gp_Vec aD1U, aD1V;
+        BSplSLib::D1(thePt.U,
+                     thePt.V,
+                     thePt.USpanIdx,
+                     thePt.VSpanIdx,
+                     aPoles,
+                     aWeights,
+                     aUFlatKnots,
+                     aVFlatKnots,
+                     nullptr,
+                     nullptr,
+                     aUDegree,
+                     aVDegree,
+                     isURational,
+                     isVRational,
+                     isUPeriodic,
+                     isVPeriodic,
+                     aPoint,
+                     aD1U,
+                     aD1V);
+        aResults.SetValue(thePt.OutputIdx + 1, GeomGridEval::SurfD1{aPoint, aD1U, aD1V});
+      });
+  });
 
   return aResults;
 }
@@ -636,55 +768,60 @@ NCollection_Array1<GeomGridEval::SurfD2> GeomGridEval_BSplineSurface::EvaluatePo
 
   NCollection_Array1<GeomGridEval::SurfD2> aResults(1, aNbPoints);
 
-  // Create local cache for cache-based evaluation (only used for large span groups)
-  occ::handle<BSplSLib_Cache> aCache = new BSplSLib_Cache(aUDegree,
-                                                          isUPeriodic,
-                                                          aUFlatKnots,
-                                                          aVDegree,
-                                                          isVPeriodic,
-                                                          aVFlatKnots,
-                                                          aWeights);
-
-  iterateSortedUVPoints(
-    aUVPoints,
-    [&](double theU, double theV) {
-      aCache->BuildCache(theU, theV, aUFlatKnots, aVFlatKnots, aPoles, aWeights);
-    },
-    [&](const GeomGridEval::UVPointWithSpan& thePt) {
-      gp_Pnt aPoint;
-      gp_Vec aD1U, aD1V, aD2U, aD2V, aD2UV;
-      aCache->D2Local(thePt.LocalU, thePt.LocalV, aPoint, aD1U, aD1V, aD2U, aD2V, aD2UV);
-      aResults.SetValue(thePt.OutputIdx + 1,
-                        GeomGridEval::SurfD2{aPoint, aD1U, aD1V, aD2U, aD2V, aD2UV});
-    },
-    [&](const GeomGridEval::UVPointWithSpan& thePt) {
-      gp_Pnt aPoint;
-      gp_Vec aD1U, aD1V, aD2U, aD2V, aD2UV;
-      BSplSLib::D2(thePt.U,
-                   thePt.V,
-                   thePt.USpanIdx,
-                   thePt.VSpanIdx,
-                   aPoles,
-                   aWeights,
-                   aUFlatKnots,
-                   aVFlatKnots,
-                   nullptr,
-                   nullptr,
-                   aUDegree,
-                   aVDegree,
-                   isURational,
-                   isVRational,
-                   isUPeriodic,
-                   isVPeriodic,
-                   aPoint,
-                   aD1U,
-                   aD1V,
-                   aD2U,
-                   aD2V,
-                   aD2UV);
-      aResults.SetValue(thePt.OutputIdx + 1,
-                        GeomGridEval::SurfD2{aPoint, aD1U, aD1V, aD2U, aD2V, aD2UV});
-    });
+  // Evaluate ranges of sorted UV points, each range with its own cache
+  evaluateByRanges(aUVPoints, [&](int theFrom, int theTo) {
+    // Local cache for cache-based evaluation (only used for large span groups)
+    occ::handle<BSplSLib_Cache> aCache = new BSplSLib_Cache(aUDegree,
+                                                            isUPeriodic,
+                                                            aUFlatKnots,
+                                                            aVDegree,
+                                                            isVPeriodic,
+                                                            aVFlatKnots,
+                                                            aWeights);
+
+    iterateSortedUVPoints(
+      aUVPoints,
+      theFrom,
+      theTo,
+      [&](double theU, double theV) {
+        aCache->BuildCache(theU, theV, aUFlatKnots, aVFlatKnots, aPoles, aWeights);
+      },
+      [&](const GeomGridEval::UVPointWithSpan& thePt) {
+        gp_Pnt aPoint;
+        gp_Vec aD1U, aD1V, aD2U, aD2V, aD2UV;
+        aCache->D2Local(thePt.LocalU, thePt.LocalV, aPoint, aD1U, aD1V, aD2U, aD2V, aD2UV);
+        aResults.SetValue(thePt.OutputIdx + 1,
+                          GeomGridEval::SurfD2{aPoint, aD1U, aD1V, aD2U, aD2V, aD2UV});
+      },
+      [&](const GeomGridEval::UVPointWithSpan& thePt) {
+        gp_Pnt aPoint;
+        gp_Vec aD1U, aD1V, aD2U, aD2V, aD2UV;
+        BSplSLib::D2(thePt.U,
+                     thePt.V,
+                     thePt.USpanIdx,
+                     thePt.VSpanIdx,
+                     aPoles,
+                     aWeights,
+                     aUFlatKnots,
+                     aVFlatKnots,
+                     nullptr,
+                     nullptr,
+                     aUDegree,
+                     aVDegree,
+                     isURational,
+                     isVRational,
+                     isUPeriodic,
+                     isVPeriodic,
+                     aPoint,
+                     aD1U,
+                     aD1V,
+                     aD2U,
+                     aD2V,
+                     aD2UV);
+        aResults.SetValue(thePt.OutputIdx + 1,
+                          GeomGridEval::SurfD2{aPoint, aD1U, aD1V, aD2U, aD2V, aD2UV});
+      });
+  });
 
   return aResults;
 }
@@ -765,44 +902,46 @@ NCollection_Array1<GeomGridEval::SurfD3> GeomGridEval_BSplineSurface::EvaluatePo
   NCollection_Array1<GeomGridEval::SurfD3> aResults(1, aNbPoints);
 
   // D3 uses direct BSplSLib::D3 - no cache available for third derivatives
-  for (int i = 0; i < aNbPoints; ++i)
-  {
-    const GeomGridEval::UVPointWithSpan& aPt = aUVPoints.Value(i);
-
-    gp_Pnt aPoint;
-    gp_Vec aD1U, aD1V, aD2U, aD2V, aD2UV, aD3U, aD3V, aD3UUV, aD3UVV;
-
-    BSplSLib::D3(aPt.U,
-                 aPt.V,
-                 aPt.USpanIdx,
-                 aPt.VSpanIdx,
-                 aPoles,
-                 aWeights,
-                 aUFlatKnots,
-                 aVFlatKnots,
-                 nullptr,
-                 nullptr,
-                 aUDegree,
-                 aVDegree,
-                 isURational,
-                 isVRational,
-                 isUPeriodic,
-                 isVPeriodic,
-                 aPoint,
-                 aD1U,
-                 aD1V,
-                 aD2U,
-                 aD2V,
-                 aD2UV,
-                 aD3U,
-                 aD3V,
-                 aD3UUV,
-                 aD3UVV);
-
-    aResults.SetValue(
-      aPt.OutputIdx + 1,
-      GeomGridEval::SurfD3{aPoint, aD1U, aD1V, aD2U, aD2V, aD2UV, aD3U, aD3V, aD3UUV, aD3UVV});
-  }
+  evaluateByRanges(aUVPoints, [&](int theFrom, int theTo) {
+    for (int i = theFrom; i < theTo; ++i)
+    {
+      const GeomGridEval::UVPointWithSpan& aPt = aUVPoints.Value(i);
+
+      gp_Pnt aPoint;
+      gp_Vec aD1U, aD1V, aD2U, aD2V, aD2UV, aD3U, aD3V, aD3UUV, aD3UVV;
+
+      BSplSLib::D3(aPt.U,
+                   aPt.V,
+                   aPt.USpanIdx,
+                   aPt.VSpanIdx,
+                   aPoles,
+                   aWeights,
+                   aUFlatKnots,
+                   aVFlatKnots,
+                   nullptr,
+                   nullptr,
+                   aUDegree,
+                   aVDegree,
+                   isURational,
+                   isVRational,
+                   isUPeriodic,
+                   isVPeriodic,
+                   aPoint,
+                   aD1U,
+                   aD1V,
+                   aD2U,
+                   aD2V,
+                   aD2UV,
+                   aD3U,
+                   aD3V,
+                   aD3UUV,
+                   aD3UVV);
+
+      aResults.SetValue(
+        aPt.OutputIdx + 1,
+        GeomGridEval::SurfD3{aPoint, aD1U, aD1V, aD2U, aD2V, aD2UV, aD3U, aD3V, aD3UUV, aD3UVV});
+    }
+  });
 
   return aResults;
 }
@@ -898,33 +1037,35 @@ NCollection_Array1<gp_Vec> GeomGridEval_BSplineSurface::EvaluatePointsDN(
   }
 
   // Use BSplSLib::DN directly with pre-computed span indices
-  for (int i = 0; i < aNbPoints; ++i)
-  {
-    const GeomGridEval::UVPointWithSpan& aPt = aUVPoints.Value(i);
-
-    gp_Vec aDN;
-    BSplSLib::DN(aPt.U,
-                 aPt.V,
-                 theNU,
-                 theNV,
-                 aPt.USpanIdx,
-                 aPt.VSpanIdx,
-                 aPoles,
-                 aWeights,
-                 aUFlatKnots,
-                 aVFlatKnots,
-                 nullptr,
-                 nullptr,
-                 aUDegree,
-                 aVDegree,
-                 isURational,
-                 isVRational,
-                 isUPeriodic,
-                 isVPeriodic,
-                 aDN);
-
-    aResults.SetValue(aPt.OutputIdx + 1, aDN);
-  }
+  evaluateByRanges(aUVPoints, [&](int theFrom, int theTo) {
+    for (int i = theFrom; i < theTo; ++i)
+    {
+      const GeomGridEval::UVPointWithSpan& aPt = aUVPoints.Value(i);
+
+      gp_Vec aDN;
+      BSplSLib::DN(aPt.U,
+                   aPt.V,
+                   theNU,
+                   theNV,
+                   aPt.USpanIdx,
+                   aPt.VSpanIdx,
+                   aPoles,
+                   aWeights,
+                   aUFlatKnots,
+                   aVFlatKnots,
+                   nullptr,
+                   nullptr,
+                   aUDegree,
+                   aVDegree,
+                   isURational,
+                   isVRational,
+                   isUPeriodic,
+                   isVPeriodic,
+                   aDN);
+
+      aResults.SetValue(aPt.OutputIdx + 1, aDN);
+    }
+  });
 
   return aResults;
 }
@@ -978,50 +1119,55 @@ NCollection_Array1<GeomGridEval::SurfD1> GeomGridEval_BSplineSurface::EvaluatePo
 
   NCollection_Array1<GeomGridEval::SurfD1> aResults(1, aNbPoints);
 
-  // Create local cache for cache-based evaluation (only used for large span groups)
-  occ::handle<BSplSLib_Cache> aCache = new BSplSLib_Cache(aUDegree,
-                                                          isUPeriodic,
-                                                          aUFlatKnots,
-                                                          aVDegree,
-                                                          isVPeriodic,
-                                                          aVFlatKnots,
-                                                          aWeights);
-
-  iterateSortedUVPoints(
-    aUVPoints,
-    [&](double theU, double theV) {
-      aCache->BuildCache(theU, theV, aUFlatKnots, aVFlatKnots, aPoles, aWeights);
-    },
-    [&](const GeomGridEval::UVPointWithSpan& thePt) {
-      gp_Pnt aPoint;
-      gp_Vec aD1U, aD1V;
-      aCache->D1Local(thePt.LocalU, thePt.LocalV, aPoint, aD1U, aD1V);
-      aResults.SetValue(thePt.OutputIdx + 1, GeomGridEval::SurfD1{aPoint, aD1U, aD1V});
-    },
-    [&](const GeomGridEval::UVPointWithSpan& thePt) {
-      gp_Pnt aPoint;
-      gp_Vec aD1U, aD1V;
-      BSplSLib::D1(thePt.U,
-                   thePt.V,
-                   thePt.USpanIdx,
-                   thePt.VSpanIdx,
-                   aPoles,
-                   aWeights,
-                   aUFlatKnots,
-                   aVFlatKnots,
-                   nullptr,
-                   nullptr,
-                   aUDegree,
-                   aVDegree,
-                   isURational,
-                   isVRational,
-                   isUPeriodic,
-                   isVPeriodic,
-                   aPoint,
-                   aD1U,
-                   aD1V);
-      aResults.SetValue(thePt.OutputIdx + 1, GeomGridEval::SurfD1{aPoint, aD1U, aD1V});
-    });
+  // Evaluate ranges of sorted UV points, each range with its own cache
+  evaluateByRanges(aUVPoints, [&](int theFrom, int theTo) {
+    // Local cache for cache-based evaluation (only used for large span groups)
+    occ::handle<BSplSLib_Cache> aCache = new BSplSLib_Cache(aUDegree,
+                                                            isUPeriodic,
+                                                            aUFlatKnots,
+                                                            aVDegree,
+                                                            isVPeriodic,
+                                                            aVFlatKnots,
+                                                            aWeights);
+
+    iterateSortedUVPoints(
+      aUVPoints,
+      theFrom,
+      theTo,
+      [&](double theU, double theV) {
+        aCache->BuildCache(theU, theV, aUFlatKnots, aVFlatKnots, aPoles, aWeights);
+      },
+      [&](const GeomGridEval::UVPointWithSpan& thePt) {
+        gp_Pnt aPoint;
+        gp_Vec aD1U, aD1V;
+        aCache->D1Local(thePt.LocalU, thePt.LocalV, aPoint, aD1U, aD1V);
+        aResults.SetValue(thePt.OutputIdx + 1, GeomGridEval::SurfD1{aPoint, aD1U, aD1V});
+      },
+      [&](const GeomGridEval::UVPointWithSpan& thePt) {
+        gp_Pnt aPoint;
+        gp_Vec aD1U, aD1V;
+        BSplSLib::D1(thePt.U,
+                     thePt.V,
+                     thePt.USpanIdx,
+                     thePt.VSpanIdx,
+                     aPoles,
+                     aWeights,
+                     aUFlatKnots,
+                     aVFlatKnots,
+                     nullptr,
+                     nullptr,
+                     aUDegree,
+                     aVDegree,
+                     isURational,
+                     isVRational,
+                     isUPeriodic,
+                     isVPeriodic,
+                     aPoint,
+                     aD1U,
+                     aD1V);
+        aResults.SetValue(thePt.OutputIdx + 1, GeomGridEval::SurfD1{aPoint, aD1U, aD1V});
+      });
+  });
 
   return aResults;
 }
@@ -1072,55 +1218,60 @@ NCollection_Array1<GeomGridEval::SurfD2> GeomGridEval_BSplineSurface::EvaluatePo
 
   NCollection_Array1<GeomGridEval::SurfD2> aResults(1, aNbPoints);
 
-  // Create local cache for cache-based evaluation (only used for large span groups)
-  occ::handle<BSplSLib_Cache> aCache = new BSplSLib_Cache(aUDegree,
-                                                          isUPeriodic,
-                                                          aUFlatKnots,
-                                                          aVDegree,
-                                                          isVPeriodic,
-                                                          aVFlatKnots,
-                                                          aWeights);
-
-  iterateSortedUVPoints(
-    aUVPoints,
-    [&](double theU, double theV) {
-      aCache->BuildCache(theU, theV, aUFlatKnots, aVFlatKnots, aPoles, aWeights);
-    },
-    [&](const GeomGridEval::UVPointWithSpan& thePt) {
-      gp_Pnt aPoint;
-      gp_Vec aD1U, aD1V, aD2U, aD2V, aD2UV;
-      aCache->D2Local(thePt.LocalU, thePt.LocalV, aPoint, aD1U, aD1V, aD2U, aD2V, aD2UV);
-      aResults.SetValue(thePt.OutputIdx + 1,
-                        GeomGridEval::SurfD2{aPoint, aD1U, aD1V, aD2U, aD2V, aD2UV});
-    },
-    [&](const GeomGridEval::UVPointWithSpan& thePt) {
-      gp_Pnt aPoint;
-      gp_Vec aD1U, aD1V, aD2U, aD2V, aD2UV;
-      BSplSLib::D2(thePt.U,
-                   thePt.V,
-                   thePt.USpanIdx,
-                   thePt.VSpanIdx,
-                   aPoles,
-                   aWeights,
-                   aUFlatKnots,
-                   aVFlatKnots,
-                   nullptr,
-                   nullptr,
-                   aUDegree,
-                   aVDegree,
-                   isURational,
-                   isVRational,
-                   isUPeriodic,
-                   isVPeriodic,
-                   aPoint,
-                   aD1U,
-                   aD1V,
-                   aD2U,
-                   aD2V,
-                   aD2UV);
-      aResults.SetValue(thePt.OutputIdx + 1,
-                        GeomGridEval::SurfD2{aPoint, aD1U, aD1V, aD2U, aD2V, aD2UV});
-    });
+  // Evaluate ranges of sorted UV points, each range with its own cache
+  evaluateByRanges(aUVPoints, [&](int theFrom, int theTo) {
+    // Local cache for cache-based evaluation (only used for large span groups)
+    occ::handle<BSplSLib_Cache> aCache = new BSplSLib_Cache(aUDegree,
+                                                            isUPeriodic,
+                                                            aUFlatKnots,
+                                                            aVDegree,
+                                                            isVPeriodic,
+                                                            aVFlatKnots,
+                                                            aWeights);
+
+    iterateSortedUVPoints(
+      aUVPoints,
+      theFrom,
+      theTo,
+      [&](double theU, double theV) {
+        aCache->BuildCache(theU, theV, aUFlatKnots, aVFlatKnots, aPoles, aWeights);
+      },
+      [&](const GeomGridEval::UVPointWithSpan& thePt) {
+        gp_Pnt aPoint;
+        gp_Vec aD1U, aD1V, aD2U, aD2V, aD2UV;
+        aCache->D2Local(thePt.LocalU, thePt.LocalV, aPoint, aD1U, aD1V, aD2U, aD2V, aD2UV);
+        aResults.SetValue(thePt.OutputIdx + 1,
+                          GeomGridEval::SurfD2{aPoint, aD1U, aD1V, aD2U, aD2V, aD2UV});
+      },
+      [&](const GeomGridEval::UVPointWithSpan& thePt) {
+        gp_Pnt aPoint;
+        gp_Vec aD1U, aD1V, aD2U, aD2V, aD2UV;
+        BSplSLib::D2(thePt.U,
+                     thePt.V,
+                     thePt.USpanIdx,
+                     thePt.VSpanIdx,
+                     aPoles,
+                     aWeights,
+                     aUFlatKnots,
+                     aVFlatKnots,
+                     nullptr,
+                     nullptr,
+                     aUDegree,
+                     aVDegree,
+                     isURational,
+                     isVRational,
+                     isUPeriodic,
+                     isVPeriodic,
+                     aPoint,
+                     aD1U,
+                     aD1V,
+                     aD2U,
+                     aD2V,
+                     aD2UV);
+        aResults.SetValue(thePt.OutputIdx + 1,
+                          GeomGridEval::SurfD2{aPoint, aD1U, aD1V, aD2U, aD2V, aD2UV});
+      });
+  });
 
   return aResults;
 }
@@ -1170,44 +1321,46 @@ NCollection_Array1<GeomGridEval::SurfD3> GeomGridEval_BSplineSurface::EvaluatePo
   NCollection_Array1<GeomGridEval::SurfD3> aResults(1, aNbPoints);
 
   // D3 uses direct BSplSLib::D3 - no cache available for third derivatives
-  for (int i = 0; i < aNbPoints; ++i)
-  {
-    const GeomGridEval::UVPointWithSpan& aPt = aUVPoints.Value(i);
-
-    gp_Pnt aPoint;
-    gp_Vec aD1U, aD1V, aD2U, aD2V, aD2UV, aD3U, aD3V, aD3UUV, aD3UVV;
-
-    BSplSLib::D3(aPt.U,
-                 aPt.V,
-                 aPt.USpanIdx,
-                 aPt.VSpanIdx,
-                 aPoles,
-                 aWeights,
-                 aUFlatKnots,
-                 aVFlatKnots,
-                 nullptr,
-                 nullptr,
-                 aUDegree,
-                 aVDegree,
-                 isURational,
-                 isVRational,
-                 isUPeriodic,
-                 isVPeriodic,
-                 aPoint,
-                 aD1U,
-                 aD1V,
-                 aD2U,
-                 aD2V,
-                 aD2UV,
-                 aD3U,
-                 aD3V,
-                 aD3UUV,
-                 aD3UVV);
-
-    aResults.SetValue(
-      aPt.OutputIdx + 1,
-      GeomGridEval::SurfD3{aPoint, aD1U, aD1V, aD2U, aD2V, aD2UV, aD3U, aD3V, aD3UUV, aD3UVV});
-  }
+  evaluateByRanges(aUVPoints, [&](int theFrom, int theTo) {
+    for (int i = theFrom; i < theTo; ++i)
+    {
+      const GeomGridEval::UVPointWithSpan& aPt = aUVPoints.Value(i);
+
+      gp_Pnt aPoint;
+      gp_Vec aD1U, aD1V, aD2U, aD2V, aD2UV, aD3U, aD3V, aD3UUV, aD3UVV;
+
+      BSplSLib::D3(aPt.U,
+                   aPt.V,
+                   aPt.USpanIdx,
+                   aPt.VSpanIdx,
+                   aPoles,
+                   aWeights,
+                   aUFlatKnots,
+                   aVFlatKnots,
+                   nullptr,
+                   nullptr,
+                   aUDegree,
+                   aVDegree,
+                   isURational,
+                   isVRational,
+                   isUPeriodic,
+                   isVPeriodic,
+                   aPoint,
+                   aD1U,
+                   aD1V,
+                   aD2U,
+                   aD2V,
+                   aD2UV,
+                   aD3U,
+                   aD3V,
+                   aD3UUV,
+                   aD3UVV);
+
+      aResults.SetValue(
+        aPt.OutputIdx + 1,
+        GeomGridEval::SurfD3{aPoint, aD1U, aD1V, aD2U, aD2V, aD2UV, aD3U, aD3V, aD3UUV, aD3UVV});
+    }
+  });
 
   return aResults;
 }
@@ -1271,33 +1424,35 @@ NCollection_Array1<gp_Vec> GeomGridEval_BSplineSurface::EvaluatePointsDN(
   }
 
   // Use BSplSLib::DN directly with pre-computed span indices
-  for (int i = 0; i < aNbPoints; ++i)
-  {
-    const GeomGridEval::UVPointWithSpan& aPt = aUVPoints.Value(i);
-
-    gp_Vec aDN;
-    BSplSLib::DN(aPt.U,
-                 aPt.V,
-                 theNU,
-                 theNV,
-                 aPt.USpanIdx,
-                 aPt.VSpanIdx,
-                 aPoles,
-                 aWeights,
-                 aUFlatKnots,
-                 aVFlatKnots,
-                 nullptr,
-                 nullptr,
-                 aUDegree,
-                 aVDegree,
-                 isURational,
-                 isVRational,
-                 isUPeriodic,
-                 isVPeriodic,
-                 aDN);
-
-    aResults.SetValue(aPt.OutputIdx + 1, aDN);
-  }
+  evaluateByRanges(aUVPoints, [&](int theFrom, int theTo) {
+    for (int i = theFrom; i < theTo; ++i)
+    {
+      const GeomGridEval::UVPointWithSpan& aPt = aUVPoints.Value(i);
+
+      gp_Vec aDN;
+      BSplSLib::DN(aPt.U,
+                   aPt.V,
+                   theNU,
+                   theNV,
+                   aPt.USpanIdx,
+                   aPt.VSpanIdx,
+                   aPoles,
+                   aWeights,
+                   aUFlatKnots,
+                   aVFlatKnots,
+                   nullptr,
+                   nullptr,
+                   aUDegree,
+                   aVDegree,
+                   isURational,
+                   isVRational,
+                   isUPeriodic,
+                   isVPeriodic,
+                   aDN);
+
+      aResults.SetValue(aPt.OutputIdx + 1, aDN);
+    }
+  });
 
   return aResults;
 }
@@ -17,6 +17,7 @@
 #include <BSplSLib_Cache.hxx>
 #include <Geom_BSplineSurface.hxx>
 #include <GeomGridEval.hxx>
+#include <GeomGridEval_BSplineSurfaceBackend.hxx>
 #include <gp_Pnt2d.hxx>
 #include <NCollection_Array1.hxx>
 #include <NCollection_Array2.hxx>
@@ -31,6 +32,8 @@
 //! - Pre-computing span indices during evaluation
 //! - Sorting UV points by (USpan, VSpan, U) for cache-optimal iteration
 //! - Rebuilding cache only once per span block (not per point)
+//! - Evaluating points of a span block by vectorizable batches (BSplSLib_Cache::D0LocalBatch)
+//! - Splitting large point sets into ranges evaluated in parallel threads
 //!
 //! Usage (grid mode):
 //! @code
@@ -64,6 +67,17 @@ public:
   //! Returns the geometry handle.
   const occ::handle<Geom_BSplineSurface>& Geometry() const { return myGeom; }
 
+  //! Returns the backend used for grid evaluation (NULL by default).
+  const occ::handle<GeomGridEval_BSplineSurfaceBackend>& Backend() const { return myBackend; }
+
+  //! Sets the backend (e.g. GPU one) used by EvaluateGrid() and EvaluateGridD1().
+  //! The backend may work in reduced precision (see its documentation).
+  //! NULL backend or its refusal means evaluation on CPU.
+  void SetBackend(const occ::handle<GeomGridEval_BSplineSurfaceBackend>& theBackend)
+  {
+    myBackend = theBackend;
+  }
+
   //! Evaluate grid points at Cartesian product of U and V parameters.
   //! Points are evaluated in span-grouped order to minimize cache rebuilds.
   //! @param theUParams array of U parameter values
@@ -196,7 +210,8 @@ private:
                                               int                               theNV) const;
 
 private:
-  occ::handle<Geom_BSplineSurface> myGeom;
+  occ::handle<Geom_BSplineSurface>                myGeom;
+  occ::handle<GeomGridEval_BSplineSurfaceBackend> myBackend;
 };
 
 #endif // _GeomGridEval_BSplineSurface_HeaderFile
@@ -0,0 +1,60 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _GeomGridEval_BSplineSurfaceBackend_HeaderFile
+#define _GeomGridEval_BSplineSurfaceBackend_HeaderFile
+
+#include <Geom_BSplineSurface.hxx>
+#include <GeomGridEval.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_Array2.hxx>
+#include <Standard_Transient.hxx>
+
+//! Interface of the external (e.g. GPU) implementation of the grid evaluation
+//! of B-spline surfaces (see GeomGridEval_BSplineSurface::SetBackend()).
+//!
+//! The backend may compute in reduced precision; the accuracy it achieves should be
+//! documented by the implementation, so that only callers tolerating it set the backend.
+//! The backend may refuse the evaluation (e.g. of a periodic surface or of a grid too small
+//! to pay off the data transfer) by returning FALSE, then the grid is evaluated on CPU.
+class GeomGridEval_BSplineSurfaceBackend : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(GeomGridEval_BSplineSurfaceBackend, Standard_Transient)
+public:
+  //! Evaluates the points of the surface at Cartesian product of U and V parameters.
+  //! @param[in]  theSurface the B-spline surface to evaluate
+  //! @param[in]  theUParams array of U parameter values
+  //! @param[in]  theVParams array of V parameter values
+  //! @param[out] theGrid    grid of points, already allocated with bounds
+  //!                        [1, NbUParams] x [1, NbVParams]
+  //! @return FALSE if the grid should be evaluated on CPU
+  virtual bool EvaluateGrid(const occ::handle<Geom_BSplineSurface>& theSurface,
+                            const NCollection_Array1<double>&       theUParams,
+                            const NCollection_Array1<double>&       theVParams,
+                            NCollection_Array2<gp_Pnt>&             theGrid) = 0;
+
+  //! Evaluates the points and first partial derivatives of the surface
+  //! at Cartesian product of U and V parameters.
+  //! @param[in]  theSurface the B-spline surface to evaluate
+  //! @param[in]  theUParams array of U parameter values
+  //! @param[in]  theVParams array of V parameter values
+  //! @param[out] theGrid    grid of results, already allocated with bounds
+  //!                        [1, NbUParams] x [1, NbVParams]
+  //! @return FALSE if the grid should be evaluated on CPU
+  virtual bool EvaluateGridD1(const occ::handle<Geom_BSplineSurface>&   theSurface,
+                              const NCollection_Array1<double>&         theUParams,
+                              const NCollection_Array1<double>&         theVParams,
+                              NCollection_Array2<GeomGridEval::SurfD1>& theGrid) = 0;
+};
+
+#endif // _GeomGridEval_BSplineSurfaceBackend_HeaderFile
@@ -292,7 +292,7 @@ void GeomGridEval_Surface::Initialize(const occ::handle<Geom_Surface>& theSurfac
   else if (auto aBSpline = occ::down_cast<Geom_BSplineSurface>(aBasisSurf))
   {
     mySurfaceType = GeomAbs_BSplineSurface;
-    myEvaluator.emplace<GeomGridEval_BSplineSurface>(aBSpline);
+    myEvaluator.emplace<GeomGridEval_BSplineSurface>(aBSpline).SetBackend(myBSplineBackend);
   }
   else if (auto anOffset = occ::down_cast<Geom_OffsetSurface>(aBasisSurf))
   {
@@ -116,6 +116,19 @@ public:
   //! Returns true if properly initialized.
   Standard_EXPORT bool IsInitialized() const;
 
+  //! Returns the backend used for grid evaluation of B-spline surfaces (NULL by default).
+  const occ::handle<GeomGridEval_BSplineSurfaceBackend>& BSplineBackend() const
+  {
+    return myBSplineBackend;
+  }
+
+  //! Sets the backend (e.g. GPU one) used for grid evaluation of B-spline surfaces
+  //! (see GeomGridEval_BSplineSurface::SetBackend()). Applies to the next Initialize().
+  void SetBSplineBackend(const occ::handle<GeomGridEval_BSplineSurfaceBackend>& theBackend)
+  {
+    myBSplineBackend = theBackend;
+  }
+
   //! Evaluate grid points at all specified parameters.
   //! @param[in] theUParams array of U parameter values
   //! @param[in] theVParams array of V parameter values
@@ -238,6 +251,9 @@ private:
   EvaluatorVariant       myEvaluator;
   GeomAbs_SurfaceType    mySurfaceType;
   std::optional<gp_Trsf> myTrsf; //!< Optional transformation for BRepAdaptor surfaces
+
+  //! Backend for grid evaluation of B-spline surfaces
+  occ::handle<GeomGridEval_BSplineSurfaceBackend> myBSplineBackend;
 };
 
 #endif // _GeomGridEval_Surface_HeaderFile
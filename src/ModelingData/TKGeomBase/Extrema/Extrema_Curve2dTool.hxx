@@ -84,6 +84,17 @@ public:
     theC.D0(theU, theP);
   }
 
+  //! Computes the points of a batch of parameters on the curve.
+  static void D0(const Adaptor2d_Curve2d&          theC,
+                 const NCollection_Array1<double>& theParams,
+                 NCollection_Array1<gp_Pnt2d>&     thePoints)
+  {
+    for (int anIndex = theParams.Lower(); anIndex <= theParams.Upper(); ++anIndex)
+    {
+      theC.D0(theParams(anIndex), thePoints(anIndex - theParams.Lower() + thePoints.Lower()));
+    }
+  }
+
   //! Computes the point of parameter U on the curve with its first derivative.
   static void D1(const Adaptor2d_Curve2d& theC, const double theU, gp_Pnt2d& theP, gp_Vec2d& theV)
   {
@@ -86,6 +86,14 @@ public:
     theC.D0(theU, theP);
   }
 
+  //! Computes the points of a batch of parameters on the curve.
+  static void D0(const Adaptor3d_Curve&            theC,
+                 const NCollection_Array1<double>& theParams,
+                 NCollection_Array1<gp_Pnt>&       thePoints)
+  {
+    theC.EvaluateD0(theParams, thePoints);
+  }
+
   static void D1(const Adaptor3d_Curve& theC, const double theU, gp_Pnt& theP, gp_Vec& theV)
   {
     theC.D1(theU, theP, theV);
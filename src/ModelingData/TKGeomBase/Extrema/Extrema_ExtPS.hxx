@@ -127,6 +127,13 @@ public:
 
   Standard_EXPORT void SetAlgo(const Extrema_ExtAlgo A);
 
+  //! Sets the cache of the sampling grids of general surfaces shared with other projectors
+  //! (see Extrema_GenExtPS::SetGridCache()).
+  void SetGridCache(const occ::handle<Extrema_GenExtPSCache>& theCache)
+  {
+    myExtPS.SetGridCache(theCache);
+  }
+
 private:
   Standard_EXPORT void TreatSolution(const Extrema_POnSurf& PS, const double Val);
 
@@ -313,15 +313,21 @@ public:
             double aStep = (aL - aF) / mysample;
             for (int aPntIdx = 0; aPntIdx < mysample; aPntIdx++)
             {
-              double aCurrentParam = aF + aStep * aPntIdx;
-              aVal(aValIdx)   = TheCurveTool::Value(aCurve, aCurrentParam).SquareDistance(theP);
-              aParam(aValIdx) = aCurrentParam;
+              aParam(aValIdx) = aF + aStep * aPntIdx;
               aValIdx++;
             }
           }
-          aVal(aValIdx)   = TheCurveTool::Value(aCurve, myusup).SquareDistance(theP);
           aParam(aValIdx) = myusup;
 
+          // sample parameters are sorted by spans, so the batch evaluation
+          // rebuilds the cache of the B-spline once per span
+          NCollection_Array1<ThePoint> aSamples(aParam.Lower(), aParam.Upper());
+          TheCurveTool::D0(aCurve, aParam, aSamples);
+          for (anIdx = aVal.Lower(); anIdx <= aVal.Upper(); anIdx++)
+          {
+            aVal(anIdx) = aSamples(anIdx).SquareDistance(theP);
+          }
+
           myExtPC.Initialize(aCurve);
 
           for (anIdx = aVal.Lower() + 1; anIdx < aVal.Upper(); anIdx++)
@@ -330,7 +336,7 @@ public:
             {
               mySqDist.Append(aVal(anIdx));
               myismin.Append(true);
-              mypoint.Append(ThePOnC(aParam(anIdx), TheCurveTool::Value(aCurve, aParam(anIdx))));
+              mypoint.Append(ThePOnC(aParam(anIdx), aSamples(anIdx)));
             }
             if ((aVal(anIdx) >= aVal(anIdx + 1) && aVal(anIdx) >= aVal(anIdx - 1))
                 || (aVal(anIdx) <= aVal(anIdx + 1) && aVal(anIdx) <= aVal(anIdx - 1)))
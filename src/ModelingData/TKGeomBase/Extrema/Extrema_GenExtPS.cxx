@@ -35,6 +35,7 @@
 #include <Geom_BSplineCurve.hxx>
 #include <Geom_BSplineSurface.hxx>
 #include <Geom_OffsetSurface.hxx>
+#include <GeomAdaptor_Surface.hxx>
 #include <gp_Pnt.hxx>
 #include <math_FunctionSetRoot.hxx>
 #include <math_NewtonFunctionSetRoot.hxx>
@@ -507,59 +508,112 @@ const Extrema_POnSurfParams& Extrema_GenExtPS::ComputeEdgeParameters(
   }
 }
 
+//=================================================================================================
+
+occ::handle<Geom_Surface> Extrema_GenExtPS::gridCacheKey(Extrema_GenExtPSCache::Key& theKey) const
+{
+  const GeomAdaptor_Surface* aGeomAdaptor = dynamic_cast<const GeomAdaptor_Surface*>(myS);
+  if (myGridCache.IsNull() || aGeomAdaptor == nullptr)
+  {
+    return occ::handle<Geom_Surface>();
+  }
+
+  theKey.UMin = myumin;
+  theKey.UMax = myusup;
+  theKey.VMin = myvmin;
+  theKey.VMax = myvsup;
+  theKey.NbU  = myusample;
+  theKey.NbV  = myvsample;
+  theKey.Algo = myAlgo;
+  return aGeomAdaptor->Surface();
+}
+
+//=================================================================================================
+
+NCollection_Handle<Extrema_GenExtPSCache::Grid> Extrema_GenExtPS::buildGridPoints()
+{
+  // build parametric grid in case of a complex surface geometry (BSpline and Bezier surfaces)
+  GetGridPoints(*myS);
+
+  // build grid in other cases
+  if (myUParams.IsNull())
+  {
+    double PasU = myusup - myumin;
+    double U0   = PasU / myusample / 100.;
+    PasU        = (PasU - U0) / (myusample - 1);
+    U0          = U0 / 2. + myumin;
+    myUParams   = new NCollection_HArray1<double>(1, myusample);
+    double U    = U0;
+    for (int NoU = 1; NoU <= myusample; NoU++, U += PasU)
+      myUParams->SetValue(NoU, U);
+  }
+
+  if (myVParams.IsNull())
+  {
+    double PasV = myvsup - myvmin;
+    double V0   = PasV / myvsample / 100.;
+    PasV        = (PasV - V0) / (myvsample - 1);
+    V0          = V0 / 2. + myvmin;
+
+    myVParams = new NCollection_HArray1<double>(1, myvsample);
+    double V  = V0;
+    for (int NoV = 1; NoV <= myvsample; NoV++, V += PasV)
+      myVParams->SetValue(NoV, V);
+  }
+
+  GeomGridEval_Surface aGridEval;
+  aGridEval.Initialize(*myS);
+
+  NCollection_Handle<Extrema_GenExtPSCache::Grid> aGrid = new Extrema_GenExtPSCache::Grid();
+  aGrid->Points = aGridEval.EvaluateGrid(myUParams->Array1(), myVParams->Array1());
+  if (aGrid->Points.IsEmpty())
+  {
+    return NCollection_Handle<Extrema_GenExtPSCache::Grid>();
+  }
+  aGrid->UParams = myUParams;
+  aGrid->VParams = myVParams;
+  return aGrid;
+}
+
+//=================================================================================================
+
 void Extrema_GenExtPS::BuildGrid(const gp_Pnt& thePoint)
 {
   // if grid was already built skip its creation
   if (!myInit)
   {
-    // build parametric grid in case of a complex surface geometry (BSpline and Bezier surfaces)
-    GetGridPoints(*myS);
-
-    // build grid in other cases
-    if (myUParams.IsNull())
+    Extrema_GenExtPSCache::Key                      aKey;
+    const occ::handle<Geom_Surface>                 aCacheSurf = gridCacheKey(aKey);
+    NCollection_Handle<Extrema_GenExtPSCache::Grid> aGrid;
+    if (!aCacheSurf.IsNull())
     {
-      double PasU = myusup - myumin;
-      double U0   = PasU / myusample / 100.;
-      PasU        = (PasU - U0) / (myusample - 1);
-      U0          = U0 / 2. + myumin;
-      myUParams   = new NCollection_HArray1<double>(1, myusample);
-      double U    = U0;
-      for (int NoU = 1; NoU <= myusample; NoU++, U += PasU)
-        myUParams->SetValue(NoU, U);
+      aGrid = myGridCache->Find(aCacheSurf, aKey);
     }
-
-    if (myVParams.IsNull())
+    if (aGrid.IsNull())
     {
-      double PasV = myvsup - myvmin;
-      double V0   = PasV / myvsample / 100.;
-      PasV        = (PasV - V0) / (myvsample - 1);
-      V0          = V0 / 2. + myvmin;
-
-      myVParams = new NCollection_HArray1<double>(1, myvsample);
-      double V  = V0;
-      for (int NoV = 1; NoV <= myvsample; NoV++, V += PasV)
-        myVParams->SetValue(NoV, V);
+      aGrid = buildGridPoints();
+      if (aGrid.IsNull())
+      {
+        myPoints.Resize(0, myusample + 1, 0, myvsample + 1, false);
+        return;
+      }
+      if (!aCacheSurf.IsNull())
+      {
+        aGrid = myGridCache->Add(aCacheSurf, aKey, aGrid);
+      }
     }
+    myUParams = aGrid->UParams;
+    myVParams = aGrid->VParams;
+    myusample = myUParams->Length();
+    myvsample = myVParams->Length();
 
     // If flag was changed and extrema not reinitialized Extrema would fail
     myPoints.Resize(0, myusample + 1, 0, myvsample + 1, false);
-
-    GeomGridEval_Surface aGridEval;
-    aGridEval.Initialize(*myS);
-
-    NCollection_Array2<gp_Pnt> aGridPoints =
-      aGridEval.EvaluateGrid(myUParams->Array1(), myVParams->Array1());
-
-    if (aGridPoints.IsEmpty())
-    {
-      return;
-    }
-
     for (int NoU = 1; NoU <= myusample; NoU++)
     {
       for (int NoV = 1; NoV <= myvsample; NoV++)
       {
-        const gp_Pnt&         aP1 = aGridPoints.Value(NoU, NoV);
+        const gp_Pnt&         aP1 = aGrid->Points.Value(NoU, NoV);
         Extrema_POnSurfParams aParam(myUParams->Value(NoU), myVParams->Value(NoV), aP1);
         aParam.SetElementType(Extrema_Node);
         aParam.SetIndices(NoU, NoV);
@@ -834,6 +888,37 @@ void Extrema_GenExtPS::BuildTree()
   if (!mySphereUBTree.IsNull())
     return;
 
+  Extrema_GenExtPSCache::Key      aKey;
+  const occ::handle<Geom_Surface> aCacheSurf = gridCacheKey(aKey);
+  if (!aCacheSurf.IsNull())
+  {
+    NCollection_Handle<Extrema_GenExtPSCache::Grid> aGrid = myGridCache->Find(aCacheSurf, aKey);
+    if (aGrid.IsNull())
+    {
+      buildSphereTree();
+      aGrid             = new Extrema_GenExtPSCache::Grid();
+      aGrid->UParams    = myUParams;
+      aGrid->VParams    = myVParams;
+      aGrid->SphereTree = mySphereUBTree;
+      aGrid->Spheres    = mySphereArray;
+      aGrid             = myGridCache->Add(aCacheSurf, aKey, aGrid);
+    }
+    // the tree is only read by the selection, thus it is shared by the projectors
+    myUParams      = aGrid->UParams;
+    myVParams      = aGrid->VParams;
+    mySphereUBTree = aGrid->SphereTree;
+    mySphereArray  = aGrid->Spheres;
+    myusample      = myUParams->Length();
+    myvsample      = myVParams->Length();
+    return;
+  }
+  buildSphereTree();
+}
+
+//=================================================================================================
+
+void Extrema_GenExtPS::buildSphereTree()
+{
   if (myS->GetType() == GeomAbs_BSplineSurface)
   {
     occ::handle<Geom_BSplineSurface> aBspl   = myS->BSpline();
@@ -27,6 +27,7 @@
 #include <Extrema_FuncPSNorm.hxx>
 #include <Extrema_ExtFlag.hxx>
 #include <Extrema_ExtAlgo.hxx>
+#include <Extrema_GenExtPSCache.hxx>
 
 class Adaptor3d_Surface;
 
@@ -115,6 +116,15 @@ public:
 
   Standard_EXPORT void SetAlgo(const Extrema_ExtAlgo A);
 
+  //! Sets the cache of the sampling grids shared with other projectors (may be NULL).
+  //! The grid of the surface given by GeomAdaptor_Surface is then taken from the cache
+  //! if it has been built by another projector with the same sampling, or stored there.
+  //! Other adaptors are not cached, as their geometry has no identity.
+  void SetGridCache(const occ::handle<Extrema_GenExtPSCache>& theCache) { myGridCache = theCache; }
+
+  //! Returns the cache of the sampling grids (NULL by default).
+  const occ::handle<Extrema_GenExtPSCache>& GridCache() const { return myGridCache; }
+
   //! Returns True if the distances are found.
   Standard_EXPORT bool IsDone() const;
 
@@ -130,6 +140,9 @@ public:
 private:
   Standard_EXPORT void BuildTree();
 
+  //! Builds the tree of the spheres of the grid points of the tree algorithm.
+  void buildSphereTree();
+
   Standard_EXPORT void FindSolution(const gp_Pnt& P, const Extrema_POnSurfParams& theParams);
 
   //! Selection of points to build grid, depending on the type of surface
@@ -138,6 +151,14 @@ private:
   //! Creation of grid of parametric points
   Standard_EXPORT void BuildGrid(const gp_Pnt& thePoint);
 
+  //! Evaluates the grid of surface points of the gradient algorithm.
+  //! @return NULL if the surface cannot be evaluated
+  NCollection_Handle<Extrema_GenExtPSCache::Grid> buildGridPoints();
+
+  //! Returns the surface identifying the grid in the cache with the current sampling,
+  //! or NULL if the grid is not cached.
+  occ::handle<Geom_Surface> gridCacheKey(Extrema_GenExtPSCache::Key& theKey) const;
+
   //! Compute new edge parameters.
   Standard_EXPORT const Extrema_POnSurfParams& ComputeEdgeParameters(
     const bool                   IsUEdge,
@@ -176,6 +197,7 @@ private:
   NCollection_Array2<Extrema_POnSurfParams>               myUEdgePntParams;
   NCollection_Array2<Extrema_POnSurfParams>               myVEdgePntParams;
   Extrema_POnSurfParams                                   myGridParam;
+  occ::handle<Extrema_GenExtPSCache>                      myGridCache;
 };
 
 #endif // _Extrema_GenExtPS_HeaderFile
@@ -0,0 +1,120 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <Extrema_GenExtPSCache.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(Extrema_GenExtPSCache, Standard_Transient)
+
+//=================================================================================================
+
+Extrema_GenExtPSCache::Extrema_GenExtPSCache()
+    : myNbEntries(0),
+      myNbHits(0),
+      myNbMisses(0)
+{
+}
+
+//=================================================================================================
+
+NCollection_Handle<Extrema_GenExtPSCache::Grid> Extrema_GenExtPSCache::findInList(
+  const GridList& theList,
+  const Key&      theKey)
+{
+  for (GridList::Iterator anIt(theList); anIt.More(); anIt.Next())
+  {
+    if (anIt.Value().first.IsEqual(theKey))
+    {
+      return anIt.Value().second;
+    }
+  }
+  return NCollection_Handle<Grid>();
+}
+
+//=================================================================================================
+
+NCollection_Handle<Extrema_GenExtPSCache::Grid> Extrema_GenExtPSCache::Find(
+  const occ::handle<Geom_Surface>& theSurface,
+  const Key&                       theKey)
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  if (const GridList* aList = myGrids.Seek(theSurface))
+  {
+    NCollection_Handle<Grid> aGrid = findInList(*aList, theKey);
+    if (!aGrid.IsNull())
+    {
+      ++myNbHits;
+    }
+    return aGrid;
+  }
+  return NCollection_Handle<Grid>();
+}
+
+//=================================================================================================
+
+NCollection_Handle<Extrema_GenExtPSCache::Grid> Extrema_GenExtPSCache::Add(
+  const occ::handle<Geom_Surface>& theSurface,
+  const Key&                       theKey,
+  const NCollection_Handle<Grid>&  theGrid)
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  ++myNbMisses;
+  GridList* aList = myGrids.ChangeSeek(theSurface);
+  if (aList == nullptr)
+  {
+    aList = myGrids.Bound(theSurface, GridList());
+  }
+  else
+  {
+    const NCollection_Handle<Grid> aStored = findInList(*aList, theKey);
+    if (!aStored.IsNull())
+    {
+      return aStored;
+    }
+  }
+  aList->Append(std::make_pair(theKey, theGrid));
+  ++myNbEntries;
+  return theGrid;
+}
+
+//=================================================================================================
+
+void Extrema_GenExtPSCache::Clear()
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  myGrids.Clear();
+  myNbEntries = 0;
+}
+
+//=================================================================================================
+
+int Extrema_GenExtPSCache::NbEntries() const
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  return myNbEntries;
+}
+
+//=================================================================================================
+
+std::size_t Extrema_GenExtPSCache::NbHits() const
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  return myNbHits;
+}
+
+//=================================================================================================
+
+std::size_t Extrema_GenExtPSCache::NbMisses() const
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  return myNbMisses;
+}
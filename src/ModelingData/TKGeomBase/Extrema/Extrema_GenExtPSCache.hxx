@@ -0,0 +1,123 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _Extrema_GenExtPSCache_HeaderFile
+#define _Extrema_GenExtPSCache_HeaderFile
+
+#include <Bnd_Sphere.hxx>
+#include <Extrema_ExtAlgo.hxx>
+#include <Geom_Surface.hxx>
+#include <gp_Pnt.hxx>
+#include <NCollection_Array2.hxx>
+#include <NCollection_DataMap.hxx>
+#include <NCollection_Handle.hxx>
+#include <NCollection_HArray1.hxx>
+#include <NCollection_List.hxx>
+#include <NCollection_UBTree.hxx>
+#include <Standard_Transient.hxx>
+
+#include <mutex>
+
+//! Thread-safe cache of the sampling grids of Extrema_GenExtPS
+//! (see Extrema_GenExtPS::SetGridCache()), so that the projectors of points
+//! on the same surface, created one per point or one per thread, evaluate the grid
+//! of surface points (and build the tree of them) once instead of once per projector.
+//!
+//! The grids are identified by the handle of the surface, the parametric range,
+//! the requested numbers of samples and the algorithm; the cache keeps the surfaces alive,
+//! and should be cleared if a cached surface is modified.
+//! The grid is built outside of the lock, so that building the grids of different surfaces
+//! does not block the other threads; the grid stored first is kept if the same grid
+//! has been built concurrently.
+class Extrema_GenExtPSCache : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(Extrema_GenExtPSCache, Standard_Transient)
+public:
+  //! Parameters of the sampling of the surface.
+  struct Key
+  {
+    double          UMin;
+    double          UMax;
+    double          VMin;
+    double          VMax;
+    int             NbU;
+    int             NbV;
+    Extrema_ExtAlgo Algo;
+
+    bool IsEqual(const Key& theOther) const
+    {
+      return UMin == theOther.UMin && UMax == theOther.UMax && VMin == theOther.VMin
+             && VMax == theOther.VMax && NbU == theOther.NbU && NbV == theOther.NbV
+             && Algo == theOther.Algo;
+    }
+  };
+
+  //! Sampling grid of the surface, not modified once stored in the cache.
+  struct Grid
+  {
+    occ::handle<NCollection_HArray1<double>> UParams; //!< parameters of the grid along U
+    occ::handle<NCollection_HArray1<double>> VParams; //!< parameters of the grid along V
+    //! points of the grid with bounds [1, NbU] x [1, NbV] (gradient algorithm)
+    NCollection_Array2<gp_Pnt>                              Points;
+    //! tree of the spheres of the grid points (tree algorithm)
+    NCollection_Handle<NCollection_UBTree<int, Bnd_Sphere>> SphereTree;
+    //! spheres of the grid points indexed by the tree (tree algorithm)
+    occ::handle<NCollection_HArray1<Bnd_Sphere>>            Spheres;
+  };
+
+public:
+  //! Empty constructor.
+  Standard_EXPORT Extrema_GenExtPSCache();
+
+  //! Returns the grid stored for the surface and the sampling, or NULL.
+  Standard_EXPORT NCollection_Handle<Grid> Find(const occ::handle<Geom_Surface>& theSurface,
+                                                const Key&                       theKey);
+
+  //! Stores the grid built for the surface and the sampling.
+  //! @return the grid stored concurrently by another thread, if any, or the given grid
+  Standard_EXPORT NCollection_Handle<Grid> Add(const occ::handle<Geom_Surface>& theSurface,
+                                               const Key&                       theKey,
+                                               const NCollection_Handle<Grid>&  theGrid);
+
+  //! Removes all grids.
+  Standard_EXPORT void Clear();
+
+  //! Returns the number of stored grids.
+  Standard_EXPORT int NbEntries() const;
+
+  //! Returns the number of requests which have found the grid.
+  Standard_EXPORT std::size_t NbHits() const;
+
+  //! Returns the number of stored grids built by the projectors.
+  Standard_EXPORT std::size_t NbMisses() const;
+
+private:
+  //! Grids of one surface with their sampling parameters.
+  using GridList = NCollection_List<std::pair<Key, NCollection_Handle<Grid>>>;
+
+  //! Returns the grid of the list with the key, or NULL; the lock should be taken.
+  static NCollection_Handle<Grid> findInList(const GridList& theList, const Key& theKey);
+
+private:
+  Extrema_GenExtPSCache(const Extrema_GenExtPSCache&)            = delete;
+  Extrema_GenExtPSCache& operator=(const Extrema_GenExtPSCache&) = delete;
+
+private:
+  NCollection_DataMap<occ::handle<Geom_Surface>, GridList> myGrids;
+  int                                                     myNbEntries;
+  mutable std::mutex                                      myMutex;
+  std::size_t                                             myNbHits;
+  std::size_t                                             myNbMisses;
+};
+
+#endif // _Extrema_GenExtPSCache_HeaderFile
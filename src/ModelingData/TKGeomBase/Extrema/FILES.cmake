@@ -67,6 +67,8 @@ set(OCCT_Extrema_FILES
   Extrema_GGenExtPC.hxx
   Extrema_GenExtPS.cxx
   Extrema_GenExtPS.hxx
+  Extrema_GenExtPSCache.cxx
+  Extrema_GenExtPSCache.hxx
   Extrema_GenExtSS.cxx
   Extrema_GenExtSS.hxx
   Extrema_GenLocateExtCC.hxx
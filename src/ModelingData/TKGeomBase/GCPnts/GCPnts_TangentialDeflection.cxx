@@ -43,6 +43,14 @@ inline static void D2(const Adaptor3d_Curve& C, const double U, gp_Pnt& P, gp_Ve
   C.D2(U, P, V1, V2);
 }
 
+//! Computes the points of a batch of parameters at once.
+inline static void D0(const Adaptor3d_Curve&            C,
+                      const NCollection_Array1<double>& theParams,
+                      NCollection_Array1<gp_Pnt>&       thePoints)
+{
+  C.EvaluateD0(theParams, thePoints);
+}
+
 static void D0(const Adaptor2d_Curve2d& C, const double U, gp_Pnt& PP)
 {
   double   X, Y;
@@ -52,6 +60,16 @@ static void D0(const Adaptor2d_Curve2d& C, const double U, gp_Pnt& PP)
   PP.SetCoord(X, Y, 0.0);
 }
 
+static void D0(const Adaptor2d_Curve2d&          C,
+               const NCollection_Array1<double>& theParams,
+               NCollection_Array1<gp_Pnt>&       thePoints)
+{
+  for (int i = theParams.Lower(); i <= theParams.Upper(); ++i)
+  {
+    D0(C, theParams(i), thePoints(i));
+  }
+}
+
 static void D2(const Adaptor2d_Curve2d& C, const double U, gp_Pnt& PP, gp_Vec& VV1, gp_Vec& VV2)
 {
   double   X, Y;
@@ -326,25 +344,28 @@ void GCPnts_TangentialDeflection::EvaluateDu(const TheCurve& theC,
 template <class TheCurve>
 void GCPnts_TangentialDeflection::PerformLinear(const TheCurve& theC)
 {
-  gp_Pnt P;
-  D0(theC, myFirstu, P);
-  myParameters.Append(myFirstu);
-  myPoints.Append(P);
+  const int                  aNbPnts = std::max(myMinNbPnts, 2);
+  NCollection_Array1<double> aParams(1, aNbPnts);
+  aParams(1) = myFirstu;
   if (myMinNbPnts > 2)
   {
     double Du = (myLastU - myFirstu) / myMinNbPnts;
     double U  = myFirstu + Du;
     for (int i = 2; i < myMinNbPnts; i++)
     {
-      D0(theC, U, P);
-      myParameters.Append(U);
-      myPoints.Append(P);
+      aParams(i) = U;
       U += Du;
     }
   }
-  D0(theC, myLastU, P);
-  myParameters.Append(myLastU);
-  myPoints.Append(P);
+  aParams(aNbPnts) = myLastU;
+
+  NCollection_Array1<gp_Pnt> aPoints(1, aNbPnts);
+  D0(theC, aParams, aPoints);
+  for (int i = 1; i <= aNbPnts; i++)
+  {
+    myParameters.Append(aParams(i));
+    myPoints.Append(aPoints(i));
+  }
 }
 
 //=================================================================================================
@@ -365,19 +386,22 @@ void GCPnts_TangentialDeflection::PerformCircular(const TheCurve& theC)
   NbPoints     = std::max(NbPoints, myMinNbPnts - 1);
   Du           = aDiff / NbPoints;
 
-  gp_Pnt P;
-  double U = myFirstu;
+  NCollection_Array1<double> aParams(1, NbPoints + 1);
+  double                     U = myFirstu;
   for (int i = 1; i <= NbPoints; i++)
   {
-    D0(theC, U, P);
-    myParameters.Append(U);
-    myPoints.Append(P);
+    aParams(i) = U;
     U += Du;
   }
+  aParams(NbPoints + 1) = myLastU;
 
-  D0(theC, myLastU, P);
-  myParameters.Append(myLastU);
-  myPoints.Append(P);
+  NCollection_Array1<gp_Pnt> aPoints(1, NbPoints + 1);
+  D0(theC, aParams, aPoints);
+  for (int i = 1; i <= NbPoints + 1; i++)
+  {
+    myParameters.Append(aParams(i));
+    myPoints.Append(aPoints(i));
+  }
 }
 
 //=================================================================================================
@@ -0,0 +1,124 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <Extrema_ExtPS.hxx>
+#include <Extrema_GenExtPSCache.hxx>
+#include <Geom_BSplineSurface.hxx>
+#include <GeomAdaptor_Surface.hxx>
+#include <gp_Pnt.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_Array2.hxx>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+namespace
+{
+//! Creates a wavy cubic B-spline surface.
+occ::handle<Geom_BSplineSurface> createWavySurface()
+{
+  NCollection_Array2<gp_Pnt> aPoles(1, 6, 1, 6);
+  for (int i = 1; i <= 6; ++i)
+  {
+    for (int j = 1; j <= 6; ++j)
+    {
+      aPoles.SetValue(i, j, gp_Pnt(i, j, std::sin(1.3 * i) * std::cos(0.9 * j)));
+    }
+  }
+  NCollection_Array1<double> aKnots(1, 4);
+  NCollection_Array1<int>    aMults(1, 4);
+  for (int i = 1; i <= 4; ++i)
+  {
+    aKnots(i) = (i - 1) / 3.;
+    aMults(i) = 1;
+  }
+  aMults(1) = 4;
+  aMults(4) = 4;
+  return new Geom_BSplineSurface(aPoles, aKnots, aKnots, aMults, aMults, 3, 3);
+}
+
+//! Projects the points on the surface and returns the minimal distances.
+NCollection_Array1<double> projectPoints(const occ::handle<Geom_Surface>&          theSurface,
+                                         const NCollection_Array1<gp_Pnt>&         thePoints,
+                                         const Extrema_ExtAlgo                     theAlgo,
+                                         const occ::handle<Extrema_GenExtPSCache>& theCache)
+{
+  NCollection_Array1<double> aDistances(thePoints.Lower(), thePoints.Upper());
+  for (int i = thePoints.Lower(); i <= thePoints.Upper(); ++i)
+  {
+    // one projector per point, as done by many algorithms
+    GeomAdaptor_Surface anAdaptor(theSurface);
+    Extrema_ExtPS       anExtPS;
+    anExtPS.SetGridCache(theCache);
+    anExtPS.SetFlag(Extrema_ExtFlag_MIN);
+    anExtPS.SetAlgo(theAlgo);
+    anExtPS.Initialize(anAdaptor, 0., 1., 0., 1., 1.e-9, 1.e-9);
+    anExtPS.Perform(thePoints(i));
+    double aMinSqDist = RealLast();
+    for (int anExtIter = 1; anExtPS.IsDone() && anExtIter <= anExtPS.NbExt(); ++anExtIter)
+    {
+      aMinSqDist = std::min(aMinSqDist, anExtPS.SquareDistance(anExtIter));
+    }
+    aDistances(i) = std::sqrt(aMinSqDist);
+  }
+  return aDistances;
+}
+} // namespace
+
+TEST(Extrema_GenExtPSCache_Test, SharedGridGivesSameProjections)
+{
+  const occ::handle<Geom_BSplineSurface> aSurface = createWavySurface();
+  NCollection_Array1<gp_Pnt>             aPoints(1, 20);
+  for (int i = 1; i <= 20; ++i)
+  {
+    aPoints(i) = gp_Pnt(1. + 0.25 * i, 6. - 0.2 * i, 0.5 * std::cos(0.7 * i));
+  }
+
+  for (Extrema_ExtAlgo anAlgo : {Extrema_ExtAlgo_Grad, Extrema_ExtAlgo_Tree})
+  {
+    occ::handle<Extrema_GenExtPSCache> aCache = new Extrema_GenExtPSCache();
+    const NCollection_Array1<double>   aRef   = projectPoints(aSurface, aPoints, anAlgo, nullptr);
+    const NCollection_Array1<double>   aRes   = projectPoints(aSurface, aPoints, anAlgo, aCache);
+    for (int i = 1; i <= 20; ++i)
+    {
+      EXPECT_NEAR(aRef(i), aRes(i), 1.e-9);
+    }
+
+    // the grid has been built by the first projector and reused by the others
+    EXPECT_EQ(aCache->NbEntries(), 1);
+    EXPECT_EQ(aCache->NbMisses(), 1u);
+    EXPECT_EQ(aCache->NbHits(), 19u);
+  }
+}
+
+TEST(Extrema_GenExtPSCache_Test, GridsAreDistinguishedBySampling)
+{
+  const occ::handle<Geom_BSplineSurface> aSurface = createWavySurface();
+  occ::handle<Extrema_GenExtPSCache>     aCache   = new Extrema_GenExtPSCache();
+  const gp_Pnt                           aPoint(2.5, 3.5, 1.);
+
+  GeomAdaptor_Surface anAdaptor(aSurface);
+  Extrema_ExtPS       anExtPS;
+  anExtPS.SetGridCache(aCache);
+  anExtPS.Initialize(anAdaptor, 0., 1., 0., 1., 1.e-9, 1.e-9);
+  anExtPS.Perform(aPoint);
+  anExtPS.Initialize(anAdaptor, 0., 0.5, 0., 1., 1.e-9, 1.e-9);
+  anExtPS.Perform(aPoint);
+  anExtPS.SetAlgo(Extrema_ExtAlgo_Tree);
+  anExtPS.Perform(aPoint);
+  EXPECT_EQ(aCache->NbEntries(), 3);
+
+  aCache->Clear();
+  EXPECT_EQ(aCache->NbEntries(), 0);
+}
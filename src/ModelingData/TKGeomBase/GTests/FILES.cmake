@@ -4,6 +4,7 @@ set(OCCT_TKGeomBase_GTests_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
 set(OCCT_TKGeomBase_GTests_FILES
   BndLib_Test.cxx
   Extrema_ExtPC_Test.cxx
+  Extrema_GenExtPSCache_Test.cxx
   GeomConvert_CompCurveToBSplineCurve_Test.cxx
   IntAna_IntQuadQuad_Test.cxx
 )
@@ -19,6 +19,7 @@
 #include <gp_Pnt.hxx>
 #include <IVtk_Interface.hxx>
 #include <IVtk_Types.hxx>
+#include <NCollection_Array1.hxx>
 #include <NCollection_Vec3.hxx>
 
 //! @class IVtk_IShapeData
@@ -77,6 +78,56 @@ public:
                               const IVtk_PointId  thePointId3,
                               const IVtk_MeshType theMeshType = MT_Undefined) = 0;
 
+public:
+  //! Insert a block of points with consecutive ids.
+  //! Default implementation calls InsertPoint() for each point.
+  //! @param[in]  thePnts  point positions
+  //! @param[in]  theNorms point normals of the same length as thePnts,
+  //!                      or empty array to use the default (0, 0, 1) normal
+  //! @return id of the first added point
+  virtual IVtk_PointId InsertPoints(const NCollection_Array1<gp_Pnt>&                  thePnts,
+                                    const NCollection_Array1<NCollection_Vec3<float>>& theNorms)
+  {
+    IVtk_PointId aFirstId = -1;
+    for (int aPntIter = thePnts.Lower(); aPntIter <= thePnts.Upper(); ++aPntIter)
+    {
+      const IVtk_PointId anId =
+        InsertPoint(thePnts.Value(aPntIter),
+                    !theNorms.IsEmpty()
+                      ? theNorms.Value(theNorms.Lower() + aPntIter - thePnts.Lower())
+                      : NCollection_Vec3<float>(0.0f, 0.0f, 1.0f));
+      if (aFirstId == -1)
+      {
+        aFirstId = anId;
+      }
+    }
+    return aFirstId;
+  }
+
+  //! Insert a block of triangles of the same sub-shape.
+  //! Default implementation calls InsertTriangle() for each triangle.
+  //! @param[in]  theShapeID     id of the subshape to which the triangles belong
+  //! @param[in]  theTriangles   triangles defined by 0-based point indices relative to theFirstPointId
+  //! @param[in]  theFirstPointId id of the point with index 0, as returned by InsertPoints()
+  //! @param[in]  theMeshType    mesh type of the subshape (MT_Undefined by default)
+  virtual void InsertTriangles(const IVtk_IdType                                theShapeID,
+                               const NCollection_Array1<NCollection_Vec3<int>>& theTriangles,
+                               const IVtk_PointId                               theFirstPointId,
+                               const IVtk_MeshType theMeshType = MT_Undefined)
+  {
+    for (NCollection_Array1<NCollection_Vec3<int>>::Iterator aTriIter(theTriangles);
+         aTriIter.More();
+         aTriIter.Next())
+    {
+      const NCollection_Vec3<int>& aTri = aTriIter.Value();
+      InsertTriangle(theShapeID,
+                     theFirstPointId + aTri[0],
+                     theFirstPointId + aTri[1],
+                     theFirstPointId + aTri[2],
+                     theMeshType);
+    }
+  }
+
 public:
   //! Insert a coordinate
   //! @param[in]  theX X coordinate
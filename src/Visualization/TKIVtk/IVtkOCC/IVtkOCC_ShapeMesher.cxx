@@ -20,6 +20,8 @@
 #include <BRepTools.hxx>
 #include <Message.hxx>
 #include <NCollection_Array1.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_Parallel.hxx>
 #include <Poly_Polygon3D.hxx>
 #include <Poly_PolygonOnTriangulation.hxx>
 #include <Poly_Triangulation.hxx>
@@ -40,6 +42,7 @@ IMPLEMENT_STANDARD_RTTIEXT(IVtkOCC_ShapeMesher, IVtk_IShapeMesher)
 //=================================================================================================
 
 IVtkOCC_ShapeMesher::IVtkOCC_ShapeMesher()
+    : myIsParallel(true)
 {
   //
 }
@@ -67,8 +70,15 @@ void IVtkOCC_ShapeMesher::internalBuild()
   if (anOcctDrawer->IsAutoTriangulation())
   {
     StdPrs_ToolTriangulatedShape::ClearOnOwnDeflectionChange(anOcctShape, anOcctDrawer, true);
-    StdPrs_ToolTriangulatedShape::Tessellate(anOcctShape, anOcctDrawer);
+    // existing triangulation fitting the deflection is reused as is
+    if (!BRepTools::Triangulation(anOcctShape, aShapeDeflection, true))
+    {
+      StdPrs_ToolTriangulatedShape::Tessellate(anOcctShape, anOcctDrawer);
+    }
   }
+
+  // normals are computed sequentially, as the triangulation might be shared by several faces
+  NCollection_Vector<TopoDS_Face> aFaces;
   for (TopExp_Explorer aFaceIter(anOcctShape, TopAbs_FACE); aFaceIter.More(); aFaceIter.Next())
   {
     const TopoDS_Face& anOcctFace = TopoDS::Face(aFaceIter.Current());
@@ -78,6 +88,7 @@ void IVtkOCC_ShapeMesher::internalBuild()
     {
       StdPrs_ToolTriangulatedShape::ComputeNormals(anOcctFace, anOcctTriangulation);
     }
+    aFaces.Append(anOcctFace);
   }
 
   // Free vertices and free edges should always be shown.
@@ -86,14 +97,25 @@ void IVtkOCC_ShapeMesher::internalBuild()
   addFreeVertices();
   addEdges();
 
+  // Extract isolines and triangles of faces
+  const int                    aNbFaces = aFaces.Length();
+  NCollection_Array1<FaceData> aFaceData(0, aNbFaces);
+  OSD_Parallel::For(
+    0,
+    aNbFaces,
+    [&](const int theIndex) {
+      computeFace(aFaces(theIndex), aShapeDeflection, aFaceData(theIndex));
+    },
+    !myIsParallel || aNbFaces < 2);
+
   // Build wireframe points and cells (lines for isolines)
-  for (TopExp_Explorer aFaceIter(anOcctShape, TopAbs_FACE); aFaceIter.More(); aFaceIter.Next())
+  for (int aFaceIter = 0; aFaceIter < aNbFaces; ++aFaceIter)
   {
-    const TopoDS_Face& anOcctFace = TopoDS::Face(aFaceIter.Current());
+    const TopoDS_Face& anOcctFace = aFaces(aFaceIter);
     try
     {
       OCC_CATCH_SIGNALS
-      addWFFace(anOcctFace, GetShapeObj()->GetSubShapeId(anOcctFace), aShapeDeflection);
+      addWFFace(anOcctFace, GetShapeObj()->GetSubShapeId(anOcctFace), aFaceData(aFaceIter));
     }
     catch (const Standard_Failure& anException)
     {
@@ -104,10 +126,9 @@ void IVtkOCC_ShapeMesher::internalBuild()
   }
 
   // Build shaded representation (based on Poly_Triangulation)
-  for (TopExp_Explorer aFaceIter(anOcctShape, TopAbs_FACE); aFaceIter.More(); aFaceIter.Next())
+  for (int aFaceIter = 0; aFaceIter < aNbFaces; ++aFaceIter)
   {
-    const TopoDS_Face& anOcctFace = TopoDS::Face(aFaceIter.Current());
-    addShadedFace(anOcctFace, GetShapeObj()->GetSubShapeId(anOcctFace));
+    addShadedFace(GetShapeObj()->GetSubShapeId(aFaces(aFaceIter)), aFaceData(aFaceIter));
   }
 }
 
@@ -251,11 +272,12 @@ void IVtkOCC_ShapeMesher::addEdge(const TopoDS_Edge&  theEdge,
     const gp_Trsf aTrsf        = aLoc.Transformation();
     const bool    hasTransform = !aLoc.IsIdentity();
 
-    NCollection_List<IVtk_PointId> aPolyPointIds;
-    const int                      aNbNodes = aPolyOnTriangulation->NbNodes();
-    for (int aJ = 0; aJ < aNbNodes; aJ++)
+    const int                                   aNbNodes = aPolyOnTriangulation->NbNodes();
+    NCollection_Array1<gp_Pnt>                  aPoints(1, aNbNodes);
+    NCollection_Array1<NCollection_Vec3<float>> aNormals(1, aNbNodes);
+    for (int aJ = 1; aJ <= aNbNodes; aJ++)
     {
-      const int aPntId = aPolyOnTriangulation->Node(aJ + 1);
+      const int aPntId = aPolyOnTriangulation->Node(aJ);
       gp_Pnt    aPoint = aTriangulation->Node(aPntId);
       gp_Dir    aNorm  = aTriangulation->HasNormals() ? aTriangulation->Normal(aPntId) : gp::DZ();
       if (hasTransform)
@@ -264,12 +286,11 @@ void IVtkOCC_ShapeMesher::addEdge(const TopoDS_Edge&  theEdge,
         aNorm.Transform(aTrsf);
       }
 
-      IVtk_PointId anId = myShapeData->InsertPoint(
-        aPoint,
-        NCollection_Vec3<float>((float)aNorm.X(), (float)aNorm.Y(), (float)aNorm.Z()));
-      aPolyPointIds.Append(anId);
+      aPoints.SetValue(aJ, aPoint);
+      aNormals.SetValue(aJ,
+                        NCollection_Vec3<float>((float)aNorm.X(), (float)aNorm.Y(), (float)aNorm.Z()));
     }
-    myShapeData->InsertLine(theShapeId, &aPolyPointIds, theMeshType);
+    addPolyline(aPoints, aNormals, theShapeId, theMeshType);
     return;
   }
 
@@ -280,9 +301,9 @@ void IVtkOCC_ShapeMesher::addEdge(const TopoDS_Edge&  theEdge,
     return;
   }
 
-  const gp_Trsf                  anEdgeTransf = aLoc.Transformation();
-  const bool                     noTransform  = aLoc.IsIdentity();
-  NCollection_List<IVtk_PointId> aPolyPointIds;
+  const gp_Trsf              anEdgeTransf = aLoc.Transformation();
+  const bool                 noTransform  = aLoc.IsIdentity();
+  NCollection_Array1<gp_Pnt> aPoints(1, aPoly3d->NbNodes());
   for (int aNodeIter = 1; aNodeIter <= aPoly3d->NbNodes(); ++aNodeIter)
   {
     gp_Pnt aPnt = aPoly3d->Nodes().Value(aNodeIter);
@@ -290,80 +311,83 @@ void IVtkOCC_ShapeMesher::addEdge(const TopoDS_Edge&  theEdge,
     {
       aPnt.Transform(anEdgeTransf);
     }
-
-    const IVtk_PointId anId = myShapeData->InsertCoordinate(aPnt);
-    aPolyPointIds.Append(anId);
+    aPoints.SetValue(aNodeIter, aPnt);
   }
-  myShapeData->InsertLine(theShapeId, &aPolyPointIds, theMeshType);
+  addPolyline(aPoints, NCollection_Array1<NCollection_Vec3<float>>(), theShapeId, theMeshType);
 }
 
 //=================================================================================================
 
-void IVtkOCC_ShapeMesher::addWFFace(const TopoDS_Face& theFace,
-                                    const IVtk_IdType  theShapeId,
-                                    const double       theDeflection)
+void IVtkOCC_ShapeMesher::addPolyline(const NCollection_Array1<gp_Pnt>&                  thePnts,
+                                      const NCollection_Array1<NCollection_Vec3<float>>& theNorms,
+                                      const IVtk_IdType                                  theShapeId,
+                                      const IVtk_MeshType theMeshType)
 {
-  if (theFace.IsNull())
+  const IVtk_PointId             aFirstId = myShapeData->InsertPoints(thePnts, theNorms);
+  NCollection_List<IVtk_PointId> aPolyPointIds;
+  for (int aPntIter = 0; aPntIter < thePnts.Length(); ++aPntIter)
   {
-    return;
+    aPolyPointIds.Append(aFirstId + aPntIter);
   }
+  myShapeData->InsertLine(theShapeId, &aPolyPointIds, theMeshType);
+}
 
-  TopoDS_Face aFaceToMesh = theFace;
-  aFaceToMesh.Orientation(TopAbs_FORWARD);
-
-  // Add face's edges here but with the face ID
-  for (TopExp_Explorer anEdgeIter(aFaceToMesh, TopAbs_EDGE); anEdgeIter.More(); anEdgeIter.Next())
-  {
-    const TopoDS_Edge& anOcctEdge = TopoDS::Edge(anEdgeIter.Current());
-    addEdge(anOcctEdge, theShapeId, myEdgesTypes(anOcctEdge));
-  }
+//=================================================================================================
 
-  TopLoc_Location                  aLoc;
-  const occ::handle<Geom_Surface>& aGeomSurf = BRep_Tool::Surface(aFaceToMesh, aLoc);
-  if (aGeomSurf.IsNull())
+void IVtkOCC_ShapeMesher::computeFace(const TopoDS_Face& theFace,
+                                      const double       theDeflection,
+                                      FaceData&          theData) const
+{
+  if (theFace.IsNull())
   {
     return;
   }
 
-  NCollection_List<occ::handle<NCollection_HSequence<gp_Pnt>>> aPolylines;
-  StdPrs_Isolines::Add(theFace, GetShapeObj()->Attributes(), theDeflection, aPolylines, aPolylines);
-  for (NCollection_List<occ::handle<NCollection_HSequence<gp_Pnt>>>::Iterator aPolyIter(aPolylines);
-       aPolyIter.More();
-       aPolyIter.Next())
+  // isolines
+  TopLoc_Location aLoc;
+  if (!BRep_Tool::Surface(theFace, aLoc).IsNull())
   {
-    const occ::handle<NCollection_HSequence<gp_Pnt>>& aPoints    = aPolyIter.Value();
-    const int                                         theNbNodes = aPoints->Length();
-    if (theNbNodes < 2)
+    try
     {
-      continue;
+      OCC_CATCH_SIGNALS
+      NCollection_List<occ::handle<NCollection_HSequence<gp_Pnt>>> aPolylines;
+      StdPrs_Isolines::Add(theFace,
+                           GetShapeObj()->Attributes(),
+                           theDeflection,
+                           aPolylines,
+                           aPolylines);
+      for (NCollection_List<occ::handle<NCollection_HSequence<gp_Pnt>>>::Iterator aPolyIter(
+             aPolylines);
+           aPolyIter.More();
+           aPolyIter.Next())
+      {
+        const occ::handle<NCollection_HSequence<gp_Pnt>>& aPoints = aPolyIter.Value();
+        if (aPoints->Length() < 2)
+        {
+          continue;
+        }
+
+        NCollection_Array1<gp_Pnt>& anIsoLine =
+          theData.IsoLines.Append(NCollection_Array1<gp_Pnt>(1, aPoints->Length()));
+        int aNodeIndex = 1;
+        for (NCollection_HSequence<gp_Pnt>::Iterator aNodeIter(*aPoints); aNodeIter.More();
+             aNodeIter.Next(), ++aNodeIndex)
+        {
+          anIsoLine.SetValue(aNodeIndex, aNodeIter.Value());
+        }
+      }
     }
-
-    NCollection_List<IVtk_PointId> aPolyPointIds;
-    for (NCollection_HSequence<gp_Pnt>::Iterator aNodeIter(*aPoints); aNodeIter.More();
-         aNodeIter.Next())
+    catch (const Standard_Failure& anException)
     {
-      const gp_Pnt&      aPnt = aNodeIter.Value();
-      const IVtk_PointId anId = myShapeData->InsertCoordinate(aPnt);
-      aPolyPointIds.Append(anId);
+      theData.IsoLines.Clear();
+      theData.Error = anException.GetMessageString();
     }
-
-    myShapeData->InsertLine(theShapeId, &aPolyPointIds, MT_IsoLine);
-  }
-}
-
-//=================================================================================================
-
-void IVtkOCC_ShapeMesher::addShadedFace(const TopoDS_Face& theFace, const IVtk_IdType theShapeId)
-{
-  if (theFace.IsNull())
-  {
-    return;
   }
 
-  TopLoc_Location                        aLoc;
+  // shaded triangles
   const occ::handle<Poly_Triangulation>& anOcctTriangulation =
     BRep_Tool::Triangulation(theFace, aLoc);
-  if (anOcctTriangulation.IsNull())
+  if (anOcctTriangulation.IsNull() || anOcctTriangulation->NbNodes() < 1)
   {
     return;
   }
@@ -372,18 +396,17 @@ void IVtkOCC_ShapeMesher::addShadedFace(const TopoDS_Face& theFace, const IVtk_I
   const gp_Trsf aTrsf        = aLoc.Transformation();
   const bool    hasTransform = !aLoc.IsIdentity();
   const bool    isMirrored   = aTrsf.VectorialPart().Determinant() < 0;
+  const bool    isReversed   = theFace.Orientation() == TopAbs_REVERSED;
 
   // Get triangulation points.
-  int aNbPoints = anOcctTriangulation->NbNodes();
-
-  // Keep inserted points id's of triangulation in an array.
-  NCollection_Array1<IVtk_PointId> aPointIds(1, aNbPoints);
-  IVtk_PointId                     anId;
+  const int aNbPoints = anOcctTriangulation->NbNodes();
+  theData.Nodes.Resize(0, aNbPoints - 1, false);
+  theData.Normals.Resize(0, aNbPoints - 1, false);
   for (int anI = 1; anI <= aNbPoints; anI++)
   {
     gp_Pnt aPoint = anOcctTriangulation->Node(anI);
     gp_Dir aNorm  = anOcctTriangulation->HasNormals() ? anOcctTriangulation->Normal(anI) : gp::DZ();
-    if ((theFace.Orientation() == TopAbs_REVERSED) ^ isMirrored)
+    if (isReversed ^ isMirrored)
     {
       aNorm.Reverse();
     }
@@ -393,19 +416,24 @@ void IVtkOCC_ShapeMesher::addShadedFace(const TopoDS_Face& theFace, const IVtk_I
       aNorm.Transform(aTrsf);
     }
 
-    // Add a point into output shape data and keep its id in the array.
-    anId = myShapeData->InsertPoint(
-      aPoint,
+    theData.Nodes.SetValue(anI - 1, aPoint);
+    theData.Normals.SetValue(
+      anI - 1,
       NCollection_Vec3<float>((float)aNorm.X(), (float)aNorm.Y(), (float)aNorm.Z()));
-    aPointIds.SetValue(anI, anId);
   }
 
   // Create triangles on the created triangulation points.
   const int aNbTriangles = anOcctTriangulation->NbTriangles();
-  int       aN1, aN2, aN3;
+  if (aNbTriangles < 1)
+  {
+    return;
+  }
+
+  theData.Triangles.Resize(0, aNbTriangles - 1, false);
+  int aN1, aN2, aN3;
   for (int anI = 1; anI <= aNbTriangles; anI++)
   {
-    if (theFace.Orientation() == TopAbs_REVERSED)
+    if (isReversed)
     {
       anOcctTriangulation->Triangle(anI).Get(aN1, aN3, aN2);
     }
@@ -413,12 +441,57 @@ void IVtkOCC_ShapeMesher::addShadedFace(const TopoDS_Face& theFace, const IVtk_I
     {
       anOcctTriangulation->Triangle(anI).Get(aN1, aN2, aN3);
     }
+    theData.Triangles.SetValue(anI - 1, NCollection_Vec3<int>(aN1 - 1, aN2 - 1, aN3 - 1));
+  }
+}
+
+//=================================================================================================
 
-    // Insert new triangle on these points into output shape data.
-    myShapeData->InsertTriangle(theShapeId,
-                                aPointIds(aN1),
-                                aPointIds(aN2),
-                                aPointIds(aN3),
-                                MT_ShadedFace);
+void IVtkOCC_ShapeMesher::addWFFace(const TopoDS_Face& theFace,
+                                    const IVtk_IdType  theShapeId,
+                                    const FaceData&    theData)
+{
+  if (theFace.IsNull())
+  {
+    return;
   }
+
+  TopoDS_Face aFaceToMesh = theFace;
+  aFaceToMesh.Orientation(TopAbs_FORWARD);
+
+  // Add face's edges here but with the face ID
+  for (TopExp_Explorer anEdgeIter(aFaceToMesh, TopAbs_EDGE); anEdgeIter.More(); anEdgeIter.Next())
+  {
+    const TopoDS_Edge& anOcctEdge = TopoDS::Edge(anEdgeIter.Current());
+    addEdge(anOcctEdge, theShapeId, myEdgesTypes(anOcctEdge));
+  }
+
+  if (!theData.Error.IsEmpty())
+  {
+    throw Standard_Failure(theData.Error.ToCString());
+  }
+
+  for (NCollection_List<NCollection_Array1<gp_Pnt>>::Iterator anIsoIter(theData.IsoLines);
+       anIsoIter.More();
+       anIsoIter.Next())
+  {
+    addPolyline(anIsoIter.Value(),
+                NCollection_Array1<NCollection_Vec3<float>>(),
+                theShapeId,
+                MT_IsoLine);
+  }
+}
+
+//=================================================================================================
+
+void IVtkOCC_ShapeMesher::addShadedFace(const IVtk_IdType theShapeId, const FaceData& theData)
+{
+  if (theData.Nodes.IsEmpty())
+  {
+    return;
+  }
+
+  // Add points into output shape data and then triangles on them.
+  const IVtk_PointId aFirstId = myShapeData->InsertPoints(theData.Nodes, theData.Normals);
+  myShapeData->InsertTriangles(theShapeId, theData.Triangles, aFirstId, MT_ShadedFace);
 }
@@ -20,7 +20,9 @@
 #include <IVtk_IShapeMesher.hxx>
 #include <gp_Pnt.hxx>
 #include <NCollection_Array1.hxx>
+#include <NCollection_HSequence.hxx>
 #include <Standard_Integer.hxx>
+#include <TCollection_AsciiString.hxx>
 #include <TopoDS.hxx>
 #include <TopoDS_Edge.hxx>
 #include <TopoDS_Face.hxx>
@@ -36,6 +38,11 @@ class Prs3d_Drawer;
 //! VTK and then result can be retrieved from this implementation as a vtkPolyData:
 //! @image html doc/img/image002.gif
 //! Then the resulting vtkPolyData can be used for initialization of VTK pipeline.
+//!
+//! Isolines and shaded triangles of faces are extracted in parallel threads into per-face buffers,
+//! which are then passed to IShapeData in the order of faces by blocks (see IVtk_IShapeData::InsertPoints()),
+//! so that the result does not depend on the number of threads.
+//! Existing triangulation satisfying the shape deflection is reused without re-tessellation.
 class IVtkOCC_ShapeMesher : public IVtk_IShapeMesher
 {
 public:
@@ -63,6 +70,12 @@ public:
   //! @return deviation angle (in radians)
   Standard_EXPORT double GetDeviationAngle() const;
 
+  //! Returns TRUE if faces are processed in parallel threads; TRUE by default.
+  bool IsParallel() const { return myIsParallel; }
+
+  //! Sets if faces should be processed in parallel threads.
+  void SetParallel(bool theIsParallel) { myIsParallel = theIsParallel; }
+
 protected:
   //! Executes the mesh generation algorithms. To be defined in implementation class.
   Standard_EXPORT void internalBuild() override;
@@ -95,24 +108,45 @@ private:
                const IVtk_IdType   theShapeId,
                const IVtk_MeshType theMeshType);
 
-  //! Generates wireframe representation of the given TopoDS_Face object
-  //! with help of OCCT algorithms. The resulting polylines are passed to IPolyData
-  //! interface and associated with the given sub-shape ID.
-  //! @param[in]  theFace TopoDS_Face object to build wireframe representation for
-  //! @param[in]  theShapeId The face' sub-shape ID
+  //! Adds the points and a polyline to IPolyData.
+  //! @param[in]  thePnts    polyline nodes
+  //! @param[in]  theNorms   nodal normals or empty array
+  //! @param[in]  theShapeId sub-shape ID of the polyline
+  //! @param[in]  theMeshType mesh type of the polyline
+  void addPolyline(const NCollection_Array1<gp_Pnt>&                  thePnts,
+                   const NCollection_Array1<NCollection_Vec3<float>>& theNorms,
+                   const IVtk_IdType                                  theShapeId,
+                   const IVtk_MeshType                                theMeshType);
+
+  //! Per-face data extracted in parallel and passed to IPolyData afterwards.
+  struct FaceData
+  {
+    NCollection_List<NCollection_Array1<gp_Pnt>> IsoLines;  //!< wireframe isolines
+    NCollection_Array1<gp_Pnt>                  Nodes;     //!< transformed triangulation nodes
+    NCollection_Array1<NCollection_Vec3<float>> Normals;   //!< oriented nodal normals
+    NCollection_Array1<NCollection_Vec3<int>>   Triangles; //!< oriented triangles (0-based nodes)
+    TCollection_AsciiString                     Error;     //!< isolines builder failure
+  };
+
+  //! Computes isolines and shaded representation of the face without modifying IPolyData;
+  //! can be called from several threads.
+  //! @param[in]  theFace       face to process
   //! @param[in]  theDeflection curve deflection
-  void addWFFace(const TopoDS_Face& theFace,
-                 const IVtk_IdType  theShapeId,
-                 const double       theDeflection);
-
-  //! Creates shaded representation of the given TopoDS_Face object
-  //! starting from OCCT triangulation that should be created in advance.
-  //! The resulting triangles are passed to IPolyData
-  //! interface and associated with the given sub-shape ID.
-  //! @param[in]  theFace    TopoDS_Face object to build shaded representation for
+  //! @param[out] theData       face data
+  void computeFace(const TopoDS_Face& theFace, const double theDeflection, FaceData& theData) const;
+
+  //! Passes wireframe representation of the face (its edges and isolines) to IPolyData
+  //! and associates it with the given sub-shape ID.
+  //! @param[in]  theFace    face to add
+  //! @param[in]  theShapeId the face' sub-shape ID
+  //! @param[in]  theData    face data computed by computeFace()
+  void addWFFace(const TopoDS_Face& theFace, const IVtk_IdType theShapeId, const FaceData& theData);
+
+  //! Passes the triangles of the face computed by computeFace() to IPolyData
+  //! and associates them with the given sub-shape ID.
   //! @param[in]  theShapeId the face' sub-shape ID
-  //! @see IVtkOCC_ShapeMesher::meshShape, IVtkOCC_ShapeMesher::addEdge
-  void addShadedFace(const TopoDS_Face& theFace, const IVtk_IdType theShapeId);
+  //! @param[in]  theData    face data computed by computeFace()
+  void addShadedFace(const IVtk_IdType theShapeId, const FaceData& theData);
 
   //! Get the IShape as OCC implementation
   const IVtkOCC_Shape::Handle GetShapeObj() const;
@@ -121,6 +155,7 @@ private:
 
 private:
   NCollection_DataMap<TopoDS_Shape, IVtk_MeshType, TopTools_ShapeMapHasher> myEdgesTypes;
+  bool                                                                      myIsParallel;
 };
 
 #endif //  __IVTKOCC_SHAPEMESHER_H__
@@ -15,12 +15,13 @@
 
 #include <IVtkVTK_ShapeData.hxx>
 
+#include <NCollection_LocalArray.hxx>
+
 // prevent disabling some MSVC warning messages by VTK headers
 #include <Standard_WarningsDisable.hxx>
 #include <vtkCellData.h>
 #include <vtkDoubleArray.h>
 #include <vtkFloatArray.h>
-#include <vtkIdList.h>
 #include <vtkPointData.h>
 #include <vtkPoints.h>
 #include <vtkPolyData.h>
@@ -101,17 +102,16 @@ void IVtkVTK_ShapeData::InsertLine(const IVtk_IdType                     theShap
 {
   if (!thePointIds->IsEmpty())
   {
-    vtkSmartPointer<vtkIdList> anIdList = vtkSmartPointer<vtkIdList>::New();
-    // Fill the vtk id list by ids from NCollection_List<IVtk_PointId>.
-    NCollection_List<IVtk_PointId>::Iterator anIterOfIds =
-      NCollection_List<IVtk_PointId>::Iterator(*thePointIds);
-    anIdList->Allocate(thePointIds->Extent());
-    for (; anIterOfIds.More(); anIterOfIds.Next())
+    // fill the cell directly from the local buffer instead of temporary vtkIdList
+    NCollection_LocalArray<vtkIdType, 64> anIds(thePointIds->Extent());
+    int                                   aNbIds = 0;
+    for (NCollection_List<IVtk_PointId>::Iterator anIterOfIds(*thePointIds); anIterOfIds.More();
+         anIterOfIds.Next())
     {
-      anIdList->InsertNextId(anIterOfIds.Value());
+      anIds[aNbIds++] = anIterOfIds.Value();
     }
 
-    myPolyData->InsertNextCell(VTK_POLY_LINE, anIdList);
+    myPolyData->InsertNextCell(VTK_POLY_LINE, aNbIds, anIds);
     insertNextSubShapeId(theShapeID, theMeshType);
   }
 }
@@ -128,3 +128,74 @@ void IVtkVTK_ShapeData::InsertTriangle(const IVtk_IdType   theShapeID,
   myPolyData->InsertNextCell(VTK_TRIANGLE, 3, aPoints);
   insertNextSubShapeId(theShapeID, theMeshType);
 }
+
+//=================================================================================================
+
+IVtk_PointId IVtkVTK_ShapeData::InsertPoints(
+  const NCollection_Array1<gp_Pnt>&                  thePnts,
+  const NCollection_Array1<NCollection_Vec3<float>>& theNorms)
+{
+  vtkPoints*      aPoints  = myPolyData->GetPoints();
+  const vtkIdType aFirstId = aPoints->GetNumberOfPoints();
+  const int       aNbPnts  = thePnts.Length();
+  if (aNbPnts == 0)
+  {
+    return aFirstId;
+  }
+
+  aPoints->SetNumberOfPoints(aFirstId + aNbPnts);
+  for (int aPntIter = 0; aPntIter < aNbPnts; ++aPntIter)
+  {
+    const gp_Pnt& aPnt = thePnts.Value(thePnts.Lower() + aPntIter);
+    aPoints->SetPoint(aFirstId + aPntIter, aPnt.X(), aPnt.Y(), aPnt.Z());
+  }
+
+  if (myNormals.GetPointer() != nullptr)
+  {
+    float* aNormData = myNormals->WritePointer(aFirstId * 3, vtkIdType(aNbPnts) * 3);
+    for (int aPntIter = 0; aPntIter < aNbPnts; ++aPntIter, aNormData += 3)
+    {
+      const NCollection_Vec3<float> aNorm =
+        !theNorms.IsEmpty() ? theNorms.Value(theNorms.Lower() + aPntIter)
+                            : NCollection_Vec3<float>(0.0f, 0.0f, 1.0f);
+      aNormData[0] = aNorm.x();
+      aNormData[1] = aNorm.y();
+      aNormData[2] = aNorm.z();
+    }
+  }
+  return aFirstId;
+}
+
+//=================================================================================================
+
+void IVtkVTK_ShapeData::InsertTriangles(const IVtk_IdType                                theShapeID,
+                                        const NCollection_Array1<NCollection_Vec3<int>>& theTriangles,
+                                        const IVtk_PointId theFirstPointId,
+                                        const IVtk_MeshType theMeshType)
+{
+  const int aNbTris = theTriangles.Length();
+  if (aNbTris == 0)
+  {
+    return;
+  }
+
+  for (NCollection_Array1<NCollection_Vec3<int>>::Iterator aTriIter(theTriangles); aTriIter.More();
+       aTriIter.Next())
+  {
+    const NCollection_Vec3<int>& aTri       = aTriIter.Value();
+    vtkIdType                    aPoints[3] = {theFirstPointId + aTri[0],
+                                               theFirstPointId + aTri[1],
+                                               theFirstPointId + aTri[2]};
+    myPolyData->InsertNextCell(VTK_TRIANGLE, 3, aPoints);
+  }
+
+  // cell data of the whole block is written at once
+  const vtkIdType aFirstCell = mySubShapeIDs->GetNumberOfTuples();
+  vtkIdType*      aShapeIds  = mySubShapeIDs->WritePointer(aFirstCell, aNbTris);
+  vtkIdType*      aTypes     = myMeshTypes->WritePointer(aFirstCell, aNbTris);
+  for (int aTriIter = 0; aTriIter < aNbTris; ++aTriIter)
+  {
+    aShapeIds[aTriIter] = theShapeID;
+    aTypes[aTriIter]    = theMeshType;
+  }
+}
@@ -94,6 +94,24 @@ public:
                                       const IVtk_PointId  thePointId3,
                                       const IVtk_MeshType theMeshType) override;
 
+  //! Insert a block of points with consecutive ids, growing point and normal arrays at once.
+  //! @param[in]  thePnts  point positions
+  //! @param[in]  theNorms point normals of the same length as thePnts, or empty array
+  //! @return id of the first added point
+  Standard_EXPORT IVtk_PointId
+    InsertPoints(const NCollection_Array1<gp_Pnt>&                  thePnts,
+                 const NCollection_Array1<NCollection_Vec3<float>>& theNorms) override;
+
+  //! Insert a block of triangles of the same sub-shape, filling the cell arrays at once.
+  //! @param[in]  theShapeID     id of the subshape to which the triangles belong
+  //! @param[in]  theTriangles   triangles defined by 0-based point indices relative to theFirstPointId
+  //! @param[in]  theFirstPointId id of the point with index 0
+  //! @param[in]  theMeshType    mesh type of the subshape
+  Standard_EXPORT void InsertTriangles(const IVtk_IdType                                theShapeID,
+                                       const NCollection_Array1<NCollection_Vec3<int>>& theTriangles,
+                                       const IVtk_PointId theFirstPointId,
+                                       const IVtk_MeshType theMeshType) override;
+
 public: //! @name Specific methods
   //! Get VTK PolyData.
   //! @return VTK PolyData
@@ -21,6 +21,7 @@
 #include <Graphic3d_ArrayOfPrimitives.hxx>
 #include <Graphic3d_ArrayOfSegments.hxx>
 #include <Graphic3d_ArrayOfTriangles.hxx>
+#include <Graphic3d_AttribBuffer.hxx>
 #include <Graphic3d_Texture2D.hxx>
 #include <Image_PixMap.hxx>
 #include <MeshVS_Buffer.hxx>
@@ -99,6 +100,7 @@ MeshVS_NodalColorPrsBuilder::MeshVS_NodalColorPrsBuilder(const occ::handle<MeshV
                                                          const MeshVS_BuilderPriority& Priority)
     : MeshVS_PrsBuilder(Parent, Flags, DS, Id, Priority),
       myUseTexture(false),
+      myIsMutableTexCoords(false),
       myInvalidColor(Quantity_NOC_GRAY)
 {
   SetExcluding(true);
@@ -272,6 +274,11 @@ void MeshVS_NodalColorPrsBuilder::Build(const occ::handle<Prs3d_Presentation>& P
   // Prepare for scaling the incoming colors
   const double anColorRatio = 1.0;
 
+  // node IDs of triangle vertices for updating texture coordinates in place
+  const bool              toKeepVertexNodes = myUseTexture && myIsMutableTexCoords;
+  NCollection_Vector<int> aVertexNodes(toKeepVertexNodes ? 4096 : 1);
+  myMutablePrs.UnBind(DisplayMode);
+
   for (it.Reset(); it.More(); it.Next())
   {
     int aKey = it.Key();
@@ -336,8 +343,12 @@ void MeshVS_NodalColorPrsBuilder::Build(const occ::handle<Prs3d_Presentation>& P
 
             if (myUseTexture)
             {
-              const double aTexCoord =
-                myTextureCoords(aNodes(aSubIdx == 0 ? 1 : (aNodeIdx + aSubIdx + 1)));
+              const int    aNodeId   = aNodes(aSubIdx == 0 ? 1 : (aNodeIdx + aSubIdx + 1));
+              const double aTexCoord = myTextureCoords(aNodeId);
+              if (toKeepVertexNodes)
+              {
+                aVertexNodes.Append(aNodeId);
+              }
 
               // Transform texture coordinate in accordance with number of colors specified
               // by upper level and real size of OpenGL texture. The OpenGL texture has border
@@ -395,14 +406,15 @@ void MeshVS_NodalColorPrsBuilder::Build(const occ::handle<Prs3d_Presentation>& P
         if (!aSource->Get3DGeom(aKey, NbNodes, aTopo))
           continue;
 
-        AddVolumePrs(aTopo,
+        addVolumePrs(aTopo,
                      aNodes,
                      aCoords,
                      aFaceTriangles,
                      IsReflect,
                      nbColors,
                      nbTextureColors,
-                     anColorRatio);
+                     anColorRatio,
+                     toKeepVertexNodes ? &aVertexNodes : nullptr);
 
         AddVolumePrs(aTopo,
                      aNodes,
@@ -488,6 +500,27 @@ void MeshVS_NodalColorPrsBuilder::Build(const occ::handle<Prs3d_Presentation>& P
   aDrawer->GetBoolean(MeshVS_DA_SupressBackFaces, toSupressBackFaces);
   aGroup1->SetClosed(toSupressBackFaces == true);
 
+  if (toKeepVertexNodes && aFaceTriangles->VertexNumber() == aVertexNodes.Length())
+  {
+    // move texture coordinates into dedicated block of vertex attributes,
+    // so that only this block is uploaded to GPU on changing nodal values
+    MutablePrs aMutPrs;
+    aMutPrs.Triangles = toMutableArray(aFaceTriangles);
+    if (!aMutPrs.Triangles.IsNull())
+    {
+      aMutPrs.VertexNodes = new NCollection_HArray1<int>(1, aVertexNodes.Length());
+      int aVertIter       = 1;
+      for (NCollection_Vector<int>::Iterator aNodeIter(aVertexNodes); aNodeIter.More();
+           aNodeIter.Next(), ++aVertIter)
+      {
+        aMutPrs.VertexNodes->SetValue(aVertIter, aNodeIter.Value());
+      }
+      aMutPrs.Aspect = anAsp;
+      aFaceTriangles = aMutPrs.Triangles;
+      myMutablePrs.Bind(DisplayMode, aMutPrs);
+    }
+  }
+
   aGroup1->SetPrimitivesAspect(anAsp);
   aGroup1->AddPrimitiveArray(aFaceTriangles /*aCPolyArr*/);
   // aGroup1->AddPrimitiveArray( aCPolyArr );
@@ -515,6 +548,30 @@ void MeshVS_NodalColorPrsBuilder::AddVolumePrs(
   const int                                                          theNbColors,
   const int                                                          theNbTexColors,
   const double                                                       theColorRatio) const
+{
+  addVolumePrs(theTopo,
+               theNodes,
+               theCoords,
+               theArray,
+               theIsShaded,
+               theNbColors,
+               theNbTexColors,
+               theColorRatio,
+               nullptr);
+}
+
+//=================================================================================================
+
+void MeshVS_NodalColorPrsBuilder::addVolumePrs(
+  const occ::handle<NCollection_HArray1<NCollection_Sequence<int>>>& theTopo,
+  const NCollection_Array1<int>&                                     theNodes,
+  const NCollection_Array1<double>&                                  theCoords,
+  const occ::handle<Graphic3d_ArrayOfPrimitives>&                    theArray,
+  const bool                                                         theIsShaded,
+  const int                                                          theNbColors,
+  const int                                                          theNbTexColors,
+  const double                                                       theColorRatio,
+  NCollection_Vector<int>*                                           theVertexNodes) const
 {
   int aLow = theCoords.Lower();
 
@@ -568,8 +625,13 @@ void MeshVS_NodalColorPrsBuilder::AddVolumePrs(
 
           if (myUseTexture)
           {
-            const double aTexCoord = myTextureCoords(
-              theNodes(aFaceNodes(aSubIdx == 0 ? 1 : (aNodeIdx + aSubIdx + 1)) + 1));
+            const int aNodeId =
+              theNodes(aFaceNodes(aSubIdx == 0 ? 1 : (aNodeIdx + aSubIdx + 1)) + 1);
+            const double aTexCoord = myTextureCoords(aNodeId);
+            if (theVertexNodes != nullptr)
+            {
+              theVertexNodes->Append(aNodeId);
+            }
 
             theArray->AddVertex(aPnt,
                                 aNorm,
@@ -780,6 +842,123 @@ double MeshVS_NodalColorPrsBuilder::GetTextureCoord(const int theID)
   return myTextureCoords.IsBound(theID) ? myTextureCoords(theID) : -1;
 }
 
+//=================================================================================================
+
+bool MeshVS_NodalColorPrsBuilder::UpdateTextureCoords(
+  const NCollection_DataMap<int, double>& theMap)
+{
+  myTextureCoords = theMap;
+  if (myMutablePrs.IsEmpty())
+  {
+    return false;
+  }
+
+  for (NCollection_DataMap<int, MutablePrs>::Iterator aPrsIter(myMutablePrs); aPrsIter.More();
+       aPrsIter.Next())
+  {
+    fillTextureCoords(aPrsIter.Value().Triangles, aPrsIter.Value().VertexNodes->Array1());
+  }
+  return true;
+}
+
+//=================================================================================================
+
+bool MeshVS_NodalColorPrsBuilder::UpdateColorMap(
+  const NCollection_Sequence<Quantity_Color>& theColors)
+{
+  const bool isSameSize = myTextureColorMap.Length() == theColors.Length();
+  myTextureColorMap     = theColors;
+  if (myMutablePrs.IsEmpty() || theColors.IsEmpty())
+  {
+    return false;
+  }
+
+  for (NCollection_DataMap<int, MutablePrs>::Iterator aPrsIter(myMutablePrs); aPrsIter.More();
+       aPrsIter.Next())
+  {
+    const MutablePrs& aPrs = aPrsIter.Value();
+    aPrs.Aspect->SetTextureMap(CreateTexture());
+    if (!isSameSize)
+    {
+      // texture coordinates depend on number of colors
+      fillTextureCoords(aPrs.Triangles, aPrs.VertexNodes->Array1());
+    }
+  }
+  if (myParentMesh != nullptr)
+  {
+    myParentMesh->SynchronizeAspects();
+  }
+  return true;
+}
+
+//=================================================================================================
+
+occ::handle<Graphic3d_ArrayOfTriangles> MeshVS_NodalColorPrsBuilder::toMutableArray(
+  const occ::handle<Graphic3d_ArrayOfTriangles>& theTriangles) const
+{
+  const int aNbVerts = theTriangles->VertexNumber();
+  if (aNbVerts < 1)
+  {
+    return nullptr;
+  }
+
+  const bool                              hasNormals = theTriangles->HasVertexNormals();
+  occ::handle<Graphic3d_ArrayOfTriangles> aResult = new Graphic3d_ArrayOfTriangles(
+    aNbVerts,
+    0,
+    Graphic3d_ArrayFlags_VertexTexel
+      | (hasNormals ? Graphic3d_ArrayFlags_VertexNormal : Graphic3d_ArrayFlags_None)
+      | Graphic3d_ArrayFlags_AttribsMutable | Graphic3d_ArrayFlags_AttribsDeinterleaved);
+  for (int aVertIter = 1; aVertIter <= aNbVerts; ++aVertIter)
+  {
+    aResult->SetVertice(aVertIter, theTriangles->Vertice(aVertIter));
+    if (hasNormals)
+    {
+      aResult->SetVertexNormal(aVertIter, theTriangles->VertexNormal(aVertIter));
+    }
+    const gp_Pnt2d aTexel = theTriangles->VertexTexel(aVertIter);
+    aResult->SetVertexTexel(aVertIter, aTexel.X(), aTexel.Y());
+  }
+  return aResult;
+}
+
+//=================================================================================================
+
+void MeshVS_NodalColorPrsBuilder::fillTextureCoords(
+  const occ::handle<Graphic3d_ArrayOfTriangles>& theTriangles,
+  const NCollection_Array1<int>&                 theVertexNodes) const
+{
+  occ::handle<Graphic3d_AttribBuffer> anAttribs =
+    occ::down_cast<Graphic3d_AttribBuffer>(theTriangles->Attributes());
+  if (anAttribs.IsNull())
+  {
+    return;
+  }
+
+  int      anAttribIndex  = 0;
+  size_t   anAttribStride = 0;
+  uint8_t* aTexData =
+    anAttribs->ChangeAttributeData(Graphic3d_TOA_UV, anAttribIndex, anAttribStride);
+  if (aTexData == nullptr)
+  {
+    return;
+  }
+
+  // same transformation as within Build()
+  const double aNbColors    = double(myTextureColorMap.Length());
+  const double aNbTexColors = double(getNearestPow2(myTextureColorMap.Length()));
+  for (int aVertIter = theVertexNodes.Lower(); aVertIter <= theVertexNodes.Upper(); ++aVertIter)
+  {
+    const double* aTexCoordPtr = myTextureCoords.Seek(theVertexNodes.Value(aVertIter));
+    const double  aTexCoord    = aTexCoordPtr != nullptr ? *aTexCoordPtr : -1.0;
+    NCollection_Vec2<float>& aTexel       = *reinterpret_cast<NCollection_Vec2<float>*>(
+      aTexData + anAttribStride * size_t(aVertIter - theVertexNodes.Lower()));
+    aTexel.x() = float((aTexCoord * (aNbColors - 1.0) + 0.5) / aNbTexColors);
+    aTexel.y() = aTexCoord < 0 || aTexCoord > 1 ? 0.25f : 0.75f;
+  }
+  anAttribs->Invalidate(anAttribIndex);
+}
+
 //================================================================
 // Function : CreateTexture
 // Purpose  : Create texture in accordance with myTextureColorMap
@@ -26,11 +26,14 @@
 #include <TColStd_PackedMapOfInteger.hxx>
 #include <NCollection_Array1.hxx>
 #include <NCollection_HArray1.hxx>
+#include <NCollection_Vector.hxx>
 
 class MeshVS_Mesh;
 class MeshVS_DataSource;
 class Graphic3d_Texture2D;
 class Graphic3d_ArrayOfPrimitives;
+class Graphic3d_ArrayOfTriangles;
+class Graphic3d_AspectFillArea3d;
 
 //! This class provides methods to create presentation of nodes with assigned color.
 //! There are two ways of presentation building
@@ -45,6 +48,11 @@ class Graphic3d_ArrayOfPrimitives;
 //! UseTexture - activates/deactivates this way
 //! SetColorMap - sets colors used for generation of texture
 //! SetColorindices - specifies correspondence between node IDs and indices of colors from color map
+//!
+//! When texture is used together with SetMutableTextureCoords(), texture coordinates are kept
+//! within separate mutable block of vertex attributes, so that UpdateTextureCoords() and
+//! UpdateColorMap() modify displayed presentation in place (e.g. switching time steps of results)
+//! instead of recomputing it; the viewer should be just redrawn afterwards.
 class MeshVS_NodalColorPrsBuilder : public MeshVS_PrsBuilder
 {
 
@@ -111,6 +119,27 @@ public:
   //! Return correspondence between node IDs and texture coordinate (range [0, 1])
   Standard_EXPORT double GetTextureCoord(const int theID);
 
+  //! Return TRUE if texture coordinates of built presentation can be updated in place
+  //! by UpdateTextureCoords(); FALSE by default.
+  bool IsMutableTextureCoords() const { return myIsMutableTexCoords; }
+
+  //! Specify if texture coordinates of built presentation can be updated in place.
+  //! Takes effect on next presentation computation; holds node indices per vertex.
+  void SetMutableTextureCoords(const bool theIsMutable) { myIsMutableTexCoords = theIsMutable; }
+
+  //! Specify new correspondence between node IDs and texture coordinates (range [0, 1])
+  //! and update the built presentation in place, without recomputing it.
+  //! Nodes missing in the map are shown with invalid color.
+  //! @return FALSE if presentation has not been built with mutable texture coordinates
+  //!         and should be recomputed
+  Standard_EXPORT bool UpdateTextureCoords(const NCollection_DataMap<int, double>& theMap);
+
+  //! Set new colors for texture presentation and update the built presentation in place,
+  //! without recomputing it.
+  //! @return FALSE if presentation has not been built with mutable texture coordinates
+  //!         and should be recomputed
+  Standard_EXPORT bool UpdateColorMap(const NCollection_Sequence<Quantity_Color>& theColors);
+
   //! Add to array polygons or polylines representing volume
   Standard_EXPORT void AddVolumePrs(
     const occ::handle<NCollection_HArray1<NCollection_Sequence<int>>>& theTopo,
@@ -128,11 +157,45 @@ private:
   //! Create texture in accordance with myTextureColorMap
   Standard_EXPORT occ::handle<Graphic3d_Texture2D> CreateTexture() const;
 
+  //! Copy triangles into array with mutable non-interleaved attributes.
+  occ::handle<Graphic3d_ArrayOfTriangles> toMutableArray(
+    const occ::handle<Graphic3d_ArrayOfTriangles>& theTriangles) const;
+
+  //! Fill texture coordinates of mutable array from myTextureCoords.
+  void fillTextureCoords(const occ::handle<Graphic3d_ArrayOfTriangles>& theTriangles,
+                         const NCollection_Array1<int>&                 theVertexNodes) const;
+
+  //! Add volume triangles to array recording node IDs of added vertices when requested.
+  void addVolumePrs(
+    const occ::handle<NCollection_HArray1<NCollection_Sequence<int>>>& theTopo,
+    const NCollection_Array1<int>&                                     theNodes,
+    const NCollection_Array1<double>&                                  theCoords,
+    const occ::handle<Graphic3d_ArrayOfPrimitives>&                    theArray,
+    const bool                                                         theIsShaded,
+    const int                                                          theNbColors,
+    const int                                                          theNbTexColors,
+    const double                                                       theColorRatio,
+    NCollection_Vector<int>*                                           theVertexNodes) const;
+
+private:
+  //! Presentation built with mutable texture coordinates.
+  struct MutablePrs
+  {
+    occ::handle<Graphic3d_ArrayOfTriangles> Triangles;   //!< shaded triangles
+    occ::handle<NCollection_HArray1<int>>   VertexNodes; //!< node ID of each vertex
+    occ::handle<Graphic3d_AspectFillArea3d> Aspect;      //!< aspect holding texture
+  };
+
+private:
   NCollection_DataMap<int, Quantity_Color> myNodeColorMap;
   bool                                     myUseTexture;
+  bool                                     myIsMutableTexCoords;
   NCollection_Sequence<Quantity_Color>     myTextureColorMap;
   NCollection_DataMap<int, double>         myTextureCoords;
   Quantity_Color                           myInvalidColor;
+
+  //! presentations with mutable texture coordinates per display mode
+  mutable NCollection_DataMap<int, MutablePrs> myMutablePrs;
 };
 
 #endif // _MeshVS_NodalColorPrsBuilder_HeaderFile
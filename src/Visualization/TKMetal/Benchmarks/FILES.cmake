@@ -0,0 +1,6 @@
+# Benchmark source files for TKMetal
+set(OCCT_TKMetal_Benchmarks_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
+
+set(OCCT_TKMetal_Benchmarks_FILES
+  Metal_Benchmark.mm
+)
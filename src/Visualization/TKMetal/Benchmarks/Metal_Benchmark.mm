@@ -0,0 +1,146 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <BSplCLib.hxx>
+#include <Metal_BSplineGridEval.hxx>
+#include <Metal_Buffer.hxx>
+#include <Metal_Context.hxx>
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <vector>
+
+namespace
+{
+//! Returns the shared Metal context or NULL if Metal device is not available.
+Metal_Context* sharedContext()
+{
+  static occ::handle<Metal_Context> THE_CONTEXT = []() {
+    occ::handle<Metal_Context> aCtx = new Metal_Context();
+    return aCtx->Init() ? aCtx : occ::handle<Metal_Context>();
+  }();
+  return THE_CONTEXT.get();
+}
+} // namespace
+
+// Argument: number of float elements.
+
+static void Metal_Buffer_Init(benchmark::State& theState)
+{
+  Metal_Context* aCtx = sharedContext();
+  if (aCtx == nullptr)
+  {
+    theState.SkipWithError("Metal device is not available");
+    return;
+  }
+  const int          aNbElems = int(theState.range(0));
+  std::vector<float> aData(size_t(aNbElems) * 3, 1.0f);
+  for (auto _ : theState)
+  {
+    Metal_Buffer aBuffer;
+    benchmark::DoNotOptimize(aBuffer.Init(aCtx, 3, aNbElems, aData.data()));
+    aBuffer.Release(aCtx);
+  }
+  theState.SetBytesProcessed(theState.iterations() * int64_t(aData.size() * sizeof(float)));
+}
+BENCHMARK(Metal_Buffer_Init)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+
+static void Metal_Buffer_SubData(benchmark::State& theState)
+{
+  Metal_Context* aCtx = sharedContext();
+  if (aCtx == nullptr)
+  {
+    theState.SkipWithError("Metal device is not available");
+    return;
+  }
+  const int          aNbElems = int(theState.range(0));
+  std::vector<float> aData(size_t(aNbElems) * 3, 1.0f);
+  Metal_Buffer       aBuffer;
+  if (!aBuffer.Init(aCtx, 3, aNbElems, aData.data()))
+  {
+    theState.SkipWithError("Buffer cannot be allocated");
+    return;
+  }
+  for (auto _ : theState)
+  {
+    benchmark::DoNotOptimize(aBuffer.SubData(aCtx, 0, aNbElems, aData.data()));
+  }
+  aBuffer.Release(aCtx);
+  theState.SetBytesProcessed(theState.iterations() * int64_t(aData.size() * sizeof(float)));
+}
+BENCHMARK(Metal_Buffer_SubData)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+
+// Argument: number of grid samples in each direction.
+
+static void Metal_BSplineGridEval_Perform(benchmark::State& theState)
+{
+  Metal_Context* aCtx = sharedContext();
+  if (aCtx == nullptr)
+  {
+    theState.SkipWithError("Metal device is not available");
+    return;
+  }
+
+  // bicubic surface with 8 x 8 uniform spans
+  const int                  aNbSpans = 8;
+  const int                  aNbPoles = aNbSpans + 3;
+  NCollection_Array2<gp_Pnt> aPoles(1, aNbPoles, 1, aNbPoles);
+  for (int aRow = 1; aRow <= aNbPoles; ++aRow)
+  {
+    for (int aCol = 1; aCol <= aNbPoles; ++aCol)
+    {
+      aPoles(aRow, aCol) = gp_Pnt(aRow, aCol, std::sin(aRow) * std::cos(aCol));
+    }
+  }
+  NCollection_Array1<double> aKnots(1, aNbSpans + 1);
+  NCollection_Array1<int>    aMults(1, aNbSpans + 1);
+  for (int anIndex = 1; anIndex <= aNbSpans + 1; ++anIndex)
+  {
+    aKnots(anIndex) = anIndex - 1.0;
+    aMults(anIndex) = 1;
+  }
+  aMults.ChangeFirst() = 4;
+  aMults.ChangeLast()  = 4;
+  NCollection_Array1<double> aFlatKnots(1, aNbPoles + 4);
+  BSplCLib::KnotSequence(aKnots, aMults, aFlatKnots);
+
+  occ::handle<Metal_BSplineGridEval> anEval = new Metal_BSplineGridEval();
+  if (!anEval->Init(aCtx)
+      || !anEval->SetSurface(aCtx, 3, 3, aPoles, nullptr, aFlatKnots, aFlatKnots))
+  {
+    theState.SkipWithError("Compute kernel cannot be created");
+    return;
+  }
+
+  const int                  aNbSamples = int(theState.range(0));
+  NCollection_Array1<double> aParams(1, aNbSamples);
+  for (int anIndex = 1; anIndex <= aNbSamples; ++anIndex)
+  {
+    aParams(anIndex) = aNbSpans * double(anIndex - 1) / (aNbSamples - 1);
+  }
+  NCollection_Array2<gp_Pnt> aPoints(1, aNbSamples, 1, aNbSamples);
+  for (auto _ : theState)
+  {
+    if (!anEval->Perform(aCtx, aParams, aParams, aPoints))
+    {
+      theState.SkipWithError("Grid evaluation has failed");
+      break;
+    }
+    benchmark::DoNotOptimize(aPoints.Value(1, 1));
+  }
+  anEval->Release(aCtx);
+  theState.SetItemsProcessed(theState.iterations() * aNbSamples * aNbSamples);
+}
+BENCHMARK(Metal_BSplineGridEval_Perform)->Arg(32)->Arg(256)->Arg(1024);
@@ -5,10 +5,18 @@ set(OCCT_Metal_FILES
   Metal_AspectState.hxx
   Metal_BackgroundRenderer.hxx
   Metal_BackgroundRenderer.mm
+  Metal_BindlessTable.hxx
+  Metal_BindlessTable.mm
+  Metal_BSplineGridEval.hxx
+  Metal_BSplineGridEval.mm
+  Metal_BSplineSurface.hxx
+  Metal_BSplineSurface.mm
   Metal_Buffer.hxx
   Metal_Buffer.mm
-  Metal_BufferPool.hxx
-  Metal_BufferPool.mm
+  Metal_BufferAllocator.hxx
+  Metal_BufferAllocator.mm
+  Metal_BVHOverlap.hxx
+  Metal_BVHOverlap.mm
   Metal_CappingAlgo.hxx
   Metal_CappingAlgo.mm
   Metal_Caps.hxx
@@ -19,18 +27,32 @@ set(OCCT_Metal_FILES
   Metal_ComputeEncoder.mm
   Metal_ComputePipeline.hxx
   Metal_ComputePipeline.mm
+  Metal_ComputeService.hxx
+  Metal_ComputeService.mm
   Metal_Context.hxx
   Metal_Context.mm
   Metal_DepthPeeling.hxx
   Metal_DepthPeeling.mm
+  Metal_DeviceHandoff.hxx
+  Metal_DeviceHandoff.mm
+  Metal_DrawList.hxx
+  Metal_DrawList.mm
   Metal_Font.hxx
   Metal_Font.mm
   Metal_Flipper.hxx
   Metal_Flipper.mm
   Metal_GeometryEmulator.hxx
   Metal_GeometryEmulator.mm
+  Metal_GpuCulling.hxx
+  Metal_GpuCulling.mm
+  Metal_GpuTimer.hxx
+  Metal_GpuTimer.mm
   Metal_FrameBuffer.hxx
   Metal_FrameBuffer.mm
+  Metal_FrameBudget.hxx
+  Metal_FrameBudget.mm
+  Metal_FrameCapture.hxx
+  Metal_FrameCapture.mm
   Metal_FrameStats.hxx
   Metal_FrameStats.mm
   Metal_FrameStatsPrs.hxx
@@ -38,14 +60,20 @@ set(OCCT_Metal_FILES
   Metal_GraduatedTrihedron.hxx
   Metal_GraduatedTrihedron.mm
   Metal_HaltonSampler.hxx
+  Metal_HiddenLineAlgo.hxx
+  Metal_HiddenLineAlgo.mm
   Metal_GraphicDriver.hxx
   Metal_GraphicDriver.mm
   Metal_GraphicDriverFactory.hxx
   Metal_GraphicDriverFactory.mm
   Metal_Group.hxx
   Metal_Group.mm
+  Metal_IdBuffer.hxx
+  Metal_IdBuffer.mm
   Metal_IndexBuffer.hxx
   Metal_IndexBuffer.mm
+  Metal_IndirectLayer.hxx
+  Metal_IndirectLayer.mm
   Metal_InstanceBuffer.hxx
   Metal_InstanceBuffer.mm
   Metal_Layer.hxx
@@ -56,10 +84,22 @@ set(OCCT_Metal_FILES
   Metal_Material.hxx
   Metal_Material.mm
   Metal_MaterialState.hxx
+  Metal_MeshletBuffer.hxx
+  Metal_MeshletBuffer.mm
   Metal_OIT.hxx
   Metal_OIT.mm
   Metal_PBREnvironment.hxx
   Metal_PBREnvironment.mm
+  Metal_PageAllocator.hxx
+  Metal_PageAllocator.mm
+  Metal_PipelineCache.hxx
+  Metal_PipelineCache.mm
+  Metal_PipelineProfile.hxx
+  Metal_PipelineProfile.mm
+  Metal_PointCloud.hxx
+  Metal_PointCloud.mm
+  Metal_PointCloudRaster.hxx
+  Metal_PointCloudRaster.mm
   Metal_PointSprite.hxx
   Metal_PointSprite.mm
   Metal_PostProcess.hxx
@@ -69,6 +109,8 @@ set(OCCT_Metal_FILES
   Metal_RayTracing.hxx
   Metal_RayTracing.mm
   Metal_RenderFilter.hxx
+  Metal_ResidencyManager.hxx
+  Metal_ResidencyManager.mm
   Metal_Resource.hxx
   Metal_Resource.mm
   Metal_Sampler.hxx
@@ -79,11 +121,19 @@ set(OCCT_Metal_FILES
   Metal_ShaderObject.mm
   Metal_ShaderProgram.hxx
   Metal_ShaderProgram.mm
+  Metal_ShaderProgramKey.hxx
   Metal_ShadowMap.hxx
   Metal_ShadowMap.mm
+  Metal_Signpost.hxx
+  Metal_Signpost.mm
+  Metal_SparseTexture.hxx
+  Metal_SparseTexture.mm
+  Metal_StagingRing.hxx
+  Metal_StagingRing.mm
   Metal_StencilOps.hxx
   Metal_StereoComposer.hxx
   Metal_StereoComposer.mm
+  Metal_StorageMode.hxx
   Metal_Structure.hxx
   Metal_Structure.mm
   Metal_TessellationController.hxx
@@ -96,10 +146,18 @@ set(OCCT_Metal_FILES
   Metal_TextureSet.mm
   Metal_TileSampler.hxx
   Metal_TileSampler.mm
+  Metal_TransformBuffer.hxx
+  Metal_TransformBuffer.mm
   Metal_UniformBuffer.hxx
   Metal_UniformBuffer.mm
+  Metal_UniformRing.hxx
+  Metal_UniformRing.mm
+  Metal_Upscaler.hxx
+  Metal_Upscaler.mm
   Metal_VertexBuffer.hxx
   Metal_VertexBuffer.mm
+  Metal_VideoTexture.hxx
+  Metal_VideoTexture.mm
   Metal_View.hxx
   Metal_View.mm
   Metal_Window.hxx
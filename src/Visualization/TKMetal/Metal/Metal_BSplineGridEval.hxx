@@ -0,0 +1,134 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef Metal_BSplineGridEval_HeaderFile
+#define Metal_BSplineGridEval_HeaderFile
+
+#include <Metal_ComputePipeline.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_Array2.hxx>
+#include <gp_Pnt.hxx>
+#include <gp_Vec.hxx>
+#include <gp_XYZ.hxx>
+
+#ifdef __OBJC__
+@protocol MTLBuffer;
+#endif
+
+class Metal_Context;
+
+//! GPU evaluation of non-periodic B-spline (NURBS) surface on grids of parameters
+//! (Cartesian product of U and V parameters), e.g. for the grid evaluation of GeomGridEval.
+//!
+//! The control net is uploaded once by SetSurface().
+//! For each grid, the span indices and non-zero basis functions of U and V parameters
+//! (with their first derivatives) are computed on CPU in double precision,
+//! and each GPU thread sums the products of basis functions and poles of one grid point.
+//!
+//! Accuracy: the sums are computed in single precision with the poles taken relatively
+//! to the center of the control net, so that the result does not depend on the position
+//! of the surface in space. Compared to double precision evaluation, points deviate
+//! by about 1e-6 of the size of the control net (up to 1e-5 for high degrees and rational
+//! surfaces with widely varying weights), and first derivatives by about the same fraction
+//! of the derivative magnitude; this is usually acceptable for sampling and tessellation,
+//! but not for exact geometric computations.
+class Metal_BSplineGridEval : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(Metal_BSplineGridEval, Standard_Transient)
+public:
+
+  //! Create uninitialized tool.
+  Standard_EXPORT Metal_BSplineGridEval();
+
+  //! Destructor.
+  Standard_EXPORT ~Metal_BSplineGridEval() override;
+
+  //! Compile compute kernel.
+  //! @return FALSE if kernel cannot be created
+  Standard_EXPORT bool Init(Metal_Context* theCtx);
+
+  //! Return TRUE if kernel has been compiled.
+  bool IsValid() const { return !myPipeline.IsNull() && myPipeline->IsValid(); }
+
+  //! Release GPU resources (including the uploaded surface).
+  Standard_EXPORT void Release(Metal_Context* theCtx);
+
+  //! Upload control net of the surface.
+  //! @param theCtx        Metal context
+  //! @param theUDegree    degree in U direction
+  //! @param theVDegree    degree in V direction
+  //! @param thePoles      poles
+  //! @param theWeights    weights of rational surface or NULL
+  //! @param theUFlatKnots flat U knots (NbUPoles + UDegree + 1 values)
+  //! @param theVFlatKnots flat V knots (NbVPoles + VDegree + 1 values)
+  //! @return FALSE if control net is inconsistent or buffer cannot be allocated
+  Standard_EXPORT bool SetSurface(Metal_Context* theCtx,
+                                  const int theUDegree,
+                                  const int theVDegree,
+                                  const NCollection_Array2<gp_Pnt>& thePoles,
+                                  const NCollection_Array2<double>* theWeights,
+                                  const NCollection_Array1<double>& theUFlatKnots,
+                                  const NCollection_Array1<double>& theVFlatKnots);
+
+  //! Return TRUE if the surface has been uploaded.
+  bool HasSurface() const { return myPolesBuffer != nullptr; }
+
+  //! Evaluate uploaded surface on the grid; waits for completion of GPU work.
+  //! @param theCtx     Metal context
+  //! @param theUParams U parameters of the grid
+  //! @param theVParams V parameters of the grid
+  //! @param thePoints  points, allocated with bounds [1, NbUParams] x [1, NbVParams]
+  //! @param theD1U     optional first derivatives along U with the same bounds
+  //! @param theD1V     optional first derivatives along V with the same bounds
+  //! @return FALSE on failure (the grid should be evaluated on CPU)
+  Standard_EXPORT bool Perform(Metal_Context* theCtx,
+                               const NCollection_Array1<double>& theUParams,
+                               const NCollection_Array1<double>& theVParams,
+                               NCollection_Array2<gp_Pnt>& thePoints,
+                               NCollection_Array2<gp_Vec>* theD1U = nullptr,
+                               NCollection_Array2<gp_Vec>* theD1V = nullptr);
+
+private:
+
+  //! Compute span indices and basis functions of parameters (rounded to single precision).
+  //! @param theParams    parameters
+  //! @param theDegree    degree
+  //! @param theFlatKnots flat knots
+  //! @param theFirst     index (0-based) of the first pole of each parameter
+  //! @param theBasis     basis functions followed by their derivatives, for each parameter
+  //! @return FALSE if basis cannot be evaluated
+  static bool computeBasis(const NCollection_Array1<double>& theParams,
+                           const int theDegree,
+                           const NCollection_Array1<double>& theFlatKnots,
+                           NCollection_Array1<uint32_t>& theFirst,
+                           NCollection_Array1<float>& theBasis);
+
+protected:
+
+  occ::handle<Metal_ComputePipeline> myPipeline;    //!< grid evaluation kernel
+  NCollection_Array1<double>         myUFlatKnots;  //!< flat U knots of the uploaded surface
+  NCollection_Array1<double>         myVFlatKnots;  //!< flat V knots of the uploaded surface
+  gp_XYZ                             myCenter;      //!< center of the control net
+  int                                myUDegree;     //!< degree in U direction
+  int                                myVDegree;     //!< degree in V direction
+  int                                myNbVPoles;    //!< number of poles in V direction
+#ifdef __OBJC__
+  id<MTLBuffer> myPolesBuffer; //!< homogeneous poles relative to center, U index * NbVPoles + V index
+#else
+  void*         myPolesBuffer;
+#endif
+};
+
+DEFINE_STANDARD_HANDLE(Metal_BSplineGridEval, Standard_Transient)
+
+#endif // Metal_BSplineGridEval_HeaderFile
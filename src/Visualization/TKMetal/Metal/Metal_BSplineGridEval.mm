@@ -0,0 +1,399 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#import <Metal/Metal.h>
+
+#include <Metal_BSplineGridEval.hxx>
+#include <Metal_Context.hxx>
+
+#include <BSplCLib.hxx>
+#include <math_Matrix.hxx>
+
+#include <algorithm>
+#include <vector>
+
+IMPLEMENT_STANDARD_RTTIEXT(Metal_BSplineGridEval, Standard_Transient)
+
+namespace
+{
+  //! Grid evaluation kernel.
+  static const char* THE_BSPLINE_GRID_SHADER = R"(
+#include <metal_stdlib>
+using namespace metal;
+
+struct GridUniforms
+{
+  uint NbU;
+  uint NbV;
+  uint UOrder;
+  uint VOrder;
+  uint NbVPoles;
+  uint ToComputeD1;
+  uint Padding[2];
+};
+
+// theUBasis/theVBasis hold Order basis functions followed by Order derivatives per parameter;
+// homogeneous poles are (w * (P - Center), w)
+kernel void bspline_grid(uint2 theId [[thread_position_in_grid]],
+                         constant GridUniforms& theUniforms [[buffer(0)]],
+                         const device float4* thePoles [[buffer(1)]],
+                         const device uint* theUFirst [[buffer(2)]],
+                         const device float* theUBasis [[buffer(3)]],
+                         const device uint* theVFirst [[buffer(4)]],
+                         const device float* theVBasis [[buffer(5)]],
+                         device float4* thePoints [[buffer(6)]],
+                         device float4* theD1U [[buffer(7)]],
+                         device float4* theD1V [[buffer(8)]])
+{
+  const uint aU = theId.y;
+  const uint aV = theId.x;
+  if (aU >= theUniforms.NbU || aV >= theUniforms.NbV)
+  {
+    return;
+  }
+
+  const device float* aBasisU = theUBasis + aU * theUniforms.UOrder * 2;
+  const device float* aBasisV = theVBasis + aV * theUniforms.VOrder * 2;
+  float4 aSum   = float4(0.0f);
+  float4 aSumDU = float4(0.0f);
+  float4 aSumDV = float4(0.0f);
+  for (uint i = 0; i < theUniforms.UOrder; ++i)
+  {
+    const device float4* aRow = thePoles + (theUFirst[aU] + i) * theUniforms.NbVPoles + theVFirst[aV];
+    float4 aCol   = float4(0.0f);
+    float4 aColDV = float4(0.0f);
+    for (uint j = 0; j < theUniforms.VOrder; ++j)
+    {
+      aCol   += aBasisV[j] * aRow[j];
+      aColDV += aBasisV[theUniforms.VOrder + j] * aRow[j];
+    }
+    aSum   += aBasisU[i] * aCol;
+    aSumDU += aBasisU[theUniforms.UOrder + i] * aCol;
+    aSumDV += aBasisU[i] * aColDV;
+  }
+
+  const uint   anIndex = aU * theUniforms.NbV + aV;
+  const float3 aPnt    = aSum.xyz / aSum.w;
+  thePoints[anIndex] = float4(aPnt, 0.0f);
+  if (theUniforms.ToComputeD1 != 0)
+  {
+    theD1U[anIndex] = float4((aSumDU.xyz - aPnt * aSumDU.w) / aSum.w, 0.0f);
+    theD1V[anIndex] = float4((aSumDV.xyz - aPnt * aSumDV.w) / aSum.w, 0.0f);
+  }
+}
+)";
+
+  //! Grid uniforms; should match GridUniforms in THE_BSPLINE_GRID_SHADER.
+  struct Metal_GridUniforms
+  {
+    uint32_t NbU;
+    uint32_t NbV;
+    uint32_t UOrder;
+    uint32_t VOrder;
+    uint32_t NbVPoles;
+    uint32_t ToComputeD1;
+    uint32_t Padding[2];
+  };
+}
+
+// =======================================================================
+// function : Metal_BSplineGridEval
+// purpose  : Constructor
+// =======================================================================
+Metal_BSplineGridEval::Metal_BSplineGridEval()
+: myUDegree(0),
+  myVDegree(0),
+  myNbVPoles(0),
+  myPolesBuffer(nil)
+{
+  //
+}
+
+// =======================================================================
+// function : ~Metal_BSplineGridEval
+// purpose  : Destructor
+// =======================================================================
+Metal_BSplineGridEval::~Metal_BSplineGridEval()
+{
+  Release(nullptr);
+}
+
+// =======================================================================
+// function : Release
+// purpose  : Release GPU resources
+// =======================================================================
+void Metal_BSplineGridEval::Release(Metal_Context* theCtx)
+{
+  if (!myPipeline.IsNull())
+  {
+    myPipeline->Release(theCtx);
+    myPipeline.Nullify();
+  }
+  myPolesBuffer = nil;
+}
+
+// =======================================================================
+// function : Init
+// purpose  : Compile compute kernel
+// =======================================================================
+bool Metal_BSplineGridEval::Init(Metal_Context* theCtx)
+{
+  if (IsValid())
+  {
+    return true;
+  }
+  if (theCtx == nullptr)
+  {
+    return false;
+  }
+
+  NSError* anError = nil;
+  id<MTLLibrary> aLibrary = theCtx->LoadShaderLibrary("Metal_BSplineGridEval_THE_BSPLINE_GRID_SHADER",
+                                                      [NSString stringWithUTF8String:THE_BSPLINE_GRID_SHADER],
+                                                      nil, &anError);
+  if (aLibrary == nil)
+  {
+    theCtx->Messenger()->SendFail() << "Metal_BSplineGridEval: failed to compile grid kernel: "
+                                    << (anError != nil ? [[anError localizedDescription] UTF8String] : "");
+    return false;
+  }
+
+  myPipeline = new Metal_ComputePipeline();
+  if (!myPipeline->Init(theCtx, aLibrary, @"bspline_grid"))
+  {
+    theCtx->Messenger()->SendFail() << "Metal_BSplineGridEval: failed to create grid pipeline";
+    Release(theCtx);
+    return false;
+  }
+  return true;
+}
+
+// =======================================================================
+// function : SetSurface
+// purpose  : Upload control net
+// =======================================================================
+bool Metal_BSplineGridEval::SetSurface(Metal_Context* theCtx,
+                                       const int theUDegree,
+                                       const int theVDegree,
+                                       const NCollection_Array2<gp_Pnt>& thePoles,
+                                       const NCollection_Array2<double>* theWeights,
+                                       const NCollection_Array1<double>& theUFlatKnots,
+                                       const NCollection_Array1<double>& theVFlatKnots)
+{
+  myPolesBuffer = nil;
+  const int aNbUPoles = thePoles.ColLength();
+  const int aNbVPoles = thePoles.RowLength();
+  if (theCtx == nullptr
+   || theUDegree < 1 || theVDegree < 1
+   || theUFlatKnots.Length() != aNbUPoles + theUDegree + 1
+   || theVFlatKnots.Length() != aNbVPoles + theVDegree + 1
+   || (theWeights != nullptr && (theWeights->ColLength() != aNbUPoles || theWeights->RowLength() != aNbVPoles)))
+  {
+    return false;
+  }
+
+  // poles relative to the center of the control net keep single precision for surfaces far from origin
+  gp_XYZ aMin = thePoles.First().XYZ(), aMax = aMin;
+  for (NCollection_Array2<gp_Pnt>::Iterator aPoleIter(thePoles); aPoleIter.More(); aPoleIter.Next())
+  {
+    aMin.SetCoord(std::min(aMin.X(), aPoleIter.Value().X()),
+                  std::min(aMin.Y(), aPoleIter.Value().Y()),
+                  std::min(aMin.Z(), aPoleIter.Value().Z()));
+    aMax.SetCoord(std::max(aMax.X(), aPoleIter.Value().X()),
+                  std::max(aMax.Y(), aPoleIter.Value().Y()),
+                  std::max(aMax.Z(), aPoleIter.Value().Z()));
+  }
+  myCenter = (aMin + aMax) * 0.5;
+
+  std::vector<float> aPoles(size_t(aNbUPoles) * size_t(aNbVPoles) * 4);
+  for (int aUIter = 0; aUIter < aNbUPoles; ++aUIter)
+  {
+    for (int aVIter = 0; aVIter < aNbVPoles; ++aVIter)
+    {
+      const int    aRow    = thePoles.LowerRow() + aUIter;
+      const int    aCol    = thePoles.LowerCol() + aVIter;
+      const double aWeight = theWeights != nullptr
+                           ? theWeights->Value(theWeights->LowerRow() + aUIter, theWeights->LowerCol() + aVIter)
+                           : 1.0;
+      const gp_XYZ aPole   = (thePoles.Value(aRow, aCol).XYZ() - myCenter) * aWeight;
+      float* aData = &aPoles[(size_t(aUIter) * aNbVPoles + aVIter) * 4];
+      aData[0] = float(aPole.X());
+      aData[1] = float(aPole.Y());
+      aData[2] = float(aPole.Z());
+      aData[3] = float(aWeight);
+    }
+  }
+
+  myPolesBuffer = [theCtx->Device() newBufferWithBytes:aPoles.data()
+                                                length:aPoles.size() * sizeof(float)
+                                               options:MTLResourceStorageModeShared];
+  if (myPolesBuffer == nil)
+  {
+    return false;
+  }
+
+  myUFlatKnots = theUFlatKnots;
+  myVFlatKnots = theVFlatKnots;
+  myUDegree    = theUDegree;
+  myVDegree    = theVDegree;
+  myNbVPoles   = aNbVPoles;
+  return true;
+}
+
+// =======================================================================
+// function : computeBasis
+// purpose  : Compute span indices and basis functions of parameters
+// =======================================================================
+bool Metal_BSplineGridEval::computeBasis(const NCollection_Array1<double>& theParams,
+                                         const int theDegree,
+                                         const NCollection_Array1<double>& theFlatKnots,
+                                         NCollection_Array1<uint32_t>& theFirst,
+                                         NCollection_Array1<float>& theBasis)
+{
+  const int anOrder = theDegree + 1;
+  math_Matrix aBasis(1, 2, 1, anOrder);
+  int aParamIndex = 0;
+  for (NCollection_Array1<double>::Iterator aParamIter(theParams); aParamIter.More(); aParamIter.Next(), ++aParamIndex)
+  {
+    int aFirstPole = 0;
+    if (BSplCLib::EvalBsplineBasis(1, anOrder, theFlatKnots, aParamIter.Value(), aFirstPole, aBasis) != 0)
+    {
+      return false;
+    }
+
+    theFirst.SetValue(aParamIndex, uint32_t(aFirstPole - 1));
+    for (int aFuncIter = 0; aFuncIter < anOrder; ++aFuncIter)
+    {
+      theBasis.SetValue(aParamIndex * anOrder * 2 + aFuncIter,           float(aBasis(1, aFuncIter + 1)));
+      theBasis.SetValue(aParamIndex * anOrder * 2 + anOrder + aFuncIter, float(aBasis(2, aFuncIter + 1)));
+    }
+  }
+  return true;
+}
+
+// =======================================================================
+// function : Perform
+// purpose  : Evaluate uploaded surface on the grid
+// =======================================================================
+bool Metal_BSplineGridEval::Perform(Metal_Context* theCtx,
+                                    const NCollection_Array1<double>& theUParams,
+                                    const NCollection_Array1<double>& theVParams,
+                                    NCollection_Array2<gp_Pnt>& thePoints,
+                                    NCollection_Array2<gp_Vec>* theD1U,
+                                    NCollection_Array2<gp_Vec>* theD1V)
+{
+  const int aNbU = theUParams.Length();
+  const int aNbV = theVParams.Length();
+  const bool toComputeD1 = theD1U != nullptr && theD1V != nullptr;
+  if (!IsValid() || !HasSurface() || theCtx == nullptr
+   || aNbU == 0 || aNbV == 0
+   || thePoints.ColLength() != aNbU || thePoints.RowLength() != aNbV
+   || (toComputeD1 && (theD1U->Size() != thePoints.Size() || theD1V->Size() != thePoints.Size())))
+  {
+    return false;
+  }
+
+  NCollection_Array1<uint32_t> aUFirst(0, aNbU - 1), aVFirst(0, aNbV - 1);
+  NCollection_Array1<float>    aUBasis(0, aNbU * (myUDegree + 1) * 2 - 1);
+  NCollection_Array1<float>    aVBasis(0, aNbV * (myVDegree + 1) * 2 - 1);
+  if (!computeBasis(theUParams, myUDegree, myUFlatKnots, aUFirst, aUBasis)
+   || !computeBasis(theVParams, myVDegree, myVFlatKnots, aVFirst, aVBasis))
+  {
+    return false;
+  }
+
+  id<MTLDevice> aDevice = theCtx->Device();
+  const size_t aNbPoints = size_t(aNbU) * size_t(aNbV);
+  id<MTLBuffer> aUFirstBuffer = [aDevice newBufferWithBytes:&aUFirst.First()
+                                                     length:aUFirst.Size() * sizeof(uint32_t)
+                                                    options:MTLResourceStorageModeShared];
+  id<MTLBuffer> aUBasisBuffer = [aDevice newBufferWithBytes:&aUBasis.First()
+                                                     length:aUBasis.Size() * sizeof(float)
+                                                    options:MTLResourceStorageModeShared];
+  id<MTLBuffer> aVFirstBuffer = [aDevice newBufferWithBytes:&aVFirst.First()
+                                                     length:aVFirst.Size() * sizeof(uint32_t)
+                                                    options:MTLResourceStorageModeShared];
+  id<MTLBuffer> aVBasisBuffer = [aDevice newBufferWithBytes:&aVBasis.First()
+                                                     length:aVBasis.Size() * sizeof(float)
+                                                    options:MTLResourceStorageModeShared];
+  id<MTLBuffer> aPointsBuffer = [aDevice newBufferWithLength:aNbPoints * 4 * sizeof(float)
+                                                     options:MTLResourceStorageModeShared];
+  // dummy buffers of derivatives are bound when they are not requested
+  const size_t aD1Length = toComputeD1 ? aNbPoints * 4 * sizeof(float) : 4 * sizeof(float);
+  id<MTLBuffer> aD1UBuffer = [aDevice newBufferWithLength:aD1Length options:MTLResourceStorageModeShared];
+  id<MTLBuffer> aD1VBuffer = [aDevice newBufferWithLength:aD1Length options:MTLResourceStorageModeShared];
+  if (aUFirstBuffer == nil || aUBasisBuffer == nil || aVFirstBuffer == nil || aVBasisBuffer == nil
+   || aPointsBuffer == nil || aD1UBuffer == nil || aD1VBuffer == nil)
+  {
+    return false;
+  }
+
+  Metal_GridUniforms aUniforms;
+  aUniforms.NbU         = uint32_t(aNbU);
+  aUniforms.NbV         = uint32_t(aNbV);
+  aUniforms.UOrder      = uint32_t(myUDegree + 1);
+  aUniforms.VOrder      = uint32_t(myVDegree + 1);
+  aUniforms.NbVPoles    = uint32_t(myNbVPoles);
+  aUniforms.ToComputeD1 = toComputeD1 ? 1u : 0u;
+  aUniforms.Padding[0]  = 0;
+  aUniforms.Padding[1]  = 0;
+
+  id<MTLCommandBuffer> aCmdBuffer = [theCtx->CommandQueue() commandBuffer];
+  id<MTLComputeCommandEncoder> anEncoder = [aCmdBuffer computeCommandEncoder];
+  if (anEncoder == nil)
+  {
+    return false;
+  }
+  anEncoder.label = @"BSplineGridEval";
+  [anEncoder setComputePipelineState:myPipeline->PipelineState()];
+  [anEncoder setBytes:&aUniforms length:sizeof(aUniforms) atIndex:0];
+  [anEncoder setBuffer:myPolesBuffer offset:0 atIndex:1];
+  [anEncoder setBuffer:aUFirstBuffer offset:0 atIndex:2];
+  [anEncoder setBuffer:aUBasisBuffer offset:0 atIndex:3];
+  [anEncoder setBuffer:aVFirstBuffer offset:0 atIndex:4];
+  [anEncoder setBuffer:aVBasisBuffer offset:0 atIndex:5];
+  [anEncoder setBuffer:aPointsBuffer offset:0 atIndex:6];
+  [anEncoder setBuffer:aD1UBuffer    offset:0 atIndex:7];
+  [anEncoder setBuffer:aD1VBuffer    offset:0 atIndex:8];
+  const MTLSize aGroupSize  = myPipeline->OptimalThreadgroupSize2D(aNbV, aNbU);
+  const MTLSize aGroupCount = myPipeline->ThreadgroupCount2D(aNbV, aNbU, aGroupSize);
+  [anEncoder dispatchThreadgroups:aGroupCount threadsPerThreadgroup:aGroupSize];
+  [anEncoder endEncoding];
+  [aCmdBuffer commit];
+  [aCmdBuffer waitUntilCompleted];
+  if (aCmdBuffer.status != MTLCommandBufferStatusCompleted)
+  {
+    return false;
+  }
+
+  const float* aPoints = static_cast<const float*>([aPointsBuffer contents]);
+  const float* aD1U    = static_cast<const float*>([aD1UBuffer contents]);
+  const float* aD1V    = static_cast<const float*>([aD1VBuffer contents]);
+  for (int aUIter = 0; aUIter < aNbU; ++aUIter)
+  {
+    for (int aVIter = 0; aVIter < aNbV; ++aVIter)
+    {
+      const size_t anIndex = (size_t(aUIter) * aNbV + aVIter) * 4;
+      thePoints.ChangeValue(thePoints.LowerRow() + aUIter, thePoints.LowerCol() + aVIter) =
+        gp_Pnt(myCenter + gp_XYZ(aPoints[anIndex], aPoints[anIndex + 1], aPoints[anIndex + 2]));
+      if (toComputeD1)
+      {
+        theD1U->ChangeValue(theD1U->LowerRow() + aUIter, theD1U->LowerCol() + aVIter) =
+          gp_Vec(aD1U[anIndex], aD1U[anIndex + 1], aD1U[anIndex + 2]);
+        theD1V->ChangeValue(theD1V->LowerRow() + aUIter, theD1V->LowerCol() + aVIter) =
+          gp_Vec(aD1V[anIndex], aD1V[anIndex + 1], aD1V[anIndex + 2]);
+      }
+    }
+  }
+  return true;
+}
@@ -0,0 +1,199 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef Metal_BSplineSurface_HeaderFile
+#define Metal_BSplineSurface_HeaderFile
+
+#include <Graphic3d_BndBox3d.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_Array2.hxx>
+#include <NCollection_Vec2.hxx>
+#include <NCollection_Vec3.hxx>
+#include <NCollection_Vec4.hxx>
+#include <NCollection_Vector.hxx>
+#include <Standard_Transient.hxx>
+#include <gp_Pnt.hxx>
+#include <gp_Pnt2d.hxx>
+
+#ifdef __OBJC__
+@protocol MTLBuffer;
+@protocol MTLTexture;
+#endif
+
+class Metal_Context;
+
+//! B-spline (NURBS) surface of a face, evaluated on GPU by hardware tessellation
+//! (see Metal_TessellationController::DrawBSplineSurface()) instead of drawing a triangulation.
+//! The control net, flat knots and weights are uploaded as is; one quad patch is drawn per non-empty knot span pair.
+//! Trimming loops in parametric space are rasterized into signed distance texture,
+//! which is sampled by tessellated vertices to clip the surface.
+//! Only non-periodic surfaces are accepted (periodic ones should be converted by SetUNotPeriodic()/SetVNotPeriodic()).
+class Metal_BSplineSurface : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(Metal_BSplineSurface, Standard_Transient)
+public:
+
+  //! Maximum degree in each direction evaluated by GPU (limited by register arrays of basis functions).
+  static const int MaxDegree = 9;
+
+  //! Resolution of trimming signed distance texture.
+  static const int TrimTextureSize = 256;
+
+  //! Number of samples along patch boundaries for computing screen-space tessellation factors.
+  static const int NbEdgeSamples = 5;
+
+  //! Patch descriptor; should match BSplinePatch in shader.
+  struct Patch
+  {
+    uint32_t USpan; //!< index of first flat U knot of the span
+    uint32_t VSpan; //!< index of first flat V knot of the span
+  };
+
+  //! Surface parameters; should match BSplineSurfaceParams in shader.
+  struct ShaderParams
+  {
+    uint32_t UDegree;
+    uint32_t VDegree;
+    uint32_t NbUPoles;
+    uint32_t NbVPoles;
+    uint32_t NbUKnots;
+    uint32_t HasTrim;
+    uint32_t IsReversed;
+    uint32_t Padding;
+    float    TrimRange[4]; //!< UMin, VMin, 1/(UMax-UMin), 1/(VMax-VMin)
+  };
+
+public:
+
+  //! Create surface from control net.
+  //! @param[in] theUDegree    degree in U direction
+  //! @param[in] theVDegree    degree in V direction
+  //! @param[in] thePoles      poles
+  //! @param[in] theWeights    weights of rational surface or NULL
+  //! @param[in] theUKnots     flat U knots (NbUPoles + UDegree + 1 values)
+  //! @param[in] theVKnots     flat V knots (NbVPoles + VDegree + 1 values)
+  //! @param[in] theIsReversed flag to flip the normal (reversed face orientation)
+  Standard_EXPORT Metal_BSplineSurface(const int                         theUDegree,
+                                       const int                         theVDegree,
+                                       const NCollection_Array2<gp_Pnt>& thePoles,
+                                       const NCollection_Array2<double>* theWeights,
+                                       const NCollection_Array1<double>& theUKnots,
+                                       const NCollection_Array1<double>& theVKnots,
+                                       const bool                        theIsReversed);
+
+  //! Destructor.
+  Standard_EXPORT ~Metal_BSplineSurface() override;
+
+  //! Return TRUE if control net is consistent and can be evaluated on GPU.
+  bool IsValid() const { return myNbPatches > 0; }
+
+  //! Add trimming loop (closed polyline in parametric space of the surface).
+  //! Material is kept inside of odd number of loops (outer wire and holes are passed in the same way).
+  Standard_EXPORT void AddTrimmingLoop(const NCollection_Array1<gp_Pnt2d>& theLoop);
+
+  //! Return TRUE if surface has trimming loops.
+  bool HasTrimming() const { return !myTrimLoopEnds.IsEmpty(); }
+
+  //! Return bounding box of the control net (encloses the surface).
+  const Graphic3d_BndBox3d& BoundingBox() const { return myBndBox; }
+
+  //! Return surface parameters.
+  const ShaderParams& Params() const { return myParams; }
+
+  //! Return number of quad patches.
+  int NbPatches() const { return myNbPatches; }
+
+  //! Return number of non-empty knot spans in U direction.
+  int NbUSpans() const { return myNbUSpans; }
+
+  //! Return number of non-empty knot spans in V direction.
+  int NbVSpans() const { return myNbVSpans; }
+
+  //! Return model-space samples of patch boundaries and middle lines, NbEdgeSamples per line:
+  //! (NbUSpans + 1) * NbVSpans lines of constant U, NbUSpans * (NbVSpans + 1) lines of constant V,
+  //! then 2 middle lines (constant V, constant U) per patch; patches are ordered as U span * NbVSpans + V span.
+  const NCollection_Vector<NCollection_Vec3<float>>& EdgeSamples() const { return myEdgeSamples; }
+
+  //! Evaluate point on the surface on CPU.
+  Standard_EXPORT gp_Pnt Value(double theU, double theV) const;
+
+public:
+
+  //! Return TRUE if GPU resources have been created.
+  bool IsInitialized() const { return myIsInitialized; }
+
+  //! Create GPU buffers and trimming texture.
+  Standard_EXPORT bool Init(Metal_Context* theCtx);
+
+  //! Release GPU resources keeping CPU data (surface can be initialized again).
+  Standard_EXPORT void Release(Metal_Context* theCtx);
+
+  //! Return estimated GPU memory usage in bytes.
+  Standard_EXPORT size_t EstimatedDataSize() const;
+
+#ifdef __OBJC__
+  //! Return buffer of homogeneous poles (x*w, y*w, z*w, w), ordered as U index * NbVPoles + V index.
+  id<MTLBuffer> PolesBuffer() const { return myPolesBuffer; }
+
+  //! Return buffer of flat U knots followed by flat V knots.
+  id<MTLBuffer> KnotsBuffer() const { return myKnotsBuffer; }
+
+  //! Return buffer of Patch descriptors.
+  id<MTLBuffer> PatchesBuffer() const { return myPatchesBuffer; }
+
+  //! Return trimming signed distance texture (positive inside) or nil for untrimmed surface.
+  id<MTLTexture> TrimTexture() const { return myTrimTexture; }
+#endif
+
+private:
+
+  //! Evaluate non-zero basis functions of span.
+  static void basisFunctions(const NCollection_Array1<float>& theKnots,
+                             int theOffset, int theSpan, int theDegree, double theT, double* theN);
+
+  //! Sample boundaries of patches.
+  void computeEdgeSamples();
+
+  //! Rasterize trimming loops into signed distance field.
+  void computeTrimField(NCollection_Array1<int8_t>& theField) const;
+
+private:
+
+  ShaderParams                                 myParams;
+  NCollection_Array1<NCollection_Vec4<float>>  myPoles;        //!< homogeneous poles
+  NCollection_Array1<float>                    myKnots;        //!< flat U knots followed by flat V knots
+  NCollection_Array1<Patch>                    myPatches;      //!< patches
+  NCollection_Vector<NCollection_Vec2<double>> myTrimPoints;   //!< points of trimming loops
+  NCollection_Vector<int>                      myTrimLoopEnds; //!< end index of each trimming loop
+  NCollection_Vector<NCollection_Vec3<float>>  myEdgeSamples;  //!< samples of patch boundaries
+  Graphic3d_BndBox3d                           myBndBox;
+  int                                          myNbUSpans;
+  int                                          myNbVSpans;
+  int                                          myNbPatches;
+  bool                                         myIsInitialized;
+#ifdef __OBJC__
+  id<MTLBuffer>  myPolesBuffer;
+  id<MTLBuffer>  myKnotsBuffer;
+  id<MTLBuffer>  myPatchesBuffer;
+  id<MTLTexture> myTrimTexture;
+#else
+  void* myPolesBuffer;
+  void* myKnotsBuffer;
+  void* myPatchesBuffer;
+  void* myTrimTexture;
+#endif
+};
+
+DEFINE_STANDARD_HANDLE(Metal_BSplineSurface, Standard_Transient)
+
+#endif // Metal_BSplineSurface_HeaderFile
@@ -0,0 +1,494 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#import <Metal/Metal.h>
+
+#include <Metal_BSplineSurface.hxx>
+#include <Metal_Context.hxx>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+IMPLEMENT_STANDARD_RTTIEXT(Metal_BSplineSurface, Standard_Transient)
+
+namespace
+{
+  //! Width of distance band of trimming field, in texels; distances are clamped to it.
+  static const double THE_TRIM_BAND = 4.0;
+
+  //! Find non-empty knot span containing parameter.
+  static int findSpan(const NCollection_Array1<float>& theKnots,
+                      int theOffset, int theNbPoles, int theDegree, double theT)
+  {
+    int aSpan = theDegree;
+    for (int aKnotIter = theDegree; aKnotIter < theNbPoles; ++aKnotIter)
+    {
+      if (theKnots.Value(theOffset + aKnotIter) < theKnots.Value(theOffset + aKnotIter + 1))
+      {
+        aSpan = aKnotIter;
+        if (theT < double(theKnots.Value(theOffset + aKnotIter + 1)))
+        {
+          break;
+        }
+      }
+    }
+    return aSpan;
+  }
+
+  //! Return squared distance from point to segment.
+  static double squareDistanceToSegment(const NCollection_Vec2<double>& thePnt,
+                                        const NCollection_Vec2<double>& theP1,
+                                        const NCollection_Vec2<double>& theP2)
+  {
+    const NCollection_Vec2<double> aDir = theP2 - theP1;
+    const double aLen2 = aDir.Dot(aDir);
+    double aParam = aLen2 > 0.0 ? (thePnt - theP1).Dot(aDir) / aLen2 : 0.0;
+    aParam = std::max(0.0, std::min(1.0, aParam));
+    const NCollection_Vec2<double> aDelta = thePnt - (theP1 + aDir * aParam);
+    return aDelta.Dot(aDelta);
+  }
+}
+
+// =======================================================================
+// function : Metal_BSplineSurface
+// purpose  : Constructor
+// =======================================================================
+Metal_BSplineSurface::Metal_BSplineSurface(const int                         theUDegree,
+                                           const int                         theVDegree,
+                                           const NCollection_Array2<gp_Pnt>& thePoles,
+                                           const NCollection_Array2<double>* theWeights,
+                                           const NCollection_Array1<double>& theUKnots,
+                                           const NCollection_Array1<double>& theVKnots,
+                                           const bool                        theIsReversed)
+: myNbUSpans(0),
+  myNbVSpans(0),
+  myNbPatches(0),
+  myIsInitialized(false),
+  myPolesBuffer(nil),
+  myKnotsBuffer(nil),
+  myPatchesBuffer(nil),
+  myTrimTexture(nil)
+{
+  memset(&myParams, 0, sizeof(myParams));
+  const int aNbUPoles = thePoles.ColLength();
+  const int aNbVPoles = thePoles.RowLength();
+  if (theUDegree < 1 || theUDegree > MaxDegree
+   || theVDegree < 1 || theVDegree > MaxDegree
+   || aNbUPoles <= theUDegree
+   || aNbVPoles <= theVDegree
+   || theUKnots.Length() != aNbUPoles + theUDegree + 1
+   || theVKnots.Length() != aNbVPoles + theVDegree + 1
+   || (theWeights != nullptr
+    && (theWeights->ColLength() != aNbUPoles || theWeights->RowLength() != aNbVPoles)))
+  {
+    return;
+  }
+
+  myParams.UDegree    = uint32_t(theUDegree);
+  myParams.VDegree    = uint32_t(theVDegree);
+  myParams.NbUPoles   = uint32_t(aNbUPoles);
+  myParams.NbVPoles   = uint32_t(aNbVPoles);
+  myParams.NbUKnots   = uint32_t(theUKnots.Length());
+  myParams.IsReversed = theIsReversed ? 1 : 0;
+
+  myPoles.Resize(0, aNbUPoles * aNbVPoles - 1, false);
+  for (int aRowIter = 0; aRowIter < aNbUPoles; ++aRowIter)
+  {
+    for (int aColIter = 0; aColIter < aNbVPoles; ++aColIter)
+    {
+      const gp_Pnt& aPole = thePoles.Value(thePoles.LowerRow() + aRowIter, thePoles.LowerCol() + aColIter);
+      const double aWeight = theWeights != nullptr
+                           ? theWeights->Value(theWeights->LowerRow() + aRowIter, theWeights->LowerCol() + aColIter)
+                           : 1.0;
+      myPoles.ChangeValue(aRowIter * aNbVPoles + aColIter) =
+        NCollection_Vec4<float>(float(aPole.X() * aWeight), float(aPole.Y() * aWeight),
+                                float(aPole.Z() * aWeight), float(aWeight));
+      myBndBox.Add(NCollection_Vec3<double>(aPole.X(), aPole.Y(), aPole.Z()));
+    }
+  }
+
+  myKnots.Resize(0, theUKnots.Length() + theVKnots.Length() - 1, false);
+  for (int aKnotIter = 0; aKnotIter < theUKnots.Length(); ++aKnotIter)
+  {
+    myKnots.ChangeValue(aKnotIter) = float(theUKnots.Value(theUKnots.Lower() + aKnotIter));
+  }
+  for (int aKnotIter = 0; aKnotIter < theVKnots.Length(); ++aKnotIter)
+  {
+    myKnots.ChangeValue(theUKnots.Length() + aKnotIter) = float(theVKnots.Value(theVKnots.Lower() + aKnotIter));
+  }
+
+  // one patch per non-empty pair of knot spans
+  const int aVOffset = theUKnots.Length();
+  std::vector<uint32_t> aUSpans, aVSpans;
+  for (int aSpan = theUDegree; aSpan < aNbUPoles; ++aSpan)
+  {
+    if (myKnots.Value(aSpan) < myKnots.Value(aSpan + 1))
+    {
+      aUSpans.push_back(uint32_t(aSpan));
+    }
+  }
+  for (int aSpan = theVDegree; aSpan < aNbVPoles; ++aSpan)
+  {
+    if (myKnots.Value(aVOffset + aSpan) < myKnots.Value(aVOffset + aSpan + 1))
+    {
+      aVSpans.push_back(uint32_t(aSpan));
+    }
+  }
+  if (aUSpans.empty() || aVSpans.empty())
+  {
+    return;
+  }
+
+  myNbUSpans  = int(aUSpans.size());
+  myNbVSpans  = int(aVSpans.size());
+  myNbPatches = myNbUSpans * myNbVSpans;
+  myPatches.Resize(0, myNbPatches - 1, false);
+  for (int aUIter = 0; aUIter < myNbUSpans; ++aUIter)
+  {
+    for (int aVIter = 0; aVIter < myNbVSpans; ++aVIter)
+    {
+      Patch& aPatch = myPatches.ChangeValue(aUIter * myNbVSpans + aVIter);
+      aPatch.USpan = aUSpans[aUIter];
+      aPatch.VSpan = aVSpans[aVIter];
+    }
+  }
+
+  const float aUMin = myKnots.Value(theUDegree), aUMax = myKnots.Value(aNbUPoles);
+  const float aVMin = myKnots.Value(aVOffset + theVDegree), aVMax = myKnots.Value(aVOffset + aNbVPoles);
+  myParams.TrimRange[0] = aUMin;
+  myParams.TrimRange[1] = aVMin;
+  myParams.TrimRange[2] = 1.0f / (aUMax - aUMin);
+  myParams.TrimRange[3] = 1.0f / (aVMax - aVMin);
+
+  computeEdgeSamples();
+}
+
+// =======================================================================
+// function : ~Metal_BSplineSurface
+// purpose  : Destructor
+// =======================================================================
+Metal_BSplineSurface::~Metal_BSplineSurface()
+{
+  Release(nullptr);
+}
+
+// =======================================================================
+// function : AddTrimmingLoop
+// purpose  : Add trimming loop
+// =======================================================================
+void Metal_BSplineSurface::AddTrimmingLoop(const NCollection_Array1<gp_Pnt2d>& theLoop)
+{
+  if (theLoop.Length() < 3)
+  {
+    return;
+  }
+
+  for (NCollection_Array1<gp_Pnt2d>::Iterator aPntIter(theLoop); aPntIter.More(); aPntIter.Next())
+  {
+    myTrimPoints.Append(NCollection_Vec2<double>(aPntIter.Value().X(), aPntIter.Value().Y()));
+  }
+  myTrimLoopEnds.Append(myTrimPoints.Length());
+  myParams.HasTrim = 1;
+
+  // trimming texture should be rasterized again
+  Release(nullptr);
+}
+
+// =======================================================================
+// function : basisFunctions
+// purpose  : Evaluate non-zero basis functions of span
+// =======================================================================
+void Metal_BSplineSurface::basisFunctions(const NCollection_Array1<float>& theKnots,
+                                          int theOffset, int theSpan, int theDegree, double theT, double* theN)
+{
+  // The NURBS Book, algorithm A2.2
+  double aLeft[MaxDegree + 1], aRight[MaxDegree + 1];
+  theN[0] = 1.0;
+  for (int j = 1; j <= theDegree; ++j)
+  {
+    aLeft[j]  = theT - theKnots.Value(theOffset + theSpan + 1 - j);
+    aRight[j] = theKnots.Value(theOffset + theSpan + j) - theT;
+    double aSaved = 0.0;
+    for (int r = 0; r < j; ++r)
+    {
+      const double aTemp = theN[r] / (aRight[r + 1] + aLeft[j - r]);
+      theN[r] = aSaved + aRight[r + 1] * aTemp;
+      aSaved  = aLeft[j - r] * aTemp;
+    }
+    theN[j] = aSaved;
+  }
+}
+
+// =======================================================================
+// function : Value
+// purpose  : Evaluate point on CPU
+// =======================================================================
+gp_Pnt Metal_BSplineSurface::Value(double theU, double theV) const
+{
+  if (!IsValid())
+  {
+    return gp_Pnt();
+  }
+
+  const int aUDeg = int(myParams.UDegree), aVDeg = int(myParams.VDegree);
+  const int aNbV  = int(myParams.NbVPoles);
+  const int aVOffset = int(myParams.NbUKnots);
+  const int aUSpan = findSpan(myKnots, 0,        int(myParams.NbUPoles), aUDeg, theU);
+  const int aVSpan = findSpan(myKnots, aVOffset, aNbV,                    aVDeg, theV);
+
+  double aNu[MaxDegree + 1], aNv[MaxDegree + 1];
+  basisFunctions(myKnots, 0,        aUSpan, aUDeg, theU, aNu);
+  basisFunctions(myKnots, aVOffset, aVSpan, aVDeg, theV, aNv);
+
+  NCollection_Vec4<double> aSum(0.0);
+  for (int i = 0; i <= aUDeg; ++i)
+  {
+    const int aRow = (aUSpan - aUDeg + i) * aNbV + aVSpan - aVDeg;
+    for (int j = 0; j <= aVDeg; ++j)
+    {
+      const NCollection_Vec4<float>& aPole = myPoles.Value(aRow + j);
+      aSum += NCollection_Vec4<double>(aPole.x(), aPole.y(), aPole.z(), aPole.w()) * (aNu[i] * aNv[j]);
+    }
+  }
+  return aSum.w() != 0.0
+       ? gp_Pnt(aSum.x() / aSum.w(), aSum.y() / aSum.w(), aSum.z() / aSum.w())
+       : gp_Pnt(aSum.x(), aSum.y(), aSum.z());
+}
+
+// =======================================================================
+// function : computeEdgeSamples
+// purpose  : Sample boundaries of patches
+// =======================================================================
+void Metal_BSplineSurface::computeEdgeSamples()
+{
+  const int aVOffset = int(myParams.NbUKnots);
+  const auto aUBreak = [&](int theIndex)
+  {
+    return theIndex < myNbUSpans ? double(myKnots.Value(myPatches.Value(theIndex * myNbVSpans).USpan))
+                                 : double(myKnots.Value(myPatches.Value((myNbUSpans - 1) * myNbVSpans).USpan + 1));
+  };
+  const auto aVBreak = [&](int theIndex)
+  {
+    return theIndex < myNbVSpans ? double(myKnots.Value(aVOffset + myPatches.Value(theIndex).VSpan))
+                                 : double(myKnots.Value(aVOffset + myPatches.Value(myNbVSpans - 1).VSpan + 1));
+  };
+  const auto addLine = [&](double theU1, double theV1, double theU2, double theV2)
+  {
+    for (int aSampleIter = 0; aSampleIter < NbEdgeSamples; ++aSampleIter)
+    {
+      const double aT = double(aSampleIter) / double(NbEdgeSamples - 1);
+      const gp_Pnt aPnt = Value(theU1 + (theU2 - theU1) * aT, theV1 + (theV2 - theV1) * aT);
+      myEdgeSamples.Append(NCollection_Vec3<float>(float(aPnt.X()), float(aPnt.Y()), float(aPnt.Z())));
+    }
+  };
+
+  myEdgeSamples.Clear();
+  for (int aUIter = 0; aUIter <= myNbUSpans; ++aUIter)
+  {
+    for (int aVIter = 0; aVIter < myNbVSpans; ++aVIter)
+    {
+      addLine(aUBreak(aUIter), aVBreak(aVIter), aUBreak(aUIter), aVBreak(aVIter + 1));
+    }
+  }
+  for (int aUIter = 0; aUIter < myNbUSpans; ++aUIter)
+  {
+    for (int aVIter = 0; aVIter <= myNbVSpans; ++aVIter)
+    {
+      addLine(aUBreak(aUIter), aVBreak(aVIter), aUBreak(aUIter + 1), aVBreak(aVIter));
+    }
+  }
+  for (int aUIter = 0; aUIter < myNbUSpans; ++aUIter)
+  {
+    for (int aVIter = 0; aVIter < myNbVSpans; ++aVIter)
+    {
+      const double aUMid = 0.5 * (aUBreak(aUIter) + aUBreak(aUIter + 1));
+      const double aVMid = 0.5 * (aVBreak(aVIter) + aVBreak(aVIter + 1));
+      addLine(aUBreak(aUIter), aVMid, aUBreak(aUIter + 1), aVMid);
+      addLine(aUMid, aVBreak(aVIter), aUMid, aVBreak(aVIter + 1));
+    }
+  }
+}
+
+// =======================================================================
+// function : computeTrimField
+// purpose  : Rasterize trimming loops into signed distance field
+// =======================================================================
+void Metal_BSplineSurface::computeTrimField(NCollection_Array1<int8_t>& theField) const
+{
+  const int aSize = TrimTextureSize;
+  NCollection_Array1<double> aDist(0, aSize * aSize - 1);
+  aDist.Init(THE_TRIM_BAND * THE_TRIM_BAND);
+
+  // texel centers are placed at integer coordinates
+  const double aUScale = double(myParams.TrimRange[2]) * aSize;
+  const double aVScale = double(myParams.TrimRange[3]) * aSize;
+  std::vector<NCollection_Vec2<double>> aPnts;
+  aPnts.reserve(myTrimPoints.Length());
+  for (NCollection_Vector<NCollection_Vec2<double>>::Iterator aPntIter(myTrimPoints); aPntIter.More(); aPntIter.Next())
+  {
+    const NCollection_Vec2<double>& aPnt = aPntIter.Value();
+    aPnts.push_back(NCollection_Vec2<double>((aPnt.x() - myParams.TrimRange[0]) * aUScale - 0.5,
+                                             (aPnt.y() - myParams.TrimRange[1]) * aVScale - 0.5));
+  }
+
+  // exact distances within the band around each segment
+  std::vector<std::vector<double>> aCrossings(aSize);
+  int aLoopStart = 0;
+  for (NCollection_Vector<int>::Iterator aLoopIter(myTrimLoopEnds); aLoopIter.More(); aLoopIter.Next())
+  {
+    const int aLoopEnd = aLoopIter.Value();
+    for (int aPntIter = aLoopStart; aPntIter < aLoopEnd; ++aPntIter)
+    {
+      const NCollection_Vec2<double>& aP1 = aPnts[aPntIter];
+      const NCollection_Vec2<double>& aP2 = aPnts[aPntIter + 1 < aLoopEnd ? aPntIter + 1 : aLoopStart];
+      const int aXMin = std::max(0,         int(std::floor(std::min(aP1.x(), aP2.x()) - THE_TRIM_BAND)));
+      const int aXMax = std::min(aSize - 1, int(std::ceil (std::max(aP1.x(), aP2.x()) + THE_TRIM_BAND)));
+      const int aYMin = std::max(0,         int(std::floor(std::min(aP1.y(), aP2.y()) - THE_TRIM_BAND)));
+      const int aYMax = std::min(aSize - 1, int(std::ceil (std::max(aP1.y(), aP2.y()) + THE_TRIM_BAND)));
+      for (int aY = aYMin; aY <= aYMax; ++aY)
+      {
+        for (int aX = aXMin; aX <= aXMax; ++aX)
+        {
+          double& aTexelDist = aDist.ChangeValue(aY * aSize + aX);
+          aTexelDist = std::min(aTexelDist, squareDistanceToSegment(NCollection_Vec2<double>(aX, aY), aP1, aP2));
+        }
+      }
+
+      // crossings of texel rows for even-odd inside test
+      const int aRowFrom = std::max(0,         int(std::ceil (std::min(aP1.y(), aP2.y()))));
+      const int aRowTo   = std::min(aSize - 1, int(std::floor(std::max(aP1.y(), aP2.y()))));
+      for (int aY = aRowFrom; aY <= aRowTo; ++aY)
+      {
+        if ((aP1.y() <= aY) != (aP2.y() <= aY))
+        {
+          aCrossings[aY].push_back(aP1.x() + (aY - aP1.y()) * (aP2.x() - aP1.x()) / (aP2.y() - aP1.y()));
+        }
+      }
+    }
+    aLoopStart = aLoopEnd;
+  }
+
+  for (int aY = 0; aY < aSize; ++aY)
+  {
+    std::vector<double>& aRow = aCrossings[aY];
+    std::sort(aRow.begin(), aRow.end());
+    size_t aCrossIter = 0;
+    for (int aX = 0; aX < aSize; ++aX)
+    {
+      while (aCrossIter < aRow.size() && aRow[aCrossIter] <= double(aX))
+      {
+        ++aCrossIter;
+      }
+      const bool   isInside = (aCrossIter % 2) == 1;
+      const double aValue   = std::sqrt(aDist.Value(aY * aSize + aX)) / THE_TRIM_BAND;
+      theField.ChangeValue(aY * aSize + aX) = int8_t(std::lround((isInside ? aValue : -aValue) * 127.0));
+    }
+  }
+}
+
+// =======================================================================
+// function : Init
+// purpose  : Create GPU resources
+// =======================================================================
+bool Metal_BSplineSurface::Init(Metal_Context* theCtx)
+{
+  if (myIsInitialized)
+  {
+    return true;
+  }
+  if (!IsValid()
+    || theCtx == nullptr
+    || theCtx->Device() == nil)
+  {
+    return false;
+  }
+
+  id<MTLDevice> aDevice = theCtx->Device();
+  myPolesBuffer   = [aDevice newBufferWithBytes:&myPoles.First()
+                                         length:myPoles.Size() * sizeof(NCollection_Vec4<float>)
+                                        options:MTLResourceStorageModeShared];
+  myKnotsBuffer   = [aDevice newBufferWithBytes:&myKnots.First()
+                                         length:myKnots.Size() * sizeof(float)
+                                        options:MTLResourceStorageModeShared];
+  myPatchesBuffer = [aDevice newBufferWithBytes:&myPatches.First()
+                                         length:myPatches.Size() * sizeof(Patch)
+                                        options:MTLResourceStorageModeShared];
+  if (myPolesBuffer == nil
+   || myKnotsBuffer == nil
+   || myPatchesBuffer == nil)
+  {
+    theCtx->Messenger()->SendFail() << "Metal_BSplineSurface: failed to allocate control net buffers";
+    Release(theCtx);
+    return false;
+  }
+
+  if (HasTrimming())
+  {
+    NCollection_Array1<int8_t> aField(0, TrimTextureSize * TrimTextureSize - 1);
+    computeTrimField(aField);
+
+    MTLTextureDescriptor* aDesc = [MTLTextureDescriptor texture2DDescriptorWithPixelFormat:MTLPixelFormatR8Snorm
+                                                                                     width:TrimTextureSize
+                                                                                    height:TrimTextureSize
+                                                                                 mipmapped:NO];
+    aDesc.usage = MTLTextureUsageShaderRead;
+    myTrimTexture = [aDevice newTextureWithDescriptor:aDesc];
+    if (myTrimTexture == nil)
+    {
+      theCtx->Messenger()->SendFail() << "Metal_BSplineSurface: failed to allocate trimming texture";
+      Release(theCtx);
+      return false;
+    }
+    [myTrimTexture replaceRegion:MTLRegionMake2D(0, 0, TrimTextureSize, TrimTextureSize)
+                     mipmapLevel:0
+                       withBytes:&aField.First()
+                     bytesPerRow:TrimTextureSize];
+  }
+
+  myIsInitialized = true;
+  return true;
+}
+
+// =======================================================================
+// function : Release
+// purpose  : Release GPU resources
+// =======================================================================
+void Metal_BSplineSurface::Release(Metal_Context* )
+{
+  myPolesBuffer   = nil;
+  myKnotsBuffer   = nil;
+  myPatchesBuffer = nil;
+  myTrimTexture   = nil;
+  myIsInitialized = false;
+}
+
+// =======================================================================
+// function : EstimatedDataSize
+// purpose  : Return estimated GPU memory usage
+// =======================================================================
+size_t Metal_BSplineSurface::EstimatedDataSize() const
+{
+  if (!myIsInitialized)
+  {
+    return 0;
+  }
+  size_t aSize = myPoles.Size() * sizeof(NCollection_Vec4<float>)
+               + myKnots.Size() * sizeof(float)
+               + myPatches.Size() * sizeof(Patch);
+  if (myTrimTexture != nil)
+  {
+    aSize += size_t(TrimTextureSize) * TrimTextureSize;
+  }
+  return aSize;
+}
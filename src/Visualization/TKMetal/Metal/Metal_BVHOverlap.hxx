@@ -0,0 +1,73 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef Metal_BVHOverlap_HeaderFile
+#define Metal_BVHOverlap_HeaderFile
+
+#include <Metal_ComputePipeline.hxx>
+#include <BVH_Tree.hxx>
+#include <NCollection_Vec2.hxx>
+#include <NCollection_Vector.hxx>
+
+class Metal_Context;
+
+//! GPU broad phase of the overlap test of two BVH trees (e.g. of triangle sets of two shapes).
+//!
+//! Each GPU thread takes one leaf of the 1st tree and traverses the 2nd tree,
+//! collecting the pairs of leaves with overlapping boxes.
+//! Boxes are converted to single precision with outward rounding and the tolerance
+//! is applied to the boxes of the 2nd tree in double precision, so that the found pairs
+//! are a superset of the pairs found by double precision test on CPU;
+//! the elements of the found leaves are expected to be tested by the caller.
+class Metal_BVHOverlap : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(Metal_BVHOverlap, Standard_Transient)
+public:
+
+  //! Create uninitialized tool.
+  Standard_EXPORT Metal_BVHOverlap();
+
+  //! Destructor.
+  Standard_EXPORT ~Metal_BVHOverlap() override;
+
+  //! Compile compute kernel.
+  //! @return FALSE if kernel cannot be created
+  Standard_EXPORT bool Init(Metal_Context* theCtx);
+
+  //! Return TRUE if kernel has been compiled.
+  bool IsValid() const { return !myPipeline.IsNull() && myPipeline->IsValid(); }
+
+  //! Release GPU resources.
+  Standard_EXPORT void Release(Metal_Context* theCtx);
+
+  //! Find pairs of leaves of two trees with boxes overlapping within the tolerance.
+  //! Waits for completion of GPU work.
+  //! @param theCtx       Metal context
+  //! @param theTree1     1st tree
+  //! @param theTree2     2nd tree
+  //! @param theTolerance maximum distance between boxes
+  //! @param theLeafPairs found pairs of leaves (node of 1st tree, node of 2nd tree)
+  //! @return FALSE on failure (the test should be performed on CPU)
+  Standard_EXPORT bool Perform(Metal_Context* theCtx,
+                               const occ::handle<BVH_Tree<double, 3>>& theTree1,
+                               const occ::handle<BVH_Tree<double, 3>>& theTree2,
+                               const double theTolerance,
+                               NCollection_Vector<NCollection_Vec2<int>>& theLeafPairs);
+
+protected:
+
+  occ::handle<Metal_ComputePipeline> myPipeline; //!< tree traversal kernel
+  int myPairsCapacity; //!< size of pairs buffer allocated by the last run
+};
+
+#endif // Metal_BVHOverlap_HeaderFile
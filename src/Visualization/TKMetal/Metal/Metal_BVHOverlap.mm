@@ -0,0 +1,344 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#import <Metal/Metal.h>
+
+#include <Metal_BVHOverlap.hxx>
+#include <Metal_Context.hxx>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+IMPLEMENT_STANDARD_RTTIEXT(Metal_BVHOverlap, Standard_Transient)
+
+namespace
+{
+  //! Tree traversal kernel.
+  static const char* THE_BVH_OVERLAP_SHADER = R"(
+#include <metal_stdlib>
+using namespace metal;
+
+#define STACK_SIZE 64
+
+struct OverlapUniforms
+{
+  uint NbLeaves;
+  uint MaxPairs;
+  uint NbNodes;
+  uint Padding;
+};
+
+struct NodeBox
+{
+  float4 Min;
+  float4 Max;
+};
+
+inline bool isOverlap(const NodeBox theBox1, const NodeBox theBox2)
+{
+  return all(theBox1.Min.xyz <= theBox2.Max.xyz) && all(theBox1.Max.xyz >= theBox2.Min.xyz);
+}
+
+// state[0] - number of found pairs (may exceed MaxPairs), state[1] - stack overflow flag
+kernel void bvh_overlap(uint theIndex [[thread_position_in_grid]],
+                        constant OverlapUniforms& theUniforms [[buffer(0)]],
+                        const device uint* theLeaves1 [[buffer(1)]],
+                        const device NodeBox* theLeafBoxes1 [[buffer(2)]],
+                        const device NodeBox* theBoxes2 [[buffer(3)]],
+                        const device int4* theNodes2 [[buffer(4)]],
+                        device uint2* thePairs [[buffer(5)]],
+                        device atomic_uint* theState [[buffer(6)]])
+{
+  if (theIndex >= theUniforms.NbLeaves)
+  {
+    return;
+  }
+
+  const NodeBox aBox1 = theLeafBoxes1[theIndex];
+  int aStack[STACK_SIZE];
+  int aHead = 0;
+  aStack[0] = 0;
+  while (aHead >= 0)
+  {
+    const int aNode = aStack[aHead--];
+    if (!isOverlap(aBox1, theBoxes2[aNode]))
+    {
+      continue;
+    }
+
+    const int4 aData = theNodes2[aNode];
+    if (aData.x != 0)
+    {
+      const uint aSlot = atomic_fetch_add_explicit(&theState[0], 1u, memory_order_relaxed);
+      if (aSlot < theUniforms.MaxPairs)
+      {
+        thePairs[aSlot] = uint2(theLeaves1[theIndex], uint(aNode));
+      }
+    }
+    else if (aHead + 2 < STACK_SIZE)
+    {
+      aStack[++aHead] = aData.y;
+      aStack[++aHead] = aData.z;
+    }
+    else
+    {
+      atomic_store_explicit(&theState[1], 1u, memory_order_relaxed);
+      return;
+    }
+  }
+}
+)";
+
+  //! Traversal uniforms; should match OverlapUniforms in THE_BVH_OVERLAP_SHADER.
+  struct Metal_OverlapUniforms
+  {
+    uint32_t NbLeaves;
+    uint32_t MaxPairs;
+    uint32_t NbNodes;
+    uint32_t Padding;
+  };
+
+  //! Node box; should match NodeBox in THE_BVH_OVERLAP_SHADER.
+  struct Metal_NodeBox
+  {
+    float Min[4];
+    float Max[4];
+  };
+
+  //! Convert value to single precision rounding down.
+  static float roundDown(const double theValue)
+  {
+    const float aValue = static_cast<float>(theValue);
+    return double(aValue) > theValue ? std::nextafter(aValue, -std::numeric_limits<float>::infinity()) : aValue;
+  }
+
+  //! Convert value to single precision rounding up.
+  static float roundUp(const double theValue)
+  {
+    const float aValue = static_cast<float>(theValue);
+    return double(aValue) < theValue ? std::nextafter(aValue, std::numeric_limits<float>::infinity()) : aValue;
+  }
+
+  //! Convert node box to single precision box containing the box enlarged by tolerance.
+  //! The tolerance is applied in double precision in the same way as by BRepExtrema_OverlapTool,
+  //! so that comparison of rounded boxes never rejects the boxes overlapping in double precision.
+  static Metal_NodeBox convertBox(const BVH_Vec3d& theMin,
+                                  const BVH_Vec3d& theMax,
+                                  const double theTolerance)
+  {
+    Metal_NodeBox aBox;
+    for (int anAxis = 0; anAxis < 3; ++anAxis)
+    {
+      aBox.Min[anAxis] = roundDown(theMin[anAxis] - theTolerance);
+      aBox.Max[anAxis] = roundUp  (theMax[anAxis] + theTolerance);
+    }
+    aBox.Min[3] = 0.0f;
+    aBox.Max[3] = 0.0f;
+    return aBox;
+  }
+}
+
+// =======================================================================
+// function : Metal_BVHOverlap
+// purpose  : Constructor
+// =======================================================================
+Metal_BVHOverlap::Metal_BVHOverlap()
+: myPairsCapacity(0)
+{
+  //
+}
+
+// =======================================================================
+// function : ~Metal_BVHOverlap
+// purpose  : Destructor
+// =======================================================================
+Metal_BVHOverlap::~Metal_BVHOverlap()
+{
+  Release(nullptr);
+}
+
+// =======================================================================
+// function : Release
+// purpose  : Release GPU resources
+// =======================================================================
+void Metal_BVHOverlap::Release(Metal_Context* theCtx)
+{
+  if (!myPipeline.IsNull())
+  {
+    myPipeline->Release(theCtx);
+    myPipeline.Nullify();
+  }
+  myPairsCapacity = 0;
+}
+
+// =======================================================================
+// function : Init
+// purpose  : Compile compute kernel
+// =======================================================================
+bool Metal_BVHOverlap::Init(Metal_Context* theCtx)
+{
+  if (IsValid())
+  {
+    return true;
+  }
+  if (theCtx == nullptr)
+  {
+    return false;
+  }
+
+  NSError* anError = nil;
+  id<MTLLibrary> aLibrary = theCtx->LoadShaderLibrary("Metal_BVHOverlap_THE_BVH_OVERLAP_SHADER",
+                                                      [NSString stringWithUTF8String:THE_BVH_OVERLAP_SHADER],
+                                                      nil, &anError);
+  if (aLibrary == nil)
+  {
+    theCtx->Messenger()->SendFail() << "Metal_BVHOverlap: failed to compile traversal kernel: "
+                                    << (anError != nil ? [[anError localizedDescription] UTF8String] : "");
+    return false;
+  }
+
+  myPipeline = new Metal_ComputePipeline();
+  if (!myPipeline->Init(theCtx, aLibrary, @"bvh_overlap"))
+  {
+    theCtx->Messenger()->SendFail() << "Metal_BVHOverlap: failed to create traversal pipeline";
+    Release(theCtx);
+    return false;
+  }
+  return true;
+}
+
+// =======================================================================
+// function : Perform
+// purpose  : Find pairs of leaves with overlapping boxes
+// =======================================================================
+bool Metal_BVHOverlap::Perform(Metal_Context* theCtx,
+                               const occ::handle<BVH_Tree<double, 3>>& theTree1,
+                               const occ::handle<BVH_Tree<double, 3>>& theTree2,
+                               const double theTolerance,
+                               NCollection_Vector<NCollection_Vec2<int>>& theLeafPairs)
+{
+  theLeafPairs.Clear();
+  if (!IsValid() || theCtx == nullptr || theTree1.IsNull() || theTree2.IsNull())
+  {
+    return false;
+  }
+  if (theTree1->Length() == 0 || theTree2->Length() == 0)
+  {
+    return true;
+  }
+
+  // leaves of the 1st tree and all nodes of the 2nd tree (boxes enlarged by tolerance)
+  std::vector<uint32_t>      aLeaves1;
+  std::vector<Metal_NodeBox> aLeafBoxes1;
+  for (int aNode = 0; aNode < theTree1->Length(); ++aNode)
+  {
+    if (theTree1->IsOuter(aNode))
+    {
+      aLeaves1.push_back(uint32_t(aNode));
+      aLeafBoxes1.push_back(convertBox(theTree1->MinPoint(aNode), theTree1->MaxPoint(aNode), 0.0));
+    }
+  }
+
+  const int aNbNodes2 = theTree2->Length();
+  std::vector<Metal_NodeBox> aBoxes2(aNbNodes2);
+  for (int aNode = 0; aNode < aNbNodes2; ++aNode)
+  {
+    aBoxes2[aNode] = convertBox(theTree2->MinPoint(aNode), theTree2->MaxPoint(aNode), theTolerance);
+  }
+
+  id<MTLDevice> aDevice = theCtx->Device();
+  id<MTLBuffer> aLeavesBuffer = [aDevice newBufferWithBytes:aLeaves1.data()
+                                                     length:aLeaves1.size() * sizeof(uint32_t)
+                                                    options:MTLResourceStorageModeShared];
+  id<MTLBuffer> aLeafBoxesBuffer = [aDevice newBufferWithBytes:aLeafBoxes1.data()
+                                                        length:aLeafBoxes1.size() * sizeof(Metal_NodeBox)
+                                                       options:MTLResourceStorageModeShared];
+  id<MTLBuffer> aBoxesBuffer = [aDevice newBufferWithBytes:aBoxes2.data()
+                                                    length:aBoxes2.size() * sizeof(Metal_NodeBox)
+                                                   options:MTLResourceStorageModeShared];
+  id<MTLBuffer> aNodesBuffer = [aDevice newBufferWithBytes:&theTree2->NodeInfoBuffer().front()
+                                                    length:size_t(aNbNodes2) * sizeof(BVH_Vec4i)
+                                                   options:MTLResourceStorageModeShared];
+  id<MTLBuffer> aStateBuffer = [aDevice newBufferWithLength:2 * sizeof(uint32_t)
+                                                    options:MTLResourceStorageModeShared];
+  if (aLeavesBuffer == nil || aLeafBoxesBuffer == nil || aBoxesBuffer == nil
+   || aNodesBuffer == nil || aStateBuffer == nil)
+  {
+    return false;
+  }
+
+  // start with the capacity of the previous run, repeating the run once if it is exceeded
+  int aCapacity = std::max(myPairsCapacity, 4 * int(aLeaves1.size()));
+  for (int aRunIter = 0; aRunIter < 2; ++aRunIter)
+  {
+    id<MTLBuffer> aPairsBuffer = [aDevice newBufferWithLength:size_t(aCapacity) * 2 * sizeof(uint32_t)
+                                                      options:MTLResourceStorageModeShared];
+    if (aPairsBuffer == nil)
+    {
+      return false;
+    }
+    uint32_t* aState = static_cast<uint32_t*>([aStateBuffer contents]);
+    aState[0] = 0;
+    aState[1] = 0;
+
+    Metal_OverlapUniforms aUniforms;
+    aUniforms.NbLeaves = uint32_t(aLeaves1.size());
+    aUniforms.MaxPairs = uint32_t(aCapacity);
+    aUniforms.NbNodes  = uint32_t(aNbNodes2);
+    aUniforms.Padding  = 0;
+
+    id<MTLCommandBuffer> aCmdBuffer = [theCtx->CommandQueue() commandBuffer];
+    id<MTLComputeCommandEncoder> anEncoder = [aCmdBuffer computeCommandEncoder];
+    if (anEncoder == nil)
+    {
+      return false;
+    }
+    anEncoder.label = @"BVHOverlap";
+    [anEncoder setComputePipelineState:myPipeline->PipelineState()];
+    [anEncoder setBytes:&aUniforms length:sizeof(aUniforms) atIndex:0];
+    [anEncoder setBuffer:aLeavesBuffer    offset:0 atIndex:1];
+    [anEncoder setBuffer:aLeafBoxesBuffer offset:0 atIndex:2];
+    [anEncoder setBuffer:aBoxesBuffer     offset:0 atIndex:3];
+    [anEncoder setBuffer:aNodesBuffer     offset:0 atIndex:4];
+    [anEncoder setBuffer:aPairsBuffer     offset:0 atIndex:5];
+    [anEncoder setBuffer:aStateBuffer     offset:0 atIndex:6];
+    const NSUInteger aGroupSize = static_cast<NSUInteger>(std::max(myPipeline->ThreadExecutionWidth(), 1));
+    [anEncoder dispatchThreadgroups:MTLSizeMake((aLeaves1.size() + aGroupSize - 1) / aGroupSize, 1, 1)
+              threadsPerThreadgroup:MTLSizeMake(aGroupSize, 1, 1)];
+    [anEncoder endEncoding];
+    [aCmdBuffer commit];
+    [aCmdBuffer waitUntilCompleted];
+    if (aCmdBuffer.status != MTLCommandBufferStatusCompleted || aState[1] != 0)
+    {
+      return false;
+    }
+
+    const int aNbPairs = int(aState[0]);
+    if (aNbPairs > aCapacity)
+    {
+      aCapacity = aNbPairs;
+      continue;
+    }
+
+    myPairsCapacity = aCapacity;
+    const uint32_t* aPairs = static_cast<const uint32_t*>([aPairsBuffer contents]);
+    for (int aPairIter = 0; aPairIter < aNbPairs; ++aPairIter)
+    {
+      theLeafPairs.Append(NCollection_Vec2<int>(int(aPairs[2 * aPairIter]), int(aPairs[2 * aPairIter + 1])));
+    }
+    return true;
+  }
+  return false;
+}
@@ -181,9 +181,9 @@ fragment float4 cubemapFragment(
     NSError* anError = nil;
 
     // Compile gradient shader
-    id<MTLLibrary> aGradientLib = [aDevice newLibraryWithSource:[NSString stringWithUTF8String:THE_BACKGROUND_SHADER]
-                                                         options:nil
-                                                           error:&anError];
+    id<MTLLibrary> aGradientLib = theCtx->LoadShaderLibrary("Metal_BackgroundRenderer_THE_BACKGROUND_SHADER",
+                                                            [NSString stringWithUTF8String:THE_BACKGROUND_SHADER],
+                                                            nil, &anError);
     if (aGradientLib == nil)
     {
       NSLog(@"Metal_BackgroundRenderer: Failed to compile gradient shader: %@", anError);
@@ -208,9 +208,9 @@ fragment float4 cubemapFragment(
     }
 
     // Compile cubemap shader
-    id<MTLLibrary> aCubemapLib = [aDevice newLibraryWithSource:[NSString stringWithUTF8String:THE_CUBEMAP_SHADER]
-                                                        options:nil
-                                                          error:&anError];
+    id<MTLLibrary> aCubemapLib = theCtx->LoadShaderLibrary("Metal_BackgroundRenderer_THE_CUBEMAP_SHADER",
+                                                           [NSString stringWithUTF8String:THE_CUBEMAP_SHADER],
+                                                           nil, &anError);
     if (aCubemapLib == nil)
     {
       NSLog(@"Metal_BackgroundRenderer: Failed to compile cubemap shader: %@", anError);
@@ -0,0 +1,164 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef Metal_BindlessTable_HeaderFile
+#define Metal_BindlessTable_HeaderFile
+
+#include <Metal_BufferAllocator.hxx>
+#include <Metal_ShaderManager.hxx>
+#include <NCollection_DataMap.hxx>
+#include <NCollection_List.hxx>
+#include <NCollection_Vector.hxx>
+
+#include <mutex>
+
+#ifdef __OBJC__
+@protocol MTLArgumentEncoder;
+@protocol MTLBuffer;
+@protocol MTLRenderCommandEncoder;
+@protocol MTLTexture;
+@class NSMutableArray;
+#endif
+
+class Metal_Context;
+class Metal_Texture;
+
+//! Bindless resources table: all materials in one GPU buffer and all registered textures
+//! in a single Tier-2 argument buffer.
+//! The texture table is bound once per render encoder (see Bind()), while a draw selects
+//! its material only by the offset of the material table binding (see BindMaterial()),
+//! instead of copying material uniforms into the command stream.
+//! Materials are interned by content and never modified after insertion,
+//! so that entries referenced by frames in flight stay valid while the table grows.
+//! Texture slots released by UnregisterTexture() are reused only after the frames in flight.
+//! Methods are thread-safe for workspaces of parallel encoding.
+class Metal_BindlessTable : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(Metal_BindlessTable, Standard_Transient)
+public:
+
+  //! Stride of material entries (constant buffer offsets should be 256-byte aligned on macOS).
+  static constexpr size_t MaterialStride = 256;
+
+  //! Initial capacity of the material buffer.
+  static constexpr int InitialMaterialCapacity = 256;
+
+  //! Default number of texture slots in the argument buffer.
+  static constexpr int DefaultTextureCapacity = 4096;
+
+  //! Fragment buffer index of the material table (same as Metal_Workspace::ApplyMaterialUniforms()).
+  static constexpr int MaterialBufferIndex = 2;
+
+  //! Fragment buffer index of the texture argument buffer.
+  static constexpr int TextureTableIndex = 8;
+
+public:
+
+  //! Return TRUE if bindless path should be used within the context
+  //! (Metal_Caps::useArgumentBuffers and Tier-2 argument buffers support).
+  Standard_EXPORT static bool IsSupported(const Metal_Context* theCtx);
+
+  //! Empty constructor.
+  Standard_EXPORT Metal_BindlessTable();
+
+  //! Destructor.
+  Standard_EXPORT ~Metal_BindlessTable() override;
+
+  //! Allocate material buffer and texture argument buffer.
+  Standard_EXPORT bool Init(Metal_Context* theCtx, int theTextureCapacity = DefaultTextureCapacity);
+
+  //! Release GPU resources.
+  Standard_EXPORT void Release(Metal_Context* theCtx);
+
+  //! Return TRUE if table has been initialized.
+  bool IsValid() const { return !myMaterials.IsNull(); }
+
+  //! Return the number of stored materials.
+  int NbMaterials() const { return myNbMaterials; }
+
+  //! Return the number of registered textures.
+  int NbTextures() const { return myTextureSlots.Extent(); }
+
+  //! Return revision incremented on reallocation of the material buffer and on texture registration,
+  //! so that encoders bound to older revision should be re-bound.
+  size_t Revision() const { return myRevision; }
+
+  //! Find or append material and return its index within the table, or -1 on failure.
+  Standard_EXPORT int AddMaterial(Metal_Context* theCtx, const Metal_MaterialUniforms& theMaterial);
+
+  //! Register texture within the argument buffer.
+  //! @return texture index (same for already registered texture) or -1 if the table is full
+  Standard_EXPORT int RegisterTexture(const occ::handle<Metal_Texture>& theTexture);
+
+  //! Remove texture from the table; its slot is reused after the frames in flight.
+  Standard_EXPORT void UnregisterTexture(const Metal_Texture* theTexture);
+
+  //! Mark the end of a frame (frees retired texture slots).
+  Standard_EXPORT void FrameSubmitted();
+
+#ifdef __OBJC__
+  //! Bind texture argument buffer to render encoder and make registered textures resident.
+  //! Should be called once per encoder (and after revision change).
+  Standard_EXPORT void Bind(id<MTLRenderCommandEncoder> theEncoder) const;
+
+  //! Bind material with specified index at MaterialBufferIndex.
+  Standard_EXPORT void BindMaterial(id<MTLRenderCommandEncoder> theEncoder, int theIndex) const;
+#endif
+
+protected:
+
+  //! Reallocate material buffer to fit the specified number of materials.
+  Standard_EXPORT bool growMaterials(Metal_Context* theCtx, int theCapacity);
+
+  //! Compute hash of material content.
+  Standard_EXPORT static size_t materialHash(const Metal_MaterialUniforms& theMaterial);
+
+protected:
+
+  //! Texture slot waiting for frames in flight.
+  struct RetiredSlot
+  {
+    int    Slot;  //!< slot index
+    size_t Frame; //!< frame counter at retirement
+  };
+
+protected:
+
+  Metal_Context*                            myContext;       //!< owning context (for freeing allocations)
+  occ::handle<Metal_BufferAllocation>       myMaterials;     //!< material entries
+  NCollection_DataMap<size_t, int>          myMaterialIds;   //!< material hash -> index
+  int                                       myNbMaterials;   //!< number of stored materials
+  int                                       myMaterialCapacity; //!< capacity of material buffer
+  size_t                                    myRevision;      //!< material buffer revision
+
+  NCollection_DataMap<const Metal_Texture*, int> myTextureSlots; //!< texture -> slot index
+  NCollection_Vector<occ::handle<Metal_Texture>> myTextures;     //!< textures per slot
+  NCollection_List<int>                     myFreeSlots;     //!< reusable texture slots
+  NCollection_List<RetiredSlot>             myRetiredSlots;  //!< released slots used by frames in flight
+  int                                       myTextureCapacity; //!< number of argument buffer slots
+  size_t                                    myFrameCounter;  //!< number of submitted frames
+  int                                       myFramesInFlight; //!< frames to wait before slot reuse
+  mutable std::mutex                        myMutex;         //!< lock for thread-safety
+
+#ifdef __OBJC__
+  id<MTLArgumentEncoder> myTextureEncoder;   //!< encoder of texture array
+  id<MTLBuffer>          myTextureBuffer;    //!< texture argument buffer
+  NSMutableArray*        myResidentTextures; //!< native textures for residency (useResources)
+#else
+  void*                  myTextureEncoder;
+  void*                  myTextureBuffer;
+  void*                  myResidentTextures;
+#endif
+};
+
+#endif // Metal_BindlessTable_HeaderFile
@@ -0,0 +1,357 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#import <Metal/Metal.h>
+
+#include <Metal_BindlessTable.hxx>
+#include <Metal_Context.hxx>
+#include <Metal_Texture.hxx>
+
+#include <algorithm>
+#include <cstring>
+
+IMPLEMENT_STANDARD_RTTIEXT(Metal_BindlessTable, Standard_Transient)
+
+// =======================================================================
+// function : IsSupported
+// purpose  : Check if bindless path should be used
+// =======================================================================
+bool Metal_BindlessTable::IsSupported(const Metal_Context* theCtx)
+{
+  return theCtx != nullptr
+      && theCtx->Caps()->useArgumentBuffers
+      && theCtx->HasArgumentBuffersTier2();
+}
+
+// =======================================================================
+// function : Metal_BindlessTable
+// purpose  : Constructor
+// =======================================================================
+Metal_BindlessTable::Metal_BindlessTable()
+: myContext(nullptr),
+  myNbMaterials(0),
+  myMaterialCapacity(0),
+  myRevision(0),
+  myTextureCapacity(0),
+  myFrameCounter(0),
+  myFramesInFlight(Metal_MaxFramesInFlight),
+  myTextureEncoder(nil),
+  myTextureBuffer(nil),
+  myResidentTextures(nil)
+{
+  //
+}
+
+// =======================================================================
+// function : ~Metal_BindlessTable
+// purpose  : Destructor
+// =======================================================================
+Metal_BindlessTable::~Metal_BindlessTable()
+{
+  Release(myContext);
+}
+
+// =======================================================================
+// function : Init
+// purpose  : Allocate material buffer and texture argument buffer
+// =======================================================================
+bool Metal_BindlessTable::Init(Metal_Context* theCtx, int theTextureCapacity)
+{
+  Release(myContext);
+  if (theCtx == nullptr || !theCtx->IsValid() || theCtx->BufferAllocator().IsNull())
+  {
+    return false;
+  }
+
+  myContext = theCtx;
+  myFramesInFlight = std::max(theCtx->Caps()->maxFramesInFlight, 1);
+  if (!growMaterials(theCtx, InitialMaterialCapacity))
+  {
+    theCtx->Messenger()->SendWarning() << "Metal_BindlessTable: unable to allocate material buffer";
+    Release(theCtx);
+    return false;
+  }
+
+  // texture array argument buffer, requires Tier-2 for large arrays
+  if (theTextureCapacity > 0 && theCtx->HasArgumentBuffersTier2())
+  {
+    MTLArgumentDescriptor* anArgDesc = [MTLArgumentDescriptor argumentDescriptor];
+    anArgDesc.index       = 0;
+    anArgDesc.dataType    = MTLDataTypeTexture;
+    anArgDesc.textureType = MTLTextureType2D;
+    anArgDesc.access      = MTLArgumentAccessReadOnly;
+    anArgDesc.arrayLength = static_cast<NSUInteger>(theTextureCapacity);
+    myTextureEncoder = [theCtx->Device() newArgumentEncoderWithArguments:@[anArgDesc]];
+    if (myTextureEncoder != nil)
+    {
+      myTextureBuffer = [theCtx->Device() newBufferWithLength:myTextureEncoder.encodedLength
+                                                      options:MTLResourceStorageModeShared];
+    }
+    if (myTextureBuffer == nil)
+    {
+      theCtx->Messenger()->SendWarning() << "Metal_BindlessTable: unable to create texture argument buffer";
+      myTextureEncoder = nil;
+    }
+    else
+    {
+      [myTextureEncoder setArgumentBuffer:myTextureBuffer offset:0];
+      myTextureCapacity  = theTextureCapacity;
+      myResidentTextures = [[NSMutableArray alloc] initWithCapacity:64];
+    }
+  }
+  return true;
+}
+
+// =======================================================================
+// function : Release
+// purpose  : Release GPU resources
+// =======================================================================
+void Metal_BindlessTable::Release(Metal_Context* theCtx)
+{
+  if (!myMaterials.IsNull())
+  {
+    if (theCtx != nullptr && !theCtx->BufferAllocator().IsNull())
+    {
+      theCtx->BufferAllocator()->Free(myMaterials);
+    }
+    myMaterials.Nullify();
+  }
+  myMaterialIds.Clear();
+  myNbMaterials = 0;
+  myMaterialCapacity = 0;
+
+  myTextureSlots.Clear();
+  myTextures.Clear();
+  myFreeSlots.Clear();
+  myRetiredSlots.Clear();
+  myTextureCapacity = 0;
+  myTextureEncoder = nil;
+  myTextureBuffer = nil;
+  myResidentTextures = nil;
+  myContext = nullptr;
+}
+
+// =======================================================================
+// function : materialHash
+// purpose  : Compute hash of material content (FNV-1a)
+// =======================================================================
+size_t Metal_BindlessTable::materialHash(const Metal_MaterialUniforms& theMaterial)
+{
+  const unsigned char* aBytes = reinterpret_cast<const unsigned char*>(&theMaterial);
+  size_t aHash = 14695981039346656037ull;
+  for (size_t aByteIter = 0; aByteIter < sizeof(Metal_MaterialUniforms); ++aByteIter)
+  {
+    aHash = (aHash ^ aBytes[aByteIter]) * 1099511628211ull;
+  }
+  return aHash;
+}
+
+// =======================================================================
+// function : growMaterials
+// purpose  : Reallocate material buffer
+// =======================================================================
+bool Metal_BindlessTable::growMaterials(Metal_Context* theCtx, int theCapacity)
+{
+  occ::handle<Metal_BufferAllocation> aNewAlloc =
+    theCtx->BufferAllocator()->Allocate(size_t(theCapacity) * MaterialStride,
+                                        Metal_StorageMode_Shared, MaterialStride);
+  if (aNewAlloc.IsNull())
+  {
+    return false;
+  }
+
+  if (!myMaterials.IsNull())
+  {
+    // existing entries are immutable - frames in flight keep reading the old range,
+    // which is reclaimed by allocator only after them
+    memcpy(aNewAlloc->Contents(), myMaterials->Contents(), size_t(myNbMaterials) * MaterialStride);
+    theCtx->BufferAllocator()->Free(myMaterials);
+  }
+  myMaterials = aNewAlloc;
+  myMaterialCapacity = theCapacity;
+  ++myRevision;
+  return true;
+}
+
+// =======================================================================
+// function : AddMaterial
+// purpose  : Find or append material
+// =======================================================================
+int Metal_BindlessTable::AddMaterial(Metal_Context* theCtx, const Metal_MaterialUniforms& theMaterial)
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  if (myMaterials.IsNull())
+  {
+    return -1;
+  }
+
+  const size_t aHash = materialHash(theMaterial);
+  int anIndex = -1;
+  if (myMaterialIds.Find(aHash, anIndex)
+   && memcmp(myMaterials->Contents() + size_t(anIndex) * MaterialStride,
+             &theMaterial, sizeof(Metal_MaterialUniforms)) == 0)
+  {
+    return anIndex;
+  }
+
+  if (myNbMaterials >= myMaterialCapacity
+  && !growMaterials(theCtx, myMaterialCapacity * 2))
+  {
+    theCtx->Messenger()->SendWarning() << "Metal_BindlessTable: unable to grow material buffer to "
+                                       << myMaterialCapacity * 2 << " entries";
+    return -1;
+  }
+
+  const int aNewIndex = myNbMaterials++;
+  memcpy(myMaterials->Contents() + size_t(aNewIndex) * MaterialStride,
+         &theMaterial, sizeof(Metal_MaterialUniforms));
+  if (anIndex == -1)
+  {
+    // on hash collision the first material keeps the map entry
+    myMaterialIds.Bind(aHash, aNewIndex);
+  }
+  return aNewIndex;
+}
+
+// =======================================================================
+// function : RegisterTexture
+// purpose  : Register texture within the argument buffer
+// =======================================================================
+int Metal_BindlessTable::RegisterTexture(const occ::handle<Metal_Texture>& theTexture)
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  if (theTexture.IsNull() || theTexture->Texture() == nil || myTextureEncoder == nil)
+  {
+    return -1;
+  }
+
+  int aSlot = -1;
+  if (myTextureSlots.Find(theTexture.get(), aSlot))
+  {
+    return aSlot;
+  }
+
+  if (!myFreeSlots.IsEmpty())
+  {
+    aSlot = myFreeSlots.First();
+    myFreeSlots.RemoveFirst();
+  }
+  else if (myTextures.Size() < myTextureCapacity)
+  {
+    aSlot = myTextures.Size();
+    myTextures.Append(occ::handle<Metal_Texture>());
+  }
+  else
+  {
+    return -1;
+  }
+
+  myTextures.ChangeValue(aSlot) = theTexture;
+  myTextureSlots.Bind(theTexture.get(), aSlot);
+  [myTextureEncoder setTexture:theTexture->Texture() atIndex:static_cast<NSUInteger>(aSlot)];
+  [myResidentTextures addObject:theTexture->Texture()];
+  ++myRevision;
+  return aSlot;
+}
+
+// =======================================================================
+// function : UnregisterTexture
+// purpose  : Remove texture from the table
+// =======================================================================
+void Metal_BindlessTable::UnregisterTexture(const Metal_Texture* theTexture)
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  int aSlot = -1;
+  if (theTexture == nullptr || !myTextureSlots.Find(theTexture, aSlot))
+  {
+    return;
+  }
+
+  if (theTexture->Texture() != nil)
+  {
+    [myResidentTextures removeObjectIdenticalTo:theTexture->Texture()];
+  }
+  myTextureSlots.UnBind(theTexture);
+
+  // keep the slot encoded until frames in flight complete
+  RetiredSlot aRetired;
+  aRetired.Slot  = aSlot;
+  aRetired.Frame = myFrameCounter;
+  myRetiredSlots.Append(aRetired);
+  myTextures.ChangeValue(aSlot).Nullify();
+}
+
+// =======================================================================
+// function : FrameSubmitted
+// purpose  : Free retired texture slots
+// =======================================================================
+void Metal_BindlessTable::FrameSubmitted()
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  ++myFrameCounter;
+  while (!myRetiredSlots.IsEmpty()
+       && myRetiredSlots.First().Frame + size_t(myFramesInFlight) <= myFrameCounter)
+  {
+    const int aSlot = myRetiredSlots.First().Slot;
+    myRetiredSlots.RemoveFirst();
+    if (myTextureEncoder != nil)
+    {
+      [myTextureEncoder setTexture:nil atIndex:static_cast<NSUInteger>(aSlot)];
+    }
+    myFreeSlots.Append(aSlot);
+  }
+}
+
+// =======================================================================
+// function : Bind
+// purpose  : Bind table to render encoder
+// =======================================================================
+void Metal_BindlessTable::Bind(id<MTLRenderCommandEncoder> theEncoder) const
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  if (theEncoder == nil || myTextureBuffer == nil)
+  {
+    return;
+  }
+
+  [theEncoder setFragmentBuffer:myTextureBuffer offset:0 atIndex:TextureTableIndex];
+  // textures referenced only through argument buffer should be made resident explicitly
+  for (id<MTLTexture> aTexture in myResidentTextures)
+  {
+    if (@available(macOS 10.15, iOS 13.0, *))
+    {
+      [theEncoder useResource:aTexture usage:MTLResourceUsageRead stages:MTLRenderStageFragment];
+    }
+    else
+    {
+      [theEncoder useResource:aTexture usage:MTLResourceUsageRead];
+    }
+  }
+}
+
+// =======================================================================
+// function : BindMaterial
+// purpose  : Bind material with specified index
+// =======================================================================
+void Metal_BindlessTable::BindMaterial(id<MTLRenderCommandEncoder> theEncoder, int theIndex) const
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  if (theEncoder == nil || myMaterials.IsNull() || theIndex < 0 || theIndex >= myNbMaterials)
+  {
+    return;
+  }
+
+  [theEncoder setFragmentBuffer:myMaterials->Buffer()
+                         offset:myMaterials->Offset() + size_t(theIndex) * MaterialStride
+                        atIndex:MaterialBufferIndex];
+}
@@ -14,6 +14,7 @@
 #ifndef Metal_Buffer_HeaderFile
 #define Metal_Buffer_HeaderFile
 
+#include <Metal_BufferAllocator.hxx>
 #include <Metal_Resource.hxx>
 #include <TCollection_AsciiString.hxx>
 
@@ -23,16 +24,9 @@
 
 class Metal_Context;
 
-//! Metal storage mode for buffer allocation.
-enum Metal_StorageMode
-{
-  Metal_StorageMode_Shared = 0,  //!< CPU and GPU access, not cached on GPU (unified memory)
-  Metal_StorageMode_Managed = 1, //!< CPU and GPU access with explicit synchronization
-  Metal_StorageMode_Private = 2  //!< GPU only access, optimal performance
-};
-
 //! Buffer Object - is a general storage object for arbitrary data (see sub-classes).
-//! Wraps MTLBuffer for Metal GPU memory management.
+//! Data is sub-allocated from heap blocks of Metal_BufferAllocator,
+//! so that the buffer should be bound with both Buffer() and Offset().
 class Metal_Buffer : public Metal_Resource
 {
   DEFINE_STANDARD_RTTIEXT(Metal_Buffer, Metal_Resource)
@@ -46,7 +40,7 @@ public:
   Standard_EXPORT ~Metal_Buffer() override;
 
   //! @return true if current object was initialized
-  bool IsValid() const { return myBuffer != nullptr; }
+  bool IsValid() const { return !myAllocation.IsNull() && myAllocation->IsValid(); }
 
   //! @return the number of components per generic vertex attribute.
   unsigned int GetComponentsNb() const { return myComponentsNb; }
@@ -109,7 +103,29 @@ public:
                             int theElemsNb,
                             const uint8_t* theData);
 
+  //! Wrap range of application buffer by GPU buffer without copying.
+  //! Requires unified memory and page-aligned memory of theOwner (see Metal_PageAllocator);
+  //! the data is read by GPU directly from theOwner, which should not be modified while in use.
+  //! @param theCtx Metal context
+  //! @param theComponentsNb number of components per element (1-4)
+  //! @param theElemsNb number of elements
+  //! @param theDataTypeSize size of component in bytes
+  //! @param theOwner buffer owning the memory
+  //! @param theOffset offset of the data within theOwner in bytes
+  //! @return FALSE if memory cannot be adopted, so that it should be copied by Init() instead
+  Standard_EXPORT bool Adopt(Metal_Context* theCtx,
+                             unsigned int theComponentsNb,
+                             int theElemsNb,
+                             size_t theDataTypeSize,
+                             const occ::handle<NCollection_Buffer>& theOwner,
+                             size_t theOffset);
+
+  //! Return TRUE if buffer wraps application memory without copying.
+  bool IsAdopted() const { return !myAllocation.IsNull() && myAllocation->IsAdopted(); }
+
   //! Update portion of buffer data.
+  //! Private storage is updated by blit with 4-byte granularity,
+  //! so that the range should be 4-byte aligned unless it ends at buffer end.
   //! @param theCtx Metal context
   //! @param theElemFrom starting element index
   //! @param theElemsNb number of elements to update
@@ -135,26 +151,37 @@ public:
   Standard_EXPORT void Release(Metal_Context* theCtx) override;
 
 #ifdef __OBJC__
-  //! Return native Metal buffer object.
-  id<MTLBuffer> Buffer() const { return myBuffer; }
+  //! Return native Metal buffer object holding the data (shared with other buffers).
+  id<MTLBuffer> Buffer() const { return !myAllocation.IsNull() ? myAllocation->Buffer() : nullptr; }
 #endif
 
+  //! Return offset of the data within Buffer() in bytes.
+  size_t Offset() const { return !myAllocation.IsNull() ? myAllocation->Offset() : 0; }
+
+  //! Return memory range allocated for this buffer.
+  const occ::handle<Metal_BufferAllocation>& Allocation() const { return myAllocation; }
+
 protected:
 
+  //! Return storage mode for static vertex and index data:
+  //! private on devices without unified memory when Metal_Caps::usePrivateVertexBuffers is set.
+  Standard_EXPORT static Metal_StorageMode staticStorageMode(const Metal_Context* theCtx);
+
+  //! Return storage mode for data partially updated by CPU (see SubData()):
+  //! managed on devices without unified memory, so that only the modified range is synchronized.
+  Standard_EXPORT static Metal_StorageMode dynamicStorageMode(const Metal_Context* theCtx);
+
   //! Initialize internal data from raw pointer.
   Standard_EXPORT bool initData(Metal_Context* theCtx,
                                 unsigned int theComponentsNb,
                                 int theElemsNb,
                                 size_t theDataTypeSize,
-                                const void* theData);
+                                const void* theData,
+                                Metal_StorageMode theMode = Metal_StorageMode_Shared);
 
 protected:
 
-#ifdef __OBJC__
-  id<MTLBuffer> myBuffer;       //!< Metal buffer object
-#else
-  void*         myBuffer;       //!< Metal buffer object (opaque)
-#endif
+  occ::handle<Metal_BufferAllocation> myAllocation; //!< memory range within allocator block
   size_t            mySize;         //!< buffer size in bytes
   unsigned int      myComponentsNb; //!< number of components per element
   int               myElemsNb;      //!< number of elements
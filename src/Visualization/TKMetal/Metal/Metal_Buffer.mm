@@ -15,6 +15,7 @@
 
 #include <Metal_Buffer.hxx>
 #include <Metal_Context.hxx>
+#include <Metal_PageAllocator.hxx>
 #include <Standard_Assert.hxx>
 
 IMPLEMENT_STANDARD_RTTIEXT(Metal_Buffer, Metal_Resource)
@@ -24,8 +25,7 @@ IMPLEMENT_STANDARD_RTTIEXT(Metal_Buffer, Metal_Resource)
 // purpose  : Constructor
 // =======================================================================
 Metal_Buffer::Metal_Buffer()
-: myBuffer(nil),
-  mySize(0),
+: mySize(0),
   myComponentsNb(4),
   myElemsNb(0),
   myDataTypeSize(sizeof(float)),
@@ -41,7 +41,7 @@ Metal_Buffer::Metal_Buffer()
 Metal_Buffer::~Metal_Buffer()
 {
   // Buffer should be released explicitly before destruction
-  Standard_ASSERT_RAISE(myBuffer == nil,
+  Standard_ASSERT_RAISE(myAllocation.IsNull(),
     "Metal_Buffer destroyed without explicit Release()");
 }
 
@@ -56,70 +56,84 @@ bool Metal_Buffer::Create(Metal_Context* theCtx,
 {
   Release(theCtx);
 
-  if (theCtx == nullptr || !theCtx->IsValid() || theSize == 0)
+  if (theCtx == nullptr || !theCtx->IsValid() || theSize == 0
+   || theCtx->BufferAllocator().IsNull())
   {
     return false;
   }
 
   myStorageMode = theMode;
+#if !TARGET_OS_OSX
+  // Managed storage not available on iOS, use shared
+  if (myStorageMode == Metal_StorageMode_Managed)
+  {
+    myStorageMode = Metal_StorageMode_Shared;
+  }
+#endif
+
+  myAllocation = theCtx->BufferAllocator()->Allocate(theSize, myStorageMode);
+  if (myAllocation.IsNull())
+  {
+    return false;
+  }
   mySize = theSize;
 
-  // Map storage mode to Metal resource options
-  MTLResourceOptions aOptions = MTLResourceStorageModeShared;
-  switch (theMode)
+  if (theData == nullptr)
   {
-    case Metal_StorageMode_Shared:
-      aOptions = MTLResourceStorageModeShared;
-      break;
-    case Metal_StorageMode_Managed:
+    return true;
+  }
+
+  if (myStorageMode != Metal_StorageMode_Private)
+  {
+    memcpy(myAllocation->Contents(), theData, theSize);
 #if TARGET_OS_OSX
-      aOptions = MTLResourceStorageModeManaged;
-#else
-      // Managed storage not available on iOS, use shared
-      aOptions = MTLResourceStorageModeShared;
-      myStorageMode = Metal_StorageMode_Shared;
+    if (myStorageMode == Metal_StorageMode_Managed)
+    {
+      [myAllocation->Buffer() didModifyRange:NSMakeRange(myAllocation->Offset(), theSize)];
+    }
 #endif
-      break;
-    case Metal_StorageMode_Private:
-      aOptions = MTLResourceStorageModePrivate;
-      break;
+    return true;
   }
 
-  id<MTLDevice> aDevice = theCtx->Device();
-  if (theData != nullptr && theMode != Metal_StorageMode_Private)
+  // For private storage, initial data is copied by blit through staging ring;
+  // new range is not accessed by submitted frames, so that it is uploaded on transfer queue
+  if (theCtx->StagingRing().IsNull()
+   || !theCtx->StagingRing()->Upload(theCtx, theData, theSize,
+                                     myAllocation->Buffer(), myAllocation->Offset(), true))
   {
-    // Create buffer with initial data
-    myBuffer = [aDevice newBufferWithBytes:theData
-                                    length:theSize
-                                   options:aOptions];
+    Release(theCtx);
+    return false;
   }
-  else
-  {
-    // Create empty buffer
-    myBuffer = [aDevice newBufferWithLength:theSize
-                                    options:aOptions];
+  return true;
+}
 
-    // For private storage with initial data, need to use blit encoder
-    if (theData != nullptr && theMode == Metal_StorageMode_Private)
-    {
-      // Create staging buffer
-      id<MTLBuffer> aStagingBuffer = [aDevice newBufferWithBytes:theData
-                                                          length:theSize
-                                                         options:MTLResourceStorageModeShared];
-
-      // Copy using blit encoder
-      id<MTLCommandBuffer> aCmdBuffer = theCtx->CurrentCommandBuffer();
-      id<MTLBlitCommandEncoder> aBlitEncoder = [aCmdBuffer blitCommandEncoder];
-      [aBlitEncoder copyFromBuffer:aStagingBuffer
-                      sourceOffset:0
-                          toBuffer:myBuffer
-                 destinationOffset:0
-                              size:theSize];
-      [aBlitEncoder endEncoding];
-    }
+// =======================================================================
+// function : staticStorageMode
+// purpose  : Return storage mode for static vertex and index data
+// =======================================================================
+Metal_StorageMode Metal_Buffer::staticStorageMode(const Metal_Context* theCtx)
+{
+  if (theCtx != nullptr
+   && theCtx->Caps()->usePrivateVertexBuffers
+   && !theCtx->HasUnifiedMemory())
+  {
+    return Metal_StorageMode_Private;
   }
+  return Metal_StorageMode_Shared;
+}
 
-  return myBuffer != nil;
+// =======================================================================
+// function : dynamicStorageMode
+// purpose  : Return storage mode for partially updated data
+// =======================================================================
+Metal_StorageMode Metal_Buffer::dynamicStorageMode(const Metal_Context* theCtx)
+{
+  if (theCtx != nullptr
+  && !theCtx->HasUnifiedMemory())
+  {
+    return Metal_StorageMode_Managed;
+  }
+  return Metal_StorageMode_Shared;
 }
 
 // =======================================================================
@@ -130,7 +144,8 @@ bool Metal_Buffer::initData(Metal_Context* theCtx,
                             unsigned int theComponentsNb,
                             int theElemsNb,
                             size_t theDataTypeSize,
-                            const void* theData)
+                            const void* theData,
+                            Metal_StorageMode theMode)
 {
   if (theComponentsNb < 1 || theComponentsNb > 4 || theElemsNb <= 0)
   {
@@ -142,7 +157,47 @@ bool Metal_Buffer::initData(Metal_Context* theCtx,
   myDataTypeSize = theDataTypeSize;
 
   size_t aSize = size_t(theElemsNb) * size_t(theComponentsNb) * theDataTypeSize;
-  return Create(theCtx, aSize, theData, Metal_StorageMode_Shared);
+  return Create(theCtx, aSize, theData, theMode);
+}
+
+// =======================================================================
+// function : Adopt
+// purpose  : Wrap application memory without copying
+// =======================================================================
+bool Metal_Buffer::Adopt(Metal_Context* theCtx,
+                         unsigned int theComponentsNb,
+                         int theElemsNb,
+                         size_t theDataTypeSize,
+                         const occ::handle<NCollection_Buffer>& theOwner,
+                         size_t theOffset)
+{
+  Release(theCtx);
+  if (theCtx == nullptr || !theCtx->IsValid() || !theCtx->HasUnifiedMemory()
+   || theCtx->BufferAllocator().IsNull() || theOwner.IsNull()
+   || theComponentsNb < 1 || theComponentsNb > 4 || theElemsNb <= 0)
+  {
+    return false;
+  }
+
+  const size_t aLength = Metal_PageAllocator::AdoptableLength(*theOwner);
+  const size_t aSize = size_t(theElemsNb) * size_t(theComponentsNb) * theDataTypeSize;
+  if (aLength == 0)
+  {
+    return false;
+  }
+
+  myAllocation = theCtx->BufferAllocator()->Adopt(theOwner, aLength, theOffset, aSize);
+  if (myAllocation.IsNull())
+  {
+    return false;
+  }
+
+  myComponentsNb = theComponentsNb;
+  myElemsNb = theElemsNb;
+  myDataTypeSize = theDataTypeSize;
+  mySize = aSize;
+  myStorageMode = Metal_StorageMode_Shared;
+  return true;
 }
 
 // =======================================================================
@@ -202,7 +257,7 @@ bool Metal_Buffer::SubData(Metal_Context* theCtx,
                            int theElemsNb,
                            const void* theData)
 {
-  if (myBuffer == nil || theCtx == nullptr || theData == nullptr)
+  if (!IsValid() || theCtx == nullptr || theData == nullptr)
   {
     return false;
   }
@@ -217,32 +272,31 @@ bool Metal_Buffer::SubData(Metal_Context* theCtx,
 
   if (myStorageMode == Metal_StorageMode_Private)
   {
-    // For private storage, need to use staging buffer and blit
-    id<MTLDevice> aDevice = theCtx->Device();
-    id<MTLBuffer> aStagingBuffer = [aDevice newBufferWithBytes:theData
-                                                        length:aSize
-                                                       options:MTLResourceStorageModeShared];
-
-    id<MTLCommandBuffer> aCmdBuffer = theCtx->CurrentCommandBuffer();
-    id<MTLBlitCommandEncoder> aBlitEncoder = [aCmdBuffer blitCommandEncoder];
-    [aBlitEncoder copyFromBuffer:aStagingBuffer
-                    sourceOffset:0
-                        toBuffer:myBuffer
-               destinationOffset:anOffset
-                            size:aSize];
-    [aBlitEncoder endEncoding];
+    // For private storage, copy by blit through staging ring;
+    // blit works with 4-byte granularity, so that unaligned range is allowed only at buffer end
+    if ((anOffset % 4) != 0
+     || ((aSize % 4) != 0 && anOffset + aSize != mySize)
+     || theCtx->StagingRing().IsNull())
+    {
+      return false;
+    }
+    return theCtx->StagingRing()->Upload(theCtx, theData, aSize,
+                                         myAllocation->Buffer(), myAllocation->Offset() + anOffset);
   }
   else
   {
-    // For shared/managed storage, can copy directly
-    void* aContents = [myBuffer contents];
-    memcpy(static_cast<uint8_t*>(aContents) + anOffset, theData, aSize);
+    // For shared/managed storage, can copy directly;
+    // adopted memory might be updated in-place by the owner
+    if (myAllocation->Contents() + anOffset != theData)
+    {
+      memcpy(myAllocation->Contents() + anOffset, theData, aSize);
+    }
 
 #if TARGET_OS_OSX
     if (myStorageMode == Metal_StorageMode_Managed)
     {
       // Notify GPU of the modified range
-      [myBuffer didModifyRange:NSMakeRange(anOffset, aSize)];
+      [myAllocation->Buffer() didModifyRange:NSMakeRange(myAllocation->Offset() + anOffset, aSize)];
     }
 #endif
   }
@@ -261,7 +315,7 @@ bool Metal_Buffer::GetData(Metal_Context* theCtx,
 {
   (void)theCtx;
 
-  if (myBuffer == nil || theData == nullptr)
+  if (!IsValid() || theData == nullptr)
   {
     return false;
   }
@@ -278,8 +332,7 @@ bool Metal_Buffer::GetData(Metal_Context* theCtx,
     return false;
   }
 
-  const void* aContents = [myBuffer contents];
-  memcpy(theData, static_cast<const uint8_t*>(aContents) + theOffset, theSize);
+  memcpy(theData, myAllocation->Contents() + theOffset, theSize);
   return true;
 }
 
@@ -289,11 +342,14 @@ bool Metal_Buffer::GetData(Metal_Context* theCtx,
 // =======================================================================
 void Metal_Buffer::Release(Metal_Context* theCtx)
 {
-  (void)theCtx;
-
-  if (myBuffer != nil)
+  if (!myAllocation.IsNull())
   {
-    myBuffer = nil;
+    // range is returned to the shared allocator, or just dropped when context is already gone
+    if (theCtx != nullptr && !theCtx->BufferAllocator().IsNull())
+    {
+      theCtx->BufferAllocator()->Free(myAllocation);
+    }
+    myAllocation.Nullify();
   }
 
   mySize = 0;
@@ -0,0 +1,302 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef Metal_BufferAllocator_HeaderFile
+#define Metal_BufferAllocator_HeaderFile
+
+#include <Metal_StorageMode.hxx>
+#include <NCollection_Buffer.hxx>
+#include <NCollection_List.hxx>
+#include <NCollection_Map.hxx>
+#include <NCollection_Sequence.hxx>
+#include <NCollection_Vector.hxx>
+#include <Standard_Transient.hxx>
+
+#include <mutex>
+
+#ifdef __OBJC__
+@protocol MTLBuffer;
+@protocol MTLDevice;
+@protocol MTLHeap;
+#endif
+
+class Metal_BufferAllocator;
+class Metal_Context;
+
+//! Range of GPU memory sub-allocated by Metal_BufferAllocator.
+//! Several allocations share the same MTLBuffer of a heap block at different offsets,
+//! so that both Buffer() and Offset() should be passed to the encoder.
+//! The range might be relocated by Metal_BufferAllocator::Compact(),
+//! hence these values should be fetched at binding time and not cached.
+class Metal_BufferAllocation : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTI_INLINE(Metal_BufferAllocation, Standard_Transient)
+  friend class Metal_BufferAllocator;
+public:
+
+  //! Empty constructor.
+  Metal_BufferAllocation()
+  : myBuffer(nullptr),
+    myAllocator(nullptr),
+    myOffset(0),
+    mySize(0),
+    myAlignedSize(0),
+    myBlockIndex(-1),
+    myStorageMode(Metal_StorageMode_Shared),
+    myIsAdopted(false) {}
+
+  //! Return TRUE if allocation is alive.
+  bool IsValid() const { return myBuffer != nullptr; }
+
+#ifdef __OBJC__
+  //! Return the buffer holding this range.
+  id<MTLBuffer> Buffer() const { return myBuffer; }
+#endif
+
+  //! Return offset of the range within Buffer() in bytes.
+  size_t Offset() const { return myOffset; }
+
+  //! Return requested size in bytes.
+  size_t Size() const { return mySize; }
+
+  //! Return storage mode.
+  Metal_StorageMode StorageMode() const { return myStorageMode; }
+
+  //! Return TRUE if the range occupies a dedicated buffer (not sub-allocated from a heap block).
+  bool IsDedicated() const { return myBlockIndex < 0; }
+
+  //! Return TRUE if the range wraps application memory without copying (see Metal_BufferAllocator::Adopt()).
+  bool IsAdopted() const { return myIsAdopted; }
+
+  //! Return CPU pointer to the beginning of the range or NULL for private storage.
+  Standard_EXPORT uint8_t* Contents() const;
+
+private:
+
+#ifdef __OBJC__
+  id<MTLBuffer>          myBuffer;      //!< buffer of heap block or dedicated buffer
+#else
+  void*                  myBuffer;
+#endif
+  Metal_BufferAllocator* myAllocator;   //!< owning allocator
+  size_t                 myOffset;      //!< offset within buffer
+  size_t                 mySize;        //!< requested size
+  size_t                 myAlignedSize; //!< size of the reserved range
+  int                    myBlockIndex;  //!< index of heap block, -1 for dedicated buffer
+  Metal_StorageMode      myStorageMode; //!< storage mode
+  bool                   myIsAdopted;   //!< flag indicating wrapped application memory
+};
+
+//! Sub-allocator of GPU buffers replacing per-object MTLBuffer creation.
+//! Memory is reserved from the device by large MTLHeap blocks (one MTLBuffer spanning the whole heap),
+//! and vertex, index and uniform data is placed into these blocks at aligned offsets
+//! using a best-fit free list with coalescing of neighbor ranges.
+//!
+//! Freed ranges are not reused immediately, as previous frames still in flight might read them;
+//! they are returned to the free list after Metal_Caps::maxFramesInFlight submitted frames.
+//!
+//! Compact() evacuates sparsely filled blocks into other blocks and releases them;
+//! relocation updates the Metal_BufferAllocation objects in-place and increments Revision(),
+//! so that recorded command buffers can detect stale offsets.
+//!
+//! Managed storage (not supported by MTLHeap) and requests larger than the block size
+//! are served by dedicated buffers.
+//!
+//! Public methods are thread-safe, so that buffers can be created lazily by parallel encoding.
+class Metal_BufferAllocator : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(Metal_BufferAllocator, Standard_Transient)
+public:
+
+  //! Default size of a heap block (16 MiB).
+  static constexpr size_t DefaultBlockSize = 16 * 1024 * 1024;
+
+  //! Minimal alignment (and size granularity) of sub-allocations.
+  static constexpr size_t MinAlignment = 16;
+
+  //! Blocks filled less than this ratio are evacuated by Compact().
+  static constexpr float CompactOccupancy = 0.25f;
+
+  //! Memory usage counters.
+  struct Statistics
+  {
+    size_t AllocatedBytes;   //!< memory reserved from device by heap blocks and dedicated buffers
+    size_t LiveBytes;        //!< memory requested by alive allocations
+    size_t WastedBytes;      //!< alignment padding and freed ranges still waiting for GPU
+    size_t FreeBytes;        //!< memory available for sub-allocation within heap blocks
+    size_t LargestFreeRange; //!< largest contiguous free range within heap blocks
+    int    NbBlocks;         //!< number of heap blocks
+    int    NbDedicated;      //!< number of dedicated buffers
+    size_t AdoptedBytes;     //!< application memory wrapped without copying (not included into AllocatedBytes)
+    int    NbAdopted;        //!< number of allocations wrapping application memory
+    int    NbAllocations;    //!< number of alive allocations
+    int    NbRelocations;    //!< number of allocations moved by compaction
+
+    Statistics()
+    : AllocatedBytes(0), LiveBytes(0), WastedBytes(0), FreeBytes(0), LargestFreeRange(0),
+      NbBlocks(0), NbDedicated(0), AdoptedBytes(0), NbAdopted(0), NbAllocations(0), NbRelocations(0) {}
+  };
+
+public:
+
+  //! Constructor.
+  Standard_EXPORT Metal_BufferAllocator();
+
+  //! Destructor - releases all blocks.
+  Standard_EXPORT ~Metal_BufferAllocator() override;
+
+  //! Initialize allocator with Metal device.
+  //! @param theCtx Metal context
+  //! @param theBlockSize size of heap blocks; 0 disables sub-allocation
+  Standard_EXPORT void Init(Metal_Context* theCtx, size_t theBlockSize = DefaultBlockSize);
+
+  //! Release all blocks; alive allocations become invalid.
+  Standard_EXPORT void Release();
+
+  //! Return size of heap blocks.
+  size_t BlockSize() const { return myBlockSize; }
+
+  //! Allocate a range of the specified size.
+  //! @param theSize      size in bytes
+  //! @param theMode      storage mode
+  //! @param theAlignment alignment of range offset (power of two)
+  //! @return allocation or NULL on failure
+  Standard_EXPORT occ::handle<Metal_BufferAllocation> Allocate(size_t theSize,
+                                                               Metal_StorageMode theMode,
+                                                               size_t theAlignment = MinAlignment);
+
+  //! Wrap page-aligned application memory (see Metal_PageAllocator) by a dedicated MTLBuffer without copying.
+  //! Allowed only on devices with unified memory; the MTLBuffer keeps theOwner alive
+  //! until GPU finishes frames using it, so that the range can be freed as any other one.
+  //! @param theOwner  buffer owning the memory
+  //! @param theLength length of the page-aligned range starting at theOwner->Data() (Metal_PageAllocator::AdoptableLength())
+  //! @param theOffset offset of the range within buffer data
+  //! @param theSize   size of the range in bytes
+  //! @return allocation or NULL on failure
+  Standard_EXPORT occ::handle<Metal_BufferAllocation> Adopt(const occ::handle<NCollection_Buffer>& theOwner,
+                                                            size_t theLength,
+                                                            size_t theOffset,
+                                                            size_t theSize);
+
+  //! Return the range to the allocator; it will be reused once GPU finishes frames in flight.
+  Standard_EXPORT void Free(const occ::handle<Metal_BufferAllocation>& theAlloc);
+
+  //! Notify allocator that the frame has been submitted to GPU.
+  Standard_EXPORT void FrameSubmitted();
+
+  //! Return freed ranges to the free list, when frames using them are finished by GPU;
+  //! also releases empty blocks evacuated by compaction.
+  //! @param theToForce when TRUE, GPU is assumed to be idle
+  Standard_EXPORT void ReclaimRetired(bool theToForce);
+
+  //! Evacuate allocations of sparsely filled blocks into other blocks of the same storage mode.
+  //! Data is copied on CPU for shared storage and by blit encoder of Metal_StagingRing
+  //! for private storage (ordered with uploads and submitted before the frame).
+  //! @return number of relocated bytes
+  Standard_EXPORT size_t Compact(Metal_Context* theCtx);
+
+  //! Return counter incremented each time allocations are relocated.
+  unsigned int Revision() const { return myRevision; }
+
+  //! Compute memory usage statistics.
+  Standard_EXPORT Statistics Stats() const;
+
+protected:
+
+  //! Contiguous range within heap block.
+  struct Range
+  {
+    size_t Offset;
+    size_t Size;
+  };
+
+  //! Range waiting for GPU before reuse.
+  struct RetiredRange
+  {
+    int          BlockIndex;
+    size_t       Offset;
+    size_t       Size;
+    unsigned int Frame;
+  };
+
+  //! Heap block.
+  struct Block
+  {
+#ifdef __OBJC__
+    id<MTLHeap>   Heap;   //!< heap reserving block memory
+    id<MTLBuffer> Buffer; //!< buffer spanning the whole heap
+#else
+    void*         Heap;
+    void*         Buffer;
+#endif
+    size_t            Size;         //!< block size
+    size_t            UsedBytes;    //!< size of alive ranges
+    size_t            PendingBytes; //!< size of retired ranges
+    Metal_StorageMode StorageMode;  //!< storage mode
+    bool              IsEvacuated;  //!< block is being released by compaction
+    NCollection_Sequence<Range>                FreeRanges;  //!< free ranges sorted by offset
+    NCollection_Map<Metal_BufferAllocation*>   Allocations; //!< alive allocations
+
+    Block() : Heap(nullptr), Buffer(nullptr), Size(0), UsedBytes(0), PendingBytes(0),
+              StorageMode(Metal_StorageMode_Shared), IsEvacuated(false) {}
+  };
+
+protected:
+
+  //! Create new heap block and return its index or -1 on failure.
+  Standard_EXPORT int createBlock(Metal_StorageMode theMode);
+
+  //! Release heap block.
+  Standard_EXPORT void releaseBlock(int theBlockIndex);
+
+  //! Find best-fit range within block and remove it from free list.
+  Standard_EXPORT static bool allocateRange(Block& theBlock,
+                                            size_t theSize,
+                                            size_t theAlignment,
+                                            size_t& theOffset);
+
+  //! Return range to the block free list merging it with neighbors.
+  Standard_EXPORT static void freeRange(Block& theBlock, size_t theOffset, size_t theSize);
+
+  //! Place range into existing blocks (except the specified one) or into a new block.
+  Standard_EXPORT bool placeRange(size_t theSize,
+                                  Metal_StorageMode theMode,
+                                  size_t theAlignment,
+                                  int theExcludedBlock,
+                                  bool theToCreateBlock,
+                                  int& theBlockIndex,
+                                  size_t& theOffset);
+
+protected:
+
+#ifdef __OBJC__
+  id<MTLDevice> myDevice;           //!< Metal device
+#else
+  void*         myDevice;
+#endif
+  NCollection_Vector<Block>                myBlocks;    //!< heap blocks (released slots have no buffer)
+  NCollection_List<RetiredRange>           myRetired;   //!< freed ranges waiting for GPU
+  NCollection_Map<Metal_BufferAllocation*> myDedicated; //!< alive dedicated allocations
+  NCollection_Map<Metal_BufferAllocation*> myAdopted;   //!< alive allocations wrapping application memory
+  size_t       myBlockSize;         //!< heap block size
+  size_t       myLiveBytes;         //!< memory requested by alive allocations
+  size_t       myDedicatedBytes;    //!< memory of dedicated buffers
+  size_t       myAdoptedBytes;      //!< application memory wrapped by adopted allocations
+  int          myMaxFramesInFlight; //!< number of frames to wait before reusing freed range
+  unsigned int myFrameIndex;        //!< counter of submitted frames
+  unsigned int myRevision;          //!< relocation counter
+  int          myNbRelocations;     //!< number of relocated allocations
+  mutable std::mutex myMutex;       //!< lock for thread-safety
+};
+
+#endif // Metal_BufferAllocator_HeaderFile
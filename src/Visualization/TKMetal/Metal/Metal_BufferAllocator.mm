@@ -0,0 +1,737 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#import <TargetConditionals.h>
+#import <Metal/Metal.h>
+
+#include <Metal_BufferAllocator.hxx>
+#include <Metal_Context.hxx>
+#include <OSD_MemInfo.hxx>
+
+#include <algorithm>
+#include <cstring>
+
+IMPLEMENT_STANDARD_RTTIEXT(Metal_BufferAllocator, Standard_Transient)
+
+namespace
+{
+  //! Round value up to the power-of-two alignment.
+  static size_t alignUp(size_t theValue, size_t theAlignment)
+  {
+    return (theValue + theAlignment - 1) & ~(theAlignment - 1);
+  }
+
+  //! Convert storage mode to resource options.
+  static MTLResourceOptions resourceOptions(Metal_StorageMode theMode)
+  {
+    switch (theMode)
+    {
+      case Metal_StorageMode_Shared:  return MTLResourceStorageModeShared;
+#if TARGET_OS_OSX
+      case Metal_StorageMode_Managed: return MTLResourceStorageModeManaged;
+#else
+      case Metal_StorageMode_Managed: return MTLResourceStorageModeShared;
+#endif
+      case Metal_StorageMode_Private: return MTLResourceStorageModePrivate;
+    }
+    return MTLResourceStorageModeShared;
+  }
+}
+
+// =======================================================================
+// function : Contents
+// purpose  : Return CPU pointer to the range
+// =======================================================================
+uint8_t* Metal_BufferAllocation::Contents() const
+{
+  if (myBuffer == nil || myStorageMode == Metal_StorageMode_Private)
+  {
+    return nullptr;
+  }
+  return static_cast<uint8_t*>([myBuffer contents]) + myOffset;
+}
+
+// =======================================================================
+// function : Metal_BufferAllocator
+// purpose  : Constructor
+// =======================================================================
+Metal_BufferAllocator::Metal_BufferAllocator()
+: myDevice(nil),
+  myBlockSize(DefaultBlockSize),
+  myLiveBytes(0),
+  myDedicatedBytes(0),
+  myAdoptedBytes(0),
+  myMaxFramesInFlight(Metal_MaxFramesInFlight),
+  myFrameIndex(0),
+  myRevision(0),
+  myNbRelocations(0)
+{
+  //
+}
+
+// =======================================================================
+// function : ~Metal_BufferAllocator
+// purpose  : Destructor
+// =======================================================================
+Metal_BufferAllocator::~Metal_BufferAllocator()
+{
+  Release();
+}
+
+// =======================================================================
+// function : Init
+// purpose  : Initialize allocator
+// =======================================================================
+void Metal_BufferAllocator::Init(Metal_Context* theCtx, size_t theBlockSize)
+{
+  if (theCtx == nullptr)
+  {
+    return;
+  }
+
+  myDevice = theCtx->Device();
+  myBlockSize = theBlockSize != 0 ? alignUp(theBlockSize, MinAlignment) : 0;
+  myMaxFramesInFlight = std::max(theCtx->Caps()->maxFramesInFlight, 1);
+}
+
+// =======================================================================
+// function : Release
+// purpose  : Release all blocks
+// =======================================================================
+void Metal_BufferAllocator::Release()
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  for (int aBlockIter = 0; aBlockIter < myBlocks.Size(); ++aBlockIter)
+  {
+    releaseBlock(aBlockIter);
+  }
+  for (NCollection_Map<Metal_BufferAllocation*>::Iterator anIter(myDedicated); anIter.More(); anIter.Next())
+  {
+    Metal_BufferAllocation* anAlloc = anIter.Key();
+    anAlloc->myBuffer = nil;
+    anAlloc->myAllocator = nullptr;
+  }
+  for (NCollection_Map<Metal_BufferAllocation*>::Iterator anIter(myAdopted); anIter.More(); anIter.Next())
+  {
+    Metal_BufferAllocation* anAlloc = anIter.Key();
+    anAlloc->myBuffer = nil;
+    anAlloc->myAllocator = nullptr;
+  }
+  myBlocks.Clear();
+  myRetired.Clear();
+  myDedicated.Clear();
+  myAdopted.Clear();
+  OSD_MemInfo::AddTaggedMemory(OSD_MemInfo::MemTag_GpuBuffers, -int64_t(myLiveBytes));
+  myLiveBytes = 0;
+  myDedicatedBytes = 0;
+  myAdoptedBytes = 0;
+  myDevice = nil;
+}
+
+// =======================================================================
+// function : createBlock
+// purpose  : Create new heap block
+// =======================================================================
+int Metal_BufferAllocator::createBlock(Metal_StorageMode theMode)
+{
+  if (myDevice == nil || myBlockSize == 0)
+  {
+    return -1;
+  }
+
+  MTLHeapDescriptor* aHeapDesc = [[MTLHeapDescriptor alloc] init];
+  aHeapDesc.storageMode = theMode == Metal_StorageMode_Private ? MTLStorageModePrivate : MTLStorageModeShared;
+  if (@available(macOS 10.15, iOS 13.0, *))
+  {
+    // sub-allocations of the same buffer are written and read by different passes
+    aHeapDesc.hazardTrackingMode = MTLHazardTrackingModeTracked;
+  }
+  const MTLResourceOptions anOptions = resourceOptions(theMode);
+  const MTLSizeAndAlign aSizeAlign = [myDevice heapBufferSizeAndAlignWithLength:myBlockSize options:anOptions];
+  aHeapDesc.size = aSizeAlign.size;
+
+  Block aBlock;
+  aBlock.Heap = [myDevice newHeapWithDescriptor:aHeapDesc];
+  if (aBlock.Heap == nil)
+  {
+    return -1;
+  }
+  if (@available(macOS 10.15, iOS 13.0, *))
+  {
+    aBlock.Buffer = [aBlock.Heap newBufferWithLength:myBlockSize options:aBlock.Heap.resourceOptions];
+  }
+  else
+  {
+    aBlock.Buffer = [aBlock.Heap newBufferWithLength:myBlockSize options:anOptions];
+  }
+  if (aBlock.Buffer == nil)
+  {
+    return -1;
+  }
+  aBlock.Heap.label = @"Metal_BufferAllocator heap";
+  aBlock.Buffer.label = @"Metal_BufferAllocator block";
+  aBlock.Size = myBlockSize;
+  aBlock.StorageMode = theMode;
+  Range aFree = { 0, myBlockSize };
+  aBlock.FreeRanges.Append(aFree);
+
+  // reuse slot of released block
+  for (int aBlockIter = 0; aBlockIter < myBlocks.Size(); ++aBlockIter)
+  {
+    if (myBlocks.Value(aBlockIter).Buffer == nil)
+    {
+      myBlocks.ChangeValue(aBlockIter) = aBlock;
+      return aBlockIter;
+    }
+  }
+  myBlocks.Append(aBlock);
+  return myBlocks.Upper();
+}
+
+// =======================================================================
+// function : releaseBlock
+// purpose  : Release heap block
+// =======================================================================
+void Metal_BufferAllocator::releaseBlock(int theBlockIndex)
+{
+  Block& aBlock = myBlocks.ChangeValue(theBlockIndex);
+  for (NCollection_Map<Metal_BufferAllocation*>::Iterator anIter(aBlock.Allocations); anIter.More(); anIter.Next())
+  {
+    Metal_BufferAllocation* anAlloc = anIter.Key();
+    anAlloc->myBuffer = nil;
+    anAlloc->myAllocator = nullptr;
+  }
+  aBlock = Block();
+}
+
+// =======================================================================
+// function : allocateRange
+// purpose  : Find best-fit range within block
+// =======================================================================
+bool Metal_BufferAllocator::allocateRange(Block& theBlock,
+                                          size_t theSize,
+                                          size_t theAlignment,
+                                          size_t& theOffset)
+{
+  int    aBestIndex = 0;
+  size_t aBestRest  = 0;
+  for (int aRangeIter = 1; aRangeIter <= theBlock.FreeRanges.Length(); ++aRangeIter)
+  {
+    const Range& aRange = theBlock.FreeRanges.Value(aRangeIter);
+    const size_t aStart = alignUp(aRange.Offset, theAlignment);
+    const size_t aPad   = aStart - aRange.Offset;
+    if (aRange.Size < aPad + theSize)
+    {
+      continue;
+    }
+
+    const size_t aRest = aRange.Size - aPad - theSize;
+    if (aBestIndex == 0 || aRest < aBestRest)
+    {
+      aBestIndex = aRangeIter;
+      aBestRest  = aRest;
+      if (aRest == 0)
+      {
+        break;
+      }
+    }
+  }
+  if (aBestIndex == 0)
+  {
+    return false;
+  }
+
+  Range& aRange = theBlock.FreeRanges.ChangeValue(aBestIndex);
+  const size_t aStart = alignUp(aRange.Offset, theAlignment);
+  const size_t aPad   = aStart - aRange.Offset;
+  theOffset = aStart;
+  if (aPad != 0 && aBestRest != 0)
+  {
+    // keep leading padding free and insert the tail after it
+    aRange.Size = aPad;
+    Range aTail = { aStart + theSize, aBestRest };
+    theBlock.FreeRanges.InsertAfter(aBestIndex, aTail);
+  }
+  else if (aPad != 0)
+  {
+    aRange.Size = aPad;
+  }
+  else if (aBestRest != 0)
+  {
+    aRange.Offset = aStart + theSize;
+    aRange.Size   = aBestRest;
+  }
+  else
+  {
+    theBlock.FreeRanges.Remove(aBestIndex);
+  }
+  return true;
+}
+
+// =======================================================================
+// function : freeRange
+// purpose  : Return range to the block free list
+// =======================================================================
+void Metal_BufferAllocator::freeRange(Block& theBlock, size_t theOffset, size_t theSize)
+{
+  // free list is sorted by offset - find the first range after the freed one
+  int aNextIndex = 1;
+  for (; aNextIndex <= theBlock.FreeRanges.Length(); ++aNextIndex)
+  {
+    if (theBlock.FreeRanges.Value(aNextIndex).Offset > theOffset)
+    {
+      break;
+    }
+  }
+
+  const int aPrevIndex = aNextIndex - 1;
+  const bool toMergePrev = aPrevIndex >= 1
+                        && theBlock.FreeRanges.Value(aPrevIndex).Offset
+                         + theBlock.FreeRanges.Value(aPrevIndex).Size == theOffset;
+  const bool toMergeNext = aNextIndex <= theBlock.FreeRanges.Length()
+                        && theOffset + theSize == theBlock.FreeRanges.Value(aNextIndex).Offset;
+  if (toMergePrev && toMergeNext)
+  {
+    Range& aPrev = theBlock.FreeRanges.ChangeValue(aPrevIndex);
+    aPrev.Size += theSize + theBlock.FreeRanges.Value(aNextIndex).Size;
+    theBlock.FreeRanges.Remove(aNextIndex);
+  }
+  else if (toMergePrev)
+  {
+    theBlock.FreeRanges.ChangeValue(aPrevIndex).Size += theSize;
+  }
+  else if (toMergeNext)
+  {
+    Range& aNext = theBlock.FreeRanges.ChangeValue(aNextIndex);
+    aNext.Offset = theOffset;
+    aNext.Size  += theSize;
+  }
+  else
+  {
+    Range aRange = { theOffset, theSize };
+    if (aNextIndex > theBlock.FreeRanges.Length())
+    {
+      theBlock.FreeRanges.Append(aRange);
+    }
+    else
+    {
+      theBlock.FreeRanges.InsertBefore(aNextIndex, aRange);
+    }
+  }
+}
+
+// =======================================================================
+// function : placeRange
+// purpose  : Place range into heap blocks
+// =======================================================================
+bool Metal_BufferAllocator::placeRange(size_t theSize,
+                                       Metal_StorageMode theMode,
+                                       size_t theAlignment,
+                                       int theExcludedBlock,
+                                       bool theToCreateBlock,
+                                       int& theBlockIndex,
+                                       size_t& theOffset)
+{
+  for (int aBlockIter = 0; aBlockIter < myBlocks.Size(); ++aBlockIter)
+  {
+    Block& aBlock = myBlocks.ChangeValue(aBlockIter);
+    if (aBlockIter == theExcludedBlock
+     || aBlock.Buffer == nil
+     || aBlock.IsEvacuated
+     || aBlock.StorageMode != theMode
+     || aBlock.Size - aBlock.UsedBytes - aBlock.PendingBytes < theSize)
+    {
+      continue;
+    }
+
+    if (allocateRange(aBlock, theSize, theAlignment, theOffset))
+    {
+      theBlockIndex = aBlockIter;
+      return true;
+    }
+  }
+
+  if (!theToCreateBlock)
+  {
+    return false;
+  }
+
+  theBlockIndex = createBlock(theMode);
+  return theBlockIndex >= 0
+      && allocateRange(myBlocks.ChangeValue(theBlockIndex), theSize, theAlignment, theOffset);
+}
+
+// =======================================================================
+// function : Allocate
+// purpose  : Allocate a range
+// =======================================================================
+occ::handle<Metal_BufferAllocation> Metal_BufferAllocator::Allocate(size_t theSize,
+                                                                    Metal_StorageMode theMode,
+                                                                    size_t theAlignment)
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  if (myDevice == nil || theSize == 0)
+  {
+    return occ::handle<Metal_BufferAllocation>();
+  }
+
+#if !TARGET_OS_OSX
+  if (theMode == Metal_StorageMode_Managed)
+  {
+    theMode = Metal_StorageMode_Shared;
+  }
+#endif
+
+  const size_t anAlignment = std::max(theAlignment, MinAlignment);
+  const size_t anAlignedSize = alignUp(theSize, MinAlignment);
+
+  occ::handle<Metal_BufferAllocation> anAlloc = new Metal_BufferAllocation();
+  anAlloc->myAllocator = this;
+  anAlloc->mySize = theSize;
+  anAlloc->myAlignedSize = anAlignedSize;
+  anAlloc->myStorageMode = theMode;
+
+  int aBlockIndex = -1;
+  size_t anOffset = 0;
+  if (theMode != Metal_StorageMode_Managed
+   && anAlignedSize <= myBlockSize
+   && placeRange(anAlignedSize, theMode, anAlignment, -1, true, aBlockIndex, anOffset))
+  {
+    Block& aBlock = myBlocks.ChangeValue(aBlockIndex);
+    aBlock.UsedBytes += anAlignedSize;
+    aBlock.Allocations.Add(anAlloc.get());
+    anAlloc->myBuffer = aBlock.Buffer;
+    anAlloc->myOffset = anOffset;
+    anAlloc->myBlockIndex = aBlockIndex;
+  }
+  else
+  {
+    // managed storage cannot be placed into MTLHeap, too large requests do not fit into the block
+    anAlloc->myBuffer = [myDevice newBufferWithLength:anAlignedSize options:resourceOptions(theMode)];
+    if (anAlloc->myBuffer == nil)
+    {
+      return occ::handle<Metal_BufferAllocation>();
+    }
+    myDedicated.Add(anAlloc.get());
+    myDedicatedBytes += anAlignedSize;
+  }
+
+  myLiveBytes += theSize;
+  OSD_MemInfo::AddTaggedMemory(OSD_MemInfo::MemTag_GpuBuffers, int64_t(theSize));
+  return anAlloc;
+}
+
+// =======================================================================
+// function : Adopt
+// purpose  : Wrap application memory without copying
+// =======================================================================
+occ::handle<Metal_BufferAllocation> Metal_BufferAllocator::Adopt(const occ::handle<NCollection_Buffer>& theOwner,
+                                                                 size_t theLength,
+                                                                 size_t theOffset,
+                                                                 size_t theSize)
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  if (myDevice == nil || !myDevice.hasUnifiedMemory
+   || theOwner.IsNull() || theOwner->IsEmpty()
+   || theSize == 0 || theOffset + theSize > theLength)
+  {
+    return occ::handle<Metal_BufferAllocation>();
+  }
+
+  // the block captures a reference to the owner, which is released together with MTLBuffer
+  // only after command buffers still in flight retaining it are completed
+  occ::handle<NCollection_Buffer> anOwner = theOwner;
+  id<MTLBuffer> aBuffer = [myDevice newBufferWithBytesNoCopy:theOwner->ChangeData()
+                                                      length:theLength
+                                                     options:resourceOptions(Metal_StorageMode_Shared)
+                                                 deallocator:^(void*, NSUInteger) { (void)anOwner; }];
+  if (aBuffer == nil)
+  {
+    return occ::handle<Metal_BufferAllocation>();
+  }
+
+  occ::handle<Metal_BufferAllocation> anAlloc = new Metal_BufferAllocation();
+  anAlloc->myAllocator = this;
+  anAlloc->myBuffer = aBuffer;
+  anAlloc->myOffset = theOffset;
+  anAlloc->mySize = theSize;
+  anAlloc->myAlignedSize = theLength;
+  anAlloc->myStorageMode = Metal_StorageMode_Shared;
+  anAlloc->myIsAdopted = true;
+  myAdopted.Add(anAlloc.get());
+  myAdoptedBytes += theLength;
+  return anAlloc;
+}
+
+// =======================================================================
+// function : Free
+// purpose  : Return the range to the allocator
+// =======================================================================
+void Metal_BufferAllocator::Free(const occ::handle<Metal_BufferAllocation>& theAlloc)
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  if (theAlloc.IsNull() || theAlloc->myAllocator != this)
+  {
+    return;
+  }
+
+  if (theAlloc->myIsAdopted)
+  {
+    // application memory is released by the owner once MTLBuffer is dropped by frames in flight
+    myAdopted.Remove(theAlloc.get());
+    myAdoptedBytes -= theAlloc->myAlignedSize;
+    theAlloc->myBuffer = nil;
+    theAlloc->myAllocator = nullptr;
+    return;
+  }
+
+  myLiveBytes -= theAlloc->mySize;
+  OSD_MemInfo::AddTaggedMemory(OSD_MemInfo::MemTag_GpuBuffers, -int64_t(theAlloc->mySize));
+  if (theAlloc->IsDedicated())
+  {
+    // previous frames keep their own reference to the dedicated buffer
+    myDedicated.Remove(theAlloc.get());
+    myDedicatedBytes -= theAlloc->myAlignedSize;
+  }
+  else
+  {
+    Block& aBlock = myBlocks.ChangeValue(theAlloc->myBlockIndex);
+    aBlock.Allocations.Remove(theAlloc.get());
+    aBlock.UsedBytes -= theAlloc->myAlignedSize;
+    aBlock.PendingBytes += theAlloc->myAlignedSize;
+
+    RetiredRange aRetired = { theAlloc->myBlockIndex, theAlloc->myOffset, theAlloc->myAlignedSize, myFrameIndex };
+    myRetired.Append(aRetired);
+  }
+
+  theAlloc->myBuffer = nil;
+  theAlloc->myAllocator = nullptr;
+  theAlloc->myBlockIndex = -1;
+}
+
+// =======================================================================
+// function : FrameSubmitted
+// purpose  : Advance submitted frames counter
+// =======================================================================
+void Metal_BufferAllocator::FrameSubmitted()
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  ++myFrameIndex;
+}
+
+// =======================================================================
+// function : ReclaimRetired
+// purpose  : Return retired ranges to free lists
+// =======================================================================
+void Metal_BufferAllocator::ReclaimRetired(bool theToForce)
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  for (NCollection_List<RetiredRange>::Iterator anIter(myRetired); anIter.More();)
+  {
+    const RetiredRange& aRetired = anIter.Value();
+    if (!theToForce
+      && myFrameIndex - aRetired.Frame < (unsigned int)myMaxFramesInFlight)
+    {
+      // ranges are appended in submission order
+      break;
+    }
+
+    Block& aBlock = myBlocks.ChangeValue(aRetired.BlockIndex);
+    if (aBlock.Buffer != nil)
+    {
+      aBlock.PendingBytes -= aRetired.Size;
+      freeRange(aBlock, aRetired.Offset, aRetired.Size);
+    }
+    myRetired.Remove(anIter);
+  }
+
+  for (int aBlockIter = 0; aBlockIter < myBlocks.Size(); ++aBlockIter)
+  {
+    const Block& aBlock = myBlocks.Value(aBlockIter);
+    if (aBlock.Buffer != nil
+     && aBlock.IsEvacuated
+     && aBlock.UsedBytes == 0
+     && aBlock.PendingBytes == 0)
+    {
+      releaseBlock(aBlockIter);
+    }
+  }
+}
+
+// =======================================================================
+// function : Compact
+// purpose  : Evacuate sparsely filled blocks
+// =======================================================================
+size_t Metal_BufferAllocator::Compact(Metal_Context* theCtx)
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  if (theCtx == nullptr || myDevice == nil)
+  {
+    return 0;
+  }
+
+  size_t aMovedBytes = 0;
+  id<MTLBlitCommandEncoder> aBlitEncoder = nil;
+  for (int aBlockIter = 0; aBlockIter < myBlocks.Size(); ++aBlockIter)
+  {
+    {
+      const Block& aBlock = myBlocks.Value(aBlockIter);
+      if (aBlock.Buffer == nil
+       || aBlock.IsEvacuated
+       || float(aBlock.UsedBytes) >= float(aBlock.Size) * CompactOccupancy)
+      {
+        continue;
+      }
+    }
+
+    // evacuate only when remaining blocks have enough space, without creating new blocks;
+    // the last block of each storage mode is kept even if empty to avoid heap re-creation
+    int    aNbOthers = 0;
+    size_t aFreeElsewhere = 0;
+    for (int anOtherIter = 0; anOtherIter < myBlocks.Size(); ++anOtherIter)
+    {
+      const Block& anOther = myBlocks.Value(anOtherIter);
+      if (anOtherIter != aBlockIter
+       && anOther.Buffer != nil
+       && !anOther.IsEvacuated
+       && anOther.StorageMode == myBlocks.Value(aBlockIter).StorageMode)
+      {
+        aFreeElsewhere += anOther.Size - anOther.UsedBytes - anOther.PendingBytes;
+        ++aNbOthers;
+      }
+    }
+    if (aNbOthers == 0
+     || aFreeElsewhere < myBlocks.Value(aBlockIter).UsedBytes)
+    {
+      continue;
+    }
+
+    NCollection_Vector<Metal_BufferAllocation*> anAllocs;
+    for (NCollection_Map<Metal_BufferAllocation*>::Iterator anIter(myBlocks.Value(aBlockIter).Allocations);
+         anIter.More(); anIter.Next())
+    {
+      anAllocs.Append(anIter.Key());
+    }
+
+    for (NCollection_Vector<Metal_BufferAllocation*>::Iterator anIter(anAllocs); anIter.More(); anIter.Next())
+    {
+      Metal_BufferAllocation* anAlloc = anIter.Value();
+      int aNewBlockIndex = -1;
+      size_t aNewOffset = 0;
+      if (!placeRange(anAlloc->myAlignedSize, anAlloc->myStorageMode, MinAlignment,
+                      aBlockIter, false, aNewBlockIndex, aNewOffset))
+      {
+        continue;
+      }
+
+      Block& aSrcBlock = myBlocks.ChangeValue(aBlockIter);
+      Block& aDstBlock = myBlocks.ChangeValue(aNewBlockIndex);
+      if (anAlloc->myStorageMode == Metal_StorageMode_Private)
+      {
+        if (aBlitEncoder == nil)
+        {
+          // ordered with uploads into the moved ranges, submitted before the frame
+          aBlitEncoder = !theCtx->StagingRing().IsNull()
+                       ? theCtx->StagingRing()->BlitEncoder(theCtx)
+                       : nil;
+          if (aBlitEncoder == nil)
+          {
+            freeRange(aDstBlock, aNewOffset, anAlloc->myAlignedSize);
+            break;
+          }
+        }
+        [aBlitEncoder copyFromBuffer:aSrcBlock.Buffer
+                        sourceOffset:anAlloc->myOffset
+                            toBuffer:aDstBlock.Buffer
+                   destinationOffset:aNewOffset
+                                size:anAlloc->myAlignedSize];
+      }
+      else
+      {
+        // copy on CPU, so that following CPU updates of the new range are not overridden by GPU
+        std::memcpy(static_cast<uint8_t*>([aDstBlock.Buffer contents]) + aNewOffset,
+                    static_cast<const uint8_t*>([aSrcBlock.Buffer contents]) + anAlloc->myOffset,
+                    anAlloc->myAlignedSize);
+      }
+
+      // old range is still referenced by frames in flight
+      RetiredRange aRetired = { aBlockIter, anAlloc->myOffset, anAlloc->myAlignedSize, myFrameIndex };
+      myRetired.Append(aRetired);
+      aSrcBlock.Allocations.Remove(anAlloc);
+      aSrcBlock.UsedBytes -= anAlloc->myAlignedSize;
+      aSrcBlock.PendingBytes += anAlloc->myAlignedSize;
+
+      aDstBlock.Allocations.Add(anAlloc);
+      aDstBlock.UsedBytes += anAlloc->myAlignedSize;
+      anAlloc->myBuffer = aDstBlock.Buffer;
+      anAlloc->myOffset = aNewOffset;
+      anAlloc->myBlockIndex = aNewBlockIndex;
+
+      aMovedBytes += anAlloc->myAlignedSize;
+      ++myNbRelocations;
+    }
+
+    Block& aBlock = myBlocks.ChangeValue(aBlockIter);
+    if (aBlock.UsedBytes == 0)
+    {
+      aBlock.IsEvacuated = true;
+    }
+  }
+
+  if (aMovedBytes != 0)
+  {
+    ++myRevision;
+  }
+  return aMovedBytes;
+}
+
+// =======================================================================
+// function : Stats
+// purpose  : Compute memory usage statistics
+// =======================================================================
+Metal_BufferAllocator::Statistics Metal_BufferAllocator::Stats() const
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  Statistics aStats;
+  size_t aUsedBytes = myDedicatedBytes;
+  size_t aPendingBytes = 0;
+  for (NCollection_Vector<Block>::Iterator anIter(myBlocks); anIter.More(); anIter.Next())
+  {
+    const Block& aBlock = anIter.Value();
+    if (aBlock.Buffer == nil)
+    {
+      continue;
+    }
+
+    ++aStats.NbBlocks;
+    aStats.AllocatedBytes += aBlock.Size;
+    aUsedBytes    += aBlock.UsedBytes;
+    aPendingBytes += aBlock.PendingBytes;
+    aStats.NbAllocations += aBlock.Allocations.Extent();
+    for (NCollection_Sequence<Range>::Iterator aRangeIter(aBlock.FreeRanges); aRangeIter.More(); aRangeIter.Next())
+    {
+      aStats.FreeBytes += aRangeIter.Value().Size;
+      aStats.LargestFreeRange = std::max(aStats.LargestFreeRange, aRangeIter.Value().Size);
+    }
+  }
+
+  aStats.AllocatedBytes += myDedicatedBytes;
+  aStats.NbDedicated     = myDedicated.Extent();
+  aStats.AdoptedBytes    = myAdoptedBytes;
+  aStats.NbAdopted       = myAdopted.Extent();
+  aStats.NbAllocations  += myDedicated.Extent();
+  aStats.LiveBytes       = myLiveBytes;
+  aStats.WastedBytes     = aUsedBytes - myLiveBytes + aPendingBytes;
+  aStats.NbRelocations   = myNbRelocations;
+  return aStats;
+}
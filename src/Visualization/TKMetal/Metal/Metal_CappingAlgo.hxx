@@ -16,12 +16,17 @@
 
 #include <Metal_Resource.hxx>
 #include <Graphic3d_ClipPlane.hxx>
+#include <Graphic3d_Layer.hxx>
+#include <Graphic3d_SequenceOfHClipPlane.hxx>
 #include <NCollection_DataMap.hxx>
+#include <NCollection_List.hxx>
+#include <NCollection_Mat4.hxx>
 #include <Standard_Handle.hxx>
 
 #ifdef __OBJC__
 @protocol MTLTexture;
 @protocol MTLBuffer;
+@protocol MTLCommandBuffer;
 @protocol MTLRenderPipelineState;
 @protocol MTLDepthStencilState;
 #endif
@@ -93,10 +98,18 @@ protected:
   size_t        myEstimatedSize;            //!< estimated GPU memory
 };
 
-//! Algorithm for rendering capping planes using stencil buffer.
-//! Uses a two-pass approach:
+//! Algorithm for rendering capping planes.
+//! Stencil mode uses a two-pass approach per structure and plane:
 //! 1. Generate stencil mask by inverting stencil bits for each face
 //! 2. Render infinite capping plane where stencil indicates "inside"
+//!
+//! Single-pass mode (RenderSinglePass()) renders clipped geometry of all structures once per capping chain
+//! into an integer target keeping the front-most fragment - structure slot for back faces and zero for front faces.
+//! Each plane of the chain is then filled by a full-screen pass intersecting view rays with the plane
+//! at pixels where back faces are visible, with color and hatch looked up by structure slot,
+//! so that the cost of capping does not grow with number of structures.
+//! Hatch lines are generated procedurally in the pattern space of the plane frame,
+//! so that sliding the plane does not require any per-plane setup and the hatch stays attached to the plane.
 class Metal_CappingAlgo : public Standard_Transient
 {
   DEFINE_STANDARD_RTTIEXT(Metal_CappingAlgo, Standard_Transient)
@@ -128,7 +141,28 @@ public:
     Metal_Context* theCtx,
     const Handle(Graphic3d_ClipPlane)& thePlane);
 
+  //! Return TRUE if the sequence contains enabled planes with capping.
+  Standard_EXPORT static bool HasCapping(const Graphic3d_SequenceOfHClipPlane& thePlanes);
+
 #ifdef __OBJC__
+  //! Encode section caps of visible structures of non-immediate layers in single-pass mode.
+  //! @param theCtx       Metal context
+  //! @param theCmdBuffer frame command buffer (outside of render pass)
+  //! @param theTarget    color target with rendered main pass
+  //! @param theDepth     depth of the main pass (should be stored)
+  //! @param theLayers    layers of the view
+  //! @param thePlanes    clipping planes of the view
+  //! @param theViewId    view identification for structure visibility test
+  //! @param theViewProj  camera projection * orientation matrix used by the main pass
+  Standard_EXPORT void RenderSinglePass(Metal_Context* theCtx,
+                                        id<MTLCommandBuffer> theCmdBuffer,
+                                        id<MTLTexture> theTarget,
+                                        id<MTLTexture> theDepth,
+                                        const NCollection_List<occ::handle<Graphic3d_Layer>>& theLayers,
+                                        const Graphic3d_SequenceOfHClipPlane& thePlanes,
+                                        int theViewId,
+                                        const NCollection_Mat4<float>& theViewProj);
+
   //! Return stencil-generate pipeline (for mask generation pass).
   id<MTLRenderPipelineState> StencilGenPipeline() const { return myStencilGenPipeline; }
 
@@ -150,6 +184,12 @@ protected:
   //! Create depth-stencil states.
   Standard_EXPORT bool createDepthStencilStates(Metal_Context* theCtx);
 
+  //! Create pipelines of single-pass mode for specified color format of the target.
+  bool initSinglePass(Metal_Context* theCtx, unsigned long theColorFormat);
+
+  //! (Re)create ID and depth targets of single-pass mode.
+  bool initIdTextures(Metal_Context* theCtx, int theSizeX, int theSizeY);
+
 protected:
 
 #ifdef __OBJC__
@@ -157,12 +197,27 @@ protected:
   id<MTLRenderPipelineState> myStencilRenderPipeline;  //!< pipeline for capping plane render
   id<MTLDepthStencilState>   myStencilGenDepthState;   //!< depth-stencil for mask generation
   id<MTLDepthStencilState>   myStencilRenderDepthState; //!< depth-stencil for capping render
+  id<MTLRenderPipelineState> myIdPipeline;              //!< single-pass ID pipeline
+  id<MTLRenderPipelineState> myFillPipeline;            //!< single-pass full-screen fill pipeline
+  id<MTLDepthStencilState>   myIdDepthState;            //!< depth test and write of ID pass
+  id<MTLDepthStencilState>   myFillDepthState;          //!< depth test of caps against main pass
+  id<MTLTexture>             myIdTexture;               //!< R32Uint structure slot target
+  id<MTLTexture>             myIdDepthTexture;          //!< depth target of ID pass
 #else
   void*                      myStencilGenPipeline;
   void*                      myStencilRenderPipeline;
   void*                      myStencilGenDepthState;
   void*                      myStencilRenderDepthState;
+  void*                      myIdPipeline;
+  void*                      myFillPipeline;
+  void*                      myIdDepthState;
+  void*                      myFillDepthState;
+  void*                      myIdTexture;
+  void*                      myIdDepthTexture;
 #endif
+  unsigned long              myFillFormat;              //!< color format of fill pipeline
+  int                        myIdSizeX;                 //!< width of ID target
+  int                        myIdSizeY;                 //!< height of ID target
 
   NCollection_DataMap<Standard_Address, Handle(Metal_CappingPlaneResource)> myPlaneResources;
   bool myIsInitialized;
@@ -12,11 +12,22 @@
 // commercial license or contractual agreement.
 
 #import "Metal_CappingAlgo.hxx"
+#import "Metal_Clipping.hxx"
 #import "Metal_Context.hxx"
+#import "Metal_Group.hxx"
+#import "Metal_Material.hxx"
+#import "Metal_PrimitiveArray.hxx"
+#import "Metal_Structure.hxx"
+#import "Metal_UniformRing.hxx"
+
+#include <NCollection_Vector.hxx>
 
 #import <Metal/Metal.h>
 #import <simd/simd.h>
+#include <algorithm>
 #include <cmath>
+#include <cstring>
+#include <vector>
 
 IMPLEMENT_STANDARD_RTTIEXT(Metal_CappingPlaneResource, Metal_Resource)
 IMPLEMENT_STANDARD_RTTIEXT(Metal_CappingAlgo, Standard_Transient)
@@ -137,6 +148,421 @@ fragment float4 cappingRenderFragment(
 
   //! Size of infinite plane (large enough to fill view).
   static const float THE_PLANE_SIZE = 10000.0f;
+
+  //! Shader source of single-pass capping (ID pass and full-screen fill).
+  static const char* THE_SINGLE_PASS_SHADER = R"(
+#include <metal_stdlib>
+using namespace metal;
+
+#define MAX_CLIP_PLANES 8
+
+// world-space planes of the view grouped by chains
+struct CapClipUniforms
+{
+  float4 Planes[MAX_CLIP_PLANES];
+  int    Chains[MAX_CLIP_PLANES]; // chain index of each plane, planes of a chain are contiguous
+  int    NbPlanes;
+  int    CapChain;                // chain being filled
+  int    CapPlane;                // plane being filled
+  int    Padding;
+};
+
+struct CapIdUniforms
+{
+  float4x4 ViewProjMatrix;
+  float4x4 ModelMatrix;
+};
+
+struct CapFillUniforms
+{
+  float4x4 ViewProjMatrix;
+  float4x4 InvViewProjMatrix;
+  float2   Viewport;
+  float2   Padding;
+};
+
+struct CapObject
+{
+  float4 Color;
+  int    HatchType; // Aspect_HatchStyle
+  int3   Padding;
+};
+
+// chain cuts the point only when all its planes reject it; chains are combined by logical OR
+bool isClippedByChains(float3 thePnt, constant CapClipUniforms& theClip, int theSkipChain)
+{
+  int  aChain = -1;
+  bool isChainOut = false;
+  for (int aPlaneIter = 0; aPlaneIter < theClip.NbPlanes; ++aPlaneIter)
+  {
+    if (theClip.Chains[aPlaneIter] != aChain)
+    {
+      if (isChainOut)
+      {
+        return true;
+      }
+      aChain = theClip.Chains[aPlaneIter];
+      isChainOut = aChain != theSkipChain;
+    }
+    if (isChainOut && dot(float4(thePnt, 1.0), theClip.Planes[aPlaneIter]) >= 0.0)
+    {
+      isChainOut = false;
+    }
+  }
+  return isChainOut;
+}
+
+// orthonormal frame of the plane with the given normal, matching Metal_CappingPlaneResource orientation
+void capPlaneFrame(float3 theNorm, thread float3& theU, thread float3& theV)
+{
+  const float3 aRef = abs(theNorm.y) < 0.9 ? float3(0.0, 1.0, 0.0) : float3(1.0, 0.0, 0.0);
+  theU = normalize(cross(aRef, theNorm));
+  theV = cross(theNorm, theU);
+}
+
+// hatch lines of Aspect_HatchStyle in the pattern space of the plane frame; returns TRUE for a gap between lines;
+// the spacing is kept within [1, 2) of the nominal one in pixels by power-of-two steps,
+// so that the lines stay attached to the plane while panning, zooming and sliding the plane
+bool isHatchGap(float2 theUV, float2 theUVdX, float2 theUVdY, int theType)
+{
+  if (theType == 0)
+  {
+    return false;
+  }
+
+  const bool  isWide   = theType == 2 || theType == 4 || theType == 9 || theType == 10 || theType == 11 || theType == 12;
+  const float aSpacing = isWide ? 16.0 : 8.0;
+  float2 anAngles = float2(-1.0);
+  switch (theType)
+  {
+    case 7: case 11: anAngles = float2(0.0, -1.0);                break;
+    case 8: case 12: anAngles = float2(M_PI_2_F, -1.0);           break;
+    case 5: case 9:  anAngles = float2(M_PI_4_F, -1.0);           break;
+    case 6: case 10: anAngles = float2(3.0 * M_PI_4_F, -1.0);     break;
+    case 3: case 4:  anAngles = float2(0.0, M_PI_2_F);            break;
+    case 1: case 2:  anAngles = float2(M_PI_4_F, 3.0 * M_PI_4_F); break;
+    default: return false;
+  }
+
+  bool isGap = true;
+  for (int anIter = 0; anIter < 2; ++anIter)
+  {
+    if (anAngles[anIter] < 0.0)
+    {
+      continue;
+    }
+    // pattern-space distance covered by one pixel across the lines
+    const float2 aLineNorm = float2(cos(anAngles[anIter]), sin(anAngles[anIter]));
+    const float  aPixel    = length(float2(dot(theUVdX, aLineNorm), dot(theUVdY, aLineNorm)));
+    if (aPixel <= 0.0)
+    {
+      continue;
+    }
+    const float aStep  = exp2(ceil(log2(aSpacing * aPixel)));
+    const float aCoord = dot(theUV, aLineNorm);
+    const float aDist  = abs(fmod(abs(aCoord) + aStep * 0.5, aStep) - aStep * 0.5);
+    isGap = isGap && aDist > 0.75 * aPixel;
+  }
+  return isGap;
+}
+
+struct CapIdOut
+{
+  float4 Position [[position]];
+  float3 WorldPosition;
+};
+
+vertex CapIdOut vertex_cap_id(uint theVertexId [[vertex_id]],
+                              const device packed_float3* thePositions [[buffer(0)]],
+                              constant CapIdUniforms& theUniforms [[buffer(1)]])
+{
+  const float4 aWorldPos = theUniforms.ModelMatrix * float4(float3(thePositions[theVertexId]), 1.0);
+  CapIdOut anOut;
+  anOut.Position      = theUniforms.ViewProjMatrix * aWorldPos;
+  anOut.WorldPosition = aWorldPos.xyz;
+  return anOut;
+}
+
+// front-most fragment of clipped geometry; back face means the view ray enters the solid at the cap
+fragment uint fragment_cap_id(CapIdOut theIn [[stage_in]],
+                              bool theIsFront [[front_facing]],
+                              constant CapClipUniforms& theClip [[buffer(0)]],
+                              constant uint& theSlot [[buffer(1)]])
+{
+  if (isClippedByChains(theIn.WorldPosition, theClip, -1))
+  {
+    discard_fragment();
+  }
+  return theIsFront ? 0u : theSlot;
+}
+
+struct CapFillOut
+{
+  float4 Position [[position]];
+};
+
+vertex CapFillOut vertex_cap_fill(uint theVertexId [[vertex_id]])
+{
+  // full-screen triangle
+  const float2 aPos = float2((theVertexId << 1) & 2, theVertexId & 2);
+  CapFillOut anOut;
+  anOut.Position = float4(aPos * 2.0 - 1.0, 0.0, 1.0);
+  return anOut;
+}
+
+// intersection of the view ray of the window point with the plane
+bool capRayHit(float2 theCoord,
+               constant CapFillUniforms& theFill,
+               float4 thePlane,
+               thread float3& theDir,
+               thread float3& thePnt)
+{
+  const float2 aNdc  = float2(theCoord.x / theFill.Viewport.x * 2.0 - 1.0,
+                              1.0 - theCoord.y / theFill.Viewport.y * 2.0);
+  const float4 aNear = theFill.InvViewProjMatrix * float4(aNdc, 0.0, 1.0);
+  const float4 aFar  = theFill.InvViewProjMatrix * float4(aNdc, 1.0, 1.0);
+  const float3 aFrom = aNear.xyz / aNear.w;
+  theDir = aFar.xyz / aFar.w - aFrom;
+  const float aDenom = dot(thePlane.xyz, theDir);
+  if (abs(aDenom) < 1.0e-12)
+  {
+    return false;
+  }
+  thePnt = aFrom - theDir * ((dot(thePlane.xyz, aFrom) + thePlane.w) / aDenom);
+  return true;
+}
+
+struct CapFragmentOut
+{
+  float4 Color [[color(0)]];
+  float  Depth [[depth(any)]];
+};
+
+fragment CapFragmentOut fragment_cap_fill(CapFillOut theIn [[stage_in]],
+                                          texture2d<uint, access::read> theIds [[texture(0)]],
+                                          constant CapFillUniforms& theFill [[buffer(0)]],
+                                          constant CapClipUniforms& theClip [[buffer(1)]],
+                                          const device CapObject* theObjects [[buffer(2)]])
+{
+  const uint aSlot = theIds.read(uint2(theIn.Position.xy)).x;
+  if (aSlot == 0u)
+  {
+    discard_fragment();
+  }
+
+  // intersect view ray of the pixel with the plane
+  const float4 aPlane = theClip.Planes[theClip.CapPlane];
+  float3 aDir, aPnt;
+  if (!capRayHit(theIn.Position.xy, theFill, aPlane, aDir, aPnt))
+  {
+    discard_fragment();
+  }
+
+  // the point should lie on the boundary of the volume cut by the chain and should not be cut by other chains
+  for (int aPlaneIter = 0; aPlaneIter < theClip.NbPlanes; ++aPlaneIter)
+  {
+    if (aPlaneIter != theClip.CapPlane
+     && theClip.Chains[aPlaneIter] == theClip.CapChain
+     && dot(float4(aPnt, 1.0), theClip.Planes[aPlaneIter]) > 0.0)
+    {
+      discard_fragment();
+    }
+  }
+  if (isClippedByChains(aPnt, theClip, theClip.CapChain))
+  {
+    discard_fragment();
+  }
+
+  const float4 aClipPos = theFill.ViewProjMatrix * float4(aPnt, 1.0);
+  const float  aDepth   = aClipPos.z / aClipPos.w;
+  const CapObject anObject = theObjects[aSlot - 1u];
+  if (aDepth < 0.0 || aDepth > 1.0)
+  {
+    discard_fragment();
+  }
+  if (anObject.HatchType != 0)
+  {
+    // pattern space of the plane frame; pixel footprint from the rays of neighbor pixels
+    float3 anAxisU, anAxisV, aDirX, aDirY, aPntX, aPntY;
+    capPlaneFrame(normalize(aPlane.xyz), anAxisU, anAxisV);
+    if (!capRayHit(theIn.Position.xy + float2(1.0, 0.0), theFill, aPlane, aDirX, aPntX)
+     || !capRayHit(theIn.Position.xy + float2(0.0, 1.0), theFill, aPlane, aDirY, aPntY))
+    {
+      aPntX = aPnt;
+      aPntY = aPnt;
+    }
+    const float2 anUV = float2(dot(aPnt, anAxisU), dot(aPnt, anAxisV));
+    if (isHatchGap(anUV,
+                   float2(dot(aPntX, anAxisU), dot(aPntX, anAxisV)) - anUV,
+                   float2(dot(aPntY, anAxisU), dot(aPntY, anAxisV)) - anUV,
+                   anObject.HatchType))
+    {
+      discard_fragment();
+    }
+  }
+
+  // headlight shading of the plane
+  const float aLight = 0.3 + 0.7 * abs(dot(normalize(aPlane.xyz), normalize(aDir)));
+  CapFragmentOut anOut;
+  anOut.Color = float4(anObject.Color.rgb * aLight, anObject.Color.a);
+  anOut.Depth = aDepth;
+  return anOut;
+}
+)";
+
+  //! Clipping planes of single-pass mode, matching CapClipUniforms.
+  struct Metal_CapClipUniforms
+  {
+    float   Planes[Metal_Clipping_MaxPlanes][4];
+    int32_t Chains[Metal_Clipping_MaxPlanes];
+    int32_t NbPlanes;
+    int32_t CapChain;
+    int32_t CapPlane;
+    int32_t Padding;
+  };
+
+  //! Vertex uniforms of ID pass, matching CapIdUniforms.
+  struct Metal_CapIdUniforms
+  {
+    float ViewProjMatrix[16];
+    float ModelMatrix[16];
+  };
+
+  //! Uniforms of full-screen fill, matching CapFillUniforms.
+  struct Metal_CapFillUniforms
+  {
+    float ViewProjMatrix[16];
+    float InvViewProjMatrix[16];
+    float Viewport[2];
+    float Padding[2];
+  };
+
+  //! Cap properties of the structure slot, matching CapObject.
+  struct Metal_CapObject
+  {
+    float   Color[4];
+    int32_t HatchType;
+    int32_t Padding[3];
+  };
+
+  //! Maximum size of objects table passed by setFragmentBytes().
+  static const size_t THE_MAX_INLINE_OBJECTS_SIZE = 4096;
+
+  //! Return TRUE if primitive array defines surfaces.
+  static bool isSurfaceArray(const Metal_PrimitiveArray* theArray)
+  {
+    switch (theArray->Type())
+    {
+      case Graphic3d_TOPA_TRIANGLES:
+      case Graphic3d_TOPA_TRIANGLESTRIPS:
+      case Graphic3d_TOPA_TRIANGLEFANS:
+        return true;
+      default:
+        return false;
+    }
+  }
+
+  //! Return the first face aspect of the structure.
+  static occ::handle<Graphic3d_Aspects> structureAspect(const Metal_Structure* theStruct)
+  {
+    for (Metal_Structure::GroupIterator aGroupIter(theStruct->Groups()); aGroupIter.More(); aGroupIter.Next())
+    {
+      const Metal_Group* aGroup = aGroupIter.Value();
+      occ::handle<Graphic3d_Aspects> anAspect = aGroup != nullptr ? aGroup->Aspects() : occ::handle<Graphic3d_Aspects>();
+      if (!anAspect.IsNull() && anAspect->InteriorStyle() != Aspect_IS_EMPTY)
+      {
+        return anAspect;
+      }
+    }
+    return theStruct->InstancedStructure() != nullptr
+         ? structureAspect(theStruct->InstancedStructure())
+         : occ::handle<Graphic3d_Aspects>();
+  }
+
+  //! Fill cap properties of the structure for the head of capping chain.
+  static Metal_CapObject capObject(const Graphic3d_ClipPlane& thePlane, const Metal_Structure* theStruct)
+  {
+    const occ::handle<Graphic3d_Aspects> anObjAspect = thePlane.ToUseObjectProperties()
+                                                     ? structureAspect(theStruct)
+                                                     : occ::handle<Graphic3d_Aspects>();
+    Metal_Material aMaterial;
+    if (thePlane.ToUseObjectMaterial() && !anObjAspect.IsNull())
+    {
+      aMaterial.Init(anObjAspect);
+    }
+    else
+    {
+      aMaterial.Init(thePlane.CappingAspect());
+    }
+
+    Metal_CapObject anObject;
+    std::memset(&anObject, 0, sizeof(anObject));
+    const NCollection_Vec4<float>& aColor = aMaterial.Common[0].Diffuse;
+    anObject.Color[0] = aColor.r();
+    anObject.Color[1] = aColor.g();
+    anObject.Color[2] = aColor.b();
+    anObject.Color[3] = aColor.a();
+    if (thePlane.IsHatchOn())
+    {
+      anObject.HatchType = (int32_t)thePlane.CappingHatch();
+    }
+    else if (!anObjAspect.IsNull()
+          && anObjAspect->InteriorStyle() == Aspect_IS_HATCH
+          && !anObjAspect->HatchStyle().IsNull())
+    {
+      anObject.HatchType = anObjAspect->HatchStyle()->HatchType();
+    }
+    return anObject;
+  }
+
+  //! Encode surface arrays of the structure (including instanced one).
+  static void encodeCapStructure(Metal_Context* theCtx,
+                                 id<MTLRenderCommandEncoder> theEncoder,
+                                 const Metal_Structure* theStruct,
+                                 const Metal_CapIdUniforms& theUniforms)
+  {
+    if (theStruct->InstancedStructure() != nullptr)
+    {
+      encodeCapStructure(theCtx, theEncoder, theStruct->InstancedStructure(), theUniforms);
+    }
+
+    for (Metal_Structure::GroupIterator aGroupIter(theStruct->Groups()); aGroupIter.More(); aGroupIter.Next())
+    {
+      const Metal_Group* aGroup = aGroupIter.Value();
+      if (aGroup == nullptr || !theStruct->IsGroupDrawn(*aGroup))
+      {
+        continue;
+      }
+      if (aGroup->HasTransformation())
+      {
+        NCollection_Mat4<float> aModel;
+        std::copy(theUniforms.ModelMatrix, theUniforms.ModelMatrix + 16, aModel.ChangeData());
+        aModel = aModel * aGroup->TransformationMatrix();
+
+        Metal_CapIdUniforms aGroupUniforms = theUniforms;
+        std::copy(aModel.GetData(), aModel.GetData() + 16, aGroupUniforms.ModelMatrix);
+        [theEncoder setVertexBytes:&aGroupUniforms length:sizeof(aGroupUniforms) atIndex:1];
+      }
+
+      for (NCollection_List<Metal_PrimitiveArray*>::Iterator aPrimIter(aGroup->Primitives()); aPrimIter.More(); aPrimIter.Next())
+      {
+        Metal_PrimitiveArray* anArray = aPrimIter.Value();
+        if (anArray == nullptr || !isSurfaceArray(anArray))
+        {
+          continue;
+        }
+        if (!anArray->IsInitialized())
+        {
+          anArray->Init(theCtx);
+        }
+        anArray->DrawPositions(theEncoder);
+      }
+      if (aGroup->HasTransformation())
+      {
+        [theEncoder setVertexBytes:&theUniforms length:sizeof(theUniforms) atIndex:1];
+      }
+    }
+  }
 }
 
 //=================================================================================================
@@ -292,6 +718,15 @@ Metal_CappingAlgo::Metal_CappingAlgo()
   myStencilRenderPipeline(nil),
   myStencilGenDepthState(nil),
   myStencilRenderDepthState(nil),
+  myIdPipeline(nil),
+  myFillPipeline(nil),
+  myIdDepthState(nil),
+  myFillDepthState(nil),
+  myIdTexture(nil),
+  myIdDepthTexture(nil),
+  myFillFormat(0),
+  myIdSizeX(0),
+  myIdSizeY(0),
   myIsInitialized(false)
 {
 }
@@ -322,6 +757,15 @@ void Metal_CappingAlgo::Release(Metal_Context* theCtx)
   myStencilRenderPipeline = nil;
   myStencilGenDepthState = nil;
   myStencilRenderDepthState = nil;
+  myIdPipeline = nil;
+  myFillPipeline = nil;
+  myIdDepthState = nil;
+  myFillDepthState = nil;
+  myIdTexture = nil;
+  myIdDepthTexture = nil;
+  myFillFormat = 0;
+  myIdSizeX = 0;
+  myIdSizeY = 0;
   myIsInitialized = false;
 }
 
@@ -362,9 +806,9 @@ bool Metal_CappingAlgo::createPipelines(Metal_Context* theCtx)
 
   // Stencil generation pipeline (no color output)
   {
-    id<MTLLibrary> aLibrary = [aDevice newLibraryWithSource:[NSString stringWithUTF8String:THE_STENCIL_GEN_SHADER]
-                                                    options:nil
-                                                      error:&anError];
+    id<MTLLibrary> aLibrary = theCtx->LoadShaderLibrary("Metal_CappingAlgo_THE_STENCIL_GEN_SHADER",
+                                                        [NSString stringWithUTF8String:THE_STENCIL_GEN_SHADER],
+                                                        nil, &anError);
     if (aLibrary == nil)
     {
       NSLog(@"Metal_CappingAlgo: Failed to compile stencil gen shader: %@", anError);
@@ -405,9 +849,9 @@ bool Metal_CappingAlgo::createPipelines(Metal_Context* theCtx)
 
   // Capping render pipeline
   {
-    id<MTLLibrary> aLibrary = [aDevice newLibraryWithSource:[NSString stringWithUTF8String:THE_CAPPING_RENDER_SHADER]
-                                                    options:nil
-                                                      error:&anError];
+    id<MTLLibrary> aLibrary = theCtx->LoadShaderLibrary("Metal_CappingAlgo_THE_CAPPING_RENDER_SHADER",
+                                                        [NSString stringWithUTF8String:THE_CAPPING_RENDER_SHADER],
+                                                        nil, &anError);
     if (aLibrary == nil)
     {
       NSLog(@"Metal_CappingAlgo: Failed to compile capping render shader: %@", anError);
@@ -524,3 +968,367 @@ Handle(Metal_CappingPlaneResource) Metal_CappingAlgo::GetPlaneResource(
 
   return aResource;
 }
+
+//=================================================================================================
+
+bool Metal_CappingAlgo::HasCapping(const Graphic3d_SequenceOfHClipPlane& thePlanes)
+{
+  for (Graphic3d_SequenceOfHClipPlane::Iterator aPlaneIter(thePlanes); aPlaneIter.More(); aPlaneIter.Next())
+  {
+    const occ::handle<Graphic3d_ClipPlane>& aPlane = aPlaneIter.Value();
+    if (!aPlane.IsNull() && aPlane->IsOn() && aPlane->IsCapping())
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+//=================================================================================================
+
+bool Metal_CappingAlgo::initSinglePass(Metal_Context* theCtx, unsigned long theColorFormat)
+{
+  if (myIdPipeline != nil && myFillPipeline != nil && myFillFormat == theColorFormat)
+  {
+    return true;
+  }
+  if (theCtx == nullptr || !theCtx->IsValid())
+  {
+    return false;
+  }
+
+  NSError* anError = nil;
+  id<MTLLibrary> aLibrary = theCtx->LoadShaderLibrary("Metal_CappingAlgo_THE_SINGLE_PASS_SHADER",
+                                                      [NSString stringWithUTF8String:THE_SINGLE_PASS_SHADER],
+                                                      nil, &anError);
+  if (aLibrary == nil)
+  {
+    theCtx->Messenger()->SendFail() << "Metal_CappingAlgo: failed to compile single-pass capping shaders: "
+                                    << (anError != nil ? [[anError localizedDescription] UTF8String] : "");
+    return false;
+  }
+
+  id<MTLDevice> aDevice = theCtx->Device();
+  if (myIdPipeline == nil)
+  {
+    MTLRenderPipelineDescriptor* aPipeDesc = [[MTLRenderPipelineDescriptor alloc] init];
+    aPipeDesc.label = @"CappingId";
+    aPipeDesc.vertexFunction   = [aLibrary newFunctionWithName:@"vertex_cap_id"];
+    aPipeDesc.fragmentFunction = [aLibrary newFunctionWithName:@"fragment_cap_id"];
+    aPipeDesc.colorAttachments[0].pixelFormat = MTLPixelFormatR32Uint;
+    aPipeDesc.depthAttachmentPixelFormat = MTLPixelFormatDepth32Float;
+    myIdPipeline = [aDevice newRenderPipelineStateWithDescriptor:aPipeDesc error:&anError];
+    if (myIdPipeline == nil)
+    {
+      theCtx->Messenger()->SendFail() << "Metal_CappingAlgo: failed to create capping ID pipeline: "
+                                      << (anError != nil ? [[anError localizedDescription] UTF8String] : "");
+      return false;
+    }
+
+    MTLDepthStencilDescriptor* aDepthDesc = [[MTLDepthStencilDescriptor alloc] init];
+    aDepthDesc.depthCompareFunction = MTLCompareFunctionLess;
+    aDepthDesc.depthWriteEnabled = YES;
+    myIdDepthState = [aDevice newDepthStencilStateWithDescriptor:aDepthDesc];
+
+    // caps are written into main depth, so that immediate layers are tested against them
+    aDepthDesc.depthCompareFunction = MTLCompareFunctionLessEqual;
+    myFillDepthState = [aDevice newDepthStencilStateWithDescriptor:aDepthDesc];
+  }
+
+  MTLRenderPipelineDescriptor* aFillDesc = [[MTLRenderPipelineDescriptor alloc] init];
+  aFillDesc.label = @"CappingFill";
+  aFillDesc.vertexFunction   = [aLibrary newFunctionWithName:@"vertex_cap_fill"];
+  aFillDesc.fragmentFunction = [aLibrary newFunctionWithName:@"fragment_cap_fill"];
+  aFillDesc.colorAttachments[0].pixelFormat = (MTLPixelFormat)theColorFormat;
+  aFillDesc.colorAttachments[0].blendingEnabled = YES;
+  aFillDesc.colorAttachments[0].sourceRGBBlendFactor = MTLBlendFactorSourceAlpha;
+  aFillDesc.colorAttachments[0].destinationRGBBlendFactor = MTLBlendFactorOneMinusSourceAlpha;
+  aFillDesc.colorAttachments[0].sourceAlphaBlendFactor = MTLBlendFactorOne;
+  aFillDesc.colorAttachments[0].destinationAlphaBlendFactor = MTLBlendFactorOneMinusSourceAlpha;
+  aFillDesc.depthAttachmentPixelFormat = MTLPixelFormatDepth32Float;
+  myFillPipeline = [aDevice newRenderPipelineStateWithDescriptor:aFillDesc error:&anError];
+  myFillFormat = theColorFormat;
+  if (myFillPipeline == nil)
+  {
+    theCtx->Messenger()->SendFail() << "Metal_CappingAlgo: failed to create capping fill pipeline: "
+                                    << (anError != nil ? [[anError localizedDescription] UTF8String] : "");
+    return false;
+  }
+  return myIdDepthState != nil && myFillDepthState != nil;
+}
+
+//=================================================================================================
+
+bool Metal_CappingAlgo::initIdTextures(Metal_Context* theCtx, int theSizeX, int theSizeY)
+{
+  if (myIdTexture != nil && myIdSizeX == theSizeX && myIdSizeY == theSizeY)
+  {
+    return true;
+  }
+
+  myIdTexture = nil;
+  myIdDepthTexture = nil;
+  myIdSizeX = 0;
+  myIdSizeY = 0;
+
+  MTLTextureDescriptor* anIdDesc = [MTLTextureDescriptor texture2DDescriptorWithPixelFormat:MTLPixelFormatR32Uint
+                                                                                      width:theSizeX
+                                                                                     height:theSizeY
+                                                                                  mipmapped:NO];
+  anIdDesc.usage = MTLTextureUsageRenderTarget | MTLTextureUsageShaderRead;
+  anIdDesc.storageMode = MTLStorageModePrivate;
+
+  // depth of ID pass is not needed after the pass
+  MTLTextureDescriptor* aDepthDesc = [MTLTextureDescriptor texture2DDescriptorWithPixelFormat:MTLPixelFormatDepth32Float
+                                                                                        width:theSizeX
+                                                                                       height:theSizeY
+                                                                                    mipmapped:NO];
+  aDepthDesc.usage = MTLTextureUsageRenderTarget;
+  aDepthDesc.storageMode = MTLStorageModePrivate;
+  if (theCtx->HasMemorylessRenderTargets())
+  {
+    if (@available(macOS 11.0, iOS 10.0, *))
+    {
+      aDepthDesc.storageMode = MTLStorageModeMemoryless;
+    }
+  }
+
+  myIdTexture      = [theCtx->Device() newTextureWithDescriptor:anIdDesc];
+  myIdDepthTexture = [theCtx->Device() newTextureWithDescriptor:aDepthDesc];
+  if (myIdTexture == nil || myIdDepthTexture == nil)
+  {
+    theCtx->Messenger()->SendFail() << "Metal_CappingAlgo: failed to allocate " << theSizeX << "x" << theSizeY << " capping ID target";
+    myIdTexture = nil;
+    myIdDepthTexture = nil;
+    return false;
+  }
+
+  myIdTexture.label = @"CappingId";
+  myIdSizeX = theSizeX;
+  myIdSizeY = theSizeY;
+  return true;
+}
+
+//=================================================================================================
+
+void Metal_CappingAlgo::RenderSinglePass(Metal_Context* theCtx,
+                                         id<MTLCommandBuffer> theCmdBuffer,
+                                         id<MTLTexture> theTarget,
+                                         id<MTLTexture> theDepth,
+                                         const NCollection_List<occ::handle<Graphic3d_Layer>>& theLayers,
+                                         const Graphic3d_SequenceOfHClipPlane& thePlanes,
+                                         int theViewId,
+                                         const NCollection_Mat4<float>& theViewProj)
+{
+  NCollection_Mat4<float> anInvViewProj;
+  if (theCmdBuffer == nil || theTarget == nil || theDepth == nil
+   || !HasCapping(thePlanes)
+   || !theViewProj.Inverted(anInvViewProj))
+  {
+    return;
+  }
+
+  const int aSizeX = (int)theTarget.width;
+  const int aSizeY = (int)theTarget.height;
+  if (!initSinglePass(theCtx, (unsigned long)theTarget.pixelFormat)
+   || !initIdTextures(theCtx, aSizeX, aSizeY))
+  {
+    return;
+  }
+
+  // world-space equations of enabled planes, planes of a chain are kept together
+  Metal_CapClipUniforms aClip;
+  std::memset(&aClip, 0, sizeof(aClip));
+  NCollection_Vector<occ::handle<Graphic3d_ClipPlane>> aChains;
+  for (Graphic3d_SequenceOfHClipPlane::Iterator aPlaneIter(thePlanes); aPlaneIter.More(); aPlaneIter.Next())
+  {
+    const occ::handle<Graphic3d_ClipPlane>& aHead = aPlaneIter.Value();
+    if (aHead.IsNull() || !aHead->IsOn())
+    {
+      continue;
+    }
+    if (aClip.NbPlanes + aHead->NbChainNextPlanes() > Metal_Clipping_MaxPlanes)
+    {
+      theCtx->Messenger()->SendWarning() << "Metal_CappingAlgo: clipping planes above " << Metal_Clipping_MaxPlanes << " are ignored by capping";
+      break;
+    }
+
+    for (const Graphic3d_ClipPlane* aPlane = aHead.get(); aPlane != nullptr; aPlane = aPlane->ChainNextPlane().get())
+    {
+      const NCollection_Vec4<double>& anEq = aPlane->GetEquation();
+      for (int aCompIter = 0; aCompIter < 4; ++aCompIter)
+      {
+        aClip.Planes[aClip.NbPlanes][aCompIter] = (float)anEq.GetData()[aCompIter];
+      }
+      aClip.Chains[aClip.NbPlanes] = aChains.Length();
+      ++aClip.NbPlanes;
+    }
+    aChains.Append(aHead);
+  }
+
+  // visible structures of non-immediate layers
+  std::vector<const Metal_Structure*> aStructs;
+  for (NCollection_List<occ::handle<Graphic3d_Layer>>::Iterator aLayerIter(theLayers); aLayerIter.More(); aLayerIter.Next())
+  {
+    const occ::handle<Graphic3d_Layer>& aLayer = aLayerIter.Value();
+    if (aLayer.IsNull() || aLayer->NbStructures() == 0
+     || aLayer->IsImmediate() || aLayer->IsCulled())
+    {
+      continue;
+    }
+
+    const Graphic3d_ArrayOfIndexedMapOfStructure& aStructArray = aLayer->ArrayOfStructures();
+    for (int aPriorityIdx = 0; aPriorityIdx < Graphic3d_DisplayPriority_NB; ++aPriorityIdx)
+    {
+      const NCollection_IndexedMap<const Graphic3d_CStructure*>& aStructMap = aStructArray[aPriorityIdx];
+      for (int aStructIdx = 1; aStructIdx <= aStructMap.Extent(); ++aStructIdx)
+      {
+        const Graphic3d_CStructure* aCStruct = aStructMap.FindKey(aStructIdx);
+        if (aCStruct != nullptr
+        && !aCStruct->IsCulled()
+        &&  aCStruct->IsVisible(theViewId))
+        {
+          // all structures of the view are created by Metal_GraphicDriver
+          aStructs.push_back(static_cast<const Metal_Structure*>(aCStruct));
+        }
+      }
+    }
+  }
+
+  Metal_CapIdUniforms anIdUniforms;
+  std::copy(theViewProj.GetData(), theViewProj.GetData() + 16, anIdUniforms.ViewProjMatrix);
+
+  Metal_CapFillUniforms aFillUniforms;
+  std::memset(&aFillUniforms, 0, sizeof(aFillUniforms));
+  std::copy(theViewProj.GetData(), theViewProj.GetData() + 16, aFillUniforms.ViewProjMatrix);
+  std::copy(anInvViewProj.GetData(), anInvViewProj.GetData() + 16, aFillUniforms.InvViewProjMatrix);
+  aFillUniforms.Viewport[0] = (float)aSizeX;
+  aFillUniforms.Viewport[1] = (float)aSizeY;
+
+  const MTLViewport aViewport = { 0.0, 0.0, (double)aSizeX, (double)aSizeY, 0.0, 1.0 };
+  std::vector<const Metal_Structure*> aCutStructs;
+  std::vector<Metal_CapObject> anObjects;
+  for (int aChainIter = 0; aChainIter < aChains.Length(); ++aChainIter)
+  {
+    const occ::handle<Graphic3d_ClipPlane>& aHead = aChains.Value(aChainIter);
+    if (!aHead->IsCapping())
+    {
+      continue;
+    }
+
+    // only structures cut by the chain may show back faces behind its caps;
+    // structures in front of the cap are handled by depth test against main pass
+    aCutStructs.clear();
+    anObjects.clear();
+    for (const Metal_Structure* aStruct : aStructs)
+    {
+      const Graphic3d_BndBox3d& aBox = aStruct->BoundingBox();
+      if (aBox.IsValid()
+       && aHead->ProbeBox(aBox) != Graphic3d_ClipState_On)
+      {
+        continue;
+      }
+      aCutStructs.push_back(aStruct);
+      anObjects.push_back(capObject(*aHead, aStruct));
+    }
+    if (aCutStructs.empty())
+    {
+      continue;
+    }
+
+    // ID pass: front-most fragment of clipped geometry of all cut structures
+    MTLRenderPassDescriptor* anIdPassDesc = [MTLRenderPassDescriptor renderPassDescriptor];
+    anIdPassDesc.colorAttachments[0].texture = myIdTexture;
+    anIdPassDesc.colorAttachments[0].loadAction = MTLLoadActionClear;
+    anIdPassDesc.colorAttachments[0].storeAction = MTLStoreActionStore;
+    anIdPassDesc.colorAttachments[0].clearColor = MTLClearColorMake(0.0, 0.0, 0.0, 0.0);
+    anIdPassDesc.depthAttachment.texture = myIdDepthTexture;
+    anIdPassDesc.depthAttachment.loadAction = MTLLoadActionClear;
+    anIdPassDesc.depthAttachment.storeAction = MTLStoreActionDontCare;
+    anIdPassDesc.depthAttachment.clearDepth = 1.0;
+    id<MTLRenderCommandEncoder> anIdEncoder = [theCmdBuffer renderCommandEncoderWithDescriptor:anIdPassDesc];
+    if (anIdEncoder == nil)
+    {
+      return;
+    }
+    anIdEncoder.label = @"CappingId";
+    [anIdEncoder setViewport:aViewport];
+    [anIdEncoder setRenderPipelineState:myIdPipeline];
+    [anIdEncoder setDepthStencilState:myIdDepthState];
+    [anIdEncoder setCullMode:MTLCullModeNone];
+    [anIdEncoder setFragmentBytes:&aClip length:sizeof(aClip) atIndex:0];
+    for (size_t aSlotIter = 0; aSlotIter < aCutStructs.size(); ++aSlotIter)
+    {
+      const Metal_Structure* aStruct = aCutStructs[aSlotIter];
+      const NCollection_Mat4<float>& aModel = aStruct->RenderTransformation();
+      std::copy(aModel.GetData(), aModel.GetData() + 16, anIdUniforms.ModelMatrix);
+      [anIdEncoder setVertexBytes:&anIdUniforms length:sizeof(anIdUniforms) atIndex:1];
+
+      // slot is stored with +1 offset, so that zero means front face or empty pixel
+      const uint32_t aSlot = uint32_t(aSlotIter + 1);
+      [anIdEncoder setFragmentBytes:&aSlot length:sizeof(aSlot) atIndex:1];
+      encodeCapStructure(theCtx, anIdEncoder, aStruct, anIdUniforms);
+    }
+    [anIdEncoder endEncoding];
+
+    // fill pass: one full-screen triangle per plane of the chain
+    MTLRenderPassDescriptor* aFillPassDesc = [MTLRenderPassDescriptor renderPassDescriptor];
+    aFillPassDesc.colorAttachments[0].texture = theTarget;
+    aFillPassDesc.colorAttachments[0].loadAction = MTLLoadActionLoad;
+    aFillPassDesc.colorAttachments[0].storeAction = MTLStoreActionStore;
+    aFillPassDesc.depthAttachment.texture = theDepth;
+    aFillPassDesc.depthAttachment.loadAction = MTLLoadActionLoad;
+    aFillPassDesc.depthAttachment.storeAction = MTLStoreActionStore;
+    id<MTLRenderCommandEncoder> aFillEncoder = [theCmdBuffer renderCommandEncoderWithDescriptor:aFillPassDesc];
+    if (aFillEncoder == nil)
+    {
+      return;
+    }
+    aFillEncoder.label = @"CappingFill";
+    [aFillEncoder setViewport:aViewport];
+    [aFillEncoder setRenderPipelineState:myFillPipeline];
+    [aFillEncoder setDepthStencilState:myFillDepthState];
+    [aFillEncoder setCullMode:MTLCullModeNone];
+    [aFillEncoder setFragmentTexture:myIdTexture atIndex:0];
+    [aFillEncoder setFragmentBytes:&aFillUniforms length:sizeof(aFillUniforms) atIndex:0];
+
+    const size_t anObjectsSize = anObjects.size() * sizeof(Metal_CapObject);
+    if (anObjectsSize <= THE_MAX_INLINE_OBJECTS_SIZE)
+    {
+      [aFillEncoder setFragmentBytes:anObjects.data() length:anObjectsSize atIndex:2];
+    }
+    else
+    {
+      Metal_UniformRing* aRing = theCtx->UniformRing().get();
+      id<MTLBuffer> anObjectsBuffer = nil;
+      size_t anOffset = 0;
+      if (aRing == nullptr
+      || !aRing->Allocate(anObjects.data(), anObjectsSize, anObjectsBuffer, anOffset))
+      {
+        anObjectsBuffer = [theCtx->Device() newBufferWithBytes:anObjects.data()
+                                                        length:anObjectsSize
+                                                       options:MTLResourceStorageModeShared];
+        anOffset = 0;
+      }
+      if (anObjectsBuffer == nil)
+      {
+        [aFillEncoder endEncoding];
+        return;
+      }
+      [aFillEncoder setFragmentBuffer:anObjectsBuffer offset:anOffset atIndex:2];
+    }
+
+    aClip.CapChain = aChainIter;
+    for (int aPlaneIter = 0; aPlaneIter < aClip.NbPlanes; ++aPlaneIter)
+    {
+      if (aClip.Chains[aPlaneIter] != aChainIter)
+      {
+        continue;
+      }
+      aClip.CapPlane = aPlaneIter;
+      [aFillEncoder setFragmentBytes:&aClip length:sizeof(aClip) atIndex:1];
+      [aFillEncoder drawPrimitives:MTLPrimitiveTypeTriangle vertexStart:0 vertexCount:3];
+    }
+    [aFillEncoder endEncoding];
+  }
+}
@@ -16,6 +16,7 @@
 
 #include <Standard_Type.hxx>
 #include <Standard_Transient.hxx>
+#include <TCollection_AsciiString.hxx>
 
 //! Class to define Metal graphic driver capabilities and configuration options.
 class Metal_Caps : public Standard_Transient
@@ -33,7 +34,8 @@ public: //! @name flags to disable particular functionality
   //! Flag permits Point Sprites usage (OFF by default)
   bool pntSpritesDisable;
 
-  //! Disables freeing CPU memory after building GPU buffers (OFF by default)
+  //! Disables freeing CPU memory after building GPU buffers (OFF by default).
+  //! Arrays adopted by useZeroCopyArrays always keep CPU memory, as it is shared with GPU.
   bool keepArrayData;
 
   //! Controls swap interval - 0 for VSync off and 1 for VSync on, 1 by default
@@ -60,6 +62,10 @@ public: //! @name context creation parameters
   //! OFF by default (prefer high-performance GPU).
   bool preferLowPowerGPU;
 
+  //! Registry ID of Metal device to use (see Metal_Context::EnumerateDevices()).
+  //! 0 by default which means selection by preferLowPowerGPU flag.
+  uint64_t deviceRegistryId;
+
   //! Request GPU capture scope to be enabled for debugging with Xcode.
   //! OFF by default.
   bool enableGPUCapture;
@@ -78,6 +84,181 @@ public: //! @name Metal-specific feature flags
   //! 3 by default for triple-buffering.
   int maxFramesInFlight;
 
+  //! Low-latency frame pacing for interactive manipulation (e.g. dragging AIS_Manipulator):
+  //! a single frame is kept in flight (two frames while CPU and GPU times of a frame
+  //! together exceed display refresh interval) and the Metal layer queues at most two drawables.
+  //! Resources are still rotated through maxFramesInFlight slots, so that the option can be toggled
+  //! at any moment, for instance only while the mouse button is pressed.
+  //! OFF by default.
+  bool lowLatencyPacing;
+
+  //! Present drawables synchronously with Core Animation transaction (CAMetalLayer::presentsWithTransaction),
+  //! so that the frame appears together with changes of other layers (e.g. while resizing the window);
+  //! the thread is blocked until the frame commands are scheduled, which adds latency.
+  //! OFF by default.
+  bool presentsWithTransaction;
+
+  //! Size of MTLHeap blocks used for sub-allocation of vertex, index and uniform buffers
+  //! (see Metal_BufferAllocator); 0 allocates dedicated MTLBuffer per object.
+  //! 16 MiB by default.
+  size_t bufferHeapBlockSize;
+
+  //! Keep GPU memory within a budget by releasing vertex and index buffers of structures
+  //! not displayed for a while; buffers are uploaded again once the structure is displayed
+  //! (see Metal_ResidencyManager). ON by default.
+  bool useResidencyManager;
+
+  //! GPU memory budget in bytes for Metal_ResidencyManager;
+  //! 0 means the working set recommended by the device (MTLDevice::recommendedMaxWorkingSetSize).
+  //! 0 by default.
+  size_t gpuMemoryBudget;
+
+  //! Place vertex and index data into GPU-private memory on devices without unified memory
+  //! (discrete GPUs); data is uploaded by blit through staging ring (see Metal_StagingRing).
+  //! ON by default.
+  bool usePrivateVertexBuffers;
+
+  //! Submit uploads into new resources (see Metal_StagingRing), mipmaps generation and builds of
+  //! ray-tracing acceleration structures to a dedicated command queue (Metal_Context::TransferQueue()),
+  //! so that they run concurrently with rendering of frames in flight; frames wait for an MTLSharedEvent
+  //! only when they use the transferred data. Updates of resources in use stay on the main queue.
+  //! ON by default.
+  bool useTransferQueue;
+
+  //! Allocate Graphic3d_Buffer data by page-aligned Metal_PageAllocator on devices with unified memory,
+  //! so that Metal_PrimitiveArray wraps large index and non-interleaved vertex arrays by MTLBuffer
+  //! without copying them (see Metal_Buffer::Adopt()).
+  //! Affects the process-wide Graphic3d_Buffer::SetDefaultAllocator() and applies to arrays created
+  //! after Metal_GraphicDriver::InitContext(); interleaved vertex attributes are still copied.
+  //! OFF by default.
+  bool useZeroCopyArrays;
+
+  //! Upload nodal normals of static triangulations as octahedral vectors of 2 normalized 16-bit integers
+  //! and texture coordinates as half floats (see Graphic3d_VertexQuantizer), decoded by vertex shaders.
+  //! Positions are kept in float precision, as they are read by shadow, capping, picking and hidden line passes.
+  //! Ignored for arrays drawn by mesh shaders or recorded into indirect command buffers.
+  //! OFF by default.
+  bool useQuantizedVertices;
+
+  //! Allocate render targets which are not read after the pass (main depth buffer, MSAA attachments)
+  //! in tile memory (MTLStorageModeMemoryless) on Apple GPUs.
+  //! An attachment falls back to private storage once a later pass needs its content
+  //! (GPU occlusion culling, immediate layers, depth readback, loading MSAA attachment).
+  //! ON by default.
+  bool useMemorylessAttachments;
+
+  //! Record render commands of Z-layers, which content has not been changed since previous frame,
+  //! into MTLIndirectCommandBuffer and replay it instead of encoding draw calls on CPU
+  //! (see Metal_IndirectLayer). Only layers containing plain shaded geometry are recorded.
+  //! OFF by default.
+  bool useIndirectCommandBuffers;
+
+  //! Render large triangle arrays with nodal normals as meshlets by object and mesh shaders
+  //! (see Metal_MeshletBuffer), culling meshlets by view frustum and by normal cone on GPU.
+  //! Falls back to classic vertex pipeline on devices without mesh shaders (Metal_Context::HasMeshShaders()).
+  //! OFF by default.
+  bool useMeshShaders;
+
+  //! Cull draw calls of recorded static layers on GPU (see Metal_GpuCulling)
+  //! by view frustum and by hierarchical depth of the previous frame.
+  //! Has effect only together with useIndirectCommandBuffers.
+  //! OFF by default.
+  bool useGpuCulling;
+
+  //! Encode main pass by OSD_ThreadPool workers into sub-encoders of MTLParallelRenderCommandEncoder,
+  //! each worker using own Metal_Workspace.
+  //! OFF by default.
+  bool useParallelEncoding;
+
+  //! Minimal number of structures within the main pass to be encoded in parallel
+  //! (smaller scenes are encoded by single thread).
+  //! 64 by default.
+  int parallelEncodingMinStructures;
+
+  //! Sort draw calls of opaque layers by render state (pipeline, depth state, textures, material, vertex buffer)
+  //! before submission to reduce state changes (see Metal_DrawList).
+  //! Layers replayed from indirect command buffers and parallel encoding are not affected.
+  //! OFF by default.
+  bool useSortedDrawList;
+
+  //! Merge draws within sorted draw list (see useSortedDrawList) of structures sharing the same
+  //! attribute data and aspect, but differing by transformation or highlight color, into single instanced draw.
+  //! OFF by default.
+  bool useAutoInstancing;
+
+  //! Number of cascades of directional light shadow map within [1, Metal_ShadowMap::MaxCascades]
+  //! (see Graphic3d_RenderingParams::IsShadowEnabled and Graphic3d_CLight::ToCastShadows()).
+  //! 4 by default.
+  int shadowMapCascades;
+
+  //! Render text using signed distance field glyph atlas (see Metal_Font::DistanceFieldSpread()).
+  //! Glyphs are rasterized once at reference size and the atlas is shared by all text heights and resolutions
+  //! of the same font, instead of dedicated bitmap atlas per pixel size.
+  //! OFF by default.
+  bool useDistanceFieldFonts;
+
+  //! Minimal image dimension (width or height) for which background image is streamed
+  //! by tiles into sparse texture instead of uploading the whole image (see Metal_SparseTexture);
+  //! on devices without sparse textures such image is downsampled to fit streamedTextureBudget.
+  //! 0 disables streaming. 8192 by default.
+  int streamedTextureMinSize;
+
+  //! GPU memory budget in bytes of a single streamed texture (size of its sparse heap).
+  //! 128 MiB by default.
+  size_t streamedTextureBudget;
+
+  //! Minimal number of points for point array to be rendered with level of detail (see Metal_PointCloud):
+  //! points are sorted into octree on a background queue, and only nodes which subsampled points
+  //! are denser than pointCloudPixelError on screen are streamed into GPU memory and drawn.
+  //! 0 disables level of detail. 1000000 by default.
+  int pointCloudMinPoints;
+
+  //! GPU memory budget in bytes for points of a single level of detail point cloud.
+  //! 256 MiB by default.
+  size_t pointCloudBudget;
+
+  //! Maximal screen-space distance in pixels between points of the drawn octree nodes;
+  //! child nodes are drawn in place of a node with larger spacing on screen.
+  //! 2 by default.
+  float pointCloudPixelError;
+
+  //! Rasterize points of level of detail point clouds by compute kernel with 64-bit atomics
+  //! into per-pixel depth and color buffer, resolved over the main pass (see Metal_PointCloudRaster),
+  //! instead of drawing point primitives (which are slow for millions of one pixel points).
+  //! Points are one pixel large and are not clipped by clipping planes.
+  //! Requires Apple8 GPU family; ignored on other devices.
+  //! OFF by default.
+  bool usePointCloudCompute;
+
+  //! Compact ray-tracing acceleration structures of Metal_SceneGeometry after build:
+  //! the structure is copied into a right-sized one and the original is released,
+  //! which typically saves 30-50% of their memory at the cost of extra GPU round trip per build.
+  //! ON by default.
+  bool compactAccelerationStructures;
+
+public: //! @name shader compilation
+
+  //! Load precompiled shader libraries (*.metallib built together with TKMetal)
+  //! instead of compiling embedded shader sources at runtime, when available.
+  //! ON by default.
+  bool useOfflineShaders;
+
+  //! Path to the file storing render pipelines binary archive (MTLBinaryArchive) between sessions.
+  //! Warm starts reuse archived pipelines and skip back-end shader compilation.
+  //! Initialized from CSF_MetalPipelineCache environment variable; empty (disabled) by default.
+  TCollection_AsciiString pipelineCachePath;
+
+  //! Path to the file recording render pipeline permutations used by the session (Metal_PipelineProfile).
+  //! Recorded permutations are precompiled in background at the next startup.
+  //! Initialized from CSF_MetalPipelineProfile environment variable; empty (disabled) by default.
+  TCollection_AsciiString pipelineProfilePath;
+
+  //! Compile missing render pipelines asynchronously instead of stalling the frame;
+  //! a cheaper fallback program (without optional features or unlit) is used until compilation is done,
+  //! and the view remains invalidated till then.
+  //! OFF by default.
+  bool asyncPipelineCompilation;
+
 public: //! @name flags to activate verbose output
 
   //! Print shader compilation warnings, if any. OFF by default.
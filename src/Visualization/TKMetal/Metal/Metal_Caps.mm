@@ -13,6 +13,8 @@
 
 #include <Metal_Caps.hxx>
 
+#include <OSD_Environment.hxx>
+
 IMPLEMENT_STANDARD_RTTIEXT(Metal_Caps, Standard_Transient)
 
 // =======================================================================
@@ -29,13 +31,44 @@ Metal_Caps::Metal_Caps()
   buffersOpaqueAlpha(true),
   contextDebug(false),
   preferLowPowerGPU(false),
+  deviceRegistryId(0),
   enableGPUCapture(false),
   useArgumentBuffers(true),
   useTripleBuffering(true),
   maxFramesInFlight(3),
+  lowLatencyPacing(false),
+  presentsWithTransaction(false),
+  bufferHeapBlockSize(16 * 1024 * 1024),
+  useResidencyManager(true),
+  gpuMemoryBudget(0),
+  usePrivateVertexBuffers(true),
+  useTransferQueue(true),
+  useZeroCopyArrays(false),
+  useQuantizedVertices(false),
+  useMemorylessAttachments(true),
+  useIndirectCommandBuffers(false),
+  useMeshShaders(false),
+  useGpuCulling(false),
+  useParallelEncoding(false),
+  parallelEncodingMinStructures(64),
+  useSortedDrawList(false),
+  useAutoInstancing(false),
+  shadowMapCascades(4),
+  useDistanceFieldFonts(false),
+  streamedTextureMinSize(8192),
+  streamedTextureBudget(128 * 1024 * 1024),
+  pointCloudMinPoints(1000000),
+  pointCloudBudget(256 * 1024 * 1024),
+  pointCloudPixelError(2.0f),
+  usePointCloudCompute(false),
+  compactAccelerationStructures(true),
+  useOfflineShaders(true),
+  asyncPipelineCompilation(false),
   shaderWarnings(false),
   suppressExtraMsg(true)
 {
+  pipelineCachePath = OSD_Environment("CSF_MetalPipelineCache").Value();
+  pipelineProfilePath = OSD_Environment("CSF_MetalPipelineProfile").Value();
 #ifdef OCCT_DEBUG
   contextDebug = true;
   shaderWarnings = true;
@@ -66,10 +99,41 @@ Metal_Caps& Metal_Caps::operator=(const Metal_Caps& theCopy)
   buffersOpaqueAlpha  = theCopy.buffersOpaqueAlpha;
   contextDebug        = theCopy.contextDebug;
   preferLowPowerGPU   = theCopy.preferLowPowerGPU;
+  deviceRegistryId    = theCopy.deviceRegistryId;
   enableGPUCapture    = theCopy.enableGPUCapture;
   useArgumentBuffers  = theCopy.useArgumentBuffers;
   useTripleBuffering  = theCopy.useTripleBuffering;
   maxFramesInFlight   = theCopy.maxFramesInFlight;
+  lowLatencyPacing    = theCopy.lowLatencyPacing;
+  presentsWithTransaction = theCopy.presentsWithTransaction;
+  bufferHeapBlockSize = theCopy.bufferHeapBlockSize;
+  useResidencyManager = theCopy.useResidencyManager;
+  gpuMemoryBudget     = theCopy.gpuMemoryBudget;
+  usePrivateVertexBuffers = theCopy.usePrivateVertexBuffers;
+  useTransferQueue = theCopy.useTransferQueue;
+  useZeroCopyArrays   = theCopy.useZeroCopyArrays;
+  useQuantizedVertices = theCopy.useQuantizedVertices;
+  useMemorylessAttachments = theCopy.useMemorylessAttachments;
+  useIndirectCommandBuffers = theCopy.useIndirectCommandBuffers;
+  useMeshShaders      = theCopy.useMeshShaders;
+  useGpuCulling       = theCopy.useGpuCulling;
+  useParallelEncoding = theCopy.useParallelEncoding;
+  parallelEncodingMinStructures = theCopy.parallelEncodingMinStructures;
+  useSortedDrawList   = theCopy.useSortedDrawList;
+  useAutoInstancing   = theCopy.useAutoInstancing;
+  shadowMapCascades   = theCopy.shadowMapCascades;
+  useDistanceFieldFonts = theCopy.useDistanceFieldFonts;
+  streamedTextureMinSize = theCopy.streamedTextureMinSize;
+  streamedTextureBudget = theCopy.streamedTextureBudget;
+  pointCloudMinPoints = theCopy.pointCloudMinPoints;
+  pointCloudBudget    = theCopy.pointCloudBudget;
+  pointCloudPixelError = theCopy.pointCloudPixelError;
+  usePointCloudCompute = theCopy.usePointCloudCompute;
+  compactAccelerationStructures = theCopy.compactAccelerationStructures;
+  useOfflineShaders   = theCopy.useOfflineShaders;
+  pipelineCachePath   = theCopy.pipelineCachePath;
+  pipelineProfilePath = theCopy.pipelineProfilePath;
+  asyncPipelineCompilation = theCopy.asyncPipelineCompilation;
   shaderWarnings      = theCopy.shaderWarnings;
   suppressExtraMsg    = theCopy.suppressExtraMsg;
   return *this;
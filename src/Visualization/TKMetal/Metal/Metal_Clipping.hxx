@@ -14,12 +14,14 @@
 #ifndef Metal_Clipping_HeaderFile
 #define Metal_Clipping_HeaderFile
 
+#include <Graphic3d_BndBox3d.hxx>
 #include <Graphic3d_ClipPlane.hxx>
 #include <Graphic3d_SequenceOfHClipPlane.hxx>
 #include <NCollection_Vector.hxx>
 #include <Standard_Transient.hxx>
 
 class Metal_Context;
+struct Metal_ClipPlaneUniforms;
 
 //! Maximum number of clipping planes.
 static const int Metal_Clipping_MaxPlanes = 8;
@@ -78,6 +80,22 @@ public:
   //! @param[out] theCount  number of active planes
   Standard_EXPORT void GetPlaneEquations(float* thePlanes, int& theCount) const;
 
+  //! Select clipping planes to be evaluated by fragment shader for an object with specified bounding box.
+  //! Plane chains keeping the whole box are skipped, so that objects not crossed by any plane are drawn
+  //! by programs without clipping, and only planes crossing the object count against Metal_MaxClipPlanes.
+  //! @param[in]  theViewPlanes planes of the view, or NULL
+  //! @param[in]  theObjPlanes  planes of the object, or NULL; replace view planes when ToOverrideGlobal() is set
+  //! @param[in]  theBox        world-space bounding box of the object, or NULL to select all active planes
+  //! @param[out] theUniforms   selected plane equations
+  //! @param[out] theNbDropped  number of planes crossing the object beyond Metal_MaxClipPlanes
+  //! @return Graphic3d_ClipState_Out if the object is entirely clipped,
+  //!         Graphic3d_ClipState_In if it is not clipped at all and Graphic3d_ClipState_On otherwise
+  Standard_EXPORT static Graphic3d_ClipState SelectPlanes(const Graphic3d_SequenceOfHClipPlane* theViewPlanes,
+                                                          const Graphic3d_SequenceOfHClipPlane* theObjPlanes,
+                                                          const Graphic3d_BndBox3d* theBox,
+                                                          Metal_ClipPlaneUniforms& theUniforms,
+                                                          int& theNbDropped);
+
   //! Return plane data for shader uniform buffer.
   const NCollection_Vector<Metal_ClippingPlaneData>& PlaneData() const { return myPlaneData; }
 
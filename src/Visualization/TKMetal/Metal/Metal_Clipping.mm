@@ -15,6 +15,7 @@
 
 #include <Metal_Clipping.hxx>
 #include <Metal_Context.hxx>
+#include <Metal_ShaderManager.hxx>
 
 IMPLEMENT_STANDARD_RTTIEXT(Metal_Clipping, Standard_Transient)
 
@@ -204,6 +205,73 @@ void Metal_Clipping::GetPlaneEquations(float* thePlanes, int& theCount) const
   }
 }
 
+// =======================================================================
+// function : SelectPlanes
+// purpose  : Select planes crossing the object
+// =======================================================================
+Graphic3d_ClipState Metal_Clipping::SelectPlanes(const Graphic3d_SequenceOfHClipPlane* theViewPlanes,
+                                                 const Graphic3d_SequenceOfHClipPlane* theObjPlanes,
+                                                 const Graphic3d_BndBox3d* theBox,
+                                                 Metal_ClipPlaneUniforms& theUniforms,
+                                                 int& theNbDropped)
+{
+  memset(&theUniforms, 0, sizeof(theUniforms));
+  theNbDropped = 0;
+
+  const bool toUseView = theViewPlanes != nullptr
+                      && (theObjPlanes == nullptr || !theObjPlanes->ToOverrideGlobal());
+  const Graphic3d_SequenceOfHClipPlane* aSequences[2] = { toUseView ? theViewPlanes : nullptr, theObjPlanes };
+  bool isCrossed = false;
+  for (int aSeqIter = 0; aSeqIter < 2; ++aSeqIter)
+  {
+    if (aSequences[aSeqIter] == nullptr)
+    {
+      continue;
+    }
+
+    for (Graphic3d_SequenceOfHClipPlane::Iterator aPlaneIter(*aSequences[aSeqIter]);
+         aPlaneIter.More(); aPlaneIter.Next())
+    {
+      const occ::handle<Graphic3d_ClipPlane>& aPlane = aPlaneIter.Value();
+      if (aPlane.IsNull() || !aPlane->IsOn())
+      {
+        continue;
+      }
+
+      if (theBox != nullptr)
+      {
+        // the chain clips points outside all of its half-spaces
+        const Graphic3d_ClipState aState = aPlane->ProbeBox(*theBox);
+        if (aState == Graphic3d_ClipState_Out)
+        {
+          theUniforms.PlaneCount = 0;
+          return Graphic3d_ClipState_Out;
+        }
+        else if (aState == Graphic3d_ClipState_In)
+        {
+          continue;
+        }
+      }
+
+      isCrossed = true;
+      if (theUniforms.PlaneCount >= Metal_MaxClipPlanes)
+      {
+        ++theNbDropped;
+        continue;
+      }
+
+      // fragment shader evaluates the head plane of the chain
+      const NCollection_Vec4<double>& anEq = aPlane->GetEquation();
+      float* aDst = theUniforms.Planes[theUniforms.PlaneCount++];
+      aDst[0] = static_cast<float>(anEq.x());
+      aDst[1] = static_cast<float>(anEq.y());
+      aDst[2] = static_cast<float>(anEq.z());
+      aDst[3] = static_cast<float>(anEq.w());
+    }
+  }
+  return isCrossed ? Graphic3d_ClipState_On : Graphic3d_ClipState_In;
+}
+
 // =======================================================================
 // function : recalculatePlanes
 // purpose  : Recalculate plane equations transformed to view space
@@ -119,7 +119,7 @@ void Metal_ComputeEncoder::SetBuffer(const occ::handle<Metal_Buffer>& theBuffer,
   }
 
   [myEncoder setBuffer:theBuffer->Buffer()
-                offset:0
+                offset:static_cast<NSUInteger>(theBuffer->Offset())
                atIndex:static_cast<NSUInteger>(theIndex)];
 }
 
@@ -0,0 +1,256 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#ifndef Metal_ComputeService_HeaderFile
+#define Metal_ComputeService_HeaderFile
+
+#include <Metal_ComputeEncoder.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_List.hxx>
+#include <OSD_Parallel.hxx>
+#include <TCollection_AsciiString.hxx>
+
+#include <functional>
+#include <future>
+
+#ifdef __OBJC__
+@protocol MTLBuffer;
+@protocol MTLCommandBuffer;
+@protocol MTLCommandQueue;
+#endif
+
+class Metal_Context;
+
+//! Shared-storage buffer of compute tasks, either holding a copy of application data
+//! or wrapping page-aligned application memory without copying.
+class Metal_ComputeBuffer : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(Metal_ComputeBuffer, Standard_Transient)
+  friend class Metal_ComputeService;
+public:
+
+  //! Destructor.
+  Standard_EXPORT ~Metal_ComputeBuffer() override;
+
+  //! Return buffer size in bytes.
+  size_t Size() const { return mySize; }
+
+  //! Return TRUE if the buffer wraps application memory, so that GPU reads and writes it directly;
+  //! the memory should remain alive until completion of tasks using the buffer.
+  bool IsWrapped() const { return myIsWrapped; }
+
+  //! Return CPU pointer to buffer contents.
+  Standard_EXPORT void* Contents() const;
+
+#ifdef __OBJC__
+  //! Return Metal buffer.
+  id<MTLBuffer> Buffer() const { return myBuffer; }
+#endif
+
+private:
+
+  //! Empty constructor; buffers are created by Metal_ComputeService.
+  Metal_ComputeBuffer() : myBuffer(nullptr), mySize(0), myIsWrapped(false) {}
+
+private:
+
+#ifdef __OBJC__
+  id<MTLBuffer> myBuffer;
+#else
+  void*         myBuffer;
+#endif
+  size_t        mySize;      //!< size in bytes
+  bool          myIsWrapped; //!< flag indicating wrapped application memory
+};
+
+//! Compute work encoded into a single command buffer of Metal_ComputeService.
+//!
+//! Kernels are encoded through Encoder() (buffers should be bound by SetBuffer() to keep them alive)
+//! between Metal_ComputeService::NewTask() and Commit(), which submits the work without waiting.
+//! Completion is awaited by Wait() or through Future(); arrays registered by ReadBack()
+//! are filled before the future becomes ready, on the completion thread of Metal,
+//! thus they should not be accessed until then.
+class Metal_ComputeTask : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(Metal_ComputeTask, Standard_Transient)
+  friend class Metal_ComputeService;
+public:
+
+  //! Destructor.
+  Standard_EXPORT ~Metal_ComputeTask() override;
+
+  //! Return encoder of the task, valid until Commit().
+  Metal_ComputeEncoder& Encoder() { return myEncoder; }
+
+  //! Bind the buffer at the specified index and keep it alive until completion.
+  Standard_EXPORT void SetBuffer(const occ::handle<Metal_ComputeBuffer>& theBuffer, int theIndex);
+
+  //! Register the array to be filled from the buffer on completion;
+  //! no copy is done when the buffer wraps the array memory.
+  template <class T>
+  void ReadBack(const occ::handle<Metal_ComputeBuffer>& theBuffer, NCollection_Array1<T>& theArray)
+  {
+    if (!theArray.IsEmpty())
+    {
+      addReadBack(theBuffer, &theArray.ChangeFirst(), size_t(theArray.Size()) * sizeof(T));
+    }
+  }
+
+  //! End encoding and submit the command buffer.
+  //! @return FALSE if the task has been already committed or cannot be submitted
+  Standard_EXPORT bool Commit();
+
+  //! Return TRUE if the task has been committed and completed (successfully or not).
+  Standard_EXPORT bool IsDone() const;
+
+  //! Wait for completion of the committed task.
+  //! @return TRUE if GPU work has been completed successfully
+  Standard_EXPORT bool Wait();
+
+  //! Return the future becoming ready on completion with the success flag.
+  const std::shared_future<bool>& Future() const { return myFuture; }
+
+private:
+
+  //! Constructor; tasks are created by Metal_ComputeService::NewTask().
+  Metal_ComputeTask();
+
+  //! Register range to copy from the buffer on completion.
+  Standard_EXPORT void addReadBack(const occ::handle<Metal_ComputeBuffer>& theBuffer,
+                                   void* theDst,
+                                   size_t theSize);
+
+  //! Complete the task: copy registered ranges and fulfill the future.
+  void complete(bool theIsSucceeded);
+
+private:
+
+  //! Range of the buffer copied into application memory on completion.
+  struct ReadBackRange
+  {
+    occ::handle<Metal_ComputeBuffer> Buffer;
+    void*                            Dst;
+    size_t                           Size;
+  };
+
+private:
+
+#ifdef __OBJC__
+  id<MTLCommandBuffer> myCmdBuffer;
+#else
+  void*                myCmdBuffer;
+#endif
+  Metal_ComputeEncoder                         myEncoder;   //!< encoder of the command buffer
+  NCollection_List<occ::handle<Metal_ComputeBuffer>> myBuffers; //!< buffers used by the task
+  NCollection_List<ReadBackRange>              myReadBacks; //!< ranges to read back on completion
+  std::promise<bool>                           myPromise;   //!< completion promise
+  std::shared_future<bool>                     myFuture;    //!< completion future
+  bool                                         myIsCommitted;
+};
+
+//! General-purpose asynchronous compute service of Metal_Context for offloading
+//! bulk kernels of modeling algorithms (grid evaluation, BVH traversal, classification)
+//! out of the renderer.
+//!
+//! The service owns a dedicated command queue, so that compute work does not wait for
+//! rendering of frames and vice versa, and creates shared-storage buffers and tasks on it.
+//! For() provides heterogeneous scheduling of a batch: GPU is used for batches large enough
+//! and the CPU path (OSD_Parallel::For) is kept as fallback when GPU is unavailable or fails.
+class Metal_ComputeService : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(Metal_ComputeService, Standard_Transient)
+public:
+
+  //! Create uninitialized service.
+  Standard_EXPORT Metal_ComputeService();
+
+  //! Destructor.
+  Standard_EXPORT ~Metal_ComputeService() override;
+
+  //! Create command queue on the device of the context.
+  //! @return FALSE if queue cannot be created
+  Standard_EXPORT bool Init(Metal_Context* theCtx);
+
+  //! Release command queue; committed tasks are completed.
+  Standard_EXPORT void Release();
+
+  //! Return TRUE if the service has been initialized.
+  Standard_EXPORT bool IsValid() const;
+
+  //! Return minimal number of work items in For() to use GPU; 4096 by default.
+  int MinGpuBatch() const { return myMinGpuBatch; }
+
+  //! Set minimal number of work items in For() to use GPU.
+  void SetMinGpuBatch(int theNbItems) { myMinGpuBatch = theNbItems; }
+
+public: //! @name buffers and tasks
+
+  //! Create uninitialized shared-storage buffer.
+  //! @return NULL handle on failure
+  Standard_EXPORT occ::handle<Metal_ComputeBuffer> NewBuffer(size_t theSize);
+
+  //! Create shared-storage buffer with application data.
+  //! Memory is wrapped without copying on unified memory devices
+  //! when both address and size are multiples of the page size, copied otherwise.
+  //! @return NULL handle on failure
+  Standard_EXPORT occ::handle<Metal_ComputeBuffer> NewBuffer(const void* theData, size_t theSize);
+
+  //! Create shared-storage buffer with array data (wrapped or copied, see above).
+  template <class T>
+  occ::handle<Metal_ComputeBuffer> NewBuffer(const NCollection_Array1<T>& theArray)
+  {
+    return !theArray.IsEmpty() ? NewBuffer(&theArray.First(), size_t(theArray.Size()) * sizeof(T))
+                               : occ::handle<Metal_ComputeBuffer>();
+  }
+
+  //! Create new task with active encoder.
+  //! @return NULL handle on failure
+  Standard_EXPORT occ::handle<Metal_ComputeTask> NewTask(const TCollection_AsciiString& theLabel);
+
+public: //! @name heterogeneous scheduling
+
+  //! Process theNbItems work items on GPU when the batch is large enough,
+  //! or on CPU by OSD_Parallel::For(0, theNbItems, theCpuFunctor) otherwise.
+  //! theGpuEncoder encodes kernels (and read backs) into the task; it may refuse by returning FALSE,
+  //! in which case, as well as on GPU failure, the CPU path is used.
+  //! @return TRUE if the work has been done on GPU
+  template <class Functor>
+  bool For(const int theNbItems,
+           const std::function<bool(Metal_ComputeTask&)>& theGpuEncoder,
+           const Functor& theCpuFunctor)
+  {
+    if (theNbItems >= myMinGpuBatch && IsValid())
+    {
+      occ::handle<Metal_ComputeTask> aTask = NewTask("Metal_ComputeService::For");
+      if (!aTask.IsNull() && theGpuEncoder(*aTask) && aTask->Commit() && aTask->Wait())
+      {
+        return true;
+      }
+    }
+    OSD_Parallel::For(0, theNbItems, theCpuFunctor);
+    return false;
+  }
+
+private:
+
+#ifdef __OBJC__
+  id<MTLCommandQueue> myQueue;
+#else
+  void*               myQueue;
+#endif
+  int                 myMinGpuBatch; //!< minimal batch processed on GPU
+  bool                myHasUnifiedMemory; //!< flag allowing wrapping application memory
+};
+
+#endif // Metal_ComputeService_HeaderFile
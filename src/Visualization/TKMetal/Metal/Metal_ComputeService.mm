@@ -0,0 +1,329 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#import <Metal/Metal.h>
+
+#include <Metal_ComputeService.hxx>
+#include <Metal_Context.hxx>
+#include <Metal_PageAllocator.hxx>
+#include <Message.hxx>
+
+#include <algorithm>
+#include <cstring>
+
+IMPLEMENT_STANDARD_RTTIEXT(Metal_ComputeBuffer, Standard_Transient)
+IMPLEMENT_STANDARD_RTTIEXT(Metal_ComputeTask, Standard_Transient)
+IMPLEMENT_STANDARD_RTTIEXT(Metal_ComputeService, Standard_Transient)
+
+// =======================================================================
+// function : ~Metal_ComputeBuffer
+// purpose  :
+// =======================================================================
+Metal_ComputeBuffer::~Metal_ComputeBuffer()
+{
+  myBuffer = nil;
+}
+
+// =======================================================================
+// function : Contents
+// purpose  :
+// =======================================================================
+void* Metal_ComputeBuffer::Contents() const
+{
+  return myBuffer != nil ? [myBuffer contents] : nullptr;
+}
+
+// =======================================================================
+// function : Metal_ComputeTask
+// purpose  :
+// =======================================================================
+Metal_ComputeTask::Metal_ComputeTask()
+: myCmdBuffer(nil),
+  myFuture(myPromise.get_future().share()),
+  myIsCommitted(false)
+{
+}
+
+// =======================================================================
+// function : ~Metal_ComputeTask
+// purpose  :
+// =======================================================================
+Metal_ComputeTask::~Metal_ComputeTask()
+{
+  if (!myIsCommitted)
+  {
+    // encoding should be finished before the command buffer is discarded
+    myEncoder.End();
+    myPromise.set_value(false);
+  }
+  myCmdBuffer = nil;
+}
+
+// =======================================================================
+// function : SetBuffer
+// purpose  :
+// =======================================================================
+void Metal_ComputeTask::SetBuffer(const occ::handle<Metal_ComputeBuffer>& theBuffer, int theIndex)
+{
+  if (theBuffer.IsNull() || myIsCommitted)
+  {
+    return;
+  }
+
+  myEncoder.SetBuffer(theBuffer->Buffer(), 0, theIndex);
+  myBuffers.Append(theBuffer);
+}
+
+// =======================================================================
+// function : addReadBack
+// purpose  :
+// =======================================================================
+void Metal_ComputeTask::addReadBack(const occ::handle<Metal_ComputeBuffer>& theBuffer,
+                                    void* theDst,
+                                    size_t theSize)
+{
+  if (theBuffer.IsNull() || theDst == nullptr || myIsCommitted
+   || (theBuffer->IsWrapped() && theBuffer->Contents() == theDst))
+  {
+    return;
+  }
+
+  ReadBackRange aRange;
+  aRange.Buffer = theBuffer;
+  aRange.Dst    = theDst;
+  aRange.Size   = std::min(theSize, theBuffer->Size());
+  myReadBacks.Append(aRange);
+}
+
+// =======================================================================
+// function : Commit
+// purpose  : Submit the command buffer without waiting
+// =======================================================================
+bool Metal_ComputeTask::Commit()
+{
+  if (myIsCommitted || myCmdBuffer == nil)
+  {
+    return false;
+  }
+
+  myEncoder.End();
+  myIsCommitted = true;
+
+  // the task is kept alive by the handler until completion
+  occ::handle<Metal_ComputeTask> aSelf = this;
+  [myCmdBuffer addCompletedHandler:^(id<MTLCommandBuffer> theBuffer)
+  {
+    aSelf->complete(theBuffer.status == MTLCommandBufferStatusCompleted);
+  }];
+  [myCmdBuffer commit];
+  return true;
+}
+
+// =======================================================================
+// function : complete
+// purpose  : Copy read back ranges and fulfill the future
+// =======================================================================
+void Metal_ComputeTask::complete(bool theIsSucceeded)
+{
+  if (theIsSucceeded)
+  {
+    for (NCollection_List<ReadBackRange>::Iterator aRangeIter(myReadBacks); aRangeIter.More(); aRangeIter.Next())
+    {
+      const ReadBackRange& aRange = aRangeIter.Value();
+      std::memcpy(aRange.Dst, aRange.Buffer->Contents(), aRange.Size);
+    }
+  }
+  myReadBacks.Clear();
+  myBuffers.Clear();
+  myPromise.set_value(theIsSucceeded);
+}
+
+// =======================================================================
+// function : IsDone
+// purpose  :
+// =======================================================================
+bool Metal_ComputeTask::IsDone() const
+{
+  return myIsCommitted
+      && myFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+// =======================================================================
+// function : Wait
+// purpose  :
+// =======================================================================
+bool Metal_ComputeTask::Wait()
+{
+  return myIsCommitted && myFuture.get();
+}
+
+// =======================================================================
+// function : Metal_ComputeService
+// purpose  :
+// =======================================================================
+Metal_ComputeService::Metal_ComputeService()
+: myQueue(nil),
+  myMinGpuBatch(4096),
+  myHasUnifiedMemory(false)
+{
+}
+
+// =======================================================================
+// function : ~Metal_ComputeService
+// purpose  :
+// =======================================================================
+Metal_ComputeService::~Metal_ComputeService()
+{
+  Release();
+}
+
+// =======================================================================
+// function : Init
+// purpose  :
+// =======================================================================
+bool Metal_ComputeService::Init(Metal_Context* theCtx)
+{
+  Release();
+  if (theCtx == nullptr || theCtx->Device() == nil)
+  {
+    return false;
+  }
+
+  myQueue = [theCtx->Device() newCommandQueue];
+  if (myQueue == nil)
+  {
+    Message::SendFail() << "Metal_ComputeService: unable to create command queue";
+    return false;
+  }
+  myQueue.label = @"OCCT Compute";
+  myHasUnifiedMemory = theCtx->Device().hasUnifiedMemory;
+  return true;
+}
+
+// =======================================================================
+// function : Release
+// purpose  :
+// =======================================================================
+void Metal_ComputeService::Release()
+{
+  // the queue is retained by committed command buffers until their completion
+  myQueue = nil;
+  myHasUnifiedMemory = false;
+}
+
+// =======================================================================
+// function : IsValid
+// purpose  :
+// =======================================================================
+bool Metal_ComputeService::IsValid() const
+{
+  return myQueue != nil;
+}
+
+// =======================================================================
+// function : NewBuffer
+// purpose  :
+// =======================================================================
+occ::handle<Metal_ComputeBuffer> Metal_ComputeService::NewBuffer(size_t theSize)
+{
+  if (myQueue == nil || theSize == 0)
+  {
+    return occ::handle<Metal_ComputeBuffer>();
+  }
+
+  id<MTLBuffer> aBuffer = [myQueue.device newBufferWithLength:theSize options:MTLResourceStorageModeShared];
+  if (aBuffer == nil)
+  {
+    return occ::handle<Metal_ComputeBuffer>();
+  }
+
+  occ::handle<Metal_ComputeBuffer> aResult = new Metal_ComputeBuffer();
+  aResult->myBuffer = aBuffer;
+  aResult->mySize = theSize;
+  return aResult;
+}
+
+// =======================================================================
+// function : NewBuffer
+// purpose  : Wrap page-aligned memory or copy data
+// =======================================================================
+occ::handle<Metal_ComputeBuffer> Metal_ComputeService::NewBuffer(const void* theData, size_t theSize)
+{
+  if (myQueue == nil || theData == nullptr || theSize == 0)
+  {
+    return occ::handle<Metal_ComputeBuffer>();
+  }
+
+  const size_t aPage = Metal_PageAllocator::PageSize();
+  if (myHasUnifiedMemory
+   && (reinterpret_cast<uintptr_t>(theData) % aPage) == 0
+   && (theSize % aPage) == 0)
+  {
+    id<MTLBuffer> aBuffer = [myQueue.device newBufferWithBytesNoCopy:const_cast<void*>(theData)
+                                                              length:theSize
+                                                             options:MTLResourceStorageModeShared
+                                                         deallocator:nil];
+    if (aBuffer != nil)
+    {
+      occ::handle<Metal_ComputeBuffer> aResult = new Metal_ComputeBuffer();
+      aResult->myBuffer = aBuffer;
+      aResult->mySize = theSize;
+      aResult->myIsWrapped = true;
+      return aResult;
+    }
+  }
+
+  id<MTLBuffer> aBuffer = [myQueue.device newBufferWithBytes:theData
+                                                      length:theSize
+                                                     options:MTLResourceStorageModeShared];
+  if (aBuffer == nil)
+  {
+    return occ::handle<Metal_ComputeBuffer>();
+  }
+
+  occ::handle<Metal_ComputeBuffer> aResult = new Metal_ComputeBuffer();
+  aResult->myBuffer = aBuffer;
+  aResult->mySize = theSize;
+  return aResult;
+}
+
+// =======================================================================
+// function : NewTask
+// purpose  :
+// =======================================================================
+occ::handle<Metal_ComputeTask> Metal_ComputeService::NewTask(const TCollection_AsciiString& theLabel)
+{
+  if (myQueue == nil)
+  {
+    return occ::handle<Metal_ComputeTask>();
+  }
+
+  id<MTLCommandBuffer> aCmdBuffer = [myQueue commandBuffer];
+  if (aCmdBuffer == nil)
+  {
+    return occ::handle<Metal_ComputeTask>();
+  }
+  aCmdBuffer.label = [NSString stringWithUTF8String:theLabel.ToCString()];
+
+  occ::handle<Metal_ComputeTask> aTask = new Metal_ComputeTask();
+  aTask->myCmdBuffer = aCmdBuffer;
+  if (!aTask->myEncoder.Begin(aCmdBuffer))
+  {
+    // nothing has been encoded, the command buffer is simply discarded
+    aTask->myIsCommitted = true;
+    aTask->myPromise.set_value(false);
+    return occ::handle<Metal_ComputeTask>();
+  }
+  return aTask;
+}
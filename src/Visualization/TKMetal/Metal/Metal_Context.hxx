@@ -17,29 +17,47 @@
 #include <Aspect_GraphicsLibrary.hxx>
 #include <Graphic3d_Camera.hxx>
 #include <Graphic3d_DiagnosticInfo.hxx>
+#include <Image_SupportedFormats.hxx>
+#include <Metal_BindlessTable.hxx>
+#include <Metal_BufferAllocator.hxx>
 #include <Metal_Caps.hxx>
+#include <Metal_ComputeService.hxx>
+#include <Metal_GpuTimer.hxx>
 #include <Metal_Resource.hxx>
+#include <Metal_ResidencyManager.hxx>
+#include <Metal_StagingRing.hxx>
+#include <Metal_TessellationController.hxx>
+#include <Metal_TransformBuffer.hxx>
+#include <Metal_UniformRing.hxx>
 #include <Message.hxx>
 #include <NCollection_DataMap.hxx>
 #include <NCollection_IndexedDataMap.hxx>
 #include <NCollection_List.hxx>
 #include <NCollection_Mat4.hxx>
+#include <NCollection_Sequence.hxx>
 #include <NCollection_Shared.hxx>
 #include <Standard_Transient.hxx>
 #include <TCollection_AsciiString.hxx>
 #include <TCollection_ExtendedString.hxx>
 #include <TColStd_PackedMapOfInteger.hxx>
 
+#include <atomic>
+#include <mutex>
+
 #ifdef __OBJC__
 #import <dispatch/dispatch.h>
 @protocol MTLDevice;
 @protocol MTLCommandQueue;
 @protocol MTLCommandBuffer;
 @protocol MTLRenderCommandEncoder;
+@protocol MTLSharedEvent;
 @protocol MTLLibrary;
 @protocol MTLRenderPipelineState;
 @protocol MTLDepthStencilState;
 @protocol MTLFunction;
+@class MTLCompileOptions;
+@class NSError;
+@class NSString;
 #endif
 
 class Metal_Window;
@@ -81,6 +99,21 @@ enum Metal_DebugSeverity
   Metal_DebugSeverity_Notification = 3  //!< Notification (verbose)
 };
 
+//! Description of Metal device available in the system.
+struct Metal_DeviceInfo
+{
+  TCollection_AsciiString Name;             //!< device name
+  uint64_t                RegistryId;       //!< registry ID identifying device (see Metal_Caps::deviceRegistryId)
+  size_t                  WorkingSetSize;   //!< recommended maximum working set size in bytes
+  bool                    IsLowPower;       //!< integrated (low-power) GPU
+  bool                    IsHeadless;       //!< GPU without attached displays
+  bool                    IsRemovable;      //!< external GPU
+  bool                    HasUnifiedMemory; //!< memory is shared with CPU
+
+  Metal_DeviceInfo()
+  : RegistryId(0), WorkingSetSize(0), IsLowPower(false), IsHeadless(false), IsRemovable(false), HasUnifiedMemory(false) {}
+};
+
 //! This class manages the Metal context including device, command queue,
 //! and shared resources. It is the central hub for all Metal operations.
 class Metal_Context : public Standard_Transient
@@ -110,10 +143,14 @@ public:
   Standard_EXPORT void Share(const occ::handle<Metal_Context>& theShareCtx);
 
   //! Initialize the Metal context.
+  //! Device is selected by Metal_Caps::deviceRegistryId when defined, or by power preference otherwise.
   //! @param thePreferLowPower prefer integrated GPU over discrete
   //! @return false if Metal is not available
   Standard_EXPORT bool Init(bool thePreferLowPower = false);
 
+  //! Fill in the list of Metal devices available in the system.
+  Standard_EXPORT static void EnumerateDevices(NCollection_Sequence<Metal_DeviceInfo>& theDevices);
+
   //! @return true if this context is valid (has been initialized)
   bool IsValid() const { return myIsInitialized; }
 
@@ -141,6 +178,26 @@ public: //! @name Device and command queue access
   //! Return the Metal command queue.
   id<MTLCommandQueue> CommandQueue() const { return myCommandQueue; }
 
+  //! Return command queue dedicated to transfers (uploads into new resources and acceleration
+  //! structure builds), executed concurrently with rendering; the same as CommandQueue()
+  //! when disabled by Metal_Caps::useTransferQueue.
+  id<MTLCommandQueue> TransferQueue() const
+  {
+    return myTransferQueue != nil ? myTransferQueue : myCommandQueue;
+  }
+
+  //! Return shared event signaled by completed transfers (see CommitTransfer()), or nil.
+  id<MTLSharedEvent> TransferEvent() const { return myTransferEvent; }
+
+  //! Create a new command buffer on TransferQueue().
+  Standard_EXPORT id<MTLCommandBuffer> CreateTransferCommandBuffer();
+
+  //! Commit command buffer created by CreateTransferCommandBuffer(),
+  //! which signals TransferEvent() with a new value on completion.
+  //! @return value to pass to WaitTransfer() or IsTransferCompleted(),
+  //!         0 when transfers are executed by CommandQueue() in submission order
+  Standard_EXPORT uint64_t CommitTransfer(id<MTLCommandBuffer> theCmdBuffer);
+
   //! Return the default shader library.
   id<MTLLibrary> DefaultLibrary() const { return myDefaultLibrary; }
 
@@ -155,7 +212,18 @@ public: //! @name Device and command queue access
 
   //! Commit the current command buffer (non-blocking).
   Standard_EXPORT void Commit();
+#endif
+
+  //! Return TRUE if the transfer returned by CommitTransfer() has been completed by GPU (non-blocking).
+  Standard_EXPORT bool IsTransferCompleted(uint64_t theTransfer) const;
+
+  //! Make command buffers committed to CommandQueue() after this call wait on GPU for the transfer
+  //! returned by CommitTransfer(); nothing is submitted when the transfer has been already waited
+  //! or completed, so that rendering waits only for the data it actually needs.
+  //! Thread-safe.
+  Standard_EXPORT void WaitTransfer(uint64_t theTransfer);
 
+#ifdef __OBJC__
   //! Return default render pipeline state.
   id<MTLRenderPipelineState> DefaultPipeline() const { return myDefaultPipeline; }
 
@@ -182,13 +250,35 @@ public: //! @name Device and command queue access
 
   //! Initialize default shaders and pipeline.
   Standard_EXPORT bool InitDefaultShaders();
+
+  //! Return shader library for the embedded shader source.
+  //! When Metal_Caps::useOfflineShaders is ON, precompiled library <theName>.metallib
+  //! is loaded from ShadersDirectory(); otherwise (or when it is missing) the source is compiled.
+  //! Libraries are cached by name within the context.
+  //! @param theName    library name, <source file name>_<source variable name> for embedded sources
+  //! @param theSource  shader source to compile when precompiled library is unavailable
+  //! @param theOptions compilation options (nil for defaults)
+  //! @param theError   optional compilation error output
+  //! @return shader library or nil on failure
+  Standard_EXPORT id<MTLLibrary> LoadShaderLibrary(const TCollection_AsciiString& theName,
+                                                   NSString* theSource,
+                                                   MTLCompileOptions* theOptions = nil,
+                                                   NSError** theError = nullptr);
 #endif
 
+  //! Return folder with precompiled shader libraries (*.metallib).
+  //! Defined by CSF_MetalShadersDirectory environment variable,
+  //! or the folder containing TKMetal library otherwise.
+  Standard_EXPORT static const TCollection_AsciiString& ShadersDirectory();
+
 public: //! @name Device capabilities
 
   //! Return device name.
   const TCollection_AsciiString& DeviceName() const { return myDeviceName; }
 
+  //! Return registry ID of the device.
+  uint64_t DeviceRegistryId() const { return myDeviceRegistryId; }
+
   //! Return maximum texture dimension.
   int MaxTextureSize() const { return myMaxTexDim; }
 
@@ -207,9 +297,37 @@ public: //! @name Device capabilities
   //! Return true if device supports ray tracing.
   bool HasRayTracing() const { return myHasRayTracing; }
 
+  //! Return true if device supports indirect command buffers for render commands.
+  bool HasIndirectCommandBuffers() const { return myHasIndirectCommandBuffers; }
+
+  //! Return true if device shares memory with CPU (Apple silicon, iOS).
+  bool HasUnifiedMemory() const { return myHasUnifiedMemory; }
+
+  //! Return true if device supports memoryless render targets kept in tile memory (Apple GPUs).
+  bool HasMemorylessRenderTargets() const { return myHasMemorylessTargets; }
+
+  //! Return true if device supports object and mesh shaders (Metal 3 GPU family).
+  bool HasMeshShaders() const { return myHasMeshShaders; }
+
+  //! Return true if device supports tile shaders, explicit imageblocks and raster order groups (Apple4 GPU family).
+  bool HasTileShaders() const { return myHasTileShaders; }
+
+  //! Return true if MetalFX spatial and temporal scalers are supported by device (weakly linked MetalFX framework).
+  bool HasMetalFX() const { return myHasMetalFX; }
+
+  //! Return true if device supports rasterization rate maps with two layers (one per eye).
+  bool HasRasterizationRateMaps() const { return myHasRateMaps; }
+
+  //! Return true if device supports vertex amplification into two views (single-pass stereo).
+  bool HasVertexAmplification() const { return myHasVertexAmplification; }
+
   //! Check if specific pixel format is supported.
   Standard_EXPORT bool IsFormatSupported(int thePixelFormat) const;
 
+  //! Return list of image formats accepted by Metal_Texture, including block-compressed formats
+  //! sampled natively by the device (BC on Intel/AMD Macs and Apple silicon Macs, ASTC on Apple GPUs).
+  const occ::handle<Image_SupportedFormats>& SupportedTextureFormats() const { return mySupportedFormats; }
+
 public: //! @name Shared resources
 
   //! Access shared resource by its name.
@@ -260,17 +378,86 @@ public: //! @name Shared resources
   //! Return map of shared resources.
   const Metal_ResourcesMap& SharedResources() const { return *mySharedResources; }
 
+  //! Return sub-allocator of vertex, index and uniform buffers (shared between shared contexts).
+  const occ::handle<Metal_BufferAllocator>& BufferAllocator() const { return myBufferAllocator; }
+
+  //! Return GPU memory residency manager (shared between shared contexts);
+  //! NULL if disabled by Metal_Caps::useResidencyManager.
+  const occ::handle<Metal_ResidencyManager>& ResidencyManager() const { return myResidencyMgr; }
+
+  //! Return staging ring for uploads into private buffers; flushed on Commit().
+  const occ::handle<Metal_StagingRing>& StagingRing() const { return myStagingRing; }
+
+  //! Return bindless materials and textures table;
+  //! NULL if argument buffers are disabled or unsupported (see Metal_BindlessTable::IsSupported()).
+  const occ::handle<Metal_BindlessTable>& BindlessTable() const { return myBindlessTable; }
+
+  //! Return GPU timer of render and compute passes.
+  const occ::handle<Metal_GpuTimer>& GpuTimer() const { return myGpuTimer; }
+
+  //! Return per-frame allocator of uniform blocks; slot of the frame is reset by WaitForFrame().
+  const occ::handle<Metal_UniformRing>& UniformRing() const { return myUniformRing; }
+
+  //! Return GPU buffer of structure transformations (shared between shared contexts);
+  //! frame slot is updated by WaitForFrame().
+  const occ::handle<Metal_TransformBuffer>& TransformBuffer() const { return myTransformBuffer; }
+
+  //! Return tessellation controller drawing Metal_BSplineSurface, created on first use.
+  Standard_EXPORT const occ::handle<Metal_TessellationController>& TessellationController();
+
+  //! Return service submitting compute kernels to a dedicated command queue,
+  //! so that bulk computations do not stall the rendering queue; created on first use.
+  Standard_EXPORT const occ::handle<Metal_ComputeService>& ComputeService();
+
 public: //! @name Frame management for triple-buffering
 
   //! Return current frame index (0 to MaxFramesInFlight-1).
   int CurrentFrameIndex() const { return myCurrentFrameIndex; }
 
-  //! Advance to next frame. Should be called at end of frame.
+  //! Return the number of frames advanced since context creation;
+  //! resources last used by frame N can be overwritten by CPU once FrameNumber() exceeds N + maxFramesInFlight.
+  uint64_t FrameNumber() const { return myFrameNumber; }
+
+  //! Advance to next frame. Called by Commit() at end of frame.
   Standard_EXPORT void AdvanceFrame();
 
-  //! Wait for frame to become available (blocks until GPU finishes).
+  //! Wait for frame to become available (blocks until GPU finishes)
+  //! and start new frame of the uniform ring.
   Standard_EXPORT void WaitForFrame();
 
+  //! Return the number of frames allowed to be in flight by the next WaitForFrame();
+  //! 0 means Metal_Caps::maxFramesInFlight.
+  int FramesInFlightLimit() const { return myFramesInFlightLimit; }
+
+  //! Limit the number of frames in flight below Metal_Caps::maxFramesInFlight (low-latency frame pacing).
+  //! The limit is applied by the next WaitForFrame() by holding spare slots of the frame semaphore,
+  //! so that per-frame resources keep rotating through all maxFramesInFlight slots.
+  //! @param theLimit number of frames in range [1, maxFramesInFlight], or 0 to remove the limit
+  void SetFramesInFlightLimit(int theLimit) { myFramesInFlightLimit = theLimit; }
+
+  //! Return GPU execution time of the last completed command buffer in seconds,
+  //! or 0 if not measured.
+  double LastGpuFrameTime() const { return myLastGpuFrameTime.load(std::memory_order_relaxed); }
+
+public: //! @name GPU capture
+
+  //! Start capturing commands of the context queue into GPU trace document,
+  //! which can be opened by Xcode to inspect the frame offline.
+  //! Capture is stopped by EndCapture() or after Commit() of theNbFrames frames;
+  //! both should be called between frames (e.g. before redrawing the view).
+  //! Outside of Xcode the application should be launched with MTL_CAPTURE_ENABLED=1 environment variable
+  //! (or MetalCaptureEnabled key within Info.plist), otherwise documents cannot be written.
+  //! @param[in] theFilePath path to *.gputrace document to write (should not exist)
+  //! @param[in] theNbFrames number of frames to capture; 0 means capturing until EndCapture()
+  //! @return FALSE if capture cannot be started
+  Standard_EXPORT bool BeginCapture(const TCollection_AsciiString& theFilePath, int theNbFrames = 1);
+
+  //! Stop capture started by BeginCapture() and write the document.
+  Standard_EXPORT void EndCapture();
+
+  //! Return TRUE if capture started by BeginCapture() is in progress.
+  bool IsCapturing() const { return myNbCaptureFrames >= 0; }
+
 public: //! @name Render state management
 
   //! Return current depth compare function.
@@ -436,6 +623,8 @@ private:
 #ifdef __OBJC__
   id<MTLDevice>              myDevice;                   //!< Metal device
   id<MTLCommandQueue>        myCommandQueue;             //!< Command queue
+  id<MTLCommandQueue>        myTransferQueue;            //!< Command queue for transfers (Metal_Caps::useTransferQueue)
+  id<MTLSharedEvent>         myTransferEvent;            //!< Event signaled by completed transfers
   id<MTLLibrary>             myDefaultLibrary;           //!< Default shader library
   id<MTLCommandBuffer>       myCurrentCmdBuffer;         //!< Current command buffer
   id<MTLRenderPipelineState> myDefaultPipeline;          //!< Default render pipeline
@@ -447,9 +636,13 @@ private:
   id<MTLDepthStencilState>   myDefaultDepthStencilState;     //!< Default depth-stencil state
   id<MTLDepthStencilState>   myTransparentDepthStencilState; //!< Depth-stencil for transparent objects
   dispatch_semaphore_t       myFrameSemaphore;           //!< Semaphore for triple-buffering
+  id<MTLCaptureScope>        myCaptureScope;             //!< Frame capture scope (Metal_Caps::enableGPUCapture)
+  NCollection_DataMap<TCollection_AsciiString, id<MTLLibrary>> myShaderLibraries; //!< Loaded shader libraries
 #else
   void*                myDevice;
   void*                myCommandQueue;
+  void*                myTransferQueue;
+  void*                myTransferEvent;
   void*                myDefaultLibrary;
   void*                myCurrentCmdBuffer;
   void*                myDefaultPipeline;
@@ -461,22 +654,53 @@ private:
   void*                myDefaultDepthStencilState;
   void*                myTransparentDepthStencilState;
   void*                myFrameSemaphore;
+  void*                myCaptureScope;
+  NCollection_DataMap<TCollection_AsciiString, void*> myShaderLibraries;
 #endif
 
   occ::handle<Metal_Caps>      myCaps;            //!< Capabilities configuration
   occ::handle<Message_Messenger> myMsgContext;   //!< Messenger for logging
   occ::handle<Metal_ResourcesMap> mySharedResources; //!< Shared resources map
   occ::handle<Metal_ResourcesList> myUnusedResources; //!< Delayed release queue
+  occ::handle<Image_SupportedFormats> mySupportedFormats; //!< Supported texture formats
+  occ::handle<Metal_BufferAllocator> myBufferAllocator; //!< Buffers sub-allocator
+  occ::handle<Metal_StagingRing> myStagingRing;  //!< Staging ring for private buffers uploads
+  occ::handle<Metal_ResidencyManager> myResidencyMgr; //!< GPU memory residency manager
+  occ::handle<Metal_BindlessTable> myBindlessTable; //!< Bindless materials and textures table
+  occ::handle<Metal_GpuTimer> myGpuTimer;        //!< GPU passes timer
+  occ::handle<Metal_UniformRing> myUniformRing;  //!< per-frame uniform blocks allocator
+  occ::handle<Metal_TransformBuffer> myTransformBuffer; //!< structure transformations
+  occ::handle<Metal_TessellationController> myTessController; //!< tessellation of B-spline surfaces
+  occ::handle<Metal_ComputeService> myComputeService; //!< asynchronous compute queue
 
   TCollection_AsciiString myDeviceName;           //!< Device name
+  uint64_t                myDeviceRegistryId;     //!< Device registry ID
   int                     myMaxTexDim;            //!< Max texture dimension
   size_t                  myMaxBufferLength;      //!< Max buffer size
   int                     myMaxColorAttachments;  //!< Max color attachments
   int                     myMaxMsaaSamples;       //!< Max MSAA samples
   bool                    myHasArgumentBuffersTier2; //!< Argument buffers tier 2 support
   bool                    myHasRayTracing;        //!< Ray tracing support
+  bool                    myHasIndirectCommandBuffers; //!< Render indirect command buffers support
+  bool                    myHasUnifiedMemory;     //!< Unified memory architecture
+  bool                    myHasMemorylessTargets; //!< Memoryless render targets support
+  bool                    myHasMeshShaders;       //!< Object and mesh shaders support
+  bool                    myHasTileShaders;       //!< Tile shaders and imageblocks support
+  bool                    myHasMetalFX;           //!< MetalFX scalers support
+  bool                    myHasRateMaps;          //!< Rasterization rate maps support
+  bool                    myHasVertexAmplification; //!< Vertex amplification support
   bool                    myIsInitialized;        //!< Initialization flag
   int                     myCurrentFrameIndex;    //!< Current frame for triple-buffering
+  uint64_t                myFrameNumber;          //!< Number of advanced frames
+  int                     myFramesInFlightLimit;  //!< Frames in flight limit of low-latency pacing (0 - no limit)
+  int                     myNbHeldFrameSlots;     //!< Frame semaphore slots held to apply the limit
+  std::atomic<double>     myLastGpuFrameTime;     //!< GPU time of the last completed command buffer
+  std::atomic<uint64_t>   myTransferValue;        //!< last value of TransferEvent() signaled by committed transfers
+  std::atomic<uint64_t>   myTransferWaited;       //!< last value of TransferEvent() waited by CommandQueue()
+  std::mutex              myTransferMutex;        //!< lock for committing transfers from several threads
+  TCollection_AsciiString myCapturePath;          //!< GPU trace document being captured
+  int                     myNbCaptureFrames;      //!< frames left to capture (0 - until EndCapture(), -1 - none)
+  bool                    myIsCaptureScopeOpen;   //!< frame capture scope has been begun by WaitForFrame()
 
   // Render state
   int                     myDepthFunc;            //!< Current depth compare function
@@ -14,20 +14,51 @@
 // Import Apple frameworks first to avoid Handle name conflicts with Carbon
 #import <TargetConditionals.h>
 #import <Metal/Metal.h>
+#import <MetalFX/MetalFX.h>
 #import <dispatch/dispatch.h>
 
 // Now include OCCT headers
 #include <Metal_Context.hxx>
+#include <Metal_FrameStats.hxx>
 #include <Metal_ShaderManager.hxx>
+#include <Metal_Texture.hxx>
 #include <Message.hxx>
+#include <OSD_Environment.hxx>
 #include <Standard_Assert.hxx>
 
+#include <dlfcn.h>
+
 IMPLEMENT_STANDARD_RTTIEXT(Metal_Context, Standard_Transient)
 
 namespace
 {
   //! Null handle for returning from GetResource.
   static const occ::handle<Metal_Resource> THE_NULL_RESOURCE;
+
+  //! Find folder with precompiled shader libraries.
+  static TCollection_AsciiString findShadersDirectory()
+  {
+    TCollection_AsciiString aDir = OSD_Environment("CSF_MetalShadersDirectory").Value();
+    if (!aDir.IsEmpty())
+    {
+      return aDir;
+    }
+
+    // precompiled libraries are placed next to TKMetal binary
+    Dl_info anInfo;
+    if (dladdr((const void*)&findShadersDirectory, &anInfo) != 0
+     && anInfo.dli_fname != nullptr)
+    {
+      aDir = anInfo.dli_fname;
+      const int aSepPos = aDir.SearchFromEnd("/");
+      if (aSepPos > 1)
+      {
+        aDir.Trunc(aSepPos - 1);
+        return aDir;
+      }
+    }
+    return TCollection_AsciiString();
+  }
 }
 
 // =======================================================================
@@ -37,6 +68,8 @@ namespace
 Metal_Context::Metal_Context(const occ::handle<Metal_Caps>& theCaps)
 : myDevice(nil),
   myCommandQueue(nil),
+  myTransferQueue(nil),
+  myTransferEvent(nil),
   myDefaultLibrary(nil),
   myCurrentCmdBuffer(nil),
   myDefaultPipeline(nil),
@@ -48,18 +81,37 @@ Metal_Context::Metal_Context(const occ::handle<Metal_Caps>& theCaps)
   myDefaultDepthStencilState(nil),
   myTransparentDepthStencilState(nil),
   myFrameSemaphore(nil),
+  myCaptureScope(nil),
   myCaps(theCaps),
   myMsgContext(Message::DefaultMessenger()),
   mySharedResources(new Metal_ResourcesMap()),
   myUnusedResources(new Metal_ResourcesList()),
+  mySupportedFormats(new Image_SupportedFormats()),
+  myDeviceRegistryId(0),
   myMaxTexDim(4096),
   myMaxBufferLength(256 * 1024 * 1024),
   myMaxColorAttachments(8),
   myMaxMsaaSamples(8),
   myHasArgumentBuffersTier2(false),
   myHasRayTracing(false),
+  myHasIndirectCommandBuffers(false),
+  myHasUnifiedMemory(false),
+  myHasMemorylessTargets(false),
+  myHasMeshShaders(false),
+  myHasTileShaders(false),
+  myHasMetalFX(false),
+  myHasRateMaps(false),
+  myHasVertexAmplification(false),
   myIsInitialized(false),
   myCurrentFrameIndex(0),
+  myFrameNumber(0),
+  myFramesInFlightLimit(0),
+  myNbHeldFrameSlots(0),
+  myLastGpuFrameTime(0.0),
+  myTransferValue(0),
+  myTransferWaited(0),
+  myNbCaptureFrames(-1),
+  myIsCaptureScopeOpen(false),
   myDepthFunc(MTLCompareFunctionLess),
   myDepthMask(true),
   myBlendEnabled(false),
@@ -120,10 +172,28 @@ void Metal_Context::forcedRelease()
   ReleaseDelayed();
 
   // Release Metal objects
+  if (IsCapturing())
+  {
+    EndCapture();
+  }
+  if (myCaptureScope != nil)
+  {
+    if (myIsCaptureScopeOpen)
+    {
+      [myCaptureScope endScope];
+      myIsCaptureScopeOpen = false;
+    }
+    MTLCaptureManager* aCaptureMgr = [MTLCaptureManager sharedCaptureManager];
+    if (aCaptureMgr.defaultCaptureScope == myCaptureScope)
+    {
+      aCaptureMgr.defaultCaptureScope = nil;
+    }
+    myCaptureScope = nil;
+  }
   if (myFrameSemaphore != nil)
   {
-    // Wait for all frames to complete
-    for (int i = 0; i < myCaps->maxFramesInFlight; ++i)
+    // Wait for all frames to complete (slots held by frames in flight limit are already acquired)
+    for (int i = myNbHeldFrameSlots; i < myCaps->maxFramesInFlight; ++i)
     {
       dispatch_semaphore_wait(myFrameSemaphore, DISPATCH_TIME_FOREVER);
     }
@@ -132,10 +202,65 @@ void Metal_Context::forcedRelease()
     {
       dispatch_semaphore_signal(myFrameSemaphore);
     }
+    myNbHeldFrameSlots = 0;
     myFrameSemaphore = nil;
   }
 
   myCurrentCmdBuffer = nil;
+  if (!myTessController.IsNull())
+  {
+    myTessController->Release();
+    myTessController.Nullify();
+  }
+  if (!myComputeService.IsNull())
+  {
+    myComputeService->Release();
+    myComputeService.Nullify();
+  }
+  if (!myGpuTimer.IsNull())
+  {
+    myGpuTimer->Release();
+    myGpuTimer.Nullify();
+  }
+  if (!myBindlessTable.IsNull())
+  {
+    myBindlessTable->Release(this);
+    myBindlessTable.Nullify();
+  }
+  if (!myStagingRing.IsNull())
+  {
+    myStagingRing->Release();
+    myStagingRing.Nullify();
+  }
+  if (!myResidencyMgr.IsNull())
+  {
+    // keep tracking while other contexts still share the manager
+    if (myResidencyMgr->GetRefCount() == 1)
+    {
+      myResidencyMgr->Release();
+    }
+    myResidencyMgr.Nullify();
+  }
+  if (!myUniformRing.IsNull())
+  {
+    myUniformRing->Release();
+    myUniformRing.Nullify();
+  }
+  if (!myTransformBuffer.IsNull())
+  {
+    // structures keep their slots, so that buffers are re-initialized by another context sharing them
+    myTransformBuffer->Release();
+    myTransformBuffer.Nullify();
+  }
+  if (!myBufferAllocator.IsNull())
+  {
+    // keep blocks alive while other contexts still share them
+    if (myBufferAllocator->GetRefCount() == 1)
+    {
+      myBufferAllocator->Release();
+    }
+    myBufferAllocator.Nullify();
+  }
   myDefaultPipeline = nil;
   myLinePipeline = nil;
   myWireframePipeline = nil;
@@ -144,7 +269,10 @@ void Metal_Context::forcedRelease()
   myTexturedBackgroundPipeline = nil;
   myDefaultDepthStencilState = nil;
   myTransparentDepthStencilState = nil;
+  myShaderLibraries.Clear();
   myDefaultLibrary = nil;
+  myTransferQueue = nil;
+  myTransferEvent = nil;
   myCommandQueue = nil;
   myDevice = nil;
 
@@ -164,6 +292,18 @@ void Metal_Context::Share(const occ::handle<Metal_Context>& theShareCtx)
   if (!theShareCtx.IsNull())
   {
     mySharedResources = theShareCtx->mySharedResources;
+    if (!theShareCtx->myBufferAllocator.IsNull())
+    {
+      myBufferAllocator = theShareCtx->myBufferAllocator;
+    }
+    if (!theShareCtx->myResidencyMgr.IsNull())
+    {
+      myResidencyMgr = theShareCtx->myResidencyMgr;
+    }
+    if (!theShareCtx->myTransformBuffer.IsNull())
+    {
+      myTransformBuffer = theShareCtx->myTransformBuffer;
+    }
   }
 }
 
@@ -188,9 +328,28 @@ bool Metal_Context::Init(bool thePreferLowPower)
       return false;
     }
 
-    // Select device based on preference
+    // Select device explicitly requested by registry ID
     myDevice = nil;
-    if (thePreferLowPower || myCaps->preferLowPowerGPU)
+    if (myCaps->deviceRegistryId != 0)
+    {
+      for (id<MTLDevice> aDevice in devices)
+      {
+        if (aDevice.registryID == myCaps->deviceRegistryId)
+        {
+          myDevice = aDevice;
+          break;
+        }
+      }
+      if (myDevice == nil)
+      {
+        myMsgContext->SendWarning() << "Metal_Context: device with registry ID " << (int64_t)myCaps->deviceRegistryId
+                                    << " is not found, default device is used instead";
+      }
+    }
+
+    // Select device based on preference
+    if (myDevice == nil
+     && (thePreferLowPower || myCaps->preferLowPowerGPU))
     {
       // Prefer integrated GPU
       for (id<MTLDevice> aDevice in devices)
@@ -217,6 +376,7 @@ bool Metal_Context::Init(bool thePreferLowPower)
 
     // Store device name
     myDeviceName = TCollection_AsciiString([myDevice.name UTF8String]);
+    myDeviceRegistryId = myDevice.registryID;
 
     // Create command queue
     myCommandQueue = [myDevice newCommandQueue];
@@ -227,6 +387,21 @@ bool Metal_Context::Init(bool thePreferLowPower)
       return false;
     }
 
+    // Create queue for transfers running concurrently with rendering; not fatal if fails
+    if (myCaps->useTransferQueue)
+    {
+      myTransferQueue = [myDevice newCommandQueue];
+      myTransferEvent = myTransferQueue != nil ? [myDevice newSharedEvent] : nil;
+      if (myTransferEvent == nil)
+      {
+        myTransferQueue = nil;
+      }
+      else
+      {
+        myTransferQueue.label = @"Metal_Context transfers";
+      }
+    }
+
     // Try to load default shader library
     NSError* error = nil;
     myDefaultLibrary = [myDevice newDefaultLibrary];
@@ -239,9 +414,59 @@ bool Metal_Context::Init(bool thePreferLowPower)
     // Create frame semaphore for triple-buffering
     myFrameSemaphore = dispatch_semaphore_create(myCaps->maxFramesInFlight);
 
+    // Define frame boundaries for the capture button of Xcode
+    if (myCaps->enableGPUCapture)
+    {
+      myCaptureScope = [[MTLCaptureManager sharedCaptureManager] newCaptureScopeWithCommandQueue:myCommandQueue];
+      myCaptureScope.label = @"OCCT Metal frame";
+      [MTLCaptureManager sharedCaptureManager].defaultCaptureScope = myCaptureScope;
+    }
+
     // Query device capabilities
     queryDeviceCaps();
 
+    // Create buffers sub-allocator, unless shared with another context
+    if (myBufferAllocator.IsNull())
+    {
+      myBufferAllocator = new Metal_BufferAllocator();
+      myBufferAllocator->Init(this, myCaps->bufferHeapBlockSize);
+    }
+    if (myResidencyMgr.IsNull()
+     && myCaps->useResidencyManager)
+    {
+      myResidencyMgr = new Metal_ResidencyManager();
+      myResidencyMgr->Init(this, myCaps->gpuMemoryBudget);
+    }
+    myStagingRing = new Metal_StagingRing();
+    myStagingRing->Init(this);
+    myUniformRing = new Metal_UniformRing();
+    if (!myUniformRing->Init(this))
+    {
+      myUniformRing.Nullify();
+    }
+    if (Metal_BindlessTable::IsSupported(this))
+    {
+      myBindlessTable = new Metal_BindlessTable();
+      if (!myBindlessTable->Init(this))
+      {
+        myBindlessTable.Nullify();
+      }
+    }
+    if (myTransformBuffer.IsNull())
+    {
+      myTransformBuffer = new Metal_TransformBuffer();
+    }
+    if (!myTransformBuffer->IsValid())
+    {
+      myTransformBuffer->Init(this);
+    }
+    myGpuTimer = new Metal_GpuTimer();
+    myGpuTimer->Init(this);
+    if (myFrameStats.IsNull())
+    {
+      myFrameStats = new Metal_FrameStats();
+    }
+
     myIsInitialized = true;
 
     myMsgContext->SendInfo() << "Metal_Context: Initialized with device '" << myDeviceName << "'";
@@ -253,6 +478,31 @@ bool Metal_Context::Init(bool thePreferLowPower)
   }
 }
 
+// =======================================================================
+// function : EnumerateDevices
+// purpose  : Fill in the list of available devices
+// =======================================================================
+void Metal_Context::EnumerateDevices(NCollection_Sequence<Metal_DeviceInfo>& theDevices)
+{
+  theDevices.Clear();
+  @autoreleasepool
+  {
+    NSArray<id<MTLDevice>>* aDevices = MTLCopyAllDevices();
+    for (id<MTLDevice> aDevice in aDevices)
+    {
+      Metal_DeviceInfo anInfo;
+      anInfo.Name = TCollection_AsciiString([aDevice.name UTF8String]);
+      anInfo.RegistryId = aDevice.registryID;
+      anInfo.WorkingSetSize = (size_t)aDevice.recommendedMaxWorkingSetSize;
+      anInfo.IsLowPower  = aDevice.lowPower;
+      anInfo.IsHeadless  = aDevice.headless;
+      anInfo.IsRemovable = aDevice.removable;
+      anInfo.HasUnifiedMemory = aDevice.hasUnifiedMemory;
+      theDevices.Append(anInfo);
+    }
+  }
+}
+
 // =======================================================================
 // function : queryDeviceCaps
 // purpose  : Query device capabilities
@@ -304,6 +554,115 @@ void Metal_Context::queryDeviceCaps()
     myHasRayTracing = false;
   }
 
+  // Query render indirect command buffers support
+  if (@available(macOS 10.15, iOS 13.0, *))
+  {
+#if TARGET_OS_IPHONE
+    myHasIndirectCommandBuffers = [myDevice supportsFamily:MTLGPUFamilyApple3];
+#else
+    myHasIndirectCommandBuffers = [myDevice supportsFamily:MTLGPUFamilyMac2];
+#endif
+  }
+  else
+  {
+    myHasIndirectCommandBuffers = false;
+  }
+
+  // Query unified memory architecture
+  if (@available(macOS 10.15, iOS 13.0, *))
+  {
+    myHasUnifiedMemory = myDevice.hasUnifiedMemory;
+  }
+  else
+  {
+#if TARGET_OS_IPHONE
+    myHasUnifiedMemory = true;
+#else
+    myHasUnifiedMemory = false;
+#endif
+  }
+
+  // Query memoryless render targets support (tile memory of Apple GPUs)
+  myHasMemorylessTargets = false;
+  if (@available(macOS 11.0, iOS 13.0, *))
+  {
+    myHasMemorylessTargets = [myDevice supportsFamily:MTLGPUFamilyApple1];
+  }
+
+  // Query object and mesh shaders support
+  myHasMeshShaders = false;
+  if (@available(macOS 13.0, iOS 16.0, *))
+  {
+    myHasMeshShaders = [myDevice supportsFamily:MTLGPUFamilyMetal3];
+  }
+
+  // Query tile shaders and imageblocks support (Apple GPUs since A11)
+  myHasTileShaders = false;
+  if (@available(macOS 11.0, iOS 13.0, *))
+  {
+    myHasTileShaders = [myDevice supportsFamily:MTLGPUFamilyApple4];
+  }
+
+  // Query MetalFX upscaling support (framework is linked weakly)
+  myHasMetalFX = false;
+  if (@available(macOS 13.0, iOS 16.0, *))
+  {
+    myHasMetalFX = NSClassFromString(@"MTLFXSpatialScalerDescriptor") != nil
+                && [MTLFXSpatialScalerDescriptor supportsDevice:myDevice]
+                && [MTLFXTemporalScalerDescriptor supportsDevice:myDevice];
+  }
+
+  // Query variable rasterization rate and vertex amplification for stereo rendering
+  myHasRateMaps = false;
+  myHasVertexAmplification = false;
+  if (@available(macOS 10.15.4, iOS 13.0, *))
+  {
+    myHasRateMaps = [myDevice supportsRasterizationRateMapWithLayerCount:2];
+    myHasVertexAmplification = [myDevice supportsVertexAmplificationCount:2];
+  }
+
+  // Query texture formats; 3-component and BGR formats are converted by Metal_Texture on upload
+  mySupportedFormats->Clear();
+  for (int aFormatIter = Image_Format_Gray; aFormatIter < Image_Format_NB; ++aFormatIter)
+  {
+    const Image_Format aFormat = (Image_Format)aFormatIter;
+    if (Metal_Texture::ToMetalPixelFormat(aFormat) != 0)
+    {
+      mySupportedFormats->Add(aFormat);
+    }
+  }
+
+  // BC formats are supported by all Mac GPUs, and by Apple silicon since macOS 11 / iOS 16.4
+  bool hasBC = false;
+  if (@available(macOS 11.0, iOS 16.4, *))
+  {
+    hasBC = myDevice.supportsBCTextureCompression;
+  }
+  else
+  {
+#if !TARGET_OS_IPHONE
+    hasBC = true;
+#endif
+  }
+  if (hasBC)
+  {
+    mySupportedFormats->Add(Image_CompressedFormat_RGB_S3TC_DXT1);
+    mySupportedFormats->Add(Image_CompressedFormat_RGBA_S3TC_DXT1);
+    mySupportedFormats->Add(Image_CompressedFormat_RGBA_S3TC_DXT3);
+    mySupportedFormats->Add(Image_CompressedFormat_RGBA_S3TC_DXT5);
+    mySupportedFormats->Add(Image_CompressedFormat_RGBA_BPTC);
+  }
+
+  // ASTC LDR is supported by all Apple GPU families, but not by Intel/AMD Macs
+  if (@available(macOS 11.0, iOS 13.0, *))
+  {
+    if ([myDevice supportsFamily:MTLGPUFamilyApple2])
+    {
+      mySupportedFormats->Add(Image_CompressedFormat_RGBA_ASTC_4x4);
+      mySupportedFormats->Add(Image_CompressedFormat_RGBA_ASTC_8x8);
+    }
+  }
+
   // Max color attachments is typically 8 for Metal
   myMaxColorAttachments = 8;
 
@@ -319,6 +678,69 @@ void Metal_Context::queryDeviceCaps()
   }
 }
 
+// =======================================================================
+// function : ShadersDirectory
+// purpose  :
+// =======================================================================
+const TCollection_AsciiString& Metal_Context::ShadersDirectory()
+{
+  static const TCollection_AsciiString THE_SHADERS_DIR = findShadersDirectory();
+  return THE_SHADERS_DIR;
+}
+
+// =======================================================================
+// function : LoadShaderLibrary
+// purpose  :
+// =======================================================================
+id<MTLLibrary> Metal_Context::LoadShaderLibrary(const TCollection_AsciiString& theName,
+                                                NSString* theSource,
+                                                MTLCompileOptions* theOptions,
+                                                NSError** theError)
+{
+  if (myDevice == nil)
+  {
+    return nil;
+  }
+
+  id<MTLLibrary> aLibrary = nil;
+  if (myShaderLibraries.Find(theName, aLibrary))
+  {
+    return aLibrary;
+  }
+
+  @autoreleasepool
+  {
+    if (myCaps->useOfflineShaders
+    && !ShadersDirectory().IsEmpty())
+    {
+      NSString* aPath = @((ShadersDirectory() + "/" + theName + ".metallib").ToCString());
+      if ([[NSFileManager defaultManager] fileExistsAtPath:aPath])
+      {
+        NSError* anError = nil;
+        aLibrary = [myDevice newLibraryWithURL:[NSURL fileURLWithPath:aPath] error:&anError];
+        if (aLibrary == nil)
+        {
+          myMsgContext->SendWarning() << "Metal_Context: unable to load precompiled library '"
+                                      << [aPath UTF8String] << "', falling back to runtime compilation";
+        }
+      }
+    }
+  }
+
+  // compile outside of autorelease pool to keep returned error alive
+  if (aLibrary == nil
+   && theSource != nil)
+  {
+    aLibrary = [myDevice newLibraryWithSource:theSource options:theOptions error:theError];
+  }
+
+  if (aLibrary != nil)
+  {
+    myShaderLibraries.Bind(theName, aLibrary);
+  }
+  return aLibrary;
+}
+
 // =======================================================================
 // function : CreateCommandBuffer
 // purpose  : Create a new command buffer
@@ -343,6 +765,89 @@ id<MTLCommandBuffer> Metal_Context::CreateCommandBuffer()
   }
 }
 
+// =======================================================================
+// function : CreateTransferCommandBuffer
+// purpose  : Create a new command buffer on transfer queue
+// =======================================================================
+id<MTLCommandBuffer> Metal_Context::CreateTransferCommandBuffer()
+{
+  if (myTransferQueue == nil)
+  {
+    return CreateCommandBuffer();
+  }
+
+  if (myCaps->contextDebug)
+  {
+    MTLCommandBufferDescriptor* desc = [[MTLCommandBufferDescriptor alloc] init];
+    desc.errorOptions = MTLCommandBufferErrorOptionEncoderExecutionStatus;
+    return [myTransferQueue commandBufferWithDescriptor:desc];
+  }
+  return [myTransferQueue commandBuffer];
+}
+
+// =======================================================================
+// function : CommitTransfer
+// purpose  : Commit transfer command buffer signaling transfer event
+// =======================================================================
+uint64_t Metal_Context::CommitTransfer(id<MTLCommandBuffer> theCmdBuffer)
+{
+  if (theCmdBuffer == nil)
+  {
+    return 0;
+  }
+  if (myTransferEvent == nil || theCmdBuffer.commandQueue != myTransferQueue)
+  {
+    // ordered with rendering by the main queue
+    [theCmdBuffer commit];
+    return 0;
+  }
+
+  // values should increase in commit order, so that waiting for a value covers preceding transfers
+  std::lock_guard<std::mutex> aLock(myTransferMutex);
+  const uint64_t aValue = myTransferValue.load() + 1;
+  [theCmdBuffer encodeSignalEvent:myTransferEvent value:aValue];
+  [theCmdBuffer commit];
+  myTransferValue.store(aValue);
+  return aValue;
+}
+
+// =======================================================================
+// function : IsTransferCompleted
+// purpose  : Check if transfer has been completed
+// =======================================================================
+bool Metal_Context::IsTransferCompleted(uint64_t theTransfer) const
+{
+  return theTransfer == 0
+      || myTransferEvent == nil
+      || myTransferEvent.signaledValue >= theTransfer;
+}
+
+// =======================================================================
+// function : WaitTransfer
+// purpose  : Make main queue wait for transfer
+// =======================================================================
+void Metal_Context::WaitTransfer(uint64_t theTransfer)
+{
+  uint64_t aWaited = myTransferWaited.load();
+  if (theTransfer <= aWaited
+   || IsTransferCompleted(theTransfer)
+   || myCommandQueue == nil)
+  {
+    return;
+  }
+
+  // separate command buffer blocks command buffers committed after it to the same queue
+  id<MTLCommandBuffer> aWaitBuffer = [myCommandQueue commandBuffer];
+  aWaitBuffer.label = @"Metal_Context transfer wait";
+  [aWaitBuffer encodeWaitForEvent:myTransferEvent value:theTransfer];
+  [aWaitBuffer commit];
+  while (aWaited < theTransfer
+     && !myTransferWaited.compare_exchange_weak(aWaited, theTransfer))
+  {
+    //
+  }
+}
+
 // =======================================================================
 // function : CurrentCommandBuffer
 // purpose  : Return current command buffer (creates one if needed)
@@ -364,8 +869,22 @@ void Metal_Context::CommitAndWait()
 {
   if (myCurrentCmdBuffer != nil)
   {
+    // uploads should be executed before commands using them
+    if (!myStagingRing.IsNull())
+    {
+      myStagingRing->Flush();
+    }
     [myCurrentCmdBuffer commit];
     [myCurrentCmdBuffer waitUntilCompleted];
+    if (!myBufferAllocator.IsNull())
+    {
+      myBufferAllocator->FrameSubmitted();
+      myBufferAllocator->ReclaimRetired(true);
+    }
+    if (!myBindlessTable.IsNull())
+    {
+      myBindlessTable->FrameSubmitted();
+    }
 
     if (myCaps->contextDebug && myCurrentCmdBuffer.error != nil)
     {
@@ -386,10 +905,25 @@ void Metal_Context::Commit()
 {
   if (myCurrentCmdBuffer != nil)
   {
-    // Add completion handler to signal semaphore when frame completes
+    // uploads should be executed before commands using them
+    if (!myStagingRing.IsNull())
+    {
+      myStagingRing->Flush();
+    }
+
+    // Add completion handler to signal semaphore when frame completes;
+    // GPU time of the frame is stored before signaling, so that it stays valid until context release
     __block dispatch_semaphore_t blockSemaphore = myFrameSemaphore;
-    [myCurrentCmdBuffer addCompletedHandler:^(id<MTLCommandBuffer> /* buffer */)
+    std::atomic<double>* aGpuFrameTime = &myLastGpuFrameTime;
+    [myCurrentCmdBuffer addCompletedHandler:^(id<MTLCommandBuffer> theBuffer)
     {
+      if (@available(macOS 10.15, iOS 10.3, *))
+      {
+        if (theBuffer.GPUEndTime > theBuffer.GPUStartTime)
+        {
+          aGpuFrameTime->store(theBuffer.GPUEndTime - theBuffer.GPUStartTime, std::memory_order_relaxed);
+        }
+      }
       if (blockSemaphore != nil)
       {
         dispatch_semaphore_signal(blockSemaphore);
@@ -398,9 +932,93 @@ void Metal_Context::Commit()
 
     [myCurrentCmdBuffer commit];
     myCurrentCmdBuffer = nil;
+    if (!myBufferAllocator.IsNull())
+    {
+      myBufferAllocator->FrameSubmitted();
+    }
+    if (!myBindlessTable.IsNull())
+    {
+      myBindlessTable->FrameSubmitted();
+    }
+    if (myIsCaptureScopeOpen)
+    {
+      [myCaptureScope endScope];
+      myIsCaptureScopeOpen = false;
+    }
+    AdvanceFrame();
+
+    if (myNbCaptureFrames > 0
+     && --myNbCaptureFrames == 0)
+    {
+      EndCapture();
+    }
   }
 }
 
+// =======================================================================
+// function : BeginCapture
+// purpose  :
+// =======================================================================
+bool Metal_Context::BeginCapture(const TCollection_AsciiString& theFilePath, int theNbFrames)
+{
+  if (myCommandQueue == nil)
+  {
+    return false;
+  }
+  if (IsCapturing())
+  {
+    myMsgContext->SendWarning() << "Metal_Context: GPU capture into '" << myCapturePath << "' is already in progress";
+    return false;
+  }
+
+  if (@available(macOS 10.15, iOS 13.0, *))
+  {
+    MTLCaptureManager* aCaptureMgr = [MTLCaptureManager sharedCaptureManager];
+    if (![aCaptureMgr supportsDestination:MTLCaptureDestinationGPUTraceDocument])
+    {
+      myMsgContext->SendFail() << "Metal_Context: GPU trace documents cannot be written;"
+                                  " launch the application with MTL_CAPTURE_ENABLED=1 environment variable";
+      return false;
+    }
+
+    MTLCaptureDescriptor* aDesc = [[MTLCaptureDescriptor alloc] init];
+    aDesc.captureObject = myCommandQueue;
+    aDesc.destination   = MTLCaptureDestinationGPUTraceDocument;
+    aDesc.outputURL     = [NSURL fileURLWithPath:[NSString stringWithUTF8String:theFilePath.ToCString()]];
+    NSError* anError = nil;
+    if (![aCaptureMgr startCaptureWithDescriptor:aDesc error:&anError])
+    {
+      myMsgContext->SendFail() << "Metal_Context: GPU capture into '" << theFilePath << "' failed: "
+                               << (anError != nil ? [[anError localizedDescription] UTF8String] : "unknown error");
+      return false;
+    }
+
+    myCapturePath     = theFilePath;
+    myNbCaptureFrames = std::max(theNbFrames, 0);
+    return true;
+  }
+
+  myMsgContext->SendFail() << "Metal_Context: GPU capture requires macOS 10.15 or later";
+  return false;
+}
+
+// =======================================================================
+// function : EndCapture
+// purpose  :
+// =======================================================================
+void Metal_Context::EndCapture()
+{
+  if (!IsCapturing())
+  {
+    return;
+  }
+
+  [[MTLCaptureManager sharedCaptureManager] stopCapture];
+  myNbCaptureFrames = -1;
+  myMsgContext->SendInfo() << "Metal_Context: GPU capture has been written into '" << myCapturePath << "'";
+  myCapturePath.Clear();
+}
+
 // =======================================================================
 // function : IsFormatSupported
 // purpose  : Check if pixel format is supported
@@ -496,6 +1114,39 @@ void Metal_Context::ReleaseDelayed()
   }
 }
 
+// =======================================================================
+// function : TessellationController
+// purpose  : Return tessellation controller, created on first use
+// =======================================================================
+const occ::handle<Metal_TessellationController>& Metal_Context::TessellationController()
+{
+  if (myTessController.IsNull()
+   && myIsInitialized
+   && myShaderManager != nullptr)
+  {
+    myTessController = new Metal_TessellationController(this);
+  }
+  return myTessController;
+}
+
+// =======================================================================
+// function : ComputeService
+// purpose  : Return compute service, created on first use
+// =======================================================================
+const occ::handle<Metal_ComputeService>& Metal_Context::ComputeService()
+{
+  if (myComputeService.IsNull()
+   && myIsInitialized)
+  {
+    occ::handle<Metal_ComputeService> aService = new Metal_ComputeService();
+    if (aService->Init(this))
+    {
+      myComputeService = aService;
+    }
+  }
+  return myComputeService;
+}
+
 // =======================================================================
 // function : AdvanceFrame
 // purpose  : Advance to next frame
@@ -503,6 +1154,7 @@ void Metal_Context::ReleaseDelayed()
 void Metal_Context::AdvanceFrame()
 {
   myCurrentFrameIndex = (myCurrentFrameIndex + 1) % myCaps->maxFramesInFlight;
+  ++myFrameNumber;
 }
 
 // =======================================================================
@@ -514,6 +1166,47 @@ void Metal_Context::WaitForFrame()
   if (myFrameSemaphore != nil)
   {
     dispatch_semaphore_wait(myFrameSemaphore, DISPATCH_TIME_FOREVER);
+
+    // keep spare slots of the semaphore acquired to reduce the number of frames in flight;
+    // acquiring a slot waits for completion of one more of the previous frames
+    const int aNbSlots = std::max(myCaps->maxFramesInFlight, 1);
+    const int aLimit   = myFramesInFlightLimit > 0 ? std::min(myFramesInFlightLimit, aNbSlots) : aNbSlots;
+    for (; myNbHeldFrameSlots < aNbSlots - aLimit; ++myNbHeldFrameSlots)
+    {
+      dispatch_semaphore_wait(myFrameSemaphore, DISPATCH_TIME_FOREVER);
+    }
+    for (; myNbHeldFrameSlots > aNbSlots - aLimit; --myNbHeldFrameSlots)
+    {
+      dispatch_semaphore_signal(myFrameSemaphore);
+    }
+  }
+
+  // the oldest frame in flight is finished - its freed buffer ranges can be reused
+  if (!myBufferAllocator.IsNull())
+  {
+    myBufferAllocator->ReclaimRetired(false);
+  }
+  // ... as well as uniform ring slot of the frame, which has been used by that frame
+  if (!myUniformRing.IsNull())
+  {
+    myUniformRing->BeginFrame(myCurrentFrameIndex);
+  }
+  // ... and transformations of moved structures are copied into its buffer
+  if (!myTransformBuffer.IsNull())
+  {
+    if (!myTransformBuffer->IsValid())
+    {
+      // buffers have been released by another context sharing them
+      myTransformBuffer->Init(this);
+    }
+    myTransformBuffer->BeginFrame(myCurrentFrameIndex);
+  }
+
+  if (myCaptureScope != nil
+  && !myIsCaptureScopeOpen)
+  {
+    [myCaptureScope beginScope];
+    myIsCaptureScopeOpen = true;
   }
 }
 
@@ -685,6 +1378,13 @@ void Metal_Context::DiagnosticInformation(
       aFeatures += "ArgumentBuffersTier2";
     }
 
+    // Indirect command buffers
+    if (myHasIndirectCommandBuffers)
+    {
+      if (!aFeatures.IsEmpty()) aFeatures += ", ";
+      aFeatures += "IndirectCommandBuffers";
+    }
+
     // Check various features
     if (@available(macOS 10.14, iOS 12.0, *))
     {
@@ -776,6 +1476,63 @@ void Metal_Context::DiagnosticInformation(
         theDict.Add("Unified Memory", "No (Discrete GPU)");
       }
     }
+    theDict.Add("Memoryless Targets", myHasMemorylessTargets ? "Yes" : "No");
+    theDict.Add("Mesh Shaders", myHasMeshShaders ? "Yes" : "No");
+    theDict.Add("Tile Shaders", myHasTileShaders ? "Yes" : "No");
+    theDict.Add("MetalFX", myHasMetalFX ? "Yes" : "No");
+    theDict.Add("Rasterization Rate Maps", myHasRateMaps ? "Yes" : "No");
+    theDict.Add("Vertex Amplification", myHasVertexAmplification ? "Yes" : "No");
+    theDict.Add("Compressed Textures",
+                TCollection_AsciiString(mySupportedFormats->IsSupported(Image_CompressedFormat_RGBA_BPTC) ? "BC " : "")
+                + (mySupportedFormats->IsSupported(Image_CompressedFormat_RGBA_ASTC_4x4) ? "ASTC" : ""));
+    theDict.Add("Frames In Flight",
+                TCollection_AsciiString(myCaps->maxFramesInFlight - myNbHeldFrameSlots)
+                + (myCaps->lowLatencyPacing ? " (low-latency pacing)" : ""));
+
+    if (!myResidencyMgr.IsNull())
+    {
+      theDict.Add("GPU Memory Budget",
+                  TCollection_AsciiString((int)(myResidencyMgr->Budget() / (1024 * 1024))) + " MB, "
+                  + myResidencyMgr->NbEvicted() + " structures evicted");
+    }
+
+    if (!myBufferAllocator.IsNull())
+    {
+      const Metal_BufferAllocator::Statistics aStats = myBufferAllocator->Stats();
+      theDict.Add("Buffer Heap Blocks",
+                  TCollection_AsciiString(aStats.NbBlocks) + " + " + aStats.NbDedicated + " dedicated");
+      theDict.Add("Buffer Memory Allocated",
+                  TCollection_AsciiString((int)(aStats.AllocatedBytes / 1024)) + " KB");
+      theDict.Add("Buffer Memory Live",
+                  TCollection_AsciiString((int)(aStats.LiveBytes / 1024)) + " KB");
+      theDict.Add("Buffer Memory Wasted",
+                  TCollection_AsciiString((int)(aStats.WastedBytes / 1024)) + " KB");
+      if (aStats.NbAdopted > 0)
+      {
+        theDict.Add("Buffer Memory Adopted",
+                    TCollection_AsciiString((int)(aStats.AdoptedBytes / 1024)) + " KB in " + aStats.NbAdopted + " arrays");
+      }
+    }
+    if (!myBindlessTable.IsNull())
+    {
+      theDict.Add("Bindless Table",
+                  TCollection_AsciiString(myBindlessTable->NbMaterials()) + " materials, "
+                  + myBindlessTable->NbTextures() + " textures");
+    }
+    if (!myUniformRing.IsNull())
+    {
+      theDict.Add("Uniform Ring",
+                  TCollection_AsciiString((int)(myUniformRing->FrameSize() / 1024)) + " KB per frame");
+    }
+    if (!myTransformBuffer.IsNull())
+    {
+      theDict.Add("Transform Buffer",
+                  TCollection_AsciiString(myTransformBuffer->NbSlots()) + " structures");
+    }
+    if (!myGpuTimer.IsNull())
+    {
+      theDict.Add("GPU Timers", myGpuTimer->HasPassTimers() ? "passes (counters sampling)" : "command buffers");
+    }
 
     // Recommended working set
     if (@available(macOS 10.12, iOS 10.0, *))
@@ -1005,9 +1762,9 @@ fragment float4 fragment_textured_background(
     NSError* error = nil;
 
     // Compile shader library from source
-    id<MTLLibrary> aLibrary = [myDevice newLibraryWithSource:shaderSource
-                                                     options:nil
-                                                       error:&error];
+    id<MTLLibrary> aLibrary = LoadShaderLibrary("Metal_Context_shaderSource",
+                                                shaderSource,
+                                                nil, &error);
     if (aLibrary == nil)
     {
       if (error != nil)
@@ -0,0 +1,113 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+#ifndef Metal_DeviceHandoff_HeaderFile
+#define Metal_DeviceHandoff_HeaderFile
+
+#include <NCollection_Vec2.hxx>
+#include <Standard_Transient.hxx>
+#include <Standard_Handle.hxx>
+
+#ifdef __OBJC__
+#import <Metal/Metal.h>
+#endif
+
+class Metal_Context;
+
+//! Handoff of image rendered on one device (producer, e.g. discrete GPU running path tracing)
+//! to another device (consumer, e.g. GPU attached to display drawing the view).
+//!
+//! Image is stored within IOSurface, which is wrapped into texture of each device,
+//! and access is ordered by shared event signaled by command buffers of both devices:
+//! odd values mark image produced, even values mark image consumed, so that
+//! producer never overwrites image still being read by consumer.
+//! When both contexts use the same device, single texture is shared instead of IOSurface.
+//!
+//! Usage per frame:
+//! - producer command buffer: EncodeProducerBegin(), rendering into ProducerTexture(), EncodeProducerEnd();
+//! - consumer command buffer: EncodeConsumerBegin(), reading ConsumerTexture(), EncodeConsumerEnd().
+class Metal_DeviceHandoff : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(Metal_DeviceHandoff, Standard_Transient)
+public:
+
+  //! Create uninitialized handoff.
+  Standard_EXPORT Metal_DeviceHandoff();
+
+  //! Destructor.
+  Standard_EXPORT ~Metal_DeviceHandoff();
+
+  //! Release resources.
+  Standard_EXPORT void Release();
+
+  //! Return TRUE if handoff has been initialized.
+  bool IsValid() const { return mySize.x() > 0; }
+
+  //! Return TRUE if producer and consumer share the same device.
+  bool IsSameDevice() const { return myIsSameDevice; }
+
+  //! Return image size.
+  const NCollection_Vec2<int>& Size() const { return mySize; }
+
+#ifdef __OBJC__
+  //! Initialize (or re-initialize on change) image shared between devices.
+  //! @param theProducer context rendering the image
+  //! @param theConsumer context reading the image
+  //! @param theSize     image size
+  //! @param theFormat   color format (MTLPixelFormatBGRA8Unorm, RGBA8Unorm, RGBA16Float or RGBA32Float)
+  //! @return FALSE on failure
+  Standard_EXPORT bool Init(Metal_Context* theProducer,
+                            Metal_Context* theConsumer,
+                            const NCollection_Vec2<int>& theSize,
+                            MTLPixelFormat theFormat);
+
+  //! Return texture of producer device.
+  id<MTLTexture> ProducerTexture() const { return myProducerTexture; }
+
+  //! Return texture of consumer device.
+  id<MTLTexture> ConsumerTexture() const { return myConsumerTexture; }
+
+  //! Encode wait for image being consumed before rendering into it.
+  Standard_EXPORT void EncodeProducerBegin(id<MTLCommandBuffer> theCmdBuffer);
+
+  //! Encode signal of image being produced.
+  Standard_EXPORT void EncodeProducerEnd(id<MTLCommandBuffer> theCmdBuffer);
+
+  //! Encode wait for image being produced before reading it.
+  Standard_EXPORT void EncodeConsumerBegin(id<MTLCommandBuffer> theCmdBuffer);
+
+  //! Encode signal of image being consumed.
+  Standard_EXPORT void EncodeConsumerEnd(id<MTLCommandBuffer> theCmdBuffer);
+#endif
+
+private:
+
+  NCollection_Vec2<int> mySize;         //!< image size
+  uint64_t              myEventValue;   //!< last value of shared event requested to be signaled
+  int                   myFormat;       //!< color format (MTLPixelFormat)
+  bool                  myIsSameDevice; //!< producer and consumer share the device
+#ifdef __OBJC__
+  id<MTLTexture>        myProducerTexture; //!< image texture of producer device
+  id<MTLTexture>        myConsumerTexture; //!< image texture of consumer device
+  id<MTLSharedEvent>    myProducerEvent;   //!< shared event of producer device
+  id<MTLSharedEvent>    myConsumerEvent;   //!< the same shared event opened by consumer device
+  id                    mySurface;         //!< IOSurface holding image of different devices
+#else
+  void*                 myProducerTexture;
+  void*                 myConsumerTexture;
+  void*                 myProducerEvent;
+  void*                 myConsumerEvent;
+  void*                 mySurface;
+#endif
+};
+
+#endif // Metal_DeviceHandoff_HeaderFile
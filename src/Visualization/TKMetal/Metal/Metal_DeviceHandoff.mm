@@ -0,0 +1,240 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+#import <TargetConditionals.h>
+#import <Metal/Metal.h>
+#import <IOSurface/IOSurface.h>
+
+#include <Metal_DeviceHandoff.hxx>
+#include <Metal_Context.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(Metal_DeviceHandoff, Standard_Transient)
+
+namespace
+{
+  //! Return bytes per pixel and four-character code of IOSurface pixel format, or 0 for unsupported format.
+  static int surfaceFormat(MTLPixelFormat theFormat, uint32_t& theFourCC)
+  {
+    switch (theFormat)
+    {
+      case MTLPixelFormatBGRA8Unorm:  theFourCC = 'BGRA'; return 4;
+      case MTLPixelFormatRGBA8Unorm:  theFourCC = 'RGBA'; return 4;
+      case MTLPixelFormatRGBA16Float: theFourCC = 'RGhA'; return 8;
+      case MTLPixelFormatRGBA32Float: theFourCC = 'RGfA'; return 16;
+      default: break;
+    }
+    theFourCC = 0;
+    return 0;
+  }
+}
+
+// =======================================================================
+// function : Metal_DeviceHandoff
+// purpose  : Constructor
+// =======================================================================
+Metal_DeviceHandoff::Metal_DeviceHandoff()
+: mySize(0, 0),
+  myEventValue(0),
+  myFormat(MTLPixelFormatInvalid),
+  myIsSameDevice(false),
+  myProducerTexture(nil),
+  myConsumerTexture(nil),
+  myProducerEvent(nil),
+  myConsumerEvent(nil),
+  mySurface(nil)
+{
+  //
+}
+
+// =======================================================================
+// function : ~Metal_DeviceHandoff
+// purpose  : Destructor
+// =======================================================================
+Metal_DeviceHandoff::~Metal_DeviceHandoff()
+{
+  Release();
+}
+
+// =======================================================================
+// function : Release
+// purpose  : Release resources
+// =======================================================================
+void Metal_DeviceHandoff::Release()
+{
+  myProducerTexture = nil;
+  myConsumerTexture = nil;
+  myProducerEvent = nil;
+  myConsumerEvent = nil;
+  mySurface = nil;
+  mySize.SetValues(0, 0);
+  myEventValue = 0;
+  myFormat = MTLPixelFormatInvalid;
+  myIsSameDevice = false;
+}
+
+// =======================================================================
+// function : Init
+// purpose  : Initialize image shared between devices
+// =======================================================================
+bool Metal_DeviceHandoff::Init(Metal_Context* theProducer,
+                               Metal_Context* theConsumer,
+                               const NCollection_Vec2<int>& theSize,
+                               MTLPixelFormat theFormat)
+{
+  if (theProducer == nullptr || !theProducer->IsValid()
+   || theConsumer == nullptr || !theConsumer->IsValid()
+   || theSize.x() <= 0 || theSize.y() <= 0)
+  {
+    Release();
+    return false;
+  }
+
+  const bool isSameDevice = theProducer->Device() == theConsumer->Device();
+  if (IsValid()
+   && mySize == theSize
+   && myFormat == (int)theFormat
+   && myIsSameDevice == isSameDevice
+   && myProducerTexture.device == theProducer->Device()
+   && myConsumerTexture.device == theConsumer->Device())
+  {
+    return true;
+  }
+
+  Release();
+  MTLTextureDescriptor* aTexDesc = [MTLTextureDescriptor texture2DDescriptorWithPixelFormat:theFormat
+                                                                                      width:theSize.x()
+                                                                                     height:theSize.y()
+                                                                                  mipmapped:NO];
+  aTexDesc.usage = MTLTextureUsageRenderTarget | MTLTextureUsageShaderRead | MTLTextureUsageShaderWrite;
+  if (isSameDevice)
+  {
+    aTexDesc.storageMode = MTLStorageModePrivate;
+    myProducerTexture = [theProducer->Device() newTextureWithDescriptor:aTexDesc];
+    myConsumerTexture = myProducerTexture;
+  }
+  else
+  {
+    uint32_t aFourCC = 0;
+    const int aBytesPerPixel = surfaceFormat(theFormat, aFourCC);
+    if (aBytesPerPixel == 0)
+    {
+      theProducer->Messenger()->SendFail() << "Metal_DeviceHandoff: unsupported pixel format " << (int)theFormat;
+      return false;
+    }
+
+    NSDictionary* aProps = @{ (id)kIOSurfaceWidth:           @(theSize.x()),
+                              (id)kIOSurfaceHeight:          @(theSize.y()),
+                              (id)kIOSurfaceBytesPerElement: @(aBytesPerPixel),
+                              (id)kIOSurfacePixelFormat:     @(aFourCC) };
+    IOSurfaceRef aSurface = IOSurfaceCreate((__bridge CFDictionaryRef)aProps);
+    if (aSurface == nullptr)
+    {
+      theProducer->Messenger()->SendFail() << "Metal_DeviceHandoff: IOSurface creation failed";
+      return false;
+    }
+    mySurface = (__bridge_transfer id)aSurface;
+
+    // IOSurface-backed textures should use managed (shared on Apple GPUs) storage
+#if TARGET_OS_OSX
+    aTexDesc.storageMode = MTLStorageModeManaged;
+#else
+    aTexDesc.storageMode = MTLStorageModeShared;
+#endif
+    myProducerTexture = [theProducer->Device() newTextureWithDescriptor:aTexDesc iosurface:aSurface plane:0];
+    myConsumerTexture = [theConsumer->Device() newTextureWithDescriptor:aTexDesc iosurface:aSurface plane:0];
+  }
+
+  // the same event is opened by consumer device through shared handle
+  myProducerEvent = [theProducer->Device() newSharedEvent];
+  if (myProducerEvent != nil)
+  {
+    MTLSharedEventHandle* aHandle = [myProducerEvent newSharedEventHandle];
+    myConsumerEvent = isSameDevice ? myProducerEvent : [theConsumer->Device() newSharedEventWithHandle:aHandle];
+  }
+  if (myProducerTexture == nil
+   || myConsumerTexture == nil
+   || myProducerEvent == nil
+   || myConsumerEvent == nil)
+  {
+    theProducer->Messenger()->SendFail() << "Metal_DeviceHandoff: failed to create shared image";
+    Release();
+    return false;
+  }
+  myProducerTexture.label = @"HandoffProducer";
+  myConsumerTexture.label = @"HandoffConsumer";
+
+  mySize = theSize;
+  myFormat = (int)theFormat;
+  myIsSameDevice = isSameDevice;
+  myEventValue = 0;
+  return true;
+}
+
+// =======================================================================
+// function : EncodeProducerBegin
+// purpose  : Wait for image being consumed
+// =======================================================================
+void Metal_DeviceHandoff::EncodeProducerBegin(id<MTLCommandBuffer> theCmdBuffer)
+{
+  if (!IsValid() || theCmdBuffer == nil)
+  {
+    return;
+  }
+
+  // value might be odd, when previous image has not been consumed yet; the last image is overwritten then
+  const uint64_t aConsumed = myEventValue & ~uint64_t(1);
+  [theCmdBuffer encodeWaitForEvent:myProducerEvent value:aConsumed];
+}
+
+// =======================================================================
+// function : EncodeProducerEnd
+// purpose  : Signal image being produced
+// =======================================================================
+void Metal_DeviceHandoff::EncodeProducerEnd(id<MTLCommandBuffer> theCmdBuffer)
+{
+  if (!IsValid() || theCmdBuffer == nil)
+  {
+    return;
+  }
+
+  myEventValue += (myEventValue & 1) != 0 ? 2 : 1;
+  [theCmdBuffer encodeSignalEvent:myProducerEvent value:myEventValue];
+}
+
+// =======================================================================
+// function : EncodeConsumerBegin
+// purpose  : Wait for image being produced
+// =======================================================================
+void Metal_DeviceHandoff::EncodeConsumerBegin(id<MTLCommandBuffer> theCmdBuffer)
+{
+  if (!IsValid() || theCmdBuffer == nil || (myEventValue & 1) == 0)
+  {
+    return;
+  }
+
+  [theCmdBuffer encodeWaitForEvent:myConsumerEvent value:myEventValue];
+}
+
+// =======================================================================
+// function : EncodeConsumerEnd
+// purpose  : Signal image being consumed
+// =======================================================================
+void Metal_DeviceHandoff::EncodeConsumerEnd(id<MTLCommandBuffer> theCmdBuffer)
+{
+  if (!IsValid() || theCmdBuffer == nil || (myEventValue & 1) == 0)
+  {
+    return;
+  }
+
+  ++myEventValue;
+  [theCmdBuffer encodeSignalEvent:myConsumerEvent value:myEventValue];
+}
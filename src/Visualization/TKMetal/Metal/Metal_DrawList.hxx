@@ -0,0 +1,183 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef Metal_DrawList_HeaderFile
+#define Metal_DrawList_HeaderFile
+
+#include <Metal_InstanceBuffer.hxx>
+#include <NCollection_DataMap.hxx>
+#include <NCollection_Mat4.hxx>
+#include <NCollection_Vec4.hxx>
+#include <NCollection_Vector.hxx>
+#include <Standard_DefineAlloc.hxx>
+
+#include <cstdint>
+#include <vector>
+
+class Graphic3d_Aspects;
+class Metal_Group;
+class Metal_PrimitiveArray;
+class Metal_Structure;
+class Metal_Workspace;
+
+//! Draw list of opaque layer sorted by render state.
+//!
+//! Draws of primitive arrays are collected from the structures of the layer together with their
+//! state (pipeline, depth-stencil state, texture set, material and vertex buffer) packed into
+//! a 64-bit key, sorted by radix sort and submitted, so that each state is switched only when it changes.
+//! Display priority order is not preserved within the list, which is acceptable for depth-tested opaque geometry.
+//!
+//! Only plain shaded opaque geometry is sorted (see IsSortable());
+//! other structures should be rendered in normal way after Submit().
+//!
+//! When automatic instancing is enabled (Metal_Caps::useAutoInstancing), draws of structures sharing
+//! the same attribute data (Graphic3d_Buffer) and aspect, but differing by transformation
+//! (e.g. repeated assembly components), are merged into single instanced draw.
+//! Instance buffers of merged draws are kept between frames and rebuilt only when
+//! members of the batch or their transformation / highlight color change.
+class Metal_DrawList
+{
+public:
+
+  //! Number of state changes done by submission of draws.
+  struct StateChanges
+  {
+    int Pipelines;   //!< render pipeline switches
+    int DepthStates; //!< depth-stencil state switches
+    int Textures;    //!< texture set switches
+    int Materials;   //!< material switches
+    int Buffers;     //!< vertex buffer switches
+
+    StateChanges() : Pipelines(0), DepthStates(0), Textures(0), Materials(0), Buffers(0) {}
+
+    //! Return total number of state changes.
+    int Total() const { return Pipelines + DepthStates + Textures + Materials + Buffers; }
+  };
+
+public:
+
+  //! Return TRUE if draws of the structure can be sorted.
+  Standard_EXPORT static bool IsSortable(const Metal_Structure* theStruct);
+
+  //! Empty constructor.
+  Standard_EXPORT Metal_DrawList();
+
+  //! Remove collected draws (allocated memory and instance buffers are kept for next frame).
+  Standard_EXPORT void Clear();
+
+  //! Release instance buffers kept between frames.
+  Standard_EXPORT void Release();
+
+  //! Collect draws of the structure.
+  //! @param theWorkspace       workspace defining shader manager
+  //! @param theStruct          structure to collect
+  //! @param theBaseModelMatrix model-view matrix, which structure transformation is applied to
+  //! @return FALSE if structure cannot be sorted (see IsSortable()) and should be rendered in normal way
+  Standard_EXPORT bool AddStructure(Metal_Workspace* theWorkspace,
+                                    const Metal_Structure* theStruct,
+                                    const NCollection_Mat4<float>& theBaseModelMatrix);
+
+  //! Sort collected draws by state key and submit them into active encoder of the workspace.
+  //! Aspect and model matrix of the workspace are modified.
+  Standard_EXPORT void Submit(Metal_Workspace* theWorkspace);
+
+  //! Return number of collected draws.
+  int NbDraws() const { return myDraws.Size(); }
+
+  //! Return number of instanced draws submitted in place of collected draws (computed by Submit()).
+  int NbInstancedBatches() const { return myBatches.Size(); }
+
+  //! Return state changes within insertion order of collected draws (computed by Submit()).
+  const StateChanges& UnsortedChanges() const { return myUnsortedChanges; }
+
+  //! Return state changes within sorted order of draws (computed by Submit()).
+  const StateChanges& SortedChanges() const { return mySortedChanges; }
+
+protected:
+
+  //! Collected draw.
+  struct DrawItem
+  {
+    uint64_t                    Key;       //!< packed state key
+    const Metal_Group*          Group;     //!< group defining aspect
+    const Metal_PrimitiveArray* Array;     //!< primitive array to draw
+    int                         TrsfIndex; //!< index within myTrsfs
+    int                         Batch;     //!< index within myBatches of instanced draw led by this draw,
+                                           //!  -1 for a single draw or -2 for a draw merged into instanced one
+  };
+
+  //! Instanced draw merging draws with the same geometry and aspect.
+  struct InstanceBatch
+  {
+    NCollection_Vector<int>           Draws;  //!< merged draws (the first one leads the batch)
+    occ::handle<Metal_InstanceBuffer> Buffer; //!< per-instance model-view matrix and color
+  };
+
+  //! Instance data kept between frames to detect batch changes.
+  struct InstanceCache
+  {
+    occ::handle<Metal_InstanceBuffer> Buffer; //!< uploaded instance buffer
+    std::vector<Metal_InstanceData>   Data;   //!< copy of uploaded data
+  };
+
+  //! Collect draws of the groups of the structure (including instanced one).
+  Standard_EXPORT void addGroups(Metal_Workspace* theWorkspace,
+                                 const Metal_Structure* theStruct,
+                                 int theTrsfIndex);
+
+  //! Return state key of the aspect without vertex buffer bits (pipeline, depth-stencil state, textures, material).
+  Standard_EXPORT uint64_t aspectKey(Metal_Workspace* theWorkspace,
+                                     const Graphic3d_Aspects* theAspect);
+
+  //! Return ordinal number of the state object within the frame (0 for NULL), saturated to theMaxValue.
+  Standard_EXPORT static uint64_t stateOrdinal(NCollection_DataMap<const void*, int>& theMap,
+                                               const void* theState,
+                                               uint64_t theMaxValue);
+
+  //! Count state changes between consecutive keys of the draws.
+  //! @param theIsSorted use sorted order (myOrder) instead of insertion order
+  Standard_EXPORT StateChanges countChanges(bool theIsSorted) const;
+
+  //! Sort draws by key with LSD radix sort (8 bits per pass, stable); result is written to myOrder.
+  Standard_EXPORT void radixSort();
+
+  //! Merge draws sharing geometry and aspect into instanced draws (myBatches).
+  Standard_EXPORT void buildBatches(Metal_Workspace* theWorkspace);
+
+  //! Return per-draw color (highlight color or interior color of the aspect).
+  Standard_EXPORT NCollection_Vec4<float> drawColor(const DrawItem& theDraw) const;
+
+protected:
+
+  NCollection_Vector<DrawItem>                myDraws;      //!< collected draws in insertion order
+  NCollection_Vector<NCollection_Mat4<float>> myTrsfs;      //!< model-view matrices of collected structures
+  NCollection_Vector<NCollection_Vec4<float>> myHighlights; //!< highlight colors of collected structures (negative alpha if not highlighted)
+  NCollection_Mat4<float>                     myBaseModelMatrix; //!< model-view matrix of the camera (uniforms of instanced draws)
+  NCollection_Vector<InstanceBatch>           myBatches;    //!< instanced draws of the frame
+  NCollection_DataMap<const void*, InstanceCache> myInstanceCache; //!< instance data of batches by leading array
+  std::vector<int>                            myOrder;      //!< sorted indices of draws
+  std::vector<int>                            myOrderTmp;   //!< scratch buffer of radix sort
+  NCollection_DataMap<const void*, int>       myPipelines;  //!< ordinals of pipeline states
+  NCollection_DataMap<const void*, int>       myDepthStates; //!< ordinals of depth-stencil states
+  NCollection_DataMap<const void*, int>       myTextures;   //!< ordinals of texture sets
+  NCollection_DataMap<const void*, uint64_t>  myAspectKeys; //!< state keys of aspects (material ordinal is the aspect ordinal)
+  NCollection_DataMap<const void*, int>       myBuffers;    //!< ordinals of vertex buffers
+  StateChanges                                myUnsortedChanges; //!< state changes in insertion order
+  StateChanges                                mySortedChanges;   //!< state changes in sorted order
+
+public:
+
+  DEFINE_STANDARD_ALLOC
+};
+
+#endif // Metal_DrawList_HeaderFile
@@ -0,0 +1,586 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#import <TargetConditionals.h>
+#import <Metal/Metal.h>
+
+#include <Metal_DrawList.hxx>
+#include <Metal_Context.hxx>
+#include <Metal_Group.hxx>
+#include <Metal_PrimitiveArray.hxx>
+#include <Metal_ShaderManager.hxx>
+#include <Metal_Signpost.hxx>
+#include <Metal_Structure.hxx>
+#include <Metal_Workspace.hxx>
+
+#include <algorithm>
+#include <cstring>
+#include <tuple>
+
+namespace
+{
+  // Layout of the state key (most significant fields are switched least often):
+  // | pipeline (8) | depth-stencil (4) | texture set (12) | material (16) | vertex buffer (24) |
+  static const int THE_KEY_BUFFER_SHIFT   = 0;
+  static const int THE_KEY_MATERIAL_SHIFT = 24;
+  static const int THE_KEY_TEXTURE_SHIFT  = 40;
+  static const int THE_KEY_DEPTH_SHIFT    = 52;
+  static const int THE_KEY_PIPELINE_SHIFT = 56;
+
+  static const uint64_t THE_KEY_BUFFER_MAX   = (uint64_t(1) << 24) - 1;
+  static const uint64_t THE_KEY_MATERIAL_MAX = (uint64_t(1) << 16) - 1;
+  static const uint64_t THE_KEY_TEXTURE_MAX  = (uint64_t(1) << 12) - 1;
+  static const uint64_t THE_KEY_DEPTH_MAX    = (uint64_t(1) << 4) - 1;
+  static const uint64_t THE_KEY_PIPELINE_MAX = (uint64_t(1) << 8) - 1;
+
+  //! Batch index of a draw merged into instanced draw.
+  static const int THE_BATCH_MERGED = -2;
+
+  //! Minimal number of draws sharing geometry and aspect to be merged into instanced draw.
+  static const int THE_MIN_INSTANCES = 4;
+
+  //! Vertex buffer index of instance data read by instanced programs.
+  static const int THE_INSTANCE_BUFFER_INDEX = 10;
+
+  //! Extract field of the state key.
+  static uint64_t keyField(uint64_t theKey, int theShift, uint64_t theMax)
+  {
+    return (theKey >> theShift) & theMax;
+  }
+}
+
+// =======================================================================
+// function : IsSortable
+// purpose  :
+// =======================================================================
+bool Metal_DrawList::IsSortable(const Metal_Structure* theStruct)
+{
+  if (theStruct == nullptr
+   || !theStruct->TransformPersistence().IsNull()
+   || theStruct->HasGroupTransformPersistence())
+  {
+    return false;
+  }
+  if (theStruct->InstancedStructure() != nullptr
+   && !IsSortable(theStruct->InstancedStructure()))
+  {
+    return false;
+  }
+  if (theStruct->highlight != 0
+   && !theStruct->HighlightStyle().IsNull()
+   && theStruct->HighlightStyle()->ColorRGBA().Alpha() < 1.0f)
+  {
+    return false;
+  }
+
+  for (Metal_Structure::GroupIterator aGroupIter(theStruct->Groups()); aGroupIter.More(); aGroupIter.Next())
+  {
+    const Metal_Group* aGroup = aGroupIter.Value();
+    if (aGroup == nullptr)
+    {
+      continue;
+    }
+
+    // same restrictions as for recording indirect commands, and only opaque geometry
+    // (transparent draws should keep their order)
+    const occ::handle<Graphic3d_Aspects> anAspect = aGroup->Aspects();
+    if (anAspect.IsNull()
+     || aGroup->HasTexts()
+     || aGroup->HasBSplineSurfaces()
+     || aGroup->HasPersistence()
+     || aGroup->IsStencilTestEnabled()
+     || aGroup->IsFlippingEnabled()
+     || anAspect->ToDrawEdges()
+     || anAspect->InteriorStyle() == Aspect_IS_EMPTY
+     || anAspect->InteriorStyle() == Aspect_IS_HOLLOW
+     || anAspect->AlphaMode() == Graphic3d_AlphaMode_Blend
+     || anAspect->InteriorColorRGBA().Alpha() < 1.0f)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// =======================================================================
+// function : Metal_DrawList
+// purpose  :
+// =======================================================================
+Metal_DrawList::Metal_DrawList()
+{
+  //
+}
+
+// =======================================================================
+// function : Clear
+// purpose  :
+// =======================================================================
+void Metal_DrawList::Clear()
+{
+  myDraws.Clear();
+  myTrsfs.Clear();
+  myHighlights.Clear();
+  myBatches.Clear();
+  myOrder.clear();
+  myPipelines.Clear();
+  myDepthStates.Clear();
+  myTextures.Clear();
+  myAspectKeys.Clear();
+  myBuffers.Clear();
+  myUnsortedChanges = StateChanges();
+  mySortedChanges = StateChanges();
+}
+
+// =======================================================================
+// function : Release
+// purpose  :
+// =======================================================================
+void Metal_DrawList::Release()
+{
+  Clear();
+  myInstanceCache.Clear();
+}
+
+// =======================================================================
+// function : stateOrdinal
+// purpose  :
+// =======================================================================
+uint64_t Metal_DrawList::stateOrdinal(NCollection_DataMap<const void*, int>& theMap,
+                                      const void* theState,
+                                      uint64_t theMaxValue)
+{
+  if (theState == nullptr)
+  {
+    return 0;
+  }
+
+  int anOrdinal = 0;
+  if (!theMap.Find(theState, anOrdinal))
+  {
+    anOrdinal = theMap.Extent() + 1;
+    theMap.Bind(theState, anOrdinal);
+  }
+  // states beyond the key range share the last value - sorting becomes less efficient but remains correct
+  return std::min(uint64_t(anOrdinal), theMaxValue);
+}
+
+// =======================================================================
+// function : aspectKey
+// purpose  :
+// =======================================================================
+uint64_t Metal_DrawList::aspectKey(Metal_Workspace* theWorkspace,
+                                   const Graphic3d_Aspects* theAspect)
+{
+  uint64_t aKey = 0;
+  if (myAspectKeys.Find(theAspect, aKey))
+  {
+    return aKey;
+  }
+
+  // resolve pipeline in the same way as Metal_Workspace::ApplyPipelineState()
+  Graphic3d_TypeOfShadingModel aShadingModel = theAspect->ShadingModel();
+  if (aShadingModel == Graphic3d_TypeOfShadingModel_DEFAULT)
+  {
+    aShadingModel = Graphic3d_TypeOfShadingModel_Phong;
+  }
+  id<MTLRenderPipelineState> aPipeline = nil;
+  id<MTLDepthStencilState> aDepthStencil = nil;
+  if (theWorkspace->ShaderManager() == nullptr
+   || !theWorkspace->ShaderManager()->GetProgram(aShadingModel, 0, aPipeline, aDepthStencil)
+   || aPipeline == nil)
+  {
+    aPipeline = theWorkspace->Context()->DefaultPipeline();
+    aDepthStencil = theWorkspace->Context()->DefaultDepthStencilState();
+  }
+
+  const uint64_t aMaterial = std::min(uint64_t(myAspectKeys.Extent() + 1), THE_KEY_MATERIAL_MAX);
+  aKey = (stateOrdinal(myPipelines,   (__bridge const void*)aPipeline,     THE_KEY_PIPELINE_MAX) << THE_KEY_PIPELINE_SHIFT)
+       | (stateOrdinal(myDepthStates, (__bridge const void*)aDepthStencil, THE_KEY_DEPTH_MAX)    << THE_KEY_DEPTH_SHIFT)
+       | (stateOrdinal(myTextures,    theAspect->TextureSet().get(),       THE_KEY_TEXTURE_MAX)  << THE_KEY_TEXTURE_SHIFT)
+       | (aMaterial << THE_KEY_MATERIAL_SHIFT);
+  myAspectKeys.Bind(theAspect, aKey);
+  return aKey;
+}
+
+// =======================================================================
+// function : AddStructure
+// purpose  :
+// =======================================================================
+bool Metal_DrawList::AddStructure(Metal_Workspace* theWorkspace,
+                                  const Metal_Structure* theStruct,
+                                  const NCollection_Mat4<float>& theBaseModelMatrix)
+{
+  if (!IsSortable(theStruct))
+  {
+    return false;
+  }
+
+  myBaseModelMatrix = theBaseModelMatrix;
+  myTrsfs.Append(theBaseModelMatrix * theStruct->RenderTransformation());
+
+  NCollection_Vec4<float> aHighlight(0.0f, 0.0f, 0.0f, -1.0f);
+  if (theStruct->highlight != 0)
+  {
+    aHighlight = !theStruct->HighlightStyle().IsNull()
+               ? NCollection_Vec4<float>(theStruct->HighlightStyle()->ColorRGBA())
+               : NCollection_Vec4<float>(1.0f, 1.0f, 1.0f, 1.0f);
+  }
+  myHighlights.Append(aHighlight);
+  addGroups(theWorkspace, theStruct, myTrsfs.Upper());
+  return true;
+}
+
+// =======================================================================
+// function : addGroups
+// purpose  :
+// =======================================================================
+void Metal_DrawList::addGroups(Metal_Workspace* theWorkspace,
+                               const Metal_Structure* theStruct,
+                               int theTrsfIndex)
+{
+  if (theStruct->InstancedStructure() != nullptr)
+  {
+    addGroups(theWorkspace, theStruct->InstancedStructure(), theTrsfIndex);
+  }
+
+  Metal_Context* aCtx = theWorkspace->Context();
+  for (Metal_Structure::GroupIterator aGroupIter(theStruct->Groups()); aGroupIter.More(); aGroupIter.Next())
+  {
+    const Metal_Group* aGroup = aGroupIter.Value();
+    if (aGroup == nullptr || aGroup->Primitives().IsEmpty() || !theStruct->IsGroupDrawn(*aGroup))
+    {
+      continue;
+    }
+
+    // groups with own transformation (like instances sharing triangulation) get own matrix
+    // on top of the structure one, so that auto-instancing might merge their draws
+    int aTrsfIndex = theTrsfIndex;
+    if (aGroup->HasTransformation())
+    {
+      myTrsfs.Append(myTrsfs.Value(theTrsfIndex) * aGroup->TransformationMatrix());
+      myHighlights.Append(NCollection_Vec4<float>(myHighlights.Value(theTrsfIndex)));
+      aTrsfIndex = myTrsfs.Upper();
+    }
+
+    const uint64_t anAspectKey = aspectKey(theWorkspace, aGroup->Aspects().get());
+    for (NCollection_List<Metal_PrimitiveArray*>::Iterator aPrimIter(aGroup->Primitives()); aPrimIter.More(); aPrimIter.Next())
+    {
+      Metal_PrimitiveArray* anArray = aPrimIter.Value();
+      if (anArray == nullptr)
+      {
+        continue;
+      }
+      if (!anArray->IsInitialized())
+      {
+        anArray->Init(aCtx);
+      }
+
+      const occ::handle<Metal_VertexBuffer>& aVbo = anArray->PositionBuffer();
+      const void* aBuffer = !aVbo.IsNull() ? (__bridge const void*)aVbo->Buffer() : nullptr;
+
+      DrawItem aDraw;
+      aDraw.Key       = anAspectKey | (stateOrdinal(myBuffers, aBuffer, THE_KEY_BUFFER_MAX) << THE_KEY_BUFFER_SHIFT);
+      aDraw.Group     = aGroup;
+      aDraw.Array     = anArray;
+      aDraw.TrsfIndex = aTrsfIndex;
+      aDraw.Batch     = -1;
+      myDraws.Append(aDraw);
+    }
+  }
+}
+
+// =======================================================================
+// function : countChanges
+// purpose  :
+// =======================================================================
+Metal_DrawList::StateChanges Metal_DrawList::countChanges(bool theIsSorted) const
+{
+  StateChanges aChanges;
+  uint64_t aPrevKey = 0;
+  for (int aDrawIter = 0; aDrawIter < myDraws.Size(); ++aDrawIter)
+  {
+    const uint64_t aKey = myDraws.Value(theIsSorted ? myOrder[aDrawIter] : aDrawIter).Key;
+    if (aDrawIter == 0)
+    {
+      // initial binding of each state is done by any order
+      aPrevKey = aKey;
+      continue;
+    }
+
+    aChanges.Pipelines   += keyField(aKey, THE_KEY_PIPELINE_SHIFT, THE_KEY_PIPELINE_MAX) != keyField(aPrevKey, THE_KEY_PIPELINE_SHIFT, THE_KEY_PIPELINE_MAX) ? 1 : 0;
+    aChanges.DepthStates += keyField(aKey, THE_KEY_DEPTH_SHIFT,    THE_KEY_DEPTH_MAX)    != keyField(aPrevKey, THE_KEY_DEPTH_SHIFT,    THE_KEY_DEPTH_MAX)    ? 1 : 0;
+    aChanges.Textures    += keyField(aKey, THE_KEY_TEXTURE_SHIFT,  THE_KEY_TEXTURE_MAX)  != keyField(aPrevKey, THE_KEY_TEXTURE_SHIFT,  THE_KEY_TEXTURE_MAX)  ? 1 : 0;
+    aChanges.Materials   += keyField(aKey, THE_KEY_MATERIAL_SHIFT, THE_KEY_MATERIAL_MAX) != keyField(aPrevKey, THE_KEY_MATERIAL_SHIFT, THE_KEY_MATERIAL_MAX) ? 1 : 0;
+    aChanges.Buffers     += keyField(aKey, THE_KEY_BUFFER_SHIFT,   THE_KEY_BUFFER_MAX)   != keyField(aPrevKey, THE_KEY_BUFFER_SHIFT,   THE_KEY_BUFFER_MAX)   ? 1 : 0;
+    aPrevKey = aKey;
+  }
+  return aChanges;
+}
+
+// =======================================================================
+// function : radixSort
+// purpose  :
+// =======================================================================
+void Metal_DrawList::radixSort()
+{
+  const int aNbDraws = myDraws.Size();
+  myOrder.resize(aNbDraws);
+  myOrderTmp.resize(aNbDraws);
+  for (int aDrawIter = 0; aDrawIter < aNbDraws; ++aDrawIter)
+  {
+    myOrder[aDrawIter] = aDrawIter;
+  }
+
+  for (int aShift = 0; aShift < 64; aShift += 8)
+  {
+    int aCounts[256] = {};
+    for (int aDrawIter = 0; aDrawIter < aNbDraws; ++aDrawIter)
+    {
+      ++aCounts[(myDraws.Value(aDrawIter).Key >> aShift) & 0xFF];
+    }
+    // skip pass when all draws share the same byte (unused key bits)
+    if (aCounts[(myDraws.Value(0).Key >> aShift) & 0xFF] == aNbDraws)
+    {
+      continue;
+    }
+
+    int anOffset = 0;
+    for (int aBucket = 0; aBucket < 256; ++aBucket)
+    {
+      const int aCount = aCounts[aBucket];
+      aCounts[aBucket] = anOffset;
+      anOffset += aCount;
+    }
+    for (int anOrderIter = 0; anOrderIter < aNbDraws; ++anOrderIter)
+    {
+      const int aDrawIndex = myOrder[anOrderIter];
+      myOrderTmp[aCounts[(myDraws.Value(aDrawIndex).Key >> aShift) & 0xFF]++] = aDrawIndex;
+    }
+    myOrder.swap(myOrderTmp);
+  }
+}
+
+// =======================================================================
+// function : drawColor
+// purpose  :
+// =======================================================================
+NCollection_Vec4<float> Metal_DrawList::drawColor(const DrawItem& theDraw) const
+{
+  const NCollection_Vec4<float>& aHighlight = myHighlights.Value(theDraw.TrsfIndex);
+  if (aHighlight.a() >= 0.0f)
+  {
+    return aHighlight;
+  }
+  return NCollection_Vec4<float>(theDraw.Group->Aspects()->InteriorColorRGBA());
+}
+
+// =======================================================================
+// function : buildBatches
+// purpose  :
+// =======================================================================
+void Metal_DrawList::buildBatches(Metal_Workspace* theWorkspace)
+{
+  myBatches.Clear();
+  if (!theWorkspace->Context()->Caps()->useAutoInstancing
+   || myDraws.Size() < THE_MIN_INSTANCES)
+  {
+    myInstanceCache.Clear();
+    return;
+  }
+
+  // group draws by aspect and geometry; arrays created from the same Graphic3d_ArrayOfPrimitives share attribute data
+  std::vector<int> aGroups(myDraws.Size());
+  for (int aDrawIter = 0; aDrawIter < myDraws.Size(); ++aDrawIter)
+  {
+    aGroups[aDrawIter] = aDrawIter;
+  }
+  auto aGeomKey = [this](int theDraw)
+  {
+    const DrawItem& aDraw = myDraws.Value(theDraw);
+    return std::make_tuple((const void*)aDraw.Group->Aspects().get(),
+                           (const void*)aDraw.Array->Attributes().get(),
+                           (const void*)aDraw.Array->Indices().get(),
+                           (int)aDraw.Array->Type(),
+                           theDraw);
+  };
+  std::sort(aGroups.begin(), aGroups.end(),
+            [&aGeomKey](int theLeft, int theRight) { return aGeomKey(theLeft) < aGeomKey(theRight); });
+
+  NCollection_DataMap<const void*, InstanceCache> anUsedCache;
+  std::vector<Metal_InstanceData> anInstances;
+  for (size_t aLower = 0; aLower < aGroups.size();)
+  {
+    const DrawItem& aLead = myDraws.Value(aGroups[aLower]);
+    size_t anUpper = aLower + 1;
+    for (; anUpper < aGroups.size(); ++anUpper)
+    {
+      const DrawItem& aDraw = myDraws.Value(aGroups[anUpper]);
+      if (aDraw.Group->Aspects() != aLead.Group->Aspects()
+       || aDraw.Array->Attributes() != aLead.Array->Attributes()
+       || aDraw.Array->Indices() != aLead.Array->Indices()
+       || aDraw.Array->Type() != aLead.Array->Type())
+      {
+        break;
+      }
+    }
+
+    // wide and dashed lines are expanded by own pipeline, which is not instanced;
+    // instanced vertex functions read float normals; mutable attributes are uploaded by direct rendering
+    const size_t aNbInstances = anUpper - aLower;
+    if (aNbInstances < size_t(THE_MIN_INSTANCES)
+     || aLead.Array->Attributes().IsNull()
+     || aLead.Array->HasOctahedralNormals()
+     || aLead.Array->HasMutableAttributes()
+     || (aLead.Array->NbLineSegments() > 0
+      && (aLead.Group->Aspects()->LineWidth() > 1.0f || aLead.Group->Aspects()->LinePattern() != 0xFFFF)))
+    {
+      aLower = anUpper;
+      continue;
+    }
+
+    InstanceBatch aBatch;
+    anInstances.resize(aNbInstances);
+    for (size_t anInstIter = 0; anInstIter < aNbInstances; ++anInstIter)
+    {
+      const int aDrawIndex = aGroups[aLower + anInstIter];
+      const DrawItem& aDraw = myDraws.Value(aDrawIndex);
+      const NCollection_Vec4<float> aColor = drawColor(aDraw);
+      std::copy(myTrsfs.Value(aDraw.TrsfIndex).GetData(), myTrsfs.Value(aDraw.TrsfIndex).GetData() + 16,
+                anInstances[anInstIter].Transform);
+      std::copy(aColor.GetData(), aColor.GetData() + 4, anInstances[anInstIter].Color);
+      aBatch.Draws.Append(aDrawIndex);
+    }
+
+    // keep instance buffer of the previous frame if the batch has not been changed;
+    // buffer is not updated in place as it might be still used by frames in flight
+    const void* aCacheKey = aLead.Array;
+    InstanceCache aCache;
+    if (!myInstanceCache.Find(aCacheKey, aCache)
+     || aCache.Data.size() != anInstances.size()
+     || std::memcmp(aCache.Data.data(), anInstances.data(), anInstances.size() * sizeof(Metal_InstanceData)) != 0)
+    {
+      aCache.Buffer = new Metal_InstanceBuffer();
+      if (!aCache.Buffer->Init(theWorkspace->Context(), (int)aNbInstances, anInstances.data()))
+      {
+        aLower = anUpper;
+        continue;
+      }
+      aCache.Data = anInstances;
+    }
+    anUsedCache.Bind(aCacheKey, aCache);
+
+    aBatch.Buffer = aCache.Buffer;
+    myBatches.Append(aBatch);
+
+    // the first collected draw leads the batch, other draws are skipped by Submit()
+    for (size_t anInstIter = 0; anInstIter < aNbInstances; ++anInstIter)
+    {
+      myDraws.ChangeValue(aGroups[aLower + anInstIter]).Batch = THE_BATCH_MERGED;
+    }
+    myDraws.ChangeValue(aBatch.Draws.First()).Batch = myBatches.Upper();
+    aLower = anUpper;
+  }
+
+  // instance data of batches disappeared from the frame is released
+  myInstanceCache.Exchange(anUsedCache);
+}
+
+// =======================================================================
+// function : Submit
+// purpose  :
+// =======================================================================
+void Metal_DrawList::Submit(Metal_Workspace* theWorkspace)
+{
+  if (myDraws.IsEmpty())
+  {
+    return;
+  }
+
+  Metal_Signpost aSortSignpost("Sort");
+  myUnsortedChanges = countChanges(false);
+  radixSort();
+  mySortedChanges = countChanges(true);
+  buildBatches(theWorkspace);
+  aSortSignpost.End();
+
+  const Graphic3d_Aspects* anActiveAspect = nullptr;
+  int anActiveTrsf = -1;
+  for (int anOrderIter = 0; anOrderIter < myDraws.Size(); ++anOrderIter)
+  {
+    const DrawItem& aDraw = myDraws.Value(myOrder[anOrderIter]);
+    if (aDraw.Batch == THE_BATCH_MERGED)
+    {
+      continue;
+    }
+
+    const occ::handle<Graphic3d_Aspects> anAspect = aDraw.Group->Aspects();
+    const bool isNewAspect = anAspect.get() != anActiveAspect;
+    if (isNewAspect)
+    {
+      // pipeline and depth-stencil states are set only when changed
+      theWorkspace->SetAspect(anAspect);
+      theWorkspace->ApplyPipelineState();
+      theWorkspace->ApplyMaterialUniforms();
+      anActiveAspect = anAspect.get();
+    }
+
+    if (aDraw.Batch >= 0)
+    {
+      const InstanceBatch& aBatch = myBatches.Value(aDraw.Batch);
+      if (theWorkspace->ApplyInstancedPipelineState())
+      {
+        // uniforms provide projection and view matrix for lighting, instances provide model-view matrices
+        theWorkspace->SetHighlighting(false);
+        theWorkspace->SetModelMatrix(myBaseModelMatrix);
+        theWorkspace->ApplyUniforms();
+        aDraw.Array->RenderInstanced(theWorkspace, aBatch.Buffer, THE_INSTANCE_BUFFER_INDEX);
+        theWorkspace->RestorePipelineState();
+        anActiveTrsf = -1;
+        continue;
+      }
+
+      // no instanced variant of the program - submit merged draws one by one
+      for (NCollection_Vector<int>::Iterator aDrawIter(aBatch.Draws); aDrawIter.More(); aDrawIter.Next())
+      {
+        const DrawItem& aMember = myDraws.Value(aDrawIter.Value());
+        const NCollection_Vec4<float>& aHighlight = myHighlights.Value(aMember.TrsfIndex);
+        theWorkspace->SetHighlighting(aHighlight.a() >= 0.0f);
+        if (aHighlight.a() >= 0.0f)
+        {
+          theWorkspace->SetHighlightColor(Quantity_ColorRGBA(aHighlight));
+        }
+        theWorkspace->SetModelMatrix(myTrsfs.Value(aMember.TrsfIndex));
+        theWorkspace->ApplyUniforms();
+        aMember.Array->Render(theWorkspace);
+      }
+      anActiveTrsf = -1;
+      continue;
+    }
+
+    if (isNewAspect || aDraw.TrsfIndex != anActiveTrsf)
+    {
+      // per-draw uniforms hold model-view matrix and interior (or highlight) color of the aspect
+      const NCollection_Vec4<float>& aHighlight = myHighlights.Value(aDraw.TrsfIndex);
+      theWorkspace->SetHighlighting(aHighlight.a() >= 0.0f);
+      if (aHighlight.a() >= 0.0f)
+      {
+        theWorkspace->SetHighlightColor(Quantity_ColorRGBA(aHighlight));
+      }
+      theWorkspace->SetModelMatrix(myTrsfs.Value(aDraw.TrsfIndex));
+      theWorkspace->ApplyUniforms();
+      anActiveTrsf = aDraw.TrsfIndex;
+    }
+    aDraw.Array->Render(theWorkspace);
+  }
+  theWorkspace->SetHighlighting(false);
+}
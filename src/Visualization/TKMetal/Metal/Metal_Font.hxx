@@ -18,6 +18,7 @@
 #include <Metal_Texture.hxx>
 
 #include <Font_Rect.hxx>
+#include <Image_PixMap.hxx>
 #include <NCollection_DataMap.hxx>
 #include <NCollection_Vector.hxx>
 #include <TCollection_AsciiString.hxx>
@@ -27,6 +28,8 @@ class Metal_Context;
 
 //! Texture font for Metal.
 //! Renders glyphs to a texture atlas for efficient text rendering.
+//! The atlas stores either glyph coverage at font pixel size,
+//! or signed distance field (see SetDistanceFieldSpread()) usable for any text size.
 class Metal_Font : public Metal_Resource
 {
   DEFINE_STANDARD_RTTIEXT(Metal_Font, Metal_Resource)
@@ -83,6 +86,14 @@ public:
   //! FreeType font instance should be already initialized!
   Standard_EXPORT bool Init(Metal_Context* theCtx);
 
+  //! Return spread of signed distance field in atlas pixels, or 0 for coverage atlas.
+  //! Distance field texels encode 0.5 at glyph edge, 1.0 at spread inside and 0.0 at spread outside.
+  int DistanceFieldSpread() const { return myDistFieldSpread; }
+
+  //! Set spread of signed distance field in pixels (0 for coverage atlas).
+  //! Should be called before Init().
+  void SetDistanceFieldSpread(int theSpread) { myDistFieldSpread = theSpread > 0 ? theSpread : 0; }
+
   //! Return vertical distance from baseline to highest character coordinate.
   float Ascender() const { return myAscender; }
 
@@ -115,6 +126,9 @@ protected:
   //! Allocate new texture.
   bool createTexture(Metal_Context* theCtx);
 
+  //! Convert coverage glyph image into signed distance field image expanded by spread on each side.
+  void computeDistanceField(const Image_PixMap& theGlyph, Image_PixMap& theField) const;
+
 protected:
 
   TCollection_AsciiString  myKey;        //!< key of shared resource
@@ -125,6 +139,8 @@ protected:
   int                      myLastTileId; //!< id of last tile
   RectI                    myLastTilePx; //!< position of last tile
   int                      myTextureFormat; //!< texture format
+  int                      myDistFieldSpread; //!< spread of signed distance field, 0 for coverage atlas
+  Image_PixMap             myDistFieldImg;  //!< temporary distance field image of last rendered glyph
 
   NCollection_Vector<occ::handle<Metal_Texture>> myTextures; //!< array of textures
   NCollection_Vector<Tile>                       myTiles;    //!< array of loaded tiles
@@ -21,6 +21,9 @@
 #include <Image_PixMap.hxx>
 #include <Standard_Assert.hxx>
 
+#include <algorithm>
+#include <cmath>
+
 IMPLEMENT_STANDARD_RTTIEXT(Metal_Font, Metal_Resource)
 
 // =======================================================================
@@ -35,7 +38,8 @@ Metal_Font::Metal_Font(const occ::handle<Font_FTFont>& theFont,
   myDescender(0.0f),
   myTileSizeY(0),
   myLastTileId(-1),
-  myTextureFormat(0)
+  myTextureFormat(0),
+  myDistFieldSpread(0)
 {
   memset(&myLastTilePx, 0, sizeof(myLastTilePx));
 }
@@ -139,10 +143,10 @@ bool Metal_Font::createTexture(Metal_Context* theCtx)
   // Limit single texture to circa 4096 glyphs.
   static const int THE_MAX_GLYPHS_PER_TEXTURE = 4096;
 
-  myTileSizeY = myFont->GlyphMaxSizeY(true);
+  myTileSizeY = myFont->GlyphMaxSizeY(true) + 2 * myDistFieldSpread;
   const int aGlyphsNb = std::min(THE_MAX_GLYPHS_PER_TEXTURE,
                                   myFont->GlyphsNumber(true) - myLastTileId + 1);
-  const int aMaxTileSizeX = myFont->GlyphMaxSizeX(true);
+  const int aMaxTileSizeX = myFont->GlyphMaxSizeX(true) + 2 * myDistFieldSpread;
   const int aMaxSize = theCtx->MaxTextureSize();
 
   // Calculate power of two texture sizes
@@ -182,6 +186,63 @@ bool Metal_Font::createTexture(Metal_Context* theCtx)
   return true;
 }
 
+// =======================================================================
+// function : computeDistanceField
+// purpose  : Convert coverage glyph image into signed distance field
+// =======================================================================
+void Metal_Font::computeDistanceField(const Image_PixMap& theGlyph, Image_PixMap& theField) const
+{
+  const int aSpread = myDistFieldSpread;
+  const int aSrcSizeX = (int)theGlyph.SizeX();
+  const int aSrcSizeY = (int)theGlyph.SizeY();
+  const int aSizeX = aSrcSizeX + 2 * aSpread;
+  const int aSizeY = aSrcSizeY + 2 * aSpread;
+  if (!theField.InitZero(Image_Format_Alpha, size_t(aSizeX), size_t(aSizeY)))
+  {
+    return;
+  }
+
+  // glyph pixel is considered inside when its coverage passes half
+  auto isInside = [&](int theX, int theY) -> bool
+  {
+    const int aSrcX = theX - aSpread;
+    const int aSrcY = theY - aSpread;
+    return aSrcX >= 0 && aSrcX < aSrcSizeX
+        && aSrcY >= 0 && aSrcY < aSrcSizeY
+        && theGlyph.Value<uint8_t>(size_t(aSrcY), size_t(aSrcX)) >= 128;
+  };
+
+  // brute-force search of the nearest texel of opposite state within spread window;
+  // done once per glyph at atlas reference size, so that simplicity wins over linear-time transforms
+  const int aSpreadSq = aSpread * aSpread;
+  for (int aY = 0; aY < aSizeY; ++aY)
+  {
+    for (int aX = 0; aX < aSizeX; ++aX)
+    {
+      const bool isIn = isInside(aX, aY);
+      int aMinDistSq = aSpreadSq;
+      for (int aDY = -aSpread; aDY <= aSpread; ++aDY)
+      {
+        for (int aDX = -aSpread; aDX <= aSpread; ++aDX)
+        {
+          const int aDistSq = aDX * aDX + aDY * aDY;
+          if (aDistSq < aMinDistSq
+           && isInside(aX + aDX, aY + aDY) != isIn)
+          {
+            aMinDistSq = aDistSq;
+          }
+        }
+      }
+
+      // edge lies half-way between texels of opposite state
+      const float aDist = std::max(std::sqrt(float(aMinDistSq)) - 0.5f, 0.0f);
+      const float aSigned = isIn ? aDist : -aDist;
+      const float aValue = std::min(std::max(0.5f + 0.5f * aSigned / float(aSpread), 0.0f), 1.0f);
+      theField.ChangeValue<uint8_t>(size_t(aY), size_t(aX)) = uint8_t(aValue * 255.0f + 0.5f);
+    }
+  }
+}
+
 // =======================================================================
 // function : renderGlyph
 // purpose  : Render new glyph to texture
@@ -204,7 +265,13 @@ bool Metal_Font::renderGlyph(Metal_Context* theCtx, const char32_t theChar)
     return false;
   }
 
-  const Image_PixMap& anImg = myFont->GlyphImage();
+  const Image_PixMap* anImgPtr = &myFont->GlyphImage();
+  if (myDistFieldSpread > 0)
+  {
+    computeDistanceField(*anImgPtr, myDistFieldImg);
+    anImgPtr = &myDistFieldImg;
+  }
+  const Image_PixMap& anImg = *anImgPtr;
   const int aTileId = myLastTileId + 1;
 
   myLastTilePx.Left = myLastTilePx.Right + 3;
@@ -212,7 +279,7 @@ bool Metal_Font::renderGlyph(Metal_Context* theCtx, const char32_t theChar)
 
   if (myLastTilePx.Right > aTexture->Width() || (int)anImg.SizeY() > myTileSizeY)
   {
-    myTileSizeY = myFont->GlyphMaxSizeY(true);
+    myTileSizeY = myFont->GlyphMaxSizeY(true) + 2 * myDistFieldSpread;
 
     myLastTilePx.Left = 0;
     myLastTilePx.Right = (int)anImg.SizeX();
@@ -241,6 +308,15 @@ bool Metal_Font::renderGlyph(Metal_Context* theCtx, const char32_t theChar)
   aTile.uv.Bottom = float(myLastTilePx.Top + anImg.SizeY()) / float(aTexture->Height());
   aTile.texture   = myTextures.Size() - 1;
   myFont->GlyphRect(aTile.px);
+  if (myDistFieldSpread > 0)
+  {
+    // distance field tile covers glyph bitmap with spread margins
+    const float aSpread = float(myDistFieldSpread);
+    aTile.px.Left   -= aSpread;
+    aTile.px.Right  += aSpread;
+    aTile.px.Top    += aSpread;
+    aTile.px.Bottom -= aSpread;
+  }
 
   myLastTileId = aTileId;
   myTiles.Append(aTile);
@@ -0,0 +1,109 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#ifndef Metal_FrameBudget_HeaderFile
+#define Metal_FrameBudget_HeaderFile
+
+#include <Standard.hxx>
+#include <Standard_DefineAlloc.hxx>
+
+//! Frame budget controller of progressive rendering of huge scenes (see Metal_View::SetProgressiveMode()).
+//!
+//! While the camera moves, frames are rendered in reduced quality (Phase_Interactive):
+//! structures with projected size below SizeThreshold() are skipped, and the threshold is adapted
+//! to the GPU time of the main pass of last completed frames, so that the frame fits into the budget.
+//! Once the camera stops, the image is refined over subsequent frames (Phase_Refine):
+//! the first frame redraws structures above the threshold at full resolution,
+//! the next ones add bands of smaller structures [SizeThreshold(), RefinedSize()) over the cached image,
+//! halving the threshold each frame, until the final frame of full quality (Phase_Full).
+class Metal_FrameBudget
+{
+public:
+  DEFINE_STANDARD_ALLOC
+
+  //! Quality of the frame.
+  enum Phase
+  {
+    Phase_Full,        //!< complete frame of full quality
+    Phase_Interactive, //!< camera is moving: reduced resolution, no small structures, shadows and transparency
+    Phase_Refine       //!< camera has stopped: image is being completed, still without shadows and transparency
+  };
+
+public:
+  //! Empty constructor; budget of 60 frames per second.
+  Standard_EXPORT Metal_FrameBudget();
+
+  //! Return GPU time budget of the main pass in seconds.
+  double Budget() const { return myBudget; }
+
+  //! Set GPU time budget of the main pass in seconds.
+  void SetBudget(double theSeconds) { myBudget = theSeconds > 0.0 ? theSeconds : myBudget; }
+
+  //! Return scale of render resolution applied to interactive frames; 0.5 by default.
+  float InteractiveResolutionScale() const { return myInteractiveScale; }
+
+  //! Set scale of render resolution applied to interactive frames, within [0.1, 1.0].
+  void SetInteractiveResolutionScale(float theScale)
+  {
+    myInteractiveScale = theScale < 0.1f ? 0.1f : (theScale > 1.0f ? 1.0f : theScale);
+  }
+
+  //! Return maximum size threshold in pixels; 128 by default.
+  double MaxSizeThreshold() const { return myMaxThreshold; }
+
+  //! Set maximum size threshold in pixels.
+  void SetMaxSizeThreshold(double thePixels) { myMaxThreshold = thePixels > 1.0 ? thePixels : 1.0; }
+
+  //! Choose the phase of the next frame.
+  //! @param theIsCameraMoved  camera has changed since the previous frame
+  //! @param theGpuMainPassTime GPU time of the main pass of last completed frames in seconds, 0 if unknown
+  //! @return phase of the next frame
+  Standard_EXPORT Phase NextFrame(bool theIsCameraMoved, double theGpuMainPassTime);
+
+  //! Return phase of the current frame.
+  Phase CurrentPhase() const { return myPhase; }
+
+  //! Return TRUE if the current frame is of full quality.
+  bool IsComplete() const { return myPhase == Phase_Full; }
+
+  //! Return TRUE if the current frame draws only structures of the band [SizeThreshold(), RefinedSize())
+  //! over the image of previous frame.
+  bool IsIncremental() const { return myPhase == Phase_Refine && myRefinedSize > 0.0; }
+
+  //! Return projected size in pixels below which structures are skipped by the current frame, 0 to draw all.
+  double SizeThreshold() const { return myThreshold; }
+
+  //! Return projected size in pixels of structures already drawn by previous frames of refinement,
+  //! 0 if the current frame is not incremental.
+  double RefinedSize() const { return myRefinedSize; }
+
+  //! Discard refinement in progress, so that the next frame is drawn in full quality
+  //! unless the camera moves.
+  void Reset()
+  {
+    myPhase       = Phase_Full;
+    myRefinedSize = 0.0;
+  }
+
+private:
+  double myBudget;           //!< GPU time budget of the main pass
+  double myMaxThreshold;     //!< maximum size threshold
+  double myAdaptedThreshold; //!< size threshold of interactive frames adapted to the budget
+  double myThreshold;        //!< size threshold of the current frame
+  double myRefinedSize;      //!< size threshold of structures already drawn
+  float  myInteractiveScale; //!< render resolution scale of interactive frames
+  Phase  myPhase;            //!< phase of the current frame
+};
+
+#endif // Metal_FrameBudget_HeaderFile
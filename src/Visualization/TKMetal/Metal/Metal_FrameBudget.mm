@@ -0,0 +1,100 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <Metal_FrameBudget.hxx>
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+  //! Limits of the change of size threshold per frame.
+  static const double THE_MIN_THRESHOLD_RATIO = 0.5;
+  static const double THE_MAX_THRESHOLD_RATIO = 2.0;
+}
+
+// =======================================================================
+// function : Metal_FrameBudget
+// purpose  : Constructor
+// =======================================================================
+Metal_FrameBudget::Metal_FrameBudget()
+: myBudget(1.0 / 60.0),
+  myMaxThreshold(128.0),
+  myAdaptedThreshold(0.0),
+  myThreshold(0.0),
+  myRefinedSize(0.0),
+  myInteractiveScale(0.5f),
+  myPhase(Phase_Full)
+{
+  //
+}
+
+// =======================================================================
+// function : NextFrame
+// purpose  : Choose the phase of the next frame
+// =======================================================================
+Metal_FrameBudget::Phase Metal_FrameBudget::NextFrame(bool theIsCameraMoved, double theGpuMainPassTime)
+{
+  if (theIsCameraMoved)
+  {
+    // projected area of skipped structures is proportional to the square of the threshold,
+    // so that the threshold is scaled by square root of the ratio of measured time to the budget
+    if (theGpuMainPassTime > 0.0)
+    {
+      const double aRatio = std::max(std::min(std::sqrt(theGpuMainPassTime / myBudget), THE_MAX_THRESHOLD_RATIO),
+                                     THE_MIN_THRESHOLD_RATIO);
+      myAdaptedThreshold = std::min(std::max(myAdaptedThreshold, 1.0) * aRatio, myMaxThreshold);
+      if (myAdaptedThreshold < 1.0)
+      {
+        myAdaptedThreshold = 0.0;
+      }
+    }
+    myThreshold   = myAdaptedThreshold;
+    myRefinedSize = 0.0;
+    myPhase       = Phase_Interactive;
+    return myPhase;
+  }
+
+  switch (myPhase)
+  {
+    case Phase_Interactive:
+    {
+      // redraw structures above the threshold at full resolution, or complete the image at once
+      // when nothing has been skipped
+      myRefinedSize = 0.0;
+      myPhase       = myThreshold > 0.0 ? Phase_Refine : Phase_Full;
+      break;
+    }
+    case Phase_Refine:
+    {
+      if (myThreshold <= 0.0)
+      {
+        // all structures are drawn, the final frame adds shadows and transparency
+        myRefinedSize = 0.0;
+        myPhase       = Phase_Full;
+        break;
+      }
+      myRefinedSize = myThreshold;
+      myThreshold   = myThreshold * 0.5 < 1.0 ? 0.0 : myThreshold * 0.5;
+      break;
+    }
+    case Phase_Full:
+    {
+      myThreshold   = 0.0;
+      myRefinedSize = 0.0;
+      break;
+    }
+  }
+  return myPhase;
+}
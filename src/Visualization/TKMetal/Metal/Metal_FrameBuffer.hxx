@@ -63,6 +63,11 @@ public:
   //! Return number of MSAA samples.
   int NbSamples() const { return myNbSamples; }
 
+  //! Return true if MSAA attachments are kept in tile memory only (see Metal_Caps::useMemorylessAttachments).
+  //! Such attachments are never stored; a render pass loading them makes the next (re-)initialization
+  //! allocate them in private memory instead.
+  bool IsMemorylessMsaa() const { return myIsMemorylessMsaa; }
+
   //! Return number of color attachments.
   int NbColorBuffers() const { return myColorTextures.Length(); }
 
@@ -250,7 +255,8 @@ protected:
                                       int theWidth, int theHeight,
                                       Metal_PixelFormat theFormat,
                                       int theNbSamples,
-                                      bool theIsRenderTarget);
+                                      bool theIsRenderTarget,
+                                      bool theIsMemoryless = false);
 
 protected:
 
@@ -261,6 +267,8 @@ protected:
   int myVPSizeY;                              //!< viewport height
   int myNbSamples;                            //!< MSAA samples
   bool myIsValid;                             //!< validity flag
+  bool myIsMemorylessMsaa;                    //!< MSAA attachments are memoryless
+  bool myToKeepMsaa;                          //!< MSAA content has been loaded by a pass and should be stored
 
   NCollection_Vector<Metal_PixelFormat> myColorFormats;  //!< color attachment formats
   Metal_PixelFormat myDepthFormat;                       //!< depth attachment format
@@ -78,6 +78,8 @@ Metal_FrameBuffer::Metal_FrameBuffer(const TCollection_AsciiString& theResourceI
   myVPSizeY(0),
   myNbSamples(0),
   myIsValid(false),
+  myIsMemorylessMsaa(false),
+  myToKeepMsaa(false),
   myDepthFormat(Metal_PixelFormat_Unknown)
 {
   //
@@ -110,6 +112,7 @@ void Metal_FrameBuffer::Release(Metal_Context* /*theCtx*/)
   myVPSizeY = 0;
   myNbSamples = 0;
   myIsValid = false;
+  myIsMemorylessMsaa = false;
 }
 
 // =======================================================================
@@ -160,6 +163,12 @@ bool Metal_FrameBuffer::Init(Metal_Context* theCtx,
   myColorFormats = theColorFormats;
   myDepthFormat = theDepthFormat;
 
+  // MSAA samples are resolved at the end of the pass and never read later, unless a pass has loaded them
+  myIsMemorylessMsaa = myNbSamples > 1
+                    && !myToKeepMsaa
+                    && theCtx->Caps()->useMemorylessAttachments
+                    && theCtx->HasMemorylessRenderTargets();
+
   // Create color attachments
   for (int i = 0; i < theColorFormats.Length(); ++i)
   {
@@ -182,7 +191,7 @@ bool Metal_FrameBuffer::Init(Metal_Context* theCtx,
     if (myNbSamples > 1)
     {
       occ::handle<Metal_Texture> aColorTexMSAA;
-      if (!createTexture(theCtx, aColorTexMSAA, mySizeX, mySizeY, aFormat, myNbSamples, true))
+      if (!createTexture(theCtx, aColorTexMSAA, mySizeX, mySizeY, aFormat, myNbSamples, true, myIsMemorylessMsaa))
       {
         Release(theCtx);
         return false;
@@ -204,7 +213,8 @@ bool Metal_FrameBuffer::Init(Metal_Context* theCtx,
     // Create MSAA depth texture if needed
     if (myNbSamples > 1)
     {
-      if (!createTexture(theCtx, myDepthStencilTextureMSAA, mySizeX, mySizeY, theDepthFormat, myNbSamples, true))
+      if (!createTexture(theCtx, myDepthStencilTextureMSAA, mySizeX, mySizeY, theDepthFormat, myNbSamples, true,
+                         myIsMemorylessMsaa))
       {
         Release(theCtx);
         return false;
@@ -233,7 +243,8 @@ bool Metal_FrameBuffer::InitLazy(Metal_Context* theCtx,
    && myNbSamples == ((theNbSamples <= 1) ? 0 : theNbSamples)
    && myDepthFormat == theDepthFormat
    && myColorFormats.Length() == 1
-   && myColorFormats.Value(0) == theColorFormat)
+   && myColorFormats.Value(0) == theColorFormat
+   && !(myIsMemorylessMsaa && myToKeepMsaa))
   {
     return true;
   }
@@ -261,7 +272,8 @@ bool Metal_FrameBuffer::createTexture(Metal_Context* theCtx,
                                         int theWidth, int theHeight,
                                         Metal_PixelFormat theFormat,
                                         int theNbSamples,
-                                        bool theIsRenderTarget)
+                                        bool theIsRenderTarget,
+                                        bool theIsMemoryless)
 {
   if (theCtx == nullptr || theCtx->Device() == nil)
   {
@@ -291,7 +303,16 @@ bool Metal_FrameBuffer::createTexture(Metal_Context* theCtx,
     aDesc.sampleCount = 1;
   }
 
-  if (theIsRenderTarget)
+  if (theIsMemoryless)
+  {
+    if (@available(macOS 11.0, iOS 10.0, *))
+    {
+      // lives in tile memory during the pass only
+      aDesc.storageMode = MTLStorageModeMemoryless;
+    }
+    aDesc.usage = MTLTextureUsageRenderTarget;
+  }
+  else if (theIsRenderTarget)
   {
     aDesc.usage = MTLTextureUsageRenderTarget | MTLTextureUsageShaderRead;
   }
@@ -333,7 +354,7 @@ size_t Metal_FrameBuffer::EstimatedDataSize() const
     aSize += mySizeX * mySizeY * aBpp;
 
     // MSAA textures
-    if (myNbSamples > 1)
+    if (myNbSamples > 1 && !myIsMemorylessMsaa)
     {
       aSize += mySizeX * mySizeY * aBpp * myNbSamples;
     }
@@ -345,7 +366,7 @@ size_t Metal_FrameBuffer::EstimatedDataSize() const
     int aBpp = bytesPerPixel(myDepthFormat);
     aSize += mySizeX * mySizeY * aBpp;
 
-    if (myNbSamples > 1)
+    if (myNbSamples > 1 && !myIsMemorylessMsaa)
     {
       aSize += mySizeX * mySizeY * aBpp * myNbSamples;
     }
@@ -368,6 +389,16 @@ MTLRenderPassDescriptor* Metal_FrameBuffer::RenderPassDescriptor(bool theToClear
   }
 
   MTLRenderPassDescriptor* aDesc = [MTLRenderPassDescriptor renderPassDescriptor];
+  if (!theToClear && myNbSamples > 1)
+  {
+    // MSAA content is loaded by this pass, so that it should be stored by passes from now on;
+    // memoryless attachments have lost their content and are re-allocated by next InitLazy()
+    myToKeepMsaa = true;
+  }
+  const MTLStoreAction aMsaaStoreAction = myToKeepMsaa && !myIsMemorylessMsaa
+                                        ? MTLStoreActionStoreAndMultisampleResolve
+                                        : MTLStoreActionMultisampleResolve;
+  const MTLLoadAction aMsaaLoadAction = myIsMemorylessMsaa ? MTLLoadActionDontCare : MTLLoadActionLoad;
 
   // Setup color attachments
   for (int i = 0; i < myColorTextures.Length(); ++i)
@@ -379,7 +410,7 @@ MTLRenderPassDescriptor* Metal_FrameBuffer::RenderPassDescriptor(bool theToClear
       // MSAA: render to MSAA texture, resolve to non-MSAA
       aColorAttach.texture = myColorTexturesMSAA.Value(i)->Texture();
       aColorAttach.resolveTexture = myColorTextures.Value(i)->Texture();
-      aColorAttach.storeAction = MTLStoreActionMultisampleResolve;
+      aColorAttach.storeAction = aMsaaStoreAction;
     }
     else
     {
@@ -404,7 +435,7 @@ MTLRenderPassDescriptor* Metal_FrameBuffer::RenderPassDescriptor(bool theToClear
     }
     else
     {
-      aColorAttach.loadAction = MTLLoadActionLoad;
+      aColorAttach.loadAction = myNbSamples > 1 ? aMsaaLoadAction : MTLLoadActionLoad;
     }
   }
 
@@ -417,7 +448,7 @@ MTLRenderPassDescriptor* Metal_FrameBuffer::RenderPassDescriptor(bool theToClear
     {
       aDepthAttach.texture = myDepthStencilTextureMSAA->Texture();
       aDepthAttach.resolveTexture = myDepthStencilTexture->Texture();
-      aDepthAttach.storeAction = MTLStoreActionMultisampleResolve;
+      aDepthAttach.storeAction = aMsaaStoreAction;
     }
     else
     {
@@ -432,7 +463,7 @@ MTLRenderPassDescriptor* Metal_FrameBuffer::RenderPassDescriptor(bool theToClear
     }
     else
     {
-      aDepthAttach.loadAction = MTLLoadActionLoad;
+      aDepthAttach.loadAction = myNbSamples > 1 ? aMsaaLoadAction : MTLLoadActionLoad;
     }
 
     // Setup stencil if format includes it
@@ -444,7 +475,7 @@ MTLRenderPassDescriptor* Metal_FrameBuffer::RenderPassDescriptor(bool theToClear
       {
         aStencilAttach.texture = myDepthStencilTextureMSAA->Texture();
         aStencilAttach.resolveTexture = myDepthStencilTexture->Texture();
-        aStencilAttach.storeAction = MTLStoreActionMultisampleResolve;
+        aStencilAttach.storeAction = aMsaaStoreAction;
       }
       else
       {
@@ -459,7 +490,7 @@ MTLRenderPassDescriptor* Metal_FrameBuffer::RenderPassDescriptor(bool theToClear
       }
       else
       {
-        aStencilAttach.loadAction = MTLLoadActionLoad;
+        aStencilAttach.loadAction = myNbSamples > 1 ? aMsaaLoadAction : MTLLoadActionLoad;
       }
     }
   }
@@ -0,0 +1,177 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef Metal_FrameCapture_HeaderFile
+#define Metal_FrameCapture_HeaderFile
+
+#include <Image_PixMap.hxx>
+#include <Standard_Transient.hxx>
+#include <Standard_Type.hxx>
+
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+#ifdef __OBJC__
+@protocol MTLCommandBuffer;
+@protocol MTLBuffer;
+@protocol MTLTexture;
+#endif
+
+class Image_VideoRecorder;
+class Metal_Context;
+
+//! Streaming capture of rendered frames.
+//! Capture() encodes a copy of the frame into a ring of readback slots within command buffer of the frame itself,
+//! so that the render loop is not stalled; Poll() delivers completed frames in submission order
+//! to the listener and/or to Image_VideoRecorder.
+//! BGRA frames are copied into IOSurface-backed CVPixelBuffer (zero-copy path), which is passed to the listener
+//! for encoding by VideoToolbox; other formats are copied into shared buffers.
+//! When all slots are pending, Capture() either waits for the oldest frame (default, no frames are lost)
+//! or drops the new frame (see SetWaitWhenFull()).
+class Metal_FrameCapture : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(Metal_FrameCapture, Standard_Transient)
+public:
+
+  //! Receiver of captured frames.
+  class Listener : public Standard_Transient
+  {
+    DEFINE_STANDARD_RTTI_INLINE(Metal_FrameCapture::Listener, Standard_Transient)
+  public:
+    //! Called for each captured frame in submission order from the thread calling Poll() or Flush().
+    //! @param theImage       frame image (top-down), wrapping readback memory valid only within the call
+    //! @param theFrameId     sequential index of captured frame
+    //! @param thePixelBuffer CVPixelBufferRef holding the frame within zero-copy path, or NULL
+    virtual void OnFrame(const Image_PixMap& theImage, int64_t theFrameId, void* thePixelBuffer) = 0;
+  };
+
+public:
+
+  //! Empty constructor.
+  Standard_EXPORT Metal_FrameCapture();
+
+  //! Destructor.
+  Standard_EXPORT ~Metal_FrameCapture() override;
+
+  //! Initialize the ring of readback slots.
+  //! @param theCtx               Metal context
+  //! @param theNbSlots           number of readback slots (frames in flight of capture)
+  //! @param theToUsePixelBuffers use IOSurface-backed CVPixelBuffer slots for BGRA frames
+  Standard_EXPORT bool Init(Metal_Context* theCtx, int theNbSlots = 3, bool theToUsePixelBuffers = true);
+
+  //! Wait for pending frames (without delivering them) and release slots.
+  Standard_EXPORT void Release();
+
+  //! Return TRUE if capture has been initialized.
+  bool IsValid() const { return !mySlots.empty(); }
+
+  //! Return listener receiving frames.
+  const occ::handle<Listener>& FrameListener() const { return myListener; }
+
+  //! Set listener receiving frames.
+  void SetFrameListener(const occ::handle<Listener>& theListener) { myListener = theListener; }
+
+  //! Return video recorder receiving frames.
+  const occ::handle<Image_VideoRecorder>& VideoRecorder() const { return myRecorder; }
+
+  //! Set opened video recorder receiving frames; frames of size different to recorder frame are skipped.
+  void SetVideoRecorder(const occ::handle<Image_VideoRecorder>& theRecorder) { myRecorder = theRecorder; }
+
+  //! Return TRUE if Capture() waits for the oldest pending frame when all slots are busy; TRUE by default.
+  bool ToWaitWhenFull() const { return myToWaitWhenFull; }
+
+  //! Set if Capture() should wait for the oldest pending frame or drop the new frame when all slots are busy.
+  void SetWaitWhenFull(bool theToWait) { myToWaitWhenFull = theToWait; }
+
+  //! Return number of captured frames.
+  int64_t NbCaptured() const { return myNbCaptured; }
+
+  //! Return number of frames dropped due to busy slots.
+  int64_t NbDropped() const { return myNbDropped; }
+
+  //! Return number of frames waiting for delivery.
+  int NbPending() const { return (int)myQueue.size(); }
+
+#ifdef __OBJC__
+  //! Encode copy of the texture into the command buffer; should be called before the command buffer is committed.
+  //! @param theCmdBuffer command buffer rendering into the texture
+  //! @param theSource    texture to capture (e.g. drawable texture)
+  //! @return FALSE if frame has been dropped
+  Standard_EXPORT bool Capture(id<MTLCommandBuffer> theCmdBuffer, id<MTLTexture> theSource);
+#endif
+
+  //! Deliver completed frames without blocking.
+  //! @return number of delivered frames
+  Standard_EXPORT int Poll();
+
+  //! Wait for all pending frames and deliver them.
+  //! @return number of delivered frames
+  Standard_EXPORT int Flush();
+
+protected:
+
+  //! Readback slot.
+  struct Slot
+  {
+#ifdef __OBJC__
+    id<MTLCommandBuffer> CommandBuffer; //!< command buffer copying the frame
+    id<MTLBuffer>        Buffer;        //!< shared readback buffer (buffer path)
+    id<MTLTexture>       Texture;       //!< texture wrapping pixel buffer (zero-copy path)
+#else
+    void* CommandBuffer;
+    void* Buffer;
+    void* Texture;
+#endif
+    void*        PixelBuffer;   //!< CVPixelBufferRef (zero-copy path)
+    void*        MetalTexture;  //!< CVMetalTextureRef keeping Texture alive (zero-copy path)
+    Image_Format Format;        //!< image format of the slot
+    int          SizeX;         //!< frame width
+    int          SizeY;         //!< frame height
+    size_t       RowBytes;      //!< bytes per row of readback memory
+    int64_t      FrameId;       //!< index of captured frame
+
+    Slot() : CommandBuffer(nullptr), Buffer(nullptr), Texture(nullptr), PixelBuffer(nullptr), MetalTexture(nullptr),
+             Format(Image_Format_UNKNOWN), SizeX(0), SizeY(0), RowBytes(0), FrameId(-1) {}
+  };
+
+  //! (Re-)allocate readback memory of the slot for specified frame.
+  Standard_EXPORT bool initSlot(Slot& theSlot, int theSizeX, int theSizeY, int thePixelFormat);
+
+  //! Release readback memory of the slot.
+  Standard_EXPORT void releaseSlot(Slot& theSlot);
+
+  //! Deliver the frame of completed slot to receivers and mark slot free.
+  Standard_EXPORT void deliver(Slot& theSlot);
+
+  //! Return TRUE if command buffer of the slot has been completed.
+  Standard_EXPORT static bool isCompleted(const Slot& theSlot);
+
+  //! Wait for command buffer of the slot.
+  Standard_EXPORT static void waitCompleted(const Slot& theSlot);
+
+protected:
+
+  Metal_Context*                   myContext;            //!< context creating resources
+  occ::handle<Listener>            myListener;           //!< listener receiving frames
+  occ::handle<Image_VideoRecorder> myRecorder;           //!< video recorder receiving frames
+  std::vector<Slot>                mySlots;              //!< readback slots
+  std::deque<int>                  myQueue;              //!< indices of pending slots in submission order
+  void*                            myTextureCache;       //!< CVMetalTextureCacheRef of zero-copy path
+  int64_t                          myNbCaptured;         //!< number of captured frames
+  int64_t                          myNbDropped;          //!< number of dropped frames
+  bool                             myToUsePixelBuffers;  //!< use zero-copy path for BGRA frames
+  bool                             myToWaitWhenFull;     //!< wait for oldest frame instead of dropping
+};
+
+#endif // Metal_FrameCapture_HeaderFile
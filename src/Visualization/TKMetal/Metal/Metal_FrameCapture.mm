@@ -0,0 +1,434 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+#import <Metal/Metal.h>
+#import <CoreVideo/CoreVideo.h>
+
+#include <Metal_FrameCapture.hxx>
+#include <Metal_Context.hxx>
+
+#include <Image_VideoRecorder.hxx>
+#include <Message_Messenger.hxx>
+
+#include <cstring>
+
+IMPLEMENT_STANDARD_RTTIEXT(Metal_FrameCapture, Standard_Transient)
+
+// =======================================================================
+// function : Metal_FrameCapture
+// purpose  :
+// =======================================================================
+Metal_FrameCapture::Metal_FrameCapture()
+: myContext(nullptr),
+  myTextureCache(nullptr),
+  myNbCaptured(0),
+  myNbDropped(0),
+  myToUsePixelBuffers(true),
+  myToWaitWhenFull(true)
+{
+  //
+}
+
+// =======================================================================
+// function : ~Metal_FrameCapture
+// purpose  :
+// =======================================================================
+Metal_FrameCapture::~Metal_FrameCapture()
+{
+  Release();
+}
+
+// =======================================================================
+// function : Init
+// purpose  :
+// =======================================================================
+bool Metal_FrameCapture::Init(Metal_Context* theCtx, int theNbSlots, bool theToUsePixelBuffers)
+{
+  Release();
+  if (theCtx == nullptr || theCtx->Device() == nil || theNbSlots < 1)
+  {
+    return false;
+  }
+
+  myContext = theCtx;
+  myToUsePixelBuffers = theToUsePixelBuffers;
+  if (myToUsePixelBuffers)
+  {
+    CVMetalTextureCacheRef aCache = nullptr;
+    if (CVMetalTextureCacheCreate(kCFAllocatorDefault, nullptr, theCtx->Device(), nullptr, &aCache) == kCVReturnSuccess)
+    {
+      myTextureCache = aCache;
+    }
+    else
+    {
+      theCtx->Messenger()->SendWarning() << "Metal_FrameCapture: unable to create CVMetalTextureCache, frames are copied into buffers";
+      myToUsePixelBuffers = false;
+    }
+  }
+
+  mySlots.resize(size_t(theNbSlots));
+  return true;
+}
+
+// =======================================================================
+// function : Release
+// purpose  :
+// =======================================================================
+void Metal_FrameCapture::Release()
+{
+  for (Slot& aSlot : mySlots)
+  {
+    waitCompleted(aSlot);
+    releaseSlot(aSlot);
+  }
+  mySlots.clear();
+  myQueue.clear();
+  if (myTextureCache != nullptr)
+  {
+    CFRelease((CVMetalTextureCacheRef)myTextureCache);
+    myTextureCache = nullptr;
+  }
+  myContext = nullptr;
+}
+
+// =======================================================================
+// function : isCompleted
+// purpose  :
+// =======================================================================
+bool Metal_FrameCapture::isCompleted(const Slot& theSlot)
+{
+  if (theSlot.CommandBuffer == nil)
+  {
+    return true;
+  }
+
+  const MTLCommandBufferStatus aStatus = [theSlot.CommandBuffer status];
+  return aStatus == MTLCommandBufferStatusCompleted
+      || aStatus == MTLCommandBufferStatusError;
+}
+
+// =======================================================================
+// function : waitCompleted
+// purpose  :
+// =======================================================================
+void Metal_FrameCapture::waitCompleted(const Slot& theSlot)
+{
+  if (theSlot.CommandBuffer != nil
+   && [theSlot.CommandBuffer status] >= MTLCommandBufferStatusCommitted)
+  {
+    [theSlot.CommandBuffer waitUntilCompleted];
+  }
+}
+
+// =======================================================================
+// function : releaseSlot
+// purpose  :
+// =======================================================================
+void Metal_FrameCapture::releaseSlot(Slot& theSlot)
+{
+  theSlot.CommandBuffer = nil;
+  theSlot.Buffer = nil;
+  theSlot.Texture = nil;
+  if (theSlot.MetalTexture != nullptr)
+  {
+    CFRelease((CVMetalTextureRef)theSlot.MetalTexture);
+    theSlot.MetalTexture = nullptr;
+  }
+  if (theSlot.PixelBuffer != nullptr)
+  {
+    CVPixelBufferRelease((CVPixelBufferRef)theSlot.PixelBuffer);
+    theSlot.PixelBuffer = nullptr;
+  }
+  theSlot.Format = Image_Format_UNKNOWN;
+  theSlot.SizeX = 0;
+  theSlot.SizeY = 0;
+  theSlot.RowBytes = 0;
+  theSlot.FrameId = -1;
+}
+
+// =======================================================================
+// function : initSlot
+// purpose  :
+// =======================================================================
+bool Metal_FrameCapture::initSlot(Slot& theSlot, int theSizeX, int theSizeY, int thePixelFormat)
+{
+  const MTLPixelFormat aPixelFormat = (MTLPixelFormat)thePixelFormat;
+  Image_Format anImgFormat = Image_Format_UNKNOWN;
+  size_t aPixelBytes = 0;
+  switch (aPixelFormat)
+  {
+    case MTLPixelFormatBGRA8Unorm:
+    case MTLPixelFormatBGRA8Unorm_sRGB: anImgFormat = Image_Format_BGRA;   aPixelBytes = 4;  break;
+    case MTLPixelFormatRGBA8Unorm:
+    case MTLPixelFormatRGBA8Unorm_sRGB: anImgFormat = Image_Format_RGBA;   aPixelBytes = 4;  break;
+    case MTLPixelFormatRGBA32Float:     anImgFormat = Image_Format_RGBAF;  aPixelBytes = 16; break;
+    default: break;
+  }
+  if (anImgFormat == Image_Format_UNKNOWN)
+  {
+    return false;
+  }
+
+  const bool toUsePixelBuffer = myToUsePixelBuffers && anImgFormat == Image_Format_BGRA;
+  if (theSlot.SizeX == theSizeX
+   && theSlot.SizeY == theSizeY
+   && theSlot.Format == anImgFormat
+   && (theSlot.PixelBuffer != nullptr) == toUsePixelBuffer
+   && (toUsePixelBuffer || theSlot.Buffer.length >= theSlot.RowBytes * size_t(theSizeY)))
+  {
+    return true;
+  }
+
+  releaseSlot(theSlot);
+  if (toUsePixelBuffer)
+  {
+    // IOSurface-backed pixel buffer shared by Metal texture and CPU / VideoToolbox
+    NSDictionary* anAttribs = @{ (__bridge NSString*)kCVPixelBufferMetalCompatibilityKey : @YES,
+                                 (__bridge NSString*)kCVPixelBufferIOSurfacePropertiesKey : @{} };
+    CVPixelBufferRef aPixelBuffer = nullptr;
+    if (CVPixelBufferCreate(kCFAllocatorDefault, size_t(theSizeX), size_t(theSizeY), kCVPixelFormatType_32BGRA,
+                            (__bridge CFDictionaryRef)anAttribs, &aPixelBuffer) != kCVReturnSuccess)
+    {
+      return false;
+    }
+
+    CVMetalTextureRef aMetalTexture = nullptr;
+    if (CVMetalTextureCacheCreateTextureFromImage(kCFAllocatorDefault, (CVMetalTextureCacheRef)myTextureCache,
+                                                  aPixelBuffer, nullptr, aPixelFormat,
+                                                  size_t(theSizeX), size_t(theSizeY), 0,
+                                                  &aMetalTexture) != kCVReturnSuccess)
+    {
+      CVPixelBufferRelease(aPixelBuffer);
+      return false;
+    }
+
+    theSlot.PixelBuffer  = aPixelBuffer;
+    theSlot.MetalTexture = aMetalTexture;
+    theSlot.Texture      = CVMetalTextureGetTexture(aMetalTexture);
+    theSlot.RowBytes     = CVPixelBufferGetBytesPerRow(aPixelBuffer);
+  }
+  else
+  {
+    theSlot.RowBytes = aPixelBytes * size_t(theSizeX);
+    theSlot.Buffer = [myContext->Device() newBufferWithLength:theSlot.RowBytes * size_t(theSizeY)
+                                                      options:MTLResourceStorageModeShared];
+    if (theSlot.Buffer == nil)
+    {
+      return false;
+    }
+  }
+
+  theSlot.Format = anImgFormat;
+  theSlot.SizeX  = theSizeX;
+  theSlot.SizeY  = theSizeY;
+  return true;
+}
+
+// =======================================================================
+// function : Capture
+// purpose  :
+// =======================================================================
+bool Metal_FrameCapture::Capture(id<MTLCommandBuffer> theCmdBuffer, id<MTLTexture> theSource)
+{
+  if (mySlots.empty() || theCmdBuffer == nil || theSource == nil)
+  {
+    return false;
+  }
+
+  // deliver what is ready, then wait for the oldest frame or drop the new one when all slots are busy
+  Poll();
+  if (myQueue.size() >= mySlots.size())
+  {
+    if (!myToWaitWhenFull)
+    {
+      ++myNbDropped;
+      return false;
+    }
+
+    Slot& anOldest = mySlots[size_t(myQueue.front())];
+    waitCompleted(anOldest);
+    myQueue.pop_front();
+    deliver(anOldest);
+  }
+
+  // find free slot
+  int aSlotIndex = -1;
+  for (size_t aSlotIter = 0; aSlotIter < mySlots.size(); ++aSlotIter)
+  {
+    if (mySlots[aSlotIter].CommandBuffer == nil)
+    {
+      aSlotIndex = (int)aSlotIter;
+      break;
+    }
+  }
+  if (aSlotIndex < 0)
+  {
+    ++myNbDropped;
+    return false;
+  }
+
+  Slot& aSlot = mySlots[size_t(aSlotIndex)];
+  const int aSizeX = (int)theSource.width;
+  const int aSizeY = (int)theSource.height;
+  if (!initSlot(aSlot, aSizeX, aSizeY, (int)theSource.pixelFormat))
+  {
+    myContext->Messenger()->SendWarning() << "Metal_FrameCapture: unsupported frame format or readback allocation failure";
+    ++myNbDropped;
+    return false;
+  }
+
+  id<MTLBlitCommandEncoder> aBlit = [theCmdBuffer blitCommandEncoder];
+  if (aBlit == nil)
+  {
+    ++myNbDropped;
+    return false;
+  }
+  aBlit.label = @"FrameCapture";
+  if (aSlot.Texture != nil)
+  {
+    [aBlit copyFromTexture:theSource toTexture:aSlot.Texture];
+  }
+  else
+  {
+    [aBlit copyFromTexture:theSource
+               sourceSlice:0
+               sourceLevel:0
+              sourceOrigin:MTLOriginMake(0, 0, 0)
+                sourceSize:MTLSizeMake(size_t(aSizeX), size_t(aSizeY), 1)
+                  toBuffer:aSlot.Buffer
+         destinationOffset:0
+    destinationBytesPerRow:aSlot.RowBytes
+  destinationBytesPerImage:aSlot.RowBytes * size_t(aSizeY)];
+  }
+  [aBlit endEncoding];
+
+  aSlot.CommandBuffer = theCmdBuffer;
+  aSlot.FrameId = myNbCaptured++;
+  myQueue.push_back(aSlotIndex);
+  return true;
+}
+
+// =======================================================================
+// function : Poll
+// purpose  :
+// =======================================================================
+int Metal_FrameCapture::Poll()
+{
+  int aNbDelivered = 0;
+  while (!myQueue.empty())
+  {
+    Slot& aSlot = mySlots[size_t(myQueue.front())];
+    if (!isCompleted(aSlot))
+    {
+      break;
+    }
+
+    myQueue.pop_front();
+    deliver(aSlot);
+    ++aNbDelivered;
+  }
+  return aNbDelivered;
+}
+
+// =======================================================================
+// function : Flush
+// purpose  :
+// =======================================================================
+int Metal_FrameCapture::Flush()
+{
+  int aNbDelivered = 0;
+  while (!myQueue.empty())
+  {
+    Slot& aSlot = mySlots[size_t(myQueue.front())];
+    waitCompleted(aSlot);
+    myQueue.pop_front();
+    deliver(aSlot);
+    ++aNbDelivered;
+  }
+  return aNbDelivered;
+}
+
+// =======================================================================
+// function : deliver
+// purpose  :
+// =======================================================================
+void Metal_FrameCapture::deliver(Slot& theSlot)
+{
+  const bool isFailed = theSlot.CommandBuffer == nil
+                     || [theSlot.CommandBuffer status] != MTLCommandBufferStatusCompleted;
+  theSlot.CommandBuffer = nil;
+  if (isFailed)
+  {
+    ++myNbDropped;
+    return;
+  }
+
+  CVPixelBufferRef aPixelBuffer = (CVPixelBufferRef)theSlot.PixelBuffer;
+  uint8_t* aData = nullptr;
+  if (aPixelBuffer != nullptr)
+  {
+    CVPixelBufferLockBaseAddress(aPixelBuffer, kCVPixelBufferLock_ReadOnly);
+    aData = (uint8_t*)CVPixelBufferGetBaseAddress(aPixelBuffer);
+  }
+  else
+  {
+    aData = (uint8_t*)theSlot.Buffer.contents;
+  }
+
+  Image_PixMap anImage;
+  if (aData != nullptr
+   && anImage.InitWrapper(theSlot.Format, aData, size_t(theSlot.SizeX), size_t(theSlot.SizeY), theSlot.RowBytes))
+  {
+    anImage.SetTopDown(true);
+    if (!myListener.IsNull())
+    {
+      myListener->OnFrame(anImage, theSlot.FrameId, aPixelBuffer);
+    }
+
+    if (!myRecorder.IsNull())
+    {
+      // recorder frame is RGBA of the size defined by Image_VideoRecorder::Open()
+      Image_PixMap& aFrame = myRecorder->ChangeFrame();
+      if (aFrame.SizeX() == anImage.SizeX()
+       && aFrame.SizeY() == anImage.SizeY()
+       && aFrame.Format() == Image_Format_RGBA
+       && (anImage.Format() == Image_Format_RGBA || anImage.Format() == Image_Format_BGRA))
+      {
+        const bool toSwapRB = anImage.Format() == Image_Format_BGRA;
+        for (size_t aRow = 0; aRow < anImage.SizeY(); ++aRow)
+        {
+          // both images are addressed top-down by Image_PixMap::Row()
+          const uint8_t* aSrcRow = anImage.Row(aRow);
+          uint8_t* aDstRow = aFrame.ChangeRow(aRow);
+          if (!toSwapRB)
+          {
+            memcpy(aDstRow, aSrcRow, anImage.SizeX() * 4);
+            continue;
+          }
+          for (size_t aCol = 0; aCol < anImage.SizeX(); ++aCol)
+          {
+            aDstRow[aCol * 4 + 0] = aSrcRow[aCol * 4 + 2];
+            aDstRow[aCol * 4 + 1] = aSrcRow[aCol * 4 + 1];
+            aDstRow[aCol * 4 + 2] = aSrcRow[aCol * 4 + 0];
+            aDstRow[aCol * 4 + 3] = aSrcRow[aCol * 4 + 3];
+          }
+        }
+        myRecorder->PushFrame();
+      }
+    }
+  }
+
+  if (aPixelBuffer != nullptr)
+  {
+    CVPixelBufferUnlockBaseAddress(aPixelBuffer, kCVPixelBufferLock_ReadOnly);
+  }
+}
@@ -17,6 +17,9 @@
 #include <Graphic3d_FrameStats.hxx>
 #include <OSD_Timer.hxx>
 
+#include <algorithm>
+#include <atomic>
+
 class Metal_View;
 
 //! Frame statistics for Metal backend.
@@ -92,6 +95,106 @@ public: //! @name Draw call statistics
     myPointsCount += thePoints;
   }
 
+public: //! @name State sorting statistics (see Metal_DrawList)
+
+  //! Return number of draws submitted by sorted draw lists in last frame.
+  int NbSortedDraws() const { return myNbSortedDraws; }
+
+  //! Return number of state changes of sorted draws in last frame.
+  int NbStateChanges() const { return myNbStateChanges; }
+
+  //! Return number of state changes the same draws would make in insertion order.
+  int NbStateChangesUnsorted() const { return myNbStateChangesUnsorted; }
+
+  //! Return number of state changes saved by sorting in last frame.
+  int NbStateChangesSaved() const { return myNbStateChangesUnsorted - myNbStateChanges; }
+
+  //! Reset state sorting statistics for new frame.
+  void ResetStateChanges()
+  {
+    myNbSortedDraws = 0;
+    myNbStateChanges = 0;
+    myNbStateChangesUnsorted = 0;
+  }
+
+  //! Add statistics of submitted draw list.
+  //! @param theNbDraws    number of draws
+  //! @param theNbUnsorted number of state changes in insertion order
+  //! @param theNbSorted   number of state changes in sorted order
+  void AddStateChanges(int theNbDraws, int theNbUnsorted, int theNbSorted)
+  {
+    myNbSortedDraws += theNbDraws;
+    myNbStateChangesUnsorted += theNbUnsorted;
+    myNbStateChanges += theNbSorted;
+  }
+
+public: //! @name Ray-tracing acceleration structures memory
+
+  //! Return number of alive acceleration structures.
+  int NbAccelStructures() const { return myNbAccelStructs; }
+
+  //! Return GPU memory occupied by alive acceleration structures in bytes.
+  size_t AccelStructMemory() const { return myAccelStructMemory; }
+
+  //! Return GPU memory the same acceleration structures would occupy without compaction in bytes.
+  size_t AccelStructMemoryUncompacted() const { return myAccelStructMemoryUncompacted; }
+
+  //! Return the largest scratch buffer used by acceleration structure build in bytes.
+  size_t AccelStructScratchPeak() const { return myAccelStructScratchPeak; }
+
+  //! Register acceleration structure.
+  //! @param theSize             size of the (compacted) structure
+  //! @param theUncompactedSize  size of the structure before compaction
+  void AddAccelStructure(size_t theSize, size_t theUncompactedSize)
+  {
+    ++myNbAccelStructs;
+    myAccelStructMemory += theSize;
+    myAccelStructMemoryUncompacted += theUncompactedSize;
+  }
+
+  //! Unregister acceleration structure registered by AddAccelStructure() with the same sizes.
+  void RemoveAccelStructure(size_t theSize, size_t theUncompactedSize)
+  {
+    --myNbAccelStructs;
+    myAccelStructMemory -= theSize;
+    myAccelStructMemoryUncompacted -= theUncompactedSize;
+  }
+
+  //! Register scratch buffer size used by acceleration structure build.
+  void AddAccelStructScratch(size_t theScratchSize)
+  {
+    myAccelStructScratchPeak = std::max(myAccelStructScratchPeak, theScratchSize);
+  }
+
+public: //! @name Presentation timing
+
+  //! Return timestamp of input event to be reflected by the next frame (see SetInputTimestamp()).
+  double InputTimestamp() const { return myInputTimestamp; }
+
+  //! Set timestamp of input event to be reflected by the next redrawn frame,
+  //! in seconds of CACurrentMediaTime() time base (the same as NSEvent::timestamp);
+  //! the timestamp is consumed by the next frame, which otherwise measures latency from the start of redraw.
+  void SetInputTimestamp(double theTime) { myInputTimestamp = theTime; }
+
+  //! Return input-to-photon latency of the last presented frame in seconds:
+  //! time from input event (or start of redraw) to presentation of the drawable on display; 0 if not measured.
+  double InputToPhotonLatency() const { return myInputToPhoton.load(std::memory_order_relaxed); }
+
+  //! Return exponentially smoothed input-to-photon latency in seconds.
+  double AverageInputToPhotonLatency() const { return myInputToPhotonAvg.load(std::memory_order_relaxed); }
+
+  //! Return interval between presentation of the last two frames in seconds.
+  double PresentInterval() const { return myPresentInterval.load(std::memory_order_relaxed); }
+
+  //! Return number of drawables dropped without being presented.
+  int NbDroppedFrames() const { return myNbDroppedFrames.load(std::memory_order_relaxed); }
+
+  //! Register presentation of the frame; called from presented handler of the drawable,
+  //! which is executed by another thread.
+  //! @param theInputTime     input timestamp (or redraw start) of the frame
+  //! @param thePresentedTime presentation time of the drawable, 0 if drawable has been dropped
+  Standard_EXPORT void AddPresentedFrame(double theInputTime, double thePresentedTime);
+
 protected: //! @name Virtual methods
 
   //! Method to collect statistics from the View; called by FrameEnd().
@@ -118,6 +221,15 @@ public: //! @name Timing
   //! Set GPU time.
   void SetGpuTime(double theTime) { myGpuTime = theTime; }
 
+  //! Return GPU time of specified pass in seconds within last measured frames.
+  double GpuPassTime(Graphic3d_FrameStatsTimer theTimer) const { return myGpuPassTimes[theTimer]; }
+
+  //! Add GPU times of completed frames to the active data frame (should be called between
+  //! ::FrameStart() and ::FrameEnd()) and update last GPU times.
+  //! @param theTimes    times indexed by Graphic3d_FrameStatsTimer (see Metal_GpuTimer::FetchResults())
+  //! @param theNbFrames number of completed frames
+  Standard_EXPORT void AddGpuTimes(const double* theTimes, int theNbFrames);
+
 protected:
 
   // GPU memory
@@ -130,9 +242,29 @@ protected:
   int64_t myLinesCount;     //!< number of lines
   int64_t myPointsCount;    //!< number of points
 
+  // State sorting statistics
+  int myNbSortedDraws;          //!< number of draws submitted by sorted draw lists
+  int myNbStateChanges;         //!< number of state changes of sorted draws
+  int myNbStateChangesUnsorted; //!< number of state changes of the same draws in insertion order
+
+  // Acceleration structures memory
+  int    myNbAccelStructs;               //!< number of alive acceleration structures
+  size_t myAccelStructMemory;            //!< memory of alive acceleration structures
+  size_t myAccelStructMemoryUncompacted; //!< memory of the same structures before compaction
+  size_t myAccelStructScratchPeak;       //!< largest scratch buffer of a build
+
   // Timing
   OSD_Timer myCpuTimer;  //!< CPU timer
   double    myGpuTime;   //!< GPU time in seconds
+  double    myGpuPassTimes[Graphic3d_FrameStatsTimer_NB]; //!< GPU time of passes in seconds
+
+  // Presentation timing (written by presented handlers of drawables)
+  double              myInputTimestamp;   //!< input timestamp for the next frame
+  std::atomic<double> myInputToPhoton;    //!< input-to-photon latency of the last presented frame
+  std::atomic<double> myInputToPhotonAvg; //!< smoothed input-to-photon latency
+  std::atomic<double> myPresentInterval;  //!< interval between last two presented frames
+  std::atomic<double> myLastPresentedTime; //!< presentation time of the last frame
+  std::atomic<int>    myNbDroppedFrames;  //!< number of dropped drawables
 };
 
 DEFINE_STANDARD_HANDLE(Metal_FrameStats, Graphic3d_FrameStats)
@@ -29,9 +29,25 @@ Metal_FrameStats::Metal_FrameStats()
   myTrianglesCount(0),
   myLinesCount(0),
   myPointsCount(0),
-  myGpuTime(0.0)
+  myNbSortedDraws(0),
+  myNbStateChanges(0),
+  myNbStateChangesUnsorted(0),
+  myNbAccelStructs(0),
+  myAccelStructMemory(0),
+  myAccelStructMemoryUncompacted(0),
+  myAccelStructScratchPeak(0),
+  myGpuTime(0.0),
+  myInputTimestamp(0.0),
+  myInputToPhoton(0.0),
+  myInputToPhotonAvg(0.0),
+  myPresentInterval(0.0),
+  myLastPresentedTime(0.0),
+  myNbDroppedFrames(0)
 {
-  //
+  for (int aTimerIter = 0; aTimerIter < Graphic3d_FrameStatsTimer_NB; ++aTimerIter)
+  {
+    myGpuPassTimes[aTimerIter] = 0.0;
+  }
 }
 
 // =======================================================================
@@ -43,6 +59,55 @@ Metal_FrameStats::~Metal_FrameStats()
   //
 }
 
+// =======================================================================
+// function : AddGpuTimes
+// purpose  : Add GPU times of completed frames
+// =======================================================================
+void Metal_FrameStats::AddGpuTimes(const double* theTimes, int theNbFrames)
+{
+  if (theNbFrames <= 0)
+  {
+    return;
+  }
+
+  // timers of active data frame are cumulative,
+  // so that times of frames completed with a latency are averaged properly
+  Graphic3d_FrameStatsDataTmp& aData = ActiveDataFrame();
+  for (int aTimerIter = Graphic3d_FrameStatsTimer_GpuLower;
+       aTimerIter <= Graphic3d_FrameStatsTimer_GpuUpper; ++aTimerIter)
+  {
+    const Graphic3d_FrameStatsTimer aTimer = (Graphic3d_FrameStatsTimer)aTimerIter;
+    aData[aTimer] += theTimes[aTimer];
+    myGpuPassTimes[aTimer] = theTimes[aTimer] / double(theNbFrames);
+  }
+  myGpuTime = myGpuPassTimes[Graphic3d_FrameStatsTimer_GpuFrame];
+}
+
+// =======================================================================
+// function : AddPresentedFrame
+// purpose  : Register presentation of the frame
+// =======================================================================
+void Metal_FrameStats::AddPresentedFrame(double theInputTime, double thePresentedTime)
+{
+  if (thePresentedTime <= 0.0)
+  {
+    myNbDroppedFrames.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+
+  // handlers of drawables are called in presentation order
+  const double aPrevTime = myLastPresentedTime.exchange(thePresentedTime, std::memory_order_relaxed);
+  if (aPrevTime > 0.0)
+  {
+    myPresentInterval.store(thePresentedTime - aPrevTime, std::memory_order_relaxed);
+  }
+
+  const double aLatency = std::max(thePresentedTime - theInputTime, 0.0);
+  const double anAvg    = myInputToPhotonAvg.load(std::memory_order_relaxed);
+  myInputToPhoton.store(aLatency, std::memory_order_relaxed);
+  myInputToPhotonAvg.store(anAvg > 0.0 ? anAvg * 0.9 + aLatency * 0.1 : aLatency, std::memory_order_relaxed);
+}
+
 // =======================================================================
 // function : updateStatistics
 // purpose  : Collect statistics from the view
@@ -123,7 +188,7 @@ void Metal_FrameStats::updateStatistics(const occ::handle<Graphic3d_CView>& theV
   aData[Graphic3d_FrameStatsCounter_NbStructs] = aNbStructs;
 
   // Update GPU memory counters
-  aData[Graphic3d_FrameStatsCounter_EstimatedBytesGeom] = myBufferMemory;
+  aData[Graphic3d_FrameStatsCounter_EstimatedBytesGeom] = myBufferMemory + myAccelStructMemory;
   aData[Graphic3d_FrameStatsCounter_EstimatedBytesTextures] = myTextureMemory;
   aData[Graphic3d_FrameStatsCounter_EstimatedBytesFbos] = 0;
 
@@ -186,6 +186,47 @@ void Metal_FrameStatsPrs::buildText(const occ::handle<Metal_FrameStats>& theStat
 
   myStatsText = aBuffer;
 
+  // presentation timing is measured only for frames presented on display
+  if (theStats->AverageInputToPhotonLatency() > 0.0)
+  {
+    snprintf(aBuffer, sizeof(aBuffer), "\nLatency: %.1f ms (present %.1f ms)",
+             theStats->AverageInputToPhotonLatency() * 1000.0,
+             theStats->PresentInterval() * 1000.0);
+    myStatsText += aBuffer;
+  }
+
+  // GPU time of individual passes, measured only with counters sampling support
+  static const struct
+  {
+    Graphic3d_FrameStatsTimer Timer;
+    const char*               Name;
+  } THE_GPU_PASSES[] =
+  {
+    { Graphic3d_FrameStatsTimer_GpuMainPass,     "  Main pass" },
+    { Graphic3d_FrameStatsTimer_GpuShadowMap,    "  Shadow maps" },
+    { Graphic3d_FrameStatsTimer_GpuOit,          "  OIT" },
+    { Graphic3d_FrameStatsTimer_GpuDepthPeeling, "  Depth peeling" },
+    { Graphic3d_FrameStatsTimer_GpuPostProcess,  "  Post-process" },
+    { Graphic3d_FrameStatsTimer_GpuRayTracing,   "  Ray tracing" },
+  };
+  for (const auto& aPass : THE_GPU_PASSES)
+  {
+    const double aPassTime = theStats->GpuPassTime(aPass.Timer);
+    if (aPassTime > 0.0)
+    {
+      snprintf(aBuffer, sizeof(aBuffer), "\n%s: %.2f ms", aPass.Name, aPassTime * 1000.0);
+      myStatsText += aBuffer;
+    }
+  }
+
+  // state changes saved by sorted draw lists (Metal_Caps::useSortedDrawList)
+  if (theStats->NbSortedDraws() > 0)
+  {
+    snprintf(aBuffer, sizeof(aBuffer), "\nState changes: %d (%d saved, %d sorted draws)",
+             theStats->NbStateChanges(), theStats->NbStateChangesSaved(), theStats->NbSortedDraws());
+    myStatsText += aBuffer;
+  }
+
   // Update FPS history for chart
   myFpsHistory[myFpsHistoryIndex] = static_cast<float>(theStats->FrameRate());
   myFpsHistoryIndex = (myFpsHistoryIndex + 1) % FPS_HISTORY_SIZE;
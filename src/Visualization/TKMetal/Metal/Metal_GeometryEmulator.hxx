@@ -17,11 +17,11 @@
 #include <Standard_Transient.hxx>
 #include <Standard_Handle.hxx>
 #include <NCollection_Vec4.hxx>
+#include <Metal_IndexBuffer.hxx>
+#include <Metal_VertexBuffer.hxx>
 
 #ifdef __OBJC__
 @protocol MTLDevice;
-@protocol MTLBuffer;
-@protocol MTLCommandBuffer;
 @protocol MTLComputePipelineState;
 @protocol MTLRenderPipelineState;
 @protocol MTLDepthStencilState;
@@ -45,7 +45,7 @@ struct Metal_WireframeParams
   float FillColor[4];   //!< Solid fill color (RGBA)
   float LineWidth;      //!< Line width in pixels
   float Feather;        //!< Edge feathering for anti-aliasing
-  float Viewport[2];    //!< Viewport size (width, height)
+  float Viewport[2];    //!< Viewport size (width, height); edge distances are measured by screen-space derivatives
 
   //! Default constructor with reasonable defaults.
   Metal_WireframeParams()
@@ -62,7 +62,7 @@ struct Metal_WireframeParams
 };
 
 //! Geometry shader emulator for Metal.
-//! Provides wireframe/mesh edges rendering using compute-based edge distance calculation.
+//! Provides wireframe/mesh edges rendering using barycentric coordinates computed once per geometry (see Prepare()).
 //! This emulates OpenGL geometry shader functionality for Graphic3d_ShaderFlags_MeshEdges.
 class Metal_GeometryEmulator : public Standard_Transient
 {
@@ -83,45 +83,28 @@ public:
   //! Check if emulator is valid and ready to use.
   Standard_EXPORT bool IsValid() const { return myIsValid; }
 
-  //! Process triangle mesh to compute edge distances.
-  //! This runs a compute shader that outputs processed vertices ready for wireframe rendering.
-  //! @param[in] theCmdBuf      command buffer
-  //! @param[in] theVertices    vertex buffer (position + normal, 24 bytes per vertex)
-  //! @param[in] theIndices     index buffer (triangles, 3 indices per triangle)
-  //! @param[in] theTriangleCount number of triangles
-  //! @param[in] theUniforms    transform uniforms buffer
-  //! @param[in] theViewportWidth  viewport width
-  //! @param[in] theViewportHeight viewport height
+  //! Return size of one vertex within mesh edges buffer filled by Prepare():
+  //! model-space position, normal and barycentric coordinates of triangle corner (3 packed floats each).
+  static constexpr size_t VertexSize() { return sizeof(float) * 9; }
+
+  //! Fill persistent mesh edges buffer of the geometry - triangles are unrolled into 3 * theNbTriangles vertices
+  //! holding barycentric coordinates of their corners, which are converted into pixel distances to triangle edges
+  //! by fragment shader using screen-space derivatives. Does not depend on camera or viewport,
+  //! so that it should be done once per geometry; the compute pass is committed within own command buffer
+  //! on the context queue, hence executed before the frame command buffer.
+  //! @param[in] theCtx       Metal context
+  //! @param[in] thePositions position buffer (3 floats per vertex)
+  //! @param[in] theNormals   normal buffer (3 floats per vertex), or NULL
+  //! @param[in] theIndices   triangle list indices, or NULL for non-indexed triangles
+  //! @param[in] theNbTriangles number of triangles
+  //! @param[in] theOutput    output buffer of at least 3 * theNbTriangles * VertexSize() bytes
   //! @return true on success
-  Standard_EXPORT bool Process(
-#ifdef __OBJC__
-    id<MTLCommandBuffer> theCmdBuf,
-    id<MTLBuffer> theVertices,
-    id<MTLBuffer> theIndices,
-#else
-    void* theCmdBuf,
-    void* theVertices,
-    void* theIndices,
-#endif
-    int theTriangleCount,
-#ifdef __OBJC__
-    id<MTLBuffer> theUniforms,
-#else
-    void* theUniforms,
-#endif
-    float theViewportWidth,
-    float theViewportHeight);
-
-  //! Get processed vertex buffer (output from compute shader).
-  //! This buffer contains positions with edge distances, ready for wireframe rendering.
-#ifdef __OBJC__
-  id<MTLBuffer> ProcessedVertexBuffer() const { return myProcessedVertexBuffer; }
-#else
-  void* ProcessedVertexBuffer() const { return myProcessedVertexBuffer; }
-#endif
-
-  //! Get number of processed vertices (3 * triangle count).
-  int ProcessedVertexCount() const { return myProcessedVertexCount; }
+  Standard_EXPORT bool Prepare(Metal_Context* theCtx,
+                               const occ::handle<Metal_VertexBuffer>& thePositions,
+                               const occ::handle<Metal_VertexBuffer>& theNormals,
+                               const occ::handle<Metal_IndexBuffer>& theIndices,
+                               int theNbTriangles,
+                               const occ::handle<Metal_Buffer>& theOutput);
 
   //! Get wireframe render pipeline for specified mode.
 #ifdef __OBJC__
@@ -172,33 +155,24 @@ protected:
   //! Initialize compute and render pipelines.
   bool initPipelines();
 
-  //! Ensure processed vertex buffer is large enough.
-  bool ensureProcessedBuffer(int theVertexCount);
-
 protected:
 
   Metal_Context* myContext;           //!< Metal context
   Metal_WireframeParams myWireParams; //!< Wireframe rendering parameters
-  int myProcessedVertexCount;         //!< Number of processed vertices
-  int myProcessedBufferCapacity;      //!< Current buffer capacity in vertices
   bool myIsValid;                     //!< Initialization status
 
 #ifdef __OBJC__
-  id<MTLComputePipelineState> myComputePipeline;    //!< Edge distance compute pipeline
+  id<MTLComputePipelineState> myComputePipeline;    //!< Edge barycentrics compute pipeline
   id<MTLRenderPipelineState> myOverlayPipeline;     //!< Wireframe overlay render pipeline
   id<MTLRenderPipelineState> myOnlyPipeline;        //!< Wireframe-only render pipeline
   id<MTLRenderPipelineState> myHiddenPipeline;      //!< Hidden-line render pipeline
   id<MTLDepthStencilState> myDepthStencilState;     //!< Depth stencil state
-  id<MTLBuffer> myProcessedVertexBuffer;            //!< Output buffer from compute shader
-  id<MTLBuffer> myViewportBuffer;                   //!< Viewport size uniform buffer
 #else
   void* myComputePipeline;
   void* myOverlayPipeline;
   void* myOnlyPipeline;
   void* myHiddenPipeline;
   void* myDepthStencilState;
-  void* myProcessedVertexBuffer;
-  void* myViewportBuffer;
 #endif
 };
 
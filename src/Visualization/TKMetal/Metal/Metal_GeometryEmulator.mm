@@ -20,22 +20,30 @@
 
 IMPLEMENT_STANDARD_RTTIEXT(Metal_GeometryEmulator, Standard_Transient)
 
+namespace
+{
+  //! Parameters of compute_edge_barycentrics kernel (should match MeshEdgesParams in Metal_ShaderManager).
+  struct Metal_MeshEdgesParams
+  {
+    uint32_t NbTriangles;
+    uint32_t IndexMode;  //!< 0 - no indices, 1 - 16-bit indices, 2 - 32-bit indices
+    uint32_t HasNormals;
+    uint32_t Padding;
+  };
+}
+
 // =======================================================================
 // function : Metal_GeometryEmulator
 // purpose  : Constructor
 // =======================================================================
 Metal_GeometryEmulator::Metal_GeometryEmulator(Metal_Context* theCtx)
 : myContext(theCtx),
-  myProcessedVertexCount(0),
-  myProcessedBufferCapacity(0),
   myIsValid(false),
   myComputePipeline(nil),
   myOverlayPipeline(nil),
   myOnlyPipeline(nil),
   myHiddenPipeline(nil),
-  myDepthStencilState(nil),
-  myProcessedVertexBuffer(nil),
-  myViewportBuffer(nil)
+  myDepthStencilState(nil)
 {
   myIsValid = initPipelines();
 }
@@ -60,10 +68,6 @@ void Metal_GeometryEmulator::Release()
   myOnlyPipeline = nil;
   myHiddenPipeline = nil;
   myDepthStencilState = nil;
-  myProcessedVertexBuffer = nil;
-  myViewportBuffer = nil;
-  myProcessedVertexCount = 0;
-  myProcessedBufferCapacity = 0;
   myIsValid = false;
 }
 
@@ -91,11 +95,11 @@ bool Metal_GeometryEmulator::initPipelines()
 
     NSError* anError = nil;
 
-    // Create compute pipeline for edge distance calculation
-    id<MTLFunction> aComputeFunc = [aLibrary newFunctionWithName:@"compute_edge_distances"];
+    // Create compute pipeline for edge barycentrics calculation
+    id<MTLFunction> aComputeFunc = [aLibrary newFunctionWithName:@"compute_edge_barycentrics"];
     if (aComputeFunc == nil)
     {
-      myContext->Messenger()->SendFail() << "Metal_GeometryEmulator: compute_edge_distances function not found";
+      myContext->Messenger()->SendFail() << "Metal_GeometryEmulator: compute_edge_barycentrics function not found";
       return false;
     }
 
@@ -107,28 +111,6 @@ bool Metal_GeometryEmulator::initPipelines()
       return false;
     }
 
-    // Create vertex descriptor for processed vertices (from compute output)
-    // EdgeVertexOut: position(float4) + normal(float3) + edgeDistance(float3) + viewPosition(float3) + color(float4)
-    // Total: 4+3+3+3+4 = 17 floats = 68 bytes
-    MTLVertexDescriptor* aVertexDesc = [[MTLVertexDescriptor alloc] init];
-    aVertexDesc.attributes[0].format = MTLVertexFormatFloat4;  // position
-    aVertexDesc.attributes[0].offset = 0;
-    aVertexDesc.attributes[0].bufferIndex = 0;
-    aVertexDesc.attributes[1].format = MTLVertexFormatFloat3;  // normal
-    aVertexDesc.attributes[1].offset = 16;
-    aVertexDesc.attributes[1].bufferIndex = 0;
-    aVertexDesc.attributes[2].format = MTLVertexFormatFloat3;  // edgeDistance
-    aVertexDesc.attributes[2].offset = 28;
-    aVertexDesc.attributes[2].bufferIndex = 0;
-    aVertexDesc.attributes[3].format = MTLVertexFormatFloat3;  // viewPosition
-    aVertexDesc.attributes[3].offset = 40;
-    aVertexDesc.attributes[3].bufferIndex = 0;
-    aVertexDesc.attributes[4].format = MTLVertexFormatFloat4;  // color
-    aVertexDesc.attributes[4].offset = 52;
-    aVertexDesc.attributes[4].bufferIndex = 0;
-    aVertexDesc.layouts[0].stride = 68;
-    aVertexDesc.layouts[0].stepFunction = MTLVertexStepFunctionPerVertex;
-
     // Get vertex function
     id<MTLFunction> aVertexFunc = [aLibrary newFunctionWithName:@"vertex_wireframe"];
     if (aVertexFunc == nil)
@@ -139,7 +121,6 @@ bool Metal_GeometryEmulator::initPipelines()
 
     // Base pipeline descriptor
     MTLRenderPipelineDescriptor* aPipelineDesc = [[MTLRenderPipelineDescriptor alloc] init];
-    aPipelineDesc.vertexDescriptor = aVertexDesc;
     aPipelineDesc.vertexFunction = aVertexFunc;
     aPipelineDesc.colorAttachments[0].pixelFormat = MTLPixelFormatBGRA8Unorm;
     aPipelineDesc.depthAttachmentPixelFormat = MTLPixelFormatDepth32Float;
@@ -205,101 +186,65 @@ bool Metal_GeometryEmulator::initPipelines()
     aDepthDesc.depthWriteEnabled = YES;
     myDepthStencilState = [aDevice newDepthStencilStateWithDescriptor:aDepthDesc];
 
-    // Create viewport uniform buffer
-    myViewportBuffer = [aDevice newBufferWithLength:sizeof(float) * 2
-                                            options:MTLResourceStorageModeShared];
-
     myContext->Messenger()->SendInfo() << "Metal_GeometryEmulator: Initialized successfully";
     return true;
   }
 }
 
 // =======================================================================
-// function : ensureProcessedBuffer
-// purpose  : Ensure buffer capacity
-// =======================================================================
-bool Metal_GeometryEmulator::ensureProcessedBuffer(int theVertexCount)
-{
-  if (theVertexCount <= myProcessedBufferCapacity)
-  {
-    return true;
-  }
-
-  // Allocate with some headroom
-  int aNewCapacity = theVertexCount + (theVertexCount / 4);
-
-  // EdgeVertexOut struct size: 68 bytes
-  size_t aBufferSize = aNewCapacity * 68;
-
-  myProcessedVertexBuffer = [myContext->Device() newBufferWithLength:aBufferSize
-                                                             options:MTLResourceStorageModeShared];
-  if (myProcessedVertexBuffer == nil)
-  {
-    myContext->Messenger()->SendFail() << "Metal_GeometryEmulator: Failed to allocate processed vertex buffer";
-    return false;
-  }
-
-  myProcessedBufferCapacity = aNewCapacity;
-  return true;
-}
-
-// =======================================================================
-// function : Process
-// purpose  : Compute edge distances for mesh
+// function : Prepare
+// purpose  : Fill persistent mesh edges buffer of the geometry
 // =======================================================================
-bool Metal_GeometryEmulator::Process(
-  id<MTLCommandBuffer> theCmdBuf,
-  id<MTLBuffer> theVertices,
-  id<MTLBuffer> theIndices,
-  int theTriangleCount,
-  id<MTLBuffer> theUniforms,
-  float theViewportWidth,
-  float theViewportHeight)
+bool Metal_GeometryEmulator::Prepare(Metal_Context* theCtx,
+                                     const occ::handle<Metal_VertexBuffer>& thePositions,
+                                     const occ::handle<Metal_VertexBuffer>& theNormals,
+                                     const occ::handle<Metal_IndexBuffer>& theIndices,
+                                     int theNbTriangles,
+                                     const occ::handle<Metal_Buffer>& theOutput)
 {
-  if (!myIsValid || theCmdBuf == nil || theVertices == nil || theIndices == nil)
+  if (!myIsValid
+   || theCtx == nullptr
+   || theNbTriangles <= 0
+   || thePositions.IsNull() || !thePositions->IsValid()
+   || theOutput.IsNull() || !theOutput->IsValid()
+   || theOutput->GetSize() < size_t(theNbTriangles) * 3 * VertexSize())
   {
     return false;
   }
 
-  // Update processed vertex count
-  myProcessedVertexCount = theTriangleCount * 3;
-
-  // Ensure buffer is large enough
-  if (!ensureProcessedBuffer(myProcessedVertexCount))
-  {
-    return false;
-  }
-
-  // Update viewport buffer
-  float* aViewport = (float*)[myViewportBuffer contents];
-  aViewport[0] = theViewportWidth;
-  aViewport[1] = theViewportHeight;
-
-  // Also update wireframe params
-  myWireParams.Viewport[0] = theViewportWidth;
-  myWireParams.Viewport[1] = theViewportHeight;
+  const bool hasNormals = !theNormals.IsNull() && theNormals->IsValid();
+  const bool hasIndices = !theIndices.IsNull() && theIndices->IsValid();
+  Metal_MeshEdgesParams aParams = {};
+  aParams.NbTriangles = uint32_t(theNbTriangles);
+  aParams.IndexMode   = !hasIndices ? 0 : (theIndices->IndexType() == Metal_IndexType_UInt16 ? 1 : 2);
+  aParams.HasNormals  = hasNormals ? 1 : 0;
 
   @autoreleasepool
   {
-    // Dispatch compute shader
-    id<MTLComputeCommandEncoder> aComputeEncoder = [theCmdBuf computeCommandEncoder];
+    // own command buffer committed before the frame one, which is executed after it on the same queue
+    id<MTLCommandBuffer> aCmdBuf = [theCtx->CommandQueue() commandBuffer];
+    aCmdBuf.label = @"MeshEdges_Prepare";
+    id<MTLComputeCommandEncoder> aComputeEncoder = [aCmdBuf computeCommandEncoder];
     [aComputeEncoder setComputePipelineState:myComputePipeline];
 
-    // Buffer bindings match compute_edge_distances signature
-    [aComputeEncoder setBuffer:theVertices offset:0 atIndex:0];       // vertices
-    [aComputeEncoder setBuffer:theIndices offset:0 atIndex:1];        // indices
-    [aComputeEncoder setBuffer:myProcessedVertexBuffer offset:0 atIndex:2]; // output
-    [aComputeEncoder setBuffer:theUniforms offset:0 atIndex:3];       // uniforms
-    [aComputeEncoder setBuffer:myViewportBuffer offset:0 atIndex:4];  // viewport
+    // Buffer bindings match compute_edge_barycentrics signature
+    [aComputeEncoder setBuffer:thePositions->Buffer() offset:thePositions->Offset() atIndex:0];
+    [aComputeEncoder setBuffer:hasNormals ? theNormals->Buffer() : thePositions->Buffer()
+                        offset:hasNormals ? theNormals->Offset() : thePositions->Offset()
+                       atIndex:1];
+    [aComputeEncoder setBuffer:hasIndices ? theIndices->Buffer() : thePositions->Buffer()
+                        offset:hasIndices ? theIndices->Offset() : thePositions->Offset()
+                       atIndex:2];
+    [aComputeEncoder setBuffer:theOutput->Buffer() offset:theOutput->Offset() atIndex:3];
+    [aComputeEncoder setBytes:&aParams length:sizeof(aParams) atIndex:4];
 
     // Dispatch one thread per triangle
-    MTLSize aThreadgroupSize = MTLSizeMake(64, 1, 1);
-    MTLSize aThreadgroups = MTLSizeMake((theTriangleCount + 63) / 64, 1, 1);
-    [aComputeEncoder dispatchThreadgroups:aThreadgroups threadsPerThreadgroup:aThreadgroupSize];
-
+    const NSUInteger aGroupSize = myComputePipeline.threadExecutionWidth;
+    [aComputeEncoder dispatchThreadgroups:MTLSizeMake((NSUInteger(theNbTriangles) + aGroupSize - 1) / aGroupSize, 1, 1)
+                    threadsPerThreadgroup:MTLSizeMake(aGroupSize, 1, 1)];
     [aComputeEncoder endEncoding];
+    [aCmdBuf commit];
   }
-
   return true;
 }
 
@@ -0,0 +1,104 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef Metal_GpuCulling_HeaderFile
+#define Metal_GpuCulling_HeaderFile
+
+#include <Metal_ComputePipeline.hxx>
+#include <NCollection_Mat4.hxx>
+
+class Metal_Context;
+class Metal_IndirectLayer;
+
+//! GPU-driven culling of draw calls recorded within static layers (Metal_IndirectLayer).
+//!
+//! Before the frame is rendered, a compute pass tests world-space bounding box of each
+//! recorded draw against the view frustum and against hierarchical depth pyramid (Hi-Z)
+//! built from depth buffer of the previous frame; render commands of culled draws are reset
+//! within a per-frame copy of the indirect command buffer, so that replaying it skips their vertex workload.
+//!
+//! Occlusion test relies on the previous frame depth and is therefore approximate
+//! for fast camera movements (objects appearing from behind occluders may pop in one frame later).
+class Metal_GpuCulling : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(Metal_GpuCulling, Standard_Transient)
+public:
+
+  //! Create uninitialized culling pass.
+  Standard_EXPORT Metal_GpuCulling();
+
+  //! Destructor.
+  Standard_EXPORT ~Metal_GpuCulling() override;
+
+  //! Compile compute kernels.
+  //! @return FALSE if kernels cannot be created (culling should not be used)
+  Standard_EXPORT bool Init(Metal_Context* theCtx);
+
+  //! Return TRUE if kernels have been compiled.
+  bool IsValid() const { return !myCullPipeline.IsNull() && myCullPipeline->IsValid(); }
+
+  //! Return TRUE if depth pyramid from previous frame is available for occlusion test.
+  bool HasDepthPyramid() const { return myHasDepthPyramid; }
+
+  //! Reset depth pyramid, so that the next frame is culled by frustum only
+  //! (e.g. after resize or camera jump).
+  void InvalidateDepthPyramid() { myHasDepthPyramid = false; }
+
+  //! Release GPU resources.
+  Standard_EXPORT void Release(Metal_Context* theCtx);
+
+#ifdef __OBJC__
+  //! Encode culling of recorded draw calls of the layer.
+  //! @param theCtx         Metal context
+  //! @param theCmdBuffer   command buffer (outside of render pass)
+  //! @param theLayer       recorded layer
+  //! @param theViewProj    view-projection matrix of the frame to render
+  //! @param theViewportX   viewport width in pixels
+  //! @param theViewportY   viewport height in pixels
+  //! @return FALSE if layer cannot be culled (recorded commands will be replayed as is)
+  Standard_EXPORT bool Cull(Metal_Context* theCtx,
+                            id<MTLCommandBuffer> theCmdBuffer,
+                            Metal_IndirectLayer& theLayer,
+                            const NCollection_Mat4<float>& theViewProj,
+                            int theViewportX,
+                            int theViewportY);
+
+  //! Build depth pyramid from depth buffer of rendered frame (to be used by the next frame).
+  //! @param theCtx       Metal context
+  //! @param theCmdBuffer command buffer (after render pass)
+  //! @param theDepth     depth texture (should be stored and have shader read usage)
+  Standard_EXPORT void BuildDepthPyramid(Metal_Context* theCtx,
+                                         id<MTLCommandBuffer> theCmdBuffer,
+                                         id<MTLTexture> theDepth);
+#endif
+
+protected:
+
+  occ::handle<Metal_ComputePipeline> myCullPipeline;      //!< draw culling kernel
+  occ::handle<Metal_ComputePipeline> myDepthInitPipeline; //!< depth to Hi-Z level 0 copy kernel
+  occ::handle<Metal_ComputePipeline> myDepthReducePipeline; //!< Hi-Z max-reduction kernel
+#ifdef __OBJC__
+  id<MTLFunction> myCullFunction;  //!< culling function (for argument encoder)
+  id<MTLTexture>  myDepthPyramid;  //!< Hi-Z texture with mipmaps storing farthest depth
+  NSMutableArray* myPyramidLevels; //!< texture views of each pyramid level
+#else
+  void* myCullFunction;
+  void* myDepthPyramid;
+  void* myPyramidLevels;
+#endif
+  int  myPyramidSizeX;    //!< depth pyramid width
+  int  myPyramidSizeY;    //!< depth pyramid height
+  bool myHasDepthPyramid; //!< depth pyramid contains previous frame depth
+};
+
+#endif // Metal_GpuCulling_HeaderFile
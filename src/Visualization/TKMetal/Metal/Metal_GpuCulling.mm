@@ -0,0 +1,443 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#import <Metal/Metal.h>
+
+#include <Metal_GpuCulling.hxx>
+#include <Metal_Context.hxx>
+#include <Metal_IndirectLayer.hxx>
+
+#include <algorithm>
+
+IMPLEMENT_STANDARD_RTTIEXT(Metal_GpuCulling, Standard_Transient)
+
+namespace
+{
+  //! Culling kernels.
+  static const char* THE_GPU_CULLING_SHADER = R"(
+#include <metal_stdlib>
+using namespace metal;
+
+struct CullUniforms
+{
+  float4x4 ViewProj;
+  float2   ViewportSize;
+  uint     NbDraws;
+  uint     FirstDraw;
+  uint     HasDepthPyramid;
+  uint     NbLevels;
+  uint     NbTrsfs;
+  uint     Padding;
+};
+
+// bounds of the draw in structure space, transformed by structure transformation of Metal_TransformBuffer
+struct DrawBounds
+{
+  packed_float3 Min;
+  uint          IsDefined; // 0 for draws without valid bounds
+  packed_float3 Max;
+  uint          TrsfSlot;
+};
+
+struct CullCommands
+{
+  command_buffer Commands [[id(0)]];
+};
+
+kernel void cull_draws(uint theIndex [[thread_position_in_grid]],
+                       constant CullUniforms& theUniforms [[buffer(0)]],
+                       const device DrawBounds* theBounds [[buffer(1)]],
+                       device CullCommands& theCommands [[buffer(2)]],
+                       const device float4x4* theTrsfs [[buffer(3)]],
+                       texture2d<float, access::read> theDepthPyramid [[texture(0)]])
+{
+  if (theIndex >= theUniforms.NbDraws)
+  {
+    return;
+  }
+
+  const DrawBounds aBox = theBounds[theUniforms.FirstDraw + theIndex];
+  if (aBox.IsDefined == 0 || aBox.TrsfSlot >= theUniforms.NbTrsfs)
+  {
+    return;
+  }
+
+  const float4x4 aMvp = theUniforms.ViewProj * theTrsfs[aBox.TrsfSlot];
+
+  // frustum test - all corners outside the same clipping plane
+  uint anOutAll = 0x3F;
+  bool isBehind = false;
+  float3 aNdcMin = float3( 1.0e30);
+  float3 aNdcMax = float3(-1.0e30);
+  for (uint aCorner = 0; aCorner < 8; ++aCorner)
+  {
+    const float4 aPnt = float4((aCorner & 1) != 0 ? aBox.Max.x : aBox.Min.x,
+                               (aCorner & 2) != 0 ? aBox.Max.y : aBox.Min.y,
+                               (aCorner & 4) != 0 ? aBox.Max.z : aBox.Min.z,
+                               1.0);
+    const float4 aClip = aMvp * aPnt;
+    uint anOut = 0;
+    anOut |= aClip.x < -aClip.w ? 0x01 : 0;
+    anOut |= aClip.x >  aClip.w ? 0x02 : 0;
+    anOut |= aClip.y < -aClip.w ? 0x04 : 0;
+    anOut |= aClip.y >  aClip.w ? 0x08 : 0;
+    anOut |= aClip.z < -aClip.w ? 0x10 : 0;
+    anOut |= aClip.z >  aClip.w ? 0x20 : 0;
+    anOutAll &= anOut;
+    if (aClip.w <= 0.0)
+    {
+      isBehind = true;
+      continue;
+    }
+    const float3 aNdc = aClip.xyz / aClip.w;
+    aNdcMin = min(aNdcMin, aNdc);
+    aNdcMax = max(aNdcMax, aNdc);
+  }
+
+  bool isVisible = anOutAll == 0;
+
+  // occlusion test against farthest depth of previous frame covering the box footprint
+  if (isVisible && !isBehind && theUniforms.HasDepthPyramid != 0)
+  {
+    const float2 aUvMin = clamp(float2(aNdcMin.x, -aNdcMax.y) * 0.5 + 0.5, 0.0, 1.0);
+    const float2 aUvMax = clamp(float2(aNdcMax.x, -aNdcMin.y) * 0.5 + 0.5, 0.0, 1.0);
+    const float2 aSizePx = (aUvMax - aUvMin) * theUniforms.ViewportSize;
+    const uint aLevel = min(uint(ceil(log2(max(max(aSizePx.x, aSizePx.y), 1.0)))), theUniforms.NbLevels - 1);
+    const uint2 aLevelSize = uint2(theDepthPyramid.get_width(aLevel), theDepthPyramid.get_height(aLevel));
+    const uint2 aPxMin = min(uint2(aUvMin * float2(aLevelSize)), aLevelSize - 1);
+    const uint2 aPxMax = min(uint2(aUvMax * float2(aLevelSize)), aLevelSize - 1);
+    const float aDepth = max(max(theDepthPyramid.read(uint2(aPxMin.x, aPxMin.y), aLevel).x,
+                                 theDepthPyramid.read(uint2(aPxMax.x, aPxMin.y), aLevel).x),
+                             max(theDepthPyramid.read(uint2(aPxMin.x, aPxMax.y), aLevel).x,
+                                 theDepthPyramid.read(uint2(aPxMax.x, aPxMax.y), aLevel).x));
+    isVisible = aNdcMin.z <= aDepth;
+  }
+
+  if (!isVisible)
+  {
+    render_command aCmd(theCommands.Commands, theIndex);
+    aCmd.reset();
+  }
+}
+
+kernel void depth_pyramid_init(uint2 thePx [[thread_position_in_grid]],
+                               depth2d<float, access::read> theDepth [[texture(0)]],
+                               texture2d<float, access::write> theLevel [[texture(1)]])
+{
+  if (thePx.x >= theLevel.get_width() || thePx.y >= theLevel.get_height())
+  {
+    return;
+  }
+  theLevel.write(float4(theDepth.read(thePx)), thePx);
+}
+
+kernel void depth_pyramid_reduce(uint2 thePx [[thread_position_in_grid]],
+                                 texture2d<float, access::read> theSrc [[texture(0)]],
+                                 texture2d<float, access::write> theDst [[texture(1)]])
+{
+  if (thePx.x >= theDst.get_width() || thePx.y >= theDst.get_height())
+  {
+    return;
+  }
+
+  // include extra row/column for odd source size to keep the result conservative
+  const uint2 aSrcMax = uint2(theSrc.get_width() - 1, theSrc.get_height() - 1);
+  const uint2 aFrom = thePx * 2;
+  const uint2 aTo = min(aFrom + uint2(((theSrc.get_width()  & 1) != 0 && thePx.x == theDst.get_width()  - 1) ? 2 : 1,
+                                      ((theSrc.get_height() & 1) != 0 && thePx.y == theDst.get_height() - 1) ? 2 : 1),
+                        aSrcMax);
+  float aDepth = 0.0;
+  for (uint aY = aFrom.y; aY <= aTo.y; ++aY)
+  {
+    for (uint aX = aFrom.x; aX <= aTo.x; ++aX)
+    {
+      aDepth = max(aDepth, theSrc.read(uint2(aX, aY)).x);
+    }
+  }
+  theDst.write(float4(aDepth), thePx);
+}
+)";
+
+  //! Culling uniforms; should match CullUniforms in THE_GPU_CULLING_SHADER.
+  struct Metal_CullUniforms
+  {
+    float    ViewProj[16];
+    float    ViewportSize[2];
+    uint32_t NbDraws;
+    uint32_t FirstDraw;
+    uint32_t HasDepthPyramid;
+    uint32_t NbLevels;
+    uint32_t NbTrsfs;
+    uint32_t Padding;
+  };
+}
+
+// =======================================================================
+// function : Metal_GpuCulling
+// purpose  : Constructor
+// =======================================================================
+Metal_GpuCulling::Metal_GpuCulling()
+: myCullFunction(nil),
+  myDepthPyramid(nil),
+  myPyramidLevels(nil),
+  myPyramidSizeX(0),
+  myPyramidSizeY(0),
+  myHasDepthPyramid(false)
+{
+  //
+}
+
+// =======================================================================
+// function : ~Metal_GpuCulling
+// purpose  : Destructor
+// =======================================================================
+Metal_GpuCulling::~Metal_GpuCulling()
+{
+  Release(nullptr);
+}
+
+// =======================================================================
+// function : Release
+// purpose  : Release GPU resources
+// =======================================================================
+void Metal_GpuCulling::Release(Metal_Context* theCtx)
+{
+  for (occ::handle<Metal_ComputePipeline>* aPipeline : { &myCullPipeline, &myDepthInitPipeline, &myDepthReducePipeline })
+  {
+    if (!aPipeline->IsNull())
+    {
+      (*aPipeline)->Release(theCtx);
+      aPipeline->Nullify();
+    }
+  }
+  myCullFunction = nil;
+  myDepthPyramid = nil;
+  myPyramidLevels = nil;
+  myPyramidSizeX = 0;
+  myPyramidSizeY = 0;
+  myHasDepthPyramid = false;
+}
+
+// =======================================================================
+// function : Init
+// purpose  : Compile compute kernels
+// =======================================================================
+bool Metal_GpuCulling::Init(Metal_Context* theCtx)
+{
+  if (IsValid())
+  {
+    return true;
+  }
+  if (theCtx == nullptr || !theCtx->HasIndirectCommandBuffers())
+  {
+    return false;
+  }
+
+  NSError* anError = nil;
+  id<MTLLibrary> aLibrary = theCtx->LoadShaderLibrary("Metal_GpuCulling_THE_GPU_CULLING_SHADER",
+                                                      [NSString stringWithUTF8String:THE_GPU_CULLING_SHADER],
+                                                      nil, &anError);
+  if (aLibrary == nil)
+  {
+    theCtx->Messenger()->SendFail() << "Metal_GpuCulling: failed to compile culling kernels: "
+                                    << (anError != nil ? [[anError localizedDescription] UTF8String] : "");
+    return false;
+  }
+
+  myCullFunction = [aLibrary newFunctionWithName:@"cull_draws"];
+  myCullPipeline        = new Metal_ComputePipeline();
+  myDepthInitPipeline   = new Metal_ComputePipeline();
+  myDepthReducePipeline = new Metal_ComputePipeline();
+  if (myCullFunction == nil
+   || !myCullPipeline       ->Init(theCtx, aLibrary, @"cull_draws")
+   || !myDepthInitPipeline  ->Init(theCtx, aLibrary, @"depth_pyramid_init")
+   || !myDepthReducePipeline->Init(theCtx, aLibrary, @"depth_pyramid_reduce"))
+  {
+    theCtx->Messenger()->SendFail() << "Metal_GpuCulling: failed to create culling pipelines";
+    Release(theCtx);
+    return false;
+  }
+  return true;
+}
+
+// =======================================================================
+// function : Cull
+// purpose  : Encode culling of recorded draw calls of the layer
+// =======================================================================
+bool Metal_GpuCulling::Cull(Metal_Context* theCtx,
+                            id<MTLCommandBuffer> theCmdBuffer,
+                            Metal_IndirectLayer& theLayer,
+                            const NCollection_Mat4<float>& theViewProj,
+                            int theViewportX,
+                            int theViewportY)
+{
+  if (!IsValid()
+   || theCmdBuffer == nil
+   || !theLayer.IsRecorded()
+   || theLayer.myBoundsBuffer == nil
+   || theLayer.myCulledCommandBuffers == nil
+   || theCtx->TransformBuffer().IsNull()
+   || theCtx->TransformBuffer()->Buffer() == nil)
+  {
+    return false;
+  }
+
+  // argument buffers referring to command buffers to be culled
+  if (theLayer.myCullArguments == nil)
+  {
+    id<MTLArgumentEncoder> anArgEncoder = [myCullFunction newArgumentEncoderWithBufferIndex:2];
+    theLayer.myCullArguments = [NSMutableArray arrayWithCapacity:Metal_MaxFramesInFlight];
+    for (NSArray* aSlotIcbs in theLayer.myCulledCommandBuffers)
+    {
+      NSMutableArray* aSlotArgs = [NSMutableArray arrayWithCapacity:[aSlotIcbs count]];
+      for (id<MTLIndirectCommandBuffer> anIcb in aSlotIcbs)
+      {
+        id<MTLBuffer> anArgBuffer = [theCtx->Device() newBufferWithLength:anArgEncoder.encodedLength
+                                                                  options:MTLResourceStorageModeShared];
+        [anArgEncoder setArgumentBuffer:anArgBuffer offset:0];
+        [anArgEncoder setIndirectCommandBuffer:anIcb atIndex:0];
+        [aSlotArgs addObject:anArgBuffer];
+      }
+      [theLayer.myCullArguments addObject:aSlotArgs];
+    }
+  }
+
+  const int aSlot = theCtx->CurrentFrameIndex() % Metal_MaxFramesInFlight;
+  NSArray* aSrcIcbs = theLayer.myCommandBuffers[aSlot];
+  NSArray* aDstIcbs = theLayer.myCulledCommandBuffers[aSlot];
+  NSArray* anArgs   = theLayer.myCullArguments[aSlot];
+
+  // restore all commands from recorded ones
+  id<MTLBlitCommandEncoder> aBlit = [theCmdBuffer blitCommandEncoder];
+  aBlit.label = @"GpuCullingCopy";
+  int aNbLeft = theLayer.NbDraws();
+  for (NSUInteger anIcbIter = 0; anIcbIter < [aSrcIcbs count]; ++anIcbIter)
+  {
+    const int aNbCommands = std::min(aNbLeft, Metal_IndirectLayer::MaxCommandsPerBuffer());
+    [aBlit copyIndirectCommandBuffer:aSrcIcbs[anIcbIter]
+                         sourceRange:NSMakeRange(0, static_cast<NSUInteger>(aNbCommands))
+                         destination:aDstIcbs[anIcbIter]
+                    destinationIndex:0];
+    aNbLeft -= aNbCommands;
+  }
+  [aBlit endEncoding];
+
+  // reset commands of invisible draws
+  id<MTLComputeCommandEncoder> anEncoder = [theCmdBuffer computeCommandEncoder];
+  anEncoder.label = @"GpuCulling";
+  [anEncoder setComputePipelineState:myCullPipeline->PipelineState()];
+  [anEncoder setBuffer:theLayer.myBoundsBuffer offset:0 atIndex:1];
+  [anEncoder setBuffer:theCtx->TransformBuffer()->Buffer() offset:0 atIndex:3];
+  if (myHasDepthPyramid)
+  {
+    [anEncoder setTexture:myDepthPyramid atIndex:0];
+  }
+
+  Metal_CullUniforms aUniforms;
+  memcpy(aUniforms.ViewProj, theViewProj.GetData(), sizeof(aUniforms.ViewProj));
+  aUniforms.ViewportSize[0] = float(theViewportX);
+  aUniforms.ViewportSize[1] = float(theViewportY);
+  aUniforms.HasDepthPyramid = (myHasDepthPyramid && myDepthPyramid != nil) ? 1 : 0;
+  aUniforms.NbLevels  = myDepthPyramid != nil ? uint32_t(myDepthPyramid.mipmapLevelCount) : 1;
+  aUniforms.NbTrsfs  = uint32_t(theCtx->TransformBuffer()->NbUploaded());
+  aUniforms.Padding  = 0;
+
+  const NSUInteger aGroupSize = static_cast<NSUInteger>(std::max(myCullPipeline->ThreadExecutionWidth(), 1));
+  aNbLeft = theLayer.NbDraws();
+  for (NSUInteger anIcbIter = 0; anIcbIter < [aDstIcbs count]; ++anIcbIter)
+  {
+    const int aNbCommands = std::min(aNbLeft, Metal_IndirectLayer::MaxCommandsPerBuffer());
+    aUniforms.NbDraws   = uint32_t(aNbCommands);
+    aUniforms.FirstDraw = uint32_t(anIcbIter) * uint32_t(Metal_IndirectLayer::MaxCommandsPerBuffer());
+    [anEncoder setBytes:&aUniforms length:sizeof(aUniforms) atIndex:0];
+    [anEncoder setBuffer:anArgs[anIcbIter] offset:0 atIndex:2];
+    [anEncoder useResource:aDstIcbs[anIcbIter] usage:MTLResourceUsageWrite];
+    [anEncoder dispatchThreadgroups:MTLSizeMake((NSUInteger(aNbCommands) + aGroupSize - 1) / aGroupSize, 1, 1)
+              threadsPerThreadgroup:MTLSizeMake(aGroupSize, 1, 1)];
+    aNbLeft -= aNbCommands;
+  }
+  [anEncoder endEncoding];
+
+  theLayer.myCulledSlot = aSlot;
+  return true;
+}
+
+// =======================================================================
+// function : BuildDepthPyramid
+// purpose  : Build depth pyramid from depth buffer of rendered frame
+// =======================================================================
+void Metal_GpuCulling::BuildDepthPyramid(Metal_Context* theCtx,
+                                         id<MTLCommandBuffer> theCmdBuffer,
+                                         id<MTLTexture> theDepth)
+{
+  if (!IsValid() || theCmdBuffer == nil || theDepth == nil
+   || (theDepth.usage & MTLTextureUsageShaderRead) == 0)
+  {
+    myHasDepthPyramid = false;
+    return;
+  }
+
+  const int aSizeX = int(theDepth.width);
+  const int aSizeY = int(theDepth.height);
+  if (myDepthPyramid == nil
+   || myPyramidSizeX != aSizeX
+   || myPyramidSizeY != aSizeY)
+  {
+    MTLTextureDescriptor* aDesc = [MTLTextureDescriptor texture2DDescriptorWithPixelFormat:MTLPixelFormatR32Float
+                                                                                     width:NSUInteger(aSizeX)
+                                                                                    height:NSUInteger(aSizeY)
+                                                                                 mipmapped:YES];
+    aDesc.storageMode = MTLStorageModePrivate;
+    aDesc.usage = MTLTextureUsageShaderRead | MTLTextureUsageShaderWrite | MTLTextureUsagePixelFormatView;
+    myDepthPyramid = [theCtx->Device() newTextureWithDescriptor:aDesc];
+    myPyramidLevels = [NSMutableArray array];
+    myHasDepthPyramid = false;
+    if (myDepthPyramid == nil)
+    {
+      return;
+    }
+    for (NSUInteger aLevel = 0; aLevel < myDepthPyramid.mipmapLevelCount; ++aLevel)
+    {
+      [myPyramidLevels addObject:[myDepthPyramid newTextureViewWithPixelFormat:MTLPixelFormatR32Float
+                                                                   textureType:MTLTextureType2D
+                                                                        levels:NSMakeRange(aLevel, 1)
+                                                                        slices:NSMakeRange(0, 1)]];
+    }
+    myPyramidSizeX = aSizeX;
+    myPyramidSizeY = aSizeY;
+  }
+
+  id<MTLComputeCommandEncoder> anEncoder = [theCmdBuffer computeCommandEncoder];
+  anEncoder.label = @"DepthPyramid";
+  [anEncoder setComputePipelineState:myDepthInitPipeline->PipelineState()];
+  [anEncoder setTexture:theDepth atIndex:0];
+  [anEncoder setTexture:myPyramidLevels[0] atIndex:1];
+  MTLSize aGroupSize = myDepthInitPipeline->OptimalThreadgroupSize2D(aSizeX, aSizeY);
+  [anEncoder dispatchThreadgroups:myDepthInitPipeline->ThreadgroupCount2D(aSizeX, aSizeY, aGroupSize)
+            threadsPerThreadgroup:aGroupSize];
+
+  [anEncoder setComputePipelineState:myDepthReducePipeline->PipelineState()];
+  for (NSUInteger aLevel = 1; aLevel < [myPyramidLevels count]; ++aLevel)
+  {
+    id<MTLTexture> aDst = myPyramidLevels[aLevel];
+    const int aLevelX = int(aDst.width);
+    const int aLevelY = int(aDst.height);
+    [anEncoder setTexture:myPyramidLevels[aLevel - 1] atIndex:0];
+    [anEncoder setTexture:aDst atIndex:1];
+    aGroupSize = myDepthReducePipeline->OptimalThreadgroupSize2D(aLevelX, aLevelY);
+    [anEncoder dispatchThreadgroups:myDepthReducePipeline->ThreadgroupCount2D(aLevelX, aLevelY, aGroupSize)
+              threadsPerThreadgroup:aGroupSize];
+  }
+  [anEncoder endEncoding];
+  myHasDepthPyramid = true;
+}
@@ -0,0 +1,138 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef Metal_GpuTimer_HeaderFile
+#define Metal_GpuTimer_HeaderFile
+
+#include <Graphic3d_FrameStatsTimer.hxx>
+#include <Standard_Transient.hxx>
+#include <Standard_Type.hxx>
+
+#include <mutex>
+
+#ifdef __OBJC__
+@protocol MTLCommandBuffer;
+@protocol MTLComputeCommandEncoder;
+@protocol MTLCounterSampleBuffer;
+@protocol MTLDevice;
+@class MTLRenderPassDescriptor;
+#endif
+
+class Metal_Context;
+
+//! GPU timer measuring duration of render and compute passes.
+//! Timestamps are sampled at encoder boundaries into MTLCounterSampleBuffer
+//! (sampleBufferAttachments of pass descriptors), when the device supports counter sampling
+//! at stage boundary; otherwise only the duration of command buffers is measured
+//! through GPUStartTime / GPUEndTime properties.
+//! Results are resolved by completion handlers and accumulated until FetchResults().
+//! Passes are not measured while the timer is inactive (see SetActive()).
+class Metal_GpuTimer : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(Metal_GpuTimer, Standard_Transient)
+public:
+
+  //! Number of passes which can be measured simultaneously (by all frames in flight).
+  static constexpr int NbPassSlots = 512;
+
+public:
+
+  //! Empty constructor.
+  Standard_EXPORT Metal_GpuTimer();
+
+  //! Destructor.
+  Standard_EXPORT ~Metal_GpuTimer() override;
+
+  //! Create counter sample buffer, when supported.
+  Standard_EXPORT bool Init(Metal_Context* theCtx);
+
+  //! Release sample buffer; results of passes in flight are discarded.
+  Standard_EXPORT void Release();
+
+  //! Return TRUE if passes are measured.
+  bool IsActive() const { return myIsActive; }
+
+  //! Enable or disable measurements (should be enabled only while frame time is collected).
+  void SetActive(bool theIsActive) { myIsActive = theIsActive; }
+
+  //! Return TRUE if individual passes can be measured (counters sampling at stage boundary).
+  bool HasPassTimers() const { return mySampleBuffer != nil; }
+
+  //! Move accumulated GPU times of completed passes into array indexed by Graphic3d_FrameStatsTimer
+  //! (only GPU timers are modified) and reset them.
+  //! @return number of completed frames since previous call
+  Standard_EXPORT int FetchResults(double* theTimes);
+
+#ifdef __OBJC__
+  //! Measure the whole frame command buffer into Graphic3d_FrameStatsTimer_GpuFrame;
+  //! should be called once per frame before committing.
+  Standard_EXPORT void AttachFrame(id<MTLCommandBuffer> theCmdBuffer);
+
+  //! Measure render pass, which should be created from the descriptor right after this call.
+  //! @param theCmdBuffer   command buffer to encode the pass
+  //! @param thePassDesc    render (or parallel render) pass descriptor
+  //! @param theTimer       GPU timer to accumulate duration
+  //! @param theIsOwnBuffer when TRUE, the command buffer contains only this pass,
+  //!                       so that it is measured by GPUStartTime/GPUEndTime without counters support
+  Standard_EXPORT void AttachRenderPass(id<MTLCommandBuffer> theCmdBuffer,
+                                        MTLRenderPassDescriptor* thePassDesc,
+                                        Graphic3d_FrameStatsTimer theTimer,
+                                        bool theIsOwnBuffer = false);
+
+  //! Create compute encoder measured by specified timer, or a regular one when timer is inactive.
+  Standard_EXPORT id<MTLComputeCommandEncoder> ComputeEncoder(id<MTLCommandBuffer> theCmdBuffer,
+                                                              Graphic3d_FrameStatsTimer theTimer);
+#endif
+
+protected:
+
+  //! Reserve pair of samples; returns first sample index or -1.
+  Standard_EXPORT int reservePass();
+
+  //! Update GPU ticks to seconds conversion from device timestamps.
+  Standard_EXPORT void calibrate();
+
+  //! Accumulate resolved time.
+  Standard_EXPORT void addTime(Graphic3d_FrameStatsTimer theTimer, double theSeconds);
+
+  //! Accumulate resolved frame time.
+  Standard_EXPORT void addFrame(double theSeconds);
+
+#ifdef __OBJC__
+  //! Register completion handler resolving the pair of samples into specified timer.
+  Standard_EXPORT void resolvePass(id<MTLCommandBuffer> theCmdBuffer,
+                                   int theSample,
+                                   Graphic3d_FrameStatsTimer theTimer);
+#endif
+
+protected:
+
+  double             myTimes[Graphic3d_FrameStatsTimer_NB]; //!< accumulated times of completed passes
+  int                myNbFrames;     //!< number of completed frames
+  int                myNextSlot;     //!< next pair of samples within sample buffer
+  double             myTickPeriod;   //!< duration of GPU timestamp tick in seconds
+  uint64_t           myCalibCpu;     //!< CPU timestamp of last calibration
+  uint64_t           myCalibGpu;     //!< GPU timestamp of last calibration
+  bool               myIsActive;     //!< measurements flag
+  mutable std::mutex myMutex;        //!< lock for results written by completion handlers
+
+#ifdef __OBJC__
+  id<MTLDevice>              myDevice;       //!< device for timestamps calibration
+  id<MTLCounterSampleBuffer> mySampleBuffer; //!< timestamps storage (2 samples per pass)
+#else
+  void*                      myDevice;
+  void*                      mySampleBuffer;
+#endif
+};
+
+#endif // Metal_GpuTimer_HeaderFile
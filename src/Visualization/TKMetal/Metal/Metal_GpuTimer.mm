@@ -0,0 +1,354 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#import <Metal/Metal.h>
+
+#include <Metal_GpuTimer.hxx>
+#include <Metal_Context.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(Metal_GpuTimer, Standard_Transient)
+
+namespace
+{
+  //! Minimal interval between timestamps calibrations in nanoseconds.
+  static const uint64_t THE_CALIBRATION_INTERVAL_NS = 200000000;
+}
+
+// =======================================================================
+// function : Metal_GpuTimer
+// purpose  : Constructor
+// =======================================================================
+Metal_GpuTimer::Metal_GpuTimer()
+: myNbFrames(0),
+  myNextSlot(0),
+  myTickPeriod(1.0e-9),
+  myCalibCpu(0),
+  myCalibGpu(0),
+  myIsActive(false),
+  myDevice(nil),
+  mySampleBuffer(nil)
+{
+  for (int aTimerIter = 0; aTimerIter < Graphic3d_FrameStatsTimer_NB; ++aTimerIter)
+  {
+    myTimes[aTimerIter] = 0.0;
+  }
+}
+
+// =======================================================================
+// function : ~Metal_GpuTimer
+// purpose  : Destructor
+// =======================================================================
+Metal_GpuTimer::~Metal_GpuTimer()
+{
+  Release();
+}
+
+// =======================================================================
+// function : Init
+// purpose  : Create counter sample buffer
+// =======================================================================
+bool Metal_GpuTimer::Init(Metal_Context* theCtx)
+{
+  Release();
+  if (theCtx == nullptr || theCtx->Device() == nil)
+  {
+    return false;
+  }
+
+  myDevice = theCtx->Device();
+  if (@available(macOS 11.0, iOS 14.0, *))
+  {
+    if (![myDevice supportsCounterSampling:MTLCounterSamplingPointAtStageBoundary])
+    {
+      theCtx->Messenger()->SendTrace() << "Metal_GpuTimer: counters sampling at stage boundary is unsupported,"
+                                          " only command buffers will be measured";
+      return true;
+    }
+
+    id<MTLCounterSet> aTimestampSet = nil;
+    for (id<MTLCounterSet> aSet in myDevice.counterSets)
+    {
+      if ([aSet.name isEqualToString:MTLCommonCounterSetTimestamp])
+      {
+        aTimestampSet = aSet;
+        break;
+      }
+    }
+    if (aTimestampSet == nil)
+    {
+      return true;
+    }
+
+    MTLCounterSampleBufferDescriptor* aDesc = [[MTLCounterSampleBufferDescriptor alloc] init];
+    aDesc.counterSet  = aTimestampSet;
+    aDesc.storageMode = MTLStorageModeShared;
+    aDesc.sampleCount = 2 * NbPassSlots;
+    aDesc.label       = @"GpuTimer";
+
+    NSError* anError = nil;
+    mySampleBuffer = [myDevice newCounterSampleBufferWithDescriptor:aDesc error:&anError];
+    if (mySampleBuffer == nil)
+    {
+      theCtx->Messenger()->SendWarning() << "Metal_GpuTimer: unable to create counter sample buffer"
+                                         << (anError != nil ? ": " : "")
+                                         << (anError != nil ? [anError.localizedDescription UTF8String] : "");
+    }
+  }
+  calibrate();
+  return true;
+}
+
+// =======================================================================
+// function : Release
+// purpose  : Release sample buffer
+// =======================================================================
+void Metal_GpuTimer::Release()
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  mySampleBuffer = nil;
+  myDevice = nil;
+  myNextSlot = 0;
+  myNbFrames = 0;
+  for (int aTimerIter = 0; aTimerIter < Graphic3d_FrameStatsTimer_NB; ++aTimerIter)
+  {
+    myTimes[aTimerIter] = 0.0;
+  }
+}
+
+// =======================================================================
+// function : FetchResults
+// purpose  : Move accumulated GPU times into array
+// =======================================================================
+int Metal_GpuTimer::FetchResults(double* theTimes)
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  for (int aTimerIter = Graphic3d_FrameStatsTimer_GpuLower;
+       aTimerIter <= Graphic3d_FrameStatsTimer_GpuUpper; ++aTimerIter)
+  {
+    theTimes[aTimerIter] = myTimes[aTimerIter];
+    myTimes[aTimerIter] = 0.0;
+  }
+  const int aNbFrames = myNbFrames;
+  myNbFrames = 0;
+  return aNbFrames;
+}
+
+// =======================================================================
+// function : AttachFrame
+// purpose  : Measure frame command buffer
+// =======================================================================
+void Metal_GpuTimer::AttachFrame(id<MTLCommandBuffer> theCmdBuffer)
+{
+  if (!myIsActive || theCmdBuffer == nil)
+  {
+    return;
+  }
+
+  calibrate();
+  occ::handle<Metal_GpuTimer> aSelf(this);
+  [theCmdBuffer addCompletedHandler:^(id<MTLCommandBuffer> theBuffer)
+  {
+    if (theBuffer.status == MTLCommandBufferStatusCompleted
+     && theBuffer.GPUEndTime > theBuffer.GPUStartTime)
+    {
+      aSelf->addFrame(theBuffer.GPUEndTime - theBuffer.GPUStartTime);
+    }
+  }];
+}
+
+// =======================================================================
+// function : AttachRenderPass
+// purpose  : Measure render pass
+// =======================================================================
+void Metal_GpuTimer::AttachRenderPass(id<MTLCommandBuffer> theCmdBuffer,
+                                      MTLRenderPassDescriptor* thePassDesc,
+                                      Graphic3d_FrameStatsTimer theTimer,
+                                      bool theIsOwnBuffer)
+{
+  if (theCmdBuffer == nil || thePassDesc == nil)
+  {
+    return;
+  }
+
+  if (@available(macOS 11.0, iOS 14.0, *))
+  {
+    MTLRenderPassSampleBufferAttachmentDescriptor* anAttachment = thePassDesc.sampleBufferAttachments[0];
+    const int aSample = myIsActive && mySampleBuffer != nil ? reservePass() : -1;
+    if (aSample < 0)
+    {
+      // descriptor might be reused from previous frames
+      anAttachment.sampleBuffer = nil;
+    }
+    else
+    {
+      anAttachment.sampleBuffer = mySampleBuffer;
+      anAttachment.startOfVertexSampleIndex   = NSUInteger(aSample);
+      anAttachment.endOfVertexSampleIndex     = MTLCounterDontSample;
+      anAttachment.startOfFragmentSampleIndex = MTLCounterDontSample;
+      anAttachment.endOfFragmentSampleIndex   = NSUInteger(aSample + 1);
+      resolvePass(theCmdBuffer, aSample, theTimer);
+      return;
+    }
+  }
+
+  if (!myIsActive || !theIsOwnBuffer)
+  {
+    return;
+  }
+
+  occ::handle<Metal_GpuTimer> aSelf(this);
+  [theCmdBuffer addCompletedHandler:^(id<MTLCommandBuffer> theBuffer)
+  {
+    if (theBuffer.status == MTLCommandBufferStatusCompleted
+     && theBuffer.GPUEndTime > theBuffer.GPUStartTime)
+    {
+      aSelf->addTime(theTimer, theBuffer.GPUEndTime - theBuffer.GPUStartTime);
+    }
+  }];
+}
+
+// =======================================================================
+// function : ComputeEncoder
+// purpose  : Create measured compute encoder
+// =======================================================================
+id<MTLComputeCommandEncoder> Metal_GpuTimer::ComputeEncoder(id<MTLCommandBuffer> theCmdBuffer,
+                                                            Graphic3d_FrameStatsTimer theTimer)
+{
+  if (theCmdBuffer == nil)
+  {
+    return nil;
+  }
+
+  if (@available(macOS 11.0, iOS 14.0, *))
+  {
+    const int aSample = myIsActive && mySampleBuffer != nil ? reservePass() : -1;
+    if (aSample >= 0)
+    {
+      MTLComputePassDescriptor* aPassDesc = [MTLComputePassDescriptor computePassDescriptor];
+      MTLComputePassSampleBufferAttachmentDescriptor* anAttachment = aPassDesc.sampleBufferAttachments[0];
+      anAttachment.sampleBuffer = mySampleBuffer;
+      anAttachment.startOfEncoderSampleIndex = NSUInteger(aSample);
+      anAttachment.endOfEncoderSampleIndex   = NSUInteger(aSample + 1);
+      resolvePass(theCmdBuffer, aSample, theTimer);
+      return [theCmdBuffer computeCommandEncoderWithDescriptor:aPassDesc];
+    }
+  }
+  return [theCmdBuffer computeCommandEncoder];
+}
+
+// =======================================================================
+// function : reservePass
+// purpose  : Reserve pair of samples
+// =======================================================================
+int Metal_GpuTimer::reservePass()
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  if (mySampleBuffer == nil)
+  {
+    return -1;
+  }
+
+  // slots are reused in a ring, which is large enough to cover frames in flight
+  const int aSample = myNextSlot * 2;
+  myNextSlot = (myNextSlot + 1) % NbPassSlots;
+  return aSample;
+}
+
+// =======================================================================
+// function : resolvePass
+// purpose  : Resolve samples on command buffer completion
+// =======================================================================
+void Metal_GpuTimer::resolvePass(id<MTLCommandBuffer> theCmdBuffer,
+                                 int theSample,
+                                 Graphic3d_FrameStatsTimer theTimer)
+{
+  id<MTLCounterSampleBuffer> aSampleBuffer = mySampleBuffer;
+  const double aTickPeriod = myTickPeriod;
+  occ::handle<Metal_GpuTimer> aSelf(this);
+  [theCmdBuffer addCompletedHandler:^(id<MTLCommandBuffer> theBuffer)
+  {
+    if (theBuffer.status != MTLCommandBufferStatusCompleted)
+    {
+      return;
+    }
+
+    NSData* aData = [aSampleBuffer resolveCounterRange:NSMakeRange(NSUInteger(theSample), 2)];
+    if (aData == nil || aData.length < 2 * sizeof(MTLCounterResultTimestamp))
+    {
+      return;
+    }
+
+    // pass without vertex or fragment work leaves error value within the sample
+    const MTLCounterResultTimestamp* aStamps = (const MTLCounterResultTimestamp*)aData.bytes;
+    if (aStamps[0].timestamp == MTLCounterErrorValue
+     || aStamps[1].timestamp == MTLCounterErrorValue
+     || aStamps[1].timestamp <= aStamps[0].timestamp)
+    {
+      return;
+    }
+    aSelf->addTime(theTimer, double(aStamps[1].timestamp - aStamps[0].timestamp) * aTickPeriod);
+  }];
+}
+
+// =======================================================================
+// function : calibrate
+// purpose  : Update GPU ticks to seconds conversion
+// =======================================================================
+void Metal_GpuTimer::calibrate()
+{
+  if (myDevice == nil)
+  {
+    return;
+  }
+
+  if (@available(macOS 10.15, iOS 14.0, *))
+  {
+    MTLTimestamp aCpuTime = 0, aGpuTime = 0;
+    [myDevice sampleTimestamps:&aCpuTime gpuTimestamp:&aGpuTime];
+    if (myCalibCpu != 0
+     && aCpuTime < myCalibCpu + THE_CALIBRATION_INTERVAL_NS)
+    {
+      // interval is too short for precise estimation
+      return;
+    }
+
+    if (myCalibCpu != 0 && aGpuTime > myCalibGpu)
+    {
+      // CPU timestamps are in nanoseconds
+      myTickPeriod = double(aCpuTime - myCalibCpu) * 1.0e-9 / double(aGpuTime - myCalibGpu);
+    }
+    myCalibCpu = aCpuTime;
+    myCalibGpu = aGpuTime;
+  }
+}
+
+// =======================================================================
+// function : addTime
+// purpose  : Accumulate resolved time
+// =======================================================================
+void Metal_GpuTimer::addTime(Graphic3d_FrameStatsTimer theTimer, double theSeconds)
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  myTimes[theTimer] += theSeconds;
+}
+
+// =======================================================================
+// function : addFrame
+// purpose  : Accumulate resolved frame time
+// =======================================================================
+void Metal_GpuTimer::addFrame(double theSeconds)
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  myTimes[Graphic3d_FrameStatsTimer_GpuFrame] += theSeconds;
+  ++myNbFrames;
+}
@@ -39,7 +39,24 @@ private:
   size_t myCounter;
 };
 
+//! Kinds of jobs which might be targeted to a device other than the one of interactive views.
+enum Metal_DeviceJob
+{
+  Metal_DeviceJob_View = 0,               //!< interactive views (device of shared context)
+  Metal_DeviceJob_PathTracing,            //!< path tracing
+  Metal_DeviceJob_AccelerationStructures, //!< ray tracing acceleration structures builds
+  Metal_DeviceJob_PBRBaking,              //!< PBR environment baking
+  Metal_DeviceJob_Offscreen               //!< offscreen rendering (thumbnails, image dumps)
+};
+
+//! Number of Metal_DeviceJob values.
+static const int Metal_DeviceJob_NB = Metal_DeviceJob_Offscreen + 1;
+
 //! This class defines a Metal graphic driver.
+//!
+//! Heavy jobs might be targeted to another device (e.g. discrete GPU or eGPU on multi-GPU systems)
+//! by SetJobDevice() or AssignJobsToHighPerformanceDevice(); JobContext() returns context
+//! created for the device of the job, and Metal_DeviceHandoff passes results between devices.
 class Metal_GraphicDriver : public Graphic3d_GraphicDriver
 {
   DEFINE_STANDARD_RTTIEXT(Metal_GraphicDriver, Graphic3d_GraphicDriver)
@@ -145,6 +162,24 @@ public: //! @name Context access
   //! Set device lost flag for redrawn views.
   Standard_EXPORT void setDeviceLost();
 
+public: //! @name Multi-GPU jobs
+
+  //! Return registry ID of the device targeted by the job (0 means device of shared context).
+  uint64_t JobDevice(Metal_DeviceJob theJob) const { return myJobDevices[theJob]; }
+
+  //! Target the job to the device with specified registry ID (see Metal_Context::EnumerateDevices());
+  //! 0 means device of shared context. Interactive views always use shared context.
+  Standard_EXPORT void SetJobDevice(Metal_DeviceJob theJob, uint64_t theRegistryId);
+
+  //! Target path tracing, acceleration structures, PBR baking and offscreen jobs to high-performance device
+  //! other than the device of shared context: headless or removable non-low-power GPU is preferred.
+  //! @return FALSE if there is no such device (jobs are kept on the device of shared context)
+  Standard_EXPORT bool AssignJobsToHighPerformanceDevice();
+
+  //! Return context for the job: shared context, or context of another device created on first request.
+  //! Could return NULL-handle if context of the device cannot be initialized.
+  Standard_EXPORT const occ::handle<Metal_Context>& JobContext(Metal_DeviceJob theJob);
+
 public: //! @name State counters
 
   //! State counter for Metal structures.
@@ -157,6 +192,8 @@ protected:
 
   occ::handle<Metal_Caps>    myCaps;           //!< Capabilities configuration
   occ::handle<Metal_Context> mySharedContext;  //!< Shared Metal context
+  NCollection_DataMap<uint64_t, occ::handle<Metal_Context>> myDeviceContexts; //!< contexts of job devices other than shared one
+  uint64_t                   myJobDevices[Metal_DeviceJob_NB]; //!< registry IDs of job devices
 
   NCollection_Map<occ::handle<Metal_View>>   myMapOfView;      //!< Map of views
   NCollection_DataMap<int, Metal_Structure*> myMapOfStructure; //!< Map of structures
@@ -12,11 +12,13 @@
 // commercial license or contractual agreement.
 
 #include <Metal_GraphicDriver.hxx>
+#include <Metal_PageAllocator.hxx>
 #include <Metal_View.hxx>
 #include <Metal_Window.hxx>
 #include <Metal_Structure.hxx>
 #include <Font_FontMgr.hxx>
 #include <Font_FTFont.hxx>
+#include <Graphic3d_Buffer.hxx>
 #include <Graphic3d_StructureManager.hxx>
 #include <Graphic3d_TypeOfLimit.hxx>
 #include <NCollection_String.hxx>
@@ -32,6 +34,10 @@ Metal_GraphicDriver::Metal_GraphicDriver(const occ::handle<Aspect_DisplayConnect
 : Graphic3d_GraphicDriver(theDisp),
   myCaps(new Metal_Caps())
 {
+  for (int aJobIter = 0; aJobIter < Metal_DeviceJob_NB; ++aJobIter)
+  {
+    myJobDevices[aJobIter] = 0;
+  }
   if (theToInitialize)
   {
     InitContext();
@@ -77,6 +83,14 @@ void Metal_GraphicDriver::ReleaseContext()
   // }
   // myMapOfStructure.Clear();
 
+  // Release contexts of job devices
+  for (NCollection_DataMap<uint64_t, occ::handle<Metal_Context>>::Iterator aCtxIter(myDeviceContexts);
+       aCtxIter.More(); aCtxIter.Next())
+  {
+    aCtxIter.Value()->forcedRelease();
+  }
+  myDeviceContexts.Clear();
+
   // Release context
   if (!mySharedContext.IsNull())
   {
@@ -105,6 +119,14 @@ bool Metal_GraphicDriver::InitContext()
     // Not fatal - shaders will be created on demand
   }
 
+  // Allocate vertex data of new presentations in memory which can be adopted by GPU without copying
+  if (myCaps->useZeroCopyArrays
+   && mySharedContext->HasUnifiedMemory()
+   && !Graphic3d_Buffer::DefaultAllocator()->IsKind(STANDARD_TYPE(Metal_PageAllocator)))
+  {
+    Graphic3d_Buffer::SetDefaultAllocator(new Metal_PageAllocator());
+  }
+
   return true;
 }
 
@@ -172,6 +194,11 @@ occ::handle<Graphic3d_CStructure> Metal_GraphicDriver::CreateStructure(
   const occ::handle<Graphic3d_StructureManager>& theManager)
 {
   occ::handle<Metal_Structure> aStructure = new Metal_Structure(theManager);
+  if (!mySharedContext.IsNull())
+  {
+    aStructure->SetResidencyManager(mySharedContext->ResidencyManager());
+    aStructure->SetTransformBuffer(mySharedContext->TransformBuffer());
+  }
   return aStructure;
 }
 
@@ -506,3 +533,98 @@ void Metal_GraphicDriver::setDeviceLost()
     aViewIter.Value()->SetImmediateModeDrawToFront(false);
   }
 }
+
+// =======================================================================
+// function : SetJobDevice
+// purpose  : Target the job to specified device
+// =======================================================================
+void Metal_GraphicDriver::SetJobDevice(Metal_DeviceJob theJob, uint64_t theRegistryId)
+{
+  if (theJob == Metal_DeviceJob_View)
+  {
+    return;
+  }
+  myJobDevices[theJob] = theRegistryId;
+}
+
+// =======================================================================
+// function : AssignJobsToHighPerformanceDevice
+// purpose  : Target heavy jobs to high-performance device
+// =======================================================================
+bool Metal_GraphicDriver::AssignJobsToHighPerformanceDevice()
+{
+  const uint64_t aViewDevice = !mySharedContext.IsNull() ? mySharedContext->DeviceRegistryId() : 0;
+  NCollection_Sequence<Metal_DeviceInfo> aDevices;
+  Metal_Context::EnumerateDevices(aDevices);
+
+  // headless or external GPU is not loaded by display composition
+  const Metal_DeviceInfo* aBest = nullptr;
+  int aBestScore = 0;
+  for (NCollection_Sequence<Metal_DeviceInfo>::Iterator aDevIter(aDevices); aDevIter.More(); aDevIter.Next())
+  {
+    const Metal_DeviceInfo& aDevice = aDevIter.Value();
+    if (aDevice.RegistryId == aViewDevice
+     || aDevice.IsLowPower)
+    {
+      continue;
+    }
+
+    const int aScore = 1 + (aDevice.IsHeadless ? 2 : 0) + (aDevice.IsRemovable ? 1 : 0);
+    if (aBest == nullptr
+     || aScore > aBestScore
+     || (aScore == aBestScore && aDevice.WorkingSetSize > aBest->WorkingSetSize))
+    {
+      aBest = &aDevice;
+      aBestScore = aScore;
+    }
+  }
+  if (aBest == nullptr)
+  {
+    return false;
+  }
+
+  for (int aJobIter = Metal_DeviceJob_View + 1; aJobIter < Metal_DeviceJob_NB; ++aJobIter)
+  {
+    myJobDevices[aJobIter] = aBest->RegistryId;
+  }
+  Message::SendInfo() << "Metal_GraphicDriver: heavy jobs are targeted to device '" << aBest->Name << "'";
+  return true;
+}
+
+// =======================================================================
+// function : JobContext
+// purpose  : Return context for the job
+// =======================================================================
+const occ::handle<Metal_Context>& Metal_GraphicDriver::JobContext(Metal_DeviceJob theJob)
+{
+  const uint64_t aDevice = myJobDevices[theJob];
+  if (aDevice == 0
+   || mySharedContext.IsNull()
+   || aDevice == mySharedContext->DeviceRegistryId())
+  {
+    return mySharedContext;
+  }
+
+  if (const occ::handle<Metal_Context>* aCtx = myDeviceContexts.Seek(aDevice))
+  {
+    return *aCtx;
+  }
+
+  // job context has own copy of options with device defined explicitly
+  occ::handle<Metal_Caps> aCaps = new Metal_Caps();
+  *aCaps = *myCaps;
+  aCaps->deviceRegistryId = aDevice;
+  occ::handle<Metal_Context> aCtx = new Metal_Context(aCaps);
+  aCtx->SetMessenger(mySharedContext->Messenger());
+  if (!aCtx->Init()
+    || aCtx->DeviceRegistryId() != aDevice)
+  {
+    aCtx->forcedRelease();
+    aCtx.Nullify();
+  }
+  else
+  {
+    aCtx->InitDefaultShaders();
+  }
+  return *myDeviceContexts.Bound(aDevice, aCtx);
+}
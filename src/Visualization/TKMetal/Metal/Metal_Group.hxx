@@ -18,10 +18,12 @@
 #include <Graphic3d_Structure.hxx>
 #include <Graphic3d_Aspects.hxx>
 #include <NCollection_List.hxx>
+#include <NCollection_Mat4.hxx>
 
 class Metal_Structure;
 class Metal_Context;
 class Metal_Workspace;
+class Metal_BSplineSurface;
 class Metal_PrimitiveArray;
 class Metal_Text;
 
@@ -71,6 +73,13 @@ public:
   Standard_EXPORT void AddText(const occ::handle<Graphic3d_Text>& theTextParams,
                                const bool theToEvalMinMax) override;
 
+  //! Add B-spline surface drawn by GPU tessellation in shaded mode (see Metal_TessellationController::DrawBSplineSurface()).
+  //! The surface is not cast into shadow maps, not ray-traced and not recorded into indirect command buffers.
+  //! @param[in] theSurface      surface to add
+  //! @param[in] theToEvalMinMax flag to extend group bounding box by control net
+  Standard_EXPORT void AddBSplineSurface(const occ::handle<Metal_BSplineSurface>& theSurface,
+                                         const bool theToEvalMinMax = true);
+
   //! Add stencil test element.
   Standard_EXPORT void SetStencilTestOptions(const bool theIsEnabled) override;
 
@@ -78,6 +87,9 @@ public:
   Standard_EXPORT void SetFlippingOptions(const bool theIsEnabled,
                                           const gp_Ax2& theRefPlane) override;
 
+  //! Set transformation of the group geometry relative to the structure.
+  Standard_EXPORT void SetTransformation(const gp_Trsf& theTrsf) override;
+
 public:
 
   //! Return parent Metal structure.
@@ -89,6 +101,11 @@ public:
   //! Release GPU resources.
   Standard_EXPORT virtual void Release(Metal_Context* theCtx);
 
+  //! Release GPU buffers of primitive arrays keeping their CPU data,
+  //! so that they are uploaded again on next rendering (see Metal_ResidencyManager).
+  //! @return released bytes
+  Standard_EXPORT size_t ReleaseGpuBuffers(Metal_Context* theCtx);
+
   //! Return TRUE if group contains primitives with transform persistence.
   bool HasPersistence() const
   {
@@ -105,14 +122,42 @@ public:
   //! Return the flipping reference plane.
   const gp_Ax2& FlippingRefPlane() const { return myFlippingRefPlane; }
 
+  //! Return true if the group has own (non-identity) Transformation().
+  bool HasTransformation() const { return myHasTrsf; }
+
+  //! Return the group transformation as matrix to be applied after structure transformation.
+  const NCollection_Mat4<float>& TransformationMatrix() const { return myTrsfMat; }
+
+  //! Return primitive arrays of the group.
+  const NCollection_List<Metal_PrimitiveArray*>& Primitives() const { return myPrimitives; }
+
+  //! Return TRUE if group contains text elements.
+  bool HasTexts() const { return !myTexts.IsEmpty(); }
+
+  //! Return TRUE if group contains B-spline surfaces.
+  bool HasBSplineSurfaces() const { return !myBSplineSurfaces.IsEmpty(); }
+
+  //! Return TRUE if group contains point arrays rendered with level of detail (see Metal_PointCloud),
+  //! or point arrays not yet initialized, which might become such.
+  Standard_EXPORT bool HasPointClouds() const;
+
+protected:
+
+  //! Increment modification state of parent structure
+  //! (invalidates render commands recorded for it, see Metal_IndirectLayer).
+  Standard_EXPORT void invalidateStructure() const;
+
 protected:
 
   occ::handle<Graphic3d_Aspects>          myAspect;             //!< group aspect
   NCollection_List<Metal_PrimitiveArray*> myPrimitives;         //!< list of primitive arrays
   NCollection_List<occ::handle<Metal_Text>> myTexts;            //!< list of text elements
+  NCollection_List<occ::handle<Metal_BSplineSurface>> myBSplineSurfaces; //!< surfaces tessellated on GPU
   bool                                    myStencilTestEnabled; //!< stencil test flag
   bool                                    myFlippingEnabled;    //!< flipping flag
   gp_Ax2                                  myFlippingRefPlane;   //!< flipping reference plane
+  NCollection_Mat4<float>                 myTrsfMat;            //!< group transformation matrix
+  bool                                    myHasTrsf;            //!< non-identity group transformation flag
 };
 
 #endif // Metal_Group_HeaderFile
@@ -14,6 +14,7 @@
 #import <Foundation/Foundation.h>
 
 #include <Metal_Group.hxx>
+#include <Metal_BSplineSurface.hxx>
 #include <Metal_Structure.hxx>
 #include <Metal_Context.hxx>
 #include <Metal_Workspace.hxx>
@@ -33,7 +34,8 @@ Metal_Group::Metal_Group(const occ::handle<Graphic3d_Structure>& theStruct)
 : Graphic3d_Group(theStruct),
   myStencilTestEnabled(false),
   myFlippingEnabled(false),
-  myFlippingRefPlane(gp::XOY())
+  myFlippingRefPlane(gp::XOY()),
+  myHasTrsf(false)
 {
   //
 }
@@ -53,6 +55,7 @@ Metal_Group::~Metal_Group()
 // =======================================================================
 void Metal_Group::Clear(const bool theToUpdateStructureMgr)
 {
+  invalidateStructure();
   Release(nullptr);
   Graphic3d_Group::Clear(theToUpdateStructureMgr);
 }
@@ -74,6 +77,7 @@ void Metal_Group::SetGroupPrimitivesAspect(
   const occ::handle<Graphic3d_Aspects>& theAspect)
 {
   myAspect = theAspect;
+  invalidateStructure();
 }
 
 // =======================================================================
@@ -85,6 +89,7 @@ void Metal_Group::SetPrimitivesAspect(
 {
   // For non-bounded groups, we just update the current aspect
   myAspect = theAspect;
+  invalidateStructure();
 }
 
 // =======================================================================
@@ -93,7 +98,8 @@ void Metal_Group::SetPrimitivesAspect(
 // =======================================================================
 void Metal_Group::SynchronizeAspects()
 {
-  // Nothing special needed for now
+  // aspect content might be modified - invalidate recorded commands
+  invalidateStructure();
 }
 
 // =======================================================================
@@ -112,6 +118,7 @@ void Metal_Group::ReplaceAspects(
   if (theMap.Find(myAspect, aNewAspect))
   {
     myAspect = aNewAspect;
+    invalidateStructure();
   }
 }
 
@@ -134,6 +141,7 @@ void Metal_Group::AddPrimitiveArray(const Graphic3d_TypeOfPrimitiveArray theType
   Metal_PrimitiveArray* aPrimArray = new Metal_PrimitiveArray(theType, theIndices,
                                                                theAttribs, theBounds);
   myPrimitives.Append(aPrimArray);
+  invalidateStructure();
   Message::SendTrace() << "Metal_Group::AddPrimitiveArray: added primitive type " << (int)theType
                        << " with " << theAttribs->NbElements << " vertices";
 
@@ -159,6 +167,7 @@ void Metal_Group::AddText(const occ::handle<Graphic3d_Text>& theTextParams,
   // Create Metal text element
   occ::handle<Metal_Text> aText = new Metal_Text(theTextParams);
   myTexts.Append(aText);
+  invalidateStructure();
 
   // Update bounding box if requested
   if (theToEvalMinMax)
@@ -168,6 +177,31 @@ void Metal_Group::AddText(const occ::handle<Graphic3d_Text>& theTextParams,
   }
 }
 
+// =======================================================================
+// function : AddBSplineSurface
+// purpose  : Add B-spline surface tessellated on GPU
+// =======================================================================
+void Metal_Group::AddBSplineSurface(const occ::handle<Metal_BSplineSurface>& theSurface,
+                                    const bool theToEvalMinMax)
+{
+  if (theSurface.IsNull()
+  || !theSurface->IsValid())
+  {
+    return;
+  }
+
+  myBSplineSurfaces.Append(theSurface);
+  invalidateStructure();
+
+  // surface lies within convex hull of its control net
+  if (theToEvalMinMax)
+  {
+    const Graphic3d_BndBox3d& aBox = theSurface->BoundingBox();
+    myBounds.Add(NCollection_Vec4<float>(float(aBox.CornerMin().x()), float(aBox.CornerMin().y()), float(aBox.CornerMin().z()), 1.0f));
+    myBounds.Add(NCollection_Vec4<float>(float(aBox.CornerMax().x()), float(aBox.CornerMax().y()), float(aBox.CornerMax().z()), 1.0f));
+  }
+}
+
 // =======================================================================
 // function : SetStencilTestOptions
 // purpose  : Add stencil test element
@@ -175,6 +209,7 @@ void Metal_Group::AddText(const occ::handle<Graphic3d_Text>& theTextParams,
 void Metal_Group::SetStencilTestOptions(const bool theIsEnabled)
 {
   myStencilTestEnabled = theIsEnabled;
+  invalidateStructure();
 }
 
 // =======================================================================
@@ -186,6 +221,29 @@ void Metal_Group::SetFlippingOptions(const bool theIsEnabled,
 {
   myFlippingEnabled = theIsEnabled;
   myFlippingRefPlane = theRefPlane;
+  invalidateStructure();
+}
+
+// =======================================================================
+// function : SetTransformation
+// purpose  :
+// =======================================================================
+void Metal_Group::SetTransformation(const gp_Trsf& theTrsf)
+{
+  Graphic3d_Group::SetTransformation(theTrsf);
+  myHasTrsf = theTrsf.Form() != gp_Identity;
+  myTrsfMat.InitIdentity();
+  if (myHasTrsf)
+  {
+    for (int aRow = 0; aRow < 3; ++aRow)
+    {
+      for (int aCol = 0; aCol < 4; ++aCol)
+      {
+        myTrsfMat.SetValue(aRow, aCol, static_cast<float>(theTrsf.Value(aRow + 1, aCol + 1)));
+      }
+    }
+  }
+  invalidateStructure();
 }
 
 // =======================================================================
@@ -201,6 +259,37 @@ Metal_Structure* Metal_Group::MetalStruct() const
   return dynamic_cast<Metal_Structure*>(myStructure->CStructure().get());
 }
 
+// =======================================================================
+// function : invalidateStructure
+// purpose  : Increment modification state of parent structure
+// =======================================================================
+void Metal_Group::invalidateStructure() const
+{
+  if (Metal_Structure* aStruct = MetalStruct())
+  {
+    ++aStruct->myModificationState;
+  }
+}
+
+// =======================================================================
+// function : HasPointClouds
+// purpose  : Return TRUE if group contains level of detail point arrays
+// =======================================================================
+bool Metal_Group::HasPointClouds() const
+{
+  for (NCollection_List<Metal_PrimitiveArray*>::Iterator aPrimIter(myPrimitives); aPrimIter.More(); aPrimIter.Next())
+  {
+    const Metal_PrimitiveArray* aPrim = aPrimIter.Value();
+    if (aPrim != nullptr
+     && aPrim->Type() == Graphic3d_TOPA_POINTS
+     && (!aPrim->IsInitialized() || aPrim->IsPointCloud()))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
 // =======================================================================
 // function : Render
 // purpose  : Render the group
@@ -212,6 +301,13 @@ void Metal_Group::Render(Metal_Workspace* theWorkspace) const
     return;
   }
 
+  // Skip group filtered out by the current pass (e.g. semitransparent group within opaque pass)
+  if (!theWorkspace->ShouldRender(myAspect))
+  {
+    theWorkspace->IncrementSkippedCounter();
+    return;
+  }
+
   // Apply stencil test if enabled for this group
   const bool aPrevStencilTest = theWorkspace->IsStencilTestEnabled();
   if (myStencilTestEnabled != aPrevStencilTest)
@@ -220,6 +316,13 @@ void Metal_Group::Render(Metal_Workspace* theWorkspace) const
     theWorkspace->ApplyStencilTestState();
   }
 
+  // Apply group transformation
+  if (myHasTrsf)
+  {
+    theWorkspace->PushModelMatrix();
+    theWorkspace->SetModelMatrix(theWorkspace->ModelMatrix() * myTrsfMat);
+  }
+
   // Apply flipping if enabled for this group
   if (myFlippingEnabled)
   {
@@ -290,6 +393,24 @@ void Metal_Group::Render(Metal_Workspace* theWorkspace) const
     {
       NSLog(@"Metal_Group::Render: rendered %d primitives", aPrimCount);
     }
+
+    // B-spline surfaces are evaluated by tessellation pipeline sharing fragment stage with current aspect
+    if (!myBSplineSurfaces.IsEmpty()
+     && theWorkspace->ApplyBSplinePipelineState())
+    {
+      const occ::handle<Metal_TessellationController>& aTessCtrl = aCtx->TessellationController();
+      for (NCollection_List<occ::handle<Metal_BSplineSurface>>::Iterator aSurfIter(myBSplineSurfaces);
+           aSurfIter.More() && !aTessCtrl.IsNull(); aSurfIter.Next())
+      {
+        const occ::handle<Metal_BSplineSurface>& aSurface = aSurfIter.Value();
+        if (aSurface->IsInitialized()
+         || aSurface->Init(aCtx))
+        {
+          aTessCtrl->DrawBSplineSurface(theWorkspace, *aSurface);
+        }
+      }
+      theWorkspace->RestorePipelineState();
+    }
   }
 
   // Second pass: render edges (if enabled)
@@ -316,7 +437,11 @@ void Metal_Group::Render(Metal_Workspace* theWorkspace) const
           {
             aPrimArray->Init(aCtx);
           }
-          // Render with MeshEdges (processed vertices with edge distances)
+          // Barycentric coordinates are computed once per geometry
+          if (!aPrimArray->HasMeshEdges())
+          {
+            aPrimArray->InitMeshEdges(aCtx, theWorkspace->GeometryEmulator());
+          }
           aPrimArray->RenderMeshEdges(theWorkspace);
         }
       }
@@ -370,6 +495,10 @@ void Metal_Group::Render(Metal_Workspace* theWorkspace) const
   {
     theWorkspace->PopModelMatrix();
   }
+  if (myHasTrsf)
+  {
+    theWorkspace->PopModelMatrix();
+  }
 
   // Restore previous stencil test state if we changed it
   if (myStencilTestEnabled != aPrevStencilTest)
@@ -379,6 +508,38 @@ void Metal_Group::Render(Metal_Workspace* theWorkspace) const
   }
 }
 
+// =======================================================================
+// function : ReleaseGpuBuffers
+// purpose  : Release GPU buffers keeping CPU data
+// =======================================================================
+size_t Metal_Group::ReleaseGpuBuffers(Metal_Context* theCtx)
+{
+  size_t aSize = 0;
+  for (NCollection_List<Metal_PrimitiveArray*>::Iterator aPrimIter(myPrimitives);
+       aPrimIter.More(); aPrimIter.Next())
+  {
+    Metal_PrimitiveArray* aPrimArray = aPrimIter.Value();
+    if (aPrimArray != nullptr && aPrimArray->IsInitialized())
+    {
+      aSize += aPrimArray->EstimatedDataSize();
+      aPrimArray->Release(theCtx);
+    }
+  }
+  for (NCollection_List<occ::handle<Metal_BSplineSurface>>::Iterator aSurfIter(myBSplineSurfaces);
+       aSurfIter.More(); aSurfIter.Next())
+  {
+    aSize += aSurfIter.Value()->EstimatedDataSize();
+    aSurfIter.Value()->Release(theCtx);
+  }
+
+  // recorded render commands reference released buffers
+  if (aSize != 0)
+  {
+    invalidateStructure();
+  }
+  return aSize;
+}
+
 // =======================================================================
 // function : Release
 // purpose  : Release GPU resources
@@ -409,4 +570,12 @@ void Metal_Group::Release(Metal_Context* theCtx)
     }
   }
   myTexts.Clear();
+
+  // Release B-spline surfaces
+  for (NCollection_List<occ::handle<Metal_BSplineSurface>>::Iterator aSurfIter(myBSplineSurfaces);
+       aSurfIter.More(); aSurfIter.Next())
+  {
+    aSurfIter.Value()->Release(theCtx);
+  }
+  myBSplineSurfaces.Clear();
 }
@@ -0,0 +1,180 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef Metal_HiddenLineAlgo_HeaderFile
+#define Metal_HiddenLineAlgo_HeaderFile
+
+#include <Graphic3d_Buffer.hxx>
+#include <Graphic3d_Camera.hxx>
+#include <Graphic3d_IndexBuffer.hxx>
+#include <Graphic3d_Layer.hxx>
+#include <Graphic3d_SequenceOfHClipPlane.hxx>
+#include <Metal_Buffer.hxx>
+#include <NCollection_DataMap.hxx>
+#include <NCollection_List.hxx>
+#include <NCollection_Mat4.hxx>
+#include <Quantity_ColorRGBA.hxx>
+#include <Standard_Transient.hxx>
+#include <Standard_Type.hxx>
+
+#ifdef __OBJC__
+@protocol MTLCommandBuffer;
+@protocol MTLDepthStencilState;
+@protocol MTLRenderPipelineState;
+@protocol MTLRenderCommandEncoder;
+@protocol MTLTexture;
+#endif
+
+class Metal_Context;
+class Metal_PrimitiveArray;
+
+//! Hidden line display mode of Metal_View computed on GPU from triangulations of displayed shaded structures,
+//! as an interactive alternative to exact HLR (HLRBRep), which remains the tool for drawings export.
+//! After the main pass, surfaces are filled by background color over the shaded image (writing their depth),
+//! and edges of each triangle array are drawn twice against that depth:
+//! visible edges as solid lines with LessEqual test, and hidden edges as dashed lines with Greater test.
+//! Edges are extracted once per triangle array on CPU by welding coincident vertices:
+//! - boundary, non-manifold and crease edges (dihedral angle above CreaseAngle()) are always drawn;
+//! - smooth edges are drawn only on silhouette, where one adjacent triangle faces the eye and another does not,
+//!   which is tested by vertex shader for the current camera.
+//! Points, lines and texts of the main pass are kept where they are not covered by surfaces.
+class Metal_HiddenLineAlgo : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(Metal_HiddenLineAlgo, Standard_Transient)
+public:
+
+  //! Empty constructor.
+  Standard_EXPORT Metal_HiddenLineAlgo();
+
+  //! Destructor.
+  Standard_EXPORT ~Metal_HiddenLineAlgo() override;
+
+  //! Release GPU resources and cached edges.
+  Standard_EXPORT void Release(Metal_Context* theCtx);
+
+  //! Return TRUE if hidden edges are drawn as dashed lines; TRUE by default.
+  bool ToShowHidden() const { return myToShowHidden; }
+
+  //! Set if hidden edges should be drawn.
+  void SetShowHidden(bool theToShow) { myToShowHidden = theToShow; }
+
+  //! Return minimal dihedral angle in radians between adjacent triangles for their common edge to be drawn
+  //! regardless of silhouette; 20 degrees by default.
+  float CreaseAngle() const { return myCreaseAngle; }
+
+  //! Set crease angle; edges are extracted again on the next frame.
+  void SetCreaseAngle(float theAngle) { myCreaseAngle = theAngle; }
+
+  //! Return color of visible edges; black by default.
+  const Quantity_ColorRGBA& VisibleColor() const { return myVisibleColor; }
+
+  //! Set color of visible edges.
+  void SetVisibleColor(const Quantity_ColorRGBA& theColor) { myVisibleColor = theColor; }
+
+  //! Return color of hidden edges; gray by default.
+  const Quantity_ColorRGBA& HiddenColor() const { return myHiddenColor; }
+
+  //! Set color of hidden edges.
+  void SetHiddenColor(const Quantity_ColorRGBA& theColor) { myHiddenColor = theColor; }
+
+  //! Return length of dashes of hidden edges in pixels; 6 by default.
+  float DashLength() const { return myDashLength; }
+
+  //! Return length of gaps between dashes of hidden edges in pixels; 4 by default.
+  float GapLength() const { return myGapLength; }
+
+  //! Set dash pattern of hidden edges in pixels; zero gap draws solid lines.
+  void SetDashPattern(float theDash, float theGap)
+  {
+    myDashLength = theDash;
+    myGapLength  = theGap;
+  }
+
+  //! Return number of edges drawn by the last frame (before silhouette test).
+  int NbDrawnEdges() const { return myNbDrawnEdges; }
+
+#ifdef __OBJC__
+  //! Encode hidden line image of visible structures of non-immediate layers over the main pass.
+  //! @param theCtx       Metal context
+  //! @param theCmdBuffer frame command buffer (outside of render pass)
+  //! @param theTarget    color target with rendered main pass
+  //! @param theDepth     depth of the main pass (should be stored)
+  //! @param theLayers    layers of the view
+  //! @param thePlanes    clipping planes of the view
+  //! @param theViewId    view identification for structure visibility test
+  //! @param theCamera    camera of the view defining the eye for silhouette test
+  //! @param theViewProj  camera projection * orientation matrix used by the main pass
+  //! @param theFillColor color filling surfaces (view background)
+  Standard_EXPORT void Render(Metal_Context* theCtx,
+                              id<MTLCommandBuffer> theCmdBuffer,
+                              id<MTLTexture> theTarget,
+                              id<MTLTexture> theDepth,
+                              const NCollection_List<occ::handle<Graphic3d_Layer>>& theLayers,
+                              const Graphic3d_SequenceOfHClipPlane& thePlanes,
+                              int theViewId,
+                              const Graphic3d_Camera& theCamera,
+                              const NCollection_Mat4<float>& theViewProj,
+                              const Quantity_ColorRGBA& theFillColor);
+#endif
+
+protected:
+
+  //! Edges extracted from a triangle array.
+  struct EdgeSet
+  {
+    occ::handle<Graphic3d_Buffer>      Attribs;     //!< attributes the edges were extracted from
+    occ::handle<Graphic3d_IndexBuffer> Indices;     //!< indices the edges were extracted from
+    occ::handle<Metal_Buffer>          Edges;       //!< edge records (see Metal_HiddenLineAlgo.mm)
+    int                                NbEdges;     //!< number of edge records
+    float                              CreaseAngle; //!< crease angle used for classification
+    uint64_t                           LastFrame;   //!< last frame drawing the edges
+
+    EdgeSet() : NbEdges(0), CreaseAngle(0.0f), LastFrame(0) {}
+  };
+
+  //! Create pipelines for the color format of the target.
+  bool init(Metal_Context* theCtx, unsigned long theColorFormat);
+
+  //! Return edges of the triangle array, extracting them when missing or outdated.
+  const EdgeSet* edgeSet(Metal_Context* theCtx, const Metal_PrimitiveArray* theArray);
+
+  //! Release edges not drawn for a while.
+  void releaseUnused(Metal_Context* theCtx);
+
+protected:
+
+#ifdef __OBJC__
+  id<MTLRenderPipelineState> myFillPipeline;    //!< surfaces filled by background color
+  id<MTLRenderPipelineState> myEdgePipeline;    //!< visible and hidden edges
+  id<MTLDepthStencilState>   myFillDepthState;  //!< LessEqual test with depth write
+  id<MTLDepthStencilState>   myVisibleDepthState; //!< LessEqual test without depth write
+  id<MTLDepthStencilState>   myHiddenDepthState;  //!< Greater test without depth write
+#else
+  void* myFillPipeline;
+  void* myEdgePipeline;
+  void* myFillDepthState;
+  void* myVisibleDepthState;
+  void* myHiddenDepthState;
+#endif
+  unsigned long      myColorFormat;   //!< color format of pipelines
+  NCollection_DataMap<const Metal_PrimitiveArray*, EdgeSet> myEdgeSets; //!< edges per triangle array
+  Quantity_ColorRGBA myVisibleColor;  //!< color of visible edges
+  Quantity_ColorRGBA myHiddenColor;   //!< color of hidden edges
+  float              myCreaseAngle;   //!< crease angle in radians
+  float              myDashLength;    //!< dash length of hidden edges in pixels
+  float              myGapLength;     //!< gap length of hidden edges in pixels
+  bool               myToShowHidden;  //!< draw hidden edges
+  int                myNbDrawnEdges;  //!< edges drawn by the last frame
+};
+
+#endif // Metal_HiddenLineAlgo_HeaderFile
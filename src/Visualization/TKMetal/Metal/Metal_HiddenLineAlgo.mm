@@ -0,0 +1,863 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#import "Metal_HiddenLineAlgo.hxx"
+#import "Metal_Clipping.hxx"
+#import "Metal_Context.hxx"
+#import "Metal_Group.hxx"
+#import "Metal_PrimitiveArray.hxx"
+#import "Metal_Structure.hxx"
+
+#include <Graphic3d_Vec3.hxx>
+#include <NCollection_Vector.hxx>
+
+#import <Metal/Metal.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+IMPLEMENT_STANDARD_RTTIEXT(Metal_HiddenLineAlgo, Standard_Transient)
+
+namespace
+{
+  //! Shader source of surfaces fill and edges of hidden line mode.
+  static const char* THE_HIDDEN_LINE_SHADER = R"(
+#include <metal_stdlib>
+using namespace metal;
+
+#define MAX_CLIP_PLANES 8
+
+// world-space planes of the view grouped by chains
+struct HlrClipUniforms
+{
+  float4 Planes[MAX_CLIP_PLANES];
+  int    Chains[MAX_CLIP_PLANES]; // chain index of each plane, planes of a chain are contiguous
+  int    NbPlanes;
+  int    Padding[3];
+};
+
+struct HlrUniforms
+{
+  float4x4 ViewProjMatrix;
+  float4x4 ModelMatrix;
+  float4   Eye;         // eye in model space (w = 1), or direction towards eye for orthographic camera (w = 0)
+  float4   Color;
+  float2   Viewport;
+  float    DashLength;
+  float    GapLength;   // 0 for solid lines
+  float    DepthOffset; // offset of window depth towards the eye
+  float    Padding[3];
+};
+
+struct HlrEdge
+{
+  float4 Node0;   // xyz - position, w - 1 for edge drawn regardless of silhouette
+  float4 Node1;
+  float4 Normal0; // normal of the first adjacent triangle
+  float4 Normal1; // normal of the second adjacent triangle
+};
+
+struct HlrFillOut
+{
+  float4 Position [[position]];
+  float3 WorldPosition;
+};
+
+struct HlrEdgeOut
+{
+  float4 Position [[position]];
+  float3 WorldPosition;
+  float2 DashOrigin; // window position of the first node, the same for both vertices of the line
+};
+
+// chain cuts the point only when all its planes reject it; chains are combined by logical OR
+bool isClipped(float3 thePnt, constant HlrClipUniforms& theClip)
+{
+  int  aChain = -1;
+  bool isChainOut = false;
+  for (int aPlaneIter = 0; aPlaneIter < theClip.NbPlanes; ++aPlaneIter)
+  {
+    if (theClip.Chains[aPlaneIter] != aChain)
+    {
+      if (isChainOut)
+      {
+        return true;
+      }
+      aChain = theClip.Chains[aPlaneIter];
+      isChainOut = true;
+    }
+    if (isChainOut && dot(float4(thePnt, 1.0), theClip.Planes[aPlaneIter]) >= 0.0)
+    {
+      isChainOut = false;
+    }
+  }
+  return isChainOut;
+}
+
+vertex HlrFillOut vertex_hlr_fill(uint theVertexId [[vertex_id]],
+                                  const device packed_float3* thePositions [[buffer(0)]],
+                                  constant HlrUniforms& theUniforms [[buffer(1)]])
+{
+  const float4 aWorldPos = theUniforms.ModelMatrix * float4(float3(thePositions[theVertexId]), 1.0);
+  HlrFillOut anOut;
+  anOut.Position      = theUniforms.ViewProjMatrix * aWorldPos;
+  anOut.Position.z   -= theUniforms.DepthOffset * anOut.Position.w;
+  anOut.WorldPosition = aWorldPos.xyz;
+  return anOut;
+}
+
+fragment float4 fragment_hlr_fill(HlrFillOut theIn [[stage_in]],
+                                  constant HlrUniforms& theUniforms [[buffer(0)]],
+                                  constant HlrClipUniforms& theClip [[buffer(1)]])
+{
+  if (isClipped(theIn.WorldPosition, theClip))
+  {
+    discard_fragment();
+  }
+  return theUniforms.Color;
+}
+
+vertex HlrEdgeOut vertex_hlr_edge(uint theVertexId [[vertex_id]],
+                                  const device HlrEdge* theEdges [[buffer(0)]],
+                                  constant HlrUniforms& theUniforms [[buffer(1)]])
+{
+  const HlrEdge anEdge = theEdges[theVertexId / 2];
+  HlrEdgeOut anOut;
+  if (anEdge.Node0.w == 0.0)
+  {
+    // smooth edge is drawn only when one of adjacent triangles faces the eye and another one does not;
+    // the test is done at the edge middle, so that both vertices of the line take the same decision
+    const float3 aMiddle = 0.5 * (anEdge.Node0.xyz + anEdge.Node1.xyz);
+    const float3 aToEye  = theUniforms.Eye.xyz - aMiddle * theUniforms.Eye.w;
+    if (dot(anEdge.Normal0.xyz, aToEye) * dot(anEdge.Normal1.xyz, aToEye) > 0.0)
+    {
+      // both vertices outside of clipping volume
+      anOut.Position      = float4(2.0, 2.0, 2.0, 1.0);
+      anOut.WorldPosition = float3(0.0);
+      anOut.DashOrigin    = float2(0.0);
+      return anOut;
+    }
+  }
+
+  const float3 aNode     = (theVertexId & 1) == 0 ? anEdge.Node0.xyz : anEdge.Node1.xyz;
+  const float4 aWorldPos = theUniforms.ModelMatrix * float4(aNode, 1.0);
+  anOut.Position         = theUniforms.ViewProjMatrix * aWorldPos;
+  anOut.Position.z      -= theUniforms.DepthOffset * anOut.Position.w;
+  anOut.WorldPosition    = aWorldPos.xyz;
+
+  const float4 aClip0 = theUniforms.ViewProjMatrix * (theUniforms.ModelMatrix * float4(anEdge.Node0.xyz, 1.0));
+  const float2 aNdc0  = aClip0.xy / max(aClip0.w, 1.0e-6);
+  anOut.DashOrigin    = float2(0.5 + 0.5 * aNdc0.x, 0.5 - 0.5 * aNdc0.y) * theUniforms.Viewport;
+  return anOut;
+}
+
+fragment float4 fragment_hlr_edge(HlrEdgeOut theIn [[stage_in]],
+                                  constant HlrUniforms& theUniforms [[buffer(0)]],
+                                  constant HlrClipUniforms& theClip [[buffer(1)]])
+{
+  if (isClipped(theIn.WorldPosition, theClip))
+  {
+    discard_fragment();
+  }
+  if (theUniforms.GapLength > 0.0
+   && fmod(distance(theIn.Position.xy, theIn.DashOrigin), theUniforms.DashLength + theUniforms.GapLength) > theUniforms.DashLength)
+  {
+    discard_fragment();
+  }
+  return theUniforms.Color;
+}
+)";
+
+  //! Clipping planes, matching HlrClipUniforms.
+  struct Metal_HlrClipUniforms
+  {
+    float   Planes[Metal_Clipping_MaxPlanes][4];
+    int32_t Chains[Metal_Clipping_MaxPlanes];
+    int32_t NbPlanes;
+    int32_t Padding[3];
+  };
+
+  //! Uniforms of fill and edge draws, matching HlrUniforms.
+  struct Metal_HlrUniforms
+  {
+    float ViewProjMatrix[16];
+    float ModelMatrix[16];
+    float Eye[4];
+    float Color[4];
+    float Viewport[2];
+    float DashLength;
+    float GapLength;
+    float DepthOffset;
+    float Padding[3];
+  };
+
+  //! Edge record, matching HlrEdge.
+  struct Metal_HlrEdge
+  {
+    float Node0[4];
+    float Node1[4];
+    float Normal0[4];
+    float Normal1[4];
+  };
+
+  //! Offset of filled surfaces towards the eye, so that they cover shaded surfaces of the main pass.
+  static const float THE_FILL_DEPTH_OFFSET = 2.0e-6f;
+
+  //! Offset of edges towards the eye, larger than THE_FILL_DEPTH_OFFSET to keep edges on surfaces visible.
+  static const float THE_EDGE_DEPTH_OFFSET = 2.0e-5f;
+
+  //! Cosine of dihedral angle above which smooth edge is considered flat and never produces silhouette.
+  static const float THE_FLAT_EDGE_COS = 0.99999f;
+
+  //! Number of frames after which edges of the triangle array, which is not drawn anymore, are released.
+  static const uint64_t THE_UNUSED_FRAMES = 120;
+
+  //! Draw of the hidden line pass.
+  struct Metal_HlrDraw
+  {
+    const NCollection_Mat4<float>* Model; //!< transformation of the structure
+    const Metal_PrimitiveArray*    Array; //!< triangle array
+  };
+
+  //! Bit pattern of node position used for welding coincident nodes.
+  struct Metal_HlrNodeKey
+  {
+    uint32_t Bits[3];
+
+    bool operator==(const Metal_HlrNodeKey& theOther) const
+    {
+      return Bits[0] == theOther.Bits[0] && Bits[1] == theOther.Bits[1] && Bits[2] == theOther.Bits[2];
+    }
+  };
+
+  //! Hasher of Metal_HlrNodeKey.
+  struct Metal_HlrNodeKeyHasher
+  {
+    size_t operator()(const Metal_HlrNodeKey& theKey) const
+    {
+      return size_t(theKey.Bits[0]) * 73856093u ^ size_t(theKey.Bits[1]) * 19349663u ^ size_t(theKey.Bits[2]) * 83492791u;
+    }
+  };
+
+  //! Triangles adjacent to an edge.
+  struct Metal_HlrEdgeAdjacency
+  {
+    int            Node0;   //!< first node of the edge
+    int            Node1;   //!< second node of the edge
+    Graphic3d_Vec3 Normal0; //!< normal of the first triangle
+    Graphic3d_Vec3 Normal1; //!< normal of the second triangle
+    int            NbTris;  //!< number of adjacent triangles
+  };
+
+  //! Return TRUE if primitive array defines surfaces.
+  static bool isSurfaceArray(const Metal_PrimitiveArray* theArray)
+  {
+    switch (theArray->Type())
+    {
+      case Graphic3d_TOPA_TRIANGLES:
+      case Graphic3d_TOPA_TRIANGLESTRIPS:
+      case Graphic3d_TOPA_TRIANGLEFANS:
+        return true;
+      default:
+        return false;
+    }
+  }
+
+  //! Extract boundary, crease and silhouette candidate edges of the triangle array.
+  static void extractEdges(const Metal_PrimitiveArray& theArray,
+                           float theCreaseAngle,
+                           std::vector<Metal_HlrEdge>& theEdges)
+  {
+    theEdges.clear();
+    const occ::handle<Graphic3d_Buffer>&      anAttribs = theArray.Attributes();
+    const occ::handle<Graphic3d_IndexBuffer>& anIndices = theArray.Indices();
+    if (anAttribs.IsNull()
+     || anAttribs->NbElements <= 0)
+    {
+      return;
+    }
+
+    int aPosAttribIndex = -1;
+    size_t aPosStride = 0;
+    const uint8_t* aPosData = anAttribs->AttributeData(Graphic3d_TOA_POS, aPosAttribIndex, aPosStride);
+    if (aPosData == nullptr
+     || anAttribs->Attribute(aPosAttribIndex).DataType != Graphic3d_TOD_VEC3)
+    {
+      return;
+    }
+    const auto aPosition = [&](int theNode) -> const Graphic3d_Vec3&
+    {
+      return *reinterpret_cast<const Graphic3d_Vec3*>(aPosData + aPosStride * size_t(theNode));
+    };
+
+    // triangulations of shapes duplicate nodes on face boundaries; weld them by exact position,
+    // so that edges between faces get both adjacent triangles
+    std::vector<int> aWelded(size_t(anAttribs->NbElements));
+    std::unordered_map<Metal_HlrNodeKey, int, Metal_HlrNodeKeyHasher> aNodeMap;
+    aNodeMap.reserve(size_t(anAttribs->NbElements));
+    for (int aNodeIter = 0; aNodeIter < anAttribs->NbElements; ++aNodeIter)
+    {
+      Metal_HlrNodeKey aKey;
+      std::memcpy(aKey.Bits, aPosition(aNodeIter).GetData(), sizeof(aKey.Bits));
+      aWelded[size_t(aNodeIter)] = aNodeMap.emplace(aKey, aNodeIter).first->second;
+    }
+
+    std::unordered_map<uint64_t, int> anEdgeMap;
+    std::vector<Metal_HlrEdgeAdjacency> anAdjacency;
+    const auto addTriangle = [&](int theNode0, int theNode1, int theNode2)
+    {
+      const int aNodes[3] = { aWelded[size_t(theNode0)], aWelded[size_t(theNode1)], aWelded[size_t(theNode2)] };
+      if (aNodes[0] == aNodes[1] || aNodes[1] == aNodes[2] || aNodes[0] == aNodes[2])
+      {
+        return;
+      }
+
+      Graphic3d_Vec3 aNormal = Graphic3d_Vec3::Cross(aPosition(aNodes[1]) - aPosition(aNodes[0]),
+                                                     aPosition(aNodes[2]) - aPosition(aNodes[0]));
+      const float aLength = aNormal.Modulus();
+      if (aLength <= 0.0f)
+      {
+        return;
+      }
+      aNormal /= aLength;
+
+      for (int anEdgeIter = 0; anEdgeIter < 3; ++anEdgeIter)
+      {
+        const int aFrom = aNodes[anEdgeIter];
+        const int aTo   = aNodes[(anEdgeIter + 1) % 3];
+        const uint64_t aKey = (uint64_t(std::min(aFrom, aTo)) << 32) | uint64_t(std::max(aFrom, aTo));
+        const auto anInsert = anEdgeMap.emplace(aKey, int(anAdjacency.size()));
+        if (anInsert.second)
+        {
+          anAdjacency.push_back({ aFrom, aTo, aNormal, aNormal, 1 });
+          continue;
+        }
+
+        Metal_HlrEdgeAdjacency& anAdj = anAdjacency[size_t(anInsert.first->second)];
+        if (anAdj.NbTris == 1)
+        {
+          anAdj.Normal1 = aNormal;
+        }
+        ++anAdj.NbTris;
+      }
+    };
+
+    // strips and fans are assembled as a single strip or fan, like Metal_PrimitiveArray draws them
+    const int aNbNodes = !anIndices.IsNull() ? anIndices->NbElements : anAttribs->NbElements;
+    const auto aNode = [&](int theIndex) -> int
+    {
+      return !anIndices.IsNull() ? anIndices->Index(theIndex) : theIndex;
+    };
+    switch (theArray.Type())
+    {
+      case Graphic3d_TOPA_TRIANGLES:
+      {
+        for (int anIter = 0; anIter + 2 < aNbNodes; anIter += 3)
+        {
+          addTriangle(aNode(anIter), aNode(anIter + 1), aNode(anIter + 2));
+        }
+        break;
+      }
+      case Graphic3d_TOPA_TRIANGLESTRIPS:
+      {
+        for (int anIter = 0; anIter + 2 < aNbNodes; ++anIter)
+        {
+          if ((anIter % 2) == 0)
+          {
+            addTriangle(aNode(anIter), aNode(anIter + 1), aNode(anIter + 2));
+          }
+          else
+          {
+            addTriangle(aNode(anIter + 1), aNode(anIter), aNode(anIter + 2));
+          }
+        }
+        break;
+      }
+      case Graphic3d_TOPA_TRIANGLEFANS:
+      {
+        for (int anIter = 1; anIter + 1 < aNbNodes; ++anIter)
+        {
+          addTriangle(aNode(0), aNode(anIter), aNode(anIter + 1));
+        }
+        break;
+      }
+      default:
+        return;
+    }
+
+    const float aCreaseCos = std::cos(theCreaseAngle);
+    theEdges.reserve(anAdjacency.size() / 2);
+    for (const Metal_HlrEdgeAdjacency& anAdj : anAdjacency)
+    {
+      const float aCos = anAdj.Normal0.Dot(anAdj.Normal1);
+      const bool isFeature = anAdj.NbTris != 2 || aCos < aCreaseCos;
+      if (!isFeature && aCos > THE_FLAT_EDGE_COS)
+      {
+        continue;
+      }
+
+      Metal_HlrEdge anEdge;
+      const Graphic3d_Vec3& aNode0 = aPosition(anAdj.Node0);
+      const Graphic3d_Vec3& aNode1 = aPosition(anAdj.Node1);
+      for (int aCompIter = 0; aCompIter < 3; ++aCompIter)
+      {
+        anEdge.Node0[aCompIter]   = aNode0.GetData()[aCompIter];
+        anEdge.Node1[aCompIter]   = aNode1.GetData()[aCompIter];
+        anEdge.Normal0[aCompIter] = anAdj.Normal0.GetData()[aCompIter];
+        anEdge.Normal1[aCompIter] = anAdj.Normal1.GetData()[aCompIter];
+      }
+      anEdge.Node0[3]   = isFeature ? 1.0f : 0.0f;
+      anEdge.Node1[3]   = 0.0f;
+      anEdge.Normal0[3] = 0.0f;
+      anEdge.Normal1[3] = 0.0f;
+      theEdges.push_back(anEdge);
+    }
+  }
+
+  //! Collect surface arrays of displayed groups of the structure (including instanced one).
+  static void collectDraws(Metal_Context* theCtx,
+                           const Metal_Structure* theStruct,
+                           const NCollection_Mat4<float>& theModel,
+                           NCollection_Vector<NCollection_Mat4<float>>& theGroupModels,
+                           std::vector<Metal_HlrDraw>& theDraws)
+  {
+    if (theStruct->InstancedStructure() != nullptr)
+    {
+      collectDraws(theCtx, theStruct->InstancedStructure(), theModel, theGroupModels, theDraws);
+    }
+
+    for (Metal_Structure::GroupIterator aGroupIter(theStruct->Groups()); aGroupIter.More(); aGroupIter.Next())
+    {
+      const Metal_Group* aGroup = aGroupIter.Value();
+      if (aGroup == nullptr || !theStruct->IsGroupDrawn(*aGroup))
+      {
+        continue;
+      }
+
+      // wireframe groups have no surfaces to fill or to take edges from
+      const occ::handle<Graphic3d_Aspects> anAspect = aGroup->Aspects();
+      if (!anAspect.IsNull()
+       && (anAspect->InteriorStyle() == Aspect_IS_EMPTY
+        || anAspect->InteriorStyle() == Aspect_IS_HOLLOW))
+      {
+        continue;
+      }
+
+      // vector elements keep their address on growth
+      const NCollection_Mat4<float>* aModel = &theModel;
+      if (aGroup->HasTransformation())
+      {
+        aModel = &theGroupModels.Append(theModel * aGroup->TransformationMatrix());
+      }
+
+      for (NCollection_List<Metal_PrimitiveArray*>::Iterator aPrimIter(aGroup->Primitives()); aPrimIter.More(); aPrimIter.Next())
+      {
+        Metal_PrimitiveArray* anArray = aPrimIter.Value();
+        if (anArray == nullptr || !isSurfaceArray(anArray))
+        {
+          continue;
+        }
+        if (!anArray->IsInitialized())
+        {
+          anArray->Init(theCtx);
+        }
+        theDraws.push_back({ aModel, anArray });
+      }
+    }
+  }
+
+  //! Copy color into uniforms.
+  static void setColor(Metal_HlrUniforms& theUniforms, const Quantity_ColorRGBA& theColor)
+  {
+    const NCollection_Vec4<float> aColor(theColor);
+    std::copy(aColor.GetData(), aColor.GetData() + 4, theUniforms.Color);
+  }
+}
+
+// =======================================================================
+// function : Metal_HiddenLineAlgo
+// purpose  : Constructor
+// =======================================================================
+Metal_HiddenLineAlgo::Metal_HiddenLineAlgo()
+: myFillPipeline(nil),
+  myEdgePipeline(nil),
+  myFillDepthState(nil),
+  myVisibleDepthState(nil),
+  myHiddenDepthState(nil),
+  myColorFormat(0),
+  myVisibleColor(0.0f, 0.0f, 0.0f, 1.0f),
+  myHiddenColor(0.5f, 0.5f, 0.5f, 1.0f),
+  myCreaseAngle(float(20.0 * M_PI / 180.0)),
+  myDashLength(6.0f),
+  myGapLength(4.0f),
+  myToShowHidden(true),
+  myNbDrawnEdges(0)
+{
+  //
+}
+
+// =======================================================================
+// function : ~Metal_HiddenLineAlgo
+// purpose  : Destructor
+// =======================================================================
+Metal_HiddenLineAlgo::~Metal_HiddenLineAlgo()
+{
+  Release(nullptr);
+}
+
+// =======================================================================
+// function : Release
+// purpose  : Release GPU resources and cached edges
+// =======================================================================
+void Metal_HiddenLineAlgo::Release(Metal_Context* theCtx)
+{
+  for (NCollection_DataMap<const Metal_PrimitiveArray*, EdgeSet>::Iterator aSetIter(myEdgeSets); aSetIter.More(); aSetIter.Next())
+  {
+    if (!aSetIter.Value().Edges.IsNull())
+    {
+      aSetIter.ChangeValue().Edges->Release(theCtx);
+    }
+  }
+  myEdgeSets.Clear();
+  myFillPipeline      = nil;
+  myEdgePipeline      = nil;
+  myFillDepthState    = nil;
+  myVisibleDepthState = nil;
+  myHiddenDepthState  = nil;
+  myColorFormat       = 0;
+  myNbDrawnEdges      = 0;
+}
+
+// =======================================================================
+// function : init
+// purpose  : Create pipelines for the color format of the target
+// =======================================================================
+bool Metal_HiddenLineAlgo::init(Metal_Context* theCtx, unsigned long theColorFormat)
+{
+  if (myFillPipeline != nil && myEdgePipeline != nil && myColorFormat == theColorFormat)
+  {
+    return true;
+  }
+  if (theCtx == nullptr || !theCtx->IsValid())
+  {
+    return false;
+  }
+
+  NSError* anError = nil;
+  id<MTLLibrary> aLibrary = theCtx->LoadShaderLibrary("Metal_HiddenLineAlgo_THE_HIDDEN_LINE_SHADER",
+                                                      [NSString stringWithUTF8String:THE_HIDDEN_LINE_SHADER],
+                                                      nil, &anError);
+  if (aLibrary == nil)
+  {
+    theCtx->Messenger()->SendFail() << "Metal_HiddenLineAlgo: failed to compile hidden line shaders: "
+                                    << (anError != nil ? [[anError localizedDescription] UTF8String] : "");
+    return false;
+  }
+
+  id<MTLDevice> aDevice = theCtx->Device();
+  if (myFillDepthState == nil)
+  {
+    MTLDepthStencilDescriptor* aDepthDesc = [[MTLDepthStencilDescriptor alloc] init];
+    aDepthDesc.depthCompareFunction = MTLCompareFunctionLessEqual;
+    aDepthDesc.depthWriteEnabled = YES;
+    myFillDepthState = [aDevice newDepthStencilStateWithDescriptor:aDepthDesc];
+
+    aDepthDesc.depthWriteEnabled = NO;
+    myVisibleDepthState = [aDevice newDepthStencilStateWithDescriptor:aDepthDesc];
+
+    aDepthDesc.depthCompareFunction = MTLCompareFunctionGreater;
+    myHiddenDepthState = [aDevice newDepthStencilStateWithDescriptor:aDepthDesc];
+  }
+
+  MTLRenderPipelineDescriptor* aPipeDesc = [[MTLRenderPipelineDescriptor alloc] init];
+  aPipeDesc.label = @"HiddenLineFill";
+  aPipeDesc.vertexFunction   = [aLibrary newFunctionWithName:@"vertex_hlr_fill"];
+  aPipeDesc.fragmentFunction = [aLibrary newFunctionWithName:@"fragment_hlr_fill"];
+  aPipeDesc.colorAttachments[0].pixelFormat = (MTLPixelFormat)theColorFormat;
+  aPipeDesc.depthAttachmentPixelFormat = MTLPixelFormatDepth32Float;
+  myFillPipeline = [aDevice newRenderPipelineStateWithDescriptor:aPipeDesc error:&anError];
+  if (myFillPipeline != nil)
+  {
+    aPipeDesc.label = @"HiddenLineEdges";
+    aPipeDesc.vertexFunction   = [aLibrary newFunctionWithName:@"vertex_hlr_edge"];
+    aPipeDesc.fragmentFunction = [aLibrary newFunctionWithName:@"fragment_hlr_edge"];
+    myEdgePipeline = [aDevice newRenderPipelineStateWithDescriptor:aPipeDesc error:&anError];
+  }
+  myColorFormat = theColorFormat;
+  if (myFillPipeline == nil || myEdgePipeline == nil)
+  {
+    theCtx->Messenger()->SendFail() << "Metal_HiddenLineAlgo: failed to create hidden line pipelines: "
+                                    << (anError != nil ? [[anError localizedDescription] UTF8String] : "");
+    myFillPipeline = nil;
+    myEdgePipeline = nil;
+    return false;
+  }
+  return myFillDepthState != nil && myVisibleDepthState != nil && myHiddenDepthState != nil;
+}
+
+// =======================================================================
+// function : edgeSet
+// purpose  : Return edges of the triangle array
+// =======================================================================
+const Metal_HiddenLineAlgo::EdgeSet* Metal_HiddenLineAlgo::edgeSet(Metal_Context* theCtx,
+                                                                   const Metal_PrimitiveArray* theArray)
+{
+  EdgeSet* aSet = myEdgeSets.ChangeSeek(theArray);
+  if (aSet != nullptr
+   && aSet->Attribs == theArray->Attributes()
+   && aSet->Indices == theArray->Indices()
+   && aSet->CreaseAngle == myCreaseAngle)
+  {
+    aSet->LastFrame = theCtx->FrameNumber();
+    return aSet->NbEdges > 0 ? aSet : nullptr;
+  }
+
+  // array has been modified, or another array has been allocated at the same address
+  if (aSet == nullptr)
+  {
+    aSet = myEdgeSets.Bound(theArray, EdgeSet());
+  }
+  else if (!aSet->Edges.IsNull())
+  {
+    aSet->Edges->Release(theCtx);
+  }
+  aSet->Attribs     = theArray->Attributes();
+  aSet->Indices     = theArray->Indices();
+  aSet->CreaseAngle = myCreaseAngle;
+  aSet->LastFrame   = theCtx->FrameNumber();
+  aSet->NbEdges     = 0;
+  aSet->Edges.Nullify();
+
+  std::vector<Metal_HlrEdge> anEdges;
+  extractEdges(*theArray, myCreaseAngle, anEdges);
+  if (anEdges.empty())
+  {
+    return nullptr;
+  }
+
+  occ::handle<Metal_Buffer> aBuffer = new Metal_Buffer();
+  if (!aBuffer->Init(theCtx, 4, int(anEdges.size() * 4), anEdges.front().Node0))
+  {
+    theCtx->Messenger()->SendWarning() << "Metal_HiddenLineAlgo: failed to allocate " << int(anEdges.size()) << " edges";
+    return nullptr;
+  }
+  aSet->Edges   = aBuffer;
+  aSet->NbEdges = int(anEdges.size());
+  return aSet;
+}
+
+// =======================================================================
+// function : releaseUnused
+// purpose  : Release edges not drawn for a while
+// =======================================================================
+void Metal_HiddenLineAlgo::releaseUnused(Metal_Context* theCtx)
+{
+  const uint64_t aFrame = theCtx->FrameNumber();
+  NCollection_Vector<const Metal_PrimitiveArray*> anUnused;
+  for (NCollection_DataMap<const Metal_PrimitiveArray*, EdgeSet>::Iterator aSetIter(myEdgeSets); aSetIter.More(); aSetIter.Next())
+  {
+    if (aSetIter.Value().LastFrame + THE_UNUSED_FRAMES < aFrame)
+    {
+      anUnused.Append(aSetIter.Key());
+    }
+  }
+  for (NCollection_Vector<const Metal_PrimitiveArray*>::Iterator anIter(anUnused); anIter.More(); anIter.Next())
+  {
+    EdgeSet& aSet = myEdgeSets.ChangeFind(anIter.Value());
+    if (!aSet.Edges.IsNull())
+    {
+      aSet.Edges->Release(theCtx);
+    }
+    myEdgeSets.UnBind(anIter.Value());
+  }
+}
+
+// =======================================================================
+// function : Render
+// purpose  : Encode hidden line image over the main pass
+// =======================================================================
+void Metal_HiddenLineAlgo::Render(Metal_Context* theCtx,
+                                  id<MTLCommandBuffer> theCmdBuffer,
+                                  id<MTLTexture> theTarget,
+                                  id<MTLTexture> theDepth,
+                                  const NCollection_List<occ::handle<Graphic3d_Layer>>& theLayers,
+                                  const Graphic3d_SequenceOfHClipPlane& thePlanes,
+                                  int theViewId,
+                                  const Graphic3d_Camera& theCamera,
+                                  const NCollection_Mat4<float>& theViewProj,
+                                  const Quantity_ColorRGBA& theFillColor)
+{
+  myNbDrawnEdges = 0;
+  if (theCmdBuffer == nil || theTarget == nil || theDepth == nil
+   || !init(theCtx, (unsigned long)theTarget.pixelFormat))
+  {
+    return;
+  }
+  releaseUnused(theCtx);
+
+  // world-space equations of enabled planes, planes of a chain are kept together
+  Metal_HlrClipUniforms aClip;
+  std::memset(&aClip, 0, sizeof(aClip));
+  int aNbChains = 0;
+  for (Graphic3d_SequenceOfHClipPlane::Iterator aPlaneIter(thePlanes); aPlaneIter.More(); aPlaneIter.Next())
+  {
+    const occ::handle<Graphic3d_ClipPlane>& aHead = aPlaneIter.Value();
+    if (aHead.IsNull() || !aHead->IsOn())
+    {
+      continue;
+    }
+    if (aClip.NbPlanes + aHead->NbChainNextPlanes() > Metal_Clipping_MaxPlanes)
+    {
+      theCtx->Messenger()->SendWarning() << "Metal_HiddenLineAlgo: clipping planes above " << Metal_Clipping_MaxPlanes << " are ignored";
+      break;
+    }
+
+    for (const Graphic3d_ClipPlane* aPlane = aHead.get(); aPlane != nullptr; aPlane = aPlane->ChainNextPlane().get())
+    {
+      const NCollection_Vec4<double>& anEq = aPlane->GetEquation();
+      for (int aCompIter = 0; aCompIter < 4; ++aCompIter)
+      {
+        aClip.Planes[aClip.NbPlanes][aCompIter] = (float)anEq.GetData()[aCompIter];
+      }
+      aClip.Chains[aClip.NbPlanes] = aNbChains;
+      ++aClip.NbPlanes;
+    }
+    ++aNbChains;
+  }
+
+  // surface arrays of visible structures of non-immediate layers
+  NCollection_Vector<NCollection_Mat4<float>> aGroupModels;
+  std::vector<Metal_HlrDraw> aDraws;
+  for (NCollection_List<occ::handle<Graphic3d_Layer>>::Iterator aLayerIter(theLayers); aLayerIter.More(); aLayerIter.Next())
+  {
+    const occ::handle<Graphic3d_Layer>& aLayer = aLayerIter.Value();
+    if (aLayer.IsNull() || aLayer->NbStructures() == 0
+     || aLayer->IsImmediate() || aLayer->IsCulled())
+    {
+      continue;
+    }
+
+    const Graphic3d_ArrayOfIndexedMapOfStructure& aStructArray = aLayer->ArrayOfStructures();
+    for (int aPriorityIdx = 0; aPriorityIdx < Graphic3d_DisplayPriority_NB; ++aPriorityIdx)
+    {
+      const NCollection_IndexedMap<const Graphic3d_CStructure*>& aStructMap = aStructArray[aPriorityIdx];
+      for (int aStructIdx = 1; aStructIdx <= aStructMap.Extent(); ++aStructIdx)
+      {
+        const Graphic3d_CStructure* aCStruct = aStructMap.FindKey(aStructIdx);
+        if (aCStruct != nullptr
+        && !aCStruct->IsCulled()
+        &&  aCStruct->IsVisible(theViewId))
+        {
+          // all structures of the view are created by Metal_GraphicDriver
+          const Metal_Structure* aStruct = static_cast<const Metal_Structure*>(aCStruct);
+          collectDraws(theCtx, aStruct, aStruct->RenderTransformation(), aGroupModels, aDraws);
+        }
+      }
+    }
+  }
+  if (aDraws.empty())
+  {
+    return;
+  }
+
+  MTLRenderPassDescriptor* aPassDesc = [MTLRenderPassDescriptor renderPassDescriptor];
+  aPassDesc.colorAttachments[0].texture = theTarget;
+  aPassDesc.colorAttachments[0].loadAction = MTLLoadActionLoad;
+  aPassDesc.colorAttachments[0].storeAction = MTLStoreActionStore;
+  aPassDesc.depthAttachment.texture = theDepth;
+  aPassDesc.depthAttachment.loadAction = MTLLoadActionLoad;
+  aPassDesc.depthAttachment.storeAction = MTLStoreActionStore;
+  id<MTLRenderCommandEncoder> anEncoder = [theCmdBuffer renderCommandEncoderWithDescriptor:aPassDesc];
+  if (anEncoder == nil)
+  {
+    return;
+  }
+  anEncoder.label = @"HiddenLine";
+
+  const int aSizeX = (int)theTarget.width;
+  const int aSizeY = (int)theTarget.height;
+  const MTLViewport aViewport = { 0.0, 0.0, (double)aSizeX, (double)aSizeY, 0.0, 1.0 };
+  [anEncoder setViewport:aViewport];
+  [anEncoder setCullMode:MTLCullModeNone];
+  [anEncoder setFragmentBytes:&aClip length:sizeof(aClip) atIndex:1];
+
+  Metal_HlrUniforms aUniforms;
+  std::memset(&aUniforms, 0, sizeof(aUniforms));
+  std::copy(theViewProj.GetData(), theViewProj.GetData() + 16, aUniforms.ViewProjMatrix);
+  aUniforms.Viewport[0] = (float)aSizeX;
+  aUniforms.Viewport[1] = (float)aSizeY;
+
+  // cover shaded surfaces of the main pass by background color
+  [anEncoder setRenderPipelineState:myFillPipeline];
+  [anEncoder setDepthStencilState:myFillDepthState];
+  setColor(aUniforms, theFillColor);
+  aUniforms.DepthOffset = THE_FILL_DEPTH_OFFSET;
+  const NCollection_Mat4<float>* aModel = nullptr;
+  for (const Metal_HlrDraw& aDraw : aDraws)
+  {
+    if (aDraw.Model != aModel)
+    {
+      aModel = aDraw.Model;
+      std::copy(aModel->GetData(), aModel->GetData() + 16, aUniforms.ModelMatrix);
+      [anEncoder setVertexBytes:&aUniforms length:sizeof(aUniforms) atIndex:1];
+      [anEncoder setFragmentBytes:&aUniforms length:sizeof(aUniforms) atIndex:0];
+    }
+    aDraw.Array->DrawPositions(anEncoder);
+  }
+
+  // eye for silhouette test; transformed into model space of each structure
+  const bool isOrtho = theCamera.IsOrthographic();
+  const gp_XYZ anEye = isOrtho ? theCamera.Direction().Reversed().XYZ() : theCamera.Eye().XYZ();
+  const NCollection_Vec4<float> anEyeWorld((float)anEye.X(), (float)anEye.Y(), (float)anEye.Z(), isOrtho ? 0.0f : 1.0f);
+
+  // hidden edges first, so that visible edges overlap them at silhouettes
+  [anEncoder setRenderPipelineState:myEdgePipeline];
+  aUniforms.DepthOffset = THE_EDGE_DEPTH_OFFSET;
+  for (int aPassIter = myToShowHidden ? 0 : 1; aPassIter < 2; ++aPassIter)
+  {
+    const bool isHidden = aPassIter == 0;
+    [anEncoder setDepthStencilState:isHidden ? myHiddenDepthState : myVisibleDepthState];
+    setColor(aUniforms, isHidden ? myHiddenColor : myVisibleColor);
+    aUniforms.DashLength = isHidden ? myDashLength : 0.0f;
+    aUniforms.GapLength  = isHidden ? myGapLength  : 0.0f;
+    aModel = nullptr;
+    for (const Metal_HlrDraw& aDraw : aDraws)
+    {
+      const EdgeSet* aSet = edgeSet(theCtx, aDraw.Array);
+      if (aSet == nullptr)
+      {
+        continue;
+      }
+      if (aDraw.Model != aModel)
+      {
+        aModel = aDraw.Model;
+        std::copy(aModel->GetData(), aModel->GetData() + 16, aUniforms.ModelMatrix);
+
+        NCollection_Mat4<float> anInvModel;
+        const NCollection_Vec4<float> anEyeModel = aModel->Inverted(anInvModel) ? anInvModel * anEyeWorld : anEyeWorld;
+        std::copy(anEyeModel.GetData(), anEyeModel.GetData() + 4, aUniforms.Eye);
+        [anEncoder setVertexBytes:&aUniforms length:sizeof(aUniforms) atIndex:1];
+        [anEncoder setFragmentBytes:&aUniforms length:sizeof(aUniforms) atIndex:0];
+      }
+      [anEncoder setVertexBuffer:aSet->Edges->Buffer() offset:aSet->Edges->Offset() atIndex:0];
+      [anEncoder drawPrimitives:MTLPrimitiveTypeLine vertexStart:0 vertexCount:NSUInteger(aSet->NbEdges) * 2];
+      if (!isHidden)
+      {
+        myNbDrawnEdges += aSet->NbEdges;
+      }
+    }
+  }
+  [anEncoder endEncoding];
+}
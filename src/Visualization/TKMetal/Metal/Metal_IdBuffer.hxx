@@ -0,0 +1,132 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+#ifndef Metal_IdBuffer_HeaderFile
+#define Metal_IdBuffer_HeaderFile
+
+#include <Graphic3d_IdBufferSample.hxx>
+#include <Graphic3d_Layer.hxx>
+#include <NCollection_List.hxx>
+#include <NCollection_Mat4.hxx>
+#include <NCollection_Vector.hxx>
+#include <Standard_Transient.hxx>
+
+#ifdef __OBJC__
+@protocol MTLCommandBuffer;
+@protocol MTLDepthStencilState;
+@protocol MTLRenderPipelineState;
+@protocol MTLTexture;
+#endif
+
+class Metal_Context;
+class Metal_Structure;
+
+//! ID buffer for GPU picking.
+//!
+//! Visible structures of non-immediate layers are rendered by a separate pass into
+//! integer color target storing structure identification, primitive array index within structure,
+//! primitive index (rasterizer primitive_id) and window depth of each pixel.
+//! The pass is encoded into the frame command buffer, so that query of a picking rectangle
+//! is a small blit executed after the frame without rendering the scene again.
+class Metal_IdBuffer : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(Metal_IdBuffer, Standard_Transient)
+public:
+
+  //! Create uninitialized ID buffer.
+  Standard_EXPORT Metal_IdBuffer();
+
+  //! Destructor.
+  Standard_EXPORT ~Metal_IdBuffer() override;
+
+  //! Compile shaders and create pipeline.
+  //! @return FALSE if pipeline cannot be created
+  Standard_EXPORT bool Init(Metal_Context* theCtx);
+
+  //! Return TRUE if pipeline has been created.
+  bool IsValid() const { return myPipeline != nullptr; }
+
+  //! Return TRUE if ID buffer contains rendered frame.
+  bool HasContent() const { return myHasContent; }
+
+  //! Reset rendered content (e.g. when ID buffer rendering is disabled).
+  void Invalidate() { myHasContent = false; }
+
+  //! Return ID buffer width.
+  int SizeX() const { return mySizeX; }
+
+  //! Return ID buffer height.
+  int SizeY() const { return mySizeY; }
+
+  //! Release GPU resources.
+  Standard_EXPORT void Release(Metal_Context* theCtx);
+
+  //! Read back elements within the rectangle of ID buffer rendered by last frame.
+  //! Waits for completion of the frame command buffer, which should be already committed.
+  //! @param theCtx     Metal context
+  //! @param theLeft    left pixel of the rectangle
+  //! @param theTop     top pixel of the rectangle (Y axis directed downwards)
+  //! @param theWidth   rectangle width
+  //! @param theHeight  rectangle height
+  //! @param theSamples unique elements sorted by depth (nearest first)
+  //! @return FALSE if ID buffer has no content or rectangle is outside of it
+  Standard_EXPORT bool Query(Metal_Context* theCtx,
+                             int theLeft,
+                             int theTop,
+                             int theWidth,
+                             int theHeight,
+                             NCollection_Vector<Graphic3d_IdBufferSample>& theSamples) const;
+
+#ifdef __OBJC__
+  //! Encode ID pass of visible structures of non-immediate layers.
+  //! @param theCtx        Metal context
+  //! @param theCmdBuffer  frame command buffer (outside of render pass)
+  //! @param theLayers     layers of the view
+  //! @param theViewId     view identification for structure visibility test
+  //! @param theViewMatrix camera orientation matrix
+  //! @param theProjMatrix camera projection matrix
+  //! @param theSizeX      frame width in pixels
+  //! @param theSizeY      frame height in pixels
+  Standard_EXPORT void Render(Metal_Context* theCtx,
+                              id<MTLCommandBuffer> theCmdBuffer,
+                              const NCollection_List<occ::handle<Graphic3d_Layer>>& theLayers,
+                              int theViewId,
+                              const NCollection_Mat4<float>& theViewMatrix,
+                              const NCollection_Mat4<float>& theProjMatrix,
+                              int theSizeX,
+                              int theSizeY);
+#endif
+
+protected:
+
+  //! (Re)create ID and depth textures of specified size.
+  bool initTextures(Metal_Context* theCtx, int theSizeX, int theSizeY);
+
+protected:
+
+#ifdef __OBJC__
+  id<MTLRenderPipelineState> myPipeline;   //!< ID pass pipeline
+  id<MTLDepthStencilState>   myDepthState; //!< depth test and write
+  id<MTLTexture>             myIdTexture;  //!< RGBA32Uint ID target
+  id<MTLTexture>             myDepthTexture; //!< depth target of ID pass
+#else
+  void* myPipeline;
+  void* myDepthState;
+  void* myIdTexture;
+  void* myDepthTexture;
+#endif
+  int  mySizeX;      //!< ID buffer width
+  int  mySizeY;      //!< ID buffer height
+  bool myHasContent; //!< ID buffer contains rendered frame
+};
+
+#endif // Metal_IdBuffer_HeaderFile
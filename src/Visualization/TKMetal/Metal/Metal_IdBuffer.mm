@@ -0,0 +1,457 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+#import <Metal/Metal.h>
+
+#include <Metal_IdBuffer.hxx>
+#include <Metal_Context.hxx>
+#include <Metal_Group.hxx>
+#include <Metal_PrimitiveArray.hxx>
+#include <Metal_Structure.hxx>
+#include <Metal_VertexBuffer.hxx>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+IMPLEMENT_STANDARD_RTTIEXT(Metal_IdBuffer, Standard_Transient)
+
+namespace
+{
+  //! ID pass shaders.
+  static const char* THE_ID_BUFFER_SHADER = R"(
+#include <metal_stdlib>
+using namespace metal;
+
+struct IdUniforms
+{
+  float4x4 ModelViewMatrix;
+  float4x4 ProjectionMatrix;
+};
+
+struct IdVertexOut
+{
+  float4 Position [[position]];
+  float  PointSize [[point_size]];
+};
+
+vertex IdVertexOut vertex_id_buffer(uint theVertexId [[vertex_id]],
+                                    const device packed_float3* thePositions [[buffer(0)]],
+                                    constant IdUniforms& theUniforms [[buffer(1)]])
+{
+  IdVertexOut anOut;
+  anOut.Position  = theUniforms.ProjectionMatrix * (theUniforms.ModelViewMatrix * float4(float3(thePositions[theVertexId]), 1.0));
+  anOut.PointSize = 1.0;
+  return anOut;
+}
+
+// structure id is stored with +1 offset, so that zero means empty pixel
+fragment uint4 fragment_id_buffer(IdVertexOut theIn [[stage_in]],
+                                  uint thePrimId [[primitive_id]],
+                                  constant uint2& theIds [[buffer(0)]])
+{
+  return uint4(theIds.x, theIds.y, thePrimId, as_type<uint>(theIn.Position.z));
+}
+)";
+
+  //! Uniforms of ID pass vertex shader.
+  struct Metal_IdUniforms
+  {
+    float ModelViewMatrix[16];
+    float ProjectionMatrix[16];
+  };
+
+  //! Size of ID buffer pixel (RGBA32Uint).
+  static const size_t THE_ID_PIXEL_SIZE = 4 * sizeof(uint32_t);
+
+  //! Encode primitive arrays of the structure (including instanced one) with the same identification.
+  static void encodeStructure(Metal_Context* theCtx,
+                              id<MTLRenderCommandEncoder> theEncoder,
+                              const Metal_Structure* theStruct,
+                              const Metal_IdUniforms& theUniforms,
+                              uint32_t theStructId,
+                              int& theArrayIndex)
+  {
+    if (theStruct->InstancedStructure() != nullptr)
+    {
+      encodeStructure(theCtx, theEncoder, theStruct->InstancedStructure(), theUniforms, theStructId, theArrayIndex);
+    }
+
+    for (Metal_Structure::GroupIterator aGroupIter(theStruct->Groups()); aGroupIter.More(); aGroupIter.Next())
+    {
+      const Metal_Group* aGroup = aGroupIter.Value();
+      if (aGroup == nullptr || !theStruct->IsGroupDrawn(*aGroup))
+      {
+        continue;
+      }
+      if (aGroup->HasTransformation())
+      {
+        NCollection_Mat4<float> aModelView;
+        std::copy(theUniforms.ModelViewMatrix, theUniforms.ModelViewMatrix + 16, aModelView.ChangeData());
+        aModelView = aModelView * aGroup->TransformationMatrix();
+
+        Metal_IdUniforms aGroupUniforms = theUniforms;
+        std::copy(aModelView.GetData(), aModelView.GetData() + 16, aGroupUniforms.ModelViewMatrix);
+        [theEncoder setVertexBytes:&aGroupUniforms length:sizeof(aGroupUniforms) atIndex:1];
+      }
+
+      for (NCollection_List<Metal_PrimitiveArray*>::Iterator aPrimIter(aGroup->Primitives()); aPrimIter.More(); aPrimIter.Next())
+      {
+        Metal_PrimitiveArray* anArray = aPrimIter.Value();
+        if (anArray == nullptr)
+        {
+          continue;
+        }
+        if (!anArray->IsInitialized())
+        {
+          anArray->Init(theCtx);
+        }
+
+        const uint32_t anIds[2] = { theStructId, (uint32_t)theArrayIndex++ };
+        [theEncoder setFragmentBytes:anIds length:sizeof(anIds) atIndex:0];
+        anArray->DrawPositions(theEncoder);
+      }
+      if (aGroup->HasTransformation())
+      {
+        [theEncoder setVertexBytes:&theUniforms length:sizeof(theUniforms) atIndex:1];
+      }
+    }
+  }
+}
+
+// =======================================================================
+// function : Metal_IdBuffer
+// purpose  : Constructor
+// =======================================================================
+Metal_IdBuffer::Metal_IdBuffer()
+: myPipeline(nil),
+  myDepthState(nil),
+  myIdTexture(nil),
+  myDepthTexture(nil),
+  mySizeX(0),
+  mySizeY(0),
+  myHasContent(false)
+{
+  //
+}
+
+// =======================================================================
+// function : ~Metal_IdBuffer
+// purpose  : Destructor
+// =======================================================================
+Metal_IdBuffer::~Metal_IdBuffer()
+{
+  Release(nullptr);
+}
+
+// =======================================================================
+// function : Release
+// purpose  : Release GPU resources
+// =======================================================================
+void Metal_IdBuffer::Release(Metal_Context*)
+{
+  myPipeline = nil;
+  myDepthState = nil;
+  myIdTexture = nil;
+  myDepthTexture = nil;
+  mySizeX = 0;
+  mySizeY = 0;
+  myHasContent = false;
+}
+
+// =======================================================================
+// function : Init
+// purpose  : Compile shaders and create pipeline
+// =======================================================================
+bool Metal_IdBuffer::Init(Metal_Context* theCtx)
+{
+  if (IsValid())
+  {
+    return true;
+  }
+  if (theCtx == nullptr || !theCtx->IsValid())
+  {
+    return false;
+  }
+
+  NSError* anError = nil;
+  id<MTLLibrary> aLibrary = theCtx->LoadShaderLibrary("Metal_IdBuffer_THE_ID_BUFFER_SHADER",
+                                                      [NSString stringWithUTF8String:THE_ID_BUFFER_SHADER],
+                                                      nil, &anError);
+  if (aLibrary == nil)
+  {
+    theCtx->Messenger()->SendFail() << "Metal_IdBuffer: failed to compile ID pass shaders: "
+                                    << (anError != nil ? [[anError localizedDescription] UTF8String] : "");
+    return false;
+  }
+
+  MTLRenderPipelineDescriptor* aPipeDesc = [[MTLRenderPipelineDescriptor alloc] init];
+  aPipeDesc.label = @"IdBuffer";
+  aPipeDesc.vertexFunction   = [aLibrary newFunctionWithName:@"vertex_id_buffer"];
+  aPipeDesc.fragmentFunction = [aLibrary newFunctionWithName:@"fragment_id_buffer"];
+  aPipeDesc.colorAttachments[0].pixelFormat = MTLPixelFormatRGBA32Uint;
+  aPipeDesc.colorAttachments[0].blendingEnabled = NO;
+  aPipeDesc.depthAttachmentPixelFormat = MTLPixelFormatDepth32Float;
+  myPipeline = [theCtx->Device() newRenderPipelineStateWithDescriptor:aPipeDesc error:&anError];
+  if (myPipeline == nil)
+  {
+    theCtx->Messenger()->SendFail() << "Metal_IdBuffer: failed to create ID pass pipeline: "
+                                    << (anError != nil ? [[anError localizedDescription] UTF8String] : "");
+    return false;
+  }
+
+  MTLDepthStencilDescriptor* aDepthDesc = [[MTLDepthStencilDescriptor alloc] init];
+  aDepthDesc.depthCompareFunction = MTLCompareFunctionLess;
+  aDepthDesc.depthWriteEnabled = YES;
+  myDepthState = [theCtx->Device() newDepthStencilStateWithDescriptor:aDepthDesc];
+  return myDepthState != nil;
+}
+
+// =======================================================================
+// function : initTextures
+// purpose  : (Re)create ID and depth textures
+// =======================================================================
+bool Metal_IdBuffer::initTextures(Metal_Context* theCtx, int theSizeX, int theSizeY)
+{
+  if (myIdTexture != nil && mySizeX == theSizeX && mySizeY == theSizeY)
+  {
+    return true;
+  }
+
+  myIdTexture = nil;
+  myDepthTexture = nil;
+  mySizeX = 0;
+  mySizeY = 0;
+
+  MTLTextureDescriptor* anIdDesc = [MTLTextureDescriptor texture2DDescriptorWithPixelFormat:MTLPixelFormatRGBA32Uint
+                                                                                      width:theSizeX
+                                                                                     height:theSizeY
+                                                                                  mipmapped:NO];
+  anIdDesc.usage = MTLTextureUsageRenderTarget;
+  anIdDesc.storageMode = MTLStorageModePrivate;
+
+  MTLTextureDescriptor* aDepthDesc = [MTLTextureDescriptor texture2DDescriptorWithPixelFormat:MTLPixelFormatDepth32Float
+                                                                                        width:theSizeX
+                                                                                       height:theSizeY
+                                                                                    mipmapped:NO];
+  aDepthDesc.usage = MTLTextureUsageRenderTarget;
+  aDepthDesc.storageMode = MTLStorageModePrivate;
+
+  myIdTexture    = [theCtx->Device() newTextureWithDescriptor:anIdDesc];
+  myDepthTexture = [theCtx->Device() newTextureWithDescriptor:aDepthDesc];
+  if (myIdTexture == nil || myDepthTexture == nil)
+  {
+    theCtx->Messenger()->SendFail() << "Metal_IdBuffer: failed to allocate " << theSizeX << "x" << theSizeY << " ID buffer";
+    myIdTexture = nil;
+    myDepthTexture = nil;
+    return false;
+  }
+
+  myIdTexture.label = @"IdBuffer";
+  mySizeX = theSizeX;
+  mySizeY = theSizeY;
+  return true;
+}
+
+// =======================================================================
+// function : Render
+// purpose  : Encode ID pass
+// =======================================================================
+void Metal_IdBuffer::Render(Metal_Context* theCtx,
+                            id<MTLCommandBuffer> theCmdBuffer,
+                            const NCollection_List<occ::handle<Graphic3d_Layer>>& theLayers,
+                            int theViewId,
+                            const NCollection_Mat4<float>& theViewMatrix,
+                            const NCollection_Mat4<float>& theProjMatrix,
+                            int theSizeX,
+                            int theSizeY)
+{
+  myHasContent = false;
+  if (theCmdBuffer == nil || theSizeX <= 0 || theSizeY <= 0
+   || !Init(theCtx)
+   || !initTextures(theCtx, theSizeX, theSizeY))
+  {
+    return;
+  }
+
+  MTLRenderPassDescriptor* aPassDesc = [MTLRenderPassDescriptor renderPassDescriptor];
+  aPassDesc.colorAttachments[0].texture = myIdTexture;
+  aPassDesc.colorAttachments[0].loadAction = MTLLoadActionClear;
+  aPassDesc.colorAttachments[0].storeAction = MTLStoreActionStore;
+  aPassDesc.colorAttachments[0].clearColor = MTLClearColorMake(0.0, 0.0, 0.0, 0.0);
+  aPassDesc.depthAttachment.texture = myDepthTexture;
+  aPassDesc.depthAttachment.loadAction = MTLLoadActionClear;
+  aPassDesc.depthAttachment.storeAction = MTLStoreActionDontCare;
+  aPassDesc.depthAttachment.clearDepth = 1.0;
+
+  id<MTLRenderCommandEncoder> anEncoder = [theCmdBuffer renderCommandEncoderWithDescriptor:aPassDesc];
+  if (anEncoder == nil)
+  {
+    return;
+  }
+  anEncoder.label = @"IdBuffer";
+
+  MTLViewport aViewport = { 0.0, 0.0, (double)theSizeX, (double)theSizeY, 0.0, 1.0 };
+  [anEncoder setViewport:aViewport];
+  [anEncoder setRenderPipelineState:myPipeline];
+  [anEncoder setDepthStencilState:myDepthState];
+  [anEncoder setCullMode:MTLCullModeNone];
+
+  Metal_IdUniforms aUniforms;
+  std::copy(theProjMatrix.GetData(), theProjMatrix.GetData() + 16, aUniforms.ProjectionMatrix);
+  for (NCollection_List<occ::handle<Graphic3d_Layer>>::Iterator aLayerIter(theLayers); aLayerIter.More(); aLayerIter.Next())
+  {
+    const occ::handle<Graphic3d_Layer>& aLayer = aLayerIter.Value();
+    if (aLayer.IsNull() || aLayer->NbStructures() == 0
+     || aLayer->IsImmediate() || aLayer->IsCulled())
+    {
+      continue;
+    }
+
+    const Graphic3d_ArrayOfIndexedMapOfStructure& aStructArray = aLayer->ArrayOfStructures();
+    for (int aPriorityIdx = 0; aPriorityIdx < Graphic3d_DisplayPriority_NB; ++aPriorityIdx)
+    {
+      const NCollection_IndexedMap<const Graphic3d_CStructure*>& aStructMap = aStructArray[aPriorityIdx];
+      for (int aStructIdx = 1; aStructIdx <= aStructMap.Extent(); ++aStructIdx)
+      {
+        const Graphic3d_CStructure* aCStruct = aStructMap.FindKey(aStructIdx);
+        if (aCStruct == nullptr
+         || aCStruct->IsCulled()
+         || !aCStruct->IsVisible(theViewId))
+        {
+          continue;
+        }
+
+        // all structures of the view are created by Metal_GraphicDriver
+        const Metal_Structure* aStruct = static_cast<const Metal_Structure*>(aCStruct);
+        const NCollection_Mat4<float> aModelView = theViewMatrix * aStruct->RenderTransformation();
+        std::copy(aModelView.GetData(), aModelView.GetData() + 16, aUniforms.ModelViewMatrix);
+        [anEncoder setVertexBytes:&aUniforms length:sizeof(aUniforms) atIndex:1];
+
+        int anArrayIndex = 0;
+        encodeStructure(theCtx, anEncoder, aStruct, aUniforms, (uint32_t)aCStruct->Identification() + 1, anArrayIndex);
+      }
+    }
+  }
+
+  [anEncoder endEncoding];
+  myHasContent = true;
+}
+
+// =======================================================================
+// function : Query
+// purpose  : Read back elements within the rectangle
+// =======================================================================
+bool Metal_IdBuffer::Query(Metal_Context* theCtx,
+                           int theLeft,
+                           int theTop,
+                           int theWidth,
+                           int theHeight,
+                           NCollection_Vector<Graphic3d_IdBufferSample>& theSamples) const
+{
+  theSamples.Clear();
+  if (!myHasContent || myIdTexture == nil
+   || theCtx == nullptr || !theCtx->IsValid())
+  {
+    return false;
+  }
+
+  const int aLeft   = std::max(theLeft, 0);
+  const int aTop    = std::max(theTop,  0);
+  const int aRight  = std::min(theLeft + theWidth,  mySizeX);
+  const int aBottom = std::min(theTop  + theHeight, mySizeY);
+  if (aRight <= aLeft || aBottom <= aTop)
+  {
+    return false;
+  }
+
+  const int aSizeX = aRight - aLeft;
+  const int aSizeY = aBottom - aTop;
+  const size_t aRowSize = size_t(aSizeX) * THE_ID_PIXEL_SIZE;
+  id<MTLBuffer> aReadBuffer = [theCtx->Device() newBufferWithLength:aRowSize * size_t(aSizeY)
+                                                            options:MTLResourceStorageModeShared];
+  id<MTLCommandBuffer> aCmdBuffer = [theCtx->CommandQueue() commandBuffer];
+  id<MTLBlitCommandEncoder> aBlit = [aCmdBuffer blitCommandEncoder];
+  if (aReadBuffer == nil || aBlit == nil)
+  {
+    return false;
+  }
+
+  // the command buffer is executed after already committed frame containing the ID pass
+  [aBlit copyFromTexture:myIdTexture
+             sourceSlice:0
+             sourceLevel:0
+            sourceOrigin:MTLOriginMake(aLeft, aTop, 0)
+              sourceSize:MTLSizeMake(aSizeX, aSizeY, 1)
+                toBuffer:aReadBuffer
+       destinationOffset:0
+  destinationBytesPerRow:aRowSize
+destinationBytesPerImage:aRowSize * size_t(aSizeY)];
+  [aBlit endEncoding];
+  [aCmdBuffer commit];
+  [aCmdBuffer waitUntilCompleted];
+
+  // gather covered pixels and keep the nearest sample of each element
+  const uint32_t* aPixels = static_cast<const uint32_t*>([aReadBuffer contents]);
+  const int aNbPixels = aSizeX * aSizeY;
+  std::vector<Graphic3d_IdBufferSample> aSamples;
+  aSamples.reserve(aNbPixels);
+  for (int aPixelIter = 0; aPixelIter < aNbPixels; ++aPixelIter)
+  {
+    const uint32_t* aPixel = aPixels + size_t(aPixelIter) * 4;
+    if (aPixel[0] == 0)
+    {
+      continue;
+    }
+
+    Graphic3d_IdBufferSample aSample;
+    aSample.StructureId  = int(aPixel[0] - 1);
+    aSample.ArrayIndex   = int(aPixel[1]);
+    aSample.ElementIndex = int(aPixel[2]);
+    std::memcpy(&aSample.Depth, aPixel + 3, sizeof(float));
+    aSamples.push_back(aSample);
+  }
+
+  std::sort(aSamples.begin(), aSamples.end(),
+            [](const Graphic3d_IdBufferSample& theLeft, const Graphic3d_IdBufferSample& theRight)
+            {
+              if (theLeft.StructureId != theRight.StructureId)
+              {
+                return theLeft.StructureId < theRight.StructureId;
+              }
+              if (theLeft.ArrayIndex != theRight.ArrayIndex)
+              {
+                return theLeft.ArrayIndex < theRight.ArrayIndex;
+              }
+              if (theLeft.ElementIndex != theRight.ElementIndex)
+              {
+                return theLeft.ElementIndex < theRight.ElementIndex;
+              }
+              return theLeft.Depth < theRight.Depth;
+            });
+  aSamples.erase(std::unique(aSamples.begin(), aSamples.end(),
+                             [](const Graphic3d_IdBufferSample& theLeft, const Graphic3d_IdBufferSample& theRight)
+                             {
+                               return theLeft.IsSameElement(theRight);
+                             }),
+                 aSamples.end());
+  std::stable_sort(aSamples.begin(), aSamples.end(),
+                   [](const Graphic3d_IdBufferSample& theLeft, const Graphic3d_IdBufferSample& theRight)
+                   {
+                     return theLeft.Depth < theRight.Depth;
+                   });
+  for (const Graphic3d_IdBufferSample& aSample : aSamples)
+  {
+    theSamples.Append(aSample);
+  }
+  return true;
+}
@@ -78,6 +78,17 @@ public:
                             int theNbIndices,
                             const void* theData);
 
+  //! Wrap index data of application buffer without copying (see Metal_Buffer::Adopt()).
+  //! @param theCtx Metal context
+  //! @param theType index type (UInt16 or UInt32)
+  //! @param theNbIndices number of indices
+  //! @param theOwner buffer owning page-aligned memory with indices at the beginning
+  //! @return FALSE if memory cannot be adopted
+  Standard_EXPORT bool Adopt(Metal_Context* theCtx,
+                             Metal_IndexType theType,
+                             int theNbIndices,
+                             const occ::handle<NCollection_Buffer>& theOwner);
+
 #ifdef __OBJC__
   //! Return Metal index type enum.
   MTLIndexType MetalIndexType() const
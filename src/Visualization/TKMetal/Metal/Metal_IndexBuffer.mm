@@ -49,7 +49,7 @@ bool Metal_IndexBuffer::Init(Metal_Context* theCtx,
   myIndexType = Metal_IndexType_UInt16;
   myComponentsNb = 1;
   myDataTypeSize = sizeof(unsigned short);
-  return Metal_Buffer::initData(theCtx, 1, theNbIndices, sizeof(unsigned short), theData);
+  return Metal_Buffer::initData(theCtx, 1, theNbIndices, sizeof(unsigned short), theData, staticStorageMode(theCtx));
 }
 
 // =======================================================================
@@ -63,7 +63,7 @@ bool Metal_IndexBuffer::Init(Metal_Context* theCtx,
   myIndexType = Metal_IndexType_UInt32;
   myComponentsNb = 1;
   myDataTypeSize = sizeof(unsigned int);
-  return Metal_Buffer::initData(theCtx, 1, theNbIndices, sizeof(unsigned int), theData);
+  return Metal_Buffer::initData(theCtx, 1, theNbIndices, sizeof(unsigned int), theData, staticStorageMode(theCtx));
 }
 
 // =======================================================================
@@ -80,11 +80,25 @@ bool Metal_IndexBuffer::Init(Metal_Context* theCtx,
   if (theType == Metal_IndexType_UInt16)
   {
     myDataTypeSize = sizeof(unsigned short);
-    return Metal_Buffer::initData(theCtx, 1, theNbIndices, sizeof(unsigned short), theData);
+    return Metal_Buffer::initData(theCtx, 1, theNbIndices, sizeof(unsigned short), theData, staticStorageMode(theCtx));
   }
   else
   {
     myDataTypeSize = sizeof(unsigned int);
-    return Metal_Buffer::initData(theCtx, 1, theNbIndices, sizeof(unsigned int), theData);
+    return Metal_Buffer::initData(theCtx, 1, theNbIndices, sizeof(unsigned int), theData, staticStorageMode(theCtx));
   }
 }
+
+// =======================================================================
+// function : Adopt
+// purpose  : Wrap index data without copying
+// =======================================================================
+bool Metal_IndexBuffer::Adopt(Metal_Context* theCtx,
+                              Metal_IndexType theType,
+                              int theNbIndices,
+                              const occ::handle<NCollection_Buffer>& theOwner)
+{
+  myIndexType = theType;
+  const size_t anIndexSize = IndexSize();
+  return Metal_Buffer::Adopt(theCtx, 1, theNbIndices, anIndexSize, theOwner, 0);
+}
@@ -0,0 +1,139 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef Metal_IndirectLayer_HeaderFile
+#define Metal_IndirectLayer_HeaderFile
+
+#include <NCollection_Mat4.hxx>
+#include <NCollection_Vector.hxx>
+#include <Standard_Transient.hxx>
+#include <Standard_Type.hxx>
+
+#include <vector>
+
+#ifdef __OBJC__
+@protocol MTLBuffer;
+@protocol MTLDepthStencilState;
+@protocol MTLResource;
+@class NSMutableArray;
+#endif
+
+class Graphic3d_CStructure;
+class Graphic3d_Layer;
+class Metal_Context;
+class Metal_Structure;
+class Metal_Workspace;
+
+//! Render commands of a static Z-layer recorded into MTLIndirectCommandBuffer.
+//!
+//! Draw calls of all groups within the layer (pipeline state, vertex buffers,
+//! uniform buffer offsets) are encoded once, and then replayed by executeCommandsInBuffer
+//! while the layer content remains the same; CPU cost of the frame is reduced to
+//! updating per-structure matrices within uniform buffer.
+//! Commands are re-recorded when structure is added to / removed from the layer,
+//! or when modification state of some structure is changed (new aspect, highlighting);
+//! transformation changes only update matrices within uniform buffer.
+//!
+//! When Metal_Caps::useGpuCulling is set, commands are additionally culled on GPU (see Metal_GpuCulling).
+//!
+//! Only plain shaded geometry can be recorded; layers with text, edges, transformation persistence,
+//! highlighted structures or per-group stencil/flipping options are rendered in normal way.
+class Metal_IndirectLayer : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(Metal_IndirectLayer, Standard_Transient)
+  friend class Metal_GpuCulling;
+public:
+
+  //! Return maximum number of commands within single indirect command buffer.
+  static int MaxCommandsPerBuffer() { return 16384; }
+
+  //! Create empty layer cache.
+  Standard_EXPORT Metal_IndirectLayer();
+
+  //! Destructor.
+  Standard_EXPORT ~Metal_IndirectLayer() override;
+
+  //! Render the layer using recorded commands (commands are re-recorded if layer has been modified).
+  //! @param theWorkspace workspace defining active encoder, camera and lights
+  //! @param theLayer     layer to render
+  //! @return FALSE if layer cannot be recorded, so that it should be rendered in normal way
+  Standard_EXPORT bool Render(Metal_Workspace* theWorkspace,
+                              const Graphic3d_Layer& theLayer);
+
+  //! Return TRUE if commands have been recorded.
+  bool IsRecorded() const { return myNbDraws > 0; }
+
+  //! Return number of recorded draw calls.
+  int NbDraws() const { return myNbDraws; }
+
+  //! Release recorded commands and buffers.
+  Standard_EXPORT void Release();
+
+protected:
+
+  //! Per-draw parameters.
+  struct DrawInfo
+  {
+    int   TrsfIndex;     //!< index of structure within myStructs
+    int   MaterialIndex; //!< index of material slot
+    float Color[4];      //!< interior color
+  };
+
+  //! Compute layer content signature.
+  Standard_EXPORT size_t layerSignature(const Graphic3d_Layer& theLayer,
+                                        Metal_Workspace* theWorkspace) const;
+
+  //! Return TRUE if structure can be recorded.
+  Standard_EXPORT static bool isRecordable(const Metal_Structure* theStruct);
+
+  //! Record commands for all structures within the layer.
+  Standard_EXPORT bool record(Metal_Workspace* theWorkspace,
+                              const Graphic3d_Layer& theLayer);
+
+  //! Write per-frame uniforms (matrices, lights) into uniform buffer of specified frame slot.
+  Standard_EXPORT void updateUniforms(Metal_Workspace* theWorkspace,
+                                      int theSlot);
+
+protected:
+
+  NCollection_Vector<DrawInfo>                myDraws;       //!< per-draw parameters
+  NCollection_Vector<const Metal_Structure*> myStructs; //!< recorded structures
+  size_t myLayerSignature;  //!< signature of recorded layer content
+  int    myNbDraws;         //!< number of recorded draw calls
+  int    myNbMaterials;     //!< number of material slots
+  bool   myIsRecordable;    //!< layer content can be recorded
+  bool   myToRerecord;      //!< commands should be recorded again (fallback programs were used)
+  int    myCulledSlot;      //!< frame slot which commands have been culled for current frame (-1 if none)
+
+#ifdef __OBJC__
+  NSMutableArray*           myCommandBuffers; //!< per-frame-slot arrays of indirect command buffers
+  NSMutableArray*           myUniformBuffers; //!< per-frame-slot uniform buffers
+  NSMutableArray*           myResources;      //!< buffers referenced by recorded commands
+  std::vector<__unsafe_unretained id<MTLResource>> myResourceRefs; //!< unretained references to myResources
+  id<MTLDepthStencilState>  myDepthStencil;   //!< depth-stencil state for replayed commands
+  id<MTLBuffer>             myBoundsBuffer;   //!< world-space bounds of draws (for GPU culling)
+  NSMutableArray*           myCulledCommandBuffers; //!< per-frame-slot command buffers filled by GPU culling
+  NSMutableArray*           myCullArguments;  //!< per-frame-slot argument buffers referring culled command buffers
+#else
+  void*                     myCommandBuffers;
+  void*                     myUniformBuffers;
+  void*                     myResources;
+  std::vector<void*>        myResourceRefs;
+  void*                     myDepthStencil;
+  void*                     myBoundsBuffer;
+  void*                     myCulledCommandBuffers;
+  void*                     myCullArguments;
+#endif
+};
+
+#endif // Metal_IndirectLayer_HeaderFile
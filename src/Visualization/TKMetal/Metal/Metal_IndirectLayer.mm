@@ -0,0 +1,649 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#import <TargetConditionals.h>
+#import <Metal/Metal.h>
+
+#include <Metal_IndirectLayer.hxx>
+#include <Metal_Caps.hxx>
+#include <Metal_Context.hxx>
+#include <Metal_Group.hxx>
+#include <Metal_PrimitiveArray.hxx>
+#include <Metal_ShaderManager.hxx>
+#include <Metal_Structure.hxx>
+#include <Metal_View.hxx>
+#include <Metal_Workspace.hxx>
+
+#include <Graphic3d_Layer.hxx>
+#include <NCollection_DataMap.hxx>
+
+#include <algorithm>
+#include <cstring>
+
+IMPLEMENT_STANDARD_RTTIEXT(Metal_IndirectLayer, Standard_Transient)
+
+namespace
+{
+  //! Alignment of uniform blocks within uniform buffer (constant buffer offset alignment).
+  static const size_t THE_UNIFORM_ALIGNMENT = 256;
+
+  //! Per-draw uniforms; should match layout used by Metal_Workspace::ApplyUniforms().
+  struct Metal_IndirectDrawUniforms
+  {
+    float ModelViewMatrix[16];
+    float ProjectionMatrix[16];
+    float Color[4];
+  };
+
+  //! Round size up to uniform alignment.
+  static size_t alignUniform(size_t theSize)
+  {
+    return (theSize + THE_UNIFORM_ALIGNMENT - 1) / THE_UNIFORM_ALIGNMENT * THE_UNIFORM_ALIGNMENT;
+  }
+
+  //! Offset of clipping planes block within uniform buffer (lights are at 0).
+  static size_t clipUniformsOffset()
+  {
+    return alignUniform(sizeof(Metal_LightUniforms));
+  }
+
+  //! Offset of shadow uniforms block within uniform buffer.
+  static size_t shadowUniformsOffset()
+  {
+    return clipUniformsOffset() + alignUniform(sizeof(Metal_ClipPlaneUniforms));
+  }
+
+  //! Offset of first material block within uniform buffer.
+  static size_t materialUniformsOffset()
+  {
+    return shadowUniformsOffset() + alignUniform(sizeof(Metal_ShadowUniforms));
+  }
+
+  //! Combine hash value.
+  static void hashCombine(size_t& theSeed, size_t theValue)
+  {
+    theSeed ^= theValue + 0x9e3779b9 + (theSeed << 6) + (theSeed >> 2);
+  }
+
+  //! Bounds of the draw in structure space; should match DrawBounds in Metal_GpuCulling shader.
+  struct Metal_IndirectDrawBounds
+  {
+    float    Min[3];    //!< minimal corner
+    uint32_t IsDefined; //!< 0 for undefined bounds
+    float    Max[3];    //!< maximal corner
+    uint32_t TrsfSlot;  //!< slot of structure transformation within Metal_TransformBuffer
+  };
+
+  //! Fill bounds of the draw, transformed into world space by GPU culling
+  //! using transformation buffer, so that moved structures do not require recording commands again.
+  static Metal_IndirectDrawBounds localBounds(const Graphic3d_BndBox4f& theBox,
+                                              int theTrsfSlot)
+  {
+    Metal_IndirectDrawBounds aBounds;
+    memset(&aBounds, 0, sizeof(aBounds));
+    if (!theBox.IsValid() || theTrsfSlot < 0)
+    {
+      return aBounds;
+    }
+
+    memcpy(aBounds.Min, theBox.CornerMin().GetData(), sizeof(aBounds.Min));
+    memcpy(aBounds.Max, theBox.CornerMax().GetData(), sizeof(aBounds.Max));
+    aBounds.IsDefined = 1;
+    aBounds.TrsfSlot = uint32_t(theTrsfSlot);
+    return aBounds;
+  }
+
+  //! Primitive array to be recorded.
+  struct Metal_IndirectItem
+  {
+    int                         TrsfIndex;
+    const Metal_Group*          Group;
+    const Metal_PrimitiveArray* Array;
+  };
+
+  //! Collect groups of the structure (including instanced one).
+  static void collectItems(const Metal_Structure* theStruct,
+                           int theTrsfIndex,
+                           NCollection_Vector<Metal_IndirectItem>& theItems)
+  {
+    if (theStruct->InstancedStructure() != nullptr)
+    {
+      collectItems(theStruct->InstancedStructure(), theTrsfIndex, theItems);
+    }
+    for (Metal_Structure::GroupIterator aGroupIter(theStruct->Groups()); aGroupIter.More(); aGroupIter.Next())
+    {
+      const Metal_Group* aGroup = aGroupIter.Value();
+      if (aGroup == nullptr)
+      {
+        continue;
+      }
+      for (NCollection_List<Metal_PrimitiveArray*>::Iterator aPrimIter(aGroup->Primitives()); aPrimIter.More(); aPrimIter.Next())
+      {
+        if (aPrimIter.Value() != nullptr)
+        {
+          Metal_IndirectItem anItem = { theTrsfIndex, aGroup, aPrimIter.Value() };
+          theItems.Append(anItem);
+        }
+      }
+    }
+  }
+}
+
+// =======================================================================
+// function : Metal_IndirectLayer
+// purpose  : Constructor
+// =======================================================================
+Metal_IndirectLayer::Metal_IndirectLayer()
+: myLayerSignature(0),
+  myNbDraws(0),
+  myNbMaterials(0),
+  myIsRecordable(false),
+  myToRerecord(true),
+  myCulledSlot(-1),
+  myCommandBuffers(nil),
+  myUniformBuffers(nil),
+  myResources(nil),
+  myDepthStencil(nil),
+  myBoundsBuffer(nil),
+  myCulledCommandBuffers(nil),
+  myCullArguments(nil)
+{
+  //
+}
+
+// =======================================================================
+// function : ~Metal_IndirectLayer
+// purpose  : Destructor
+// =======================================================================
+Metal_IndirectLayer::~Metal_IndirectLayer()
+{
+  Release();
+}
+
+// =======================================================================
+// function : Release
+// purpose  : Release recorded commands and buffers
+// =======================================================================
+void Metal_IndirectLayer::Release()
+{
+  myDraws.Clear();
+  myStructs.Clear();
+  myResourceRefs.clear();
+  myCommandBuffers = nil;
+  myUniformBuffers = nil;
+  myResources = nil;
+  myDepthStencil = nil;
+  myBoundsBuffer = nil;
+  myCulledCommandBuffers = nil;
+  myCullArguments = nil;
+  myCulledSlot = -1;
+  myNbDraws = 0;
+  myNbMaterials = 0;
+  myIsRecordable = false;
+  myToRerecord = true;
+}
+
+// =======================================================================
+// function : isRecordable
+// purpose  : Return TRUE if structure can be recorded
+// =======================================================================
+bool Metal_IndirectLayer::isRecordable(const Metal_Structure* theStruct)
+{
+  if (theStruct == nullptr
+   || theStruct->highlight != 0
+   || !theStruct->TransformPersistence().IsNull()
+   || theStruct->HasGroupTransformPersistence()
+   || (!theStruct->ClipPlanes().IsNull() && !theStruct->ClipPlanes()->IsEmpty()))
+  {
+    // structure clipping planes are selected per structure (Metal_Workspace::SetStructureClipping())
+    return false;
+  }
+  if (theStruct->InstancedStructure() != nullptr
+   && !isRecordable(theStruct->InstancedStructure()))
+  {
+    return false;
+  }
+
+  for (Metal_Structure::GroupIterator aGroupIter(theStruct->Groups()); aGroupIter.More(); aGroupIter.Next())
+  {
+    const Metal_Group* aGroup = aGroupIter.Value();
+    if (aGroup == nullptr)
+    {
+      continue;
+    }
+
+    const occ::handle<Graphic3d_Aspects> anAspect = aGroup->Aspects();
+    if (anAspect.IsNull()
+     || aGroup->HasTexts()
+     || aGroup->HasBSplineSurfaces()
+     || aGroup->HasPointClouds()
+     || aGroup->HasPersistence()
+     || aGroup->IsStencilTestEnabled()
+     || aGroup->IsFlippingEnabled()
+     || aGroup->HasTransformation()
+     || aGroup->LevelOfDetail() >= 0
+     || anAspect->ToDrawEdges()
+     || anAspect->InteriorStyle() == Aspect_IS_EMPTY
+     || anAspect->InteriorStyle() == Aspect_IS_HOLLOW)
+    {
+      return false;
+    }
+
+    // recorded pipelines read float normals; mutable attributes are uploaded by direct rendering
+    for (NCollection_List<Metal_PrimitiveArray*>::Iterator aPrimIter(aGroup->Primitives()); aPrimIter.More(); aPrimIter.Next())
+    {
+      if (aPrimIter.Value() != nullptr
+       && (aPrimIter.Value()->HasOctahedralNormals()
+        || aPrimIter.Value()->HasMutableAttributes()))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// =======================================================================
+// function : layerSignature
+// purpose  : Compute layer content signature
+// =======================================================================
+size_t Metal_IndirectLayer::layerSignature(const Graphic3d_Layer& theLayer,
+                                           Metal_Workspace* theWorkspace) const
+{
+  size_t aSeed = static_cast<size_t>(theLayer.NbStructures());
+  if (theWorkspace->ShaderManager() != nullptr)
+  {
+    hashCombine(aSeed, theWorkspace->ShaderManager()->ProgramsRevision());
+  }
+  if (!theWorkspace->Context()->BufferAllocator().IsNull())
+  {
+    // recorded commands refer to buffer offsets changed by compaction
+    hashCombine(aSeed, theWorkspace->Context()->BufferAllocator()->Revision());
+  }
+
+  const Graphic3d_ArrayOfIndexedMapOfStructure& aStructArray = theLayer.ArrayOfStructures();
+  for (int aPriorityIdx = 0; aPriorityIdx < Graphic3d_DisplayPriority_NB; ++aPriorityIdx)
+  {
+    const NCollection_IndexedMap<const Graphic3d_CStructure*>& aStructMap = aStructArray[aPriorityIdx];
+    for (int aStructIdx = 1; aStructIdx <= aStructMap.Extent(); ++aStructIdx)
+    {
+      const Graphic3d_CStructure* aCStruct = aStructMap.FindKey(aStructIdx);
+      if (aCStruct == nullptr || !aCStruct->IsVisible())
+      {
+        continue;
+      }
+
+      hashCombine(aSeed, reinterpret_cast<size_t>(aCStruct));
+      hashCombine(aSeed, aCStruct->highlight);
+      if (const Metal_Structure* aMetalStruct = dynamic_cast<const Metal_Structure*>(aCStruct))
+      {
+        // moving structure does not modify recorded commands, as matrices are written per frame
+        hashCombine(aSeed, aMetalStruct->ModificationState() - aMetalStruct->TransformModificationState());
+        hashCombine(aSeed, static_cast<size_t>(aMetalStruct->TransformPersistence().IsNull() ? 0 : 1));
+        for (const Metal_Structure* anInstanced = aMetalStruct->InstancedStructure(); anInstanced != nullptr;
+             anInstanced = anInstanced->InstancedStructure())
+        {
+          hashCombine(aSeed, anInstanced->ModificationState());
+        }
+      }
+    }
+  }
+  return aSeed;
+}
+
+// =======================================================================
+// function : Render
+// purpose  : Render the layer using recorded commands
+// =======================================================================
+bool Metal_IndirectLayer::Render(Metal_Workspace* theWorkspace,
+                                 const Graphic3d_Layer& theLayer)
+{
+  Metal_Context* aCtx = theWorkspace != nullptr ? theWorkspace->Context() : nullptr;
+  if (aCtx == nullptr
+   || theWorkspace->ActiveEncoder() == nil
+   || !aCtx->HasIndirectCommandBuffers())
+  {
+    return false;
+  }
+
+  const size_t aSignature = layerSignature(theLayer, theWorkspace);
+  if (aSignature != myLayerSignature || myToRerecord)
+  {
+    Release();
+    myLayerSignature = aSignature;
+    myIsRecordable = record(theWorkspace, theLayer);
+  }
+  if (!myIsRecordable)
+  {
+    return false;
+  }
+  if (myNbDraws == 0)
+  {
+    return true;
+  }
+
+  const int aSlot = aCtx->CurrentFrameIndex() % Metal_MaxFramesInFlight;
+  updateUniforms(theWorkspace, aSlot);
+
+  id<MTLRenderCommandEncoder> anEncoder = theWorkspace->ActiveEncoder();
+  [anEncoder setDepthStencilState:myDepthStencil];
+  [anEncoder setCullMode:MTLCullModeBack];
+  [anEncoder useResource:myUniformBuffers[aSlot] usage:MTLResourceUsageRead];
+  if (!myResourceRefs.empty())
+  {
+    [anEncoder useResources:myResourceRefs.data()
+                      count:myResourceRefs.size()
+                      usage:MTLResourceUsageRead];
+  }
+
+  // use commands culled on GPU for this frame, if any
+  NSArray* aCommandBuffers = myCulledSlot == aSlot ? myCulledCommandBuffers[aSlot] : myCommandBuffers[aSlot];
+  myCulledSlot = -1;
+  int aNbLeft = myNbDraws;
+  for (id<MTLIndirectCommandBuffer> anIcb in aCommandBuffers)
+  {
+    const int aNbCommands = std::min(aNbLeft, MaxCommandsPerBuffer());
+    [anEncoder executeCommandsInBuffer:anIcb withRange:NSMakeRange(0, static_cast<NSUInteger>(aNbCommands))];
+    aNbLeft -= aNbCommands;
+  }
+
+  // states set by replayed commands are not tracked by workspace
+  theWorkspace->InvalidateEncoderState();
+  return true;
+}
+
+// =======================================================================
+// function : record
+// purpose  : Record commands for all structures within the layer
+// =======================================================================
+bool Metal_IndirectLayer::record(Metal_Workspace* theWorkspace,
+                                 const Graphic3d_Layer& theLayer)
+{
+  Metal_Context* aCtx = theWorkspace->Context();
+  Metal_ShaderManager* aShaderMgr = theWorkspace->ShaderManager();
+  if (aShaderMgr == nullptr)
+  {
+    return false;
+  }
+
+  // collect primitive arrays in the same order as rendered by Metal_View
+  NCollection_Vector<Metal_IndirectItem> anItems;
+  const Graphic3d_ArrayOfIndexedMapOfStructure& aStructArray = theLayer.ArrayOfStructures();
+  for (int aPriorityIdx = 0; aPriorityIdx < Graphic3d_DisplayPriority_NB; ++aPriorityIdx)
+  {
+    const NCollection_IndexedMap<const Graphic3d_CStructure*>& aStructMap = aStructArray[aPriorityIdx];
+    for (int aStructIdx = 1; aStructIdx <= aStructMap.Extent(); ++aStructIdx)
+    {
+      const Graphic3d_CStructure* aCStruct = aStructMap.FindKey(aStructIdx);
+      if (aCStruct == nullptr || !aCStruct->IsVisible())
+      {
+        continue;
+      }
+
+      const Metal_Structure* aMetalStruct = dynamic_cast<const Metal_Structure*>(aCStruct);
+      if (!isRecordable(aMetalStruct))
+      {
+        return false;
+      }
+      myStructs.Append(aMetalStruct);
+      collectItems(aMetalStruct, myStructs.Upper(), anItems);
+    }
+  }
+  myToRerecord = false;
+  if (anItems.IsEmpty())
+  {
+    return true;
+  }
+
+  // resolve pipelines and materials
+  const occ::handle<Graphic3d_Aspects> aPrevAspect = theWorkspace->Aspect();
+  NCollection_DataMap<occ::handle<Graphic3d_Aspects>, int> aMaterialIds;
+  NCollection_Vector<Metal_MaterialUniforms> aMaterials;
+  NSMutableArray* aPipelines = [NSMutableArray arrayWithCapacity:anItems.Size()];
+  const bool toComputeBounds = aCtx->Caps()->useGpuCulling;
+  NCollection_Vector<Metal_IndirectDrawBounds> aBounds;
+  myResources = [[NSMutableArray alloc] init];
+  for (NCollection_Vector<Metal_IndirectItem>::Iterator anItemIter(anItems); anItemIter.More(); anItemIter.Next())
+  {
+    const Metal_IndirectItem& anItem = anItemIter.Value();
+    const occ::handle<Graphic3d_Aspects> anAspect = anItem.Group->Aspects();
+    int aMaterialId = 0;
+    if (!aMaterialIds.Find(anAspect, aMaterialId))
+    {
+      theWorkspace->SetAspect(anAspect);
+      aMaterials.Append(theWorkspace->MaterialUniforms());
+      aMaterialId = aMaterials.Upper();
+      aMaterialIds.Bind(anAspect, aMaterialId);
+    }
+
+    Graphic3d_TypeOfShadingModel aShadingModel = anAspect->ShadingModel();
+    if (aShadingModel == Graphic3d_TypeOfShadingModel_DEFAULT)
+    {
+      aShadingModel = Graphic3d_TypeOfShadingModel_Phong;
+    }
+    id<MTLRenderPipelineState> aPipeline = nil;
+    id<MTLDepthStencilState> aDepthStencil = nil;
+    if (!aShaderMgr->GetProgram(aShadingModel, 0, aPipeline, aDepthStencil)
+     || aPipeline == nil)
+    {
+      theWorkspace->SetAspect(aPrevAspect);
+      myResources = nil;
+      return false;
+    }
+    myDepthStencil = aDepthStencil;
+    [aPipelines addObject:aPipeline];
+
+    if (!anItem.Array->IsInitialized())
+    {
+      const_cast<Metal_PrimitiveArray*>(anItem.Array)->Init(aCtx);
+    }
+
+    if (toComputeBounds)
+    {
+      aBounds.Append(localBounds(anItem.Group->BoundingBox(), myStructs.Value(anItem.TrsfIndex)->TransformSlot()));
+    }
+
+    const Quantity_ColorRGBA& aColor = anAspect->InteriorColorRGBA();
+    DrawInfo aDraw;
+    aDraw.TrsfIndex = anItem.TrsfIndex;
+    aDraw.MaterialIndex = aMaterialId;
+    aDraw.Color[0] = aColor.GetRGB().Red();
+    aDraw.Color[1] = aColor.GetRGB().Green();
+    aDraw.Color[2] = aColor.GetRGB().Blue();
+    aDraw.Color[3] = aColor.Alpha();
+    myDraws.Append(aDraw);
+  }
+  theWorkspace->SetAspect(aPrevAspect);
+
+  // commands recorded with fallback programs should be replaced by final ones
+  myToRerecord = aShaderMgr->HasPendingPrograms();
+  myNbMaterials = aMaterials.Size();
+
+  const size_t aDrawsOffset = materialUniformsOffset() + size_t(myNbMaterials) * THE_UNIFORM_ALIGNMENT;
+  const size_t aBufferSize  = aDrawsOffset + size_t(myDraws.Size()) * THE_UNIFORM_ALIGNMENT;
+  const size_t aClipOffset  = clipUniformsOffset();
+
+  MTLIndirectCommandBufferDescriptor* anIcbDesc = [[MTLIndirectCommandBufferDescriptor alloc] init];
+  anIcbDesc.commandTypes = MTLIndirectCommandTypeDraw | MTLIndirectCommandTypeDrawIndexed;
+  anIcbDesc.inheritPipelineState = NO;
+  anIcbDesc.inheritBuffers = NO;
+  anIcbDesc.maxVertexBufferBindCount = 6;
+  anIcbDesc.maxFragmentBufferBindCount = 6;
+
+  id<MTLDevice> aDevice = aCtx->Device();
+  myCommandBuffers = [NSMutableArray arrayWithCapacity:Metal_MaxFramesInFlight];
+  myUniformBuffers = [NSMutableArray arrayWithCapacity:Metal_MaxFramesInFlight];
+  for (int aSlot = 0; aSlot < Metal_MaxFramesInFlight; ++aSlot)
+  {
+    id<MTLBuffer> aUniformBuffer = [aDevice newBufferWithLength:aBufferSize
+                                                        options:MTLResourceStorageModeShared];
+    if (aUniformBuffer == nil)
+    {
+      aCtx->Messenger()->SendWarning() << "Metal_IndirectLayer: unable to allocate uniform buffer of "
+                                       << int(aBufferSize / 1024) << " KiB";
+      Release();
+      myToRerecord = false;
+      return false;
+    }
+
+    // materials are static - write them once
+    char* aData = static_cast<char*>([aUniformBuffer contents]);
+    for (int aMatIter = 0; aMatIter < myNbMaterials; ++aMatIter)
+    {
+      memcpy(aData + materialUniformsOffset() + size_t(aMatIter) * THE_UNIFORM_ALIGNMENT,
+             &aMaterials.Value(aMatIter), sizeof(Metal_MaterialUniforms));
+    }
+    [myUniformBuffers addObject:aUniformBuffer];
+
+    NSMutableArray* aSlotIcbs = [NSMutableArray array];
+    id<MTLIndirectCommandBuffer> anIcb = nil;
+    for (int aDrawIter = 0; aDrawIter < myDraws.Size(); ++aDrawIter)
+    {
+      const int aCmdIndex = aDrawIter % MaxCommandsPerBuffer();
+      if (aCmdIndex == 0)
+      {
+        const int aNbCommands = std::min(myDraws.Size() - aDrawIter, MaxCommandsPerBuffer());
+        anIcb = [aDevice newIndirectCommandBufferWithDescriptor:anIcbDesc
+                                                maxCommandCount:static_cast<NSUInteger>(aNbCommands)
+                                                        options:0];
+        if (anIcb == nil)
+        {
+          aCtx->Messenger()->SendWarning() << "Metal_IndirectLayer: unable to create indirect command buffer";
+          Release();
+          myToRerecord = false;
+          return false;
+        }
+        [aSlotIcbs addObject:anIcb];
+      }
+
+      const DrawInfo& aDraw = myDraws.Value(aDrawIter);
+      const size_t aDrawOffset = aDrawsOffset + size_t(aDrawIter) * THE_UNIFORM_ALIGNMENT;
+      const size_t aMatOffset  = materialUniformsOffset() + size_t(aDraw.MaterialIndex) * THE_UNIFORM_ALIGNMENT;
+
+      id<MTLIndirectRenderCommand> aCmd = [anIcb indirectRenderCommandAtIndex:static_cast<NSUInteger>(aCmdIndex)];
+      [aCmd setRenderPipelineState:aPipelines[aDrawIter]];
+      // same buffer indices as Metal_Workspace::ApplyUniforms(), ApplyLightingUniforms(), ApplyMaterialUniforms()
+      [aCmd setVertexBuffer:aUniformBuffer   offset:aDrawOffset atIndex:1];
+      [aCmd setVertexBuffer:aUniformBuffer   offset:0           atIndex:3];
+      [aCmd setFragmentBuffer:aUniformBuffer offset:aDrawOffset atIndex:0];
+      [aCmd setFragmentBuffer:aUniformBuffer offset:0           atIndex:1];
+      [aCmd setFragmentBuffer:aUniformBuffer offset:aMatOffset  atIndex:2];
+      [aCmd setFragmentBuffer:aUniformBuffer offset:aClipOffset atIndex:3];
+      [aCmd setFragmentBuffer:aUniformBuffer offset:shadowUniformsOffset() atIndex:5];
+      if (!anItems.Value(aDrawIter).Array->EncodeIndirect(aCmd, aSlot == 0 ? myResources : nil))
+      {
+        [aCmd reset];
+      }
+    }
+    [myCommandBuffers addObject:aSlotIcbs];
+  }
+
+  // world-space bounds and command buffers to be filled by GPU culling
+  if (toComputeBounds)
+  {
+    myBoundsBuffer = [aDevice newBufferWithLength:sizeof(Metal_IndirectDrawBounds) * size_t(aBounds.Size())
+                                          options:MTLResourceStorageModeShared];
+    myCulledCommandBuffers = [NSMutableArray arrayWithCapacity:Metal_MaxFramesInFlight];
+    for (int aSlot = 0; aSlot < Metal_MaxFramesInFlight && myBoundsBuffer != nil; ++aSlot)
+    {
+      NSMutableArray* aSlotIcbs = [NSMutableArray array];
+      for (int aDrawIter = 0; aDrawIter < myDraws.Size(); aDrawIter += MaxCommandsPerBuffer())
+      {
+        const int aNbCommands = std::min(myDraws.Size() - aDrawIter, MaxCommandsPerBuffer());
+        id<MTLIndirectCommandBuffer> anIcb = [aDevice newIndirectCommandBufferWithDescriptor:anIcbDesc
+                                                                             maxCommandCount:static_cast<NSUInteger>(aNbCommands)
+                                                                                     options:MTLResourceStorageModePrivate];
+        if (anIcb == nil)
+        {
+          aSlotIcbs = nil;
+          break;
+        }
+        [aSlotIcbs addObject:anIcb];
+      }
+      if (aSlotIcbs == nil)
+      {
+        myCulledCommandBuffers = nil;
+        break;
+      }
+      [myCulledCommandBuffers addObject:aSlotIcbs];
+    }
+    if (myBoundsBuffer == nil || myCulledCommandBuffers == nil)
+    {
+      aCtx->Messenger()->SendWarning() << "Metal_IndirectLayer: unable to allocate GPU culling buffers";
+      myBoundsBuffer = nil;
+      myCulledCommandBuffers = nil;
+    }
+    else
+    {
+      Metal_IndirectDrawBounds* aBoundsData = static_cast<Metal_IndirectDrawBounds*>([myBoundsBuffer contents]);
+      for (int aDrawIter = 0; aDrawIter < aBounds.Size(); ++aDrawIter)
+      {
+        aBoundsData[aDrawIter] = aBounds.Value(aDrawIter);
+      }
+    }
+  }
+
+  myResourceRefs.reserve([myResources count]);
+  for (id<MTLResource> aResource in myResources)
+  {
+    myResourceRefs.push_back(aResource);
+  }
+  myNbDraws = myDraws.Size();
+  aCtx->Messenger()->SendTrace() << "Metal_IndirectLayer: recorded " << myNbDraws << " draw calls";
+  return true;
+}
+
+// =======================================================================
+// function : updateUniforms
+// purpose  : Write per-frame uniforms into uniform buffer
+// =======================================================================
+void Metal_IndirectLayer::updateUniforms(Metal_Workspace* theWorkspace,
+                                         int theSlot)
+{
+  id<MTLBuffer> aUniformBuffer = myUniformBuffers[theSlot];
+  char* aData = static_cast<char*>([aUniformBuffer contents]);
+
+  const Metal_ShaderManager* aShaderMgr = theWorkspace->ShaderManager();
+  memcpy(aData, &aShaderMgr->LightUniforms(), sizeof(Metal_LightUniforms));
+  memcpy(aData + clipUniformsOffset(), &aShaderMgr->ClipPlaneUniforms(), sizeof(Metal_ClipPlaneUniforms));
+  if (theWorkspace->View() != nullptr)
+  {
+    // shadow map texture itself is inherited from the encoder (see Metal_Workspace::ApplyLightingUniforms())
+    memcpy(aData + shadowUniformsOffset(), &theWorkspace->View()->ShadowUniforms(), sizeof(Metal_ShadowUniforms));
+  }
+
+  // model-view matrices are shared by all draws of the same structure
+  const NCollection_Mat4<float>& aViewMatrix = theWorkspace->ModelMatrix();
+  NCollection_Vector<NCollection_Mat4<float>> aModelViews(myStructs.Size() > 0 ? myStructs.Size() : 1);
+  for (NCollection_Vector<const Metal_Structure*>::Iterator aStructIter(myStructs); aStructIter.More(); aStructIter.Next())
+  {
+    aModelViews.Append(aViewMatrix * aStructIter.Value()->RenderTransformation());
+  }
+
+  Metal_IndirectDrawUniforms aUniforms;
+  memcpy(aUniforms.ProjectionMatrix, theWorkspace->ProjectionMatrix().GetData(), sizeof(aUniforms.ProjectionMatrix));
+  const size_t aDrawsOffset = materialUniformsOffset() + size_t(myNbMaterials) * THE_UNIFORM_ALIGNMENT;
+  for (int aDrawIter = 0; aDrawIter < myDraws.Size(); ++aDrawIter)
+  {
+    const DrawInfo& aDraw = myDraws.Value(aDrawIter);
+    memcpy(aUniforms.ModelViewMatrix, aModelViews.Value(aDraw.TrsfIndex).GetData(), sizeof(aUniforms.ModelViewMatrix));
+    memcpy(aUniforms.Color, aDraw.Color, sizeof(aUniforms.Color));
+    memcpy(aData + aDrawsOffset + size_t(aDrawIter) * THE_UNIFORM_ALIGNMENT, &aUniforms, sizeof(aUniforms));
+  }
+#if !TARGET_OS_IPHONE
+  if (aUniformBuffer.storageMode == MTLStorageModeManaged)
+  {
+    [aUniformBuffer didModifyRange:NSMakeRange(0, aUniformBuffer.length)];
+  }
+#endif
+}
@@ -14,6 +14,7 @@
 #ifndef Metal_LayerList_HeaderFile
 #define Metal_LayerList_HeaderFile
 
+#include <Metal_DrawList.hxx>
 #include <Metal_Layer.hxx>
 #include <Metal_LayerFilter.hxx>
 
@@ -224,6 +225,9 @@ protected:
   //! Collection of references to layers with transparency gathered during rendering pass.
   mutable Metal_LayerStack myTransparentToProcess;
 
+  //! Draw list sorting opaque structures by render state (Metal_Caps::useSortedDrawList).
+  mutable Metal_DrawList myDrawList;
+
 public:
   DEFINE_STANDARD_ALLOC
 };
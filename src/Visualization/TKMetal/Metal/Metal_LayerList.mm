@@ -17,7 +17,9 @@
 
 #include <BVH_LinearBuilder.hxx>
 #include <Graphic3d_CullingTool.hxx>
+#include <Metal_Caps.hxx>
 #include <Metal_Context.hxx>
+#include <Metal_FrameStats.hxx>
 #include <Metal_FrameBuffer.hxx>
 #include <Metal_RenderFilter.hxx>
 #include <Metal_ShaderManager.hxx>
@@ -562,8 +564,18 @@ void Metal_LayerList::renderLayer(const occ::handle<Metal_Workspace>& theWorkspa
     aLayerSettings.ToEnableDepthWrite() && theDefaultSettings.DepthMask;
   aCtx->SetDepthMask(theWorkspace->UseDepthWrite());
 
+  // within opaque pass, draws of plain shaded structures are sorted by render state
+  // and submitted first, the other structures are rendered in priority order
+  const bool toSortDraws = aCtx->Caps()->useSortedDrawList
+                        && (theWorkspace->RenderFilter() & Metal_RenderFilter_OpaqueOnly) != 0;
+  if (toSortDraws)
+  {
+    myDrawList.Clear();
+  }
+
   // render priority list
   const int aViewId = theWorkspace->View()->Identification();
+  const NCollection_Mat4<float> aBaseModelMatrix = theWorkspace->ModelMatrix();
   for (int aPriorityIter = Graphic3d_DisplayPriority_Bottom;
        aPriorityIter <= Graphic3d_DisplayPriority_Topmost;
        ++aPriorityIter)
@@ -574,7 +586,8 @@ void Metal_LayerList::renderLayer(const occ::handle<Metal_Workspace>& theWorkspa
          aStructIter.Next())
     {
       const Metal_Structure* aStruct = aStructIter.Value();
-      if (aStruct->IsCulled() || !aStruct->IsVisible(aViewId))
+      if (aStruct->IsCulled() || !aStruct->IsVisible(aViewId)
+       || (toSortDraws && myDrawList.AddStructure(theWorkspace.get(), aStruct, aBaseModelMatrix)))
       {
         continue;
       }
@@ -583,6 +596,18 @@ void Metal_LayerList::renderLayer(const occ::handle<Metal_Workspace>& theWorkspa
     }
   }
 
+  if (toSortDraws && myDrawList.NbDraws() > 0)
+  {
+    myDrawList.Submit(theWorkspace.get());
+    theWorkspace->SetModelMatrix(aBaseModelMatrix);
+    if (!aCtx->FrameStats().IsNull())
+    {
+      aCtx->FrameStats()->AddStateChanges(myDrawList.NbDraws(),
+                                          myDrawList.UnsortedChanges().Total(),
+                                          myDrawList.SortedChanges().Total());
+    }
+  }
+
   // always restore polygon offset between layers rendering
   theWorkspace->SetDefaultPolygonOffset(anAppliedOffsetParams);
 }
@@ -0,0 +1,110 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef Metal_MeshletBuffer_HeaderFile
+#define Metal_MeshletBuffer_HeaderFile
+
+#include <Metal_Buffer.hxx>
+#include <Graphic3d_Buffer.hxx>
+#include <Graphic3d_IndexBuffer.hxx>
+
+#ifdef __OBJC__
+@protocol MTLRenderCommandEncoder;
+#endif
+
+//! Triangle array split into meshlets - small clusters of up to MaxVertices vertices and MaxTriangles triangles,
+//! rendered by object and mesh shaders (see Metal_Caps::useMeshShaders).
+//! Each meshlet stores bounding sphere and normal cone, so that object shader culls the whole cluster
+//! by view frustum and, when back faces are culled, by facing away from the viewer;
+//! visible meshlets are then expanded by mesh shader reading the same vertex buffers as classic pipeline.
+class Metal_MeshletBuffer : public Metal_Resource
+{
+  DEFINE_STANDARD_RTTIEXT(Metal_MeshletBuffer, Metal_Resource)
+public:
+
+  //! Maximum number of vertices within meshlet.
+  static constexpr int MaxVertices = 64;
+
+  //! Maximum number of triangles within meshlet.
+  static constexpr int MaxTriangles = 124;
+
+  //! Minimal number of triangles for array to be split into meshlets;
+  //! smaller arrays are cheaper to draw by classic pipeline.
+  static constexpr int MinTriangles = 4096;
+
+  //! Number of meshlets culled by one object shader threadgroup.
+  static constexpr int ObjectGroupSize = 32;
+
+  //! Number of threads within mesh shader threadgroup (covers both vertices and triangles of meshlet).
+  static constexpr int MeshGroupSize = 128;
+
+  //! Meshlet descriptor (should match MeshletDesc in Metal_ShaderManager THE_MESHLET_SHADER_SOURCE).
+  struct Meshlet
+  {
+    uint32_t VertexOffset;   //!< first entry within meshlet vertices buffer
+    uint32_t TriangleOffset; //!< first entry within meshlet triangles buffer
+    uint32_t VertexCount;    //!< number of vertices
+    uint32_t TriangleCount;  //!< number of triangles
+    float    Center[3];      //!< bounding sphere center in model space
+    float    Radius;         //!< bounding sphere radius
+    float    ConeAxis[3];    //!< average normal of meshlet triangles
+    float    ConeCutoff;     //!< sine of normal cone spread; 1 disables cone culling
+  };
+
+public:
+
+  //! Empty constructor.
+  Standard_EXPORT Metal_MeshletBuffer();
+
+  //! Destructor.
+  Standard_EXPORT ~Metal_MeshletBuffer() override;
+
+  //! Return TRUE if meshlets have been built.
+  bool IsValid() const { return myNbMeshlets > 0; }
+
+  //! Return number of meshlets.
+  int NbMeshlets() const { return myNbMeshlets; }
+
+  //! Split triangle list into meshlets.
+  //! @param theCtx Metal context
+  //! @param theAttribs vertex attributes with positions (3 floats per vertex)
+  //! @param theIndices triangle list indices, or NULL for non-indexed triangles
+  //! @return FALSE if array cannot be rendered by meshlets
+  Standard_EXPORT bool Init(Metal_Context* theCtx,
+                            const occ::handle<Graphic3d_Buffer>& theAttribs,
+                            const occ::handle<Graphic3d_IndexBuffer>& theIndices);
+
+  //! Release GPU resources.
+  Standard_EXPORT void Release(Metal_Context* theCtx) override;
+
+  //! Return estimated GPU memory usage.
+  Standard_EXPORT size_t EstimatedDataSize() const override;
+
+#ifdef __OBJC__
+  //! Bind meshlet buffers to object and mesh stages and dispatch mesh threadgroups.
+  //! Mesh pipeline (Metal_ShaderManager::GetMeshletProgram()), vertex buffers and uniforms should be already bound.
+  //! @param theEncoder render command encoder
+  //! @param theToCullBackFaces cull meshlets facing away from the viewer
+  Standard_EXPORT void Draw(id<MTLRenderCommandEncoder> theEncoder,
+                            bool theToCullBackFaces) const;
+#endif
+
+protected:
+
+  occ::handle<Metal_Buffer> myMeshlets;  //!< meshlet descriptors
+  occ::handle<Metal_Buffer> myVertices;  //!< global vertex indices of meshlets
+  occ::handle<Metal_Buffer> myTriangles; //!< local vertex indices of meshlet triangles packed into 8-bits triplets
+  int                       myNbMeshlets; //!< number of meshlets
+};
+
+#endif // Metal_MeshletBuffer_HeaderFile
@@ -0,0 +1,326 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#import <Metal/Metal.h>
+
+#include <Metal_MeshletBuffer.hxx>
+#include <Metal_Context.hxx>
+#include <Graphic3d_Vec3.hxx>
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <vector>
+
+IMPLEMENT_STANDARD_RTTIEXT(Metal_MeshletBuffer, Metal_Resource)
+
+namespace
+{
+  //! Parameters of object shader (should match MeshletParams in THE_MESHLET_SHADER_SOURCE).
+  struct Metal_MeshletParams
+  {
+    uint32_t NbMeshlets;
+    uint32_t ToCullBackFaces;
+    uint32_t Padding[2];
+  };
+
+  //! Minimal cosine between average normal and triangle normals for normal cone to be usable;
+  //! wider cones are almost never culled, so that the test is disabled for them.
+  static const float THE_MIN_CONE_DOT = 0.1f;
+
+  //! Compute bounding sphere and normal cone of meshlet.
+  static void computeMeshletBounds(Metal_MeshletBuffer::Meshlet& theMeshlet,
+                                   const std::vector<uint32_t>& theVertices,
+                                   const std::vector<uint32_t>& theTriangles,
+                                   const uint8_t* thePosData,
+                                   size_t thePosStride)
+  {
+    const auto aPos = [&](uint32_t theIndex) -> const Graphic3d_Vec3&
+    {
+      return *reinterpret_cast<const Graphic3d_Vec3*>(thePosData + thePosStride * size_t(theIndex));
+    };
+
+    Graphic3d_Vec3 aMin(FLT_MAX), aMax(-FLT_MAX);
+    for (uint32_t aVertIter = 0; aVertIter < theMeshlet.VertexCount; ++aVertIter)
+    {
+      const Graphic3d_Vec3& aPnt = aPos(theVertices[theMeshlet.VertexOffset + aVertIter]);
+      aMin = aMin.cwiseMin(aPnt);
+      aMax = aMax.cwiseMax(aPnt);
+    }
+    const Graphic3d_Vec3 aCenter = (aMin + aMax) * 0.5f;
+    float aRadiusSq = 0.0f;
+    for (uint32_t aVertIter = 0; aVertIter < theMeshlet.VertexCount; ++aVertIter)
+    {
+      const Graphic3d_Vec3 aDelta = aPos(theVertices[theMeshlet.VertexOffset + aVertIter]) - aCenter;
+      aRadiusSq = std::max(aRadiusSq, aDelta.SquareModulus());
+    }
+
+    std::vector<Graphic3d_Vec3> aNormals;
+    aNormals.reserve(theMeshlet.TriangleCount);
+    Graphic3d_Vec3 anAxis(0.0f);
+    for (uint32_t aTriIter = 0; aTriIter < theMeshlet.TriangleCount; ++aTriIter)
+    {
+      const uint32_t aPacked = theTriangles[theMeshlet.TriangleOffset + aTriIter];
+      const Graphic3d_Vec3& aP0 = aPos(theVertices[theMeshlet.VertexOffset + ( aPacked        & 0xFF)]);
+      const Graphic3d_Vec3& aP1 = aPos(theVertices[theMeshlet.VertexOffset + ((aPacked >> 8)  & 0xFF)]);
+      const Graphic3d_Vec3& aP2 = aPos(theVertices[theMeshlet.VertexOffset + ((aPacked >> 16) & 0xFF)]);
+      Graphic3d_Vec3 aNorm = Graphic3d_Vec3::Cross(aP1 - aP0, aP2 - aP0);
+      const float aLen = aNorm.Modulus();
+      if (aLen <= FLT_MIN)
+      {
+        continue;
+      }
+      aNorm /= aLen;
+      aNormals.push_back(aNorm);
+      anAxis += aNorm;
+    }
+
+    // cone cutoff is sine of the maximum angle between axis and triangle normals,
+    // so that the shader culls meshlet when the view direction lies outside of the complementary cone
+    float aCutoff = 1.0f;
+    const float anAxisLen = anAxis.Modulus();
+    if (anAxisLen > FLT_MIN)
+    {
+      anAxis /= anAxisLen;
+      float aMinDot = 1.0f;
+      for (const Graphic3d_Vec3& aNorm : aNormals)
+      {
+        aMinDot = std::min(aMinDot, anAxis.Dot(aNorm));
+      }
+      if (aMinDot > THE_MIN_CONE_DOT)
+      {
+        aCutoff = std::sqrt(1.0f - aMinDot * aMinDot);
+      }
+    }
+    else
+    {
+      anAxis = Graphic3d_Vec3(0.0f, 0.0f, 1.0f);
+    }
+
+    theMeshlet.Center[0]   = aCenter.x();
+    theMeshlet.Center[1]   = aCenter.y();
+    theMeshlet.Center[2]   = aCenter.z();
+    theMeshlet.Radius      = std::sqrt(aRadiusSq);
+    theMeshlet.ConeAxis[0] = anAxis.x();
+    theMeshlet.ConeAxis[1] = anAxis.y();
+    theMeshlet.ConeAxis[2] = anAxis.z();
+    theMeshlet.ConeCutoff  = aCutoff;
+  }
+}
+
+// =======================================================================
+// function : Metal_MeshletBuffer
+// purpose  : Constructor
+// =======================================================================
+Metal_MeshletBuffer::Metal_MeshletBuffer()
+: myNbMeshlets(0)
+{
+  //
+}
+
+// =======================================================================
+// function : ~Metal_MeshletBuffer
+// purpose  : Destructor
+// =======================================================================
+Metal_MeshletBuffer::~Metal_MeshletBuffer()
+{
+  //
+}
+
+// =======================================================================
+// function : Init
+// purpose  : Split triangle list into meshlets
+// =======================================================================
+bool Metal_MeshletBuffer::Init(Metal_Context* theCtx,
+                               const occ::handle<Graphic3d_Buffer>& theAttribs,
+                               const occ::handle<Graphic3d_IndexBuffer>& theIndices)
+{
+  Release(theCtx);
+  if (theCtx == nullptr
+   || theAttribs.IsNull()
+   || theAttribs->NbElements <= 0)
+  {
+    return false;
+  }
+
+  int aPosAttribIndex = -1;
+  size_t aPosStride = 0;
+  const uint8_t* aPosData = theAttribs->AttributeData(Graphic3d_TOA_POS, aPosAttribIndex, aPosStride);
+  if (aPosData == nullptr
+   || theAttribs->Attribute(aPosAttribIndex).DataType != Graphic3d_TOD_VEC3)
+  {
+    return false;
+  }
+
+  const int aNbIndices = !theIndices.IsNull() ? theIndices->NbElements : theAttribs->NbElements;
+  const int aNbTris = aNbIndices / 3;
+  if (aNbTris <= 0)
+  {
+    return false;
+  }
+
+  // greedy clustering in index order - triangulations produced by meshing algorithms
+  // already have good locality, so that meshlets come out compact enough for culling
+  std::vector<Meshlet>  aMeshlets;
+  std::vector<uint32_t> aVertices;
+  std::vector<uint32_t> aTriangles;
+  aMeshlets.reserve(size_t(aNbTris / MaxTriangles + 1));
+  aVertices.reserve(size_t(aNbIndices / 2));
+  aTriangles.reserve(size_t(aNbTris));
+
+  // local index of the vertex within current meshlet, or 0xFF if vertex is not yet there
+  std::vector<uint8_t> aLocalIndex(size_t(theAttribs->NbElements), 0xFF);
+  Meshlet aMeshlet = {};
+  const auto flushMeshlet = [&]()
+  {
+    if (aMeshlet.TriangleCount == 0)
+    {
+      return;
+    }
+    computeMeshletBounds(aMeshlet, aVertices, aTriangles, aPosData, aPosStride);
+    aMeshlets.push_back(aMeshlet);
+    for (uint32_t aVertIter = 0; aVertIter < aMeshlet.VertexCount; ++aVertIter)
+    {
+      aLocalIndex[aVertices[aMeshlet.VertexOffset + aVertIter]] = 0xFF;
+    }
+    aMeshlet = {};
+    aMeshlet.VertexOffset   = uint32_t(aVertices.size());
+    aMeshlet.TriangleOffset = uint32_t(aTriangles.size());
+  };
+
+  for (int aTriIter = 0; aTriIter < aNbTris; ++aTriIter)
+  {
+    uint32_t aNodes[3];
+    for (int aNodeIter = 0; aNodeIter < 3; ++aNodeIter)
+    {
+      const int anIndex = aTriIter * 3 + aNodeIter;
+      aNodes[aNodeIter] = !theIndices.IsNull() ? uint32_t(theIndices->Index(anIndex)) : uint32_t(anIndex);
+      if (aNodes[aNodeIter] >= uint32_t(theAttribs->NbElements))
+      {
+        return false;
+      }
+    }
+
+    int aNbNewVerts = 0;
+    for (int aNodeIter = 0; aNodeIter < 3; ++aNodeIter)
+    {
+      if (aLocalIndex[aNodes[aNodeIter]] == 0xFF
+       && (aNodeIter < 1 || aNodes[aNodeIter] != aNodes[0])
+       && (aNodeIter < 2 || aNodes[aNodeIter] != aNodes[1]))
+      {
+        ++aNbNewVerts;
+      }
+    }
+    if (aMeshlet.VertexCount + aNbNewVerts > uint32_t(MaxVertices)
+     || aMeshlet.TriangleCount + 1 > uint32_t(MaxTriangles))
+    {
+      flushMeshlet();
+    }
+
+    uint32_t aPacked = 0;
+    for (int aNodeIter = 0; aNodeIter < 3; ++aNodeIter)
+    {
+      uint8_t& aLocal = aLocalIndex[aNodes[aNodeIter]];
+      if (aLocal == 0xFF)
+      {
+        aLocal = uint8_t(aMeshlet.VertexCount++);
+        aVertices.push_back(aNodes[aNodeIter]);
+      }
+      aPacked |= uint32_t(aLocal) << (8 * aNodeIter);
+    }
+    aTriangles.push_back(aPacked);
+    ++aMeshlet.TriangleCount;
+  }
+  flushMeshlet();
+
+  const Metal_StorageMode aMode = theCtx->HasUnifiedMemory() ? Metal_StorageMode_Shared : Metal_StorageMode_Managed;
+  myMeshlets  = new Metal_Buffer();
+  myVertices  = new Metal_Buffer();
+  myTriangles = new Metal_Buffer();
+  if (!myMeshlets ->Create(theCtx, aMeshlets.size()  * sizeof(Meshlet),  aMeshlets.data(),  aMode)
+   || !myVertices ->Create(theCtx, aVertices.size()  * sizeof(uint32_t), aVertices.data(),  aMode)
+   || !myTriangles->Create(theCtx, aTriangles.size() * sizeof(uint32_t), aTriangles.data(), aMode))
+  {
+    theCtx->Messenger()->SendWarning() << "Metal_MeshletBuffer, unable to allocate meshlet buffers";
+    Release(theCtx);
+    return false;
+  }
+
+  myNbMeshlets = int(aMeshlets.size());
+  return true;
+}
+
+// =======================================================================
+// function : Release
+// purpose  : Release GPU resources
+// =======================================================================
+void Metal_MeshletBuffer::Release(Metal_Context* theCtx)
+{
+  for (occ::handle<Metal_Buffer>* aBuffer : {&myMeshlets, &myVertices, &myTriangles})
+  {
+    if (!aBuffer->IsNull())
+    {
+      (*aBuffer)->Release(theCtx);
+      aBuffer->Nullify();
+    }
+  }
+  myNbMeshlets = 0;
+}
+
+// =======================================================================
+// function : EstimatedDataSize
+// purpose  : Return estimated GPU memory usage
+// =======================================================================
+size_t Metal_MeshletBuffer::EstimatedDataSize() const
+{
+  size_t aSize = 0;
+  for (const occ::handle<Metal_Buffer>* aBuffer : {&myMeshlets, &myVertices, &myTriangles})
+  {
+    if (!aBuffer->IsNull())
+    {
+      aSize += (*aBuffer)->EstimatedDataSize();
+    }
+  }
+  return aSize;
+}
+
+// =======================================================================
+// function : Draw
+// purpose  : Dispatch object and mesh threadgroups
+// =======================================================================
+void Metal_MeshletBuffer::Draw(id<MTLRenderCommandEncoder> theEncoder,
+                               bool theToCullBackFaces) const
+{
+  if (!IsValid())
+  {
+    return;
+  }
+
+  if (@available(macOS 13.0, iOS 16.0, *))
+  {
+    Metal_MeshletParams aParams = {};
+    aParams.NbMeshlets      = uint32_t(myNbMeshlets);
+    aParams.ToCullBackFaces = theToCullBackFaces ? 1 : 0;
+
+    [theEncoder setObjectBuffer:myMeshlets->Buffer() offset:myMeshlets->Offset() atIndex:6];
+    [theEncoder setObjectBytes:&aParams length:sizeof(aParams) atIndex:7];
+    [theEncoder setMeshBuffer:myMeshlets->Buffer()  offset:myMeshlets->Offset()  atIndex:6];
+    [theEncoder setMeshBuffer:myVertices->Buffer()  offset:myVertices->Offset()  atIndex:8];
+    [theEncoder setMeshBuffer:myTriangles->Buffer() offset:myTriangles->Offset() atIndex:9];
+
+    const NSUInteger aNbGroups = (NSUInteger(myNbMeshlets) + ObjectGroupSize - 1) / ObjectGroupSize;
+    [theEncoder drawMeshThreadgroups:MTLSizeMake(aNbGroups, 1, 1)
+         threadsPerObjectThreadgroup:MTLSizeMake(ObjectGroupSize, 1, 1)
+           threadsPerMeshThreadgroup:MTLSizeMake(MeshGroupSize, 1, 1)];
+  }
+}
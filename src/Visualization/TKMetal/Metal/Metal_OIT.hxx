@@ -21,6 +21,8 @@
 @protocol MTLTexture;
 @protocol MTLRenderPipelineState;
 @protocol MTLDepthStencilState;
+@protocol MTLRenderCommandEncoder;
+@class MTLRenderPassDescriptor;
 #endif
 
 class Metal_Context;
@@ -31,7 +33,8 @@ enum Metal_OITMethod
 {
   Metal_OITMethod_None,           //!< No OIT, standard alpha blending
   Metal_OITMethod_WeightedBlended, //!< Weighted blended OIT (fast, single pass)
-  Metal_OITMethod_DepthPeeling     //!< Dual depth peeling (accurate, multi-pass)
+  Metal_OITMethod_DepthPeeling,    //!< Dual depth peeling (accurate, multi-pass)
+  Metal_OITMethod_TileKBuffer      //!< K-buffer sorted in tile memory (accurate, single pass, Apple GPUs only)
 };
 
 //! Order-Independent Transparency (OIT) resource manager for Metal.
@@ -46,6 +49,16 @@ enum Metal_OITMethod
 //! - Multi-pass, exact ordering
 //! - Uses ping-pong framebuffers with depth testing
 //! - Higher quality but slower (N passes for N layers)
+//!
+//! Tile K-buffer:
+//! - Single pass, exact ordering of up to TileKBufferLayers nearest fragments per pixel,
+//!   farther fragments are blended under the farthest kept one
+//! - Fragments are inserted into sorted per-pixel list kept in explicit imageblock
+//!   (tile memory, ordered by raster order group), and resolved into color attachment by the end of the same pass
+//! - No extra device memory render targets; requires tile shaders (Metal_Context::HasTileShaders()) and no MSAA
+//! - Transparent fragment functions should include TileKBufferShaderSource(),
+//!   take and return OITTileImageblock [[imageblock_data]] and call oitTileInsert() instead of writing color;
+//!   the pass is bracketed by EncodeTileClear() and EncodeTileResolve()
 class Metal_OIT : public Metal_Resource
 {
   DEFINE_STANDARD_RTTIEXT(Metal_OIT, Metal_Resource)
@@ -77,6 +90,13 @@ public:
   //! Higher values give more weight to depth in coverage calculation.
   void SetDepthFactor(float theFactor) { myDepthFactor = theFactor < 0.0f ? 0.0f : (theFactor > 1.0f ? 1.0f : theFactor); }
 
+  //! Number of fragments per pixel sorted by tile K-buffer (OIT_TILE_LAYERS in shader).
+  static const int TileKBufferLayers = 4;
+
+  //! Return MSL declarations of tile K-buffer imageblock (OITTileImageblock) and insertion function
+  //! oitTileInsert(thread OITTileImageblock&, half4 thePremultColor, float theDepth), to be included by transparent fragment functions.
+  Standard_EXPORT static const char* TileKBufferShaderSource();
+
   //! Return number of depth peeling layers.
   int NbDepthPeelingLayers() const { return myNbPeelingLayers; }
 
@@ -153,6 +173,16 @@ public:
 
   //! Return blended back color texture (depth peeling).
   id<MTLTexture> BlendBackTexture() const { return myBlendBackTexture; }
+
+  //! Set tile size and imageblock sample length of the render pass drawing transparent objects (tile K-buffer).
+  Standard_EXPORT void SetupTileRenderPass(MTLRenderPassDescriptor* thePassDesc) const;
+
+  //! Reset tile K-buffer of each tile; should be encoded before the first transparent draw within the pass.
+  Standard_EXPORT void EncodeTileClear(id<MTLRenderCommandEncoder> theEncoder) const;
+
+  //! Composite sorted fragments of tile K-buffer over the color attachment;
+  //! should be encoded after the last transparent draw within the same pass.
+  Standard_EXPORT void EncodeTileResolve(id<MTLRenderCommandEncoder> theEncoder) const;
 #endif
 
 protected:
@@ -169,6 +199,9 @@ protected:
   //! Create compositing pipeline for depth peeling.
   Standard_EXPORT bool createPeelingCompositePipeline(Metal_Context* theCtx);
 
+  //! Initialize tile K-buffer pipelines.
+  Standard_EXPORT bool initTileKBuffer(Metal_Context* theCtx);
+
   //! Perform weighted blended composition.
   Standard_EXPORT void compositeWeightedBlended(Metal_Context* theCtx,
                                                  id<MTLTexture> theTargetTexture);
@@ -192,6 +225,11 @@ protected:
   id<MTLTexture>             myBlendBackTexture;    //!< Accumulated back color
   id<MTLRenderPipelineState> myPeelingBlendPipeline; //!< Peeling blend pipeline
   id<MTLRenderPipelineState> myPeelingFlushPipeline; //!< Peeling flush pipeline
+
+  // Tile K-buffer pipelines
+  id<MTLRenderPipelineState> myTileClearPipeline;   //!< Tile kernel resetting imageblock
+  id<MTLRenderPipelineState> myTileResolvePipeline; //!< Full-screen resolve of imageblock into color attachment
+  id<MTLDepthStencilState>   myTileResolveDepthState; //!< Depth state of resolve (no depth test)
 #else
   void*                      myAccumTexture;
   void*                      myWeightTexture;
@@ -202,6 +240,9 @@ protected:
   void*                      myBlendBackTexture;
   void*                      myPeelingBlendPipeline;
   void*                      myPeelingFlushPipeline;
+  void*                      myTileClearPipeline;
+  void*                      myTileResolvePipeline;
+  void*                      myTileResolveDepthState;
 #endif
 
   Metal_OITMethod myMethod;             //!< Current OIT method
@@ -214,6 +255,7 @@ protected:
   int             myPeelingReadIndex;   //!< Ping-pong read index
   bool            myIsInitialized;      //!< Initialization flag
   size_t          myEstimatedSize;      //!< Estimated GPU memory
+  size_t          myImageblockSampleLength; //!< Imageblock size per pixel of tile K-buffer
 };
 
 #endif // Metal_OIT_HeaderFile
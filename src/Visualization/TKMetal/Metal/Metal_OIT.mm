@@ -167,6 +167,97 @@ fragment float4 peelingFlushFragment(
   return float4(finalColor, finalAlpha);
 }
 )";
+
+  //! Shader declarations of tile K-buffer, shared with transparent fragment functions
+  static const char* THE_TILE_KBUFFER_DECLARATIONS = R"(
+#include <metal_stdlib>
+using namespace metal;
+
+#define OIT_TILE_LAYERS 4
+
+// Per-pixel list of nearest fragments sorted front to back, kept in tile memory
+struct OITTileImageblock {
+  rgba8unorm<half4> Colors [[raster_order_group(0)]] [OIT_TILE_LAYERS]; // premultiplied colors
+  float             Depths [[raster_order_group(0)]] [OIT_TILE_LAYERS];
+};
+
+// Insert fragment into sorted list; fragments behind the farthest layer are blended under it
+inline void oitTileInsert(thread OITTileImageblock& theBlock, half4 theColor, float theDepth)
+{
+  if (theColor.a <= 0.0h) return;
+  for (short aLayer = 0; aLayer < OIT_TILE_LAYERS; ++aLayer) {
+    const float aLayerDepth = theBlock.Depths[aLayer];
+    if (theDepth < aLayerDepth) {
+      const half4 aLayerColor = theBlock.Colors[aLayer];
+      theBlock.Colors[aLayer] = theColor;
+      theBlock.Depths[aLayer] = theDepth;
+      theColor = aLayerColor;
+      theDepth = aLayerDepth;
+    }
+  }
+  if (theColor.a > 0.0h) {
+    const half4 aLast = theBlock.Colors[OIT_TILE_LAYERS - 1];
+    theBlock.Colors[OIT_TILE_LAYERS - 1] = aLast + (1.0h - aLast.a) * theColor;
+  }
+}
+)";
+
+  //! Shader source of tile K-buffer clear and resolve
+  static const char* THE_TILE_KBUFFER_SHADER = R"(
+kernel void oitTileClear(imageblock<OITTileImageblock, imageblock_layout_explicit> theBlock,
+                         ushort2 theThreadId [[thread_position_in_threadgroup]])
+{
+  threadgroup_imageblock OITTileImageblock* aData = theBlock.data(theThreadId);
+  for (short aLayer = 0; aLayer < OIT_TILE_LAYERS; ++aLayer) {
+    aData->Colors[aLayer] = half4(0.0h);
+    aData->Depths[aLayer] = INFINITY;
+  }
+}
+
+struct OITTileVertexOut {
+  float4 position [[position]];
+};
+
+vertex OITTileVertexOut oitTileResolveVertex(uint vertexID [[vertex_id]])
+{
+  float2 positions[3] = {
+    float2(-1.0, -1.0),
+    float2( 3.0, -1.0),
+    float2(-1.0,  3.0)
+  };
+
+  OITTileVertexOut out;
+  out.position = float4(positions[vertexID], 0.0, 1.0);
+  return out;
+}
+
+struct OITTileResolveOut {
+  half4 color [[color(0)]];
+};
+
+fragment OITTileResolveOut oitTileResolveFragment(
+  OITTileVertexOut in [[stage_in]],
+  OITTileImageblock theBlock [[imageblock_data]])
+{
+  // Composite front to back, result is blended over opaque color as premultiplied
+  half4 aResult = half4(0.0h);
+  for (short aLayer = 0; aLayer < OIT_TILE_LAYERS; ++aLayer) {
+    const half4 aColor = theBlock.Colors[aLayer];
+    aResult += (1.0h - aResult.a) * aColor;
+  }
+  if (aResult.a <= 0.0h) {
+    discard_fragment();
+  }
+
+  OITTileResolveOut out;
+  out.color = aResult;
+  return out;
+}
+)";
+
+  //! Tile size of the pass using tile K-buffer; imageblock of the whole tile should fit into tile memory.
+  static const NSUInteger THE_TILE_WIDTH  = 32;
+  static const NSUInteger THE_TILE_HEIGHT = 16;
 }
 
 //=================================================================================================
@@ -178,6 +269,9 @@ Metal_OIT::Metal_OIT()
   myBlendBackTexture(nil),
   myPeelingBlendPipeline(nil),
   myPeelingFlushPipeline(nil),
+  myTileClearPipeline(nil),
+  myTileResolvePipeline(nil),
+  myTileResolveDepthState(nil),
   myMethod(Metal_OITMethod_None),
   myWidth(0),
   myHeight(0),
@@ -187,7 +281,8 @@ Metal_OIT::Metal_OIT()
   myCurrentPeelingPass(0),
   myPeelingReadIndex(0),
   myIsInitialized(false),
-  myEstimatedSize(0)
+  myEstimatedSize(0),
+  myImageblockSampleLength(0)
 {
   for (int i = 0; i < 2; ++i)
   {
@@ -214,6 +309,10 @@ void Metal_OIT::Release(Metal_Context* /*theCtx*/)
   myBlendBackTexture = nil;
   myPeelingBlendPipeline = nil;
   myPeelingFlushPipeline = nil;
+  myTileClearPipeline = nil;
+  myTileResolvePipeline = nil;
+  myTileResolveDepthState = nil;
+  myImageblockSampleLength = 0;
 
   for (int i = 0; i < 2; ++i)
   {
@@ -272,6 +371,10 @@ bool Metal_OIT::Init(Metal_Context* theCtx,
   {
     aResult = initDepthPeeling(theCtx);
   }
+  else if (theMethod == Metal_OITMethod_TileKBuffer)
+  {
+    aResult = initTileKBuffer(theCtx);
+  }
 
   myIsInitialized = aResult;
   return aResult;
@@ -287,6 +390,13 @@ bool Metal_OIT::Resize(Metal_Context* theCtx,
   {
     return true;
   }
+  if (myMethod == Metal_OITMethod_TileKBuffer && myIsInitialized)
+  {
+    // tile memory does not depend on frame size
+    myWidth = theWidth;
+    myHeight = theHeight;
+    return true;
+  }
 
   return Init(theCtx, myMethod, theWidth, theHeight, mySampleCount);
 }
@@ -438,14 +548,142 @@ bool Metal_OIT::initDepthPeeling(Metal_Context* theCtx)
 
 //=================================================================================================
 
+const char* Metal_OIT::TileKBufferShaderSource()
+{
+  return THE_TILE_KBUFFER_DECLARATIONS;
+}
+
+//=================================================================================================
+
+bool Metal_OIT::initTileKBuffer(Metal_Context* theCtx)
+{
+  if (!theCtx->HasTileShaders())
+  {
+    NSLog(@"Metal_OIT: tile K-buffer requires tile shaders and imageblocks (Apple4 GPU family)");
+    return false;
+  }
+  if (mySampleCount > 1)
+  {
+    NSLog(@"Metal_OIT: tile K-buffer does not support MSAA");
+    return false;
+  }
+
+  id<MTLDevice> aDevice = theCtx->Device();
+  NSError* anError = nil;
+  NSString* aSource = [NSString stringWithFormat:@"%s%s", THE_TILE_KBUFFER_DECLARATIONS, THE_TILE_KBUFFER_SHADER];
+  id<MTLLibrary> aLibrary = theCtx->LoadShaderLibrary("Metal_OIT_THE_TILE_KBUFFER_SHADER", aSource, nil, &anError);
+  if (aLibrary == nil)
+  {
+    NSLog(@"Metal_OIT: Failed to compile tile K-buffer shader: %@", anError);
+    return false;
+  }
+
+  // Tile kernel resetting imageblock of each tile
+  MTLTileRenderPipelineDescriptor* aTileDesc = [[MTLTileRenderPipelineDescriptor alloc] init];
+  aTileDesc.label = @"OIT_TileClear";
+  aTileDesc.tileFunction = [aLibrary newFunctionWithName:@"oitTileClear"];
+  aTileDesc.colorAttachments[0].pixelFormat = MTLPixelFormatBGRA8Unorm;
+  aTileDesc.threadgroupSizeMatchesTileSize = YES;
+  myTileClearPipeline = [aDevice newRenderPipelineStateWithTileDescriptor:aTileDesc
+                                                                  options:MTLPipelineOptionNone
+                                                               reflection:nil
+                                                                    error:&anError];
+  if (myTileClearPipeline == nil)
+  {
+    NSLog(@"Metal_OIT: Failed to create tile K-buffer clear pipeline: %@", anError);
+    return false;
+  }
+  myImageblockSampleLength = myTileClearPipeline.imageblockSampleLength;
+
+  // Full-screen resolve within the same pass
+  MTLRenderPipelineDescriptor* aPipelineDesc = [[MTLRenderPipelineDescriptor alloc] init];
+  aPipelineDesc.label = @"OIT_TileResolve";
+  aPipelineDesc.vertexFunction = [aLibrary newFunctionWithName:@"oitTileResolveVertex"];
+  aPipelineDesc.fragmentFunction = [aLibrary newFunctionWithName:@"oitTileResolveFragment"];
+  aPipelineDesc.colorAttachments[0].pixelFormat = MTLPixelFormatBGRA8Unorm;
+  aPipelineDesc.depthAttachmentPixelFormat = MTLPixelFormatDepth32Float;
+
+  // Blend: src * ONE + dst * ONE_MINUS_SRC_ALPHA (premultiplied)
+  aPipelineDesc.colorAttachments[0].blendingEnabled = YES;
+  aPipelineDesc.colorAttachments[0].sourceRGBBlendFactor = MTLBlendFactorOne;
+  aPipelineDesc.colorAttachments[0].destinationRGBBlendFactor = MTLBlendFactorOneMinusSourceAlpha;
+  aPipelineDesc.colorAttachments[0].rgbBlendOperation = MTLBlendOperationAdd;
+  aPipelineDesc.colorAttachments[0].sourceAlphaBlendFactor = MTLBlendFactorOne;
+  aPipelineDesc.colorAttachments[0].destinationAlphaBlendFactor = MTLBlendFactorOneMinusSourceAlpha;
+  aPipelineDesc.colorAttachments[0].alphaBlendOperation = MTLBlendOperationAdd;
+
+  myTileResolvePipeline = [aDevice newRenderPipelineStateWithDescriptor:aPipelineDesc
+                                                                  error:&anError];
+  if (myTileResolvePipeline == nil)
+  {
+    NSLog(@"Metal_OIT: Failed to create tile K-buffer resolve pipeline: %@", anError);
+    return false;
+  }
+
+  MTLDepthStencilDescriptor* aDepthDesc = [[MTLDepthStencilDescriptor alloc] init];
+  aDepthDesc.depthCompareFunction = MTLCompareFunctionAlways;
+  aDepthDesc.depthWriteEnabled = NO;
+  myTileResolveDepthState = [aDevice newDepthStencilStateWithDescriptor:aDepthDesc];
+
+  // K-buffer lives in tile memory only
+  myEstimatedSize = 0;
+  return myTileResolveDepthState != nil;
+}
+
+//=================================================================================================
+
+void Metal_OIT::SetupTileRenderPass(MTLRenderPassDescriptor* thePassDesc) const
+{
+  if (!myIsInitialized || myMethod != Metal_OITMethod_TileKBuffer)
+  {
+    return;
+  }
+
+  thePassDesc.tileWidth  = THE_TILE_WIDTH;
+  thePassDesc.tileHeight = THE_TILE_HEIGHT;
+  thePassDesc.imageblockSampleLength = myImageblockSampleLength;
+}
+
+//=================================================================================================
+
+void Metal_OIT::EncodeTileClear(id<MTLRenderCommandEncoder> theEncoder) const
+{
+  if (!myIsInitialized || myMethod != Metal_OITMethod_TileKBuffer)
+  {
+    return;
+  }
+
+  [theEncoder setRenderPipelineState:myTileClearPipeline];
+  [theEncoder dispatchThreadsPerTile:MTLSizeMake(THE_TILE_WIDTH, THE_TILE_HEIGHT, 1)];
+}
+
+//=================================================================================================
+
+void Metal_OIT::EncodeTileResolve(id<MTLRenderCommandEncoder> theEncoder) const
+{
+  if (!myIsInitialized || myMethod != Metal_OITMethod_TileKBuffer)
+  {
+    return;
+  }
+
+  [theEncoder setRenderPipelineState:myTileResolvePipeline];
+  [theEncoder setDepthStencilState:myTileResolveDepthState];
+  [theEncoder setCullMode:MTLCullModeNone];
+
+  // Draw full-screen triangle
+  [theEncoder drawPrimitives:MTLPrimitiveTypeTriangle vertexStart:0 vertexCount:3];
+}
+
+//=================================================================================================
+
 bool Metal_OIT::createWeightedCompositePipeline(Metal_Context* theCtx)
 {
   id<MTLDevice> aDevice = theCtx->Device();
 
   NSError* anError = nil;
-  id<MTLLibrary> aLibrary = [aDevice newLibraryWithSource:[NSString stringWithUTF8String:THE_WEIGHTED_COMPOSITE_SHADER]
-                                                  options:nil
-                                                    error:&anError];
+  id<MTLLibrary> aLibrary = theCtx->LoadShaderLibrary("Metal_OIT_THE_WEIGHTED_COMPOSITE_SHADER",
+                                                      [NSString stringWithUTF8String:THE_WEIGHTED_COMPOSITE_SHADER],
+                                                      nil, &anError);
   if (aLibrary == nil)
   {
     NSLog(@"Metal_OIT: Failed to compile weighted composite shader: %@", anError);
@@ -490,9 +728,9 @@ bool Metal_OIT::createPeelingCompositePipeline(Metal_Context* theCtx)
 
   // Blend pipeline
   {
-    id<MTLLibrary> aLibrary = [aDevice newLibraryWithSource:[NSString stringWithUTF8String:THE_PEELING_BLEND_SHADER]
-                                                    options:nil
-                                                      error:&anError];
+    id<MTLLibrary> aLibrary = theCtx->LoadShaderLibrary("Metal_OIT_THE_PEELING_BLEND_SHADER",
+                                                        [NSString stringWithUTF8String:THE_PEELING_BLEND_SHADER],
+                                                        nil, &anError);
     if (aLibrary == nil)
     {
       NSLog(@"Metal_OIT: Failed to compile peeling blend shader: %@", anError);
@@ -528,9 +766,9 @@ bool Metal_OIT::createPeelingCompositePipeline(Metal_Context* theCtx)
 
   // Flush pipeline
   {
-    id<MTLLibrary> aLibrary = [aDevice newLibraryWithSource:[NSString stringWithUTF8String:THE_PEELING_FLUSH_SHADER]
-                                                    options:nil
-                                                      error:&anError];
+    id<MTLLibrary> aLibrary = theCtx->LoadShaderLibrary("Metal_OIT_THE_PEELING_FLUSH_SHADER",
+                                                        [NSString stringWithUTF8String:THE_PEELING_FLUSH_SHADER],
+                                                        nil, &anError);
     if (aLibrary == nil)
     {
       NSLog(@"Metal_OIT: Failed to compile peeling flush shader: %@", anError);
@@ -629,6 +867,10 @@ void Metal_OIT::compositeWeightedBlended(Metal_Context* theCtx,
   aPassDesc.colorAttachments[0].texture = theTargetTexture;
   aPassDesc.colorAttachments[0].loadAction = MTLLoadActionLoad;
   aPassDesc.colorAttachments[0].storeAction = MTLStoreActionStore;
+  if (!theCtx->GpuTimer().IsNull())
+  {
+    theCtx->GpuTimer()->AttachRenderPass(aCommandBuffer, aPassDesc, Graphic3d_FrameStatsTimer_GpuOit, true);
+  }
 
   id<MTLRenderCommandEncoder> anEncoder = [aCommandBuffer renderCommandEncoderWithDescriptor:aPassDesc];
   anEncoder.label = @"OIT_WeightedComposite";
@@ -656,6 +898,10 @@ void Metal_OIT::compositeDepthPeeling(Metal_Context* theCtx,
   aPassDesc.colorAttachments[0].texture = theTargetTexture;
   aPassDesc.colorAttachments[0].loadAction = MTLLoadActionLoad;
   aPassDesc.colorAttachments[0].storeAction = MTLStoreActionStore;
+  if (!theCtx->GpuTimer().IsNull())
+  {
+    theCtx->GpuTimer()->AttachRenderPass(aCommandBuffer, aPassDesc, Graphic3d_FrameStatsTimer_GpuDepthPeeling, true);
+  }
 
   id<MTLRenderCommandEncoder> anEncoder = [aCommandBuffer renderCommandEncoderWithDescriptor:aPassDesc];
   anEncoder.label = @"OIT_PeelingFlush";
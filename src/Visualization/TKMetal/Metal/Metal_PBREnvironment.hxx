@@ -20,6 +20,8 @@
 
 #ifdef __OBJC__
 @protocol MTLTexture;
+@protocol MTLCommandBuffer;
+@protocol MTLComputeCommandEncoder;
 @protocol MTLComputePipelineState;
 @protocol MTLRenderPipelineState;
 #endif
@@ -83,6 +85,45 @@ public:
                             size_t theDiffMapNbSamples = 1024,
                             size_t theSpecMapNbSamples = 256);
 
+  //! Starts incremental (non-blocking) baking of IBL maps from environment cubemap.
+  //! The work is encoded by following BakeStep() calls - one specular mip level per step,
+  //! with the diffuse map in the last step - so that baking never stalls the calling thread.
+  //! Current map content stays untouched until the first step is encoded.
+  //! @param theCtx Metal context
+  //! @param theEnvMap source environment cubemap texture (retained until baking is finished)
+  //! @param theZIsInverted whether Z axis is inverted
+  //! @param theIsTopDown whether texture is top-down
+  //! @param theDiffMapNbSamples samples for diffuse map Monte-Carlo integration
+  //! @param theSpecMapNbSamples samples for specular map Monte-Carlo integration
+  Standard_EXPORT void StartBake(const occ::handle<Metal_Context>& theCtx,
+#ifdef __OBJC__
+                                 id<MTLTexture> theEnvMap,
+#else
+                                 void* theEnvMap,
+#endif
+                                 bool theZIsInverted = false,
+                                 bool theIsTopDown = true,
+                                 size_t theDiffMapNbSamples = 1024,
+                                 size_t theSpecMapNbSamples = 256);
+
+  //! Encodes next portion of baking work started by StartBake() into specified command buffer.
+  //! Does nothing if there is no pending work.
+  //! @return TRUE if all baking work has been encoded
+  Standard_EXPORT bool BakeStep(const occ::handle<Metal_Context>& theCtx,
+#ifdef __OBJC__
+                                id<MTLCommandBuffer> theCmdBuffer);
+#else
+                                void* theCmdBuffer);
+#endif
+
+  //! Returns TRUE if baking has been started and is not yet completed by GPU.
+  Standard_EXPORT bool IsBaking() const;
+
+  //! Returns TRUE if there is no baking work pending - all steps have been encoded
+  //! and the command buffer holding the last one has been completed by GPU.
+  //! This is a non-blocking query.
+  Standard_EXPORT bool IsBakeCompleted();
+
   //! Clears IBL maps to a uniform color.
   Standard_EXPORT void Clear(const occ::handle<Metal_Context>& theCtx,
                              const NCollection_Vec3<float>& theColor = NCollection_Vec3<float>(1.0f));
@@ -129,27 +170,23 @@ protected:
   //! Creates compute pipelines for IBL baking.
   Standard_EXPORT bool initPipelines(const occ::handle<Metal_Context>& theCtx);
 
-  //! Generates specular IBL map with GGX importance sampling.
-  Standard_EXPORT bool bakeSpecularMap(const occ::handle<Metal_Context>& theCtx,
 #ifdef __OBJC__
+  //! Encodes generation of one mip level (all 6 faces) of specular IBL map
+  //! with GGX importance sampling.
+  Standard_EXPORT bool bakeSpecularMap(id<MTLComputeCommandEncoder> theEncoder,
                                        id<MTLTexture> theEnvMap,
-#else
-                                       void* theEnvMap,
-#endif
+                                       unsigned int theLevel,
                                        bool theZIsInverted,
                                        bool theIsTopDown,
                                        size_t theNbSamples);
 
-  //! Generates diffuse/irradiance IBL map.
-  Standard_EXPORT bool bakeDiffuseMap(const occ::handle<Metal_Context>& theCtx,
-#ifdef __OBJC__
+  //! Encodes generation of diffuse/irradiance IBL map.
+  Standard_EXPORT bool bakeDiffuseMap(id<MTLComputeCommandEncoder> theEncoder,
                                       id<MTLTexture> theEnvMap,
-#else
-                                      void* theEnvMap,
-#endif
                                       bool theZIsInverted,
                                       bool theIsTopDown,
                                       size_t theNbSamples);
+#endif
 
 private:
   unsigned int myPow2Size;            //!< Size as power of 2
@@ -157,18 +194,28 @@ private:
   bool myIsNeededToBeBound;           //!< Whether binding is needed
   bool myIsComplete;                  //!< Whether initialization succeeded
 
+  unsigned int myBakeStep;            //!< next step of incremental baking (mip level, or levels number for diffuse map)
+  bool myBakeZIsInverted;             //!< Z inversion flag of pending baking
+  bool myBakeIsTopDown;               //!< top-down flag of pending baking
+  size_t myBakeDiffNbSamples;         //!< diffuse samples of pending baking
+  size_t myBakeSpecNbSamples;         //!< specular samples of pending baking
+
 #ifdef __OBJC__
   id<MTLTexture> mySpecularMap;           //!< Pre-filtered specular environment cubemap
   id<MTLTexture> myDiffuseMap;            //!< Diffuse irradiance cubemap
   id<MTLTexture> myDiffuseSHTexture;      //!< Spherical harmonics coefficients texture
   id<MTLComputePipelineState> mySpecularBakePipeline;  //!< Compute pipeline for specular baking
   id<MTLComputePipelineState> myDiffuseBakePipeline;   //!< Compute pipeline for diffuse baking
+  id<MTLTexture> myBakeEnvMap;            //!< source environment of pending baking
+  id<MTLCommandBuffer> myBakeCmdBuffer;   //!< command buffer holding the last baking step
 #else
   void* mySpecularMap;
   void* myDiffuseMap;
   void* myDiffuseSHTexture;
   void* mySpecularBakePipeline;
   void* myDiffuseBakePipeline;
+  void* myBakeEnvMap;
+  void* myBakeCmdBuffer;
 #endif
 };
 
@@ -272,11 +272,18 @@ Metal_PBREnvironment::Metal_PBREnvironment(const occ::handle<Metal_Context>& the
   mySpecMapLevelsNumber(std::max(2u, std::min(theSpecMapLevelsNum, std::max(1u, thePow2Size) + 1))),
   myIsNeededToBeBound(true),
   myIsComplete(false),
+  myBakeStep(0),
+  myBakeZIsInverted(false),
+  myBakeIsTopDown(true),
+  myBakeDiffNbSamples(0),
+  myBakeSpecNbSamples(0),
   mySpecularMap(nil),
   myDiffuseMap(nil),
   myDiffuseSHTexture(nil),
   mySpecularBakePipeline(nil),
-  myDiffuseBakePipeline(nil)
+  myDiffuseBakePipeline(nil),
+  myBakeEnvMap(nil),
+  myBakeCmdBuffer(nil)
 {
   myIsComplete = initTextures(theCtx) && initPipelines(theCtx);
   if (myIsComplete)
@@ -302,6 +309,8 @@ void Metal_PBREnvironment::Release(Metal_Context* theCtx)
   myDiffuseSHTexture = nil;
   mySpecularBakePipeline = nil;
   myDiffuseBakePipeline = nil;
+  myBakeEnvMap = nil;
+  myBakeCmdBuffer = nil;
 }
 
 //=================================================================================================
@@ -369,7 +378,9 @@ bool Metal_PBREnvironment::initPipelines(const occ::handle<Metal_Context>& theCt
   id<MTLDevice> aDevice = theCtx->Device();
 
   NSError* anError = nil;
-  id<MTLLibrary> aLibrary = [aDevice newLibraryWithSource:IBL_COMPUTE_SHADER options:nil error:&anError];
+  id<MTLLibrary> aLibrary = theCtx->LoadShaderLibrary("Metal_PBREnvironment_IBL_COMPUTE_SHADER",
+                                                      IBL_COMPUTE_SHADER,
+                                                      nil, &anError);
   if (aLibrary == nil)
   {
     Message::SendFail() << "Metal_PBREnvironment: Failed to compile IBL shaders: "
@@ -427,10 +438,17 @@ void Metal_PBREnvironment::Bake(const occ::handle<Metal_Context>& theCtx,
   OSD_Timer aTimer;
   aTimer.Start();
 
-  myIsNeededToBeBound = true;
-
-  bakeSpecularMap(theCtx, theEnvMap, theZIsInverted, theIsTopDown, theSpecMapNbSamples);
-  bakeDiffuseMap(theCtx, theEnvMap, theZIsInverted, theIsTopDown, theDiffMapNbSamples);
+  // encode all steps into a single command buffer and wait only once
+  StartBake(theCtx, theEnvMap, theZIsInverted, theIsTopDown, theDiffMapNbSamples, theSpecMapNbSamples);
+  id<MTLCommandBuffer> aCommandBuffer = [theCtx->CommandQueue() commandBuffer];
+  aCommandBuffer.label = @"PBR_Bake";
+  while (!BakeStep(theCtx, aCommandBuffer))
+  {
+    //
+  }
+  [aCommandBuffer commit];
+  [aCommandBuffer waitUntilCompleted];
+  myBakeCmdBuffer = nil;
 
   aTimer.Stop();
   Message::SendTrace() << "Metal_PBREnvironment: IBL " << Size() << "x" << Size()
@@ -439,21 +457,113 @@ void Metal_PBREnvironment::Bake(const occ::handle<Metal_Context>& theCtx,
 
 //=================================================================================================
 
-bool Metal_PBREnvironment::bakeSpecularMap(const occ::handle<Metal_Context>& theCtx,
+void Metal_PBREnvironment::StartBake(const occ::handle<Metal_Context>& theCtx,
+                                     id<MTLTexture> theEnvMap,
+                                     bool theZIsInverted,
+                                     bool theIsTopDown,
+                                     size_t theDiffMapNbSamples,
+                                     size_t theSpecMapNbSamples)
+{
+  myBakeEnvMap = nil;
+  myBakeCmdBuffer = nil;
+  if (theEnvMap == nil || theCtx.IsNull())
+  {
+    return;
+  }
+
+  myBakeEnvMap = theEnvMap;
+  myBakeStep = 0;
+  myBakeZIsInverted = theZIsInverted;
+  myBakeIsTopDown = theIsTopDown;
+  myBakeDiffNbSamples = theDiffMapNbSamples;
+  myBakeSpecNbSamples = theSpecMapNbSamples;
+}
+
+//=================================================================================================
+
+bool Metal_PBREnvironment::BakeStep(const occ::handle<Metal_Context>& theCtx,
+                                    id<MTLCommandBuffer> theCmdBuffer)
+{
+  (void)theCtx;
+  if (myBakeEnvMap == nil)
+  {
+    return true;
+  }
+  if (theCmdBuffer == nil)
+  {
+    return false;
+  }
+
+  myIsNeededToBeBound = true;
+
+  id<MTLComputeCommandEncoder> aEncoder = [theCmdBuffer computeCommandEncoder];
+  aEncoder.label = @"PBR_BakeStep";
+  if (myBakeStep < mySpecMapLevelsNumber)
+  {
+    bakeSpecularMap(aEncoder, myBakeEnvMap, myBakeStep, myBakeZIsInverted, myBakeIsTopDown, myBakeSpecNbSamples);
+  }
+  else
+  {
+    bakeDiffuseMap(aEncoder, myBakeEnvMap, myBakeZIsInverted, myBakeIsTopDown, myBakeDiffNbSamples);
+  }
+  [aEncoder endEncoding];
+
+  if (++myBakeStep <= mySpecMapLevelsNumber)
+  {
+    return false;
+  }
+
+  // the last step has been encoded - keep its command buffer for completion polling
+  myBakeEnvMap = nil;
+  myBakeCmdBuffer = theCmdBuffer;
+  return true;
+}
+
+//=================================================================================================
+
+bool Metal_PBREnvironment::IsBaking() const
+{
+  return myBakeEnvMap != nil || myBakeCmdBuffer != nil;
+}
+
+//=================================================================================================
+
+bool Metal_PBREnvironment::IsBakeCompleted()
+{
+  if (myBakeEnvMap != nil)
+  {
+    return false;
+  }
+  if (myBakeCmdBuffer != nil)
+  {
+    const MTLCommandBufferStatus aStatus = [myBakeCmdBuffer status];
+    if (aStatus != MTLCommandBufferStatusCompleted
+     && aStatus != MTLCommandBufferStatusError)
+    {
+      return false;
+    }
+    myBakeCmdBuffer = nil;
+  }
+  return true;
+}
+
+//=================================================================================================
+
+bool Metal_PBREnvironment::bakeSpecularMap(id<MTLComputeCommandEncoder> theEncoder,
                                            id<MTLTexture> theEnvMap,
+                                           unsigned int theLevel,
                                            bool theZIsInverted,
                                            bool theIsTopDown,
                                            size_t theNbSamples)
 {
-  if (mySpecularBakePipeline == nil || mySpecularMap == nil)
+  if (mySpecularBakePipeline == nil || mySpecularMap == nil
+   || theLevel >= mySpecMapLevelsNumber)
   {
     return false;
   }
 
-  id<MTLCommandBuffer> aCommandBuffer = [theCtx->CommandQueue() commandBuffer];
-  id<MTLComputeCommandEncoder> aEncoder = [aCommandBuffer computeCommandEncoder];
-  [aEncoder setComputePipelineState:mySpecularBakePipeline];
-  [aEncoder setTexture:theEnvMap atIndex:0];
+  [theEncoder setComputePipelineState:mySpecularBakePipeline];
+  [theEncoder setTexture:theEnvMap atIndex:0];
 
   struct SpecularBakeParams {
     uint32_t faceIndex;
@@ -464,47 +574,37 @@ bool Metal_PBREnvironment::bakeSpecularMap(const occ::handle<Metal_Context>& the
     int32_t yCoeff;
   };
 
-  // Bake each mip level of each face
-  for (uint32_t aLevel = 0; aLevel < mySpecMapLevelsNumber; ++aLevel)
+  const uint32_t aLevelSize = std::max(1u, (1u << myPow2Size) >> theLevel);
+  for (uint32_t aFace = 0; aFace < 6; ++aFace)
   {
-    uint32_t aLevelSize = std::max(1u, (1u << myPow2Size) >> aLevel);
+    // Create texture view for this face/mip
+    id<MTLTexture> aFaceTexture = [mySpecularMap newTextureViewWithPixelFormat:MTLPixelFormatRGBA16Float
+                                                                    textureType:MTLTextureType2D
+                                                                         levels:NSMakeRange(theLevel, 1)
+                                                                         slices:NSMakeRange(aFace, 1)];
 
-    // Create a 2D texture view for writing to this mip level
-    for (uint32_t aFace = 0; aFace < 6; ++aFace)
-    {
-      // Create texture view for this face/mip
-      id<MTLTexture> aFaceTexture = [mySpecularMap newTextureViewWithPixelFormat:MTLPixelFormatRGBA16Float
-                                                                      textureType:MTLTextureType2D
-                                                                           levels:NSMakeRange(aLevel, 1)
-                                                                           slices:NSMakeRange(aFace, 1)];
-
-      SpecularBakeParams aParams;
-      aParams.faceIndex = aFace;
-      aParams.mipLevel = aLevel;
-      aParams.totalLevels = mySpecMapLevelsNumber;
-      aParams.numSamples = (uint32_t)std::max(size_t(16), theNbSamples >> aLevel);
-      aParams.zCoeff = theZIsInverted ? -1 : 1;
-      aParams.yCoeff = theIsTopDown ? 1 : -1;
-
-      [aEncoder setTexture:aFaceTexture atIndex:1];
-      [aEncoder setBytes:&aParams length:sizeof(aParams) atIndex:0];
-
-      MTLSize aThreadgroupSize = MTLSizeMake(8, 8, 1);
-      MTLSize aGridSize = MTLSizeMake((aLevelSize + 7) / 8, (aLevelSize + 7) / 8, 1);
-      [aEncoder dispatchThreadgroups:aGridSize threadsPerThreadgroup:aThreadgroupSize];
-    }
-  }
+    SpecularBakeParams aParams;
+    aParams.faceIndex = aFace;
+    aParams.mipLevel = theLevel;
+    aParams.totalLevels = mySpecMapLevelsNumber;
+    aParams.numSamples = (uint32_t)std::max(size_t(16), theNbSamples >> theLevel);
+    aParams.zCoeff = theZIsInverted ? -1 : 1;
+    aParams.yCoeff = theIsTopDown ? 1 : -1;
 
-  [aEncoder endEncoding];
-  [aCommandBuffer commit];
-  [aCommandBuffer waitUntilCompleted];
+    [theEncoder setTexture:aFaceTexture atIndex:1];
+    [theEncoder setBytes:&aParams length:sizeof(aParams) atIndex:0];
+
+    MTLSize aThreadgroupSize = MTLSizeMake(8, 8, 1);
+    MTLSize aGridSize = MTLSizeMake((aLevelSize + 7) / 8, (aLevelSize + 7) / 8, 1);
+    [theEncoder dispatchThreadgroups:aGridSize threadsPerThreadgroup:aThreadgroupSize];
+  }
 
   return true;
 }
 
 //=================================================================================================
 
-bool Metal_PBREnvironment::bakeDiffuseMap(const occ::handle<Metal_Context>& theCtx,
+bool Metal_PBREnvironment::bakeDiffuseMap(id<MTLComputeCommandEncoder> theEncoder,
                                           id<MTLTexture> theEnvMap,
                                           bool theZIsInverted,
                                           bool theIsTopDown,
@@ -515,10 +615,8 @@ bool Metal_PBREnvironment::bakeDiffuseMap(const occ::handle<Metal_Context>& theC
     return false;
   }
 
-  id<MTLCommandBuffer> aCommandBuffer = [theCtx->CommandQueue() commandBuffer];
-  id<MTLComputeCommandEncoder> aEncoder = [aCommandBuffer computeCommandEncoder];
-  [aEncoder setComputePipelineState:myDiffuseBakePipeline];
-  [aEncoder setTexture:theEnvMap atIndex:0];
+  [theEncoder setComputePipelineState:myDiffuseBakePipeline];
+  [theEncoder setTexture:theEnvMap atIndex:0];
 
   struct DiffuseBakeParams {
     uint32_t faceIndex;
@@ -542,18 +640,14 @@ bool Metal_PBREnvironment::bakeDiffuseMap(const occ::handle<Metal_Context>& theC
     aParams.zCoeff = theZIsInverted ? -1 : 1;
     aParams.yCoeff = theIsTopDown ? 1 : -1;
 
-    [aEncoder setTexture:aFaceTexture atIndex:1];
-    [aEncoder setBytes:&aParams length:sizeof(aParams) atIndex:0];
+    [theEncoder setTexture:aFaceTexture atIndex:1];
+    [theEncoder setBytes:&aParams length:sizeof(aParams) atIndex:0];
 
     MTLSize aThreadgroupSize = MTLSizeMake(8, 8, 1);
     MTLSize aGridSize = MTLSizeMake((aDiffSize + 7) / 8, (aDiffSize + 7) / 8, 1);
-    [aEncoder dispatchThreadgroups:aGridSize threadsPerThreadgroup:aThreadgroupSize];
+    [theEncoder dispatchThreadgroups:aGridSize threadsPerThreadgroup:aThreadgroupSize];
   }
 
-  [aEncoder endEncoding];
-  [aCommandBuffer commit];
-  [aCommandBuffer waitUntilCompleted];
-
   return true;
 }
 
@@ -568,6 +662,8 @@ void Metal_PBREnvironment::Clear(const occ::handle<Metal_Context>& theCtx,
   }
 
   myIsNeededToBeBound = true;
+  myBakeEnvMap = nil;
+  myBakeCmdBuffer = nil;
 
   // Clear textures by rendering solid color
   id<MTLCommandBuffer> aCommandBuffer = [theCtx->CommandQueue() commandBuffer];
@@ -578,7 +674,6 @@ void Metal_PBREnvironment::Clear(const occ::handle<Metal_Context>& theCtx,
 
   [aBlit endEncoding];
   [aCommandBuffer commit];
-  [aCommandBuffer waitUntilCompleted];
 }
 
 //=================================================================================================
@@ -0,0 +1,61 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef Metal_PageAllocator_HeaderFile
+#define Metal_PageAllocator_HeaderFile
+
+#include <NCollection_BaseAllocator.hxx>
+
+class NCollection_Buffer;
+
+//! Allocator of vertex data which can be shared with GPU without copying.
+//! Large blocks are aligned to the virtual memory page and padded to the page size,
+//! so that Metal_Buffer::Adopt() can wrap them by newBufferWithBytesNoCopy on devices with unified memory;
+//! small blocks are 16-bytes aligned as by Graphic3d_Buffer::DefaultAllocator() to avoid wasting pages.
+//! Installed as Graphic3d_Buffer::SetDefaultAllocator() by Metal_GraphicDriver when Metal_Caps::useZeroCopyArrays is set.
+class Metal_PageAllocator : public NCollection_BaseAllocator
+{
+  DEFINE_STANDARD_RTTIEXT(Metal_PageAllocator, NCollection_BaseAllocator)
+public:
+
+  //! Minimal size of a block to be page-aligned (64 KiB).
+  static constexpr size_t MinPageAlignedSize = 64 * 1024;
+
+  //! Return virtual memory page size.
+  Standard_EXPORT static size_t PageSize();
+
+  //! Return length of the page-aligned range holding buffer data, or 0 if buffer has not
+  //! been allocated by Metal_PageAllocator as page-aligned block and cannot be adopted.
+  Standard_EXPORT static size_t AdoptableLength(const NCollection_Buffer& theBuffer);
+
+public:
+
+  //! Empty constructor.
+  Standard_EXPORT Metal_PageAllocator();
+
+  //! Allocate memory with given size. Returns NULL on failure.
+  Standard_EXPORT void* Allocate(const size_t theSize) override;
+
+  //! Allocate memory with given size. Returns NULL on failure.
+  void* AllocateOptimal(const size_t theSize) override { return Allocate(theSize); }
+
+  //! Free a previously allocated memory.
+  Standard_EXPORT void Free(void* thePtr) override;
+
+private:
+
+  Metal_PageAllocator(const Metal_PageAllocator&) = delete;
+  Metal_PageAllocator& operator=(const Metal_PageAllocator&) = delete;
+};
+
+#endif // Metal_PageAllocator_HeaderFile
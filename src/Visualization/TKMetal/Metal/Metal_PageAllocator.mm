@@ -0,0 +1,93 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <Metal_PageAllocator.hxx>
+
+#include <NCollection_Buffer.hxx>
+#include <Standard.hxx>
+
+#include <unistd.h>
+
+IMPLEMENT_STANDARD_RTTIEXT(Metal_PageAllocator, NCollection_BaseAllocator)
+
+namespace
+{
+  //! Alignment of small blocks.
+  static const size_t THE_SMALL_ALIGNMENT = 16;
+
+  //! Round size up to the page size.
+  static size_t alignToPage(size_t theSize)
+  {
+    const size_t aPage = Metal_PageAllocator::PageSize();
+    return (theSize + aPage - 1) / aPage * aPage;
+  }
+}
+
+// =======================================================================
+// function : PageSize
+// purpose  : Return virtual memory page size
+// =======================================================================
+size_t Metal_PageAllocator::PageSize()
+{
+  static const size_t THE_PAGE_SIZE = size_t(getpagesize());
+  return THE_PAGE_SIZE;
+}
+
+// =======================================================================
+// function : AdoptableLength
+// purpose  : Return length of page-aligned range holding buffer data
+// =======================================================================
+size_t Metal_PageAllocator::AdoptableLength(const NCollection_Buffer& theBuffer)
+{
+  if (theBuffer.IsEmpty()
+   || theBuffer.Size() < MinPageAlignedSize
+   || theBuffer.Allocator().IsNull()
+   || !theBuffer.Allocator()->IsKind(STANDARD_TYPE(Metal_PageAllocator))
+   || (reinterpret_cast<uintptr_t>(theBuffer.Data()) % PageSize()) != 0)
+  {
+    return 0;
+  }
+  return alignToPage(theBuffer.Size());
+}
+
+// =======================================================================
+// function : Metal_PageAllocator
+// purpose  : Constructor
+// =======================================================================
+Metal_PageAllocator::Metal_PageAllocator()
+{
+  //
+}
+
+// =======================================================================
+// function : Allocate
+// purpose  : Allocate memory block
+// =======================================================================
+void* Metal_PageAllocator::Allocate(const size_t theSize)
+{
+  if (theSize < MinPageAlignedSize)
+  {
+    return Standard::AllocateAligned(theSize, THE_SMALL_ALIGNMENT);
+  }
+  // padding up to the page keeps the whole range mappable by newBufferWithBytesNoCopy
+  return Standard::AllocateAligned(alignToPage(theSize), PageSize());
+}
+
+// =======================================================================
+// function : Free
+// purpose  : Free memory block
+// =======================================================================
+void Metal_PageAllocator::Free(void* thePtr)
+{
+  Standard::FreeAligned(thePtr);
+}
@@ -0,0 +1,117 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef Metal_PipelineCache_HeaderFile
+#define Metal_PipelineCache_HeaderFile
+
+#include <Metal_ShaderProgramKey.hxx>
+#include <NCollection_Map.hxx>
+#include <Standard_Transient.hxx>
+#include <Standard_Type.hxx>
+#include <TCollection_AsciiString.hxx>
+
+#ifdef __OBJC__
+@class MTLRenderPipelineDescriptor;
+@class NSError;
+@protocol MTLBinaryArchive;
+@protocol MTLRenderPipelineState;
+#endif
+
+class Metal_Context;
+
+//! Persistent render pipeline cache backed by MTLBinaryArchive.
+//!
+//! Pipelines created through this cache are looked up within the binary archive first,
+//! so that warm starts skip back-end (GPU-specific) shader compilation.
+//! Newly created pipelines are appended to the archive and written to disk by Save().
+//!
+//! Next to the archive file, the cache stores a small text file (<path>.keys)
+//! listing archived Metal_ShaderProgramKey values and the name of the device
+//! the archive has been built for; archive built for another device is discarded.
+class Metal_PipelineCache : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(Metal_PipelineCache, Standard_Transient)
+public:
+
+  //! Create uninitialized cache.
+  Standard_EXPORT Metal_PipelineCache();
+
+  //! Destructor.
+  Standard_EXPORT ~Metal_PipelineCache() override;
+
+  //! Open existing archive or create a new empty one.
+  //! @param theCtx      Metal context
+  //! @param theFilePath path to archive file
+  //! @return FALSE if binary archives are not supported by device or OS
+  Standard_EXPORT bool Init(Metal_Context* theCtx, const TCollection_AsciiString& theFilePath);
+
+  //! Return TRUE if archive has been opened.
+  bool IsValid() const { return myArchive != nullptr; }
+
+  //! Return path to archive file.
+  const TCollection_AsciiString& FilePath() const { return myFilePath; }
+
+  //! Return TRUE if pipeline for this key has been archived.
+  bool Contains(const Metal_ShaderProgramKey& theKey) const { return myKeys.Contains(theKey); }
+
+  //! Return archived keys.
+  const NCollection_Map<Metal_ShaderProgramKey, Metal_ShaderProgramKeyHasher>& Keys() const
+  {
+    return myKeys;
+  }
+
+  //! Return TRUE if archive has been modified since last Save().
+  bool IsModified() const { return myIsModified; }
+
+#ifdef __OBJC__
+  //! Create render pipeline using the archive.
+  //! Pipeline functions are appended to the archive, when key is not yet archived.
+  //! @param theCtx   Metal context
+  //! @param theDesc  pipeline descriptor
+  //! @param theKey   program key identifying the descriptor
+  //! @param theError optional error output
+  //! @return pipeline state or nil on failure
+  Standard_EXPORT id<MTLRenderPipelineState> CreatePipeline(Metal_Context* theCtx,
+                                                            MTLRenderPipelineDescriptor* theDesc,
+                                                            const Metal_ShaderProgramKey& theKey,
+                                                            NSError** theError);
+#endif
+
+  //! Write archive and key list to disk, if modified.
+  //! @return FALSE on write failure
+  Standard_EXPORT bool Save(Metal_Context* theCtx);
+
+  //! Release archive (without saving).
+  Standard_EXPORT void Release();
+
+protected:
+
+  //! Read key list; returns FALSE if list is absent or has been written for another device.
+  Standard_EXPORT bool readKeys(const TCollection_AsciiString& theDeviceName);
+
+  //! Write key list.
+  Standard_EXPORT bool writeKeys(const TCollection_AsciiString& theDeviceName) const;
+
+protected:
+
+#ifdef __OBJC__
+  id<MTLBinaryArchive> myArchive; //!< binary archive
+#else
+  void*                myArchive; //!< binary archive (opaque)
+#endif
+  NCollection_Map<Metal_ShaderProgramKey, Metal_ShaderProgramKeyHasher> myKeys; //!< archived keys
+  TCollection_AsciiString myFilePath;   //!< archive file path
+  bool                    myIsModified; //!< archive has unsaved pipelines
+};
+
+#endif // Metal_PipelineCache_HeaderFile
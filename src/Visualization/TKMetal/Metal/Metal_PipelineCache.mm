@@ -0,0 +1,258 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#import <Metal/Metal.h>
+
+#include <Metal_PipelineCache.hxx>
+#include <Metal_Context.hxx>
+#include <OSD_OpenFile.hxx>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+
+IMPLEMENT_STANDARD_RTTIEXT(Metal_PipelineCache, Standard_Transient)
+
+namespace
+{
+  //! Header line of the key list file.
+  static const char THE_KEYS_HEADER[] = "# TKMetal pipeline cache";
+}
+
+// =======================================================================
+// function : Metal_PipelineCache
+// purpose  : Constructor
+// =======================================================================
+Metal_PipelineCache::Metal_PipelineCache()
+: myArchive(nil),
+  myIsModified(false)
+{
+  //
+}
+
+// =======================================================================
+// function : ~Metal_PipelineCache
+// purpose  : Destructor
+// =======================================================================
+Metal_PipelineCache::~Metal_PipelineCache()
+{
+  Release();
+}
+
+// =======================================================================
+// function : Init
+// purpose  : Open existing archive or create a new one
+// =======================================================================
+bool Metal_PipelineCache::Init(Metal_Context* theCtx, const TCollection_AsciiString& theFilePath)
+{
+  Release();
+  if (theCtx == nullptr || theCtx->Device() == nil || theFilePath.IsEmpty())
+  {
+    return false;
+  }
+
+  if (@available(macOS 11.0, iOS 14.0, *))
+  {
+    @autoreleasepool
+    {
+      myFilePath = theFilePath;
+      NSURL* anUrl = [NSURL fileURLWithPath:@(theFilePath.ToCString())];
+      const bool hasArchive = [[NSFileManager defaultManager] fileExistsAtPath:anUrl.path]
+                           && readKeys(theCtx->DeviceName());
+
+      NSError* anError = nil;
+      MTLBinaryArchiveDescriptor* aDesc = [[MTLBinaryArchiveDescriptor alloc] init];
+      if (hasArchive)
+      {
+        aDesc.url = anUrl;
+        myArchive = [theCtx->Device() newBinaryArchiveWithDescriptor:aDesc error:&anError];
+        if (myArchive == nil)
+        {
+          // archive written by another OS / driver version - start from scratch
+          theCtx->Messenger()->SendWarning() << "Metal_PipelineCache: unable to open '" << theFilePath
+                                             << "', cache will be rebuilt";
+          myKeys.Clear();
+        }
+      }
+      if (myArchive == nil)
+      {
+        aDesc.url = nil;
+        anError   = nil;
+        myArchive = [theCtx->Device() newBinaryArchiveWithDescriptor:aDesc error:&anError];
+      }
+      if (myArchive == nil)
+      {
+        theCtx->Messenger()->SendFail() << "Metal_PipelineCache: binary archive creation failed: "
+                                        << (anError != nil ? [[anError localizedDescription] UTF8String] : "");
+        myFilePath.Clear();
+        myKeys.Clear();
+        return false;
+      }
+      return true;
+    }
+  }
+  return false;
+}
+
+// =======================================================================
+// function : CreatePipeline
+// purpose  : Create render pipeline using the archive
+// =======================================================================
+id<MTLRenderPipelineState> Metal_PipelineCache::CreatePipeline(Metal_Context* theCtx,
+                                                               MTLRenderPipelineDescriptor* theDesc,
+                                                               const Metal_ShaderProgramKey& theKey,
+                                                               NSError** theError)
+{
+  if (theCtx == nullptr || theCtx->Device() == nil || theDesc == nil)
+  {
+    return nil;
+  }
+  if (myArchive == nil)
+  {
+    return [theCtx->Device() newRenderPipelineStateWithDescriptor:theDesc error:theError];
+  }
+
+  if (@available(macOS 11.0, iOS 14.0, *))
+  {
+    theDesc.binaryArchives = @[myArchive];
+    id<MTLRenderPipelineState> aPipeline = [theCtx->Device() newRenderPipelineStateWithDescriptor:theDesc
+                                                                                            error:theError];
+    if (aPipeline == nil || myKeys.Contains(theKey))
+    {
+      return aPipeline;
+    }
+
+    NSError* anError = nil;
+    if ([myArchive addRenderPipelineFunctionsWithDescriptor:theDesc error:&anError])
+    {
+      myKeys.Add(theKey);
+      myIsModified = true;
+    }
+    else if (anError != nil)
+    {
+      theCtx->Messenger()->SendWarning() << "Metal_PipelineCache: unable to archive pipeline: "
+                                         << [[anError localizedDescription] UTF8String];
+    }
+    return aPipeline;
+  }
+  return [theCtx->Device() newRenderPipelineStateWithDescriptor:theDesc error:theError];
+}
+
+// =======================================================================
+// function : Save
+// purpose  : Write archive to disk
+// =======================================================================
+bool Metal_PipelineCache::Save(Metal_Context* theCtx)
+{
+  if (myArchive == nil || !myIsModified || theCtx == nullptr)
+  {
+    return true;
+  }
+
+  if (@available(macOS 11.0, iOS 14.0, *))
+  {
+    @autoreleasepool
+    {
+      NSError* anError = nil;
+      NSURL* anUrl = [NSURL fileURLWithPath:@(myFilePath.ToCString())];
+      if (![myArchive serializeToURL:anUrl error:&anError])
+      {
+        theCtx->Messenger()->SendFail() << "Metal_PipelineCache: unable to write '" << myFilePath << "': "
+                                        << (anError != nil ? [[anError localizedDescription] UTF8String] : "");
+        return false;
+      }
+      if (!writeKeys(theCtx->DeviceName()))
+      {
+        theCtx->Messenger()->SendFail() << "Metal_PipelineCache: unable to write '" << myFilePath << ".keys'";
+        return false;
+      }
+      myIsModified = false;
+      return true;
+    }
+  }
+  return false;
+}
+
+// =======================================================================
+// function : Release
+// purpose  : Release archive
+// =======================================================================
+void Metal_PipelineCache::Release()
+{
+  myArchive = nil;
+  myKeys.Clear();
+  myFilePath.Clear();
+  myIsModified = false;
+}
+
+// =======================================================================
+// function : readKeys
+// purpose  : Read key list
+// =======================================================================
+bool Metal_PipelineCache::readKeys(const TCollection_AsciiString& theDeviceName)
+{
+  myKeys.Clear();
+  std::ifstream aStream;
+  OSD_OpenStream(aStream, (myFilePath + ".keys").ToCString(), std::ios::in);
+  if (!aStream.is_open())
+  {
+    return false;
+  }
+
+  std::string aLine;
+  if (!std::getline(aStream, aLine) || aLine != THE_KEYS_HEADER)
+  {
+    return false;
+  }
+  if (!std::getline(aStream, aLine) || aLine.rfind("device ", 0) != 0
+   || aLine.substr(7) != theDeviceName.ToCString())
+  {
+    return false;
+  }
+
+  while (std::getline(aStream, aLine))
+  {
+    std::istringstream aLineStream(aLine);
+    std::string aTag;
+    int aModel = 0, aBits = 0;
+    if ((aLineStream >> aTag >> aModel >> aBits) && aTag == "key")
+    {
+      myKeys.Add(Metal_ShaderProgramKey((Graphic3d_TypeOfShadingModel)aModel, aBits));
+    }
+  }
+  return true;
+}
+
+// =======================================================================
+// function : writeKeys
+// purpose  : Write key list
+// =======================================================================
+bool Metal_PipelineCache::writeKeys(const TCollection_AsciiString& theDeviceName) const
+{
+  std::ofstream aStream;
+  OSD_OpenStream(aStream, (myFilePath + ".keys").ToCString(), std::ios::out | std::ios::trunc);
+  if (!aStream.is_open())
+  {
+    return false;
+  }
+
+  aStream << THE_KEYS_HEADER << "\n"
+          << "device " << theDeviceName.ToCString() << "\n";
+  for (NCollection_Map<Metal_ShaderProgramKey, Metal_ShaderProgramKeyHasher>::Iterator aKeyIter(myKeys);
+       aKeyIter.More(); aKeyIter.Next())
+  {
+    aStream << "key " << (int)aKeyIter.Key().ShadingModel << " " << aKeyIter.Key().ProgramBits << "\n";
+  }
+  aStream.flush();
+  return aStream.good();
+}
@@ -0,0 +1,95 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef Metal_PipelineProfile_HeaderFile
+#define Metal_PipelineProfile_HeaderFile
+
+#include <Metal_ShaderProgramKey.hxx>
+#include <NCollection_Map.hxx>
+#include <Standard_Transient.hxx>
+#include <Standard_Type.hxx>
+#include <TCollection_AsciiString.hxx>
+
+//! Usage profile of render pipelines.
+//!
+//! Records shader program keys and depth-stencil states requested during a session
+//! and stores them into a small text file, so that the next session could
+//! precompile the same permutations in background right after initialization
+//! (see Metal_ShaderManager::WarmUp()) instead of compiling them on first use.
+//!
+//! Profile is accumulated across sessions - entries read from the file are kept.
+class Metal_PipelineProfile : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(Metal_PipelineProfile, Standard_Transient)
+public:
+
+  //! Create empty profile.
+  Standard_EXPORT Metal_PipelineProfile();
+
+  //! Destructor.
+  Standard_EXPORT ~Metal_PipelineProfile() override;
+
+  //! Read profile from file (entries are appended to already recorded ones).
+  //! @return FALSE if file is absent or has unexpected format
+  Standard_EXPORT bool Read(const TCollection_AsciiString& theFilePath);
+
+  //! Write profile to file, if modified since last Read()/Write().
+  //! @return FALSE on write failure
+  Standard_EXPORT bool Write(const TCollection_AsciiString& theFilePath);
+
+  //! Record usage of shader program.
+  void AddProgram(const Metal_ShaderProgramKey& theKey)
+  {
+    if (myPrograms.Add(theKey))
+    {
+      myIsModified = true;
+    }
+  }
+
+  //! Record usage of depth-stencil state (see Metal_ShaderManager depth-stencil cache).
+  void AddDepthStencil(int theId)
+  {
+    if (myDepthStencils.Add(theId))
+    {
+      myIsModified = true;
+    }
+  }
+
+  //! Return recorded shader programs.
+  const NCollection_Map<Metal_ShaderProgramKey, Metal_ShaderProgramKeyHasher>& Programs() const
+  {
+    return myPrograms;
+  }
+
+  //! Return recorded depth-stencil states.
+  const NCollection_Map<int>& DepthStencils() const { return myDepthStencils; }
+
+  //! Return TRUE if profile has unsaved entries.
+  bool IsModified() const { return myIsModified; }
+
+  //! Clear profile.
+  void Clear()
+  {
+    myPrograms.Clear();
+    myDepthStencils.Clear();
+    myIsModified = false;
+  }
+
+protected:
+
+  NCollection_Map<Metal_ShaderProgramKey, Metal_ShaderProgramKeyHasher> myPrograms; //!< used programs
+  NCollection_Map<int> myDepthStencils; //!< used depth-stencil states
+  bool                 myIsModified;    //!< profile has unsaved entries
+};
+
+#endif // Metal_PipelineProfile_HeaderFile
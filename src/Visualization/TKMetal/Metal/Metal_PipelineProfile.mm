@@ -0,0 +1,131 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <Metal_PipelineProfile.hxx>
+#include <OSD_OpenFile.hxx>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+
+IMPLEMENT_STANDARD_RTTIEXT(Metal_PipelineProfile, Standard_Transient)
+
+namespace
+{
+  //! Header line of the profile file.
+  static const char THE_PROFILE_HEADER[] = "# TKMetal pipeline profile";
+}
+
+// =======================================================================
+// function : Metal_PipelineProfile
+// purpose  : Constructor
+// =======================================================================
+Metal_PipelineProfile::Metal_PipelineProfile()
+: myIsModified(false)
+{
+  //
+}
+
+// =======================================================================
+// function : ~Metal_PipelineProfile
+// purpose  : Destructor
+// =======================================================================
+Metal_PipelineProfile::~Metal_PipelineProfile()
+{
+  //
+}
+
+// =======================================================================
+// function : Read
+// purpose  : Read profile from file
+// =======================================================================
+bool Metal_PipelineProfile::Read(const TCollection_AsciiString& theFilePath)
+{
+  std::ifstream aStream;
+  OSD_OpenStream(aStream, theFilePath.ToCString(), std::ios::in);
+  if (!aStream.is_open())
+  {
+    return false;
+  }
+
+  std::string aLine;
+  if (!std::getline(aStream, aLine) || aLine != THE_PROFILE_HEADER)
+  {
+    return false;
+  }
+
+  while (std::getline(aStream, aLine))
+  {
+    std::istringstream aLineStream(aLine);
+    std::string aTag;
+    if (!(aLineStream >> aTag))
+    {
+      continue;
+    }
+
+    if (aTag == "program")
+    {
+      int aModel = 0, aBits = 0;
+      if (aLineStream >> aModel >> aBits)
+      {
+        myPrograms.Add(Metal_ShaderProgramKey((Graphic3d_TypeOfShadingModel)aModel, aBits));
+      }
+    }
+    else if (aTag == "depthstencil")
+    {
+      int anId = 0;
+      if (aLineStream >> anId)
+      {
+        myDepthStencils.Add(anId);
+      }
+    }
+  }
+  return true;
+}
+
+// =======================================================================
+// function : Write
+// purpose  : Write profile to file
+// =======================================================================
+bool Metal_PipelineProfile::Write(const TCollection_AsciiString& theFilePath)
+{
+  if (!myIsModified)
+  {
+    return true;
+  }
+
+  std::ofstream aStream;
+  OSD_OpenStream(aStream, theFilePath.ToCString(), std::ios::out | std::ios::trunc);
+  if (!aStream.is_open())
+  {
+    return false;
+  }
+
+  aStream << THE_PROFILE_HEADER << "\n";
+  for (NCollection_Map<Metal_ShaderProgramKey, Metal_ShaderProgramKeyHasher>::Iterator aKeyIter(myPrograms);
+       aKeyIter.More(); aKeyIter.Next())
+  {
+    aStream << "program " << (int)aKeyIter.Key().ShadingModel << " " << aKeyIter.Key().ProgramBits << "\n";
+  }
+  for (NCollection_Map<int>::Iterator anIdIter(myDepthStencils); anIdIter.More(); anIdIter.Next())
+  {
+    aStream << "depthstencil " << anIdIter.Key() << "\n";
+  }
+  aStream.flush();
+  if (!aStream.good())
+  {
+    return false;
+  }
+  myIsModified = false;
+  return true;
+}
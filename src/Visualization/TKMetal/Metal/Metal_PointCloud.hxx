@@ -0,0 +1,138 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef Metal_PointCloud_HeaderFile
+#define Metal_PointCloud_HeaderFile
+
+#include <Metal_Resource.hxx>
+#include <Graphic3d_Buffer.hxx>
+
+#include <vector>
+
+#ifdef __OBJC__
+@protocol MTLBuffer;
+#endif
+
+class Metal_PointCloudBuilder;
+class Metal_Workspace;
+
+//! Level of detail renderer of very large point arrays (see Metal_Caps::pointCloudMinPoints).
+//!
+//! Points are sorted into octree on a background queue. Each node keeps up to NodeCapacity points
+//! subsampled by grid of SampleGridSize^3 cells within the node box (one point per cell),
+//! remaining points are passed to child nodes, so that points of a node together with points of its ancestors
+//! form a uniformly spaced subset of the cloud with spacing of the node grid.
+//!
+//! Each frame nodes are selected top-down in order of their point spacing projected on screen,
+//! until the spacing becomes smaller than Metal_Caps::pointCloudPixelError or selection fills the GPU budget.
+//! Points of selected nodes are streamed into slots of a fixed buffer (Metal_Caps::pointCloudBudget),
+//! replacing least recently drawn nodes, with at most MaxUploadsPerFrame nodes per frame;
+//! the view remains invalidated while selected nodes are not resident (see HasPendingNodes()).
+//! Points are drawn either as point primitives or by compute rasterizer of the view (see Metal_PointCloudRaster).
+class Metal_PointCloud : public Metal_Resource
+{
+  DEFINE_STANDARD_RTTIEXT(Metal_PointCloud, Metal_Resource)
+public:
+
+  //! Maximum number of points within octree node (and within GPU slot).
+  static constexpr int NodeCapacity = 16384;
+
+  //! Number of subsampling grid cells along each side of the node box.
+  static constexpr int SampleGridSize = 32;
+
+  //! Maximum depth of octree; points of deeper nodes beyond NodeCapacity (duplicates) are not drawn.
+  static constexpr int MaxDepth = 20;
+
+  //! Maximum number of nodes uploaded into GPU slots per frame.
+  static constexpr int MaxUploadsPerFrame = 32;
+
+  //! Octree node.
+  struct Node
+  {
+    float    BoxMin[3];   //!< minimal corner of node cube in model space
+    float    BoxMax[3];   //!< maximal corner of node cube in model space
+    float    Spacing;     //!< size of subsampling grid cell
+    uint32_t FirstPoint;  //!< first entry of node points within sorted point indices
+    uint32_t NbPoints;    //!< number of node own points
+    int32_t  Children[8]; //!< child nodes, or -1
+  };
+
+public:
+
+  //! Empty constructor.
+  Standard_EXPORT Metal_PointCloud();
+
+  //! Destructor.
+  Standard_EXPORT ~Metal_PointCloud() override;
+
+  //! Return TRUE if octree has been built.
+  bool IsReady() const { return !myNodes.empty(); }
+
+  //! Return TRUE if octree is still being built or nodes selected by the last frame are not resident yet.
+  bool HasPendingNodes() const { return myNodes.empty() || myNbMissingNodes > 0; }
+
+  //! Return number of octree nodes.
+  int NbNodes() const { return (int)myNodes.size(); }
+
+  //! Return number of points drawn by the last frame.
+  size_t NbDrawnPoints() const { return myNbDrawnPoints; }
+
+  //! Start building octree of points on background queue.
+  //! @param theCtx Metal context
+  //! @param theAttribs vertex attributes with positions (3 floats per vertex) and optional colors;
+  //!                   kept by the object to stream points into GPU memory
+  //! @return FALSE if array cannot be rendered with level of detail
+  Standard_EXPORT bool Init(Metal_Context* theCtx,
+                            const occ::handle<Graphic3d_Buffer>& theAttribs);
+
+  //! Release GPU resources and cancel octree building.
+  Standard_EXPORT void Release(Metal_Context* theCtx) override;
+
+  //! Return estimated GPU memory usage.
+  Standard_EXPORT size_t EstimatedDataSize() const override;
+
+  //! Select octree nodes for current camera of the workspace, upload missing ones and draw resident ones,
+  //! either by point pipeline (Metal_Workspace::ApplyPointCloudPipelineState()) or by queuing them
+  //! into compute rasterizer of the view.
+  Standard_EXPORT void Render(Metal_Workspace* theWorkspace);
+
+protected:
+
+  //! Take octree from background queue once it is built.
+  bool fetchOctree(Metal_Context* theCtx);
+
+  //! Find slot for node upload: free slot, or least recently drawn slot not used by frames in flight.
+  //! @return slot index or -1
+  int findSlot(uint64_t theFrame, int theNbFramesInFlight) const;
+
+  //! Copy points of the node into the slot.
+  void uploadNode(int theNode, int theSlot);
+
+protected:
+
+  occ::handle<Metal_PointCloudBuilder> myBuilder;    //!< state shared with background queue
+  std::vector<Node>                    myNodes;      //!< octree nodes, root first
+  std::vector<int>                     myNodeSlots;  //!< slot holding points of each node, or -1
+  std::vector<int>                     mySlotNodes;  //!< node within each slot, or -1
+  std::vector<uint64_t>                mySlotFrames; //!< frame number which last drawn each slot
+#ifdef __OBJC__
+  id<MTLBuffer>                        myPoints;     //!< slots of NodeCapacity points
+#else
+  void*                                myPoints;
+#endif
+  int                                  myNbSlots;        //!< number of slots within myPoints
+  int                                  myNbMissingNodes; //!< nodes selected but not resident in the last frame
+  size_t                               myNbDrawnPoints;  //!< points drawn by the last frame
+};
+
+#endif // Metal_PointCloud_HeaderFile
@@ -0,0 +1,639 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#import <Metal/Metal.h>
+
+#include <Metal_PointCloud.hxx>
+#include <Metal_Context.hxx>
+#include <Metal_PointCloudRaster.hxx>
+#include <Metal_View.hxx>
+#include <Metal_Workspace.hxx>
+#include <Graphic3d_Vec3.hxx>
+
+#include <algorithm>
+#include <atomic>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+#include <queue>
+
+IMPLEMENT_STANDARD_RTTIEXT(Metal_PointCloud, Metal_Resource)
+
+namespace
+{
+  //! Point within GPU slot (should match CloudPoint in THE_POINT_CLOUD_SHADER_SOURCE and Metal_PointCloudRaster).
+  struct Metal_CloudPoint
+  {
+    float    Position[3];
+    uint32_t Color; //!< RGBA8 color
+  };
+
+  //! Parameters of point cloud vertex function (should match PointCloudParams in THE_POINT_CLOUD_SHADER_SOURCE).
+  struct Metal_PointCloudParams
+  {
+    float    PointSize;
+    uint32_t HasColors;
+    uint32_t Padding[2];
+  };
+
+  //! Return octant of the point within the box.
+  static int pointOctant(const Graphic3d_Vec3& thePnt, const Graphic3d_Vec3& theCenter)
+  {
+    return (thePnt.x() >= theCenter.x() ? 1 : 0)
+         | (thePnt.y() >= theCenter.y() ? 2 : 0)
+         | (thePnt.z() >= theCenter.z() ? 4 : 0);
+  }
+}
+
+//! Octree built on background queue together with the source of points.
+class Metal_PointCloudBuilder : public Standard_Transient
+{
+public:
+
+  Metal_PointCloudBuilder()
+  : Queue(dispatch_queue_create("Metal_PointCloud", DISPATCH_QUEUE_SERIAL)),
+    PosData(nullptr),
+    PosStride(0),
+    ColorData(nullptr),
+    ColorStride(0),
+    ColorType(Graphic3d_TOD_VEC4UB),
+    NbPoints(0),
+    IsReady(false),
+    IsCancelled(false) {}
+
+  //! Return position of the point.
+  const Graphic3d_Vec3& Position(uint32_t theIndex) const
+  {
+    return *reinterpret_cast<const Graphic3d_Vec3*>(PosData + PosStride * size_t(theIndex));
+  }
+
+  //! Return RGBA8 color of the point.
+  uint32_t Color(uint32_t theIndex) const
+  {
+    const uint8_t* aData = ColorData + ColorStride * size_t(theIndex);
+    if (ColorType == Graphic3d_TOD_VEC4UB)
+    {
+      uint32_t aColor = 0;
+      memcpy(&aColor, aData, sizeof(aColor));
+      return aColor;
+    }
+
+    const float* aRgba = reinterpret_cast<const float*>(aData);
+    const int aNbComps = ColorType == Graphic3d_TOD_VEC4 ? 4 : 3;
+    uint32_t aColor = 0xFF000000u;
+    for (int aComp = 0; aComp < aNbComps; ++aComp)
+    {
+      const uint32_t aValue = uint32_t(std::min(std::max(aRgba[aComp], 0.0f), 1.0f) * 255.0f + 0.5f);
+      aColor = (aColor & ~(0xFFu << (aComp * 8))) | (aValue << (aComp * 8));
+    }
+    return aColor;
+  }
+
+  //! Sort points into octree.
+  void Build();
+
+public:
+
+  dispatch_queue_t              Queue;       //!< serial background queue
+  occ::handle<Graphic3d_Buffer> Attribs;     //!< source of points
+  const uint8_t*                PosData;     //!< positions within Attribs
+  size_t                        PosStride;   //!< stride of positions
+  const uint8_t*                ColorData;   //!< colors within Attribs, or NULL
+  size_t                        ColorStride; //!< stride of colors
+  Graphic3d_TypeOfData          ColorType;   //!< type of colors
+  uint32_t                      NbPoints;    //!< number of points
+  std::vector<Metal_PointCloud::Node> Nodes; //!< octree nodes
+  std::vector<uint32_t>         Order;       //!< point indices sorted by nodes
+  std::atomic<bool>             IsReady;     //!< octree has been built
+  std::atomic<bool>             IsCancelled; //!< point cloud has been released
+};
+
+// =======================================================================
+// function : Build
+// purpose  : Sort points into octree
+// =======================================================================
+void Metal_PointCloudBuilder::Build()
+{
+  // octree of cubic nodes, so that subsampling grid has the same spacing along all axes
+  Graphic3d_Vec3 aMin(FLT_MAX), aMax(-FLT_MAX);
+  for (uint32_t aPntIter = 0; aPntIter < NbPoints; ++aPntIter)
+  {
+    aMin = aMin.cwiseMin(Position(aPntIter));
+    aMax = aMax.cwiseMax(Position(aPntIter));
+  }
+  const Graphic3d_Vec3 aSize = aMax - aMin;
+  const float aCubeSize = std::max(std::max(std::max(aSize.x(), aSize.y()), aSize.z()), FLT_MIN) * 1.0001f;
+
+  Order.resize(NbPoints);
+  std::iota(Order.begin(), Order.end(), 0u);
+  std::vector<uint32_t> aRest(NbPoints);
+  std::vector<uint8_t>  aCells(size_t(Metal_PointCloud::SampleGridSize) * Metal_PointCloud::SampleGridSize
+                               * Metal_PointCloud::SampleGridSize);
+
+  struct Task
+  {
+    int32_t  Node;
+    uint32_t Begin;
+    uint32_t End;
+    int      Depth;
+  };
+  std::vector<Task> aStack;
+
+  Metal_PointCloud::Node aRoot = {};
+  for (int anAxis = 0; anAxis < 3; ++anAxis)
+  {
+    aRoot.BoxMin[anAxis] = aMin.GetData()[anAxis];
+    aRoot.BoxMax[anAxis] = aMin.GetData()[anAxis] + aCubeSize;
+  }
+  std::fill(aRoot.Children, aRoot.Children + 8, -1);
+  Nodes.push_back(aRoot);
+  aStack.push_back({ 0, 0, NbPoints, 0 });
+  while (!aStack.empty() && !IsCancelled)
+  {
+    const Task aTask = aStack.back();
+    aStack.pop_back();
+
+    const Graphic3d_Vec3 aBoxMin(Nodes[aTask.Node].BoxMin[0], Nodes[aTask.Node].BoxMin[1], Nodes[aTask.Node].BoxMin[2]);
+    const Graphic3d_Vec3 aBoxMax(Nodes[aTask.Node].BoxMax[0], Nodes[aTask.Node].BoxMax[1], Nodes[aTask.Node].BoxMax[2]);
+    const float aCellSize = (aBoxMax.x() - aBoxMin.x()) / float(Metal_PointCloud::SampleGridSize);
+    const uint32_t aNbPoints = aTask.End - aTask.Begin;
+    Nodes[aTask.Node].FirstPoint = aTask.Begin;
+    Nodes[aTask.Node].Spacing    = aCellSize;
+    if (aNbPoints <= uint32_t(Metal_PointCloud::NodeCapacity)
+     || aTask.Depth >= Metal_PointCloud::MaxDepth)
+    {
+      Nodes[aTask.Node].NbPoints = std::min(aNbPoints, uint32_t(Metal_PointCloud::NodeCapacity));
+      continue;
+    }
+
+    // keep the first point of each grid cell, indices of own points are compacted in place
+    std::fill(aCells.begin(), aCells.end(), uint8_t(0));
+    uint32_t aNbOwn = 0, aNbRest = 0;
+    for (uint32_t anIter = aTask.Begin; anIter < aTask.End; ++anIter)
+    {
+      const uint32_t aPntIndex = Order[anIter];
+      const Graphic3d_Vec3 aCell = (Position(aPntIndex) - aBoxMin) / aCellSize;
+      const int aCellX = std::min(std::max(int(aCell.x()), 0), Metal_PointCloud::SampleGridSize - 1);
+      const int aCellY = std::min(std::max(int(aCell.y()), 0), Metal_PointCloud::SampleGridSize - 1);
+      const int aCellZ = std::min(std::max(int(aCell.z()), 0), Metal_PointCloud::SampleGridSize - 1);
+      uint8_t& aCellFlag = aCells[(size_t(aCellZ) * Metal_PointCloud::SampleGridSize + aCellY) * Metal_PointCloud::SampleGridSize + aCellX];
+      if (aCellFlag == 0 && aNbOwn < uint32_t(Metal_PointCloud::NodeCapacity))
+      {
+        aCellFlag = 1;
+        Order[aTask.Begin + aNbOwn++] = aPntIndex;
+      }
+      else
+      {
+        aRest[aNbRest++] = aPntIndex;
+      }
+    }
+    Nodes[aTask.Node].NbPoints = aNbOwn;
+
+    // counting sort of remaining points into octants following own points
+    const Graphic3d_Vec3 aCenter = (aBoxMin + aBoxMax) * 0.5f;
+    uint32_t aCounts[8] = {};
+    for (uint32_t anIter = 0; anIter < aNbRest; ++anIter)
+    {
+      ++aCounts[pointOctant(Position(aRest[anIter]), aCenter)];
+    }
+    uint32_t anOffsets[8] = {};
+    uint32_t aFirst = aTask.Begin + aNbOwn;
+    for (int anOctant = 0; anOctant < 8; ++anOctant)
+    {
+      anOffsets[anOctant] = aFirst;
+      aFirst += aCounts[anOctant];
+    }
+    for (uint32_t anIter = 0; anIter < aNbRest; ++anIter)
+    {
+      const uint32_t aPntIndex = aRest[anIter];
+      Order[anOffsets[pointOctant(Position(aPntIndex), aCenter)]++] = aPntIndex;
+    }
+
+    for (int anOctant = 0; anOctant < 8; ++anOctant)
+    {
+      if (aCounts[anOctant] == 0)
+      {
+        continue;
+      }
+
+      Metal_PointCloud::Node aChild = {};
+      for (int anAxis = 0; anAxis < 3; ++anAxis)
+      {
+        const bool isUpper = (anOctant & (1 << anAxis)) != 0;
+        aChild.BoxMin[anAxis] = isUpper ? aCenter.GetData()[anAxis] : aBoxMin.GetData()[anAxis];
+        aChild.BoxMax[anAxis] = isUpper ? aBoxMax.GetData()[anAxis] : aCenter.GetData()[anAxis];
+      }
+      std::fill(aChild.Children, aChild.Children + 8, -1);
+      const int32_t aChildIndex = (int32_t)Nodes.size();
+      Nodes.push_back(aChild);
+      Nodes[aTask.Node].Children[anOctant] = aChildIndex;
+      aStack.push_back({ aChildIndex, anOffsets[anOctant] - aCounts[anOctant], anOffsets[anOctant], aTask.Depth + 1 });
+    }
+  }
+  IsReady = !IsCancelled;
+}
+
+// =======================================================================
+// function : Metal_PointCloud
+// purpose  : Constructor
+// =======================================================================
+Metal_PointCloud::Metal_PointCloud()
+: myPoints(nil),
+  myNbSlots(0),
+  myNbMissingNodes(0),
+  myNbDrawnPoints(0)
+{
+  //
+}
+
+// =======================================================================
+// function : ~Metal_PointCloud
+// purpose  : Destructor
+// =======================================================================
+Metal_PointCloud::~Metal_PointCloud()
+{
+  Release(nullptr);
+}
+
+// =======================================================================
+// function : Init
+// purpose  : Start building octree on background queue
+// =======================================================================
+bool Metal_PointCloud::Init(Metal_Context* theCtx,
+                            const occ::handle<Graphic3d_Buffer>& theAttribs)
+{
+  Release(theCtx);
+  if (theCtx == nullptr
+   || theCtx->Device() == nil
+   || theAttribs.IsNull()
+   || theAttribs->NbElements <= 0)
+  {
+    return false;
+  }
+
+  occ::handle<Metal_PointCloudBuilder> aBuilder = new Metal_PointCloudBuilder();
+  int aPosAttribIndex = -1;
+  aBuilder->PosData = theAttribs->AttributeData(Graphic3d_TOA_POS, aPosAttribIndex, aBuilder->PosStride);
+  if (aBuilder->PosData == nullptr
+   || theAttribs->Attribute(aPosAttribIndex).DataType != Graphic3d_TOD_VEC3)
+  {
+    return false;
+  }
+  int aColorAttribIndex = -1;
+  aBuilder->ColorData = theAttribs->AttributeData(Graphic3d_TOA_COLOR, aColorAttribIndex, aBuilder->ColorStride);
+  if (aBuilder->ColorData != nullptr)
+  {
+    aBuilder->ColorType = theAttribs->Attribute(aColorAttribIndex).DataType;
+    if (aBuilder->ColorType != Graphic3d_TOD_VEC4UB
+     && aBuilder->ColorType != Graphic3d_TOD_VEC4
+     && aBuilder->ColorType != Graphic3d_TOD_VEC3)
+    {
+      aBuilder->ColorData = nullptr;
+    }
+  }
+  aBuilder->Attribs  = theAttribs;
+  aBuilder->NbPoints = uint32_t(theAttribs->NbElements);
+
+  // slots are written by CPU and read directly by GPU, so that the buffer is shared even on discrete GPUs
+  const size_t aSlotSize = size_t(NodeCapacity) * sizeof(Metal_CloudPoint);
+  myNbSlots = int(std::max(theCtx->Caps()->pointCloudBudget / aSlotSize, size_t(1)));
+  myPoints  = [theCtx->Device() newBufferWithLength:aSlotSize * size_t(myNbSlots)
+                                            options:MTLResourceStorageModeShared];
+  if (myPoints == nil)
+  {
+    theCtx->Messenger()->SendFail() << "Metal_PointCloud: failed to allocate " << int(myNbSlots) << " point slots";
+    myNbSlots = 0;
+    return false;
+  }
+  myPoints.label = @"PointCloudSlots";
+  mySlotNodes .assign(size_t(myNbSlots), -1);
+  mySlotFrames.assign(size_t(myNbSlots), 0);
+
+  myBuilder = aBuilder;
+  dispatch_async(aBuilder->Queue, ^{
+    aBuilder->Build();
+  });
+  return true;
+}
+
+// =======================================================================
+// function : Release
+// purpose  : Release GPU resources
+// =======================================================================
+void Metal_PointCloud::Release(Metal_Context* )
+{
+  if (!myBuilder.IsNull())
+  {
+    myBuilder->IsCancelled = true;
+    myBuilder.Nullify();
+  }
+  myPoints = nil;
+  myNodes.clear();
+  myNodeSlots.clear();
+  mySlotNodes.clear();
+  mySlotFrames.clear();
+  myNbSlots = 0;
+  myNbMissingNodes = 0;
+  myNbDrawnPoints = 0;
+}
+
+// =======================================================================
+// function : EstimatedDataSize
+// purpose  : Return estimated GPU memory usage
+// =======================================================================
+size_t Metal_PointCloud::EstimatedDataSize() const
+{
+  return myPoints != nil ? (size_t)myPoints.length : 0;
+}
+
+// =======================================================================
+// function : fetchOctree
+// purpose  : Take octree from background queue
+// =======================================================================
+bool Metal_PointCloud::fetchOctree(Metal_Context* theCtx)
+{
+  if (!myNodes.empty())
+  {
+    return true;
+  }
+  if (myBuilder.IsNull()
+  || !myBuilder->IsReady)
+  {
+    return false;
+  }
+
+  myNodes.swap(myBuilder->Nodes);
+  myNodeSlots.assign(myNodes.size(), -1);
+  if (theCtx != nullptr
+  && !theCtx->Caps()->suppressExtraMsg)
+  {
+    theCtx->Messenger()->SendInfo() << "Metal_PointCloud: " << int(myBuilder->NbPoints) << " points sorted into "
+                                    << int(myNodes.size()) << " octree nodes";
+  }
+  return true;
+}
+
+// =======================================================================
+// function : findSlot
+// purpose  : Find slot for node upload
+// =======================================================================
+int Metal_PointCloud::findSlot(uint64_t theFrame, int theNbFramesInFlight) const
+{
+  int aBestSlot = -1;
+  for (int aSlotIter = 0; aSlotIter < myNbSlots; ++aSlotIter)
+  {
+    if (mySlotNodes[aSlotIter] == -1)
+    {
+      return aSlotIter;
+    }
+    // slot might be still read by one of the frames in flight
+    if (mySlotFrames[aSlotIter] + uint64_t(theNbFramesInFlight) >= theFrame)
+    {
+      continue;
+    }
+    if (aBestSlot == -1
+     || mySlotFrames[aSlotIter] < mySlotFrames[aBestSlot])
+    {
+      aBestSlot = aSlotIter;
+    }
+  }
+  return aBestSlot;
+}
+
+// =======================================================================
+// function : uploadNode
+// purpose  : Copy points of the node into the slot
+// =======================================================================
+void Metal_PointCloud::uploadNode(int theNode, int theSlot)
+{
+  if (mySlotNodes[theSlot] != -1)
+  {
+    myNodeSlots[mySlotNodes[theSlot]] = -1;
+  }
+  mySlotNodes[theSlot] = theNode;
+  myNodeSlots[theNode] = theSlot;
+
+  const Node& aNode = myNodes[theNode];
+  const Metal_PointCloudBuilder& aBuilder = *myBuilder;
+  Metal_CloudPoint* aDst = static_cast<Metal_CloudPoint*>([myPoints contents]) + size_t(theSlot) * NodeCapacity;
+  for (uint32_t aPntIter = 0; aPntIter < aNode.NbPoints; ++aPntIter)
+  {
+    const uint32_t aPntIndex = aBuilder.Order[aNode.FirstPoint + aPntIter];
+    const Graphic3d_Vec3& aPos = aBuilder.Position(aPntIndex);
+    aDst[aPntIter].Position[0] = aPos.x();
+    aDst[aPntIter].Position[1] = aPos.y();
+    aDst[aPntIter].Position[2] = aPos.z();
+    aDst[aPntIter].Color = aBuilder.ColorData != nullptr ? aBuilder.Color(aPntIndex) : 0;
+  }
+}
+
+// =======================================================================
+// function : Render
+// purpose  : Select, stream and draw octree nodes
+// =======================================================================
+void Metal_PointCloud::Render(Metal_Workspace* theWorkspace)
+{
+  myNbDrawnPoints = 0;
+  Metal_Context* aCtx = theWorkspace != nullptr ? theWorkspace->Context() : nullptr;
+  Metal_View* aView = theWorkspace != nullptr ? theWorkspace->View() : nullptr;
+  if (aCtx == nullptr
+   || myPoints == nil
+   || !fetchOctree(aCtx))
+  {
+    if (aView != nullptr)
+    {
+      aView->InvalidateStreaming();
+    }
+    return;
+  }
+
+  const NCollection_Mat4<float> aMVP = theWorkspace->ProjectionMatrix() * theWorkspace->ModelMatrix();
+  const int* aViewport = aCtx->Viewport();
+  const float aHalfWidth  = 0.5f * float(std::max(aViewport[2], 1));
+  const float aHalfHeight = 0.5f * float(std::max(aViewport[3], 1));
+  const Graphic3d_Vec3 aRowX(aMVP(0, 0), aMVP(0, 1), aMVP(0, 2));
+  const Graphic3d_Vec3 aRowY(aMVP(1, 0), aMVP(1, 1), aMVP(1, 2));
+  const Graphic3d_Vec3 aRowW(aMVP(3, 0), aMVP(3, 1), aMVP(3, 2));
+  // pixels per model unit at unit clip-space W
+  const float aPixelScale = std::max(aRowX.Modulus() * aHalfWidth, aRowY.Modulus() * aHalfHeight);
+  const float aMaxError = std::max(aCtx->Caps()->pointCloudPixelError, 0.1f);
+
+  // returns projected spacing of node points in pixels, or negative value for node outside of view frustum
+  const auto projectNode = [&](const Node& theNode) -> float
+  {
+    int anOutside[6] = {};
+    for (int aCorner = 0; aCorner < 8; ++aCorner)
+    {
+      const NCollection_Vec4<float> aClip = aMVP * NCollection_Vec4<float>((aCorner & 1) != 0 ? theNode.BoxMax[0] : theNode.BoxMin[0],
+                                                                           (aCorner & 2) != 0 ? theNode.BoxMax[1] : theNode.BoxMin[1],
+                                                                           (aCorner & 4) != 0 ? theNode.BoxMax[2] : theNode.BoxMin[2],
+                                                                           1.0f);
+      anOutside[0] += aClip.x() < -aClip.w() ? 1 : 0;
+      anOutside[1] += aClip.x() >  aClip.w() ? 1 : 0;
+      anOutside[2] += aClip.y() < -aClip.w() ? 1 : 0;
+      anOutside[3] += aClip.y() >  aClip.w() ? 1 : 0;
+      anOutside[4] += aClip.w() <= 0.0f      ? 1 : 0;
+      anOutside[5] += aClip.z() >  aClip.w() ? 1 : 0;
+    }
+    for (int aPlane = 0; aPlane < 6; ++aPlane)
+    {
+      if (anOutside[aPlane] == 8)
+      {
+        return -1.0f;
+      }
+    }
+
+    // the nearest W within bounding sphere of the node
+    const Graphic3d_Vec3 aCenter((theNode.BoxMin[0] + theNode.BoxMax[0]) * 0.5f,
+                                 (theNode.BoxMin[1] + theNode.BoxMax[1]) * 0.5f,
+                                 (theNode.BoxMin[2] + theNode.BoxMax[2]) * 0.5f);
+    const float aRadius = (theNode.BoxMax[0] - theNode.BoxMin[0]) * 0.8660254f;
+    const float aMinW = aRowW.Dot(aCenter) + aMVP(3, 3) - aRadius * aRowW.Modulus();
+    return theNode.Spacing * aPixelScale / std::max(aMinW, 1.0e-6f);
+  };
+
+  // top-down selection - points of a node complement points of its ancestors,
+  // so that all traversed nodes are drawn and missing children leave only coarser points
+  std::vector<int> aSelected;
+  std::priority_queue<std::pair<float, int>> aQueue;
+  const float aRootError = projectNode(myNodes[0]);
+  if (aRootError >= 0.0f)
+  {
+    aQueue.push(std::make_pair(aRootError, 0));
+  }
+  while (!aQueue.empty()
+      && (int)aSelected.size() < myNbSlots)
+  {
+    const std::pair<float, int> aTop = aQueue.top();
+    aQueue.pop();
+    aSelected.push_back(aTop.second);
+    if (aTop.first <= aMaxError)
+    {
+      continue;
+    }
+    for (int aChildIter = 0; aChildIter < 8; ++aChildIter)
+    {
+      const int32_t aChild = myNodes[aTop.second].Children[aChildIter];
+      if (aChild == -1)
+      {
+        continue;
+      }
+      const float aChildError = projectNode(myNodes[aChild]);
+      if (aChildError >= 0.0f)
+      {
+        aQueue.push(std::make_pair(aChildError, aChild));
+      }
+    }
+  }
+
+  // reserve slots of resident nodes first, so that uploads do not evict them
+  const uint64_t aFrame = aCtx->FrameNumber();
+  const int aNbFramesInFlight = std::max(aCtx->Caps()->maxFramesInFlight, 1);
+  for (int aNode : aSelected)
+  {
+    if (myNodeSlots[aNode] != -1)
+    {
+      mySlotFrames[myNodeSlots[aNode]] = aFrame;
+    }
+  }
+  int aNbUploads = 0;
+  myNbMissingNodes = 0;
+  for (int aNode : aSelected)
+  {
+    if (myNodeSlots[aNode] != -1)
+    {
+      continue;
+    }
+    const int aSlot = aNbUploads < MaxUploadsPerFrame ? findSlot(aFrame, aNbFramesInFlight) : -1;
+    if (aSlot == -1)
+    {
+      ++myNbMissingNodes;
+      continue;
+    }
+    uploadNode(aNode, aSlot);
+    mySlotFrames[aSlot] = aFrame;
+    ++aNbUploads;
+  }
+  if (myNbMissingNodes > 0 && aView != nullptr)
+  {
+    aView->InvalidateStreaming();
+  }
+
+  // merge draws of consecutive slots, as long as preceding slot is full
+  std::vector<int> aSlots;
+  aSlots.reserve(aSelected.size());
+  for (int aNode : aSelected)
+  {
+    if (myNodeSlots[aNode] != -1)
+    {
+      aSlots.push_back(myNodeSlots[aNode]);
+    }
+  }
+  std::sort(aSlots.begin(), aSlots.end());
+  std::vector<uint32_t> aRanges;
+  for (int aSlot : aSlots)
+  {
+    const uint32_t aFirst = uint32_t(aSlot) * uint32_t(NodeCapacity);
+    const uint32_t aCount = myNodes[mySlotNodes[aSlot]].NbPoints;
+    if (!aRanges.empty()
+     && aRanges[aRanges.size() - 2] + aRanges[aRanges.size() - 1] == aFirst)
+    {
+      aRanges[aRanges.size() - 1] += aCount;
+    }
+    else
+    {
+      aRanges.push_back(aFirst);
+      aRanges.push_back(aCount);
+    }
+    myNbDrawnPoints += aCount;
+  }
+  if (aRanges.empty())
+  {
+    return;
+  }
+
+  Quantity_ColorRGBA aColor(1.0f, 1.0f, 1.0f, 1.0f);
+  if (!theWorkspace->Aspect().IsNull())
+  {
+    aColor = theWorkspace->IsHighlighting() ? theWorkspace->HighlightColor() : theWorkspace->Aspect()->ColorRGBA();
+  }
+  const bool hasColors = myBuilder->ColorData != nullptr && !theWorkspace->IsHighlighting();
+
+  const occ::handle<Metal_PointCloudRaster>& aRaster = aView != nullptr ? aView->PointCloudRaster() : occ::handle<Metal_PointCloudRaster>();
+  if (!aRaster.IsNull())
+  {
+    aRaster->Enqueue(myPoints, aMVP, aColor, hasColors, aRanges);
+    return;
+  }
+
+  id<MTLRenderCommandEncoder> anEncoder = theWorkspace->ActiveEncoder();
+  if (anEncoder == nil
+  || !theWorkspace->ApplyPointCloudPipelineState())
+  {
+    return;
+  }
+
+  Metal_PointCloudParams aParams = {};
+  aParams.PointSize = !theWorkspace->Aspect().IsNull() ? std::max(theWorkspace->Aspect()->MarkerScale(), 1.0f) : 1.0f;
+  aParams.HasColors = hasColors ? 1 : 0;
+  [anEncoder setVertexBuffer:myPoints offset:0 atIndex:0];
+  [anEncoder setVertexBytes:&aParams length:sizeof(aParams) atIndex:11];
+  for (size_t aRangeIter = 0; aRangeIter < aRanges.size(); aRangeIter += 2)
+  {
+    [anEncoder drawPrimitives:MTLPrimitiveTypePoint
+                  vertexStart:aRanges[aRangeIter]
+                  vertexCount:aRanges[aRangeIter + 1]];
+  }
+  theWorkspace->RestorePipelineState();
+}
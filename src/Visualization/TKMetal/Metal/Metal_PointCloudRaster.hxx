@@ -0,0 +1,130 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef Metal_PointCloudRaster_HeaderFile
+#define Metal_PointCloudRaster_HeaderFile
+
+#include <NCollection_Mat4.hxx>
+#include <Quantity_ColorRGBA.hxx>
+#include <Standard_Transient.hxx>
+#include <Standard_Type.hxx>
+
+#include <mutex>
+#include <vector>
+
+#ifdef __OBJC__
+@protocol MTLBuffer;
+@protocol MTLCommandBuffer;
+@protocol MTLComputePipelineState;
+@protocol MTLDepthStencilState;
+@protocol MTLRenderPipelineState;
+@protocol MTLTexture;
+#endif
+
+class Metal_Context;
+
+//! Compute rasterizer of level of detail point clouds (see Metal_Caps::usePointCloudCompute).
+//! Metal_PointCloud queues ranges of its resident points while the main pass is encoded;
+//! after the main pass a compute kernel projects queued points and keeps the nearest one per pixel
+//! by 64-bit atomic minimum of packed depth and color, and a full-screen pass writes the result
+//! into color and depth of the main pass with depth test.
+//! Compared to point primitives, this avoids rasterizer overhead of millions of one pixel points.
+class Metal_PointCloudRaster : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(Metal_PointCloudRaster, Standard_Transient)
+public:
+
+  //! Return TRUE if device supports 64-bit atomic minimum (Apple8 GPU family).
+  Standard_EXPORT static bool IsSupported(const Metal_Context* theCtx);
+
+public:
+
+  //! Empty constructor.
+  Standard_EXPORT Metal_PointCloudRaster();
+
+  //! Destructor.
+  Standard_EXPORT ~Metal_PointCloudRaster() override;
+
+  //! Release GPU resources.
+  Standard_EXPORT void Release(Metal_Context* theCtx);
+
+  //! Return TRUE if points have been queued since the last Render().
+  Standard_EXPORT bool HasQueuedPoints() const;
+
+#ifdef __OBJC__
+  //! Queue ranges of points for rasterization by the current frame.
+  //! Thread-safe (can be called by workspaces of parallel encoding).
+  //! @param thePoints  buffer of points in Metal_PointCloud layout
+  //! @param theMVP     model-view-projection matrix
+  //! @param theColor   color of points without own colors
+  //! @param theHasColors flag indicating that points define own colors
+  //! @param theRanges  pairs of first point and number of points
+  Standard_EXPORT void Enqueue(id<MTLBuffer> thePoints,
+                               const NCollection_Mat4<float>& theMVP,
+                               const Quantity_ColorRGBA& theColor,
+                               bool theHasColors,
+                               const std::vector<uint32_t>& theRanges);
+
+  //! Rasterize queued points over the target and clear the queue.
+  //! @param theCtx    Metal context
+  //! @param theCmdBuf command buffer of the frame
+  //! @param theTarget color target of the main pass
+  //! @param theDepth  stored depth of the main pass (Depth32Float)
+  Standard_EXPORT void Render(Metal_Context* theCtx,
+                              id<MTLCommandBuffer> theCmdBuf,
+                              id<MTLTexture> theTarget,
+                              id<MTLTexture> theDepth);
+#endif
+
+protected:
+
+  //! Create pipelines for the color format of the target.
+  bool init(Metal_Context* theCtx, unsigned long theColorFormat);
+
+protected:
+
+  //! Points range queued by Metal_PointCloud.
+  struct Batch
+  {
+#ifdef __OBJC__
+    id<MTLBuffer>         Points;    //!< points buffer
+#else
+    void*                 Points;
+#endif
+    float                 MVP[16];   //!< model-view-projection matrix
+    float                 Color[4];  //!< color of points without own colors
+    uint32_t              HasColors; //!< points define own colors
+    std::vector<uint32_t> Ranges;    //!< pairs of first point and number of points
+  };
+
+protected:
+
+#ifdef __OBJC__
+  id<MTLComputePipelineState> myRasterPipeline;  //!< kernel of point projection
+  id<MTLRenderPipelineState>  myResolvePipeline; //!< full-screen pass writing nearest points
+  id<MTLDepthStencilState>    myResolveDepth;    //!< depth test of resolved points
+  id<MTLBuffer>               myPixels;          //!< packed depth and color per pixel
+#else
+  void* myRasterPipeline;
+  void* myResolvePipeline;
+  void* myResolveDepth;
+  void* myPixels;
+#endif
+  unsigned long      myColorFormat; //!< color format of resolve pipeline
+  int                mySizeX;       //!< width of pixels buffer
+  int                mySizeY;       //!< height of pixels buffer
+  mutable std::mutex myMutex;       //!< lock of queued batches
+  std::vector<Batch> myBatches;     //!< batches queued for the current frame
+};
+
+#endif // Metal_PointCloudRaster_HeaderFile
@@ -0,0 +1,354 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#import <Metal/Metal.h>
+
+#include <Metal_PointCloudRaster.hxx>
+#include <Metal_Context.hxx>
+
+#include <cstring>
+
+IMPLEMENT_STANDARD_RTTIEXT(Metal_PointCloudRaster, Standard_Transient)
+
+namespace
+{
+  //! Parameters of rasterization kernel (should match RasterParams in THE_POINT_RASTER_SHADER).
+  struct Metal_PointRasterParams
+  {
+    float    MVP[16];
+    float    Color[4];
+    uint32_t HasColors;
+    uint32_t Width;
+    uint32_t Height;
+    uint32_t First;
+    uint32_t Count;
+    uint32_t Padding[3];
+  };
+
+  //! Value of pixels without points.
+  static const uint8_t THE_EMPTY_PIXEL = 0xFF;
+
+  //! Number of threads within rasterization threadgroup.
+  static const NSUInteger THE_RASTER_GROUP_SIZE = 256;
+
+  //! MSL source of point rasterization kernel and resolve pass; requires MSL 3.0 for 64-bit atomics.
+  static const char* THE_POINT_RASTER_SHADER = R"(
+#include <metal_stdlib>
+using namespace metal;
+
+// should match Metal_CloudPoint in Metal_PointCloud
+struct CloudPoint {
+  packed_float3 position;
+  uint color;
+};
+
+struct RasterParams {
+  float4x4 mvp;
+  float4 color;
+  uint hasColors;
+  uint width;
+  uint height;
+  uint first;
+  uint count;
+};
+
+// nearest point wins: depth in high bits (positive floats keep their order as integers), RGBA8 color in low bits
+kernel void kernel_point_raster(const device CloudPoint* points [[buffer(0)]],
+                                device atomic_ulong* pixels     [[buffer(1)]],
+                                constant RasterParams& params   [[buffer(2)]],
+                                uint tid [[thread_position_in_grid]])
+{
+  if (tid >= params.count) return;
+
+  const CloudPoint pnt = points[params.first + tid];
+  const float4 clip = params.mvp * float4(float3(pnt.position), 1.0);
+  if (clip.w <= 0.0) return;
+
+  const float3 ndc = clip.xyz / clip.w;
+  if (abs(ndc.x) > 1.0 || abs(ndc.y) > 1.0 || ndc.z < 0.0 || ndc.z > 1.0) return;
+
+  const uint x = min(uint((ndc.x * 0.5 + 0.5) * float(params.width)),  params.width  - 1);
+  const uint y = min(uint((0.5 - ndc.y * 0.5) * float(params.height)), params.height - 1);
+  const uint color = params.hasColors != 0 ? pnt.color : pack_float_to_unorm4x8(params.color);
+  const ulong value = (ulong(as_type<uint>(ndc.z)) << 32) | ulong(color);
+  atomic_min_explicit(&pixels[y * params.width + x], value, memory_order_relaxed);
+}
+
+struct ResolveOut {
+  float4 color [[color(0)]];
+  float depth  [[depth(any)]];
+};
+
+vertex float4 vertex_point_resolve(uint vid [[vertex_id]])
+{
+  const float2 uv = float2((vid << 1) & 2, vid & 2);
+  return float4(uv * 2.0 - 1.0, 0.0, 1.0);
+}
+
+fragment ResolveOut fragment_point_resolve(float4 pos [[position]],
+                                           const device ulong* pixels [[buffer(0)]],
+                                           constant uint& width       [[buffer(1)]])
+{
+  const ulong value = pixels[uint(pos.y) * width + uint(pos.x)];
+  if (value == 0xFFFFFFFFFFFFFFFFul) discard_fragment();
+
+  ResolveOut out;
+  out.color = unpack_unorm4x8_to_float(uint(value & 0xFFFFFFFFul));
+  out.depth = as_type<float>(uint(value >> 32));
+  return out;
+}
+)";
+}
+
+// =======================================================================
+// function : IsSupported
+// purpose  : Check 64-bit atomics support
+// =======================================================================
+bool Metal_PointCloudRaster::IsSupported(const Metal_Context* theCtx)
+{
+  if (theCtx == nullptr || theCtx->Device() == nil)
+  {
+    return false;
+  }
+  if (@available(macOS 13.0, iOS 16.0, *))
+  {
+    return [theCtx->Device() supportsFamily:MTLGPUFamilyApple8];
+  }
+  return false;
+}
+
+// =======================================================================
+// function : Metal_PointCloudRaster
+// purpose  : Constructor
+// =======================================================================
+Metal_PointCloudRaster::Metal_PointCloudRaster()
+: myRasterPipeline(nil),
+  myResolvePipeline(nil),
+  myResolveDepth(nil),
+  myPixels(nil),
+  myColorFormat(0),
+  mySizeX(0),
+  mySizeY(0)
+{
+  //
+}
+
+// =======================================================================
+// function : ~Metal_PointCloudRaster
+// purpose  : Destructor
+// =======================================================================
+Metal_PointCloudRaster::~Metal_PointCloudRaster()
+{
+  Release(nullptr);
+}
+
+// =======================================================================
+// function : Release
+// purpose  : Release GPU resources
+// =======================================================================
+void Metal_PointCloudRaster::Release(Metal_Context* )
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  myBatches.clear();
+  myRasterPipeline  = nil;
+  myResolvePipeline = nil;
+  myResolveDepth    = nil;
+  myPixels          = nil;
+  myColorFormat = 0;
+  mySizeX = 0;
+  mySizeY = 0;
+}
+
+// =======================================================================
+// function : HasQueuedPoints
+// purpose  : Return TRUE if points have been queued
+// =======================================================================
+bool Metal_PointCloudRaster::HasQueuedPoints() const
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  return !myBatches.empty();
+}
+
+// =======================================================================
+// function : Enqueue
+// purpose  : Queue ranges of points for rasterization
+// =======================================================================
+void Metal_PointCloudRaster::Enqueue(id<MTLBuffer> thePoints,
+                                     const NCollection_Mat4<float>& theMVP,
+                                     const Quantity_ColorRGBA& theColor,
+                                     bool theHasColors,
+                                     const std::vector<uint32_t>& theRanges)
+{
+  Batch aBatch;
+  aBatch.Points = thePoints;
+  memcpy(aBatch.MVP, theMVP.GetData(), sizeof(aBatch.MVP));
+  aBatch.Color[0] = theColor.GetRGB().Red();
+  aBatch.Color[1] = theColor.GetRGB().Green();
+  aBatch.Color[2] = theColor.GetRGB().Blue();
+  aBatch.Color[3] = theColor.Alpha();
+  aBatch.HasColors = theHasColors ? 1 : 0;
+  aBatch.Ranges = theRanges;
+
+  std::lock_guard<std::mutex> aLock(myMutex);
+  myBatches.push_back(std::move(aBatch));
+}
+
+// =======================================================================
+// function : init
+// purpose  : Create pipelines
+// =======================================================================
+bool Metal_PointCloudRaster::init(Metal_Context* theCtx, unsigned long theColorFormat)
+{
+  if (myRasterPipeline != nil && myResolvePipeline != nil && myColorFormat == theColorFormat)
+  {
+    return true;
+  }
+  if (theCtx == nullptr || !theCtx->IsValid())
+  {
+    return false;
+  }
+
+  if (@available(macOS 13.0, iOS 16.0, *))
+  {
+    MTLCompileOptions* anOptions = [[MTLCompileOptions alloc] init];
+    anOptions.languageVersion = MTLLanguageVersion3_0;
+    NSError* anError = nil;
+    id<MTLLibrary> aLibrary = theCtx->LoadShaderLibrary("Metal_PointCloudRaster_THE_POINT_RASTER_SHADER",
+                                                        [NSString stringWithUTF8String:THE_POINT_RASTER_SHADER],
+                                                        anOptions, &anError);
+    if (aLibrary == nil)
+    {
+      theCtx->Messenger()->SendFail() << "Metal_PointCloudRaster: failed to compile point rasterization shaders: "
+                                      << (anError != nil ? [[anError localizedDescription] UTF8String] : "");
+      return false;
+    }
+
+    id<MTLDevice> aDevice = theCtx->Device();
+    if (myRasterPipeline == nil)
+    {
+      myRasterPipeline = [aDevice newComputePipelineStateWithFunction:[aLibrary newFunctionWithName:@"kernel_point_raster"]
+                                                                error:&anError];
+      if (myRasterPipeline == nil)
+      {
+        theCtx->Messenger()->SendFail() << "Metal_PointCloudRaster: failed to create rasterization pipeline: "
+                                        << (anError != nil ? [[anError localizedDescription] UTF8String] : "");
+        return false;
+      }
+
+      MTLDepthStencilDescriptor* aDepthDesc = [[MTLDepthStencilDescriptor alloc] init];
+      aDepthDesc.depthCompareFunction = MTLCompareFunctionLessEqual;
+      aDepthDesc.depthWriteEnabled = YES;
+      myResolveDepth = [aDevice newDepthStencilStateWithDescriptor:aDepthDesc];
+    }
+
+    MTLRenderPipelineDescriptor* aResolveDesc = [[MTLRenderPipelineDescriptor alloc] init];
+    aResolveDesc.label = @"PointCloudResolve";
+    aResolveDesc.vertexFunction   = [aLibrary newFunctionWithName:@"vertex_point_resolve"];
+    aResolveDesc.fragmentFunction = [aLibrary newFunctionWithName:@"fragment_point_resolve"];
+    aResolveDesc.colorAttachments[0].pixelFormat = (MTLPixelFormat)theColorFormat;
+    aResolveDesc.depthAttachmentPixelFormat = MTLPixelFormatDepth32Float;
+    myResolvePipeline = [aDevice newRenderPipelineStateWithDescriptor:aResolveDesc error:&anError];
+    myColorFormat = theColorFormat;
+    if (myResolvePipeline == nil)
+    {
+      theCtx->Messenger()->SendFail() << "Metal_PointCloudRaster: failed to create resolve pipeline: "
+                                      << (anError != nil ? [[anError localizedDescription] UTF8String] : "");
+      return false;
+    }
+    return myResolveDepth != nil;
+  }
+  return false;
+}
+
+// =======================================================================
+// function : Render
+// purpose  : Rasterize queued points over the target
+// =======================================================================
+void Metal_PointCloudRaster::Render(Metal_Context* theCtx,
+                                    id<MTLCommandBuffer> theCmdBuf,
+                                    id<MTLTexture> theTarget,
+                                    id<MTLTexture> theDepth)
+{
+  std::vector<Batch> aBatches;
+  {
+    std::lock_guard<std::mutex> aLock(myMutex);
+    aBatches.swap(myBatches);
+  }
+  if (aBatches.empty()
+   || theCmdBuf == nil || theTarget == nil || theDepth == nil
+   || !init(theCtx, (unsigned long)theTarget.pixelFormat))
+  {
+    return;
+  }
+
+  const int aSizeX = (int)theTarget.width;
+  const int aSizeY = (int)theTarget.height;
+  if (myPixels == nil || mySizeX != aSizeX || mySizeY != aSizeY)
+  {
+    myPixels = [theCtx->Device() newBufferWithLength:size_t(aSizeX) * size_t(aSizeY) * sizeof(uint64_t)
+                                             options:MTLResourceStorageModePrivate];
+    mySizeX = aSizeX;
+    mySizeY = aSizeY;
+    if (myPixels == nil)
+    {
+      return;
+    }
+    myPixels.label = @"PointCloudPixels";
+  }
+
+  id<MTLBlitCommandEncoder> aBlit = [theCmdBuf blitCommandEncoder];
+  aBlit.label = @"PointCloudClear";
+  [aBlit fillBuffer:myPixels range:NSMakeRange(0, myPixels.length) value:THE_EMPTY_PIXEL];
+  [aBlit endEncoding];
+
+  id<MTLComputeCommandEncoder> aCompute = [theCmdBuf computeCommandEncoder];
+  aCompute.label = @"PointCloudRaster";
+  [aCompute setComputePipelineState:myRasterPipeline];
+  [aCompute setBuffer:myPixels offset:0 atIndex:1];
+  for (const Batch& aBatch : aBatches)
+  {
+    Metal_PointRasterParams aParams = {};
+    memcpy(aParams.MVP,   aBatch.MVP,   sizeof(aParams.MVP));
+    memcpy(aParams.Color, aBatch.Color, sizeof(aParams.Color));
+    aParams.HasColors = aBatch.HasColors;
+    aParams.Width  = uint32_t(aSizeX);
+    aParams.Height = uint32_t(aSizeY);
+    [aCompute setBuffer:aBatch.Points offset:0 atIndex:0];
+    for (size_t aRangeIter = 0; aRangeIter + 1 < aBatch.Ranges.size(); aRangeIter += 2)
+    {
+      aParams.First = aBatch.Ranges[aRangeIter];
+      aParams.Count = aBatch.Ranges[aRangeIter + 1];
+      [aCompute setBytes:&aParams length:sizeof(aParams) atIndex:2];
+      [aCompute dispatchThreads:MTLSizeMake(aParams.Count, 1, 1)
+          threadsPerThreadgroup:MTLSizeMake(THE_RASTER_GROUP_SIZE, 1, 1)];
+    }
+  }
+  [aCompute endEncoding];
+
+  MTLRenderPassDescriptor* aPassDesc = [MTLRenderPassDescriptor renderPassDescriptor];
+  aPassDesc.colorAttachments[0].texture     = theTarget;
+  aPassDesc.colorAttachments[0].loadAction  = MTLLoadActionLoad;
+  aPassDesc.colorAttachments[0].storeAction = MTLStoreActionStore;
+  aPassDesc.depthAttachment.texture     = theDepth;
+  aPassDesc.depthAttachment.loadAction  = MTLLoadActionLoad;
+  aPassDesc.depthAttachment.storeAction = MTLStoreActionStore;
+  id<MTLRenderCommandEncoder> anEncoder = [theCmdBuf renderCommandEncoderWithDescriptor:aPassDesc];
+  anEncoder.label = @"PointCloudResolve";
+  const uint32_t aWidth = uint32_t(aSizeX);
+  [anEncoder setRenderPipelineState:myResolvePipeline];
+  [anEncoder setDepthStencilState:myResolveDepth];
+  [anEncoder setFragmentBuffer:myPixels offset:0 atIndex:0];
+  [anEncoder setFragmentBytes:&aWidth length:sizeof(aWidth) atIndex:1];
+  [anEncoder drawPrimitives:MTLPrimitiveTypeTriangle vertexStart:0 vertexCount:3];
+  [anEncoder endEncoding];
+}
@@ -74,6 +74,8 @@ struct Metal_PostProcessParams
 //! Metal post-processing effect manager.
 //! Provides FXAA anti-aliasing, tone mapping, gamma correction,
 //! and other image-space effects.
+//! Any combination of effects is applied by a single full-screen pass
+//! with fragment shader specialized by function constants for the active effect bitmask.
 class Metal_PostProcess : public Standard_Transient
 {
   DEFINE_STANDARD_RTTIEXT(Metal_PostProcess, Standard_Transient)
@@ -148,20 +150,40 @@ public:
                                         id<MTLTexture> theTarget);
 #endif
 
+private:
+
+  //! Number of fused pipeline specializations (4 effect bits and filmic tone mapping bit).
+  static const int NbFusedPipelines = 32;
+
+  //! Return fused pipeline key for effects bitmask and current tone mapping method.
+  int fusedKey(int theEffects) const;
+
+#ifdef __OBJC__
+  //! Return pipeline of fused fragment shader specialized by function constants for the key, created on first use.
+  id<MTLRenderPipelineState> fusedPipeline(id<MTLDevice> theDevice, int theKey);
+
+  //! Encode single full-screen pass applying all specified effects,
+  //! so that source is read and target is written once without intermediate textures.
+  void encodeFused(Metal_Context* theCtx,
+                   id<MTLCommandBuffer> theCommandBuffer,
+                   id<MTLTexture> theSource,
+                   id<MTLTexture> theTarget,
+                   int theEffects,
+                   NSString* theLabel);
+#endif
+
 private:
 
 #ifdef __OBJC__
   id<MTLLibrary>             myLibrary;
   id<MTLSamplerState>        mySampler;
-  id<MTLRenderPipelineState> myFXAAPipeline;
-  id<MTLRenderPipelineState> myToneMappingPipeline;
-  id<MTLRenderPipelineState> myCombinedPipeline;
+  id<MTLFunction>            myVertexFunction;
+  id<MTLRenderPipelineState> myFusedPipelines[NbFusedPipelines]; //!< fused pipelines by effect key
 #else
   void* myLibrary;
   void* mySampler;
-  void* myFXAAPipeline;
-  void* myToneMappingPipeline;
-  void* myCombinedPipeline;
+  void* myVertexFunction;
+  void* myFusedPipelines[NbFusedPipelines];
 #endif
 
   Metal_PostProcessParams myParams;
@@ -213,79 +213,37 @@ float3 applyGamma(float3 color, float gamma) {
 }
 
 //==============================================================================
-// Combined Post-Processing Fragment Shader
+// Fused Post-Processing Fragment Shader
 //==============================================================================
 
-fragment float4 postProcessCombined(
+// Active effects, specialized per effect bitmask (see Metal_PostProcess::fusedPipeline())
+constant bool FUSED_FXAA        [[function_constant(0)]];
+constant bool FUSED_TONEMAPPING [[function_constant(1)]];
+constant bool FUSED_VIGNETTE    [[function_constant(2)]];
+constant bool FUSED_GAMMA       [[function_constant(3)]];
+constant bool FUSED_FILMIC      [[function_constant(4)]];
+
+// Applies all active effects while reading source and writing target once
+fragment float4 postProcessFused(
   VertexOut in [[stage_in]],
   texture2d<float> sourceTexture [[texture(0)]],
   sampler texSampler [[sampler(0)]],
   constant PostProcessParams& params [[buffer(0)]]
 ) {
   float2 uv = in.texCoord;
-  float3 color;
-
-  // Apply FXAA if enabled
-  if (params.effects & EFFECT_FXAA) {
-    color = applyFXAA(sourceTexture, texSampler, uv, params.texelSize, params.fxaaQuality);
-  } else {
-    color = sourceTexture.sample(texSampler, uv).rgb;
-  }
-
-  // Apply tone mapping if enabled
-  if (params.effects & EFFECT_TONEMAPPING) {
-    if (params.toneMappingMethod == 1) {
-      color = filmicToneMapping(color, params.exposure, params.whitePoint);
-    } else {
-      color = reinhardToneMapping(color, params.exposure);
-    }
+  float3 color = FUSED_FXAA
+               ? applyFXAA(sourceTexture, texSampler, uv, params.texelSize, params.fxaaQuality)
+               : sourceTexture.sample(texSampler, uv).rgb;
+
+  if (FUSED_TONEMAPPING) {
+    color = FUSED_FILMIC
+          ? filmicToneMapping(color, params.exposure, params.whitePoint)
+          : reinhardToneMapping(color, params.exposure);
   }
-
-  // Apply vignette if enabled
-  if (params.effects & EFFECT_VIGNETTE) {
+  if (FUSED_VIGNETTE) {
     color = applyVignette(color, uv, params.vignetteIntensity, params.vignetteRadius);
   }
-
-  // Apply gamma correction if enabled
-  if (params.effects & EFFECT_GAMMA) {
-    color = applyGamma(color, params.gamma);
-  }
-
-  return float4(color, 1.0);
-}
-
-//==============================================================================
-// Individual Effect Fragment Shaders (for separate passes)
-//==============================================================================
-
-// FXAA only
-fragment float4 postProcessFXAA(
-  VertexOut in [[stage_in]],
-  texture2d<float> sourceTexture [[texture(0)]],
-  sampler texSampler [[sampler(0)]],
-  constant PostProcessParams& params [[buffer(0)]]
-) {
-  float3 color = applyFXAA(sourceTexture, texSampler, in.texCoord, params.texelSize, params.fxaaQuality);
-  return float4(color, 1.0);
-}
-
-// Tone mapping only
-fragment float4 postProcessToneMapping(
-  VertexOut in [[stage_in]],
-  texture2d<float> sourceTexture [[texture(0)]],
-  sampler texSampler [[sampler(0)]],
-  constant PostProcessParams& params [[buffer(0)]]
-) {
-  float3 color = sourceTexture.sample(texSampler, in.texCoord).rgb;
-
-  if (params.toneMappingMethod == 1) {
-    color = filmicToneMapping(color, params.exposure, params.whitePoint);
-  } else {
-    color = reinhardToneMapping(color, params.exposure);
-  }
-
-  // Also apply gamma when tone mapping
-  if (params.effects & EFFECT_GAMMA) {
+  if (FUSED_GAMMA) {
     color = applyGamma(color, params.gamma);
   }
 
@@ -307,6 +265,9 @@ fragment float4 postProcessToneMapping(
     float texelSizeX;
     float texelSizeY;
   };
+
+  //! Bit of fused pipeline key selecting filmic tone mapping (next to Metal_PostProcessEffect bits).
+  static const int THE_FUSED_FILMIC_BIT = 16;
 }
 
 // =======================================================================
@@ -316,14 +277,15 @@ fragment float4 postProcessToneMapping(
 Metal_PostProcess::Metal_PostProcess()
 : myLibrary(nil),
   mySampler(nil),
-  myFXAAPipeline(nil),
-  myToneMappingPipeline(nil),
-  myCombinedPipeline(nil),
+  myVertexFunction(nil),
   myParams(),
   myEffects(0),
   myIsValid(false)
 {
-  //
+  for (int aKeyIter = 0; aKeyIter < NbFusedPipelines; ++aKeyIter)
+  {
+    myFusedPipelines[aKeyIter] = nil;
+  }
 }
 
 // =======================================================================
@@ -350,9 +312,9 @@ bool Metal_PostProcess::Init(Metal_Context* theCtx)
   NSError* error = nil;
 
   // Compile shader library
-  myLibrary = [device newLibraryWithSource:PostProcessShaderSource
-                                   options:nil
-                                     error:&error];
+  myLibrary = theCtx->LoadShaderLibrary("Metal_PostProcess_PostProcessShaderSource",
+                                        PostProcessShaderSource,
+                                        nil, &error);
   if (myLibrary == nil)
   {
     NSLog(@"Metal_PostProcess: Failed to compile shaders: %@", error);
@@ -367,58 +329,21 @@ bool Metal_PostProcess::Init(Metal_Context* theCtx)
   samplerDesc.tAddressMode = MTLSamplerAddressModeClampToEdge;
   mySampler = [device newSamplerStateWithDescriptor:samplerDesc];
 
-  // Get shader functions
-  id<MTLFunction> vertexFunc = [myLibrary newFunctionWithName:@"postProcessVertex"];
-  id<MTLFunction> fxaaFunc = [myLibrary newFunctionWithName:@"postProcessFXAA"];
-  id<MTLFunction> tonemapFunc = [myLibrary newFunctionWithName:@"postProcessToneMapping"];
-  id<MTLFunction> combinedFunc = [myLibrary newFunctionWithName:@"postProcessCombined"];
-
-  if (vertexFunc == nil || combinedFunc == nil)
+  myVertexFunction = [myLibrary newFunctionWithName:@"postProcessVertex"];
+  if (myVertexFunction == nil)
   {
     NSLog(@"Metal_PostProcess: Failed to get shader functions");
     return false;
   }
 
-  // Create pipeline descriptor
-  MTLRenderPipelineDescriptor* pipelineDesc = [[MTLRenderPipelineDescriptor alloc] init];
-  pipelineDesc.vertexFunction = vertexFunc;
-  pipelineDesc.colorAttachments[0].pixelFormat = MTLPixelFormatBGRA8Unorm;
-
-  // Create FXAA pipeline
-  if (fxaaFunc != nil)
-  {
-    pipelineDesc.fragmentFunction = fxaaFunc;
-    pipelineDesc.label = @"FXAA Pipeline";
-    myFXAAPipeline = [device newRenderPipelineStateWithDescriptor:pipelineDesc error:&error];
-    if (myFXAAPipeline == nil)
-    {
-      NSLog(@"Metal_PostProcess: Failed to create FXAA pipeline: %@", error);
-    }
-  }
-
-  // Create tone mapping pipeline
-  if (tonemapFunc != nil)
-  {
-    pipelineDesc.fragmentFunction = tonemapFunc;
-    pipelineDesc.label = @"Tone Mapping Pipeline";
-    myToneMappingPipeline = [device newRenderPipelineStateWithDescriptor:pipelineDesc error:&error];
-    if (myToneMappingPipeline == nil)
-    {
-      NSLog(@"Metal_PostProcess: Failed to create tone mapping pipeline: %@", error);
-    }
-  }
-
-  // Create combined pipeline
-  pipelineDesc.fragmentFunction = combinedFunc;
-  pipelineDesc.label = @"Combined Post-Process Pipeline";
-  myCombinedPipeline = [device newRenderPipelineStateWithDescriptor:pipelineDesc error:&error];
-  if (myCombinedPipeline == nil)
+  // Fused pipelines are specialized on first use of each effect combination;
+  // create the one for currently enabled effects right away
+  myIsValid = true;
+  if (myEffects != 0 && fusedPipeline(device, fusedKey(myEffects)) == nil)
   {
-    NSLog(@"Metal_PostProcess: Failed to create combined pipeline: %@", error);
+    myIsValid = false;
     return false;
   }
-
-  myIsValid = true;
   return true;
 }
 
@@ -431,32 +356,92 @@ void Metal_PostProcess::Release(Metal_Context* theCtx)
   (void)theCtx;
   myLibrary = nil;
   mySampler = nil;
-  myFXAAPipeline = nil;
-  myToneMappingPipeline = nil;
-  myCombinedPipeline = nil;
+  myVertexFunction = nil;
+  for (int aKeyIter = 0; aKeyIter < NbFusedPipelines; ++aKeyIter)
+  {
+    myFusedPipelines[aKeyIter] = nil;
+  }
   myIsValid = false;
 }
 
 // =======================================================================
-// function : Apply
-// purpose  : Apply post-processing effects
+// function : fusedKey
+// purpose  : Return fused pipeline key for effects bitmask
 // =======================================================================
-void Metal_PostProcess::Apply(Metal_Context* theCtx,
-                              id<MTLCommandBuffer> theCommandBuffer,
-                              id<MTLTexture> theSource,
-                              id<MTLTexture> theTarget)
+int Metal_PostProcess::fusedKey(int theEffects) const
 {
-  if (!myIsValid || theCommandBuffer == nil || theSource == nil || theTarget == nil)
+  int aKey = theEffects & (Metal_PostProcessEffect_FXAA
+                         | Metal_PostProcessEffect_ToneMapping
+                         | Metal_PostProcessEffect_Vignette
+                         | Metal_PostProcessEffect_GammaCorrection);
+  if ((aKey & Metal_PostProcessEffect_ToneMapping) != 0
+   && myParams.ToneMappingMethod == Graphic3d_ToneMappingMethod_Filmic)
   {
-    return;
+    aKey |= THE_FUSED_FILMIC_BIT;
   }
+  return aKey;
+}
 
-  // If no effects enabled, just blit
-  if (myEffects == 0)
+// =======================================================================
+// function : fusedPipeline
+// purpose  : Return pipeline specialized for the key
+// =======================================================================
+id<MTLRenderPipelineState> Metal_PostProcess::fusedPipeline(id<MTLDevice> theDevice, int theKey)
+{
+  if (myFusedPipelines[theKey] != nil)
+  {
+    return myFusedPipelines[theKey];
+  }
+
+  const bool toFxaa    = (theKey & Metal_PostProcessEffect_FXAA) != 0;
+  const bool toTonemap = (theKey & Metal_PostProcessEffect_ToneMapping) != 0;
+  const bool toVignette = (theKey & Metal_PostProcessEffect_Vignette) != 0;
+  const bool toGamma   = (theKey & Metal_PostProcessEffect_GammaCorrection) != 0;
+  const bool isFilmic  = (theKey & THE_FUSED_FILMIC_BIT) != 0;
+  MTLFunctionConstantValues* aConstants = [[MTLFunctionConstantValues alloc] init];
+  [aConstants setConstantValue:&toFxaa     type:MTLDataTypeBool atIndex:0];
+  [aConstants setConstantValue:&toTonemap  type:MTLDataTypeBool atIndex:1];
+  [aConstants setConstantValue:&toVignette type:MTLDataTypeBool atIndex:2];
+  [aConstants setConstantValue:&toGamma    type:MTLDataTypeBool atIndex:3];
+  [aConstants setConstantValue:&isFilmic   type:MTLDataTypeBool atIndex:4];
+
+  NSError* anError = nil;
+  id<MTLFunction> aFragmentFunc = [myLibrary newFunctionWithName:@"postProcessFused"
+                                                  constantValues:aConstants
+                                                           error:&anError];
+  if (aFragmentFunc == nil)
+  {
+    NSLog(@"Metal_PostProcess: Failed to specialize fused shader for effects %d: %@", theKey, anError);
+    return nil;
+  }
+
+  MTLRenderPipelineDescriptor* aPipelineDesc = [[MTLRenderPipelineDescriptor alloc] init];
+  aPipelineDesc.label = [NSString stringWithFormat:@"Fused Post-Process Pipeline %d", theKey];
+  aPipelineDesc.vertexFunction = myVertexFunction;
+  aPipelineDesc.fragmentFunction = aFragmentFunc;
+  aPipelineDesc.colorAttachments[0].pixelFormat = MTLPixelFormatBGRA8Unorm;
+  myFusedPipelines[theKey] = [theDevice newRenderPipelineStateWithDescriptor:aPipelineDesc error:&anError];
+  if (myFusedPipelines[theKey] == nil)
+  {
+    NSLog(@"Metal_PostProcess: Failed to create fused pipeline for effects %d: %@", theKey, anError);
+  }
+  return myFusedPipelines[theKey];
+}
+
+// =======================================================================
+// function : encodeFused
+// purpose  : Encode single full-screen pass applying effects
+// =======================================================================
+void Metal_PostProcess::encodeFused(Metal_Context* theCtx,
+                                    id<MTLCommandBuffer> theCommandBuffer,
+                                    id<MTLTexture> theSource,
+                                    id<MTLTexture> theTarget,
+                                    int theEffects,
+                                    NSString* theLabel)
+{
+  id<MTLRenderPipelineState> aPipeline = fusedPipeline(theCommandBuffer.device, fusedKey(theEffects));
+  if (aPipeline == nil)
   {
-    id<MTLBlitCommandEncoder> blit = [theCommandBuffer blitCommandEncoder];
-    [blit copyFromTexture:theSource toTexture:theTarget];
-    [blit endEncoding];
     return;
   }
 
@@ -465,6 +450,10 @@ void Metal_PostProcess::Apply(Metal_Context* theCtx,
   passDesc.colorAttachments[0].texture = theTarget;
   passDesc.colorAttachments[0].loadAction = MTLLoadActionDontCare;
   passDesc.colorAttachments[0].storeAction = MTLStoreActionStore;
+  if (theCtx != nullptr && !theCtx->GpuTimer().IsNull())
+  {
+    theCtx->GpuTimer()->AttachRenderPass(theCommandBuffer, passDesc, Graphic3d_FrameStatsTimer_GpuPostProcess);
+  }
 
   id<MTLRenderCommandEncoder> encoder = [theCommandBuffer renderCommandEncoderWithDescriptor:passDesc];
   if (encoder == nil)
@@ -472,11 +461,11 @@ void Metal_PostProcess::Apply(Metal_Context* theCtx,
     return;
   }
 
-  [encoder setLabel:@"Post-Processing"];
+  [encoder setLabel:theLabel];
 
   // Set up GPU parameters
   PostProcessGPUParams gpuParams;
-  gpuParams.effects = myEffects;
+  gpuParams.effects = theEffects;
   gpuParams.toneMappingMethod = (myParams.ToneMappingMethod == Graphic3d_ToneMappingMethod_Filmic) ? 1 : 0;
   gpuParams.exposure = myParams.Exposure;
   gpuParams.whitePoint = myParams.WhitePoint;
@@ -488,7 +477,7 @@ void Metal_PostProcess::Apply(Metal_Context* theCtx,
   gpuParams.texelSizeY = 1.0f / (float)theSource.height;
 
   // Set pipeline and resources
-  [encoder setRenderPipelineState:myCombinedPipeline];
+  [encoder setRenderPipelineState:aPipeline];
   [encoder setFragmentTexture:theSource atIndex:0];
   [encoder setFragmentSamplerState:mySampler atIndex:0];
   [encoder setFragmentBytes:&gpuParams length:sizeof(gpuParams) atIndex:0];
@@ -500,46 +489,47 @@ void Metal_PostProcess::Apply(Metal_Context* theCtx,
 }
 
 // =======================================================================
-// function : ApplyFXAA
-// purpose  : Apply FXAA anti-aliasing only
+// function : Apply
+// purpose  : Apply post-processing effects
 // =======================================================================
-void Metal_PostProcess::ApplyFXAA(Metal_Context* theCtx,
-                                  id<MTLCommandBuffer> theCommandBuffer,
-                                  id<MTLTexture> theSource,
-                                  id<MTLTexture> theTarget)
+void Metal_PostProcess::Apply(Metal_Context* theCtx,
+                              id<MTLCommandBuffer> theCommandBuffer,
+                              id<MTLTexture> theSource,
+                              id<MTLTexture> theTarget)
 {
-  if (!myIsValid || myFXAAPipeline == nil || theCommandBuffer == nil)
+  if (!myIsValid || theCommandBuffer == nil || theSource == nil || theTarget == nil)
   {
     return;
   }
 
-  MTLRenderPassDescriptor* passDesc = [MTLRenderPassDescriptor renderPassDescriptor];
-  passDesc.colorAttachments[0].texture = theTarget;
-  passDesc.colorAttachments[0].loadAction = MTLLoadActionDontCare;
-  passDesc.colorAttachments[0].storeAction = MTLStoreActionStore;
-
-  id<MTLRenderCommandEncoder> encoder = [theCommandBuffer renderCommandEncoderWithDescriptor:passDesc];
-  if (encoder == nil)
+  // If no effects enabled, just blit
+  if (myEffects == 0)
   {
+    id<MTLBlitCommandEncoder> blit = [theCommandBuffer blitCommandEncoder];
+    [blit copyFromTexture:theSource toTexture:theTarget];
+    [blit endEncoding];
     return;
   }
 
-  [encoder setLabel:@"FXAA"];
-
-  PostProcessGPUParams gpuParams;
-  gpuParams.effects = Metal_PostProcessEffect_FXAA;
-  gpuParams.fxaaQuality = myParams.FXAAQuality;
-  gpuParams.texelSizeX = 1.0f / (float)theSource.width;
-  gpuParams.texelSizeY = 1.0f / (float)theSource.height;
-
-  [encoder setRenderPipelineState:myFXAAPipeline];
-  [encoder setFragmentTexture:theSource atIndex:0];
-  [encoder setFragmentSamplerState:mySampler atIndex:0];
-  [encoder setFragmentBytes:&gpuParams length:sizeof(gpuParams) atIndex:0];
+  // All enabled effects within single pass
+  encodeFused(theCtx, theCommandBuffer, theSource, theTarget, myEffects, @"Post-Processing");
+}
 
-  [encoder drawPrimitives:MTLPrimitiveTypeTriangle vertexStart:0 vertexCount:3];
+// =======================================================================
+// function : ApplyFXAA
+// purpose  : Apply FXAA anti-aliasing only
+// =======================================================================
+void Metal_PostProcess::ApplyFXAA(Metal_Context* theCtx,
+                                  id<MTLCommandBuffer> theCommandBuffer,
+                                  id<MTLTexture> theSource,
+                                  id<MTLTexture> theTarget)
+{
+  if (!myIsValid || theCommandBuffer == nil || theSource == nil || theTarget == nil)
+  {
+    return;
+  }
 
-  [encoder endEncoding];
+  encodeFused(theCtx, theCommandBuffer, theSource, theTarget, Metal_PostProcessEffect_FXAA, @"FXAA");
 }
 
 // =======================================================================
@@ -551,39 +541,11 @@ void Metal_PostProcess::ApplyToneMapping(Metal_Context* theCtx,
                                          id<MTLTexture> theSource,
                                          id<MTLTexture> theTarget)
 {
-  if (!myIsValid || myToneMappingPipeline == nil || theCommandBuffer == nil)
-  {
-    return;
-  }
-
-  MTLRenderPassDescriptor* passDesc = [MTLRenderPassDescriptor renderPassDescriptor];
-  passDesc.colorAttachments[0].texture = theTarget;
-  passDesc.colorAttachments[0].loadAction = MTLLoadActionDontCare;
-  passDesc.colorAttachments[0].storeAction = MTLStoreActionStore;
-
-  id<MTLRenderCommandEncoder> encoder = [theCommandBuffer renderCommandEncoderWithDescriptor:passDesc];
-  if (encoder == nil)
+  if (!myIsValid || theCommandBuffer == nil || theSource == nil || theTarget == nil)
   {
     return;
   }
 
-  [encoder setLabel:@"Tone Mapping"];
-
-  PostProcessGPUParams gpuParams;
-  gpuParams.effects = Metal_PostProcessEffect_ToneMapping | Metal_PostProcessEffect_GammaCorrection;
-  gpuParams.toneMappingMethod = (myParams.ToneMappingMethod == Graphic3d_ToneMappingMethod_Filmic) ? 1 : 0;
-  gpuParams.exposure = myParams.Exposure;
-  gpuParams.whitePoint = myParams.WhitePoint;
-  gpuParams.gamma = myParams.Gamma;
-  gpuParams.texelSizeX = 1.0f / (float)theSource.width;
-  gpuParams.texelSizeY = 1.0f / (float)theSource.height;
-
-  [encoder setRenderPipelineState:myToneMappingPipeline];
-  [encoder setFragmentTexture:theSource atIndex:0];
-  [encoder setFragmentSamplerState:mySampler atIndex:0];
-  [encoder setFragmentBytes:&gpuParams length:sizeof(gpuParams) atIndex:0];
-
-  [encoder drawPrimitives:MTLPrimitiveTypeTriangle vertexStart:0 vertexCount:3];
-
-  [encoder endEncoding];
+  encodeFused(theCtx, theCommandBuffer, theSource, theTarget,
+              Metal_PostProcessEffect_ToneMapping | Metal_PostProcessEffect_GammaCorrection, @"Tone Mapping");
 }
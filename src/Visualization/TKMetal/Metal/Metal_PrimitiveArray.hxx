@@ -21,6 +21,12 @@
 #include <Metal_VertexBuffer.hxx>
 #include <Metal_IndexBuffer.hxx>
 #include <Metal_InstanceBuffer.hxx>
+#include <Metal_MeshletBuffer.hxx>
+#include <Metal_PointCloud.hxx>
+#include <Metal_GeometryEmulator.hxx>
+#include <TCollection_AsciiString.hxx>
+
+#include <vector>
 
 #ifdef __OBJC__
 #import <Metal/Metal.h>
@@ -66,12 +72,53 @@ public:
   Standard_EXPORT void RenderEdges(Metal_Workspace* theWorkspace) const;
 
   //! Render with MeshEdges (smooth anti-aliased wireframe overlay using geometry emulator).
-  //! Uses compute shader to calculate edge distances for each triangle.
+  //! Draws vertices prepared by InitMeshEdges(), falls back to RenderEdges() when they are unavailable.
   Standard_EXPORT void RenderMeshEdges(Metal_Workspace* theWorkspace) const;
 
+  //! Prepare persistent buffer for RenderMeshEdges() with barycentric coordinates of triangle corners
+  //! (see Metal_GeometryEmulator::Prepare()); done once, as the buffer does not depend on camera or viewport.
+  //! @return FALSE if array is not a triangle list or emulator is unavailable
+  Standard_EXPORT bool InitMeshEdges(Metal_Context* theCtx,
+                                     const occ::handle<Metal_GeometryEmulator>& theEmulator);
+
+  //! Return true if mesh edges buffer has been prepared by InitMeshEdges().
+  bool HasMeshEdges() const { return !myMeshEdgesBuffer.IsNull(); }
+
+  //! Return number of line segments drawn as screen-space quads by wide and dashed line aspects
+  //! (see Metal_Workspace::ApplyWideLinePipelineState()); 0 for non-line arrays.
+  int NbLineSegments() const { return myNbLineSegments; }
+
   //! Return true if resources are initialized.
   bool IsInitialized() const { return myIsInitialized; }
 
+  //! Return true if GPU buffers are shared with other arrays created from the same immutable
+  //! attribute and index data (like instances of the same triangulation within groups
+  //! with different Graphic3d_Group::Transformation()).
+  bool IsShared() const { return !myShared.IsNull(); }
+
+  //! Return true if points are rendered with level of detail by Metal_PointCloud instead of vertex buffers
+  //! (see Metal_Caps::pointCloudMinPoints); known after initialization.
+  bool IsPointCloud() const { return !myPointCloud.IsNull(); }
+
+  //! Return true if nodal normals are uploaded as octahedral vectors of 2 normalized 16-bit integers
+  //! (see Metal_Caps::useQuantizedVertices), which only Metal_Workspace::ApplyOctNormalsPipelineState() can draw.
+  bool HasOctahedralNormals() const
+  {
+    return !myNormalVbo.IsNull()
+         && myNormalVbo->VertexFormat() == Metal_VertexFormat_Short2Normalized;
+  }
+
+  //! Return true if vertex attributes are mutable, so that their invalidated range is uploaded by Render().
+  bool HasMutableAttributes() const { return !myAttribs.IsNull() && myAttribs->IsMutable(); }
+
+  //! Return the number of GPU copies of mutable vertex attributes rotated per frame:
+  //! 1 until the array is modified within consecutive frames (see updateBuffers()).
+  int NbDynamicSlots() const { return myDynamicSlots.empty() ? 1 : int(myDynamicSlots.size()); }
+
+  //! Return estimated GPU memory of buffers (CPU data is not counted);
+  //! memory of shared buffers is divided between arrays sharing them.
+  Standard_EXPORT size_t EstimatedDataSize() const;
+
   //! Return primitive type.
   Graphic3d_TypeOfPrimitiveArray Type() const { return myType; }
 
@@ -81,13 +128,40 @@ public:
   //! Return number of indices (0 if not indexed).
   int NbIndices() const { return myNbIndices; }
 
+  //! Return CPU attribute data (shared by arrays created from the same Graphic3d_ArrayOfPrimitives).
+  const occ::handle<Graphic3d_Buffer>& Attributes() const { return myAttribs; }
+
+  //! Return CPU index data.
+  const occ::handle<Graphic3d_IndexBuffer>& Indices() const { return myIndices; }
+
+  //! Return position buffer (defines vertex buffer binding of the draw).
+  const occ::handle<Metal_VertexBuffer>& PositionBuffer() const { return myPositionVbo; }
+
 #ifdef __OBJC__
   //! Return Metal primitive type.
   MTLPrimitiveType MetalPrimitiveType() const;
+
+  //! Encode vertex buffers binding and draw call of the primitive array
+  //! into indirect render command (same bindings as Render()).
+  //! @param theCmd       indirect render command to fill
+  //! @param theResources list to append buffers referenced by the command
+  //! @return FALSE if array is not initialized or has nothing to draw
+  Standard_EXPORT bool EncodeIndirect(id<MTLIndirectRenderCommand> theCmd,
+                                      NSMutableArray* theResources) const;
+
+  //! Bind only positions (buffer index 0) and encode the draw call with the same primitive assembly as Render(),
+  //! for passes using own pipeline (e.g. Metal_IdBuffer).
+  Standard_EXPORT void DrawPositions(id<MTLRenderCommandEncoder> theEncoder) const;
 #endif
 
 protected:
 
+#ifdef __OBJC__
+  //! Encode draw call of the primitive array with already bound vertex buffers.
+  void encodeDraw(id<MTLRenderCommandEncoder> theEncoder,
+                  NSUInteger theNbInstances = 1) const;
+#endif
+
   //! Build edge index buffer from triangle indices for wireframe rendering.
   //! Extracts unique edges from triangle mesh.
   void buildEdgeIndices(Metal_Context* theCtx);
@@ -96,6 +170,44 @@ protected:
   //! Metal doesn't support triangle fans, so we expand them.
   void convertTriangleFan(Metal_Context* theCtx);
 
+  //! Build buffer of line segments for wide line rendering from segments or polylines.
+  //! Each segment holds vertex indices (previous, start, end, next), where previous and next vertices
+  //! define miter joins with adjacent segments (previous == start and next == end for free ends).
+  void buildLineSegments(Metal_Context* theCtx);
+
+  //! Take GPU buffers from the resource shared by arrays with the same data.
+  //! @return FALSE if no such resource has been registered yet
+  bool fetchSharedBuffers(Metal_Context* theCtx);
+
+  //! Register GPU buffers of this array as resource shared by arrays with the same data.
+  void shareBuffers(Metal_Context* theCtx);
+
+  //! Upload invalidated range of mutable vertex attributes into GPU buffers.
+  //! Array modified again while the previous frames might be still in flight is considered dynamic
+  //! and switches to the ring of GPU copies, so that the range is uploaded into the copy
+  //! not read by GPU, while the other copies accumulate the range till their turn.
+  void updateBuffers(Metal_Context* theCtx) const;
+
+  //! Upload byte range of mutable vertex attributes into GPU buffers
+  //! (positions, normals, colors and texture coordinates).
+  void uploadRange(Metal_Context* theCtx,
+                   const occ::handle<Metal_VertexBuffer>* theVbos,
+                   const Graphic3d_BufferRange& theRange) const;
+
+  //! Create the ring of GPU copies of mutable vertex attributes,
+  //! the first one holding the current buffers.
+  bool createDynamicSlots(Metal_Context* theCtx,
+                          int theNbSlots) const;
+
+protected:
+
+  //! GPU copy of mutable vertex attributes.
+  struct DynamicSlot
+  {
+    occ::handle<Metal_VertexBuffer> Vbos[4]; //!< positions, normals, colors and texture coordinates
+    Graphic3d_BufferRange           Pending; //!< byte range modified since the copy has been uploaded
+  };
+
 protected:
 
   Graphic3d_TypeOfPrimitiveArray       myType;           //!< primitive type
@@ -103,19 +215,30 @@ protected:
   occ::handle<Graphic3d_IndexBuffer>   myIndices;        //!< CPU index data
   occ::handle<Graphic3d_BoundBuffer>   myBounds;         //!< CPU bounds data
 
-  occ::handle<Metal_VertexBuffer>      myPositionVbo;    //!< position buffer
-  occ::handle<Metal_VertexBuffer>      myNormalVbo;      //!< normal buffer
-  occ::handle<Metal_VertexBuffer>      myColorVbo;       //!< color buffer
-  occ::handle<Metal_VertexBuffer>      myTexCoordVbo;    //!< texture coordinate buffer
+  // vertex buffers are switched by updateBuffers() to the current copy of mutable attributes
+  mutable occ::handle<Metal_VertexBuffer> myPositionVbo; //!< position buffer
+  mutable occ::handle<Metal_VertexBuffer> myNormalVbo;   //!< normal buffer
+  mutable occ::handle<Metal_VertexBuffer> myColorVbo;    //!< color buffer
+  mutable occ::handle<Metal_VertexBuffer> myTexCoordVbo; //!< texture coordinate buffer
+  mutable std::vector<DynamicSlot>        myDynamicSlots; //!< ring of copies of mutable attributes
+  mutable int                             myDynamicSlot;  //!< index of current copy within myDynamicSlots
+  mutable uint64_t                        myUpdateFrame;  //!< Metal_Context::FrameNumber() + 1 of last upload
   occ::handle<Metal_IndexBuffer>       myIndexBuffer;         //!< index buffer
   occ::handle<Metal_IndexBuffer>       myEdgeIndexBuffer;     //!< edge index buffer for unique edges
   occ::handle<Metal_IndexBuffer>       myConvertedFanBuffer;  //!< converted triangle fan -> triangles
-
-  int  myNbVertices;       //!< number of vertices
-  int  myNbIndices;        //!< number of indices
-  int  myNbEdgeIndices;    //!< number of edge indices (unique edges * 2)
-  int  myNbFanTriIndices;  //!< number of converted triangle fan indices
-  bool myIsInitialized;    //!< initialization flag
+  occ::handle<Metal_MeshletBuffer>     myMeshlets;            //!< meshlets for mesh shader rendering of large triangulations
+  occ::handle<Metal_PointCloud>        myPointCloud;          //!< level of detail octree of very large point arrays
+  occ::handle<Metal_Buffer>            myMeshEdgesBuffer;     //!< unrolled triangles with barycentric coordinates for MeshEdges
+  occ::handle<Metal_Buffer>            myLineSegments;        //!< line segments with adjacency for wide lines
+  occ::handle<Metal_Resource>          myShared;              //!< resource holding buffers shared with other arrays
+  TCollection_AsciiString              mySharedKey;           //!< key of shared resource within context
+
+  mutable int myNbVertices;      //!< number of vertices (changes within capacity of mutable attributes)
+  int         myNbIndices;       //!< number of indices
+  int         myNbEdgeIndices;   //!< number of edge indices (unique edges * 2)
+  int         myNbFanTriIndices; //!< number of converted triangle fan indices
+  int         myNbLineSegments;  //!< number of segments within myLineSegments
+  bool        myIsInitialized;   //!< initialization flag
 };
 
 #endif // Metal_PrimitiveArray_HeaderFile
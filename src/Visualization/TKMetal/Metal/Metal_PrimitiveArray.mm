@@ -17,11 +17,109 @@
 #include <Metal_PrimitiveArray.hxx>
 #include <Metal_Context.hxx>
 #include <Metal_Workspace.hxx>
+#include <Graphic3d_VertexQuantizer.hxx>
 
+#include <cstdio>
+#include <cstring>
 #include <set>
 #include <vector>
 #include <algorithm>
 
+namespace
+{
+  //! Return index of GPU buffer of vertex attribute (positions, normals, colors, texture coordinates)
+  //! or -1 for attributes not uploaded.
+  static int attribVboIndex(Graphic3d_TypeOfAttribute theAttrib)
+  {
+    switch (theAttrib)
+    {
+      case Graphic3d_TOA_POS:   return 0;
+      case Graphic3d_TOA_NORM:  return 1;
+      case Graphic3d_TOA_COLOR: return 2;
+      case Graphic3d_TOA_UV:    return 3;
+      default:
+        break;
+    }
+    return -1;
+  }
+
+  //! GPU buffers shared by primitive arrays created from the same immutable attribute and index data.
+  //! The resource keeps CPU data referenced, so that its address identifying the resource is not reused.
+  class Metal_SharedArrayBuffers : public Metal_NamedResource
+  {
+    DEFINE_STANDARD_RTTI_INLINE(Metal_SharedArrayBuffers, Metal_NamedResource)
+  public:
+
+    //! Constructor.
+    Metal_SharedArrayBuffers(const TCollection_AsciiString& theKey)
+    : Metal_NamedResource(theKey),
+      NbEdgeIndices(0),
+      NbFanTriIndices(0),
+      NbLineSegments(0) {}
+
+    //! Release GPU buffers.
+    void Release(Metal_Context* theCtx) override
+    {
+      releaseBuffer(PositionVbo, theCtx);
+      releaseBuffer(NormalVbo, theCtx);
+      releaseBuffer(ColorVbo, theCtx);
+      releaseBuffer(TexCoordVbo, theCtx);
+      releaseBuffer(IndexBuffer, theCtx);
+      releaseBuffer(EdgeIndexBuffer, theCtx);
+      releaseBuffer(ConvertedFanBuffer, theCtx);
+      releaseBuffer(Meshlets, theCtx);
+      releaseBuffer(LineSegments, theCtx);
+      Attribs.Nullify();
+      Indices.Nullify();
+    }
+
+    //! Return estimated GPU memory of buffers.
+    size_t EstimatedDataSize() const override
+    {
+      size_t aSize = 0;
+      aSize += !PositionVbo.IsNull()        ? PositionVbo->EstimatedDataSize()        : 0;
+      aSize += !NormalVbo.IsNull()          ? NormalVbo->EstimatedDataSize()          : 0;
+      aSize += !ColorVbo.IsNull()           ? ColorVbo->EstimatedDataSize()           : 0;
+      aSize += !TexCoordVbo.IsNull()        ? TexCoordVbo->EstimatedDataSize()        : 0;
+      aSize += !IndexBuffer.IsNull()        ? IndexBuffer->EstimatedDataSize()        : 0;
+      aSize += !EdgeIndexBuffer.IsNull()    ? EdgeIndexBuffer->EstimatedDataSize()    : 0;
+      aSize += !ConvertedFanBuffer.IsNull() ? ConvertedFanBuffer->EstimatedDataSize() : 0;
+      aSize += !Meshlets.IsNull()           ? Meshlets->EstimatedDataSize()           : 0;
+      aSize += !LineSegments.IsNull()       ? LineSegments->EstimatedDataSize()       : 0;
+      return aSize;
+    }
+
+  private:
+
+    template <typename TheHandleType>
+    static void releaseBuffer(TheHandleType& theBuffer, Metal_Context* theCtx)
+    {
+      if (!theBuffer.IsNull())
+      {
+        theBuffer->Release(theCtx);
+        theBuffer.Nullify();
+      }
+    }
+
+  public:
+
+    occ::handle<Graphic3d_Buffer>      Attribs;
+    occ::handle<Graphic3d_IndexBuffer> Indices;
+    occ::handle<Metal_VertexBuffer>    PositionVbo;
+    occ::handle<Metal_VertexBuffer>    NormalVbo;
+    occ::handle<Metal_VertexBuffer>    ColorVbo;
+    occ::handle<Metal_VertexBuffer>    TexCoordVbo;
+    occ::handle<Metal_IndexBuffer>     IndexBuffer;
+    occ::handle<Metal_IndexBuffer>     EdgeIndexBuffer;
+    occ::handle<Metal_IndexBuffer>     ConvertedFanBuffer;
+    occ::handle<Metal_MeshletBuffer>   Meshlets;
+    occ::handle<Metal_Buffer>          LineSegments;
+    int                                NbEdgeIndices;
+    int                                NbFanTriIndices;
+    int                                NbLineSegments;
+  };
+}
+
 // =======================================================================
 // function : Metal_PrimitiveArray
 // purpose  : Constructor
@@ -35,10 +133,13 @@ Metal_PrimitiveArray::Metal_PrimitiveArray(
   myAttribs(theAttribs),
   myIndices(theIndices),
   myBounds(theBounds),
+  myDynamicSlot(0),
+  myUpdateFrame(0),
   myNbVertices(0),
   myNbIndices(0),
   myNbEdgeIndices(0),
   myNbFanTriIndices(0),
+  myNbLineSegments(0),
   myIsInitialized(false)
 {
   if (!myAttribs.IsNull())
@@ -76,66 +177,107 @@ bool Metal_PrimitiveArray::Init(Metal_Context* theCtx)
     return false;
   }
 
-  // Find and upload each attribute type
-  for (int anAttribIdx = 0; anAttribIdx < myAttribs->NbAttributes; ++anAttribIdx)
+  // Memory allocated by Metal_PageAllocator is wrapped without copying on unified memory;
+  // mutable arrays are still copied, as they are modified while previous frames are in flight
+  // Very large point clouds are sorted into octree and only visible nodes are streamed into GPU memory;
+  // mutable arrays are still uploaded as a whole, as the octree is not updated
+  if (myType == Graphic3d_TOPA_POINTS
+   && myIndices.IsNull()
+   && !myAttribs->IsMutable()
+   && theCtx->Caps()->pointCloudMinPoints > 0
+   && myAttribs->NbElements >= theCtx->Caps()->pointCloudMinPoints)
   {
-    const Graphic3d_Attribute& anAttrib = myAttribs->Attribute(anAttribIdx);
-    const size_t anOffset = myAttribs->AttributeOffset(anAttribIdx);
-    const uint8_t* aData = myAttribs->Data() + anOffset;
+    myPointCloud = new Metal_PointCloud();
+    if (myPointCloud->Init(theCtx, myAttribs))
+    {
+      myIsInitialized = true;
+      return true;
+    }
+    myPointCloud.Nullify();
+  }
+
+  // Arrays created from the same immutable data (like instances of shared triangulation
+  // within groups having own transformation) upload it only once
+  if (myAttribs->GetRefCount() > 1
+   && !myAttribs->IsMutable()
+   && (myIndices.IsNull() || !myIndices->IsMutable()))
+  {
+    char aKey[128];
+    snprintf(aKey, sizeof(aKey), "Metal_PrimitiveArray:%p:%p:%d",
+             (const void*)myAttribs.get(), (const void*)myIndices.get(), int(myType));
+    mySharedKey = aKey;
+    if (fetchSharedBuffers(theCtx))
+    {
+      myIsInitialized = true;
+      return true;
+    }
+  }
+
+  // Static shaded triangulations upload octahedral normals and half float texture coordinates;
+  // positions are kept in float precision, as depth-only passes and emulators read them directly.
+  // Meshlets and indirect command buffers are encoded with float normals
+  occ::handle<Graphic3d_Buffer> anAttribs = myAttribs;
+  if (theCtx->Caps()->useQuantizedVertices
+   && !theCtx->Caps()->useIndirectCommandBuffers
+   && !(theCtx->Caps()->useMeshShaders && theCtx->HasMeshShaders())
+   && (myType == Graphic3d_TOPA_TRIANGLES
+    || myType == Graphic3d_TOPA_TRIANGLESTRIPS
+    || myType == Graphic3d_TOPA_TRIANGLEFANS)
+   && !myAttribs->IsMutable())
+  {
+    Graphic3d_VertexQuantizer aQuantizer;
+    aQuantizer.SetQuantizePositions(false);
+    occ::handle<Graphic3d_Buffer> aCompact = aQuantizer.Perform(*myAttribs);
+    if (!aCompact.IsNull())
+    {
+      anAttribs = aCompact;
+    }
+  }
 
+  const bool toAdopt = theCtx->Caps()->useZeroCopyArrays && theCtx->HasUnifiedMemory();
+  const bool toAdoptAttribs = toAdopt && !myAttribs->IsMutable() && anAttribs == myAttribs;
+
+  // Find and upload each attribute type
+  for (int anAttribIdx = 0; anAttribIdx < anAttribs->NbAttributes; ++anAttribIdx)
+  {
+    const Graphic3d_Attribute& anAttrib = anAttribs->Attribute(anAttribIdx);
+    occ::handle<Metal_VertexBuffer>* aVbo = nullptr;
     switch (anAttrib.Id)
     {
-      case Graphic3d_TOA_POS:
-      {
-        myPositionVbo = new Metal_VertexBuffer();
-        if (!myPositionVbo->Init(theCtx, anAttrib.DataType,
-                                 static_cast<int>(myAttribs->Stride),
-                                 static_cast<int>(myAttribs->NbElements),
-                                 aData))
-        {
-          return false;
-        }
-        break;
-      }
-      case Graphic3d_TOA_NORM:
-      {
-        myNormalVbo = new Metal_VertexBuffer();
-        if (!myNormalVbo->Init(theCtx, anAttrib.DataType,
-                               static_cast<int>(myAttribs->Stride),
-                               static_cast<int>(myAttribs->NbElements),
-                               aData))
-        {
-          return false;
-        }
-        break;
-      }
-      case Graphic3d_TOA_COLOR:
-      {
-        myColorVbo = new Metal_VertexBuffer();
-        if (!myColorVbo->Init(theCtx, anAttrib.DataType,
-                              static_cast<int>(myAttribs->Stride),
-                              static_cast<int>(myAttribs->NbElements),
-                              aData))
-        {
-          return false;
-        }
-        break;
-      }
-      case Graphic3d_TOA_UV:
-      {
-        myTexCoordVbo = new Metal_VertexBuffer();
-        if (!myTexCoordVbo->Init(theCtx, anAttrib.DataType,
-                                 static_cast<int>(myAttribs->Stride),
-                                 static_cast<int>(myAttribs->NbElements),
-                                 aData))
-        {
-          return false;
-        }
-        break;
-      }
+      case Graphic3d_TOA_POS:   aVbo = &myPositionVbo; break;
+      case Graphic3d_TOA_NORM:  aVbo = &myNormalVbo;   break;
+      case Graphic3d_TOA_COLOR: aVbo = &myColorVbo;    break;
+      case Graphic3d_TOA_UV:    aVbo = &myTexCoordVbo; break;
       default:
         break;
     }
+    if (aVbo == nullptr)
+    {
+      continue;
+    }
+
+    // non-interleaved buffer keeps each attribute as tightly packed block of NbMaxElements() values
+    const int anAttribStride = Graphic3d_Attribute::Stride(anAttrib.DataType);
+    const int aStride = anAttribs->IsInterleaved() ? anAttribs->Stride : anAttribStride;
+    const size_t anOffset = anAttribs->IsInterleaved()
+                          ? size_t(anAttribs->AttributeOffset(anAttribIdx))
+                          : size_t(anAttribs->AttributeOffset(anAttribIdx)) * size_t(anAttribs->NbMaxElements());
+
+    // mutable attributes are allocated for NbMaxElements(), so that vertices might be appended without reallocation
+    const bool isDynamic = anAttribs->IsMutable();
+    *aVbo = new Metal_VertexBuffer();
+    if (toAdoptAttribs
+     && aStride == anAttribStride
+     && (*aVbo)->Adopt(theCtx, anAttrib.DataType, static_cast<int>(myAttribs->NbElements), myAttribs, anOffset))
+    {
+      continue;
+    }
+    if (!(*aVbo)->Init(theCtx, anAttrib.DataType, aStride,
+                       isDynamic ? anAttribs->NbMaxElements() : static_cast<int>(anAttribs->NbElements),
+                       anAttribs->Data() + anOffset, isDynamic))
+    {
+      return false;
+    }
   }
 
   // Upload index buffer if present
@@ -145,7 +287,13 @@ bool Metal_PrimitiveArray::Init(Metal_Context* theCtx)
     Metal_IndexType anIndexType = myIndices->Stride == 2
                                 ? Metal_IndexType_UInt16
                                 : Metal_IndexType_UInt32;
-    if (!myIndexBuffer->Init(theCtx, anIndexType,
+    const bool isAdopted = toAdopt
+                        && !myIndices->IsMutable()
+                        && myIndexBuffer->Adopt(theCtx, anIndexType,
+                                                static_cast<int>(myIndices->NbElements),
+                                                myIndices);
+    if (!isAdopted
+     && !myIndexBuffer->Init(theCtx, anIndexType,
                              static_cast<int>(myIndices->NbElements),
                              myIndices->Data()))
     {
@@ -165,16 +313,139 @@ bool Metal_PrimitiveArray::Init(Metal_Context* theCtx)
     }
   }
 
+  // Segments with adjacency for drawing wide and dashed lines as quads
+  if (myType == Graphic3d_TOPA_SEGMENTS
+   || myType == Graphic3d_TOPA_POLYLINES)
+  {
+    buildLineSegments(theCtx);
+  }
+
+  // Split large shaded triangulations into meshlets culled on GPU by object shader
+  if (theCtx->Caps()->useMeshShaders
+   && theCtx->HasMeshShaders()
+   && myType == Graphic3d_TOPA_TRIANGLES
+   && !myNormalVbo.IsNull()
+   && (myIndices.IsNull() ? myAttribs->NbElements : myIndices->NbElements) / 3 >= Metal_MeshletBuffer::MinTriangles)
+  {
+    myMeshlets = new Metal_MeshletBuffer();
+    if (!myMeshlets->Init(theCtx, myAttribs, myIndices))
+    {
+      myMeshlets.Nullify();
+    }
+  }
+
+  if (!mySharedKey.IsEmpty())
+  {
+    shareBuffers(theCtx);
+  }
+
   myIsInitialized = true;
   return true;
 }
 
+// =======================================================================
+// function : fetchSharedBuffers
+// purpose  :
+// =======================================================================
+bool Metal_PrimitiveArray::fetchSharedBuffers(Metal_Context* theCtx)
+{
+  occ::handle<Metal_SharedArrayBuffers> aShared;
+  if (!theCtx->GetResource(mySharedKey, aShared))
+  {
+    return false;
+  }
+
+  myShared             = aShared;
+  myPositionVbo        = aShared->PositionVbo;
+  myNormalVbo          = aShared->NormalVbo;
+  myColorVbo           = aShared->ColorVbo;
+  myTexCoordVbo        = aShared->TexCoordVbo;
+  myIndexBuffer        = aShared->IndexBuffer;
+  myEdgeIndexBuffer    = aShared->EdgeIndexBuffer;
+  myConvertedFanBuffer = aShared->ConvertedFanBuffer;
+  myMeshlets           = aShared->Meshlets;
+  myLineSegments       = aShared->LineSegments;
+  myNbEdgeIndices      = aShared->NbEdgeIndices;
+  myNbFanTriIndices    = aShared->NbFanTriIndices;
+  myNbLineSegments     = aShared->NbLineSegments;
+  return true;
+}
+
+// =======================================================================
+// function : shareBuffers
+// purpose  :
+// =======================================================================
+void Metal_PrimitiveArray::shareBuffers(Metal_Context* theCtx)
+{
+  occ::handle<Metal_SharedArrayBuffers> aShared = new Metal_SharedArrayBuffers(mySharedKey);
+  aShared->Attribs            = myAttribs;
+  aShared->Indices            = myIndices;
+  aShared->PositionVbo        = myPositionVbo;
+  aShared->NormalVbo          = myNormalVbo;
+  aShared->ColorVbo           = myColorVbo;
+  aShared->TexCoordVbo        = myTexCoordVbo;
+  aShared->IndexBuffer        = myIndexBuffer;
+  aShared->EdgeIndexBuffer    = myEdgeIndexBuffer;
+  aShared->ConvertedFanBuffer = myConvertedFanBuffer;
+  aShared->Meshlets           = myMeshlets;
+  aShared->LineSegments       = myLineSegments;
+  aShared->NbEdgeIndices      = myNbEdgeIndices;
+  aShared->NbFanTriIndices    = myNbFanTriIndices;
+  aShared->NbLineSegments     = myNbLineSegments;
+  if (theCtx->ShareResource(mySharedKey, aShared))
+  {
+    myShared = aShared;
+  }
+  else
+  {
+    // keep own buffers
+    aShared->Attribs.Nullify();
+    aShared->Indices.Nullify();
+    mySharedKey.Clear();
+  }
+}
+
 // =======================================================================
 // function : Release
 // purpose  : Release Metal resources
 // =======================================================================
 void Metal_PrimitiveArray::Release(Metal_Context* theCtx)
 {
+  if (!myShared.IsNull())
+  {
+    // shared buffers are released together with the resource by the last array using them
+    myPositionVbo.Nullify();
+    myNormalVbo.Nullify();
+    myColorVbo.Nullify();
+    myTexCoordVbo.Nullify();
+    myIndexBuffer.Nullify();
+    myEdgeIndexBuffer.Nullify();
+    myConvertedFanBuffer.Nullify();
+    myMeshlets.Nullify();
+    myLineSegments.Nullify();
+    if (theCtx != nullptr)
+    {
+      theCtx->ReleaseResource(mySharedKey);
+    }
+    myShared.Nullify();
+  }
+  mySharedKey.Clear();
+
+  // current copy of mutable attributes is released below
+  for (size_t aSlotIter = 0; aSlotIter < myDynamicSlots.size(); ++aSlotIter)
+  {
+    for (int aVboIter = 0; aVboIter < 4; ++aVboIter)
+    {
+      if (!myDynamicSlots[aSlotIter].Vbos[aVboIter].IsNull())
+      {
+        myDynamicSlots[aSlotIter].Vbos[aVboIter]->Release(theCtx);
+      }
+    }
+  }
+  myDynamicSlots.clear();
+  myDynamicSlot = 0;
+  myUpdateFrame = 0;
+
   if (!myPositionVbo.IsNull())
   {
     myPositionVbo->Release(theCtx);
@@ -210,12 +481,73 @@ void Metal_PrimitiveArray::Release(Metal_Context* theCtx)
     myConvertedFanBuffer->Release(theCtx);
     myConvertedFanBuffer.Nullify();
   }
+  if (!myMeshlets.IsNull())
+  {
+    myMeshlets->Release(theCtx);
+    myMeshlets.Nullify();
+  }
+  if (!myPointCloud.IsNull())
+  {
+    myPointCloud->Release(theCtx);
+    myPointCloud.Nullify();
+  }
+  if (!myMeshEdgesBuffer.IsNull())
+  {
+    myMeshEdgesBuffer->Release(theCtx);
+    myMeshEdgesBuffer.Nullify();
+  }
+  if (!myLineSegments.IsNull())
+  {
+    myLineSegments->Release(theCtx);
+    myLineSegments.Nullify();
+  }
   myNbEdgeIndices = 0;
   myNbFanTriIndices = 0;
+  myNbLineSegments = 0;
 
   myIsInitialized = false;
 }
 
+// =======================================================================
+// function : EstimatedDataSize
+// purpose  : Return estimated GPU memory of buffers
+// =======================================================================
+size_t Metal_PrimitiveArray::EstimatedDataSize() const
+{
+  size_t aSize = 0;
+  aSize += !myPointCloud.IsNull()      ? myPointCloud->EstimatedDataSize()      : 0;
+  aSize += !myMeshEdgesBuffer.IsNull() ? myMeshEdgesBuffer->EstimatedDataSize() : 0;
+  if (!myShared.IsNull())
+  {
+    // one reference to shared resource is held by context
+    const int aNbUsers = std::max(myShared->GetRefCount() - 1, 1);
+    return aSize + myShared->EstimatedDataSize() / size_t(aNbUsers);
+  }
+
+  aSize += !myPositionVbo.IsNull()        ? myPositionVbo->EstimatedDataSize()        : 0;
+  aSize += !myNormalVbo.IsNull()          ? myNormalVbo->EstimatedDataSize()          : 0;
+  aSize += !myColorVbo.IsNull()           ? myColorVbo->EstimatedDataSize()           : 0;
+  aSize += !myTexCoordVbo.IsNull()        ? myTexCoordVbo->EstimatedDataSize()        : 0;
+  aSize += !myIndexBuffer.IsNull()        ? myIndexBuffer->EstimatedDataSize()        : 0;
+  aSize += !myEdgeIndexBuffer.IsNull()    ? myEdgeIndexBuffer->EstimatedDataSize()    : 0;
+  aSize += !myConvertedFanBuffer.IsNull() ? myConvertedFanBuffer->EstimatedDataSize() : 0;
+  aSize += !myMeshlets.IsNull()           ? myMeshlets->EstimatedDataSize()           : 0;
+  aSize += !myLineSegments.IsNull()       ? myLineSegments->EstimatedDataSize()       : 0;
+  for (size_t aSlotIter = 0; aSlotIter < myDynamicSlots.size(); ++aSlotIter)
+  {
+    if (int(aSlotIter) == myDynamicSlot)
+    {
+      continue;
+    }
+    for (int aVboIter = 0; aVboIter < 4; ++aVboIter)
+    {
+      const occ::handle<Metal_VertexBuffer>& aVbo = myDynamicSlots[aSlotIter].Vbos[aVboIter];
+      aSize += !aVbo.IsNull() ? aVbo->EstimatedDataSize() : 0;
+    }
+  }
+  return aSize;
+}
+
 // =======================================================================
 // function : buildEdgeIndices
 // purpose  : Build edge index buffer from triangle indices
@@ -300,6 +632,104 @@ void Metal_PrimitiveArray::buildEdgeIndices(Metal_Context* theCtx)
   }
 }
 
+// =======================================================================
+// function : buildLineSegments
+// purpose  : Build line segments with adjacency for wide lines
+// =======================================================================
+void Metal_PrimitiveArray::buildLineSegments(Metal_Context* theCtx)
+{
+  int aPosAttribIndex = -1;
+  size_t aPosStride = 0;
+  const uint8_t* aPosData = myAttribs->AttributeData(Graphic3d_TOA_POS, aPosAttribIndex, aPosStride);
+  if (aPosData == nullptr
+   || myAttribs->Attribute(aPosAttribIndex).DataType != Graphic3d_TOD_VEC3)
+  {
+    return;
+  }
+
+  const int aNbNodes = !myIndices.IsNull() ? int(myIndices->NbElements) : int(myAttribs->NbElements);
+  const auto aVertex = [&](int theNode) -> uint32_t
+  {
+    return !myIndices.IsNull() ? uint32_t(myIndices->Index(theNode)) : uint32_t(theNode);
+  };
+  const auto isSamePoint = [&](uint32_t theVert1, uint32_t theVert2) -> bool
+  {
+    return theVert1 == theVert2
+        || std::memcmp(aPosData + aPosStride * theVert1, aPosData + aPosStride * theVert2, sizeof(float) * 3) == 0;
+  };
+
+  std::vector<uint32_t> aSegments;
+  aSegments.reserve(size_t(aNbNodes) * 4);
+  const auto addSegment = [&](uint32_t thePrev, uint32_t theStart, uint32_t theEnd, uint32_t theNext)
+  {
+    // zero-length segments have no direction on screen
+    if (!isSamePoint(theStart, theEnd))
+    {
+      aSegments.insert(aSegments.end(), { thePrev, theStart, theEnd, theNext });
+    }
+  };
+
+  if (myType == Graphic3d_TOPA_SEGMENTS)
+  {
+    // polylines are often passed as segments with duplicated nodes - join segments sharing end points
+    const int aNbSegs = aNbNodes / 2;
+    for (int aSegIter = 0; aSegIter < aNbSegs; ++aSegIter)
+    {
+      const uint32_t aStart = aVertex(aSegIter * 2);
+      const uint32_t anEnd  = aVertex(aSegIter * 2 + 1);
+      const uint32_t aPrev  = aSegIter > 0 && isSamePoint(aVertex(aSegIter * 2 - 1), aStart)
+                            ? aVertex(aSegIter * 2 - 2) : aStart;
+      const uint32_t aNext  = aSegIter + 1 < aNbSegs && isSamePoint(aVertex(aSegIter * 2 + 2), anEnd)
+                            ? aVertex(aSegIter * 2 + 3) : anEnd;
+      addSegment(aPrev, aStart, anEnd, aNext);
+    }
+  }
+  else
+  {
+    const int aNbBounds = !myBounds.IsNull() && myBounds->NbBounds > 0 ? myBounds->NbBounds : 1;
+    int aFirst = 0;
+    for (int aBndIter = 0; aBndIter < aNbBounds; ++aBndIter)
+    {
+      const int aNbStrip = !myBounds.IsNull() && myBounds->NbBounds > 0
+                         ? std::min(myBounds->Bounds[aBndIter], aNbNodes - aFirst)
+                         : aNbNodes;
+      // closed polyline is joined at its first node as well
+      const bool isClosed = aNbStrip > 3
+                         && isSamePoint(aVertex(aFirst), aVertex(aFirst + aNbStrip - 1));
+      for (int aNodeIter = aFirst; aNodeIter + 1 < aFirst + aNbStrip; ++aNodeIter)
+      {
+        const uint32_t aStart = aVertex(aNodeIter);
+        const uint32_t anEnd  = aVertex(aNodeIter + 1);
+        uint32_t aPrev = aNodeIter > aFirst ? aVertex(aNodeIter - 1) : aStart;
+        uint32_t aNext = aNodeIter + 2 < aFirst + aNbStrip ? aVertex(aNodeIter + 2) : anEnd;
+        if (isClosed && aNodeIter == aFirst)
+        {
+          aPrev = aVertex(aFirst + aNbStrip - 2);
+        }
+        if (isClosed && aNodeIter + 2 == aFirst + aNbStrip)
+        {
+          aNext = aVertex(aFirst + 1);
+        }
+        addSegment(aPrev, aStart, anEnd, aNext);
+      }
+      aFirst += aNbStrip;
+    }
+  }
+
+  if (aSegments.empty())
+  {
+    return;
+  }
+
+  myLineSegments = new Metal_Buffer();
+  if (!myLineSegments->Init(theCtx, 4, int(aSegments.size() / 4), aSegments.data()))
+  {
+    myLineSegments.Nullify();
+    return;
+  }
+  myNbLineSegments = int(aSegments.size() / 4);
+}
+
 // =======================================================================
 // function : convertTriangleFan
 // purpose  : Convert triangle fan indices to triangle list indices
@@ -427,6 +857,18 @@ void Metal_PrimitiveArray::Render(Metal_Workspace* theWorkspace) const
     return;
   }
 
+  // octree nodes bind own buffers and pipeline
+  if (!myPointCloud.IsNull())
+  {
+    myPointCloud->Render(theWorkspace);
+    return;
+  }
+
+  if (myAttribs->IsMutable())
+  {
+    updateBuffers(theWorkspace->Context());
+  }
+
   // Bind vertex buffers at fixed indices matching shader expectations:
   // - buffer(0): positions
   // - buffer(1): uniforms (set elsewhere)
@@ -437,29 +879,262 @@ void Metal_PrimitiveArray::Render(Metal_Workspace* theWorkspace) const
   if (!myPositionVbo.IsNull() && myPositionVbo->IsValid())
   {
     [anEncoder setVertexBuffer:myPositionVbo->Buffer()
-                        offset:0
+                        offset:myPositionVbo->Offset()
                        atIndex:0];  // positions at index 0
   }
   if (!myNormalVbo.IsNull() && myNormalVbo->IsValid())
   {
     [anEncoder setVertexBuffer:myNormalVbo->Buffer()
-                        offset:0
+                        offset:myNormalVbo->Offset()
                        atIndex:2];  // normals at index 2
   }
   if (!myColorVbo.IsNull() && myColorVbo->IsValid())
   {
     [anEncoder setVertexBuffer:myColorVbo->Buffer()
-                        offset:0
+                        offset:myColorVbo->Offset()
                        atIndex:4];  // colors at index 4
   }
   if (!myTexCoordVbo.IsNull() && myTexCoordVbo->IsValid())
   {
     [anEncoder setVertexBuffer:myTexCoordVbo->Buffer()
-                        offset:0
+                        offset:myTexCoordVbo->Offset()
                        atIndex:5];  // texcoords at index 5
   }
 
-  // Draw
+  // Meshlets are culled and expanded by object and mesh shaders reading the same vertex buffers;
+  // configurations without mesh shader pipeline are drawn in classic way below
+  if (!myMeshlets.IsNull()
+   && theWorkspace->ApplyMeshletPipelineState())
+  {
+    if (@available(macOS 13.0, iOS 16.0, *))
+    {
+      [anEncoder setMeshBuffer:myPositionVbo->Buffer() offset:myPositionVbo->Offset() atIndex:0];
+      [anEncoder setMeshBuffer:myNormalVbo->Buffer()   offset:myNormalVbo->Offset()   atIndex:2];
+    }
+    myMeshlets->Draw(anEncoder, theWorkspace->ToCullBackFaces());
+    theWorkspace->RestorePipelineState();
+    return;
+  }
+
+  // Wide and dashed lines are expanded into screen-space quads - single instanced draw of all segments,
+  // hairlines are rasterized as line primitives
+  if (!myLineSegments.IsNull()
+   && theWorkspace->ApplyWideLinePipelineState())
+  {
+    [anEncoder setVertexBuffer:myLineSegments->Buffer() offset:myLineSegments->Offset() atIndex:12];
+    [anEncoder drawPrimitives:MTLPrimitiveTypeTriangleStrip
+                  vertexStart:0
+                  vertexCount:4
+                instanceCount:static_cast<NSUInteger>(myNbLineSegments)];
+    theWorkspace->RestorePipelineState();
+    return;
+  }
+
+  // Octahedral normals are decoded by dedicated vertex functions;
+  // the array is skipped rather than drawn with pipeline reading float normals
+  if (HasOctahedralNormals())
+  {
+    if (theWorkspace->ApplyOctNormalsPipelineState())
+    {
+      encodeDraw(anEncoder);
+    }
+    theWorkspace->RestorePipelineState();
+    return;
+  }
+
+  encodeDraw(anEncoder);
+}
+
+// =======================================================================
+// function : updateBuffers
+// purpose  :
+// =======================================================================
+void Metal_PrimitiveArray::updateBuffers(Metal_Context* theCtx) const
+{
+  // vertices might be appended or removed within capacity of buffers allocated by Init()
+  if (!myPositionVbo.IsNull())
+  {
+    myNbVertices = std::min(static_cast<int>(myAttribs->NbElements), myPositionVbo->GetElemsNb());
+  }
+
+  const Graphic3d_BufferRange aRange = myAttribs->InvalidatedRange();
+  if (aRange.IsEmpty())
+  {
+    return;
+  }
+
+  // array modified again while previous upload might be still read by frames in flight
+  // is updated every frame - rotate its copies instead of overwriting buffers in use
+  const uint64_t aFrame   = theCtx->FrameNumber() + 1;
+  const int      aNbSlots = std::max(theCtx->Caps()->maxFramesInFlight, 1);
+  if (myDynamicSlots.empty()
+   && aNbSlots > 1
+   && myUpdateFrame != 0
+   && aFrame != myUpdateFrame
+   && aFrame - myUpdateFrame < uint64_t(aNbSlots))
+  {
+    createDynamicSlots(theCtx, aNbSlots);
+  }
+
+  if (myDynamicSlots.empty())
+  {
+    // single copy is updated in-place, so that frames still in flight might show new values
+    // (like the next scalar field of an animated color map) one frame earlier
+    const occ::handle<Metal_VertexBuffer> aVbos[4] = { myPositionVbo, myNormalVbo, myColorVbo, myTexCoordVbo };
+    uploadRange(theCtx, aVbos, aRange);
+  }
+  else
+  {
+    // copies not uploaded now catch up with the range on their turn;
+    // repeated modification within the same frame updates the current copy
+    for (size_t aSlotIter = 0; aSlotIter < myDynamicSlots.size(); ++aSlotIter)
+    {
+      myDynamicSlots[aSlotIter].Pending.Unite(aRange);
+    }
+    if (aFrame != myUpdateFrame)
+    {
+      myDynamicSlot = (myDynamicSlot + 1) % int(myDynamicSlots.size());
+    }
+
+    DynamicSlot& aSlot = myDynamicSlots[myDynamicSlot];
+    uploadRange(theCtx, aSlot.Vbos, aSlot.Pending);
+    aSlot.Pending.Clear();
+    myPositionVbo = aSlot.Vbos[0];
+    myNormalVbo   = aSlot.Vbos[1];
+    myColorVbo    = aSlot.Vbos[2];
+    myTexCoordVbo = aSlot.Vbos[3];
+  }
+  myUpdateFrame = aFrame;
+  myAttribs->Validate();
+}
+
+// =======================================================================
+// function : uploadRange
+// purpose  :
+// =======================================================================
+void Metal_PrimitiveArray::uploadRange(Metal_Context* theCtx,
+                                       const occ::handle<Metal_VertexBuffer>* theVbos,
+                                       const Graphic3d_BufferRange& theRange) const
+{
+  if (theRange.IsEmpty())
+  {
+    return;
+  }
+
+  for (int anAttribIdx = 0; anAttribIdx < myAttribs->NbAttributes; ++anAttribIdx)
+  {
+    const Graphic3d_Attribute& anAttrib = myAttribs->Attribute(anAttribIdx);
+    const int aVboIndex = attribVboIndex(anAttrib.Id);
+    const occ::handle<Metal_VertexBuffer>* aVbo = aVboIndex >= 0 ? &theVbos[aVboIndex] : nullptr;
+    if (aVbo == nullptr || aVbo->IsNull() || !(*aVbo)->IsValid())
+    {
+      continue;
+    }
+
+    // byte range of the attribute within interleaved or non-interleaved buffer
+    const int    anAttribStride = Graphic3d_Attribute::Stride(anAttrib.DataType);
+    const int    aStride  = myAttribs->IsInterleaved() ? myAttribs->Stride : anAttribStride;
+    const size_t anOffset = myAttribs->IsInterleaved()
+                          ? size_t(myAttribs->AttributeOffset(anAttribIdx))
+                          : size_t(myAttribs->AttributeOffset(anAttribIdx)) * size_t(myAttribs->NbMaxElements());
+    const size_t aBlockStart = myAttribs->IsInterleaved() ? 0 : anOffset;
+    const size_t aBlockEnd   = aBlockStart + size_t(aStride) * size_t((*aVbo)->GetElemsNb());
+    const size_t aRangeStart = std::max(size_t(theRange.Start), aBlockStart);
+    const size_t aRangeEnd   = std::min(size_t(theRange.Upper()) + 1, aBlockEnd);
+    if (aRangeStart >= aRangeEnd)
+    {
+      continue;
+    }
+
+    const int anElemFrom  = int((aRangeStart - aBlockStart) / size_t(aStride));
+    const int anElemUpper = int((aRangeEnd - aBlockStart - 1) / size_t(aStride));
+    (*aVbo)->SubData(theCtx, aStride, anElemFrom, anElemUpper - anElemFrom + 1,
+                     myAttribs->Data() + anOffset + size_t(anElemFrom) * size_t(aStride));
+  }
+}
+
+// =======================================================================
+// function : createDynamicSlots
+// purpose  :
+// =======================================================================
+bool Metal_PrimitiveArray::createDynamicSlots(Metal_Context* theCtx,
+                                              int theNbSlots) const
+{
+  std::vector<DynamicSlot> aSlots(size_t(theNbSlots));
+  aSlots[0].Vbos[0] = myPositionVbo;
+  aSlots[0].Vbos[1] = myNormalVbo;
+  aSlots[0].Vbos[2] = myColorVbo;
+  aSlots[0].Vbos[3] = myTexCoordVbo;
+
+  // copies are created from the current CPU data, so that they are up-to-date with it
+  for (int aSlotIter = 1; aSlotIter < theNbSlots; ++aSlotIter)
+  {
+    for (int anAttribIdx = 0; anAttribIdx < myAttribs->NbAttributes; ++anAttribIdx)
+    {
+      const Graphic3d_Attribute& anAttrib = myAttribs->Attribute(anAttribIdx);
+      const int aVboIndex = attribVboIndex(anAttrib.Id);
+      if (aVboIndex < 0
+       || aSlots[0].Vbos[aVboIndex].IsNull()
+       || !aSlots[0].Vbos[aVboIndex]->IsValid())
+      {
+        continue;
+      }
+
+      const int    aStride  = myAttribs->IsInterleaved() ? myAttribs->Stride : Graphic3d_Attribute::Stride(anAttrib.DataType);
+      const size_t anOffset = myAttribs->IsInterleaved()
+                            ? size_t(myAttribs->AttributeOffset(anAttribIdx))
+                            : size_t(myAttribs->AttributeOffset(anAttribIdx)) * size_t(myAttribs->NbMaxElements());
+      occ::handle<Metal_VertexBuffer>& aVbo = aSlots[aSlotIter].Vbos[aVboIndex];
+      aVbo = new Metal_VertexBuffer();
+      if (!aVbo->Init(theCtx, anAttrib.DataType, aStride, aSlots[0].Vbos[aVboIndex]->GetElemsNb(),
+                      myAttribs->Data() + anOffset, true))
+      {
+        // keep updating the single copy in-place
+        for (size_t aCopyIter = 1; aCopyIter < aSlots.size(); ++aCopyIter)
+        {
+          for (int aVboIter = 0; aVboIter < 4; ++aVboIter)
+          {
+            if (!aSlots[aCopyIter].Vbos[aVboIter].IsNull())
+            {
+              aSlots[aCopyIter].Vbos[aVboIter]->Release(theCtx);
+            }
+          }
+        }
+        return false;
+      }
+    }
+  }
+
+  myDynamicSlots.swap(aSlots);
+  myDynamicSlot = 0;
+  return true;
+}
+
+// =======================================================================
+// function : DrawPositions
+// purpose  : Encode draw call with positions only
+// =======================================================================
+void Metal_PrimitiveArray::DrawPositions(id<MTLRenderCommandEncoder> theEncoder) const
+{
+  if (!myIsInitialized
+   || myPositionVbo.IsNull() || !myPositionVbo->IsValid())
+  {
+    return;
+  }
+
+  [theEncoder setVertexBuffer:myPositionVbo->Buffer()
+                       offset:myPositionVbo->Offset()
+                      atIndex:0];
+  encodeDraw(theEncoder);
+}
+
+// =======================================================================
+// function : encodeDraw
+// purpose  : Encode draw call of the primitive array
+// =======================================================================
+void Metal_PrimitiveArray::encodeDraw(id<MTLRenderCommandEncoder> anEncoder,
+                                      NSUInteger theNbInstances) const
+{
   MTLPrimitiveType aPrimType = MetalPrimitiveType();
 
   NSLog(@"Metal_PrimitiveArray::Render: type=%d nbVerts=%d nbIndices=%d positionVbo=%p indexBuffer=%p",
@@ -476,7 +1151,8 @@ void Metal_PrimitiveArray::Render(Metal_Workspace* theWorkspace) const
                           indexCount:static_cast<NSUInteger>(myNbFanTriIndices)
                            indexType:MTLIndexTypeUInt32
                          indexBuffer:myConvertedFanBuffer->Buffer()
-                   indexBufferOffset:0];
+                   indexBufferOffset:myConvertedFanBuffer->Offset()
+                       instanceCount:theNbInstances];
   }
   else if (!myIndexBuffer.IsNull() && myIndexBuffer->IsValid())
   {
@@ -487,7 +1163,8 @@ void Metal_PrimitiveArray::Render(Metal_Workspace* theWorkspace) const
                           indexCount:static_cast<NSUInteger>(myNbIndices)
                            indexType:anIndexType
                          indexBuffer:myIndexBuffer->Buffer()
-                   indexBufferOffset:0];
+                   indexBufferOffset:myIndexBuffer->Offset()
+                       instanceCount:theNbInstances];
   }
   else
   {
@@ -495,8 +1172,76 @@ void Metal_PrimitiveArray::Render(Metal_Workspace* theWorkspace) const
     NSLog(@"Metal_PrimitiveArray::Render: non-indexed draw, %d vertices, type=%d", myNbVertices, (int)aPrimType);
     [anEncoder drawPrimitives:aPrimType
                   vertexStart:0
-                  vertexCount:static_cast<NSUInteger>(myNbVertices)];
+                  vertexCount:static_cast<NSUInteger>(myNbVertices)
+                instanceCount:theNbInstances];
+  }
+}
+
+// =======================================================================
+// function : EncodeIndirect
+// purpose  : Encode draw call into indirect render command
+// =======================================================================
+bool Metal_PrimitiveArray::EncodeIndirect(id<MTLIndirectRenderCommand> theCmd,
+                                          NSMutableArray* theResources) const
+{
+  // recorded pipelines read float normals
+  if (!myIsInitialized || theCmd == nil
+   || myPositionVbo.IsNull() || !myPositionVbo->IsValid()
+   || HasOctahedralNormals())
+  {
+    return false;
+  }
+
+  // same buffer indices as within Render()
+  const occ::handle<Metal_VertexBuffer> aVbos[4] = { myPositionVbo, myNormalVbo, myColorVbo, myTexCoordVbo };
+  const NSUInteger aVboIndices[4] = { 0, 2, 4, 5 };
+  for (int aVboIter = 0; aVboIter < 4; ++aVboIter)
+  {
+    if (!aVbos[aVboIter].IsNull() && aVbos[aVboIter]->IsValid())
+    {
+      [theCmd setVertexBuffer:aVbos[aVboIter]->Buffer() offset:aVbos[aVboIter]->Offset() atIndex:aVboIndices[aVboIter]];
+      [theResources addObject:aVbos[aVboIter]->Buffer()];
+    }
+  }
+
+  if (myType == Graphic3d_TOPA_TRIANGLEFANS
+   && !myConvertedFanBuffer.IsNull() && myConvertedFanBuffer->IsValid())
+  {
+    [theCmd drawIndexedPrimitives:MTLPrimitiveTypeTriangle
+                       indexCount:static_cast<NSUInteger>(myNbFanTriIndices)
+                        indexType:MTLIndexTypeUInt32
+                      indexBuffer:myConvertedFanBuffer->Buffer()
+                indexBufferOffset:myConvertedFanBuffer->Offset()
+                    instanceCount:1
+                       baseVertex:0
+                     baseInstance:0];
+    [theResources addObject:myConvertedFanBuffer->Buffer()];
+  }
+  else if (!myIndexBuffer.IsNull() && myIndexBuffer->IsValid())
+  {
+    [theCmd drawIndexedPrimitives:MetalPrimitiveType()
+                       indexCount:static_cast<NSUInteger>(myNbIndices)
+                        indexType:myIndexBuffer->MetalIndexType()
+                      indexBuffer:myIndexBuffer->Buffer()
+                indexBufferOffset:myIndexBuffer->Offset()
+                    instanceCount:1
+                       baseVertex:0
+                     baseInstance:0];
+    [theResources addObject:myIndexBuffer->Buffer()];
+  }
+  else if (myNbVertices > 0)
+  {
+    [theCmd drawPrimitives:MetalPrimitiveType()
+               vertexStart:0
+               vertexCount:static_cast<NSUInteger>(myNbVertices)
+             instanceCount:1
+              baseInstance:0];
+  }
+  else
+  {
+    return false;
   }
+  return true;
 }
 
 // =======================================================================
@@ -512,7 +1257,8 @@ void Metal_PrimitiveArray::RenderInstanced(Metal_Workspace* theWorkspace,
     return;
   }
 
-  if (theInstanceBuffer.IsNull() || !theInstanceBuffer->IsValid())
+  if (theInstanceBuffer.IsNull() || !theInstanceBuffer->IsValid()
+   || !myPointCloud.IsNull())
   {
     // Fall back to single instance if no instance buffer
     Render(theWorkspace);
@@ -529,25 +1275,25 @@ void Metal_PrimitiveArray::RenderInstanced(Metal_Workspace* theWorkspace,
   if (!myPositionVbo.IsNull() && myPositionVbo->IsValid())
   {
     [anEncoder setVertexBuffer:myPositionVbo->Buffer()
-                        offset:0
+                        offset:myPositionVbo->Offset()
                        atIndex:0];  // positions at index 0
   }
   if (!myNormalVbo.IsNull() && myNormalVbo->IsValid())
   {
     [anEncoder setVertexBuffer:myNormalVbo->Buffer()
-                        offset:0
+                        offset:myNormalVbo->Offset()
                        atIndex:2];  // normals at index 2
   }
   if (!myColorVbo.IsNull() && myColorVbo->IsValid())
   {
     [anEncoder setVertexBuffer:myColorVbo->Buffer()
-                        offset:0
+                        offset:myColorVbo->Offset()
                        atIndex:4];  // colors at index 4
   }
   if (!myTexCoordVbo.IsNull() && myTexCoordVbo->IsValid())
   {
     [anEncoder setVertexBuffer:myTexCoordVbo->Buffer()
-                        offset:0
+                        offset:myTexCoordVbo->Offset()
                        atIndex:5];  // texcoords at index 5
   }
 
@@ -557,28 +1303,7 @@ void Metal_PrimitiveArray::RenderInstanced(Metal_Workspace* theWorkspace,
                      atIndex:theInstanceBufferIndex];
 
   // Draw with instancing
-  MTLPrimitiveType aPrimType = MetalPrimitiveType();
-  NSUInteger anInstanceCount = static_cast<NSUInteger>(theInstanceBuffer->InstanceCount());
-
-  if (!myIndexBuffer.IsNull() && myIndexBuffer->IsValid())
-  {
-    // Indexed instanced drawing
-    MTLIndexType anIndexType = myIndexBuffer->MetalIndexType();
-    [anEncoder drawIndexedPrimitives:aPrimType
-                          indexCount:static_cast<NSUInteger>(myNbIndices)
-                           indexType:anIndexType
-                         indexBuffer:myIndexBuffer->Buffer()
-                   indexBufferOffset:0
-                       instanceCount:anInstanceCount];
-  }
-  else
-  {
-    // Non-indexed instanced drawing
-    [anEncoder drawPrimitives:aPrimType
-                  vertexStart:0
-                  vertexCount:static_cast<NSUInteger>(myNbVertices)
-                instanceCount:anInstanceCount];
-  }
+  encodeDraw(anEncoder, static_cast<NSUInteger>(theInstanceBuffer->InstanceCount()));
 }
 
 // =======================================================================
@@ -603,7 +1328,7 @@ void Metal_PrimitiveArray::RenderEdges(Metal_Workspace* theWorkspace) const
   if (!myPositionVbo.IsNull() && myPositionVbo->IsValid())
   {
     [anEncoder setVertexBuffer:myPositionVbo->Buffer()
-                        offset:0
+                        offset:myPositionVbo->Offset()
                        atIndex:aBufferIdx++];
   }
 
@@ -621,7 +1346,7 @@ void Metal_PrimitiveArray::RenderEdges(Metal_Workspace* theWorkspace) const
                               indexCount:static_cast<NSUInteger>(myNbEdgeIndices)
                                indexType:MTLIndexTypeUInt32
                              indexBuffer:myEdgeIndexBuffer->Buffer()
-                       indexBufferOffset:0];
+                       indexBufferOffset:myEdgeIndexBuffer->Offset()];
       }
       else if (!myIndexBuffer.IsNull() && myIndexBuffer->IsValid())
       {
@@ -633,7 +1358,7 @@ void Metal_PrimitiveArray::RenderEdges(Metal_Workspace* theWorkspace) const
                               indexCount:static_cast<NSUInteger>(myNbIndices)
                                indexType:anIndexType
                              indexBuffer:myIndexBuffer->Buffer()
-                       indexBufferOffset:0];
+                       indexBufferOffset:myIndexBuffer->Offset()];
 
         [anEncoder setTriangleFillMode:MTLTriangleFillModeFill];
       }
@@ -663,7 +1388,7 @@ void Metal_PrimitiveArray::RenderEdges(Metal_Workspace* theWorkspace) const
                               indexCount:static_cast<NSUInteger>(myNbIndices)
                                indexType:anIndexType
                              indexBuffer:myIndexBuffer->Buffer()
-                       indexBufferOffset:0];
+                       indexBufferOffset:myIndexBuffer->Offset()];
       }
       else
       {
@@ -690,7 +1415,7 @@ void Metal_PrimitiveArray::RenderEdges(Metal_Workspace* theWorkspace) const
                               indexCount:static_cast<NSUInteger>(myNbIndices)
                                indexType:anIndexType
                              indexBuffer:myIndexBuffer->Buffer()
-                       indexBufferOffset:0];
+                       indexBufferOffset:myIndexBuffer->Offset()];
       }
       else
       {
@@ -710,7 +1435,7 @@ void Metal_PrimitiveArray::RenderEdges(Metal_Workspace* theWorkspace) const
                               indexCount:static_cast<NSUInteger>(myNbIndices)
                                indexType:anIndexType
                              indexBuffer:myIndexBuffer->Buffer()
-                       indexBufferOffset:0];
+                       indexBufferOffset:myIndexBuffer->Offset()];
       }
       else
       {
@@ -750,49 +1475,67 @@ void Metal_PrimitiveArray::RenderMeshEdges(Metal_Workspace* theWorkspace) const
     return;
   }
 
+  if (myMeshEdgesBuffer.IsNull())
+  {
+    RenderEdges(theWorkspace);
+    return;
+  }
+
   id<MTLRenderCommandEncoder> anEncoder = theWorkspace->ActiveEncoder();
   if (anEncoder == nil)
   {
     return;
   }
 
-  // For MeshEdges, we need to process the triangles through the geometry emulator
-  // which computes edge distances for each vertex.
-  // The processed vertices are then rendered with the wireframe overlay shader.
+  // Unrolled triangles hold barycentric coordinates of their corners, converted into pixel distances
+  // to triangle edges by wireframe fragment shader; uniforms are bound at buffer(1) as for other shaders
+  [anEncoder setVertexBuffer:myMeshEdgesBuffer->Buffer()
+                      offset:myMeshEdgesBuffer->Offset()
+                     atIndex:0];
+  [anEncoder drawPrimitives:MTLPrimitiveTypeTriangle
+                vertexStart:0
+                vertexCount:myMeshEdgesBuffer->GetSize() / Metal_GeometryEmulator::VertexSize()];
+}
 
-  // Bind position buffer
-  if (!myPositionVbo.IsNull() && myPositionVbo->IsValid())
+// =======================================================================
+// function : InitMeshEdges
+// purpose  : Prepare persistent buffer for MeshEdges rendering
+// =======================================================================
+bool Metal_PrimitiveArray::InitMeshEdges(Metal_Context* theCtx,
+                                         const occ::handle<Metal_GeometryEmulator>& theEmulator)
+{
+  if (!myMeshEdgesBuffer.IsNull())
   {
-    [anEncoder setVertexBuffer:myPositionVbo->Buffer()
-                        offset:0
-                       atIndex:0];
+    return true;
   }
-
-  // Bind normal buffer if available
-  if (!myNormalVbo.IsNull() && myNormalVbo->IsValid())
+  if (!myIsInitialized
+   || myType != Graphic3d_TOPA_TRIANGLES
+   || theEmulator.IsNull()
+   || !theEmulator->IsValid())
   {
-    [anEncoder setVertexBuffer:myNormalVbo->Buffer()
-                        offset:0
-                       atIndex:1];
+    return false;
   }
 
-  // Draw triangles with wireframe overlay shader
-  // The fragment shader uses interpolated edge distances for anti-aliased edges
-  if (!myIndexBuffer.IsNull() && myIndexBuffer->IsValid())
+  const bool hasIndices = !myIndexBuffer.IsNull() && myIndexBuffer->IsValid();
+  const int aNbTris = (hasIndices ? myNbIndices : myNbVertices) / 3;
+  if (aNbTris <= 0)
   {
-    MTLIndexType anIndexType = myIndexBuffer->MetalIndexType();
-    [anEncoder drawIndexedPrimitives:MTLPrimitiveTypeTriangle
-                          indexCount:static_cast<NSUInteger>(myNbIndices)
-                           indexType:anIndexType
-                         indexBuffer:myIndexBuffer->Buffer()
-                   indexBufferOffset:0];
+    return false;
   }
-  else
+
+  myMeshEdgesBuffer = new Metal_Buffer();
+  if (!myMeshEdgesBuffer->Create(theCtx, size_t(aNbTris) * 3 * Metal_GeometryEmulator::VertexSize(),
+                                 nullptr, Metal_StorageMode_Private)
+   || !theEmulator->Prepare(theCtx, myPositionVbo,
+                            HasOctahedralNormals() ? occ::handle<Metal_VertexBuffer>() : myNormalVbo,
+                            hasIndices ? myIndexBuffer : occ::handle<Metal_IndexBuffer>(),
+                            aNbTris, myMeshEdgesBuffer))
   {
-    [anEncoder drawPrimitives:MTLPrimitiveTypeTriangle
-                  vertexStart:0
-                  vertexCount:static_cast<NSUInteger>(myNbVertices)];
+    myMeshEdgesBuffer->Release(theCtx);
+    myMeshEdgesBuffer.Nullify();
+    return false;
   }
+  return true;
 }
 
 // =======================================================================
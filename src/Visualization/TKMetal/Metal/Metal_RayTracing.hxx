@@ -26,6 +26,7 @@
 #endif
 
 class Metal_Context;
+class Graphic3d_RenderingParams;
 
 //! Ray tracing material structure (matches OpenGl_RaytraceMaterial layout).
 //! Padded to 16-byte alignment for Metal buffer access.
@@ -97,6 +98,42 @@ public:
     const uint32_t* theIndices,
     int theTriangleCount);
 
+#ifdef __OBJC__
+  //! Refit acceleration structure to moved or deformed vertices keeping the same triangles,
+  //! which is much cheaper than rebuild; intended for transform-only and deformation-only changes
+  //! (see Metal_Structure::TransformModificationState()).
+  //! Refit is encoded into specified command buffer, to be executed before following Trace().
+  //! @param theCtx Metal context
+  //! @param theCommandBuffer command buffer to encode refit
+  //! @param theVertices new vertex positions (3 floats per vertex)
+  //! @param theVertexCount number of vertices, should match the one of current structure
+  //! @return FALSE if structure does not exist or topology does not match (full rebuild is required)
+  Standard_EXPORT bool RefitAccelerationStructure(Metal_Context* theCtx,
+                                                  id<MTLCommandBuffer> theCommandBuffer,
+                                                  const float* theVertices,
+                                                  int theVertexCount);
+#endif
+
+  //! Start rebuilding acceleration structure for changed topology on a background command queue.
+  //! Current structure (with its material indices and texture coordinates) keeps being used by Trace()
+  //! until the new one is built; SetMaterialIndices() and SetTexCoords() called meanwhile
+  //! define data of the new geometry.
+  //! @param theCtx Metal context
+  //! @param theVertices vertex positions (3 floats per vertex)
+  //! @param theVertexCount number of vertices
+  //! @param theIndices triangle indices (3 per triangle)
+  //! @param theTriangleCount number of triangles
+  //! @return true on success
+  Standard_EXPORT bool RebuildAccelerationStructureAsync(
+    Metal_Context* theCtx,
+    const float* theVertices,
+    int theVertexCount,
+    const uint32_t* theIndices,
+    int theTriangleCount);
+
+  //! Return true if background rebuild has been started and its result is not yet used by Trace().
+  Standard_EXPORT bool IsRebuildPending() const;
+
   //! Set materials for ray tracing.
   //! @param theCtx Metal context
   //! @param theMaterials array of materials
@@ -170,6 +207,83 @@ public:
                              float theFov);
 #endif
 
+  //! Perform progressive ray tracing asynchronously, decoupled from rendering of frames.
+  //! Should be called once per frame with the current camera; the call never waits for GPU.
+  //! While the camera changes, nothing is traced (rasterized frame is expected to be shown);
+  //! once the camera stays unchanged for ProgressiveSettleDelay(), samples are traced
+  //! on a dedicated command queue into an internal image, one dispatch in flight at a time.
+  //! The number of samples per dispatch is adapted to the measured GPU time of previous dispatch,
+  //! so that it fits into ProgressiveBudget() and does not stall frames rendered meanwhile.
+  //! Tracing stops when the image converges (MaxSamples() for path tracing, single sample otherwise).
+  //! Trace() should not be used while progressive tracing is active, as they share intermediate buffers.
+  //! @param theCtx Metal context
+  //! @param theWidth  width of traced image
+  //! @param theHeight height of traced image
+  //! @param theCameraOrigin camera position
+  //! @param theCameraLookAt camera target
+  //! @param theCameraUp camera up vector
+  //! @param theFov field of view in radians
+  //! @return TRUE if progressive image is available for BlendProgressive()
+#ifdef __OBJC__
+  Standard_EXPORT bool TraceProgressive(Metal_Context* theCtx,
+                                        NSUInteger theWidth,
+                                        NSUInteger theHeight,
+                                        const NCollection_Vec3<float>& theCameraOrigin,
+                                        const NCollection_Vec3<float>& theCameraLookAt,
+                                        const NCollection_Vec3<float>& theCameraUp,
+                                        float theFov);
+
+  //! Blend the last completed progressive image over rasterized frame.
+  //! Blending weight grows with the number of accumulated samples (see ProgressiveBlendSamples()),
+  //! so that the traced image fades in as it converges.
+  //! The command buffer should be committed, as progressive dispatches wait for its completion
+  //! before overwriting the image.
+  //! @param theCtx Metal context
+  //! @param theCommandBuffer frame command buffer
+  //! @param theRasterTexture rasterized frame of the same size as traced image
+  //! @param theOutputTexture target texture for composed image
+  //! @return FALSE if nothing has been encoded (no progressive image or size mismatch)
+  Standard_EXPORT bool BlendProgressive(Metal_Context* theCtx,
+                                        id<MTLCommandBuffer> theCommandBuffer,
+                                        id<MTLTexture> theRasterTexture,
+                                        id<MTLTexture> theOutputTexture);
+#endif
+
+  //! Discard progressive image and result of dispatch in flight;
+  //! should be called on scene changes, as only camera changes are detected by TraceProgressive().
+  Standard_EXPORT void ResetProgressive();
+
+  //! Return number of samples per pixel of the progressive image available for blending.
+  uint32_t ProgressiveSamples() const { return myProgressiveSamples; }
+
+  //! Return GPU time budget of a single progressive dispatch in seconds.
+  double ProgressiveBudget() const { return myProgressiveBudget; }
+
+  //! Set GPU time budget of a single progressive dispatch in seconds.
+  //! Default: 1/120 s, a half of the 60 FPS frame interval, leaving another half to rasterized frames.
+  void SetProgressiveBudget(double theSeconds)
+  {
+    myProgressiveBudget = theSeconds > 0.0 ? theSeconds : myProgressiveBudget;
+  }
+
+  //! Return delay in seconds after the last camera change before progressive tracing starts.
+  double ProgressiveSettleDelay() const { return myProgressiveSettleDelay; }
+
+  //! Set delay in seconds after the last camera change before progressive tracing starts. Default: 0.1
+  void SetProgressiveSettleDelay(double theSeconds)
+  {
+    myProgressiveSettleDelay = theSeconds > 0.0 ? theSeconds : 0.0;
+  }
+
+  //! Return number of samples at which progressive image completely replaces rasterized frame.
+  uint32_t ProgressiveBlendSamples() const { return myProgressiveBlendSamples; }
+
+  //! Set number of samples at which progressive image completely replaces rasterized frame. Default: 16
+  void SetProgressiveBlendSamples(uint32_t theNbSamples)
+  {
+    myProgressiveBlendSamples = theNbSamples > 0 ? theNbSamples : 1;
+  }
+
   //! Set maximum ray bounces.
   void SetMaxBounces(int theBounces) { myMaxBounces = theBounces; }
 
@@ -201,9 +315,26 @@ public:
   bool IsPathTracingEnabled() const { return myPathTracingEnabled; }
 
   //! Reset accumulation buffer for path tracing (Phase 9).
-  //! Call this when camera or scene changes.
+  //! Call this when scene changes; camera changes are detected by Trace() itself.
   void ResetAccumulation() { myFrameIndex = 0; }
 
+  //! Enable temporal reprojection of path tracing accumulation on camera motion (Default: true).
+  //! Samples of surfaces visible in the previous view survive camera change,
+  //! while disoccluded pixels (detected by depth and normal) restart accumulation.
+  //! Without reprojection, or in DOF, adaptive sampling and environment map modes,
+  //! camera change resets accumulation.
+  void SetReprojectionEnabled(bool theEnabled) { myReprojectionEnabled = theEnabled; }
+
+  //! Return true if temporal reprojection is enabled.
+  bool IsReprojectionEnabled() const { return myReprojectionEnabled; }
+
+  //! Set maximum number of samples per pixel kept from reprojected history (Default: 64).
+  //! Lower values refresh view-dependent shading faster after camera motion.
+  void SetReprojectionMaxHistory(uint32_t theNbSamples) { myReprojectionMaxHistory = theNbSamples; }
+
+  //! Return maximum number of samples per pixel kept from reprojected history.
+  uint32_t ReprojectionMaxHistory() const { return myReprojectionMaxHistory; }
+
   //! Return current frame index for path tracing accumulation.
   uint32_t FrameIndex() const { return myFrameIndex; }
 
@@ -340,6 +471,54 @@ public:
   //! Return bloom intensity.
   float BloomIntensity() const { return myBloomIntensity; }
 
+  //! Enable denoising of progressive path tracing result (resets accumulation on change).
+  //! Edge-avoiding filter guided by albedo, normal and depth of primary hits
+  //! is applied after accumulation; its strength decreases as samples converge.
+  void SetDenoiserEnabled(bool theEnabled)
+  {
+    if (myDenoiserEnabled != theEnabled)
+    {
+      myDenoiserEnabled = theEnabled;
+      myFrameIndex      = 0;
+    }
+  }
+
+  //! Return true if denoising is enabled.
+  bool IsDenoiserEnabled() const { return myDenoiserEnabled; }
+
+  //! Set number of denoising filter iterations (each doubles filter footprint). Default: 4
+  void SetDenoiserIterations(int theNbIterations) { myDenoiserIterations = theNbIterations; }
+
+  //! Return number of denoising filter iterations.
+  int DenoiserIterations() const { return myDenoiserIterations; }
+
+  //! Apply path tracing options of view rendering parameters:
+  //! global illumination, ray depth, shadows, reflections, adaptive sampling, depth of field and denoising.
+  //! Accumulation is reset when any of them changes.
+  Standard_EXPORT void SetRenderingParams(const Graphic3d_RenderingParams& theParams);
+
+private:
+
+  //! Swap in acceleration structure built in background, if completed.
+  void applyPendingRebuild();
+
+#ifdef __OBJC__
+  //! Return true if denoiser pipelines are available and denoising is enabled.
+  bool isDenoising() const { return myDenoiserEnabled && myDenoiseAOVPipeline != nil && myDenoiseFilterPipeline != nil; }
+
+  //! (Re)allocate denoiser AOV and intermediate textures for the given resolution.
+  bool prepareDenoiser(id<MTLDevice> theDevice, NSUInteger theWidth, NSUInteger theHeight);
+
+  //! (Re)allocate temporal reprojection history for the given accumulation target.
+  bool prepareReprojection(id<MTLDevice> theDevice, id<MTLTexture> theTarget);
+
+  //! Write guiding AOVs of primary intersections and filter accumulated color into target texture.
+  void denoise(Metal_Context* theCtx,
+               id<MTLCommandBuffer> theCommandBuffer,
+               id<MTLTexture> theColor,
+               id<MTLTexture> theTarget);
+#endif
+
 private:
 
 #ifdef __OBJC__
@@ -347,6 +526,15 @@ private:
   MPSTriangleAccelerationStructure* myAccelerationStructure;
   MPSRayIntersector* myRayIntersector;
 
+  // Background rebuild of acceleration structure for changed topology
+  id<MTLCommandQueue>               myBuildQueue;            //!< background queue for rebuilds
+  id<MTLCommandBuffer>              myPendingBuildCommands;  //!< command buffer of pending rebuild
+  MPSTriangleAccelerationStructure* myPendingAccelStructure; //!< structure being rebuilt
+  id<MTLBuffer>                     myPendingVertexBuffer;   //!< vertices of pending structure
+  id<MTLBuffer>                     myPendingIndexBuffer;    //!< indices of pending structure
+  id<MTLBuffer>                     myPendingMaterialIndexBuffer; //!< material indices of pending structure
+  id<MTLBuffer>                     myPendingTexCoordBuffer; //!< texture coordinates of pending structure
+
   // Compute pipeline for ray generation and shading
   id<MTLComputePipelineState> myRayGenPipeline;
   id<MTLComputePipelineState> myShadePipeline;
@@ -374,6 +562,9 @@ private:
   id<MTLComputePipelineState> myBlurHorizontalPipeline;    //!< Phase 14: Bloom horizontal blur
   id<MTLComputePipelineState> myBlurVerticalPipeline;      //!< Phase 14: Bloom vertical blur
   id<MTLComputePipelineState> myApplyBloomPipeline;        //!< Phase 14: Apply bloom
+  id<MTLComputePipelineState> myDenoiseAOVPipeline;        //!< Denoiser: albedo/normal/depth AOVs
+  id<MTLComputePipelineState> myDenoiseFilterPipeline;     //!< Denoiser: edge-avoiding a-trous filter
+  id<MTLComputePipelineState> myReprojectPipeline;         //!< Reprojection: history reprojection
 
   // Buffers
   id<MTLBuffer> myVertexBuffer;
@@ -416,11 +607,40 @@ private:
   id<MTLTexture> myBrightBuffer;             //!< Phase 14: Extracted bright pixels
   id<MTLTexture> myBloomTempBuffer;          //!< Phase 14: Bloom blur temp buffer
 
+  // Denoiser
+  id<MTLTexture> myDenoiseColorBuffer;       //!< Denoiser: noisy accumulated color
+  id<MTLTexture> myDenoiseNormalDepthBuffer; //!< Denoiser: primary hit normal (XYZ) and distance (W)
+  id<MTLTexture> myDenoiseAlbedoBuffer;      //!< Denoiser: primary hit albedo
+  id<MTLTexture> myDenoisePingBuffer;        //!< Denoiser: filter iteration buffer
+  id<MTLTexture> myDenoisePongBuffer;        //!< Denoiser: filter iteration buffer
+
+  // Temporal reprojection
+  id<MTLBuffer>  mySampleCountBuffer;        //!< Reprojection: per-pixel number of accumulated samples
+  id<MTLBuffer>  myHistorySampleCountBuffer; //!< Reprojection: sample counts of previous view
+  id<MTLTexture> myHistoryColorBuffer;       //!< Reprojection: accumulated color of previous view
+  id<MTLTexture> myNormalDepthBuffer;        //!< Reprojection: primary hit normal and distance of current view
+  id<MTLTexture> myHistoryNormalDepthBuffer; //!< Reprojection: primary hit normal and distance of previous view
+
+  // Progressive tracing
+  id<MTLCommandQueue>         myTraceQueue;               //!< Progressive: queue of asynchronous dispatches
+  id<MTLCommandBuffer>        myProgressiveCommands;      //!< Progressive: dispatch in flight
+  id<MTLEvent>                myProgressiveEvent;         //!< Progressive: signaled by frames after blending
+  id<MTLTexture>              myProgressiveFront;         //!< Progressive: completed image for blending
+  id<MTLTexture>              myProgressiveBack;          //!< Progressive: image being traced
+  id<MTLComputePipelineState> myBlendProgressivePipeline; //!< Progressive: blending over rasterized frame
+
   // Shader library
   id<MTLLibrary> myShaderLibrary;
 #else
   void* myAccelerationStructure;
   void* myRayIntersector;
+  void* myBuildQueue;
+  void* myPendingBuildCommands;
+  void* myPendingAccelStructure;
+  void* myPendingVertexBuffer;
+  void* myPendingIndexBuffer;
+  void* myPendingMaterialIndexBuffer;
+  void* myPendingTexCoordBuffer;
   void* myRayGenPipeline;
   void* myShadePipeline;
   void* myShadeNoShadowPipeline;
@@ -447,6 +667,9 @@ private:
   void* myBlurHorizontalPipeline;
   void* myBlurVerticalPipeline;
   void* myApplyBloomPipeline;
+  void* myDenoiseAOVPipeline;
+  void* myDenoiseFilterPipeline;
+  void* myReprojectPipeline;
   void* myVertexBuffer;
   void* myIndexBuffer;
   void* myMaterialBuffer;
@@ -476,11 +699,29 @@ private:
   void* myHDRBuffer;
   void* myBrightBuffer;
   void* myBloomTempBuffer;
+  void* myDenoiseColorBuffer;
+  void* myDenoiseNormalDepthBuffer;
+  void* myDenoiseAlbedoBuffer;
+  void* myDenoisePingBuffer;
+  void* myDenoisePongBuffer;
+  void* mySampleCountBuffer;
+  void* myHistorySampleCountBuffer;
+  void* myHistoryColorBuffer;
+  void* myNormalDepthBuffer;
+  void* myHistoryNormalDepthBuffer;
+  void* myTraceQueue;
+  void* myProgressiveCommands;
+  void* myProgressiveEvent;
+  void* myProgressiveFront;
+  void* myProgressiveBack;
+  void* myBlendProgressivePipeline;
   void* myShaderLibrary;
 #endif
 
   int  myVertexCount;
   int  myTriangleCount;
+  int  myPendingVertexCount;     //!< number of vertices of pending structure
+  int  myPendingTriangleCount;   //!< number of triangles of pending structure
   int  myMaterialCount;
   int  myLightCount;
   int  myMaxBounces;
@@ -510,6 +751,36 @@ private:
   bool myBloomEnabled;             //!< Phase 14: Enable bloom post-process
   float myBloomThreshold;          //!< Phase 14: Bloom brightness threshold
   float myBloomIntensity;          //!< Phase 14: Bloom strength
+  bool myDenoiserEnabled;          //!< Denoiser: filter accumulated path tracing result
+  int myDenoiserIterations;        //!< Denoiser: number of a-trous filter iterations
+  NCollection_Vec3<float> myPrevCameraOrigin; //!< Reprojection: camera origin of previous frame
+  NCollection_Vec3<float> myPrevCameraLookAt; //!< Reprojection: camera target of previous frame
+  NCollection_Vec3<float> myPrevCameraUp;     //!< Reprojection: camera up direction of previous frame
+  float myPrevCameraFov;           //!< Reprojection: field of view of previous frame
+  uint32_t myPrevWidth;            //!< Reprojection: output width of previous frame
+  uint32_t myPrevHeight;           //!< Reprojection: output height of previous frame
+  bool myHasPrevCamera;            //!< Reprojection: previous frame camera is defined
+  bool myHasReprojHistory;         //!< Reprojection: history normal/depth correspond to previous frame
+  bool myReprojectionEnabled;      //!< Reprojection: reproject accumulation on camera motion
+  uint32_t myReprojectionMaxHistory; //!< Reprojection: maximum number of history samples kept
+  uint32_t myFramesSinceMotion;    //!< Reprojection: number of frames since last camera change
+  NCollection_Vec3<float> myProgressiveOrigin; //!< Progressive: camera origin of traced image
+  NCollection_Vec3<float> myProgressiveLookAt; //!< Progressive: camera target of traced image
+  NCollection_Vec3<float> myProgressiveUp;     //!< Progressive: camera up direction of traced image
+  float myProgressiveFov;          //!< Progressive: field of view of traced image
+  uint32_t myProgressiveWidth;     //!< Progressive: width of traced image
+  uint32_t myProgressiveHeight;    //!< Progressive: height of traced image
+  bool myHasProgressiveCamera;     //!< Progressive: camera of traced image is defined
+  bool myIsProgressiveStale;       //!< Progressive: dispatch in flight traces outdated camera
+  uint32_t myProgressiveSamples;   //!< Progressive: samples per pixel of completed image
+  uint32_t myProgressivePendingSamples;  //!< Progressive: samples per pixel of image being traced
+  uint32_t myProgressiveDispatchSamples; //!< Progressive: samples traced by dispatch in flight
+  uint32_t myProgressiveBlendSamples;    //!< Progressive: samples to fully replace rasterized frame
+  uint64_t myProgressiveBlendValue; //!< Progressive: last event value signaled by blending frames
+  double myProgressiveBudget;      //!< Progressive: GPU time budget of single dispatch in seconds
+  double myProgressiveSettleDelay; //!< Progressive: delay after camera change before tracing
+  double myProgressiveMotionTime;  //!< Progressive: time of last camera change
+  double myProgressiveGpuTime;     //!< Progressive: measured GPU time of last completed dispatch
 };
 
 DEFINE_STANDARD_HANDLE(Metal_RayTracing, Standard_Transient)
@@ -13,13 +13,85 @@
 
 #import <Metal/Metal.h>
 #import <MetalPerformanceShaders/MetalPerformanceShaders.h>
+#import <QuartzCore/CABase.h>
 
 #include <Metal_RayTracing.hxx>
 #include <Metal_Context.hxx>
+#include <Graphic3d_RenderingParams.hxx>
 #include <Message.hxx>
 
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
 IMPLEMENT_STANDARD_RTTIEXT(Metal_RayTracing, Standard_Transient)
 
+namespace
+{
+  //! Create triangle acceleration structure (not yet built) allowing refit over new geometry buffers.
+  //! Edge-stopping sensitivity of denoiser to luminance difference at the first sample.
+  static const float THE_DENOISE_COLOR_PHI = 4.0f;
+
+  //! Edge-stopping exponent of denoiser for normal difference.
+  static const float THE_DENOISE_NORMAL_PHI = 64.0f;
+
+  //! Edge-stopping sensitivity of denoiser to relative depth difference.
+  static const float THE_DENOISE_DEPTH_PHI = 0.02f;
+
+  //! Cosine threshold between current and history normals for reprojected sample reuse.
+  static const float THE_REPROJECT_NORMAL_THRESHOLD = 0.9f;
+
+  //! Relative depth difference threshold for reprojected sample reuse.
+  static const float THE_REPROJECT_DEPTH_THRESHOLD = 0.05f;
+
+  //! Maximum number of samples traced by a single progressive dispatch.
+  static const uint32_t THE_PROGRESSIVE_MAX_DISPATCH_SAMPLES = 64;
+
+  //! Create private texture usable as compute shader input and output.
+  static id<MTLTexture> createComputeTexture(id<MTLDevice> theDevice,
+                                             MTLPixelFormat theFormat,
+                                             NSUInteger theWidth,
+                                             NSUInteger theHeight)
+  {
+    MTLTextureDescriptor* aDesc = [MTLTextureDescriptor texture2DDescriptorWithPixelFormat:theFormat
+                                                                                     width:theWidth
+                                                                                    height:theHeight
+                                                                                 mipmapped:NO];
+    aDesc.usage = MTLTextureUsageShaderRead | MTLTextureUsageShaderWrite;
+    aDesc.storageMode = MTLStorageModePrivate;
+    return [theDevice newTextureWithDescriptor:aDesc];
+  }
+
+  static MPSTriangleAccelerationStructure* createTriangleAccelStructure(id<MTLDevice> theDevice,
+                                                                        const float* theVertices,
+                                                                        int theVertexCount,
+                                                                        const uint32_t* theIndices,
+                                                                        int theTriangleCount,
+                                                                        id<MTLBuffer>& theVertexBuffer,
+                                                                        id<MTLBuffer>& theIndexBuffer)
+  {
+    theVertexBuffer = [theDevice newBufferWithBytes:theVertices
+                                             length:static_cast<size_t>(theVertexCount) * 3 * sizeof(float)
+                                            options:MTLResourceStorageModeShared];
+    theIndexBuffer = [theDevice newBufferWithBytes:theIndices
+                                            length:static_cast<size_t>(theTriangleCount) * 3 * sizeof(uint32_t)
+                                           options:MTLResourceStorageModeShared];
+    if (theVertexBuffer == nil || theIndexBuffer == nil)
+    {
+      return nil;
+    }
+
+    MPSTriangleAccelerationStructure* anAccel = [[MPSTriangleAccelerationStructure alloc] initWithDevice:theDevice];
+    anAccel.vertexBuffer = theVertexBuffer;
+    anAccel.vertexStride = sizeof(float) * 3;
+    anAccel.indexBuffer = theIndexBuffer;
+    anAccel.indexType = MPSDataTypeUInt32;
+    anAccel.triangleCount = static_cast<NSUInteger>(theTriangleCount);
+    anAccel.usage = MPSAccelerationStructureUsageRefit;
+    return anAccel;
+  }
+}
+
 // Ray tracing shaders using Metal Performance Shaders
 static const char* RAYTRACING_SHADER_SOURCE = R"(
 #include <metal_stdlib>
@@ -1226,6 +1298,7 @@ kernel void pathTrace(
     constant int* materialIndices [[buffer(6)]],
     constant RaytraceLight* lights [[buffer(7)]],
     device uint* rngSeeds [[buffer(8)]],
+    device uint* sampleCounts [[buffer(9)]],
     uint2 tid [[thread_position_in_grid]])
 {
     if (tid.x >= uint(camera.resolution.x) || tid.y >= uint(camera.resolution.y)) return;
@@ -1308,17 +1381,20 @@ kernel void pathTrace(
     // Save RNG state
     rngSeeds[idx] = seed;
 
-    // Progressive accumulation - read previous accumulated value
+    // Progressive accumulation - read previous accumulated value;
+    // number of samples is tracked per pixel as reprojected history may be partially rejected
+    uint nbSamples = camera.frameIndex > 0 ? sampleCounts[idx] : 0u;
     float3 prevColor = float3(0.0f);
-    if (camera.frameIndex > 0) {
+    if (nbSamples > 0) {
         // Read previous accumulated color (in linear space)
         float4 prev = output.read(tid);
         // Convert from gamma back to linear for accumulation
         prevColor = pow(prev.rgb, float3(2.2f));
     }
+    sampleCounts[idx] = nbSamples + 1;
 
     // Running average: new = old * (n/(n+1)) + sample * (1/(n+1))
-    float weight = 1.0f / float(camera.frameIndex + 1);
+    float weight = 1.0f / float(nbSamples + 1);
     float3 accumulatedColor = prevColor * (1.0f - weight) + radiance * weight;
 
     // Write to output with gamma correction
@@ -1338,6 +1414,7 @@ kernel void pathTraceBSDF(
     constant int* materialIndices [[buffer(6)]],
     constant RaytraceLight* lights [[buffer(7)]],
     device uint* rngSeeds [[buffer(8)]],
+    device uint* sampleCounts [[buffer(9)]],
     uint2 tid [[thread_position_in_grid]])
 {
     if (tid.x >= uint(camera.resolution.x) || tid.y >= uint(camera.resolution.y)) return;
@@ -1448,14 +1525,16 @@ kernel void pathTraceBSDF(
     // Save RNG state
     rngSeeds[idx] = seed;
 
-    // Progressive accumulation
+    // Progressive accumulation with per-pixel number of samples
+    uint nbSamples = camera.frameIndex > 0 ? sampleCounts[idx] : 0u;
     float3 prevColor = float3(0.0f);
-    if (camera.frameIndex > 0) {
+    if (nbSamples > 0) {
         float4 prev = output.read(tid);
         prevColor = pow(prev.rgb, float3(2.2f));
     }
+    sampleCounts[idx] = nbSamples + 1;
 
-    float weight = 1.0f / float(camera.frameIndex + 1);
+    float weight = 1.0f / float(nbSamples + 1);
     float3 accumulatedColor = prevColor * (1.0f - weight) + radiance * weight;
 
     // Gamma correction
@@ -1463,6 +1542,86 @@ kernel void pathTraceBSDF(
     output.write(float4(saturate(displayColor), 1.0f), tid);
 }
 
+// Temporal reprojection parameters (previous camera of path tracing history)
+struct ReprojectParams {
+    float3 prevOrigin;
+    float3 prevForward;
+    float3 prevRight;
+    float3 prevUp;
+    float2 prevHalfExtent;  // half width and height of previous image plane at unit distance
+    float2 resolution;
+    int    isCameraMoved;   // 0 means only primary hit normal and depth should be stored
+    uint   maxHistory;      // maximum number of samples kept from reprojected history
+    float  normalThreshold; // minimal cosine between current and history normals
+    float  depthThreshold;  // maximal relative difference between current and history depths
+};
+
+// Reproject accumulated history into current view with depth/normal disocclusion rejection;
+// also stores primary hit normal and distance for reprojection of the next frame
+kernel void reprojectHistory(
+    texture2d<float, access::read> historyColor [[texture(0)]],
+    texture2d<float, access::write> output [[texture(1)]],
+    texture2d<float, access::read> historyNormalDepth [[texture(2)]],
+    texture2d<float, access::write> normalDepth [[texture(3)]],
+    device const Intersection* intersections [[buffer(0)]],
+    device const Ray* rays [[buffer(1)]],
+    constant packed_float3* vertices [[buffer(2)]],
+    constant uint* indices [[buffer(3)]],
+    device const uint* historyCounts [[buffer(4)]],
+    device uint* sampleCounts [[buffer(5)]],
+    constant ReprojectParams& params [[buffer(6)]],
+    uint2 tid [[thread_position_in_grid]])
+{
+    uint width = uint(params.resolution.x);
+    uint height = uint(params.resolution.y);
+    if (tid.x >= width || tid.y >= height) return;
+
+    uint idx = tid.y * width + tid.x;
+    Intersection isect = intersections[idx];
+    if (isect.distance < 0.0f) {
+        // background is not accumulated from history
+        normalDepth.write(float4(0.0f, 0.0f, 0.0f, -1.0f), tid);
+        if (params.isCameraMoved != 0) {
+            sampleCounts[idx] = 0;
+        }
+        return;
+    }
+
+    uint triIdx = uint(isect.primitiveIndex);
+    float3 v0 = float3(vertices[indices[triIdx * 3 + 0]]);
+    float3 v1 = float3(vertices[indices[triIdx * 3 + 1]]);
+    float3 v2 = float3(vertices[indices[triIdx * 3 + 2]]);
+    float3 rayDir = normalize(float3(rays[idx].direction));
+    float3 normal = normalize(cross(v1 - v0, v2 - v0));
+    if (dot(normal, rayDir) > 0.0f) {
+        normal = -normal;
+    }
+    normalDepth.write(float4(normal, isect.distance), tid);
+    if (params.isCameraMoved == 0) return;
+
+    // Project hit point onto previous image plane (inverse of pathTraceRayGen mapping)
+    float3 hitPoint = float3(rays[idx].origin) + rayDir * isect.distance;
+    float3 toHit = hitPoint - params.prevOrigin;
+    float viewZ = dot(toHit, params.prevForward);
+    uint nbSamples = 0;
+    if (viewZ > 0.0f) {
+        float2 ndc = float2( dot(toHit, params.prevRight) / (viewZ * params.prevHalfExtent.x),
+                            -dot(toHit, params.prevUp)    / (viewZ * params.prevHalfExtent.y));
+        int2 prevPix = int2(floor((ndc * 0.5f + 0.5f) * params.resolution));
+        if (prevPix.x >= 0 && prevPix.y >= 0 && prevPix.x < int(width) && prevPix.y < int(height)) {
+            float4 prevND = historyNormalDepth.read(uint2(prevPix));
+            float hitDist = length(toHit);
+            if (prevND.w >= 0.0f
+             && dot(prevND.xyz, normal) > params.normalThreshold
+             && abs(prevND.w - hitDist) < params.depthThreshold * hitDist) {
+                nbSamples = min(historyCounts[uint(prevPix.y) * width + uint(prevPix.x)], params.maxHistory);
+                output.write(historyColor.read(uint2(prevPix)), tid);
+            }
+        }
+    }
+    sampleCounts[idx] = nbSamples;
+}
+
 // ==========================================================================
 // Phase 11: Adaptive Sampling with Variance Tracking
 // ==========================================================================
@@ -2391,6 +2550,138 @@ kernel void applyBloom(
     float3 result = base + bloomColor * params.bloomIntensity;
     output.write(float4(saturate(result), 1.0f), tid);
 }
+
+// Progressive tracing: fade traced image in over rasterized frame
+kernel void blendProgressive(
+    texture2d<float, access::read> raster [[texture(0)]],
+    texture2d<float, access::read> traced [[texture(1)]],
+    texture2d<float, access::write> output [[texture(2)]],
+    constant float& weight [[buffer(0)]],
+    uint2 tid [[thread_position_in_grid]])
+{
+    if (tid.x >= output.get_width() || tid.y >= output.get_height()) return;
+
+    float4 base = raster.read(tid);
+    float3 color = mix(base.rgb, traced.read(tid).rgb, weight);
+    output.write(float4(color, base.a), tid);
+}
+
+// ==========================================================================
+// Denoiser: edge-avoiding a-trous wavelet filter guided by primary hit AOVs
+// ==========================================================================
+
+struct DenoiseParams {
+    int   stepSize;    // distance between filter taps, doubled on each iteration
+    int   isFirstPass; // input is gamma-encoded accumulated color
+    int   isLastPass;  // output is gamma-encoded display color
+    float colorPhi;    // luminance edge-stopping sensitivity
+    float normalPhi;   // normal edge-stopping exponent
+    float depthPhi;    // relative depth edge-stopping sensitivity
+    uint  pad0;
+    uint  pad1;
+};
+
+// Write albedo, normal and depth of primary hits (distance < 0 marks background)
+kernel void denoiseAOVs(
+    texture2d<float, access::write> normalDepth [[texture(0)]],
+    texture2d<float, access::write> albedoAOV [[texture(1)]],
+    device const Intersection* intersections [[buffer(0)]],
+    device const Ray* rays [[buffer(1)]],
+    constant packed_float3* vertices [[buffer(2)]],
+    constant uint* indices [[buffer(3)]],
+    constant RaytraceMaterial* materials [[buffer(4)]],
+    constant int* materialIndices [[buffer(5)]],
+    uint2 tid [[thread_position_in_grid]])
+{
+    uint width = normalDepth.get_width();
+    uint height = normalDepth.get_height();
+    if (tid.x >= width || tid.y >= height) return;
+
+    uint idx = tid.y * width + tid.x;
+    Intersection isect = intersections[idx];
+    if (isect.distance < 0.0f) {
+        normalDepth.write(float4(0.0f, 0.0f, 0.0f, -1.0f), tid);
+        albedoAOV.write(float4(1.0f), tid);
+        return;
+    }
+
+    uint triIdx = uint(isect.primitiveIndex);
+    float3 v0 = float3(vertices[indices[triIdx * 3 + 0]]);
+    float3 v1 = float3(vertices[indices[triIdx * 3 + 1]]);
+    float3 v2 = float3(vertices[indices[triIdx * 3 + 2]]);
+    float3 normal = normalize(cross(v1 - v0, v2 - v0));
+    if (dot(normal, float3(rays[idx].direction)) > 0.0f) {
+        normal = -normal;
+    }
+
+    float3 albedo = materials[materialIndices[triIdx]].diffuse.rgb;
+    normalDepth.write(float4(normal, isect.distance), tid);
+    albedoAOV.write(float4(albedo, 1.0f), tid);
+}
+
+// Demodulated linear color of the pixel at the first filter iteration
+inline float3 denoiseInput(texture2d<float, access::read> input,
+                           texture2d<float, access::read> albedoAOV,
+                           uint2 pos, int isFirstPass)
+{
+    float3 color = input.read(pos).rgb;
+    if (isFirstPass != 0) {
+        color = pow(color, float3(2.2f)) / max(albedoAOV.read(pos).rgb, float3(0.01f));
+    }
+    return color;
+}
+
+// One iteration of 5x5 B3-spline a-trous filter with luminance, normal and depth edge-stopping
+kernel void denoiseFilter(
+    texture2d<float, access::read> input [[texture(0)]],
+    texture2d<float, access::write> output [[texture(1)]],
+    texture2d<float, access::read> normalDepth [[texture(2)]],
+    texture2d<float, access::read> albedoAOV [[texture(3)]],
+    constant DenoiseParams& params [[buffer(0)]],
+    uint2 tid [[thread_position_in_grid]])
+{
+    int width = int(input.get_width());
+    int height = int(input.get_height());
+    if (int(tid.x) >= width || int(tid.y) >= height) return;
+
+    const float kernelWeights[3] = { 3.0f / 8.0f, 1.0f / 4.0f, 1.0f / 16.0f };
+    const float3 lumWeights = float3(0.2126f, 0.7152f, 0.0722f);
+
+    float4 centerND = normalDepth.read(tid);
+    float3 centerColor = denoiseInput(input, albedoAOV, tid, params.isFirstPass);
+    float3 result = centerColor;
+    if (centerND.w >= 0.0f) {
+        float centerLum = dot(centerColor, lumWeights);
+        float depthScale = params.depthPhi * max(centerND.w, 1.0e-3f) * float(params.stepSize);
+        float3 sum = float3(0.0f);
+        float weightSum = 0.0f;
+        for (int dy = -2; dy <= 2; ++dy) {
+            for (int dx = -2; dx <= 2; ++dx) {
+                int2 p = int2(tid) + int2(dx, dy) * params.stepSize;
+                if (p.x < 0 || p.y < 0 || p.x >= width || p.y >= height) continue;
+
+                float4 nd = normalDepth.read(uint2(p));
+                if (nd.w < 0.0f) continue;
+
+                float3 color = denoiseInput(input, albedoAOV, uint2(p), params.isFirstPass);
+                float wColor = exp(-abs(centerLum - dot(color, lumWeights)) / params.colorPhi);
+                float wNormal = pow(max(dot(centerND.xyz, nd.xyz), 0.0f), params.normalPhi);
+                float wDepth = exp(-abs(centerND.w - nd.w) / depthScale);
+                float w = kernelWeights[abs(dx)] * kernelWeights[abs(dy)] * wColor * wNormal * wDepth;
+                sum += color * w;
+                weightSum += w;
+            }
+        }
+        if (weightSum > 0.0f) {
+            result = sum / weightSum;
+        }
+    }
+
+    if (params.isLastPass != 0) {
+        result = pow(saturate(result * albedoAOV.read(tid).rgb), float3(1.0f / 2.2f));
+    }
+    output.write(float4(result, 1.0f), tid);
+}
 )";
 
 // =======================================================================
@@ -2400,6 +2691,13 @@ kernel void applyBloom(
 Metal_RayTracing::Metal_RayTracing()
 : myAccelerationStructure(nil),
   myRayIntersector(nil),
+  myBuildQueue(nil),
+  myPendingBuildCommands(nil),
+  myPendingAccelStructure(nil),
+  myPendingVertexBuffer(nil),
+  myPendingIndexBuffer(nil),
+  myPendingMaterialIndexBuffer(nil),
+  myPendingTexCoordBuffer(nil),
   myRayGenPipeline(nil),
   myShadePipeline(nil),
   myShadeNoShadowPipeline(nil),
@@ -2448,6 +2746,9 @@ Metal_RayTracing::Metal_RayTracing()
   myBlurHorizontalPipeline(nil),
   myBlurVerticalPipeline(nil),
   myApplyBloomPipeline(nil),
+  myDenoiseAOVPipeline(nil),
+  myDenoiseFilterPipeline(nil),
+  myReprojectPipeline(nil),
   myAccumulationBuffer(nil),
   myRandomSeedBuffer(nil),
   myPixelStatsBuffer(nil),
@@ -2456,8 +2757,26 @@ Metal_RayTracing::Metal_RayTracing()
   myHDRBuffer(nil),
   myBrightBuffer(nil),
   myBloomTempBuffer(nil),
+  myDenoiseColorBuffer(nil),
+  myDenoiseNormalDepthBuffer(nil),
+  myDenoiseAlbedoBuffer(nil),
+  myDenoisePingBuffer(nil),
+  myDenoisePongBuffer(nil),
+  mySampleCountBuffer(nil),
+  myHistorySampleCountBuffer(nil),
+  myHistoryColorBuffer(nil),
+  myNormalDepthBuffer(nil),
+  myHistoryNormalDepthBuffer(nil),
+  myTraceQueue(nil),
+  myProgressiveCommands(nil),
+  myProgressiveEvent(nil),
+  myProgressiveFront(nil),
+  myProgressiveBack(nil),
+  myBlendProgressivePipeline(nil),
   myVertexCount(0),
   myTriangleCount(0),
+  myPendingVertexCount(0),
+  myPendingTriangleCount(0),
   myMaterialCount(0),
   myLightCount(0),
   myMaxBounces(3),
@@ -2486,7 +2805,31 @@ Metal_RayTracing::Metal_RayTracing()
   myWhitePoint(4.0f),
   myBloomEnabled(false),
   myBloomThreshold(1.0f),
-  myBloomIntensity(0.3f)
+  myBloomIntensity(0.3f),
+  myDenoiserEnabled(false),
+  myDenoiserIterations(4),
+  myPrevCameraFov(0.0f),
+  myPrevWidth(0),
+  myPrevHeight(0),
+  myHasPrevCamera(false),
+  myHasReprojHistory(false),
+  myReprojectionEnabled(true),
+  myReprojectionMaxHistory(64),
+  myFramesSinceMotion(0),
+  myProgressiveFov(0.0f),
+  myProgressiveWidth(0),
+  myProgressiveHeight(0),
+  myHasProgressiveCamera(false),
+  myIsProgressiveStale(false),
+  myProgressiveSamples(0),
+  myProgressivePendingSamples(0),
+  myProgressiveDispatchSamples(0),
+  myProgressiveBlendSamples(16),
+  myProgressiveBlendValue(0),
+  myProgressiveBudget(1.0 / 120.0),
+  myProgressiveSettleDelay(0.1),
+  myProgressiveMotionTime(0.0),
+  myProgressiveGpuTime(0.0)
 {
 }
 
@@ -2548,9 +2891,9 @@ bool Metal_RayTracing::Init(Metal_Context* theCtx)
   MTLCompileOptions* anOptions = [[MTLCompileOptions alloc] init];
   anOptions.fastMathEnabled = YES;
 
-  myShaderLibrary = [aDevice newLibraryWithSource:@(RAYTRACING_SHADER_SOURCE)
-                                          options:anOptions
-                                            error:&anError];
+  myShaderLibrary = theCtx->LoadShaderLibrary("Metal_RayTracing_RAYTRACING_SHADER_SOURCE",
+                                              @(RAYTRACING_SHADER_SOURCE),
+                                              anOptions, &anError);
   if (myShaderLibrary == nil)
   {
     Message::SendFail() << "Metal_RayTracing: shader compilation failed - "
@@ -2900,6 +3243,46 @@ bool Metal_RayTracing::Init(Metal_Context* theCtx)
     }
   }
 
+  // Create denoiser pipelines (optional - path tracing result is shown noisy without them)
+  id<MTLFunction> aDenoiseAOVFunc = [myShaderLibrary newFunctionWithName:@"denoiseAOVs"];
+  id<MTLFunction> aDenoiseFilterFunc = [myShaderLibrary newFunctionWithName:@"denoiseFilter"];
+  if (aDenoiseAOVFunc != nil && aDenoiseFilterFunc != nil)
+  {
+    myDenoiseAOVPipeline = [aDevice newComputePipelineStateWithFunction:aDenoiseAOVFunc error:&anError];
+    myDenoiseFilterPipeline = [aDevice newComputePipelineStateWithFunction:aDenoiseFilterFunc error:&anError];
+    if (myDenoiseAOVPipeline == nil || myDenoiseFilterPipeline == nil)
+    {
+      Message::SendWarning() << "Metal_RayTracing: denoiser pipelines failed - "
+                             << [[anError localizedDescription] UTF8String];
+      myDenoiseAOVPipeline = nil;
+      myDenoiseFilterPipeline = nil;
+    }
+  }
+
+  // Create temporal reprojection pipeline (optional - accumulation is reset on camera motion without it)
+  id<MTLFunction> aReprojectFunc = [myShaderLibrary newFunctionWithName:@"reprojectHistory"];
+  if (aReprojectFunc != nil)
+  {
+    myReprojectPipeline = [aDevice newComputePipelineStateWithFunction:aReprojectFunc error:&anError];
+    if (myReprojectPipeline == nil)
+    {
+      Message::SendWarning() << "Metal_RayTracing: reprojectHistory pipeline failed - "
+                             << [[anError localizedDescription] UTF8String];
+    }
+  }
+
+  // Create progressive blending pipeline (optional - progressive image cannot be shown without it)
+  id<MTLFunction> aBlendProgressiveFunc = [myShaderLibrary newFunctionWithName:@"blendProgressive"];
+  if (aBlendProgressiveFunc != nil)
+  {
+    myBlendProgressivePipeline = [aDevice newComputePipelineStateWithFunction:aBlendProgressiveFunc error:&anError];
+    if (myBlendProgressivePipeline == nil)
+    {
+      Message::SendWarning() << "Metal_RayTracing: blendProgressive pipeline failed - "
+                             << [[anError localizedDescription] UTF8String];
+    }
+  }
+
   // Create ray intersector
   myRayIntersector = [[MPSRayIntersector alloc] initWithDevice:aDevice];
   myRayIntersector.rayDataType = MPSRayDataTypeOriginMinDistanceDirectionMaxDistance;
@@ -2920,6 +3303,13 @@ void Metal_RayTracing::Release(Metal_Context* theCtx)
 
   myAccelerationStructure = nil;
   myRayIntersector = nil;
+  myBuildQueue = nil;
+  myPendingBuildCommands = nil;
+  myPendingAccelStructure = nil;
+  myPendingVertexBuffer = nil;
+  myPendingIndexBuffer = nil;
+  myPendingMaterialIndexBuffer = nil;
+  myPendingTexCoordBuffer = nil;
   myRayGenPipeline = nil;
   myShadePipeline = nil;
   myShadeNoShadowPipeline = nil;
@@ -2946,6 +3336,9 @@ void Metal_RayTracing::Release(Metal_Context* theCtx)
   myBlurHorizontalPipeline = nil;
   myBlurVerticalPipeline = nil;
   myApplyBloomPipeline = nil;
+  myDenoiseAOVPipeline = nil;
+  myDenoiseFilterPipeline = nil;
+  myReprojectPipeline = nil;
   myVertexBuffer = nil;
   myIndexBuffer = nil;
   myMaterialBuffer = nil;
@@ -2975,6 +3368,22 @@ void Metal_RayTracing::Release(Metal_Context* theCtx)
   myHDRBuffer = nil;
   myBrightBuffer = nil;
   myBloomTempBuffer = nil;
+  myDenoiseColorBuffer = nil;
+  myDenoiseNormalDepthBuffer = nil;
+  myDenoiseAlbedoBuffer = nil;
+  myDenoisePingBuffer = nil;
+  myDenoisePongBuffer = nil;
+  mySampleCountBuffer = nil;
+  myHistorySampleCountBuffer = nil;
+  myHistoryColorBuffer = nil;
+  myNormalDepthBuffer = nil;
+  myHistoryNormalDepthBuffer = nil;
+  myTraceQueue = nil;
+  myProgressiveCommands = nil;
+  myProgressiveEvent = nil;
+  myProgressiveFront = nil;
+  myProgressiveBack = nil;
+  myBlendProgressivePipeline = nil;
   myShaderLibrary = nil;
 
   myVertexCount = 0;
@@ -2983,6 +3392,14 @@ void Metal_RayTracing::Release(Metal_Context* theCtx)
   myLightCount = 0;
   myIsValid = false;
   myFrameIndex = 0;
+  myHasPrevCamera = false;
+  myHasReprojHistory = false;
+  myHasProgressiveCamera = false;
+  myIsProgressiveStale = false;
+  myProgressiveSamples = 0;
+  myProgressiveDispatchSamples = 0;
+  myProgressiveBlendValue = 0;
+  myProgressiveGpuTime = 0.0;
 }
 
 // =======================================================================
@@ -3001,37 +3418,172 @@ bool Metal_RayTracing::BuildAccelerationStructure(
     return false;
   }
 
-  id<MTLDevice> aDevice = theCtx->Device();
-
-  // Create vertex buffer
-  size_t aVertexSize = static_cast<size_t>(theVertexCount) * 3 * sizeof(float);
-  myVertexBuffer = [aDevice newBufferWithBytes:theVertices
-                                        length:aVertexSize
-                                       options:MTLResourceStorageModeShared];
-
-  // Create index buffer
-  size_t anIndexSize = static_cast<size_t>(theTriangleCount) * 3 * sizeof(uint32_t);
-  myIndexBuffer = [aDevice newBufferWithBytes:theIndices
-                                       length:anIndexSize
-                                      options:MTLResourceStorageModeShared];
+  // synchronous build supersedes pending background one
+  myPendingBuildCommands = nil;
+  myPendingAccelStructure = nil;
+  myPendingVertexBuffer = nil;
+  myPendingIndexBuffer = nil;
+  myPendingMaterialIndexBuffer = nil;
+  myPendingTexCoordBuffer = nil;
+
+  myAccelerationStructure = createTriangleAccelStructure(theCtx->Device(),
+                                                         theVertices, theVertexCount,
+                                                         theIndices, theTriangleCount,
+                                                         myVertexBuffer, myIndexBuffer);
+  if (myAccelerationStructure == nil)
+  {
+    return false;
+  }
 
   myVertexCount = theVertexCount;
   myTriangleCount = theTriangleCount;
 
-  // Build acceleration structure
-  myAccelerationStructure = [[MPSTriangleAccelerationStructure alloc] initWithDevice:aDevice];
-  myAccelerationStructure.vertexBuffer = myVertexBuffer;
-  myAccelerationStructure.vertexStride = sizeof(float) * 3;
-  myAccelerationStructure.indexBuffer = myIndexBuffer;
-  myAccelerationStructure.indexType = MPSDataTypeUInt32;
-  myAccelerationStructure.triangleCount = static_cast<NSUInteger>(theTriangleCount);
-
   // Rebuild the acceleration structure
   [myAccelerationStructure rebuild];
 
   return true;
 }
 
+// =======================================================================
+// function : RefitAccelerationStructure
+// purpose  : Refit BVH to moved vertices
+// =======================================================================
+bool Metal_RayTracing::RefitAccelerationStructure(Metal_Context* theCtx,
+                                                  id<MTLCommandBuffer> theCommandBuffer,
+                                                  const float* theVertices,
+                                                  int theVertexCount)
+{
+  applyPendingRebuild();
+  if (!myIsValid || theCtx == nullptr || theCommandBuffer == nil || theVertices == nullptr
+   || myAccelerationStructure == nil
+   || theVertexCount != myVertexCount
+   || IsRebuildPending())
+  {
+    return false;
+  }
+
+  // vertices are written into a new buffer, since the current one might be still read by frames in flight
+  id<MTLBuffer> aVertexBuffer = [theCtx->Device() newBufferWithBytes:theVertices
+                                                              length:static_cast<size_t>(theVertexCount) * 3 * sizeof(float)
+                                                             options:MTLResourceStorageModeShared];
+  if (aVertexBuffer == nil)
+  {
+    return false;
+  }
+
+  myVertexBuffer = aVertexBuffer;
+  myAccelerationStructure.vertexBuffer = myVertexBuffer;
+  [myAccelerationStructure encodeRefitToCommandBuffer:theCommandBuffer];
+  ResetAccumulation();
+  return true;
+}
+
+// =======================================================================
+// function : RebuildAccelerationStructureAsync
+// purpose  : Rebuild BVH on background queue
+// =======================================================================
+bool Metal_RayTracing::RebuildAccelerationStructureAsync(
+  Metal_Context* theCtx,
+  const float* theVertices,
+  int theVertexCount,
+  const uint32_t* theIndices,
+  int theTriangleCount)
+{
+  if (!myIsValid || theCtx == nullptr || theVertices == nullptr || theIndices == nullptr)
+  {
+    return false;
+  }
+
+  if (myBuildQueue == nil)
+  {
+    myBuildQueue = [theCtx->Device() newCommandQueue];
+    myBuildQueue.label = @"RayTracing_BuildQueue";
+  }
+
+  // previous pending rebuild (if any) is simply dropped - command buffer keeps its resources alive
+  myPendingAccelStructure = createTriangleAccelStructure(theCtx->Device(),
+                                                         theVertices, theVertexCount,
+                                                         theIndices, theTriangleCount,
+                                                         myPendingVertexBuffer, myPendingIndexBuffer);
+  if (myPendingAccelStructure == nil || myBuildQueue == nil)
+  {
+    myPendingBuildCommands = nil;
+    myPendingAccelStructure = nil;
+    return false;
+  }
+
+  myPendingVertexCount = theVertexCount;
+  myPendingTriangleCount = theTriangleCount;
+  myPendingMaterialIndexBuffer = nil;
+  myPendingTexCoordBuffer = nil;
+
+  myPendingBuildCommands = [myBuildQueue commandBuffer];
+  myPendingBuildCommands.label = @"RayTracing_Rebuild";
+  [myPendingAccelStructure encodeRebuildToCommandBuffer:myPendingBuildCommands];
+  [myPendingBuildCommands commit];
+  return true;
+}
+
+// =======================================================================
+// function : IsRebuildPending
+// purpose  : Check if background rebuild is pending
+// =======================================================================
+bool Metal_RayTracing::IsRebuildPending() const
+{
+  return myPendingAccelStructure != nil;
+}
+
+// =======================================================================
+// function : applyPendingRebuild
+// purpose  : Swap in BVH built in background
+// =======================================================================
+void Metal_RayTracing::applyPendingRebuild()
+{
+  if (myPendingAccelStructure == nil)
+  {
+    return;
+  }
+
+  const MTLCommandBufferStatus aStatus = [myPendingBuildCommands status];
+  if (aStatus == MTLCommandBufferStatusError)
+  {
+    Message::SendFail("Metal_RayTracing: background rebuild of acceleration structure has failed");
+    myPendingBuildCommands = nil;
+    myPendingAccelStructure = nil;
+    myPendingVertexBuffer = nil;
+    myPendingIndexBuffer = nil;
+    myPendingMaterialIndexBuffer = nil;
+    myPendingTexCoordBuffer = nil;
+    return;
+  }
+  if (aStatus != MTLCommandBufferStatusCompleted)
+  {
+    return;
+  }
+
+  myAccelerationStructure = myPendingAccelStructure;
+  myVertexBuffer = myPendingVertexBuffer;
+  myIndexBuffer = myPendingIndexBuffer;
+  myVertexCount = myPendingVertexCount;
+  myTriangleCount = myPendingTriangleCount;
+  if (myPendingMaterialIndexBuffer != nil)
+  {
+    myMaterialIndexBuffer = myPendingMaterialIndexBuffer;
+  }
+  if (myPendingTexCoordBuffer != nil)
+  {
+    myTexCoordBuffer = myPendingTexCoordBuffer;
+  }
+
+  myPendingBuildCommands = nil;
+  myPendingAccelStructure = nil;
+  myPendingVertexBuffer = nil;
+  myPendingIndexBuffer = nil;
+  myPendingMaterialIndexBuffer = nil;
+  myPendingTexCoordBuffer = nil;
+  ResetAccumulation();
+}
+
 // =======================================================================
 // function : SetMaterials
 // purpose  : Set materials for ray tracing
@@ -3070,9 +3622,18 @@ void Metal_RayTracing::SetMaterialIndices(Metal_Context* theCtx,
   id<MTLDevice> aDevice = theCtx->Device();
 
   size_t aSize = static_cast<size_t>(theTriangleCount) * sizeof(int32_t);
-  myMaterialIndexBuffer = [aDevice newBufferWithBytes:theMaterialIndices
+  id<MTLBuffer> aBuffer = [aDevice newBufferWithBytes:theMaterialIndices
                                                length:aSize
                                               options:MTLResourceStorageModeShared];
+  if (IsRebuildPending())
+  {
+    // indices of triangles of geometry being rebuilt in background
+    myPendingMaterialIndexBuffer = aBuffer;
+  }
+  else
+  {
+    myMaterialIndexBuffer = aBuffer;
+  }
 }
 
 // =======================================================================
@@ -3113,9 +3674,18 @@ void Metal_RayTracing::SetTexCoords(Metal_Context* theCtx,
   id<MTLDevice> aDevice = theCtx->Device();
 
   size_t aSize = static_cast<size_t>(theVertexCount) * 2 * sizeof(float);
-  myTexCoordBuffer = [aDevice newBufferWithBytes:theTexCoords
-                                          length:aSize
-                                         options:MTLResourceStorageModeShared];
+  id<MTLBuffer> aBuffer = [aDevice newBufferWithBytes:theTexCoords
+                                               length:aSize
+                                              options:MTLResourceStorageModeShared];
+  if (IsRebuildPending())
+  {
+    // coordinates of vertices of geometry being rebuilt in background
+    myPendingTexCoordBuffer = aBuffer;
+  }
+  else
+  {
+    myTexCoordBuffer = aBuffer;
+  }
 }
 
 // =======================================================================
@@ -3210,6 +3780,20 @@ void Metal_RayTracing::SetEnvironmentMap(Metal_Context* theCtx,
   myFrameIndex = 0;
 }
 
+// =======================================================================
+// function : rayTracingEncoder
+// purpose  : Create compute encoder measured by GPU timer
+// =======================================================================
+static id<MTLComputeCommandEncoder> rayTracingEncoder(Metal_Context* theCtx,
+                                                      id<MTLCommandBuffer> theCommandBuffer)
+{
+  if (theCtx != nullptr && !theCtx->GpuTimer().IsNull())
+  {
+    return theCtx->GpuTimer()->ComputeEncoder(theCommandBuffer, Graphic3d_FrameStatsTimer_GpuRayTracing);
+  }
+  return [theCommandBuffer computeCommandEncoder];
+}
+
 // =======================================================================
 // function : Trace
 // purpose  : Perform ray tracing
@@ -3227,6 +3811,7 @@ void Metal_RayTracing::Trace(Metal_Context* theCtx,
     return;
   }
 
+  applyPendingRebuild();
   if (myAccelerationStructure == nil || myTriangleCount <= 0)
   {
     return;
@@ -3371,11 +3956,45 @@ void Metal_RayTracing::Trace(Metal_Context* theCtx,
     }
   }
 
+  // Camera change: path tracing reprojects accumulated history or restarts accumulation
+  const bool isResized = myHasPrevCamera && (myPrevWidth != aWidth || myPrevHeight != aHeight);
+  const bool isCameraMoved = myHasPrevCamera && !isResized
+                          && (myPrevCameraOrigin != theCameraOrigin
+                           || myPrevCameraLookAt != theCameraLookAt
+                           || myPrevCameraUp != theCameraUp
+                           || myPrevCameraFov != theFov);
+  const NCollection_Vec3<float> aPrevOrigin = myPrevCameraOrigin;
+  const NCollection_Vec3<float> aPrevLookAt = myPrevCameraLookAt;
+  const NCollection_Vec3<float> aPrevUp = myPrevCameraUp;
+  const float aPrevFov = myPrevCameraFov;
+  myPrevCameraOrigin = theCameraOrigin;
+  myPrevCameraLookAt = theCameraLookAt;
+  myPrevCameraUp = theCameraUp;
+  myPrevCameraFov = theFov;
+  myPrevWidth = static_cast<uint32_t>(aWidth);
+  myPrevHeight = static_cast<uint32_t>(aHeight);
+  myHasPrevCamera = true;
+  myFramesSinceMotion = (isCameraMoved || isResized) ? 0 : myFramesSinceMotion + 1;
+  if (isResized)
+  {
+    ResetAccumulation();
+  }
+
+  // Denoiser: path tracing accumulates into intermediate buffer, filtered into output afterwards
+  const bool aUseDenoiser = myPathTracingEnabled && isDenoising() && prepareDenoiser(aDevice, aWidth, aHeight);
+
   // Phase 13: Depth of Field mode - uses thin lens camera model with path tracing
   bool aUseDOF = myDOFEnabled && myPathTracingEnabled && myAperture > 0.0f
                && myDOFRayGenPipeline != nil && myDOFPathTracePipeline != nil;
   if (aUseDOF)
   {
+    // history of this mode cannot be reprojected
+    myHasReprojHistory = false;
+    if (isCameraMoved)
+    {
+      ResetAccumulation();
+    }
+
     // Allocate random seed buffer for per-pixel RNG state
     size_t aSeedBufferSize = aRayCount * sizeof(uint32_t);
     if (myRandomSeedBuffer == nil || [myRandomSeedBuffer length] < aSeedBufferSize)
@@ -3427,11 +4046,11 @@ void Metal_RayTracing::Trace(Metal_Context* theCtx,
     MTLSize aThreadgroups = MTLSizeMake((aWidth + 7) / 8, (aHeight + 7) / 8, 1);
 
     // Determine output texture for path tracing (HDR buffer if tone mapping, otherwise output directly)
-    id<MTLTexture> aPathTraceOutput = aUseToneMapping ? myHDRBuffer : theOutputTexture;
+    id<MTLTexture> aPathTraceOutput = aUseToneMapping ? myHDRBuffer : (aUseDenoiser ? myDenoiseColorBuffer : theOutputTexture);
 
     // Step 1: Generate DOF rays with thin lens sampling
     {
-      id<MTLComputeCommandEncoder> anEncoder = [theCommandBuffer computeCommandEncoder];
+      id<MTLComputeCommandEncoder> anEncoder = rayTracingEncoder(theCtx, theCommandBuffer);
       [anEncoder setComputePipelineState:myDOFRayGenPipeline];
       [anEncoder setBuffer:myRayBuffer offset:0 atIndex:0];
       [anEncoder setBytes:&aDOFCameraParams length:sizeof(aDOFCameraParams) atIndex:1];
@@ -3452,7 +4071,7 @@ void Metal_RayTracing::Trace(Metal_Context* theCtx,
 
     // Step 3: DOF path trace shading
     {
-      id<MTLComputeCommandEncoder> anEncoder = [theCommandBuffer computeCommandEncoder];
+      id<MTLComputeCommandEncoder> anEncoder = rayTracingEncoder(theCtx, theCommandBuffer);
       [anEncoder setComputePipelineState:myDOFPathTracePipeline];
       [anEncoder setTexture:aPathTraceOutput atIndex:0];
       [anEncoder setBuffer:myIntersectionBuffer offset:0 atIndex:0];
@@ -3468,6 +4087,14 @@ void Metal_RayTracing::Trace(Metal_Context* theCtx,
       [anEncoder endEncoding];
     }
 
+    // Denoise accumulated result (before tone mapping, which then reads the filtered image)
+    id<MTLTexture> aToneMapInput = myHDRBuffer;
+    if (aUseDenoiser)
+    {
+      aToneMapInput = aUseToneMapping ? myDenoiseColorBuffer : theOutputTexture;
+      denoise(theCtx, theCommandBuffer, aPathTraceOutput, aToneMapInput);
+    }
+
     // Phase 14: Apply bloom and tone mapping if enabled
     if (aUseToneMapping)
     {
@@ -3490,9 +4117,9 @@ void Metal_RayTracing::Trace(Metal_Context* theCtx,
 
         // Extract bright pixels
         {
-          id<MTLComputeCommandEncoder> anEncoder = [theCommandBuffer computeCommandEncoder];
+          id<MTLComputeCommandEncoder> anEncoder = rayTracingEncoder(theCtx, theCommandBuffer);
           [anEncoder setComputePipelineState:myExtractBrightPipeline];
-          [anEncoder setTexture:myHDRBuffer atIndex:0];
+          [anEncoder setTexture:aToneMapInput atIndex:0];
           [anEncoder setTexture:myBrightBuffer atIndex:1];
           [anEncoder setBytes:&aBloomParams length:sizeof(aBloomParams) atIndex:0];
           [anEncoder dispatchThreadgroups:aBloomThreadgroups threadsPerThreadgroup:aThreadgroupSize];
@@ -3501,7 +4128,7 @@ void Metal_RayTracing::Trace(Metal_Context* theCtx,
 
         // Horizontal blur
         {
-          id<MTLComputeCommandEncoder> anEncoder = [theCommandBuffer computeCommandEncoder];
+          id<MTLComputeCommandEncoder> anEncoder = rayTracingEncoder(theCtx, theCommandBuffer);
           [anEncoder setComputePipelineState:myBlurHorizontalPipeline];
           [anEncoder setTexture:myBrightBuffer atIndex:0];
           [anEncoder setTexture:myBloomTempBuffer atIndex:1];
@@ -3512,7 +4139,7 @@ void Metal_RayTracing::Trace(Metal_Context* theCtx,
 
         // Vertical blur
         {
-          id<MTLComputeCommandEncoder> anEncoder = [theCommandBuffer computeCommandEncoder];
+          id<MTLComputeCommandEncoder> anEncoder = rayTracingEncoder(theCtx, theCommandBuffer);
           [anEncoder setComputePipelineState:myBlurVerticalPipeline];
           [anEncoder setTexture:myBloomTempBuffer atIndex:0];
           [anEncoder setTexture:myBrightBuffer atIndex:1];
@@ -3523,7 +4150,7 @@ void Metal_RayTracing::Trace(Metal_Context* theCtx,
 
         // Apply bloom to HDR buffer
         {
-          id<MTLComputeCommandEncoder> anEncoder = [theCommandBuffer computeCommandEncoder];
+          id<MTLComputeCommandEncoder> anEncoder = rayTracingEncoder(theCtx, theCommandBuffer);
           [anEncoder setComputePipelineState:myApplyBloomPipeline];
           [anEncoder setTexture:myHDRBuffer atIndex:0];
           [anEncoder setTexture:myBrightBuffer atIndex:1];
@@ -3548,9 +4175,9 @@ void Metal_RayTracing::Trace(Metal_Context* theCtx,
         aTMParams.whitePoint = myWhitePoint;
         aTMParams.resolution = simd_make_uint2(static_cast<uint32_t>(aWidth), static_cast<uint32_t>(aHeight));
 
-        id<MTLComputeCommandEncoder> anEncoder = [theCommandBuffer computeCommandEncoder];
+        id<MTLComputeCommandEncoder> anEncoder = rayTracingEncoder(theCtx, theCommandBuffer);
         [anEncoder setComputePipelineState:myToneMappingPipeline];
-        [anEncoder setTexture:myHDRBuffer atIndex:0];
+        [anEncoder setTexture:aToneMapInput atIndex:0];
         [anEncoder setTexture:theOutputTexture atIndex:1];
         [anEncoder setBytes:&aTMParams length:sizeof(aTMParams) atIndex:0];
         [anEncoder dispatchThreadgroups:aThreadgroups threadsPerThreadgroup:aThreadgroupSize];
@@ -3568,6 +4195,13 @@ void Metal_RayTracing::Trace(Metal_Context* theCtx,
                            && myAdaptiveRayGenPipeline != nil && myAdaptivePathTracePipeline != nil;
   if (aUseAdaptiveSampling)
   {
+    // history of this mode cannot be reprojected
+    myHasReprojHistory = false;
+    if (isCameraMoved)
+    {
+      ResetAccumulation();
+    }
+
     // Allocate random seed buffer for per-pixel RNG state
     size_t aSeedBufferSize = aRayCount * sizeof(uint32_t);
     if (myRandomSeedBuffer == nil || [myRandomSeedBuffer length] < aSeedBufferSize)
@@ -3632,7 +4266,7 @@ void Metal_RayTracing::Trace(Metal_Context* theCtx,
     if (myFrameIndex == 0 && myResetAdaptiveStatsPipeline != nil)
     {
       simd_uint2 aRes = simd_make_uint2(static_cast<uint32_t>(aWidth), static_cast<uint32_t>(aHeight));
-      id<MTLComputeCommandEncoder> anEncoder = [theCommandBuffer computeCommandEncoder];
+      id<MTLComputeCommandEncoder> anEncoder = rayTracingEncoder(theCtx, theCommandBuffer);
       [anEncoder setComputePipelineState:myResetAdaptiveStatsPipeline];
       [anEncoder setBuffer:myPixelStatsBuffer offset:0 atIndex:0];
       [anEncoder setBytes:&aRes length:sizeof(aRes) atIndex:1];
@@ -3642,7 +4276,7 @@ void Metal_RayTracing::Trace(Metal_Context* theCtx,
 
     // Step 1: Generate jittered rays (skipping converged pixels)
     {
-      id<MTLComputeCommandEncoder> anEncoder = [theCommandBuffer computeCommandEncoder];
+      id<MTLComputeCommandEncoder> anEncoder = rayTracingEncoder(theCtx, theCommandBuffer);
       [anEncoder setComputePipelineState:myAdaptiveRayGenPipeline];
       [anEncoder setBuffer:myRayBuffer offset:0 atIndex:0];
       [anEncoder setBytes:&aAdaptiveCameraParams length:sizeof(aAdaptiveCameraParams) atIndex:1];
@@ -3664,9 +4298,9 @@ void Metal_RayTracing::Trace(Metal_Context* theCtx,
 
     // Step 3: Adaptive path trace with variance tracking
     {
-      id<MTLComputeCommandEncoder> anEncoder = [theCommandBuffer computeCommandEncoder];
+      id<MTLComputeCommandEncoder> anEncoder = rayTracingEncoder(theCtx, theCommandBuffer);
       [anEncoder setComputePipelineState:myAdaptivePathTracePipeline];
-      [anEncoder setTexture:theOutputTexture atIndex:0];
+      [anEncoder setTexture:(aUseDenoiser ? myDenoiseColorBuffer : theOutputTexture) atIndex:0];
       [anEncoder setBuffer:myIntersectionBuffer offset:0 atIndex:0];
       [anEncoder setBuffer:myRayBuffer offset:0 atIndex:1];
       [anEncoder setBytes:&aAdaptiveCameraParams length:sizeof(aAdaptiveCameraParams) atIndex:2];
@@ -3681,6 +4315,11 @@ void Metal_RayTracing::Trace(Metal_Context* theCtx,
       [anEncoder endEncoding];
     }
 
+    if (aUseDenoiser)
+    {
+      denoise(theCtx, theCommandBuffer, myDenoiseColorBuffer, theOutputTexture);
+    }
+
     // Increment frame index for next accumulation
     myFrameIndex++;
     return;
@@ -3691,6 +4330,13 @@ void Metal_RayTracing::Trace(Metal_Context* theCtx,
                  && myEnvMapPathTracePipeline != nil && myPathTraceRayGenPipeline != nil;
   if (aUseEnvMap)
   {
+    // history of this mode cannot be reprojected
+    myHasReprojHistory = false;
+    if (isCameraMoved)
+    {
+      ResetAccumulation();
+    }
+
     // Allocate random seed buffer for per-pixel RNG state
     size_t aSeedBufferSize = aRayCount * sizeof(uint32_t);
     if (myRandomSeedBuffer == nil || [myRandomSeedBuffer length] < aSeedBufferSize)
@@ -3773,7 +4419,7 @@ void Metal_RayTracing::Trace(Metal_Context* theCtx,
 
     // Step 1: Generate jittered rays for this frame
     {
-      id<MTLComputeCommandEncoder> anEncoder = [theCommandBuffer computeCommandEncoder];
+      id<MTLComputeCommandEncoder> anEncoder = rayTracingEncoder(theCtx, theCommandBuffer);
       [anEncoder setComputePipelineState:myPathTraceRayGenPipeline];
       [anEncoder setBuffer:myRayBuffer offset:0 atIndex:0];
       [anEncoder setBytes:&aPTCameraParams length:sizeof(aPTCameraParams) atIndex:1];
@@ -3794,9 +4440,9 @@ void Metal_RayTracing::Trace(Metal_Context* theCtx,
 
     // Step 3: Environment map path trace
     {
-      id<MTLComputeCommandEncoder> anEncoder = [theCommandBuffer computeCommandEncoder];
+      id<MTLComputeCommandEncoder> anEncoder = rayTracingEncoder(theCtx, theCommandBuffer);
       [anEncoder setComputePipelineState:myEnvMapPathTracePipeline];
-      [anEncoder setTexture:theOutputTexture atIndex:0];
+      [anEncoder setTexture:(aUseDenoiser ? myDenoiseColorBuffer : theOutputTexture) atIndex:0];
       [anEncoder setTexture:myAccumulationBuffer atIndex:1];
       [anEncoder setTexture:myEnvironmentMap atIndex:2];
       [anEncoder setSamplerState:myEnvMapSampler atIndex:0];
@@ -3814,6 +4460,11 @@ void Metal_RayTracing::Trace(Metal_Context* theCtx,
       [anEncoder endEncoding];
     }
 
+    if (aUseDenoiser)
+    {
+      denoise(theCtx, theCommandBuffer, myDenoiseColorBuffer, theOutputTexture);
+    }
+
     // Increment frame index for next accumulation
     myFrameIndex++;
     return;
@@ -3823,6 +4474,25 @@ void Metal_RayTracing::Trace(Metal_Context* theCtx,
   bool aUsePathTracing = myPathTracingEnabled && myPathTraceRayGenPipeline != nil && myPathTracePipeline != nil;
   if (aUsePathTracing)
   {
+    // Temporal reprojection keeps history of previous view, if it corresponds to the previous frame
+    id<MTLTexture> anAccumTarget = aUseDenoiser ? myDenoiseColorBuffer : theOutputTexture;
+    const bool aUseReprojection = myReprojectionEnabled && myReprojectPipeline != nil
+                               && prepareReprojection(aDevice, anAccumTarget);
+    const bool toReproject = aUseReprojection && isCameraMoved && myHasReprojHistory && myFrameIndex > 0;
+    if (isCameraMoved && !toReproject)
+    {
+      ResetAccumulation();
+    }
+
+    // Per-pixel sample counts accumulated by path tracing kernels
+    size_t aCountBufferSize = aRayCount * sizeof(uint32_t);
+    if (mySampleCountBuffer == nil || [mySampleCountBuffer length] < aCountBufferSize)
+    {
+      mySampleCountBuffer = [aDevice newBufferWithLength:aCountBufferSize
+                                                 options:MTLResourceStorageModePrivate];
+      ResetAccumulation();
+    }
+
     // Allocate random seed buffer for per-pixel RNG state
     size_t aSeedBufferSize = aRayCount * sizeof(uint32_t);
     if (myRandomSeedBuffer == nil || [myRandomSeedBuffer length] < aSeedBufferSize)
@@ -3871,7 +4541,7 @@ void Metal_RayTracing::Trace(Metal_Context* theCtx,
 
     // Step 1: Generate jittered rays for this frame
     {
-      id<MTLComputeCommandEncoder> anEncoder = [theCommandBuffer computeCommandEncoder];
+      id<MTLComputeCommandEncoder> anEncoder = rayTracingEncoder(theCtx, theCommandBuffer);
       [anEncoder setComputePipelineState:myPathTraceRayGenPipeline];
       [anEncoder setBuffer:myRayBuffer offset:0 atIndex:0];
       [anEncoder setBytes:&aPTCameraParams length:sizeof(aPTCameraParams) atIndex:1];
@@ -3890,10 +4560,81 @@ void Metal_RayTracing::Trace(Metal_Context* theCtx,
                                                rayCount:aRayCount
                                   accelerationStructure:myAccelerationStructure];
 
+    // Step 2b: Reproject history of previous view and store primary hits for the next one
+    if (aUseReprojection)
+    {
+      if (toReproject)
+      {
+        id<MTLBlitCommandEncoder> aBlitEncoder = [theCommandBuffer blitCommandEncoder];
+        [aBlitEncoder copyFromTexture:anAccumTarget toTexture:myHistoryColorBuffer];
+        [aBlitEncoder copyFromBuffer:mySampleCountBuffer
+                        sourceOffset:0
+                            toBuffer:myHistorySampleCountBuffer
+                   destinationOffset:0
+                                size:aCountBufferSize];
+        [aBlitEncoder endEncoding];
+      }
+
+      struct ReprojectParams {
+        simd_float3 prevOrigin;
+        simd_float3 prevForward;
+        simd_float3 prevRight;
+        simd_float3 prevUp;
+        simd_float2 prevHalfExtent;
+        simd_float2 resolution;
+        int32_t isCameraMoved;
+        uint32_t maxHistory;
+        float normalThreshold;
+        float depthThreshold;
+      } aReprojParams;
+
+      simd_float3 aPrevOrigin3 = simd_make_float3(aPrevOrigin.x(), aPrevOrigin.y(), aPrevOrigin.z());
+      simd_float3 aPrevLookAt3 = simd_make_float3(aPrevLookAt.x(), aPrevLookAt.y(), aPrevLookAt.z());
+      simd_float3 aPrevUp3 = simd_make_float3(aPrevUp.x(), aPrevUp.y(), aPrevUp.z());
+      simd_float3 aPrevForward = simd_normalize(aPrevLookAt3 - aPrevOrigin3);
+      simd_float3 aPrevRight = simd_normalize(simd_cross(aPrevForward, aPrevUp3));
+      const float aPrevHalfHeight = std::tan(aPrevFov * 0.5f);
+      aReprojParams.prevOrigin = aPrevOrigin3;
+      aReprojParams.prevForward = aPrevForward;
+      aReprojParams.prevRight = aPrevRight;
+      aReprojParams.prevUp = simd_cross(aPrevRight, aPrevForward);
+      aReprojParams.prevHalfExtent = simd_make_float2(aPrevHalfHeight * static_cast<float>(aWidth) / static_cast<float>(aHeight),
+                                                      aPrevHalfHeight);
+      aReprojParams.resolution = simd_make_float2(static_cast<float>(aWidth), static_cast<float>(aHeight));
+      aReprojParams.isCameraMoved = toReproject ? 1 : 0;
+      aReprojParams.maxHistory = myReprojectionMaxHistory;
+      aReprojParams.normalThreshold = THE_REPROJECT_NORMAL_THRESHOLD;
+      aReprojParams.depthThreshold = THE_REPROJECT_DEPTH_THRESHOLD;
+
+      id<MTLComputeCommandEncoder> anEncoder = rayTracingEncoder(theCtx, theCommandBuffer);
+      [anEncoder setComputePipelineState:myReprojectPipeline];
+      [anEncoder setTexture:myHistoryColorBuffer atIndex:0];
+      [anEncoder setTexture:anAccumTarget atIndex:1];
+      [anEncoder setTexture:myHistoryNormalDepthBuffer atIndex:2];
+      [anEncoder setTexture:myNormalDepthBuffer atIndex:3];
+      [anEncoder setBuffer:myIntersectionBuffer offset:0 atIndex:0];
+      [anEncoder setBuffer:myRayBuffer offset:0 atIndex:1];
+      [anEncoder setBuffer:myVertexBuffer offset:0 atIndex:2];
+      [anEncoder setBuffer:myIndexBuffer offset:0 atIndex:3];
+      [anEncoder setBuffer:myHistorySampleCountBuffer offset:0 atIndex:4];
+      [anEncoder setBuffer:mySampleCountBuffer offset:0 atIndex:5];
+      [anEncoder setBytes:&aReprojParams length:sizeof(aReprojParams) atIndex:6];
+      [anEncoder dispatchThreadgroups:aThreadgroups threadsPerThreadgroup:aThreadgroupSize];
+      [anEncoder endEncoding];
+
+      // primary hits of this frame become history of the next one
+      std::swap(myNormalDepthBuffer, myHistoryNormalDepthBuffer);
+      myHasReprojHistory = true;
+    }
+    else
+    {
+      myHasReprojHistory = false;
+    }
+
     // Step 3: Path trace shading with progressive accumulation
     // Use BSDF pipeline (Phase 10) if enabled, otherwise basic path tracing (Phase 9)
     {
-      id<MTLComputeCommandEncoder> anEncoder = [theCommandBuffer computeCommandEncoder];
+      id<MTLComputeCommandEncoder> anEncoder = rayTracingEncoder(theCtx, theCommandBuffer);
       if (myBSDFSamplingEnabled && myPathTraceBSDFPipeline != nil)
       {
         [anEncoder setComputePipelineState:myPathTraceBSDFPipeline];
@@ -3902,7 +4643,7 @@ void Metal_RayTracing::Trace(Metal_Context* theCtx,
       {
         [anEncoder setComputePipelineState:myPathTracePipeline];
       }
-      [anEncoder setTexture:theOutputTexture atIndex:0];
+      [anEncoder setTexture:(aUseDenoiser ? myDenoiseColorBuffer : theOutputTexture) atIndex:0];
       [anEncoder setBuffer:myIntersectionBuffer offset:0 atIndex:0];
       [anEncoder setBuffer:myRayBuffer offset:0 atIndex:1];
       [anEncoder setBytes:&aPTCameraParams length:sizeof(aPTCameraParams) atIndex:2];
@@ -3912,10 +4653,16 @@ void Metal_RayTracing::Trace(Metal_Context* theCtx,
       [anEncoder setBuffer:myMaterialIndexBuffer offset:0 atIndex:6];
       [anEncoder setBuffer:myLightBuffer offset:0 atIndex:7];
       [anEncoder setBuffer:myRandomSeedBuffer offset:0 atIndex:8];
+      [anEncoder setBuffer:mySampleCountBuffer offset:0 atIndex:9];
       [anEncoder dispatchThreadgroups:aThreadgroups threadsPerThreadgroup:aThreadgroupSize];
       [anEncoder endEncoding];
     }
 
+    if (aUseDenoiser)
+    {
+      denoise(theCtx, theCommandBuffer, myDenoiseColorBuffer, theOutputTexture);
+    }
+
     // Increment frame index for next accumulation
     myFrameIndex++;
     return;
@@ -3946,7 +4693,7 @@ void Metal_RayTracing::Trace(Metal_Context* theCtx,
 
   // Step 1: Generate rays
   {
-    id<MTLComputeCommandEncoder> anEncoder = [theCommandBuffer computeCommandEncoder];
+    id<MTLComputeCommandEncoder> anEncoder = rayTracingEncoder(theCtx, theCommandBuffer);
     [anEncoder setComputePipelineState:myRayGenPipeline];
     [anEncoder setBuffer:myRayBuffer offset:0 atIndex:0];
     [anEncoder setBytes:&aCameraParams length:sizeof(aCameraParams) atIndex:1];
@@ -3977,7 +4724,7 @@ void Metal_RayTracing::Trace(Metal_Context* theCtx,
     {
       // 3a: Generate shadow rays from hit points toward this light
       {
-        id<MTLComputeCommandEncoder> anEncoder = [theCommandBuffer computeCommandEncoder];
+        id<MTLComputeCommandEncoder> anEncoder = rayTracingEncoder(theCtx, theCommandBuffer);
         [anEncoder setComputePipelineState:myShadowRayGenPipeline];
         [anEncoder setBuffer:myShadowRayBuffer offset:0 atIndex:0];
         [anEncoder setBuffer:myIntersectionBuffer offset:0 atIndex:1];
@@ -4012,7 +4759,7 @@ void Metal_RayTracing::Trace(Metal_Context* theCtx,
 
     // 4a: Generate reflection rays from primary hits
     {
-      id<MTLComputeCommandEncoder> anEncoder = [theCommandBuffer computeCommandEncoder];
+      id<MTLComputeCommandEncoder> anEncoder = rayTracingEncoder(theCtx, theCommandBuffer);
       [anEncoder setComputePipelineState:myReflectionRayGenPipeline];
       [anEncoder setBuffer:myReflectionRayBuffer offset:0 atIndex:0];
       [anEncoder setBuffer:myIntersectionBuffer offset:0 atIndex:1];
@@ -4038,7 +4785,7 @@ void Metal_RayTracing::Trace(Metal_Context* theCtx,
 
     // 4c: Compute colors for what reflections hit
     {
-      id<MTLComputeCommandEncoder> anEncoder = [theCommandBuffer computeCommandEncoder];
+      id<MTLComputeCommandEncoder> anEncoder = rayTracingEncoder(theCtx, theCommandBuffer);
       [anEncoder setComputePipelineState:myBounceColorPipeline];
       [anEncoder setBuffer:myBounceColorBuffer offset:0 atIndex:0];
       [anEncoder setBuffer:myReflectionIntersectionBuffer offset:0 atIndex:1];
@@ -4063,7 +4810,7 @@ void Metal_RayTracing::Trace(Metal_Context* theCtx,
 
     // 5a: Generate first refraction rays (entering glass from primary hits)
     {
-      id<MTLComputeCommandEncoder> anEncoder = [theCommandBuffer computeCommandEncoder];
+      id<MTLComputeCommandEncoder> anEncoder = rayTracingEncoder(theCtx, theCommandBuffer);
       [anEncoder setComputePipelineState:myRefractionRayGenPipeline];
       [anEncoder setBuffer:myRefractionRayBuffer offset:0 atIndex:0];
       [anEncoder setBuffer:myIntersectionBuffer offset:0 atIndex:1];
@@ -4089,7 +4836,7 @@ void Metal_RayTracing::Trace(Metal_Context* theCtx,
 
     // 5c: Generate second refraction rays (exiting glass)
     {
-      id<MTLComputeCommandEncoder> anEncoder = [theCommandBuffer computeCommandEncoder];
+      id<MTLComputeCommandEncoder> anEncoder = rayTracingEncoder(theCtx, theCommandBuffer);
       [anEncoder setComputePipelineState:myRefractionRayGenPipeline];
       [anEncoder setBuffer:myRefractionRayBuffer2 offset:0 atIndex:0];  // output to buffer2
       [anEncoder setBuffer:myRefractionIntersectionBuffer offset:0 atIndex:1];  // first bounce intersections
@@ -4115,7 +4862,7 @@ void Metal_RayTracing::Trace(Metal_Context* theCtx,
 
     // 5e: Compute colors for what the exited rays hit
     {
-      id<MTLComputeCommandEncoder> anEncoder = [theCommandBuffer computeCommandEncoder];
+      id<MTLComputeCommandEncoder> anEncoder = rayTracingEncoder(theCtx, theCommandBuffer);
       [anEncoder setComputePipelineState:myRefractionColorPipeline];
       [anEncoder setBuffer:myRefractionColorBuffer offset:0 atIndex:0];
       [anEncoder setBuffer:myRefractionIntersectionBuffer2 offset:0 atIndex:1];  // second bounce intersections
@@ -4136,7 +4883,7 @@ void Metal_RayTracing::Trace(Metal_Context* theCtx,
                       && myTexCoordBuffer != nil && myDiffuseTextureArray != nil;
 
   {
-    id<MTLComputeCommandEncoder> anEncoder = [theCommandBuffer computeCommandEncoder];
+    id<MTLComputeCommandEncoder> anEncoder = rayTracingEncoder(theCtx, theCommandBuffer);
 
     if (aUseTextures)
     {
@@ -4235,3 +4982,374 @@ void Metal_RayTracing::Trace(Metal_Context* theCtx,
     [anEncoder endEncoding];
   }
 }
+
+// =======================================================================
+// function : TraceProgressive
+// purpose  : Perform progressive ray tracing on own command queue
+// =======================================================================
+bool Metal_RayTracing::TraceProgressive(Metal_Context* theCtx,
+                                        NSUInteger theWidth,
+                                        NSUInteger theHeight,
+                                        const NCollection_Vec3<float>& theCameraOrigin,
+                                        const NCollection_Vec3<float>& theCameraLookAt,
+                                        const NCollection_Vec3<float>& theCameraUp,
+                                        float theFov)
+{
+  if (!myIsValid || theCtx == nullptr || theWidth == 0 || theHeight == 0)
+  {
+    return false;
+  }
+
+  // camera change hides progressive image and postpones tracing until the camera settles
+  const double aTime = CACurrentMediaTime();
+  if (!myHasProgressiveCamera
+   || myProgressiveOrigin != theCameraOrigin
+   || myProgressiveLookAt != theCameraLookAt
+   || myProgressiveUp != theCameraUp
+   || myProgressiveFov != theFov
+   || myProgressiveWidth != theWidth
+   || myProgressiveHeight != theHeight)
+  {
+    myProgressiveOrigin = theCameraOrigin;
+    myProgressiveLookAt = theCameraLookAt;
+    myProgressiveUp = theCameraUp;
+    myProgressiveFov = theFov;
+    myProgressiveWidth = static_cast<uint32_t>(theWidth);
+    myProgressiveHeight = static_cast<uint32_t>(theHeight);
+    myHasProgressiveCamera = true;
+    myProgressiveMotionTime = aTime;
+    myProgressiveSamples = 0;
+    myIsProgressiveStale = myProgressiveCommands != nil;
+  }
+
+  // collect result of dispatch in flight without waiting for it
+  if (myProgressiveCommands != nil)
+  {
+    const MTLCommandBufferStatus aStatus = [myProgressiveCommands status];
+    if (aStatus == MTLCommandBufferStatusError)
+    {
+      Message::SendFail("Metal_RayTracing: progressive ray tracing dispatch has failed");
+      myProgressiveCommands = nil;
+      myProgressiveDispatchSamples = 0;
+      myProgressiveGpuTime = 0.0;
+      myIsProgressiveStale = false;
+      return myProgressiveSamples > 0;
+    }
+    if (aStatus != MTLCommandBufferStatusCompleted)
+    {
+      return myProgressiveSamples > 0;
+    }
+
+    if (@available(macOS 10.15, iOS 10.3, *))
+    {
+      if (myProgressiveCommands.GPUEndTime > myProgressiveCommands.GPUStartTime)
+      {
+        myProgressiveGpuTime = myProgressiveCommands.GPUEndTime - myProgressiveCommands.GPUStartTime;
+      }
+    }
+    if (!myIsProgressiveStale)
+    {
+      std::swap(myProgressiveFront, myProgressiveBack);
+      myProgressiveSamples = myProgressivePendingSamples;
+    }
+    myProgressiveCommands = nil;
+    myIsProgressiveStale = false;
+  }
+
+  const bool isConverged = myPathTracingEnabled ? (myProgressiveSamples > 0 && myFrameIndex >= myMaxSamples)
+                                                : myProgressiveSamples > 0;
+  if (isConverged || aTime - myProgressiveMotionTime < myProgressiveSettleDelay)
+  {
+    return myProgressiveSamples > 0;
+  }
+
+  applyPendingRebuild();
+  if (myAccelerationStructure == nil || myTriangleCount <= 0)
+  {
+    return myProgressiveSamples > 0;
+  }
+
+  id<MTLDevice> aDevice = theCtx->Device();
+  if (myTraceQueue == nil)
+  {
+    myTraceQueue = [aDevice newCommandQueue];
+    myTraceQueue.label = @"RayTracing_TraceQueue";
+    myProgressiveEvent = [aDevice newEvent];
+    myProgressiveBlendValue = 0;
+  }
+  if (myProgressiveBack == nil
+   || [myProgressiveBack width] != theWidth
+   || [myProgressiveBack height] != theHeight)
+  {
+    myProgressiveBack = createComputeTexture(aDevice, MTLPixelFormatRGBA16Float, theWidth, theHeight);
+  }
+  if (myTraceQueue == nil || myProgressiveEvent == nil || myProgressiveBack == nil)
+  {
+    return myProgressiveSamples > 0;
+  }
+
+  // size the dispatch by GPU time of the previous one, growing it at most twice per dispatch
+  uint32_t aNbSamples = 1;
+  if (myPathTracingEnabled && myProgressiveGpuTime > 0.0 && myProgressiveDispatchSamples > 0)
+  {
+    const double aSampleTime = myProgressiveGpuTime / double(myProgressiveDispatchSamples);
+    const double aNbFit = std::floor(myProgressiveBudget / aSampleTime);
+    aNbSamples = static_cast<uint32_t>(std::min(aNbFit, double(THE_PROGRESSIVE_MAX_DISPATCH_SAMPLES)));
+    aNbSamples = std::max(std::min(aNbSamples, myProgressiveDispatchSamples * 2), 1u);
+  }
+  if (myPathTracingEnabled && myMaxSamples > myFrameIndex)
+  {
+    aNbSamples = std::min(aNbSamples, myMaxSamples - myFrameIndex);
+  }
+
+  id<MTLCommandBuffer> aCommandBuffer = [myTraceQueue commandBuffer];
+  aCommandBuffer.label = @"RayTracing_Progressive";
+
+  // image may still be read by frames blending it before the last swap
+  if (myProgressiveBlendValue > 0)
+  {
+    [aCommandBuffer encodeWaitForEvent:myProgressiveEvent value:myProgressiveBlendValue];
+  }
+  for (uint32_t aSampleIter = 0; aSampleIter < aNbSamples; ++aSampleIter)
+  {
+    Trace(theCtx, aCommandBuffer, myProgressiveBack,
+          theCameraOrigin, theCameraLookAt, theCameraUp, theFov);
+  }
+  [aCommandBuffer commit];
+
+  myProgressiveCommands = aCommandBuffer;
+  myProgressiveDispatchSamples = aNbSamples;
+  myProgressivePendingSamples = myPathTracingEnabled ? myFrameIndex : 1;
+  return myProgressiveSamples > 0;
+}
+
+// =======================================================================
+// function : BlendProgressive
+// purpose  : Blend progressive image over rasterized frame
+// =======================================================================
+bool Metal_RayTracing::BlendProgressive(Metal_Context* theCtx,
+                                        id<MTLCommandBuffer> theCommandBuffer,
+                                        id<MTLTexture> theRasterTexture,
+                                        id<MTLTexture> theOutputTexture)
+{
+  if (myProgressiveSamples == 0 || myProgressiveFront == nil || myBlendProgressivePipeline == nil
+   || theCommandBuffer == nil || theRasterTexture == nil || theOutputTexture == nil)
+  {
+    return false;
+  }
+
+  const NSUInteger aWidth = [theOutputTexture width];
+  const NSUInteger aHeight = [theOutputTexture height];
+  if ([myProgressiveFront width] != aWidth || [myProgressiveFront height] != aHeight
+   || [theRasterTexture width] != aWidth || [theRasterTexture height] != aHeight)
+  {
+    return false;
+  }
+
+  const float aWeight = myPathTracingEnabled
+                      ? std::min(float(myProgressiveSamples) / float(myProgressiveBlendSamples), 1.0f)
+                      : 1.0f;
+
+  id<MTLComputeCommandEncoder> anEncoder = rayTracingEncoder(theCtx, theCommandBuffer);
+  [anEncoder setComputePipelineState:myBlendProgressivePipeline];
+  [anEncoder setTexture:theRasterTexture atIndex:0];
+  [anEncoder setTexture:myProgressiveFront atIndex:1];
+  [anEncoder setTexture:theOutputTexture atIndex:2];
+  [anEncoder setBytes:&aWeight length:sizeof(aWeight) atIndex:0];
+  MTLSize aThreadgroupSize = MTLSizeMake(8, 8, 1);
+  MTLSize aThreadgroups = MTLSizeMake((aWidth + 7) / 8, (aHeight + 7) / 8, 1);
+  [anEncoder dispatchThreadgroups:aThreadgroups threadsPerThreadgroup:aThreadgroupSize];
+  [anEncoder endEncoding];
+
+  // next progressive dispatch waits until this frame stops reading the image
+  [theCommandBuffer encodeSignalEvent:myProgressiveEvent value:++myProgressiveBlendValue];
+  return true;
+}
+
+// =======================================================================
+// function : ResetProgressive
+// purpose  : Discard progressive image
+// =======================================================================
+void Metal_RayTracing::ResetProgressive()
+{
+  myProgressiveSamples = 0;
+  myIsProgressiveStale = myProgressiveCommands != nil;
+  ResetAccumulation();
+}
+
+// =======================================================================
+// function : SetRenderingParams
+// purpose  : Apply path tracing options of view rendering parameters
+// =======================================================================
+void Metal_RayTracing::SetRenderingParams(const Graphic3d_RenderingParams& theParams)
+{
+  const bool isDOF = theParams.CameraApertureRadius > 0.0f;
+  if (myPathTracingEnabled != theParams.IsGlobalIlluminationEnabled
+   || myMaxBounces != theParams.RaytracingDepth
+   || myShadowsEnabled != theParams.IsShadowEnabled
+   || myReflectionsEnabled != theParams.IsReflectionEnabled
+   || myAdaptiveSamplingEnabled != theParams.AdaptiveScreenSampling
+   || myDOFEnabled != isDOF
+   || myAperture != theParams.CameraApertureRadius
+   || myFocalDistance != theParams.CameraFocalPlaneDist
+   || myDenoiserEnabled != theParams.ToDenoise)
+  {
+    ResetAccumulation();
+  }
+
+  myPathTracingEnabled = theParams.IsGlobalIlluminationEnabled;
+  myMaxBounces = theParams.RaytracingDepth;
+  myShadowsEnabled = theParams.IsShadowEnabled;
+  myReflectionsEnabled = theParams.IsReflectionEnabled;
+  myAdaptiveSamplingEnabled = theParams.AdaptiveScreenSampling;
+  myDOFEnabled = isDOF;
+  myAperture = theParams.CameraApertureRadius;
+  myFocalDistance = theParams.CameraFocalPlaneDist;
+  myDenoiserEnabled = theParams.ToDenoise;
+}
+
+// =======================================================================
+// function : prepareDenoiser
+// purpose  : (Re)allocate denoiser textures
+// =======================================================================
+bool Metal_RayTracing::prepareDenoiser(id<MTLDevice> theDevice,
+                                       NSUInteger theWidth,
+                                       NSUInteger theHeight)
+{
+  if (myDenoiseColorBuffer != nil
+   && [myDenoiseColorBuffer width] == theWidth
+   && [myDenoiseColorBuffer height] == theHeight)
+  {
+    return true;
+  }
+
+  // noisy color is accumulated in place of output texture, so accumulation restarts with new buffers
+  myFrameIndex = 0;
+  myDenoiseColorBuffer = createComputeTexture(theDevice, MTLPixelFormatRGBA16Float, theWidth, theHeight);
+  myDenoiseNormalDepthBuffer = createComputeTexture(theDevice, MTLPixelFormatRGBA16Float, theWidth, theHeight);
+  myDenoiseAlbedoBuffer = createComputeTexture(theDevice, MTLPixelFormatRGBA8Unorm, theWidth, theHeight);
+  myDenoisePingBuffer = createComputeTexture(theDevice, MTLPixelFormatRGBA16Float, theWidth, theHeight);
+  myDenoisePongBuffer = createComputeTexture(theDevice, MTLPixelFormatRGBA16Float, theWidth, theHeight);
+  if (myDenoiseColorBuffer == nil || myDenoiseNormalDepthBuffer == nil || myDenoiseAlbedoBuffer == nil
+   || myDenoisePingBuffer == nil || myDenoisePongBuffer == nil)
+  {
+    Message::SendWarning() << "Metal_RayTracing: unable to allocate denoiser buffers " << (int)theWidth << "x" << (int)theHeight;
+    myDenoiseColorBuffer = nil;
+    myDenoiseNormalDepthBuffer = nil;
+    myDenoiseAlbedoBuffer = nil;
+    myDenoisePingBuffer = nil;
+    myDenoisePongBuffer = nil;
+    return false;
+  }
+  return true;
+}
+
+// =======================================================================
+// function : prepareReprojection
+// purpose  : (Re)allocate temporal reprojection history
+// =======================================================================
+bool Metal_RayTracing::prepareReprojection(id<MTLDevice> theDevice,
+                                           id<MTLTexture> theTarget)
+{
+  const NSUInteger aWidth = [theTarget width];
+  const NSUInteger aHeight = [theTarget height];
+  if (myHistoryColorBuffer != nil
+   && [myHistoryColorBuffer width] == aWidth
+   && [myHistoryColorBuffer height] == aHeight
+   && [myHistoryColorBuffer pixelFormat] == [theTarget pixelFormat])
+  {
+    return true;
+  }
+
+  myHasReprojHistory = false;
+  myHistoryColorBuffer = createComputeTexture(theDevice, [theTarget pixelFormat], aWidth, aHeight);
+  myNormalDepthBuffer = createComputeTexture(theDevice, MTLPixelFormatRGBA32Float, aWidth, aHeight);
+  myHistoryNormalDepthBuffer = createComputeTexture(theDevice, MTLPixelFormatRGBA32Float, aWidth, aHeight);
+  myHistorySampleCountBuffer = [theDevice newBufferWithLength:aWidth * aHeight * sizeof(uint32_t)
+                                                      options:MTLResourceStorageModePrivate];
+  if (myHistoryColorBuffer == nil || myNormalDepthBuffer == nil || myHistoryNormalDepthBuffer == nil
+   || myHistorySampleCountBuffer == nil)
+  {
+    Message::SendWarning() << "Metal_RayTracing: unable to allocate reprojection buffers " << (int)aWidth << "x" << (int)aHeight;
+    myHistoryColorBuffer = nil;
+    myNormalDepthBuffer = nil;
+    myHistoryNormalDepthBuffer = nil;
+    myHistorySampleCountBuffer = nil;
+    return false;
+  }
+  return true;
+}
+
+// =======================================================================
+// function : denoise
+// purpose  : Filter accumulated path tracing result into target texture
+// =======================================================================
+void Metal_RayTracing::denoise(Metal_Context* theCtx,
+                               id<MTLCommandBuffer> theCommandBuffer,
+                               id<MTLTexture> theColor,
+                               id<MTLTexture> theTarget)
+{
+  const NSUInteger aWidth = [theColor width];
+  const NSUInteger aHeight = [theColor height];
+  MTLSize aThreadgroupSize = MTLSizeMake(8, 8, 1);
+  MTLSize aThreadgroups = MTLSizeMake((aWidth + 7) / 8, (aHeight + 7) / 8, 1);
+
+  // Guiding AOVs of primary hits; intersection buffer still holds primary rays results
+  {
+    id<MTLComputeCommandEncoder> anEncoder = rayTracingEncoder(theCtx, theCommandBuffer);
+    [anEncoder setComputePipelineState:myDenoiseAOVPipeline];
+    [anEncoder setTexture:myDenoiseNormalDepthBuffer atIndex:0];
+    [anEncoder setTexture:myDenoiseAlbedoBuffer atIndex:1];
+    [anEncoder setBuffer:myIntersectionBuffer offset:0 atIndex:0];
+    [anEncoder setBuffer:myRayBuffer offset:0 atIndex:1];
+    [anEncoder setBuffer:myVertexBuffer offset:0 atIndex:2];
+    [anEncoder setBuffer:myIndexBuffer offset:0 atIndex:3];
+    [anEncoder setBuffer:myMaterialBuffer offset:0 atIndex:4];
+    [anEncoder setBuffer:myMaterialIndexBuffer offset:0 atIndex:5];
+    [anEncoder dispatchThreadgroups:aThreadgroups threadsPerThreadgroup:aThreadgroupSize];
+    [anEncoder endEncoding];
+  }
+
+  struct DenoiseParams {
+    int32_t stepSize;
+    int32_t isFirstPass;
+    int32_t isLastPass;
+    float colorPhi;
+    float normalPhi;
+    float depthPhi;
+    uint32_t pad0;
+    uint32_t pad1;
+  } aParams;
+
+  // noise deviation falls as 1/sqrt(N) - tighten luminance edge-stopping as samples converge,
+  // so that the filter fades out instead of blurring converged image
+  // (reprojected history is limited, so count frames since the last camera motion)
+  const uint32_t aNbSamples = std::min(myFrameIndex, myFramesSinceMotion);
+  const float aColorPhi = THE_DENOISE_COLOR_PHI / std::sqrt(static_cast<float>(aNbSamples + 1));
+  const int aNbIterations = std::max(myDenoiserIterations, 1);
+  id<MTLTexture> anInput = theColor;
+  for (int anIter = 0; anIter < aNbIterations; ++anIter)
+  {
+    const bool isLast = anIter == aNbIterations - 1;
+    id<MTLTexture> anOutput = isLast ? theTarget : ((anIter % 2) == 0 ? myDenoisePingBuffer : myDenoisePongBuffer);
+    aParams.stepSize = 1 << anIter;
+    aParams.isFirstPass = anIter == 0 ? 1 : 0;
+    aParams.isLastPass = isLast ? 1 : 0;
+    aParams.colorPhi = aColorPhi / static_cast<float>(1 << anIter);
+    aParams.normalPhi = THE_DENOISE_NORMAL_PHI;
+    aParams.depthPhi = THE_DENOISE_DEPTH_PHI;
+    aParams.pad0 = 0;
+    aParams.pad1 = 0;
+
+    id<MTLComputeCommandEncoder> anEncoder = rayTracingEncoder(theCtx, theCommandBuffer);
+    [anEncoder setComputePipelineState:myDenoiseFilterPipeline];
+    [anEncoder setTexture:anInput atIndex:0];
+    [anEncoder setTexture:anOutput atIndex:1];
+    [anEncoder setTexture:myDenoiseNormalDepthBuffer atIndex:2];
+    [anEncoder setTexture:myDenoiseAlbedoBuffer atIndex:3];
+    [anEncoder setBytes:&aParams length:sizeof(aParams) atIndex:0];
+    [anEncoder dispatchThreadgroups:aThreadgroups threadsPerThreadgroup:aThreadgroupSize];
+    [anEncoder endEncoding];
+    anInput = anOutput;
+  }
+}
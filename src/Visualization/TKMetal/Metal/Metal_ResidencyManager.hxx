@@ -0,0 +1,167 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef Metal_ResidencyManager_HeaderFile
+#define Metal_ResidencyManager_HeaderFile
+
+#include <NCollection_DataMap.hxx>
+#include <Standard_Transient.hxx>
+#include <Standard_Type.hxx>
+
+#include <atomic>
+#include <cstdint>
+
+#ifdef __OBJC__
+#import <dispatch/dispatch.h>
+#endif
+
+class Metal_Context;
+class Metal_Structure;
+
+//! Level of GPU memory pressure.
+enum Metal_MemoryPressure
+{
+  Metal_MemoryPressure_Normal,   //!< allocated memory is within budget
+  Metal_MemoryPressure_Warning,  //!< allocated memory approaches budget, or system reports memory warning
+  Metal_MemoryPressure_Critical  //!< allocated memory exceeds budget after eviction, or system reports critical pressure
+};
+
+//! Residency manager keeping GPU memory of the device within a budget (see Metal_Caps::gpuMemoryBudget).
+//! Structures created by Metal_GraphicDriver are registered here, and the view marks structures it displays
+//! on each frame. When device memory (MTLDevice::currentAllocatedSize) exceeds the budget,
+//! vertex and index buffers of the least recently displayed structures not used for MinIdleFrames frames
+//! are released; CPU data of primitive arrays is kept, so that buffers are transparently
+//! uploaded again once the structure is displayed (see Metal_PrimitiveArray::Init()).
+//! Released ranges are returned to heap blocks, which are then freed by Metal_BufferAllocator::Compact().
+//!
+//! System memory pressure notifications (DISPATCH_SOURCE_TYPE_MEMORYPRESSURE) raise the pressure level
+//! and evict all idle structures on critical pressure. Changes of pressure level are reported to Listener.
+class Metal_ResidencyManager : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(Metal_ResidencyManager, Standard_Transient)
+public:
+
+  //! Receiver of memory pressure changes.
+  class Listener : public Standard_Transient
+  {
+    DEFINE_STANDARD_RTTI_INLINE(Metal_ResidencyManager::Listener, Standard_Transient)
+  public:
+    //! Called from rendering thread within Update() when pressure level changes.
+    //! @param theLevel     new pressure level
+    //! @param theAllocated memory allocated by device in bytes
+    //! @param theBudget    memory budget in bytes
+    virtual void OnMemoryPressure(Metal_MemoryPressure theLevel, size_t theAllocated, size_t theBudget) = 0;
+  };
+
+  //! Minimal number of frames since the last use of the structure for eviction;
+  //! should exceed the number of frames in flight.
+  static const int MinIdleFrames = 60;
+
+public:
+
+  //! Empty constructor.
+  Standard_EXPORT Metal_ResidencyManager();
+
+  //! Destructor.
+  Standard_EXPORT ~Metal_ResidencyManager() override;
+
+  //! Initialize manager and subscribe to system memory pressure notifications.
+  //! @param theCtx    Metal context
+  //! @param theBudget memory budget in bytes; 0 means MTLDevice::recommendedMaxWorkingSetSize
+  Standard_EXPORT void Init(Metal_Context* theCtx, size_t theBudget);
+
+  //! Unsubscribe from notifications and forget registered structures.
+  Standard_EXPORT void Release();
+
+  //! Return memory budget in bytes.
+  size_t Budget() const { return myBudget; }
+
+  //! Set memory budget in bytes.
+  void SetBudget(size_t theBudget) { myBudget = theBudget; }
+
+  //! Return memory allocated by device at the last Update().
+  size_t AllocatedSize() const { return myAllocated; }
+
+  //! Return current pressure level.
+  Metal_MemoryPressure PressureLevel() const { return myLevel; }
+
+  //! Return listener of pressure changes.
+  const occ::handle<Listener>& PressureListener() const { return myListener; }
+
+  //! Set listener of pressure changes.
+  void SetPressureListener(const occ::handle<Listener>& theListener) { myListener = theListener; }
+
+  //! Return the number of structures with released GPU buffers.
+  int NbEvicted() const { return myNbEvicted; }
+
+  //! Return total amount of bytes released by eviction.
+  size_t EvictedBytes() const { return myEvictedBytes; }
+
+  //! Return the number of registered structures.
+  int NbStructures() const { return myStructures.Extent(); }
+
+public:
+
+  //! Register structure for tracking.
+  Standard_EXPORT void Register(Metal_Structure* theStruct);
+
+  //! Forget structure; called by structure destructor.
+  Standard_EXPORT void Unregister(const Metal_Structure* theStruct);
+
+  //! Mark structure as used by the current frame.
+  Standard_EXPORT void MarkUsed(const Metal_Structure* theStruct);
+
+  //! Advance frame counter, check memory usage and evict idle structures over budget;
+  //! should be called before encoding the frame, after structures shown by the frame have been marked used.
+  Standard_EXPORT void Update(Metal_Context* theCtx);
+
+protected:
+
+  //! Release buffers of idle structures, least recently used first.
+  //! @param theCtx      Metal context
+  //! @param theToFree   amount of bytes to release; 0 to release all idle structures
+  //! @return released bytes
+  size_t evict(Metal_Context* theCtx, size_t theToFree);
+
+protected:
+
+  //! Tracking state of structure.
+  struct Entry
+  {
+    Metal_Structure* Structure; //!< tracked structure
+    int64_t          LastUsed;  //!< frame of the last use
+    bool             IsEvicted; //!< GPU buffers have been released
+
+    Entry() : Structure(nullptr), LastUsed(0), IsEvicted(false) {}
+  };
+
+protected:
+
+  NCollection_DataMap<const Metal_Structure*, Entry> myStructures; //!< registered structures
+  occ::handle<Listener>     myListener;     //!< listener of pressure changes
+#ifdef __OBJC__
+  dispatch_source_t         myPressureSource; //!< system memory pressure source
+#else
+  void*                     myPressureSource;
+#endif
+  std::atomic<int>          mySystemLevel;  //!< pressure level reported by system
+  size_t                    myBudget;       //!< memory budget
+  size_t                    myAllocated;    //!< memory allocated by device
+  size_t                    myEvictedBytes; //!< total bytes released by eviction
+  int64_t                   myFrameNo;      //!< frame counter
+  int64_t                   myLastEviction; //!< frame of the last eviction
+  int                       myNbEvicted;    //!< number of evicted structures
+  Metal_MemoryPressure      myLevel;        //!< current pressure level
+};
+
+#endif // Metal_ResidencyManager_HeaderFile
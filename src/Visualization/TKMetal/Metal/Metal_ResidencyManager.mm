@@ -0,0 +1,279 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#import <Metal/Metal.h>
+
+#include <Metal_ResidencyManager.hxx>
+#include <Metal_Context.hxx>
+#include <Metal_Structure.hxx>
+#include <Message.hxx>
+#include <NCollection_Vector.hxx>
+
+#include <algorithm>
+
+IMPLEMENT_STANDARD_RTTIEXT(Metal_ResidencyManager, Standard_Transient)
+
+namespace
+{
+  //! Fraction of the budget above which pressure level is raised to warning.
+  static const double THE_WARNING_RATIO = 0.9;
+
+  //! Fraction of the budget targeted by eviction, to avoid evicting on every frame near the limit.
+  static const double THE_EVICTION_TARGET_RATIO = 0.8;
+}
+
+// =======================================================================
+// function : Metal_ResidencyManager
+// purpose  : Constructor
+// =======================================================================
+Metal_ResidencyManager::Metal_ResidencyManager()
+: myPressureSource(nil),
+  mySystemLevel(Metal_MemoryPressure_Normal),
+  myBudget(0),
+  myAllocated(0),
+  myEvictedBytes(0),
+  myFrameNo(0),
+  myLastEviction(-MinIdleFrames),
+  myNbEvicted(0),
+  myLevel(Metal_MemoryPressure_Normal)
+{
+  //
+}
+
+// =======================================================================
+// function : ~Metal_ResidencyManager
+// purpose  : Destructor
+// =======================================================================
+Metal_ResidencyManager::~Metal_ResidencyManager()
+{
+  Release();
+}
+
+// =======================================================================
+// function : Init
+// purpose  : Initialize manager
+// =======================================================================
+void Metal_ResidencyManager::Init(Metal_Context* theCtx, size_t theBudget)
+{
+  Release();
+  myBudget = theBudget;
+  if (myBudget == 0 && theCtx != nullptr && theCtx->Device() != nil)
+  {
+    if (@available(macOS 10.12, iOS 16.0, *))
+    {
+      myBudget = (size_t)theCtx->Device().recommendedMaxWorkingSetSize;
+    }
+  }
+
+  // the handler is called on a global queue, the level is consumed by Update() on rendering thread
+  myPressureSource = dispatch_source_create(DISPATCH_SOURCE_TYPE_MEMORYPRESSURE, 0,
+                                            DISPATCH_MEMORYPRESSURE_NORMAL | DISPATCH_MEMORYPRESSURE_WARN | DISPATCH_MEMORYPRESSURE_CRITICAL,
+                                            dispatch_get_global_queue(QOS_CLASS_UTILITY, 0));
+  if (myPressureSource != nil)
+  {
+    std::atomic<int>* aLevel = &mySystemLevel;
+    dispatch_source_t aSource = myPressureSource;
+    dispatch_source_set_event_handler(myPressureSource, ^{
+      const unsigned long aFlags = dispatch_source_get_data(aSource);
+      if ((aFlags & DISPATCH_MEMORYPRESSURE_CRITICAL) != 0)
+      {
+        aLevel->store(Metal_MemoryPressure_Critical);
+      }
+      else if ((aFlags & DISPATCH_MEMORYPRESSURE_WARN) != 0)
+      {
+        aLevel->store(Metal_MemoryPressure_Warning);
+      }
+      else
+      {
+        aLevel->store(Metal_MemoryPressure_Normal);
+      }
+    });
+    dispatch_resume(myPressureSource);
+  }
+}
+
+// =======================================================================
+// function : Release
+// purpose  : Release manager
+// =======================================================================
+void Metal_ResidencyManager::Release()
+{
+  if (myPressureSource != nil)
+  {
+    // cancellation waits for nothing, but the handler is not called afterwards
+    dispatch_source_cancel(myPressureSource);
+    myPressureSource = nil;
+  }
+  // structures unregister themselves, hence the map is detached first
+  NCollection_DataMap<const Metal_Structure*, Entry> aStructures;
+  aStructures.Exchange(myStructures);
+  for (NCollection_DataMap<const Metal_Structure*, Entry>::Iterator anIter(aStructures); anIter.More(); anIter.Next())
+  {
+    anIter.Value().Structure->SetResidencyManager(occ::handle<Metal_ResidencyManager>());
+  }
+  mySystemLevel = Metal_MemoryPressure_Normal;
+  myLevel = Metal_MemoryPressure_Normal;
+}
+
+// =======================================================================
+// function : Register
+// purpose  : Register structure for tracking
+// =======================================================================
+void Metal_ResidencyManager::Register(Metal_Structure* theStruct)
+{
+  if (theStruct == nullptr)
+  {
+    return;
+  }
+
+  Entry anEntry;
+  anEntry.Structure = theStruct;
+  anEntry.LastUsed = myFrameNo;
+  // structure has nothing to evict until drawn, and it might be filled by another thread till then
+  anEntry.IsEvicted = true;
+  myStructures.Bind(theStruct, anEntry);
+}
+
+// =======================================================================
+// function : Unregister
+// purpose  : Forget structure
+// =======================================================================
+void Metal_ResidencyManager::Unregister(const Metal_Structure* theStruct)
+{
+  myStructures.UnBind(theStruct);
+}
+
+// =======================================================================
+// function : MarkUsed
+// purpose  : Mark structure as used by the current frame
+// =======================================================================
+void Metal_ResidencyManager::MarkUsed(const Metal_Structure* theStruct)
+{
+  Entry* anEntry = myStructures.ChangeSeek(theStruct);
+  if (anEntry != nullptr)
+  {
+    // evicted buffers are uploaded again by lazy initialization of primitive arrays
+    anEntry->LastUsed = myFrameNo;
+    anEntry->IsEvicted = false;
+  }
+}
+
+// =======================================================================
+// function : Update
+// purpose  : Evict idle structures over budget
+// =======================================================================
+void Metal_ResidencyManager::Update(Metal_Context* theCtx)
+{
+  ++myFrameNo;
+  if (theCtx == nullptr || theCtx->Device() == nil || myBudget == 0)
+  {
+    return;
+  }
+
+  if (@available(macOS 10.13, iOS 11.0, *))
+  {
+    myAllocated = (size_t)theCtx->Device().currentAllocatedSize;
+  }
+
+  // freed ranges return to heap blocks only after frames in flight, so that eviction
+  // is not repeated until the effect of the previous one becomes visible in allocated size
+  const Metal_MemoryPressure aSystemLevel = (Metal_MemoryPressure)mySystemLevel.load();
+  const bool toEvict = myFrameNo - myLastEviction > theCtx->Caps()->maxFramesInFlight + 1;
+  if (toEvict
+   && aSystemLevel == Metal_MemoryPressure_Critical)
+  {
+    if (evict(theCtx, 0) > 0)
+    {
+      myLastEviction = myFrameNo;
+    }
+  }
+  else if (toEvict
+        && myAllocated > myBudget)
+  {
+    const size_t aTarget = size_t(double(myBudget) * THE_EVICTION_TARGET_RATIO);
+    if (evict(theCtx, myAllocated - aTarget) > 0)
+    {
+      myLastEviction = myFrameNo;
+    }
+  }
+
+  Metal_MemoryPressure aLevel = Metal_MemoryPressure_Normal;
+  if (myAllocated > myBudget)
+  {
+    aLevel = Metal_MemoryPressure_Critical;
+  }
+  else if (double(myAllocated) > double(myBudget) * THE_WARNING_RATIO)
+  {
+    aLevel = Metal_MemoryPressure_Warning;
+  }
+  aLevel = std::max(aLevel, aSystemLevel);
+  if (aLevel == myLevel)
+  {
+    return;
+  }
+
+  myLevel = aLevel;
+  if (aLevel == Metal_MemoryPressure_Critical)
+  {
+    theCtx->Messenger()->SendWarning() << "Metal_ResidencyManager: GPU memory pressure, "
+                                       << (int)(myAllocated / (1024 * 1024)) << " MB allocated of "
+                                       << (int)(myBudget / (1024 * 1024)) << " MB budget";
+  }
+  if (!myListener.IsNull())
+  {
+    myListener->OnMemoryPressure(aLevel, myAllocated, myBudget);
+  }
+}
+
+// =======================================================================
+// function : evict
+// purpose  : Release buffers of idle structures
+// =======================================================================
+size_t Metal_ResidencyManager::evict(Metal_Context* theCtx, size_t theToFree)
+{
+  NCollection_Vector<Entry*> aCandidates;
+  for (NCollection_DataMap<const Metal_Structure*, Entry>::Iterator anIter(myStructures); anIter.More(); anIter.Next())
+  {
+    Entry& anEntry = anIter.ChangeValue();
+    if (!anEntry.IsEvicted
+     && myFrameNo - anEntry.LastUsed >= MinIdleFrames)
+    {
+      aCandidates.Append(&anEntry);
+    }
+  }
+  std::sort(aCandidates.begin(), aCandidates.end(), [](const Entry* theLeft, const Entry* theRight)
+  {
+    return theLeft->LastUsed < theRight->LastUsed;
+  });
+
+  size_t aFreed = 0;
+  for (NCollection_Vector<Entry*>::Iterator aCandIter(aCandidates); aCandIter.More(); aCandIter.Next())
+  {
+    Entry* anEntry = aCandIter.Value();
+    const size_t aSize = anEntry->Structure->ReleaseGpuBuffers(theCtx);
+    anEntry->IsEvicted = true;
+    if (aSize == 0)
+    {
+      continue;
+    }
+
+    aFreed += aSize;
+    ++myNbEvicted;
+    if (theToFree != 0 && aFreed >= theToFree)
+    {
+      break;
+    }
+  }
+  myEvictedBytes += aFreed;
+  return aFreed;
+}
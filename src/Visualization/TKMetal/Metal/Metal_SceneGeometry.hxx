@@ -14,6 +14,7 @@
 #ifndef Metal_SceneGeometry_HeaderFile
 #define Metal_SceneGeometry_HeaderFile
 
+#include <Metal_FrameStats.hxx>
 #include <Metal_Resource.hxx>
 #include <NCollection_Vec3.hxx>
 #include <NCollection_Vec4.hxx>
@@ -25,6 +26,7 @@
 #ifdef __OBJC__
 @protocol MTLBuffer;
 @protocol MTLAccelerationStructure;
+@protocol MTLAccelerationStructureCommandEncoder;
 #endif
 
 class Metal_Context;
@@ -137,6 +139,49 @@ public:
   //! Return true if GPU buffers are ready.
   bool IsUploaded() const { return myVertexBuffer != nullptr; }
 
+protected:
+
+  //! Release acceleration structure and unregister it from statistics.
+  Standard_EXPORT void releaseAccelStructure();
+
+public:
+
+  //! Return true if primitive acceleration structure has been built for the current geometry.
+  bool HasAccelerationStructure() const { return myAccelStructure != nullptr; }
+
+#ifdef __OBJC__
+  //! Create primitive acceleration structure of the mesh in object space
+  //! and encode its build; mesh should be uploaded.
+  //! @param theCtx        Metal context
+  //! @param theEncoder    acceleration structure command encoder
+  //! @param theScratch    scratch buffer
+  //! @param theScratchOffset offset within scratch buffer
+  //! @return true on success
+  Standard_EXPORT bool BuildAccelerationStructure(Metal_Context* theCtx,
+                                                  id<MTLAccelerationStructureCommandEncoder> theEncoder,
+                                                  id<MTLBuffer> theScratch,
+                                                  size_t theScratchOffset);
+
+  //! Return scratch buffer size for building primitive acceleration structure; 0 if mesh is empty.
+  Standard_EXPORT size_t AccelerationStructureScratchSize(Metal_Context* theCtx) const;
+
+  //! Replace acceleration structure by its compacted copy; the original one is released
+  //! once the command buffer of the encoder is completed.
+  //! @param theCtx          Metal context
+  //! @param theEncoder      acceleration structure command encoder
+  //! @param theCompactedSize compacted size written by the build
+  //! @return true on success
+  Standard_EXPORT bool CompactAccelerationStructure(Metal_Context* theCtx,
+                                                    id<MTLAccelerationStructureCommandEncoder> theEncoder,
+                                                    size_t theCompactedSize);
+#endif
+
+  //! Return size of acceleration structure in bytes.
+  size_t AccelerationStructureSize() const { return myAccelSize; }
+
+  //! Return size of acceleration structure before compaction in bytes.
+  size_t AccelerationStructureUncompactedSize() const { return myAccelUncompactedSize; }
+
   //! Release GPU resources.
   Standard_EXPORT void Release(Metal_Context* theCtx) override;
 
@@ -152,6 +197,9 @@ public:
 
   //! Return index buffer.
   id<MTLBuffer> IndexBuffer() const { return myIndexBuffer; }
+
+  //! Return primitive acceleration structure in object space, shared by all instances of the mesh.
+  id<MTLAccelerationStructure> AccelerationStructure() const { return myAccelStructure; }
 #endif
 
 protected:
@@ -165,16 +213,21 @@ protected:
   id<MTLBuffer> myVertexBuffer;                    //!< GPU vertex buffer
   id<MTLBuffer> myNormalBuffer;                    //!< GPU normal buffer
   id<MTLBuffer> myIndexBuffer;                     //!< GPU index buffer
+  id<MTLAccelerationStructure> myAccelStructure;   //!< primitive acceleration structure
 #else
   void* myVertexBuffer;
   void* myNormalBuffer;
   void* myIndexBuffer;
+  void* myAccelStructure;
 #endif
 
   Metal_BoundingBox myBounds;                      //!< bounding box
   int myVertexCount;                               //!< number of vertices
   int myTriangleCount;                             //!< number of triangles
   int myMaterialIndex;                             //!< material index
+  occ::handle<Metal_FrameStats> myAccelStats;      //!< statistics the acceleration structure is registered in
+  size_t myAccelSize;                              //!< acceleration structure size
+  size_t myAccelUncompactedSize;                   //!< acceleration structure size before compaction
   size_t myEstimatedSize;                          //!< GPU memory estimate
   bool myNeedsUpload;                              //!< dirty flag
 };
@@ -208,7 +261,11 @@ struct Metal_GeometryInstance
 };
 
 //! Scene geometry manager for ray tracing.
-//! Manages meshes, instances, and builds acceleration structures.
+//! Manages meshes, instances, and builds acceleration structures:
+//! one primitive acceleration structure per unique mesh in object space,
+//! and an instance acceleration structure over visible instances on top of them.
+//! Intersection results refer to instances by their order among visible instances,
+//! which indexes per-instance material and normal transformation buffers.
 class Metal_SceneGeometry : public Standard_Transient
 {
   DEFINE_STANDARD_RTTIEXT(Metal_SceneGeometry, Standard_Transient)
@@ -261,6 +318,11 @@ public:
   Standard_EXPORT bool UploadMeshes(Metal_Context* theCtx);
 
   //! Build acceleration structure for ray tracing.
+  //! Primitive acceleration structures are (re)built only for meshes without valid one,
+  //! so that changing instance transforms rebuilds just the instance acceleration structure.
+  //! Builds are submitted to Metal_Context::TransferQueue(); CPU waits only for reading back
+  //! compacted sizes (Metal_Caps::compactAccelerationStructures), while the final build or copy
+  //! should be waited by rendering on GPU (see AccelerationStructureTransfer()).
   //! @param theCtx Metal context
   //! @return true on success
   Standard_EXPORT bool BuildAccelerationStructure(Metal_Context* theCtx);
@@ -268,6 +330,19 @@ public:
   //! Return true if acceleration structure is valid.
   bool HasAccelerationStructure() const { return myAccelStructure != nullptr; }
 
+  //! Return transfer building the acceleration structure (see Metal_Context::CommitTransfer());
+  //! command buffers using the structure should be preceded by Metal_Context::WaitTransfer().
+  uint64_t AccelerationStructureTransfer() const { return myAccelTransfer; }
+
+  //! Return size of instance acceleration structure in bytes.
+  size_t AccelerationStructureSize() const { return myAccelSize; }
+
+  //! Return size of instance acceleration structure before compaction in bytes.
+  size_t AccelerationStructureUncompactedSize() const { return myAccelUncompactedSize; }
+
+  //! Return scratch memory used by the last build in bytes.
+  size_t AccelerationStructureScratchSize() const { return myScratchSize; }
+
   //! Mark geometry as modified (needs rebuild).
   void SetDirty() { myIsDirty = true; }
 
@@ -277,9 +352,15 @@ public:
   //! Release GPU resources.
   Standard_EXPORT void Release(Metal_Context* theCtx);
 
-  //! Return total triangle count.
+  //! Return total triangle count (counting every instance).
   Standard_EXPORT int TotalTriangleCount() const;
 
+  //! Return triangle count stored in primitive acceleration structures (counting every unique mesh once).
+  int UniqueTriangleCount() const { return myNbUniqueTriangles; }
+
+  //! Return number of instances within instance acceleration structure.
+  int VisibleInstanceCount() const { return myMaterialIndices.Size(); }
+
   //! Return total vertex count.
   Standard_EXPORT int TotalVertexCount() const;
 
@@ -287,23 +368,24 @@ public:
   //! Return acceleration structure.
   id<MTLAccelerationStructure> AccelerationStructure() const { return myAccelStructure; }
 
-  //! Return instance buffer for instanced ray tracing.
+  //! Return instance descriptors buffer (MTLAccelerationStructureInstanceDescriptor per visible instance).
   id<MTLBuffer> InstanceBuffer() const { return myInstanceBuffer; }
 
-  //! Return per-triangle material index buffer.
+  //! Return per-instance material index buffer (int32 per visible instance).
   id<MTLBuffer> MaterialIndexBuffer() const { return myMaterialIndexBuffer; }
+
+  //! Return per-instance normal transformation buffer (3 float4 rows of inverse transposed
+  //! upper 3x3 part of instance transformation per visible instance).
+  id<MTLBuffer> NormalTransformBuffer() const { return myNormalTransformBuffer; }
 #endif
 
-  //! Return material indices array (one per triangle).
+  //! Return material indices array (one per visible instance).
   const NCollection_Vector<int32_t>& MaterialIndices() const { return myMaterialIndices; }
 
 protected:
 
-  //! Flatten geometry into single vertex/index/material arrays for BVH build.
-  Standard_EXPORT void flattenGeometry(
-    NCollection_Vector<float>& theVertices,
-    NCollection_Vector<uint32_t>& theIndices,
-    NCollection_Vector<int32_t>& theMaterialIndices) const;
+  //! Release instance acceleration structure and unregister it from statistics.
+  Standard_EXPORT void releaseAccelStructure();
 
 protected:
 
@@ -311,16 +393,24 @@ protected:
   NCollection_Vector<Metal_GeometryInstance> myInstances;          //!< instances
 
 #ifdef __OBJC__
-  id<MTLAccelerationStructure> myAccelStructure;                  //!< BVH acceleration structure
-  id<MTLBuffer> myInstanceBuffer;                                 //!< instance transforms buffer
-  id<MTLBuffer> myMaterialIndexBuffer;                            //!< per-triangle material indices
+  id<MTLAccelerationStructure> myAccelStructure;                  //!< instance acceleration structure
+  id<MTLBuffer> myInstanceBuffer;                                 //!< instance descriptors buffer
+  id<MTLBuffer> myMaterialIndexBuffer;                            //!< per-instance material indices
+  id<MTLBuffer> myNormalTransformBuffer;                          //!< per-instance normal transformations
 #else
   void* myAccelStructure;
   void* myInstanceBuffer;
   void* myMaterialIndexBuffer;
+  void* myNormalTransformBuffer;
 #endif
 
-  NCollection_Vector<int32_t> myMaterialIndices;                  //!< per-triangle material indices (CPU)
+  NCollection_Vector<int32_t> myMaterialIndices;                  //!< per-instance material indices (CPU)
+  int myNbUniqueTriangles;                                        //!< triangles in primitive acceleration structures
+  occ::handle<Metal_FrameStats> myAccelStats;                     //!< statistics the acceleration structure is registered in
+  size_t myAccelSize;                                             //!< instance acceleration structure size
+  size_t myAccelUncompactedSize;                                  //!< instance acceleration structure size before compaction
+  size_t myScratchSize;                                           //!< scratch memory of the last build
+  uint64_t myAccelTransfer;                                       //!< transfer building the acceleration structure
   bool myIsDirty;                                                 //!< geometry modified flag
 };
 
@@ -12,14 +12,42 @@
 // commercial license or contractual agreement.
 
 #import "Metal_SceneGeometry.hxx"
+#import "Metal_Caps.hxx"
 #import "Metal_Context.hxx"
 
 #import <Metal/Metal.h>
 #import <simd/simd.h>
 
+#include <NCollection_IndexedMap.hxx>
+
 IMPLEMENT_STANDARD_RTTIEXT(Metal_GeometryMesh, Metal_Resource)
 IMPLEMENT_STANDARD_RTTIEXT(Metal_SceneGeometry, Standard_Transient)
 
+namespace
+{
+  //! Alignment of scratch buffer ranges of acceleration structure builds.
+  static const size_t THE_SCRATCH_ALIGNMENT = 256;
+
+  //! Create descriptor of primitive acceleration structure of the mesh in object space.
+  static MTLPrimitiveAccelerationStructureDescriptor* meshAccelDescriptor(id<MTLBuffer> theVertexBuffer,
+                                                                          id<MTLBuffer> theIndexBuffer,
+                                                                          int theNbTriangles)
+  {
+    MTLAccelerationStructureTriangleGeometryDescriptor* aGeomDesc =
+      [MTLAccelerationStructureTriangleGeometryDescriptor descriptor];
+    aGeomDesc.vertexBuffer = theVertexBuffer;
+    aGeomDesc.vertexStride = sizeof(float) * 3;
+    aGeomDesc.indexBuffer = theIndexBuffer;
+    aGeomDesc.indexType = MTLIndexTypeUInt32;
+    aGeomDesc.triangleCount = (NSUInteger)theNbTriangles;
+    aGeomDesc.opaque = YES;
+
+    MTLPrimitiveAccelerationStructureDescriptor* aPrimDesc = [MTLPrimitiveAccelerationStructureDescriptor descriptor];
+    aPrimDesc.geometryDescriptors = @[aGeomDesc];
+    return aPrimDesc;
+  }
+}
+
 //=================================================================================================
 // Metal_GeometryMesh
 //=================================================================================================
@@ -29,6 +57,9 @@ Metal_GeometryMesh::Metal_GeometryMesh(const TCollection_AsciiString& theId)
   myVertexBuffer(nil),
   myNormalBuffer(nil),
   myIndexBuffer(nil),
+  myAccelStructure(nil),
+  myAccelSize(0),
+  myAccelUncompactedSize(0),
   myVertexCount(0),
   myTriangleCount(0),
   myMaterialIndex(0),
@@ -66,6 +97,7 @@ void Metal_GeometryMesh::SetVertices(const float* theVertices, int theCount)
   }
 
   myNeedsUpload = true;
+  releaseAccelStructure();
 }
 
 //=================================================================================================
@@ -97,6 +129,7 @@ void Metal_GeometryMesh::SetIndices(const uint32_t* theIndices, int theTriangleC
   }
 
   myNeedsUpload = true;
+  releaseAccelStructure();
 }
 
 //=================================================================================================
@@ -114,6 +147,7 @@ bool Metal_GeometryMesh::Upload(Metal_Context* theCtx)
   }
 
   id<MTLDevice> aDevice = theCtx->Device();
+  releaseAccelStructure();
   myEstimatedSize = 0;
 
   // Upload vertices
@@ -164,11 +198,111 @@ bool Metal_GeometryMesh::Upload(Metal_Context* theCtx)
 
 //=================================================================================================
 
+size_t Metal_GeometryMesh::AccelerationStructureScratchSize(Metal_Context* theCtx) const
+{
+  if (myVertexBuffer == nil || myIndexBuffer == nil || myTriangleCount <= 0)
+  {
+    return 0;
+  }
+
+  MTLPrimitiveAccelerationStructureDescriptor* aPrimDesc = meshAccelDescriptor(myVertexBuffer, myIndexBuffer, myTriangleCount);
+  return [theCtx->Device() accelerationStructureSizesWithDescriptor:aPrimDesc].buildScratchBufferSize;
+}
+
+//=================================================================================================
+
+bool Metal_GeometryMesh::BuildAccelerationStructure(Metal_Context* theCtx,
+                                                    id<MTLAccelerationStructureCommandEncoder> theEncoder,
+                                                    id<MTLBuffer> theScratch,
+                                                    size_t theScratchOffset)
+{
+  releaseAccelStructure();
+  if (myVertexBuffer == nil || myIndexBuffer == nil || myTriangleCount <= 0)
+  {
+    return false;
+  }
+
+  MTLPrimitiveAccelerationStructureDescriptor* aPrimDesc = meshAccelDescriptor(myVertexBuffer, myIndexBuffer, myTriangleCount);
+  MTLAccelerationStructureSizes aSizes = [theCtx->Device() accelerationStructureSizesWithDescriptor:aPrimDesc];
+  myAccelStructure = [theCtx->Device() newAccelerationStructureWithSize:aSizes.accelerationStructureSize];
+  if (myAccelStructure == nil)
+  {
+    return false;
+  }
+
+  [theEncoder buildAccelerationStructure:myAccelStructure
+                              descriptor:aPrimDesc
+                           scratchBuffer:theScratch
+                     scratchBufferOffset:theScratchOffset];
+  myAccelSize = aSizes.accelerationStructureSize;
+  myAccelUncompactedSize = myAccelSize;
+  myEstimatedSize += myAccelSize;
+  myAccelStats = theCtx->FrameStats();
+  if (!myAccelStats.IsNull())
+  {
+    myAccelStats->AddAccelStructure(myAccelSize, myAccelUncompactedSize);
+  }
+  return true;
+}
+
+//=================================================================================================
+
+bool Metal_GeometryMesh::CompactAccelerationStructure(Metal_Context* theCtx,
+                                                      id<MTLAccelerationStructureCommandEncoder> theEncoder,
+                                                      size_t theCompactedSize)
+{
+  if (myAccelStructure == nil || theCompactedSize == 0 || theCompactedSize >= myAccelSize)
+  {
+    return false;
+  }
+
+  id<MTLAccelerationStructure> aCompacted = [theCtx->Device() newAccelerationStructureWithSize:theCompactedSize];
+  if (aCompacted == nil)
+  {
+    return false;
+  }
+
+  // the original structure is kept alive by the command buffer until the copy is done
+  [theEncoder copyAndCompactAccelerationStructure:myAccelStructure
+                          toAccelerationStructure:aCompacted];
+  myAccelStructure = aCompacted;
+  if (!myAccelStats.IsNull())
+  {
+    myAccelStats->RemoveAccelStructure(myAccelSize, myAccelUncompactedSize);
+    myAccelStats->AddAccelStructure(theCompactedSize, myAccelUncompactedSize);
+  }
+  myEstimatedSize -= myAccelSize;
+  myAccelSize = theCompactedSize;
+  myEstimatedSize += myAccelSize;
+  return true;
+}
+
+//=================================================================================================
+
+void Metal_GeometryMesh::releaseAccelStructure()
+{
+  if (myAccelStructure != nil)
+  {
+    if (!myAccelStats.IsNull())
+    {
+      myAccelStats->RemoveAccelStructure(myAccelSize, myAccelUncompactedSize);
+    }
+    myEstimatedSize -= std::min(myEstimatedSize, myAccelSize);
+  }
+  myAccelStructure = nil;
+  myAccelStats.Nullify();
+  myAccelSize = 0;
+  myAccelUncompactedSize = 0;
+}
+
+//=================================================================================================
+
 void Metal_GeometryMesh::Release(Metal_Context* /*theCtx*/)
 {
   myVertexBuffer = nil;
   myNormalBuffer = nil;
   myIndexBuffer = nil;
+  releaseAccelStructure();
   myEstimatedSize = 0;
   myNeedsUpload = true;
 }
@@ -181,6 +315,12 @@ Metal_SceneGeometry::Metal_SceneGeometry()
 : myAccelStructure(nil),
   myInstanceBuffer(nil),
   myMaterialIndexBuffer(nil),
+  myNormalTransformBuffer(nil),
+  myNbUniqueTriangles(0),
+  myAccelSize(0),
+  myAccelUncompactedSize(0),
+  myScratchSize(0),
+  myAccelTransfer(0),
   myIsDirty(true)
 {
 }
@@ -295,149 +435,255 @@ bool Metal_SceneGeometry::BuildAccelerationStructure(Metal_Context* theCtx)
     return false;
   }
 
-  // Flatten all geometry with material indices
-  NCollection_Vector<float> aVertices;
-  NCollection_Vector<uint32_t> aIndices;
+  // Collect unique meshes of visible instances;
+  // index of the mesh within the map is the index of its acceleration structure within instance one
+  NCollection_IndexedMap<occ::handle<Metal_GeometryMesh>> aMeshes;
   NCollection_Vector<int32_t> aMaterialIndices;
-  flattenGeometry(aVertices, aIndices, aMaterialIndices);
-
-  if (aVertices.Size() == 0 || aIndices.Size() == 0)
+  for (int i = 0; i < myInstances.Size(); ++i)
+  {
+    const Metal_GeometryInstance& anInst = myInstances.Value(i);
+    if (!anInst.Visible || anInst.Mesh.IsNull() || anInst.Mesh->TriangleCount() <= 0)
+    {
+      continue;
+    }
+    aMeshes.Add(anInst.Mesh);
+    aMaterialIndices.Append(anInst.MaterialOverride >= 0 ? anInst.MaterialOverride : anInst.Mesh->MaterialIndex());
+  }
+  if (aMeshes.IsEmpty())
   {
     return false;
   }
 
-  // Store material indices for later access
-  myMaterialIndices = aMaterialIndices;
+  releaseAccelStructure();
 
-  // Create material index buffer
-  if (aMaterialIndices.Size() > 0)
+  // Upload meshes and find those needing (re)build of primitive acceleration structure;
+  // their builds share one scratch buffer at distinct offsets
+  NCollection_Vector<size_t> aScratchOffsets;
+  size_t aScratchSize = 0;
+  myNbUniqueTriangles = 0;
+  for (int aMeshIter = 1; aMeshIter <= aMeshes.Extent(); ++aMeshIter)
   {
-    myMaterialIndexBuffer = [aDevice newBufferWithBytes:&aMaterialIndices.First()
-                                                 length:aMaterialIndices.Size() * sizeof(int32_t)
-                                                options:MTLResourceStorageModeShared];
+    const occ::handle<Metal_GeometryMesh>& aMesh = aMeshes.FindKey(aMeshIter);
+    if (!aMesh->Upload(theCtx))
+    {
+      return false;
+    }
+    myNbUniqueTriangles += aMesh->TriangleCount();
+    aScratchOffsets.Append(aScratchSize);
+    if (!aMesh->HasAccelerationStructure())
+    {
+      aScratchSize += (aMesh->AccelerationStructureScratchSize(theCtx) + THE_SCRATCH_ALIGNMENT - 1)
+                    & ~(THE_SCRATCH_ALIGNMENT - 1);
+    }
   }
 
-  // Create vertex/index buffers
-  id<MTLBuffer> aVertexBuffer = [aDevice newBufferWithBytes:&aVertices.First()
-                                                     length:aVertices.Size() * sizeof(float)
-                                                    options:MTLResourceStorageModeShared];
-
-  id<MTLBuffer> anIndexBuffer = [aDevice newBufferWithBytes:&aIndices.First()
-                                                     length:aIndices.Size() * sizeof(uint32_t)
-                                                    options:MTLResourceStorageModeShared];
-
-  // Create geometry descriptor
-  MTLAccelerationStructureTriangleGeometryDescriptor* aGeomDesc =
-    [[MTLAccelerationStructureTriangleGeometryDescriptor alloc] init];
-  aGeomDesc.vertexBuffer = aVertexBuffer;
-  aGeomDesc.vertexStride = sizeof(float) * 3;
-  aGeomDesc.indexBuffer = anIndexBuffer;
-  aGeomDesc.indexType = MTLIndexTypeUInt32;
-  aGeomDesc.triangleCount = (NSUInteger)(aIndices.Size() / 3);
-
-  // Create primitive acceleration structure descriptor
-  MTLPrimitiveAccelerationStructureDescriptor* aPrimDesc =
-    [[MTLPrimitiveAccelerationStructureDescriptor alloc] init];
-  aPrimDesc.geometryDescriptors = @[aGeomDesc];
-
-  // Get acceleration structure sizes
-  MTLAccelerationStructureSizes aSizes = [aDevice accelerationStructureSizesWithDescriptor:aPrimDesc];
-
-  // Create acceleration structure
-  myAccelStructure = [aDevice newAccelerationStructureWithSize:aSizes.accelerationStructureSize];
-  if (myAccelStructure == nil)
+  // Fill instance descriptors and per-instance shading data
+  const int aNbInstances = aMaterialIndices.Size();
+  myInstanceBuffer = [aDevice newBufferWithLength:aNbInstances * sizeof(MTLAccelerationStructureInstanceDescriptor)
+                                          options:MTLResourceStorageModeShared];
+  myNormalTransformBuffer = [aDevice newBufferWithLength:aNbInstances * sizeof(NCollection_Vec4<float>) * 3
+                                                 options:MTLResourceStorageModeShared];
+  myMaterialIndexBuffer = [aDevice newBufferWithBytes:&aMaterialIndices.First()
+                                               length:aNbInstances * sizeof(int32_t)
+                                              options:MTLResourceStorageModeShared];
+  if (myInstanceBuffer == nil || myNormalTransformBuffer == nil || myMaterialIndexBuffer == nil)
   {
-    NSLog(@"Metal_SceneGeometry: Failed to create acceleration structure");
+    NSLog(@"Metal_SceneGeometry: Failed to allocate instance buffers");
     return false;
   }
+  myMaterialIndices = aMaterialIndices;
 
-  // Create scratch buffer
-  id<MTLBuffer> aScratchBuffer = [aDevice newBufferWithLength:aSizes.buildScratchBufferSize
-                                                      options:MTLResourceStorageModePrivate];
-
-  // Build the acceleration structure
-  id<MTLCommandQueue> aQueue = theCtx->CommandQueue();
-  id<MTLCommandBuffer> aCommandBuffer = [aQueue commandBuffer];
-  id<MTLAccelerationStructureCommandEncoder> anEncoder = [aCommandBuffer accelerationStructureCommandEncoder];
-
-  [anEncoder buildAccelerationStructure:myAccelStructure
-                             descriptor:aPrimDesc
-                          scratchBuffer:aScratchBuffer
-                    scratchBufferOffset:0];
-
-  [anEncoder endEncoding];
-  [aCommandBuffer commit];
-  [aCommandBuffer waitUntilCompleted];
-
-  myIsDirty = false;
-  NSLog(@"Metal_SceneGeometry: Built acceleration structure with %d triangles",
-        (int)(aIndices.Size() / 3));
-
-  return true;
-}
-
-//=================================================================================================
-
-void Metal_SceneGeometry::flattenGeometry(
-  NCollection_Vector<float>& theVertices,
-  NCollection_Vector<uint32_t>& theIndices,
-  NCollection_Vector<int32_t>& theMaterialIndices) const
-{
-  theVertices.Clear();
-  theIndices.Clear();
-  theMaterialIndices.Clear();
-
-  uint32_t aVertexOffset = 0;
-
+  MTLAccelerationStructureInstanceDescriptor* anInstDescs = (MTLAccelerationStructureInstanceDescriptor*)[myInstanceBuffer contents];
+  NCollection_Vec4<float>* aNormalRows = (NCollection_Vec4<float>*)[myNormalTransformBuffer contents];
+  int anInstIndex = 0;
   for (int i = 0; i < myInstances.Size(); ++i)
   {
     const Metal_GeometryInstance& anInst = myInstances.Value(i);
-    if (!anInst.Visible || anInst.Mesh.IsNull())
+    if (!anInst.Visible || anInst.Mesh.IsNull() || anInst.Mesh->TriangleCount() <= 0)
     {
       continue;
     }
 
-    const occ::handle<Metal_GeometryMesh>& aMesh = anInst.Mesh;
-    int aVertCount = aMesh->VertexCount();
-    int aTriCount = aMesh->TriangleCount();
-
-    // Determine material index for this instance
-    int aMaterialIdx = (anInst.MaterialOverride >= 0)
-                       ? anInst.MaterialOverride
-                       : aMesh->MaterialIndex();
+    MTLAccelerationStructureInstanceDescriptor& aDesc = anInstDescs[anInstIndex];
+    for (int aCol = 0; aCol < 4; ++aCol)
+    {
+      for (int aRow = 0; aRow < 3; ++aRow)
+      {
+        aDesc.transformationMatrix.columns[aCol].elements[aRow] = anInst.Transform.GetValue(aRow, aCol);
+      }
+    }
+    aDesc.options = MTLAccelerationStructureInstanceOptionOpaque;
+    aDesc.mask = 0xFF;
+    aDesc.intersectionFunctionTableOffset = 0;
+    aDesc.accelerationStructureIndex = (uint32_t)(aMeshes.FindIndex(anInst.Mesh) - 1);
 
-    // Transform and append vertices
-    const NCollection_Vector<float>& aSrcVerts = aMesh->myVertexData;
-    for (int v = 0; v < aVertCount; ++v)
+    // normals are transformed by inverse transposed matrix - rows of transposed are columns of inverse
+    for (int aRow = 0; aRow < 3; ++aRow)
     {
-      NCollection_Vec4<float> p(
-        aSrcVerts.Value(v * 3 + 0),
-        aSrcVerts.Value(v * 3 + 1),
-        aSrcVerts.Value(v * 3 + 2),
-        1.0f);
+      aNormalRows[anInstIndex * 3 + aRow] = NCollection_Vec4<float>(anInst.TransformInverse.GetValue(0, aRow),
+                                                                    anInst.TransformInverse.GetValue(1, aRow),
+                                                                    anInst.TransformInverse.GetValue(2, aRow),
+                                                                    0.0f);
+    }
+    ++anInstIndex;
+  }
 
-      NCollection_Vec4<float> transformed = anInst.Transform * p;
+  // Instance acceleration structure over primitive ones
+  NSMutableArray* aMeshStructures = [NSMutableArray arrayWithCapacity:aMeshes.Extent()];
+  MTLInstanceAccelerationStructureDescriptor* anInstAccelDesc = [MTLInstanceAccelerationStructureDescriptor descriptor];
+  anInstAccelDesc.instanceCount = (NSUInteger)aNbInstances;
+  anInstAccelDesc.instanceDescriptorBuffer = myInstanceBuffer;
+  anInstAccelDesc.instanceDescriptorType = MTLAccelerationStructureInstanceDescriptorTypeDefault;
+
+  const bool toCompact = theCtx->Caps()->compactAccelerationStructures;
+  // builds run on transfer queue, so that CPU readbacks of compacted sizes do not wait for frames in flight
+  id<MTLCommandBuffer> aCommandBuffer = theCtx->CreateTransferCommandBuffer();
+  aCommandBuffer.label = @"SceneGeometry_BuildAccel";
+  if (aScratchSize != 0)
+  {
+    id<MTLBuffer> aScratchBuffer = [aDevice newBufferWithLength:aScratchSize
+                                                        options:MTLResourceStorageModePrivate];
+    if (aScratchBuffer == nil)
+    {
+      NSLog(@"Metal_SceneGeometry: Failed to allocate scratch buffer");
+      return false;
+    }
 
-      theVertices.Append(transformed.x());
-      theVertices.Append(transformed.y());
-      theVertices.Append(transformed.z());
+    NCollection_Vector<int> aBuiltMeshes;
+    id<MTLAccelerationStructureCommandEncoder> anEncoder = [aCommandBuffer accelerationStructureCommandEncoder];
+    for (int aMeshIter = 1; aMeshIter <= aMeshes.Extent(); ++aMeshIter)
+    {
+      const occ::handle<Metal_GeometryMesh>& aMesh = aMeshes.FindKey(aMeshIter);
+      if (aMesh->HasAccelerationStructure())
+      {
+        continue;
+      }
+      if (!aMesh->BuildAccelerationStructure(theCtx, anEncoder, aScratchBuffer, aScratchOffsets.Value(aMeshIter - 1)))
+      {
+        [anEncoder endEncoding];
+        NSLog(@"Metal_SceneGeometry: Failed to create acceleration structure of mesh");
+        return false;
+      }
+      aBuiltMeshes.Append(aMeshIter);
+    }
+    [anEncoder endEncoding];
+    if (!theCtx->FrameStats().IsNull())
+    {
+      theCtx->FrameStats()->AddAccelStructScratch(aScratchSize);
     }
 
-    // Append indices with offset
-    const NCollection_Vector<uint32_t>& aSrcInds = aMesh->myIndexData;
-    for (int t = 0; t < aTriCount * 3; ++t)
+    // Compacted size is known only after the build completes;
+    // instance structure should refer to compacted primitive structures, so compact them first
+    if (toCompact)
     {
-      theIndices.Append(aSrcInds.Value(t) + aVertexOffset);
+      id<MTLBuffer> aSizeBuffer = [aDevice newBufferWithLength:std::max(aBuiltMeshes.Size(), 1) * sizeof(uint32_t)
+                                                       options:MTLResourceStorageModeShared];
+      if (aSizeBuffer != nil)
+      {
+        id<MTLAccelerationStructureCommandEncoder> aSizeEncoder = [aCommandBuffer accelerationStructureCommandEncoder];
+        for (int aBuiltIter = 0; aBuiltIter < aBuiltMeshes.Size(); ++aBuiltIter)
+        {
+          [aSizeEncoder writeCompactedAccelerationStructureSize:aMeshes.FindKey(aBuiltMeshes.Value(aBuiltIter))->AccelerationStructure()
+                                                       toBuffer:aSizeBuffer
+                                                         offset:aBuiltIter * sizeof(uint32_t)];
+        }
+        [aSizeEncoder endEncoding];
+        [aCommandBuffer commit];
+        [aCommandBuffer waitUntilCompleted];
+
+        const uint32_t* aCompactedSizes = (const uint32_t*)[aSizeBuffer contents];
+        aCommandBuffer = theCtx->CreateTransferCommandBuffer();
+        aCommandBuffer.label = @"SceneGeometry_CompactAccel";
+        id<MTLAccelerationStructureCommandEncoder> aCompactEncoder = [aCommandBuffer accelerationStructureCommandEncoder];
+        for (int aBuiltIter = 0; aBuiltIter < aBuiltMeshes.Size(); ++aBuiltIter)
+        {
+          aMeshes.FindKey(aBuiltMeshes.Value(aBuiltIter))->CompactAccelerationStructure(theCtx, aCompactEncoder, aCompactedSizes[aBuiltIter]);
+        }
+        [aCompactEncoder endEncoding];
+      }
     }
+  }
+  for (int aMeshIter = 1; aMeshIter <= aMeshes.Extent(); ++aMeshIter)
+  {
+    [aMeshStructures addObject:aMeshes.FindKey(aMeshIter)->AccelerationStructure()];
+  }
+  anInstAccelDesc.instancedAccelerationStructures = aMeshStructures;
+
+  MTLAccelerationStructureSizes aSizes = [aDevice accelerationStructureSizesWithDescriptor:anInstAccelDesc];
+  myAccelStructure = [aDevice newAccelerationStructureWithSize:aSizes.accelerationStructureSize];
+  id<MTLBuffer> anInstScratch = [aDevice newBufferWithLength:std::max<NSUInteger>(aSizes.buildScratchBufferSize, 1)
+                                                     options:MTLResourceStorageModePrivate];
+  if (myAccelStructure == nil || anInstScratch == nil)
+  {
+    NSLog(@"Metal_SceneGeometry: Failed to create acceleration structure");
+    return false;
+  }
 
-    // Append material index for each triangle
-    for (int t = 0; t < aTriCount; ++t)
+  // separate encoder to order the build after primitive structures it refers to
+  id<MTLAccelerationStructureCommandEncoder> anInstEncoder = [aCommandBuffer accelerationStructureCommandEncoder];
+  [anInstEncoder buildAccelerationStructure:myAccelStructure
+                                 descriptor:anInstAccelDesc
+                              scratchBuffer:anInstScratch
+                        scratchBufferOffset:0];
+  id<MTLBuffer> anInstSizeBuffer = toCompact
+                                 ? [aDevice newBufferWithLength:sizeof(uint32_t)
+                                                        options:MTLResourceStorageModeShared]
+                                 : nil;
+  if (anInstSizeBuffer != nil)
+  {
+    [anInstEncoder writeCompactedAccelerationStructureSize:myAccelStructure
+                                                  toBuffer:anInstSizeBuffer
+                                                    offset:0];
+  }
+  [anInstEncoder endEncoding];
+  if (anInstSizeBuffer != nil)
+  {
+    [aCommandBuffer commit];
+    [aCommandBuffer waitUntilCompleted];
+    myAccelTransfer = 0;
+  }
+  else
+  {
+    // rendering waits for the build on GPU
+    myAccelTransfer = theCtx->CommitTransfer(aCommandBuffer);
+  }
+
+  myAccelSize = aSizes.accelerationStructureSize;
+  myAccelUncompactedSize = myAccelSize;
+  myScratchSize = std::max<size_t>(aScratchSize, aSizes.buildScratchBufferSize);
+  if (anInstSizeBuffer != nil)
+  {
+    const size_t aCompactedSize = *(const uint32_t*)[anInstSizeBuffer contents];
+    id<MTLAccelerationStructure> aCompacted = aCompactedSize != 0 && aCompactedSize < myAccelSize
+                                            ? [aDevice newAccelerationStructureWithSize:aCompactedSize]
+                                            : nil;
+    if (aCompacted != nil)
     {
-      theMaterialIndices.Append(aMaterialIdx);
+      // the uncompacted structure is retained by the command buffer till the copy is done
+      id<MTLCommandBuffer> aCompactBuffer = theCtx->CreateTransferCommandBuffer();
+      aCompactBuffer.label = @"SceneGeometry_CompactAccel";
+      id<MTLAccelerationStructureCommandEncoder> aCompactEncoder = [aCompactBuffer accelerationStructureCommandEncoder];
+      [aCompactEncoder copyAndCompactAccelerationStructure:myAccelStructure
+                                   toAccelerationStructure:aCompacted];
+      [aCompactEncoder endEncoding];
+      myAccelTransfer = theCtx->CommitTransfer(aCompactBuffer);
+      myAccelStructure = aCompacted;
+      myAccelSize = aCompactedSize;
     }
+  }
 
-    aVertexOffset += aVertCount;
+  myAccelStats = theCtx->FrameStats();
+  if (!myAccelStats.IsNull())
+  {
+    myAccelStats->AddAccelStructure(myAccelSize, myAccelUncompactedSize);
+    myAccelStats->AddAccelStructScratch(aSizes.buildScratchBufferSize);
   }
+
+  myIsDirty = false;
+  NSLog(@"Metal_SceneGeometry: Built acceleration structure with %d instances of %d meshes (%d unique triangles)",
+        aNbInstances, aMeshes.Extent(), myNbUniqueTriangles);
+
+  return true;
 }
 
 //=================================================================================================
@@ -449,15 +695,33 @@ void Metal_SceneGeometry::Release(Metal_Context* theCtx)
     myMeshes.ChangeValue(i)->Release(theCtx);
   }
 
-  myAccelStructure = nil;
+  releaseAccelStructure();
   myInstanceBuffer = nil;
   myMaterialIndexBuffer = nil;
+  myNormalTransformBuffer = nil;
   myMaterialIndices.Clear();
+  myNbUniqueTriangles = 0;
   myIsDirty = true;
 }
 
 //=================================================================================================
 
+void Metal_SceneGeometry::releaseAccelStructure()
+{
+  if (myAccelStructure != nil
+  && !myAccelStats.IsNull())
+  {
+    myAccelStats->RemoveAccelStructure(myAccelSize, myAccelUncompactedSize);
+  }
+  myAccelStructure = nil;
+  myAccelStats.Nullify();
+  myAccelSize = 0;
+  myAccelUncompactedSize = 0;
+  myAccelTransfer = 0;
+}
+
+//=================================================================================================
+
 int Metal_SceneGeometry::TotalTriangleCount() const
 {
   int aTotal = 0;
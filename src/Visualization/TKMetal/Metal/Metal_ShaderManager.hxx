@@ -20,17 +20,25 @@
 #include <Graphic3d_ShaderFlags.hxx>
 #include <Graphic3d_SequenceOfHClipPlane.hxx>
 #include <Metal_Material.hxx>
+#include <Metal_PipelineCache.hxx>
+#include <Metal_PipelineProfile.hxx>
+#include <Metal_ShaderProgramKey.hxx>
 #include <NCollection_DataMap.hxx>
+#include <NCollection_Map.hxx>
 #include <NCollection_Mat4.hxx>
 #include <NCollection_Vec4.hxx>
 #include <TCollection_AsciiString.hxx>
 
+#include <mutex>
+
 #ifdef __OBJC__
 @protocol MTLDevice;
 @protocol MTLLibrary;
 @protocol MTLRenderPipelineState;
 @protocol MTLDepthStencilState;
 @protocol MTLFunction;
+@class MTLRenderPipelineDescriptor;
+@class NSMutableArray;
 #endif
 
 class Metal_Context;
@@ -42,6 +50,16 @@ static const int Metal_MaxLights = 8;
 //! Maximum number of clipping planes supported in shaders.
 static const int Metal_MaxClipPlanes = 8;
 
+//! Program bit extending Graphic3d_ShaderFlags: vertex stage reads nodal normals packed
+//! as octahedral vectors of 2 normalized 16-bit integers (see Metal_Caps::useQuantizedVertices).
+static const int Metal_ProgramBits_OctNormals = Graphic3d_ShaderFlags_NB;
+
+//! Index of boolean function constant enabling clipping planes in fragment functions.
+static const int Metal_FunctionConstant_ClipPlanes = 0;
+
+//! Index of boolean function constant enabling octahedral normals in vertex functions.
+static const int Metal_FunctionConstant_OctNormals = 1;
+
 //! Packed light source parameters for shader uniform.
 struct Metal_ShaderLightSource
 {
@@ -194,41 +212,6 @@ struct Metal_MaterialUniforms
   }
 };
 
-//! Shader program configuration key.
-struct Metal_ShaderProgramKey
-{
-  Graphic3d_TypeOfShadingModel ShadingModel;
-  int                          ProgramBits;
-
-  Metal_ShaderProgramKey(Graphic3d_TypeOfShadingModel theModel = Graphic3d_TypeOfShadingModel_Unlit,
-                         int theBits = 0)
-  : ShadingModel(theModel), ProgramBits(theBits) {}
-
-  bool operator==(const Metal_ShaderProgramKey& theOther) const
-  {
-    return ShadingModel == theOther.ShadingModel && ProgramBits == theOther.ProgramBits;
-  }
-
-  size_t HashCode(size_t theUpperBound) const
-  {
-    return (static_cast<size_t>(ShadingModel) * 1000 + ProgramBits) % theUpperBound;
-  }
-};
-
-//! Hash functor for Metal_ShaderProgramKey.
-struct Metal_ShaderProgramKeyHasher
-{
-  size_t operator()(const Metal_ShaderProgramKey& theKey) const noexcept
-  {
-    return static_cast<size_t>(theKey.ShadingModel) * 1000 + theKey.ProgramBits;
-  }
-
-  bool operator()(const Metal_ShaderProgramKey& theKey1, const Metal_ShaderProgramKey& theKey2) const noexcept
-  {
-    return theKey1 == theKey2;
-  }
-};
-
 //! Shader manager for Metal backend.
 //! Manages shader program compilation and caching.
 class Metal_ShaderManager : public Graphic3d_ShaderManager
@@ -307,6 +290,18 @@ public: //! @name Material state
                                             bool theToDistinguish,
                                             bool theIsPBR);
 
+  //! Fill comprehensive material uniforms from Metal_Material.
+  //! @param theUniforms [out] material uniforms to fill
+  //! @param theMaterial front/back material data
+  //! @param theAlphaCutoff alpha test threshold (>1.0 disables)
+  //! @param theToDistinguish distinguish front/back faces
+  //! @param theIsPBR use PBR shading model
+  Standard_EXPORT static void FillMaterialUniforms(Metal_MaterialUniforms& theUniforms,
+                                                   const Metal_Material& theMaterial,
+                                                   float theAlphaCutoff,
+                                                   bool theToDistinguish,
+                                                   bool theIsPBR);
+
   //! Return comprehensive material uniforms.
   const Metal_MaterialUniforms& MaterialUniforms() const { return myMaterialUniforms; }
 
@@ -388,12 +383,17 @@ public: //! @name Hatch attributes
 
 public: //! @name Shader program access
 
+  //! Return program bits reduced to the features affecting pipeline state:
+  //! clipping planes of any count are handled by the same specialization.
+  Standard_EXPORT static int PipelineBits(int theBits);
+
   //! Get or create shader program for specified shading model and configuration.
   //! @param[in] theModel     shading model (Unlit, Phong, PBR, etc.)
   //! @param[in] theBits      additional shader flags
   //! @param[out] thePipeline returned pipeline state
   //! @param[out] theDepthStencil returned depth-stencil state
   //! @return true on success
+  //! Thread-safe (can be called by workspaces of parallel encoding).
   Standard_EXPORT bool GetProgram(Graphic3d_TypeOfShadingModel theModel,
                                    int theBits,
 #ifdef __OBJC__
@@ -405,6 +405,86 @@ public: //! @name Shader program access
 #endif
                                    );
 
+  //! Get or create pipeline for instanced draws (see Metal_PrimitiveArray::RenderInstanced()),
+  //! taking model-view matrix and color of each instance from Metal_InstanceData at vertex buffer 10.
+  //! Fragment stage is the same as for GetProgram(); only unlit, Phong, PBR and facet shading have instanced variant.
+  //! @param[in] theModel     shading model
+  //! @param[in] theBits      additional shader flags
+  //! @param[out] thePipeline returned pipeline state
+  //! @return FALSE if configuration cannot be instanced
+  //! Thread-safe (can be called by workspaces of parallel encoding).
+  Standard_EXPORT bool GetInstancedProgram(Graphic3d_TypeOfShadingModel theModel,
+                                           int theBits,
+#ifdef __OBJC__
+                                           __strong id<MTLRenderPipelineState>& thePipeline
+#else
+                                           void*& thePipeline
+#endif
+                                           );
+
+  //! Get or create mesh shader pipeline rendering Metal_MeshletBuffer for specified configuration.
+  //! Only configurations drawn by vertex_phong function (Phong and PBR shading with nodal normals)
+  //! have mesh shader variant; requires Metal_Context::HasMeshShaders().
+  //! @param[in] theModel     shading model
+  //! @param[in] theBits      additional shader flags
+  //! @param[out] thePipeline returned pipeline state
+  //! @return FALSE if configuration cannot be rendered by meshlets
+  //! Thread-safe (can be called by workspaces of parallel encoding).
+  Standard_EXPORT bool GetMeshletProgram(Graphic3d_TypeOfShadingModel theModel,
+                                         int theBits,
+#ifdef __OBJC__
+                                         __strong id<MTLRenderPipelineState>& thePipeline
+#else
+                                         void*& thePipeline
+#endif
+                                         );
+
+  //! Get or create tessellation pipeline evaluating Metal_BSplineSurface patches
+  //! (see Metal_TessellationController::DrawBSplineSurface()).
+  //! Fragment stage is the one of vertex_phong configurations; other shading models fall back to Phong,
+  //! as surface normals are always evaluated analytically.
+  //! @param[in] theModel     shading model
+  //! @param[in] theBits      additional shader flags
+  //! @param[out] thePipeline returned pipeline state
+  //! @return FALSE if pipeline cannot be created
+  //! Thread-safe (can be called by workspaces of parallel encoding).
+  Standard_EXPORT bool GetBSplineProgram(Graphic3d_TypeOfShadingModel theModel,
+                                         int theBits,
+#ifdef __OBJC__
+                                         __strong id<MTLRenderPipelineState>& thePipeline
+#else
+                                         void*& thePipeline
+#endif
+                                         );
+
+  //! Get or create point pipeline drawing slots of Metal_PointCloud with per-point colors and point size
+  //! (see Metal_Workspace::ApplyPointCloudPipelineState()); fragment stage is the one of unlit configurations.
+  //! @param[in] theBits      additional shader flags
+  //! @param[out] thePipeline returned pipeline state
+  //! @return FALSE if pipeline cannot be created
+  //! Thread-safe (can be called by workspaces of parallel encoding).
+  Standard_EXPORT bool GetPointCloudProgram(int theBits,
+#ifdef __OBJC__
+                                            __strong id<MTLRenderPipelineState>& thePipeline
+#else
+                                            void*& thePipeline
+#endif
+                                            );
+
+  //! Get or create pipeline drawing line segments of Metal_PrimitiveArray as instanced screen-space quads
+  //! with miter joins, anti-aliased edges and line pattern (see Metal_Workspace::ApplyWideLinePipelineState()).
+  //! @param[in] theBits      additional shader flags (Graphic3d_ShaderFlags_ClipPlanesN for clipping)
+  //! @param[out] thePipeline returned pipeline state
+  //! @return FALSE if pipeline cannot be created
+  //! Thread-safe (can be called by workspaces of parallel encoding).
+  Standard_EXPORT bool GetWideLineProgram(int theBits,
+#ifdef __OBJC__
+                                          __strong id<MTLRenderPipelineState>& thePipeline
+#else
+                                          void*& thePipeline
+#endif
+                                          );
+
   //! Choose appropriate shading model for faces.
   Graphic3d_TypeOfShadingModel ChooseFaceShadingModel(Graphic3d_TypeOfShadingModel theCustomModel,
                                                        bool theHasNodalNormals) const;
@@ -426,6 +506,48 @@ public: //! @name Shader program access
   void* ShaderLibrary() const { return myShaderLibrary; }
 #endif
 
+  //! Return persistent pipeline cache (NULL if disabled, see Metal_Caps::pipelineCachePath).
+  const occ::handle<Metal_PipelineCache>& PipelineArchive() const { return myPipelineArchive; }
+
+  //! Return usage profile of pipelines (NULL if disabled, see Metal_Caps::pipelineProfilePath).
+  const occ::handle<Metal_PipelineProfile>& UsageProfile() const { return myUsageProfile; }
+
+  //! Start background compilation of pipelines recorded within usage profile.
+  //! Done automatically at construction, when Metal_Caps::pipelineProfilePath is defined.
+  //! Programs requested before compilation is done are drawn with fallback programs.
+  //! @return number of scheduled pipelines
+  Standard_EXPORT int WarmUp();
+
+  //! Return TRUE if some pipelines are still being compiled asynchronously
+  //! (see Metal_Caps::asyncPipelineCompilation) so that fallback programs are used in their place.
+  //! The view should be redrawn until this flag is reset.
+  bool HasPendingPrograms() const { return !myPendingPipelines.IsEmpty(); }
+
+  //! Return counter incremented each time asynchronously compiled pipelines become available.
+  unsigned int ProgramsRevision() const { return myProgramsRevision; }
+
+  //! Return the number of pipeline requests served by in-memory cache.
+  size_t NbPipelineCacheHits() const { return myNbPipelineHits; }
+
+  //! Return the number of pipeline requests missing in-memory cache
+  //! (pipelines created, loaded from persistent archive or drawn by fallback programs).
+  size_t NbPipelineCacheMisses() const { return myNbPipelineMisses; }
+
+  //! Return the number of missed pipelines found in persistent archive (see PipelineArchive()).
+  size_t NbPipelineArchiveHits() const { return myNbPipelineArchiveHits; }
+
+  //! Reset pipeline cache counters.
+  void ResetPipelineCacheStats()
+  {
+    myNbPipelineHits = 0;
+    myNbPipelineMisses = 0;
+    myNbPipelineArchiveHits = 0;
+  }
+
+  //! Write persistent pipeline cache to disk (done automatically on Release()).
+  //! @return FALSE on write failure
+  Standard_EXPORT bool SavePipelineCache();
+
 public: //! @name Uniform buffer preparation
 
   //! Prepare frame uniforms structure.
@@ -451,6 +573,34 @@ protected:
 #endif
                                        );
 
+#ifdef __OBJC__
+  //! Return function of shader library specialized by function constants for given program bits.
+  Standard_EXPORT id<MTLFunction> specializedFunction(NSString* theName,
+                                                      int theBits);
+
+  //! Create pipeline descriptor for given configuration.
+  Standard_EXPORT MTLRenderPipelineDescriptor* createPipelineDescriptor(Graphic3d_TypeOfShadingModel theModel,
+                                                                        int theBits);
+
+  //! Return depth-stencil state shared by all pipelines.
+  Standard_EXPORT id<MTLDepthStencilState> defaultDepthStencil();
+
+  //! Return already available pipeline to be used while the requested one is compiled in background:
+  //! the same shading model without optional features, or unlit program otherwise.
+  Standard_EXPORT bool fallbackProgram(Graphic3d_TypeOfShadingModel theModel,
+                                       int theBits,
+                                       __strong id<MTLRenderPipelineState>& thePipeline,
+                                       __strong id<MTLDepthStencilState>& theDepthStencil);
+#endif
+
+  //! Start asynchronous compilation of pipeline state for given configuration.
+  //! @return FALSE if pipeline descriptor cannot be created
+  Standard_EXPORT bool createPipelineAsync(Graphic3d_TypeOfShadingModel theModel,
+                                           int theBits);
+
+  //! Move pipelines compiled asynchronously into the pipeline cache.
+  Standard_EXPORT void fetchAsyncPipelines();
+
   //! Generate MSL shader source code.
   Standard_EXPORT TCollection_AsciiString generateShaderSource() const;
 
@@ -484,18 +634,79 @@ protected:
   // Shading model
   Graphic3d_TypeOfShadingModel myShadingModel;
 
+  occ::handle<Metal_PipelineCache> myPipelineArchive; //!< persistent pipeline cache
+  occ::handle<Metal_PipelineProfile> myUsageProfile;  //!< usage profile of pipelines
+
+  //! Pipelines being compiled asynchronously.
+  NCollection_Map<Metal_ShaderProgramKey, Metal_ShaderProgramKeyHasher> myPendingPipelines;
+  //! Pipelines failed asynchronous compilation (not scheduled again).
+  NCollection_Map<Metal_ShaderProgramKey, Metal_ShaderProgramKeyHasher> myFailedPipelines;
+  //! Configurations without mesh shader pipeline (not requested again).
+  NCollection_Map<Metal_ShaderProgramKey, Metal_ShaderProgramKeyHasher> myFailedMeshletPipelines;
+  //! Configurations without instanced pipeline (not requested again).
+  NCollection_Map<Metal_ShaderProgramKey, Metal_ShaderProgramKeyHasher> myFailedInstancedPipelines;
+  //! Configurations without B-spline tessellation pipeline (not requested again).
+  NCollection_Map<Metal_ShaderProgramKey, Metal_ShaderProgramKeyHasher> myFailedBSplinePipelines;
+  //! Configurations without point cloud pipeline (not requested again).
+  NCollection_Map<Metal_ShaderProgramKey, Metal_ShaderProgramKeyHasher> myFailedPointCloudPipelines;
+  //! Configurations without wide line pipeline (not requested again).
+  NCollection_Map<Metal_ShaderProgramKey, Metal_ShaderProgramKeyHasher> myFailedWideLinePipelines;
+  unsigned int myProgramsRevision; //!< counter of asynchronously compiled pipelines fetches
+  size_t       myNbPipelineHits;   //!< pipeline requests served by in-memory cache
+  size_t       myNbPipelineMisses; //!< pipeline requests missing in-memory cache
+  size_t       myNbPipelineArchiveHits; //!< missed pipelines found in persistent archive
+  std::mutex   myProgramMutex;     //!< lock of GetProgram() for parallel encoding
+
 #ifdef __OBJC__
   id<MTLLibrary> myShaderLibrary;  //!< compiled shader library
+  id<MTLLibrary> myMeshletLibrary; //!< object and mesh shaders, compiled on first use
+  id<MTLLibrary> myBSplineLibrary; //!< B-spline post-tessellation vertex function, compiled on first use
+  id<MTLLibrary> myPointCloudLibrary; //!< point cloud vertex function, compiled on first use
+  id<MTLLibrary> myWideLineLibrary;   //!< wide line functions, compiled on first use
+  NSMutableArray* myAsyncResults;  //!< results of asynchronous compilation, guarded by @synchronized
 
   //! Cache of pipeline states.
   NCollection_DataMap<Metal_ShaderProgramKey,
                       id<MTLRenderPipelineState>,
                       Metal_ShaderProgramKeyHasher> myPipelineCache;
 
+  //! Cache of mesh shader pipeline states.
+  NCollection_DataMap<Metal_ShaderProgramKey,
+                      id<MTLRenderPipelineState>,
+                      Metal_ShaderProgramKeyHasher> myMeshletPipelineCache;
+
+  //! Cache of instanced pipeline states.
+  NCollection_DataMap<Metal_ShaderProgramKey,
+                      id<MTLRenderPipelineState>,
+                      Metal_ShaderProgramKeyHasher> myInstancedPipelineCache;
+
+  //! Cache of B-spline tessellation pipeline states.
+  NCollection_DataMap<Metal_ShaderProgramKey,
+                      id<MTLRenderPipelineState>,
+                      Metal_ShaderProgramKeyHasher> myBSplinePipelineCache;
+
+  //! Cache of point cloud pipeline states.
+  NCollection_DataMap<Metal_ShaderProgramKey,
+                      id<MTLRenderPipelineState>,
+                      Metal_ShaderProgramKeyHasher> myPointCloudPipelineCache;
+
+  //! Cache of wide line pipeline states.
+  NCollection_DataMap<Metal_ShaderProgramKey,
+                      id<MTLRenderPipelineState>,
+                      Metal_ShaderProgramKeyHasher> myWideLinePipelineCache;
+
   //! Cache of depth-stencil states.
   NCollection_DataMap<int, id<MTLDepthStencilState>> myDepthStencilCache;
+
+  //! Cache of specialized functions of shader library.
+  NCollection_DataMap<TCollection_AsciiString, id<MTLFunction>> myFunctionCache;
 #else
   void* myShaderLibrary;
+  void* myMeshletLibrary;
+  void* myBSplineLibrary;
+  void* myPointCloudLibrary;
+  void* myWideLineLibrary;
+  void* myAsyncResults;
 #endif
 };
 
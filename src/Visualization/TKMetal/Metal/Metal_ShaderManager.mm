@@ -15,12 +15,2049 @@
 
 #include <Metal_ShaderManager.hxx>
 #include <Metal_Context.hxx>
+#include <Metal_MeshletBuffer.hxx>
 #include <Graphic3d_ClipPlane.hxx>
 #include <Graphic3d_CLight.hxx>
 #include <Message.hxx>
 
 IMPLEMENT_STANDARD_RTTIEXT(Metal_ShaderManager, Graphic3d_ShaderManager)
 
+namespace
+{
+  //! MSL source of standard shading model programs.
+  static const char* THE_SHADER_MANAGER_SOURCE = R"(
+#include <metal_stdlib>
+#include <simd/simd.h>
+using namespace metal;
+
+// Maximum number of lights
+#define MAX_LIGHTS 8
+#define MAX_CLIP_PLANES 8
+
+// Light types
+#define LIGHT_TYPE_DIRECTIONAL 0
+#define LIGHT_TYPE_POSITIONAL  1
+#define LIGHT_TYPE_SPOT        2
+
+// Light source structure
+struct LightSource {
+  float4 Color;      // RGB + intensity
+  float4 Position;   // XYZ + isHeadlight
+  float4 Direction;  // spot direction + range
+  float4 Parameters; // cos(cutoff), exponent, type, enabled
+};
+
+// Legacy material structure
+struct Material {
+  float4 Ambient;
+  float4 Diffuse;
+  float4 Specular;
+  float4 Emissive;
+  float Shininess;
+  float Transparency;
+  float2 padding;
+};
+
+// Common (Phong/Blinn) material - matches Metal_ShaderMaterialCommon
+struct MaterialCommon {
+  float4 Diffuse;           // RGB + alpha
+  float4 Emission;          // RGB + padding
+  float4 SpecularShininess; // RGB + shininess
+  float4 Ambient;           // RGB + padding
+};
+
+// PBR material - matches Metal_ShaderMaterialPBR
+struct MaterialPBR {
+  float4 BaseColor;    // RGB + alpha
+  float4 EmissionIOR;  // RGB + IOR
+  float4 Params;       // occlusion, roughness, metallic, padding
+};
+
+// Comprehensive material uniforms - matches Metal_MaterialUniforms
+struct MaterialUniforms {
+  MaterialCommon FrontCommon;
+  MaterialCommon BackCommon;
+  MaterialPBR FrontPBR;
+  MaterialPBR BackPBR;
+  int IsPBR;
+  int ToDistinguish;
+  float AlphaCutoff;
+  float Padding;
+};
+
+// Frame uniforms (per-frame data)
+struct FrameUniforms {
+  float4x4 ProjectionMatrix;
+  float4x4 ViewMatrix;
+  float4x4 ProjectionMatrixInverse;
+  float4x4 ViewMatrixInverse;
+};
+
+// Object uniforms (per-object data)
+struct ObjectUniforms {
+  float4x4 ModelMatrix;
+  float4x4 ModelViewMatrix;
+  float3x4 NormalMatrix;
+  float4 ObjectColor;
+};
+
+// Lighting uniforms
+// Must match Metal_LightUniforms C++ struct exactly (560 bytes total)
+struct LightUniforms {
+  LightSource Lights[MAX_LIGHTS];  // 8 * 64 = 512 bytes
+  float4 AmbientColor;              // 16 bytes (offset 512)
+  int LightCount;                   // 4 bytes (offset 528)
+  int padding0;                     // 4 bytes (offset 532)
+  int padding1;                     // 4 bytes (offset 536)
+  int padding2;                     // 4 bytes (offset 540)
+  int padding3;                     // 4 bytes (offset 544)
+  int padding4;                     // 4 bytes (offset 548)
+  int padding5;                     // 4 bytes (offset 552)
+  int padding6;                     // 4 bytes (offset 556) -> total 560
+};
+
+// Clipping uniforms
+struct ClipUniforms {
+  float4 Planes[MAX_CLIP_PLANES];
+  int PlaneCount;
+  int3 padding;
+};
+
+// Shadow uniforms
+// Must match Metal_ShadowUniforms C++ struct
+struct ShadowUniforms {
+  float4x4 ViewToShadow[4];  // view space to shadow map space of each cascade
+  float4 SplitFar;           // far view depth of each cascade
+  int LightIndex;            // shadow casting light (-1 if none)
+  int NbCascades;            // number of cascades (0 if shadows are disabled)
+  float Bias;
+  float padding;
+};
+
+// Legacy uniforms for simple shaders
+struct Uniforms {
+  float4x4 modelViewMatrix;
+  float4x4 projectionMatrix;
+  float4 color;
+};
+
+// ======== VERTEX OUTPUT STRUCTURES ========
+
+struct VertexOutUnlit {
+  float4 position [[position]];
+  float4 color;
+  float3 worldPosition;
+};
+
+struct VertexOutGouraud {
+  float4 position [[position]];
+  float4 color;
+  float3 worldPosition;
+};
+
+struct VertexOutPhong {
+  float4 position [[position]];
+  float3 normal;
+  float3 viewPosition;
+  float4 color;
+  float3 worldPosition;
+};
+
+// ======== HELPER FUNCTIONS ========
+
+// Compute Phong lighting for a single light
+// Light positions/directions are in world space, must be transformed to view space
+float3 computePhongLight(LightSource light, float3 N, float3 V, float3 fragPos,
+                         float3 diffuseColor, float3 specularColor, float shininess,
+                         float4x4 modelViewMatrix) {
+  if (light.Parameters.w < 0.5) return float3(0.0); // disabled
+  
+  int lightType = int(light.Parameters.z);
+  float3 lightColor = light.Color.rgb * light.Color.w; // color * intensity
+  float3 L;
+  float attenuation = 1.0;
+  
+  if (lightType == LIGHT_TYPE_DIRECTIONAL) {
+    // Transform light direction from world space to view space
+    float3 worldLightDir = -light.Position.xyz;
+    L = normalize((modelViewMatrix * float4(worldLightDir, 0.0)).xyz);
+  } else {
+    // Transform light position from world space to view space
+    float3 viewLightPos = (modelViewMatrix * float4(light.Position.xyz, 1.0)).xyz;
+    float3 lightVec = viewLightPos - fragPos;
+    float dist = length(lightVec);
+    L = lightVec / dist;
+    
+    // Range attenuation
+    float range = light.Direction.w;
+    if (range > 0.0) {
+      attenuation = saturate(1.0 - dist / range);
+    }
+    
+    // Spot light
+    if (lightType == LIGHT_TYPE_SPOT) {
+      // Transform spot direction to view space
+      float3 worldSpotDir = -light.Direction.xyz;
+      float3 spotDir = normalize((modelViewMatrix * float4(worldSpotDir, 0.0)).xyz);
+      float cosAngle = dot(L, spotDir);
+      float cosCutoff = light.Parameters.x;
+      if (cosAngle < cosCutoff) {
+        attenuation = 0.0;
+      } else {
+        float spotExponent = light.Parameters.y;
+        attenuation *= pow(cosAngle, spotExponent);
+      }
+    }
+  }
+  
+  // Diffuse
+  float NdotL = max(dot(N, L), 0.0);
+  float3 diffuse = diffuseColor * lightColor * NdotL;
+  
+  // Specular (Blinn-Phong)
+  float3 H = normalize(L + V);
+  float NdotH = max(dot(N, H), 0.0);
+  float3 specular = specularColor * lightColor * pow(NdotH, shininess);
+  
+  return (diffuse + specular) * attenuation;
+}
+
+// Compute visibility of the shadow casting light (1 - lit, 0 - shadowed) using 3x3 PCF
+float shadowFactor(float3 viewPos, constant ShadowUniforms& shadow,
+                   depth2d_array<float> shadowMap) {
+  if (shadow.NbCascades <= 0) return 1.0;
+  
+  // select cascade by view depth
+  float viewDepth = -viewPos.z;
+  int cascade = 0;
+  while (cascade < shadow.NbCascades - 1 && viewDepth > shadow.SplitFar[cascade]) {
+    ++cascade;
+  }
+  
+  float4 shadowPos = shadow.ViewToShadow[cascade] * float4(viewPos, 1.0);
+  float3 coord = shadowPos.xyz / shadowPos.w;
+  if (any(coord.xy < 0.0) || any(coord.xy > 1.0) || coord.z > 1.0) return 1.0;
+  
+  constexpr sampler shadowSampler(coord::normalized, filter::linear,
+                                  address::clamp_to_edge, compare_func::less_equal);
+  float2 texel = 1.0 / float2(shadowMap.get_width(), shadowMap.get_height());
+  float depth = coord.z - shadow.Bias;
+  float lit = 0.0;
+  for (int y = -1; y <= 1; y++) {
+    for (int x = -1; x <= 1; x++) {
+      lit += shadowMap.sample_compare(shadowSampler, coord.xy + float2(x, y) * texel, cascade, depth);
+    }
+  }
+  return lit / 9.0;
+}
+
+// Check if fragment should be clipped
+bool isClipped(float3 worldPos, constant ClipUniforms& clip) {
+  for (int i = 0; i < clip.PlaneCount; i++) {
+    float4 plane = clip.Planes[i];
+    float dist = dot(float4(worldPos, 1.0), plane);
+    if (dist < 0.0) return true;
+  }
+  return false;
+}
+
+// ======== FUNCTION CONSTANTS ========
+
+// Optional features of the programs, specialized by Metal_ShaderManager for each
+// Metal_ShaderProgramKey (see Metal_FunctionConstant_* indices), so that program permutations
+// are produced by specialization of the same library instead of compilation of separate functions.
+// Functions fetched without specialization get the features disabled.
+constant bool HasClipPlanesConst [[function_constant(0)]];
+constant bool HasOctNormalsConst [[function_constant(1)]];
+constant bool HAS_CLIP_PLANES = is_function_constant_defined(HasClipPlanesConst) && HasClipPlanesConst;
+constant bool HAS_OCT_NORMALS = is_function_constant_defined(HasOctNormalsConst) && HasOctNormalsConst;
+
+// Decode unit vector packed as octahedral vector of 2 normalized 16-bit integers
+// (see Graphic3d_VertexQuantizer::EncodeOctahedral())
+float3 decodeOctNormal(uint packed) {
+  float2 e = unpack_snorm2x16_to_float(packed);
+  float3 n = float3(e.x, e.y, 1.0 - abs(e.x) - abs(e.y));
+  float t = saturate(-n.z);
+  n.xy += select(float2(t), float2(-t), n.xy >= 0.0);
+  return normalize(n);
+}
+
+// Read nodal normal stored either as 3 floats or as octahedral vector (HAS_OCT_NORMALS)
+float3 readNormal(const device packed_float3* normals, uint vid) {
+  if (HAS_OCT_NORMALS) {
+    return decodeOctNormal(reinterpret_cast<const device uint*>(normals)[vid]);
+  }
+  return float3(normals[vid]);
+}
+
+// ======== UNLIT SHADERS ========
+
+vertex VertexOutUnlit vertex_unlit(
+  const device packed_float3* positions [[buffer(0)]],
+  constant Uniforms& uniforms    [[buffer(1)]],
+  uint vid                       [[vertex_id]])
+{
+  VertexOutUnlit out;
+  float3 pos = float3(positions[vid]);
+  float4 worldPos = float4(pos, 1.0);
+  float4 viewPos = uniforms.modelViewMatrix * worldPos;
+  out.position = uniforms.projectionMatrix * viewPos;
+  out.worldPosition = worldPos.xyz;
+  out.color = uniforms.color;
+  return out;
+}
+
+fragment float4 fragment_unlit(
+  VertexOutUnlit in [[stage_in]],
+  constant ClipUniforms& clip [[buffer(1), function_constant(HAS_CLIP_PLANES)]])
+{
+  if (HAS_CLIP_PLANES && isClipped(in.worldPosition, clip)) discard_fragment();
+
+  return in.color;
+}
+
+// ======== GOURAUD SHADERS ========
+
+vertex VertexOutGouraud vertex_gouraud(
+  const device packed_float3* positions [[buffer(0)]],
+  const device packed_float3* normals   [[buffer(2)]],
+  constant Uniforms& uniforms    [[buffer(1)]],
+  constant LightUniforms& lights [[buffer(3)]],
+  uint vid                       [[vertex_id]])
+{
+  VertexOutGouraud out;
+  float3 pos = float3(positions[vid]);
+  float3 norm = readNormal(normals, vid);
+  float4 worldPos = float4(pos, 1.0);
+  float4 viewPos = uniforms.modelViewMatrix * worldPos;
+  out.position = uniforms.projectionMatrix * viewPos;
+  out.worldPosition = worldPos.xyz;
+  
+  // Transform normal (simplified - should use inverse transpose)
+  float3 N = normalize((uniforms.modelViewMatrix * float4(norm, 0.0)).xyz);
+  float3 V = normalize(-viewPos.xyz);
+  
+  // Compute lighting at vertex
+  float3 result = lights.AmbientColor.rgb * uniforms.color.rgb;
+  for (int i = 0; i < lights.LightCount; i++) {
+    result += computePhongLight(lights.Lights[i], N, V, viewPos.xyz,
+                                uniforms.color.rgb, float3(1.0), 32.0,
+                                uniforms.modelViewMatrix);
+  }
+  out.color = float4(result, uniforms.color.a);
+  return out;
+}
+
+fragment float4 fragment_gouraud(
+  VertexOutGouraud in [[stage_in]],
+  constant ClipUniforms& clip [[buffer(1), function_constant(HAS_CLIP_PLANES)]])
+{
+  if (HAS_CLIP_PLANES && isClipped(in.worldPosition, clip)) discard_fragment();
+
+  return in.color;
+}
+
+// ======== PHONG SHADERS ========
+
+vertex VertexOutPhong vertex_phong(
+  const device packed_float3* positions [[buffer(0)]],
+  const device packed_float3* normals   [[buffer(2)]],
+  constant Uniforms& uniforms    [[buffer(1)]],
+  uint vid                       [[vertex_id]])
+{
+  VertexOutPhong out;
+  float3 pos = float3(positions[vid]);
+  float3 norm = readNormal(normals, vid);
+  float4 worldPos = float4(pos, 1.0);
+  float4 viewPos = uniforms.modelViewMatrix * worldPos;
+  out.position = uniforms.projectionMatrix * viewPos;
+  out.worldPosition = worldPos.xyz;
+  out.viewPosition = viewPos.xyz;
+  
+  // Transform normal
+  out.normal = normalize((uniforms.modelViewMatrix * float4(norm, 0.0)).xyz);
+  out.color = uniforms.color;
+  return out;
+}
+
+fragment float4 fragment_phong(
+  VertexOutPhong in [[stage_in]],
+  constant Uniforms& uniforms    [[buffer(0)]],
+  constant LightUniforms& lights [[buffer(1)]],
+  constant ClipUniforms& clip    [[buffer(2), function_constant(HAS_CLIP_PLANES)]])
+{
+  if (HAS_CLIP_PLANES && isClipped(in.worldPosition, clip)) discard_fragment();
+
+  float3 N = normalize(in.normal);
+  float3 V = normalize(-in.viewPosition);
+  
+  // Start with ambient
+  float3 result = lights.AmbientColor.rgb * in.color.rgb;
+  
+  // Add contribution from each light
+  for (int i = 0; i < lights.LightCount; i++) {
+    result += computePhongLight(lights.Lights[i], N, V, in.viewPosition,
+                                in.color.rgb, float3(1.0), 32.0,
+                                uniforms.modelViewMatrix);
+  }
+  
+  return float4(saturate(result), in.color.a);
+}
+
+// ======== PHONG FACET SHADERS (no vertex normals required) ========
+
+// Output structure for facet shaders (no normal interpolation)
+struct VertexOutFacet {
+  float4 position [[position]];
+  float3 viewPosition;
+  float4 color;
+  float3 worldPosition;
+};
+
+// Facet vertex shader - no normals input
+vertex VertexOutFacet vertex_phong_facet(
+  const device packed_float3* positions [[buffer(0)]],
+  constant Uniforms& uniforms    [[buffer(1)]],
+  uint vid                       [[vertex_id]])
+{
+  VertexOutFacet out;
+  float3 pos = float3(positions[vid]);
+  float4 worldPos = float4(pos, 1.0);
+  float4 viewPos = uniforms.modelViewMatrix * worldPos;
+  out.position = uniforms.projectionMatrix * viewPos;
+  out.worldPosition = worldPos.xyz;
+  out.viewPosition = viewPos.xyz;
+  out.color = uniforms.color;
+  return out;
+}
+
+// ======== INSTANCED VERTEX SHADERS ========
+
+// Should match Metal_InstanceData
+struct InstanceData {
+  float4x4 modelViewMatrix;
+  float4 color;
+};
+
+// Instanced variant of vertex_unlit taking model-view matrix and color from instance data
+vertex VertexOutUnlit vertex_unlit_instanced(
+  const device packed_float3* positions [[buffer(0)]],
+  constant Uniforms& uniforms           [[buffer(1)]],
+  const device InstanceData* instances  [[buffer(10)]],
+  uint vid                              [[vertex_id]],
+  uint iid                              [[instance_id]])
+{
+  VertexOutUnlit out;
+  const InstanceData inst = instances[iid];
+  float4 worldPos = float4(float3(positions[vid]), 1.0);
+  out.position = uniforms.projectionMatrix * (inst.modelViewMatrix * worldPos);
+  out.worldPosition = worldPos.xyz;
+  out.color = inst.color;
+  return out;
+}
+
+// Instanced variant of vertex_phong
+vertex VertexOutPhong vertex_phong_instanced(
+  const device packed_float3* positions [[buffer(0)]],
+  const device packed_float3* normals   [[buffer(2)]],
+  constant Uniforms& uniforms           [[buffer(1)]],
+  const device InstanceData* instances  [[buffer(10)]],
+  uint vid                              [[vertex_id]],
+  uint iid                              [[instance_id]])
+{
+  VertexOutPhong out;
+  const InstanceData inst = instances[iid];
+  float4 worldPos = float4(float3(positions[vid]), 1.0);
+  float4 viewPos = inst.modelViewMatrix * worldPos;
+  out.position = uniforms.projectionMatrix * viewPos;
+  out.worldPosition = worldPos.xyz;
+  out.viewPosition = viewPos.xyz;
+  out.normal = normalize((inst.modelViewMatrix * float4(float3(normals[vid]), 0.0)).xyz);
+  out.color = inst.color;
+  return out;
+}
+
+// Instanced variant of vertex_phong_facet
+vertex VertexOutFacet vertex_phong_facet_instanced(
+  const device packed_float3* positions [[buffer(0)]],
+  constant Uniforms& uniforms           [[buffer(1)]],
+  const device InstanceData* instances  [[buffer(10)]],
+  uint vid                              [[vertex_id]],
+  uint iid                              [[instance_id]])
+{
+  VertexOutFacet out;
+  const InstanceData inst = instances[iid];
+  float4 worldPos = float4(float3(positions[vid]), 1.0);
+  float4 viewPos = inst.modelViewMatrix * worldPos;
+  out.position = uniforms.projectionMatrix * viewPos;
+  out.worldPosition = worldPos.xyz;
+  out.viewPosition = viewPos.xyz;
+  out.color = inst.color;
+  return out;
+}
+
+// Facet fragment shader - computes normals from screen-space derivatives
+fragment float4 fragment_phong_facet(
+  VertexOutFacet in [[stage_in]],
+  constant Uniforms& uniforms    [[buffer(0)]],
+  constant LightUniforms& lights [[buffer(1)]],
+  constant ClipUniforms& clip    [[buffer(2), function_constant(HAS_CLIP_PLANES)]])
+{
+  if (HAS_CLIP_PLANES && isClipped(in.worldPosition, clip)) discard_fragment();
+
+  // Compute face normal from screen-space derivatives
+  float3 dPdx = dfdx(in.viewPosition);
+  float3 dPdy = dfdy(in.viewPosition);
+  float3 N = normalize(cross(dPdx, dPdy));
+  float3 V = normalize(-in.viewPosition);
+  
+  // Ensure normal points toward viewer
+  if (dot(N, V) < 0.0) N = -N;
+  
+  float3 result = lights.AmbientColor.rgb * in.color.rgb;
+  for (int i = 0; i < lights.LightCount; i++) {
+    result += computePhongLight(lights.Lights[i], N, V, in.viewPosition,
+                                in.color.rgb, float3(1.0), 32.0,
+                                uniforms.modelViewMatrix);
+  }
+  
+  return float4(saturate(result), in.color.a);
+}
+
+// Facet fragment shader with full material support
+fragment float4 fragment_phong_facet_material(
+  VertexOutFacet in [[stage_in]],
+  constant Uniforms& uniforms         [[buffer(0)]],
+  constant LightUniforms& lights      [[buffer(1)]],
+  constant MaterialUniforms& material [[buffer(2)]],
+  constant ClipUniforms& clip         [[buffer(3), function_constant(HAS_CLIP_PLANES)]],
+  constant ShadowUniforms& shadow     [[buffer(5)]],
+  depth2d_array<float> shadowMap      [[texture(7)]],
+  bool isFrontFace [[front_facing]])
+{
+  if (HAS_CLIP_PLANES && isClipped(in.worldPosition, clip)) discard_fragment();
+
+  MaterialCommon mat = (isFrontFace || material.ToDistinguish == 0)
+                       ? material.FrontCommon : material.BackCommon;
+  
+  float3 dPdx = dfdx(in.viewPosition);
+  float3 dPdy = dfdy(in.viewPosition);
+  float3 N = normalize(cross(dPdx, dPdy));
+  float3 V = normalize(-in.viewPosition);
+  
+  if (!isFrontFace) N = -N;
+  
+  float3 diffuseColor = mat.Diffuse.rgb;
+  float3 specularColor = mat.SpecularShininess.rgb;
+  float shininess = mat.SpecularShininess.a;
+  float3 ambientColor = mat.Ambient.rgb;
+  float3 emissionColor = mat.Emission.rgb;
+  float alpha = mat.Diffuse.a;
+  
+  if (material.AlphaCutoff <= 1.0 && alpha < material.AlphaCutoff) {
+    discard_fragment();
+  }
+  
+  float3 result = ambientColor * lights.AmbientColor.rgb + emissionColor;
+  
+  for (int i = 0; i < lights.LightCount; i++) {
+    float visibility = (i == shadow.LightIndex) ? shadowFactor(in.viewPosition, shadow, shadowMap) : 1.0;
+    result += visibility * computePhongLight(lights.Lights[i], N, V, in.viewPosition,
+                                             diffuseColor, specularColor, shininess,
+                                             uniforms.modelViewMatrix);
+  }
+  
+  return float4(saturate(result), alpha);
+}
+
+// ======== MATERIAL-AWARE PHONG SHADERS ========
+
+// Phong fragment shader with full material support
+fragment float4 fragment_phong_material(
+  VertexOutPhong in [[stage_in]],
+  constant Uniforms& uniforms         [[buffer(0)]],
+  constant LightUniforms& lights      [[buffer(1)]],
+  constant MaterialUniforms& material [[buffer(2)]],
+  constant ClipUniforms& clip         [[buffer(3), function_constant(HAS_CLIP_PLANES)]],
+  constant ShadowUniforms& shadow     [[buffer(5)]],
+  depth2d_array<float> shadowMap      [[texture(7)]],
+  bool isFrontFace [[front_facing]])
+{
+  if (HAS_CLIP_PLANES && isClipped(in.worldPosition, clip)) discard_fragment();
+
+  // Select material based on face orientation
+  MaterialCommon mat = (isFrontFace || material.ToDistinguish == 0)
+                       ? material.FrontCommon : material.BackCommon;
+  
+  float3 N = normalize(in.normal);
+  float3 V = normalize(-in.viewPosition);
+  
+  // Flip normal for back faces
+  if (!isFrontFace) N = -N;
+  
+  // Extract material properties
+  float3 diffuseColor = mat.Diffuse.rgb;
+  float3 specularColor = mat.SpecularShininess.rgb;
+  float shininess = mat.SpecularShininess.a;
+  float3 ambientColor = mat.Ambient.rgb;
+  float3 emissionColor = mat.Emission.rgb;
+  float alpha = mat.Diffuse.a;
+  
+  // Alpha test
+  if (material.AlphaCutoff <= 1.0 && alpha < material.AlphaCutoff) {
+    discard_fragment();
+  }
+  
+  // Ambient term
+  float3 result = ambientColor * lights.AmbientColor.rgb;
+  
+  // Add emission
+  result += emissionColor;
+  
+  // Add contribution from each light
+  for (int i = 0; i < lights.LightCount; i++) {
+    float visibility = (i == shadow.LightIndex) ? shadowFactor(in.viewPosition, shadow, shadowMap) : 1.0;
+    result += visibility * computePhongLight(lights.Lights[i], N, V, in.viewPosition,
+                                             diffuseColor, specularColor, shininess,
+                                             uniforms.modelViewMatrix);
+  }
+  
+  return float4(saturate(result), alpha);
+}
+
+// ======== PBR HELPER FUNCTIONS ========
+
+// Normal Distribution Function (GGX/Trowbridge-Reitz)
+float distributionGGX(float3 N, float3 H, float roughness) {
+  float a = roughness * roughness;
+  float a2 = a * a;
+  float NdotH = max(dot(N, H), 0.0);
+  float NdotH2 = NdotH * NdotH;
+  float nom = a2;
+  float denom = (NdotH2 * (a2 - 1.0) + 1.0);
+  denom = M_PI_F * denom * denom;
+  return nom / max(denom, 0.0001);
+}
+
+// Geometry function (Schlick-GGX)
+float geometrySchlickGGX(float NdotV, float roughness) {
+  float r = roughness + 1.0;
+  float k = (r * r) / 8.0;
+  return NdotV / (NdotV * (1.0 - k) + k);
+}
+
+float geometrySmith(float3 N, float3 V, float3 L, float roughness) {
+  float NdotV = max(dot(N, V), 0.0);
+  float NdotL = max(dot(N, L), 0.0);
+  return geometrySchlickGGX(NdotV, roughness) * geometrySchlickGGX(NdotL, roughness);
+}
+
+// Fresnel-Schlick approximation
+float3 fresnelSchlick(float cosTheta, float3 F0) {
+  return F0 + (1.0 - F0) * pow(saturate(1.0 - cosTheta), 5.0);
+}
+
+// ======== PBR FRAGMENT SHADER ========
+
+fragment float4 fragment_pbr(
+  VertexOutPhong in [[stage_in]],
+  constant Uniforms& uniforms         [[buffer(0)]],
+  constant LightUniforms& lights      [[buffer(1)]],
+  constant MaterialUniforms& material [[buffer(2)]],
+  constant ClipUniforms& clip         [[buffer(3), function_constant(HAS_CLIP_PLANES)]],
+  bool isFrontFace [[front_facing]])
+{
+  if (HAS_CLIP_PLANES && isClipped(in.worldPosition, clip)) discard_fragment();
+
+  // Select PBR material based on face
+  MaterialPBR mat = (isFrontFace || material.ToDistinguish == 0)
+                    ? material.FrontPBR : material.BackPBR;
+  
+  float3 albedo = mat.BaseColor.rgb;
+  float alpha = mat.BaseColor.a;
+  float metallic = mat.Params.b;    // z component
+  float roughness = mat.Params.g;   // y component
+  float ao = mat.Params.r;          // x component (occlusion)
+  float3 emission = mat.EmissionIOR.rgb;
+  
+  // Alpha test
+  if (material.AlphaCutoff <= 1.0 && alpha < material.AlphaCutoff) {
+    discard_fragment();
+  }
+  
+  float3 N = normalize(in.normal);
+  float3 V = normalize(-in.viewPosition);
+  
+  if (!isFrontFace) N = -N;
+  
+  // Calculate F0 (reflectance at normal incidence)
+  float3 F0 = mix(float3(0.04), albedo, metallic);
+  
+  float3 Lo = float3(0.0);
+  
+  // Accumulate light contributions
+  for (int i = 0; i < lights.LightCount; i++) {
+    LightSource light = lights.Lights[i];
+    if (light.Parameters.w < 0.5) continue; // disabled
+    
+    int lightType = int(light.Parameters.z);
+    float3 lightColor = light.Color.rgb * light.Color.w;
+    float3 L;
+    float attenuation = 1.0;
+    
+    if (lightType == LIGHT_TYPE_DIRECTIONAL) {
+      // Transform light direction from world space to view space
+      float3 worldLightDir = -light.Position.xyz;
+      L = normalize((uniforms.modelViewMatrix * float4(worldLightDir, 0.0)).xyz);
+    } else {
+      // Transform light position from world space to view space
+      float3 viewLightPos = (uniforms.modelViewMatrix * float4(light.Position.xyz, 1.0)).xyz;
+      float3 lightVec = viewLightPos - in.viewPosition;
+      float dist = length(lightVec);
+      L = lightVec / dist;
+      float range = light.Direction.w;
+      if (range > 0.0) {
+        attenuation = saturate(1.0 - dist / range);
+        attenuation *= attenuation; // quadratic falloff
+      }
+      if (lightType == LIGHT_TYPE_SPOT) {
+        // Transform spot direction to view space
+        float3 worldSpotDir = -light.Direction.xyz;
+        float3 spotDir = normalize((uniforms.modelViewMatrix * float4(worldSpotDir, 0.0)).xyz);
+        float cosAngle = dot(L, spotDir);
+        float cosCutoff = light.Parameters.x;
+        if (cosAngle < cosCutoff) {
+          attenuation = 0.0;
+        } else {
+          float spotExponent = light.Parameters.y;
+          attenuation *= pow(cosAngle, spotExponent);
+        }
+      }
+    }
+    
+    float3 H = normalize(V + L);
+    float3 radiance = lightColor * attenuation;
+    
+    // Cook-Torrance BRDF
+    float NDF = distributionGGX(N, H, roughness);
+    float G = geometrySmith(N, V, L, roughness);
+    float3 F = fresnelSchlick(max(dot(H, V), 0.0), F0);
+    
+    float3 numerator = NDF * G * F;
+    float denominator = 4.0 * max(dot(N, V), 0.0) * max(dot(N, L), 0.0) + 0.0001;
+    float3 specular = numerator / denominator;
+    
+    // Energy conservation
+    float3 kS = F;
+    float3 kD = (float3(1.0) - kS) * (1.0 - metallic);
+    
+    float NdotL = max(dot(N, L), 0.0);
+    
+    // For metals: add shading term that provides NdotL-based coloring
+    // This simulates how metals reflect environment tinted by their color
+    float3 metallicShading = albedo * metallic * 0.5;
+    
+    Lo += (kD * albedo / M_PI_F + metallicShading + specular) * radiance * NdotL;
+  }
+  
+  // Ambient lighting with proper metallic handling
+  // For dielectrics: use albedo. For metals: use F0 (tinted by metal color)
+  float3 F0_ambient = mix(float3(0.04), albedo, metallic);
+  float NdotV_ambient = max(dot(N, V), 0.001);
+  float3 F_ambient = F0_ambient + (float3(1.0) - F0_ambient) * pow(1.0 - NdotV_ambient, 5.0);
+  float3 kD_ambient = (float3(1.0) - F_ambient) * (1.0 - metallic);
+  float3 diffuseAmbient = kD_ambient * albedo * lights.AmbientColor.rgb;
+  float3 metallicAmbient = F0_ambient * lights.AmbientColor.rgb * 0.3 * metallic;
+  float3 ambient = (diffuseAmbient + metallicAmbient) * ao;
+  
+  float3 color = ambient + Lo + emission;
+  
+  return float4(color, alpha);
+}
+
+// ======== LEGACY SHADERS (for backwards compatibility) ========
+
+struct VertexOut {
+  float4 position [[position]];
+  float3 normal;
+  float3 viewPosition;
+};
+
+vertex VertexOut vertex_basic(
+  const device packed_float3* positions [[buffer(0)]],
+  constant Uniforms& uniforms           [[buffer(1)]],
+  uint vid                              [[vertex_id]])
+{
+  VertexOut out;
+  float3 pos = float3(positions[vid]);
+  float4 worldPos = float4(pos, 1.0);
+  float4 viewPos = uniforms.modelViewMatrix * worldPos;
+  out.position = uniforms.projectionMatrix * viewPos;
+  out.viewPosition = viewPos.xyz;
+  out.normal = float3(0.0, 0.0, 1.0);
+  return out;
+}
+
+fragment float4 fragment_solid_color(
+  VertexOut in                [[stage_in]],
+  constant Uniforms& uniforms [[buffer(0)]])
+{
+  return uniforms.color;
+}
+
+fragment float4 fragment_phong_simple(
+  VertexOut in                [[stage_in]],
+  constant Uniforms& uniforms [[buffer(0)]])
+{
+  float3 lightDir = normalize(float3(0.0, 0.0, 1.0));
+  float3 N = normalize(in.normal);
+  float NdotL = max(dot(N, lightDir), 0.0);
+  float ambient = 0.3;
+  float lighting = ambient + (1.0 - ambient) * NdotL;
+  float4 color = uniforms.color;
+  color.rgb *= lighting;
+  return color;
+}
+
+// ======== GEOMETRY EMULATION (WIREFRAME/MESH EDGES) ========
+
+// Wireframe parameters uniform structure
+struct WireframeUniforms {
+  float4 WireColor;     // wireframe color
+  float4 FillColor;     // solid fill color
+  float LineWidth;      // line width in pixels
+  float Feather;        // edge feather for anti-aliasing
+  float2 Viewport;      // viewport size
+};
+
+// Persistent mesh edges vertex (output from compute, input to render) - matches Metal_GeometryEmulator::VertexSize()
+struct MeshEdgeVertex {
+  packed_float3 position;
+  packed_float3 normal;
+  packed_float3 barycentric;  // barycentric coordinates of triangle corner
+};
+
+// Parameters of compute_edge_barycentrics - matches Metal_MeshEdgesParams
+struct MeshEdgesParams {
+  uint NbTriangles;
+  uint IndexMode;  // 0 - no indices, 1 - 16-bit, 2 - 32-bit
+  uint HasNormals;
+  uint padding;
+};
+
+// Rasterized mesh edges vertex
+struct EdgeVertexOut {
+  float4 position [[position]];
+  float3 normal;
+  float3 edgeDistance;  // barycentric coordinates, converted to pixel distances to each edge by fragment shader
+  float3 viewPosition;
+  float4 color;
+};
+
+// Compute shader: unroll triangles into vertices with barycentric coordinates of their corners.
+// Does not depend on camera or viewport, so that it is executed once per geometry.
+// Each thread processes one triangle
+kernel void compute_edge_barycentrics(
+  const device packed_float3* positions [[buffer(0)]],
+  const device packed_float3* normals   [[buffer(1)]],
+  const device uchar* indices           [[buffer(2)]],
+  device MeshEdgeVertex* output         [[buffer(3)]],
+  constant MeshEdgesParams& params      [[buffer(4)]],
+  uint triangleId                       [[thread_position_in_grid]])
+{
+  if (triangleId >= params.NbTriangles) {
+    return;
+  }
+
+  const uint baseIdx = triangleId * 3;
+  for (uint corner = 0; corner < 3; ++corner) {
+    uint vid = baseIdx + corner;
+    if (params.IndexMode == 1) {
+      vid = ((const device ushort*)indices)[baseIdx + corner];
+    } else if (params.IndexMode == 2) {
+      vid = ((const device uint*)indices)[baseIdx + corner];
+    }
+
+    float3 bary = float3(0.0);
+    bary[corner] = 1.0;
+    output[baseIdx + corner].position = positions[vid];
+    output[baseIdx + corner].normal = params.HasNormals != 0 ? normals[vid] : packed_float3(0.0, 0.0, 1.0);
+    output[baseIdx + corner].barycentric = packed_float3(bary);
+  }
+}
+
+// Vertex shader for wireframe (persistent vertices from compute)
+vertex EdgeVertexOut vertex_wireframe(
+  const device MeshEdgeVertex* vertices [[buffer(0)]],
+  constant Uniforms& uniforms           [[buffer(1)]],
+  uint vid                              [[vertex_id]])
+{
+  const MeshEdgeVertex v = vertices[vid];
+  const float4 viewPos = uniforms.modelViewMatrix * float4(float3(v.position), 1.0);
+
+  EdgeVertexOut out;
+  out.position = uniforms.projectionMatrix * viewPos;
+  out.normal = normalize((uniforms.modelViewMatrix * float4(float3(v.normal), 0.0)).xyz);
+  out.edgeDistance = float3(v.barycentric);
+  out.viewPosition = viewPos.xyz;
+  out.color = uniforms.color;
+  return out;
+}
+
+// Return distance in pixels to the nearest triangle edge from interpolated barycentric coordinates
+static float edgePixelDistance(float3 barycentric)
+{
+  const float3 dist = barycentric / max(fwidth(barycentric), float3(1.0e-6));
+  return min(dist.x, min(dist.y, dist.z));
+}
+
+// Fragment shader: Wireframe overlay on solid shading
+fragment float4 fragment_wireframe_overlay(
+  EdgeVertexOut in [[stage_in]],
+  constant Uniforms& uniforms        [[buffer(0)]],
+  constant WireframeUniforms& wire   [[buffer(1)]],
+  constant LightUniforms& lights     [[buffer(2)]])
+{
+  // Calculate minimum distance to any edge
+  float dist = edgePixelDistance(in.edgeDistance);
+  
+  // Anti-aliased edge factor
+  float edgeFactor = 1.0 - smoothstep(
+    wire.LineWidth - wire.Feather,
+    wire.LineWidth + wire.Feather,
+    dist);
+  
+  // Compute Phong lighting for solid fill
+  float3 N = normalize(in.normal);
+  float3 V = normalize(-in.viewPosition);
+  
+  float3 result = lights.AmbientColor.rgb * wire.FillColor.rgb;
+  for (int i = 0; i < lights.LightCount; i++) {
+    result += computePhongLight(lights.Lights[i], N, V, in.viewPosition,
+                                wire.FillColor.rgb, float3(1.0), 32.0,
+                                uniforms.modelViewMatrix);
+  }
+  
+  // Blend wireframe over solid
+  float3 finalColor = mix(saturate(result), wire.WireColor.rgb, edgeFactor);
+  return float4(finalColor, in.color.a);
+}
+
+// Fragment shader: Wireframe only (transparent background)
+fragment float4 fragment_wireframe_only(
+  EdgeVertexOut in [[stage_in]],
+  constant WireframeUniforms& wire [[buffer(0)]])
+{
+  float dist = edgePixelDistance(in.edgeDistance);
+  
+  float edgeFactor = 1.0 - smoothstep(
+    wire.LineWidth - wire.Feather,
+    wire.LineWidth + wire.Feather,
+    dist);
+  
+  if (edgeFactor < 0.01) {
+    discard_fragment();
+  }
+  
+  // Depth-based fade for back edges
+  float3 normal = normalize(in.normal);
+  float3 viewDir = normalize(-in.viewPosition);
+  float facing = abs(dot(normal, viewDir));
+  float depthFade = mix(0.3, 1.0, facing);
+  
+  return float4(wire.WireColor.rgb * depthFade, edgeFactor);
+}
+
+// Fragment shader: Hidden-line removal style
+fragment float4 fragment_wireframe_hidden(
+  EdgeVertexOut in [[stage_in]],
+  constant WireframeUniforms& wire [[buffer(0)]])
+{
+  float dist = edgePixelDistance(in.edgeDistance);
+  
+  float edgeFactor = 1.0 - smoothstep(
+    wire.LineWidth - wire.Feather,
+    wire.LineWidth + wire.Feather,
+    dist);
+  
+  // Check if front-facing
+  float3 normal = normalize(in.normal);
+  float3 viewDir = normalize(-in.viewPosition);
+  float facing = dot(normal, viewDir);
+  
+  if (facing < 0.0) {
+    // Back face - show fill color only
+    return float4(wire.FillColor.rgb * 0.95, 1.0);
+  }
+  
+  // Front face - show wireframe
+  float3 finalColor = mix(wire.FillColor.rgb, wire.WireColor.rgb, edgeFactor);
+  return float4(finalColor, 1.0);
+}
+
+// ======== TESSELLATION SHADERS ========
+
+// Tessellation uniforms
+struct TessUniforms {
+  float4x4 ModelViewProjection;
+  float4x4 ModelView;
+  float2 Viewport;
+  float TessLevel;        // base tessellation level
+  float AdaptiveFactor;   // 0 = uniform, 1 = fully adaptive
+  float3 CameraPos;
+  float padding;
+};
+
+// Control point for quad tessellation
+struct TessControlPoint {
+  float3 position [[attribute(0)]];
+  float3 normal   [[attribute(1)]];
+  float2 texCoord [[attribute(2)]];
+};
+
+// Tessellation factors for quad patches
+struct QuadTessFactors {
+  half edgeTessellationFactor[4];
+  half insideTessellationFactor[2];
+};
+
+// Post-tessellation vertex output
+struct TessVertexOut {
+  float4 position [[position]];
+  float3 normal;
+  float2 texCoord;
+  float3 viewPosition;
+};
+
+// Compute shader: Calculate adaptive tessellation factors per patch
+kernel void compute_tess_factors(
+  device const TessControlPoint* controlPoints [[buffer(0)]],
+  device QuadTessFactors* tessFactors          [[buffer(1)]],
+  constant TessUniforms& uniforms              [[buffer(2)]],
+  uint patchId                                 [[thread_position_in_grid]])
+{
+  // Load 4 control points for this quad patch
+  uint baseIdx = patchId * 4;
+  float3 p0 = controlPoints[baseIdx + 0].position;
+  float3 p1 = controlPoints[baseIdx + 1].position;
+  float3 p2 = controlPoints[baseIdx + 2].position;
+  float3 p3 = controlPoints[baseIdx + 3].position;
+  
+  // Transform to clip space
+  float4 clip0 = uniforms.ModelViewProjection * float4(p0, 1.0);
+  float4 clip1 = uniforms.ModelViewProjection * float4(p1, 1.0);
+  float4 clip2 = uniforms.ModelViewProjection * float4(p2, 1.0);
+  float4 clip3 = uniforms.ModelViewProjection * float4(p3, 1.0);
+  
+  // Perspective divide to NDC
+  float3 ndc0 = clip0.xyz / clip0.w;
+  float3 ndc1 = clip1.xyz / clip1.w;
+  float3 ndc2 = clip2.xyz / clip2.w;
+  float3 ndc3 = clip3.xyz / clip3.w;
+  
+  // Convert to screen space
+  float2 screen0 = (ndc0.xy * 0.5 + 0.5) * uniforms.Viewport;
+  float2 screen1 = (ndc1.xy * 0.5 + 0.5) * uniforms.Viewport;
+  float2 screen2 = (ndc2.xy * 0.5 + 0.5) * uniforms.Viewport;
+  float2 screen3 = (ndc3.xy * 0.5 + 0.5) * uniforms.Viewport;
+  
+  // Calculate screen-space edge lengths (quad edges: 0-1, 1-2, 2-3, 3-0)
+  float edge01 = length(screen1 - screen0);
+  float edge12 = length(screen2 - screen1);
+  float edge23 = length(screen3 - screen2);
+  float edge30 = length(screen0 - screen3);
+  
+  // Adaptive factors based on screen-space edge length
+  float targetPixelsPerSegment = 10.0;
+  float baseTess = uniforms.TessLevel;
+  
+  float adaptive01 = edge01 / targetPixelsPerSegment;
+  float adaptive12 = edge12 / targetPixelsPerSegment;
+  float adaptive23 = edge23 / targetPixelsPerSegment;
+  float adaptive30 = edge30 / targetPixelsPerSegment;
+  
+  // Blend between uniform and adaptive
+  float factor0 = mix(baseTess, adaptive01, uniforms.AdaptiveFactor);
+  float factor1 = mix(baseTess, adaptive12, uniforms.AdaptiveFactor);
+  float factor2 = mix(baseTess, adaptive23, uniforms.AdaptiveFactor);
+  float factor3 = mix(baseTess, adaptive30, uniforms.AdaptiveFactor);
+  
+  // Clamp to valid range [1, 64]
+  factor0 = clamp(factor0, 1.0, 64.0);
+  factor1 = clamp(factor1, 1.0, 64.0);
+  factor2 = clamp(factor2, 1.0, 64.0);
+  factor3 = clamp(factor3, 1.0, 64.0);
+  
+  // Set edge tessellation factors
+  tessFactors[patchId].edgeTessellationFactor[0] = half(factor0);
+  tessFactors[patchId].edgeTessellationFactor[1] = half(factor1);
+  tessFactors[patchId].edgeTessellationFactor[2] = half(factor2);
+  tessFactors[patchId].edgeTessellationFactor[3] = half(factor3);
+  
+  // Inside factors: average of opposing edges
+  float inside0 = (factor0 + factor2) * 0.5;
+  float inside1 = (factor1 + factor3) * 0.5;
+  tessFactors[patchId].insideTessellationFactor[0] = half(inside0);
+  tessFactors[patchId].insideTessellationFactor[1] = half(inside1);
+}
+
+// Post-tessellation vertex function for quad patches
+[[patch(quad, 4)]]
+vertex TessVertexOut vertex_post_tess(
+  patch_control_point<TessControlPoint> controlPoints [[stage_in]],
+  float2 patchCoord                                   [[position_in_patch]],
+  constant TessUniforms& uniforms                     [[buffer(1)]])
+{
+  float u = patchCoord.x;
+  float v = patchCoord.y;
+  
+  // Bilinear interpolation of control points
+  // Patch layout: 3---2
+  //               |   |
+  //               0---1
+  
+  float3 p0 = controlPoints[0].position;
+  float3 p1 = controlPoints[1].position;
+  float3 p2 = controlPoints[2].position;
+  float3 p3 = controlPoints[3].position;
+  
+  float3 n0 = controlPoints[0].normal;
+  float3 n1 = controlPoints[1].normal;
+  float3 n2 = controlPoints[2].normal;
+  float3 n3 = controlPoints[3].normal;
+  
+  float2 t0 = controlPoints[0].texCoord;
+  float2 t1 = controlPoints[1].texCoord;
+  float2 t2 = controlPoints[2].texCoord;
+  float2 t3 = controlPoints[3].texCoord;
+  
+  // Bilinear interpolation
+  float3 bottom = mix(p0, p1, u);
+  float3 top = mix(p3, p2, u);
+  float3 position = mix(bottom, top, v);
+  
+  float3 bottomN = mix(n0, n1, u);
+  float3 topN = mix(n3, n2, u);
+  float3 normal = normalize(mix(bottomN, topN, v));
+  
+  float2 bottomT = mix(t0, t1, u);
+  float2 topT = mix(t3, t2, u);
+  float2 texCoord = mix(bottomT, topT, v);
+  
+  TessVertexOut out;
+  out.position = uniforms.ModelViewProjection * float4(position, 1.0);
+  out.normal = (uniforms.ModelView * float4(normal, 0.0)).xyz;
+  out.texCoord = texCoord;
+  out.viewPosition = (uniforms.ModelView * float4(position, 1.0)).xyz;
+  
+  return out;
+}
+
+// Fragment shader for tessellated geometry
+fragment float4 fragment_tess_phong(
+  TessVertexOut in [[stage_in]],
+  constant Uniforms& uniforms    [[buffer(0)]],
+  constant LightUniforms& lights [[buffer(1)]])
+{
+  float3 N = normalize(in.normal);
+  float3 V = normalize(-in.viewPosition);
+  
+  // Two-sided lighting
+  if (dot(N, V) < 0.0) N = -N;
+  
+  float3 result = lights.AmbientColor.rgb * uniforms.color.rgb;
+  for (int i = 0; i < lights.LightCount; i++) {
+    result += computePhongLight(lights.Lights[i], N, V, in.viewPosition,
+                                uniforms.color.rgb, float3(1.0), 32.0,
+                                uniforms.modelViewMatrix);
+  }
+  
+  return float4(saturate(result), uniforms.color.a);
+}
+
+// ======== LINE STIPPLE SHADERS ========
+
+// Line stipple uniforms structure
+struct LineUniforms {
+  float    lineWidth;      // line width in pixels
+  float    feather;        // edge feather for anti-aliasing
+  uint     pattern;        // 16-bit stipple pattern
+  uint     factor;         // stipple factor (stretch multiplier)
+  float2   viewport;       // viewport size
+  float2   padding;
+};
+
+// Vertex output for stippled lines
+struct VertexOutLine {
+  float4 position [[position]];
+  float4 color;
+  float  lineDistance;   // cumulative distance along line in screen space
+  float3 worldPosition;
+};
+
+// Check if stipple pattern bit is set at given distance
+// Pattern is 16-bit, factor stretches it
+float computeStippleMask(float lineDistance, uint pattern, uint factor) {
+  // If solid pattern, always visible
+  if (pattern == 0xFFFFu) {
+    return 1.0;
+  }
+  // If empty pattern, always invisible
+  if (pattern == 0u) {
+    return 0.0;
+  }
+  
+  // Scale distance by factor (each bit covers 'factor' pixels)
+  float scaledDist = lineDistance / float(max(factor, 1u));
+  
+  // Get bit position (0-15) from distance
+  // Pattern repeats every 16 bits
+  int bitPos = int(floor(scaledDist)) & 0xF;
+  
+  // Check if bit is set in pattern (LSB first, like OpenGL)
+  uint bit = (pattern >> bitPos) & 1u;
+  
+  return float(bit);
+}
+
+// Anti-aliased stipple mask with smooth transitions
+float computeStippleMaskAA(float lineDistance, uint pattern, uint factor, float feather) {
+  // If solid pattern, always visible
+  if (pattern == 0xFFFFu) {
+    return 1.0;
+  }
+  // If empty pattern, always invisible
+  if (pattern == 0u) {
+    return 0.0;
+  }
+  
+  float scaledDist = lineDistance / float(max(factor, 1u));
+  float fractPos = fract(scaledDist);
+  int bitPos = int(floor(scaledDist)) & 0xF;
+  int nextBitPos = (bitPos + 1) & 0xF;
+  
+  // Get current and next bit
+  float currBit = float((pattern >> bitPos) & 1u);
+  float nextBit = float((pattern >> nextBitPos) & 1u);
+  
+  // Smooth transition near bit boundaries
+  float edgeDist = min(fractPos, 1.0 - fractPos);
+  float transitionWidth = feather / float(max(factor, 1u));
+  
+  if (currBit != nextBit && fractPos > 1.0 - transitionWidth) {
+    // Approaching bit boundary with state change
+    float t = (fractPos - (1.0 - transitionWidth)) / transitionWidth;
+    return mix(currBit, nextBit, smoothstep(0.0, 1.0, t));
+  }
+  
+  return currBit;
+}
+
+// Vertex shader for stippled lines - basic version
+// Note: For proper line stipple, we need distance along the line
+// This requires either geometry shader emulation or compute preprocessing
+vertex VertexOutLine vertex_line_stipple(
+  const device packed_float3* positions [[buffer(0)]],
+  const device float*  lineDistances    [[buffer(2)]],  // precomputed distances
+  constant Uniforms& uniforms           [[buffer(1)]],
+  uint vid                              [[vertex_id]])
+{
+  VertexOutLine out;
+  float3 pos = float3(positions[vid]);
+  float4 worldPos = float4(pos, 1.0);
+  float4 viewPos = uniforms.modelViewMatrix * worldPos;
+  out.position = uniforms.projectionMatrix * viewPos;
+  out.worldPosition = worldPos.xyz;
+  out.color = uniforms.color;
+  out.lineDistance = lineDistances[vid];
+  return out;
+}
+
+// Simple vertex shader for lines without precomputed distances
+// Uses vertex index as approximate distance (works for line strips)
+vertex VertexOutLine vertex_line_stipple_simple(
+  const device packed_float3* positions [[buffer(0)]],
+  constant Uniforms& uniforms           [[buffer(1)]],
+  constant LineUniforms& line           [[buffer(3)]],
+  uint vid                              [[vertex_id]])
+{
+  VertexOutLine out;
+  float3 pos = float3(positions[vid]);
+  float4 worldPos = float4(pos, 1.0);
+  float4 viewPos = uniforms.modelViewMatrix * worldPos;
+  float4 clipPos = uniforms.projectionMatrix * viewPos;
+  out.position = clipPos;
+  out.worldPosition = worldPos.xyz;
+  out.color = uniforms.color;
+  
+  // Use a simple per-segment distance based on screen position
+  // This works reasonably for visualization but isn't perfect for all cases
+  float2 screenPos = (clipPos.xy / clipPos.w * 0.5 + 0.5) * line.viewport;
+  out.lineDistance = float(vid) * float(line.factor) * 2.0;
+  
+  return out;
+}
+
+// Fragment shader for stippled lines
+fragment float4 fragment_line_stipple(
+  VertexOutLine in [[stage_in]],
+  constant LineUniforms& line [[buffer(0)]],
+  constant ClipUniforms& clip [[buffer(1), function_constant(HAS_CLIP_PLANES)]])
+{
+  if (HAS_CLIP_PLANES && isClipped(in.worldPosition, clip)) discard_fragment();
+
+  // Compute stipple mask
+  float mask = computeStippleMaskAA(in.lineDistance, line.pattern, line.factor, line.feather);
+  
+  // Discard transparent parts of stipple
+  if (mask < 0.01) {
+    discard_fragment();
+  }
+  
+  return float4(in.color.rgb, in.color.a * mask);
+}
+
+// ======== LINE DISTANCE COMPUTE SHADER ========
+
+// Compute shader to calculate cumulative line distances for line strips
+// This is needed for accurate stipple patterns along polylines
+kernel void compute_line_distances(
+  device const packed_float3* positions [[buffer(0)]],
+  device float* lineDistances           [[buffer(1)]],
+  constant Uniforms& uniforms      [[buffer(2)]],
+  constant float2& viewport        [[buffer(3)]],
+  uint vid                         [[thread_position_in_grid]])
+{
+  if (vid == 0) {
+    lineDistances[0] = 0.0;
+    return;
+  }
+  
+  // Transform current and previous position to screen space
+  float4x4 mvp = uniforms.projectionMatrix * uniforms.modelViewMatrix;
+  
+  float4 currClip = mvp * float4(positions[vid], 1.0);
+  float4 prevClip = mvp * float4(positions[vid - 1], 1.0);
+  
+  float2 currScreen = (currClip.xy / currClip.w * 0.5 + 0.5) * viewport;
+  float2 prevScreen = (prevClip.xy / prevClip.w * 0.5 + 0.5) * viewport;
+  
+  // Distance is cumulative from start
+  float segmentDist = length(currScreen - prevScreen);
+  lineDistances[vid] = lineDistances[vid - 1] + segmentDist;
+}
+
+// ======== HATCH PATTERN SHADERS ========
+
+// Hatch pattern types matching Aspect_HatchStyle
+// Note: OCCT enum values are non-contiguous, we remap to 0-12
+#define HATCH_NONE              0   // Aspect_HS_SOLID
+#define HATCH_GRID_DIAGONAL     1   // Aspect_HS_GRID_DIAGONAL (cross hatch)
+#define HATCH_GRID_DIAGONAL_WIDE 2  // Aspect_HS_GRID_DIAGONAL_WIDE
+#define HATCH_GRID              3   // Aspect_HS_GRID
+#define HATCH_GRID_WIDE         4   // Aspect_HS_GRID_WIDE
+#define HATCH_DIAGONAL_45       5   // Aspect_HS_DIAGONAL_45
+#define HATCH_DIAGONAL_135      6   // Aspect_HS_DIAGONAL_135
+#define HATCH_HORIZONTAL        7   // Aspect_HS_HORIZONTAL
+#define HATCH_VERTICAL          8   // Aspect_HS_VERTICAL
+#define HATCH_DIAGONAL_45_WIDE  9   // Aspect_HS_DIAGONAL_45_WIDE
+#define HATCH_DIAGONAL_135_WIDE 10  // Aspect_HS_DIAGONAL_135_WIDE
+#define HATCH_HORIZONTAL_WIDE   11  // Aspect_HS_HORIZONTAL_WIDE
+#define HATCH_VERTICAL_WIDE     12  // Aspect_HS_VERTICAL_WIDE
+
+// Hatch uniforms structure
+struct HatchUniforms {
+  int   hatchType;       // pattern type
+  float spacing;         // spacing between lines
+  float lineWidth;       // line thickness
+  float angle;           // custom rotation
+  float2 viewport;       // viewport size
+  float2 padding;
+};
+
+// Calculate distance to a line at given angle
+// Returns positive distance to nearest line
+float hatchLineDist(float2 coord, float angle, float spacing) {
+  // Rotate coordinate to align with line angle
+  float c = cos(angle);
+  float s = sin(angle);
+  float rotated = coord.x * c + coord.y * s;
+  
+  // Distance to nearest line (lines at multiples of spacing)
+  return abs(fmod(rotated + spacing * 0.5, spacing) - spacing * 0.5);
+}
+
+// Compute anti-aliased hatch mask for a single line direction
+float hatchLineMask(float2 fragCoord, float angle, float spacing, float lineWidth) {
+  float dist = hatchLineDist(fragCoord, angle, spacing);
+  float feather = 1.0; // anti-aliasing width
+  return 1.0 - smoothstep(lineWidth * 0.5 - feather, lineWidth * 0.5 + feather, dist);
+}
+
+// Core hatch pattern function
+// Returns mask value: 1.0 = line (discard), 0.0 = fill (keep)
+float computeHatchMask(float2 fragCoord, constant HatchUniforms& hatch) {
+  if (hatch.hatchType == HATCH_NONE) {
+    return 0.0; // no hatching, keep all pixels
+  }
+  
+  float spacing = hatch.spacing;
+  float lineWidth = hatch.lineWidth;
+  float mask = 0.0;
+  
+  // Select pattern based on type
+  switch (hatch.hatchType) {
+    case HATCH_HORIZONTAL:
+    case HATCH_HORIZONTAL_WIDE:
+      mask = hatchLineMask(fragCoord, 0.0, spacing, lineWidth);
+      break;
+      
+    case HATCH_VERTICAL:
+    case HATCH_VERTICAL_WIDE:
+      mask = hatchLineMask(fragCoord, M_PI_2_F, spacing, lineWidth);
+      break;
+      
+    case HATCH_DIAGONAL_45:
+    case HATCH_DIAGONAL_45_WIDE:
+      mask = hatchLineMask(fragCoord, M_PI_4_F, spacing, lineWidth);
+      break;
+      
+    case HATCH_DIAGONAL_135:
+    case HATCH_DIAGONAL_135_WIDE:
+      mask = hatchLineMask(fragCoord, -M_PI_4_F, spacing, lineWidth);
+      break;
+      
+    case HATCH_GRID:
+    case HATCH_GRID_WIDE: {
+      // Horizontal + Vertical
+      float h = hatchLineMask(fragCoord, 0.0, spacing, lineWidth);
+      float v = hatchLineMask(fragCoord, M_PI_2_F, spacing, lineWidth);
+      mask = max(h, v);
+      break;
+    }
+      
+    case HATCH_GRID_DIAGONAL:
+    case HATCH_GRID_DIAGONAL_WIDE: {
+      // Diagonal 45 + 135 (cross-hatch)
+      float d45 = hatchLineMask(fragCoord, M_PI_4_F, spacing, lineWidth);
+      float d135 = hatchLineMask(fragCoord, -M_PI_4_F, spacing, lineWidth);
+      mask = max(d45, d135);
+      break;
+    }
+      
+    default:
+      mask = 0.0;
+      break;
+  }
+  
+  return mask;
+}
+
+// Vertex output for hatched geometry
+struct VertexOutHatch {
+  float4 position [[position]];
+  float3 normal;
+  float3 viewPosition;
+  float4 color;
+  float3 worldPosition;
+};
+
+// Vertex shader for hatched surfaces
+vertex VertexOutHatch vertex_hatch(
+  const device packed_float3* positions [[buffer(0)]],
+  const device packed_float3* normals   [[buffer(2)]],
+  constant Uniforms& uniforms           [[buffer(1)]],
+  uint vid                              [[vertex_id]])
+{
+  VertexOutHatch out;
+  float3 pos = float3(positions[vid]);
+  float3 norm = float3(normals[vid]);
+  float4 worldPos = float4(pos, 1.0);
+  float4 viewPos = uniforms.modelViewMatrix * worldPos;
+  out.position = uniforms.projectionMatrix * viewPos;
+  out.worldPosition = worldPos.xyz;
+  out.viewPosition = viewPos.xyz;
+  out.normal = normalize((uniforms.modelViewMatrix * float4(norm, 0.0)).xyz);
+  out.color = uniforms.color;
+  return out;
+}
+
+// Fragment shader: Hatched surface with Phong lighting
+fragment float4 fragment_hatch_phong(
+  VertexOutHatch in [[stage_in]],
+  constant Uniforms& uniforms       [[buffer(0)]],
+  constant LightUniforms& lights    [[buffer(1)]],
+  constant HatchUniforms& hatch     [[buffer(2)]],
+  constant ClipUniforms& clip       [[buffer(3), function_constant(HAS_CLIP_PLANES)]])
+{
+  if (HAS_CLIP_PLANES && isClipped(in.worldPosition, clip)) discard_fragment();
+
+  // Calculate hatch mask in screen space
+  float2 fragCoord = in.position.xy;
+  float mask = computeHatchMask(fragCoord, hatch);
+  
+  // Discard hatched pixels (where mask > 0.5)
+  if (mask > 0.5) {
+    discard_fragment();
+  }
+  
+  // Compute Phong lighting for visible pixels
+  float3 N = normalize(in.normal);
+  float3 V = normalize(-in.viewPosition);
+  
+  // Two-sided lighting
+  if (dot(N, V) < 0.0) N = -N;
+  
+  float3 result = lights.AmbientColor.rgb * in.color.rgb;
+  for (int i = 0; i < lights.LightCount; i++) {
+    result += computePhongLight(lights.Lights[i], N, V, in.viewPosition,
+                                in.color.rgb, float3(1.0), 32.0,
+                                uniforms.modelViewMatrix);
+  }
+  
+  // Apply anti-aliasing at edges
+  float alpha = in.color.a * (1.0 - mask);
+  return float4(saturate(result), alpha);
+}
+
+// Fragment shader: Hatched surface unlit
+fragment float4 fragment_hatch_unlit(
+  VertexOutHatch in [[stage_in]],
+  constant HatchUniforms& hatch [[buffer(0)]])
+{
+  float2 fragCoord = in.position.xy;
+  float mask = computeHatchMask(fragCoord, hatch);
+  
+  if (mask > 0.5) {
+    discard_fragment();
+  }
+  
+  float alpha = in.color.a * (1.0 - mask);
+  return float4(in.color.rgb, alpha);
+}
+
+)";
+
+  //! MSL source of object and mesh shaders rendering Metal_MeshletBuffer.
+  //! Kept apart from THE_SHADER_MANAGER_SOURCE as mesh shaders require Metal 3 GPU family.
+  static const char* THE_MESHLET_SHADER_SOURCE = R"(
+#include <metal_stdlib>
+using namespace metal;
+
+// Legacy uniforms - should match Uniforms in THE_SHADER_MANAGER_SOURCE
+struct Uniforms {
+  float4x4 modelViewMatrix;
+  float4x4 projectionMatrix;
+  float4 color;
+};
+
+// Should match VertexOutPhong in THE_SHADER_MANAGER_SOURCE
+struct VertexOutPhong {
+  float4 position [[position]];
+  float3 normal;
+  float3 viewPosition;
+  float4 color;
+  float3 worldPosition;
+};
+
+// Should match Metal_MeshletBuffer::Meshlet
+struct MeshletDesc {
+  uint VertexOffset;
+  uint TriangleOffset;
+  uint VertexCount;
+  uint TriangleCount;
+  packed_float3 Center;
+  float Radius;
+  packed_float3 ConeAxis;
+  float ConeCutoff;
+};
+
+struct MeshletParams {
+  uint NbMeshlets;
+  uint ToCullBackFaces;
+  uint2 padding;
+};
+
+#define MESHLET_OBJECT_GROUP 32
+#define MESHLET_MESH_GROUP   128
+#define MESHLET_MAX_VERTICES 64
+#define MESHLET_MAX_TRIANGLES 124
+
+struct MeshletPayload {
+  uint MeshletIndices[MESHLET_OBJECT_GROUP];
+};
+
+// Test meshlet bounding sphere against view frustum and normal cone against view direction
+static bool isMeshletVisible(MeshletDesc m, constant Uniforms& uniforms, bool toCullBackFaces)
+{
+  const float4x4 mv = uniforms.modelViewMatrix;
+  const float3 center = (mv * float4(float3(m.Center), 1.0)).xyz;
+  const float scale = max(max(length(mv[0].xyz), length(mv[1].xyz)), length(mv[2].xyz));
+  const float radius = m.Radius * scale;
+
+  // frustum planes in view space; near plane is taken for [-w, w] depth range, which is conservative for [0, w]
+  const float4x4 p = transpose(uniforms.projectionMatrix);
+  const float4 planes[6] = { p[3] + p[0], p[3] - p[0], p[3] + p[1], p[3] - p[1], p[3] + p[2], p[3] - p[2] };
+  for (int i = 0; i < 6; ++i) {
+    if (dot(planes[i].xyz, center) + planes[i].w < -radius * length(planes[i].xyz)) {
+      return false;
+    }
+  }
+
+  if (!toCullBackFaces || m.ConeCutoff >= 1.0) {
+    return true;
+  }
+
+  // all triangles are back-facing when the viewer lies within the negative normal cone
+  const float3 axis = normalize((mv * float4(float3(m.ConeAxis), 0.0)).xyz);
+  if (uniforms.projectionMatrix[3][3] > 0.5) {
+    return dot(float3(0.0, 0.0, -1.0), axis) < m.ConeCutoff;
+  }
+  return dot(center, axis) < m.ConeCutoff * length(center) + radius;
+}
+
+[[object, max_total_threads_per_threadgroup(MESHLET_OBJECT_GROUP)]]
+void object_meshlet_cull(
+  object_data MeshletPayload& payload   [[payload]],
+  const device MeshletDesc* meshlets    [[buffer(6)]],
+  constant Uniforms& uniforms           [[buffer(1)]],
+  constant MeshletParams& params        [[buffer(7)]],
+  uint tid                              [[thread_position_in_grid]],
+  uint lid                              [[thread_index_in_threadgroup]],
+  mesh_grid_properties mgp)
+{
+  threadgroup atomic_uint nbVisible;
+  if (lid == 0) {
+    atomic_store_explicit(&nbVisible, 0u, memory_order_relaxed);
+  }
+  threadgroup_barrier(mem_flags::mem_threadgroup);
+
+  if (tid < params.NbMeshlets
+   && isMeshletVisible(meshlets[tid], uniforms, params.ToCullBackFaces != 0)) {
+    const uint slot = atomic_fetch_add_explicit(&nbVisible, 1u, memory_order_relaxed);
+    payload.MeshletIndices[slot] = tid;
+  }
+  threadgroup_barrier(mem_flags::mem_threadgroup);
+
+  if (lid == 0) {
+    mgp.set_threadgroups_per_grid(uint3(atomic_load_explicit(&nbVisible, memory_order_relaxed), 1, 1));
+  }
+}
+
+using MeshletMesh = metal::mesh<VertexOutPhong, void, MESHLET_MAX_VERTICES, MESHLET_MAX_TRIANGLES, topology::triangle>;
+
+// Mesh shader variant of vertex_phong
+[[mesh, max_total_threads_per_threadgroup(MESHLET_MESH_GROUP)]]
+void mesh_meshlet_phong(
+  MeshletMesh output,
+  const object_data MeshletPayload& payload [[payload]],
+  const device packed_float3* positions     [[buffer(0)]],
+  const device packed_float3* normals       [[buffer(2)]],
+  constant Uniforms& uniforms               [[buffer(1)]],
+  const device MeshletDesc* meshlets        [[buffer(6)]],
+  const device uint* meshletVertices        [[buffer(8)]],
+  const device uint* meshletTriangles       [[buffer(9)]],
+  uint gid                                  [[threadgroup_position_in_grid]],
+  uint lid                                  [[thread_index_in_threadgroup]])
+{
+  const MeshletDesc m = meshlets[payload.MeshletIndices[gid]];
+  if (lid == 0) {
+    output.set_primitive_count(m.TriangleCount);
+  }
+
+  if (lid < m.VertexCount) {
+    const uint vid = meshletVertices[m.VertexOffset + lid];
+    VertexOutPhong out;
+    float4 worldPos = float4(float3(positions[vid]), 1.0);
+    float4 viewPos = uniforms.modelViewMatrix * worldPos;
+    out.position = uniforms.projectionMatrix * viewPos;
+    out.worldPosition = worldPos.xyz;
+    out.viewPosition = viewPos.xyz;
+    out.normal = normalize((uniforms.modelViewMatrix * float4(float3(normals[vid]), 0.0)).xyz);
+    out.color = uniforms.color;
+    output.set_vertex(lid, out);
+  }
+
+  if (lid < m.TriangleCount) {
+    const uint tri = meshletTriangles[m.TriangleOffset + lid];
+    output.set_index(lid * 3 + 0, uchar( tri        & 0xFF));
+    output.set_index(lid * 3 + 1, uchar((tri >> 8)  & 0xFF));
+    output.set_index(lid * 3 + 2, uchar((tri >> 16) & 0xFF));
+  }
+}
+)";
+
+  //! MSL source of post-tessellation vertex function evaluating Metal_BSplineSurface.
+  //! Outputs the same varyings as vertex_phong, so that fragment stage of classic pipeline is reused.
+  static const char* THE_BSPLINE_SHADER_SOURCE = R"(
+#include <metal_stdlib>
+using namespace metal;
+
+// Should match Metal_BSplineSurface::MaxDegree
+#define BSPLINE_MAX_DEGREE 9
+
+// Legacy uniforms - should match Uniforms in THE_SHADER_MANAGER_SOURCE
+struct Uniforms {
+  float4x4 modelViewMatrix;
+  float4x4 projectionMatrix;
+  float4 color;
+};
+
+// Should match VertexOutPhong in THE_SHADER_MANAGER_SOURCE, extended by trimming clip distance
+struct VertexOutBSpline {
+  float4 position [[position]];
+  float3 normal;
+  float3 viewPosition;
+  float4 color;
+  float3 worldPosition;
+  float  trimDistance [[clip_distance]] [1];
+};
+
+// Should match Metal_BSplineSurface::ShaderParams
+struct BSplineSurfaceParams {
+  uint UDegree;
+  uint VDegree;
+  uint NbUPoles;
+  uint NbVPoles;
+  uint NbUKnots;
+  uint HasTrim;
+  uint IsReversed;
+  uint Padding;
+  float4 TrimRange;
+};
+
+// Should match Metal_BSplineSurface::Patch
+struct BSplinePatch {
+  uint USpan;
+  uint VSpan;
+};
+
+// Non-zero basis functions and their first derivatives (The NURBS Book, algorithm A2.3)
+static void bsplineBasis(const device float* knots, uint span, uint p, float t,
+                         thread float* N, thread float* dN)
+{
+  float left [BSPLINE_MAX_DEGREE + 1];
+  float right[BSPLINE_MAX_DEGREE + 1];
+  float ndu[BSPLINE_MAX_DEGREE + 1][BSPLINE_MAX_DEGREE + 1];
+  ndu[0][0] = 1.0;
+  for (uint j = 1; j <= p; ++j) {
+    left[j]  = t - knots[span + 1 - j];
+    right[j] = knots[span + j] - t;
+    float saved = 0.0;
+    for (uint r = 0; r < j; ++r) {
+      ndu[j][r] = right[r + 1] + left[j - r];
+      const float temp = ndu[r][j - 1] / ndu[j][r];
+      ndu[r][j] = saved + right[r + 1] * temp;
+      saved = left[j - r] * temp;
+    }
+    ndu[j][j] = saved;
+  }
+  for (uint r = 0; r <= p; ++r) {
+    N[r] = ndu[r][p];
+    float d = 0.0;
+    if (r >= 1) {
+      d += ndu[r - 1][p - 1] / ndu[p][r - 1];
+    }
+    if (r < p) {
+      d -= ndu[r][p - 1] / ndu[p][r];
+    }
+    dN[r] = float(p) * d;
+  }
+}
+
+// Evaluate point and first partial derivatives of rational surface
+static void evalSurface(constant BSplineSurfaceParams& surf,
+                        const device float4* poles, const device float* knots,
+                        BSplinePatch patch, float u, float v,
+                        thread float3& pnt, thread float3& du, thread float3& dv)
+{
+  float Nu[BSPLINE_MAX_DEGREE + 1], dNu[BSPLINE_MAX_DEGREE + 1];
+  float Nv[BSPLINE_MAX_DEGREE + 1], dNv[BSPLINE_MAX_DEGREE + 1];
+  bsplineBasis(knots,                 patch.USpan, surf.UDegree, u, Nu, dNu);
+  bsplineBasis(knots + surf.NbUKnots, patch.VSpan, surf.VDegree, v, Nv, dNv);
+
+  float4 S = float4(0.0), Su = float4(0.0), Sv = float4(0.0);
+  for (uint i = 0; i <= surf.UDegree; ++i) {
+    const uint row = (patch.USpan - surf.UDegree + i) * surf.NbVPoles + patch.VSpan - surf.VDegree;
+    float4 rowS = float4(0.0), rowSv = float4(0.0);
+    for (uint j = 0; j <= surf.VDegree; ++j) {
+      const float4 Pw = poles[row + j];
+      rowS  += Nv[j]  * Pw;
+      rowSv += dNv[j] * Pw;
+    }
+    S  += Nu[i]  * rowS;
+    Su += dNu[i] * rowS;
+    Sv += Nu[i]  * rowSv;
+  }
+
+  // quotient rule for rational surface
+  pnt = S.xyz / S.w;
+  du  = (Su.xyz - Su.w * pnt) / S.w;
+  dv  = (Sv.xyz - Sv.w * pnt) / S.w;
+}
+
+// Post-tessellation vertex function; patch i covers knot spans patches[i], u and v map to X and Y of quad domain
+[[patch(quad)]]
+vertex VertexOutBSpline vertex_bspline_patch(
+  constant Uniforms& uniforms           [[buffer(1)]],
+  constant BSplineSurfaceParams& surf   [[buffer(11)]],
+  const device float4* poles            [[buffer(12)]],
+  const device float* knots             [[buffer(13)]],
+  const device BSplinePatch* patches    [[buffer(14)]],
+  texture2d<float> trimField            [[texture(0)]],
+  uint patchId                          [[patch_id]],
+  float2 patchCoord                     [[position_in_patch]])
+{
+  constexpr sampler trimSampler(filter::linear, address::clamp_to_edge);
+
+  const BSplinePatch patch = patches[patchId];
+  const device float* vKnots = knots + surf.NbUKnots;
+  // reversed faces mirror the domain to flip triangles winding
+  const float x = surf.IsReversed != 0 ? 1.0 - patchCoord.x : patchCoord.x;
+  const float u = mix(knots [patch.USpan], knots [patch.USpan + 1], x);
+  const float v = mix(vKnots[patch.VSpan], vKnots[patch.VSpan + 1], patchCoord.y);
+
+  float3 pnt, du, dv;
+  evalSurface(surf, poles, knots, patch, u, v, pnt, du, dv);
+  float3 norm = cross(du, dv);
+  if (length_squared(norm) < 1.0e-20) {
+    // degenerated point (e.g. collapsed row of poles) - take normal slightly inside of the patch
+    const float2 uvMid = float2(mix(knots [patch.USpan], knots [patch.USpan + 1], 0.5),
+                                mix(vKnots[patch.VSpan], vKnots[patch.VSpan + 1], 0.5));
+    float3 pntNear, duNear, dvNear;
+    evalSurface(surf, poles, knots, patch, mix(u, uvMid.x, 0.01), mix(v, uvMid.y, 0.01), pntNear, duNear, dvNear);
+    norm = cross(duNear, dvNear);
+  }
+  if (surf.IsReversed != 0) {
+    norm = -norm;
+  }
+
+  VertexOutBSpline out;
+  float4 worldPos = float4(pnt, 1.0);
+  float4 viewPos = uniforms.modelViewMatrix * worldPos;
+  out.position = uniforms.projectionMatrix * viewPos;
+  out.worldPosition = worldPos.xyz;
+  out.viewPosition = viewPos.xyz;
+  out.normal = normalize((uniforms.modelViewMatrix * float4(norm, 0.0)).xyz);
+  out.color = uniforms.color;
+
+  // trimming field keeps positive values inside of the face
+  out.trimDistance[0] = 1.0;
+  if (surf.HasTrim != 0) {
+    const float2 uvTrim = (float2(u, v) - surf.TrimRange.xy) * surf.TrimRange.zw;
+    out.trimDistance[0] = trimField.sample(trimSampler, uvTrim, level(0.0)).r;
+  }
+  return out;
+}
+)";
+
+  //! MSL source of vertex function drawing Metal_PointCloud slots.
+  //! Outputs the same varyings as vertex_unlit, so that fragment stage of unlit pipeline is reused.
+  static const char* THE_POINT_CLOUD_SHADER_SOURCE = R"(
+#include <metal_stdlib>
+using namespace metal;
+
+struct Uniforms {
+  float4x4 modelViewMatrix;
+  float4x4 projectionMatrix;
+  float4 color;
+};
+
+// should match Metal_CloudPoint in Metal_PointCloud
+struct CloudPoint {
+  packed_float3 position;
+  uint color;
+};
+
+// should match Metal_PointCloudParams in Metal_PointCloud
+struct PointCloudParams {
+  float PointSize;
+  uint  HasColors;
+};
+
+// Should match VertexOutUnlit in THE_SHADER_MANAGER_SOURCE
+struct VertexOutPointCloud {
+  float4 position [[position]];
+  float4 color;
+  float3 worldPosition;
+  float  pointSize [[point_size]];
+};
+
+vertex VertexOutPointCloud vertex_point_cloud(
+  const device CloudPoint* points   [[buffer(0)]],
+  constant Uniforms& uniforms       [[buffer(1)]],
+  constant PointCloudParams& params [[buffer(11)]],
+  uint vid                          [[vertex_id]])
+{
+  VertexOutPointCloud out;
+  const CloudPoint pnt = points[vid];
+  const float4 worldPos = float4(float3(pnt.position), 1.0);
+  out.position = uniforms.projectionMatrix * (uniforms.modelViewMatrix * worldPos);
+  out.worldPosition = worldPos.xyz;
+  out.color = params.HasColors != 0 ? unpack_unorm4x8_to_float(pnt.color) : uniforms.color;
+  out.pointSize = params.PointSize;
+  return out;
+}
+)";
+
+  //! MSL source of functions drawing Metal_PrimitiveArray line segments as instanced screen-space quads.
+  static const char* THE_WIDE_LINE_SHADER_SOURCE = R"(
+#include <metal_stdlib>
+using namespace metal;
+
+#define MAX_CLIP_PLANES 8
+
+// ends of segments closer to the eye are cut, so that both ends are projected
+#define NEAR_W 1.0e-5
+
+// joins sharper than this ratio of miter length to half width are not mitered
+#define MITER_LIMIT 4.0
+
+struct Uniforms {
+  float4x4 modelViewMatrix;
+  float4x4 projectionMatrix;
+  float4 color;
+};
+
+// should match Metal_ClipPlaneUniforms
+struct ClipUniforms {
+  float4 Planes[MAX_CLIP_PLANES];
+  int PlaneCount;
+  int3 padding;
+};
+
+// should match Metal_LineUniforms
+struct LineUniforms {
+  float  lineWidth;
+  float  feather;
+  uint   pattern;
+  uint   factor;
+  float2 viewport;
+  float2 padding;
+};
+
+struct VertexOutWideLine {
+  float4 position [[position]];
+  float4 color;
+  float3 worldPosition;
+  float  edgeDistance [[center_no_perspective]]; // signed distance to the line axis in pixels
+  float  lineDistance [[center_no_perspective]]; // distance along the segment from its start in pixels
+};
+
+float2 toWindow(float4 theClip, float2 theViewport) {
+  return (theClip.xy / theClip.w * 0.5 + 0.5) * theViewport;
+}
+
+// segment xyzw - vertex indices of previous node, segment start, segment end and next node;
+// vertex_id 0..3 - corner of the quad (bit 0 - end of segment, bit 1 - side of the line)
+vertex VertexOutWideLine vertex_wide_line(
+  const device packed_float3* positions [[buffer(0)]],
+  constant Uniforms& uniforms           [[buffer(1)]],
+  constant LineUniforms& line           [[buffer(11)]],
+  const device uint4* segments          [[buffer(12)]],
+  uint vid                              [[vertex_id]],
+  uint iid                              [[instance_id]])
+{
+  VertexOutWideLine out;
+  const uint4    seg  = segments[iid];
+  const float4x4 aMVP = uniforms.projectionMatrix * uniforms.modelViewMatrix;
+  float3 p0 = float3(positions[seg.y]);
+  float3 p1 = float3(positions[seg.z]);
+  float4 c0 = aMVP * float4(p0, 1.0);
+  float4 c1 = aMVP * float4(p1, 1.0);
+  bool hasPrev = seg.x != seg.y;
+  bool hasNext = seg.w != seg.z;
+  out.color = uniforms.color;
+  out.edgeDistance = 0.0;
+  out.lineDistance = 0.0;
+  if (c0.w < NEAR_W && c1.w < NEAR_W) {
+    out.position = float4(0.0, 0.0, 2.0, 1.0); // outside of clip volume
+    out.worldPosition = p0;
+    return out;
+  }
+  if (c0.w < NEAR_W) {
+    const float t = (NEAR_W - c0.w) / (c1.w - c0.w);
+    c0 = mix(c0, c1, t);
+    p0 = mix(p0, p1, t);
+    hasPrev = false;
+  } else if (c1.w < NEAR_W) {
+    const float t = (NEAR_W - c1.w) / (c0.w - c1.w);
+    c1 = mix(c1, c0, t);
+    p1 = mix(p1, p0, t);
+    hasNext = false;
+  }
+
+  const float2 s0 = toWindow(c0, line.viewport);
+  const float2 s1 = toWindow(c1, line.viewport);
+  const float  aLen = length(s1 - s0);
+  const float2 aDir = aLen > 1.0e-6 ? (s1 - s0) / aLen : float2(1.0, 0.0);
+  const float2 aNorm = float2(-aDir.y, aDir.x);
+  const bool   isEnd = (vid & 1u) != 0;
+  const float  aSide = (vid & 2u) != 0 ? 1.0 : -1.0;
+  const float  aHalfWidth = 0.5 * line.lineWidth + line.feather;
+
+  // miter join shared with adjacent segment, so that wide polylines have no gaps at nodes
+  float2 anOffset = aNorm * aHalfWidth;
+  if (isEnd ? hasNext : hasPrev) {
+    const float4 cn = aMVP * float4(float3(positions[isEnd ? seg.w : seg.x]), 1.0);
+    if (cn.w >= NEAR_W) {
+      const float2 sn = toWindow(cn, line.viewport);
+      const float2 dn = isEnd ? sn - s1 : s0 - sn;
+      const float  aLenN = length(dn);
+      const float2 aTangent = aDir + (aLenN > 1.0e-6 ? dn / aLenN : aDir);
+      if (length(aTangent) > 1.0e-3) {
+        const float2 aMiterDir = normalize(float2(-aTangent.y, aTangent.x));
+        const float  aCos = dot(aMiterDir, aNorm);
+        if (aCos > 1.0 / MITER_LIMIT) {
+          anOffset = aMiterDir * (aHalfWidth / aCos);
+        }
+      }
+    }
+  }
+
+  const float2 aWinPos = (isEnd ? s1 : s0) + anOffset * aSide;
+  const float4 aClip   = isEnd ? c1 : c0;
+  out.position = float4((aWinPos / line.viewport * 2.0 - 1.0) * aClip.w, aClip.z, aClip.w);
+  out.worldPosition = isEnd ? p1 : p0;
+  out.edgeDistance = aSide * aHalfWidth;
+  out.lineDistance = dot(aWinPos - s0, aDir);
+  return out;
+}
+
+// coverage of the fragment by line with anti-aliased edges and 16-bit pattern (LSB first, like OpenGL stipple)
+float wideLineCoverage(VertexOutWideLine in, constant LineUniforms& line) {
+  const int aBit = int(floor(in.lineDistance / float(max(line.factor, 1u)))) & 0xF;
+  if (((line.pattern >> uint(aBit)) & 1u) == 0u) {
+    return 0.0;
+  }
+  return saturate(0.5 + (0.5 * line.lineWidth - abs(in.edgeDistance)) / max(line.feather, 1.0e-3));
+}
+
+fragment float4 fragment_wide_line(
+  VertexOutWideLine in        [[stage_in]],
+  constant LineUniforms& line [[buffer(11)]])
+{
+  const float aCoverage = wideLineCoverage(in, line);
+  if (aCoverage <= 0.0) discard_fragment();
+  return float4(in.color.rgb, in.color.a * aCoverage);
+}
+
+fragment float4 fragment_wide_line_clip(
+  VertexOutWideLine in        [[stage_in]],
+  constant LineUniforms& line [[buffer(11)]],
+  constant ClipUniforms& clip [[buffer(2)]])
+{
+  for (int i = 0; i < clip.PlaneCount; ++i) {
+    if (dot(float4(in.worldPosition, 1.0), clip.Planes[i]) < 0.0) discard_fragment();
+  }
+  const float aCoverage = wideLineCoverage(in, line);
+  if (aCoverage <= 0.0) discard_fragment();
+  return float4(in.color.rgb, in.color.a * aCoverage);
+}
+)";
+}
+
+
 // =======================================================================
 // function : Metal_ShaderManager
 // purpose  : Constructor
@@ -29,7 +2066,16 @@ Metal_ShaderManager::Metal_ShaderManager(Metal_Context* theCtx)
 : Graphic3d_ShaderManager(Aspect_GraphicsLibrary_Metal),
   myContext(theCtx),
   myShadingModel(Graphic3d_TypeOfShadingModel_Phong),
-  myShaderLibrary(nil)
+  myProgramsRevision(0),
+  myNbPipelineHits(0),
+  myNbPipelineMisses(0),
+  myNbPipelineArchiveHits(0),
+  myShaderLibrary(nil),
+  myMeshletLibrary(nil),
+  myBSplineLibrary(nil),
+  myPointCloudLibrary(nil),
+  myWideLineLibrary(nil),
+  myAsyncResults([[NSMutableArray alloc] init])
 {
   myProjectionMatrix.InitIdentity();
   myProjectionMatrixInverse.InitIdentity();
@@ -80,8 +2126,31 @@ Metal_ShaderManager::Metal_ShaderManager(Metal_Context* theCtx)
   myHatchUniforms.Viewport[0] = 800.0f;
   myHatchUniforms.Viewport[1] = 600.0f;
 
-  // Create shader library
+  // Open persistent pipeline cache
+  if (myContext != nullptr && !myContext->Caps()->pipelineCachePath.IsEmpty())
+  {
+    myPipelineArchive = new Metal_PipelineCache();
+    if (!myPipelineArchive->Init(myContext, myContext->Caps()->pipelineCachePath))
+    {
+      myPipelineArchive.Nullify();
+    }
+  }
+
+  // Create shader library
   createShaderLibrary();
+
+  // Precompile pipelines used by previous sessions
+  if (myContext != nullptr && !myContext->Caps()->pipelineProfilePath.IsEmpty())
+  {
+    myUsageProfile = new Metal_PipelineProfile();
+    myUsageProfile->Read(myContext->Caps()->pipelineProfilePath);
+    const int aNbScheduled = WarmUp();
+    if (aNbScheduled > 0)
+    {
+      myContext->Messenger()->SendInfo() << "Metal_ShaderManager: " << aNbScheduled
+                                         << " pipelines from usage profile are compiled in background";
+    }
+  }
 }
 
 // =======================================================================
@@ -99,9 +2168,94 @@ Metal_ShaderManager::~Metal_ShaderManager()
 // =======================================================================
 void Metal_ShaderManager::Release()
 {
+  if (!myUsageProfile.IsNull())
+  {
+    if (!myUsageProfile->Write(myContext->Caps()->pipelineProfilePath))
+    {
+      myContext->Messenger()->SendWarning() << "Metal_ShaderManager: unable to write pipeline profile '"
+                                            << myContext->Caps()->pipelineProfilePath << "'";
+    }
+    myUsageProfile.Nullify();
+  }
+  if (!myPipelineArchive.IsNull())
+  {
+    myPipelineArchive->Save(myContext);
+    myPipelineArchive->Release();
+    myPipelineArchive.Nullify();
+  }
   myPipelineCache.Clear();
+  myMeshletPipelineCache.Clear();
+  myInstancedPipelineCache.Clear();
+  myBSplinePipelineCache.Clear();
+  myPointCloudPipelineCache.Clear();
+  myWideLinePipelineCache.Clear();
   myDepthStencilCache.Clear();
+  myPendingPipelines.Clear();
+  myFailedPipelines.Clear();
+  myFailedMeshletPipelines.Clear();
+  myFailedInstancedPipelines.Clear();
+  myFailedBSplinePipelines.Clear();
+  myFailedPointCloudPipelines.Clear();
+  myFailedWideLinePipelines.Clear();
+  myFunctionCache.Clear();
+  @synchronized (myAsyncResults)
+  {
+    [myAsyncResults removeAllObjects];
+  }
   myShaderLibrary = nil;
+  myMeshletLibrary = nil;
+  myBSplineLibrary = nil;
+  myPointCloudLibrary = nil;
+  myWideLineLibrary = nil;
+}
+
+// =======================================================================
+// function : SavePipelineCache
+// purpose  : Write persistent pipeline cache to disk
+// =======================================================================
+bool Metal_ShaderManager::SavePipelineCache()
+{
+  return myPipelineArchive.IsNull()
+      || myPipelineArchive->Save(myContext);
+}
+
+// =======================================================================
+// function : WarmUp
+// purpose  : Start background compilation of profiled pipelines
+// =======================================================================
+int Metal_ShaderManager::WarmUp()
+{
+  if (myUsageProfile.IsNull()
+   || myShaderLibrary == nil)
+  {
+    return 0;
+  }
+
+  for (NCollection_Map<int>::Iterator anIdIter(myUsageProfile->DepthStencils()); anIdIter.More(); anIdIter.Next())
+  {
+    if (anIdIter.Key() == 0)
+    {
+      defaultDepthStencil();
+    }
+  }
+
+  int aNbScheduled = 0;
+  for (NCollection_Map<Metal_ShaderProgramKey, Metal_ShaderProgramKeyHasher>::Iterator aKeyIter(myUsageProfile->Programs());
+       aKeyIter.More(); aKeyIter.Next())
+  {
+    // profiles written by previous versions may contain keys with bits not affecting pipeline
+    const Metal_ShaderProgramKey aKey(aKeyIter.Key().ShadingModel, PipelineBits(aKeyIter.Key().ProgramBits));
+    if (myPipelineCache.IsBound(aKey)
+     || myPendingPipelines.Contains(aKey))
+    {
+      continue;
+    }
+    if (createPipelineAsync(aKey.ShadingModel, aKey.ProgramBits))
+    {
+      ++aNbScheduled;
+    }
+  }
+  return aNbScheduled;
 }
 
 // =======================================================================
@@ -121,79 +2275,92 @@ void Metal_ShaderManager::SetMaterialUniforms(const Metal_Material& theMaterial,
                                                float theAlphaCutoff,
                                                bool theToDistinguish,
                                                bool theIsPBR)
+{
+  FillMaterialUniforms(myMaterialUniforms, theMaterial, theAlphaCutoff, theToDistinguish, theIsPBR);
+}
+
+// =======================================================================
+// function : FillMaterialUniforms
+// purpose  : Fill comprehensive material uniforms from Metal_Material
+// =======================================================================
+void Metal_ShaderManager::FillMaterialUniforms(Metal_MaterialUniforms& theUniforms,
+                                                const Metal_Material& theMaterial,
+                                                float theAlphaCutoff,
+                                                bool theToDistinguish,
+                                                bool theIsPBR)
 {
   // Copy front common material
   const Metal_MaterialCommon& aFrontCommon = theMaterial.Common[0];
-  myMaterialUniforms.FrontCommon.Diffuse[0] = aFrontCommon.Diffuse.r();
-  myMaterialUniforms.FrontCommon.Diffuse[1] = aFrontCommon.Diffuse.g();
-  myMaterialUniforms.FrontCommon.Diffuse[2] = aFrontCommon.Diffuse.b();
-  myMaterialUniforms.FrontCommon.Diffuse[3] = aFrontCommon.Diffuse.a();
-  myMaterialUniforms.FrontCommon.Emission[0] = aFrontCommon.Emission.r();
-  myMaterialUniforms.FrontCommon.Emission[1] = aFrontCommon.Emission.g();
-  myMaterialUniforms.FrontCommon.Emission[2] = aFrontCommon.Emission.b();
-  myMaterialUniforms.FrontCommon.Emission[3] = aFrontCommon.Emission.a();
-  myMaterialUniforms.FrontCommon.SpecularShininess[0] = aFrontCommon.SpecularShininess.r();
-  myMaterialUniforms.FrontCommon.SpecularShininess[1] = aFrontCommon.SpecularShininess.g();
-  myMaterialUniforms.FrontCommon.SpecularShininess[2] = aFrontCommon.SpecularShininess.b();
-  myMaterialUniforms.FrontCommon.SpecularShininess[3] = aFrontCommon.SpecularShininess.a();
-  myMaterialUniforms.FrontCommon.Ambient[0] = aFrontCommon.Ambient.r();
-  myMaterialUniforms.FrontCommon.Ambient[1] = aFrontCommon.Ambient.g();
-  myMaterialUniforms.FrontCommon.Ambient[2] = aFrontCommon.Ambient.b();
-  myMaterialUniforms.FrontCommon.Ambient[3] = aFrontCommon.Ambient.a();
+  theUniforms.FrontCommon.Diffuse[0] = aFrontCommon.Diffuse.r();
+  theUniforms.FrontCommon.Diffuse[1] = aFrontCommon.Diffuse.g();
+  theUniforms.FrontCommon.Diffuse[2] = aFrontCommon.Diffuse.b();
+  theUniforms.FrontCommon.Diffuse[3] = aFrontCommon.Diffuse.a();
+  theUniforms.FrontCommon.Emission[0] = aFrontCommon.Emission.r();
+  theUniforms.FrontCommon.Emission[1] = aFrontCommon.Emission.g();
+  theUniforms.FrontCommon.Emission[2] = aFrontCommon.Emission.b();
+  theUniforms.FrontCommon.Emission[3] = aFrontCommon.Emission.a();
+  theUniforms.FrontCommon.SpecularShininess[0] = aFrontCommon.SpecularShininess.r();
+  theUniforms.FrontCommon.SpecularShininess[1] = aFrontCommon.SpecularShininess.g();
+  theUniforms.FrontCommon.SpecularShininess[2] = aFrontCommon.SpecularShininess.b();
+  theUniforms.FrontCommon.SpecularShininess[3] = aFrontCommon.SpecularShininess.a();
+  theUniforms.FrontCommon.Ambient[0] = aFrontCommon.Ambient.r();
+  theUniforms.FrontCommon.Ambient[1] = aFrontCommon.Ambient.g();
+  theUniforms.FrontCommon.Ambient[2] = aFrontCommon.Ambient.b();
+  theUniforms.FrontCommon.Ambient[3] = aFrontCommon.Ambient.a();
 
   // Copy back common material
   const Metal_MaterialCommon& aBackCommon = theMaterial.Common[1];
-  myMaterialUniforms.BackCommon.Diffuse[0] = aBackCommon.Diffuse.r();
-  myMaterialUniforms.BackCommon.Diffuse[1] = aBackCommon.Diffuse.g();
-  myMaterialUniforms.BackCommon.Diffuse[2] = aBackCommon.Diffuse.b();
-  myMaterialUniforms.BackCommon.Diffuse[3] = aBackCommon.Diffuse.a();
-  myMaterialUniforms.BackCommon.Emission[0] = aBackCommon.Emission.r();
-  myMaterialUniforms.BackCommon.Emission[1] = aBackCommon.Emission.g();
-  myMaterialUniforms.BackCommon.Emission[2] = aBackCommon.Emission.b();
-  myMaterialUniforms.BackCommon.Emission[3] = aBackCommon.Emission.a();
-  myMaterialUniforms.BackCommon.SpecularShininess[0] = aBackCommon.SpecularShininess.r();
-  myMaterialUniforms.BackCommon.SpecularShininess[1] = aBackCommon.SpecularShininess.g();
-  myMaterialUniforms.BackCommon.SpecularShininess[2] = aBackCommon.SpecularShininess.b();
-  myMaterialUniforms.BackCommon.SpecularShininess[3] = aBackCommon.SpecularShininess.a();
-  myMaterialUniforms.BackCommon.Ambient[0] = aBackCommon.Ambient.r();
-  myMaterialUniforms.BackCommon.Ambient[1] = aBackCommon.Ambient.g();
-  myMaterialUniforms.BackCommon.Ambient[2] = aBackCommon.Ambient.b();
-  myMaterialUniforms.BackCommon.Ambient[3] = aBackCommon.Ambient.a();
+  theUniforms.BackCommon.Diffuse[0] = aBackCommon.Diffuse.r();
+  theUniforms.BackCommon.Diffuse[1] = aBackCommon.Diffuse.g();
+  theUniforms.BackCommon.Diffuse[2] = aBackCommon.Diffuse.b();
+  theUniforms.BackCommon.Diffuse[3] = aBackCommon.Diffuse.a();
+  theUniforms.BackCommon.Emission[0] = aBackCommon.Emission.r();
+  theUniforms.BackCommon.Emission[1] = aBackCommon.Emission.g();
+  theUniforms.BackCommon.Emission[2] = aBackCommon.Emission.b();
+  theUniforms.BackCommon.Emission[3] = aBackCommon.Emission.a();
+  theUniforms.BackCommon.SpecularShininess[0] = aBackCommon.SpecularShininess.r();
+  theUniforms.BackCommon.SpecularShininess[1] = aBackCommon.SpecularShininess.g();
+  theUniforms.BackCommon.SpecularShininess[2] = aBackCommon.SpecularShininess.b();
+  theUniforms.BackCommon.SpecularShininess[3] = aBackCommon.SpecularShininess.a();
+  theUniforms.BackCommon.Ambient[0] = aBackCommon.Ambient.r();
+  theUniforms.BackCommon.Ambient[1] = aBackCommon.Ambient.g();
+  theUniforms.BackCommon.Ambient[2] = aBackCommon.Ambient.b();
+  theUniforms.BackCommon.Ambient[3] = aBackCommon.Ambient.a();
 
   // Copy front PBR material
   const Metal_MaterialPBR& aFrontPBR = theMaterial.Pbr[0];
-  myMaterialUniforms.FrontPBR.BaseColor[0] = aFrontPBR.BaseColor.r();
-  myMaterialUniforms.FrontPBR.BaseColor[1] = aFrontPBR.BaseColor.g();
-  myMaterialUniforms.FrontPBR.BaseColor[2] = aFrontPBR.BaseColor.b();
-  myMaterialUniforms.FrontPBR.BaseColor[3] = aFrontPBR.BaseColor.a();
-  myMaterialUniforms.FrontPBR.EmissionIOR[0] = aFrontPBR.EmissionIOR.r();
-  myMaterialUniforms.FrontPBR.EmissionIOR[1] = aFrontPBR.EmissionIOR.g();
-  myMaterialUniforms.FrontPBR.EmissionIOR[2] = aFrontPBR.EmissionIOR.b();
-  myMaterialUniforms.FrontPBR.EmissionIOR[3] = aFrontPBR.EmissionIOR.a();
-  myMaterialUniforms.FrontPBR.Params[0] = aFrontPBR.Params.r();
-  myMaterialUniforms.FrontPBR.Params[1] = aFrontPBR.Params.g();
-  myMaterialUniforms.FrontPBR.Params[2] = aFrontPBR.Params.b();
-  myMaterialUniforms.FrontPBR.Params[3] = aFrontPBR.Params.a();
+  theUniforms.FrontPBR.BaseColor[0] = aFrontPBR.BaseColor.r();
+  theUniforms.FrontPBR.BaseColor[1] = aFrontPBR.BaseColor.g();
+  theUniforms.FrontPBR.BaseColor[2] = aFrontPBR.BaseColor.b();
+  theUniforms.FrontPBR.BaseColor[3] = aFrontPBR.BaseColor.a();
+  theUniforms.FrontPBR.EmissionIOR[0] = aFrontPBR.EmissionIOR.r();
+  theUniforms.FrontPBR.EmissionIOR[1] = aFrontPBR.EmissionIOR.g();
+  theUniforms.FrontPBR.EmissionIOR[2] = aFrontPBR.EmissionIOR.b();
+  theUniforms.FrontPBR.EmissionIOR[3] = aFrontPBR.EmissionIOR.a();
+  theUniforms.FrontPBR.Params[0] = aFrontPBR.Params.r();
+  theUniforms.FrontPBR.Params[1] = aFrontPBR.Params.g();
+  theUniforms.FrontPBR.Params[2] = aFrontPBR.Params.b();
+  theUniforms.FrontPBR.Params[3] = aFrontPBR.Params.a();
 
   // Copy back PBR material
   const Metal_MaterialPBR& aBackPBR = theMaterial.Pbr[1];
-  myMaterialUniforms.BackPBR.BaseColor[0] = aBackPBR.BaseColor.r();
-  myMaterialUniforms.BackPBR.BaseColor[1] = aBackPBR.BaseColor.g();
-  myMaterialUniforms.BackPBR.BaseColor[2] = aBackPBR.BaseColor.b();
-  myMaterialUniforms.BackPBR.BaseColor[3] = aBackPBR.BaseColor.a();
-  myMaterialUniforms.BackPBR.EmissionIOR[0] = aBackPBR.EmissionIOR.r();
-  myMaterialUniforms.BackPBR.EmissionIOR[1] = aBackPBR.EmissionIOR.g();
-  myMaterialUniforms.BackPBR.EmissionIOR[2] = aBackPBR.EmissionIOR.b();
-  myMaterialUniforms.BackPBR.EmissionIOR[3] = aBackPBR.EmissionIOR.a();
-  myMaterialUniforms.BackPBR.Params[0] = aBackPBR.Params.r();
-  myMaterialUniforms.BackPBR.Params[1] = aBackPBR.Params.g();
-  myMaterialUniforms.BackPBR.Params[2] = aBackPBR.Params.b();
-  myMaterialUniforms.BackPBR.Params[3] = aBackPBR.Params.a();
+  theUniforms.BackPBR.BaseColor[0] = aBackPBR.BaseColor.r();
+  theUniforms.BackPBR.BaseColor[1] = aBackPBR.BaseColor.g();
+  theUniforms.BackPBR.BaseColor[2] = aBackPBR.BaseColor.b();
+  theUniforms.BackPBR.BaseColor[3] = aBackPBR.BaseColor.a();
+  theUniforms.BackPBR.EmissionIOR[0] = aBackPBR.EmissionIOR.r();
+  theUniforms.BackPBR.EmissionIOR[1] = aBackPBR.EmissionIOR.g();
+  theUniforms.BackPBR.EmissionIOR[2] = aBackPBR.EmissionIOR.b();
+  theUniforms.BackPBR.EmissionIOR[3] = aBackPBR.EmissionIOR.a();
+  theUniforms.BackPBR.Params[0] = aBackPBR.Params.r();
+  theUniforms.BackPBR.Params[1] = aBackPBR.Params.g();
+  theUniforms.BackPBR.Params[2] = aBackPBR.Params.b();
+  theUniforms.BackPBR.Params[3] = aBackPBR.Params.a();
 
   // Set control parameters
-  myMaterialUniforms.IsPBR = theIsPBR ? 1 : 0;
-  myMaterialUniforms.ToDistinguish = theToDistinguish ? 1 : 0;
-  myMaterialUniforms.AlphaCutoff = theAlphaCutoff;
+  theUniforms.IsPBR = theIsPBR ? 1 : 0;
+  theUniforms.ToDistinguish = theToDistinguish ? 1 : 0;
+  theUniforms.AlphaCutoff = theAlphaCutoff;
 }
 
 // =======================================================================
@@ -322,360 +2489,979 @@ void Metal_ShaderManager::UpdateClippingPlanes(const Graphic3d_SequenceOfHClipPl
       continue;
     }
 
-    const NCollection_Vec4<double>& anEq = aPlane->GetEquation();
-    myClipPlaneUniforms.Planes[aPlaneIndex][0] = static_cast<float>(anEq.x());
-    myClipPlaneUniforms.Planes[aPlaneIndex][1] = static_cast<float>(anEq.y());
-    myClipPlaneUniforms.Planes[aPlaneIndex][2] = static_cast<float>(anEq.z());
-    myClipPlaneUniforms.Planes[aPlaneIndex][3] = static_cast<float>(anEq.w());
-    ++aPlaneIndex;
+    const NCollection_Vec4<double>& anEq = aPlane->GetEquation();
+    myClipPlaneUniforms.Planes[aPlaneIndex][0] = static_cast<float>(anEq.x());
+    myClipPlaneUniforms.Planes[aPlaneIndex][1] = static_cast<float>(anEq.y());
+    myClipPlaneUniforms.Planes[aPlaneIndex][2] = static_cast<float>(anEq.z());
+    myClipPlaneUniforms.Planes[aPlaneIndex][3] = static_cast<float>(anEq.w());
+    ++aPlaneIndex;
+  }
+
+  myClipPlaneUniforms.PlaneCount = aPlaneIndex;
+}
+
+// =======================================================================
+// function : GetProgram
+// purpose  : Get or create shader program
+// =======================================================================
+bool Metal_ShaderManager::GetProgram(Graphic3d_TypeOfShadingModel theModel,
+                                      int theBits,
+                                      __strong id<MTLRenderPipelineState>& thePipeline,
+                                      __strong id<MTLDepthStencilState>& theDepthStencil)
+{
+  // may be called concurrently by workspaces of parallel encoding
+  std::lock_guard<std::mutex> aLock(myProgramMutex);
+
+  // configurations differing only by features not affecting pipeline share the same pipeline
+  theBits = PipelineBits(theBits);
+  Metal_ShaderProgramKey aKey(theModel, theBits);
+
+  // Use local __strong variables for ARC compatibility with NCollection_DataMap::Find
+  __strong id<MTLRenderPipelineState> aCachedPipeline = nil;
+  __strong id<MTLDepthStencilState> aCachedDepthStencil = nil;
+
+  // Pick up pipelines compiled asynchronously since last call
+  fetchAsyncPipelines();
+
+  // Check cache first
+  if (myPipelineCache.Find(aKey, aCachedPipeline))
+  {
+    ++myNbPipelineHits;
+    thePipeline = aCachedPipeline;
+    // Get depth-stencil state (same for all pipelines for now)
+    if (!myDepthStencilCache.Find(0, aCachedDepthStencil))
+    {
+      myContext->Messenger()->SendInfo() << "Metal_ShaderManager::GetProgram: depth-stencil not found in cache";
+      return false;
+    }
+    theDepthStencil = aCachedDepthStencil;
+    return true;
+  }
+
+  ++myNbPipelineMisses;
+  if (!myPipelineArchive.IsNull()
+   && myPipelineArchive->Contains(aKey))
+  {
+    ++myNbPipelineArchiveHits;
+  }
+  if (!myUsageProfile.IsNull())
+  {
+    myUsageProfile->AddProgram(aKey);
+    myUsageProfile->AddDepthStencil(0);
+  }
+
+  // Pipeline is already being compiled in background (asynchronous request or warm-up)
+  if (myPendingPipelines.Contains(aKey))
+  {
+    return fallbackProgram(theModel, theBits, thePipeline, theDepthStencil);
+  }
+
+  // Compile pipeline in background and draw with a fallback program meanwhile;
+  // pipelines stored in persistent cache are cheap to load and created synchronously
+  if (myContext->Caps()->asyncPipelineCompilation
+   && !myFailedPipelines.Contains(aKey)
+   && (myPipelineArchive.IsNull() || !myPipelineArchive->Contains(aKey)))
+  {
+    myContext->Messenger()->SendInfo() << "Metal_ShaderManager::GetProgram: compiling pipeline asynchronously for model " << (int)theModel << " bits " << theBits;
+    if (createPipelineAsync(theModel, theBits))
+    {
+      return fallbackProgram(theModel, theBits, thePipeline, theDepthStencil);
+    }
+  }
+
+  // Create new pipeline
+  myContext->Messenger()->SendInfo() << "Metal_ShaderManager::GetProgram: creating new pipeline for model " << (int)theModel << " bits " << theBits;
+  bool aResult = createPipeline(theModel, theBits, thePipeline, theDepthStencil);
+  if (aResult)
+  {
+    myContext->Messenger()->SendInfo() << "Metal_ShaderManager::GetProgram: pipeline created successfully";
+  }
+  else
+  {
+    myContext->Messenger()->SendFail() << "Metal_ShaderManager::GetProgram: pipeline creation failed";
+  }
+  return aResult;
+}
+
+// =======================================================================
+// function : ChooseFaceShadingModel
+// purpose  : Choose shading model for faces
+// =======================================================================
+Graphic3d_TypeOfShadingModel Metal_ShaderManager::ChooseFaceShadingModel(
+  Graphic3d_TypeOfShadingModel theCustomModel,
+  bool theHasNodalNormals) const
+{
+  Graphic3d_TypeOfShadingModel aModel =
+    (theCustomModel != Graphic3d_TypeOfShadingModel_DEFAULT) ? theCustomModel : myShadingModel;
+
+  switch (aModel)
+  {
+    case Graphic3d_TypeOfShadingModel_DEFAULT:
+    case Graphic3d_TypeOfShadingModel_Unlit:
+    case Graphic3d_TypeOfShadingModel_PhongFacet:
+      return aModel;
+    case Graphic3d_TypeOfShadingModel_Gouraud:
+    case Graphic3d_TypeOfShadingModel_Phong:
+      return theHasNodalNormals ? aModel : Graphic3d_TypeOfShadingModel_PhongFacet;
+    case Graphic3d_TypeOfShadingModel_Pbr:
+      // PBR shading with per-vertex normals
+      return theHasNodalNormals ? Graphic3d_TypeOfShadingModel_Pbr
+                                : Graphic3d_TypeOfShadingModel_PbrFacet;
+    case Graphic3d_TypeOfShadingModel_PbrFacet:
+      // PBR facet shading (no per-vertex normals required)
+      return Graphic3d_TypeOfShadingModel_PbrFacet;
+  }
+  return Graphic3d_TypeOfShadingModel_Unlit;
+}
+
+// =======================================================================
+// function : ChooseLineShadingModel
+// purpose  : Choose shading model for lines
+// =======================================================================
+Graphic3d_TypeOfShadingModel Metal_ShaderManager::ChooseLineShadingModel(
+  Graphic3d_TypeOfShadingModel theCustomModel,
+  bool theHasNodalNormals) const
+{
+  Graphic3d_TypeOfShadingModel aModel =
+    (theCustomModel != Graphic3d_TypeOfShadingModel_DEFAULT) ? theCustomModel : myShadingModel;
+
+  switch (aModel)
+  {
+    case Graphic3d_TypeOfShadingModel_DEFAULT:
+    case Graphic3d_TypeOfShadingModel_Unlit:
+    case Graphic3d_TypeOfShadingModel_PhongFacet:
+      return Graphic3d_TypeOfShadingModel_Unlit;
+    case Graphic3d_TypeOfShadingModel_Gouraud:
+    case Graphic3d_TypeOfShadingModel_Phong:
+      return theHasNodalNormals ? aModel : Graphic3d_TypeOfShadingModel_Unlit;
+    case Graphic3d_TypeOfShadingModel_Pbr:
+    case Graphic3d_TypeOfShadingModel_PbrFacet:
+      // PBR line shading - use PBR with normals, or unlit
+      return theHasNodalNormals ? Graphic3d_TypeOfShadingModel_Pbr
+                                : Graphic3d_TypeOfShadingModel_Unlit;
+  }
+  return Graphic3d_TypeOfShadingModel_Unlit;
+}
+
+// =======================================================================
+// function : PrepareFrameUniforms
+// purpose  : Prepare frame uniforms
+// =======================================================================
+void Metal_ShaderManager::PrepareFrameUniforms(Metal_FrameUniforms& theUniforms) const
+{
+  memcpy(theUniforms.ProjectionMatrix, myProjectionMatrix.GetData(), sizeof(float) * 16);
+  memcpy(theUniforms.ViewMatrix, myViewMatrix.GetData(), sizeof(float) * 16);
+  memcpy(theUniforms.ProjectionMatrixInverse, myProjectionMatrixInverse.GetData(), sizeof(float) * 16);
+
+  // View matrix inverse - compute or use identity
+  NCollection_Mat4<float> aViewInv;
+  aViewInv.InitIdentity();
+  memcpy(theUniforms.ViewMatrixInverse, aViewInv.GetData(), sizeof(float) * 16);
+}
+
+// =======================================================================
+// function : PrepareObjectUniforms
+// purpose  : Prepare object uniforms
+// =======================================================================
+void Metal_ShaderManager::PrepareObjectUniforms(Metal_ObjectUniforms& theUniforms) const
+{
+  memcpy(theUniforms.ModelMatrix, myModelMatrix.GetData(), sizeof(float) * 16);
+
+  // Compute ModelView
+  NCollection_Mat4<float> aModelView = myViewMatrix * myModelMatrix;
+  memcpy(theUniforms.ModelViewMatrix, aModelView.GetData(), sizeof(float) * 16);
+
+  // Extract upper-left 3x3 as normal matrix (with 4th row for padding)
+  theUniforms.NormalMatrix[0] = aModelView.GetValue(0, 0);
+  theUniforms.NormalMatrix[1] = aModelView.GetValue(0, 1);
+  theUniforms.NormalMatrix[2] = aModelView.GetValue(0, 2);
+  theUniforms.NormalMatrix[3] = 0.0f;
+  theUniforms.NormalMatrix[4] = aModelView.GetValue(1, 0);
+  theUniforms.NormalMatrix[5] = aModelView.GetValue(1, 1);
+  theUniforms.NormalMatrix[6] = aModelView.GetValue(1, 2);
+  theUniforms.NormalMatrix[7] = 0.0f;
+  theUniforms.NormalMatrix[8] = aModelView.GetValue(2, 0);
+  theUniforms.NormalMatrix[9] = aModelView.GetValue(2, 1);
+  theUniforms.NormalMatrix[10] = aModelView.GetValue(2, 2);
+  theUniforms.NormalMatrix[11] = 0.0f;
+
+  memcpy(theUniforms.ObjectColor, myObjectColor, sizeof(float) * 4);
+}
+
+// =======================================================================
+// function : createShaderLibrary
+// purpose  : Create shader library with all shaders
+// =======================================================================
+bool Metal_ShaderManager::createShaderLibrary()
+{
+  if (myContext == nullptr || myContext->Device() == nil)
+  {
+    return false;
+  }
+
+  @autoreleasepool
+  {
+    NSString* aShaderSource = @(generateShaderSource().ToCString());
+
+    NSError* anError = nil;
+    MTLCompileOptions* anOptions = [[MTLCompileOptions alloc] init];
+    if (@available(macOS 15.0, iOS 18.0, *))
+    {
+      anOptions.mathMode = MTLMathModeFast;
+    }
+    else
+    {
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdeprecated-declarations"
+      anOptions.fastMathEnabled = YES;
+#pragma clang diagnostic pop
+    }
+
+    myShaderLibrary = myContext->LoadShaderLibrary("Metal_ShaderManager_THE_SHADER_MANAGER_SOURCE",
+                                                   aShaderSource, anOptions, &anError);
+    if (myShaderLibrary == nil)
+    {
+      if (anError != nil)
+      {
+        myContext->Messenger()->SendFail() << "Metal_ShaderManager: Shader compilation failed: "
+                                           << [[anError localizedDescription] UTF8String];
+      }
+      return false;
+    }
+
+    myContext->Messenger()->SendInfo() << "Metal_ShaderManager: Shader library created successfully";
+    return true;
+  }
+}
+
+// =======================================================================
+// function : PipelineBits
+// purpose  : Normalize program bits to the features affecting pipeline
+// =======================================================================
+int Metal_ShaderManager::PipelineBits(int theBits)
+{
+  int aBits = theBits & (Graphic3d_ShaderFlags_StippleLine
+                       | Graphic3d_ShaderFlags_HatchPattern
+                       | Metal_ProgramBits_OctNormals);
+  if ((theBits & Graphic3d_ShaderFlags_ClipPlanesN) != 0)
+  {
+    aBits |= Graphic3d_ShaderFlags_ClipPlanesN;
+  }
+  return aBits;
+}
+
+// =======================================================================
+// function : specializedFunction
+// purpose  : Return function of shader library specialized for program bits
+// =======================================================================
+id<MTLFunction> Metal_ShaderManager::specializedFunction(NSString* theName,
+                                                         int theBits)
+{
+  const bool hasClipping   = (theBits & Graphic3d_ShaderFlags_ClipPlanesN) != 0;
+  const bool hasOctNormals = (theBits & Metal_ProgramBits_OctNormals) != 0;
+  const TCollection_AsciiString aKey = TCollection_AsciiString([theName UTF8String])
+                                     + (hasClipping ? "+clip" : "") + (hasOctNormals ? "+oct" : "");
+
+  // Use local __strong variable for ARC compatibility with NCollection_DataMap::Find
+  __strong id<MTLFunction> aFunction = nil;
+  if (myFunctionCache.Find(aKey, aFunction))
+  {
+    return aFunction;
+  }
+
+  MTLFunctionConstantValues* aValues = [[MTLFunctionConstantValues alloc] init];
+  bool aFlags[2] = { hasClipping, hasOctNormals };
+  [aValues setConstantValue:&aFlags[0] type:MTLDataTypeBool atIndex:Metal_FunctionConstant_ClipPlanes];
+  [aValues setConstantValue:&aFlags[1] type:MTLDataTypeBool atIndex:Metal_FunctionConstant_OctNormals];
+
+  NSError* anError = nil;
+  aFunction = [myShaderLibrary newFunctionWithName:theName constantValues:aValues error:&anError];
+  if (aFunction == nil)
+  {
+    myContext->Messenger()->SendFail() << "Metal_ShaderManager: specialization of " << [theName UTF8String]
+                                       << " failed: "
+                                       << (anError != nil ? [[anError localizedDescription] UTF8String] : "");
+    return nil;
+  }
+  myFunctionCache.Bind(aKey, aFunction);
+  return aFunction;
+}
+
+// =======================================================================
+// function : GetInstancedProgram
+// purpose  : Get or create pipeline for instanced draws
+// =======================================================================
+bool Metal_ShaderManager::GetInstancedProgram(Graphic3d_TypeOfShadingModel theModel,
+                                              int theBits,
+                                              __strong id<MTLRenderPipelineState>& thePipeline)
+{
+  if (myContext == nullptr)
+  {
+    return false;
+  }
+
+  std::lock_guard<std::mutex> aLock(myProgramMutex);
+  theBits = PipelineBits(theBits);
+  const Metal_ShaderProgramKey aKey(theModel, theBits);
+  __strong id<MTLRenderPipelineState> aCachedPipeline = nil;
+  if (myInstancedPipelineCache.Find(aKey, aCachedPipeline))
+  {
+    ++myNbPipelineHits;
+    thePipeline = aCachedPipeline;
+    return true;
+  }
+  if (myFailedInstancedPipelines.Contains(aKey))
+  {
+    return false;
+  }
+  ++myNbPipelineMisses;
+
+  @autoreleasepool
+  {
+    // only vertex stage differs from the classic pipeline
+    MTLRenderPipelineDescriptor* aPipelineDesc = createPipelineDescriptor(theModel, theBits);
+    NSString* aVertexName = aPipelineDesc != nil ? aPipelineDesc.vertexFunction.name : nil;
+    id<MTLFunction> aVertex = nil;
+    // instanced vertex stage reads uncompressed normals only
+    if (aVertexName != nil
+     && (theBits & Metal_ProgramBits_OctNormals) == 0
+     && ([aVertexName isEqualToString:@"vertex_unlit"]
+      || [aVertexName isEqualToString:@"vertex_phong"]
+      || [aVertexName isEqualToString:@"vertex_phong_facet"]))
+    {
+      aVertex = [myShaderLibrary newFunctionWithName:[aVertexName stringByAppendingString:@"_instanced"]];
+    }
+    if (aVertex == nil)
+    {
+      myFailedInstancedPipelines.Add(aKey);
+      return false;
+    }
+
+    aPipelineDesc.vertexFunction = aVertex;
+    aPipelineDesc.supportIndirectCommandBuffers = NO;
+    NSError* anError = nil;
+    thePipeline = [myContext->Device() newRenderPipelineStateWithDescriptor:aPipelineDesc error:&anError];
+    if (thePipeline == nil)
+    {
+      myContext->Messenger()->SendWarning() << "Metal_ShaderManager: instanced pipeline creation failed: "
+                                            << (anError != nil ? [[anError localizedDescription] UTF8String] : "");
+      myFailedInstancedPipelines.Add(aKey);
+      return false;
+    }
+
+    myInstancedPipelineCache.Bind(aKey, thePipeline);
+    return true;
+  }
+}
+
+// =======================================================================
+// function : GetMeshletProgram
+// purpose  : Get or create mesh shader pipeline
+// =======================================================================
+bool Metal_ShaderManager::GetMeshletProgram(Graphic3d_TypeOfShadingModel theModel,
+                                            int theBits,
+                                            __strong id<MTLRenderPipelineState>& thePipeline)
+{
+  if (myContext == nullptr
+  || !myContext->HasMeshShaders())
+  {
+    return false;
+  }
+
+  std::lock_guard<std::mutex> aLock(myProgramMutex);
+  theBits = PipelineBits(theBits);
+  const Metal_ShaderProgramKey aKey(theModel, theBits);
+  __strong id<MTLRenderPipelineState> aCachedPipeline = nil;
+  if (myMeshletPipelineCache.Find(aKey, aCachedPipeline))
+  {
+    ++myNbPipelineHits;
+    thePipeline = aCachedPipeline;
+    return true;
+  }
+  if (myFailedMeshletPipelines.Contains(aKey))
+  {
+    return false;
+  }
+  ++myNbPipelineMisses;
+
+  if (@available(macOS 13.0, iOS 16.0, *))
+  {
+    @autoreleasepool
+    {
+      // reuse fragment stage and attachments of the classic pipeline; vertex_phong has mesh shader counterpart
+      MTLRenderPipelineDescriptor* aClassicDesc = createPipelineDescriptor(theModel, theBits);
+      if (aClassicDesc == nil
+      || (theBits & Metal_ProgramBits_OctNormals) != 0
+      || ![aClassicDesc.vertexFunction.name isEqualToString:@"vertex_phong"])
+      {
+        myFailedMeshletPipelines.Add(aKey);
+        return false;
+      }
+
+      if (myMeshletLibrary == nil)
+      {
+        NSError* anError = nil;
+        myMeshletLibrary = myContext->LoadShaderLibrary("Metal_ShaderManager_THE_MESHLET_SHADER_SOURCE",
+                                                        [NSString stringWithUTF8String:THE_MESHLET_SHADER_SOURCE],
+                                                        nil, &anError);
+        if (myMeshletLibrary == nil)
+        {
+          myContext->Messenger()->SendWarning() << "Metal_ShaderManager: meshlet shaders compilation failed: "
+                                                << (anError != nil ? [[anError localizedDescription] UTF8String] : "");
+          myFailedMeshletPipelines.Add(aKey);
+          return false;
+        }
+      }
+
+      MTLMeshRenderPipelineDescriptor* aMeshDesc = [[MTLMeshRenderPipelineDescriptor alloc] init];
+      aMeshDesc.objectFunction   = [myMeshletLibrary newFunctionWithName:@"object_meshlet_cull"];
+      aMeshDesc.meshFunction     = [myMeshletLibrary newFunctionWithName:@"mesh_meshlet_phong"];
+      aMeshDesc.fragmentFunction = aClassicDesc.fragmentFunction;
+      aMeshDesc.maxTotalThreadsPerObjectThreadgroup = Metal_MeshletBuffer::ObjectGroupSize;
+      aMeshDesc.maxTotalThreadsPerMeshThreadgroup   = Metal_MeshletBuffer::MeshGroupSize;
+      aMeshDesc.payloadMemoryLength = sizeof(uint32_t) * Metal_MeshletBuffer::ObjectGroupSize;
+      aMeshDesc.colorAttachments[0] = aClassicDesc.colorAttachments[0];
+      aMeshDesc.depthAttachmentPixelFormat = aClassicDesc.depthAttachmentPixelFormat;
+
+      NSError* anError = nil;
+      thePipeline = [myContext->Device() newRenderPipelineStateWithMeshDescriptor:aMeshDesc
+                                                                          options:MTLPipelineOptionNone
+                                                                       reflection:nil
+                                                                            error:&anError];
+      if (thePipeline == nil)
+      {
+        myContext->Messenger()->SendWarning() << "Metal_ShaderManager: meshlet pipeline creation failed: "
+                                              << (anError != nil ? [[anError localizedDescription] UTF8String] : "");
+        myFailedMeshletPipelines.Add(aKey);
+        return false;
+      }
+
+      myMeshletPipelineCache.Bind(aKey, thePipeline);
+      return true;
+    }
+  }
+  return false;
+}
+
+// =======================================================================
+// function : GetBSplineProgram
+// purpose  : Get or create tessellation pipeline of B-spline surfaces
+// =======================================================================
+bool Metal_ShaderManager::GetBSplineProgram(Graphic3d_TypeOfShadingModel theModel,
+                                            int theBits,
+                                            __strong id<MTLRenderPipelineState>& thePipeline)
+{
+  if (myContext == nullptr)
+  {
+    return false;
+  }
+
+  std::lock_guard<std::mutex> aLock(myProgramMutex);
+  theBits = PipelineBits(theBits);
+  const Metal_ShaderProgramKey aKey(theModel, theBits);
+  __strong id<MTLRenderPipelineState> aCachedPipeline = nil;
+  if (myBSplinePipelineCache.Find(aKey, aCachedPipeline))
+  {
+    ++myNbPipelineHits;
+    thePipeline = aCachedPipeline;
+    return true;
+  }
+  if (myFailedBSplinePipelines.Contains(aKey))
+  {
+    return false;
+  }
+  ++myNbPipelineMisses;
+
+  @autoreleasepool
+  {
+    // surface normals are evaluated analytically - configurations without nodal normals are drawn with Phong fragment stage
+    MTLRenderPipelineDescriptor* aDesc = createPipelineDescriptor(theModel, theBits);
+    if (aDesc == nil
+    || ![aDesc.vertexFunction.name isEqualToString:@"vertex_phong"])
+    {
+      aDesc = createPipelineDescriptor(Graphic3d_TypeOfShadingModel_Phong, theBits);
+    }
+    if (aDesc == nil
+    || ![aDesc.vertexFunction.name isEqualToString:@"vertex_phong"])
+    {
+      myFailedBSplinePipelines.Add(aKey);
+      return false;
+    }
+
+    if (myBSplineLibrary == nil)
+    {
+      NSError* anError = nil;
+      myBSplineLibrary = myContext->LoadShaderLibrary("Metal_ShaderManager_THE_BSPLINE_SHADER_SOURCE",
+                                                      [NSString stringWithUTF8String:THE_BSPLINE_SHADER_SOURCE],
+                                                      nil, &anError);
+      if (myBSplineLibrary == nil)
+      {
+        myContext->Messenger()->SendWarning() << "Metal_ShaderManager: B-spline shaders compilation failed: "
+                                              << (anError != nil ? [[anError localizedDescription] UTF8String] : "");
+        myFailedBSplinePipelines.Add(aKey);
+        return false;
+      }
+    }
+
+    aDesc.vertexFunction   = [myBSplineLibrary newFunctionWithName:@"vertex_bspline_patch"];
+    aDesc.vertexDescriptor = nil;
+    aDesc.maxTessellationFactor = 64;
+    aDesc.tessellationFactorFormat = MTLTessellationFactorFormatHalf;
+    aDesc.tessellationFactorStepFunction = MTLTessellationFactorStepFunctionPerPatch;
+    aDesc.tessellationPartitionMode = MTLTessellationPartitionModeFractionalEven;
+    aDesc.tessellationOutputWindingOrder = MTLWindingCounterClockwise;
+    aDesc.tessellationControlPointIndexType = MTLTessellationControlPointIndexTypeNone;
+    aDesc.supportIndirectCommandBuffers = NO;
+
+    NSError* anError = nil;
+    thePipeline = [myContext->Device() newRenderPipelineStateWithDescriptor:aDesc error:&anError];
+    if (thePipeline == nil)
+    {
+      myContext->Messenger()->SendWarning() << "Metal_ShaderManager: B-spline pipeline creation failed: "
+                                            << (anError != nil ? [[anError localizedDescription] UTF8String] : "");
+      myFailedBSplinePipelines.Add(aKey);
+      return false;
+    }
+
+    myBSplinePipelineCache.Bind(aKey, thePipeline);
+    return true;
+  }
+}
+
+// =======================================================================
+// function : GetPointCloudProgram
+// purpose  : Get or create point pipeline of point cloud slots
+// =======================================================================
+bool Metal_ShaderManager::GetPointCloudProgram(int theBits,
+                                               __strong id<MTLRenderPipelineState>& thePipeline)
+{
+  if (myContext == nullptr)
+  {
+    return false;
+  }
+
+  std::lock_guard<std::mutex> aLock(myProgramMutex);
+  theBits = PipelineBits(theBits);
+  const Metal_ShaderProgramKey aKey(Graphic3d_TypeOfShadingModel_Unlit, theBits);
+  __strong id<MTLRenderPipelineState> aCachedPipeline = nil;
+  if (myPointCloudPipelineCache.Find(aKey, aCachedPipeline))
+  {
+    ++myNbPipelineHits;
+    thePipeline = aCachedPipeline;
+    return true;
+  }
+  if (myFailedPointCloudPipelines.Contains(aKey))
+  {
+    return false;
+  }
+  ++myNbPipelineMisses;
+
+  @autoreleasepool
+  {
+    MTLRenderPipelineDescriptor* aDesc = createPipelineDescriptor(Graphic3d_TypeOfShadingModel_Unlit, theBits);
+    if (aDesc == nil
+    || ![aDesc.vertexFunction.name isEqualToString:@"vertex_unlit"])
+    {
+      myFailedPointCloudPipelines.Add(aKey);
+      return false;
+    }
+
+    if (myPointCloudLibrary == nil)
+    {
+      NSError* anError = nil;
+      myPointCloudLibrary = myContext->LoadShaderLibrary("Metal_ShaderManager_THE_POINT_CLOUD_SHADER_SOURCE",
+                                                         [NSString stringWithUTF8String:THE_POINT_CLOUD_SHADER_SOURCE],
+                                                         nil, &anError);
+      if (myPointCloudLibrary == nil)
+      {
+        myContext->Messenger()->SendWarning() << "Metal_ShaderManager: point cloud shaders compilation failed: "
+                                              << (anError != nil ? [[anError localizedDescription] UTF8String] : "");
+        myFailedPointCloudPipelines.Add(aKey);
+        return false;
+      }
+    }
+
+    aDesc.vertexFunction   = [myPointCloudLibrary newFunctionWithName:@"vertex_point_cloud"];
+    aDesc.vertexDescriptor = nil;
+    aDesc.inputPrimitiveTopology = MTLPrimitiveTopologyClassPoint;
+    aDesc.supportIndirectCommandBuffers = NO;
+
+    NSError* anError = nil;
+    thePipeline = [myContext->Device() newRenderPipelineStateWithDescriptor:aDesc error:&anError];
+    if (thePipeline == nil)
+    {
+      myContext->Messenger()->SendWarning() << "Metal_ShaderManager: point cloud pipeline creation failed: "
+                                            << (anError != nil ? [[anError localizedDescription] UTF8String] : "");
+      myFailedPointCloudPipelines.Add(aKey);
+      return false;
+    }
+
+    myPointCloudPipelineCache.Bind(aKey, thePipeline);
+    return true;
+  }
+}
+
+// =======================================================================
+// function : GetWideLineProgram
+// purpose  : Get or create pipeline of wide line segments
+// =======================================================================
+bool Metal_ShaderManager::GetWideLineProgram(int theBits,
+                                             __strong id<MTLRenderPipelineState>& thePipeline)
+{
+  if (myContext == nullptr)
+  {
+    return false;
+  }
+
+  std::lock_guard<std::mutex> aLock(myProgramMutex);
+  const Metal_ShaderProgramKey aKey(Graphic3d_TypeOfShadingModel_Unlit, theBits);
+  __strong id<MTLRenderPipelineState> aCachedPipeline = nil;
+  if (myWideLinePipelineCache.Find(aKey, aCachedPipeline))
+  {
+    ++myNbPipelineHits;
+    thePipeline = aCachedPipeline;
+    return true;
+  }
+  if (myFailedWideLinePipelines.Contains(aKey))
+  {
+    return false;
+  }
+  ++myNbPipelineMisses;
+
+  @autoreleasepool
+  {
+    // attachments and blending of unlit configuration
+    MTLRenderPipelineDescriptor* aDesc = createPipelineDescriptor(Graphic3d_TypeOfShadingModel_Unlit, 0);
+    if (aDesc == nil)
+    {
+      myFailedWideLinePipelines.Add(aKey);
+      return false;
+    }
+
+    if (myWideLineLibrary == nil)
+    {
+      NSError* anError = nil;
+      myWideLineLibrary = myContext->LoadShaderLibrary("Metal_ShaderManager_THE_WIDE_LINE_SHADER_SOURCE",
+                                                       [NSString stringWithUTF8String:THE_WIDE_LINE_SHADER_SOURCE],
+                                                       nil, &anError);
+      if (myWideLineLibrary == nil)
+      {
+        myContext->Messenger()->SendWarning() << "Metal_ShaderManager: wide line shaders compilation failed: "
+                                              << (anError != nil ? [[anError localizedDescription] UTF8String] : "");
+        myFailedWideLinePipelines.Add(aKey);
+        return false;
+      }
+    }
+
+    const bool hasClipping = (theBits & Graphic3d_ShaderFlags_ClipPlanesN) != 0;
+    aDesc.vertexFunction   = [myWideLineLibrary newFunctionWithName:@"vertex_wide_line"];
+    aDesc.fragmentFunction = [myWideLineLibrary newFunctionWithName:(hasClipping ? @"fragment_wide_line_clip"
+                                                                                 : @"fragment_wide_line")];
+    aDesc.vertexDescriptor = nil;
+    aDesc.inputPrimitiveTopology = MTLPrimitiveTopologyClassTriangle;
+    aDesc.supportIndirectCommandBuffers = NO;
+
+    NSError* anError = nil;
+    thePipeline = [myContext->Device() newRenderPipelineStateWithDescriptor:aDesc error:&anError];
+    if (thePipeline == nil)
+    {
+      myContext->Messenger()->SendWarning() << "Metal_ShaderManager: wide line pipeline creation failed: "
+                                            << (anError != nil ? [[anError localizedDescription] UTF8String] : "");
+      myFailedWideLinePipelines.Add(aKey);
+      return false;
+    }
+
+    myWideLinePipelineCache.Bind(aKey, thePipeline);
+    return true;
   }
-
-  myClipPlaneUniforms.PlaneCount = aPlaneIndex;
 }
 
 // =======================================================================
-// function : GetProgram
-// purpose  : Get or create shader program
+// function : createPipelineDescriptor
+// purpose  : Create pipeline descriptor for given configuration
 // =======================================================================
-bool Metal_ShaderManager::GetProgram(Graphic3d_TypeOfShadingModel theModel,
-                                      int theBits,
-                                      __strong id<MTLRenderPipelineState>& thePipeline,
-                                      __strong id<MTLDepthStencilState>& theDepthStencil)
+MTLRenderPipelineDescriptor* Metal_ShaderManager::createPipelineDescriptor(Graphic3d_TypeOfShadingModel theModel,
+                                                                           int theBits)
 {
-  Metal_ShaderProgramKey aKey(theModel, theBits);
+  if (myContext == nullptr)
+  {
+    NSLog(@"Metal_ShaderManager::createPipeline: context is nil");
+    return nil;
+  }
+  if (myShaderLibrary == nil)
+  {
+    NSLog(@"Metal_ShaderManager::createPipeline: shader library is nil");
+    myContext->Messenger()->SendFail() << "Metal_ShaderManager::createPipeline: shader library is nil";
+    return nil;
+  }
 
-  // Use local __strong variables for ARC compatibility with NCollection_DataMap::Find
-  __strong id<MTLRenderPipelineState> aCachedPipeline = nil;
-  __strong id<MTLDepthStencilState> aCachedDepthStencil = nil;
+  // Determine vertex and fragment function names based on shading model
+  NSString* aVertexFunc = nil;
+  NSString* aFragmentFunc = nil;
 
-  // Check cache first
-  if (myPipelineCache.Find(aKey, aCachedPipeline))
+  const bool hasHatch = (theBits & Graphic3d_ShaderFlags_HatchPattern) != 0;
+  const bool hasStipple = (theBits & Graphic3d_ShaderFlags_StippleLine) != 0;
+
+  // Handle line stipple patterns
+  if (hasStipple)
   {
-    thePipeline = aCachedPipeline;
-    // Get depth-stencil state (same for all pipelines for now)
-    if (!myDepthStencilCache.Find(0, aCachedDepthStencil))
-    {
-      myContext->Messenger()->SendInfo() << "Metal_ShaderManager::GetProgram: depth-stencil not found in cache";
-      return false;
-    }
-    theDepthStencil = aCachedDepthStencil;
-    return true;
+    aVertexFunc = @"vertex_line_stipple_simple";
+    aFragmentFunc = @"fragment_line_stipple";
   }
-
-  // Create new pipeline
-  myContext->Messenger()->SendInfo() << "Metal_ShaderManager::GetProgram: creating new pipeline for model " << (int)theModel << " bits " << theBits;
-  bool aResult = createPipeline(theModel, theBits, thePipeline, theDepthStencil);
-  if (aResult)
+  // Handle hatch patterns
+  else if (hasHatch)
   {
-    myContext->Messenger()->SendInfo() << "Metal_ShaderManager::GetProgram: pipeline created successfully";
+    aVertexFunc = @"vertex_hatch";
+    aFragmentFunc = @"fragment_hatch_phong";
   }
   else
   {
-    myContext->Messenger()->SendFail() << "Metal_ShaderManager::GetProgram: pipeline creation failed";
+    switch (theModel)
+    {
+      case Graphic3d_TypeOfShadingModel_Unlit:
+        aVertexFunc = @"vertex_unlit";
+        aFragmentFunc = @"fragment_unlit";
+        break;
+      case Graphic3d_TypeOfShadingModel_Gouraud:
+        aVertexFunc = @"vertex_gouraud";
+        aFragmentFunc = @"fragment_gouraud";
+        break;
+      case Graphic3d_TypeOfShadingModel_Pbr:
+      case Graphic3d_TypeOfShadingModel_PbrFacet:
+        // PBR shading with Cook-Torrance BRDF
+        aVertexFunc = @"vertex_phong";  // reuse Phong vertex shader (provides normals and positions)
+        aFragmentFunc = @"fragment_pbr";
+        break;
+      case Graphic3d_TypeOfShadingModel_Phong:
+        // Phong shading with vertex normals
+        aVertexFunc = @"vertex_phong";
+        aFragmentFunc = @"fragment_phong_material";
+        break;
+      case Graphic3d_TypeOfShadingModel_PhongFacet:
+      default:
+        // Facet shading - no vertex normals, compute from derivatives
+        aVertexFunc = @"vertex_phong_facet";
+        aFragmentFunc = @"fragment_phong_facet_material";
+        break;
+    }
   }
-  return aResult;
-}
 
-// =======================================================================
-// function : ChooseFaceShadingModel
-// purpose  : Choose shading model for faces
-// =======================================================================
-Graphic3d_TypeOfShadingModel Metal_ShaderManager::ChooseFaceShadingModel(
-  Graphic3d_TypeOfShadingModel theCustomModel,
-  bool theHasNodalNormals) const
-{
-  Graphic3d_TypeOfShadingModel aModel =
-    (theCustomModel != Graphic3d_TypeOfShadingModel_DEFAULT) ? theCustomModel : myShadingModel;
+  // clipping and octahedral normals are specialized by function constants of the same functions
+  id<MTLFunction> aVertex = specializedFunction(aVertexFunc, theBits);
+  id<MTLFunction> aFragment = specializedFunction(aFragmentFunc, theBits);
 
-  switch (aModel)
+  if (aVertex == nil || aFragment == nil)
   {
-    case Graphic3d_TypeOfShadingModel_DEFAULT:
-    case Graphic3d_TypeOfShadingModel_Unlit:
-    case Graphic3d_TypeOfShadingModel_PhongFacet:
-      return aModel;
-    case Graphic3d_TypeOfShadingModel_Gouraud:
-    case Graphic3d_TypeOfShadingModel_Phong:
-      return theHasNodalNormals ? aModel : Graphic3d_TypeOfShadingModel_PhongFacet;
-    case Graphic3d_TypeOfShadingModel_Pbr:
-      // PBR shading with per-vertex normals
-      return theHasNodalNormals ? Graphic3d_TypeOfShadingModel_Pbr
-                                : Graphic3d_TypeOfShadingModel_PbrFacet;
-    case Graphic3d_TypeOfShadingModel_PbrFacet:
-      // PBR facet shading (no per-vertex normals required)
-      return Graphic3d_TypeOfShadingModel_PbrFacet;
+    myContext->Messenger()->SendFail() << "Metal_ShaderManager: Failed to find shader functions "
+                                       << [aVertexFunc UTF8String] << " and " << [aFragmentFunc UTF8String];
+    return nil;
   }
-  return Graphic3d_TypeOfShadingModel_Unlit;
-}
-
-// =======================================================================
-// function : ChooseLineShadingModel
-// purpose  : Choose shading model for lines
-// =======================================================================
-Graphic3d_TypeOfShadingModel Metal_ShaderManager::ChooseLineShadingModel(
-  Graphic3d_TypeOfShadingModel theCustomModel,
-  bool theHasNodalNormals) const
-{
-  Graphic3d_TypeOfShadingModel aModel =
-    (theCustomModel != Graphic3d_TypeOfShadingModel_DEFAULT) ? theCustomModel : myShadingModel;
 
-  switch (aModel)
+  // Create pipeline descriptor
+  MTLRenderPipelineDescriptor* aPipelineDesc = [[MTLRenderPipelineDescriptor alloc] init];
+  aPipelineDesc.vertexFunction = aVertex;
+  aPipelineDesc.fragmentFunction = aFragment;
+  aPipelineDesc.colorAttachments[0].pixelFormat = MTLPixelFormatBGRA8Unorm;
+  aPipelineDesc.depthAttachmentPixelFormat = MTLPixelFormatDepth32Float;
+
+  // Enable alpha blending
+  aPipelineDesc.colorAttachments[0].blendingEnabled = YES;
+  aPipelineDesc.colorAttachments[0].rgbBlendOperation = MTLBlendOperationAdd;
+  aPipelineDesc.colorAttachments[0].alphaBlendOperation = MTLBlendOperationAdd;
+  aPipelineDesc.colorAttachments[0].sourceRGBBlendFactor = MTLBlendFactorSourceAlpha;
+  aPipelineDesc.colorAttachments[0].sourceAlphaBlendFactor = MTLBlendFactorSourceAlpha;
+  aPipelineDesc.colorAttachments[0].destinationRGBBlendFactor = MTLBlendFactorOneMinusSourceAlpha;
+  aPipelineDesc.colorAttachments[0].destinationAlphaBlendFactor = MTLBlendFactorOneMinusSourceAlpha;
+
+  // allow pipeline to be referenced from indirect command buffers of static layers
+  if (myContext->Caps()->useIndirectCommandBuffers
+   && myContext->HasIndirectCommandBuffers())
   {
-    case Graphic3d_TypeOfShadingModel_DEFAULT:
-    case Graphic3d_TypeOfShadingModel_Unlit:
-    case Graphic3d_TypeOfShadingModel_PhongFacet:
-      return Graphic3d_TypeOfShadingModel_Unlit;
-    case Graphic3d_TypeOfShadingModel_Gouraud:
-    case Graphic3d_TypeOfShadingModel_Phong:
-      return theHasNodalNormals ? aModel : Graphic3d_TypeOfShadingModel_Unlit;
-    case Graphic3d_TypeOfShadingModel_Pbr:
-    case Graphic3d_TypeOfShadingModel_PbrFacet:
-      // PBR line shading - use PBR with normals, or unlit
-      return theHasNodalNormals ? Graphic3d_TypeOfShadingModel_Pbr
-                                : Graphic3d_TypeOfShadingModel_Unlit;
+    aPipelineDesc.supportIndirectCommandBuffers = YES;
   }
-  return Graphic3d_TypeOfShadingModel_Unlit;
-}
-
-// =======================================================================
-// function : PrepareFrameUniforms
-// purpose  : Prepare frame uniforms
-// =======================================================================
-void Metal_ShaderManager::PrepareFrameUniforms(Metal_FrameUniforms& theUniforms) const
-{
-  memcpy(theUniforms.ProjectionMatrix, myProjectionMatrix.GetData(), sizeof(float) * 16);
-  memcpy(theUniforms.ViewMatrix, myViewMatrix.GetData(), sizeof(float) * 16);
-  memcpy(theUniforms.ProjectionMatrixInverse, myProjectionMatrixInverse.GetData(), sizeof(float) * 16);
-
-  // View matrix inverse - compute or use identity
-  NCollection_Mat4<float> aViewInv;
-  aViewInv.InitIdentity();
-  memcpy(theUniforms.ViewMatrixInverse, aViewInv.GetData(), sizeof(float) * 16);
+  return aPipelineDesc;
 }
 
 // =======================================================================
-// function : PrepareObjectUniforms
-// purpose  : Prepare object uniforms
+// function : defaultDepthStencil
+// purpose  : Create or get depth-stencil state shared by all pipelines
 // =======================================================================
-void Metal_ShaderManager::PrepareObjectUniforms(Metal_ObjectUniforms& theUniforms) const
+id<MTLDepthStencilState> Metal_ShaderManager::defaultDepthStencil()
 {
-  memcpy(theUniforms.ModelMatrix, myModelMatrix.GetData(), sizeof(float) * 16);
-
-  // Compute ModelView
-  NCollection_Mat4<float> aModelView = myViewMatrix * myModelMatrix;
-  memcpy(theUniforms.ModelViewMatrix, aModelView.GetData(), sizeof(float) * 16);
-
-  // Extract upper-left 3x3 as normal matrix (with 4th row for padding)
-  theUniforms.NormalMatrix[0] = aModelView.GetValue(0, 0);
-  theUniforms.NormalMatrix[1] = aModelView.GetValue(0, 1);
-  theUniforms.NormalMatrix[2] = aModelView.GetValue(0, 2);
-  theUniforms.NormalMatrix[3] = 0.0f;
-  theUniforms.NormalMatrix[4] = aModelView.GetValue(1, 0);
-  theUniforms.NormalMatrix[5] = aModelView.GetValue(1, 1);
-  theUniforms.NormalMatrix[6] = aModelView.GetValue(1, 2);
-  theUniforms.NormalMatrix[7] = 0.0f;
-  theUniforms.NormalMatrix[8] = aModelView.GetValue(2, 0);
-  theUniforms.NormalMatrix[9] = aModelView.GetValue(2, 1);
-  theUniforms.NormalMatrix[10] = aModelView.GetValue(2, 2);
-  theUniforms.NormalMatrix[11] = 0.0f;
+  // Use local __strong variable for ARC compatibility with NCollection_DataMap::Find
+  __strong id<MTLDepthStencilState> aCachedDepthStencil = nil;
+  if (!myDepthStencilCache.Find(0, aCachedDepthStencil))
+  {
+    MTLDepthStencilDescriptor* aDepthDesc = [[MTLDepthStencilDescriptor alloc] init];
+    aDepthDesc.depthCompareFunction = MTLCompareFunctionLess;
+    aDepthDesc.depthWriteEnabled = YES;
 
-  memcpy(theUniforms.ObjectColor, myObjectColor, sizeof(float) * 4);
+    aCachedDepthStencil = [myContext->Device() newDepthStencilStateWithDescriptor:aDepthDesc];
+    myDepthStencilCache.Bind(0, aCachedDepthStencil);
+  }
+  return aCachedDepthStencil;
 }
 
 // =======================================================================
-// function : createShaderLibrary
-// purpose  : Create shader library with all shaders
+// function : createPipeline
+// purpose  : Create pipeline state
 // =======================================================================
-bool Metal_ShaderManager::createShaderLibrary()
+bool Metal_ShaderManager::createPipeline(Graphic3d_TypeOfShadingModel theModel,
+                                          int theBits,
+                                          __strong id<MTLRenderPipelineState>& thePipeline,
+                                          __strong id<MTLDepthStencilState>& theDepthStencil)
 {
-  if (myContext == nullptr || myContext->Device() == nil)
-  {
-    return false;
-  }
-
   @autoreleasepool
   {
-    NSString* aShaderSource = @(generateShaderSource().ToCString());
+    MTLRenderPipelineDescriptor* aPipelineDesc = createPipelineDescriptor(theModel, theBits);
+    if (aPipelineDesc == nil)
+    {
+      return false;
+    }
 
     NSError* anError = nil;
-    MTLCompileOptions* anOptions = [[MTLCompileOptions alloc] init];
-    if (@available(macOS 15.0, iOS 18.0, *))
+    Metal_ShaderProgramKey aKey(theModel, theBits);
+    if (!myPipelineArchive.IsNull())
     {
-      anOptions.mathMode = MTLMathModeFast;
+      thePipeline = myPipelineArchive->CreatePipeline(myContext, aPipelineDesc, aKey, &anError);
     }
     else
     {
-#pragma clang diagnostic push
-#pragma clang diagnostic ignored "-Wdeprecated-declarations"
-      anOptions.fastMathEnabled = YES;
-#pragma clang diagnostic pop
+      thePipeline = [myContext->Device() newRenderPipelineStateWithDescriptor:aPipelineDesc
+                                                                        error:&anError];
     }
-
-    myShaderLibrary = [myContext->Device() newLibraryWithSource:aShaderSource
-                                                        options:anOptions
-                                                          error:&anError];
-    if (myShaderLibrary == nil)
+    if (thePipeline == nil)
     {
       if (anError != nil)
       {
-        myContext->Messenger()->SendFail() << "Metal_ShaderManager: Shader compilation failed: "
+        myContext->Messenger()->SendFail() << "Metal_ShaderManager: Pipeline creation failed: "
                                            << [[anError localizedDescription] UTF8String];
       }
       return false;
     }
 
-    myContext->Messenger()->SendInfo() << "Metal_ShaderManager: Shader library created successfully";
+    theDepthStencil = defaultDepthStencil();
+
+    // Cache the pipeline
+    myPipelineCache.Bind(aKey, thePipeline);
+
     return true;
   }
 }
 
 // =======================================================================
-// function : createPipeline
-// purpose  : Create pipeline state
+// function : createPipelineAsync
+// purpose  : Start asynchronous pipeline compilation
 // =======================================================================
-bool Metal_ShaderManager::createPipeline(Graphic3d_TypeOfShadingModel theModel,
-                                          int theBits,
-                                          __strong id<MTLRenderPipelineState>& thePipeline,
-                                          __strong id<MTLDepthStencilState>& theDepthStencil)
+bool Metal_ShaderManager::createPipelineAsync(Graphic3d_TypeOfShadingModel theModel,
+                                               int theBits)
 {
-  if (myContext == nullptr)
-  {
-    NSLog(@"Metal_ShaderManager::createPipeline: context is nil");
-    return false;
-  }
-  if (myShaderLibrary == nil)
+  const Metal_ShaderProgramKey aKey(theModel, theBits);
+  if (myPendingPipelines.Contains(aKey))
   {
-    NSLog(@"Metal_ShaderManager::createPipeline: shader library is nil");
-    myContext->Messenger()->SendFail() << "Metal_ShaderManager::createPipeline: shader library is nil";
-    return false;
+    return true;
   }
 
   @autoreleasepool
   {
-    // Determine vertex and fragment function names based on shading model
-    NSString* aVertexFunc = nil;
-    NSString* aFragmentFunc = nil;
-
-    const bool hasClipping = (theBits & Graphic3d_ShaderFlags_ClipPlanesN) != 0
-                          || (theBits & Graphic3d_ShaderFlags_ClipPlanes1) != 0
-                          || (theBits & Graphic3d_ShaderFlags_ClipPlanes2) != 0;
-    const bool hasHatch = (theBits & Graphic3d_ShaderFlags_HatchPattern) != 0;
-    const bool hasStipple = (theBits & Graphic3d_ShaderFlags_StippleLine) != 0;
-
-    // Handle line stipple patterns
-    if (hasStipple)
-    {
-      aVertexFunc = @"vertex_line_stipple_simple";
-      aFragmentFunc = hasClipping ? @"fragment_line_stipple_clip" : @"fragment_line_stipple";
-    }
-    // Handle hatch patterns
-    else if (hasHatch)
+    MTLRenderPipelineDescriptor* aPipelineDesc = createPipelineDescriptor(theModel, theBits);
+    if (aPipelineDesc == nil)
     {
-      aVertexFunc = @"vertex_hatch";
-      if (hasClipping)
-      {
-        aFragmentFunc = @"fragment_hatch_phong_clip";
-      }
-      else
-      {
-        aFragmentFunc = @"fragment_hatch_phong";
-      }
+      return false;
     }
-    else
+
+    // the handler is called on a Metal internal thread - only push the result into the queue,
+    // it will be moved into pipeline cache by the rendering thread within fetchAsyncPipelines()
+    NSMutableArray* aResults = myAsyncResults;
+    NSArray* aKeyInfo = @[@((int)theModel), @(theBits)];
+    [myContext->Device() newRenderPipelineStateWithDescriptor:aPipelineDesc
+                                            completionHandler:^(id<MTLRenderPipelineState> thePso, NSError* theError)
     {
-      switch (theModel)
+      NSString* anErrorDesc = theError != nil ? [theError localizedDescription] : @"";
+      @synchronized (aResults)
       {
-        case Graphic3d_TypeOfShadingModel_Unlit:
-          aVertexFunc = @"vertex_unlit";
-          aFragmentFunc = hasClipping ? @"fragment_unlit_clip" : @"fragment_unlit";
-          break;
-        case Graphic3d_TypeOfShadingModel_Gouraud:
-          aVertexFunc = @"vertex_gouraud";
-          aFragmentFunc = hasClipping ? @"fragment_gouraud_clip" : @"fragment_gouraud";
-          break;
-        case Graphic3d_TypeOfShadingModel_Pbr:
-        case Graphic3d_TypeOfShadingModel_PbrFacet:
-          // PBR shading with Cook-Torrance BRDF
-          aVertexFunc = @"vertex_phong";  // reuse Phong vertex shader (provides normals and positions)
-          aFragmentFunc = hasClipping ? @"fragment_pbr_clip" : @"fragment_pbr";
-          break;
-        case Graphic3d_TypeOfShadingModel_Phong:
-          // Phong shading with vertex normals
-          aVertexFunc = @"vertex_phong";
-          aFragmentFunc = hasClipping ? @"fragment_phong_material_clip" : @"fragment_phong_material";
-          break;
-        case Graphic3d_TypeOfShadingModel_PhongFacet:
-        default:
-          // Facet shading - no vertex normals, compute from derivatives
-          aVertexFunc = @"vertex_phong_facet";
-          aFragmentFunc = hasClipping ? @"fragment_phong_facet_material_clip" : @"fragment_phong_facet_material";
-          break;
+        [aResults addObject:@[aKeyInfo, thePso != nil ? (id)thePso : (id)[NSNull null], anErrorDesc]];
       }
-    }
+    }];
+    myPendingPipelines.Add(aKey);
+  }
+  return true;
+}
 
-    NSLog(@"Metal_ShaderManager::createPipeline: looking for vertex=%@ fragment=%@", aVertexFunc, aFragmentFunc);
-    id<MTLFunction> aVertex = [myShaderLibrary newFunctionWithName:aVertexFunc];
-    id<MTLFunction> aFragment = [myShaderLibrary newFunctionWithName:aFragmentFunc];
+// =======================================================================
+// function : fetchAsyncPipelines
+// purpose  : Move asynchronously compiled pipelines into the cache
+// =======================================================================
+void Metal_ShaderManager::fetchAsyncPipelines()
+{
+  if (myPendingPipelines.IsEmpty())
+  {
+    return;
+  }
 
-    if (aVertex == nil || aFragment == nil)
+  NSArray* aResults = nil;
+  @synchronized (myAsyncResults)
+  {
+    if ([myAsyncResults count] == 0)
     {
-      NSLog(@"Metal_ShaderManager::createPipeline: vertex=%p fragment=%p", aVertex, aFragment);
-      myContext->Messenger()->SendFail() << "Metal_ShaderManager: Failed to find shader functions";
-      return false;
+      return;
     }
-    NSLog(@"Metal_ShaderManager::createPipeline: functions found, creating pipeline");
-
-    // Create pipeline descriptor
-    MTLRenderPipelineDescriptor* aPipelineDesc = [[MTLRenderPipelineDescriptor alloc] init];
-    aPipelineDesc.vertexFunction = aVertex;
-    aPipelineDesc.fragmentFunction = aFragment;
-    aPipelineDesc.colorAttachments[0].pixelFormat = MTLPixelFormatBGRA8Unorm;
-    aPipelineDesc.depthAttachmentPixelFormat = MTLPixelFormatDepth32Float;
-
-    // Enable alpha blending
-    aPipelineDesc.colorAttachments[0].blendingEnabled = YES;
-    aPipelineDesc.colorAttachments[0].rgbBlendOperation = MTLBlendOperationAdd;
-    aPipelineDesc.colorAttachments[0].alphaBlendOperation = MTLBlendOperationAdd;
-    aPipelineDesc.colorAttachments[0].sourceRGBBlendFactor = MTLBlendFactorSourceAlpha;
-    aPipelineDesc.colorAttachments[0].sourceAlphaBlendFactor = MTLBlendFactorSourceAlpha;
-    aPipelineDesc.colorAttachments[0].destinationRGBBlendFactor = MTLBlendFactorOneMinusSourceAlpha;
-    aPipelineDesc.colorAttachments[0].destinationAlphaBlendFactor = MTLBlendFactorOneMinusSourceAlpha;
+    aResults = [myAsyncResults copy];
+    [myAsyncResults removeAllObjects];
+  }
 
-    NSError* anError = nil;
-    thePipeline = [myContext->Device() newRenderPipelineStateWithDescriptor:aPipelineDesc
-                                                                      error:&anError];
-    if (thePipeline == nil)
+  for (NSArray* aResult in aResults)
+  {
+    NSArray* aKeyInfo = aResult[0];
+    const Metal_ShaderProgramKey aKey((Graphic3d_TypeOfShadingModel)[aKeyInfo[0] intValue],
+                                      [aKeyInfo[1] intValue]);
+    myPendingPipelines.Remove(aKey);
+    if (aResult[1] == [NSNull null])
     {
-      if (anError != nil)
-      {
-        myContext->Messenger()->SendFail() << "Metal_ShaderManager: Pipeline creation failed: "
-                                           << [[anError localizedDescription] UTF8String];
-      }
-      return false;
+      // do not retry asynchronous compilation - next request will report the error synchronously
+      myContext->Messenger()->SendFail() << "Metal_ShaderManager: Pipeline creation failed: "
+                                         << [(NSString*)aResult[2] UTF8String];
+      myFailedPipelines.Add(aKey);
+      continue;
     }
 
-    // Create or get depth-stencil state
-    // Use local __strong variable for ARC compatibility with NCollection_DataMap::Find
-    __strong id<MTLDepthStencilState> aCachedDepthStencil = nil;
-    if (!myDepthStencilCache.Find(0, aCachedDepthStencil))
-    {
-      MTLDepthStencilDescriptor* aDepthDesc = [[MTLDepthStencilDescriptor alloc] init];
-      aDepthDesc.depthCompareFunction = MTLCompareFunctionLess;
-      aDepthDesc.depthWriteEnabled = YES;
+    myPipelineCache.Bind(aKey, (id<MTLRenderPipelineState>)aResult[1]);
+  }
+  ++myProgramsRevision;
+}
 
-      theDepthStencil = [myContext->Device() newDepthStencilStateWithDescriptor:aDepthDesc];
-      myDepthStencilCache.Bind(0, theDepthStencil);
-    }
-    else
+// =======================================================================
+// function : fallbackProgram
+// purpose  : Return pipeline to be used while actual one is compiled
+// =======================================================================
+bool Metal_ShaderManager::fallbackProgram(Graphic3d_TypeOfShadingModel theModel,
+                                           int theBits,
+                                           __strong id<MTLRenderPipelineState>& thePipeline,
+                                           __strong id<MTLDepthStencilState>& theDepthStencil)
+{
+  // clipping should be preserved to keep result visually correct,
+  // while other optional features (hatching, stipple) can be dropped within a few frames;
+  // octahedral normals define layout of vertex data and cannot be dropped for the same model
+  const int aClipBits = theBits & Graphic3d_ShaderFlags_ClipPlanesN;
+  const Metal_ShaderProgramKey aCandidates[2] =
+  {
+    Metal_ShaderProgramKey(theModel, aClipBits | (theBits & Metal_ProgramBits_OctNormals)),
+    Metal_ShaderProgramKey(Graphic3d_TypeOfShadingModel_Unlit, aClipBits)
+  };
+
+  __strong id<MTLRenderPipelineState> aCachedPipeline = nil;
+  for (const Metal_ShaderProgramKey& aCandidate : aCandidates)
+  {
+    if (myPipelineCache.Find(aCandidate, aCachedPipeline))
     {
-      theDepthStencil = aCachedDepthStencil;
+      thePipeline = aCachedPipeline;
+      theDepthStencil = defaultDepthStencil();
+      return true;
     }
-
-    // Cache the pipeline
-    Metal_ShaderProgramKey aKey(theModel, theBits);
-    myPipelineCache.Bind(aKey, thePipeline);
-
-    return true;
   }
+
+  // unlit program is cheap enough to be compiled synchronously
+  return createPipeline(Graphic3d_TypeOfShadingModel_Unlit, aClipBits, thePipeline, theDepthStencil);
 }
 
 // =======================================================================
@@ -684,1687 +3470,5 @@ bool Metal_ShaderManager::createPipeline(Graphic3d_TypeOfShadingModel theModel,
 // =======================================================================
 TCollection_AsciiString Metal_ShaderManager::generateShaderSource() const
 {
-  TCollection_AsciiString aSource;
-
-  aSource +=
-    "#include <metal_stdlib>\n"
-    "#include <simd/simd.h>\n"
-    "using namespace metal;\n"
-    "\n"
-    "// Maximum number of lights\n"
-    "#define MAX_LIGHTS 8\n"
-    "#define MAX_CLIP_PLANES 8\n"
-    "\n"
-    "// Light types\n"
-    "#define LIGHT_TYPE_DIRECTIONAL 0\n"
-    "#define LIGHT_TYPE_POSITIONAL  1\n"
-    "#define LIGHT_TYPE_SPOT        2\n"
-    "\n"
-    "// Light source structure\n"
-    "struct LightSource {\n"
-    "  float4 Color;      // RGB + intensity\n"
-    "  float4 Position;   // XYZ + isHeadlight\n"
-    "  float4 Direction;  // spot direction + range\n"
-    "  float4 Parameters; // cos(cutoff), exponent, type, enabled\n"
-    "};\n"
-    "\n"
-    "// Legacy material structure\n"
-    "struct Material {\n"
-    "  float4 Ambient;\n"
-    "  float4 Diffuse;\n"
-    "  float4 Specular;\n"
-    "  float4 Emissive;\n"
-    "  float Shininess;\n"
-    "  float Transparency;\n"
-    "  float2 padding;\n"
-    "};\n"
-    "\n"
-    "// Common (Phong/Blinn) material - matches Metal_ShaderMaterialCommon\n"
-    "struct MaterialCommon {\n"
-    "  float4 Diffuse;           // RGB + alpha\n"
-    "  float4 Emission;          // RGB + padding\n"
-    "  float4 SpecularShininess; // RGB + shininess\n"
-    "  float4 Ambient;           // RGB + padding\n"
-    "};\n"
-    "\n"
-    "// PBR material - matches Metal_ShaderMaterialPBR\n"
-    "struct MaterialPBR {\n"
-    "  float4 BaseColor;    // RGB + alpha\n"
-    "  float4 EmissionIOR;  // RGB + IOR\n"
-    "  float4 Params;       // occlusion, roughness, metallic, padding\n"
-    "};\n"
-    "\n"
-    "// Comprehensive material uniforms - matches Metal_MaterialUniforms\n"
-    "struct MaterialUniforms {\n"
-    "  MaterialCommon FrontCommon;\n"
-    "  MaterialCommon BackCommon;\n"
-    "  MaterialPBR FrontPBR;\n"
-    "  MaterialPBR BackPBR;\n"
-    "  int IsPBR;\n"
-    "  int ToDistinguish;\n"
-    "  float AlphaCutoff;\n"
-    "  float Padding;\n"
-    "};\n"
-    "\n"
-    "// Frame uniforms (per-frame data)\n"
-    "struct FrameUniforms {\n"
-    "  float4x4 ProjectionMatrix;\n"
-    "  float4x4 ViewMatrix;\n"
-    "  float4x4 ProjectionMatrixInverse;\n"
-    "  float4x4 ViewMatrixInverse;\n"
-    "};\n"
-    "\n"
-    "// Object uniforms (per-object data)\n"
-    "struct ObjectUniforms {\n"
-    "  float4x4 ModelMatrix;\n"
-    "  float4x4 ModelViewMatrix;\n"
-    "  float3x4 NormalMatrix;\n"
-    "  float4 ObjectColor;\n"
-    "};\n"
-    "\n"
-    "// Lighting uniforms\n"
-    "// Must match Metal_LightUniforms C++ struct exactly (560 bytes total)\n"
-    "struct LightUniforms {\n"
-    "  LightSource Lights[MAX_LIGHTS];  // 8 * 64 = 512 bytes\n"
-    "  float4 AmbientColor;              // 16 bytes (offset 512)\n"
-    "  int LightCount;                   // 4 bytes (offset 528)\n"
-    "  int padding0;                     // 4 bytes (offset 532)\n"
-    "  int padding1;                     // 4 bytes (offset 536)\n"
-    "  int padding2;                     // 4 bytes (offset 540)\n"
-    "  int padding3;                     // 4 bytes (offset 544)\n"
-    "  int padding4;                     // 4 bytes (offset 548)\n"
-    "  int padding5;                     // 4 bytes (offset 552)\n"
-    "  int padding6;                     // 4 bytes (offset 556) -> total 560\n"
-    "};\n"
-    "\n"
-    "// Clipping uniforms\n"
-    "struct ClipUniforms {\n"
-    "  float4 Planes[MAX_CLIP_PLANES];\n"
-    "  int PlaneCount;\n"
-    "  int3 padding;\n"
-    "};\n"
-    "\n"
-    "// Legacy uniforms for simple shaders\n"
-    "struct Uniforms {\n"
-    "  float4x4 modelViewMatrix;\n"
-    "  float4x4 projectionMatrix;\n"
-    "  float4 color;\n"
-    "};\n"
-    "\n"
-    "// ======== VERTEX OUTPUT STRUCTURES ========\n"
-    "\n"
-    "struct VertexOutUnlit {\n"
-    "  float4 position [[position]];\n"
-    "  float4 color;\n"
-    "  float3 worldPosition;\n"
-    "};\n"
-    "\n"
-    "struct VertexOutGouraud {\n"
-    "  float4 position [[position]];\n"
-    "  float4 color;\n"
-    "  float3 worldPosition;\n"
-    "};\n"
-    "\n"
-    "struct VertexOutPhong {\n"
-    "  float4 position [[position]];\n"
-    "  float3 normal;\n"
-    "  float3 viewPosition;\n"
-    "  float4 color;\n"
-    "  float3 worldPosition;\n"
-    "};\n"
-    "\n"
-    "// ======== HELPER FUNCTIONS ========\n"
-    "\n"
-    "// Compute Phong lighting for a single light\n"
-    "// Light positions/directions are in world space, must be transformed to view space\n"
-    "float3 computePhongLight(LightSource light, float3 N, float3 V, float3 fragPos,\n"
-    "                         float3 diffuseColor, float3 specularColor, float shininess,\n"
-    "                         float4x4 modelViewMatrix) {\n"
-    "  if (light.Parameters.w < 0.5) return float3(0.0); // disabled\n"
-    "  \n"
-    "  int lightType = int(light.Parameters.z);\n"
-    "  float3 lightColor = light.Color.rgb * light.Color.w; // color * intensity\n"
-    "  float3 L;\n"
-    "  float attenuation = 1.0;\n"
-    "  \n"
-    "  if (lightType == LIGHT_TYPE_DIRECTIONAL) {\n"
-    "    // Transform light direction from world space to view space\n"
-    "    float3 worldLightDir = -light.Position.xyz;\n"
-    "    L = normalize((modelViewMatrix * float4(worldLightDir, 0.0)).xyz);\n"
-    "  } else {\n"
-    "    // Transform light position from world space to view space\n"
-    "    float3 viewLightPos = (modelViewMatrix * float4(light.Position.xyz, 1.0)).xyz;\n"
-    "    float3 lightVec = viewLightPos - fragPos;\n"
-    "    float dist = length(lightVec);\n"
-    "    L = lightVec / dist;\n"
-    "    \n"
-    "    // Range attenuation\n"
-    "    float range = light.Direction.w;\n"
-    "    if (range > 0.0) {\n"
-    "      attenuation = saturate(1.0 - dist / range);\n"
-    "    }\n"
-    "    \n"
-    "    // Spot light\n"
-    "    if (lightType == LIGHT_TYPE_SPOT) {\n"
-    "      // Transform spot direction to view space\n"
-    "      float3 worldSpotDir = -light.Direction.xyz;\n"
-    "      float3 spotDir = normalize((modelViewMatrix * float4(worldSpotDir, 0.0)).xyz);\n"
-    "      float cosAngle = dot(L, spotDir);\n"
-    "      float cosCutoff = light.Parameters.x;\n"
-    "      if (cosAngle < cosCutoff) {\n"
-    "        attenuation = 0.0;\n"
-    "      } else {\n"
-    "        float spotExponent = light.Parameters.y;\n"
-    "        attenuation *= pow(cosAngle, spotExponent);\n"
-    "      }\n"
-    "    }\n"
-    "  }\n"
-    "  \n"
-    "  // Diffuse\n"
-    "  float NdotL = max(dot(N, L), 0.0);\n"
-    "  float3 diffuse = diffuseColor * lightColor * NdotL;\n"
-    "  \n"
-    "  // Specular (Blinn-Phong)\n"
-    "  float3 H = normalize(L + V);\n"
-    "  float NdotH = max(dot(N, H), 0.0);\n"
-    "  float3 specular = specularColor * lightColor * pow(NdotH, shininess);\n"
-    "  \n"
-    "  return (diffuse + specular) * attenuation;\n"
-    "}\n"
-    "\n"
-    "// Check if fragment should be clipped\n"
-    "bool isClipped(float3 worldPos, constant ClipUniforms& clip) {\n"
-    "  for (int i = 0; i < clip.PlaneCount; i++) {\n"
-    "    float4 plane = clip.Planes[i];\n"
-    "    float dist = dot(float4(worldPos, 1.0), plane);\n"
-    "    if (dist < 0.0) return true;\n"
-    "  }\n"
-    "  return false;\n"
-    "}\n"
-    "\n"
-    "// ======== UNLIT SHADERS ========\n"
-    "\n"
-    "vertex VertexOutUnlit vertex_unlit(\n"
-    "  const device packed_float3* positions [[buffer(0)]],\n"
-    "  constant Uniforms& uniforms    [[buffer(1)]],\n"
-    "  uint vid                       [[vertex_id]])\n"
-    "{\n"
-    "  VertexOutUnlit out;\n"
-    "  float3 pos = float3(positions[vid]);\n"
-    "  float4 worldPos = float4(pos, 1.0);\n"
-    "  float4 viewPos = uniforms.modelViewMatrix * worldPos;\n"
-    "  out.position = uniforms.projectionMatrix * viewPos;\n"
-    "  out.worldPosition = worldPos.xyz;\n"
-    "  out.color = uniforms.color;\n"
-    "  return out;\n"
-    "}\n"
-    "\n"
-    "fragment float4 fragment_unlit(VertexOutUnlit in [[stage_in]])\n"
-    "{\n"
-    "  return in.color;\n"
-    "}\n"
-    "\n"
-    "fragment float4 fragment_unlit_clip(\n"
-    "  VertexOutUnlit in [[stage_in]],\n"
-    "  constant ClipUniforms& clip [[buffer(1)]])\n"
-    "{\n"
-    "  if (isClipped(in.worldPosition, clip)) discard_fragment();\n"
-    "  return in.color;\n"
-    "}\n"
-    "\n"
-    "// ======== GOURAUD SHADERS ========\n"
-    "\n"
-    "vertex VertexOutGouraud vertex_gouraud(\n"
-    "  const device packed_float3* positions [[buffer(0)]],\n"
-    "  const device packed_float3* normals   [[buffer(2)]],\n"
-    "  constant Uniforms& uniforms    [[buffer(1)]],\n"
-    "  constant LightUniforms& lights [[buffer(3)]],\n"
-    "  uint vid                       [[vertex_id]])\n"
-    "{\n"
-    "  VertexOutGouraud out;\n"
-    "  float3 pos = float3(positions[vid]);\n"
-    "  float3 norm = float3(normals[vid]);\n"
-    "  float4 worldPos = float4(pos, 1.0);\n"
-    "  float4 viewPos = uniforms.modelViewMatrix * worldPos;\n"
-    "  out.position = uniforms.projectionMatrix * viewPos;\n"
-    "  out.worldPosition = worldPos.xyz;\n"
-    "  \n"
-    "  // Transform normal (simplified - should use inverse transpose)\n"
-    "  float3 N = normalize((uniforms.modelViewMatrix * float4(norm, 0.0)).xyz);\n"
-    "  float3 V = normalize(-viewPos.xyz);\n"
-    "  \n"
-    "  // Compute lighting at vertex\n"
-    "  float3 result = lights.AmbientColor.rgb * uniforms.color.rgb;\n"
-    "  for (int i = 0; i < lights.LightCount; i++) {\n"
-    "    result += computePhongLight(lights.Lights[i], N, V, viewPos.xyz,\n"
-    "                                uniforms.color.rgb, float3(1.0), 32.0,\n"
-    "                                uniforms.modelViewMatrix);\n"
-    "  }\n"
-    "  out.color = float4(result, uniforms.color.a);\n"
-    "  return out;\n"
-    "}\n"
-    "\n"
-    "fragment float4 fragment_gouraud(VertexOutGouraud in [[stage_in]])\n"
-    "{\n"
-    "  return in.color;\n"
-    "}\n"
-    "\n"
-    "fragment float4 fragment_gouraud_clip(\n"
-    "  VertexOutGouraud in [[stage_in]],\n"
-    "  constant ClipUniforms& clip [[buffer(1)]])\n"
-    "{\n"
-    "  if (isClipped(in.worldPosition, clip)) discard_fragment();\n"
-    "  return in.color;\n"
-    "}\n"
-    "\n"
-    "// ======== PHONG SHADERS ========\n"
-    "\n"
-    "vertex VertexOutPhong vertex_phong(\n"
-    "  const device packed_float3* positions [[buffer(0)]],\n"
-    "  const device packed_float3* normals   [[buffer(2)]],\n"
-    "  constant Uniforms& uniforms    [[buffer(1)]],\n"
-    "  uint vid                       [[vertex_id]])\n"
-    "{\n"
-    "  VertexOutPhong out;\n"
-    "  float3 pos = float3(positions[vid]);\n"
-    "  float3 norm = float3(normals[vid]);\n"
-    "  float4 worldPos = float4(pos, 1.0);\n"
-    "  float4 viewPos = uniforms.modelViewMatrix * worldPos;\n"
-    "  out.position = uniforms.projectionMatrix * viewPos;\n"
-    "  out.worldPosition = worldPos.xyz;\n"
-    "  out.viewPosition = viewPos.xyz;\n"
-    "  \n"
-    "  // Transform normal\n"
-    "  out.normal = normalize((uniforms.modelViewMatrix * float4(norm, 0.0)).xyz);\n"
-    "  out.color = uniforms.color;\n"
-    "  return out;\n"
-    "}\n"
-    "\n"
-    "fragment float4 fragment_phong(\n"
-    "  VertexOutPhong in [[stage_in]],\n"
-    "  constant Uniforms& uniforms    [[buffer(0)]],\n"
-    "  constant LightUniforms& lights [[buffer(1)]])\n"
-    "{\n"
-    "  float3 N = normalize(in.normal);\n"
-    "  float3 V = normalize(-in.viewPosition);\n"
-    "  \n"
-    "  // Start with ambient\n"
-    "  float3 result = lights.AmbientColor.rgb * in.color.rgb;\n"
-    "  \n"
-    "  // Add contribution from each light\n"
-    "  for (int i = 0; i < lights.LightCount; i++) {\n"
-    "    result += computePhongLight(lights.Lights[i], N, V, in.viewPosition,\n"
-    "                                in.color.rgb, float3(1.0), 32.0,\n"
-    "                                uniforms.modelViewMatrix);\n"
-    "  }\n"
-    "  \n"
-    "  return float4(saturate(result), in.color.a);\n"
-    "}\n"
-    "\n"
-    "fragment float4 fragment_phong_clip(\n"
-    "  VertexOutPhong in [[stage_in]],\n"
-    "  constant Uniforms& uniforms    [[buffer(0)]],\n"
-    "  constant LightUniforms& lights [[buffer(1)]],\n"
-    "  constant ClipUniforms& clip    [[buffer(2)]])\n"
-    "{\n"
-    "  if (isClipped(in.worldPosition, clip)) discard_fragment();\n"
-    "  \n"
-    "  float3 N = normalize(in.normal);\n"
-    "  float3 V = normalize(-in.viewPosition);\n"
-    "  \n"
-    "  float3 result = lights.AmbientColor.rgb * in.color.rgb;\n"
-    "  for (int i = 0; i < lights.LightCount; i++) {\n"
-    "    result += computePhongLight(lights.Lights[i], N, V, in.viewPosition,\n"
-    "                                in.color.rgb, float3(1.0), 32.0,\n"
-    "                                uniforms.modelViewMatrix);\n"
-    "  }\n"
-    "  \n"
-    "  return float4(saturate(result), in.color.a);\n"
-    "}\n"
-    "\n"
-    "// ======== PHONG FACET SHADERS (no vertex normals required) ========\n"
-    "\n"
-    "// Output structure for facet shaders (no normal interpolation)\n"
-    "struct VertexOutFacet {\n"
-    "  float4 position [[position]];\n"
-    "  float3 viewPosition;\n"
-    "  float4 color;\n"
-    "  float3 worldPosition;\n"
-    "};\n"
-    "\n"
-    "// Facet vertex shader - no normals input\n"
-    "vertex VertexOutFacet vertex_phong_facet(\n"
-    "  const device packed_float3* positions [[buffer(0)]],\n"
-    "  constant Uniforms& uniforms    [[buffer(1)]],\n"
-    "  uint vid                       [[vertex_id]])\n"
-    "{\n"
-    "  VertexOutFacet out;\n"
-    "  float3 pos = float3(positions[vid]);\n"
-    "  float4 worldPos = float4(pos, 1.0);\n"
-    "  float4 viewPos = uniforms.modelViewMatrix * worldPos;\n"
-    "  out.position = uniforms.projectionMatrix * viewPos;\n"
-    "  out.worldPosition = worldPos.xyz;\n"
-    "  out.viewPosition = viewPos.xyz;\n"
-    "  out.color = uniforms.color;\n"
-    "  return out;\n"
-    "}\n"
-    "\n"
-    "// Facet fragment shader - computes normals from screen-space derivatives\n"
-    "fragment float4 fragment_phong_facet(\n"
-    "  VertexOutFacet in [[stage_in]],\n"
-    "  constant Uniforms& uniforms    [[buffer(0)]],\n"
-    "  constant LightUniforms& lights [[buffer(1)]])\n"
-    "{\n"
-    "  // Compute face normal from screen-space derivatives\n"
-    "  float3 dPdx = dfdx(in.viewPosition);\n"
-    "  float3 dPdy = dfdy(in.viewPosition);\n"
-    "  float3 N = normalize(cross(dPdx, dPdy));\n"
-    "  float3 V = normalize(-in.viewPosition);\n"
-    "  \n"
-    "  // Ensure normal points toward viewer\n"
-    "  if (dot(N, V) < 0.0) N = -N;\n"
-    "  \n"
-    "  float3 result = lights.AmbientColor.rgb * in.color.rgb;\n"
-    "  for (int i = 0; i < lights.LightCount; i++) {\n"
-    "    result += computePhongLight(lights.Lights[i], N, V, in.viewPosition,\n"
-    "                                in.color.rgb, float3(1.0), 32.0,\n"
-    "                                uniforms.modelViewMatrix);\n"
-    "  }\n"
-    "  \n"
-    "  return float4(saturate(result), in.color.a);\n"
-    "}\n"
-    "\n"
-    "// Facet fragment shader with clipping\n"
-    "fragment float4 fragment_phong_facet_clip(\n"
-    "  VertexOutFacet in [[stage_in]],\n"
-    "  constant Uniforms& uniforms    [[buffer(0)]],\n"
-    "  constant LightUniforms& lights [[buffer(1)]],\n"
-    "  constant ClipUniforms& clip    [[buffer(2)]])\n"
-    "{\n"
-    "  if (isClipped(in.worldPosition, clip)) discard_fragment();\n"
-    "  \n"
-    "  float3 dPdx = dfdx(in.viewPosition);\n"
-    "  float3 dPdy = dfdy(in.viewPosition);\n"
-    "  float3 N = normalize(cross(dPdx, dPdy));\n"
-    "  float3 V = normalize(-in.viewPosition);\n"
-    "  \n"
-    "  if (dot(N, V) < 0.0) N = -N;\n"
-    "  \n"
-    "  float3 result = lights.AmbientColor.rgb * in.color.rgb;\n"
-    "  for (int i = 0; i < lights.LightCount; i++) {\n"
-    "    result += computePhongLight(lights.Lights[i], N, V, in.viewPosition,\n"
-    "                                in.color.rgb, float3(1.0), 32.0,\n"
-    "                                uniforms.modelViewMatrix);\n"
-    "  }\n"
-    "  \n"
-    "  return float4(saturate(result), in.color.a);\n"
-    "}\n"
-    "\n"
-    "// Facet fragment shader with full material support\n"
-    "fragment float4 fragment_phong_facet_material(\n"
-    "  VertexOutFacet in [[stage_in]],\n"
-    "  constant Uniforms& uniforms         [[buffer(0)]],\n"
-    "  constant LightUniforms& lights      [[buffer(1)]],\n"
-    "  constant MaterialUniforms& material [[buffer(2)]],\n"
-    "  bool isFrontFace [[front_facing]])\n"
-    "{\n"
-    "  MaterialCommon mat = (isFrontFace || material.ToDistinguish == 0)\n"
-    "                       ? material.FrontCommon : material.BackCommon;\n"
-    "  \n"
-    "  float3 dPdx = dfdx(in.viewPosition);\n"
-    "  float3 dPdy = dfdy(in.viewPosition);\n"
-    "  float3 N = normalize(cross(dPdx, dPdy));\n"
-    "  float3 V = normalize(-in.viewPosition);\n"
-    "  \n"
-    "  if (!isFrontFace) N = -N;\n"
-    "  \n"
-    "  float3 diffuseColor = mat.Diffuse.rgb;\n"
-    "  float3 specularColor = mat.SpecularShininess.rgb;\n"
-    "  float shininess = mat.SpecularShininess.a;\n"
-    "  float3 ambientColor = mat.Ambient.rgb;\n"
-    "  float3 emissionColor = mat.Emission.rgb;\n"
-    "  float alpha = mat.Diffuse.a;\n"
-    "  \n"
-    "  if (material.AlphaCutoff <= 1.0 && alpha < material.AlphaCutoff) {\n"
-    "    discard_fragment();\n"
-    "  }\n"
-    "  \n"
-    "  float3 result = ambientColor * lights.AmbientColor.rgb + emissionColor;\n"
-    "  \n"
-    "  for (int i = 0; i < lights.LightCount; i++) {\n"
-    "    result += computePhongLight(lights.Lights[i], N, V, in.viewPosition,\n"
-    "                                diffuseColor, specularColor, shininess,\n"
-    "                                uniforms.modelViewMatrix);\n"
-    "  }\n"
-    "  \n"
-    "  return float4(saturate(result), alpha);\n"
-    "}\n"
-    "\n"
-    "// Facet fragment shader with materials and clipping\n"
-    "fragment float4 fragment_phong_facet_material_clip(\n"
-    "  VertexOutFacet in [[stage_in]],\n"
-    "  constant Uniforms& uniforms         [[buffer(0)]],\n"
-    "  constant LightUniforms& lights      [[buffer(1)]],\n"
-    "  constant MaterialUniforms& material [[buffer(2)]],\n"
-    "  constant ClipUniforms& clip         [[buffer(3)]],\n"
-    "  bool isFrontFace [[front_facing]])\n"
-    "{\n"
-    "  if (isClipped(in.worldPosition, clip)) discard_fragment();\n"
-    "  \n"
-    "  MaterialCommon mat = (isFrontFace || material.ToDistinguish == 0)\n"
-    "                       ? material.FrontCommon : material.BackCommon;\n"
-    "  \n"
-    "  float3 dPdx = dfdx(in.viewPosition);\n"
-    "  float3 dPdy = dfdy(in.viewPosition);\n"
-    "  float3 N = normalize(cross(dPdx, dPdy));\n"
-    "  float3 V = normalize(-in.viewPosition);\n"
-    "  \n"
-    "  if (!isFrontFace) N = -N;\n"
-    "  \n"
-    "  float3 diffuseColor = mat.Diffuse.rgb;\n"
-    "  float3 specularColor = mat.SpecularShininess.rgb;\n"
-    "  float shininess = mat.SpecularShininess.a;\n"
-    "  float3 ambientColor = mat.Ambient.rgb;\n"
-    "  float3 emissionColor = mat.Emission.rgb;\n"
-    "  float alpha = mat.Diffuse.a;\n"
-    "  \n"
-    "  if (material.AlphaCutoff <= 1.0 && alpha < material.AlphaCutoff) {\n"
-    "    discard_fragment();\n"
-    "  }\n"
-    "  \n"
-    "  float3 result = ambientColor * lights.AmbientColor.rgb + emissionColor;\n"
-    "  \n"
-    "  for (int i = 0; i < lights.LightCount; i++) {\n"
-    "    result += computePhongLight(lights.Lights[i], N, V, in.viewPosition,\n"
-    "                                diffuseColor, specularColor, shininess,\n"
-    "                                uniforms.modelViewMatrix);\n"
-    "  }\n"
-    "  \n"
-    "  return float4(saturate(result), alpha);\n"
-    "}\n"
-    "\n"
-    "// ======== MATERIAL-AWARE PHONG SHADERS ========\n"
-    "\n"
-    "// Phong fragment shader with full material support\n"
-    "fragment float4 fragment_phong_material(\n"
-    "  VertexOutPhong in [[stage_in]],\n"
-    "  constant Uniforms& uniforms         [[buffer(0)]],\n"
-    "  constant LightUniforms& lights      [[buffer(1)]],\n"
-    "  constant MaterialUniforms& material [[buffer(2)]],\n"
-    "  bool isFrontFace [[front_facing]])\n"
-    "{\n"
-    "  // Select material based on face orientation\n"
-    "  MaterialCommon mat = (isFrontFace || material.ToDistinguish == 0)\n"
-    "                       ? material.FrontCommon : material.BackCommon;\n"
-    "  \n"
-    "  float3 N = normalize(in.normal);\n"
-    "  float3 V = normalize(-in.viewPosition);\n"
-    "  \n"
-    "  // Flip normal for back faces\n"
-    "  if (!isFrontFace) N = -N;\n"
-    "  \n"
-    "  // Extract material properties\n"
-    "  float3 diffuseColor = mat.Diffuse.rgb;\n"
-    "  float3 specularColor = mat.SpecularShininess.rgb;\n"
-    "  float shininess = mat.SpecularShininess.a;\n"
-    "  float3 ambientColor = mat.Ambient.rgb;\n"
-    "  float3 emissionColor = mat.Emission.rgb;\n"
-    "  float alpha = mat.Diffuse.a;\n"
-    "  \n"
-    "  // Alpha test\n"
-    "  if (material.AlphaCutoff <= 1.0 && alpha < material.AlphaCutoff) {\n"
-    "    discard_fragment();\n"
-    "  }\n"
-    "  \n"
-    "  // Ambient term\n"
-    "  float3 result = ambientColor * lights.AmbientColor.rgb;\n"
-    "  \n"
-    "  // Add emission\n"
-    "  result += emissionColor;\n"
-    "  \n"
-    "  // Add contribution from each light\n"
-    "  for (int i = 0; i < lights.LightCount; i++) {\n"
-    "    result += computePhongLight(lights.Lights[i], N, V, in.viewPosition,\n"
-    "                                diffuseColor, specularColor, shininess,\n"
-    "                                uniforms.modelViewMatrix);\n"
-    "  }\n"
-    "  \n"
-    "  return float4(saturate(result), alpha);\n"
-    "}\n"
-    "\n"
-    "// Phong fragment shader with materials and clipping\n"
-    "fragment float4 fragment_phong_material_clip(\n"
-    "  VertexOutPhong in [[stage_in]],\n"
-    "  constant Uniforms& uniforms         [[buffer(0)]],\n"
-    "  constant LightUniforms& lights      [[buffer(1)]],\n"
-    "  constant MaterialUniforms& material [[buffer(2)]],\n"
-    "  constant ClipUniforms& clip         [[buffer(3)]],\n"
-    "  bool isFrontFace [[front_facing]])\n"
-    "{\n"
-    "  // Clipping test first\n"
-    "  if (isClipped(in.worldPosition, clip)) discard_fragment();\n"
-    "  \n"
-    "  // Select material based on face orientation\n"
-    "  MaterialCommon mat = (isFrontFace || material.ToDistinguish == 0)\n"
-    "                       ? material.FrontCommon : material.BackCommon;\n"
-    "  \n"
-    "  float3 N = normalize(in.normal);\n"
-    "  float3 V = normalize(-in.viewPosition);\n"
-    "  \n"
-    "  if (!isFrontFace) N = -N;\n"
-    "  \n"
-    "  float3 diffuseColor = mat.Diffuse.rgb;\n"
-    "  float3 specularColor = mat.SpecularShininess.rgb;\n"
-    "  float shininess = mat.SpecularShininess.a;\n"
-    "  float3 ambientColor = mat.Ambient.rgb;\n"
-    "  float3 emissionColor = mat.Emission.rgb;\n"
-    "  float alpha = mat.Diffuse.a;\n"
-    "  \n"
-    "  if (material.AlphaCutoff <= 1.0 && alpha < material.AlphaCutoff) {\n"
-    "    discard_fragment();\n"
-    "  }\n"
-    "  \n"
-    "  float3 result = ambientColor * lights.AmbientColor.rgb + emissionColor;\n"
-    "  \n"
-    "  for (int i = 0; i < lights.LightCount; i++) {\n"
-    "    result += computePhongLight(lights.Lights[i], N, V, in.viewPosition,\n"
-    "                                diffuseColor, specularColor, shininess,\n"
-    "                                uniforms.modelViewMatrix);\n"
-    "  }\n"
-    "  \n"
-    "  return float4(saturate(result), alpha);\n"
-    "}\n"
-    "\n"
-    "// ======== PBR HELPER FUNCTIONS ========\n"
-    "\n"
-    "// Normal Distribution Function (GGX/Trowbridge-Reitz)\n"
-    "float distributionGGX(float3 N, float3 H, float roughness) {\n"
-    "  float a = roughness * roughness;\n"
-    "  float a2 = a * a;\n"
-    "  float NdotH = max(dot(N, H), 0.0);\n"
-    "  float NdotH2 = NdotH * NdotH;\n"
-    "  float nom = a2;\n"
-    "  float denom = (NdotH2 * (a2 - 1.0) + 1.0);\n"
-    "  denom = M_PI_F * denom * denom;\n"
-    "  return nom / max(denom, 0.0001);\n"
-    "}\n"
-    "\n"
-    "// Geometry function (Schlick-GGX)\n"
-    "float geometrySchlickGGX(float NdotV, float roughness) {\n"
-    "  float r = roughness + 1.0;\n"
-    "  float k = (r * r) / 8.0;\n"
-    "  return NdotV / (NdotV * (1.0 - k) + k);\n"
-    "}\n"
-    "\n"
-    "float geometrySmith(float3 N, float3 V, float3 L, float roughness) {\n"
-    "  float NdotV = max(dot(N, V), 0.0);\n"
-    "  float NdotL = max(dot(N, L), 0.0);\n"
-    "  return geometrySchlickGGX(NdotV, roughness) * geometrySchlickGGX(NdotL, roughness);\n"
-    "}\n"
-    "\n"
-    "// Fresnel-Schlick approximation\n"
-    "float3 fresnelSchlick(float cosTheta, float3 F0) {\n"
-    "  return F0 + (1.0 - F0) * pow(saturate(1.0 - cosTheta), 5.0);\n"
-    "}\n"
-    "\n"
-    "// ======== PBR FRAGMENT SHADER ========\n"
-    "\n"
-    "fragment float4 fragment_pbr(\n"
-    "  VertexOutPhong in [[stage_in]],\n"
-    "  constant Uniforms& uniforms         [[buffer(0)]],\n"
-    "  constant LightUniforms& lights      [[buffer(1)]],\n"
-    "  constant MaterialUniforms& material [[buffer(2)]],\n"
-    "  bool isFrontFace [[front_facing]])\n"
-    "{\n"
-    "  // Select PBR material based on face\n"
-    "  MaterialPBR mat = (isFrontFace || material.ToDistinguish == 0)\n"
-    "                    ? material.FrontPBR : material.BackPBR;\n"
-    "  \n"
-    "  float3 albedo = mat.BaseColor.rgb;\n"
-    "  float alpha = mat.BaseColor.a;\n"
-    "  float metallic = mat.Params.b;    // z component\n"
-    "  float roughness = mat.Params.g;   // y component\n"
-    "  float ao = mat.Params.r;          // x component (occlusion)\n"
-    "  float3 emission = mat.EmissionIOR.rgb;\n"
-    "  \n"
-    "  // Alpha test\n"
-    "  if (material.AlphaCutoff <= 1.0 && alpha < material.AlphaCutoff) {\n"
-    "    discard_fragment();\n"
-    "  }\n"
-    "  \n"
-    "  float3 N = normalize(in.normal);\n"
-    "  float3 V = normalize(-in.viewPosition);\n"
-    "  \n"
-    "  if (!isFrontFace) N = -N;\n"
-    "  \n"
-    "  // Calculate F0 (reflectance at normal incidence)\n"
-    "  float3 F0 = mix(float3(0.04), albedo, metallic);\n"
-    "  \n"
-    "  float3 Lo = float3(0.0);\n"
-    "  \n"
-    "  // Accumulate light contributions\n"
-    "  for (int i = 0; i < lights.LightCount; i++) {\n"
-    "    LightSource light = lights.Lights[i];\n"
-    "    if (light.Parameters.w < 0.5) continue; // disabled\n"
-    "    \n"
-    "    int lightType = int(light.Parameters.z);\n"
-    "    float3 lightColor = light.Color.rgb * light.Color.w;\n"
-    "    float3 L;\n"
-    "    float attenuation = 1.0;\n"
-    "    \n"
-    "    if (lightType == LIGHT_TYPE_DIRECTIONAL) {\n"
-    "      // Transform light direction from world space to view space\n"
-    "      float3 worldLightDir = -light.Position.xyz;\n"
-    "      L = normalize((uniforms.modelViewMatrix * float4(worldLightDir, 0.0)).xyz);\n"
-    "    } else {\n"
-    "      // Transform light position from world space to view space\n"
-    "      float3 viewLightPos = (uniforms.modelViewMatrix * float4(light.Position.xyz, 1.0)).xyz;\n"
-    "      float3 lightVec = viewLightPos - in.viewPosition;\n"
-    "      float dist = length(lightVec);\n"
-    "      L = lightVec / dist;\n"
-    "      float range = light.Direction.w;\n"
-    "      if (range > 0.0) {\n"
-    "        attenuation = saturate(1.0 - dist / range);\n"
-    "        attenuation *= attenuation; // quadratic falloff\n"
-    "      }\n"
-    "      if (lightType == LIGHT_TYPE_SPOT) {\n"
-    "        // Transform spot direction to view space\n"
-    "        float3 worldSpotDir = -light.Direction.xyz;\n"
-    "        float3 spotDir = normalize((uniforms.modelViewMatrix * float4(worldSpotDir, 0.0)).xyz);\n"
-    "        float cosAngle = dot(L, spotDir);\n"
-    "        float cosCutoff = light.Parameters.x;\n"
-    "        if (cosAngle < cosCutoff) {\n"
-    "          attenuation = 0.0;\n"
-    "        } else {\n"
-    "          float spotExponent = light.Parameters.y;\n"
-    "          attenuation *= pow(cosAngle, spotExponent);\n"
-    "        }\n"
-    "      }\n"
-    "    }\n"
-    "    \n"
-    "    float3 H = normalize(V + L);\n"
-    "    float3 radiance = lightColor * attenuation;\n"
-    "    \n"
-    "    // Cook-Torrance BRDF\n"
-    "    float NDF = distributionGGX(N, H, roughness);\n"
-    "    float G = geometrySmith(N, V, L, roughness);\n"
-    "    float3 F = fresnelSchlick(max(dot(H, V), 0.0), F0);\n"
-    "    \n"
-    "    float3 numerator = NDF * G * F;\n"
-    "    float denominator = 4.0 * max(dot(N, V), 0.0) * max(dot(N, L), 0.0) + 0.0001;\n"
-    "    float3 specular = numerator / denominator;\n"
-    "    \n"
-    "    // Energy conservation\n"
-    "    float3 kS = F;\n"
-    "    float3 kD = (float3(1.0) - kS) * (1.0 - metallic);\n"
-    "    \n"
-    "    float NdotL = max(dot(N, L), 0.0);\n"
-    "    \n"
-    "    // For metals: add shading term that provides NdotL-based coloring\n"
-    "    // This simulates how metals reflect environment tinted by their color\n"
-    "    float3 metallicShading = albedo * metallic * 0.5;\n"
-    "    \n"
-    "    Lo += (kD * albedo / M_PI_F + metallicShading + specular) * radiance * NdotL;\n"
-    "  }\n"
-    "  \n"
-    "  // Ambient lighting with proper metallic handling\n"
-    "  // For dielectrics: use albedo. For metals: use F0 (tinted by metal color)\n"
-    "  float3 F0_ambient = mix(float3(0.04), albedo, metallic);\n"
-    "  float NdotV_ambient = max(dot(N, V), 0.001);\n"
-    "  float3 F_ambient = F0_ambient + (float3(1.0) - F0_ambient) * pow(1.0 - NdotV_ambient, 5.0);\n"
-    "  float3 kD_ambient = (float3(1.0) - F_ambient) * (1.0 - metallic);\n"
-    "  float3 diffuseAmbient = kD_ambient * albedo * lights.AmbientColor.rgb;\n"
-    "  float3 metallicAmbient = F0_ambient * lights.AmbientColor.rgb * 0.3 * metallic;\n"
-    "  float3 ambient = (diffuseAmbient + metallicAmbient) * ao;\n"
-    "  \n"
-    "  float3 color = ambient + Lo + emission;\n"
-    "  \n"
-    "  return float4(color, alpha);\n"
-    "}\n"
-    "\n"
-    "// PBR fragment shader with clipping\n"
-    "fragment float4 fragment_pbr_clip(\n"
-    "  VertexOutPhong in [[stage_in]],\n"
-    "  constant Uniforms& uniforms         [[buffer(0)]],\n"
-    "  constant LightUniforms& lights      [[buffer(1)]],\n"
-    "  constant MaterialUniforms& material [[buffer(2)]],\n"
-    "  constant ClipUniforms& clip         [[buffer(3)]],\n"
-    "  bool isFrontFace [[front_facing]])\n"
-    "{\n"
-    "  if (isClipped(in.worldPosition, clip)) discard_fragment();\n"
-    "  \n"
-    "  MaterialPBR mat = (isFrontFace || material.ToDistinguish == 0)\n"
-    "                    ? material.FrontPBR : material.BackPBR;\n"
-    "  \n"
-    "  float3 albedo = mat.BaseColor.rgb;\n"
-    "  float alpha = mat.BaseColor.a;\n"
-    "  float metallic = mat.Params.b;\n"
-    "  float roughness = mat.Params.g;\n"
-    "  float ao = mat.Params.r;\n"
-    "  float3 emission = mat.EmissionIOR.rgb;\n"
-    "  \n"
-    "  if (material.AlphaCutoff <= 1.0 && alpha < material.AlphaCutoff) {\n"
-    "    discard_fragment();\n"
-    "  }\n"
-    "  \n"
-    "  float3 N = normalize(in.normal);\n"
-    "  float3 V = normalize(-in.viewPosition);\n"
-    "  if (!isFrontFace) N = -N;\n"
-    "  \n"
-    "  float3 F0 = mix(float3(0.04), albedo, metallic);\n"
-    "  float3 Lo = float3(0.0);\n"
-    "  \n"
-    "  for (int i = 0; i < lights.LightCount; i++) {\n"
-    "    LightSource light = lights.Lights[i];\n"
-    "    if (light.Parameters.w < 0.5) continue;\n"
-    "    \n"
-    "    int lightType = int(light.Parameters.z);\n"
-    "    float3 lightColor = light.Color.rgb * light.Color.w;\n"
-    "    float3 L;\n"
-    "    float attenuation = 1.0;\n"
-    "    \n"
-    "    if (lightType == LIGHT_TYPE_DIRECTIONAL) {\n"
-    "      // Transform light direction from world space to view space\n"
-    "      float3 worldLightDir = -light.Position.xyz;\n"
-    "      L = normalize((uniforms.modelViewMatrix * float4(worldLightDir, 0.0)).xyz);\n"
-    "    } else {\n"
-    "      // Transform light position from world space to view space\n"
-    "      float3 viewLightPos = (uniforms.modelViewMatrix * float4(light.Position.xyz, 1.0)).xyz;\n"
-    "      float3 lightVec = viewLightPos - in.viewPosition;\n"
-    "      float dist = length(lightVec);\n"
-    "      L = lightVec / dist;\n"
-    "      float range = light.Direction.w;\n"
-    "      if (range > 0.0) {\n"
-    "        attenuation = saturate(1.0 - dist / range);\n"
-    "        attenuation *= attenuation;\n"
-    "      }\n"
-    "      if (lightType == LIGHT_TYPE_SPOT) {\n"
-    "        // Transform spot direction to view space\n"
-    "        float3 worldSpotDir = -light.Direction.xyz;\n"
-    "        float3 spotDir = normalize((uniforms.modelViewMatrix * float4(worldSpotDir, 0.0)).xyz);\n"
-    "        float cosAngle = dot(L, spotDir);\n"
-    "        float cosCutoff = light.Parameters.x;\n"
-    "        if (cosAngle < cosCutoff) attenuation = 0.0;\n"
-    "        else attenuation *= pow(cosAngle, light.Parameters.y);\n"
-    "      }\n"
-    "    }\n"
-    "    \n"
-    "    float3 H = normalize(V + L);\n"
-    "    float3 radiance = lightColor * attenuation;\n"
-    "    \n"
-    "    float NDF = distributionGGX(N, H, roughness);\n"
-    "    float G = geometrySmith(N, V, L, roughness);\n"
-    "    float3 F = fresnelSchlick(max(dot(H, V), 0.0), F0);\n"
-    "    \n"
-    "    float3 numerator = NDF * G * F;\n"
-    "    float denominator = 4.0 * max(dot(N, V), 0.0) * max(dot(N, L), 0.0) + 0.0001;\n"
-    "    float3 specular = numerator / denominator;\n"
-    "    \n"
-    "    float3 kS = F;\n"
-    "    float3 kD = (float3(1.0) - kS) * (1.0 - metallic);\n"
-    "    \n"
-    "    float NdotL = max(dot(N, L), 0.0);\n"
-    "    \n"
-    "    // For metals: add shading term that provides NdotL-based coloring\n"
-    "    float3 metallicShading = albedo * metallic * 0.5;\n"
-    "    \n"
-    "    Lo += (kD * albedo / M_PI_F + metallicShading + specular) * radiance * NdotL;\n"
-    "  }\n"
-    "  \n"
-    "  // Ambient lighting with proper metallic handling\n"
-    "  float3 F0_ambient = mix(float3(0.04), albedo, metallic);\n"
-    "  float NdotV_ambient = max(dot(N, V), 0.001);\n"
-    "  float3 F_ambient = F0_ambient + (float3(1.0) - F0_ambient) * pow(1.0 - NdotV_ambient, 5.0);\n"
-    "  float3 kD_ambient = (float3(1.0) - F_ambient) * (1.0 - metallic);\n"
-    "  float3 diffuseAmbient = kD_ambient * albedo * lights.AmbientColor.rgb;\n"
-    "  float3 metallicAmbient = F0_ambient * lights.AmbientColor.rgb * 0.3 * metallic;\n"
-    "  float3 ambient = (diffuseAmbient + metallicAmbient) * ao;\n"
-    "  \n"
-    "  float3 color = ambient + Lo + emission;\n"
-    "  \n"
-    "  return float4(color, alpha);\n"
-    "}\n"
-    "\n"
-    "// ======== LEGACY SHADERS (for backwards compatibility) ========\n"
-    "\n"
-    "struct VertexOut {\n"
-    "  float4 position [[position]];\n"
-    "  float3 normal;\n"
-    "  float3 viewPosition;\n"
-    "};\n"
-    "\n"
-    "vertex VertexOut vertex_basic(\n"
-    "  const device packed_float3* positions [[buffer(0)]],\n"
-    "  constant Uniforms& uniforms           [[buffer(1)]],\n"
-    "  uint vid                              [[vertex_id]])\n"
-    "{\n"
-    "  VertexOut out;\n"
-    "  float3 pos = float3(positions[vid]);\n"
-    "  float4 worldPos = float4(pos, 1.0);\n"
-    "  float4 viewPos = uniforms.modelViewMatrix * worldPos;\n"
-    "  out.position = uniforms.projectionMatrix * viewPos;\n"
-    "  out.viewPosition = viewPos.xyz;\n"
-    "  out.normal = float3(0.0, 0.0, 1.0);\n"
-    "  return out;\n"
-    "}\n"
-    "\n"
-    "fragment float4 fragment_solid_color(\n"
-    "  VertexOut in                [[stage_in]],\n"
-    "  constant Uniforms& uniforms [[buffer(0)]])\n"
-    "{\n"
-    "  return uniforms.color;\n"
-    "}\n"
-    "\n"
-    "fragment float4 fragment_phong_simple(\n"
-    "  VertexOut in                [[stage_in]],\n"
-    "  constant Uniforms& uniforms [[buffer(0)]])\n"
-    "{\n"
-    "  float3 lightDir = normalize(float3(0.0, 0.0, 1.0));\n"
-    "  float3 N = normalize(in.normal);\n"
-    "  float NdotL = max(dot(N, lightDir), 0.0);\n"
-    "  float ambient = 0.3;\n"
-    "  float lighting = ambient + (1.0 - ambient) * NdotL;\n"
-    "  float4 color = uniforms.color;\n"
-    "  color.rgb *= lighting;\n"
-    "  return color;\n"
-    "}\n"
-    "\n"
-    "// ======== GEOMETRY EMULATION (WIREFRAME/MESH EDGES) ========\n"
-    "\n"
-    "// Wireframe parameters uniform structure\n"
-    "struct WireframeUniforms {\n"
-    "  float4 WireColor;     // wireframe color\n"
-    "  float4 FillColor;     // solid fill color\n"
-    "  float LineWidth;      // line width in pixels\n"
-    "  float Feather;        // edge feather for anti-aliasing\n"
-    "  float2 Viewport;      // viewport size\n"
-    "};\n"
-    "\n"
-    "// Input vertex for edge distance compute\n"
-    "struct EdgeVertexIn {\n"
-    "  float3 position;\n"
-    "  float3 normal;\n"
-    "};\n"
-    "\n"
-    "// Processed vertex with edge distance (output from compute, input to render)\n"
-    "struct EdgeVertexOut {\n"
-    "  float4 position [[position]];\n"
-    "  float3 normal;\n"
-    "  float3 edgeDistance;  // distance to each edge of triangle\n"
-    "  float3 viewPosition;\n"
-    "  float4 color;\n"
-    "};\n"
-    "\n"
-    "// Compute shader: Calculate per-vertex edge distances for wireframe\n"
-    "// Each thread processes one triangle\n"
-    "kernel void compute_edge_distances(\n"
-    "  device const EdgeVertexIn* vertices [[buffer(0)]],\n"
-    "  device const uint* indices          [[buffer(1)]],\n"
-    "  device EdgeVertexOut* output        [[buffer(2)]],\n"
-    "  constant Uniforms& uniforms         [[buffer(3)]],\n"
-    "  constant float2& viewport           [[buffer(4)]],\n"
-    "  uint triangleId                     [[thread_position_in_grid]])\n"
-    "{\n"
-    "  uint baseIdx = triangleId * 3;\n"
-    "  \n"
-    "  // Load triangle vertex indices\n"
-    "  uint i0 = indices[baseIdx + 0];\n"
-    "  uint i1 = indices[baseIdx + 1];\n"
-    "  uint i2 = indices[baseIdx + 2];\n"
-    "  \n"
-    "  // Load positions and normals\n"
-    "  float3 p0 = vertices[i0].position;\n"
-    "  float3 p1 = vertices[i1].position;\n"
-    "  float3 p2 = vertices[i2].position;\n"
-    "  float3 n0 = vertices[i0].normal;\n"
-    "  float3 n1 = vertices[i1].normal;\n"
-    "  float3 n2 = vertices[i2].normal;\n"
-    "  \n"
-    "  // Transform to clip space\n"
-    "  float4x4 mvp = uniforms.projectionMatrix * uniforms.modelViewMatrix;\n"
-    "  float4 clip0 = mvp * float4(p0, 1.0);\n"
-    "  float4 clip1 = mvp * float4(p1, 1.0);\n"
-    "  float4 clip2 = mvp * float4(p2, 1.0);\n"
-    "  \n"
-    "  // Perspective divide to NDC\n"
-    "  float3 ndc0 = clip0.xyz / clip0.w;\n"
-    "  float3 ndc1 = clip1.xyz / clip1.w;\n"
-    "  float3 ndc2 = clip2.xyz / clip2.w;\n"
-    "  \n"
-    "  // Convert to screen space\n"
-    "  float2 screen0 = (ndc0.xy * 0.5 + 0.5) * viewport;\n"
-    "  float2 screen1 = (ndc1.xy * 0.5 + 0.5) * viewport;\n"
-    "  float2 screen2 = (ndc2.xy * 0.5 + 0.5) * viewport;\n"
-    "  \n"
-    "  // Calculate edge vectors (edge opposite to each vertex)\n"
-    "  float2 e0 = screen2 - screen1;  // edge opposite to vertex 0\n"
-    "  float2 e1 = screen0 - screen2;  // edge opposite to vertex 1\n"
-    "  float2 e2 = screen1 - screen0;  // edge opposite to vertex 2\n"
-    "  \n"
-    "  // Calculate 2x triangle area via cross product\n"
-    "  float area2 = abs(e0.x * e1.y - e0.y * e1.x);\n"
-    "  \n"
-    "  // Calculate heights (distance from vertex to opposite edge)\n"
-    "  float h0 = area2 / length(e0);\n"
-    "  float h1 = area2 / length(e1);\n"
-    "  float h2 = area2 / length(e2);\n"
-    "  \n"
-    "  // Transform normals to view space\n"
-    "  float3x3 normalMatrix = float3x3(\n"
-    "    uniforms.modelViewMatrix[0].xyz,\n"
-    "    uniforms.modelViewMatrix[1].xyz,\n"
-    "    uniforms.modelViewMatrix[2].xyz);\n"
-    "  float3 tn0 = normalize(normalMatrix * n0);\n"
-    "  float3 tn1 = normalize(normalMatrix * n1);\n"
-    "  float3 tn2 = normalize(normalMatrix * n2);\n"
-    "  \n"
-    "  // View space positions\n"
-    "  float3 view0 = (uniforms.modelViewMatrix * float4(p0, 1.0)).xyz;\n"
-    "  float3 view1 = (uniforms.modelViewMatrix * float4(p1, 1.0)).xyz;\n"
-    "  float3 view2 = (uniforms.modelViewMatrix * float4(p2, 1.0)).xyz;\n"
-    "  \n"
-    "  // Output vertex 0: has height h0 to edge 0, zero to other edges\n"
-    "  output[baseIdx + 0].position = clip0;\n"
-    "  output[baseIdx + 0].normal = tn0;\n"
-    "  output[baseIdx + 0].edgeDistance = float3(h0, 0.0, 0.0);\n"
-    "  output[baseIdx + 0].viewPosition = view0;\n"
-    "  output[baseIdx + 0].color = uniforms.color;\n"
-    "  \n"
-    "  // Output vertex 1\n"
-    "  output[baseIdx + 1].position = clip1;\n"
-    "  output[baseIdx + 1].normal = tn1;\n"
-    "  output[baseIdx + 1].edgeDistance = float3(0.0, h1, 0.0);\n"
-    "  output[baseIdx + 1].viewPosition = view1;\n"
-    "  output[baseIdx + 1].color = uniforms.color;\n"
-    "  \n"
-    "  // Output vertex 2\n"
-    "  output[baseIdx + 2].position = clip2;\n"
-    "  output[baseIdx + 2].normal = tn2;\n"
-    "  output[baseIdx + 2].edgeDistance = float3(0.0, 0.0, h2);\n"
-    "  output[baseIdx + 2].viewPosition = view2;\n"
-    "  output[baseIdx + 2].color = uniforms.color;\n"
-    "}\n"
-    "\n"
-    "// Vertex passthrough for wireframe (processed vertices from compute)\n"
-    "vertex EdgeVertexOut vertex_wireframe(\n"
-    "  const device EdgeVertexOut* vertices [[buffer(0)]],\n"
-    "  uint vid                             [[vertex_id]])\n"
-    "{\n"
-    "  return vertices[vid];\n"
-    "}\n"
-    "\n"
-    "// Fragment shader: Wireframe overlay on solid shading\n"
-    "fragment float4 fragment_wireframe_overlay(\n"
-    "  EdgeVertexOut in [[stage_in]],\n"
-    "  constant Uniforms& uniforms        [[buffer(0)]],\n"
-    "  constant WireframeUniforms& wire   [[buffer(1)]],\n"
-    "  constant LightUniforms& lights     [[buffer(2)]])\n"
-    "{\n"
-    "  // Calculate minimum distance to any edge\n"
-    "  float dist = min(in.edgeDistance.x, min(in.edgeDistance.y, in.edgeDistance.z));\n"
-    "  \n"
-    "  // Anti-aliased edge factor\n"
-    "  float edgeFactor = 1.0 - smoothstep(\n"
-    "    wire.LineWidth - wire.Feather,\n"
-    "    wire.LineWidth + wire.Feather,\n"
-    "    dist);\n"
-    "  \n"
-    "  // Compute Phong lighting for solid fill\n"
-    "  float3 N = normalize(in.normal);\n"
-    "  float3 V = normalize(-in.viewPosition);\n"
-    "  \n"
-    "  float3 result = lights.AmbientColor.rgb * wire.FillColor.rgb;\n"
-    "  for (int i = 0; i < lights.LightCount; i++) {\n"
-    "    result += computePhongLight(lights.Lights[i], N, V, in.viewPosition,\n"
-    "                                wire.FillColor.rgb, float3(1.0), 32.0,\n"
-    "                                uniforms.modelViewMatrix);\n"
-    "  }\n"
-    "  \n"
-    "  // Blend wireframe over solid\n"
-    "  float3 finalColor = mix(saturate(result), wire.WireColor.rgb, edgeFactor);\n"
-    "  return float4(finalColor, in.color.a);\n"
-    "}\n"
-    "\n"
-    "// Fragment shader: Wireframe only (transparent background)\n"
-    "fragment float4 fragment_wireframe_only(\n"
-    "  EdgeVertexOut in [[stage_in]],\n"
-    "  constant WireframeUniforms& wire [[buffer(0)]])\n"
-    "{\n"
-    "  float dist = min(in.edgeDistance.x, min(in.edgeDistance.y, in.edgeDistance.z));\n"
-    "  \n"
-    "  float edgeFactor = 1.0 - smoothstep(\n"
-    "    wire.LineWidth - wire.Feather,\n"
-    "    wire.LineWidth + wire.Feather,\n"
-    "    dist);\n"
-    "  \n"
-    "  if (edgeFactor < 0.01) {\n"
-    "    discard_fragment();\n"
-    "  }\n"
-    "  \n"
-    "  // Depth-based fade for back edges\n"
-    "  float3 normal = normalize(in.normal);\n"
-    "  float3 viewDir = normalize(-in.viewPosition);\n"
-    "  float facing = abs(dot(normal, viewDir));\n"
-    "  float depthFade = mix(0.3, 1.0, facing);\n"
-    "  \n"
-    "  return float4(wire.WireColor.rgb * depthFade, edgeFactor);\n"
-    "}\n"
-    "\n"
-    "// Fragment shader: Hidden-line removal style\n"
-    "fragment float4 fragment_wireframe_hidden(\n"
-    "  EdgeVertexOut in [[stage_in]],\n"
-    "  constant WireframeUniforms& wire [[buffer(0)]])\n"
-    "{\n"
-    "  float dist = min(in.edgeDistance.x, min(in.edgeDistance.y, in.edgeDistance.z));\n"
-    "  \n"
-    "  float edgeFactor = 1.0 - smoothstep(\n"
-    "    wire.LineWidth - wire.Feather,\n"
-    "    wire.LineWidth + wire.Feather,\n"
-    "    dist);\n"
-    "  \n"
-    "  // Check if front-facing\n"
-    "  float3 normal = normalize(in.normal);\n"
-    "  float3 viewDir = normalize(-in.viewPosition);\n"
-    "  float facing = dot(normal, viewDir);\n"
-    "  \n"
-    "  if (facing < 0.0) {\n"
-    "    // Back face - show fill color only\n"
-    "    return float4(wire.FillColor.rgb * 0.95, 1.0);\n"
-    "  }\n"
-    "  \n"
-    "  // Front face - show wireframe\n"
-    "  float3 finalColor = mix(wire.FillColor.rgb, wire.WireColor.rgb, edgeFactor);\n"
-    "  return float4(finalColor, 1.0);\n"
-    "}\n"
-    "\n"
-    "// ======== TESSELLATION SHADERS ========\n"
-    "\n"
-    "// Tessellation uniforms\n"
-    "struct TessUniforms {\n"
-    "  float4x4 ModelViewProjection;\n"
-    "  float4x4 ModelView;\n"
-    "  float2 Viewport;\n"
-    "  float TessLevel;        // base tessellation level\n"
-    "  float AdaptiveFactor;   // 0 = uniform, 1 = fully adaptive\n"
-    "  float3 CameraPos;\n"
-    "  float padding;\n"
-    "};\n"
-    "\n"
-    "// Control point for quad tessellation\n"
-    "struct TessControlPoint {\n"
-    "  float3 position [[attribute(0)]];\n"
-    "  float3 normal   [[attribute(1)]];\n"
-    "  float2 texCoord [[attribute(2)]];\n"
-    "};\n"
-    "\n"
-    "// Tessellation factors for quad patches\n"
-    "struct QuadTessFactors {\n"
-    "  half edgeTessellationFactor[4];\n"
-    "  half insideTessellationFactor[2];\n"
-    "};\n"
-    "\n"
-    "// Post-tessellation vertex output\n"
-    "struct TessVertexOut {\n"
-    "  float4 position [[position]];\n"
-    "  float3 normal;\n"
-    "  float2 texCoord;\n"
-    "  float3 viewPosition;\n"
-    "};\n"
-    "\n"
-    "// Compute shader: Calculate adaptive tessellation factors per patch\n"
-    "kernel void compute_tess_factors(\n"
-    "  device const TessControlPoint* controlPoints [[buffer(0)]],\n"
-    "  device QuadTessFactors* tessFactors          [[buffer(1)]],\n"
-    "  constant TessUniforms& uniforms              [[buffer(2)]],\n"
-    "  uint patchId                                 [[thread_position_in_grid]])\n"
-    "{\n"
-    "  // Load 4 control points for this quad patch\n"
-    "  uint baseIdx = patchId * 4;\n"
-    "  float3 p0 = controlPoints[baseIdx + 0].position;\n"
-    "  float3 p1 = controlPoints[baseIdx + 1].position;\n"
-    "  float3 p2 = controlPoints[baseIdx + 2].position;\n"
-    "  float3 p3 = controlPoints[baseIdx + 3].position;\n"
-    "  \n"
-    "  // Transform to clip space\n"
-    "  float4 clip0 = uniforms.ModelViewProjection * float4(p0, 1.0);\n"
-    "  float4 clip1 = uniforms.ModelViewProjection * float4(p1, 1.0);\n"
-    "  float4 clip2 = uniforms.ModelViewProjection * float4(p2, 1.0);\n"
-    "  float4 clip3 = uniforms.ModelViewProjection * float4(p3, 1.0);\n"
-    "  \n"
-    "  // Perspective divide to NDC\n"
-    "  float3 ndc0 = clip0.xyz / clip0.w;\n"
-    "  float3 ndc1 = clip1.xyz / clip1.w;\n"
-    "  float3 ndc2 = clip2.xyz / clip2.w;\n"
-    "  float3 ndc3 = clip3.xyz / clip3.w;\n"
-    "  \n"
-    "  // Convert to screen space\n"
-    "  float2 screen0 = (ndc0.xy * 0.5 + 0.5) * uniforms.Viewport;\n"
-    "  float2 screen1 = (ndc1.xy * 0.5 + 0.5) * uniforms.Viewport;\n"
-    "  float2 screen2 = (ndc2.xy * 0.5 + 0.5) * uniforms.Viewport;\n"
-    "  float2 screen3 = (ndc3.xy * 0.5 + 0.5) * uniforms.Viewport;\n"
-    "  \n"
-    "  // Calculate screen-space edge lengths (quad edges: 0-1, 1-2, 2-3, 3-0)\n"
-    "  float edge01 = length(screen1 - screen0);\n"
-    "  float edge12 = length(screen2 - screen1);\n"
-    "  float edge23 = length(screen3 - screen2);\n"
-    "  float edge30 = length(screen0 - screen3);\n"
-    "  \n"
-    "  // Adaptive factors based on screen-space edge length\n"
-    "  float targetPixelsPerSegment = 10.0;\n"
-    "  float baseTess = uniforms.TessLevel;\n"
-    "  \n"
-    "  float adaptive01 = edge01 / targetPixelsPerSegment;\n"
-    "  float adaptive12 = edge12 / targetPixelsPerSegment;\n"
-    "  float adaptive23 = edge23 / targetPixelsPerSegment;\n"
-    "  float adaptive30 = edge30 / targetPixelsPerSegment;\n"
-    "  \n"
-    "  // Blend between uniform and adaptive\n"
-    "  float factor0 = mix(baseTess, adaptive01, uniforms.AdaptiveFactor);\n"
-    "  float factor1 = mix(baseTess, adaptive12, uniforms.AdaptiveFactor);\n"
-    "  float factor2 = mix(baseTess, adaptive23, uniforms.AdaptiveFactor);\n"
-    "  float factor3 = mix(baseTess, adaptive30, uniforms.AdaptiveFactor);\n"
-    "  \n"
-    "  // Clamp to valid range [1, 64]\n"
-    "  factor0 = clamp(factor0, 1.0, 64.0);\n"
-    "  factor1 = clamp(factor1, 1.0, 64.0);\n"
-    "  factor2 = clamp(factor2, 1.0, 64.0);\n"
-    "  factor3 = clamp(factor3, 1.0, 64.0);\n"
-    "  \n"
-    "  // Set edge tessellation factors\n"
-    "  tessFactors[patchId].edgeTessellationFactor[0] = half(factor0);\n"
-    "  tessFactors[patchId].edgeTessellationFactor[1] = half(factor1);\n"
-    "  tessFactors[patchId].edgeTessellationFactor[2] = half(factor2);\n"
-    "  tessFactors[patchId].edgeTessellationFactor[3] = half(factor3);\n"
-    "  \n"
-    "  // Inside factors: average of opposing edges\n"
-    "  float inside0 = (factor0 + factor2) * 0.5;\n"
-    "  float inside1 = (factor1 + factor3) * 0.5;\n"
-    "  tessFactors[patchId].insideTessellationFactor[0] = half(inside0);\n"
-    "  tessFactors[patchId].insideTessellationFactor[1] = half(inside1);\n"
-    "}\n"
-    "\n"
-    "// Post-tessellation vertex function for quad patches\n"
-    "[[patch(quad, 4)]]\n"
-    "vertex TessVertexOut vertex_post_tess(\n"
-    "  patch_control_point<TessControlPoint> controlPoints [[stage_in]],\n"
-    "  float2 patchCoord                                   [[position_in_patch]],\n"
-    "  constant TessUniforms& uniforms                     [[buffer(1)]])\n"
-    "{\n"
-    "  float u = patchCoord.x;\n"
-    "  float v = patchCoord.y;\n"
-    "  \n"
-    "  // Bilinear interpolation of control points\n"
-    "  // Patch layout: 3---2\n"
-    "  //               |   |\n"
-    "  //               0---1\n"
-    "  \n"
-    "  float3 p0 = controlPoints[0].position;\n"
-    "  float3 p1 = controlPoints[1].position;\n"
-    "  float3 p2 = controlPoints[2].position;\n"
-    "  float3 p3 = controlPoints[3].position;\n"
-    "  \n"
-    "  float3 n0 = controlPoints[0].normal;\n"
-    "  float3 n1 = controlPoints[1].normal;\n"
-    "  float3 n2 = controlPoints[2].normal;\n"
-    "  float3 n3 = controlPoints[3].normal;\n"
-    "  \n"
-    "  float2 t0 = controlPoints[0].texCoord;\n"
-    "  float2 t1 = controlPoints[1].texCoord;\n"
-    "  float2 t2 = controlPoints[2].texCoord;\n"
-    "  float2 t3 = controlPoints[3].texCoord;\n"
-    "  \n"
-    "  // Bilinear interpolation\n"
-    "  float3 bottom = mix(p0, p1, u);\n"
-    "  float3 top = mix(p3, p2, u);\n"
-    "  float3 position = mix(bottom, top, v);\n"
-    "  \n"
-    "  float3 bottomN = mix(n0, n1, u);\n"
-    "  float3 topN = mix(n3, n2, u);\n"
-    "  float3 normal = normalize(mix(bottomN, topN, v));\n"
-    "  \n"
-    "  float2 bottomT = mix(t0, t1, u);\n"
-    "  float2 topT = mix(t3, t2, u);\n"
-    "  float2 texCoord = mix(bottomT, topT, v);\n"
-    "  \n"
-    "  TessVertexOut out;\n"
-    "  out.position = uniforms.ModelViewProjection * float4(position, 1.0);\n"
-    "  out.normal = (uniforms.ModelView * float4(normal, 0.0)).xyz;\n"
-    "  out.texCoord = texCoord;\n"
-    "  out.viewPosition = (uniforms.ModelView * float4(position, 1.0)).xyz;\n"
-    "  \n"
-    "  return out;\n"
-    "}\n"
-    "\n"
-    "// Fragment shader for tessellated geometry\n"
-    "fragment float4 fragment_tess_phong(\n"
-    "  TessVertexOut in [[stage_in]],\n"
-    "  constant Uniforms& uniforms    [[buffer(0)]],\n"
-    "  constant LightUniforms& lights [[buffer(1)]])\n"
-    "{\n"
-    "  float3 N = normalize(in.normal);\n"
-    "  float3 V = normalize(-in.viewPosition);\n"
-    "  \n"
-    "  // Two-sided lighting\n"
-    "  if (dot(N, V) < 0.0) N = -N;\n"
-    "  \n"
-    "  float3 result = lights.AmbientColor.rgb * uniforms.color.rgb;\n"
-    "  for (int i = 0; i < lights.LightCount; i++) {\n"
-    "    result += computePhongLight(lights.Lights[i], N, V, in.viewPosition,\n"
-    "                                uniforms.color.rgb, float3(1.0), 32.0,\n"
-    "                                uniforms.modelViewMatrix);\n"
-    "  }\n"
-    "  \n"
-    "  return float4(saturate(result), uniforms.color.a);\n"
-    "}\n"
-    "\n"
-    "// ======== LINE STIPPLE SHADERS ========\n"
-    "\n"
-    "// Line stipple uniforms structure\n"
-    "struct LineUniforms {\n"
-    "  float    lineWidth;      // line width in pixels\n"
-    "  float    feather;        // edge feather for anti-aliasing\n"
-    "  uint     pattern;        // 16-bit stipple pattern\n"
-    "  uint     factor;         // stipple factor (stretch multiplier)\n"
-    "  float2   viewport;       // viewport size\n"
-    "  float2   padding;\n"
-    "};\n"
-    "\n"
-    "// Vertex output for stippled lines\n"
-    "struct VertexOutLine {\n"
-    "  float4 position [[position]];\n"
-    "  float4 color;\n"
-    "  float  lineDistance;   // cumulative distance along line in screen space\n"
-    "  float3 worldPosition;\n"
-    "};\n"
-    "\n"
-    "// Check if stipple pattern bit is set at given distance\n"
-    "// Pattern is 16-bit, factor stretches it\n"
-    "float computeStippleMask(float lineDistance, uint pattern, uint factor) {\n"
-    "  // If solid pattern, always visible\n"
-    "  if (pattern == 0xFFFFu) {\n"
-    "    return 1.0;\n"
-    "  }\n"
-    "  // If empty pattern, always invisible\n"
-    "  if (pattern == 0u) {\n"
-    "    return 0.0;\n"
-    "  }\n"
-    "  \n"
-    "  // Scale distance by factor (each bit covers 'factor' pixels)\n"
-    "  float scaledDist = lineDistance / float(max(factor, 1u));\n"
-    "  \n"
-    "  // Get bit position (0-15) from distance\n"
-    "  // Pattern repeats every 16 bits\n"
-    "  int bitPos = int(floor(scaledDist)) & 0xF;\n"
-    "  \n"
-    "  // Check if bit is set in pattern (LSB first, like OpenGL)\n"
-    "  uint bit = (pattern >> bitPos) & 1u;\n"
-    "  \n"
-    "  return float(bit);\n"
-    "}\n"
-    "\n"
-    "// Anti-aliased stipple mask with smooth transitions\n"
-    "float computeStippleMaskAA(float lineDistance, uint pattern, uint factor, float feather) {\n"
-    "  // If solid pattern, always visible\n"
-    "  if (pattern == 0xFFFFu) {\n"
-    "    return 1.0;\n"
-    "  }\n"
-    "  // If empty pattern, always invisible\n"
-    "  if (pattern == 0u) {\n"
-    "    return 0.0;\n"
-    "  }\n"
-    "  \n"
-    "  float scaledDist = lineDistance / float(max(factor, 1u));\n"
-    "  float fractPos = fract(scaledDist);\n"
-    "  int bitPos = int(floor(scaledDist)) & 0xF;\n"
-    "  int nextBitPos = (bitPos + 1) & 0xF;\n"
-    "  \n"
-    "  // Get current and next bit\n"
-    "  float currBit = float((pattern >> bitPos) & 1u);\n"
-    "  float nextBit = float((pattern >> nextBitPos) & 1u);\n"
-    "  \n"
-    "  // Smooth transition near bit boundaries\n"
-    "  float edgeDist = min(fractPos, 1.0 - fractPos);\n"
-    "  float transitionWidth = feather / float(max(factor, 1u));\n"
-    "  \n"
-    "  if (currBit != nextBit && fractPos > 1.0 - transitionWidth) {\n"
-    "    // Approaching bit boundary with state change\n"
-    "    float t = (fractPos - (1.0 - transitionWidth)) / transitionWidth;\n"
-    "    return mix(currBit, nextBit, smoothstep(0.0, 1.0, t));\n"
-    "  }\n"
-    "  \n"
-    "  return currBit;\n"
-    "}\n"
-    "\n"
-    "// Vertex shader for stippled lines - basic version\n"
-    "// Note: For proper line stipple, we need distance along the line\n"
-    "// This requires either geometry shader emulation or compute preprocessing\n"
-    "vertex VertexOutLine vertex_line_stipple(\n"
-    "  const device packed_float3* positions [[buffer(0)]],\n"
-    "  const device float*  lineDistances    [[buffer(2)]],  // precomputed distances\n"
-    "  constant Uniforms& uniforms           [[buffer(1)]],\n"
-    "  uint vid                              [[vertex_id]])\n"
-    "{\n"
-    "  VertexOutLine out;\n"
-    "  float3 pos = float3(positions[vid]);\n"
-    "  float4 worldPos = float4(pos, 1.0);\n"
-    "  float4 viewPos = uniforms.modelViewMatrix * worldPos;\n"
-    "  out.position = uniforms.projectionMatrix * viewPos;\n"
-    "  out.worldPosition = worldPos.xyz;\n"
-    "  out.color = uniforms.color;\n"
-    "  out.lineDistance = lineDistances[vid];\n"
-    "  return out;\n"
-    "}\n"
-    "\n"
-    "// Simple vertex shader for lines without precomputed distances\n"
-    "// Uses vertex index as approximate distance (works for line strips)\n"
-    "vertex VertexOutLine vertex_line_stipple_simple(\n"
-    "  const device packed_float3* positions [[buffer(0)]],\n"
-    "  constant Uniforms& uniforms           [[buffer(1)]],\n"
-    "  constant LineUniforms& line           [[buffer(3)]],\n"
-    "  uint vid                              [[vertex_id]])\n"
-    "{\n"
-    "  VertexOutLine out;\n"
-    "  float3 pos = float3(positions[vid]);\n"
-    "  float4 worldPos = float4(pos, 1.0);\n"
-    "  float4 viewPos = uniforms.modelViewMatrix * worldPos;\n"
-    "  float4 clipPos = uniforms.projectionMatrix * viewPos;\n"
-    "  out.position = clipPos;\n"
-    "  out.worldPosition = worldPos.xyz;\n"
-    "  out.color = uniforms.color;\n"
-    "  \n"
-    "  // Use a simple per-segment distance based on screen position\n"
-    "  // This works reasonably for visualization but isn't perfect for all cases\n"
-    "  float2 screenPos = (clipPos.xy / clipPos.w * 0.5 + 0.5) * line.viewport;\n"
-    "  out.lineDistance = float(vid) * float(line.factor) * 2.0;\n"
-    "  \n"
-    "  return out;\n"
-    "}\n"
-    "\n"
-    "// Fragment shader for stippled lines\n"
-    "fragment float4 fragment_line_stipple(\n"
-    "  VertexOutLine in [[stage_in]],\n"
-    "  constant LineUniforms& line [[buffer(0)]])\n"
-    "{\n"
-    "  // Compute stipple mask\n"
-    "  float mask = computeStippleMaskAA(in.lineDistance, line.pattern, line.factor, line.feather);\n"
-    "  \n"
-    "  // Discard transparent parts of stipple\n"
-    "  if (mask < 0.01) {\n"
-    "    discard_fragment();\n"
-    "  }\n"
-    "  \n"
-    "  return float4(in.color.rgb, in.color.a * mask);\n"
-    "}\n"
-    "\n"
-    "// Fragment shader for stippled lines with clipping\n"
-    "fragment float4 fragment_line_stipple_clip(\n"
-    "  VertexOutLine in [[stage_in]],\n"
-    "  constant LineUniforms& line [[buffer(0)]],\n"
-    "  constant ClipUniforms& clip [[buffer(1)]])\n"
-    "{\n"
-    "  // Apply clipping first\n"
-    "  if (isClipped(in.worldPosition, clip)) discard_fragment();\n"
-    "  \n"
-    "  // Compute stipple mask\n"
-    "  float mask = computeStippleMaskAA(in.lineDistance, line.pattern, line.factor, line.feather);\n"
-    "  \n"
-    "  if (mask < 0.01) {\n"
-    "    discard_fragment();\n"
-    "  }\n"
-    "  \n"
-    "  return float4(in.color.rgb, in.color.a * mask);\n"
-    "}\n"
-    "\n"
-    "// ======== LINE DISTANCE COMPUTE SHADER ========\n"
-    "\n"
-    "// Compute shader to calculate cumulative line distances for line strips\n"
-    "// This is needed for accurate stipple patterns along polylines\n"
-    "kernel void compute_line_distances(\n"
-    "  device const packed_float3* positions [[buffer(0)]],\n"
-    "  device float* lineDistances           [[buffer(1)]],\n"
-    "  constant Uniforms& uniforms      [[buffer(2)]],\n"
-    "  constant float2& viewport        [[buffer(3)]],\n"
-    "  uint vid                         [[thread_position_in_grid]])\n"
-    "{\n"
-    "  if (vid == 0) {\n"
-    "    lineDistances[0] = 0.0;\n"
-    "    return;\n"
-    "  }\n"
-    "  \n"
-    "  // Transform current and previous position to screen space\n"
-    "  float4x4 mvp = uniforms.projectionMatrix * uniforms.modelViewMatrix;\n"
-    "  \n"
-    "  float4 currClip = mvp * float4(positions[vid], 1.0);\n"
-    "  float4 prevClip = mvp * float4(positions[vid - 1], 1.0);\n"
-    "  \n"
-    "  float2 currScreen = (currClip.xy / currClip.w * 0.5 + 0.5) * viewport;\n"
-    "  float2 prevScreen = (prevClip.xy / prevClip.w * 0.5 + 0.5) * viewport;\n"
-    "  \n"
-    "  // Distance is cumulative from start\n"
-    "  float segmentDist = length(currScreen - prevScreen);\n"
-    "  lineDistances[vid] = lineDistances[vid - 1] + segmentDist;\n"
-    "}\n"
-    "\n"
-    "// ======== HATCH PATTERN SHADERS ========\n"
-    "\n"
-    "// Hatch pattern types matching Aspect_HatchStyle\n"
-    "// Note: OCCT enum values are non-contiguous, we remap to 0-12\n"
-    "#define HATCH_NONE              0   // Aspect_HS_SOLID\n"
-    "#define HATCH_GRID_DIAGONAL     1   // Aspect_HS_GRID_DIAGONAL (cross hatch)\n"
-    "#define HATCH_GRID_DIAGONAL_WIDE 2  // Aspect_HS_GRID_DIAGONAL_WIDE\n"
-    "#define HATCH_GRID              3   // Aspect_HS_GRID\n"
-    "#define HATCH_GRID_WIDE         4   // Aspect_HS_GRID_WIDE\n"
-    "#define HATCH_DIAGONAL_45       5   // Aspect_HS_DIAGONAL_45\n"
-    "#define HATCH_DIAGONAL_135      6   // Aspect_HS_DIAGONAL_135\n"
-    "#define HATCH_HORIZONTAL        7   // Aspect_HS_HORIZONTAL\n"
-    "#define HATCH_VERTICAL          8   // Aspect_HS_VERTICAL\n"
-    "#define HATCH_DIAGONAL_45_WIDE  9   // Aspect_HS_DIAGONAL_45_WIDE\n"
-    "#define HATCH_DIAGONAL_135_WIDE 10  // Aspect_HS_DIAGONAL_135_WIDE\n"
-    "#define HATCH_HORIZONTAL_WIDE   11  // Aspect_HS_HORIZONTAL_WIDE\n"
-    "#define HATCH_VERTICAL_WIDE     12  // Aspect_HS_VERTICAL_WIDE\n"
-    "\n"
-    "// Hatch uniforms structure\n"
-    "struct HatchUniforms {\n"
-    "  int   hatchType;       // pattern type\n"
-    "  float spacing;         // spacing between lines\n"
-    "  float lineWidth;       // line thickness\n"
-    "  float angle;           // custom rotation\n"
-    "  float2 viewport;       // viewport size\n"
-    "  float2 padding;\n"
-    "};\n"
-    "\n"
-    "// Calculate distance to a line at given angle\n"
-    "// Returns positive distance to nearest line\n"
-    "float hatchLineDist(float2 coord, float angle, float spacing) {\n"
-    "  // Rotate coordinate to align with line angle\n"
-    "  float c = cos(angle);\n"
-    "  float s = sin(angle);\n"
-    "  float rotated = coord.x * c + coord.y * s;\n"
-    "  \n"
-    "  // Distance to nearest line (lines at multiples of spacing)\n"
-    "  return abs(fmod(rotated + spacing * 0.5, spacing) - spacing * 0.5);\n"
-    "}\n"
-    "\n"
-    "// Compute anti-aliased hatch mask for a single line direction\n"
-    "float hatchLineMask(float2 fragCoord, float angle, float spacing, float lineWidth) {\n"
-    "  float dist = hatchLineDist(fragCoord, angle, spacing);\n"
-    "  float feather = 1.0; // anti-aliasing width\n"
-    "  return 1.0 - smoothstep(lineWidth * 0.5 - feather, lineWidth * 0.5 + feather, dist);\n"
-    "}\n"
-    "\n"
-    "// Core hatch pattern function\n"
-    "// Returns mask value: 1.0 = line (discard), 0.0 = fill (keep)\n"
-    "float computeHatchMask(float2 fragCoord, constant HatchUniforms& hatch) {\n"
-    "  if (hatch.hatchType == HATCH_NONE) {\n"
-    "    return 0.0; // no hatching, keep all pixels\n"
-    "  }\n"
-    "  \n"
-    "  float spacing = hatch.spacing;\n"
-    "  float lineWidth = hatch.lineWidth;\n"
-    "  float mask = 0.0;\n"
-    "  \n"
-    "  // Select pattern based on type\n"
-    "  switch (hatch.hatchType) {\n"
-    "    case HATCH_HORIZONTAL:\n"
-    "    case HATCH_HORIZONTAL_WIDE:\n"
-    "      mask = hatchLineMask(fragCoord, 0.0, spacing, lineWidth);\n"
-    "      break;\n"
-    "      \n"
-    "    case HATCH_VERTICAL:\n"
-    "    case HATCH_VERTICAL_WIDE:\n"
-    "      mask = hatchLineMask(fragCoord, M_PI_2_F, spacing, lineWidth);\n"
-    "      break;\n"
-    "      \n"
-    "    case HATCH_DIAGONAL_45:\n"
-    "    case HATCH_DIAGONAL_45_WIDE:\n"
-    "      mask = hatchLineMask(fragCoord, M_PI_4_F, spacing, lineWidth);\n"
-    "      break;\n"
-    "      \n"
-    "    case HATCH_DIAGONAL_135:\n"
-    "    case HATCH_DIAGONAL_135_WIDE:\n"
-    "      mask = hatchLineMask(fragCoord, -M_PI_4_F, spacing, lineWidth);\n"
-    "      break;\n"
-    "      \n"
-    "    case HATCH_GRID:\n"
-    "    case HATCH_GRID_WIDE: {\n"
-    "      // Horizontal + Vertical\n"
-    "      float h = hatchLineMask(fragCoord, 0.0, spacing, lineWidth);\n"
-    "      float v = hatchLineMask(fragCoord, M_PI_2_F, spacing, lineWidth);\n"
-    "      mask = max(h, v);\n"
-    "      break;\n"
-    "    }\n"
-    "      \n"
-    "    case HATCH_GRID_DIAGONAL:\n"
-    "    case HATCH_GRID_DIAGONAL_WIDE: {\n"
-    "      // Diagonal 45 + 135 (cross-hatch)\n"
-    "      float d45 = hatchLineMask(fragCoord, M_PI_4_F, spacing, lineWidth);\n"
-    "      float d135 = hatchLineMask(fragCoord, -M_PI_4_F, spacing, lineWidth);\n"
-    "      mask = max(d45, d135);\n"
-    "      break;\n"
-    "    }\n"
-    "      \n"
-    "    default:\n"
-    "      mask = 0.0;\n"
-    "      break;\n"
-    "  }\n"
-    "  \n"
-    "  return mask;\n"
-    "}\n"
-    "\n"
-    "// Vertex output for hatched geometry\n"
-    "struct VertexOutHatch {\n"
-    "  float4 position [[position]];\n"
-    "  float3 normal;\n"
-    "  float3 viewPosition;\n"
-    "  float4 color;\n"
-    "  float3 worldPosition;\n"
-    "};\n"
-    "\n"
-    "// Vertex shader for hatched surfaces\n"
-    "vertex VertexOutHatch vertex_hatch(\n"
-    "  const device packed_float3* positions [[buffer(0)]],\n"
-    "  const device packed_float3* normals   [[buffer(2)]],\n"
-    "  constant Uniforms& uniforms           [[buffer(1)]],\n"
-    "  uint vid                              [[vertex_id]])\n"
-    "{\n"
-    "  VertexOutHatch out;\n"
-    "  float3 pos = float3(positions[vid]);\n"
-    "  float3 norm = float3(normals[vid]);\n"
-    "  float4 worldPos = float4(pos, 1.0);\n"
-    "  float4 viewPos = uniforms.modelViewMatrix * worldPos;\n"
-    "  out.position = uniforms.projectionMatrix * viewPos;\n"
-    "  out.worldPosition = worldPos.xyz;\n"
-    "  out.viewPosition = viewPos.xyz;\n"
-    "  out.normal = normalize((uniforms.modelViewMatrix * float4(norm, 0.0)).xyz);\n"
-    "  out.color = uniforms.color;\n"
-    "  return out;\n"
-    "}\n"
-    "\n"
-    "// Fragment shader: Hatched surface with Phong lighting\n"
-    "fragment float4 fragment_hatch_phong(\n"
-    "  VertexOutHatch in [[stage_in]],\n"
-    "  constant Uniforms& uniforms       [[buffer(0)]],\n"
-    "  constant LightUniforms& lights    [[buffer(1)]],\n"
-    "  constant HatchUniforms& hatch     [[buffer(2)]])\n"
-    "{\n"
-    "  // Calculate hatch mask in screen space\n"
-    "  float2 fragCoord = in.position.xy;\n"
-    "  float mask = computeHatchMask(fragCoord, hatch);\n"
-    "  \n"
-    "  // Discard hatched pixels (where mask > 0.5)\n"
-    "  if (mask > 0.5) {\n"
-    "    discard_fragment();\n"
-    "  }\n"
-    "  \n"
-    "  // Compute Phong lighting for visible pixels\n"
-    "  float3 N = normalize(in.normal);\n"
-    "  float3 V = normalize(-in.viewPosition);\n"
-    "  \n"
-    "  // Two-sided lighting\n"
-    "  if (dot(N, V) < 0.0) N = -N;\n"
-    "  \n"
-    "  float3 result = lights.AmbientColor.rgb * in.color.rgb;\n"
-    "  for (int i = 0; i < lights.LightCount; i++) {\n"
-    "    result += computePhongLight(lights.Lights[i], N, V, in.viewPosition,\n"
-    "                                in.color.rgb, float3(1.0), 32.0,\n"
-    "                                uniforms.modelViewMatrix);\n"
-    "  }\n"
-    "  \n"
-    "  // Apply anti-aliasing at edges\n"
-    "  float alpha = in.color.a * (1.0 - mask);\n"
-    "  return float4(saturate(result), alpha);\n"
-    "}\n"
-    "\n"
-    "// Fragment shader: Hatched surface unlit\n"
-    "fragment float4 fragment_hatch_unlit(\n"
-    "  VertexOutHatch in [[stage_in]],\n"
-    "  constant HatchUniforms& hatch [[buffer(0)]])\n"
-    "{\n"
-    "  float2 fragCoord = in.position.xy;\n"
-    "  float mask = computeHatchMask(fragCoord, hatch);\n"
-    "  \n"
-    "  if (mask > 0.5) {\n"
-    "    discard_fragment();\n"
-    "  }\n"
-    "  \n"
-    "  float alpha = in.color.a * (1.0 - mask);\n"
-    "  return float4(in.color.rgb, alpha);\n"
-    "}\n"
-    "\n"
-    "// Fragment shader: Hatched surface with clipping\n"
-    "fragment float4 fragment_hatch_phong_clip(\n"
-    "  VertexOutHatch in [[stage_in]],\n"
-    "  constant Uniforms& uniforms       [[buffer(0)]],\n"
-    "  constant LightUniforms& lights    [[buffer(1)]],\n"
-    "  constant HatchUniforms& hatch     [[buffer(2)]],\n"
-    "  constant ClipUniforms& clip       [[buffer(3)]])\n"
-    "{\n"
-    "  // Apply clipping first\n"
-    "  if (isClipped(in.worldPosition, clip)) discard_fragment();\n"
-    "  \n"
-    "  // Calculate hatch mask\n"
-    "  float2 fragCoord = in.position.xy;\n"
-    "  float mask = computeHatchMask(fragCoord, hatch);\n"
-    "  \n"
-    "  if (mask > 0.5) {\n"
-    "    discard_fragment();\n"
-    "  }\n"
-    "  \n"
-    "  // Compute Phong lighting\n"
-    "  float3 N = normalize(in.normal);\n"
-    "  float3 V = normalize(-in.viewPosition);\n"
-    "  if (dot(N, V) < 0.0) N = -N;\n"
-    "  \n"
-    "  float3 result = lights.AmbientColor.rgb * in.color.rgb;\n"
-    "  for (int i = 0; i < lights.LightCount; i++) {\n"
-    "    result += computePhongLight(lights.Lights[i], N, V, in.viewPosition,\n"
-    "                                in.color.rgb, float3(1.0), 32.0,\n"
-    "                                uniforms.modelViewMatrix);\n"
-    "  }\n"
-    "  \n"
-    "  float alpha = in.color.a * (1.0 - mask);\n"
-    "  return float4(saturate(result), alpha);\n"
-    "}\n";
-
-  return aSource;
+  return TCollection_AsciiString(THE_SHADER_MANAGER_SOURCE);
 }
@@ -0,0 +1,56 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef Metal_ShaderProgramKey_HeaderFile
+#define Metal_ShaderProgramKey_HeaderFile
+
+#include <Graphic3d_TypeOfShadingModel.hxx>
+
+#include <cstddef>
+
+//! Shader program configuration key.
+struct Metal_ShaderProgramKey
+{
+  Graphic3d_TypeOfShadingModel ShadingModel;
+  int                          ProgramBits;
+
+  Metal_ShaderProgramKey(Graphic3d_TypeOfShadingModel theModel = Graphic3d_TypeOfShadingModel_Unlit,
+                         int theBits = 0)
+  : ShadingModel(theModel), ProgramBits(theBits) {}
+
+  bool operator==(const Metal_ShaderProgramKey& theOther) const
+  {
+    return ShadingModel == theOther.ShadingModel && ProgramBits == theOther.ProgramBits;
+  }
+
+  size_t HashCode(size_t theUpperBound) const
+  {
+    return (static_cast<size_t>(ShadingModel) * 1000 + ProgramBits) % theUpperBound;
+  }
+};
+
+//! Hash functor for Metal_ShaderProgramKey.
+struct Metal_ShaderProgramKeyHasher
+{
+  size_t operator()(const Metal_ShaderProgramKey& theKey) const noexcept
+  {
+    return static_cast<size_t>(theKey.ShadingModel) * 1000 + theKey.ProgramBits;
+  }
+
+  bool operator()(const Metal_ShaderProgramKey& theKey1, const Metal_ShaderProgramKey& theKey2) const noexcept
+  {
+    return theKey1 == theKey2;
+  }
+};
+
+#endif // Metal_ShaderProgramKey_HeaderFile
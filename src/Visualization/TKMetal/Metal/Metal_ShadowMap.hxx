@@ -15,7 +15,11 @@
 #define Metal_ShadowMap_HeaderFile
 
 #include <Metal_Resource.hxx>
+#include <Graphic3d_BndBox3d.hxx>
+#include <Graphic3d_Camera.hxx>
 #include <Graphic3d_CLight.hxx>
+#include <Graphic3d_Layer.hxx>
+#include <NCollection_List.hxx>
 #include <NCollection_Vec3.hxx>
 #include <NCollection_Vec4.hxx>
 #include <NCollection_Mat4.hxx>
@@ -23,10 +27,34 @@
 typedef NCollection_Vec3<float> Graphic3d_Vec3;
 typedef NCollection_Vec4<float> Graphic3d_Vec4;
 
+#ifdef __OBJC__
+@protocol MTLCommandBuffer;
+@protocol MTLDepthStencilState;
+@protocol MTLRenderPipelineState;
+#endif
+
 class Metal_Context;
 
+//! Shadow uniforms read by material fragment shaders at buffer index 5; should match ShadowUniforms in shader.
+struct Metal_ShadowUniforms
+{
+  float ViewToShadow[4][16]; //!< view space to shadow map space ([0, 1] texture coordinates and depth) of each cascade
+  float SplitFar[4];         //!< far view depth of each cascade
+  int   LightIndex;          //!< index of shadow casting light within Metal_LightUniforms (-1 if none)
+  int   NbCascades;          //!< number of cascades (0 if shadows are disabled)
+  float Bias;                //!< depth bias
+  float Padding;
+};
+
 //! Shadow map resource for shadow mapping rendering.
 //! Creates and manages a depth texture for storing shadow information.
+//!
+//! Directional light uses cascaded shadow map: camera frustum is split by view depth (practical split scheme)
+//! and each split is covered by own layer of depth texture array.
+//! Cascade is fitted with margin and snapped to texels, so that it is kept while camera split remains covered
+//! with sufficient resolution; depth of the cascade is rendered again only when it is re-fitted, or when light,
+//! scene bounds or modification state of shadow casters within cascade change.
+//! Orbiting around static scene therefore re-renders only cascades being re-fitted.
 class Metal_ShadowMap : public Metal_Resource
 {
   DEFINE_STANDARD_RTTIEXT(Metal_ShadowMap, Metal_Resource)
@@ -36,11 +64,16 @@ public:
   //! Default shadow map resolution.
   static const int DefaultShadowMapSize = 1024;
 
+  //! Maximal number of cascades.
+  static const int MaxCascades = 4;
+
   //! Create shadow map resource.
-  //! @param theContext Metal context
-  //! @param theSize shadow map resolution (width = height)
+  //! @param theContext   Metal context
+  //! @param theSize      shadow map resolution (width = height)
+  //! @param theNbCascades number of cascades within [1, MaxCascades]
   Standard_EXPORT Metal_ShadowMap(Metal_Context* theContext,
-                                   int theSize = DefaultShadowMapSize);
+                                   int theSize = DefaultShadowMapSize,
+                                   int theNbCascades = 1);
 
   //! Destructor.
   Standard_EXPORT ~Metal_ShadowMap();
@@ -57,6 +90,15 @@ public:
   //! Return shadow map resolution.
   int Size() const { return mySize; }
 
+  //! Return number of cascades (layers of depth texture array).
+  int NbCascades() const { return myNbCascades; }
+
+  //! Return number of cascades rendered by the last Render() (for statistics).
+  int NbRenderedCascades() const { return myNbRenderedCascades; }
+
+  //! Mark all cascades to be rendered again.
+  void Invalidate() { myIsFitted = false; }
+
   //! Return shadow map bias (to reduce shadow acne).
   float Bias() const { return myBias; }
 
@@ -69,9 +111,30 @@ public:
   //! Set light source for this shadow map.
   void SetLightSource(const occ::handle<Graphic3d_CLight>& theLight) { myLightSource = theLight; }
 
-  //! Return light-space view-projection matrix.
+  //! Return light-space view-projection matrix (of the first cascade).
   const NCollection_Mat4<float>& LightSpaceMatrix() const { return myLightSpaceMatrix; }
 
+  //! Fit cascades to the camera frustum splits for directional light and detect cascades to be rendered again.
+  //! @param theCamera   view camera
+  //! @param theLight    directional light
+  //! @param theSceneBox world-space bounds of shadow casters
+  //! @param theLayers   layers of the view
+  //! @param theViewId   view identification for structure visibility test
+  //! @return TRUE if at least one cascade should be rendered
+  Standard_EXPORT bool UpdateCascades(const occ::handle<Graphic3d_Camera>& theCamera,
+                                      const occ::handle<Graphic3d_CLight>& theLight,
+                                      const Graphic3d_BndBox3d& theSceneBox,
+                                      const NCollection_List<occ::handle<Graphic3d_Layer>>& theLayers,
+                                      int theViewId);
+
+  //! Fill in shader uniforms.
+  //! @param theUniforms   uniforms to fill
+  //! @param theViewMatrix camera orientation matrix (world to view space)
+  //! @param theLightIndex index of the light within Metal_LightUniforms
+  Standard_EXPORT void FillUniforms(Metal_ShadowUniforms& theUniforms,
+                                    const NCollection_Mat4<double>& theViewMatrix,
+                                    int theLightIndex) const;
+
   //! Compute light-space matrix from light source and scene bounds.
   //! @param theLight light source
   //! @param theSceneMin scene bounding box minimum
@@ -82,18 +145,51 @@ public:
     const Graphic3d_Vec3& theSceneMax);
 
 #ifdef __OBJC__
-  //! Return depth texture.
+  //! Return depth texture (2D array with NbCascades() layers).
   id<MTLTexture> DepthTexture() const { return myDepthTexture; }
 
-  //! Return render pass descriptor for shadow map rendering.
+  //! Return render pass descriptor for shadow map rendering (of the first cascade).
   MTLRenderPassDescriptor* RenderPassDescriptor() const { return myRenderPassDesc; }
+
+  //! Encode depth passes of cascades marked by UpdateCascades().
+  //! @param theCmdBuffer frame command buffer (outside of render pass, before main pass)
+  //! @param theLayers    layers of the view
+  //! @param theViewId    view identification for structure visibility test
+  Standard_EXPORT void Render(id<MTLCommandBuffer> theCmdBuffer,
+                              const NCollection_List<occ::handle<Graphic3d_Layer>>& theLayers,
+                              int theViewId);
 #endif
 
 private:
 
+  //! Cascade of shadow map.
+  struct Cascade
+  {
+    NCollection_Mat4<double> LightSpace;  //!< world to light clip space
+    double                   CenterX;     //!< center within light plane
+    double                   CenterY;     //!< center within light plane
+    double                   HalfSize;    //!< half size of covered square within light plane
+    double                   SplitFar;    //!< far view depth of camera split
+    size_t                   CasterState; //!< modification state of casters within cascade
+    bool                     IsDirty;     //!< depth should be rendered again
+
+    Cascade() : CenterX(0.0), CenterY(0.0), HalfSize(0.0), SplitFar(0.0), CasterState(0), IsDirty(true) {}
+  };
+
   //! Initialize shadow map resources.
   bool init();
 
+  //! Create depth pass pipeline.
+  bool initPipeline();
+
+  //! Return TRUE if world-space box overlaps the cascade square within light plane.
+  bool isCasterOfCascade(const Graphic3d_BndBox3d& theBox, const Cascade& theCascade) const;
+
+  //! Compute modification state of shadow casters within cascade.
+  size_t casterState(const Cascade& theCascade,
+                     const NCollection_List<occ::handle<Graphic3d_Layer>>& theLayers,
+                     int theViewId) const;
+
 private:
 
   Metal_Context*                myContext;          //!< Metal context
@@ -102,13 +198,24 @@ private:
   bool                          myIsValid;          //!< Validity flag
   occ::handle<Graphic3d_CLight> myLightSource;      //!< Associated light source
   NCollection_Mat4<float>       myLightSpaceMatrix; //!< Light-space VP matrix
+  Cascade                       myCascades[MaxCascades]; //!< cascades
+  NCollection_Vec3<double>      myLightAxes[3];     //!< light space basis (Z toward the light)
+  double                        myDepthMin;         //!< minimal scene coordinate along light Z axis
+  double                        myDepthMax;         //!< maximal scene coordinate along light Z axis
+  int                           myNbCascades;       //!< number of cascades
+  int                           myNbRenderedCascades; //!< cascades rendered by last Render()
+  bool                          myIsFitted;         //!< cascades have been fitted to the current light and scene
 
 #ifdef __OBJC__
   id<MTLTexture>              myDepthTexture;     //!< Depth texture
   MTLRenderPassDescriptor*    myRenderPassDesc;   //!< Render pass descriptor
+  id<MTLRenderPipelineState>  myPipeline;         //!< depth-only pipeline
+  id<MTLDepthStencilState>    myDepthState;       //!< depth test and write
 #else
   void*                       myDepthTexture;
   void*                       myRenderPassDesc;
+  void*                       myPipeline;
+  void*                       myDepthState;
 #endif
 };
 
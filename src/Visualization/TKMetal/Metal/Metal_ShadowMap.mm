@@ -15,20 +15,152 @@
 
 #include <Metal_ShadowMap.hxx>
 #include <Metal_Context.hxx>
+#include <Metal_Group.hxx>
+#include <Metal_PrimitiveArray.hxx>
+#include <Metal_Structure.hxx>
+
+#include <NCollection_Array1.hxx>
+#include <Precision.hxx>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 
 IMPLEMENT_STANDARD_RTTIEXT(Metal_ShadowMap, Metal_Resource)
 
+namespace
+{
+  //! Depth pass shader.
+  static const char* THE_SHADOW_SHADER = R"(
+#include <metal_stdlib>
+using namespace metal;
+
+struct ShadowVertexOut
+{
+  float4 Position [[position]];
+};
+
+vertex ShadowVertexOut vertex_shadow_depth(uint theVertexId [[vertex_id]],
+                                           const device packed_float3* thePositions [[buffer(0)]],
+                                           constant float4x4& theMvp [[buffer(1)]])
+{
+  ShadowVertexOut anOut;
+  anOut.Position = theMvp * float4(float3(thePositions[theVertexId]), 1.0);
+  return anOut;
+}
+)";
+
+  //! Weight of logarithmic split of practical split scheme (0 - uniform, 1 - logarithmic).
+  static const double THE_SPLIT_LAMBDA = 0.75;
+
+  //! Relative margin of fitted cascade around split bounding sphere.
+  static const double THE_CASCADE_MARGIN = 0.3;
+
+  //! Slope-scaled depth bias of depth pass.
+  static const float THE_SLOPE_BIAS = 1.5f;
+
+  //! Combine hash value.
+  static void hashCombine(size_t& theSeed, size_t theValue)
+  {
+    theSeed ^= theValue + 0x9e3779b9 + (theSeed << 6) + (theSeed >> 2);
+  }
+
+  //! Return TRUE if primitive array produces filled triangles.
+  static bool isTriangleArray(const Metal_PrimitiveArray* theArray)
+  {
+    switch (theArray->Type())
+    {
+      case Graphic3d_TOPA_TRIANGLES:
+      case Graphic3d_TOPA_TRIANGLESTRIPS:
+      case Graphic3d_TOPA_TRIANGLEFANS:
+        return true;
+      default:
+        return false;
+    }
+  }
+
+  //! Return TRUE if structure may cast shadow in the view.
+  static bool isShadowCaster(const Graphic3d_CStructure* theStruct, int theViewId)
+  {
+    // culling flag is computed for the camera frustum, not for the light
+    return theStruct != nullptr
+        && theStruct->IsVisible(theViewId)
+        && theStruct->TransformPersistence().IsNull()
+        && theStruct->BoundingBox().IsValid();
+  }
+
+  //! Accumulate modification state of the structure (including instanced one).
+  static void hashStructure(size_t& theSeed, const Metal_Structure* theStruct)
+  {
+    for (const Metal_Structure* aStruct = theStruct; aStruct != nullptr; aStruct = aStruct->InstancedStructure())
+    {
+      hashCombine(theSeed, reinterpret_cast<size_t>(aStruct));
+      hashCombine(theSeed, aStruct->ModificationState());
+    }
+  }
+
+  //! Encode triangle arrays of the structure (including instanced one).
+  //! @param theMvp light-space matrix of the structure, already bound to the encoder
+  static void encodeStructure(Metal_Context* theCtx,
+                              id<MTLRenderCommandEncoder> theEncoder,
+                              const Metal_Structure* theStruct,
+                              const NCollection_Mat4<float>& theMvp)
+  {
+    if (theStruct->InstancedStructure() != nullptr)
+    {
+      encodeStructure(theCtx, theEncoder, theStruct->InstancedStructure(), theMvp);
+    }
+    for (Metal_Structure::GroupIterator aGroupIter(theStruct->Groups()); aGroupIter.More(); aGroupIter.Next())
+    {
+      const Metal_Group* aGroup = aGroupIter.Value();
+      if (aGroup == nullptr || !theStruct->IsGroupDrawn(*aGroup))
+      {
+        continue;
+      }
+      if (aGroup->HasTransformation())
+      {
+        const NCollection_Mat4<float> aGroupMvp = theMvp * aGroup->TransformationMatrix();
+        [theEncoder setVertexBytes:aGroupMvp.GetData() length:sizeof(float) * 16 atIndex:1];
+      }
+      for (NCollection_List<Metal_PrimitiveArray*>::Iterator aPrimIter(aGroup->Primitives()); aPrimIter.More(); aPrimIter.Next())
+      {
+        Metal_PrimitiveArray* anArray = aPrimIter.Value();
+        if (anArray == nullptr || !isTriangleArray(anArray))
+        {
+          continue;
+        }
+        if (!anArray->IsInitialized())
+        {
+          anArray->Init(theCtx);
+        }
+        anArray->DrawPositions(theEncoder);
+      }
+      if (aGroup->HasTransformation())
+      {
+        [theEncoder setVertexBytes:theMvp.GetData() length:sizeof(float) * 16 atIndex:1];
+      }
+    }
+  }
+}
+
 // =======================================================================
 // function : Metal_ShadowMap
 // purpose  : Constructor
 // =======================================================================
-Metal_ShadowMap::Metal_ShadowMap(Metal_Context* theContext, int theSize)
+Metal_ShadowMap::Metal_ShadowMap(Metal_Context* theContext, int theSize, int theNbCascades)
 : myContext(theContext),
   mySize(theSize),
   myBias(0.005f),
   myIsValid(false),
+  myDepthMin(0.0),
+  myDepthMax(0.0),
+  myNbCascades(std::max(1, std::min(theNbCascades, MaxCascades))),
+  myNbRenderedCascades(0),
+  myIsFitted(false),
   myDepthTexture(nil),
-  myRenderPassDesc(nil)
+  myRenderPassDesc(nil),
+  myPipeline(nil),
+  myDepthState(nil)
 {
   myLightSpaceMatrix.InitIdentity();
   init();
@@ -51,7 +183,10 @@ void Metal_ShadowMap::Release(Metal_Context* /*theCtx*/)
 {
   myDepthTexture = nil;
   myRenderPassDesc = nil;
+  myPipeline = nil;
+  myDepthState = nil;
   myIsValid = false;
+  myIsFitted = false;
 }
 
 // =======================================================================
@@ -65,7 +200,7 @@ size_t Metal_ShadowMap::EstimatedDataSize() const
     return 0;
   }
   // Depth32Float = 4 bytes per pixel
-  return static_cast<size_t>(mySize) * mySize * 4;
+  return static_cast<size_t>(mySize) * mySize * 4 * myNbCascades;
 }
 
 // =======================================================================
@@ -85,11 +220,13 @@ bool Metal_ShadowMap::init()
     return false;
   }
 
-  // Create depth texture descriptor
+  // Create depth texture array with one layer per cascade
   MTLTextureDescriptor* aTexDesc = [MTLTextureDescriptor texture2DDescriptorWithPixelFormat:MTLPixelFormatDepth32Float
                                                                                       width:mySize
                                                                                      height:mySize
                                                                                   mipmapped:NO];
+  aTexDesc.textureType = MTLTextureType2DArray;
+  aTexDesc.arrayLength = static_cast<NSUInteger>(myNbCascades);
   aTexDesc.usage = MTLTextureUsageRenderTarget | MTLTextureUsageShaderRead;
   aTexDesc.storageMode = MTLStorageModePrivate;
 
@@ -109,10 +246,380 @@ bool Metal_ShadowMap::init()
   myRenderPassDesc.depthAttachment.storeAction = MTLStoreActionStore;
   myRenderPassDesc.depthAttachment.clearDepth = 1.0;
 
+  if (!initPipeline())
+  {
+    return false;
+  }
+
   myIsValid = true;
   return true;
 }
 
+// =======================================================================
+// function : initPipeline
+// purpose  : Create depth pass pipeline
+// =======================================================================
+bool Metal_ShadowMap::initPipeline()
+{
+  NSError* anError = nil;
+  id<MTLLibrary> aLibrary = myContext->LoadShaderLibrary("Metal_ShadowMap_THE_SHADOW_SHADER",
+                                                         [NSString stringWithUTF8String:THE_SHADOW_SHADER],
+                                                         nil, &anError);
+  if (aLibrary == nil)
+  {
+    myContext->Messenger()->SendFail() << "Metal_ShadowMap: failed to compile depth pass shader: "
+                                       << (anError != nil ? [[anError localizedDescription] UTF8String] : "");
+    return false;
+  }
+
+  MTLRenderPipelineDescriptor* aPipeDesc = [[MTLRenderPipelineDescriptor alloc] init];
+  aPipeDesc.label = @"ShadowMap";
+  aPipeDesc.vertexFunction = [aLibrary newFunctionWithName:@"vertex_shadow_depth"];
+  aPipeDesc.fragmentFunction = nil;
+  aPipeDesc.depthAttachmentPixelFormat = MTLPixelFormatDepth32Float;
+  aPipeDesc.inputPrimitiveTopology = MTLPrimitiveTopologyClassTriangle;
+  myPipeline = [myContext->Device() newRenderPipelineStateWithDescriptor:aPipeDesc error:&anError];
+  if (myPipeline == nil)
+  {
+    myContext->Messenger()->SendFail() << "Metal_ShadowMap: failed to create depth pass pipeline: "
+                                       << (anError != nil ? [[anError localizedDescription] UTF8String] : "");
+    return false;
+  }
+
+  MTLDepthStencilDescriptor* aDepthDesc = [[MTLDepthStencilDescriptor alloc] init];
+  aDepthDesc.depthCompareFunction = MTLCompareFunctionLess;
+  aDepthDesc.depthWriteEnabled = YES;
+  myDepthState = [myContext->Device() newDepthStencilStateWithDescriptor:aDepthDesc];
+  return myDepthState != nil;
+}
+
+// =======================================================================
+// function : UpdateCascades
+// purpose  : Fit cascades to camera frustum splits
+// =======================================================================
+bool Metal_ShadowMap::UpdateCascades(const occ::handle<Graphic3d_Camera>& theCamera,
+                                     const occ::handle<Graphic3d_CLight>& theLight,
+                                     const Graphic3d_BndBox3d& theSceneBox,
+                                     const NCollection_List<occ::handle<Graphic3d_Layer>>& theLayers,
+                                     int theViewId)
+{
+  if (!myIsValid
+   || theCamera.IsNull()
+   || theLight.IsNull()
+   || theLight->Type() != Graphic3d_TypeOfLightSource_Directional
+   || !theSceneBox.IsValid())
+  {
+    return false;
+  }
+
+  // light space basis, Z axis is directed toward the light (same direction as in shader)
+  const NCollection_Vec4<float>& aDirRange = theLight->PackedDirectionRange();
+  NCollection_Vec3<double> aDir(aDirRange.x(), aDirRange.y(), aDirRange.z());
+  if (aDir.SquareModulus() <= 0.0)
+  {
+    aDir = NCollection_Vec3<double>(0.0, 0.0, -1.0);
+  }
+  const NCollection_Vec3<double> aZAxis = -aDir.Normalized();
+  const NCollection_Vec3<double> anUp = std::abs(aZAxis.y()) > 0.99
+                                      ? NCollection_Vec3<double>(0.0, 0.0, 1.0)
+                                      : NCollection_Vec3<double>(0.0, 1.0, 0.0);
+  const NCollection_Vec3<double> aXAxis = NCollection_Vec3<double>::Cross(anUp, aZAxis).Normalized();
+  const NCollection_Vec3<double> aYAxis = NCollection_Vec3<double>::Cross(aZAxis, aXAxis);
+
+  // scene depth range along light direction
+  double aDepthMin = RealLast(), aDepthMax = RealFirst();
+  const NCollection_Vec3<double>& aBoxMin = theSceneBox.CornerMin();
+  const NCollection_Vec3<double>& aBoxMax = theSceneBox.CornerMax();
+  for (int aCornerIter = 0; aCornerIter < 8; ++aCornerIter)
+  {
+    const NCollection_Vec3<double> aCorner((aCornerIter & 1) != 0 ? aBoxMax.x() : aBoxMin.x(),
+                                           (aCornerIter & 2) != 0 ? aBoxMax.y() : aBoxMin.y(),
+                                           (aCornerIter & 4) != 0 ? aBoxMax.z() : aBoxMin.z());
+    const double aDepth = aZAxis.Dot(aCorner);
+    aDepthMin = std::min(aDepthMin, aDepth);
+    aDepthMax = std::max(aDepthMax, aDepth);
+  }
+
+  // keep cascades while light is the same and scene depth range is only slightly changed
+  const double aDepthRange = std::max(aDepthMax - aDepthMin, Precision::Confusion());
+  if (!myIsFitted
+   || myLightAxes[2].Dot(aZAxis) < 1.0 - 1.0e-9
+   || myLightAxes[0].Dot(aXAxis) < 1.0 - 1.0e-9
+   || aDepthMin < myDepthMin
+   || aDepthMax > myDepthMax
+   || (myDepthMax - myDepthMin) > 2.0 * aDepthRange)
+  {
+    myIsFitted = false;
+    myLightAxes[0] = aXAxis;
+    myLightAxes[1] = aYAxis;
+    myLightAxes[2] = aZAxis;
+    myDepthMin = aDepthMin - 0.1 * aDepthRange;
+    myDepthMax = aDepthMax + 0.1 * aDepthRange;
+  }
+
+  // split camera frustum by view depth
+  NCollection_Array1<NCollection_Vec3<double>> aFrustum(0, Graphic3d_Camera::FrustumVerticesNB - 1);
+  theCamera->FrustumPoints(aFrustum);
+  const double aZNear = std::max(theCamera->ZNear(), Precision::Confusion());
+  const double aZFar  = std::max(theCamera->ZFar(), aZNear + Precision::Confusion());
+  const double aLambda = theCamera->IsOrthographic() ? 0.0 : THE_SPLIT_LAMBDA;
+  static const int THE_NEAR_CORNERS[4] = { Graphic3d_Camera::FrustumVert_LeftBottomNear,  Graphic3d_Camera::FrustumVert_LeftTopNear,
+                                           Graphic3d_Camera::FrustumVert_RightBottomNear, Graphic3d_Camera::FrustumVert_RightTopNear };
+  static const int THE_FAR_CORNERS[4]  = { Graphic3d_Camera::FrustumVert_LeftBottomFar,   Graphic3d_Camera::FrustumVert_LeftTopFar,
+                                           Graphic3d_Camera::FrustumVert_RightBottomFar,  Graphic3d_Camera::FrustumVert_RightTopFar };
+
+  const double aDepthScale = 1.0 / (myDepthMax - myDepthMin);
+  bool hasDirty = false;
+  double aSplitNear = aZNear;
+  for (int aCascadeIter = 0; aCascadeIter < myNbCascades; ++aCascadeIter)
+  {
+    const double aPart = double(aCascadeIter + 1) / double(myNbCascades);
+    const double aSplitLog = aZNear * std::pow(aZFar / aZNear, aPart);
+    const double aSplitUni = aZNear + (aZFar - aZNear) * aPart;
+    const double aSplitFar = aLambda * aSplitLog + (1.0 - aLambda) * aSplitUni;
+
+    // bounding sphere of the split, which size does not depend on camera orientation
+    NCollection_Vec3<double> aCorners[8];
+    NCollection_Vec3<double> aCenter(0.0);
+    for (int aCornerIter = 0; aCornerIter < 4; ++aCornerIter)
+    {
+      const NCollection_Vec3<double>& aNear = aFrustum.Value(THE_NEAR_CORNERS[aCornerIter]);
+      const NCollection_Vec3<double>& aFar  = aFrustum.Value(THE_FAR_CORNERS[aCornerIter]);
+      aCorners[aCornerIter * 2]     = aNear + (aFar - aNear) * ((aSplitNear - aZNear) / (aZFar - aZNear));
+      aCorners[aCornerIter * 2 + 1] = aNear + (aFar - aNear) * ((aSplitFar  - aZNear) / (aZFar - aZNear));
+      aCenter += aCorners[aCornerIter * 2] + aCorners[aCornerIter * 2 + 1];
+    }
+    aCenter /= 8.0;
+    double aRadius = 0.0;
+    for (int aCornerIter = 0; aCornerIter < 8; ++aCornerIter)
+    {
+      aRadius = std::max(aRadius, (aCorners[aCornerIter] - aCenter).Modulus());
+    }
+    aRadius = std::max(aRadius, Precision::Confusion());
+
+    Cascade& aCascade = myCascades[aCascadeIter];
+    aCascade.SplitFar = aSplitFar;
+    const double aCenterX = aXAxis.Dot(aCenter);
+    const double aCenterY = aYAxis.Dot(aCenter);
+    const bool isCovered = myIsFitted
+                        && std::abs(aCenterX - aCascade.CenterX) + aRadius <= aCascade.HalfSize
+                        && std::abs(aCenterY - aCascade.CenterY) + aRadius <= aCascade.HalfSize
+                        && aRadius * (1.0 + THE_CASCADE_MARGIN) >= aCascade.HalfSize * 0.5;
+    if (!isCovered)
+    {
+      // re-fit with margin and snap to texels to avoid shimmering of static shadows
+      aCascade.HalfSize = aRadius * (1.0 + THE_CASCADE_MARGIN);
+      const double aTexel = 2.0 * aCascade.HalfSize / double(mySize);
+      aCascade.CenterX = std::floor(aCenterX / aTexel) * aTexel;
+      aCascade.CenterY = std::floor(aCenterY / aTexel) * aTexel;
+
+      const double aScale = 1.0 / aCascade.HalfSize;
+      aCascade.LightSpace.SetRow(0, NCollection_Vec4<double>(aXAxis * aScale, -aCascade.CenterX * aScale));
+      aCascade.LightSpace.SetRow(1, NCollection_Vec4<double>(aYAxis * aScale, -aCascade.CenterY * aScale));
+      aCascade.LightSpace.SetRow(2, NCollection_Vec4<double>(aZAxis * -aDepthScale, myDepthMax * aDepthScale));
+      aCascade.LightSpace.SetRow(3, NCollection_Vec4<double>(0.0, 0.0, 0.0, 1.0));
+      aCascade.IsDirty = true;
+    }
+    else if (!myIsFitted)
+    {
+      aCascade.IsDirty = true;
+    }
+
+    // casters within cascade have been modified, moved, shown or hidden
+    const size_t aCasterState = casterState(aCascade, theLayers, theViewId);
+    if (aCasterState != aCascade.CasterState)
+    {
+      aCascade.CasterState = aCasterState;
+      aCascade.IsDirty = true;
+    }
+    hasDirty = hasDirty || aCascade.IsDirty;
+    aSplitNear = aSplitFar;
+  }
+
+  myIsFitted = true;
+  myLightSource = theLight;
+  myLightSpaceMatrix.ConvertFrom(myCascades[0].LightSpace);
+  return hasDirty;
+}
+
+// =======================================================================
+// function : isCasterOfCascade
+// purpose  : Check box overlapping with cascade square
+// =======================================================================
+bool Metal_ShadowMap::isCasterOfCascade(const Graphic3d_BndBox3d& theBox,
+                                        const Cascade& theCascade) const
+{
+  const NCollection_Vec3<double>& aMin = theBox.CornerMin();
+  const NCollection_Vec3<double>& aMax = theBox.CornerMax();
+  const NCollection_Vec3<double> aCenter = (aMin + aMax) * 0.5;
+  const NCollection_Vec3<double> aHalf   = (aMax - aMin) * 0.5;
+  for (int anAxisIter = 0; anAxisIter < 2; ++anAxisIter)
+  {
+    // extent of the box projected onto the light axis
+    const NCollection_Vec3<double>& anAxis = myLightAxes[anAxisIter];
+    const double anExtent = std::abs(anAxis.x()) * aHalf.x()
+                          + std::abs(anAxis.y()) * aHalf.y()
+                          + std::abs(anAxis.z()) * aHalf.z();
+    const double aCascadeCenter = anAxisIter == 0 ? theCascade.CenterX : theCascade.CenterY;
+    if (std::abs(anAxis.Dot(aCenter) - aCascadeCenter) > anExtent + theCascade.HalfSize)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// =======================================================================
+// function : casterState
+// purpose  : Compute modification state of casters within cascade
+// =======================================================================
+size_t Metal_ShadowMap::casterState(const Cascade& theCascade,
+                                    const NCollection_List<occ::handle<Graphic3d_Layer>>& theLayers,
+                                    int theViewId) const
+{
+  size_t aState = 0;
+  for (NCollection_List<occ::handle<Graphic3d_Layer>>::Iterator aLayerIter(theLayers); aLayerIter.More(); aLayerIter.Next())
+  {
+    const occ::handle<Graphic3d_Layer>& aLayer = aLayerIter.Value();
+    if (aLayer.IsNull() || aLayer->NbStructures() == 0 || aLayer->IsImmediate())
+    {
+      continue;
+    }
+
+    const Graphic3d_ArrayOfIndexedMapOfStructure& aStructArray = aLayer->ArrayOfStructures();
+    for (int aPriorityIdx = 0; aPriorityIdx < Graphic3d_DisplayPriority_NB; ++aPriorityIdx)
+    {
+      const NCollection_IndexedMap<const Graphic3d_CStructure*>& aStructMap = aStructArray[aPriorityIdx];
+      for (int aStructIdx = 1; aStructIdx <= aStructMap.Extent(); ++aStructIdx)
+      {
+        const Graphic3d_CStructure* aCStruct = aStructMap.FindKey(aStructIdx);
+        if (!isShadowCaster(aCStruct, theViewId)
+         || !isCasterOfCascade(aCStruct->BoundingBox(), theCascade))
+        {
+          continue;
+        }
+        // all structures of the view are created by Metal_GraphicDriver
+        hashStructure(aState, static_cast<const Metal_Structure*>(aCStruct));
+      }
+    }
+  }
+  return aState;
+}
+
+// =======================================================================
+// function : FillUniforms
+// purpose  : Fill in shader uniforms
+// =======================================================================
+void Metal_ShadowMap::FillUniforms(Metal_ShadowUniforms& theUniforms,
+                                   const NCollection_Mat4<double>& theViewMatrix,
+                                   int theLightIndex) const
+{
+  memset(&theUniforms, 0, sizeof(theUniforms));
+  theUniforms.LightIndex = -1;
+  if (!myIsValid || !myIsFitted)
+  {
+    return;
+  }
+
+  NCollection_Mat4<double> aViewInv;
+  theViewMatrix.Inverted(aViewInv);
+
+  // clip space to texture coordinates (Y flipped), depth is kept within [0, 1]
+  NCollection_Mat4<double> aTexMat;
+  aTexMat.SetRow(0, NCollection_Vec4<double>(0.5,  0.0, 0.0, 0.5));
+  aTexMat.SetRow(1, NCollection_Vec4<double>(0.0, -0.5, 0.0, 0.5));
+  for (int aCascadeIter = 0; aCascadeIter < myNbCascades; ++aCascadeIter)
+  {
+    const Cascade& aCascade = myCascades[aCascadeIter];
+    NCollection_Mat4<float> aViewToShadow;
+    aViewToShadow.ConvertFrom(aTexMat * aCascade.LightSpace * aViewInv);
+    memcpy(theUniforms.ViewToShadow[aCascadeIter], aViewToShadow.GetData(), sizeof(theUniforms.ViewToShadow[aCascadeIter]));
+    theUniforms.SplitFar[aCascadeIter] = static_cast<float>(aCascade.SplitFar);
+  }
+  theUniforms.LightIndex = theLightIndex;
+  theUniforms.NbCascades = myNbCascades;
+  theUniforms.Bias = myBias;
+}
+
+// =======================================================================
+// function : Render
+// purpose  : Encode depth passes of modified cascades
+// =======================================================================
+void Metal_ShadowMap::Render(id<MTLCommandBuffer> theCmdBuffer,
+                             const NCollection_List<occ::handle<Graphic3d_Layer>>& theLayers,
+                             int theViewId)
+{
+  myNbRenderedCascades = 0;
+  if (!myIsValid || !myIsFitted || theCmdBuffer == nil)
+  {
+    return;
+  }
+
+  MTLRenderPassDescriptor* aPassDesc = [MTLRenderPassDescriptor renderPassDescriptor];
+  aPassDesc.depthAttachment.texture = myDepthTexture;
+  aPassDesc.depthAttachment.loadAction = MTLLoadActionClear;
+  aPassDesc.depthAttachment.storeAction = MTLStoreActionStore;
+  aPassDesc.depthAttachment.clearDepth = 1.0;
+  const MTLViewport aViewport = { 0.0, 0.0, (double)mySize, (double)mySize, 0.0, 1.0 };
+  for (int aCascadeIter = 0; aCascadeIter < myNbCascades; ++aCascadeIter)
+  {
+    Cascade& aCascade = myCascades[aCascadeIter];
+    if (!aCascade.IsDirty)
+    {
+      continue;
+    }
+
+    aPassDesc.depthAttachment.slice = static_cast<NSUInteger>(aCascadeIter);
+    id<MTLRenderCommandEncoder> anEncoder = [theCmdBuffer renderCommandEncoderWithDescriptor:aPassDesc];
+    if (anEncoder == nil)
+    {
+      return;
+    }
+    anEncoder.label = @"ShadowMap";
+    [anEncoder setViewport:aViewport];
+    [anEncoder setRenderPipelineState:myPipeline];
+    [anEncoder setDepthStencilState:myDepthState];
+    [anEncoder setCullMode:MTLCullModeNone];
+    [anEncoder setDepthBias:0.0f slopeScale:THE_SLOPE_BIAS clamp:0.0f];
+    // casters in front of the scene depth range should still occlude
+    [anEncoder setDepthClipMode:MTLDepthClipModeClamp];
+
+    NCollection_Mat4<float> aLightSpace;
+    aLightSpace.ConvertFrom(aCascade.LightSpace);
+    for (NCollection_List<occ::handle<Graphic3d_Layer>>::Iterator aLayerIter(theLayers); aLayerIter.More(); aLayerIter.Next())
+    {
+      const occ::handle<Graphic3d_Layer>& aLayer = aLayerIter.Value();
+      if (aLayer.IsNull() || aLayer->NbStructures() == 0 || aLayer->IsImmediate())
+      {
+        continue;
+      }
+
+      const Graphic3d_ArrayOfIndexedMapOfStructure& aStructArray = aLayer->ArrayOfStructures();
+      for (int aPriorityIdx = 0; aPriorityIdx < Graphic3d_DisplayPriority_NB; ++aPriorityIdx)
+      {
+        const NCollection_IndexedMap<const Graphic3d_CStructure*>& aStructMap = aStructArray[aPriorityIdx];
+        for (int aStructIdx = 1; aStructIdx <= aStructMap.Extent(); ++aStructIdx)
+        {
+          const Graphic3d_CStructure* aCStruct = aStructMap.FindKey(aStructIdx);
+          if (!isShadowCaster(aCStruct, theViewId)
+           || !isCasterOfCascade(aCStruct->BoundingBox(), aCascade))
+          {
+            continue;
+          }
+
+          const Metal_Structure* aStruct = static_cast<const Metal_Structure*>(aCStruct);
+          const NCollection_Mat4<float> aMvp = aLightSpace * aStruct->RenderTransformation();
+          [anEncoder setVertexBytes:aMvp.GetData() length:sizeof(float) * 16 atIndex:1];
+          encodeStructure(myContext, anEncoder, aStruct, aMvp);
+        }
+      }
+    }
+    [anEncoder endEncoding];
+    aCascade.IsDirty = false;
+    ++myNbRenderedCascades;
+  }
+}
+
 // =======================================================================
 // function : ComputeLightSpaceMatrix
 // purpose  : Compute light-space view-projection matrix
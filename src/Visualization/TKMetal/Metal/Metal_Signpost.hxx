@@ -0,0 +1,59 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#ifndef Metal_Signpost_HeaderFile
+#define Metal_Signpost_HeaderFile
+
+#include <Standard_Macro.hxx>
+
+#include <cstdint>
+
+//! Scoped os_signpost interval marking a phase of the frame (culling, sorting, encoding of a layer, commit)
+//! within "Points of Interest" of Instruments, so that CPU time of the frame can be attributed to phases
+//! in release builds. Intervals are not emitted (and cost a single check) while no recording session is active.
+//! Interval should be ended on the same thread it has been started.
+class Metal_Signpost
+{
+public:
+
+  //! Begin interval.
+  //! @param theName phase name; the string should stay alive till the end of interval
+  Metal_Signpost(const char* theName) : myName(theName), myId(0) { begin(false, 0); }
+
+  //! Begin interval with a value displayed together with the name (like Z-layer id).
+  Metal_Signpost(const char* theName, int theValue) : myName(theName), myId(0) { begin(true, theValue); }
+
+  //! End interval, if not yet ended.
+  ~Metal_Signpost() { End(); }
+
+  //! End interval before destruction.
+  Standard_EXPORT void End();
+
+private:
+
+  //! Emit interval begin, if recording is active.
+  Standard_EXPORT void begin(bool theHasValue, int theValue);
+
+private:
+
+  Metal_Signpost(const Metal_Signpost&) = delete;
+  Metal_Signpost& operator=(const Metal_Signpost&) = delete;
+
+private:
+
+  const char* myName; //!< phase name
+  uint64_t    myId;   //!< signpost id, 0 if interval is not emitted
+};
+
+#endif // Metal_Signpost_HeaderFile
@@ -0,0 +1,72 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#include <Metal_Signpost.hxx>
+
+#include <os/signpost.h>
+
+namespace
+{
+  //! Return log of frame phases shown as Points of Interest.
+  static os_log_t signpostLog()
+  {
+    static os_log_t THE_LOG = os_log_create("org.opencascade.TKMetal", OS_LOG_CATEGORY_POINTS_OF_INTEREST);
+    return THE_LOG;
+  }
+}
+
+// =======================================================================
+// function : begin
+// purpose  : Begin interval
+// =======================================================================
+void Metal_Signpost::begin(bool theHasValue, int theValue)
+{
+  if (@available(macOS 10.14, iOS 12.0, *))
+  {
+    os_log_t aLog = signpostLog();
+    if (!os_signpost_enabled(aLog))
+    {
+      return;
+    }
+
+    const os_signpost_id_t anId = os_signpost_id_generate(aLog);
+    if (theHasValue)
+    {
+      os_signpost_interval_begin(aLog, anId, "Metal_View", "%{public}s %d", myName, theValue);
+    }
+    else
+    {
+      os_signpost_interval_begin(aLog, anId, "Metal_View", "%{public}s", myName);
+    }
+    myId = anId;
+  }
+}
+
+// =======================================================================
+// function : End
+// purpose  : End interval
+// =======================================================================
+void Metal_Signpost::End()
+{
+  if (myId == 0)
+  {
+    return;
+  }
+
+  if (@available(macOS 10.14, iOS 12.0, *))
+  {
+    os_signpost_interval_end(signpostLog(), os_signpost_id_t(myId), "Metal_View", "%{public}s", myName);
+  }
+  myId = 0;
+}
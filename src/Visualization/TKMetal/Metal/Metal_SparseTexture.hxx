@@ -0,0 +1,165 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef Metal_SparseTexture_HeaderFile
+#define Metal_SparseTexture_HeaderFile
+
+#include <Metal_Texture.hxx>
+#include <NCollection_Array1.hxx>
+
+#ifdef __OBJC__
+@protocol MTLBuffer;
+@protocol MTLCommandBuffer;
+@protocol MTLHeap;
+@protocol MTLRenderPipelineState;
+#endif
+
+class Metal_SparseTextureLoader;
+
+//! Very large 2D texture streamed by tiles into sparse texture (MTLHeapTypeSparse),
+//! so that GPU memory scales with the visible part of the image rather than with the image size.
+//! The image stays in CPU memory, its mip pyramid is built on a background queue.
+//!
+//! Residency is driven by GPU feedback:
+//! - EndFrame() reads texture access counters of the tiles sampled by the frame;
+//! - BeginFrame() of the frame reusing the same slot schedules copies of accessed but not mapped tiles
+//!   into staging buffers on a background queue, maps the tiles which have been copied
+//!   and uploads them by blits ordered before the main pass;
+//! - least recently accessed tiles are unmapped once the heap (Metal_Caps::streamedTextureBudget) is full.
+//! The mip tail and the coarsest levels are always resident and are used as fallback
+//! by sparse sampling of not yet resident tiles (see BackgroundPipeline()).
+class Metal_SparseTexture : public Metal_Texture
+{
+  DEFINE_STANDARD_RTTIEXT(Metal_SparseTexture, Metal_Texture)
+public:
+
+  //! Maximum number of tiles requested from background queue per frame.
+  static const int MaxRequestsPerFrame = 64;
+
+  //! Return TRUE if device supports sparse textures with access counters (Apple6 GPU family).
+  Standard_EXPORT static bool IsSupported(const Metal_Context* theCtx);
+
+  //! Create texture for a very large image (see Metal_Caps::streamedTextureMinSize):
+  //! sparse texture streamed by tiles when supported, otherwise regular texture
+  //! of the image downsampled to fit Metal_Caps::streamedTextureBudget.
+  //! @return NULL on failure
+  Standard_EXPORT static occ::handle<Metal_Texture> CreateStreamed(Metal_Context* theCtx,
+                                                               const occ::handle<Image_PixMap>& theImage);
+
+  //! Return image downsampled by 2x2 box filter, or NULL if pixel format is not supported
+  //! (only formats with 8-bit or 32-bit float components are handled).
+  Standard_EXPORT static occ::handle<Image_PixMap> DownsampleHalf(const Image_PixMap& theImage);
+
+public:
+
+  //! Empty constructor.
+  Standard_EXPORT Metal_SparseTexture();
+
+  //! Destructor.
+  Standard_EXPORT ~Metal_SparseTexture() override;
+
+  //! Create sparse texture with full mip chain and start building CPU mip pyramid on background queue.
+  //! @param theCtx    Metal context
+  //! @param theImage  source image, kept referenced until texture release
+  //! @param theBudget size of sparse heap in bytes
+  Standard_EXPORT bool Init(Metal_Context* theCtx,
+                            const occ::handle<Image_PixMap>& theImage,
+                            size_t theBudget);
+
+  //! Return TRUE when fallback levels are resident and texture can be sampled.
+  bool IsReady() const { return myIsReady; }
+
+  //! Return TRUE if tiles are still being loaded, so that the view should be redrawn.
+  bool HasPendingTiles() const { return !myIsReady || myNbPending > 0; }
+
+  //! Return the finest always resident mip level; used as LOD clamp of sampling not resident tiles.
+  float FallbackLod() const { return (float)myFirstPinnedLevel; }
+
+  //! Return the number of streamed (not pinned) tiles currently mapped.
+  int NbResidentTiles() const { return myNbMapped; }
+
+  //! Return the number of tiles of streamed levels.
+  int NbTiles() const { return myTiles.Size(); }
+
+  //! Map tiles loaded by background queue and unmap least recently used ones;
+  //! should be called before encoding passes sampling the texture.
+  //! Counters read by the frame submitted with the current frame slot are processed here,
+  //! so that the call should follow Metal_Context::WaitForFrame().
+  Standard_EXPORT void BeginFrame(Metal_Context* theCtx, void* theCmdBuffer);
+
+  //! Encode readback of texture access counters of the frame;
+  //! should be called after encoding passes sampling the texture.
+  Standard_EXPORT void EndFrame(Metal_Context* theCtx, void* theCmdBuffer);
+
+#ifdef __OBJC__
+  //! Return background pipeline using sparse sampling with fallback to resident levels
+  //! (same uniforms as textured background of Metal_View, with fallback LOD in place of padding).
+  Standard_EXPORT id<MTLRenderPipelineState> BackgroundPipeline(Metal_Context* theCtx);
+#endif
+
+  //! Release GPU resources and stop background loading.
+  Standard_EXPORT void Release(Metal_Context* theCtx) override;
+
+protected:
+
+  //! Map mip tail and pinned levels and upload them from CPU pyramid.
+  bool uploadPinnedLevels(Metal_Context* theCtx, void* theCmdBuffer);
+
+  //! Return index of tile within myTiles.
+  int tileIndex(int theLevel, int theX, int theY) const
+  {
+    return myLevelOffsets.Value(theLevel) + theY * myLevelTiles.Value(theLevel).x() + theX;
+  }
+
+protected:
+
+  //! Residency state of streamed tile.
+  struct TileState
+  {
+    int  LastAccess; //!< frame number of the last access
+    bool IsMapped;   //!< tile is mapped
+    bool IsPending;  //!< tile is being copied by background queue
+
+    TileState() : LastAccess(-1), IsMapped(false), IsPending(false) {}
+  };
+
+protected:
+
+#ifdef __OBJC__
+  id<MTLHeap>                myHeap;         //!< sparse heap
+  id<MTLRenderPipelineState> myBgPipeline;   //!< background pipeline with sparse sampling
+  id<MTLBuffer>              myCounters;     //!< access counters of all frame slots
+#else
+  void*                      myHeap;
+  void*                      myBgPipeline;
+  void*                      myCounters;
+#endif
+  occ::handle<Metal_SparseTextureLoader> myLoader; //!< state shared with background queue
+  NCollection_Array1<bool>   mySlotEncoded;  //!< counters have been encoded for the frame slot
+  NCollection_Array1<int>    myLevelOffsets; //!< first tile of the level within myTiles
+  NCollection_Array1<NCollection_Vec2<int>> myLevelTiles; //!< number of tiles of the level
+  NCollection_Array1<TileState> myTiles;     //!< state of tiles of streamed levels
+  NCollection_Vec2<int>      myTileSize;     //!< tile size in pixels
+  size_t                     myTileBytes;    //!< tile size in bytes
+  int                        myFirstTailLevel;   //!< first mip level within the mip tail
+  int                        myFirstPinnedLevel; //!< first always resident level
+  int                        myMaxMapped;    //!< maximum number of streamed tiles fitting the heap
+  int                        myNbMapped;     //!< number of mapped streamed tiles
+  int                        myNbPending;    //!< number of tiles being copied
+  int                        myFrameNo;      //!< frame counter
+  bool                       myIsReady;      //!< pinned levels are resident
+};
+
+DEFINE_STANDARD_HANDLE(Metal_SparseTexture, Metal_Texture)
+
+#endif // Metal_SparseTexture_HeaderFile
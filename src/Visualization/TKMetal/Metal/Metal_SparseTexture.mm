@@ -0,0 +1,856 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+// Import Apple frameworks first to avoid Handle name conflicts with Carbon
+#import <Metal/Metal.h>
+#import <dispatch/dispatch.h>
+
+// Now include OCCT headers
+#include <Metal_SparseTexture.hxx>
+#include <Metal_Context.hxx>
+#include <Message.hxx>
+#include <NCollection_Buffer.hxx>
+#include <NCollection_Vector.hxx>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <mutex>
+
+IMPLEMENT_STANDARD_RTTIEXT(Metal_SparseTexture, Metal_Texture)
+
+namespace
+{
+  //! Maximum number of tiles of always resident levels above the mip tail.
+  static const int THE_MAX_PINNED_TILES = 21;
+
+  //! Metal shader sampling sparse texture with fallback to always resident levels.
+  static const char* THE_SPARSE_BACKGROUND_SHADER = R"(
+#include <metal_stdlib>
+using namespace metal;
+
+struct SparseBgVertexOut
+{
+  float4 position [[position]];
+  float2 texCoord;
+};
+
+// same layout as textured background uniforms of Metal_View
+struct SparseBgUniforms
+{
+  float2 textureScale;
+  float2 textureOffset;
+  float2 viewportSize;
+  int    fillMethod; // 0=stretch, 1=tile, 2=center
+  float  fallbackLod;
+};
+
+vertex SparseBgVertexOut sparseBgVertex(uint vid [[vertex_id]])
+{
+  const float2 aPositions[3] = { float2(-1.0, -1.0), float2(3.0, -1.0), float2(-1.0, 3.0) };
+  SparseBgVertexOut anOut;
+  anOut.position = float4(aPositions[vid], 0.0, 1.0);
+  anOut.texCoord = aPositions[vid] * 0.5 + 0.5;
+  return anOut;
+}
+
+fragment float4 sparseBgFragment(SparseBgVertexOut in [[stage_in]],
+                                 constant SparseBgUniforms& uniforms [[buffer(0)]],
+                                 texture2d<float> backgroundTexture [[texture(0)]],
+                                 sampler textureSampler [[sampler(0)]])
+{
+  float2 uv = in.texCoord;
+  if (uniforms.fillMethod == 2)
+  {
+    uv = (uv - float2(0.5)) * uniforms.textureScale + float2(0.5) + uniforms.textureOffset;
+    if (uv.x < 0.0 || uv.x > 1.0 || uv.y < 0.0 || uv.y > 1.0)
+    {
+      return float4(0.0, 0.0, 0.0, 1.0);
+    }
+  }
+  else
+  {
+    uv = uv * uniforms.textureScale + uniforms.textureOffset;
+  }
+  uv.y = 1.0 - uv.y;
+
+  // tiles not yet streamed in are replaced by always resident coarse levels
+  const sparse_color<float4> aColor = backgroundTexture.sparse_sample(textureSampler, uv);
+  if (aColor.resident())
+  {
+    return aColor.value();
+  }
+  return backgroundTexture.sample(textureSampler, uv, min_lod_clamp(uniforms.fallbackLod));
+}
+)";
+
+  //! Copy rectangle of the image into tightly packed buffer of texture pixel format.
+  static void copyImageRect(const Image_PixMap& theImage,
+                            int theX, int theY, int theWidth, int theHeight,
+                            int theDstBytesPerPixel,
+                            uint8_t* theDst)
+  {
+    const uint8_t* aSrc = theImage.Data() + size_t(theY) * theImage.SizeRowBytes()
+                                          + size_t(theX) * theImage.SizePixelBytes();
+    if (Metal_Texture::NeedsFormatConversion(theImage.Format()))
+    {
+      Metal_Texture::ConvertImageFormat(aSrc, theDst, theWidth, theHeight,
+                                        theImage.SizeRowBytes(), theImage.Format(), theDstBytesPerPixel);
+      return;
+    }
+
+    const size_t aRowBytes = size_t(theWidth) * theDstBytesPerPixel;
+    for (int aRow = 0; aRow < theHeight; ++aRow)
+    {
+      std::memcpy(theDst + aRow * aRowBytes, aSrc + aRow * theImage.SizeRowBytes(), aRowBytes);
+    }
+  }
+
+  //! Return component type handled by downsampling: 1 for 8-bit, 2 for 32-bit float, 0 if not supported.
+  static int downsampleComponentType(Image_Format theFormat)
+  {
+    switch (theFormat)
+    {
+      case Image_Format_Gray:
+      case Image_Format_Alpha:
+      case Image_Format_RGB:
+      case Image_Format_BGR:
+      case Image_Format_RGB32:
+      case Image_Format_BGR32:
+      case Image_Format_RGBA:
+      case Image_Format_BGRA:
+        return 1;
+      case Image_Format_GrayF:
+      case Image_Format_AlphaF:
+      case Image_Format_RGF:
+      case Image_Format_RGBF:
+      case Image_Format_BGRF:
+      case Image_Format_RGBAF:
+      case Image_Format_BGRAF:
+        return 2;
+      default:
+        return 0;
+    }
+  }
+
+  //! Average 2x2 pixels of components of specified type.
+  template<typename T>
+  static void downsampleRows(const Image_PixMap& theSrc, Image_PixMap& theDst, int theNbComps)
+  {
+    const int aMaxX = (int)theSrc.SizeX() - 1;
+    const int aMaxY = (int)theSrc.SizeY() - 1;
+    for (size_t aRow = 0; aRow < theDst.SizeY(); ++aRow)
+    {
+      const T* aRow0 = (const T*)theSrc.Row(std::min((int)aRow * 2,     aMaxY));
+      const T* aRow1 = (const T*)theSrc.Row(std::min((int)aRow * 2 + 1, aMaxY));
+      T* aDstRow = (T*)theDst.ChangeRow(aRow);
+      for (size_t aCol = 0; aCol < theDst.SizeX(); ++aCol)
+      {
+        const int aX0 = std::min((int)aCol * 2,     aMaxX) * theNbComps;
+        const int aX1 = std::min((int)aCol * 2 + 1, aMaxX) * theNbComps;
+        for (int aComp = 0; aComp < theNbComps; ++aComp)
+        {
+          const float aSum = float(aRow0[aX0 + aComp]) + float(aRow0[aX1 + aComp])
+                           + float(aRow1[aX0 + aComp]) + float(aRow1[aX1 + aComp]);
+          aDstRow[aCol * theNbComps + aComp] = std::is_floating_point<T>::value
+                                             ? T(aSum * 0.25f)
+                                             : T(aSum * 0.25f + 0.5f);
+        }
+      }
+    }
+  }
+}
+
+//! State shared between sparse texture and blocks of its background queue.
+class Metal_SparseTextureLoader : public Standard_Transient
+{
+public:
+
+  //! Tile copied by background queue.
+  struct LoadedTile
+  {
+    int Index;  //!< tile index
+    int Level;  //!< mip level
+    int X, Y;   //!< origin in pixels
+    int Width;  //!< width in pixels
+    int Height; //!< height in pixels
+    occ::handle<NCollection_Buffer> Data; //!< packed pixels
+  };
+
+public:
+
+  Metal_SparseTextureLoader()
+  : Queue(dispatch_queue_create("Metal_SparseTexture", DISPATCH_QUEUE_SERIAL)),
+    IsPyramidReady(false),
+    IsCancelled(false) {}
+
+  dispatch_queue_t                              Queue;          //!< serial background queue
+  NCollection_Vector<occ::handle<Image_PixMap>> Levels;         //!< CPU mip pyramid
+  std::atomic<bool>                             IsPyramidReady; //!< pyramid has been built
+  std::atomic<bool>                             IsCancelled;    //!< texture has been released
+  std::mutex                                    Mutex;          //!< lock of Ready list
+  NCollection_Vector<LoadedTile>                Ready;          //!< tiles waiting for upload
+};
+
+// =======================================================================
+// function : IsSupported
+// purpose  : Check sparse textures support
+// =======================================================================
+bool Metal_SparseTexture::IsSupported(const Metal_Context* theCtx)
+{
+  if (theCtx == nullptr || theCtx->Device() == nil)
+  {
+    return false;
+  }
+  if (@available(macOS 11.0, iOS 13.0, *))
+  {
+    return [theCtx->Device() supportsFamily:MTLGPUFamilyApple6];
+  }
+  return false;
+}
+
+// =======================================================================
+// function : DownsampleHalf
+// purpose  : Downsample image by 2x2 box filter
+// =======================================================================
+occ::handle<Image_PixMap> Metal_SparseTexture::DownsampleHalf(const Image_PixMap& theImage)
+{
+  const int aNbComps = (int)Image_PixMap::SizePixelBytes(theImage.Format());
+  const int aCompType = downsampleComponentType(theImage.Format());
+  if (aCompType == 0 || theImage.IsEmpty())
+  {
+    return occ::handle<Image_PixMap>();
+  }
+
+  occ::handle<Image_PixMap> aDst = new Image_PixMap();
+  if (!aDst->InitTrash(theImage.Format(),
+                       std::max(theImage.SizeX() / 2, size_t(1)),
+                       std::max(theImage.SizeY() / 2, size_t(1))))
+  {
+    return occ::handle<Image_PixMap>();
+  }
+  aDst->SetTopDown(theImage.IsTopDown());
+  if (aCompType == 2)
+  {
+    downsampleRows<float>(theImage, *aDst, aNbComps / (int)sizeof(float));
+  }
+  else
+  {
+    downsampleRows<uint8_t>(theImage, *aDst, aNbComps);
+  }
+  return aDst;
+}
+
+// =======================================================================
+// function : CreateStreamed
+// purpose  : Create texture for a very large image
+// =======================================================================
+occ::handle<Metal_Texture> Metal_SparseTexture::CreateStreamed(Metal_Context* theCtx,
+                                                             const occ::handle<Image_PixMap>& theImage)
+{
+  if (theCtx == nullptr || theImage.IsNull() || theImage->IsEmpty())
+  {
+    return occ::handle<Metal_Texture>();
+  }
+
+  const size_t aBudget = theCtx->Caps()->streamedTextureBudget;
+  if (IsSupported(theCtx))
+  {
+    occ::handle<Metal_SparseTexture> aSparse = new Metal_SparseTexture();
+    if (aSparse->Init(theCtx, theImage, aBudget))
+    {
+      return aSparse;
+    }
+    aSparse->Release(theCtx);
+  }
+
+  // without sparse textures, drop the finest levels until the mip chain fits the budget
+  occ::handle<Image_PixMap> anImage = theImage;
+  const int aBytesPerPixel = BytesPerPixel(ToMetalPixelFormat(theImage->Format()));
+  while (!anImage.IsNull()
+       && anImage->SizeX() * anImage->SizeY() * aBytesPerPixel * 4 / 3 > aBudget
+       && (anImage->SizeX() > 1 || anImage->SizeY() > 1))
+  {
+    anImage = DownsampleHalf(*anImage);
+  }
+  if (anImage.IsNull())
+  {
+    anImage = theImage;
+  }
+  else if (anImage != theImage)
+  {
+    theCtx->Messenger()->SendInfo() << "Metal_SparseTexture: image " << (int)theImage->SizeX() << "x" << (int)theImage->SizeY()
+                                    << " is downsampled to " << (int)anImage->SizeX() << "x" << (int)anImage->SizeY()
+                                    << " to fit texture memory budget";
+  }
+
+  occ::handle<Metal_Texture> aTexture = new Metal_Texture();
+  if (!aTexture->Create2D(theCtx, *anImage, true))
+  {
+    aTexture->Release(theCtx);
+    return occ::handle<Metal_Texture>();
+  }
+  return aTexture;
+}
+
+// =======================================================================
+// function : Metal_SparseTexture
+// purpose  : Constructor
+// =======================================================================
+Metal_SparseTexture::Metal_SparseTexture()
+: myHeap(nil),
+  myBgPipeline(nil),
+  myCounters(nil),
+  myTileSize(0, 0),
+  myTileBytes(0),
+  myFirstTailLevel(0),
+  myFirstPinnedLevel(0),
+  myMaxMapped(0),
+  myNbMapped(0),
+  myNbPending(0),
+  myFrameNo(0),
+  myIsReady(false)
+{
+  //
+}
+
+// =======================================================================
+// function : ~Metal_SparseTexture
+// purpose  : Destructor
+// =======================================================================
+Metal_SparseTexture::~Metal_SparseTexture()
+{
+  if (!myLoader.IsNull())
+  {
+    myLoader->IsCancelled = true;
+  }
+}
+
+// =======================================================================
+// function : Init
+// purpose  : Create sparse texture
+// =======================================================================
+bool Metal_SparseTexture::Init(Metal_Context* theCtx,
+                               const occ::handle<Image_PixMap>& theImage,
+                               size_t theBudget)
+{
+  Release(theCtx);
+  if (!IsSupported(theCtx) || theImage.IsNull() || theImage->IsEmpty()
+   || downsampleComponentType(theImage->Format()) == 0)
+  {
+    return false;
+  }
+
+  if (@available(macOS 11.0, iOS 13.0, *))
+  {
+    id<MTLDevice> aDevice = theCtx->Device();
+    myPixelFormat = ToMetalPixelFormat(theImage->Format(), false);
+    if (myPixelFormat == 0)
+    {
+      return false;
+    }
+
+    myWidth  = (int)theImage->SizeX();
+    myHeight = (int)theImage->SizeY();
+    myDepth = 1;
+    myArrayLayers = 1;
+    myTextureType = Metal_TextureType_2D;
+    myMipLevels = 1;
+    for (int aSize = std::max(myWidth, myHeight); aSize > 1; aSize /= 2)
+    {
+      ++myMipLevels;
+    }
+
+    const MTLSize aTileSize = [aDevice sparseTileSizeWithTextureType:MTLTextureType2D
+                                                         pixelFormat:(MTLPixelFormat)myPixelFormat
+                                                         sampleCount:1];
+    myTileSize.SetValues((int)aTileSize.width, (int)aTileSize.height);
+    myTileBytes = aDevice.sparseTileSizeInBytes;
+    if (myTileSize.x() <= 0 || myTileSize.y() <= 0 || myTileBytes == 0)
+    {
+      return false;
+    }
+
+    MTLHeapDescriptor* aHeapDesc = [[MTLHeapDescriptor alloc] init];
+    aHeapDesc.type = MTLHeapTypeSparse;
+    aHeapDesc.storageMode = MTLStorageModePrivate;
+    aHeapDesc.size = (theBudget + myTileBytes - 1) / myTileBytes * myTileBytes;
+    myHeap = [aDevice newHeapWithDescriptor:aHeapDesc];
+
+    MTLTextureDescriptor* aDesc = [MTLTextureDescriptor texture2DDescriptorWithPixelFormat:(MTLPixelFormat)myPixelFormat
+                                                                                     width:myWidth
+                                                                                    height:myHeight
+                                                                                 mipmapped:YES];
+    aDesc.storageMode = MTLStorageModePrivate;
+    aDesc.usage = MTLTextureUsageShaderRead;
+    myTexture = myHeap != nil ? [myHeap newTextureWithDescriptor:aDesc] : nil;
+    if (myTexture == nil)
+    {
+      Release(theCtx);
+      return false;
+    }
+
+    // the coarsest levels above the mip tail are always resident as fallback of not yet streamed tiles
+    myFirstTailLevel = std::min((int)myTexture.firstMipmapInTail, myMipLevels);
+    myFirstPinnedLevel = myFirstTailLevel;
+    int aNbPinnedTiles = 0;
+    for (int aLevel = myFirstTailLevel - 1; aLevel >= 0; --aLevel)
+    {
+      const int aLevelW = std::max(myWidth  >> aLevel, 1);
+      const int aLevelH = std::max(myHeight >> aLevel, 1);
+      const int aNbTiles = ((aLevelW + myTileSize.x() - 1) / myTileSize.x())
+                         * ((aLevelH + myTileSize.y() - 1) / myTileSize.y());
+      if (aNbPinnedTiles + aNbTiles > THE_MAX_PINNED_TILES)
+      {
+        break;
+      }
+      aNbPinnedTiles += aNbTiles;
+      myFirstPinnedLevel = aLevel;
+    }
+
+    const size_t aTailTiles = (myTexture.tailSizeInBytes + myTileBytes - 1) / myTileBytes;
+    myMaxMapped = int(aHeapDesc.size / myTileBytes) - int(aTailTiles) - aNbPinnedTiles;
+    if (myMaxMapped <= 0)
+    {
+      theCtx->Messenger()->SendWarning() << "Metal_SparseTexture: texture memory budget is too small";
+      Release(theCtx);
+      return false;
+    }
+
+    // tiles of streamed levels
+    int aNbTiles = 0;
+    if (myFirstPinnedLevel > 0)
+    {
+      myLevelOffsets.Resize(0, myFirstPinnedLevel - 1, false);
+      myLevelTiles.Resize(0, myFirstPinnedLevel - 1, false);
+      for (int aLevel = 0; aLevel < myFirstPinnedLevel; ++aLevel)
+      {
+        const int aLevelW = std::max(myWidth  >> aLevel, 1);
+        const int aLevelH = std::max(myHeight >> aLevel, 1);
+        const NCollection_Vec2<int> aLevelTiles((aLevelW + myTileSize.x() - 1) / myTileSize.x(),
+                                                (aLevelH + myTileSize.y() - 1) / myTileSize.y());
+        myLevelOffsets.SetValue(aLevel, aNbTiles);
+        myLevelTiles.SetValue(aLevel, aLevelTiles);
+        aNbTiles += aLevelTiles.x() * aLevelTiles.y();
+      }
+      myTiles.Resize(0, aNbTiles - 1, false);
+      myTiles.Init(TileState());
+    }
+
+    // access counters are read back per frame slot, to be processed once the frame is completed
+    const int aNbSlots = std::max(theCtx->Caps()->maxFramesInFlight, 1);
+    mySlotEncoded.Resize(0, aNbSlots - 1, false);
+    mySlotEncoded.Init(false);
+    if (aNbTiles > 0)
+    {
+      myCounters = [aDevice newBufferWithLength:size_t(aNbTiles) * sizeof(uint32_t) * aNbSlots
+                                        options:MTLResourceStorageModeShared];
+      if (myCounters == nil)
+      {
+        Release(theCtx);
+        return false;
+      }
+    }
+
+    // build CPU mip pyramid on background queue
+    myLoader = new Metal_SparseTextureLoader();
+    occ::handle<Metal_SparseTextureLoader> aLoader = myLoader;
+    occ::handle<Image_PixMap> anImage = theImage;
+    const int aNbLevels = myMipLevels;
+    dispatch_async(myLoader->Queue, ^{
+      aLoader->Levels.Append(anImage);
+      for (int aLevel = 1; aLevel < aNbLevels && !aLoader->IsCancelled; ++aLevel)
+      {
+        occ::handle<Image_PixMap> aMip = DownsampleHalf(*aLoader->Levels.Last());
+        if (aMip.IsNull())
+        {
+          return;
+        }
+        aLoader->Levels.Append(aMip);
+      }
+      aLoader->IsPyramidReady = !aLoader->IsCancelled;
+    });
+
+    myEstimatedSize = aHeapDesc.size;
+    return true;
+  }
+  return false;
+}
+
+// =======================================================================
+// function : uploadPinnedLevels
+// purpose  : Map mip tail and pinned levels
+// =======================================================================
+bool Metal_SparseTexture::uploadPinnedLevels(Metal_Context* theCtx, void* theCmdBuffer)
+{
+  id<MTLCommandBuffer> aCmdBuffer = (__bridge id<MTLCommandBuffer>)theCmdBuffer;
+  if (@available(macOS 11.0, iOS 13.0, *))
+  {
+    id<MTLResourceStateCommandEncoder> aStateEncoder = [aCmdBuffer resourceStateCommandEncoder];
+    for (int aLevel = myFirstPinnedLevel; aLevel < myFirstTailLevel; ++aLevel)
+    {
+      const int aLevelW = std::max(myWidth  >> aLevel, 1);
+      const int aLevelH = std::max(myHeight >> aLevel, 1);
+      [aStateEncoder updateTextureMapping:myTexture
+                                     mode:MTLSparseTextureMappingModeMap
+                                   region:MTLRegionMake2D(0, 0,
+                                                          (aLevelW + myTileSize.x() - 1) / myTileSize.x(),
+                                                          (aLevelH + myTileSize.y() - 1) / myTileSize.y())
+                                 mipLevel:aLevel
+                                    slice:0];
+    }
+    if (myFirstTailLevel < myMipLevels)
+    {
+      // the whole mip tail is mapped by its first level
+      [aStateEncoder updateTextureMapping:myTexture
+                                     mode:MTLSparseTextureMappingModeMap
+                                   region:MTLRegionMake2D(0, 0, 1, 1)
+                                 mipLevel:myFirstTailLevel
+                                    slice:0];
+    }
+    [aStateEncoder endEncoding];
+
+    const int aBytesPerPixel = BytesPerPixel(myPixelFormat);
+    id<MTLBlitCommandEncoder> aBlit = [aCmdBuffer blitCommandEncoder];
+    for (int aLevel = myFirstPinnedLevel; aLevel < myMipLevels; ++aLevel)
+    {
+      const Image_PixMap& anImage = *myLoader->Levels.Value(aLevel);
+      const int aLevelW = (int)anImage.SizeX();
+      const int aLevelH = (int)anImage.SizeY();
+      id<MTLBuffer> aStaging = [theCtx->Device() newBufferWithLength:size_t(aLevelW) * aLevelH * aBytesPerPixel
+                                                            options:MTLResourceStorageModeShared];
+      if (aStaging == nil)
+      {
+        [aBlit endEncoding];
+        return false;
+      }
+      copyImageRect(anImage, 0, 0, aLevelW, aLevelH, aBytesPerPixel, (uint8_t*)[aStaging contents]);
+      [aBlit copyFromBuffer:aStaging
+               sourceOffset:0
+          sourceBytesPerRow:size_t(aLevelW) * aBytesPerPixel
+        sourceBytesPerImage:size_t(aLevelW) * aLevelH * aBytesPerPixel
+                 sourceSize:MTLSizeMake(aLevelW, aLevelH, 1)
+                  toTexture:myTexture
+           destinationSlice:0
+           destinationLevel:aLevel
+          destinationOrigin:MTLOriginMake(0, 0, 0)];
+    }
+    [aBlit endEncoding];
+    return true;
+  }
+  return false;
+}
+
+// =======================================================================
+// function : BeginFrame
+// purpose  : Update tiles residency
+// =======================================================================
+void Metal_SparseTexture::BeginFrame(Metal_Context* theCtx, void* theCmdBuffer)
+{
+  id<MTLCommandBuffer> aCmdBuffer = (__bridge id<MTLCommandBuffer>)theCmdBuffer;
+  if (myTexture == nil || myLoader.IsNull() || aCmdBuffer == nil
+   || !myLoader->IsPyramidReady)
+  {
+    return;
+  }
+
+  ++myFrameNo;
+  if (!myIsReady)
+  {
+    myIsReady = uploadPinnedLevels(theCtx, theCmdBuffer);
+    return;
+  }
+  if (myTiles.IsEmpty())
+  {
+    return;
+  }
+
+  // process access counters of the completed frame of this slot;
+  // coarse levels are requested first, so that the image is refined progressively
+  const int aSlot = theCtx->CurrentFrameIndex() % mySlotEncoded.Size();
+  NCollection_Vector<int> aRequests;
+  if (mySlotEncoded.Value(aSlot))
+  {
+    mySlotEncoded.ChangeValue(aSlot) = false;
+    const uint32_t* aCounters = (const uint32_t*)[myCounters contents] + size_t(aSlot) * myTiles.Size();
+    for (int aLevel = myFirstPinnedLevel - 1; aLevel >= 0; --aLevel)
+    {
+      const int aFirst = myLevelOffsets.Value(aLevel);
+      const int aLast  = aFirst + myLevelTiles.Value(aLevel).x() * myLevelTiles.Value(aLevel).y();
+      for (int aTileIter = aFirst; aTileIter < aLast; ++aTileIter)
+      {
+        if (aCounters[aTileIter] == 0)
+        {
+          continue;
+        }
+
+        TileState& aTile = myTiles.ChangeValue(aTileIter);
+        aTile.LastAccess = myFrameNo;
+        if (!aTile.IsMapped && !aTile.IsPending
+         && aRequests.Size() < MaxRequestsPerFrame)
+        {
+          aTile.IsPending = true;
+          aRequests.Append(aTileIter);
+        }
+      }
+    }
+  }
+
+  // copy requested tiles into staging memory on background queue
+  for (NCollection_Vector<int>::Iterator aReqIter(aRequests); aReqIter.More(); aReqIter.Next())
+  {
+    const int aTileIndex = aReqIter.Value();
+    int aLevel = myFirstPinnedLevel - 1;
+    while (myLevelOffsets.Value(aLevel) > aTileIndex)
+    {
+      --aLevel;
+    }
+    const int aTileInLevel = aTileIndex - myLevelOffsets.Value(aLevel);
+    const int aTilesX = myLevelTiles.Value(aLevel).x();
+    const int aLevelW = std::max(myWidth  >> aLevel, 1);
+    const int aLevelH = std::max(myHeight >> aLevel, 1);
+
+    Metal_SparseTextureLoader::LoadedTile aLoad;
+    aLoad.Index  = aTileIndex;
+    aLoad.Level  = aLevel;
+    aLoad.X      = (aTileInLevel % aTilesX) * myTileSize.x();
+    aLoad.Y      = (aTileInLevel / aTilesX) * myTileSize.y();
+    aLoad.Width  = std::min(myTileSize.x(), aLevelW - aLoad.X);
+    aLoad.Height = std::min(myTileSize.y(), aLevelH - aLoad.Y);
+    const int aBytesPerPixel = BytesPerPixel(myPixelFormat);
+    occ::handle<Metal_SparseTextureLoader> aLoader = myLoader;
+    ++myNbPending;
+    dispatch_async(myLoader->Queue, ^{
+      if (aLoader->IsCancelled)
+      {
+        return;
+      }
+      Metal_SparseTextureLoader::LoadedTile aTile = aLoad;
+      aTile.Data = new NCollection_Buffer(NCollection_BaseAllocator::CommonBaseAllocator(),
+                                          size_t(aTile.Width) * aTile.Height * aBytesPerPixel);
+      copyImageRect(*aLoader->Levels.Value(aTile.Level), aTile.X, aTile.Y, aTile.Width, aTile.Height,
+                    aBytesPerPixel, aTile.Data->ChangeData());
+      std::lock_guard<std::mutex> aLock(aLoader->Mutex);
+      aLoader->Ready.Append(aTile);
+    });
+  }
+
+  // fetch copied tiles
+  NCollection_Vector<Metal_SparseTextureLoader::LoadedTile> aReady;
+  {
+    std::lock_guard<std::mutex> aLock(myLoader->Mutex);
+    aReady = myLoader->Ready;
+    myLoader->Ready.Clear();
+  }
+  if (aReady.IsEmpty())
+  {
+    return;
+  }
+  myNbPending -= aReady.Size();
+
+  // least recently accessed tiles are unmapped to make room for the new ones;
+  // tiles accessed by the last processed frame are never evicted
+  NCollection_Vector<int> anEvicted;
+  const int aNbToEvict = myNbMapped + aReady.Size() - myMaxMapped;
+  if (aNbToEvict > 0)
+  {
+    NCollection_Vector<int> aCandidates;
+    for (int aTileIter = myTiles.Lower(); aTileIter <= myTiles.Upper(); ++aTileIter)
+    {
+      const TileState& aTile = myTiles.Value(aTileIter);
+      if (aTile.IsMapped && aTile.LastAccess < myFrameNo)
+      {
+        aCandidates.Append(aTileIter);
+      }
+    }
+    std::sort(aCandidates.begin(), aCandidates.end(), [this](int theLeft, int theRight)
+    {
+      return myTiles.Value(theLeft).LastAccess < myTiles.Value(theRight).LastAccess;
+    });
+    for (int aCandIter = 0; aCandIter < std::min(aNbToEvict, aCandidates.Size()); ++aCandIter)
+    {
+      anEvicted.Append(aCandidates.Value(aCandIter));
+    }
+  }
+
+  if (@available(macOS 11.0, iOS 13.0, *))
+  {
+    id<MTLResourceStateCommandEncoder> aStateEncoder = [aCmdBuffer resourceStateCommandEncoder];
+    for (NCollection_Vector<int>::Iterator anEvictIter(anEvicted); anEvictIter.More(); anEvictIter.Next())
+    {
+      const int aTileIndex = anEvictIter.Value();
+      int aLevel = myFirstPinnedLevel - 1;
+      while (myLevelOffsets.Value(aLevel) > aTileIndex)
+      {
+        --aLevel;
+      }
+      const int aTileInLevel = aTileIndex - myLevelOffsets.Value(aLevel);
+      const int aTilesX = myLevelTiles.Value(aLevel).x();
+      [aStateEncoder updateTextureMapping:myTexture
+                                     mode:MTLSparseTextureMappingModeUnmap
+                                   region:MTLRegionMake2D(aTileInLevel % aTilesX, aTileInLevel / aTilesX, 1, 1)
+                                 mipLevel:aLevel
+                                    slice:0];
+      myTiles.ChangeValue(aTileIndex).IsMapped = false;
+      --myNbMapped;
+    }
+
+    // tiles not fitting the heap are dropped and requested again by next accesses
+    NCollection_Vector<Metal_SparseTextureLoader::LoadedTile> aMapped;
+    for (NCollection_Vector<Metal_SparseTextureLoader::LoadedTile>::Iterator aTileIter(aReady); aTileIter.More(); aTileIter.Next())
+    {
+      const Metal_SparseTextureLoader::LoadedTile& aLoad = aTileIter.Value();
+      TileState& aTile = myTiles.ChangeValue(aLoad.Index);
+      aTile.IsPending = false;
+      if (myNbMapped >= myMaxMapped)
+      {
+        continue;
+      }
+
+      [aStateEncoder updateTextureMapping:myTexture
+                                     mode:MTLSparseTextureMappingModeMap
+                                   region:MTLRegionMake2D(aLoad.X / myTileSize.x(), aLoad.Y / myTileSize.y(), 1, 1)
+                                 mipLevel:aLoad.Level
+                                    slice:0];
+      aTile.IsMapped = true;
+      ++myNbMapped;
+      aMapped.Append(aLoad);
+    }
+    [aStateEncoder endEncoding];
+
+    if (aMapped.IsEmpty())
+    {
+      return;
+    }
+
+    const int aBytesPerPixel = BytesPerPixel(myPixelFormat);
+    id<MTLBlitCommandEncoder> aBlit = [aCmdBuffer blitCommandEncoder];
+    for (NCollection_Vector<Metal_SparseTextureLoader::LoadedTile>::Iterator aTileIter(aMapped); aTileIter.More(); aTileIter.Next())
+    {
+      const Metal_SparseTextureLoader::LoadedTile& aLoad = aTileIter.Value();
+      id<MTLBuffer> aStaging = [theCtx->Device() newBufferWithBytes:aLoad.Data->Data()
+                                                             length:aLoad.Data->Size()
+                                                            options:MTLResourceStorageModeShared];
+      if (aStaging == nil)
+      {
+        continue;
+      }
+      [aBlit copyFromBuffer:aStaging
+               sourceOffset:0
+          sourceBytesPerRow:size_t(aLoad.Width) * aBytesPerPixel
+        sourceBytesPerImage:aLoad.Data->Size()
+                 sourceSize:MTLSizeMake(aLoad.Width, aLoad.Height, 1)
+                  toTexture:myTexture
+           destinationSlice:0
+           destinationLevel:aLoad.Level
+          destinationOrigin:MTLOriginMake(aLoad.X, aLoad.Y, 0)];
+    }
+    [aBlit endEncoding];
+  }
+}
+
+// =======================================================================
+// function : EndFrame
+// purpose  : Encode readback of access counters
+// =======================================================================
+void Metal_SparseTexture::EndFrame(Metal_Context* theCtx, void* theCmdBuffer)
+{
+  id<MTLCommandBuffer> aCmdBuffer = (__bridge id<MTLCommandBuffer>)theCmdBuffer;
+  if (!myIsReady || myTiles.IsEmpty() || myCounters == nil || aCmdBuffer == nil)
+  {
+    return;
+  }
+
+  if (@available(macOS 11.0, iOS 13.0, *))
+  {
+    const int aSlot = theCtx->CurrentFrameIndex() % mySlotEncoded.Size();
+    id<MTLBlitCommandEncoder> aBlit = [aCmdBuffer blitCommandEncoder];
+    for (int aLevel = 0; aLevel < myFirstPinnedLevel; ++aLevel)
+    {
+      const NCollection_Vec2<int>& aLevelTiles = myLevelTiles.Value(aLevel);
+      [aBlit getTextureAccessCounters:myTexture
+                               region:MTLRegionMake2D(0, 0, aLevelTiles.x(), aLevelTiles.y())
+                             mipLevel:aLevel
+                                slice:0
+                        resetCounters:YES
+                       countersBuffer:myCounters
+                 countersBufferOffset:(size_t(aSlot) * myTiles.Size() + myLevelOffsets.Value(aLevel)) * sizeof(uint32_t)];
+    }
+    [aBlit endEncoding];
+    mySlotEncoded.ChangeValue(aSlot) = true;
+  }
+}
+
+// =======================================================================
+// function : BackgroundPipeline
+// purpose  : Return background pipeline with sparse sampling
+// =======================================================================
+id<MTLRenderPipelineState> Metal_SparseTexture::BackgroundPipeline(Metal_Context* theCtx)
+{
+  if (myBgPipeline != nil || theCtx == nullptr)
+  {
+    return myBgPipeline;
+  }
+
+  NSError* anError = nil;
+  id<MTLLibrary> aLibrary = theCtx->LoadShaderLibrary("Metal_SparseTexture_THE_SPARSE_BACKGROUND_SHADER",
+                                                      [NSString stringWithUTF8String:THE_SPARSE_BACKGROUND_SHADER],
+                                                      nil, &anError);
+  if (aLibrary == nil)
+  {
+    theCtx->Messenger()->SendFail() << "Metal_SparseTexture: failed to compile shaders: "
+                                    << (anError != nil ? [[anError localizedDescription] UTF8String] : "");
+    return nil;
+  }
+
+  MTLRenderPipelineDescriptor* aPipeDesc = [[MTLRenderPipelineDescriptor alloc] init];
+  aPipeDesc.label = @"SparseBackground";
+  aPipeDesc.vertexFunction = [aLibrary newFunctionWithName:@"sparseBgVertex"];
+  aPipeDesc.fragmentFunction = [aLibrary newFunctionWithName:@"sparseBgFragment"];
+  aPipeDesc.colorAttachments[0].pixelFormat = MTLPixelFormatBGRA8Unorm;
+  aPipeDesc.depthAttachmentPixelFormat = MTLPixelFormatDepth32Float;
+  myBgPipeline = [theCtx->Device() newRenderPipelineStateWithDescriptor:aPipeDesc error:&anError];
+  if (myBgPipeline == nil)
+  {
+    theCtx->Messenger()->SendFail() << "Metal_SparseTexture: failed to create background pipeline: "
+                                    << (anError != nil ? [[anError localizedDescription] UTF8String] : "");
+  }
+  return myBgPipeline;
+}
+
+// =======================================================================
+// function : Release
+// purpose  : Release GPU resources
+// =======================================================================
+void Metal_SparseTexture::Release(Metal_Context* theCtx)
+{
+  if (!myLoader.IsNull())
+  {
+    myLoader->IsCancelled = true;
+    myLoader.Nullify();
+  }
+
+  Metal_Texture::Release(theCtx);
+  myHeap = nil;
+  myBgPipeline = nil;
+  myCounters = nil;
+  myTiles.Resize(0, -1, false);
+  myLevelOffsets.Resize(0, -1, false);
+  myLevelTiles.Resize(0, -1, false);
+  myFirstTailLevel = 0;
+  myFirstPinnedLevel = 0;
+  myMaxMapped = 0;
+  myNbMapped = 0;
+  myNbPending = 0;
+  myIsReady = false;
+}
@@ -0,0 +1,142 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef Metal_StagingRing_HeaderFile
+#define Metal_StagingRing_HeaderFile
+
+#include <Standard_Transient.hxx>
+
+#include <atomic>
+#include <mutex>
+
+#ifdef __OBJC__
+@protocol MTLBlitCommandEncoder;
+@protocol MTLBuffer;
+@protocol MTLCommandBuffer;
+#endif
+
+class Metal_Context;
+
+//! Ring of CPU-visible staging memory for uploading data into GPU-private buffers.
+//! Upload() copies data into the ring and encodes a blit into a dedicated upload command buffer,
+//! which is committed by Flush() before the frame command buffer (see Metal_Context::Commit()),
+//! so that the frame always reads uploaded data.
+//! Uploads into new resources might be encoded into a command buffer of Metal_Context::TransferQueue()
+//! instead, running concurrently with frames in flight; Flush() makes the main queue wait for it
+//! (see Metal_Context::WaitTransfer()) before the upload and frame command buffers.
+//! The ring space of the submitted uploads is reclaimed by command buffer completion handler.
+//! Uploads larger than half of the ring use a temporary staging buffer.
+//! Upload() and Flush() are thread-safe for lazy buffers creation by parallel encoding.
+class Metal_StagingRing : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(Metal_StagingRing, Standard_Transient)
+public:
+
+  //! Default ring size (8 MiB).
+  static constexpr size_t DefaultSize = 8 * 1024 * 1024;
+
+public:
+
+  //! Empty constructor.
+  Standard_EXPORT Metal_StagingRing();
+
+  //! Destructor.
+  Standard_EXPORT ~Metal_StagingRing() override;
+
+  //! Allocate ring buffer.
+  Standard_EXPORT bool Init(Metal_Context* theCtx, size_t theSize = DefaultSize);
+
+  //! Wait for submitted uploads and release the ring.
+  Standard_EXPORT void Release();
+
+  //! Return ring size in bytes.
+  size_t Size() const { return mySize; }
+
+  //! Return the number of ring bytes occupied by not yet completed uploads.
+  size_t UsedBytes() const { return myReservedTotal - myReclaimedTotal.load(); }
+
+  //! Return TRUE if there are encoded but not submitted uploads.
+  bool HasPendingUploads() const
+  {
+    return myUploadCmdBuffer != nullptr || myTransferCmdBuffer != nullptr;
+  }
+
+#ifdef __OBJC__
+  //! Copy data into the destination buffer (normally with private storage).
+  //! Offset should be a multiple of 4 bytes (blit requirement on macOS),
+  //! and destination should have space for the size rounded up to 4 bytes.
+  //! @param theCtx       Metal context
+  //! @param theData      source data
+  //! @param theSize      data size in bytes
+  //! @param theDst       destination buffer
+  //! @param theDstOffset offset within destination buffer
+  //! @param theToTransfer encode into transfer command buffer (see Metal_Context::TransferQueue()),
+  //!                      which is not ordered with other GPU work - allowed only for destination
+  //!                      not accessed by submitted command buffers (like newly allocated one)
+  //! @return FALSE on failure
+  Standard_EXPORT bool Upload(Metal_Context* theCtx,
+                              const void* theData,
+                              size_t theSize,
+                              id<MTLBuffer> theDst,
+                              size_t theDstOffset,
+                              bool theToTransfer = false);
+
+  //! Return blit encoder of the upload command buffer (created on demand),
+  //! for other GPU copies which should be ordered with uploads.
+  //! Should not be called while uploads are performed from other threads.
+  //! @param theCtx        Metal context
+  //! @param theToTransfer return encoder of transfer command buffer (see Upload())
+  Standard_EXPORT id<MTLBlitCommandEncoder> BlitEncoder(Metal_Context* theCtx,
+                                                        bool theToTransfer = false);
+#endif
+
+  //! Submit encoded uploads; should be called before committing the command buffer using uploaded data.
+  //! @return transfer submitted to Metal_Context::TransferQueue() (see Metal_Context::CommitTransfer()),
+  //!         already waited by the main queue
+  Standard_EXPORT uint64_t Flush();
+
+protected:
+
+  //! Reserve ring space; flushes and waits for GPU when the ring is full.
+  //! @return offset within the ring or -1 if the size does not fit
+  Standard_EXPORT long long reserve(size_t theSize);
+
+  //! Mark ring space up to the specified total as reclaimed (called from completion handlers).
+  Standard_EXPORT void advanceReclaimed(size_t theTotal);
+
+protected:
+
+#ifdef __OBJC__
+  id<MTLBuffer>             myBuffer;          //!< ring buffer (shared storage)
+  id<MTLCommandBuffer>      myUploadCmdBuffer; //!< command buffer collecting uploads
+  id<MTLBlitCommandEncoder> myBlitEncoder;     //!< active blit encoder of upload command buffer
+  id<MTLCommandBuffer>      myTransferCmdBuffer; //!< command buffer collecting uploads on transfer queue
+  id<MTLBlitCommandEncoder> myTransferEncoder; //!< active blit encoder of transfer command buffer
+  id<MTLCommandBuffer>      myLastSubmitted;   //!< last submitted upload command buffer
+#else
+  void*                     myBuffer;
+  void*                     myUploadCmdBuffer;
+  void*                     myBlitEncoder;
+  void*                     myTransferCmdBuffer;
+  void*                     myTransferEncoder;
+  void*                     myLastSubmitted;
+#endif
+  Metal_Context*      myCtx;            //!< context owning the ring
+  size_t              mySize;           //!< ring size
+  size_t              myReservedTotal;  //!< total bytes ever reserved (including wrap padding)
+  size_t              mySubmittedTotal; //!< reserved total at the moment of last submission
+  std::atomic<size_t> myReclaimedTotal; //!< total bytes reclaimed by completed uploads
+  std::recursive_mutex myMutex;         //!< lock for thread-safety (Upload() may flush)
+};
+
+#endif // Metal_StagingRing_HeaderFile
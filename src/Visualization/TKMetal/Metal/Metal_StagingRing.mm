@@ -0,0 +1,305 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#import <Metal/Metal.h>
+
+#include <Metal_StagingRing.hxx>
+#include <Metal_Context.hxx>
+
+#include <cstring>
+
+IMPLEMENT_STANDARD_RTTIEXT(Metal_StagingRing, Standard_Transient)
+
+namespace
+{
+  //! Alignment of staging ranges.
+  static const size_t THE_STAGING_ALIGNMENT = 16;
+
+  //! Round value up to the power-of-two alignment.
+  static size_t alignUp(size_t theValue, size_t theAlignment)
+  {
+    return (theValue + theAlignment - 1) & ~(theAlignment - 1);
+  }
+}
+
+// =======================================================================
+// function : Metal_StagingRing
+// purpose  : Constructor
+// =======================================================================
+Metal_StagingRing::Metal_StagingRing()
+: myBuffer(nil),
+  myUploadCmdBuffer(nil),
+  myBlitEncoder(nil),
+  myTransferCmdBuffer(nil),
+  myTransferEncoder(nil),
+  myLastSubmitted(nil),
+  myCtx(nullptr),
+  mySize(0),
+  myReservedTotal(0),
+  mySubmittedTotal(0),
+  myReclaimedTotal(0)
+{
+  //
+}
+
+// =======================================================================
+// function : ~Metal_StagingRing
+// purpose  : Destructor
+// =======================================================================
+Metal_StagingRing::~Metal_StagingRing()
+{
+  Release();
+}
+
+// =======================================================================
+// function : Init
+// purpose  : Allocate ring buffer
+// =======================================================================
+bool Metal_StagingRing::Init(Metal_Context* theCtx, size_t theSize)
+{
+  Release();
+  if (theCtx == nullptr || !theCtx->IsValid() || theSize == 0)
+  {
+    return false;
+  }
+
+  mySize = alignUp(theSize, THE_STAGING_ALIGNMENT);
+  myBuffer = [theCtx->Device() newBufferWithLength:mySize
+                                           options:MTLResourceStorageModeShared | MTLResourceCPUCacheModeWriteCombined];
+  if (myBuffer == nil)
+  {
+    mySize = 0;
+    return false;
+  }
+  myBuffer.label = @"Metal_StagingRing";
+  myCtx = theCtx;
+  return true;
+}
+
+// =======================================================================
+// function : Release
+// purpose  : Wait for submitted uploads and release the ring
+// =======================================================================
+void Metal_StagingRing::Release()
+{
+  std::lock_guard<std::recursive_mutex> aLock(myMutex);
+  Flush();
+  if (myLastSubmitted != nil)
+  {
+    // completion handlers refer to this object
+    [myLastSubmitted waitUntilCompleted];
+    myLastSubmitted = nil;
+  }
+
+  myBuffer = nil;
+  myCtx = nullptr;
+  mySize = 0;
+  myReservedTotal = 0;
+  mySubmittedTotal = 0;
+  myReclaimedTotal.store(0);
+}
+
+// =======================================================================
+// function : advanceReclaimed
+// purpose  : Mark ring space as reclaimed
+// =======================================================================
+void Metal_StagingRing::advanceReclaimed(size_t theTotal)
+{
+  // handlers of different command buffers and the CPU wait might race - never move backwards
+  size_t aPrev = myReclaimedTotal.load();
+  while (aPrev < theTotal
+      && !myReclaimedTotal.compare_exchange_weak(aPrev, theTotal))
+  {
+    //
+  }
+}
+
+// =======================================================================
+// function : reserve
+// purpose  : Reserve ring space
+// =======================================================================
+long long Metal_StagingRing::reserve(size_t theSize)
+{
+  const size_t anAlignedSize = alignUp(theSize, THE_STAGING_ALIGNMENT);
+  if (myBuffer == nil || anAlignedSize > mySize / 2)
+  {
+    return -1;
+  }
+
+  for (;;)
+  {
+    const size_t aPos = myReservedTotal % mySize;
+    // range should be contiguous - skip the tail of the ring when it is too short
+    const size_t aPad = aPos + anAlignedSize > mySize ? mySize - aPos : 0;
+    if (UsedBytes() + aPad + anAlignedSize <= mySize)
+    {
+      myReservedTotal += aPad + anAlignedSize;
+      return (long long)((aPos + aPad) % mySize);
+    }
+
+    // ring is full - submit pending uploads and wait for GPU
+    Flush();
+    if (myLastSubmitted == nil)
+    {
+      return -1;
+    }
+    [myLastSubmitted waitUntilCompleted];
+    advanceReclaimed(mySubmittedTotal);
+  }
+}
+
+// =======================================================================
+// function : BlitEncoder
+// purpose  : Return blit encoder of the upload command buffer
+// =======================================================================
+id<MTLBlitCommandEncoder> Metal_StagingRing::BlitEncoder(Metal_Context* theCtx,
+                                                         bool theToTransfer)
+{
+  std::lock_guard<std::recursive_mutex> aLock(myMutex);
+  if (theToTransfer && (myCtx == nullptr || myCtx->TransferEvent() == nil))
+  {
+    // transfers are executed by the main queue anyway
+    theToTransfer = false;
+  }
+
+  id<MTLBlitCommandEncoder>& anEncoder = theToTransfer ? myTransferEncoder : myBlitEncoder;
+  if (anEncoder != nil)
+  {
+    return anEncoder;
+  }
+  if (theCtx == nullptr || !theCtx->IsValid())
+  {
+    return nil;
+  }
+
+  if (theToTransfer)
+  {
+    if (myTransferCmdBuffer == nil)
+    {
+      myTransferCmdBuffer = theCtx->CreateTransferCommandBuffer();
+      myTransferCmdBuffer.label = @"Metal_StagingRing transfers";
+    }
+    myTransferEncoder = [myTransferCmdBuffer blitCommandEncoder];
+    return myTransferEncoder;
+  }
+
+  if (myUploadCmdBuffer == nil)
+  {
+    myUploadCmdBuffer = theCtx->CreateCommandBuffer();
+    myUploadCmdBuffer.label = @"Metal_StagingRing uploads";
+  }
+  myBlitEncoder = [myUploadCmdBuffer blitCommandEncoder];
+  return myBlitEncoder;
+}
+
+// =======================================================================
+// function : Upload
+// purpose  : Copy data into the destination buffer
+// =======================================================================
+bool Metal_StagingRing::Upload(Metal_Context* theCtx,
+                               const void* theData,
+                               size_t theSize,
+                               id<MTLBuffer> theDst,
+                               size_t theDstOffset,
+                               bool theToTransfer)
+{
+  std::lock_guard<std::recursive_mutex> aLock(myMutex);
+  if (theCtx == nullptr || theData == nullptr || theSize == 0 || theDst == nil)
+  {
+    return false;
+  }
+
+  // blit size should be a multiple of 4 bytes on macOS
+  const size_t aCopySize = alignUp(theSize, 4);
+  id<MTLBuffer> aSrcBuffer = myBuffer;
+  size_t aSrcOffset = 0;
+  const long long aRingOffset = reserve(aCopySize);
+  if (aRingOffset >= 0)
+  {
+    aSrcOffset = size_t(aRingOffset);
+  }
+  else
+  {
+    // too large for the ring - temporary buffer is retained by the command buffer till completion
+    aSrcBuffer = [theCtx->Device() newBufferWithLength:aCopySize
+                                               options:MTLResourceStorageModeShared];
+    if (aSrcBuffer == nil)
+    {
+      return false;
+    }
+  }
+  std::memcpy(static_cast<uint8_t*>([aSrcBuffer contents]) + aSrcOffset, theData, theSize);
+
+  id<MTLBlitCommandEncoder> anEncoder = BlitEncoder(theCtx, theToTransfer);
+  if (anEncoder == nil)
+  {
+    return false;
+  }
+  [anEncoder copyFromBuffer:aSrcBuffer
+               sourceOffset:aSrcOffset
+                   toBuffer:theDst
+          destinationOffset:theDstOffset
+                       size:aCopySize];
+  return true;
+}
+
+// =======================================================================
+// function : Flush
+// purpose  : Submit encoded uploads
+// =======================================================================
+uint64_t Metal_StagingRing::Flush()
+{
+  std::lock_guard<std::recursive_mutex> aLock(myMutex);
+  if (myUploadCmdBuffer == nil
+   && myTransferCmdBuffer == nil)
+  {
+    return 0;
+  }
+
+  if (myBlitEncoder != nil)
+  {
+    [myBlitEncoder endEncoding];
+    myBlitEncoder = nil;
+  }
+  if (myTransferEncoder != nil)
+  {
+    [myTransferEncoder endEncoding];
+    myTransferEncoder = nil;
+  }
+
+  // uploads on the main queue wait for transfers, so that the last one to complete reclaims the ring space
+  id<MTLCommandBuffer> aLastCmdBuffer = myUploadCmdBuffer != nil ? myUploadCmdBuffer : myTransferCmdBuffer;
+  const size_t aTotal = myReservedTotal;
+  Metal_StagingRing* aRing = this;
+  [aLastCmdBuffer addCompletedHandler:^(id<MTLCommandBuffer> /* buffer */)
+  {
+    aRing->advanceReclaimed(aTotal);
+  }];
+
+  uint64_t aTransfer = 0;
+  if (myTransferCmdBuffer != nil)
+  {
+    aTransfer = myCtx->CommitTransfer(myTransferCmdBuffer);
+    myCtx->WaitTransfer(aTransfer);
+    myTransferCmdBuffer = nil;
+  }
+  if (myUploadCmdBuffer != nil)
+  {
+    [myUploadCmdBuffer commit];
+    myUploadCmdBuffer = nil;
+  }
+
+  myLastSubmitted = aLastCmdBuffer;
+  mySubmittedTotal = aTotal;
+  return aTransfer;
+}
@@ -18,6 +18,7 @@
 #include <Standard_Handle.hxx>
 #include <Graphic3d_StereoMode.hxx>
 #include <NCollection_Mat4.hxx>
+#include <NCollection_Vec2.hxx>
 
 #ifdef __OBJC__
 #import <Metal/Metal.h>
@@ -34,17 +35,28 @@ struct Metal_StereoUniforms
   float TexOffset[2];                     //!< Texture offset for smooth interlacing
   int   ReverseStereo;                    //!< Flag to swap left/right eyes
   int   Padding;                          //!< Padding for alignment
+  float ScreenSize[2];                    //!< Screen size of eye image in pixels (decoding of rasterization rate map)
+  float Padding2[2];                      //!< Padding for alignment
 };
 
 //! Metal stereo image composer.
 //! Combines left and right eye images using various stereo modes
 //! (anaglyph, interlaced, side-by-side, over-under, etc.)
+//!
+//! Optional foveation rasterization rate map (InitRateMap()) shades periphery of each eye at reduced rate:
+//! eyes are rendered into textures of RateMapPhysicalSize() with RateMap() assigned to their render passes,
+//! and compose pass decodes physical coordinates of the map while sampling them.
+//! Both eyes might be rendered in a single pass with vertex amplification (SetupVertexAmplification())
+//! into two slices of array texture, which are composed by ComposeLayered().
 class Metal_StereoComposer : public Standard_Transient
 {
   DEFINE_STANDARD_RTTIEXT(Metal_StereoComposer, Standard_Transient)
 
 public:
 
+  //! Number of eyes (layers of rate map and slices of layered target).
+  static const int NbEyes = 2;
+
   //! Create empty stereo composer.
   Standard_EXPORT Metal_StereoComposer();
 
@@ -62,6 +74,55 @@ public:
   //! Return true if composer is valid.
   bool IsValid() const { return myIsValid; }
 
+  //! Create foveation rasterization rate map for eye images.
+  //! Shading rate is full within central region and falls off to theMinRate towards image borders.
+  //! @param theCtx         Metal context
+  //! @param theScreenSize  logical size of eye image
+  //! @param theInnerRadius relative radius of full rate central region within [0, 1]
+  //! @param theMinRate     shading rate at image borders within (0, 1]
+  //! @return FALSE if rate maps are unsupported by device
+  Standard_EXPORT bool InitRateMap(Metal_Context* theCtx,
+                                   const NCollection_Vec2<int>& theScreenSize,
+                                   float theInnerRadius = 0.4f,
+                                   float theMinRate = 0.25f);
+
+  //! Release rasterization rate map; eye images are sampled directly.
+  Standard_EXPORT void ReleaseRateMap();
+
+  //! Return true if rasterization rate map has been created.
+  bool HasRateMap() const { return myRateMap != nil; }
+
+  //! Return logical size of eye image of rasterization rate map.
+  const NCollection_Vec2<int>& RateMapScreenSize() const { return myRateMapScreenSize; }
+
+  //! Return size of eye textures to be rendered with rasterization rate map.
+  const NCollection_Vec2<int>& RateMapPhysicalSize() const { return myRateMapPhysicalSize; }
+
+#ifdef __OBJC__
+  //! Return rasterization rate map to be assigned to render passes of eyes (nil if not created).
+  id<MTLRasterizationRateMap> RateMap() const { return myRateMap; }
+
+  //! Enable vertex amplification for encoder rendering both eyes in a single pass
+  //! into slices 0 (left) and 1 (right) of array render target;
+  //! pipelines should be created with maxVertexAmplificationCount = NbEyes
+  //! and vertex shaders should select eye transformation by [[amplification_id]].
+  //! @return FALSE if vertex amplification is unsupported by device
+  Standard_EXPORT static bool SetupVertexAmplification(Metal_Context* theCtx,
+                                                       id<MTLRenderCommandEncoder> theEncoder);
+
+  //! Compose stereo image from array texture with left and right eyes in slices 0 and 1
+  //! (rendered with vertex amplification).
+  Standard_EXPORT void ComposeLayered(Metal_Context* theCtx,
+                                      id<MTLCommandBuffer> theCommandBuffer,
+                                      id<MTLTexture> theEyes,
+                                      id<MTLTexture> theTarget,
+                                      Graphic3d_StereoMode theMode,
+                                      bool theReverseStereo,
+                                      const NCollection_Mat4<float>& theAnaglyphLeft,
+                                      const NCollection_Mat4<float>& theAnaglyphRight,
+                                      bool theSmoothInterlacing);
+#endif
+
   //! Compose stereo image from left and right eye buffers.
   //! @param theCtx Metal context
   //! @param theLeftEye left eye frame buffer
@@ -102,9 +163,15 @@ private:
 #ifdef __OBJC__
   id<MTLRenderPipelineState> getPipeline(Metal_Context* theCtx,
                                          Graphic3d_StereoMode theMode,
-                                         MTLPixelFormat theTargetFormat);
+                                         MTLPixelFormat theTargetFormat,
+                                         bool theHasRateMap);
 #endif
 
+private:
+
+  //! Number of composition modes having own pipeline.
+  static const int NbModes = 6;
+
 private:
 
 #ifdef __OBJC__
@@ -116,6 +183,9 @@ private:
   id<MTLRenderPipelineState> myPipelineChessboard;   //!< Chessboard pipeline
   id<MTLRenderPipelineState> myPipelineSideBySide;   //!< Side-by-side pipeline
   id<MTLRenderPipelineState> myPipelineOverUnder;    //!< Over-under pipeline
+  id<MTLRenderPipelineState> myRateMapPipelines[NbModes]; //!< pipelines decoding rasterization rate map, in order of above
+  id<MTLRasterizationRateMap> myRateMap;             //!< foveation rate map of eyes
+  id<MTLBuffer>              myRateMapBuffer;        //!< parameter data of rate map for compose shaders
 #else
   void* myLibrary;
   void* mySampler;
@@ -125,8 +195,13 @@ private:
   void* myPipelineChessboard;
   void* myPipelineSideBySide;
   void* myPipelineOverUnder;
+  void* myRateMapPipelines[NbModes];
+  void* myRateMap;
+  void* myRateMapBuffer;
 #endif
 
+  NCollection_Vec2<int> myRateMapScreenSize;   //!< logical eye size of rate map
+  NCollection_Vec2<int> myRateMapPhysicalSize; //!< physical eye size of rate map
   bool myIsValid;
 };
 
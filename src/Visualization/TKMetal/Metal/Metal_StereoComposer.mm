@@ -18,6 +18,9 @@
 #include <Metal_FrameBuffer.hxx>
 #include <Message.hxx>
 
+#include <algorithm>
+#include <cmath>
+
 IMPLEMENT_STANDARD_RTTIEXT(Metal_StereoComposer, Standard_Transient)
 
 // Stereo composition shaders
@@ -31,8 +34,27 @@ struct StereoUniforms {
   float2   texOffset;      // Texture offset for smooth interlacing
   int      reverseStereo;  // Swap left/right
   int      padding;
+  float2   screenSize;     // Screen size of eye image (rasterization rate map)
+  float2   padding2;
 };
 
+// Eye images are rendered with rasterization rate map
+constant bool THE_HAS_RATE_MAP [[function_constant(0)]];
+
+// Sample eye image at screen texture coordinates,
+// which are mapped to physical coordinates of image rendered with rasterization rate map
+static float4 sampleEye(texture2d<float> tex, sampler samp, float2 texCoord, uint layer,
+                        constant StereoUniforms& uniforms,
+                        constant rasterization_rate_map_data* rateMap)
+{
+  if (THE_HAS_RATE_MAP) {
+    rasterization_rate_map_decoder decoder(*rateMap);
+    float2 physCoord = decoder.map_screen_to_physical_coordinates(texCoord * uniforms.screenSize, layer);
+    return tex.sample(samp, physCoord / float2(tex.get_width(), tex.get_height()));
+  }
+  return tex.sample(samp, texCoord);
+}
+
 struct VertexOut {
   float4 position [[position]];
   float2 texCoord;
@@ -53,10 +75,11 @@ fragment float4 anaglyphFragment(
   texture2d<float> leftTex [[texture(0)]],
   texture2d<float> rightTex [[texture(1)]],
   sampler samp [[sampler(0)]],
-  constant StereoUniforms& uniforms [[buffer(0)]])
+  constant StereoUniforms& uniforms [[buffer(0)]],
+  constant rasterization_rate_map_data* rateMap [[buffer(1)]])
 {
-  float4 colorL = leftTex.sample(samp, in.texCoord);
-  float4 colorR = rightTex.sample(samp, in.texCoord);
+  float4 colorL = sampleEye(leftTex, samp, in.texCoord, 0, uniforms, rateMap);
+  float4 colorR = sampleEye(rightTex, samp, in.texCoord, 1, uniforms, rateMap);
 
   if (uniforms.reverseStereo != 0) {
     float4 temp = colorL;
@@ -77,7 +100,8 @@ fragment float4 rowInterlacedFragment(
   texture2d<float> leftTex [[texture(0)]],
   texture2d<float> rightTex [[texture(1)]],
   sampler samp [[sampler(0)]],
-  constant StereoUniforms& uniforms [[buffer(0)]])
+  constant StereoUniforms& uniforms [[buffer(0)]],
+  constant rasterization_rate_map_data* rateMap [[buffer(1)]])
 {
   // Get pixel row
   int row = int(in.position.y);
@@ -86,8 +110,8 @@ fragment float4 rowInterlacedFragment(
   // Apply smooth interlacing offset
   float2 texCoordSmooth = in.texCoord - uniforms.texOffset;
 
-  float4 colorL = leftTex.sample(samp, isEvenRow ? in.texCoord : texCoordSmooth);
-  float4 colorR = rightTex.sample(samp, isEvenRow ? texCoordSmooth : in.texCoord);
+  float4 colorL = sampleEye(leftTex, samp, isEvenRow ? in.texCoord : texCoordSmooth, 0, uniforms, rateMap);
+  float4 colorR = sampleEye(rightTex, samp, isEvenRow ? texCoordSmooth : in.texCoord, 1, uniforms, rateMap);
 
   bool useLeft = (uniforms.reverseStereo != 0) ? !isEvenRow : isEvenRow;
   return useLeft ? colorL : colorR;
@@ -99,15 +123,16 @@ fragment float4 colInterlacedFragment(
   texture2d<float> leftTex [[texture(0)]],
   texture2d<float> rightTex [[texture(1)]],
   sampler samp [[sampler(0)]],
-  constant StereoUniforms& uniforms [[buffer(0)]])
+  constant StereoUniforms& uniforms [[buffer(0)]],
+  constant rasterization_rate_map_data* rateMap [[buffer(1)]])
 {
   int col = int(in.position.x);
   bool isEvenCol = (col % 2) == 0;
 
   float2 texCoordSmooth = in.texCoord - float2(uniforms.texOffset.x, 0.0);
 
-  float4 colorL = leftTex.sample(samp, isEvenCol ? in.texCoord : texCoordSmooth);
-  float4 colorR = rightTex.sample(samp, isEvenCol ? texCoordSmooth : in.texCoord);
+  float4 colorL = sampleEye(leftTex, samp, isEvenCol ? in.texCoord : texCoordSmooth, 0, uniforms, rateMap);
+  float4 colorR = sampleEye(rightTex, samp, isEvenCol ? texCoordSmooth : in.texCoord, 1, uniforms, rateMap);
 
   bool useLeft = (uniforms.reverseStereo != 0) ? !isEvenCol : isEvenCol;
   return useLeft ? colorL : colorR;
@@ -119,7 +144,8 @@ fragment float4 chessboardFragment(
   texture2d<float> leftTex [[texture(0)]],
   texture2d<float> rightTex [[texture(1)]],
   sampler samp [[sampler(0)]],
-  constant StereoUniforms& uniforms [[buffer(0)]])
+  constant StereoUniforms& uniforms [[buffer(0)]],
+  constant rasterization_rate_map_data* rateMap [[buffer(1)]])
 {
   int row = int(in.position.y);
   int col = int(in.position.x);
@@ -129,8 +155,8 @@ fragment float4 chessboardFragment(
   // Chessboard pattern: same parity = left eye
   bool isLeftPixel = (isEvenRow == isEvenCol);
 
-  float4 colorL = leftTex.sample(samp, in.texCoord);
-  float4 colorR = rightTex.sample(samp, in.texCoord);
+  float4 colorL = sampleEye(leftTex, samp, in.texCoord, 0, uniforms, rateMap);
+  float4 colorR = sampleEye(rightTex, samp, in.texCoord, 1, uniforms, rateMap);
 
   bool useLeft = (uniforms.reverseStereo != 0) ? !isLeftPixel : isLeftPixel;
   return useLeft ? colorL : colorR;
@@ -142,7 +168,8 @@ fragment float4 sideBySideFragment(
   texture2d<float> leftTex [[texture(0)]],
   texture2d<float> rightTex [[texture(1)]],
   sampler samp [[sampler(0)]],
-  constant StereoUniforms& uniforms [[buffer(0)]])
+  constant StereoUniforms& uniforms [[buffer(0)]],
+  constant rasterization_rate_map_data* rateMap [[buffer(1)]])
 {
   float2 texCoord = in.texCoord;
   texCoord.x *= 2.0;  // Scale X to 0-2 range
@@ -152,8 +179,8 @@ fragment float4 sideBySideFragment(
     texCoord.x -= 1.0;
   }
 
-  float4 colorL = leftTex.sample(samp, texCoord);
-  float4 colorR = rightTex.sample(samp, texCoord);
+  float4 colorL = sampleEye(leftTex, samp, texCoord, 0, uniforms, rateMap);
+  float4 colorR = sampleEye(rightTex, samp, texCoord, 1, uniforms, rateMap);
 
   bool useLeft = (uniforms.reverseStereo != 0) ? isRightHalf : !isRightHalf;
   return useLeft ? colorL : colorR;
@@ -165,7 +192,8 @@ fragment float4 overUnderFragment(
   texture2d<float> leftTex [[texture(0)]],
   texture2d<float> rightTex [[texture(1)]],
   sampler samp [[sampler(0)]],
-  constant StereoUniforms& uniforms [[buffer(0)]])
+  constant StereoUniforms& uniforms [[buffer(0)]],
+  constant rasterization_rate_map_data* rateMap [[buffer(1)]])
 {
   float2 texCoord = in.texCoord;
   texCoord.y *= 2.0;  // Scale Y to 0-2 range
@@ -175,8 +203,8 @@ fragment float4 overUnderFragment(
     texCoord.y -= 1.0;
   }
 
-  float4 colorL = leftTex.sample(samp, texCoord);
-  float4 colorR = rightTex.sample(samp, texCoord);
+  float4 colorL = sampleEye(leftTex, samp, texCoord, 0, uniforms, rateMap);
+  float4 colorR = sampleEye(rightTex, samp, texCoord, 1, uniforms, rateMap);
 
   bool useLeft = (uniforms.reverseStereo != 0) ? isBottomHalf : !isBottomHalf;
   return useLeft ? colorL : colorR;
@@ -196,8 +224,16 @@ Metal_StereoComposer::Metal_StereoComposer()
   myPipelineChessboard(nil),
   myPipelineSideBySide(nil),
   myPipelineOverUnder(nil),
+  myRateMap(nil),
+  myRateMapBuffer(nil),
+  myRateMapScreenSize(0, 0),
+  myRateMapPhysicalSize(0, 0),
   myIsValid(false)
 {
+  for (int aModeIter = 0; aModeIter < NbModes; ++aModeIter)
+  {
+    myRateMapPipelines[aModeIter] = nil;
+  }
 }
 
 // =======================================================================
@@ -233,9 +269,9 @@ bool Metal_StereoComposer::Init(Metal_Context* theCtx)
   MTLCompileOptions* anOptions = [[MTLCompileOptions alloc] init];
   anOptions.fastMathEnabled = YES;
 
-  myLibrary = [aDevice newLibraryWithSource:@(STEREO_SHADER_SOURCE)
-                                    options:anOptions
-                                      error:&anError];
+  myLibrary = theCtx->LoadShaderLibrary("Metal_StereoComposer_STEREO_SHADER_SOURCE",
+                                        @(STEREO_SHADER_SOURCE),
+                                        anOptions, &anError);
   if (myLibrary == nil)
   {
     Message::SendFail() << "Metal_StereoComposer: shader compilation failed - "
@@ -271,52 +307,179 @@ void Metal_StereoComposer::Release(Metal_Context* theCtx)
   myPipelineChessboard = nil;
   myPipelineSideBySide = nil;
   myPipelineOverUnder = nil;
+  for (int aModeIter = 0; aModeIter < NbModes; ++aModeIter)
+  {
+    myRateMapPipelines[aModeIter] = nil;
+  }
+  ReleaseRateMap();
   myIsValid = false;
 }
 
+// =======================================================================
+// function : InitRateMap
+// purpose  : Create foveation rasterization rate map
+// =======================================================================
+bool Metal_StereoComposer::InitRateMap(Metal_Context* theCtx,
+                                       const NCollection_Vec2<int>& theScreenSize,
+                                       float theInnerRadius,
+                                       float theMinRate)
+{
+  ReleaseRateMap();
+  if (theCtx == nullptr
+  || !theCtx->HasRasterizationRateMaps()
+   || theScreenSize.x() <= 0 || theScreenSize.y() <= 0)
+  {
+    return false;
+  }
+
+  if (@available(macOS 10.15.4, iOS 13.0, *))
+  {
+    // rate is defined per zone of the sampling grid and interpolated by Metal in between
+    const int   aNbZones = 15;
+    const float anInner  = std::max(std::min(theInnerRadius, 0.99f), 0.0f);
+    const float aMinRate = std::max(std::min(theMinRate, 1.0f), 0.01f);
+    MTLRasterizationRateMapDescriptor* aDesc = [[MTLRasterizationRateMapDescriptor alloc] init];
+    aDesc.label = @"StereoFoveation";
+    aDesc.screenSize = MTLSizeMake(theScreenSize.x(), theScreenSize.y(), 0);
+
+    // layers are identical, so that eyes rendered into separate textures (layer 0)
+    // and into slices of array texture with vertex amplification are decoded in the same way
+    for (int anEyeIter = 0; anEyeIter < NbEyes; ++anEyeIter)
+    {
+      MTLRasterizationRateLayerDescriptor* aLayer =
+        [[MTLRasterizationRateLayerDescriptor alloc] initWithSampleCount:MTLSizeMake(aNbZones, aNbZones, 0)];
+      for (int aZoneIter = 0; aZoneIter < aNbZones; ++aZoneIter)
+      {
+        const float aDist = std::abs((aZoneIter + 0.5f) / float(aNbZones) * 2.0f - 1.0f);
+        const float aFall = std::max(aDist - anInner, 0.0f) / (1.0f - anInner);
+        const float aRate = 1.0f + (aMinRate - 1.0f) * aFall * aFall * (3.0f - 2.0f * aFall);
+        aLayer.horizontalSampleStorage[aZoneIter] = aRate;
+        aLayer.verticalSampleStorage[aZoneIter]   = aRate;
+      }
+      [aDesc setLayer:aLayer atIndex:anEyeIter];
+    }
+
+    myRateMap = [theCtx->Device() newRasterizationRateMapWithDescriptor:aDesc];
+    if (myRateMap == nil)
+    {
+      Message::SendFail() << "Metal_StereoComposer: rasterization rate map creation failed";
+      return false;
+    }
+
+    const MTLSizeAndAlign aParamSize = myRateMap.parameterBufferSizeAndAlign;
+    myRateMapBuffer = [theCtx->Device() newBufferWithLength:aParamSize.size options:MTLResourceStorageModeShared];
+    if (myRateMapBuffer == nil)
+    {
+      ReleaseRateMap();
+      return false;
+    }
+    [myRateMap copyParameterDataToBuffer:myRateMapBuffer offset:0];
+
+    const MTLSize aPhysSize = [myRateMap physicalSizeForLayer:0];
+    myRateMapScreenSize = theScreenSize;
+    myRateMapPhysicalSize.SetValues((int)aPhysSize.width, (int)aPhysSize.height);
+    return true;
+  }
+  return false;
+}
+
+// =======================================================================
+// function : ReleaseRateMap
+// purpose  : Release rasterization rate map
+// =======================================================================
+void Metal_StereoComposer::ReleaseRateMap()
+{
+  myRateMap = nil;
+  myRateMapBuffer = nil;
+  myRateMapScreenSize.SetValues(0, 0);
+  myRateMapPhysicalSize.SetValues(0, 0);
+}
+
+// =======================================================================
+// function : SetupVertexAmplification
+// purpose  : Enable vertex amplification into two eye slices
+// =======================================================================
+bool Metal_StereoComposer::SetupVertexAmplification(Metal_Context* theCtx,
+                                                    id<MTLRenderCommandEncoder> theEncoder)
+{
+  if (theCtx == nullptr
+  || !theCtx->HasVertexAmplification()
+   || theEncoder == nil)
+  {
+    return false;
+  }
+
+  if (@available(macOS 10.15.4, iOS 13.0, *))
+  {
+    // both eyes share viewport and differ by render target slice
+    MTLVertexAmplificationViewMapping aMappings[NbEyes];
+    for (int anEyeIter = 0; anEyeIter < NbEyes; ++anEyeIter)
+    {
+      aMappings[anEyeIter].viewportArrayIndexOffset = 0;
+      aMappings[anEyeIter].renderTargetArrayIndexOffset = (uint32_t)anEyeIter;
+    }
+    [theEncoder setVertexAmplificationCount:NbEyes viewMappings:aMappings];
+    return true;
+  }
+  return false;
+}
+
 // =======================================================================
 // function : getPipeline
 // purpose  : Get or create pipeline for stereo mode
 // =======================================================================
 id<MTLRenderPipelineState> Metal_StereoComposer::getPipeline(Metal_Context* theCtx,
                                                               Graphic3d_StereoMode theMode,
-                                                              MTLPixelFormat theTargetFormat)
+                                                              MTLPixelFormat theTargetFormat,
+                                                              bool theHasRateMap)
 {
   __strong id<MTLRenderPipelineState>* aPipelinePtr = nullptr;
   NSString* aFragmentName = nil;
+  int aModeIndex = 0;
 
   switch (theMode)
   {
     case Graphic3d_StereoMode_Anaglyph:
       aPipelinePtr = &myPipelineAnaglyph;
       aFragmentName = @"anaglyphFragment";
+      aModeIndex = 0;
       break;
     case Graphic3d_StereoMode_RowInterlaced:
       aPipelinePtr = &myPipelineRowInterlaced;
       aFragmentName = @"rowInterlacedFragment";
+      aModeIndex = 1;
       break;
     case Graphic3d_StereoMode_ColumnInterlaced:
       aPipelinePtr = &myPipelineColInterlaced;
       aFragmentName = @"colInterlacedFragment";
+      aModeIndex = 2;
       break;
     case Graphic3d_StereoMode_ChessBoard:
       aPipelinePtr = &myPipelineChessboard;
       aFragmentName = @"chessboardFragment";
+      aModeIndex = 3;
       break;
     case Graphic3d_StereoMode_SideBySide:
       aPipelinePtr = &myPipelineSideBySide;
       aFragmentName = @"sideBySideFragment";
+      aModeIndex = 4;
       break;
     case Graphic3d_StereoMode_OverUnder:
       aPipelinePtr = &myPipelineOverUnder;
       aFragmentName = @"overUnderFragment";
+      aModeIndex = 5;
       break;
     default:
       // QuadBuffer, SoftPageFlip, OpenVR - use anaglyph as fallback
       aPipelinePtr = &myPipelineAnaglyph;
       aFragmentName = @"anaglyphFragment";
+      aModeIndex = 0;
       break;
   }
+  if (theHasRateMap)
+  {
+    aPipelinePtr = &myRateMapPipelines[aModeIndex];
+  }
 
   // Return cached pipeline if available
   if (*aPipelinePtr != nil)
@@ -327,7 +490,13 @@ id<MTLRenderPipelineState> Metal_StereoComposer::getPipeline(Metal_Context* theC
   // Create new pipeline
   id<MTLDevice> aDevice = theCtx->Device();
   id<MTLFunction> aVertexFunc = [myLibrary newFunctionWithName:@"stereoVertex"];
-  id<MTLFunction> aFragmentFunc = [myLibrary newFunctionWithName:aFragmentName];
+  MTLFunctionConstantValues* aConstants = [[MTLFunctionConstantValues alloc] init];
+  const bool aHasRateMap = theHasRateMap;
+  [aConstants setConstantValue:&aHasRateMap type:MTLDataTypeBool atIndex:0];
+  NSError* aFuncError = nil;
+  id<MTLFunction> aFragmentFunc = [myLibrary newFunctionWithName:aFragmentName
+                                                  constantValues:aConstants
+                                                           error:&aFuncError];
 
   if (aVertexFunc == nil || aFragmentFunc == nil)
   {
@@ -374,7 +543,8 @@ void Metal_StereoComposer::Compose(Metal_Context* theCtx,
   }
 
   MTLPixelFormat aTargetFormat = (theTarget != nil) ? [theTarget pixelFormat] : MTLPixelFormatBGRA8Unorm;
-  id<MTLRenderPipelineState> aPipeline = getPipeline(theCtx, theMode, aTargetFormat);
+  const bool aHasRateMap = myRateMap != nil;
+  id<MTLRenderPipelineState> aPipeline = getPipeline(theCtx, theMode, aTargetFormat, aHasRateMap);
   if (aPipeline == nil)
   {
     return;
@@ -400,12 +570,16 @@ void Metal_StereoComposer::Compose(Metal_Context* theCtx,
   aUniforms.AnaglyphRight = theAnaglyphRight;
   aUniforms.ReverseStereo = theReverseStereo ? 1 : 0;
   aUniforms.Padding = 0;
+  aUniforms.ScreenSize[0] = aHasRateMap ? static_cast<float>(myRateMapScreenSize.x()) : static_cast<float>([theLeftEye width]);
+  aUniforms.ScreenSize[1] = aHasRateMap ? static_cast<float>(myRateMapScreenSize.y()) : static_cast<float>([theLeftEye height]);
+  aUniforms.Padding2[0] = 0.0f;
+  aUniforms.Padding2[1] = 0.0f;
 
   if (theSmoothInterlacing)
   {
     // Small texture offset for antialiasing on interlaced displays
-    float texelSizeY = 1.0f / static_cast<float>([theLeftEye height]);
-    float texelSizeX = 1.0f / static_cast<float>([theLeftEye width]);
+    float texelSizeY = 1.0f / aUniforms.ScreenSize[1];
+    float texelSizeX = 1.0f / aUniforms.ScreenSize[0];
     aUniforms.TexOffset[0] = texelSizeX * 0.5f;
     aUniforms.TexOffset[1] = texelSizeY * 0.5f;
   }
@@ -417,6 +591,15 @@ void Metal_StereoComposer::Compose(Metal_Context* theCtx,
 
   // Bind resources
   [anEncoder setFragmentBytes:&aUniforms length:sizeof(aUniforms) atIndex:0];
+  if (aHasRateMap)
+  {
+    [anEncoder setFragmentBuffer:myRateMapBuffer offset:0 atIndex:1];
+  }
+  else
+  {
+    // rate map data is not accessed by pipelines without rate map, but argument should be bound
+    [anEncoder setFragmentBytes:&aUniforms length:sizeof(aUniforms) atIndex:1];
+  }
   [anEncoder setFragmentTexture:theLeftEye atIndex:0];
   [anEncoder setFragmentTexture:theRightEye atIndex:1];
   [anEncoder setFragmentSamplerState:mySampler atIndex:0];
@@ -427,6 +610,41 @@ void Metal_StereoComposer::Compose(Metal_Context* theCtx,
   [anEncoder endEncoding];
 }
 
+// =======================================================================
+// function : ComposeLayered
+// purpose  : Compose stereo image from slices of array texture
+// =======================================================================
+void Metal_StereoComposer::ComposeLayered(Metal_Context* theCtx,
+                                          id<MTLCommandBuffer> theCommandBuffer,
+                                          id<MTLTexture> theEyes,
+                                          id<MTLTexture> theTarget,
+                                          Graphic3d_StereoMode theMode,
+                                          bool theReverseStereo,
+                                          const NCollection_Mat4<float>& theAnaglyphLeft,
+                                          const NCollection_Mat4<float>& theAnaglyphRight,
+                                          bool theSmoothInterlacing)
+{
+  if (theEyes == nil
+   || theEyes.textureType != MTLTextureType2DArray
+   || theEyes.arrayLength < (NSUInteger)NbEyes)
+  {
+    return;
+  }
+
+  // texture views of slices are cheap and keep compose shaders independent from array layout
+  id<MTLTexture> aLeftEye  = [theEyes newTextureViewWithPixelFormat:theEyes.pixelFormat
+                                                        textureType:MTLTextureType2D
+                                                             levels:NSMakeRange(0, 1)
+                                                             slices:NSMakeRange(0, 1)];
+  id<MTLTexture> aRightEye = [theEyes newTextureViewWithPixelFormat:theEyes.pixelFormat
+                                                        textureType:MTLTextureType2D
+                                                             levels:NSMakeRange(0, 1)
+                                                             slices:NSMakeRange(1, 1)];
+  Compose(theCtx, theCommandBuffer, aLeftEye, aRightEye, theTarget,
+          theMode, theReverseStereo, theAnaglyphLeft, theAnaglyphRight,
+          theSmoothInterlacing);
+}
+
 // =======================================================================
 // function : Compose (with frame buffer wrappers)
 // purpose  : Compose stereo image from frame buffer wrappers
@@ -0,0 +1,25 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef Metal_StorageMode_HeaderFile
+#define Metal_StorageMode_HeaderFile
+
+//! Metal storage mode for buffer allocation.
+enum Metal_StorageMode
+{
+  Metal_StorageMode_Shared = 0,  //!< CPU and GPU access, not cached on GPU (unified memory)
+  Metal_StorageMode_Managed = 1, //!< CPU and GPU access with explicit synchronization
+  Metal_StorageMode_Private = 2  //!< GPU only access, optimal performance
+};
+
+#endif // Metal_StorageMode_HeaderFile
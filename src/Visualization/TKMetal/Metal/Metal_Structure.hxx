@@ -21,6 +21,8 @@
 class Metal_GraphicDriver;
 class Metal_Group;
 class Metal_Context;
+class Metal_ResidencyManager;
+class Metal_TransformBuffer;
 class Metal_Workspace;
 
 //! Implementation of low-level graphic structure for Metal.
@@ -99,6 +101,25 @@ public:
   //! Release structure resources.
   Standard_EXPORT virtual void Release(Metal_Context* theCtx);
 
+  //! Release GPU buffers of groups keeping CPU data, so that they are uploaded again on next rendering.
+  //! @return released bytes
+  Standard_EXPORT size_t ReleaseGpuBuffers(Metal_Context* theCtx);
+
+  //! Return residency manager tracking this structure.
+  const occ::handle<Metal_ResidencyManager>& ResidencyManager() const { return myResidencyMgr; }
+
+  //! Register structure within residency manager (unregistered on destruction).
+  Standard_EXPORT void SetResidencyManager(const occ::handle<Metal_ResidencyManager>& theMgr);
+
+  //! Return buffer holding the render transformation of this structure.
+  const occ::handle<Metal_TransformBuffer>& TransformBuffer() const { return myTrsfBuffer; }
+
+  //! Allocate slot for the render transformation within the buffer (released on destruction).
+  Standard_EXPORT void SetTransformBuffer(const occ::handle<Metal_TransformBuffer>& theBuffer);
+
+  //! Return slot of the render transformation within TransformBuffer(), or -1 if none.
+  int TransformSlot() const { return myTrsfSlot; }
+
   //! Returns instanced Metal structure.
   const Metal_Structure* InstancedStructure() const { return myInstancedStructure; }
 
@@ -108,6 +129,11 @@ public:
   //! Resets structure modification state.
   void ResetModificationState() const { myModificationState = 0; }
 
+  //! Returns counter of transformation changes, also counted by ModificationState().
+  //! Consumers caching derived data (like ray-tracing acceleration structures) may compare both counters:
+  //! when only this one has been increased, structure geometry is unchanged and only has been moved.
+  size_t TransformModificationState() const { return myTrsfModificationState; }
+
   //! Update render transformation matrix.
   Standard_EXPORT void updateLayerTransformation() override;
 
@@ -126,8 +152,12 @@ protected:
 protected:
 
   Metal_Structure*        myInstancedStructure;
+  occ::handle<Metal_ResidencyManager> myResidencyMgr; //!< residency manager tracking the structure
+  occ::handle<Metal_TransformBuffer>  myTrsfBuffer;   //!< buffer holding the render transformation
+  int                     myTrsfSlot;         //!< slot within myTrsfBuffer
   NCollection_Mat4<float> myRenderTrsf;       //!< transformation for rendering
   mutable size_t          myModificationState;
+  size_t                  myTrsfModificationState; //!< counter of transformation changes
   bool                    myIsMirrored;       //!< mirrored geometry flag
 };
 
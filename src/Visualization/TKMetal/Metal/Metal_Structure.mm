@@ -17,6 +17,8 @@
 #include <Metal_Group.hxx>
 #include <Metal_GraphicDriver.hxx>
 #include <Metal_Context.hxx>
+#include <Metal_ResidencyManager.hxx>
+#include <Metal_TransformBuffer.hxx>
 #include <Metal_Workspace.hxx>
 
 #include <Graphic3d_GraphicDriver.hxx>
@@ -41,7 +43,9 @@ Metal_GraphicDriver* Metal_Structure::MetalDriver() const
 Metal_Structure::Metal_Structure(const occ::handle<Graphic3d_StructureManager>& theManager)
 : Graphic3d_CStructure(theManager),
   myInstancedStructure(nullptr),
+  myTrsfSlot(-1),
   myModificationState(0),
+  myTrsfModificationState(0),
   myIsMirrored(false)
 {
   updateLayerTransformation();
@@ -53,9 +57,74 @@ Metal_Structure::Metal_Structure(const occ::handle<Graphic3d_StructureManager>&
 // =======================================================================
 Metal_Structure::~Metal_Structure()
 {
+  SetResidencyManager(occ::handle<Metal_ResidencyManager>());
+  SetTransformBuffer(occ::handle<Metal_TransformBuffer>());
   Release(nullptr);
 }
 
+// =======================================================================
+// function : SetResidencyManager
+// purpose  : Register structure within residency manager
+// =======================================================================
+void Metal_Structure::SetResidencyManager(const occ::handle<Metal_ResidencyManager>& theMgr)
+{
+  if (myResidencyMgr == theMgr)
+  {
+    return;
+  }
+
+  if (!myResidencyMgr.IsNull())
+  {
+    myResidencyMgr->Unregister(this);
+  }
+  myResidencyMgr = theMgr;
+  if (!myResidencyMgr.IsNull())
+  {
+    myResidencyMgr->Register(this);
+  }
+}
+
+// =======================================================================
+// function : SetTransformBuffer
+// purpose  : Allocate slot within transformation buffer
+// =======================================================================
+void Metal_Structure::SetTransformBuffer(const occ::handle<Metal_TransformBuffer>& theBuffer)
+{
+  if (myTrsfBuffer == theBuffer)
+  {
+    return;
+  }
+
+  if (!myTrsfBuffer.IsNull())
+  {
+    myTrsfBuffer->RemoveSlot(myTrsfSlot);
+    myTrsfSlot = -1;
+  }
+  myTrsfBuffer = theBuffer;
+  if (!myTrsfBuffer.IsNull())
+  {
+    myTrsfSlot = myTrsfBuffer->AddSlot();
+    myTrsfBuffer->SetValue(myTrsfSlot, myRenderTrsf);
+  }
+}
+
+// =======================================================================
+// function : ReleaseGpuBuffers
+// purpose  : Release GPU buffers keeping CPU data
+// =======================================================================
+size_t Metal_Structure::ReleaseGpuBuffers(Metal_Context* theCtx)
+{
+  size_t aSize = 0;
+  for (GroupIterator aGroupIter(myGroups); aGroupIter.More(); aGroupIter.Next())
+  {
+    if (Metal_Group* aGroup = aGroupIter.ChangeValue())
+    {
+      aSize += aGroup->ReleaseGpuBuffers(theCtx);
+    }
+  }
+  return aSize;
+}
+
 // =======================================================================
 // function : OnVisibilityChanged
 // purpose  : Handle visibility change
@@ -133,6 +202,7 @@ void Metal_Structure::SetTransformation(const occ::handle<TopLoc_Datum3D>& theTr
   Graphic3d_CStructure::SetTransformation(theTrsf);
   updateLayerTransformation();
   ++myModificationState;
+  ++myTrsfModificationState;
 }
 
 // =======================================================================
@@ -144,6 +214,7 @@ void Metal_Structure::SetTransformPersistence(
 {
   Graphic3d_CStructure::SetTransformPersistence(theTrsfPers);
   ++myModificationState;
+  ++myTrsfModificationState;
 }
 
 // =======================================================================
@@ -277,7 +348,7 @@ void Metal_Structure::renderGeometry(Metal_Workspace* theWorkspace,
   for (GroupIterator aGroupIter(myGroups); aGroupIter.More(); aGroupIter.Next())
   {
     const Metal_Group* aGroup = aGroupIter.Value();
-    if (aGroup != nullptr)
+    if (aGroup != nullptr && IsGroupDrawn(*aGroup))
     {
       if (aGroup->IsClosed())
       {
@@ -330,4 +401,9 @@ void Metal_Structure::updateLayerTransformation()
     // Check if transformation mirrors the geometry
     myIsMirrored = aTrsf.IsNegative();
   }
+
+  if (!myTrsfBuffer.IsNull())
+  {
+    myTrsfBuffer->SetValue(myTrsfSlot, myRenderTrsf);
+  }
 }
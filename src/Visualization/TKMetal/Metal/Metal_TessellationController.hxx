@@ -27,9 +27,12 @@
 @protocol MTLRenderPipelineState;
 @protocol MTLDepthStencilState;
 @protocol MTLLibrary;
+@protocol MTLTexture;
 #endif
 
+class Metal_BSplineSurface;
 class Metal_Context;
+class Metal_Workspace;
 
 //! Tessellation parameters.
 struct Metal_TessParams
@@ -61,6 +64,7 @@ struct Metal_TessParams
 //! Tessellation controller for Metal.
 //! Manages tessellation pipeline state and compute-based tessellation factor calculation.
 //! Metal tessellation uses: compute shader (tessellation factors) + post-tessellation vertex function.
+//! Also draws Metal_BSplineSurface evaluated from control net, with factors adapted to projected patch edges.
 class Metal_TessellationController : public Standard_Transient
 {
   DEFINE_STANDARD_RTTIEXT(Metal_TessellationController, Standard_Transient)
@@ -123,6 +127,15 @@ public:
 #endif
     int thePatchCount);
 
+  //! Draw B-spline surface with active pipeline of Metal_Workspace::ApplyBSplinePipelineState().
+  //! Tessellation factors are computed per frame from screen-space length of patch edges (see TargetEdgeLength()),
+  //! shared edges of neighbor patches always get the same factor, so that tessellation has no cracks.
+  //! @param[in] theWorkspace workspace with active encoder and matrices
+  //! @param[in] theSurface   initialized surface
+  //! @return FALSE if surface has not been drawn
+  Standard_EXPORT bool DrawBSplineSurface(Metal_Workspace* theWorkspace,
+                                          const Metal_BSplineSurface& theSurface);
+
   //! Get tessellation factor buffer.
 #ifdef __OBJC__
   id<MTLBuffer> TessFactorBuffer() const { return myTessFactorBuffer; }
@@ -162,6 +175,12 @@ public:
   //! Get maximum tessellation factor.
   int MaxTessFactor() const { return myMaxTessFactor; }
 
+  //! Set target length in pixels of segments of tessellated B-spline surfaces; 8 by default.
+  void SetTargetEdgeLength(float thePixels) { myTargetEdgeLength = fmax(1.0f, thePixels); }
+
+  //! Get target length in pixels of segments of tessellated B-spline surfaces.
+  float TargetEdgeLength() const { return myTargetEdgeLength; }
+
 protected:
 
   //! Initialize pipelines.
@@ -170,12 +189,19 @@ protected:
   //! Ensure tessellation factor buffer is large enough.
   bool ensureTessFactorBuffer(int thePatchCount);
 
+  //! Compute tessellation factors of B-spline surface patches.
+  void computeBSplineTessFactors(const Metal_BSplineSurface& theSurface,
+                                 const NCollection_Mat4<float>& theModelViewProj,
+                                 const float theViewportSize[2],
+                                 void* theFactors) const;
+
 protected:
 
   Metal_Context* myContext;    //!< Metal context
   float myTessLevel;           //!< Base tessellation level
   float myAdaptiveFactor;      //!< Adaptive factor
   int myMaxTessFactor;         //!< Maximum tessellation factor
+  float myTargetEdgeLength;    //!< Target segment length of B-spline surfaces, in pixels
   int myTessFactorCapacity;    //!< Current buffer capacity in patches
   bool myIsValid;              //!< Initialization status
 
@@ -185,12 +211,14 @@ protected:
   id<MTLDepthStencilState> myDepthStencilState;       //!< Depth stencil state
   id<MTLBuffer> myTessFactorBuffer;                   //!< Tessellation factors buffer
   id<MTLBuffer> myTessUniformBuffer;                  //!< Tessellation uniforms buffer
+  id<MTLTexture> myNoTrimTexture;                     //!< trimming field of untrimmed B-spline surfaces
 #else
   void* myTessFactorPipeline;
   void* myTessRenderPipeline;
   void* myDepthStencilState;
   void* myTessFactorBuffer;
   void* myTessUniformBuffer;
+  void* myNoTrimTexture;
 #endif
 };
 
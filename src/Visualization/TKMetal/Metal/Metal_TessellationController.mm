@@ -14,12 +14,29 @@
 #import <Metal/Metal.h>
 
 #include <Metal_TessellationController.hxx>
+#include <Metal_BSplineSurface.hxx>
 #include <Metal_Context.hxx>
 #include <Metal_ShaderManager.hxx>
+#include <Metal_Workspace.hxx>
 #include <Message.hxx>
 
+#include <algorithm>
+#include <vector>
+
 IMPLEMENT_STANDARD_RTTIEXT(Metal_TessellationController, Standard_Transient)
 
+namespace
+{
+  //! Convert tessellation factor into half float;
+  //! factors are normal positive numbers, so that denormals, infinities and rounding are not handled.
+  static uint16_t tessFactorToHalf(float theFactor)
+  {
+    uint32_t aBits = 0;
+    memcpy(&aBits, &theFactor, sizeof(aBits));
+    return uint16_t(((((aBits >> 23) & 0xFF) - 112) << 10) | ((aBits >> 13) & 0x3FF));
+  }
+}
+
 // =======================================================================
 // function : Metal_TessellationController
 // purpose  : Constructor
@@ -29,13 +46,15 @@ Metal_TessellationController::Metal_TessellationController(Metal_Context* theCtx
   myTessLevel(8.0f),
   myAdaptiveFactor(0.0f),
   myMaxTessFactor(64),
+  myTargetEdgeLength(8.0f),
   myTessFactorCapacity(0),
   myIsValid(false),
   myTessFactorPipeline(nil),
   myTessRenderPipeline(nil),
   myDepthStencilState(nil),
   myTessFactorBuffer(nil),
-  myTessUniformBuffer(nil)
+  myTessUniformBuffer(nil),
+  myNoTrimTexture(nil)
 {
   myIsValid = initPipelines();
 }
@@ -60,6 +79,7 @@ void Metal_TessellationController::Release()
   myDepthStencilState = nil;
   myTessFactorBuffer = nil;
   myTessUniformBuffer = nil;
+  myNoTrimTexture = nil;
   myTessFactorCapacity = 0;
   myIsValid = false;
 }
@@ -307,3 +327,145 @@ void Metal_TessellationController::DrawPatches(
            instanceCount:1
             baseInstance:0];
 }
+
+// =======================================================================
+// function : computeBSplineTessFactors
+// purpose  : Compute screen-space adaptive factors of B-spline patches
+// =======================================================================
+void Metal_TessellationController::computeBSplineTessFactors(const Metal_BSplineSurface& theSurface,
+                                                             const NCollection_Mat4<float>& theModelViewProj,
+                                                             const float theViewportSize[2],
+                                                             void* theFactors) const
+{
+  const int aNbUSpans = theSurface.NbUSpans();
+  const int aNbVSpans = theSurface.NbVSpans();
+  const int aNbSamples = Metal_BSplineSurface::NbEdgeSamples;
+  const NCollection_Vector<NCollection_Vec3<float>>& aSamples = theSurface.EdgeSamples();
+
+  // factor of the line is its projected length divided by target segment length
+  const auto aLineFactor = [&](int theLineIndex)
+  {
+    float aLength = 0.0f;
+    NCollection_Vec2<float> aPrev;
+    for (int aSampleIter = 0; aSampleIter < aNbSamples; ++aSampleIter)
+    {
+      const NCollection_Vec4<float> aClip = theModelViewProj * NCollection_Vec4<float>(aSamples.Value(theLineIndex * aNbSamples + aSampleIter), 1.0f);
+      if (aClip.w() <= 1.0e-6f)
+      {
+        // line crosses the camera plane
+        return float(myMaxTessFactor);
+      }
+      const NCollection_Vec2<float> aPnt(aClip.x() / aClip.w() * 0.5f * theViewportSize[0],
+                                         aClip.y() / aClip.w() * 0.5f * theViewportSize[1]);
+      if (aSampleIter != 0)
+      {
+        aLength += (aPnt - aPrev).Modulus();
+      }
+      aPrev = aPnt;
+    }
+    return std::max(1.0f, std::min(float(myMaxTessFactor), aLength / myTargetEdgeLength));
+  };
+
+  // factors of unique lines, so that edges shared by neighbor patches match
+  const int aNbULines = (aNbUSpans + 1) * aNbVSpans;
+  const int aNbVLines = aNbUSpans * (aNbVSpans + 1);
+  std::vector<float> aLineFactors(aNbULines + aNbVLines);
+  for (int aLineIter = 0; aLineIter < aNbULines + aNbVLines; ++aLineIter)
+  {
+    aLineFactors[aLineIter] = aLineFactor(aLineIter);
+  }
+
+  const bool isReversed = theSurface.Params().IsReversed != 0;
+  MTLQuadTessellationFactorsHalf* aFactors = static_cast<MTLQuadTessellationFactorsHalf*>(theFactors);
+  for (int aUIter = 0; aUIter < aNbUSpans; ++aUIter)
+  {
+    for (int aVIter = 0; aVIter < aNbVSpans; ++aVIter)
+    {
+      const int aPatchIndex = aUIter * aNbVSpans + aVIter;
+      // edges of quad domain: 0 is X = 0, 1 is Y = 0, 2 is X = 1, 3 is Y = 1; X is mirrored for reversed surfaces
+      const float aUMin = aLineFactors[ aUIter      * aNbVSpans + aVIter];
+      const float aUMax = aLineFactors[(aUIter + 1) * aNbVSpans + aVIter];
+      const float aVMin = aLineFactors[aNbULines + aUIter * (aNbVSpans + 1) + aVIter];
+      const float aVMax = aLineFactors[aNbULines + aUIter * (aNbVSpans + 1) + aVIter + 1];
+      const float aMidV = aLineFactor(aNbULines + aNbVLines + aPatchIndex * 2);
+      const float aMidU = aLineFactor(aNbULines + aNbVLines + aPatchIndex * 2 + 1);
+
+      MTLQuadTessellationFactorsHalf& aPatch = aFactors[aPatchIndex];
+      aPatch.edgeTessellationFactor[0] = tessFactorToHalf(isReversed ? aUMax : aUMin);
+      aPatch.edgeTessellationFactor[1] = tessFactorToHalf(aVMin);
+      aPatch.edgeTessellationFactor[2] = tessFactorToHalf(isReversed ? aUMin : aUMax);
+      aPatch.edgeTessellationFactor[3] = tessFactorToHalf(aVMax);
+      aPatch.insideTessellationFactor[0] = tessFactorToHalf(std::max(std::max(aVMin, aVMax), aMidV));
+      aPatch.insideTessellationFactor[1] = tessFactorToHalf(std::max(std::max(aUMin, aUMax), aMidU));
+    }
+  }
+}
+
+// =======================================================================
+// function : DrawBSplineSurface
+// purpose  : Draw B-spline surface evaluated from control net
+// =======================================================================
+bool Metal_TessellationController::DrawBSplineSurface(Metal_Workspace* theWorkspace,
+                                                      const Metal_BSplineSurface& theSurface)
+{
+  id<MTLRenderCommandEncoder> anEncoder = theWorkspace != nullptr ? theWorkspace->ActiveEncoder() : nil;
+  if (anEncoder == nil
+  || !theSurface.IsInitialized())
+  {
+    return false;
+  }
+
+  const int* aViewport = myContext->Viewport();
+  const float aViewportSize[2] = { float(std::max(aViewport[2], 1)), float(std::max(aViewport[3], 1)) };
+  const NCollection_Mat4<float> aModelViewProj = theWorkspace->ProjectionMatrix() * theWorkspace->ModelMatrix();
+  const int aNbPatches = theSurface.NbPatches();
+  std::vector<MTLQuadTessellationFactorsHalf> aFactors(aNbPatches);
+  computeBSplineTessFactors(theSurface, aModelViewProj, aViewportSize, aFactors.data());
+
+  // factors are rewritten each frame - take them from per-frame uniform ring unless its slot is exhausted
+  const size_t aFactorsSize = aFactors.size() * sizeof(MTLQuadTessellationFactorsHalf);
+  Metal_UniformRing* aRing = myContext->UniformRing().get();
+  id<MTLBuffer> aFactorBuffer = nil;
+  size_t anOffset = 0;
+  if (aRing == nullptr
+  || !aRing->Allocate(aFactors.data(), aFactorsSize, aFactorBuffer, anOffset))
+  {
+    aFactorBuffer = [myContext->Device() newBufferWithBytes:aFactors.data()
+                                                     length:aFactorsSize
+                                                    options:MTLResourceStorageModeShared];
+    anOffset = 0;
+    if (aFactorBuffer == nil)
+    {
+      return false;
+    }
+  }
+
+  if (myNoTrimTexture == nil)
+  {
+    MTLTextureDescriptor* aDesc = [MTLTextureDescriptor texture2DDescriptorWithPixelFormat:MTLPixelFormatR8Snorm
+                                                                                     width:1
+                                                                                    height:1
+                                                                                 mipmapped:NO];
+    aDesc.usage = MTLTextureUsageShaderRead;
+    myNoTrimTexture = [myContext->Device() newTextureWithDescriptor:aDesc];
+    const int8_t anInside = 127;
+    [myNoTrimTexture replaceRegion:MTLRegionMake2D(0, 0, 1, 1) mipmapLevel:0 withBytes:&anInside bytesPerRow:1];
+  }
+
+  // buffer indices match vertex_bspline_patch signature
+  [anEncoder setTessellationFactorBuffer:aFactorBuffer offset:anOffset instanceStride:0];
+  [anEncoder setVertexBytes:&theSurface.Params() length:sizeof(Metal_BSplineSurface::ShaderParams) atIndex:11];
+  [anEncoder setVertexBuffer:theSurface.PolesBuffer()   offset:0 atIndex:12];
+  [anEncoder setVertexBuffer:theSurface.KnotsBuffer()   offset:0 atIndex:13];
+  [anEncoder setVertexBuffer:theSurface.PatchesBuffer() offset:0 atIndex:14];
+  [anEncoder setVertexTexture:(theSurface.TrimTexture() != nil ? theSurface.TrimTexture() : myNoTrimTexture)
+                      atIndex:0];
+  [anEncoder drawPatches:0
+              patchStart:0
+              patchCount:NSUInteger(aNbPatches)
+        patchIndexBuffer:nil
+  patchIndexBufferOffset:0
+           instanceCount:1
+            baseInstance:0];
+  return true;
+}
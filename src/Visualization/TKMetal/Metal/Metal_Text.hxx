@@ -23,18 +23,16 @@
 #include <NCollection_Vec3.hxx>
 #include <NCollection_Vec4.hxx>
 #include <NCollection_Vector.hxx>
-
-#ifdef __OBJC__
-@protocol MTLBuffer;
-#endif
+#include <Metal_Buffer.hxx>
 
 class Metal_Context;
 class Metal_Workspace;
 class Metal_Font;
-class Metal_VertexBuffer;
+class Font_TextFormatter;
 
 //! Text rendering element for Metal.
 //! Stores text parameters and renders text using font texture atlas.
+//! Glyph geometry persists between frames and is rebuilt only when text string, font or alignment is changed.
 class Metal_Text : public Standard_Transient
 {
   DEFINE_STANDARD_RTTIEXT(Metal_Text, Standard_Transient)
@@ -108,6 +106,14 @@ protected:
                                  const Graphic3d_Aspects& theAspect,
                                  const NCollection_Vec4<float>& theColor) const;
 
+  //! Return TRUE if glyph geometry has been built for current text parameters.
+  Standard_EXPORT bool isGeometryValid(float theScale) const;
+
+  //! Build glyph geometry of all atlas pages into a single buffer.
+  //! @param theCtx   Metal context
+  //! @param theScale scale factor from atlas pixels to text pixels
+  Standard_EXPORT void buildGeometry(Metal_Context* theCtx, float theScale) const;
+
   //! Draw text glyphs with pixel offset for shadow effects.
   //! @param theWorkspace workspace with render encoder
   //! @param theAspect aspects
@@ -126,7 +132,16 @@ protected:
                                     const Graphic3d_Aspects& theAspect,
                                     const NCollection_Vec3<float>& theOffset) const;
 
-  //! Find or create font for rendering.
+  //! Map requested text size onto parameters of font atlas.
+  //! Distance field atlas (Metal_Caps::useDistanceFieldFonts) is rasterized at reference size shared by all text sizes.
+  //! @return scale factor from atlas pixels to text pixels
+  Standard_EXPORT static float AtlasParams(const Metal_Context* theCtx,
+                                           int& theHeight,
+                                           unsigned int& theResolution,
+                                           Font_Hinting& theFontHinting,
+                                           bool& theIsDistField);
+
+  //! Find or create font for rendering (parameters are mapped by AtlasParams()).
   Standard_EXPORT static occ::handle<Metal_Font> FindFont(Metal_Context* theCtx,
                                                            const Graphic3d_Aspects& theAspect,
                                                            int theHeight,
@@ -137,7 +152,8 @@ protected:
   Standard_EXPORT static TCollection_AsciiString FontKey(const Graphic3d_Aspects& theAspect,
                                                           int theHeight,
                                                           unsigned int theResolution,
-                                                          Font_Hinting theFontHinting);
+                                                          Font_Hinting theFontHinting,
+                                                          bool theIsDistField = false);
 
 protected:
 
@@ -148,17 +164,18 @@ protected:
   //! GPU resources - mutable for lazy initialization during const Render()
   mutable occ::handle<Metal_Font> myFont; //!< font with texture atlas
 
-  //! Per-texture vertex data
-#ifdef __OBJC__
-  mutable NCollection_Vector<id<MTLBuffer>> myVertsBuffers; //!< vertex position buffers
-  mutable NCollection_Vector<id<MTLBuffer>> myTCrdsBuffers; //!< texture coordinate buffers
-  mutable id<MTLBuffer> myBndVertsBuffer;                   //!< background quad buffer
-#else
-  mutable NCollection_Vector<void*> myVertsBuffers;
-  mutable NCollection_Vector<void*> myTCrdsBuffers;
-  mutable void* myBndVertsBuffer;
-#endif
-  mutable NCollection_Vector<int> myTextureIndices; //!< texture indices for each buffer
+  //! Glyph geometry of all atlas pages packed into a single range of shared allocator:
+  //! pixel positions of glyph quads, background quad (4 vertices), then texture coordinates of glyph quads.
+  mutable occ::handle<Metal_Buffer> myGeomBuffer;
+  mutable int myNbGlyphVerts;                       //!< number of glyph vertices (positions and texcoords)
+  mutable NCollection_Vector<int> myTextureIndices; //!< atlas page (texture index) of each draw
+  mutable NCollection_Vector<int> myPageFirst;      //!< first glyph vertex of each draw
+  mutable NCollection_Vector<int> myPageCount;      //!< number of glyph vertices of each draw
+  mutable NCollection_String myGeomString;          //!< text string the geometry has been built for
+  mutable Graphic3d_HorizontalTextAlignment myGeomHAlign; //!< horizontal alignment of built geometry
+  mutable Graphic3d_VerticalTextAlignment   myGeomVAlign; //!< vertical alignment of built geometry
+  mutable const Font_TextFormatter* myGeomFormatter;      //!< custom formatter of built geometry
+  mutable float myGeomScale;                        //!< scale from atlas pixels to text pixels of built geometry
   mutable Font_Rect myBndBox;                        //!< bounding box for background
 
   //! Transform matrices (mutable for Render const)
@@ -35,6 +35,12 @@ namespace
   static const NCollection_Mat4<double> THE_IDENTITY_MATRIX;
   static const TCollection_AsciiString THE_DEFAULT_FONT(Font_NOF_ASCII_MONO);
 
+  //! Point size (at 72 dpi, e.g. in pixels) of distance field atlas glyphs.
+  static const int THE_DIST_FIELD_SIZE = 48;
+
+  //! Spread of distance field in atlas pixels.
+  static const int THE_DIST_FIELD_SPREAD = 6;
+
   //! Apply floor to vector components.
   inline NCollection_Vec2<float>& floorVec(NCollection_Vec2<float>& theVec)
   {
@@ -52,7 +58,11 @@ Metal_Text::Metal_Text(const occ::handle<Graphic3d_Text>& theTextParams)
 : myText(theTextParams),
   myIs2D(false),
   myScaleHeight(1.0f),
-  myBndVertsBuffer(nil),
+  myNbGlyphVerts(0),
+  myGeomHAlign(Graphic3d_HTA_LEFT),
+  myGeomVAlign(Graphic3d_VTA_BOTTOM),
+  myGeomFormatter(nullptr),
+  myGeomScale(1.0f),
   myTextOffset(0.0f, 0.0f, 0.0f)
 {
   //
@@ -82,18 +92,18 @@ void Metal_Text::SetPosition(const NCollection_Vec3<float>& thePoint)
 // =======================================================================
 void Metal_Text::Release(Metal_Context* theCtx)
 {
-  (void)theCtx;
-
-  // Release Metal buffers
-  for (int i = 0; i < myVertsBuffers.Length(); ++i)
+  // Release glyph geometry
+  if (!myGeomBuffer.IsNull())
   {
-    myVertsBuffers.ChangeValue(i) = nil;
-    myTCrdsBuffers.ChangeValue(i) = nil;
+    myGeomBuffer->Release(theCtx);
+    myGeomBuffer.Nullify();
   }
-  myVertsBuffers.Clear();
-  myTCrdsBuffers.Clear();
+  myNbGlyphVerts = 0;
   myTextureIndices.Clear();
-  myBndVertsBuffer = nil;
+  myPageFirst.Clear();
+  myPageCount.Clear();
+  myGeomString.Clear();
+  myGeomFormatter = nullptr;
 
   // Release font reference
   if (!myFont.IsNull())
@@ -108,25 +118,7 @@ void Metal_Text::Release(Metal_Context* theCtx)
 // =======================================================================
 size_t Metal_Text::EstimatedDataSize() const
 {
-  size_t aSize = 0;
-  for (int i = 0; i < myVertsBuffers.Length(); ++i)
-  {
-    id<MTLBuffer> aVertsBuffer = myVertsBuffers.Value(i);
-    id<MTLBuffer> aTCrdsBuffer = myTCrdsBuffers.Value(i);
-    if (aVertsBuffer != nil)
-    {
-      aSize += [aVertsBuffer length];
-    }
-    if (aTCrdsBuffer != nil)
-    {
-      aSize += [aTCrdsBuffer length];
-    }
-  }
-  if (myBndVertsBuffer != nil)
-  {
-    aSize += [myBndVertsBuffer length];
-  }
-  return aSize;
+  return !myGeomBuffer.IsNull() ? myGeomBuffer->EstimatedDataSize() : 0;
 }
 
 // =======================================================================
@@ -136,7 +128,8 @@ size_t Metal_Text::EstimatedDataSize() const
 TCollection_AsciiString Metal_Text::FontKey(const Graphic3d_Aspects& theAspect,
                                              int theHeight,
                                              unsigned int theResolution,
-                                             Font_Hinting theFontHinting)
+                                             Font_Hinting theFontHinting,
+                                             bool theIsDistField)
 {
   const Font_FontAspect anAspect = theAspect.TextFontAspect() != Font_FA_Undefined
                                      ? theAspect.TextFontAspect()
@@ -146,10 +139,37 @@ TCollection_AsciiString Metal_Text::FontKey(const Graphic3d_Aspects& theAspect,
                                            : THE_DEFAULT_FONT;
 
   char aSuff[64];
-  Sprintf(aSuff, ":%d:%d:%d:%d", int(anAspect), int(theResolution), theHeight, int(theFontHinting));
+  Sprintf(aSuff, ":%d:%d:%d:%d%s", int(anAspect), int(theResolution), theHeight, int(theFontHinting),
+          theIsDistField ? ":sdf" : "");
   return aFont + aSuff;
 }
 
+// =======================================================================
+// function : AtlasParams
+// purpose  : Map requested text size onto parameters of font atlas
+// =======================================================================
+float Metal_Text::AtlasParams(const Metal_Context* theCtx,
+                              int& theHeight,
+                              unsigned int& theResolution,
+                              Font_Hinting& theFontHinting,
+                              bool& theIsDistField)
+{
+  theIsDistField = theCtx != nullptr
+                && !theCtx->Caps().IsNull()
+                && theCtx->Caps()->useDistanceFieldFonts;
+  if (!theIsDistField)
+  {
+    return 1.0f;
+  }
+
+  // text pixel size is height in points scaled by resolution
+  const float aPixelSize = float(theHeight) * float(theResolution) / 72.0f;
+  theHeight      = THE_DIST_FIELD_SIZE;
+  theResolution  = 72;
+  theFontHinting = Font_Hinting_Off;
+  return aPixelSize / float(THE_DIST_FIELD_SIZE);
+}
+
 // =======================================================================
 // function : FindFont
 // purpose  : Find or create font for rendering
@@ -165,7 +185,9 @@ occ::handle<Metal_Font> Metal_Text::FindFont(Metal_Context* theCtx,
     return occ::handle<Metal_Font>();
   }
 
-  TCollection_AsciiString aKey = FontKey(theAspect, theHeight, theResolution, theFontHinting);
+  bool isDistField = false;
+  AtlasParams(theCtx, theHeight, theResolution, theFontHinting, isDistField);
+  TCollection_AsciiString aKey = FontKey(theAspect, theHeight, theResolution, theFontHinting, isDistField);
 
   // Check if font is already cached
   occ::handle<Metal_Font> aFont;
@@ -195,6 +217,7 @@ occ::handle<Metal_Font> Metal_Text::FindFont(Metal_Context* theCtx,
   }
 
   aFont = new Metal_Font(aFontFt, aKey);
+  aFont->SetDistanceFieldSpread(isDistField ? THE_DIST_FIELD_SPREAD : 0);
   if (!aFont->Init(theCtx))
   {
     NSLog(@"Metal_Text: Font '%s' initialization failed!", aFontName.ToCString());
@@ -230,8 +253,14 @@ void Metal_Text::StringSize(Metal_Context* theCtx,
     return;
   }
 
-  theAscent = aFont->Ascender();
-  theDescent = aFont->Descender();
+  int anAtlasHeight = (int)theHeight;
+  unsigned int anAtlasResolution = theResolution;
+  Font_Hinting anAtlasHinting = theFontHinting;
+  bool isDistField = false;
+  const float aScale = AtlasParams(theCtx, anAtlasHeight, anAtlasResolution, anAtlasHinting, isDistField);
+
+  theAscent = aFont->Ascender() * aScale;
+  theDescent = aFont->Descender() * aScale;
 
   float aWidth = 0.0f;
   for (NCollection_UtfIterator<char> anIter = theText.Iterator(); *anIter != 0;)
@@ -263,7 +292,7 @@ void Metal_Text::StringSize(Metal_Context* theCtx,
 
     aWidth += aFont->FTFont()->AdvanceX(aCharThis, aCharNext);
   }
-  theWidth = std::max(theWidth, aWidth);
+  theWidth = std::max(theWidth, aWidth) * aScale;
 }
 
 // =======================================================================
@@ -351,6 +380,195 @@ void Metal_Text::Render(Metal_Context* theCtx,
   (void)theFontHinting;
 }
 
+// =======================================================================
+// function : isGeometryValid
+// purpose  : Return TRUE if glyph geometry has been built for current text parameters
+// =======================================================================
+bool Metal_Text::isGeometryValid(float theScale) const
+{
+  if (myGeomBuffer.IsNull())
+  {
+    return false;
+  }
+
+  // font resource key (covering height) is checked by render(), which releases geometry on change
+  return myGeomScale == theScale
+      && myGeomFormatter == myText->TextFormatter().get()
+      && myGeomHAlign == myText->HorizontalAlignment()
+      && myGeomVAlign == myText->VerticalAlignment()
+      && myGeomString.IsEqual(myText->Text());
+}
+
+// =======================================================================
+// function : buildGeometry
+// purpose  : Build glyph geometry of all atlas pages into a single buffer
+// =======================================================================
+void Metal_Text::buildGeometry(Metal_Context* theCtx, float theScale) const
+{
+  if (!myGeomBuffer.IsNull())
+  {
+    // the previous range is retired by allocator until GPU completes frames still using it
+    myGeomBuffer->Release(theCtx);
+  }
+  myNbGlyphVerts = 0;
+  myTextureIndices.Clear();
+  myPageFirst.Clear();
+  myPageCount.Clear();
+
+  occ::handle<Font_TextFormatter> aFormatter = myText->TextFormatter();
+  if (aFormatter.IsNull())
+  {
+    aFormatter = new Font_TextFormatter();
+  }
+  aFormatter->SetupAlignment(myText->HorizontalAlignment(), myText->VerticalAlignment());
+  aFormatter->Reset();
+  aFormatter->Append(myText->Text(), *myFont->FTFont());
+  aFormatter->Format();
+
+  // remember parameters even if geometry is empty to avoid formatting the same text every frame
+  myGeomString    = myText->Text();
+  myGeomHAlign    = myText->HorizontalAlignment();
+  myGeomVAlign    = myText->VerticalAlignment();
+  myGeomFormatter = myText->TextFormatter().get();
+  myGeomScale     = theScale;
+  if (myGeomBuffer.IsNull())
+  {
+    myGeomBuffer = new Metal_Buffer();
+  }
+
+  // Collect vertex data for each glyph grouped by atlas page
+  NCollection_Vector<NCollection_Vector<NCollection_Vec2<float>>> aVertsPerTex;
+  NCollection_Vector<NCollection_Vector<NCollection_Vec2<float>>> aTCrdsPerTex;
+
+  Metal_Font::Tile aTile;
+  NCollection_Vec2<float> aVec(0.0f, 0.0f);
+  const bool isDistField = myFont->DistanceFieldSpread() > 0;
+  auto toVertex = [isDistField](NCollection_Vec2<float>& theVec) -> NCollection_Vec2<float>&
+  {
+    return isDistField ? theVec : floorVec(theVec);
+  };
+
+  for (Font_TextFormatter::Iterator aFormatterIt(*aFormatter, Font_TextFormatter::IterationFilter_ExcludeInvisible);
+       aFormatterIt.More();
+       aFormatterIt.Next())
+  {
+    if (!myFont->RenderGlyph(theCtx, aFormatterIt.Symbol(), aTile))
+    {
+      continue;
+    }
+
+    const NCollection_Vec2<float>& aBottomLeft = aFormatter->BottomLeft(aFormatterIt.SymbolPosition());
+    aTile.px.Right += aBottomLeft.x();
+    aTile.px.Left += aBottomLeft.x();
+    aTile.px.Bottom += aBottomLeft.y();
+    aTile.px.Top += aBottomLeft.y();
+    if (isDistField)
+    {
+      // distance field glyphs are scaled from reference size without snapping to pixel grid
+      aTile.px.Left   *= theScale;
+      aTile.px.Right  *= theScale;
+      aTile.px.Bottom *= theScale;
+      aTile.px.Top    *= theScale;
+    }
+
+    const Font_Rect& aRectUV = aTile.uv;
+    const int aTexture = aTile.texture;
+
+    // Find or create vertex list for this texture
+    int aListId = -1;
+    for (int i = 0; i < myTextureIndices.Length(); ++i)
+    {
+      if (myTextureIndices.Value(i) == aTexture)
+      {
+        aListId = i;
+        break;
+      }
+    }
+    if (aListId < 0)
+    {
+      aListId = myTextureIndices.Length();
+      myTextureIndices.Append(aTexture);
+      aVertsPerTex.Append(NCollection_Vector<NCollection_Vec2<float>>());
+      aTCrdsPerTex.Append(NCollection_Vector<NCollection_Vec2<float>>());
+    }
+
+    NCollection_Vector<NCollection_Vec2<float>>& aVerts = aVertsPerTex.ChangeValue(aListId);
+    NCollection_Vector<NCollection_Vec2<float>>& aTCrds = aTCrdsPerTex.ChangeValue(aListId);
+
+    // Two triangles per glyph (6 vertices)
+    aVerts.Append(toVertex(aTile.px.TopRight(aVec)));
+    aVerts.Append(toVertex(aTile.px.TopLeft(aVec)));
+    aVerts.Append(toVertex(aTile.px.BottomLeft(aVec)));
+    aTCrds.Append(aRectUV.TopRight(aVec));
+    aTCrds.Append(aRectUV.TopLeft(aVec));
+    aTCrds.Append(aRectUV.BottomLeft(aVec));
+
+    aVerts.Append(toVertex(aTile.px.BottomRight(aVec)));
+    aVerts.Append(toVertex(aTile.px.TopRight(aVec)));
+    aVerts.Append(toVertex(aTile.px.BottomLeft(aVec)));
+    aTCrds.Append(aRectUV.BottomRight(aVec));
+    aTCrds.Append(aRectUV.TopRight(aVec));
+    aTCrds.Append(aRectUV.BottomLeft(aVec));
+
+    myNbGlyphVerts += 6;
+  }
+
+  if (myNbGlyphVerts == 0)
+  {
+    myTextureIndices.Clear();
+    return;
+  }
+
+  // Get bounding box for background
+  aFormatter->BndBox(myBndBox);
+  if (isDistField)
+  {
+    myBndBox.Left   *= theScale;
+    myBndBox.Right  *= theScale;
+    myBndBox.Bottom *= theScale;
+    myBndBox.Top    *= theScale;
+  }
+
+  // Pack pages contiguously: glyph positions, background quad, glyph texture coordinates
+  const int aNbElems = myNbGlyphVerts * 2 + 4;
+  std::vector<float> aData(size_t(aNbElems) * 2);
+  float* aPosData  = aData.data();
+  float* aTCrdData = aData.data() + (size_t(myNbGlyphVerts) + 4) * 2;
+  int aFirst = 0;
+  for (int aPageIter = 0; aPageIter < aVertsPerTex.Length(); ++aPageIter)
+  {
+    const NCollection_Vector<NCollection_Vec2<float>>& aVerts = aVertsPerTex.Value(aPageIter);
+    const NCollection_Vector<NCollection_Vec2<float>>& aTCrds = aTCrdsPerTex.Value(aPageIter);
+    for (int v = 0; v < aVerts.Length(); ++v)
+    {
+      const int anIndex = (aFirst + v) * 2;
+      aPosData[anIndex + 0]  = aVerts.Value(v).x();
+      aPosData[anIndex + 1]  = aVerts.Value(v).y();
+      aTCrdData[anIndex + 0] = aTCrds.Value(v).x();
+      aTCrdData[anIndex + 1] = aTCrds.Value(v).y();
+    }
+    myPageFirst.Append(aFirst);
+    myPageCount.Append(aVerts.Length());
+    aFirst += aVerts.Length();
+  }
+
+  // Background quad expanded slightly for padding (triangle strip)
+  const float aPadding = 2.0f;
+  float* aQuad = aPosData + size_t(myNbGlyphVerts) * 2;
+  aQuad[0] = myBndBox.Left - aPadding;  aQuad[1] = myBndBox.Bottom - aPadding;
+  aQuad[2] = myBndBox.Right + aPadding; aQuad[3] = myBndBox.Bottom - aPadding;
+  aQuad[4] = myBndBox.Left - aPadding;  aQuad[5] = myBndBox.Top + aPadding;
+  aQuad[6] = myBndBox.Right + aPadding; aQuad[7] = myBndBox.Top + aPadding;
+
+  if (!myGeomBuffer->Init(theCtx, 2, aNbElems, aData.data()))
+  {
+    myNbGlyphVerts = 0;
+    myTextureIndices.Clear();
+    myPageFirst.Clear();
+    myPageCount.Clear();
+  }
+}
+
 // =======================================================================
 // function : render
 // purpose  : Render implementation
@@ -378,8 +596,14 @@ void Metal_Text::render(Metal_Workspace* theWorkspace,
     return;
   }
 
-  // Check if we need to rebuild font
-  TCollection_AsciiString aFontKey = FontKey(theAspect, (int)myText->Height(), theResolution, theFontHinting);
+  // Check if we need to rebuild font;
+  // distance field atlas is shared by all heights, which only change the scale of glyph geometry
+  int anAtlasHeight = (int)myText->Height();
+  unsigned int anAtlasResolution = theResolution;
+  Font_Hinting anAtlasHinting = theFontHinting;
+  bool isDistField = false;
+  const float anAtlasScale = AtlasParams(theCtx, anAtlasHeight, anAtlasResolution, anAtlasHinting, isDistField);
+  TCollection_AsciiString aFontKey = FontKey(theAspect, anAtlasHeight, anAtlasResolution, anAtlasHinting, isDistField);
   if (!myFont.IsNull() && !myFont->ResourceKey().IsEqual(aFontKey))
   {
     const_cast<Metal_Text*>(this)->Release(theCtx);
@@ -388,7 +612,7 @@ void Metal_Text::render(Metal_Workspace* theWorkspace,
   // Find or create font
   if (myFont.IsNull())
   {
-    myFont = FindFont(theCtx, theAspect, (int)myText->Height(), theResolution, theFontHinting);
+    myFont = FindFont(theCtx, theAspect, anAtlasHeight, anAtlasResolution, anAtlasHinting);
   }
   if (myFont.IsNull() || !myFont->WasInitialized())
   {
@@ -423,127 +647,11 @@ void Metal_Text::render(Metal_Workspace* theWorkspace,
   }
 
   // Build glyph geometry if needed
-  if (myVertsBuffers.IsEmpty())
+  if (!isGeometryValid(anAtlasScale))
   {
-    occ::handle<Font_TextFormatter> aFormatter = myText->TextFormatter();
-    if (aFormatter.IsNull())
-    {
-      aFormatter = new Font_TextFormatter();
-    }
-    aFormatter->SetupAlignment(myText->HorizontalAlignment(), myText->VerticalAlignment());
-    aFormatter->Reset();
-    aFormatter->Append(myText->Text(), *myFont->FTFont());
-    aFormatter->Format();
-
-    // Build glyph quads
-    id<MTLDevice> aDevice = theCtx->Device();
-    if (aDevice == nil)
-    {
-      return;
-    }
-
-    // Create vertex data for each glyph
-    NCollection_Vector<NCollection_Vector<NCollection_Vec2<float>>> aVertsPerTex;
-    NCollection_Vector<NCollection_Vector<NCollection_Vec2<float>>> aTCrdsPerTex;
-    NCollection_Vector<int> aTexIndices;
-
-    Metal_Font::Tile aTile;
-    NCollection_Vec2<float> aVec(0.0f, 0.0f);
-
-    for (Font_TextFormatter::Iterator aFormatterIt(*aFormatter, Font_TextFormatter::IterationFilter_ExcludeInvisible);
-         aFormatterIt.More();
-         aFormatterIt.Next())
-    {
-      if (!myFont->RenderGlyph(theCtx, aFormatterIt.Symbol(), aTile))
-      {
-        continue;
-      }
-
-      const NCollection_Vec2<float>& aBottomLeft = aFormatter->BottomLeft(aFormatterIt.SymbolPosition());
-      aTile.px.Right += aBottomLeft.x();
-      aTile.px.Left += aBottomLeft.x();
-      aTile.px.Bottom += aBottomLeft.y();
-      aTile.px.Top += aBottomLeft.y();
-
-      const Font_Rect& aRectUV = aTile.uv;
-      const int aTexture = aTile.texture;
-
-      // Find or create vertex list for this texture
-      int aListId = -1;
-      for (int i = 0; i < aTexIndices.Length(); ++i)
-      {
-        if (aTexIndices.Value(i) == aTexture)
-        {
-          aListId = i;
-          break;
-        }
-      }
-      if (aListId < 0)
-      {
-        aListId = aTexIndices.Length();
-        aTexIndices.Append(aTexture);
-        aVertsPerTex.Append(NCollection_Vector<NCollection_Vec2<float>>());
-        aTCrdsPerTex.Append(NCollection_Vector<NCollection_Vec2<float>>());
-      }
-
-      NCollection_Vector<NCollection_Vec2<float>>& aVerts = aVertsPerTex.ChangeValue(aListId);
-      NCollection_Vector<NCollection_Vec2<float>>& aTCrds = aTCrdsPerTex.ChangeValue(aListId);
-
-      // Two triangles per glyph (6 vertices)
-      aVerts.Append(floorVec(aTile.px.TopRight(aVec)));
-      aVerts.Append(floorVec(aTile.px.TopLeft(aVec)));
-      aVerts.Append(floorVec(aTile.px.BottomLeft(aVec)));
-      aTCrds.Append(aRectUV.TopRight(aVec));
-      aTCrds.Append(aRectUV.TopLeft(aVec));
-      aTCrds.Append(aRectUV.BottomLeft(aVec));
-
-      aVerts.Append(floorVec(aTile.px.BottomRight(aVec)));
-      aVerts.Append(floorVec(aTile.px.TopRight(aVec)));
-      aVerts.Append(floorVec(aTile.px.BottomLeft(aVec)));
-      aTCrds.Append(aRectUV.BottomRight(aVec));
-      aTCrds.Append(aRectUV.TopRight(aVec));
-      aTCrds.Append(aRectUV.BottomLeft(aVec));
-    }
-
-    // Create Metal buffers
-    myTextureIndices = aTexIndices;
-    for (int i = 0; i < aVertsPerTex.Length(); ++i)
-    {
-      const NCollection_Vector<NCollection_Vec2<float>>& aVerts = aVertsPerTex.Value(i);
-      const NCollection_Vector<NCollection_Vec2<float>>& aTCrds = aTCrdsPerTex.Value(i);
-
-      if (aVerts.IsEmpty())
-      {
-        continue;
-      }
-
-      // Copy to contiguous arrays
-      size_t aVertCount = aVerts.Length();
-      std::vector<float> aVertsData(aVertCount * 2);
-      std::vector<float> aTCrdsData(aVertCount * 2);
-      for (int v = 0; v < (int)aVertCount; ++v)
-      {
-        aVertsData[v * 2 + 0] = aVerts.Value(v).x();
-        aVertsData[v * 2 + 1] = aVerts.Value(v).y();
-        aTCrdsData[v * 2 + 0] = aTCrds.Value(v).x();
-        aTCrdsData[v * 2 + 1] = aTCrds.Value(v).y();
-      }
-
-      id<MTLBuffer> aVertsBuffer = [aDevice newBufferWithBytes:aVertsData.data()
-                                                        length:aVertsData.size() * sizeof(float)
-                                                       options:MTLResourceStorageModeShared];
-      id<MTLBuffer> aTCrdsBuffer = [aDevice newBufferWithBytes:aTCrdsData.data()
-                                                        length:aTCrdsData.size() * sizeof(float)
-                                                       options:MTLResourceStorageModeShared];
-      myVertsBuffers.Append(aVertsBuffer);
-      myTCrdsBuffers.Append(aTCrdsBuffer);
-    }
-
-    // Get bounding box for background
-    aFormatter->BndBox(myBndBox);
+    buildGeometry(theCtx, anAtlasScale);
   }
-
-  if (myVertsBuffers.IsEmpty())
+  if (myPageFirst.IsEmpty())
   {
     return;
   }
@@ -654,7 +762,8 @@ void Metal_Text::drawText(Metal_Workspace* theWorkspace,
 {
   (void)theAspect;
 
-  if (theWorkspace == nullptr || myVertsBuffers.IsEmpty())
+  if (theWorkspace == nullptr || myPageFirst.IsEmpty()
+   || myGeomBuffer.IsNull() || !myGeomBuffer->IsValid())
   {
     return;
   }
@@ -678,7 +787,7 @@ void Metal_Text::drawText(Metal_Workspace* theWorkspace,
     float Color[4];
     float Offset[2];
     float Scale;
-    float Padding;
+    float DistFieldSpread; //!< spread of distance field atlas in text pixels, 0 for coverage atlas
   };
 
   // Prepare uniforms
@@ -751,27 +860,30 @@ void Metal_Text::drawText(Metal_Workspace* theWorkspace,
   aUniforms.Offset[0] = myTextOffset.x();
   aUniforms.Offset[1] = myTextOffset.y();
   aUniforms.Scale = myScaleHeight;
-  aUniforms.Padding = 0.0f;
+  aUniforms.DistFieldSpread = !myFont.IsNull() ? float(myFont->DistanceFieldSpread()) * myGeomScale : 0.0f;
+
+  // Bind the packed geometry and uniforms once; atlas pages differ only by offsets and texture
+  id<MTLBuffer> aGeomBuffer = myGeomBuffer->Buffer();
+  const size_t aPosOffset  = myGeomBuffer->Offset();
+  const size_t aTCrdOffset = aPosOffset + (size_t(myNbGlyphVerts) + 4) * 2 * sizeof(float);
+  [anEncoder setVertexBytes:&aUniforms length:sizeof(aUniforms) atIndex:2];
+  [anEncoder setFragmentBytes:&aUniforms length:sizeof(aUniforms) atIndex:0];
 
   // Draw each texture batch
-  for (int i = 0; i < myVertsBuffers.Length(); ++i)
+  for (int i = 0; i < myPageFirst.Length(); ++i)
   {
-    id<MTLBuffer> aVertsBuffer = myVertsBuffers.Value(i);
-    id<MTLBuffer> aTCrdsBuffer = myTCrdsBuffers.Value(i);
-    int aTexIndex = myTextureIndices.Value(i);
-
-    if (aVertsBuffer == nil || aTCrdsBuffer == nil)
+    const int aTexIndex = myTextureIndices.Value(i);
+    const size_t aFirstOffset = size_t(myPageFirst.Value(i)) * 2 * sizeof(float);
+    if (i == 0)
     {
-      continue;
+      [anEncoder setVertexBuffer:aGeomBuffer offset:aPosOffset + aFirstOffset atIndex:0];
+      [anEncoder setVertexBuffer:aGeomBuffer offset:aTCrdOffset + aFirstOffset atIndex:1];
+    }
+    else
+    {
+      [anEncoder setVertexBufferOffset:aPosOffset + aFirstOffset atIndex:0];
+      [anEncoder setVertexBufferOffset:aTCrdOffset + aFirstOffset atIndex:1];
     }
-
-    // Bind vertex buffers
-    [anEncoder setVertexBuffer:aVertsBuffer offset:0 atIndex:0];
-    [anEncoder setVertexBuffer:aTCrdsBuffer offset:0 atIndex:1];
-
-    // Bind uniforms
-    [anEncoder setVertexBytes:&aUniforms length:sizeof(aUniforms) atIndex:2];
-    [anEncoder setFragmentBytes:&aUniforms length:sizeof(aUniforms) atIndex:0];
 
     // Bind font texture
     if (!myFont.IsNull() && aTexIndex >= 0 && aTexIndex < myFont->NbTextures())
@@ -784,10 +896,9 @@ void Metal_Text::drawText(Metal_Workspace* theWorkspace,
     }
 
     // Draw triangles
-    NSUInteger aVertCount = [aVertsBuffer length] / (2 * sizeof(float));
     [anEncoder drawPrimitives:MTLPrimitiveTypeTriangle
                   vertexStart:0
-                  vertexCount:aVertCount];
+                  vertexCount:NSUInteger(myPageCount.Value(i))];
   }
 }
 
@@ -818,28 +929,8 @@ void Metal_Text::drawRect(Metal_Workspace* theWorkspace,
     return;
   }
 
-  // Create background quad vertices if needed
-  if (myBndVertsBuffer == nil)
-  {
-    // Expand bounding box slightly for padding
-    float aPadding = 2.0f;
-    float aQuad[8] = {
-      myBndBox.Left - aPadding,  myBndBox.Bottom - aPadding,
-      myBndBox.Right + aPadding, myBndBox.Bottom - aPadding,
-      myBndBox.Left - aPadding,  myBndBox.Top + aPadding,
-      myBndBox.Right + aPadding, myBndBox.Top + aPadding
-    };
-
-    id<MTLDevice> aDevice = aCtx->Device();
-    if (aDevice != nil)
-    {
-      myBndVertsBuffer = [aDevice newBufferWithBytes:aQuad
-                                              length:sizeof(aQuad)
-                                             options:MTLResourceStorageModeShared];
-    }
-  }
-
-  if (myBndVertsBuffer == nil)
+  // Background quad is packed right after glyph positions
+  if (myPageFirst.IsEmpty() || myGeomBuffer.IsNull() || !myGeomBuffer->IsValid())
   {
     return;
   }
@@ -912,7 +1003,9 @@ void Metal_Text::drawRect(Metal_Workspace* theWorkspace,
   aUniforms.Color[3] = theColor.w();
 
   // Bind vertex buffer
-  [anEncoder setVertexBuffer:myBndVertsBuffer offset:0 atIndex:0];
+  [anEncoder setVertexBuffer:myGeomBuffer->Buffer()
+                     offset:myGeomBuffer->Offset() + size_t(myNbGlyphVerts) * 2 * sizeof(float)
+                    atIndex:0];
 
   // Bind uniforms
   [anEncoder setVertexBytes:&aUniforms length:sizeof(aUniforms) atIndex:2];
@@ -15,6 +15,7 @@
 #define Metal_Texture_HeaderFile
 
 #include <Metal_Resource.hxx>
+#include <Graphic3d_TextureRoot.hxx>
 #include <Graphic3d_TextureUnit.hxx>
 #include <Image_PixMap.hxx>
 #include <Image_CompressedFormat.hxx>
@@ -137,12 +138,27 @@ public:
                                      int theFormat,
                                      int theMipLevels = 1);
 
-  //! Create texture from compressed image data.
+  //! Create texture from block-compressed image data (BC or ASTC).
+  //! The prebuilt mip chain is uploaded as is (no mipmaps are generated at runtime)
+  //! into texture with private storage by a blit submitted before the frame (see Metal_StagingRing::BlitEncoder()).
   //! @param theCtx Metal context
   //! @param theImage compressed image data
-  //! @return true on success
+  //! @param theSRGB use sRGB variant of the format
+  //! @return true on success, false if the format is not supported by device
   Standard_EXPORT bool CreateCompressed(Metal_Context* theCtx,
-                                        const Image_CompressedPixMap& theImage);
+                                        const Image_CompressedPixMap& theImage,
+                                        bool theSRGB = false);
+
+  //! Create 2D texture from texture definition:
+  //! precompressed image (Graphic3d_TextureRoot::GetCompressedImage()) is used when its format
+  //! is supported by device (Metal_Context::SupportedTextureFormats()), otherwise the decoded image.
+  //! @param theCtx Metal context
+  //! @param theTexture texture definition
+  //! @param theGenerateMips generate mipmaps of decoded image
+  //! @return true on success
+  Standard_EXPORT bool Init(Metal_Context* theCtx,
+                            const occ::handle<Graphic3d_TextureRoot>& theTexture,
+                            bool theGenerateMips = true);
 
   //! Upload image data to existing texture.
   //! @param theCtx Metal context
@@ -175,6 +191,8 @@ public:
                               int theOffsetY);
 
   //! Generate mipmaps for texture.
+  //! Encoded into transfers of the staging ring (see Metal_StagingRing::BlitEncoder()),
+  //! so that the texture should not be accessed by submitted frames, like one filled by CPU.
   //! @param theCtx Metal context
   Standard_EXPORT void GenerateMipmaps(Metal_Context* theCtx);
 
@@ -212,7 +230,7 @@ public:
   //! Return bytes per pixel for Metal pixel format.
   Standard_EXPORT static int BytesPerPixel(int theMetalFormat);
 
-  //! Return block size for compressed format (4 for BC/DXT, 0 for uncompressed).
+  //! Return block size for compressed format (4 for BC/DXT and ASTC 4x4, 8 for ASTC 8x8, 0 for uncompressed).
   Standard_EXPORT static int CompressedBlockSize(int theMetalFormat);
 
   //! Return bytes per block for compressed format.
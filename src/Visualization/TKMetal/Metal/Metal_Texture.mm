@@ -146,6 +146,12 @@ int Metal_Texture::ToMetalCompressedFormat(Image_CompressedFormat theFormat, boo
       return theSRGB ? MTLPixelFormatBC2_RGBA_sRGB : MTLPixelFormatBC2_RGBA;
     case Image_CompressedFormat_RGBA_S3TC_DXT5:
       return theSRGB ? MTLPixelFormatBC3_RGBA_sRGB : MTLPixelFormatBC3_RGBA;
+    case Image_CompressedFormat_RGBA_BPTC:
+      return theSRGB ? MTLPixelFormatBC7_RGBAUnorm_sRGB : MTLPixelFormatBC7_RGBAUnorm;
+    case Image_CompressedFormat_RGBA_ASTC_4x4:
+      return theSRGB ? MTLPixelFormatASTC_4x4_sRGB : MTLPixelFormatASTC_4x4_LDR;
+    case Image_CompressedFormat_RGBA_ASTC_8x8:
+      return theSRGB ? MTLPixelFormatASTC_8x8_sRGB : MTLPixelFormatASTC_8x8_LDR;
     default:
       return 0;
   }
@@ -173,7 +179,12 @@ int Metal_Texture::CompressedBlockSize(int theMetalFormat)
     case MTLPixelFormatBC6H_RGBUfloat:
     case MTLPixelFormatBC7_RGBAUnorm:
     case MTLPixelFormatBC7_RGBAUnorm_sRGB:
+    case MTLPixelFormatASTC_4x4_LDR:
+    case MTLPixelFormatASTC_4x4_sRGB:
       return 4; // 4x4 block
+    case MTLPixelFormatASTC_8x8_LDR:
+    case MTLPixelFormatASTC_8x8_sRGB:
+      return 8; // 8x8 block
     default:
       return 0; // Not compressed
   }
@@ -202,7 +213,11 @@ int Metal_Texture::CompressedBytesPerBlock(int theMetalFormat)
     case MTLPixelFormatBC6H_RGBUfloat:
     case MTLPixelFormatBC7_RGBAUnorm:
     case MTLPixelFormatBC7_RGBAUnorm_sRGB:
-      return 16; // 16 bytes per 4x4 block
+    case MTLPixelFormatASTC_4x4_LDR:
+    case MTLPixelFormatASTC_4x4_sRGB:
+    case MTLPixelFormatASTC_8x8_LDR:
+    case MTLPixelFormatASTC_8x8_sRGB:
+      return 16; // 16 bytes per block
     default:
       return 0;
   }
@@ -741,6 +756,16 @@ void Metal_Texture::GenerateMipmaps(Metal_Context* theCtx)
     return;
   }
 
+  // textures are filled by CPU, so that mipmaps are generated together with transfers of the staging ring
+  if (!theCtx->StagingRing().IsNull())
+  {
+    if (id<MTLBlitCommandEncoder> aBlitEncoder = theCtx->StagingRing()->BlitEncoder(theCtx, true))
+    {
+      [aBlitEncoder generateMipmapsForTexture:myTexture];
+      return;
+    }
+  }
+
   id<MTLCommandBuffer> aCmdBuffer = theCtx->CurrentCommandBuffer();
   id<MTLBlitCommandEncoder> aBlitEncoder = [aCmdBuffer blitCommandEncoder];
   [aBlitEncoder generateMipmapsForTexture:myTexture];
@@ -753,7 +778,10 @@ void Metal_Texture::GenerateMipmaps(Metal_Context* theCtx)
 // =======================================================================
 void Metal_Texture::Release(Metal_Context* theCtx)
 {
-  (void)theCtx;
+  if (theCtx != nullptr && !theCtx->BindlessTable().IsNull())
+  {
+    theCtx->BindlessTable()->UnregisterTexture(this);
+  }
 
   if (myTexture != nil)
   {
@@ -875,7 +903,8 @@ bool Metal_Texture::Create2DArray(Metal_Context* theCtx,
 // purpose  : Create texture from compressed image data
 // =======================================================================
 bool Metal_Texture::CreateCompressed(Metal_Context* theCtx,
-                                     const Image_CompressedPixMap& theImage)
+                                     const Image_CompressedPixMap& theImage,
+                                     bool theSRGB)
 {
   Release(theCtx);
 
@@ -884,15 +913,20 @@ bool Metal_Texture::CreateCompressed(Metal_Context* theCtx,
     return false;
   }
 
-  if (theImage.FaceData().IsNull() || theImage.FaceData()->IsEmpty())
+  if (theImage.FaceData().IsNull() || theImage.FaceData()->IsEmpty()
+   || theImage.MipMaps().IsEmpty())
   {
     return false;
   }
 
-  myPixelFormat = ToMetalCompressedFormat(theImage.CompressedFormat(), false);
-  if (myPixelFormat == 0)
+  myPixelFormat = ToMetalCompressedFormat(theImage.CompressedFormat(), theSRGB);
+  if (myPixelFormat == 0
+  || !theCtx->SupportedTextureFormats()->IsSupported(theImage.CompressedFormat()))
   {
-    // Unsupported compressed format
+    theCtx->Messenger()->SendWarning() << "Metal_Texture: compressed format "
+                                       << Image_PixMap::ImageFormatToString(theImage.CompressedFormat())
+                                       << " is not supported by device";
+    myPixelFormat = 0;
     return false;
   }
 
@@ -900,9 +934,33 @@ bool Metal_Texture::CreateCompressed(Metal_Context* theCtx,
   myHeight = (int)theImage.SizeY();
   myDepth = 1;
   myTextureType = Metal_TextureType_2D;
-  // MipMaps() contains mip sizes including base level
-  myMipLevels = std::max(1, (int)theImage.MipMaps().Size());
   myArrayLayers = 1;
+  // MipMaps() contains sizes of the stored levels including base level;
+  // an incomplete chain is sampled only up to the last stored level
+  myMipLevels = theImage.MipMaps().Size();
+
+  // validate stored levels against block layout of the format
+  const int aBlockSize = CompressedBlockSize(myPixelFormat);
+  const int aBytesPerBlock = CompressedBytesPerBlock(myPixelFormat);
+  size_t aChainSize = 0;
+  for (int aLevel = 0, aMipWidth = myWidth, aMipHeight = myHeight; aLevel < myMipLevels; ++aLevel)
+  {
+    const size_t aMipSize = size_t((aMipWidth  + aBlockSize - 1) / aBlockSize)
+                          * size_t((aMipHeight + aBlockSize - 1) / aBlockSize) * aBytesPerBlock;
+    if (aMipSize != (size_t)theImage.MipMaps().Value(theImage.MipMaps().Lower() + aLevel))
+    {
+      theCtx->Messenger()->SendWarning() << "Metal_Texture: inconsistent size of compressed mip level #" << aLevel;
+      return false;
+    }
+    aChainSize += aMipSize;
+    aMipWidth  = std::max(1, aMipWidth  / 2);
+    aMipHeight = std::max(1, aMipHeight / 2);
+  }
+  if (aChainSize > theImage.FaceData()->Size())
+  {
+    theCtx->Messenger()->SendWarning() << "Metal_Texture: compressed image data is truncated";
+    return false;
+  }
 
   MTLTextureDescriptor* aDesc = [[MTLTextureDescriptor alloc] init];
   aDesc.textureType = MTLTextureType2D;
@@ -913,70 +971,79 @@ bool Metal_Texture::CreateCompressed(Metal_Context* theCtx,
   aDesc.mipmapLevelCount = myMipLevels;
   aDesc.arrayLength = 1;
   aDesc.sampleCount = 1;
-  aDesc.storageMode = MTLStorageModeShared;
+  aDesc.storageMode = MTLStorageModePrivate;
   aDesc.usage = MTLTextureUsageShaderRead;
 
   id<MTLDevice> aDevice = theCtx->Device();
   myTexture = [aDevice newTextureWithDescriptor:aDesc];
-  if (myTexture == nil)
+
+  // the staging copy is retained by the upload command buffer until the blit is completed
+  id<MTLBuffer> aStaging = myTexture != nil
+                         ? [aDevice newBufferWithBytes:theImage.FaceData()->Data()
+                                                length:aChainSize
+                                               options:MTLResourceStorageModeShared]
+                         : nil;
+  id<MTLBlitCommandEncoder> aBlit = aStaging != nil && !theCtx->StagingRing().IsNull()
+                                  ? theCtx->StagingRing()->BlitEncoder(theCtx, true)
+                                  : nil;
+  if (aBlit == nil)
   {
+    Release(theCtx);
     return false;
   }
 
-  // Upload base level
-  int aBlockSize = CompressedBlockSize(myPixelFormat);
-  int aBytesPerBlock = CompressedBytesPerBlock(myPixelFormat);
-  int aBlocksWide = (myWidth + aBlockSize - 1) / aBlockSize;
-  int aBytesPerRow = aBlocksWide * aBytesPerBlock;
-
-  MTLRegion aRegion = MTLRegionMake2D(0, 0, myWidth, myHeight);
-  [myTexture replaceRegion:aRegion
-               mipmapLevel:0
-                 withBytes:theImage.FaceData()->Data()
-               bytesPerRow:aBytesPerRow];
-
-  // Upload mipmap levels
-  // MipMaps() returns an array of mip level sizes (in bytes) stored sequentially in FaceData()
-  const NCollection_Array1<int>& aMipSizes = theImage.MipMaps();
-  const uint8_t* aDataPtr = theImage.FaceData()->Data();
   size_t aDataOffset = 0;
-
-  // First entry in MipMaps is typically the base level size, subsequent are mip levels
-  int aMipWidth = myWidth;
-  int aMipHeight = myHeight;
-
-  for (int aLevel = 0; aLevel < aMipSizes.Size() && aLevel < myMipLevels; ++aLevel)
+  for (int aLevel = 0, aMipWidth = myWidth, aMipHeight = myHeight; aLevel < myMipLevels; ++aLevel)
   {
-    int aMipBlocksWide = (aMipWidth + aBlockSize - 1) / aBlockSize;
-    int aMipBlocksHigh = (aMipHeight + aBlockSize - 1) / aBlockSize;
-    int aMipBytesPerRow = aMipBlocksWide * aBytesPerBlock;
-    int aMipSize = aMipBlocksWide * aMipBlocksHigh * aBytesPerBlock;
+    const size_t aBlocksWide = size_t((aMipWidth  + aBlockSize - 1) / aBlockSize);
+    const size_t aBlocksHigh = size_t((aMipHeight + aBlockSize - 1) / aBlockSize);
+    const size_t aBytesPerRow = aBlocksWide * aBytesPerBlock;
+    [aBlit copyFromBuffer:aStaging
+             sourceOffset:aDataOffset
+        sourceBytesPerRow:aBytesPerRow
+      sourceBytesPerImage:aBytesPerRow * aBlocksHigh
+               sourceSize:MTLSizeMake(aMipWidth, aMipHeight, 1)
+                toTexture:myTexture
+         destinationSlice:0
+         destinationLevel:aLevel
+        destinationOrigin:MTLOriginMake(0, 0, 0)];
+
+    aDataOffset += aBytesPerRow * aBlocksHigh;
+    aMipWidth  = std::max(1, aMipWidth  / 2);
+    aMipHeight = std::max(1, aMipHeight / 2);
+  }
 
-    if (aLevel > 0) // Base level already uploaded
-    {
-      MTLRegion aMipRegion = MTLRegionMake2D(0, 0, aMipWidth, aMipHeight);
-      [myTexture replaceRegion:aMipRegion
-                   mipmapLevel:aLevel
-                     withBytes:(aDataPtr + aDataOffset)
-                   bytesPerRow:aMipBytesPerRow];
-    }
+  myEstimatedSize = aChainSize;
+  return true;
+}
 
-    aDataOffset += aMipSize;
-    aMipWidth = std::max(1, aMipWidth / 2);
-    aMipHeight = std::max(1, aMipHeight / 2);
+// =======================================================================
+// function : Init
+// purpose  : Create texture from texture definition
+// =======================================================================
+bool Metal_Texture::Init(Metal_Context* theCtx,
+                         const occ::handle<Graphic3d_TextureRoot>& theTexture,
+                         bool theGenerateMips)
+{
+  if (theCtx == nullptr || !theCtx->IsValid() || theTexture.IsNull())
+  {
+    return false;
   }
 
-  // Estimate size (approximate for compressed textures)
-  myEstimatedSize = 0;
-  int w = myWidth, h = myHeight;
-  for (int i = 0; i < myMipLevels; ++i)
+  // precompressed image is uploaded without decoding and occupies 4-8 times less memory
+  const occ::handle<Image_SupportedFormats>& aFormats = theCtx->SupportedTextureFormats();
+  if (aFormats->HasCompressed())
   {
-    int blocksW = (w + aBlockSize - 1) / aBlockSize;
-    int blocksH = (h + aBlockSize - 1) / aBlockSize;
-    myEstimatedSize += blocksW * blocksH * aBytesPerBlock;
-    w = std::max(1, w / 2);
-    h = std::max(1, h / 2);
+    const occ::handle<Image_CompressedPixMap> aCompressed = theTexture->GetCompressedImage(aFormats);
+    if (!aCompressed.IsNull()
+     && aCompressed->NbFaces() <= 1
+     && CreateCompressed(theCtx, *aCompressed, false))
+    {
+      return true;
+    }
   }
 
-  return true;
+  const occ::handle<Image_PixMap> anImage = theTexture->GetImage(aFormats);
+  return !anImage.IsNull()
+      && Create2D(theCtx, *anImage, theGenerateMips);
 }
@@ -14,6 +14,7 @@
 #ifndef Metal_TileSampler_HeaderFile
 #define Metal_TileSampler_HeaderFile
 
+#include <Metal_ComputePipeline.hxx>
 #include <Metal_HaltonSampler.hxx>
 #include <Metal_Texture.hxx>
 #include <NCollection_Vec2.hxx>
@@ -37,6 +38,7 @@ class Metal_Context;
 //! - Halton sequence for quasi-random tile sampling
 //! - Configurable tile size and sample distribution
 //! - GPU texture upload for shader access
+//! - GPU-resident sampling (EncodeSampling()) with no CPU readback of variance
 class Metal_TileSampler
 {
 public:
@@ -140,6 +142,35 @@ public:
                                      const occ::handle<Metal_Texture>& theOffsetsTexture,
                                      bool theAdaptive);
 
+  //! Compile kernels for GPU-resident sampling.
+  //! @return FALSE if kernels are unavailable (CPU path should be used then)
+  Standard_EXPORT bool InitGpuSampling(Metal_Context* theCtx);
+
+  //! Return true if GPU-resident sampling kernels are ready.
+  bool HasGpuSampling() const { return !mySampleTilesPipeline.IsNull() && mySampleTilesPipeline->IsValid(); }
+
+  //! Release GPU-resident sampling resources.
+  Standard_EXPORT void ReleaseGpuSampling(Metal_Context* theCtx);
+
+#ifdef __OBJC__
+  //! Encode per-tile variance reduction, tile sampling and writing of sample and offset maps into command buffer.
+  //! Replaces GrabVarianceMap() + UploadSamples() + UploadOffsets(), so that sampling decisions never leave GPU.
+  //! Samples (R32Uint) and offsets (RG32Sint) textures should be created with MTLTextureUsageShaderWrite.
+  //! @param theCtx Metal context
+  //! @param theCmdBuffer command buffer to encode kernels into (before path tracing reading the maps)
+  //! @param theVarianceTexture per-tile variance (R32Float) written by previous iteration
+  //! @param theSamplesTexture target samples map
+  //! @param theOffsetsTexture target offsets map
+  //! @param theAdaptive use adaptive sampling
+  //! @return true on success
+  Standard_EXPORT bool EncodeSampling(Metal_Context* theCtx,
+                                      id<MTLCommandBuffer> theCmdBuffer,
+                                      const occ::handle<Metal_Texture>& theVarianceTexture,
+                                      const occ::handle<Metal_Texture>& theSamplesTexture,
+                                      const occ::handle<Metal_Texture>& theOffsetsTexture,
+                                      bool theAdaptive);
+#endif
+
   //! Return current sample index.
   unsigned int CurrentSample() const { return myLastSample; }
 
@@ -181,6 +212,19 @@ protected:
   float                myScaleFactor;   //!< Variance quantization scale
   int                  myTileSize;      //!< Tile size in pixels
   NCollection_Vec2<int> myViewSize;     //!< Viewport size
+
+  occ::handle<Metal_ComputePipeline> myBuildCdfPipeline;     //!< variance reduction into sampling distribution
+  occ::handle<Metal_ComputePipeline> mySampleTilesPipeline;  //!< tile sampling into offsets map
+  occ::handle<Metal_ComputePipeline> myWriteSamplesPipeline; //!< per-tile sample counts into samples map
+#ifdef __OBJC__
+  id<MTLBuffer> myGpuCdfBuffer;      //!< per-row conditional distribution of tiles
+  id<MTLBuffer> myGpuMarginalBuffer; //!< marginal distribution of rows
+  id<MTLBuffer> myGpuCountBuffer;    //!< number of samples per tile
+#else
+  void* myGpuCdfBuffer;
+  void* myGpuMarginalBuffer;
+  void* myGpuCountBuffer;
+#endif
 };
 
 #endif // Metal_TileSampler_HeaderFile
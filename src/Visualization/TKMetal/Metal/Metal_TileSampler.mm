@@ -22,6 +22,176 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstring>
+
+namespace
+{
+  //! Number of threads of the single threadgroup building sampling distribution.
+  static const NSUInteger THE_CDF_GROUP_SIZE = 256;
+
+  //! Tile sampling uniforms (should match TileUniforms in THE_TILE_SAMPLER_SHADER).
+  struct Metal_TileSamplerUniforms
+  {
+    uint32_t NbTilesX;
+    uint32_t NbTilesY;
+    uint32_t NbOffsetsX;
+    uint32_t NbOffsetsY;
+    uint32_t FirstSample;
+    uint32_t IsAdaptive;
+    uint32_t Padding[2];
+  };
+
+  //! Kernels for GPU-resident adaptive sampling:
+  //! tile_build_cdf reduces per-tile variance into conditional (per-row) and marginal distributions,
+  //! tile_sample draws one tile per offsets map entry using Halton sequence (bases 2 and 3),
+  //! tile_write_samples stores the resulting number of samples per tile.
+  static const char* THE_TILE_SAMPLER_SHADER = R"(
+#include <metal_stdlib>
+using namespace metal;
+
+struct TileUniforms
+{
+  uint  NbTilesX;
+  uint  NbTilesY;
+  uint  NbOffsetsX;
+  uint  NbOffsetsY;
+  uint  FirstSample;
+  uint  IsAdaptive;
+  uint2 Padding;
+};
+
+kernel void tile_build_cdf(constant TileUniforms&      theParams   [[buffer(0)]],
+                           device float*               theCdf      [[buffer(1)]],
+                           device float*               theMarginal [[buffer(2)]],
+                           device atomic_uint*         theCounts   [[buffer(3)]],
+                           texture2d<float, access::read> theVariance [[texture(0)]],
+                           uint theThread   [[thread_index_in_threadgroup]],
+                           uint theNbThreads [[threads_per_threadgroup]])
+{
+  for (uint aRow = theThread; aRow < theParams.NbTilesY; aRow += theNbThreads)
+  {
+    float aRowSum = 0.0f;
+    for (uint aCol = 0; aCol < theParams.NbTilesX; ++aCol)
+    {
+      aRowSum += max(theVariance.read(uint2(aCol, aRow)).r, 0.0f);
+      atomic_store_explicit(&theCounts[aRow * theParams.NbTilesX + aCol], 0u, memory_order_relaxed);
+    }
+
+    float anAccum = 0.0f;
+    for (uint aCol = 0; aCol < theParams.NbTilesX; ++aCol)
+    {
+      anAccum += aRowSum > 0.0f
+               ? max(theVariance.read(uint2(aCol, aRow)).r, 0.0f) / aRowSum
+               : 1.0f / float(theParams.NbTilesX);
+      theCdf[aRow * theParams.NbTilesX + aCol] = anAccum;
+    }
+    theCdf[aRow * theParams.NbTilesX + theParams.NbTilesX - 1] = 1.0f;
+    theMarginal[aRow] = aRowSum;
+  }
+
+  threadgroup_barrier(mem_flags::mem_device);
+  if (theThread != 0)
+  {
+    return;
+  }
+
+  float aTotal = 0.0f;
+  for (uint aRow = 0; aRow < theParams.NbTilesY; ++aRow)
+  {
+    aTotal += theMarginal[aRow];
+  }
+  float anAccum = 0.0f;
+  for (uint aRow = 0; aRow < theParams.NbTilesY; ++aRow)
+  {
+    anAccum += aTotal > 0.0f ? theMarginal[aRow] / aTotal : 1.0f / float(theParams.NbTilesY);
+    theMarginal[aRow] = anAccum;
+  }
+  theMarginal[theParams.NbTilesY - 1] = 1.0f;
+}
+
+// Radical inverse in base 2 (bit reversal).
+static float halton2(uint theIndex)
+{
+  return float(reverse_bits(theIndex) >> 9) * (1.0f / 8388608.0f);
+}
+
+// Radical inverse in base 3.
+static float halton3(uint theIndex)
+{
+  float aResult = 0.0f;
+  float aScale  = 1.0f / 3.0f;
+  for (; theIndex != 0; theIndex /= 3u, aScale /= 3.0f)
+  {
+    aResult += float(theIndex % 3u) * aScale;
+  }
+  return min(aResult, 0.99999994f);
+}
+
+// Return first index in sorted CDF range [theFirst, theFirst + theCount) with value >= theValue.
+static uint searchCdf(const device float* theCdf, uint theFirst, uint theCount, float theValue)
+{
+  uint aLower = 0;
+  uint anUpper = theCount - 1;
+  while (aLower < anUpper)
+  {
+    const uint aMid = (aLower + anUpper) / 2;
+    if (theCdf[theFirst + aMid] < theValue)
+    {
+      aLower = aMid + 1;
+    }
+    else
+    {
+      anUpper = aMid;
+    }
+  }
+  return aLower;
+}
+
+kernel void tile_sample(constant TileUniforms& theParams   [[buffer(0)]],
+                        const device float*    theCdf      [[buffer(1)]],
+                        const device float*    theMarginal [[buffer(2)]],
+                        device atomic_uint*    theCounts   [[buffer(3)]],
+                        texture2d<int, access::write> theOffsets [[texture(0)]],
+                        uint theId [[thread_position_in_grid]])
+{
+  if (theId >= theParams.NbOffsetsX * theParams.NbOffsetsY)
+  {
+    return;
+  }
+
+  const uint  aSample = theParams.FirstSample + theId;
+  const float aRand1  = halton2(aSample);
+  const float aRand2  = halton3(aSample);
+  const uint  aRow = searchCdf(theMarginal, 0, theParams.NbTilesY, aRand2);
+  const uint  aCol = searchCdf(theCdf, aRow * theParams.NbTilesX, theParams.NbTilesX, aRand1);
+
+  theOffsets.write(int4(int(aCol), int(aRow), 0, 0), uint2(theId % theParams.NbOffsetsX, theId / theParams.NbOffsetsX));
+  atomic_fetch_add_explicit(&theCounts[aRow * theParams.NbTilesX + aCol], 1u, memory_order_relaxed);
+}
+
+kernel void tile_write_samples(constant TileUniforms& theParams  [[buffer(0)]],
+                               device atomic_uint*    theCounts  [[buffer(3)]],
+                               texture2d<uint, access::write> theSamples [[texture(0)]],
+                               texture2d<int,  access::write> theOffsets [[texture(1)]],
+                               uint2 theId [[thread_position_in_grid]])
+{
+  if (theId.x >= theParams.NbTilesX || theId.y >= theParams.NbTilesY)
+  {
+    return;
+  }
+
+  if (theParams.IsAdaptive == 0)
+  {
+    theSamples.write(uint4(1u), theId);
+    theOffsets.write(int4(int(theId.x), int(theId.y), 0, 0), theId);
+    return;
+  }
+
+  const uint aCount = atomic_load_explicit(&theCounts[theId.y * theParams.NbTilesX + theId.x], memory_order_relaxed);
+  theSamples.write(uint4(aCount), theId);
+}
+)";
+}
 
 // =======================================================================
 // function : Metal_TileSampler
@@ -31,7 +201,10 @@ Metal_TileSampler::Metal_TileSampler()
 : myLastSample(0),
   myScaleFactor(1.0e6f),
   myTileSize(32),
-  myViewSize(0, 0)
+  myViewSize(0, 0),
+  myGpuCdfBuffer(nil),
+  myGpuMarginalBuffer(nil),
+  myGpuCountBuffer(nil)
 {
   //
 }
@@ -42,7 +215,7 @@ Metal_TileSampler::Metal_TileSampler()
 // =======================================================================
 Metal_TileSampler::~Metal_TileSampler()
 {
-  //
+  ReleaseGpuSampling(nullptr);
 }
 
 // =======================================================================
@@ -356,3 +529,164 @@ bool Metal_TileSampler::upload(Metal_Context* theCtx,
 
   return true;
 }
+
+// =======================================================================
+// function : InitGpuSampling
+// purpose  : Compile kernels for GPU-resident sampling
+// =======================================================================
+bool Metal_TileSampler::InitGpuSampling(Metal_Context* theCtx)
+{
+  if (HasGpuSampling())
+  {
+    return true;
+  }
+  if (theCtx == nullptr || theCtx->Device() == nil)
+  {
+    return false;
+  }
+
+  NSError* anError = nil;
+  id<MTLLibrary> aLibrary = theCtx->LoadShaderLibrary("Metal_TileSampler_THE_TILE_SAMPLER_SHADER",
+                                                      [NSString stringWithUTF8String:THE_TILE_SAMPLER_SHADER],
+                                                      nil, &anError);
+  if (aLibrary == nil)
+  {
+    theCtx->Messenger()->SendFail() << "Metal_TileSampler: failed to compile tile sampling kernels: "
+                                    << (anError != nil ? [[anError localizedDescription] UTF8String] : "");
+    return false;
+  }
+
+  myBuildCdfPipeline     = new Metal_ComputePipeline();
+  mySampleTilesPipeline  = new Metal_ComputePipeline();
+  myWriteSamplesPipeline = new Metal_ComputePipeline();
+  if (!myBuildCdfPipeline    ->Init(theCtx, aLibrary, @"tile_build_cdf")
+   || !mySampleTilesPipeline ->Init(theCtx, aLibrary, @"tile_sample")
+   || !myWriteSamplesPipeline->Init(theCtx, aLibrary, @"tile_write_samples"))
+  {
+    theCtx->Messenger()->SendFail() << "Metal_TileSampler: failed to create tile sampling pipelines";
+    ReleaseGpuSampling(theCtx);
+    return false;
+  }
+  return true;
+}
+
+// =======================================================================
+// function : ReleaseGpuSampling
+// purpose  : Release GPU-resident sampling resources
+// =======================================================================
+void Metal_TileSampler::ReleaseGpuSampling(Metal_Context* theCtx)
+{
+  for (occ::handle<Metal_ComputePipeline>* aPipeline : { &myBuildCdfPipeline, &mySampleTilesPipeline, &myWriteSamplesPipeline })
+  {
+    if (!aPipeline->IsNull())
+    {
+      (*aPipeline)->Release(theCtx);
+      aPipeline->Nullify();
+    }
+  }
+  myGpuCdfBuffer      = nil;
+  myGpuMarginalBuffer = nil;
+  myGpuCountBuffer    = nil;
+}
+
+// =======================================================================
+// function : EncodeSampling
+// purpose  : Encode variance reduction, tile sampling and maps generation
+// =======================================================================
+bool Metal_TileSampler::EncodeSampling(Metal_Context* theCtx,
+                                       id<MTLCommandBuffer> theCmdBuffer,
+                                       const occ::handle<Metal_Texture>& theVarianceTexture,
+                                       const occ::handle<Metal_Texture>& theSamplesTexture,
+                                       const occ::handle<Metal_Texture>& theOffsetsTexture,
+                                       bool theAdaptive)
+{
+  const int aNbTilesX = NbTilesX();
+  const int aNbTilesY = NbTilesY();
+  if (theCtx == nullptr || theCmdBuffer == nil || !HasGpuSampling()
+   || aNbTilesX == 0 || aNbTilesY == 0
+   || theSamplesTexture.IsNull() || !theSamplesTexture->IsValid()
+   || theOffsetsTexture.IsNull() || !theOffsetsTexture->IsValid())
+  {
+    return false;
+  }
+
+  id<MTLTexture> aSamples  = theSamplesTexture->Texture();
+  id<MTLTexture> anOffsets = theOffsetsTexture->Texture();
+  if ((aSamples.usage & MTLTextureUsageShaderWrite) == 0
+   || (anOffsets.usage & MTLTextureUsageShaderWrite) == 0)
+  {
+    theCtx->Messenger()->SendWarning() << "Metal_TileSampler: samples and offsets textures should be shader-writable for GPU sampling";
+    return false;
+  }
+
+  id<MTLTexture> aVariance = nil;
+  if (theAdaptive)
+  {
+    if (theVarianceTexture.IsNull() || !theVarianceTexture->IsValid())
+    {
+      return false;
+    }
+    aVariance = theVarianceTexture->Texture();
+    if (aVariance.width != NSUInteger(aNbTilesX) || aVariance.height != NSUInteger(aNbTilesY))
+    {
+      // Texture size doesn't match tile grid
+      return false;
+    }
+  }
+
+  const NSUInteger aNbTiles = NSUInteger(aNbTilesX) * NSUInteger(aNbTilesY);
+  if (myGpuCountBuffer == nil || myGpuCountBuffer.length < aNbTiles * sizeof(uint32_t))
+  {
+    id<MTLDevice> aDevice = theCtx->Device();
+    myGpuCdfBuffer      = [aDevice newBufferWithLength:aNbTiles * sizeof(float) options:MTLResourceStorageModePrivate];
+    myGpuMarginalBuffer = [aDevice newBufferWithLength:NSUInteger(aNbTilesY) * sizeof(float) options:MTLResourceStorageModePrivate];
+    myGpuCountBuffer    = [aDevice newBufferWithLength:aNbTiles * sizeof(uint32_t) options:MTLResourceStorageModePrivate];
+    if (myGpuCdfBuffer == nil || myGpuMarginalBuffer == nil || myGpuCountBuffer == nil)
+    {
+      myGpuCdfBuffer = myGpuMarginalBuffer = myGpuCountBuffer = nil;
+      return false;
+    }
+  }
+
+  const NCollection_Vec2<int> aNbOffsets = NbOffsetTiles(theAdaptive);
+  Metal_TileSamplerUniforms aUniforms;
+  memset(&aUniforms, 0, sizeof(aUniforms));
+  aUniforms.NbTilesX    = uint32_t(aNbTilesX);
+  aUniforms.NbTilesY    = uint32_t(aNbTilesY);
+  aUniforms.NbOffsetsX  = uint32_t(aNbOffsets.x());
+  aUniforms.NbOffsetsY  = uint32_t(aNbOffsets.y());
+  aUniforms.FirstSample = myLastSample;
+  aUniforms.IsAdaptive  = theAdaptive ? 1 : 0;
+
+  id<MTLComputeCommandEncoder> anEncoder = [theCmdBuffer computeCommandEncoder];
+  anEncoder.label = @"TileSampler";
+  [anEncoder setBytes:&aUniforms length:sizeof(aUniforms) atIndex:0];
+  [anEncoder setBuffer:myGpuCdfBuffer      offset:0 atIndex:1];
+  [anEncoder setBuffer:myGpuMarginalBuffer offset:0 atIndex:2];
+  [anEncoder setBuffer:myGpuCountBuffer    offset:0 atIndex:3];
+  if (theAdaptive)
+  {
+    const NSUInteger aCdfGroupSize = std::min(THE_CDF_GROUP_SIZE, NSUInteger(std::max(myBuildCdfPipeline->MaxThreadsPerThreadgroup(), 1)));
+    [anEncoder setComputePipelineState:myBuildCdfPipeline->PipelineState()];
+    [anEncoder setTexture:aVariance atIndex:0];
+    [anEncoder dispatchThreadgroups:MTLSizeMake(1, 1, 1)
+              threadsPerThreadgroup:MTLSizeMake(aCdfGroupSize, 1, 1)];
+
+    const NSUInteger aNbEntries = NSUInteger(aNbOffsets.x()) * NSUInteger(aNbOffsets.y());
+    const NSUInteger aGroupSize = NSUInteger(std::max(mySampleTilesPipeline->ThreadExecutionWidth(), 1));
+    [anEncoder setComputePipelineState:mySampleTilesPipeline->PipelineState()];
+    [anEncoder setTexture:anOffsets atIndex:0];
+    [anEncoder dispatchThreadgroups:MTLSizeMake((aNbEntries + aGroupSize - 1) / aGroupSize, 1, 1)
+              threadsPerThreadgroup:MTLSizeMake(aGroupSize, 1, 1)];
+    myLastSample += uint32_t(aNbEntries);
+  }
+
+  [anEncoder setComputePipelineState:myWriteSamplesPipeline->PipelineState()];
+  [anEncoder setTexture:aSamples  atIndex:0];
+  [anEncoder setTexture:anOffsets atIndex:1];
+  const MTLSize aGroupSize2D = myWriteSamplesPipeline->OptimalThreadgroupSize2D(aNbTilesX, aNbTilesY);
+  [anEncoder dispatchThreadgroups:myWriteSamplesPipeline->ThreadgroupCount2D(aNbTilesX, aNbTilesY, aGroupSize2D)
+            threadsPerThreadgroup:aGroupSize2D];
+  [anEncoder endEncoding];
+  return true;
+}
@@ -0,0 +1,125 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#ifndef Metal_TransformBuffer_HeaderFile
+#define Metal_TransformBuffer_HeaderFile
+
+#include <NCollection_Mat4.hxx>
+#include <Standard_Transient.hxx>
+#include <Standard_Type.hxx>
+
+#include <vector>
+
+#ifdef __OBJC__
+@protocol MTLBuffer;
+#endif
+
+class Metal_Context;
+
+//! Transformations of all structures in one GPU buffer.
+//! Each structure holds a slot within the buffer (see Metal_Structure::SetTransformBuffer()),
+//! which is overwritten on every transformation change, so that moving thousands of structures
+//! costs a matrix write per structure instead of invalidating derived data.
+//! The whole used range of slots is copied into the buffer of the frame slot by single memcpy
+//! within BeginFrame() called from Metal_Context::WaitForFrame(), when the frame which has used
+//! the slot previously has been completed by GPU; unmodified transformations are not copied again.
+//! Consumers (GPU culling of Metal_IndirectLayer) bind Buffer() and address matrices by structure slot.
+class Metal_TransformBuffer : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(Metal_TransformBuffer, Standard_Transient)
+public:
+
+  //! Initial number of slots.
+  static constexpr int InitialCapacity = 1024;
+
+public:
+
+  //! Empty constructor.
+  Standard_EXPORT Metal_TransformBuffer();
+
+  //! Destructor.
+  Standard_EXPORT ~Metal_TransformBuffer() override;
+
+  //! Initialize buffers of frame slots.
+  //! @param theCtx Metal context defining number of frames in flight
+  Standard_EXPORT bool Init(Metal_Context* theCtx);
+
+  //! Release GPU buffers (slots of structures are kept).
+  Standard_EXPORT void Release();
+
+  //! Return TRUE if GPU buffers have been initialized.
+  bool IsValid() const { return !myFrames.empty(); }
+
+  //! Allocate slot initialized by identity matrix.
+  Standard_EXPORT int AddSlot();
+
+  //! Release slot for reuse by another structure.
+  Standard_EXPORT void RemoveSlot(int theSlot);
+
+  //! Return number of slots in use (including released slots in the middle of the range).
+  int NbSlots() const { return static_cast<int>(myTrsfs.size()); }
+
+  //! Return the transformation of the slot.
+  const NCollection_Mat4<float>& Value(int theSlot) const { return myTrsfs[theSlot]; }
+
+  //! Write the transformation of the slot.
+  void SetValue(int theSlot, const NCollection_Mat4<float>& theTrsf)
+  {
+    myTrsfs[theSlot] = theTrsf;
+    ++myRevision;
+  }
+
+  //! Return revision incremented on every modification of transformations.
+  size_t Revision() const { return myRevision; }
+
+  //! Start new frame using specified slot (frame index modulo number of slots)
+  //! and copy modified transformations into its buffer.
+  Standard_EXPORT void BeginFrame(int theFrameIndex);
+
+  //! Return number of slots copied into the buffer of current frame;
+  //! slots allocated later are not yet available to GPU.
+  int NbUploaded() const { return !myFrames.empty() ? myFrames[myFrameIndex].NbSlots : 0; }
+
+#ifdef __OBJC__
+  //! Return buffer of current frame with float4x4 matrices addressed by structure slot.
+  Standard_EXPORT id<MTLBuffer> Buffer() const;
+#endif
+
+protected:
+
+  //! Frame slot.
+  struct Frame
+  {
+#ifdef __OBJC__
+    id<MTLBuffer> Buffer; //!< shared buffer of the frame slot
+#else
+    void*         Buffer;
+#endif
+    size_t Revision;      //!< revision of transformations copied into the buffer
+    int    NbSlots;       //!< number of slots copied into the buffer
+
+    Frame() : Buffer(nullptr), Revision(0), NbSlots(0) {}
+  };
+
+protected:
+
+  Metal_Context*                       myContext;    //!< context creating buffers
+  std::vector<NCollection_Mat4<float>> myTrsfs;      //!< transformations per slot
+  std::vector<int>                     myFreeSlots;  //!< released slots
+  std::vector<Frame>                   myFrames;     //!< buffers of frame slots
+  size_t                               myRevision;   //!< modification counter
+  int                                  myFrameIndex; //!< current frame slot
+};
+
+#endif // Metal_TransformBuffer_HeaderFile
@@ -0,0 +1,169 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+
+#import <Metal/Metal.h>
+
+#include <Metal_TransformBuffer.hxx>
+#include <Metal_Caps.hxx>
+#include <Metal_Context.hxx>
+
+#include <Message_Messenger.hxx>
+
+#include <algorithm>
+#include <cstring>
+
+IMPLEMENT_STANDARD_RTTIEXT(Metal_TransformBuffer, Standard_Transient)
+
+// =======================================================================
+// function : Metal_TransformBuffer
+// purpose  : Constructor
+// =======================================================================
+Metal_TransformBuffer::Metal_TransformBuffer()
+: myContext(nullptr),
+  myRevision(1),
+  myFrameIndex(0)
+{
+  myTrsfs.reserve(InitialCapacity);
+}
+
+// =======================================================================
+// function : ~Metal_TransformBuffer
+// purpose  : Destructor
+// =======================================================================
+Metal_TransformBuffer::~Metal_TransformBuffer()
+{
+  Release();
+}
+
+// =======================================================================
+// function : Init
+// purpose  : Initialize buffers of frame slots
+// =======================================================================
+bool Metal_TransformBuffer::Init(Metal_Context* theCtx)
+{
+  Release();
+  if (theCtx == nullptr || !theCtx->IsValid())
+  {
+    return false;
+  }
+
+  // buffers are allocated on first frame
+  myContext = theCtx;
+  myFrames.resize(std::max(theCtx->Caps()->maxFramesInFlight, 1));
+  return true;
+}
+
+// =======================================================================
+// function : Release
+// purpose  : Release GPU buffers
+// =======================================================================
+void Metal_TransformBuffer::Release()
+{
+  // command buffers retain buffers referenced by them
+  myFrames.clear();
+  myContext = nullptr;
+  myFrameIndex = 0;
+}
+
+// =======================================================================
+// function : AddSlot
+// purpose  : Allocate slot
+// =======================================================================
+int Metal_TransformBuffer::AddSlot()
+{
+  int aSlot = 0;
+  if (!myFreeSlots.empty())
+  {
+    aSlot = myFreeSlots.back();
+    myFreeSlots.pop_back();
+    myTrsfs[aSlot].InitIdentity();
+  }
+  else
+  {
+    aSlot = static_cast<int>(myTrsfs.size());
+    myTrsfs.emplace_back(); // identity
+  }
+  ++myRevision;
+  return aSlot;
+}
+
+// =======================================================================
+// function : RemoveSlot
+// purpose  : Release slot for reuse
+// =======================================================================
+void Metal_TransformBuffer::RemoveSlot(int theSlot)
+{
+  if (theSlot < 0 || theSlot >= NbSlots())
+  {
+    return;
+  }
+
+  if (theSlot == NbSlots() - 1)
+  {
+    myTrsfs.pop_back();
+  }
+  else
+  {
+    myFreeSlots.push_back(theSlot);
+  }
+}
+
+// =======================================================================
+// function : BeginFrame
+// purpose  : Copy modified transformations into buffer of the frame slot
+// =======================================================================
+void Metal_TransformBuffer::BeginFrame(int theFrameIndex)
+{
+  if (myFrames.empty())
+  {
+    return;
+  }
+
+  myFrameIndex = theFrameIndex % int(myFrames.size());
+  Frame& aFrame = myFrames[myFrameIndex];
+  if (aFrame.Revision == myRevision || myTrsfs.empty())
+  {
+    return;
+  }
+
+  // the frame previously used this slot is completed - the buffer can be overwritten or replaced
+  const size_t aSize = myTrsfs.size() * sizeof(NCollection_Mat4<float>);
+  if (aFrame.Buffer == nil || aFrame.Buffer.length < aSize)
+  {
+    size_t aCapacity = size_t(InitialCapacity) * sizeof(NCollection_Mat4<float>);
+    for (; aCapacity < aSize; aCapacity *= 2) {}
+    aFrame.Buffer = [myContext->Device() newBufferWithLength:aCapacity
+                                                     options:MTLResourceStorageModeShared];
+    if (aFrame.Buffer == nil)
+    {
+      myContext->Messenger()->SendWarning() << "Metal_TransformBuffer: unable to allocate "
+                                            << int(aCapacity / 1024) << " KiB buffer";
+      return;
+    }
+    aFrame.Buffer.label = @"Metal_TransformBuffer";
+  }
+
+  memcpy([aFrame.Buffer contents], myTrsfs.data(), aSize);
+  aFrame.Revision = myRevision;
+  aFrame.NbSlots = NbSlots();
+}
+
+// =======================================================================
+// function : Buffer
+// purpose  : Return buffer of current frame
+// =======================================================================
+id<MTLBuffer> Metal_TransformBuffer::Buffer() const
+{
+  return !myFrames.empty() ? myFrames[myFrameIndex].Buffer : nil;
+}
@@ -14,6 +14,7 @@
 #ifndef Metal_UniformBuffer_HeaderFile
 #define Metal_UniformBuffer_HeaderFile
 
+#include <Metal_BufferAllocator.hxx>
 #include <Metal_Resource.hxx>
 #include <Metal_Caps.hxx>
 
@@ -25,7 +26,8 @@ class Metal_Context;
 
 //! Uniform Buffer Object for shader uniform data with triple-buffering support.
 //! Each frame uses a separate portion of the buffer to avoid GPU/CPU synchronization issues.
-//! The buffer is organized as N copies of uniform data, where N = maxFramesInFlight.
+//! The buffer is organized as N copies of uniform data, where N = maxFramesInFlight,
+//! placed into a range sub-allocated from Metal_BufferAllocator.
 class Metal_UniformBuffer : public Metal_Resource
 {
   DEFINE_STANDARD_RTTIEXT(Metal_UniformBuffer, Metal_Resource)
@@ -39,7 +41,7 @@ public:
   Standard_EXPORT ~Metal_UniformBuffer() override;
 
   //! @return true if current object was initialized
-  bool IsValid() const { return myBuffer != nullptr; }
+  bool IsValid() const { return !myAllocation.IsNull() && myAllocation->IsValid(); }
 
   //! Return size of single uniform block in bytes.
   size_t BlockSize() const { return myBlockSize; }
@@ -83,24 +85,20 @@ public:
 
   //! Get offset for current frame's uniform block.
   //! @param theCtx Metal context
-  //! @return offset in bytes from buffer start
+  //! @return offset in bytes from Buffer() start
   Standard_EXPORT size_t CurrentOffset(Metal_Context* theCtx) const;
 
   //! Release GPU resources.
   Standard_EXPORT void Release(Metal_Context* theCtx) override;
 
 #ifdef __OBJC__
-  //! Return native Metal buffer object.
-  id<MTLBuffer> Buffer() const { return myBuffer; }
+  //! Return native Metal buffer object (shared with other allocations).
+  id<MTLBuffer> Buffer() const { return !myAllocation.IsNull() ? myAllocation->Buffer() : nullptr; }
 #endif
 
 protected:
 
-#ifdef __OBJC__
-  id<MTLBuffer> myBuffer;        //!< Metal buffer object
-#else
-  void*         myBuffer;        //!< Metal buffer object (opaque)
-#endif
+  occ::handle<Metal_BufferAllocation> myAllocation; //!< memory range within allocator block
   size_t myBlockSize;            //!< size of single uniform block
   size_t myAlignedBlockSize;     //!< aligned block size (256-byte aligned for Metal)
   size_t myTotalSize;            //!< total buffer size
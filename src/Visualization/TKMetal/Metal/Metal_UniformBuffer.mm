@@ -27,8 +27,7 @@ static const size_t METAL_BUFFER_OFFSET_ALIGNMENT = 256;
 // purpose  : Constructor
 // =======================================================================
 Metal_UniformBuffer::Metal_UniformBuffer()
-: myBuffer(nil),
-  myBlockSize(0),
+: myBlockSize(0),
   myAlignedBlockSize(0),
   myTotalSize(0),
   myFramesInFlight(Metal_MaxFramesInFlight)
@@ -42,7 +41,7 @@ Metal_UniformBuffer::Metal_UniformBuffer()
 // =======================================================================
 Metal_UniformBuffer::~Metal_UniformBuffer()
 {
-  Standard_ASSERT_RAISE(myBuffer == nil,
+  Standard_ASSERT_RAISE(myAllocation.IsNull(),
     "Metal_UniformBuffer destroyed without explicit Release()");
 }
 
@@ -54,7 +53,8 @@ bool Metal_UniformBuffer::Create(Metal_Context* theCtx, size_t theBlockSize)
 {
   Release(theCtx);
 
-  if (theCtx == nullptr || !theCtx->IsValid() || theBlockSize == 0)
+  if (theCtx == nullptr || !theCtx->IsValid() || theBlockSize == 0
+   || theCtx->BufferAllocator().IsNull())
   {
     return false;
   }
@@ -70,12 +70,10 @@ bool Metal_UniformBuffer::Create(Metal_Context* theCtx, size_t theBlockSize)
   // Total size for all frame copies
   myTotalSize = myAlignedBlockSize * size_t(myFramesInFlight);
 
-  // Create buffer with shared storage mode for CPU updates
-  id<MTLDevice> aDevice = theCtx->Device();
-  myBuffer = [aDevice newBufferWithLength:myTotalSize
-                                  options:MTLResourceStorageModeShared];
-
-  return myBuffer != nil;
+  // Allocate range with shared storage mode for CPU updates
+  myAllocation = theCtx->BufferAllocator()->Allocate(myTotalSize, Metal_StorageMode_Shared,
+                                                     METAL_BUFFER_OFFSET_ALIGNMENT);
+  return !myAllocation.IsNull();
 }
 
 // =======================================================================
@@ -86,7 +84,7 @@ bool Metal_UniformBuffer::Update(Metal_Context* theCtx,
                                  const void* theData,
                                  size_t theSize)
 {
-  if (myBuffer == nil || theCtx == nullptr || theData == nullptr)
+  if (!IsValid() || theCtx == nullptr || theData == nullptr)
   {
     return false;
   }
@@ -96,12 +94,9 @@ bool Metal_UniformBuffer::Update(Metal_Context* theCtx,
     return false;
   }
 
-  // Get offset for current frame
-  size_t anOffset = CurrentOffset(theCtx);
-
-  // Copy data to buffer
-  void* aContents = [myBuffer contents];
-  memcpy(static_cast<uint8_t*>(aContents) + anOffset, theData, theSize);
+  // Copy data to current frame's block
+  const size_t anOffset = size_t(theCtx->CurrentFrameIndex()) * myAlignedBlockSize;
+  memcpy(myAllocation->Contents() + anOffset, theData, theSize);
 
   return true;
 }
@@ -112,13 +107,13 @@ bool Metal_UniformBuffer::Update(Metal_Context* theCtx,
 // =======================================================================
 size_t Metal_UniformBuffer::CurrentOffset(Metal_Context* theCtx) const
 {
-  if (theCtx == nullptr)
+  if (theCtx == nullptr || myAllocation.IsNull())
   {
     return 0;
   }
 
   int aFrameIndex = theCtx->CurrentFrameIndex();
-  return size_t(aFrameIndex) * myAlignedBlockSize;
+  return myAllocation->Offset() + size_t(aFrameIndex) * myAlignedBlockSize;
 }
 
 // =======================================================================
@@ -127,11 +122,13 @@ size_t Metal_UniformBuffer::CurrentOffset(Metal_Context* theCtx) const
 // =======================================================================
 void Metal_UniformBuffer::Release(Metal_Context* theCtx)
 {
-  (void)theCtx;
-
-  if (myBuffer != nil)
+  if (!myAllocation.IsNull())
   {
-    myBuffer = nil;
+    if (theCtx != nullptr && !theCtx->BufferAllocator().IsNull())
+    {
+      theCtx->BufferAllocator()->Free(myAllocation);
+    }
+    myAllocation.Nullify();
   }
 
   myBlockSize = 0;
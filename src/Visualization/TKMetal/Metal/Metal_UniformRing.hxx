@@ -0,0 +1,138 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef Metal_UniformRing_HeaderFile
+#define Metal_UniformRing_HeaderFile
+
+#include <NCollection_DataMap.hxx>
+#include <Standard_Transient.hxx>
+#include <Standard_Type.hxx>
+
+#include <mutex>
+#include <vector>
+
+#ifdef __OBJC__
+@protocol MTLBuffer;
+@class NSMutableArray;
+#endif
+
+class Metal_Context;
+
+//! Per-frame linear allocator of uniform blocks.
+//! The ring holds one shared MTLBuffer per frame in flight; blocks of the frame are copied
+//! into the buffer of the frame slot at aligned offsets, so that draws bind the buffer with
+//! an offset instead of copying uniform data into command stream by setVertexBytes()/setFragmentBytes().
+//! The slot is reset by BeginFrame() called from Metal_Context::WaitForFrame(),
+//! when the frame which has used the slot previously has been completed by GPU.
+//! Blocks allocated by AllocateShared() are written only once per frame for identical data (lights, clipping planes).
+//! When the slot is exhausted, allocation fails and the caller should fall back to copying data into command stream;
+//! the buffer of such slot is enlarged when the slot is reused.
+//! Allocation is thread-safe (workspaces of parallel encoding).
+class Metal_UniformRing : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(Metal_UniformRing, Standard_Transient)
+public:
+
+  //! Default size of the frame slot (4 MiB).
+  static constexpr size_t DefaultFrameSize = 4 * 1024 * 1024;
+
+  //! Maximum size of the frame slot (64 MiB).
+  static constexpr size_t MaxFrameSize = 64 * 1024 * 1024;
+
+  //! Alignment of block offsets (constant buffer offset alignment on macOS).
+  static constexpr size_t Alignment = 256;
+
+public:
+
+  //! Empty constructor.
+  Standard_EXPORT Metal_UniformRing();
+
+  //! Destructor.
+  Standard_EXPORT ~Metal_UniformRing() override;
+
+  //! Allocate buffers of frame slots.
+  //! @param theCtx       Metal context defining number of frames in flight
+  //! @param theFrameSize initial size of the frame slot
+  Standard_EXPORT bool Init(Metal_Context* theCtx, size_t theFrameSize = DefaultFrameSize);
+
+  //! Release buffers.
+  Standard_EXPORT void Release();
+
+  //! Return TRUE if ring has been initialized.
+  bool IsValid() const { return !mySlots.empty(); }
+
+  //! Start new frame using specified slot (frame index modulo number of slots).
+  //! Should be called only when GPU has completed the frame which used the slot previously.
+  Standard_EXPORT void BeginFrame(int theFrameIndex);
+
+  //! Return number of bytes allocated within current frame.
+  size_t UsedBytes() const { return myOffset; }
+
+  //! Return size of current frame slot.
+  size_t FrameSize() const { return !mySlots.empty() ? mySlots[mySlotIndex].Size : 0; }
+
+#ifdef __OBJC__
+  //! Copy the block into current frame slot.
+  //! @param[in]  theData   block data
+  //! @param[in]  theSize   block size
+  //! @param[out] theBuffer buffer to bind
+  //! @param[out] theOffset offset of the block within the buffer
+  //! @return FALSE if frame slot is exhausted
+  Standard_EXPORT bool Allocate(const void* theData,
+                                size_t theSize,
+                                __strong id<MTLBuffer>& theBuffer,
+                                size_t& theOffset);
+
+  //! Copy the block into current frame slot, or return the block with identical data allocated within the same frame.
+  //! @param[in]  theData   block data
+  //! @param[in]  theSize   block size
+  //! @param[out] theBuffer buffer to bind
+  //! @param[out] theOffset offset of the block within the buffer
+  //! @return FALSE if frame slot is exhausted
+  Standard_EXPORT bool AllocateShared(const void* theData,
+                                      size_t theSize,
+                                      __strong id<MTLBuffer>& theBuffer,
+                                      size_t& theOffset);
+#endif
+
+protected:
+
+  //! Frame slot.
+  struct Slot
+  {
+#ifdef __OBJC__
+    id<MTLBuffer> Buffer; //!< shared buffer of the slot
+#else
+    void*         Buffer;
+#endif
+    size_t Size;          //!< buffer size
+    bool   IsExhausted;   //!< allocation has failed within last use of the slot
+
+    Slot() : Buffer(nullptr), Size(0), IsExhausted(false) {}
+  };
+
+  //! Reserve aligned block within current slot (should be called under lock).
+  //! @return offset of the block or -1 if slot is exhausted
+  Standard_EXPORT long long reserve(size_t theSize);
+
+protected:
+
+  Metal_Context*                     myContext;      //!< context creating buffers
+  std::vector<Slot>                  mySlots;        //!< frame slots
+  NCollection_DataMap<size_t, size_t> mySharedBlocks; //!< hash of shared block data -> offset within current frame
+  size_t                             myOffset;       //!< allocated bytes within current frame slot
+  int                                mySlotIndex;    //!< current frame slot
+  std::mutex                         myMutex;        //!< lock for thread-safety
+};
+
+#endif // Metal_UniformRing_HeaderFile
@@ -0,0 +1,243 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#import <Metal/Metal.h>
+
+#include <Metal_UniformRing.hxx>
+#include <Metal_Caps.hxx>
+#include <Metal_Context.hxx>
+
+#include <Message_Messenger.hxx>
+
+#include <algorithm>
+#include <cstring>
+
+IMPLEMENT_STANDARD_RTTIEXT(Metal_UniformRing, Standard_Transient)
+
+namespace
+{
+  //! Round value up to the power-of-two alignment.
+  static size_t alignUp(size_t theValue, size_t theAlignment)
+  {
+    return (theValue + theAlignment - 1) & ~(theAlignment - 1);
+  }
+
+  //! Compute FNV-1a hash of the block data.
+  static size_t hashBlock(const void* theData, size_t theSize)
+  {
+    const unsigned char* aBytes = static_cast<const unsigned char*>(theData);
+    uint64_t aHash = 14695981039346656037ULL;
+    for (size_t aByteIter = 0; aByteIter < theSize; ++aByteIter)
+    {
+      aHash = (aHash ^ aBytes[aByteIter]) * 1099511628211ULL;
+    }
+    return static_cast<size_t>(aHash);
+  }
+}
+
+// =======================================================================
+// function : Metal_UniformRing
+// purpose  : Constructor
+// =======================================================================
+Metal_UniformRing::Metal_UniformRing()
+: myContext(nullptr),
+  myOffset(0),
+  mySlotIndex(0)
+{
+  //
+}
+
+// =======================================================================
+// function : ~Metal_UniformRing
+// purpose  : Destructor
+// =======================================================================
+Metal_UniformRing::~Metal_UniformRing()
+{
+  Release();
+}
+
+// =======================================================================
+// function : Init
+// purpose  : Allocate buffers of frame slots
+// =======================================================================
+bool Metal_UniformRing::Init(Metal_Context* theCtx, size_t theFrameSize)
+{
+  Release();
+  if (theCtx == nullptr || !theCtx->IsValid() || theFrameSize == 0)
+  {
+    return false;
+  }
+
+  std::lock_guard<std::mutex> aLock(myMutex);
+  myContext = theCtx;
+  const int aNbSlots = std::max(theCtx->Caps()->maxFramesInFlight, 1);
+  mySlots.resize(aNbSlots);
+  for (Slot& aSlot : mySlots)
+  {
+    aSlot.Size = alignUp(theFrameSize, Alignment);
+    aSlot.Buffer = [theCtx->Device() newBufferWithLength:aSlot.Size
+                                                 options:MTLResourceStorageModeShared];
+    if (aSlot.Buffer == nil)
+    {
+      mySlots.clear();
+      myContext = nullptr;
+      return false;
+    }
+    aSlot.Buffer.label = @"Metal_UniformRing";
+  }
+  return true;
+}
+
+// =======================================================================
+// function : Release
+// purpose  : Release buffers
+// =======================================================================
+void Metal_UniformRing::Release()
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  // command buffers retain buffers referenced by them
+  mySlots.clear();
+  mySharedBlocks.Clear();
+  myContext = nullptr;
+  myOffset = 0;
+  mySlotIndex = 0;
+}
+
+// =======================================================================
+// function : BeginFrame
+// purpose  : Start new frame using specified slot
+// =======================================================================
+void Metal_UniformRing::BeginFrame(int theFrameIndex)
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  if (mySlots.empty())
+  {
+    return;
+  }
+
+  mySlotIndex = theFrameIndex % int(mySlots.size());
+  myOffset = 0;
+  mySharedBlocks.Clear();
+
+  // the frame previously used this slot is completed - the buffer can be replaced by a larger one
+  Slot& aSlot = mySlots[mySlotIndex];
+  if (aSlot.IsExhausted && aSlot.Size < MaxFrameSize)
+  {
+    const size_t aNewSize = std::min(aSlot.Size * 2, MaxFrameSize);
+    id<MTLBuffer> aBuffer = [myContext->Device() newBufferWithLength:aNewSize
+                                                             options:MTLResourceStorageModeShared];
+    if (aBuffer != nil)
+    {
+      aBuffer.label = @"Metal_UniformRing";
+      aSlot.Buffer = aBuffer;
+      aSlot.Size = aNewSize;
+    }
+    else
+    {
+      myContext->Messenger()->SendWarning() << "Metal_UniformRing: unable to allocate "
+                                            << int(aNewSize / 1024) << " KiB buffer";
+    }
+  }
+  aSlot.IsExhausted = false;
+}
+
+// =======================================================================
+// function : reserve
+// purpose  : Reserve aligned block within current slot
+// =======================================================================
+long long Metal_UniformRing::reserve(size_t theSize)
+{
+  if (mySlots.empty())
+  {
+    return -1;
+  }
+
+  Slot& aSlot = mySlots[mySlotIndex];
+  const size_t aSize = alignUp(theSize, Alignment);
+  if (myOffset + aSize > aSlot.Size)
+  {
+    aSlot.IsExhausted = true;
+    return -1;
+  }
+
+  const size_t anOffset = myOffset;
+  myOffset += aSize;
+  return static_cast<long long>(anOffset);
+}
+
+// =======================================================================
+// function : Allocate
+// purpose  : Copy the block into current frame slot
+// =======================================================================
+bool Metal_UniformRing::Allocate(const void* theData,
+                                 size_t theSize,
+                                 __strong id<MTLBuffer>& theBuffer,
+                                 size_t& theOffset)
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  const long long anOffset = reserve(theSize);
+  if (anOffset < 0)
+  {
+    return false;
+  }
+
+  theBuffer = mySlots[mySlotIndex].Buffer;
+  theOffset = static_cast<size_t>(anOffset);
+  memcpy(static_cast<char*>([theBuffer contents]) + theOffset, theData, theSize);
+  return true;
+}
+
+// =======================================================================
+// function : AllocateShared
+// purpose  : Copy the block or return identical one
+// =======================================================================
+bool Metal_UniformRing::AllocateShared(const void* theData,
+                                       size_t theSize,
+                                       __strong id<MTLBuffer>& theBuffer,
+                                       size_t& theOffset)
+{
+  const size_t aHash = hashBlock(theData, theSize);
+
+  std::lock_guard<std::mutex> aLock(myMutex);
+  if (mySlots.empty())
+  {
+    return false;
+  }
+
+  id<MTLBuffer> aBuffer = mySlots[mySlotIndex].Buffer;
+  char* aContents = static_cast<char*>([aBuffer contents]);
+  const size_t* aSharedOffset = mySharedBlocks.Seek(aHash);
+  if (aSharedOffset != nullptr
+   && *aSharedOffset + theSize <= myOffset
+   && memcmp(aContents + *aSharedOffset, theData, theSize) == 0)
+  {
+    theBuffer = aBuffer;
+    theOffset = *aSharedOffset;
+    return true;
+  }
+
+  const long long anOffset = reserve(theSize);
+  if (anOffset < 0)
+  {
+    return false;
+  }
+
+  theBuffer = aBuffer;
+  theOffset = static_cast<size_t>(anOffset);
+  memcpy(aContents + theOffset, theData, theSize);
+  if (aSharedOffset == nullptr)
+  {
+    mySharedBlocks.Bind(aHash, theOffset);
+  }
+  return true;
+}
@@ -0,0 +1,174 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+#ifndef Metal_Upscaler_HeaderFile
+#define Metal_Upscaler_HeaderFile
+
+#include <Metal_HaltonSampler.hxx>
+#include <Graphic3d_UpscalingMethod.hxx>
+#include <NCollection_Mat4.hxx>
+#include <NCollection_Vec2.hxx>
+#include <Standard_Transient.hxx>
+#include <Standard_Handle.hxx>
+
+#ifdef __OBJC__
+#import <Metal/Metal.h>
+#endif
+
+class Metal_Context;
+
+//! Upscaler of the main pass rendered at reduced resolution (Graphic3d_RenderingParams::RenderResolutionScale).
+//!
+//! The main pass is rendered into ColorTexture() and DepthTexture() of input size,
+//! which are then upscaled by MetalFX spatial or temporal scaler (or by plain bilinear filtering
+//! when MetalFX is unavailable) into the view target of output size.
+//! Depth of the main pass is upsampled into the view depth buffer within the same pass,
+//! so that immediate layers drawn afterwards are still occluded by the main layers.
+//!
+//! Temporal method expects the main pass to be rendered with JitteredProjection()
+//! and reconstructs motion vectors of camera movement from the depth buffer;
+//! motion of individual objects is not tracked, so that animated objects rely on history rejection of the scaler.
+class Metal_Upscaler : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(Metal_Upscaler, Standard_Transient)
+public:
+
+  //! Number of jitter phases of temporal method (Halton sequence length).
+  static const int NbJitterPhases = 32;
+
+  //! Create uninitialized upscaler.
+  Standard_EXPORT Metal_Upscaler();
+
+  //! Destructor.
+  Standard_EXPORT ~Metal_Upscaler();
+
+  //! Release resources.
+  Standard_EXPORT void Release();
+
+  //! Return TRUE if upscaler has been initialized.
+  bool IsValid() const { return myInputSize.x() > 0; }
+
+  //! Return requested upscaling method.
+  Graphic3d_UpscalingMethod Method() const { return myMethod; }
+
+  //! Return upscaling method actually used (falls back to bilinear without MetalFX).
+  Graphic3d_UpscalingMethod ActiveMethod() const { return myActiveMethod; }
+
+  //! Return input (rendering) size.
+  const NCollection_Vec2<int>& InputSize() const { return myInputSize; }
+
+  //! Return output (view) size.
+  const NCollection_Vec2<int>& OutputSize() const { return myOutputSize; }
+
+  //! Return sub-pixel jitter offset of the current frame in input pixels within [-0.5, 0.5] (zero for non-temporal methods).
+  const NCollection_Vec2<float>& Jitter() const { return myJitter; }
+
+  //! Return projection matrix with applied jitter of the current frame.
+  Standard_EXPORT NCollection_Mat4<float> JitteredProjection(const NCollection_Mat4<float>& theProj) const;
+
+  //! Discard accumulated history of temporal method (e.g. on camera cut).
+  void ResetHistory() { myToResetHistory = true; }
+
+#ifdef __OBJC__
+  //! Initialize (or re-initialize on change) resources.
+  //! @param theCtx        Metal context
+  //! @param theMethod     upscaling method
+  //! @param theInputSize  rendering resolution
+  //! @param theOutputSize view resolution
+  //! @param theFormat     color format of view target (also used for rendering the main pass)
+  //! @return FALSE on failure
+  Standard_EXPORT bool Init(Metal_Context* theCtx,
+                            Graphic3d_UpscalingMethod theMethod,
+                            const NCollection_Vec2<int>& theInputSize,
+                            const NCollection_Vec2<int>& theOutputSize,
+                            MTLPixelFormat theFormat);
+
+  //! Advance jitter to the next frame; should be called before rendering the main pass.
+  Standard_EXPORT void NextFrame();
+
+  //! Return color texture of input size to render the main pass into.
+  id<MTLTexture> ColorTexture() const { return myColorTexture; }
+
+  //! Return depth texture of input size to render the main pass into.
+  id<MTLTexture> DepthTexture() const { return myDepthTexture; }
+
+  //! Encode upscaling of the main pass into view target.
+  //! @param theCtx         Metal context
+  //! @param theCmdBuffer   command buffer (after the main pass)
+  //! @param theTarget      view color target of output size
+  //! @param theTargetDepth view depth buffer of output size receiving upsampled depth (might be nil)
+  //! @param theToStoreDepth store upsampled depth (FALSE for memoryless depth buffer)
+  //! @param theViewProj    unjittered view-projection matrix of the frame
+  //! @return FALSE on failure
+  Standard_EXPORT bool Encode(Metal_Context* theCtx,
+                              id<MTLCommandBuffer> theCmdBuffer,
+                              id<MTLTexture> theTarget,
+                              id<MTLTexture> theTargetDepth,
+                              bool theToStoreDepth,
+                              const NCollection_Mat4<float>& theViewProj);
+#endif
+
+private:
+
+#ifdef __OBJC__
+  //! Create MetalFX scaler for active method.
+  bool initScaler(Metal_Context* theCtx, MTLPixelFormat theFormat);
+
+  //! Create full-screen pipelines.
+  bool initPipelines(Metal_Context* theCtx, MTLPixelFormat theFormat);
+
+  //! Create texture of input or output size.
+  id<MTLTexture> createTexture(Metal_Context* theCtx,
+                               const NCollection_Vec2<int>& theSize,
+                               MTLPixelFormat theFormat,
+                               MTLTextureUsage theUsage,
+                               NSString* theLabel) const;
+#endif
+
+private:
+
+  Metal_HaltonSampler       mySampler;        //!< jitter sequence generator
+  Graphic3d_UpscalingMethod myMethod;         //!< requested method
+  Graphic3d_UpscalingMethod myActiveMethod;   //!< method in use
+  NCollection_Vec2<int>     myInputSize;      //!< rendering resolution
+  NCollection_Vec2<int>     myOutputSize;     //!< view resolution
+  NCollection_Vec2<float>   myJitter;         //!< jitter of the current frame in input pixels
+  NCollection_Mat4<float>   myPrevViewProj;   //!< unjittered view-projection matrix of the previous frame
+  unsigned int              myFrameIndex;     //!< frame index within jitter sequence
+  int                       myFormat;         //!< color format (MTLPixelFormat)
+  bool                      myToResetHistory; //!< discard history at the next frame
+#ifdef __OBJC__
+  id<MTLTexture>              myColorTexture;   //!< main pass color of input size
+  id<MTLTexture>              myDepthTexture;   //!< main pass depth of input size
+  id<MTLTexture>              myMotionTexture;  //!< camera motion vectors of input size (temporal method)
+  id<MTLTexture>              myOutputTexture;  //!< scaler output of output size
+  id                          myScaler;         //!< MetalFX spatial or temporal scaler
+  id<MTLRenderPipelineState>  myMotionPipeline; //!< motion vectors reconstruction
+  id<MTLRenderPipelineState>  myResolvePipeline; //!< color copy with depth upsampling into view target
+  id<MTLRenderPipelineState>  myResolveColorPipeline; //!< color copy without depth attachment
+  id<MTLDepthStencilState>    myResolveDepthState; //!< depth write without test
+  id<MTLSamplerState>         myLinearSampler;  //!< bilinear sampler
+#else
+  void*                       myColorTexture;
+  void*                       myDepthTexture;
+  void*                       myMotionTexture;
+  void*                       myOutputTexture;
+  void*                       myScaler;
+  void*                       myMotionPipeline;
+  void*                       myResolvePipeline;
+  void*                       myResolveColorPipeline;
+  void*                       myResolveDepthState;
+  void*                       myLinearSampler;
+#endif
+};
+
+#endif // Metal_Upscaler_HeaderFile
@@ -0,0 +1,521 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+#import <Metal/Metal.h>
+#import <MetalFX/MetalFX.h>
+
+#include <Metal_Upscaler.hxx>
+#include <Metal_Context.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(Metal_Upscaler, Standard_Transient)
+
+namespace
+{
+  //! Full-screen passes of upscaler.
+  static const char* THE_UPSCALER_SHADER = R"(
+#include <metal_stdlib>
+using namespace metal;
+
+struct UpscaleVertexOut
+{
+  float4 Position [[position]];
+  float2 TexCoord;
+};
+
+//! Full-screen triangle.
+vertex UpscaleVertexOut upscaleVertex(uint theVertexId [[vertex_id]])
+{
+  const float2 aUV = float2((theVertexId << 1) & 2, theVertexId & 2);
+  UpscaleVertexOut anOut;
+  anOut.Position = float4(aUV * float2(2.0, -2.0) + float2(-1.0, 1.0), 0.0, 1.0);
+  anOut.TexCoord = aUV;
+  return anOut;
+}
+
+struct UpscaleResolveOut
+{
+  float4 Color [[color(0)]];
+  float  Depth [[depth(any)]];
+};
+
+//! Copy upscaled color into view target and upsample depth of the main pass (nearest sample).
+fragment UpscaleResolveOut upscaleResolve(UpscaleVertexOut theIn [[stage_in]],
+                                          texture2d<float> theColor [[texture(0)]],
+                                          depth2d<float>   theDepth [[texture(1)]],
+                                          sampler theSampler [[sampler(0)]])
+{
+  constexpr sampler aNearest(filter::nearest, address::clamp_to_edge);
+  UpscaleResolveOut anOut;
+  anOut.Color = theColor.sample(theSampler, theIn.TexCoord);
+  anOut.Depth = theDepth.sample(aNearest, theIn.TexCoord);
+  return anOut;
+}
+
+//! Copy upscaled color into view target.
+fragment float4 upscaleResolveColor(UpscaleVertexOut theIn [[stage_in]],
+                                    texture2d<float> theColor [[texture(0)]],
+                                    sampler theSampler [[sampler(0)]])
+{
+  return theColor.sample(theSampler, theIn.TexCoord);
+}
+
+//! Reconstruct motion vectors of camera movement from depth (offset to previous position in texture coordinates).
+fragment float2 upscaleMotion(UpscaleVertexOut theIn [[stage_in]],
+                              depth2d<float> theDepth [[texture(0)]],
+                              constant float4x4& theReprojection [[buffer(0)]])
+{
+  const float  aDepth = theDepth.read(uint2(theIn.Position.xy));
+  const float2 aNdc   = float2(theIn.TexCoord.x * 2.0 - 1.0, 1.0 - theIn.TexCoord.y * 2.0);
+  const float4 aPrev  = theReprojection * float4(aNdc, aDepth, 1.0);
+  const float2 aPrevNdc = aPrev.xy / aPrev.w;
+  return float2(aPrevNdc.x * 0.5 + 0.5, 0.5 - aPrevNdc.y * 0.5) - theIn.TexCoord;
+}
+)";
+
+  //! Format of reconstructed motion vectors.
+  static const MTLPixelFormat THE_MOTION_FORMAT = MTLPixelFormatRG16Float;
+}
+
+// =======================================================================
+// function : Metal_Upscaler
+// purpose  : Constructor
+// =======================================================================
+Metal_Upscaler::Metal_Upscaler()
+: myMethod(Graphic3d_UpscalingMethod_Bilinear),
+  myActiveMethod(Graphic3d_UpscalingMethod_Bilinear),
+  myInputSize(0, 0),
+  myOutputSize(0, 0),
+  myJitter(0.0f, 0.0f),
+  myFrameIndex(0),
+  myFormat(MTLPixelFormatInvalid),
+  myToResetHistory(true),
+  myColorTexture(nil),
+  myDepthTexture(nil),
+  myMotionTexture(nil),
+  myOutputTexture(nil),
+  myScaler(nil),
+  myMotionPipeline(nil),
+  myResolvePipeline(nil),
+  myResolveColorPipeline(nil),
+  myResolveDepthState(nil),
+  myLinearSampler(nil)
+{
+  myPrevViewProj.InitIdentity();
+}
+
+// =======================================================================
+// function : ~Metal_Upscaler
+// purpose  : Destructor
+// =======================================================================
+Metal_Upscaler::~Metal_Upscaler()
+{
+  Release();
+}
+
+// =======================================================================
+// function : Release
+// purpose  : Release resources
+// =======================================================================
+void Metal_Upscaler::Release()
+{
+  myColorTexture = nil;
+  myDepthTexture = nil;
+  myMotionTexture = nil;
+  myOutputTexture = nil;
+  myScaler = nil;
+  myMotionPipeline = nil;
+  myResolvePipeline = nil;
+  myResolveColorPipeline = nil;
+  myResolveDepthState = nil;
+  myLinearSampler = nil;
+  myInputSize.SetValues(0, 0);
+  myOutputSize.SetValues(0, 0);
+  myJitter.SetValues(0.0f, 0.0f);
+  myFormat = MTLPixelFormatInvalid;
+  myToResetHistory = true;
+}
+
+// =======================================================================
+// function : JitteredProjection
+// purpose  : Apply sub-pixel jitter to projection matrix
+// =======================================================================
+NCollection_Mat4<float> Metal_Upscaler::JitteredProjection(const NCollection_Mat4<float>& theProj) const
+{
+  if ((myJitter.x() == 0.0f && myJitter.y() == 0.0f)
+   || myInputSize.x() <= 0 || myInputSize.y() <= 0)
+  {
+    return theProj;
+  }
+
+  // translate clip space by jitter; Y axis of pixels is directed downwards
+  const float aDeltaX =  2.0f * myJitter.x() / float(myInputSize.x());
+  const float aDeltaY = -2.0f * myJitter.y() / float(myInputSize.y());
+  NCollection_Mat4<float> aProj = theProj;
+  for (int aCol = 0; aCol < 4; ++aCol)
+  {
+    aProj.SetValue(0, aCol, theProj.GetValue(0, aCol) + aDeltaX * theProj.GetValue(3, aCol));
+    aProj.SetValue(1, aCol, theProj.GetValue(1, aCol) + aDeltaY * theProj.GetValue(3, aCol));
+  }
+  return aProj;
+}
+
+// =======================================================================
+// function : NextFrame
+// purpose  : Advance jitter to the next frame
+// =======================================================================
+void Metal_Upscaler::NextFrame()
+{
+  if (myActiveMethod != Graphic3d_UpscalingMethod_Temporal)
+  {
+    myJitter.SetValues(0.0f, 0.0f);
+    return;
+  }
+
+  // index 0 of Halton sequence is (0, 0) - start from 1 for centered distribution
+  myFrameIndex = (myFrameIndex + 1) % NbJitterPhases;
+  float aX = 0.0f, aY = 0.0f;
+  mySampler.sample2D(myFrameIndex + 1, aX, aY);
+  myJitter.SetValues(aX - 0.5f, aY - 0.5f);
+}
+
+// =======================================================================
+// function : createTexture
+// purpose  : Create texture of input or output size
+// =======================================================================
+id<MTLTexture> Metal_Upscaler::createTexture(Metal_Context* theCtx,
+                                             const NCollection_Vec2<int>& theSize,
+                                             MTLPixelFormat theFormat,
+                                             MTLTextureUsage theUsage,
+                                             NSString* theLabel) const
+{
+  MTLTextureDescriptor* aDesc = [MTLTextureDescriptor texture2DDescriptorWithPixelFormat:theFormat
+                                                                                   width:theSize.x()
+                                                                                  height:theSize.y()
+                                                                               mipmapped:NO];
+  aDesc.usage = theUsage;
+  aDesc.storageMode = MTLStorageModePrivate;
+  id<MTLTexture> aTexture = [theCtx->Device() newTextureWithDescriptor:aDesc];
+  aTexture.label = theLabel;
+  return aTexture;
+}
+
+// =======================================================================
+// function : Init
+// purpose  : Initialize resources
+// =======================================================================
+bool Metal_Upscaler::Init(Metal_Context* theCtx,
+                          Graphic3d_UpscalingMethod theMethod,
+                          const NCollection_Vec2<int>& theInputSize,
+                          const NCollection_Vec2<int>& theOutputSize,
+                          MTLPixelFormat theFormat)
+{
+  if (IsValid()
+   && myMethod == theMethod
+   && myInputSize == theInputSize
+   && myOutputSize == theOutputSize
+   && myFormat == (int)theFormat)
+  {
+    return true;
+  }
+
+  Release();
+  if (theCtx == nullptr || !theCtx->IsValid()
+   || theInputSize.x() <= 0 || theInputSize.y() <= 0
+   || theOutputSize.x() <= 0 || theOutputSize.y() <= 0)
+  {
+    return false;
+  }
+
+  myMethod = theMethod;
+  myActiveMethod = theMethod;
+  myInputSize  = theInputSize;
+  myOutputSize = theOutputSize;
+  if (myActiveMethod != Graphic3d_UpscalingMethod_Bilinear
+  && !theCtx->HasMetalFX())
+  {
+    theCtx->Messenger()->SendWarning() << "Metal_Upscaler: MetalFX is unavailable, bilinear upscaling is used instead";
+    myActiveMethod = Graphic3d_UpscalingMethod_Bilinear;
+  }
+  if (!initPipelines(theCtx, theFormat))
+  {
+    Release();
+    return false;
+  }
+  if (myActiveMethod != Graphic3d_UpscalingMethod_Bilinear
+  && !initScaler(theCtx, theFormat))
+  {
+    theCtx->Messenger()->SendWarning() << "Metal_Upscaler: failed to create MetalFX scaler, bilinear upscaling is used instead";
+    myActiveMethod = Graphic3d_UpscalingMethod_Bilinear;
+  }
+
+  // textures should satisfy usage requested by scaler
+  MTLTextureUsage aColorUsage  = MTLTextureUsageRenderTarget | MTLTextureUsageShaderRead;
+  MTLTextureUsage aDepthUsage  = MTLTextureUsageRenderTarget | MTLTextureUsageShaderRead;
+  MTLTextureUsage aMotionUsage = MTLTextureUsageRenderTarget | MTLTextureUsageShaderRead;
+  MTLTextureUsage anOutUsage   = MTLTextureUsageShaderRead;
+  if (@available(macOS 13.0, iOS 16.0, *))
+  {
+    if (myActiveMethod == Graphic3d_UpscalingMethod_Spatial)
+    {
+      id<MTLFXSpatialScaler> aScaler = (id<MTLFXSpatialScaler>)myScaler;
+      aColorUsage |= aScaler.colorTextureUsage;
+      anOutUsage  |= aScaler.outputTextureUsage;
+    }
+    else if (myActiveMethod == Graphic3d_UpscalingMethod_Temporal)
+    {
+      id<MTLFXTemporalScaler> aScaler = (id<MTLFXTemporalScaler>)myScaler;
+      aColorUsage  |= aScaler.colorTextureUsage;
+      aDepthUsage  |= aScaler.depthTextureUsage;
+      aMotionUsage |= aScaler.motionTextureUsage;
+      anOutUsage   |= aScaler.outputTextureUsage;
+    }
+  }
+
+  myColorTexture = createTexture(theCtx, theInputSize, theFormat, aColorUsage, @"UpscalerColor");
+  myDepthTexture = createTexture(theCtx, theInputSize, MTLPixelFormatDepth32Float, aDepthUsage, @"UpscalerDepth");
+  if (myActiveMethod == Graphic3d_UpscalingMethod_Temporal)
+  {
+    myMotionTexture = createTexture(theCtx, theInputSize, THE_MOTION_FORMAT, aMotionUsage, @"UpscalerMotion");
+  }
+  if (myActiveMethod != Graphic3d_UpscalingMethod_Bilinear)
+  {
+    myOutputTexture = createTexture(theCtx, theOutputSize, theFormat, anOutUsage, @"UpscalerOutput");
+  }
+  if (myColorTexture == nil
+   || myDepthTexture == nil
+   || (myActiveMethod == Graphic3d_UpscalingMethod_Temporal && myMotionTexture == nil)
+   || (myActiveMethod != Graphic3d_UpscalingMethod_Bilinear && myOutputTexture == nil))
+  {
+    theCtx->Messenger()->SendFail() << "Metal_Upscaler: failed to create textures";
+    Release();
+    return false;
+  }
+
+  myFormat = (int)theFormat;
+  myFrameIndex = 0;
+  myToResetHistory = true;
+  return true;
+}
+
+// =======================================================================
+// function : initScaler
+// purpose  : Create MetalFX scaler
+// =======================================================================
+bool Metal_Upscaler::initScaler(Metal_Context* theCtx, MTLPixelFormat theFormat)
+{
+  if (@available(macOS 13.0, iOS 16.0, *))
+  {
+    if (myActiveMethod == Graphic3d_UpscalingMethod_Spatial)
+    {
+      MTLFXSpatialScalerDescriptor* aDesc = [[MTLFXSpatialScalerDescriptor alloc] init];
+      aDesc.colorTextureFormat  = theFormat;
+      aDesc.outputTextureFormat = theFormat;
+      aDesc.inputWidth   = (NSUInteger)myInputSize.x();
+      aDesc.inputHeight  = (NSUInteger)myInputSize.y();
+      aDesc.outputWidth  = (NSUInteger)myOutputSize.x();
+      aDesc.outputHeight = (NSUInteger)myOutputSize.y();
+      aDesc.colorProcessingMode = MTLFXSpatialScalerColorProcessingModePerceptual;
+      myScaler = [aDesc newSpatialScalerWithDevice:theCtx->Device()];
+    }
+    else
+    {
+      MTLFXTemporalScalerDescriptor* aDesc = [[MTLFXTemporalScalerDescriptor alloc] init];
+      aDesc.colorTextureFormat  = theFormat;
+      aDesc.depthTextureFormat  = MTLPixelFormatDepth32Float;
+      aDesc.motionTextureFormat = THE_MOTION_FORMAT;
+      aDesc.outputTextureFormat = theFormat;
+      aDesc.inputWidth   = (NSUInteger)myInputSize.x();
+      aDesc.inputHeight  = (NSUInteger)myInputSize.y();
+      aDesc.outputWidth  = (NSUInteger)myOutputSize.x();
+      aDesc.outputHeight = (NSUInteger)myOutputSize.y();
+      myScaler = [aDesc newTemporalScalerWithDevice:theCtx->Device()];
+    }
+  }
+  return myScaler != nil;
+}
+
+// =======================================================================
+// function : initPipelines
+// purpose  : Create full-screen pipelines
+// =======================================================================
+bool Metal_Upscaler::initPipelines(Metal_Context* theCtx, MTLPixelFormat theFormat)
+{
+  NSError* anError = nil;
+  id<MTLLibrary> aLibrary = theCtx->LoadShaderLibrary("Metal_Upscaler_THE_UPSCALER_SHADER",
+                                                      [NSString stringWithUTF8String:THE_UPSCALER_SHADER],
+                                                      nil, &anError);
+  if (aLibrary == nil)
+  {
+    theCtx->Messenger()->SendFail() << "Metal_Upscaler: failed to compile shaders: "
+                                    << (anError != nil ? [[anError localizedDescription] UTF8String] : "");
+    return false;
+  }
+
+  id<MTLFunction> aVertexFunc = [aLibrary newFunctionWithName:@"upscaleVertex"];
+  MTLRenderPipelineDescriptor* aPipeDesc = [[MTLRenderPipelineDescriptor alloc] init];
+  aPipeDesc.label = @"UpscaleResolve";
+  aPipeDesc.vertexFunction = aVertexFunc;
+  aPipeDesc.fragmentFunction = [aLibrary newFunctionWithName:@"upscaleResolve"];
+  aPipeDesc.colorAttachments[0].pixelFormat = theFormat;
+  aPipeDesc.depthAttachmentPixelFormat = MTLPixelFormatDepth32Float;
+  myResolvePipeline = [theCtx->Device() newRenderPipelineStateWithDescriptor:aPipeDesc error:&anError];
+
+  aPipeDesc.label = @"UpscaleResolveColor";
+  aPipeDesc.fragmentFunction = [aLibrary newFunctionWithName:@"upscaleResolveColor"];
+  aPipeDesc.depthAttachmentPixelFormat = MTLPixelFormatInvalid;
+  myResolveColorPipeline = [theCtx->Device() newRenderPipelineStateWithDescriptor:aPipeDesc error:&anError];
+
+  if (myActiveMethod == Graphic3d_UpscalingMethod_Temporal)
+  {
+    aPipeDesc.label = @"UpscaleMotion";
+    aPipeDesc.fragmentFunction = [aLibrary newFunctionWithName:@"upscaleMotion"];
+    aPipeDesc.colorAttachments[0].pixelFormat = THE_MOTION_FORMAT;
+    myMotionPipeline = [theCtx->Device() newRenderPipelineStateWithDescriptor:aPipeDesc error:&anError];
+  }
+  if (myResolvePipeline == nil
+   || myResolveColorPipeline == nil
+   || (myActiveMethod == Graphic3d_UpscalingMethod_Temporal && myMotionPipeline == nil))
+  {
+    theCtx->Messenger()->SendFail() << "Metal_Upscaler: failed to create pipelines: "
+                                    << (anError != nil ? [[anError localizedDescription] UTF8String] : "");
+    return false;
+  }
+
+  MTLDepthStencilDescriptor* aDepthDesc = [[MTLDepthStencilDescriptor alloc] init];
+  aDepthDesc.depthCompareFunction = MTLCompareFunctionAlways;
+  aDepthDesc.depthWriteEnabled = YES;
+  myResolveDepthState = [theCtx->Device() newDepthStencilStateWithDescriptor:aDepthDesc];
+
+  MTLSamplerDescriptor* aSamplerDesc = [[MTLSamplerDescriptor alloc] init];
+  aSamplerDesc.minFilter = MTLSamplerMinMagFilterLinear;
+  aSamplerDesc.magFilter = MTLSamplerMinMagFilterLinear;
+  aSamplerDesc.sAddressMode = MTLSamplerAddressModeClampToEdge;
+  aSamplerDesc.tAddressMode = MTLSamplerAddressModeClampToEdge;
+  myLinearSampler = [theCtx->Device() newSamplerStateWithDescriptor:aSamplerDesc];
+  return myResolveDepthState != nil
+      && myLinearSampler != nil;
+}
+
+// =======================================================================
+// function : Encode
+// purpose  : Encode upscaling of the main pass into view target
+// =======================================================================
+bool Metal_Upscaler::Encode(Metal_Context* theCtx,
+                            id<MTLCommandBuffer> theCmdBuffer,
+                            id<MTLTexture> theTarget,
+                            id<MTLTexture> theTargetDepth,
+                            bool theToStoreDepth,
+                            const NCollection_Mat4<float>& theViewProj)
+{
+  if (!IsValid()
+   || theCtx == nullptr
+   || theCmdBuffer == nil
+   || theTarget == nil
+   || theTarget.pixelFormat != (MTLPixelFormat)myFormat
+   || (int)theTarget.width != myOutputSize.x()
+   || (int)theTarget.height != myOutputSize.y())
+  {
+    return false;
+  }
+
+  id<MTLTexture> aSource = myColorTexture;
+  if (myActiveMethod == Graphic3d_UpscalingMethod_Temporal)
+  {
+    // reproject current depth into previous frame; history is discarded on reset anyway
+    NCollection_Mat4<float> anInvViewProj;
+    theViewProj.Inverted(anInvViewProj);
+    const NCollection_Mat4<float> aReprojection = (myToResetHistory ? theViewProj : myPrevViewProj) * anInvViewProj;
+
+    MTLRenderPassDescriptor* aMotionPass = [MTLRenderPassDescriptor renderPassDescriptor];
+    aMotionPass.colorAttachments[0].texture = myMotionTexture;
+    aMotionPass.colorAttachments[0].loadAction = MTLLoadActionDontCare;
+    aMotionPass.colorAttachments[0].storeAction = MTLStoreActionStore;
+    id<MTLRenderCommandEncoder> anEncoder = [theCmdBuffer renderCommandEncoderWithDescriptor:aMotionPass];
+    if (anEncoder == nil)
+    {
+      return false;
+    }
+    anEncoder.label = @"UpscalerMotion";
+    [anEncoder setRenderPipelineState:myMotionPipeline];
+    [anEncoder setFragmentTexture:myDepthTexture atIndex:0];
+    [anEncoder setFragmentBytes:aReprojection.GetData() length:sizeof(float) * 16 atIndex:0];
+    [anEncoder drawPrimitives:MTLPrimitiveTypeTriangle vertexStart:0 vertexCount:3];
+    [anEncoder endEncoding];
+
+    if (@available(macOS 13.0, iOS 16.0, *))
+    {
+      id<MTLFXTemporalScaler> aScaler = (id<MTLFXTemporalScaler>)myScaler;
+      aScaler.colorTexture  = myColorTexture;
+      aScaler.depthTexture  = myDepthTexture;
+      aScaler.motionTexture = myMotionTexture;
+      aScaler.outputTexture = myOutputTexture;
+      aScaler.inputContentWidth  = (NSUInteger)myInputSize.x();
+      aScaler.inputContentHeight = (NSUInteger)myInputSize.y();
+      aScaler.jitterOffsetX = myJitter.x();
+      aScaler.jitterOffsetY = myJitter.y();
+      aScaler.motionVectorScaleX = (float)myInputSize.x();
+      aScaler.motionVectorScaleY = (float)myInputSize.y();
+      aScaler.depthReversed = NO;
+      aScaler.reset = myToResetHistory;
+      [aScaler encodeToCommandBuffer:theCmdBuffer];
+      aSource = myOutputTexture;
+    }
+    myPrevViewProj = theViewProj;
+    myToResetHistory = false;
+  }
+  else if (myActiveMethod == Graphic3d_UpscalingMethod_Spatial)
+  {
+    if (@available(macOS 13.0, iOS 16.0, *))
+    {
+      id<MTLFXSpatialScaler> aScaler = (id<MTLFXSpatialScaler>)myScaler;
+      aScaler.colorTexture  = myColorTexture;
+      aScaler.outputTexture = myOutputTexture;
+      aScaler.inputContentWidth  = (NSUInteger)myInputSize.x();
+      aScaler.inputContentHeight = (NSUInteger)myInputSize.y();
+      [aScaler encodeToCommandBuffer:theCmdBuffer];
+      aSource = myOutputTexture;
+    }
+  }
+
+  // every pixel is overwritten, so that neither color nor depth should be loaded
+  MTLRenderPassDescriptor* aResolvePass = [MTLRenderPassDescriptor renderPassDescriptor];
+  aResolvePass.colorAttachments[0].texture = theTarget;
+  aResolvePass.colorAttachments[0].loadAction = MTLLoadActionDontCare;
+  aResolvePass.colorAttachments[0].storeAction = MTLStoreActionStore;
+  if (theTargetDepth != nil)
+  {
+    aResolvePass.depthAttachment.texture = theTargetDepth;
+    aResolvePass.depthAttachment.loadAction = MTLLoadActionDontCare;
+    aResolvePass.depthAttachment.storeAction = theToStoreDepth ? MTLStoreActionStore : MTLStoreActionDontCare;
+  }
+  id<MTLRenderCommandEncoder> anEncoder = [theCmdBuffer renderCommandEncoderWithDescriptor:aResolvePass];
+  if (anEncoder == nil)
+  {
+    return false;
+  }
+  anEncoder.label = @"UpscalerResolve";
+  if (theTargetDepth != nil)
+  {
+    [anEncoder setRenderPipelineState:myResolvePipeline];
+    [anEncoder setDepthStencilState:myResolveDepthState];
+    [anEncoder setFragmentTexture:myDepthTexture atIndex:1];
+  }
+  else
+  {
+    [anEncoder setRenderPipelineState:myResolveColorPipeline];
+  }
+  [anEncoder setFragmentTexture:aSource atIndex:0];
+  [anEncoder setFragmentSamplerState:myLinearSampler atIndex:0];
+  [anEncoder drawPrimitives:MTLPrimitiveTypeTriangle vertexStart:0 vertexCount:3];
+  [anEncoder endEncoding];
+  return true;
+}
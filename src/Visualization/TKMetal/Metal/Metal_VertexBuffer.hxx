@@ -38,7 +38,9 @@ enum Metal_VertexFormat
   Metal_VertexFormat_Int3,
   Metal_VertexFormat_Int4,
   Metal_VertexFormat_UChar4,
-  Metal_VertexFormat_UChar4Normalized
+  Metal_VertexFormat_UChar4Normalized,
+  Metal_VertexFormat_Short2Normalized,
+  Metal_VertexFormat_UShort4Normalized
 };
 
 //! Vertex Buffer Object for storing vertex attribute data.
@@ -97,12 +99,40 @@ public:
   //! @param theStride stride between elements (0 = tightly packed)
   //! @param theNbElems number of elements
   //! @param theData pointer to data
+  //! @param theIsDynamic flag to allocate storage for frequent partial updates by SubData()
   //! @return true on success
   Standard_EXPORT bool Init(Metal_Context* theCtx,
                             Graphic3d_TypeOfData theType,
                             int theStride,
                             int theNbElems,
-                            const void* theData);
+                            const void* theData,
+                            bool theIsDynamic = false);
+
+  //! Update portion of buffer data, de-interleaving it when necessary.
+  //! @param theCtx Metal context
+  //! @param theStride stride between source elements (0 = tightly packed)
+  //! @param theElemFrom starting element index
+  //! @param theNbElems number of elements
+  //! @param theData pointer to the first source element to copy
+  //! @return true on success
+  Standard_EXPORT bool SubData(Metal_Context* theCtx,
+                               int theStride,
+                               int theElemFrom,
+                               int theNbElems,
+                               const void* theData);
+
+  //! Wrap tightly packed attribute data of application buffer without copying (see Metal_Buffer::Adopt()).
+  //! @param theCtx Metal context
+  //! @param theType data type from Graphic3d
+  //! @param theNbElems number of elements
+  //! @param theOwner buffer owning page-aligned memory
+  //! @param theOffset offset of attribute data within theOwner in bytes
+  //! @return FALSE if memory cannot be adopted
+  Standard_EXPORT bool Adopt(Metal_Context* theCtx,
+                             Graphic3d_TypeOfData theType,
+                             int theNbElems,
+                             const occ::handle<NCollection_Buffer>& theOwner,
+                             size_t theOffset);
 
 #ifdef __OBJC__
   //! Return Metal vertex format enum value.
@@ -20,6 +20,29 @@
 
 IMPLEMENT_STANDARD_RTTIEXT(Metal_VertexBuffer, Metal_Buffer)
 
+namespace
+{
+  //! Determine number of components and component size of Graphic3d data type.
+  static bool componentsOfType(Graphic3d_TypeOfData theType,
+                               unsigned int& theComponentsNb,
+                               size_t& theTypeSize)
+  {
+    switch (theType)
+    {
+      case Graphic3d_TOD_FLOAT:  theComponentsNb = 1; theTypeSize = sizeof(float);   return true;
+      case Graphic3d_TOD_VEC2:   theComponentsNb = 2; theTypeSize = sizeof(float);   return true;
+      case Graphic3d_TOD_VEC3:   theComponentsNb = 3; theTypeSize = sizeof(float);   return true;
+      case Graphic3d_TOD_VEC4:   theComponentsNb = 4; theTypeSize = sizeof(float);   return true;
+      case Graphic3d_TOD_VEC4UB: theComponentsNb = 4; theTypeSize = sizeof(uint8_t); return true;
+      case Graphic3d_TOD_VEC4US: theComponentsNb = 4; theTypeSize = sizeof(uint16_t); return true;
+      case Graphic3d_TOD_VEC2S:  theComponentsNb = 2; theTypeSize = sizeof(int16_t);  return true;
+      case Graphic3d_TOD_VEC2HF: theComponentsNb = 2; theTypeSize = sizeof(uint16_t); return true;
+      default:
+        return false;
+    }
+  }
+}
+
 // =======================================================================
 // function : Metal_VertexBuffer
 // purpose  : Constructor
@@ -62,6 +85,8 @@ size_t Metal_VertexBuffer::VertexFormatSize(Metal_VertexFormat theFormat)
     case Metal_VertexFormat_Int4:            return 16;
     case Metal_VertexFormat_UChar4:          return 4;
     case Metal_VertexFormat_UChar4Normalized: return 4;
+    case Metal_VertexFormat_Short2Normalized: return 4;
+    case Metal_VertexFormat_UShort4Normalized: return 8;
   }
   return 0;
 }
@@ -79,6 +104,9 @@ Metal_VertexFormat Metal_VertexBuffer::ToVertexFormat(Graphic3d_TypeOfData theTy
     case Graphic3d_TOD_VEC3:    return Metal_VertexFormat_Float3;
     case Graphic3d_TOD_VEC4:    return Metal_VertexFormat_Float4;
     case Graphic3d_TOD_VEC4UB:  return Metal_VertexFormat_UChar4Normalized;
+    case Graphic3d_TOD_VEC4US:  return Metal_VertexFormat_UShort4Normalized;
+    case Graphic3d_TOD_VEC2S:   return Metal_VertexFormat_Short2Normalized;
+    case Graphic3d_TOD_VEC2HF:  return Metal_VertexFormat_Half2;
     default:                    return Metal_VertexFormat_Invalid;
   }
 }
@@ -104,6 +132,8 @@ MTLVertexFormat Metal_VertexBuffer::MetalVertexFormat() const
     case Metal_VertexFormat_Int4:             return MTLVertexFormatInt4;
     case Metal_VertexFormat_UChar4:           return MTLVertexFormatUChar4;
     case Metal_VertexFormat_UChar4Normalized: return MTLVertexFormatUChar4Normalized;
+    case Metal_VertexFormat_Short2Normalized: return MTLVertexFormatShort2Normalized;
+    case Metal_VertexFormat_UShort4Normalized: return MTLVertexFormatUShort4Normalized;
   }
   return MTLVertexFormatInvalid;
 }
@@ -118,7 +148,7 @@ bool Metal_VertexBuffer::InitPositions(Metal_Context* theCtx,
 {
   myVertexFormat = Metal_VertexFormat_Float3;
   myStride = 3 * sizeof(float);
-  return Metal_Buffer::Init(theCtx, 3, theNbVertices, theData);
+  return initData(theCtx, 3, theNbVertices, sizeof(float), theData, staticStorageMode(theCtx));
 }
 
 // =======================================================================
@@ -131,7 +161,7 @@ bool Metal_VertexBuffer::InitNormals(Metal_Context* theCtx,
 {
   myVertexFormat = Metal_VertexFormat_Float3;
   myStride = 3 * sizeof(float);
-  return Metal_Buffer::Init(theCtx, 3, theNbVertices, theData);
+  return initData(theCtx, 3, theNbVertices, sizeof(float), theData, staticStorageMode(theCtx));
 }
 
 // =======================================================================
@@ -144,7 +174,7 @@ bool Metal_VertexBuffer::InitTexCoords(Metal_Context* theCtx,
 {
   myVertexFormat = Metal_VertexFormat_Float2;
   myStride = 2 * sizeof(float);
-  return Metal_Buffer::Init(theCtx, 2, theNbVertices, theData);
+  return initData(theCtx, 2, theNbVertices, sizeof(float), theData, staticStorageMode(theCtx));
 }
 
 // =======================================================================
@@ -157,7 +187,7 @@ bool Metal_VertexBuffer::InitColors(Metal_Context* theCtx,
 {
   myVertexFormat = Metal_VertexFormat_UChar4Normalized;
   myStride = 4 * sizeof(uint8_t);
-  return Metal_Buffer::Init(theCtx, 4, theNbVertices, theData);
+  return initData(theCtx, 4, theNbVertices, sizeof(uint8_t), theData, staticStorageMode(theCtx));
 }
 
 // =======================================================================
@@ -170,7 +200,7 @@ bool Metal_VertexBuffer::InitColorsFloat(Metal_Context* theCtx,
 {
   myVertexFormat = Metal_VertexFormat_Float4;
   myStride = 4 * sizeof(float);
-  return Metal_Buffer::Init(theCtx, 4, theNbVertices, theData);
+  return initData(theCtx, 4, theNbVertices, sizeof(float), theData, staticStorageMode(theCtx));
 }
 
 // =======================================================================
@@ -181,7 +211,8 @@ bool Metal_VertexBuffer::Init(Metal_Context* theCtx,
                               Graphic3d_TypeOfData theType,
                               int theStride,
                               int theNbElems,
-                              const void* theData)
+                              const void* theData,
+                              bool theIsDynamic)
 {
   myVertexFormat = ToVertexFormat(theType);
   if (myVertexFormat == Metal_VertexFormat_Invalid)
@@ -193,33 +224,14 @@ bool Metal_VertexBuffer::Init(Metal_Context* theCtx,
   size_t aInputStride = (theStride > 0) ? size_t(theStride) : aFormatSize;
   myStride = aFormatSize; // Output is always tightly packed
 
+  const Metal_StorageMode aMode = theIsDynamic ? dynamicStorageMode(theCtx) : staticStorageMode(theCtx);
+
   // Determine components and type size
   unsigned int aComponentsNb = 1;
   size_t aTypeSize = sizeof(float);
-  switch (theType)
+  if (!componentsOfType(theType, aComponentsNb, aTypeSize))
   {
-    case Graphic3d_TOD_FLOAT:
-      aComponentsNb = 1;
-      aTypeSize = sizeof(float);
-      break;
-    case Graphic3d_TOD_VEC2:
-      aComponentsNb = 2;
-      aTypeSize = sizeof(float);
-      break;
-    case Graphic3d_TOD_VEC3:
-      aComponentsNb = 3;
-      aTypeSize = sizeof(float);
-      break;
-    case Graphic3d_TOD_VEC4:
-      aComponentsNb = 4;
-      aTypeSize = sizeof(float);
-      break;
-    case Graphic3d_TOD_VEC4UB:
-      aComponentsNb = 4;
-      aTypeSize = sizeof(uint8_t);
-      break;
-    default:
-      return false;
+    return false;
   }
 
   // If data is interleaved (stride > element size), we need to de-interleave it
@@ -240,8 +252,62 @@ bool Metal_VertexBuffer::Init(Metal_Context* theCtx,
       aDst += aFormatSize;
     }
 
-    return Metal_Buffer::initData(theCtx, aComponentsNb, theNbElems, aTypeSize, aPackedData.data());
+    return Metal_Buffer::initData(theCtx, aComponentsNb, theNbElems, aTypeSize, aPackedData.data(), aMode);
+  }
+
+  return Metal_Buffer::initData(theCtx, aComponentsNb, theNbElems, aTypeSize, theData, aMode);
+}
+
+// =======================================================================
+// function : SubData
+// purpose  : Update portion of strided attribute data
+// =======================================================================
+bool Metal_VertexBuffer::SubData(Metal_Context* theCtx,
+                                 int theStride,
+                                 int theElemFrom,
+                                 int theNbElems,
+                                 const void* theData)
+{
+  if (theData == nullptr || myStride == 0)
+  {
+    return false;
+  }
+
+  const size_t anInputStride = (theStride > 0) ? size_t(theStride) : myStride;
+  if (anInputStride <= myStride)
+  {
+    return Metal_Buffer::SubData(theCtx, theElemFrom, theNbElems, theData);
+  }
+
+  std::vector<uint8_t> aPackedData(size_t(theNbElems) * myStride);
+  const uint8_t* aSrc = static_cast<const uint8_t*>(theData);
+  for (int anElemIter = 0; anElemIter < theNbElems; ++anElemIter)
+  {
+    memcpy(aPackedData.data() + size_t(anElemIter) * myStride, aSrc, myStride);
+    aSrc += anInputStride;
+  }
+  return Metal_Buffer::SubData(theCtx, theElemFrom, theNbElems, aPackedData.data());
+}
+
+// =======================================================================
+// function : Adopt
+// purpose  : Wrap tightly packed attribute data without copying
+// =======================================================================
+bool Metal_VertexBuffer::Adopt(Metal_Context* theCtx,
+                               Graphic3d_TypeOfData theType,
+                               int theNbElems,
+                               const occ::handle<NCollection_Buffer>& theOwner,
+                               size_t theOffset)
+{
+  unsigned int aComponentsNb = 1;
+  size_t aTypeSize = sizeof(float);
+  myVertexFormat = ToVertexFormat(theType);
+  if (myVertexFormat == Metal_VertexFormat_Invalid
+  || !componentsOfType(theType, aComponentsNb, aTypeSize))
+  {
+    return false;
   }
 
-  return Metal_Buffer::initData(theCtx, aComponentsNb, theNbElems, aTypeSize, theData);
+  myStride = VertexFormatSize(myVertexFormat);
+  return Metal_Buffer::Adopt(theCtx, aComponentsNb, theNbElems, aTypeSize, theOwner, theOffset);
 }
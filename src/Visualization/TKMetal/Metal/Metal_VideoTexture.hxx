@@ -0,0 +1,177 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef Metal_VideoTexture_HeaderFile
+#define Metal_VideoTexture_HeaderFile
+
+#include <Metal_Resource.hxx>
+#include <Aspect_FillMethod.hxx>
+#include <Graphic3d_MediaTextureSet.hxx>
+#include <NCollection_Vec2.hxx>
+#include <NCollection_Vec4.hxx>
+
+#include <cstdint>
+#include <vector>
+
+#ifdef __OBJC__
+@protocol MTLRenderCommandEncoder;
+@protocol MTLRenderPipelineState;
+@protocol MTLSamplerState;
+@protocol MTLTexture;
+#endif
+
+//! Video frames of Graphic3d_MediaTextureSet presented by Metal.
+//! Frames decoded by VideoToolbox (see Graphic3d_MediaTextureSet::SetHardwareDecoding())
+//! are IOSurface-backed CVPixelBuffers, which are wrapped into Metal textures through CVMetalTextureCache
+//! without any copy: bi-planar 4:2:0 (8-bit NV12 and 10-bit P010) luma and chroma planes are sampled separately
+//! and converted into RGB by the shader, BGRA buffers are sampled directly.
+//! Software-decoded frames (planar YUV 4:2:0 or RGB) are uploaded into per-slot textures instead.
+//!
+//! Each frame is kept in one of the slots rotated between frames in flight,
+//! so that the pixel buffer of a frame still read by GPU is not recycled by decoder;
+//! new frame is postponed to the next redraw when all slots are busy.
+class Metal_VideoTexture : public Metal_Resource
+{
+  DEFINE_STANDARD_RTTIEXT(Metal_VideoTexture, Metal_Resource)
+public:
+
+  //! Layout of the planes of the current frame.
+  enum PlaneLayout
+  {
+    PlaneLayout_None = -1, //!< no frame
+    PlaneLayout_RGB  =  0, //!< single RGB(A) plane
+    PlaneLayout_NV12 =  1, //!< luma plane and interleaved chroma plane
+    PlaneLayout_I420 =  2  //!< luma plane and two chroma planes
+  };
+
+public:
+
+  //! Create video texture for the media.
+  Standard_EXPORT Metal_VideoTexture(const occ::handle<Graphic3d_MediaTextureSet>& theMedia);
+
+  //! Destructor.
+  Standard_EXPORT ~Metal_VideoTexture() override;
+
+  //! Return media.
+  const occ::handle<Graphic3d_MediaTextureSet>& Media() const { return myMedia; }
+
+  //! Present the next decoded frame, if any, and mark current frame as used by the frame being encoded;
+  //! should be called once per frame after Metal_Context::WaitForFrame().
+  //! @return TRUE if there is a frame to display
+  Standard_EXPORT bool Update(Metal_Context* theCtx);
+
+  //! Return TRUE if there is a frame to display.
+  bool IsValid() const { return myCurrent >= 0; }
+
+  //! Return layout of the current frame.
+  PlaneLayout Layout() const { return myCurrent >= 0 ? mySlots[myCurrent].Layout : PlaneLayout_None; }
+
+  //! Return size of the current frame.
+  const NCollection_Vec2<int>& FrameSize() const { return myFrameSize; }
+
+  //! Return TRUE if the current frame wraps decoder surface without copy.
+  bool IsZeroCopy() const { return myCurrent >= 0 && mySlots[myCurrent].PixelBuffer != nullptr; }
+
+  //! Return number of frames wrapped without copy.
+  int64_t NbZeroCopyFrames() const { return myNbZeroCopy; }
+
+  //! Return number of frames uploaded from CPU memory.
+  int64_t NbUploadedFrames() const { return myNbUploaded; }
+
+  //! Return rows of 3x4 matrix converting (Y, Cb, Cr, 1) of the current frame into RGB.
+  const NCollection_Vec4<float>* ColorMatrix() const { return myColorMatrix; }
+
+#ifdef __OBJC__
+  //! Return plane texture of the current frame.
+  Standard_EXPORT id<MTLTexture> PlaneTexture(int thePlane) const;
+
+  //! Draw the current frame as full-screen background.
+  //! @param theCtx     Metal context
+  //! @param theEncoder render encoder of the main pass (BGRA8 color, Depth32Float depth)
+  //! @param theWidth   viewport width
+  //! @param theHeight  viewport height
+  //! @param theFill    fill method (stretch, tile or center)
+  Standard_EXPORT void DrawBackground(Metal_Context* theCtx,
+                                      id<MTLRenderCommandEncoder> theEncoder,
+                                      int theWidth,
+                                      int theHeight,
+                                      Aspect_FillMethod theFill);
+#endif
+
+  //! Release GPU resources and retained frames.
+  Standard_EXPORT void Release(Metal_Context* theCtx) override;
+
+  //! Return estimated GPU memory of uploaded frames (wrapped frames are owned by decoder).
+  Standard_EXPORT size_t EstimatedDataSize() const override;
+
+protected:
+
+  //! Frame slot.
+  struct Slot
+  {
+#ifdef __OBJC__
+    id<MTLTexture> Planes[3];     //!< plane textures
+#else
+    void*          Planes[3];
+#endif
+    void*          CvTextures[3]; //!< CVMetalTextureRef keeping wrapped planes alive
+    void*          PixelBuffer;   //!< retained CVPixelBufferRef of wrapped frame
+    PlaneLayout    Layout;        //!< plane layout
+    uint64_t       LastUsedFrame; //!< last frame number reading the slot
+
+    Slot() : CvTextures(), PixelBuffer(nullptr), Layout(PlaneLayout_None), LastUsedFrame(0)
+    {
+      for (int aPlaneIter = 0; aPlaneIter < 3; ++aPlaneIter) { Planes[aPlaneIter] = nullptr; }
+    }
+  };
+
+protected:
+
+  //! Wrap hardware frame into the slot.
+  bool wrapPixelBuffer(Metal_Context* theCtx, Slot& theSlot, void* thePixelBuffer);
+
+  //! Upload software frame into the slot.
+  bool uploadFrame(Metal_Context* theCtx, Slot& theSlot, const Media_Frame& theFrame);
+
+  //! Release wrapped surfaces of the slot (uploaded textures are kept for reuse).
+  static void releaseWrapped(Slot& theSlot);
+
+  //! Set color matrix for the given coefficients of R and B and range.
+  void setColorMatrix(float theKr, float theKb, bool theIsFullRange);
+
+  //! Create background pipeline and samplers on first use.
+  bool initPipeline(Metal_Context* theCtx);
+
+protected:
+
+  occ::handle<Graphic3d_MediaTextureSet> myMedia;     //!< media texture set
+  std::vector<Slot>          mySlots;                 //!< frame slots
+#ifdef __OBJC__
+  id<MTLRenderPipelineState> myPipeline;              //!< background pipeline
+  id<MTLSamplerState>        mySamplers[2];           //!< clamped and repeated samplers
+#else
+  void*                      myPipeline;
+  void*                      mySamplers[2];
+#endif
+  void*                      myTextureCache;          //!< CVMetalTextureCacheRef
+  std::vector<uint8_t>       myConverted;             //!< temporary buffer for RGB to RGBA conversion
+  NCollection_Vec4<float>    myColorMatrix[3];        //!< YCbCr to RGB matrix rows
+  NCollection_Vec2<int>      myFrameSize;             //!< current frame size
+  int64_t                    myNbZeroCopy;            //!< number of wrapped frames
+  int64_t                    myNbUploaded;            //!< number of uploaded frames
+  int                        myCurrent;               //!< slot of the current frame
+};
+
+DEFINE_STANDARD_HANDLE(Metal_VideoTexture, Metal_Resource)
+
+#endif // Metal_VideoTexture_HeaderFile
@@ -0,0 +1,646 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+// Import Apple frameworks first to avoid Handle name conflicts with Carbon
+#import <Metal/Metal.h>
+#import <CoreVideo/CoreVideo.h>
+
+#include <Metal_VideoTexture.hxx>
+#include <Metal_Caps.hxx>
+#include <Metal_Context.hxx>
+#include <Metal_Texture.hxx>
+
+#include <Graphic3d_MediaTexture.hxx>
+#include <Media_Frame.hxx>
+#include <Message_Messenger.hxx>
+
+#include <algorithm>
+
+IMPLEMENT_STANDARD_RTTIEXT(Metal_VideoTexture, Metal_Resource)
+
+namespace
+{
+  //! Metal shader drawing video frame as background with conversion of YCbCr planes into RGB.
+  static const char* THE_VIDEO_BACKGROUND_SHADER = R"(
+#include <metal_stdlib>
+using namespace metal;
+
+struct VideoBgVertexOut
+{
+  float4 position [[position]];
+  float2 texCoord;
+};
+
+struct VideoBgUniforms
+{
+  float4 colorMatrix[3]; // rows converting (Y, Cb, Cr, 1) into RGB
+  float2 textureScale;
+  float2 textureOffset;
+  float2 viewportSize;
+  int    fillMethod;     // 0=stretch, 1=tile, 2=center
+  int    planeLayout;    // 0=RGB, 1=NV12, 2=I420
+};
+
+vertex VideoBgVertexOut videoBgVertex(uint vid [[vertex_id]])
+{
+  const float2 aPositions[3] = { float2(-1.0, -1.0), float2(3.0, -1.0), float2(-1.0, 3.0) };
+  VideoBgVertexOut anOut;
+  anOut.position = float4(aPositions[vid], 0.0, 1.0);
+  anOut.texCoord = aPositions[vid] * 0.5 + 0.5;
+  return anOut;
+}
+
+fragment float4 videoBgFragment(VideoBgVertexOut in [[stage_in]],
+                                constant VideoBgUniforms& uniforms [[buffer(0)]],
+                                texture2d<float> plane0 [[texture(0)]],
+                                texture2d<float> plane1 [[texture(1)]],
+                                texture2d<float> plane2 [[texture(2)]],
+                                sampler textureSampler [[sampler(0)]])
+{
+  float2 uv = in.texCoord;
+  if (uniforms.fillMethod == 2)
+  {
+    uv = (uv - float2(0.5)) * uniforms.textureScale + float2(0.5) + uniforms.textureOffset;
+    if (uv.x < 0.0 || uv.x > 1.0 || uv.y < 0.0 || uv.y > 1.0)
+    {
+      return float4(0.0, 0.0, 0.0, 1.0);
+    }
+  }
+  else
+  {
+    uv = uv * uniforms.textureScale + uniforms.textureOffset;
+  }
+  uv.y = 1.0 - uv.y;
+
+  if (uniforms.planeLayout == 0)
+  {
+    return float4(plane0.sample(textureSampler, uv).rgb, 1.0);
+  }
+
+  float4 aYuv = float4(plane0.sample(textureSampler, uv).r, 0.0, 0.0, 1.0);
+  if (uniforms.planeLayout == 1)
+  {
+    aYuv.yz = plane1.sample(textureSampler, uv).rg;
+  }
+  else
+  {
+    aYuv.y = plane1.sample(textureSampler, uv).r;
+    aYuv.z = plane2.sample(textureSampler, uv).r;
+  }
+  const float3 aRgb = float3(dot(uniforms.colorMatrix[0], aYuv),
+                             dot(uniforms.colorMatrix[1], aYuv),
+                             dot(uniforms.colorMatrix[2], aYuv));
+  return float4(saturate(aRgb), 1.0);
+}
+)";
+
+  //! Uniforms of THE_VIDEO_BACKGROUND_SHADER.
+  struct VideoBgUniforms
+  {
+    float colorMatrix[3][4];
+    float textureScale[2];
+    float textureOffset[2];
+    float viewportSize[2];
+    int   fillMethod;
+    int   planeLayout;
+  };
+
+  //! Return number of planes of the layout.
+  static int nbPlanes(Metal_VideoTexture::PlaneLayout theLayout)
+  {
+    switch (theLayout)
+    {
+      case Metal_VideoTexture::PlaneLayout_RGB:  return 1;
+      case Metal_VideoTexture::PlaneLayout_NV12: return 2;
+      case Metal_VideoTexture::PlaneLayout_I420: return 3;
+      case Metal_VideoTexture::PlaneLayout_None: break;
+    }
+    return 0;
+  }
+
+  //! Return front frame of the media.
+  static occ::handle<Media_Frame> frontFrame(const occ::handle<Graphic3d_MediaTextureSet>& theMedia)
+  {
+    if (theMedia.IsNull() || theMedia->IsEmpty())
+    {
+      return occ::handle<Media_Frame>();
+    }
+    const Graphic3d_MediaTexture* aTexture = dynamic_cast<const Graphic3d_MediaTexture*>(theMedia->First().get());
+    return aTexture != nullptr ? aTexture->Frame() : occ::handle<Media_Frame>();
+  }
+}
+
+// =======================================================================
+// function : Metal_VideoTexture
+// purpose  :
+// =======================================================================
+Metal_VideoTexture::Metal_VideoTexture(const occ::handle<Graphic3d_MediaTextureSet>& theMedia)
+: myMedia(theMedia),
+  myPipeline(nil),
+  myTextureCache(nullptr),
+  myNbZeroCopy(0),
+  myNbUploaded(0),
+  myCurrent(-1)
+{
+  mySamplers[0] = nil;
+  mySamplers[1] = nil;
+  setColorMatrix(0.2126f, 0.0722f, false);
+}
+
+// =======================================================================
+// function : ~Metal_VideoTexture
+// purpose  :
+// =======================================================================
+Metal_VideoTexture::~Metal_VideoTexture()
+{
+  Release(nullptr);
+}
+
+// =======================================================================
+// function : Release
+// purpose  :
+// =======================================================================
+void Metal_VideoTexture::Release(Metal_Context* theCtx)
+{
+  (void)theCtx;
+  for (Slot& aSlot : mySlots)
+  {
+    releaseWrapped(aSlot);
+  }
+  mySlots.clear();
+  if (myTextureCache != nullptr)
+  {
+    CFRelease((CVMetalTextureCacheRef)myTextureCache);
+    myTextureCache = nullptr;
+  }
+  myPipeline = nil;
+  mySamplers[0] = nil;
+  mySamplers[1] = nil;
+  myFrameSize = NCollection_Vec2<int>();
+  myCurrent = -1;
+}
+
+// =======================================================================
+// function : EstimatedDataSize
+// purpose  :
+// =======================================================================
+size_t Metal_VideoTexture::EstimatedDataSize() const
+{
+  size_t aSize = 0;
+  for (const Slot& aSlot : mySlots)
+  {
+    if (aSlot.PixelBuffer != nullptr)
+    {
+      continue;
+    }
+    for (int aPlaneIter = 0; aPlaneIter < 3; ++aPlaneIter)
+    {
+      id<MTLTexture> aPlane = aSlot.Planes[aPlaneIter];
+      if (aPlane != nil)
+      {
+        aSize += size_t(aPlane.width) * size_t(aPlane.height)
+               * size_t(Metal_Texture::BytesPerPixel((int)aPlane.pixelFormat));
+      }
+    }
+  }
+  return aSize;
+}
+
+// =======================================================================
+// function : PlaneTexture
+// purpose  :
+// =======================================================================
+id<MTLTexture> Metal_VideoTexture::PlaneTexture(int thePlane) const
+{
+  return myCurrent >= 0 && thePlane >= 0 && thePlane < 3
+       ? mySlots[myCurrent].Planes[thePlane]
+       : nil;
+}
+
+// =======================================================================
+// function : releaseWrapped
+// purpose  :
+// =======================================================================
+void Metal_VideoTexture::releaseWrapped(Slot& theSlot)
+{
+  for (int aPlaneIter = 0; aPlaneIter < 3; ++aPlaneIter)
+  {
+    if (theSlot.CvTextures[aPlaneIter] != nullptr)
+    {
+      theSlot.Planes[aPlaneIter] = nil;
+      CFRelease((CVMetalTextureRef)theSlot.CvTextures[aPlaneIter]);
+      theSlot.CvTextures[aPlaneIter] = nullptr;
+    }
+  }
+  if (theSlot.PixelBuffer != nullptr)
+  {
+    CVPixelBufferRelease((CVPixelBufferRef)theSlot.PixelBuffer);
+    theSlot.PixelBuffer = nullptr;
+    theSlot.Layout = PlaneLayout_None;
+  }
+}
+
+// =======================================================================
+// function : setColorMatrix
+// purpose  :
+// =======================================================================
+void Metal_VideoTexture::setColorMatrix(float theKr, float theKb, bool theIsFullRange)
+{
+  // limited range is expanded from [16, 235] luma and [16, 240] chroma codes
+  const float aKg = 1.0f - theKr - theKb;
+  const float aRV =  2.0f * (1.0f - theKr);
+  const float aBU =  2.0f * (1.0f - theKb);
+  const float aGU = -2.0f * theKb * (1.0f - theKb) / aKg;
+  const float aGV = -2.0f * theKr * (1.0f - theKr) / aKg;
+  const float aYScale  = theIsFullRange ? 1.0f : 255.0f / 219.0f;
+  const float aYOffset = theIsFullRange ? 0.0f : -16.0f / 255.0f * aYScale;
+  const float aCScale  = theIsFullRange ? 1.0f : 255.0f / 224.0f;
+  const float aCZero   = 128.0f / 255.0f;
+  myColorMatrix[0] = NCollection_Vec4<float>(aYScale, 0.0f, aRV * aCScale, aYOffset - aRV * aCScale * aCZero);
+  myColorMatrix[1] = NCollection_Vec4<float>(aYScale, aGU * aCScale, aGV * aCScale, aYOffset - (aGU + aGV) * aCScale * aCZero);
+  myColorMatrix[2] = NCollection_Vec4<float>(aYScale, aBU * aCScale, 0.0f, aYOffset - aBU * aCScale * aCZero);
+}
+
+// =======================================================================
+// function : Update
+// purpose  :
+// =======================================================================
+bool Metal_VideoTexture::Update(Metal_Context* theCtx)
+{
+  if (theCtx == nullptr || myMedia.IsNull())
+  {
+    return IsValid();
+  }
+
+  const uint64_t aFrame   = theCtx->FrameNumber() + 1;
+  const int      aNbSlots = std::max(theCtx->Caps()->maxFramesInFlight, 1) + 1;
+  if (mySlots.empty())
+  {
+    mySlots.resize(size_t(aNbSlots));
+    CVMetalTextureCacheRef aCache = nullptr;
+    if (CVMetalTextureCacheCreate(kCFAllocatorDefault, nullptr, theCtx->Device(), nullptr, &aCache) == kCVReturnSuccess)
+    {
+      myTextureCache = aCache;
+    }
+    else
+    {
+      theCtx->Messenger()->SendWarning() << "Metal_VideoTexture: unable to create CVMetalTextureCache, hardware frames are not displayed";
+    }
+  }
+  if (myTextureCache != nullptr)
+  {
+    CVMetalTextureCacheFlush((CVMetalTextureCacheRef)myTextureCache, 0);
+  }
+
+  // the slot should not be read by frames still in flight;
+  // otherwise the new frame stays queued till the next redraw
+  int aFreeSlot = -1;
+  for (int aSlotIter = 0; aSlotIter < (int)mySlots.size(); ++aSlotIter)
+  {
+    if (aSlotIter != myCurrent
+     && (mySlots[aSlotIter].LastUsedFrame == 0
+      || aFrame - mySlots[aSlotIter].LastUsedFrame >= uint64_t(aNbSlots - 1)))
+    {
+      aFreeSlot = aSlotIter;
+      break;
+    }
+  }
+
+  if (aFreeSlot >= 0
+   && myMedia->SwapFrames())
+  {
+    const occ::handle<Media_Frame> aFront = frontFrame(myMedia);
+    Slot& aSlot = mySlots[aFreeSlot];
+    releaseWrapped(aSlot);
+    bool isDone = false;
+    if (!aFront.IsNull() && !aFront->IsEmpty())
+    {
+      if (aFront->IsHardwareFrame())
+      {
+        isDone = wrapPixelBuffer(theCtx, aSlot, aFront->NativeBuffer());
+        myNbZeroCopy += isDone ? 1 : 0;
+      }
+      else
+      {
+        isDone = uploadFrame(theCtx, aSlot, *aFront);
+        myNbUploaded += isDone ? 1 : 0;
+      }
+    }
+    if (isDone)
+    {
+      myCurrent = aFreeSlot;
+      myFrameSize = aFront->Size();
+    }
+  }
+
+  if (myCurrent >= 0)
+  {
+    mySlots[myCurrent].LastUsedFrame = aFrame;
+  }
+  return IsValid();
+}
+
+// =======================================================================
+// function : wrapPixelBuffer
+// purpose  :
+// =======================================================================
+bool Metal_VideoTexture::wrapPixelBuffer(Metal_Context* theCtx, Slot& theSlot, void* thePixelBuffer)
+{
+  CVPixelBufferRef aPixelBuffer = (CVPixelBufferRef)thePixelBuffer;
+  if (aPixelBuffer == nullptr || myTextureCache == nullptr)
+  {
+    return false;
+  }
+
+  MTLPixelFormat aFormats[2] = { MTLPixelFormatInvalid, MTLPixelFormatInvalid };
+  const OSType aType = CVPixelBufferGetPixelFormatType(aPixelBuffer);
+  const bool isFullRange = aType == kCVPixelFormatType_420YpCbCr8BiPlanarFullRange
+                        || aType == kCVPixelFormatType_420YpCbCr10BiPlanarFullRange;
+  switch (aType)
+  {
+    case kCVPixelFormatType_420YpCbCr8BiPlanarVideoRange:
+    case kCVPixelFormatType_420YpCbCr8BiPlanarFullRange:
+      aFormats[0] = MTLPixelFormatR8Unorm;
+      aFormats[1] = MTLPixelFormatRG8Unorm;
+      theSlot.Layout = PlaneLayout_NV12;
+      break;
+    case kCVPixelFormatType_420YpCbCr10BiPlanarVideoRange:
+    case kCVPixelFormatType_420YpCbCr10BiPlanarFullRange:
+      // 10-bit codes are stored within the most significant bits of 16-bit components
+      aFormats[0] = MTLPixelFormatR16Unorm;
+      aFormats[1] = MTLPixelFormatRG16Unorm;
+      theSlot.Layout = PlaneLayout_NV12;
+      break;
+    case kCVPixelFormatType_32BGRA:
+      aFormats[0] = MTLPixelFormatBGRA8Unorm;
+      theSlot.Layout = PlaneLayout_RGB;
+      break;
+    default:
+      theCtx->Messenger()->SendWarning() << "Metal_VideoTexture: unsupported pixel format of decoded frame " << (int)aType;
+      theSlot.Layout = PlaneLayout_None;
+      return false;
+  }
+
+  const int aNbPlanes = nbPlanes(theSlot.Layout);
+  const bool isPlanar = CVPixelBufferIsPlanar(aPixelBuffer);
+  for (int aPlaneIter = 0; aPlaneIter < aNbPlanes; ++aPlaneIter)
+  {
+    const size_t aSizeX = isPlanar ? CVPixelBufferGetWidthOfPlane (aPixelBuffer, aPlaneIter) : CVPixelBufferGetWidth (aPixelBuffer);
+    const size_t aSizeY = isPlanar ? CVPixelBufferGetHeightOfPlane(aPixelBuffer, aPlaneIter) : CVPixelBufferGetHeight(aPixelBuffer);
+    CVMetalTextureRef aCvTexture = nullptr;
+    if (CVMetalTextureCacheCreateTextureFromImage(kCFAllocatorDefault, (CVMetalTextureCacheRef)myTextureCache,
+                                                  aPixelBuffer, nullptr, aFormats[aPlaneIter],
+                                                  aSizeX, aSizeY, size_t(aPlaneIter), &aCvTexture) != kCVReturnSuccess
+     || aCvTexture == nullptr)
+    {
+      theCtx->Messenger()->SendWarning() << "Metal_VideoTexture: unable to wrap plane " << aPlaneIter << " of decoded frame";
+      releaseWrapped(theSlot);
+      theSlot.Layout = PlaneLayout_None;
+      return false;
+    }
+    theSlot.CvTextures[aPlaneIter] = aCvTexture;
+    theSlot.Planes[aPlaneIter] = CVMetalTextureGetTexture(aCvTexture);
+  }
+  for (int aPlaneIter = aNbPlanes; aPlaneIter < 3; ++aPlaneIter)
+  {
+    theSlot.Planes[aPlaneIter] = nil;
+  }
+
+  // decoder recycles the buffer once the frame is unreferenced, while GPU might still read it
+  theSlot.PixelBuffer = CVPixelBufferRetain(aPixelBuffer);
+  if (theSlot.Layout == PlaneLayout_NV12)
+  {
+    CFTypeRef aMatrix = CVBufferGetAttachment(aPixelBuffer, kCVImageBufferYCbCrMatrixKey, nullptr);
+    if (aMatrix != nullptr && CFEqual(aMatrix, kCVImageBufferYCbCrMatrix_ITU_R_601_4))
+    {
+      setColorMatrix(0.299f, 0.114f, isFullRange);
+    }
+    else if (aMatrix != nullptr && CFEqual(aMatrix, kCVImageBufferYCbCrMatrix_ITU_R_2020))
+    {
+      setColorMatrix(0.2627f, 0.0593f, isFullRange);
+    }
+    else
+    {
+      setColorMatrix(0.2126f, 0.0722f, isFullRange);
+    }
+  }
+  return true;
+}
+
+// =======================================================================
+// function : uploadFrame
+// purpose  :
+// =======================================================================
+bool Metal_VideoTexture::uploadFrame(Metal_Context* theCtx, Slot& theSlot, const Media_Frame& theFrame)
+{
+  const Image_Format anImgFormat = Media_Frame::FormatFFmpeg2Occt(theFrame.Format());
+  const NCollection_Vec2<int> aSize = theFrame.Size();
+  PlaneLayout aLayout = PlaneLayout_None;
+  MTLPixelFormat aFormat = MTLPixelFormatInvalid;
+  switch (anImgFormat)
+  {
+    case Image_Format_RGB:
+    case Image_Format_RGBA:
+    case Image_Format_RGB32:
+      aLayout = PlaneLayout_RGB;
+      aFormat = MTLPixelFormatRGBA8Unorm;
+      break;
+    case Image_Format_BGRA:
+    case Image_Format_BGR32:
+      aLayout = PlaneLayout_RGB;
+      aFormat = MTLPixelFormatBGRA8Unorm;
+      break;
+    case Image_Format_BGR:
+      // converted into RGBA by Metal_Texture::ConvertImageFormat()
+      aLayout = PlaneLayout_RGB;
+      aFormat = MTLPixelFormatRGBA8Unorm;
+      break;
+    case Image_Format_UNKNOWN:
+      if (theFrame.Plane(1) != nullptr && theFrame.Plane(2) != nullptr)
+      {
+        // planar YUV 4:2:0 passed by player not forced to RGB (see Media_PlayerContext::SetForceRgb())
+        aLayout = PlaneLayout_I420;
+        aFormat = MTLPixelFormatR8Unorm;
+      }
+      break;
+    default:
+      break;
+  }
+  if (aLayout == PlaneLayout_None)
+  {
+    theCtx->Messenger()->SendWarning() << "Metal_VideoTexture: unsupported pixel format of decoded frame " << theFrame.Format();
+    return false;
+  }
+
+  const int aNbPlanes = nbPlanes(aLayout);
+  for (int aPlaneIter = 0; aPlaneIter < aNbPlanes; ++aPlaneIter)
+  {
+    const NCollection_Vec2<int> aPlaneSize = aPlaneIter == 0 ? aSize : (aSize + NCollection_Vec2<int>(1)) / 2;
+    id<MTLTexture> aTexture = theSlot.Planes[aPlaneIter];
+    if (aTexture == nil
+     || aTexture.pixelFormat != aFormat
+     || (int)aTexture.width  != aPlaneSize.x()
+     || (int)aTexture.height != aPlaneSize.y())
+    {
+      MTLTextureDescriptor* aDesc = [MTLTextureDescriptor texture2DDescriptorWithPixelFormat:aFormat
+                                                                                       width:NSUInteger(aPlaneSize.x())
+                                                                                      height:NSUInteger(aPlaneSize.y())
+                                                                                   mipmapped:NO];
+      aDesc.usage = MTLTextureUsageShaderRead;
+      aDesc.storageMode = MTLStorageModeShared;
+      aTexture = [theCtx->Device() newTextureWithDescriptor:aDesc];
+      if (aTexture == nil)
+      {
+        theCtx->Messenger()->SendFail() << "Metal_VideoTexture: unable to allocate " << aPlaneSize.x() << "x" << aPlaneSize.y() << " texture";
+        return false;
+      }
+      aTexture.label = @"VideoFramePlane";
+      theSlot.Planes[aPlaneIter] = aTexture;
+    }
+
+    const MTLRegion aRegion = MTLRegionMake2D(0, 0, NSUInteger(aPlaneSize.x()), NSUInteger(aPlaneSize.y()));
+    if (Metal_Texture::NeedsFormatConversion(anImgFormat))
+    {
+      const int aDstBytesPerPixel = Metal_Texture::BytesPerPixel((int)aFormat);
+      myConverted.resize(size_t(aPlaneSize.x()) * size_t(aPlaneSize.y()) * size_t(aDstBytesPerPixel));
+      Metal_Texture::ConvertImageFormat(theFrame.Plane(aPlaneIter), myConverted.data(),
+                                        aPlaneSize.x(), aPlaneSize.y(), size_t(theFrame.LineSize(aPlaneIter)),
+                                        anImgFormat, aDstBytesPerPixel);
+      [aTexture replaceRegion:aRegion mipmapLevel:0 withBytes:myConverted.data() bytesPerRow:NSUInteger(aPlaneSize.x() * aDstBytesPerPixel)];
+    }
+    else
+    {
+      [aTexture replaceRegion:aRegion mipmapLevel:0 withBytes:theFrame.Plane(aPlaneIter) bytesPerRow:NSUInteger(theFrame.LineSize(aPlaneIter))];
+    }
+  }
+  for (int aPlaneIter = aNbPlanes; aPlaneIter < 3; ++aPlaneIter)
+  {
+    theSlot.Planes[aPlaneIter] = nil;
+  }
+  theSlot.Layout = aLayout;
+  if (aLayout == PlaneLayout_I420)
+  {
+    // colorimetry of software frames is not passed by player - follow common practice for SD and HD video
+    if (aSize.y() >= 720)
+    {
+      setColorMatrix(0.2126f, 0.0722f, theFrame.IsFullRangeYUV());
+    }
+    else
+    {
+      setColorMatrix(0.299f, 0.114f, theFrame.IsFullRangeYUV());
+    }
+  }
+  return true;
+}
+
+// =======================================================================
+// function : initPipeline
+// purpose  :
+// =======================================================================
+bool Metal_VideoTexture::initPipeline(Metal_Context* theCtx)
+{
+  if (myPipeline != nil)
+  {
+    return true;
+  }
+
+  NSError* anError = nil;
+  id<MTLLibrary> aLibrary = theCtx->LoadShaderLibrary("Metal_VideoTexture_THE_VIDEO_BACKGROUND_SHADER",
+                                                      [NSString stringWithUTF8String:THE_VIDEO_BACKGROUND_SHADER],
+                                                      nil, &anError);
+  if (aLibrary == nil)
+  {
+    theCtx->Messenger()->SendFail() << "Metal_VideoTexture: failed to compile shaders: "
+                                    << (anError != nil ? [[anError localizedDescription] UTF8String] : "");
+    return false;
+  }
+
+  MTLRenderPipelineDescriptor* aPipeDesc = [[MTLRenderPipelineDescriptor alloc] init];
+  aPipeDesc.label = @"VideoBackground";
+  aPipeDesc.vertexFunction = [aLibrary newFunctionWithName:@"videoBgVertex"];
+  aPipeDesc.fragmentFunction = [aLibrary newFunctionWithName:@"videoBgFragment"];
+  aPipeDesc.colorAttachments[0].pixelFormat = MTLPixelFormatBGRA8Unorm;
+  aPipeDesc.depthAttachmentPixelFormat = MTLPixelFormatDepth32Float;
+  myPipeline = [theCtx->Device() newRenderPipelineStateWithDescriptor:aPipeDesc error:&anError];
+  if (myPipeline == nil)
+  {
+    theCtx->Messenger()->SendFail() << "Metal_VideoTexture: failed to create background pipeline: "
+                                    << (anError != nil ? [[anError localizedDescription] UTF8String] : "");
+    return false;
+  }
+
+  for (int aSamplerIter = 0; aSamplerIter < 2; ++aSamplerIter)
+  {
+    const MTLSamplerAddressMode anAddressMode = aSamplerIter == 0 ? MTLSamplerAddressModeClampToEdge : MTLSamplerAddressModeRepeat;
+    MTLSamplerDescriptor* aSamplerDesc = [[MTLSamplerDescriptor alloc] init];
+    aSamplerDesc.minFilter = MTLSamplerMinMagFilterLinear;
+    aSamplerDesc.magFilter = MTLSamplerMinMagFilterLinear;
+    aSamplerDesc.sAddressMode = anAddressMode;
+    aSamplerDesc.tAddressMode = anAddressMode;
+    mySamplers[aSamplerIter] = [theCtx->Device() newSamplerStateWithDescriptor:aSamplerDesc];
+  }
+  return true;
+}
+
+// =======================================================================
+// function : DrawBackground
+// purpose  :
+// =======================================================================
+void Metal_VideoTexture::DrawBackground(Metal_Context* theCtx,
+                                        id<MTLRenderCommandEncoder> theEncoder,
+                                        int theWidth,
+                                        int theHeight,
+                                        Aspect_FillMethod theFill)
+{
+  if (theCtx == nullptr
+   || theEncoder == nil
+   || !IsValid()
+   || theWidth < 1
+   || theHeight < 1
+   || !initPipeline(theCtx))
+  {
+    return;
+  }
+
+  const Slot& aSlot = mySlots[myCurrent];
+  VideoBgUniforms aUniforms;
+  for (int aRowIter = 0; aRowIter < 3; ++aRowIter)
+  {
+    for (int aColIter = 0; aColIter < 4; ++aColIter)
+    {
+      aUniforms.colorMatrix[aRowIter][aColIter] = myColorMatrix[aRowIter][aColIter];
+    }
+  }
+
+  // same fill methods as textured background of Metal_View
+  const float aViewScale[2] = { float(theWidth) / float(myFrameSize.x()), float(theHeight) / float(myFrameSize.y()) };
+  aUniforms.fillMethod = theFill == Aspect_FM_TILED ? 1 : (theFill == Aspect_FM_CENTERED ? 2 : 0);
+  aUniforms.textureScale[0] = aUniforms.fillMethod != 0 ? aViewScale[0] : 1.0f;
+  aUniforms.textureScale[1] = aUniforms.fillMethod != 0 ? aViewScale[1] : 1.0f;
+  aUniforms.textureOffset[0] = 0.0f;
+  aUniforms.textureOffset[1] = 0.0f;
+  aUniforms.viewportSize[0] = float(theWidth);
+  aUniforms.viewportSize[1] = float(theHeight);
+  aUniforms.planeLayout = (int)aSlot.Layout;
+
+  [theEncoder setRenderPipelineState:myPipeline];
+  [theEncoder setFragmentBytes:&aUniforms length:sizeof(aUniforms) atIndex:0];
+  const int aNbPlanes = nbPlanes(aSlot.Layout);
+  for (int aPlaneIter = 0; aPlaneIter < 3; ++aPlaneIter)
+  {
+    // unused texture arguments are bound to the luma plane to keep argument table valid
+    [theEncoder setFragmentTexture:aSlot.Planes[aPlaneIter < aNbPlanes ? aPlaneIter : 0] atIndex:NSUInteger(aPlaneIter)];
+  }
+  [theEncoder setFragmentSamplerState:mySamplers[theFill == Aspect_FM_TILED ? 1 : 0] atIndex:0];
+  [theEncoder drawPrimitives:MTLPrimitiveTypeTriangle vertexStart:0 vertexCount:3];
+}
@@ -22,12 +22,24 @@
 #include <Graphic3d_Layer.hxx>
 #include <Graphic3d_LightSet.hxx>
 #include <Graphic3d_SequenceOfHClipPlane.hxx>
+#include <Graphic3d_WorldViewProjState.hxx>
+#include <Metal_CappingAlgo.hxx>
 #include <Metal_Caps.hxx>
 #include <Metal_Context.hxx>
+#include <Metal_DrawList.hxx>
 #include <Metal_FrameBuffer.hxx>
+#include <Metal_FrameBudget.hxx>
+#include <Metal_FrameCapture.hxx>
+#include <Metal_GpuCulling.hxx>
+#include <Metal_IdBuffer.hxx>
 #include <Metal_GraduatedTrihedron.hxx>
+#include <Metal_HiddenLineAlgo.hxx>
+#include <Metal_IndirectLayer.hxx>
+#include <Metal_PointCloudRaster.hxx>
 #include <Metal_ShadowMap.hxx>
 #include <Metal_Texture.hxx>
+#include <Metal_Upscaler.hxx>
+#include <Metal_VideoTexture.hxx>
 #include <Metal_Window.hxx>
 
 class Metal_PBREnvironment;
@@ -35,6 +47,8 @@ class Metal_PBREnvironment;
 #include <NCollection_List.hxx>
 #include <Quantity_Color.hxx>
 
+#include <atomic>
+
 #ifdef __OBJC__
 @protocol MTLTexture;
 #endif
@@ -89,6 +103,8 @@ public:
   Standard_EXPORT void Redraw() override;
 
   //! Redraw immediate content of the view.
+  //! Restores the image of non-immediate layers cached by the last Redraw() and draws only immediate
+  //! layers on top of it; falls back to Redraw() when the view has been invalidated.
   Standard_EXPORT void RedrawImmediate() override;
 
   //! Marks BVH tree for given priority list as dirty and marks primitive set for rebuild.
@@ -97,6 +113,42 @@ public:
   //! Return true if view content cache has been invalidated.
   bool IsInvalidated() override { return myBackBufferRestored == false; }
 
+  //! Keep the view invalidated after the frame being rendered, as content streamed into GPU memory
+  //! (e.g. Metal_PointCloud nodes) is still incomplete.
+  //! Thread-safe (can be called by workspaces of parallel encoding).
+  void InvalidateStreaming() { myHasPendingStreaming = true; }
+
+  //! Return compute rasterizer of point clouds for the frame being rendered,
+  //! or NULL if Metal_Caps::usePointCloudCompute is off or unsupported.
+  const occ::handle<Metal_PointCloudRaster>& PointCloudRaster() const { return myPointCloudRaster; }
+
+  //! Return TRUE if hidden line display mode computed on GPU is enabled; OFF by default.
+  bool IsHiddenLineMode() const { return myIsHiddenLineMode; }
+
+  //! Enable or disable hidden line display mode (see Metal_HiddenLineAlgo):
+  //! shaded surfaces are replaced by their visible and dashed hidden edges on the background.
+  //! This is a viewing mode only; exact HLR (HLRBRep) should still be used for export.
+  Standard_EXPORT void SetHiddenLineMode(bool theToEnable);
+
+  //! Return hidden line algorithm holding parameters of hidden line mode.
+  const occ::handle<Metal_HiddenLineAlgo>& HiddenLineAlgo() const { return myHiddenLineAlgo; }
+
+  //! Return TRUE if progressive rendering of huge scenes is enabled; OFF by default.
+  bool IsProgressiveMode() const { return myIsProgressiveMode; }
+
+  //! Enable or disable progressive rendering (see Metal_FrameBudget):
+  //! while the camera moves, frames are rendered at reduced resolution without small structures,
+  //! shadows and transparency to fit into GPU time budget; once the camera stops, the image is completed
+  //! over subsequent frames, and the view is kept invalidated until the frame of full quality is rendered.
+  //! Progressive frames are not used in hidden line mode and with capping planes.
+  Standard_EXPORT void SetProgressiveMode(bool theToEnable);
+
+  //! Return frame budget of progressive mode.
+  const Metal_FrameBudget& FrameBudget() const { return myFrameBudget; }
+
+  //! Return frame budget of progressive mode for modification.
+  Metal_FrameBudget& ChangeFrameBudget() { return myFrameBudget; }
+
   //! Dump active rendering buffer into specified memory buffer.
   Standard_EXPORT bool BufferDump(Image_PixMap& theImage,
                                   const Graphic3d_BufferType& theBufferType) override;
@@ -108,6 +160,13 @@ public:
   //! Marks BVH tree and the set of BVH primitives as outdated.
   Standard_EXPORT void InvalidateBVHData(const Graphic3d_ZLayerId theLayerId) override;
 
+  //! Marks boxes of BVH tree as outdated, so that the tree is refitted instead of being rebuilt.
+  Standard_EXPORT void InvalidateBVHBoxes(const Graphic3d_ZLayerId theLayerId) override;
+
+  //! Updates BVH data of the layer incrementally after modification of the structure.
+  Standard_EXPORT void InvalidateBVHStructure(const Graphic3d_CStructure* theStruct,
+                                              const Graphic3d_ZLayerId    theLayerId) override;
+
   //! Add a layer to the view.
   Standard_EXPORT void InsertLayerBefore(const Graphic3d_ZLayerId theNewLayerId,
                                          const Graphic3d_ZLayerSettings& theSettings,
@@ -189,6 +248,14 @@ public: //! @name Background
   Standard_EXPORT void SetBackgroundImage(const occ::handle<Graphic3d_TextureMap>& theTextureMap,
                                           bool theToUpdatePBREnv = true) override;
 
+  //! Sets video playing as background, drawn over image and gradient backgrounds;
+  //! frames decoded by VideoToolbox are sampled without copy (see Metal_VideoTexture).
+  //! NULL removes video background.
+  Standard_EXPORT void SetBackgroundVideo(const occ::handle<Graphic3d_MediaTextureSet>& theMedia);
+
+  //! Returns video background or NULL.
+  const occ::handle<Metal_VideoTexture>& BackgroundVideo() const { return myBgVideo; }
+
   //! Returns background image fill style.
   Standard_EXPORT Aspect_FillMethod BackgroundImageStyle() const override;
 
@@ -221,6 +288,38 @@ public: //! @name View Frustum Culling
   //! about current view volume and to detect which objects are overlapping it.
   const Graphic3d_CullingTool& BVHTreeSelector() const { return myBVHSelector; }
 
+public: //! @name Frame capture
+
+  //! Return streaming capture of presented frames.
+  const occ::handle<Metal_FrameCapture>& FrameCapture() const { return myFrameCapture; }
+
+  //! Set streaming capture of presented frames (NULL to stop capturing);
+  //! each Redraw() and RedrawImmediate() copies the drawable into the capture and delivers completed frames.
+  void SetFrameCapture(const occ::handle<Metal_FrameCapture>& theCapture) { myFrameCapture = theCapture; }
+
+public: //! @name GPU picking
+
+  //! Return TRUE if ID buffer is rendered after the main pass of each Redraw().
+  bool ToRenderIdBuffer() const override { return myToRenderIdBuffer; }
+
+  //! Enable or disable rendering of ID buffer.
+  Standard_EXPORT void SetToRenderIdBuffer(const bool theToRender) override;
+
+  //! Return elements visible within the rectangle of ID buffer rendered by last Redraw().
+  Standard_EXPORT bool QueryIdBuffer(const int theLeft,
+                                     const int theTop,
+                                     const int theWidth,
+                                     const int theHeight,
+                                     NCollection_Vector<Graphic3d_IdBufferSample>& theSamples) const override;
+
+public: //! @name Shadow mapping
+
+  //! Return shadow uniforms of the current frame for material shaders (NbCascades is 0 if shadows are not rendered).
+  const Metal_ShadowUniforms& ShadowUniforms() const { return myShadowUniforms; }
+
+  //! Return shadow map to be bound to material shaders in the current frame.
+  const occ::handle<Metal_ShadowMap>& ActiveShadowMap() const { return myActiveShadowMap; }
+
 public: //! @name Diagnostics
 
   //! Fill in the dictionary with diagnostic info.
@@ -254,18 +353,101 @@ private: //! @name Structure management (required by Graphic3d_CView)
 
 private: //! @name Internal rendering helpers
 
-  //! Render all displayed structures.
-  void renderStructures(Metal_Workspace* theWorkspace);
+  //! Render displayed structures of either normal or immediate layers.
+  //! @param theWorkspace       workspace with active render encoder
+  //! @param theToDrawImmediate when TRUE, only immediate layers are rendered, otherwise only non-immediate
+  void renderStructures(Metal_Workspace* theWorkspace, bool theToDrawImmediate);
+
+  //! Render visible structures of the opaque layer with draws sorted by render state (see Metal_DrawList);
+  //! structures which cannot be sorted are rendered afterwards in normal way.
+  void renderLayerSorted(Metal_Workspace* theWorkspace,
+                         const Graphic3d_Layer& theLayer,
+                         const NCollection_Mat4<float>& theBaseModelMatrix);
+
+  //! Update culling state of structures within normal or immediate layers
+  //! (frustum, distance and size culling according to Graphic3d_RenderingParams::FrustumCullingState).
+  void updateCulling(bool theToDrawImmediate);
+
+  //! Setup camera, pipeline state and lights of the workspace for rendering the scene.
+  void prepareWorkspace(Metal_Workspace* theWorkspace);
+
+  //! Return TRUE if some immediate layer has structures to draw.
+  bool hasImmediateStructures() const;
+
+  //! Encode pass drawing immediate layers on top of the target and current depth buffer.
+  //! @param theCmdBuffer command buffer (id<MTLCommandBuffer>)
+  //! @param theTarget    color texture (id<MTLTexture>)
+  void renderImmediate(void* theCmdBuffer, void* theTarget, int theWidth, int theHeight);
+
+  //! Copy color of the target and depth buffer into the cache of non-immediate layers or back.
+  //! @param theCmdBuffer command buffer (id<MTLCommandBuffer>)
+  //! @param theTarget    color texture (id<MTLTexture>)
+  //! @param theToSave    when TRUE, target is copied into the cache, otherwise cache is restored
+  //! @return FALSE if cache is invalid or cannot be allocated
+  bool copyImmediateCache(void* theCmdBuffer, void* theTarget, int theWidth, int theHeight, bool theToSave);
+
+  //! Encode main pass (background, displayed structures and graduated trihedron)
+  //! by OSD_ThreadPool workers into sub-encoders of MTLParallelRenderCommandEncoder,
+  //! each worker using own Metal_Workspace; structures not safe for worker threads
+  //! (texts, stencil test, instancing) are encoded by the calling thread.
+  //! @param theCmdBuffer      command buffer (id<MTLCommandBuffer>)
+  //! @param theRenderPassDesc main pass descriptor (MTLRenderPassDescriptor*)
+  //! @return FALSE if scene is too small for parallel encoding and nothing has been encoded
+  bool renderStructuresParallel(void* theCmdBuffer, void* theRenderPassDesc, int theWidth, int theHeight);
 
   //! Initialize or resize the depth buffer.
   void initDepthBuffer(int theWidth, int theHeight);
 
+  //! Apply frame pacing options of Metal_Caps to the window and choose the number of frames in flight
+  //! for the next Metal_Context::WaitForFrame(); returns start time of the frame for measuring latency.
+  double updateFramePacing();
+
+  //! Present the drawable (if any) and commit the frame command buffer.
+  //! Registers presentation timing feedback of the drawable in Metal_FrameStats.
+  //! @param theCmdBuffer  command buffer (id<MTLCommandBuffer>)
+  //! @param theDrawable   drawable (id<CAMetalDrawable>) or NULL for offscreen target
+  //! @param theStartTime  start time of the frame returned by updateFramePacing()
+  void commitFrame(void* theCmdBuffer, void* theDrawable, double theStartTime);
+
+  //! Return color texture (id<MTLTexture>) of offscreen frame target:
+  //! FBO set by SetFBO(), or own framebuffer sized by a headless window (see Metal_Window::IsOffscreen());
+  //! NULL if frame should be rendered into the next drawable of the window.
+  void* offscreenTarget();
+
+  //! Encode next step of pending PBR environment baking into the frame command buffer,
+  //! and make it active once it is completed by GPU.
+  //! @param theCmdBuffer command buffer (id<MTLCommandBuffer>)
+  void updatePBREnvironment(void* theCmdBuffer);
+
+  //! Find the first shadow casting directional light, update cascades of its shadow map
+  //! and encode depth passes of modified cascades before the main pass.
+  //! @param theCmdBuffer command buffer (id<MTLCommandBuffer>)
+  void updateShadowMaps(void* theCmdBuffer);
+
+  //! Mark structures of normal layers outside of the size band of progressive frame as culled
+  //! (see Metal_FrameBudget::SizeThreshold() and Metal_FrameBudget::RefinedSize());
+  //! should be called after updateCulling(), the marks are reverted by restoreBudgetCulling().
+  void updateBudgetCulling();
+
+  //! Revert culling marks of structures skipped by updateBudgetCulling().
+  void restoreBudgetCulling();
+
+  //! Mark structures displayed by the view as used within residency manager
+  //! and release buffers of idle structures when GPU memory exceeds the budget.
+  void updateResidency();
+
+  //! Return camera projection matrix, jittered by upscaler while encoding main pass of reduced resolution.
+  NCollection_Mat4<float> mainProjectionMatrix() const;
+
   //! Draw gradient background.
   void drawGradientBackground(void* theEncoder, int theWidth, int theHeight);
 
   //! Draw textured background.
   void drawTexturedBackground(void* theEncoder, int theWidth, int theHeight);
 
+  //! Present the next video frame and draw video background; returns FALSE if there is no frame to draw.
+  bool drawVideoBackground(void* theEncoder, int theWidth, int theHeight);
+
 protected:
 
   const Metal_GraphicDriver*        myDriver;          //!< Graphic driver
@@ -280,6 +462,8 @@ protected:
   // Framebuffer support
   occ::handle<Metal_FrameBuffer>    myFBO;             //!< Current FBO for offscreen rendering
   occ::handle<Metal_FrameBuffer>    myMainFBO;         //!< Main scene FBO (for MSAA)
+  occ::handle<Metal_FrameBuffer>    myImmediateCacheFBO; //!< color and depth of non-immediate layers restored by RedrawImmediate()
+  occ::handle<Metal_FrameBuffer>    myOffscreenFBO;    //!< frame target of a headless window
 
   // Gradient background
   Quantity_Color                    myBgGradientFrom;   //!< Gradient start color
@@ -288,24 +472,51 @@ protected:
 
   Aspect_FillMethod                 myBgImageStyle;    //!< Background image style
   occ::handle<Metal_Texture>        myBgTexture;       //!< Background texture
+  occ::handle<Metal_VideoTexture>   myBgVideo;         //!< Background video
   occ::handle<Metal_Texture>        myEnvCubemap;      //!< Environment cubemap texture
+  TCollection_AsciiString           myEnvTextureId;    //!< id of source environment texture
 
   // IBL (Image-Based Lighting)
   occ::handle<Metal_PBREnvironment> myPBREnvironment;  //!< PBR environment for IBL
+  occ::handle<Metal_PBREnvironment> myPBREnvPending;   //!< PBR environment being baked, replaces active one once completed
+  NCollection_DataMap<TCollection_AsciiString, occ::handle<Metal_PBREnvironment>> myPBREnvCache; //!< baked environments by source texture id
   bool                              myIBLEnabled;      //!< IBL enabled flag
 
   // Shadow mapping
   NCollection_Sequence<occ::handle<Metal_ShadowMap>> myShadowMaps; //!< Shadow maps for lights
+  occ::handle<Metal_ShadowMap>      myActiveShadowMap; //!< shadow map bound to material shaders (single-texel one without shadows)
+  Metal_ShadowUniforms              myShadowUniforms;  //!< shadow uniforms of the current frame
 
   // Layer management
   NCollection_List<occ::handle<Graphic3d_Layer>> myLayers; //!< Z-layers (ordered list)
   NCollection_DataMap<Graphic3d_ZLayerId, occ::handle<Graphic3d_Layer>> myLayerMap; //!< Layer lookup map
   int                               myZLayerMax;        //!< Maximum Z-layer ID
+  NCollection_DataMap<Graphic3d_ZLayerId, occ::handle<Metal_IndirectLayer>> myIndirectLayers; //!< recorded commands of static layers
+  occ::handle<Metal_GpuCulling>     myGpuCulling;       //!< GPU culling of recorded static layers
+  occ::handle<Metal_IdBuffer>       myIdBuffer;         //!< ID buffer for GPU picking
+  bool                              myToRenderIdBuffer; //!< render ID buffer after the main pass
+  occ::handle<Metal_CappingAlgo>    myCappingAlgo;      //!< single-pass section caps of view clipping planes
+  occ::handle<Metal_PointCloudRaster> myPointCloudRaster; //!< compute rasterizer of point clouds
+  occ::handle<Metal_HiddenLineAlgo> myHiddenLineAlgo;   //!< hidden line image drawn over the main pass
+  bool                              myIsHiddenLineMode; //!< hidden line display mode
+  occ::handle<Metal_FrameCapture>   myFrameCapture;     //!< streaming capture of presented frames
+  Metal_DrawList                    myDrawList;         //!< draw list sorting opaque layers by state
+  occ::handle<Metal_Upscaler>       myUpscaler;         //!< upscaler of main pass rendered with RenderResolutionScale < 1
+  bool                              myIsUpscaledPass;   //!< main pass is being encoded into upscaler textures
+  Metal_FrameBudget                 myFrameBudget;      //!< frame budget of progressive mode
+  Graphic3d_WorldViewProjState      myProgressiveCamState; //!< camera state of the last progressive frame
+  NCollection_Vector<const Graphic3d_CStructure*> myBudgetCulled; //!< structures skipped by the frame budget
+  bool                              myIsProgressiveMode; //!< progressive rendering mode
+  bool                              myIsIncrementalPass; //!< main pass draws band of structures over the image of previous frame
+  bool                              myIsReducedPass;     //!< main pass of progressive mode skips shadows and transparency
 
   // Frame state
   bool                              myBackBufferRestored; //!< Back buffer restored flag
   bool                              myToDrawImmediate;    //!< Draw immediate structures flag
+  bool                              myIsImmediateCached;  //!< Immediate cache FBO holds image of last Redraw()
+  std::atomic<bool>                 myHasPendingStreaming; //!< streamed content of the last frame is incomplete
   int                               myFrameCounter;       //!< Frame counter
+  double                            myCpuFrameTime;       //!< CPU time of encoding the last frame in seconds
 
   // Depth buffer
 #ifdef __OBJC__
@@ -315,6 +526,8 @@ protected:
 #endif
   int                               myDepthWidth;         //!< Depth texture width
   int                               myDepthHeight;        //!< Depth texture height
+  bool                              myIsDepthMemoryless;  //!< Depth texture lives in tile memory only
+  bool                              myToStoreDepth;       //!< Depth is read after the main pass (sticky)
 
   // View frustum culling
   Graphic3d_CullingTool             myBVHSelector;        //!< Selector for BVH tree frustum culling
@@ -15,22 +15,213 @@
 #import <TargetConditionals.h>
 #import <Metal/Metal.h>
 #import <QuartzCore/CAMetalLayer.h>
+#import <QuartzCore/CABase.h>
 
 // Now include OCCT headers
 #include <Metal_View.hxx>
 #include <Metal_GraphicDriver.hxx>
 #include "Metal_PBREnvironment.hxx"
 #include <Metal_Structure.hxx>
+#include <Metal_ShaderManager.hxx>
+#include <Metal_Signpost.hxx>
+#include <Metal_SparseTexture.hxx>
 #include <Metal_Workspace.hxx>
 #include <Metal_FrameBuffer.hxx>
+#include <Metal_FrameStats.hxx>
+#include <Metal_Group.hxx>
 #include <Bnd_Box.hxx>
 #include <BVH_LinearBuilder.hxx>
 #include <Graphic3d_Structure.hxx>
 #include <Image_PixMap.hxx>
 #include <Message.hxx>
+#include <OSD_ThreadPool.hxx>
+#include <OSD_TraceZone.hxx>
 
 IMPLEMENT_STANDARD_RTTIEXT(Metal_View, Graphic3d_CView)
 
+namespace
+{
+  //! Minimal number of structures encoded by one worker of parallel encoding.
+  static const int THE_MIN_STRUCTURES_PER_CHUNK = 8;
+
+  //! Maximal number of baked PBR environments kept for switching between environment textures.
+  static const int THE_PBR_ENV_CACHE_SIZE = 4;
+
+  //! Element of the main pass: recorded static layer or a single structure.
+  struct EncodeItem
+  {
+    const Graphic3d_Layer*      Layer;     //!< layer replayed from indirect command buffers
+    Metal_IndirectLayer*        Indirect;  //!< recorded commands of the layer
+    const Metal_Structure*      Structure; //!< structure to render
+    bool                        IsSerial;  //!< item cannot be encoded by worker thread
+  };
+
+  //! Range of items encoded into one sub-encoder of parallel render encoder.
+  struct EncodeChunk
+  {
+    int  Lower;    //!< first item
+    int  Upper;    //!< last item (inclusive)
+    bool IsSerial; //!< chunk should be encoded by the calling thread
+  };
+
+  //! Return TRUE if structure can be encoded by worker thread.
+  //! Texts update shared font cache, stencil test state is created lazily,
+  //! instanced structures share primitive arrays (initialized lazily) with another structure,
+  //! and B-spline surfaces share lazily created resources of the tessellation controller.
+  static bool isParallelEncodable(const Metal_Structure* theStruct)
+  {
+    if (theStruct->InstancedStructure() != nullptr)
+    {
+      return false;
+    }
+    for (NCollection_Sequence<occ::handle<Graphic3d_Group>>::Iterator aGroupIter(theStruct->Groups());
+         aGroupIter.More(); aGroupIter.Next())
+    {
+      const Metal_Group* aGroup = dynamic_cast<const Metal_Group*>(aGroupIter.Value().get());
+      if (aGroup != nullptr
+       && (aGroup->HasTexts() || aGroup->HasBSplineSurfaces() || aGroup->IsStencilTestEnabled()))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  //! Render single structure with the model matrix relative to base one.
+  static void renderStructure(Metal_Workspace* theWorkspace,
+                              const Metal_Structure* theStruct,
+                              const NCollection_Mat4<float>& theBaseModelMatrix)
+  {
+    // Skip structure entirely clipped, and pass only planes crossing it
+    if (!theWorkspace->SetStructureClipping(theStruct))
+    {
+      theWorkspace->ResetStructureClipping();
+      return;
+    }
+
+    // Restore base model matrix and apply structure transformation
+    NCollection_Mat4<float> aModelMatrix = theBaseModelMatrix;
+    const NCollection_Mat4<float>& aStructTrsf = theStruct->RenderTransformation();
+    aModelMatrix = aModelMatrix * aStructTrsf;
+    theWorkspace->SetModelMatrix(aModelMatrix);
+
+    // Check for highlighting
+    if (theStruct->highlight != 0)
+    {
+      theWorkspace->SetHighlighting(true);
+      const occ::handle<Graphic3d_PresentationAttributes>& aHighStyle = theStruct->HighlightStyle();
+      if (!aHighStyle.IsNull())
+      {
+        theWorkspace->SetHighlightColor(aHighStyle->ColorRGBA());
+      }
+    }
+
+    // Apply per-structure uniforms before rendering;
+    // lighting is bound once per encoder and materials are bound by groups
+    theWorkspace->ApplyUniforms();
+
+    // Render the structure (cast away const as Render is non-const in design)
+    const_cast<Metal_Structure*>(theStruct)->Render(theWorkspace);
+
+    // Reset highlighting
+    theWorkspace->SetHighlighting(false);
+    theWorkspace->ResetStructureClipping();
+  }
+
+  //! Return TRUE if structure should be skipped according to the culling results
+  //! of Graphic3d_Layer::UpdateCulling() and view affinity.
+  static bool isStructureHidden(const Graphic3d_CStructure* theStruct, int theViewId)
+  {
+    return theStruct == nullptr
+        || theStruct->IsCulled()
+        || !theStruct->IsVisible(theViewId);
+  }
+
+  //! Render visible structures of the layer by priority (lower priority first).
+  static void renderLayerStructures(Metal_Workspace* theWorkspace,
+                                    const Graphic3d_Layer& theLayer,
+                                    const NCollection_Mat4<float>& theBaseModelMatrix)
+  {
+    if (theLayer.IsCulled())
+    {
+      return;
+    }
+
+    const int aViewId = theWorkspace->View()->Identification();
+    const Graphic3d_ArrayOfIndexedMapOfStructure& aStructArray = theLayer.ArrayOfStructures();
+    for (int aPriorityIdx = 0; aPriorityIdx < Graphic3d_DisplayPriority_NB; ++aPriorityIdx)
+    {
+      const NCollection_IndexedMap<const Graphic3d_CStructure*>& aStructMap = aStructArray[aPriorityIdx];
+      for (int aStructIdx = 1; aStructIdx <= aStructMap.Extent(); ++aStructIdx)
+      {
+        const Graphic3d_CStructure* aCStruct = aStructMap.FindKey(aStructIdx);
+        if (isStructureHidden(aCStruct, aViewId))
+        {
+          continue;
+        }
+
+        // all structures of the view are created by Metal_GraphicDriver
+        renderStructure(theWorkspace, static_cast<const Metal_Structure*>(aCStruct), theBaseModelMatrix);
+      }
+    }
+  }
+
+  //! Encode the range of main pass items.
+  static void encodeItems(Metal_Workspace* theWorkspace,
+                          const NCollection_Vector<EncodeItem>& theItems,
+                          const EncodeChunk& theChunk)
+  {
+    const NCollection_Mat4<float> aBaseModelMatrix = theWorkspace->ModelMatrix();
+    for (int anItemIter = theChunk.Lower; anItemIter <= theChunk.Upper; ++anItemIter)
+    {
+      const EncodeItem& anItem = theItems.Value(anItemIter);
+      if (anItem.Structure != nullptr)
+      {
+        renderStructure(theWorkspace, anItem.Structure, aBaseModelMatrix);
+      }
+      else if (!anItem.Indirect->Render(theWorkspace, *anItem.Layer))
+      {
+        renderLayerStructures(theWorkspace, *anItem.Layer, aBaseModelMatrix);
+      }
+    }
+    theWorkspace->SetModelMatrix(aBaseModelMatrix);
+  }
+
+  //! Functor encoding parallel chunks by OSD_ThreadPool workers.
+  class EncodeFunctor
+  {
+  public:
+    EncodeFunctor(const NCollection_Vector<EncodeItem>& theItems,
+                  const NCollection_Vector<EncodeChunk>& theChunks,
+                  const NCollection_Vector<int>& theParallelChunks,
+                  const NCollection_Vector<occ::handle<Metal_Workspace>>& theWorkspaces)
+    : myItems(theItems),
+      myChunks(theChunks),
+      myParallelChunks(theParallelChunks),
+      myWorkspaces(theWorkspaces)
+    {
+    }
+
+    void operator()(int theThreadIndex, int theTaskIndex) const
+    {
+      (void)theThreadIndex;
+      const int aChunkIndex = myParallelChunks.Value(theTaskIndex);
+      @autoreleasepool
+      {
+        const occ::handle<Metal_Workspace>& aWorkspace = myWorkspaces.Value(aChunkIndex);
+        encodeItems(aWorkspace.get(), myItems, myChunks.Value(aChunkIndex));
+        [aWorkspace->ActiveEncoder() endEncoding];
+      }
+    }
+
+  private:
+    const NCollection_Vector<EncodeItem>&                  myItems;
+    const NCollection_Vector<EncodeChunk>&                 myChunks;
+    const NCollection_Vector<int>&                         myParallelChunks;
+    const NCollection_Vector<occ::handle<Metal_Workspace>>& myWorkspaces;
+  };
+}
+
 // =======================================================================
 // function : Metal_View
 // purpose  : Constructor
@@ -49,18 +240,32 @@ Metal_View::Metal_View(const occ::handle<Graphic3d_StructureManager>& theMgr,
   myBgImageStyle(Aspect_FM_CENTERED),
   myIBLEnabled(false),
   myZLayerMax(0),
+  myToRenderIdBuffer(false),
+  myIsHiddenLineMode(false),
+  myIsUpscaledPass(false),
+  myIsProgressiveMode(false),
+  myIsIncrementalPass(false),
+  myIsReducedPass(false),
   myBackBufferRestored(false),
   myToDrawImmediate(false),
+  myIsImmediateCached(false),
+  myHasPendingStreaming(false),
   myFrameCounter(0),
+  myCpuFrameTime(0.0),
   myDepthTexture(nil),
   myDepthWidth(0),
   myDepthHeight(0),
+  myIsDepthMemoryless(false),
+  myToStoreDepth(false),
   myToShowGradTrihedron(false),
   myGradTrihedronMin(0.0f, 0.0f, 0.0f),
   myGradTrihedronMax(100.0f, 100.0f, 100.0f)
 {
   myLights = new Graphic3d_LightSet();
   myClipPlanes = new Graphic3d_SequenceOfHClipPlane();
+  myHiddenLineAlgo = new Metal_HiddenLineAlgo();
+  memset(&myShadowUniforms, 0, sizeof(myShadowUniforms));
+  myShadowUniforms.LightIndex = -1;
 }
 
 // =======================================================================
@@ -92,6 +297,17 @@ void Metal_View::ReleaseGlResources(Metal_Context* theCtx)
     myMainFBO->Release(theCtx);
     myMainFBO.Nullify();
   }
+  if (!myImmediateCacheFBO.IsNull())
+  {
+    myImmediateCacheFBO->Release(theCtx);
+    myImmediateCacheFBO.Nullify();
+  }
+  if (!myOffscreenFBO.IsNull())
+  {
+    myOffscreenFBO->Release(theCtx);
+    myOffscreenFBO.Nullify();
+  }
+  myIsImmediateCached = false;
 
   // Release depth texture
   myDepthTexture = nil;
@@ -101,6 +317,64 @@ void Metal_View::ReleaseGlResources(Metal_Context* theCtx)
   // Release graduated trihedron
   myGraduatedTrihedron.Release(theCtx);
 
+  // Release video background frames
+  if (!myBgVideo.IsNull())
+  {
+    myBgVideo->Release(theCtx);
+  }
+
+  // Release instance buffers of sorted draws
+  myDrawList.Release();
+
+  // Release recorded commands of static layers
+  myIndirectLayers.Clear();
+  if (!myGpuCulling.IsNull())
+  {
+    myGpuCulling->Release(theCtx);
+    myGpuCulling.Nullify();
+  }
+  if (!myIdBuffer.IsNull())
+  {
+    myIdBuffer->Release(theCtx);
+    myIdBuffer.Nullify();
+  }
+  if (!myCappingAlgo.IsNull())
+  {
+    myCappingAlgo->Release(theCtx);
+    myCappingAlgo.Nullify();
+  }
+  if (!myPointCloudRaster.IsNull())
+  {
+    myPointCloudRaster->Release(theCtx);
+    myPointCloudRaster.Nullify();
+  }
+  if (!myHiddenLineAlgo.IsNull())
+  {
+    myHiddenLineAlgo->Release(theCtx);
+  }
+  if (!myUpscaler.IsNull())
+  {
+    myUpscaler->Release();
+    myUpscaler.Nullify();
+  }
+
+  // Release shadow maps
+  for (NCollection_Sequence<occ::handle<Metal_ShadowMap>>::Iterator aShadowIter(myShadowMaps); aShadowIter.More(); aShadowIter.Next())
+  {
+    aShadowIter.Value()->Release(theCtx);
+  }
+  myShadowMaps.Clear();
+  if (!myActiveShadowMap.IsNull())
+  {
+    myActiveShadowMap->Release(theCtx);
+    myActiveShadowMap.Nullify();
+  }
+
+  // Release baked PBR environments
+  myPBREnvironment.Nullify();
+  myPBREnvPending.Nullify();
+  myPBREnvCache.Clear();
+
   // Release window
   myWindow.Nullify();
 }
@@ -182,28 +456,99 @@ void Metal_View::Resized()
   }
 }
 
+// =======================================================================
+// function : SetHiddenLineMode
+// purpose  : Enable or disable hidden line display mode
+// =======================================================================
+void Metal_View::SetHiddenLineMode(bool theToEnable)
+{
+  if (myIsHiddenLineMode == theToEnable)
+  {
+    return;
+  }
+
+  myIsHiddenLineMode = theToEnable;
+  if (!theToEnable)
+  {
+    // edges are extracted again when the mode is turned back on
+    myHiddenLineAlgo->Release(myContext.get());
+  }
+  myBackBufferRestored = false;
+}
+
+// =======================================================================
+// function : SetProgressiveMode
+// purpose  : Enable or disable progressive rendering
+// =======================================================================
+void Metal_View::SetProgressiveMode(bool theToEnable)
+{
+  if (myIsProgressiveMode == theToEnable)
+  {
+    return;
+  }
+
+  myIsProgressiveMode = theToEnable;
+  myFrameBudget.Reset();
+  myProgressiveCamState = Graphic3d_WorldViewProjState();
+  myBackBufferRestored = false;
+}
+
 // =======================================================================
 // function : Redraw
 // purpose  : Redraw content of the view
 // =======================================================================
 void Metal_View::Redraw()
 {
-  if (myWindow.IsNull() || myContext.IsNull() || !myContext->IsValid())
+  OSD_TRACE_ZONE_CATEGORY("Metal_View::Redraw", "render");
+  if ((myWindow.IsNull() && myFBO.IsNull())
+   || myContext.IsNull() || !myContext->IsValid())
   {
     return;
   }
 
   ++myFrameCounter;
+  Metal_Signpost aFrameSignpost("Redraw");
 
-  // Wait for previous frame to complete (triple-buffering)
+  // Wait for previous frame to complete (triple-buffering, or a single frame with low-latency pacing)
+  const double aFrameStartTime = updateFramePacing();
+  Metal_Signpost aWaitSignpost("Wait frame");
   myContext->WaitForFrame();
+  aWaitSignpost.End();
+  const double anEncodeStartTime = CACurrentMediaTime();
+
+  const occ::handle<Metal_FrameStats>& aFrameStats = myContext->FrameStats();
+  const occ::handle<Metal_GpuTimer>& aGpuTimer = myContext->GpuTimer();
+  if (!aFrameStats.IsNull())
+  {
+    aFrameStats->FrameStart(this, false);
+    aFrameStats->ResetStateChanges();
+  }
+  if (!aGpuTimer.IsNull())
+  {
+    // frame budget of progressive mode is controlled by GPU time of the main pass
+    aGpuTimer->SetActive((myRenderParams.CollectedStats & Graphic3d_RenderingParams::PerfCounters_FrameTime) != 0
+                      || myIsProgressiveMode);
+  }
 
-  // Get next drawable from the Metal layer
-  id<CAMetalDrawable> aDrawable = myWindow->NextDrawable();
-  if (aDrawable == nil)
+  // Render into offscreen target, or into next drawable from the Metal layer;
+  // nextDrawable blocks while all drawables of the layer are queued for display, so that the drawable
+  // is acquired only by the first pass writing into it - after PBR baking, GPU culling and shadow maps
+  id<CAMetalDrawable> aDrawable = nil;
+  id<MTLTexture> aTarget = (__bridge id<MTLTexture>)offscreenTarget();
+  if (aTarget == nil
+   && (myWindow.IsNull() || myWindow->MetalLayer() == nil))
   {
     return;
   }
+  const auto acquireTarget = [&]() -> bool
+  {
+    if (aTarget == nil)
+    {
+      aDrawable = myWindow->NextDrawable();
+      aTarget = aDrawable != nil ? aDrawable.texture : nil;
+    }
+    return aTarget != nil;
+  };
 
   // Get or create command buffer for this frame
   id<MTLCommandBuffer> aCommandBuffer = myContext->CurrentCommandBuffer();
@@ -211,18 +556,206 @@ void Metal_View::Redraw()
   {
     return;
   }
+  if (!aGpuTimer.IsNull())
+  {
+    aGpuTimer->AttachFrame(aCommandBuffer);
+  }
+
+  // Release buffers of structures not displayed for a while when over GPU memory budget,
+  // so that compaction below can free emptied heap blocks
+  updateResidency();
+
+  // Move buffers out of sparsely filled heap blocks before encoding the frame
+  if (!myContext->BufferAllocator().IsNull())
+  {
+    myContext->BufferAllocator()->Compact(myContext.get());
+  }
+
+  // Advance pending PBR environment baking by one step per frame
+  updatePBREnvironment((__bridge void*)aCommandBuffer);
+
+  // Clipping planes of the view are shared by all workspaces of the frame
+  const bool toCap = !myClipPlanes.IsNull()
+                  && Metal_CappingAlgo::HasCapping(*myClipPlanes);
+  if (myContext->ShaderManager() != nullptr && !myClipPlanes.IsNull())
+  {
+    myContext->ShaderManager()->UpdateClippingPlanes(*myClipPlanes);
+  }
+
+  // Point clouds are queued into compute rasterizer while encoding the main pass
+  myHasPendingStreaming = false;
+  if (myContext->Caps()->usePointCloudCompute
+   && Metal_PointCloudRaster::IsSupported(myContext.get()))
+  {
+    if (myPointCloudRaster.IsNull())
+    {
+      myPointCloudRaster = new Metal_PointCloudRaster();
+    }
+  }
+  else if (!myPointCloudRaster.IsNull())
+  {
+    myPointCloudRaster->Release(myContext.get());
+    myPointCloudRaster.Nullify();
+  }
 
-  // Ensure we have a depth buffer
-  int aWidth = (int)aDrawable.texture.width;
-  int aHeight = (int)aDrawable.texture.height;
+  // Ensure we have a depth buffer;
+  // depth is read after the main pass by immediate layers, by depth pyramid of GPU occlusion culling,
+  // by section caps, by point cloud rasterizer and by hidden line mode
+  if (hasImmediateStructures()
+   || myContext->Caps()->useGpuCulling
+   || toCap
+   || !myPointCloudRaster.IsNull()
+   || myIsHiddenLineMode
+   || myIsProgressiveMode)
+  {
+    myToStoreDepth = true;
+  }
+  // drawable has the size of the layer, see Metal_Window::Resize()
+  const int aWidth  = aTarget != nil ? (int)aTarget.width  : myWindow->Width();
+  const int aHeight = aTarget != nil ? (int)aTarget.height : myWindow->Height();
+  const MTLPixelFormat aTargetFormat = aTarget != nil ? aTarget.pixelFormat : (MTLPixelFormat)myWindow->ColorPixelFormat();
   initDepthBuffer(aWidth, aHeight);
 
+  // Choose quality of the frame in progressive mode from camera motion and GPU time of the main pass
+  Metal_FrameBudget::Phase aPhase = Metal_FrameBudget::Phase_Full;
+  myIsIncrementalPass = false;
+  if (myIsProgressiveMode
+  && !myCamera.IsNull()
+  && !myIsHiddenLineMode
+  && !toCap)
+  {
+    const Graphic3d_WorldViewProjState aCamState = myCamera->WorldViewProjState();
+    const bool isCameraMoved = aCamState != myProgressiveCamState;
+    myProgressiveCamState = aCamState;
+    aPhase = myFrameBudget.NextFrame(isCameraMoved,
+                                     !aFrameStats.IsNull() ? aFrameStats->GpuPassTime(Graphic3d_FrameStatsTimer_GpuMainPass) : 0.0);
+
+    // smaller structures are added over the image of previous frame kept by immediate cache
+    myIsIncrementalPass = myFrameBudget.IsIncremental();
+    if (myIsIncrementalPass
+     && (!myIsImmediateCached
+      || myIsDepthMemoryless
+      || myImmediateCacheFBO.IsNull()
+      || myImmediateCacheFBO->GetSizeX() != aWidth
+      || myImmediateCacheFBO->GetSizeY() != aHeight))
+    {
+      myFrameBudget.Reset();
+      aPhase = Metal_FrameBudget::Phase_Full;
+      myIsIncrementalPass = false;
+    }
+  }
+  else
+  {
+    myFrameBudget.Reset();
+  }
+  myIsReducedPass = aPhase != Metal_FrameBudget::Phase_Full;
+
+  // Render main pass at reduced resolution into upscaler textures, to be upscaled into target afterwards;
+  // interactive frames of progressive mode are rendered at further reduced resolution
+  float aResScale = std::max(std::min(myRenderParams.RenderResolutionScale, 1.0f), 0.1f);
+  if (aPhase == Metal_FrameBudget::Phase_Interactive)
+  {
+    aResScale = std::max(aResScale * myFrameBudget.InteractiveResolutionScale(), 0.1f);
+  }
+  const NCollection_Vec2<int> aRenderSize(std::max(int(aWidth  * aResScale + 0.5f), 1),
+                                          std::max(int(aHeight * aResScale + 0.5f), 1));
+  myIsUpscaledPass = false;
+  if (myIsIncrementalPass)
+  {
+    // band of structures is drawn at full resolution over the upscaled image
+  }
+  else if (aRenderSize.x() < aWidth || aRenderSize.y() < aHeight)
+  {
+    if (myUpscaler.IsNull())
+    {
+      myUpscaler = new Metal_Upscaler();
+    }
+    myIsUpscaledPass = myUpscaler->Init(myContext.get(), myRenderParams.UpscalingMethod,
+                                        aRenderSize, NCollection_Vec2<int>(aWidth, aHeight), aTargetFormat);
+    if (myIsUpscaledPass)
+    {
+      myUpscaler->NextFrame();
+    }
+  }
+  else if (!myUpscaler.IsNull())
+  {
+    myUpscaler->Release();
+    myUpscaler.Nullify();
+  }
+  id<MTLTexture> aMainDepth  = myIsUpscaledPass ? myUpscaler->DepthTexture() : myDepthTexture;
+  const int aMainWidth  = myIsUpscaledPass ? aRenderSize.x() : aWidth;
+  const int aMainHeight = myIsUpscaledPass ? aRenderSize.y() : aHeight;
+  const NCollection_Mat4<float> aViewProj = !myCamera.IsNull()
+                                          ? myCamera->ProjectionMatrixF() * myCamera->OrientationMatrixF()
+                                          : NCollection_Mat4<float>();
+
+  // Cull recorded static layers on GPU before the render pass
+  const bool toCullOnGpu = myContext->Caps()->useIndirectCommandBuffers
+                        && myContext->Caps()->useGpuCulling
+                        && myContext->HasIndirectCommandBuffers()
+                        && !myCamera.IsNull()
+                        && !myIsIncrementalPass;
+  if (toCullOnGpu)
+  {
+    if (myGpuCulling.IsNull())
+    {
+      myGpuCulling = new Metal_GpuCulling();
+      myGpuCulling->Init(myContext.get());
+    }
+    if (myGpuCulling->IsValid())
+    {
+      for (NCollection_DataMap<Graphic3d_ZLayerId, occ::handle<Metal_IndirectLayer>>::Iterator aLayerIter(myIndirectLayers);
+           aLayerIter.More(); aLayerIter.Next())
+      {
+        myGpuCulling->Cull(myContext.get(), aCommandBuffer, *aLayerIter.Value(), aViewProj, aMainWidth, aMainHeight);
+      }
+    }
+  }
+
+  // Render modified cascades of shadow map before the main pass; reduced frames are drawn without shadows
+  if (!myIsReducedPass)
+  {
+    updateShadowMaps((__bridge void*)aCommandBuffer);
+  }
+  else
+  {
+    memset(&myShadowUniforms, 0, sizeof(myShadowUniforms));
+    myShadowUniforms.LightIndex = -1;
+    if (myActiveShadowMap.IsNull())
+    {
+      myActiveShadowMap = new Metal_ShadowMap(myContext.get(), 1, 1);
+    }
+  }
+
+  // map streamed tiles of background image accessed by the previous frame of this slot
+  Metal_SparseTexture* aSparseBg = dynamic_cast<Metal_SparseTexture*>(myBgTexture.get());
+  if (aSparseBg != nullptr)
+  {
+    aSparseBg->BeginFrame(myContext.get(), (__bridge void*)aCommandBuffer);
+  }
+
+  // main pass writes into drawable unless it is upscaled afterwards
+  if (!myIsUpscaledPass
+   && !acquireTarget())
+  {
+    return;
+  }
+  id<MTLTexture> aMainTarget = myIsUpscaledPass ? myUpscaler->ColorTexture() : aTarget;
+
+  // restore image of previous frame for incremental pass, or draw all structures above the threshold
+  if (myIsIncrementalPass
+  && !copyImmediateCache((__bridge void*)aCommandBuffer, (__bridge void*)aTarget, aWidth, aHeight, false))
+  {
+    myIsIncrementalPass = false;
+  }
+  const MTLLoadAction aLoadAction = myIsIncrementalPass ? MTLLoadActionLoad : MTLLoadActionClear;
+
   // Create render pass descriptor
   MTLRenderPassDescriptor* aRenderPassDesc = [MTLRenderPassDescriptor renderPassDescriptor];
 
   // Configure color attachment (clear to background color)
-  aRenderPassDesc.colorAttachments[0].texture = aDrawable.texture;
-  aRenderPassDesc.colorAttachments[0].loadAction = MTLLoadActionClear;
+  aRenderPassDesc.colorAttachments[0].texture = aMainTarget;
+  aRenderPassDesc.colorAttachments[0].loadAction = aLoadAction;
   aRenderPassDesc.colorAttachments[0].storeAction = MTLStoreActionStore;
 
   // Get background color (convert from Quantity_ColorRGBA to Metal clear color)
@@ -230,111 +763,229 @@ void Metal_View::Redraw()
   aRenderPassDesc.colorAttachments[0].clearColor = MTLClearColorMake(aBgRgb.Red(), aBgRgb.Green(), aBgRgb.Blue(), 1.0);
 
   // Configure depth attachment
-  if (myDepthTexture != nil)
-  {
-    aRenderPassDesc.depthAttachment.texture = myDepthTexture;
-    aRenderPassDesc.depthAttachment.loadAction = MTLLoadActionClear;
-    aRenderPassDesc.depthAttachment.storeAction = MTLStoreActionDontCare;
+  if (aMainDepth != nil)
+  {
+    aRenderPassDesc.depthAttachment.texture = aMainDepth;
+    aRenderPassDesc.depthAttachment.loadAction = aLoadAction;
+    // depth is kept for immediate layers and for building depth pyramid used by GPU occlusion culling of the next frame,
+    // and is always read by upscaler
+    aRenderPassDesc.depthAttachment.storeAction = myIsDepthMemoryless && !myIsUpscaledPass
+                                                ? MTLStoreActionDontCare
+                                                : MTLStoreActionStore;
     aRenderPassDesc.depthAttachment.clearDepth = 1.0;
   }
 
-  // Create render command encoder
-  id<MTLRenderCommandEncoder> aRenderEncoder = [aCommandBuffer renderCommandEncoderWithDescriptor:aRenderPassDesc];
-  if (aRenderEncoder == nil)
+  if (!aGpuTimer.IsNull())
   {
-    return;
+    aGpuTimer->AttachRenderPass(aCommandBuffer, aRenderPassDesc, Graphic3d_FrameStatsTimer_GpuMainPass);
   }
 
-  // Set viewport
-  MTLViewport aViewport;
-  aViewport.originX = 0.0;
-  aViewport.originY = 0.0;
-  aViewport.width = aWidth;
-  aViewport.height = aHeight;
-  aViewport.znear = 0.0;
-  aViewport.zfar = 1.0;
-  [aRenderEncoder setViewport:aViewport];
-
   // Store viewport in context for 3D text and other transformations
-  myContext->SetViewport(0, 0, aWidth, aHeight);
+  myContext->SetViewport(0, 0, aMainWidth, aMainHeight);
 
   // Update BVH tree selector for frustum culling (Phase 7)
   if (!myCamera.IsNull())
   {
     myBVHSelector.SetViewVolume(myCamera);
-    myBVHSelector.SetViewportSize(aWidth, aHeight, myRenderParams.ResolutionRatio());
+    myBVHSelector.SetViewportSize(aMainWidth, aMainHeight, myRenderParams.ResolutionRatio());
     myBVHSelector.CacheClipPtsProjections();
   }
 
-  // Draw textured background if enabled (takes priority over gradient)
-  if (!myBgTexture.IsNull())
+  // Mark structures of normal layers outside of view frustum or too small as culled
+  updateCulling(false);
+  if (myIsReducedPass)
   {
-    drawTexturedBackground((__bridge void*)aRenderEncoder, aWidth, aHeight);
+    updateBudgetCulling();
   }
-  // Draw gradient background if enabled
-  else if (myBgGradientMethod != Aspect_GradientFillMethod_None)
+
+  // Encode main pass by thread pool workers for large scenes;
+  // incremental pass is encoded serially as it skips background and recorded layers
+  const bool isParallelEncoded = myContext->Caps()->useParallelEncoding
+                              && !myIsIncrementalPass
+                              && myContext->DefaultPipeline() != nil
+                              && renderStructuresParallel((__bridge void*)aCommandBuffer,
+                                                          (__bridge void*)aRenderPassDesc,
+                                                          aMainWidth, aMainHeight);
+  if (!isParallelEncoded)
   {
-    drawGradientBackground((__bridge void*)aRenderEncoder, aWidth, aHeight);
-  }
+    // Create render command encoder
+    id<MTLRenderCommandEncoder> aRenderEncoder = [aCommandBuffer renderCommandEncoderWithDescriptor:aRenderPassDesc];
+    if (aRenderEncoder == nil)
+    {
+      return;
+    }
 
-  // Check if we have displayed structures to render
-  bool aHasStructures = (NumberOfDisplayedStructures() > 0);
+    // Set viewport
+    MTLViewport aViewport;
+    aViewport.originX = 0.0;
+    aViewport.originY = 0.0;
+    aViewport.width = aMainWidth;
+    aViewport.height = aMainHeight;
+    aViewport.znear = 0.0;
+    aViewport.zfar = 1.0;
+    [aRenderEncoder setViewport:aViewport];
+
+    // Draw video or textured background if enabled (takes priority over gradient)
+    if (myIsIncrementalPass)
+    {
+      // background is restored from the image of previous frame
+    }
+    else if (drawVideoBackground((__bridge void*)aRenderEncoder, aMainWidth, aMainHeight))
+    {
+      // video frame covers the whole viewport
+    }
+    else if (!myBgTexture.IsNull())
+    {
+      drawTexturedBackground((__bridge void*)aRenderEncoder, aMainWidth, aMainHeight);
+    }
+    // Draw gradient background if enabled
+    else if (myBgGradientMethod != Aspect_GradientFillMethod_None)
+    {
+      drawGradientBackground((__bridge void*)aRenderEncoder, aMainWidth, aMainHeight);
+    }
 
-  myContext->Messenger()->SendInfo() << "Metal_View::Redraw: aHasStructures=" << aHasStructures
-                       << " numDisplayed=" << NumberOfDisplayedStructures()
-                       << " numLayers=" << myLayers.Size();
+    // Check if we have displayed structures to render
+    bool aHasStructures = (NumberOfDisplayedStructures() > 0);
 
-  if (aHasStructures && myContext->DefaultPipeline() != nil)
-  {
-    myContext->Messenger()->SendInfo() << "Metal_View::Redraw: entering structure rendering path";
-    // Create workspace for rendering
-    occ::handle<Metal_Workspace> aWorkspace = new Metal_Workspace(myContext.get(), this);
-    aWorkspace->SetEncoder(aRenderEncoder);
-    aWorkspace->SetShaderManager(myContext->ShaderManager());
+    myContext->Messenger()->SendInfo() << "Metal_View::Redraw: aHasStructures=" << aHasStructures
+                         << " numDisplayed=" << NumberOfDisplayedStructures()
+                         << " numLayers=" << myLayers.Size();
 
-    // Set up camera matrices
-    if (!myCamera.IsNull())
+    if (aHasStructures && myContext->DefaultPipeline() != nil)
     {
-      // Get matrices from camera
-      const NCollection_Mat4<float>& aModelView = myCamera->OrientationMatrixF();
-      const NCollection_Mat4<float>& aProjection = myCamera->ProjectionMatrixF();
+      myContext->Messenger()->SendInfo() << "Metal_View::Redraw: entering structure rendering path";
+      // Create workspace for rendering
+      occ::handle<Metal_Workspace> aWorkspace = new Metal_Workspace(myContext.get(), this);
+      aWorkspace->SetEncoder(aRenderEncoder);
+      prepareWorkspace(aWorkspace.get());
+      if (myIsReducedPass)
+      {
+        // semitransparent groups are skipped by reduced frames of progressive mode
+        aWorkspace->SetRenderFilter(Metal_RenderFilter_OpaqueOnly);
+      }
 
-      aWorkspace->SetModelMatrix(aModelView);
-      aWorkspace->SetProjectionMatrix(aProjection);
+      // Render structures of non-immediate layers
+      renderStructures(aWorkspace.get(), false);
+
+      // Render graduated trihedron if enabled
+      if (myToShowGradTrihedron && !myIsIncrementalPass)
+      {
+        myGraduatedTrihedron.Render(aWorkspace.get(), myGradTrihedronMin, myGradTrihedronMax);
+      }
     }
+    // Note: When no structures to render, we simply show the background
+    // (test triangle removed - it was only for debugging Metal pipeline)
 
-    // Apply pipeline state
-    aWorkspace->ApplyPipelineState();
+    // End encoding
+    [aRenderEncoder endEncoding];
+  }
+  restoreBudgetCulling();
+
+  if (toCullOnGpu && !myGpuCulling.IsNull())
+  {
+    myGpuCulling->BuildDepthPyramid(myContext.get(), aCommandBuffer, aMainDepth);
+  }
+  if (aSparseBg != nullptr)
+  {
+    aSparseBg->EndFrame(myContext.get(), (__bridge void*)aCommandBuffer);
+  }
 
-    // Set light sources
-    if (!myLights.IsNull())
+  // upscale main pass into target; depth is upsampled for immediate layers
+  if (myIsUpscaledPass)
+  {
+    myIsUpscaledPass = false;
+    if (!acquireTarget())
     {
-      aWorkspace->SetLightSources(myLights);
+      return;
     }
-
-    // Render all displayed structures
-    renderStructures(aWorkspace.get());
-
-    // Render graduated trihedron if enabled
-    if (myToShowGradTrihedron)
+    if (!myUpscaler->Encode(myContext.get(), aCommandBuffer, aTarget, myDepthTexture, !myIsDepthMemoryless, aViewProj))
     {
-      myGraduatedTrihedron.Render(aWorkspace.get(), myGradTrihedronMin, myGradTrihedronMax);
+      myContext->Messenger()->SendWarning() << "Metal_View::Redraw: failed to upscale main pass";
     }
   }
-  // Note: When no structures to render, we simply show the background
-  // (test triangle removed - it was only for debugging Metal pipeline)
 
-  // End encoding
-  [aRenderEncoder endEncoding];
-
-  // Present the drawable
-  [aCommandBuffer presentDrawable:aDrawable];
+  // resolve points of clouds rasterized by compute kernel; the queue is dropped without stored depth
+  if (!myPointCloudRaster.IsNull())
+  {
+    myPointCloudRaster->Render(myContext.get(), aCommandBuffer, aTarget,
+                               !myIsDepthMemoryless ? myDepthTexture : nil);
+  }
 
-  // Commit command buffer and signal frame completion
-  myContext->Commit();
+  // replace shaded surfaces by their visible and hidden edges
+  if (myIsHiddenLineMode && !myCamera.IsNull() && !myClipPlanes.IsNull() && !myIsDepthMemoryless)
+  {
+    myHiddenLineAlgo->Render(myContext.get(), aCommandBuffer, aTarget, myDepthTexture,
+                             myLayers, *myClipPlanes, Identification(), *myCamera, aViewProj, myBgColor);
+  }
 
-  myBackBufferRestored = true;
-}
+  // fill section caps of capping planes over the main pass
+  if (toCap && !myCamera.IsNull() && !myIsDepthMemoryless)
+  {
+    if (myCappingAlgo.IsNull())
+    {
+      myCappingAlgo = new Metal_CappingAlgo();
+    }
+    myCappingAlgo->RenderSinglePass(myContext.get(), aCommandBuffer, aTarget, myDepthTexture,
+                                    myLayers, *myClipPlanes, Identification(), aViewProj);
+  }
+
+  // encode ID pass of the same layers for GPU picking; reduced frames of progressive mode keep the previous one
+  if (myToRenderIdBuffer && !myCamera.IsNull() && !myIsReducedPass)
+  {
+    if (myIdBuffer.IsNull())
+    {
+      myIdBuffer = new Metal_IdBuffer();
+    }
+    myIdBuffer->Render(myContext.get(), aCommandBuffer, myLayers, Identification(),
+                       myCamera->OrientationMatrixF(), myCamera->ProjectionMatrixF(),
+                       aWidth, aHeight);
+  }
+
+  // keep image of non-immediate layers for RedrawImmediate() and draw immediate layers on top
+  myIsImmediateCached = copyImmediateCache((__bridge void*)aCommandBuffer, (__bridge void*)aTarget,
+                                           aWidth, aHeight, true);
+  if (hasImmediateStructures())
+  {
+    renderImmediate((__bridge void*)aCommandBuffer, (__bridge void*)aTarget, aWidth, aHeight);
+  }
+
+  // Copy the frame for streaming capture and present the drawable
+  if (!myFrameCapture.IsNull())
+  {
+    myFrameCapture->Capture(aCommandBuffer, aTarget);
+  }
+
+  // Commit command buffer and signal frame completion
+  myCpuFrameTime = CACurrentMediaTime() - anEncodeStartTime;
+  commitFrame((__bridge void*)aCommandBuffer, (__bridge void*)aDrawable, aFrameStartTime);
+  if (!myFrameCapture.IsNull())
+  {
+    myFrameCapture->Poll();
+  }
+
+  // GPU times are available only for frames already completed
+  if (!aFrameStats.IsNull())
+  {
+    if (!aGpuTimer.IsNull())
+    {
+      double aGpuTimes[Graphic3d_FrameStatsTimer_NB] = {};
+      const int aNbGpuFrames = aGpuTimer->FetchResults(aGpuTimes);
+      aFrameStats->AddGpuTimes(aGpuTimes, aNbGpuFrames);
+    }
+    aFrameStats->FrameEnd(this, false);
+  }
+
+  // keep the view invalidated while fallback programs are used in place of pipelines
+  // still being compiled in background, so that the final image is redrawn once they are ready;
+  // the same applies to PBR environment being baked across frames, background tiles and point cloud nodes being streamed
+  Metal_ShaderManager* aShaderMgr = myContext->ShaderManager();
+  myBackBufferRestored = (aShaderMgr == nullptr
+                      || !aShaderMgr->HasPendingPrograms())
+                      && myPBREnvPending.IsNull()
+                      && (aSparseBg == nullptr || !aSparseBg->HasPendingTiles())
+                      && !myHasPendingStreaming
+                      && !myIsReducedPass;
+}
 
 // =======================================================================
 // function : RedrawImmediate
@@ -342,16 +993,89 @@ void Metal_View::Redraw()
 // =======================================================================
 void Metal_View::RedrawImmediate()
 {
-  // For Phase 1, just do a full redraw
-  // Later phases will implement incremental immediate mode rendering
-  if (!myBackBufferRestored)
+  // restoring main layers requires their depth to be stored
+  myToStoreDepth = true;
+
+  // full redraw is required when main layers should be updated or have not been cached
+  if (!myBackBufferRestored
+   || !myIsImmediateCached
+   || (myWindow.IsNull() && myFBO.IsNull())
+   || myContext.IsNull() || !myContext->IsValid())
+  {
+    Redraw();
+    return;
+  }
+
+  ++myFrameCounter;
+  const double aFrameStartTime = updateFramePacing();
+  myContext->WaitForFrame();
+  const double anEncodeStartTime = CACurrentMediaTime();
+
+  const occ::handle<Metal_FrameStats>& aFrameStats = myContext->FrameStats();
+  const occ::handle<Metal_GpuTimer>& aGpuTimer = myContext->GpuTimer();
+  if (!aFrameStats.IsNull())
+  {
+    aFrameStats->FrameStart(this, true);
+  }
+
+  id<CAMetalDrawable> aDrawable = nil;
+  id<MTLTexture> aTarget = (__bridge id<MTLTexture>)offscreenTarget();
+  if (aTarget == nil)
   {
+    aDrawable = !myWindow.IsNull() ? myWindow->NextDrawable() : nil;
+    if (aDrawable == nil)
+    {
+      return;
+    }
+    aTarget = aDrawable.texture;
+  }
+
+  id<MTLCommandBuffer> aCommandBuffer = myContext->CurrentCommandBuffer();
+  if (aCommandBuffer == nil)
+  {
+    return;
+  }
+  if (!aGpuTimer.IsNull())
+  {
+    aGpuTimer->AttachFrame(aCommandBuffer);
+  }
+
+  // restore color and depth of main layers instead of rendering them again
+  const int aWidth  = (int)aTarget.width;
+  const int aHeight = (int)aTarget.height;
+  initDepthBuffer(aWidth, aHeight);
+  if (!copyImmediateCache((__bridge void*)aCommandBuffer, (__bridge void*)aTarget,
+                          aWidth, aHeight, false))
+  {
+    // drawable size has been changed
+    myIsImmediateCached = false;
     Redraw();
     return;
   }
 
-  // For now, immediate mode also triggers full redraw
-  Redraw();
+  myContext->SetViewport(0, 0, aWidth, aHeight);
+  renderImmediate((__bridge void*)aCommandBuffer, (__bridge void*)aTarget, aWidth, aHeight);
+
+  if (!myFrameCapture.IsNull())
+  {
+    myFrameCapture->Capture(aCommandBuffer, aTarget);
+  }
+  myCpuFrameTime = CACurrentMediaTime() - anEncodeStartTime;
+  commitFrame((__bridge void*)aCommandBuffer, (__bridge void*)aDrawable, aFrameStartTime);
+  if (!myFrameCapture.IsNull())
+  {
+    myFrameCapture->Poll();
+  }
+  if (!aFrameStats.IsNull())
+  {
+    if (!aGpuTimer.IsNull())
+    {
+      double aGpuTimes[Graphic3d_FrameStatsTimer_NB] = {};
+      const int aNbGpuFrames = aGpuTimer->FetchResults(aGpuTimes);
+      aFrameStats->AddGpuTimes(aGpuTimes, aNbGpuFrames);
+    }
+    aFrameStats->FrameEnd(this, true);
+  }
 }
 
 // =======================================================================
@@ -360,9 +1084,120 @@ void Metal_View::RedrawImmediate()
 // =======================================================================
 void Metal_View::Invalidate()
 {
+  // modified content is drawn by complete frame, unless the camera moves
+  myFrameBudget.Reset();
   myBackBufferRestored = false;
 }
 
+// =======================================================================
+// function : updateFramePacing
+// purpose  : Apply frame pacing options
+// =======================================================================
+double Metal_View::updateFramePacing()
+{
+  const double aStartTime = CACurrentMediaTime();
+  const occ::handle<Metal_Caps>& aCaps = myContext->Caps();
+  if (!myWindow.IsNull())
+  {
+    myWindow->SetFramePacing(aCaps->lowLatencyPacing, aCaps->presentsWithTransaction);
+  }
+
+  // a single frame in flight serializes CPU encoding and GPU execution of frames;
+  // the second frame is allowed while both together do not fit into display refresh interval,
+  // as otherwise every other refresh would be missed
+  int aFramesInFlight = 0;
+  if (aCaps->lowLatencyPacing)
+  {
+    const double aRefreshInterval = !myWindow.IsNull() ? myWindow->RefreshInterval() : 1.0 / 60.0;
+    aFramesInFlight = myCpuFrameTime + myContext->LastGpuFrameTime() > aRefreshInterval ? 2 : 1;
+  }
+  myContext->SetFramesInFlightLimit(aFramesInFlight);
+
+  // input timestamp given by application is consumed by this frame
+  const occ::handle<Metal_FrameStats>& aFrameStats = myContext->FrameStats();
+  if (!aFrameStats.IsNull()
+   && aFrameStats->InputTimestamp() > 0.0)
+  {
+    const double anInputTime = std::min(aFrameStats->InputTimestamp(), aStartTime);
+    aFrameStats->SetInputTimestamp(0.0);
+    return anInputTime;
+  }
+  return aStartTime;
+}
+
+// =======================================================================
+// function : commitFrame
+// purpose  : Present the drawable and commit the frame
+// =======================================================================
+void Metal_View::commitFrame(void* theCmdBuffer, void* theDrawable, double theStartTime)
+{
+  Metal_Signpost aSignpost("Commit");
+  id<MTLCommandBuffer> aCommandBuffer = (__bridge id<MTLCommandBuffer>)theCmdBuffer;
+  id<CAMetalDrawable>  aDrawable      = (__bridge id<CAMetalDrawable>)theDrawable;
+  const bool toPresentWithTransaction = aDrawable != nil
+                                     && !myWindow.IsNull()
+                                     && myWindow->PresentsWithTransaction();
+  if (aDrawable != nil)
+  {
+    // presentation time of the drawable gives input-to-photon latency of the frame
+    const occ::handle<Metal_FrameStats>& aFrameStats = myContext->FrameStats();
+    if (!aFrameStats.IsNull())
+    {
+      if (@available(macOS 10.15.4, iOS 10.3, *))
+      {
+        const occ::handle<Metal_FrameStats> aStats = aFrameStats;
+        [aDrawable addPresentedHandler:^(id<MTLDrawable> thePresented)
+        {
+          aStats->AddPresentedFrame(theStartTime, thePresented.presentedTime);
+        }];
+      }
+    }
+    if (!toPresentWithTransaction)
+    {
+      [aCommandBuffer presentDrawable:aDrawable];
+    }
+  }
+
+  myContext->Commit();
+  if (toPresentWithTransaction)
+  {
+    // drawable is presented within the current Core Animation transaction
+    // once the commands rendering into it have been scheduled
+    [aCommandBuffer waitUntilScheduled];
+    [aDrawable present];
+  }
+}
+
+// =======================================================================
+// function : offscreenTarget
+// purpose  : Return color texture of offscreen frame target
+// =======================================================================
+void* Metal_View::offscreenTarget()
+{
+  if (!myFBO.IsNull() && myFBO->IsValid())
+  {
+    return (__bridge void*)myFBO->MetalColorTexture();
+  }
+  if (myWindow.IsNull() || !myWindow->IsOffscreen())
+  {
+    return nullptr;
+  }
+
+  // depth is kept by the view itself, so that headless window needs only a color target
+  if (myOffscreenFBO.IsNull())
+  {
+    myOffscreenFBO = new Metal_FrameBuffer("OffscreenFBO");
+  }
+  if (!myOffscreenFBO->InitLazy(myContext.get(), myWindow->Size(),
+                                Metal_PixelFormat_BGRA8, Metal_PixelFormat_Unknown))
+  {
+    myContext->Messenger()->SendWarning() << "Metal_View: Failed to create offscreen target "
+                                          << myWindow->Width() << "x" << myWindow->Height();
+    return nullptr;
+  }
+  return (__bridge void*)myOffscreenFBO->MetalColorTexture();
+}
+
 // =======================================================================
 // function : BufferDump
 // purpose  : Dump active rendering buffer into specified memory buffer
@@ -382,7 +1217,12 @@ bool Metal_View::BufferDump(Image_PixMap& theImage,
 
   if (theBufferType == Graphic3d_BT_Depth)
   {
-    // Read from depth buffer
+    // Read from depth buffer; memoryless depth is not available, but it is stored by next frames
+    myToStoreDepth = true;
+    if (myIsDepthMemoryless)
+    {
+      return false;
+    }
     aTexture = myDepthTexture;
     aWidth = myDepthWidth;
     aHeight = myDepthHeight;
@@ -416,6 +1256,11 @@ bool Metal_View::BufferDump(Image_PixMap& theImage,
   {
     aFBO = myFBO;
   }
+  else if (!myWindow.IsNull() && myWindow->IsOffscreen()
+        && !myOffscreenFBO.IsNull() && myOffscreenFBO->IsValid())
+  {
+    aFBO = myOffscreenFBO;
+  }
   else if (!myMainFBO.IsNull() && myMainFBO->IsValid())
   {
     aFBO = myMainFBO;
@@ -490,6 +1335,144 @@ bool Metal_View::BufferDump(Image_PixMap& theImage,
   return true;
 }
 
+// =======================================================================
+// function : updateResidency
+// purpose  : Track structures displayed by the view
+// =======================================================================
+void Metal_View::updateResidency()
+{
+  const occ::handle<Metal_ResidencyManager>& aResidency = myContext->ResidencyManager();
+  if (aResidency.IsNull())
+  {
+    return;
+  }
+
+  const int aViewId = Identification();
+  for (NCollection_List<occ::handle<Graphic3d_Layer>>::Iterator aLayerIter(myLayers);
+       aLayerIter.More(); aLayerIter.Next())
+  {
+    const occ::handle<Graphic3d_Layer>& aLayer = aLayerIter.Value();
+    if (aLayer.IsNull())
+    {
+      continue;
+    }
+
+    const Graphic3d_ArrayOfIndexedMapOfStructure& aStructArray = aLayer->ArrayOfStructures();
+    for (int aPriorityIdx = 0; aPriorityIdx < Graphic3d_DisplayPriority_NB; ++aPriorityIdx)
+    {
+      const NCollection_IndexedMap<const Graphic3d_CStructure*>& aStructMap = aStructArray[aPriorityIdx];
+      for (int aStructIdx = 1; aStructIdx <= aStructMap.Extent(); ++aStructIdx)
+      {
+        const Graphic3d_CStructure* aCStruct = aStructMap.FindKey(aStructIdx);
+        if (isStructureHidden(aCStruct, aViewId))
+        {
+          continue;
+        }
+
+        const Metal_Structure* aStruct = static_cast<const Metal_Structure*>(aCStruct);
+        aResidency->MarkUsed(aStruct);
+        if (aStruct->InstancedStructure() != nullptr)
+        {
+          aResidency->MarkUsed(aStruct->InstancedStructure());
+        }
+      }
+    }
+  }
+  aResidency->Update(myContext.get());
+}
+
+// =======================================================================
+// function : updateShadowMaps
+// purpose  : Update and render shadow map of directional light
+// =======================================================================
+void Metal_View::updateShadowMaps(void* theCmdBuffer)
+{
+  id<MTLCommandBuffer> aCmdBuffer = (__bridge id<MTLCommandBuffer>)theCmdBuffer;
+  memset(&myShadowUniforms, 0, sizeof(myShadowUniforms));
+  myShadowUniforms.LightIndex = -1;
+
+  // lights are indexed in the same way as by Metal_ShaderManager::UpdateLightSources()
+  occ::handle<Graphic3d_CLight> aShadowLight;
+  int aLightIndex = -1;
+  if (myRenderParams.IsShadowEnabled && !myLights.IsNull() && !myCamera.IsNull())
+  {
+    int anIndex = 0;
+    for (Graphic3d_LightSet::Iterator aLightIter(myLights, Graphic3d_LightSet::IterationFilter_ExcludeDisabled);
+         aLightIter.More() && anIndex < Metal_MaxLights; aLightIter.Next())
+    {
+      const occ::handle<Graphic3d_CLight>& aLight = aLightIter.Value();
+      if (aLight.IsNull() || aLight->Type() == Graphic3d_TypeOfLightSource_Ambient)
+      {
+        continue;
+      }
+      if (aLight->Type() == Graphic3d_TypeOfLightSource_Directional && aLight->ToCastShadows())
+      {
+        aShadowLight = aLight;
+        aLightIndex = anIndex;
+        break;
+      }
+      ++anIndex;
+    }
+  }
+
+  const Bnd_Box aSceneBox = !aShadowLight.IsNull() ? MinMaxValues(false) : Bnd_Box();
+  if (aShadowLight.IsNull() || aSceneBox.IsVoid())
+  {
+    // shadows of other lights are not supported; material shaders still expect a bound depth texture
+    for (NCollection_Sequence<occ::handle<Metal_ShadowMap>>::Iterator aShadowIter(myShadowMaps); aShadowIter.More(); aShadowIter.Next())
+    {
+      aShadowIter.Value()->Release(myContext.get());
+    }
+    myShadowMaps.Clear();
+    if (myActiveShadowMap.IsNull() || !myActiveShadowMap->LightSource().IsNull())
+    {
+      myActiveShadowMap = new Metal_ShadowMap(myContext.get(), 1, 1);
+    }
+    return;
+  }
+
+  const int aSize = std::max(myRenderParams.ShadowMapResolution, 1);
+  const int aNbCascades = std::max(1, std::min(myContext->Caps()->shadowMapCascades, Metal_ShadowMap::MaxCascades));
+  occ::handle<Metal_ShadowMap> aShadow = !myShadowMaps.IsEmpty() ? myShadowMaps.First() : occ::handle<Metal_ShadowMap>();
+  if (aShadow.IsNull()
+   || aShadow->Size() != aSize
+   || aShadow->NbCascades() != aNbCascades)
+  {
+    if (!aShadow.IsNull())
+    {
+      aShadow->Release(myContext.get());
+    }
+    myShadowMaps.Clear();
+    aShadow = new Metal_ShadowMap(myContext.get(), aSize, aNbCascades);
+    if (!aShadow->IsValid())
+    {
+      myContext->Messenger()->SendWarning() << "Metal_View: unable to create " << aSize << "x" << aSize
+                                            << "x" << aNbCascades << " shadow map";
+    }
+    myShadowMaps.Append(aShadow);
+  }
+  if (!aShadow->IsValid())
+  {
+    return;
+  }
+  if (aShadow->LightSource() != aShadowLight)
+  {
+    aShadow->Invalidate();
+  }
+  aShadow->SetBias(myRenderParams.ShadowMapBias);
+
+  const gp_Pnt aBoxMin = aSceneBox.CornerMin();
+  const gp_Pnt aBoxMax = aSceneBox.CornerMax();
+  const Graphic3d_BndBox3d aCasterBox(NCollection_Vec3<double>(aBoxMin.X(), aBoxMin.Y(), aBoxMin.Z()),
+                                      NCollection_Vec3<double>(aBoxMax.X(), aBoxMax.Y(), aBoxMax.Z()));
+  if (aShadow->UpdateCascades(myCamera, aShadowLight, aCasterBox, myLayers, Identification()))
+  {
+    aShadow->Render(aCmdBuffer, myLayers, Identification());
+  }
+  aShadow->FillUniforms(myShadowUniforms, myCamera->OrientationMatrix(), aLightIndex);
+  myActiveShadowMap = aShadow;
+}
+
 // =======================================================================
 // function : ShadowMapDump
 // purpose  : Dumps shadowmap framebuffer into an image
@@ -588,7 +1571,49 @@ bool Metal_View::ShadowMapDump(Image_PixMap& theImage,
 // =======================================================================
 void Metal_View::InvalidateBVHData(const Graphic3d_ZLayerId theLayerId)
 {
-  (void)theLayerId;
+  for (NCollection_List<occ::handle<Graphic3d_Layer>>::Iterator aLayerIter(myLayers); aLayerIter.More(); aLayerIter.Next())
+  {
+    if (aLayerIter.Value()->LayerId() == theLayerId)
+    {
+      aLayerIter.Value()->InvalidateBVHData();
+      break;
+    }
+  }
+  myBackBufferRestored = false;
+}
+
+// =======================================================================
+// function : InvalidateBVHBoxes
+// purpose  : Marks boxes of BVH tree as outdated
+// =======================================================================
+void Metal_View::InvalidateBVHBoxes(const Graphic3d_ZLayerId theLayerId)
+{
+  for (NCollection_List<occ::handle<Graphic3d_Layer>>::Iterator aLayerIter(myLayers); aLayerIter.More(); aLayerIter.Next())
+  {
+    if (aLayerIter.Value()->LayerId() == theLayerId)
+    {
+      aLayerIter.Value()->InvalidateBVHBoxes();
+      break;
+    }
+  }
+  myBackBufferRestored = false;
+}
+
+// =======================================================================
+// function : InvalidateBVHStructure
+// purpose  : Updates BVH data of the layer after modification of the structure
+// =======================================================================
+void Metal_View::InvalidateBVHStructure(const Graphic3d_CStructure* theStruct,
+                                        const Graphic3d_ZLayerId    theLayerId)
+{
+  for (NCollection_List<occ::handle<Graphic3d_Layer>>::Iterator aLayerIter(myLayers); aLayerIter.More(); aLayerIter.Next())
+  {
+    if (aLayerIter.Value()->LayerId() == theLayerId)
+    {
+      aLayerIter.Value()->InvalidateBVHStructure(theStruct);
+      break;
+    }
+  }
   myBackBufferRestored = false;
 }
 
@@ -753,6 +1778,7 @@ void Metal_View::RemoveZLayer(const Graphic3d_ZLayerId theLayerId)
 
   // Remove from map
   myLayerMap.UnBind(theLayerId);
+  myIndirectLayers.UnBind(theLayerId);
 
   myBackBufferRestored = false;
 }
@@ -957,18 +1983,62 @@ void Metal_View::SetBackgroundImage(const occ::handle<Graphic3d_TextureMap>& the
   // Create new background texture if provided
   if (!theTextureMap.IsNull() && !myContext.IsNull())
   {
-    occ::handle<Image_PixMap> anImage = theTextureMap->GetImage(occ::handle<Image_SupportedFormats>());
-    if (!anImage.IsNull())
+    // precompressed image (e.g. DDS) is uploaded as is when supported by device;
+    // very large image is streamed by tiles (or downsampled to fit memory budget)
+    const occ::handle<Image_SupportedFormats>& aFormats = myContext->SupportedTextureFormats();
+    const occ::handle<Image_CompressedPixMap> aCompressed = aFormats->HasCompressed()
+                                                          ? theTextureMap->GetCompressedImage(aFormats)
+                                                          : occ::handle<Image_CompressedPixMap>();
+    myBgTexture = new Metal_Texture();
+    if (aCompressed.IsNull()
+     || aCompressed->NbFaces() > 1
+     || !myBgTexture->CreateCompressed(myContext.get(), *aCompressed, false))
     {
-      myBgTexture = new Metal_Texture();
-      if (!myBgTexture->Create2D(myContext.get(), *anImage, false))
+      const occ::handle<Image_PixMap> anImage = theTextureMap->GetImage(aFormats);
+      const int aStreamedMinSize = myContext->Caps()->streamedTextureMinSize;
+      if (anImage.IsNull())
+      {
+        myBgTexture.Nullify();
+      }
+      else if (aStreamedMinSize > 0
+            && (int)std::max(anImage->SizeX(), anImage->SizeY()) >= aStreamedMinSize)
+      {
+        myBgTexture = Metal_SparseTexture::CreateStreamed(myContext.get(), anImage);
+      }
+      else if (!myBgTexture->Create2D(myContext.get(), *anImage, false))
       {
-        myContext->Messenger()->SendWarning() << "Metal_View: Failed to create background texture";
         myBgTexture.Nullify();
       }
     }
+    if (myBgTexture.IsNull())
+    {
+      myContext->Messenger()->SendWarning() << "Metal_View: Failed to create background texture";
+    }
+  }
+
+  myBackBufferRestored = false;
+}
+
+// =======================================================================
+// function : SetBackgroundVideo
+// purpose  : Sets video playing as background
+// =======================================================================
+void Metal_View::SetBackgroundVideo(const occ::handle<Graphic3d_MediaTextureSet>& theMedia)
+{
+  if (!myBgVideo.IsNull())
+  {
+    if (myBgVideo->Media() == theMedia)
+    {
+      return;
+    }
+    myBgVideo->Release(myContext.get());
+    myBgVideo.Nullify();
   }
 
+  if (!theMedia.IsNull())
+  {
+    myBgVideo = new Metal_VideoTexture(theMedia);
+  }
   myBackBufferRestored = false;
 }
 
@@ -1037,11 +2107,13 @@ void Metal_View::SetImageBasedLighting(bool theToEnableIBL)
 
   if (!theToEnableIBL)
   {
-    // Disable IBL - release PBR environment
-    if (!myPBREnvironment.IsNull())
+    // Disable IBL - drop active and pending PBR environments;
+    // baked ones are kept in cache for enabling IBL again
+    if (!myPBREnvironment.IsNull()
+     || !myPBREnvPending.IsNull())
     {
-      myPBREnvironment->Release();
       myPBREnvironment.Nullify();
+      myPBREnvPending.Nullify();
       myContext->Messenger()->SendInfo() << "Metal_View: IBL disabled";
     }
     return;
@@ -1053,59 +2125,129 @@ void Metal_View::SetImageBasedLighting(bool theToEnableIBL)
     return;
   }
 
-  // Create PBR environment if not exists
   unsigned int aPow2Size = (unsigned int)myRenderParams.PbrEnvPow2Size;
   unsigned int aSpecLevels = std::min(aPow2Size + 1, 10u);
+  myBackBufferRestored = false;
 
-  if (myPBREnvironment.IsNull() || myPBREnvironment->SizesAreDifferent(aPow2Size, aSpecLevels))
+  const bool hasEnvMap = !myEnvCubemap.IsNull() && myEnvCubemap->IsValid();
+  if (!hasEnvMap)
   {
-    myPBREnvironment = Metal_PBREnvironment::Create(myContext, aPow2Size, aSpecLevels);
-    if (myPBREnvironment.IsNull())
+    // Clear to default ambient; environment shared with cache should be left intact
+    myPBREnvPending.Nullify();
+    bool isCached = false;
+    for (NCollection_DataMap<TCollection_AsciiString, occ::handle<Metal_PBREnvironment>>::Iterator anEnvIter(myPBREnvCache);
+         anEnvIter.More() && !myPBREnvironment.IsNull(); anEnvIter.Next())
     {
-      myContext->Messenger()->SendWarning() << "Metal_View: Failed to create PBR environment";
-      return;
+      if (anEnvIter.Value() == myPBREnvironment)
+      {
+        isCached = true;
+        break;
+      }
+    }
+    if (isCached || myPBREnvironment.IsNull() || myPBREnvironment->SizesAreDifferent(aPow2Size, aSpecLevels))
+    {
+      myPBREnvironment = Metal_PBREnvironment::Create(myContext, aPow2Size, aSpecLevels);
+      if (myPBREnvironment.IsNull())
+      {
+        myContext->Messenger()->SendWarning() << "Metal_View: Failed to create PBR environment";
+        return;
+      }
     }
+    myPBREnvironment->Clear(myContext);
+    myContext->Messenger()->SendInfo() << "Metal_View: IBL enabled with default ambient";
+    return;
   }
 
-  // Bake IBL maps from environment cubemap if available
-  if (!myEnvCubemap.IsNull() && myEnvCubemap->IsValid())
+  // Reuse environment baked earlier from the same texture
+  occ::handle<Metal_PBREnvironment> aCachedEnv;
+  if (!myEnvTextureId.IsEmpty()
+   && myPBREnvCache.Find(myEnvTextureId, aCachedEnv)
+   && !aCachedEnv->SizesAreDifferent(aPow2Size, aSpecLevels))
   {
-#ifdef __OBJC__
-    myPBREnvironment->Bake(myContext, myEnvCubemap->Texture(),
-                           false,  // Z not inverted
-                           false,  // not top-down
-                           64,     // diffuse samples
-                           256);   // specular samples
-    myContext->Messenger()->SendInfo() << "Metal_View: IBL baked from environment texture";
-#endif
+    myPBREnvironment = aCachedEnv;
+    myPBREnvPending.Nullify();
+    myContext->Messenger()->SendInfo() << "Metal_View: IBL restored from cache";
+    return;
   }
-  else
+
+  // Bake IBL maps into a new environment step by step within following frames,
+  // while the current one (if any) remains active
+  myPBREnvPending = Metal_PBREnvironment::Create(myContext, aPow2Size, aSpecLevels);
+  if (myPBREnvPending.IsNull())
   {
-    // Clear to default ambient
-    myPBREnvironment->Clear(myContext);
-    myContext->Messenger()->SendInfo() << "Metal_View: IBL enabled with default ambient";
+    myContext->Messenger()->SendWarning() << "Metal_View: Failed to create PBR environment";
+    return;
   }
-
-  myBackBufferRestored = false;
+  myPBREnvPending->StartBake(myContext, myEnvCubemap->Texture(),
+                             false,  // Z not inverted
+                             false,  // not top-down
+                             64,     // diffuse samples
+                             256);   // specular samples
 }
 
 // =======================================================================
-// function : SetTextureEnv
-// purpose  : Sets environment texture for the view
+// function : updatePBREnvironment
+// purpose  : Advances pending PBR environment baking
 // =======================================================================
-void Metal_View::SetTextureEnv(const occ::handle<Graphic3d_TextureEnv>& theTextureEnv)
+void Metal_View::updatePBREnvironment(void* theCmdBuffer)
 {
-  // Release existing environment texture
-  if (!myEnvCubemap.IsNull())
+  if (myPBREnvPending.IsNull())
   {
-    myEnvCubemap->Release(myContext.get());
-    myEnvCubemap.Nullify();
+    return;
   }
 
-  // Create new environment texture if provided
-  if (!theTextureEnv.IsNull() && !myContext.IsNull())
+  if (!myPBREnvPending->IsBakeCompleted())
   {
-    occ::handle<Image_PixMap> anImage = theTextureEnv->GetImage(occ::handle<Image_SupportedFormats>());
+    myPBREnvPending->BakeStep(myContext, (__bridge id<MTLCommandBuffer>)theCmdBuffer);
+    return;
+  }
+
+  if (!myEnvTextureId.IsEmpty())
+  {
+    if (!myPBREnvCache.IsBound(myEnvTextureId)
+      && myPBREnvCache.Extent() >= THE_PBR_ENV_CACHE_SIZE)
+    {
+      // evict any environment other than the active one
+      TCollection_AsciiString anEvictKey;
+      for (NCollection_DataMap<TCollection_AsciiString, occ::handle<Metal_PBREnvironment>>::Iterator anEnvIter(myPBREnvCache);
+           anEnvIter.More(); anEnvIter.Next())
+      {
+        if (anEnvIter.Value() != myPBREnvironment)
+        {
+          anEvictKey = anEnvIter.Key();
+          break;
+        }
+      }
+      myPBREnvCache.UnBind(anEvictKey);
+    }
+    myPBREnvCache.Bind(myEnvTextureId, myPBREnvPending);
+  }
+
+  myPBREnvironment = myPBREnvPending;
+  myPBREnvPending.Nullify();
+  myContext->Messenger()->SendInfo() << "Metal_View: IBL baked from environment texture";
+}
+
+// =======================================================================
+// function : SetTextureEnv
+// purpose  : Sets environment texture for the view
+// =======================================================================
+void Metal_View::SetTextureEnv(const occ::handle<Graphic3d_TextureEnv>& theTextureEnv)
+{
+  // Release existing environment texture;
+  // pending baking keeps its own reference to the source, but its result would not match the new one
+  if (!myEnvCubemap.IsNull())
+  {
+    myEnvCubemap->Release(myContext.get());
+    myEnvCubemap.Nullify();
+  }
+  myPBREnvPending.Nullify();
+  myEnvTextureId = !theTextureEnv.IsNull() ? theTextureEnv->GetId() : TCollection_AsciiString();
+
+  // Create new environment texture if provided
+  if (!theTextureEnv.IsNull() && !myContext.IsNull())
+  {
+    occ::handle<Image_PixMap> anImage = theTextureEnv->GetImage(occ::handle<Image_SupportedFormats>());
     if (!anImage.IsNull())
     {
       myEnvCubemap = new Metal_Texture();
@@ -1145,6 +2287,44 @@ void Metal_View::SetClipPlanes(const occ::handle<Graphic3d_SequenceOfHClipPlane>
   myBackBufferRestored = false;
 }
 
+// =======================================================================
+// function : SetToRenderIdBuffer
+// purpose  : Enable or disable rendering of ID buffer
+// =======================================================================
+void Metal_View::SetToRenderIdBuffer(const bool theToRender)
+{
+  if (myToRenderIdBuffer == theToRender)
+  {
+    return;
+  }
+
+  myToRenderIdBuffer = theToRender;
+  if (!theToRender && !myIdBuffer.IsNull())
+  {
+    myIdBuffer->Release(myContext.get());
+    myIdBuffer.Nullify();
+  }
+  myBackBufferRestored = false;
+}
+
+// =======================================================================
+// function : QueryIdBuffer
+// purpose  : Read back elements within the rectangle of ID buffer
+// =======================================================================
+bool Metal_View::QueryIdBuffer(const int theLeft,
+                               const int theTop,
+                               const int theWidth,
+                               const int theHeight,
+                               NCollection_Vector<Graphic3d_IdBufferSample>& theSamples) const
+{
+  theSamples.Clear();
+  if (!myToRenderIdBuffer || myIdBuffer.IsNull())
+  {
+    return false;
+  }
+  return myIdBuffer->Query(myContext.get(), theLeft, theTop, theWidth, theHeight, theSamples);
+}
+
 // =======================================================================
 // function : DiagnosticInformation
 // purpose  : Fill in the dictionary with diagnostic info
@@ -1217,6 +2397,25 @@ TCollection_AsciiString Metal_View::StatisticInformation() const
     aInfo += TCollection_AsciiString("  Size: ") + myWindow->Width() + "x" + myWindow->Height() + "\n";
     aInfo += TCollection_AsciiString("  Scale: ") + myWindow->ScaleFactor() + "\n";
   }
+  if (!myContext.IsNull() && !myContext->FrameStats().IsNull())
+  {
+    const occ::handle<Metal_FrameStats>& aStats = myContext->FrameStats();
+    aInfo += aStats->FormatStats(myRenderParams.CollectedStats);
+    if (aStats->NbSortedDraws() > 0)
+    {
+      aInfo += TCollection_AsciiString("  Sorted draws: ") + aStats->NbSortedDraws() + "\n";
+      aInfo += TCollection_AsciiString("  State changes: ") + aStats->NbStateChanges()
+             + " (" + aStats->NbStateChangesSaved() + " saved)\n";
+    }
+    if (aStats->NbAccelStructures() > 0)
+    {
+      const double aMiB = 1024.0 * 1024.0;
+      aInfo += TCollection_AsciiString("  Accel structures: ") + aStats->NbAccelStructures()
+             + ", " + TCollection_AsciiString(double(aStats->AccelStructMemory()) / aMiB) + " MiB ("
+             + TCollection_AsciiString(double(aStats->AccelStructMemoryUncompacted()) / aMiB) + " MiB uncompacted)"
+             + ", scratch " + TCollection_AsciiString(double(aStats->AccelStructScratchPeak()) / aMiB) + " MiB\n";
+    }
+  }
   return aInfo;
 }
 
@@ -1234,6 +2433,24 @@ void Metal_View::StatisticInformation(
     theDict.Add("ViewHeight", TCollection_AsciiString(myWindow->Height()));
     theDict.Add("ScaleFactor", TCollection_AsciiString(myWindow->ScaleFactor()));
   }
+  if (!myContext.IsNull() && !myContext->FrameStats().IsNull())
+  {
+    const occ::handle<Metal_FrameStats>& aStats = myContext->FrameStats();
+    aStats->FormatStats(theDict, myRenderParams.CollectedStats);
+    if (aStats->NbSortedDraws() > 0)
+    {
+      theDict.Add("SortedDraws", TCollection_AsciiString(aStats->NbSortedDraws()));
+      theDict.Add("StateChanges", TCollection_AsciiString(aStats->NbStateChanges()));
+      theDict.Add("StateChangesSaved", TCollection_AsciiString(aStats->NbStateChangesSaved()));
+    }
+    if (aStats->NbAccelStructures() > 0)
+    {
+      theDict.Add("AccelStructures", TCollection_AsciiString(aStats->NbAccelStructures()));
+      theDict.Add("AccelStructMemory", TCollection_AsciiString(double(aStats->AccelStructMemory())));
+      theDict.Add("AccelStructMemoryUncompacted", TCollection_AsciiString(double(aStats->AccelStructMemoryUncompacted())));
+      theDict.Add("AccelStructScratch", TCollection_AsciiString(double(aStats->AccelStructScratchPeak())));
+    }
+  }
 }
 
 // =======================================================================
@@ -1355,11 +2572,117 @@ void Metal_View::changePriority(const occ::handle<Graphic3d_CStructure>& theCStr
   myBackBufferRestored = false;
 }
 
+// =======================================================================
+// function : updateCulling
+// purpose  : Update culling state of structures within layers
+// =======================================================================
+void Metal_View::updateCulling(bool theToDrawImmediate)
+{
+  Metal_Signpost aSignpost("Cull");
+  const occ::handle<Metal_FrameStats>& aStats = myContext->FrameStats();
+  OSD_Timer aLocalTimer;
+  OSD_Timer& aTimer = !aStats.IsNull()
+                    ? aStats->ActiveDataFrame().ChangeTimer(Graphic3d_FrameStatsTimer_CpuCulling)
+                    : aLocalTimer;
+  aTimer.Start();
+
+  const int aViewId = Identification();
+  for (NCollection_List<occ::handle<Graphic3d_Layer>>::Iterator aLayerIter(myLayers);
+       aLayerIter.More(); aLayerIter.Next())
+  {
+    const occ::handle<Graphic3d_Layer>& aLayer = aLayerIter.Value();
+    if (aLayer.IsNull() || aLayer->IsImmediate() != theToDrawImmediate)
+    {
+      continue;
+    }
+
+    aLayer->UpdateCulling(aViewId, myBVHSelector, myRenderParams.FrustumCullingState);
+  }
+
+  aTimer.Stop();
+  if (!aStats.IsNull())
+  {
+    aStats->ActiveDataFrame()[Graphic3d_FrameStatsTimer_CpuCulling] = aTimer.UserTimeCPU();
+  }
+}
+
+// =======================================================================
+// function : updateBudgetCulling
+// purpose  : Mark structures outside of the size band of progressive frame as culled
+// =======================================================================
+void Metal_View::updateBudgetCulling()
+{
+  const double aMinSize = myFrameBudget.SizeThreshold();
+  const double aMaxSize = myIsIncrementalPass ? myFrameBudget.RefinedSize() : 0.0;
+  if (aMinSize <= 0.0 && aMaxSize <= 0.0)
+  {
+    return;
+  }
+
+  Graphic3d_CullingTool::CullingContext aMinCtx, aMaxCtx;
+  myBVHSelector.SetCullingSize(aMinCtx, aMinSize);
+  myBVHSelector.SetCullingSize(aMaxCtx, aMaxSize);
+  const int aViewId = Identification();
+  for (NCollection_List<occ::handle<Graphic3d_Layer>>::Iterator aLayerIter(myLayers);
+       aLayerIter.More(); aLayerIter.Next())
+  {
+    const occ::handle<Graphic3d_Layer>& aLayer = aLayerIter.Value();
+    if (aLayer.IsNull() || aLayer->IsImmediate() || aLayer->IsCulled())
+    {
+      continue;
+    }
+
+    const Graphic3d_ArrayOfIndexedMapOfStructure& aStructArray = aLayer->ArrayOfStructures();
+    for (int aPriorityIdx = 0; aPriorityIdx < Graphic3d_DisplayPriority_NB; ++aPriorityIdx)
+    {
+      const NCollection_IndexedMap<const Graphic3d_CStructure*>& aStructMap = aStructArray[aPriorityIdx];
+      for (int aStructIdx = 1; aStructIdx <= aStructMap.Extent(); ++aStructIdx)
+      {
+        const Graphic3d_CStructure* aCStruct = aStructMap.FindKey(aStructIdx);
+        if (isStructureHidden(aCStruct, aViewId))
+        {
+          continue;
+        }
+
+        // structures with transformation persistence or without bounds have no projected size,
+        // they are drawn by all frames but incremental ones
+        const Graphic3d_BndBox3d& aBox = aCStruct->BoundingBox();
+        bool toSkip = myIsIncrementalPass;
+        if (aCStruct->TransformPersistence().IsNull()
+         && aBox.IsValid())
+        {
+          toSkip = myBVHSelector.IsTooSmall(aMinCtx, aBox.CornerMin(), aBox.CornerMax())
+               || (aMaxSize > 0.0 && !myBVHSelector.IsTooSmall(aMaxCtx, aBox.CornerMin(), aBox.CornerMax()));
+        }
+        if (toSkip)
+        {
+          aCStruct->SetCulled(true);
+          myBudgetCulled.Append(aCStruct);
+        }
+      }
+    }
+  }
+}
+
+// =======================================================================
+// function : restoreBudgetCulling
+// purpose  : Revert culling marks of structures skipped by frame budget
+// =======================================================================
+void Metal_View::restoreBudgetCulling()
+{
+  for (NCollection_Vector<const Graphic3d_CStructure*>::Iterator aStructIter(myBudgetCulled);
+       aStructIter.More(); aStructIter.Next())
+  {
+    aStructIter.Value()->SetCulled(false);
+  }
+  myBudgetCulled.Clear();
+}
+
 // =======================================================================
 // function : renderStructures
 // purpose  : Render all displayed structures
 // =======================================================================
-void Metal_View::renderStructures(Metal_Workspace* theWorkspace)
+void Metal_View::renderStructures(Metal_Workspace* theWorkspace, bool theToDrawImmediate)
 {
   if (theWorkspace == nullptr)
   {
@@ -1368,18 +2691,326 @@ void Metal_View::renderStructures(Metal_Workspace* theWorkspace)
 
   // Save original model matrix to restore after each structure
   const NCollection_Mat4<float> aBaseModelMatrix = theWorkspace->ModelMatrix();
+  const bool toUseIndirect = myContext->Caps()->useIndirectCommandBuffers
+                          && myContext->HasIndirectCommandBuffers();
+  const bool toSortDraws = myContext->Caps()->useSortedDrawList;
 
   // Iterate through layers in order (they are stored in Z-order)
   for (NCollection_List<occ::handle<Graphic3d_Layer>>::Iterator aLayerIter(myLayers);
        aLayerIter.More(); aLayerIter.Next())
   {
     const occ::handle<Graphic3d_Layer>& aLayer = aLayerIter.Value();
-    if (aLayer.IsNull() || aLayer->NbStructures() == 0)
+    if (aLayer.IsNull() || aLayer->NbStructures() == 0
+     || aLayer->IsImmediate() != theToDrawImmediate)
+    {
+      continue;
+    }
+
+    Metal_Signpost aLayerSignpost("Encode layer", aLayer->LayerId());
+
+    // Replay commands recorded for static layer;
+    // the whole layer has been drawn by previous frame when incremental pass of progressive mode is encoded
+    if (toUseIndirect && !aLayer->IsImmediate() && myIsIncrementalPass)
+    {
+      continue;
+    }
+    if (toUseIndirect && !aLayer->IsImmediate())
+    {
+      occ::handle<Metal_IndirectLayer>* anIndirect = myIndirectLayers.ChangeSeek(aLayer->LayerId());
+      if (anIndirect == nullptr)
+      {
+        anIndirect = myIndirectLayers.Bound(aLayer->LayerId(), new Metal_IndirectLayer());
+      }
+      if ((*anIndirect)->Render(theWorkspace, *aLayer))
+      {
+        continue;
+      }
+    }
+
+    if (toSortDraws && !aLayer->IsImmediate())
+    {
+      renderLayerSorted(theWorkspace, *aLayer, aBaseModelMatrix);
+      continue;
+    }
+
+    renderLayerStructures(theWorkspace, *aLayer, aBaseModelMatrix);
+  }
+
+  // Restore original model matrix
+  theWorkspace->SetModelMatrix(aBaseModelMatrix);
+}
+
+// =======================================================================
+// function : renderLayerSorted
+// purpose  : Render layer with draws sorted by render state
+// =======================================================================
+void Metal_View::renderLayerSorted(Metal_Workspace* theWorkspace,
+                                   const Graphic3d_Layer& theLayer,
+                                   const NCollection_Mat4<float>& theBaseModelMatrix)
+{
+  if (theLayer.IsCulled())
+  {
+    return;
+  }
+
+  // collect draws of sortable structures, keep the other ones in priority order
+  myDrawList.Clear();
+  NCollection_Vector<const Metal_Structure*> anUnsorted;
+  const int aViewId = Identification();
+  const Graphic3d_ArrayOfIndexedMapOfStructure& aStructArray = theLayer.ArrayOfStructures();
+  for (int aPriorityIdx = 0; aPriorityIdx < Graphic3d_DisplayPriority_NB; ++aPriorityIdx)
+  {
+    const NCollection_IndexedMap<const Graphic3d_CStructure*>& aStructMap = aStructArray[aPriorityIdx];
+    for (int aStructIdx = 1; aStructIdx <= aStructMap.Extent(); ++aStructIdx)
+    {
+      const Graphic3d_CStructure* aCStruct = aStructMap.FindKey(aStructIdx);
+      if (isStructureHidden(aCStruct, aViewId))
+      {
+        continue;
+      }
+
+      // sorted draws are encoded without clipping, so that structures crossed by planes stay unsorted
+      const Metal_Structure* aStruct = static_cast<const Metal_Structure*>(aCStruct);
+      if (!theWorkspace->SetStructureClipping(aStruct))
+      {
+        continue;
+      }
+      const bool isClipped = theWorkspace->ClipPlaneUniforms().PlaneCount > 0;
+      theWorkspace->ResetStructureClipping();
+      if (isClipped
+      || !myDrawList.AddStructure(theWorkspace, aStruct, theBaseModelMatrix))
+      {
+        anUnsorted.Append(aStruct);
+      }
+    }
+  }
+
+  myDrawList.Submit(theWorkspace);
+  const occ::handle<Metal_FrameStats>& aStats = myContext->FrameStats();
+  if (!aStats.IsNull() && myDrawList.NbDraws() > 0)
+  {
+    aStats->AddStateChanges(myDrawList.NbDraws(),
+                            myDrawList.UnsortedChanges().Total(),
+                            myDrawList.SortedChanges().Total());
+  }
+
+  for (NCollection_Vector<const Metal_Structure*>::Iterator aStructIter(anUnsorted); aStructIter.More(); aStructIter.Next())
+  {
+    renderStructure(theWorkspace, aStructIter.Value(), theBaseModelMatrix);
+  }
+}
+
+// =======================================================================
+// function : mainProjectionMatrix
+// purpose  : Return camera projection of the main pass
+// =======================================================================
+NCollection_Mat4<float> Metal_View::mainProjectionMatrix() const
+{
+  return myIsUpscaledPass
+       ? myUpscaler->JitteredProjection(myCamera->ProjectionMatrixF())
+       : myCamera->ProjectionMatrixF();
+}
+
+// =======================================================================
+// function : prepareWorkspace
+// purpose  : Setup workspace for rendering the scene
+// =======================================================================
+void Metal_View::prepareWorkspace(Metal_Workspace* theWorkspace)
+{
+  theWorkspace->SetShaderManager(myContext->ShaderManager());
+
+  // Set up camera matrices
+  if (!myCamera.IsNull())
+  {
+    theWorkspace->SetModelMatrix(myCamera->OrientationMatrixF());
+    theWorkspace->SetProjectionMatrix(mainProjectionMatrix());
+  }
+
+  // Apply pipeline state
+  theWorkspace->ApplyPipelineState();
+
+  // Set light sources, bound once for the whole pass
+  if (!myLights.IsNull())
+  {
+    theWorkspace->SetLightSources(myLights);
+  }
+  theWorkspace->ApplyLightingUniforms();
+}
+
+// =======================================================================
+// function : hasImmediateStructures
+// purpose  : Check if immediate layers have structures
+// =======================================================================
+bool Metal_View::hasImmediateStructures() const
+{
+  for (NCollection_List<occ::handle<Graphic3d_Layer>>::Iterator aLayerIter(myLayers);
+       aLayerIter.More(); aLayerIter.Next())
+  {
+    const occ::handle<Graphic3d_Layer>& aLayer = aLayerIter.Value();
+    if (!aLayer.IsNull() && aLayer->IsImmediate() && aLayer->NbStructures() > 0)
     {
+      return true;
+    }
+  }
+  return false;
+}
+
+// =======================================================================
+// function : renderImmediate
+// purpose  : Draw immediate layers on top of the target
+// =======================================================================
+void Metal_View::renderImmediate(void* theCmdBuffer, void* theTarget, int theWidth, int theHeight)
+{
+  id<MTLCommandBuffer> aCommandBuffer = (__bridge id<MTLCommandBuffer>)theCmdBuffer;
+  id<MTLTexture> aTarget = (__bridge id<MTLTexture>)theTarget;
+  if (aCommandBuffer == nil || aTarget == nil || myContext->DefaultPipeline() == nil)
+  {
+    return;
+  }
+
+  MTLRenderPassDescriptor* aPassDesc = [MTLRenderPassDescriptor renderPassDescriptor];
+  aPassDesc.colorAttachments[0].texture = aTarget;
+  aPassDesc.colorAttachments[0].loadAction = MTLLoadActionLoad;
+  aPassDesc.colorAttachments[0].storeAction = MTLStoreActionStore;
+  if (myDepthTexture != nil)
+  {
+    // immediate structures are depth-tested against main layers
+    aPassDesc.depthAttachment.texture = myDepthTexture;
+    aPassDesc.depthAttachment.loadAction = MTLLoadActionLoad;
+    aPassDesc.depthAttachment.storeAction = MTLStoreActionDontCare;
+  }
+
+  id<MTLRenderCommandEncoder> anEncoder = [aCommandBuffer renderCommandEncoderWithDescriptor:aPassDesc];
+  if (anEncoder == nil)
+  {
+    return;
+  }
+  anEncoder.label = @"Immediate";
+
+  MTLViewport aViewport;
+  aViewport.originX = 0.0;
+  aViewport.originY = 0.0;
+  aViewport.width = theWidth;
+  aViewport.height = theHeight;
+  aViewport.znear = 0.0;
+  aViewport.zfar = 1.0;
+  [anEncoder setViewport:aViewport];
+
+  occ::handle<Metal_Workspace> aWorkspace = new Metal_Workspace(myContext.get(), this);
+  aWorkspace->SetEncoder(anEncoder);
+  prepareWorkspace(aWorkspace.get());
+  updateCulling(true);
+  renderStructures(aWorkspace.get(), true);
+
+  [anEncoder endEncoding];
+}
+
+// =======================================================================
+// function : copyImmediateCache
+// purpose  : Save or restore image of non-immediate layers
+// =======================================================================
+bool Metal_View::copyImmediateCache(void* theCmdBuffer, void* theTarget,
+                                    int theWidth, int theHeight, bool theToSave)
+{
+  id<MTLCommandBuffer> aCommandBuffer = (__bridge id<MTLCommandBuffer>)theCmdBuffer;
+  id<MTLTexture> aTarget = (__bridge id<MTLTexture>)theTarget;
+  if (aCommandBuffer == nil || aTarget == nil || myDepthTexture == nil || myIsDepthMemoryless)
+  {
+    return false;
+  }
+
+  if (theToSave)
+  {
+    if (myImmediateCacheFBO.IsNull())
+    {
+      myImmediateCacheFBO = new Metal_FrameBuffer();
+    }
+    if (!myImmediateCacheFBO->InitLazy(myContext.get(), NCollection_Vec2<int>(theWidth, theHeight),
+                                       Metal_PixelFormat_BGRA8, Metal_PixelFormat_Depth32F))
+    {
+      return false;
+    }
+  }
+  else if (myImmediateCacheFBO.IsNull()
+        || !myImmediateCacheFBO->IsValid()
+        || myImmediateCacheFBO->GetSizeX() != theWidth
+        || myImmediateCacheFBO->GetSizeY() != theHeight)
+  {
+    return false;
+  }
+
+  id<MTLTexture> aCacheColor = myImmediateCacheFBO->MetalColorTexture();
+  id<MTLTexture> aCacheDepth = myImmediateCacheFBO->MetalDepthTexture();
+  if (aCacheColor == nil || aCacheDepth == nil
+   || aCacheColor.pixelFormat != aTarget.pixelFormat
+   || aCacheDepth.pixelFormat != myDepthTexture.pixelFormat)
+  {
+    return false;
+  }
+
+  id<MTLBlitCommandEncoder> aBlit = [aCommandBuffer blitCommandEncoder];
+  if (aBlit == nil)
+  {
+    return false;
+  }
+  aBlit.label = theToSave ? @"SaveImmediateCache" : @"RestoreImmediateCache";
+  if (theToSave)
+  {
+    [aBlit copyFromTexture:aTarget toTexture:aCacheColor];
+    [aBlit copyFromTexture:myDepthTexture toTexture:aCacheDepth];
+  }
+  else
+  {
+    [aBlit copyFromTexture:aCacheColor toTexture:aTarget];
+    [aBlit copyFromTexture:aCacheDepth toTexture:myDepthTexture];
+  }
+  [aBlit endEncoding];
+  return true;
+}
+
+// =======================================================================
+// function : renderStructuresParallel
+// purpose  : Encode displayed structures by thread pool workers
+// =======================================================================
+bool Metal_View::renderStructuresParallel(void* theCmdBuffer,
+                                          void* theRenderPassDesc,
+                                          int theWidth,
+                                          int theHeight)
+{
+  const int aMinStructures = myContext->Caps()->parallelEncodingMinStructures;
+  if (NumberOfDisplayedStructures() < std::max(aMinStructures, 2))
+  {
+    return false;
+  }
+
+  // collect main pass items in drawing order; lazily created objects are created here by calling thread
+  const bool toUseIndirect = myContext->Caps()->useIndirectCommandBuffers
+                          && myContext->HasIndirectCommandBuffers();
+  NCollection_Vector<EncodeItem> anItems;
+  int aNbParallelItems = 0;
+  for (NCollection_List<occ::handle<Graphic3d_Layer>>::Iterator aLayerIter(myLayers);
+       aLayerIter.More(); aLayerIter.Next())
+  {
+    const occ::handle<Graphic3d_Layer>& aLayer = aLayerIter.Value();
+    if (aLayer.IsNull() || aLayer->NbStructures() == 0
+     || aLayer->IsImmediate() || aLayer->IsCulled())
+    {
+      // immediate layers are drawn by the separate pass
       continue;
     }
 
-    // Render structures in this layer by priority (lower priority first)
+    EncodeItem aLayerItem = { nullptr, nullptr, nullptr, false };
+    if (toUseIndirect && !aLayer->IsImmediate())
+    {
+      occ::handle<Metal_IndirectLayer>* anIndirect = myIndirectLayers.ChangeSeek(aLayer->LayerId());
+      if (anIndirect == nullptr)
+      {
+        anIndirect = myIndirectLayers.Bound(aLayer->LayerId(), new Metal_IndirectLayer());
+      }
+      aLayerItem.Layer = aLayer.get();
+      aLayerItem.Indirect = anIndirect->get();
+    }
+
     const Graphic3d_ArrayOfIndexedMapOfStructure& aStructArray = aLayer->ArrayOfStructures();
     for (int aPriorityIdx = 0; aPriorityIdx < Graphic3d_DisplayPriority_NB; ++aPriorityIdx)
     {
@@ -1387,48 +3018,172 @@ void Metal_View::renderStructures(Metal_Workspace* theWorkspace)
       for (int aStructIdx = 1; aStructIdx <= aStructMap.Extent(); ++aStructIdx)
       {
         const Graphic3d_CStructure* aCStruct = aStructMap.FindKey(aStructIdx);
-        if (aCStruct == nullptr || !aCStruct->IsVisible())
+        if (isStructureHidden(aCStruct, Identification()))
         {
           continue;
         }
 
-        const Metal_Structure* aMetalStruct = dynamic_cast<const Metal_Structure*>(aCStruct);
-        if (aMetalStruct != nullptr)
+        const Metal_Structure* aMetalStruct = static_cast<const Metal_Structure*>(aCStruct);
+
+        const bool isSerial = !isParallelEncodable(aMetalStruct);
+        if (aLayerItem.Indirect != nullptr)
         {
-          // Restore base model matrix and apply structure transformation
-          NCollection_Mat4<float> aModelMatrix = aBaseModelMatrix;
-          const NCollection_Mat4<float>& aStructTrsf = aMetalStruct->RenderTransformation();
-          aModelMatrix = aModelMatrix * aStructTrsf;
-          theWorkspace->SetModelMatrix(aModelMatrix);
-
-          // Check for highlighting
-          if (aCStruct->highlight != 0)
-          {
-            theWorkspace->SetHighlighting(true);
-            const occ::handle<Graphic3d_PresentationAttributes>& aHighStyle = aCStruct->HighlightStyle();
-            if (!aHighStyle.IsNull())
-            {
-              theWorkspace->SetHighlightColor(aHighStyle->ColorRGBA());
-            }
-          }
-
-          // Apply uniforms before rendering
-          theWorkspace->ApplyUniforms();
-          theWorkspace->ApplyLightingUniforms();
-          theWorkspace->ApplyMaterialUniforms();
-
-          // Render the structure (cast away const as Render is non-const in design)
-          const_cast<Metal_Structure*>(aMetalStruct)->Render(theWorkspace);
-
-          // Reset highlighting
-          theWorkspace->SetHighlighting(false);
+          // layer falling back from replay draws all its structures within the same chunk
+          aLayerItem.IsSerial = aLayerItem.IsSerial || isSerial;
+          continue;
         }
+
+        EncodeItem anItem = { nullptr, nullptr, aMetalStruct, isSerial };
+        anItems.Append(anItem);
+        aNbParallelItems += isSerial ? 0 : 1;
       }
     }
+    if (aLayerItem.Indirect != nullptr)
+    {
+      anItems.Append(aLayerItem);
+      aNbParallelItems += aLayerItem.IsSerial ? 0 : 1;
+    }
   }
 
-  // Restore original model matrix
-  theWorkspace->SetModelMatrix(aBaseModelMatrix);
+  const occ::handle<OSD_ThreadPool>& aPool = OSD_ThreadPool::DefaultPool();
+  OSD_ThreadPool::Launcher aLauncher(*aPool);
+  if (!aLauncher.HasThreads()
+   || aNbParallelItems < 2)
+  {
+    return false;
+  }
+
+  // split items into contiguous chunks keeping drawing order; serial items make own chunks
+  const int aChunkSize = std::max((aNbParallelItems + aLauncher.NbThreads() - 1) / aLauncher.NbThreads(),
+                                  THE_MIN_STRUCTURES_PER_CHUNK);
+  NCollection_Vector<EncodeChunk> aChunks;
+  NCollection_Vector<int> aParallelChunks;
+  for (int anItemIter = 0; anItemIter < anItems.Size(); ++anItemIter)
+  {
+    const bool isSerial = anItems.Value(anItemIter).IsSerial;
+    if (!aChunks.IsEmpty()
+     && aChunks.Last().IsSerial == isSerial
+     && (isSerial || aChunks.Last().Upper - aChunks.Last().Lower + 1 < aChunkSize))
+    {
+      aChunks.ChangeLast().Upper = anItemIter;
+      continue;
+    }
+
+    EncodeChunk aChunk = { anItemIter, anItemIter, isSerial };
+    aChunks.Append(aChunk);
+    if (!isSerial)
+    {
+      aParallelChunks.Append(aChunks.Upper());
+    }
+  }
+  if (aParallelChunks.Size() < 2)
+  {
+    return false;
+  }
+
+  id<MTLCommandBuffer> aCommandBuffer = (__bridge id<MTLCommandBuffer>)theCmdBuffer;
+  MTLRenderPassDescriptor* aRenderPassDesc = (__bridge MTLRenderPassDescriptor*)theRenderPassDesc;
+  id<MTLParallelRenderCommandEncoder> aParallelEncoder =
+    [aCommandBuffer parallelRenderCommandEncoderWithDescriptor:aRenderPassDesc];
+  if (aParallelEncoder == nil)
+  {
+    return false;
+  }
+
+  MTLViewport aViewport;
+  aViewport.originX = 0.0;
+  aViewport.originY = 0.0;
+  aViewport.width = theWidth;
+  aViewport.height = theHeight;
+  aViewport.znear = 0.0;
+  aViewport.zfar = 1.0;
+
+  // sub-encoders are executed in the order of their creation:
+  // background first, then chunks, then graduated trihedron
+  id<MTLRenderCommandEncoder> aBgEncoder = [aParallelEncoder renderCommandEncoder];
+  [aBgEncoder setViewport:aViewport];
+  if (drawVideoBackground((__bridge void*)aBgEncoder, theWidth, theHeight))
+  {
+    // video frame covers the whole viewport
+  }
+  else if (!myBgTexture.IsNull())
+  {
+    drawTexturedBackground((__bridge void*)aBgEncoder, theWidth, theHeight);
+  }
+  else if (myBgGradientMethod != Aspect_GradientFillMethod_None)
+  {
+    drawGradientBackground((__bridge void*)aBgEncoder, theWidth, theHeight);
+  }
+
+  // shared shader manager state (lights) is updated once by the calling thread
+  occ::handle<Metal_Workspace> aMainWorkspace = new Metal_Workspace(myContext.get(), this);
+  aMainWorkspace->SetEncoder(aBgEncoder);
+  aMainWorkspace->SetShaderManager(myContext->ShaderManager());
+  if (!myLights.IsNull())
+  {
+    aMainWorkspace->SetLightSources(myLights);
+  }
+  [aBgEncoder endEncoding];
+
+  NCollection_Vector<occ::handle<Metal_Workspace>> aWorkspaces;
+  for (int aChunkIter = 0; aChunkIter < aChunks.Size(); ++aChunkIter)
+  {
+    id<MTLRenderCommandEncoder> aSubEncoder = [aParallelEncoder renderCommandEncoder];
+    [aSubEncoder setViewport:aViewport];
+
+    occ::handle<Metal_Workspace> aWorkspace = new Metal_Workspace(myContext.get(), this);
+    aWorkspace->SetEncoder(aSubEncoder);
+    aWorkspace->SetShaderManager(myContext->ShaderManager());
+    if (!myCamera.IsNull())
+    {
+      aWorkspace->SetModelMatrix(myCamera->OrientationMatrixF());
+      aWorkspace->SetProjectionMatrix(mainProjectionMatrix());
+    }
+    aWorkspace->ApplyPipelineState();
+    aWorkspace->ApplyLightingUniforms();
+    if (myIsReducedPass)
+    {
+      aWorkspace->SetRenderFilter(Metal_RenderFilter_OpaqueOnly);
+    }
+    aWorkspaces.Append(aWorkspace);
+  }
+
+  id<MTLRenderCommandEncoder> aTrihedronEncoder = nil;
+  if (myToShowGradTrihedron)
+  {
+    aTrihedronEncoder = [aParallelEncoder renderCommandEncoder];
+    [aTrihedronEncoder setViewport:aViewport];
+  }
+
+  EncodeFunctor aFunctor(anItems, aChunks, aParallelChunks, aWorkspaces);
+  aLauncher.Perform(0, aParallelChunks.Size(), aFunctor);
+  aLauncher.Release();
+
+  // chunks with content not safe for worker threads
+  for (int aChunkIter = 0; aChunkIter < aChunks.Size(); ++aChunkIter)
+  {
+    if (aChunks.Value(aChunkIter).IsSerial)
+    {
+      encodeItems(aWorkspaces.Value(aChunkIter).get(), anItems, aChunks.Value(aChunkIter));
+      [aWorkspaces.Value(aChunkIter)->ActiveEncoder() endEncoding];
+    }
+  }
+
+  if (aTrihedronEncoder != nil)
+  {
+    aMainWorkspace->SetEncoder(aTrihedronEncoder);
+    if (!myCamera.IsNull())
+    {
+      aMainWorkspace->SetModelMatrix(myCamera->OrientationMatrixF());
+      aMainWorkspace->SetProjectionMatrix(mainProjectionMatrix());
+    }
+    aMainWorkspace->ApplyPipelineState();
+    myGraduatedTrihedron.Render(aMainWorkspace.get(), myGradTrihedronMin, myGradTrihedronMax);
+    [aTrihedronEncoder endEncoding];
+  }
+
+  [aParallelEncoder endEncoding];
+  return true;
 }
 
 // =======================================================================
@@ -1442,8 +3197,14 @@ void Metal_View::initDepthBuffer(int theWidth, int theHeight)
     return;
   }
 
+  // depth in tile memory only, when no later pass reads it
+  const bool toUseMemoryless = !myToStoreDepth
+                            && myContext->Caps()->useMemorylessAttachments
+                            && myContext->HasMemorylessRenderTargets();
+
   // Check if we need to resize
-  if (myDepthTexture != nil && myDepthWidth == theWidth && myDepthHeight == theHeight)
+  if (myDepthTexture != nil && myDepthWidth == theWidth && myDepthHeight == theHeight
+   && myIsDepthMemoryless == toUseMemoryless)
   {
     return;
   }
@@ -1455,6 +3216,20 @@ void Metal_View::initDepthBuffer(int theWidth, int theHeight)
                                                                                     mipmapped:NO];
   aDepthDesc.storageMode = MTLStorageModePrivate;
   aDepthDesc.usage = MTLTextureUsageRenderTarget;
+  myIsDepthMemoryless = false;
+  if (toUseMemoryless)
+  {
+    if (@available(macOS 11.0, iOS 10.0, *))
+    {
+      aDepthDesc.storageMode = MTLStorageModeMemoryless;
+      myIsDepthMemoryless = true;
+    }
+  }
+  else if (myContext->Caps()->useGpuCulling)
+  {
+    // read by depth pyramid construction for GPU occlusion culling
+    aDepthDesc.usage |= MTLTextureUsageShaderRead;
+  }
 
   myDepthTexture = [myContext->Device() newTextureWithDescriptor:aDepthDesc];
   myDepthWidth = theWidth;
@@ -1533,6 +3308,23 @@ void Metal_View::drawGradientBackground(void* theEncoderPtr, int theWidth, int t
                      vertexCount:3];
 }
 
+// =======================================================================
+// function : drawVideoBackground
+// purpose  : Draw video background
+// =======================================================================
+bool Metal_View::drawVideoBackground(void* theEncoderPtr, int theWidth, int theHeight)
+{
+  id<MTLRenderCommandEncoder> aRenderEncoder = (__bridge id<MTLRenderCommandEncoder>)theEncoderPtr;
+  if (aRenderEncoder == nil || myContext.IsNull() || myBgVideo.IsNull()
+  || !myBgVideo->Update(myContext.get()))
+  {
+    return false;
+  }
+
+  myBgVideo->DrawBackground(myContext.get(), aRenderEncoder, theWidth, theHeight, myBgImageStyle);
+  return true;
+}
+
 // =======================================================================
 // function : drawTexturedBackground
 // purpose  : Draw textured background
@@ -1545,7 +3337,15 @@ void Metal_View::drawTexturedBackground(void* theEncoderPtr, int theWidth, int t
     return;
   }
 
-  id<MTLRenderPipelineState> aPipeline = myContext->TexturedBackgroundPipeline();
+  // streamed texture is sampled with fallback to resident levels once they are uploaded
+  Metal_SparseTexture* aSparseBg = dynamic_cast<Metal_SparseTexture*>(myBgTexture.get());
+  if (aSparseBg != nullptr && !aSparseBg->IsReady())
+  {
+    return;
+  }
+  id<MTLRenderPipelineState> aPipeline = aSparseBg != nullptr
+                                       ? aSparseBg->BackgroundPipeline(myContext.get())
+                                       : myContext->TexturedBackgroundPipeline();
   if (aPipeline == nil)
   {
     return;
@@ -1557,7 +3357,7 @@ void Metal_View::drawTexturedBackground(void* theEncoderPtr, int theWidth, int t
     float textureOffset[2];
     float viewportSize[2];
     int   fillMethod;
-    int   padding;
+    float fallbackLod; //!< padding for regular texture
   } aUniforms;
 
   // Calculate texture scale based on fill method
@@ -1600,7 +3400,7 @@ void Metal_View::drawTexturedBackground(void* theEncoderPtr, int theWidth, int t
   aUniforms.textureOffset[1] = 0.0f;
   aUniforms.viewportSize[0] = aViewWidth;
   aUniforms.viewportSize[1] = aViewHeight;
-  aUniforms.padding = 0;
+  aUniforms.fallbackLod = aSparseBg != nullptr ? aSparseBg->FallbackLod() : 0.0f;
 
   // Set pipeline state
   [aRenderEncoder setRenderPipelineState:aPipeline];
@@ -1617,6 +3417,7 @@ void Metal_View::drawTexturedBackground(void* theEncoderPtr, int theWidth, int t
   MTLSamplerDescriptor* samplerDesc = [[MTLSamplerDescriptor alloc] init];
   samplerDesc.minFilter = MTLSamplerMinMagFilterLinear;
   samplerDesc.magFilter = MTLSamplerMinMagFilterLinear;
+  samplerDesc.mipFilter = myBgTexture->MipLevels() > 1 ? MTLSamplerMipFilterLinear : MTLSamplerMipFilterNotMipmapped;
   samplerDesc.sAddressMode = (myBgImageStyle == Aspect_FM_TILED) ? MTLSamplerAddressModeRepeat : MTLSamplerAddressModeClampToEdge;
   samplerDesc.tAddressMode = (myBgImageStyle == Aspect_FM_TILED) ? MTLSamplerAddressModeRepeat : MTLSamplerAddressModeClampToEdge;
 
@@ -27,6 +27,10 @@
 
 //! This class represents low-level wrapper over window with Metal layer.
 //! The window itself should be provided to constructor.
+//! Virtual window (Aspect_Window::IsVirtual()) or window without native handle
+//! (like Aspect_NeutralWindow) defines a headless window having no Metal layer -
+//! it only defines dimensions of offscreen target rendered by Metal_View,
+//! so that no window server connection is required.
 class Metal_Window : public Standard_Transient
 {
   DEFINE_STANDARD_RTTIEXT(Metal_Window, Standard_Transient)
@@ -80,6 +84,9 @@ public:
   //! Return drawable scale factor (Retina).
   float ScaleFactor() const { return myScaleFactor; }
 
+  //! Return TRUE if window has no Metal layer and frames should be rendered into offscreen target.
+  bool IsOffscreen() const { return myIsInitialized && myMetalLayer == nil; }
+
 public: //! @name Frame management
 
 #ifdef __OBJC__
@@ -97,6 +104,19 @@ public: //! @name Frame management
   //! Set VSync interval.
   Standard_EXPORT void SetSwapInterval(int theInterval);
 
+  //! Configure presentation of the Metal layer (see Metal_Caps::lowLatencyPacing and ::presentsWithTransaction).
+  //! Low-latency pacing limits the layer to two queued drawables instead of three.
+  //! Does nothing if the options have not been changed.
+  Standard_EXPORT void SetFramePacing(bool theIsLowLatency,
+                                      bool theToPresentWithTransaction);
+
+  //! Return TRUE if drawables should be presented synchronously with Core Animation transaction
+  //! (by Present() after command buffer is scheduled) instead of MTLCommandBuffer::presentDrawable.
+  bool PresentsWithTransaction() const { return myToPresentWithTransaction; }
+
+  //! Return refresh interval of the display showing the window in seconds (1/60 if unknown).
+  Standard_EXPORT double RefreshInterval() const;
+
 protected:
 
   occ::handle<Metal_Context> myContext;        //!< Metal context
@@ -117,6 +137,8 @@ protected:
   int                   myColorFormat;  //!< Color pixel format (MTLPixelFormat)
   int                   myDepthFormat;  //!< Depth pixel format (MTLPixelFormat)
   int                   mySwapInterval; //!< VSync interval
+  bool                  myIsLowLatency; //!< low-latency frame pacing flag
+  bool                  myToPresentWithTransaction; //!< present drawables with Core Animation transaction
   bool                  myIsInitialized; //!< Initialization flag
 };
 
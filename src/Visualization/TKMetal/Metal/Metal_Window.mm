@@ -46,6 +46,8 @@ Metal_Window::Metal_Window(const occ::handle<Metal_Context>& theContext,
   myColorFormat(80), // MTLPixelFormatBGRA8Unorm = 80
   myDepthFormat(252), // MTLPixelFormatDepth32Float = 252
   mySwapInterval(1),
+  myIsLowLatency(false),
+  myToPresentWithTransaction(false),
   myIsInitialized(false)
 {
   //
@@ -94,11 +96,15 @@ bool Metal_Window::Init()
     return false;
   }
 
-  // Get the native view from the platform window
+  // Get the native view from the platform window;
+  // virtual window or window without native view defines headless (offscreen) rendering
   void* aNativeHandle = (void*)myPlatformWindow->NativeHandle();
-  if (aNativeHandle == nullptr)
+  if (aNativeHandle == nullptr
+   || myPlatformWindow->IsVirtual())
   {
-    return false;
+    myIsInitialized = true;
+    Resize();
+    return true;
   }
 
 #if defined(TARGET_OS_IPHONE) && TARGET_OS_IPHONE
@@ -172,8 +178,9 @@ bool Metal_Window::Init()
   // For now, use linear color space for simplicity
   // myMetalLayer.pixelFormat = MTLPixelFormatBGRA8Unorm_sRGB;
 
-  // Configure framebuffer-only for better performance (can't read back)
-  myMetalLayer.framebufferOnly = YES;
+  // Drawables are not framebuffer-only, since they are copied into and restored from
+  // the cached image of non-immediate layers (see Metal_View::RedrawImmediate())
+  myMetalLayer.framebufferOnly = NO;
 
   // Configure display sync (VSync)
 #if defined(TARGET_OS_IPHONE) && TARGET_OS_IPHONE
@@ -198,7 +205,8 @@ bool Metal_Window::Init()
 // =======================================================================
 void Metal_Window::Resize()
 {
-  if (myMetalLayer == nil)
+  if (myMetalLayer == nil
+  && !IsOffscreen())
   {
     return;
   }
@@ -221,6 +229,13 @@ void Metal_Window::Resize()
 
   mySizePt.x() = aWidth;
   mySizePt.y() = aHeight;
+  if (myMetalLayer == nil)
+  {
+    // offscreen target is defined in pixels
+    myScaleFactor = 1.0f;
+    mySize = mySizePt;
+    return;
+  }
 
 #if defined(TARGET_OS_IPHONE) && TARGET_OS_IPHONE
   UIView* aView = nil;
@@ -307,3 +322,54 @@ void Metal_Window::SetSwapInterval(int theInterval)
   }
 #endif
 }
+
+// =======================================================================
+// function : SetFramePacing
+// purpose  : Configure presentation of the Metal layer
+// =======================================================================
+void Metal_Window::SetFramePacing(bool theIsLowLatency,
+                                  bool theToPresentWithTransaction)
+{
+  if (myMetalLayer == nil
+   || (myIsLowLatency == theIsLowLatency
+    && myToPresentWithTransaction == theToPresentWithTransaction))
+  {
+    return;
+  }
+
+  myIsLowLatency = theIsLowLatency;
+  myToPresentWithTransaction = theToPresentWithTransaction;
+  myMetalLayer.presentsWithTransaction = theToPresentWithTransaction ? YES : NO;
+
+  // nextDrawable blocks while all drawables are queued,
+  // so that a shorter queue keeps the frame being rendered closer to the display
+  if (@available(macOS 10.13.2, iOS 11.2, *))
+  {
+    myMetalLayer.maximumDrawableCount = theIsLowLatency ? 2 : 3;
+  }
+}
+
+// =======================================================================
+// function : RefreshInterval
+// purpose  : Return refresh interval of the display
+// =======================================================================
+double Metal_Window::RefreshInterval() const
+{
+  NSInteger aMaxFps = 0;
+#if defined(TARGET_OS_IPHONE) && TARGET_OS_IPHONE
+  if (@available(iOS 10.3, *))
+  {
+    aMaxFps = [UIScreen mainScreen].maximumFramesPerSecond;
+  }
+#else
+  if (@available(macOS 12.0, *))
+  {
+    NSScreen* aScreen = myNSView != nil && myNSView.window != nil ? myNSView.window.screen : nil;
+    if (aScreen != nil)
+    {
+      aMaxFps = aScreen.maximumFramesPerSecond;
+    }
+  }
+#endif
+  return aMaxFps > 0 ? 1.0 / double(aMaxFps) : 1.0 / 60.0;
+}
@@ -23,6 +23,7 @@
 #include <Graphic3d_SequenceOfHClipPlane.hxx>
 #include <Metal_RenderFilter.hxx>
 #include <Metal_GeometryEmulator.hxx>
+#include <Metal_ShaderManager.hxx>
 #include <NCollection_Mat4.hxx>
 #include <Quantity_ColorRGBA.hxx>
 #include <gp_Ax2.hxx>
@@ -41,6 +42,7 @@ class Metal_Context;
 class Metal_View;
 class Metal_ShaderManager;
 class Metal_Clipping;
+class Graphic3d_CStructure;
 
 //! Workspace for Metal rendering state management.
 //! Holds current render encoder and manages shader state.
@@ -97,6 +99,59 @@ public:
   //! Apply current pipeline state to encoder.
   Standard_EXPORT void ApplyPipelineState();
 
+  //! Apply mesh shader pipeline drawing Metal_MeshletBuffer for current aspect
+  //! and bind current uniforms to object and mesh stages.
+  //! Should be followed by RestorePipelineState() after the draw.
+  //! @return FALSE if current aspect has no mesh shader pipeline or device lacks mesh shaders
+  Standard_EXPORT bool ApplyMeshletPipelineState();
+
+  //! Apply pipeline drawing Metal_PrimitiveArray::RenderInstanced() for current aspect
+  //! (model-view matrix and color are taken from the instance buffer).
+  //! Should be followed by RestorePipelineState() after the draw.
+  //! @return FALSE if current aspect has no instanced pipeline
+  Standard_EXPORT bool ApplyInstancedPipelineState();
+
+  //! Apply tessellation pipeline evaluating Metal_BSplineSurface patches for current aspect
+  //! and bind current uniforms to vertex stage.
+  //! Should be followed by RestorePipelineState() after the draw.
+  //! @return FALSE if pipeline cannot be created
+  Standard_EXPORT bool ApplyBSplinePipelineState();
+
+  //! Apply point pipeline drawing Metal_PointCloud slots and bind current uniforms to vertex stage.
+  //! Should be followed by RestorePipelineState() after the draw.
+  //! @return FALSE if pipeline cannot be created
+  Standard_EXPORT bool ApplyPointCloudPipelineState();
+
+  //! Apply pipeline expanding line segments of Metal_PrimitiveArray into screen-space quads,
+  //! when current aspect defines line width greater than 1 pixel or non-solid line pattern,
+  //! and bind current uniforms, line attributes and clipping planes.
+  //! Should be followed by RestorePipelineState() after the draw.
+  //! @return FALSE for hairlines (drawn as line primitives) or if pipeline cannot be created
+  Standard_EXPORT bool ApplyWideLinePipelineState();
+
+  //! Apply variant of current aspect pipeline decoding nodal normals packed as octahedral vectors
+  //! (see Metal_PrimitiveArray::HasOctahedralNormals()); shading models not reading normals keep current pipeline.
+  //! Should be followed by RestorePipelineState() after the draw.
+  //! @return FALSE if pipeline cannot be created
+  Standard_EXPORT bool ApplyOctNormalsPipelineState();
+
+  //! Set classic pipeline of current aspect again, after ApplyMeshletPipelineState(), ApplyInstancedPipelineState(),
+  //! ApplyBSplinePipelineState(), ApplyPointCloudPipelineState(), ApplyWideLinePipelineState()
+  //! or ApplyOctNormalsPipelineState().
+  Standard_EXPORT void RestorePipelineState();
+
+  //! Return TRUE if back faces are culled for current aspect.
+  Standard_EXPORT bool ToCullBackFaces() const;
+
+  //! Forget pipeline and depth-stencil states cached for active encoder,
+  //! so that next Apply*State() call sets them again (e.g. after executing indirect command buffer).
+  void InvalidateEncoderState()
+  {
+    myCurrentPipeline = nullptr;
+    myDepthStencilState = nullptr;
+    myIsLightingBound = false;
+  }
+
   //! Apply current uniform data (matrices, colors) to encoder.
   Standard_EXPORT void ApplyUniforms();
 
@@ -130,6 +185,20 @@ public:
   //! Update clipping planes for rendering.
   Standard_EXPORT void SetClippingPlanes(const Graphic3d_SequenceOfHClipPlane& thePlanes);
 
+  //! Select planes of the view and of the structure crossing the structure bounding box
+  //! (see Metal_Clipping::SelectPlanes()) for following draws until ResetStructureClipping().
+  //! @return FALSE if the structure is entirely clipped and should be skipped
+  Standard_EXPORT bool SetStructureClipping(const Graphic3d_CStructure* theStruct);
+
+  //! Restore clipping planes of the view for following draws.
+  void ResetStructureClipping() { myHasStructClipping = false; }
+
+  //! Return clipping planes applied to current draws.
+  const Metal_ClipPlaneUniforms& ClipPlaneUniforms() const
+  {
+    return myHasStructClipping || myShaderManager == nullptr ? myStructClipUniforms : myShaderManager->ClipPlaneUniforms();
+  }
+
   //! Return current shading model.
   Graphic3d_TypeOfShadingModel ShadingModel() const { return myShadingModel; }
 
@@ -137,6 +206,7 @@ public:
   void SetShadingModel(Graphic3d_TypeOfShadingModel theModel) { myShadingModel = theModel; }
 
   //! Apply lighting uniforms to encoder.
+  //! Lighting is bound only once per encoder, until light sources are changed.
   Standard_EXPORT void ApplyLightingUniforms();
 
   //! Apply clipping uniforms to encoder.
@@ -145,8 +215,13 @@ public:
   //! Apply material uniforms to encoder for material-aware shaders.
   //! This includes Phong materials with front/back face distinction,
   //! PBR materials, and alpha cutoff settings.
+  //! With Metal_BindlessTable available, binds material table entry instead of copying uniforms.
   Standard_EXPORT void ApplyMaterialUniforms();
 
+  //! Return material uniforms of the current aspect (see SetAspect()).
+  //! Kept per workspace, so that workspaces of parallel encoding do not share them.
+  const Metal_MaterialUniforms& MaterialUniforms() const { return myMaterialUniforms; }
+
   //! Set edge rendering mode.
   void SetEdgeRendering(bool theValue) { myIsEdgeRendering = theValue; }
 
@@ -283,6 +358,22 @@ public: //! @name Layer rendering support
   //! Increment skipped transparent elements counter.
   void IncrementSkippedCounter() { ++myNbSkippedTransparent; }
 
+protected:
+
+  //! Resolve shading model and program bits of classic pipeline for current aspect.
+  Standard_EXPORT void currentProgram(Graphic3d_TypeOfShadingModel& theModel,
+                                      int& theBits) const;
+
+  //! Bind uniform block at vertex and fragment buffer indices (-1 to skip one of them).
+  //! The block is placed into uniform ring of the context (see Metal_UniformRing),
+  //! or copied into command stream when the ring is unavailable or exhausted.
+  //! @param theIsShared when TRUE, identical blocks are written into the ring only once per frame
+  Standard_EXPORT void bindUniformBlock(const void* theData,
+                                        size_t theSize,
+                                        int theVertexIndex,
+                                        int theFragmentIndex,
+                                        bool theIsShared);
+
 protected:
 
   Metal_Context* myContext;      //!< Metal context
@@ -299,6 +390,7 @@ protected:
 #endif
 
   occ::handle<Graphic3d_Aspects> myAspect;           //!< current aspect
+  Metal_MaterialUniforms         myMaterialUniforms; //!< material uniforms of current aspect
   NCollection_Mat4<float>        myModelMatrix;      //!< model-view matrix
   NCollection_Mat4<float>        myProjectionMatrix; //!< projection matrix
   Quantity_ColorRGBA             myHighlightColor;   //!< highlight color
@@ -316,6 +408,9 @@ protected:
 
   Metal_ShaderManager*           myShaderManager;    //!< shader manager
   Metal_Clipping*                myClipping;         //!< clipping manager
+  Metal_ClipPlaneUniforms        myStructClipUniforms; //!< clipping planes selected for current structure
+  bool                           myHasStructClipping; //!< myStructClipUniforms override planes of the view
+  bool                           myIsClipOverflowReported; //!< warning on too many planes has been reported
   Graphic3d_TypeOfShadingModel   myShadingModel;     //!< current shading model
   occ::handle<Graphic3d_LightSet> myLightSources;    //!< current light sources
   Metal_RenderFilter             myRenderFilter;     //!< current render filter
@@ -325,6 +420,9 @@ protected:
   Graphic3d_PolygonOffset        myPolygonOffset;    //!< current polygon offset
   bool                           myUseDepthWrite;    //!< depth write flag
   int                            myNbSkippedTransparent; //!< number of skipped transparent elements
+  size_t                         myBindlessRevision; //!< revision of bindless table bound to current encoder
+  bool                           myIsBindlessBound;  //!< bindless table has been bound to current encoder
+  bool                           myIsLightingBound;  //!< lighting uniforms have been bound to current encoder
   std::vector<NCollection_Mat4<float>> myModelMatrixStack; //!< model matrix stack for push/pop
 };
 
@@ -20,10 +20,43 @@
 #include <Metal_ShaderManager.hxx>
 #include <Metal_Clipping.hxx>
 #include <Metal_Material.hxx>
+#include <Metal_UniformRing.hxx>
 #include <Aspect_InteriorStyle.hxx>
+#include <Graphic3d_CStructure.hxx>
+
+#include <algorithm>
+#include <cstring>
 
 IMPLEMENT_STANDARD_RTTIEXT(Metal_Workspace, Standard_Transient)
 
+namespace
+{
+  //! Legacy uniforms block (should match Uniforms in Metal_ShaderManager shaders).
+  struct Metal_LegacyUniforms
+  {
+    float modelViewMatrix[16];
+    float projectionMatrix[16];
+    float color[4];
+  };
+
+  //! Fill legacy uniforms block.
+  static void fillLegacyUniforms(Metal_LegacyUniforms& theUniforms,
+                                 const NCollection_Mat4<float>& theModelView,
+                                 const NCollection_Mat4<float>& theProjection,
+                                 const Quantity_ColorRGBA& theColor)
+  {
+    for (int i = 0; i < 16; ++i)
+    {
+      theUniforms.modelViewMatrix[i] = theModelView.GetData()[i];
+      theUniforms.projectionMatrix[i] = theProjection.GetData()[i];
+    }
+    theUniforms.color[0] = theColor.GetRGB().Red();
+    theUniforms.color[1] = theColor.GetRGB().Green();
+    theUniforms.color[2] = theColor.GetRGB().Blue();
+    theUniforms.color[3] = theColor.Alpha();
+  }
+}
+
 // =======================================================================
 // function : Metal_Workspace
 // purpose  : Constructor
@@ -46,13 +79,19 @@ Metal_Workspace::Metal_Workspace(Metal_Context* theCtx, Metal_View* theView)
   myMeshEdgesColor(0.0f, 0.0f, 0.0f, 1.0f),
   myShaderManager(nullptr),
   myClipping(nullptr),
+  myHasStructClipping(false),
+  myIsClipOverflowReported(false),
   myShadingModel(Graphic3d_TypeOfShadingModel_Phong),
   myRenderFilter(Metal_RenderFilter_Empty),
   myUseDepthWrite(true),
-  myNbSkippedTransparent(0)
+  myNbSkippedTransparent(0),
+  myBindlessRevision(0),
+  myIsBindlessBound(false),
+  myIsLightingBound(false)
 {
   myModelMatrix.InitIdentity();
   myProjectionMatrix.InitIdentity();
+  memset(&myStructClipUniforms, 0, sizeof(myStructClipUniforms));
 }
 
 // =======================================================================
@@ -73,6 +112,8 @@ Metal_Workspace::~Metal_Workspace()
 void Metal_Workspace::SetEncoder(id<MTLRenderCommandEncoder> theEncoder)
 {
   myEncoder = theEncoder;
+  myIsBindlessBound = false;
+  myIsLightingBound = false;
 }
 
 // =======================================================================
@@ -98,8 +139,8 @@ void Metal_Workspace::SetAspect(const occ::handle<Graphic3d_Aspects>& theAspect)
                            theAspect->AlphaMode() == Graphic3d_AlphaMode_Mask)
                         ? theAspect->AlphaCutoff() : 2.0f; // > 1.0 means disabled
 
-    // Set material uniforms in shader manager
-    myShaderManager->SetMaterialUniforms(aMaterial, anAlphaCutoff, aToDistinguish, aIsPBR);
+    // Keep material uniforms within workspace (shader manager is shared by parallel workspaces)
+    Metal_ShaderManager::FillMaterialUniforms(myMaterialUniforms, aMaterial, anAlphaCutoff, aToDistinguish, aIsPBR);
   }
 }
 
@@ -123,17 +164,8 @@ void Metal_Workspace::ApplyPipelineState()
     // Determine shading model from aspect
     Graphic3d_TypeOfShadingModel aShadingModel = Graphic3d_TypeOfShadingModel_Phong;
     int aShaderFlags = 0;
-
-    if (!myAspect.IsNull())
-    {
-      aShadingModel = myAspect->ShadingModel();
-      // If DEFAULT (-1), use Phong (the viewer's default shading model)
-      if (aShadingModel == Graphic3d_TypeOfShadingModel_DEFAULT)
-      {
-        aShadingModel = Graphic3d_TypeOfShadingModel_Phong;
-      }
-      NSLog(@"Metal_Workspace::ApplyPipelineState: aspect shading model = %d (adjusted)", (int)aShadingModel);
-    }
+    currentProgram(aShadingModel, aShaderFlags);
+    NSLog(@"Metal_Workspace::ApplyPipelineState: aspect shading model = %d (adjusted)", (int)aShadingModel);
 
     // Get the appropriate pipeline from shader manager
     if (myShaderManager->GetProgram(aShadingModel, aShaderFlags, aPipeline, aDepthState))
@@ -172,81 +204,327 @@ void Metal_Workspace::ApplyPipelineState()
   }
 
   // Set cull mode based on aspect
+  [myEncoder setCullMode:ToCullBackFaces() ? MTLCullModeBack : MTLCullModeNone];
+}
+
+// =======================================================================
+// function : currentProgram
+// purpose  : Resolve shading model and program bits for current aspect
+// =======================================================================
+void Metal_Workspace::currentProgram(Graphic3d_TypeOfShadingModel& theModel,
+                                     int& theBits) const
+{
+  theModel = Graphic3d_TypeOfShadingModel_Phong;
+  theBits  = 0;
   if (!myAspect.IsNull())
   {
-    // For now, use back-face culling for solid geometry
-    if (myAspect->ToDrawEdges() && !myAspect->ToDrawSilhouette())
+    theModel = myAspect->ShadingModel();
+    // If DEFAULT (-1), use Phong (the viewer's default shading model)
+    if (theModel == Graphic3d_TypeOfShadingModel_DEFAULT)
     {
-      [myEncoder setCullMode:MTLCullModeNone];
+      theModel = Graphic3d_TypeOfShadingModel_Phong;
+    }
+  }
+
+  // view clipping planes are bound together with material uniforms (fragment buffer 3),
+  // which only material shading models use
+  if (ClipPlaneUniforms().PlaneCount > 0
+   && theModel != Graphic3d_TypeOfShadingModel_Unlit
+   && theModel != Graphic3d_TypeOfShadingModel_Gouraud)
+  {
+    theBits |= Graphic3d_ShaderFlags_ClipPlanesN;
+  }
+}
+
+// =======================================================================
+// function : ToCullBackFaces
+// purpose  : Return TRUE if back faces are culled for current aspect
+// =======================================================================
+bool Metal_Workspace::ToCullBackFaces() const
+{
+  // For now, use back-face culling for solid geometry
+  return myAspect.IsNull()
+     || !myAspect->ToDrawEdges()
+     ||  myAspect->ToDrawSilhouette();
+}
+
+// =======================================================================
+// function : ApplyMeshletPipelineState
+// purpose  : Apply mesh shader pipeline for Metal_MeshletBuffer
+// =======================================================================
+bool Metal_Workspace::ApplyMeshletPipelineState()
+{
+  if (myEncoder == nil
+   || myContext == nullptr
+   || myShaderManager == nullptr
+   || !myContext->HasMeshShaders())
+  {
+    return false;
+  }
+
+  // same shading model as ApplyPipelineState()
+  Graphic3d_TypeOfShadingModel aShadingModel = Graphic3d_TypeOfShadingModel_Phong;
+  if (!myAspect.IsNull()
+    && myAspect->ShadingModel() != Graphic3d_TypeOfShadingModel_DEFAULT)
+  {
+    aShadingModel = myAspect->ShadingModel();
+  }
+
+  id<MTLRenderPipelineState> aPipeline = nil;
+  if (!myShaderManager->GetMeshletProgram(aShadingModel, 0, aPipeline))
+  {
+    return false;
+  }
+  if (aPipeline != myCurrentPipeline)
+  {
+    [myEncoder setRenderPipelineState:aPipeline];
+    myCurrentPipeline = aPipeline;
+  }
+
+  // object and mesh stages read the same uniforms as vertex stage at buffer(1)
+  Metal_LegacyUniforms aUniforms;
+  fillLegacyUniforms(aUniforms, myModelMatrix, myProjectionMatrix,
+                     myIsHighlighting ? myHighlightColor
+                                      : (!myAspect.IsNull() ? myAspect->InteriorColorRGBA() : Quantity_ColorRGBA(1.0f, 1.0f, 1.0f, 1.0f)));
+  if (@available(macOS 13.0, iOS 16.0, *))
+  {
+    Metal_UniformRing* aRing = myContext->UniformRing().get();
+    id<MTLBuffer> aBuffer = nil;
+    size_t anOffset = 0;
+    if (aRing != nullptr
+     && aRing->Allocate(&aUniforms, sizeof(aUniforms), aBuffer, anOffset))
+    {
+      [myEncoder setObjectBuffer:aBuffer offset:anOffset atIndex:1];
+      [myEncoder setMeshBuffer:aBuffer offset:anOffset atIndex:1];
     }
     else
     {
-      [myEncoder setCullMode:MTLCullModeBack];
+      [myEncoder setObjectBytes:&aUniforms length:sizeof(aUniforms) atIndex:1];
+      [myEncoder setMeshBytes:&aUniforms length:sizeof(aUniforms) atIndex:1];
     }
   }
-  else
+  return true;
+}
+
+// =======================================================================
+// function : ApplyInstancedPipelineState
+// purpose  : Apply pipeline for instanced draws
+// =======================================================================
+bool Metal_Workspace::ApplyInstancedPipelineState()
+{
+  if (myEncoder == nil
+   || myShaderManager == nullptr)
   {
-    [myEncoder setCullMode:MTLCullModeBack];
+    return false;
+  }
+
+  // same shading model as ApplyPipelineState()
+  Graphic3d_TypeOfShadingModel aShadingModel = Graphic3d_TypeOfShadingModel_Phong;
+  if (!myAspect.IsNull()
+    && myAspect->ShadingModel() != Graphic3d_TypeOfShadingModel_DEFAULT)
+  {
+    aShadingModel = myAspect->ShadingModel();
+  }
+
+  id<MTLRenderPipelineState> aPipeline = nil;
+  if (!myShaderManager->GetInstancedProgram(aShadingModel, 0, aPipeline))
+  {
+    return false;
+  }
+  if (aPipeline != myCurrentPipeline)
+  {
+    [myEncoder setRenderPipelineState:aPipeline];
+    myCurrentPipeline = aPipeline;
   }
+  return true;
 }
 
 // =======================================================================
-// function : ApplyUniforms
-// purpose  : Apply uniform data to encoder
+// function : ApplyBSplinePipelineState
+// purpose  : Apply tessellation pipeline of B-spline surfaces
 // =======================================================================
-void Metal_Workspace::ApplyUniforms()
+bool Metal_Workspace::ApplyBSplinePipelineState()
 {
-  if (myEncoder == nil)
+  if (myEncoder == nil
+   || myShaderManager == nullptr)
   {
-    return;
+    return false;
   }
 
-  // Create uniform buffer with matrices and material properties
-  struct Uniforms
+  // same shading model as ApplyPipelineState()
+  Graphic3d_TypeOfShadingModel aShadingModel = Graphic3d_TypeOfShadingModel_Phong;
+  if (!myAspect.IsNull()
+    && myAspect->ShadingModel() != Graphic3d_TypeOfShadingModel_DEFAULT)
   {
-    float modelViewMatrix[16];
-    float projectionMatrix[16];
-    float color[4];
-  } aUniforms;
+    aShadingModel = myAspect->ShadingModel();
+  }
 
-  // Copy matrices
-  for (int i = 0; i < 16; ++i)
+  id<MTLRenderPipelineState> aPipeline = nil;
+  if (!myShaderManager->GetBSplineProgram(aShadingModel, 0, aPipeline))
   {
-    aUniforms.modelViewMatrix[i] = myModelMatrix.GetData()[i];
-    aUniforms.projectionMatrix[i] = myProjectionMatrix.GetData()[i];
+    return false;
+  }
+  if (aPipeline != myCurrentPipeline)
+  {
+    [myEncoder setRenderPipelineState:aPipeline];
+    myCurrentPipeline = aPipeline;
   }
 
-  // Get color from aspect or use default
-  if (!myAspect.IsNull())
+  // post-tessellation vertex function reads legacy uniforms at buffer(1)
+  ApplyUniforms();
+  return true;
+}
+
+// =======================================================================
+// function : ApplyPointCloudPipelineState
+// purpose  : Apply point pipeline of point cloud slots
+// =======================================================================
+bool Metal_Workspace::ApplyPointCloudPipelineState()
+{
+  if (myEncoder == nil
+   || myShaderManager == nullptr)
   {
-    Quantity_ColorRGBA aColor = myAspect->InteriorColorRGBA();
-    if (myIsHighlighting)
-    {
-      aColor = myHighlightColor;
-    }
-    aUniforms.color[0] = aColor.GetRGB().Red();
-    aUniforms.color[1] = aColor.GetRGB().Green();
-    aUniforms.color[2] = aColor.GetRGB().Blue();
-    aUniforms.color[3] = aColor.Alpha();
+    return false;
   }
-  else
+
+  id<MTLRenderPipelineState> aPipeline = nil;
+  if (!myShaderManager->GetPointCloudProgram(0, aPipeline))
   {
-    aUniforms.color[0] = 1.0f;
-    aUniforms.color[1] = 1.0f;
-    aUniforms.color[2] = 1.0f;
-    aUniforms.color[3] = 1.0f;
+    return false;
+  }
+  if (aPipeline != myCurrentPipeline)
+  {
+    [myEncoder setRenderPipelineState:aPipeline];
+    myCurrentPipeline = aPipeline;
   }
 
-  // Pass uniforms to vertex shader at buffer index 1
-  // (buffer index 0 is typically for vertex data)
-  [myEncoder setVertexBytes:&aUniforms
-                     length:sizeof(aUniforms)
-                    atIndex:1];
+  // point cloud vertex function reads legacy uniforms at buffer(1) for aspect color
+  ApplyUniforms();
+  return true;
+}
 
-  // Pass uniforms to fragment shader as well
-  [myEncoder setFragmentBytes:&aUniforms
-                       length:sizeof(aUniforms)
-                      atIndex:0];
+// =======================================================================
+// function : ApplyWideLinePipelineState
+// purpose  : Apply pipeline drawing line segments as screen-space quads
+// =======================================================================
+bool Metal_Workspace::ApplyWideLinePipelineState()
+{
+  if (myEncoder == nil
+   || myContext == nullptr
+   || myShaderManager == nullptr
+   || myAspect.IsNull()
+   || (myAspect->LineWidth() <= 1.0f && myAspect->LinePattern() == 0xFFFF))
+  {
+    return false;
+  }
+
+  // unlike unlit pipeline, line fragment stage applies clipping planes itself
+  const Metal_ClipPlaneUniforms& aClipUniforms = ClipPlaneUniforms();
+  const int aShaderFlags = aClipUniforms.PlaneCount > 0 ? Graphic3d_ShaderFlags_ClipPlanesN : 0;
+  id<MTLRenderPipelineState> aPipeline = nil;
+  if (!myShaderManager->GetWideLineProgram(aShaderFlags, aPipeline))
+  {
+    return false;
+  }
+  if (aPipeline != myCurrentPipeline)
+  {
+    [myEncoder setRenderPipelineState:aPipeline];
+    myCurrentPipeline = aPipeline;
+  }
+  // quads of segments have arbitrary winding
+  [myEncoder setCullMode:MTLCullModeNone];
+
+  ApplyUniforms();
+
+  const int* aViewport = myContext->Viewport();
+  Metal_LineUniforms aLineUniforms;
+  memset(&aLineUniforms, 0, sizeof(aLineUniforms));
+  aLineUniforms.Width       = std::max(myAspect->LineWidth(), 1.0f);
+  aLineUniforms.Feather     = 1.0f;
+  aLineUniforms.Pattern     = myAspect->LinePattern();
+  aLineUniforms.Factor      = std::max<uint32_t>(myAspect->LineStippleFactor(), 1);
+  aLineUniforms.Viewport[0] = float(std::max(aViewport[2], 1));
+  aLineUniforms.Viewport[1] = float(std::max(aViewport[3], 1));
+  bindUniformBlock(&aLineUniforms, sizeof(aLineUniforms), 11, 11, false);
+  if (aClipUniforms.PlaneCount > 0)
+  {
+    bindUniformBlock(&aClipUniforms, sizeof(aClipUniforms), -1, 2, true);
+  }
+  return true;
+}
+
+// =======================================================================
+// function : ApplyOctNormalsPipelineState
+// purpose  : Apply pipeline decoding octahedral normals
+// =======================================================================
+bool Metal_Workspace::ApplyOctNormalsPipelineState()
+{
+  if (myEncoder == nil
+   || myShaderManager == nullptr)
+  {
+    return false;
+  }
+
+  Graphic3d_TypeOfShadingModel aShadingModel = Graphic3d_TypeOfShadingModel_Phong;
+  int aShaderFlags = 0;
+  currentProgram(aShadingModel, aShaderFlags);
+  if (aShadingModel == Graphic3d_TypeOfShadingModel_Unlit
+   || aShadingModel == Graphic3d_TypeOfShadingModel_PhongFacet)
+  {
+    // vertex stage of these models does not read normals
+    return true;
+  }
+
+  id<MTLRenderPipelineState> aPipeline = nil;
+  id<MTLDepthStencilState> aDepthState = nil;
+  if (!myShaderManager->GetProgram(aShadingModel, aShaderFlags | Metal_ProgramBits_OctNormals,
+                                   aPipeline, aDepthState)
+   || aPipeline == nil)
+  {
+    return false;
+  }
+  if (aPipeline != myCurrentPipeline)
+  {
+    [myEncoder setRenderPipelineState:aPipeline];
+    myCurrentPipeline = aPipeline;
+  }
+  return true;
+}
+
+// =======================================================================
+// function : RestorePipelineState
+// purpose  : Restore classic pipeline after mesh shader draw
+// =======================================================================
+void Metal_Workspace::RestorePipelineState()
+{
+  myCurrentPipeline = nil;
+  ApplyPipelineState();
+}
+
+// =======================================================================
+// function : ApplyUniforms
+// purpose  : Apply uniform data to encoder
+// =======================================================================
+void Metal_Workspace::ApplyUniforms()
+{
+  if (myEncoder == nil)
+  {
+    return;
+  }
+
+  // Get color from aspect or use default
+  Quantity_ColorRGBA aColor(1.0f, 1.0f, 1.0f, 1.0f);
+  if (!myAspect.IsNull())
+  {
+    aColor = myIsHighlighting ? myHighlightColor : myAspect->InteriorColorRGBA();
+  }
+
+  Metal_LegacyUniforms aUniforms;
+  fillLegacyUniforms(aUniforms, myModelMatrix, myProjectionMatrix, aColor);
+
+  // Pass uniforms to vertex shader at buffer index 1
+  // (buffer index 0 is typically for vertex data) and to fragment shader at index 0
+  bindUniformBlock(&aUniforms, sizeof(aUniforms), 1, 0, false);
 }
 
 // =======================================================================
@@ -256,6 +534,7 @@ void Metal_Workspace::ApplyUniforms()
 void Metal_Workspace::SetLightSources(const occ::handle<Graphic3d_LightSet>& theLights)
 {
   myLightSources = theLights;
+  myIsLightingBound = false;
 
   // Update shader manager if available
   if (myShaderManager != nullptr)
@@ -284,28 +563,70 @@ void Metal_Workspace::SetClippingPlanes(const Graphic3d_SequenceOfHClipPlane& th
   }
 }
 
+// =======================================================================
+// function : SetStructureClipping
+// purpose  : Select clipping planes crossing the structure
+// =======================================================================
+bool Metal_Workspace::SetStructureClipping(const Graphic3d_CStructure* theStruct)
+{
+  const occ::handle<Graphic3d_SequenceOfHClipPlane>& anObjPlanes = theStruct->ClipPlanes();
+  const occ::handle<Graphic3d_SequenceOfHClipPlane> aViewPlanes =
+    myView != nullptr ? myView->ClipPlanes() : occ::handle<Graphic3d_SequenceOfHClipPlane>();
+  const bool hasObjPlanes = !anObjPlanes.IsNull() && !anObjPlanes->IsEmpty();
+  const bool hasViewPlanes = !aViewPlanes.IsNull() && !aViewPlanes->IsEmpty()
+                          && (!hasObjPlanes || !anObjPlanes->ToOverrideGlobal());
+  if (!hasObjPlanes && !hasViewPlanes)
+  {
+    myHasStructClipping = false;
+    return true;
+  }
+
+  // bounding box of structures with transformation persistence is not in world space
+  const Graphic3d_BndBox3d& aBox = theStruct->BoundingBox();
+  const bool toProbeBox = aBox.IsValid()
+                       && theStruct->BndBoxClipCheck()
+                       && theStruct->TransformPersistence().IsNull()
+                       && !theStruct->HasGroupTransformPersistence();
+  int aNbDropped = 0;
+  const Graphic3d_ClipState aState = Metal_Clipping::SelectPlanes(hasViewPlanes ? aViewPlanes.get() : nullptr,
+                                                                  hasObjPlanes  ? anObjPlanes.get() : nullptr,
+                                                                  toProbeBox ? &aBox : nullptr,
+                                                                  myStructClipUniforms, aNbDropped);
+  myHasStructClipping = true;
+  if (aNbDropped > 0 && !myIsClipOverflowReported)
+  {
+    myIsClipOverflowReported = true;
+    myContext->Messenger()->SendWarning() << "Metal_Workspace: " << aNbDropped << " clipping planes crossing the object above "
+                                          << Metal_MaxClipPlanes << " are ignored";
+  }
+  return aState != Graphic3d_ClipState_Out;
+}
+
 // =======================================================================
 // function : ApplyLightingUniforms
 // purpose  : Apply lighting uniforms to encoder
 // =======================================================================
 void Metal_Workspace::ApplyLightingUniforms()
 {
-  if (myEncoder == nil || myShaderManager == nullptr)
+  if (myEncoder == nil || myShaderManager == nullptr || myIsLightingBound)
   {
     return;
   }
 
   const Metal_LightUniforms& aLightUniforms = myShaderManager->LightUniforms();
 
-  // Pass lighting uniforms to fragment shader at buffer index 1
-  [myEncoder setFragmentBytes:&aLightUniforms
-                       length:sizeof(aLightUniforms)
-                      atIndex:1];
+  // Pass lighting uniforms to fragment shader at buffer index 1,
+  // and also to vertex shader for Gouraud shading at index 3
+  bindUniformBlock(&aLightUniforms, sizeof(aLightUniforms), 3, 1, true);
 
-  // Also pass to vertex shader for Gouraud shading
-  [myEncoder setVertexBytes:&aLightUniforms
-                     length:sizeof(aLightUniforms)
-                    atIndex:3];
+  // Pass shadow uniforms and shadow map to material shaders at buffer index 5 and texture index 7
+  if (myView != nullptr && !myView->ActiveShadowMap().IsNull())
+  {
+    const Metal_ShadowUniforms& aShadowUniforms = myView->ShadowUniforms();
+    bindUniformBlock(&aShadowUniforms, sizeof(aShadowUniforms), -1, 5, true);
+    [myEncoder setFragmentTexture:myView->ActiveShadowMap()->DepthTexture() atIndex:7];
+  }
+  myIsLightingBound = true;
 }
 
 // =======================================================================
@@ -319,14 +640,12 @@ void Metal_Workspace::ApplyClippingUniforms()
     return;
   }
 
-  const Metal_ClipPlaneUniforms& aClipUniforms = myShaderManager->ClipPlaneUniforms();
+  const Metal_ClipPlaneUniforms& aClipUniforms = ClipPlaneUniforms();
 
   if (aClipUniforms.PlaneCount > 0)
   {
     // Pass clipping uniforms to fragment shader at buffer index 2
-    [myEncoder setFragmentBytes:&aClipUniforms
-                         length:sizeof(aClipUniforms)
-                        atIndex:2];
+    bindUniformBlock(&aClipUniforms, sizeof(aClipUniforms), -1, 2, true);
   }
 }
 
@@ -341,20 +660,31 @@ void Metal_Workspace::ApplyMaterialUniforms()
     return;
   }
 
-  const Metal_MaterialUniforms& aMaterialUniforms = myShaderManager->MaterialUniforms();
-
-  // Pass material uniforms to fragment shader at buffer index 2
-  [myEncoder setFragmentBytes:&aMaterialUniforms
-                       length:sizeof(aMaterialUniforms)
-                      atIndex:2];
+  const Metal_MaterialUniforms& aMaterialUniforms = myMaterialUniforms;
+  const occ::handle<Metal_BindlessTable>& aBindless = myContext->BindlessTable();
+  const int aMaterialIndex = !aBindless.IsNull() ? aBindless->AddMaterial(myContext, aMaterialUniforms) : -1;
+  if (aMaterialIndex >= 0)
+  {
+    if (!myIsBindlessBound || myBindlessRevision != aBindless->Revision())
+    {
+      aBindless->Bind(myEncoder);
+      myIsBindlessBound = true;
+      myBindlessRevision = aBindless->Revision();
+    }
+    // select material table entry at buffer index 2
+    aBindless->BindMaterial(myEncoder, aMaterialIndex);
+  }
+  else
+  {
+    // Pass material uniforms to fragment shader at buffer index 2
+    bindUniformBlock(&aMaterialUniforms, sizeof(aMaterialUniforms), -1, 2, true);
+  }
 
   // If clipping is active and material shaders are used, bind clipping at index 3
-  const Metal_ClipPlaneUniforms& aClipUniforms = myShaderManager->ClipPlaneUniforms();
+  const Metal_ClipPlaneUniforms& aClipUniforms = ClipPlaneUniforms();
   if (aClipUniforms.PlaneCount > 0)
   {
-    [myEncoder setFragmentBytes:&aClipUniforms
-                         length:sizeof(aClipUniforms)
-                        atIndex:3];
+    bindUniformBlock(&aClipUniforms, sizeof(aClipUniforms), -1, 3, true);
   }
 }
 
@@ -369,35 +699,53 @@ void Metal_Workspace::ApplyEdgeUniforms()
     return;
   }
 
-  // Create uniform buffer with matrices and edge color
-  struct Uniforms
-  {
-    float modelViewMatrix[16];
-    float projectionMatrix[16];
-    float color[4];
-  } aUniforms;
-
-  // Copy matrices
-  for (int i = 0; i < 16; ++i)
-  {
-    aUniforms.modelViewMatrix[i] = myModelMatrix.GetData()[i];
-    aUniforms.projectionMatrix[i] = myProjectionMatrix.GetData()[i];
-  }
-
   // Use edge color
-  aUniforms.color[0] = myEdgeColor.GetRGB().Red();
-  aUniforms.color[1] = myEdgeColor.GetRGB().Green();
-  aUniforms.color[2] = myEdgeColor.GetRGB().Blue();
-  aUniforms.color[3] = myEdgeColor.Alpha();
+  Metal_LegacyUniforms aUniforms;
+  fillLegacyUniforms(aUniforms, myModelMatrix, myProjectionMatrix, myEdgeColor);
 
   // Pass uniforms to shaders
-  [myEncoder setVertexBytes:&aUniforms
-                     length:sizeof(aUniforms)
-                    atIndex:1];
+  bindUniformBlock(&aUniforms, sizeof(aUniforms), 1, 0, false);
+}
 
-  [myEncoder setFragmentBytes:&aUniforms
-                       length:sizeof(aUniforms)
-                      atIndex:0];
+// =======================================================================
+// function : bindUniformBlock
+// purpose  : Bind uniform block from uniform ring
+// =======================================================================
+void Metal_Workspace::bindUniformBlock(const void* theData,
+                                       size_t theSize,
+                                       int theVertexIndex,
+                                       int theFragmentIndex,
+                                       bool theIsShared)
+{
+  Metal_UniformRing* aRing = myContext != nullptr ? myContext->UniformRing().get() : nullptr;
+  id<MTLBuffer> aBuffer = nil;
+  size_t anOffset = 0;
+  const bool isAllocated = aRing != nullptr
+                        && (theIsShared
+                          ? aRing->AllocateShared(theData, theSize, aBuffer, anOffset)
+                          : aRing->Allocate(theData, theSize, aBuffer, anOffset));
+  if (theVertexIndex >= 0)
+  {
+    if (isAllocated)
+    {
+      [myEncoder setVertexBuffer:aBuffer offset:anOffset atIndex:static_cast<NSUInteger>(theVertexIndex)];
+    }
+    else
+    {
+      [myEncoder setVertexBytes:theData length:theSize atIndex:static_cast<NSUInteger>(theVertexIndex)];
+    }
+  }
+  if (theFragmentIndex >= 0)
+  {
+    if (isAllocated)
+    {
+      [myEncoder setFragmentBuffer:aBuffer offset:anOffset atIndex:static_cast<NSUInteger>(theFragmentIndex)];
+    }
+    else
+    {
+      [myEncoder setFragmentBytes:theData length:theSize atIndex:static_cast<NSUInteger>(theFragmentIndex)];
+    }
+  }
 }
 
 // =======================================================================
@@ -749,4 +1097,29 @@ void Metal_Workspace::ApplyMeshEdgesPipelineState()
 
   // Disable culling for wireframe (edges visible from both sides)
   [myEncoder setCullMode:MTLCullModeNone];
+
+  // Line width and colors are the only per-frame inputs - edge distances come from
+  // barycentric coordinates prepared once per geometry (Metal_PrimitiveArray::InitMeshEdges())
+  Metal_WireframeParams aWireParams = myGeometryEmulator->WireframeParams();
+  aWireParams.WireColor[0] = myMeshEdgesColor.GetRGB().Red();
+  aWireParams.WireColor[1] = myMeshEdgesColor.GetRGB().Green();
+  aWireParams.WireColor[2] = myMeshEdgesColor.GetRGB().Blue();
+  aWireParams.WireColor[3] = myMeshEdgesColor.Alpha();
+  if (!myAspect.IsNull())
+  {
+    const Quantity_ColorRGBA& aFillColor = myAspect->InteriorColorRGBA();
+    aWireParams.FillColor[0] = aFillColor.GetRGB().Red();
+    aWireParams.FillColor[1] = aFillColor.GetRGB().Green();
+    aWireParams.FillColor[2] = aFillColor.GetRGB().Blue();
+    aWireParams.FillColor[3] = aFillColor.Alpha();
+  }
+  bindUniformBlock(&aWireParams, sizeof(aWireParams), -1, 1, false);
+
+  // fragment_wireframe_overlay reads lights at buffer(2) instead of buffer(1)
+  if (myShaderManager != nullptr)
+  {
+    const Metal_LightUniforms& aLightUniforms = myShaderManager->LightUniforms();
+    bindUniformBlock(&aLightUniforms, sizeof(aLightUniforms), -1, 2, true);
+    myIsLightingBound = false;
+  }
 }
@@ -100,7 +100,7 @@ static void renderCappingForStructure(StencilTestSentry&                      th
   for (OpenGl_Structure::GroupIterator aGroupIter(theStructure.Groups()); aGroupIter.More();
        aGroupIter.Next())
   {
-    if (!aGroupIter.Value()->IsClosed())
+    if (!aGroupIter.Value()->IsClosed() || !theStructure.IsGroupDrawn(*aGroupIter.Value()))
     {
       continue;
     }
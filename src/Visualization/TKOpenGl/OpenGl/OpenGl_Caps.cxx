@@ -30,6 +30,7 @@ OpenGl_Caps::OpenGl_Caps()
       useSystemBuffer(false),
       swapInterval(1),
       useZeroToOneDepth(false),
+      useQuantizedVertices(false),
       buffersNoSwap(false),
       buffersOpaqueAlpha(true),
       buffersDeepColor(false),
@@ -70,6 +71,7 @@ OpenGl_Caps& OpenGl_Caps::operator=(const OpenGl_Caps& theCopy)
   useSystemBuffer           = theCopy.useSystemBuffer;
   swapInterval              = theCopy.swapInterval;
   useZeroToOneDepth         = theCopy.useZeroToOneDepth;
+  useQuantizedVertices      = theCopy.useQuantizedVertices;
   buffersNoSwap             = theCopy.buffersNoSwap;
   buffersOpaqueAlpha        = theCopy.buffersOpaqueAlpha;
   buffersDeepColor          = theCopy.buffersDeepColor;
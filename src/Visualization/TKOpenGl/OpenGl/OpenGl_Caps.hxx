@@ -41,6 +41,18 @@ public
   bool useZeroToOneDepth; //!< use [0, 1] depth range instead of [-1, 1] range, when possible (OFF by default)
   // clang-format on
 
+  /**
+   * Upload vertex attributes of static triangulations in compact layout
+   * (see Graphic3d_VertexQuantizer): positions as normalized 16-bit integers
+   * relative to array bounding box and texture coordinates as half floats,
+   * reducing memory footprint and bandwidth of vertex fetching.
+   * CPU copy of attributes is kept in float precision.
+   * Requires GLSL programs and OpenGL 3.0+ / OpenGL ES 3.0+ for half float attributes.
+   *
+   * OFF by default.
+   */
+  bool useQuantizedVertices;
+
 public: //! @name context creation parameters
   /**
    * Specify that driver should not swap back/front buffers at the end of frame.
@@ -23,6 +23,8 @@
 #include <OpenGl_View.hxx>
 #include <OpenGl_Workspace.hxx>
 
+#include <Graphic3d_VertexQuantizer.hxx>
+
 namespace
 {
 //! Convert data type to GL info
@@ -51,11 +53,55 @@ inline GLenum toGlDataType(const Graphic3d_TypeOfData theType, GLint& theNbComp)
     case Graphic3d_TOD_FLOAT:
       theNbComp = 1;
       return GL_FLOAT;
+    case Graphic3d_TOD_VEC4US:
+      theNbComp = 4;
+      return GL_UNSIGNED_SHORT;
+    case Graphic3d_TOD_VEC2S:
+      theNbComp = 2;
+      return GL_SHORT;
+    case Graphic3d_TOD_VEC2HF:
+      theNbComp = 2;
+      return GL_HALF_FLOAT;
   }
   theNbComp = 0;
   return GL_NONE;
 }
 
+//! Auxiliary sentry folding dequantization of vertex positions into model-world matrix.
+class OpenGl_DequantizationSentry
+{
+public:
+  //! Main constructor.
+  OpenGl_DequantizationSentry(const occ::handle<OpenGl_Context>& theCtx,
+                              const NCollection_Mat4<float>*     theMatrix)
+      : myCtx(theMatrix != nullptr ? theCtx.get() : nullptr)
+  {
+    if (myCtx != nullptr)
+    {
+      myCtx->ModelWorldState.Push();
+      myCtx->ModelWorldState.SetCurrent(myCtx->ModelWorldState.Current() * *theMatrix);
+      myCtx->ApplyModelViewMatrix();
+    }
+  }
+
+  //! Destructor restoring model-world matrix.
+  ~OpenGl_DequantizationSentry()
+  {
+    if (myCtx != nullptr)
+    {
+      myCtx->ModelWorldState.Pop();
+      myCtx->ApplyModelViewMatrix();
+    }
+  }
+
+private:
+  OpenGl_DequantizationSentry(const OpenGl_DequantizationSentry&)            = delete;
+  OpenGl_DequantizationSentry& operator=(const OpenGl_DequantizationSentry&) = delete;
+
+private:
+  OpenGl_Context* myCtx;
+};
+
 } // namespace
 
 //! Auxiliary template for VBO with interleaved attributes.
@@ -183,49 +229,69 @@ void OpenGl_PrimitiveArray::clearMemoryGL(const occ::handle<OpenGl_Context>& the
     myVboAttribs->Release(theGlCtx.operator->());
     myVboAttribs.Nullify();
   }
+  myIsQuantized = false;
 }
 
 //=================================================================================================
 
 bool OpenGl_PrimitiveArray::initNormalVbo(const occ::handle<OpenGl_Context>& theCtx) const
 {
-  switch (myAttribs->NbAttributes)
+  // compact copy of static triangulation attributes is uploaded instead of source float data;
+  // half floats require OpenGL 3.0+ / OpenGL ES 3.0+, normalized integers require GLSL programs
+  occ::handle<Graphic3d_Buffer> anAttribs = myAttribs;
+  myIsQuantized                           = false;
+  if (theCtx->caps->useQuantizedVertices && myIsFillType && !myAttribs->IsMutable()
+      && !theCtx->caps->ffpEnable && theCtx->core20fwd != nullptr
+      && theCtx->IsGlGreaterEqual(3, 0))
+  {
+    Graphic3d_VertexQuantizer aQuantizer;
+    aQuantizer.SetEncodeNormals(false); // octahedral normals would require dedicated GLSL programs
+    occ::handle<Graphic3d_Buffer> aCompact = aQuantizer.Perform(*myAttribs);
+    if (!aCompact.IsNull())
+    {
+      anAttribs       = aCompact;
+      myIsQuantized   = aQuantizer.HasQuantizedPositions();
+      myDequantMatrix = aQuantizer.DequantizationMatrix();
+    }
+  }
+
+  switch (anAttribs->NbAttributes)
   {
     case 1:
-      myVboAttribs = new OpenGl_VertexBufferT<OpenGl_VertexBuffer, 1>(*myAttribs);
+      myVboAttribs = new OpenGl_VertexBufferT<OpenGl_VertexBuffer, 1>(*anAttribs);
       break;
     case 2:
-      myVboAttribs = new OpenGl_VertexBufferT<OpenGl_VertexBuffer, 2>(*myAttribs);
+      myVboAttribs = new OpenGl_VertexBufferT<OpenGl_VertexBuffer, 2>(*anAttribs);
       break;
     case 3:
-      myVboAttribs = new OpenGl_VertexBufferT<OpenGl_VertexBuffer, 3>(*myAttribs);
+      myVboAttribs = new OpenGl_VertexBufferT<OpenGl_VertexBuffer, 3>(*anAttribs);
       break;
     case 4:
-      myVboAttribs = new OpenGl_VertexBufferT<OpenGl_VertexBuffer, 4>(*myAttribs);
+      myVboAttribs = new OpenGl_VertexBufferT<OpenGl_VertexBuffer, 4>(*anAttribs);
       break;
     case 5:
-      myVboAttribs = new OpenGl_VertexBufferT<OpenGl_VertexBuffer, 5>(*myAttribs);
+      myVboAttribs = new OpenGl_VertexBufferT<OpenGl_VertexBuffer, 5>(*anAttribs);
       break;
     case 6:
-      myVboAttribs = new OpenGl_VertexBufferT<OpenGl_VertexBuffer, 6>(*myAttribs);
+      myVboAttribs = new OpenGl_VertexBufferT<OpenGl_VertexBuffer, 6>(*anAttribs);
       break;
     case 7:
-      myVboAttribs = new OpenGl_VertexBufferT<OpenGl_VertexBuffer, 7>(*myAttribs);
+      myVboAttribs = new OpenGl_VertexBufferT<OpenGl_VertexBuffer, 7>(*anAttribs);
       break;
     case 8:
-      myVboAttribs = new OpenGl_VertexBufferT<OpenGl_VertexBuffer, 8>(*myAttribs);
+      myVboAttribs = new OpenGl_VertexBufferT<OpenGl_VertexBuffer, 8>(*anAttribs);
       break;
     case 9:
-      myVboAttribs = new OpenGl_VertexBufferT<OpenGl_VertexBuffer, 9>(*myAttribs);
+      myVboAttribs = new OpenGl_VertexBufferT<OpenGl_VertexBuffer, 9>(*anAttribs);
       break;
     case 10:
-      myVboAttribs = new OpenGl_VertexBufferT<OpenGl_VertexBuffer, 10>(*myAttribs);
+      myVboAttribs = new OpenGl_VertexBufferT<OpenGl_VertexBuffer, 10>(*anAttribs);
       break;
   }
 
-  const bool isAttribMutable     = myAttribs->IsMutable();
-  const bool isAttribInterleaved = myAttribs->IsInterleaved();
-  if (myAttribs->NbElements != myAttribs->NbMaxElements() && myIndices.IsNull()
+  const bool isAttribMutable     = anAttribs->IsMutable();
+  const bool isAttribInterleaved = anAttribs->IsInterleaved();
+  if (anAttribs->NbElements != anAttribs->NbMaxElements() && myIndices.IsNull()
       && (!isAttribInterleaved || isAttribMutable))
   {
     throw Standard_ProgramError("OpenGl_PrimitiveArray::buildVBO() - vertex attribute data with "
@@ -235,13 +301,13 @@ bool OpenGl_PrimitiveArray::initNormalVbo(const occ::handle<OpenGl_Context>& the
   // specify data type as Byte and NbComponents as Stride, so that
   // OpenGl_VertexBuffer::EstimatedDataSize() will return correct value
   const int aNbVertexes =
-    (isAttribMutable || !isAttribInterleaved) ? myAttribs->NbMaxElements() : myAttribs->NbElements;
+    (isAttribMutable || !isAttribInterleaved) ? anAttribs->NbMaxElements() : anAttribs->NbElements;
   if (!myVboAttribs->init(theCtx,
-                          myAttribs->Stride,
+                          anAttribs->Stride,
                           aNbVertexes,
-                          myAttribs->Data(),
+                          anAttribs->Data(),
                           GL_UNSIGNED_BYTE,
-                          myAttribs->Stride))
+                          anAttribs->Stride))
   {
     TCollection_ExtendedString aMsg =
       TCollection_ExtendedString("VBO creation for Primitive Array has failed for ") + aNbVertexes
@@ -706,7 +772,8 @@ OpenGl_PrimitiveArray::OpenGl_PrimitiveArray(const OpenGl_GraphicDriver* theDriv
 
     : myDrawMode(DRAW_MODE_NONE),
       myIsFillType(false),
-      myIsVboInit(false)
+      myIsVboInit(false),
+      myIsQuantized(false)
 {
   if (theDriver != nullptr)
   {
@@ -727,7 +794,8 @@ OpenGl_PrimitiveArray::OpenGl_PrimitiveArray(const OpenGl_GraphicDriver*
       myBounds(theBounds),
       myDrawMode(DRAW_MODE_NONE),
       myIsFillType(false),
-      myIsVboInit(false)
+      myIsVboInit(false),
+      myIsQuantized(false)
 {
   if (!myIndices.IsNull() && myIndices->NbElements < 1)
   {
@@ -949,6 +1017,12 @@ void OpenGl_PrimitiveArray::Render(const occ::handle<OpenGl_Workspace>& theWorks
     updateVBO(aCtx);
   }
 
+  // quantized positions are restored by model-world matrix before binding GLSL program
+  const OpenGl_DequantizationSentry aDequantSentry(aCtx,
+                                                   myIsQuantized && !myVboAttribs.IsNull()
+                                                     ? &myDequantMatrix
+                                                     : nullptr);
+
   Graphic3d_TypeOfShadingModel aShadingModel = Graphic3d_TypeOfShadingModel_Unlit;
   // clang-format off
   anAspectFace = theWorkspace->ApplyAspects (false); // do not bind textures before binding the program
@@ -19,6 +19,7 @@
 #include <Graphic3d_TypeOfPrimitiveArray.hxx>
 #include <Graphic3d_IndexBuffer.hxx>
 #include <Graphic3d_BoundBuffer.hxx>
+#include <NCollection_Mat4.hxx>
 
 #include <OpenGl_Element.hxx>
 
@@ -153,6 +154,8 @@ protected:
   short                                      myDrawMode;
   mutable bool                               myIsFillType;
   mutable bool                               myIsVboInit;
+  mutable NCollection_Mat4<float>            myDequantMatrix; //!< restores quantized positions
+  mutable bool                               myIsQuantized;   //!< VBO holds quantized positions
 
   size_t myUID; //!< Unique ID of primitive array.
 
@@ -371,6 +371,10 @@ void OpenGl_Structure::renderGeometry(const occ::handle<OpenGl_Workspace>& theWo
   for (OpenGl_Structure::GroupIterator aGroupIter(myGroups); aGroupIter.More(); aGroupIter.Next())
   {
     const OpenGl_Group* aGroup = aGroupIter.Value();
+    if (!IsGroupDrawn(*aGroup))
+    {
+      continue;
+    }
 
     const gp_Trsf& aTrsf = aGroup->Transformation();
     if (aTrsf.Form() != gp_Identity)
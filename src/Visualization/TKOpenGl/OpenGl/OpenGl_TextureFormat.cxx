@@ -721,7 +721,10 @@ OpenGl_TextureFormat OpenGl_TextureFormat::FindCompressedFormat(
 
   switch (theFormat)
   {
-    case Image_CompressedFormat_UNKNOWN: {
+    case Image_CompressedFormat_UNKNOWN:
+    case Image_CompressedFormat_RGBA_BPTC:
+    case Image_CompressedFormat_RGBA_ASTC_4x4:
+    case Image_CompressedFormat_RGBA_ASTC_8x8: {
       return aFormat;
     }
     case Image_CompressedFormat_RGB_S3TC_DXT1: {
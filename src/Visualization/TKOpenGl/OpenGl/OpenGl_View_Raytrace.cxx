@@ -531,6 +531,12 @@ bool OpenGl_View::addRaytraceGroups(const OpenGl_Structure*            theStruct
   for (OpenGl_Structure::GroupIterator aGroupIter(theStructure->Groups()); aGroupIter.More();
        aGroupIter.Next())
   {
+    // ray-tracing geometry is not rebuilt on change of level of detail - keep the finest one
+    if (aGroupIter.Value()->LevelOfDetail() > 0)
+    {
+      continue;
+    }
+
     // Get group material
     OpenGl_RaytraceMaterial aGroupMaterial;
     if (aGroupIter.Value()->GlAspects() != nullptr)
@@ -11,6 +11,8 @@ set(OCCT_Font_FILES
   Font_FTFont.hxx
   Font_FTLibrary.cxx
   Font_FTLibrary.hxx
+  Font_GlyphCache.cxx
+  Font_GlyphCache.hxx
   Font_Hinting.hxx
   Font_NameOfFont.hxx
 
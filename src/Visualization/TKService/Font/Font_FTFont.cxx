@@ -36,6 +36,7 @@ Font_FTFont::Font_FTFont(const occ::handle<Font_FTLibrary>& theFTLib)
     : myFTLib(theFTLib),
       myFTFace(nullptr),
       myActiveFTFace(nullptr),
+      myFaceId(0),
       myFontAspect(Font_FontAspect_Regular),
       myWidthScaling(1.0),
 #ifdef HAVE_FREETYPE
@@ -64,7 +65,10 @@ Font_FTFont::~Font_FTFont()
 void Font_FTFont::Release()
 {
   myGlyphImg.Clear();
+  myCachedGlyphImg.Nullify();
   myFontPath.Clear();
+  myGlyphCacheKey.Clear();
+  myFaceId = 0;
   myUChar = 0;
   if (myFTFace != nullptr)
   {
@@ -88,6 +92,7 @@ bool Font_FTFont::Init(const occ::handle<NCollection_Buffer>& theData,
   myBuffer     = theData;
   myFontPath   = theFileName;
   myFontParams = theParams;
+  myFaceId     = theFaceId;
 
   // manage hinting style
   if ((theParams.FontHinting & Font_Hinting_Light) != 0
@@ -376,9 +381,75 @@ bool Font_FTFont::loadGlyph(const char32_t theUChar)
 bool Font_FTFont::RenderGlyph(const char32_t theUChar)
 {
   myGlyphImg.Clear();
+  myCachedGlyphImg.Nullify();
+  myGlyphRect    = Font_Rect();
   myUChar        = 0;
   myActiveFTFace = myFTFace;
 
+#ifdef HAVE_FREETYPE
+  const bool toUseCache = theUChar != 0 && Font_FontMgr::ToUseGlyphCache() && IsValid()
+                          && !myFontPath.IsEmpty();
+  if (toUseCache)
+  {
+    if (myGlyphCacheKey.IsEmpty())
+    {
+      myGlyphCacheKey = myFontPath + "|" + myFaceId + "|" + int(myFontParams.PointSize) + "|"
+                        + int(myFontParams.Resolution) + "|" + int(myFontParams.FontHinting) + "|"
+                        + (myFontParams.ToSynthesizeItalic ? 1 : 0) + "|" + int(myFontAspect)
+                        + "|" + (myToUseUnicodeSubsetFallback ? 1 : 0);
+    }
+
+    Font_GlyphCache::Glyph aGlyph;
+    if (Font_FontMgr::GlyphCache()->Find(myGlyphCacheKey, theUChar, aGlyph))
+    {
+      // glyph slot is not loaded, so that myUChar is left unset for loadGlyph()
+      if (!aGlyph.IsValid()
+          || !myGlyphImg.InitWrapper(aGlyph.Image->Format(),
+                                     aGlyph.Image->ChangeData(),
+                                     aGlyph.Image->SizeX(),
+                                     aGlyph.Image->SizeY(),
+                                     aGlyph.Image->SizeRowBytes()))
+      {
+        return false;
+      }
+      myGlyphImg.SetTopDown(aGlyph.Image->IsTopDown());
+      myCachedGlyphImg = aGlyph.Image;
+      myGlyphRect      = aGlyph.Rect;
+      return true;
+    }
+  }
+
+  if (!renderGlyph(theUChar))
+  {
+    if (toUseCache)
+    {
+      Font_FontMgr::GlyphCache()->Add(myGlyphCacheKey, theUChar, Font_GlyphCache::Glyph());
+    }
+    return false;
+  }
+
+  if (toUseCache)
+  {
+    Font_GlyphCache::Glyph aGlyph;
+    aGlyph.Image = new Image_PixMap();
+    aGlyph.Rect  = myGlyphRect;
+    if (aGlyph.Image->InitCopy(myGlyphImg))
+    {
+      aGlyph.Image->SetTopDown(myGlyphImg.IsTopDown());
+      Font_FontMgr::GlyphCache()->Add(myGlyphCacheKey, theUChar, aGlyph);
+    }
+  }
+  return true;
+#else
+  (void)theUChar;
+  return false;
+#endif
+}
+
+//=================================================================================================
+
+bool Font_FTFont::renderGlyph(const char32_t theUChar)
+{
 #ifdef HAVE_FREETYPE
   if (theUChar != 0 && myToUseUnicodeSubsetFallback && !HasSymbol(theUChar))
   {
@@ -440,7 +511,11 @@ bool Font_FTFont::RenderGlyph(const char32_t theUChar)
     return false;
   }
 
-  myUChar = theUChar;
+  myGlyphRect.Left   = float(myActiveFTFace->glyph->bitmap_left);
+  myGlyphRect.Top    = float(myActiveFTFace->glyph->bitmap_top);
+  myGlyphRect.Right  = float(myActiveFTFace->glyph->bitmap_left + (int)aBitmap.width);
+  myGlyphRect.Bottom = float(myActiveFTFace->glyph->bitmap_top - (int)aBitmap.rows);
+  myUChar            = theUChar;
   return true;
 #else
   (void)theUChar;
@@ -660,15 +735,7 @@ int Font_FTFont::GlyphsNumber(bool theToIncludeFallback) const
 
 void Font_FTFont::GlyphRect(Font_Rect& theRect) const
 {
-#ifdef HAVE_FREETYPE
-  const FT_Bitmap& aBitmap = myActiveFTFace->glyph->bitmap;
-  theRect.Left             = float(myActiveFTFace->glyph->bitmap_left);
-  theRect.Top              = float(myActiveFTFace->glyph->bitmap_top);
-  theRect.Right            = float(myActiveFTFace->glyph->bitmap_left + (int)aBitmap.width);
-  theRect.Bottom           = float(myActiveFTFace->glyph->bitmap_top - (int)aBitmap.rows);
-#else
-  (void)theRect;
-#endif
+  theRect = myGlyphRect;
 }
 
 //=================================================================================================
@@ -205,6 +205,7 @@ public:
   void SetUseUnicodeSubsetFallback(bool theToFallback)
   {
     myToUseUnicodeSubsetFallback = theToFallback;
+    myGlyphCacheKey.Clear();
   }
 
   //! Return TRUE if this is single-stroke (one-line) font, FALSE by default.
@@ -225,6 +226,8 @@ public:
   Standard_EXPORT virtual void Release();
 
   //! Render specified glyph into internal buffer (bitmap).
+  //! When Font_FontMgr::ToUseGlyphCache() is enabled, the bitmap is taken from (or put into)
+  //! global cache Font_FontMgr::GlyphCache() shared by all fonts with the same parameters.
   Standard_EXPORT bool RenderGlyph(const char32_t theChar);
 
   //! @return maximal glyph width in pixels (rendered to bitmap).
@@ -281,7 +284,7 @@ public:
   //! @param theToIncludeFallback if TRUE then the number will include fallback list
   Standard_EXPORT int GlyphsNumber(bool theToIncludeFallback = false) const;
 
-  //! Retrieve glyph bitmap rectangle
+  //! Retrieve bitmap rectangle of the glyph rendered by RenderGlyph().
   Standard_EXPORT void GlyphRect(Font_Rect& theRect) const;
 
   //! Computes bounding box of the given text using plain-text formatter (Font_TextFormatter).
@@ -352,6 +355,9 @@ protected:
   }
 
 protected:
+  //! Render glyph into internal buffer using FT library.
+  Standard_EXPORT bool renderGlyph(const char32_t theUChar);
+
   //! Load glyph without rendering it.
   Standard_EXPORT bool loadGlyph(const char32_t theUChar);
 
@@ -383,13 +389,17 @@ protected:
   FT_Face                         myFTFace;                               //!< FT face object
   FT_Face                         myActiveFTFace; //!< active FT face object (the main of fallback)
   TCollection_AsciiString         myFontPath;     //!< font path
+  int                             myFaceId;       //!< face id within the font file
   Font_FTFontParams               myFontParams;   //!< font initialization parameters
   Font_FontAspect                 myFontAspect;   //!< font initialization aspect
   float                           myWidthScaling; //!< scale glyphs along X-axis
   int32_t                         myLoadFlags;    //!< default load flags
 
-  Image_PixMap myGlyphImg; //!< cached glyph plane
-  char32_t     myUChar;    //!< currently loaded unicode character
+  Image_PixMap              myGlyphImg;       //!< cached glyph plane
+  occ::handle<Image_PixMap> myCachedGlyphImg; //!< glyph image from global cache
+  Font_Rect                 myGlyphRect;      //!< rectangle of rendered glyph
+  TCollection_AsciiString   myGlyphCacheKey;  //!< face key within global glyph cache
+  char32_t                  myUChar;          //!< currently loaded unicode character
   // clang-format off
   bool           myToUseUnicodeSubsetFallback; //!< use default fallback fonts for extended Unicode sub-sets (Korean, CJK, etc.)
   // clang-format on
@@ -307,6 +307,22 @@ bool& Font_FontMgr::ToUseUnicodeSubsetFallback()
 
 //=================================================================================================
 
+bool& Font_FontMgr::ToUseGlyphCache()
+{
+  static bool TheToUseGlyphCache = false;
+  return TheToUseGlyphCache;
+}
+
+//=================================================================================================
+
+const occ::handle<Font_GlyphCache>& Font_FontMgr::GlyphCache()
+{
+  static const occ::handle<Font_GlyphCache> TheGlyphCache = new Font_GlyphCache();
+  return TheGlyphCache;
+}
+
+//=================================================================================================
+
 bool Font_FontMgr::AddFontAlias(const TCollection_AsciiString& theAliasName,
                                 const TCollection_AsciiString& theFontName)
 {
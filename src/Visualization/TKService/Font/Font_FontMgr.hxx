@@ -19,6 +19,7 @@
 #include <Standard.hxx>
 #include <Standard_Transient.hxx>
 #include <NCollection_List.hxx>
+#include <Font_GlyphCache.hxx>
 #include <Font_SystemFont.hxx>
 #include <Font_StrictLevel.hxx>
 #include <Font_UnicodeSubset.hxx>
@@ -62,6 +63,14 @@ public:
   //! Unicode subset; TRUE by default.
   Standard_EXPORT static bool& ToUseUnicodeSubsetFallback();
 
+  //! Return flag to share rasterized glyphs between all Font_FTFont instances through GlyphCache();
+  //! FALSE by default.
+  Standard_EXPORT static bool& ToUseGlyphCache();
+
+  //! Return global cache of rasterized glyphs.
+  //! The cache is independent from font registry, so that it can be used without GetInstance().
+  Standard_EXPORT static const occ::handle<Font_GlyphCache>& GlyphCache();
+
 public:
   //! Return the list of available fonts.
   void AvailableFonts(NCollection_List<occ::handle<Font_SystemFont>>& theList) const
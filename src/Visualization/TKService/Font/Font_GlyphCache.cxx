@@ -0,0 +1,325 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <Font_GlyphCache.hxx>
+
+#include <Message.hxx>
+#include <OSD_FileSystem.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(Font_GlyphCache, Standard_Transient)
+
+namespace
+{
+//! File signature.
+static const char THE_GLYPH_CACHE_MAGIC[8] = {'O', 'C', 'C', 'G', 'L', 'Y', 'P', 'H'};
+
+//! File format version.
+static const uint32_t THE_GLYPH_CACHE_VERSION = 1;
+
+//! Maximum length of face key or dimensions of glyph bitmap accepted while reading the file.
+static const uint32_t THE_GLYPH_CACHE_MAX_SIZE = 8192;
+
+//! Glyph record within the file.
+struct Font_GlyphCacheRecord
+{
+  uint32_t UChar;
+  float    Left;
+  float    Right;
+  float    Top;
+  float    Bottom;
+  uint32_t SizeX;
+  uint32_t SizeY;
+  uint8_t  Format;
+  uint8_t  IsTopDown;
+  uint8_t  Reserved[2];
+};
+
+//! Write value into the stream.
+template <typename T>
+static void writeValue(std::ostream& theStream, const T& theValue)
+{
+  theStream.write(reinterpret_cast<const char*>(&theValue), sizeof(T));
+}
+
+//! Read value from the stream.
+template <typename T>
+static bool readValue(std::istream& theStream, T& theValue)
+{
+  theStream.read(reinterpret_cast<char*>(&theValue), sizeof(T));
+  return theStream.good();
+}
+} // namespace
+
+//=================================================================================================
+
+Font_GlyphCache::Font_GlyphCache()
+    : myMaxMemory(64 * 1024 * 1024),
+      myUsedMemory(0),
+      myNbGlyphs(0),
+      myNbHits(0),
+      myNbMisses(0)
+{
+}
+
+//=================================================================================================
+
+size_t Font_GlyphCache::UsedMemory() const
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  return myUsedMemory;
+}
+
+//=================================================================================================
+
+int Font_GlyphCache::NbGlyphs() const
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  return myNbGlyphs;
+}
+
+//=================================================================================================
+
+size_t Font_GlyphCache::NbHits() const
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  return myNbHits;
+}
+
+//=================================================================================================
+
+size_t Font_GlyphCache::NbMisses() const
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  return myNbMisses;
+}
+
+//=================================================================================================
+
+bool Font_GlyphCache::Find(const TCollection_AsciiString& theFaceKey,
+                           char32_t                       theUChar,
+                           Glyph&                         theGlyph) const
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  const GlyphMap*             aGlyphs = myFaces.Seek(theFaceKey);
+  const Glyph*                aGlyph  = aGlyphs != nullptr ? aGlyphs->Seek(theUChar) : nullptr;
+  if (aGlyph == nullptr)
+  {
+    ++myNbMisses;
+    return false;
+  }
+
+  ++myNbHits;
+  theGlyph = *aGlyph;
+  return true;
+}
+
+//=================================================================================================
+
+bool Font_GlyphCache::Add(const TCollection_AsciiString& theFaceKey,
+                          char32_t                       theUChar,
+                          const Glyph&                   theGlyph)
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  return addGlyph(theFaceKey, theUChar, theGlyph);
+}
+
+//=================================================================================================
+
+bool Font_GlyphCache::addGlyph(const TCollection_AsciiString& theFaceKey,
+                               char32_t                       theUChar,
+                               const Glyph&                   theGlyph)
+{
+  const size_t aNbBytes = theGlyph.IsValid() ? theGlyph.Image->SizeBytes() : 0;
+  if (myUsedMemory + aNbBytes > myMaxMemory)
+  {
+    return false;
+  }
+
+  GlyphMap* aGlyphs = myFaces.ChangeSeek(theFaceKey);
+  if (aGlyphs == nullptr)
+  {
+    aGlyphs = myFaces.Bound(theFaceKey, GlyphMap());
+  }
+  if (aGlyphs->IsBound(theUChar))
+  {
+    // glyph might be rendered concurrently by another thread
+    return true;
+  }
+
+  aGlyphs->Bind(theUChar, theGlyph);
+  myUsedMemory += aNbBytes;
+  ++myNbGlyphs;
+  return true;
+}
+
+//=================================================================================================
+
+void Font_GlyphCache::Clear()
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  myFaces.Clear();
+  myUsedMemory = 0;
+  myNbGlyphs   = 0;
+  myNbHits     = 0;
+  myNbMisses   = 0;
+}
+
+//=================================================================================================
+
+bool Font_GlyphCache::Save(const TCollection_AsciiString& theFile) const
+{
+  const occ::handle<OSD_FileSystem>& aFileSystem = OSD_FileSystem::DefaultFileSystem();
+  std::shared_ptr<std::ostream>      aFileOut =
+    aFileSystem->OpenOStream(theFile, std::ios::out | std::ios::binary | std::ios::trunc);
+  if (aFileOut.get() == nullptr)
+  {
+    Message::SendFail(TCollection_AsciiString("Error: Unable to create file '") + theFile + "'");
+    return false;
+  }
+
+  {
+    std::lock_guard<std::mutex> aLock(myMutex);
+    aFileOut->write(THE_GLYPH_CACHE_MAGIC, sizeof(THE_GLYPH_CACHE_MAGIC));
+    writeValue(*aFileOut, THE_GLYPH_CACHE_VERSION);
+    writeValue(*aFileOut, uint32_t(myFaces.Extent()));
+    for (FaceMap::Iterator aFaceIter(myFaces); aFaceIter.More(); aFaceIter.Next())
+    {
+      const TCollection_AsciiString& aFaceKey = aFaceIter.Key();
+      writeValue(*aFileOut, uint32_t(aFaceKey.Length()));
+      aFileOut->write(aFaceKey.ToCString(), aFaceKey.Length());
+      writeValue(*aFileOut, uint32_t(aFaceIter.Value().Extent()));
+      for (GlyphMap::Iterator aGlyphIter(aFaceIter.Value()); aGlyphIter.More(); aGlyphIter.Next())
+      {
+        const Glyph&          aGlyph = aGlyphIter.Value();
+        Font_GlyphCacheRecord aRecord;
+        memset(&aRecord, 0, sizeof(aRecord));
+        aRecord.UChar  = uint32_t(aGlyphIter.Key());
+        aRecord.Left   = aGlyph.Rect.Left;
+        aRecord.Right  = aGlyph.Rect.Right;
+        aRecord.Top    = aGlyph.Rect.Top;
+        aRecord.Bottom = aGlyph.Rect.Bottom;
+        if (aGlyph.IsValid())
+        {
+          aRecord.SizeX     = uint32_t(aGlyph.Image->SizeX());
+          aRecord.SizeY     = uint32_t(aGlyph.Image->SizeY());
+          aRecord.Format    = uint8_t(aGlyph.Image->Format());
+          aRecord.IsTopDown = aGlyph.Image->IsTopDown() ? 1 : 0;
+        }
+        writeValue(*aFileOut, aRecord);
+        for (uint32_t aRow = 0; aRow < aRecord.SizeY; ++aRow)
+        {
+          // rows are written in memory order, which is defined by IsTopDown flag
+          const uint8_t* aRowData = aGlyph.Image->Data() + aGlyph.Image->SizeRowBytes() * aRow;
+          aFileOut->write(reinterpret_cast<const char*>(aRowData), aRecord.SizeX);
+        }
+      }
+    }
+  }
+
+  aFileOut->flush();
+  if (!aFileOut->good())
+  {
+    Message::SendFail(TCollection_AsciiString("Error: Unable to write file '") + theFile + "'");
+    return false;
+  }
+  aFileOut.reset();
+  return true;
+}
+
+//=================================================================================================
+
+bool Font_GlyphCache::Load(const TCollection_AsciiString& theFile)
+{
+  const occ::handle<OSD_FileSystem>& aFileSystem = OSD_FileSystem::DefaultFileSystem();
+  std::shared_ptr<std::istream>      aFile =
+    aFileSystem->OpenIStream(theFile, std::ios::in | std::ios::binary);
+  if (aFile.get() == nullptr || !aFile->good())
+  {
+    Message::SendFail(TCollection_AsciiString("Error: Unable to open file '") + theFile + "'");
+    return false;
+  }
+
+  char     aMagic[8] = {};
+  uint32_t aVersion = 0, aNbFaces = 0;
+  aFile->read(aMagic, sizeof(aMagic));
+  if (!aFile->good() || ::memcmp(aMagic, THE_GLYPH_CACHE_MAGIC, sizeof(aMagic)) != 0
+      || !readValue(*aFile, aVersion) || aVersion != THE_GLYPH_CACHE_VERSION
+      || !readValue(*aFile, aNbFaces))
+  {
+    Message::SendFail(TCollection_AsciiString("Error: file '") + theFile
+                      + "' is not a glyph cache of supported version");
+    return false;
+  }
+
+  std::lock_guard<std::mutex> aLock(myMutex);
+  for (uint32_t aFaceIter = 0; aFaceIter < aNbFaces; ++aFaceIter)
+  {
+    uint32_t aKeyLen = 0, aNbGlyphs = 0;
+    if (!readValue(*aFile, aKeyLen) || aKeyLen == 0 || aKeyLen > THE_GLYPH_CACHE_MAX_SIZE)
+    {
+      Message::SendFail(TCollection_AsciiString("Error: file '") + theFile + "' is corrupted");
+      return false;
+    }
+
+    char aKeyBuffer[THE_GLYPH_CACHE_MAX_SIZE];
+    aFile->read(aKeyBuffer, aKeyLen);
+    if (!readValue(*aFile, aNbGlyphs))
+    {
+      Message::SendFail(TCollection_AsciiString("Error: file '") + theFile + "' is corrupted");
+      return false;
+    }
+
+    const TCollection_AsciiString aFaceKey(aKeyBuffer, (int)aKeyLen);
+
+    for (uint32_t aGlyphIter = 0; aGlyphIter < aNbGlyphs; ++aGlyphIter)
+    {
+      Font_GlyphCacheRecord aRecord;
+      if (!readValue(*aFile, aRecord) || aRecord.SizeX > THE_GLYPH_CACHE_MAX_SIZE
+          || aRecord.SizeY > THE_GLYPH_CACHE_MAX_SIZE
+          || (aRecord.SizeY != 0 && aRecord.Format != uint8_t(Image_Format_Alpha)
+              && aRecord.Format != uint8_t(Image_Format_Gray)))
+      {
+        Message::SendFail(TCollection_AsciiString("Error: file '") + theFile + "' is corrupted");
+        return false;
+      }
+
+      Glyph aGlyph;
+      aGlyph.Rect.Left   = aRecord.Left;
+      aGlyph.Rect.Right  = aRecord.Right;
+      aGlyph.Rect.Top    = aRecord.Top;
+      aGlyph.Rect.Bottom = aRecord.Bottom;
+      if (aRecord.SizeX != 0 && aRecord.SizeY != 0)
+      {
+        aGlyph.Image = new Image_PixMap();
+        if (!aGlyph.Image->InitTrash((Image_Format)aRecord.Format, aRecord.SizeX, aRecord.SizeY))
+        {
+          return false;
+        }
+        aGlyph.Image->SetTopDown(aRecord.IsTopDown != 0);
+        for (uint32_t aRow = 0; aRow < aRecord.SizeY; ++aRow)
+        {
+          aFile->read(reinterpret_cast<char*>(aGlyph.Image->ChangeData()
+                                              + aGlyph.Image->SizeRowBytes() * aRow),
+                      aRecord.SizeX);
+        }
+        if (!aFile->good())
+        {
+          Message::SendFail(TCollection_AsciiString("Error: file '") + theFile + "' is corrupted");
+          return false;
+        }
+      }
+      addGlyph(aFaceKey, char32_t(aRecord.UChar), aGlyph);
+    }
+  }
+  return true;
+}
@@ -0,0 +1,126 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _Font_GlyphCache_HeaderFile
+#define _Font_GlyphCache_HeaderFile
+
+#include <Font_Rect.hxx>
+#include <Image_PixMap.hxx>
+#include <NCollection_DataMap.hxx>
+#include <TCollection_AsciiString.hxx>
+
+#include <mutex>
+
+//! Thread-safe cache of rasterized glyphs shared by all Font_FTFont instances.
+//! Glyphs are grouped by face key defined by Font_FTFont (font file, face index, point size,
+//! resolution, hinting and italic synthesis), and identified by Unicode character within a face.
+//! Glyphs which could not be rendered (like spaces) are cached as well with NULL image,
+//! so that they are not rasterized repeatedly.
+//!
+//! The cache is filled by Font_FTFont::RenderGlyph() when Font_FontMgr::ToUseGlyphCache()
+//! is enabled, so that text in different views, graphic contexts and threads reuses glyph bitmaps
+//! - texture atlases are still constructed per graphic context by graphic drivers.
+//! The content can be saved into a file and loaded back for faster start-up of text-heavy views.
+class Font_GlyphCache : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(Font_GlyphCache, Standard_Transient)
+public:
+  //! Cached glyph.
+  struct Glyph
+  {
+    occ::handle<Image_PixMap> Image; //!< glyph bitmap (Alpha or Gray), NULL for empty glyph
+    Font_Rect                 Rect;  //!< glyph bitmap rectangle relative to the pen position
+
+    //! Return TRUE if glyph has been rendered.
+    bool IsValid() const { return !Image.IsNull(); }
+  };
+
+public:
+  //! Empty constructor.
+  Standard_EXPORT Font_GlyphCache();
+
+  //! Return maximum size of cached bitmaps in bytes; 64 MiB by default.
+  //! Glyphs are not added into the cache after reaching the limit.
+  size_t MaxMemory() const { return myMaxMemory; }
+
+  //! Set maximum size of cached bitmaps in bytes.
+  void SetMaxMemory(size_t theNbBytes) { myMaxMemory = theNbBytes; }
+
+  //! Return size of cached bitmaps in bytes.
+  Standard_EXPORT size_t UsedMemory() const;
+
+  //! Return number of cached glyphs.
+  Standard_EXPORT int NbGlyphs() const;
+
+  //! Return number of cache hits since creation or last Clear().
+  Standard_EXPORT size_t NbHits() const;
+
+  //! Return number of cache misses since creation or last Clear().
+  Standard_EXPORT size_t NbMisses() const;
+
+  //! Find glyph in the cache.
+  //! @param[in] theFaceKey face key
+  //! @param[in] theUChar   Unicode character
+  //! @param[out] theGlyph  found glyph
+  //! @return TRUE if glyph has been found
+  Standard_EXPORT bool Find(const TCollection_AsciiString& theFaceKey,
+                            char32_t                       theUChar,
+                            Glyph&                         theGlyph) const;
+
+  //! Add glyph into the cache.
+  //! The image should not be modified after passing to the cache.
+  //! @param[in] theFaceKey face key
+  //! @param[in] theUChar   Unicode character
+  //! @param[in] theGlyph   glyph to add
+  //! @return FALSE if memory limit has been reached
+  Standard_EXPORT bool Add(const TCollection_AsciiString& theFaceKey,
+                           char32_t                       theUChar,
+                           const Glyph&                   theGlyph);
+
+  //! Release all cached glyphs.
+  Standard_EXPORT void Clear();
+
+  //! Save cached glyphs into the file.
+  //! @param[in] theFile file path
+  //! @return FALSE on writing error
+  Standard_EXPORT bool Save(const TCollection_AsciiString& theFile) const;
+
+  //! Load glyphs from the file saved by Save() and append them to the cache;
+  //! glyphs already present in the cache are kept.
+  //! @param[in] theFile file path
+  //! @return FALSE if file cannot be read or has unexpected format
+  Standard_EXPORT bool Load(const TCollection_AsciiString& theFile);
+
+private:
+  //! Map of glyphs within a face.
+  typedef NCollection_DataMap<char32_t, Glyph> GlyphMap;
+
+  //! Map of faces.
+  typedef NCollection_DataMap<TCollection_AsciiString, GlyphMap> FaceMap;
+
+  //! Add glyph assuming the mutex is locked.
+  bool addGlyph(const TCollection_AsciiString& theFaceKey,
+                char32_t                       theUChar,
+                const Glyph&                   theGlyph);
+
+private:
+  FaceMap            myFaces;      //!< glyphs per face key
+  mutable std::mutex myMutex;      //!< access mutex
+  size_t             myMaxMemory;  //!< memory limit
+  size_t             myUsedMemory; //!< size of cached bitmaps
+  int                myNbGlyphs;   //!< number of glyphs
+  mutable size_t     myNbHits;     //!< number of cache hits
+  mutable size_t     myNbMisses;   //!< number of cache misses
+};
+
+#endif // _Font_GlyphCache_HeaderFile
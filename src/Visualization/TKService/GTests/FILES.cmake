@@ -2,6 +2,8 @@
 set(OCCT_TKService_GTests_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
 
 set(OCCT_TKService_GTests_FILES
+  Font_GlyphCache_Test.cxx
   Graphic3d_BndBox_Test.cxx
+  Graphic3d_VertexQuantizer_Test.cxx
   Image_VideoRecorder_Test.cxx
 )
@@ -0,0 +1,144 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <gtest/gtest.h>
+
+#include <Font_GlyphCache.hxx>
+#include <OSD_File.hxx>
+#include <OSD_Path.hxx>
+
+#include <thread>
+#include <vector>
+
+namespace
+{
+//! Create glyph with gradient bitmap of specified size.
+static Font_GlyphCache::Glyph createGlyph(const int theSizeX, const int theSizeY)
+{
+  Font_GlyphCache::Glyph aGlyph;
+  aGlyph.Image = new Image_PixMap();
+  EXPECT_TRUE(aGlyph.Image->InitTrash(Image_Format_Alpha, theSizeX, theSizeY));
+  aGlyph.Image->SetTopDown(true);
+  for (int aRow = 0; aRow < theSizeY; ++aRow)
+  {
+    for (int aCol = 0; aCol < theSizeX; ++aCol)
+    {
+      *aGlyph.Image->ChangeRawValue(aRow, aCol) = uint8_t((aRow * 16 + aCol) % 256);
+    }
+  }
+  aGlyph.Rect.Left   = 1.0f;
+  aGlyph.Rect.Right  = 1.0f + float(theSizeX);
+  aGlyph.Rect.Top    = float(theSizeY);
+  aGlyph.Rect.Bottom = -2.0f;
+  return aGlyph;
+}
+} // namespace
+
+TEST(Font_GlyphCacheTest, FindAndAdd)
+{
+  occ::handle<Font_GlyphCache> aCache = new Font_GlyphCache();
+  Font_GlyphCache::Glyph       aGlyph;
+  EXPECT_FALSE(aCache->Find("font|12", U'A', aGlyph));
+
+  EXPECT_TRUE(aCache->Add("font|12", U'A', createGlyph(7, 9)));
+  EXPECT_TRUE(aCache->Add("font|12", U' ', Font_GlyphCache::Glyph()));
+  EXPECT_EQ(2, aCache->NbGlyphs());
+  EXPECT_EQ(size_t(7 * 9), aCache->UsedMemory());
+
+  ASSERT_TRUE(aCache->Find("font|12", U'A', aGlyph));
+  ASSERT_TRUE(aGlyph.IsValid());
+  EXPECT_EQ(size_t(7), aGlyph.Image->SizeX());
+  EXPECT_FLOAT_EQ(8.0f, aGlyph.Rect.Right);
+
+  ASSERT_TRUE(aCache->Find("font|12", U' ', aGlyph));
+  EXPECT_FALSE(aGlyph.IsValid()) << "empty glyph should be cached as well";
+  EXPECT_FALSE(aCache->Find("font|14", U'A', aGlyph)) << "face keys should not be mixed";
+  EXPECT_EQ(size_t(3), aCache->NbHits());
+  EXPECT_EQ(size_t(2), aCache->NbMisses());
+
+  EXPECT_TRUE(aCache->Add("font|12", U'A', createGlyph(3, 3)));
+  EXPECT_EQ(2, aCache->NbGlyphs()) << "existing glyph should be kept";
+
+  aCache->SetMaxMemory(100);
+  EXPECT_FALSE(aCache->Add("font|12", U'B', createGlyph(8, 8)));
+  EXPECT_EQ(2, aCache->NbGlyphs());
+
+  aCache->Clear();
+  EXPECT_EQ(0, aCache->NbGlyphs());
+  EXPECT_EQ(size_t(0), aCache->UsedMemory());
+  EXPECT_FALSE(aCache->Find("font|12", U'A', aGlyph));
+}
+
+TEST(Font_GlyphCacheTest, ConcurrentAccess)
+{
+  occ::handle<Font_GlyphCache> aCache = new Font_GlyphCache();
+  std::vector<std::thread>     aThreads;
+  for (int aThreadIter = 0; aThreadIter < 4; ++aThreadIter)
+  {
+    aThreads.emplace_back([&aCache]() {
+      for (char32_t aChar = U'a'; aChar <= U'z'; ++aChar)
+      {
+        Font_GlyphCache::Glyph aGlyph;
+        if (!aCache->Find("font|12", aChar, aGlyph))
+        {
+          aCache->Add("font|12", aChar, createGlyph(4, 4));
+        }
+      }
+    });
+  }
+  for (std::thread& aThread : aThreads)
+  {
+    aThread.join();
+  }
+  EXPECT_EQ(26, aCache->NbGlyphs());
+  EXPECT_EQ(size_t(26 * 16), aCache->UsedMemory());
+}
+
+TEST(Font_GlyphCacheTest, SaveAndLoad)
+{
+  const TCollection_AsciiString aFile = "Font_GlyphCacheTest_SaveAndLoad.bin";
+
+  occ::handle<Font_GlyphCache> aCache = new Font_GlyphCache();
+  aCache->Add("font|12", U'A', createGlyph(7, 9));
+  aCache->Add("font|12", U' ', Font_GlyphCache::Glyph());
+  aCache->Add("font|24", U'\x0416', createGlyph(15, 17));
+  ASSERT_TRUE(aCache->Save(aFile));
+
+  occ::handle<Font_GlyphCache> aLoaded = new Font_GlyphCache();
+  ASSERT_TRUE(aLoaded->Load(aFile));
+  OSD_File(OSD_Path(aFile)).Remove();
+  EXPECT_EQ(3, aLoaded->NbGlyphs());
+  EXPECT_EQ(aCache->UsedMemory(), aLoaded->UsedMemory());
+
+  Font_GlyphCache::Glyph anOrig, aGlyph;
+  ASSERT_TRUE(aCache->Find("font|24", U'\x0416', anOrig));
+  ASSERT_TRUE(aLoaded->Find("font|24", U'\x0416', aGlyph));
+  ASSERT_TRUE(aGlyph.IsValid());
+  EXPECT_EQ(Image_Format_Alpha, aGlyph.Image->Format());
+  EXPECT_TRUE(aGlyph.Image->IsTopDown());
+  ASSERT_EQ(anOrig.Image->SizeX(), aGlyph.Image->SizeX());
+  ASSERT_EQ(anOrig.Image->SizeY(), aGlyph.Image->SizeY());
+  for (size_t aRow = 0; aRow < aGlyph.Image->SizeY(); ++aRow)
+  {
+    EXPECT_EQ(0, memcmp(anOrig.Image->Row(aRow), aGlyph.Image->Row(aRow), aGlyph.Image->SizeX()));
+  }
+  EXPECT_FLOAT_EQ(anOrig.Rect.Left, aGlyph.Rect.Left);
+  EXPECT_FLOAT_EQ(anOrig.Rect.Right, aGlyph.Rect.Right);
+  EXPECT_FLOAT_EQ(anOrig.Rect.Top, aGlyph.Rect.Top);
+  EXPECT_FLOAT_EQ(anOrig.Rect.Bottom, aGlyph.Rect.Bottom);
+
+  ASSERT_TRUE(aLoaded->Find("font|12", U' ', aGlyph));
+  EXPECT_FALSE(aGlyph.IsValid());
+
+  EXPECT_FALSE(aLoaded->Load("Font_GlyphCacheTest_Missing.bin"));
+}
@@ -0,0 +1,174 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <gtest/gtest.h>
+
+#include <Graphic3d_VertexQuantizer.hxx>
+
+#include <cmath>
+
+namespace
+{
+//! Create interleaved buffer with positions, normals, texture coordinates and colors
+//! of vertices on a sphere.
+static occ::handle<Graphic3d_Buffer> createSphereBuffer(const int   theNbVerts,
+                                                        const float theRadius)
+{
+  const Graphic3d_Attribute anAttribs[4] = {{Graphic3d_TOA_POS, Graphic3d_TOD_VEC3},
+                                            {Graphic3d_TOA_NORM, Graphic3d_TOD_VEC3},
+                                            {Graphic3d_TOA_UV, Graphic3d_TOD_VEC2},
+                                            {Graphic3d_TOA_COLOR, Graphic3d_TOD_VEC4UB}};
+  occ::handle<Graphic3d_Buffer> aBuffer =
+    new Graphic3d_Buffer(NCollection_BaseAllocator::CommonBaseAllocator());
+  EXPECT_TRUE(aBuffer->Init(theNbVerts, anAttribs, 4));
+  for (int aVertIter = 0; aVertIter < theNbVerts; ++aVertIter)
+  {
+    const float aPhi  = 2.399963f * float(aVertIter);
+    const float aCosT = 1.0f - 2.0f * (float(aVertIter) + 0.5f) / float(theNbVerts);
+    const float aSinT = std::sqrt(1.0f - aCosT * aCosT);
+    const NCollection_Vec3<float> aNorm(aSinT * std::cos(aPhi), aSinT * std::sin(aPhi), aCosT);
+    uint8_t* aVert = aBuffer->changeValue(aVertIter);
+    *reinterpret_cast<NCollection_Vec3<float>*>(aVert) =
+      aNorm * theRadius + NCollection_Vec3<float>(10.0f, -5.0f, 2.0f);
+    *reinterpret_cast<NCollection_Vec3<float>*>(aVert + 12) = aNorm;
+    *reinterpret_cast<NCollection_Vec2<float>*>(aVert + 24) =
+      NCollection_Vec2<float>(float(aVertIter) / float(theNbVerts), aCosT * 0.5f + 0.5f);
+    *reinterpret_cast<NCollection_Vec4<uint8_t>*>(aVert + 32) =
+      NCollection_Vec4<uint8_t>(uint8_t(aVertIter % 256), 10, 20, 255);
+  }
+  return aBuffer;
+}
+} // namespace
+
+TEST(Graphic3d_VertexQuantizerTest, HalfFloatConversion)
+{
+  EXPECT_EQ(0x0000, Graphic3d_VertexQuantizer::FloatToHalf(0.0f));
+  EXPECT_EQ(0x3C00, Graphic3d_VertexQuantizer::FloatToHalf(1.0f));
+  EXPECT_EQ(0xC000, Graphic3d_VertexQuantizer::FloatToHalf(-2.0f));
+  EXPECT_EQ(0x7BFF, Graphic3d_VertexQuantizer::FloatToHalf(65504.0f));
+  EXPECT_EQ(0x7C00, Graphic3d_VertexQuantizer::FloatToHalf(1.0e6f));
+  EXPECT_EQ(0x0001, Graphic3d_VertexQuantizer::FloatToHalf(5.9604645e-8f));
+  EXPECT_FLOAT_EQ(0.5f, Graphic3d_VertexQuantizer::HalfToFloat(0x3800));
+  EXPECT_FLOAT_EQ(-2.0f, Graphic3d_VertexQuantizer::HalfToFloat(0xC000));
+
+  for (float aValue = -4.0f; aValue <= 4.0f; aValue += 0.0371f)
+  {
+    const float aRes =
+      Graphic3d_VertexQuantizer::HalfToFloat(Graphic3d_VertexQuantizer::FloatToHalf(aValue));
+    EXPECT_NEAR(aValue, aRes, std::abs(aValue) * 0.0005f + 1.0e-7f);
+  }
+}
+
+TEST(Graphic3d_VertexQuantizerTest, OctahedralNormals)
+{
+  const NCollection_Vec3<float> aDirs[6] = {NCollection_Vec3<float>(1.0f, 0.0f, 0.0f),
+                                            NCollection_Vec3<float>(-1.0f, 0.0f, 0.0f),
+                                            NCollection_Vec3<float>(0.0f, 1.0f, 0.0f),
+                                            NCollection_Vec3<float>(0.0f, -1.0f, 0.0f),
+                                            NCollection_Vec3<float>(0.0f, 0.0f, 1.0f),
+                                            NCollection_Vec3<float>(0.0f, 0.0f, -1.0f)};
+  for (const NCollection_Vec3<float>& aDir : aDirs)
+  {
+    const NCollection_Vec3<float> aRes = Graphic3d_VertexQuantizer::DecodeOctahedral(
+      Graphic3d_VertexQuantizer::EncodeOctahedral(aDir));
+    EXPECT_NEAR(1.0f, aRes.Dot(aDir), 1.0e-6f);
+  }
+
+  occ::handle<Graphic3d_Buffer> aBuffer = createSphereBuffer(1000, 1.0f);
+  for (int aVertIter = 0; aVertIter < aBuffer->NbElements; ++aVertIter)
+  {
+    const NCollection_Vec3<float>& aNorm =
+      *reinterpret_cast<const NCollection_Vec3<float>*>(aBuffer->value(aVertIter) + 12);
+    const NCollection_Vec3<float> aRes = Graphic3d_VertexQuantizer::DecodeOctahedral(
+      Graphic3d_VertexQuantizer::EncodeOctahedral(aNorm));
+    EXPECT_NEAR(1.0f, aRes.Modulus(), 1.0e-5f);
+    EXPECT_GT(aRes.Dot(aNorm), 0.999998f) << "angular error should be below 0.1 degree";
+  }
+}
+
+TEST(Graphic3d_VertexQuantizerTest, CompressBuffer)
+{
+  occ::handle<Graphic3d_Buffer> aBuffer = createSphereBuffer(500, 3.0f);
+
+  Graphic3d_VertexQuantizer     aQuantizer;
+  occ::handle<Graphic3d_Buffer> aResult = aQuantizer.Perform(*aBuffer);
+  ASSERT_FALSE(aResult.IsNull());
+  EXPECT_TRUE(aQuantizer.HasQuantizedPositions());
+  EXPECT_EQ(aBuffer->NbElements, aResult->NbElements);
+  ASSERT_EQ(4, aResult->NbAttributes);
+  EXPECT_EQ(Graphic3d_TOD_VEC4US, aResult->Attribute(0).DataType);
+  EXPECT_EQ(Graphic3d_TOD_VEC2S, aResult->Attribute(1).DataType);
+  EXPECT_EQ(Graphic3d_TOD_VEC2HF, aResult->Attribute(2).DataType);
+  EXPECT_EQ(Graphic3d_TOD_VEC4UB, aResult->Attribute(3).DataType);
+  EXPECT_EQ(20, aResult->Stride) << "8 + 4 + 4 + 4 bytes instead of 12 + 12 + 8 + 4";
+  EXPECT_NEAR(6.0f, aQuantizer.PositionRange(), 0.05f);
+
+  const NCollection_Mat4<float> aDequant = aQuantizer.DequantizationMatrix();
+  const float                   aTol     = aQuantizer.PositionRange() / 65535.0f;
+  for (int aVertIter = 0; aVertIter < aBuffer->NbElements; ++aVertIter)
+  {
+    const uint8_t* aSrc = aBuffer->value(aVertIter);
+    const uint8_t* aDst = aResult->value(aVertIter);
+
+    const NCollection_Vec3<float>& aPnt = *reinterpret_cast<const NCollection_Vec3<float>*>(aSrc);
+    const NCollection_Vec4<uint16_t>& aQPnt =
+      *reinterpret_cast<const NCollection_Vec4<uint16_t>*>(aDst);
+    EXPECT_EQ(65535, aQPnt.w());
+    const NCollection_Vec4<float> aNormPnt(float(aQPnt.x()) / 65535.0f,
+                                           float(aQPnt.y()) / 65535.0f,
+                                           float(aQPnt.z()) / 65535.0f,
+                                           float(aQPnt.w()) / 65535.0f);
+    const NCollection_Vec4<float> aRestored = aDequant * aNormPnt;
+    EXPECT_NEAR(aPnt.x(), aRestored.x(), aTol);
+    EXPECT_NEAR(aPnt.y(), aRestored.y(), aTol);
+    EXPECT_NEAR(aPnt.z(), aRestored.z(), aTol);
+    EXPECT_TRUE((aQuantizer.DequantizePosition(aQPnt) - aPnt).Modulus() <= aTol);
+
+    const NCollection_Vec3<float>& aNorm =
+      *reinterpret_cast<const NCollection_Vec3<float>*>(aSrc + 12);
+    const NCollection_Vec3<float> aDecNorm = Graphic3d_VertexQuantizer::DecodeOctahedral(
+      *reinterpret_cast<const NCollection_Vec2<int16_t>*>(aDst + 8));
+    EXPECT_GT(aDecNorm.Dot(aNorm), 0.99999f);
+
+    const NCollection_Vec2<float>& aUV =
+      *reinterpret_cast<const NCollection_Vec2<float>*>(aSrc + 24);
+    const NCollection_Vec2<uint16_t>& aHUV =
+      *reinterpret_cast<const NCollection_Vec2<uint16_t>*>(aDst + 12);
+    EXPECT_NEAR(aUV.x(), Graphic3d_VertexQuantizer::HalfToFloat(aHUV.x()), 0.001f);
+    EXPECT_NEAR(aUV.y(), Graphic3d_VertexQuantizer::HalfToFloat(aHUV.y()), 0.001f);
+
+    EXPECT_EQ(0, memcmp(aSrc + 32, aDst + 16, 4)) << "colors should be copied as is";
+  }
+}
+
+TEST(Graphic3d_VertexQuantizerTest, SelectedAttributes)
+{
+  occ::handle<Graphic3d_Buffer> aBuffer = createSphereBuffer(10, 1.0f);
+
+  Graphic3d_VertexQuantizer aQuantizer;
+  aQuantizer.SetQuantizePositions(false);
+  aQuantizer.SetConvertTexCoords(false);
+  occ::handle<Graphic3d_Buffer> aResult = aQuantizer.Perform(*aBuffer);
+  ASSERT_FALSE(aResult.IsNull());
+  EXPECT_FALSE(aQuantizer.HasQuantizedPositions());
+  EXPECT_EQ(Graphic3d_TOD_VEC3, aResult->Attribute(0).DataType);
+  EXPECT_EQ(Graphic3d_TOD_VEC2S, aResult->Attribute(1).DataType);
+  EXPECT_EQ(Graphic3d_TOD_VEC2, aResult->Attribute(2).DataType);
+  EXPECT_EQ(0, memcmp(aBuffer->value(3), aResult->value(3), 12))
+    << "positions should be copied as is";
+  EXPECT_TRUE(aQuantizer.DequantizationMatrix().IsIdentity());
+
+  aQuantizer.SetEncodeNormals(false);
+  EXPECT_TRUE(aQuantizer.Perform(*aBuffer).IsNull())
+    << "buffer without attributes to compress should not be copied";
+}
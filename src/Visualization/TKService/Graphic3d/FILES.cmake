@@ -89,6 +89,7 @@ set(OCCT_Graphic3d_FILES
   Graphic3d_PresentationAttributes.hxx
   Graphic3d_PresentationAttributes.cxx
   Graphic3d_HorizontalTextAlignment.hxx
+  Graphic3d_IdBufferSample.hxx
   Graphic3d_IndexBuffer.hxx
   Graphic3d_MutableIndexBuffer.hxx
   Graphic3d_LevelOfTextureAnisotropy.hxx
@@ -196,9 +197,13 @@ set(OCCT_Graphic3d_FILES
   Graphic3d_TypeOfTextureFilter.hxx
   Graphic3d_TypeOfTextureMode.hxx
   Graphic3d_TypeOfVisualization.hxx
+  Graphic3d_UpscalingMethod.hxx
+  Graphic3d_UpscalingQuality.hxx
 
   Graphic3d_Vertex.cxx
   Graphic3d_Vertex.hxx
+  Graphic3d_VertexQuantizer.cxx
+  Graphic3d_VertexQuantizer.hxx
   Graphic3d_VerticalTextAlignment.hxx
   Graphic3d_ViewAffinity.cxx
   Graphic3d_ViewAffinity.hxx
@@ -24,12 +24,29 @@ IMPLEMENT_STANDARD_RTTIEXT(Graphic3d_MutableIndexBuffer, Graphic3d_IndexBuffer)
 
 //=================================================================================================
 
-const occ::handle<NCollection_BaseAllocator>& Graphic3d_Buffer::DefaultAllocator()
+namespace
+{
+//! Return modifiable default vertex data allocator.
+static occ::handle<NCollection_BaseAllocator>& defaultAllocator()
 {
-  static const occ::handle<NCollection_BaseAllocator> THE_ALLOC =
-    new NCollection_AlignedAllocator(16);
+  static occ::handle<NCollection_BaseAllocator> THE_ALLOC = new NCollection_AlignedAllocator(16);
   return THE_ALLOC;
 }
+} // namespace
+
+//=================================================================================================
+
+const occ::handle<NCollection_BaseAllocator>& Graphic3d_Buffer::DefaultAllocator()
+{
+  return defaultAllocator();
+}
+
+//=================================================================================================
+
+void Graphic3d_Buffer::SetDefaultAllocator(const occ::handle<NCollection_BaseAllocator>& theAlloc)
+{
+  defaultAllocator() = !theAlloc.IsNull() ? theAlloc : new NCollection_AlignedAllocator(16);
+}
 
 //=================================================================================================
 
@@ -44,6 +44,9 @@ enum Graphic3d_TypeOfData
   Graphic3d_TOD_VEC4,   //!< 4-components float vector
   Graphic3d_TOD_VEC4UB, //!< 4-components unsigned byte vector
   Graphic3d_TOD_FLOAT,  //!< float value
+  Graphic3d_TOD_VEC4US, //!< 4-components normalized unsigned 16-bit integer vector
+  Graphic3d_TOD_VEC2S,  //!< 2-components normalized signed 16-bit integer vector
+  Graphic3d_TOD_VEC2HF, //!< 2-components half-float vector
 };
 
 //! Vertex attribute definition.
@@ -75,6 +78,12 @@ struct Graphic3d_Attribute
         return sizeof(NCollection_Vec4<uint8_t>);
       case Graphic3d_TOD_FLOAT:
         return sizeof(float);
+      case Graphic3d_TOD_VEC4US:
+        return sizeof(NCollection_Vec4<uint16_t>);
+      case Graphic3d_TOD_VEC2S:
+        return sizeof(NCollection_Vec2<int16_t>);
+      case Graphic3d_TOD_VEC2HF:
+        return sizeof(NCollection_Vec2<uint16_t>);
     }
     return 0;
   }
@@ -88,6 +97,13 @@ public:
   //! Return default vertex data allocator.
   Standard_EXPORT static const occ::handle<NCollection_BaseAllocator>& DefaultAllocator();
 
+  //! Override default vertex data allocator, e.g. by graphic driver allocating memory
+  //! which can be shared with GPU without copying; NULL restores the built-in 16-bytes aligned
+  //! allocator. Affects only buffers created afterwards; should be called before creating
+  //! presentations, as the method is not thread-safe.
+  Standard_EXPORT static void SetDefaultAllocator(
+    const occ::handle<NCollection_BaseAllocator>& theAlloc);
+
 public:
   //! Empty constructor.
   Graphic3d_Buffer(const occ::handle<NCollection_BaseAllocator>& theAlloc)
@@ -20,10 +20,24 @@
 
 IMPLEMENT_STANDARD_RTTIEXT(Graphic3d_BvhCStructureSet, BVH_PrimitiveSet3d)
 
+namespace
+{
+//! Number of incremental updates allowed after the rebuild of the tree in addition
+//! to the quarter of the number of structures it has been built for; the tree is rebuilt
+//! after exceeding this limit to restore its quality, so that the time of rebuilding
+//! is amortized over the number of changes.
+static const int THE_NB_INCREMENTAL_UPDATES = 64;
+} // namespace
+
 //=================================================================================================
 
 Graphic3d_BvhCStructureSet::Graphic3d_BvhCStructureSet()
+    : myDynamicBVH(new BVH_DynamicTree<double, 3>()),
+      myNbIndexed(0),
+      myNbBuilt(0),
+      myNbUpdates(0)
 {
+  myBVH = myDynamicBVH;
   myBuilder =
     new BVH_BinnedBuilder<double, 3>(BVH_Constants_LeafNodeSizeSingle, BVH_Constants_MaxTreeDepth);
 }
@@ -69,8 +83,7 @@ bool Graphic3d_BvhCStructureSet::Add(const Graphic3d_CStructure* theStruct)
 
   if (myStructs.Add(theStruct) > aSize) // new structure?
   {
-    MarkDirty();
-
+    // the structure is inserted into the tree on the next request of BVH()
     return true;
   }
 
@@ -85,9 +98,19 @@ bool Graphic3d_BvhCStructureSet::Remove(const Graphic3d_CStructure* theStruct)
 
   if (anIndex != 0)
   {
-    myStructs.Swap(Size(), anIndex);
+    if (anIndex <= myNbIndexed && toUpdateIncrementally())
+    {
+      // keep the structures of the tree at the beginning of the map
+      myDynamicBVH->Remove(anIndex - 1);
+      myDynamicBVH->ChangeElementIndex(myNbIndexed - 1, anIndex - 1);
+      myStructs.Swap(myNbIndexed, anIndex);
+      myStructs.Swap(Size(), myNbIndexed--);
+    }
+    else
+    {
+      myStructs.Swap(Size(), anIndex);
+    }
     myStructs.RemoveLast();
-    MarkDirty();
 
     return true;
   }
@@ -97,6 +120,24 @@ bool Graphic3d_BvhCStructureSet::Remove(const Graphic3d_CStructure* theStruct)
 
 //=================================================================================================
 
+bool Graphic3d_BvhCStructureSet::UpdateStructure(const Graphic3d_CStructure* theStruct)
+{
+  const int anIndex = myStructs.FindIndex(theStruct);
+  if (anIndex == 0)
+  {
+    return false;
+  }
+
+  // pending structures are inserted with their actual boxes anyway
+  if (anIndex <= myNbIndexed && toUpdateIncrementally())
+  {
+    myDynamicBVH->Update(*this, anIndex - 1);
+  }
+  return true;
+}
+
+//=================================================================================================
+
 void Graphic3d_BvhCStructureSet::Clear()
 {
   myStructs.Clear();
@@ -105,6 +146,67 @@ void Graphic3d_BvhCStructureSet::Clear()
 
 //=================================================================================================
 
+const opencascade::handle<BVH_Tree<double, 3>>& Graphic3d_BvhCStructureSet::BVH()
+{
+  if (myNbIndexed < Size() && toUpdateIncrementally(Size() - myNbIndexed))
+  {
+    for (; myNbIndexed < Size(); ++myNbIndexed)
+    {
+      myDynamicBVH->Insert(*this, myNbIndexed);
+    }
+  }
+  if (!myIsDirty && !myDynamicBVH->IsDynamic())
+  {
+    // the tree became too deep
+    MarkDirty();
+  }
+  if (!myIsDirty)
+  {
+    myBox = myDynamicBVH->Length() > myDynamicBVH->NbFreeNodes()
+              ? Graphic3d_BndBox3d(myDynamicBVH->MinPoint(0), myDynamicBVH->MaxPoint(0))
+              : Graphic3d_BndBox3d();
+  }
+  return BVH_PrimitiveSet3d::BVH();
+}
+
+//=================================================================================================
+
+void Graphic3d_BvhCStructureSet::Update()
+{
+  if (!myIsDirty)
+  {
+    return;
+  }
+
+  BVH_PrimitiveSet3d::Update();
+  myDynamicBVH->Init(*this);
+  myNbIndexed = Size();
+  myNbBuilt   = Size();
+  myNbUpdates = 0;
+}
+
+//=================================================================================================
+
+bool Graphic3d_BvhCStructureSet::toUpdateIncrementally(const int theNbUpdates)
+{
+  if (myIsDirty)
+  {
+    return false;
+  }
+
+  if (myDynamicBVH->IsDynamic()
+      && myNbUpdates + theNbUpdates <= THE_NB_INCREMENTAL_UPDATES + myNbBuilt / 4)
+  {
+    myNbUpdates += theNbUpdates;
+    return true;
+  }
+
+  MarkDirty();
+  return false;
+}
+
+//=================================================================================================
+
 const Graphic3d_CStructure* Graphic3d_BvhCStructureSet::GetStructureById(int theId)
 {
   return myStructs.FindKey(theId + 1);
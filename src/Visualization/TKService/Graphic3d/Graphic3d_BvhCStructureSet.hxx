@@ -16,6 +16,7 @@
 #ifndef _Graphic3d_BvhCStructureSet_HeaderFile
 #define _Graphic3d_BvhCStructureSet_HeaderFile
 
+#include <BVH_DynamicTree.hxx>
 #include <BVH_PrimitiveSet3d.hxx>
 #include <Graphic3d_BndBox3d.hxx>
 #include <NCollection_IndexedMap.hxx>
@@ -23,6 +24,11 @@
 class Graphic3d_CStructure;
 
 //! Set of OpenGl_Structures for building BVH tree.
+//! The tree is built from scratch only after Clear() or too many changes since the last build;
+//! otherwise added, removed and moved structures update the tree incrementally
+//! (see BVH_DynamicTree), so that streaming of structures into the scene does not lead
+//! to repeated rebuilding of the whole tree. Added structures are inserted into the tree
+//! lazily on the next request of BVH(), when their bounding boxes are expected to be computed.
 class Graphic3d_BvhCStructureSet : public BVH_PrimitiveSet3d
 {
   DEFINE_STANDARD_RTTIEXT(Graphic3d_BvhCStructureSet, BVH_PrimitiveSet3d)
@@ -53,6 +59,10 @@ public:
   //! @return true if structure removed, otherwise returns false (structure is not in the set).
   Standard_EXPORT bool Remove(const Graphic3d_CStructure* theStruct);
 
+  //! Updates the tree after modification of the bounding box of the given structure.
+  //! @return true if structure updated, otherwise returns false (structure is not in the set).
+  Standard_EXPORT bool UpdateStructure(const Graphic3d_CStructure* theStruct);
+
   //! Cleans the whole primitive set.
   Standard_EXPORT void Clear();
 
@@ -65,9 +75,24 @@ public:
     return myStructs;
   }
 
+  //! Returns BVH tree (rebuilds it if necessary or inserts the added structures into it).
+  Standard_EXPORT const opencascade::handle<BVH_Tree<double, 3>>& BVH() override;
+
+protected:
+  //! Rebuilds the tree from scratch and prepares it for incremental updates.
+  Standard_EXPORT void Update() override;
+
+  //! Returns true if one more incremental update of the built tree is allowed;
+  //! otherwise marks the tree for rebuilding.
+  Standard_EXPORT bool toUpdateIncrementally(const int theNbUpdates = 1);
+
 private:
   // clang-format off
   NCollection_IndexedMap<const Graphic3d_CStructure*> myStructs;    //!< Indexed map of structures.
+  occ::handle<BVH_DynamicTree<double, 3>>            myDynamicBVH; //!< Incrementally updated tree (same as myBVH)
+  int                                                 myNbIndexed;  //!< Number of first structures in the tree (others are pending insertion)
+  int                                                 myNbBuilt;    //!< Number of structures at the last rebuild of the tree
+  int                                                 myNbUpdates;  //!< Number of incremental updates since the last rebuild of the tree
   // clang-format on
 };
 
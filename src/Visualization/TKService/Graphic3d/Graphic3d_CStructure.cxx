@@ -14,6 +14,7 @@
 
 #include <Graphic3d_CStructure.hxx>
 
+#include <Graphic3d_CullingTool.hxx>
 #include <Graphic3d_StructureManager.hxx>
 #include <Graphic3d_GraphicDriver.hxx>
 #include <Standard_Dump.hxx>
@@ -32,6 +33,7 @@ Graphic3d_CStructure::Graphic3d_CStructure(
       myIsCulled(true),
       myBndBoxClipCheck(true),
       myHasGroupTrsf(false),
+      myLodLevel(-1),
       //
       IsInfinite(0),
       stick(0),
@@ -83,4 +85,66 @@ void Graphic3d_CStructure::DumpJson(Standard_OStream& theOStream, int theDepth)
 
   OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, myIsCulled)
   OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, myBndBoxClipCheck)
+  OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, myLodLevel)
+}
+
+//=================================================================================================
+
+void Graphic3d_CStructure::UpdateLevelOfDetail(const Graphic3d_CullingTool& theSelector,
+                                               const double                 thePixelError) const
+{
+  // deflection of each level is the maximum one among its groups
+  double aLodDeflections[Graphic3d_Group::MaxLevelsOfDetail] = {};
+  int    aNbLods                                             = 0;
+  for (NCollection_Sequence<occ::handle<Graphic3d_Group>>::Iterator aGroupIter(myGroups);
+       aGroupIter.More();
+       aGroupIter.Next())
+  {
+    const int aLevel = aGroupIter.Value()->LevelOfDetail();
+    if (aLevel >= 0)
+    {
+      aLodDeflections[aLevel] =
+        std::max(aLodDeflections[aLevel], (double)aGroupIter.Value()->LodDeflection());
+      aNbLods = std::max(aNbLods, aLevel + 1);
+    }
+  }
+  if (aNbLods == 0)
+  {
+    myLodLevel = -1;
+    return;
+  }
+  if (thePixelError <= 0.0 || !myBndBox.IsValid())
+  {
+    myLodLevel = 0;
+    return;
+  }
+
+  const NCollection_Vec3<double> aCenter   = (myBndBox.CornerMin() + myBndBox.CornerMax()) * 0.5;
+  const double                   aPixelSize = theSelector.PixelWorldSize(aCenter);
+  if (aPixelSize <= 0.0)
+  {
+    myLodLevel = 0;
+    return;
+  }
+
+  // return the coarsest level which deflection fits into specified tolerance
+  const auto findLevel = [&](double theTolerance) {
+    int aLevel = 0;
+    for (int aLevelIter = 1; aLevelIter < aNbLods; ++aLevelIter)
+    {
+      if (aLodDeflections[aLevelIter] / aPixelSize <= theTolerance)
+      {
+        aLevel = aLevelIter;
+      }
+    }
+    return aLevel;
+  };
+
+  const double aHysteresis  = 0.25;
+  const int    aStrictLevel = findLevel(thePixelError * (1.0 - aHysteresis));
+  const int    aLooseLevel  = findLevel(thePixelError * (1.0 + aHysteresis));
+  if (myLodLevel < aStrictLevel || myLodLevel > aLooseLevel)
+  {
+    myLodLevel = findLevel(thePixelError);
+  }
 }
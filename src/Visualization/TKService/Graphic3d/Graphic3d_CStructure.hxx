@@ -26,6 +26,7 @@
 #include <TopLoc_Datum3D.hxx>
 #include <NCollection_IndexedMap.hxx>
 
+class Graphic3d_CullingTool;
 class Graphic3d_GraphicDriver;
 class Graphic3d_StructureManager;
 
@@ -181,6 +182,28 @@ public:
   //! Enable/disable check of object's bounding box clipping before drawing of object.
   void SetBndBoxClipCheck(bool theBndBoxClipCheck) { myBndBoxClipCheck = theBndBoxClipCheck; }
 
+  //! Returns level of detail currently chosen for groups of this structure
+  //! (see Graphic3d_Group::LevelOfDetail()), or -1 if none has been chosen yet.
+  int LevelOfDetail() const { return myLodLevel; }
+
+  //! Returns TRUE if the group should be drawn at the current level of detail:
+  //! either the group is not assigned to any level, or its level is the chosen one
+  //! (the finest level is drawn while no level has been chosen).
+  bool IsGroupDrawn(const Graphic3d_Group& theGroup) const
+  {
+    return theGroup.LevelOfDetail() < 0 || theGroup.LevelOfDetail() == std::max(myLodLevel, 0);
+  }
+
+  //! Chooses the coarsest level of detail of groups, which deflection projected onto the screen
+  //! at the center of the structure bounding box does not exceed thePixelError pixels.
+  //! The previously chosen level is kept while its projected deflection remains within
+  //! +/- 25% of tolerance, so that levels do not flicker when view is changed slowly
+  //! around the threshold. The method is called once per frame before rendering.
+  //! @param[in] theSelector  culling tool initialized by the current view camera and viewport
+  //! @param[in] thePixelError  tolerance in pixels; non-positive value chooses the finest level
+  Standard_EXPORT void UpdateLevelOfDetail(const Graphic3d_CullingTool& theSelector,
+                                           const double                 thePixelError) const;
+
   //! Checks if the structure should be included into BVH tree or not.
   bool IsAlwaysRendered() const
   {
@@ -250,6 +273,7 @@ protected:
   bool myBndBoxClipCheck;  //!< Flag responsible for checking of bounding box clipping before drawing of object
 
   bool myHasGroupTrsf;     //!< flag specifying that some groups might have transform persistence
+  mutable int myLodLevel;  //!< chosen level of detail of groups, -1 if undefined
 
 public:
 
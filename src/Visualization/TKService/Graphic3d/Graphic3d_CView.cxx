@@ -422,7 +422,7 @@ void Graphic3d_CView::ReCompute(const occ::handle<Graphic3d_Structure>& theStruc
       && !theStruct->CStructure()->IsInfinite)
   {
     const Graphic3d_ZLayerId aLayerId = theStruct->GetZLayer();
-    InvalidateBVHData(aLayerId);
+    InvalidateBVHStructure(theStruct->CStructure().get(), aLayerId);
   }
 
   if (!ComputedMode() || !IsActive() || !theStruct->IsDisplayed())
@@ -1017,7 +1017,7 @@ void Graphic3d_CView::SetTransform(const occ::handle<Graphic3d_Structure>& theSt
       && !theStructure->CStructure()->IsInfinite)
   {
     const Graphic3d_ZLayerId aLayerId = theStructure->GetZLayer();
-    InvalidateBVHData(aLayerId);
+    InvalidateBVHBoxes(aLayerId);
   }
 }
 
@@ -22,6 +22,7 @@
 #include <Graphic3d_DataStructureManager.hxx>
 #include <Graphic3d_DiagnosticInfo.hxx>
 #include <Graphic3d_GraduatedTrihedron.hxx>
+#include <Graphic3d_IdBufferSample.hxx>
 #include <Standard_Transient.hxx>
 #include <NCollection_Map.hxx>
 #include <NCollection_Shared.hxx>
@@ -41,6 +42,7 @@
 #include <Image_PixMap.hxx>
 #include <TCollection_AsciiString.hxx>
 #include <NCollection_IndexedDataMap.hxx>
+#include <NCollection_Vector.hxx>
 
 class Aspect_NeutralWindow;
 class Aspect_XRSession;
@@ -300,6 +302,22 @@ public:
   //! as outdated.
   virtual void InvalidateBVHData(const Graphic3d_ZLayerId theLayerId) = 0;
 
+  //! Marks bounding boxes of BVH tree of the layer with id theLayerId as outdated
+  //! after its structures have been moved; by default invalidates the whole BVH data.
+  virtual void InvalidateBVHBoxes(const Graphic3d_ZLayerId theLayerId)
+  {
+    InvalidateBVHData(theLayerId);
+  }
+
+  //! Updates BVH data of the layer with id theLayerId after modification of the given structure;
+  //! by default invalidates the whole BVH data.
+  virtual void InvalidateBVHStructure(const Graphic3d_CStructure* theStruct,
+                                      const Graphic3d_ZLayerId    theLayerId)
+  {
+    (void)theStruct;
+    InvalidateBVHData(theLayerId);
+  }
+
   //! Add a layer to the view.
   //! @param[in] theNewLayerId  id of new layer, should be > 0 (negative values are reserved for
   //! default layers).
@@ -476,6 +494,28 @@ public:
     NCollection_IndexedDataMap<TCollection_AsciiString, TCollection_AsciiString>& theDict)
     const = 0;
 
+public: //! @name GPU picking
+  //! Return TRUE if the view renders ID buffer of displayed primitives alongside the color pass;
+  //! FALSE by default or if not supported by graphic driver.
+  virtual bool ToRenderIdBuffer() const { return false; }
+
+  //! Enable or disable rendering of ID buffer by next redraws (ignored if not supported by graphic driver).
+  //! ID buffer allows fast approximate picking (see QueryIdBuffer()) to be refined by exact selection.
+  virtual void SetToRenderIdBuffer(const bool) {}
+
+  //! Return elements visible within the rectangle of the ID buffer rendered by last redraw.
+  //! The rectangle is defined by left and top pixels in window coordinates (Y axis directed downwards),
+  //! width and height in pixels; output samples are unique elements sorted by depth (nearest first).
+  //! @return FALSE if ID buffer is not available
+  virtual bool QueryIdBuffer(const int,
+                             const int,
+                             const int,
+                             const int,
+                             NCollection_Vector<Graphic3d_IdBufferSample>&) const
+  {
+    return false;
+  }
+
 public:
   //! Return unit scale factor defined as scale factor for m (meters); 1.0 by default.
   //! Normally, view definition is unitless, however some operations like VR input requires proper
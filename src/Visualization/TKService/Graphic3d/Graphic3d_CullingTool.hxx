@@ -242,6 +242,18 @@ public:
     return false;
   }
 
+  //! Returns the size of the screen pixel in world units at the given point
+  //! (within the plane orthogonal to the view direction).
+  double PixelWorldSize(const NCollection_Vec3<double>& thePnt) const
+  {
+    const double aPixelSize = myPixelSize * myCamScale;
+    if (myIsProjectionParallel)
+    {
+      return aPixelSize;
+    }
+    return aPixelSize * std::max((thePnt - myCamEye).Dot(myCamDir), 0.0);
+  }
+
   //! Returns TRUE if given AABB should be discarded by size culling criterion.
   bool IsTooSmall(const CullingContext&           theCtx,
                   const NCollection_Vec3<double>& theMinPnt,
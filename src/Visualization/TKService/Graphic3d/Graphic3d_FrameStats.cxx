@@ -242,6 +242,41 @@ static void addTimeInfo(
 
   addInfo(theDict, theKey, aBuffer);
 }
+
+//! Return name of GPU timer for formatting.
+static const char* gpuTimerName(Graphic3d_FrameStatsTimer theTimer)
+{
+  switch (theTimer)
+  {
+    case Graphic3d_FrameStatsTimer_GpuFrame:
+      return "GPU Frame";
+    case Graphic3d_FrameStatsTimer_GpuMainPass:
+      return "GPU Main Pass";
+    case Graphic3d_FrameStatsTimer_GpuShadowMap:
+      return "GPU Shadow Maps";
+    case Graphic3d_FrameStatsTimer_GpuOit:
+      return "GPU OIT";
+    case Graphic3d_FrameStatsTimer_GpuDepthPeeling:
+      return "GPU Depth Peeling";
+    case Graphic3d_FrameStatsTimer_GpuPostProcess:
+      return "GPU Post-process";
+    case Graphic3d_FrameStatsTimer_GpuRayTracing:
+      return "GPU Ray Tracing";
+    default:
+      break;
+  }
+  return "GPU";
+}
+
+//! Format GPU timer with name aligned to other timers.
+static std::ostream& formatGpuTime(std::ostream&             theStream,
+                                   int                       theWidth,
+                                   Graphic3d_FrameStatsTimer theTimer,
+                                   double                    theSeconds)
+{
+  theStream << std::setfill(' ') << std::setw(14) << gpuTimerName(theTimer) << ": ";
+  return formatTime(theStream, theWidth, nullptr, theSeconds, "\n");
+}
 } // namespace
 
 //=================================================================================================
@@ -521,6 +556,16 @@ TCollection_AsciiString Graphic3d_FrameStats::FormatStats(
                  aStats[Graphic3d_FrameStatsTimer_CpuDynamics],
                  "\n");
     }
+    for (int aTimerIter = Graphic3d_FrameStatsTimer_GpuLower;
+         aTimerIter <= Graphic3d_FrameStatsTimer_GpuUpper;
+         ++aTimerIter)
+    {
+      const Graphic3d_FrameStatsTimer aTimer = (Graphic3d_FrameStatsTimer)aTimerIter;
+      if (myCountersMax[aTimer] > 0.0)
+      {
+        formatGpuTime(aBuf, aValWidth, aTimer, aStats[aTimer]);
+      }
+    }
     if ((theFlags & Graphic3d_RenderingParams::PerfCounters_FrameTimeMax) != 0)
     {
       aBuf << "Timers Max\n";
@@ -553,6 +598,16 @@ TCollection_AsciiString Graphic3d_FrameStats::FormatStats(
                    myCountersMax[Graphic3d_FrameStatsTimer_CpuDynamics],
                    "\n");
       }
+      for (int aTimerIter = Graphic3d_FrameStatsTimer_GpuLower;
+           aTimerIter <= Graphic3d_FrameStatsTimer_GpuUpper;
+           ++aTimerIter)
+      {
+        const Graphic3d_FrameStatsTimer aTimer = (Graphic3d_FrameStatsTimer)aTimerIter;
+        if (myCountersMax[aTimer] > 0.0)
+        {
+          formatGpuTime(aBuf, aValWidth, aTimer, myCountersMax[aTimer]);
+        }
+      }
     }
   }
 
@@ -651,6 +706,18 @@ void Graphic3d_FrameStats::FormatStats(
     {
       addTimeInfo(theDict, "CPU Dynamics (average)", aStats[Graphic3d_FrameStatsTimer_CpuDynamics]);
     }
+    for (int aTimerIter = Graphic3d_FrameStatsTimer_GpuLower;
+         aTimerIter <= Graphic3d_FrameStatsTimer_GpuUpper;
+         ++aTimerIter)
+    {
+      const Graphic3d_FrameStatsTimer aTimer = (Graphic3d_FrameStatsTimer)aTimerIter;
+      if (myCountersMax[aTimer] > 0.0)
+      {
+        addTimeInfo(theDict,
+                    TCollection_AsciiString(gpuTimerName(aTimer)) + " (average)",
+                    aStats[aTimer]);
+      }
+    }
     if ((theFlags & Graphic3d_RenderingParams::PerfCounters_FrameTimeMax) != 0)
     {
       addTimeInfo(theDict, "CPU Frame (max)", myCountersMax[Graphic3d_FrameStatsTimer_CpuFrame]);
@@ -672,6 +739,18 @@ void Graphic3d_FrameStats::FormatStats(
                     "CPU Dynamics (max)",
                     myCountersMax[Graphic3d_FrameStatsTimer_CpuDynamics]);
       }
+      for (int aTimerIter = Graphic3d_FrameStatsTimer_GpuLower;
+           aTimerIter <= Graphic3d_FrameStatsTimer_GpuUpper;
+           ++aTimerIter)
+      {
+        const Graphic3d_FrameStatsTimer aTimer = (Graphic3d_FrameStatsTimer)aTimerIter;
+        if (myCountersMax[aTimer] > 0.0)
+        {
+          addTimeInfo(theDict,
+                      TCollection_AsciiString(gpuTimerName(aTimer)) + " (max)",
+                      myCountersMax[aTimer]);
+        }
+      }
     }
   }
 }
@@ -22,11 +22,27 @@ enum Graphic3d_FrameStatsTimer
   Graphic3d_FrameStatsTimer_CpuCulling,
   Graphic3d_FrameStatsTimer_CpuPicking,
   Graphic3d_FrameStatsTimer_CpuDynamics,
+  // clang-format off
+  Graphic3d_FrameStatsTimer_GpuFrame,        //!< GPU time of frame command buffers
+  Graphic3d_FrameStatsTimer_GpuMainPass,     //!< GPU time of main scene pass
+  Graphic3d_FrameStatsTimer_GpuShadowMap,    //!< GPU time of shadow maps rendering
+  Graphic3d_FrameStatsTimer_GpuOit,          //!< GPU time of weighted OIT compositing
+  Graphic3d_FrameStatsTimer_GpuDepthPeeling, //!< GPU time of depth peeling OIT passes
+  Graphic3d_FrameStatsTimer_GpuPostProcess,  //!< GPU time of post-processing passes
+  Graphic3d_FrameStatsTimer_GpuRayTracing,   //!< GPU time of ray-tracing dispatches
+  // clang-format on
 };
 
 enum
 {
-  Graphic3d_FrameStatsTimer_NB = Graphic3d_FrameStatsTimer_CpuDynamics + 1
+  Graphic3d_FrameStatsTimer_NB = Graphic3d_FrameStatsTimer_GpuRayTracing + 1
+};
+
+//! First and last GPU pass timers (GPU timers are filled only by graphic drivers supporting them).
+enum
+{
+  Graphic3d_FrameStatsTimer_GpuLower = Graphic3d_FrameStatsTimer_GpuFrame,
+  Graphic3d_FrameStatsTimer_GpuUpper = Graphic3d_FrameStatsTimer_GpuRayTracing
 };
 
 #endif // _Graphic3d_FrameStatsTimer_HeaderFile
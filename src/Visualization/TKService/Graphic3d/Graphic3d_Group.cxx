@@ -34,7 +34,9 @@ IMPLEMENT_STANDARD_RTTIEXT(Graphic3d_Group, Standard_Transient)
 
 Graphic3d_Group::Graphic3d_Group(const occ::handle<Graphic3d_Structure>& theStruct)
     : myStructure(theStruct.operator->()),
-      myIsClosed(false)
+      myIsClosed(false),
+      myLodLevel(-1),
+      myLodDeflection(0.0f)
 {
   //
 }
@@ -57,6 +59,8 @@ void Graphic3d_Group::Clear(bool theUpdateStructureMgr)
   }
 
   myBounds.Clear();
+  myLodLevel      = -1;
+  myLodDeflection = 0.0f;
 
   // clear method could be used on Graphic3d_Structure destruction,
   // and its structure manager could be already destroyed, in that
@@ -417,4 +421,6 @@ void Graphic3d_Group::DumpJson(Standard_OStream& theOStream, int theDepth) const
   OCCT_DUMP_FIELD_VALUES_DUMPED(theOStream, theDepth, &myBounds)
 
   OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, myIsClosed)
+  OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, myLodLevel)
+  OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, myLodDeflection)
 }
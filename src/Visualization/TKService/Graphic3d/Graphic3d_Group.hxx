@@ -187,6 +187,29 @@ public:
   //! open shells).
   bool IsClosed() const { return myIsClosed; }
 
+  //! Maximum number of levels of detail within the structure.
+  static const int MaxLevelsOfDetail = 4;
+
+  //! Return level of detail of this group within [0, MaxLevelsOfDetail), 0 being the finest one,
+  //! or -1 if the group is drawn regardless of the level chosen for the structure (default).
+  //! @sa Graphic3d_CStructure::UpdateLevelOfDetail()
+  int LevelOfDetail() const { return myLodLevel; }
+
+  //! Return maximum deviation in model units of the geometry of this group
+  //! from the finest representation; 0 by default.
+  float LodDeflection() const { return myLodDeflection; }
+
+  //! Assign the group to the level of detail of the structure.
+  //! Only groups of a single level (and groups without level) are drawn,
+  //! the coarsest level keeping projected theDeflection below the tolerance in pixels being chosen.
+  //! @param[in] theLevel  level of detail within [0, MaxLevelsOfDetail) or -1 to draw the group at any level
+  //! @param[in] theDeflection  deviation of the group geometry from the finest one in model units
+  void SetLevelOfDetail(const int theLevel, const float theDeflection)
+  {
+    myLodLevel      = theLevel >= 0 && theLevel < MaxLevelsOfDetail ? theLevel : -1;
+    myLodDeflection = theDeflection;
+  }
+
   //! @name obsolete methods
 public:
   Standard_DEPRECATED(
@@ -313,11 +336,13 @@ protected:
   Standard_EXPORT void Update() const;
 
 protected:
-  occ::handle<Graphic3d_TransformPers> myTrsfPers;  //!< current transform persistence
-  Graphic3d_Structure*                 myStructure; //!< pointer to the parent structure
-  Graphic3d_BndBox4f                   myBounds;    //!< bounding box
-  gp_Trsf                              myTrsf;      //!< group transformation
-  bool                                 myIsClosed;  //!< flag indicating closed volume
+  occ::handle<Graphic3d_TransformPers> myTrsfPers;      //!< current transform persistence
+  Graphic3d_Structure*                 myStructure;     //!< pointer to the parent structure
+  Graphic3d_BndBox4f                   myBounds;        //!< bounding box
+  gp_Trsf                              myTrsf;          //!< group transformation
+  bool                                 myIsClosed;      //!< flag indicating closed volume
+  int                                  myLodLevel;      //!< level of detail or -1
+  float                                myLodDeflection; //!< deflection of the level of detail
 };
 
 #endif // _Graphic3d_Group_HeaderFile
@@ -0,0 +1,46 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _Graphic3d_IdBufferSample_HeaderFile
+#define _Graphic3d_IdBufferSample_HeaderFile
+
+#include <Standard_TypeDef.hxx>
+
+//! Sample of ID buffer rendered by the view for GPU picking (see Graphic3d_CView::QueryIdBuffer()).
+//! Identifies the primitive of the displayed structure visible at the pixel;
+//! the result is approximate (rasterization at pixel centers) and should be refined by exact selection.
+struct Graphic3d_IdBufferSample
+{
+  int   StructureId; //!< identification of the structure (Graphic3d_CStructure::Identification())
+  int   ArrayIndex;  //!< index of primitive array within the structure (counting arrays of all groups in order)
+  int   ElementIndex; //!< index of the element (triangle, segment or point) within the primitive array
+  float Depth;       //!< window depth within [0, 1] range
+
+  //! Empty constructor.
+  Graphic3d_IdBufferSample()
+      : StructureId(-1),
+        ArrayIndex(-1),
+        ElementIndex(-1),
+        Depth(1.0f)
+  {
+  }
+
+  //! Return TRUE if sample identifies the same element.
+  bool IsSameElement(const Graphic3d_IdBufferSample& theOther) const
+  {
+    return StructureId == theOther.StructureId && ArrayIndex == theOther.ArrayIndex
+           && ElementIndex == theOther.ElementIndex;
+  }
+};
+
+#endif // _Graphic3d_IdBufferSample_HeaderFile
@@ -27,7 +27,8 @@ Graphic3d_Layer::Graphic3d_Layer(Graphic3d_ZLayerId                theId,
       myLayerId(theId),
       myBVHPrimitivesTrsfPers(theBuilder),
       myBVHIsLeftChildQueuedFirst(true),
-      myIsBVHPrimitivesNeedsReset(false)
+      myIsBVHPrimitivesNeedsReset(false),
+      myIsBVHBoxesNeedsRefit(false)
 {
   myIsBoundingBoxNeedsReset[0] = myIsBoundingBoxNeedsReset[1] = true;
 }
@@ -140,6 +141,14 @@ void Graphic3d_Layer::InvalidateBVHData()
   myIsBVHPrimitivesNeedsReset = true;
 }
 
+//=================================================================================================
+
+void Graphic3d_Layer::InvalidateBVHBoxes()
+{
+  myIsBVHBoxesNeedsRefit = true;
+  InvalidateBoundingBox();
+}
+
 //! Calculate a finite bounding box of infinite object as its middle point.
 inline Graphic3d_BndBox3d centerOfinfiniteBndBox(const Graphic3d_BndBox3d& theBndBox)
 {
@@ -471,13 +480,65 @@ double Graphic3d_Layer::considerZoomPersistenceObjects(
 
 //=================================================================================================
 
+void Graphic3d_Layer::InvalidateBVHStructure(const Graphic3d_CStructure* theStruct)
+{
+  InvalidateBoundingBox();
+  if (theStruct == nullptr || myIsBVHPrimitivesNeedsReset)
+  {
+    return;
+  }
+
+  if (!theStruct->IsAlwaysRendered() && theStruct->TransformPersistence().IsNull()
+      && myBVHPrimitives.UpdateStructure(theStruct))
+  {
+    return;
+  }
+
+  // the kind of the structure might have been changed
+  bool isInLayer = myBVHPrimitives.Remove(theStruct) || myBVHPrimitivesTrsfPers.Remove(theStruct);
+
+  const int anIndex = myAlwaysRenderedMap.FindIndex(theStruct);
+  if (anIndex != 0)
+  {
+    myAlwaysRenderedMap.Swap(myAlwaysRenderedMap.Size(), anIndex);
+    myAlwaysRenderedMap.RemoveLast();
+    isInLayer = true;
+  }
+  if (!isInLayer)
+  {
+    return;
+  }
+
+  if (theStruct->IsAlwaysRendered())
+  {
+    theStruct->MarkAsNotCulled();
+    myAlwaysRenderedMap.Add(theStruct);
+  }
+  else if (theStruct->TransformPersistence().IsNull())
+  {
+    myBVHPrimitives.Add(theStruct);
+  }
+  else
+  {
+    myBVHPrimitivesTrsfPers.Add(theStruct);
+  }
+}
+
+//=================================================================================================
+
 void Graphic3d_Layer::updateBVH() const
 {
   if (!myIsBVHPrimitivesNeedsReset)
   {
+    if (myIsBVHBoxesNeedsRefit)
+    {
+      myBVHPrimitives.Refit();
+      myIsBVHBoxesNeedsRefit = false;
+    }
     return;
   }
 
+  myIsBVHBoxesNeedsRefit = false;
   myBVHPrimitives.Clear();
   myBVHPrimitivesTrsfPers.Clear();
   myAlwaysRenderedMap.Clear();
@@ -537,6 +598,16 @@ void Graphic3d_Layer::UpdateCulling(
   myNbStructuresNotCulled = myNbStructures;
   if (theFrustumCullingState != Graphic3d_RenderingParams::FrustumCulling_NoUpdate)
   {
+    // choose levels of detail for the current view (structures with transformation persistence
+    // are not expected to define them)
+    const double aLodPixelError = myLayerSettings.LodPixelError();
+    for (NCollection_IndexedMap<const Graphic3d_CStructure*>::Iterator aStructIter(
+           myBVHPrimitives.Structures());
+         aStructIter.More();
+         aStructIter.Next())
+    {
+      aStructIter.Value()->UpdateLevelOfDetail(theSelector, aLodPixelError);
+    }
     bool toTraverse = (theFrustumCullingState == Graphic3d_RenderingParams::FrustumCulling_On);
     for (NCollection_IndexedMap<const Graphic3d_CStructure*>::Iterator aStructIter(
            myBVHPrimitives.Structures());
@@ -774,6 +845,7 @@ void Graphic3d_Layer::DumpJson(Standard_OStream& theOStream, int theDepth) const
 
   OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, myBVHIsLeftChildQueuedFirst)
   OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, myIsBVHPrimitivesNeedsReset)
+  OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, myIsBVHBoxesNeedsRefit)
   OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, myIsBoundingBoxNeedsReset[0])
   OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, myIsBoundingBoxNeedsReset[1])
 
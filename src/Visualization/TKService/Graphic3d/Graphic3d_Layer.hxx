@@ -107,6 +107,15 @@ public:
   //! marks primitive set for rebuild.
   Standard_EXPORT void InvalidateBVHData();
 
+  //! Marks bounding boxes of BVH tree nodes as outdated after structures have been moved,
+  //! so that the tree is refitted instead of rebuilding the primitive set.
+  Standard_EXPORT void InvalidateBVHBoxes();
+
+  //! Updates BVH data after modification of the given structure (its bounding box,
+  //! transformation persistence or always rendered state) without rebuilding the whole
+  //! primitive set; does nothing if the structure is not in the layer.
+  Standard_EXPORT void InvalidateBVHStructure(const Graphic3d_CStructure* theStruct);
+
   //! Marks cached bounding box as obsolete.
   void InvalidateBoundingBox() const
   {
@@ -201,6 +210,9 @@ private:
   //! Defines if the primitive set for BVH is outdated.
   mutable bool myIsBVHPrimitivesNeedsReset;
 
+  //! Defines if the boxes of BVH tree nodes are outdated.
+  mutable bool myIsBVHBoxesNeedsRefit;
+
   //! Defines if the cached bounding box is outdated.
   mutable bool myIsBoundingBoxNeedsReset[2];
 
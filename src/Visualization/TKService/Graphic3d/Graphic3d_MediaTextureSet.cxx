@@ -46,6 +46,7 @@ Graphic3d_MediaTextureSet::Graphic3d_MediaTextureSet()
       myDuration(0.0),
       myFront(0),
       myToPresentFrame(false),
+      myToUseHwDecoding(false),
       myIsPlanarYUV(false),
       myIsFullRangeYUV(true)
 {
@@ -146,6 +147,7 @@ void Graphic3d_MediaTextureSet::OpenInput(const TCollection_AsciiString& thePath
   myProgress = 0.0;
   myDuration = 0.0;
 
+  myPlayerCtx->SetHardwareDecoding(myToUseHwDecoding);
   myPlayerCtx->SetInput(thePath, theToWait);
   myInput = thePath;
 }
@@ -50,6 +50,15 @@ public:
   //! Passing an empty path would close current input.
   Standard_EXPORT void OpenInput(const TCollection_AsciiString& thePath, bool theToWait);
 
+  //! Return TRUE if hardware-accelerated decoding is requested for opened inputs; FALSE by default.
+  bool ToUseHardwareDecoding() const { return myToUseHwDecoding; }
+
+  //! Set if hardware-accelerated decoding should be requested for inputs opened by OpenInput().
+  //! Hardware frames are not handled by Graphic3d_MediaTexture::GetImage(),
+  //! so that this option is intended for renderers wrapping native surfaces
+  //! (see Media_PlayerContext::SetHardwareDecoding()).
+  void SetHardwareDecoding(bool theToUse) { myToUseHwDecoding = theToUse; }
+
   //! Return player context; it can be NULL until first OpenInput().
   const occ::handle<Media_PlayerContext>& PlayerContext() const { return myPlayerCtx; }
 
@@ -103,6 +112,7 @@ protected:
   double                               myDuration;         //!< stream duration
   int                                  myFront;            //!< index of front texture
   bool                                 myToPresentFrame;   //!< flag
+  bool                                 myToUseHwDecoding;  //!< request hardware decoding
   // clang-format off
   bool                myIsPlanarYUV;       //!< front frame contains planar YUV data or native texture format
   bool                myIsFullRangeYUV;    //!< front frame defines full-range or reduced-range YUV
@@ -36,6 +36,7 @@ void Graphic3d_RenderingParams::DumpJson(Standard_OStream& theOStream, int theDe
   OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, OitDepthFactor)
   OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, NbMsaaSamples)
   OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, RenderResolutionScale)
+  OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, UpscalingMethod)
 
   OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, ToEnableDepthPrepass)
   OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, ToEnableAlphaToCoverage)
@@ -59,6 +60,7 @@ void Graphic3d_RenderingParams::DumpJson(Standard_OStream& theOStream, int theDe
   OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, RebuildRayTracingShaders)
   OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, RayTracingTileSize)
   OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, NbRayTracingTiles)
+  OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, ToDenoise)
 
   OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, CameraApertureRadius)
   OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, CameraFocalPlaneDist)
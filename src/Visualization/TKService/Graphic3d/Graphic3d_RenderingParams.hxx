@@ -25,6 +25,8 @@
 #include <Graphic3d_StereoMode.hxx>
 #include <Graphic3d_ToneMappingMethod.hxx>
 #include <Graphic3d_TypeOfShadingModel.hxx>
+#include <Graphic3d_UpscalingMethod.hxx>
+#include <Graphic3d_UpscalingQuality.hxx>
 #include <NCollection_Vec4.hxx>
 #include <Standard_TypeDef.hxx>
 
@@ -119,6 +121,7 @@ public:
         NbOitDepthPeelingLayers(4),
         NbMsaaSamples(0),
         RenderResolutionScale(1.0f),
+        UpscalingMethod(Graphic3d_UpscalingMethod_Bilinear),
         ShadowMapResolution(1024),
         ShadowMapBias(0.005f),
         ToEnableDepthPrepass(false),
@@ -142,6 +145,7 @@ public:
         RebuildRayTracingShaders(false),
         RayTracingTileSize(32),
         NbRayTracingTiles(16 * 16),
+        ToDenoise(false),
         CameraApertureRadius(0.0f),
         CameraFocalPlaneDist(1.0f),
         FrustumCullingState(FrustumCulling_On),
@@ -192,6 +196,19 @@ public:
   //! Returns resolution ratio.
   float ResolutionRatio() const { return Resolution / static_cast<float>(THE_DEFAULT_RESOLUTION); }
 
+  //! Set RenderResolutionScale from upscaling quality preset.
+  void SetUpscalingQuality(Graphic3d_UpscalingQuality theQuality)
+  {
+    switch (theQuality)
+    {
+      case Graphic3d_UpscalingQuality_Native:           RenderResolutionScale = 1.0f;  return;
+      case Graphic3d_UpscalingQuality_Quality:          RenderResolutionScale = 0.67f; return;
+      case Graphic3d_UpscalingQuality_Balanced:         RenderResolutionScale = 0.58f; return;
+      case Graphic3d_UpscalingQuality_Performance:      RenderResolutionScale = 0.5f;  return;
+      case Graphic3d_UpscalingQuality_UltraPerformance: RenderResolutionScale = 0.33f; return;
+    }
+  }
+
   //! Dumps the content of me into the stream
   Standard_EXPORT void DumpJson(Standard_OStream& theOStream, int theDepth = -1) const;
 
@@ -226,6 +243,8 @@ public: //! @name rendering resolution parameters
   int                  NbMsaaSamples;               //!< number of MSAA samples (should be within 0..GL_MAX_SAMPLES, power-of-two number), 0 by default
   float                RenderResolutionScale;       //!< rendering resolution scale factor, 1 by default;
                                                                  //!  incompatible with MSAA (e.g. NbMsaaSamples should be set to 0)
+  Graphic3d_UpscalingMethod         UpscalingMethod;             //!< method upscaling image rendered with RenderResolutionScale < 1 to the view size,
+                                                                 //!  Graphic3d_UpscalingMethod_Bilinear by default
   int                  ShadowMapResolution;         //!< shadow texture map resolution, 1024 by default
   float                ShadowMapBias;               //!< shadowmap bias, 0.005 by default;
   bool                  ToEnableDepthPrepass;        //!< enables/disables depth pre-pass, False by default
@@ -253,6 +272,7 @@ public: //! @name Ray-Tracing/Path-Tracing parameters
   int                  NbRayTracingTiles;           //!< maximum number of screen tiles per frame, 256 by default (adaptive sampling mode of path tracing);
                                                                  //!  this parameter limits the number of tiles to be rendered per redraw, increasing Viewer interactivity,
                                                                  //!  but also increasing the time for achieving a good quality; -1 means no limit
+  bool                  ToDenoise;                   //!< enables/disables real-time denoising of progressive path tracing result, FALSE by default
   float                CameraApertureRadius;        //!< aperture radius of perspective camera used for depth-of-field, 0.0 by default (no DOF) (path tracing only)
   float                CameraFocalPlaneDist;        //!< focal  distance of perspective camera used for depth-of field, 1.0 by default (path tracing only)
   FrustumCulling                    FrustumCullingState;         //!< state of frustum culling optimization; FrustumCulling_On by default
@@ -710,7 +710,28 @@ Graphic3d_BndBox4f Graphic3d_Structure::minMaxCoord() const
       continue; // should be translated to current view orientation to make sense
     }
 
-    aBnd.Combine(aGroupIter.Value()->BoundingBox());
+    const Graphic3d_BndBox4f& aGroupBox = aGroupIter.Value()->BoundingBox();
+    const gp_Trsf&            aTrsf     = aGroupIter.Value()->Transformation();
+    if (aTrsf.Form() == gp_Identity || !aGroupBox.IsValid())
+    {
+      aBnd.Combine(aGroupBox);
+      continue;
+    }
+
+    // group geometry is defined in local coordinate system - transform box corners
+    const NCollection_Vec4<float>& aMin = aGroupBox.CornerMin();
+    const NCollection_Vec4<float>& aMax = aGroupBox.CornerMax();
+    for (int aCornerIter = 0; aCornerIter < 8; ++aCornerIter)
+    {
+      gp_Pnt aCorner((aCornerIter & 1) != 0 ? aMax.x() : aMin.x(),
+                     (aCornerIter & 2) != 0 ? aMax.y() : aMin.y(),
+                     (aCornerIter & 4) != 0 ? aMax.z() : aMin.z());
+      aCorner.Transform(aTrsf);
+      aBnd.Add(NCollection_Vec4<float>(float(aCorner.X()),
+                                       float(aCorner.Y()),
+                                       float(aCorner.Z()),
+                                       (aCornerIter & 1) != 0 ? aMax.w() : aMin.w()));
+    }
   }
   return aBnd;
 }
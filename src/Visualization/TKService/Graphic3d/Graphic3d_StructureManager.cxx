@@ -23,6 +23,7 @@ IMPLEMENT_STANDARD_RTTIEXT(Graphic3d_StructureManager, Standard_Transient)
 
 #include <Graphic3d_MapOfStructure.hxx>
 #include <Graphic3d_CView.hxx>
+#include <OSD_Thread.hxx>
 
 //=================================================================================================
 
@@ -30,7 +31,9 @@ Graphic3d_StructureManager::Graphic3d_StructureManager(
   const occ::handle<Graphic3d_GraphicDriver>& theDriver)
     : myViewGenId(0, 31),
       myGraphicDriver(theDriver),
-      myDeviceLostFlag(false)
+      myDeviceLostFlag(false),
+      myIsDeferredUpdate(false),
+      myOwnerThread(OSD_Thread::Current())
 {
   //
 }
@@ -55,6 +58,11 @@ Graphic3d_StructureManager::~Graphic3d_StructureManager()
 
 void Graphic3d_StructureManager::Update(const Graphic3d_ZLayerId theLayerId) const
 {
+  if (myIsDeferredUpdate || OSD_Thread::Current() != myOwnerThread)
+  {
+    return;
+  }
+
   for (NCollection_IndexedMap<Graphic3d_CView*>::Iterator aViewIt(myDefinedViews); aViewIt.More();
        aViewIt.Next())
   {
@@ -64,6 +72,22 @@ void Graphic3d_StructureManager::Update(const Graphic3d_ZLayerId theLayerId) con
 
 //=================================================================================================
 
+void Graphic3d_StructureManager::SetDeferredUpdate(const bool theToDefer)
+{
+  if (myIsDeferredUpdate == theToDefer)
+  {
+    return;
+  }
+
+  myIsDeferredUpdate = theToDefer;
+  if (!theToDefer)
+  {
+    Update();
+  }
+}
+
+//=================================================================================================
+
 void Graphic3d_StructureManager::Remove()
 {
   // clear all structures whilst views are alive for correct GPU memory management
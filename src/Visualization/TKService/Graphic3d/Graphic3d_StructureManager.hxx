@@ -23,6 +23,7 @@
 #include <NCollection_DataMap.hxx>
 #include <Graphic3d_MapOfStructure.hxx>
 #include <Graphic3d_ZLayerId.hxx>
+#include <Standard_ThreadId.hxx>
 #include <Graphic3d_ZLayerSettings.hxx>
 #include <Standard_Transient.hxx>
 #include <NCollection_IndexedMap.hxx>
@@ -59,6 +60,8 @@ public:
   Standard_EXPORT ~Graphic3d_StructureManager() override;
 
   //! Invalidates bounding box of specified ZLayerId.
+  //! Does nothing while deferred (see SetDeferredUpdate()) or when called not by the thread
+  //! created the manager (e.g. by a thread computing presentations in background).
   Standard_EXPORT virtual void Update(
     const Graphic3d_ZLayerId theLayerId = Graphic3d_ZLayerId_UNKNOWN) const;
 
@@ -174,6 +177,13 @@ public:
   //! Sets Device Lost flag.
   void SetDeviceLost() { myDeviceLostFlag = true; }
 
+  //! Returns TRUE if invalidation of view layers by Update() is deferred.
+  bool IsDeferredUpdate() const { return myIsDeferredUpdate; }
+
+  //! Defers invalidation of view layers by Update(), so that presentations might be computed
+  //! by worker threads; all layers are invalidated at once when the flag is reset.
+  Standard_EXPORT void SetDeferredUpdate(const bool theToDefer);
+
   //! Dumps the content of me into the stream
   Standard_EXPORT void DumpJson(Standard_OStream& theOStream, int theDepth = -1) const;
 
@@ -192,6 +202,8 @@ protected:
   occ::handle<Graphic3d_GraphicDriver>     myGraphicDriver;
   NCollection_IndexedMap<Graphic3d_CView*> myDefinedViews;
   bool                                     myDeviceLostFlag;
+  bool                                     myIsDeferredUpdate;
+  Standard_ThreadId                        myOwnerThread;
 };
 
 #endif // _Graphic3d_StructureManager_HeaderFile
@@ -0,0 +1,25 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+#ifndef _Graphic3d_UpscalingMethod_HeaderFile
+#define _Graphic3d_UpscalingMethod_HeaderFile
+
+//! Enumerates methods upscaling the image rendered at reduced resolution
+//! (see Graphic3d_RenderingParams::RenderResolutionScale) to the view size.
+enum Graphic3d_UpscalingMethod
+{
+  Graphic3d_UpscalingMethod_Bilinear, //!< plain bilinear filtering
+  Graphic3d_UpscalingMethod_Spatial,  //!< spatial upscaling (edge-adaptive reconstruction of a single frame)
+  Graphic3d_UpscalingMethod_Temporal  //!< temporal upscaling (accumulation of jittered frames using depth and motion)
+};
+
+#endif // _Graphic3d_UpscalingMethod_HeaderFile
@@ -0,0 +1,27 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+#ifndef _Graphic3d_UpscalingQuality_HeaderFile
+#define _Graphic3d_UpscalingQuality_HeaderFile
+
+//! Enumerates presets of rendering resolution scale used with upscaling
+//! (see Graphic3d_RenderingParams::SetUpscalingQuality()).
+enum Graphic3d_UpscalingQuality
+{
+  Graphic3d_UpscalingQuality_Native,          //!< render at full resolution (scale 1.0)
+  Graphic3d_UpscalingQuality_Quality,         //!< render at 2/3 of resolution (scale 0.67)
+  Graphic3d_UpscalingQuality_Balanced,        //!< render at 0.58 of resolution
+  Graphic3d_UpscalingQuality_Performance,     //!< render at half resolution (scale 0.5)
+  Graphic3d_UpscalingQuality_UltraPerformance //!< render at 1/3 of resolution (scale 0.33)
+};
+
+#endif // _Graphic3d_UpscalingQuality_HeaderFile
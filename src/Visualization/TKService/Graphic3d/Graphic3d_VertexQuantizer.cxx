@@ -0,0 +1,336 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <Graphic3d_VertexQuantizer.hxx>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace
+{
+//! Convert value within [-1, 1] range into normalized signed 16-bit integer.
+static int16_t toSnorm16(const float theValue)
+{
+  return int16_t(std::lround(std::max(-1.0f, std::min(1.0f, theValue)) * 32767.0f));
+}
+
+//! Convert normalized signed 16-bit integer into value within [-1, 1] range.
+static float fromSnorm16(const int16_t theValue)
+{
+  return std::max(float(theValue) / 32767.0f, -1.0f);
+}
+
+//! Return sign of the value considering zero as positive.
+static float signNotZero(const float theValue)
+{
+  return theValue >= 0.0f ? 1.0f : -1.0f;
+}
+
+//! Return pointer to the first value of specified attribute and stride between its values.
+static const uint8_t* attributeData(const Graphic3d_Buffer& theAttribs,
+                                    const int               theAttribIndex,
+                                    size_t&                 theStride)
+{
+  if (theAttribs.IsInterleaved())
+  {
+    theStride = size_t(theAttribs.Stride);
+    return theAttribs.Data() + theAttribs.AttributeOffset(theAttribIndex);
+  }
+  theStride = size_t(theAttribs.Attribute(theAttribIndex).Stride());
+  return theAttribs.Data()
+         + size_t(theAttribs.AttributeOffset(theAttribIndex)) * size_t(theAttribs.NbMaxElements());
+}
+} // namespace
+
+//=================================================================================================
+
+NCollection_Vec2<int16_t> Graphic3d_VertexQuantizer::EncodeOctahedral(
+  const NCollection_Vec3<float>& theNorm)
+{
+  const float aSum = std::abs(theNorm.x()) + std::abs(theNorm.y()) + std::abs(theNorm.z());
+  if (aSum <= 0.0f)
+  {
+    return NCollection_Vec2<int16_t>(0, 0);
+  }
+
+  // project onto octahedron and fold the lower hemisphere over diagonals
+  float aX = theNorm.x() / aSum;
+  float aY = theNorm.y() / aSum;
+  if (theNorm.z() < 0.0f)
+  {
+    const float aX0 = aX;
+    aX              = (1.0f - std::abs(aY)) * signNotZero(aX0);
+    aY              = (1.0f - std::abs(aX0)) * signNotZero(aY);
+  }
+  return NCollection_Vec2<int16_t>(toSnorm16(aX), toSnorm16(aY));
+}
+
+//=================================================================================================
+
+NCollection_Vec3<float> Graphic3d_VertexQuantizer::DecodeOctahedral(
+  const NCollection_Vec2<int16_t>& theOct)
+{
+  NCollection_Vec3<float> aNorm(fromSnorm16(theOct.x()), fromSnorm16(theOct.y()), 0.0f);
+  aNorm.z()         = 1.0f - std::abs(aNorm.x()) - std::abs(aNorm.y());
+  const float aFold = std::max(-aNorm.z(), 0.0f);
+  aNorm.x() += aNorm.x() >= 0.0f ? -aFold : aFold;
+  aNorm.y() += aNorm.y() >= 0.0f ? -aFold : aFold;
+  return aNorm.Normalized();
+}
+
+//=================================================================================================
+
+uint16_t Graphic3d_VertexQuantizer::FloatToHalf(float theValue)
+{
+  uint32_t aBits = 0;
+  memcpy(&aBits, &theValue, sizeof(aBits));
+  const uint32_t aSign = (aBits >> 16) & 0x8000u;
+  const uint32_t anAbs = aBits & 0x7FFFFFFFu;
+  if (anAbs >= 0x7F800000u)
+  {
+    // infinity or NaN
+    return uint16_t(aSign | 0x7C00u | (anAbs > 0x7F800000u ? 0x0200u : 0u));
+  }
+  if (anAbs >= 0x477FF000u)
+  {
+    // rounds to infinity (above 65504)
+    return uint16_t(aSign | 0x7C00u);
+  }
+  if (anAbs < 0x38800000u)
+  {
+    // subnormal half float or zero
+    if (anAbs < 0x33000000u)
+    {
+      return uint16_t(aSign);
+    }
+    const uint32_t aMant  = (anAbs & 0x007FFFFFu) | 0x00800000u;
+    const int      aShift = 126 - int(anAbs >> 23);
+    const uint32_t aRes   = aMant >> aShift;
+    const uint32_t aRem   = aMant & ((1u << aShift) - 1u);
+    const uint32_t aMid   = 1u << (aShift - 1);
+    const bool     toRoundUp = aRem > aMid || (aRem == aMid && (aRes & 1u) != 0);
+    return uint16_t(aSign | (aRes + (toRoundUp ? 1u : 0u)));
+  }
+
+  // normalized value - re-bias exponent and round mantissa (carry may increment exponent)
+  uint32_t       aRes = (anAbs - 0x38000000u) >> 13;
+  const uint32_t aRem = anAbs & 0x1FFFu;
+  if (aRem > 0x1000u || (aRem == 0x1000u && (aRes & 1u) != 0))
+  {
+    ++aRes;
+  }
+  return uint16_t(aSign | aRes);
+}
+
+//=================================================================================================
+
+float Graphic3d_VertexQuantizer::HalfToFloat(uint16_t theValue)
+{
+  const uint32_t aSign = uint32_t(theValue & 0x8000u) << 16;
+  const uint32_t anExp = (theValue >> 10) & 0x1Fu;
+  const uint32_t aMant = theValue & 0x03FFu;
+  if (anExp == 0)
+  {
+    // zero or subnormal value (mantissa * 2^-24)
+    const float aValue = float(aMant) * 5.9604644775390625e-8f;
+    return aSign != 0 ? -aValue : aValue;
+  }
+
+  const uint32_t aBits = anExp == 0x1Fu ? (aSign | 0x7F800000u | (aMant << 13))
+                                        : (aSign | ((anExp + 112u) << 23) | (aMant << 13));
+  float aValue = 0.0f;
+  memcpy(&aValue, &aBits, sizeof(aValue));
+  return aValue;
+}
+
+//=================================================================================================
+
+Graphic3d_VertexQuantizer::Graphic3d_VertexQuantizer()
+    : myPosOffset(0.0f),
+      myPosRange(1.0f),
+      myToQuantizePositions(true),
+      myToEncodeNormals(true),
+      myToConvertTexCoords(true),
+      myHasQuantizedPositions(false)
+{
+  //
+}
+
+//=================================================================================================
+
+occ::handle<Graphic3d_Buffer> Graphic3d_VertexQuantizer::Perform(
+  const Graphic3d_Buffer&                       theAttribs,
+  const occ::handle<NCollection_BaseAllocator>& theAlloc)
+{
+  myPosOffset             = NCollection_Vec3<float>(0.0f);
+  myPosRange              = 1.0f;
+  myHasQuantizedPositions = false;
+  if (theAttribs.IsEmpty() || theAttribs.NbElements < 1 || theAttribs.NbAttributes < 1)
+  {
+    return occ::handle<Graphic3d_Buffer>();
+  }
+
+  // define compressed layout
+  const int                                aNbAttribs = theAttribs.NbAttributes;
+  NCollection_Array1<Graphic3d_Attribute> aDstAttribs(0, aNbAttribs - 1);
+  bool                                     hasCompressed = false;
+  for (int anAttribIter = 0; anAttribIter < aNbAttribs; ++anAttribIter)
+  {
+    const Graphic3d_Attribute& aSrcAttrib = theAttribs.Attribute(anAttribIter);
+    Graphic3d_Attribute&       aDstAttrib = aDstAttribs.ChangeValue(anAttribIter);
+    aDstAttrib                            = aSrcAttrib;
+    if (aSrcAttrib.Id == Graphic3d_TOA_POS && aSrcAttrib.DataType == Graphic3d_TOD_VEC3
+        && myToQuantizePositions && !myHasQuantizedPositions)
+    {
+      aDstAttrib.DataType     = Graphic3d_TOD_VEC4US;
+      myHasQuantizedPositions = true;
+    }
+    else if (aSrcAttrib.Id == Graphic3d_TOA_NORM && aSrcAttrib.DataType == Graphic3d_TOD_VEC3
+             && myToEncodeNormals)
+    {
+      aDstAttrib.DataType = Graphic3d_TOD_VEC2S;
+    }
+    else if (aSrcAttrib.Id == Graphic3d_TOA_UV && aSrcAttrib.DataType == Graphic3d_TOD_VEC2
+             && myToConvertTexCoords)
+    {
+      aDstAttrib.DataType = Graphic3d_TOD_VEC2HF;
+    }
+    hasCompressed = hasCompressed || aDstAttrib.DataType != aSrcAttrib.DataType;
+  }
+  if (!hasCompressed)
+  {
+    return occ::handle<Graphic3d_Buffer>();
+  }
+
+  const int                     aNbVerts = theAttribs.NbElements;
+  occ::handle<Graphic3d_Buffer> aResult  = new Graphic3d_Buffer(
+    !theAlloc.IsNull() ? theAlloc : NCollection_BaseAllocator::CommonBaseAllocator());
+  if (!aResult->Init(aNbVerts, aDstAttribs))
+  {
+    myHasQuantizedPositions = false;
+    return occ::handle<Graphic3d_Buffer>();
+  }
+
+  for (int anAttribIter = 0; anAttribIter < aNbAttribs; ++anAttribIter)
+  {
+    const Graphic3d_Attribute& aSrcAttrib = theAttribs.Attribute(anAttribIter);
+    const Graphic3d_Attribute& aDstAttrib = aDstAttribs.Value(anAttribIter);
+    size_t                     aSrcStride = 0;
+    const uint8_t*             aSrcData   = attributeData(theAttribs, anAttribIter, aSrcStride);
+    const size_t               aDstStride = size_t(aResult->Stride);
+    uint8_t*                   aDstData   = aResult->ChangeData(anAttribIter);
+    switch (aDstAttrib.DataType)
+    {
+      case Graphic3d_TOD_VEC4US: {
+        // quantization range is a cube around bounding box
+        NCollection_Vec3<float> aMin(std::numeric_limits<float>::max()),
+          aMax(-std::numeric_limits<float>::max());
+        for (int aVertIter = 0; aVertIter < aNbVerts; ++aVertIter)
+        {
+          const NCollection_Vec3<float>& aPnt =
+            *reinterpret_cast<const NCollection_Vec3<float>*>(aSrcData + aSrcStride * aVertIter);
+          aMin = aMin.cwiseMin(aPnt);
+          aMax = aMax.cwiseMax(aPnt);
+        }
+        myPosOffset = aMin;
+        myPosRange  = (aMax - aMin).maxComp();
+        if (!(myPosRange > 0.0f))
+        {
+          myPosRange = 1.0f;
+        }
+
+        for (int aVertIter = 0; aVertIter < aNbVerts; ++aVertIter)
+        {
+          const NCollection_Vec3<float>& aPnt =
+            *reinterpret_cast<const NCollection_Vec3<float>*>(aSrcData + aSrcStride * aVertIter);
+          *reinterpret_cast<NCollection_Vec4<uint16_t>*>(aDstData + aDstStride * aVertIter) =
+            QuantizePosition(aPnt);
+        }
+        break;
+      }
+      case Graphic3d_TOD_VEC2S: {
+        for (int aVertIter = 0; aVertIter < aNbVerts; ++aVertIter)
+        {
+          const NCollection_Vec3<float>& aNorm =
+            *reinterpret_cast<const NCollection_Vec3<float>*>(aSrcData + aSrcStride * aVertIter);
+          *reinterpret_cast<NCollection_Vec2<int16_t>*>(aDstData + aDstStride * aVertIter) =
+            EncodeOctahedral(aNorm);
+        }
+        break;
+      }
+      case Graphic3d_TOD_VEC2HF: {
+        for (int aVertIter = 0; aVertIter < aNbVerts; ++aVertIter)
+        {
+          const NCollection_Vec2<float>& aUV =
+            *reinterpret_cast<const NCollection_Vec2<float>*>(aSrcData + aSrcStride * aVertIter);
+          *reinterpret_cast<NCollection_Vec2<uint16_t>*>(aDstData + aDstStride * aVertIter) =
+            NCollection_Vec2<uint16_t>(FloatToHalf(aUV.x()), FloatToHalf(aUV.y()));
+        }
+        break;
+      }
+      default: {
+        const size_t aSize = size_t(aSrcAttrib.Stride());
+        for (int aVertIter = 0; aVertIter < aNbVerts; ++aVertIter)
+        {
+          memcpy(aDstData + aDstStride * aVertIter, aSrcData + aSrcStride * aVertIter, aSize);
+        }
+        break;
+      }
+    }
+  }
+  return aResult;
+}
+
+//=================================================================================================
+
+NCollection_Mat4<float> Graphic3d_VertexQuantizer::DequantizationMatrix() const
+{
+  NCollection_Mat4<float> aMat;
+  if (!myHasQuantizedPositions)
+  {
+    return aMat;
+  }
+
+  aMat.SetValue(0, 0, myPosRange);
+  aMat.SetValue(1, 1, myPosRange);
+  aMat.SetValue(2, 2, myPosRange);
+  aMat.SetColumn(3, myPosOffset);
+  return aMat;
+}
+
+//=================================================================================================
+
+NCollection_Vec4<uint16_t> Graphic3d_VertexQuantizer::QuantizePosition(
+  const NCollection_Vec3<float>& thePnt) const
+{
+  const NCollection_Vec3<float> aNorm = (thePnt - myPosOffset) / myPosRange;
+  NCollection_Vec4<uint16_t>    aRes(65535);
+  for (int aCompIter = 0; aCompIter < 3; ++aCompIter)
+  {
+    const float aValue = std::max(0.0f, std::min(1.0f, aNorm[aCompIter]));
+    aRes[aCompIter]    = uint16_t(std::lround(aValue * 65535.0f));
+  }
+  return aRes;
+}
+
+//=================================================================================================
+
+NCollection_Vec3<float> Graphic3d_VertexQuantizer::DequantizePosition(
+  const NCollection_Vec4<uint16_t>& theValue) const
+{
+  return myPosOffset
+         + NCollection_Vec3<float>(float(theValue.x()), float(theValue.y()), float(theValue.z()))
+             * (myPosRange / 65535.0f);
+}
@@ -0,0 +1,112 @@
+// Copyright (c) 2025 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _Graphic3d_VertexQuantizer_HeaderFile
+#define _Graphic3d_VertexQuantizer_HeaderFile
+
+#include <Graphic3d_Buffer.hxx>
+
+//! Tool compressing vertex attributes of Graphic3d_Buffer into a compact layout for GPU memory:
+//! - positions are quantized into 16-bit normalized integers relative to the bounding box
+//!   of the array (Graphic3d_TOD_VEC4US with W component equal to 1), restored by
+//!   DequantizationMatrix(); the box is extended to a cube, so that dequantization is
+//!   a uniform scale not distorting normals;
+//! - nodal normals are packed as octahedral vectors into 2 normalized 16-bit integers
+//!   (Graphic3d_TOD_VEC2S);
+//! - texture coordinates are converted into half floats (Graphic3d_TOD_VEC2HF).
+//!
+//! Positions and normals take 12 bytes per vertex instead of 24,
+//! and texture coordinates 4 bytes instead of 8. The result is an interleaved copy intended
+//! for uploading into graphic driver buffers, while the source float data is kept for consumers
+//! on CPU side (selection, bounding boxes, ray-tracing).
+//! Attributes of other types are copied as is.
+class Graphic3d_VertexQuantizer
+{
+public:
+  //! Pack unit vector as octahedral vector of 2 normalized 16-bit integers.
+  Standard_EXPORT static NCollection_Vec2<int16_t> EncodeOctahedral(
+    const NCollection_Vec3<float>& theNorm);
+
+  //! Unpack unit vector from octahedral vector of 2 normalized 16-bit integers.
+  Standard_EXPORT static NCollection_Vec3<float> DecodeOctahedral(
+    const NCollection_Vec2<int16_t>& theOct);
+
+  //! Convert float value into half float (rounding to nearest even).
+  Standard_EXPORT static uint16_t FloatToHalf(float theValue);
+
+  //! Convert half float value into float.
+  Standard_EXPORT static float HalfToFloat(uint16_t theValue);
+
+public:
+  //! Empty constructor compressing all supported attributes.
+  Standard_EXPORT Graphic3d_VertexQuantizer();
+
+  //! Return TRUE if VEC3 positions should be quantized; TRUE by default.
+  bool ToQuantizePositions() const { return myToQuantizePositions; }
+
+  //! Set if VEC3 positions should be quantized.
+  void SetQuantizePositions(bool theToQuantize) { myToQuantizePositions = theToQuantize; }
+
+  //! Return TRUE if VEC3 normals should be packed as octahedral vectors; TRUE by default.
+  bool ToEncodeNormals() const { return myToEncodeNormals; }
+
+  //! Set if VEC3 normals should be packed as octahedral vectors.
+  void SetEncodeNormals(bool theToEncode) { myToEncodeNormals = theToEncode; }
+
+  //! Return TRUE if VEC2 texture coordinates should be converted into half floats; TRUE by default.
+  bool ToConvertTexCoords() const { return myToConvertTexCoords; }
+
+  //! Set if VEC2 texture coordinates should be converted into half floats.
+  void SetConvertTexCoords(bool theToConvert) { myToConvertTexCoords = theToConvert; }
+
+  //! Compress attributes of the buffer.
+  //! @param[in] theAttribs source attributes (interleaved or not)
+  //! @param[in] theAlloc   memory allocator for the result, common allocator when NULL
+  //! @return new interleaved buffer with the same attributes order,
+  //!         or NULL if the buffer has no attributes to compress
+  Standard_EXPORT occ::handle<Graphic3d_Buffer> Perform(
+    const Graphic3d_Buffer&                       theAttribs,
+    const occ::handle<NCollection_BaseAllocator>& theAlloc = nullptr);
+
+  //! Return TRUE if positions have been quantized by the last Perform().
+  bool HasQuantizedPositions() const { return myHasQuantizedPositions; }
+
+  //! Return minimal corner of the quantization range of positions.
+  const NCollection_Vec3<float>& PositionOffset() const { return myPosOffset; }
+
+  //! Return size of the quantization range of positions;
+  //! position is restored as PositionOffset() + PositionRange() * NormalizedValue.
+  float PositionRange() const { return myPosRange; }
+
+  //! Return matrix transforming normalized quantized positions into original coordinates,
+  //! to be combined with the model matrix; identity if positions have not been quantized.
+  Standard_EXPORT NCollection_Mat4<float> DequantizationMatrix() const;
+
+  //! Quantize position within range defined by the last Perform().
+  Standard_EXPORT NCollection_Vec4<uint16_t> QuantizePosition(
+    const NCollection_Vec3<float>& thePnt) const;
+
+  //! Restore position quantized by QuantizePosition().
+  Standard_EXPORT NCollection_Vec3<float> DequantizePosition(
+    const NCollection_Vec4<uint16_t>& theValue) const;
+
+private:
+  NCollection_Vec3<float> myPosOffset;             //!< minimal corner of positions range
+  float                   myPosRange;              //!< size of positions range
+  bool                    myToQuantizePositions;   //!< flag to quantize positions
+  bool                    myToEncodeNormals;       //!< flag to pack normals as octahedral vectors
+  bool                    myToConvertTexCoords;    //!< flag to convert texture coordinates
+  bool                    myHasQuantizedPositions; //!< flag of quantized positions in last result
+};
+
+#endif // _Graphic3d_VertexQuantizer_HeaderFile
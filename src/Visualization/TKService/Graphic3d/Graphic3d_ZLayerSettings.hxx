@@ -30,6 +30,7 @@ struct Graphic3d_ZLayerSettings
   Graphic3d_ZLayerSettings()
       : myCullingDistance(Precision::Infinite()),
         myCullingSize(Precision::Infinite()),
+        myLodPixelError(1.0),
         myIsImmediate(false),
         myToRaytrace(true),
         myUseEnvironmentTexture(true),
@@ -106,6 +107,15 @@ struct Graphic3d_ZLayerSettings
   //! Set the distance to discard drawing objects.
   void SetCullingSize(double theSize) { myCullingSize = theSize; }
 
+  //! Return the tolerance in pixels for choosing levels of detail of structures within the layer
+  //! (see Graphic3d_Group::SetLevelOfDetail()): the coarsest level, which deflection projected onto
+  //! the screen does not exceed this value, is drawn; 1 pixel by default.
+  //! Non-positive value disables levels of detail so that the finest one is always drawn.
+  double LodPixelError() const { return myLodPixelError; }
+
+  //! Set the tolerance in pixels for choosing levels of detail.
+  void SetLodPixelError(double theError) { myLodPixelError = theError; }
+
   //! Return true if this layer should be drawn after all normal (non-immediate) layers.
   bool IsImmediate() const { return myIsImmediate; }
 
@@ -186,6 +196,7 @@ struct Graphic3d_ZLayerSettings
 
     OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, myCullingDistance)
     OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, myCullingSize)
+    OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, myLodPixelError)
 
     OCCT_DUMP_FIELD_VALUES_DUMPED(theOStream, theDepth, &myPolygonOffset)
 
@@ -206,6 +217,7 @@ protected:
   gp_XYZ                      myOrigin;                //!< the origin of all objects within the layer
   double               myCullingDistance;       //!< distance to discard objects
   double               myCullingSize;           //!< size to discard objects
+  double               myLodPixelError;         //!< tolerance in pixels for choosing levels of detail
   Graphic3d_PolygonOffset     myPolygonOffset;         //!< glPolygonOffset() arguments
   bool            myIsImmediate;           //!< immediate layer will be drawn after all normal layers
   bool            myToRaytrace;            //!< option to render layer within ray-tracing engine
@@ -24,12 +24,15 @@ enum Image_CompressedFormat
   Image_CompressedFormat_RGB_S3TC_DXT1 = Image_Format_NB,
   Image_CompressedFormat_RGBA_S3TC_DXT1,
   Image_CompressedFormat_RGBA_S3TC_DXT3,
-  Image_CompressedFormat_RGBA_S3TC_DXT5
+  Image_CompressedFormat_RGBA_S3TC_DXT5,
+  Image_CompressedFormat_RGBA_BPTC,     //!< BC7, 4x4 blocks of 128 bits (desktop GPUs)
+  Image_CompressedFormat_RGBA_ASTC_4x4, //!< ASTC LDR, 4x4 blocks of 128 bits (mobile and Apple GPUs)
+  Image_CompressedFormat_RGBA_ASTC_8x8  //!< ASTC LDR, 8x8 blocks of 128 bits (mobile and Apple GPUs)
 };
 
 enum
 {
-  Image_CompressedFormat_NB = Image_CompressedFormat_RGBA_S3TC_DXT5 + 1
+  Image_CompressedFormat_NB = Image_CompressedFormat_RGBA_ASTC_8x8 + 1
 };
 
 #endif // _Image_CompressedFormat_HeaderFile
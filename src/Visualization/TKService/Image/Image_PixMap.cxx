@@ -88,7 +88,12 @@ static const Image_FormatInfo Image_Table_ImageFormats[Image_CompressedFormat_NB
   CompressedImageFormatInfo(RGBA_S3TC_DXT3,
                             4,
                             1), // DXT3/5 uses circa 1 byte per pixel (128 bits per 4x4 block)
-  CompressedImageFormatInfo(RGBA_S3TC_DXT5, 4, 1)};
+  CompressedImageFormatInfo(RGBA_S3TC_DXT5, 4, 1),
+  CompressedImageFormatInfo(RGBA_BPTC, 4, 1), // BC7 uses 1 byte per pixel (128 bits per 4x4 block)
+  CompressedImageFormatInfo(RGBA_ASTC_4x4, 4, 1),
+  CompressedImageFormatInfo(RGBA_ASTC_8x8,
+                            4,
+                            1)}; // ASTC 8x8 uses circa quarter of a byte per pixel (128 bits per 8x8 block)
 } // namespace
 
 IMPLEMENT_STANDARD_RTTIEXT(Image_PixMapData, NCollection_Buffer)
@@ -20,6 +20,16 @@
 #include <Media_CodecContext.hxx>
 #include "../Media/Media_FFmpegCompatibility.pxx"
 
+#if defined(HAVE_FFMPEG) && defined(__APPLE__) && LIBAVCODEC_VERSION_INT >= FFMPEG_VERSION_4_4
+  #include <Standard_WarningsDisable.hxx>
+extern "C"
+{
+  #include <libavutil/hwcontext.h>
+};
+  #include <Standard_WarningsRestore.hxx>
+  #define MEDIA_HAVE_VIDEOTOOLBOX 1
+#endif
+
 #include <Media_Frame.hxx>
 #include <Media_FormatContext.hxx>
 
@@ -29,16 +39,39 @@
 
 IMPLEMENT_STANDARD_RTTIEXT(Media_CodecContext, Standard_Transient)
 
+#ifdef MEDIA_HAVE_VIDEOTOOLBOX
+namespace
+{
+//! Pick VideoToolbox surface format when offered by decoder, or first software format otherwise.
+AVPixelFormat getVideoToolboxFormat(AVCodecContext* theCtx, const AVPixelFormat* theFormats)
+{
+  (void)theCtx;
+  for (const AVPixelFormat* aFormatIter = theFormats; *aFormatIter != AV_PIX_FMT_NONE;
+       ++aFormatIter)
+  {
+    if (*aFormatIter == AV_PIX_FMT_VIDEOTOOLBOX)
+    {
+      return *aFormatIter;
+    }
+  }
+  Message::SendWarning("FFmpeg: VideoToolbox surface format is not supported by decoder");
+  return theFormats[0];
+}
+} // namespace
+#endif
+
 //=================================================================================================
 
 Media_CodecContext::Media_CodecContext()
     : myCodecCtx(nullptr),
       myCodec(nullptr),
+      myHwDeviceCtx(nullptr),
       myPtsStartBase(0.0),
       myPtsStartStream(0.0),
       myTimeBase(1.0),
       myStreamIndex(0),
-      myPixelAspectRatio(1.0f)
+      myPixelAspectRatio(1.0f),
+      myToUseHwDecoding(false)
 {
 #ifdef HAVE_FFMPEG
   myCodecCtx = avcodec_alloc_context3(nullptr);
@@ -141,6 +174,27 @@ bool Media_CodecContext::Init(const AVStream& theStream,
   {
     myCodecCtx->thread_count =
       theNbThreads <= -1 ? OSD_Parallel::NbLogicalProcessors() : theNbThreads;
+  #ifdef MEDIA_HAVE_VIDEOTOOLBOX
+    if (myToUseHwDecoding && myHwDeviceCtx == nullptr)
+    {
+      if (av_hwdevice_ctx_create(&myHwDeviceCtx,
+                                 AV_HWDEVICE_TYPE_VIDEOTOOLBOX,
+                                 nullptr,
+                                 nullptr,
+                                 0)
+          >= 0)
+      {
+        myCodecCtx->hw_device_ctx = av_buffer_ref(myHwDeviceCtx);
+        myCodecCtx->get_format    = getVideoToolboxFormat;
+      }
+      else
+      {
+        myHwDeviceCtx = nullptr;
+        Message::SendWarning(
+          "FFmpeg: unable to create VideoToolbox device, falling back to software decoding");
+      }
+    }
+  #endif
   }
 
   if (avcodec_open2(myCodecCtx, myCodec, &anOpts) < 0)
@@ -216,6 +270,12 @@ void Media_CodecContext::Close()
   #endif
 #endif
   }
+#ifdef HAVE_FFMPEG
+  if (myHwDeviceCtx != nullptr)
+  {
+    av_buffer_unref(&myHwDeviceCtx);
+  }
+#endif
 }
 
 //=================================================================================================
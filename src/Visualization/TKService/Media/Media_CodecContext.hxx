@@ -17,6 +17,7 @@
 
 #include <Media_Packet.hxx>
 
+struct AVBufferRef;
 struct AVCodec;
 struct AVCodecContext;
 struct AVStream;
@@ -36,6 +37,19 @@ public:
   //! Return context.
   AVCodecContext* Context() const { return myCodecCtx; }
 
+  //! Return TRUE if hardware-accelerated decoding should be requested on Init(); FALSE by default.
+  bool ToUseHardwareDecoding() const { return myToUseHwDecoding; }
+
+  //! Set if hardware-accelerated decoding should be requested on Init().
+  //! Currently only VideoToolbox on Apple platforms is supported;
+  //! decoded frames are then AV_PIX_FMT_VIDEOTOOLBOX with CVPixelBufferRef in the data[3] plane,
+  //! see Media_Frame::NativeBuffer().
+  //! Decoder falls back to software decoding if hardware device cannot be created.
+  void SetHardwareDecoding(bool theToUse) { myToUseHwDecoding = theToUse; }
+
+  //! Return TRUE if the codec has been opened with hardware decoding device.
+  bool IsHardwareDecoding() const { return myHwDeviceCtx != nullptr; }
+
   //! Open codec specified within the stream.
   //! @param theStream stream to open
   //! @param thePtsStartBase PTS start in seconds
@@ -89,11 +103,13 @@ public:
 protected:
   AVCodecContext* myCodecCtx;         //!< codec context
   AVCodec*        myCodec;            //!< opened codec
+  AVBufferRef*    myHwDeviceCtx;      //!< hardware decoding device context
   double          myPtsStartBase;     //!< starting PTS in context
   double          myPtsStartStream;   //!< starting PTS in the stream
   double          myTimeBase;         //!< stream timebase
   int             myStreamIndex;      //!< stream index
   float           myPixelAspectRatio; //!< pixel aspect ratio
+  bool            myToUseHwDecoding;  //!< flag to request hardware decoding
 };
 
 #endif // _Media_CodecContext_HeaderFile
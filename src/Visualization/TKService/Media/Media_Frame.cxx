@@ -231,6 +231,28 @@ int Media_Frame::LineSize(int thePlaneId) const
 
 //=================================================================================================
 
+bool Media_Frame::IsHardwareFrame() const
+{
+#ifdef HAVE_FFMPEG
+  return myFrame->format == AV_PIX_FMT_VIDEOTOOLBOX;
+#else
+  return false;
+#endif
+}
+
+//=================================================================================================
+
+void* Media_Frame::NativeBuffer() const
+{
+#ifdef HAVE_FFMPEG
+  return IsHardwareFrame() ? (void*)myFrame->data[3] : nullptr;
+#else
+  return nullptr;
+#endif
+}
+
+//=================================================================================================
+
 int64_t Media_Frame::BestEffortTimestamp() const
 {
 #ifdef HAVE_FFMPEG
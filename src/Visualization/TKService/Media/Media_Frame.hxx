@@ -73,6 +73,13 @@ public:
   //! @return linesize in bytes for specified data plane
   Standard_EXPORT int LineSize(int thePlaneId) const;
 
+  //! Return TRUE if frame holds hardware surface (AV_PIX_FMT_VIDEOTOOLBOX) instead of data planes.
+  Standard_EXPORT bool IsHardwareFrame() const;
+
+  //! Return native hardware surface (CVPixelBufferRef for VideoToolbox) or NULL for software frame.
+  //! The surface remains valid while the frame is not unreferenced.
+  Standard_EXPORT void* NativeBuffer() const;
+
   //! @return frame timestamp estimated using various heuristics, in stream time base
   Standard_EXPORT int64_t BestEffortTimestamp() const;
 
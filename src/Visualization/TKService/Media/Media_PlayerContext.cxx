@@ -54,6 +54,7 @@ Media_PlayerContext::Media_PlayerContext(Media_IFrameQueue* theFrameQueue)
       myNextEvent(false),
       myDuration(0.0),
       myToForceRgb(true),
+      myToUseHwDecoding(false),
       myToShutDown(false),
       mySeekTo(0.0),
       myPlayEvent(Media_PlayerEvent_NONE)
@@ -371,7 +372,7 @@ bool Media_PlayerContext::receiveFrame(const occ::handle<Media_Frame>&        th
   theFrame->SetPixelAspectRatio(myFrameTmp->PixelAspectRatio());
 
   Image_Format anOcctFmt = Media_Frame::FormatFFmpeg2Occt(myFrameTmp->Format());
-  if (anOcctFmt != Image_Format_UNKNOWN)
+  if (anOcctFmt != Image_Format_UNKNOWN || myFrameTmp->IsHardwareFrame())
   {
     Media_Frame::Swap(theFrame, myFrameTmp);
     return true;
@@ -535,6 +536,7 @@ void Media_PlayerContext::doThreadLoop()
       if (aCodecType == AVMEDIA_TYPE_VIDEO)
       {
         aVideoCtx = new Media_CodecContext();
+        aVideoCtx->SetHardwareDecoding(myToUseHwDecoding);
         if (!aVideoCtx->Init(aStream, aFormatCtx->PtsStartBase(), 1))
         {
           aVideoCtx.Nullify();
@@ -87,6 +87,15 @@ public:
   //! Set if queue requires RGB pixel format or can handle also YUV pixel format.
   void SetForceRgb(bool theToForce) { myToForceRgb = theToForce; }
 
+  //! Return TRUE if hardware-accelerated decoding is requested; FALSE by default.
+  bool ToUseHardwareDecoding() const { return myToUseHwDecoding; }
+
+  //! Set if hardware-accelerated decoding should be requested for the next opened input.
+  //! Hardware frames (see Media_Frame::IsHardwareFrame()) are passed to the queue as is,
+  //! so that this option should be enabled only when the consumer can handle them
+  //! (like Metal_VideoTexture); ToForceRgb() is ignored for such frames.
+  void SetHardwareDecoding(bool theToUse) { myToUseHwDecoding = theToUse; }
+
 private:
   //! Internal enumeration for events.
   enum Media_PlayerEvent
@@ -137,6 +146,7 @@ private:
   occ::handle<Media_Frame>         myFrameTmp;       //!< temporary object holding decoded frame
   occ::handle<Media_Scaler>        myScaler;         //!< pixel format conversion tool
   bool                        myToForceRgb;     //!< flag indicating if queue requires RGB pixel format or can handle also YUV pixel format
+  volatile bool               myToUseHwDecoding; //!< flag to request hardware-accelerated decoding
                                    // clang-format on
 
   volatile bool              myToShutDown; //!< flag to terminate working thread
@@ -532,7 +532,8 @@ void AIS_ColoredShape::computeSubshapeSelection(
                                                   theDeflAngle,
                                                   aNbPOnEdge,
                                                   aMaximalParameter,
-                                                  myDrawer->IsAutoTriangulation());
+                                                  myDrawer->IsAutoTriangulation(),
+                                                  myDrawer->SelectionCompactThreshold());
     return;
   }
   else if (theShape.ShapeType() == theTypOfSel)
@@ -547,7 +548,8 @@ void AIS_ColoredShape::computeSubshapeSelection(
                                                   theDeflAngle,
                                                   aNbPOnEdge,
                                                   aMaximalParameter,
-                                                  myDrawer->IsAutoTriangulation());
+                                                  myDrawer->IsAutoTriangulation(),
+                                                  myDrawer->SelectionCompactThreshold());
     return;
   }
 
@@ -21,6 +21,7 @@
 #include <AIS_GlobalStatus.hxx>
 
 #include <NCollection_DataMap.hxx>
+#include <NCollection_IndexedMap.hxx>
 #include <AIS_ConnectedInteractive.hxx>
 #include <AIS_MultipleConnectedInteractive.hxx>
 #include <Precision.hxx>
@@ -39,8 +40,11 @@
 
 #include <AIS_Shape.hxx>
 #include <StdSelect_BRepOwner.hxx>
+#include <TopExp_Explorer.hxx>
 #include <TopoDS_Shape.hxx>
 
+#include <algorithm>
+
 IMPLEMENT_STANDARD_RTTIEXT(AIS_InteractiveContext, Standard_Transient)
 
 namespace
@@ -504,6 +508,277 @@ void AIS_InteractiveContext::Display(const occ::handle<AIS_InteractiveObject>& t
   }
 }
 
+namespace
+{
+//! Find root of the objects group.
+static int findShapeGroup(NCollection_Array1<int>& theParents, int theIndex)
+{
+  while (theParents.Value(theIndex) != theIndex)
+  {
+    theParents.SetValue(theIndex, theParents.Value(theParents.Value(theIndex)));
+    theIndex = theParents.Value(theIndex);
+  }
+  return theIndex;
+}
+
+//! Merge the group of the object with the group of another object sharing the same (sub-)shape.
+static void mergeShapeGroup(NCollection_DataMap<const Standard_Transient*, int>& theOwners,
+                            NCollection_Array1<int>&                             theParents,
+                            const TopoDS_Shape&                                  theShape,
+                            const int                                            theIndex)
+{
+  if (const int* anOwner = theOwners.Seek(theShape.TShape().get()))
+  {
+    const int aGroup1 = findShapeGroup(theParents, *anOwner);
+    const int aGroup2 = findShapeGroup(theParents, theIndex);
+    if (aGroup1 != aGroup2)
+    {
+      theParents.SetValue(std::max(aGroup1, aGroup2), std::min(aGroup1, aGroup2));
+    }
+  }
+  else
+  {
+    theOwners.Bind(theShape.TShape().get(), theIndex);
+  }
+}
+
+//! Groups shapes sharing sub-shapes, as triangulation of shared faces might be computed.
+//! @param[in]  theShapes shapes to group
+//! @param[out] theRoots  group of each shape
+//! @param[out] theOrder  indices of the shapes sorted by groups
+static void sortShapeGroups(
+  const NCollection_IndexedMap<occ::handle<AIS_InteractiveObject>>& theShapes,
+  NCollection_Array1<int>&                                          theRoots,
+  NCollection_Array1<int>&                                          theOrder)
+{
+  const int                                           aNbShapes = theShapes.Extent();
+  NCollection_Array1<int>                             aParents(1, aNbShapes);
+  NCollection_DataMap<const Standard_Transient*, int> anOwners;
+  for (int aShapeIter = 1; aShapeIter <= aNbShapes; ++aShapeIter)
+  {
+    aParents.SetValue(aShapeIter, aShapeIter);
+    const TopoDS_Shape& aShape = occ::down_cast<AIS_Shape>(theShapes.FindKey(aShapeIter))->Shape();
+    if (aShape.IsNull())
+    {
+      continue;
+    }
+
+    mergeShapeGroup(anOwners, aParents, aShape, aShapeIter);
+    for (TopExp_Explorer aFaceIter(aShape, TopAbs_FACE); aFaceIter.More(); aFaceIter.Next())
+    {
+      mergeShapeGroup(anOwners, aParents, aFaceIter.Current(), aShapeIter);
+    }
+    for (TopExp_Explorer anEdgeIter(aShape, TopAbs_EDGE); anEdgeIter.More(); anEdgeIter.Next())
+    {
+      mergeShapeGroup(anOwners, aParents, anEdgeIter.Current(), aShapeIter);
+    }
+  }
+
+  for (int aShapeIter = 1; aShapeIter <= aNbShapes; ++aShapeIter)
+  {
+    theRoots.SetValue(aShapeIter, findShapeGroup(aParents, aShapeIter));
+    theOrder.SetValue(aShapeIter, aShapeIter);
+  }
+  std::stable_sort(theOrder.begin(), theOrder.end(), [&theRoots](int theIndex1, int theIndex2) {
+    return theRoots.Value(theIndex1) < theRoots.Value(theIndex2);
+  });
+}
+} // namespace
+
+//=================================================================================================
+
+void AIS_InteractiveContext::Display(
+  const NCollection_List<occ::handle<AIS_InteractiveObject>>& theObjects,
+  const bool                                                  theToUpdateViewer)
+{
+  // only shapes are known to compute presentations without modifying other objects
+  NCollection_IndexedMap<occ::handle<AIS_InteractiveObject>> aShapes;
+  NCollection_List<occ::handle<AIS_InteractiveObject>>       anOthers;
+  for (NCollection_List<occ::handle<AIS_InteractiveObject>>::Iterator anObjIter(theObjects);
+       anObjIter.More();
+       anObjIter.Next())
+  {
+    const occ::handle<AIS_InteractiveObject>& anObj = anObjIter.Value();
+    if (anObj.IsNull())
+    {
+      continue;
+    }
+    else if (!myObjects.IsBound(anObj) && anObj->IsKind(STANDARD_TYPE(AIS_Shape))
+             && anObj->Children().IsEmpty())
+    {
+      aShapes.Add(anObj);
+    }
+    else
+    {
+      anOthers.Append(anObj);
+    }
+  }
+
+  if (!aShapes.IsEmpty())
+  {
+    const int               aNbShapes = aShapes.Extent();
+    NCollection_Array1<int> aRoots(1, aNbShapes), anOrder(1, aNbShapes);
+    sortShapeGroups(aShapes, aRoots, anOrder);
+
+    NCollection_Array1<occ::handle<PrsMgr_PresentableObject>>  aPrsObjects(1, aNbShapes);
+    NCollection_Array1<occ::handle<SelectMgr_SelectableObject>> aSelObjects(1, aNbShapes);
+    NCollection_Array1<int>                                    aDispModes(1, aNbShapes);
+    NCollection_Array1<int>                                    aSelModes(1, aNbShapes);
+    NCollection_Array1<int>                                    aGroups(1, aNbShapes);
+    for (int aShapeIter = 1; aShapeIter <= aNbShapes; ++aShapeIter)
+    {
+      const int                                 anIndex = anOrder.Value(aShapeIter);
+      const occ::handle<AIS_InteractiveObject>& anObj   = aShapes.FindKey(anIndex);
+      int aDispMode = 0, aHiMod = -1, aSelMode = -1;
+      GetDefModes(anObj, aDispMode, aHiMod, aSelMode);
+      if (!myIsAutoActivateSelMode)
+      {
+        aSelMode = -1;
+      }
+
+      setContextToObject(anObj);
+      setObjectStatus(anObj, PrsMgr_DisplayStatus_Displayed, aDispMode, aSelMode);
+      anObj->ViewAffinity()->SetVisible(true); // reset view affinity mask
+      myMainVwr->StructureManager()->RegisterObject(anObj, anObj->ViewAffinity());
+
+      aPrsObjects.SetValue(aShapeIter, anObj);
+      aSelObjects.SetValue(aShapeIter, anObj);
+      aDispModes.SetValue(aShapeIter, aDispMode);
+      aSelModes.SetValue(aShapeIter, aSelMode);
+      aGroups.SetValue(aShapeIter, aRoots.Value(anIndex));
+    }
+
+    myMainPM->Display(aPrsObjects, aDispModes, aGroups);
+    for (int aShapeIter = 1; aShapeIter <= aNbShapes; ++aShapeIter)
+    {
+      const occ::handle<SelectMgr_SelectableObject>& anObj = aSelObjects.Value(aShapeIter);
+      if (myMainPM->HasPendingPresentation(anObj))
+      {
+        // selection is computed after presentation, which might modify the shape (triangulation)
+        myPendingSelGroups.Bind(aShapes.FindKey(anOrder.Value(aShapeIter)),
+                                aGroups.Value(aShapeIter));
+        aSelModes.SetValue(aShapeIter, -1);
+        continue;
+      }
+      if (aSelModes.Value(aShapeIter) != -1 && !mgrSelector->Contains(anObj))
+      {
+        mgrSelector->Load(anObj);
+      }
+    }
+    mgrSelector->Activate(aSelObjects, aSelModes, aGroups);
+  }
+
+  for (NCollection_List<occ::handle<AIS_InteractiveObject>>::Iterator anObjIter(anOthers);
+       anObjIter.More();
+       anObjIter.Next())
+  {
+    Display(anObjIter.Value(), false);
+  }
+
+  if (theToUpdateViewer)
+  {
+    myMainVwr->Update();
+  }
+}
+
+//=================================================================================================
+
+int AIS_InteractiveContext::UpdatePendingPresentations(const bool theToWait,
+                                                       const bool theToUpdateViewer)
+{
+  if (myPendingSelGroups.IsEmpty() && myPendingRedisplay.IsEmpty())
+  {
+    return 0;
+  }
+
+  const int aNbDisplayed = myMainPM->UpdatePendingPresentations(theToWait);
+
+  // recompute selection of redisplayed objects after swapping their presentations
+  for (NCollection_Map<occ::handle<AIS_InteractiveObject>>::Iterator anObjIter(myPendingRedisplay);
+       anObjIter.More();)
+  {
+    const occ::handle<AIS_InteractiveObject> anObj = anObjIter.Value();
+    if (myMainPM->HasPendingPresentation(anObj))
+    {
+      anObjIter.Next();
+      continue;
+    }
+
+    anObjIter.Next();
+    myPendingRedisplay.Remove(anObj);
+    if (myObjects.IsBound(anObj))
+    {
+      RecomputeSelectionOnly(anObj);
+    }
+  }
+
+  // activate selection of objects with computed presentations
+  NCollection_List<occ::handle<AIS_InteractiveObject>> aDoneList;
+  for (NCollection_DataMap<occ::handle<AIS_InteractiveObject>, int>::Iterator anObjIter(
+         myPendingSelGroups);
+       anObjIter.More();
+       anObjIter.Next())
+  {
+    if (!myMainPM->HasPendingPresentation(anObjIter.Key()))
+    {
+      aDoneList.Append(anObjIter.Key());
+    }
+  }
+
+  if (!aDoneList.IsEmpty())
+  {
+    const int               aNbObjects = aDoneList.Extent();
+    NCollection_Array1<occ::handle<SelectMgr_SelectableObject>> aSelObjects(1, aNbObjects);
+    NCollection_Array1<int> aSelModes(1, aNbObjects), aGroups(1, aNbObjects);
+    NCollection_Array1<int> anOrder(1, aNbObjects);
+    int                     anIndex = 1;
+    for (NCollection_List<occ::handle<AIS_InteractiveObject>>::Iterator anObjIter(aDoneList);
+         anObjIter.More();
+         anObjIter.Next(), ++anIndex)
+    {
+      const occ::handle<AIS_InteractiveObject>& anObj   = anObjIter.Value();
+      const occ::handle<AIS_GlobalStatus>*      aStatus = myObjects.Seek(anObj);
+      int                                       aSelMode = -1;
+      if (aStatus != nullptr && anObj->DisplayStatus() == PrsMgr_DisplayStatus_Displayed
+          && !(*aStatus)->SelectionModes().IsEmpty())
+      {
+        aSelMode = (*aStatus)->SelectionModes().First();
+      }
+
+      aSelObjects.SetValue(anIndex, anObj);
+      aSelModes.SetValue(anIndex, aSelMode);
+      aGroups.SetValue(anIndex, myPendingSelGroups.Find(anObj));
+      anOrder.SetValue(anIndex, anIndex);
+      myPendingSelGroups.UnBind(anObj);
+    }
+    std::stable_sort(anOrder.begin(), anOrder.end(), [&aGroups](int theIndex1, int theIndex2) {
+      return aGroups.Value(theIndex1) < aGroups.Value(theIndex2);
+    });
+
+    NCollection_Array1<occ::handle<SelectMgr_SelectableObject>> aSortedObjects(1, aNbObjects);
+    NCollection_Array1<int> aSortedModes(1, aNbObjects), aSortedGroups(1, aNbObjects);
+    for (int anObjIter = 1; anObjIter <= aNbObjects; ++anObjIter)
+    {
+      const int                                      anObjIndex = anOrder.Value(anObjIter);
+      const occ::handle<SelectMgr_SelectableObject>& anObj      = aSelObjects.Value(anObjIndex);
+      if (aSelModes.Value(anObjIndex) != -1 && !mgrSelector->Contains(anObj))
+      {
+        mgrSelector->Load(anObj);
+      }
+      aSortedObjects.SetValue(anObjIter, anObj);
+      aSortedModes.SetValue(anObjIter, aSelModes.Value(anObjIndex));
+      aSortedGroups.SetValue(anObjIter, aGroups.Value(anObjIndex));
+    }
+    mgrSelector->Activate(aSortedObjects, aSortedModes, aSortedGroups);
+  }
+
+  if (theToUpdateViewer && aNbDisplayed > 0)
+  {
+    myMainVwr->Update();
+  }
+  return aNbDisplayed;
+}
+
 //=================================================================================================
 
 void AIS_InteractiveContext::Load(const occ::handle<AIS_InteractiveObject>& theIObj,
@@ -927,6 +1202,85 @@ void AIS_InteractiveContext::Redisplay(const occ::handle<AIS_InteractiveObject>&
 
 //=================================================================================================
 
+void AIS_InteractiveContext::Redisplay(
+  const NCollection_List<occ::handle<AIS_InteractiveObject>>& theObjects,
+  const bool                                                  theToUpdateViewer)
+{
+  // only shapes are known to compute presentations without modifying other objects
+  NCollection_IndexedMap<occ::handle<AIS_InteractiveObject>> aShapes;
+  NCollection_List<occ::handle<AIS_InteractiveObject>>       anOthers;
+  for (NCollection_List<occ::handle<AIS_InteractiveObject>>::Iterator anObjIter(theObjects);
+       anObjIter.More();
+       anObjIter.Next())
+  {
+    const occ::handle<AIS_InteractiveObject>& anObj = anObjIter.Value();
+    if (anObj.IsNull())
+    {
+      continue;
+    }
+    else if (myObjects.IsBound(anObj) && anObj->DisplayStatus() == PrsMgr_DisplayStatus_Displayed
+             && anObj->IsKind(STANDARD_TYPE(AIS_Shape)) && anObj->Children().IsEmpty()
+             && !myPendingSelGroups.IsBound(anObj))
+    {
+      aShapes.Add(anObj);
+    }
+    else
+    {
+      anOthers.Append(anObj);
+    }
+  }
+
+  if (!aShapes.IsEmpty())
+  {
+    const int               aNbShapes = aShapes.Extent();
+    NCollection_Array1<int> aRoots(1, aNbShapes), anOrder(1, aNbShapes);
+    sortShapeGroups(aShapes, aRoots, anOrder);
+
+    NCollection_Array1<occ::handle<PrsMgr_PresentableObject>> aPrsObjects(1, aNbShapes);
+    NCollection_Array1<int>                                   aDispModes(1, aNbShapes);
+    NCollection_Array1<int>                                   aGroups(1, aNbShapes);
+    for (int aShapeIter = 1; aShapeIter <= aNbShapes; ++aShapeIter)
+    {
+      const int                                 anIndex = anOrder.Value(aShapeIter);
+      const occ::handle<AIS_InteractiveObject>& anObj   = aShapes.FindKey(anIndex);
+      anObj->SetToUpdate();
+      aPrsObjects.SetValue(aShapeIter, anObj);
+      aDispModes.SetValue(aShapeIter, myObjects.Find(anObj)->DisplayMode());
+      aGroups.SetValue(aShapeIter, aRoots.Value(anIndex));
+    }
+
+    // other outdated presentations (like highlighting in another mode) are recomputed on demand
+    myMainPM->Display(aPrsObjects, aDispModes, aGroups);
+    for (int aShapeIter = 1; aShapeIter <= aNbShapes; ++aShapeIter)
+    {
+      const occ::handle<AIS_InteractiveObject>& anObj = aShapes.FindKey(anOrder.Value(aShapeIter));
+      if (myMainPM->HasPendingPresentation(anObj))
+      {
+        // sensitive entities keep matching the displayed presentation till it is swapped
+        myPendingRedisplay.Add(anObj);
+      }
+      else
+      {
+        RecomputeSelectionOnly(anObj);
+      }
+    }
+  }
+
+  for (NCollection_List<occ::handle<AIS_InteractiveObject>>::Iterator anObjIter(anOthers);
+       anObjIter.More();
+       anObjIter.Next())
+  {
+    Redisplay(anObjIter.Value(), false);
+  }
+
+  if (theToUpdateViewer)
+  {
+    myMainVwr->Update();
+  }
+}
+
+//=================================================================================================
+
 void AIS_InteractiveContext::Redisplay(const AIS_KindOfInteractive theKOI,
                                        const int /*theSign*/,
                                        const bool theToUpdateViewer)
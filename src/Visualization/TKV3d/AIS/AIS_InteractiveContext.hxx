@@ -24,6 +24,7 @@
 #include <AIS_DisplayStatus.hxx>
 #include <AIS_KindOfInteractive.hxx>
 #include <NCollection_List.hxx>
+#include <NCollection_Map.hxx>
 #include <AIS_Selection.hxx>
 #include <AIS_SelectionModesConcurrency.hxx>
 #include <AIS_SelectionScheme.hxx>
@@ -121,6 +122,32 @@ public: //! @name object display management
     const bool                                theToUpdateViewer,
     const PrsMgr_DisplayStatus                theDispStatus = PrsMgr_DisplayStatus_None);
 
+  //! Displays the objects in this Context using their default Display Mode and selection mode
+  //! (see Display() for a single object). Presentations and sensitive entities of shapes (AIS_Shape)
+  //! not displayed yet are computed by OSD_ThreadPool worker threads, while other objects are
+  //! displayed one by one. Shapes sharing sub-shapes are computed by the same thread.
+  //! When PrsMgr_PresentationManager::ToComputeAsync() is set for the main presentation manager,
+  //! presentations of the shapes are computed in background and selection of such shapes
+  //! is activated by UpdatePendingPresentations() once their presentations are done.
+  Standard_EXPORT void Display(const NCollection_List<occ::handle<AIS_InteractiveObject>>& theObjects,
+                               const bool theToUpdateViewer);
+
+  //! Returns TRUE if some objects displayed by Display() or Redisplay() of objects list are waiting
+  //! for background computation of presentations or activation of selection.
+  bool HasPendingPresentations() const
+  {
+    return !myPendingSelGroups.IsEmpty() || !myPendingRedisplay.IsEmpty();
+  }
+
+  //! Displays presentations computed in background (see Display() and Redisplay() of objects list),
+  //! activates default selection mode of displayed objects and recomputes selection of redisplayed
+  //! ones.
+  //! @param[in] theToWait         wait for all pending presentations to be computed
+  //! @param[in] theToUpdateViewer redraw viewer if some presentations have been displayed
+  //! @return the number of displayed presentations
+  Standard_EXPORT int UpdatePendingPresentations(const bool theToWait,
+                                                 const bool theToUpdateViewer);
+
   //! Allows you to load the Interactive Object with a given selection mode,
   //! and/or with the desired decomposition option, whether the object is visualized or not.
   //! The loaded objects will be selectable but displayable in highlighting only when detected by
@@ -169,6 +196,16 @@ public: //! @name object display management
                                  const bool                                theToUpdateViewer,
                                  const bool                                theAllModes = false);
 
+  //! Recomputes presentations and selection of the objects (see Redisplay() for a single object).
+  //! Displayed presentations of shapes (AIS_Shape) are computed by OSD_ThreadPool worker threads,
+  //! while other objects are redisplayed one by one. Shapes sharing sub-shapes are computed by the
+  //! same thread. When PrsMgr_PresentationManager::ToComputeAsync() is set for the main
+  //! presentation manager, new presentations of the shapes are computed in background while the
+  //! outdated ones remain displayed and selectable; UpdatePendingPresentations() swaps them and
+  //! recomputes selection.
+  Standard_EXPORT void Redisplay(const NCollection_List<occ::handle<AIS_InteractiveObject>>& theObjects,
+                                 const bool theToUpdateViewer);
+
   //! Recomputes the Prs/Selection of displayed objects of a given type and a given signature.
   //! if signature = -1  doesn't take signature criterion.
   Standard_EXPORT void Redisplay(const AIS_KindOfInteractive theTypeOfObject,
@@ -1669,6 +1706,10 @@ protected: //! @name internal fields
   SelectMgr_PickingStrategy myPickingStrategy; //!< picking strategy to be applied within MoveTo()
   bool                      myAutoHilight;
   bool                      myIsAutoActivateSelMode;
+  // clang-format off
+  NCollection_DataMap<occ::handle<AIS_InteractiveObject>, int> myPendingSelGroups; //!< objects with presentations computed in background, mapped to their groups
+  NCollection_Map<occ::handle<AIS_InteractiveObject>>          myPendingRedisplay; //!< redisplayed objects with presentations computed in background
+  // clang-format on
 };
 
 #endif // _AIS_InteractiveContext_HeaderFile
@@ -128,7 +128,7 @@ void AIS_Shape::Compute(const occ::handle<PrsMgr_PresentationManager>&,
       try
       {
         OCC_CATCH_SIGNALS
-        StdPrs_WFShape::Add(thePrs, myshape, myDrawer);
+        StdPrs_WFShape::Add(thePrs, myshape, myDrawer, true);
       }
       catch (Standard_Failure const& anException)
       {
@@ -203,6 +203,21 @@ void AIS_Shape::Compute(const occ::handle<PrsMgr_PresentationManager>&,
 
 //=================================================================================================
 
+void AIS_Shape::ComputeProxy(const occ::handle<PrsMgr_PresentationManager>&,
+                             const occ::handle<Prs3d_Presentation>& thePrs,
+                             const int)
+{
+  // bounding box is also cached here for Compute() running in background
+  if (myshape.IsNull() || IsInfinite() || BoundingBox().IsVoid())
+  {
+    return;
+  }
+
+  Prs3d_BndBox::Add(thePrs, BoundingBox(), myDrawer);
+}
+
+//=================================================================================================
+
 void AIS_Shape::computeHlrPresentation(const occ::handle<Graphic3d_Camera>&   theProjector,
                                        const occ::handle<Prs3d_Presentation>& thePrs,
                                        const TopoDS_Shape&                    theShape,
@@ -310,7 +325,11 @@ void AIS_Shape::ComputeSelection(const occ::handle<SelectMgr_Selection>& aSelect
                                       TypOfSel,
                                       aDeflection,
                                       myDrawer->DeviationAngle(),
-                                      myDrawer->IsAutoTriangulation());
+                                      myDrawer->IsAutoTriangulation(),
+                                      -1,
+                                      9,
+                                      500,
+                                      myDrawer->SelectionCompactThreshold());
   }
   catch (Standard_Failure const& anException)
   {
@@ -272,6 +272,11 @@ protected:
                                const occ::handle<Prs3d_Presentation>&         thePrs,
                                const int                                      theMode) override;
 
+  //! Compute bounding box presentation displayed while the shape presentation is computed.
+  Standard_EXPORT void ComputeProxy(const occ::handle<PrsMgr_PresentationManager>& thePrsMgr,
+                                    const occ::handle<Prs3d_Presentation>&         thePrs,
+                                    const int theMode) override;
+
   //! Compute projected presentation.
   void computeHLR(const occ::handle<Graphic3d_Camera>&   theProjector,
                   const occ::handle<TopLoc_Datum3D>&     theTrsf,
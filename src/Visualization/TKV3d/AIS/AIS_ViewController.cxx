@@ -3139,11 +3139,21 @@ void AIS_ViewController::handleMoveTo(const occ::handle<AIS_InteractiveContext>&
 
 //=================================================================================================
 
-void AIS_ViewController::handleViewRedraw(const occ::handle<AIS_InteractiveContext>&,
-                                          const occ::handle<V3d_View>& theView)
+void AIS_ViewController::handleViewRedraw(const occ::handle<AIS_InteractiveContext>& theCtx,
+                                          const occ::handle<V3d_View>&               theView)
 {
   occ::handle<V3d_View> aParentView = theView->IsSubview() ? theView->ParentView() : theView;
 
+  // display presentations computed in background
+  if (!theCtx.IsNull() && theCtx->HasPendingPresentations())
+  {
+    if (theCtx->UpdatePendingPresentations(false, false) > 0)
+    {
+      theView->Invalidate();
+    }
+    setAskNextFrame();
+  }
+
   // manage animation state
   if (!myViewAnimation.IsNull() && !myViewAnimation->IsStopped())
   {
@@ -15,6 +15,7 @@
 #include <Prs3d_Drawer.hxx>
 
 #include <Graphic3d_AspectFillArea3d.hxx>
+#include <Graphic3d_Group.hxx>
 #include <Prs3d_DatumAspect.hxx>
 #include <Prs3d_DimensionAspect.hxx>
 #include <Prs3d_IsoAspect.hxx>
@@ -44,6 +45,7 @@ static const Quantity_NameOfColor THE_DEF_COLOR_Section        = Quantity_NOC_OR
 
 Prs3d_Drawer::Prs3d_Drawer()
     : myNbPoints(-1),
+      mySelCompactThreshold(-1),
       myMaximalParameterValue(-1.0),
       myChordialDeviation(-1.0),
       myTypeOfDeflection(Aspect_TOD_RELATIVE),
@@ -57,6 +59,12 @@ Prs3d_Drawer::Prs3d_Drawer()
       myHasOwnIsoOnTriangulation(false),
       myIsAutoTriangulated(true),
       myHasOwnIsAutoTriangulated(false),
+      myIsInstancedTriangulation(false),
+      myHasOwnIsInstancedTriangulation(false),
+      myNbLods(1),
+      myHasOwnNbLods(false),
+      myIsVertexCacheOptimization(false),
+      myHasOwnIsVertexCacheOptimization(false),
 
       myWireDraw(true),
       myHasOwnWireDraw(false),
@@ -90,6 +98,7 @@ Prs3d_Drawer::Prs3d_Drawer()
 void Prs3d_Drawer::SetupOwnDefaults()
 {
   myNbPoints              = 30;
+  mySelCompactThreshold   = 0;
   myMaximalParameterValue = 500000.0;
   myChordialDeviation     = 0.0001;
   myDeviationCoefficient  = 0.001;
@@ -180,6 +189,30 @@ void Prs3d_Drawer::SetAutoTriangulation(const bool theIsEnabled)
 
 //=================================================================================================
 
+void Prs3d_Drawer::SetInstancedTriangulation(const bool theIsEnabled)
+{
+  myHasOwnIsInstancedTriangulation = true;
+  myIsInstancedTriangulation       = theIsEnabled;
+}
+
+//=================================================================================================
+
+void Prs3d_Drawer::SetNbLods(const int theNbLods)
+{
+  myHasOwnNbLods = true;
+  myNbLods       = std::max(1, std::min(theNbLods, (int)Graphic3d_Group::MaxLevelsOfDetail));
+}
+
+//=================================================================================================
+
+void Prs3d_Drawer::SetVertexCacheOptimization(const bool theIsEnabled)
+{
+  myHasOwnIsVertexCacheOptimization = true;
+  myIsVertexCacheOptimization       = theIsEnabled;
+}
+
+//=================================================================================================
+
 const occ::handle<Prs3d_LineAspect>& Prs3d_Drawer::FreeBoundaryAspect() const
 {
   if (myFreeBoundaryAspect.IsNull() && !myLink.IsNull())
@@ -556,6 +589,7 @@ void Prs3d_Drawer::ClearLocalAttributes()
   mySectionAspect.Nullify();
 
   UnsetOwnDiscretisation();
+  UnsetOwnSelectionCompactThreshold();
   UnsetOwnMaximalParameterValue();
   UnsetOwnTypeOfDeflection();
   UnsetOwnMaximalChordialDeviation();
@@ -564,6 +598,9 @@ void Prs3d_Drawer::ClearLocalAttributes()
   UnsetOwnIsoOnPlane();
   UnsetOwnIsoOnTriangulation();
   UnsetOwnIsAutoTriangulation();
+  UnsetOwnIsInstancedTriangulation();
+  UnsetOwnNbLods();
+  UnsetOwnIsVertexCacheOptimization();
   UnsetOwnWireDraw();
   UnsetOwnLineArrowDraw();
   UnsetOwnDrawHiddenLine();
@@ -853,6 +890,7 @@ void Prs3d_Drawer::DumpJson(Standard_OStream& theOStream, int theDepth) const
 
   OCCT_DUMP_FIELD_VALUE_POINTER(theOStream, myLink.get())
 
+  OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, mySelCompactThreshold)
   OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, myMaximalParameterValue)
   OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, myChordialDeviation)
   OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, myTypeOfDeflection)
@@ -868,6 +906,12 @@ void Prs3d_Drawer::DumpJson(Standard_OStream& theOStream, int theDepth) const
   OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, myHasOwnIsoOnTriangulation)
   OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, myIsAutoTriangulated)
   OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, myHasOwnIsAutoTriangulated)
+  OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, myIsInstancedTriangulation)
+  OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, myHasOwnIsInstancedTriangulation)
+  OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, myNbLods)
+  OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, myHasOwnNbLods)
+  OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, myIsVertexCacheOptimization)
+  OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, myHasOwnIsVertexCacheOptimization)
 
   OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, myWireDraw)
   OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, myHasOwnWireDraw)
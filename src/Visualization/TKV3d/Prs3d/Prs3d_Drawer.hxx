@@ -184,6 +184,28 @@ public:
   //! Resets HasOwnDiscretisation() flag, e.g. undoes SetDiscretisation().
   void UnsetOwnDiscretisation() { myNbPoints = -1; }
 
+  //! Sets the minimal number of triangles of face triangulation, starting from which
+  //! the selection uses compact sensitive triangulation (see Select3D_SensitiveTriangulation);
+  //! 0 disables compact mode.
+  void SetSelectionCompactThreshold(const int theNbTriangles)
+  {
+    mySelCompactThreshold = theNbTriangles > 0 ? theNbTriangles : 0;
+  }
+
+  //! Returns the minimal number of triangles for compact sensitive triangulation (0 by default).
+  int SelectionCompactThreshold() const
+  {
+    return mySelCompactThreshold != -1
+             ? mySelCompactThreshold
+             : (!myLink.IsNull() ? myLink->SelectionCompactThreshold() : 0);
+  }
+
+  //! Returns true if the drawer has its own compact selection threshold.
+  bool HasOwnSelectionCompactThreshold() const { return mySelCompactThreshold != -1; }
+
+  //! Resets HasOwnSelectionCompactThreshold() flag, e.g. undoes SetSelectionCompactThreshold().
+  void UnsetOwnSelectionCompactThreshold() { mySelCompactThreshold = -1; }
+
   //! Sets the deviation coefficient theCoefficient.
   //! Also sets the hasOwnDeviationCoefficient flag to true and
   //! myPreviousDeviationCoefficient
@@ -292,6 +314,83 @@ public:
     myIsAutoTriangulated       = true;
   }
 
+  //! Sets if shaded presentation should share triangles of sub-shapes occurring several times
+  //! with different locations (like instances of the same part within an assembly):
+  //! a single primitive array is built per sub-shape in its own coordinate system and added to
+  //! groups with location transformation (see Graphic3d_Group::SetTransformation()), so that
+  //! memory scales with the number of unique sub-shapes and the graphic driver might draw
+  //! instances by hardware instancing.
+  Standard_EXPORT void SetInstancedTriangulation(const bool theIsEnabled);
+
+  //! Returns True if triangulation of repeated sub-shapes is shared by shaded presentation;
+  //! FALSE by default.
+  bool IsInstancedTriangulation() const
+  {
+    return myHasOwnIsInstancedTriangulation || myLink.IsNull()
+             ? myIsInstancedTriangulation
+             : myLink->IsInstancedTriangulation();
+  }
+
+  //! Returns true if the drawer has own IsInstancedTriangulation() setting.
+  bool HasOwnIsInstancedTriangulation() const { return myHasOwnIsInstancedTriangulation; }
+
+  //! Resets HasOwnIsInstancedTriangulation() flag, e.g. undoes SetInstancedTriangulation().
+  void UnsetOwnIsInstancedTriangulation()
+  {
+    myHasOwnIsInstancedTriangulation = false;
+    myIsInstancedTriangulation       = false;
+  }
+
+  //! Sets the number of levels of detail of shaded presentation (1 means no levels of detail).
+  //! Coarser triangulations of faces are generated with deflection increasing by the factor
+  //! StdPrs_ToolTriangulatedShape::LodDeflectionFactor() per level and stored within faces
+  //! after the active one (see StdPrs_ToolTriangulatedShape::TessellateLods());
+  //! each level is put into a dedicated group (see Graphic3d_Group::SetLevelOfDetail())
+  //! and the graphic driver draws only the level fitting the projected size of presentation.
+  //! The number is clamped to [1, Graphic3d_Group::MaxLevelsOfDetail].
+  Standard_EXPORT void SetNbLods(const int theNbLods);
+
+  //! Returns the number of levels of detail of shaded presentation; 1 by default.
+  int NbLods() const
+  {
+    return myHasOwnNbLods || myLink.IsNull() ? myNbLods : myLink->NbLods();
+  }
+
+  //! Returns true if the drawer has own NbLods() setting.
+  bool HasOwnNbLods() const { return myHasOwnNbLods; }
+
+  //! Resets HasOwnNbLods() flag, e.g. undoes SetNbLods().
+  void UnsetOwnNbLods()
+  {
+    myHasOwnNbLods = false;
+    myNbLods       = 1;
+  }
+
+  //! Sets if triangles and nodes of faces should be put into primitive arrays of shaded
+  //! presentation in order optimized for GPU vertex cache and overdraw
+  //! (see Poly_VertexCacheOptimizer); triangulations of faces are not modified.
+  //! Has no effect on triangulations already optimized by mesher
+  //! (IMeshTools_Parameters::OptimizeVertexCache) except extra computations.
+  Standard_EXPORT void SetVertexCacheOptimization(const bool theIsEnabled);
+
+  //! Returns True if shaded presentation reorders triangles for GPU vertex cache; FALSE by default.
+  bool IsVertexCacheOptimization() const
+  {
+    return myHasOwnIsVertexCacheOptimization || myLink.IsNull()
+             ? myIsVertexCacheOptimization
+             : myLink->IsVertexCacheOptimization();
+  }
+
+  //! Returns true if the drawer has own IsVertexCacheOptimization() setting.
+  bool HasOwnIsVertexCacheOptimization() const { return myHasOwnIsVertexCacheOptimization; }
+
+  //! Resets HasOwnIsVertexCacheOptimization() flag, e.g. undoes SetVertexCacheOptimization().
+  void UnsetOwnIsVertexCacheOptimization()
+  {
+    myHasOwnIsVertexCacheOptimization = false;
+    myIsVertexCacheOptimization       = false;
+  }
+
   //! Defines own attributes for drawing an U isoparametric curve of a face,
   //! settings from linked Drawer or NULL if neither was set.
   //!
@@ -907,6 +1006,7 @@ protected:
   occ::handle<Prs3d_Drawer> myLink;
 
   int                     myNbPoints;
+  int                     mySelCompactThreshold;
   double                  myMaximalParameterValue;
   double                  myChordialDeviation;
   Aspect_TypeOfDeflection myTypeOfDeflection;
@@ -922,6 +1022,12 @@ protected:
   bool                    myHasOwnIsoOnTriangulation;
   bool                    myIsAutoTriangulated;
   bool                    myHasOwnIsAutoTriangulated;
+  bool                    myIsInstancedTriangulation;
+  bool                    myHasOwnIsInstancedTriangulation;
+  int                     myNbLods;
+  bool                    myHasOwnNbLods;
+  bool                    myIsVertexCacheOptimization;
+  bool                    myHasOwnIsVertexCacheOptimization;
 
   occ::handle<Prs3d_IsoAspect>     myUIsoAspect;
   occ::handle<Prs3d_IsoAspect>     myVIsoAspect;
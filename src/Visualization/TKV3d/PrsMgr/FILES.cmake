@@ -2,6 +2,8 @@
 set(OCCT_PrsMgr_FILES_LOCATION "${CMAKE_CURRENT_LIST_DIR}")
 
 set(OCCT_PrsMgr_FILES
+  PrsMgr_ComputeQueue.cxx
+  PrsMgr_ComputeQueue.hxx
   PrsMgr_DisplayStatus.hxx
   PrsMgr_ListOfPresentableObjects.hxx
 
@@ -0,0 +1,245 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <PrsMgr_ComputeQueue.hxx>
+
+#include <Message.hxx>
+#include <OSD.hxx>
+#include <OSD_Parallel.hxx>
+#include <PrsMgr_Presentation.hxx>
+#include <Standard_ErrorHandler.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(PrsMgr_ComputeQueue, Standard_Transient)
+
+//! Functor computing a group of presentations.
+class PrsMgr_ComputeQueue::ComputeFunctor
+{
+public:
+  ComputeFunctor(const NCollection_Array1<occ::handle<PrsMgr_Presentation>>& thePrsList,
+                 const NCollection_Array1<int>&                              theGroupLowers,
+                 PrsMgr_ComputeQueue*                                        theDone)
+      : myPrsList(thePrsList),
+        myGroupLowers(theGroupLowers),
+        myDone(theDone)
+  {
+  }
+
+  void operator()(int theGroupIndex) const
+  {
+    for (int anIter = myGroupLowers.Value(myGroupLowers.Lower() + theGroupIndex);
+         anIter < myGroupLowers.Value(myGroupLowers.Lower() + theGroupIndex + 1);
+         ++anIter)
+    {
+      const occ::handle<PrsMgr_Presentation>& aPrs = myPrsList.Value(anIter);
+      if (aPrs.IsNull())
+      {
+        continue;
+      }
+
+      if (myDone == nullptr)
+      {
+        aPrs->Compute();
+        continue;
+      }
+
+      // background computation should not break the whole queue
+      try
+      {
+        OCC_CATCH_SIGNALS
+        aPrs->Compute();
+      }
+      catch (const Standard_Failure& theFailure)
+      {
+        Message::SendFail() << "Error: presentation computation failed with "
+                            << theFailure.DynamicType()->Name() << ": "
+                            << theFailure.GetMessageString();
+      }
+      catch (const std::exception& theStdException)
+      {
+        Message::SendFail() << "Error: presentation computation failed with "
+                            << typeid(theStdException).name() << ": " << theStdException.what();
+      }
+      catch (...)
+      {
+        Message::SendFail("Error: presentation computation failed with unknown exception");
+      }
+      myDone->addDone(aPrs);
+    }
+  }
+
+private:
+  const NCollection_Array1<occ::handle<PrsMgr_Presentation>>& myPrsList;
+  const NCollection_Array1<int>&                              myGroupLowers;
+  PrsMgr_ComputeQueue*                                        myDone;
+};
+
+//=================================================================================================
+
+void PrsMgr_ComputeQueue::Perform(
+  const NCollection_Array1<occ::handle<PrsMgr_Presentation>>& thePrsList,
+  const NCollection_Array1<int>&                              theGroupLowers,
+  PrsMgr_ComputeQueue*                                        theDone)
+{
+  const int      aNbGroups = theGroupLowers.Size() - 1;
+  ComputeFunctor aFunctor(thePrsList, theGroupLowers, theDone);
+  OSD_Parallel::For(0, aNbGroups, aFunctor, aNbGroups < 2);
+}
+
+//=================================================================================================
+
+PrsMgr_ComputeQueue::PrsMgr_ComputeQueue()
+    : myWakeEvent(false),
+      myIdleEvent(true),
+      myNbPending(0),
+      myToStop(false),
+      myIsStarted(false),
+      myToCatchFpe(OSD::ToCatchFloatingSignals())
+{
+  myThread.SetFunction(&PrsMgr_ComputeQueue::runThread);
+}
+
+//=================================================================================================
+
+PrsMgr_ComputeQueue::~PrsMgr_ComputeQueue()
+{
+  Stop();
+}
+
+//=================================================================================================
+
+void PrsMgr_ComputeQueue::Add(const NCollection_Array1<occ::handle<PrsMgr_Presentation>>& thePrsList,
+                              const NCollection_Array1<int>& theGroupLowers)
+{
+  int aNbPrs = 0;
+  for (NCollection_Array1<occ::handle<PrsMgr_Presentation>>::Iterator aPrsIter(thePrsList);
+       aPrsIter.More();
+       aPrsIter.Next())
+  {
+    if (!aPrsIter.Value().IsNull())
+    {
+      ++aNbPrs;
+    }
+  }
+  if (aNbPrs == 0)
+  {
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> aLock(myMutex);
+    myJobs.Append(Job(thePrsList, theGroupLowers));
+    myWakeEvent.Set();
+    myIdleEvent.Reset();
+  }
+  myNbPending += aNbPrs;
+
+  if (!myIsStarted)
+  {
+    myIsStarted = true;
+    myThread.Run(this);
+  }
+}
+
+//=================================================================================================
+
+bool PrsMgr_ComputeQueue::Fetch(NCollection_List<occ::handle<PrsMgr_Presentation>>& theDone)
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  if (myDone.IsEmpty())
+  {
+    return false;
+  }
+
+  myNbPending -= myDone.Extent();
+  theDone.Append(myDone);
+  return true;
+}
+
+//=================================================================================================
+
+void PrsMgr_ComputeQueue::Wait()
+{
+  if (myIsStarted)
+  {
+    myIdleEvent.Wait();
+  }
+}
+
+//=================================================================================================
+
+void PrsMgr_ComputeQueue::Stop()
+{
+  if (!myIsStarted)
+  {
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> aLock(myMutex);
+    myJobs.Clear();
+    myToStop = true;
+    myWakeEvent.Set();
+  }
+  myThread.Wait();
+  myToStop    = false;
+  myIsStarted = false;
+  myNbPending = myDone.Extent();
+  myIdleEvent.Set();
+}
+
+//=================================================================================================
+
+void PrsMgr_ComputeQueue::addDone(const occ::handle<PrsMgr_Presentation>& thePrs)
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  myDone.Append(thePrs);
+}
+
+//=================================================================================================
+
+void PrsMgr_ComputeQueue::performThread()
+{
+  OSD::SetThreadLocalSignal(OSD::SignalMode(), myToCatchFpe);
+  for (;;)
+  {
+    myWakeEvent.Wait();
+
+    Job aJob;
+    {
+      std::lock_guard<std::mutex> aLock(myMutex);
+      if (myToStop)
+      {
+        return;
+      }
+      else if (myJobs.IsEmpty())
+      {
+        myWakeEvent.Reset();
+        myIdleEvent.Set();
+        continue;
+      }
+      aJob.Presentations.Move(myJobs.First().Presentations);
+      aJob.GroupLowers.Move(myJobs.First().GroupLowers);
+      myJobs.RemoveFirst();
+    }
+
+    Perform(aJob.Presentations, aJob.GroupLowers, this);
+  }
+}
+
+//=================================================================================================
+
+void* PrsMgr_ComputeQueue::runThread(void* theQueue)
+{
+  static_cast<PrsMgr_ComputeQueue*>(theQueue)->performThread();
+  return nullptr;
+}
@@ -0,0 +1,113 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _PrsMgr_ComputeQueue_HeaderFile
+#define _PrsMgr_ComputeQueue_HeaderFile
+
+#include <NCollection_Array1.hxx>
+#include <NCollection_List.hxx>
+#include <OSD_Thread.hxx>
+#include <Standard_Condition.hxx>
+#include <Standard_Transient.hxx>
+
+#include <mutex>
+
+class PrsMgr_Presentation;
+
+//! Queue computing presentations (PrsMgr_Presentation::Compute()) within background thread,
+//! which distributes groups of presentations across OSD_ThreadPool workers.
+//! Computed presentations are collected by Fetch() on the thread owning the presentations,
+//! so that they might be displayed progressively, as soon as each one is done.
+//! Queued presentations should not be displayed, modified or accessed otherwise until fetched.
+class PrsMgr_ComputeQueue : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(PrsMgr_ComputeQueue, Standard_Transient)
+public:
+  //! Computes presentations on the calling thread using OSD_ThreadPool workers.
+  //! Presentations within the same group are computed one after another by the same thread.
+  //! @param[in] thePrsList     presentations to compute, NULL items are skipped
+  //! @param[in] theGroupLowers group bounds - indices of the first presentation of each group
+  //!                           (starting from thePrsList.Lower()) followed by Upper() + 1
+  //! @param[in] theDone        optional queue to append computed presentations to
+  Standard_EXPORT static void Perform(
+    const NCollection_Array1<occ::handle<PrsMgr_Presentation>>& thePrsList,
+    const NCollection_Array1<int>&                              theGroupLowers,
+    PrsMgr_ComputeQueue*                                        theDone = nullptr);
+
+public:
+  //! Empty constructor; background thread is started by the first Add().
+  Standard_EXPORT PrsMgr_ComputeQueue();
+
+  //! Destructor, stops background thread.
+  Standard_EXPORT ~PrsMgr_ComputeQueue() override;
+
+  //! Queues presentations to compute in background (see Perform() for arguments).
+  Standard_EXPORT void Add(const NCollection_Array1<occ::handle<PrsMgr_Presentation>>& thePrsList,
+                           const NCollection_Array1<int>& theGroupLowers);
+
+  //! Returns the number of queued presentations not fetched yet.
+  int NbPending() const { return myNbPending; }
+
+  //! Moves presentations computed since the previous call into theDone.
+  //! @return FALSE if nothing has been computed
+  Standard_EXPORT bool Fetch(NCollection_List<occ::handle<PrsMgr_Presentation>>& theDone);
+
+  //! Waits until all queued presentations are computed.
+  Standard_EXPORT void Wait();
+
+  //! Stops background thread after computing the current job; other queued jobs are discarded.
+  Standard_EXPORT void Stop();
+
+private:
+  //! Functor computing a group of presentations.
+  class ComputeFunctor;
+
+  //! Queued job.
+  struct Job
+  {
+    NCollection_Array1<occ::handle<PrsMgr_Presentation>> Presentations;
+    NCollection_Array1<int>                              GroupLowers;
+
+    Job() {}
+
+    Job(const NCollection_Array1<occ::handle<PrsMgr_Presentation>>& thePrsList,
+        const NCollection_Array1<int>&                              theGroupLowers)
+        : Presentations(thePrsList),
+          GroupLowers(theGroupLowers)
+    {
+    }
+  };
+
+  //! Appends computed presentation to the list to fetch.
+  void addDone(const occ::handle<PrsMgr_Presentation>& thePrs);
+
+  //! Method is executed in the context of thread.
+  void performThread();
+
+  //! Method is executed in the context of thread.
+  static void* runThread(void* theQueue);
+
+private:
+  NCollection_List<Job>                              myJobs;       //!< queued jobs
+  NCollection_List<occ::handle<PrsMgr_Presentation>> myDone;       //!< computed presentations to fetch
+  std::mutex                                         myMutex;      //!< mutex for myJobs and myDone
+  Standard_Condition                                 myWakeEvent;  //!< raises when a job is queued
+  Standard_Condition                                 myIdleEvent;  //!< raises when all jobs are done
+  OSD_Thread                                         myThread;     //!< background thread
+  int                                                myNbPending;  //!< queued presentations not fetched yet
+  bool                                               myToStop;     //!< flag to stop background thread
+  bool                                               myIsStarted;  //!< indicates that thread is running
+  bool                                               myToCatchFpe; //!< floating point exceptions mode
+};
+
+#endif // _PrsMgr_ComputeQueue_HeaderFile
@@ -415,6 +415,19 @@ protected: //! @name interface methods
                                        const occ::handle<Prs3d_Presentation>&         thePrs,
                                        const int                                      theMode) = 0;
 
+  //! Fills the given presentation with a cheap proxy (like a bounding box) displayed instead of
+  //! the presentation for specified display mode, while the latter is computed in background
+  //! (see PrsMgr_PresentationManager::SetComputeAsync()). Called by the thread owning the object
+  //! before Compute(). Default implementation does nothing, so that nothing is displayed meanwhile.
+  virtual void ComputeProxy(const occ::handle<PrsMgr_PresentationManager>& thePrsMgr,
+                            const occ::handle<Prs3d_Presentation>&         thePrs,
+                            const int                                      theMode)
+  {
+    (void)thePrsMgr;
+    (void)thePrs;
+    (void)theMode;
+  }
+
   //! Calculates hidden line removal presentation for specific camera position.
   //! Each of the views in the viewer and every modification such as rotation, for example, entails
   //! recalculation. Default implementation throws Standard_NotImplemented exception Warning! The
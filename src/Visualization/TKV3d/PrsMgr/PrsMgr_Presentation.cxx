@@ -154,21 +154,9 @@ void PrsMgr_Presentation::Clear(const bool theWithDestruction)
 
 void PrsMgr_Presentation::Compute()
 {
-  int aDispMode = 0;
-  for (NCollection_Sequence<occ::handle<PrsMgr_Presentation>>::Iterator aPrsIter(
-         myPresentableObject->myPresentations);
-       aPrsIter.More();
-       aPrsIter.Next())
-  {
-    const occ::handle<PrsMgr_Presentation>& aModedPresentation = aPrsIter.Value();
-    if (aModedPresentation == this)
-    {
-      aDispMode = aModedPresentation->Mode();
-      break;
-    }
-  }
-
-  myPresentableObject->Compute(myPresentationManager, this, aDispMode);
+  // mode is taken from the presentation itself, which might be not yet in the object's list
+  // while computed in background (see PrsMgr_PresentationManager::SetComputeAsync())
+  myPresentableObject->Compute(myPresentationManager, this, myMode);
 }
 
 //=================================================================================================
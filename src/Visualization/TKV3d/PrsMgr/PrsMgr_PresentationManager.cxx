@@ -16,6 +16,7 @@
 
 #include <TopLoc_Datum3D.hxx>
 #include <Prs3d_PresentationShadow.hxx>
+#include <PrsMgr_ComputeQueue.hxx>
 #include <PrsMgr_PresentableObject.hxx>
 #include <PrsMgr_Presentation.hxx>
 #include <PrsMgr_Presentations.hxx>
@@ -29,16 +30,28 @@ IMPLEMENT_STANDARD_RTTIEXT(PrsMgr_PresentationManager, Standard_Transient)
 PrsMgr_PresentationManager::PrsMgr_PresentationManager(
   const occ::handle<Graphic3d_StructureManager>& theStructureManager)
     : myStructureManager(theStructureManager),
-      myImmediateModeOn(0)
+      myImmediateModeOn(0),
+      myToComputeAsync(false)
 {
   //
 }
 
 //=================================================================================================
 
+PrsMgr_PresentationManager::~PrsMgr_PresentationManager()
+{
+  if (!myComputeQueue.IsNull())
+  {
+    myComputeQueue->Stop();
+  }
+}
+
+//=================================================================================================
+
 void PrsMgr_PresentationManager::Display(const occ::handle<PrsMgr_PresentableObject>& thePrsObj,
                                          const int                                    theMode)
 {
+  syncPending(thePrsObj);
   if (thePrsObj->HasOwnPresentations())
   {
     occ::handle<PrsMgr_Presentation> aPrs = Presentation(thePrsObj, theMode, true);
@@ -77,11 +90,295 @@ void PrsMgr_PresentationManager::Display(const occ::handle<PrsMgr_PresentableObj
   }
 }
 
+void PrsMgr_PresentationManager::Display(
+  const NCollection_Array1<occ::handle<PrsMgr_PresentableObject>>& theObjects,
+  const NCollection_Array1<int>&                                   theModes,
+  const NCollection_Array1<int>&                                   theGroups)
+{
+  if (theObjects.IsEmpty())
+  {
+    return;
+  }
+
+  // create and clear presentations on the calling thread;
+  // only new presentations of objects without children are computed in background,
+  // as displayed presentations are accessed by rendering
+  NCollection_Array1<occ::handle<PrsMgr_Presentation>> aPrsList(0, theObjects.Size() - 1);
+  NCollection_Array1<occ::handle<PrsMgr_Presentation>> anAsyncList(0, theObjects.Size() - 1);
+  NCollection_Array1<int>                              aGroupLowers(0, theObjects.Size());
+  int                                                  aNbGroups = 0;
+  bool                                                 hasAsync  = false;
+  for (int anIter = 0; anIter < theObjects.Size(); ++anIter)
+  {
+    const int anObjIndex = theObjects.Lower() + anIter;
+    if (anIter == 0 || theGroups.Value(anObjIndex) != theGroups.Value(anObjIndex - 1))
+    {
+      aGroupLowers.SetValue(aNbGroups++, anIter);
+    }
+
+    const occ::handle<PrsMgr_PresentableObject>& aPrsObj = theObjects.Value(anObjIndex);
+    if (aPrsObj.IsNull() || !aPrsObj->HasOwnPresentations())
+    {
+      continue;
+    }
+
+    syncPending(aPrsObj);
+    const int                        aMode = theModes.Value(anObjIndex);
+    occ::handle<PrsMgr_Presentation> aPrs  = Presentation(aPrsObj, aMode, false);
+    if (aPrs.IsNull())
+    {
+      aPrs = newPresentation(aPrsObj, aMode, occ::handle<PrsMgr_PresentableObject>());
+      if (myToComputeAsync && aPrsObj->Children().IsEmpty())
+      {
+        occ::handle<Prs3d_Presentation> aProxy = new Prs3d_Presentation(myStructureManager);
+        aPrsObj->ComputeProxy(this, aProxy, aMode);
+        if (aProxy->NumberOfGroups() > 0)
+        {
+          aProxy->SetZLayer(aPrsObj->ZLayer());
+          aProxy->CStructure()->ViewAffinity = aPrsObj->ViewAffinity();
+          aProxy->SetTransformation(aPrsObj->TransformationGeom());
+          aProxy->SetClipPlanes(aPrsObj->ClipPlanes());
+          aProxy->SetTransformPersistence(aPrsObj->TransformPersistence());
+          aProxy->Display();
+        }
+        else
+        {
+          aProxy.Nullify();
+        }
+        myPendingPrs.Bind(aPrs, aProxy);
+        anAsyncList.SetValue(anIter, aPrs);
+        hasAsync = true;
+        continue;
+      }
+    }
+    else if (!aPrs->MustBeUpdated())
+    {
+      continue;
+    }
+    else if (myToComputeAsync && aPrsObj->Children().IsEmpty() && aPrs->IsDisplayed())
+    {
+      // compute the new content into a shadow structure, keeping the outdated one displayed
+      occ::handle<PrsMgr_Presentation> aShadowPrs = new PrsMgr_Presentation(this, aPrsObj, aMode);
+      aShadowPrs->SetZLayer(aPrs->GetZLayer());
+      aShadowPrs->CStructure()->ViewAffinity = aPrs->CStructure()->ViewAffinity;
+      myShadowPrs.Bind(aPrs, aShadowPrs);
+      anAsyncList.SetValue(anIter, aShadowPrs);
+      hasAsync = true;
+      continue;
+    }
+    else
+    {
+      aPrs->Clear();
+    }
+    aPrsList.SetValue(anIter, aPrs);
+  }
+  aGroupLowers.SetValue(aNbGroups, theObjects.Size());
+  aGroupLowers.Resize(0, aNbGroups, true);
+
+  if (hasAsync)
+  {
+    if (myComputeQueue.IsNull())
+    {
+      myComputeQueue = new PrsMgr_ComputeQueue();
+    }
+    myComputeQueue->Add(anAsyncList, aGroupLowers);
+  }
+
+  // compute presentations by worker threads
+  myStructureManager->SetDeferredUpdate(true);
+  try
+  {
+    PrsMgr_ComputeQueue::Perform(aPrsList, aGroupLowers);
+  }
+  catch (...)
+  {
+    myStructureManager->SetDeferredUpdate(false);
+    throw;
+  }
+  myStructureManager->SetDeferredUpdate(false);
+
+  // finalize and display presentations on the calling thread
+  for (int anIter = 0; anIter < theObjects.Size(); ++anIter)
+  {
+    const int                                    anObjIndex = theObjects.Lower() + anIter;
+    const occ::handle<PrsMgr_PresentableObject>& aPrsObj    = theObjects.Value(anObjIndex);
+    if (aPrsObj.IsNull() || !anAsyncList.Value(anIter).IsNull())
+    {
+      continue;
+    }
+
+    if (const occ::handle<PrsMgr_Presentation>& aPrs = aPrsList.Value(anIter))
+    {
+      finalizePresentation(aPrs);
+    }
+    Display(aPrsObj, theModes.Value(anObjIndex));
+  }
+}
+
+//=================================================================================================
+
+void PrsMgr_PresentationManager::finalizePresentation(const occ::handle<PrsMgr_Presentation>& thePrs)
+{
+  const PrsMgr_PresentableObject* aPrsObj = thePrs->myPresentableObject;
+  thePrs->SetTransformation(aPrsObj->TransformationGeom());
+  thePrs->SetClipPlanes(aPrsObj->ClipPlanes());
+  thePrs->SetTransformPersistence(aPrsObj->TransformPersistence());
+  thePrs->SetUpdateStatus(false);
+}
+
+//=================================================================================================
+
+int PrsMgr_PresentationManager::UpdatePendingPresentations(const bool theToWait)
+{
+  if (myPendingPrs.IsEmpty() && myShadowPrs.IsEmpty())
+  {
+    return 0;
+  }
+
+  if (theToWait)
+  {
+    myComputeQueue->Wait();
+  }
+
+  NCollection_List<occ::handle<PrsMgr_Presentation>> aDoneList;
+  if (!myComputeQueue->Fetch(aDoneList))
+  {
+    return 0;
+  }
+
+  int aNbDisplayed = 0;
+  for (NCollection_List<occ::handle<PrsMgr_Presentation>>::Iterator aPrsIter(aDoneList);
+       aPrsIter.More();
+       aPrsIter.Next())
+  {
+    const occ::handle<PrsMgr_Presentation>& aPrs = aPrsIter.Value();
+    occ::handle<Prs3d_Presentation>         aProxy;
+    if (!myPendingPrs.Find(aPrs, aProxy))
+    {
+      aNbDisplayed += swapShadowPresentation(aPrs) ? 1 : 0;
+      continue;
+    }
+
+    myPendingPrs.UnBind(aPrs);
+    if (!aProxy.IsNull())
+    {
+      aProxy->Erase();
+      aProxy->Clear();
+      aProxy->Remove();
+    }
+
+    // presentation might have been removed while being computed
+    occ::handle<PrsMgr_PresentableObject> aPrsObj = aPrs->myPresentableObject;
+    if (aPrs->IsDeleted() || Presentation(aPrsObj, aPrs->Mode()) != aPrs)
+    {
+      continue;
+    }
+
+    finalizePresentation(aPrs);
+    if (aPrsObj->DisplayStatus() != PrsMgr_DisplayStatus_Erased)
+    {
+      Display(aPrsObj, aPrs->Mode());
+      ++aNbDisplayed;
+    }
+  }
+  myStructureManager->Update();
+  return aNbDisplayed;
+}
+
+//=================================================================================================
+
+bool PrsMgr_PresentationManager::swapShadowPresentation(
+  const occ::handle<PrsMgr_Presentation>& theShadowPrs)
+{
+  occ::handle<PrsMgr_PresentableObject> aPrsObj = theShadowPrs->myPresentableObject;
+  NCollection_Sequence<occ::handle<PrsMgr_Presentation>>& aPrsList = aPrsObj->Presentations();
+  for (NCollection_Sequence<occ::handle<PrsMgr_Presentation>>::Iterator aPrsIter(aPrsList);
+       aPrsIter.More();
+       aPrsIter.Next())
+  {
+    const occ::handle<PrsMgr_Presentation> anOldPrs = aPrsIter.Value();
+    const occ::handle<PrsMgr_Presentation>* aShadowPrs = myShadowPrs.Seek(anOldPrs);
+    if (aShadowPrs == nullptr || *aShadowPrs != theShadowPrs)
+    {
+      continue;
+    }
+
+    myShadowPrs.UnBind(anOldPrs);
+    finalizePresentation(theShadowPrs);
+    theShadowPrs->SetDisplayPriority(anOldPrs->DisplayPriority());
+    aPrsIter.ChangeValue() = theShadowPrs;
+
+    // display the new structure before removing the old one within the same frame;
+    // graphic resources of the old structure are released by the driver once unused
+    const bool isDisplayed = anOldPrs->IsDisplayed();
+    if (isDisplayed)
+    {
+      theShadowPrs->Display();
+      if (!anOldPrs->IsVisible())
+      {
+        theShadowPrs->SetVisible(false);
+      }
+    }
+    if (anOldPrs->IsHighlighted())
+    {
+      if (occ::handle<Prs3d_Drawer> aStyle =
+            occ::down_cast<Prs3d_Drawer>(anOldPrs->HighlightStyle()))
+      {
+        theShadowPrs->Highlight(aStyle);
+      }
+    }
+    anOldPrs->Erase();
+    anOldPrs->Clear();
+    anOldPrs->Remove();
+    return isDisplayed;
+  }
+
+  // the presentation has been removed while being computed
+  theShadowPrs->Clear();
+  theShadowPrs->Remove();
+  return false;
+}
+
+//=================================================================================================
+
+bool PrsMgr_PresentationManager::HasPendingPresentation(
+  const occ::handle<PrsMgr_PresentableObject>& thePrsObj) const
+{
+  if (myPendingPrs.IsEmpty() && myShadowPrs.IsEmpty())
+  {
+    return false;
+  }
+
+  for (NCollection_Sequence<occ::handle<PrsMgr_Presentation>>::Iterator aPrsIter(
+         thePrsObj->Presentations());
+       aPrsIter.More();
+       aPrsIter.Next())
+  {
+    if (myPendingPrs.IsBound(aPrsIter.Value()) || myShadowPrs.IsBound(aPrsIter.Value()))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+//=================================================================================================
+
+void PrsMgr_PresentationManager::syncPending(
+  const occ::handle<PrsMgr_PresentableObject>& thePrsObj) const
+{
+  if (HasPendingPresentation(thePrsObj))
+  {
+    const_cast<PrsMgr_PresentationManager*>(this)->UpdatePendingPresentations(true);
+  }
+}
+
 //=================================================================================================
 
 void PrsMgr_PresentationManager::Erase(const occ::handle<PrsMgr_PresentableObject>& thePrsObj,
                                        const int                                    theMode)
 {
+  syncPending(thePrsObj);
   if (thePrsObj->ToPropagateVisualState())
   {
     for (NCollection_List<occ::handle<PrsMgr_PresentableObject>>::Iterator anIter(
@@ -128,6 +425,7 @@ void PrsMgr_PresentationManager::Erase(const occ::handle<PrsMgr_PresentableObjec
 void PrsMgr_PresentationManager::Clear(const occ::handle<PrsMgr_PresentableObject>& thePrsObj,
                                        const int                                    theMode)
 {
+  syncPending(thePrsObj);
   if (thePrsObj->ToPropagateVisualState())
   {
     for (NCollection_List<occ::handle<PrsMgr_PresentableObject>>::Iterator anIter(
@@ -153,6 +451,7 @@ void PrsMgr_PresentationManager::SetVisibility(
   const int                                    theMode,
   const bool                                   theValue)
 {
+  syncPending(thePrsObj);
   if (thePrsObj->ToPropagateVisualState())
   {
     for (NCollection_List<occ::handle<PrsMgr_PresentableObject>>::Iterator anIter(
@@ -183,6 +482,7 @@ void PrsMgr_PresentationManager::SetVisibility(
 
 void PrsMgr_PresentationManager::Unhighlight(const occ::handle<PrsMgr_PresentableObject>& thePrsObj)
 {
+  syncPending(thePrsObj);
   if (thePrsObj->ToPropagateVisualState())
   {
     for (NCollection_List<occ::handle<PrsMgr_PresentableObject>>::Iterator anIter(
@@ -216,6 +516,7 @@ void PrsMgr_PresentationManager::SetDisplayPriority(
   const int                                    theMode,
   const Graphic3d_DisplayPriority              theNewPrior) const
 {
+  syncPending(thePrsObj);
   if (thePrsObj->ToPropagateVisualState())
   {
     for (NCollection_List<occ::handle<PrsMgr_PresentableObject>>::Iterator anIter(
@@ -311,6 +612,7 @@ bool PrsMgr_PresentationManager::IsHighlighted(
 void PrsMgr_PresentationManager::Update(const occ::handle<PrsMgr_PresentableObject>& thePrsObj,
                                         const int                                    theMode) const
 {
+  syncPending(thePrsObj);
   for (NCollection_List<occ::handle<PrsMgr_PresentableObject>>::Iterator anIter(
          thePrsObj->Children());
        anIter.More();
@@ -539,15 +841,26 @@ occ::handle<PrsMgr_Presentation> PrsMgr_PresentationManager::Presentation(
     return occ::handle<PrsMgr_Presentation>();
   }
 
+  occ::handle<PrsMgr_Presentation> aPrs = newPresentation(thePrsObj, theMode, theSelObj);
+  thePrsObj->Fill(this, aPrs, theMode);
+
+  // set layer index accordingly to object's presentations
+  aPrs->SetUpdateStatus(false);
+  return aPrs;
+}
+
+//=================================================================================================
+
+occ::handle<PrsMgr_Presentation> PrsMgr_PresentationManager::newPresentation(
+  const occ::handle<PrsMgr_PresentableObject>& thePrsObj,
+  const int                                    theMode,
+  const occ::handle<PrsMgr_PresentableObject>& theSelObj) const
+{
   occ::handle<PrsMgr_Presentation> aPrs = new PrsMgr_Presentation(this, thePrsObj, theMode);
   aPrs->SetZLayer(thePrsObj->ZLayer());
   aPrs->CStructure()->ViewAffinity =
     !theSelObj.IsNull() ? theSelObj->ViewAffinity() : thePrsObj->ViewAffinity();
   thePrsObj->Presentations().Append(aPrs);
-  thePrsObj->Fill(this, aPrs, theMode);
-
-  // set layer index accordingly to object's presentations
-  aPrs->SetUpdateStatus(false);
   return aPrs;
 }
 
@@ -557,6 +870,7 @@ bool PrsMgr_PresentationManager::RemovePresentation(
   const occ::handle<PrsMgr_PresentableObject>& thePrsObj,
   const int                                    theMode)
 {
+  syncPending(thePrsObj);
   NCollection_Sequence<occ::handle<PrsMgr_Presentation>>& aPrsList = thePrsObj->Presentations();
   for (NCollection_Sequence<occ::handle<PrsMgr_Presentation>>::Iterator aPrsIter(aPrsList);
        aPrsIter.More();
@@ -578,6 +892,7 @@ bool PrsMgr_PresentationManager::RemovePresentation(
 void PrsMgr_PresentationManager::SetZLayer(const occ::handle<PrsMgr_PresentableObject>& thePrsObj,
                                            const Graphic3d_ZLayerId                     theLayerId)
 {
+  syncPending(thePrsObj);
   if (thePrsObj->ToPropagateVisualState())
   {
     for (NCollection_List<occ::handle<PrsMgr_PresentableObject>>::Iterator anIter(
@@ -613,6 +928,8 @@ void PrsMgr_PresentationManager::Connect(
   const int                                    theMode,
   const int                                    theOtherMode)
 {
+  syncPending(thePrsObject);
+  syncPending(theOtherObject);
   occ::handle<PrsMgr_Presentation> aPrs      = Presentation(thePrsObject, theMode, true);
   occ::handle<PrsMgr_Presentation> aPrsOther = Presentation(theOtherObject, theOtherMode, true);
   aPrs->Connect(aPrsOther.get(), Graphic3d_TOC_DESCENDANT);
@@ -624,6 +941,7 @@ void PrsMgr_PresentationManager::Transform(const occ::handle<PrsMgr_PresentableO
                                            const occ::handle<TopLoc_Datum3D>& theTransformation,
                                            const int                          theMode)
 {
+  syncPending(thePrsObj);
   Presentation(thePrsObj, theMode)->SetTransformation(theTransformation);
 }
 
@@ -635,6 +953,7 @@ void PrsMgr_PresentationManager::Color(const occ::handle<PrsMgr_PresentableObjec
                                        const occ::handle<PrsMgr_PresentableObject>& theSelObj,
                                        const int theImmediateStructLayerId)
 {
+  syncPending(thePrsObj);
   if (thePrsObj->ToPropagateVisualState())
   {
     for (NCollection_List<occ::handle<PrsMgr_PresentableObject>>::Iterator anIter(
@@ -715,6 +1034,8 @@ void PrsMgr_PresentationManager::UpdateHighlightTrsf(
   if (theObj.IsNull())
     return;
 
+  syncPending(theObj);
+
   occ::handle<PrsMgr_Presentation> aPrs =
     Presentation(!theSelObj.IsNull() ? theSelObj : theObj, theMode, false);
   if (aPrs.IsNull())
@@ -19,6 +19,8 @@
 
 #include <Graphic3d_StructureManager.hxx>
 #include <Graphic3d_ZLayerId.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_DataMap.hxx>
 #include <NCollection_List.hxx>
 #include <Prs3d_Presentation.hxx>
 
@@ -27,6 +29,7 @@ typedef Graphic3d_Structure Prs3d_Presentation;
 
 class TopLoc_Datum3D;
 class Prs3d_Drawer;
+class PrsMgr_ComputeQueue;
 class PrsMgr_Presentation;
 class PrsMgr_PresentableObject;
 class V3d_Viewer;
@@ -45,11 +48,55 @@ public:
   Standard_EXPORT PrsMgr_PresentationManager(
     const occ::handle<Graphic3d_StructureManager>& theStructureManager);
 
+  //! Destructor, stops background computation of presentations.
+  Standard_EXPORT ~PrsMgr_PresentationManager() override;
+
   //! Displays the presentation of the object in the given Presentation manager with the given mode.
   //! The mode should be enumerated by the object which inherits PresentableObject.
   Standard_EXPORT void Display(const occ::handle<PrsMgr_PresentableObject>& thePrsObject,
                                const int                                    theMode = 0);
 
+  //! Displays presentations of the objects with the given modes (theModes has the same bounds as
+  //! theObjects), computing missing and outdated presentations by OSD_ThreadPool worker threads.
+  //! Presentation structures are created, cleared and displayed by the calling thread,
+  //! while worker threads call only PrsMgr_PresentableObject::Compute(); layers invalidation
+  //! is deferred till the end (see Graphic3d_StructureManager::SetDeferredUpdate()).
+  //! Adjacent objects with equal values in theGroups are computed one after another by the same
+  //! thread, which is required for objects modifying shared data within Compute() (like shapes
+  //! sharing sub-shapes, which triangulation is (re)computed).
+  Standard_EXPORT void Display(
+    const NCollection_Array1<occ::handle<PrsMgr_PresentableObject>>& theObjects,
+    const NCollection_Array1<int>&                                   theModes,
+    const NCollection_Array1<int>&                                   theGroups);
+
+  //! Returns TRUE if Display() of objects array computes new presentations in background;
+  //! FALSE by default.
+  bool ToComputeAsync() const { return myToComputeAsync; }
+
+  //! Sets if Display() of objects array should compute new presentations of objects without
+  //! children in background (see PrsMgr_ComputeQueue) instead of waiting for their computation.
+  //! A proxy (see PrsMgr_PresentableObject::ComputeProxy()) is displayed in the meantime,
+  //! and computed presentations replace proxies within UpdatePendingPresentations().
+  //! Outdated displayed presentations of such objects are double-buffered: the new content is
+  //! computed into a shadow structure while the outdated one remains displayed, and
+  //! UpdatePendingPresentations() swaps them, releasing the outdated structure.
+  //! Methods of this manager called for an object with pending presentation wait for its
+  //! computation; the object itself should not be modified till then.
+  void SetComputeAsync(const bool theToCompute) { myToComputeAsync = theToCompute; }
+
+  //! Returns the number of presentations being computed in background.
+  int NbPendingPresentations() const { return myPendingPrs.Extent() + myShadowPrs.Extent(); }
+
+  //! Returns TRUE if some presentation of the object is being computed in background.
+  Standard_EXPORT bool HasPendingPresentation(
+    const occ::handle<PrsMgr_PresentableObject>& thePrsObject) const;
+
+  //! Displays presentations computed in background since the previous call, replacing proxies
+  //! and outdated presentations.
+  //! @param[in] theToWait wait for all pending presentations to be computed
+  //! @return the number of displayed presentations
+  Standard_EXPORT int UpdatePendingPresentations(const bool theToWait);
+
   //! erases the presentation of the object in the given
   //! Presentation manager with the given mode.
   //! If @theMode is -1, then erases all presentations of the object.
@@ -190,6 +237,22 @@ protected:
                                           const int                                    theMode = 0);
 
 private:
+  //! Creates empty presentation of the object without computing it.
+  occ::handle<PrsMgr_Presentation> newPresentation(
+    const occ::handle<PrsMgr_PresentableObject>& thePrsObject,
+    const int                                    theMode,
+    const occ::handle<PrsMgr_PresentableObject>& theSelObj) const;
+
+  //! Sets transformation, clipping and update status of computed presentation.
+  void finalizePresentation(const occ::handle<PrsMgr_Presentation>& thePrs);
+
+  //! Replaces the outdated presentation by its shadow computed in background.
+  //! @return TRUE if the new presentation has been displayed
+  bool swapShadowPresentation(const occ::handle<PrsMgr_Presentation>& theShadowPrs);
+
+  //! Waits for pending presentations, if the object has some.
+  void syncPending(const occ::handle<PrsMgr_PresentableObject>& thePrsObj) const;
+
   //! Handles the structures from <myImmediateList> and displays it separating view-dependent
   //! structures and taking into account structure visibility by setting proper affinity.
   void displayImmediate(const occ::handle<V3d_Viewer>& theViewer);
@@ -199,6 +262,12 @@ protected:
   int                                               myImmediateModeOn;
   NCollection_List<occ::handle<Prs3d_Presentation>> myImmediateList;
   NCollection_List<occ::handle<Prs3d_Presentation>> myViewDependentImmediateList;
+  occ::handle<PrsMgr_ComputeQueue>                  myComputeQueue; //!< background computation
+  // clang-format off
+  NCollection_DataMap<occ::handle<PrsMgr_Presentation>, occ::handle<Prs3d_Presentation>> myPendingPrs; //!< pending presentations with their proxies
+  NCollection_DataMap<occ::handle<PrsMgr_Presentation>, occ::handle<PrsMgr_Presentation>> myShadowPrs;  //!< outdated presentations with their shadows being computed
+  // clang-format on
+  bool myToComputeAsync; //!< flag to compute new presentations in background
 };
 
 #endif // _PrsMgr_PresentationManager_HeaderFile
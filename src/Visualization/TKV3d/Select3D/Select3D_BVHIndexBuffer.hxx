@@ -17,6 +17,7 @@
 #define _Select3D_BVHIndexBuffer_Header
 
 #include <Graphic3d_Buffer.hxx>
+#include <OSD_MemInfo.hxx>
 
 //! Index buffer for BVH tree.
 class Select3D_BVHIndexBuffer : public Graphic3d_Buffer
@@ -29,11 +30,18 @@ public:
   {
   }
 
+  //! Destructor.
+  ~Select3D_BVHIndexBuffer() override
+  {
+    OSD_MemInfo::AddTaggedMemory(OSD_MemInfo::MemTag_Select3D, -int64_t(Size()));
+  }
+
   bool HasPatches() const { return myHasPatches; }
 
   //! Allocates new empty index array
   bool Init(const int theNbElems, const bool theHasPatches)
   {
+    OSD_MemInfo::AddTaggedMemory(OSD_MemInfo::MemTag_Select3D, -int64_t(Size()));
     release();
     Stride       = sizeof(unsigned int);
     myHasPatches = theHasPatches;
@@ -49,6 +57,7 @@ public:
       release();
       return false;
     }
+    OSD_MemInfo::AddTaggedMemory(OSD_MemInfo::MemTag_Select3D, int64_t(Size()));
     return true;
   }
 
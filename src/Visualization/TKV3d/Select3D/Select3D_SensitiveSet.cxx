@@ -93,8 +93,27 @@ bool Select3D_SensitiveSet::processElements(SelectBasics_SelectingVolumeManager&
                                             int&                     theMatchesNb)
 {
   SelectBasics_PickResult aPickResult;
+  int                     aBatchMask = 0;
   for (int anIdx = theFirstElem; anIdx <= theLastElem; anIdx++)
   {
+    // reject elements in batches, unless the whole node is inside selecting volume
+    const int aBatchLane = (anIdx - theFirstElem) % SelectBasics_TriangleBatch::Size;
+    if (aBatchLane == 0 && !theIsFullInside)
+    {
+      aBatchMask =
+        filterElements(theMgr,
+                       anIdx,
+                       std::min(theLastElem - anIdx + 1, SelectBasics_TriangleBatch::Size));
+    }
+    if (!theIsFullInside && (aBatchMask & (1 << aBatchLane)) == 0)
+    {
+      if (!theMgr.IsOverlapAllowed() && !theToCheckAllInside)
+      {
+        return false;
+      }
+      continue;
+    }
+
     if (!theMgr.IsOverlapAllowed()) // inclusion test
     {
       if (!elementIsInside(theMgr, anIdx, theIsFullInside))
@@ -127,6 +146,102 @@ bool Select3D_SensitiveSet::processElements(SelectBasics_SelectingVolumeManager&
 
 //=================================================================================================
 
+template <class T>
+bool Select3D_SensitiveSet::traverseBVH(SelectBasics_SelectingVolumeManager&  theMgr,
+                                        const BVH_Tree<T, 3, BVH_BinaryTree>& theBVH,
+                                        const int                             theLeafScale,
+                                        const bool                            theToCheckFullInside,
+                                        const bool                            theToCheckAllInside,
+                                        SelectBasics_PickResult&              thePickResult,
+                                        int&                                  theMatchesNb)
+{
+  NodeInStack aStack[BVH_Constants_MaxTreeDepth];
+  NodeInStack aNode;
+
+  int aHead = -1;
+
+  for (;;)
+  {
+    const BVH_Vec4i& aData = theBVH.NodeInfoBuffer()[aNode.Id];
+
+    if (aData.x() == 0) // is inner node
+    {
+      NodeInStack aLeft(aData.y(), theToCheckFullInside), aRight(aData.z(), theToCheckFullInside);
+      bool        toCheckLft = true, toCheckRgh = true;
+      if (!aNode.IsFullInside)
+      {
+        toCheckLft = theMgr.OverlapsBox(NCollection_Vec3<double>(theBVH.MinPoint(aLeft.Id)),
+                                        NCollection_Vec3<double>(theBVH.MaxPoint(aLeft.Id)),
+                                        theToCheckFullInside ? &aLeft.IsFullInside : nullptr);
+        if (!toCheckLft)
+        {
+          aLeft.IsFullInside = false;
+        }
+
+        toCheckRgh = theMgr.OverlapsBox(NCollection_Vec3<double>(theBVH.MinPoint(aRight.Id)),
+                                        NCollection_Vec3<double>(theBVH.MaxPoint(aRight.Id)),
+                                        theToCheckFullInside ? &aRight.IsFullInside : nullptr);
+        if (!toCheckRgh)
+        {
+          aRight.IsFullInside = false;
+        }
+      }
+
+      if (!theMgr.IsOverlapAllowed()) // inclusion test
+      {
+        if (!theToCheckAllInside)
+        {
+          if (!toCheckLft || !toCheckRgh)
+          {
+            return false; // no inclusion
+          }
+
+          // skip extra checks
+          toCheckLft &= !aLeft.IsFullInside;
+          toCheckRgh &= !aRight.IsFullInside;
+        }
+      }
+
+      if (toCheckLft || toCheckRgh)
+      {
+        aNode = toCheckLft ? aLeft : aRight;
+        if (toCheckLft && toCheckRgh)
+        {
+          aStack[++aHead] = aRight;
+        }
+      }
+      else
+      {
+        if (aHead < 0)
+          break;
+
+        aNode = aStack[aHead--];
+      }
+    }
+    else
+    {
+      if (!processElements(theMgr,
+                           aData.y() * theLeafScale,
+                           (aData.z() + 1) * theLeafScale - 1,
+                           aNode.IsFullInside,
+                           theToCheckAllInside,
+                           thePickResult,
+                           theMatchesNb))
+      {
+        return false;
+      }
+
+      if (aHead < 0)
+        break;
+
+      aNode = aStack[aHead--];
+    }
+  }
+  return true;
+}
+
+//=================================================================================================
+
 bool Select3D_SensitiveSet::matches(SelectBasics_SelectingVolumeManager& theMgr,
                                     SelectBasics_PickResult&             thePickResult,
                                     bool                                 theToCheckAllInside)
@@ -163,92 +278,75 @@ bool Select3D_SensitiveSet::matches(SelectBasics_SelectingVolumeManager& theMgr,
       return false;
     }
   }
-  else
+  else if (!traverseBVH(theMgr,
+                        *myContent.GetBVH(),
+                        1,
+                        toCheckFullInside,
+                        theToCheckAllInside,
+                        thePickResult,
+                        aMatchesNb))
   {
-    const BVH_Tree<double, 3, BVH_BinaryTree>* aBVH = myContent.GetBVH().get();
-    NodeInStack                                aStack[BVH_Constants_MaxTreeDepth];
-    NodeInStack                                aNode;
-
-    int aHead = -1;
+    return false;
+  }
 
-    for (;;)
-    {
-      const BVH_Vec4i& aData = aBVH->NodeInfoBuffer()[aNode.Id];
+  if (aMatchesNb != -1)
+  {
+    thePickResult.SetDistToGeomCenter(distanceToCOG(theMgr));
+  }
 
-      if (aData.x() == 0) // is inner node
-      {
-        NodeInStack aLeft(aData.y(), toCheckFullInside), aRight(aData.z(), toCheckFullInside);
-        bool        toCheckLft = true, toCheckRgh = true;
-        if (!aNode.IsFullInside)
-        {
-          toCheckLft = theMgr.OverlapsBox(aBVH->MinPoint(aLeft.Id),
-                                          aBVH->MaxPoint(aLeft.Id),
-                                          toCheckFullInside ? &aLeft.IsFullInside : nullptr);
-          if (!toCheckLft)
-          {
-            aLeft.IsFullInside = false;
-          }
+  return aMatchesNb != -1 || (!theToCheckAllInside && !theMgr.IsOverlapAllowed());
+}
 
-          toCheckRgh = theMgr.OverlapsBox(aBVH->MinPoint(aRight.Id),
-                                          aBVH->MaxPoint(aRight.Id),
-                                          toCheckFullInside ? &aRight.IsFullInside : nullptr);
-          if (!toCheckRgh)
-          {
-            aRight.IsFullInside = false;
-          }
-        }
+//=================================================================================================
 
-        if (!theMgr.IsOverlapAllowed()) // inclusion test
-        {
-          if (!theToCheckAllInside)
-          {
-            if (!toCheckLft || !toCheckRgh)
-            {
-              return false; // no inclusion
-            }
-
-            // skip extra checks
-            toCheckLft &= !aLeft.IsFullInside;
-            toCheckRgh &= !aRight.IsFullInside;
-          }
-        }
+bool Select3D_SensitiveSet::matches(SelectBasics_SelectingVolumeManager& theMgr,
+                                    SelectBasics_PickResult&             thePickResult,
+                                    bool                                 theToCheckAllInside,
+                                    const BVH_Tree<float, 3>&            theBVH,
+                                    const int                            theLeafScale,
+                                    const int                            theNbElems)
+{
+  myDetectedIdx = -1;
 
-        if (toCheckLft || toCheckRgh)
-        {
-          aNode = toCheckLft ? aLeft : aRight;
-          if (toCheckLft && toCheckRgh)
-          {
-            aStack[++aHead] = aRight;
-          }
-        }
-        else
-        {
-          if (aHead < 0)
-            break;
+  if (theNbElems < 1 || theBVH.Length() < 1)
+  {
+    return false;
+  }
 
-          aNode = aStack[aHead--];
-        }
-      }
-      else
-      {
-        if (!processElements(theMgr,
-                             aData.y(),
-                             aData.z(),
-                             aNode.IsFullInside,
-                             theToCheckAllInside,
-                             thePickResult,
-                             aMatchesNb))
-        {
-          return false;
-        }
+  bool isFullInside = true;
+  if (!theMgr.OverlapsBox(NCollection_Vec3<double>(theBVH.MinPoint(0)),
+                          NCollection_Vec3<double>(theBVH.MaxPoint(0)),
+                          &isFullInside))
+  {
+    return false;
+  }
 
-        if (aHead < 0)
-          break;
+  int aMatchesNb = -1;
 
-        aNode = aStack[aHead--];
-      }
+  const bool toCheckFullInside = (theMgr.GetActiveSelectionType() != SelectMgr_SelectionType_Point);
+  if (toCheckFullInside && isFullInside)
+  {
+    if (!processElements(theMgr,
+                         0,
+                         theNbElems - 1,
+                         true,
+                         theToCheckAllInside,
+                         thePickResult,
+                         aMatchesNb))
+    {
+      return false;
     }
   }
+  else if (!traverseBVH(theMgr,
+                        theBVH,
+                        theLeafScale,
+                        toCheckFullInside,
+                        theToCheckAllInside,
+                        thePickResult,
+                        aMatchesNb))
+  {
+    return false;
+  }
 
   if (aMatchesNb != -1)
   {
@@ -84,6 +84,11 @@ public:
   //! at the next call of BVH()
   void MarkDirty() { myContent.MarkDirty(); }
 
+  //! Updates bounding boxes of BVH tree nodes from the current boxes of sub-elements
+  //! without rebuilding the tree, e.g. after slight deformation of the set;
+  //! does nothing if the tree is marked as outdated and will be rebuilt anyway.
+  void RefitBVH() { myContent.Refit(); }
+
   //! Returns bounding box of the whole set.
   //! This method should be redefined in Select3D_SensitiveSet descendants
   Standard_EXPORT Select3D_BndBox3d BoundingBox() override;
@@ -115,6 +120,20 @@ protected:
                                SelectBasics_PickResult&             thePickResult,
                                bool                                 theToCheckAllInside);
 
+  //! Checks whether one or more entities of the set overlap current selecting volume
+  //! traversing the given BVH tree with single-precision node boxes instead of the own one.
+  //! @param theBVH BVH tree built for groups of elements, e.g. fixed-size patches
+  //! @param theLeafScale number of elements in a group - leaf node with primitive range
+  //!                     [first, last] refers to elements [first * theLeafScale,
+  //!                     (last + 1) * theLeafScale - 1]
+  //! @param theNbElems number of elements addressed by the tree
+  Standard_EXPORT bool matches(SelectBasics_SelectingVolumeManager& theMgr,
+                               SelectBasics_PickResult&             thePickResult,
+                               bool                                 theToCheckAllInside,
+                               const BVH_Tree<float, 3>&            theBVH,
+                               const int                            theLeafScale,
+                               const int                            theNbElems);
+
   //! Checks whether the entity with index theIdx (partially) overlaps the current selecting volume.
   //! @param[out] thePickResult  picking result, should update minimum depth
   //! @param[in] theMgr  selection manager
@@ -143,6 +162,23 @@ protected:
   //! geometry
   virtual double distanceToCOG(SelectBasics_SelectingVolumeManager& theMgr) = 0;
 
+  //! Performs cheap rejection of a batch of elements before calling ::overlapsElement()
+  //! or ::elementIsInside() for each of them (see SelectBasics_TriangleBatch).
+  //! @param[in] theMgr  selection manager
+  //! @param[in] theFirstElem  index of the first element within BVH tree to check
+  //! @param[in] theElemsNb  number of elements to check, up to SelectBasics_TriangleBatch::Size
+  //! @return bit mask of elements which might overlap selecting volume;
+  //!         elements with unset bits are guaranteed to be outside of it.
+  //!         Default implementation keeps all elements.
+  virtual int filterElements(SelectBasics_SelectingVolumeManager& theMgr,
+                             int                                  theFirstElem,
+                             int                                  theElemsNb)
+  {
+    (void)theMgr;
+    (void)theFirstElem;
+    return (1 << theElemsNb) - 1;
+  }
+
   //! Process elements overlapped by the selection volume
   //! @param theMgr selection manager
   //! @param theFirstElem index of the first element
@@ -161,6 +197,18 @@ protected:
                                        SelectBasics_PickResult&             thePickResult,
                                        int&                                 theMatchesNb);
 
+private:
+  //! Traverses BVH tree and processes elements of leaves overlapped by the selection volume.
+  //! @return FALSE if some element is outside the selection volume (if IsOverlapAllowed is FALSE)
+  template <class T>
+  bool traverseBVH(SelectBasics_SelectingVolumeManager&  theMgr,
+                   const BVH_Tree<T, 3, BVH_BinaryTree>& theBVH,
+                   const int                             theLeafScale,
+                   const bool                            theToCheckFullInside,
+                   const bool                            theToCheckAllInside,
+                   SelectBasics_PickResult&              thePickResult,
+                   int&                                  theMatchesNb);
+
 protected:
   //! The purpose of this class is to provide a link between BVH_PrimitiveSet
   //! and Select3D_SensitiveSet instance to build BVH tree for set of sensitives.
@@ -16,6 +16,7 @@
 
 #include <Select3D_SensitiveTriangulation.hxx>
 
+#include <BVH_LinearBuilder.hxx>
 #include <Poly.hxx>
 #include <Poly_Connect.hxx>
 #include <Standard_Integer.hxx>
@@ -24,6 +25,8 @@
 #include <Select3D_TypeOfSensitivity.hxx>
 
 #include <algorithm>
+#include <cmath>
+#include <limits>
 
 IMPLEMENT_STANDARD_RTTIEXT(Select3D_SensitiveTriangulation, Select3D_SensitiveSet)
 
@@ -47,6 +50,89 @@ static int NbOfFreeEdges(const occ::handle<Poly_Triangulation>& theTriangulation
   }
   return aNbFree;
 }
+
+//! Number of consecutive triangles within a patch of compact BVH tree,
+//! matching the size of batch for rejection of triangles.
+static const int THE_COMPACT_PATCH_SIZE = SelectBasics_TriangleBatch::Size;
+
+//! Returns the closest single-precision value not greater (theDir < 0) or not less than theValue.
+static float roundToFloat(const double theValue, const float theDir)
+{
+  const float aValue = static_cast<float>(theValue);
+  return (theDir < 0.0f ? double(aValue) > theValue : double(aValue) < theValue)
+           ? std::nextafter(aValue, theDir * std::numeric_limits<float>::max())
+           : aValue;
+}
+
+//! Set of patches of consecutive triangles for building single-precision BVH tree.
+//! Patch boxes are rounded outwards and kept only while the tree is being built.
+class Select3D_TrianglePatchSet : public BVH_Set<float, 3>
+{
+public:
+  //! Initializes patches of the triangulation and stores their first triangles in theIndices.
+  Select3D_TrianglePatchSet(const Poly_Triangulation& theTriangulation,
+                            Select3D_BVHIndexBuffer&  theIndices)
+      : myIndices(theIndices),
+        myBoxes(0, theIndices.NbElements - 1)
+  {
+    const int aNbTris = theTriangulation.NbTriangles();
+    for (int aPatchIter = 0; aPatchIter < theIndices.NbElements; ++aPatchIter)
+    {
+      const int aTriFrom = aPatchIter * THE_COMPACT_PATCH_SIZE;
+      const int aTriTo   = std::min(aTriFrom + THE_COMPACT_PATCH_SIZE, aNbTris);
+      BVH_Vec3d aMinPnt(RealLast()), aMaxPnt(RealFirst());
+      for (int aTriIter = aTriFrom; aTriIter < aTriTo; ++aTriIter)
+      {
+        int aNodes[3];
+        theTriangulation.Triangle(aTriIter + 1).Get(aNodes[0], aNodes[1], aNodes[2]);
+        for (int aNodeIter = 0; aNodeIter < 3; ++aNodeIter)
+        {
+          const gp_Pnt    aPnt = theTriangulation.Node(aNodes[aNodeIter]);
+          const BVH_Vec3d aVec(aPnt.X(), aPnt.Y(), aPnt.Z());
+          aMinPnt = aMinPnt.cwiseMin(aVec);
+          aMaxPnt = aMaxPnt.cwiseMax(aVec);
+        }
+      }
+
+      theIndices.SetIndex(aPatchIter, aTriFrom);
+      myBoxes.ChangeValue(aPatchIter) =
+        BVH_Box<float, 3>(BVH_Vec3f(roundToFloat(aMinPnt.x(), -1.0f),
+                                    roundToFloat(aMinPnt.y(), -1.0f),
+                                    roundToFloat(aMinPnt.z(), -1.0f)),
+                          BVH_Vec3f(roundToFloat(aMaxPnt.x(), 1.0f),
+                                    roundToFloat(aMaxPnt.y(), 1.0f),
+                                    roundToFloat(aMaxPnt.z(), 1.0f)));
+    }
+  }
+
+  //! Make inherited method Box() visible to avoid CLang warning
+  using BVH_Set<float, 3>::Box;
+
+  //! Returns the number of patches.
+  int Size() const override { return myIndices.NbElements; }
+
+  //! Returns bounding box of the patch.
+  BVH_Box<float, 3> Box(const int theIdx) const override { return myBoxes.Value(theIdx); }
+
+  //! Returns center of the patch along the given axis.
+  float Center(const int theIdx, const int theAxis) const override
+  {
+    return myBoxes.Value(theIdx).Center(theAxis);
+  }
+
+  //! Swaps two patches.
+  void Swap(const int theIdx1, const int theIdx2) override
+  {
+    std::swap(myBoxes.ChangeValue(theIdx1), myBoxes.ChangeValue(theIdx2));
+    const int aTriFrom1 = myIndices.Index(theIdx1);
+    myIndices.SetIndex(theIdx1, myIndices.Index(theIdx2));
+    myIndices.SetIndex(theIdx2, aTriFrom1);
+  }
+
+private:
+  Select3D_BVHIndexBuffer&               myIndices;
+  NCollection_Array1<BVH_Box<float, 3>> myBoxes;
+};
 } // namespace
 
 //=================================================================================================
@@ -55,11 +141,15 @@ Select3D_SensitiveTriangulation::Select3D_SensitiveTriangulation(
   const occ::handle<SelectMgr_EntityOwner>& theOwnerId,
   const occ::handle<Poly_Triangulation>&    theTrg,
   const TopLoc_Location&                    theInitLoc,
-  const bool                                theIsInterior)
+  const bool                                theIsInterior,
+  const bool                                theIsCompact)
     : Select3D_SensitiveSet(theOwnerId),
       myTriangul(theTrg),
       myInitLocation(theInitLoc),
-      myPrimitivesNb(0)
+      myPrimitivesNb(0),
+      myCompactIndices(Graphic3d_Buffer::DefaultAllocator()),
+      myCompactPatchSize(THE_COMPACT_PATCH_SIZE),
+      myIsCompact(false)
 {
   myInvInitLocation   = myInitLocation.Transformation().Inverted();
   mySensType          = theIsInterior ? Select3D_TOS_INTERIOR : Select3D_TOS_BOUNDARY;
@@ -76,10 +166,13 @@ Select3D_SensitiveTriangulation::Select3D_SensitiveTriangulation(
   }
   else
   {
-    aNbTriangles                          = myTriangul->NbTriangles();
-    myPrimitivesNb                        = theIsInterior ? aNbTriangles : NbOfFreeEdges(theTrg);
-    myBVHPrimIndexes                      = new NCollection_HArray1<int>(0, myPrimitivesNb - 1);
-    NCollection_Array1<int>& aBVHPrimIdxs = myBVHPrimIndexes->ChangeArray1();
+    aNbTriangles   = myTriangul->NbTriangles();
+    myPrimitivesNb = theIsInterior ? aNbTriangles : NbOfFreeEdges(theTrg);
+    myIsCompact    = theIsInterior && theIsCompact;
+    if (!myIsCompact)
+    {
+      myBVHPrimIndexes = new NCollection_HArray1<int>(0, myPrimitivesNb - 1);
+    }
 
     if (!theIsInterior)
     {
@@ -122,17 +215,20 @@ Select3D_SensitiveTriangulation::Select3D_SensitiveTriangulation(
       }
     }
 
-    if (theIsInterior)
+    // compact BVH tree refers to patches of consecutive triangles without permutation
+    if (theIsInterior && !myIsCompact)
     {
+      NCollection_Array1<int>& aBVHPrimIdxs = myBVHPrimIndexes->ChangeArray1();
       for (int aTriangleIdx = 1; aTriangleIdx <= aNbTriangles; ++aTriangleIdx)
       {
         aBVHPrimIdxs(aTriangleIdx - 1) = aTriangleIdx - 1;
       }
     }
-    else
+    else if (!theIsInterior)
     {
-      int aStartIdx = myFreeEdges->Lower();
-      int anEndIdx  = myFreeEdges->Upper();
+      NCollection_Array1<int>& aBVHPrimIdxs = myBVHPrimIndexes->ChangeArray1();
+      int                      aStartIdx    = myFreeEdges->Lower();
+      int                      anEndIdx     = myFreeEdges->Upper();
       for (int aFreeEdgesIdx = aStartIdx; aFreeEdgesIdx <= anEndIdx; aFreeEdgesIdx += 2)
       {
         aBVHPrimIdxs((aFreeEdgesIdx - aStartIdx) / 2) = (aFreeEdgesIdx - aStartIdx) / 2;
@@ -161,7 +257,10 @@ Select3D_SensitiveTriangulation::Select3D_SensitiveTriangulation(
       myInitLocation(theInitLoc),
       myCDG3D(theCOG),
       myFreeEdges(theFreeEdges),
-      myPrimitivesNb(0)
+      myPrimitivesNb(0),
+      myCompactIndices(Graphic3d_Buffer::DefaultAllocator()),
+      myCompactPatchSize(THE_COMPACT_PATCH_SIZE),
+      myIsCompact(false)
 {
   myInvInitLocation = myInitLocation.Transformation().Inverted();
   mySensType        = theIsInterior ? Select3D_TOS_INTERIOR : Select3D_TOS_BOUNDARY;
@@ -204,7 +303,7 @@ int Select3D_SensitiveTriangulation::Size() const
 //=======================================================================
 Select3D_BndBox3d Select3D_SensitiveTriangulation::Box(const int theIdx) const
 {
-  int                      aPrimIdx = myBVHPrimIndexes->Value(theIdx);
+  int                      aPrimIdx = primitiveIndex(theIdx);
   NCollection_Vec3<double> aMinPnt(RealLast());
   NCollection_Vec3<double> aMaxPnt(RealFirst());
 
@@ -249,7 +348,19 @@ bool Select3D_SensitiveTriangulation::Matches(SelectBasics_SelectingVolumeManage
 {
   if (myTriangul->HasGeometry())
   {
-    return Select3D_SensitiveSet::Matches(theMgr, thePickResult);
+    if (!myIsCompact)
+    {
+      return Select3D_SensitiveSet::Matches(theMgr, thePickResult);
+    }
+
+    BVH();
+    return !myCompactBVH.IsNull()
+           && matches(theMgr,
+                      thePickResult,
+                      false,
+                      *myCompactBVH,
+                      myCompactPatchSize,
+                      myCompactIndices.NbElements * myCompactPatchSize);
   }
 
   Select3D_BndBox3d aBndBox = BoundingBox();
@@ -291,6 +402,11 @@ double Select3D_SensitiveTriangulation::Center(const int theIdx, const int theAx
 //=======================================================================
 void Select3D_SensitiveTriangulation::Swap(const int theIdx1, const int theIdx2)
 {
+  if (myBVHPrimIndexes.IsNull())
+  {
+    return;
+  }
+
   int anElemIdx1 = myBVHPrimIndexes->Value(theIdx1);
   int anElemIdx2 = myBVHPrimIndexes->Value(theIdx2);
 
@@ -300,6 +416,40 @@ void Select3D_SensitiveTriangulation::Swap(const int theIdx1, const int theIdx2)
 
 //=================================================================================================
 
+void Select3D_SensitiveTriangulation::BVH()
+{
+  if (!myIsCompact)
+  {
+    Select3D_SensitiveSet::BVH();
+  }
+  else if (ToBuildBVH())
+  {
+    buildCompactBVH();
+  }
+}
+
+//=================================================================================================
+
+void Select3D_SensitiveTriangulation::buildCompactBVH()
+{
+  const int aNbPatches = (myPrimitivesNb + myCompactPatchSize - 1) / myCompactPatchSize;
+  if (!myCompactIndices.Init(aNbPatches, false))
+  {
+    return;
+  }
+
+  occ::handle<BVH_Tree<float, 3>> aBVH = new BVH_Tree<float, 3>();
+  {
+    Select3D_TrianglePatchSet   aPatchSet(*myTriangul, myCompactIndices);
+    BVH_LinearBuilder<float, 3> aBuilder(BVH_Constants_LeafNodeSizeAverage,
+                                         BVH_Constants_MaxTreeDepth);
+    aBuilder.Build(&aPatchSet, aBVH.get(), aPatchSet.Box());
+  }
+  myCompactBVH = aBVH;
+}
+
+//=================================================================================================
+
 bool Select3D_SensitiveTriangulation::LastDetectedTriangle(Poly_Triangle& theTriangle) const
 {
   const int anIndex = LastDetectedTriangleIndex();
@@ -348,7 +498,7 @@ bool Select3D_SensitiveTriangulation::overlapsElement(SelectBasics_PickResult& t
     return true;
   }
 
-  const int aPrimitiveIdx = myBVHPrimIndexes->Value(theElemIdx);
+  const int aPrimitiveIdx = primitiveIndex(theElemIdx);
   if (mySensType == Select3D_TOS_BOUNDARY)
   {
     int aSegmStartIdx = myFreeEdges->Value(aPrimitiveIdx * 2 + 1);
@@ -372,6 +522,28 @@ bool Select3D_SensitiveTriangulation::overlapsElement(SelectBasics_PickResult& t
 
 //=================================================================================================
 
+int Select3D_SensitiveTriangulation::filterElements(SelectBasics_SelectingVolumeManager& theMgr,
+                                                    int theFirstElem,
+                                                    int theElemsNb)
+{
+  if (mySensType == Select3D_TOS_BOUNDARY)
+  {
+    return (1 << theElemsNb) - 1;
+  }
+
+  SelectBasics_TriangleBatch aBatch;
+  for (int anElemIter = 0; anElemIter < theElemsNb; ++anElemIter)
+  {
+    const int aPrimitiveIdx = primitiveIndex(theFirstElem + anElemIter);
+    int       aNode1, aNode2, aNode3;
+    myTriangul->Triangle(aPrimitiveIdx + 1).Get(aNode1, aNode2, aNode3);
+    aBatch.Add(myTriangul->Node(aNode1), myTriangul->Node(aNode2), myTriangul->Node(aNode3));
+  }
+  return theMgr.FilterTriangles(aBatch);
+}
+
+//=================================================================================================
+
 bool Select3D_SensitiveTriangulation::elementIsInside(SelectBasics_SelectingVolumeManager& theMgr,
                                                       int  theElemIdx,
                                                       bool theIsFullInside)
@@ -381,7 +553,7 @@ bool Select3D_SensitiveTriangulation::elementIsInside(SelectBasics_SelectingVolu
     return true;
   }
 
-  const int aPrimitiveIdx = myBVHPrimIndexes->Value(theElemIdx);
+  const int aPrimitiveIdx = primitiveIndex(theElemIdx);
   if (mySensType == Select3D_TOS_BOUNDARY)
   {
     const gp_Pnt aSegmPnt1 = myTriangul->Node(myFreeEdges->Value(aPrimitiveIdx * 2 + 1));
@@ -425,7 +597,16 @@ double Select3D_SensitiveTriangulation::distanceToCOG(SelectBasics_SelectingVolu
 
 occ::handle<Select3D_SensitiveEntity> Select3D_SensitiveTriangulation::GetConnected()
 {
-  bool                                         isInterior = mySensType == Select3D_TOS_INTERIOR;
+  bool isInterior = mySensType == Select3D_TOS_INTERIOR;
+  if (myIsCompact)
+  {
+    return new Select3D_SensitiveTriangulation(myOwnerId,
+                                               myTriangul,
+                                               myInitLocation,
+                                               isInterior,
+                                               true);
+  }
+
   occ::handle<Select3D_SensitiveTriangulation> aNewEntity =
     new Select3D_SensitiveTriangulation(myOwnerId,
                                         myTriangul,
@@ -552,5 +733,6 @@ void Select3D_SensitiveTriangulation::DumpJson(Standard_OStream& theOStream, int
   OCCT_DUMP_FIELD_VALUES_DUMPED(theOStream, theDepth, &myInitLocation)
   OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, mySensType)
   OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, myPrimitivesNb)
+  OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, myIsCompact)
   OCCT_DUMP_FIELD_VALUES_DUMPED(theOStream, theDepth, &myBndBox)
 }
@@ -20,6 +20,7 @@
 #include <Standard_Integer.hxx>
 #include <NCollection_Array1.hxx>
 #include <NCollection_HArray1.hxx>
+#include <Select3D_BVHIndexBuffer.hxx>
 #include <Select3D_SensitiveSet.hxx>
 
 class Poly_Triangle;
@@ -33,11 +34,19 @@ public:
   //! Constructs a sensitive triangulation object defined by
   //! the owner theOwnerId, the triangulation theTrg,
   //! the location theInitLoc, and the flag theIsInterior.
+  //! Flag theIsCompact enables compact mode for huge meshes (interior sensitivity only):
+  //! no per-triangle data is copied from the triangulation, and BVH tree with single-precision
+  //! boxes is built for patches of consecutive triangles, so that its memory footprint is a small
+  //! fraction of the mesh size. Picking performance relies on spatial coherence of the triangle
+  //! order (as generated by meshers and scanners). BVH tree is not built by constructor - it is
+  //! built either in background by SelectMgr_ViewerSelector::ToPrebuildBVH() threads or lazily
+  //! at the first picking.
   Standard_EXPORT Select3D_SensitiveTriangulation(
     const occ::handle<SelectMgr_EntityOwner>& theOwnerId,
     const occ::handle<Poly_Triangulation>&    theTrg,
     const TopLoc_Location&                    theInitLoc,
-    const bool                                theIsInterior = true);
+    const bool                                theIsInterior = true,
+    const bool                                theIsCompact  = false);
 
   //! Constructs a sensitive triangulation object defined by
   //! the owner theOwnerId, the triangulation theTrg,
@@ -70,11 +79,14 @@ public:
   int LastDetectedTriangleIndex() const
   {
     return (myDetectedIdx != -1 && mySensType == Select3D_TOS_INTERIOR
-            && !myBVHPrimIndexes.IsNull())
-             ? myBVHPrimIndexes->Value(myDetectedIdx) + 1
+            && (myIsCompact || !myBVHPrimIndexes.IsNull()))
+             ? primitiveIndex(myDetectedIdx) + 1
              : -1;
   }
 
+  //! Returns TRUE if compact mode is enabled (see constructor).
+  bool IsCompact() const { return myIsCompact; }
+
 public:
   //! Returns the amount of nodes in triangulation
   Standard_EXPORT int NbSubElements() const override;
@@ -96,6 +108,16 @@ public:
   //! Swaps items with indexes theIdx1 and theIdx2 in array
   Standard_EXPORT void Swap(const int theIdx1, const int theIdx2) override;
 
+  //! Builds BVH tree; in compact mode, builds single-precision tree for patches of triangles.
+  Standard_EXPORT void BVH() override;
+
+  //! Returns TRUE if BVH tree is in invalidated state
+  bool ToBuildBVH() const override
+  {
+    return myIsCompact ? (myCompactBVH.IsNull() && myPrimitivesNb > 0)
+                       : Select3D_SensitiveSet::ToBuildBVH();
+  }
+
   //! Returns bounding box of the triangulation. If location
   //! transformation is set, it will be applied
   Standard_EXPORT Select3D_BndBox3d BoundingBox() override;
@@ -128,7 +150,29 @@ protected:
   //! box of the triangulation
   Select3D_BndBox3d applyTransformation();
 
+  //! Builds BVH tree of compact mode.
+  Standard_EXPORT void buildCompactBVH();
+
 private:
+  //! Returns index of triangle or free edge within [0, myPrimitivesNb) range
+  //! for the element with index theElemIdx in BVH tree.
+  int primitiveIndex(const int theElemIdx) const
+  {
+    if (!myIsCompact)
+    {
+      return myBVHPrimIndexes->Value(theElemIdx);
+    }
+    else if (myCompactIndices.IsEmpty())
+    {
+      return theElemIdx;
+    }
+
+    // the last patch might be incomplete - its extra lanes repeat the last triangle
+    const int aPrimIdx = myCompactIndices.Index(theElemIdx / myCompactPatchSize)
+                         + theElemIdx % myCompactPatchSize;
+    return aPrimIdx < myPrimitivesNb ? aPrimIdx : myPrimitivesNb - 1;
+  }
+
   //! Checks whether the element with index theIdx overlaps the current selecting volume
   Standard_EXPORT bool overlapsElement(SelectBasics_PickResult&             thePickResult,
                                        SelectBasics_SelectingVolumeManager& theMgr,
@@ -144,6 +188,11 @@ private:
                                        int                                  theElemIdx,
                                        bool theIsFullInside) override;
 
+  //! Rejects triangles outside the current selecting volume in batches (interior sensitivity only).
+  Standard_EXPORT int filterElements(SelectBasics_SelectingVolumeManager& theMgr,
+                                     int                                  theFirstElem,
+                                     int                                  theElemsNb) override;
+
 protected:
   occ::handle<Poly_Triangulation>       myTriangul;
   TopLoc_Location                       myInitLocation;
@@ -154,6 +203,10 @@ protected:
   int                 myPrimitivesNb;       //!< Amount of free edges or triangles depending on sensitivity type
   occ::handle<NCollection_HArray1<int>> myBVHPrimIndexes;     //!< Indexes of edges or triangles for BVH build
   mutable Select3D_BndBox3d        myBndBox;             //!< Bounding box of the whole triangulation
+  Select3D_BVHIndexBuffer          myCompactIndices;     //!< first triangles of patches for compact BVH tree
+  occ::handle<BVH_Tree<float, 3>>  myCompactBVH;         //!< single-precision BVH tree of compact mode
+  int                              myCompactPatchSize;   //!< number of triangles in a patch of compact mode
+  bool                             myIsCompact;          //!< compact mode flag
   // clang-format on
   gp_GTrsf myInvInitLocation;
 };
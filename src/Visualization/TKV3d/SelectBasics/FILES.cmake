@@ -7,5 +7,6 @@ set(OCCT_SelectBasics_FILES
   SelectBasics_PickResult.hxx
   SelectBasics_SelectingVolumeManager.cxx
   SelectBasics_SelectingVolumeManager.hxx
+  SelectBasics_TriangleBatch.hxx
 
 )
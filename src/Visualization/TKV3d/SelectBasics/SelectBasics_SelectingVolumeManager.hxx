@@ -21,6 +21,7 @@
 #include <NCollection_Array1.hxx>
 #include <NCollection_HArray1.hxx>
 #include <SelectBasics_PickResult.hxx>
+#include <SelectBasics_TriangleBatch.hxx>
 #include <SelectMgr_SelectionType.hxx>
 
 class gp_Pnt;
@@ -82,6 +83,16 @@ public:
                                 int                      theSensType,
                                 SelectBasics_PickResult& thePickResult) const = 0;
 
+  //! Returns bit mask of triangles within the batch which might overlap selecting volume
+  //! (interior sensitivity); triangles with unset bits are guaranteed to be outside.
+  //! The test is conservative and made in single precision, so that overlapping triangles
+  //! should be still checked by OverlapsTriangle().
+  //! Default implementation keeps all triangles.
+  virtual int FilterTriangles(const SelectBasics_TriangleBatch& theBatch) const
+  {
+    return theBatch.FullMask();
+  }
+
   //! Returns true if selecting volume is overlapped by sphere with center theCenter
   //! and radius theRadius
   virtual bool OverlapsSphere(const gp_Pnt&            theCenter,
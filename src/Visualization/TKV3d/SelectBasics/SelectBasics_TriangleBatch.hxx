@@ -0,0 +1,65 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _SelectBasics_TriangleBatch_HeaderFile
+#define _SelectBasics_TriangleBatch_HeaderFile
+
+#include <gp_Pnt.hxx>
+
+#include <cstring>
+
+//! Batch of up to Size triangles stored in single precision as structure of arrays
+//! (separate coordinate arrays per triangle vertex), so that the same test
+//! applied to all triangles of the batch could be vectorized by compiler.
+//! Used for cheap rejection of triangles before exact overlap tests
+//! (see SelectBasics_SelectingVolumeManager::FilterTriangles()).
+struct SelectBasics_TriangleBatch
+{
+  //! Maximum number of triangles within the batch.
+  static constexpr int Size = 8;
+
+  float X[3][Size]; //!< X coordinates of triangle vertices
+  float Y[3][Size]; //!< Y coordinates of triangle vertices
+  float Z[3][Size]; //!< Z coordinates of triangle vertices
+  int   NbTriangles; //!< number of filled triangles
+
+  //! Empty constructor.
+  SelectBasics_TriangleBatch() { Clear(); }
+
+  //! Reset the batch; unused lanes are filled by zeros.
+  void Clear()
+  {
+    memset(X, 0, sizeof(X));
+    memset(Y, 0, sizeof(Y));
+    memset(Z, 0, sizeof(Z));
+    NbTriangles = 0;
+  }
+
+  //! Return bit mask with all filled triangles set.
+  int FullMask() const { return (1 << NbTriangles) - 1; }
+
+  //! Append triangle to the batch.
+  void Add(const gp_Pnt& thePnt1, const gp_Pnt& thePnt2, const gp_Pnt& thePnt3)
+  {
+    const gp_Pnt* aPnts[3] = {&thePnt1, &thePnt2, &thePnt3};
+    for (int aVertIter = 0; aVertIter < 3; ++aVertIter)
+    {
+      X[aVertIter][NbTriangles] = (float)aPnts[aVertIter]->X();
+      Y[aVertIter][NbTriangles] = (float)aPnts[aVertIter]->Y();
+      Z[aVertIter][NbTriangles] = (float)aPnts[aVertIter]->Z();
+    }
+    ++NbTriangles;
+  }
+};
+
+#endif // _SelectBasics_TriangleBatch_HeaderFile
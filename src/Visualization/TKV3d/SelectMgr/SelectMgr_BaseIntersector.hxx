@@ -21,6 +21,7 @@
 #include <NCollection_Vector.hxx>
 #include <Select3D_TypeOfSensitivity.hxx>
 #include <SelectBasics_PickResult.hxx>
+#include <SelectBasics_TriangleBatch.hxx>
 #include <SelectMgr_SelectionType.hxx>
 #include <gp_Trsf.hxx>
 #include <NCollection_Vec3.hxx>
@@ -178,6 +179,14 @@ public:
                                 const SelectMgr_ViewClipRange& theClipRange,
                                 SelectBasics_PickResult&       thePickResult) const = 0;
 
+  //! Returns bit mask of triangles within the batch which might overlap selecting volume
+  //! (triangles with unset bits are guaranteed to be outside of it).
+  //! Default implementation keeps all triangles.
+  virtual int FilterTriangles(const SelectBasics_TriangleBatch& theBatch) const
+  {
+    return theBatch.FullMask();
+  }
+
   //! Returns true if selecting volume is overlapped by sphere with center theCenter
   //! and radius theRadius
   Standard_EXPORT virtual bool OverlapsSphere(const gp_Pnt& theCenter,
@@ -58,6 +58,10 @@ public:
     memset(myMinVertsProjections, 0, sizeof(myMinVertsProjections));
   }
 
+  //! Rejects triangles of the batch lying outside of any frustum plane in single precision;
+  //! the same planes as by hasTriangleOverlap() are checked.
+  inline int FilterTriangles(const SelectBasics_TriangleBatch& theBatch) const override;
+
   //! Dumps the content of me into the stream
   inline void DumpJson(Standard_OStream& theOStream, int theDepth = -1) const override;
 
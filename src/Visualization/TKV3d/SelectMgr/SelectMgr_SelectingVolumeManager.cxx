@@ -409,6 +409,19 @@ bool SelectMgr_SelectingVolumeManager::OverlapsTriangle(
 
 //=================================================================================================
 
+int SelectMgr_SelectingVolumeManager::FilterTriangles(
+  const SelectBasics_TriangleBatch& theBatch) const
+{
+  if (myActiveSelectingVolume.IsNull())
+  {
+    return 0;
+  }
+
+  return myActiveSelectingVolume->FilterTriangles(theBatch);
+}
+
+//=================================================================================================
+
 bool SelectMgr_SelectingVolumeManager::OverlapsSphere(const gp_Pnt&            theCenter,
                                                       const double             theRadius,
                                                       SelectBasics_PickResult& thePickResult) const
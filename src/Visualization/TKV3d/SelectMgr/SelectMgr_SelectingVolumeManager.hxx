@@ -161,6 +161,9 @@ public:
                                         int                      theSensType,
                                         SelectBasics_PickResult& thePickResult) const override;
 
+  //! Returns bit mask of triangles within the batch which might overlap active selecting volume.
+  Standard_EXPORT int FilterTriangles(const SelectBasics_TriangleBatch& theBatch) const override;
+
   //! Intersection test between defined volume and given sphere
   Standard_EXPORT bool OverlapsSphere(const gp_Pnt&            theCenter,
                                       const double             theRadius,
@@ -16,6 +16,7 @@
 
 #include <SelectMgr_SelectionManager.hxx>
 
+#include <OSD_Parallel.hxx>
 #include <Select3D_SensitiveGroup.hxx>
 #include <SelectMgr_SelectableObject.hxx>
 #include <SelectMgr_Selection.hxx>
@@ -28,7 +29,8 @@ IMPLEMENT_STANDARD_RTTIEXT(SelectMgr_SelectionManager, Standard_Transient)
 
 SelectMgr_SelectionManager::SelectMgr_SelectionManager(
   const occ::handle<SelectMgr_ViewerSelector>& theSelector)
-    : mySelector(theSelector)
+    : mySelector(theSelector),
+      myIsLazyBVH(false)
 {
   //
 }
@@ -185,6 +187,115 @@ void SelectMgr_SelectionManager::Activate(const occ::handle<SelectMgr_Selectable
   }
 }
 
+namespace
+{
+//! Functor computing selections of a group of objects.
+class SelectMgr_ComputeFunctor
+{
+public:
+  SelectMgr_ComputeFunctor(
+    const NCollection_Array1<occ::handle<SelectMgr_SelectableObject>>& theObjects,
+    const NCollection_Array1<occ::handle<SelectMgr_Selection>>&        theSelList,
+    const NCollection_Array1<int>&                                     theGroupLowers,
+    const bool                                                         theToBuildBVH)
+      : myObjects(theObjects),
+        mySelList(theSelList),
+        myGroupLowers(theGroupLowers),
+        myToBuildBVH(theToBuildBVH)
+  {
+  }
+
+  void operator()(int theGroupIndex) const
+  {
+    for (int anIter = myGroupLowers.Value(theGroupIndex);
+         anIter < myGroupLowers.Value(theGroupIndex + 1);
+         ++anIter)
+    {
+      const occ::handle<SelectMgr_Selection>& aSel = mySelList.Value(anIter);
+      if (aSel.IsNull())
+      {
+        continue;
+      }
+
+      myObjects.Value(myObjects.Lower() + anIter)->ComputeSelection(aSel, aSel->Mode());
+      if (myToBuildBVH)
+      {
+        StdSelect_BRepSelectionTool::PreBuildBVH(aSel);
+      }
+    }
+  }
+
+private:
+  const NCollection_Array1<occ::handle<SelectMgr_SelectableObject>>& myObjects;
+  const NCollection_Array1<occ::handle<SelectMgr_Selection>>&        mySelList;
+  const NCollection_Array1<int>&                                     myGroupLowers;
+  const bool                                                         myToBuildBVH;
+};
+} // namespace
+
+//=================================================================================================
+
+void SelectMgr_SelectionManager::Activate(
+  const NCollection_Array1<occ::handle<SelectMgr_SelectableObject>>& theObjects,
+  const NCollection_Array1<int>&                                     theModes,
+  const NCollection_Array1<int>&                                     theGroups)
+{
+  if (theObjects.IsEmpty())
+  {
+    return;
+  }
+
+  // create empty selections on the calling thread
+  NCollection_Array1<occ::handle<SelectMgr_Selection>> aSelList(0, theObjects.Size() - 1);
+  NCollection_Array1<int>                              aGroupLowers(0, theObjects.Size());
+  int                                                  aNbGroups = 0;
+  for (int anIter = 0; anIter < theObjects.Size(); ++anIter)
+  {
+    const int anObjIndex = theObjects.Lower() + anIter;
+    if (anIter == 0 || theGroups.Value(anObjIndex) != theGroups.Value(anObjIndex - 1))
+    {
+      aGroupLowers.SetValue(aNbGroups++, anIter);
+    }
+
+    const occ::handle<SelectMgr_SelectableObject>& anObj = theObjects.Value(anObjIndex);
+    const int                                      aMode = theModes.Value(anObjIndex);
+    if (!anObj.IsNull() && aMode != -1 && anObj->HasOwnPresentations()
+        && anObj->Selection(aMode).IsNull())
+    {
+      aSelList.SetValue(anIter, new SelectMgr_Selection(aMode));
+    }
+  }
+  aGroupLowers.SetValue(aNbGroups, theObjects.Size());
+
+  // compute sensitive entities by worker threads
+  SelectMgr_ComputeFunctor aFunctor(theObjects,
+                                    aSelList,
+                                    aGroupLowers,
+                                    !mySelector->ToPrebuildBVH() && !myIsLazyBVH);
+  OSD_Parallel::For(0, aNbGroups, aFunctor, aNbGroups < 2);
+
+  // register selections on the calling thread
+  for (int anIter = 0; anIter < theObjects.Size(); ++anIter)
+  {
+    const int                                      anObjIndex = theObjects.Lower() + anIter;
+    const occ::handle<SelectMgr_SelectableObject>& anObj      = theObjects.Value(anObjIndex);
+    if (const occ::handle<SelectMgr_Selection>& aSel = aSelList.Value(anIter))
+    {
+      aSel->UpdateStatus(SelectMgr_TOU_Partial);
+      aSel->UpdateBVHStatus(SelectMgr_TBU_Add);
+      anObj->AddSelection(aSel, aSel->Mode());
+      if (mySelector->ToPrebuildBVH())
+      {
+        buildBVH(aSel);
+      }
+    }
+    if (!anObj.IsNull())
+    {
+      Activate(anObj, theModes.Value(anObjIndex));
+    }
+  }
+}
+
 //=================================================================================================
 
 void SelectMgr_SelectionManager::Deactivate(
@@ -570,7 +681,7 @@ void SelectMgr_SelectionManager::buildBVH(const occ::handle<SelectMgr_Selection>
       }
     }
   }
-  else
+  else if (!myIsLazyBVH)
   {
     StdSelect_BRepSelectionTool::PreBuildBVH(theSelection);
   }
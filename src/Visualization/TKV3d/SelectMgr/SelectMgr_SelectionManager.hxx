@@ -19,6 +19,7 @@
 
 #include <SelectMgr_ViewerSelector.hxx>
 #include <SelectMgr_TypeOfUpdate.hxx>
+#include <NCollection_Array1.hxx>
 
 class SelectMgr_SelectableObject;
 
@@ -55,6 +56,17 @@ public:
   Standard_EXPORT void Activate(const occ::handle<SelectMgr_SelectableObject>& theObject,
                                 const int                                      theMode = 0);
 
+  //! Activates selection modes of the objects (theModes has the same bounds as theObjects,
+  //! -1 skips the object), computing sensitive entities of selections not computed yet
+  //! by OSD_ThreadPool worker threads, which call only SelectMgr_SelectableObject::ComputeSelection()
+  //! and build BVH of heavyweight entities; selections are registered by the calling thread.
+  //! Adjacent objects with equal values in theGroups are computed one after another by the same
+  //! thread (see PrsMgr_PresentationManager::Display() taking arrays).
+  Standard_EXPORT void Activate(
+    const NCollection_Array1<occ::handle<SelectMgr_SelectableObject>>& theObjects,
+    const NCollection_Array1<int>&                                     theModes,
+    const NCollection_Array1<int>&                                     theGroups);
+
   //! Deactivates mode theMode of theObject in theSelector. If theMode value is set to default (-1),
   //! all active selection modes will be deactivated. Likewise, if theSelector value is set to
   //! default (NULL), theMode will be deactivated in all viewer selectors.
@@ -113,6 +125,15 @@ public:
   //! Re-adds selectable object in BVHs in all viewer selectors.
   Standard_EXPORT void UpdateSelection(const occ::handle<SelectMgr_SelectableObject>& theObj);
 
+  //! Returns TRUE if BVH of heavyweight sensitive entities is built by the first picking
+  //! of the entity instead of selection activation; FALSE by default.
+  bool IsLazyBVH() const { return myIsLazyBVH; }
+
+  //! Sets if BVH of heavyweight sensitive entities should be built by the first picking
+  //! of the entity, which shortens activation of selections of large scenes.
+  //! Has no effect when BVH is built by SelectMgr_ViewerSelector::ToPrebuildBVH() threads.
+  void SetLazyBVH(const bool theIsLazy) { myIsLazyBVH = theIsLazy; }
+
 protected:
   //! Recomputes given selection mode and updates BVHs in all viewer selectors
   Standard_EXPORT void recomputeSelectionMode(
@@ -134,6 +155,7 @@ private:
 private:
   occ::handle<SelectMgr_ViewerSelector>                    mySelector;
   NCollection_Map<occ::handle<SelectMgr_SelectableObject>> myGlobal;
+  bool                                                     myIsLazyBVH;
 };
 
 #endif // _SelectMgr_SelectionManager_HeaderFile
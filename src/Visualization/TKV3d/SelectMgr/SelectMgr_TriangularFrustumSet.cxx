@@ -22,6 +22,7 @@
 #include <Geom_Circle.hxx>
 #include <Geom_Line.hxx>
 #include <NCollection_IncAllocator.hxx>
+#include <OSD_MemInfo.hxx>
 #include <SelectMgr_FrustumBuilder.hxx>
 
 namespace
@@ -74,6 +75,7 @@ void SelectMgr_TriangularFrustumSet::Build()
 
   occ::handle<NCollection_IncAllocator> anAllocator =
     new NCollection_IncAllocator(MEMORY_BLOCK_SIZE);
+  anAllocator->SetMemTag(OSD_MemInfo::MemTag_Select3D);
   occ::handle<BRepMesh_DataStructureOfDelaun> aMeshStructure =
     new BRepMesh_DataStructureOfDelaun(anAllocator);
   int                        aPtsLower = mySelPolyline.Points->Lower();
@@ -441,6 +443,22 @@ bool SelectMgr_TriangularFrustumSet::OverlapsTriangle(const gp_Pnt&
 
 //=================================================================================================
 
+int SelectMgr_TriangularFrustumSet::FilterTriangles(
+  const SelectBasics_TriangleBatch& theBatch) const
+{
+  const int aFullMask = theBatch.FullMask();
+  int       aMask     = 0;
+  for (NCollection_List<occ::handle<SelectMgr_TriangularFrustum>>::Iterator anIter(myFrustums);
+       anIter.More() && aMask != aFullMask;
+       anIter.Next())
+  {
+    aMask |= anIter.Value()->FilterTriangles(theBatch);
+  }
+  return aMask;
+}
+
+//=================================================================================================
+
 bool SelectMgr_TriangularFrustumSet::OverlapsSphere(const gp_Pnt& theCenter,
                                                     const double  theRadius,
                                                     bool* /*theInside*/) const
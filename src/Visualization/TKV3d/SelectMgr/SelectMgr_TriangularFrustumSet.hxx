@@ -104,6 +104,9 @@ public:
                                         const SelectMgr_ViewClipRange& theClipRange,
                                         SelectBasics_PickResult& thePickResult) const override;
 
+  //! Returns bit mask of triangles within the batch which might overlap any of triangular frustums.
+  Standard_EXPORT int FilterTriangles(const SelectBasics_TriangleBatch& theBatch) const override;
+
 public:
   //! Calculates the point on a view ray that was detected during the run of selection algo by given
   //! depth
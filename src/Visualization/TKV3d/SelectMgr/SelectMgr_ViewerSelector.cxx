@@ -21,6 +21,7 @@
 #include <gp_GTrsf.hxx>
 #include <gp_Pnt.hxx>
 #include <OSD_Environment.hxx>
+#include <OSD_Parallel.hxx>
 #include <Select3D_SensitiveEntity.hxx>
 #include <SelectBasics_PickResult.hxx>
 #include <SelectMgr.hxx>
@@ -169,6 +170,7 @@ SelectMgr_ViewerSelector::SelectMgr_ViewerSelector()
       myToPreferClosest(true),
       myCameraScale(1.0),
       myToPrebuildBVH(false),
+      myToTraverseParallel(true),
       myIsSorted(false),
       myIsLeftChildQueuedFirst(false)
 {
@@ -240,7 +242,7 @@ void SelectMgr_ViewerSelector::Deactivate(const occ::handle<SelectMgr_Selection>
 // purpose : Checks if the entity given requires to scale current selecting frustum
 //=======================================================================
 bool SelectMgr_ViewerSelector::isToScaleFrustum(
-  const occ::handle<Select3D_SensitiveEntity>& theEntity)
+  const occ::handle<Select3D_SensitiveEntity>& theEntity) const
 {
   return mySelectingVolumeMgr.IsScalableActiveVolume()
          && sensitivity(theEntity) < myTolerances.Tolerance();
@@ -267,6 +269,16 @@ int SelectMgr_ViewerSelector::sensitivity(
 void SelectMgr_ViewerSelector::checkOverlap(const occ::handle<Select3D_SensitiveEntity>& theEntity,
                                             const gp_GTrsf&                   theInversedTrsf,
                                             SelectMgr_SelectingVolumeManager& theMgr)
+{
+  checkOverlap(theEntity, theInversedTrsf, theMgr, mystored);
+}
+
+//=================================================================================================
+
+void SelectMgr_ViewerSelector::checkOverlap(const occ::handle<Select3D_SensitiveEntity>& theEntity,
+                                            const gp_GTrsf&                   theInversedTrsf,
+                                            SelectMgr_SelectingVolumeManager& theMgr,
+                                            MapOfOwnerCriterion&              theStored) const
 {
   const occ::handle<SelectMgr_EntityOwner>& anOwner = theEntity->OwnerId();
   occ::handle<SelectMgr_SelectableObject>   aSelectable =
@@ -305,7 +317,7 @@ void SelectMgr_ViewerSelector::checkOverlap(const occ::handle<Select3D_Sensitive
     }
   }
 
-  if (SelectMgr_SortCriterion* aPrevCriterion = mystored.ChangeSeek(anOwner))
+  if (SelectMgr_SortCriterion* aPrevCriterion = theStored.ChangeSeek(anOwner))
   {
     ++aPrevCriterion->NbOwnerMatches;
     aCriterion.NbOwnerMatches = aPrevCriterion->NbOwnerMatches;
@@ -322,7 +334,7 @@ void SelectMgr_ViewerSelector::checkOverlap(const occ::handle<Select3D_Sensitive
   {
     aCriterion.NbOwnerMatches = 1;
     updatePoint3d(aCriterion, aPickResult, theEntity, theInversedTrsf, theMgr);
-    mystored.Add(anOwner, aCriterion);
+    theStored.Add(anOwner, aCriterion);
   }
 }
 
@@ -356,7 +368,7 @@ void SelectMgr_ViewerSelector::computeFrustum(
   const SelectMgr_SelectingVolumeManager&                     theMgrObject,
   const gp_GTrsf&                                             theInvTrsf,
   NCollection_DataMap<int, SelectMgr_SelectingVolumeManager>& theCachedMgrs,
-  SelectMgr_SelectingVolumeManager&                           theResMgr)
+  SelectMgr_SelectingVolumeManager&                           theResMgr) const
 {
   int            aScale = isToScaleFrustum(theEnt) ? sensitivity(theEnt) : 1;
   const gp_GTrsf aTrsfMtr =
@@ -402,8 +414,28 @@ void SelectMgr_ViewerSelector::traverseObject(
   const NCollection_Mat4<double>&                theWorldViewMat,
   const NCollection_Vec2<int>&                   theWinSize)
 {
-  occ::handle<SelectMgr_SensitiveEntitySet>& anEntitySet =
-    myMapOfObjectSensitives.ChangeFind(theObject);
+  traverseObject(theObject,
+                 theMgr,
+                 theCamera,
+                 theProjectionMat,
+                 theWorldViewMat,
+                 theWinSize,
+                 mystored);
+}
+
+//=================================================================================================
+
+void SelectMgr_ViewerSelector::traverseObject(
+  const occ::handle<SelectMgr_SelectableObject>& theObject,
+  const SelectMgr_SelectingVolumeManager&        theMgr,
+  const occ::handle<Graphic3d_Camera>&           theCamera,
+  const NCollection_Mat4<double>&                theProjectionMat,
+  const NCollection_Mat4<double>&                theWorldViewMat,
+  const NCollection_Vec2<int>&                   theWinSize,
+  MapOfOwnerCriterion&                           theStored) const
+{
+  const occ::handle<SelectMgr_SensitiveEntitySet>& anEntitySet =
+    myMapOfObjectSensitives.Find(theObject);
   if (anEntitySet->Size() == 0)
   {
     return;
@@ -515,7 +547,7 @@ void SelectMgr_ViewerSelector::traverseObject(
     }
   }
 
-  const int aFirstStored = mystored.Extent() + 1;
+  const int aFirstStored = theStored.Extent() + 1;
 
   int                                                        aStack[BVH_Constants_MaxTreeDepth];
   int                                                        aHead = -1;
@@ -625,7 +657,7 @@ void SelectMgr_ViewerSelector::traverseObject(
           }
 
           computeFrustum(anEnt, theMgr, aMgr, aInvSensTrsf, aScaledTrnsfFrustums, aTmpMgr);
-          checkOverlap(anEnt, aInvSensTrsf, aTmpMgr);
+          checkOverlap(anEnt, aInvSensTrsf, aTmpMgr, theStored);
         }
       }
       if (aHead < 0)
@@ -646,15 +678,61 @@ void SelectMgr_ViewerSelector::traverseObject(
     return;
   }
 
-  for (int aStoredIter = mystored.Extent(); aStoredIter >= aFirstStored; --aStoredIter)
+  for (int aStoredIter = theStored.Extent(); aStoredIter >= aFirstStored; --aStoredIter)
   {
-    const SelectMgr_SortCriterion&            aCriterion = mystored.FindFromIndex(aStoredIter);
+    const SelectMgr_SortCriterion&            aCriterion = theStored.FindFromIndex(aStoredIter);
     const occ::handle<SelectMgr_EntityOwner>& anOwner    = aCriterion.Entity->OwnerId();
     int                                       aNbOwnerEntities = 0;
     anEntitySet->Owners().Find(anOwner, aNbOwnerEntities);
     if (aNbOwnerEntities > aCriterion.NbOwnerMatches)
     {
-      mystored.RemoveFromIndex(aStoredIter);
+      theStored.RemoveFromIndex(aStoredIter);
+    }
+  }
+}
+
+//=================================================================================================
+
+void SelectMgr_ViewerSelector::traverseObjectsParallel(
+  const NCollection_Vector<occ::handle<SelectMgr_SelectableObject>>& theObjects,
+  const SelectMgr_SelectingVolumeManager&                            theMgr,
+  const occ::handle<Graphic3d_Camera>&                               theCamera,
+  const NCollection_Mat4<double>&                                    theProjectionMat,
+  const NCollection_Mat4<double>&                                    theWorldViewMat,
+  const NCollection_Vec2<int>&                                       theWinSize)
+{
+  const int aNbObjects = theObjects.Length();
+  if (aNbObjects == 0)
+  {
+    return;
+  }
+
+  // each object is traversed by a single thread into its own map,
+  // which are then merged in order of candidates to keep the result deterministic
+  NCollection_Array1<MapOfOwnerCriterion> aResults(0, aNbObjects - 1);
+  OSD_Parallel::For(
+    0,
+    aNbObjects,
+    [&](int theIndex) {
+      traverseObject(theObjects.Value(theIndex),
+                     theMgr,
+                     theCamera,
+                     theProjectionMat,
+                     theWorldViewMat,
+                     theWinSize,
+                     aResults.ChangeValue(theIndex));
+    },
+    aNbObjects < 2);
+
+  for (int anObjIter = 0; anObjIter < aNbObjects; ++anObjIter)
+  {
+    const MapOfOwnerCriterion& aResult = aResults.Value(anObjIter);
+    for (int aResIter = 1; aResIter <= aResult.Extent(); ++aResIter)
+    {
+      if (!mystored.Contains(aResult.FindKey(aResIter)))
+      {
+        mystored.Add(aResult.FindKey(aResIter), aResult.FindFromIndex(aResIter));
+      }
     }
   }
 }
@@ -767,6 +845,14 @@ void SelectMgr_ViewerSelector::TraverseSensitives(const int theViewId)
 
     const opencascade::handle<BVH_Tree<double, 3>>& aBVHTree = mySelectableObjects.BVH(aBVHSubset);
 
+    // rectangle and polyline selection might hit a lot of objects - collect them for parallel
+    // traversal; BVH of entities is built beforehand, as the builder is shared between objects
+    const bool toTraverseParallel =
+      myToTraverseParallel
+      && (aMgr.GetActiveSelectionType() == SelectMgr_SelectionType_Box
+          || aMgr.GetActiveSelectionType() == SelectMgr_SelectionType_Polyline);
+    NCollection_Vector<occ::handle<SelectMgr_SelectableObject>> aCandidates;
+
     int aNode = 0;
     if (!aMgr.OverlapsBox(aBVHTree->MinPoint(0), aBVHTree->MaxPoint(0)))
     {
@@ -815,7 +901,17 @@ void SelectMgr_ViewerSelector::TraverseSensitives(const int theViewId)
           const occ::handle<SelectMgr_SelectableObject>& aSelObj =
             mySelectableObjects.GetObjectById(aBVHSubset, anIdx);
           const occ::handle<Graphic3d_ViewAffinity>& aViewAffinity = aSelObj->ViewAffinity();
-          if (theViewId == -1 || aViewAffinity->IsVisible(theViewId))
+          if (theViewId != -1 && !aViewAffinity->IsVisible(theViewId))
+          {
+            continue;
+          }
+
+          if (toTraverseParallel)
+          {
+            myMapOfObjectSensitives.Find(aSelObj)->BVH();
+            aCandidates.Append(aSelObj);
+          }
+          else
           {
             traverseObject(aSelObj, aMgr, aCamera, aProjectionMat, aWorldViewMat, aWinSize);
           }
@@ -829,6 +925,16 @@ void SelectMgr_ViewerSelector::TraverseSensitives(const int theViewId)
         --aHead;
       }
     }
+
+    if (toTraverseParallel)
+    {
+      traverseObjectsParallel(aCandidates,
+                              aMgr,
+                              aCamera,
+                              aProjectionMat,
+                              aWorldViewMat,
+                              aWinSize);
+    }
   }
 
   SortResult();
@@ -1467,6 +1573,7 @@ void SelectMgr_ViewerSelector::DumpJson(Standard_OStream& theOStream, int theDep
   OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, myIndexes.Size())
 
   OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, myIsLeftChildQueuedFirst)
+  OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, myToTraverseParallel)
   OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, myMapOfObjectSensitives.Extent())
 
   OCCT_DUMP_FIELD_VALUE_NUMERICAL(theOStream, myStructs.Length())
@@ -35,6 +35,7 @@
 #include <Standard_Integer.hxx>
 #include <NCollection_Array1.hxx>
 #include <NCollection_HArray1.hxx>
+#include <NCollection_Vector.hxx>
 
 class SelectMgr_SensitiveEntitySet;
 class SelectMgr_EntityOwner;
@@ -324,6 +325,16 @@ public:
   //! Returns TRUE if building BVH for sensitives in separate threads is enabled
   bool ToPrebuildBVH() const { return myToPrebuildBVH; }
 
+  //! Returns TRUE if rectangle and polyline selection traverses candidate objects in parallel
+  //! threads (each object on a single thread, with results merged in traversal order,
+  //! so that the result does not depend on the number of threads); TRUE by default.
+  //! Point picking is always done by the calling thread.
+  bool ToTraverseParallel() const { return myToTraverseParallel; }
+
+  //! Enables/disables parallel traversal of objects by rectangle and polyline selection.
+  //! Sensitive entities should support concurrent Matches() calls for different entities.
+  void SetToTraverseParallel(bool theToEnable) { myToTraverseParallel = theToEnable; }
+
 protected:
   //! Traverses BVH containing all added selectable objects and
   //! finds candidates for further search of overlap
@@ -355,8 +366,37 @@ protected:
   Standard_EXPORT void updateZLayers(const occ::handle<V3d_View>& theView);
 
 private:
+  //! Map of detected owners.
+  typedef NCollection_IndexedDataMap<occ::handle<SelectMgr_EntityOwner>, SelectMgr_SortCriterion>
+    MapOfOwnerCriterion;
+
+  //! traverseObject() implementation storing detected owners into specified map.
+  void traverseObject(const occ::handle<SelectMgr_SelectableObject>& theObject,
+                      const SelectMgr_SelectingVolumeManager&        theMgr,
+                      const occ::handle<Graphic3d_Camera>&           theCamera,
+                      const NCollection_Mat4<double>&                theProjectionMat,
+                      const NCollection_Mat4<double>&                theWorldViewMat,
+                      const NCollection_Vec2<int>&                   theWinSize,
+                      MapOfOwnerCriterion&                           theStored) const;
+
+  //! checkOverlap() implementation storing detected owner into specified map.
+  void checkOverlap(const occ::handle<Select3D_SensitiveEntity>& theEntity,
+                    const gp_GTrsf&                              theInversedTrsf,
+                    SelectMgr_SelectingVolumeManager&            theMgr,
+                    MapOfOwnerCriterion&                         theStored) const;
+
+  //! Traverses candidate objects collected by TraverseSensitives() in parallel threads
+  //! and appends detected owners to mystored in order of candidates.
+  void traverseObjectsParallel(
+    const NCollection_Vector<occ::handle<SelectMgr_SelectableObject>>& theObjects,
+    const SelectMgr_SelectingVolumeManager&                            theMgr,
+    const occ::handle<Graphic3d_Camera>&                               theCamera,
+    const NCollection_Mat4<double>&                                    theProjectionMat,
+    const NCollection_Mat4<double>&                                    theWorldViewMat,
+    const NCollection_Vec2<int>&                                       theWinSize);
+
   //! Checks if the entity given requires to scale current selecting frustum
-  bool isToScaleFrustum(const occ::handle<Select3D_SensitiveEntity>& theEntity);
+  bool isToScaleFrustum(const occ::handle<Select3D_SensitiveEntity>& theEntity) const;
 
   //! In case if custom tolerance is set, this method will return sum of entity sensitivity and
   //! custom tolerance. Otherwise, pure entity sensitivity factor will be returned.
@@ -376,7 +416,7 @@ private:
                       const SelectMgr_SelectingVolumeManager&                     theMgrObject,
                       const gp_GTrsf&                                             theInvTrsf,
                       NCollection_DataMap<int, SelectMgr_SelectingVolumeManager>& theCachedMgrs,
-                      SelectMgr_SelectingVolumeManager&                           theResMgr);
+                      SelectMgr_SelectingVolumeManager&                           theResMgr) const;
 
 private:
   //! Compute 3d position for detected entity.
@@ -402,6 +442,7 @@ protected:
 
   bool                                 myToPrebuildBVH;
   occ::handle<SelectMgr_BVHThreadPool> myBVHThreadPool;
+  bool                                 myToTraverseParallel;
 
   mutable NCollection_Array1<int> myIndexes;
   mutable bool                    myIsSorted;
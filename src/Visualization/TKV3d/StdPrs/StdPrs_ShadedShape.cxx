@@ -28,6 +28,7 @@
 #include <NCollection_IncAllocator.hxx>
 #include <NCollection_List.hxx>
 #include <NCollection_Shared.hxx>
+#include <NCollection_Vector.hxx>
 #include <Precision.hxx>
 #include <Prs3d_Drawer.hxx>
 #include <Prs3d_IsoAspect.hxx>
@@ -36,6 +37,7 @@
 #include <Prs3d_ShadingAspect.hxx>
 #include <Poly_PolygonOnTriangulation.hxx>
 #include <Poly_Triangulation.hxx>
+#include <Poly_VertexCacheOptimizer.hxx>
 #include <StdPrs_ToolTriangulatedShape.hxx>
 #include <StdPrs_WFShape.hxx>
 #include <TopExp.hxx>
@@ -43,10 +45,12 @@
 #include <TopoDS.hxx>
 #include <TopoDS_Compound.hxx>
 #include <TopoDS_Face.hxx>
+#include <TopoDS_Iterator.hxx>
 #include <TopoDS_Shape.hxx>
 #include <NCollection_Array1.hxx>
 #include <TopTools_ShapeMapHasher.hxx>
 #include <NCollection_IndexedDataMap.hxx>
+#include <OSD_TraceZone.hxx>
 
 namespace
 {
@@ -134,12 +138,83 @@ void wireframeNoTriangFacesFromShape(const occ::handle<Prs3d_Presentation>& theP
   }
 }
 
-//! Gets triangulation of every face of shape and fills output array of triangles
-static occ::handle<Graphic3d_ArrayOfTriangles> fillTriangles(const TopoDS_Shape& theShape,
-                                                             const bool          theHasTexels,
-                                                             const gp_Pnt2d&     theUVOrigin,
-                                                             const gp_Pnt2d&     theUVRepeat,
-                                                             const gp_Pnt2d&     theUVScale)
+//! Returns triangulation of the face for specified level of detail: 0 is the active triangulation,
+//! coarser levels follow it within the list of face triangulations
+//! (see StdPrs_ToolTriangulatedShape::TessellateLods()); the coarsest available one is returned
+//! for missing levels.
+static const occ::handle<Poly_Triangulation>& lodTriangulation(const TopoDS_Face& theFace,
+                                                              TopLoc_Location&   theLoc,
+                                                              const int          theLod)
+{
+  const occ::handle<Poly_Triangulation>& anActive = BRep_Tool::Triangulation(theFace, theLoc);
+  if (theLod <= 0 || anActive.IsNull())
+  {
+    return anActive;
+  }
+
+  const NCollection_List<occ::handle<Poly_Triangulation>>& aTriangulations =
+    BRep_Tool::Triangulations(theFace, theLoc);
+  if (aTriangulations.First() != anActive)
+  {
+    return anActive;
+  }
+
+  const occ::handle<Poly_Triangulation>* aCoarsest = &anActive;
+  int                                    aLevel    = 0;
+  for (NCollection_List<occ::handle<Poly_Triangulation>>::Iterator aTriIter(aTriangulations);
+       aTriIter.More();
+       aTriIter.Next(), ++aLevel)
+  {
+    aCoarsest = &aTriIter.Value();
+    if (aLevel == theLod)
+    {
+      break;
+    }
+  }
+  return *aCoarsest;
+}
+
+//! Returns the number of levels of detail (up to theMaxNbLods) available within faces of the shape
+//! and fills the maximum deflection of each level (theDeflections should be zero-initialized).
+static int lodDeflections(const TopoDS_Shape& theShape,
+                          const int           theMaxNbLods,
+                          double              theDeflections[Graphic3d_Group::MaxLevelsOfDetail])
+{
+  int aNbLods = 0;
+  for (TopExp_Explorer aFaceIt(theShape, TopAbs_FACE); aFaceIt.More(); aFaceIt.Next())
+  {
+    const TopoDS_Face& aFace = TopoDS::Face(aFaceIt.Current());
+    TopLoc_Location    aLoc;
+    for (int aLod = 0; aLod < theMaxNbLods; ++aLod)
+    {
+      const occ::handle<Poly_Triangulation>& aTri = lodTriangulation(aFace, aLoc, aLod);
+      if (aTri.IsNull())
+      {
+        break;
+      }
+      if (aLod > 0 && aTri == lodTriangulation(aFace, aLoc, aLod - 1))
+      {
+        // the coarsest level of this face has been reached
+        break;
+      }
+
+      theDeflections[aLod] = std::max(theDeflections[aLod], aTri->Deflection());
+      aNbLods              = std::max(aNbLods, aLod + 1);
+    }
+  }
+  return aNbLods;
+}
+
+//! Gets triangulation of every face of shape and fills output array of triangles,
+//! optionally reordered for GPU vertex cache
+static occ::handle<Graphic3d_ArrayOfTriangles> fillTriangles(
+  const TopoDS_Shape& theShape,
+  const bool          theHasTexels,
+  const gp_Pnt2d&     theUVOrigin,
+  const gp_Pnt2d&     theUVRepeat,
+  const gp_Pnt2d&     theUVScale,
+  const int           theLod        = 0,
+  const bool          theToOptimize = false)
 {
   occ::handle<Poly_Triangulation> aT;
   TopLoc_Location                 aLoc;
@@ -150,15 +225,22 @@ static occ::handle<Graphic3d_ArrayOfTriangles> fillTriangles(const TopoDS_Shape&
   // Precision for compare square distances
   constexpr double aPreci = Precision::SquareConfusion();
 
-  TopExp_Explorer aFaceIt(theShape, TopAbs_FACE);
+  NCollection_Vector<TopoDS_Face>                     aFaces;
+  NCollection_Vector<occ::handle<Poly_Triangulation>> aFaceTris;
+  TopExp_Explorer                                     aFaceIt(theShape, TopAbs_FACE);
   for (; aFaceIt.More(); aFaceIt.Next())
   {
     const TopoDS_Face& aFace = TopoDS::Face(aFaceIt.Current());
-    aT                       = BRep_Tool::Triangulation(aFace, aLoc);
+    aT                       = lodTriangulation(aFace, aLoc, theLod);
     if (!aT.IsNull())
     {
       aNbTriangles += aT->NbTriangles();
       aNbVertices += aT->NbNodes();
+      if (aT->HasGeometry())
+      {
+        aFaces.Append(aFace);
+        aFaceTris.Append(aT);
+      }
     }
   }
   if (aNbVertices < 3 || aNbTriangles <= 0)
@@ -166,13 +248,16 @@ static occ::handle<Graphic3d_ArrayOfTriangles> fillTriangles(const TopoDS_Shape&
     return occ::handle<Graphic3d_ArrayOfTriangles>();
   }
 
+  // compute missing normals of all faces at once using parallel threads
+  StdPrs_ToolTriangulatedShape::ComputeNormals(aFaces, aFaceTris);
+
   occ::handle<Graphic3d_ArrayOfTriangles> anArray =
     new Graphic3d_ArrayOfTriangles(aNbVertices, 3 * aNbTriangles, true, false, theHasTexels);
   double aUmin(0.0), aUmax(0.0), aVmin(0.0), aVmax(0.0), dUmax(0.0), dVmax(0.0);
   for (aFaceIt.Init(theShape, TopAbs_FACE); aFaceIt.More(); aFaceIt.Next())
   {
     const TopoDS_Face& aFace = TopoDS::Face(aFaceIt.Current());
-    aT                       = BRep_Tool::Triangulation(aFace, aLoc);
+    aT                       = lodTriangulation(aFace, aLoc, theLod);
     if (aT.IsNull() || !aT->HasGeometry())
     {
       continue;
@@ -182,9 +267,6 @@ static occ::handle<Graphic3d_ArrayOfTriangles> fillTriangles(const TopoDS_Shape&
     // Determinant of transform matrix less then 0 means that mirror transform applied.
     bool isMirrored = aTrsf.VectorialPart().Determinant() < 0;
 
-    // Extracts vertices & normals from nodes
-    StdPrs_ToolTriangulatedShape::ComputeNormals(aFace, aT);
-
     if (theHasTexels)
     {
       BRepTools::UVBounds(aFace, aUmin, aUmax, aVmin, aVmax);
@@ -192,11 +274,16 @@ static occ::handle<Graphic3d_ArrayOfTriangles> fillTriangles(const TopoDS_Shape&
       dVmax = (aVmax - aVmin);
     }
 
+    // reorder triangles and nodes for GPU vertex cache without modifying triangulation
+    Poly_VertexCacheOptimizer anOptimizer;
+    const bool                toReorder = theToOptimize && anOptimizer.Perform(*aT);
+
     const int aDecal = anArray->VertexNumber();
     for (int aNodeIter = 1; aNodeIter <= aT->NbNodes(); ++aNodeIter)
     {
-      aPoint       = aT->Node(aNodeIter);
-      gp_Dir aNorm = aT->Normal(aNodeIter);
+      const int aNode = toReorder ? anOptimizer.NodeOrder().Value(aNodeIter) : aNodeIter;
+      aPoint          = aT->Node(aNode);
+      gp_Dir aNorm    = aT->Normal(aNode);
       if ((aFace.Orientation() == TopAbs_REVERSED) ^ isMirrored)
       {
         aNorm.Reverse();
@@ -209,7 +296,7 @@ static occ::handle<Graphic3d_ArrayOfTriangles> fillTriangles(const TopoDS_Shape&
 
       if (theHasTexels && aT->HasUVNodes())
       {
-        const gp_Pnt2d aNode2d = aT->UVNode(aNodeIter);
+        const gp_Pnt2d aNode2d = aT->UVNode(aNode);
         const gp_Pnt2d aTexel =
           (dUmax == 0.0 || dVmax == 0.0)
             ? aNode2d
@@ -229,13 +316,14 @@ static occ::handle<Graphic3d_ArrayOfTriangles> fillTriangles(const TopoDS_Shape&
     int anIndex[3];
     for (int aTriIter = 1; aTriIter <= aT->NbTriangles(); ++aTriIter)
     {
+      const int aTri = toReorder ? anOptimizer.TriangleOrder().Value(aTriIter) : aTriIter;
       if ((aFace.Orientation() == TopAbs_REVERSED))
       {
-        aT->Triangle(aTriIter).Get(anIndex[0], anIndex[2], anIndex[1]);
+        aT->Triangle(aTri).Get(anIndex[0], anIndex[2], anIndex[1]);
       }
       else
       {
-        aT->Triangle(aTriIter).Get(anIndex[0], anIndex[1], anIndex[2]);
+        aT->Triangle(aTri).Get(anIndex[0], anIndex[1], anIndex[2]);
       }
 
       const gp_Pnt aP1 = aT->Node(anIndex[0]);
@@ -262,6 +350,13 @@ static occ::handle<Graphic3d_ArrayOfTriangles> fillTriangles(const TopoDS_Shape&
       aV1.Cross(aV2);
       if (aV1.SquareMagnitude() > aPreci)
       {
+        if (toReorder)
+        {
+          for (int aNodeIter = 0; aNodeIter < 3; ++aNodeIter)
+          {
+            anIndex[aNodeIter] = anOptimizer.NodeMap().Value(anIndex[aNodeIter]);
+          }
+        }
         anArray->AddEdges(anIndex[0] + aDecal, anIndex[1] + aDecal, anIndex[2] + aDecal);
       }
     }
@@ -269,6 +364,95 @@ static occ::handle<Graphic3d_ArrayOfTriangles> fillTriangles(const TopoDS_Shape&
   return anArray;
 }
 
+//! Prepare shaded presentation for specified compound sharing triangles of sub-shapes
+//! occurring several times with different locations: the array of triangles is filled once
+//! in local coordinate system of sub-shape and added to a group per location.
+//! Mirroring locations and sub-shapes occurring once are put into a single common array.
+static bool shadeInstancesFromShape(const TopoDS_Shape&                    theShape,
+                                    const occ::handle<Prs3d_Presentation>& thePrs,
+                                    const occ::handle<Prs3d_Drawer>&       theDrawer,
+                                    const bool                             theHasTexels,
+                                    const gp_Pnt2d&                        theUVOrigin,
+                                    const gp_Pnt2d&                        theUVRepeat,
+                                    const gp_Pnt2d&                        theUVScale,
+                                    const bool                             theIsClosed)
+{
+  // group sub-shapes by the shape without location (TShape and orientation)
+  NCollection_IndexedDataMap<TopoDS_Shape, NCollection_List<TopoDS_Shape>, TopTools_ShapeMapHasher>
+    anInstances;
+  for (TopoDS_Iterator aSubIter(theShape); aSubIter.More(); aSubIter.Next())
+  {
+    const TopoDS_Shape& aSubShape = aSubIter.Value();
+    const TopoDS_Shape  aProto    = aSubShape.Located(TopLoc_Location());
+    if (NCollection_List<TopoDS_Shape>* aList = anInstances.ChangeSeek(aProto))
+    {
+      aList->Append(aSubShape);
+    }
+    else
+    {
+      anInstances.ChangeFromIndex(anInstances.Add(aProto, NCollection_List<TopoDS_Shape>()))
+        .Append(aSubShape);
+    }
+  }
+
+  bool            hasArrays = false;
+  TopoDS_Compound aSingles;
+  BRep_Builder    aBuilder;
+  aBuilder.MakeCompound(aSingles);
+  for (int anInstIter = 1; anInstIter <= anInstances.Extent(); ++anInstIter)
+  {
+    const NCollection_List<TopoDS_Shape>& aList = anInstances.FindFromIndex(anInstIter);
+    occ::handle<Graphic3d_ArrayOfTriangles> aPArray;
+    if (aList.Size() > 1)
+    {
+      aPArray = fillTriangles(anInstances.FindKey(anInstIter),
+                              theHasTexels,
+                              theUVOrigin,
+                              theUVRepeat,
+                              theUVScale,
+                              0,
+                              theDrawer->IsVertexCacheOptimization());
+    }
+    for (NCollection_List<TopoDS_Shape>::Iterator aShapeIter(aList); aShapeIter.More();
+         aShapeIter.Next())
+    {
+      const gp_Trsf aTrsf = aShapeIter.Value().Location().Transformation();
+      if (aPArray.IsNull() || aTrsf.IsNegative())
+      {
+        aBuilder.Add(aSingles, aShapeIter.Value());
+        continue;
+      }
+
+      occ::handle<Graphic3d_Group> aGroup = thePrs->NewGroup();
+      aGroup->SetClosed(theIsClosed);
+      aGroup->SetTransformation(aTrsf);
+      aGroup->SetGroupPrimitivesAspect(theDrawer->ShadingAspect()->Aspect());
+      aGroup->AddPrimitiveArray(aPArray);
+      hasArrays = true;
+    }
+  }
+
+  if (aSingles.NbChildren() > 0)
+  {
+    if (occ::handle<Graphic3d_ArrayOfTriangles> aPArray =
+          fillTriangles(aSingles,
+                        theHasTexels,
+                        theUVOrigin,
+                        theUVRepeat,
+                        theUVScale,
+                        0,
+                        theDrawer->IsVertexCacheOptimization()))
+    {
+      occ::handle<Graphic3d_Group> aGroup = thePrs->NewGroup();
+      aGroup->SetClosed(theIsClosed);
+      aGroup->SetGroupPrimitivesAspect(theDrawer->ShadingAspect()->Aspect());
+      aGroup->AddPrimitiveArray(aPArray);
+      hasArrays = true;
+    }
+  }
+  return hasArrays;
+}
+
 //! Prepare shaded presentation for specified shape
 static bool shadeFromShape(const TopoDS_Shape&                    theShape,
                            const occ::handle<Prs3d_Presentation>& thePrs,
@@ -280,8 +464,60 @@ static bool shadeFromShape(const TopoDS_Shape&                    theShape,
                            const bool                             theIsClosed,
                            const occ::handle<Graphic3d_Group>&    theGroup = nullptr)
 {
+  if (theDrawer->IsInstancedTriangulation() && theGroup.IsNull()
+      && theShape.ShapeType() == TopAbs_COMPOUND)
+  {
+    return shadeInstancesFromShape(theShape,
+                                   thePrs,
+                                   theDrawer,
+                                   theHasTexels,
+                                   theUVOrigin,
+                                   theUVRepeat,
+                                   theUVScale,
+                                   theIsClosed);
+  }
+
+  double    aLodDeflections[Graphic3d_Group::MaxLevelsOfDetail] = {};
+  const int aNbLods = theGroup.IsNull() && theDrawer->NbLods() > 1
+                        ? lodDeflections(theShape, theDrawer->NbLods(), aLodDeflections)
+                        : 0;
+  if (aNbLods > 1)
+  {
+    // put each level of detail into dedicated group, chosen by graphic driver
+    bool hasArrays = false;
+    for (int aLod = 0; aLod < aNbLods; ++aLod)
+    {
+      occ::handle<Graphic3d_ArrayOfTriangles> aPArray =
+        fillTriangles(theShape,
+                      theHasTexels,
+                      theUVOrigin,
+                      theUVRepeat,
+                      theUVScale,
+                      aLod,
+                      theDrawer->IsVertexCacheOptimization());
+      if (aPArray.IsNull())
+      {
+        continue;
+      }
+
+      occ::handle<Graphic3d_Group> aGroup = thePrs->NewGroup();
+      aGroup->SetClosed(theIsClosed);
+      aGroup->SetLevelOfDetail(aLod, (float)aLodDeflections[aLod]);
+      aGroup->SetGroupPrimitivesAspect(theDrawer->ShadingAspect()->Aspect());
+      aGroup->AddPrimitiveArray(aPArray);
+      hasArrays = true;
+    }
+    return hasArrays;
+  }
+
   occ::handle<Graphic3d_ArrayOfTriangles> aPArray =
-    fillTriangles(theShape, theHasTexels, theUVOrigin, theUVRepeat, theUVScale);
+    fillTriangles(theShape,
+                  theHasTexels,
+                  theUVOrigin,
+                  theUVRepeat,
+                  theUVScale,
+                  0,
+                  theDrawer->IsVertexCacheOptimization());
   if (aPArray.IsNull())
   {
     return false;
@@ -540,6 +776,7 @@ void StdPrs_ShadedShape::Add(const occ::handle<Prs3d_Presentation>& thePrs,
                              const StdPrs_Volume                    theVolume,
                              const occ::handle<Graphic3d_Group>&    theGroup)
 {
+  OSD_TRACE_ZONE_CATEGORY("StdPrs_ShadedShape::Add", "prs");
   if (theShape.IsNull())
   {
     return;
@@ -551,6 +788,10 @@ void StdPrs_ShadedShape::Add(const occ::handle<Prs3d_Presentation>& thePrs,
     // Triangulation completeness is important for "open-closed" analysis - perform tessellation
     // beforehand
     StdPrs_ToolTriangulatedShape::Tessellate(theShape, theDrawer);
+    if (theGroup.IsNull())
+    {
+      StdPrs_ToolTriangulatedShape::TessellateLods(theShape, theDrawer);
+    }
   }
 
   // add wireframe presentation for isolated edges and vertices
@@ -18,11 +18,16 @@
 
 #include <BRepBndLib.hxx>
 #include <BRepMesh_DiscretFactory.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
 #include <BRepTools.hxx>
+#include <BRep_TFace.hxx>
 #include <BRep_Tool.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_IndexedMap.hxx>
 #include <Prs3d.hxx>
 #include <Prs3d_Drawer.hxx>
 #include <TopLoc_Location.hxx>
+#include <TopTools_ShapeMapHasher.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopoDS.hxx>
 #include <TopoDS_Face.hxx>
@@ -181,6 +186,88 @@ bool StdPrs_ToolTriangulatedShape::Tessellate(const TopoDS_Shape&              t
 
 //=================================================================================================
 
+bool StdPrs_ToolTriangulatedShape::TessellateLods(const TopoDS_Shape&              theShape,
+                                                  const occ::handle<Prs3d_Drawer>& theDrawer)
+{
+  const int aNbLods = theDrawer->NbLods();
+  if (aNbLods < 2)
+  {
+    return false;
+  }
+
+  // collect meshed faces and check if levels of detail are already there
+  NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> aFaces;
+  bool                                                          isUpToDate = true;
+  TopLoc_Location                                               aDummyLoc;
+  for (TopExp_Explorer aFaceIter(theShape, TopAbs_FACE); aFaceIter.More(); aFaceIter.Next())
+  {
+    const TopoDS_Face&                     aFace = TopoDS::Face(aFaceIter.Current());
+    const occ::handle<Poly_Triangulation>& aTri  = BRep_Tool::Triangulation(aFace, aDummyLoc);
+    if (aTri.IsNull())
+    {
+      continue;
+    }
+
+    const NCollection_List<occ::handle<Poly_Triangulation>>& aTriangulations =
+      BRep_Tool::Triangulations(aFace, aDummyLoc);
+    if (aTriangulations.Size() < aNbLods || aTriangulations.First() != aTri)
+    {
+      isUpToDate = false;
+    }
+    aFaces.Add(aFace.Located(TopLoc_Location()));
+  }
+  if (isUpToDate || aFaces.IsEmpty())
+  {
+    return false;
+  }
+
+  const double aDeflection = GetDeflection(theShape, theDrawer);
+  const double anAngle     = theDrawer->DeviationAngle();
+
+  // mesh from the coarsest level to the finest one
+  NCollection_Array1<NCollection_List<occ::handle<Poly_Triangulation>>> aFaceLods(1,
+                                                                                 aFaces.Extent());
+  IMeshTools_Parameters aParams;
+  aParams.Relative             = false;
+  aParams.InParallel           = true;
+  aParams.AllowQualityDecrease = true;
+  for (int aLod = aNbLods - 1; aLod >= 0; --aLod)
+  {
+    const double aFactor = std::pow(LodDeflectionFactor(), aLod);
+    aParams.Deflection   = aDeflection * aFactor;
+    aParams.Angle        = std::max(anAngle, std::min(anAngle * aFactor, M_PI / 3.0));
+    BRepMesh_IncrementalMesh aMesher(theShape, aParams);
+    for (int aFaceIter = 1; aFaceIter <= aFaces.Extent(); ++aFaceIter)
+    {
+      const occ::handle<Poly_Triangulation>& aTri =
+        BRep_Tool::Triangulation(TopoDS::Face(aFaces.FindKey(aFaceIter)), aDummyLoc);
+      if (!aTri.IsNull())
+      {
+        aFaceLods.ChangeValue(aFaceIter).Prepend(aTri);
+      }
+    }
+  }
+
+  // store levels of detail after the active (finest) triangulation
+  for (int aFaceIter = 1; aFaceIter <= aFaces.Extent(); ++aFaceIter)
+  {
+    const NCollection_List<occ::handle<Poly_Triangulation>>& aLods = aFaceLods.Value(aFaceIter);
+    const TopoDS_Shape&                                      aFace = aFaces.FindKey(aFaceIter);
+    if (aLods.IsEmpty()
+        || aLods.First() != BRep_Tool::Triangulation(TopoDS::Face(aFace), aDummyLoc))
+    {
+      continue;
+    }
+
+    occ::handle<BRep_TFace> aTFace = occ::down_cast<BRep_TFace>(aFace.TShape());
+    aTFace->Triangulations(aLods, aLods.First());
+    aFace.TShape()->Modified(true);
+  }
+  return true;
+}
+
+//=================================================================================================
+
 void StdPrs_ToolTriangulatedShape::ClearOnOwnDeflectionChange(
   const TopoDS_Shape&              theShape,
   const occ::handle<Prs3d_Drawer>& theDrawer,
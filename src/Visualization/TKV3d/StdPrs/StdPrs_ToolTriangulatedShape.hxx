@@ -60,6 +60,21 @@ public:
   Standard_EXPORT static bool Tessellate(const TopoDS_Shape&              theShape,
                                          const occ::handle<Prs3d_Drawer>& theDrawer);
 
+  //! Returns the factor of deflection (and deviation angle, limited by 60 degrees) between
+  //! consecutive levels of detail generated by TessellateLods().
+  static double LodDeflectionFactor() { return 4.0; }
+
+  //! Generates levels of detail of shape triangulation, when Prs3d_Drawer::NbLods() is greater
+  //! than 1 and faces do not have them yet. Coarser triangulations are computed by BRepMesh
+  //! (in parallel) with deflection increased by LodDeflectionFactor() per level and stored within
+  //! faces after the active triangulation, which is remeshed last to keep polygons on edges
+  //! consistent with it (see BRep_TFace::Triangulations()).
+  //! @param[in] theShape  the shape.
+  //! @param[in] theDrawer  the display settings.
+  //! @return true if levels of detail were generated and false otherwise.
+  Standard_EXPORT static bool TessellateLods(const TopoDS_Shape&              theShape,
+                                             const occ::handle<Prs3d_Drawer>& theDrawer);
+
   //! If presentation has own deviation coefficient and IsAutoTriangulation() is true,
   //! function will compare actual coefficients with previous values and will clear triangulation on
   //! their change (regardless actual tessellation quality). Function is placed here for
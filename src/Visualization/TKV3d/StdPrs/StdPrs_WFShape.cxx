@@ -40,51 +40,91 @@
 #include <TopExp.hxx>
 #include <TopoDS_Shape.hxx>
 #include <NCollection_List.hxx>
+#include <OSD_TraceZone.hxx>
 
-#include <mutex>
+#include <vector>
 
-//! Functor for executing StdPrs_Isolines in parallel threads.
-class StdPrs_WFShape_IsoFunctor
+namespace
 {
-public:
-  StdPrs_WFShape_IsoFunctor(
-    NCollection_List<occ::handle<NCollection_HSequence<gp_Pnt>>>& thePolylinesU,
-    NCollection_List<occ::handle<NCollection_HSequence<gp_Pnt>>>& thePolylinesV,
-    const std::vector<TopoDS_Face>&                               theFaces,
-    const occ::handle<Prs3d_Drawer>&                              theDrawer,
-    double                                                        theShapeDeflection)
-      : myPolylinesU(thePolylinesU),
-        myPolylinesV(thePolylinesV),
-        myFaces(theFaces),
-        myDrawer(theDrawer),
-        myShapeDeflection(theShapeDeflection)
+//! Discretizes the edge for wireframe presentation, reusing its polygon on triangulation
+//! or 3D polygon when defined.
+void discretizeEdge(const TopoDS_Edge&                          theEdge,
+                    const occ::handle<Prs3d_Drawer>&            theDrawer,
+                    const double                                theShapeDeflection,
+                    occ::handle<NCollection_HSequence<gp_Pnt>>& thePoints)
+{
+  if (BRep_Tool::Degenerated(theEdge))
   {
-    //
+    return;
   }
 
-  void operator()(const int& theIndex) const
+  occ::handle<NCollection_HSequence<gp_Pnt>> aPoints = new NCollection_HSequence<gp_Pnt>;
+
+  TopLoc_Location                          aLocation;
+  occ::handle<Poly_Triangulation>          aTriangulation;
+  occ::handle<Poly_PolygonOnTriangulation> anEdgeIndicies;
+  BRep_Tool::PolygonOnTriangulation(theEdge, anEdgeIndicies, aTriangulation, aLocation);
+  occ::handle<Poly_Polygon3D> aPolygon;
+
+  if (!anEdgeIndicies.IsNull())
   {
-    NCollection_List<occ::handle<NCollection_HSequence<gp_Pnt>>> aPolylinesU, aPolylinesV;
-    const TopoDS_Face&                                           aFace = myFaces[theIndex];
-    StdPrs_Isolines::Add(aFace, myDrawer, myShapeDeflection, aPolylinesU, aPolylinesV);
+    // Presentation based on triangulation of a face.
+    const NCollection_Array1<int>& anIndices = anEdgeIndicies->Nodes();
+
+    int anIndex = anIndices.Lower();
+    if (aLocation.IsIdentity())
     {
-      std::lock_guard<std::mutex> aLock(myMutex);
-      myPolylinesU.Append(aPolylinesU);
-      myPolylinesV.Append(aPolylinesV);
+      for (; anIndex <= anIndices.Upper(); ++anIndex)
+      {
+        aPoints->Append(aTriangulation->Node(anIndices[anIndex]));
+      }
+    }
+    else
+    {
+      for (; anIndex <= anIndices.Upper(); ++anIndex)
+      {
+        aPoints->Append(aTriangulation->Node(anIndices[anIndex]).Transformed(aLocation));
+      }
     }
   }
+  else if (!(aPolygon = BRep_Tool::Polygon3D(theEdge, aLocation)).IsNull())
+  {
+    // Presentation based on triangulation of the free edge on a surface.
+    const NCollection_Array1<gp_Pnt>& aNodes  = aPolygon->Nodes();
+    int                               anIndex = aNodes.Lower();
+    if (aLocation.IsIdentity())
+    {
+      for (; anIndex <= aNodes.Upper(); ++anIndex)
+      {
+        aPoints->Append(aNodes.Value(anIndex));
+      }
+    }
+    else
+    {
+      for (; anIndex <= aNodes.Upper(); ++anIndex)
+      {
+        aPoints->Append(aNodes.Value(anIndex).Transformed(aLocation));
+      }
+    }
+  }
+  else if (BRep_Tool::IsGeometric(theEdge))
+  {
+    // Default presentation for edges without triangulation.
+    BRepAdaptor_Curve aCurve(theEdge);
+    StdPrs_DeflectionCurve::Add(occ::handle<Prs3d_Presentation>(),
+                                aCurve,
+                                theShapeDeflection,
+                                theDrawer,
+                                aPoints->ChangeSequence(),
+                                false);
+  }
 
-private:
-  StdPrs_WFShape_IsoFunctor operator=(StdPrs_WFShape_IsoFunctor&) = delete;
-
-private:
-  NCollection_List<occ::handle<NCollection_HSequence<gp_Pnt>>>& myPolylinesU;
-  NCollection_List<occ::handle<NCollection_HSequence<gp_Pnt>>>& myPolylinesV;
-  const std::vector<TopoDS_Face>&                               myFaces;
-  const occ::handle<Prs3d_Drawer>&                              myDrawer;
-  mutable std::mutex                                            myMutex;
-  const double                                                  myShapeDeflection;
-};
+  if (!aPoints->IsEmpty())
+  {
+    thePoints = aPoints;
+  }
+}
+} // namespace
 
 //=================================================================================================
 
@@ -93,6 +133,7 @@ void StdPrs_WFShape::Add(const occ::handle<Prs3d_Presentation>& thePresentation,
                          const occ::handle<Prs3d_Drawer>&       theDrawer,
                          bool                                   theIsParallel)
 {
+  OSD_TRACE_ZONE_CATEGORY("StdPrs_WFShape::Add", "prs");
   if (theShape.IsNull())
   {
     return;
@@ -137,54 +178,37 @@ void StdPrs_WFShape::Add(const occ::handle<Prs3d_Presentation>& thePresentation,
       aVPolylinesPtr = &aCommonPolylines; // put V isolines into single group with common edges
     }
 
-    bool isParallelIso = false;
-    if (theIsParallel)
+    std::vector<TopoDS_Face> aFaces;
+    for (TopExp_Explorer aFaceExplorer(theShape, TopAbs_FACE); aFaceExplorer.More();
+         aFaceExplorer.Next())
     {
-      int aNbFaces = 0;
-      for (TopExp_Explorer aFaceExplorer(theShape, TopAbs_FACE); aFaceExplorer.More();
-           aFaceExplorer.Next())
-      {
-        ++aNbFaces;
-      }
-      if (aNbFaces > 1)
+      const TopoDS_Face& aFace = TopoDS::Face(aFaceExplorer.Current());
+      if (theDrawer->IsoOnPlane() || !StdPrs_ShapeTool::IsPlanarFace(aFace))
       {
-        isParallelIso = true;
-        std::vector<TopoDS_Face> aFaces(aNbFaces);
-        aNbFaces = 0;
-        for (TopExp_Explorer aFaceExplorer(theShape, TopAbs_FACE); aFaceExplorer.More();
-             aFaceExplorer.Next())
-        {
-          const TopoDS_Face& aFace = TopoDS::Face(aFaceExplorer.Current());
-          if (theDrawer->IsoOnPlane() || !StdPrs_ShapeTool::IsPlanarFace(aFace))
-          {
-            aFaces[aNbFaces++] = aFace;
-          }
-        }
-
-        StdPrs_WFShape_IsoFunctor anIsoFunctor(*aUPolylinesPtr,
-                                               *aVPolylinesPtr,
-                                               aFaces,
-                                               theDrawer,
-                                               aShapeDeflection);
-        OSD_Parallel::For(0, aNbFaces, anIsoFunctor, aNbFaces < 2);
+        aFaces.push_back(aFace);
       }
     }
 
-    if (!isParallelIso)
+    // isolines of each face are collected separately and merged in the order of faces,
+    // so that the presentation does not depend on the scheduling of threads
+    const int aNbFaces = int(aFaces.size());
+    std::vector<NCollection_List<occ::handle<NCollection_HSequence<gp_Pnt>>>> aFacesU(aNbFaces),
+      aFacesV(aNbFaces);
+    OSD_Parallel::For(
+      0,
+      aNbFaces,
+      [&](const int theIndex) {
+        StdPrs_Isolines::Add(aFaces[theIndex],
+                             theDrawer,
+                             aShapeDeflection,
+                             aFacesU[theIndex],
+                             aFacesV[theIndex]);
+      },
+      !theIsParallel || aNbFaces < 2);
+    for (int aFaceIter = 0; aFaceIter < aNbFaces; ++aFaceIter)
     {
-      for (TopExp_Explorer aFaceExplorer(theShape, TopAbs_FACE); aFaceExplorer.More();
-           aFaceExplorer.Next())
-      {
-        const TopoDS_Face& aFace = TopoDS::Face(aFaceExplorer.Current());
-        if (theDrawer->IsoOnPlane() || !StdPrs_ShapeTool::IsPlanarFace(aFace))
-        {
-          StdPrs_Isolines::Add(aFace,
-                               theDrawer,
-                               aShapeDeflection,
-                               *aUPolylinesPtr,
-                               *aVPolylinesPtr);
-        }
-      }
+      aUPolylinesPtr->Append(aFacesU[aFaceIter]);
+      aVPolylinesPtr->Append(aFacesV[aFaceIter]);
     }
 
     Prs3d::AddPrimitivesGroup(thePresentation, anIsoAspectU, aUPolylines);
@@ -218,7 +242,8 @@ void StdPrs_WFShape::Add(const occ::handle<Prs3d_Presentation>& thePresentation,
              aShapeDeflection,
              theDrawer->WireDraw() ? &aCommonPolylines : nullptr,
              aFreePtr,
-             anUnfreePtr);
+             anUnfreePtr,
+             theIsParallel);
     Prs3d::AddPrimitivesGroup(thePresentation, theDrawer->UnFreeBoundaryAspect(), anUnfree);
     Prs3d::AddPrimitivesGroup(thePresentation, theDrawer->FreeBoundaryAspect(), aFree);
   }
@@ -238,11 +263,18 @@ void StdPrs_WFShape::Add(const occ::handle<Prs3d_Presentation>& thePresentation,
 
 occ::handle<Graphic3d_ArrayOfPrimitives> StdPrs_WFShape::AddAllEdges(
   const TopoDS_Shape&              theShape,
-  const occ::handle<Prs3d_Drawer>& theDrawer)
+  const occ::handle<Prs3d_Drawer>& theDrawer,
+  const bool                       theIsParallel)
 {
   const double aShapeDeflection = StdPrs_ToolTriangulatedShape::GetDeflection(theShape, theDrawer);
   NCollection_List<occ::handle<NCollection_HSequence<gp_Pnt>>> aPolylines;
-  addEdges(theShape, theDrawer, aShapeDeflection, &aPolylines, &aPolylines, &aPolylines);
+  addEdges(theShape,
+           theDrawer,
+           aShapeDeflection,
+           &aPolylines,
+           &aPolylines,
+           &aPolylines,
+           theIsParallel);
   return Prs3d::PrimitivesFromPolylines(aPolylines);
 }
 
@@ -254,7 +286,8 @@ void StdPrs_WFShape::addEdges(
   double                                                        theShapeDeflection,
   NCollection_List<occ::handle<NCollection_HSequence<gp_Pnt>>>* theWire,
   NCollection_List<occ::handle<NCollection_HSequence<gp_Pnt>>>* theFree,
-  NCollection_List<occ::handle<NCollection_HSequence<gp_Pnt>>>* theUnFree)
+  NCollection_List<occ::handle<NCollection_HSequence<gp_Pnt>>>* theUnFree,
+  const bool                                                    theIsParallel)
 {
   if (theShape.IsNull())
   {
@@ -301,15 +334,15 @@ void StdPrs_WFShape::addEdges(
 
   if (!aLWire.IsEmpty())
   {
-    addEdges(aLWire, theDrawer, theShapeDeflection, *theWire);
+    addEdges(aLWire, theDrawer, theShapeDeflection, *theWire, theIsParallel);
   }
   if (!aLFree.IsEmpty())
   {
-    addEdges(aLFree, theDrawer, theShapeDeflection, *theFree);
+    addEdges(aLFree, theDrawer, theShapeDeflection, *theFree, theIsParallel);
   }
   if (!aLUnFree.IsEmpty())
   {
-    addEdges(aLUnFree, theDrawer, theShapeDeflection, *theUnFree);
+    addEdges(aLUnFree, theDrawer, theShapeDeflection, *theUnFree, theIsParallel);
   }
 }
 
@@ -319,81 +352,32 @@ void StdPrs_WFShape::addEdges(
   const NCollection_List<TopoDS_Shape>&                         theEdges,
   const occ::handle<Prs3d_Drawer>&                              theDrawer,
   const double                                                  theShapeDeflection,
-  NCollection_List<occ::handle<NCollection_HSequence<gp_Pnt>>>& thePolylines)
+  NCollection_List<occ::handle<NCollection_HSequence<gp_Pnt>>>& thePolylines,
+  const bool                                                    theIsParallel)
 {
-  NCollection_List<TopoDS_Shape>::Iterator anEdgesIter;
-  for (anEdgesIter.Initialize(theEdges); anEdgesIter.More(); anEdgesIter.Next())
+  std::vector<TopoDS_Edge> anEdges;
+  anEdges.reserve(theEdges.Size());
+  for (NCollection_List<TopoDS_Shape>::Iterator anEdgesIter(theEdges); anEdgesIter.More();
+       anEdgesIter.Next())
   {
-    const TopoDS_Edge& anEdge = TopoDS::Edge(anEdgesIter.Value());
-    if (BRep_Tool::Degenerated(anEdge))
-    {
-      continue;
-    }
-
-    occ::handle<NCollection_HSequence<gp_Pnt>> aPoints = new NCollection_HSequence<gp_Pnt>;
-
-    TopLoc_Location                          aLocation;
-    occ::handle<Poly_Triangulation>          aTriangulation;
-    occ::handle<Poly_PolygonOnTriangulation> anEdgeIndicies;
-    BRep_Tool::PolygonOnTriangulation(anEdge, anEdgeIndicies, aTriangulation, aLocation);
-    occ::handle<Poly_Polygon3D> aPolygon;
-
-    if (!anEdgeIndicies.IsNull())
-    {
-      // Presentation based on triangulation of a face.
-      const NCollection_Array1<int>& anIndices = anEdgeIndicies->Nodes();
-
-      int anIndex = anIndices.Lower();
-      if (aLocation.IsIdentity())
-      {
-        for (; anIndex <= anIndices.Upper(); ++anIndex)
-        {
-          aPoints->Append(aTriangulation->Node(anIndices[anIndex]));
-        }
-      }
-      else
-      {
-        for (; anIndex <= anIndices.Upper(); ++anIndex)
-        {
-          aPoints->Append(aTriangulation->Node(anIndices[anIndex]).Transformed(aLocation));
-        }
-      }
-    }
-    else if (!(aPolygon = BRep_Tool::Polygon3D(anEdge, aLocation)).IsNull())
-    {
-      // Presentation based on triangulation of the free edge on a surface.
-      const NCollection_Array1<gp_Pnt>& aNodes  = aPolygon->Nodes();
-      int                               anIndex = aNodes.Lower();
-      if (aLocation.IsIdentity())
-      {
-        for (; anIndex <= aNodes.Upper(); ++anIndex)
-        {
-          aPoints->Append(aNodes.Value(anIndex));
-        }
-      }
-      else
-      {
-        for (; anIndex <= aNodes.Upper(); ++anIndex)
-        {
-          aPoints->Append(aNodes.Value(anIndex).Transformed(aLocation));
-        }
-      }
-    }
-    else if (BRep_Tool::IsGeometric(anEdge))
-    {
-      // Default presentation for edges without triangulation.
-      BRepAdaptor_Curve aCurve(anEdge);
-      StdPrs_DeflectionCurve::Add(occ::handle<Prs3d_Presentation>(),
-                                  aCurve,
-                                  theShapeDeflection,
-                                  theDrawer,
-                                  aPoints->ChangeSequence(),
-                                  false);
-    }
+    anEdges.push_back(TopoDS::Edge(anEdgesIter.Value()));
+  }
 
-    if (!aPoints->IsEmpty())
+  // edges are discretized independently and appended in the original order
+  const int                                               aNbEdges = int(anEdges.size());
+  std::vector<occ::handle<NCollection_HSequence<gp_Pnt>>> aPolylines(aNbEdges);
+  OSD_Parallel::For(
+    0,
+    aNbEdges,
+    [&](const int theIndex) {
+      discretizeEdge(anEdges[theIndex], theDrawer, theShapeDeflection, aPolylines[theIndex]);
+    },
+    !theIsParallel || aNbEdges < 2);
+  for (int anEdgeIter = 0; anEdgeIter < aNbEdges; ++anEdgeIter)
+  {
+    if (!aPolylines[anEdgeIter].IsNull())
     {
-      thePolylines.Append(aPoints);
+      thePolylines.Append(aPolylines[anEdgeIter]);
     }
   }
 }
@@ -61,9 +61,11 @@ public:
   //! Compute all edges (wire, free, unfree) and put them into single primitive array.
   //! @param[in] theShape  the shape
   //! @param[in] theDrawer  the drawer settings (deviation angle and maximal parameter value)
+  //! @param[in] theIsParallel  discretize edges using multiple threads
   Standard_EXPORT static occ::handle<Graphic3d_ArrayOfPrimitives> AddAllEdges(
     const TopoDS_Shape&              theShape,
-    const occ::handle<Prs3d_Drawer>& theDrawer);
+    const occ::handle<Prs3d_Drawer>& theDrawer,
+    const bool                       theIsParallel = false);
 
   //! Compute vertex presentation for a shape.
   //! @param[in] theShape  the shape
@@ -80,23 +82,27 @@ private:
   //! @param[out] theWire  output polylines for lonely wires
   //! @param[out] theFree  output polylines for free edges
   //! @param[out] theUnFree  output polylines for non-free edges
+  //! @param[in] theIsParallel  discretize edges using multiple threads
   Standard_EXPORT static void addEdges(
     const TopoDS_Shape&                                           theShape,
     const occ::handle<Prs3d_Drawer>&                              theDrawer,
     double                                                        theShapeDeflection,
     NCollection_List<occ::handle<NCollection_HSequence<gp_Pnt>>>* theWire,
     NCollection_List<occ::handle<NCollection_HSequence<gp_Pnt>>>* theFree,
-    NCollection_List<occ::handle<NCollection_HSequence<gp_Pnt>>>* theUnFree);
+    NCollection_List<occ::handle<NCollection_HSequence<gp_Pnt>>>* theUnFree,
+    const bool                                                    theIsParallel);
 
   //! Compute edge presentations for a shape.
   //! @param[in] theEdges  the list of edges
   //! @param[in] theDrawer  the drawer settings (deviation angle and maximal parameter value)
   //! @param[in] theShapeDeflection  the deflection for the wireframe shape
   //! @param[out] thePolylines  output polylines
+  //! @param[in] theIsParallel  discretize edges using multiple threads
   static void addEdges(const NCollection_List<TopoDS_Shape>& theEdges,
                        const occ::handle<Prs3d_Drawer>&      theDrawer,
                        const double                          theShapeDeflection,
-                       NCollection_List<occ::handle<NCollection_HSequence<gp_Pnt>>>& thePolylines);
+                       NCollection_List<occ::handle<NCollection_HSequence<gp_Pnt>>>& thePolylines,
+                       const bool theIsParallel);
 };
 
 #endif // _StdPrs_WFShape_H__
@@ -147,7 +147,8 @@ void StdSelect_BRepSelectionTool::Load(const occ::handle<SelectMgr_Selection>& t
                                        const bool                              isAutoTriangulation,
                                        const int                               thePriority,
                                        const int                               theNbPOnEdge,
-                                       const double                            theMaxParam)
+                                       const double                            theMaxParam,
+                                       const int                               theCompactThreshold)
 {
   int aPriority = (thePriority == -1) ? GetStandardPriority(theShape, theType) : thePriority;
   if (isAutoTriangulation && !BRepTools::Triangulation(theShape, Precision::Infinite(), true))
@@ -180,7 +181,8 @@ void StdSelect_BRepSelectionTool::Load(const occ::handle<SelectMgr_Selection>& t
                          theDeviationAngle,
                          theNbPOnEdge,
                          theMaxParam,
-                         isAutoTriangulation);
+                         isAutoTriangulation,
+                         theCompactThreshold);
       }
       break;
     }
@@ -193,7 +195,8 @@ void StdSelect_BRepSelectionTool::Load(const occ::handle<SelectMgr_Selection>& t
                        theDeviationAngle,
                        theNbPOnEdge,
                        theMaxParam,
-                       isAutoTriangulation);
+                       isAutoTriangulation,
+                       theCompactThreshold);
     }
   }
 }
@@ -210,7 +213,8 @@ void StdSelect_BRepSelectionTool::Load(
   const bool                                     isAutoTriangulation,
   const int                                      thePriority,
   const int                                      theNbPOnEdge,
-  const double                                   theMaxParam)
+  const double                                   theMaxParam,
+  const int                                      theCompactThreshold)
 {
   Load(theSelection,
        theShape,
@@ -220,7 +224,8 @@ void StdSelect_BRepSelectionTool::Load(
        isAutoTriangulation,
        thePriority,
        theNbPOnEdge,
-       theMaxParam);
+       theMaxParam,
+       theCompactThreshold);
 
   // loading of selectables...
   for (NCollection_Vector<occ::handle<SelectMgr_SensitiveEntity>>::Iterator aSelEntIter(
@@ -244,7 +249,8 @@ void StdSelect_BRepSelectionTool::ComputeSensitive(
   const double                              theDeviationAngle,
   const int                                 theNbPOnEdge,
   const double                              theMaxParam,
-  const bool                                isAutoTriangulation)
+  const bool                                isAutoTriangulation,
+  const int                                 theCompactThreshold)
 {
   switch (theShape.ShapeType())
   {
@@ -301,7 +307,9 @@ void StdSelect_BRepSelectionTool::ComputeSensitive(
                           aSensitiveList,
                           isAutoTriangulation,
                           theNbPOnEdge,
-                          theMaxParam);
+                          theMaxParam,
+                          true,
+                          theCompactThreshold);
       for (NCollection_Sequence<occ::handle<Select3D_SensitiveEntity>>::Iterator aSensIter(
              aSensitiveList);
            aSensIter.More();
@@ -328,7 +336,8 @@ void StdSelect_BRepSelectionTool::ComputeSensitive(
                            theDeviationAngle,
                            theNbPOnEdge,
                            theMaxParam,
-                           isAutoTriangulation);
+                           isAutoTriangulation,
+                           theCompactThreshold);
         }
       }
       break;
@@ -346,7 +355,8 @@ void StdSelect_BRepSelectionTool::ComputeSensitive(
                          theDeviationAngle,
                          theNbPOnEdge,
                          theMaxParam,
-                         isAutoTriangulation);
+                         isAutoTriangulation,
+                         theCompactThreshold);
       }
       // sub-edges
       for (anExp.Init(theShape, TopAbs_EDGE, TopAbs_FACE); anExp.More(); anExp.Next())
@@ -358,7 +368,8 @@ void StdSelect_BRepSelectionTool::ComputeSensitive(
                          theDeviationAngle,
                          theNbPOnEdge,
                          theMaxParam,
-                         isAutoTriangulation);
+                         isAutoTriangulation,
+                         theCompactThreshold);
       }
       // sub-wires
       for (anExp.Init(theShape, TopAbs_WIRE, TopAbs_FACE); anExp.More(); anExp.Next())
@@ -370,7 +381,8 @@ void StdSelect_BRepSelectionTool::ComputeSensitive(
                          theDeviationAngle,
                          theNbPOnEdge,
                          theMaxParam,
-                         isAutoTriangulation);
+                         isAutoTriangulation,
+                         theCompactThreshold);
       }
 
       // sub-faces
@@ -385,7 +397,8 @@ void StdSelect_BRepSelectionTool::ComputeSensitive(
                          theDeviationAngle,
                          theNbPOnEdge,
                          theMaxParam,
-                         isAutoTriangulation);
+                         isAutoTriangulation,
+                         theCompactThreshold);
       }
     }
   }
@@ -647,7 +660,8 @@ bool StdSelect_BRepSelectionTool::GetSensitiveForFace(
   const bool /*theAutoTriangulation*/,
   const int    NbPOnEdge,
   const double theMaxParam,
-  const bool   theInteriorFlag)
+  const bool   theInteriorFlag,
+  const int    theCompactThreshold)
 {
   TopLoc_Location                  aLocSurf;
   const occ::handle<Geom_Surface>& aSurf = BRep_Tool::Surface(theFace, aLocSurf);
@@ -770,8 +784,14 @@ bool StdSelect_BRepSelectionTool::GetSensitiveForFace(
   TopLoc_Location aLoc;
   if (occ::handle<Poly_Triangulation> aTriangulation = BRep_Tool::Triangulation(theFace, aLoc))
   {
+    const bool isCompact = theInteriorFlag && theCompactThreshold > 0
+                           && aTriangulation->NbTriangles() >= theCompactThreshold;
     occ::handle<Select3D_SensitiveTriangulation> STG =
-      new Select3D_SensitiveTriangulation(theOwner, aTriangulation, aLoc, theInteriorFlag);
+      new Select3D_SensitiveTriangulation(theOwner,
+                                          aTriangulation,
+                                          aLoc,
+                                          theInteriorFlag,
+                                          isCompact);
     theSensitiveList.Append(STG);
     return true;
   }
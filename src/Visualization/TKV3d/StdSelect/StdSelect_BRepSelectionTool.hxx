@@ -78,15 +78,18 @@ public:
   //! computed for faces which have no existing one.
   //! if AutoTriangulation = False the old algorithm will be
   //! called to compute sensitive entities on faces.
+  //! Face triangulations with at least theCompactThreshold triangles get compact sensitive
+  //! entities (see Select3D_SensitiveTriangulation); 0 disables compact mode.
   Standard_EXPORT static void Load(const occ::handle<SelectMgr_Selection>& aSelection,
                                    const TopoDS_Shape&                     aShape,
                                    const TopAbs_ShapeEnum                  aType,
                                    const double                            theDeflection,
                                    const double                            theDeviationAngle,
-                                   const bool                              AutoTriangulation = true,
-                                   const int                               aPriority         = -1,
-                                   const int                               NbPOnEdge         = 9,
-                                   const double                            MaximalParameter  = 500);
+                                   const bool   AutoTriangulation   = true,
+                                   const int    aPriority           = -1,
+                                   const int    NbPOnEdge           = 9,
+                                   const double MaximalParameter    = 500,
+                                   const int    theCompactThreshold = 0);
 
   //! Same functionalities. The only
   //! difference is that the selectable object from which the
@@ -102,10 +105,11 @@ public:
                                    const TopAbs_ShapeEnum                         aType,
                                    const double                                   theDeflection,
                                    const double                                   theDeviationAngle,
-                                   const bool   AutoTriangulation = true,
-                                   const int    aPriority         = -1,
-                                   const int    NbPOnEdge         = 9,
-                                   const double MaximalParameter  = 500);
+                                   const bool   AutoTriangulation   = true,
+                                   const int    aPriority           = -1,
+                                   const int    NbPOnEdge           = 9,
+                                   const double MaximalParameter    = 500,
+                                   const int    theCompactThreshold = 0);
 
   //! Returns the standard priority of the shape aShap having the type aType.
   //! This priority is passed to a StdSelect_BRepOwner object.
@@ -161,6 +165,8 @@ public:
   //! @param[in] theMaxiParam    sensitivity parameters for infinite objects (the default value is
   //! 500)
   //! @param[in] theAutoTriang   flag to compute triangulation for the faces which have none
+  //! @param[in] theCompactThreshold minimal number of triangles for compact face sensitive,
+  //!                                0 disables compact mode
   Standard_EXPORT static void ComputeSensitive(const TopoDS_Shape&                       theShape,
                                                const occ::handle<SelectMgr_EntityOwner>& theOwner,
                                                const occ::handle<SelectMgr_Selection>& theSelection,
@@ -168,7 +174,8 @@ public:
                                                const double theDeflAngle,
                                                const int    theNbPOnEdge,
                                                const double theMaxiParam,
-                                               const bool   theAutoTriang = true);
+                                               const bool   theAutoTriang       = true,
+                                               const int    theCompactThreshold = 0);
 
   //! Creates the 3D sensitive entities for Face selection.
   //! @param[in]  theFace         face to compute sensitive entities
@@ -179,14 +186,17 @@ public:
   //! @param[in]  theMaxiParam    sensitivity parameters
   //! @param[in]  theInteriorFlag flag indicating that face interior (TRUE) or face boundary (FALSE)
   //! should be selectable
+  //! @param[in]  theCompactThreshold minimal number of triangles for compact sensitive
+  //!                                 triangulation of face interior, 0 disables compact mode
   Standard_EXPORT static bool GetSensitiveForFace(
     const TopoDS_Face&                                           theFace,
     const occ::handle<SelectMgr_EntityOwner>&                    theOwner,
     NCollection_Sequence<occ::handle<Select3D_SensitiveEntity>>& theOutList,
-    const bool                                                   theAutoTriang   = true,
-    const int                                                    theNbPOnEdge    = 9,
-    const double                                                 theMaxiParam    = 500,
-    const bool                                                   theInteriorFlag = true);
+    const bool                                                   theAutoTriang       = true,
+    const int                                                    theNbPOnEdge        = 9,
+    const double                                                 theMaxiParam        = 500,
+    const bool                                                   theInteriorFlag     = true,
+    const int                                                    theCompactThreshold = 0);
 
   //! Creates a sensitive cylinder.
   //! @param[in] theSubfacesMap map of cylinder faces